@@ -10,6 +10,7 @@
 #include <NDK/Prerequisites.hpp>
 #include <NDK/World.hpp>
 #include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/FramePacer.hpp>
 #include <map>
 #include <list>
 #include <set>
@@ -52,6 +53,8 @@ namespace Ndk
 			inline FPSCounterOverlay& GetFPSCounterOverlay(std::size_t windowIndex = 0U);
 			#endif
 
+			inline const Nz::FramePacer::Statistics& GetFrameStatistics() const;
+			inline unsigned int GetFramerateLimit() const;
 			inline const std::set<Nz::String>& GetOptions() const;
 			inline const std::map<Nz::String, Nz::String>& GetParameters() const;
 
@@ -73,6 +76,8 @@ namespace Ndk
 
 			inline void Quit();
 
+			inline void SetFramerateLimit(unsigned int framerateLimit);
+
 			Application& operator=(const Application&) = delete;
 			Application& operator=(Application&&) = delete;
 
@@ -132,6 +137,7 @@ namespace Ndk
 			std::set<Nz::String> m_options;
 			std::list<World> m_worlds;
 			Nz::Clock m_updateClock;
+			Nz::FramePacer m_framePacer;
 
 			#ifndef NDK_SERVER
 			Nz::UInt32 m_overlayFlags;
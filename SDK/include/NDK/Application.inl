@@ -215,6 +215,24 @@ namespace Ndk
 	}
 	#endif
 
+	/*!
+	* \brief Gets the timing statistics of the frames run until now
+	* \return Frame statistics, measured between two calls to Run
+	*/
+	inline const Nz::FramePacer::Statistics& Application::GetFrameStatistics() const
+	{
+		return m_framePacer.GetStatistics();
+	}
+
+	/*!
+	* \brief Gets the maximum number of frames per second
+	* \return Framerate limit, zero if frames aren't limited
+	*/
+	inline unsigned int Application::GetFramerateLimit() const
+	{
+		return m_framePacer.GetFramerateLimit();
+	}
+
 	/*!
 	* \brief Gets the options used to start the application
 	*
@@ -338,6 +356,18 @@ namespace Ndk
 		m_shouldQuit = true;
 	}
 
+	/*!
+	* \brief Limits the number of frames per second
+	*
+	* Run waits for the deadline of the frame before updating, without busy-waiting.
+	*
+	* \param framerateLimit Maximum number of frames per second, zero to not limit the frames
+	*/
+	inline void Application::SetFramerateLimit(unsigned int framerateLimit)
+	{
+		m_framePacer.SetFramerateLimit(framerateLimit);
+	}
+
 	/*!
 	* \brief Gets the singleton instance of the application
 	* \return Singleton application
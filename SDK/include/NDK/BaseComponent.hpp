@@ -7,6 +7,7 @@
 #ifndef NDK_BASECOMPONENT_HPP
 #define NDK_BASECOMPONENT_HPP
 
+#include <Nazara/Core/SerializationContext.hpp>
 #include <NDK/Entity.hpp>
 #include <functional>
 #include <unordered_map>
@@ -21,6 +22,8 @@ namespace Ndk
 
 		public:
 			using Factory = std::function<BaseComponent*()>;
+			using Serializer = std::function<bool(Nz::SerializationContext& context, const BaseComponent& component)>;
+			using Unserializer = std::function<bool(Nz::SerializationContext& context, BaseComponent& component)>;
 
 			BaseComponent(ComponentIndex componentIndex);
 			BaseComponent(BaseComponent&&) = default;
@@ -31,7 +34,13 @@ namespace Ndk
 			inline const EntityHandle& GetEntity() const;
 			ComponentIndex GetIndex() const;
 
+			inline static bool FindComponentIndex(ComponentId id, ComponentIndex* index);
+			inline static ComponentId GetComponentId(ComponentIndex index);
 			inline static ComponentIndex GetMaxComponentIndex();
+			inline static bool IsSerializable(ComponentIndex index);
+			static bool SerializeComponent(Nz::SerializationContext& context, const BaseComponent& component);
+			static std::unique_ptr<BaseComponent> UnserializeComponent(Nz::SerializationContext& context, ComponentIndex index);
+			static bool UnserializeComponent(Nz::SerializationContext& context, BaseComponent& component);
 
 			BaseComponent& operator=(const BaseComponent&) = delete;
 			BaseComponent& operator=(BaseComponent&&) = default;
@@ -43,6 +52,7 @@ namespace Ndk
 			EntityHandle m_entity;
 
 			static ComponentIndex RegisterComponent(ComponentId id, Factory factoryFunc);
+			static void RegisterSerializer(ComponentIndex index, Factory factory, Serializer serializer, Unserializer unserializer);
 
 		private:
 			virtual void OnAttached();
@@ -62,6 +72,8 @@ namespace Ndk
 			{
 				ComponentId id;
 				Factory factory;
+				Serializer serializer;
+				Unserializer unserializer;
 			};
 
 			static std::vector<ComponentEntry> s_entries;
@@ -18,6 +18,40 @@ namespace Ndk
 	{
 	}
 
+	/*!
+	* \brief Finds the index of a component from its identifier
+	* \return true If a component is registered with this identifier
+	*
+	* \param id Identifier of the component
+	* \param index Output index of the component, must be valid
+	*/
+	inline bool BaseComponent::FindComponentIndex(ComponentId id, ComponentIndex* index)
+	{
+		NazaraAssert(index, "Invalid index pointer");
+
+		auto it = s_idToIndex.find(id);
+		if (it == s_idToIndex.end())
+			return false;
+
+		*index = it->second;
+		return true;
+	}
+
+	/*!
+	* \brief Gets the identifier of a component from its index
+	* \return Identifier the component was registered with
+	*
+	* \param index Index of the component
+	*
+	* \remark Produces a NazaraAssert if the index is not registered
+	*/
+	inline ComponentId BaseComponent::GetComponentId(ComponentIndex index)
+	{
+		NazaraAssert(index < s_entries.size(), "Invalid component index");
+
+		return s_entries[index].id;
+	}
+
 	/*!
 	* \brief Gets the entity owning this component
 	* \return A handle to the entity owning this component, may be invalid if no entity owns it.
@@ -46,6 +80,17 @@ namespace Ndk
 		return static_cast<ComponentIndex>(s_entries.size());
 	}
 
+	/*!
+	* \brief Checks whether a serializer was registered for a component
+	* \return true If it is the case
+	*
+	* \param index Index of the component
+	*/
+	inline bool BaseComponent::IsSerializable(ComponentIndex index)
+	{
+		return index < s_entries.size() && s_entries[index].serializer;
+	}
+
 	/*!
 	* \brief Registers a component
 	* \return Index of the registered component
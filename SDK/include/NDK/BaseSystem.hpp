@@ -9,6 +9,7 @@
 
 #include <Nazara/Core/Bitset.hpp>
 #include <NDK/EntityList.hpp>
+#include <vector>
 
 namespace Ndk
 {
@@ -26,21 +27,31 @@ namespace Ndk
 			BaseSystem(BaseSystem&&) noexcept = default;
 			virtual ~BaseSystem();
 
+			bool ConflictsWith(const BaseSystem& system) const;
+
 			inline void Enable(bool enable = true);
+			inline void EnableFixedStep(bool enable = true);
+			inline void EnableParallelIteration(bool enable = true);
 
 			bool Filters(const Entity* entity) const;
+			bool Filters(const Nz::Bitset<>& components) const;
 
 			inline const EntityList& GetEntities() const;
+			inline unsigned int GetEntityUpdateInterval(const Entity* entity) const;
 			inline float GetFixedUpdateRate() const;
 			inline SystemIndex GetIndex() const;
 			inline float GetMaximumUpdateRate() const;
 			inline int GetUpdateOrder() const;
 			inline World& GetWorld() const;
 
+			inline bool HasDeclaredComponentAccess() const;
 			inline bool IsEnabled() const;
+			inline bool IsFixedStepEnabled() const;
+			inline bool IsParallelIterationEnabled() const;
 
 			inline bool HasEntity(const Entity* entity) const;
 
+			void SetEntityUpdateInterval(const Entity* entity, unsigned int interval);
 			inline void SetFixedUpdateRate(float updatePerSecond);
 			inline void SetMaximumUpdateRate(float updatePerSecond);
 			void SetUpdateOrder(int updateOrder);
@@ -55,8 +66,16 @@ namespace Ndk
 			template<typename ComponentType1, typename ComponentType2, typename... Rest> void Excludes();
 			inline void ExcludesComponent(ComponentIndex index);
 
+			template<typename F> void ForEachDueEntity(float elapsedTime, const F& iterationFunc, std::size_t blockGrainSize = 0);
+
 			static SystemIndex GetNextIndex();
 
+			template<typename F> void ParallelForEachEntity(const EntityList& entities, const F& iterationFunc, std::size_t blockGrainSize = 0) const;
+
+			template<typename ComponentType> void Reads();
+			template<typename ComponentType1, typename ComponentType2, typename... Rest> void Reads();
+			inline void ReadsComponent(ComponentIndex index);
+
 			template<typename ComponentType> void Requires();
 			template<typename ComponentType1, typename ComponentType2, typename... Rest> void Requires();
 			inline void RequiresComponent(ComponentIndex index);
@@ -65,36 +84,67 @@ namespace Ndk
 			template<typename ComponentType1, typename ComponentType2, typename... Rest> void RequiresAny();
 			inline void RequiresAnyComponent(ComponentIndex index);
 
+			template<typename ComponentType> void Writes();
+			template<typename ComponentType1, typename ComponentType2, typename... Rest> void Writes();
+			inline void WritesComponent(ComponentIndex index);
+
 			virtual void OnUpdate(float elapsedTime) = 0;
 
 		private:
+			struct EntityUpdateBucket
+			{
+				double lastUpdateTime = 0.0;
+				unsigned int bucket = 0;
+				unsigned int interval = 0; //< 0 means the entity was never given an interval
+			};
+
+			inline void AddEntities(const std::vector<Entity*>& entities);
 			inline void AddEntity(Entity* entity);
 
+			bool CanIterateInParallel() const;
+
+			const EntityHandle& GetEntity(EntityId id) const;
+
+			virtual void OnEntitiesAdded(const std::vector<Entity*>& entities);
+			virtual void OnEntitiesRemoved(const std::vector<Entity*>& entities);
+			virtual void OnEntitiesValidation(const std::vector<Entity*>& entities, bool justAdded);
 			virtual void OnEntityAdded(Entity* entity);
 			virtual void OnEntityRemoved(Entity* entity);
 			virtual void OnEntityValidation(Entity* entity, bool justAdded);
 
+			inline void RemoveEntities(const std::vector<Entity*>& entities);
 			inline void RemoveEntity(Entity* entity);
+			inline void ResetEntityUpdateInterval(const Entity* entity);
 
 			inline void SetWorld(World* world) noexcept;
 
+			inline void ValidateEntities(const std::vector<Entity*>& entities, bool justAdded);
 			inline void ValidateEntity(Entity* entity, bool justAdded);
 
 			static inline bool Initialize();
 			static inline void Uninitialize();
 
 			Nz::Bitset<> m_excludedComponents;
-			mutable Nz::Bitset<> m_filterResult;
+			Nz::Bitset<> m_readComponents;
 			Nz::Bitset<> m_requiredAnyComponents;
 			Nz::Bitset<> m_requiredComponents;
+			Nz::Bitset<> m_writtenComponents;
+			std::vector<EntityUpdateBucket> m_entityUpdateBuckets;
 			EntityList m_entities;
 			SystemIndex m_systemIndex;
+			const char* m_profilerName;
 			World* m_world;
+			bool m_componentAccessDeclared;
+			bool m_fixedStepEnabled;
+			bool m_parallelIterationEnabled;
 			bool m_updateEnabled;
+			double m_entityUpdateTime;
 			float m_fixedUpdateRate;
 			float m_maxUpdateRate;
 			float m_updateCounter;
 			int m_updateOrder;
+			unsigned int m_nextEntityBucket;
+			Nz::UInt64 m_entityUpdateTick;
 
 			static SystemIndex s_nextIndex;
 	};
@@ -3,6 +3,10 @@
 // For conditions of distribution and use, see copyright notice in Prerequisites.hpp
 
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/Name.hpp>
+#include <Nazara/Core/Profiler.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Math/Algorithm.hpp>
 #include <type_traits>
 
 namespace Ndk
@@ -15,9 +19,16 @@ namespace Ndk
 
 	inline BaseSystem::BaseSystem(SystemIndex systemId) :
 	m_systemIndex(systemId),
+	m_profilerName(Nz::Name::Intern("System #" + Nz::String::Number(systemId)).GetString()),
 	m_world(nullptr),
+	m_componentAccessDeclared(false),
+	m_fixedStepEnabled(false),
+	m_parallelIterationEnabled(false),
 	m_updateEnabled(true),
-	m_updateOrder(0)
+	m_entityUpdateTime(0.0),
+	m_updateOrder(0),
+	m_nextEntityBucket(0),
+	m_entityUpdateTick(0)
 	{
 		SetFixedUpdateRate(0);
 		SetMaximumUpdateRate(30);
@@ -34,6 +45,36 @@ namespace Ndk
 		m_updateEnabled = enable;
 	}
 
+	/*!
+	* \brief Enables the update of the system by the fixed steps of its world
+	*
+	* Simulation systems (physics, movement, gameplay) should enable this while rendering systems shouldn't,
+	* this is only used when the world fixed update is enabled.
+	*
+	* \param enable Should the system be updated with fixed steps
+	*
+	* \see World::SetFixedUpdateRate
+	*/
+	inline void BaseSystem::EnableFixedStep(bool enable)
+	{
+		m_fixedStepEnabled = enable;
+	}
+
+	/*!
+	* \brief Enables the splitting of the system entities among TaskScheduler workers
+	*
+	* Only systems iterating their entities through ParallelForEachEntity are affected by this.
+	* This is disabled by default as the system must fulfill some requirements to be safely iterated in parallel.
+	*
+	* \param enable Should the system iterate its entities in parallel
+	*
+	* \see ParallelForEachEntity
+	*/
+	inline void BaseSystem::EnableParallelIteration(bool enable)
+	{
+		m_parallelIterationEnabled = enable;
+	}
+
 	/*!
 	* \brief Gets every entities that system handle
 	* \return A constant reference to the list of entities
@@ -44,6 +85,25 @@ namespace Ndk
 		return m_entities;
 	}
 
+	/*!
+	* \brief Gets the number of updates between two iterations over an entity by ForEachDueEntity
+	* \return Update interval of the entity, 1 if it is iterated every update
+	*
+	* \param entity Pointer to the entity
+	*
+	* \see SetEntityUpdateInterval
+	*/
+	inline unsigned int BaseSystem::GetEntityUpdateInterval(const Entity* entity) const
+	{
+		NazaraAssert(entity, "Invalid entity");
+
+		EntityId id = entity->GetId();
+		if (id >= m_entityUpdateBuckets.size())
+			return 1;
+
+		return std::max(m_entityUpdateBuckets[id].interval, 1U);
+	}
+
 	/*!
 	* \brief Gets the maximum rate of update of the system
 	* \return Update rate
@@ -93,6 +153,20 @@ namespace Ndk
 		return *m_world;
 	}
 
+	/*!
+	* \brief Checks whether or not the system declared which components it reads and writes
+	* \return true If Reads or Writes has been called by the system
+	*
+	* \remark A system which did not declare its component access is never updated concurrently with another system
+	*
+	* \see ConflictsWith
+	*/
+
+	inline bool BaseSystem::HasDeclaredComponentAccess() const
+	{
+		return m_componentAccessDeclared;
+	}
+
 	/*!
 	* \brief Checks whether or not the system is enabled
 	* \return true If it is the case
@@ -103,6 +177,29 @@ namespace Ndk
 		return m_updateEnabled;
 	}
 
+	/*!
+	* \brief Checks whether or not the system is updated by the fixed steps of its world
+	* \return true If it is the case
+	*
+	* \see EnableFixedStep
+	*/
+	inline bool BaseSystem::IsFixedStepEnabled() const
+	{
+		return m_fixedStepEnabled;
+	}
+
+	/*!
+	* \brief Checks whether or not the system iterates its entities in parallel
+	* \return true If it is the case
+	*
+	* \see EnableParallelIteration
+	*/
+
+	inline bool BaseSystem::IsParallelIterationEnabled() const
+	{
+		return m_parallelIterationEnabled;
+	}
+
 	/*!
 	* \brief Checks whether or not the system has the entity
 	* \return true If it is the case
@@ -148,6 +245,8 @@ namespace Ndk
 		if (!IsEnabled())
 			return;
 
+		Nz::Profiler::Scope profilerScope(m_profilerName);
+
 		m_updateCounter += elapsedTime;
 
 		if (m_maxUpdateRate > 0.f)
@@ -220,6 +319,52 @@ namespace Ndk
 		m_excludedComponents.UnboundedSet(index);
 	}
 
+	/*!
+	* \brief Calls a function for the entities of the system due this update
+	*
+	* Entities given an update interval N by SetEntityUpdateInterval are only iterated every Nth call, their buckets being assigned in a round-robin fashion
+	* so each call iterates about the same share of them. The time elapsed since the last iteration over an entity is accumulated and given back to the function.
+	* Other entities are iterated on every call, with elapsedTime.
+	*
+	* This is meant to be called once per OnUpdate, the iteration following the same rules than ParallelForEachEntity.
+	*
+	* \param elapsedTime Delta time of the update
+	* \param iterationFunc Function called as iterationFunc(const EntityHandle&, float entityElapsedTime) for every due entity
+	* \param blockGrainSize Number of bitset blocks per chunk, zero picks one according to the worker count
+	*
+	* \see ParallelForEachEntity
+	* \see SetEntityUpdateInterval
+	*/
+	template<typename F>
+	void BaseSystem::ForEachDueEntity(float elapsedTime, const F& iterationFunc, std::size_t blockGrainSize)
+	{
+		double currentTime = m_entityUpdateTime + elapsedTime;
+		Nz::UInt64 updateTick = m_entityUpdateTick;
+
+		// Every entity only touches its own bucket, which makes the iteration safe to split
+		ParallelForEachEntity(m_entities, [&](const EntityHandle& entity)
+		{
+			EntityId id = entity->GetId();
+			if (id >= m_entityUpdateBuckets.size() || m_entityUpdateBuckets[id].interval == 0)
+			{
+				iterationFunc(entity, elapsedTime);
+				return;
+			}
+
+			EntityUpdateBucket& updateBucket = m_entityUpdateBuckets[id];
+			if (updateTick % updateBucket.interval != updateBucket.bucket)
+				return;
+
+			float entityElapsedTime = static_cast<float>(currentTime - updateBucket.lastUpdateTime);
+			updateBucket.lastUpdateTime = currentTime;
+
+			iterationFunc(entity, entityElapsedTime);
+		}, blockGrainSize);
+
+		m_entityUpdateTime = currentTime;
+		m_entityUpdateTick++;
+	}
+
 	/*!
 	* \brief Gets the next index for the system
 	* \return Next unique index for the system
@@ -230,6 +375,89 @@ namespace Ndk
 		return s_nextIndex++;
 	}
 
+	/*!
+	* \brief Calls a function for every entity of a list, splitting the list among TaskScheduler workers
+	*
+	* The list is split in chunks of 64 entity ids (one block of its bitset), which are claimed by the calling thread and the workers.
+	* The iteration happens in the calling thread only if parallel iteration is disabled or if the system is already updated concurrently with other systems.
+	*
+	* As entities are processed at the same time, iterationFunc must follow these rules:
+	* - it may write components of the entity it received, and only read components of other entities
+	* - it must not write an entity NodeComponent if the node parent or children are processed too, as nodes update their relatives
+	* - it must not create or kill entities, nor add or remove components
+	* - it must synchronize any access to the system state
+	*
+	* \param entities List of entities to iterate, usually GetEntities() or a subset of it
+	* \param iterationFunc Function called as iterationFunc(const EntityHandle&) for every entity
+	* \param blockGrainSize Number of bitset blocks per chunk, zero picks one according to the worker count
+	*
+	* \see EnableParallelIteration
+	*/
+
+	template<typename F>
+	void BaseSystem::ParallelForEachEntity(const EntityList& entities, const F& iterationFunc, std::size_t blockGrainSize) const
+	{
+		const Nz::Bitset<Nz::UInt64>& entityBits = entities.m_entityBits;
+
+		auto processBlocks = [&](std::size_t firstBlock, std::size_t lastBlock)
+		{
+			for (std::size_t i = firstBlock; i < lastBlock; ++i)
+			{
+				Nz::UInt64 block = entityBits.GetBlock(i);
+				while (block)
+				{
+					std::size_t id = i * Nz::Bitset<Nz::UInt64>::bitsPerBlock + Nz::IntegralLog2Pot(block & -block);
+					iterationFunc(GetEntity(static_cast<EntityId>(id)));
+
+					block &= block - 1; //< Clear lowest enabled bit
+				}
+			}
+		};
+
+		std::size_t blockCount = entityBits.GetBlockCount();
+		if (CanIterateInParallel())
+			Nz::TaskScheduler::ParallelFor(0, blockCount, blockGrainSize, processBlocks);
+		else
+			processBlocks(0, blockCount);
+	}
+
+	/*!
+	* \brief Declares a component read by the system during its update
+	*
+	* \see World::EnableParallelUpdate
+	*/
+
+	template<typename ComponentType>
+	void BaseSystem::Reads()
+	{
+		static_assert(std::is_base_of<BaseComponent, ComponentType>::value, "ComponentType is not a component");
+
+		ReadsComponent(GetComponentIndex<ComponentType>());
+	}
+
+	/*!
+	* \brief Declares some components read by the system during its update
+	*/
+
+	template<typename ComponentType1, typename ComponentType2, typename... Rest>
+	void BaseSystem::Reads()
+	{
+		Reads<ComponentType1>();
+		Reads<ComponentType2, Rest...>();
+	}
+
+	/*!
+	* \brief Declares a component read by the system during its update by index
+	*
+	* \param index Index of the component
+	*/
+
+	inline void BaseSystem::ReadsComponent(ComponentIndex index)
+	{
+		m_readComponents.UnboundedSet(index);
+		m_componentAccessDeclared = true;
+	}
+
 	/*!
 	* \brief Requires some component from the system
 	*/
@@ -298,6 +526,69 @@ namespace Ndk
 		m_requiredAnyComponents.UnboundedSet(index);
 	}
 
+	/*!
+	* \brief Declares a component written by the system during its update
+	*
+	* \remark Components with lazily updated internal state (such as NodeComponent derived transformations) must be declared as written even if the system only reads them
+	*
+	* \see World::EnableParallelUpdate
+	*/
+
+	template<typename ComponentType>
+	void BaseSystem::Writes()
+	{
+		static_assert(std::is_base_of<BaseComponent, ComponentType>::value, "ComponentType is not a component");
+
+		WritesComponent(GetComponentIndex<ComponentType>());
+	}
+
+	/*!
+	* \brief Declares some components written by the system during its update
+	*/
+
+	template<typename ComponentType1, typename ComponentType2, typename... Rest>
+	void BaseSystem::Writes()
+	{
+		Writes<ComponentType1>();
+		Writes<ComponentType2, Rest...>();
+	}
+
+	/*!
+	* \brief Declares a component written by the system during its update by index
+	*
+	* \param index Index of the component
+	*/
+
+	inline void BaseSystem::WritesComponent(ComponentIndex index)
+	{
+		m_writtenComponents.UnboundedSet(index);
+		m_componentAccessDeclared = true;
+	}
+
+	/*!
+	* \brief Adds entities to the system at once
+	*
+	* \param entities Entities to add
+	*
+	* \remark Produces a NazaraAssert if an entity is invalid
+	*/
+
+	inline void BaseSystem::AddEntities(const std::vector<Entity*>& entities)
+	{
+		if (entities.empty())
+			return;
+
+		for (Entity* entity : entities)
+		{
+			NazaraAssert(entity, "Invalid entity");
+
+			m_entities.Insert(entity);
+			entity->RegisterSystem(m_systemIndex);
+		}
+
+		OnEntitiesAdded(entities);
+	}
+
 	/*!
 	* \brief Adds an entity to a system
 	*
@@ -316,6 +607,31 @@ namespace Ndk
 		OnEntityAdded(entity);
 	}
 
+	/*!
+	* \brief Removes entities from the system at once
+	*
+	* \param entities Entities to remove
+	*
+	* \remark Produces a NazaraAssert if an entity is invalid
+	*/
+
+	inline void BaseSystem::RemoveEntities(const std::vector<Entity*>& entities)
+	{
+		if (entities.empty())
+			return;
+
+		for (Entity* entity : entities)
+		{
+			NazaraAssert(entity, "Invalid entity");
+
+			m_entities.Remove(entity);
+			entity->UnregisterSystem(m_systemIndex);
+			ResetEntityUpdateInterval(entity);
+		}
+
+		OnEntitiesRemoved(entities);
+	}
+
 	/*!
 	* \brief Removes an entity to a system
 	*
@@ -330,10 +646,48 @@ namespace Ndk
 
 		m_entities.Remove(entity);
 		entity->UnregisterSystem(m_systemIndex);
+		ResetEntityUpdateInterval(entity);
 
 		OnEntityRemoved(entity); // And we alert our callback
 	}
 
+	/*!
+	* \brief Forgets the update interval of an entity, as its id may be reused
+	*
+	* \param entity Pointer to the entity
+	*/
+
+	inline void BaseSystem::ResetEntityUpdateInterval(const Entity* entity)
+	{
+		EntityId id = entity->GetId();
+		if (id < m_entityUpdateBuckets.size())
+			m_entityUpdateBuckets[id] = EntityUpdateBucket();
+	}
+
+	/*!
+	* \brief Validates entities of the system at once
+	*
+	* \param entities Entities to validate
+	* \param justAdded Are the entities newly added
+	*
+	* \remark Produces a NazaraAssert if an entity is invalid or if system does not hold it
+	*/
+
+	inline void BaseSystem::ValidateEntities(const std::vector<Entity*>& entities, bool justAdded)
+	{
+		if (entities.empty())
+			return;
+
+		for (Entity* entity : entities)
+		{
+			NazaraAssert(entity, "Invalid entity");
+			NazaraAssert(HasEntity(entity), "Entity should be part of system");
+			NazaraUnused(entity);
+		}
+
+		OnEntitiesValidation(entities, justAdded);
+	}
+
 	/*!
 	* \brief Validates an entity to a system
 	*
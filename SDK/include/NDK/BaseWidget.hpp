@@ -71,6 +71,9 @@ namespace Ndk
 
 			void Show(bool show = true);
 
+			static bool Initialize();
+			static void Uninitialize();
+
 			BaseWidget& operator=(const BaseWidget&) = delete;
 			BaseWidget& operator=(BaseWidget&&) = default;
 
@@ -87,6 +90,9 @@ namespace Ndk
 			void DestroyEntity(Entity* entity);
 			virtual void Layout();
 
+			static inline const Nz::MaterialRef& GetOpaqueMaterial();
+			static inline const Nz::MaterialRef& GetTranslucentMaterial();
+
 			void InvalidateNode() override;
 
 			virtual bool IsFocusable() const;
@@ -99,6 +105,7 @@ namespace Ndk
 			virtual void OnMouseButtonPress(int x, int y, Nz::Mouse::Button button);
 			virtual void OnMouseButtonRelease(int x, int y, Nz::Mouse::Button button);
 			virtual void OnMouseExit();
+			virtual void OnMouseWheelMoved(float delta);
 			virtual void OnParentResized(const Nz::Vector2f& newSize);
 			virtual void OnTextEntered(char32_t character, bool repeated);
 
@@ -135,6 +142,9 @@ namespace Ndk
 			Nz::Vector2f m_contentSize;
 			BaseWidget* m_widgetParent;
 			bool m_visible;
+
+			static Nz::MaterialRef s_opaqueMaterial;
+			static Nz::MaterialRef s_translucentMaterial;
 	};
 }
 
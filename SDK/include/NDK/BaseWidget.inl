@@ -122,6 +122,28 @@ namespace Ndk
 		Layout();
 	}
 
+	/*!
+	* \brief Gets the material shared by the opaque sprites of the widgets
+	* \return Basic2D material
+	*
+	* Sprites sharing a material are batched together by the render queue, a sprite needing a texture gets its own copy of the material (see Sprite::SetTexture)
+	*/
+	inline const Nz::MaterialRef& BaseWidget::GetOpaqueMaterial()
+	{
+		return s_opaqueMaterial;
+	}
+
+	/*!
+	* \brief Gets the material shared by the translucent sprites of the widgets
+	* \return Translucent2D material
+	*
+	* \see GetOpaqueMaterial
+	*/
+	inline const Nz::MaterialRef& BaseWidget::GetTranslucentMaterial()
+	{
+		return s_translucentMaterial;
+	}
+
 	inline bool BaseWidget::IsRegisteredToCanvas() const
 	{
 		return m_canvas && m_canvasIndex != InvalidCanvasIndex;
@@ -24,6 +24,8 @@ namespace Ndk
 
 			template<unsigned int N>
 			static ComponentIndex RegisterComponent(const char (&name)[N]);
+
+			static void RegisterSerializer();
 	};
 }
 
@@ -2,6 +2,7 @@
 // This file is part of the "Nazara Development Kit"
 // For conditions of distribution and use, see copyright notice in Prerequisites.hpp
 
+#include <Nazara/Core/Algorithm.hpp>
 #include <NDK/Algorithm.hpp>
 #include <type_traits>
 
@@ -73,4 +74,36 @@ namespace Ndk
 		ComponentId id = BuildComponentId(name);
 		return RegisterComponent(id);
 	}
+
+	/*!
+	* \brief Registers the serialization functions of the component, allowing it to be saved in world snapshots
+	*
+	* The component is written by a Serialize(Nz::SerializationContext&, const ComponentType&, Nz::TypeTag<ComponentType>) function and
+	* read back into an existing (or default-constructed) component by an Unserialize(Nz::SerializationContext&, ComponentType*, Nz::TypeTag<ComponentType>) function, both found by argument dependent lookup.
+	*
+	* \remark The component must have been registered before
+	*
+	* \see World::SaveSnapshot
+	*/
+
+	template<typename ComponentType>
+	void Component<ComponentType>::RegisterSerializer()
+	{
+		auto factory = []() -> BaseComponent*
+		{
+			return new ComponentType;
+		};
+
+		auto serializer = [](Nz::SerializationContext& context, const BaseComponent& component) -> bool
+		{
+			return Nz::Serialize(context, static_cast<const ComponentType&>(component));
+		};
+
+		auto unserializer = [](Nz::SerializationContext& context, BaseComponent& component) -> bool
+		{
+			return Nz::Unserialize(context, static_cast<ComponentType*>(&component));
+		};
+
+		BaseComponent::RegisterSerializer(GetComponentIndex<ComponentType>(), factory, serializer, unserializer);
+	}
 }
@@ -0,0 +1,59 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequisites.hpp
+
+#pragma once
+
+#ifndef NDK_COMPONENTSET_HPP
+#define NDK_COMPONENTSET_HPP
+
+#include <NDK/Prerequisites.hpp>
+#include <Nazara/Core/LargePageAllocator.hpp>
+#include <limits>
+#include <vector>
+
+namespace Ndk
+{
+	class BaseComponent;
+
+	class ComponentSet
+	{
+		public:
+			inline ComponentSet(bool largePages = false);
+			ComponentSet(const ComponentSet&) = delete;
+			ComponentSet(ComponentSet&&) = default;
+			~ComponentSet() = default;
+
+			inline void Clear();
+
+			inline void EnableLargePages(bool enable = true);
+
+			inline BaseComponent* Find(EntityId id) const;
+
+			inline BaseComponent* GetComponent(std::size_t index) const;
+			inline EntityId GetEntityId(std::size_t index) const;
+			inline std::size_t GetSize() const;
+
+			inline void Insert(EntityId id, BaseComponent* component);
+
+			inline bool IsUsingLargePages() const;
+
+			inline void Remove(EntityId id);
+
+			ComponentSet& operator=(const ComponentSet&) = delete;
+			ComponentSet& operator=(ComponentSet&&) = default;
+
+		private:
+			static constexpr std::size_t InvalidIndex = std::numeric_limits<std::size_t>::max();
+
+			template<typename T> using Vector = std::vector<T, Nz::LargePageAllocator<T>>;
+
+			Vector<BaseComponent*> m_components;
+			Vector<EntityId> m_entities;
+			Vector<std::size_t> m_sparse;
+	};
+}
+
+#include <NDK/ComponentSet.inl>
+
+#endif // NDK_COMPONENTSET_HPP
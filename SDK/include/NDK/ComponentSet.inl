@@ -0,0 +1,174 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequisites.hpp
+
+#include <Nazara/Core/Error.hpp>
+
+namespace Ndk
+{
+	/*!
+	* \ingroup NDK
+	* \class Ndk::ComponentSet
+	* \brief NDK class that stores every component of one type of a world, packed along with their entity id
+	*
+	* Components are stored in a dense array (allowing linear iteration) and indexed by entity id through a sparse array
+	*
+	* \remark Components are not owned by the set, they stay owned by their entities
+	*/
+
+	/*!
+	* \brief Constructs a ComponentSet object
+	*
+	* \param largePages Should the arrays be allocated in large pages (see Nz::LargePageMemory)
+	*/
+	inline ComponentSet::ComponentSet(bool largePages) :
+	m_components(Nz::LargePageAllocator<BaseComponent*>(largePages)),
+	m_entities(Nz::LargePageAllocator<EntityId>(largePages)),
+	m_sparse(Nz::LargePageAllocator<std::size_t>(largePages))
+	{
+	}
+
+	/*!
+	* \brief Removes every component from the set
+	*/
+	inline void ComponentSet::Clear()
+	{
+		m_components.clear();
+		m_entities.clear();
+		m_sparse.clear();
+	}
+
+	/*!
+	* \brief Enables/Disables large pages for the arrays of the set
+	*
+	* Worth it for sets of hundreds of thousands of components, smaller arrays stay in regular memory anyway
+	*
+	* \param enable Should the arrays be allocated in large pages
+	*
+	* \remark The arrays are moved to their new memory right away
+	*/
+	inline void ComponentSet::EnableLargePages(bool enable)
+	{
+		if (IsUsingLargePages() == enable)
+			return;
+
+		// Allocators are propagated by move assignment, the arrays are copied into memory of the new allocator first
+		m_components = Vector<BaseComponent*>(m_components.begin(), m_components.end(), Nz::LargePageAllocator<BaseComponent*>(enable));
+		m_entities = Vector<EntityId>(m_entities.begin(), m_entities.end(), Nz::LargePageAllocator<EntityId>(enable));
+		m_sparse = Vector<std::size_t>(m_sparse.begin(), m_sparse.end(), Nz::LargePageAllocator<std::size_t>(enable));
+	}
+
+	/*!
+	* \brief Finds the component of an entity
+	* \return Pointer to the entity component or nullptr if the entity is not part of the set
+	*
+	* \param id Identifier of the entity
+	*/
+	inline BaseComponent* ComponentSet::Find(EntityId id) const
+	{
+		if (id >= m_sparse.size() || m_sparse[id] == InvalidIndex)
+			return nullptr;
+
+		return m_components[m_sparse[id]];
+	}
+
+	/*!
+	* \brief Gets a component by its dense index
+	* \return Pointer to the component
+	*
+	* \param index Dense index of the component, must be lower than GetSize()
+	*/
+	inline BaseComponent* ComponentSet::GetComponent(std::size_t index) const
+	{
+		NazaraAssert(index < m_components.size(), "Index out of range");
+
+		return m_components[index];
+	}
+
+	/*!
+	* \brief Gets the entity identifier associated with a dense index
+	* \return Identifier of the entity owning the component at this index
+	*
+	* \param index Dense index of the component, must be lower than GetSize()
+	*/
+	inline EntityId ComponentSet::GetEntityId(std::size_t index) const
+	{
+		NazaraAssert(index < m_entities.size(), "Index out of range");
+
+		return m_entities[index];
+	}
+
+	/*!
+	* \brief Gets the number of components in the set
+	* \return Component count
+	*/
+	inline std::size_t ComponentSet::GetSize() const
+	{
+		return m_components.size();
+	}
+
+	/*!
+	* \brief Inserts (or replaces) the component of an entity
+	*
+	* \param id Identifier of the entity
+	* \param component Component of the entity
+	*/
+	inline void ComponentSet::Insert(EntityId id, BaseComponent* component)
+	{
+		NazaraAssert(component, "Invalid component");
+
+		if (id >= m_sparse.size())
+			m_sparse.resize(id + 1, std::size_t(InvalidIndex)); //< Copy the constant as resize takes it by reference
+
+		std::size_t& denseIndex = m_sparse[id];
+		if (denseIndex == InvalidIndex)
+		{
+			denseIndex = m_components.size();
+
+			m_components.push_back(component);
+			m_entities.push_back(id);
+		}
+		else
+			m_components[denseIndex] = component;
+	}
+
+	/*!
+	* \brief Checks whether the arrays of the set are allocated in large pages
+	* \return true if large pages are enabled
+	*
+	* \see EnableLargePages
+	*/
+	inline bool ComponentSet::IsUsingLargePages() const
+	{
+		return m_components.get_allocator().IsLargePagesEnabled();
+	}
+
+	/*!
+	* \brief Removes the component of an entity
+	*
+	* \param id Identifier of the entity
+	*
+	* \remark The last component of the set takes the place of the removed one
+	* \remark If the entity is not part of the set, nothing is done
+	*/
+	inline void ComponentSet::Remove(EntityId id)
+	{
+		if (id >= m_sparse.size() || m_sparse[id] == InvalidIndex)
+			return;
+
+		std::size_t denseIndex = m_sparse[id];
+		std::size_t lastIndex = m_components.size() - 1;
+		if (denseIndex != lastIndex)
+		{
+			m_components[denseIndex] = m_components[lastIndex];
+			m_entities[denseIndex] = m_entities[lastIndex];
+
+			m_sparse[m_entities[denseIndex]] = denseIndex;
+		}
+
+		m_components.pop_back();
+		m_entities.pop_back();
+
+		m_sparse[id] = InvalidIndex;
+	}
+}
@@ -0,0 +1,46 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequisites.hpp
+
+#pragma once
+
+#ifndef NDK_COMPONENTVIEW_HPP
+#define NDK_COMPONENTVIEW_HPP
+
+#include <NDK/ComponentSet.hpp>
+#include <array>
+#include <utility>
+
+namespace Ndk
+{
+	template<typename... ComponentTypes>
+	class ComponentView
+	{
+		static_assert(sizeof...(ComponentTypes) > 0, "A view requires at least one component type");
+
+		public:
+			using SetArray = std::array<const ComponentSet*, sizeof...(ComponentTypes)>;
+
+			inline ComponentView(const SetArray& sets);
+			ComponentView(const ComponentView&) = default;
+			ComponentView(ComponentView&&) = default;
+			~ComponentView() = default;
+
+			template<typename F> void ForEach(const F& iterationFunc) const;
+
+			inline std::size_t GetMaxSize() const;
+
+			ComponentView& operator=(const ComponentView&) = default;
+			ComponentView& operator=(ComponentView&&) = default;
+
+		private:
+			template<typename F, std::size_t... Indices> void ForEach(const F& iterationFunc, std::index_sequence<Indices...>) const;
+
+			SetArray m_sets;
+			std::size_t m_smallestSet;
+	};
+}
+
+#include <NDK/ComponentView.inl>
+
+#endif // NDK_COMPONENTVIEW_HPP
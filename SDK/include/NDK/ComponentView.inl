@@ -0,0 +1,93 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequisites.hpp
+
+#include <Nazara/Core/Error.hpp>
+
+namespace Ndk
+{
+	/*!
+	* \ingroup NDK
+	* \class Ndk::ComponentView<ComponentTypes...>
+	* \brief NDK class that iterates linearly over every entity owning all the component types of the view
+	*
+	* \remark A view is only valid until the next entity or component addition/removal of its world
+	*
+	* \see World::View
+	*/
+
+	/*!
+	* \brief Constructs a ComponentView object from the component sets of a world
+	*
+	* \param sets Component sets, in the same order as ComponentTypes
+	*/
+	template<typename... ComponentTypes>
+	ComponentView<ComponentTypes...>::ComponentView(const SetArray& sets) :
+	m_sets(sets),
+	m_smallestSet(0)
+	{
+		// Iterating over the smallest set minimizes the number of lookups in the others
+		for (std::size_t i = 0; i < m_sets.size(); ++i)
+		{
+			NazaraAssert(m_sets[i], "Invalid component set");
+
+			if (m_sets[i]->GetSize() < m_sets[m_smallestSet]->GetSize())
+				m_smallestSet = i;
+		}
+	}
+
+	/*!
+	* \brief Executes a function on every entity owning all component types of the view
+	*
+	* Calls iterationFunc(EntityId, ComponentTypes&...) for every matching entity, in the storage order of the smallest set
+	*
+	* \param iterationFunc Function to be called
+	*
+	* \remark Entities must not get or lose components while iterating
+	*/
+	template<typename... ComponentTypes>
+	template<typename F>
+	void ComponentView<ComponentTypes...>::ForEach(const F& iterationFunc) const
+	{
+		ForEach(iterationFunc, std::index_sequence_for<ComponentTypes...>());
+	}
+
+	/*!
+	* \brief Gets the maximum number of entities the view can iterate over
+	* \return Size of the smallest component set of the view
+	*/
+	template<typename... ComponentTypes>
+	std::size_t ComponentView<ComponentTypes...>::GetMaxSize() const
+	{
+		return m_sets[m_smallestSet]->GetSize();
+	}
+
+	template<typename... ComponentTypes>
+	template<typename F, std::size_t... Indices>
+	void ComponentView<ComponentTypes...>::ForEach(const F& iterationFunc, std::index_sequence<Indices...>) const
+	{
+		const ComponentSet& smallestSet = *m_sets[m_smallestSet];
+
+		std::size_t count = smallestSet.GetSize();
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			EntityId id = smallestSet.GetEntityId(i);
+
+			std::array<BaseComponent*, sizeof...(ComponentTypes)> components;
+
+			bool hasAll = true;
+			for (std::size_t j = 0; j < components.size(); ++j)
+			{
+				components[j] = (j == m_smallestSet) ? smallestSet.GetComponent(i) : m_sets[j]->Find(id);
+				if (!components[j])
+				{
+					hasAll = false;
+					break;
+				}
+			}
+
+			if (hasAll)
+				iterationFunc(id, static_cast<ComponentTypes&>(*components[Indices])...);
+		}
+	}
+}
@@ -18,6 +18,8 @@
 #include <NDK/Components/ParticleGroupComponent.hpp>
 #include <NDK/Components/PhysicsComponent2D.hpp>
 #include <NDK/Components/PhysicsComponent3D.hpp>
+#include <NDK/Components/ReflectionProbeComponent.hpp>
+#include <NDK/Components/SoundEmitterComponent.hpp>
 #include <NDK/Components/VelocityComponent.hpp>
 
 #endif // NDK_COMPONENTS_GLOBAL_HPP
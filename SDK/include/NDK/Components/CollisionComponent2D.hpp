@@ -9,6 +9,7 @@
 
 #include <Nazara/Physics2D/Collider2D.hpp>
 #include <Nazara/Physics2D/RigidBody2D.hpp>
+#include <Nazara/Utility/Node.hpp>
 #include <NDK/Component.hpp>
 #include <memory>
 
@@ -42,6 +43,9 @@ namespace Ndk
 			void OnComponentAttached(BaseComponent& component) override;
 			void OnComponentDetached(BaseComponent& component) override;
 			void OnDetached() override;
+			void OnNodeInvalidated(const Nz::Node* node);
+
+			NazaraSlot(Nz::Node, OnNodeInvalidation, m_nodeInvalidationSlot);
 
 			std::unique_ptr<Nz::RigidBody2D> m_staticBody;
 			Nz::Collider2DRef m_geom;
@@ -9,6 +9,7 @@
 
 #include <Nazara/Physics3D/Collider3D.hpp>
 #include <Nazara/Physics3D/RigidBody3D.hpp>
+#include <Nazara/Utility/Node.hpp>
 #include <NDK/Component.hpp>
 #include <memory>
 
@@ -42,6 +43,9 @@ namespace Ndk
 			void OnDetached() override;
 			void OnEntityDisabled() override;
 			void OnEntityEnabled() override;
+			void OnNodeInvalidated(const Nz::Node* node);
+
+			NazaraSlot(Nz::Node, OnNodeInvalidation, m_nodeInvalidationSlot);
 
 			std::unique_ptr<Nz::RigidBody3D> m_staticBody;
 			Nz::Collider3DRef m_geom;
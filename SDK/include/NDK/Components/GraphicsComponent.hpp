@@ -8,6 +8,7 @@
 #ifndef NDK_COMPONENTS_GRAPHICSCOMPONENT_HPP
 #define NDK_COMPONENTS_GRAPHICSCOMPONENT_HPP
 
+#include <Nazara/Graphics/AbstractViewer.hpp>
 #include <Nazara/Graphics/CullingList.hpp>
 #include <Nazara/Graphics/InstancedRenderable.hpp>
 #include <Nazara/Utility/Node.hpp>
@@ -56,6 +57,7 @@ namespace Ndk
 
 			inline void SetScissorRect(const Nz::Recti& scissorRect);
 
+			bool UpdateLevelsOfDetail(const Nz::AbstractViewer& viewer, Nz::ResidencyManager* residencyManager = nullptr) const;
 			inline void UpdateLocalMatrix(const Nz::InstancedRenderable* instancedRenderable, const Nz::Matrix4f& localMatrix);
 			inline void UpdateRenderOrder(const Nz::InstancedRenderable* instancedRenderable, int renderOrder);
 
@@ -64,6 +66,7 @@ namespace Ndk
 		private:
 			struct Renderable;
 
+			Nz::BoundingVolumef ComputeLocalBoundingVolume() const;
 			void ConnectInstancedRenderableSignals(Renderable& renderable);
 
 			inline void InvalidateBoundingVolume() const;
@@ -85,6 +88,8 @@ namespace Ndk
 			void OnMaterialReflectionChange(const Nz::Material* material, Nz::ReflectionMode reflectionMode);
 			void OnNodeInvalidated(const Nz::Node* node);
 
+			void SetBoundingVolume(const Nz::BoundingVolumef& boundingVolume) const;
+
 			void UnregisterMaterial(Nz::Material* material);
 
 			void UpdateBoundingVolume() const;
@@ -183,6 +183,10 @@ namespace Ndk
 
 	inline void GraphicsComponent::SetScissorRect(const Nz::Recti& scissorRect)
 	{
+		// Widgets set their scissor rect on every layout, invalidating render queues for nothing would regenerate their data every time
+		if (m_scissorRect == scissorRect)
+			return;
+
 		m_scissorRect = scissorRect;
 
 		for (VolumeCullingEntry& entry : m_volumeCullingEntries)
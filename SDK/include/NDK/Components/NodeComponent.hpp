@@ -19,15 +19,34 @@ namespace Ndk
 
 	class NDK_API NodeComponent : public Component<NodeComponent>, public Nz::Node, public Nz::HandledObject<NodeComponent>
 	{
+		friend class World;
+
 		public:
 			NodeComponent() = default;
 			~NodeComponent() = default;
 
+			inline void EnableInterpolation(bool enable = true);
+
+			Nz::Matrix4f GetInterpolatedTransformMatrix(float interpolation) const;
+
+			inline bool IsInterpolationEnabled() const;
+
 			void SetParent(Entity* entity, bool keepDerived = false);
 			using Nz::Node::SetParent;
 
 			static ComponentIndex componentIndex;
+
+		private:
+			inline void SaveState();
+
+			Nz::Quaternionf m_previousRotation;
+			Nz::Vector3f m_previousPosition;
+			Nz::Vector3f m_previousScale;
+			bool m_interpolationEnabled = false;
 	};
+
+	NDK_API bool Serialize(Nz::SerializationContext& context, const NodeComponent& node, Nz::TypeTag<NodeComponent>);
+	NDK_API bool Unserialize(Nz::SerializationContext& context, NodeComponent* node, Nz::TypeTag<NodeComponent>);
 }
 
 #include <NDK/Components/NodeComponent.inl>
@@ -7,6 +7,36 @@
 
 namespace Ndk
 {
+	/*!
+	* \brief Enables the interpolation of the node between the fixed updates of its world
+	*
+	* An interpolated node saves its global transformation before each fixed update of its world,
+	* the graphics component then renders it between the saved and the current transformations.
+	*
+	* \param enable Should the node be interpolated
+	*
+	* \remark This has no effect if the fixed update of the world is disabled
+	*
+	* \see World::SetFixedUpdateRate
+	*/
+	inline void NodeComponent::EnableInterpolation(bool enable)
+	{
+		m_interpolationEnabled = enable;
+		if (m_interpolationEnabled)
+			SaveState(); //< Prevents interpolating from an outdated state
+	}
+
+	/*!
+	* \brief Checks whether or not the node is interpolated between the fixed updates of its world
+	* \return true If it is the case
+	*
+	* \see EnableInterpolation
+	*/
+	inline bool NodeComponent::IsInterpolationEnabled() const
+	{
+		return m_interpolationEnabled;
+	}
+
 	/*!
 	* \brief Sets the parent node of the entity
 	*
@@ -27,4 +57,11 @@ namespace Ndk
 		else
 			Nz::Node::SetParent(nullptr, keepDerived);
 	}
+
+	inline void NodeComponent::SaveState()
+	{
+		m_previousPosition = GetPosition(Nz::CoordSys_Global);
+		m_previousRotation = GetRotation(Nz::CoordSys_Global);
+		m_previousScale = GetScale(Nz::CoordSys_Global);
+	}
 }
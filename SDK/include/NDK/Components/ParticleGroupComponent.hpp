@@ -20,8 +20,8 @@ namespace Ndk
 	class NDK_API ParticleGroupComponent : public Component<ParticleGroupComponent>, public Nz::ParticleGroup, public Nz::HandledObject<ParticleGroupComponent>
 	{
 		public:
-			inline ParticleGroupComponent(unsigned int maxParticleCount, Nz::ParticleLayout layout);
-			inline ParticleGroupComponent(unsigned int maxParticleCount, Nz::ParticleDeclarationConstRef declaration);
+			inline ParticleGroupComponent(unsigned int maxParticleCount, Nz::ParticleLayout layout, Nz::ParticleStorage storage = Nz::ParticleStorage_Interleaved);
+			inline ParticleGroupComponent(unsigned int maxParticleCount, Nz::ParticleDeclarationConstRef declaration, Nz::ParticleStorage storage = Nz::ParticleStorage_Interleaved);
 			ParticleGroupComponent(const ParticleGroupComponent&) = default;
 			~ParticleGroupComponent() = default;
 
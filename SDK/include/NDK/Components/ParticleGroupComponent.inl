@@ -18,10 +18,11 @@ namespace Ndk
 	*
 	* \param maxParticleCount Maximum number of particles to generate
 	* \param layout Enumeration for the layout of data information for the particles
+	* \param storage Layout of the particles in memory
 	*/
 
-	inline ParticleGroupComponent::ParticleGroupComponent(unsigned int maxParticleCount, Nz::ParticleLayout layout) :
-	ParticleGroup(maxParticleCount, layout)
+	inline ParticleGroupComponent::ParticleGroupComponent(unsigned int maxParticleCount, Nz::ParticleLayout layout, Nz::ParticleStorage storage) :
+	ParticleGroup(maxParticleCount, layout, storage)
 	{
 	}
 
@@ -30,10 +31,11 @@ namespace Ndk
 	*
 	* \param maxParticleCount Maximum number of particles to generate
 	* \param declaration Data information for the particles
+	* \param storage Layout of the particles in memory
 	*/
 
-	inline ParticleGroupComponent::ParticleGroupComponent(unsigned int maxParticleCount, Nz::ParticleDeclarationConstRef declaration) :
-	ParticleGroup(maxParticleCount, std::move(declaration))
+	inline ParticleGroupComponent::ParticleGroupComponent(unsigned int maxParticleCount, Nz::ParticleDeclarationConstRef declaration, Nz::ParticleStorage storage) :
+	ParticleGroup(maxParticleCount, std::move(declaration), storage)
 	{
 	}
 
@@ -0,0 +1,67 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequisites.hpp
+
+#pragma once
+
+#ifndef NDK_SERVER
+#ifndef NDK_COMPONENTS_REFLECTIONPROBECOMPONENT_HPP
+#define NDK_COMPONENTS_REFLECTIONPROBECOMPONENT_HPP
+
+#include <Nazara/Core/String.hpp>
+#include <Nazara/Renderer/Texture.hpp>
+#include <NDK/Component.hpp>
+
+namespace Ndk
+{
+	class NDK_API ReflectionProbeComponent : public Component<ReflectionProbeComponent>
+	{
+		friend class RenderSystem;
+
+		public:
+			inline ReflectionProbeComponent(float radius = 10.f, unsigned int size = 128);
+			inline ReflectionProbeComponent(const ReflectionProbeComponent& probe);
+			~ReflectionProbeComponent() = default;
+
+			inline void EnableRealTimeUpdate(bool enable = true);
+
+			inline const Nz::String& GetCacheFile() const;
+			inline float GetDrawDistance() const;
+			inline float GetRadius() const;
+			inline unsigned int GetSize() const;
+			inline const Nz::TextureRef& GetTexture() const;
+
+			inline void Invalidate();
+
+			inline bool IsReady() const;
+			inline bool IsRealTimeUpdateEnabled() const;
+
+			inline void SetCacheFile(Nz::String filePath);
+			inline void SetDrawDistance(float distance);
+			inline void SetRadius(float radius);
+			inline void SetSize(unsigned int size);
+
+			static ComponentIndex componentIndex;
+
+		private:
+			bool EnsureTexture();
+			bool LoadCache();
+			bool SaveCache();
+
+			Nz::String m_cacheFile;
+			Nz::TextureRef m_texture;
+			bool m_cacheOutdated;
+			bool m_ready;
+			bool m_realTimeUpdate;
+			bool m_upToDate;
+			float m_drawDistance;
+			float m_radius;
+			unsigned int m_nextFace;
+			unsigned int m_size;
+	};
+}
+
+#include <NDK/Components/ReflectionProbeComponent.inl>
+
+#endif // NDK_COMPONENTS_REFLECTIONPROBECOMPONENT_HPP
+#endif // NDK_SERVER
@@ -0,0 +1,216 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequisites.hpp
+
+#include <Nazara/Core/Error.hpp>
+
+namespace Ndk
+{
+	/*!
+	* \brief Constructs a ReflectionProbeComponent object
+	*
+	* \param radius Distance up to which objects reflect this probe
+	* \param size Size of the faces of the cubemap
+	*/
+
+	inline ReflectionProbeComponent::ReflectionProbeComponent(float radius, unsigned int size) :
+	m_cacheOutdated(false),
+	m_ready(false),
+	m_realTimeUpdate(false),
+	m_upToDate(false),
+	m_drawDistance(100.f),
+	m_radius(radius),
+	m_nextFace(0),
+	m_size(size)
+	{
+		NazaraAssert(radius > 0.f, "Radius must be positive");
+		NazaraAssert(size > 0, "Size must be positive");
+	}
+
+	/*!
+	* \brief Constructs a ReflectionProbeComponent object by copy of another one
+	*
+	* Only the parameters are copied, the new probe is drawn on its own
+	*
+	* \param probe ReflectionProbeComponent to copy
+	*/
+
+	inline ReflectionProbeComponent::ReflectionProbeComponent(const ReflectionProbeComponent& probe) :
+	Component(probe),
+	m_cacheFile(probe.m_cacheFile),
+	m_cacheOutdated(probe.m_cacheOutdated),
+	m_ready(false),
+	m_realTimeUpdate(probe.m_realTimeUpdate),
+	m_upToDate(false),
+	m_drawDistance(probe.m_drawDistance),
+	m_radius(probe.m_radius),
+	m_nextFace(0),
+	m_size(probe.m_size)
+	{
+	}
+
+	/*!
+	* \brief Enables or disables the real-time update of the probe
+	*
+	* Real-time probes are drawn again and again, a few faces per frame (see RenderSystem::SetReflectionFaceBudget).
+	* Other probes are only drawn once, or loaded from their cache file.
+	*
+	* \param enable Should the probe be updated in real-time
+	*/
+
+	inline void ReflectionProbeComponent::EnableRealTimeUpdate(bool enable)
+	{
+		m_realTimeUpdate = enable;
+	}
+
+	/*!
+	* \brief Gets the file the probe is loaded from and saved to, when it isn't updated in real-time
+	* \return Path to the cache file, empty if the probe isn't cached
+	*/
+
+	inline const Nz::String& ReflectionProbeComponent::GetCacheFile() const
+	{
+		return m_cacheFile;
+	}
+
+	/*!
+	* \brief Gets the distance up to which the scene is drawn into the probe
+	* \return Draw distance
+	*/
+
+	inline float ReflectionProbeComponent::GetDrawDistance() const
+	{
+		return m_drawDistance;
+	}
+
+	/*!
+	* \brief Gets the distance up to which objects reflect this probe
+	* \return Radius of the probe
+	*/
+
+	inline float ReflectionProbeComponent::GetRadius() const
+	{
+		return m_radius;
+	}
+
+	/*!
+	* \brief Gets the size of the faces of the cubemap
+	* \return Size of the faces
+	*/
+
+	inline unsigned int ReflectionProbeComponent::GetSize() const
+	{
+		return m_size;
+	}
+
+	/*!
+	* \brief Gets the cubemap of the probe
+	* \return Reference to the cubemap, invalid until the probe is drawn for the first time
+	*/
+
+	inline const Nz::TextureRef& ReflectionProbeComponent::GetTexture() const
+	{
+		return m_texture;
+	}
+
+	/*!
+	* \brief Asks for the probe to be drawn again, as the scene around it changed
+	*
+	* The cache file is overwritten once the probe is drawn, the previous cubemap being reflected until then
+	*/
+
+	inline void ReflectionProbeComponent::Invalidate()
+	{
+		m_cacheOutdated = true;
+		m_nextFace = 0;
+		m_upToDate = false;
+	}
+
+	/*!
+	* \brief Checks whether the cubemap of the probe can be reflected, every face of it having been drawn at least once
+	* \return true If it is the case
+	*/
+
+	inline bool ReflectionProbeComponent::IsReady() const
+	{
+		return m_ready;
+	}
+
+	/*!
+	* \brief Checks whether the probe is updated in real-time
+	* \return true If it is the case
+	*/
+
+	inline bool ReflectionProbeComponent::IsRealTimeUpdateEnabled() const
+	{
+		return m_realTimeUpdate;
+	}
+
+	/*!
+	* \brief Sets the file the probe is loaded from and saved to, when it isn't updated in real-time
+	*
+	* The cubemap is stored as a vertical strip of its faces, in the order of Nz::CubemapFace.
+	*
+	* \param filePath Path to the cache file, empty to disable caching
+	*/
+
+	inline void ReflectionProbeComponent::SetCacheFile(Nz::String filePath)
+	{
+		m_cacheFile = std::move(filePath);
+	}
+
+	/*!
+	* \brief Sets the distance up to which the scene is drawn into the probe
+	*
+	* \param distance Draw distance
+	*
+	* \remark Produces a NazaraAssert if distance is not positive
+	*/
+
+	inline void ReflectionProbeComponent::SetDrawDistance(float distance)
+	{
+		NazaraAssert(distance > 0.f, "Draw distance must be positive");
+
+		m_drawDistance = distance;
+	}
+
+	/*!
+	* \brief Sets the distance up to which objects reflect this probe
+	*
+	* Objects within the radius of multiple probes reflect the closest one
+	*
+	* \param radius Radius of the probe
+	*
+	* \remark Produces a NazaraAssert if radius is not positive
+	*/
+
+	inline void ReflectionProbeComponent::SetRadius(float radius)
+	{
+		NazaraAssert(radius > 0.f, "Radius must be positive");
+
+		m_radius = radius;
+	}
+
+	/*!
+	* \brief Sets the size of the faces of the cubemap, which is drawn again
+	*
+	* \param size Size of the faces
+	*
+	* \remark Produces a NazaraAssert if size is zero
+	*/
+
+	inline void ReflectionProbeComponent::SetSize(unsigned int size)
+	{
+		NazaraAssert(size > 0, "Size must be positive");
+
+		if (m_size == size)
+			return;
+
+		m_size = size;
+		m_texture.Reset();
+
+		m_nextFace = 0;
+		m_ready = false;
+		m_upToDate = false;
+	}
+}
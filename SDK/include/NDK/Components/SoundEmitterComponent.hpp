@@ -0,0 +1,49 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequisites.hpp
+
+#pragma once
+
+#ifndef NDK_SERVER
+#ifndef NDK_COMPONENTS_SOUNDEMITTERCOMPONENT_HPP
+#define NDK_COMPONENTS_SOUNDEMITTERCOMPONENT_HPP
+
+#include <Nazara/Audio/Sound.hpp>
+#include <NDK/Component.hpp>
+#include <limits>
+
+namespace Ndk
+{
+	class SoundEmitterComponent;
+
+	using SoundEmitterComponentHandle = Nz::ObjectHandle<SoundEmitterComponent>;
+
+	class NDK_API SoundEmitterComponent : public Component<SoundEmitterComponent>, public Nz::Sound, public Nz::HandledObject<SoundEmitterComponent>
+	{
+		friend class ListenerSystem;
+
+		public:
+			inline SoundEmitterComponent();
+			inline SoundEmitterComponent(const Nz::SoundBuffer* soundBuffer);
+			inline SoundEmitterComponent(const SoundEmitterComponent& component);
+			~SoundEmitterComponent() = default;
+
+			inline float GetAudibleDistance() const;
+
+			inline bool IsCulled() const;
+
+			inline void SetAudibleDistance(float audibleDistance);
+
+			static ComponentIndex componentIndex;
+
+		private:
+			Nz::Vector3f m_lastPosition;
+			float m_audibleDistance;
+			bool m_isCulled;
+	};
+}
+
+#include <NDK/Components/SoundEmitterComponent.inl>
+
+#endif // NDK_COMPONENTS_SOUNDEMITTERCOMPONENT_HPP
+#endif // NDK_SERVER
@@ -0,0 +1,86 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequisites.hpp
+
+#include <Nazara/Core/Error.hpp>
+
+namespace Ndk
+{
+	/*!
+	* \ingroup NDK
+	* \class Ndk::SoundEmitterComponent
+	* \brief NDK class that represents a sound played at the position of its entity
+	*
+	* The position and the velocity of the sound are updated by the ListenerSystem, along with every other emitter of the world
+	*/
+
+	/*!
+	* \brief Constructs a SoundEmitterComponent object by default
+	*/
+	inline SoundEmitterComponent::SoundEmitterComponent() :
+	m_lastPosition(Nz::Vector3f::Zero()),
+	m_audibleDistance(std::numeric_limits<float>::infinity()),
+	m_isCulled(false)
+	{
+	}
+
+	/*!
+	* \brief Constructs a SoundEmitterComponent object playing a buffer
+	*
+	* \param soundBuffer Buffer to play
+	*/
+	inline SoundEmitterComponent::SoundEmitterComponent(const Nz::SoundBuffer* soundBuffer) :
+	Sound(soundBuffer),
+	m_lastPosition(Nz::Vector3f::Zero()),
+	m_audibleDistance(std::numeric_limits<float>::infinity()),
+	m_isCulled(false)
+	{
+	}
+
+	/*!
+	* \brief Constructs a SoundEmitterComponent object by copy of another
+	*
+	* \param component SoundEmitterComponent to copy
+	*/
+	inline SoundEmitterComponent::SoundEmitterComponent(const SoundEmitterComponent& component) :
+	Component(component),
+	Sound(component),
+	HandledObject(component),
+	m_lastPosition(component.m_lastPosition),
+	m_audibleDistance(component.m_audibleDistance),
+	m_isCulled(false)
+	{
+	}
+
+	/*!
+	* \brief Gets the distance from the listener beyond which the emitter is not updated anymore
+	* \return Audible distance
+	*/
+	inline float SoundEmitterComponent::GetAudibleDistance() const
+	{
+		return m_audibleDistance;
+	}
+
+	/*!
+	* \brief Checks whether the emitter was too far from the listener to be updated by the last update
+	* \return true If it is the case
+	*/
+	inline bool SoundEmitterComponent::IsCulled() const
+	{
+		return m_isCulled;
+	}
+
+	/*!
+	* \brief Sets the distance from the listener beyond which the emitter is not updated anymore
+	*
+	* \param audibleDistance Audible distance, infinite by default
+	*
+	* \remark The sound keeps playing from the last position it was updated at, this distance should be chosen so that the sound can't be heard anymore
+	*/
+	inline void SoundEmitterComponent::SetAudibleDistance(float audibleDistance)
+	{
+		NazaraAssert(audibleDistance > 0.f, "Audible distance must be positive");
+
+		m_audibleDistance = audibleDistance;
+	}
+}
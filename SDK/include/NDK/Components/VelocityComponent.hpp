@@ -28,6 +28,9 @@ namespace Ndk
 
 			static ComponentIndex componentIndex;
 	};
+
+	NDK_API bool Serialize(Nz::SerializationContext& context, const VelocityComponent& velocity, Nz::TypeTag<VelocityComponent>);
+	NDK_API bool Unserialize(Nz::SerializationContext& context, VelocityComponent* velocity, Nz::TypeTag<VelocityComponent>);
 }
 
 #include <NDK/Components/VelocityComponent.inl>
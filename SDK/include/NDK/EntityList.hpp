@@ -15,6 +15,7 @@ namespace Ndk
 {
 	class NDK_API EntityList
 	{
+		friend BaseSystem;
 		friend Entity;
 
 		public:
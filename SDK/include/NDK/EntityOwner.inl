@@ -44,8 +44,8 @@ namespace Ndk
 
 	inline void EntityOwner::Reset(Entity* entity)
 	{
-		if (m_object)
-			m_object->Kill();
+		if (Entity* object = GetObject())
+			object->Kill();
 
 		EntityHandle::Reset(entity);
 	}
@@ -59,7 +59,7 @@ namespace Ndk
 	inline void EntityOwner::Reset(EntityOwner&& handle)
 	{
 		Reset(handle.GetObject());
-		handle.m_object = nullptr;
+		handle.EntityHandle::Reset();
 	}
 
 	/*!
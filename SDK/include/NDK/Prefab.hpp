@@ -0,0 +1,57 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequisites.hpp
+
+#pragma once
+
+#ifndef NDK_PREFAB_HPP
+#define NDK_PREFAB_HPP
+
+#include <Nazara/Core/Bitset.hpp>
+#include <NDK/Algorithm.hpp>
+#include <NDK/Prerequisites.hpp>
+#include <memory>
+#include <vector>
+
+namespace Ndk
+{
+	class BaseComponent;
+	class Entity;
+
+	class NDK_API Prefab
+	{
+		public:
+			Prefab();
+			Prefab(const Prefab& prefab);
+			Prefab(Prefab&& prefab) noexcept;
+			~Prefab();
+
+			BaseComponent& AddComponent(std::unique_ptr<BaseComponent>&& component);
+			template<typename ComponentType, typename... Args> ComponentType& AddComponent(Args&&... args);
+
+			inline BaseComponent& GetComponent(ComponentIndex index);
+			template<typename ComponentType> ComponentType& GetComponent();
+			inline const BaseComponent& GetComponent(ComponentIndex index) const;
+			template<typename ComponentType> const ComponentType& GetComponent() const;
+			inline const Nz::Bitset<>& GetComponentBits() const;
+
+			inline bool HasComponent(ComponentIndex index) const;
+			template<typename ComponentType> bool HasComponent() const;
+
+			void RemoveComponent(ComponentIndex index);
+			template<typename ComponentType> void RemoveComponent();
+
+			Prefab& operator=(const Prefab& prefab);
+			Prefab& operator=(Prefab&& prefab) noexcept;
+
+			static Prefab FromEntity(const Entity& entity);
+
+		private:
+			std::vector<std::unique_ptr<BaseComponent>> m_components;
+			Nz::Bitset<> m_componentBits;
+	};
+}
+
+#include <NDK/Prefab.inl>
+
+#endif // NDK_PREFAB_HPP
@@ -0,0 +1,135 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequisites.hpp
+
+#include <NDK/Prefab.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <type_traits>
+
+namespace Ndk
+{
+	/*!
+	* \brief Adds a component to the prefab
+	* \return A reference to the newly added component
+	*
+	* \param args Arguments to create in place the component to add to the prefab
+	*/
+
+	template<typename ComponentType, typename... Args>
+	ComponentType& Prefab::AddComponent(Args&&... args)
+	{
+		static_assert(std::is_base_of<BaseComponent, ComponentType>::value, "ComponentType is not a component");
+
+		std::unique_ptr<ComponentType> ptr(new ComponentType(std::forward<Args>(args)...));
+		return static_cast<ComponentType&>(AddComponent(std::move(ptr)));
+	}
+
+	/*!
+	* \brief Gets a component of the prefab by index
+	* \return A reference to the component
+	*
+	* \param index Index of the component
+	*
+	* \remark Produces a NazaraAssert if component is not part of the prefab
+	*/
+
+	inline BaseComponent& Prefab::GetComponent(ComponentIndex index)
+	{
+		NazaraAssert(HasComponent(index), "This component is not part of the prefab");
+
+		return *m_components[index];
+	}
+
+	/*!
+	* \brief Gets a component of the prefab by type
+	* \return A reference to the component
+	*
+	* \remark Produces a NazaraAssert if component is not part of the prefab
+	*/
+
+	template<typename ComponentType>
+	ComponentType& Prefab::GetComponent()
+	{
+		static_assert(std::is_base_of<BaseComponent, ComponentType>::value, "ComponentType is not a component");
+
+		return static_cast<ComponentType&>(GetComponent(GetComponentIndex<ComponentType>()));
+	}
+
+	/*!
+	* \brief Gets a component of the prefab by index
+	* \return A constant reference to the component
+	*
+	* \param index Index of the component
+	*
+	* \remark Produces a NazaraAssert if component is not part of the prefab
+	*/
+
+	inline const BaseComponent& Prefab::GetComponent(ComponentIndex index) const
+	{
+		NazaraAssert(HasComponent(index), "This component is not part of the prefab");
+
+		return *m_components[index];
+	}
+
+	/*!
+	* \brief Gets a component of the prefab by type
+	* \return A constant reference to the component
+	*
+	* \remark Produces a NazaraAssert if component is not part of the prefab
+	*/
+
+	template<typename ComponentType>
+	const ComponentType& Prefab::GetComponent() const
+	{
+		static_assert(std::is_base_of<BaseComponent, ComponentType>::value, "ComponentType is not a component");
+
+		return static_cast<const ComponentType&>(GetComponent(GetComponentIndex<ComponentType>()));
+	}
+
+	/*!
+	* \brief Gets the bits representing the components of the prefab
+	* \return A constant reference to the set of component's bits
+	*/
+
+	inline const Nz::Bitset<>& Prefab::GetComponentBits() const
+	{
+		return m_componentBits;
+	}
+
+	/*!
+	* \brief Checks whether the prefab has a component by index
+	* \return true If it is the case
+	*
+	* \param index Index of the component
+	*/
+
+	inline bool Prefab::HasComponent(ComponentIndex index) const
+	{
+		return m_componentBits.UnboundedTest(index);
+	}
+
+	/*!
+	* \brief Checks whether the prefab has a component by type
+	* \return true If it is the case
+	*/
+
+	template<typename ComponentType>
+	bool Prefab::HasComponent() const
+	{
+		static_assert(std::is_base_of<BaseComponent, ComponentType>::value, "ComponentType is not a component");
+
+		return HasComponent(GetComponentIndex<ComponentType>());
+	}
+
+	/*!
+	* \brief Removes a component of the prefab by type
+	*/
+
+	template<typename ComponentType>
+	void Prefab::RemoveComponent()
+	{
+		static_assert(std::is_base_of<BaseComponent, ComponentType>::value, "ComponentType is not a component");
+
+		RemoveComponent(GetComponentIndex<ComponentType>());
+	}
+}
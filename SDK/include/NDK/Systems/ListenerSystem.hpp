@@ -8,7 +8,10 @@
 #ifndef NDK_SYSTEMS_LISTENERSYSTEM_HPP
 #define NDK_SYSTEMS_LISTENERSYSTEM_HPP
 
+#include <Nazara/Audio/SoundEmitter.hpp>
+#include <NDK/EntityList.hpp>
 #include <NDK/System.hpp>
+#include <vector>
 
 namespace Ndk
 {
@@ -18,10 +21,21 @@ namespace Ndk
 			ListenerSystem();
 			~ListenerSystem() = default;
 
+			inline void EnableContextSuspension(bool enable = true);
+
+			inline bool IsContextSuspensionEnabled() const;
+
 			static SystemIndex systemIndex;
 
 		private:
+			void OnEntityRemoved(Entity* entity) override;
+			void OnEntityValidation(Entity* entity, bool justAdded) override;
 			void OnUpdate(float elapsedTime) override;
+
+			std::vector<Nz::SoundEmitter::SpatialUpdate> m_spatialUpdates;
+			EntityList m_emitters;
+			EntityList m_listeners;
+			bool m_isContextSuspensionEnabled;
 	};
 }
 
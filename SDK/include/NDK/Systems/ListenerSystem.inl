@@ -1,3 +1,27 @@
 // Copyright (C) 2017 Jérôme Leclercq
 // This file is part of the "Nazara Development Kit"
 // For conditions of distribution and use, see copyright notice in Prerequisites.hpp
+
+namespace Ndk
+{
+	/*!
+	* \brief Enables the suspension of the audio context while the emitters are updated
+	*
+	* \param enable Should the context be suspended
+	*
+	* \see Nz::SoundEmitter::UpdateSpatialization
+	*/
+	inline void ListenerSystem::EnableContextSuspension(bool enable)
+	{
+		m_isContextSuspensionEnabled = enable;
+	}
+
+	/*!
+	* \brief Checks whether the audio context is suspended while the emitters are updated
+	* \return true If it is the case
+	*/
+	inline bool ListenerSystem::IsContextSuspensionEnabled() const
+	{
+		return m_isContextSuspensionEnabled;
+	}
+}
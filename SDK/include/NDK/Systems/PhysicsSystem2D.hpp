@@ -16,6 +16,8 @@ namespace Ndk
 {
 	class NDK_API PhysicsSystem2D : public System<PhysicsSystem2D>
 	{
+		friend class CollisionComponent2D;
+
 		public:
 			PhysicsSystem2D();
 			PhysicsSystem2D(const PhysicsSystem2D& system);
@@ -32,6 +34,8 @@ namespace Ndk
 			void OnUpdate(float elapsedTime) override;
 
 			EntityList m_dynamicObjects;
+			EntityList m_movedStaticObjects; // Static objects whose node was invalidated since the last update
+			EntityList m_movingStaticObjects; // Static objects given a velocity by the last update
 			EntityList m_staticObjects;
 			mutable std::unique_ptr<Nz::PhysWorld2D> m_world; ///TODO: std::optional (Should I make a Nz::Optional class?)
 	};
@@ -7,15 +7,20 @@
 #ifndef NDK_SYSTEMS_PHYSICSSYSTEM3D_HPP
 #define NDK_SYSTEMS_PHYSICSSYSTEM3D_HPP
 
+#include <Nazara/Math/Quaternion.hpp>
+#include <Nazara/Math/Vector3.hpp>
 #include <Nazara/Physics3D/PhysWorld3D.hpp>
 #include <NDK/EntityList.hpp>
 #include <NDK/System.hpp>
 #include <memory>
+#include <vector>
 
 namespace Ndk
 {
 	class NDK_API PhysicsSystem3D : public System<PhysicsSystem3D>
 	{
+		friend class CollisionComponent3D;
+
 		public:
 			PhysicsSystem3D();
 			~PhysicsSystem3D() = default;
@@ -30,7 +35,12 @@ namespace Ndk
 			void OnEntityValidation(Entity* entity, bool justAdded) override;
 			void OnUpdate(float elapsedTime) override;
 
+			std::vector<const Nz::RigidBody3D*> m_dynamicBodies; // Indexed by entity id
+			std::vector<Nz::Quaternionf> m_bodyRotations;
+			std::vector<Nz::Vector3f> m_bodyPositions;
 			EntityList m_dynamicObjects;
+			EntityList m_movedStaticObjects; // Static objects whose node was invalidated since the last update
+			EntityList m_movingStaticObjects; // Static objects given a velocity by the last update
 			EntityList m_staticObjects;
 			mutable std::unique_ptr<Nz::PhysWorld3D> m_world; ///TODO: std::optional (Should I make a Nz::Optional class?)
 	};
@@ -11,67 +11,173 @@
 #include <Nazara/Graphics/AbstractBackground.hpp>
 #include <Nazara/Graphics/CullingList.hpp>
 #include <Nazara/Graphics/DepthRenderTechnique.hpp>
+#include <Nazara/Graphics/DynamicResolutionController.hpp>
+#include <Nazara/Graphics/ForwardRenderTechnique.hpp>
+#include <Nazara/Graphics/OcclusionCuller.hpp>
+#include <Nazara/Graphics/ResidencyManager.hpp>
+#include <Nazara/Renderer/GpuProfiler.hpp>
 #include <Nazara/Renderer/RenderTexture.hpp>
+#include <Nazara/Renderer/RenderThread.hpp>
 #include <NDK/EntityList.hpp>
 #include <NDK/System.hpp>
 #include <NDK/Components/GraphicsComponent.hpp>
+#include <array>
+#include <memory>
+#include <unordered_map>
 #include <vector>
 
 namespace Ndk
 {
 	class AbstractViewer;
+	class LightComponent;
+	class ParticleGroupComponent;
+	class ReflectionProbeComponent;
 
 	class NDK_API RenderSystem : public System<RenderSystem>
 	{
 		public:
 			RenderSystem();
 			inline RenderSystem(const RenderSystem& renderSystem);
-			~RenderSystem() = default;
+			~RenderSystem();
 
 			template<typename T> T& ChangeRenderTechnique();
 			inline Nz::AbstractRenderTechnique& ChangeRenderTechnique(std::unique_ptr<Nz::AbstractRenderTechnique>&& renderTechnique);
 
+			void EnableDynamicResolution(bool enable = true);
+			inline void EnableOcclusionCulling(bool enable = true);
+			void EnableRenderThread(bool enable = true, unsigned int pipelineDepth = 1);
+
 			inline const Nz::BackgroundRef& GetDefaultBackground() const;
 			inline const Nz::Matrix4f& GetCoordinateSystemMatrix() const;
+			inline Nz::DynamicResolutionController& GetDynamicResolutionController();
+			inline const Nz::DynamicResolutionController& GetDynamicResolutionController() const;
 			inline Nz::Vector3f GetGlobalForward() const;
 			inline Nz::Vector3f GetGlobalRight() const;
 			inline Nz::Vector3f GetGlobalUp() const;
+			inline unsigned int GetReflectionFaceBudget() const;
 			inline Nz::AbstractRenderTechnique& GetRenderTechnique() const;
+			inline Nz::RenderThread* GetRenderThread() const;
+			inline Nz::ResidencyManager* GetResidencyManager() const;
+			inline float GetShadowDistance() const;
+
+			inline bool IsDynamicResolutionEnabled() const;
+			inline bool IsOcclusionCullingEnabled() const;
+			inline bool IsRenderThreadEnabled() const;
 
 			inline void SetDefaultBackground(Nz::BackgroundRef background);
 			inline void SetGlobalForward(const Nz::Vector3f& direction);
 			inline void SetGlobalRight(const Nz::Vector3f& direction);
 			inline void SetGlobalUp(const Nz::Vector3f& direction);
+			inline void SetReflectionFaceBudget(unsigned int faceBudget);
+			inline void SetResidencyManager(Nz::ResidencyManager* residencyManager);
+			inline void SetShadowDistance(float distance);
 
 			static SystemIndex systemIndex;
 
 		private:
+			struct FramePacket;
+			struct View;
+
 			inline void InvalidateCoordinateSystem();
 
 			void OnEntityRemoved(Entity* entity) override;
 			void OnEntityValidation(Entity* entity, bool justAdded) override;
 			void OnUpdate(float elapsedTime) override;
 
-			void UpdateDynamicReflections();
-			void UpdateDirectionalShadowMaps(const Nz::AbstractViewer& viewer);
+			void CullViews();
+			void DrawReflectionProbeFace(ReflectionProbeComponent& probe, const Nz::Vector3f& position);
+			void DrawShadowView(const View& view, const Nz::Recti& viewport);
+			void QueueReflectionProbes(Nz::AbstractRenderQueue* renderQueue) const;
+			void SubmitFramePacket();
+			void UpdateBoundingVolumes();
+			void UpdateDirectionalShadowMaps(std::size_t cameraIndex);
 			void UpdatePointSpotShadowMaps();
+			void UpdateReflectionProbes();
+
+			struct CameraOcclusion
+			{
+				Nz::OcclusionCuller culler;
+				bool visibilityChanged = false;
+			};
+
+			struct DirectionalShadow
+			{
+				std::array<Nz::Vector4f, NAZARA_GRAPHICS_MAX_SHADOW_CASCADES> cascades;
+				Nz::Matrix4f viewProjMatrix;
+				LightComponent* light;
+				std::size_t cameraIndex;
+				std::size_t firstView; //< Cascades are culled as consecutive views
+			};
+
+			struct ShadowMapState
+			{
+				Nz::Matrix4f projectionMatrix;
+				Nz::Matrix4f viewMatrix;
+				Nz::PixelFormatType format;
+				Nz::Vector2ui size;
+				const Nz::Texture* texture = nullptr;
+				std::size_t visibilityHash;
+			};
+
+			struct View
+			{
+				GraphicsComponentCullingList::ResultContainer visibleComponents;
+				Nz::Frustumf frustum;
+				Nz::Matrix4f projectionMatrix;
+				Nz::Matrix4f viewMatrix;
+				Nz::ProjectionType projectionType;
+				EntityId lightId;
+				LightComponent* light; //< Shadow casting light, nullptr for cameras
+				std::size_t visibilityHash;
+				unsigned int face; //< Cube face of a point light, cascade of a directional light
+				bool forceInvalidation;
+				float zFar;
+				float zNear;
+			};
 
 			std::unique_ptr<Nz::AbstractRenderTechnique> m_renderTechnique;
+			std::size_t m_framePacketIndex;
+			std::size_t m_reflectionProbeCursor; //< Real-time probe being drawn, face after face
+			std::size_t m_shadowViewCount;
+			std::unordered_map<EntityId, std::array<ShadowMapState, 6>> m_shadowMapStates; //< What each shadow map slot (cube face or cascade) was last drawn with
+			std::vector<DirectionalShadow> m_directionalShadows;
+			std::vector<std::unique_ptr<FramePacket>> m_framePackets; //< Filled in turn, one more than the frames the render thread may have in flight
+			std::vector<View> m_views;
 			std::vector<GraphicsComponentCullingList::VolumeEntry> m_volumeEntries;
+			std::vector<const GraphicsComponent*> m_dirtyVolumeComponents; //< Components whose bounding volume is computed in the current batch
+			std::vector<Nz::BoundingVolumef> m_dirtyVolumes;
+			std::vector<Nz::Boxf> m_dirtyVolumeLocalBoxes;
+			std::vector<Nz::Matrix4f> m_dirtyVolumeMatrices;
+			std::vector<CameraOcclusion> m_cameraOcclusions; //< Indexed like m_cameras
 			std::vector<EntityHandle> m_cameras;
+			std::vector<EntityHandle> m_reflectionProbes;
+			std::vector<const ParticleGroupComponent*> m_visibleParticleGroups;
 			EntityList m_drawables;
 			EntityList m_directionalLights;
 			EntityList m_lights;
 			EntityList m_pointSpotLights;
 			EntityList m_particleGroups;
-			EntityList m_realtimeReflected;
+			EntityHandle m_queuedCamera;
 			GraphicsComponentCullingList m_drawableCulling;
+			GraphicsComponentCullingList::ResultContainer m_probeVisibleComponents;
 			Nz::BackgroundRef m_background;
 			Nz::DepthRenderTechnique m_shadowTechnique;
+			Nz::DynamicResolutionController m_dynamicResolution;
+			Nz::ForwardRenderTechnique m_probeTechnique;
+			Nz::GpuProfiler m_gpuProfiler;
 			Nz::Matrix4f m_coordinateSystemMatrix;
+			Nz::RenderTexture m_probeRT;
 			Nz::RenderTexture m_shadowRT;
+			Nz::ResidencyManager* m_residencyManager;
+			Nz::TextureRef m_probeDepthMap; //< Shared by every probe, recreated when their size differs
+			std::unique_ptr<Nz::RenderThread> m_renderThread;
 			bool m_coordinateSystemInvalidated;
+			bool m_dynamicResolutionEnabled;
 			bool m_forceRenderQueueInvalidation;
+			bool m_occlusionCulling;
+			bool m_particleGroupsQueued; //< Whether the render queue holds particles
+			float m_shadowDistance;
+			unsigned int m_reflectionFaceBudget;
 	};
 }
 
@@ -29,6 +29,27 @@ namespace Ndk
         return *m_renderTechnique.get();
 	}
 
+	/*!
+	* \brief Enables or disables occlusion culling
+	*
+	* When enabled, drawables found hidden by the occlusion queries of the previous frame are not queued
+	*
+	* \param enable Should occlusion culling be enabled
+	*
+	* \remark The render technique must leave the depth of the scene in the target, which isn't the case of the deferred technique
+	*/
+
+	inline void RenderSystem::EnableOcclusionCulling(bool enable)
+	{
+		if (m_occlusionCulling == enable)
+			return;
+
+		m_occlusionCulling = enable;
+		m_cameraOcclusions.clear();
+
+		m_forceRenderQueueInvalidation = true;
+	}
+
 	/*!
 	* \brief Gets the background used for rendering
 	* \return A reference to the background
@@ -49,6 +70,28 @@ namespace Ndk
 		return m_coordinateSystemMatrix;
 	}
 
+	/*!
+	* \brief Gets the controller choosing the resolution scale when dynamic resolution is enabled
+	* \return A reference to the controller, whose budget and scale range can be changed
+	*
+	* \see EnableDynamicResolution
+	*/
+
+	inline Nz::DynamicResolutionController& RenderSystem::GetDynamicResolutionController()
+	{
+		return m_dynamicResolution;
+	}
+
+	/*!
+	* \brief Gets the controller choosing the resolution scale when dynamic resolution is enabled
+	* \return A constant reference to the controller
+	*/
+
+	inline const Nz::DynamicResolutionController& RenderSystem::GetDynamicResolutionController() const
+	{
+		return m_dynamicResolution;
+	}
+
 	/*!
 	* \brief Gets the "forward" global direction
 	* \return The forward direction, by default, it's -UnitZ() (Right hand coordinates)
@@ -79,6 +122,18 @@ namespace Ndk
 		return Nz::Vector3f(m_coordinateSystemMatrix.m12, m_coordinateSystemMatrix.m22, m_coordinateSystemMatrix.m32);
 	}
 
+	/*!
+	* \brief Gets the number of reflection probe faces drawn every frame
+	* \return Face budget
+	*
+	* \see SetReflectionFaceBudget
+	*/
+
+	inline unsigned int RenderSystem::GetReflectionFaceBudget() const
+	{
+		return m_reflectionFaceBudget;
+	}
+
 	/*!
 	* \brief Gets the render technique used for rendering
 	* \return A reference to the abstract render technique being used
@@ -89,6 +144,68 @@ namespace Ndk
 		return *m_renderTechnique.get();
 	}
 
+	/*!
+	* \brief Gets the thread drawing the cameras
+	* \return Pointer to the render thread, nullptr if the cameras are drawn by the system itself
+	*
+	* \see EnableRenderThread
+	*/
+
+	inline Nz::RenderThread* RenderSystem::GetRenderThread() const
+	{
+		return m_renderThread.get();
+	}
+
+	/*!
+	* \brief Gets the manager streaming the resources of the drawables
+	* \return Pointer to the residency manager, nullptr if none is used
+	*/
+
+	inline Nz::ResidencyManager* RenderSystem::GetResidencyManager() const
+	{
+		return m_residencyManager;
+	}
+
+	/*!
+	* \brief Gets the distance from the cameras up to which directional lights cast shadows
+	* \return Shadow distance
+	*/
+
+	inline float RenderSystem::GetShadowDistance() const
+	{
+		return m_shadowDistance;
+	}
+
+	/*!
+	* \brief Checks whether dynamic resolution is enabled
+	* \return true If it is the case
+	*/
+
+	inline bool RenderSystem::IsDynamicResolutionEnabled() const
+	{
+		return m_dynamicResolutionEnabled;
+	}
+
+	/*!
+	* \brief Checks whether occlusion culling is enabled
+	* \return true If it is the case
+	*/
+
+	inline bool RenderSystem::IsOcclusionCullingEnabled() const
+	{
+		return m_occlusionCulling;
+	}
+
+	/*!
+	* \brief Checks whether the cameras are drawn by a render thread
+	* \return true If it is the case
+	*/
+
+	inline bool RenderSystem::IsRenderThreadEnabled() const
+	{
+		return m_renderThread != nullptr;
+	}
+
 	/*!
 	* \brief Sets the background used for rendering
 	*
@@ -145,6 +262,51 @@ namespace Ndk
 		InvalidateCoordinateSystem();
 	}
 
+	/*!
+	* \brief Sets the number of reflection probe faces drawn every frame
+	*
+	* Drawing a probe is time-sliced: static probes are baked first, then real-time probes are drawn in turn, a full cubemap taking 6 faces.
+	* A greater budget keeps the reflections more up to date, at the cost of a scene draw per face.
+	*
+	* \param faceBudget Face budget, 0 stops drawing the probes
+	*/
+
+	inline void RenderSystem::SetReflectionFaceBudget(unsigned int faceBudget)
+	{
+		m_reflectionFaceBudget = faceBudget;
+	}
+
+	/*!
+	* \brief Sets the manager streaming the resources of the drawables
+	*
+	* The drawables visible from the cameras request their resources at their size on screen, the manager being updated at the end of each frame.
+	*
+	* \param residencyManager Residency manager, which must outlive its use by the system, nullptr to stop streaming
+	*/
+
+	inline void RenderSystem::SetResidencyManager(Nz::ResidencyManager* residencyManager)
+	{
+		m_residencyManager = residencyManager;
+	}
+
+	/*!
+	* \brief Sets the distance from the cameras up to which directional lights cast shadows
+	*
+	* The view of each camera is split into NAZARA_GRAPHICS_MAX_SHADOW_CASCADES cascades up to this distance (or its far plane if it's closer),
+	* a shorter distance gives sharper shadows.
+	*
+	* \param distance Shadow distance
+	*
+	* \remark Produces a NazaraAssert if distance is not positive
+	*/
+
+	inline void RenderSystem::SetShadowDistance(float distance)
+	{
+		NazaraAssert(distance > 0.f, "Shadow distance must be positive");
+
+		m_shadowDistance = distance;
+	}
+
 	/*!
 	* \brief Invalidates the matrix of coordinates for the system
 	*/
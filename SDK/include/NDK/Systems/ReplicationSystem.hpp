@@ -0,0 +1,127 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequisites.hpp
+
+#pragma once
+
+#ifndef NDK_SYSTEMS_REPLICATIONSYSTEM_HPP
+#define NDK_SYSTEMS_REPLICATIONSYSTEM_HPP
+
+#include <Nazara/Core/Bitset.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <Nazara/Network/ENetPeer.hpp>
+#include <Nazara/Network/NetPacket.hpp>
+#include <NDK/System.hpp>
+#include <NDK/Systems/SpatialSystem.hpp>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace Ndk
+{
+	class NDK_API ReplicationSystem : public System<ReplicationSystem>
+	{
+		public:
+			ReplicationSystem();
+			~ReplicationSystem() = default;
+
+			void AddClient(Nz::ENetPeer* peer);
+
+			bool ApplySnapshot(Nz::NetPacket& packet);
+
+			inline Nz::UInt8 GetChannel() const;
+			inline std::size_t GetClientCount() const;
+			inline Nz::UInt16 GetNetCode() const;
+			const EntityHandle& GetReplicatedEntity(EntityId remoteId) const;
+
+			bool HasClient(const Nz::ENetPeer* peer) const;
+
+			void RemoveClient(Nz::ENetPeer* peer);
+
+			inline void SetChannel(Nz::UInt8 channelId);
+			void SetClientBandwidth(Nz::ENetPeer* peer, Nz::UInt32 bytesPerSecond);
+			void SetClientViewpoint(Nz::ENetPeer* peer, const Nz::Vector3f& position, float radius = std::numeric_limits<float>::infinity());
+			void SetEntityPriority(const Entity* entity, float priority);
+			inline void SetNetCode(Nz::UInt16 netCode);
+
+			static constexpr std::size_t MaxPacketSize = 60000;
+
+			static SystemIndex systemIndex;
+
+		private:
+			struct Client;
+			struct ComponentState;
+
+			Client* FindClient(const Nz::ENetPeer* peer);
+			const Client* FindClient(const Nz::ENetPeer* peer) const;
+
+			void GatherRelevantEntities(const Client& client, std::vector<EntityId>* entities) const;
+
+			void OnEntityRemoved(Entity* entity) override;
+			void OnUpdate(float elapsedTime) override;
+
+			void ResetClient(Client& client);
+
+			void SendSnapshot(Client& client, float elapsedTime);
+
+			void UpdateEntityStates();
+
+			bool WriteEntity(Nz::SerializationContext& context, EntityId id, const std::vector<ComponentState>& baseline, bool spawn);
+
+			struct ComponentState
+			{
+				ComponentIndex index;
+				Nz::ByteArray data;
+			};
+
+			struct EntityState
+			{
+				std::vector<ComponentState> components; //< Sorted by component index
+				Nz::UInt32 version = 0;
+				Nz::Vector3f position;
+				float priority = 1.f;
+				bool hasPosition = false;
+			};
+
+			struct ClientEntity
+			{
+				std::vector<ComponentState> baseline; //< Components as the client last received them
+				Nz::UInt32 version = 0;
+				float priorityAccumulator = 0.f;
+			};
+
+			struct Client
+			{
+				Nz::Bitset<Nz::UInt64> knownEntities;
+				Nz::ENetPeer* peer;
+				Nz::UInt32 bandwidth = 0;
+				Nz::Vector3f viewpoint = Nz::Vector3f::Zero();
+				std::vector<ClientEntity> entities; //< Indexed by entity id
+				std::vector<EntityId> pendingDespawns;
+				std::size_t observerId = SpatialSystem::InvalidObserver;
+				float credit = 0.f;
+				float viewRadius = std::numeric_limits<float>::infinity();
+			};
+
+			struct RemoteEntity
+			{
+				EntityHandle entity;
+				std::unordered_map<ComponentId, Nz::ByteArray> baseline;
+			};
+
+			std::unordered_map<EntityId, RemoteEntity> m_remoteEntities;
+			std::vector<Client> m_clients;
+			std::vector<EntityId> m_candidates;
+			std::vector<EntityId> m_unlocatedEntities; //< Entities without a NodeComponent, relevant to every client
+			std::vector<EntityState> m_entityStates; //< Indexed by entity id
+			Nz::ByteArray m_componentBuffer;
+			Nz::ByteArray m_deltaBuffer;
+			Nz::UInt16 m_netCode;
+			Nz::UInt8 m_channel;
+	};
+}
+
+#include <NDK/Systems/ReplicationSystem.inl>
+
+#endif // NDK_SYSTEMS_REPLICATIONSYSTEM_HPP
@@ -0,0 +1,55 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequisites.hpp
+
+#include <Nazara/Core/Error.hpp>
+
+namespace Ndk
+{
+	/*!
+	* \brief Gets the channel snapshots are sent on
+	* \return Channel identifier
+	*/
+	inline Nz::UInt8 ReplicationSystem::GetChannel() const
+	{
+		return m_channel;
+	}
+
+	/*!
+	* \brief Gets the number of clients entities are replicated to
+	* \return Client count
+	*/
+	inline std::size_t ReplicationSystem::GetClientCount() const
+	{
+		return m_clients.size();
+	}
+
+	/*!
+	* \brief Gets the net code of snapshot packets
+	* \return Net code
+	*/
+	inline Nz::UInt16 ReplicationSystem::GetNetCode() const
+	{
+		return m_netCode;
+	}
+
+	/*!
+	* \brief Sets the channel snapshots are sent on
+	*
+	* \param channelId Channel identifier, must be valid for every client peer
+	*/
+	inline void ReplicationSystem::SetChannel(Nz::UInt8 channelId)
+	{
+		m_channel = channelId;
+	}
+
+	/*!
+	* \brief Sets the net code of snapshot packets
+	*
+	* \param netCode Net code, allowing clients to recognize snapshots among their packets
+	*/
+	inline void ReplicationSystem::SetNetCode(Nz::UInt16 netCode)
+	{
+		m_netCode = netCode;
+	}
+}
@@ -0,0 +1,96 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequisites.hpp
+
+#pragma once
+
+#ifndef NDK_SYSTEMS_SPATIALSYSTEM_HPP
+#define NDK_SYSTEMS_SPATIALSYSTEM_HPP
+
+#include <Nazara/Core/Bitset.hpp>
+#include <Nazara/Core/Signal.hpp>
+#include <Nazara/Math/Box.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <Nazara/Utility/Node.hpp>
+#include <NDK/EntityList.hpp>
+#include <NDK/System.hpp>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace Ndk
+{
+	class NDK_API SpatialSystem : public System<SpatialSystem>
+	{
+		public:
+			SpatialSystem();
+			~SpatialSystem() = default;
+
+			std::size_t AddObserver(const Nz::Vector3f& position, float radius);
+
+			template<typename F> void ForEachEntityInBox(const Nz::Boxf& box, const F& callback) const;
+			template<typename F> void ForEachEntityInRadius(const Nz::Vector3f& center, float radius, const F& callback) const;
+
+			inline float GetCellSize() const;
+			inline const EntityList& GetObservedEntities(std::size_t observerId) const;
+			inline const Nz::Vector3f& GetObserverPosition(std::size_t observerId) const;
+			inline float GetObserverRadius(std::size_t observerId) const;
+
+			inline bool IsObserverValid(std::size_t observerId) const;
+
+			void RemoveObserver(std::size_t observerId);
+
+			void SetCellSize(float cellSize);
+			inline void SetObserverPosition(std::size_t observerId, const Nz::Vector3f& position);
+			inline void SetObserverRadius(std::size_t observerId, float radius);
+
+			static constexpr std::size_t InvalidObserver = std::numeric_limits<std::size_t>::max();
+
+			static SystemIndex systemIndex;
+
+			// Signals:
+			NazaraSignal(OnEntityEntered, SpatialSystem* /*system*/, std::size_t /*observerId*/, Entity* /*entity*/);
+			NazaraSignal(OnEntityLeft, SpatialSystem* /*system*/, std::size_t /*observerId*/, Entity* /*entity*/);
+
+		private:
+			template<typename F> void ForEachCell(const Nz::Vector3f& minPos, const Nz::Vector3f& maxPos, const F& callback) const;
+
+			inline Nz::UInt64 GetCellKey(const Nz::Vector3f& position) const;
+
+			void InsertEntity(EntityId id, const Nz::Vector3f& position);
+			void RemoveFromCell(EntityId id);
+
+			void OnEntityAdded(Entity* entity) override;
+			void OnEntityRemoved(Entity* entity) override;
+			void OnUpdate(float elapsedTime) override;
+
+			static inline Nz::UInt64 GetCellKey(int x, int y, int z);
+
+			struct EntityEntry
+			{
+				NazaraSlot(Nz::Node, OnNodeInvalidation, invalidationSlot);
+
+				Nz::UInt64 cellKey;
+				Nz::Vector3f position;
+				bool moved;
+			};
+
+			struct Observer
+			{
+				EntityList entities;
+				Nz::Vector3f position;
+				float radius;
+				bool isValid;
+			};
+
+			std::unordered_map<Nz::UInt64, std::vector<EntityId>> m_cells;
+			std::vector<EntityEntry> m_entries; //< Indexed by entity id
+			std::vector<Observer> m_observers;
+			Nz::Bitset<Nz::UInt64> m_observedEntities;
+			float m_cellSize;
+	};
+}
+
+#include <NDK/Systems/SpatialSystem.inl>
+
+#endif // NDK_SYSTEMS_SPATIALSYSTEM_HPP
@@ -0,0 +1,206 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequisites.hpp
+
+#include <Nazara/Core/Error.hpp>
+#include <NDK/World.hpp>
+#include <cmath>
+
+namespace Ndk
+{
+	/*!
+	* \brief Calls a function for every entity inside a box
+	*
+	* \param box Global box to look into
+	* \param callback Function called with the handle of every entity inside the box
+	*
+	* \remark Entities positions are the ones of the last update of the system
+	*/
+	template<typename F>
+	void SpatialSystem::ForEachEntityInBox(const Nz::Boxf& box, const F& callback) const
+	{
+		World& world = GetWorld();
+
+		ForEachCell(box.GetMinimum(), box.GetMaximum(), [&](EntityId id)
+		{
+			if (box.Contains(m_entries[id].position))
+				callback(world.GetEntity(id));
+		});
+	}
+
+	/*!
+	* \brief Calls a function for every entity within a distance of a point
+	*
+	* \param center Global position of the point
+	* \param radius Maximum distance of the entities
+	* \param callback Function called with the handle of every entity within the radius
+	*
+	* \remark Entities positions are the ones of the last update of the system
+	*/
+	template<typename F>
+	void SpatialSystem::ForEachEntityInRadius(const Nz::Vector3f& center, float radius, const F& callback) const
+	{
+		World& world = GetWorld();
+
+		float squaredRadius = radius * radius;
+		ForEachCell(center - Nz::Vector3f(radius), center + Nz::Vector3f(radius), [&](EntityId id)
+		{
+			if (center.SquaredDistance(m_entries[id].position) <= squaredRadius)
+				callback(world.GetEntity(id));
+		});
+	}
+
+	/*!
+	* \brief Gets the size of the cells of the grid
+	* \return Cell size
+	*/
+	inline float SpatialSystem::GetCellSize() const
+	{
+		return m_cellSize;
+	}
+
+	/*!
+	* \brief Gets the entities an observer sees
+	* \return Entities within the radius of the observer at the last update of the system
+	*
+	* \param observerId Identifier of the observer
+	*
+	* \remark Produces a NazaraAssert if the observer is not valid
+	*/
+	inline const EntityList& SpatialSystem::GetObservedEntities(std::size_t observerId) const
+	{
+		NazaraAssert(IsObserverValid(observerId), "Invalid observer");
+
+		return m_observers[observerId].entities;
+	}
+
+	/*!
+	* \brief Gets the position of an observer
+	* \return Global position of the observer
+	*
+	* \param observerId Identifier of the observer
+	*
+	* \remark Produces a NazaraAssert if the observer is not valid
+	*/
+	inline const Nz::Vector3f& SpatialSystem::GetObserverPosition(std::size_t observerId) const
+	{
+		NazaraAssert(IsObserverValid(observerId), "Invalid observer");
+
+		return m_observers[observerId].position;
+	}
+
+	/*!
+	* \brief Gets the distance an observer sees entities from
+	* \return Radius of the observer
+	*
+	* \param observerId Identifier of the observer
+	*
+	* \remark Produces a NazaraAssert if the observer is not valid
+	*/
+	inline float SpatialSystem::GetObserverRadius(std::size_t observerId) const
+	{
+		NazaraAssert(IsObserverValid(observerId), "Invalid observer");
+
+		return m_observers[observerId].radius;
+	}
+
+	/*!
+	* \brief Checks whether an observer exists
+	* \return true If it is the case
+	*
+	* \param observerId Identifier of the observer
+	*/
+	inline bool SpatialSystem::IsObserverValid(std::size_t observerId) const
+	{
+		return observerId < m_observers.size() && m_observers[observerId].isValid;
+	}
+
+	/*!
+	* \brief Moves an observer
+	*
+	* \param observerId Identifier of the observer
+	* \param position New global position of the observer
+	*
+	* \remark Entered and left entities are signaled at the next update of the system
+	* \remark Produces a NazaraAssert if the observer is not valid
+	*/
+	inline void SpatialSystem::SetObserverPosition(std::size_t observerId, const Nz::Vector3f& position)
+	{
+		NazaraAssert(IsObserverValid(observerId), "Invalid observer");
+
+		m_observers[observerId].position = position;
+	}
+
+	/*!
+	* \brief Sets the distance an observer sees entities from
+	*
+	* \param observerId Identifier of the observer
+	* \param radius New radius of the observer
+	*
+	* \remark Entered and left entities are signaled at the next update of the system
+	* \remark Produces a NazaraAssert if the observer is not valid
+	*/
+	inline void SpatialSystem::SetObserverRadius(std::size_t observerId, float radius)
+	{
+		NazaraAssert(IsObserverValid(observerId), "Invalid observer");
+		NazaraAssert(radius >= 0.f, "Radius must be positive");
+
+		m_observers[observerId].radius = radius;
+	}
+
+	template<typename F>
+	void SpatialSystem::ForEachCell(const Nz::Vector3f& minPos, const Nz::Vector3f& maxPos, const F& callback) const
+	{
+		int minX = static_cast<int>(std::floor(minPos.x / m_cellSize));
+		int minY = static_cast<int>(std::floor(minPos.y / m_cellSize));
+		int minZ = static_cast<int>(std::floor(minPos.z / m_cellSize));
+		int maxX = static_cast<int>(std::floor(maxPos.x / m_cellSize));
+		int maxY = static_cast<int>(std::floor(maxPos.y / m_cellSize));
+		int maxZ = static_cast<int>(std::floor(maxPos.z / m_cellSize));
+
+		// When the area covers more cells than there are, testing every entity is faster
+		double cellCount = double(maxX - minX + 1) * double(maxY - minY + 1) * double(maxZ - minZ + 1);
+		if (cellCount > double(m_cells.size()))
+		{
+			for (const auto& pair : m_cells)
+			{
+				for (EntityId id : pair.second)
+					callback(id);
+			}
+
+			return;
+		}
+
+		for (int x = minX; x <= maxX; ++x)
+		{
+			for (int y = minY; y <= maxY; ++y)
+			{
+				for (int z = minZ; z <= maxZ; ++z)
+				{
+					auto it = m_cells.find(GetCellKey(x, y, z));
+					if (it == m_cells.end())
+						continue;
+
+					for (EntityId id : it->second)
+						callback(id);
+				}
+			}
+		}
+	}
+
+	inline Nz::UInt64 SpatialSystem::GetCellKey(const Nz::Vector3f& position) const
+	{
+		int x = static_cast<int>(std::floor(position.x / m_cellSize));
+		int y = static_cast<int>(std::floor(position.y / m_cellSize));
+		int z = static_cast<int>(std::floor(position.z / m_cellSize));
+
+		return GetCellKey(x, y, z);
+	}
+
+	inline Nz::UInt64 SpatialSystem::GetCellKey(int x, int y, int z)
+	{
+		constexpr Nz::UInt64 mask = (1ULL << 21) - 1;
+
+		return ((static_cast<Nz::UInt64>(x) & mask) << 42) | ((static_cast<Nz::UInt64>(y) & mask) << 21) | (static_cast<Nz::UInt64>(z) & mask);
+	}
+}
@@ -30,6 +30,7 @@ namespace Ndk
 			//virtual TextAreaWidget* Clone() const = 0;
 
 			inline void EnableMultiline(bool enable = true);
+			void EnableVirtualization(bool enable = true);
 
 			void EraseSelection();
 
@@ -38,22 +39,28 @@ namespace Ndk
 			inline Nz::Vector2ui GetCursorPosition(std::size_t glyphIndex) const;
 			inline const Nz::String& GetDisplayText() const;
 			inline EchoMode GetEchoMode() const;
+			inline std::size_t GetFirstVisibleLine() const;
 			inline std::size_t GetGlyphIndex(const Nz::Vector2ui& cursorPosition);
+			inline std::size_t GetLineCount() const;
 			inline const Nz::String& GetText() const;
 			inline const Nz::Color& GetTextColor() const;
 
 			Nz::Vector2ui GetHoveredGlyph(float x, float y) const;
+			std::size_t GetVisibleLineCount() const;
 
 			inline bool HasSelection() const;
 
 			inline bool IsMultilineEnabled() const;
 			inline bool IsReadOnly() const;
+			inline bool IsVirtualizationEnabled() const;
 
 			inline void MoveCursor(int offset);
 			inline void MoveCursor(const Nz::Vector2i& offset);
 
 			void ResizeToContent() override;
 
+			void ScrollToLine(std::size_t line);
+
 			inline void SetCharacterSize(unsigned int characterSize);
 			inline void SetCursorPosition(std::size_t glyphIndex);
 			inline void SetCursorPosition(Nz::Vector2ui cursorPosition);
@@ -91,10 +98,13 @@ namespace Ndk
 			void OnMouseButtonRelease(int /*x*/, int /*y*/, Nz::Mouse::Button button) override;
 			void OnMouseEnter() override;
 			void OnMouseMoved(int x, int y, int deltaX, int deltaY) override;
+			void OnMouseWheelMoved(float delta) override;
 			void OnTextEntered(char32_t character, bool repeated) override;
 
+			void IndexLines(std::size_t firstByte);
 			void RefreshCursor();
 			void UpdateDisplayText();
+			void UpdateVisibleLines();
 
 			EchoMode m_echoMode;
 			EntityHandle m_cursorEntity;
@@ -105,10 +115,13 @@ namespace Ndk
 			Nz::Vector2ui m_cursorPositionBegin;
 			Nz::Vector2ui m_cursorPositionEnd;
 			Nz::Vector2ui m_selectionCursor;
+			std::size_t m_firstVisibleLine;
+			std::vector<std::size_t> m_lineOffsets;
 			std::vector<Nz::SpriteRef> m_cursorSprites;
 			bool m_isMouseButtonDown;
 			bool m_multiLineEnabled;
 			bool m_readOnly;
+			bool m_virtualized;
 	};
 }
 
@@ -14,6 +14,12 @@ namespace Ndk
 		m_text.Clear();
 		m_textSprite->Update(m_drawer);
 
+		if (m_virtualized)
+		{
+			m_firstVisibleLine = 0;
+			m_lineOffsets.assign(1, 0);
+		}
+
 		RefreshCursor();
 		OnTextChanged(this, m_text);
 	}
@@ -61,6 +67,11 @@ namespace Ndk
 		return m_drawer.GetText();
 	}
 
+	inline std::size_t TextAreaWidget::GetFirstVisibleLine() const
+	{
+		return m_firstVisibleLine;
+	}
+
 	inline std::size_t TextAreaWidget::GetGlyphIndex(const Nz::Vector2ui& cursorPosition)
 	{
 		std::size_t glyphIndex = m_drawer.GetLine(cursorPosition.y).glyphIndex + cursorPosition.x;
@@ -77,6 +88,11 @@ namespace Ndk
 		return m_echoMode;
 	}
 
+	inline std::size_t TextAreaWidget::GetLineCount() const
+	{
+		return (m_virtualized) ? m_lineOffsets.size() : m_drawer.GetLineCount();
+	}
+
 	inline const Nz::String& TextAreaWidget::GetText() const
 	{
 		return m_text;
@@ -102,6 +118,11 @@ namespace Ndk
 		return m_readOnly;
 	}
 
+	inline bool TextAreaWidget::IsVirtualizationEnabled() const
+	{
+		return m_virtualized;
+	}
+
 	inline void TextAreaWidget::MoveCursor(int offset)
 	{
 		std::size_t cursorGlyph = GetGlyphIndex(m_cursorPositionBegin);
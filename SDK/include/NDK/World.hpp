@@ -9,11 +9,18 @@
 
 #include <Nazara/Core/Bitset.hpp>
 #include <Nazara/Core/HandledObject.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/SerializationContext.hpp>
+#include <Nazara/Core/String.hpp>
+#include <NDK/ComponentSet.hpp>
+#include <NDK/ComponentView.hpp>
 #include <NDK/Entity.hpp>
 #include <NDK/EntityList.hpp>
+#include <NDK/Prefab.hpp>
 #include <NDK/System.hpp>
 #include <algorithm>
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace Ndk
@@ -38,16 +45,23 @@ namespace Ndk
 
 			void AddDefaultSystems();
 
+			inline void AddProfilerGpuTime(const Nz::String& section, Nz::UInt64 time);
+
 			inline BaseSystem& AddSystem(std::unique_ptr<BaseSystem>&& system);
 			template<typename SystemType, typename... Args> SystemType& AddSystem(Args&&... args);
 
 			const EntityHandle& CreateEntity();
-			inline EntityVector CreateEntities(unsigned int count);
+			EntityVector CreateEntities(unsigned int count);
 
 			void Clear() noexcept;
 			const EntityHandle& CloneEntity(EntityId id);
 
+			void DisableMetrics();
+			inline void DisableParallelUpdate();
 			inline void DisableProfiler();
+			void EnableLargePageStorage(bool enable = true);
+			void EnableMetrics(const Nz::String& worldName);
+			inline void EnableParallelUpdate(bool enable = true);
 			inline void EnableProfiler(bool enable = true);
 
 			template<typename F> void ForEachSystem(const F& iterationFunc);
@@ -55,6 +69,9 @@ namespace Ndk
 
 			inline const EntityHandle& GetEntity(EntityId id);
 			inline const EntityList& GetEntities() const;
+			inline float GetFixedUpdateRate() const;
+			inline float GetInterpolationFactor() const;
+			inline unsigned int GetMaximumFixedUpdateCount() const;
 			inline const ProfilerData& GetProfilerData() const;
 			inline BaseSystem& GetSystem(SystemIndex index);
 			inline const BaseSystem& GetSystem(SystemIndex index) const;
@@ -64,13 +81,22 @@ namespace Ndk
 			inline bool HasSystem(SystemIndex index) const;
 			template<typename SystemType> bool HasSystem() const;
 
+			const EntityHandle& Instantiate(const Prefab& prefab);
+			EntityVector Instantiate(const Prefab& prefab, unsigned int count);
+
 			inline void KillEntity(Entity* entity);
 			inline void KillEntities(const EntityVector& list);
 
 			inline bool IsEntityValid(const Entity* entity) const;
 			inline bool IsEntityIdValid(EntityId id) const;
+			inline bool IsFixedUpdateEnabled() const;
+			inline bool IsLargePageStorageEnabled() const;
+			inline bool IsMetricsEnabled() const;
+			inline bool IsParallelUpdateEnabled() const;
 			inline bool IsProfilerEnabled() const;
 
+			bool LoadSnapshot(Nz::SerializationContext& context, EntityVector* loadedEntities = nullptr);
+
 			void Refresh();
 
 			inline void RemoveAllSystems();
@@ -78,23 +104,53 @@ namespace Ndk
 			template<typename SystemType> void RemoveSystem();
 			inline void ResetProfiler();
 
+			bool SaveSnapshot(Nz::SerializationContext& context) const;
+
+			inline void SetFixedUpdateRate(float updatePerSecond);
+			inline void SetMaximumFixedUpdateCount(unsigned int updateCount);
+
 			void Update(float elapsedTime);
 
+			template<typename... ComponentTypes> ComponentView<ComponentTypes...> View();
+
 			World& operator=(const World&) = delete;
 			inline World& operator=(World&& world) noexcept;
 
 			struct ProfilerData
 			{
 				Nz::UInt64 refreshTime = 0;
+				std::vector<std::pair<Nz::String, Nz::UInt64>> gpuTime; //< Filled by the systems rendering through AddProfilerGpuTime
 				std::vector<Nz::UInt64> updateTime;
 				std::size_t updateCount = 0;
 			};
 
 		private:
+			struct EntityBlock;
+			struct MetricIds;
+			struct PrefabBatch;
+			struct SystemFilter;
+
+			void AddPrefabComponents(Entity* entity, const Prefab& prefab);
+
+			EntityBlock* AllocateEntityBlock(std::size_t expectedCount);
+
+			const ComponentSet& GetComponentSet(ComponentIndex index);
+
 			inline void Invalidate();
 			inline void Invalidate(EntityId id);
 			inline void InvalidateSystemOrder();
+
+			inline void NotifyComponentAddition(EntityId id, ComponentIndex index, BaseComponent* component);
+			inline void NotifyComponentRemoval(EntityId id, ComponentIndex index);
+
 			void ReorderSystems();
+			EntityBlock* ReuseEntityBlock(EntityId id);
+
+			void SaveNodeStates();
+
+			void UpdateMetrics(Nz::UInt64 updateTime);
+			void UpdateSystem(BaseSystem* system, float elapsedTime);
+			void UpdateSystems(float elapsedTime, bool fixedStep);
 
 			struct EntityBlock
 			{
@@ -110,18 +166,57 @@ namespace Ndk
 				EntityHandle handle;
 			};
 
+			struct MetricIds
+			{
+				Nz::String labels;
+				std::vector<Nz::UInt32> systemEntities; //< By system index
+				Nz::UInt32 entities;
+				Nz::UInt32 updateTime;
+				Nz::UInt32 updates;
+			};
+
+			struct PrefabBatch
+			{
+				Nz::Bitset<> componentBits;
+				std::vector<EntityId> entities;
+			};
+
+			struct SystemFilter
+			{
+				Nz::Bitset<> componentBits;
+				Nz::Bitset<> systems; //< Indices in m_orderedSystems of the systems filtering these components
+			};
+
+			std::vector<std::unique_ptr<ComponentSet>> m_componentSets;
 			std::vector<std::unique_ptr<BaseSystem>> m_systems;
 			std::vector<BaseSystem*> m_orderedSystems;
+			std::vector<std::vector<BaseSystem*>> m_systemStages;
+			std::vector<BaseSystem*> m_updatedSystems;
 			std::vector<EntityBlock> m_entities;
 			std::vector<EntityBlock*> m_entityBlocks;
-			std::vector<std::unique_ptr<EntityBlock>> m_waitingEntities;
+			std::vector<std::vector<EntityBlock>> m_waitingEntities;
+			std::vector<PrefabBatch> m_prefabBatches;
+			std::vector<SystemFilter> m_refreshFilters;
+			std::vector<std::pair<Entity*, std::size_t>> m_refreshedEntities; //< Dirty entities with their filter index
+			std::vector<Entity*> m_refreshAddedEntities;
+			std::vector<Entity*> m_refreshRemovedEntities;
+			std::vector<Entity*> m_refreshValidatedEntities;
+			std::unique_ptr<MetricIds> m_metricIds;
 			EntityList m_aliveEntities;
 			ProfilerData m_profilerData;
 			Nz::Bitset<Nz::UInt64> m_dirtyEntities;
 			Nz::Bitset<Nz::UInt64> m_freeEntityIds;
 			Nz::Bitset<Nz::UInt64> m_killedEntities;
+			Nz::Mutex m_componentSetMutex;
 			bool m_orderedSystemsUpdated;
+			bool m_isParallelUpdateEnabled;
+			bool m_isUpdatingConcurrently;
 			bool m_isProfilerEnabled;
+			bool m_isLargePageStorageEnabled;
+			float m_fixedUpdateCounter;
+			float m_fixedUpdateStep;
+			float m_interpolationFactor;
+			unsigned int m_maxFixedUpdateCount;
 	};
 }
 
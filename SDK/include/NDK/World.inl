@@ -16,7 +16,14 @@ namespace Ndk
 
 	inline World::World(bool addDefaultSystems) :
 	m_orderedSystemsUpdated(false),
-	m_isProfilerEnabled(false)
+	m_isParallelUpdateEnabled(false),
+	m_isUpdatingConcurrently(false),
+	m_isProfilerEnabled(false),
+	m_isLargePageStorageEnabled(false),
+	m_fixedUpdateCounter(0.f),
+	m_fixedUpdateStep(0.f),
+	m_interpolationFactor(0.f),
+	m_maxFixedUpdateCount(5)
 	{
 		if (addDefaultSystems)
 			AddDefaultSystems();
@@ -34,6 +41,33 @@ namespace Ndk
 		operator=(std::move(world));
 	}
 
+	/*!
+	* \brief Adds GPU time to a section of the profiler data
+	*
+	* Render systems call this with the GPU time of their render passes, once the GPU is done with them.
+	*
+	* \param section Name of the section
+	* \param time GPU time to add, in microseconds
+	*
+	* \remark Does nothing if the profiler is disabled
+	*/
+	inline void World::AddProfilerGpuTime(const Nz::String& section, Nz::UInt64 time)
+	{
+		if (!m_isProfilerEnabled)
+			return;
+
+		for (auto& pair : m_profilerData.gpuTime)
+		{
+			if (pair.first == section)
+			{
+				pair.second += time;
+				return;
+			}
+		}
+
+		m_profilerData.gpuTime.emplace_back(section, time);
+	}
+
 	/*!
 	* \brief Adds a system to the world
 	* \return A reference to the newly created system
@@ -82,20 +116,15 @@ namespace Ndk
 	}
 
 	/*!
-	* \brief Creates multiple entities in the world
-	* \return The set of entities created
+	* \brief Disables the parallel update of systems
+	*
+	* This is just a shortcut to EnableParallelUpdate(false)
 	*
-	* \param count Number of entities to create
+	* \see EnableParallelUpdate
 	*/
-	inline World::EntityVector World::CreateEntities(unsigned int count)
+	inline void World::DisableParallelUpdate()
 	{
-		EntityVector list;
-		list.reserve(count);
-
-		for (unsigned int i = 0; i < count; ++i)
-			list.emplace_back(CreateEntity());
-
-		return list;
+		EnableParallelUpdate(false);
 	}
 
 	/*!
@@ -112,6 +141,27 @@ namespace Ndk
 		EnableProfiler(false);
 	}
 
+	/*!
+	* \brief Enables/Disables the parallel update of systems
+	*
+	* When enabled, Update groups systems in stages: two systems are put in different stages (respecting their update order) only if they conflict,
+	* which means one of them writes a component the other one reads or writes, or one of them did not declare its component access.
+	* Systems of a same stage are updated concurrently using the TaskScheduler, stages are updated one after another.
+	*
+	* This is disabled by default, as systems running concurrently must only touch the components they declared and must not
+	* create or kill entities, nor add or remove components. Systems which did not declare their component access are always updated
+	* alone, from the thread calling Update.
+	*
+	* \param enable Should systems be updated in parallel
+	*
+	* \see BaseSystem::Reads
+	* \see BaseSystem::Writes
+	*/
+	inline void World::EnableParallelUpdate(bool enable)
+	{
+		m_isParallelUpdateEnabled = enable;
+	}
+
 	/*!
 	* \brief Enables/Disables the internal profiler
 	*
@@ -196,6 +246,39 @@ namespace Ndk
 		return m_aliveEntities;
 	}
 
+	/*!
+	* \brief Gets the rate of the fixed simulation steps
+	* \return Number of fixed updates per second, zero if the fixed update is disabled
+	*
+	* \see SetFixedUpdateRate
+	*/
+	inline float World::GetFixedUpdateRate() const
+	{
+		return (m_fixedUpdateStep > 0.f) ? 1.f / m_fixedUpdateStep : 0.f;
+	}
+
+	/*!
+	* \brief Gets the position of the current frame between the two last fixed updates
+	* \return Interpolation factor in [0, 1[, used to render interpolated nodes
+	*
+	* \see SetFixedUpdateRate
+	*/
+	inline float World::GetInterpolationFactor() const
+	{
+		return m_interpolationFactor;
+	}
+
+	/*!
+	* \brief Gets the maximum number of fixed updates run by a call to Update
+	* \return Maximum fixed update count
+	*
+	* \see SetMaximumFixedUpdateCount
+	*/
+	inline unsigned int World::GetMaximumFixedUpdateCount() const
+	{
+		return m_maxFixedUpdateCount;
+	}
+
 	/*!
 	* \brief Gets the latest profiler data
 	* \return A constant reference to the profiler data
@@ -320,8 +403,15 @@ namespace Ndk
 	*/
 	inline void World::KillEntities(const EntityVector& list)
 	{
+		// Size the killed entity bitset once for the whole batch
+		if (m_killedEntities.GetSize() < m_entityBlocks.size())
+			m_killedEntities.Resize(m_entityBlocks.size(), false);
+
 		for (const EntityHandle& entity : list)
-			KillEntity(entity);
+		{
+			if (IsEntityValid(entity))
+				m_killedEntities.Set(entity->GetId(), true);
+		}
 	}
 
 	/*!
@@ -347,6 +437,28 @@ namespace Ndk
 		return id < m_entityBlocks.size() && m_entityBlocks[id]->entity.IsValid();
 	}
 
+	/*!
+	* \brief Checks whether or not systems are updated in parallel
+	* \return true If it is the case
+	*
+	* \see EnableParallelUpdate
+	*/
+	inline bool World::IsParallelUpdateEnabled() const
+	{
+		return m_isParallelUpdateEnabled;
+	}
+
+	/*!
+	* \brief Checks whether or not the world runs fixed simulation steps
+	* \return true If it is the case
+	*
+	* \see SetFixedUpdateRate
+	*/
+	inline bool World::IsFixedUpdateEnabled() const
+	{
+		return m_fixedUpdateStep > 0.f;
+	}
+
 	/*!
 	* \brief Checks whether or not the profiler is enabled
 	* \return true If it is the case
@@ -358,6 +470,28 @@ namespace Ndk
 		return m_isProfilerEnabled;
 	}
 
+	/*!
+	* \brief Checks whether or not the component sets of the world are allocated in large pages
+	* \return true If it is the case
+	*
+	* \see EnableLargePageStorage
+	*/
+	inline bool World::IsLargePageStorageEnabled() const
+	{
+		return m_isLargePageStorageEnabled;
+	}
+
+	/*!
+	* \brief Checks whether or not the world updates its metrics
+	* \return true If it is the case
+	*
+	* \see EnableMetrics
+	*/
+	inline bool World::IsMetricsEnabled() const
+	{
+		return m_metricIds != nullptr;
+	}
+
 	/*!
 	* \brief Removes each system from the world
 	*/
@@ -397,6 +531,9 @@ namespace Ndk
 		m_profilerData.refreshTime = 0;
 		m_profilerData.updateCount = 0;
 		std::fill(m_profilerData.updateTime.begin(), m_profilerData.updateTime.end(), 0);
+
+		for (auto& pair : m_profilerData.gpuTime)
+			pair.second = 0;
 	}
 
 	/*!
@@ -411,6 +548,58 @@ namespace Ndk
 		RemoveSystem(index);
 	}
 
+	/*!
+	* \brief Sets the rate of the fixed simulation steps
+	*
+	* When enabled, Update accumulates the elapsed time and updates the systems with fixed step enabled (simulation) once per elapsed step,
+	* then updates the other systems (rendering, audio, ...) once with the elapsed time.
+	* Before each step, the interpolated node components save their state; rendering them between their saved and current states
+	* (according to GetInterpolationFactor) makes the simulation look smooth at any framerate, one step behind.
+	*
+	* \param updatePerSecond Number of fixed updates per second, zero to disable the fixed update (every system being updated once per Update)
+	*
+	* \see BaseSystem::EnableFixedStep, NodeComponent::EnableInterpolation
+	*/
+	inline void World::SetFixedUpdateRate(float updatePerSecond)
+	{
+		m_fixedUpdateStep = (updatePerSecond > 0.f) ? 1.f / updatePerSecond : 0.f;
+		m_fixedUpdateCounter = 0.f;
+		m_interpolationFactor = 0.f;
+	}
+
+	/*!
+	* \brief Sets the maximum number of fixed updates run by a call to Update
+	*
+	* If the simulation can't keep up with the elapsed time, the time left after this many steps is dropped, slowing the simulation down
+	* instead of making each frame longer than the previous one.
+	*
+	* \param updateCount Maximum fixed update count, must be over zero
+	*/
+	inline void World::SetMaximumFixedUpdateCount(unsigned int updateCount)
+	{
+		NazaraAssert(updateCount > 0, "Update count must be over zero");
+
+		m_maxFixedUpdateCount = updateCount;
+	}
+
+	/*!
+	* \brief Gets a view over every entity owning all of the given component types
+	* \return A view iterating linearly over the packed components
+	*
+	* Components of each type are tracked in a dense set, built on the first view asking for this type and then kept
+	* up to date as components are added to or destroyed from entities, worlds never viewed don't pay for this.
+	*
+	* \remark Components removed from an entity stay part of the view until the world is refreshed, as they are only destroyed then
+	* \remark The view is invalidated by any component addition or destruction in this world
+	* \remark Views can be requested from systems updated in parallel
+	*/
+	template<typename... ComponentTypes>
+	ComponentView<ComponentTypes...> World::View()
+	{
+		typename ComponentView<ComponentTypes...>::SetArray sets = { { &GetComponentSet(GetComponentIndex<ComponentTypes>())... } };
+		return ComponentView<ComponentTypes...>(sets);
+	}
+
 	/*!
 	* \brief Moves a world into another world object
 	* \return A reference to the object
@@ -418,23 +607,36 @@ namespace Ndk
 
 	inline World& World::operator=(World&& world) noexcept
 	{
-		m_aliveEntities         = std::move(world.m_aliveEntities);
-		m_dirtyEntities         = std::move(world.m_dirtyEntities);
-		m_entityBlocks          = std::move(world.m_entityBlocks);
-		m_freeEntityIds         = std::move(world.m_freeEntityIds);
-		m_killedEntities        = std::move(world.m_killedEntities);
-		m_orderedSystems        = std::move(world.m_orderedSystems);
-		m_orderedSystemsUpdated = world.m_orderedSystemsUpdated;
-		m_profilerData          = std::move(world.m_profilerData);
-		m_isProfilerEnabled     = world.m_isProfilerEnabled;
+		m_aliveEntities           = std::move(world.m_aliveEntities);
+		m_componentSets           = std::move(world.m_componentSets);
+		m_dirtyEntities           = std::move(world.m_dirtyEntities);
+		m_entityBlocks            = std::move(world.m_entityBlocks);
+		m_freeEntityIds           = std::move(world.m_freeEntityIds);
+		m_killedEntities          = std::move(world.m_killedEntities);
+		m_metricIds               = std::move(world.m_metricIds);
+		m_orderedSystems          = std::move(world.m_orderedSystems);
+		m_orderedSystemsUpdated   = world.m_orderedSystemsUpdated;
+		m_profilerData            = std::move(world.m_profilerData);
+		m_isParallelUpdateEnabled = world.m_isParallelUpdateEnabled;
+		m_isProfilerEnabled       = world.m_isProfilerEnabled;
+		m_isLargePageStorageEnabled = world.m_isLargePageStorageEnabled;
+		m_isUpdatingConcurrently  = false;
+		m_systemStages            = std::move(world.m_systemStages);
+		m_fixedUpdateCounter      = world.m_fixedUpdateCounter;
+		m_fixedUpdateStep         = world.m_fixedUpdateStep;
+		m_interpolationFactor     = world.m_interpolationFactor;
+		m_maxFixedUpdateCount     = world.m_maxFixedUpdateCount;
 
 		m_entities = std::move(world.m_entities);
 		for (EntityBlock& block : m_entities)
 			block.entity.SetWorld(this);
 
 		m_waitingEntities = std::move(world.m_waitingEntities);
-		for (auto& blockPtr : m_waitingEntities)
-			blockPtr->entity.SetWorld(this);
+		for (auto& chunk : m_waitingEntities)
+		{
+			for (EntityBlock& block : chunk)
+				block.entity.SetWorld(this);
+		}
 
 		m_systems = std::move(world.m_systems);
 		for (const auto& systemPtr : m_systems)
@@ -459,4 +661,16 @@ namespace Ndk
 	{
 		m_orderedSystemsUpdated = false;
 	}
+
+	inline void World::NotifyComponentAddition(EntityId id, ComponentIndex index, BaseComponent* component)
+	{
+		if (index < m_componentSets.size() && m_componentSets[index])
+			m_componentSets[index]->Insert(id, component);
+	}
+
+	inline void World::NotifyComponentRemoval(EntityId id, ComponentIndex index)
+	{
+		if (index < m_componentSets.size() && m_componentSets[index])
+			m_componentSets[index]->Remove(id);
+	}
 }
@@ -107,6 +107,8 @@ namespace Ndk
 		if (m_shouldQuit)
 			return false;
 
+		m_framePacer.Wait();
+
 		m_updateTime = m_updateClock.Restart() / 1'000'000.f;
 
 		for (World& world : m_worlds)
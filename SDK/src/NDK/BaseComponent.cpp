@@ -83,6 +83,80 @@ namespace Ndk
 	{
 	}
 
+	/*!
+	* \brief Registers the serialization functions of a component
+	*
+	* \param index Index of the component
+	* \param factory Function creating a default component, for the unserializer to fill
+	* \param serializer Function writing a component
+	* \param unserializer Function reading what the serializer wrote into a component
+	*
+	* \see Component::RegisterSerializer
+	*/
+	void BaseComponent::RegisterSerializer(ComponentIndex index, Factory factory, Serializer serializer, Unserializer unserializer)
+	{
+		NazaraAssert(index < s_entries.size(), "Invalid component index");
+
+		ComponentEntry& entry = s_entries[index];
+		entry.factory = std::move(factory);
+		entry.serializer = std::move(serializer);
+		entry.unserializer = std::move(unserializer);
+	}
+
+	/*!
+	* \brief Serializes a component with the serializer registered for its type
+	* \return true If serialization succeeded
+	*
+	* \param context Context of the serialization
+	* \param component Component to serialize
+	*
+	* \remark Produces a NazaraAssert if the component is not serializable
+	*/
+	bool BaseComponent::SerializeComponent(Nz::SerializationContext& context, const BaseComponent& component)
+	{
+		NazaraAssert(IsSerializable(component.GetIndex()), "Component is not serializable");
+
+		return s_entries[component.GetIndex()].serializer(context, component);
+	}
+
+	/*!
+	* \brief Creates a component from what its serializer wrote
+	* \return The component, nullptr if unserialization failed
+	*
+	* \param context Context of the unserialization
+	* \param index Index of the component
+	*
+	* \remark Produces a NazaraAssert if the component is not serializable
+	*/
+	std::unique_ptr<BaseComponent> BaseComponent::UnserializeComponent(Nz::SerializationContext& context, ComponentIndex index)
+	{
+		NazaraAssert(IsSerializable(index), "Component is not serializable");
+
+		const ComponentEntry& entry = s_entries[index];
+
+		std::unique_ptr<BaseComponent> component(entry.factory());
+		if (!entry.unserializer(context, *component))
+			return nullptr;
+
+		return component;
+	}
+
+	/*!
+	* \brief Reads what the serializer wrote into an existing component
+	* \return true If unserialization succeeded
+	*
+	* \param context Context of the unserialization
+	* \param component Component to update, keeping its entity
+	*
+	* \remark Produces a NazaraAssert if the component is not serializable
+	*/
+	bool BaseComponent::UnserializeComponent(Nz::SerializationContext& context, BaseComponent& component)
+	{
+		NazaraAssert(IsSerializable(component.GetIndex()), "Component is not serializable");
+
+		return s_entries[component.GetIndex()].unserializer(context, component);
+	}
+
 	std::vector<BaseComponent::ComponentEntry> BaseComponent::s_entries;
 	std::unordered_map<ComponentId, ComponentIndex> BaseComponent::s_idToIndex;
 }
@@ -25,6 +25,27 @@ namespace Ndk
 			entity->UnregisterSystem(m_systemIndex);
 	}
 
+	/*!
+	* \brief Checks whether this system and another one must not be updated at the same time
+	* \return true If one of the systems did not declare its component access or if one writes a component the other accesses
+	*
+	* \param system Other system
+	*
+	* \see Reads
+	* \see Writes
+	*/
+
+	bool BaseSystem::ConflictsWith(const BaseSystem& system) const
+	{
+		if (!m_componentAccessDeclared || !system.m_componentAccessDeclared)
+			return true;
+
+		if (m_writtenComponents.Intersects(system.m_writtenComponents))
+			return true;
+
+		return m_writtenComponents.Intersects(system.m_readComponents) || m_readComponents.Intersects(system.m_writtenComponents);
+	}
+
 	/*!
 	* \brief Checks whether the key of the entity matches the lock of the system
 	* \return true If it is the case
@@ -37,14 +58,22 @@ namespace Ndk
 		if (!entity)
 			return false;
 
-		const Nz::Bitset<>& components = entity->GetComponentBits();
+		return Filters(entity->GetComponentBits());
+	}
+
+	/*!
+	* \brief Checks whether a set of components matches the lock of the system
+	* \return true If it is the case
+	*
+	* \param components Bits of the components
+	*/
 
-		m_filterResult.PerformsAND(m_requiredComponents, components);
-		if (m_filterResult !=  m_requiredComponents)
+	bool BaseSystem::Filters(const Nz::Bitset<>& components) const
+	{
+		if (!m_requiredComponents.IsSubsetOf(components))
 			return false; // At least one required component is not available
 
-		m_filterResult.PerformsAND(m_excludedComponents, components);
-		if (m_filterResult.TestAny())
+		if (m_excludedComponents.Intersects(components))
 			return false; // At least one excluded component is available
 
 		// If we have a list of needed components
@@ -57,6 +86,47 @@ namespace Ndk
 		return true;
 	}
 
+	/*!
+	* \brief Sets the number of updates between two iterations over an entity by ForEachDueEntity
+	*
+	* Distant or off-screen entities may be given a greater interval so the systems do a fraction of the work for them.
+	* Entities sharing an interval are spread between its buckets in a round-robin fashion, so the cost of each update stays even.
+	* The interval is forgotten when the entity leaves the system.
+	*
+	* \param entity Pointer to the entity
+	* \param interval Update interval, 1 to iterate over the entity every update
+	*
+	* \remark Produces a NazaraAssert if interval is zero
+	* \remark Must not be called while the system iterates over its entities
+	*
+	* \see ForEachDueEntity
+	*/
+	void BaseSystem::SetEntityUpdateInterval(const Entity* entity, unsigned int interval)
+	{
+		NazaraAssert(entity, "Invalid entity");
+		NazaraAssert(interval > 0, "Update interval must be positive");
+
+		EntityId id = entity->GetId();
+		if (id >= m_entityUpdateBuckets.size())
+		{
+			if (interval == 1)
+				return;
+
+			m_entityUpdateBuckets.resize(id + 1);
+		}
+
+		EntityUpdateBucket& updateBucket = m_entityUpdateBuckets[id];
+		if (updateBucket.interval == interval)
+			return;
+
+		// Time accumulates from now on, or keeps accumulating if the entity already had an interval
+		if (updateBucket.interval == 0)
+			updateBucket.lastUpdateTime = m_entityUpdateTime;
+
+		updateBucket.bucket = m_nextEntityBucket++ % interval;
+		updateBucket.interval = interval;
+	}
+
 	/*!
 	* \brief Sets the update order of this system
 	*
@@ -77,6 +147,65 @@ namespace Ndk
 			m_world->InvalidateSystemOrder();
 	}
 
+	/*!
+	* \brief Checks whether ParallelForEachEntity may use TaskScheduler workers
+	* \return true If parallel iteration is enabled and the system is not updated from a TaskScheduler task
+	*/
+
+	bool BaseSystem::CanIterateInParallel() const
+	{
+		return m_parallelIterationEnabled && !(m_world && m_world->m_isUpdatingConcurrently);
+	}
+
+	const EntityHandle& BaseSystem::GetEntity(EntityId id) const
+	{
+		return m_world->GetEntity(id);
+	}
+
+	/*!
+	* \brief Operation to perform when entities are added to the system at once
+	*
+	* The world adds entities in batches when refreshing, overriding this allows a system to handle them in bulk.
+	* By default, OnEntityAdded is called for every entity.
+	*
+	* \param entities Entities added to the system
+	*/
+
+	void BaseSystem::OnEntitiesAdded(const std::vector<Entity*>& entities)
+	{
+		for (Entity* entity : entities)
+			OnEntityAdded(entity);
+	}
+
+	/*!
+	* \brief Operation to perform when entities are removed from the system at once
+	*
+	* By default, OnEntityRemoved is called for every entity.
+	*
+	* \param entities Entities removed from the system
+	*/
+
+	void BaseSystem::OnEntitiesRemoved(const std::vector<Entity*>& entities)
+	{
+		for (Entity* entity : entities)
+			OnEntityRemoved(entity);
+	}
+
+	/*!
+	* \brief Operation to perform when entities are validated for the system at once
+	*
+	* By default, OnEntityValidation is called for every entity.
+	*
+	* \param entities Entities validated
+	* \param justAdded Are the entities newly added
+	*/
+
+	void BaseSystem::OnEntitiesValidation(const std::vector<Entity*>& entities, bool justAdded)
+	{
+		for (Entity* entity : entities)
+			OnEntityValidation(entity, justAdded);
+	}
+
 	/*!
 	* \brief Operation to perform when entity is added to the system
 	*
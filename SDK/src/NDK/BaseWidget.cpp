@@ -79,7 +79,7 @@ namespace Ndk
 		{
 			m_backgroundSprite = Nz::Sprite::New();
 			m_backgroundSprite->SetColor(m_backgroundColor);
-			m_backgroundSprite->SetMaterial(Nz::Material::New((m_backgroundColor.IsOpaque()) ? "Basic2D" : "Translucent2D")); //< TODO: Use a shared material instead of creating one everytime
+			m_backgroundSprite->SetMaterial((m_backgroundColor.IsOpaque()) ? GetOpaqueMaterial() : GetTranslucentMaterial());
 
 			m_backgroundEntity = CreateEntity(false);
 			m_backgroundEntity->AddComponent<GraphicsComponent>().Attach(m_backgroundSprite, -1);
@@ -106,6 +106,20 @@ namespace Ndk
 		return m_canvas->IsKeyboardOwner(m_canvasIndex);
 	}
 
+	/*!
+	* \brief Initializes the materials shared by the widgets
+	* \return true If successful
+	*
+	* \remark This is called by Sdk::Initialize
+	*/
+	bool BaseWidget::Initialize()
+	{
+		s_opaqueMaterial = Nz::Material::New("Basic2D");
+		s_translucentMaterial = Nz::Material::New("Translucent2D");
+
+		return true;
+	}
+
 	void BaseWidget::SetBackgroundColor(const Nz::Color& color)
 	{
 		m_backgroundColor = color;
@@ -113,7 +127,7 @@ namespace Ndk
 		if (m_backgroundSprite)
 		{
 			m_backgroundSprite->SetColor(color);
-			m_backgroundSprite->GetMaterial()->Configure((color.IsOpaque()) ? "Basic2D" : "Translucent2D"); //< Our sprite has its own material (see EnableBackground)
+			m_backgroundSprite->SetMaterial((color.IsOpaque()) ? GetOpaqueMaterial() : GetTranslucentMaterial(), false);
 		}
 	}
 
@@ -155,6 +169,17 @@ namespace Ndk
 		}
 	}
 
+	/*!
+	* \brief Releases the materials shared by the widgets
+	*
+	* \remark This is called by Sdk::Uninitialize
+	*/
+	void BaseWidget::Uninitialize()
+	{
+		s_opaqueMaterial.Reset();
+		s_translucentMaterial.Reset();
+	}
+
 	const Ndk::EntityHandle& BaseWidget::CreateEntity(bool isContentEntity)
 	{
 		const EntityHandle& newEntity = m_world->CreateEntity();
@@ -233,6 +258,10 @@ namespace Ndk
 	{
 	}
 
+	void BaseWidget::OnMouseWheelMoved(float /*delta*/)
+	{
+	}
+
 	void BaseWidget::OnParentResized(const Nz::Vector2f& /*newSize*/)
 	{
 	}
@@ -294,4 +323,7 @@ namespace Ndk
 				entity->GetComponent<GraphicsComponent>().SetScissorRect((widgetEntity.isContent) ? contentBounds : fullBounds);
 		}
 	}
+
+	Nz::MaterialRef BaseWidget::s_opaqueMaterial;
+	Nz::MaterialRef BaseWidget::s_translucentMaterial;
 }
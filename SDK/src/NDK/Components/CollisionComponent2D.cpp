@@ -77,6 +77,9 @@ namespace Ndk
 
 	void CollisionComponent2D::OnAttached()
 	{
+		if (m_entity->HasComponent<NodeComponent>())
+			m_nodeInvalidationSlot.Connect(m_entity->GetComponent<NodeComponent>().OnNodeInvalidation, this, &CollisionComponent2D::OnNodeInvalidated);
+
 		if (!m_entity->HasComponent<PhysicsComponent2D>())
 			InitializeStaticBody();
 	}
@@ -89,7 +92,9 @@ namespace Ndk
 
 	void CollisionComponent2D::OnComponentAttached(BaseComponent& component)
 	{
-		if (IsComponent<PhysicsComponent2D>(component))
+		if (IsComponent<NodeComponent>(component))
+			m_nodeInvalidationSlot.Connect(static_cast<NodeComponent&>(component).OnNodeInvalidation, this, &CollisionComponent2D::OnNodeInvalidated);
+		else if (IsComponent<PhysicsComponent2D>(component))
 			m_staticBody.reset();
 	}
 
@@ -101,7 +106,9 @@ namespace Ndk
 
 	void CollisionComponent2D::OnComponentDetached(BaseComponent& component)
 	{
-		if (IsComponent<PhysicsComponent2D>(component))
+		if (IsComponent<NodeComponent>(component))
+			m_nodeInvalidationSlot.Disconnect();
+		else if (IsComponent<PhysicsComponent2D>(component))
 			InitializeStaticBody();
 	}
 
@@ -111,8 +118,29 @@ namespace Ndk
 
 	void CollisionComponent2D::OnDetached()
 	{
+		m_nodeInvalidationSlot.Disconnect();
 		m_staticBody.reset();
 	}
 
+	/*!
+	* \brief Operation to perform when the node of the entity is invalidated
+	*
+	* The physics system only synchronizes the static bodies whose node moved
+	*
+	* \param node Invalidated node
+	*/
+
+	void CollisionComponent2D::OnNodeInvalidated(const Nz::Node* node)
+	{
+		NazaraUnused(node);
+
+		if (m_staticBody)
+		{
+			World* entityWorld = m_entity->GetWorld();
+			if (entityWorld->HasSystem<PhysicsSystem2D>())
+				entityWorld->GetSystem<PhysicsSystem2D>().m_movedStaticObjects.Insert(m_entity);
+		}
+	}
+
 	ComponentIndex CollisionComponent2D::componentIndex;
 }
@@ -5,6 +5,7 @@
 #include <NDK/Components/CollisionComponent3D.hpp>
 #include <Nazara/Physics3D/RigidBody3D.hpp>
 #include <NDK/World.hpp>
+#include <NDK/Components/NodeComponent.hpp>
 #include <NDK/Components/PhysicsComponent3D.hpp>
 #include <NDK/Systems/PhysicsSystem3D.hpp>
 
@@ -68,6 +69,9 @@ namespace Ndk
 
 	void CollisionComponent3D::OnAttached()
 	{
+		if (m_entity->HasComponent<NodeComponent>())
+			m_nodeInvalidationSlot.Connect(m_entity->GetComponent<NodeComponent>().OnNodeInvalidation, this, &CollisionComponent3D::OnNodeInvalidated);
+
 		if (!m_entity->HasComponent<PhysicsComponent3D>())
 			InitializeStaticBody();
 	}
@@ -80,7 +84,9 @@ namespace Ndk
 
 	void CollisionComponent3D::OnComponentAttached(BaseComponent& component)
 	{
-		if (IsComponent<PhysicsComponent3D>(component))
+		if (IsComponent<NodeComponent>(component))
+			m_nodeInvalidationSlot.Connect(static_cast<NodeComponent&>(component).OnNodeInvalidation, this, &CollisionComponent3D::OnNodeInvalidated);
+		else if (IsComponent<PhysicsComponent3D>(component))
 			m_staticBody.reset();
 	}
 
@@ -92,7 +98,9 @@ namespace Ndk
 
 	void CollisionComponent3D::OnComponentDetached(BaseComponent& component)
 	{
-		if (IsComponent<PhysicsComponent3D>(component))
+		if (IsComponent<NodeComponent>(component))
+			m_nodeInvalidationSlot.Disconnect();
+		else if (IsComponent<PhysicsComponent3D>(component))
 			InitializeStaticBody();
 	}
 
@@ -102,6 +110,7 @@ namespace Ndk
 
 	void CollisionComponent3D::OnDetached()
 	{
+		m_nodeInvalidationSlot.Disconnect();
 		m_staticBody.reset();
 	}
 
@@ -117,5 +126,25 @@ namespace Ndk
 			m_staticBody->EnableSimulation(true);
 	}
 
+	/*!
+	* \brief Operation to perform when the node of the entity is invalidated
+	*
+	* The physics system only synchronizes the static bodies whose node moved
+	*
+	* \param node Invalidated node
+	*/
+
+	void CollisionComponent3D::OnNodeInvalidated(const Nz::Node* node)
+	{
+		NazaraUnused(node);
+
+		if (m_staticBody)
+		{
+			World* entityWorld = m_entity->GetWorld();
+			if (entityWorld->HasSystem<PhysicsSystem3D>())
+				entityWorld->GetSystem<PhysicsSystem3D>().m_movedStaticObjects.Insert(m_entity);
+		}
+	}
+
 	ComponentIndex CollisionComponent3D::componentIndex;
 }
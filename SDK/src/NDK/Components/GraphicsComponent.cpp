@@ -6,6 +6,8 @@
 #include <NDK/World.hpp>
 #include <NDK/Systems/RenderSystem.hpp>
 #include <NDK/Components/NodeComponent.hpp>
+#include <algorithm>
+#include <cstring>
 
 namespace Ndk
 {
@@ -260,14 +262,13 @@ namespace Ndk
 	}
 
 	/*!
-	* \brief Updates the bounding volume
+	* \brief Computes the union of the bounding volumes of the renderables, adjusted by their local matrices
+	* \return Bounding volume of the renderables, before the transform of the entity is applied
 	*/
 
-	void GraphicsComponent::UpdateBoundingVolume() const
+	Nz::BoundingVolumef GraphicsComponent::ComputeLocalBoundingVolume() const
 	{
-		EnsureTransformMatrixUpdate();
-
-		m_boundingVolume.MakeNull();
+		Nz::BoundingVolumef localVolume = Nz::BoundingVolumef::Null();
 		for (const Renderable& r : m_renderables)
 		{
 			Nz::BoundingVolumef boundingVolume = r.renderable->GetBoundingVolume();
@@ -283,16 +284,92 @@ namespace Ndk
 				boundingVolume.Set(Nz::Boxf(newPos.x, newPos.y, newPos.z, newLengths.x, newLengths.y, newLengths.z));
 			}
 
-			m_boundingVolume.ExtendTo(boundingVolume);
+			localVolume.ExtendTo(boundingVolume);
 		}
 
-		RenderSystem& renderSystem = m_entity->GetWorld()->GetSystem<RenderSystem>();
+		return localVolume;
+	}
 
-		m_boundingVolume.Update(Nz::Matrix4f::ConcatenateAffine(renderSystem.GetCoordinateSystemMatrix(), m_transformMatrix));
+	/*!
+	* \brief Sets the world bounding volume, notifying the culling lists only if it changed
+	*
+	* \param boundingVolume New bounding volume of the entity
+	*/
+
+	void GraphicsComponent::SetBoundingVolume(const Nz::BoundingVolumef& boundingVolume) const
+	{
+		// Culling lists keep their own copy of the volume (corners included), updating it moves the entry in their tree
+		bool changed = (boundingVolume.extend != m_boundingVolume.extend);
+		if (!changed && boundingVolume.IsFinite())
+			changed = (std::memcmp(static_cast<const Nz::Vector3f*>(boundingVolume.obb), static_cast<const Nz::Vector3f*>(m_boundingVolume.obb), (Nz::BoxCorner_Max + 1) * sizeof(Nz::Vector3f)) != 0);
+
+		m_boundingVolume = boundingVolume;
 		m_boundingVolumeUpdated = true;
 
-		for (VolumeCullingEntry& entry : m_volumeCullingEntries)
-			entry.listEntry.UpdateVolume(m_boundingVolume);
+		if (changed)
+		{
+			for (VolumeCullingEntry& entry : m_volumeCullingEntries)
+				entry.listEntry.UpdateVolume(m_boundingVolume);
+		}
+	}
+
+	/*!
+	* \brief Updates the bounding volume
+	*
+	* \see RenderSystem, which updates the bounding volumes of every drawable at once
+	*/
+
+	void GraphicsComponent::UpdateBoundingVolume() const
+	{
+		EnsureTransformMatrixUpdate();
+
+		Nz::BoundingVolumef boundingVolume = ComputeLocalBoundingVolume();
+
+		RenderSystem& renderSystem = m_entity->GetWorld()->GetSystem<RenderSystem>();
+		boundingVolume.Update(Nz::Matrix4f::ConcatenateAffine(renderSystem.GetCoordinateSystemMatrix(), m_transformMatrix));
+
+		SetBoundingVolume(boundingVolume);
+	}
+
+	/*!
+	* \brief Selects the level of detail of the renderables, from the size of the entity on the screen of a viewer
+	* \return true If the level of a renderable changed, which requires the entity to be queued again
+	*
+	* \param viewer Viewer the entity is about to be drawn by
+	* \param residencyManager Optional manager the renderables request their streamed resources from, at the size of the entity on screen
+	*/
+
+	bool GraphicsComponent::UpdateLevelsOfDetail(const Nz::AbstractViewer& viewer, Nz::ResidencyManager* residencyManager) const
+	{
+		EnsureBoundingVolumeUpdate();
+
+		if (!m_boundingVolume.IsFinite())
+			return false;
+
+		// Height of the bounding sphere on screen, relative to the height of the viewport
+		const Nz::Boxf& aabb = m_boundingVolume.aabb;
+		float projectedSize = aabb.GetRadius() * viewer.GetProjectionMatrix().m22;
+		if (viewer.GetProjectionType() == Nz::ProjectionType_Perspective)
+			projectedSize /= std::max(viewer.GetEyePosition().Distance(aabb.GetCenter()), viewer.GetZNear());
+
+		RenderSystem& renderSystem = m_entity->GetWorld()->GetSystem<RenderSystem>();
+		Nz::Vector3f eyePosition = viewer.GetEyePosition();
+
+		bool levelChanged = false;
+		for (const Renderable& object : m_renderables)
+		{
+			// Impostors pick their frame from the eye position in the space of the renderable
+			if (!object.dataUpdated)
+				object.data.transformMatrix = Nz::Matrix4f::ConcatenateAffine(renderSystem.GetCoordinateSystemMatrix(), Nz::Matrix4f::ConcatenateAffine(object.data.localMatrix, m_transformMatrix));
+
+			if (object.renderable->UpdateLevelOfDetail(&object.data, projectedSize, eyePosition))
+				levelChanged = true;
+
+			if (residencyManager)
+				object.renderable->RequestResidency(*residencyManager, object.data, projectedSize * viewer.GetViewport().height);
+		}
+
+		return levelChanged;
 	}
 
 	/*!
@@ -305,7 +382,14 @@ namespace Ndk
 	{
 		NazaraAssert(m_entity && m_entity->HasComponent<NodeComponent>(), "GraphicsComponent requires NodeComponent");
 
-		m_transformMatrix = m_entity->GetComponent<NodeComponent>().GetTransformMatrix();
+		const NodeComponent& node = m_entity->GetComponent<NodeComponent>();
+
+		World* world = m_entity->GetWorld();
+		if (node.IsInterpolationEnabled() && world->IsFixedUpdateEnabled())
+			m_transformMatrix = node.GetInterpolatedTransformMatrix(world->GetInterpolationFactor());
+		else
+			m_transformMatrix = node.GetTransformMatrix();
+
 		m_transformMatrixUpdated = true;
 	}
 
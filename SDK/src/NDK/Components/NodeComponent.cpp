@@ -6,5 +6,81 @@
 
 namespace Ndk
 {
+	/*!
+	* \brief Gets the transform matrix between the saved and the current transformations of the node
+	* \return Interpolated transform matrix
+	*
+	* \param interpolation Interpolation factor, zero giving the saved transformation and one the current one
+	*
+	* \see EnableInterpolation
+	*/
+	Nz::Matrix4f NodeComponent::GetInterpolatedTransformMatrix(float interpolation) const
+	{
+		if (!m_interpolationEnabled || interpolation >= 1.f)
+			return GetTransformMatrix();
+
+		Nz::Vector3f position = Nz::Vector3f::Lerp(m_previousPosition, GetPosition(Nz::CoordSys_Global), interpolation);
+		Nz::Quaternionf rotation = Nz::Quaternionf::Slerp(m_previousRotation, GetRotation(Nz::CoordSys_Global), interpolation);
+		Nz::Vector3f scale = Nz::Vector3f::Lerp(m_previousScale, GetScale(Nz::CoordSys_Global), interpolation);
+
+		return Nz::Matrix4f::Transform(position, rotation, scale);
+	}
+
 	ComponentIndex NodeComponent::componentIndex;
+
+	/*!
+	* \brief Serializes a NodeComponent
+	* \return true if successfully serialized
+	*
+	* \param context Serialization context
+	* \param node Input node component
+	*
+	* \remark The global transformation is written, as the parent of the node isn't part of the component
+	*/
+	bool Serialize(Nz::SerializationContext& context, const NodeComponent& node, Nz::TypeTag<NodeComponent>)
+	{
+		if (!Nz::Serialize(context, node.GetPosition(Nz::CoordSys_Global)))
+			return false;
+
+		if (!Nz::Serialize(context, node.GetRotation(Nz::CoordSys_Global)))
+			return false;
+
+		if (!Nz::Serialize(context, node.GetScale(Nz::CoordSys_Global)))
+			return false;
+
+		return Nz::Serialize(context, node.IsInterpolationEnabled());
+	}
+
+	/*!
+	* \brief Unserializes a NodeComponent
+	* \return true if successfully unserialized
+	*
+	* \param context Serialization context
+	* \param node Output node component
+	*/
+	bool Unserialize(Nz::SerializationContext& context, NodeComponent* node, Nz::TypeTag<NodeComponent>)
+	{
+		Nz::Vector3f position;
+		if (!Nz::Unserialize(context, &position))
+			return false;
+
+		Nz::Quaternionf rotation;
+		if (!Nz::Unserialize(context, &rotation))
+			return false;
+
+		Nz::Vector3f scale;
+		if (!Nz::Unserialize(context, &scale))
+			return false;
+
+		bool interpolation;
+		if (!Nz::Unserialize(context, &interpolation))
+			return false;
+
+		node->SetPosition(position);
+		node->SetRotation(rotation);
+		node->SetScale(scale);
+		node->EnableInterpolation(interpolation);
+
+		return true;
+	}
 }
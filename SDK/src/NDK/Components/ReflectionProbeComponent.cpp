@@ -0,0 +1,116 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequisites.hpp
+
+#include <NDK/Components/ReflectionProbeComponent.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Utility/CubemapParams.hpp>
+#include <Nazara/Utility/Image.hpp>
+
+namespace Ndk
+{
+	/*!
+	* \ingroup NDK
+	* \class Ndk::ReflectionProbeComponent
+	* \brief NDK class that represents a cubemap of the scene around an entity, reflected by the objects close to it
+	*
+	* Probes are drawn by the RenderSystem from the position of their NodeComponent, a few faces per frame.
+	*
+	* \see RenderSystem::SetReflectionFaceBudget
+	*/
+
+	/*!
+	* \brief Creates the cubemap of the probe if needed
+	* \return true If the cubemap is valid
+	*/
+
+	bool ReflectionProbeComponent::EnsureTexture()
+	{
+		if (m_texture)
+			return true;
+
+		Nz::TextureRef texture = Nz::Texture::New();
+		if (!texture->Create(Nz::ImageType_Cubemap, Nz::PixelFormatType_RGBA8, m_size, m_size))
+		{
+			NazaraError("Failed to create reflection probe cubemap");
+			return false;
+		}
+
+		m_texture = std::move(texture);
+		return true;
+	}
+
+	/*!
+	* \brief Loads the cubemap from the cache file, if there is an up to date one
+	* \return true If the cubemap was loaded, the probe being ready
+	*/
+
+	bool ReflectionProbeComponent::LoadCache()
+	{
+		if (m_cacheFile.IsEmpty() || m_cacheOutdated || !Nz::File::Exists(m_cacheFile))
+			return false;
+
+		Nz::Image strip;
+		if (!strip.LoadFromFile(m_cacheFile) || strip.GetWidth() != m_size || strip.GetHeight() != m_size * 6)
+		{
+			NazaraWarning("Reflection probe cache " + m_cacheFile + " is invalid, the probe will be drawn again");
+			return false;
+		}
+
+		Nz::CubemapParams params;
+		params.faceSize = m_size;
+		params.rightPosition.Set(0, Nz::CubemapFace_PositiveX);
+		params.leftPosition.Set(0, Nz::CubemapFace_NegativeX);
+		params.upPosition.Set(0, Nz::CubemapFace_PositiveY);
+		params.downPosition.Set(0, Nz::CubemapFace_NegativeY);
+		params.forwardPosition.Set(0, Nz::CubemapFace_PositiveZ);
+		params.backPosition.Set(0, Nz::CubemapFace_NegativeZ);
+
+		Nz::TextureRef texture = Nz::Texture::New();
+		if (!texture->LoadCubemapFromImage(strip, false, params))
+		{
+			NazaraWarning("Failed to load reflection probe cache " + m_cacheFile);
+			return false;
+		}
+
+		m_texture = std::move(texture);
+		m_nextFace = 0;
+		m_ready = true;
+		m_upToDate = true;
+
+		return true;
+	}
+
+	/*!
+	* \brief Saves the cubemap to the cache file, as a vertical strip of its faces
+	* \return true If the cubemap was saved
+	*/
+
+	bool ReflectionProbeComponent::SaveCache()
+	{
+		if (m_cacheFile.IsEmpty() || !m_texture)
+			return false;
+
+		Nz::Image cubemap;
+		if (!m_texture->Download(&cubemap))
+		{
+			NazaraError("Failed to download reflection probe cubemap");
+			return false;
+		}
+
+		Nz::Image strip(Nz::ImageType_2D, cubemap.GetFormat(), m_size, m_size * 6);
+		for (unsigned int face = 0; face < 6; ++face)
+			strip.Copy(cubemap, Nz::Boxui(0, 0, face, m_size, m_size, 1), Nz::Vector3ui(0, face * m_size, 0));
+
+		if (!strip.SaveToFile(m_cacheFile))
+		{
+			NazaraError("Failed to save reflection probe cache " + m_cacheFile);
+			return false;
+		}
+
+		m_cacheOutdated = false;
+		return true;
+	}
+
+	ComponentIndex ReflectionProbeComponent::componentIndex;
+}
@@ -0,0 +1,10 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequisites.hpp
+
+#include <NDK/Components/SoundEmitterComponent.hpp>
+
+namespace Ndk
+{
+	ComponentIndex SoundEmitterComponent::componentIndex;
+}
@@ -7,4 +7,28 @@
 namespace Ndk
 {
 	ComponentIndex VelocityComponent::componentIndex;
+
+	/*!
+	* \brief Serializes a VelocityComponent
+	* \return true if successfully serialized
+	*
+	* \param context Serialization context
+	* \param velocity Input velocity component
+	*/
+	bool Serialize(Nz::SerializationContext& context, const VelocityComponent& velocity, Nz::TypeTag<VelocityComponent>)
+	{
+		return Nz::Serialize(context, velocity.linearVelocity);
+	}
+
+	/*!
+	* \brief Unserializes a VelocityComponent
+	* \return true if successfully unserialized
+	*
+	* \param context Serialization context
+	* \param velocity Output velocity component
+	*/
+	bool Unserialize(Nz::SerializationContext& context, VelocityComponent* velocity, Nz::TypeTag<VelocityComponent>)
+	{
+		return Nz::Unserialize(context, &velocity->linearVelocity);
+	}
 }
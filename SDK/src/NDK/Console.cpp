@@ -132,6 +132,9 @@ namespace Ndk
 
 	void Console::SendCharacter(char32_t character)
 	{
+		// The input is only appended to or shortened, the glyphs before its previous end never change
+		std::size_t firstGlyph = m_inputDrawer.GetGlyphCount();
+
 		switch (character)
 		{
 			case '\b':
@@ -160,7 +163,7 @@ namespace Ndk
 			}
 		}
 
-		m_inputTextSprite->Update(m_inputDrawer);
+		m_inputTextSprite->Update(m_inputDrawer, firstGlyph);
 	}
 
 	/*!
@@ -70,6 +70,8 @@ namespace Ndk
 		BaseComponent& component = *m_components[index].get();
 		component.SetEntity(this);
 
+		m_world->NotifyComponentAddition(m_id, index, &component);
+
 		for (std::size_t i = m_componentBits.FindFirst(); i != m_componentBits.npos; i = m_componentBits.FindNext(i))
 		{
 			if (i != index)
@@ -181,6 +183,9 @@ namespace Ndk
 		m_systemBits.Clear();
 
 		// Destroy components
+		for (std::size_t i = m_componentBits.FindFirst(); i != m_componentBits.npos; i = m_componentBits.FindNext(i))
+			m_world->NotifyComponentRemoval(m_id, static_cast<ComponentIndex>(i));
+
 		m_components.clear();
 		m_componentBits.Reset();
 
@@ -218,6 +223,8 @@ namespace Ndk
 
 			component.SetEntity(nullptr);
 
+			m_world->NotifyComponentRemoval(m_id, index);
+
 			m_components[index].reset();
 			m_componentBits.Reset(index);
 		}
@@ -321,10 +321,11 @@ namespace Ndk
 		state.SetGlobal("CursorPosition");
 
 		// Nz::HashType
-		static_assert(Nz::HashType_Max + 1 == 10, "Nz::HashType has been updated but change was not reflected to Lua binding");
-		state.PushTable(0, 10);
+		static_assert(Nz::HashType_Max + 1 == 12, "Nz::HashType has been updated but change was not reflected to Lua binding");
+		state.PushTable(0, 12);
 		{
 			state.PushField("CRC32", Nz::HashType_CRC32);
+			state.PushField("CRC32C", Nz::HashType_CRC32C);
 			state.PushField("CRC64", Nz::HashType_CRC64);
 			state.PushField("Fletcher16", Nz::HashType_Fletcher16);
 			state.PushField("MD5", Nz::HashType_MD5);
@@ -334,21 +335,23 @@ namespace Ndk
 			state.PushField("SHA384", Nz::HashType_SHA384);
 			state.PushField("SHA512", Nz::HashType_SHA512);
 			state.PushField("Whirlpool", Nz::HashType_Whirlpool);
+			state.PushField("XXH3", Nz::HashType_XXH3);
 		}
 		state.SetGlobal("HashType");
 
 		// Nz::OpenMode
-		static_assert(Nz::OpenMode_Max + 1 == 8, "Nz::OpenModeFlags has been updated but change was not reflected to Lua binding");
+		static_assert(Nz::OpenMode_Max + 1 == 9, "Nz::OpenModeFlags has been updated but change was not reflected to Lua binding");
 		state.PushTable(0, Nz::OpenMode_Max + 1);
 		{
-			state.PushField("Append",    Nz::OpenMode_Append);
-			state.PushField("NotOpen",   Nz::OpenMode_NotOpen);
-			state.PushField("Lock",      Nz::OpenMode_Lock);
-			state.PushField("ReadOnly",  Nz::OpenMode_ReadOnly);
-			state.PushField("ReadWrite", Nz::OpenMode_ReadWrite);
-			state.PushField("Text",      Nz::OpenMode_Text);
-			state.PushField("Truncate",  Nz::OpenMode_Truncate);
-			state.PushField("WriteOnly", Nz::OpenMode_WriteOnly);
+			state.PushField("Append",     Nz::OpenMode_Append);
+			state.PushField("NotOpen",    Nz::OpenMode_NotOpen);
+			state.PushField("Lock",       Nz::OpenMode_Lock);
+			state.PushField("ReadOnly",   Nz::OpenMode_ReadOnly);
+			state.PushField("ReadWrite",  Nz::OpenMode_ReadWrite);
+			state.PushField("Text",       Nz::OpenMode_Text);
+			state.PushField("Truncate",   Nz::OpenMode_Truncate);
+			state.PushField("Unbuffered", Nz::OpenMode_Unbuffered);
+			state.PushField("WriteOnly",  Nz::OpenMode_WriteOnly);
 		}
 		state.SetGlobal("OpenMode");
 	}
@@ -125,7 +125,9 @@ namespace Ndk
 			material.BindMethod("EnableDepthBuffer", &Nz::Material::EnableDepthBuffer);
 			material.BindMethod("EnableDepthSorting", &Nz::Material::EnableDepthSorting);
 			material.BindMethod("EnableDepthWrite", &Nz::Material::EnableDepthWrite);
+			material.BindMethod("EnableDistanceField", &Nz::Material::EnableDistanceField);
 			material.BindMethod("EnableFaceCulling", &Nz::Material::EnableFaceCulling);
+			material.BindMethod("EnableOrderIndependentTransparency", &Nz::Material::EnableOrderIndependentTransparency);
 			material.BindMethod("EnableReflectionMapping", &Nz::Material::EnableReflectionMapping);
 			material.BindMethod("EnableScissorTest", &Nz::Material::EnableScissorTest);
 			material.BindMethod("EnableShadowCasting", &Nz::Material::EnableShadowCasting);
@@ -174,7 +176,9 @@ namespace Ndk
 			material.BindMethod("IsDepthBufferEnabled", &Nz::Material::IsDepthBufferEnabled);
 			material.BindMethod("IsDepthSortingEnabled", &Nz::Material::IsDepthSortingEnabled);
 			material.BindMethod("IsDepthWriteEnabled", &Nz::Material::IsDepthWriteEnabled);
+			material.BindMethod("IsDistanceFieldEnabled", &Nz::Material::IsDistanceFieldEnabled);
 			material.BindMethod("IsFaceCullingEnabled", &Nz::Material::IsFaceCullingEnabled);
+			material.BindMethod("IsOrderIndependentTransparencyEnabled", &Nz::Material::IsOrderIndependentTransparencyEnabled);
 			material.BindMethod("IsReflectionMappingEnabled", &Nz::Material::IsReflectionMappingEnabled);
 			material.BindMethod("IsScissorTestEnabled", &Nz::Material::IsScissorTestEnabled);
 			material.BindMethod("IsStencilTestEnabled", &Nz::Material::IsStencilTestEnabled);
@@ -332,8 +332,8 @@ namespace Ndk
 
 			matrix4d.BindMethod("__tostring", &Nz::Matrix4d::ToString);
 
-			matrix4d.BindStaticMethod("Concatenate", &Nz::Matrix4d::Concatenate);
-			matrix4d.BindStaticMethod("ConcatenateAffine", &Nz::Matrix4d::ConcatenateAffine);
+			matrix4d.BindStaticMethod("Concatenate", (Nz::Matrix4d(*)(const Nz::Matrix4d&, const Nz::Matrix4d&)) &Nz::Matrix4d::Concatenate);
+			matrix4d.BindStaticMethod("ConcatenateAffine", (Nz::Matrix4d(*)(const Nz::Matrix4d&, const Nz::Matrix4d&)) &Nz::Matrix4d::ConcatenateAffine);
 			matrix4d.BindStaticMethod("Identity", &Nz::Matrix4d::Identity);
 			matrix4d.BindStaticMethod("LookAt", &Nz::Matrix4d::LookAt, Nz::Vector3d::Up());
 			matrix4d.BindStaticMethod("Ortho", &Nz::Matrix4d::Ortho, -1.0, 1.0);
@@ -13,6 +13,87 @@
 
 namespace Ndk
 {
+	namespace
+	{
+		template<typename ComponentType>
+		ComponentType& CheckEntityComponent(Nz::LuaState& state, World& world, int idTableIndex, std::size_t entryIndex)
+		{
+			state.PushInteger(entryIndex + 1);
+			state.GetTableRaw(idTableIndex);
+
+			bool succeeded;
+			long long entityId = state.ToInteger(-1, &succeeded);
+			state.Pop();
+
+			if (!succeeded || entityId < 0 || !world.IsEntityIdValid(static_cast<EntityId>(entityId)))
+				state.ArgError(idTableIndex, "Invalid entity id at #" + Nz::String::Number(entryIndex + 1));
+
+			const EntityHandle& entity = world.GetEntity(static_cast<EntityId>(entityId));
+			if (!entity->HasComponent<ComponentType>())
+				state.ArgError(idTableIndex, "Entity at #" + Nz::String::Number(entryIndex + 1) + " lacks the required component");
+
+			return entity->GetComponent<ComponentType>();
+		}
+
+		template<typename ComponentType, typename F>
+		int PushComponentVectors(Nz::LuaState& state, World& world, int idTableIndex, F getter)
+		{
+			state.CheckType(idTableIndex, Nz::LuaType_Table);
+
+			std::size_t entityCount = state.LengthRaw(idTableIndex);
+			state.PushTable(entityCount * 3);
+
+			int resultIndex = state.GetAbsIndex(-1);
+			for (std::size_t i = 0; i < entityCount; ++i)
+			{
+				Nz::Vector3f vector = getter(CheckEntityComponent<ComponentType>(state, world, idTableIndex, i));
+				for (std::size_t j = 0; j < 3; ++j)
+				{
+					state.PushInteger(i * 3 + j + 1);
+					state.PushNumber(vector[j]);
+					state.SetTableRaw(resultIndex);
+				}
+			}
+
+			return 1;
+		}
+
+		template<typename ComponentType, typename F>
+		int ReadComponentVectors(Nz::LuaState& state, World& world, int idTableIndex, F setter)
+		{
+			int valueTableIndex = idTableIndex + 1;
+			state.CheckType(idTableIndex, Nz::LuaType_Table);
+			state.CheckType(valueTableIndex, Nz::LuaType_Table);
+
+			std::size_t entityCount = state.LengthRaw(idTableIndex);
+			if (state.LengthRaw(valueTableIndex) < entityCount * 3)
+				state.ArgError(valueTableIndex, "Expected " + Nz::String::Number(entityCount * 3) + " numbers");
+
+			for (std::size_t i = 0; i < entityCount; ++i)
+			{
+				ComponentType& component = CheckEntityComponent<ComponentType>(state, world, idTableIndex, i);
+
+				Nz::Vector3f vector;
+				for (std::size_t j = 0; j < 3; ++j)
+				{
+					state.PushInteger(i * 3 + j + 1);
+					state.GetTableRaw(valueTableIndex);
+
+					bool succeeded;
+					vector[j] = static_cast<float>(state.ToNumber(-1, &succeeded));
+					state.Pop();
+
+					if (!succeeded)
+						state.ArgError(valueTableIndex, "Expected a number at #" + Nz::String::Number(i * 3 + j + 1));
+				}
+
+				setter(component, vector);
+			}
+
+			return 0;
+		}
+	}
+
 	std::unique_ptr<LuaBinding_Base> LuaBinding_Base::BindSDK(LuaBinding& binding)
 	{
 		return std::make_unique<LuaBinding_SDK>(binding);
@@ -187,6 +268,84 @@ namespace Ndk
 			world.BindMethod("Update", &World::Update);
 
 			world.BindMethod("IsValidHandle", &WorldHandle::IsValid);
+
+			// Bulk accessors, crossing the Lua/C++ boundary once per batch instead of once per entity
+			world.BindMethod("GetEntityIds", [this] (Nz::LuaState& state, WorldHandle& instance, std::size_t argumentCount) -> int
+			{
+				Nz::Bitset<> requiredComponents;
+				for (std::size_t i = 0; i < argumentCount; ++i)
+				{
+					LuaBinding::ComponentBinding* bindingComponent = m_binding.QueryComponentIndex(state, static_cast<int>(i + 2));
+					requiredComponents.UnboundedSet(bindingComponent->index);
+				}
+
+				const EntityList& entities = instance->GetEntities();
+				state.PushTable(entities.size());
+
+				int resultIndex = state.GetAbsIndex(-1);
+				long long entityIndex = 1;
+				for (const EntityHandle& entity : entities)
+				{
+					const Nz::Bitset<>& componentBits = entity->GetComponentBits();
+
+					bool hasComponents = true;
+					for (std::size_t bit = requiredComponents.FindFirst(); bit != requiredComponents.npos; bit = requiredComponents.FindNext(bit))
+					{
+						if (bit >= componentBits.GetSize() || !componentBits.Test(bit))
+						{
+							hasComponents = false;
+							break;
+						}
+					}
+
+					if (hasComponents)
+					{
+						state.PushInteger(entityIndex++);
+						state.PushInteger(entity->GetId());
+						state.SetTableRaw(resultIndex);
+					}
+				}
+
+				return 1;
+			});
+
+			world.BindMethod("GetLinearVelocities", [] (Nz::LuaState& state, WorldHandle& instance, std::size_t /*argumentCount*/) -> int
+			{
+				return PushComponentVectors<VelocityComponent>(state, *instance, 2, [] (VelocityComponent& velocity)
+				{
+					return velocity.linearVelocity;
+				});
+			});
+
+			world.BindMethod("GetPositions", [] (Nz::LuaState& state, WorldHandle& instance, std::size_t /*argumentCount*/) -> int
+			{
+				int argIndex = 3;
+				Nz::CoordSys coordSys = state.Check<Nz::CoordSys>(&argIndex, Nz::CoordSys_Global);
+
+				return PushComponentVectors<NodeComponent>(state, *instance, 2, [coordSys] (NodeComponent& node)
+				{
+					return node.GetPosition(coordSys);
+				});
+			});
+
+			world.BindMethod("SetLinearVelocities", [] (Nz::LuaState& state, WorldHandle& instance, std::size_t /*argumentCount*/) -> int
+			{
+				return ReadComponentVectors<VelocityComponent>(state, *instance, 2, [] (VelocityComponent& velocity, const Nz::Vector3f& linearVelocity)
+				{
+					velocity.linearVelocity = linearVelocity;
+				});
+			});
+
+			world.BindMethod("SetPositions", [] (Nz::LuaState& state, WorldHandle& instance, std::size_t /*argumentCount*/) -> int
+			{
+				int argIndex = 4;
+				Nz::CoordSys coordSys = state.Check<Nz::CoordSys>(&argIndex, Nz::CoordSys_Local);
+
+				return ReadComponentVectors<NodeComponent>(state, *instance, 2, [coordSys] (NodeComponent& node, const Nz::Vector3f& position)
+				{
+					node.SetPosition(position, coordSys);
+				});
+			});
 		}
 
 		#ifndef NDK_SERVER
@@ -137,6 +137,8 @@ namespace Ndk
 				return 0;
 			});
 
+			font.BindMethod("GetDistanceFieldSize", &Nz::Font::GetDistanceFieldSize);
+			font.BindMethod("GetDistanceFieldSpread", &Nz::Font::GetDistanceFieldSpread);
 			font.BindMethod("GetFamilyName", &Nz::Font::GetFamilyName);
 			font.BindMethod("GetKerning", &Nz::Font::GetKerning);
 			font.BindMethod("GetGlyphBorder", &Nz::Font::GetGlyphBorder);
@@ -150,6 +152,8 @@ namespace Ndk
 
 			font.BindMethod("OpenFromFile", &Nz::Font::OpenFromFile, Nz::FontParams());
 
+			font.BindMethod("SetDistanceFieldSize", &Nz::Font::SetDistanceFieldSize);
+			font.BindMethod("SetDistanceFieldSpread", &Nz::Font::SetDistanceFieldSpread);
 			font.BindMethod("SetGlyphBorder", &Nz::Font::SetGlyphBorder);
 			font.BindMethod("SetMinimumStepSize", &Nz::Font::SetMinimumStepSize);
 
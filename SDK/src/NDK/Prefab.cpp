@@ -0,0 +1,112 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequisites.hpp
+
+#include <NDK/Prefab.hpp>
+#include <NDK/BaseComponent.hpp>
+#include <NDK/Entity.hpp>
+
+namespace Ndk
+{
+	/*!
+	* \ingroup NDK
+	* \class Ndk::Prefab
+	* \brief NDK class that represents a set of components, to be instantiated as entities by World::Instantiate
+	*
+	* The components of a prefab are attached to no entity, each instance gets its own copy of them.
+	* The systems an instance belongs to are computed once per instantiated batch instead of once per entity.
+	*/
+
+	// Must exists in .cpp file because of BaseComponent unique_ptr
+	Prefab::Prefab() = default;
+
+	/*!
+	* \brief Constructs a Prefab object by copy semantic, cloning the components of the other prefab
+	*
+	* \param prefab Prefab to copy
+	*/
+	Prefab::Prefab(const Prefab& prefab) :
+	m_componentBits(prefab.m_componentBits)
+	{
+		m_components.resize(prefab.m_components.size());
+		for (std::size_t i = m_componentBits.FindFirst(); i != m_componentBits.npos; i = m_componentBits.FindNext(i))
+			m_components[i] = prefab.m_components[i]->Clone();
+	}
+
+	Prefab::Prefab(Prefab&&) noexcept = default;
+	Prefab::~Prefab() = default;
+
+	/*!
+	* \brief Adds a component to the prefab
+	* \return A reference to the newly added component
+	*
+	* \param componentPtr Component to add to the prefab, replacing the one of the same type
+	*
+	* \remark Produces a NazaraAssert if component is nullptr
+	*/
+	BaseComponent& Prefab::AddComponent(std::unique_ptr<BaseComponent>&& componentPtr)
+	{
+		NazaraAssert(componentPtr, "Component must be valid");
+
+		ComponentIndex index = componentPtr->GetIndex();
+		if (index >= m_components.size())
+			m_components.resize(index + 1);
+
+		m_components[index] = std::move(componentPtr);
+		m_componentBits.UnboundedSet(index);
+
+		return *m_components[index];
+	}
+
+	/*!
+	* \brief Removes a component of the prefab by index
+	*
+	* \param index Index of the component
+	*
+	* \remark If component is not part of the prefab, no action is performed
+	*/
+	void Prefab::RemoveComponent(ComponentIndex index)
+	{
+		if (HasComponent(index))
+		{
+			m_components[index].reset();
+			m_componentBits.Reset(index);
+		}
+	}
+
+	/*!
+	* \brief Makes a copy of the prefab, cloning its components
+	* \return A reference to this
+	*
+	* \param prefab Prefab to copy
+	*/
+	Prefab& Prefab::operator=(const Prefab& prefab)
+	{
+		if (this != &prefab)
+		{
+			Prefab copy(prefab);
+			*this = std::move(copy);
+		}
+
+		return *this;
+	}
+
+	Prefab& Prefab::operator=(Prefab&&) noexcept = default;
+
+	/*!
+	* \brief Builds a prefab from the components of an entity
+	* \return Prefab holding a copy of every component of the entity
+	*
+	* \param entity Entity to copy
+	*/
+	Prefab Prefab::FromEntity(const Entity& entity)
+	{
+		Prefab prefab;
+
+		const Nz::Bitset<>& componentBits = entity.GetComponentBits();
+		for (std::size_t i = componentBits.FindFirst(); i != componentBits.npos; i = componentBits.FindNext(i))
+			prefab.AddComponent(entity.GetComponent(static_cast<ComponentIndex>(i)).Clone());
+
+		return prefab;
+	}
+}
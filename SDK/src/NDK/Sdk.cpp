@@ -6,6 +6,7 @@
 #include <Nazara/Audio/Audio.hpp>
 #include <Nazara/Core/ErrorFlags.hpp>
 #include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Graphics/Graphics.hpp>
 #include <Nazara/Lua/Lua.hpp>
 #include <Nazara/Noise/Noise.hpp>
@@ -24,6 +25,8 @@
 #include <NDK/Components/ConstraintComponent2D.hpp>
 #include <NDK/Systems/PhysicsSystem2D.hpp>
 #include <NDK/Systems/PhysicsSystem3D.hpp>
+#include <NDK/Systems/ReplicationSystem.hpp>
+#include <NDK/Systems/SpatialSystem.hpp>
 #include <NDK/Systems/VelocitySystem.hpp>
 
 #ifndef NDK_SERVER
@@ -34,10 +37,13 @@
 #include <NDK/Components/GraphicsComponent.hpp>
 #include <NDK/Components/ParticleEmitterComponent.hpp>
 #include <NDK/Components/ParticleGroupComponent.hpp>
+#include <NDK/Components/ReflectionProbeComponent.hpp>
+#include <NDK/Components/SoundEmitterComponent.hpp>
 #include <NDK/Systems/DebugSystem.hpp>
 #include <NDK/Systems/ParticleSystem.hpp>
 #include <NDK/Systems/ListenerSystem.hpp>
 #include <NDK/Systems/RenderSystem.hpp>
+#include <NDK/BaseWidget.hpp>
 #include <NDK/Widgets/CheckboxWidget.hpp>
 #endif
 
@@ -61,6 +67,8 @@ namespace Ndk
 		if (s_referenceCounter++ > 0)
 			return true; // Already initialized
 
+		Nz::Profiler::Scope profilerScope("Sdk::Initialize");
+
 		try
 		{
 			Nz::ErrorFlags errFlags(Nz::ErrorFlag_ThrowException, true);
@@ -94,6 +102,9 @@ namespace Ndk
 			InitializeComponent<VelocityComponent>("NdkVeloc");
 			InitializeComponent<VelocityComponent>("NdkCons2");
 
+			NodeComponent::RegisterSerializer();
+			VelocityComponent::RegisterSerializer();
+
 			#ifndef NDK_SERVER
 			// Client components
 			InitializeComponent<CameraComponent>("NdkCam");
@@ -103,6 +114,8 @@ namespace Ndk
 			InitializeComponent<GraphicsComponent>("NdkGfx");
 			InitializeComponent<ParticleEmitterComponent>("NdkPaEmi");
 			InitializeComponent<ParticleGroupComponent>("NdkPaGrp");
+			InitializeComponent<ReflectionProbeComponent>("NdkProbe");
+			InitializeComponent<SoundEmitterComponent>("NdkSound");
 			#endif
 
 			// Systems
@@ -112,6 +125,8 @@ namespace Ndk
 			// Shared systems
 			InitializeSystem<PhysicsSystem2D>();
 			InitializeSystem<PhysicsSystem3D>();
+			InitializeSystem<ReplicationSystem>();
+			InitializeSystem<SpatialSystem>();
 			InitializeSystem<VelocitySystem>();
 
 			#ifndef NDK_SERVER
@@ -122,6 +137,12 @@ namespace Ndk
 			InitializeSystem<RenderSystem>();
 
 			// Widgets
+			if (!BaseWidget::Initialize())
+			{
+				NazaraError("Failed to initialize Base Widget");
+				return false;
+			}
+
 			if (!CheckboxWidget::Initialize())
 			{
 				NazaraError("Failed to initialize Checkbox Widget");
@@ -165,6 +186,11 @@ namespace Ndk
 		// Systems
 		BaseSystem::Uninitialize();
 
+		#ifndef NDK_SERVER
+		// Widgets (their materials must be released before the graphics module)
+		BaseWidget::Uninitialize();
+		#endif
+
 		// Uninitialize the engine
 
 		#ifndef NDK_SERVER
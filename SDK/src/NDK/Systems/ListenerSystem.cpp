@@ -6,6 +6,7 @@
 #include <Nazara/Audio/Audio.hpp>
 #include <NDK/Components/ListenerComponent.hpp>
 #include <NDK/Components/NodeComponent.hpp>
+#include <NDK/Components/SoundEmitterComponent.hpp>
 
 namespace Ndk
 {
@@ -14,30 +15,81 @@ namespace Ndk
 	* \class Ndk::ListenerSystem
 	* \brief NDK class that represents the audio system
 	*
-	* \remark This system is enabled if the entity owns the trait: ListenerComponent and NodeComponent
+	* \remark This system is enabled if the entity owns the trait: NodeComponent and either ListenerComponent or SoundEmitterComponent
 	*/
 
 	/*!
 	* \brief Constructs an ListenerSystem object by default
 	*/
 
-	ListenerSystem::ListenerSystem()
+	ListenerSystem::ListenerSystem() :
+	m_isContextSuspensionEnabled(false)
 	{
-		Requires<ListenerComponent, NodeComponent>();
+		Requires<NodeComponent>();
+		RequiresAny<ListenerComponent, SoundEmitterComponent>();
+		Reads<ListenerComponent>();
+		Writes<NodeComponent, SoundEmitterComponent>(); //< Reading global transformations may update the node
 		SetUpdateOrder(100); //< Update last, after every movement is done
 	}
 
+	/*!
+	* \brief Operation to perform when an entity is removed
+	*
+	* \param entity Pointer to the entity
+	*/
+
+	void ListenerSystem::OnEntityRemoved(Entity* entity)
+	{
+		m_emitters.Remove(entity);
+		m_listeners.Remove(entity);
+	}
+
+	/*!
+	* \brief Operation to perform when entity is validated for the system
+	*
+	* \param entity Pointer to the entity
+	* \param justAdded Is the entity newly added
+	*/
+
+	void ListenerSystem::OnEntityValidation(Entity* entity, bool justAdded)
+	{
+		if (entity->HasComponent<ListenerComponent>())
+			m_listeners.Insert(entity);
+		else
+			m_listeners.Remove(entity);
+
+		if (entity->HasComponent<SoundEmitterComponent>())
+		{
+			if (!m_emitters.Has(entity))
+			{
+				// Start from the current position, so that the first velocity isn't computed from the origin
+				SoundEmitterComponent& emitter = entity->GetComponent<SoundEmitterComponent>();
+				emitter.m_isCulled = false;
+				emitter.m_lastPosition = entity->GetComponent<NodeComponent>().GetPosition(Nz::CoordSys_Global);
+
+				m_emitters.Insert(entity);
+			}
+		}
+		else
+			m_emitters.Remove(entity);
+
+		NazaraUnused(justAdded);
+	}
+
 	/*!
 	* \brief Operation to perform when system is updated
 	*
 	* \param elapsedTime Delta time used for the update
+	*
+	* \remark Emitters are updated together, emitters farther from the listener than their audible distance are only updated once when they get out of range
 	*/
 
 	void ListenerSystem::OnUpdate(float elapsedTime)
 	{
 		std::size_t activeListenerCount = 0;
+		Nz::Vector3f listenerPosition;
 
-		for (const Ndk::EntityHandle& entity : GetEntities())
+		for (const Ndk::EntityHandle& entity : m_listeners)
 		{
 			// Is the listener actif ?
 			const ListenerComponent& listener = entity->GetComponent<ListenerComponent>();
@@ -57,11 +109,44 @@ namespace Ndk
 			Nz::Vector3f velocity = (newPos - oldPos) / elapsedTime;
 			Nz::Audio::SetListenerVelocity(velocity);
 
+			listenerPosition = newPos;
 			activeListenerCount++;
 		}
 
 		if (activeListenerCount > 1)
 			NazaraWarning(Nz::String::Number(activeListenerCount) + " listeners were active in the same update loop");
+
+		if (m_emitters.empty())
+			return;
+
+		if (activeListenerCount == 0)
+			listenerPosition = Nz::Audio::GetListenerPosition();
+
+		m_spatialUpdates.clear();
+		for (const Ndk::EntityHandle& entity : m_emitters)
+		{
+			SoundEmitterComponent& emitter = entity->GetComponent<SoundEmitterComponent>();
+			const NodeComponent& node = entity->GetComponent<NodeComponent>();
+
+			Nz::Vector3f position = node.GetPosition(Nz::CoordSys_Global);
+			Nz::Vector3f velocity = (position - emitter.m_lastPosition) / elapsedTime;
+			emitter.m_lastPosition = position;
+
+			bool isCulled = (listenerPosition.SquaredDistance(position) > emitter.m_audibleDistance * emitter.m_audibleDistance);
+			if (isCulled)
+			{
+				// Out of range emitters are left where they were last seen, without any velocity
+				if (emitter.m_isCulled)
+					continue;
+
+				velocity = Nz::Vector3f::Zero();
+			}
+			emitter.m_isCulled = isCulled;
+
+			m_spatialUpdates.push_back({&emitter, position, velocity});
+		}
+
+		Nz::SoundEmitter::UpdateSpatialization(m_spatialUpdates.data(), m_spatialUpdates.size(), m_isContextSuspensionEnabled);
 	}
 
 	SystemIndex ListenerSystem::systemIndex;
@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Prerequisites.hpp
 
 #include <NDK/Systems/ParticleSystem.hpp>
+#include <NDK/Components/ParticleEmitterComponent.hpp>
 #include <NDK/Components/ParticleGroupComponent.hpp>
 
 namespace Ndk
@@ -22,6 +23,7 @@ namespace Ndk
 	ParticleSystem::ParticleSystem()
 	{
 		Requires<ParticleGroupComponent>();
+		Writes<ParticleEmitterComponent, ParticleGroupComponent>();
 	}
 
 	/*!
@@ -32,12 +34,13 @@ namespace Ndk
 
 	void ParticleSystem::OnUpdate(float elapsedTime)
 	{
-		for (const Ndk::EntityHandle& entity : GetEntities())
+		// Groups given an update interval are simulated less often, over the time they missed
+		ForEachDueEntity(elapsedTime, [](const Ndk::EntityHandle& entity, float entityElapsedTime)
 		{
 			ParticleGroupComponent& group = entity->GetComponent<ParticleGroupComponent>();
 
-			group.Update(elapsedTime);
-		}
+			group.Update(entityElapsedTime);
+		});
 	}
 
 	SystemIndex ParticleSystem::systemIndex;
@@ -29,6 +29,9 @@ namespace Ndk
 		Requires<NodeComponent>();
 		RequiresAny<CollisionComponent2D, PhysicsComponent2D>();
 		Excludes<PhysicsComponent3D>();
+		Writes<CollisionComponent2D, NodeComponent, PhysicsComponent2D>();
+
+		EnableFixedStep();
 	}
 
 	void PhysicsSystem2D::CreatePhysWorld() const
@@ -75,19 +78,34 @@ namespace Ndk
 
 		m_world->Step(elapsedTime);
 
+		// Only bodies which were awake during the step, or moved by the user, are synchronized with their node
 		for (const Ndk::EntityHandle& entity : m_dynamicObjects)
 		{
-			NodeComponent& node = entity->GetComponent<NodeComponent>();
 			PhysicsComponent2D& phys = entity->GetComponent<PhysicsComponent2D>();
 
 			Nz::RigidBody2D* body = phys.GetRigidBody();
+			if (!body->HasTransformChanged())
+				continue;
+
+			body->ResetTransformChanged();
+
+			NodeComponent& node = entity->GetComponent<NodeComponent>();
 			node.SetRotation(Nz::EulerAnglesf(0.f, 0.f, body->GetRotation()), Nz::CoordSys_Global);
 			node.SetPosition(Nz::Vector3f(body->GetPosition(), node.GetPosition(Nz::CoordSys_Global).z), Nz::CoordSys_Global);
 		}
 
+		// Static objects moved at the last update must be stopped if their node didn't move again
+		for (const Ndk::EntityHandle& entity : m_movingStaticObjects)
+			m_movedStaticObjects.Insert(entity);
+
+		m_movingStaticObjects.Clear();
+
 		float invElapsedTime = 1.f / elapsedTime;
-		for (const Ndk::EntityHandle& entity : m_staticObjects)
+		for (const Ndk::EntityHandle& entity : m_movedStaticObjects)
 		{
+			if (!m_staticObjects.Has(entity))
+				continue;
+
 			CollisionComponent2D& collision = entity->GetComponent<CollisionComponent2D>();
 			NodeComponent& node = entity->GetComponent<NodeComponent>();
 
@@ -102,6 +120,8 @@ namespace Ndk
 			{
 				body->SetPosition(newPosition);
 				body->SetVelocity((newPosition - oldPosition) * invElapsedTime);
+
+				m_movingStaticObjects.Insert(entity);
 			}
 			else
 				body->SetVelocity(Nz::Vector2f::Zero());
@@ -122,6 +142,8 @@ namespace Ndk
 				physObj->SetAngularVelocity(Nz::Vector3f::Zero());
 */
 		}
+
+		m_movedStaticObjects.Clear();
 	}
 
 	SystemIndex PhysicsSystem2D::systemIndex;
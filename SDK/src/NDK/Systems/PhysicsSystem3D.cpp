@@ -29,6 +29,9 @@ namespace Ndk
 		Requires<NodeComponent>();
 		RequiresAny<CollisionComponent3D, PhysicsComponent3D>();
 		Excludes<PhysicsComponent2D>();
+		Writes<CollisionComponent3D, NodeComponent, PhysicsComponent3D>();
+
+		EnableFixedStep();
 	}
 
 	void PhysicsSystem3D::CreatePhysWorld() const
@@ -91,19 +94,51 @@ namespace Ndk
 
 		m_world->Step(elapsedTime);
 
+		// Only bodies which were awake during the step, or moved by the user, have their transform read back
+		// Transforms are read back in a batch, into arrays indexed by entity id which are then applied to the nodes
+		m_dynamicBodies.clear();
 		for (const Ndk::EntityHandle& entity : m_dynamicObjects)
 		{
-			NodeComponent& node = entity->GetComponent<NodeComponent>();
-			PhysicsComponent3D& phys = entity->GetComponent<PhysicsComponent3D>();
+			Nz::RigidBody3D* physObj = entity->GetComponent<PhysicsComponent3D>().GetRigidBody();
+			if (!physObj->HasTransformChanged())
+				continue;
+
+			physObj->ResetTransformChanged();
+
+			EntityId id = entity->GetId();
+			if (id >= m_dynamicBodies.size())
+				m_dynamicBodies.resize(id + 1, nullptr);
 
-			Nz::RigidBody3D* physObj = phys.GetRigidBody();
-			node.SetRotation(physObj->GetRotation(), Nz::CoordSys_Global);
-			node.SetPosition(physObj->GetPosition(), Nz::CoordSys_Global);
+			m_dynamicBodies[id] = physObj;
 		}
 
+		m_bodyPositions.resize(m_dynamicBodies.size());
+		m_bodyRotations.resize(m_dynamicBodies.size());
+		m_world->ReadBodyTransforms(m_dynamicBodies.data(), m_dynamicBodies.size(), m_bodyPositions.data(), m_bodyRotations.data());
+
+		ParallelForEachEntity(m_dynamicObjects, [this](const Ndk::EntityHandle& entity)
+		{
+			EntityId id = entity->GetId();
+			if (id >= m_dynamicBodies.size() || !m_dynamicBodies[id])
+				return;
+
+			NodeComponent& node = entity->GetComponent<NodeComponent>();
+			node.SetRotation(m_bodyRotations[id], Nz::CoordSys_Global);
+			node.SetPosition(m_bodyPositions[id], Nz::CoordSys_Global);
+		});
+
+		// Static objects moved at the last update must be stopped if their node didn't move again
+		for (const Ndk::EntityHandle& entity : m_movingStaticObjects)
+			m_movedStaticObjects.Insert(entity);
+
+		m_movingStaticObjects.Clear();
+
 		float invElapsedTime = 1.f / elapsedTime;
-		for (const Ndk::EntityHandle& entity : m_staticObjects)
+		for (const Ndk::EntityHandle& entity : m_movedStaticObjects)
 		{
+			if (!m_staticObjects.Has(entity))
+				continue;
+
 			CollisionComponent3D& collision = entity->GetComponent<CollisionComponent3D>();
 			NodeComponent& node = entity->GetComponent<NodeComponent>();
 
@@ -114,12 +149,15 @@ namespace Ndk
 			Nz::Quaternionf newRotation = node.GetRotation(Nz::CoordSys_Global);
 			Nz::Vector3f newPosition = node.GetPosition(Nz::CoordSys_Global);
 
+			bool moving = false;
+
 			// To move static objects and ensure their collisions, we have to specify them a velocity
 			// (/!\: the physical motor does not apply the speed on static objects)
 			if (newPosition != oldPosition)
 			{
 				physObj->SetPosition(newPosition);
 				physObj->SetLinearVelocity((newPosition - oldPosition) * invElapsedTime);
+				moving = true;
 			}
 			else
 				physObj->SetLinearVelocity(Nz::Vector3f::Zero());
@@ -134,10 +172,16 @@ namespace Ndk
 
 				physObj->SetRotation(oldRotation);
 				physObj->SetAngularVelocity(angularVelocity);
+				moving = true;
 			}
 			else
 				physObj->SetAngularVelocity(Nz::Vector3f::Zero());
+
+			if (moving)
+				m_movingStaticObjects.Insert(entity);
 		}
+
+		m_movedStaticObjects.Clear();
 	}
 
 	SystemIndex PhysicsSystem3D::systemIndex;
@@ -3,20 +3,258 @@
 // For conditions of distribution and use, see copyright notice in Prerequisites.hpp
 
 #include <NDK/Systems/RenderSystem.hpp>
+#include <Nazara/Core/Profiler.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Graphics/AbstractViewer.hpp>
 #include <Nazara/Graphics/ColorBackground.hpp>
+#include <Nazara/Graphics/DeferredRenderTechnique.hpp>
 #include <Nazara/Graphics/ForwardRenderTechnique.hpp>
 #include <Nazara/Graphics/SceneData.hpp>
+#include <Nazara/Graphics/RenderTechniques.hpp>
 #include <Nazara/Graphics/SkyboxBackground.hpp>
+#include <Nazara/Graphics/SnapshotRenderQueue.hpp>
 #include <Nazara/Math/Rect.hpp>
+#include <Nazara/Renderer/Context.hpp>
 #include <Nazara/Renderer/Renderer.hpp>
+#include <Nazara/Renderer/RenderWindow.hpp>
 #include <NDK/Components/CameraComponent.hpp>
 #include <NDK/Components/GraphicsComponent.hpp>
 #include <NDK/Components/LightComponent.hpp>
 #include <NDK/Components/NodeComponent.hpp>
 #include <NDK/Components/ParticleGroupComponent.hpp>
+#include <NDK/Components/ReflectionProbeComponent.hpp>
+#include <algorithm>
+#include <cmath>
 
 namespace Ndk
 {
+	namespace
+	{
+		// Rotations of the views drawing the faces of a cubemap, in the order of Nz::CubemapFace
+		const Nz::Quaternionf& GetCubemapFaceRotation(unsigned int face)
+		{
+			static Nz::Quaternionf rotations[6] =
+			{
+				Nz::Quaternionf::RotationBetween(Nz::Vector3f::Forward(),  Nz::Vector3f::UnitX()), // CubemapFace_PositiveX
+				Nz::Quaternionf::RotationBetween(Nz::Vector3f::Forward(), -Nz::Vector3f::UnitX()), // CubemapFace_NegativeX
+				Nz::Quaternionf::RotationBetween(Nz::Vector3f::Forward(), -Nz::Vector3f::UnitY()), // CubemapFace_PositiveY
+				Nz::Quaternionf::RotationBetween(Nz::Vector3f::Forward(),  Nz::Vector3f::UnitY()), // CubemapFace_NegativeY
+				Nz::Quaternionf::RotationBetween(Nz::Vector3f::Forward(), -Nz::Vector3f::UnitZ()), // CubemapFace_PositiveZ
+				Nz::Quaternionf::RotationBetween(Nz::Vector3f::Forward(),  Nz::Vector3f::UnitZ())  // CubemapFace_NegativeZ
+			};
+
+			return rotations[face];
+		}
+
+		// Viewer of a shadow map slot or of a reflection probe face, the techniques need one to sort their queue and to know the size of the target
+		class ShadowViewer : public Nz::AbstractViewer
+		{
+			public:
+				ShadowViewer(const Nz::RenderTarget* target, const Nz::Recti& viewport, const Nz::Frustumf& frustum, const Nz::Matrix4f& projectionMatrix, const Nz::Matrix4f& viewMatrix, Nz::ProjectionType projectionType, float zNear, float zFar) :
+				m_frustum(frustum),
+				m_projectionMatrix(projectionMatrix),
+				m_viewMatrix(viewMatrix),
+				m_projectionType(projectionType),
+				m_viewport(viewport),
+				m_target(target),
+				m_zFar(zFar),
+				m_zNear(zNear)
+				{
+					viewMatrix.GetInverseAffine(&m_invViewMatrix);
+				}
+
+				void ApplyView() const override
+				{
+					Nz::Renderer::SetTarget(m_target);
+					Nz::Renderer::SetViewport(m_viewport);
+					Nz::Renderer::SetMatrix(Nz::MatrixType_Projection, m_projectionMatrix);
+					Nz::Renderer::SetMatrix(Nz::MatrixType_View, m_viewMatrix);
+				}
+
+				float GetAspectRatio() const override
+				{
+					return static_cast<float>(m_viewport.width) / m_viewport.height;
+				}
+
+				Nz::Vector3f GetEyePosition() const override
+				{
+					return m_invViewMatrix.GetTranslation();
+				}
+
+				Nz::Vector3f GetForward() const override
+				{
+					return m_invViewMatrix.Transform(Nz::Vector3f::Forward(), 0.f);
+				}
+
+				const Nz::Frustumf& GetFrustum() const override
+				{
+					return m_frustum;
+				}
+
+				const Nz::Matrix4f& GetProjectionMatrix() const override
+				{
+					return m_projectionMatrix;
+				}
+
+				Nz::ProjectionType GetProjectionType() const override
+				{
+					return m_projectionType;
+				}
+
+				const Nz::RenderTarget* GetTarget() const override
+				{
+					return m_target;
+				}
+
+				const Nz::Matrix4f& GetViewMatrix() const override
+				{
+					return m_viewMatrix;
+				}
+
+				const Nz::Recti& GetViewport() const override
+				{
+					return m_viewport;
+				}
+
+				float GetZFar() const override
+				{
+					return m_zFar;
+				}
+
+				float GetZNear() const override
+				{
+					return m_zNear;
+				}
+
+			private:
+				const Nz::Frustumf& m_frustum;
+				const Nz::Matrix4f& m_projectionMatrix;
+				const Nz::Matrix4f& m_viewMatrix;
+				Nz::Matrix4f m_invViewMatrix;
+				Nz::ProjectionType m_projectionType;
+				Nz::Recti m_viewport;
+				const Nz::RenderTarget* m_target;
+				float m_zFar;
+				float m_zNear;
+		};
+
+		// Copy of a camera taken when its frame packet is filled, the render thread draws with it while the camera keeps moving
+		class ViewerSnapshot : public Nz::AbstractViewer
+		{
+			public:
+				void ApplyView() const override
+				{
+					Nz::Renderer::SetMatrix(Nz::MatrixType_Projection, m_projectionMatrix);
+					Nz::Renderer::SetMatrix(Nz::MatrixType_View, m_viewMatrix);
+					Nz::Renderer::SetTarget(m_target);
+					Nz::Renderer::SetViewport(m_viewport);
+				}
+
+				void Capture(const CameraComponent& camera)
+				{
+					m_frustum = camera.GetFrustum();
+					m_projectionMatrix = camera.GetProjectionMatrix();
+					m_viewMatrix = camera.GetViewMatrix();
+					m_eyePosition = camera.GetEyePosition();
+					m_forward = camera.GetForward();
+					m_projectionType = camera.GetProjectionType();
+					m_viewport = camera.GetViewport();
+					m_target = camera.GetTarget();
+					m_aspectRatio = camera.GetAspectRatio();
+					m_zFar = camera.GetZFar();
+					m_zNear = camera.GetZNear();
+				}
+
+				float GetAspectRatio() const override
+				{
+					return m_aspectRatio;
+				}
+
+				Nz::Vector3f GetEyePosition() const override
+				{
+					return m_eyePosition;
+				}
+
+				Nz::Vector3f GetForward() const override
+				{
+					return m_forward;
+				}
+
+				const Nz::Frustumf& GetFrustum() const override
+				{
+					return m_frustum;
+				}
+
+				const Nz::Matrix4f& GetProjectionMatrix() const override
+				{
+					return m_projectionMatrix;
+				}
+
+				Nz::ProjectionType GetProjectionType() const override
+				{
+					return m_projectionType;
+				}
+
+				const Nz::RenderTarget* GetTarget() const override
+				{
+					return m_target;
+				}
+
+				const Nz::Matrix4f& GetViewMatrix() const override
+				{
+					return m_viewMatrix;
+				}
+
+				const Nz::Recti& GetViewport() const override
+				{
+					return m_viewport;
+				}
+
+				float GetZFar() const override
+				{
+					return m_zFar;
+				}
+
+				float GetZNear() const override
+				{
+					return m_zNear;
+				}
+
+			private:
+				Nz::Frustumf m_frustum;
+				Nz::Matrix4f m_projectionMatrix;
+				Nz::Matrix4f m_viewMatrix;
+				Nz::Vector3f m_eyePosition;
+				Nz::Vector3f m_forward;
+				Nz::ProjectionType m_projectionType;
+				Nz::Recti m_viewport;
+				const Nz::RenderTarget* m_target = nullptr;
+				float m_aspectRatio;
+				float m_zFar;
+				float m_zNear;
+		};
+	}
+
+	/*!
+	* \brief Everything the render thread needs to draw the cameras of a frame
+	*
+	* Each camera has its own technique, so its render queue can be drawn while the one of the next frame is filled
+	*/
+
+	struct RenderSystem::FramePacket
+	{
+		struct CameraPass
+		{
+			std::unique_ptr<Nz::AbstractRenderTechnique> technique;
+			std::unique_ptr<Nz::SnapshotRenderQueue> renderQueue;
+			Nz::SceneData sceneData;
+			ViewerSnapshot viewer;
+		};
+
+		std::vector<CameraPass> passes;
+		std::vector<Nz::RenderWindow*> windows; //< Displayed once every camera is drawn
+	};
+
 	/*!
 	* \ingroup NDK
 	* \class Ndk::RenderSystem
@@ -26,22 +264,97 @@ namespace Ndk
 	* or a drawable element with trait: GraphicsComponent and NodeComponent
 	* or a light element with trait: LightComponent and NodeComponent
 	* or a set of particles with trait: ParticleGroupComponent
+	* or a reflection probe with trait: ReflectionProbeComponent and NodeComponent
 	*/
 
 	/*!
 	* \brief Constructs an RenderSystem object by default
 	*/
 	RenderSystem::RenderSystem() :
+	m_framePacketIndex(0),
+	m_reflectionProbeCursor(0),
+	m_shadowViewCount(0),
 	m_coordinateSystemMatrix(Nz::Matrix4f::Identity()),
+	m_residencyManager(nullptr),
 	m_coordinateSystemInvalidated(true),
-	m_forceRenderQueueInvalidation(false)
+	m_dynamicResolutionEnabled(false),
+	m_forceRenderQueueInvalidation(false),
+	m_occlusionCulling(false),
+	m_particleGroupsQueued(false),
+	m_shadowDistance(100.f),
+	m_reflectionFaceBudget(2)
 	{
+		m_drawableCulling.EnableHierarchicalCulling();
+
 		ChangeRenderTechnique<Nz::ForwardRenderTechnique>();
 		SetDefaultBackground(Nz::ColorBackground::New());
 		SetUpdateOrder(100); //< Render last, after every movement is done
 		SetMaximumUpdateRate(0.f);  //< We don't want any rate limit
 	}
 
+	/*!
+	* \brief Destructs the object, after the render thread drew its pending frames
+	*/
+	RenderSystem::~RenderSystem()
+	{
+		// Pending frames read the packets
+		m_renderThread.reset();
+	}
+
+	/*!
+	* \brief Enables or disables dynamic resolution
+	*
+	* When enabled, the GPU time of the frames is measured and the resolution the scene is drawn at is lowered when they go over the budget of the controller,
+	* then raised again once they are cheaper (see GetDynamicResolutionController).
+	*
+	* \param enable Should dynamic resolution be enabled
+	*
+	* \remark Only the deferred render technique can draw the scene at a lower resolution, cameras with an orthographic projection (interfaces) staying at native resolution
+	* \remark GPU timings aren't measured while the render thread is enabled, the scale is then left unchanged
+	*/
+	void RenderSystem::EnableDynamicResolution(bool enable)
+	{
+		m_dynamicResolutionEnabled = enable;
+		m_dynamicResolution.Reset();
+
+		if (Nz::DeferredRenderTechnique* deferredTechnique = dynamic_cast<Nz::DeferredRenderTechnique*>(m_renderTechnique.get()))
+			deferredTechnique->SetResolutionScale((enable) ? m_dynamicResolution.GetScale() : 1.f);
+	}
+
+	/*!
+	* \brief Enables or disables the drawing of the cameras by a dedicated render thread
+	*
+	* When enabled, the system only fills a frame packet for every camera (visible renderables, lights and copies of their streamed vertices) which is drawn by the render thread,
+	* so the next frame can be updated while this one is drawn. The system waits for the render thread when it is more than pipelineDepth frames late.
+	* The render thread activates the targets of the cameras and displays the windows among them after drawing, the application must not do it anymore.
+	*
+	* \param enable Should a render thread draw the cameras
+	* \param pipelineDepth Frames the render thread may be late, one being enough for the update and the drawing of two frames to overlap
+	*
+	* \remark Shadow maps, reflection probes, occlusion culling and GPU profiling are not supported by the render thread and are skipped while it is enabled
+	* \remark Render techniques are created by type (see RenderTechniques) for the render thread, they don't share the settings of GetRenderTechnique()
+	* \remark Nothing must be drawn from the thread updating the world while the render thread is enabled, as the Renderer state isn't per thread
+	*/
+	void RenderSystem::EnableRenderThread(bool enable, unsigned int pipelineDepth)
+	{
+		// Pending frames read the packets, they must be drawn before those are released
+		m_renderThread.reset();
+		m_framePackets.clear();
+		m_framePacketIndex = 0;
+
+		if (enable)
+		{
+			m_renderThread = std::make_unique<Nz::RenderThread>(pipelineDepth);
+
+			// A packet may be filled while pipelineDepth others are waiting or being drawn
+			for (unsigned int i = 0; i <= m_renderThread->GetPipelineDepth(); ++i)
+				m_framePackets.emplace_back(std::make_unique<FramePacket>());
+		}
+
+		// The render queue of the technique isn't filled while the render thread is enabled
+		m_forceRenderQueueInvalidation = true;
+	}
+
 	/*!
 	* \brief Operation to perform when an entity is removed
 	*
@@ -64,7 +377,16 @@ namespace Ndk
 		{
 			GraphicsComponent& gfxComponent = entity->GetComponent<GraphicsComponent>();
 			gfxComponent.RemoveFromCullingList(&m_drawableCulling);
+
+			for (CameraOcclusion& occlusion : m_cameraOcclusions)
+				occlusion.culler.Forget(&gfxComponent);
 		}
+
+		auto probeIt = std::find(m_reflectionProbes.begin(), m_reflectionProbes.end(), entity);
+		if (probeIt != m_reflectionProbes.end())
+			m_reflectionProbes.erase(probeIt);
+
+		m_shadowMapStates.erase(entity->GetId());
 	}
 
 	/*!
@@ -104,21 +426,18 @@ namespace Ndk
 			GraphicsComponent& gfxComponent = entity->GetComponent<GraphicsComponent>();
 			if (justAdded)
 				gfxComponent.AddToCullingList(&m_drawableCulling);
-
-			if (gfxComponent.DoesRequireRealTimeReflections())
-				m_realtimeReflected.Insert(entity);
-			else
-				m_realtimeReflected.Remove(entity);
 		}
 		else
 		{
 			m_drawables.Remove(entity);
-			m_realtimeReflected.Remove(entity);
 
 			if (entity->HasComponent<GraphicsComponent>())
 			{
 				GraphicsComponent& gfxComponent = entity->GetComponent<GraphicsComponent>();
 				gfxComponent.RemoveFromCullingList(&m_drawableCulling);
+
+				for (CameraOcclusion& occlusion : m_cameraOcclusions)
+					occlusion.culler.Forget(&gfxComponent);
 			}
 		}
 
@@ -147,6 +466,8 @@ namespace Ndk
 			m_directionalLights.Remove(entity);
 			m_lights.Remove(entity);
 			m_pointSpotLights.Remove(entity);
+
+			m_shadowMapStates.erase(entity->GetId());
 		}
 
 		if (entity->HasComponent<ParticleGroupComponent>())
@@ -161,6 +482,15 @@ namespace Ndk
 
 			m_particleGroups.Remove(entity);
 		}
+
+		auto probeIt = std::find(m_reflectionProbes.begin(), m_reflectionProbes.end(), entity);
+		if (entity->HasComponent<ReflectionProbeComponent>() && entity->HasComponent<NodeComponent>())
+		{
+			if (probeIt == m_reflectionProbes.end())
+				m_reflectionProbes.emplace_back(entity);
+		}
+		else if (probeIt != m_reflectionProbes.end())
+			m_reflectionProbes.erase(probeIt);
 	}
 
 	/*!
@@ -182,58 +512,153 @@ namespace Ndk
 
 			m_coordinateSystemInvalidated = false;
 		}
+		else if (GetWorld().IsFixedUpdateEnabled())
+		{
+			// Interpolated renderables move every frame, even when the simulation didn't step
+			for (const Ndk::EntityHandle& drawable : m_drawables)
+			{
+				if (drawable->GetComponent<NodeComponent>().IsInterpolationEnabled())
+					drawable->GetComponent<GraphicsComponent>().InvalidateTransformMatrix();
+			}
+		}
 
-		UpdateDynamicReflections();
-		UpdatePointSpotShadowMaps();
+		// The GPU time of the passes is reported to the world profiler and drives dynamic resolution, a few frames later
+		bool worldProfiling = GetWorld().IsProfilerEnabled();
+		bool gpuProfiling = (worldProfiling || m_dynamicResolutionEnabled) && !Nz::GpuProfiler::GetActive() && !m_renderThread;
+		if (gpuProfiling)
+			m_gpuProfiler.BeginFrame();
 
-		for (const Ndk::EntityHandle& camera : m_cameras)
+		// Applied every frame, as the render technique may have been changed
+		if (m_dynamicResolutionEnabled)
+		{
+			if (Nz::DeferredRenderTechnique* deferredTechnique = dynamic_cast<Nz::DeferredRenderTechnique*>(m_renderTechnique.get()))
+				deferredTechnique->SetResolutionScale(m_dynamicResolution.GetScale());
+		}
+
+		// To make sure the bounding volumes used by the culling list are updated, they don't depend on the camera
+		{
+			Nz::Profiler::Scope cpuProfilerScope("RenderSystem::BoundingVolumes");
+			UpdateBoundingVolumes();
+		}
+
+		{
+			Nz::Profiler::Scope cpuProfilerScope("RenderSystem::CullViews");
+			CullViews();
+		}
+
+		if (m_renderThread)
 		{
+			{
+				Nz::Profiler::Scope cpuProfilerScope("RenderSystem::SubmitFramePacket");
+				SubmitFramePacket();
+			}
+
+			if (m_residencyManager)
+			{
+				Nz::Profiler::Scope cpuProfilerScope("RenderSystem::Residency");
+				m_residencyManager->Update();
+			}
+
+			return;
+		}
+
+		{
+			Nz::Profiler::Scope cpuProfilerScope("RenderSystem::ShadowMaps");
+			Nz::GpuProfiler::Scope profilerScope("ShadowMaps");
+			UpdatePointSpotShadowMaps();
+		}
+
+		{
+			Nz::Profiler::Scope cpuProfilerScope("RenderSystem::ReflectionProbes");
+			Nz::GpuProfiler::Scope profilerScope("ReflectionProbes");
+			UpdateReflectionProbes();
+		}
+
+		// Cameras may have been added or removed since the last frame, their tests are kept by index
+		if (m_occlusionCulling)
+			m_cameraOcclusions.resize(m_cameras.size());
+
+		for (std::size_t cameraIndex = 0; cameraIndex < m_cameras.size(); ++cameraIndex)
+		{
+			const Ndk::EntityHandle& camera = m_cameras[cameraIndex];
 			CameraComponent& camComponent = camera->GetComponent<CameraComponent>();
 
-			//UpdateDirectionalShadowMaps(camComponent);
+			{
+				Nz::Profiler::Scope cpuProfilerScope("RenderSystem::DirectionalShadowMaps");
+				Nz::GpuProfiler::Scope profilerScope("DirectionalShadowMaps");
+				UpdateDirectionalShadowMaps(cameraIndex);
+			}
 
 			Nz::AbstractRenderQueue* renderQueue = m_renderTechnique->GetRenderQueue();
 
-			// To make sure the bounding volume used by the culling list is updated
-			for (const Ndk::EntityHandle& drawable : m_drawables)
+			const View& view = m_views[m_shadowViewCount + cameraIndex];
+
+			bool forceInvalidation = view.forceInvalidation;
+			std::size_t visibilityHash = view.visibilityHash;
+
+			// Particles are simulated every frame, their vertices have to be queued again each time one of their groups is visible (FIXME)
+			// The queue is rebuilt one more time once they are all out of view, to get rid of their last vertices
+			m_visibleParticleGroups.clear();
+			for (const Ndk::EntityHandle& particleGroup : m_particleGroups)
 			{
-				GraphicsComponent& graphicsComponent = drawable->GetComponent<GraphicsComponent>();
-				graphicsComponent.EnsureBoundingVolumeUpdate();
+				const ParticleGroupComponent& groupComponent = particleGroup->GetComponent<ParticleGroupComponent>();
+				groupComponent.EnsureBoundingVolumeUpdated();
+
+				if (groupComponent.Cull(view.frustum, Nz::Matrix4f::Identity()))
+					m_visibleParticleGroups.push_back(&groupComponent);
 			}
 
-			bool forceInvalidation = false;
+			if (!m_visibleParticleGroups.empty() || m_particleGroupsQueued)
+				forceInvalidation = true;
 
-			std::size_t visibilityHash = m_drawableCulling.Cull(camComponent.GetFrustum(), &forceInvalidation);
+			// The render queue is shared by every camera, it only stays valid for the camera which filled it
+			if (m_queuedCamera != camera)
+				forceInvalidation = true;
 
-			// Always regenerate renderqueue if particle groups are present for now (FIXME)
-			if (!m_lights.empty() || !m_particleGroups.empty())
+			// Drawables hidden during the last frame are filtered out of the frustum culling results
+			CameraOcclusion* occlusion = (m_occlusionCulling) ? &m_cameraOcclusions[cameraIndex] : nullptr;
+			if (occlusion && occlusion->visibilityChanged)
 				forceInvalidation = true;
 
+			// Levels of detail depend on the distance to the camera, which may change without changing the visible drawables
+			for (const GraphicsComponent* gfxComponent : view.visibleComponents)
+			{
+				if (gfxComponent->UpdateLevelsOfDetail(camComponent, m_residencyManager))
+					forceInvalidation = true;
+			}
+
 			if (camComponent.UpdateVisibility(visibilityHash) || m_forceRenderQueueInvalidation || forceInvalidation)
 			{
-				renderQueue->Clear();
-				for (const GraphicsComponent* gfxComponent : m_drawableCulling)
-					gfxComponent->AddToRenderQueue(renderQueue);
+				Nz::Profiler::Scope cpuProfilerScope("RenderSystem::FillRenderQueue");
 
-				for (const Ndk::EntityHandle& light : m_lights)
+				renderQueue->Clear();
+				for (const GraphicsComponent* gfxComponent : view.visibleComponents)
 				{
-					LightComponent& lightComponent = light->GetComponent<LightComponent>();
-					NodeComponent& lightNode = light->GetComponent<NodeComponent>();
-
-					///TODO: Cache somehow?
-					lightComponent.AddToRenderQueue(renderQueue, Nz::Matrix4f::ConcatenateAffine(m_coordinateSystemMatrix, lightNode.GetTransformMatrix()));
+					if (!occlusion || occlusion->culler.IsVisible(gfxComponent))
+						gfxComponent->AddToRenderQueue(renderQueue);
 				}
 
-				for (const Ndk::EntityHandle& particleGroup : m_particleGroups)
-				{
-					ParticleGroupComponent& groupComponent = particleGroup->GetComponent<ParticleGroupComponent>();
-
-					groupComponent.AddToRenderQueue(renderQueue, Nz::Matrix4f::Identity()); //< ParticleGroup doesn't use any transform matrix (yet)
-				}
+				for (const ParticleGroupComponent* groupComponent : m_visibleParticleGroups)
+					groupComponent->AddToRenderQueue(renderQueue, Nz::Matrix4f::Identity()); //< ParticleGroup doesn't use any transform matrix (yet)
 
 				m_forceRenderQueueInvalidation = false;
+				m_particleGroupsQueued = !m_visibleParticleGroups.empty();
+				m_queuedCamera = camera;
+			}
+			else
+				renderQueue->ClearLights();
+
+			// Lights are cheap to queue and may move without changing the visible drawables, so only their part of the queue is rebuilt every frame
+			for (const Ndk::EntityHandle& light : m_lights)
+			{
+				LightComponent& lightComponent = light->GetComponent<LightComponent>();
+				NodeComponent& lightNode = light->GetComponent<NodeComponent>();
+
+				lightComponent.AddToRenderQueue(renderQueue, Nz::Matrix4f::ConcatenateAffine(m_coordinateSystemMatrix, lightNode.GetTransformMatrix()));
 			}
 
+			QueueReflectionProbes(renderQueue);
+
 			camComponent.ApplyView();
 
 			Nz::SceneData sceneData;
@@ -245,169 +670,689 @@ namespace Ndk
 			if (m_background && m_background->GetBackgroundType() == Nz::BackgroundType_Skybox)
 				sceneData.globalReflectionTexture = static_cast<Nz::SkyboxBackground*>(m_background.Get())->GetTexture();
 
-			m_renderTechnique->Clear(sceneData);
-			m_renderTechnique->Draw(sceneData);
+			{
+				Nz::Profiler::Scope cpuProfilerScope("RenderSystem::Draw");
+				Nz::GpuProfiler::Scope profilerScope("Draw");
+
+				m_renderTechnique->Clear(sceneData);
+				m_renderTechnique->Draw(sceneData);
+			}
+
+			// Every drawable passing frustum culling is tested against the depth left by this frame, for the next one
+			if (occlusion)
+			{
+				for (const GraphicsComponent* gfxComponent : view.visibleComponents)
+				{
+					const Nz::BoundingVolumef& boundingVolume = gfxComponent->GetBoundingVolume();
+					if (boundingVolume.IsFinite())
+						occlusion->culler.TestVisibility(gfxComponent, boundingVolume.aabb);
+				}
+
+				occlusion->visibilityChanged = occlusion->culler.Process(camComponent);
+			}
+		}
+
+		// Resources are requested by every camera before being streamed
+		if (m_residencyManager)
+		{
+			Nz::Profiler::Scope cpuProfilerScope("RenderSystem::Residency");
+			m_residencyManager->Update();
+		}
+
+		if (gpuProfiling && m_gpuProfiler.EndFrame())
+		{
+			World& world = GetWorld();
+
+			Nz::UInt64 frameGpuTime = 0;
+			for (const Nz::GpuProfiler::SectionResult& result : m_gpuProfiler.GetResults())
+			{
+				if (result.depth == 0)
+					frameGpuTime += result.duration;
+
+				if (worldProfiling)
+					world.AddProfilerGpuTime(result.name, result.duration / 1000);
+			}
+
+			if (m_dynamicResolutionEnabled)
+				m_dynamicResolution.Update(frameGpuTime);
 		}
 	}
 
 	/*!
-	* \brief Updates the directional shadow maps according to the position of the viewer
+	* \brief Culls the drawables for every view of the frame
 	*
-	* \param viewer Viewer of the scene
+	* Views (shadow casting point and spot light faces, cameras, then directional light cascades) are collected first, then culled in parallel since culling only reads the culling list.
+	* Filling the render queues and drawing still happens afterwards, from this thread.
 	*/
 
-	void RenderSystem::UpdateDynamicReflections()
+	void RenderSystem::CullViews()
 	{
-		Nz::SceneData dummySceneData;
-		dummySceneData.ambientColor = Nz::Color(0, 0, 0);
-		dummySceneData.background = nullptr;
-		dummySceneData.viewer = nullptr; //< Depth technique doesn't require any viewer
-
-		for (const Ndk::EntityHandle& handle : m_realtimeReflected)
+		// Views are kept from one frame to the next so their result containers do not have to be allocated again
+		std::size_t viewCount = 0;
+		auto AddView = [&]() -> View&
 		{
-			//NazaraWarning("Realtime reflected: #" + handle->ToString());
-		}
-	}
+			if (viewCount == m_views.size())
+				m_views.emplace_back();
 
-	void RenderSystem::UpdateDirectionalShadowMaps(const Nz::AbstractViewer& /*viewer*/)
-	{
-		if (!m_shadowRT.IsValid())
-			m_shadowRT.Create();
+			return m_views[viewCount++];
+		};
 
-		Nz::SceneData dummySceneData;
-		dummySceneData.ambientColor = Nz::Color(0, 0, 0);
-		dummySceneData.background = nullptr;
-		dummySceneData.viewer = nullptr; //< Depth technique doesn't require any viewer
+		// Shadow maps aren't drawn by the render thread, their views would be culled for nothing
+		bool shadowViews = !m_renderThread;
 
-		for (const Ndk::EntityHandle& light : m_directionalLights)
+		for (const Ndk::EntityHandle& light : m_pointSpotLights)
 		{
 			LightComponent& lightComponent = light->GetComponent<LightComponent>();
 			NodeComponent& lightNode = light->GetComponent<NodeComponent>();
 
-			if (!lightComponent.IsShadowCastingEnabled())
+			if (!shadowViews || !lightComponent.IsShadowCastingEnabled())
+			{
+				m_shadowMapStates.erase(light->GetId());
 				continue;
+			}
+
+			switch (lightComponent.GetLightType())
+			{
+				case Nz::LightType_Directional:
+					NazaraInternalError("Directional lights included in point/spot light list");
+					break;
+
+				case Nz::LightType_Point:
+				{
+					///TODO: Cache the matrices in the light?
+					Nz::Matrix4f projectionMatrix = Nz::Matrix4f::Perspective(Nz::FromDegrees(90.f), 1.f, 0.1f, lightComponent.GetRadius());
+
+					for (unsigned int face = 0; face < 6; ++face)
+					{
+						View& view = AddView();
+						view.light = &lightComponent;
+						view.lightId = light->GetId();
+						view.projectionMatrix = projectionMatrix;
+						view.projectionType = Nz::ProjectionType_Perspective;
+						view.viewMatrix = Nz::Matrix4f::ViewMatrix(lightNode.GetPosition(), GetCubemapFaceRotation(face));
+						view.frustum.Extract(view.viewMatrix, view.projectionMatrix);
+						view.face = face;
+						view.zFar = lightComponent.GetRadius();
+						view.zNear = 0.1f;
+					}
+					break;
+				}
 
-			Nz::Vector2ui shadowMapSize(lightComponent.GetShadowMap()->GetSize());
+				case Nz::LightType_Spot:
+				{
+					View& view = AddView();
+					view.light = &lightComponent;
+					view.lightId = light->GetId();
+					view.projectionMatrix = Nz::Matrix4f::Perspective(lightComponent.GetOuterAngle()*2.f, 1.f, 0.1f, lightComponent.GetRadius());
+					view.projectionType = Nz::ProjectionType_Perspective;
+					view.viewMatrix = Nz::Matrix4f::ViewMatrix(lightNode.GetPosition(), lightNode.GetRotation());
+					view.frustum.Extract(view.viewMatrix, view.projectionMatrix);
+					view.face = 0;
+					view.zFar = lightComponent.GetRadius();
+					view.zNear = 0.1f;
+					break;
+				}
+			}
+		}
 
-			m_shadowRT.AttachTexture(Nz::AttachmentPoint_Depth, 0, lightComponent.GetShadowMap());
-			Nz::Renderer::SetTarget(&m_shadowRT);
-			Nz::Renderer::SetViewport(Nz::Recti(0, 0, shadowMapSize.x, shadowMapSize.y));
+		m_shadowViewCount = viewCount;
 
-			Nz::AbstractRenderQueue* renderQueue = m_shadowTechnique.GetRenderQueue();
-			renderQueue->Clear();
+		for (const Ndk::EntityHandle& camera : m_cameras)
+		{
+			CameraComponent& camComponent = camera->GetComponent<CameraComponent>();
 
-			///TODO: Culling
-			for (const Ndk::EntityHandle& drawable : m_drawables)
+			View& view = AddView();
+			view.frustum = camComponent.GetFrustum(); //< May update the camera, which must not happen in parallel
+			view.light = nullptr;
+		}
+
+		// Directional shadows follow the cameras: the view of each camera is split in slices up to the shadow distance, each one being covered by a cascade
+		m_directionalShadows.clear();
+
+		constexpr std::size_t cascadeCount = NAZARA_GRAPHICS_MAX_SHADOW_CASCADES;
+		constexpr float cascadeSize = (cascadeCount > 1) ? 0.5f : 1.f; //< Cascades are laid out in a 2x2 grid
+
+		for (std::size_t cameraIndex = 0; cameraIndex < m_cameras.size() && !m_directionalLights.empty() && shadowViews; ++cameraIndex)
+		{
+			CameraComponent& camComponent = m_cameras[cameraIndex]->GetComponent<CameraComponent>();
+			const Nz::Frustumf& cameraFrustum = camComponent.GetFrustum();
+
+			float zNear = camComponent.GetZNear();
+			float zFar = camComponent.GetZFar();
+			float shadowDistance = std::min(zFar, m_shadowDistance);
+
+			// Bounding spheres of the slices, they don't depend on the rotation of the camera which keeps the cascades from changing size
+			std::array<Nz::Vector3f, cascadeCount> sliceCenters;
+			std::array<float, cascadeCount> sliceRadii;
+
+			float sliceBegin = zNear;
+			for (std::size_t i = 0; i < cascadeCount; ++i)
 			{
-				GraphicsComponent& graphicsComponent = drawable->GetComponent<GraphicsComponent>();
+				// Practical split scheme, halfway between logarithmic and uniform splits
+				float ratio = static_cast<float>(i + 1) / cascadeCount;
+				float sliceEnd = Nz::Lerp(zNear + (shadowDistance - zNear) * ratio, zNear * std::pow(shadowDistance / zNear, ratio), 0.5f);
+
+				float begin = (sliceBegin - zNear) / (zFar - zNear);
+				float end = (sliceEnd - zNear) / (zFar - zNear);
 
-				graphicsComponent.AddToRenderQueue(renderQueue);
+				Nz::Vector3f corners[8];
+				Nz::Vector3f center = Nz::Vector3f::Zero();
+				for (unsigned int j = 0; j < 4; ++j)
+				{
+					const Nz::Vector3f& farCorner = cameraFrustum.GetCorner(static_cast<Nz::BoxCorner>(Nz::BoxCorner_FarLeftBottom + j));
+					const Nz::Vector3f& nearCorner = cameraFrustum.GetCorner(static_cast<Nz::BoxCorner>(Nz::BoxCorner_NearLeftBottom + j));
+
+					corners[j * 2 + 0] = Nz::Vector3f::Lerp(nearCorner, farCorner, begin);
+					corners[j * 2 + 1] = Nz::Vector3f::Lerp(nearCorner, farCorner, end);
+
+					center += corners[j * 2 + 0] + corners[j * 2 + 1];
+				}
+				center /= 8.f;
+
+				float radius = 0.f;
+				for (const Nz::Vector3f& corner : corners)
+					radius = std::max(radius, center.Distance(corner));
+
+				sliceCenters[i] = center;
+				sliceRadii[i] = radius;
+				sliceBegin = sliceEnd;
 			}
 
-			///TODO: Cache the matrices in the light?
-			Nz::Renderer::SetMatrix(Nz::MatrixType_Projection, Nz::Matrix4f::Ortho(0.f, 100.f, 100.f, 0.f, 1.f, 100.f));
-			Nz::Renderer::SetMatrix(Nz::MatrixType_View, Nz::Matrix4f::ViewMatrix(lightNode.GetRotation() * Nz::Vector3f::Forward() * 100.f, lightNode.GetRotation()));
+			for (const Ndk::EntityHandle& light : m_directionalLights)
+			{
+				LightComponent& lightComponent = light->GetComponent<LightComponent>();
+				NodeComponent& lightNode = light->GetComponent<NodeComponent>();
+
+				if (!lightComponent.IsShadowCastingEnabled())
+				{
+					m_shadowMapStates.erase(light->GetId());
+					continue;
+				}
+
+				Nz::Matrix4f lightViewMatrix = Nz::Matrix4f::ViewMatrix(Nz::Vector3f::Zero(), lightNode.GetRotation());
+				float cascadeResolution = lightComponent.GetShadowMapSize().x * cascadeSize;
 
-			m_shadowTechnique.Clear(dummySceneData);
-			m_shadowTechnique.Draw(dummySceneData);
+				// Every cascade shares the depth range of the widest one, reaching back towards the light to include casters outside of the view
+				Nz::Vector3f widestCenter = lightViewMatrix.Transform(sliceCenters.back());
+				float widestRadius = sliceRadii.back();
+				float depthNear = -(widestCenter.z + widestRadius) - m_shadowDistance;
+				float depthFar = -(widestCenter.z - widestRadius);
+
+				std::array<Nz::Vector2f, cascadeCount> origins;
+				for (std::size_t i = 0; i < cascadeCount; ++i)
+				{
+					Nz::Vector3f center = lightViewMatrix.Transform(sliceCenters[i]);
+					float radius = sliceRadii[i];
+
+					// Cascades are moved by whole texels, so the shadows don't shimmer as the camera moves
+					float texelSize = radius * 2.f / cascadeResolution;
+					origins[i].Set(std::floor((center.x - radius) / texelSize) * texelSize, std::floor((center.y - radius) / texelSize) * texelSize);
+				}
+
+				DirectionalShadow shadow;
+				shadow.cameraIndex = cameraIndex;
+				shadow.firstView = viewCount;
+				shadow.light = &lightComponent;
+
+				const Nz::Vector2f& widestOrigin = origins.back();
+				for (std::size_t i = 0; i < cascadeCount; ++i)
+				{
+					const Nz::Vector2f& origin = origins[i];
+					float size = sliceRadii[i] * 2.f;
+
+					View& view = AddView();
+					view.light = &lightComponent;
+					view.lightId = light->GetId();
+					view.projectionMatrix = Nz::Matrix4f::Ortho(origin.x, origin.x + size, origin.y + size, origin.y, depthNear, depthFar);
+					view.projectionType = Nz::ProjectionType_Orthogonal;
+					view.viewMatrix = lightViewMatrix;
+					view.frustum.Extract(view.viewMatrix, view.projectionMatrix);
+					view.face = static_cast<unsigned int>(i);
+					view.zFar = depthFar;
+					view.zNear = depthNear;
+
+					// Brings the coordinates of the widest cascade to the ones of this cascade
+					shadow.cascades[i].Set(widestRadius * 2.f / size, (widestOrigin.x - origin.x) / size, (widestOrigin.y - origin.y) / size, cascadeSize);
+				}
+
+				shadow.viewProjMatrix = lightViewMatrix * m_views[viewCount - 1].projectionMatrix;
+
+				m_directionalShadows.push_back(shadow);
+			}
 		}
+
+		Nz::TaskScheduler::ParallelFor(0, viewCount, 1, [this](std::size_t begin, std::size_t end)
+		{
+			for (std::size_t i = begin; i < end; ++i)
+			{
+				View& view = m_views[i];
+				view.visibilityHash = m_drawableCulling.Cull(view.frustum, view.visibleComponents, &view.forceInvalidation);
+			}
+		});
+
+		// Every view saw the invalidation requests, they can be reset
+		m_drawableCulling.ClearInvalidations();
 	}
 
 	/*!
-	* \brief Updates the point spot shadow maps
+	* \brief Draws the next face of a reflection probe cubemap
+	*
+	* \param probe Reflection probe to draw
+	* \param position Global position of the probe
+	*
+	* \remark Reflection probes are not queued for this draw, so they don't reflect each other
 	*/
 
-	void RenderSystem::UpdatePointSpotShadowMaps()
+	void RenderSystem::DrawReflectionProbeFace(ReflectionProbeComponent& probe, const Nz::Vector3f& position)
 	{
-		if (!m_shadowRT.IsValid())
-			m_shadowRT.Create();
+		if (!probe.EnsureTexture())
+			return;
 
-		Nz::SceneData dummySceneData;
-		dummySceneData.ambientColor = Nz::Color(0, 0, 0);
-		dummySceneData.background = nullptr;
-		dummySceneData.viewer = nullptr; //< Depth technique doesn't require any viewer
+		unsigned int size = probe.GetSize();
+		if (!m_probeDepthMap || m_probeDepthMap->GetWidth() != size)
+		{
+			m_probeDepthMap = Nz::Texture::New();
+			if (!m_probeDepthMap->Create(Nz::ImageType_2D, Nz::PixelFormatType_Depth24, size, size))
+			{
+				NazaraError("Failed to create reflection probe depth map");
+				m_probeDepthMap.Reset();
+				return;
+			}
+		}
 
-		for (const Ndk::EntityHandle& light : m_pointSpotLights)
+		if (!m_probeRT.IsValid())
+			m_probeRT.Create();
+
+		unsigned int face = probe.m_nextFace;
+		m_probeRT.AttachTexture(Nz::AttachmentPoint_Color, 0, probe.GetTexture(), face);
+		m_probeRT.AttachTexture(Nz::AttachmentPoint_Depth, 0, m_probeDepthMap);
+
+		float zNear = 0.1f;
+		float zFar = probe.GetDrawDistance();
+
+		Nz::Matrix4f projectionMatrix = Nz::Matrix4f::Perspective(90.f, 1.f, zNear, zFar);
+		Nz::Matrix4f viewMatrix = Nz::Matrix4f::ViewMatrix(m_coordinateSystemMatrix.Transform(position), GetCubemapFaceRotation(face));
+
+		Nz::Frustumf frustum;
+		frustum.Extract(viewMatrix, projectionMatrix);
+
+		m_drawableCulling.Cull(frustum, m_probeVisibleComponents);
+
+		ShadowViewer viewer(&m_probeRT, Nz::Recti(0, 0, size, size), frustum, projectionMatrix, viewMatrix, Nz::ProjectionType_Perspective, zNear, zFar);
+		viewer.ApplyView();
+
+		Nz::AbstractRenderQueue* renderQueue = m_probeTechnique.GetRenderQueue();
+		renderQueue->Clear();
+
+		for (const GraphicsComponent* gfxComponent : m_probeVisibleComponents)
+			gfxComponent->AddToRenderQueue(renderQueue);
+
+		for (const Ndk::EntityHandle& light : m_lights)
 		{
 			LightComponent& lightComponent = light->GetComponent<LightComponent>();
 			NodeComponent& lightNode = light->GetComponent<NodeComponent>();
 
-			if (!lightComponent.IsShadowCastingEnabled())
+			lightComponent.AddToRenderQueue(renderQueue, Nz::Matrix4f::ConcatenateAffine(m_coordinateSystemMatrix, lightNode.GetTransformMatrix()));
+		}
+
+		Nz::SceneData sceneData;
+		sceneData.ambientColor = Nz::Color(25, 25, 25);
+		sceneData.background = m_background;
+		sceneData.globalReflectionTexture = nullptr;
+		sceneData.viewer = &viewer;
+
+		if (m_background && m_background->GetBackgroundType() == Nz::BackgroundType_Skybox)
+			sceneData.globalReflectionTexture = static_cast<Nz::SkyboxBackground*>(m_background.Get())->GetTexture();
+
+		m_probeTechnique.Clear(sceneData);
+		m_probeTechnique.Draw(sceneData);
+
+		probe.m_nextFace = (face + 1) % 6;
+		if (probe.m_nextFace == 0)
+		{
+			probe.m_ready = true;
+			probe.m_upToDate = true;
+		}
+	}
+
+	/*!
+	* \brief Draws the casters of a shadow view in its slot of the light shadow map (cube face or cascade)
+	*
+	* The slot is left untouched if it was drawn last time from the same point of view with the same casters, none of them having moved since,
+	* so shadow maps of lights whose volume doesn't change are not drawn again
+	*
+	* \param view Shadow view to draw
+	* \param viewport Part of the shadow map holding the slot
+	*/
+
+	void RenderSystem::DrawShadowView(const View& view, const Nz::Recti& viewport)
+	{
+		const Nz::TextureRef& shadowMap = view.light->GetShadowMap();
+
+		ShadowMapState& state = m_shadowMapStates[view.lightId][view.face];
+		if (state.texture == shadowMap && state.format == shadowMap->GetFormat() && state.size == Nz::Vector2ui(shadowMap->GetSize()) &&
+		    state.visibilityHash == view.visibilityHash && !view.forceInvalidation &&
+		    state.projectionMatrix == view.projectionMatrix && state.viewMatrix == view.viewMatrix)
+			return;
+
+		if (!m_shadowRT.IsValid())
+			m_shadowRT.Create();
+
+		unsigned int layer = (view.light->GetLightType() == Nz::LightType_Point) ? view.face : 0;
+		m_shadowRT.AttachTexture(Nz::AttachmentPoint_Depth, 0, shadowMap, layer);
+
+		ShadowViewer viewer(&m_shadowRT, viewport, view.frustum, view.projectionMatrix, view.viewMatrix, view.projectionType, view.zNear, view.zFar);
+		viewer.ApplyView();
+
+		// Only the slot is cleared, the other ones may be kept from the previous frames
+		Nz::Renderer::SetScissorRect(viewport);
+		Nz::Renderer::Enable(Nz::RendererParameter_DepthBuffer, true);
+		Nz::Renderer::Enable(Nz::RendererParameter_DepthWrite, true);
+		Nz::Renderer::Enable(Nz::RendererParameter_ScissorTest, true);
+		Nz::Renderer::Clear(Nz::RendererBuffer_Depth);
+		Nz::Renderer::Enable(Nz::RendererParameter_ScissorTest, false);
+
+		Nz::AbstractRenderQueue* renderQueue = m_shadowTechnique.GetRenderQueue();
+		renderQueue->Clear();
+
+		for (const GraphicsComponent* gfxComponent : view.visibleComponents)
+			gfxComponent->AddToRenderQueue(renderQueue);
+
+		Nz::SceneData sceneData;
+		sceneData.ambientColor = Nz::Color(0, 0, 0);
+		sceneData.background = nullptr;
+		sceneData.globalReflectionTexture = nullptr;
+		sceneData.viewer = &viewer;
+
+		m_shadowTechnique.Draw(sceneData);
+
+		state.format = shadowMap->GetFormat();
+		state.projectionMatrix = view.projectionMatrix;
+		state.size = Nz::Vector2ui(shadowMap->GetSize());
+		state.texture = shadowMap;
+		state.viewMatrix = view.viewMatrix;
+		state.visibilityHash = view.visibilityHash;
+	}
+
+	/*!
+	* \brief Adds the reflection probes usable by the drawables to a render queue
+	*
+	* \param renderQueue Render queue of a camera
+	*/
+
+	void RenderSystem::QueueReflectionProbes(Nz::AbstractRenderQueue* renderQueue) const
+	{
+		for (const EntityHandle& probeEntity : m_reflectionProbes)
+		{
+			const ReflectionProbeComponent& probe = probeEntity->GetComponent<ReflectionProbeComponent>();
+			if (!probe.IsReady())
 				continue;
 
-			Nz::Vector2ui shadowMapSize(lightComponent.GetShadowMap()->GetSize());
+			const NodeComponent& probeNode = probeEntity->GetComponent<NodeComponent>();
 
-			switch (lightComponent.GetLightType())
-			{
-				case Nz::LightType_Directional:
-					NazaraInternalError("Directional lights included in point/spot light list");
-					break;
+			Nz::AbstractRenderQueue::ReflectionProbe reflectionProbe;
+			reflectionProbe.cubemap = probe.GetTexture();
+			reflectionProbe.position = m_coordinateSystemMatrix.Transform(probeNode.GetPosition(Nz::CoordSys_Global));
+			reflectionProbe.radius = probe.GetRadius();
 
-				case Nz::LightType_Point:
-				{
-					static Nz::Quaternionf rotations[6] =
-					{
-						Nz::Quaternionf::RotationBetween(Nz::Vector3f::Forward(),  Nz::Vector3f::UnitX()), // CubemapFace_PositiveX
-						Nz::Quaternionf::RotationBetween(Nz::Vector3f::Forward(), -Nz::Vector3f::UnitX()), // CubemapFace_NegativeX
-						Nz::Quaternionf::RotationBetween(Nz::Vector3f::Forward(), -Nz::Vector3f::UnitY()), // CubemapFace_PositiveY
-						Nz::Quaternionf::RotationBetween(Nz::Vector3f::Forward(),  Nz::Vector3f::UnitY()), // CubemapFace_NegativeY
-						Nz::Quaternionf::RotationBetween(Nz::Vector3f::Forward(), -Nz::Vector3f::UnitZ()), // CubemapFace_PositiveZ
-						Nz::Quaternionf::RotationBetween(Nz::Vector3f::Forward(),  Nz::Vector3f::UnitZ())  // CubemapFace_NegativeZ
-					};
+			renderQueue->AddReflectionProbe(reflectionProbe);
+		}
+	}
 
-					for (unsigned int face = 0; face < 6; ++face)
-					{
-						m_shadowRT.AttachTexture(Nz::AttachmentPoint_Depth, 0, lightComponent.GetShadowMap(), face);
-						Nz::Renderer::SetTarget(&m_shadowRT);
-						Nz::Renderer::SetViewport(Nz::Recti(0, 0, shadowMapSize.x, shadowMapSize.y));
+	/*!
+	* \brief Fills the next frame packet with the cameras of the frame and submits it to the render thread
+	*
+	* Each camera gets its whole render queue filled again, through a SnapshotRenderQueue copying what the renderables may change before the packet is drawn.
+	*/
 
-						///TODO: Cache the matrices in the light?
-						Nz::Renderer::SetMatrix(Nz::MatrixType_Projection, Nz::Matrix4f::Perspective(Nz::FromDegrees(90.f), 1.f, 0.1f, lightComponent.GetRadius()));
-						Nz::Renderer::SetMatrix(Nz::MatrixType_View, Nz::Matrix4f::ViewMatrix(lightNode.GetPosition(), rotations[face]));
+	void RenderSystem::SubmitFramePacket()
+	{
+		// Packets are filled in turn, the render thread being at most pipelineDepth packets behind this one is already drawn
+		FramePacket& packet = *m_framePackets[m_framePacketIndex];
+		m_framePacketIndex = (m_framePacketIndex + 1) % m_framePackets.size();
 
-						Nz::AbstractRenderQueue* renderQueue = m_shadowTechnique.GetRenderQueue();
-						renderQueue->Clear();
+		packet.passes.resize(m_cameras.size());
+		packet.windows.clear();
 
-						///TODO: Culling
-						for (const Ndk::EntityHandle& drawable : m_drawables)
-						{
-							GraphicsComponent& graphicsComponent = drawable->GetComponent<GraphicsComponent>();
+		Nz::RenderTechniqueType techniqueType = m_renderTechnique->GetType();
 
-							graphicsComponent.AddToRenderQueue(renderQueue);
-						}
+		for (std::size_t cameraIndex = 0; cameraIndex < m_cameras.size(); ++cameraIndex)
+		{
+			CameraComponent& camComponent = m_cameras[cameraIndex]->GetComponent<CameraComponent>();
+			const View& view = m_views[m_shadowViewCount + cameraIndex];
 
-						m_shadowTechnique.Clear(dummySceneData);
-						m_shadowTechnique.Draw(dummySceneData);
-					}
+			FramePacket::CameraPass& pass = packet.passes[cameraIndex];
+			if (!pass.technique || pass.technique->GetType() != techniqueType)
+			{
+				pass.renderQueue.reset();
+				pass.technique.reset(Nz::RenderTechniques::GetByEnum(techniqueType));
+				if (!pass.technique)
+				{
+					NazaraError("Failed to create render technique " + Nz::RenderTechniques::ToString(techniqueType));
+					packet.passes.resize(cameraIndex);
 					break;
 				}
 
-				case Nz::LightType_Spot:
-				{
-					m_shadowRT.AttachTexture(Nz::AttachmentPoint_Depth, 0, lightComponent.GetShadowMap());
-					Nz::Renderer::SetTarget(&m_shadowRT);
-					Nz::Renderer::SetViewport(Nz::Recti(0, 0, shadowMapSize.x, shadowMapSize.y));
+				pass.renderQueue = std::make_unique<Nz::SnapshotRenderQueue>(pass.technique->GetRenderQueue());
+			}
 
-					///TODO: Cache the matrices in the light?
-					Nz::Renderer::SetMatrix(Nz::MatrixType_Projection, Nz::Matrix4f::Perspective(lightComponent.GetOuterAngle()*2.f, 1.f, 0.1f, lightComponent.GetRadius()));
-					Nz::Renderer::SetMatrix(Nz::MatrixType_View, Nz::Matrix4f::ViewMatrix(lightNode.GetPosition(), lightNode.GetRotation()));
+			Nz::SnapshotRenderQueue* renderQueue = pass.renderQueue.get();
 
-					Nz::AbstractRenderQueue* renderQueue = m_shadowTechnique.GetRenderQueue();
-					renderQueue->Clear();
+			{
+				Nz::Profiler::Scope cpuProfilerScope("RenderSystem::FillRenderQueue");
 
-					///TODO: Culling
-					for (const Ndk::EntityHandle& drawable : m_drawables)
-					{
-						GraphicsComponent& graphicsComponent = drawable->GetComponent<GraphicsComponent>();
+				renderQueue->Clear();
+				for (const GraphicsComponent* gfxComponent : view.visibleComponents)
+				{
+					gfxComponent->UpdateLevelsOfDetail(camComponent, m_residencyManager);
+					gfxComponent->AddToRenderQueue(renderQueue);
+				}
 
-						graphicsComponent.AddToRenderQueue(renderQueue);
-					}
+				for (const Ndk::EntityHandle& particleGroup : m_particleGroups)
+				{
+					const ParticleGroupComponent& groupComponent = particleGroup->GetComponent<ParticleGroupComponent>();
+					groupComponent.EnsureBoundingVolumeUpdated();
 
-					m_shadowTechnique.Clear(dummySceneData);
-					m_shadowTechnique.Draw(dummySceneData);
-					break;
+					if (groupComponent.Cull(view.frustum, Nz::Matrix4f::Identity()))
+						groupComponent.AddToRenderQueue(renderQueue, Nz::Matrix4f::Identity()); //< ParticleGroup doesn't use any transform matrix (yet)
 				}
+
+				for (const Ndk::EntityHandle& light : m_lights)
+				{
+					LightComponent& lightComponent = light->GetComponent<LightComponent>();
+					NodeComponent& lightNode = light->GetComponent<NodeComponent>();
+
+					lightComponent.AddToRenderQueue(renderQueue, Nz::Matrix4f::ConcatenateAffine(m_coordinateSystemMatrix, lightNode.GetTransformMatrix()));
+				}
+
+				QueueReflectionProbes(renderQueue);
+			}
+
+			pass.viewer.Capture(camComponent);
+
+			pass.sceneData.ambientColor = Nz::Color(25, 25, 25);
+			pass.sceneData.background = m_background;
+			pass.sceneData.globalReflectionTexture = nullptr;
+			pass.sceneData.viewer = &pass.viewer;
+
+			if (m_background && m_background->GetBackgroundType() == Nz::BackgroundType_Skybox)
+				pass.sceneData.globalReflectionTexture = static_cast<Nz::SkyboxBackground*>(m_background.Get())->GetTexture();
+
+			// Displaying a window changes it, but cameras only know their target as constant
+			Nz::RenderWindow* window = const_cast<Nz::RenderWindow*>(dynamic_cast<const Nz::RenderWindow*>(camComponent.GetTarget()));
+			if (window && std::find(packet.windows.begin(), packet.windows.end(), window) == packet.windows.end())
+				packet.windows.push_back(window);
+		}
+
+		// The targets are activated by the render thread, their context can't stay current on this one
+		const Nz::Context* threadContext = Nz::Context::GetThreadContext();
+		if (threadContext && Nz::Context::GetCurrent() != threadContext)
+			threadContext->SetActive(true);
+
+		m_renderThread->Submit([&packet]()
+		{
+			for (const FramePacket::CameraPass& pass : packet.passes)
+			{
+				pass.viewer.ApplyView();
+
+				pass.technique->Clear(pass.sceneData);
+				pass.technique->Draw(pass.sceneData);
+			}
+
+			for (Nz::RenderWindow* window : packet.windows)
+				window->Display();
+		});
+	}
+
+	/*!
+	* \brief Updates the bounding volumes of the drawables which were invalidated
+	*
+	* Local boxes and world matrices of the invalidated drawables are packed together, so their volumes are computed in a single pass.
+	* Only the drawables whose volume changed are updated in the culling lists.
+	*/
+
+	void RenderSystem::UpdateBoundingVolumes()
+	{
+		m_dirtyVolumeComponents.clear();
+		m_dirtyVolumeLocalBoxes.clear();
+		m_dirtyVolumeMatrices.clear();
+
+		for (const Ndk::EntityHandle& drawable : m_drawables)
+		{
+			const GraphicsComponent& graphicsComponent = drawable->GetComponent<GraphicsComponent>();
+			if (graphicsComponent.m_boundingVolumeUpdated)
+				continue;
+
+			graphicsComponent.EnsureTransformMatrixUpdate();
+
+			Nz::BoundingVolumef localVolume = graphicsComponent.ComputeLocalBoundingVolume();
+			if (!localVolume.IsFinite())
+			{
+				// Null and infinite volumes are not affected by the transform
+				graphicsComponent.SetBoundingVolume(localVolume);
+				continue;
+			}
+
+			m_dirtyVolumeComponents.push_back(&graphicsComponent);
+			m_dirtyVolumeLocalBoxes.push_back(localVolume.obb.localBox);
+			m_dirtyVolumeMatrices.push_back(Nz::Matrix4f::ConcatenateAffine(m_coordinateSystemMatrix, graphicsComponent.m_transformMatrix));
+		}
+
+		std::size_t volumeCount = m_dirtyVolumeComponents.size();
+		m_dirtyVolumes.resize(volumeCount);
+
+		Nz::BoundingVolumef::Update(m_dirtyVolumeLocalBoxes.data(), m_dirtyVolumeMatrices.data(), volumeCount, m_dirtyVolumes.data());
+
+		for (std::size_t i = 0; i < volumeCount; ++i)
+			m_dirtyVolumeComponents[i]->SetBoundingVolume(m_dirtyVolumes[i]);
+	}
+
+	/*!
+	* \brief Draws and caches the reflection probes, within the face budget of the frame
+	*
+	* Static probes are completed first, from their cache file when it's available, then saved to it;
+	* real-time probes are drawn in turn afterwards, each of them getting its next face until the budget is spent.
+	*/
+
+	void RenderSystem::UpdateReflectionProbes()
+	{
+		unsigned int faceBudget = m_reflectionFaceBudget;
+
+		for (const EntityHandle& probeEntity : m_reflectionProbes)
+		{
+			ReflectionProbeComponent& probe = probeEntity->GetComponent<ReflectionProbeComponent>();
+			if (probe.IsRealTimeUpdateEnabled() || probe.m_upToDate)
+				continue;
+
+			// A static probe only needs to be drawn once, unless its surroundings were invalidated
+			if (probe.m_nextFace == 0 && probe.LoadCache())
+				continue;
+
+			if (faceBudget == 0)
+				return;
+
+			const Nz::Vector3f& position = probeEntity->GetComponent<NodeComponent>().GetPosition(Nz::CoordSys_Global);
+			while (faceBudget > 0 && !probe.m_upToDate)
+			{
+				DrawReflectionProbeFace(probe, position);
+				faceBudget--;
+			}
+
+			if (probe.m_upToDate)
+				probe.SaveCache();
+		}
+
+		// The remaining budget goes to the real-time probes, a probe keeping the cursor until its six faces are drawn (and being drawn once per frame at most)
+		for (std::size_t attempts = 0; faceBudget > 0 && attempts < m_reflectionProbes.size(); ++attempts)
+		{
+			m_reflectionProbeCursor %= m_reflectionProbes.size();
+
+			const EntityHandle& probeEntity = m_reflectionProbes[m_reflectionProbeCursor];
+			ReflectionProbeComponent& probe = probeEntity->GetComponent<ReflectionProbeComponent>();
+			if (!probe.IsRealTimeUpdateEnabled())
+			{
+				m_reflectionProbeCursor++;
+				continue;
+			}
+
+			const Nz::Vector3f& position = probeEntity->GetComponent<NodeComponent>().GetPosition(Nz::CoordSys_Global);
+			do
+			{
+				DrawReflectionProbeFace(probe, position);
+				faceBudget--;
 			}
+			while (faceBudget > 0 && probe.m_nextFace != 0);
+
+			if (probe.m_nextFace == 0)
+				m_reflectionProbeCursor++;
+		}
+	}
+
+	/*!
+	* \brief Updates the cascades of the directional shadow maps for a camera
+	*
+	* \param cameraIndex Index of the camera in the list of cameras
+	*
+	* \remark The cascades are given to the lights, which have to be queued afterwards
+	*/
+
+	void RenderSystem::UpdateDirectionalShadowMaps(std::size_t cameraIndex)
+	{
+		for (const DirectionalShadow& shadow : m_directionalShadows)
+		{
+			if (shadow.cameraIndex != cameraIndex)
+				continue;
+
+			Nz::Vector2ui shadowMapSize(shadow.light->GetShadowMap()->GetSize());
+			unsigned int cascadeWidth = static_cast<unsigned int>(shadowMapSize.x * shadow.cascades[0].w);
+			unsigned int cascadeHeight = static_cast<unsigned int>(shadowMapSize.y * shadow.cascades[0].w);
+
+			for (std::size_t i = 0; i < shadow.cascades.size(); ++i)
+			{
+				// Cascades are laid out from the bottom left corner of the shadow map, while viewports start from its top left corner
+				unsigned int column = i % 2;
+				unsigned int row = static_cast<unsigned int>(i / 2);
+
+				Nz::Recti viewport(column * cascadeWidth, shadowMapSize.y - (row + 1) * cascadeHeight, cascadeWidth, cascadeHeight);
+				DrawShadowView(m_views[shadow.firstView + i], viewport);
+			}
+
+			shadow.light->SetShadowCascades(shadow.viewProjMatrix, shadow.cascades.data(), shadow.cascades.size());
+		}
+	}
+
+	/*!
+	* \brief Updates the point spot shadow maps
+	*/
+
+	void RenderSystem::UpdatePointSpotShadowMaps()
+	{
+		for (std::size_t i = 0; i < m_shadowViewCount; ++i)
+		{
+			const View& view = m_views[i];
+
+			Nz::Vector2ui shadowMapSize(view.light->GetShadowMap()->GetSize());
+			DrawShadowView(view, Nz::Recti(0, 0, shadowMapSize.x, shadowMapSize.y));
 		}
 	}
 
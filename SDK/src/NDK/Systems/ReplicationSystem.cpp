@@ -0,0 +1,782 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequisites.hpp
+
+#include <NDK/Systems/ReplicationSystem.hpp>
+#include <Nazara/Core/MemoryStream.hpp>
+#include <Nazara/Core/MemoryView.hpp>
+#include <NDK/Components/NodeComponent.hpp>
+#include <NDK/World.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace Ndk
+{
+	namespace
+	{
+		enum Opcode : Nz::UInt8
+		{
+			Opcode_End,
+			Opcode_Despawn,
+			Opcode_Spawn,
+			Opcode_Update
+		};
+
+		Nz::UInt8 GetBaselineByte(const Nz::ByteArray& baseline, std::size_t i)
+		{
+			return (i < baseline.GetSize()) ? baseline[i] : Nz::UInt8(0);
+		}
+
+		// Data is written as its difference (XOR) with the baseline, made of runs of unchanged bytes followed by runs of changed ones
+		void EncodeDelta(const Nz::ByteArray& baseline, const Nz::ByteArray& data, Nz::ByteArray* delta)
+		{
+			delta->Clear(true);
+
+			std::size_t size = data.GetSize();
+			std::size_t i = 0;
+			while (i < size)
+			{
+				Nz::UInt8 unchanged = 0;
+				while (i < size && unchanged < 255 && data[i] == GetBaselineByte(baseline, i))
+				{
+					unchanged++;
+					i++;
+				}
+
+				std::size_t changedStart = i;
+				Nz::UInt8 changed = 0;
+				while (i < size && changed < 255 && data[i] != GetBaselineByte(baseline, i))
+				{
+					changed++;
+					i++;
+				}
+
+				delta->PushBack(unchanged);
+				delta->PushBack(changed);
+				for (std::size_t j = changedStart; j < i; ++j)
+					delta->PushBack(data[j] ^ GetBaselineByte(baseline, j));
+			}
+		}
+
+		bool DecodeDelta(const Nz::ByteArray& baseline, const Nz::ByteArray& delta, std::size_t size, Nz::ByteArray* data)
+		{
+			data->Resize(size);
+
+			std::size_t i = 0;
+			std::size_t readPos = 0;
+			while (i < size)
+			{
+				if (readPos + 2 > delta.GetSize())
+					return false;
+
+				Nz::UInt8 unchanged = delta[readPos++];
+				Nz::UInt8 changed = delta[readPos++];
+				if (i + unchanged + changed > size || readPos + changed > delta.GetSize())
+					return false;
+
+				for (Nz::UInt8 j = 0; j < unchanged; ++j, ++i)
+					(*data)[i] = GetBaselineByte(baseline, i);
+
+				for (Nz::UInt8 j = 0; j < changed; ++j, ++i)
+					(*data)[i] = delta[readPos++] ^ GetBaselineByte(baseline, i);
+			}
+
+			return readPos == delta.GetSize();
+		}
+	}
+
+	/*!
+	* \ingroup NDK
+	* \class Ndk::ReplicationSystem
+	* \brief NDK class that replicates entities to clients through their ENetPeer
+	*
+	* On the server, every update compares the serialized components of the entities with their previous state, and sends
+	* to each client the entities which changed since it last received them, within its view radius (found by the SpatialSystem of the world).
+	* Changed components are written as a difference with what the client received, and entities are sent by priority
+	* order (accumulated while they wait, scaled down by their distance) until the bandwidth of the client is consumed.
+	*
+	* On the client, the same system applies these snapshots to its world with ApplySnapshot.
+	*
+	* \remark This system is enabled if the entity owns a component with a registered serializer (at the system construction)
+	* \remark Snapshots are sent reliably, the peers host must be serviced for them to be sent
+	*
+	* \see Component::RegisterSerializer
+	*/
+
+	/*!
+	* \brief Constructs an ReplicationSystem object by default
+	*/
+	ReplicationSystem::ReplicationSystem() :
+	m_netCode(1),
+	m_channel(0)
+	{
+		for (ComponentIndex index = 0; index < BaseComponent::GetMaxComponentIndex(); ++index)
+		{
+			if (BaseComponent::IsSerializable(index))
+			{
+				RequiresAnyComponent(index);
+				ReadsComponent(index);
+			}
+		}
+
+		SetUpdateOrder(100); //< After every system which may change entities
+	}
+
+	/*!
+	* \brief Starts replicating entities to a client
+	*
+	* The client sees every entity until its viewpoint is set, without any bandwidth limit.
+	*
+	* \param peer Peer of the client
+	*
+	* \see SetClientBandwidth, SetClientViewpoint
+	*/
+	void ReplicationSystem::AddClient(Nz::ENetPeer* peer)
+	{
+		NazaraAssert(peer, "Invalid peer");
+		NazaraAssert(!HasClient(peer), "Peer is already a client");
+
+		m_clients.emplace_back();
+		m_clients.back().peer = peer;
+	}
+
+	/*!
+	* \brief Applies a snapshot received from a server to the world
+	* \return true If the snapshot was valid
+	*
+	* Entities spawned by the server are created in the world, and killed when the server despawns them.
+	*
+	* \param packet Packet received from the server, with the net code of snapshots
+	*
+	* \see GetReplicatedEntity
+	*/
+	bool ReplicationSystem::ApplySnapshot(Nz::NetPacket& packet)
+	{
+		Nz::SerializationContext context;
+		context.stream = packet.GetStream();
+
+		World& world = GetWorld();
+
+		Nz::ByteArray data;
+		for (;;)
+		{
+			Nz::UInt8 opcode;
+			if (!Nz::Unserialize(context, &opcode))
+				return false;
+
+			if (opcode == Opcode_End)
+				return true;
+
+			EntityId remoteId;
+			if (!Nz::Unserialize(context, &remoteId))
+				return false;
+
+			if (opcode == Opcode_Despawn)
+			{
+				auto it = m_remoteEntities.find(remoteId);
+				if (it != m_remoteEntities.end())
+				{
+					if (it->second.entity)
+						it->second.entity->Kill();
+
+					m_remoteEntities.erase(it);
+				}
+
+				continue;
+			}
+
+			if (opcode != Opcode_Spawn && opcode != Opcode_Update)
+			{
+				NazaraError("Invalid snapshot opcode");
+				return false;
+			}
+
+			RemoteEntity& remoteEntity = m_remoteEntities[remoteId];
+			if (opcode == Opcode_Spawn)
+			{
+				if (remoteEntity.entity)
+					remoteEntity.entity->Kill();
+
+				remoteEntity.entity = world.CreateEntity();
+				remoteEntity.baseline.clear();
+			}
+			else if (!remoteEntity.entity)
+			{
+				NazaraError("Snapshot updates an unknown entity");
+				return false;
+			}
+
+			Nz::UInt16 changeCount;
+			if (!Nz::Unserialize(context, &changeCount))
+				return false;
+
+			for (Nz::UInt16 i = 0; i < changeCount; ++i)
+			{
+				ComponentId componentId;
+				Nz::UInt8 removed;
+				if (!Nz::Unserialize(context, &componentId) || !Nz::Unserialize(context, &removed))
+					return false;
+
+				ComponentIndex index;
+				bool isKnown = BaseComponent::FindComponentIndex(componentId, &index) && BaseComponent::IsSerializable(index);
+
+				if (removed)
+				{
+					remoteEntity.baseline.erase(componentId);
+					if (isKnown && remoteEntity.entity->HasComponent(index))
+						remoteEntity.entity->RemoveComponent(index);
+
+					continue;
+				}
+
+				Nz::UInt32 size;
+				Nz::UInt32 deltaSize;
+				if (!Nz::Unserialize(context, &size) || !Nz::Unserialize(context, &deltaSize))
+					return false;
+
+				m_deltaBuffer.Resize(deltaSize);
+				if (context.stream->Read(m_deltaBuffer.GetBuffer(), deltaSize) != deltaSize)
+					return false;
+
+				// Unknown components are still decoded, to keep the baseline of the following deltas
+				Nz::ByteArray& baseline = remoteEntity.baseline[componentId];
+				if (!DecodeDelta(baseline, m_deltaBuffer, size, &data))
+				{
+					NazaraError("Invalid component delta");
+					return false;
+				}
+
+				std::swap(baseline, data);
+
+				if (!isKnown)
+					continue;
+
+				Nz::MemoryView componentStream(baseline.GetConstBuffer(), baseline.GetSize());
+
+				Nz::SerializationContext componentContext;
+				componentContext.endianness = context.endianness;
+				componentContext.stream = &componentStream;
+
+				if (remoteEntity.entity->HasComponent(index))
+				{
+					if (!BaseComponent::UnserializeComponent(componentContext, remoteEntity.entity->GetComponent(index)))
+					{
+						NazaraError("Failed to unserialize component");
+						return false;
+					}
+				}
+				else
+				{
+					std::unique_ptr<BaseComponent> component = BaseComponent::UnserializeComponent(componentContext, index);
+					if (!component)
+					{
+						NazaraError("Failed to unserialize component");
+						return false;
+					}
+
+					remoteEntity.entity->AddComponent(std::move(component));
+				}
+			}
+		}
+	}
+
+	/*!
+	* \brief Gets the local entity replicating a server entity
+	* \return Handle to the entity, invalid if the server didn't spawn it (or despawned it)
+	*
+	* \param remoteId Identifier of the entity on the server
+	*/
+	const EntityHandle& ReplicationSystem::GetReplicatedEntity(EntityId remoteId) const
+	{
+		auto it = m_remoteEntities.find(remoteId);
+		if (it == m_remoteEntities.end())
+			return EntityHandle::InvalidHandle;
+
+		return it->second.entity;
+	}
+
+	/*!
+	* \brief Checks whether entities are replicated to a peer
+	* \return true If it is the case
+	*
+	* \param peer Peer of the client
+	*/
+	bool ReplicationSystem::HasClient(const Nz::ENetPeer* peer) const
+	{
+		return FindClient(peer) != nullptr;
+	}
+
+	/*!
+	* \brief Stops replicating entities to a client
+	*
+	* \param peer Peer of the client
+	*
+	* \remark Should be called when the peer disconnects
+	*/
+	void ReplicationSystem::RemoveClient(Nz::ENetPeer* peer)
+	{
+		auto it = std::find_if(m_clients.begin(), m_clients.end(), [&](const Client& client) { return client.peer == peer; });
+		if (it == m_clients.end())
+			return;
+
+		World& world = GetWorld();
+		if (it->observerId != SpatialSystem::InvalidObserver && world.HasSystem<SpatialSystem>())
+			world.GetSystem<SpatialSystem>().RemoveObserver(it->observerId);
+
+		m_clients.erase(it);
+	}
+
+	/*!
+	* \brief Sets the bandwidth snapshots to a client may use
+	*
+	* Entities which don't fit in the bandwidth are sent in later updates, with increased priority.
+	*
+	* \param peer Peer of the client
+	* \param bytesPerSecond Snapshot bytes sent to the client per second, zero for unlimited
+	*
+	* \remark Produces a NazaraAssert if the peer is not a client
+	*/
+	void ReplicationSystem::SetClientBandwidth(Nz::ENetPeer* peer, Nz::UInt32 bytesPerSecond)
+	{
+		Client* client = FindClient(peer);
+		NazaraAssert(client, "Peer is not a client");
+
+		client->bandwidth = bytesPerSecond;
+		client->credit = 0.f;
+	}
+
+	/*!
+	* \brief Sets the point of view of a client
+	*
+	* Only entities within the radius of the viewpoint are replicated to the client, and nearest ones have more priority.
+	* Entities without a NodeComponent are always replicated.
+	*
+	* The viewpoint is an observer of the SpatialSystem of the world, which is added if needed.
+	*
+	* \param peer Peer of the client
+	* \param position Global position of the viewpoint
+	* \param radius Distance the client sees entities from, infinite to see every entity
+	*
+	* \remark Produces a NazaraAssert if the peer is not a client
+	*/
+	void ReplicationSystem::SetClientViewpoint(Nz::ENetPeer* peer, const Nz::Vector3f& position, float radius)
+	{
+		Client* client = FindClient(peer);
+		NazaraAssert(client, "Peer is not a client");
+		NazaraAssert(radius >= 0.f, "Radius must be positive");
+
+		client->viewpoint = position;
+		client->viewRadius = radius;
+
+		World& world = GetWorld();
+		if (std::isinf(radius))
+		{
+			if (client->observerId != SpatialSystem::InvalidObserver && world.HasSystem<SpatialSystem>())
+				world.GetSystem<SpatialSystem>().RemoveObserver(client->observerId);
+
+			client->observerId = SpatialSystem::InvalidObserver;
+			return;
+		}
+
+		SpatialSystem& spatialSystem = (world.HasSystem<SpatialSystem>()) ? world.GetSystem<SpatialSystem>() : world.AddSystem<SpatialSystem>();
+		if (spatialSystem.IsObserverValid(client->observerId))
+		{
+			spatialSystem.SetObserverPosition(client->observerId, position);
+			spatialSystem.SetObserverRadius(client->observerId, radius);
+		}
+		else
+			client->observerId = spatialSystem.AddObserver(position, radius);
+	}
+
+	/*!
+	* \brief Sets the replication priority of an entity
+	*
+	* \param entity Entity replicated by this system
+	* \param priority Priority relative to other entities (which have a priority of one by default)
+	*/
+	void ReplicationSystem::SetEntityPriority(const Entity* entity, float priority)
+	{
+		NazaraAssert(entity, "Invalid entity");
+		NazaraAssert(priority > 0.f, "Priority must be positive");
+
+		EntityId id = entity->GetId();
+		if (id >= m_entityStates.size())
+			m_entityStates.resize(id + 1);
+
+		m_entityStates[id].priority = priority;
+	}
+
+	ReplicationSystem::Client* ReplicationSystem::FindClient(const Nz::ENetPeer* peer)
+	{
+		auto it = std::find_if(m_clients.begin(), m_clients.end(), [&](const Client& client) { return client.peer == peer; });
+		return (it != m_clients.end()) ? &*it : nullptr;
+	}
+
+	const ReplicationSystem::Client* ReplicationSystem::FindClient(const Nz::ENetPeer* peer) const
+	{
+		auto it = std::find_if(m_clients.begin(), m_clients.end(), [&](const Client& client) { return client.peer == peer; });
+		return (it != m_clients.end()) ? &*it : nullptr;
+	}
+
+	/*!
+	* \brief Finds the entities a client sees
+	*
+	* \param client Client
+	* \param entities Output entity identifiers
+	*/
+	void ReplicationSystem::GatherRelevantEntities(const Client& client, std::vector<EntityId>* entities) const
+	{
+		entities->clear();
+
+		const EntityList& systemEntities = GetEntities();
+
+		World& world = GetWorld();
+		if (client.observerId == SpatialSystem::InvalidObserver || !world.HasSystem<SpatialSystem>())
+		{
+			for (const Entity* entity : systemEntities)
+				entities->push_back(entity->GetId());
+
+			return;
+		}
+
+		entities->insert(entities->end(), m_unlocatedEntities.begin(), m_unlocatedEntities.end());
+
+		for (const Entity* entity : world.GetSystem<SpatialSystem>().GetObservedEntities(client.observerId))
+		{
+			if (systemEntities.Has(entity))
+				entities->push_back(entity->GetId());
+		}
+	}
+
+	/*!
+	* \brief Operation to perform when entity is removed from the system
+	*
+	* \param entity Pointer to the entity
+	*/
+	void ReplicationSystem::OnEntityRemoved(Entity* entity)
+	{
+		EntityId id = entity->GetId();
+		if (id < m_entityStates.size())
+			m_entityStates[id] = EntityState();
+
+		for (Client& client : m_clients)
+		{
+			if (client.knownEntities.UnboundedTest(id))
+			{
+				client.knownEntities.Reset(id);
+				client.entities[id] = ClientEntity();
+				client.pendingDespawns.push_back(id);
+			}
+		}
+	}
+
+	/*!
+	* \brief Operation to perform when system is updated
+	*
+	* \param elapsedTime Delta time used for the update
+	*/
+	void ReplicationSystem::OnUpdate(float elapsedTime)
+	{
+		if (m_clients.empty())
+			return;
+
+		UpdateEntityStates();
+
+		for (Client& client : m_clients)
+		{
+			if (client.peer->IsConnected())
+				SendSnapshot(client, elapsedTime);
+		}
+	}
+
+	/*!
+	* \brief Forgets what a client received, making it receive every entity again
+	*
+	* \param client Client
+	*/
+	void ReplicationSystem::ResetClient(Client& client)
+	{
+		client.knownEntities.Clear();
+		client.entities.clear();
+		client.pendingDespawns.clear();
+	}
+
+	/*!
+	* \brief Sends the changes of the entities a client sees
+	*
+	* \param client Client
+	* \param elapsedTime Delta time since the last update
+	*/
+	void ReplicationSystem::SendSnapshot(Client& client, float elapsedTime)
+	{
+		if (client.entities.size() < m_entityStates.size())
+			client.entities.resize(m_entityStates.size());
+
+		GatherRelevantEntities(client, &m_candidates);
+
+		// Entities the client knows but doesn't see anymore are despawned
+		Nz::Bitset<Nz::UInt64> relevantEntities;
+		for (EntityId id : m_candidates)
+			relevantEntities.UnboundedSet(id);
+
+		for (std::size_t id = client.knownEntities.FindFirst(); id != client.knownEntities.npos; id = client.knownEntities.FindNext(id))
+		{
+			if (!relevantEntities.UnboundedTest(id))
+			{
+				client.knownEntities.Reset(id);
+				client.entities[id] = ClientEntity();
+				client.pendingDespawns.push_back(static_cast<EntityId>(id));
+			}
+		}
+
+		// Only keep outdated entities, and raise their priority while they wait
+		float radius = client.viewRadius;
+		auto outdatedEnd = std::remove_if(m_candidates.begin(), m_candidates.end(), [&](EntityId id)
+		{
+			const EntityState& state = m_entityStates[id];
+			ClientEntity& clientEntity = client.entities[id];
+			if (client.knownEntities.UnboundedTest(id) && clientEntity.version == state.version)
+				return true;
+
+			float priority = state.priority;
+			if (state.hasPosition && !std::isinf(radius))
+				priority *= radius / (radius + client.viewpoint.Distance(state.position));
+
+			clientEntity.priorityAccumulator += priority;
+			return false;
+		});
+		m_candidates.erase(outdatedEnd, m_candidates.end());
+
+		if (m_candidates.empty() && client.pendingDespawns.empty())
+			return;
+
+		std::sort(m_candidates.begin(), m_candidates.end(), [&](EntityId lhs, EntityId rhs)
+		{
+			return client.entities[lhs].priorityAccumulator > client.entities[rhs].priorityAccumulator;
+		});
+
+		if (client.bandwidth > 0)
+			client.credit = std::min(client.credit + client.bandwidth * elapsedTime, float(client.bandwidth));
+
+		Nz::NetPacket packet(m_netCode);
+
+		Nz::SerializationContext context;
+		context.stream = packet.GetStream();
+
+		for (EntityId id : client.pendingDespawns)
+		{
+			Nz::Serialize(context, Nz::UInt8(Opcode_Despawn));
+			Nz::Serialize(context, id);
+		}
+		client.pendingDespawns.clear();
+
+		bool hasEntity = false;
+		for (EntityId id : m_candidates)
+		{
+			if (hasEntity && client.bandwidth > 0 && client.credit <= 0.f)
+				break;
+
+			ClientEntity& clientEntity = client.entities[id];
+			bool spawn = !client.knownEntities.UnboundedTest(id);
+
+			Nz::UInt64 entityStart = context.stream->GetCursorPos();
+			if (!WriteEntity(context, id, clientEntity.baseline, spawn))
+			{
+				NazaraError("Failed to write entity #" + Nz::String::Number(id));
+				ResetClient(client);
+				return;
+			}
+
+			Nz::UInt64 entityEnd = context.stream->GetCursorPos();
+			if (entityEnd >= MaxPacketSize && hasEntity)
+			{
+				// The entity will be sent in the next snapshot
+				context.stream->SetCursorPos(entityStart);
+				packet.Resize(static_cast<std::size_t>(entityStart));
+				break;
+			}
+
+			const EntityState& state = m_entityStates[id];
+			clientEntity.baseline = state.components;
+			clientEntity.priorityAccumulator = 0.f;
+			clientEntity.version = state.version;
+			client.knownEntities.UnboundedSet(id);
+			client.credit -= float(entityEnd - entityStart);
+
+			hasEntity = true;
+		}
+
+		Nz::Serialize(context, Nz::UInt8(Opcode_End));
+
+		if (!client.peer->Send(m_channel, Nz::ENetPacketFlag_Reliable, std::move(packet)))
+		{
+			NazaraError("Failed to send snapshot");
+			ResetClient(client);
+		}
+	}
+
+	/*!
+	* \brief Serializes the components of every entity and tracks which ones changed
+	*/
+	void ReplicationSystem::UpdateEntityStates()
+	{
+		m_unlocatedEntities.clear();
+
+		for (const EntityHandle& entity : GetEntities())
+		{
+			EntityId id = entity->GetId();
+			if (id >= m_entityStates.size())
+				m_entityStates.resize(id + 1);
+
+			EntityState& state = m_entityStates[id];
+
+			bool changed = false;
+			std::size_t componentCount = 0;
+
+			const Nz::Bitset<>& componentBits = entity->GetComponentBits();
+			for (std::size_t i = componentBits.FindFirst(); i != componentBits.npos; i = componentBits.FindNext(i))
+			{
+				ComponentIndex index = static_cast<ComponentIndex>(i);
+				if (!BaseComponent::IsSerializable(index))
+					continue;
+
+				m_componentBuffer.Clear(true);
+
+				Nz::MemoryStream componentStream(&m_componentBuffer, Nz::OpenMode_WriteOnly);
+
+				Nz::SerializationContext componentContext;
+				componentContext.stream = &componentStream;
+
+				if (!BaseComponent::SerializeComponent(componentContext, entity->GetComponent(index)))
+				{
+					NazaraError("Failed to serialize component of entity #" + Nz::String::Number(id));
+					continue;
+				}
+				componentContext.FlushBits();
+
+				if (componentCount >= state.components.size())
+				{
+					state.components.emplace_back();
+					state.components.back().index = index;
+					changed = true;
+				}
+
+				ComponentState& componentState = state.components[componentCount++];
+				if (changed || componentState.index != index || componentState.data != m_componentBuffer)
+				{
+					componentState.index = index;
+					componentState.data = m_componentBuffer;
+					changed = true;
+				}
+			}
+
+			if (componentCount != state.components.size())
+			{
+				state.components.resize(componentCount);
+				changed = true;
+			}
+
+			if (changed)
+				state.version++;
+
+			state.hasPosition = entity->HasComponent<NodeComponent>();
+			if (state.hasPosition)
+				state.position = entity->GetComponent<NodeComponent>().GetPosition(Nz::CoordSys_Global);
+			else
+				m_unlocatedEntities.push_back(id);
+		}
+	}
+
+	/*!
+	* \brief Writes the components of an entity which differ from what a client received
+	* \return true If the entity was written
+	*
+	* \param context Context of the snapshot
+	* \param id Identifier of the entity
+	* \param baseline Components the client received
+	* \param spawn Whether the client should create the entity
+	*/
+	bool ReplicationSystem::WriteEntity(Nz::SerializationContext& context, EntityId id, const std::vector<ComponentState>& baseline, bool spawn)
+	{
+		const std::vector<ComponentState>& components = m_entityStates[id].components;
+
+		if (!Nz::Serialize(context, Nz::UInt8((spawn) ? Opcode_Spawn : Opcode_Update)) || !Nz::Serialize(context, id))
+			return false;
+
+		// Both component lists are sorted by index, changes are found by merging them
+		Nz::UInt16 changeCount = 0;
+		for (std::size_t i = 0, j = 0; i < components.size() || j < baseline.size();)
+		{
+			if (j >= baseline.size() || (i < components.size() && components[i].index < baseline[j].index))
+			{
+				changeCount++;
+				i++;
+			}
+			else if (i >= components.size() || baseline[j].index < components[i].index)
+			{
+				changeCount++;
+				j++;
+			}
+			else
+			{
+				if (components[i].data != baseline[j].data)
+					changeCount++;
+
+				i++;
+				j++;
+			}
+		}
+
+		if (!Nz::Serialize(context, changeCount))
+			return false;
+
+		auto WriteRemoval = [&](ComponentIndex index)
+		{
+			return Nz::Serialize(context, BaseComponent::GetComponentId(index)) && Nz::Serialize(context, Nz::UInt8(1));
+		};
+
+		auto WriteComponent = [&](const ComponentState& component, const Nz::ByteArray& previousData)
+		{
+			if (!Nz::Serialize(context, BaseComponent::GetComponentId(component.index)) || !Nz::Serialize(context, Nz::UInt8(0)))
+				return false;
+
+			EncodeDelta(previousData, component.data, &m_deltaBuffer);
+
+			if (!Nz::Serialize(context, static_cast<Nz::UInt32>(component.data.GetSize())) || !Nz::Serialize(context, static_cast<Nz::UInt32>(m_deltaBuffer.GetSize())))
+				return false;
+
+			return context.stream->Write(m_deltaBuffer.GetConstBuffer(), m_deltaBuffer.GetSize()) == m_deltaBuffer.GetSize();
+		};
+
+		Nz::ByteArray emptyData;
+		for (std::size_t i = 0, j = 0; i < components.size() || j < baseline.size();)
+		{
+			if (j >= baseline.size() || (i < components.size() && components[i].index < baseline[j].index))
+			{
+				if (!WriteComponent(components[i], emptyData))
+					return false;
+
+				i++;
+			}
+			else if (i >= components.size() || baseline[j].index < components[i].index)
+			{
+				if (!WriteRemoval(baseline[j].index))
+					return false;
+
+				j++;
+			}
+			else
+			{
+				if (components[i].data != baseline[j].data && !WriteComponent(components[i], baseline[j].data))
+					return false;
+
+				i++;
+				j++;
+			}
+		}
+
+		return true;
+	}
+
+	SystemIndex ReplicationSystem::systemIndex;
+}
@@ -0,0 +1,250 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequisites.hpp
+
+#include <NDK/Systems/SpatialSystem.hpp>
+#include <NDK/Components/NodeComponent.hpp>
+#include <algorithm>
+
+namespace Ndk
+{
+	/*!
+	* \ingroup NDK
+	* \class Ndk::SpatialSystem
+	* \brief NDK class that indexes entities by position, answering proximity queries and tracking what observers see
+	*
+	* Entities are bucketed in a uniform grid of cells. Only entities whose node was invalidated since the last update are moved in the grid.
+	* Observers are positions with a radius, every update signals the entities which entered or left their radius.
+	*
+	* \remark This system is enabled if the entity owns the trait NodeComponent
+	* \remark Queries and observers see the positions of the last update of the system, other systems may use them while being updated concurrently
+	*/
+
+	/*!
+	* \brief Constructs an SpatialSystem object by default
+	*/
+	SpatialSystem::SpatialSystem() :
+	m_cellSize(64.f)
+	{
+		Requires<NodeComponent>();
+
+		// Component access isn't declared, as systems using queries and observers have to be updated after this one
+		SetUpdateOrder(90);
+	}
+
+	/*!
+	* \brief Adds an observer, seeing entities within its radius
+	* \return Identifier of the observer
+	*
+	* \param position Global position of the observer
+	* \param radius Distance the observer sees entities from
+	*
+	* \remark The entities the observer sees are signaled at the next update of the system
+	*/
+	std::size_t SpatialSystem::AddObserver(const Nz::Vector3f& position, float radius)
+	{
+		NazaraAssert(radius >= 0.f, "Radius must be positive");
+
+		auto it = std::find_if(m_observers.begin(), m_observers.end(), [](const Observer& observer) { return !observer.isValid; });
+		if (it == m_observers.end())
+		{
+			m_observers.emplace_back();
+			it = m_observers.end() - 1;
+		}
+
+		it->position = position;
+		it->radius = radius;
+		it->isValid = true;
+
+		return static_cast<std::size_t>(std::distance(m_observers.begin(), it));
+	}
+
+	/*!
+	* \brief Removes an observer
+	*
+	* \param observerId Identifier of the observer
+	*
+	* \remark The entities the observer saw are not signaled as left
+	* \remark Produces a NazaraAssert if the observer is not valid
+	*/
+	void SpatialSystem::RemoveObserver(std::size_t observerId)
+	{
+		NazaraAssert(IsObserverValid(observerId), "Invalid observer");
+
+		Observer& observer = m_observers[observerId];
+		observer.entities.Clear();
+		observer.isValid = false;
+	}
+
+	/*!
+	* \brief Sets the size of the cells of the grid, rebuilding it
+	*
+	* \param cellSize Cell size, should be of the order of query and observer radiuses
+	*
+	* \remark Produces a NazaraAssert if cell size is not positive
+	*/
+	void SpatialSystem::SetCellSize(float cellSize)
+	{
+		NazaraAssert(cellSize > 0.f, "Cell size must be positive");
+
+		m_cellSize = cellSize;
+		m_cells.clear();
+
+		for (const Entity* entity : GetEntities())
+			InsertEntity(entity->GetId(), m_entries[entity->GetId()].position);
+	}
+
+	/*!
+	* \brief Puts an entity in the cell of its position
+	*
+	* \param id Identifier of the entity
+	* \param position Global position of the entity
+	*/
+	void SpatialSystem::InsertEntity(EntityId id, const Nz::Vector3f& position)
+	{
+		EntityEntry& entry = m_entries[id];
+		entry.cellKey = GetCellKey(position);
+		entry.position = position;
+
+		m_cells[entry.cellKey].push_back(id);
+	}
+
+	/*!
+	* \brief Removes an entity from its cell
+	*
+	* \param id Identifier of the entity
+	*/
+	void SpatialSystem::RemoveFromCell(EntityId id)
+	{
+		auto cellIt = m_cells.find(m_entries[id].cellKey);
+		NazaraAssert(cellIt != m_cells.end(), "Entity is not in its cell");
+
+		std::vector<EntityId>& cell = cellIt->second;
+
+		auto it = std::find(cell.begin(), cell.end(), id);
+		NazaraAssert(it != cell.end(), "Entity is not in its cell");
+
+		*it = cell.back();
+		cell.pop_back();
+
+		if (cell.empty())
+			m_cells.erase(cellIt);
+	}
+
+	/*!
+	* \brief Operation to perform when an entity is added to the system
+	*
+	* \param entity Pointer to the entity
+	*/
+	void SpatialSystem::OnEntityAdded(Entity* entity)
+	{
+		EntityId id = entity->GetId();
+		if (id >= m_entries.size())
+			m_entries.resize(id + 1);
+
+		NodeComponent& node = entity->GetComponent<NodeComponent>();
+
+		EntityEntry& entry = m_entries[id];
+		entry.moved = false;
+		entry.invalidationSlot.Connect(node.OnNodeInvalidation, [this, id](const Nz::Node* /*node*/)
+		{
+			// Nodes may be moved by concurrent systems, only the flag of their own entity is written
+			m_entries[id].moved = true;
+		});
+
+		InsertEntity(id, node.GetPosition(Nz::CoordSys_Global));
+	}
+
+	/*!
+	* \brief Operation to perform when an entity is removed from the system
+	*
+	* \param entity Pointer to the entity
+	*/
+	void SpatialSystem::OnEntityRemoved(Entity* entity)
+	{
+		EntityId id = entity->GetId();
+
+		EntityEntry& entry = m_entries[id];
+		entry.invalidationSlot.Disconnect();
+
+		RemoveFromCell(id);
+
+		for (std::size_t observerId = 0; observerId < m_observers.size(); ++observerId)
+		{
+			Observer& observer = m_observers[observerId];
+			if (observer.isValid && observer.entities.Has(id))
+			{
+				observer.entities.Remove(entity);
+				OnEntityLeft(this, observerId, entity);
+			}
+		}
+	}
+
+	/*!
+	* \brief Operation to perform when system is updated
+	*
+	* \param elapsedTime Delta time used for the update
+	*/
+	void SpatialSystem::OnUpdate(float /*elapsedTime*/)
+	{
+		for (const EntityHandle& entity : GetEntities())
+		{
+			EntityId id = entity->GetId();
+
+			EntityEntry& entry = m_entries[id];
+			if (!entry.moved)
+				continue;
+
+			entry.moved = false;
+			entry.position = entity->GetComponent<NodeComponent>().GetPosition(Nz::CoordSys_Global);
+
+			Nz::UInt64 cellKey = GetCellKey(entry.position);
+			if (cellKey != entry.cellKey)
+			{
+				RemoveFromCell(id);
+				InsertEntity(id, entry.position);
+			}
+		}
+
+		World& world = GetWorld();
+
+		for (std::size_t observerId = 0; observerId < m_observers.size(); ++observerId)
+		{
+			Observer& observer = m_observers[observerId];
+			if (!observer.isValid)
+				continue;
+
+			m_observedEntities.Clear();
+			ForEachEntityInRadius(observer.position, observer.radius, [&](const EntityHandle& entity)
+			{
+				m_observedEntities.UnboundedSet(entity->GetId());
+			});
+
+			// Gather left entities before signaling them, as removing them from the list would invalidate iteration
+			std::vector<Entity*> leftEntities;
+			for (Entity* entity : observer.entities)
+			{
+				if (!m_observedEntities.UnboundedTest(entity->GetId()))
+					leftEntities.push_back(entity);
+			}
+
+			for (Entity* entity : leftEntities)
+			{
+				observer.entities.Remove(entity);
+				OnEntityLeft(this, observerId, entity);
+			}
+
+			for (std::size_t id = m_observedEntities.FindFirst(); id != m_observedEntities.npos; id = m_observedEntities.FindNext(id))
+			{
+				Entity* entity = world.GetEntity(static_cast<EntityId>(id));
+				if (!observer.entities.Has(entity))
+				{
+					observer.entities.Insert(entity);
+					OnEntityEntered(this, observerId, entity);
+				}
+			}
+		}
+	}
+
+	SystemIndex SpatialSystem::systemIndex;
+}
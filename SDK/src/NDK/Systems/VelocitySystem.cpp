@@ -7,6 +7,7 @@
 #include <NDK/Components/PhysicsComponent2D.hpp>
 #include <NDK/Components/PhysicsComponent3D.hpp>
 #include <NDK/Components/VelocityComponent.hpp>
+#include <NDK/World.hpp>
 
 namespace Ndk
 {
@@ -27,6 +28,9 @@ namespace Ndk
 	{
 		Excludes<PhysicsComponent2D, PhysicsComponent3D>();
 		Requires<NodeComponent, VelocityComponent>();
+		Reads<VelocityComponent>();
+		Writes<NodeComponent>();
+		EnableFixedStep();
 		SetUpdateOrder(10); //< Since some systems may want to stop us
 	}
 
@@ -38,12 +42,26 @@ namespace Ndk
 
 	void VelocitySystem::OnUpdate(float elapsedTime)
 	{
-		for (const Ndk::EntityHandle& entity : GetEntities())
+		const EntityList& entities = GetEntities();
+
+		if (IsParallelIterationEnabled())
 		{
-			NodeComponent& node = entity->GetComponent<NodeComponent>();
-			const VelocityComponent& velocity = entity->GetComponent<VelocityComponent>();
+			ParallelForEachEntity(entities, [&](const EntityHandle& entity)
+			{
+				NodeComponent& node = entity->GetComponent<NodeComponent>();
+				const VelocityComponent& velocity = entity->GetComponent<VelocityComponent>();
 
-			node.Move(velocity.linearVelocity * elapsedTime, Nz::CoordSys_Global);
+				node.Move(velocity.linearVelocity * elapsedTime, Nz::CoordSys_Global);
+			});
+		}
+		else
+		{
+			// Walk the packed component sets instead of dereferencing every entity, filtering only requires our entity bitset
+			GetWorld().View<NodeComponent, VelocityComponent>().ForEach([&](EntityId id, NodeComponent& node, const VelocityComponent& velocity)
+			{
+				if (entities.Has(id))
+					node.Move(velocity.linearVelocity * elapsedTime, Nz::CoordSys_Global);
+			});
 		}
 	}
 
@@ -23,9 +23,9 @@ namespace Ndk
 	m_textMargin { 16.f },
 	m_state	{ CheckboxState_Unchecked }
 	{
-		m_checkboxBorderSprite = Nz::Sprite::New(Nz::Material::New("Basic2D"));
-		m_checkboxBackgroundSprite = Nz::Sprite::New(Nz::Material::New("Basic2D"));
-		m_checkboxContentSprite = Nz::Sprite::New(Nz::Material::New("Translucent2D"));
+		m_checkboxBorderSprite = Nz::Sprite::New(GetOpaqueMaterial());
+		m_checkboxBackgroundSprite = Nz::Sprite::New(GetOpaqueMaterial());
+		m_checkboxContentSprite = Nz::Sprite::New(GetTranslucentMaterial());
 		m_textSprite = Nz::TextSprite::New();
 
 		m_checkboxBorderEntity = CreateEntity(false);
@@ -14,9 +14,11 @@ namespace Ndk
 	m_echoMode(EchoMode_Normal),
 	m_cursorPositionBegin(0U, 0U),
 	m_cursorPositionEnd(0U, 0U),
+	m_firstVisibleLine(0),
 	m_isMouseButtonDown(false),
 	m_multiLineEnabled(false),
-	m_readOnly(false)
+	m_readOnly(false),
+	m_virtualized(false)
 	{
 		m_cursorEntity = CreateEntity(true);
 		m_cursorEntity->AddComponent<GraphicsComponent>();
@@ -36,6 +38,33 @@ namespace Ndk
 
 	void TextAreaWidget::AppendText(const Nz::String& text)
 	{
+		if (m_virtualized)
+		{
+			// Only the appended text is indexed, the view follows the text if it was showing its end
+			std::size_t visibleLineCount = GetVisibleLineCount();
+			bool followText = (m_firstVisibleLine + visibleLineCount >= m_lineOffsets.size());
+
+			std::size_t firstByte = m_text.GetSize();
+			m_text += text;
+			IndexLines(firstByte);
+
+			if (followText)
+			{
+				std::size_t lineCount = m_lineOffsets.size();
+				m_firstVisibleLine = (lineCount > visibleLineCount) ? lineCount - visibleLineCount : 0;
+
+				UpdateVisibleLines();
+			}
+
+			OnTextChanged(this, m_text);
+			return;
+		}
+
+		// Glyphs already displayed keep their sprites (except the last one which gets hidden in PasswordExceptLast mode)
+		std::size_t firstGlyph = m_drawer.GetGlyphCount();
+		if (m_echoMode == EchoMode_PasswordExceptLast && firstGlyph > 0)
+			firstGlyph--;
+
 		m_text += text;
 		switch (m_echoMode)
 		{
@@ -65,11 +94,37 @@ namespace Ndk
 			}
 		}
 
-		m_textSprite->Update(m_drawer);
+		m_textSprite->Update(m_drawer, firstGlyph);
 
 		OnTextChanged(this, m_text);
 	}
 
+	/*!
+	* \brief Enables or disables the virtualization of the text
+	*
+	* \param enable Should only the visible lines be shaped and drawn
+	*
+	* A virtualized text area indexes the lines of its text and only gives the visible ones to its drawer,
+	* appending text or scrolling costs the same whatever the size of the text, which suits logs and consoles.
+	*
+	* \remark A virtualized text area is read-only and ignores its echo mode
+	* \remark Lines are only split on '\n', long lines are not wrapped
+	*/
+	void TextAreaWidget::EnableVirtualization(bool enable)
+	{
+		if (m_virtualized == enable)
+			return;
+
+		m_virtualized = enable;
+		m_firstVisibleLine = 0;
+		m_lineOffsets.clear();
+
+		if (m_virtualized)
+			SetReadOnly(true);
+
+		UpdateDisplayText();
+	}
+
 	void TextAreaWidget::EraseSelection()
 	{
 		if (!HasSelection())
@@ -123,11 +178,48 @@ namespace Ndk
 		return Nz::Vector2ui::Zero();
 	}
 
+	/*!
+	* \brief Gets the number of lines fitting in the content area
+	* \return Number of visible lines, at least one
+	*/
+	std::size_t TextAreaWidget::GetVisibleLineCount() const
+	{
+		float lineHeight = float(m_drawer.GetFont()->GetSizeInfo(m_drawer.GetCharacterSize()).lineHeight);
+		if (lineHeight <= 0.f)
+			return 1;
+
+		return std::max<std::size_t>(static_cast<std::size_t>(GetContentSize().y / lineHeight), 1);
+	}
+
 	void TextAreaWidget::ResizeToContent()
 	{
 		SetContentSize(Nz::Vector2f(m_textSprite->GetBoundingVolume().obb.localBox.GetLengths()));
 	}
 
+	/*!
+	* \brief Scrolls a virtualized text area so the line is the first one displayed
+	*
+	* \param line Index of the line, clamped so the last page stays filled
+	*
+	* \remark Does nothing if virtualization is disabled
+	*/
+	void TextAreaWidget::ScrollToLine(std::size_t line)
+	{
+		if (!m_virtualized)
+			return;
+
+		std::size_t lineCount = m_lineOffsets.size();
+		std::size_t visibleLineCount = GetVisibleLineCount();
+		std::size_t lastFirstLine = (lineCount > visibleLineCount) ? lineCount - visibleLineCount : 0;
+
+		line = std::min(line, lastFirstLine);
+		if (line == m_firstVisibleLine)
+			return;
+
+		m_firstVisibleLine = line;
+		UpdateVisibleLines();
+	}
+
 	void TextAreaWidget::Write(const Nz::String& text)
 	{
 		std::size_t cursorGlyph = GetGlyphIndex(m_cursorPositionBegin);
@@ -152,6 +244,10 @@ namespace Ndk
 
 		m_textEntity->GetComponent<NodeComponent>().SetPosition(GetContentOrigin());
 
+		// The number of visible lines depends on the content size
+		if (m_virtualized)
+			UpdateVisibleLines();
+
 		RefreshCursor();
 	}
 
@@ -340,6 +436,23 @@ namespace Ndk
 		}
 	}
 
+	void TextAreaWidget::OnMouseWheelMoved(float delta)
+	{
+		if (!m_virtualized)
+			return;
+
+		constexpr float linesPerStep = 3.f;
+
+		int lineOffset = static_cast<int>(-delta * linesPerStep);
+		if (lineOffset >= 0)
+			ScrollToLine(m_firstVisibleLine + static_cast<std::size_t>(lineOffset));
+		else
+		{
+			std::size_t nOffset = static_cast<std::size_t>(-lineOffset);
+			ScrollToLine((nOffset >= m_firstVisibleLine) ? 0 : m_firstVisibleLine - nOffset);
+		}
+	}
+
 	void TextAreaWidget::OnTextEntered(char32_t character, bool /*repeated*/)
 	{
 		if (m_readOnly)
@@ -406,6 +519,20 @@ namespace Ndk
 		}
 	}
 
+	void TextAreaWidget::IndexLines(std::size_t firstByte)
+	{
+		if (m_lineOffsets.empty())
+			m_lineOffsets.push_back(0);
+
+		const char* buffer = m_text.GetConstBuffer();
+		std::size_t size = m_text.GetSize();
+		for (std::size_t i = firstByte; i < size; ++i)
+		{
+			if (buffer[i] == '\n')
+				m_lineOffsets.push_back(i + 1);
+		}
+	}
+
 	void TextAreaWidget::RefreshCursor()
 	{
 		if (m_readOnly)
@@ -421,7 +548,7 @@ namespace Ndk
 			for (std::size_t i = oldSpriteCount; i < m_cursorSprites.size(); ++i)
 			{
 				m_cursorSprites[i] = Nz::Sprite::New();
-				m_cursorSprites[i]->SetMaterial(Nz::Material::New("Translucent2D"));
+				m_cursorSprites[i]->SetMaterial(GetTranslucentMaterial());
 			}
 		}
 
@@ -477,20 +604,58 @@ namespace Ndk
 
 	void TextAreaWidget::UpdateDisplayText()
 	{
-		switch (m_echoMode)
+		if (m_virtualized)
 		{
-			case EchoMode_Normal:
-				m_drawer.SetText(m_text);
-				break;
+			m_lineOffsets.clear();
+			IndexLines(0);
 
-			case EchoMode_Password:
-			case EchoMode_PasswordExceptLast:
-				m_drawer.SetText(Nz::String(m_text.GetLength(), '*'));
-				break;
+			std::size_t lineCount = m_lineOffsets.size();
+			std::size_t visibleLineCount = GetVisibleLineCount();
+			m_firstVisibleLine = std::min(m_firstVisibleLine, (lineCount > visibleLineCount) ? lineCount - visibleLineCount : 0);
+
+			UpdateVisibleLines();
+
+			SetCursorPosition(m_cursorPositionBegin);
+			return;
 		}
 
-		m_textSprite->Update(m_drawer);
+		Nz::String displayText = (m_echoMode == EchoMode_Normal) ? m_text : Nz::String(m_text.GetLength(), '*');
+
+		// Glyphs before the first changed character keep their sprites
+		const Nz::String& previousText = m_drawer.GetText();
+		std::size_t commonSize = std::min(previousText.GetSize(), displayText.GetSize());
+
+		std::size_t firstGlyph = 0;
+		for (std::size_t i = 0; i < commonSize && previousText[i] == displayText[i]; ++i)
+		{
+			if ((displayText[i] & 0xC0) != 0x80) //< Count UTF-8 leading bytes only
+				firstGlyph++;
+		}
+
+		m_drawer.SetText(displayText);
+
+		m_textSprite->Update(m_drawer, (firstGlyph > 0) ? firstGlyph - 1 : 0); //< The last common character may only be partially matched
 
 		SetCursorPosition(m_cursorPositionBegin); //< Refresh cursor position (prevent it from being outside of the text)
 	}
+	void TextAreaWidget::UpdateVisibleLines()
+	{
+		std::size_t lineCount = m_lineOffsets.size();
+		if (lineCount == 0)
+			return;
+
+		std::size_t firstLine = std::min(m_firstVisibleLine, lineCount - 1);
+		std::size_t lastLine = std::min(firstLine + GetVisibleLineCount(), lineCount);
+
+		// Lines end before the '\n' starting the next one
+		std::size_t beginByte = m_lineOffsets[firstLine];
+		std::size_t endByte = (lastLine < lineCount) ? m_lineOffsets[lastLine] - 1 : m_text.GetSize();
+
+		if (endByte > beginByte)
+			m_drawer.SetText(m_text.SubString(beginByte, endByte - 1));
+		else
+			m_drawer.Clear();
+
+		m_textSprite->Update(m_drawer);
+	}
 }
@@ -3,12 +3,24 @@
 // For conditions of distribution and use, see copyright notice in Prerequisites.hpp
 
 #include <NDK/World.hpp>
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/ByteArray.hpp>
 #include <Nazara/Core/Clock.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/MemoryStream.hpp>
+#include <Nazara/Core/Metrics.hpp>
+#include <Nazara/Core/Profiler.hpp>
+#include <Nazara/Core/TaskGroup.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Math/Algorithm.hpp>
 #include <NDK/BaseComponent.hpp>
+#include <NDK/Components/NodeComponent.hpp>
 #include <NDK/Systems/PhysicsSystem2D.hpp>
 #include <NDK/Systems/PhysicsSystem3D.hpp>
 #include <NDK/Systems/VelocitySystem.hpp>
+#include <algorithm>
+#include <cmath>
 
 #ifndef NDK_SERVER
 #include <NDK/Systems/DebugSystem.hpp>
@@ -19,6 +31,12 @@
 
 namespace Ndk
 {
+	namespace
+	{
+		constexpr Nz::UInt32 s_snapshotMagic = 0x4E445753; //< "NDWS"
+		constexpr Nz::UInt32 s_snapshotVersion = 1;
+	}
+
 	/*!
 	* \ingroup NDK
 	* \class Ndk::World
@@ -35,6 +53,8 @@ namespace Ndk
 	{
 		// The destruct must be done in an ordered way
 		Clear();
+
+		DisableMetrics();
 	}
 
 	/*!
@@ -62,7 +82,6 @@ namespace Ndk
 
 	const EntityHandle& World::CreateEntity()
 	{
-		EntityId id;
 		EntityBlock* entBlock;
 
 		std::size_t freeEntityId = m_freeEntityIds.FindFirst();
@@ -71,46 +90,137 @@ namespace Ndk
 			// We get an identifier
 			m_freeEntityIds.Reset(freeEntityId); //< Remove id from free entity id
 
-			id = static_cast<EntityId>(freeEntityId);
-
-			entBlock = &m_entities[id];
-			entBlock->handle.Reset(&entBlock->entity); //< Reset handle (as it was reset when entity got destroyed)
-
-			m_entityBlocks[id] = entBlock;
+			entBlock = ReuseEntityBlock(static_cast<EntityId>(freeEntityId));
 		}
 		else
+			entBlock = AllocateEntityBlock(1);
+
+		// We initialize the entity and we add it to the list of alive entities
+		entBlock->entity.Create();
+
+		m_aliveEntities.Insert(&entBlock->entity);
+
+		return entBlock->handle;
+	}
+
+	/*!
+	* \brief Creates multiple entities in the world
+	* \return The set of entities created
+	*
+	* Free identifiers are claimed a bitset block (64 ids) at a time and storage for new entities is reserved once for the whole batch.
+	*
+	* \param count Number of entities to create
+	*/
+	World::EntityVector World::CreateEntities(unsigned int count)
+	{
+		EntityVector list;
+		list.reserve(count);
+
+		auto InitEntity = [&](EntityBlock* entBlock)
 		{
-			// We allocate a new entity
-			id = static_cast<Ndk::EntityId>(m_entityBlocks.size());
+			entBlock->entity.Create();
+			m_aliveEntities.Insert(&entBlock->entity);
 
-			if (m_entities.capacity() > m_entities.size())
-			{
-				NazaraAssert(m_waitingEntities.empty(), "There should be no waiting entities if space is available in main container");
+			list.emplace_back(entBlock->handle);
+		};
 
-				m_entities.emplace_back(Entity(this, id)); //< We can't make our vector create the entity due to the scope
-				entBlock = &m_entities.back();
-			}
-			else
+		// Reuse free identifiers first
+		std::size_t remaining = count;
+		for (std::size_t i = 0; remaining > 0 && i < m_freeEntityIds.GetBlockCount(); ++i)
+		{
+			Nz::UInt64 freeIds = m_freeEntityIds.GetBlock(i);
+			while (freeIds && remaining > 0)
 			{
-				// Pushing to entities would reallocate vector and thus, invalidate EntityHandles (which we don't want until world update)
-				// To prevent this, allocate them into a separate vector and move them at update
-				// For now, we are counting on m_entities grow strategy to keep allocation frequency low
-				m_waitingEntities.emplace_back(std::make_unique<EntityBlock>(Entity(this, id)));
-				entBlock = m_waitingEntities.back().get();
+				Nz::UInt64 lowestBit = freeIds & -freeIds;
+				freeIds &= ~lowestBit;
+
+				std::size_t id = i * Nz::Bitset<Nz::UInt64>::bitsPerBlock + Nz::IntegralLog2Pot(lowestBit);
+				InitEntity(ReuseEntityBlock(static_cast<EntityId>(id)));
+
+				remaining--;
 			}
 
-			if (id >= m_entityBlocks.size())
-				m_entityBlocks.resize(id + 1);
+			m_freeEntityIds.SetBlock(i, freeIds);
+		}
+
+		// Then allocate the others in one go
+		if (remaining > 0)
+		{
+			m_entityBlocks.reserve(m_entityBlocks.size() + remaining);
+			m_aliveEntities.Reserve(m_entityBlocks.size() + remaining);
 
-			m_entityBlocks[id] = entBlock;
+			for (; remaining > 0; --remaining)
+				InitEntity(AllocateEntityBlock(remaining));
 		}
 
-		// We initialize the entity and we add it to the list of alive entities
-		entBlock->entity.Create();
+		return list;
+	}
 
-		m_aliveEntities.Insert(&entBlock->entity);
+	/*!
+	* \brief Stops updating the metrics of the world, unregistering them
+	*
+	* \see EnableMetrics
+	*/
 
-		return entBlock->handle;
+	void World::DisableMetrics()
+	{
+		if (!m_metricIds)
+			return;
+
+		Nz::Metrics::Unregister(m_metricIds->entities);
+		Nz::Metrics::Unregister(m_metricIds->updateTime);
+		Nz::Metrics::Unregister(m_metricIds->updates);
+		for (Nz::UInt32 metricId : m_metricIds->systemEntities)
+			Nz::Metrics::Unregister(metricId);
+
+		m_metricIds.reset();
+	}
+
+	/*!
+	* \brief Enables/Disables large pages for the component sets of the world (see Nz::LargePageMemory)
+	*
+	* Meant for worlds of hundreds of thousands of entities (typically on servers), where the TLB misses of going through the component sets show up
+	*
+	* \param enable Should the component sets be allocated in large pages
+	*
+	* \remark Existing sets are moved to their new memory right away, sets built afterwards follow this choice
+	*/
+
+	void World::EnableLargePageStorage(bool enable)
+	{
+		Nz::LockGuard lock(m_componentSetMutex);
+
+		m_isLargePageStorageEnabled = enable;
+		for (const std::unique_ptr<ComponentSet>& componentSet : m_componentSets)
+		{
+			if (componentSet)
+				componentSet->EnableLargePages(enable);
+		}
+	}
+
+	/*!
+	* \brief Registers metrics of the world, updated by each call to Update
+	*
+	* The update count, the duration of the last update, the entity count and the entity count of each system are kept, labelled with the name of the world (and the index of the system).
+	*
+	* \param worldName Name of the world, distinguishing its metrics from the other worlds ones
+	*
+	* \see DisableMetrics, Nz::Metrics
+	*/
+
+	void World::EnableMetrics(const Nz::String& worldName)
+	{
+		DisableMetrics();
+
+		Nz::String escapedName = worldName;
+		escapedName.Replace("\\", "\\\\");
+		escapedName.Replace("\"", "\\\"");
+
+		m_metricIds = std::make_unique<MetricIds>();
+		m_metricIds->labels = "world=\"" + escapedName + '"';
+		m_metricIds->entities = Nz::Metrics::Register(Nz::MetricType_Gauge, "nazara_world_entities", "Entities alive in a world", m_metricIds->labels);
+		m_metricIds->updateTime = Nz::Metrics::Register(Nz::MetricType_Gauge, "nazara_world_update_seconds", "Duration of the last update of a world", m_metricIds->labels);
+		m_metricIds->updates = Nz::Metrics::Register(Nz::MetricType_Counter, "nazara_world_updates_total", "Updates of a world", m_metricIds->labels);
 	}
 
 	/*!
@@ -131,6 +241,9 @@ namespace Ndk
 
 		m_entities.clear();
 		m_waitingEntities.clear();
+		m_prefabBatches.clear();
+
+		m_componentSets.clear();
 
 		m_aliveEntities.Clear();
 		m_dirtyEntities.Clear();
@@ -159,18 +272,176 @@ namespace Ndk
 		if (!original->IsEnabled())
 			clone->Disable();
 
-		const Nz::Bitset<>& componentBits = original->GetComponentBits();
-		for (std::size_t i = componentBits.FindFirst(); i != componentBits.npos; i = componentBits.FindNext(i))
+		original->GetComponentBits().ForEachSetBit([&](std::size_t i)
 		{
 			std::unique_ptr<BaseComponent> component(original->GetComponent(ComponentIndex(i)).Clone());
 			clone->AddComponent(std::move(component));
-		}
+		});
 
 		clone->Enable();
 
 		return clone;
 	}
 
+	/*!
+	* \brief Creates an entity from a prefab
+	* \return The entity created
+	*
+	* \param prefab Prefab whose components are copied into the entity
+	*
+	* \remark Entities instantiated from the same prefab before the next refresh join their systems together, see Instantiate(const Prefab&, unsigned int)
+	*/
+	const EntityHandle& World::Instantiate(const Prefab& prefab)
+	{
+		const EntityHandle& entity = CreateEntity();
+		AddPrefabComponents(entity, prefab);
+
+		// Successive instantiations of the same prefab are filtered as a single batch
+		if (m_prefabBatches.empty() || m_prefabBatches.back().componentBits != prefab.GetComponentBits())
+		{
+			m_prefabBatches.emplace_back();
+			m_prefabBatches.back().componentBits = prefab.GetComponentBits();
+		}
+
+		m_prefabBatches.back().entities.push_back(entity->GetId());
+
+		return entity;
+	}
+
+	/*!
+	* \brief Creates multiple entities from a prefab
+	* \return The set of entities created
+	*
+	* Entities are created in one go (see CreateEntities) and the systems they belong to are computed once for them all by the next refresh,
+	* instead of filtering each entity against every system.
+	*
+	* \param prefab Prefab whose components are copied into the entities
+	* \param count Number of entities to create
+	*
+	* \remark Entities modified (or disabled) before the next refresh are filtered individually, as usual
+	*/
+	World::EntityVector World::Instantiate(const Prefab& prefab, unsigned int count)
+	{
+		EntityVector entities = CreateEntities(count);
+
+		m_prefabBatches.emplace_back();
+
+		PrefabBatch& batch = m_prefabBatches.back();
+		batch.componentBits = prefab.GetComponentBits();
+		batch.entities.reserve(count);
+
+		for (const EntityHandle& entity : entities)
+		{
+			AddPrefabComponents(entity, prefab);
+			batch.entities.push_back(entity->GetId());
+		}
+
+		return entities;
+	}
+
+	/*!
+	* \brief Creates entities from a snapshot written by SaveSnapshot
+	* \return true If the snapshot was loaded
+	*
+	* Every entity of the snapshot is created in one go (see CreateEntities), then components are read type by type.
+	* Component types which are unknown or not serializable on this side are skipped, allowing a server to load the snapshot of a client.
+	*
+	* \param context Context to read the snapshot from
+	* \param loadedEntities Optional output of the entities created, in the order they were saved
+	*
+	* \remark Entities of the snapshot are added to the existing entities of the world, with new identifiers
+	* \remark If loading fails, the entities created so far are killed
+	*/
+	bool World::LoadSnapshot(Nz::SerializationContext& context, EntityVector* loadedEntities)
+	{
+		Nz::UInt32 magic;
+		Nz::UInt32 version;
+		if (!Nz::Unserialize(context, &magic) || !Nz::Unserialize(context, &version) || magic != s_snapshotMagic || version != s_snapshotVersion)
+		{
+			NazaraError("Invalid world snapshot");
+			return false;
+		}
+
+		Nz::UInt32 entityCount;
+		if (!Nz::Unserialize(context, &entityCount))
+			return false;
+
+		EntityVector entities = CreateEntities(entityCount);
+
+		auto Fail = [&]()
+		{
+			KillEntities(entities);
+			return false;
+		};
+
+		// Entities are disabled before receiving their components, so they don't go through an enabled state
+		for (const EntityHandle& entity : entities)
+		{
+			bool enabled;
+			if (!Nz::Unserialize(context, &enabled))
+				return Fail();
+
+			if (!enabled)
+				entity->Disable();
+		}
+		context.ResetBitPosition();
+
+		Nz::UInt32 columnCount;
+		if (!Nz::Unserialize(context, &columnCount))
+			return Fail();
+
+		for (Nz::UInt32 column = 0; column < columnCount; ++column)
+		{
+			ComponentId componentId;
+			Nz::UInt32 columnSize;
+			if (!Nz::Unserialize(context, &componentId) || !Nz::Unserialize(context, &columnSize))
+				return Fail();
+
+			ComponentIndex index;
+			if (!BaseComponent::FindComponentIndex(componentId, &index) || !BaseComponent::IsSerializable(index))
+			{
+				if (!context.stream->SetCursorPos(context.stream->GetCursorPos() + columnSize))
+				{
+					NazaraError("Failed to skip unknown component type");
+					return Fail();
+				}
+
+				continue;
+			}
+
+			Nz::UInt32 componentCount;
+			if (!Nz::Unserialize(context, &componentCount))
+				return Fail();
+
+			for (Nz::UInt32 i = 0; i < componentCount; ++i)
+			{
+				Nz::UInt32 entityIndex;
+				if (!Nz::Unserialize(context, &entityIndex) || entityIndex >= entityCount)
+				{
+					NazaraError("Invalid snapshot entity index");
+					return Fail();
+				}
+
+				std::unique_ptr<BaseComponent> component = BaseComponent::UnserializeComponent(context, index);
+				if (!component)
+				{
+					NazaraError("Failed to unserialize component");
+					return Fail();
+				}
+
+				entities[entityIndex]->AddComponent(std::move(component));
+			}
+
+			// Columns are flushed by the writer, their last bits are padding
+			context.ResetBitPosition();
+		}
+
+		if (loadedEntities)
+			*loadedEntities = std::move(entities);
+
+		return true;
+	}
+
 	/*!
 	* \brief Refreshes the world
 	*
@@ -188,6 +459,8 @@ namespace Ndk
 	*/
 	void World::Refresh()
 	{
+		Nz::Profiler::Scope profilerScope("World::Refresh");
+
 		if (!m_orderedSystemsUpdated)
 			ReorderSystems();
 
@@ -196,9 +469,16 @@ namespace Ndk
 		{
 			constexpr std::size_t MinEntityCapacity = 10; //< We want to be able to grow maximum entity count by at least ten without going to the waiting list
 
-			m_entities.reserve(m_entities.size() + m_waitingEntities.size() + MinEntityCapacity);
-			for (auto& blockPtr : m_waitingEntities)
-				m_entities.push_back(std::move(*blockPtr));
+			std::size_t waitingEntityCount = 0;
+			for (const auto& chunk : m_waitingEntities)
+				waitingEntityCount += chunk.size();
+
+			m_entities.reserve(m_entities.size() + waitingEntityCount + MinEntityCapacity);
+			for (auto& chunk : m_waitingEntities)
+			{
+				for (EntityBlock& block : chunk)
+					m_entities.push_back(std::move(block));
+			}
 
 			m_waitingEntities.clear();
 
@@ -216,13 +496,51 @@ namespace Ndk
 
 			// Destruction of the entity (invalidation of handle by the same way)
 			entity->Destroy();
-
-			// Send back the identifier of the entity to the free queue
-			m_freeEntityIds.UnboundedSet(entity->GetId());
 		}
+
+		// Send back the identifiers of the entities to the free queue
+		m_freeEntityIds |= m_killedEntities;
 		m_killedEntities.Reset();
 
+		// Entities instantiated from a prefab join the systems filtering its components, which are computed once per batch
+		std::vector<Entity*>& prefabEntities = m_refreshAddedEntities;
+		for (const PrefabBatch& batch : m_prefabBatches)
+		{
+			prefabEntities.clear();
+			for (EntityId id : batch.entities)
+			{
+				NazaraAssert(id < m_entityBlocks.size(), "Entity index out of range");
+
+				Entity* entity = &m_entityBlocks[id]->entity;
+
+				// Entities changed since their instantiation are left to the dirty entities update
+				if (!entity->IsValid() || !entity->IsEnabled() || entity->GetComponentBits() != batch.componentBits ||
+				    entity->GetRemovedComponentBits().TestAny() || entity->GetSystemBits().TestAny())
+					continue;
+
+				prefabEntities.push_back(entity);
+				m_dirtyEntities.Reset(id);
+			}
+
+			for (BaseSystem* system : m_orderedSystems)
+			{
+				if (system->Filters(batch.componentBits))
+				{
+					system->AddEntities(prefabEntities);
+					system->ValidateEntities(prefabEntities, true);
+				}
+			}
+		}
+		m_prefabBatches.clear();
+
 		// Handle of entities which need an update from the systems
+		// Systems are matched once per set of components (entities spawned together share them), then each system gets its changes in batches
+		constexpr std::size_t NoFilter = std::numeric_limits<std::size_t>::max();
+
+		m_refreshFilters.clear();
+		m_refreshedEntities.clear();
+
+		std::size_t lastFilter = NoFilter;
 		for (std::size_t i = m_dirtyEntities.FindFirst(); i != m_dirtyEntities.npos; i = m_dirtyEntities.FindNext(i))
 		{
 			NazaraAssert(i < m_entityBlocks.size(), "Entity index out of range");
@@ -238,29 +556,170 @@ namespace Ndk
 				entity->DestroyComponent(static_cast<Ndk::ComponentIndex>(j));
 			removedComponents.Reset();
 
-			for (auto& system : m_orderedSystems)
+			// Disabled entities leave every system
+			std::size_t filterIndex = NoFilter;
+			if (entity->IsEnabled())
 			{
+				const Nz::Bitset<>& componentBits = entity->GetComponentBits();
+				if (lastFilter != NoFilter && m_refreshFilters[lastFilter].componentBits == componentBits)
+					filterIndex = lastFilter;
+				else
+				{
+					auto it = std::find_if(m_refreshFilters.begin(), m_refreshFilters.end(), [&] (const SystemFilter& filter) { return filter.componentBits == componentBits; });
+					if (it == m_refreshFilters.end())
+					{
+						SystemFilter filter;
+						filter.componentBits = componentBits;
+						for (std::size_t j = 0; j < m_orderedSystems.size(); ++j)
+						{
+							if (m_orderedSystems[j]->Filters(componentBits))
+								filter.systems.UnboundedSet(j);
+						}
+
+						m_refreshFilters.emplace_back(std::move(filter));
+						it = m_refreshFilters.end() - 1;
+					}
+
+					filterIndex = static_cast<std::size_t>(std::distance(m_refreshFilters.begin(), it));
+					lastFilter = filterIndex;
+				}
+			}
+
+			m_refreshedEntities.emplace_back(entity, filterIndex);
+		}
+		m_dirtyEntities.Reset();
+
+		for (std::size_t i = 0; i < m_orderedSystems.size(); ++i)
+		{
+			BaseSystem* system = m_orderedSystems[i];
+
+			m_refreshAddedEntities.clear();
+			m_refreshRemovedEntities.clear();
+			m_refreshValidatedEntities.clear();
+
+			for (const auto& pair : m_refreshedEntities)
+			{
+				Entity* entity = pair.first;
+
 				// Is our entity already part of this system?
 				bool partOfSystem = system->HasEntity(entity);
 
 				// Should it be part of it?
-				if (entity->IsEnabled() && system->Filters(entity))
+				if (pair.second != NoFilter && m_refreshFilters[pair.second].systems.UnboundedTest(i))
 				{
 					// Yes it should, add it to the system if not already done and validate it (again)
-					if (!partOfSystem)
-						system->AddEntity(entity);
-
-					system->ValidateEntity(entity, !partOfSystem);
-				}
-				else
-				{
-					// No it shouldn't, remove it if it's part of the system
 					if (partOfSystem)
-						system->RemoveEntity(entity);
+						m_refreshValidatedEntities.push_back(entity);
+					else
+						m_refreshAddedEntities.push_back(entity);
 				}
+				else if (partOfSystem)
+					m_refreshRemovedEntities.push_back(entity); // No it shouldn't, remove it
 			}
+
+			system->RemoveEntities(m_refreshRemovedEntities);
+			system->AddEntities(m_refreshAddedEntities);
+			system->ValidateEntities(m_refreshAddedEntities, true);
+			system->ValidateEntities(m_refreshValidatedEntities, false);
 		}
-		m_dirtyEntities.Reset();
+	}
+
+	/*!
+	* \brief Writes the entities of the world and their serializable components into a binary snapshot
+	* \return true If the snapshot was written
+	*
+	* Components are written column-wise: every component of a type is written at once, preceded by the identifier of the type and the size of the column.
+	* Components without a serializer (see Component::RegisterSerializer) are not saved, neither are systems nor the hierarchy of nodes.
+	*
+	* \param context Context to write the snapshot to
+	*
+	* \remark Entities killed since the last refresh are not saved
+	*
+	* \see LoadSnapshot
+	*/
+	bool World::SaveSnapshot(Nz::SerializationContext& context) const
+	{
+		// Alive entities are indexed in the order of their identifiers
+		constexpr Nz::UInt32 InvalidIndex = std::numeric_limits<Nz::UInt32>::max();
+
+		std::vector<Nz::UInt32> snapshotIndices(m_entityBlocks.size(), InvalidIndex);
+		std::vector<const Entity*> entities;
+		entities.reserve(m_entityBlocks.size());
+
+		Nz::Bitset<> componentTypes;
+		for (std::size_t i = 0; i < m_entityBlocks.size(); ++i)
+		{
+			const Entity& entity = m_entityBlocks[i]->entity;
+			if (!entity.IsValid() || m_killedEntities.UnboundedTest(i))
+				continue;
+
+			snapshotIndices[i] = static_cast<Nz::UInt32>(entities.size());
+			entities.push_back(&entity);
+
+			componentTypes |= entity.GetComponentBits();
+		}
+
+		for (std::size_t i = componentTypes.FindFirst(); i != componentTypes.npos; i = componentTypes.FindNext(i))
+		{
+			if (!BaseComponent::IsSerializable(static_cast<ComponentIndex>(i)))
+				componentTypes.Reset(i);
+		}
+
+		if (!Nz::Serialize(context, s_snapshotMagic) || !Nz::Serialize(context, s_snapshotVersion) || !Nz::Serialize(context, static_cast<Nz::UInt32>(entities.size())))
+			return false;
+
+		for (const Entity* entity : entities)
+		{
+			if (!Nz::Serialize(context, entity->IsEnabled()))
+				return false;
+		}
+		context.FlushBits();
+
+		if (!Nz::Serialize(context, static_cast<Nz::UInt32>(componentTypes.Count())))
+			return false;
+
+		// Columns are written into memory first, so their size can be written before them
+		Nz::ByteArray column;
+		for (std::size_t i = componentTypes.FindFirst(); i != componentTypes.npos; i = componentTypes.FindNext(i))
+		{
+			ComponentIndex index = static_cast<ComponentIndex>(i);
+
+			Nz::UInt32 componentCount = 0;
+			for (const Entity* entity : entities)
+			{
+				if (entity->HasComponent(index))
+					componentCount++;
+			}
+
+			column.Clear(true);
+
+			Nz::MemoryStream columnStream(&column, Nz::OpenMode_WriteOnly);
+
+			Nz::SerializationContext columnContext;
+			columnContext.endianness = context.endianness;
+			columnContext.stream = &columnStream;
+
+			if (!Nz::Serialize(columnContext, componentCount))
+				return false;
+
+			for (const Entity* entity : entities)
+			{
+				if (!entity->HasComponent(index))
+					continue;
+
+				if (!Nz::Serialize(columnContext, snapshotIndices[entity->GetId()]) || !BaseComponent::SerializeComponent(columnContext, entity->GetComponent(index)))
+					return false;
+			}
+			columnContext.FlushBits();
+
+			if (!Nz::Serialize(context, BaseComponent::GetComponentId(index)) || !Nz::Serialize(context, static_cast<Nz::UInt32>(column.GetSize())))
+				return false;
+
+			if (context.stream->Write(column.GetConstBuffer(), column.GetSize()) != column.GetSize())
+				return false;
+		}
+
+		return true;
 	}
 
 	/*!
@@ -269,35 +728,133 @@ namespace Ndk
 	*
 	* This function Refreshes the world and calls the Update function of every active system part of it with the elapsedTime value.
 	* It also increase the profiler data with the elapsed time passed in Refresh and every system update.
+	*
+	* \remark If parallel update is enabled, systems without conflicting component access are updated concurrently
+	* \remark If fixed update is enabled, systems with fixed step enabled are updated with fixed steps instead
+	*
+	* \see EnableParallelUpdate, SetFixedUpdateRate
 	*/
 	void World::Update(float elapsedTime)
 	{
-		if (m_isProfilerEnabled)
-		{
-			Nz::UInt64 t1 = Nz::GetElapsedMicroseconds();
-			Refresh();
-			Nz::UInt64 t2 = Nz::GetElapsedMicroseconds();
+		Nz::Profiler::Scope profilerScope("World::Update");
 
-			m_profilerData.refreshTime += t2 - t1;
+		Nz::UInt64 startTime = (m_metricIds) ? Nz::GetElapsedMicroseconds() : 0;
+
+		if (m_fixedUpdateStep > 0.f)
+		{
+			m_fixedUpdateCounter += elapsedTime;
 
-			for (auto& systemPtr : m_orderedSystems)
+			unsigned int updateCount = 0;
+			while (m_fixedUpdateCounter >= m_fixedUpdateStep)
 			{
-				systemPtr->Update(elapsedTime);
+				if (updateCount >= m_maxFixedUpdateCount)
+				{
+					// The simulation can't keep up, drop the remaining steps instead of spiraling
+					m_fixedUpdateCounter = std::fmod(m_fixedUpdateCounter, m_fixedUpdateStep);
+					break;
+				}
+
+				SaveNodeStates();
+				UpdateSystems(m_fixedUpdateStep, true);
 
-				Nz::UInt64 t3 = Nz::GetElapsedMicroseconds();
-				m_profilerData.updateTime[systemPtr->GetIndex()] += t3 - t2;
-				t2 = t3;
+				m_fixedUpdateCounter -= m_fixedUpdateStep;
+				updateCount++;
 			}
 
+			m_interpolationFactor = m_fixedUpdateCounter / m_fixedUpdateStep;
+		}
+
+		UpdateSystems(elapsedTime, false);
+
+		if (m_isProfilerEnabled)
 			m_profilerData.updateCount++;
+
+		if (m_metricIds)
+			UpdateMetrics(Nz::GetElapsedMicroseconds() - startTime);
+	}
+
+	/*!
+	* \brief Adds a copy of the components of a prefab to an entity
+	*
+	* \param entity Entity receiving the components
+	* \param prefab Prefab to copy
+	*/
+	void World::AddPrefabComponents(Entity* entity, const Prefab& prefab)
+	{
+		const Nz::Bitset<>& componentBits = prefab.GetComponentBits();
+		for (std::size_t i = componentBits.FindFirst(); i != componentBits.npos; i = componentBits.FindNext(i))
+			entity->AddComponent(prefab.GetComponent(static_cast<ComponentIndex>(i)).Clone());
+	}
+
+	/*!
+	* \brief Allocates a new entity block, with a new identifier
+	* \return Pointer to the entity block
+	*
+	* \param expectedCount Number of entities expected to be allocated in a row, including this one
+	*/
+	World::EntityBlock* World::AllocateEntityBlock(std::size_t expectedCount)
+	{
+		EntityId id = static_cast<Ndk::EntityId>(m_entityBlocks.size());
+
+		EntityBlock* entBlock;
+		if (m_entities.capacity() > m_entities.size())
+		{
+			NazaraAssert(m_waitingEntities.empty(), "There should be no waiting entities if space is available in main container");
+
+			m_entities.emplace_back(Entity(this, id)); //< We can't make our vector create the entity due to the scope
+			entBlock = &m_entities.back();
 		}
 		else
 		{
-			Refresh();
+			// Pushing to entities would reallocate vector and thus, invalidate EntityHandles (which we don't want until world update)
+			// To prevent this, allocate them into separate chunks (which never grow past their initial capacity) and move them at update
+			if (m_waitingEntities.empty() || m_waitingEntities.back().size() == m_waitingEntities.back().capacity())
+			{
+				constexpr std::size_t MinChunkSize = 64;
+
+				m_waitingEntities.emplace_back();
+				m_waitingEntities.back().reserve(std::max({ expectedCount, MinChunkSize, m_entities.size() / 2 }));
+			}
+
+			std::vector<EntityBlock>& chunk = m_waitingEntities.back();
+			chunk.emplace_back(Entity(this, id));
+			entBlock = &chunk.back();
+		}
+
+		m_entityBlocks.push_back(entBlock);
+
+		return entBlock;
+	}
+
+	/*!
+	* \brief Gets the dense set of a component type, building it if this is the first request
+	* \return A constant reference to the component set
+	*
+	* \param index Index of the component
+	*/
+	const ComponentSet& World::GetComponentSet(ComponentIndex index)
+	{
+		// Systems updated in parallel may request views at the same time
+		Nz::LockGuard lock(m_componentSetMutex);
+
+		if (index >= m_componentSets.size())
+			m_componentSets.resize(index + 1);
+
+		std::unique_ptr<ComponentSet>& componentSet = m_componentSets[index];
+		if (!componentSet)
+		{
+			componentSet = std::make_unique<ComponentSet>(m_isLargePageStorageEnabled);
 
-			for (auto& systemPtr : m_orderedSystems)
-				systemPtr->Update(elapsedTime);
+			// From now on, the set is kept up to date by entities, we only have to fill it with already existing components
+			for (EntityBlock* entBlock : m_entityBlocks)
+			{
+				Entity& entity = entBlock->entity;
+				if (entity.IsValid() && entity.HasComponent(index))
+					componentSet->Insert(entity.GetId(), &entity.GetComponent(index));
+			}
 		}
+
+		return *componentSet;
 	}
 
 	void World::ReorderSystems()
@@ -315,6 +872,176 @@ namespace Ndk
 			return first->GetUpdateOrder() < second->GetUpdateOrder();
 		});
 
+		// Build parallel update stages: a system goes to the stage following the last one holding a system it conflicts with
+		m_systemStages.clear();
+
+		std::vector<std::size_t> systemStages(m_orderedSystems.size());
+		for (std::size_t i = 0; i < m_orderedSystems.size(); ++i)
+		{
+			std::size_t stageIndex = 0;
+			for (std::size_t j = 0; j < i; ++j)
+			{
+				if (m_orderedSystems[i]->ConflictsWith(*m_orderedSystems[j]))
+					stageIndex = std::max(stageIndex, systemStages[j] + 1);
+			}
+
+			systemStages[i] = stageIndex;
+
+			if (stageIndex >= m_systemStages.size())
+				m_systemStages.resize(stageIndex + 1);
+
+			m_systemStages[stageIndex].push_back(m_orderedSystems[i]);
+		}
+
 		m_orderedSystemsUpdated = true;
 	}
+
+	/*!
+	* \brief Gets back the block of a destroyed entity to reuse its identifier
+	* \return Pointer to the entity block
+	*
+	* \param id Free identifier, it must have been removed from the free identifiers by the caller
+	*/
+	World::EntityBlock* World::ReuseEntityBlock(EntityId id)
+	{
+		EntityBlock* entBlock = &m_entities[id];
+		entBlock->handle.Reset(&entBlock->entity); //< Reset handle (as it was reset when entity got destroyed)
+
+		m_entityBlocks[id] = entBlock;
+
+		return entBlock;
+	}
+
+	/*!
+	* \brief Saves the state of the interpolated node components, before a fixed update
+	*/
+	void World::SaveNodeStates()
+	{
+		View<NodeComponent>().ForEach([](EntityId /*id*/, NodeComponent& node)
+		{
+			if (node.IsInterpolationEnabled())
+				node.SaveState();
+		});
+	}
+
+	/*!
+	* \brief Updates the metrics of the world after an update
+	*
+	* \param updateTime Duration of the update, in microseconds
+	*/
+	void World::UpdateMetrics(Nz::UInt64 updateTime)
+	{
+		Nz::Metrics::Add(m_metricIds->updates);
+		Nz::Metrics::Set(m_metricIds->updateTime, updateTime / 1'000'000.0);
+		Nz::Metrics::Set(m_metricIds->entities, static_cast<double>(m_aliveEntities.size()));
+
+		// Systems may have been added or removed since the last update
+		std::vector<Nz::UInt32>& systemMetricIds = m_metricIds->systemEntities;
+		if (systemMetricIds.size() < m_systems.size())
+			systemMetricIds.resize(m_systems.size(), Nz::Metrics::InvalidId);
+
+		for (std::size_t i = 0; i < systemMetricIds.size(); ++i)
+		{
+			BaseSystem* system = (i < m_systems.size()) ? m_systems[i].get() : nullptr;
+			if (system)
+			{
+				if (systemMetricIds[i] == Nz::Metrics::InvalidId)
+					systemMetricIds[i] = Nz::Metrics::Register(Nz::MetricType_Gauge, "nazara_world_system_entities", "Entities handled by a system of a world", m_metricIds->labels + ",system=\"" + Nz::String::Number(i) + '"');
+
+				Nz::Metrics::Set(systemMetricIds[i], static_cast<double>(system->GetEntities().size()));
+			}
+			else if (systemMetricIds[i] != Nz::Metrics::InvalidId)
+			{
+				Nz::Metrics::Unregister(systemMetricIds[i]);
+				systemMetricIds[i] = Nz::Metrics::InvalidId;
+			}
+		}
+	}
+
+	void World::UpdateSystem(BaseSystem* system, float elapsedTime)
+	{
+		if (m_isProfilerEnabled)
+		{
+			Nz::UInt64 t1 = Nz::GetElapsedMicroseconds();
+			system->Update(elapsedTime);
+			Nz::UInt64 t2 = Nz::GetElapsedMicroseconds();
+
+			m_profilerData.updateTime[system->GetIndex()] += t2 - t1; //< Every system has its own counter, making this safe during parallel updates
+		}
+		else
+			system->Update(elapsedTime);
+	}
+
+	/*!
+	* \brief Refreshes the world and updates its systems
+	*
+	* \param elapsedTime Delta time used for the update
+	* \param fixedStep Should the systems with fixed step enabled be updated (instead of the other ones), ignored if fixed update is disabled
+	*/
+	void World::UpdateSystems(float elapsedTime, bool fixedStep)
+	{
+		if (m_isProfilerEnabled)
+		{
+			Nz::UInt64 t1 = Nz::GetElapsedMicroseconds();
+			Refresh();
+			Nz::UInt64 t2 = Nz::GetElapsedMicroseconds();
+
+			m_profilerData.refreshTime += t2 - t1;
+		}
+		else
+			Refresh();
+
+		bool filterSystems = (m_fixedUpdateStep > 0.f);
+		auto IsUpdated = [=](const BaseSystem* system)
+		{
+			return !filterSystems || system->IsFixedStepEnabled() == fixedStep;
+		};
+
+		if (m_isParallelUpdateEnabled)
+		{
+			for (const auto& stage : m_systemStages)
+			{
+				m_updatedSystems.clear();
+				for (BaseSystem* system : stage)
+				{
+					if (IsUpdated(system))
+						m_updatedSystems.push_back(system);
+				}
+
+				if (m_updatedSystems.size() > 1)
+				{
+					// Systems can't use the TaskScheduler from inside a task, tell them to iterate sequentially
+					m_isUpdatingConcurrently = true;
+
+					Nz::TaskGroup stageGroup;
+					for (std::size_t i = 1; i < m_updatedSystems.size(); ++i)
+					{
+						BaseSystem* system = m_updatedSystems[i];
+						Nz::TaskScheduler::AddTask(stageGroup, [this, system, elapsedTime]()
+						{
+							UpdateSystem(system, elapsedTime);
+						});
+					}
+					Nz::TaskScheduler::Run();
+
+					// Keep the calling thread busy with the first system of the stage
+					UpdateSystem(m_updatedSystems.front(), elapsedTime);
+
+					Nz::TaskScheduler::WaitForTasks(stageGroup);
+
+					m_isUpdatingConcurrently = false;
+				}
+				else if (!m_updatedSystems.empty())
+					UpdateSystem(m_updatedSystems.front(), elapsedTime);
+			}
+		}
+		else
+		{
+			for (BaseSystem* system : m_orderedSystems)
+			{
+				if (IsUpdated(system))
+					UpdateSystem(system, elapsedTime);
+			}
+		}
+	}
 }
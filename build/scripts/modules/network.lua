@@ -20,6 +20,8 @@ MODULE.OsFiles.Linux = {
 }
 
 MODULE.OsFilesExcluded.Linux = {
+	"../src/Nazara/Network/Posix/SocketCompletionQueueImpl.hpp",
+	"../src/Nazara/Network/Posix/SocketCompletionQueueImpl.cpp",
 	"../src/Nazara/Network/Posix/SocketPollerImpl.hpp",
 	"../src/Nazara/Network/Posix/SocketPollerImpl.cpp"
 }
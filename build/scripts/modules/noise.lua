@@ -1,5 +1,6 @@
 MODULE.Name = "Noise"
 
 MODULE.Libraries = {
-	"NazaraCore"
+	"NazaraCore",
+	"NazaraUtility"
 }
@@ -0,0 +1,22 @@
+TOOL.Name = "CoreBenchmark"
+
+TOOL.Category = "Test"
+TOOL.Directory = "../tests/Benchmarks/Core"
+TOOL.EnableConsole = true
+TOOL.Kind = "Application"
+TOOL.TargetDirectory = "../tests"
+
+TOOL.Includes = {
+	"../include"
+}
+
+TOOL.Files = {
+	"../tests/Benchmarks/Core/**.hpp",
+	"../tests/Benchmarks/Core/**.inl",
+	"../tests/Benchmarks/Core/**.cpp"
+}
+
+TOOL.Libraries = {
+	"NazaraCore",
+	"NazaraUtility"
+}
@@ -0,0 +1,25 @@
+TOOL.Name = "ECSBenchmark"
+
+TOOL.Category = "Test"
+TOOL.Directory = "../tests/Benchmarks/ECS"
+TOOL.EnableConsole = true
+TOOL.Kind = "Application"
+TOOL.TargetDirectory = "../tests"
+
+TOOL.Defines = {
+	"NDK_SERVER"
+}
+
+TOOL.Includes = {
+	"../include"
+}
+
+TOOL.Files = {
+	"../tests/Benchmarks/ECS/**.hpp",
+	"../tests/Benchmarks/ECS/**.cpp"
+}
+
+TOOL.Libraries = {
+	"NazaraNetwork",
+	"NazaraSDKServer"
+}
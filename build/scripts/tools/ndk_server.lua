@@ -35,7 +35,9 @@ TOOL.FilesExcluded = {
 	"../SDK/**/ListenerSystem.*",
 	"../SDK/**/Particle*Component.*",
 	"../SDK/**/ParticleSystem.*",
+	"../SDK/**/ReflectionProbeComponent.*",
 	"../SDK/**/RenderSystem.*",
+	"../SDK/**/SoundEmitterComponent.*",
 	"../SDK/**/*Widget*.*",
 	"../SDK/**/LuaBinding_Audio.*",
 	"../SDK/**/LuaBinding_Graphics.*",
@@ -0,0 +1,21 @@
+TOOL.Name = "NetworkBenchmark"
+
+TOOL.Category = "Test"
+TOOL.Directory = "../tests/Benchmarks/Network"
+TOOL.EnableConsole = true
+TOOL.Kind = "Application"
+TOOL.TargetDirectory = "../tests"
+
+TOOL.Includes = {
+	"../include"
+}
+
+TOOL.Files = {
+	"../tests/Benchmarks/Network/**.hpp",
+	"../tests/Benchmarks/Network/**.cpp"
+}
+
+TOOL.Libraries = {
+	"NazaraCore",
+	"NazaraNetwork"
+}
@@ -0,0 +1,23 @@
+TOOL.Name = "RenderBenchmark"
+
+TOOL.Category = "Test"
+TOOL.Directory = "../tests/Benchmarks/Render"
+TOOL.EnableConsole = true
+TOOL.Kind = "Application"
+TOOL.TargetDirectory = "../tests"
+
+TOOL.Includes = {
+	"../include"
+}
+
+TOOL.Files = {
+	"../tests/Benchmarks/Render/**.hpp",
+	"../tests/Benchmarks/Render/**.cpp"
+}
+
+TOOL.Libraries = {
+	"NazaraCore",
+	"NazaraGraphics",
+	"NazaraRenderer",
+	"NazaraUtility"
+}
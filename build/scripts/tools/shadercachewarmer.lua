@@ -0,0 +1,22 @@
+TOOL.Name = "ShaderCacheWarmer"
+
+TOOL.Directory = "../tools/ShaderCacheWarmer"
+TOOL.EnableConsole = true
+TOOL.Kind = "Application"
+TOOL.TargetDirectory = "../tools/bin"
+
+TOOL.Includes = {
+	"../include"
+}
+
+TOOL.Files = {
+	"../tools/ShaderCacheWarmer/**.hpp",
+	"../tools/ShaderCacheWarmer/**.cpp"
+}
+
+TOOL.Libraries = {
+	"NazaraCore",
+	"NazaraGraphics",
+	"NazaraRenderer",
+	"NazaraUtility"
+}
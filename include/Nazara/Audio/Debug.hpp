@@ -4,5 +4,7 @@
 
 #include <Nazara/Audio/Config.hpp>
 #if NAZARA_AUDIO_MANAGE_MEMORY
+	#undef NAZARA_MEMORY_TAG
+	#define NAZARA_MEMORY_TAG Nz::MemoryTag_Audio
 	#include <Nazara/Core/Debug/NewRedefinition.hpp>
 #endif
@@ -24,6 +24,15 @@ namespace Nz
 		AudioFormat_Max = AudioFormat_7_1
 	};
 
+	enum SoundBufferStorage
+	{
+		SoundBufferStorage_ADPCM,   // Samples compressed by IMA ADPCM (four bits per sample), decoded while playing
+		SoundBufferStorage_Encoded, // File kept as it was loaded (Ogg Vorbis, Opus, FLAC, ...), decoded while playing
+		SoundBufferStorage_PCM,     // Decoded samples, played from an OpenAL buffer
+
+		SoundBufferStorage_Max = SoundBufferStorage_PCM
+	};
+
 	enum SoundStatus
 	{
 		SoundStatus_Playing,
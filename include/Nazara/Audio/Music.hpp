@@ -52,6 +52,8 @@ namespace Nz
 			UInt64 GetSampleCount() const;
 			UInt32 GetSampleRate() const;
 			SoundStatus GetStatus() const override;
+			unsigned int GetStreamBufferCount() const;
+			UInt32 GetStreamBufferDuration() const;
 
 			bool IsLooping() const override;
 
@@ -63,6 +65,7 @@ namespace Nz
 			void Play() override;
 
 			void SetPlayingOffset(UInt32 offset);
+			void SetStreamBuffering(unsigned int bufferCount, UInt32 bufferDuration);
 
 			void Stop() override;
 
@@ -72,10 +75,6 @@ namespace Nz
 		private:
 			MovablePtr<MusicImpl> m_impl;
 
-			bool FillAndQueueBuffer(unsigned int buffer);
-			void MusicThread();
-			void StopThread();
-
 			static MusicLoader::LoaderList s_loaders;
 	};
 }
@@ -11,9 +11,12 @@
 #include <Nazara/Audio/Enums.hpp>
 #include <Nazara/Audio/SoundBuffer.hpp>
 #include <Nazara/Audio/SoundEmitter.hpp>
+#include <Nazara/Core/MovablePtr.hpp>
 
 namespace Nz
 {
+	struct StreamedSource;
+
 	class NAZARA_AUDIO_API Sound : public SoundEmitter
 	{
 		public:
@@ -50,6 +53,7 @@ namespace Nz
 			Sound& operator=(Sound&&) noexcept = default;
 
 		private:
+			MovablePtr<StreamedSource> m_streamedSource; //< Only for buffers decoded while playing
 			SoundBufferConstRef m_buffer;
 	};
 }
@@ -19,18 +19,23 @@
 #include <Nazara/Core/ResourceManager.hpp>
 #include <Nazara/Core/ResourceParameters.hpp>
 #include <Nazara/Core/Signal.hpp>
+#include <functional>
+#include <memory>
+#include <vector>
 
 namespace Nz
 {
 	struct SoundBufferParams : ResourceParameters
 	{
 		bool forceMono = false;
+		SoundBufferStorage storage = SoundBufferStorage_PCM;
 
 		bool IsValid() const;
 	};
 
 	class Sound;
 	class SoundBuffer;
+	class SoundStream;
 
 	using SoundBufferConstRef = ObjectRef<const SoundBuffer>;
 	using SoundBufferLibrary = ObjectLibrary<SoundBuffer>;
@@ -47,22 +52,28 @@ namespace Nz
 		friend SoundBufferLoader;
 		friend SoundBufferManager;
 		friend class Audio;
+		friend class VoiceManager;
 
 		public:
+			using StreamDecoder = std::function<SoundStream*(const void* data, std::size_t size)>;
+
 			SoundBuffer() = default;
-			SoundBuffer(AudioFormat format, UInt64 sampleCount, UInt32 sampleRate, const Int16* samples);
+			SoundBuffer(AudioFormat format, UInt64 sampleCount, UInt32 sampleRate, const Int16* samples, SoundBufferStorage storage = SoundBufferStorage_PCM);
 			SoundBuffer(const SoundBuffer&) = delete;
 			SoundBuffer(SoundBuffer&&) = delete;
 			~SoundBuffer();
 
-			bool Create(AudioFormat format, UInt64 sampleCount, UInt32 sampleRate, const Int16* samples);
+			bool Create(AudioFormat format, UInt64 sampleCount, UInt32 sampleRate, const Int16* samples, SoundBufferStorage storage = SoundBufferStorage_PCM);
+			bool CreateEncoded(AudioFormat format, UInt64 sampleCount, UInt32 sampleRate, std::vector<UInt8> encodedData, StreamDecoder decoder);
 			void Destroy();
 
 			UInt32 GetDuration() const;
 			AudioFormat GetFormat() const;
+			std::size_t GetMemoryUsage() const;
 			const Int16* GetSamples() const;
 			UInt64 GetSampleCount() const;
 			UInt32 GetSampleRate() const;
+			SoundBufferStorage GetStorage() const;
 
 			bool IsValid() const;
 
@@ -70,6 +81,8 @@ namespace Nz
 			bool LoadFromMemory(const void* data, std::size_t size, const SoundBufferParams& params = SoundBufferParams());
 			bool LoadFromStream(Stream& stream, const SoundBufferParams& params = SoundBufferParams());
 
+			std::unique_ptr<SoundStream> OpenStream() const;
+
 			static bool IsFormatSupported(AudioFormat format);
 			template<typename... Args> static SoundBufferRef New(Args&&... args);
 
@@ -20,6 +20,8 @@ namespace Nz
 	class NAZARA_AUDIO_API SoundEmitter
 	{
 		public:
+			struct SpatialUpdate;
+
 			SoundEmitter(SoundEmitter&& emitter) noexcept;
 			virtual ~SoundEmitter();
 
@@ -56,6 +58,15 @@ namespace Nz
 			SoundEmitter& operator=(const SoundEmitter&) = delete;
 			SoundEmitter& operator=(SoundEmitter&&) noexcept;
 
+			static void UpdateSpatialization(const SpatialUpdate* updates, std::size_t updateCount, bool suspendContext = false);
+
+			struct SpatialUpdate
+			{
+				SoundEmitter* emitter;
+				Vector3f position;
+				Vector3f velocity;
+			};
+
 		protected:
 			SoundEmitter();
 			SoundEmitter(const SoundEmitter& emitter);
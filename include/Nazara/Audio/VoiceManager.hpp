@@ -0,0 +1,107 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Audio module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_VOICEMANAGER_HPP
+#define NAZARA_VOICEMANAGER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Audio/Config.hpp>
+#include <Nazara/Audio/SoundBuffer.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <limits>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_AUDIO_API VoiceManager
+	{
+		public:
+			using VoiceId = UInt64;
+
+			VoiceManager(unsigned int sourceCount = 16, unsigned int mixingCapacity = 0);
+			VoiceManager(const VoiceManager&) = delete;
+			VoiceManager(VoiceManager&&) = delete;
+			~VoiceManager();
+
+			float GetMaxDistance() const;
+			unsigned int GetMixedVoiceCount() const;
+			unsigned int GetMixingCapacity() const;
+			unsigned int GetSourceCount() const;
+			unsigned int GetSourceVoiceCount() const;
+			unsigned int GetVirtualVoiceCount() const;
+			unsigned int GetVoiceCount() const;
+
+			bool IsVoicePlaying(VoiceId voiceId) const;
+
+			VoiceId Play(const SoundBuffer* buffer, const Vector3f& position, int priority = 0, float volume = 100.f, bool loop = false);
+
+			void SetMaxDistance(float maxDistance);
+			void SetVoicePosition(VoiceId voiceId, const Vector3f& position);
+			void SetVoiceVolume(VoiceId voiceId, float volume);
+
+			void StopAll();
+			void StopVoice(VoiceId voiceId);
+
+			void Update(float elapsedTime);
+
+			VoiceManager& operator=(const VoiceManager&) = delete;
+			VoiceManager& operator=(VoiceManager&&) = delete;
+
+			static constexpr VoiceId InvalidVoice = std::numeric_limits<VoiceId>::max();
+
+		private:
+			enum VoiceState
+			{
+				VoiceState_Mixed,
+				VoiceState_Source,
+				VoiceState_Virtual
+			};
+
+			struct Voice
+			{
+				SoundBufferConstRef buffer;
+				Vector3f position;
+				double playingTime; //< In seconds, advanced even while the voice is inaudible
+				float audibility;
+				float volume;
+				int priority;
+				std::size_t source;
+				UInt32 generation = 0;
+				VoiceState state;
+				bool active = false;
+				bool loop;
+			};
+
+			Voice* GetVoice(VoiceId voiceId);
+			const Voice* GetVoice(VoiceId voiceId) const;
+			void MixChunk();
+			void ReleaseSource(Voice& voice);
+			void ReleaseVoice(std::size_t voiceIndex);
+			void SetVoiceState(Voice& voice, std::size_t voiceIndex, VoiceState state);
+			bool StartSource(Voice& voice, std::size_t voiceIndex);
+			void UpdateMixing();
+
+			static constexpr std::size_t InvalidIndex = std::numeric_limits<std::size_t>::max();
+
+			std::vector<std::size_t> m_freeVoices;
+			std::vector<std::size_t> m_rankedVoices;
+			std::vector<std::size_t> m_sourceVoices; //< Voice played by each source, InvalidIndex if free
+			std::vector<unsigned int> m_mixBuffers;
+			std::vector<unsigned int> m_sources;
+			std::vector<float> m_mixAccumulator;
+			std::vector<float> m_mixScratch;
+			std::vector<Int16> m_mixSamples;
+			std::vector<Voice> m_voices;
+			float m_maxDistance;
+			unsigned int m_activeVoiceCount;
+			unsigned int m_mixedVoiceCount;
+			unsigned int m_mixingCapacity;
+			unsigned int m_mixSource;
+			unsigned int m_sourceVoiceCount;
+	};
+}
+
+#endif // NAZARA_VOICEMANAGER_HPP
@@ -31,38 +31,60 @@
 
 #include <Nazara/Core/AbstractHash.hpp>
 #include <Nazara/Core/AbstractLogger.hpp>
+#include <Nazara/Core/AbstractMetricsExporter.hpp>
 #include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/Archive.hpp>
+#include <Nazara/Core/ArchiveBuilder.hpp>
+#include <Nazara/Core/AsyncLogger.hpp>
+#include <Nazara/Core/ArenaAllocator.hpp>
 #include <Nazara/Core/Bitset.hpp>
+#include <Nazara/Core/BorrowedRef.hpp>
 #include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/ByteArrayPool.hpp>
 #include <Nazara/Core/ByteStream.hpp>
 #include <Nazara/Core/CallOnExit.hpp>
 #include <Nazara/Core/Clock.hpp>
 #include <Nazara/Core/Color.hpp>
+#include <Nazara/Core/CompressedStream.hpp>
+#include <Nazara/Core/ConcurrentMemoryPool.hpp>
 #include <Nazara/Core/ConditionVariable.hpp>
 #include <Nazara/Core/Config.hpp>
 #include <Nazara/Core/Core.hpp>
 #include <Nazara/Core/Directory.hpp>
+#include <Nazara/Core/DirectoryCache.hpp>
 #include <Nazara/Core/DynLib.hpp>
 #include <Nazara/Core/Endianness.hpp>
 #include <Nazara/Core/Enums.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/ErrorFlags.hpp>
 #include <Nazara/Core/File.hpp>
+#include <Nazara/Core/FileIOQueue.hpp>
+#include <Nazara/Core/FileWatcher.hpp>
 #include <Nazara/Core/FileLogger.hpp>
 #include <Nazara/Core/Flags.hpp>
+#include <Nazara/Core/FrameArena.hpp>
+#include <Nazara/Core/FramePacer.hpp>
 #include <Nazara/Core/Functor.hpp>
 #include <Nazara/Core/GuillotineBinPack.hpp>
 #include <Nazara/Core/HandledObject.hpp>
+#include <Nazara/Core/HandleTable.hpp>
 #include <Nazara/Core/HardwareInfo.hpp>
 #include <Nazara/Core/Initializer.hpp>
+#include <Nazara/Core/LargePageAllocator.hpp>
+#include <Nazara/Core/LargePageMemory.hpp>
 #include <Nazara/Core/LockGuard.hpp>
 #include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/Lz4.hpp>
+#include <Nazara/Core/MappedFile.hpp>
 #include <Nazara/Core/MemoryHelper.hpp>
 #include <Nazara/Core/MemoryManager.hpp>
 #include <Nazara/Core/MemoryPool.hpp>
 #include <Nazara/Core/MemoryStream.hpp>
 #include <Nazara/Core/MemoryView.hpp>
+#include <Nazara/Core/Metrics.hpp>
 #include <Nazara/Core/MovablePtr.hpp>
+#include <Nazara/Core/Name.hpp>
+#include <Nazara/Core/NonAtomicRefCounted.hpp>
 #include <Nazara/Core/Mutex.hpp>
 #include <Nazara/Core/ObjectHandle.hpp>
 #include <Nazara/Core/ObjectLibrary.hpp>
@@ -70,26 +92,46 @@
 #include <Nazara/Core/OffsetOf.hpp>
 #include <Nazara/Core/ParameterList.hpp>
 #include <Nazara/Core/PluginManager.hpp>
+#include <Nazara/Core/PoolAllocator.hpp>
 #include <Nazara/Core/Primitive.hpp>
 #include <Nazara/Core/PrimitiveList.hpp>
+#include <Nazara/Core/Profiler.hpp>
+#include <Nazara/Core/PrometheusMetricsExporter.hpp>
+#include <Nazara/Core/ReadLockGuard.hpp>
+#include <Nazara/Core/ReadWriteLock.hpp>
 #include <Nazara/Core/RefCounted.hpp>
 #include <Nazara/Core/Resource.hpp>
+#include <Nazara/Core/ResourceFinalizationQueue.hpp>
+#include <Nazara/Core/ResourceFuture.hpp>
 #include <Nazara/Core/ResourceLoader.hpp>
 #include <Nazara/Core/ResourceManager.hpp>
 #include <Nazara/Core/ResourceParameters.hpp>
 #include <Nazara/Core/ResourceSaver.hpp>
+#include <Nazara/Core/ResourceWatcher.hpp>
 #include <Nazara/Core/Semaphore.hpp>
 #include <Nazara/Core/SerializationContext.hpp>
+#include <Nazara/Core/ShelfBinPack.hpp>
 #include <Nazara/Core/Signal.hpp>
+#include <Nazara/Core/SimdDispatcher.hpp>
+#include <Nazara/Core/SkylineBinPack.hpp>
 #include <Nazara/Core/SparsePtr.hpp>
+#include <Nazara/Core/SpscQueue.hpp>
+#include <Nazara/Core/StatsDMetricsExporter.hpp>
 #include <Nazara/Core/StdLogger.hpp>
 #include <Nazara/Core/Stream.hpp>
 #include <Nazara/Core/String.hpp>
 #include <Nazara/Core/StringStream.hpp>
+#include <Nazara/Core/StringView.hpp>
+#include <Nazara/Core/TaskGroup.hpp>
 #include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Core/TextScanner.hpp>
 #include <Nazara/Core/Thread.hpp>
+#include <Nazara/Core/Timestamp.hpp>
 #include <Nazara/Core/TypeTag.hpp>
 #include <Nazara/Core/Unicode.hpp>
 #include <Nazara/Core/Updatable.hpp>
+#include <Nazara/Core/VirtualFile.hpp>
+#include <Nazara/Core/VirtualFileSystem.hpp>
+#include <Nazara/Core/WriteLockGuard.hpp>
 
 #endif // NAZARA_GLOBAL_CORE_HPP
@@ -20,6 +20,8 @@ namespace Nz
 
 			virtual void EnableStdReplication(bool enable) = 0;
 
+			virtual void Flush();
+
 			virtual bool IsStdReplicationEnabled() const = 0;
 
 			virtual void Write(const String& string) = 0;
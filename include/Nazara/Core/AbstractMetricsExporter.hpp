@@ -0,0 +1,30 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_ABSTRACTMETRICSEXPORTER_HPP
+#define NAZARA_ABSTRACTMETRICSEXPORTER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Metrics.hpp>
+#include <Nazara/Core/String.hpp>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_CORE_API AbstractMetricsExporter
+	{
+		public:
+			AbstractMetricsExporter() = default;
+			virtual ~AbstractMetricsExporter();
+
+			virtual String Export(const std::vector<Metrics::Sample>& samples) = 0;
+
+		protected:
+			static String FormatValue(double value);
+	};
+}
+
+#endif // NAZARA_ABSTRACTMETRICSEXPORTER_HPP
@@ -0,0 +1,79 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_ARCHIVE_HPP
+#define NAZARA_ARCHIVE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/MappedFile.hpp>
+#include <Nazara/Core/String.hpp>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_CORE_API Archive
+	{
+		public:
+			struct Entry;
+
+			Archive() = default;
+			Archive(const String& filePath);
+			Archive(const Archive&) = delete;
+			Archive(Archive&&) noexcept = default;
+			~Archive() = default;
+
+			void Close();
+
+			const Entry* FindEntry(const String& entryPath) const;
+
+			inline const Entry& GetEntry(std::size_t index) const;
+			inline std::size_t GetEntryCount() const;
+			inline const UInt8* GetEntryData(const Entry& entry) const;
+			String GetEntryPath(const Entry& entry) const;
+			inline String GetPath() const;
+
+			inline bool IsOpen() const;
+
+			bool Open(const String& filePath);
+
+			bool ReadEntry(const Entry& entry, ByteArray* data) const;
+			bool ReadEntry(const Entry& entry, void* buffer) const;
+
+			Archive& operator=(const Archive&) = delete;
+			Archive& operator=(Archive&&) noexcept = default;
+
+			static UInt64 HashPath(const char* entryPath, std::size_t pathSize);
+
+			static constexpr UInt32 EntryFlag_Compressed = 0x1;
+			static constexpr UInt32 HeaderSize = 32;
+			static constexpr UInt32 IndexEntrySize = 48;
+			static constexpr UInt32 Magic = 0x4B505A4E; //< "NZPK"
+			static constexpr UInt32 Version = 1;
+
+			struct Entry
+			{
+				UInt64 hash;
+				UInt64 offset;
+				UInt64 size;
+				UInt64 storedSize;
+				UInt32 flags;
+				UInt32 pathOffset;
+				UInt32 pathSize;
+			};
+
+		private:
+			bool ReadIndex();
+
+			MappedFile m_file;
+			std::vector<Entry> m_entries; //< Sorted by hash
+			const char* m_paths = nullptr;
+	};
+}
+
+#include <Nazara/Core/Archive.inl>
+
+#endif // NAZARA_ARCHIVE_HPP
@@ -0,0 +1,64 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets an entry of the archive
+	* \return Entry at this index
+	*
+	* \param index Index of the entry, must be lower than GetEntryCount()
+	*/
+	inline const Archive::Entry& Archive::GetEntry(std::size_t index) const
+	{
+		NazaraAssert(index < m_entries.size(), "Entry index out of range");
+
+		return m_entries[index];
+	}
+
+	/*!
+	* \brief Gets the number of entries of the archive
+	* \return Entry count
+	*/
+	inline std::size_t Archive::GetEntryCount() const
+	{
+		return m_entries.size();
+	}
+
+	/*!
+	* \brief Gets the stored data of an entry, directly from the mapped archive
+	* \return Pointer to entry.storedSize bytes, which are compressed if entry has the EntryFlag_Compressed flag
+	*
+	* \param entry Entry of this archive
+	*
+	* \see ReadEntry
+	*/
+	inline const UInt8* Archive::GetEntryData(const Entry& entry) const
+	{
+		return m_file.GetData() + entry.offset;
+	}
+
+	/*!
+	* \brief Gets the path of the archive file
+	* \return Path of the archive
+	*/
+	inline String Archive::GetPath() const
+	{
+		return m_file.GetPath();
+	}
+
+	/*!
+	* \brief Checks whether the archive is open
+	* \return true if an archive was successfully opened
+	*/
+	inline bool Archive::IsOpen() const
+	{
+		return m_file.IsOpen();
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
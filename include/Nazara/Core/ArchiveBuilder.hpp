@@ -0,0 +1,52 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_ARCHIVEBUILDER_HPP
+#define NAZARA_ARCHIVEBUILDER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/String.hpp>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_CORE_API ArchiveBuilder
+	{
+		public:
+			ArchiveBuilder() = default;
+			ArchiveBuilder(const ArchiveBuilder&) = delete;
+			ArchiveBuilder(ArchiveBuilder&&) = default;
+			~ArchiveBuilder() = default;
+
+			void AddEntry(const String& entryPath, const void* data, std::size_t size, bool compress = true);
+			bool AddFile(const String& entryPath, const String& filePath, bool compress = true);
+
+			inline void Clear();
+
+			inline std::size_t GetEntryCount() const;
+
+			bool Save(const String& filePath, UInt32 alignment = 16) const;
+
+			ArchiveBuilder& operator=(const ArchiveBuilder&) = delete;
+			ArchiveBuilder& operator=(ArchiveBuilder&&) = default;
+
+		private:
+			struct PendingEntry
+			{
+				ByteArray data; //< Compressed if isCompressed is true
+				String path;
+				UInt64 size;
+				bool isCompressed;
+			};
+
+			std::vector<PendingEntry> m_entries;
+	};
+}
+
+#include <Nazara/Core/ArchiveBuilder.inl>
+
+#endif // NAZARA_ARCHIVEBUILDER_HPP
@@ -0,0 +1,27 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Removes all entries
+	*/
+	inline void ArchiveBuilder::Clear()
+	{
+		m_entries.clear();
+	}
+
+	/*!
+	* \brief Gets the number of entries added so far
+	* \return Entry count
+	*/
+	inline std::size_t ArchiveBuilder::GetEntryCount() const
+	{
+		return m_entries.size();
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
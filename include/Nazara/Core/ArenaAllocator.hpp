@@ -0,0 +1,46 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_ARENAALLOCATOR_HPP
+#define NAZARA_ARENAALLOCATOR_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/FrameArena.hpp>
+#include <cstddef>
+
+namespace Nz
+{
+	template<typename T>
+	class ArenaAllocator
+	{
+		template<typename U> friend class ArenaAllocator;
+
+		public:
+			using value_type = T;
+
+			inline ArenaAllocator(FrameArena& arena) noexcept;
+			template<typename U> ArenaAllocator(const ArenaAllocator<U>& allocator) noexcept;
+			ArenaAllocator(const ArenaAllocator&) noexcept = default;
+			~ArenaAllocator() = default;
+
+			T* allocate(std::size_t count);
+			void deallocate(T* ptr, std::size_t count) noexcept;
+
+			inline FrameArena& GetArena() const;
+
+			ArenaAllocator& operator=(const ArenaAllocator&) noexcept = default;
+
+			template<typename U> bool operator==(const ArenaAllocator<U>& allocator) const noexcept;
+			template<typename U> bool operator!=(const ArenaAllocator<U>& allocator) const noexcept;
+
+		private:
+			FrameArena* m_arena;
+	};
+}
+
+#include <Nazara/Core/ArenaAllocator.inl>
+
+#endif // NAZARA_ARENAALLOCATOR_HPP
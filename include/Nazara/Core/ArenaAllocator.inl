@@ -0,0 +1,113 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/ArenaAllocator.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::ArenaAllocator
+	* \brief Core class that adapts a FrameArena to the standard allocator requirements
+	*
+	* Deallocation does nothing, the memory is reclaimed when the arena is reset.
+	*
+	* \remark Containers using this allocator must be destroyed or emptied before the arena is reset (or swapped with empty containers),
+	*         as even an empty std::unordered_map may keep its buckets
+	*/
+
+	/*!
+	* \brief Constructs an ArenaAllocator object allocating from an arena
+	*
+	* \param arena Arena to allocate from
+	*/
+
+	template<typename T>
+	ArenaAllocator<T>::ArenaAllocator(FrameArena& arena) noexcept :
+	m_arena(&arena)
+	{
+	}
+
+	/*!
+	* \brief Constructs an ArenaAllocator object from an allocator of another type, sharing its arena
+	*
+	* \param allocator Allocator to copy the arena from
+	*/
+
+	template<typename T>
+	template<typename U>
+	ArenaAllocator<T>::ArenaAllocator(const ArenaAllocator<U>& allocator) noexcept :
+	m_arena(allocator.m_arena)
+	{
+	}
+
+	/*!
+	* \brief Allocates uninitialized memory for count objects
+	* \return Pointer to the allocated memory
+	*
+	* \param count Number of objects
+	*/
+
+	template<typename T>
+	T* ArenaAllocator<T>::allocate(std::size_t count)
+	{
+		return static_cast<T*>(m_arena->Allocate(count * sizeof(T), alignof(T)));
+	}
+
+	/*!
+	* \brief Does nothing, memory is given back when the arena is reset
+	*
+	* \param ptr Pointer to the memory
+	* \param count Number of objects, as given to allocate
+	*/
+
+	template<typename T>
+	void ArenaAllocator<T>::deallocate(T* ptr, std::size_t count) noexcept
+	{
+		NazaraUnused(ptr);
+		NazaraUnused(count);
+	}
+
+	/*!
+	* \brief Gets the arena this allocator allocates from
+	* \return Reference to the arena
+	*/
+
+	template<typename T>
+	FrameArena& ArenaAllocator<T>::GetArena() const
+	{
+		return *m_arena;
+	}
+
+	/*!
+	* \brief Checks whether two allocators can free the memory of each other
+	* \return true if both allocators share the same arena
+	*
+	* \param allocator Other allocator
+	*/
+
+	template<typename T>
+	template<typename U>
+	bool ArenaAllocator<T>::operator==(const ArenaAllocator<U>& allocator) const noexcept
+	{
+		return m_arena == allocator.m_arena;
+	}
+
+	/*!
+	* \brief Checks whether two allocators cannot free the memory of each other
+	* \return false if both allocators share the same arena
+	*
+	* \param allocator Other allocator
+	*/
+
+	template<typename T>
+	template<typename U>
+	bool ArenaAllocator<T>::operator!=(const ArenaAllocator<U>& allocator) const noexcept
+	{
+		return !operator==(allocator);
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -0,0 +1,74 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_ASYNCLOGGER_HPP
+#define NAZARA_ASYNCLOGGER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/AbstractLogger.hpp>
+#include <Nazara/Core/Semaphore.hpp>
+#include <Nazara/Core/Thread.hpp>
+#include <atomic>
+#include <memory>
+
+namespace Nz
+{
+	class NAZARA_CORE_API AsyncLogger : public AbstractLogger
+	{
+		public:
+			AsyncLogger(AbstractLogger* logger = nullptr, UInt32 flushPeriod = 100);
+			AsyncLogger(const AsyncLogger&) = delete;
+			AsyncLogger(AsyncLogger&&) = delete;
+			~AsyncLogger();
+
+			void EnableStdReplication(bool enable) override;
+
+			void Flush() override;
+
+			AbstractLogger* GetLogger() const;
+
+			bool IsStdReplicationEnabled() const override;
+
+			void Write(const String& string) override;
+			void WriteError(ErrorType type, const String& error, unsigned int line = 0, const char* file = nullptr, const char* function = nullptr) override;
+
+			AsyncLogger& operator=(const AsyncLogger&) = delete;
+			AsyncLogger& operator=(AsyncLogger&&) = delete;
+
+		private:
+			struct Record
+			{
+				std::atomic<Record*> next;
+				std::shared_ptr<std::atomic_bool> flushed; //< Set by the writer once every preceding record is flushed, for flush requests
+				String message;
+				ErrorType type;
+				const char* file;
+				const char* function;
+				unsigned int line;
+				bool error;
+			};
+
+			bool FlushRecords(UInt32 timeout);
+			Record* PopRecord();
+			void PushRecord(Record* record);
+			void WriteRecords();
+			void WriterThread();
+
+			static void FlushAll();
+			static void OnTerminate();
+
+			std::atomic<Record*> m_head;
+			std::atomic_bool m_running;
+			std::unique_ptr<AbstractLogger> m_logger;
+			Record* m_tail;
+			Record m_stub;
+			Semaphore m_semaphore;
+			Thread m_thread;
+			UInt32 m_flushPeriod;
+	};
+}
+
+#endif // NAZARA_ASYNCLOGGER_HPP
@@ -46,17 +46,21 @@ namespace Nz
 			std::size_t FindFirst() const;
 			std::size_t FindNext(std::size_t bit) const;
 
+			template<typename F> void ForEachSetBit(const F& func) const;
+
 			Block GetBlock(std::size_t i) const;
 			std::size_t GetBlockCount() const;
 			std::size_t GetCapacity() const;
 			std::size_t GetSize() const;
 
 			void PerformsAND(const Bitset& a, const Bitset& b);
+			void PerformsANDNOT(const Bitset& a, const Bitset& b);
 			void PerformsNOT(const Bitset& a);
 			void PerformsOR(const Bitset& a, const Bitset& b);
 			void PerformsXOR(const Bitset& a, const Bitset& b);
 
 			bool Intersects(const Bitset& bitset) const;
+			bool IsSubsetOf(const Bitset& bitset) const;
 
 			void Reserve(std::size_t bitCount);
 			void Resize(std::size_t bitCount, bool defaultVal = false);
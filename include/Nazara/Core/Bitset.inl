@@ -7,6 +7,11 @@
 #include <Nazara/Math/Algorithm.hpp>
 #include <cstdlib>
 #include <utility>
+
+#if defined(NAZARA_SIMD_SSE2)
+#include <emmintrin.h>
+#endif
+
 #include <Nazara/Core/Debug.hpp>
 
 #ifdef NAZARA_COMPILER_MSVC
@@ -17,6 +22,91 @@
 
 namespace Nz
 {
+	namespace Detail
+	{
+		// Operations applied to the blocks of bitsets, 128 bits at a time when SIMD is available
+		struct BitsetAND
+		{
+			template<typename Block> Block operator()(Block a, Block b) const { return static_cast<Block>(a & b); }
+
+			#if defined(NAZARA_SIMD_SSE2)
+			__m128i operator()(__m128i a, __m128i b) const { return _mm_and_si128(a, b); }
+			#endif
+		};
+
+		struct BitsetANDNOT
+		{
+			template<typename Block> Block operator()(Block a, Block b) const { return static_cast<Block>(a & ~b); }
+
+			#if defined(NAZARA_SIMD_SSE2)
+			__m128i operator()(__m128i a, __m128i b) const { return _mm_andnot_si128(b, a); }
+			#endif
+		};
+
+		struct BitsetOR
+		{
+			template<typename Block> Block operator()(Block a, Block b) const { return static_cast<Block>(a | b); }
+
+			#if defined(NAZARA_SIMD_SSE2)
+			__m128i operator()(__m128i a, __m128i b) const { return _mm_or_si128(a, b); }
+			#endif
+		};
+
+		struct BitsetXOR
+		{
+			template<typename Block> Block operator()(Block a, Block b) const { return static_cast<Block>(a ^ b); }
+
+			#if defined(NAZARA_SIMD_SSE2)
+			__m128i operator()(__m128i a, __m128i b) const { return _mm_xor_si128(a, b); }
+			#endif
+		};
+
+		template<typename Operation, typename Block>
+		bool AnyBitsetBlock(const Block* a, const Block* b, std::size_t blockCount)
+		{
+			Operation operation;
+
+			std::size_t i = 0;
+			#if defined(NAZARA_SIMD_SSE2)
+			constexpr std::size_t blocksPerVector = sizeof(__m128i) / sizeof(Block);
+			for (; i + blocksPerVector <= blockCount; i += blocksPerVector)
+			{
+				__m128i result = operation(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&a[i])), _mm_loadu_si128(reinterpret_cast<const __m128i*>(&b[i])));
+				if (_mm_movemask_epi8(_mm_cmpeq_epi8(result, _mm_setzero_si128())) != 0xFFFF)
+					return true;
+			}
+			#endif
+
+			for (; i < blockCount; ++i)
+			{
+				if (operation(a[i], b[i]))
+					return true;
+			}
+
+			return false;
+		}
+
+		template<typename Operation, typename Block>
+		void TransformBitsetBlocks(Block* destination, const Block* a, const Block* b, std::size_t blockCount)
+		{
+			Operation operation;
+
+			// The destination may be one of the operands, each block being read before being written
+			std::size_t i = 0;
+			#if defined(NAZARA_SIMD_SSE2)
+			constexpr std::size_t blocksPerVector = sizeof(__m128i) / sizeof(Block);
+			for (; i + blocksPerVector <= blockCount; i += blocksPerVector)
+			{
+				__m128i result = operation(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&a[i])), _mm_loadu_si128(reinterpret_cast<const __m128i*>(&b[i])));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&destination[i]), result);
+			}
+			#endif
+
+			for (; i < blockCount; ++i)
+				destination[i] = operation(a[i], b[i]);
+		}
+	}
+
 	/*!
 	* \ingroup core
 	* \class Nz::Bitset
@@ -277,6 +367,32 @@ namespace Nz
 			return FindFirstFrom(blockIndex + 1);
 	}
 
+	/*!
+	* \brief Calls a function for every enabled bit of the bitset, in increasing order
+	*
+	* \param func Function called as func(std::size_t bit)
+	*
+	* \remark Every block is read once and its bits visited without searching them again, which is cheaper than looping with FindNext
+	* \remark The bitset must not be modified by func
+	*
+	* \see FindNext
+	*/
+	template<typename Block, class Allocator>
+	template<typename F>
+	void Bitset<Block, Allocator>::ForEachSetBit(const F& func) const
+	{
+		for (std::size_t i = 0; i < m_blocks.size(); ++i)
+		{
+			Block block = m_blocks[i];
+			while (block)
+			{
+				func(i * bitsPerBlock + IntegralLog2Pot(block & -block));
+
+				block &= block - 1; //< Clear lowest enabled bit
+			}
+		}
+	}
+
 	/*!
 	* \brief Gets the ith block
 	* \return Block in the bitset
@@ -417,8 +533,7 @@ namespace Nz
 		m_bitCount = std::max(a.GetSize(), b.GetSize());
 
 		// In case of the "AND", we can stop with the smallest size (because x & 0 = 0)
-		for (std::size_t i = 0; i < minmax.first; ++i)
-			m_blocks[i] = a.GetBlock(i) & b.GetBlock(i);
+		Detail::TransformBitsetBlocks<Detail::BitsetAND>(m_blocks.data(), a.m_blocks.data(), b.m_blocks.data(), minmax.first);
 
 		// And then reset every other block to zero
 		for (std::size_t i = minmax.first; i < minmax.second; ++i)
@@ -427,6 +542,36 @@ namespace Nz
 		ResetExtraBits();
 	}
 
+	/*!
+	* \brief Performs the "AND NOT" operator between two bitsets, keeping the bits of the first one which are not enabled in the second one
+	*
+	* \param a First bitset
+	* \param b Second bitset, whose bits are removed from the first one
+	*
+	* \remark The capacity of this is set to the largest of the two bitsets
+	*/
+
+	template<typename Block, class Allocator>
+	void Bitset<Block, Allocator>::PerformsANDNOT(const Bitset& a, const Bitset& b)
+	{
+		std::size_t aBlockCount = a.GetBlockCount();
+		std::size_t sharedBlockCount = std::min(aBlockCount, b.GetBlockCount());
+
+		m_blocks.resize(std::max(aBlockCount, b.GetBlockCount()));
+		m_bitCount = std::max(a.GetSize(), b.GetSize());
+
+		Detail::TransformBitsetBlocks<Detail::BitsetANDNOT>(m_blocks.data(), a.m_blocks.data(), b.m_blocks.data(), sharedBlockCount);
+
+		// x & ~0 = x, and the blocks past the first bitset are zero
+		for (std::size_t i = sharedBlockCount; i < aBlockCount; ++i)
+			m_blocks[i] = a.GetBlock(i);
+
+		for (std::size_t i = aBlockCount; i < m_blocks.size(); ++i)
+			m_blocks[i] = 0U;
+
+		ResetExtraBits();
+	}
+
 	/*!
 	* \brief Performs the "NOT" operator of the bitset
 	*
@@ -465,8 +610,7 @@ namespace Nz
 		m_blocks.resize(maxBlockCount);
 		m_bitCount = greater.GetSize();
 
-		for (std::size_t i = 0; i < minBlockCount; ++i)
-			m_blocks[i] = a.GetBlock(i) | b.GetBlock(i);
+		Detail::TransformBitsetBlocks<Detail::BitsetOR>(m_blocks.data(), a.m_blocks.data(), b.m_blocks.data(), minBlockCount);
 
 		for (std::size_t i = minBlockCount; i < maxBlockCount; ++i)
 			m_blocks[i] = greater.GetBlock(i); // (x | 0 = x)
@@ -494,8 +638,7 @@ namespace Nz
 		m_blocks.resize(maxBlockCount);
 		m_bitCount = greater.GetSize();
 
-		for (std::size_t i = 0; i < minBlockCount; ++i)
-			m_blocks[i] = a.GetBlock(i) ^ b.GetBlock(i);
+		Detail::TransformBitsetBlocks<Detail::BitsetXOR>(m_blocks.data(), a.m_blocks.data(), b.m_blocks.data(), minBlockCount);
 
 		for (std::size_t i = minBlockCount; i < maxBlockCount; ++i)
 			m_blocks[i] = greater.GetBlock(i); // (x ^ 0 = x)
@@ -514,15 +657,28 @@ namespace Nz
 	{
 		// We only test the blocks in common
 		std::size_t sharedBlocks = std::min(GetBlockCount(), bitset.GetBlockCount());
-		for (std::size_t i = 0; i < sharedBlocks; ++i)
-		{
-			Block a = GetBlock(i);
-			Block b = bitset.GetBlock(i);
-			if (a & b)
-				return true;
-		}
 
-		return false;
+		return Detail::AnyBitsetBlock<Detail::BitsetAND>(m_blocks.data(), bitset.m_blocks.data(), sharedBlocks);
+	}
+
+	/*!
+	* \brief Checks if every enabled bit of the bitset is enabled in another one
+	* \return true if it is the case, which is always true for a bitset without enabled bits
+	*
+	* \param bitset Bitset to test, bits past its size being considered disabled
+	*
+	* \remark Unlike a comparison with the result of PerformsAND, this doesn't allocate anything
+	*/
+
+	template<typename Block, class Allocator>
+	bool Bitset<Block, Allocator>::IsSubsetOf(const Bitset& bitset) const
+	{
+		std::size_t sharedBlocks = std::min(GetBlockCount(), bitset.GetBlockCount());
+		if (Detail::AnyBitsetBlock<Detail::BitsetANDNOT>(m_blocks.data(), bitset.m_blocks.data(), sharedBlocks))
+			return false;
+
+		// Our other bits have no counterpart
+		return FindFirstFrom(sharedBlocks) == npos;
 	}
 
 	/*!
@@ -0,0 +1,54 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_BORROWEDREF_HPP
+#define NAZARA_BORROWEDREF_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/ObjectRef.hpp>
+#include <functional>
+
+namespace Nz
+{
+	template<typename T>
+	class BorrowedRef
+	{
+		public:
+			constexpr BorrowedRef();
+			constexpr BorrowedRef(T* object);
+			template<typename U> BorrowedRef(const ObjectRef<U>& ref);
+			template<typename U> constexpr BorrowedRef(const BorrowedRef<U>& ref);
+			BorrowedRef(const BorrowedRef&) = default;
+			~BorrowedRef() = default;
+
+			constexpr T* Get() const;
+			constexpr bool IsValid() const;
+			ObjectRef<T> Share() const;
+
+			constexpr explicit operator bool() const;
+			constexpr operator T*() const;
+			constexpr T* operator->() const;
+
+			BorrowedRef& operator=(const BorrowedRef&) = default;
+
+		private:
+			T* m_object;
+	};
+
+	template<typename T> struct PointedType<BorrowedRef<T>> { using type = T; };
+	template<typename T> struct PointedType<BorrowedRef<T> const> { using type = T; };
+}
+
+namespace std
+{
+	template<typename T>
+	struct hash<Nz::BorrowedRef<T>>;
+}
+
+#include <Nazara/Core/BorrowedRef.inl>
+
+#endif // NAZARA_BORROWEDREF_HPP
@@ -0,0 +1,145 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <type_traits>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::BorrowedRef
+	* \brief Core class that refers to an object kept alive by an ObjectRef, without counting a reference
+	*
+	* Copying a borrowed reference costs as much as copying a pointer, it must not outlive the references keeping the object alive.
+	* This suits transient lists referencing many objects, like render queues, while the owners of the objects keep them around.
+	*/
+
+	/*!
+	* \brief Constructs a BorrowedRef object referring to nothing
+	*/
+	template<typename T>
+	constexpr BorrowedRef<T>::BorrowedRef() :
+	m_object(nullptr)
+	{
+	}
+
+	/*!
+	* \brief Constructs a BorrowedRef object referring to an object
+	*
+	* \param object Object kept alive by someone else (can be nullptr)
+	*/
+	template<typename T>
+	constexpr BorrowedRef<T>::BorrowedRef(T* object) :
+	m_object(object)
+	{
+	}
+
+	/*!
+	* \brief Constructs a BorrowedRef object borrowing the object of a reference
+	*
+	* \param ref Reference keeping the object alive while it is borrowed
+	*/
+	template<typename T>
+	template<typename U>
+	BorrowedRef<T>::BorrowedRef(const ObjectRef<U>& ref) :
+	m_object(ref.Get())
+	{
+		static_assert(std::is_convertible<U*, T*>::value, "U is not implicitly convertible to T");
+	}
+
+	/*!
+	* \brief Constructs a BorrowedRef object from another type of BorrowedRef
+	*
+	* \param ref BorrowedRef of type U to convert to type T
+	*/
+	template<typename T>
+	template<typename U>
+	constexpr BorrowedRef<T>::BorrowedRef(const BorrowedRef<U>& ref) :
+	m_object(ref.Get())
+	{
+	}
+
+	/*!
+	* \brief Gets the underlying pointer
+	* \return Underlying pointer
+	*/
+	template<typename T>
+	constexpr T* BorrowedRef<T>::Get() const
+	{
+		return m_object;
+	}
+
+	/*!
+	* \brief Checks whether the reference refers to an object
+	* \return true if it is the case
+	*/
+	template<typename T>
+	constexpr bool BorrowedRef<T>::IsValid() const
+	{
+		return m_object != nullptr;
+	}
+
+	/*!
+	* \brief Gets a counted reference to the object, to keep it alive beyond its owners
+	* \return ObjectRef to the object
+	*/
+	template<typename T>
+	ObjectRef<T> BorrowedRef<T>::Share() const
+	{
+		return ObjectRef<T>(m_object);
+	}
+
+	/*!
+	* \brief Converts the reference to bool
+	* \return true if reference refers to an object
+	*
+	* \see IsValid
+	*/
+	template<typename T>
+	constexpr BorrowedRef<T>::operator bool() const
+	{
+		return IsValid();
+	}
+
+	/*!
+	* \brief Dereferences the BorrowedRef
+	* \return Underlying pointer
+	*/
+	template<typename T>
+	constexpr BorrowedRef<T>::operator T*() const
+	{
+		return m_object;
+	}
+
+	/*!
+	* \brief Dereferences the BorrowedRef
+	* \return Underlying pointer
+	*/
+	template<typename T>
+	constexpr T* BorrowedRef<T>::operator->() const
+	{
+		return m_object;
+	}
+}
+
+namespace std
+{
+	template<typename T>
+	struct hash<Nz::BorrowedRef<T>>
+	{
+		/*!
+		* \brief Specialisation of std to hash
+		* \return Result of the hash, the same as the one of the pointer
+		*
+		* \param ref Reference to hash
+		*/
+		size_t operator()(const Nz::BorrowedRef<T>& ref) const
+		{
+			return hash<T*>()(ref.Get());
+		}
+	};
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -0,0 +1,53 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_BYTEARRAYPOOL_HPP
+#define NAZARA_BYTEARRAYPOOL_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <array>
+#include <climits>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_CORE_API ByteArrayPool
+	{
+		public:
+			ByteArrayPool(std::size_t maxHeldBytes = 16 * 1024 * 1024);
+			ByteArrayPool(const ByteArrayPool&) = delete;
+			ByteArrayPool(ByteArrayPool&&) = delete;
+			~ByteArrayPool() = default;
+
+			ByteArray Acquire(std::size_t minCapacity);
+
+			void Clear();
+
+			std::size_t GetHeldBufferCount() const;
+			std::size_t GetHeldBytes() const;
+			std::size_t GetMaxHeldBytes() const;
+
+			void Release(ByteArray&& byteArray);
+
+			void SetMaxHeldBytes(std::size_t maxHeldBytes);
+
+			ByteArrayPool& operator=(const ByteArrayPool&) = delete;
+			ByteArrayPool& operator=(ByteArrayPool&&) = delete;
+
+			static constexpr std::size_t MinCapacity = 64;
+
+		private:
+			std::array<std::vector<ByteArray>, sizeof(std::size_t) * CHAR_BIT> m_buffers; //< Indexed by the log2 of the capacity
+			std::size_t m_heldBufferCount;
+			std::size_t m_heldBytes;
+			std::size_t m_maxHeldBytes;
+			mutable Mutex m_mutex;
+	};
+}
+
+#endif // NAZARA_BYTEARRAYPOOL_HPP
@@ -34,6 +34,8 @@ namespace Nz
 			inline bool FlushBits();
 
 			inline std::size_t Read(void* ptr, std::size_t size);
+			bool ReadBits(UInt64* value, UInt8 bitCount);
+			template<typename... Args> bool ReadValues(Args&... values);
 
 			inline void SetDataEndianness(Endianness endiannes);
 			inline void SetStream(Stream* stream);
@@ -42,6 +44,8 @@ namespace Nz
 			void SetStream(const void* ptr, Nz::UInt64 size);
 
 			inline std::size_t Write(const void* data, std::size_t size);
+			bool WriteBits(UInt64 value, UInt8 bitCount);
+			template<typename... Args> bool WriteValues(const Args&... values);
 
 			template<typename T>
 			ByteStream& operator>>(T& value);
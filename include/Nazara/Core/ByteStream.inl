@@ -3,10 +3,52 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/Endianness.hpp>
+#include <cstring>
+#include <type_traits>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
 {
+	namespace Detail
+	{
+		template<typename... Args>
+		constexpr std::size_t PackedSize()
+		{
+			std::size_t sizes[] = {0, sizeof(Args)...};
+
+			std::size_t packedSize = 0;
+			for (std::size_t size : sizes)
+				packedSize += size;
+
+			return packedSize;
+		}
+
+		template<typename T>
+		void PackValue(UInt8*& ptr, T value, bool swapBytes)
+		{
+			static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value, "Only arithmetic types (except bool) can be packed");
+
+			if (swapBytes)
+				SwapBytes(&value, sizeof(T));
+
+			std::memcpy(ptr, &value, sizeof(T));
+			ptr += sizeof(T);
+		}
+
+		template<typename T>
+		void UnpackValue(const UInt8*& ptr, T& value, bool swapBytes)
+		{
+			static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value, "Only arithmetic types (except bool) can be unpacked");
+
+			std::memcpy(&value, ptr, sizeof(T));
+			ptr += sizeof(T);
+
+			if (swapBytes)
+				SwapBytes(&value, sizeof(T));
+		}
+	}
+
 	/*!
 	* \brief Constructs a ByteStream object with a stream
 	*/
@@ -114,6 +156,39 @@ namespace Nz
 		return m_context.stream->Read(ptr, size);
 	}
 
+	/*!
+	* \brief Reads multiple arithmetic values with a single read from the stream
+	* \return true if every value was read
+	*
+	* \param values Values to read, in order
+	*
+	* \remark Values are unserialized as operator>> does, but the stream only checks its bounds once
+	* \remark Values are left untouched if the read failed
+	*/
+
+	template<typename... Args>
+	bool ByteStream::ReadValues(Args&... values)
+	{
+		if (!m_context.stream)
+			OnEmptyStream();
+
+		FlushBits();
+
+		constexpr std::size_t packedSize = Detail::PackedSize<Args...>();
+
+		UInt8 buffer[packedSize + 1];
+		if (m_context.stream->Read(buffer, packedSize) != packedSize)
+			return false;
+
+		bool swapBytes = (m_context.endianness != Endianness_Unknown && m_context.endianness != GetPlatformEndianness());
+
+		const UInt8* ptr = buffer;
+		int dummy[] = {0, (Detail::UnpackValue(ptr, values, swapBytes), 0)...};
+		NazaraUnused(dummy);
+
+		return true;
+	}
+
 	/*!
 	* \brief Sets the stream endianness
 	*
@@ -163,6 +238,35 @@ namespace Nz
 		return m_context.stream->Write(data, size);
 	}
 
+	/*!
+	* \brief Writes multiple arithmetic values with a single write to the stream
+	* \return true if every value was written
+	*
+	* \param values Values to write, in order
+	*
+	* \remark Values are serialized as operator<< does, but the stream only checks its bounds (or grows) once
+	*/
+
+	template<typename... Args>
+	bool ByteStream::WriteValues(const Args&... values)
+	{
+		if (!m_context.stream)
+			OnEmptyStream();
+
+		FlushBits();
+
+		constexpr std::size_t packedSize = Detail::PackedSize<Args...>();
+
+		UInt8 buffer[packedSize + 1];
+		bool swapBytes = (m_context.endianness != Endianness_Unknown && m_context.endianness != GetPlatformEndianness());
+
+		UInt8* ptr = buffer;
+		int dummy[] = {0, (Detail::PackValue(ptr, values, swapBytes), 0)...};
+		NazaraUnused(dummy);
+
+		return m_context.stream->Write(buffer, packedSize) == packedSize;
+	}
+
 	/*!
 	* \brief Outputs a data from the stream
 	* \return A reference to this
@@ -0,0 +1,87 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_COMPRESSEDSTREAM_HPP
+#define NAZARA_COMPRESSEDSTREAM_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Stream.hpp>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_CORE_API CompressedStream : public Stream
+	{
+		public:
+			static constexpr std::size_t BlockHeaderSize = 8;
+			static constexpr std::size_t DefaultBlockSize = 256 * 1024;
+			static constexpr std::size_t FooterSize = 8;
+			static constexpr std::size_t HeaderSize = 12;
+			static constexpr UInt32 Magic = 0x535A5A4E; //< "NZZS"
+			static constexpr UInt32 Version = 1;
+
+			inline CompressedStream();
+			inline CompressedStream(Stream* stream, OpenModeFlags openMode, std::size_t blockSize = DefaultBlockSize);
+			CompressedStream(const CompressedStream&) = delete;
+			CompressedStream(CompressedStream&&) = delete;
+			~CompressedStream();
+
+			void Close();
+
+			bool EndOfStream() const override;
+
+			inline std::size_t GetBlockCount() const;
+			inline std::size_t GetBlockSize() const;
+			UInt64 GetCursorPos() const override;
+			UInt64 GetSize() const override;
+			inline Stream* GetStream() const;
+
+			inline bool IsOpen() const;
+
+			bool Open(Stream* stream, OpenModeFlags openMode, std::size_t blockSize = DefaultBlockSize);
+
+			bool SetCursorPos(UInt64 offset) override;
+
+			CompressedStream& operator=(const CompressedStream&) = delete;
+			CompressedStream& operator=(CompressedStream&&) = delete;
+
+		private:
+			struct BlockInfo
+			{
+				UInt64 dataOffset; //< From the beginning of the compressed stream
+				UInt64 position;   //< Uncompressed offset of the first byte of the block
+				UInt32 size;
+				UInt32 storedSize; //< Equal to size if the block isn't compressed
+			};
+
+			bool CompressBlocks(std::size_t byteCount);
+			bool DiscoverBlocks();
+			std::size_t FindBlock(UInt64 position) const;
+			void FlushStream() override;
+			bool LoadBlock(std::size_t blockIndex);
+			bool ReadNextBlockHeader();
+			std::size_t ReadBlock(void* buffer, std::size_t size) override;
+			bool ReadSeekTable();
+			std::size_t WriteBlock(const void* buffer, std::size_t size) override;
+
+			std::vector<BlockInfo> m_blocks;
+			std::vector<std::vector<UInt8>> m_compressedBlocks;
+			std::vector<UInt8> m_blockData; //< Decompressed block when reading, data waiting to be compressed when writing
+			std::vector<UInt8> m_storedData;
+			Stream* m_stream;
+			UInt64 m_cursorPos;
+			UInt64 m_size;
+			UInt64 m_streamOffset; //< Position of the compressed stream in the underlying stream
+			UInt64 m_streamSize;   //< Bytes of the compressed stream written or discovered so far
+			std::size_t m_blockSize;
+			std::size_t m_loadedBlock;
+			bool m_lastBlockFound;
+	};
+}
+
+#include <Nazara/Core/CompressedStream.inl>
+
+#endif // NAZARA_COMPRESSEDSTREAM_HPP
@@ -0,0 +1,78 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Constructs a CompressedStream object by default
+	*
+	* \see Open
+	*/
+	inline CompressedStream::CompressedStream() :
+	m_stream(nullptr),
+	m_cursorPos(0),
+	m_size(0),
+	m_streamOffset(0),
+	m_streamSize(0),
+	m_blockSize(DefaultBlockSize),
+	m_loadedBlock(0),
+	m_lastBlockFound(false)
+	{
+	}
+
+	/*!
+	* \brief Constructs a CompressedStream object reading or writing compressed data through another stream
+	*
+	* \param stream Stream holding the compressed data
+	* \param openMode Either OpenMode_ReadOnly or OpenMode_WriteOnly
+	* \param blockSize Size of the blocks compressed independently, only used when writing
+	*
+	* \see Open
+	*/
+	inline CompressedStream::CompressedStream(Stream* stream, OpenModeFlags openMode, std::size_t blockSize) :
+	CompressedStream()
+	{
+		Open(stream, openMode, blockSize);
+	}
+
+	/*!
+	* \brief Gets the number of blocks written or found so far
+	* \return Block count
+	*/
+	inline std::size_t CompressedStream::GetBlockCount() const
+	{
+		return m_blocks.size();
+	}
+
+	/*!
+	* \brief Gets the size of the blocks compressed independently
+	* \return Block size (uncompressed)
+	*/
+	inline std::size_t CompressedStream::GetBlockSize() const
+	{
+		return m_blockSize;
+	}
+
+	/*!
+	* \brief Gets the stream holding the compressed data
+	* \return Pointer to the stream, nullptr if the compressed stream is closed
+	*/
+	inline Stream* CompressedStream::GetStream() const
+	{
+		return m_stream;
+	}
+
+	/*!
+	* \brief Checks whether the compressed stream is open
+	* \return true If it is the case
+	*/
+	inline bool CompressedStream::IsOpen() const
+	{
+		return m_stream != nullptr;
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
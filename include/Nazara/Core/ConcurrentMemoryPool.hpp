@@ -0,0 +1,75 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_CONCURRENTMEMORYPOOL_HPP
+#define NAZARA_CONCURRENTMEMORYPOOL_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <array>
+#include <atomic>
+#include <memory>
+
+namespace Nz
+{
+	class NAZARA_CORE_API ConcurrentMemoryPool
+	{
+		public:
+			ConcurrentMemoryPool(std::size_t blockSize, std::size_t chunkSize = 1024, std::size_t magazineSize = 32, std::size_t cachedThreadCount = 64);
+			ConcurrentMemoryPool(const ConcurrentMemoryPool&) = delete;
+			ConcurrentMemoryPool(ConcurrentMemoryPool&&) = delete;
+			~ConcurrentMemoryPool();
+
+			void* Allocate(std::size_t size);
+
+			template<typename T> void Delete(T* ptr);
+
+			void Free(void* ptr);
+
+			inline std::size_t GetBlockCount() const;
+			inline std::size_t GetBlockSize() const;
+
+			template<typename T, typename... Args> T* New(Args&&... args);
+
+			ConcurrentMemoryPool& operator=(const ConcurrentMemoryPool&) = delete;
+			ConcurrentMemoryPool& operator=(ConcurrentMemoryPool&&) = delete;
+
+		private:
+			struct ThreadCache
+			{
+				UInt32* blocks;
+				std::size_t count;
+				UInt8 padding[64 - sizeof(UInt32*) - sizeof(std::size_t)]; // Keeps the counters of two threads on different cache lines
+			};
+
+			UInt32 AcquireBlock();
+			inline UInt8* GetBlock(UInt32 index) const;
+			UInt32 GetBlockIndex(const void* ptr) const;
+			inline std::atomic<UInt32>& GetBlockLink(UInt32 index) const;
+			bool Grow();
+			UInt32 Pop();
+			void Push(UInt32 first, UInt32 last);
+
+			static constexpr std::size_t MaxChunkCount = 32;
+			static constexpr UInt32 InvalidBlock = 0xFFFFFFFF;
+
+			std::array<std::atomic<UInt8*>, MaxChunkCount> m_chunks;
+			std::atomic<UInt64> m_head; //< Free list top block index (low bits) and ABA tag (high bits)
+			std::atomic<std::size_t> m_blockCount;
+			std::atomic_uint m_chunkCount;
+			std::size_t m_blockSize;
+			std::size_t m_cachedThreadCount;
+			std::size_t m_chunkSize;
+			std::size_t m_magazineSize;
+			std::unique_ptr<ThreadCache[]> m_caches;
+			std::unique_ptr<UInt32[]> m_cachedBlocks;
+			Mutex m_growMutex;
+	};
+}
+
+#include <Nazara/Core/ConcurrentMemoryPool.inl>
+
+#endif // NAZARA_CONCURRENTMEMORYPOOL_HPP
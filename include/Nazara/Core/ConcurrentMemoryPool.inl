@@ -0,0 +1,84 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/ConcurrentMemoryPool.hpp>
+#include <Nazara/Core/MemoryHelper.hpp>
+#include <Nazara/Math/Algorithm.hpp>
+#include <utility>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Destroys an object allocated by this pool and releases its memory
+	*
+	* Calls the destructor of the object before releasing it
+	*
+	* \remark If ptr is null, nothing is done
+	*/
+	template<typename T>
+	void ConcurrentMemoryPool::Delete(T* ptr)
+	{
+		if (ptr)
+		{
+			ptr->~T();
+			Free(ptr);
+		}
+	}
+
+	/*!
+	* \brief Gets the number of blocks owned by the pool
+	* \return Number of blocks allocated so far, either free or in use
+	*/
+
+	inline std::size_t ConcurrentMemoryPool::GetBlockCount() const
+	{
+		return m_blockCount.load(std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Gets the block size
+	* \return Size of the blocks
+	*/
+
+	inline std::size_t ConcurrentMemoryPool::GetBlockSize() const
+	{
+		return m_blockSize;
+	}
+
+	/*!
+	* \brief Creates a new value of type T with arguments
+	* \return Pointer to the allocated object
+	*
+	* \param args Arguments for the new object
+	*
+	* \remark Constructs inplace in the pool
+	*/
+
+	template<typename T, typename... Args>
+	T* ConcurrentMemoryPool::New(Args&&... args)
+	{
+		T* object = static_cast<T*>(Allocate(sizeof(T)));
+		PlacementNew(object, std::forward<Args>(args)...);
+
+		return object;
+	}
+
+	inline UInt8* ConcurrentMemoryPool::GetBlock(UInt32 index) const
+	{
+		// Chunk n holds chunkSize * 2^n blocks, starting at block chunkSize * (2^n - 1)
+		unsigned int chunkIndex = IntegralLog2(static_cast<UInt32>(index / m_chunkSize + 1));
+		std::size_t firstBlock = m_chunkSize * ((std::size_t(1) << chunkIndex) - 1);
+
+		return m_chunks[chunkIndex].load(std::memory_order_relaxed) + (index - firstBlock) * m_blockSize;
+	}
+
+	inline std::atomic<UInt32>& ConcurrentMemoryPool::GetBlockLink(UInt32 index) const
+	{
+		// Free blocks store the index of the next free block in their first bytes
+		return *reinterpret_cast<std::atomic<UInt32>*>(GetBlock(index));
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -43,6 +43,9 @@
 // Checks the assertions
 #define NAZARA_CORE_ENABLE_ASSERTS 0
 
+// Compile the warnings (their messages are never built otherwise)
+#define NAZARA_CORE_ENABLE_WARNINGS 1
+
 // Call exit when an assertion is invalid
 #define NAZARA_CORE_EXIT_ON_ASSERT_FAILURE 1
 
@@ -55,6 +58,12 @@
 // Use the MemoryManager to manage dynamic allocations (can detect memory leak but allocations/frees are slower)
 #define NAZARA_CORE_MANAGE_MEMORY 0
 
+// Maximum number of metrics registered at once, each thread updating metrics holds a value for each of them
+#define NAZARA_CORE_METRIC_COUNT 1024
+
+// Number of scopes kept by the profiler for each thread, the oldest ones being overwritten
+#define NAZARA_CORE_PROFILER_EVENT_COUNT 16384
+
 // Activate the security tests based on the code (Advised for development)
 #define NAZARA_CORE_SAFE 1
 
@@ -69,6 +78,9 @@
 #define NAZARA_THREADSAFETY_LOG 1          // Log
 #define NAZARA_THREADSAFETY_REFCOUNTED 1   // RefCounted
 
+// Number of attempts to take a contended mutex by spinning before the thread waits for it, on POSIX platforms (0 to disable)
+#define NAZARA_CORE_POSIX_MUTEX_SPINLOCKS 100
+
 // Number of spinlocks to use with the Windows critical sections (0 to disable)
 #define NAZARA_CORE_WINDOWS_CS_SPINLOCKS 4096
 
@@ -4,5 +4,7 @@
 
 #include <Nazara/Core/Config.hpp>
 #if NAZARA_CORE_MANAGE_MEMORY
+	#undef NAZARA_MEMORY_TAG
+	#define NAZARA_MEMORY_TAG Nz::MemoryTag_Core
 	#include <Nazara/Core/Debug/NewRedefinition.hpp>
 #endif
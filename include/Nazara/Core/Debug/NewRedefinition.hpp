@@ -13,16 +13,21 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/MemoryManager.hpp>
 
-NAZARA_CORE_API void* operator new(std::size_t size, const char* file, unsigned int line);
-NAZARA_CORE_API void* operator new[](std::size_t size, const char* file, unsigned int line);
-NAZARA_CORE_API void operator delete(void* ptr, const char* file, unsigned int line) noexcept;
-NAZARA_CORE_API void operator delete[](void* ptr, const char* file, unsigned int line) noexcept;
+NAZARA_CORE_API void* operator new(std::size_t size, const char* file, unsigned int line, Nz::MemoryTag tag);
+NAZARA_CORE_API void* operator new[](std::size_t size, const char* file, unsigned int line, Nz::MemoryTag tag);
+NAZARA_CORE_API void operator delete(void* ptr, const char* file, unsigned int line, Nz::MemoryTag tag) noexcept;
+NAZARA_CORE_API void operator delete[](void* ptr, const char* file, unsigned int line, Nz::MemoryTag tag) noexcept;
 
 #endif // NAZARA_DEBUG_NEWREDEFINITION_HPP
 
+// Allocations are accounted to the module whose Debug.hpp was included last
+#ifndef NAZARA_MEMORY_TAG
+	#define NAZARA_MEMORY_TAG Nz::MemoryTag_Other
+#endif
+
 #ifndef NAZARA_DEBUG_NEWREDEFINITION_DISABLE_REDEFINITION
 	#define delete MemoryManager::NextFree(__FILE__, __LINE__), delete
-	#define new new(__FILE__, __LINE__)
+	#define new new(__FILE__, __LINE__, NAZARA_MEMORY_TAG)
 #endif
 
 #endif // NAZARA_CORE_MANAGE_MEMORY
@@ -10,6 +10,8 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/MovablePtr.hpp>
 #include <Nazara/Core/String.hpp>
+#include <ctime>
+#include <vector>
 
 #if defined(NAZARA_PLATFORM_WINDOWS)
 	#define NAZARA_DIRECTORY_SEPARATOR '\\'
@@ -28,8 +30,18 @@
 
 namespace Nz
 {
+	class DirectoryCache;
 	class DirectoryImpl;
 
+	struct DirectoryEntry
+	{
+		String path;
+		UInt64 size;          //< Zero for directories
+		time_t lastWriteTime;
+		bool isDirectory;
+		bool isLink;          //< Symbolic link (or reparse point), metadata being the one of its target
+	};
+
 	class NAZARA_CORE_API Directory
 	{
 		public:
@@ -65,6 +77,7 @@ namespace Nz
 			static String GetCurrent();
 			static const char* GetCurrentFileRelativeToEngine(const char* currentFile);
 			static bool Remove(const String& dirPath, bool emptyDirectory = false);
+			static bool Scan(const String& dirPath, std::vector<DirectoryEntry>* entries, bool recursive = true, DirectoryCache* cache = nullptr);
 			static bool SetCurrent(const String& dirPath);
 
 			Directory& operator=(const Directory&) = delete;
@@ -0,0 +1,55 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_DIRECTORYCACHE_HPP
+#define NAZARA_DIRECTORYCACHE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Directory.hpp>
+#include <Nazara/Core/String.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_CORE_API DirectoryCache
+	{
+		friend Directory;
+
+		public:
+			DirectoryCache() = default;
+			DirectoryCache(const DirectoryCache&) = default;
+			DirectoryCache(DirectoryCache&&) = default;
+			~DirectoryCache() = default;
+
+			inline void Clear();
+
+			inline std::size_t GetDirectoryCount() const;
+
+			bool LoadFromFile(const String& filePath);
+
+			bool SaveToFile(const String& filePath) const;
+
+			DirectoryCache& operator=(const DirectoryCache&) = default;
+			DirectoryCache& operator=(DirectoryCache&&) = default;
+
+			static constexpr UInt32 Magic = 0x43445A4E; //< "NZDC"
+			static constexpr UInt32 Version = 1;
+
+		private:
+			struct CachedDirectory
+			{
+				std::vector<DirectoryEntry> entries;
+				UInt64 stamp;
+			};
+
+			std::unordered_map<String, CachedDirectory> m_directories;
+	};
+}
+
+#include <Nazara/Core/DirectoryCache.inl>
+
+#endif // NAZARA_DIRECTORYCACHE_HPP
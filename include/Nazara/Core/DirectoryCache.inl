@@ -0,0 +1,29 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Removes every cached directory
+	*/
+
+	inline void DirectoryCache::Clear()
+	{
+		m_directories.clear();
+	}
+
+	/*!
+	* \brief Gets the number of cached directories
+	* \return Directory count
+	*/
+
+	inline std::size_t DirectoryCache::GetDirectoryCount() const
+	{
+		return m_directories.size();
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -46,8 +46,9 @@ namespace Nz
 		ErrorFlag_SilentDisabled         = 0x2,
 		ErrorFlag_ThrowException         = 0x4,
 		ErrorFlag_ThrowExceptionDisabled = 0x8,
+		ErrorFlag_Discard                = 0x10,
 
-		ErrorFlag_Max = ErrorFlag_ThrowExceptionDisabled * 2 - 1
+		ErrorFlag_Max = ErrorFlag_Discard * 2 - 1
 	};
 
 	enum ErrorType
@@ -60,9 +61,19 @@ namespace Nz
 		ErrorType_Max = ErrorType_Warning
 	};
 
+	enum GrowthPolicy
+	{
+		GrowthPolicy_Exact,     // Grow to the needed size only
+		GrowthPolicy_Geometric, // Double the capacity
+		GrowthPolicy_Linear,    // Grow by fixed increments
+
+		GrowthPolicy_Max = GrowthPolicy_Linear
+	};
+
 	enum HashType
 	{
 		HashType_CRC32,
+		HashType_CRC32C,
 		HashType_CRC64,
 		HashType_Fletcher16,
 		HashType_MD5,
@@ -72,21 +83,40 @@ namespace Nz
 		HashType_SHA384,
 		HashType_SHA512,
 		HashType_Whirlpool,
+		HashType_XXH3,
+
+		HashType_Max = HashType_XXH3
+	};
+
+	enum IOPriority
+	{
+		IOPriority_Low,
+		IOPriority_Normal,
+		IOPriority_High,
+
+		IOPriority_Max = IOPriority_High
+	};
+
+	enum MetricType
+	{
+		MetricType_Counter,
+		MetricType_Gauge,
 
-		HashType_Max = HashType_Whirlpool
+		MetricType_Max = MetricType_Gauge
 	};
 
 	enum OpenMode
 	{
-		OpenMode_NotOpen,   // Use the current mod of opening
+		OpenMode_NotOpen,    // Use the current mod of opening
 
-		OpenMode_Append,    // Disable writing on existing parts and put the cursor at the end
-		OpenMode_Lock,      // Disable modifying the file before it is open
-		OpenMode_MustExist, // Fail if the file doesn't exists, even if opened in write mode
-		OpenMode_ReadOnly,  // Open in read only
-		OpenMode_Text,      // Open in text mod
-		OpenMode_Truncate,  // Create the file if it doesn't exist and empty it if it exists
-		OpenMode_WriteOnly, // Open in write only, create the file if it doesn't exist
+		OpenMode_Append,     // Disable writing on existing parts and put the cursor at the end
+		OpenMode_Lock,       // Disable modifying the file before it is open
+		OpenMode_MustExist,  // Fail if the file doesn't exists, even if opened in write mode
+		OpenMode_ReadOnly,   // Open in read only
+		OpenMode_Text,       // Open in text mod
+		OpenMode_Truncate,   // Create the file if it doesn't exist and empty it if it exists
+		OpenMode_Unbuffered, // Bypass the system cache where allowed, reads and writes must then be aligned (see File::GetIOAlignment)
+		OpenMode_WriteOnly,  // Open in write only, create the file if it doesn't exist
 
 		OpenMode_Max = OpenMode_WriteOnly
 	};
@@ -136,6 +166,8 @@ namespace Nz
 	{
 		ProcessorCap_x64,
 		ProcessorCap_AVX,
+		ProcessorCap_AVX2,
+		ProcessorCap_AVX512, // F, BW, DQ and VL subsets
 		ProcessorCap_FMA3,
 		ProcessorCap_FMA4,
 		ProcessorCap_MMX,
@@ -147,8 +179,9 @@ namespace Nz
 		ProcessorCap_SSE41,
 		ProcessorCap_SSE42,
 		ProcessorCap_SSE4a,
+		ProcessorCap_SHA,
 
-		ProcessorCap_Max = ProcessorCap_SSE4a
+		ProcessorCap_Max = ProcessorCap_SHA
 	};
 
 	enum ProcessorVendor
@@ -175,6 +208,28 @@ namespace Nz
 		ProcessorVendor_Max = ProcessorVendor_XenHVM
 	};
 
+	enum ResourceLoadState
+	{
+		ResourceLoadState_Failed,
+		ResourceLoadState_Finalizing, // Decoded, waiting for ResourceFinalizationQueue::Process
+		ResourceLoadState_Loaded,
+		ResourceLoadState_Loading,    // Being decoded by the task scheduler
+
+		ResourceLoadState_Max = ResourceLoadState_Loading
+	};
+
+	enum SimdTarget
+	{
+		SimdTarget_Scalar,
+		SimdTarget_NEON,
+		SimdTarget_SSE2,
+		SimdTarget_SSE41,  // SSE4.1 and below (SSSE3 included)
+		SimdTarget_AVX2,   // AVX2 and FMA3
+		SimdTarget_AVX512, // AVX-512 F, BW, DQ and VL
+
+		SimdTarget_Max = SimdTarget_AVX512
+	};
+
 	enum SphereType
 	{
 		SphereType_Cubic,
@@ -210,6 +265,17 @@ namespace Nz
 
 		Ternary_Max = Ternary_Unknown
 	};
+
+	enum ThreadPriority
+	{
+		ThreadPriority_Lowest,
+		ThreadPriority_Low,
+		ThreadPriority_Normal,
+		ThreadPriority_High,
+		ThreadPriority_Highest,
+
+		ThreadPriority_Max = ThreadPriority_Highest
+	};
 }
 
 #endif // NAZARA_ENUMS_CORE_HPP
@@ -18,9 +18,17 @@
 	#define NazaraAssert(a, err) for (;;) break
 #endif
 
-#define NazaraError(err) Nz::Error::Trigger(Nz::ErrorType_Normal, err, __LINE__, __FILE__, NAZARA_FUNCTION)
-#define NazaraInternalError(err) Nz::Error::Trigger(Nz::ErrorType_Internal, err, __LINE__, __FILE__, NAZARA_FUNCTION)
-#define NazaraWarning(err) Nz::Error::Trigger(Nz::ErrorType_Warning, err, __LINE__, __FILE__, NAZARA_FUNCTION)
+// The message is only built if the error isn't discarded (see ErrorFlag_Discard)
+#define NazaraTriggerError(type, err) do { if (!Nz::Error::IsDiscarded(type)) Nz::Error::Trigger(type, err, __LINE__, __FILE__, NAZARA_FUNCTION); } while (false)
+
+#define NazaraError(err) NazaraTriggerError(Nz::ErrorType_Normal, err)
+#define NazaraInternalError(err) NazaraTriggerError(Nz::ErrorType_Internal, err)
+
+#if NAZARA_CORE_ENABLE_WARNINGS
+	#define NazaraWarning(err) NazaraTriggerError(Nz::ErrorType_Warning, err)
+#else
+	#define NazaraWarning(err) for (;;) break
+#endif
 
 namespace Nz
 {
@@ -35,6 +43,8 @@ namespace Nz
 			static unsigned int GetLastSystemErrorCode();
 			static String GetLastSystemError(unsigned int code = GetLastSystemErrorCode());
 
+			static bool IsDiscarded(ErrorType type);
+
 			static void SetFlags(UInt32 flags);
 
 			static void Trigger(ErrorType type, const String& error);
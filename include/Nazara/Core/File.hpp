@@ -10,6 +10,7 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/ByteArray.hpp>
 #include <Nazara/Core/Endianness.hpp>
+#include <Nazara/Core/FileIOQueue.hpp>
 #include <Nazara/Core/MovablePtr.hpp>
 #include <Nazara/Core/Stream.hpp>
 #include <Nazara/Core/String.hpp>
@@ -50,6 +51,7 @@ namespace Nz
 			UInt64 GetCursorPos() const override;
 			String GetDirectory() const override;
 			String GetFileName() const;
+			std::size_t GetIOAlignment() const;
 			time_t GetLastAccessTime() const;
 			time_t GetLastWriteTime() const;
 			String GetPath() const override;
@@ -60,6 +62,8 @@ namespace Nz
 			bool Open(OpenModeFlags openMode = OpenMode_NotOpen);
 			bool Open(const String& filePath, OpenModeFlags openMode = OpenMode_NotOpen);
 
+			std::future<FileIOResult> ReadAsync(UInt64 offset, void* buffer, std::size_t size, IOPriority priority = IOPriority_Normal);
+
 			bool Rename(const String& newFilePath);
 
 			bool SetCursorPos(CursorPosition pos, Int64 offset = 0);
@@ -67,11 +71,15 @@ namespace Nz
 			bool SetFile(const String& filePath);
 			bool SetSize(UInt64 size);
 
+			void WaitForAsync();
+			std::future<FileIOResult> WriteAsync(UInt64 offset, const void* buffer, std::size_t size, IOPriority priority = IOPriority_Normal);
+
 			File& operator=(const String& filePath);
 			File& operator=(const File&) = delete;
 			File& operator=(File&& file) noexcept = default;
 
 			static String AbsolutePath(const String& filePath);
+			static String CanonicalPath(const String& filePath);
 			static inline ByteArray ComputeHash(HashType hash, const String& filePath);
 			static inline ByteArray ComputeHash(AbstractHash* hash, const String& filePath);
 			static bool Copy(const String& sourcePath, const String& targetPath);
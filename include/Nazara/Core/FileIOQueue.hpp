@@ -0,0 +1,59 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_FILEIOQUEUE_HPP
+#define NAZARA_FILEIOQUEUE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Enums.hpp>
+#include <future>
+
+namespace Nz
+{
+	class FileImpl;
+
+	struct FileIOResult
+	{
+		std::size_t byteCount = 0;
+		bool succeeded = false;
+	};
+
+	class NAZARA_CORE_API FileIOQueue
+	{
+		friend class Core;
+		friend class File;
+
+		public:
+			FileIOQueue() = delete;
+			~FileIOQueue() = delete;
+
+			static std::size_t GetPendingCount();
+
+			static void WaitForAll();
+
+			static constexpr std::size_t MaxBatchSize = 32;
+			static constexpr unsigned int ThreadCount = 4;
+
+		private:
+			enum class Operation
+			{
+				Read,
+				Write
+			};
+
+			struct Request;
+			struct State;
+
+			static std::future<FileIOResult> Enqueue(FileImpl* file, Operation operation, UInt64 offset, void* buffer, std::size_t size, IOPriority priority);
+			static State& GetState();
+			static bool Initialize();
+			static void Uninitialize();
+			static void Wait(FileImpl* file);
+			static void WorkerThread();
+	};
+}
+
+#endif // NAZARA_FILEIOQUEUE_HPP
@@ -25,6 +25,8 @@ namespace Nz
 			void EnableTimeLogging(bool enable);
 			void EnableStdReplication(bool enable) override;
 
+			void Flush() override;
+
 			bool IsStdReplicationEnabled() const override;
 			bool IsTimeLoggingEnabled() const;
 
@@ -0,0 +1,44 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_FILEWATCHER_HPP
+#define NAZARA_FILEWATCHER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/MovablePtr.hpp>
+#include <Nazara/Core/String.hpp>
+#include <vector>
+
+namespace Nz
+{
+	class FileWatcherImpl;
+
+	class NAZARA_CORE_API FileWatcher
+	{
+		public:
+			FileWatcher();
+			FileWatcher(const FileWatcher&) = delete;
+			FileWatcher(FileWatcher&& watcher) noexcept = default;
+			~FileWatcher();
+
+			bool IsWatching(const String& directoryPath) const;
+
+			std::size_t Poll(std::vector<String>* changedFiles);
+
+			void Unwatch(const String& directoryPath);
+
+			bool Watch(const String& directoryPath, bool recursive = true);
+
+			FileWatcher& operator=(const FileWatcher&) = delete;
+			FileWatcher& operator=(FileWatcher&& watcher) noexcept = default;
+
+		private:
+			std::vector<String> m_directories;
+			MovablePtr<FileWatcherImpl> m_impl;
+	};
+}
+
+#endif // NAZARA_FILEWATCHER_HPP
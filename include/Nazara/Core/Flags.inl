@@ -218,7 +218,7 @@ namespace Nz
 	template<typename E>
 	constexpr typename Flags<E>::BitField Flags<E>::GetFlagValue(E enumValue)
 	{
-		return 1U << static_cast<BitField>(enumValue);
+		return BitField(1) << static_cast<BitField>(enumValue);
 	}
 
 
@@ -0,0 +1,62 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_FRAMEARENA_HPP
+#define NAZARA_FRAMEARENA_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/LargePageMemory.hpp>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_CORE_API FrameArena
+	{
+		public:
+			FrameArena(std::size_t blockSize = 64 * 1024, bool largePages = false);
+			FrameArena(const FrameArena&) = delete;
+			FrameArena(FrameArena&&) noexcept = default;
+			~FrameArena() = default;
+
+			inline void* Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+
+			inline std::size_t GetAllocatedSize() const;
+			inline std::size_t GetBlockCount() const;
+			inline std::size_t GetCapacity() const;
+
+			inline bool IsUsingLargePages() const;
+
+			template<typename T, typename... Args> T* New(Args&&... args);
+
+			void Reset();
+
+			FrameArena& operator=(const FrameArena&) = delete;
+			FrameArena& operator=(FrameArena&&) noexcept = default;
+
+		private:
+			struct Block
+			{
+				std::unique_ptr<UInt8[], LargePageDeleter> memory;
+				std::size_t size;
+			};
+
+			void* AllocateFromNewBlock(std::size_t size, std::size_t alignment);
+			Block CreateBlock(std::size_t size) const;
+
+			std::size_t m_allocatedSize;
+			std::size_t m_blockSize;
+			std::size_t m_capacity;
+			std::size_t m_offset;
+			std::vector<Block> m_blocks;
+			bool m_largePages;
+	};
+}
+
+#include <Nazara/Core/FrameArena.inl>
+
+#endif // NAZARA_FRAMEARENA_HPP
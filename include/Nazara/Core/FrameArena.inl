@@ -0,0 +1,109 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/FrameArena.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/MemoryHelper.hpp>
+#include <type_traits>
+#include <utility>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Allocates memory from the current block of the arena
+	* \return Pointer to the allocated memory, valid until the next call to Reset
+	*
+	* \param size Size to allocate
+	* \param alignment Alignment of the returned pointer, must be a power of two
+	*
+	* \remark A new block is allocated if the current one cannot hold the requested size
+	*/
+
+	inline void* FrameArena::Allocate(std::size_t size, std::size_t alignment)
+	{
+		NazaraAssert(alignment != 0 && (alignment & (alignment - 1)) == 0, "Alignment must be a power of two");
+
+		if (!m_blocks.empty())
+		{
+			Block& block = m_blocks.back();
+
+			std::uintptr_t address = reinterpret_cast<std::uintptr_t>(block.memory.get()) + m_offset;
+			std::size_t padding = static_cast<std::size_t>((alignment - (address & (alignment - 1))) & (alignment - 1));
+			if (m_offset + padding + size <= block.size)
+			{
+				m_offset += padding + size;
+				m_allocatedSize += size;
+
+				return reinterpret_cast<void*>(address + padding);
+			}
+		}
+
+		return AllocateFromNewBlock(size, alignment);
+	}
+
+	/*!
+	* \brief Gets the number of bytes allocated since the last reset
+	* \return Allocated size, without alignment padding
+	*/
+
+	inline std::size_t FrameArena::GetAllocatedSize() const
+	{
+		return m_allocatedSize;
+	}
+
+	/*!
+	* \brief Gets the number of memory blocks owned by the arena
+	* \return Block count
+	*
+	* \remark After a reset, the arena only keeps one block big enough for everything allocated before
+	*/
+
+	inline std::size_t FrameArena::GetBlockCount() const
+	{
+		return m_blocks.size();
+	}
+
+	/*!
+	* \brief Gets the memory owned by the arena
+	* \return Total size of the blocks
+	*/
+
+	inline std::size_t FrameArena::GetCapacity() const
+	{
+		return m_capacity;
+	}
+
+	/*!
+	* \brief Checks whether the blocks of the arena are requested in large pages
+	* \return true if the arena was created with large pages
+	*/
+
+	inline bool FrameArena::IsUsingLargePages() const
+	{
+		return m_largePages;
+	}
+
+	/*!
+	* \brief Creates a new value of type T with arguments
+	* \return Pointer to the allocated object, valid until the next call to Reset
+	*
+	* \param args Arguments for the new object
+	*
+	* \remark Objects are never destroyed by the arena, hence T must be trivially destructible
+	*/
+
+	template<typename T, typename... Args>
+	T* FrameArena::New(Args&&... args)
+	{
+		static_assert(std::is_trivially_destructible<T>::value, "Objects allocated from a FrameArena are never destroyed");
+
+		T* object = static_cast<T*>(Allocate(sizeof(T), alignof(T)));
+		PlacementNew(object, std::forward<Args>(args)...);
+
+		return object;
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
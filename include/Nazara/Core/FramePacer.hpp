@@ -0,0 +1,64 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_FRAMEPACER_HPP
+#define NAZARA_FRAMEPACER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Config.hpp>
+
+namespace Nz
+{
+	class NAZARA_CORE_API FramePacer
+	{
+		public:
+			struct Statistics;
+
+			FramePacer(unsigned int framerateLimit = 0);
+			FramePacer(const FramePacer&) = default;
+			FramePacer(FramePacer&&) noexcept = default;
+			~FramePacer() = default;
+
+			inline unsigned int GetFramerateLimit() const;
+			inline UInt64 GetSleepMargin() const;
+			inline const Statistics& GetStatistics() const;
+
+			void ResetStatistics();
+			void Restart();
+
+			void SetFramerateLimit(unsigned int framerateLimit);
+			inline void SetSleepMargin(UInt64 microseconds);
+
+			UInt64 Wait();
+
+			FramePacer& operator=(const FramePacer&) = default;
+			FramePacer& operator=(FramePacer&&) noexcept = default;
+
+			struct Statistics
+			{
+				UInt64 averageFrameTime = 0; //< Microseconds
+				UInt64 droppedFrameCount = 0;
+				UInt64 frameCount = 0;
+				UInt64 lastFrameTime = 0;    //< Microseconds
+				UInt64 lateFrameCount = 0;
+				UInt64 maxFrameTime = 0;     //< Microseconds
+				UInt64 minFrameTime = 0;     //< Microseconds
+				UInt64 totalFrameTime = 0;   //< Microseconds
+			};
+
+		private:
+			Statistics m_statistics;
+			UInt64 m_frameDuration;
+			UInt64 m_lastFrameTime;
+			UInt64 m_nextDeadline;
+			UInt64 m_sleepMargin;
+			unsigned int m_framerateLimit;
+	};
+}
+
+#include <Nazara/Core/FramePacer.inl>
+
+#endif // NAZARA_FRAMEPACER_HPP
@@ -0,0 +1,48 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/FramePacer.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the maximum number of frames per second
+	* \return Framerate limit, zero if frames aren't limited
+	*/
+	inline unsigned int FramePacer::GetFramerateLimit() const
+	{
+		return m_framerateLimit;
+	}
+
+	/*!
+	* \brief Gets the time spent yielding instead of sleeping before a deadline
+	* \return Sleep margin in microseconds
+	*/
+	inline UInt64 FramePacer::GetSleepMargin() const
+	{
+		return m_sleepMargin;
+	}
+
+	/*!
+	* \brief Gets the timing statistics of the frames waited until now
+	* \return Frame statistics
+	*/
+	inline const FramePacer::Statistics& FramePacer::GetStatistics() const
+	{
+		return m_statistics;
+	}
+
+	/*!
+	* \brief Sets the time spent yielding instead of sleeping before a deadline
+	*
+	* \param microseconds Sleep margin, which should be over the scheduler granularity of the system
+	*/
+	inline void FramePacer::SetSleepMargin(UInt64 microseconds)
+	{
+		m_sleepMargin = microseconds;
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
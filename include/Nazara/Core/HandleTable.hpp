@@ -0,0 +1,49 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_HANDLETABLE_HPP
+#define NAZARA_HANDLETABLE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Config.hpp>
+
+namespace Nz
+{
+	class NAZARA_CORE_API HandleTable
+	{
+		public:
+			struct Slot
+			{
+				void* object;
+				UInt32 generation;
+			};
+
+			HandleTable() = delete;
+			~HandleTable() = delete;
+
+			static UInt32 Allocate(void* object);
+
+			static inline const Slot& GetSlot(UInt32 index);
+
+			static void Release(UInt32 index);
+
+			static inline void SetObject(UInt32 index, void* object);
+
+			static constexpr UInt32 InvalidIndex = 0;
+
+		private:
+			static constexpr UInt32 ChunkCount = 16384;
+			static constexpr UInt32 ChunkShift = 10;
+			static constexpr UInt32 ChunkSize = 1U << ChunkShift;
+
+			static Slot* s_chunks[ChunkCount];
+			static Slot s_firstChunk[ChunkSize];
+	};
+}
+
+#include <Nazara/Core/HandleTable.inl>
+
+#endif // NAZARA_HANDLETABLE_HPP
@@ -0,0 +1,37 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets a slot of the table
+	* \return Slot holding the object and the generation handles are compared to
+	*
+	* \param index Index of the slot, InvalidIndex giving a slot no handle is ever valid for
+	*/
+	inline const HandleTable::Slot& HandleTable::GetSlot(UInt32 index)
+	{
+		NazaraAssert(s_chunks[index >> ChunkShift], "Invalid slot index");
+
+		return s_chunks[index >> ChunkShift][index & (ChunkSize - 1)];
+	}
+
+	/*!
+	* \brief Changes the object of a slot, when the object is moved
+	*
+	* \param index Index of an allocated slot
+	* \param object New address of the object
+	*/
+	inline void HandleTable::SetObject(UInt32 index, void* object)
+	{
+		NazaraAssert(index != InvalidIndex && s_chunks[index >> ChunkShift], "Invalid slot index");
+
+		s_chunks[index >> ChunkShift][index & (ChunkSize - 1)].object = object;
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
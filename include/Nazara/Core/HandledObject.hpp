@@ -7,9 +7,8 @@
 #ifndef NAZARA_OBJECTHANDLER_HPP
 #define NAZARA_OBJECTHANDLER_HPP
 
-#include <Nazara/Core/Bitset.hpp>
-#include <memory>
-#include <vector>
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/HandleTable.hpp>
 
 namespace Nz
 {
@@ -35,11 +34,9 @@ namespace Nz
 			void UnregisterAllHandles() noexcept;
 
 		private:
-			void RegisterHandle(ObjectHandle<T>* handle);
-			void UnregisterHandle(ObjectHandle<T>* handle) noexcept;
-			void UpdateHandle(ObjectHandle<T>* oldHandle, ObjectHandle<T>* newHandle) noexcept;
+			UInt32 GetHandleIndex();
 
-			std::vector<ObjectHandle<T>*> m_handles;
+			UInt32 m_handleIndex = HandleTable::InvalidIndex;
 	};
 }
 
@@ -4,9 +4,6 @@
 
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/ObjectHandle.hpp>
-#include <algorithm>
-#include <type_traits>
-#include <utility>
 
 namespace Nz
 {
@@ -14,6 +11,11 @@ namespace Nz
 	* \ingroup core
 	* \class Nz::HandledObject<T>
 	* \brief Core class that represents a handled object
+	*
+	* The object gets a slot in the HandleTable when its first handle is created, handles then only hold the slot index and its generation.
+	* Destroying the object invalidates every handle to it in constant time, however many they are.
+	*
+	* \see ObjectHandle
 	*/
 
 	/*!
@@ -35,10 +37,13 @@ namespace Nz
 	*/
 	template<typename T>
 	HandledObject<T>::HandledObject(HandledObject&& object) noexcept :
-	m_handles(std::move(object.m_handles))
+	m_handleIndex(object.m_handleIndex)
 	{
-		for (ObjectHandle<T>* handle : m_handles)
-			handle->OnObjectMoved(static_cast<T*>(this));
+		object.m_handleIndex = HandleTable::InvalidIndex;
+
+		// The handles keep the slot, only the address of the object changes
+		if (m_handleIndex != HandleTable::InvalidIndex)
+			HandleTable::SetObject(m_handleIndex, static_cast<T*>(this));
 	}
 
 	/*!
@@ -86,75 +91,45 @@ namespace Nz
 	template<typename T>
 	HandledObject<T>& HandledObject<T>::operator=(HandledObject&& object) noexcept
 	{
-		UnregisterAllHandles();
+		if (this == &object)
+			return *this;
 
-		m_handles = std::move(object.m_handles);
-		for (ObjectHandle<T>* handle : m_handles)
-			handle->OnObjectMoved(static_cast<T*>(this));
-
-		return *this;
-	}
+		UnregisterAllHandles();
 
-	/*!
-	* \brief Registers a handle
-	*
-	* \param handle Handle to register
-	*
-	* \remark One handle can only be registered once, errors can occur if it's more than once
-	*/
-	template<typename T>
-	void HandledObject<T>::RegisterHandle(ObjectHandle<T>* handle)
-	{
-		m_handles.push_back(handle);
-	}
+		m_handleIndex = object.m_handleIndex;
+		object.m_handleIndex = HandleTable::InvalidIndex;
 
-	/*!
-	* \brief Unregisters all handles
-	*/
-	template<typename T>
-	void HandledObject<T>::UnregisterAllHandles() noexcept
-	{
-		// Tell every handle we got destroyed, to null them
-		for (ObjectHandle<T>* handle : m_handles)
-			handle->OnObjectDestroyed();
+		if (m_handleIndex != HandleTable::InvalidIndex)
+			HandleTable::SetObject(m_handleIndex, static_cast<T*>(this));
 
-		m_handles.clear();
+		return *this;
 	}
 
 	/*!
-	* \brief Unregisters a handle
-	*
-	* \param handle Handle to unregister
-	*
-	* \remark One handle can only be unregistered once, crash can occur if it's more than once
-	* \remark Produces a NazaraAssert if handle not registered
+	* \brief Gets the slot of the object in the HandleTable, allocating it for the first handle
+	* \return Index of the slot
 	*/
 	template<typename T>
-	void HandledObject<T>::UnregisterHandle(ObjectHandle<T>* handle) noexcept
+	UInt32 HandledObject<T>::GetHandleIndex()
 	{
-		auto it = std::find(m_handles.begin(), m_handles.end(), handle);
-		NazaraAssert(it != m_handles.end(), "Handle not registered");
+		if (m_handleIndex == HandleTable::InvalidIndex)
+			m_handleIndex = HandleTable::Allocate(static_cast<T*>(this));
 
-		// Swap and pop idiom, more efficient than vector::erase
-		std::swap(*it, m_handles.back());
-		m_handles.pop_back();
+		return m_handleIndex;
 	}
 
 	/*!
-	* \brief Updates one handle with another
-	*
-	* \param oldHandle Old handle to replace
-	* \param newHandle New handle to take place
+	* \brief Unregisters all handles
 	*
-	* \remark Produces a NazaraAssert if handle not registered
+	* Releasing the slot of the object increments its generation, handles to it become invalid without being visited
 	*/
 	template<typename T>
-	void HandledObject<T>::UpdateHandle(ObjectHandle<T>* oldHandle, ObjectHandle<T>* newHandle) noexcept
+	void HandledObject<T>::UnregisterAllHandles() noexcept
 	{
-		auto it = std::find(m_handles.begin(), m_handles.end(), oldHandle);
-		NazaraAssert(it != m_handles.end(), "Handle not registered");
-
-		// Simply update the handle
-		*it = newHandle;
+		if (m_handleIndex != HandleTable::InvalidIndex)
+		{
+			HandleTable::Release(m_handleIndex);
+			m_handleIndex = HandleTable::InvalidIndex;
+		}
 	}
 }
@@ -10,9 +10,18 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/Enums.hpp>
 #include <Nazara/Core/String.hpp>
+#include <vector>
 
 namespace Nz
 {
+	struct LogicalProcessor
+	{
+		unsigned int coreId;    //< Index of the physical core, shared by SMT siblings
+		unsigned int nodeId;    //< Index of the NUMA node
+		unsigned int packageId; //< Index of the physical package (socket)
+		unsigned int smtIndex;  //< Index among the logical processors of the core, zero for the first one
+	};
+
 	class NAZARA_CORE_API HardwareInfo
 	{
 		public:
@@ -21,6 +30,10 @@ namespace Nz
 
 			static void Cpuid(UInt32 functionId, UInt32 subFunctionId, UInt32 result[4]);
 
+			static UInt64 GetCacheSize(UInt8 level);
+			static const std::vector<LogicalProcessor>& GetLogicalProcessors();
+			static unsigned int GetNumaNodeCount();
+			static unsigned int GetPhysicalCoreCount();
 			static String GetProcessorBrandString();
 			static unsigned int GetProcessorCount();
 			static ProcessorVendor GetProcessorVendor();
@@ -33,6 +46,7 @@ namespace Nz
 
 			static bool IsCpuidSupported();
 			static bool IsInitialized();
+			static bool IsSimdTargetSupported(SimdTarget target);
 
 			static void Uninitialize();
 	};
@@ -0,0 +1,34 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_HASH_CRC32C_HPP
+#define NAZARA_HASH_CRC32C_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/AbstractHash.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+
+namespace Nz
+{
+	class NAZARA_CORE_API HashCRC32C : public AbstractHash
+	{
+		public:
+			HashCRC32C();
+			virtual ~HashCRC32C();
+
+			void Append(const UInt8* data, std::size_t len) override;
+			void Begin() override;
+			ByteArray End() override;
+
+			std::size_t GetDigestLength() const override;
+			const char* GetHashName() const override;
+
+		private:
+			UInt32 m_crc;
+	};
+}
+
+#endif // NAZARA_HASH_CRC32C_HPP
@@ -0,0 +1,40 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_HASH_XXH3_HPP
+#define NAZARA_HASH_XXH3_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/AbstractHash.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+
+namespace Nz
+{
+	class NAZARA_CORE_API HashXXH3 : public AbstractHash
+	{
+		public:
+			HashXXH3();
+			virtual ~HashXXH3();
+
+			void Append(const UInt8* data, std::size_t len) override;
+			void Begin() override;
+			ByteArray End() override;
+
+			std::size_t GetDigestLength() const override;
+			const char* GetHashName() const override;
+
+		private:
+			static constexpr std::size_t BufferSize = 256;
+
+			alignas(16) UInt64 m_accumulators[8];
+			alignas(16) UInt8 m_buffer[BufferSize];
+			UInt64 m_totalLength;
+			std::size_t m_bufferedSize;
+			std::size_t m_stripeCount;
+	};
+}
+
+#endif // NAZARA_HASH_XXH3_HPP
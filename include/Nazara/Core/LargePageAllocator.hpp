@@ -0,0 +1,49 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_LARGEPAGEALLOCATOR_HPP
+#define NAZARA_LARGEPAGEALLOCATOR_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <cstddef>
+#include <type_traits>
+
+namespace Nz
+{
+	template<typename T>
+	class LargePageAllocator
+	{
+		template<typename U> friend class LargePageAllocator;
+
+		public:
+			using value_type = T;
+			using propagate_on_container_copy_assignment = std::true_type;
+			using propagate_on_container_move_assignment = std::true_type;
+			using propagate_on_container_swap = std::true_type;
+
+			inline LargePageAllocator(bool largePages = false) noexcept;
+			template<typename U> LargePageAllocator(const LargePageAllocator<U>& allocator) noexcept;
+			LargePageAllocator(const LargePageAllocator&) noexcept = default;
+			~LargePageAllocator() = default;
+
+			T* allocate(std::size_t count);
+			void deallocate(T* ptr, std::size_t count) noexcept;
+
+			inline bool IsLargePagesEnabled() const;
+
+			LargePageAllocator& operator=(const LargePageAllocator&) noexcept = default;
+
+			template<typename U> bool operator==(const LargePageAllocator<U>& allocator) const noexcept;
+			template<typename U> bool operator!=(const LargePageAllocator<U>& allocator) const noexcept;
+
+		private:
+			bool m_largePages;
+	};
+}
+
+#include <Nazara/Core/LargePageAllocator.inl>
+
+#endif // NAZARA_LARGEPAGEALLOCATOR_HPP
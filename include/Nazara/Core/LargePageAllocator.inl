@@ -0,0 +1,120 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/LargePageAllocator.hpp>
+#include <Nazara/Core/LargePageMemory.hpp>
+#include <Nazara/Core/MemoryHelper.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::LargePageAllocator
+	* \brief Core class that adapts LargePageMemory to the standard allocator requirements
+	*
+	* Meant for big long-lived arrays (like the storage of std::vector), allocations too small to be worth large pages fall back on operator new.
+	* When large pages aren't enabled, every allocation comes from operator new, which allows to choose at runtime.
+	*
+	* \remark Allocators with and without large pages can't free the memory of each other, the choice is propagated when containers are assigned or swapped
+	*/
+
+	/*!
+	* \brief Constructs a LargePageAllocator object
+	*
+	* \param largePages Should the allocations be backed by large pages
+	*/
+
+	template<typename T>
+	LargePageAllocator<T>::LargePageAllocator(bool largePages) noexcept :
+	m_largePages(largePages)
+	{
+	}
+
+	/*!
+	* \brief Constructs a LargePageAllocator object from an allocator of another type, with the same choice of pages
+	*
+	* \param allocator Allocator to copy the choice from
+	*/
+
+	template<typename T>
+	template<typename U>
+	LargePageAllocator<T>::LargePageAllocator(const LargePageAllocator<U>& allocator) noexcept :
+	m_largePages(allocator.m_largePages)
+	{
+	}
+
+	/*!
+	* \brief Allocates uninitialized memory for count objects
+	* \return Pointer to the allocated memory
+	*
+	* \param count Number of objects
+	*/
+
+	template<typename T>
+	T* LargePageAllocator<T>::allocate(std::size_t count)
+	{
+		if (m_largePages)
+			return static_cast<T*>(LargePageMemory::Allocate(count * sizeof(T)));
+		else
+			return static_cast<T*>(OperatorNew(count * sizeof(T)));
+	}
+
+	/*!
+	* \brief Releases memory previously returned by allocate
+	*
+	* \param ptr Pointer to the memory
+	* \param count Number of objects, as given to allocate
+	*/
+
+	template<typename T>
+	void LargePageAllocator<T>::deallocate(T* ptr, std::size_t count) noexcept
+	{
+		if (m_largePages)
+			LargePageMemory::Free(ptr, count * sizeof(T));
+		else
+			OperatorDelete(ptr);
+	}
+
+	/*!
+	* \brief Checks whether the allocations are backed by large pages
+	* \return true if large pages are enabled
+	*/
+
+	template<typename T>
+	bool LargePageAllocator<T>::IsLargePagesEnabled() const
+	{
+		return m_largePages;
+	}
+
+	/*!
+	* \brief Checks whether two allocators can free the memory of each other
+	* \return true if both allocators make the same choice of pages
+	*
+	* \param allocator Other allocator
+	*/
+
+	template<typename T>
+	template<typename U>
+	bool LargePageAllocator<T>::operator==(const LargePageAllocator<U>& allocator) const noexcept
+	{
+		return m_largePages == allocator.m_largePages;
+	}
+
+	/*!
+	* \brief Checks whether two allocators cannot free the memory of each other
+	* \return false if both allocators make the same choice of pages
+	*
+	* \param allocator Other allocator
+	*/
+
+	template<typename T>
+	template<typename U>
+	bool LargePageAllocator<T>::operator!=(const LargePageAllocator<U>& allocator) const noexcept
+	{
+		return !operator==(allocator);
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -0,0 +1,39 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_LARGEPAGEMEMORY_HPP
+#define NAZARA_LARGEPAGEMEMORY_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <cstddef>
+
+namespace Nz
+{
+	class NAZARA_CORE_API LargePageMemory
+	{
+		public:
+			LargePageMemory() = delete;
+			~LargePageMemory() = delete;
+
+			static void* Allocate(std::size_t size, bool* largePages = nullptr);
+
+			static void Free(void* ptr, std::size_t size);
+
+			static std::size_t GetLargePageSize();
+			static std::size_t GetMinimumSize();
+	};
+
+	struct LargePageDeleter
+	{
+		inline void operator()(void* ptr) const;
+
+		std::size_t size = 0;
+	};
+}
+
+#include <Nazara/Core/LargePageMemory.inl>
+
+#endif // NAZARA_LARGEPAGEMEMORY_HPP
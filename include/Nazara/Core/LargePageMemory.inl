@@ -0,0 +1,30 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/LargePageMemory.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::LargePageDeleter
+	* \brief Core deleter releasing memory of LargePageMemory, to be used with std::unique_ptr
+	*
+	* The size has to be the one given to LargePageMemory::Allocate, a size of zero releases memory from OperatorNew instead
+	*/
+
+	/*!
+	* \brief Releases the memory
+	*
+	* \param ptr Pointer to the memory
+	*/
+
+	inline void LargePageDeleter::operator()(void* ptr) const
+	{
+		LargePageMemory::Free(ptr, size);
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -0,0 +1,38 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_LZ4_HPP
+#define NAZARA_LZ4_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <array>
+
+namespace Nz
+{
+	class NAZARA_CORE_API Lz4
+	{
+		public:
+			static constexpr unsigned int HashLog = 12;
+			static constexpr std::size_t MaxDictionarySize = 64 * 1024; //< Matches can't reach further than 64KB
+
+			using HashTable = std::array<UInt32, 1 << HashLog>;
+
+			Lz4() = delete;
+			~Lz4() = delete;
+
+			static std::size_t Compress(const void* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize);
+			static std::size_t Compress(const UInt8* buffer, std::size_t prefixSize, std::size_t size, HashTable& hashTable, UInt8* output, std::size_t maxOutputSize);
+
+			static std::size_t Decompress(const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize, const UInt8* dictionary = nullptr, std::size_t dictionarySize = 0);
+
+			static std::size_t GetMaxCompressedSize(std::size_t inputSize);
+
+			static void IndexPrefix(const UInt8* prefix, std::size_t prefixSize, HashTable& hashTable);
+	};
+}
+
+#endif // NAZARA_LZ4_HPP
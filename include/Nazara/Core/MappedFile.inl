@@ -0,0 +1,28 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the mapped content of the file
+	* \return Pointer to the first byte of the file, nullptr if the file is empty or not open
+	*/
+	inline const UInt8* MappedFile::GetData() const
+	{
+		return m_data;
+	}
+
+	/*!
+	* \brief Checks whether the file is mapped
+	* \return true if the file is open
+	*/
+	inline bool MappedFile::IsOpen() const
+	{
+		return m_impl != nullptr;
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -12,10 +12,31 @@
 
 namespace Nz
 {
+	// Not in Enums.hpp, which includes (through Flags.inl) the headers redefining new, these include this one
+	enum MemoryTag
+	{
+		MemoryTag_Audio,
+		MemoryTag_Core,
+		MemoryTag_Graphics,
+		MemoryTag_Lua,
+		MemoryTag_Network,
+		MemoryTag_Noise,
+		MemoryTag_Other,
+		MemoryTag_Physics2D,
+		MemoryTag_Physics3D,
+		MemoryTag_Platform,
+		MemoryTag_Renderer,
+		MemoryTag_Utility,
+
+		MemoryTag_Max = MemoryTag_Utility
+	};
+
 	class NAZARA_CORE_API MemoryManager
 	{
 		public:
-			static void* Allocate(std::size_t size, bool multi = false, const char* file = nullptr, unsigned int line = 0);
+			struct TagStatistics;
+
+			static void* Allocate(std::size_t size, bool multi = false, const char* file = nullptr, unsigned int line = 0, MemoryTag tag = MemoryTag_Other);
 
 			static void EnableAllocationFilling(bool allocationFilling);
 			static void EnableAllocationLogging(bool logAllocations);
@@ -25,12 +46,28 @@ namespace Nz
 			static unsigned int GetAllocatedBlockCount();
 			static std::size_t GetAllocatedSize();
 			static unsigned int GetAllocationCount();
+			static std::size_t GetBudget(MemoryTag tag);
+			static std::size_t GetPeakSize();
+			static TagStatistics GetTagStatistics(MemoryTag tag);
 
 			static bool IsAllocationFillingEnabled();
 			static bool IsAllocationLoggingEnabled();
 
 			static void NextFree(const char* file, unsigned int line);
 
+			static void ResetPeakSizes();
+
+			static void SetBudget(MemoryTag tag, std::size_t budget);
+
+			struct TagStatistics
+			{
+				std::size_t allocatedSize;      //< Bytes currently allocated
+				std::size_t budget;             //< Bytes which should not be exceeded, zero if there is no budget
+				std::size_t peakSize;           //< Highest allocated size since the start (or the last ResetPeakSizes)
+				unsigned int allocatedBlockCount;
+				unsigned int allocationCount;   //< Allocations done since the start, including the freed ones
+			};
+
 		private:
 			MemoryManager();
 			~MemoryManager();
@@ -8,6 +8,7 @@
 #define NAZARA_MEMORYPOOL_HPP
 
 #include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/LargePageMemory.hpp>
 #include <atomic>
 #include <memory>
 
@@ -16,7 +17,7 @@ namespace Nz
 	class MemoryPool
 	{
 		public:
-			MemoryPool(unsigned int blockSize, unsigned int size = 1024, bool canGrow = true);
+			MemoryPool(unsigned int blockSize, unsigned int size = 1024, bool canGrow = true, bool largePages = false);
 			MemoryPool(const MemoryPool&) = delete;
 			MemoryPool(MemoryPool&& pool) noexcept;
 			~MemoryPool() = default;
@@ -31,6 +32,8 @@ namespace Nz
 			inline unsigned int GetFreeBlocks() const;
 			inline unsigned int GetSize() const;
 
+			inline bool IsUsingLargePages() const;
+
 			template<typename T, typename... Args> T* New(Args&&... args);
 
 			MemoryPool& operator=(const MemoryPool&) = delete;
@@ -40,11 +43,12 @@ namespace Nz
 			MemoryPool(MemoryPool* pool);
 
 			std::unique_ptr<void* []> m_freeList;
-			std::unique_ptr<UInt8[]> m_pool;
+			std::unique_ptr<UInt8[], LargePageDeleter> m_pool;
 			std::unique_ptr<MemoryPool> m_next;
 			std::atomic_uint m_freeCount;
 			MemoryPool* m_previous;
 			bool m_canGrow;
+			bool m_largePages;
 			unsigned int m_blockSize;
 			unsigned int m_size;
 	};
@@ -22,16 +22,23 @@ namespace Nz
 	* \param blockSize Size of blocks that will be allocated
 	* \param size Size of the pool
 	* \param canGrow Determine if the pool can allocate more memory
+	* \param largePages Should the blocks be allocated in large pages (see LargePageMemory), for big long-lived pools
 	*/
 
-	inline MemoryPool::MemoryPool(unsigned int blockSize, unsigned int size, bool canGrow) :
+	inline MemoryPool::MemoryPool(unsigned int blockSize, unsigned int size, bool canGrow, bool largePages) :
 	m_freeCount(size),
 	m_previous(nullptr),
 	m_canGrow(canGrow),
+	m_largePages(largePages),
 	m_blockSize(blockSize),
 	m_size(size)
 	{
-		m_pool.reset(new UInt8[blockSize * size]);
+		std::size_t poolSize = std::size_t(blockSize) * size;
+		if (largePages)
+			m_pool = std::unique_ptr<UInt8[], LargePageDeleter>(static_cast<UInt8*>(LargePageMemory::Allocate(poolSize)), LargePageDeleter{poolSize});
+		else
+			m_pool = std::unique_ptr<UInt8[], LargePageDeleter>(static_cast<UInt8*>(OperatorNew(poolSize)));
+
 		m_freeList.reset(new void* [size]);
 
 		// Remplissage de la free list
@@ -57,7 +64,7 @@ namespace Nz
 	*/
 
 	inline MemoryPool::MemoryPool(MemoryPool* pool) :
-	MemoryPool(pool->m_blockSize, pool->m_size, pool->m_canGrow)
+	MemoryPool(pool->m_blockSize, pool->m_size, pool->m_canGrow, pool->m_largePages)
 	{
 		m_previous = pool;
 	}
@@ -178,6 +185,16 @@ namespace Nz
 		return m_size;
 	}
 
+	/*!
+	* \brief Checks whether the blocks of the pool were requested in large pages
+	* \return true if the pool was created with large pages
+	*/
+
+	inline bool MemoryPool::IsUsingLargePages() const
+	{
+		return m_largePages;
+	}
+
 	/*!
 	* \brief Creates a new value of type T with arguments
 	* \return Pointer to the allocated object
@@ -209,6 +226,7 @@ namespace Nz
 		m_canGrow = pool.m_canGrow;
 		m_freeCount = pool.m_freeCount.load(std::memory_order_relaxed);
 		m_freeList = std::move(pool.m_freeList);
+		m_largePages = pool.m_largePages;
 		m_pool = std::move(pool.m_pool);
 		m_previous = pool.m_previous;
 		m_next = std::move(pool.m_next);
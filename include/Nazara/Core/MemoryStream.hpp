@@ -13,6 +13,7 @@
 namespace Nz
 {
 	class ByteArray;
+	class ByteArrayPool;
 
 	class NAZARA_CORE_API MemoryStream : public Stream
 	{
@@ -29,21 +30,33 @@ namespace Nz
 
 			inline ByteArray& GetBuffer();
 			inline const ByteArray& GetBuffer() const;
+			inline ByteArrayPool* GetBufferPool() const;
 			UInt64 GetCursorPos() const override;
+			inline GrowthPolicy GetGrowthPolicy() const;
+			inline std::size_t GetGrowthIncrement() const;
 			UInt64 GetSize() const override;
 
+			void Reserve(UInt64 size);
+
 			void SetBuffer(ByteArray* byteArray, OpenModeFlags openMode = OpenMode_ReadWrite);
+			inline void SetBufferPool(ByteArrayPool* pool);
 			bool SetCursorPos(UInt64 offset) override;
+			inline void SetGrowthPolicy(GrowthPolicy policy, std::size_t increment = 64 * 1024);
 
 			MemoryStream& operator=(const MemoryStream&) = default;
 			MemoryStream& operator=(MemoryStream&&) = default;
 
 		private:
 			void FlushStream() override;
+			void Grow(std::size_t minCapacity);
 			std::size_t ReadBlock(void* buffer, std::size_t size) override;
+			void Reallocate(std::size_t capacity);
 			std::size_t WriteBlock(const void* buffer, std::size_t size) override;
 
 			ByteArray* m_buffer;
+			ByteArrayPool* m_bufferPool;
+			GrowthPolicy m_growthPolicy;
+			std::size_t m_growthIncrement;
 			UInt64 m_pos;
 	};
 }
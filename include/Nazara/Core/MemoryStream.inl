@@ -14,6 +14,9 @@ namespace Nz
 	*/
 	inline MemoryStream::MemoryStream() :
 	Stream(StreamOption_None, OpenMode_ReadWrite),
+	m_bufferPool(nullptr),
+	m_growthPolicy(GrowthPolicy_Geometric),
+	m_growthIncrement(64 * 1024),
 	m_pos(0)
 	{
 	}
@@ -55,6 +58,62 @@ namespace Nz
 
 		return *m_buffer;
 	}
+
+	/*!
+	* \brief Gets the pool the storage of the buffer comes from when growing
+	* \return Pool, or nullptr if the buffer reallocates by itself
+	*/
+	inline ByteArrayPool* MemoryStream::GetBufferPool() const
+	{
+		return m_bufferPool;
+	}
+
+	/*!
+	* \brief Gets the way the buffer grows when writing past its capacity
+	* \return Growth policy
+	*/
+	inline GrowthPolicy MemoryStream::GetGrowthPolicy() const
+	{
+		return m_growthPolicy;
+	}
+
+	/*!
+	* \brief Gets the increment of the linear growth policy
+	* \return Increment in bytes
+	*/
+	inline std::size_t MemoryStream::GetGrowthIncrement() const
+	{
+		return m_growthIncrement;
+	}
+
+	/*!
+	* \brief Sets the pool the storage of the buffer comes from when growing
+	*
+	* \param pool Pool to acquire bigger buffers from and release outgrown ones to, nullptr to let the buffer reallocate by itself
+	*
+	* \remark The pool must outlive the stream
+	*/
+	inline void MemoryStream::SetBufferPool(ByteArrayPool* pool)
+	{
+		m_bufferPool = pool;
+	}
+
+	/*!
+	* \brief Sets the way the buffer grows when writing past its capacity
+	*
+	* \param policy Growth policy
+	* \param increment Capacity added at once with GrowthPolicy_Linear, rounded to it
+	*
+	* \remark Produces a NazaraAssert if increment is zero with GrowthPolicy_Linear
+	*/
+	inline void MemoryStream::SetGrowthPolicy(GrowthPolicy policy, std::size_t increment)
+	{
+		NazaraAssert(policy <= GrowthPolicy_Max, "Growth policy out of enum");
+		NazaraAssert(policy != GrowthPolicy_Linear || increment > 0, "Invalid increment");
+
+		m_growthPolicy = policy;
+		m_growthIncrement = increment;
+	}
 }
 
 #include <Nazara/Core/DebugOff.hpp>
@@ -18,18 +18,19 @@ namespace Nz
 			MemoryView(void* ptr, UInt64 size);
 			MemoryView(const void* ptr, UInt64 size);
 			MemoryView(const MemoryView&) = delete;
-			MemoryView(MemoryView&&) = delete; ///TODO
+			MemoryView(MemoryView&&) noexcept = default;
 			~MemoryView() = default;
 
 			bool EndOfStream() const override;
 
 			UInt64 GetCursorPos() const override;
+			const void* GetMappedPointer() const override;
 			UInt64 GetSize() const override;
 
 			bool SetCursorPos(UInt64 offset) override;
 
 			MemoryView& operator=(const MemoryView&) = delete;
-			MemoryView& operator=(MemoryView&&) = delete; ///TODO
+			MemoryView& operator=(MemoryView&&) noexcept = default;
 
 		private:
 			void FlushStream() override;
@@ -0,0 +1,55 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_METRICS_HPP
+#define NAZARA_METRICS_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Enums.hpp>
+#include <Nazara/Core/String.hpp>
+#include <functional>
+#include <vector>
+
+namespace Nz
+{
+	class AbstractMetricsExporter;
+
+	class NAZARA_CORE_API Metrics
+	{
+		public:
+			struct Sample;
+			using Sampler = std::function<double()>;
+
+			Metrics() = delete;
+			~Metrics() = delete;
+
+			static void Add(UInt32 metricId, Int64 value = 1);
+
+			static std::vector<Sample> Collect();
+
+			static String Export(AbstractMetricsExporter& exporter);
+
+			static UInt32 Register(MetricType type, const String& name, const String& description, const String& labels = String());
+			static UInt32 Register(MetricType type, const String& name, const String& description, Sampler sampler, const String& labels = String());
+
+			static void Set(UInt32 metricId, double value);
+
+			static void Unregister(UInt32 metricId);
+
+			static constexpr UInt32 InvalidId = 0xFFFFFFFF;
+
+			struct Sample
+			{
+				MetricType type;
+				String description;
+				String labels;
+				String name;
+				double value;
+			};
+	};
+}
+
+#endif // NAZARA_METRICS_HPP
@@ -14,6 +14,12 @@ namespace Nz
 {
 	class MutexImpl;
 
+	struct LockContentionStats
+	{
+		UInt64 contentionCount; //< Locks which couldn't be taken right away
+		UInt64 waitTime;        //< Time spent waiting for these locks (in microseconds)
+	};
+
 	class NAZARA_CORE_API Mutex
 	{
 		friend class ConditionVariable;
@@ -31,6 +37,9 @@ namespace Nz
 			Mutex& operator=(const Mutex&) = delete;
 			Mutex& operator=(Mutex&&) noexcept = default;
 
+			static LockContentionStats GetContentionStats();
+			static void ResetContentionStats();
+
 		private:
 			MovablePtr<MutexImpl> m_impl;
 	};
@@ -0,0 +1,57 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NAME_HPP
+#define NAZARA_NAME_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/String.hpp>
+#include <functional>
+
+namespace Nz
+{
+	class NAZARA_CORE_API Name
+	{
+		public:
+			constexpr Name();
+			constexpr Name(const char* string);
+			inline Name(const String& string);
+			Name(const Name&) = default;
+			~Name() = default;
+
+			constexpr UInt64 GetHash() const;
+			constexpr const char* GetString() const;
+
+			constexpr bool IsEmpty() const;
+
+			Name& operator=(const Name&) = default;
+
+			constexpr bool operator==(const Name& name) const;
+			constexpr bool operator!=(const Name& name) const;
+
+			static constexpr UInt64 Hash(const char* string, UInt64 hash = HashOffset);
+			static Name Intern(const Name& name);
+
+		private:
+			constexpr Name(const char* string, UInt64 hash);
+
+			static constexpr UInt64 HashOffset = 14695981039346656037ULL;
+			static constexpr UInt64 HashPrime = 1099511628211ULL;
+
+			const char* m_string;
+			UInt64 m_hash;
+	};
+}
+
+namespace std
+{
+	template<>
+	struct hash<Nz::Name>;
+}
+
+#include <Nazara/Core/Name.inl>
+
+#endif // NAZARA_NAME_HPP
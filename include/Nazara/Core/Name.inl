@@ -0,0 +1,132 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::Name
+	* \brief Core class that identifies something by the hash of its name, making lookups integer compares
+	*
+	* The hash of a literal is computed at compile time, when the name is used in a constant expression.
+	* A name doesn't own its characters, they have to outlive it: names kept around must come from literals or from Intern
+	*/
+
+	/*!
+	* \brief Constructs an empty Name object
+	*/
+	constexpr Name::Name() :
+	Name("", HashOffset)
+	{
+	}
+
+	/*!
+	* \brief Constructs a Name object from a "C string"
+	*
+	* \param string Null-terminated string, or nullptr for an empty name
+	*/
+	constexpr Name::Name(const char* string) :
+	Name((string) ? string : "", (string) ? Hash(string) : HashOffset)
+	{
+	}
+
+	/*!
+	* \brief Constructs a Name object from a string
+	*
+	* \param string String whose characters must not be modified while the name is used
+	*/
+	inline Name::Name(const String& string) :
+	Name(string.GetConstBuffer())
+	{
+	}
+
+	constexpr Name::Name(const char* string, UInt64 hash) :
+	m_string(string),
+	m_hash(hash)
+	{
+	}
+
+	/*!
+	* \brief Gets the hash of the name
+	* \return 64 bits FNV-1a hash of the characters
+	*/
+	constexpr UInt64 Name::GetHash() const
+	{
+		return m_hash;
+	}
+
+	/*!
+	* \brief Gets the characters of the name
+	* \return Null-terminated string
+	*/
+	constexpr const char* Name::GetString() const
+	{
+		return m_string;
+	}
+
+	/*!
+	* \brief Checks whether the name is empty
+	* \return true if it is the case
+	*/
+	constexpr bool Name::IsEmpty() const
+	{
+		return m_hash == HashOffset;
+	}
+
+	/*!
+	* \brief Checks whether the name is equal to another one
+	* \return true if they have the same hash
+	*
+	* \param name Name to compare to
+	*/
+	constexpr bool Name::operator==(const Name& name) const
+	{
+		return m_hash == name.m_hash;
+	}
+
+	/*!
+	* \brief Checks whether the name is different from another one
+	* \return true if they don't have the same hash
+	*
+	* \param name Name to compare to
+	*/
+	constexpr bool Name::operator!=(const Name& name) const
+	{
+		return m_hash != name.m_hash;
+	}
+
+	/*!
+	* \brief Hashes a "C string" the way names are
+	* \return 64 bits FNV-1a hash of the characters
+	*
+	* \param string Null-terminated string to hash
+	* \param hash Hash of the characters preceding the string
+	*/
+	constexpr UInt64 Name::Hash(const char* string, UInt64 hash)
+	{
+		return (*string) ? Hash(string + 1, (hash ^ static_cast<UInt8>(*string)) * HashPrime) : hash;
+	}
+}
+
+namespace std
+{
+	template<>
+	struct hash<Nz::Name>
+	{
+		/*!
+		* \brief Specialisation of std to hash
+		* \return Result of the hash
+		*
+		* \param name Name to hash
+		*/
+		size_t operator()(const Nz::Name& name) const
+		{
+			return static_cast<size_t>(name.GetHash());
+		}
+	};
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -0,0 +1,43 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NONATOMICREFCOUNTED_HPP
+#define NAZARA_NONATOMICREFCOUNTED_HPP
+
+#include <Nazara/Prerequisites.hpp>
+
+namespace Nz
+{
+	class NAZARA_CORE_API NonAtomicRefCounted
+	{
+		public:
+			inline NonAtomicRefCounted(bool persistent = true);
+			NonAtomicRefCounted(const NonAtomicRefCounted&) = delete;
+			NonAtomicRefCounted(NonAtomicRefCounted&&) = default;
+			virtual ~NonAtomicRefCounted();
+
+			inline void AddReference() const;
+
+			inline unsigned int GetReferenceCount() const;
+
+			inline bool IsPersistent() const;
+
+			inline bool RemoveReference() const;
+
+			bool SetPersistent(bool persistent = true, bool checkReferenceCount = false);
+
+			NonAtomicRefCounted& operator=(const NonAtomicRefCounted&) = delete;
+			NonAtomicRefCounted& operator=(NonAtomicRefCounted&&) = default;
+
+		private:
+			bool m_persistent;
+			mutable unsigned int m_referenceCount;
+	};
+}
+
+#include <Nazara/Core/NonAtomicRefCounted.inl>
+
+#endif // NAZARA_NONATOMICREFCOUNTED_HPP
@@ -0,0 +1,83 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::NonAtomicRefCounted
+	* \brief Core class that represents a reference with a counter, for objects only referenced from one thread at a time
+	*
+	* It has the interface of RefCounted (and works the same with ObjectRef), but references are counted without atomic operations and inlined.
+	*
+	* \see RefCounted
+	*/
+
+	/*!
+	* \brief Constructs a NonAtomicRefCounted object with a persistance aspect
+	*
+	* \param persistent if false, object is destroyed when no more referenced
+	*/
+
+	inline NonAtomicRefCounted::NonAtomicRefCounted(bool persistent) :
+	m_persistent(persistent),
+	m_referenceCount(0)
+	{
+	}
+
+	/*!
+	* \brief Adds a reference to the object
+	*/
+
+	inline void NonAtomicRefCounted::AddReference() const
+	{
+		m_referenceCount++;
+	}
+
+	/*!
+	* \brief Gets the number of references to the object
+	* \return Number of references
+	*/
+
+	inline unsigned int NonAtomicRefCounted::GetReferenceCount() const
+	{
+		return m_referenceCount;
+	}
+
+	/*!
+	* \brief Checks whether the object is persistent
+	* \return true if object is not destroyed when no more referenced
+	*/
+
+	inline bool NonAtomicRefCounted::IsPersistent() const
+	{
+		return m_persistent;
+	}
+
+	/*!
+	* \brief Removes a reference to the object
+	* \return true if object is deleted because no more referenced
+	*
+	* \remark Produces a NazaraAssert if counter is already 0
+	*/
+
+	inline bool NonAtomicRefCounted::RemoveReference() const
+	{
+		NazaraAssert(m_referenceCount > 0, "Impossible to remove reference (Ref. counter is already 0)");
+
+		if (--m_referenceCount == 0 && !m_persistent)
+		{
+			delete this; // Suicide
+
+			return true;
+		}
+		else
+			return false;
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -8,6 +8,7 @@
 #define NAZARA_OBJECTHANDLE_HPP
 
 #include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/HandleTable.hpp>
 #include <ostream>
 
 namespace Nz
@@ -17,14 +18,12 @@ namespace Nz
 	template<typename T>
 	class ObjectHandle
 	{
-		friend HandledObject<T>;
-
 		public:
 			ObjectHandle();
 			explicit ObjectHandle(T* object);
-			ObjectHandle(const ObjectHandle& handle);
+			ObjectHandle(const ObjectHandle& handle) = default;
 			ObjectHandle(ObjectHandle&& handle) noexcept;
-			~ObjectHandle();
+			~ObjectHandle() = default;
 
 			T* GetObject() const;
 
@@ -43,16 +42,14 @@ namespace Nz
 			T* operator->() const;
 
 			ObjectHandle& operator=(T* object);
-			ObjectHandle& operator=(const ObjectHandle& handle);
+			ObjectHandle& operator=(const ObjectHandle& handle) = default;
 			ObjectHandle& operator=(ObjectHandle&& handle) noexcept;
 
 			static const ObjectHandle InvalidHandle;
 
-		protected:
-			void OnObjectDestroyed() noexcept;
-			void OnObjectMoved(T* newObject) noexcept;
-
-			T* m_object;
+		private:
+			UInt32 m_index;
+			UInt32 m_generation;
 	};
 
 	template<typename T> std::ostream& operator<<(std::ostream& out, const ObjectHandle<T>& handle);
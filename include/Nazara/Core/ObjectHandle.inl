@@ -13,6 +13,11 @@ namespace Nz
 	* \ingroup core
 	* \class Nz::ObjectHandle
 	* \brief Core class that represents a object handle
+	*
+	* A handle is a plain value holding the index of the object in the HandleTable and the generation of the slot when it was created.
+	* Copying a handle doesn't touch the object, and checking whether it is still valid is a single comparison.
+	*
+	* \see HandledObject
 	*/
 
 	/*!
@@ -20,7 +25,8 @@ namespace Nz
 	*/
 	template<typename T>
 	ObjectHandle<T>::ObjectHandle() :
-	m_object(nullptr)
+	m_index(HandleTable::InvalidIndex),
+	m_generation(0)
 	{
 	}
 
@@ -36,22 +42,10 @@ namespace Nz
 		Reset(object);
 	}
 
-	/*!
-	* \brief Constructs a ObjectHandle object by assignation
-	*
-	* \param handle ObjectHandle to assign into this
-	*/
-	template<typename T>
-	ObjectHandle<T>::ObjectHandle(const ObjectHandle& handle) :
-	ObjectHandle()
-	{
-		Reset(handle);
-	}
-
 	/*!
 	* \brief Constructs a ObjectHandle object by move semantic
 	*
-	* \param handle ObjectHandle to move into this
+	* \param handle ObjectHandle to move into this, which becomes invalid
 	*/
 	template<typename T>
 	ObjectHandle<T>::ObjectHandle(ObjectHandle&& handle) noexcept :
@@ -60,35 +54,25 @@ namespace Nz
 		Reset(std::move(handle));
 	}
 
-	/*!
-	* \brief Destructs the object and calls reset with nullptr
-	*
-	* \see Reset
-	*/
-	template<typename T>
-	ObjectHandle<T>::~ObjectHandle()
-	{
-		Reset(nullptr);
-	}
-
 	/*!
 	* \brief Gets the underlying object
-	* \return Underlying object
+	* \return Underlying object, nullptr if it was destroyed
 	*/
 	template<typename T>
 	T* ObjectHandle<T>::GetObject() const
 	{
-		return m_object;
+		const HandleTable::Slot& slot = HandleTable::GetSlot(m_index);
+		return (slot.generation == m_generation) ? static_cast<T*>(slot.object) : nullptr;
 	}
 
 	/*!
 	* \brief Checks whether the object is valid
-	* \return true if object is not nullptr
+	* \return true if the object is still alive
 	*/
 	template<typename T>
 	bool ObjectHandle<T>::IsValid() const
 	{
-		return m_object != nullptr;
+		return HandleTable::GetSlot(m_index).generation == m_generation;
 	}
 
 	/*!
@@ -99,14 +83,16 @@ namespace Nz
 	template<typename T>
 	void ObjectHandle<T>::Reset(T* object)
 	{
-		// If we already have an entity, we must alert it that we are not pointing to it anymore
-		if (m_object)
-			m_object->UnregisterHandle(this);
-
-		m_object = object;
-		if (m_object)
-			// We alert the new entity that we are pointing to it
-			m_object->RegisterHandle(this);
+		if (object)
+		{
+			m_index = static_cast<HandledObject<T>*>(object)->GetHandleIndex();
+			m_generation = HandleTable::GetSlot(m_index).generation;
+		}
+		else
+		{
+			m_index = HandleTable::InvalidIndex;
+			m_generation = 0;
+		}
 	}
 
 	/*!
@@ -117,13 +103,14 @@ namespace Nz
 	template<typename T>
 	void ObjectHandle<T>::Reset(const ObjectHandle& handle)
 	{
-		Reset(handle.GetObject());
+		m_index = handle.m_index;
+		m_generation = handle.m_generation;
 	}
 
 	/*!
 	* \brief Resets the content of this with another object by move semantic
 	*
-	* \param handle New object to handle to move into this
+	* \param handle New object to handle to move into this, which becomes invalid
 	*/
 	template<typename T>
 	void ObjectHandle<T>::Reset(ObjectHandle&& handle) noexcept
@@ -131,15 +118,11 @@ namespace Nz
 		if (this == &handle)
 			return;
 
-		if (m_object)
-			m_object->UnregisterHandle(this);
+		m_index = handle.m_index;
+		m_generation = handle.m_generation;
 
-		if (T* object = handle.GetObject())
-		{
-			m_object = handle.m_object;
-			handle.m_object = nullptr;
-			object->UpdateHandle(&handle, this);
-		}
+		handle.m_index = HandleTable::InvalidIndex;
+		handle.m_generation = 0;
 	}
 
 	/*!
@@ -151,23 +134,9 @@ namespace Nz
 	template<typename T>
 	ObjectHandle<T>& ObjectHandle<T>::Swap(ObjectHandle& handle)
 	{
-		// As we swap the two handles, we must alert the entities
-		// The default version with swap (move) would be working,
-		// but will register handles one more time (due to temporary copy).
-		if (m_object)
-		{
-			m_object->UnregisterHandle(this);
-			m_object->RegisterHandle(&handle);
-		}
+		std::swap(m_index, handle.m_index);
+		std::swap(m_generation, handle.m_generation);
 
-		if (handle.m_object)
-		{
-			handle.m_object->UnregisterHandle(&handle);
-			handle.m_object->RegisterHandle(this);
-		}
-
-		// We do the swap
-		std::swap(m_object, handle.m_object);
 		return *this;
 	}
 
@@ -180,8 +149,8 @@ namespace Nz
 	{
 		Nz::StringStream ss;
 		ss << "ObjectHandle(";
-		if (IsValid())
-			ss << m_object->ToString();
+		if (T* object = GetObject())
+			ss << object->ToString();
 		else
 			ss << "Null";
 
@@ -209,7 +178,7 @@ namespace Nz
 	template<typename T>
 	ObjectHandle<T>::operator T*() const
 	{
-		return m_object;
+		return GetObject();
 	}
 
 	/*!
@@ -219,14 +188,14 @@ namespace Nz
 	template<typename T>
 	T* ObjectHandle<T>::operator->() const
 	{
-		return m_object;
+		return GetObject();
 	}
 
 	/*!
 	* \brief Assigns the entity into this
 	* \return A reference to this
 	*
-	* \param entity Pointer to handle like an object (can be nullptr)
+	* \param entity Pointer to handle like an object
 	*/
 	template<typename T>
 	ObjectHandle<T>& ObjectHandle<T>::operator=(T* entity)
@@ -236,54 +205,19 @@ namespace Nz
 		return *this;
 	}
 
-	/*!
-	* \brief Sets the handle of the ObjectHandle with the handle from another
-	* \return A reference to this
-	*
-	* \param handle The other ObjectHandle
-	*/
-	template<typename T>
-	ObjectHandle<T>& ObjectHandle<T>::operator=(const ObjectHandle& handle)
-	{
-		Reset(handle);
-
-		return *this;
-	}
-
 	/*!
 	* \brief Moves the ObjectHandle into this
 	* \return A reference to this
 	*
-	* \param handle ObjectHandle to move in this
+	* \param handle ObjectHandle to move in this, which becomes invalid
 	*/
 	template<typename T>
 	ObjectHandle<T>& ObjectHandle<T>::operator=(ObjectHandle&& handle) noexcept
 	{
 		Reset(std::move(handle));
-
 		return *this;
 	}
 
-	/*!
-	* \brief Action to do on object destruction
-	*/
-	template<typename T>
-	void ObjectHandle<T>::OnObjectDestroyed() noexcept
-	{
-		// Shortcut
-		m_object = nullptr;
-	}
-
-	/*!
-	* \brief Action to do on object move
-	*/
-	template<typename T>
-	void ObjectHandle<T>::OnObjectMoved(T* newObject) noexcept
-	{
-		// The object has been moved, update our pointer
-		m_object = newObject;
-	}
-
 	/*!
 	* \brief Output operator
 	* \return The stream
@@ -386,7 +320,7 @@ namespace Nz
 	template<typename T>
 	bool operator<(const ObjectHandle<T>& lhs, const ObjectHandle<T>& rhs)
 	{
-		return lhs.m_object < rhs.m_object;
+		return lhs.GetObject() < rhs.GetObject();
 	}
 
 	/*!
@@ -399,7 +333,7 @@ namespace Nz
 	template<typename T>
 	bool operator<(const T& lhs, const ObjectHandle<T>& rhs)
 	{
-		return &lhs < rhs.m_object;
+		return &lhs < rhs.GetObject();
 	}
 
 	/*!
@@ -412,7 +346,7 @@ namespace Nz
 	template<typename T>
 	bool operator<(const ObjectHandle<T>& lhs, const T& rhs)
 	{
-		return lhs.m_object < &rhs;
+		return lhs.GetObject() < &rhs;
 	}
 
 	/*!
@@ -24,6 +24,7 @@ namespace Nz
 			~ObjectLibrary() = delete;
 
 			static ObjectRef<Type> Get(const String& name);
+			static std::size_t GetMemoryUsage();
 			static bool Has(const String& name);
 
 			static void Register(const String& name, ObjectRef<Type> object);
@@ -31,6 +32,8 @@ namespace Nz
 			static void Unregister(const String& name);
 
 		private:
+			template<typename T> static auto GetObjectMemoryUsage(const T& object, int) -> decltype(object.GetMemoryUsage(), std::size_t());
+			static std::size_t GetObjectMemoryUsage(const Type& object, long);
 			static bool Initialize();
 			static void Uninitialize();
 
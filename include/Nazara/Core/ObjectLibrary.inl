@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Core/Error.hpp>
+#include <unordered_set>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
@@ -31,6 +32,26 @@ namespace Nz
 		return ref;
 	}
 
+	/*!
+	* \brief Gets the memory used by the objects of the library
+	* \return Memory usage in bytes, each object being counted once even when registered under several names
+	*
+	* \remark Only types having a GetMemoryUsage method are measured, 0 is returned for the others
+	*/
+	template<typename Type>
+	std::size_t ObjectLibrary<Type>::GetMemoryUsage()
+	{
+		std::size_t memoryUsage = 0;
+		std::unordered_set<const Type*> countedObjects;
+		for (const auto& pair : Type::s_library)
+		{
+			if (countedObjects.insert(pair.second.Get()).second)
+				memoryUsage += GetObjectMemoryUsage(*pair.second, 0);
+		}
+
+		return memoryUsage;
+	}
+
 	/*!
 	* \brief Checks whether the library has the object with that name
 	* \return true if it the case
@@ -80,6 +101,33 @@ namespace Nz
 		Type::s_library.erase(name);
 	}
 
+	/*!
+	* \brief Gets the memory used by an object
+	* \return Memory usage in bytes
+	*
+	* \param object Object to measure
+	*/
+	template<typename Type>
+	template<typename T>
+	auto ObjectLibrary<Type>::GetObjectMemoryUsage(const T& object, int) -> decltype(object.GetMemoryUsage(), std::size_t())
+	{
+		return object.GetMemoryUsage();
+	}
+
+	/*!
+	* \brief Gets the memory used by an object which cannot measure it
+	* \return 0
+	*
+	* \param object Object to measure
+	*/
+	template<typename Type>
+	std::size_t ObjectLibrary<Type>::GetObjectMemoryUsage(const Type& object, long)
+	{
+		NazaraUnused(object);
+
+		return 0;
+	}
+
 	template<typename Type>
 	bool ObjectLibrary<Type>::Initialize()
 	{
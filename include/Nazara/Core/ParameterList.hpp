@@ -9,9 +9,12 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/Color.hpp>
+#include <Nazara/Core/Name.hpp>
 #include <Nazara/Core/String.hpp>
 #include <atomic>
-#include <unordered_map>
+#include <functional>
+#include <memory>
+#include <type_traits>
 
 namespace Nz
 {
@@ -20,9 +23,9 @@ namespace Nz
 		public:
 			using Destructor = void (*)(void* value);
 
-			ParameterList() = default;
+			ParameterList();
 			ParameterList(const ParameterList& list);
-			ParameterList(ParameterList&&) = default;
+			ParameterList(ParameterList&& list);
 			~ParameterList();
 
 			void Clear();
@@ -30,33 +33,37 @@ namespace Nz
 			inline void ForEach(const std::function<bool(const ParameterList& list, const String& name)>& callback);
 			inline void ForEach(const std::function<void(const ParameterList& list, const String& name)>& callback) const;
 
-			bool GetBooleanParameter(const String& name, bool* value) const;
-			bool GetColorParameter(const String& name, Color* value) const;
-			bool GetDoubleParameter(const String& name, double* value) const;
-			bool GetIntegerParameter(const String& name, long long* value) const;
-			bool GetParameterType(const String& name, ParameterType* type) const;
-			bool GetPointerParameter(const String& name, void** value) const;
-			bool GetStringParameter(const String& name, String* value) const;
-			bool GetUserdataParameter(const String& name, void** value) const;
-
-			bool HasParameter(const String& name) const;
-
-			void RemoveParameter(const String& name);
-
-			void SetParameter(const String& name);
-			void SetParameter(const String& name, const Color& value);
-			void SetParameter(const String& name, const String& value);
-			void SetParameter(const String& name, const char* value);
-			void SetParameter(const String& name, bool value);
-			void SetParameter(const String& name, double value);
-			void SetParameter(const String& name, long long value);
-			void SetParameter(const String& name, void* value);
-			void SetParameter(const String& name, void* value, Destructor destructor);
+			bool GetBooleanParameter(const Name& name, bool* value) const;
+			bool GetColorParameter(const Name& name, Color* value) const;
+			bool GetDoubleParameter(const Name& name, double* value) const;
+			bool GetIntegerParameter(const Name& name, long long* value) const;
+			bool GetParameterType(const Name& name, ParameterType* type) const;
+			bool GetPointerParameter(const Name& name, void** value) const;
+			bool GetStringParameter(const Name& name, String* value) const;
+			bool GetUserdataParameter(const Name& name, void** value) const;
+
+			std::size_t GetParameterCount() const;
+
+			bool HasParameter(const Name& name) const;
+
+			void RemoveParameter(const Name& name);
+
+			void Reserve(std::size_t parameterCount);
+
+			void SetParameter(const Name& name);
+			void SetParameter(const Name& name, const Color& value);
+			void SetParameter(const Name& name, const String& value);
+			void SetParameter(const Name& name, const char* value);
+			void SetParameter(const Name& name, bool value);
+			void SetParameter(const Name& name, double value);
+			void SetParameter(const Name& name, long long value);
+			void SetParameter(const Name& name, void* value);
+			void SetParameter(const Name& name, void* value, Destructor destructor);
 
 			String ToString() const;
 
 			ParameterList& operator=(const ParameterList& list);
-			ParameterList& operator=(ParameterList&&) = default;
+			ParameterList& operator=(ParameterList&& list);
 
 		private:
 			struct Parameter
@@ -92,14 +99,29 @@ namespace Nz
 					UserdataValue* userdataVal;
 				};
 
+				Name name; //< Interned, lookups only use its hash
 				Value value;
 			};
 
-			Parameter& CreateValue(const String& name);
-			void DestroyValue(Parameter& parameter);
+			using ParameterStorage = std::aligned_storage<sizeof(Parameter), alignof(Parameter)>::type;
 
-			using ParameterMap = std::unordered_map<String, Parameter>;
-			ParameterMap m_parameters;
+			static constexpr std::size_t InlineCapacity = 8;
+
+			Parameter& CreateValue(const Name& name);
+			void DestroyValue(Parameter& parameter);
+			void EraseParameter(std::size_t index);
+			Parameter* FindParameter(const Name& name) const;
+			std::size_t LowerBound(UInt64 hash) const;
+			void MoveParameters(ParameterList& list);
+
+			static void CopyValue(Parameter& dst, const Parameter& src);
+			static void MoveValue(Parameter& dst, Parameter& src);
+
+			std::unique_ptr<ParameterStorage[]> m_heapParameters;
+			Parameter* m_parameters; //< Sorted by hash, either in the inline storage or on the heap
+			ParameterStorage m_inlineParameters[InlineCapacity];
+			std::size_t m_capacity;
+			std::size_t m_parameterCount;
 	};
 }
 
@@ -15,12 +15,12 @@ namespace Nz
 	*/
 	inline void ParameterList::ForEach(const std::function<bool(const ParameterList& list, const String& name)>& callback)
 	{
-		for (auto it = m_parameters.begin(); it != m_parameters.end();)
+		for (std::size_t i = 0; i < m_parameterCount;)
 		{
-			if (callback(*this, it->first))
-				it = m_parameters.erase(it);
+			if (callback(*this, m_parameters[i].name.GetString()))
+				EraseParameter(i);
 			else
-				++it;
+				++i;
 		}
 	}
 
@@ -33,8 +33,8 @@ namespace Nz
 	*/
 	inline void ParameterList::ForEach(const std::function<void(const ParameterList& list, const String& name)>& callback) const
 	{
-		for (auto& pair : m_parameters)
-			callback(*this, pair.first);
+		for (std::size_t i = 0; i < m_parameterCount; ++i)
+			callback(*this, m_parameters[i].name.GetString());
 	}
 }
 
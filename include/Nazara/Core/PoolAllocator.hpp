@@ -0,0 +1,46 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_POOLALLOCATOR_HPP
+#define NAZARA_POOLALLOCATOR_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/ConcurrentMemoryPool.hpp>
+#include <cstddef>
+
+namespace Nz
+{
+	template<typename T>
+	class PoolAllocator
+	{
+		template<typename U> friend class PoolAllocator;
+
+		public:
+			using value_type = T;
+
+			inline PoolAllocator(ConcurrentMemoryPool& pool) noexcept;
+			template<typename U> PoolAllocator(const PoolAllocator<U>& allocator) noexcept;
+			PoolAllocator(const PoolAllocator&) noexcept = default;
+			~PoolAllocator() = default;
+
+			T* allocate(std::size_t count);
+			void deallocate(T* ptr, std::size_t count) noexcept;
+
+			inline ConcurrentMemoryPool& GetPool() const;
+
+			PoolAllocator& operator=(const PoolAllocator&) noexcept = default;
+
+			template<typename U> bool operator==(const PoolAllocator<U>& allocator) const noexcept;
+			template<typename U> bool operator!=(const PoolAllocator<U>& allocator) const noexcept;
+
+		private:
+			ConcurrentMemoryPool* m_pool;
+	};
+}
+
+#include <Nazara/Core/PoolAllocator.inl>
+
+#endif // NAZARA_POOLALLOCATOR_HPP
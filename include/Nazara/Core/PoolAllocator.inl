@@ -0,0 +1,114 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/PoolAllocator.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::PoolAllocator
+	* \brief Core class that adapts a ConcurrentMemoryPool to the standard allocator requirements
+	*
+	* Single objects fitting in a block of the pool (like the nodes of std::list, std::map or std::unordered_map) come from the pool,
+	* bigger allocations (arrays) fall back on operator new.
+	*
+	* \remark The pool must outlive every container using it, and is shared by every copy (or rebound copy) of the allocator
+	*/
+
+	/*!
+	* \brief Constructs a PoolAllocator object allocating from a pool
+	*
+	* \param pool Pool to allocate from
+	*/
+
+	template<typename T>
+	PoolAllocator<T>::PoolAllocator(ConcurrentMemoryPool& pool) noexcept :
+	m_pool(&pool)
+	{
+	}
+
+	/*!
+	* \brief Constructs a PoolAllocator object from an allocator of another type, sharing its pool
+	*
+	* \param allocator Allocator to copy the pool from
+	*/
+
+	template<typename T>
+	template<typename U>
+	PoolAllocator<T>::PoolAllocator(const PoolAllocator<U>& allocator) noexcept :
+	m_pool(allocator.m_pool)
+	{
+	}
+
+	/*!
+	* \brief Allocates uninitialized memory for count objects
+	* \return Pointer to the allocated memory
+	*
+	* \param count Number of objects
+	*/
+
+	template<typename T>
+	T* PoolAllocator<T>::allocate(std::size_t count)
+	{
+		return static_cast<T*>(m_pool->Allocate(count * sizeof(T)));
+	}
+
+	/*!
+	* \brief Releases memory previously returned by allocate
+	*
+	* \param ptr Pointer to the memory
+	* \param count Number of objects, as given to allocate
+	*/
+
+	template<typename T>
+	void PoolAllocator<T>::deallocate(T* ptr, std::size_t count) noexcept
+	{
+		NazaraUnused(count);
+
+		m_pool->Free(ptr);
+	}
+
+	/*!
+	* \brief Gets the pool this allocator allocates from
+	* \return Reference to the pool
+	*/
+
+	template<typename T>
+	ConcurrentMemoryPool& PoolAllocator<T>::GetPool() const
+	{
+		return *m_pool;
+	}
+
+	/*!
+	* \brief Checks whether two allocators can free the memory of each other
+	* \return true if both allocators share the same pool
+	*
+	* \param allocator Other allocator
+	*/
+
+	template<typename T>
+	template<typename U>
+	bool PoolAllocator<T>::operator==(const PoolAllocator<U>& allocator) const noexcept
+	{
+		return m_pool == allocator.m_pool;
+	}
+
+	/*!
+	* \brief Checks whether two allocators cannot free the memory of each other
+	* \return false if both allocators share the same pool
+	*
+	* \param allocator Other allocator
+	*/
+
+	template<typename T>
+	template<typename U>
+	bool PoolAllocator<T>::operator!=(const PoolAllocator<U>& allocator) const noexcept
+	{
+		return !operator==(allocator);
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -0,0 +1,64 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_PROFILER_HPP
+#define NAZARA_PROFILER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <atomic>
+
+namespace Nz
+{
+	class Stream;
+	class String;
+
+	class NAZARA_CORE_API Profiler
+	{
+		public:
+			class Scope;
+
+			Profiler() = delete;
+			~Profiler() = delete;
+
+			static void Clear();
+
+			static void Enable(bool enable = true);
+
+			static bool ExportChromeTrace(const String& filePath);
+			static bool ExportChromeTrace(Stream& stream);
+
+			static inline bool IsEnabled();
+
+			static void SetThreadName(const String& name);
+
+			class Scope
+			{
+				public:
+					inline Scope(const char* name);
+					Scope(const Scope&) = delete;
+					Scope(Scope&&) = delete;
+					inline ~Scope();
+
+					Scope& operator=(const Scope&) = delete;
+					Scope& operator=(Scope&&) = delete;
+
+				private:
+					const char* m_name;
+					UInt64 m_startTime;
+					bool m_enabled;
+			};
+
+		private:
+			static void RecordEvent(const char* name, UInt64 startTime, UInt64 endTime);
+
+			static std::atomic_bool s_enabled;
+	};
+}
+
+#include <Nazara/Core/Profiler.inl>
+
+#endif // NAZARA_PROFILER_HPP
@@ -0,0 +1,43 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Checks whether the profiler records the scopes
+	* \return true If it is the case
+	*/
+	inline bool Profiler::IsEnabled()
+	{
+		return s_enabled.load(std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Begins a scope, recorded when it ends if the profiler is enabled
+	*
+	* \param name Name of the scope, it must outlive the profiler (a string literal or an interned Name for example)
+	*/
+	inline Profiler::Scope::Scope(const char* name) :
+	m_name(name),
+	m_startTime(0),
+	m_enabled(Profiler::IsEnabled())
+	{
+		if (m_enabled)
+			m_startTime = GetElapsedMicroseconds();
+	}
+
+	/*!
+	* \brief Ends the scope begun by the constructor, recording it into the buffer of the calling thread
+	*/
+	inline Profiler::Scope::~Scope()
+	{
+		if (m_enabled)
+			Profiler::RecordEvent(m_name, m_startTime, GetElapsedMicroseconds());
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
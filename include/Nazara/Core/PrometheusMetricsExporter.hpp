@@ -0,0 +1,25 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_PROMETHEUSMETRICSEXPORTER_HPP
+#define NAZARA_PROMETHEUSMETRICSEXPORTER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/AbstractMetricsExporter.hpp>
+
+namespace Nz
+{
+	class NAZARA_CORE_API PrometheusMetricsExporter : public AbstractMetricsExporter
+	{
+		public:
+			PrometheusMetricsExporter() = default;
+			~PrometheusMetricsExporter() = default;
+
+			String Export(const std::vector<Metrics::Sample>& samples) override;
+	};
+}
+
+#endif // NAZARA_PROMETHEUSMETRICSEXPORTER_HPP
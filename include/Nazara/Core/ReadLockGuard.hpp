@@ -0,0 +1,34 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_READLOCKGUARD_HPP
+#define NAZARA_READLOCKGUARD_HPP
+
+#include <Nazara/Prerequisites.hpp>
+
+namespace Nz
+{
+	class ReadWriteLock;
+
+	class ReadLockGuard
+	{
+		public:
+			inline ReadLockGuard(ReadWriteLock& lock, bool acquire = true);
+			inline ~ReadLockGuard();
+
+			inline void Lock();
+			inline bool TryLock();
+			inline void Unlock();
+
+		private:
+			ReadWriteLock& m_lock;
+			bool m_locked;
+	};
+}
+
+#include <Nazara/Core/ReadLockGuard.inl>
+
+#endif // NAZARA_READLOCKGUARD_HPP
@@ -0,0 +1,85 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/ReadLockGuard.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/ReadWriteLock.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::ReadLockGuard
+	* \brief Core class that holds a ReadWriteLock for reading, with a RAII-style mechanism
+	*/
+
+	/*!
+	* \brief Constructs a ReadLockGuard object with a read-write lock
+	*
+	* \param lock Lock to hold for reading
+	* \param acquire Should the lock be acquired by the constructor
+	*/
+	inline ReadLockGuard::ReadLockGuard(ReadWriteLock& lock, bool acquire) :
+	m_lock(lock),
+	m_locked(false)
+	{
+		if (acquire)
+		{
+			m_lock.LockRead();
+			m_locked = true;
+		}
+	}
+
+	/*!
+	* \brief Destructs a ReadLockGuard object and unlocks the lock if it is held
+	*/
+	inline ReadLockGuard::~ReadLockGuard()
+	{
+		if (m_locked)
+			m_lock.UnlockRead();
+	}
+
+	/*!
+	* \brief Locks the underlying lock for reading
+	*
+	* \see ReadWriteLock::LockRead
+	*/
+	inline void ReadLockGuard::Lock()
+	{
+		NazaraAssert(!m_locked, "Lock is already held");
+
+		m_lock.LockRead();
+		m_locked = true;
+	}
+
+	/*!
+	* \brief Tries to lock the underlying lock for reading
+	* \return true if the lock was acquired successfully
+	*
+	* \see ReadWriteLock::TryLockRead
+	*/
+	inline bool ReadLockGuard::TryLock()
+	{
+		NazaraAssert(!m_locked, "Lock is already held");
+
+		m_locked = m_lock.TryLockRead();
+		return m_locked;
+	}
+
+	/*!
+	* \brief Unlocks the underlying lock
+	*
+	* \see ReadWriteLock::UnlockRead
+	*/
+	inline void ReadLockGuard::Unlock()
+	{
+		NazaraAssert(m_locked, "Lock is not held");
+
+		m_lock.UnlockRead();
+		m_locked = false;
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
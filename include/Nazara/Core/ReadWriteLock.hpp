@@ -0,0 +1,44 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_READWRITELOCK_HPP
+#define NAZARA_READWRITELOCK_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/MovablePtr.hpp>
+#include <Nazara/Core/Mutex.hpp>
+
+namespace Nz
+{
+	class ReadWriteLockImpl;
+
+	class NAZARA_CORE_API ReadWriteLock
+	{
+		public:
+			ReadWriteLock();
+			ReadWriteLock(const ReadWriteLock&) = delete;
+			ReadWriteLock(ReadWriteLock&&) noexcept = default;
+			~ReadWriteLock();
+
+			void LockRead();
+			void LockWrite();
+			bool TryLockRead();
+			bool TryLockWrite();
+			void UnlockRead();
+			void UnlockWrite();
+
+			ReadWriteLock& operator=(const ReadWriteLock&) = delete;
+			ReadWriteLock& operator=(ReadWriteLock&&) noexcept = default;
+
+			static LockContentionStats GetContentionStats();
+			static void ResetContentionStats();
+
+		private:
+			MovablePtr<ReadWriteLockImpl> m_impl;
+	};
+}
+
+#endif // NAZARA_READWRITELOCK_HPP
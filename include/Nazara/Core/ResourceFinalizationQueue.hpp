@@ -0,0 +1,34 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_RESOURCEFINALIZATIONQUEUE_HPP
+#define NAZARA_RESOURCEFINALIZATIONQUEUE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <functional>
+#include <limits>
+
+namespace Nz
+{
+	class NAZARA_CORE_API ResourceFinalizationQueue
+	{
+		public:
+			using Finalization = std::function<void()>;
+
+			ResourceFinalizationQueue() = delete;
+			~ResourceFinalizationQueue() = delete;
+
+			static void Clear();
+
+			static void Enqueue(Finalization finalization);
+
+			static std::size_t GetPendingCount();
+
+			static std::size_t Process(std::size_t maxCount = std::numeric_limits<std::size_t>::max());
+	};
+}
+
+#endif // NAZARA_RESOURCEFINALIZATIONQUEUE_HPP
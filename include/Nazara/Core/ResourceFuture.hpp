@@ -0,0 +1,70 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_RESOURCEFUTURE_HPP
+#define NAZARA_RESOURCEFUTURE_HPP
+
+#include <Nazara/Core/ConditionVariable.hpp>
+#include <Nazara/Core/Enums.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/ObjectRef.hpp>
+#include <atomic>
+#include <functional>
+#include <memory>
+
+namespace Nz
+{
+	template<typename Type>
+	class ResourceFuture
+	{
+		public:
+			using Completion = std::function<void(bool succeeded)>;
+			using DeferredTask = std::function<void(Type& resource, Completion completion)>;
+			using FlushTask = std::function<void(Type& resource)>;
+			using Task = std::function<bool(Type& resource)>;
+
+			ResourceFuture() = default;
+			explicit ResourceFuture(ObjectRef<Type> resource);
+			ResourceFuture(const ResourceFuture&) = default;
+			ResourceFuture(ResourceFuture&&) = default;
+			~ResourceFuture() = default;
+
+			ObjectRef<Type> Get() const;
+			ResourceLoadState GetState() const;
+
+			bool IsReady() const;
+			bool IsValid() const;
+
+			ObjectRef<Type> Wait() const;
+
+			ResourceFuture& operator=(const ResourceFuture&) = default;
+			ResourceFuture& operator=(ResourceFuture&&) = default;
+
+			static ResourceFuture Start(ObjectRef<Type> resource, Task load, Task finalize = Task());
+			static ResourceFuture StartDeferred(ObjectRef<Type> resource, Task load, DeferredTask finalize, FlushTask flush);
+
+		private:
+			struct State
+			{
+				ConditionVariable condition;
+				Mutex mutex;
+				ObjectRef<Type> resource;
+				DeferredTask finalize;
+				FlushTask flush;
+				std::atomic<ResourceLoadState> loadState;
+				std::atomic_bool isFinalizationPending;
+			};
+
+			static void Finalize(const std::shared_ptr<State>& state);
+			static void SetLoadState(State& state, ResourceLoadState loadState);
+
+			std::shared_ptr<State> m_state;
+	};
+}
+
+#include <Nazara/Core/ResourceFuture.inl>
+
+#endif // NAZARA_RESOURCEFUTURE_HPP
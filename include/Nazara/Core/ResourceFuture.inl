@@ -0,0 +1,228 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/ResourceFinalizationQueue.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::ResourceFuture
+	* \brief Core class giving access to a resource loaded asynchronously
+	*
+	* Loading happens in two steps: the resource is first decoded by the TaskScheduler workers, then finalized by ResourceFinalizationQueue::Process on the thread owning the resources (e.g. to upload it to the GPU).
+	* The resource is only accessible once both steps succeeded.
+	*
+	* \see ResourceLoader::LoadAsync
+	* \see ResourceManager::GetAsync
+	*/
+
+	/*!
+	* \brief Constructs a ResourceFuture object holding an already loaded resource
+	*
+	* \param resource Loaded resource
+	*/
+	template<typename Type>
+	ResourceFuture<Type>::ResourceFuture(ObjectRef<Type> resource) :
+	m_state(std::make_shared<State>())
+	{
+		m_state->resource = std::move(resource);
+		m_state->loadState = (m_state->resource) ? ResourceLoadState_Loaded : ResourceLoadState_Failed;
+		m_state->isFinalizationPending = false;
+	}
+
+	/*!
+	* \brief Gets the resource
+	* \return Resource if it was loaded successfully, nullptr if it failed to load or is still loading
+	*
+	* \see Wait
+	*/
+	template<typename Type>
+	ObjectRef<Type> ResourceFuture<Type>::Get() const
+	{
+		NazaraAssert(IsValid(), "Invalid future");
+
+		if (m_state->loadState != ResourceLoadState_Loaded)
+			return ObjectRef<Type>();
+
+		return m_state->resource;
+	}
+
+	/*!
+	* \brief Gets the current step of the loading
+	* \return Load state, which is updated from other threads
+	*/
+	template<typename Type>
+	ResourceLoadState ResourceFuture<Type>::GetState() const
+	{
+		NazaraAssert(IsValid(), "Invalid future");
+
+		return m_state->loadState;
+	}
+
+	/*!
+	* \brief Checks whether the loading is over
+	* \return true If the resource is loaded or failed to load
+	*/
+	template<typename Type>
+	bool ResourceFuture<Type>::IsReady() const
+	{
+		ResourceLoadState loadState = GetState();
+		return loadState == ResourceLoadState_Failed || loadState == ResourceLoadState_Loaded;
+	}
+
+	/*!
+	* \brief Checks whether the future refers to a resource
+	* \return true If this future was returned by a load
+	*/
+	template<typename Type>
+	bool ResourceFuture<Type>::IsValid() const
+	{
+		return m_state != nullptr;
+	}
+
+	/*!
+	* \brief Blocks until the resource is loaded
+	* \return Resource if it was loaded successfully, nullptr otherwise
+	*
+	* If the resource waits for its finalization, it happens right away on the calling thread instead of waiting for ResourceFinalizationQueue::Process.
+	* Deferred finalizations which were started are flushed, completing them on the calling thread.
+	*
+	* \remark This must be called by the thread finalizing resources
+	*/
+	template<typename Type>
+	ObjectRef<Type> ResourceFuture<Type>::Wait() const
+	{
+		NazaraAssert(IsValid(), "Invalid future");
+
+		State& state = *m_state;
+		{
+			LockGuard lock(state.mutex);
+			while (state.loadState == ResourceLoadState_Loading)
+				state.condition.Wait(&state.mutex);
+		}
+
+		if (state.loadState == ResourceLoadState_Finalizing)
+		{
+			Finalize(m_state);
+
+			// Deferred finalizations may be completed later by the calling thread, they have to be completed right away
+			if (state.loadState == ResourceLoadState_Finalizing && state.flush)
+				state.flush(*state.resource);
+
+			// Another thread may be finalizing it
+			LockGuard lock(state.mutex);
+			while (state.loadState == ResourceLoadState_Finalizing)
+				state.condition.Wait(&state.mutex);
+		}
+
+		return Get();
+	}
+
+	/*!
+	* \brief Starts loading a resource asynchronously
+	* \return Future of the resource
+	*
+	* \param resource Resource to load
+	* \param load Function decoding the resource, called by a TaskScheduler worker
+	* \param finalize Optional function called after load succeeded, by ResourceFinalizationQueue::Process
+	*
+	* \remark The resource must not be used by other threads until it's loaded
+	*/
+	template<typename Type>
+	ResourceFuture<Type> ResourceFuture<Type>::Start(ObjectRef<Type> resource, Task load, Task finalize)
+	{
+		DeferredTask deferredFinalize;
+		if (finalize)
+		{
+			deferredFinalize = [finalize](Type& decodedResource, Completion completion)
+			{
+				completion(finalize(decodedResource));
+			};
+		}
+
+		return StartDeferred(std::move(resource), std::move(load), std::move(deferredFinalize), FlushTask());
+	}
+
+	/*!
+	* \brief Starts loading a resource asynchronously, its finalization being completed later
+	* \return Future of the resource
+	*
+	* This allows the finalization to spread its work over several frames (e.g. uploading a texture within a per-frame budget), the resource is only loaded once the completion is called.
+	*
+	* \param resource Resource to load
+	* \param load Function decoding the resource, called by a TaskScheduler worker
+	* \param finalize Function called after load succeeded, by ResourceFinalizationQueue::Process, which must call the completion once the resource is ready (right away or later, from the same thread)
+	* \param flush Function called by Wait when the finalization was started but not completed, which must complete it before returning
+	*
+	* \remark The resource must not be used by other threads until it's loaded
+	*/
+	template<typename Type>
+	ResourceFuture<Type> ResourceFuture<Type>::StartDeferred(ObjectRef<Type> resource, Task load, DeferredTask finalize, FlushTask flush)
+	{
+		NazaraAssert(resource, "Invalid resource");
+		NazaraAssert(load, "Invalid load function");
+
+		ResourceFuture future;
+		future.m_state = std::make_shared<State>();
+
+		std::shared_ptr<State> state = future.m_state;
+		state->resource = std::move(resource);
+		state->finalize = std::move(finalize);
+		state->flush = std::move(flush);
+		state->isFinalizationPending = static_cast<bool>(state->finalize);
+		state->loadState = ResourceLoadState_Loading;
+
+		TaskScheduler::AddTask([state, load]()
+		{
+			if (!load(*state->resource))
+			{
+				SetLoadState(*state, ResourceLoadState_Failed);
+				return;
+			}
+
+			if (state->isFinalizationPending)
+			{
+				SetLoadState(*state, ResourceLoadState_Finalizing);
+				ResourceFinalizationQueue::Enqueue([state]() { Finalize(state); });
+			}
+			else
+				SetLoadState(*state, ResourceLoadState_Loaded);
+		});
+		TaskScheduler::Run();
+
+		return future;
+	}
+
+	template<typename Type>
+	void ResourceFuture<Type>::Finalize(const std::shared_ptr<State>& state)
+	{
+		// The queue and Wait may both try to finalize the resource
+		if (!state->isFinalizationPending.exchange(false))
+			return;
+
+		// Releases what was kept for the finalization (e.g. decoded data) once it's over, even if the completion is called right away
+		DeferredTask finalize = std::move(state->finalize);
+		state->finalize = DeferredTask();
+
+		finalize(*state->resource, [state](bool succeeded)
+		{
+			SetLoadState(*state, (succeeded) ? ResourceLoadState_Loaded : ResourceLoadState_Failed);
+		});
+	}
+
+	template<typename Type>
+	void ResourceFuture<Type>::SetLoadState(State& state, ResourceLoadState loadState)
+	{
+		LockGuard lock(state.mutex);
+		state.loadState = loadState;
+		state.condition.SignalAll();
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
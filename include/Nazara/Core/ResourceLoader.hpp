@@ -9,6 +9,7 @@
 
 #include <Nazara/Core/Enums.hpp>
 #include <Nazara/Core/Resource.hpp>
+#include <Nazara/Core/ResourceFuture.hpp>
 #include <Nazara/Core/ResourceParameters.hpp>
 #include <Nazara/Core/String.hpp>
 #include <list>
@@ -38,6 +39,7 @@ namespace Nz
 
 			static bool IsExtensionSupported(const String& extension);
 
+			static ResourceFuture<Type> LoadAsync(const String& filePath, const Parameters& parameters = Parameters(), typename ResourceFuture<Type>::Task finalize = typename ResourceFuture<Type>::Task());
 			static bool LoadFromFile(Type* resource, const String& filePath, const Parameters& parameters = Parameters());
 			static bool LoadFromMemory(Type* resource, const void* data, std::size_t size, const Parameters& parameters = Parameters());
 			static bool LoadFromStream(Type* resource, Stream& stream, const Parameters& parameters = Parameters());
@@ -4,9 +4,14 @@
 
 #include <Nazara/Core/Config.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/ErrorFlags.hpp>
 #include <Nazara/Core/File.hpp>
+#include <Nazara/Core/MappedFile.hpp>
 #include <Nazara/Core/MemoryView.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Core/Stream.hpp>
+#include <Nazara/Core/VirtualFile.hpp>
+#include <Nazara/Core/VirtualFileSystem.hpp>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
@@ -37,6 +42,29 @@ namespace Nz
 		return false;
 	}
 
+	/*!
+	* \brief Loads a resource from a file without blocking
+	* \return Future giving access to the resource once loaded
+	*
+	* The file is read and decoded by the TaskScheduler workers, the optional finalization is then run by ResourceFinalizationQueue::Process.
+	*
+	* \param filePath Path to the resource
+	* \param parameters Parameters for the load
+	* \param finalize Optional function completing the load on the thread owning the resources (e.g. to create GPU objects)
+	*
+	* \remark Loaders must not create resources bound to a thread (such as hardware buffers), such parts belong to the finalization
+	*/
+	template<typename Type, typename Parameters>
+	ResourceFuture<Type> ResourceLoader<Type, Parameters>::LoadAsync(const String& filePath, const Parameters& parameters, typename ResourceFuture<Type>::Task finalize)
+	{
+		NazaraAssert(parameters.IsValid(), "Invalid parameters");
+
+		return ResourceFuture<Type>::Start(Type::New(), [filePath, parameters](Type& resource)
+		{
+			return LoadFromFile(&resource, filePath, parameters);
+		}, std::move(finalize));
+	}
+
 	/*!
 	* \brief Loads a resource from a file
 	* \return true if successfully loaded
@@ -45,6 +73,9 @@ namespace Nz
 	* \param filePath Path to the resource
 	* \param parameters Parameters for the load
 	*
+	* The file is mapped in memory (see MappedFile), loaders having a memory loader read it directly from there, falling back to a regular file if it cannot be mapped
+	* Files belonging to an archive mounted with VirtualFileSystem are read from the archive instead, file loaders are then skipped in favor of their stream or memory loader
+	*
 	* \remark Produces a NazaraError if resource is nullptr with NAZARA_CORE_SAFE defined
 	* \remark Produces a NazaraError if parameters are invalid with NAZARA_CORE_SAFE defined
 	* \remark Produces a NazaraError if filePath has no extension
@@ -58,6 +89,8 @@ namespace Nz
 		NazaraAssert(resource, "Invalid resource");
 		NazaraAssert(parameters.IsValid(), "Invalid parameters");
 
+		Profiler::Scope profilerScope("ResourceLoader::LoadFromFile");
+
 		String path = File::NormalizePath(filePath);
 		String ext = path.SubStringFrom('.', -1, true).ToLower();
 		if (ext.IsEmpty())
@@ -66,7 +99,47 @@ namespace Nz
 			return false;
 		}
 
-		File file(path); // Open only if needed
+		// Files of mounted archives are read from there, without any access to the file system
+		bool isVirtual = VirtualFileSystem::Exists(path);
+
+		// Open only if needed, the file is mapped in memory when possible so memory loaders can read it without any copy
+		MappedFile mappedFile;
+		File file;
+		VirtualFile virtualFile;
+		Stream* stream = nullptr;
+
+		auto OpenStream = [&]() -> bool
+		{
+			if (stream)
+				return true;
+
+			if (isVirtual)
+			{
+				if (!VirtualFileSystem::Open(path, &virtualFile))
+					return false;
+
+				stream = &virtualFile;
+				return true;
+			}
+
+			{
+				// Falling back to a regular file isn't an error
+				ErrorFlags errFlags(ErrorFlag_Discard | ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
+				if (mappedFile.Open(path) && mappedFile.GetSize() > 0)
+				{
+					stream = &mappedFile;
+					return true;
+				}
+			}
+
+			mappedFile.Close();
+
+			if (!file.Open(path, OpenMode_ReadOnly))
+				return false;
+
+			stream = &file;
+			return true;
+		};
 
 		bool found = false;
 		for (Loader& loader : Type::s_loaders)
@@ -78,14 +151,21 @@ namespace Nz
 			StreamChecker checkFunc = std::get<1>(loader);
 			StreamLoader streamLoader = std::get<2>(loader);
 			FileLoader fileLoader = std::get<3>(loader);
+			MemoryLoader memoryLoader = std::get<4>(loader);
 
-			if (checkFunc && !file.IsOpen())
+			if (isVirtual && fileLoader)
 			{
-				if (!file.Open(OpenMode_ReadOnly))
-				{
-					NazaraError("Failed to load file: unable to open \"" + filePath + '"');
-					return false;
-				}
+				// File loaders read from the file system, archive entries can only go through streams or memory
+				if (!streamLoader && !memoryLoader)
+					continue;
+
+				fileLoader = nullptr;
+			}
+
+			if ((checkFunc || !fileLoader) && !OpenStream())
+			{
+				NazaraError("Failed to load file: unable to open \"" + filePath + '"');
+				return false;
 			}
 
 			Ternary recognized = Ternary_Unknown;
@@ -93,9 +173,9 @@ namespace Nz
 			{
 				if (checkFunc)
 				{
-					file.SetCursorPos(0);
+					stream->SetCursorPos(0);
 
-					recognized = checkFunc(file, parameters);
+					recognized = checkFunc(*stream, parameters);
 					if (recognized == Ternary_False)
 						continue;
 					else
@@ -115,17 +195,28 @@ namespace Nz
 			}
 			else
 			{
-				file.SetCursorPos(0);
+				stream->SetCursorPos(0);
 
-				recognized = checkFunc(file, parameters);
+				recognized = checkFunc(*stream, parameters);
 				if (recognized == Ternary_False)
 					continue;
 				else if (recognized == Ternary_True)
 					found = true;
 
-				file.SetCursorPos(0);
+				bool loaded;
+				if (memoryLoader && (isVirtual || mappedFile.IsOpen()))
+				{
+					const UInt8* data = (isVirtual) ? virtualFile.GetData() : mappedFile.GetData();
+					loaded = memoryLoader(resource, data, static_cast<std::size_t>(stream->GetSize()), parameters);
+				}
+				else
+				{
+					stream->SetCursorPos(0);
+
+					loaded = streamLoader(resource, *stream, parameters);
+				}
 
-				if (streamLoader(resource, file, parameters))
+				if (loaded)
 				{
 					resource->SetFilePath(filePath);
 					return true;
@@ -167,6 +258,8 @@ namespace Nz
 		NazaraAssert(size, "No data to load");
 		NazaraAssert(parameters.IsValid(), "Invalid parameters");
 
+		Profiler::Scope profilerScope("ResourceLoader::LoadFromMemory");
+
 		MemoryView stream(data, size);
 
 		bool found = false;
@@ -247,6 +340,8 @@ namespace Nz
 		NazaraAssert(stream.GetCursorPos() < stream.GetSize(), "No data to load");
 		NazaraAssert(parameters.IsValid(), "Invalid parameters");
 
+		Profiler::Scope profilerScope("ResourceLoader::LoadFromStream");
+
 		UInt64 streamPos = stream.GetCursorPos();
 		bool found = false;
 		for (Loader& loader : Type::s_loaders)
@@ -8,6 +8,7 @@
 #define NAZARA_RESOURCEMANAGER_HPP
 
 #include <Nazara/Core/ObjectRef.hpp>
+#include <Nazara/Core/ResourceFuture.hpp>
 #include <Nazara/Core/ResourceParameters.hpp>
 #include <Nazara/Core/String.hpp>
 #include <unordered_map>
@@ -25,16 +26,49 @@ namespace Nz
 
 			static void Clear();
 
+			static void EnableContentDeduplication(bool enable);
+
 			static ObjectRef<Type> Get(const String& filePath);
+			static ResourceFuture<Type> GetAsync(const String& filePath);
 			static const Parameters& GetDefaultParameters();
+			static std::size_t GetMemoryUsage();
+			static std::size_t GetResourceCount();
+
+			static bool IsContentDeduplicationEnabled();
 
 			static void Purge();
 			static void Register(const String& filePath, ObjectRef<Type> resource);
+			static bool Reload(const String& filePath);
 			static void SetDefaultParameters(const Parameters& params);
 			static void Unregister(const String& filePath);
 
 		private:
+			struct PendingReload
+			{
+				ResourceFuture<Type> future;
+				bool outdated; //< The file changed again during the reload
+			};
+
+			struct ContentDeduplication
+			{
+				std::unordered_map<String, String> filePathByHash; //< First file loaded with this content (hexadecimal XXH3 digest)
+				bool enabled = false;
+			};
+
+			using PendingMap = std::unordered_map<String, ResourceFuture<Type>>;
+			using PendingReloadMap = std::unordered_map<String, PendingReload>;
+
+			static ContentDeduplication& GetContentDeduplication();
+			static PendingMap& GetPendingLoads();
+			static PendingReloadMap& GetPendingReloads();
+			template<typename T> static auto GetResourceMemoryUsage(const T& resource, int) -> decltype(resource.GetMemoryUsage(), std::size_t());
+			static std::size_t GetResourceMemoryUsage(const Type& resource, long);
 			static bool Initialize();
+			static bool IsShared(const ObjectRef<Type>& resource);
+			static ObjectRef<Type> LoadResource(const String& filePath);
+			static void RegisterLoadedResources();
+			template<typename T> static auto ReloadResource(const ObjectRef<T>& resource, const String& filePath, int) -> decltype(T::ReloadAsync(resource, filePath, GetDefaultParameters()), bool());
+			static bool ReloadResource(const ObjectRef<Type>& resource, const String& filePath, long);
 			static void Uninitialize();
 
 			using ManagerMap = std::unordered_map<String, ObjectRef<Type>>;
@@ -5,6 +5,9 @@
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/File.hpp>
 #include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/ResourceWatcher.hpp>
+#include <unordered_set>
+#include <vector>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
@@ -13,6 +16,10 @@ namespace Nz
 	* \ingroup core
 	* \class Nz::ResourceManager
 	* \brief Core class that represents a resource manager
+	*
+	* \remark The manager must only be used by one thread, asynchronous loads are registered by this thread once loaded
+	* \remark Resources are reloaded in place when their file changes, see ResourceWatcher
+	* \remark Files are identified by their canonical path, so every path leading to a file gives the same resource
 	*/
 
 	/*!
@@ -21,9 +28,32 @@ namespace Nz
 	template<typename Type, typename Parameters>
 	void ResourceManager<Type, Parameters>::Clear()
 	{
+		GetContentDeduplication().filePathByHash.clear();
+		GetPendingLoads().clear();
+		GetPendingReloads().clear();
 		Type::s_managerMap.clear();
 	}
 
+	/*!
+	* \brief Enables or disables the deduplication of the resources by content
+	*
+	* When enabled, the files are hashed before being loaded and a file having the same content as a loaded one gets the same resource,
+	* which is useful when the same asset is duplicated between packs. Only the synchronous loads (Get) are deduplicated.
+	*
+	* \param enable Should the resources be deduplicated
+	*
+	* \remark A shared resource whose file changes is loaded again for this file only, the references to the shared resource keeping the previous content
+	*/
+	template<typename Type, typename Parameters>
+	void ResourceManager<Type, Parameters>::EnableContentDeduplication(bool enable)
+	{
+		ContentDeduplication& deduplication = GetContentDeduplication();
+		deduplication.enabled = enable;
+
+		if (!enable)
+			deduplication.filePathByHash.clear();
+	}
+
 	/*!
 	* \brief Gets a reference to the object loaded from file
 	* \return Reference to the object
@@ -33,31 +63,71 @@ namespace Nz
 	template<typename Type, typename Parameters>
 	ObjectRef<Type> ResourceManager<Type, Parameters>::Get(const String& filePath)
 	{
-		String absolutePath = File::AbsolutePath(filePath);
-		auto it = Type::s_managerMap.find(absolutePath);
+		RegisterLoadedResources();
+
+		String canonicalPath = File::CanonicalPath(filePath);
+		auto it = Type::s_managerMap.find(canonicalPath);
 		if (it == Type::s_managerMap.end())
 		{
-			ObjectRef<Type> resource = Type::New();
-			if (!resource)
+			// Don't load the file twice if an asynchronous load is running
+			PendingMap& pendingLoads = GetPendingLoads();
+			auto pendingIt = pendingLoads.find(canonicalPath);
+			if (pendingIt != pendingLoads.end())
 			{
-				NazaraError("Failed to create resource");
-				return ObjectRef<Type>();
-			}
+				ResourceFuture<Type> future = std::move(pendingIt->second);
+				pendingLoads.erase(pendingIt);
 
-			if (!resource->LoadFromFile(absolutePath, GetDefaultParameters()))
-			{
-				NazaraError("Failed to load resource from file: " + absolutePath);
-				return ObjectRef<Type>();
+				ObjectRef<Type> resource = future.Wait();
+				if (!resource)
+				{
+					NazaraError("Failed to load resource from file: " + canonicalPath);
+					return ObjectRef<Type>();
+				}
+
+				return Type::s_managerMap.insert(std::make_pair(canonicalPath, resource)).first->second;
 			}
 
-			NazaraDebug("Loaded resource from file " + absolutePath);
+			ObjectRef<Type> resource = LoadResource(canonicalPath);
+			if (!resource)
+				return ObjectRef<Type>();
 
-			it = Type::s_managerMap.insert(std::make_pair(absolutePath, resource)).first;
+			it = Type::s_managerMap.insert(std::make_pair(canonicalPath, std::move(resource))).first;
 		}
 
 		return it->second;
 	}
 
+	/*!
+	* \brief Gets a reference to the object loaded from file, loading it without blocking if needed
+	* \return Future of the object, ready right away if the object was already loaded
+	*
+	* The object is loaded with Type::LoadAsync and registered by the next call to the manager once loaded, requesting it again meanwhile gives the same future.
+	*
+	* \param filePath Path to the asset that will be loaded
+	*
+	* \see ResourceFinalizationQueue
+	*/
+	template<typename Type, typename Parameters>
+	ResourceFuture<Type> ResourceManager<Type, Parameters>::GetAsync(const String& filePath)
+	{
+		RegisterLoadedResources();
+
+		String canonicalPath = File::CanonicalPath(filePath);
+		auto it = Type::s_managerMap.find(canonicalPath);
+		if (it != Type::s_managerMap.end())
+			return ResourceFuture<Type>(it->second);
+
+		PendingMap& pendingLoads = GetPendingLoads();
+		auto pendingIt = pendingLoads.find(canonicalPath);
+		if (pendingIt != pendingLoads.end())
+			return pendingIt->second;
+
+		ResourceFuture<Type> future = Type::LoadAsync(canonicalPath, GetDefaultParameters());
+		pendingLoads.insert(std::make_pair(canonicalPath, future));
+
+		return future;
+	}
+
 	/*!
 	* \brief Gets the defaults parameters for the load
 	* \return Default parameters for loading from file
@@ -68,17 +138,74 @@ namespace Nz
 		return Type::s_managerParameters;
 	}
 
+	/*!
+	* \brief Gets the memory used by the resources of the manager
+	* \return Memory usage in bytes, each resource being counted once even when shared by several files
+	*
+	* \remark Only types having a GetMemoryUsage method are measured, 0 is returned for the others
+	*/
+	template<typename Type, typename Parameters>
+	std::size_t ResourceManager<Type, Parameters>::GetMemoryUsage()
+	{
+		RegisterLoadedResources();
+
+		std::size_t memoryUsage = 0;
+		std::unordered_set<const Type*> countedResources;
+		for (const auto& pair : Type::s_managerMap)
+		{
+			if (countedResources.insert(pair.second.Get()).second)
+				memoryUsage += GetResourceMemoryUsage(*pair.second, 0);
+		}
+
+		return memoryUsage;
+	}
+
+	/*!
+	* \brief Gets the number of resources held by the manager
+	* \return Resource count, each resource being counted once even when shared by several files
+	*/
+	template<typename Type, typename Parameters>
+	std::size_t ResourceManager<Type, Parameters>::GetResourceCount()
+	{
+		RegisterLoadedResources();
+
+		std::unordered_set<const Type*> resources;
+		for (const auto& pair : Type::s_managerMap)
+			resources.insert(pair.second.Get());
+
+		return resources.size();
+	}
+
+	/*!
+	* \brief Checks whether the resources are deduplicated by content
+	* \return true If it is the case
+	*
+	* \see EnableContentDeduplication
+	*/
+	template<typename Type, typename Parameters>
+	bool ResourceManager<Type, Parameters>::IsContentDeduplicationEnabled()
+	{
+		return GetContentDeduplication().enabled;
+	}
+
 	/*!
 	* \brief Purges the resource manager from every asset whose it is the only owner
 	*/
 	template<typename Type, typename Parameters>
 	void ResourceManager<Type, Parameters>::Purge()
 	{
+		RegisterLoadedResources();
+
+		// A deduplicated resource is referenced once per file sharing it
+		std::unordered_map<const Type*, unsigned int> managerReferences;
+		for (const auto& pair : Type::s_managerMap)
+			managerReferences[pair.second.Get()]++;
+
 		auto it = Type::s_managerMap.begin();
 		while (it != Type::s_managerMap.end())
 		{
 			const ObjectRef<Type>& ref = it->second;
-			if (ref->GetReferenceCount() == 1) // Are we the only ones to own the resource ?
+			if (ref->GetReferenceCount() == managerReferences[ref.Get()]) // Are we the only ones to own the resource ?
 			{
 				NazaraDebug("Purging resource from file " + ref->GetFilePath());
 				Type::s_managerMap.erase(it++); // Then we erase it
@@ -97,9 +224,62 @@ namespace Nz
 	template<typename Type, typename Parameters>
 	void ResourceManager<Type, Parameters>::Register(const String& filePath, ObjectRef<Type> resource)
 	{
-		String absolutePath = File::AbsolutePath(filePath);
+		String canonicalPath = File::CanonicalPath(filePath);
 
-		Type::s_managerMap[absolutePath] = resource;
+		GetPendingLoads().erase(canonicalPath);
+		Type::s_managerMap[canonicalPath] = resource;
+	}
+
+	/*!
+	* \brief Reloads the resource loaded from a file, in place
+	* \return true if a resource was loaded from this file
+	*
+	* Types having a ReloadAsync static method (loading the file in the background, then updating the resource) are reloaded without blocking, others are reloaded right away with LoadFromFile.
+	* References to the resource stay valid and see the new content.
+	*
+	* \param filePath Path to the file
+	*/
+	template<typename Type, typename Parameters>
+	bool ResourceManager<Type, Parameters>::Reload(const String& filePath)
+	{
+		RegisterLoadedResources();
+
+		String canonicalPath = File::CanonicalPath(filePath);
+		auto it = Type::s_managerMap.find(canonicalPath);
+		if (it == Type::s_managerMap.end())
+			return false;
+
+		// The content of the file changed, it can't be shared by the next loads anymore
+		ContentDeduplication& deduplication = GetContentDeduplication();
+		for (auto hashIt = deduplication.filePathByHash.begin(); hashIt != deduplication.filePathByHash.end();)
+		{
+			if (hashIt->second == canonicalPath)
+				hashIt = deduplication.filePathByHash.erase(hashIt);
+			else
+				++hashIt;
+		}
+
+		// Other files still have the content of a shared resource, this file gets its own one
+		if (IsShared(it->second))
+		{
+			if (ObjectRef<Type> resource = LoadResource(canonicalPath))
+				it->second = std::move(resource);
+			else
+				NazaraWarning("Failed to reload resource from file " + canonicalPath);
+
+			return true;
+		}
+
+		// Two reloads of the same resource could end in any order, the second one is started once the first ends
+		PendingReloadMap& pendingReloads = GetPendingReloads();
+		auto pendingIt = pendingReloads.find(canonicalPath);
+		if (pendingIt != pendingReloads.end())
+		{
+			pendingIt->second.outdated = true;
+			return true;
+		}
+
+		return ReloadResource(it->second, canonicalPath, 0);
 	}
 
 	/*!
@@ -121,9 +301,70 @@ namespace Nz
 	template<typename Type, typename Parameters>
 	void ResourceManager<Type, Parameters>::Unregister(const String& filePath)
 	{
-		String absolutePath = File::AbsolutePath(filePath);
+		String canonicalPath = File::CanonicalPath(filePath);
+
+		GetPendingLoads().erase(canonicalPath);
+		Type::s_managerMap.erase(canonicalPath);
+	}
+
+	/*!
+	* \brief Gets the state of the deduplication by content
+	* \return Deduplication state, disabled by default
+	*/
+	template<typename Type, typename Parameters>
+	typename ResourceManager<Type, Parameters>::ContentDeduplication& ResourceManager<Type, Parameters>::GetContentDeduplication()
+	{
+		static ContentDeduplication deduplication;
+		return deduplication;
+	}
 
-		Type::s_managerMap.erase(absolutePath);
+	/*!
+	* \brief Gets the asynchronous loads not registered yet
+	* \return Futures by canonical file path
+	*/
+	template<typename Type, typename Parameters>
+	typename ResourceManager<Type, Parameters>::PendingMap& ResourceManager<Type, Parameters>::GetPendingLoads()
+	{
+		static PendingMap pendingLoads;
+		return pendingLoads;
+	}
+
+	/*!
+	* \brief Gets the reloads running in the background
+	* \return Reloads by canonical file path
+	*/
+	template<typename Type, typename Parameters>
+	typename ResourceManager<Type, Parameters>::PendingReloadMap& ResourceManager<Type, Parameters>::GetPendingReloads()
+	{
+		static PendingReloadMap pendingReloads;
+		return pendingReloads;
+	}
+
+	/*!
+	* \brief Gets the memory used by a resource
+	* \return Memory usage in bytes
+	*
+	* \param resource Resource to measure
+	*/
+	template<typename Type, typename Parameters>
+	template<typename T>
+	auto ResourceManager<Type, Parameters>::GetResourceMemoryUsage(const T& resource, int) -> decltype(resource.GetMemoryUsage(), std::size_t())
+	{
+		return resource.GetMemoryUsage();
+	}
+
+	/*!
+	* \brief Gets the memory used by a resource which cannot measure it
+	* \return 0
+	*
+	* \param resource Resource to measure
+	*/
+	template<typename Type, typename Parameters>
+	std::size_t ResourceManager<Type, Parameters>::GetResourceMemoryUsage(const Type& resource, long)
+	{
+		NazaraUnused(resource);
+
+		return 0;
 	}
 
 	/*!
@@ -133,6 +374,163 @@ namespace Nz
 	template<typename Type, typename Parameters>
 	bool ResourceManager<Type, Parameters>::Initialize()
 	{
+		ResourceWatcher::RegisterReloader(&Reload);
+		return true;
+	}
+
+	/*!
+	* \brief Checks whether a resource is shared by several files
+	* \return true If it is the case
+	*
+	* \param resource Resource held by the manager
+	*/
+	template<typename Type, typename Parameters>
+	bool ResourceManager<Type, Parameters>::IsShared(const ObjectRef<Type>& resource)
+	{
+		unsigned int fileCount = 0;
+		for (const auto& pair : Type::s_managerMap)
+		{
+			if (pair.second == resource && ++fileCount > 1)
+				return true;
+		}
+
+		return false;
+	}
+
+	/*!
+	* \brief Loads a resource from a file, or gets the resource having the same content when deduplication is enabled
+	* \return Reference to the resource, invalid if it failed to load
+	*
+	* \param filePath Canonical path to the file
+	*/
+	template<typename Type, typename Parameters>
+	ObjectRef<Type> ResourceManager<Type, Parameters>::LoadResource(const String& filePath)
+	{
+		ContentDeduplication& deduplication = GetContentDeduplication();
+
+		// Files which cannot be read (virtual ones for example) get an empty hash and aren't deduplicated
+		String contentHash;
+		if (deduplication.enabled)
+		{
+			contentHash = File::ComputeHash(HashType_XXH3, filePath).ToHex();
+
+			auto hashIt = deduplication.filePathByHash.find(contentHash);
+			if (!contentHash.IsEmpty() && hashIt != deduplication.filePathByHash.end())
+			{
+				auto it = Type::s_managerMap.find(hashIt->second);
+				if (it != Type::s_managerMap.end())
+				{
+					NazaraDebug("Resource from file " + filePath + " shares the content of " + hashIt->second);
+					return it->second;
+				}
+			}
+		}
+
+		ObjectRef<Type> resource = Type::New();
+		if (!resource)
+		{
+			NazaraError("Failed to create resource");
+			return ObjectRef<Type>();
+		}
+
+		if (!resource->LoadFromFile(filePath, GetDefaultParameters()))
+		{
+			NazaraError("Failed to load resource from file: " + filePath);
+			return ObjectRef<Type>();
+		}
+
+		NazaraDebug("Loaded resource from file " + filePath);
+
+		if (!contentHash.IsEmpty())
+			deduplication.filePathByHash[contentHash] = filePath;
+
+		return resource;
+	}
+
+	/*!
+	* \brief Moves the asynchronous loads which succeeded to the manager, and forgets about the failed ones
+	*/
+	template<typename Type, typename Parameters>
+	void ResourceManager<Type, Parameters>::RegisterLoadedResources()
+	{
+		PendingMap& pendingLoads = GetPendingLoads();
+		for (auto it = pendingLoads.begin(); it != pendingLoads.end();)
+		{
+			const ResourceFuture<Type>& future = it->second;
+			if (future.IsReady())
+			{
+				if (ObjectRef<Type> resource = future.Get())
+				{
+					NazaraDebug("Loaded resource from file " + it->first);
+					Type::s_managerMap[it->first] = std::move(resource);
+				}
+
+				it = pendingLoads.erase(it);
+			}
+			else
+				++it;
+		}
+
+		std::vector<String> outdatedReloads;
+
+		PendingReloadMap& pendingReloads = GetPendingReloads();
+		for (auto it = pendingReloads.begin(); it != pendingReloads.end();)
+		{
+			const PendingReload& reload = it->second;
+			if (reload.future.IsReady())
+			{
+				if (reload.future.GetState() == ResourceLoadState_Failed)
+					NazaraWarning("Failed to reload resource from file " + it->first);
+				else
+					NazaraDebug("Reloaded resource from file " + it->first);
+
+				if (reload.outdated)
+					outdatedReloads.push_back(it->first);
+
+				it = pendingReloads.erase(it);
+			}
+			else
+				++it;
+		}
+
+		for (const String& filePath : outdatedReloads)
+		{
+			auto it = Type::s_managerMap.find(filePath);
+			if (it != Type::s_managerMap.end())
+				ReloadResource(it->second, filePath, 0);
+		}
+	}
+
+	/*!
+	* \brief Starts reloading a resource in the background
+	* \return true
+	*
+	* \param resource Resource to reload
+	* \param filePath Absolute path to its file
+	*/
+	template<typename Type, typename Parameters>
+	template<typename T>
+	auto ResourceManager<Type, Parameters>::ReloadResource(const ObjectRef<T>& resource, const String& filePath, int) -> decltype(T::ReloadAsync(resource, filePath, GetDefaultParameters()), bool())
+	{
+		GetPendingReloads()[filePath] = PendingReload{T::ReloadAsync(resource, filePath, GetDefaultParameters()), false};
+		return true;
+	}
+
+	/*!
+	* \brief Reloads a resource which cannot be reloaded in the background
+	* \return true
+	*
+	* \param resource Resource to reload
+	* \param filePath Absolute path to its file
+	*/
+	template<typename Type, typename Parameters>
+	bool ResourceManager<Type, Parameters>::ReloadResource(const ObjectRef<Type>& resource, const String& filePath, long)
+	{
+		if (!resource->LoadFromFile(filePath, GetDefaultParameters()))
+			NazaraWarning("Failed to reload resource from file " + filePath);
+		else
+			NazaraDebug("Reloaded resource from file " + filePath);
+
 		return true;
 	}
 
@@ -142,6 +540,7 @@ namespace Nz
 	template<typename Type, typename Parameters>
 	void ResourceManager<Type, Parameters>::Uninitialize()
 	{
+		ResourceWatcher::UnregisterReloader(&Reload);
 		Clear();
 	}
 }
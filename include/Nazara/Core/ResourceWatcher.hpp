@@ -0,0 +1,58 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_RESOURCEWATCHER_HPP
+#define NAZARA_RESOURCEWATCHER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/FileWatcher.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/String.hpp>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_CORE_API ResourceWatcher
+	{
+		friend class Core;
+
+		public:
+			using Reloader = bool(*)(const String& filePath);
+
+			ResourceWatcher() = delete;
+			~ResourceWatcher() = delete;
+
+			static void AddDependency(const String& resourcePath, const String& dependencyPath);
+
+			static void ClearDependencies(const String& resourcePath);
+
+			static bool IsWatching(const String& directoryPath);
+
+			static void RegisterReloader(Reloader reloader);
+
+			static std::size_t Reload(const String& filePath);
+
+			static void UnregisterReloader(Reloader reloader);
+			static void Unwatch(const String& directoryPath);
+			static std::size_t Update();
+
+			static bool Watch(const String& directoryPath, bool recursive = true);
+
+		private:
+			static std::size_t ReloadFiles(const std::vector<String>& filePaths);
+			static void Uninitialize();
+
+			static std::unique_ptr<FileWatcher> s_fileWatcher;
+			static std::unordered_map<String, std::unordered_set<String>> s_dependents;
+			static std::vector<Reloader> s_reloaders;
+			static Mutex s_dependencyMutex;
+	};
+}
+
+#endif // NAZARA_RESOURCEWATCHER_HPP
@@ -0,0 +1,76 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_SHELFBINPACK_HPP
+#define NAZARA_SHELFBINPACK_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Math/Rect.hpp>
+#include <map>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_CORE_API ShelfBinPack
+	{
+		public:
+			ShelfBinPack();
+			ShelfBinPack(unsigned int width, unsigned int height);
+			ShelfBinPack(const Vector2ui& size);
+			ShelfBinPack(const ShelfBinPack&) = default;
+			ShelfBinPack(ShelfBinPack&&) = default;
+			~ShelfBinPack() = default;
+
+			void Clear();
+
+			void Expand(unsigned int newWidth, unsigned newHeight);
+			void Expand(const Vector2ui& newSize);
+
+			void FreeRectangle(const Rectui& rect);
+
+			unsigned int GetHeight() const;
+			float GetOccupancy() const;
+			std::size_t GetShelfCount() const;
+			Vector2ui GetSize() const;
+			unsigned int GetWidth() const;
+
+			bool Insert(Rectui* rects, unsigned int count);
+			bool Insert(Rectui* rects, bool* inserted, unsigned int count);
+
+			void Reset();
+			void Reset(unsigned int width, unsigned int height);
+			void Reset(const Vector2ui& size);
+
+			ShelfBinPack& operator=(const ShelfBinPack&) = default;
+			ShelfBinPack& operator=(ShelfBinPack&&) = default;
+
+		private:
+			using ShelfIndex = std::multimap<unsigned int, std::size_t>;
+
+			struct Shelf
+			{
+				unsigned int height;
+				unsigned int rectCount;
+				unsigned int usedWidth;
+				unsigned int y;
+				bool isIndexed;
+			};
+
+			bool FindShelf(unsigned int width, unsigned int height, std::size_t* shelfIndex);
+			bool HasRoom(const Shelf& shelf) const;
+			void IndexShelf(std::size_t shelfIndex);
+			void UnindexShelf(std::size_t shelfIndex);
+
+			ShelfIndex m_openShelves;
+			std::vector<Shelf> m_shelves;
+			unsigned int m_height;
+			unsigned int m_nextShelfY;
+			unsigned int m_usedArea;
+			unsigned int m_width;
+	};
+}
+
+#endif // NAZARA_SHELFBINPACK_HPP
@@ -7,8 +7,11 @@
 #ifndef NAZARA_SIGNAL_HPP
 #define NAZARA_SIGNAL_HPP
 
+#include <Nazara/Prerequisites.hpp>
+#include <cstddef>
 #include <functional>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 #define NazaraDetailSignal(Keyword, SignalName, ...) using SignalName ## Type = Nz::Signal<__VA_ARGS__>; \
@@ -31,15 +34,16 @@ namespace Nz
 			class Connection;
 			class ConnectionGuard;
 
-			Signal();
+			Signal() = default;
 			Signal(const Signal&) = delete;
-			Signal(Signal&& signal) noexcept;
+			Signal(Signal&& signal) noexcept = default;
 			~Signal() = default;
 
 			void Clear();
 
 			Connection Connect(const Callback& func);
 			Connection Connect(Callback&& func);
+			template<typename F> Connection Connect(F&& func);
 			template<typename O> Connection Connect(O& object, void (O::*method)(Args...));
 			template<typename O> Connection Connect(O* object, void (O::*method)(Args...));
 			template<typename O> Connection Connect(const O& object, void (O::*method)(Args...) const);
@@ -48,31 +52,59 @@ namespace Nz
 			void operator()(Args... args) const;
 
 			Signal& operator=(const Signal&) = delete;
-			Signal& operator=(Signal&& signal) noexcept;
+			Signal& operator=(Signal&& signal) noexcept = default;
 
 		private:
-			struct Slot;
+			static constexpr std::size_t InlineCallbackSize = 4 * sizeof(void*);
 
-			using SlotPtr = std::shared_ptr<Slot>;
-			using SlotList = std::vector<SlotPtr>;
-			using SlotListIndex = typename SlotList::size_type;
+			using CallbackStorage = typename std::aligned_storage<InlineCallbackSize, alignof(std::max_align_t)>::type;
+			using InvokeFunction = void (*)(void* callback, Args... args);
+			using ManageFunction = void (*)(void* callback, void* destination); //< Moves the callback to destination, or destroys it if destination is null
 
 			struct Slot
 			{
-				Slot(Signal* me) :
-				signal(me)
-				{
-				}
-
-				Callback callback;
-				Signal* signal;
-				SlotListIndex index;
+				Slot() = default;
+				Slot(const Slot&) = delete;
+				Slot(Slot&& slot) noexcept;
+				~Slot();
+
+				Slot& operator=(const Slot&) = delete;
+				Slot& operator=(Slot&& slot) noexcept;
+
+				CallbackStorage callback;
+				InvokeFunction invoke = nullptr; //< Null once the slot has been disconnected while the signal is being emitted
+				ManageFunction manage = nullptr;
+				UInt32 id;
 			};
 
-			void Disconnect(const SlotPtr& slot) noexcept;
+			struct SlotId
+			{
+				UInt32 generation = 0;
+				UInt32 index;
+				bool pending;
+			};
+
+			// Connections only reference the slots through an id and its generation, disconnecting them is O(1)
+			struct SlotTable
+			{
+				std::vector<Slot> slots;
+				std::vector<Slot> pendingSlots; //< Connected while the signal is being emitted, added to the slots after it
+				std::vector<SlotId> ids;
+				std::vector<UInt32> freeIds;
+				unsigned int emissionDepth = 0;
+				bool dirty = false;
+			};
+
+			template<typename F> static void InvokeHeap(void* callback, Args... args);
+			template<typename F> static void InvokeInline(void* callback, Args... args);
+			template<typename F> static void ManageHeap(void* callback, void* destination);
+			template<typename F> static void ManageInline(void* callback, void* destination);
+
+			static void Disconnect(SlotTable& table, UInt32 id) noexcept;
+			static void FinishEmission(SlotTable& table);
+			static void ReleaseId(SlotTable& table, UInt32 id);
 
-			SlotList m_slots;
-			mutable SlotListIndex m_slotIterator;
+			std::shared_ptr<SlotTable> m_slotTable;
 	};
 
 	template<typename... Args>
@@ -97,9 +129,11 @@ namespace Nz
 			Connection& operator=(Connection&& connection) noexcept;
 
 		private:
-			Connection(const SlotPtr& slot);
+			Connection(const std::shared_ptr<SlotTable>& slotTable, UInt32 id, UInt32 generation);
 
-			std::weak_ptr<Slot> m_ptr;
+			std::weak_ptr<SlotTable> m_slotTable;
+			UInt32 m_generation = 0;
+			UInt32 m_id = 0;
 	};
 
 	template<typename... Args>
@@ -4,6 +4,7 @@
 
 #include <Nazara/Core/Signal.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/MemoryHelper.hpp>
 #include <utility>
 #include <Nazara/Core/Debug.hpp>
 
@@ -13,39 +14,61 @@ namespace Nz
 	* \ingroup core
 	* \class Nz::Signal
 	* \brief Core class that represents a signal, a list of objects waiting for its message
+	*
+	* Slots are stored contiguously with their callback, small callbacks (like member function and object pairs) living inside the slot itself.
+	* The slots are shared with their connections, which reference them by an id and are disconnected in constant time.
 	*/
 
 	/*!
-	* \brief Constructs a Signal object by default
+	* \brief Clears the list of actions attached to the signal
 	*/
 
 	template<typename... Args>
-	Signal<Args...>::Signal() :
-	m_slotIterator(0)
+	void Signal<Args...>::Clear()
 	{
-	}
+		if (!m_slotTable)
+			return;
 
-	/*!
-	* \brief Constructs a Signal object by move semantic
-	*
-	* \param signal Signal to move in this
-	*/
+		SlotTable& table = *m_slotTable;
+		if (table.emissionDepth > 0)
+		{
+			for (Slot& slot : table.slots)
+			{
+				if (slot.invoke)
+					Disconnect(table, slot.id);
+			}
+
+			for (Slot& slot : table.pendingSlots)
+			{
+				if (slot.invoke)
+					Disconnect(table, slot.id);
+			}
+		}
+		else
+		{
+			for (Slot& slot : table.slots)
+			{
+				table.ids[slot.id].generation++;
+				ReleaseId(table, slot.id);
+			}
 
-	template<typename... Args>
-	Signal<Args...>::Signal(Signal&& signal) noexcept
-	{
-		operator=(std::move(signal));
+			table.slots.clear();
+		}
 	}
 
 	/*!
-	* \brief Clears the list of actions attached to the signal
+	* \brief Connects a function to the signal
+	* \return Connection attached to the signal
+	*
+	* \param func Non-member function
 	*/
 
 	template<typename... Args>
-	void Signal<Args...>::Clear()
+	typename Signal<Args...>::Connection Signal<Args...>::Connect(const Callback& func)
 	{
-		m_slots.clear();
-		m_slotIterator = 0;
+		NazaraAssert(func, "Invalid function");
+
+		return Connect<const Callback&>(func);
 	}
 
 	/*!
@@ -56,37 +79,73 @@ namespace Nz
 	*/
 
 	template<typename... Args>
-	typename Signal<Args...>::Connection Signal<Args...>::Connect(const Callback& func)
+	typename Signal<Args...>::Connection Signal<Args...>::Connect(Callback&& func)
 	{
-		return Connect(Callback(func));
+		NazaraAssert(func, "Invalid function");
+
+		return Connect<Callback>(std::move(func));
 	}
 
 	/*!
-	* \brief Connects a function to the signal
+	* \brief Connects a callable object (function, lambda, functor) to the signal
 	* \return Connection attached to the signal
 	*
-	* \param func Non-member function
+	* \param func Callable object, stored inside the slot when it is small enough and nothrow movable (heap-allocated otherwise)
+	*
+	* \remark Slots connected while the signal is being emitted are only called from the next emission
 	*/
 
 	template<typename... Args>
-	typename Signal<Args...>::Connection Signal<Args...>::Connect(Callback&& func)
+	template<typename F>
+	typename Signal<Args...>::Connection Signal<Args...>::Connect(F&& func)
 	{
-		NazaraAssert(func, "Invalid function");
+		using FunctionType = typename std::decay<F>::type;
 
-		// Since we're incrementing the slot vector size, we need to replace our iterator at the end
-		// (Except when we are iterating on the signal)
-		bool resetIt = (m_slotIterator >= m_slots.size());
+		if (!m_slotTable)
+			m_slotTable = std::make_shared<SlotTable>();
 
-		auto tempPtr = std::make_shared<Slot>(this);
-		tempPtr->callback = std::move(func);
-		tempPtr->index = m_slots.size();
+		SlotTable& table = *m_slotTable;
 
-		m_slots.emplace_back(std::move(tempPtr));
+		UInt32 id;
+		if (!table.freeIds.empty())
+		{
+			id = table.freeIds.back();
+			table.freeIds.pop_back();
+		}
+		else
+		{
+			id = static_cast<UInt32>(table.ids.size());
+			table.ids.emplace_back();
+		}
 
-		if (resetIt)
-			m_slotIterator = m_slots.size(); //< Replace the iterator to the end
+		// Slots can't be moved while they are being called, the new one waits for the end of the emission
+		std::vector<Slot>& slots = (table.emissionDepth > 0) ? table.pendingSlots : table.slots;
 
-		return Connection(m_slots.back());
+		SlotId& slotId = table.ids[id];
+		slotId.index = static_cast<UInt32>(slots.size());
+		slotId.pending = (table.emissionDepth > 0);
+		if (slotId.pending)
+			table.dirty = true;
+
+		slots.emplace_back();
+		Slot& slot = slots.back();
+		slot.id = id;
+
+		constexpr bool isInline = sizeof(FunctionType) <= sizeof(CallbackStorage) && alignof(FunctionType) <= alignof(CallbackStorage) && std::is_nothrow_move_constructible<FunctionType>::value;
+		if (isInline)
+		{
+			PlacementNew(reinterpret_cast<FunctionType*>(&slot.callback), std::forward<F>(func));
+			slot.invoke = &InvokeInline<FunctionType>;
+			slot.manage = &ManageInline<FunctionType>;
+		}
+		else
+		{
+			*reinterpret_cast<FunctionType**>(&slot.callback) = new FunctionType(std::forward<F>(func));
+			slot.invoke = &InvokeHeap<FunctionType>;
+			slot.manage = &ManageHeap<FunctionType>;
+		}
+
+		return Connection(m_slotTable, id, slotId.generation);
 	}
 
 	/*!
@@ -101,10 +160,7 @@ namespace Nz
 	template<typename O>
 	typename Signal<Args...>::Connection Signal<Args...>::Connect(O& object, void (O::*method) (Args...))
 	{
-		return Connect([&object, method] (Args&&... args)
-		{
-			return (object .* method) (std::forward<Args>(args)...);
-		});
+		return Connect(&object, method);
 	}
 
 	/*!
@@ -119,7 +175,7 @@ namespace Nz
 	template<typename O>
 	typename Signal<Args...>::Connection Signal<Args...>::Connect(O* object, void (O::*method)(Args...))
 	{
-		return Connect([object, method] (Args&&... args)
+		return Connect([object, method] (Args... args)
 		{
 			return (object ->* method) (std::forward<Args>(args)...);
 		});
@@ -137,10 +193,7 @@ namespace Nz
 	template<typename O>
 	typename Signal<Args...>::Connection Signal<Args...>::Connect(const O& object, void (O::*method) (Args...) const)
 	{
-		return Connect([&object, method] (Args&&... args)
-		{
-			return (object .* method) (std::forward<Args>(args)...);
-		});
+		return Connect(&object, method);
 	}
 
 	/*!
@@ -155,7 +208,7 @@ namespace Nz
 	template<typename O>
 	typename Signal<Args...>::Connection Signal<Args...>::Connect(const O* object, void (O::*method)(Args...) const)
 	{
-		return Connect([object, method] (Args&&... args)
+		return Connect([object, method] (Args... args)
 		{
 			return (object ->* method) (std::forward<Args>(args)...);
 		});
@@ -165,80 +218,201 @@ namespace Nz
 	* \brief Applies the list of arguments to every callback functions
 	*
 	* \param args Arguments to send with the message
+	*
+	* \remark Slots may connect and disconnect slots (including themselves) from their callback
 	*/
 
 	template<typename... Args>
 	void Signal<Args...>::operator()(Args... args) const
 	{
-		for (m_slotIterator = 0; m_slotIterator < m_slots.size(); ++m_slotIterator)
-			m_slots[m_slotIterator]->callback(args...);
+		if (!m_slotTable)
+			return;
+
+		SlotTable& table = *m_slotTable;
+
+		table.emissionDepth++;
+
+		// Slots aren't moved while emitting, disconnected ones are only marked and connected ones are kept aside
+		std::size_t slotCount = table.slots.size();
+		for (std::size_t i = 0; i < slotCount; ++i)
+		{
+			Slot& slot = table.slots[i];
+			if (slot.invoke)
+				slot.invoke(&slot.callback, args...);
+		}
+
+		if (--table.emissionDepth == 0 && table.dirty)
+			FinishEmission(table);
+	}
+
+	template<typename... Args>
+	template<typename F>
+	void Signal<Args...>::InvokeHeap(void* callback, Args... args)
+	{
+		(**static_cast<F**>(callback))(std::forward<Args>(args)...);
+	}
+
+	template<typename... Args>
+	template<typename F>
+	void Signal<Args...>::InvokeInline(void* callback, Args... args)
+	{
+		(*static_cast<F*>(callback))(std::forward<Args>(args)...);
+	}
+
+	template<typename... Args>
+	template<typename F>
+	void Signal<Args...>::ManageHeap(void* callback, void* destination)
+	{
+		F** functor = static_cast<F**>(callback);
+		if (destination)
+			*static_cast<F**>(destination) = *functor;
+		else
+			delete *functor;
+	}
+
+	template<typename... Args>
+	template<typename F>
+	void Signal<Args...>::ManageInline(void* callback, void* destination)
+	{
+		F* functor = static_cast<F*>(callback);
+		if (destination)
+			PlacementNew(static_cast<F*>(destination), std::move(*functor));
+
+		PlacementDestroy(functor);
 	}
 
 	/*!
-	* \brief Moves the signal into this
-	* \return A reference to this
+	* \brief Disconnects a listener from a signal
 	*
-	* \param signal Signal to move in this
+	* \param table Slots of the signal
+	* \param id Identifier of the slot to disconnect, which must be connected
 	*/
 
 	template<typename... Args>
-	Signal<Args...>& Signal<Args...>::operator=(Signal&& signal) noexcept
+	void Signal<Args...>::Disconnect(SlotTable& table, UInt32 id) noexcept
 	{
-		m_slots = std::move(signal.m_slots);
-		m_slotIterator = signal.m_slotIterator;
+		NazaraAssert(id < table.ids.size(), "Invalid slot id");
 
-		// We need to update the signal pointer inside of each slot
-		for (SlotPtr& slot : m_slots)
-			slot->signal = this;
+		SlotId& slotId = table.ids[id];
+		slotId.generation++; //< Invalidates the connections to this slot
 
-		return *this;
+		std::vector<Slot>& slots = (slotId.pending) ? table.pendingSlots : table.slots;
+		NazaraAssert(slotId.index < slots.size(), "Invalid slot index");
+
+		if (table.emissionDepth > 0)
+		{
+			// The slot may be running, it is destroyed once the emission is over
+			slots[slotId.index].invoke = nullptr;
+			table.dirty = true;
+			return;
+		}
+
+		// "Swap this slot with the last one and pop" idiom
+		Slot& slot = slots[slotId.index];
+		if (&slot != &slots.back())
+		{
+			slot = std::move(slots.back());
+			table.ids[slot.id].index = slotId.index;
+		}
+
+		slots.pop_back();
+		ReleaseId(table, id);
 	}
 
 	/*!
-	* \brief Disconnects a listener from this signal
+	* \brief Destroys the slots disconnected during an emission and adds the ones connected during it
 	*
-	* \param slot Pointer to the ith listener of the signal
-	*
-	* \remark Produces a NazaraAssert if slot is invalid (nullptr)
-	* \remark Produces a NazaraAssert if index of slot is invalid
-	* \remark Produces a NazaraAssert if slot is not attached to this signal
+	* \param table Slots of the signal
 	*/
 
 	template<typename... Args>
-	void Signal<Args...>::Disconnect(const SlotPtr& slot) noexcept
+	void Signal<Args...>::FinishEmission(SlotTable& table)
 	{
-		NazaraAssert(slot, "Invalid slot pointer");
-		NazaraAssert(slot->index < m_slots.size(), "Invalid slot index");
-		NazaraAssert(slot->signal == this, "Slot is not attached to this signal");
-
-		// "Swap this slot with the last one and pop" idiom
-		// This will preserve slot indexes
+		std::size_t slotCount = 0;
+		for (std::size_t i = 0; i < table.slots.size(); ++i)
+		{
+			Slot& slot = table.slots[i];
+			if (!slot.invoke)
+			{
+				ReleaseId(table, slot.id);
+				continue;
+			}
+
+			if (i != slotCount)
+			{
+				table.slots[slotCount] = std::move(slot);
+				table.ids[table.slots[slotCount].id].index = static_cast<UInt32>(slotCount);
+			}
+
+			slotCount++;
+		}
+		table.slots.erase(table.slots.begin() + slotCount, table.slots.end());
 
-		// Can we safely "remove" this slot?
-		if (m_slotIterator >= (m_slots.size() - 1) || slot->index > m_slotIterator)
+		for (Slot& slot : table.pendingSlots)
 		{
-			// Yes we can
-			SlotPtr& newSlot = m_slots[slot->index];
-			newSlot = std::move(m_slots.back());
-			newSlot->index = slot->index; //< Update the moved slot index before resizing (in case it's the last one)
+			if (!slot.invoke)
+			{
+				ReleaseId(table, slot.id);
+				continue;
+			}
+
+			SlotId& slotId = table.ids[slot.id];
+			slotId.index = static_cast<UInt32>(table.slots.size());
+			slotId.pending = false;
+
+			table.slots.emplace_back(std::move(slot));
 		}
-		else
+		table.pendingSlots.clear();
+
+		table.dirty = false;
+	}
+
+	template<typename... Args>
+	void Signal<Args...>::ReleaseId(SlotTable& table, UInt32 id)
+	{
+		table.freeIds.push_back(id);
+	}
+
+	template<typename... Args>
+	Signal<Args...>::Slot::Slot(Slot&& slot) noexcept :
+	invoke(slot.invoke),
+	manage(slot.manage),
+	id(slot.id)
+	{
+		if (manage)
+			manage(&slot.callback, &callback);
+
+		slot.invoke = nullptr;
+		slot.manage = nullptr;
+	}
+
+	template<typename... Args>
+	Signal<Args...>::Slot::~Slot()
+	{
+		if (manage)
+			manage(&callback, nullptr);
+	}
+
+	template<typename... Args>
+	typename Signal<Args...>::Slot& Signal<Args...>::Slot::operator=(Slot&& slot) noexcept
+	{
+		if (&slot != this)
 		{
-			// Nope, let's be tricky
-			SlotPtr& current = m_slots[m_slotIterator];
-			SlotPtr& newSlot = m_slots[slot->index];
+			if (manage)
+				manage(&callback, nullptr);
 
-			newSlot = std::move(current);
-			newSlot->index = slot->index; //< Update the moved slot index
+			invoke = slot.invoke;
+			manage = slot.manage;
+			id = slot.id;
 
-			current = std::move(m_slots.back());
-			current->index = m_slotIterator; //< Update the moved slot index
+			if (manage)
+				manage(&slot.callback, &callback);
 
-			--m_slotIterator;
+			slot.invoke = nullptr;
+			slot.manage = nullptr;
 		}
 
-		// Pop the last entry (from where we moved our slot)
-		m_slots.pop_back();
+		return *this;
 	}
 
 	/*!
@@ -253,20 +427,26 @@ namespace Nz
 	*/
 	template<typename... Args>
 	Signal<Args...>::Connection::Connection(Connection&& connection) noexcept :
-	m_ptr(std::move(connection.m_ptr))
+	m_slotTable(std::move(connection.m_slotTable)),
+	m_generation(connection.m_generation),
+	m_id(connection.m_id)
 	{
-		connection.m_ptr.reset(); //< Fuck you GCC 4.9
+		connection.m_slotTable.reset(); //< Fuck you GCC 4.9
 	}
-	
+
 	/*!
 	* \brief Constructs a Signal::Connection object with a slot
 	*
-	* \param slot Slot of the listener
+	* \param slotTable Slots of the signal
+	* \param id Identifier of the slot
+	* \param generation Generation of the identifier, changed when the slot is disconnected
 	*/
 
 	template<typename... Args>
-	Signal<Args...>::Connection::Connection(const SlotPtr& slot) :
-	m_ptr(slot)
+	Signal<Args...>::Connection::Connection(const std::shared_ptr<SlotTable>& slotTable, UInt32 id, UInt32 generation) :
+	m_slotTable(slotTable),
+	m_generation(generation),
+	m_id(id)
 	{
 	}
 
@@ -291,8 +471,13 @@ namespace Nz
 	template<typename... Args>
 	void Signal<Args...>::Connection::Disconnect() noexcept
 	{
-		if (SlotPtr ptr = m_ptr.lock())
-			ptr->signal->Disconnect(ptr);
+		if (std::shared_ptr<SlotTable> slotTable = m_slotTable.lock())
+		{
+			if (slotTable->ids[m_id].generation == m_generation)
+				Signal::Disconnect(*slotTable, m_id);
+		}
+
+		m_slotTable.reset();
 	}
 
 	/*!
@@ -303,7 +488,8 @@ namespace Nz
 	template<typename... Args>
 	bool Signal<Args...>::Connection::IsConnected() const
 	{
-		return !m_ptr.expired();
+		std::shared_ptr<SlotTable> slotTable = m_slotTable.lock();
+		return slotTable && slotTable->ids[m_id].generation == m_generation;
 	}
 
 	/*!
@@ -314,12 +500,14 @@ namespace Nz
 	template<typename... Args>
 	typename Signal<Args...>::Connection& Signal<Args...>::Connection::operator=(Connection&& connection) noexcept
 	{
-		m_ptr = std::move(connection.m_ptr);
-		connection.m_ptr.reset(); //< Fuck you GCC 4.9
+		m_slotTable = std::move(connection.m_slotTable);
+		m_generation = connection.m_generation;
+		m_id = connection.m_id;
+		connection.m_slotTable.reset(); //< Fuck you GCC 4.9
 
 		return *this;
 	}
-	
+
 	/*!
 	* \class Nz::Signal::ConnectionGuard
 	* \brief Core class that represents a RAII for a connection attached to a signal
@@ -0,0 +1,104 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_SIMDDISPATCHER_HPP
+#define NAZARA_SIMDDISPATCHER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Enums.hpp>
+#include <array>
+#include <type_traits>
+
+// Kernels of a target live in their own translation unit (e.g. Foo_AVX2.cpp), their functions being compiled for it with these attributes
+#if defined(NAZARA_SIMD_SSE2)
+	#define NAZARA_SIMD_DISPATCH_X86
+
+	#if defined(NAZARA_COMPILER_MSVC)
+		#define NAZARA_SIMD_TARGET_SSE41
+		#define NAZARA_SIMD_TARGET_AVX2
+		#define NAZARA_SIMD_TARGET_AVX512
+	#else
+		#define NAZARA_SIMD_TARGET_SSE41 __attribute__((target("ssse3,sse4.1")))
+		#define NAZARA_SIMD_TARGET_AVX2 __attribute__((target("avx2,fma")))
+		#define NAZARA_SIMD_TARGET_AVX512 __attribute__((target("avx2,fma,avx512f,avx512bw,avx512dq,avx512vl")))
+	#endif
+#endif
+
+namespace Nz
+{
+	class SimdKernelBase;
+
+	class NAZARA_CORE_API SimdDispatcher
+	{
+		friend class Core;
+		friend SimdKernelBase;
+
+		public:
+			SimdDispatcher() = delete;
+			~SimdDispatcher() = delete;
+
+			static SimdTarget GetTarget();
+			static SimdTarget GetTargetLimit();
+
+			static bool IsInitialized();
+
+			static void SetTargetLimit(SimdTarget limit);
+
+		private:
+			static bool Initialize();
+			static void Register(SimdKernelBase* kernel);
+			static void ResolveKernels();
+			static void Uninitialize();
+			static void Unregister(SimdKernelBase* kernel);
+	};
+
+	class NAZARA_CORE_API SimdKernelBase
+	{
+		friend SimdDispatcher;
+
+		public:
+			SimdKernelBase(const SimdKernelBase&) = delete;
+			SimdKernelBase(SimdKernelBase&&) = delete;
+
+			SimdKernelBase& operator=(const SimdKernelBase&) = delete;
+			SimdKernelBase& operator=(SimdKernelBase&&) = delete;
+
+		protected:
+			SimdKernelBase();
+			~SimdKernelBase();
+
+			virtual void Resolve(SimdTarget target) = 0;
+	};
+
+	template<typename F>
+	class SimdKernel : public SimdKernelBase
+	{
+		static_assert(std::is_pointer<F>::value && std::is_function<std::remove_pointer_t<F>>::value, "Kernels must be function pointers");
+
+		public:
+			explicit SimdKernel(F scalarFunction);
+			~SimdKernel() = default;
+
+			inline F Get() const;
+			F Get(SimdTarget target) const;
+			inline SimdTarget GetTarget() const;
+
+			void Register(SimdTarget target, F function);
+
+			template<typename... Args> decltype(auto) operator()(Args&&... args) const;
+
+		private:
+			void Resolve(SimdTarget target) override;
+
+			std::array<F, SimdTarget_Max + 1> m_functions;
+			F m_function;
+			SimdTarget m_target;
+	};
+}
+
+#include <Nazara/Core/SimdDispatcher.inl>
+
+#endif // NAZARA_SIMDDISPATCHER_HPP
@@ -0,0 +1,136 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/HardwareInfo.hpp>
+#include <utility>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::SimdKernel
+	* \brief Core class that holds the implementations of a kernel for each SIMD target, calling the best one the processor supports
+	*
+	* \remark The implementation is selected when the kernel is created or registers a function, and again when the Core module is initialized
+	*
+	* \see SimdDispatcher
+	*/
+
+	/*!
+	* \brief Constructs a kernel with its scalar implementation
+	*
+	* \param scalarFunction Implementation used when no other target is supported
+	*/
+
+	template<typename F>
+	SimdKernel<F>::SimdKernel(F scalarFunction)
+	{
+		NazaraAssert(scalarFunction, "Invalid scalar function");
+
+		m_functions.fill(nullptr);
+		m_functions[SimdTarget_Scalar] = scalarFunction;
+
+		Resolve(SimdDispatcher::GetTarget());
+	}
+
+	/*!
+	* \brief Gets the selected implementation
+	* \return Function of the best registered target supported by the processor
+	*/
+
+	template<typename F>
+	F SimdKernel<F>::Get() const
+	{
+		return m_function;
+	}
+
+	/*!
+	* \brief Gets the implementation to use for a target
+	* \return Function of the best registered target up to this one supported by the processor
+	*
+	* \param target Best target allowed
+	*/
+
+	template<typename F>
+	F SimdKernel<F>::Get(SimdTarget target) const
+	{
+		NazaraAssert(target <= SimdTarget_Max, "SIMD target out of enum");
+
+		for (int i = target; i > SimdTarget_Scalar; --i)
+		{
+			SimdTarget candidate = static_cast<SimdTarget>(i);
+			if (m_functions[candidate] && HardwareInfo::IsSimdTargetSupported(candidate))
+				return m_functions[candidate];
+		}
+
+		return m_functions[SimdTarget_Scalar];
+	}
+
+	/*!
+	* \brief Gets the target of the selected implementation
+	* \return Target of the function returned by Get()
+	*/
+
+	template<typename F>
+	SimdTarget SimdKernel<F>::GetTarget() const
+	{
+		return m_target;
+	}
+
+	/*!
+	* \brief Registers the implementation of a target
+	*
+	* \param target Target the function has been compiled for
+	* \param function Implementation, giving the same results as the scalar one
+	*
+	* \remark Should be called before kernels are used from multiple threads (typically when initializing a module)
+	*/
+
+	template<typename F>
+	void SimdKernel<F>::Register(SimdTarget target, F function)
+	{
+		NazaraAssert(target <= SimdTarget_Max, "SIMD target out of enum");
+		NazaraAssert(target != SimdTarget_Scalar || function, "Scalar function cannot be removed");
+
+		m_functions[target] = function;
+
+		Resolve(SimdDispatcher::GetTarget());
+	}
+
+	/*!
+	* \brief Calls the selected implementation
+	* \return Result of the call
+	*
+	* \param args Arguments to forward
+	*/
+
+	template<typename F>
+	template<typename... Args>
+	decltype(auto) SimdKernel<F>::operator()(Args&&... args) const
+	{
+		return m_function(std::forward<Args>(args)...);
+	}
+
+	template<typename F>
+	void SimdKernel<F>::Resolve(SimdTarget target)
+	{
+		for (int i = target; i > SimdTarget_Scalar; --i)
+		{
+			SimdTarget candidate = static_cast<SimdTarget>(i);
+			if (m_functions[candidate] && HardwareInfo::IsSimdTargetSupported(candidate))
+			{
+				m_function = m_functions[candidate];
+				m_target = candidate;
+				return;
+			}
+		}
+
+		m_function = m_functions[SimdTarget_Scalar];
+		m_target = SimdTarget_Scalar;
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
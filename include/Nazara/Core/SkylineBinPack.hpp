@@ -0,0 +1,69 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_SKYLINEBINPACK_HPP
+#define NAZARA_SKYLINEBINPACK_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Math/Rect.hpp>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_CORE_API SkylineBinPack
+	{
+		public:
+			SkylineBinPack();
+			SkylineBinPack(unsigned int width, unsigned int height);
+			SkylineBinPack(const Vector2ui& size);
+			SkylineBinPack(const SkylineBinPack&) = default;
+			SkylineBinPack(SkylineBinPack&&) = default;
+			~SkylineBinPack() = default;
+
+			void Clear();
+
+			void Expand(unsigned int newWidth, unsigned newHeight);
+			void Expand(const Vector2ui& newSize);
+
+			void FreeRectangle(const Rectui& rect);
+
+			unsigned int GetHeight() const;
+			float GetOccupancy() const;
+			Vector2ui GetSize() const;
+			std::size_t GetSegmentCount() const;
+			unsigned int GetWidth() const;
+
+			bool Insert(Rectui* rects, unsigned int count);
+			bool Insert(Rectui* rects, bool* flipped, unsigned int count);
+			bool Insert(Rectui* rects, bool* flipped, bool* inserted, unsigned int count);
+
+			void Reset();
+			void Reset(unsigned int width, unsigned int height);
+			void Reset(const Vector2ui& size);
+
+			SkylineBinPack& operator=(const SkylineBinPack&) = default;
+			SkylineBinPack& operator=(SkylineBinPack&&) = default;
+
+		private:
+			struct Segment
+			{
+				unsigned int x;
+				unsigned int y;
+				unsigned int width;
+			};
+
+			bool FindPosition(unsigned int width, unsigned int height, std::size_t* segmentIndex, unsigned int* y, unsigned int* waste) const;
+			bool FitsAt(std::size_t segmentIndex, unsigned int width, unsigned int height, unsigned int* y, unsigned int* waste) const;
+			void Place(std::size_t segmentIndex, unsigned int width, unsigned int top);
+
+			std::vector<Segment> m_skyline;
+			unsigned int m_height;
+			unsigned int m_usedArea;
+			unsigned int m_width;
+	};
+}
+
+#endif // NAZARA_SKYLINEBINPACK_HPP
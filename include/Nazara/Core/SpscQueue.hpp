@@ -0,0 +1,45 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_SPSCQUEUE_HPP
+#define NAZARA_SPSCQUEUE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <atomic>
+#include <memory>
+
+namespace Nz
+{
+	template<typename T>
+	class SpscQueue
+	{
+		public:
+			explicit SpscQueue(std::size_t capacity);
+			SpscQueue(const SpscQueue&) = delete;
+			SpscQueue(SpscQueue&& queue) noexcept;
+			~SpscQueue() = default;
+
+			inline std::size_t GetCapacity() const;
+
+			inline bool IsEmpty() const;
+
+			bool Pop(T* value);
+			bool Push(const T& value);
+
+			SpscQueue& operator=(const SpscQueue&) = delete;
+			SpscQueue& operator=(SpscQueue&& queue) noexcept;
+
+		private:
+			std::unique_ptr<T[]> m_values;
+			std::size_t m_mask;
+			alignas(64) std::atomic<std::size_t> m_readIndex;
+			alignas(64) std::atomic<std::size_t> m_writeIndex;
+	};
+}
+
+#include <Nazara/Core/SpscQueue.inl>
+
+#endif // NAZARA_SPSCQUEUE_HPP
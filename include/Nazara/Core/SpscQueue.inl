@@ -0,0 +1,135 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/SpscQueue.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::SpscQueue
+	* \brief Core class that represents a bounded lock-free queue between one producer thread and one consumer thread
+	*
+	* Values are stored in a ring buffer, pushing and popping only cost an atomic load and an atomic store.
+	*
+	* \remark Only one thread may push and only one (other) thread may pop at the same time
+	*/
+
+	/*!
+	* \brief Constructs a SpscQueue object
+	*
+	* \param capacity Maximum number of values in the queue, rounded up to a power of two
+	*/
+	template<typename T>
+	SpscQueue<T>::SpscQueue(std::size_t capacity) :
+	m_readIndex(0),
+	m_writeIndex(0)
+	{
+		NazaraAssert(capacity > 0, "Capacity must be over zero");
+
+		std::size_t size = 1;
+		while (size < capacity)
+			size <<= 1;
+
+		m_values.reset(new T[size]);
+		m_mask = size - 1;
+	}
+
+	/*!
+	* \brief Constructs a SpscQueue object by move semantic
+	*
+	* \param queue Queue to move into this, which must not be used by another thread meanwhile
+	*/
+	template<typename T>
+	SpscQueue<T>::SpscQueue(SpscQueue&& queue) noexcept :
+	m_values(std::move(queue.m_values)),
+	m_mask(queue.m_mask),
+	m_readIndex(queue.m_readIndex.load(std::memory_order_relaxed)),
+	m_writeIndex(queue.m_writeIndex.load(std::memory_order_relaxed))
+	{
+	}
+
+	/*!
+	* \brief Gets the maximum number of values in the queue
+	* \return Capacity of the queue
+	*/
+	template<typename T>
+	inline std::size_t SpscQueue<T>::GetCapacity() const
+	{
+		return m_mask + 1;
+	}
+
+	/*!
+	* \brief Checks whether the queue is empty
+	* \return true If there is no value to pop
+	*
+	* \remark The result may already be outdated when another thread uses the queue
+	*/
+	template<typename T>
+	inline bool SpscQueue<T>::IsEmpty() const
+	{
+		return m_readIndex.load(std::memory_order_acquire) == m_writeIndex.load(std::memory_order_acquire);
+	}
+
+	/*!
+	* \brief Pops the oldest value of the queue, should only be called by the consumer thread
+	* \return true If a value was popped
+	*
+	* \param value Pointer receiving the value
+	*/
+	template<typename T>
+	bool SpscQueue<T>::Pop(T* value)
+	{
+		NazaraAssert(value, "Invalid value");
+
+		std::size_t readIndex = m_readIndex.load(std::memory_order_relaxed);
+		if (readIndex == m_writeIndex.load(std::memory_order_acquire))
+			return false;
+
+		*value = std::move(m_values[readIndex & m_mask]);
+		m_readIndex.store(readIndex + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	/*!
+	* \brief Pushes a value at the end of the queue, should only be called by the producer thread
+	* \return true If the value was pushed, false if the queue is full
+	*
+	* \param value Value to push
+	*/
+	template<typename T>
+	bool SpscQueue<T>::Push(const T& value)
+	{
+		std::size_t writeIndex = m_writeIndex.load(std::memory_order_relaxed);
+		if (writeIndex - m_readIndex.load(std::memory_order_acquire) > m_mask)
+			return false;
+
+		m_values[writeIndex & m_mask] = value;
+		m_writeIndex.store(writeIndex + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	/*!
+	* \brief Moves the queue into this
+	* \return A reference to this
+	*
+	* \param queue Queue to move into this, neither of them may be used by another thread meanwhile
+	*/
+	template<typename T>
+	SpscQueue<T>& SpscQueue<T>::operator=(SpscQueue&& queue) noexcept
+	{
+		m_values = std::move(queue.m_values);
+		m_mask = queue.m_mask;
+		m_readIndex.store(queue.m_readIndex.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		m_writeIndex.store(queue.m_writeIndex.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+		return *this;
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
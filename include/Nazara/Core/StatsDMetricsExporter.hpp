@@ -0,0 +1,32 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_STATSDMETRICSEXPORTER_HPP
+#define NAZARA_STATSDMETRICSEXPORTER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/AbstractMetricsExporter.hpp>
+#include <unordered_map>
+
+namespace Nz
+{
+	class NAZARA_CORE_API StatsDMetricsExporter : public AbstractMetricsExporter
+	{
+		public:
+			StatsDMetricsExporter(String prefix = String());
+			~StatsDMetricsExporter() = default;
+
+			String Export(const std::vector<Metrics::Sample>& samples) override;
+
+			const String& GetPrefix() const;
+
+		private:
+			std::unordered_map<String, double> m_exportedCounters;
+			String m_prefix;
+	};
+}
+
+#endif // NAZARA_STATSDMETRICSEXPORTER_HPP
@@ -31,6 +31,7 @@ namespace Nz
 
 			virtual UInt64 GetCursorPos() const = 0;
 			virtual String GetDirectory() const;
+			virtual const void* GetMappedPointer() const;
 			virtual String GetPath() const;
 			inline OpenModeFlags GetOpenMode() const;
 			inline StreamOptionFlags GetStreamOptions() const;
@@ -11,6 +11,7 @@
 #include <Nazara/Core/Endianness.hpp>
 #include <Nazara/Core/TypeTag.hpp>
 #include <cstdarg>
+#include <cstring>
 #include <iosfwd>
 #include <memory>
 #include <string>
@@ -41,9 +42,9 @@ namespace Nz
 			String(const char* string);
 			String(const char* string, std::size_t length);
 			String(const std::string& string);
-			String(const String& string) = default;
+			String(const String& string);
 			inline String(String&& string) noexcept;
-			~String() = default;
+			inline ~String();
 
 			String& Append(char character);
 			String& Append(const char* string);
@@ -303,26 +304,29 @@ namespace Nz
 			static const std::size_t npos;
 
 		private:
-			struct SharedString;
-
-			String(std::shared_ptr<SharedString>&& sharedString);
-
+			inline void AllocateString(std::size_t size);
+			void AllocateString(std::size_t size, std::size_t capacity);
 			void EnsureOwnership(bool discardContent = false);
-			inline void ReleaseString();
+			inline bool IsLocal() const;
+			inline void MoveString(String& string) noexcept;
+			void ReleaseString();
 
-			static const std::shared_ptr<SharedString>& GetEmptyString();
-
-			std::shared_ptr<SharedString> m_sharedString;
+			static constexpr std::size_t LocalCapacity = 23;
 
+			// Long strings are shared between copies until one of them is modified, by a block holding the characters after it
 			struct SharedString
 			{
-				inline SharedString();
-				inline SharedString(std::size_t strSize);
-				inline SharedString(std::size_t strSize, std::size_t strCapacity);
-
 				std::size_t capacity;
-				std::size_t size;
-				std::unique_ptr<char[]> string;
+				std::size_t refCount; //< Not atomic, a string and its copies are not meant to be shared between threads
+			};
+
+			char* m_string = m_localString; //< m_localString, or the characters of m_sharedString for strings too long to fit in it
+			std::size_t m_size = 0;
+
+			union
+			{
+				char m_localString[LocalCapacity + 1] = {};
+				SharedString* m_sharedString;
 			};
 	};
 
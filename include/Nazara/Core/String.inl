@@ -7,15 +7,19 @@
 
 namespace Nz
 {
-	inline Nz::String::String(String&& string) noexcept :
-	m_sharedString(std::move(string.m_sharedString))
+	inline String::String(String&& string) noexcept
 	{
-		string.m_sharedString = GetEmptyString();
+		MoveString(string);
 	}
 
-	inline String::String(std::shared_ptr<SharedString>&& sharedString) :
-	m_sharedString(std::move(sharedString))
+	/*!
+	* \brief Destructs the string, releasing its characters if it was the last one sharing them
+	*/
+
+	inline String::~String()
 	{
+		if (!IsLocal() && --m_sharedString->refCount == 0)
+			::operator delete(m_sharedString);
 	}
 
 	/*!
@@ -36,51 +40,50 @@ namespace Nz
 	}
 
 	/*!
-	* \brief Releases the content to the string
+	* \brief Allocates the characters of a string, releasing its previous ones
+	*
+	* \param size Number of characters in the string, whose content is left uninitialized
 	*/
 
-	inline void String::ReleaseString()
+	inline void String::AllocateString(std::size_t size)
 	{
-		m_sharedString = std::move(GetEmptyString());
+		AllocateString(size, size);
 	}
 
 	/*!
-	* \brief Constructs a SharedString object by default
+	* \brief Checks whether the characters are stored in the string itself
+	* \return true if it is the case
 	*/
 
-	inline String::SharedString::SharedString() : // Special case: empty string
-	capacity(0),
-	size(0)
+	inline bool String::IsLocal() const
 	{
+		return m_string == m_localString;
 	}
 
 	/*!
-	* \brief Constructs a SharedString object with a size
+	* \brief Takes the characters of another string, leaving it empty
 	*
-	* \param strSize Number of characters in the string
+	* \param string String to move, which must not be this one
+	*
+	* \remark The characters of this string must have been released
 	*/
 
-	inline String::SharedString::SharedString(std::size_t strSize) :
-	capacity(strSize),
-	size(strSize),
-	string(new char[strSize + 1])
+	inline void String::MoveString(String& string) noexcept
 	{
-		string[strSize] = '\0';
-	}
+		m_size = string.m_size;
 
-	/*!
-	* \brief Constructs a SharedString object with a size and a capacity
-	*
-	* \param strSize Number of characters in the string
-	* \param strCapacity Capacity in characters in the string
-	*/
+		if (string.IsLocal())
+			std::memcpy(m_localString, string.m_localString, sizeof(m_localString));
+		else
+		{
+			m_sharedString = string.m_sharedString;
+			m_string = string.m_string;
 
-	inline String::SharedString::SharedString(std::size_t strSize, std::size_t strCapacity) :
-	capacity(strCapacity),
-	size(strSize),
-	string(new char[strCapacity + 1])
-	{
-		string[strSize] = '\0';
+			string.m_string = string.m_localString;
+		}
+
+		string.m_localString[0] = '\0';
+		string.m_size = 0;
 	}
 
 	/*!
@@ -0,0 +1,78 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_STRINGVIEW_HPP
+#define NAZARA_STRINGVIEW_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/String.hpp>
+#include <functional>
+#include <string>
+
+namespace Nz
+{
+	class StringView
+	{
+		public:
+			inline StringView();
+			inline StringView(const char* string);
+			inline StringView(const char* string, std::size_t size);
+			inline StringView(const std::string& string);
+			inline StringView(const String& string);
+			StringView(const StringView&) = default;
+			~StringView() = default;
+
+			inline int Compare(StringView string, UInt32 flags = String::None) const;
+
+			inline bool EndsWith(StringView string, UInt32 flags = String::None) const;
+
+			inline std::size_t Find(char character, std::size_t start = 0) const;
+			inline std::size_t Find(StringView string, std::size_t start = 0) const;
+
+			inline const char* GetConstBuffer() const;
+			inline std::size_t GetSize() const;
+
+			inline bool IsEmpty() const;
+
+			inline bool StartsWith(StringView string, UInt32 flags = String::None) const;
+
+			inline StringView SubString(std::intmax_t startPos, std::intmax_t endPos = -1) const;
+
+			inline String ToString() const;
+
+			inline StringView Trimmed() const;
+
+			inline const char* begin() const;
+			inline const char* end() const;
+
+			inline char operator[](std::size_t pos) const;
+
+			StringView& operator=(const StringView&) = default;
+
+			inline bool operator==(StringView string) const;
+			inline bool operator!=(StringView string) const;
+			inline bool operator<(StringView string) const;
+
+		private:
+			const char* m_string;
+			std::size_t m_size;
+	};
+
+	inline bool operator==(const char* string, StringView view);
+	inline bool operator==(const String& string, StringView view);
+	inline bool operator!=(const char* string, StringView view);
+	inline bool operator!=(const String& string, StringView view);
+}
+
+namespace std
+{
+	template<>
+	struct hash<Nz::StringView>;
+}
+
+#include <Nazara/Core/StringView.inl>
+
+#endif // NAZARA_STRINGVIEW_HPP
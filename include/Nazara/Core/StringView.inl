@@ -0,0 +1,405 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Error.hpp>
+#include <algorithm>
+#include <cstring>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		inline char ToLowerAscii(char character)
+		{
+			return (character >= 'A' && character <= 'Z') ? static_cast<char>(character + ('a' - 'A')) : character;
+		}
+
+		inline int CompareCharacters(const char* first, const char* second, std::size_t size, UInt32 flags)
+		{
+			if (flags & String::CaseInsensitive)
+			{
+				for (std::size_t i = 0; i < size; ++i)
+				{
+					int diff = static_cast<unsigned char>(ToLowerAscii(first[i])) - static_cast<unsigned char>(ToLowerAscii(second[i]));
+					if (diff != 0)
+						return diff;
+				}
+
+				return 0;
+			}
+			else
+				return (size > 0) ? std::memcmp(first, second, size) : 0;
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::StringView
+	* \brief Core class that refers to characters owned by something else, a String or a text being parsed for example
+	*
+	* A view doesn't allocate anything and isn't null-terminated, it must not outlive the characters it refers to
+	*/
+
+	/*!
+	* \brief Constructs an empty StringView object
+	*/
+	inline StringView::StringView() :
+	m_string(""),
+	m_size(0)
+	{
+	}
+
+	/*!
+	* \brief Constructs a StringView object referring to a "C string"
+	*
+	* \param string Null-terminated string, or nullptr
+	*/
+	inline StringView::StringView(const char* string) :
+	m_string((string) ? string : ""),
+	m_size((string) ? std::strlen(string) : 0)
+	{
+	}
+
+	/*!
+	* \brief Constructs a StringView object referring to characters
+	*
+	* \param string Characters to refer to
+	* \param size Number of characters
+	*/
+	inline StringView::StringView(const char* string, std::size_t size) :
+	m_string(string),
+	m_size(size)
+	{
+	}
+
+	/*!
+	* \brief Constructs a StringView object referring to the characters of a std::string
+	*
+	* \param string String to refer to
+	*/
+	inline StringView::StringView(const std::string& string) :
+	m_string(string.data()),
+	m_size(string.size())
+	{
+	}
+
+	/*!
+	* \brief Constructs a StringView object referring to the characters of a String
+	*
+	* \param string String to refer to, whose characters must not be modified while they are viewed
+	*/
+	inline StringView::StringView(const String& string) :
+	m_string(string.GetConstBuffer()),
+	m_size(string.GetSize())
+	{
+	}
+
+	/*!
+	* \brief Compares the view to another one
+	* \return A negative value if this view comes before the other one, a positive value if it comes after and zero if they are equal
+	*
+	* \param string View to compare to
+	* \param flags String::CaseInsensitive to compare ASCII letters regardless of their case
+	*/
+	inline int StringView::Compare(StringView string, UInt32 flags) const
+	{
+		int result = Detail::CompareCharacters(m_string, string.m_string, std::min(m_size, string.m_size), flags);
+		if (result != 0)
+			return result;
+
+		return (m_size < string.m_size) ? -1 : (m_size > string.m_size) ? 1 : 0;
+	}
+
+	/*!
+	* \brief Checks whether the view ends with another one
+	* \return true if it is the case
+	*
+	* \param string Ending to check
+	* \param flags String::CaseInsensitive to compare ASCII letters regardless of their case
+	*/
+	inline bool StringView::EndsWith(StringView string, UInt32 flags) const
+	{
+		if (string.m_size > m_size)
+			return false;
+
+		return Detail::CompareCharacters(&m_string[m_size - string.m_size], string.m_string, string.m_size, flags) == 0;
+	}
+
+	/*!
+	* \brief Finds the first occurence of a character in the view
+	* \return Index of the character, String::npos if it was not found
+	*
+	* \param character Character to find
+	* \param start Index to begin the search
+	*/
+	inline std::size_t StringView::Find(char character, std::size_t start) const
+	{
+		if (start >= m_size)
+			return String::npos;
+
+		const void* found = std::memchr(&m_string[start], character, m_size - start);
+		return (found) ? static_cast<const char*>(found) - m_string : String::npos;
+	}
+
+	/*!
+	* \brief Finds the first occurence of another view in the view
+	* \return Index of the first character of the occurence, String::npos if it was not found
+	*
+	* \param string View to find
+	* \param start Index to begin the search
+	*/
+	inline std::size_t StringView::Find(StringView string, std::size_t start) const
+	{
+		if (start > m_size || string.m_size > m_size - start)
+			return String::npos;
+
+		const char* found = std::search(&m_string[start], m_string + m_size, string.m_string, string.m_string + string.m_size);
+		return (found != m_string + m_size || string.m_size == 0) ? found - m_string : String::npos;
+	}
+
+	/*!
+	* \brief Gets the characters of the view
+	* \return Pointer to the first character, it is not null-terminated
+	*/
+	inline const char* StringView::GetConstBuffer() const
+	{
+		return m_string;
+	}
+
+	/*!
+	* \brief Gets the size of the view
+	* \return Number of characters (bytes)
+	*/
+	inline std::size_t StringView::GetSize() const
+	{
+		return m_size;
+	}
+
+	/*!
+	* \brief Checks whether the view is empty
+	* \return true if it is the case
+	*/
+	inline bool StringView::IsEmpty() const
+	{
+		return m_size == 0;
+	}
+
+	/*!
+	* \brief Checks whether the view starts with another one
+	* \return true if it is the case
+	*
+	* \param string Beginning to check
+	* \param flags String::CaseInsensitive to compare ASCII letters regardless of their case
+	*/
+	inline bool StringView::StartsWith(StringView string, UInt32 flags) const
+	{
+		if (string.m_size > m_size)
+			return false;
+
+		return Detail::CompareCharacters(m_string, string.m_string, string.m_size, flags) == 0;
+	}
+
+	/*!
+	* \brief Gets a part of the view, without copying it
+	* \return View of the part
+	*
+	* \param startPos Index of the first character, negative to count from the end
+	* \param endPos Index of the last character (included), negative to count from the end
+	*
+	* \see String::SubString
+	*/
+	inline StringView StringView::SubString(std::intmax_t startPos, std::intmax_t endPos) const
+	{
+		if (startPos < 0)
+			startPos = std::max<std::intmax_t>(m_size + startPos, 0);
+
+		if (endPos < 0)
+		{
+			endPos = m_size + endPos;
+			if (endPos < 0)
+				return StringView();
+		}
+
+		std::size_t start = static_cast<std::size_t>(startPos);
+		if (start >= m_size)
+			return StringView();
+
+		std::size_t minEnd = std::min(static_cast<std::size_t>(endPos), m_size - 1);
+		if (start > minEnd)
+			return StringView();
+
+		return StringView(&m_string[start], minEnd - start + 1);
+	}
+
+	/*!
+	* \brief Copies the characters of the view into a string
+	* \return String holding a copy of the characters
+	*/
+	inline String StringView::ToString() const
+	{
+		return String(m_string, m_size);
+	}
+
+	/*!
+	* \brief Gets the view without its leading and trailing blanks (spaces, tabulations and line endings)
+	* \return Trimmed view
+	*/
+	inline StringView StringView::Trimmed() const
+	{
+		auto IsBlank = [] (char character)
+		{
+			return character == ' ' || character == '\t' || character == '\r' || character == '\n';
+		};
+
+		std::size_t start = 0;
+		while (start < m_size && IsBlank(m_string[start]))
+			start++;
+
+		std::size_t end = m_size;
+		while (end > start && IsBlank(m_string[end - 1]))
+			end--;
+
+		return StringView(&m_string[start], end - start);
+	}
+
+	/*!
+	* \brief Gets the first character of the view
+	* \return Pointer to the first character
+	*/
+	inline const char* StringView::begin() const
+	{
+		return m_string;
+	}
+
+	/*!
+	* \brief Gets the end of the view
+	* \return Pointer past the last character
+	*/
+	inline const char* StringView::end() const
+	{
+		return m_string + m_size;
+	}
+
+	/*!
+	* \brief Gets a character of the view
+	* \return Character at the index
+	*
+	* \param pos Index of the character, which must be lower than the size
+	*/
+	inline char StringView::operator[](std::size_t pos) const
+	{
+		NazaraAssert(pos < m_size, "Index out of range");
+
+		return m_string[pos];
+	}
+
+	/*!
+	* \brief Checks whether the view is equal to another one
+	* \return true if they have the same characters
+	*
+	* \param string View to compare to
+	*/
+	inline bool StringView::operator==(StringView string) const
+	{
+		return m_size == string.m_size && Detail::CompareCharacters(m_string, string.m_string, m_size, String::None) == 0;
+	}
+
+	/*!
+	* \brief Checks whether the view is different from another one
+	* \return true if they don't have the same characters
+	*
+	* \param string View to compare to
+	*/
+	inline bool StringView::operator!=(StringView string) const
+	{
+		return !operator==(string);
+	}
+
+	/*!
+	* \brief Checks whether the view comes before another one, in lexicographical order
+	* \return true if it is the case
+	*
+	* \param string View to compare to
+	*/
+	inline bool StringView::operator<(StringView string) const
+	{
+		return Compare(string) < 0;
+	}
+
+	/*!
+	* \brief Checks whether a "C string" is equal to a view
+	* \return true if they have the same characters
+	*
+	* \param string String to compare
+	* \param view View to compare
+	*/
+	inline bool operator==(const char* string, StringView view)
+	{
+		return view == StringView(string);
+	}
+
+	/*!
+	* \brief Checks whether a string is equal to a view
+	* \return true if they have the same characters
+	*
+	* \param string String to compare
+	* \param view View to compare
+	*/
+	inline bool operator==(const String& string, StringView view)
+	{
+		return view == StringView(string);
+	}
+
+	/*!
+	* \brief Checks whether a "C string" is different from a view
+	* \return true if they don't have the same characters
+	*
+	* \param string String to compare
+	* \param view View to compare
+	*/
+	inline bool operator!=(const char* string, StringView view)
+	{
+		return view != StringView(string);
+	}
+
+	/*!
+	* \brief Checks whether a string is different from a view
+	* \return true if they don't have the same characters
+	*
+	* \param string String to compare
+	* \param view View to compare
+	*/
+	inline bool operator!=(const String& string, StringView view)
+	{
+		return view != StringView(string);
+	}
+}
+
+namespace std
+{
+	template<>
+	struct hash<Nz::StringView>
+	{
+		/*!
+		* \brief Specialisation of std to hash
+		* \return Result of the hash, the same as the one of a Nz::String holding the same characters
+		*
+		* \param view View to hash
+		*/
+		size_t operator()(Nz::StringView view) const
+		{
+			// Algorithme DJB2
+			// http://www.cse.yorku.ca/~oz/hash.html
+
+			size_t h = 5381;
+			for (char character : view)
+				h = ((h << 5) + h) + static_cast<size_t>(character);
+
+			return h;
+		}
+	};
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -0,0 +1,44 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_TASKGROUP_HPP
+#define NAZARA_TASKGROUP_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <atomic>
+
+namespace Nz
+{
+	class TaskSchedulerImpl;
+
+	class TaskGroup
+	{
+		friend TaskSchedulerImpl;
+		friend class TaskScheduler;
+
+		public:
+			inline TaskGroup();
+			TaskGroup(const TaskGroup&) = delete;
+			TaskGroup(TaskGroup&&) = delete;
+			~TaskGroup() = default;
+
+			inline std::size_t GetPendingTaskCount() const;
+
+			inline bool IsDone() const;
+
+			inline void Wait();
+
+			TaskGroup& operator=(const TaskGroup&) = delete;
+			TaskGroup& operator=(TaskGroup&&) = delete;
+
+		private:
+			std::atomic_size_t m_pendingTaskCount;
+	};
+}
+
+#include <Nazara/Core/TaskGroup.inl>
+
+#endif // NAZARA_TASKGROUP_HPP
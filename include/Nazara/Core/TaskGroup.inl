@@ -0,0 +1,57 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::TaskGroup
+	* \brief Core class that tracks a batch of tasks submitted to the TaskScheduler
+	*
+	* Waiting on a group only waits for the tasks added with it, instead of every task handled by the scheduler
+	*
+	* \remark A group must outlive every task added with it
+	*/
+
+	/*!
+	* \brief Constructs an empty TaskGroup object
+	*/
+	inline TaskGroup::TaskGroup() :
+	m_pendingTaskCount(0)
+	{
+	}
+
+	/*!
+	* \brief Gets the number of tasks of this group which are not done yet
+	* \return Number of pending tasks (including tasks currently executing)
+	*/
+	inline std::size_t TaskGroup::GetPendingTaskCount() const
+	{
+		return m_pendingTaskCount;
+	}
+
+	/*!
+	* \brief Checks whether every task of this group has been executed
+	* \return true If no task of this group is pending
+	*/
+	inline bool TaskGroup::IsDone() const
+	{
+		return m_pendingTaskCount == 0;
+	}
+
+	/*!
+	* \brief Waits for every task of this group to be done
+	*
+	* \see TaskScheduler::WaitForTasks
+	*/
+	inline void TaskGroup::Wait()
+	{
+		TaskScheduler::WaitForTasks(*this);
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
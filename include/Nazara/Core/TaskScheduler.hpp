@@ -9,11 +9,18 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/Functor.hpp>
+#include <cstddef>
+#include <vector>
 
 namespace Nz
 {
+	class TaskGroup;
+	class TaskSchedulerImpl;
+
 	class NAZARA_CORE_API TaskScheduler
 	{
+		friend TaskSchedulerImpl;
+
 		public:
 			TaskScheduler() = delete;
 			~TaskScheduler() = delete;
@@ -21,15 +28,38 @@ namespace Nz
 			template<typename F> static void AddTask(F function);
 			template<typename F, typename... Args> static void AddTask(F function, Args&&... args);
 			template<typename C> static void AddTask(void (C::*function)(), C* object);
+			template<typename F> static void AddTask(TaskGroup& group, F function);
+			template<typename F, typename... Args> static void AddTask(TaskGroup& group, F function, Args&&... args);
+			template<typename C> static void AddTask(TaskGroup& group, void (C::*function)(), C* object);
+			static void EnableWorkerPinning(bool enable);
+			static std::size_t GetQueuedTaskCount();
 			static unsigned int GetWorkerCount();
 			static bool Initialize();
+			static bool IsWorkerPinningEnabled();
+			template<typename F> static void ParallelFor(std::size_t begin, std::size_t end, std::size_t grainSize, F&& function);
+			template<typename T, typename F, typename R> static T ParallelReduce(std::size_t begin, std::size_t end, std::size_t grainSize, T identity, F&& function, R&& reduce);
 			static void Run();
 			static void SetWorkerCount(unsigned int workerCount);
 			static void Uninitialize();
 			static void WaitForTasks();
+			static void WaitForTasks(TaskGroup& group);
 
 		private:
-			static void AddTaskFunctor(Functor* taskFunctor);
+			struct Task
+			{
+				Functor* functor;
+				TaskGroup* group;
+			};
+
+			struct WorkerPlacement
+			{
+				unsigned int node;
+				unsigned int processor;
+			};
+
+			static void AddTaskFunctor(Functor* taskFunctor, TaskGroup* group = nullptr);
+			static std::size_t ComputeGrainSize(std::size_t count, std::size_t grainSize);
+			static std::vector<WorkerPlacement> ComputeWorkerPlacement(unsigned int workerCount);
 	};
 }
 
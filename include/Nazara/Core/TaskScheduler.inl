@@ -2,6 +2,10 @@
 // This file is part of the "Nazara Engine - Core module"
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
+#include <Nazara/Core/TaskGroup.hpp>
+#include <algorithm>
+#include <atomic>
+#include <vector>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
@@ -49,6 +53,164 @@ namespace Nz
 	{
 		AddTaskFunctor(new MemberWithoutArgs<C>(function, object));
 	}
+
+	/*!
+	* \brief Adds a task belonging to a group to the pending list
+	*
+	* \param group Group the task will be counted in, it must outlive the task
+	* \param function Task that the pool will execute
+	*/
+
+	template<typename F>
+	void TaskScheduler::AddTask(TaskGroup& group, F function)
+	{
+		AddTaskFunctor(new FunctorWithoutArgs<F>(function), &group);
+	}
+
+	/*!
+	* \brief Adds a task belonging to a group to the pending list
+	*
+	* \param group Group the task will be counted in, it must outlive the task
+	* \param function Task that the pool will execute
+	* \param args Arguments of the function
+	*/
+
+	template<typename F, typename... Args>
+	void TaskScheduler::AddTask(TaskGroup& group, F function, Args&&... args)
+	{
+		AddTaskFunctor(new FunctorWithArgs<F, Args...>(function, std::forward<Args>(args)...), &group);
+	}
+
+	/*!
+	* \brief Adds a task belonging to a group to the pending list
+	*
+	* \param group Group the task will be counted in, it must outlive the task
+	* \param function Task that the pool will execute
+	* \param object Object on which the method will be called
+	*/
+
+	template<typename C>
+	void TaskScheduler::AddTask(TaskGroup& group, void (C::*function)(), C* object)
+	{
+		AddTaskFunctor(new MemberWithoutArgs<C>(function, object), &group);
+	}
+
+	/*!
+	* \brief Calls a function over a range split into chunks, in parallel
+	*
+	* Chunks are claimed dynamically by the calling thread and the workers, which balances uneven workloads without allocating a task per chunk.
+	* Ranges not larger than a single chunk are executed inline in the calling thread.
+	*
+	* \param begin First index of the range
+	* \param end Index following the last index of the range
+	* \param grainSize Number of indices per chunk, zero picks one according to the worker count
+	* \param function Function called as function(chunkBegin, chunkEnd) for every chunk
+	*
+	* \remark This blocks until the whole range has been processed
+	* \remark As AddTask, this should not be called from inside a task
+	*/
+
+	template<typename F>
+	void TaskScheduler::ParallelFor(std::size_t begin, std::size_t end, std::size_t grainSize, F&& function)
+	{
+		if (begin >= end)
+			return;
+
+		std::size_t count = end - begin;
+		grainSize = ComputeGrainSize(count, grainSize);
+		if (count <= grainSize)
+		{
+			function(begin, end);
+			return;
+		}
+
+		std::atomic_size_t next(begin);
+		auto processChunks = [&]()
+		{
+			for (;;)
+			{
+				std::size_t chunkBegin = next.fetch_add(grainSize);
+				if (chunkBegin >= end)
+					break;
+
+				function(chunkBegin, std::min(chunkBegin + grainSize, end));
+			}
+		};
+
+		// The calling thread takes part in the processing, it only needs help for the remaining chunks
+		std::size_t chunkCount = (count + grainSize - 1) / grainSize;
+		std::size_t taskCount = std::min<std::size_t>(GetWorkerCount(), chunkCount - 1);
+
+		TaskGroup group;
+		for (std::size_t i = 0; i < taskCount; ++i)
+			AddTask(group, processChunks);
+
+		Run();
+		processChunks();
+		WaitForTasks(group);
+	}
+
+	/*!
+	* \brief Reduces a range split into chunks, in parallel
+	*
+	* \return Reduction of every chunk result, or identity if the range is empty
+	*
+	* \param begin First index of the range
+	* \param end Index following the last index of the range
+	* \param grainSize Number of indices per chunk, zero picks one according to the worker count
+	* \param identity Neutral value of the reduction, used as the starting value of every partial result
+	* \param function Function called as function(chunkBegin, chunkEnd) for every chunk, returning the chunk result
+	* \param reduce Function called as reduce(left, right) to combine two results
+	*
+	* \remark The order in which chunks are combined is unspecified, reduce should be associative and commutative
+	* \remark As AddTask, this should not be called from inside a task
+	*/
+
+	template<typename T, typename F, typename R>
+	T TaskScheduler::ParallelReduce(std::size_t begin, std::size_t end, std::size_t grainSize, T identity, F&& function, R&& reduce)
+	{
+		if (begin >= end)
+			return identity;
+
+		std::size_t count = end - begin;
+		grainSize = ComputeGrainSize(count, grainSize);
+		if (count <= grainSize)
+			return reduce(identity, function(begin, end));
+
+		std::size_t chunkCount = (count + grainSize - 1) / grainSize;
+		std::size_t taskCount = std::min<std::size_t>(GetWorkerCount(), chunkCount - 1);
+
+		// One partial result per participant (the last one is the calling thread), to avoid any synchronization
+		std::vector<T> partialResults(taskCount + 1, identity);
+
+		std::atomic_size_t next(begin);
+		auto processChunks = [&](std::size_t participantIndex)
+		{
+			T& result = partialResults[participantIndex];
+			for (;;)
+			{
+				std::size_t chunkBegin = next.fetch_add(grainSize);
+				if (chunkBegin >= end)
+					break;
+
+				result = reduce(result, function(chunkBegin, std::min(chunkBegin + grainSize, end)));
+			}
+		};
+
+		TaskGroup group;
+		for (std::size_t i = 0; i < taskCount; ++i)
+			AddTask(group, [&processChunks, i]() { processChunks(i); });
+
+		Run();
+		processChunks(taskCount);
+		WaitForTasks(group);
+
+		T result = identity;
+		for (T& partialResult : partialResults)
+			result = reduce(result, partialResult);
+
+		return result;
+	}
 }
 
 #include <Nazara/Core/DebugOff.hpp>
@@ -0,0 +1,80 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_TEXTSCANNER_HPP
+#define NAZARA_TEXTSCANNER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/String.hpp>
+#include <Nazara/Core/StringView.hpp>
+#include <limits>
+#include <vector>
+
+namespace Nz
+{
+	class Stream;
+
+	class NAZARA_CORE_API TextScanner
+	{
+		public:
+			inline TextScanner();
+			inline TextScanner(const void* text, std::size_t size);
+			explicit TextScanner(Stream& stream, UInt64 sizeLimit = std::numeric_limits<UInt64>::max());
+			TextScanner(const TextScanner&) = delete;
+			TextScanner(TextScanner&&) noexcept = default;
+			~TextScanner() = default;
+
+			inline bool EndOfLine();
+			inline bool EndOfText() const;
+
+			inline bool Expect(char character);
+			inline bool ExpectWord(const char* word, bool caseSensitive = true);
+
+			inline const char* GetCursor() const;
+			inline String GetLine() const;
+			inline std::size_t GetLineNumber() const;
+			inline std::size_t GetSize() const;
+			inline const char* GetText() const;
+
+			bool NextLine();
+
+			inline bool Read(float* value);
+			inline bool Read(Int32* value);
+			inline bool Read(UInt32* value);
+			inline String ReadRemaining();
+			inline bool ReadWord(StringView* word);
+
+			inline void RestartLine();
+
+			inline void SetCommentMarker(const char* marker);
+
+			TextScanner& operator=(const TextScanner&) = delete;
+			TextScanner& operator=(TextScanner&&) noexcept = default;
+
+			static inline bool IsBlank(char character);
+			static const char* ParseFloat(const char* begin, const char* end, float* value);
+			static const char* ParseInteger(const char* begin, const char* end, Int32* value);
+			static const char* ParseInteger(const char* begin, const char* end, UInt32* value);
+
+		private:
+			inline void SkipBlanks();
+
+			std::vector<char> m_buffer; //< Copy of the text, if it could not be read in place
+			const char* m_begin;
+			const char* m_commentMarker;
+			const char* m_cursor;
+			const char* m_end;
+			const char* m_lineBegin;
+			const char* m_lineEnd;
+			const char* m_nextLine;
+			std::size_t m_commentMarkerSize;
+			std::size_t m_lineNumber;
+	};
+}
+
+#include <Nazara/Core/TextScanner.inl>
+
+#endif // NAZARA_TEXTSCANNER_HPP
@@ -0,0 +1,282 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <cctype>
+#include <cstring>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Constructs a TextScanner object over no text
+	*/
+	inline TextScanner::TextScanner() :
+	TextScanner(nullptr, 0)
+	{
+	}
+
+	/*!
+	* \brief Constructs a TextScanner object over a text
+	*
+	* \param text Pointer to the first character of the text
+	* \param size Size of the text, in bytes
+	*
+	* \remark The text is not copied and must outlive the scanner
+	*/
+	inline TextScanner::TextScanner(const void* text, std::size_t size) :
+	m_begin(static_cast<const char*>(text)),
+	m_commentMarker(nullptr),
+	m_cursor(m_begin),
+	m_end(m_cursor + size),
+	m_lineBegin(m_cursor),
+	m_lineEnd(m_cursor),
+	m_nextLine(m_cursor),
+	m_commentMarkerSize(0),
+	m_lineNumber(0)
+	{
+	}
+
+	/*!
+	* \brief Checks whether the rest of the current line is blank
+	* \return true if nothing but blanks remains on the current line
+	*/
+	inline bool TextScanner::EndOfLine()
+	{
+		SkipBlanks();
+		return m_cursor >= m_lineEnd;
+	}
+
+	/*!
+	* \brief Checks whether every line of the text was read
+	* \return true if there is no line left after the current one
+	*/
+	inline bool TextScanner::EndOfText() const
+	{
+		return m_nextLine >= m_end;
+	}
+
+	/*!
+	* \brief Consumes a character of the current line, if it is the next non-blank one
+	* \return true if the character was found
+	*
+	* \param character Character expected
+	*/
+	inline bool TextScanner::Expect(char character)
+	{
+		SkipBlanks();
+		if (m_cursor >= m_lineEnd || *m_cursor != character)
+			return false;
+
+		m_cursor++;
+		return true;
+	}
+
+	/*!
+	* \brief Consumes a word of the current line, if it is the next one
+	* \return true if the word was found
+	*
+	* \param word Word expected, it must be followed by a blank or the end of the line to match
+	* \param caseSensitive Should the case be taken into account
+	*/
+	inline bool TextScanner::ExpectWord(const char* word, bool caseSensitive)
+	{
+		SkipBlanks();
+
+		const char* ptr = m_cursor;
+		for (; *word != '\0'; ++word, ++ptr)
+		{
+			if (ptr >= m_lineEnd)
+				return false;
+
+			if (caseSensitive)
+			{
+				if (*ptr != *word)
+					return false;
+			}
+			else if (std::tolower(static_cast<unsigned char>(*ptr)) != std::tolower(static_cast<unsigned char>(*word)))
+				return false;
+		}
+
+		if (ptr < m_lineEnd && !IsBlank(*ptr))
+			return false;
+
+		m_cursor = ptr;
+		return true;
+	}
+
+	/*!
+	* \brief Gets the position of the scanner in the text
+	* \return Pointer to the next character to be read
+	*/
+	inline const char* TextScanner::GetCursor() const
+	{
+		return m_cursor;
+	}
+
+	/*!
+	* \brief Gets the current line
+	* \return Current line, without its comment and surrounding blanks
+	*
+	* \remark This allocates a string, it is meant for diagnostics
+	*/
+	inline String TextScanner::GetLine() const
+	{
+		return String(m_lineBegin, m_lineEnd - m_lineBegin);
+	}
+
+	/*!
+	* \brief Gets the number of the current line
+	* \return Number of the current line, starting from one (zero if no line was read yet)
+	*/
+	inline std::size_t TextScanner::GetLineNumber() const
+	{
+		return m_lineNumber;
+	}
+
+	/*!
+	* \brief Gets the size of the text
+	* \return Size of the text, in bytes
+	*/
+	inline std::size_t TextScanner::GetSize() const
+	{
+		return m_end - m_begin;
+	}
+
+	/*!
+	* \brief Gets the text
+	* \return Pointer to the first character of the text, it is not null-terminated
+	*/
+	inline const char* TextScanner::GetText() const
+	{
+		return m_begin;
+	}
+
+	/*!
+	* \brief Reads a floating-point number from the current line
+	* \return true if a number was read
+	*
+	* \param value Pointer to the number to fill
+	*
+	* \see ParseFloat
+	*/
+	inline bool TextScanner::Read(float* value)
+	{
+		SkipBlanks();
+		const char* ptr = ParseFloat(m_cursor, m_lineEnd, value);
+		if (!ptr)
+			return false;
+
+		m_cursor = ptr;
+		return true;
+	}
+
+	/*!
+	* \brief Reads a signed integer from the current line
+	* \return true if a number was read
+	*
+	* \param value Pointer to the number to fill
+	*/
+	inline bool TextScanner::Read(Int32* value)
+	{
+		SkipBlanks();
+		const char* ptr = ParseInteger(m_cursor, m_lineEnd, value);
+		if (!ptr)
+			return false;
+
+		m_cursor = ptr;
+		return true;
+	}
+
+	/*!
+	* \brief Reads an unsigned integer from the current line
+	* \return true if a number was read
+	*
+	* \param value Pointer to the number to fill
+	*/
+	inline bool TextScanner::Read(UInt32* value)
+	{
+		SkipBlanks();
+		const char* ptr = ParseInteger(m_cursor, m_lineEnd, value);
+		if (!ptr)
+			return false;
+
+		m_cursor = ptr;
+		return true;
+	}
+
+	/*!
+	* \brief Reads the rest of the current line
+	* \return Rest of the line, without its leading blanks (may be empty)
+	*/
+	inline String TextScanner::ReadRemaining()
+	{
+		SkipBlanks();
+		String remaining(m_cursor, m_lineEnd - m_cursor);
+		m_cursor = m_lineEnd;
+
+		return remaining;
+	}
+
+	/*!
+	* \brief Reads a word (anything until a blank) from the current line
+	* \return true if a word was read, false if the end of the line was reached
+	*
+	* \param word View to fill with the word, it refers to the text
+	*/
+	inline bool TextScanner::ReadWord(StringView* word)
+	{
+		SkipBlanks();
+		if (m_cursor >= m_lineEnd)
+			return false;
+
+		const char* begin = m_cursor;
+		while (m_cursor < m_lineEnd && !IsBlank(*m_cursor))
+			m_cursor++;
+
+		*word = StringView(begin, m_cursor - begin);
+		return true;
+	}
+
+	/*!
+	* \brief Moves the cursor back to the beginning of the current line
+	*
+	* This allows a line to be read again, for example after finding it does not belong to the block being parsed
+	*/
+	inline void TextScanner::RestartLine()
+	{
+		m_cursor = m_lineBegin;
+	}
+
+	/*!
+	* \brief Sets the marker starting a comment
+	*
+	* From the comment marker to the end of the line, everything is ignored by NextLine
+	*
+	* \param marker Comment marker (for example "#" or "//"), nullptr or an empty string to disable comments
+	*/
+	inline void TextScanner::SetCommentMarker(const char* marker)
+	{
+		m_commentMarker = marker;
+		m_commentMarkerSize = (marker) ? std::strlen(marker) : 0;
+	}
+
+	/*!
+	* \brief Checks whether a character is a blank, separating words of a line
+	* \return true if the character is a space, a tab or a carriage return
+	*
+	* \param character Character to check
+	*/
+	inline bool TextScanner::IsBlank(char character)
+	{
+		return character == ' ' || character == '\t' || character == '\r' || character == '\v' || character == '\f';
+	}
+
+	inline void TextScanner::SkipBlanks()
+	{
+		while (m_cursor < m_lineEnd && IsBlank(*m_cursor))
+			m_cursor++;
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -8,6 +8,8 @@
 #define NAZARA_THREAD_HPP
 
 #include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Bitset.hpp>
+#include <Nazara/Core/Enums.hpp>
 #include <Nazara/Core/Functor.hpp>
 #include <Nazara/Core/MovablePtr.hpp>
 #include <iosfwd>
@@ -34,13 +36,17 @@ namespace Nz
 			Id GetId() const;
 			bool IsJoinable() const;
 			void Join();
+			bool SetAffinity(const Bitset<>& processors);
 			void SetName(const String& name);
+			bool SetPriority(ThreadPriority priority);
 
 			Thread& operator=(const Thread&) = delete;
 			Thread& operator=(Thread&& thread) noexcept = default;
 
 			static unsigned int HardwareConcurrency();
+			static bool SetCurrentThreadAffinity(const Bitset<>& processors);
 			static void SetCurrentThreadName(const String& name);
+			static bool SetCurrentThreadPriority(ThreadPriority priority);
 			static void Sleep(UInt32 milliseconds);
 
 		private:
@@ -0,0 +1,46 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_TIMESTAMP_HPP
+#define NAZARA_TIMESTAMP_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Clock.hpp>
+#include <atomic>
+
+namespace Nz
+{
+	class NAZARA_CORE_API Timestamp
+	{
+		public:
+			Timestamp() = delete;
+			~Timestamp() = delete;
+
+			static inline UInt64 FromMicroseconds(UInt64 microseconds);
+
+			static inline UInt64 GetFrequency();
+
+			static bool IsTscBased();
+
+			static inline UInt64 Now();
+
+			static inline UInt64 ToMicroseconds(UInt64 ticks);
+			static inline UInt64 ToNanoseconds(UInt64 ticks);
+			static inline double ToSeconds(UInt64 ticks);
+
+		private:
+			static inline UInt64 Convert(UInt64 value, UInt64 fromFrequency, UInt64 toFrequency);
+			static UInt64 Initialize();
+			static UInt64 NowFirstRun();
+
+			static std::atomic<ClockFunction> s_now;
+			static std::atomic<UInt64> s_frequency;
+	};
+}
+
+#include <Nazara/Core/Timestamp.inl>
+
+#endif // NAZARA_TIMESTAMP_HPP
@@ -0,0 +1,89 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Converts a duration in microseconds to timestamp ticks
+	* \return Tick count
+	*
+	* \param microseconds Duration to convert
+	*/
+	inline UInt64 Timestamp::FromMicroseconds(UInt64 microseconds)
+	{
+		return Convert(microseconds, 1'000'000ULL, GetFrequency());
+	}
+
+	/*!
+	* \brief Gets the number of timestamp ticks per second
+	* \return Tick frequency
+	*
+	* \remark The timestamp source is selected (and calibrated) on first use
+	*/
+	inline UInt64 Timestamp::GetFrequency()
+	{
+		UInt64 frequency = s_frequency.load(std::memory_order_relaxed);
+		if (frequency == 0)
+			frequency = Initialize();
+
+		return frequency;
+	}
+
+	/*!
+	* \brief Reads the current timestamp
+	* \return Tick count, from an unspecified origin
+	*
+	* This is meant for fine-grained measurements: when the processor has an invariant time-stamp counter, it is read directly, which costs a few nanoseconds.
+	* Only the difference between two timestamps is meaningful, and can be converted using the To* functions.
+	*
+	* \see GetFrequency, IsTscBased
+	*/
+	inline UInt64 Timestamp::Now()
+	{
+		return s_now.load(std::memory_order_relaxed)();
+	}
+
+	/*!
+	* \brief Converts timestamp ticks to microseconds
+	* \return Duration in microseconds
+	*
+	* \param ticks Tick count to convert, usually the difference between two timestamps
+	*/
+	inline UInt64 Timestamp::ToMicroseconds(UInt64 ticks)
+	{
+		return Convert(ticks, GetFrequency(), 1'000'000ULL);
+	}
+
+	/*!
+	* \brief Converts timestamp ticks to nanoseconds
+	* \return Duration in nanoseconds
+	*
+	* \param ticks Tick count to convert, usually the difference between two timestamps
+	*/
+	inline UInt64 Timestamp::ToNanoseconds(UInt64 ticks)
+	{
+		return Convert(ticks, GetFrequency(), 1'000'000'000ULL);
+	}
+
+	/*!
+	* \brief Converts timestamp ticks to seconds
+	* \return Duration in seconds
+	*
+	* \param ticks Tick count to convert, usually the difference between two timestamps
+	*/
+	inline double Timestamp::ToSeconds(UInt64 ticks)
+	{
+		return static_cast<double>(ticks) / GetFrequency();
+	}
+
+	inline UInt64 Timestamp::Convert(UInt64 value, UInt64 fromFrequency, UInt64 toFrequency)
+	{
+		// Split the conversion to keep the multiplication from overflowing on long durations
+		return (value / fromFrequency) * toFrequency + (value % fromFrequency) * toFrequency / fromFrequency;
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
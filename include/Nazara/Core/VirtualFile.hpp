@@ -0,0 +1,60 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_VIRTUALFILE_HPP
+#define NAZARA_VIRTUALFILE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/Stream.hpp>
+#include <Nazara/Core/String.hpp>
+
+namespace Nz
+{
+	class NAZARA_CORE_API VirtualFile : public Stream
+	{
+		friend class VirtualFileSystem;
+
+		public:
+			VirtualFile();
+			VirtualFile(const VirtualFile&) = delete;
+			VirtualFile(VirtualFile&&) = delete;
+			~VirtualFile() = default;
+
+			void Close();
+
+			bool EndOfStream() const override;
+
+			UInt64 GetCursorPos() const override;
+			inline const UInt8* GetData() const;
+			String GetDirectory() const override;
+			const void* GetMappedPointer() const override;
+			String GetPath() const override;
+			UInt64 GetSize() const override;
+
+			inline bool IsOpen() const;
+
+			bool SetCursorPos(UInt64 offset) override;
+
+			VirtualFile& operator=(const VirtualFile&) = delete;
+			VirtualFile& operator=(VirtualFile&&) = delete;
+
+		private:
+			void FlushStream() override;
+			std::size_t ReadBlock(void* buffer, std::size_t size) override;
+			std::size_t WriteBlock(const void* buffer, std::size_t size) override;
+
+			ByteArray m_buffer; //< Decompressed content, if needed
+			String m_filePath;
+			const UInt8* m_data;
+			UInt64 m_pos;
+			UInt64 m_size;
+	};
+}
+
+#include <Nazara/Core/VirtualFile.inl>
+
+#endif // NAZARA_VIRTUALFILE_HPP
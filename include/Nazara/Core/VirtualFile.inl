@@ -0,0 +1,28 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the content of the file
+	* \return Pointer to GetSize() bytes, valid until the file is closed or its archive unmounted
+	*/
+	inline const UInt8* VirtualFile::GetData() const
+	{
+		return m_data;
+	}
+
+	/*!
+	* \brief Checks whether the file is open
+	* \return true if the file was opened by VirtualFileSystem::Open
+	*/
+	inline bool VirtualFile::IsOpen() const
+	{
+		return !m_filePath.IsEmpty();
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -0,0 +1,52 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_VIRTUALFILESYSTEM_HPP
+#define NAZARA_VIRTUALFILESYSTEM_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Archive.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/String.hpp>
+#include <memory>
+#include <vector>
+
+namespace Nz
+{
+	class VirtualFile;
+
+	class NAZARA_CORE_API VirtualFileSystem
+	{
+		public:
+			VirtualFileSystem() = delete;
+			~VirtualFileSystem() = delete;
+
+			static bool Exists(const String& filePath);
+
+			static bool Mount(const String& archivePath, const String& mountPoint = String());
+
+			static bool Open(const String& filePath, VirtualFile* file);
+
+			static void Uninitialize();
+
+			static bool Unmount(const String& archivePath);
+
+		private:
+			struct MountPoint
+			{
+				std::unique_ptr<Archive> archive;
+				String archivePath;
+				String directory; //< Absolute, ending with a separator
+			};
+
+			static const Archive::Entry* FindEntry(const String& filePath, const Archive** archive);
+
+			static std::vector<MountPoint> s_mountPoints;
+			static Mutex s_mutex;
+	};
+}
+
+#endif // NAZARA_VIRTUALFILESYSTEM_HPP
@@ -0,0 +1,34 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_WRITELOCKGUARD_HPP
+#define NAZARA_WRITELOCKGUARD_HPP
+
+#include <Nazara/Prerequisites.hpp>
+
+namespace Nz
+{
+	class ReadWriteLock;
+
+	class WriteLockGuard
+	{
+		public:
+			inline WriteLockGuard(ReadWriteLock& lock, bool acquire = true);
+			inline ~WriteLockGuard();
+
+			inline void Lock();
+			inline bool TryLock();
+			inline void Unlock();
+
+		private:
+			ReadWriteLock& m_lock;
+			bool m_locked;
+	};
+}
+
+#include <Nazara/Core/WriteLockGuard.inl>
+
+#endif // NAZARA_WRITELOCKGUARD_HPP
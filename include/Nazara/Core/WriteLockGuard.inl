@@ -0,0 +1,85 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/WriteLockGuard.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/ReadWriteLock.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::WriteLockGuard
+	* \brief Core class that holds a ReadWriteLock for writing, with a RAII-style mechanism
+	*/
+
+	/*!
+	* \brief Constructs a WriteLockGuard object with a read-write lock
+	*
+	* \param lock Lock to hold for writing
+	* \param acquire Should the lock be acquired by the constructor
+	*/
+	inline WriteLockGuard::WriteLockGuard(ReadWriteLock& lock, bool acquire) :
+	m_lock(lock),
+	m_locked(false)
+	{
+		if (acquire)
+		{
+			m_lock.LockWrite();
+			m_locked = true;
+		}
+	}
+
+	/*!
+	* \brief Destructs a WriteLockGuard object and unlocks the lock if it is held
+	*/
+	inline WriteLockGuard::~WriteLockGuard()
+	{
+		if (m_locked)
+			m_lock.UnlockWrite();
+	}
+
+	/*!
+	* \brief Locks the underlying lock for writing
+	*
+	* \see ReadWriteLock::LockWrite
+	*/
+	inline void WriteLockGuard::Lock()
+	{
+		NazaraAssert(!m_locked, "Lock is already held");
+
+		m_lock.LockWrite();
+		m_locked = true;
+	}
+
+	/*!
+	* \brief Tries to lock the underlying lock for writing
+	* \return true if the lock was acquired successfully
+	*
+	* \see ReadWriteLock::TryLockWrite
+	*/
+	inline bool WriteLockGuard::TryLock()
+	{
+		NazaraAssert(!m_locked, "Lock is already held");
+
+		m_locked = m_lock.TryLockWrite();
+		return m_locked;
+	}
+
+	/*!
+	* \brief Unlocks the underlying lock
+	*
+	* \see ReadWriteLock::UnlockWrite
+	*/
+	inline void WriteLockGuard::Unlock()
+	{
+		NazaraAssert(m_locked, "Lock is not held");
+
+		m_lock.UnlockWrite();
+		m_locked = false;
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
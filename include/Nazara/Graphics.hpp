@@ -52,15 +52,21 @@
 #include <Nazara/Graphics/DepthRenderQueue.hpp>
 #include <Nazara/Graphics/DepthRenderTechnique.hpp>
 #include <Nazara/Graphics/Drawable.hpp>
+#include <Nazara/Graphics/DynamicResolutionController.hpp>
 #include <Nazara/Graphics/Enums.hpp>
 #include <Nazara/Graphics/ForwardRenderTechnique.hpp>
 #include <Nazara/Graphics/Graphics.hpp>
+#include <Nazara/Graphics/GpuParticleGroup.hpp>
 #include <Nazara/Graphics/GuillotineTextureAtlas.hpp>
+#include <Nazara/Graphics/Impostor.hpp>
 #include <Nazara/Graphics/InstancedRenderable.hpp>
 #include <Nazara/Graphics/Light.hpp>
 #include <Nazara/Graphics/Material.hpp>
 #include <Nazara/Graphics/MaterialPipeline.hpp>
 #include <Nazara/Graphics/Model.hpp>
+#include <Nazara/Graphics/OcclusionCuller.hpp>
+#include <Nazara/Graphics/ParticleBehaviorController.hpp>
+#include <Nazara/Graphics/ParticleBehaviors.hpp>
 #include <Nazara/Graphics/ParticleController.hpp>
 #include <Nazara/Graphics/ParticleDeclaration.hpp>
 #include <Nazara/Graphics/ParticleEmitter.hpp>
@@ -75,13 +81,16 @@
 #include <Nazara/Graphics/Renderable.hpp>
 #include <Nazara/Graphics/RenderQueue.hpp>
 #include <Nazara/Graphics/RenderTechniques.hpp>
+#include <Nazara/Graphics/ResidencyManager.hpp>
 #include <Nazara/Graphics/SceneData.hpp>
 #include <Nazara/Graphics/SkeletalModel.hpp>
 #include <Nazara/Graphics/SkinningManager.hpp>
 #include <Nazara/Graphics/SkyboxBackground.hpp>
+#include <Nazara/Graphics/SnapshotRenderQueue.hpp>
 #include <Nazara/Graphics/Sprite.hpp>
 #include <Nazara/Graphics/TextSprite.hpp>
 #include <Nazara/Graphics/TextureBackground.hpp>
 #include <Nazara/Graphics/TileMap.hpp>
+#include <Nazara/Graphics/Vegetation.hpp>
 
 #endif // NAZARA_GLOBAL_GRAPHICS_HPP
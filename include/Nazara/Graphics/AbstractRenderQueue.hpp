@@ -13,6 +13,8 @@
 #include <Nazara/Graphics/Config.hpp>
 #include <Nazara/Math/Box.hpp>
 #include <Nazara/Math/Matrix4.hpp>
+#include <Nazara/Math/Rect.hpp>
+#include <Nazara/Math/Vector4.hpp>
 #include <vector>
 
 namespace Nz
@@ -28,7 +30,9 @@ namespace Nz
 		public:
 			struct DirectionalLight;
 			struct PointLight;
+			struct ReflectionProbe;
 			struct SpotLight;
+			struct SpriteInstance;
 
 			AbstractRenderQueue() = default;
 			AbstractRenderQueue(const AbstractRenderQueue&) = delete;
@@ -49,10 +53,13 @@ namespace Nz
 			virtual void AddDirectionalLight(const DirectionalLight& light);
 			virtual void AddMesh(int renderOrder, const Material* material, const MeshData& meshData, const Boxf& meshAABB, const Matrix4f& transformMatrix, const Recti& scissorRect) = 0;
 			virtual void AddPointLight(const PointLight& light);
+			virtual void AddReflectionProbe(const ReflectionProbe& probe);
+			virtual void AddSkinnedMesh(int renderOrder, const Material* material, const MeshData& meshData, const Boxf& meshAABB, const Matrix4f& transformMatrix, const Matrix4f* jointMatrices, std::size_t jointCount, const Recti& scissorRect) = 0;
 			virtual void AddSpotLight(const SpotLight& light);
-			virtual void AddSprites(int renderOrder, const Material* material, const VertexStruct_XYZ_Color_UV* vertices, std::size_t spriteCount, const Recti& scissorRect, const Texture* overlay = nullptr) = 0;
+			virtual void AddSprites(int renderOrder, const Material* material, const VertexStruct_XYZ_Color_UV* vertices, std::size_t spriteCount, const Recti& scissorRect, const Texture* overlay = nullptr, unsigned int overlayLayer = 0, const SpriteInstance* instances = nullptr) = 0;
 
 			virtual void Clear(bool fully = false);
+			virtual void ClearLights();
 
 			AbstractRenderQueue& operator=(const AbstractRenderQueue&) = delete;
 			AbstractRenderQueue& operator=(AbstractRenderQueue&&) = default;
@@ -62,6 +69,7 @@ namespace Nz
 				Color color;
 				Matrix4f transformMatrix;
 				Vector3f direction;
+				Vector4f shadowCascades[NAZARA_GRAPHICS_MAX_SHADOW_CASCADES]; //< See Light::SetShadowCascades, unused cascades are zero
 				Texture* shadowMap;
 				float ambientFactor;
 				float diffuseFactor;
@@ -79,6 +87,13 @@ namespace Nz
 				float radius;
 			};
 
+			struct ReflectionProbe
+			{
+				Vector3f position;
+				Texture* cubemap;
+				float radius; //< Objects whose center is within this distance may use the probe
+			};
+
 			struct SpotLight
 			{
 				Color color;
@@ -96,8 +111,18 @@ namespace Nz
 				float radius;
 			};
 
+			struct SpriteInstance
+			{
+				Color color;
+				Rectf textureCoords;
+				Vector3f down;   //< From the left top corner to the left bottom corner
+				Vector3f origin; //< Position of the left top corner
+				Vector3f right;  //< From the left top corner to the right top corner
+			};
+
 			std::vector<DirectionalLight> directionalLights;
 			std::vector<PointLight> pointLights;
+			std::vector<ReflectionProbe> reflectionProbes;
 			std::vector<SpotLight> spotLights;
 	};
 }
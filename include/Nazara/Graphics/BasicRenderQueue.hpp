@@ -8,7 +8,9 @@
 #define NAZARA_BASICRENDERQUEUE_HPP
 
 #include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/ArenaAllocator.hpp>
 #include <Nazara/Core/Color.hpp>
+#include <Nazara/Core/FrameArena.hpp>
 #include <Nazara/Core/MovablePtr.hpp>
 #include <Nazara/Graphics/AbstractRenderQueue.hpp>
 #include <Nazara/Graphics/Material.hpp>
@@ -34,7 +36,9 @@ namespace Nz
 		public:
 			struct BillboardData;
 
-			BasicRenderQueue() = default;
+			inline BasicRenderQueue();
+			BasicRenderQueue(const BasicRenderQueue&) = delete;
+			BasicRenderQueue(BasicRenderQueue&&) = delete;
 			~BasicRenderQueue() = default;
 
 			void AddBillboards(int renderOrder, const Material* material, std::size_t billboardCount, const Recti& scissorRect, SparsePtr<const Vector3f> positionPtr, SparsePtr<const Vector2f> sizePtr, SparsePtr<const Vector2f> sinCosPtr = nullptr, SparsePtr<const Color> colorPtr = nullptr) override;
@@ -47,7 +51,8 @@ namespace Nz
 			void AddBillboards(int renderOrder, const Material* material, std::size_t billboardCount, const Recti& scissorRect, SparsePtr<const Vector3f> positionPtr, SparsePtr<const float> sizePtr, SparsePtr<const float> anglePtr, SparsePtr<const float> alphaPtr) override;
 			void AddDrawable(int renderOrder, const Drawable* drawable) override;
 			void AddMesh(int renderOrder, const Material* material, const MeshData& meshData, const Boxf& meshAABB, const Matrix4f& transformMatrix, const Recti& scissorRect) override;
-			void AddSprites(int renderOrder, const Material* material, const VertexStruct_XYZ_Color_UV* vertices, std::size_t spriteCount, const Recti& scissorRect, const Texture* overlay = nullptr) override;
+			void AddSkinnedMesh(int renderOrder, const Material* material, const MeshData& meshData, const Boxf& meshAABB, const Matrix4f& transformMatrix, const Matrix4f* jointMatrices, std::size_t jointCount, const Recti& scissorRect) override;
+			void AddSprites(int renderOrder, const Material* material, const VertexStruct_XYZ_Color_UV* vertices, std::size_t spriteCount, const Recti& scissorRect, const Texture* overlay = nullptr, unsigned int overlayLayer = 0, const SpriteInstance* instances = nullptr) override;
 
 			void Clear(bool fully = false) override;
 
@@ -55,6 +60,9 @@ namespace Nz
 
 			void Sort(const AbstractViewer* viewer);
 
+			BasicRenderQueue& operator=(const BasicRenderQueue&) = delete;
+			BasicRenderQueue& operator=(BasicRenderQueue&&) = delete;
+
 			struct BillboardData
 			{
 				Color color;
@@ -82,6 +90,7 @@ namespace Nz
 
 			RenderQueue<BillboardChain> billboards;
 			RenderQueue<Billboard> depthSortedBillboards;
+			RenderQueue<BillboardChain> orderIndependentBillboards;
 
 			struct CustomDrawable
 			{
@@ -99,10 +108,13 @@ namespace Nz
 				Nz::Matrix4f matrix;
 				Nz::Recti scissorRect;
 				Nz::Spheref obbSphere;
+				const Nz::Matrix4f* jointMatrices; //< nullptr unless the mesh is skinned by the vertex shader
+				std::size_t jointCount;
 			};
 
 			RenderQueue<Model> models;
 			RenderQueue<Model> depthSortedModels;
+			RenderQueue<Model> orderIndependentModels;
 
 			struct SpriteChain
 			{
@@ -110,29 +122,69 @@ namespace Nz
 				std::size_t spriteCount;
 				MovablePtr<const Material> material;
 				MovablePtr<const Texture> overlay;
+				unsigned int overlayLayer; //< Layer of the overlay, if it's a texture array
 				MovablePtr<const VertexStruct_XYZ_Color_UV> vertices;
 				Nz::Recti scissorRect;
+				MovablePtr<const SpriteInstance> instances; //< Same sprites as instance records, nullptr if they can only be drawn from their vertices
 			};
 
 			RenderQueue<SpriteChain> basicSprites;
 			RenderQueue<SpriteChain> depthSortedSprites;
+			RenderQueue<SpriteChain> orderIndependentSprites;
 
 		private:
+			struct MaterialSortIndices;
+
 			inline Color ComputeColor(float alpha);
-			inline Vector2f ComputeSinCos(float angle);
+			inline const Vector2f* ComputeSinCos(SparsePtr<const float> anglePtr, std::size_t count);
 			inline Vector2f ComputeSize(float size);
 
+			inline RenderQueue<BillboardChain>& GetBillboardQueue(const Material* material);
+			inline const MaterialSortIndices& GetMaterialSortIndices(const Material* material);
+			inline RenderQueue<Model>& GetModelQueue(const Material* material);
+			inline UInt64 GetScissorSortIndex(const Recti& scissorRect);
+			inline RenderQueue<SpriteChain>& GetSpriteQueue(const Material* material);
+
+			inline bool IsDepthSorted(const Material* material) const;
+
 			inline void RegisterLayer(int layerIndex);
 
-			std::unordered_map<const MaterialPipeline*, std::size_t> m_pipelineCache;
-			std::unordered_map<const Material*, std::size_t> m_materialCache;
-			std::unordered_map<const Texture*, std::size_t> m_overlayCache;
-			std::unordered_map<const UberShader*, std::size_t> m_shaderCache;
-			std::unordered_map<const Texture*, std::size_t> m_textureCache;
-			std::unordered_map<const VertexBuffer*, std::size_t> m_vertexBufferCache;
-			std::unordered_map<int, std::size_t> m_layerCache;
+			template<typename T>
+			struct SortCache
+			{
+				using IndexMap = std::unordered_map<T, std::size_t, std::hash<T>, std::equal_to<T>, ArenaAllocator<std::pair<const T, std::size_t>>>;
+
+				inline SortCache(FrameArena& arena);
+
+				inline void Clear();
+				inline std::size_t GetIndex(const T& key);
+
+				IndexMap indices;
+				std::size_t lastIndex; //< Queued items often share their resources with the previous one, which saves a lookup
+				T lastKey;
+			};
+
+			struct MaterialSortIndices
+			{
+				UInt64 material;
+				UInt64 pipeline;
+				UInt64 shader;
+				UInt64 texture;
+			};
+
+			FrameArena m_arena; //< Backs the sort caches, which are rebuilt every frame
+			SortCache<const MaterialPipeline*> m_pipelineCache;
+			SortCache<const Material*> m_materialCache;
+			SortCache<const Texture*> m_overlayCache;
+			SortCache<const UberShader*> m_shaderCache;
+			SortCache<const Texture*> m_textureCache;
+			SortCache<const VertexBuffer*> m_vertexBufferCache;
+			SortCache<int> m_layerCache;
 
 			std::vector<BillboardData> m_billboards;
+			std::vector<MaterialSortIndices> m_materialSortIndices;
+			std::vector<Recti> m_scissorRects;
+			std::vector<Vector2f> m_sinCos;
 			std::vector<int> m_renderLayers;
 	};
 }
@@ -3,10 +3,22 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Graphics/BasicRenderQueue.hpp>
+#include <algorithm>
 #include <cassert>
 
 namespace Nz
 {
+	inline BasicRenderQueue::BasicRenderQueue() :
+	m_pipelineCache(m_arena),
+	m_materialCache(m_arena),
+	m_overlayCache(m_arena),
+	m_shaderCache(m_arena),
+	m_textureCache(m_arena),
+	m_vertexBufferCache(m_arena),
+	m_layerCache(m_arena)
+	{
+	}
+
 	inline const BasicRenderQueue::BillboardData* BasicRenderQueue::GetBillboardData(std::size_t billboardIndex) const
 	{
 		assert(billboardIndex < m_billboards.size());
@@ -18,10 +30,40 @@ namespace Nz
 		return Color(255, 255, 255, static_cast<UInt8>(255.f * alpha));
 	}
 
-	inline Vector2f BasicRenderQueue::ComputeSinCos(float angle)
+	inline const Vector2f* BasicRenderQueue::ComputeSinCos(SparsePtr<const float> anglePtr, std::size_t count)
 	{
-		float radians = ToRadians(angle);
-		return { std::sin(radians), std::cos(radians) };
+		m_sinCos.resize(count);
+
+		// A null stride means every billboard shares the same rotation
+		if (anglePtr.GetStride() == 0)
+		{
+			Vector2f sinCos;
+			FastSinCos(ToRadians(*anglePtr), &sinCos.x, &sinCos.y);
+
+			std::fill(m_sinCos.begin(), m_sinCos.end(), sinCos);
+			return m_sinCos.data();
+		}
+
+		// Angles are gathered by batches, so the sine/cosine kernel can work on contiguous memory
+		constexpr std::size_t BatchSize = 64;
+
+		float radians[BatchSize];
+		float sines[BatchSize];
+		float cosines[BatchSize];
+
+		for (std::size_t first = 0; first < count; first += BatchSize)
+		{
+			std::size_t batchCount = std::min(BatchSize, count - first);
+			for (std::size_t i = 0; i < batchCount; ++i)
+				radians[i] = ToRadians(*anglePtr++);
+
+			FastSinCos(radians, batchCount, sines, cosines);
+
+			for (std::size_t i = 0; i < batchCount; ++i)
+				m_sinCos[first + i].Set(sines[i], cosines[i]);
+		}
+
+		return m_sinCos.data();
 	}
 
 	inline Vector2f BasicRenderQueue::ComputeSize(float size)
@@ -29,10 +71,93 @@ namespace Nz
 		return Vector2f(size, size);
 	}
 
+	inline RenderQueue<BasicRenderQueue::BillboardChain>& BasicRenderQueue::GetBillboardQueue(const Material* material)
+	{
+		return (material->IsOrderIndependentTransparencyEnabled()) ? orderIndependentBillboards : billboards;
+	}
+
+	inline const BasicRenderQueue::MaterialSortIndices& BasicRenderQueue::GetMaterialSortIndices(const Material* material)
+	{
+		// Indices depending only on the material are computed once per material
+		std::size_t materialIndex = m_materialCache.GetIndex(material);
+		if (materialIndex == m_materialSortIndices.size())
+		{
+			MaterialSortIndices indices;
+			indices.material = materialIndex;
+			indices.pipeline = m_pipelineCache.GetIndex(material->GetPipeline());
+			indices.shader = m_shaderCache.GetIndex(material->GetShader());
+			indices.texture = m_textureCache.GetIndex(material->GetDiffuseMap());
+
+			m_materialSortIndices.push_back(indices);
+		}
+
+		return m_materialSortIndices[materialIndex];
+	}
+
+	inline RenderQueue<BasicRenderQueue::Model>& BasicRenderQueue::GetModelQueue(const Material* material)
+	{
+		return (material->IsOrderIndependentTransparencyEnabled()) ? orderIndependentModels : models;
+	}
+
+	inline UInt64 BasicRenderQueue::GetScissorSortIndex(const Recti& scissorRect)
+	{
+		// Index zero is kept for items without scissor rect
+		if (scissorRect.width <= 0)
+			return 0;
+
+		// There are only a few different scissor rects in a frame
+		auto it = std::find(m_scissorRects.begin(), m_scissorRects.end(), scissorRect);
+		if (it == m_scissorRects.end())
+			it = m_scissorRects.insert(it, scissorRect);
+
+		return static_cast<UInt64>(it - m_scissorRects.begin()) + 1;
+	}
+
+	inline RenderQueue<BasicRenderQueue::SpriteChain>& BasicRenderQueue::GetSpriteQueue(const Material* material)
+	{
+		return (material->IsOrderIndependentTransparencyEnabled()) ? orderIndependentSprites : basicSprites;
+	}
+
+	inline bool BasicRenderQueue::IsDepthSorted(const Material* material) const
+	{
+		// Order-independent transparency makes sorting unnecessary
+		return material->IsDepthSortingEnabled() && !material->IsOrderIndependentTransparencyEnabled();
+	}
+
 	inline void BasicRenderQueue::RegisterLayer(int layerIndex)
 	{
 		auto it = std::lower_bound(m_renderLayers.begin(), m_renderLayers.end(), layerIndex);
 		if (it == m_renderLayers.end() || *it != layerIndex)
 			m_renderLayers.insert(it, layerIndex);
 	}
+
+	template<typename T>
+	inline BasicRenderQueue::SortCache<T>::SortCache(FrameArena& arena) :
+	indices(typename IndexMap::allocator_type(arena))
+	{
+	}
+
+	template<typename T>
+	inline void BasicRenderQueue::SortCache<T>::Clear()
+	{
+		// Swapping with an empty map drops the buckets too, which must not outlive the arena memory
+		IndexMap emptyIndices(indices.get_allocator());
+		indices.swap(emptyIndices);
+	}
+
+	template<typename T>
+	inline std::size_t BasicRenderQueue::SortCache<T>::GetIndex(const T& key)
+	{
+		if (!indices.empty() && key == lastKey)
+			return lastIndex;
+
+		auto it = indices.find(key);
+		if (it == indices.end())
+			it = indices.emplace(key, indices.size()).first;
+
+		lastIndex = it->second;
+		lastKey = key;
+
+		return lastIndex;
+	}
 }
@@ -37,6 +37,9 @@
 // How much instances are need of a same mesh/material to enable instancing ?
 #define NAZARA_GRAPHICS_INSTANCING_MIN_INSTANCES_COUNT 10
 
+// Number of tiles in each dimension of the chunks a TileMap is split into, a change of tile only regenerates the vertices of its chunk
+#define NAZARA_GRAPHICS_TILEMAP_CHUNK_SIZE 16
+
 // Use the MemoryManager to manage dynamic allocations (can detect memory leak but allocations/frees are slower)
 #define NAZARA_GRAPHICS_MANAGE_MEMORY 0
 
@@ -48,6 +51,15 @@
 // The maximum number of lights in a standard shader
 #define NAZARA_GRAPHICS_MAX_LIGHT_PER_PASS 3
 
+// The maximum number of lights of a scene the forward technique uploads in its light uniform block (the shaders must be updated to match)
+#define NAZARA_GRAPHICS_MAX_LIGHTS_PER_SCENE 128
+
+// The maximum number of cascades a directional light shadow map can be split into, the cascades are laid out in a 2x2 grid (the shaders must be updated to match)
+#define NAZARA_GRAPHICS_MAX_SHADOW_CASCADES 4
+
+// The maximum number of joints a skeleton can have to be skinned by the vertex shader (the shaders must be updated to match)
+#define NAZARA_GRAPHICS_MAX_SKINNING_JOINTS 64
+
 /// Checking the values and types of certain constants
 #include <Nazara/Graphics/ConfigCheck.hpp>
 
@@ -20,6 +20,10 @@
 
 NazaraCheckTypeAndVal(NAZARA_GRAPHICS_INSTANCING_MIN_INSTANCES_COUNT, integral, >, 0, " shall be a strictly positive integer");
 NazaraCheckTypeAndVal(NAZARA_GRAPHICS_MAX_LIGHT_PER_PASS, integral, >, 0, " shall be a strictly positive integer");
+NazaraCheckTypeAndVal(NAZARA_GRAPHICS_MAX_LIGHTS_PER_SCENE, integral, >=, NAZARA_GRAPHICS_MAX_LIGHT_PER_PASS, " shall be greater or equal to NAZARA_GRAPHICS_MAX_LIGHT_PER_PASS");
+NazaraCheckTypeAndVal(NAZARA_GRAPHICS_MAX_SHADOW_CASCADES, integral, >, 0, " shall be a strictly positive integer");
+NazaraCheckTypeAndVal(NAZARA_GRAPHICS_MAX_SKINNING_JOINTS, integral, >, 0, " shall be a strictly positive integer");
+NazaraCheckTypeAndVal(NAZARA_GRAPHICS_TILEMAP_CHUNK_SIZE, integral, >, 0, " shall be a strictly positive integer");
 
 #undef NazaraCheckTypeAndVal
 
@@ -12,8 +12,10 @@
 #include <Nazara/Graphics/Config.hpp>
 #include <Nazara/Graphics/Enums.hpp>
 #include <Nazara/Math/BoundingVolume.hpp>
+#include <Nazara/Math/Box.hpp>
 #include <Nazara/Math/Frustum.hpp>
 #include <Nazara/Math/Sphere.hpp>
+#include <algorithm>
 #include <vector>
 
 namespace Nz
@@ -34,12 +36,19 @@ namespace Nz
 
 			using ResultContainer = std::vector<const T*>;
 
-			CullingList() = default;
+			CullingList();
 			CullingList(const CullingList& renderable) = delete;
 			CullingList(CullingList&& renderable) = delete;
 			~CullingList();
 
+			void ClearInvalidations();
+
 			std::size_t Cull(const Frustumf& frustum, bool* forceInvalidation = nullptr);
+			std::size_t Cull(const Frustumf& frustum, ResultContainer& results, bool* forceInvalidation = nullptr) const;
+
+			void EnableHierarchicalCulling(bool hierarchicalCulling = true);
+
+			bool IsHierarchicalCullingEnabled() const;
 
 			NoTestEntry RegisterNoTest(const T* renderable);
 			SphereEntry RegisterSphereTest(const T* renderable);
@@ -73,11 +82,24 @@ namespace Nz
 			NazaraSignal(OnCullingListRelease, CullingList* /*cullingList*/);
 
 		private:
+			struct TreeNode;
+
+			inline std::size_t AllocateTreeNode();
+			inline std::size_t BalanceTreeNode(std::size_t nodeIndex);
+			template<typename F> void CullTree(const Frustumf& frustum, std::vector<std::size_t>& treeStack, F&& func) const;
+			template<typename F> void ForEachVisibleEntry(const Frustumf& frustum, std::vector<std::size_t>& treeStack, F&& func) const;
+			inline void FreeTreeNode(std::size_t nodeIndex);
+			inline void InsertTreeLeaf(std::size_t leafIndex);
 			inline void NotifyForceInvalidation(CullTest type, std::size_t index);
 			inline void NotifyMovement(CullTest type, std::size_t index, void* oldPtr, void* newPtr);
 			inline void NotifyRelease(CullTest type, std::size_t index);
 			inline void NotifySphereUpdate(std::size_t index, const Spheref& sphere);
 			inline void NotifyVolumeUpdate(std::size_t index, const BoundingVolumef& boundingVolume);
+			inline void PushResult(CullTest type, std::size_t index, std::size_t* visibleHash, bool* forcedInvalidation);
+			inline void RefitTree(std::size_t nodeIndex);
+			inline void RemoveTreeLeaf(std::size_t leafIndex);
+			inline void ResizeSphereArrays();
+			inline void UpdateTreeLeaf(CullTest type, std::size_t index, std::size_t* leafIndex, const Boxf& aabb);
 
 			struct NoTestVisibilityEntry
 			{
@@ -88,24 +110,44 @@ namespace Nz
 
 			struct SphereVisibilityEntry
 			{
-				Spheref sphere;
 				SphereEntry* entry;
 				const T* renderable;
+				std::size_t treeLeaf;
 				bool forceInvalidation;
 			};
 
+			struct TreeNode
+			{
+				Boxf aabb; //< Enlarged bounds for leaves, so small movements don't need to update the tree
+				CullTest entryType;
+				std::size_t children[2];
+				std::size_t entryIndex;
+				std::size_t parent; //< Next free node when unused
+				int height; //< Zero for leaves, -1 for unused nodes
+			};
+
 			struct VolumeVisibilityEntry
 			{
 				BoundingVolumef volume;
 				VolumeEntry* entry;
 				const T* renderable;
+				std::size_t treeLeaf; //< Only finite volumes are stored in the tree
 				bool forceInvalidation;
 			};
 
+			std::size_t m_treeFreeNode;
+			std::size_t m_treeRoot;
 			std::vector<NoTestVisibilityEntry> m_noTestList;
 			std::vector<SphereVisibilityEntry> m_sphereTestList;
 			std::vector<VolumeVisibilityEntry> m_volumeTestList;
+			std::vector<float> m_sphereRadius; //< Spheres are stored as separate arrays, padded to the SIMD width, to be tested by batches
+			std::vector<float> m_sphereX;
+			std::vector<float> m_sphereY;
+			std::vector<float> m_sphereZ;
+			std::vector<std::size_t> m_treeStack;
+			std::vector<TreeNode> m_treeNodes;
 			ResultContainer m_results;
+			bool m_hierarchicalCulling;
 	};
 
 	template<typename T>
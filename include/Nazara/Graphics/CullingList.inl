@@ -3,10 +3,116 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Graphics/CullingList.hpp>
+#include <limits>
+
+#if defined(NAZARA_SIMD_AVX)
+	#include <immintrin.h>
+#elif defined(NAZARA_SIMD_SSE2)
+	#include <emmintrin.h>
+#endif
+
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
 {
+	namespace Detail
+	{
+		// Number of spheres tested at once, sphere arrays are padded to a multiple of it
+		#if defined(NAZARA_SIMD_AVX)
+		constexpr std::size_t CullingSphereBatchSize = 8;
+		#elif defined(NAZARA_SIMD_SSE2)
+		constexpr std::size_t CullingSphereBatchSize = 4;
+		#else
+		constexpr std::size_t CullingSphereBatchSize = 1;
+		#endif
+
+		constexpr std::size_t CullingInvalidTreeNode = std::numeric_limits<std::size_t>::max();
+		constexpr float CullingTreeMargin = 0.1f; //< Enlargement of tree leaves, relative to the size of the bounds
+
+		inline float CullingBoxArea(const Boxf& box)
+		{
+			return 2.f * (box.width * box.height + box.height * box.depth + box.depth * box.width);
+		}
+
+		inline Boxf CullingMergeBoxes(const Boxf& first, const Boxf& second)
+		{
+			Boxf merged(first);
+			merged.ExtendTo(second);
+
+			return merged;
+		}
+
+		struct CullingPlanes
+		{
+			float normalX[FrustumPlane_Max + 1];
+			float normalY[FrustumPlane_Max + 1];
+			float normalZ[FrustumPlane_Max + 1];
+			float distance[FrustumPlane_Max + 1];
+		};
+
+		/*!
+		* \brief Tests a batch of spheres against the frustum planes
+		* \return Bitmask of spheres which are inside or intersecting the frustum (bit i matching sphere i of the batch)
+		*
+		* Follows Frustum::Contains(const Sphere&): a sphere is rejected if it's fully behind one of the planes
+		*/
+		inline unsigned int CullSphereBatch(const CullingPlanes& planes, const float* x, const float* y, const float* z, const float* radius)
+		{
+			#if defined(NAZARA_SIMD_AVX)
+			__m256 posX = _mm256_loadu_ps(x);
+			__m256 posY = _mm256_loadu_ps(y);
+			__m256 posZ = _mm256_loadu_ps(z);
+			__m256 negRadius = _mm256_sub_ps(_mm256_setzero_ps(), _mm256_loadu_ps(radius));
+
+			__m256 outside = _mm256_setzero_ps();
+			for (unsigned int i = 0; i <= FrustumPlane_Max; ++i)
+			{
+				__m256 dist = _mm256_add_ps(_mm256_mul_ps(posX, _mm256_set1_ps(planes.normalX[i])), _mm256_mul_ps(posY, _mm256_set1_ps(planes.normalY[i])));
+				dist = _mm256_add_ps(dist, _mm256_mul_ps(posZ, _mm256_set1_ps(planes.normalZ[i])));
+				dist = _mm256_sub_ps(dist, _mm256_set1_ps(planes.distance[i]));
+
+				outside = _mm256_or_ps(outside, _mm256_cmp_ps(dist, negRadius, _CMP_LT_OQ));
+			}
+
+			return ~static_cast<unsigned int>(_mm256_movemask_ps(outside)) & 0xFFU;
+			#elif defined(NAZARA_SIMD_SSE2)
+			__m128 posX = _mm_loadu_ps(x);
+			__m128 posY = _mm_loadu_ps(y);
+			__m128 posZ = _mm_loadu_ps(z);
+			__m128 negRadius = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(radius));
+
+			__m128 outside = _mm_setzero_ps();
+			for (unsigned int i = 0; i <= FrustumPlane_Max; ++i)
+			{
+				__m128 dist = _mm_add_ps(_mm_mul_ps(posX, _mm_set1_ps(planes.normalX[i])), _mm_mul_ps(posY, _mm_set1_ps(planes.normalY[i])));
+				dist = _mm_add_ps(dist, _mm_mul_ps(posZ, _mm_set1_ps(planes.normalZ[i])));
+				dist = _mm_sub_ps(dist, _mm_set1_ps(planes.distance[i]));
+
+				outside = _mm_or_ps(outside, _mm_cmplt_ps(dist, negRadius));
+			}
+
+			return ~static_cast<unsigned int>(_mm_movemask_ps(outside)) & 0xFU;
+			#else
+			for (unsigned int i = 0; i <= FrustumPlane_Max; ++i)
+			{
+				float dist = planes.normalX[i] * x[0] + planes.normalY[i] * y[0] + planes.normalZ[i] * z[0] - planes.distance[i];
+				if (dist < -radius[0])
+					return 0U;
+			}
+
+			return 1U;
+			#endif
+		}
+	}
+
+	template<typename T>
+	CullingList<T>::CullingList() :
+	m_treeFreeNode(Detail::CullingInvalidTreeNode),
+	m_treeRoot(Detail::CullingInvalidTreeNode),
+	m_hierarchicalCulling(false)
+	{
+	}
+
 	template<typename T>
 	CullingList<T>::~CullingList()
 	{
@@ -22,47 +128,67 @@ namespace Nz
 
 		std::size_t visibleHash = 0U;
 
-		for (NoTestVisibilityEntry& entry : m_noTestList)
+		ForEachVisibleEntry(frustum, m_treeStack, [&](CullTest type, std::size_t index)
 		{
-			m_results.push_back(entry.renderable);
-			Nz::HashCombine(visibleHash, entry.renderable);
+			PushResult(type, index, &visibleHash, &forcedInvalidation);
+		});
 
-			if (entry.forceInvalidation)
-			{
-				forcedInvalidation = true;
-				entry.forceInvalidation = false;
-			}
-		}
+		if (forceInvalidation)
+			*forceInvalidation = forcedInvalidation;
 
-		for (SphereVisibilityEntry& entry : m_sphereTestList)
-		{
-			if (frustum.Contains(entry.sphere))
-			{
-				m_results.push_back(entry.renderable);
-				Nz::HashCombine(visibleHash, entry.renderable);
+		return visibleHash;
+	}
 
-				if (entry.forceInvalidation)
-				{
-					forcedInvalidation = true;
-					entry.forceInvalidation = false;
-				}
-			}
-		}
+	/*!
+	* \brief Culls the entries against a frustum into an external container
+	* \return Visibility hash of the visible entries, computed the same way as the other overload
+	*
+	* \param frustum Frustum to cull against
+	* \param results Container receiving the visible renderables, cleared first
+	* \param forceInvalidation Optional output telling if a visible entry asked for an invalidation
+	*
+	* \remark Unlike the other overload, this one does not modify the list (invalidation requests are kept until ClearInvalidations is called),
+	*         which allows multiple views to be culled in parallel as long as the list itself is not modified meanwhile
+	*/
+	template<typename T>
+	std::size_t CullingList<T>::Cull(const Frustumf& frustum, ResultContainer& results, bool* forceInvalidation) const
+	{
+		results.clear();
 
-		for (VolumeVisibilityEntry& entry : m_volumeTestList)
+		bool forcedInvalidation = false;
+
+		std::size_t visibleHash = 0U;
+
+		std::vector<std::size_t> treeStack;
+		ForEachVisibleEntry(frustum, treeStack, [&](CullTest type, std::size_t index)
 		{
-			if (frustum.Contains(entry.volume))
+			const T* renderable;
+			bool invalidated;
+			switch (type)
 			{
-				m_results.push_back(entry.renderable);
-				Nz::HashCombine(visibleHash, entry.renderable);
-
-				if (entry.forceInvalidation)
-				{
-					forcedInvalidation = true;
-					entry.forceInvalidation = false;
-				}
+				case CullTest::NoTest:
+					renderable = m_noTestList[index].renderable;
+					invalidated = m_noTestList[index].forceInvalidation;
+					break;
+
+				case CullTest::Sphere:
+					renderable = m_sphereTestList[index].renderable;
+					invalidated = m_sphereTestList[index].forceInvalidation;
+					break;
+
+				case CullTest::Volume:
+				default:
+					renderable = m_volumeTestList[index].renderable;
+					invalidated = m_volumeTestList[index].forceInvalidation;
+					break;
 			}
-		}
+
+			results.push_back(renderable);
+			Nz::HashCombine(visibleHash, renderable);
+
+			if (invalidated)
+				forcedInvalidation = true;
+		});
 
 		if (forceInvalidation)
 			*forceInvalidation = forcedInvalidation;
@@ -70,6 +196,71 @@ namespace Nz
 		return visibleHash;
 	}
 
+	/*!
+	* \brief Clears the invalidation requests of every entry
+	*
+	* This is meant to be called once every view has been culled with the const overload of Cull
+	*/
+	template<typename T>
+	void CullingList<T>::ClearInvalidations()
+	{
+		for (NoTestVisibilityEntry& entry : m_noTestList)
+			entry.forceInvalidation = false;
+
+		for (SphereVisibilityEntry& entry : m_sphereTestList)
+			entry.forceInvalidation = false;
+
+		for (VolumeVisibilityEntry& entry : m_volumeTestList)
+			entry.forceInvalidation = false;
+	}
+
+	/*!
+	* \brief Enables or disables the bounding volume hierarchy used by the culling
+	*
+	* \param hierarchicalCulling Should sphere and volume tests be done through a tree
+	*
+	* \remark The tree is updated incrementally as entries are moved, it allows to reject or accept whole groups of renderables at once, which pays off when most of them are culled
+	*/
+	template<typename T>
+	void CullingList<T>::EnableHierarchicalCulling(bool hierarchicalCulling)
+	{
+		if (m_hierarchicalCulling == hierarchicalCulling)
+			return;
+
+		m_hierarchicalCulling = hierarchicalCulling;
+
+		if (m_hierarchicalCulling)
+		{
+			for (std::size_t i = 0; i < m_sphereTestList.size(); ++i)
+				NotifySphereUpdate(i, Spheref(m_sphereX[i], m_sphereY[i], m_sphereZ[i], m_sphereRadius[i]));
+
+			for (std::size_t i = 0; i < m_volumeTestList.size(); ++i)
+				NotifyVolumeUpdate(i, m_volumeTestList[i].volume);
+		}
+		else
+		{
+			for (SphereVisibilityEntry& entry : m_sphereTestList)
+				entry.treeLeaf = Detail::CullingInvalidTreeNode;
+
+			for (VolumeVisibilityEntry& entry : m_volumeTestList)
+				entry.treeLeaf = Detail::CullingInvalidTreeNode;
+
+			m_treeNodes.clear();
+			m_treeFreeNode = Detail::CullingInvalidTreeNode;
+			m_treeRoot = Detail::CullingInvalidTreeNode;
+		}
+	}
+
+	/*!
+	* \brief Checks whether the culling goes through a bounding volume hierarchy
+	* \return true If it does
+	*/
+	template<typename T>
+	bool CullingList<T>::IsHierarchicalCullingEnabled() const
+	{
+		return m_hierarchicalCulling;
+	}
+
 	template<typename T>
 	typename CullingList<T>::NoTestEntry CullingList<T>::RegisterNoTest(const T* renderable)
 	{
@@ -82,8 +273,13 @@ namespace Nz
 	template<typename T>
 	typename CullingList<T>::SphereEntry CullingList<T>::RegisterSphereTest(const T* renderable)
 	{
-		SphereEntry entry(this, m_sphereTestList.size());
-		m_sphereTestList.emplace_back(SphereVisibilityEntry{Nz::Spheref(), &entry, renderable, false}); //< Address of entry will be updated when moving
+		std::size_t index = m_sphereTestList.size();
+
+		SphereEntry entry(this, index);
+		m_sphereTestList.emplace_back(SphereVisibilityEntry{&entry, renderable, Detail::CullingInvalidTreeNode, false}); //< Address of entry will be updated when moving
+
+		ResizeSphereArrays();
+		NotifySphereUpdate(index, Nz::Spheref::Zero());
 
 		return entry;
 	}
@@ -92,7 +288,7 @@ namespace Nz
 	typename CullingList<T>::VolumeEntry CullingList<T>::RegisterVolumeTest(const T* renderable)
 	{
 		VolumeEntry entry(this, m_volumeTestList.size());
-		m_volumeTestList.emplace_back(VolumeVisibilityEntry{Nz::BoundingVolumef(), &entry, renderable, false}); //< Address of entry will be updated when moving
+		m_volumeTestList.emplace_back(VolumeVisibilityEntry{Nz::BoundingVolumef(), &entry, renderable, Detail::CullingInvalidTreeNode, false}); //< Address of entry will be updated when moving
 
 		return entry;
 	}
@@ -182,6 +378,286 @@ namespace Nz
 		return m_results.size();
 	}
 
+	template<typename T>
+	std::size_t CullingList<T>::AllocateTreeNode()
+	{
+		std::size_t nodeIndex;
+		if (m_treeFreeNode == Detail::CullingInvalidTreeNode)
+		{
+			nodeIndex = m_treeNodes.size();
+			m_treeNodes.emplace_back();
+		}
+		else
+		{
+			nodeIndex = m_treeFreeNode;
+			m_treeFreeNode = m_treeNodes[nodeIndex].parent;
+		}
+
+		TreeNode& node = m_treeNodes[nodeIndex];
+		node.children[0] = Detail::CullingInvalidTreeNode;
+		node.children[1] = Detail::CullingInvalidTreeNode;
+		node.parent = Detail::CullingInvalidTreeNode;
+		node.height = 0;
+
+		return nodeIndex;
+	}
+
+	template<typename T>
+	std::size_t CullingList<T>::BalanceTreeNode(std::size_t nodeIndex)
+	{
+		// Performs a tree rotation if one child is higher than the other by more than one level, returns the new root of the subtree
+		TreeNode& node = m_treeNodes[nodeIndex];
+		if (node.height < 2)
+			return nodeIndex;
+
+		for (unsigned int side = 0; side < 2; ++side)
+		{
+			std::size_t childIndex = node.children[side];
+			std::size_t otherIndex = node.children[1 - side];
+
+			TreeNode& child = m_treeNodes[childIndex];
+			TreeNode& other = m_treeNodes[otherIndex];
+			if (child.height - other.height <= 1)
+				continue;
+
+			// Rotate child up
+			child.parent = node.parent;
+			node.parent = childIndex;
+
+			if (child.parent != Detail::CullingInvalidTreeNode)
+			{
+				TreeNode& parent = m_treeNodes[child.parent];
+				parent.children[(parent.children[0] == nodeIndex) ? 0 : 1] = childIndex;
+			}
+			else
+				m_treeRoot = childIndex;
+
+			std::size_t firstIndex = child.children[0];
+			std::size_t secondIndex = child.children[1];
+			if (m_treeNodes[firstIndex].height < m_treeNodes[secondIndex].height)
+				std::swap(firstIndex, secondIndex);
+
+			// Highest grandchild stays under child, the other one goes under node
+			TreeNode& first = m_treeNodes[firstIndex];
+			TreeNode& second = m_treeNodes[secondIndex];
+
+			child.children[0] = nodeIndex;
+			child.children[1] = firstIndex;
+			node.children[side] = secondIndex;
+			second.parent = nodeIndex;
+
+			node.aabb = Detail::CullingMergeBoxes(other.aabb, second.aabb);
+			node.height = 1 + std::max(other.height, second.height);
+
+			child.aabb = Detail::CullingMergeBoxes(node.aabb, first.aabb);
+			child.height = 1 + std::max(node.height, first.height);
+
+			return childIndex;
+		}
+
+		return nodeIndex;
+	}
+
+	template<typename T>
+	template<typename F>
+	void CullingList<T>::CullTree(const Frustumf& frustum, std::vector<std::size_t>& treeStack, F&& func) const
+	{
+		if (m_treeRoot == Detail::CullingInvalidTreeNode)
+			return;
+
+		treeStack.clear();
+		treeStack.push_back(m_treeRoot);
+
+		while (!treeStack.empty())
+		{
+			std::size_t nodeIndex = treeStack.back();
+			treeStack.pop_back();
+
+			const TreeNode& node = m_treeNodes[nodeIndex];
+			switch (frustum.Intersect(node.aabb))
+			{
+				case IntersectionSide_Inside:
+				{
+					// Every leaf of this subtree is visible, no need to test them
+					std::size_t stackBase = treeStack.size();
+					treeStack.push_back(nodeIndex);
+
+					while (treeStack.size() > stackBase)
+					{
+						const TreeNode& subNode = m_treeNodes[treeStack.back()];
+						treeStack.pop_back();
+
+						if (subNode.height == 0)
+							func(subNode.entryType, subNode.entryIndex);
+						else
+						{
+							treeStack.push_back(subNode.children[0]);
+							treeStack.push_back(subNode.children[1]);
+						}
+					}
+					break;
+				}
+
+				case IntersectionSide_Intersecting:
+				{
+					if (node.height == 0)
+					{
+						bool visible;
+						if (node.entryType == CullTest::Sphere)
+						{
+							std::size_t index = node.entryIndex;
+							visible = frustum.Contains(Spheref(m_sphereX[index], m_sphereY[index], m_sphereZ[index], m_sphereRadius[index]));
+						}
+						else
+							visible = frustum.Contains(m_volumeTestList[node.entryIndex].volume);
+
+						if (visible)
+							func(node.entryType, node.entryIndex);
+					}
+					else
+					{
+						treeStack.push_back(node.children[0]);
+						treeStack.push_back(node.children[1]);
+					}
+					break;
+				}
+
+				case IntersectionSide_Outside:
+					break;
+			}
+		}
+	}
+
+	template<typename T>
+	template<typename F>
+	void CullingList<T>::ForEachVisibleEntry(const Frustumf& frustum, std::vector<std::size_t>& treeStack, F&& func) const
+	{
+		for (std::size_t i = 0; i < m_noTestList.size(); ++i)
+			func(CullTest::NoTest, i);
+
+		if (m_hierarchicalCulling)
+			CullTree(frustum, treeStack, func);
+		else
+		{
+			Detail::CullingPlanes planes;
+			for (unsigned int i = 0; i <= FrustumPlane_Max; ++i)
+			{
+				const Planef& plane = frustum.GetPlane(static_cast<FrustumPlane>(i));
+				planes.normalX[i] = plane.normal.x;
+				planes.normalY[i] = plane.normal.y;
+				planes.normalZ[i] = plane.normal.z;
+				planes.distance[i] = plane.distance;
+			}
+
+			std::size_t sphereCount = m_sphereTestList.size();
+			for (std::size_t batchIndex = 0; batchIndex < sphereCount; batchIndex += Detail::CullingSphereBatchSize)
+			{
+				unsigned int visibleMask = Detail::CullSphereBatch(planes, &m_sphereX[batchIndex], &m_sphereY[batchIndex], &m_sphereZ[batchIndex], &m_sphereRadius[batchIndex]);
+
+				// Ignore padding after the last sphere
+				std::size_t batchCount = std::min(sphereCount - batchIndex, Detail::CullingSphereBatchSize);
+				if (batchCount < Detail::CullingSphereBatchSize)
+					visibleMask &= (1U << batchCount) - 1U;
+
+				for (std::size_t i = 0; visibleMask != 0; ++i, visibleMask >>= 1)
+				{
+					if (visibleMask & 1U)
+						func(CullTest::Sphere, batchIndex + i);
+				}
+			}
+		}
+
+		for (std::size_t i = 0; i < m_volumeTestList.size(); ++i)
+		{
+			const VolumeVisibilityEntry& entry = m_volumeTestList[i];
+
+			// Finite volumes were already handled by the tree
+			if (entry.treeLeaf != Detail::CullingInvalidTreeNode)
+				continue;
+
+			if (frustum.Contains(entry.volume))
+				func(CullTest::Volume, i);
+		}
+	}
+
+	template<typename T>
+	void CullingList<T>::FreeTreeNode(std::size_t nodeIndex)
+	{
+		TreeNode& node = m_treeNodes[nodeIndex];
+		node.height = -1;
+		node.parent = m_treeFreeNode;
+
+		m_treeFreeNode = nodeIndex;
+	}
+
+	template<typename T>
+	void CullingList<T>::InsertTreeLeaf(std::size_t leafIndex)
+	{
+		if (m_treeRoot == Detail::CullingInvalidTreeNode)
+		{
+			m_treeRoot = leafIndex;
+			m_treeNodes[leafIndex].parent = Detail::CullingInvalidTreeNode;
+			return;
+		}
+
+		// Find the best sibling using the surface area heuristic
+		Boxf leafBox = m_treeNodes[leafIndex].aabb;
+
+		std::size_t siblingIndex = m_treeRoot;
+		while (m_treeNodes[siblingIndex].height > 0)
+		{
+			const TreeNode& node = m_treeNodes[siblingIndex];
+
+			float area = Detail::CullingBoxArea(node.aabb);
+			float combinedArea = Detail::CullingBoxArea(Detail::CullingMergeBoxes(node.aabb, leafBox));
+
+			// Cost of creating a new parent for this node and the new leaf, and minimum cost of pushing the leaf further down
+			float cost = 2.f * combinedArea;
+			float inheritanceCost = 2.f * (combinedArea - area);
+
+			float childCosts[2];
+			for (unsigned int i = 0; i < 2; ++i)
+			{
+				const TreeNode& child = m_treeNodes[node.children[i]];
+
+				float childArea = Detail::CullingBoxArea(Detail::CullingMergeBoxes(child.aabb, leafBox));
+				if (child.height > 0)
+					childArea -= Detail::CullingBoxArea(child.aabb);
+
+				childCosts[i] = childArea + inheritanceCost;
+			}
+
+			if (cost < childCosts[0] && cost < childCosts[1])
+				break;
+
+			siblingIndex = node.children[(childCosts[0] < childCosts[1]) ? 0 : 1];
+		}
+
+		std::size_t oldParentIndex = m_treeNodes[siblingIndex].parent;
+		std::size_t newParentIndex = AllocateTreeNode(); //< May reallocate the node array
+
+		TreeNode& newParent = m_treeNodes[newParentIndex];
+		TreeNode& sibling = m_treeNodes[siblingIndex];
+		newParent.aabb = Detail::CullingMergeBoxes(sibling.aabb, leafBox);
+		newParent.children[0] = siblingIndex;
+		newParent.children[1] = leafIndex;
+		newParent.height = sibling.height + 1;
+		newParent.parent = oldParentIndex;
+
+		if (oldParentIndex != Detail::CullingInvalidTreeNode)
+		{
+			TreeNode& oldParent = m_treeNodes[oldParentIndex];
+			oldParent.children[(oldParent.children[0] == siblingIndex) ? 0 : 1] = newParentIndex;
+		}
+		else
+			m_treeRoot = newParentIndex;
+
+		sibling.parent = newParentIndex;
+		m_treeNodes[leafIndex].parent = newParentIndex;
+
+		RefitTree(newParentIndex);
+	}
+
 	template<typename T>
 	void CullingList<T>::NotifyForceInvalidation(CullTest type, std::size_t index)
 	{
@@ -266,16 +742,46 @@ namespace Nz
 
 			case CullTest::Sphere:
 			{
+				std::size_t treeLeaf = m_sphereTestList[index].treeLeaf;
+				if (treeLeaf != Detail::CullingInvalidTreeNode)
+				{
+					RemoveTreeLeaf(treeLeaf);
+					FreeTreeNode(treeLeaf);
+				}
+
+				std::size_t lastIndex = m_sphereTestList.size() - 1;
+				m_sphereRadius[index] = m_sphereRadius[lastIndex];
+				m_sphereX[index] = m_sphereX[lastIndex];
+				m_sphereY[index] = m_sphereY[lastIndex];
+				m_sphereZ[index] = m_sphereZ[lastIndex];
+
 				m_sphereTestList[index] = std::move(m_sphereTestList.back());
 				m_sphereTestList[index].entry->UpdateIndex(index);
+				if (index != lastIndex && m_sphereTestList[index].treeLeaf != Detail::CullingInvalidTreeNode)
+					m_treeNodes[m_sphereTestList[index].treeLeaf].entryIndex = index;
+
 				m_sphereTestList.pop_back();
+
+				ResizeSphereArrays();
 				break;
 			}
 
 			case CullTest::Volume:
 			{
+				std::size_t treeLeaf = m_volumeTestList[index].treeLeaf;
+				if (treeLeaf != Detail::CullingInvalidTreeNode)
+				{
+					RemoveTreeLeaf(treeLeaf);
+					FreeTreeNode(treeLeaf);
+				}
+
+				std::size_t lastIndex = m_volumeTestList.size() - 1;
+
 				m_volumeTestList[index] = std::move(m_volumeTestList.back());
 				m_volumeTestList[index].entry->UpdateIndex(index);
+				if (index != lastIndex && m_volumeTestList[index].treeLeaf != Detail::CullingInvalidTreeNode)
+					m_treeNodes[m_volumeTestList[index].treeLeaf].entryIndex = index;
+
 				m_volumeTestList.pop_back();
 				break;
 			}
@@ -289,13 +795,168 @@ namespace Nz
 	template<typename T>
 	void CullingList<T>::NotifySphereUpdate(std::size_t index, const Spheref& sphere)
 	{
-		m_sphereTestList[index].sphere = sphere;
+		m_sphereRadius[index] = sphere.radius;
+		m_sphereX[index] = sphere.x;
+		m_sphereY[index] = sphere.y;
+		m_sphereZ[index] = sphere.z;
+
+		if (m_hierarchicalCulling)
+		{
+			float diameter = sphere.radius * 2.f;
+			UpdateTreeLeaf(CullTest::Sphere, index, &m_sphereTestList[index].treeLeaf, Boxf(sphere.x - sphere.radius, sphere.y - sphere.radius, sphere.z - sphere.radius, diameter, diameter, diameter));
+		}
 	}
 
 	template<typename T>
 	void CullingList<T>::NotifyVolumeUpdate(std::size_t index, const BoundingVolumef& boundingVolume)
 	{
-		m_volumeTestList[index].volume = boundingVolume;
+		VolumeVisibilityEntry& entry = m_volumeTestList[index];
+		entry.volume = boundingVolume;
+
+		if (m_hierarchicalCulling)
+		{
+			if (boundingVolume.IsFinite())
+				UpdateTreeLeaf(CullTest::Volume, index, &entry.treeLeaf, boundingVolume.aabb);
+			else if (entry.treeLeaf != Detail::CullingInvalidTreeNode)
+			{
+				// Infinite and null volumes are handled outside of the tree
+				RemoveTreeLeaf(entry.treeLeaf);
+				FreeTreeNode(entry.treeLeaf);
+
+				entry.treeLeaf = Detail::CullingInvalidTreeNode;
+			}
+		}
+	}
+
+	template<typename T>
+	void CullingList<T>::PushResult(CullTest type, std::size_t index, std::size_t* visibleHash, bool* forcedInvalidation)
+	{
+		const T* renderable;
+		bool* forceInvalidation;
+		switch (type)
+		{
+			case CullTest::NoTest:
+			{
+				NoTestVisibilityEntry& entry = m_noTestList[index];
+				renderable = entry.renderable;
+				forceInvalidation = &entry.forceInvalidation;
+				break;
+			}
+
+			case CullTest::Sphere:
+			{
+				SphereVisibilityEntry& entry = m_sphereTestList[index];
+				renderable = entry.renderable;
+				forceInvalidation = &entry.forceInvalidation;
+				break;
+			}
+
+			case CullTest::Volume:
+			default:
+			{
+				VolumeVisibilityEntry& entry = m_volumeTestList[index];
+				renderable = entry.renderable;
+				forceInvalidation = &entry.forceInvalidation;
+				break;
+			}
+		}
+
+		m_results.push_back(renderable);
+		Nz::HashCombine(*visibleHash, renderable);
+
+		if (*forceInvalidation)
+		{
+			*forcedInvalidation = true;
+			*forceInvalidation = false;
+		}
+	}
+
+	template<typename T>
+	void CullingList<T>::RefitTree(std::size_t nodeIndex)
+	{
+		// Walks back to the root, fixing the bounds and heights and balancing the tree on the way
+		while (nodeIndex != Detail::CullingInvalidTreeNode)
+		{
+			nodeIndex = BalanceTreeNode(nodeIndex);
+
+			TreeNode& node = m_treeNodes[nodeIndex];
+			const TreeNode& firstChild = m_treeNodes[node.children[0]];
+			const TreeNode& secondChild = m_treeNodes[node.children[1]];
+
+			node.aabb = Detail::CullingMergeBoxes(firstChild.aabb, secondChild.aabb);
+			node.height = 1 + std::max(firstChild.height, secondChild.height);
+
+			nodeIndex = node.parent;
+		}
+	}
+
+	template<typename T>
+	void CullingList<T>::RemoveTreeLeaf(std::size_t leafIndex)
+	{
+		// Detaches the leaf from the tree, without freeing it
+		if (leafIndex == m_treeRoot)
+		{
+			m_treeRoot = Detail::CullingInvalidTreeNode;
+			return;
+		}
+
+		std::size_t parentIndex = m_treeNodes[leafIndex].parent;
+		std::size_t grandParentIndex = m_treeNodes[parentIndex].parent;
+
+		const TreeNode& parent = m_treeNodes[parentIndex];
+		std::size_t siblingIndex = parent.children[(parent.children[0] == leafIndex) ? 1 : 0];
+
+		m_treeNodes[siblingIndex].parent = grandParentIndex;
+		FreeTreeNode(parentIndex);
+
+		if (grandParentIndex != Detail::CullingInvalidTreeNode)
+		{
+			TreeNode& grandParent = m_treeNodes[grandParentIndex];
+			grandParent.children[(grandParent.children[0] == parentIndex) ? 0 : 1] = siblingIndex;
+
+			RefitTree(grandParentIndex);
+		}
+		else
+			m_treeRoot = siblingIndex;
+	}
+
+	template<typename T>
+	void CullingList<T>::ResizeSphereArrays()
+	{
+		// Padding values are never reported as visible, but must be readable by the batch test
+		std::size_t paddedSize = (m_sphereTestList.size() + Detail::CullingSphereBatchSize - 1) / Detail::CullingSphereBatchSize * Detail::CullingSphereBatchSize;
+		m_sphereRadius.resize(paddedSize, 0.f);
+		m_sphereX.resize(paddedSize, 0.f);
+		m_sphereY.resize(paddedSize, 0.f);
+		m_sphereZ.resize(paddedSize, 0.f);
+	}
+
+	template<typename T>
+	void CullingList<T>::UpdateTreeLeaf(CullTest type, std::size_t index, std::size_t* leafIndex, const Boxf& aabb)
+	{
+		if (*leafIndex != Detail::CullingInvalidTreeNode)
+		{
+			// Nothing to do as long as the bounds stay inside the enlarged leaf
+			if (m_treeNodes[*leafIndex].aabb.Contains(aabb))
+				return;
+
+			RemoveTreeLeaf(*leafIndex);
+		}
+		else
+		{
+			*leafIndex = AllocateTreeNode();
+
+			TreeNode& leaf = m_treeNodes[*leafIndex];
+			leaf.entryIndex = index;
+			leaf.entryType = type;
+		}
+
+		Vector3f margin = aabb.GetLengths() * Detail::CullingTreeMargin;
+
+		TreeNode& leaf = m_treeNodes[*leafIndex];
+		leaf.aabb.Set(aabb.x - margin.x, aabb.y - margin.y, aabb.z - margin.z, aabb.width + 2.f * margin.x, aabb.height + 2.f * margin.y, aabb.depth + 2.f * margin.z);
+
+		InsertTreeLeaf(*leafIndex);
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -4,5 +4,7 @@
 
 #include <Nazara/Graphics/Config.hpp>
 #if NAZARA_GRAPHICS_MANAGE_MEMORY
+	#undef NAZARA_MEMORY_TAG
+	#define NAZARA_MEMORY_TAG Nz::MemoryTag_Graphics
 	#include <Nazara/Core/Debug/NewRedefinition.hpp>
 #endif
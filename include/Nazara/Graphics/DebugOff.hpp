@@ -6,4 +6,5 @@
 #if NAZARA_GRAPHICS_MANAGE_MEMORY
 	#undef delete
 	#undef new
+	#undef NAZARA_MEMORY_TAG
 #endif
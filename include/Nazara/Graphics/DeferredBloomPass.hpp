@@ -10,7 +10,6 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Graphics/DeferredRenderPass.hpp>
 #include <Nazara/Renderer/RenderStates.hpp>
-#include <Nazara/Renderer/RenderTexture.hpp>
 #include <Nazara/Renderer/Shader.hpp>
 #include <Nazara/Renderer/Texture.hpp>
 #include <Nazara/Renderer/TextureSampler.hpp>
@@ -30,7 +29,6 @@ namespace Nz
 			Texture* GetTexture(unsigned int i) const;
 
 			bool Process(const SceneData& sceneData, unsigned int firstWorkTexture, unsigned int secondWorkTexture) const override;
-			bool Resize(const Vector2ui& dimensions) override;
 
 			void SetBlurPassCount(unsigned int passCount);
 			void SetBrightLuminance(float luminance);
@@ -39,11 +37,10 @@ namespace Nz
 
 		protected:
 			RenderStates m_bloomStates;
-			RenderTexture m_bloomRTT;
 			ShaderRef m_bloomBrightShader;
 			ShaderRef m_bloomFinalShader;
 			ShaderRef m_gaussianBlurShader;
-			TextureRef m_bloomTextures[2];
+			mutable TextureRef m_bloomTextures[2];
 			TextureSampler m_bilinearSampler;
 			mutable bool m_uniformUpdated;
 			float m_brightLuminance;
@@ -10,7 +10,6 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Graphics/DeferredRenderPass.hpp>
 #include <Nazara/Renderer/RenderStates.hpp>
-#include <Nazara/Renderer/RenderTexture.hpp>
 #include <Nazara/Renderer/Shader.hpp>
 #include <Nazara/Renderer/Texture.hpp>
 #include <Nazara/Renderer/TextureSampler.hpp>
@@ -23,15 +22,14 @@ namespace Nz
 			DeferredDOFPass();
 			virtual ~DeferredDOFPass();
 
+			DeferredResourceFlags GetInputs() const override;
 			bool Process(const SceneData& sceneData, unsigned int firstWorkTexture, unsigned int secondWorkTexture) const override;
-			bool Resize(const Vector2ui& dimensions) override;
 
 		protected:
-			RenderTexture m_dofRTT;
 			RenderStates m_states;
 			ShaderConstRef m_dofShader;
 			ShaderConstRef m_gaussianBlurShader;
-			TextureRef m_dofTextures[2];
+			mutable TextureRef m_dofTextures[2];
 			TextureSampler m_bilinearSampler;
 			TextureSampler m_pointSampler;
 			int m_gaussianBlurShaderFilterLocation;
@@ -10,6 +10,7 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Graphics/DeferredRenderPass.hpp>
 #include <Nazara/Renderer/RenderStates.hpp>
+#include <Nazara/Renderer/Shader.hpp>
 #include <Nazara/Renderer/TextureSampler.hpp>
 #include <Nazara/Renderer/UberShader.hpp>
 
@@ -21,15 +22,25 @@ namespace Nz
 			DeferredFinalPass();
 			virtual ~DeferredFinalPass();
 
+			DeferredResourceFlags GetOutputs() const override;
+			float GetSharpness() const;
+
 			bool Process(const SceneData& sceneData, unsigned int firstWorkTexture, unsigned int secondWorkTexture) const override;
 
+			void SetSharpness(float sharpness);
+
 		protected:
 			RenderStates m_states;
+			ShaderRef m_upscaleShader;
+			TextureSampler m_bilinearSampler;
 			TextureSampler m_pointSampler;
 			UberShaderConstRef m_uberShader;
 			const UberShaderInstance* m_uberShaderInstance;
+			float m_sharpness;
 			int m_materialDiffuseUniform;
 			int m_materialDiffuseMapUniform;
+			int m_upscaleSharpnessUniform;
+			int m_upscaleViewportRectUniform;
 	};
 }
 
@@ -20,6 +20,7 @@ namespace Nz
 			DeferredForwardPass();
 			virtual ~DeferredForwardPass();
 
+			DeferredResourceFlags GetInputs() const override;
 			void Initialize(DeferredRenderTechnique* technique) override;
 			bool Process(const SceneData& sceneData, unsigned int workTexture, unsigned int sceneTexture) const override;
 
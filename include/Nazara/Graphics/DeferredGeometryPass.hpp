@@ -10,8 +10,11 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Graphics/BasicRenderQueue.hpp>
 #include <Nazara/Graphics/DeferredRenderPass.hpp>
+#include <Nazara/Graphics/MaterialPipeline.hpp>
+#include <Nazara/Renderer/CommandBuffer.hpp>
 #include <Nazara/Renderer/RenderStates.hpp>
 #include <Nazara/Renderer/Shader.hpp>
+#include <Nazara/Renderer/StreamBuffer.hpp>
 #include <unordered_map>
 
 namespace Nz
@@ -24,6 +27,8 @@ namespace Nz
 			DeferredGeometryPass();
 			virtual ~DeferredGeometryPass();
 
+			DeferredResourceFlags GetInputs() const override;
+			DeferredResourceFlags GetOutputs() const override;
 			bool Process(const SceneData& sceneData, unsigned int firstWorkTexture, unsigned int secondWorkTexture) const override;
 			bool Resize(const Vector2ui& dimensions) override;
 
@@ -37,10 +42,21 @@ namespace Nz
 
 			const ShaderUniforms* GetShaderUniforms(const Shader* shader) const;
 			void OnShaderInvalidated(const Shader* shader) const;
+			std::size_t RecordModels(const SceneData& sceneData, const RenderQueue<BasicRenderQueue::Model>& models) const;
 
 			static bool Initialize();
 			static void Uninitialize();
 
+			struct ModelBatch
+			{
+				const MaterialPipeline::Instance* pipelineInstance;
+				const ShaderUniforms* shaderUniforms;
+				std::size_t firstModel;
+				std::size_t modelCount;
+				bool indirect;
+				bool instancing;
+			};
+
 			struct ShaderUniforms
 			{
 				NazaraSlot(Shader, OnShaderUniformInvalidated, shaderUniformInvalidatedSlot);
@@ -48,12 +64,16 @@ namespace Nz
 
 				int eyePosition;
 				int sceneAmbient;
+				int skinningMatrices;
 				int textureOverlay;
 			};
 
 			mutable std::unordered_map<const Shader*, ShaderUniforms> m_shaderUniforms;
+			mutable std::vector<CommandBuffer> m_commandBuffers;
+			mutable std::vector<const BasicRenderQueue::Model*> m_batchModels;
+			mutable std::vector<ModelBatch> m_modelBatches;
 			mutable std::vector<std::pair<const VertexStruct_XYZ_Color_UV*, std::size_t>> m_spriteChains;
-			Buffer m_vertexBuffer;
+			mutable StreamBuffer m_vertexBuffer;
 			RenderStates m_clearStates;
 			ShaderRef m_clearShader;
 			TextureRef m_whiteTexture;
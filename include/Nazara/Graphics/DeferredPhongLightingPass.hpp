@@ -10,9 +10,12 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Graphics/DeferredRenderPass.hpp>
 #include <Nazara/Graphics/Light.hpp>
+#include <Nazara/Renderer/RenderStates.hpp>
 #include <Nazara/Renderer/Shader.hpp>
 #include <Nazara/Renderer/TextureSampler.hpp>
+#include <Nazara/Utility/Buffer.hpp>
 #include <Nazara/Utility/Mesh.hpp>
+#include <vector>
 
 namespace Nz
 {
@@ -25,27 +28,42 @@ namespace Nz
 			virtual ~DeferredPhongLightingPass();
 
 			void EnableLightMeshesDrawing(bool enable);
+			void EnableTiledLighting(bool enable);
+
+			DeferredResourceFlags GetInputs() const override;
+			DeferredResourceFlags GetOutputs() const override;
 
 			bool IsLightMeshesDrawingEnabled() const;
+			bool IsTiledLightingEnabled() const;
 
 			bool Process(const SceneData& sceneData, unsigned int firstWorkTexture, unsigned int secondWorkTexture) const override;
 
 		protected:
+			void DrawTiledLights(const SceneData& sceneData, const RenderStates& lightStates) const;
+
+			mutable std::vector<LightBlockData> m_lightBlockData;
+			mutable std::vector<UInt32> m_lightTiles; //< Mask of the lights reaching each tile, four words per tile
+			mutable Buffer m_lightBuffer;
 			LightUniforms m_directionalLightUniforms;
 			LightUniforms m_pointSpotLightUniforms;
 			MeshRef m_cone;
 			MeshRef m_sphere;
 			ShaderRef m_directionalLightShader;
 			ShaderRef m_pointSpotLightShader;
+			ShaderRef m_tiledLightShader;
+			mutable TextureRef m_lightTileTexture;
 			TextureSampler m_pointSampler;
 			StaticMesh* m_coneMesh;
 			StaticMesh* m_sphereMesh;
 			bool m_lightMeshesDrawing;
+			bool m_tiledLighting;
 			int m_directionalLightShaderEyePositionLocation;
 			int m_directionalLightShaderSceneAmbientLocation;
 			int m_pointSpotLightShaderDiscardLocation;
 			int m_pointSpotLightShaderEyePositionLocation;
 			int m_pointSpotLightShaderSceneAmbientLocation;
+			int m_tiledLightShaderEyePositionLocation;
+			int m_tiledLightShaderSceneAmbientLocation;
 	};
 }
 
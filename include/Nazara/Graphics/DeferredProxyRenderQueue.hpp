@@ -40,9 +40,12 @@ namespace Nz
 			void AddBillboards(int renderOrder, const Material* material, std::size_t billboardCount, const Recti& scissorRect, SparsePtr<const Vector3f> positionPtr, SparsePtr<const float> sizePtr, SparsePtr<const float> anglePtr, SparsePtr<const float> alphaPtr) override;
 			void AddDrawable(int renderOrder, const Drawable* drawable) override;
 			void AddMesh(int renderOrder, const Material* material, const MeshData& meshData, const Boxf& meshAABB, const Matrix4f& transformMatrix, const Recti& scissorRect) override;
-			void AddSprites(int renderOrder, const Material* material, const VertexStruct_XYZ_Color_UV* vertices, std::size_t spriteCount, const Recti& scissorRect, const Texture* overlay = nullptr) override;
+			void AddReflectionProbe(const ReflectionProbe& probe) override;
+			void AddSkinnedMesh(int renderOrder, const Material* material, const MeshData& meshData, const Boxf& meshAABB, const Matrix4f& transformMatrix, const Matrix4f* jointMatrices, std::size_t jointCount, const Recti& scissorRect) override;
+			void AddSprites(int renderOrder, const Material* material, const VertexStruct_XYZ_Color_UV* vertices, std::size_t spriteCount, const Recti& scissorRect, const Texture* overlay = nullptr, unsigned int overlayLayer = 0, const SpriteInstance* instances = nullptr) override;
 
 			void Clear(bool fully = false) override;
+			void ClearLights() override;
 
 			inline BasicRenderQueue* GetDeferredRenderQueue();
 			inline BasicRenderQueue* GetForwardRenderQueue();
@@ -9,6 +9,7 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Graphics/Config.hpp>
+#include <Nazara/Graphics/Enums.hpp>
 #include <Nazara/Math/Vector2.hpp>
 
 namespace Nz
@@ -30,6 +31,9 @@ namespace Nz
 
 			void Enable(bool enable);
 
+			virtual DeferredResourceFlags GetInputs() const;
+			virtual DeferredResourceFlags GetOutputs() const;
+
 			virtual void Initialize(DeferredRenderTechnique* technique);
 
 			bool IsEnabled() const;
@@ -12,10 +12,13 @@
 #include <Nazara/Graphics/DeferredProxyRenderQueue.hpp>
 #include <Nazara/Graphics/ForwardRenderTechnique.hpp>
 #include <Nazara/Math/Vector2.hpp>
+#include <Nazara/Renderer/RenderTargetPool.hpp>
 #include <Nazara/Renderer/RenderTexture.hpp>
 #include <Nazara/Renderer/Texture.hpp>
 #include <map>
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace Nz
 {
@@ -26,9 +29,13 @@ namespace Nz
 		friend class Graphics;
 
 		public:
+			struct TransientTarget;
+
 			DeferredRenderTechnique();
 			~DeferredRenderTechnique();
 
+			const TransientTarget* AcquireTransientTarget(PixelFormatType format, const Vector2ui& size, unsigned int colorTargetCount) const;
+
 			void Clear(const SceneData& sceneData) const override;
 			bool Draw(const SceneData& sceneData) const override;
 
@@ -40,6 +47,8 @@ namespace Nz
 			const ForwardRenderTechnique* GetForwardTechnique() const;
 			DeferredRenderPass* GetPass(RenderPassType renderPass, int position = 0);
 			AbstractRenderQueue* GetRenderQueue() override;
+			float GetResolutionScale() const;
+			RenderTargetPool& GetTargetPool() const;
 			RenderTechniqueType GetType() const override;
 			RenderTexture* GetWorkRTT() const;
 			Texture* GetWorkTexture(unsigned int i) const;
@@ -49,10 +58,21 @@ namespace Nz
 			DeferredRenderPass* ResetPass(RenderPassType renderPass, int position);
 
 			void SetPass(RenderPassType relativeTo, int position, DeferredRenderPass* pass);
+			void SetResolutionScale(float scale);
 
 			static bool IsSupported();
 
+			struct TransientTarget
+			{
+				PixelFormatType format;
+				RenderTexture renderTexture;
+				std::vector<TextureRef> textures;
+				Vector2ui size;
+				bool acquired;
+			};
+
 		private:
+			void ReleaseTransientTargets() const;
 			bool Resize(const Vector2ui& dimensions) const;
 
 			static bool Initialize();
@@ -64,6 +84,9 @@ namespace Nz
 			};
 
 			std::map<RenderPassType, std::map<int, std::unique_ptr<DeferredRenderPass>>, RenderPassComparator> m_passes;
+			mutable std::vector<std::pair<RenderPassType, const DeferredRenderPass*>> m_passSchedule;
+			mutable std::vector<std::unique_ptr<TransientTarget>> m_transientTargets;
+			mutable RenderTargetPool m_targetPool;
 			BasicRenderQueue m_deferredRenderQueue; // Must be initialized before the ProxyRenderQueue
 			ForwardRenderTechnique m_forwardTechnique; // Must be initialized before the ProxyRenderQueue
 			DeferredProxyRenderQueue m_renderQueue;
@@ -74,6 +97,7 @@ namespace Nz
 			mutable TextureRef m_workTextures[2];
 			mutable Vector2ui m_GBufferSize;
 			const RenderTarget* m_viewerTarget;
+			float m_resolutionScale;
 	};
 }
 
@@ -31,8 +31,9 @@ namespace Nz
 			void AddDirectionalLight(const DirectionalLight& light) override;
 			void AddMesh(int renderOrder, const Material* material, const MeshData& meshData, const Boxf& meshAABB, const Matrix4f& transformMatrix, const Recti& scissorRect) override;
 			void AddPointLight(const PointLight& light) override;
+			void AddSkinnedMesh(int renderOrder, const Material* material, const MeshData& meshData, const Boxf& meshAABB, const Matrix4f& transformMatrix, const Matrix4f* jointMatrices, std::size_t jointCount, const Recti& scissorRect) override;
 			void AddSpotLight(const SpotLight& light) override;
-			void AddSprites(int renderOrder, const Material* material, const VertexStruct_XYZ_Color_UV* vertices, std::size_t spriteCount, const Recti& scissorRect, const Texture* overlay = nullptr) override;
+			void AddSprites(int renderOrder, const Material* material, const VertexStruct_XYZ_Color_UV* vertices, std::size_t spriteCount, const Recti& scissorRect, const Texture* overlay = nullptr, unsigned int overlayLayer = 0, const SpriteInstance* instances = nullptr) override;
 
 	private:
 			inline bool IsMaterialSuitable(const Material* material) const;
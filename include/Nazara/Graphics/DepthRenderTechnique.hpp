@@ -12,6 +12,7 @@
 #include <Nazara/Graphics/Config.hpp>
 #include <Nazara/Graphics/DepthRenderQueue.hpp>
 #include <Nazara/Renderer/Shader.hpp>
+#include <Nazara/Renderer/StreamBuffer.hpp>
 #include <Nazara/Utility/IndexBuffer.hpp>
 #include <Nazara/Utility/VertexBuffer.hpp>
 
@@ -58,12 +59,14 @@ namespace Nz
 
 				// Autre uniformes
 				int sceneAmbient;
+				int skinningMatrices;
 				int textureOverlay;
 			};
 
 			mutable std::unordered_map<const Shader*, ShaderUniforms> m_shaderUniforms;
 			mutable std::vector<std::pair<const VertexStruct_XYZ_Color_UV*, std::size_t>> m_spriteChains;
-			Buffer m_vertexBuffer;
+			mutable std::vector<UInt32> m_visibleMeshlets;
+			mutable StreamBuffer m_vertexBuffer;
 			RenderStates m_clearStates;
 			ShaderRef m_clearShader;
 			TextureRef m_whiteTexture;
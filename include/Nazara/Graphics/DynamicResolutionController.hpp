@@ -0,0 +1,48 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_DYNAMICRESOLUTIONCONTROLLER_HPP
+#define NAZARA_DYNAMICRESOLUTIONCONTROLLER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Graphics/Config.hpp>
+
+namespace Nz
+{
+	class NAZARA_GRAPHICS_API DynamicResolutionController
+	{
+		public:
+			DynamicResolutionController(UInt64 gpuBudget = 14000000, float minScale = 0.5f, float maxScale = 1.f);
+			~DynamicResolutionController() = default;
+
+			inline UInt64 GetBudget() const;
+			inline float GetMaximumScale() const;
+			inline float GetMinimumScale() const;
+			inline float GetScale() const;
+
+			void Reset();
+
+			inline void SetBudget(UInt64 gpuBudget);
+			void SetScaleRange(float minScale, float maxScale);
+
+			bool Update(UInt64 gpuTime);
+
+			static constexpr float ScaleStep = 0.05f;
+
+		private:
+			double m_averageTime;
+			UInt64 m_budget;
+			float m_maxScale;
+			float m_minScale;
+			float m_scale;
+			unsigned int m_ignoredFrames;
+			unsigned int m_underBudgetFrames;
+	};
+}
+
+#include <Nazara/Graphics/DynamicResolutionController.inl>
+
+#endif // NAZARA_DYNAMICRESOLUTIONCONTROLLER_HPP
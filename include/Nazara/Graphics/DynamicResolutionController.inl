@@ -0,0 +1,57 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the GPU time the frames should fit in
+	* \return Budget in nanoseconds
+	*/
+	inline UInt64 DynamicResolutionController::GetBudget() const
+	{
+		return m_budget;
+	}
+
+	/*!
+	* \brief Gets the highest scale the controller may choose
+	* \return Maximum scale
+	*/
+	inline float DynamicResolutionController::GetMaximumScale() const
+	{
+		return m_maxScale;
+	}
+
+	/*!
+	* \brief Gets the lowest scale the controller may choose
+	* \return Minimum scale
+	*/
+	inline float DynamicResolutionController::GetMinimumScale() const
+	{
+		return m_minScale;
+	}
+
+	/*!
+	* \brief Gets the current resolution scale
+	* \return Ratio to apply to both dimensions of the viewports
+	*/
+	inline float DynamicResolutionController::GetScale() const
+	{
+		return m_scale;
+	}
+
+	/*!
+	* \brief Sets the GPU time the frames should fit in
+	*
+	* \param gpuBudget Budget in nanoseconds, usually a bit less than the duration of a frame at the targeted frame rate
+	*/
+	inline void DynamicResolutionController::SetBudget(UInt64 gpuBudget)
+	{
+		m_budget = gpuBudget;
+		m_underBudgetFrames = 0;
+	}
+}
+
+#include <Nazara/Graphics/DebugOff.hpp>
@@ -7,6 +7,8 @@
 #ifndef NAZARA_ENUMS_GRAPHICS_HPP
 #define NAZARA_ENUMS_GRAPHICS_HPP
 
+#include <Nazara/Core/Flags.hpp>
+
 namespace Nz
 {
 	enum BackgroundType
@@ -26,6 +28,24 @@ namespace Nz
 		Volume
 	};
 
+	enum DeferredResource
+	{
+		DeferredResource_DepthStencil, // Depth-stencil buffer shared by the G-Buffer and the work textures
+		DeferredResource_GBuffer,      // Color textures of the G-Buffer
+		DeferredResource_Scene,        // Scene color, held by the work textures
+		DeferredResource_Target,       // Render target of the viewer
+
+		DeferredResource_Max = DeferredResource_Target
+	};
+
+	template<>
+	struct EnumAsFlags<DeferredResource>
+	{
+		static constexpr DeferredResource max = DeferredResource_Max;
+	};
+
+	using DeferredResourceFlags = Flags<DeferredResource>;
+
 	enum ProjectionType
 	{
 		ProjectionType_Orthogonal,
@@ -95,6 +115,14 @@ namespace Nz
 		ParticleLayout_Max = ParticleLayout_Sprite
 	};
 
+	enum ParticleStorage
+	{
+		ParticleStorage_Interleaved, // Array of structures: every component of a particle is contiguous
+		ParticleStorage_Separated,   // Structure of arrays: every particle value of a component is contiguous
+
+		ParticleStorage_Max = ParticleStorage_Separated
+	};
+
 	enum RenderPassType
 	{
 		RenderPassType_AA,
@@ -150,11 +178,15 @@ namespace Nz
 	{
 		ShaderFlags_None = 0,
 
-		ShaderFlags_Billboard      = 0x01,
-		ShaderFlags_Deferred       = 0x02,
-		ShaderFlags_Instancing     = 0x04,
-		ShaderFlags_TextureOverlay = 0x08,
-		ShaderFlags_VertexColor    = 0x10,
+		ShaderFlags_Billboard           = 0x01,
+		ShaderFlags_ClusteredLighting   = 0x02, //< Lights are read from the clusters of the forward render technique, in a single pass
+		ShaderFlags_Deferred            = 0x04,
+		ShaderFlags_Instancing          = 0x08,
+		ShaderFlags_Skinning            = 0x10,
+		ShaderFlags_Sprite              = 0x20, //< Sprites are expanded from instance records (see AbstractRenderQueue::SpriteInstance) by the vertex shader
+		ShaderFlags_TextureOverlay      = 0x40,
+		ShaderFlags_TextureOverlayArray = 0x80, //< The overlay is a texture array, indexed by the Userdata0 vertex component
+		ShaderFlags_VertexColor         = 0x100,
 
 		ShaderFlags_Max = ShaderFlags_VertexColor * 2 - 1
 	};
@@ -165,6 +197,7 @@ namespace Nz
 		TextureMap_Diffuse,
 		TextureMap_Emissive,
 		TextureMap_Height,
+		TextureMap_LightClusters,
 		TextureMap_ReflectionCube,
 		TextureMap_Normal,
 		TextureMap_Overlay,
@@ -178,6 +211,14 @@ namespace Nz
 
 		TextureMap_Max = TextureMap_Specular
 	};
+
+	enum UniformBlock
+	{
+		UniformBlock_Lights,
+		UniformBlock_Material,
+
+		UniformBlock_Max = UniformBlock_Material
+	};
 }
 
 #endif // NAZARA_ENUMS_GRAPHICS_HPP
@@ -12,9 +12,18 @@
 #include <Nazara/Graphics/Config.hpp>
 #include <Nazara/Graphics/BasicRenderQueue.hpp>
 #include <Nazara/Graphics/Light.hpp>
+#include <Nazara/Graphics/MaterialPipeline.hpp>
+#include <Nazara/Math/Vector2.hpp>
+#include <Nazara/Math/Vector4.hpp>
+#include <Nazara/Renderer/CommandBuffer.hpp>
+#include <Nazara/Renderer/RenderStates.hpp>
+#include <Nazara/Renderer/RenderTexture.hpp>
 #include <Nazara/Renderer/Shader.hpp>
+#include <Nazara/Renderer/StreamBuffer.hpp>
+#include <Nazara/Utility/Buffer.hpp>
 #include <Nazara/Utility/IndexBuffer.hpp>
 #include <Nazara/Utility/VertexBuffer.hpp>
+#include <array>
 
 namespace Nz
 {
@@ -27,10 +36,14 @@ namespace Nz
 			void Clear(const SceneData& sceneData) const override;
 			bool Draw(const SceneData& sceneData) const override;
 
+			void EnableClusteredLighting(bool clusteredLighting);
+
 			unsigned int GetMaxLightPassPerObject() const;
 			AbstractRenderQueue* GetRenderQueue() override;
 			RenderTechniqueType GetType() const override;
 
+			bool IsClusteredLightingEnabled() const;
+
 			void SetMaxLightPassPerObject(unsigned int maxLightPassPerObject);
 
 			static bool Initialize();
@@ -40,15 +53,20 @@ namespace Nz
 			struct ShaderUniforms;
 
 			void ChooseLights(const Spheref& object, bool includeDirectionalLights = true) const;
+			const Texture* ChooseReflectionProbe(const Spheref& object, const Texture* defaultCubemap) const;
 			void DrawBillboards(const SceneData& sceneData, const BasicRenderQueue& renderQueue, const RenderQueue<BasicRenderQueue::Billboard>& billboards) const;
 			void DrawBillboards(const SceneData& sceneData, const BasicRenderQueue& renderQueue, const RenderQueue<BasicRenderQueue::BillboardChain>& billboards) const;
 			void DrawCustomDrawables(const SceneData& sceneData, const BasicRenderQueue& renderQueue, const RenderQueue<BasicRenderQueue::CustomDrawable>& customDrawables) const;
 			void DrawModels(const SceneData& sceneData, const BasicRenderQueue& renderQueue, const RenderQueue<BasicRenderQueue::Model>& models) const;
+			void DrawOrderIndependentTransparency(const SceneData& sceneData) const;
 			void DrawSprites(const SceneData& sceneData, const BasicRenderQueue& renderQueue, const RenderQueue<BasicRenderQueue::SpriteChain>& sprites) const;
 
 			const ShaderUniforms* GetShaderUniforms(const Shader* shader) const;
 			void OnShaderInvalidated(const Shader* shader) const;
+			std::size_t RecordModels(const SceneData& sceneData, const RenderQueue<BasicRenderQueue::Model>& models) const;
 			void SendLightUniforms(const Shader* shader, const LightUniforms& uniforms, unsigned int index, unsigned int lightIndex, unsigned int uniformOffset) const;
+			void UpdateLightClusters(const SceneData& sceneData) const;
+			void UploadLights() const;
 
 			static float ComputeDirectionalLightScore(const Spheref& object, const AbstractRenderQueue::DirectionalLight& light);
 			static float ComputePointLightScore(const Spheref& object, const AbstractRenderQueue::PointLight& light);
@@ -64,6 +82,23 @@ namespace Nz
 				unsigned int index;
 			};
 
+			struct ModelBatch
+			{
+				const MaterialPipeline::Instance* pipelineInstance;
+				const ShaderUniforms* shaderUniforms;
+				std::size_t firstModel; //< Index of the first model of the batch in m_batchModels
+				std::size_t modelCount;
+				bool instancing;
+			};
+
+			struct SpriteChainView
+			{
+				const AbstractRenderQueue::SpriteInstance* instances;
+				const VertexStruct_XYZ_Color_UV* vertices;
+				std::size_t spriteCount;
+				unsigned int overlayLayer;
+			};
+
 			struct ShaderUniforms
 			{
 				NazaraSlot(Shader, OnShaderUniformInvalidated, shaderUniformInvalidatedSlot);
@@ -76,30 +111,56 @@ namespace Nz
 				/// this may not work everywhere
 				int lightOffset; // "Distance" between Lights[0].type and Lights[1].type
 
+				// Clustered lighting
+				int lightClusterOffset;
+				int lightClusterParameters;
+
 				// Other uniforms
 				int eyePosition;
 				int reflectionMap;
 				int sceneAmbient;
+				int skinningMatrices;
 				int textureOverlay;
 			};
 
+			mutable std::array<unsigned int, LightType_Max + 2> m_lightBlockOffsets; //< Index of the first light of each type in the light block, followed by the light count
 			mutable std::unordered_map<const Shader*, ShaderUniforms> m_shaderUniforms;
+			mutable std::vector<CommandBuffer> m_commandBuffers;
+			mutable std::vector<const BasicRenderQueue::Model*> m_batchModels;
+			mutable std::vector<ModelBatch> m_modelBatches;
+			mutable std::vector<LightBlockData> m_lightBlockData;
+			mutable std::vector<UInt32> m_lightClusters; //< Mask of the lights reaching each cluster, four words per cluster
 			mutable std::vector<LightIndex> m_lights;
-			mutable std::vector<std::pair<const VertexStruct_XYZ_Color_UV*, std::size_t>> m_spriteChains;
-			Buffer m_vertexBuffer;
+			mutable std::vector<SpriteChainView> m_spriteChains;
+			mutable StreamBuffer m_vertexBuffer;
 			mutable BasicRenderQueue m_renderQueue;
+			mutable Buffer m_lightBuffer;
+			mutable RenderTexture m_oitTarget;
+			mutable TextureRef m_lightClusterTexture;
+			mutable TextureRef m_oitAccumulationTexture;
+			mutable TextureRef m_oitRevealageTexture;
+			mutable Vector2f m_lightClusterOffset;
+			mutable Vector2ui m_oitTargetSize;
+			mutable Vector4f m_lightClusterParameters;
 			TextureRef m_whiteCubemap;
 			TextureRef m_whiteTexture;
 			VertexBuffer m_billboardPointBuffer;
+			VertexBuffer m_layeredSpriteBuffer;
 			VertexBuffer m_spriteBuffer;
 			unsigned int m_maxLightPassPerObject;
+			bool m_clusteredLighting;
 
 			static IndexBuffer s_quadIndexBuffer;
+			static RenderStates s_oitCompositeStates;
+			static ShaderRef s_oitCompositeShader;
+			static TextureSampler s_lightClusterSampler;
 			static TextureSampler s_reflectionSampler;
 			static TextureSampler s_shadowSampler;
 			static VertexBuffer s_quadVertexBuffer;
 			static VertexDeclaration s_billboardInstanceDeclaration;
 			static VertexDeclaration s_billboardVertexDeclaration;
+			static VertexDeclaration s_layeredSpriteVertexDeclaration;
+			static VertexDeclaration s_spriteInstanceDeclaration;
 	};
 }
 
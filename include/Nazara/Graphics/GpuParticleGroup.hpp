@@ -0,0 +1,105 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_GPUPARTICLEGROUP_HPP
+#define NAZARA_GPUPARTICLEGROUP_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Color.hpp>
+#include <Nazara/Graphics/Config.hpp>
+#include <Nazara/Graphics/Drawable.hpp>
+#include <Nazara/Graphics/Material.hpp>
+#include <Nazara/Graphics/Renderable.hpp>
+#include <Nazara/Math/Vector2.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <Nazara/Math/Vector4.hpp>
+#include <Nazara/Renderer/Shader.hpp>
+#include <Nazara/Utility/VertexBuffer.hpp>
+#include <Nazara/Utility/VertexDeclaration.hpp>
+#include <array>
+#include <vector>
+
+namespace Nz
+{
+	class ParticleDeclaration;
+	class ParticleGroup;
+	class ParticleMapper;
+
+	class NAZARA_GRAPHICS_API GpuParticleGroup : public Renderable, public Drawable
+	{
+		friend class Graphics;
+
+		public:
+			GpuParticleGroup(unsigned int maxParticleCount, MaterialRef material = Material::GetDefault());
+			GpuParticleGroup(const GpuParticleGroup&) = delete;
+			GpuParticleGroup(GpuParticleGroup&&) = delete;
+			~GpuParticleGroup() = default;
+
+			void AddToRenderQueue(AbstractRenderQueue* renderQueue, const Matrix4f& transformMatrix) const override;
+
+			void Draw() const override;
+
+			inline const Vector3f& GetAcceleration() const;
+			inline float GetAngularVelocity() const;
+			inline const Color& GetFinalColor() const;
+			inline float GetFinalSizeFactor() const;
+			inline const MaterialRef& GetMaterial() const;
+			inline std::size_t GetMaxParticleCount() const;
+
+			inline void SetAcceleration(const Vector3f& acceleration);
+			inline void SetAngularVelocity(float angularVelocity);
+			inline void SetFinalColor(const Color& color);
+			inline void SetFinalSizeFactor(float sizeFactor);
+			inline void SetMaterial(MaterialRef material);
+
+			void Spawn(const ParticleMapper& mapper, const ParticleDeclaration& declaration, std::size_t particleCount);
+			void Spawn(ParticleGroup& group);
+
+			inline void Update(float elapsedTime);
+
+			GpuParticleGroup& operator=(const GpuParticleGroup&) = delete;
+			GpuParticleGroup& operator=(GpuParticleGroup&&) = delete;
+
+		private:
+			void MakeBoundingVolume() const override;
+			void Simulate() const;
+
+			static bool Initialize();
+			static void Uninitialize();
+
+			struct Particle
+			{
+				Vector4f color;
+				Vector3f position;
+				float life;
+				Vector3f velocity;
+				float lifetime;
+				Vector2f size;
+				float rotation;
+			};
+
+			std::size_t m_maxParticleCount;
+			mutable std::array<VertexBuffer, 2> m_stateBuffers; //< Simulation reads one and writes the other
+			mutable std::vector<Particle> m_spawnedParticles;
+			mutable std::size_t m_currentBuffer;
+			mutable std::size_t m_spawnCursor;
+			mutable std::size_t m_usedParticleCount;
+			Color m_finalColor;
+			MaterialRef m_material;
+			Vector3f m_acceleration;
+			float m_angularVelocity;
+			float m_finalSizeFactor;
+			mutable float m_pendingTime;
+
+			static ShaderRef s_renderShader;
+			static ShaderRef s_updateShader;
+			static VertexDeclarationRef s_particleDeclaration;
+	};
+}
+
+#include <Nazara/Graphics/GpuParticleGroup.inl>
+
+#endif // NAZARA_GPUPARTICLEGROUP_HPP
@@ -0,0 +1,133 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the acceleration applied to the velocity of every particle
+	* \return Acceleration, in units per second squared
+	*/
+	inline const Vector3f& GpuParticleGroup::GetAcceleration() const
+	{
+		return m_acceleration;
+	}
+
+	/*!
+	* \brief Gets the rotation speed of every particle
+	* \return Angular velocity, in degrees per second
+	*/
+	inline float GpuParticleGroup::GetAngularVelocity() const
+	{
+		return m_angularVelocity;
+	}
+
+	/*!
+	* \brief Gets the color particles are multiplied by when they die
+	* \return Final color
+	*/
+	inline const Color& GpuParticleGroup::GetFinalColor() const
+	{
+		return m_finalColor;
+	}
+
+	/*!
+	* \brief Gets the factor the size of particles is multiplied by when they die
+	* \return Final size factor
+	*/
+	inline float GpuParticleGroup::GetFinalSizeFactor() const
+	{
+		return m_finalSizeFactor;
+	}
+
+	/*!
+	* \brief Gets the material used to draw the particles
+	* \return Material
+	*/
+	inline const MaterialRef& GpuParticleGroup::GetMaterial() const
+	{
+		return m_material;
+	}
+
+	/*!
+	* \brief Gets the maximum number of particles alive at the same time
+	* \return Capacity of the group
+	*/
+	inline std::size_t GpuParticleGroup::GetMaxParticleCount() const
+	{
+		return m_maxParticleCount;
+	}
+
+	/*!
+	* \brief Sets the acceleration applied to the velocity of every particle
+	*
+	* \param acceleration Acceleration, in units per second squared (gravity for example)
+	*/
+	inline void GpuParticleGroup::SetAcceleration(const Vector3f& acceleration)
+	{
+		m_acceleration = acceleration;
+	}
+
+	/*!
+	* \brief Sets the rotation speed of every particle
+	*
+	* \param angularVelocity Angular velocity, in degrees per second
+	*/
+	inline void GpuParticleGroup::SetAngularVelocity(float angularVelocity)
+	{
+		m_angularVelocity = angularVelocity;
+	}
+
+	/*!
+	* \brief Sets the color particles are multiplied by when they die
+	*
+	* The color of a particle goes from its own color at its birth to its color multiplied by this one at its death.
+	*
+	* \param color Final color, white (the default) keeps the color of the particles
+	*/
+	inline void GpuParticleGroup::SetFinalColor(const Color& color)
+	{
+		m_finalColor = color;
+	}
+
+	/*!
+	* \brief Sets the factor the size of particles is multiplied by when they die
+	*
+	* \param sizeFactor Final size factor, one (the default) keeps the size of the particles
+	*/
+	inline void GpuParticleGroup::SetFinalSizeFactor(float sizeFactor)
+	{
+		m_finalSizeFactor = sizeFactor;
+	}
+
+	/*!
+	* \brief Sets the material used to draw the particles
+	*
+	* Its render states, diffuse color and diffuse map are used.
+	*
+	* \param material Material
+	*/
+	inline void GpuParticleGroup::SetMaterial(MaterialRef material)
+	{
+		NazaraAssert(material, "Invalid material");
+
+		m_material = std::move(material);
+	}
+
+	/*!
+	* \brief Advances the simulation
+	*
+	* \param elapsedTime Time elapsed since the last update, in seconds
+	*
+	* \remark The particles are only moved by the GPU the next time the group is drawn, which batches the updates of a frame together
+	*/
+	inline void GpuParticleGroup::Update(float elapsedTime)
+	{
+		m_pendingTime += elapsedTime;
+	}
+}
+
+#include <Nazara/Graphics/DebugOff.hpp>
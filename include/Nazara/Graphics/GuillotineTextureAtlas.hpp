@@ -9,6 +9,7 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Graphics/Config.hpp>
+#include <Nazara/Renderer/Texture.hpp>
 #include <Nazara/Utility/GuillotineImageAtlas.hpp>
 
 namespace Nz
@@ -16,13 +17,53 @@ namespace Nz
 	class NAZARA_GRAPHICS_API GuillotineTextureAtlas : public GuillotineImageAtlas
 	{
 		public:
-			GuillotineTextureAtlas() = default;
+			class ArrayLayer;
+
+			GuillotineTextureAtlas(unsigned int arrayLayerSize = 0);
 			~GuillotineTextureAtlas() = default;
 
+			void Clear() override;
+
+			unsigned int GetArrayLayerSize() const;
 			UInt32 GetStorage() const override;
 
+			bool IsUsingTextureArray() const;
+
+			class NAZARA_GRAPHICS_API ArrayLayer : public AbstractImage
+			{
+				public:
+					ArrayLayer(const GuillotineTextureAtlas* atlas, unsigned int layerIndex);
+					~ArrayLayer() = default;
+
+					unsigned int GetDepth(UInt8 level = 0) const override;
+					PixelFormatType GetFormat() const override;
+					unsigned int GetHeight(UInt8 level = 0) const override;
+					unsigned int GetLayerIndex() const;
+					UInt8 GetLevelCount() const override;
+					UInt8 GetMaxLevel() const override;
+					std::size_t GetMemoryUsage() const override;
+					std::size_t GetMemoryUsage(UInt8 level) const override;
+					Vector3ui GetSize(UInt8 level = 0) const override;
+					Texture* GetTexture() const;
+					ImageType GetType() const override;
+					unsigned int GetWidth(UInt8 level = 0) const override;
+
+					bool Update(const UInt8* pixels, unsigned int srcWidth = 0, unsigned int srcHeight = 0, UInt8 level = 0) override;
+					bool Update(const UInt8* pixels, const Boxui& box, unsigned int srcWidth = 0, unsigned int srcHeight = 0, UInt8 level = 0) override;
+					bool Update(const UInt8* pixels, const Rectui& rect, unsigned int z = 0, unsigned int srcWidth = 0, unsigned int srcHeight = 0, UInt8 level = 0) override;
+
+				private:
+					const GuillotineTextureAtlas* m_atlas;
+					unsigned int m_layerIndex;
+			};
+
 		private:
+			AbstractImage* AllocateArrayLayer() const;
 			AbstractImage* ResizeImage(AbstractImage* oldImage, const Vector2ui& size) const override;
+
+			mutable TextureRef m_arrayTexture;
+			mutable unsigned int m_arrayLayerCount;
+			unsigned int m_arrayLayerSize;
 	};
 }
 
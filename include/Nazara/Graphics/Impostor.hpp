@@ -0,0 +1,68 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_IMPOSTOR_HPP
+#define NAZARA_IMPOSTOR_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/ObjectRef.hpp>
+#include <Nazara/Core/RefCounted.hpp>
+#include <Nazara/Graphics/Config.hpp>
+#include <Nazara/Graphics/Material.hpp>
+#include <Nazara/Math/Matrix4.hpp>
+#include <Nazara/Math/Rect.hpp>
+#include <Nazara/Math/Vector2.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <vector>
+
+namespace Nz
+{
+	class AbstractRenderQueue;
+	class Impostor;
+	class Model;
+
+	using ImpostorConstRef = ObjectRef<const Impostor>;
+	using ImpostorRef = ObjectRef<Impostor>;
+
+	class NAZARA_GRAPHICS_API Impostor : public RefCounted
+	{
+		public:
+			inline Impostor();
+			Impostor(const Impostor&) = delete;
+			Impostor(Impostor&&) = delete;
+			~Impostor() = default;
+
+			void AddToRenderQueue(AbstractRenderQueue* renderQueue, std::size_t frame, const Matrix4f& transformMatrix, int renderOrder, const Recti& scissorRect) const;
+
+			bool Bake(const Model& model, unsigned int gridSize = 8, unsigned int frameSize = 128);
+
+			inline const Vector3f& GetCenter() const;
+			std::size_t GetFrame(const Vector3f& direction) const;
+			inline std::size_t GetFrameCount() const;
+			inline const MaterialRef& GetFrameMaterial(std::size_t frame) const;
+			inline unsigned int GetGridSize() const;
+			inline float GetRadius() const;
+
+			inline bool IsValid() const;
+
+			Impostor& operator=(const Impostor&) = delete;
+			Impostor& operator=(Impostor&&) = delete;
+
+			static Vector3f DecodeOctahedron(const Vector2f& coords);
+			static Vector2f EncodeOctahedron(const Vector3f& direction);
+			template<typename... Args> static ImpostorRef New(Args&&... args);
+
+		private:
+			std::vector<MaterialRef> m_frameMaterials; //< Frames of the octahedron grid, row by row
+			Vector3f m_center;
+			float m_radius;
+			unsigned int m_gridSize;
+	};
+}
+
+#include <Nazara/Graphics/Impostor.inl>
+
+#endif // NAZARA_IMPOSTOR_HPP
@@ -0,0 +1,97 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Error.hpp>
+#include <memory>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Constructs an Impostor object by default, which has to be baked before being drawn
+	*/
+	inline Impostor::Impostor() :
+	m_center(Vector3f::Zero()),
+	m_radius(0.f),
+	m_gridSize(0)
+	{
+	}
+
+	/*!
+	* \brief Gets the center of the bounding sphere of the baked model
+	* \return Center, in the space of the model
+	*/
+	inline const Vector3f& Impostor::GetCenter() const
+	{
+		return m_center;
+	}
+
+	/*!
+	* \brief Gets the number of frames
+	* \return Frame count, the square of the grid size
+	*/
+	inline std::size_t Impostor::GetFrameCount() const
+	{
+		return m_frameMaterials.size();
+	}
+
+	/*!
+	* \brief Gets the material drawing a frame
+	* \return Material of the frame, holding its texture
+	*
+	* \param frame Index of the frame
+	*
+	* \remark Produces a NazaraAssert if frame is out of range
+	*/
+	inline const MaterialRef& Impostor::GetFrameMaterial(std::size_t frame) const
+	{
+		NazaraAssert(frame < m_frameMaterials.size(), "Frame out of range");
+
+		return m_frameMaterials[frame];
+	}
+
+	/*!
+	* \brief Gets the number of frames per side of the octahedron grid
+	* \return Grid size
+	*/
+	inline unsigned int Impostor::GetGridSize() const
+	{
+		return m_gridSize;
+	}
+
+	/*!
+	* \brief Gets the radius of the bounding sphere of the baked model
+	* \return Radius, which is half the size of the billboards
+	*/
+	inline float Impostor::GetRadius() const
+	{
+		return m_radius;
+	}
+
+	/*!
+	* \brief Checks whether the impostor was baked
+	* \return true If it holds frames
+	*/
+	inline bool Impostor::IsValid() const
+	{
+		return !m_frameMaterials.empty();
+	}
+
+	/*!
+	* \brief Creates a new Impostor from the arguments
+	* \return A reference to the newly created impostor
+	*
+	* \param args Arguments for the impostor
+	*/
+	template<typename... Args>
+	ImpostorRef Impostor::New(Args&&... args)
+	{
+		std::unique_ptr<Impostor> object(new Impostor(std::forward<Args>(args)...));
+		object->SetPersistent(false);
+
+		return object.release();
+	}
+}
+
+#include <Nazara/Graphics/DebugOff.hpp>
@@ -22,6 +22,7 @@ namespace Nz
 {
 	class AbstractRenderQueue;
 	class InstancedRenderable;
+	class ResidencyManager;
 
 	using InstancedRenderableConstRef = ObjectRef<const InstancedRenderable>;
 	using InstancedRenderableLibrary = ObjectLibrary<InstancedRenderable>;
@@ -53,11 +54,14 @@ namespace Nz
 
 			virtual void InvalidateData(InstanceData* instanceData, UInt32 flags) const;
 
+			virtual void RequestResidency(ResidencyManager& residencyManager, const InstanceData& instanceData, float screenSize) const;
+
 			inline void SetSkin(std::size_t skinIndex);
 			inline void SetSkinCount(std::size_t skinCount);
 
 			virtual void UpdateBoundingVolume(InstanceData* instanceData) const;
 			virtual void UpdateData(InstanceData* instanceData) const;
+			virtual bool UpdateLevelOfDetail(InstanceData* instanceData, float projectedSize, const Vector3f& eyePosition = Vector3f::Zero()) const;
 
 			inline InstancedRenderable& operator=(const InstancedRenderable& renderable);
 			InstancedRenderable& operator=(InstancedRenderable&& renderable) = delete;
@@ -74,6 +78,7 @@ namespace Nz
 			{
 				InstanceData(const Matrix4f& transformationMatrix) :
 				localMatrix(transformationMatrix),
+				levelOfDetail(0),
 				flags(0)
 				{
 				}
@@ -84,6 +89,7 @@ namespace Nz
 				{
 					data = std::move(instanceData.data);
 					flags = instanceData.flags;
+					levelOfDetail = instanceData.levelOfDetail;
 					renderOrder = instanceData.renderOrder;
 					localMatrix = instanceData.localMatrix;
 					transformMatrix = instanceData.transformMatrix;
@@ -96,6 +102,7 @@ namespace Nz
 				BoundingVolumef volume;
 				Matrix4f localMatrix;
 				mutable Matrix4f transformMatrix;
+				std::size_t levelOfDetail; //< Selected by UpdateLevelOfDetail
 				UInt32 flags;
 				int renderOrder;
 			};
@@ -9,9 +9,13 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/Color.hpp>
+#include <Nazara/Graphics/Config.hpp>
 #include <Nazara/Graphics/Enums.hpp>
 #include <Nazara/Graphics/Renderable.hpp>
+#include <Nazara/Math/Vector2.hpp>
+#include <Nazara/Math/Vector4.hpp>
 #include <Nazara/Renderer/Texture.hpp>
+#include <array>
 
 namespace Nz
 {
@@ -46,7 +50,8 @@ namespace Nz
 			inline float GetOuterAngleCosine() const;
 			inline float GetOuterAngleTangent() const;
 			inline float GetRadius() const;
-			inline TextureRef GetShadowMap() const;
+			inline std::size_t GetShadowCascadeCount() const;
+			inline const TextureRef& GetShadowMap() const;
 			inline PixelFormatType GetShadowMapFormat() const;
 			inline const Vector2ui& GetShadowMapSize() const;
 
@@ -60,6 +65,7 @@ namespace Nz
 			inline void SetLightType(LightType type);
 			inline void SetOuterAngle(float outerAngle);
 			inline void SetRadius(float radius);
+			inline void SetShadowCascades(const Matrix4f& viewProjMatrix, const Vector4f* cascades, std::size_t cascadeCount);
 			inline void SetShadowMapFormat(PixelFormatType shadowFormat);
 			inline void SetShadowMapSize(const Vector2ui& size);
 
@@ -73,7 +79,10 @@ namespace Nz
 			inline void InvalidateShadowMap();
 			void UpdateShadowMap() const;
 
+			std::array<Vector4f, NAZARA_GRAPHICS_MAX_SHADOW_CASCADES> m_shadowCascades;
+			std::size_t m_shadowCascadeCount;
 			Color m_color;
+			Matrix4f m_shadowViewProjMatrix;
 			LightType m_type;
 			PixelFormatType m_shadowMapFormat;
 			Vector2ui m_shadowMapSize;
@@ -92,8 +101,29 @@ namespace Nz
 			float m_radius;
 	};
 
+	// std140 layout of the Light struct of the LightBlock uniform block
+	struct LightBlockData
+	{
+		Vector4f color;
+		Vector4f parameters1;
+		Vector4f parameters2;
+		Vector2f factors;
+		Vector2f parameters3;
+		Int32 type;
+		Int32 shadowMapping;
+		Int32 padding[2];
+	};
+
 	struct LightUniforms
 	{
+		struct BlockLocations
+		{
+			int blockIndex;
+			int lightIndices;
+			int lightViewProjMatrix;
+			int shadowCascades;
+		};
+
 		struct UniformLocations
 		{
 			int type;
@@ -103,6 +133,7 @@ namespace Nz
 			int parameters1;
 			int parameters2;
 			int parameters3;
+			int shadowCascades;
 			int shadowMapping;
 		};
 
@@ -111,7 +142,7 @@ namespace Nz
 		union
 		{
 			UniformLocations locations;
-			int blockLocation;
+			BlockLocations blockLocations;
 		};
 	};
 }
@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Utility/PixelFormat.hpp>
+#include <algorithm>
 #include <Nazara/Renderer/Debug.hpp>
 
 namespace Nz
@@ -13,6 +14,7 @@ namespace Nz
 
 	inline Light::Light(const Light& light) :
 	Renderable(light),
+	m_shadowCascadeCount(0),
 	m_color(light.m_color),
 	m_type(light.m_type),
 	m_shadowMapFormat(light.m_shadowMapFormat),
@@ -177,12 +179,22 @@ namespace Nz
 		return m_radius;
 	}
 
+	/*!
+	* \brief Gets the number of cascades set by SetShadowCascades
+	* \return Number of cascades, zero if the default projection of the light is used
+	*/
+
+	inline std::size_t Light::GetShadowCascadeCount() const
+	{
+		return m_shadowCascadeCount;
+	}
+
 	/*!
 	* \brief Gets the shadow map
 	* \return Reference to the shadow map texture
 	*/
 
-	inline TextureRef Light::GetShadowMap() const
+	inline const TextureRef& Light::GetShadowMap() const
 	{
 		EnsureShadowMapUpdate();
 
@@ -322,6 +334,27 @@ namespace Nz
 		InvalidateBoundingVolume();
 	}
 
+	/*!
+	* \brief Sets the cascades the shadow map of a directional light is split into
+	*
+	* \param viewProjMatrix View-projection matrix of the light space, covering every cascade
+	* \param cascades Cascades, from the finest to the widest: x is the scale and yz the offset bringing the light space coordinates in the [0, 1] range of the cascade, w is the size of a cascade in the shadow map
+	* \param cascadeCount Number of cascades, zero to use the default projection of the light
+	*
+	* The cascades are laid out in the shadow map from its bottom left corner, two by row.
+	*
+	* \remark Produces a NazaraAssert if cascadeCount is greater than NAZARA_GRAPHICS_MAX_SHADOW_CASCADES
+	*/
+
+	inline void Light::SetShadowCascades(const Matrix4f& viewProjMatrix, const Vector4f* cascades, std::size_t cascadeCount)
+	{
+		NazaraAssert(cascadeCount <= m_shadowCascades.size(), "Too many cascades");
+
+		std::copy(cascades, cascades + cascadeCount, m_shadowCascades.begin());
+		m_shadowCascadeCount = cascadeCount;
+		m_shadowViewProjMatrix = viewProjMatrix;
+	}
+
 	/*!
 	* \brief Sets the shadow map format
 	*
@@ -24,6 +24,8 @@
 #include <Nazara/Renderer/Texture.hpp>
 #include <Nazara/Renderer/TextureSampler.hpp>
 #include <Nazara/Renderer/UberShader.hpp>
+#include <Nazara/Utility/Buffer.hpp>
+#include <array>
 
 namespace Nz
 {
@@ -40,6 +42,7 @@ namespace Nz
 		bool IsValid() const;
 	};
 
+	class CommandBuffer;
 	class Material;
 
 	using MaterialConstRef = ObjectRef<const Material>;
@@ -77,7 +80,9 @@ namespace Nz
 			inline void EnableDepthBuffer(bool depthBuffer);
 			inline void EnableDepthSorting(bool depthSorting);
 			inline void EnableDepthWrite(bool depthWrite);
+			inline void EnableDistanceField(bool distanceField);
 			inline void EnableFaceCulling(bool faceCulling);
+			inline void EnableOrderIndependentTransparency(bool orderIndependentTransparency);
 			inline void EnableReflectionMapping(bool reflection);
 			inline void EnableScissorTest(bool scissorTest);
 			inline void EnableShadowCasting(bool castShadows);
@@ -128,7 +133,9 @@ namespace Nz
 			inline bool IsDepthBufferEnabled() const;
 			inline bool IsDepthSortingEnabled() const;
 			inline bool IsDepthWriteEnabled() const;
+			inline bool IsDistanceFieldEnabled() const;
 			inline bool IsFaceCullingEnabled() const;
+			inline bool IsOrderIndependentTransparencyEnabled() const;
 			inline bool IsReflectionMappingEnabled() const;
 			inline bool IsScissorTestEnabled() const;
 			inline bool IsStencilTestEnabled() const;
@@ -139,6 +146,9 @@ namespace Nz
 			inline bool LoadFromMemory(const void* data, std::size_t size, const MaterialParams& params = MaterialParams());
 			inline bool LoadFromStream(Stream& stream, const MaterialParams& params = MaterialParams());
 
+			void Prepare(const MaterialPipeline::Instance& instance) const;
+
+			void Record(CommandBuffer& commandBuffer, const MaterialPipeline::Instance& instance) const;
 			void Reset();
 
 			void SaveToParameters(ParameterList* matData);
@@ -186,6 +196,7 @@ namespace Nz
 			NazaraSignal(OnMaterialReset, const Material* /*material*/);
 
 		private:
+			template<typename T> void Bind(const MaterialPipeline::Instance& instance, T& target) const;
 			void Copy(const Material& material);
 			inline void InvalidatePipeline();
 			inline void UpdatePipeline() const;
@@ -196,6 +207,8 @@ namespace Nz
 			Color m_ambientColor;
 			Color m_diffuseColor;
 			Color m_specularColor;
+			mutable std::array<UInt64, 6> m_bindlessHandles; //< Alpha, diffuse, emissive, height, normal and specular maps, when the shader uses bindless textures
+			mutable BufferRef m_uniformBuffer; //< MaterialBlock data, created on first use by a shader declaring the block
 			MaterialRef m_depthMaterial; //< Materialception
 			mutable const MaterialPipeline* m_pipeline;
 			MaterialPipelineInfo m_pipelineInfo;
@@ -209,6 +222,7 @@ namespace Nz
 			TextureRef m_normalMap;
 			TextureRef m_specularMap;
 			mutable bool m_pipelineUpdated;
+			mutable bool m_uniformBufferUpdated;
 			bool m_shadowCastingEnabled;
 			float m_alphaThreshold;
 			float m_shininess;
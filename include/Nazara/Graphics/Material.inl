@@ -269,6 +269,27 @@ namespace Nz
 		InvalidatePipeline();
 	}
 
+	/*!
+	* \brief Enable/Disable distance field overlays for this material
+	*
+	* When enabled, the overlay textures (as text glyphs) are read as signed distance fields, their contour being at a half,
+	* which keeps them sharp whatever their size on screen. This is meant for fonts in distance field mode.
+	*
+	* \param distanceField Defines if this material will read overlays as distance fields
+	*
+	* \remark Only the basic shader supports it
+	* \remark Invalidates the pipeline
+	*
+	* \see IsDistanceFieldEnabled
+	* \see Font::SetDistanceFieldSize
+	*/
+	inline void Material::EnableDistanceField(bool distanceField)
+	{
+		m_pipelineInfo.distanceField = distanceField;
+
+		InvalidatePipeline();
+	}
+
 	/*!
 	* \brief Enable/Disable face culling for this material
 	*
@@ -291,6 +312,26 @@ namespace Nz
 		InvalidatePipeline();
 	}
 
+	/*!
+	* \brief Enable/Disable order-independent transparency for this material
+	*
+	* When enabled, the forward render technique accumulates the objects using this material in a weighted sum instead of sorting them,
+	* and composites the result over the opaque objects. Overlapping translucent surfaces are then blended without breaking batching.
+	*
+	* \param orderIndependentTransparency Defines if this material will use order-independent transparency
+	*
+	* \remark Takes precedence over depth sorting, and replaces the blending and depth writing of the material while accumulating
+	* \remark Invalidates the pipeline
+	*
+	* \see IsOrderIndependentTransparencyEnabled
+	*/
+	inline void Material::EnableOrderIndependentTransparency(bool orderIndependentTransparency)
+	{
+		m_pipelineInfo.orderIndependentTransparency = orderIndependentTransparency;
+
+		InvalidatePipeline();
+	}
+
 	/*!
 	* \brief Enable/Disable reflection mapping for this material
 	*
@@ -810,6 +851,15 @@ namespace Nz
 		return m_pipelineInfo.depthWrite;
 	}
 
+	/*!
+	* \brief Checks whether this material reads overlays as distance fields
+	* \return true If it is the case
+	*/
+	inline bool Material::IsDistanceFieldEnabled() const
+	{
+		return m_pipelineInfo.distanceField;
+	}
+
 	/*!
 	* \brief Checks whether this material has face culling enabled
 	* \return true If it is the case
@@ -819,6 +869,17 @@ namespace Nz
 		return m_pipelineInfo.faceCulling;
 	}
 
+	/*!
+	* \brief Checks whether this material has order-independent transparency enabled
+	* \return true If it is the case
+	*
+	* \see EnableOrderIndependentTransparency
+	*/
+	inline bool Material::IsOrderIndependentTransparencyEnabled() const
+	{
+		return m_pipelineInfo.orderIndependentTransparency;
+	}
+
 	/*!
 	* \brief Checks whether this material has reflection mapping enabled
 	* \return true If it is the case
@@ -950,6 +1011,7 @@ namespace Nz
 	inline void Material::SetAlphaThreshold(float alphaThreshold)
 	{
 		m_alphaThreshold = alphaThreshold;
+		m_uniformBufferUpdated = false;
 	}
 
 	/*!
@@ -960,6 +1022,7 @@ namespace Nz
 	inline void Material::SetAmbientColor(const Color& ambient)
 	{
 		m_ambientColor = ambient;
+		m_uniformBufferUpdated = false;
 	}
 
 	/*!
@@ -995,6 +1058,7 @@ namespace Nz
 	inline void Material::SetDiffuseColor(const Color& diffuse)
 	{
 		m_diffuseColor = diffuse;
+		m_uniformBufferUpdated = false;
 	}
 
 	/*!
@@ -1323,6 +1387,7 @@ namespace Nz
 	inline void Material::SetShininess(float shininess)
 	{
 		m_shininess = shininess;
+		m_uniformBufferUpdated = false;
 	}
 
 	/*!
@@ -1333,6 +1398,7 @@ namespace Nz
 	inline void Material::SetSpecularColor(const Color& specular)
 	{
 		m_specularColor = specular;
+		m_uniformBufferUpdated = false;
 	}
 
 	/*!
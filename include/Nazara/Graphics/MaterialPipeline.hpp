@@ -8,11 +8,13 @@
 #define NAZARA_MATERIALPIPELINE_HPP
 
 #include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/ReadWriteLock.hpp>
 #include <Nazara/Graphics/Config.hpp>
 #include <Nazara/Graphics/Enums.hpp>
 #include <Nazara/Renderer/RenderPipeline.hpp>
 #include <Nazara/Renderer/UberShader.hpp>
 #include <array>
+#include <vector>
 
 namespace Nz
 {
@@ -20,12 +22,14 @@ namespace Nz
 	{
 		bool alphaTest         = false;
 		bool depthSorting      = false;
+		bool distanceField     = false;
 		bool hasAlphaMap       = false;
 		bool hasDiffuseMap     = false;
 		bool hasEmissiveMap    = false;
 		bool hasHeightMap      = false;
 		bool hasNormalMap      = false;
 		bool hasSpecularMap    = false;
+		bool orderIndependentTransparency = false;
 		bool reflectionMapping = false;
 		bool shadowReceive     = true;
 
@@ -47,6 +51,7 @@ namespace Nz
 		friend MaterialPipelineLibrary;
 
 		public:
+			struct GenerationStats;
 			struct Instance;
 
 			MaterialPipeline(const MaterialPipeline&) = delete;
@@ -61,19 +66,36 @@ namespace Nz
 			inline const MaterialPipelineInfo& GetInfo() const;
 			inline const Instance& GetInstance(UInt32 flags = ShaderFlags_None) const;
 
+			void Precompile(UInt32 flags = ShaderFlags_None) const;
+
+			static void EnableAsynchronousCompilation(bool enable);
+			static GenerationStats GetGenerationStats();
 			static MaterialPipelineRef GetPipeline(const MaterialPipelineInfo& pipelineInfo);
+			static bool IsAsynchronousCompilationEnabled();
+			static void PrecompileAll(const std::vector<UInt32>& flags);
+			static void ResetGenerationStats();
+
+			struct GenerationStats
+			{
+				UInt64 pipelineCount;    //< Pipelines in the cache
+				UInt64 precompiledCount; //< Instances generated by Precompile or PrecompileAll
+				UInt64 runtimeCount;     //< Instances generated on first use, while rendering
+			};
 
 			struct Instance
 			{
 				RenderPipeline renderPipeline;
 				UberShaderInstance* uberInstance = nullptr;
 				std::array<int, MaterialUniform_Max + 1> uniforms;
+				int materialBlock = -1; //< Index of the MaterialBlock uniform block, -1 if the shader uses plain uniforms
+				bool bindless = false; //< Material maps are sampled from the handles of the material block instead of texture units
+				bool pending = false; //< Uses a fallback permutation while its own shader is being compiled
 			};
 
 		private:
 			inline MaterialPipeline(const MaterialPipelineInfo& pipelineInfo);
 
-			void GenerateRenderPipeline(UInt32 flags) const;
+			void GenerateRenderPipeline(UInt32 flags, bool precompile = false) const;
 
 			static bool Initialize();
 			template<typename... Args> static MaterialPipelineRef New(Args&&... args);
@@ -84,6 +106,10 @@ namespace Nz
 
 			using PipelineCache = std::unordered_map<MaterialPipelineInfo, MaterialPipelineRef>;
 			static PipelineCache s_pipelineCache;
+			static ReadWriteLock s_pipelineCacheLock;
+			static bool s_asynchronousCompilation;
+			static UInt64 s_precompiledCount;
+			static UInt64 s_runtimeCount;
 
 			static MaterialPipelineLibrary::LibraryMap s_library;
 	};
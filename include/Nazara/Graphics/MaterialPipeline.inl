@@ -45,11 +45,14 @@ namespace Nz
 	* \param flags Shader flags
 	*
 	* \return Pipeline instance
+	*
+	* \remark With asynchronous compilation, the instance may use a fallback shader for a few frames (see EnableAsynchronousCompilation)
+	* \remark Generating an instance while rendering may cause a hitch, see Precompile
 	*/
 	inline const MaterialPipeline::Instance& MaterialPipeline::GetInstance(UInt32 flags) const
 	{
 		const Instance& instance = m_instances[flags];
-		if (!instance.uberInstance)
+		if (!instance.uberInstance || instance.pending)
 			GenerateRenderPipeline(flags);
 
 		return instance;
@@ -65,12 +68,14 @@ namespace Nz
 
 		NazaraPipelineBoolMember(alphaTest);
 		NazaraPipelineBoolMember(depthSorting);
+		NazaraPipelineBoolMember(distanceField);
 		NazaraPipelineBoolMember(hasAlphaMap);
 		NazaraPipelineBoolMember(hasDiffuseMap);
 		NazaraPipelineBoolMember(hasEmissiveMap);
 		NazaraPipelineBoolMember(hasHeightMap);
 		NazaraPipelineBoolMember(hasNormalMap);
 		NazaraPipelineBoolMember(hasSpecularMap);
+		NazaraPipelineBoolMember(orderIndependentTransparency);
 		NazaraPipelineBoolMember(reflectionMapping);
 		NazaraPipelineBoolMember(shadowReceive);
 
@@ -121,12 +126,14 @@ namespace std
 
 			NazaraPipelineBoolMember(alphaTest);
 			NazaraPipelineBoolMember(depthSorting);
+			NazaraPipelineBoolMember(distanceField);
 			NazaraPipelineBoolMember(hasAlphaMap);
 			NazaraPipelineBoolMember(hasDiffuseMap);
 			NazaraPipelineBoolMember(hasEmissiveMap);
 			NazaraPipelineBoolMember(hasHeightMap);
 			NazaraPipelineBoolMember(hasNormalMap);
 			NazaraPipelineBoolMember(hasSpecularMap);
+			NazaraPipelineBoolMember(orderIndependentTransparency);
 			NazaraPipelineBoolMember(reflectionMapping);
 			NazaraPipelineBoolMember(shadowReceive);
 
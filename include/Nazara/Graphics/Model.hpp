@@ -12,9 +12,11 @@
 #include <Nazara/Core/ResourceLoader.hpp>
 #include <Nazara/Core/ResourceParameters.hpp>
 #include <Nazara/Math/Rect.hpp>
+#include <Nazara/Graphics/Impostor.hpp>
 #include <Nazara/Graphics/InstancedRenderable.hpp>
 #include <Nazara/Graphics/Material.hpp>
 #include <Nazara/Utility/Mesh.hpp>
+#include <vector>
 
 namespace Nz
 {
@@ -45,9 +47,18 @@ namespace Nz
 			Model(Model&& model) = default;
 			virtual ~Model();
 
+			bool AddLevelOfDetail(Mesh* mesh, float projectedSize);
 			void AddToRenderQueue(AbstractRenderQueue* renderQueue, const InstanceData& instanceData, const Recti& scissorRect) const override;
 			inline void AddToRenderQueue(AbstractRenderQueue* renderQueue, const Matrix4f& transformMatrix, int renderOrder = 0, const Recti& scissorRect = Recti(-1, -1, -1, -1)) const;
 
+			void ClearLevelsOfDetail();
+
+			inline const ImpostorRef& GetImpostor() const;
+			inline float GetImpostorSize() const;
+			inline std::size_t GetLevelOfDetailCount() const;
+			Mesh* GetLevelOfDetailMesh(std::size_t level) const;
+			float GetLevelOfDetailSize(std::size_t level) const;
+
 			using InstancedRenderable::GetMaterial;
 			const MaterialRef& GetMaterial(const String& subMeshName) const;
 			const MaterialRef& GetMaterial(std::size_t skinIndex, const String& subMeshName) const;
@@ -59,21 +70,38 @@ namespace Nz
 			bool LoadFromMemory(const void* data, std::size_t size, const ModelParameters& params = ModelParameters());
 			bool LoadFromStream(Stream& stream, const ModelParameters& params = ModelParameters());
 
+			void RequestResidency(ResidencyManager& residencyManager, const InstanceData& instanceData, float screenSize) const override;
+
+			bool SetImpostor(ImpostorRef impostor, float projectedSize);
+			bool SetLevelOfDetailMesh(std::size_t level, Mesh* mesh);
+
 			using InstancedRenderable::SetMaterial;
 			bool SetMaterial(const String& subMeshName, MaterialRef material);
 			bool SetMaterial(std::size_t skinIndex, const String& subMeshName, MaterialRef material);
 
 			virtual void SetMesh(Mesh* mesh);
 
+			bool UpdateLevelOfDetail(InstanceData* instanceData, float projectedSize, const Vector3f& eyePosition = Vector3f::Zero()) const override;
+
 			Model& operator=(const Model& node) = default;
 			Model& operator=(Model&& node) = default;
 
 			template<typename... Args> static ModelRef New(Args&&... args);
 
 		protected:
+			bool CheckLevelOfDetail(const Mesh* mesh) const;
 			void MakeBoundingVolume() const override;
 
+			struct LevelOfDetail
+			{
+				MeshRef mesh; //< May be null, to stop drawing the model
+				float projectedSize; //< The level is used below this size
+			};
+
+			std::vector<LevelOfDetail> m_levelsOfDetail; //< Levels after the mesh, by decreasing size
+			ImpostorRef m_impostor;
 			MeshRef m_mesh;
+			float m_impostorSize; //< The impostor is drawn below this size
 
 			static ModelLoader::LoaderList s_loaders;
 	};
@@ -10,7 +10,8 @@ namespace Nz
 	/*!
 	* \brief Constructs a Model object by default
 	*/
-	Model::Model()
+	Model::Model() :
+	m_impostorSize(0.f)
 	{
 		ResetMaterials(0);
 	}
@@ -33,6 +34,33 @@ namespace Nz
 		return AddToRenderQueue(renderQueue, instanceData, scissorRect);
 	}
 
+	/*!
+	* \brief Gets the impostor drawn once the model is small on screen
+	* \return Impostor, which may be null
+	*/
+	const ImpostorRef& Model::GetImpostor() const
+	{
+		return m_impostor;
+	}
+
+	/*!
+	* \brief Gets the size below which the impostor is drawn
+	* \return Height on screen, relative to the height of the viewport
+	*/
+	float Model::GetImpostorSize() const
+	{
+		return m_impostorSize;
+	}
+
+	/*!
+	* \brief Gets the number of levels of detail
+	* \return Level count, the mesh of the model being the first one
+	*/
+	std::size_t Model::GetLevelOfDetailCount() const
+	{
+		return m_levelsOfDetail.size() + 1;
+	}
+
 	/*!
 	* \brief Creates a new Model from the arguments
 	* \return A reference to the newly created model
@@ -0,0 +1,71 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_OCCLUSIONCULLER_HPP
+#define NAZARA_OCCLUSIONCULLER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Graphics/Config.hpp>
+#include <Nazara/Math/Box.hpp>
+#include <Nazara/Renderer/GpuQuery.hpp>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace Nz
+{
+	class AbstractViewer;
+
+	class NAZARA_GRAPHICS_API OcclusionCuller
+	{
+		friend class Graphics;
+
+		public:
+			OcclusionCuller();
+			OcclusionCuller(const OcclusionCuller&) = delete;
+			OcclusionCuller(OcclusionCuller&&) = default;
+			~OcclusionCuller() = default;
+
+			void Clear();
+
+			void Forget(const void* object);
+
+			inline bool IsVisible(const void* object) const;
+
+			bool Process(const AbstractViewer& viewer);
+
+			inline void TestVisibility(const void* object, const Boxf& aabb);
+
+			OcclusionCuller& operator=(const OcclusionCuller&) = delete;
+			OcclusionCuller& operator=(OcclusionCuller&&) = default;
+
+		private:
+			static bool Initialize();
+			static void Uninitialize();
+
+			struct Entry
+			{
+				std::unique_ptr<GpuQuery> query;
+				UInt64 lastTestFrame = 0;
+				bool pending = false;
+				bool visible = true;
+			};
+
+			struct Test
+			{
+				const void* object;
+				Boxf aabb;
+			};
+
+			std::unordered_map<const void*, Entry> m_entries;
+			std::vector<Test> m_tests;
+			UInt64 m_frameIndex;
+	};
+}
+
+#include <Nazara/Graphics/OcclusionCuller.inl>
+
+#endif // NAZARA_OCCLUSIONCULLER_HPP
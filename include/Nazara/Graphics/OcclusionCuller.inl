@@ -0,0 +1,39 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Checks whether an object may be visible, according to the previous tests
+	* \return false if the last test of the object, done during the previous frame, found it hidden
+	*
+	* \param object Object to check
+	*
+	* \remark Objects which were not tested during the previous frame are always considered visible
+	*/
+	inline bool OcclusionCuller::IsVisible(const void* object) const
+	{
+		auto it = m_entries.find(object);
+		if (it == m_entries.end())
+			return true;
+
+		const Entry& entry = it->second;
+		return entry.visible || entry.lastTestFrame + 1 != m_frameIndex;
+	}
+
+	/*!
+	* \brief Queues the test of an object for the next call to Process
+	*
+	* \param object Object to test, its address is used to identify it from one frame to the next
+	* \param aabb Axis-aligned bounding box of the object, in world space
+	*/
+	inline void OcclusionCuller::TestVisibility(const void* object, const Boxf& aabb)
+	{
+		m_tests.push_back({object, aabb});
+	}
+}
+
+#include <Nazara/Graphics/DebugOff.hpp>
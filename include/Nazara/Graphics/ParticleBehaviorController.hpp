@@ -0,0 +1,46 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_PARTICLEBEHAVIORCONTROLLER_HPP
+#define NAZARA_PARTICLEBEHAVIORCONTROLLER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Graphics/ParticleBehaviors.hpp>
+#include <Nazara/Graphics/ParticleController.hpp>
+#include <tuple>
+#include <utility>
+
+namespace Nz
+{
+	template<typename... Behaviors>
+	class ParticleBehaviorController : public ParticleController
+	{
+		public:
+			inline ParticleBehaviorController(Behaviors... behaviors);
+			ParticleBehaviorController(const ParticleBehaviorController&) = default;
+			~ParticleBehaviorController() = default;
+
+			void Apply(ParticleGroup& group, ParticleMapper& mapper, unsigned int startId, unsigned int endId, float elapsedTime) override final;
+
+			template<std::size_t I> std::tuple_element_t<I, std::tuple<Behaviors...>>& GetBehavior();
+			template<std::size_t I> const std::tuple_element_t<I, std::tuple<Behaviors...>>& GetBehavior() const;
+
+			template<typename... Args> static ObjectRef<ParticleBehaviorController> New(Args&&... args);
+
+		private:
+			template<typename Access, std::size_t... I> void Process(ParticleGroup& group, ParticleMapper& mapper, unsigned int startId, unsigned int endId, float elapsedTime, std::index_sequence<I...>);
+
+			template<typename... Kernels> static void RunKernels(unsigned int startId, unsigned int endId, Kernels... kernels);
+
+			std::tuple<Behaviors...> m_behaviors;
+	};
+
+	template<typename... Behaviors> ObjectRef<ParticleBehaviorController<Behaviors...>> MakeParticleController(Behaviors... behaviors);
+}
+
+#include <Nazara/Graphics/ParticleBehaviorController.inl>
+
+#endif // NAZARA_PARTICLEBEHAVIORCONTROLLER_HPP
@@ -0,0 +1,122 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Graphics/ParticleMapper.hpp>
+#include <memory>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup graphics
+	* \class Nz::ParticleBehaviorController
+	* \brief Graphics class that applies standard behaviors to particles in a single loop
+	*
+	* Each behavior (see ParticleBehaviors.hpp) fetches the components it needs once per update, then every behavior is applied to a particle before moving on to the next one.
+	* As the behaviors are known at compile time, the loop is inlined and the compiler is free to vectorize it, which is not possible with ParticleFunctionController.
+	*
+	* \remark With a separated storage, components are accessed through plain pointers instead of SparsePtr
+	*
+	* \see MakeParticleController
+	*/
+
+	/*!
+	* \brief Constructs a ParticleBehaviorController object
+	*
+	* \param behaviors Behaviors to apply, in this order
+	*/
+	template<typename... Behaviors>
+	inline ParticleBehaviorController<Behaviors...>::ParticleBehaviorController(Behaviors... behaviors) :
+	m_behaviors(std::move(behaviors)...)
+	{
+	}
+
+	/*!
+	* \brief Applies the behaviors to the particles
+	*
+	* \param group Particle group responsible of the particles
+	* \param mapper Particle mapper, allowing access to the particle data
+	* \param startId The first ID of the particle to update (inclusive)
+	* \param endId The last ID of the particle to update (inclusive)
+	* \param elapsedTime Elapsed time in seconds since the last update
+	*/
+	template<typename... Behaviors>
+	void ParticleBehaviorController<Behaviors...>::Apply(ParticleGroup& group, ParticleMapper& mapper, unsigned int startId, unsigned int endId, float elapsedTime)
+	{
+		if (mapper.GetStorage() == ParticleStorage_Separated)
+			Process<Detail::ParticleContiguousAccess>(group, mapper, startId, endId, elapsedTime, std::index_sequence_for<Behaviors...>());
+		else
+			Process<Detail::ParticleSparseAccess>(group, mapper, startId, endId, elapsedTime, std::index_sequence_for<Behaviors...>());
+	}
+
+	/*!
+	* \brief Gets a behavior of the controller
+	* \return Reference to the behavior, which can be modified
+	*
+	* \tparam I Index of the behavior
+	*/
+	template<typename... Behaviors>
+	template<std::size_t I>
+	std::tuple_element_t<I, std::tuple<Behaviors...>>& ParticleBehaviorController<Behaviors...>::GetBehavior()
+	{
+		return std::get<I>(m_behaviors);
+	}
+
+	/*!
+	* \brief Gets a behavior of the controller
+	* \return Constant reference to the behavior
+	*
+	* \tparam I Index of the behavior
+	*/
+	template<typename... Behaviors>
+	template<std::size_t I>
+	const std::tuple_element_t<I, std::tuple<Behaviors...>>& ParticleBehaviorController<Behaviors...>::GetBehavior() const
+	{
+		return std::get<I>(m_behaviors);
+	}
+
+	template<typename... Behaviors>
+	template<typename... Args>
+	ObjectRef<ParticleBehaviorController<Behaviors...>> ParticleBehaviorController<Behaviors...>::New(Args&&... args)
+	{
+		std::unique_ptr<ParticleBehaviorController> object(new ParticleBehaviorController(std::forward<Args>(args)...));
+		object->SetPersistent(false);
+
+		return object.release();
+	}
+
+	template<typename... Behaviors>
+	template<typename Access, std::size_t... I>
+	void ParticleBehaviorController<Behaviors...>::Process(ParticleGroup& group, ParticleMapper& mapper, unsigned int startId, unsigned int endId, float elapsedTime, std::index_sequence<I...>)
+	{
+		RunKernels(startId, endId, std::get<I>(m_behaviors).template Prepare<Access>(group, mapper, elapsedTime)...);
+	}
+
+	template<typename... Behaviors>
+	template<typename... Kernels>
+	void ParticleBehaviorController<Behaviors...>::RunKernels(unsigned int startId, unsigned int endId, Kernels... kernels)
+	{
+		for (unsigned int i = startId; i <= endId; ++i)
+		{
+			// Expands to a call of every kernel, in the order of the behaviors
+			int dummy[] = {0, (kernels(i), 0)...};
+			NazaraUnused(dummy);
+		}
+	}
+
+	/*!
+	* \ingroup graphics
+	* \brief Creates a controller applying the behaviors, deducing its type from them
+	* \return Reference to the new controller
+	*
+	* \param behaviors Behaviors to apply, in this order
+	*/
+	template<typename... Behaviors>
+	ObjectRef<ParticleBehaviorController<Behaviors...>> MakeParticleController(Behaviors... behaviors)
+	{
+		return ParticleBehaviorController<Behaviors...>::New(std::move(behaviors)...);
+	}
+}
+
+#include <Nazara/Graphics/DebugOff.hpp>
@@ -0,0 +1,178 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_PARTICLEBEHAVIORS_HPP
+#define NAZARA_PARTICLEBEHAVIORS_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Color.hpp>
+#include <Nazara/Core/SparsePtr.hpp>
+#include <Nazara/Graphics/Enums.hpp>
+#include <Nazara/Math/Vector2.hpp>
+#include <Nazara/Math/Vector3.hpp>
+
+namespace Nz
+{
+	class ParticleGroup;
+	class ParticleMapper;
+
+	namespace Detail
+	{
+		// How a kernel accesses the components of the particles, chosen from the storage of the group
+		struct ParticleContiguousAccess
+		{
+			template<typename T> using Pointer = T*;
+
+			template<typename T> static T* Get(ParticleMapper& mapper, ParticleComponent component);
+		};
+
+		struct ParticleSparseAccess
+		{
+			template<typename T> using Pointer = SparsePtr<T>;
+
+			template<typename T> static SparsePtr<T> Get(ParticleMapper& mapper, ParticleComponent component);
+		};
+	}
+
+	struct ParticleAttractor
+	{
+		template<typename Access>
+		struct Kernel
+		{
+			inline void operator()(unsigned int i);
+
+			typename Access::template Pointer<Vector3f> positions;
+			typename Access::template Pointer<Vector3f> velocities;
+			Vector3f center;
+			float minSquaredDistance;
+			float strength;
+		};
+
+		inline ParticleAttractor(const Vector3f& Center, float Strength, float MinDistance = 1.f);
+
+		template<typename Access> Kernel<Access> Prepare(ParticleGroup& group, ParticleMapper& mapper, float elapsedTime) const;
+
+		Vector3f center;
+		float minDistance;
+		float strength;
+	};
+
+	struct ParticleColorOverLife
+	{
+		template<typename Access>
+		struct Kernel
+		{
+			inline void operator()(unsigned int i);
+
+			typename Access::template Pointer<Color> colors;
+			typename Access::template Pointer<float> lifes;
+			float deltas[4];
+			float ends[4];
+			float invLifetime;
+		};
+
+		inline ParticleColorOverLife(const Color& Start, const Color& End, float Lifetime);
+
+		template<typename Access> Kernel<Access> Prepare(ParticleGroup& group, ParticleMapper& mapper, float elapsedTime) const;
+
+		Color end;
+		Color start;
+		float lifetime;
+	};
+
+	struct ParticleDrag
+	{
+		template<typename Access>
+		struct Kernel
+		{
+			inline void operator()(unsigned int i);
+
+			typename Access::template Pointer<Vector3f> velocities;
+			float factor;
+		};
+
+		inline ParticleDrag(float Coefficient);
+
+		template<typename Access> Kernel<Access> Prepare(ParticleGroup& group, ParticleMapper& mapper, float elapsedTime) const;
+
+		float coefficient;
+	};
+
+	struct ParticleGravity
+	{
+		template<typename Access>
+		struct Kernel
+		{
+			inline void operator()(unsigned int i);
+
+			typename Access::template Pointer<Vector3f> velocities;
+			Vector3f delta;
+		};
+
+		inline ParticleGravity(const Vector3f& Acceleration);
+
+		template<typename Access> Kernel<Access> Prepare(ParticleGroup& group, ParticleMapper& mapper, float elapsedTime) const;
+
+		Vector3f acceleration;
+	};
+
+	struct ParticleLifetime
+	{
+		template<typename Access>
+		struct Kernel
+		{
+			inline void operator()(unsigned int i);
+
+			typename Access::template Pointer<float> lifes;
+			ParticleGroup* group;
+			float elapsedTime;
+		};
+
+		template<typename Access> Kernel<Access> Prepare(ParticleGroup& group, ParticleMapper& mapper, float elapsedTime) const;
+	};
+
+	struct ParticleMovement
+	{
+		template<typename Access>
+		struct Kernel
+		{
+			inline void operator()(unsigned int i);
+
+			typename Access::template Pointer<Vector3f> positions;
+			typename Access::template Pointer<Vector3f> velocities;
+			float elapsedTime;
+		};
+
+		template<typename Access> Kernel<Access> Prepare(ParticleGroup& group, ParticleMapper& mapper, float elapsedTime) const;
+	};
+
+	struct ParticleSizeOverLife
+	{
+		template<typename Access>
+		struct Kernel
+		{
+			inline void operator()(unsigned int i);
+
+			typename Access::template Pointer<Vector2f> sizes;
+			typename Access::template Pointer<float> lifes;
+			Vector2f delta;
+			Vector2f end;
+			float invLifetime;
+		};
+
+		inline ParticleSizeOverLife(const Vector2f& Start, const Vector2f& End, float Lifetime);
+
+		template<typename Access> Kernel<Access> Prepare(ParticleGroup& group, ParticleMapper& mapper, float elapsedTime) const;
+
+		Vector2f end;
+		Vector2f start;
+		float lifetime;
+	};
+}
+
+#include <Nazara/Graphics/ParticleBehaviors.inl>
+
+#endif // NAZARA_PARTICLEBEHAVIORS_HPP
@@ -0,0 +1,304 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Graphics/ParticleGroup.hpp>
+#include <Nazara/Graphics/ParticleMapper.hpp>
+#include <Nazara/Math/Algorithm.hpp>
+#include <algorithm>
+#include <cmath>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		template<typename T>
+		T* ParticleContiguousAccess::Get(ParticleMapper& mapper, ParticleComponent component)
+		{
+			SparsePtr<T> ptr = mapper.GetComponentPtr<T>(component);
+			NazaraAssert(!ptr || static_cast<std::size_t>(ptr.GetStride()) == sizeof(T), "Component is not tightly packed");
+
+			return static_cast<T*>(ptr.GetPtr());
+		}
+
+		template<typename T>
+		SparsePtr<T> ParticleSparseAccess::Get(ParticleMapper& mapper, ParticleComponent component)
+		{
+			return mapper.GetComponentPtr<T>(component);
+		}
+	}
+
+	/*!
+	* \ingroup graphics
+	* \class Nz::ParticleAttractor
+	* \brief Behavior pulling the particles toward a point, with a force decreasing with the square of the distance
+	*
+	* Requires the Position and Velocity components
+	*/
+
+	/*!
+	* \brief Constructs a ParticleAttractor object
+	*
+	* \param Center Position the particles are pulled toward
+	* \param Strength Acceleration of a particle at a distance of one unit
+	* \param MinDistance Distance under which the force stops increasing, avoiding huge velocities next to the center
+	*/
+	inline ParticleAttractor::ParticleAttractor(const Vector3f& Center, float Strength, float MinDistance) :
+	center(Center),
+	minDistance(MinDistance),
+	strength(Strength)
+	{
+	}
+
+	template<typename Access>
+	auto ParticleAttractor::Prepare(ParticleGroup& /*group*/, ParticleMapper& mapper, float elapsedTime) const -> Kernel<Access>
+	{
+		Kernel<Access> kernel;
+		kernel.center = center;
+		kernel.minSquaredDistance = minDistance * minDistance;
+		kernel.positions = Access::template Get<Vector3f>(mapper, ParticleComponent_Position);
+		kernel.strength = strength * elapsedTime;
+		kernel.velocities = Access::template Get<Vector3f>(mapper, ParticleComponent_Velocity);
+
+		return kernel;
+	}
+
+	template<typename Access>
+	inline void ParticleAttractor::Kernel<Access>::operator()(unsigned int i)
+	{
+		Vector3f offset = center - positions[i];
+		float squaredDistance = std::max(offset.GetSquaredLength(), minSquaredDistance);
+
+		// Offset is normalized at the same time
+		velocities[i] += offset * (strength / (squaredDistance * std::sqrt(squaredDistance)));
+	}
+
+	/*!
+	* \ingroup graphics
+	* \class Nz::ParticleColorOverLife
+	* \brief Behavior interpolating the color of the particles from their remaining life
+	*
+	* Requires the Color and Life components, the life being the remaining time of the particle in seconds
+	*/
+
+	/*!
+	* \brief Constructs a ParticleColorOverLife object
+	*
+	* \param Start Color of a particle having its whole lifetime remaining
+	* \param End Color of a particle at the end of its life
+	* \param Lifetime Lifetime of the particles, in seconds
+	*/
+	inline ParticleColorOverLife::ParticleColorOverLife(const Color& Start, const Color& End, float Lifetime) :
+	end(End),
+	start(Start),
+	lifetime(Lifetime)
+	{
+	}
+
+	template<typename Access>
+	auto ParticleColorOverLife::Prepare(ParticleGroup& /*group*/, ParticleMapper& mapper, float /*elapsedTime*/) const -> Kernel<Access>
+	{
+		NazaraAssert(lifetime > 0.f, "Invalid lifetime");
+
+		const UInt8 endValues[4] = {end.r, end.g, end.b, end.a};
+		const UInt8 startValues[4] = {start.r, start.g, start.b, start.a};
+
+		Kernel<Access> kernel;
+		kernel.colors = Access::template Get<Color>(mapper, ParticleComponent_Color);
+		kernel.invLifetime = 1.f / lifetime;
+		kernel.lifes = Access::template Get<float>(mapper, ParticleComponent_Life);
+
+		for (unsigned int j = 0; j < 4; ++j)
+		{
+			kernel.deltas[j] = float(startValues[j]) - float(endValues[j]);
+			kernel.ends[j] = float(endValues[j]);
+		}
+
+		return kernel;
+	}
+
+	template<typename Access>
+	inline void ParticleColorOverLife::Kernel<Access>::operator()(unsigned int i)
+	{
+		float ratio = Clamp(lifes[i] * invLifetime, 0.f, 1.f);
+
+		Color& color = colors[i];
+		color.r = static_cast<UInt8>(ends[0] + deltas[0] * ratio);
+		color.g = static_cast<UInt8>(ends[1] + deltas[1] * ratio);
+		color.b = static_cast<UInt8>(ends[2] + deltas[2] * ratio);
+		color.a = static_cast<UInt8>(ends[3] + deltas[3] * ratio);
+	}
+
+	/*!
+	* \ingroup graphics
+	* \class Nz::ParticleDrag
+	* \brief Behavior slowing down the particles, independently of the frame rate
+	*
+	* Requires the Velocity component
+	*/
+
+	/*!
+	* \brief Constructs a ParticleDrag object
+	*
+	* \param Coefficient Drag coefficient, the velocity is divided by e every 1/coefficient seconds
+	*/
+	inline ParticleDrag::ParticleDrag(float Coefficient) :
+	coefficient(Coefficient)
+	{
+	}
+
+	template<typename Access>
+	auto ParticleDrag::Prepare(ParticleGroup& /*group*/, ParticleMapper& mapper, float elapsedTime) const -> Kernel<Access>
+	{
+		Kernel<Access> kernel;
+		kernel.factor = std::exp(-coefficient * elapsedTime);
+		kernel.velocities = Access::template Get<Vector3f>(mapper, ParticleComponent_Velocity);
+
+		return kernel;
+	}
+
+	template<typename Access>
+	inline void ParticleDrag::Kernel<Access>::operator()(unsigned int i)
+	{
+		velocities[i] *= factor;
+	}
+
+	/*!
+	* \ingroup graphics
+	* \class Nz::ParticleGravity
+	* \brief Behavior applying a constant acceleration to the particles
+	*
+	* Requires the Velocity component
+	*/
+
+	/*!
+	* \brief Constructs a ParticleGravity object
+	*
+	* \param Acceleration Acceleration applied to every particle, in units per second squared
+	*/
+	inline ParticleGravity::ParticleGravity(const Vector3f& Acceleration) :
+	acceleration(Acceleration)
+	{
+	}
+
+	template<typename Access>
+	auto ParticleGravity::Prepare(ParticleGroup& /*group*/, ParticleMapper& mapper, float elapsedTime) const -> Kernel<Access>
+	{
+		Kernel<Access> kernel;
+		kernel.delta = acceleration * elapsedTime;
+		kernel.velocities = Access::template Get<Vector3f>(mapper, ParticleComponent_Velocity);
+
+		return kernel;
+	}
+
+	template<typename Access>
+	inline void ParticleGravity::Kernel<Access>::operator()(unsigned int i)
+	{
+		velocities[i] += delta;
+	}
+
+	/*!
+	* \ingroup graphics
+	* \class Nz::ParticleLifetime
+	* \brief Behavior decreasing the remaining life of the particles, killing them once it is over
+	*
+	* Requires the Life component
+	*
+	* \remark Killed particles are still processed by the following behaviors of the controller, as the group only removes them after the update
+	*/
+
+	template<typename Access>
+	auto ParticleLifetime::Prepare(ParticleGroup& group, ParticleMapper& mapper, float elapsedTime) const -> Kernel<Access>
+	{
+		Kernel<Access> kernel;
+		kernel.elapsedTime = elapsedTime;
+		kernel.group = &group;
+		kernel.lifes = Access::template Get<float>(mapper, ParticleComponent_Life);
+
+		return kernel;
+	}
+
+	template<typename Access>
+	inline void ParticleLifetime::Kernel<Access>::operator()(unsigned int i)
+	{
+		float& life = lifes[i];
+
+		life -= elapsedTime;
+		if (life <= 0.f)
+			group->KillParticle(i);
+	}
+
+	/*!
+	* \ingroup graphics
+	* \class Nz::ParticleMovement
+	* \brief Behavior moving the particles according to their velocity
+	*
+	* Requires the Position and Velocity components
+	*/
+
+	template<typename Access>
+	auto ParticleMovement::Prepare(ParticleGroup& /*group*/, ParticleMapper& mapper, float elapsedTime) const -> Kernel<Access>
+	{
+		Kernel<Access> kernel;
+		kernel.elapsedTime = elapsedTime;
+		kernel.positions = Access::template Get<Vector3f>(mapper, ParticleComponent_Position);
+		kernel.velocities = Access::template Get<Vector3f>(mapper, ParticleComponent_Velocity);
+
+		return kernel;
+	}
+
+	template<typename Access>
+	inline void ParticleMovement::Kernel<Access>::operator()(unsigned int i)
+	{
+		positions[i] += velocities[i] * elapsedTime;
+	}
+
+	/*!
+	* \ingroup graphics
+	* \class Nz::ParticleSizeOverLife
+	* \brief Behavior interpolating the size of the particles from their remaining life
+	*
+	* Requires the Life and Size components, the life being the remaining time of the particle in seconds
+	*/
+
+	/*!
+	* \brief Constructs a ParticleSizeOverLife object
+	*
+	* \param Start Size of a particle having its whole lifetime remaining
+	* \param End Size of a particle at the end of its life
+	* \param Lifetime Lifetime of the particles, in seconds
+	*/
+	inline ParticleSizeOverLife::ParticleSizeOverLife(const Vector2f& Start, const Vector2f& End, float Lifetime) :
+	end(End),
+	start(Start),
+	lifetime(Lifetime)
+	{
+	}
+
+	template<typename Access>
+	auto ParticleSizeOverLife::Prepare(ParticleGroup& /*group*/, ParticleMapper& mapper, float /*elapsedTime*/) const -> Kernel<Access>
+	{
+		NazaraAssert(lifetime > 0.f, "Invalid lifetime");
+
+		Kernel<Access> kernel;
+		kernel.delta = start - end;
+		kernel.end = end;
+		kernel.invLifetime = 1.f / lifetime;
+		kernel.lifes = Access::template Get<float>(mapper, ParticleComponent_Life);
+		kernel.sizes = Access::template Get<Vector2f>(mapper, ParticleComponent_Size);
+
+		return kernel;
+	}
+
+	template<typename Access>
+	inline void ParticleSizeOverLife::Kernel<Access>::operator()(unsigned int i)
+	{
+		float ratio = Clamp(lifes[i] * invLifetime, 0.f, 1.f);
+
+		sizes[i] = end + delta * ratio;
+	}
+}
+
+#include <Nazara/Graphics/DebugOff.hpp>
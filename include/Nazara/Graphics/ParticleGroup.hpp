@@ -13,6 +13,7 @@
 #include <Nazara/Graphics/ParticleDeclaration.hpp>
 #include <Nazara/Graphics/ParticleEmitter.hpp>
 #include <Nazara/Graphics/ParticleGenerator.hpp>
+#include <Nazara/Graphics/ParticleMapper.hpp>
 #include <Nazara/Graphics/ParticleRenderer.hpp>
 #include <Nazara/Graphics/Renderable.hpp>
 #include <functional>
@@ -24,8 +25,8 @@ namespace Nz
 	class NAZARA_GRAPHICS_API ParticleGroup : public Renderable
 	{
 		public:
-			ParticleGroup(unsigned int maxParticleCount, ParticleLayout layout);
-			ParticleGroup(unsigned int maxParticleCount, ParticleDeclarationConstRef declaration);
+			ParticleGroup(unsigned int maxParticleCount, ParticleLayout layout, ParticleStorage storage = ParticleStorage_Interleaved);
+			ParticleGroup(unsigned int maxParticleCount, ParticleDeclarationConstRef declaration, ParticleStorage storage = ParticleStorage_Interleaved);
 			ParticleGroup(const ParticleGroup& emitter);
 			~ParticleGroup();
 
@@ -39,6 +40,8 @@ namespace Nz
 			void* CreateParticle();
 			void* CreateParticles(unsigned int count);
 
+			void EnableParallelUpdate(bool parallelUpdate);
+
 			void* GenerateParticle();
 			void* GenerateParticles(unsigned int count);
 
@@ -47,7 +50,11 @@ namespace Nz
 			const ParticleDeclarationConstRef& GetDeclaration() const;
 			std::size_t GetMaxParticleCount() const;
 			std::size_t GetParticleCount() const;
+			inline ParticleMapper GetParticleMapper(std::size_t firstParticle = 0) const;
 			std::size_t GetParticleSize() const;
+			inline ParticleStorage GetStorage() const;
+
+			inline bool IsParallelUpdateEnabled() const;
 
 			void KillParticle(std::size_t index);
 			void KillParticles();
@@ -67,10 +74,23 @@ namespace Nz
 			NazaraSignal(OnParticleGroupRelease, const ParticleGroup* /*particleGroup*/);
 
 		private:
+			struct ParticleBounds;
+
+			void ApplyControllersParallel(float elapsedTime);
+			ParticleBounds ComputeBounds(std::size_t firstParticle, std::size_t particleCount) const;
+			void CopyParticles(const UInt8* buffer, std::size_t particleCount);
 			void MakeBoundingVolume() const override;
+			void MoveParticles(std::size_t srcIndex, std::size_t dstIndex, std::size_t count);
 			void OnEmitterMove(ParticleEmitter* oldEmitter, ParticleEmitter* newEmitter);
 			void OnEmitterRelease(const ParticleEmitter* emitter);
 			void ResizeBuffer();
+			void UpdateComponentArrays();
+
+			struct ComponentArray
+			{
+				std::size_t offset;
+				std::size_t size;
+			};
 
 			struct EmitterEntry
 			{
@@ -80,16 +100,32 @@ namespace Nz
 				ParticleEmitter* emitter;
 			};
 
+			struct ParticleBounds
+			{
+				Vector3f max;
+				Vector3f min;
+				float maxSquaredSize; //< Squared diagonal of the biggest particle
+			};
+
 			std::set<unsigned int, std::greater<unsigned int>> m_dyingParticles;
 			std::size_t m_maxParticleCount;
 			std::size_t m_particleCount;
 			std::size_t m_particleSize;
 			mutable std::vector<UInt8> m_buffer;
+			std::vector<ComponentArray> m_componentArrays;
 			std::vector<ParticleControllerRef> m_controllers;
+			std::vector<ParticleBounds> m_chunkBounds;
+			std::vector<std::size_t> m_chunkAliveCounts;
+			std::vector<UInt8> m_dyingFlags;
 			std::vector<EmitterEntry> m_emitters;
 			std::vector<ParticleGeneratorRef> m_generators;
 			ParticleDeclarationConstRef m_declaration;
 			ParticleRendererRef m_renderer;
+			ParticleStorage m_storage;
+			mutable ParticleBounds m_particleBounds;
+			mutable bool m_particleBoundsValid;
+			bool m_parallelProcessing;
+			bool m_parallelUpdate;
 			bool m_processing;
 	};
 }
@@ -13,6 +13,8 @@ namespace Nz
 	*
 	* \return Pointer to the buffer
 	*
+	* \remark With a separated storage, the buffer holds an array per component (see ParticleMapper)
+	*
 	* \see GetParticleCount
 	*/
 	inline void* ParticleGroup::GetBuffer()
@@ -33,6 +35,37 @@ namespace Nz
 	{
 		return m_buffer.data();
 	}
+
+	/*!
+	* \brief Gets a mapper to access the particles, whatever the storage is
+	* \return Mapper whose index zero refers to the particle at index firstParticle
+	*
+	* \param firstParticle Index of the first particle which will be accessed by the mapper
+	*/
+	inline ParticleMapper ParticleGroup::GetParticleMapper(std::size_t firstParticle) const
+	{
+		return ParticleMapper(m_buffer.data(), m_declaration, m_storage, m_maxParticleCount, firstParticle);
+	}
+
+	/*!
+	* \brief Gets the storage of the particles
+	* \return Layout of the particles in the buffer
+	*/
+	inline ParticleStorage ParticleGroup::GetStorage() const
+	{
+		return m_storage;
+	}
+
+	/*!
+	* \brief Checks whether the controllers are applied in parallel
+	* \return true If the update is splitted in chunks processed by the TaskScheduler
+	*
+	* \see EnableParallelUpdate
+	*/
+	inline bool ParticleGroup::IsParallelUpdateEnabled() const
+	{
+		return m_parallelUpdate;
+	}
 }
 
 #include <Nazara/Graphics/DebugOff.hpp>
@@ -18,14 +18,19 @@ namespace Nz
 	{
 		public:
 			ParticleMapper(void* buffer, const ParticleDeclaration* declaration);
+			ParticleMapper(void* buffer, const ParticleDeclaration* declaration, ParticleStorage storage, std::size_t maxParticleCount, std::size_t firstParticle = 0);
 			~ParticleMapper();
 
 			template<typename T> SparsePtr<T> GetComponentPtr(ParticleComponent component);
 			template<typename T> SparsePtr<const T> GetComponentPtr(ParticleComponent component) const;
 			inline void* GetPointer();
+			inline ParticleStorage GetStorage() const;
 
 		private:
 			const ParticleDeclaration* m_declaration;
+			ParticleStorage m_storage;
+			std::size_t m_firstParticle;
+			std::size_t m_maxParticleCount;
 			UInt8* m_ptr;
 	};
 }
@@ -5,6 +5,7 @@
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Graphics/Debug.hpp>
 #include <Nazara/Utility/Algorithm.hpp>
+#include <Nazara/Utility/Utility.hpp>
 
 namespace Nz
 {
@@ -14,7 +15,7 @@ namespace Nz
 	*
 	* \param component Component to get in the declaration
 	*
-	* \remark The same components are not continguous but separated by sizeof(ParticleSize)
+	* \remark With an interleaved storage, the same components are not continguous but separated by sizeof(ParticleSize)
 	* \remark Produces a NazaraError if component is disabled
 	*/
 
@@ -30,7 +31,14 @@ namespace Nz
 		if (enabled && GetComponentTypeOf<T>() == type)
 		{
 			///TODO: Check the ratio between the type of the attribute and the template type ?
-			return SparsePtr<T>(m_ptr + offset, m_declaration->GetStride());
+			if (m_storage == ParticleStorage_Separated)
+			{
+				// Each component is stored in its own array, placed at offset * maxParticleCount in the buffer
+				std::size_t componentSize = Utility::ComponentStride[type];
+				return SparsePtr<T>(m_ptr + offset * m_maxParticleCount + m_firstParticle * componentSize, componentSize);
+			}
+			else
+				return SparsePtr<T>(m_ptr + offset, m_declaration->GetStride());
 		}
 		else
 		{
@@ -45,7 +53,7 @@ namespace Nz
 	*
 	* \param component Component to get in the declaration
 	*
-	* \remark The same components are not continguous but separated by sizeof(ParticleSize)
+	* \remark With an interleaved storage, the same components are not continguous but separated by sizeof(ParticleSize)
 	* \remark Produces a NazaraError if component is disabled
 	*/
 
@@ -61,7 +69,14 @@ namespace Nz
 		if (enabled && GetComponentTypeOf<T>() == type)
 		{
 			///TODO: Check the ratio between the type of the attribute and the template type ?
-			return SparsePtr<const T>(m_ptr + offset, m_declaration->GetStride());
+			if (m_storage == ParticleStorage_Separated)
+			{
+				// Each component is stored in its own array, placed at offset * maxParticleCount in the buffer
+				std::size_t componentSize = Utility::ComponentStride[type];
+				return SparsePtr<const T>(m_ptr + offset * m_maxParticleCount + m_firstParticle * componentSize, componentSize);
+			}
+			else
+				return SparsePtr<const T>(m_ptr + offset, m_declaration->GetStride());
 		}
 		else
 		{
@@ -76,11 +91,22 @@ namespace Nz
 	* This can be useful when working directly with a struct
 	*
 	* \return Pointer to the buffer
+	*
+	* \remark With a separated storage, this is the beginning of the whole buffer (and not of the first particle)
 	*/
 	inline void* ParticleMapper::GetPointer()
 	{
 		return m_ptr;
 	}
+
+	/*!
+	* \brief Gets the storage of the particle buffer
+	* \return Layout of the particles in the buffer
+	*/
+	inline ParticleStorage ParticleMapper::GetStorage() const
+	{
+		return m_storage;
+	}
 }
 
 #include <Nazara/Graphics/DebugOff.hpp>
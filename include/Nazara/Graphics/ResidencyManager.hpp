@@ -0,0 +1,116 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_RESIDENCYMANAGER_HPP
+#define NAZARA_RESIDENCYMANAGER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/ResourceFuture.hpp>
+#include <Nazara/Core/String.hpp>
+#include <Nazara/Graphics/Config.hpp>
+#include <Nazara/Graphics/Model.hpp>
+#include <Nazara/Renderer/Texture.hpp>
+#include <Nazara/Utility/Image.hpp>
+#include <Nazara/Utility/Mesh.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace Nz
+{
+	class Material;
+
+	class NAZARA_GRAPHICS_API ResidencyManager
+	{
+		public:
+			ResidencyManager(UInt64 textureBudget = 256ULL * 1024 * 1024, UInt64 meshBudget = 64ULL * 1024 * 1024);
+			ResidencyManager(const ResidencyManager&) = delete;
+			ResidencyManager(ResidencyManager&&) = default;
+			~ResidencyManager() = default;
+
+			void Clear();
+
+			inline UInt64 GetMeshBudget() const;
+			inline UInt64 GetMeshMemoryUsage() const;
+			UInt8 GetResidentLevel(const Texture* texture) const;
+			inline UInt64 GetTextureBudget() const;
+			inline UInt64 GetTextureMemoryUsage() const;
+			inline UInt64 GetUploadBudget() const;
+
+			bool IsResident(const Model* model, std::size_t level) const;
+			bool IsResident(const Texture* texture) const;
+
+			void Request(const Material* material, float screenSize);
+			void Request(const Model* model, std::size_t level, float screenSize);
+			void Request(const Texture* texture, float screenSize);
+
+			inline void SetMeshBudget(UInt64 budget);
+			inline void SetTextureBudget(UInt64 budget);
+			inline void SetUploadBudget(UInt64 budget);
+
+			bool StreamLevelOfDetail(Model* model, std::size_t level, const String& filePath, const MeshParams& params = MeshParams());
+			TextureRef StreamTexture(const String& filePath, const ImageParams& params = ImageParams());
+			TextureRef StreamTexture(ImageRef image);
+
+			void Update();
+
+			ResidencyManager& operator=(const ResidencyManager&) = delete;
+			ResidencyManager& operator=(ResidencyManager&&) = default;
+
+		private:
+			struct MeshEntry;
+			struct TextureEntry;
+
+			void Evict(MeshEntry& entry);
+			bool LoadImage(TextureEntry& entry, ImageRef image);
+			bool SetResidentLevel(TextureEntry& entry, UInt8 level);
+			void UpdateMeshes();
+			void UpdateTextures();
+
+			struct MeshEntry
+			{
+				MeshParams params;
+				MeshRef fallbackMesh; //< Mesh of the level when it was registered, put back on eviction
+				MeshRef mesh;
+				ModelRef model;
+				ResourceFuture<Mesh> future;
+				String filePath;
+				UInt64 lastRequestFrame = 0;
+				UInt64 memoryUsage = 0; //< Estimated from the last load, reserved while loading
+				std::size_t level;
+				float demand = 0.f; //< Largest screen size requested during the last requested frame
+				bool failed = false;
+			};
+
+			struct TextureEntry
+			{
+				ImageRef image; //< Source of every level, null until loaded
+				ResourceFuture<Image> future;
+				TextureRef texture;
+				UInt64 lastRequestFrame = 0;
+				float demand = 0.f;
+				UInt8 baseLevel = 0; //< Coarsest resident level, never evicted
+				UInt8 residentLevel = 0;
+				bool failed = false;
+			};
+
+			std::unordered_map<const Model*, std::vector<MeshEntry>> m_meshes;
+			std::unordered_map<const Texture*, TextureEntry> m_textures;
+			std::vector<MeshEntry*> m_meshCandidates;
+			std::vector<MeshEntry*> m_meshEvictables;
+			std::vector<TextureEntry*> m_textureCandidates;
+			std::vector<TextureEntry*> m_textureEvictables;
+			UInt64 m_frameIndex;
+			UInt64 m_meshBudget;
+			UInt64 m_meshMemoryUsage;
+			UInt64 m_textureBudget;
+			UInt64 m_textureMemoryUsage;
+			UInt64 m_uploadBudget;
+	};
+}
+
+#include <Nazara/Graphics/ResidencyManager.inl>
+
+#endif // NAZARA_RESIDENCYMANAGER_HPP
@@ -0,0 +1,87 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the memory the streamed meshes may use
+	* \return Budget in bytes
+	*/
+	inline UInt64 ResidencyManager::GetMeshBudget() const
+	{
+		return m_meshBudget;
+	}
+
+	/*!
+	* \brief Gets the memory used by the streamed meshes
+	* \return Size of their vertex and index buffers in bytes, including the meshes being loaded
+	*
+	* \remark The meshes the levels fall back to are not counted
+	*/
+	inline UInt64 ResidencyManager::GetMeshMemoryUsage() const
+	{
+		return m_meshMemoryUsage;
+	}
+
+	/*!
+	* \brief Gets the memory the streamed textures may use
+	* \return Budget in bytes
+	*/
+	inline UInt64 ResidencyManager::GetTextureBudget() const
+	{
+		return m_textureBudget;
+	}
+
+	/*!
+	* \brief Gets the memory used by the streamed textures
+	* \return Size of their resident levels in bytes
+	*/
+	inline UInt64 ResidencyManager::GetTextureMemoryUsage() const
+	{
+		return m_textureMemoryUsage;
+	}
+
+	/*!
+	* \brief Gets the amount of texture data which may be uploaded by one update
+	* \return Budget in bytes
+	*/
+	inline UInt64 ResidencyManager::GetUploadBudget() const
+	{
+		return m_uploadBudget;
+	}
+
+	/*!
+	* \brief Sets the memory the streamed meshes may use
+	*
+	* \param budget Budget in bytes, meshes being evicted by the next update if it's exceeded
+	*/
+	inline void ResidencyManager::SetMeshBudget(UInt64 budget)
+	{
+		m_meshBudget = budget;
+	}
+
+	/*!
+	* \brief Sets the memory the streamed textures may use
+	*
+	* \param budget Budget in bytes, the lowest levels of the textures being always kept regardless of it
+	*/
+	inline void ResidencyManager::SetTextureBudget(UInt64 budget)
+	{
+		m_textureBudget = budget;
+	}
+
+	/*!
+	* \brief Sets the amount of texture data which may be uploaded by one update
+	*
+	* \param budget Budget in bytes, at least one texture gets its levels uploaded per update whatever its size
+	*/
+	inline void ResidencyManager::SetUploadBudget(UInt64 budget)
+	{
+		m_uploadBudget = budget;
+	}
+}
+
+#include <Nazara/Graphics/DebugOff.hpp>
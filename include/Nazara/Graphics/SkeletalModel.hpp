@@ -13,6 +13,8 @@
 #include <Nazara/Graphics/Model.hpp>
 #include <Nazara/Utility/Animation.hpp>
 #include <Nazara/Utility/Skeleton.hpp>
+#include <limits>
+#include <vector>
 
 namespace Nz
 {
@@ -60,24 +62,43 @@ namespace Nz
 			bool LoadFromStream(Stream& stream, const SkeletalModelParameters& params = SkeletalModelParameters());
 
 			bool SetAnimation(Animation* animation);
+			void SetAnimationLevelOfDetail(std::size_t level, float updateRate, unsigned int maxJointDepth = std::numeric_limits<unsigned int>::max());
 			void SetMesh(Mesh* mesh) override;
 			bool SetSequence(const String& sequenceName);
 			void SetSequence(unsigned int sequenceIndex);
 
+			bool UpdateLevelOfDetail(InstanceData* instanceData, float projectedSize, const Vector3f& eyePosition = Vector3f::Zero()) const override;
+
 			SkeletalModel& operator=(const SkeletalModel& node) = default;
 			SkeletalModel& operator=(SkeletalModel&& node) = default;
 
+			static void AdvanceAnimations(SkeletalModel* const* models, std::size_t modelCount, float elapsedTime);
+
 		private:
+			bool AdvanceFrames(float elapsedTime);
+			void ApplyPose(const SequenceJoint* pose);
+			const std::vector<UInt32>* GetAnimatedJoints() const;
 			void MakeBoundingVolume() const override;
 			/*void Register() override;
 			void Unregister() override;*/
 			void Update() override;
+			void UpdateAnimationJoints();
+
+			struct AnimationLevelOfDetail
+			{
+				std::vector<UInt32> joints; //< Animated joints, when limited by depth
+				float updateInterval = 0.f; //< Minimum time between two poses, zero to update the pose every time
+				unsigned int maxJointDepth = std::numeric_limits<unsigned int>::max();
+			};
 
+			std::vector<AnimationLevelOfDetail> m_animationLevels; //< Indexed by level of detail
 			AnimationRef m_animation;
 			Skeleton m_skeleton;
 			const Sequence* m_currentSequence;
+			mutable std::size_t m_levelOfDetail; //< Level selected by the last instance update
 			bool m_animationEnabled;
 			float m_interpolation;
+			float m_timeSincePose;
 			unsigned int m_currentFrame;
 			unsigned int m_nextFrame;
 
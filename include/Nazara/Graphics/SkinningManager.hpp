@@ -9,6 +9,7 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Graphics/Config.hpp>
+#include <Nazara/Math/Matrix4.hpp>
 
 namespace Nz
 {
@@ -21,12 +22,20 @@ namespace Nz
 		friend class Graphics;
 
 		public:
-			using SkinFunction = void (*)(const SkeletalMesh* mesh, const Skeleton* skeleton, VertexBuffer* buffer);
+			using SkinFunction = void (*)(const SkeletalMesh* mesh, const Skeleton* skeleton, VertexBuffer* buffer, bool dualQuaternion);
 
 			SkinningManager() = delete;
 			~SkinningManager() = delete;
 
+			static void EnableDualQuaternionSkinning(bool dualQuaternionSkinning = true);
+			static void EnableGPUSkinning(bool gpuSkinning = true);
+
 			static VertexBuffer* GetBuffer(const SkeletalMesh* mesh, const Skeleton* skeleton);
+			static const Matrix4f* GetJointMatrices(const Skeleton* skeleton);
+
+			static bool IsDualQuaternionSkinningEnabled();
+			static bool IsGPUSkinningEnabled();
+
 			static void Skin();
 
 		private:
@@ -37,6 +46,8 @@ namespace Nz
 			static void Uninitialize();
 
 			static SkinFunction s_skinFunc;
+			static bool s_dualQuaternionSkinning;
+			static bool s_gpuSkinning;
 	};
 }
 
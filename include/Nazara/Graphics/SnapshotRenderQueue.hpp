@@ -0,0 +1,66 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_SNAPSHOTRENDERQUEUE_HPP
+#define NAZARA_SNAPSHOTRENDERQUEUE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/FrameArena.hpp>
+#include <Nazara/Graphics/AbstractRenderQueue.hpp>
+#include <Nazara/Graphics/Material.hpp>
+#include <Nazara/Renderer/Texture.hpp>
+#include <Nazara/Utility/IndexBuffer.hpp>
+#include <Nazara/Utility/VertexBuffer.hpp>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_GRAPHICS_API SnapshotRenderQueue final : public AbstractRenderQueue
+	{
+		public:
+			inline SnapshotRenderQueue(AbstractRenderQueue* renderQueue);
+			~SnapshotRenderQueue() = default;
+
+			void AddBillboards(int renderOrder, const Material* material, std::size_t billboardCount, const Recti& scissorRect, SparsePtr<const Vector3f> positionPtr, SparsePtr<const Vector2f> sizePtr, SparsePtr<const Vector2f> sinCosPtr = nullptr, SparsePtr<const Color> colorPtr = nullptr) override;
+			void AddBillboards(int renderOrder, const Material* material, std::size_t billboardCount, const Recti& scissorRect, SparsePtr<const Vector3f> positionPtr, SparsePtr<const Vector2f> sizePtr, SparsePtr<const Vector2f> sinCosPtr, SparsePtr<const float> alphaPtr) override;
+			void AddBillboards(int renderOrder, const Material* material, std::size_t billboardCount, const Recti& scissorRect, SparsePtr<const Vector3f> positionPtr, SparsePtr<const Vector2f> sizePtr, SparsePtr<const float> anglePtr, SparsePtr<const Color> colorPtr = nullptr) override;
+			void AddBillboards(int renderOrder, const Material* material, std::size_t billboardCount, const Recti& scissorRect, SparsePtr<const Vector3f> positionPtr, SparsePtr<const Vector2f> sizePtr, SparsePtr<const float> anglePtr, SparsePtr<const float> alphaPtr) override;
+			void AddBillboards(int renderOrder, const Material* material, std::size_t billboardCount, const Recti& scissorRect, SparsePtr<const Vector3f> positionPtr, SparsePtr<const float> sizePtr, SparsePtr<const Vector2f> sinCosPtr = nullptr, SparsePtr<const Color> colorPtr = nullptr) override;
+			void AddBillboards(int renderOrder, const Material* material, std::size_t billboardCount, const Recti& scissorRect, SparsePtr<const Vector3f> positionPtr, SparsePtr<const float> sizePtr, SparsePtr<const Vector2f> sinCosPtr, SparsePtr<const float> alphaPtr) override;
+			void AddBillboards(int renderOrder, const Material* material, std::size_t billboardCount, const Recti& scissorRect, SparsePtr<const Vector3f> positionPtr, SparsePtr<const float> sizePtr, SparsePtr<const float> anglePtr, SparsePtr<const Color> colorPtr = nullptr) override;
+			void AddBillboards(int renderOrder, const Material* material, std::size_t billboardCount, const Recti& scissorRect, SparsePtr<const Vector3f> positionPtr, SparsePtr<const float> sizePtr, SparsePtr<const float> anglePtr, SparsePtr<const float> alphaPtr) override;
+			void AddDirectionalLight(const DirectionalLight& light) override;
+			void AddDrawable(int renderOrder, const Drawable* drawable) override;
+			void AddMesh(int renderOrder, const Material* material, const MeshData& meshData, const Boxf& meshAABB, const Matrix4f& transformMatrix, const Recti& scissorRect) override;
+			void AddPointLight(const PointLight& light) override;
+			void AddReflectionProbe(const ReflectionProbe& probe) override;
+			void AddSkinnedMesh(int renderOrder, const Material* material, const MeshData& meshData, const Boxf& meshAABB, const Matrix4f& transformMatrix, const Matrix4f* jointMatrices, std::size_t jointCount, const Recti& scissorRect) override;
+			void AddSpotLight(const SpotLight& light) override;
+			void AddSprites(int renderOrder, const Material* material, const VertexStruct_XYZ_Color_UV* vertices, std::size_t spriteCount, const Recti& scissorRect, const Texture* overlay = nullptr, unsigned int overlayLayer = 0, const SpriteInstance* instances = nullptr) override;
+
+			void Clear(bool fully = false) override;
+			void ClearLights() override;
+
+			inline std::size_t GetCopiedSize() const;
+			inline AbstractRenderQueue* GetRenderQueue() const;
+
+		private:
+			template<typename T> const T* Copy(const T* data, std::size_t count);
+			void KeepAlive(const Material* material);
+			MeshData KeepAlive(const MeshData& meshData);
+
+			std::vector<IndexBufferConstRef> m_indexBuffers;
+			std::vector<MaterialConstRef> m_materials;
+			std::vector<TextureConstRef> m_textures;
+			std::vector<ObjectRef<const VertexBuffer>> m_vertexBuffers;
+			AbstractRenderQueue* m_renderQueue;
+			FrameArena m_arena;
+	};
+}
+
+#include <Nazara/Graphics/SnapshotRenderQueue.inl>
+
+#endif // NAZARA_SNAPSHOTRENDERQUEUE_HPP
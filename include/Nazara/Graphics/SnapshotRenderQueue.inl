@@ -0,0 +1,55 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Graphics/SnapshotRenderQueue.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <memory>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Constructs a SnapshotRenderQueue filling another queue
+	*
+	* \param renderQueue Queue receiving the copies, which must outlive this one
+	*/
+	inline SnapshotRenderQueue::SnapshotRenderQueue(AbstractRenderQueue* renderQueue) :
+	m_renderQueue(renderQueue)
+	{
+		NazaraAssert(renderQueue, "Invalid render queue");
+	}
+
+	/*!
+	* \brief Gets the size of the data copied since the last clear
+	* \return Size of the sprites vertices, joint matrices and meshlets copies
+	*/
+	inline std::size_t SnapshotRenderQueue::GetCopiedSize() const
+	{
+		return m_arena.GetAllocatedSize();
+	}
+
+	/*!
+	* \brief Gets the queue receiving the copies
+	* \return Pointer to the underlying queue
+	*/
+	inline AbstractRenderQueue* SnapshotRenderQueue::GetRenderQueue() const
+	{
+		return m_renderQueue;
+	}
+
+	template<typename T>
+	const T* SnapshotRenderQueue::Copy(const T* data, std::size_t count)
+	{
+		if (!data || count == 0)
+			return data;
+
+		// Copied types have trivial destructors, the arena never calls them
+		T* copy = static_cast<T*>(m_arena.Allocate(count * sizeof(T), alignof(T)));
+		std::uninitialized_copy(data, data + count, copy);
+
+		return copy;
+	}
+}
+
+#include <Nazara/Graphics/DebugOff.hpp>
@@ -43,7 +43,7 @@ namespace Nz
 			inline void SetMaterial(std::size_t skinIndex, MaterialRef material);
 			inline void SetScale(float scale);
 
-			void Update(const AbstractTextDrawer& drawer);
+			void Update(const AbstractTextDrawer& drawer, std::size_t firstGlyph = 0);
 
 			inline TextSprite& operator=(const TextSprite& text);
 
@@ -58,6 +58,7 @@ namespace Nz
 
 			struct RenderIndices
 			{
+				AbstractImage* layer;
 				unsigned int first;
 				unsigned int count;
 			};
@@ -71,8 +72,9 @@ namespace Nz
 			};
 
 			std::unordered_map<const AbstractAtlas*, AtlasSlots> m_atlases;
-			mutable std::unordered_map<Texture*, RenderIndices> m_renderInfos;
-			mutable std::vector<VertexStruct_XY_Color_UV> m_localVertices;
+			std::vector<RenderIndices> m_renderInfos; //< Runs of consecutive glyphs sharing an atlas layer
+			std::vector<unsigned int> m_glyphSprites; //< Index of the sprite of each glyph of the drawer, or of the next one for glyphs without sprite
+			std::vector<VertexStruct_XY_Color_UV> m_localVertices;
 			Color m_color;
 			Recti m_localBounds;
 			float m_scale;
@@ -42,6 +42,7 @@ namespace Nz
 	inline TextSprite::TextSprite(const TextSprite& sprite) :
 	InstancedRenderable(sprite),
 	m_renderInfos(sprite.m_renderInfos),
+	m_glyphSprites(sprite.m_glyphSprites),
 	m_localVertices(sprite.m_localVertices),
 	m_color(sprite.m_color),
 	m_localBounds(sprite.m_localBounds),
@@ -66,6 +67,7 @@ namespace Nz
 	{
 		m_atlases.clear();
 		m_boundingVolume.MakeNull();
+		m_glyphSprites.clear();
 		m_localVertices.clear();
 		m_renderInfos.clear();
 	}
@@ -157,6 +159,7 @@ namespace Nz
 		m_atlases.clear();
 
 		m_color = text.m_color;
+		m_glyphSprites = text.m_glyphSprites;
 		m_renderInfos = text.m_renderInfos;
 		m_localBounds = text.m_localBounds;
 		m_localVertices = text.m_localVertices;
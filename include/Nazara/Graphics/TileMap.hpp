@@ -10,11 +10,11 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Graphics/InstancedRenderable.hpp>
 #include <Nazara/Graphics/Material.hpp>
-#include <set>
 
 namespace Nz
 {
 	class TileMap;
+	struct VertexStruct_XYZ_Color_UV;
 
 	using TileMapConstRef = ObjectRef<const TileMap>;
 	using TileMapLibrary = ObjectLibrary<TileMap>;
@@ -77,15 +77,32 @@ namespace Nz
 			static bool Initialize();
 			static void Uninitialize();
 
-			struct Layer
+			struct Chunk
 			{
-				std::set<std::size_t> tiles;
+				std::vector<std::size_t> layerTileCounts; //< Enabled tiles of each layer, the vertices of a chunk being sorted by layer
+				std::size_t firstTile; //< Offset of the vertices of the chunk, in tiles
+				Rectui tiles;
+				UInt32 revision = 0;
 			};
 
+			struct InstanceHeader
+			{
+				Matrix4f transformMatrix;
+				UInt32 revision;
+			};
+
+			inline Chunk& GetChunk(std::size_t tileIndex);
+			inline void InvalidateChunks();
+			inline void SetTileDisabled(std::size_t tileIndex);
+			inline void SetTileEnabled(std::size_t tileIndex, const Rectf& coords, const Color& color, std::size_t materialIndex);
+			void UpdateChunk(const Chunk& chunk, const Matrix4f& transformMatrix, VertexStruct_XYZ_Color_UV* vertices) const;
+
+			std::vector<Chunk> m_chunks;
 			std::vector<Tile> m_tiles;
-			std::vector<Layer> m_layers;
+			Vector2ui m_chunkCount;
 			Vector2ui m_mapSize;
 			Vector2f m_tileSize;
+			UInt32 m_revision;
 			bool m_isometricModeEnabled;
 
 			static TileMapLibrary::LibraryMap s_library;
@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Core/Error.hpp>
+#include <algorithm>
 #include <memory>
 #include <Nazara/Graphics/Debug.hpp>
 
@@ -22,14 +23,35 @@ namespace Nz
 	*/
 	inline TileMap::TileMap(const Nz::Vector2ui& mapSize, const Nz::Vector2f& tileSize, std::size_t materialCount) :
 	m_tiles(mapSize.x * mapSize.y),
-	m_layers(materialCount),
+	m_chunkCount((mapSize.x + NAZARA_GRAPHICS_TILEMAP_CHUNK_SIZE - 1) / NAZARA_GRAPHICS_TILEMAP_CHUNK_SIZE, (mapSize.y + NAZARA_GRAPHICS_TILEMAP_CHUNK_SIZE - 1) / NAZARA_GRAPHICS_TILEMAP_CHUNK_SIZE),
 	m_mapSize(mapSize),
 	m_tileSize(tileSize),
+	m_revision(0),
 	m_isometricModeEnabled(false)
 	{
 		NazaraAssert(m_tiles.size() != 0U, "Invalid map size");
 		NazaraAssert(m_tileSize.x > 0 && m_tileSize.y > 0, "Invalid tile size");
-		NazaraAssert(m_layers.size() != 0U, "Invalid material count");
+		NazaraAssert(materialCount != 0U, "Invalid material count");
+
+		// Every chunk keeps room for all of its tiles, so a change of tile never moves the vertices of the other chunks
+		m_chunks.resize(m_chunkCount.x * m_chunkCount.y);
+
+		std::size_t firstTile = 0;
+		for (unsigned int y = 0; y < m_chunkCount.y; ++y)
+		{
+			for (unsigned int x = 0; x < m_chunkCount.x; ++x)
+			{
+				Chunk& chunk = m_chunks[y * m_chunkCount.x + x];
+				chunk.firstTile = firstTile;
+				chunk.layerTileCounts.resize(materialCount, 0U);
+				chunk.tiles.x = x * NAZARA_GRAPHICS_TILEMAP_CHUNK_SIZE;
+				chunk.tiles.y = y * NAZARA_GRAPHICS_TILEMAP_CHUNK_SIZE;
+				chunk.tiles.width = std::min<unsigned int>(NAZARA_GRAPHICS_TILEMAP_CHUNK_SIZE, mapSize.x - chunk.tiles.x);
+				chunk.tiles.height = std::min<unsigned int>(NAZARA_GRAPHICS_TILEMAP_CHUNK_SIZE, mapSize.y - chunk.tiles.y);
+
+				firstTile += chunk.tiles.width * chunk.tiles.height;
+			}
+		}
 
 		ResetMaterials(materialCount);
 
@@ -47,13 +69,9 @@ namespace Nz
 	{
 		NazaraAssert(tilePos.x < m_mapSize.x && tilePos.y < m_mapSize.y, "Tile position is out of bounds");
 
-		std::size_t tileIndex = tilePos.y * m_mapSize.x + tilePos.x;
-		Tile& tile = m_tiles[tileIndex];
-		tile.enabled = false;
-
-		m_layers[tile.layerIndex].tiles.erase(tileIndex);
+		SetTileDisabled(tilePos.y * m_mapSize.x + tilePos.x);
 
-		InvalidateInstanceData(1U << tile.layerIndex);
+		InvalidateInstanceData(0xFFFFFFFF);
 	}
 
 	/*!
@@ -64,10 +82,10 @@ namespace Nz
 		for (Tile& tile : m_tiles)
 			tile.enabled = false;
 
-		for (Layer& layer : m_layers)
-			layer.tiles.clear();
+		for (Chunk& chunk : m_chunks)
+			std::fill(chunk.layerTileCounts.begin(), chunk.layerTileCounts.end(), 0U);
 
-		InvalidateInstanceData(0xFFFFFFFF);
+		InvalidateChunks();
 	}
 
 	/*!
@@ -86,25 +104,16 @@ namespace Nz
 	{
 		NazaraAssert(tilesPos || tileCount == 0, "Invalid tile position array with a non-zero tileCount");
 
-		UInt32 invalidatedLayers = 0;
-
 		for (std::size_t i = 0; i < tileCount; ++i)
 		{
 			NazaraAssert(tilesPos->x < m_mapSize.x && tilesPos->y < m_mapSize.y, "Tile position is out of bounds");
 
-			std::size_t tileIndex = tilesPos->y * m_mapSize.x + tilesPos->x;
-			Tile& tile = m_tiles[tileIndex];
-			tile.enabled = false;
-
-			m_layers[tile.layerIndex].tiles.erase(tileIndex);
-
-			invalidatedLayers |= 1U << tile.layerIndex;
-
+			SetTileDisabled(tilesPos->y * m_mapSize.x + tilesPos->x);
 			tilesPos++;
 		}
 
 		if (tileCount > 0)
-			InvalidateInstanceData(invalidatedLayers);
+			InvalidateInstanceData(0xFFFFFFFF);
 	}
 
 	/*!
@@ -120,7 +129,7 @@ namespace Nz
 	{
 		m_isometricModeEnabled = isometric;
 
-		InvalidateInstanceData(0xFFFFFFFF);
+		InvalidateChunks();
 	}
 
 	/*!
@@ -138,29 +147,11 @@ namespace Nz
 	inline void TileMap::EnableTile(const Vector2ui& tilePos, const Rectf& coords, const Color& color, std::size_t materialIndex)
 	{
 		NazaraAssert(tilePos.x < m_mapSize.x && tilePos.y < m_mapSize.y, "Tile position is out of bounds");
-		NazaraAssert(materialIndex < m_layers.size(), "Material out of bounds");
-
-		UInt32 invalidatedLayers = 1U << materialIndex;
-
-		std::size_t tileIndex = tilePos.y * m_mapSize.x + tilePos.x;
-		Tile& tile = m_tiles[tilePos.y * m_mapSize.x + tilePos.x];
-
-		if (!tile.enabled)
-			m_layers[materialIndex].tiles.insert(tileIndex);
-		else if (materialIndex != tile.layerIndex)
-		{
-			m_layers[materialIndex].tiles.erase(tileIndex);
-			m_layers[tile.layerIndex].tiles.insert(tileIndex);
-
-			invalidatedLayers |= 1U << tile.layerIndex;
-		}
+		NazaraAssert(materialIndex < GetMaterialCount(), "Material out of bounds");
 
-		tile.enabled = true;
-		tile.color = color;
-		tile.textureCoords = coords;
-		tile.layerIndex = materialIndex;
+		SetTileEnabled(tilePos.y * m_mapSize.x + tilePos.x, coords, color, materialIndex);
 
-		InvalidateInstanceData(invalidatedLayers);
+		InvalidateInstanceData(0xFFFFFFFF);
 	}
 
 	/*!
@@ -180,7 +171,7 @@ namespace Nz
 	*/
 	inline void TileMap::EnableTile(const Vector2ui& tilePos, const Rectui& rect, const Color& color, std::size_t materialIndex)
 	{
-		NazaraAssert(materialIndex < m_layers.size(), "Material out of bounds");
+		NazaraAssert(materialIndex < GetMaterialCount(), "Material out of bounds");
 
 		const MaterialRef& material = GetMaterial(materialIndex);
 		NazaraAssert(material->HasDiffuseMap(), "Material has no diffuse map");
@@ -209,23 +200,23 @@ namespace Nz
 	*/
 	inline void TileMap::EnableTiles(const Rectf& coords, const Color& color, std::size_t materialIndex)
 	{
-		NazaraAssert(materialIndex < m_layers.size(), "Material out of bounds");
+		NazaraAssert(materialIndex < GetMaterialCount(), "Material out of bounds");
 
-		for (Layer& layer : m_layers)
-			layer.tiles.clear();
-
-		std::size_t tileIndex = 0;
 		for (Tile& tile : m_tiles)
 		{
 			tile.enabled = true;
 			tile.color = color;
 			tile.textureCoords = coords;
 			tile.layerIndex = materialIndex;
+		}
 
-			m_layers[materialIndex].tiles.insert(tileIndex++);
+		for (Chunk& chunk : m_chunks)
+		{
+			std::fill(chunk.layerTileCounts.begin(), chunk.layerTileCounts.end(), 0U);
+			chunk.layerTileCounts[materialIndex] = chunk.tiles.width * chunk.tiles.height;
 		}
 
-		InvalidateInstanceData(0xFFFFFFFF);
+		InvalidateChunks();
 	}
 
 	/*!
@@ -244,7 +235,7 @@ namespace Nz
 	*/
 	inline void TileMap::EnableTiles(const Rectui& rect, const Color& color, std::size_t materialIndex)
 	{
-		NazaraAssert(materialIndex < m_layers.size(), "Material out of bounds");
+		NazaraAssert(materialIndex < GetMaterialCount(), "Material out of bounds");
 
 		Texture* diffuseMap = GetMaterial(materialIndex)->GetDiffuseMap();
 		float invWidth = 1.f / diffuseMap->GetWidth();
@@ -270,36 +261,18 @@ namespace Nz
 	inline void TileMap::EnableTiles(const Vector2ui* tilesPos, std::size_t tileCount, const Rectf& coords, const Color& color, std::size_t materialIndex)
 	{
 		NazaraAssert(tilesPos || tileCount == 0, "Invalid tile position array with a non-zero tileCount");
-		NazaraAssert(materialIndex < m_layers.size(), "Material out of bounds");
-
-		UInt32 invalidatedLayers = 1U << materialIndex;
+		NazaraAssert(materialIndex < GetMaterialCount(), "Material out of bounds");
 
 		for (std::size_t i = 0; i < tileCount; ++i)
 		{
 			NazaraAssert(tilesPos->x < m_mapSize.x && tilesPos->y < m_mapSize.y, "Tile position is out of bounds");
 
-			std::size_t tileIndex = tilesPos->y * m_mapSize.x + tilesPos->x;
-			Tile& tile = m_tiles[tileIndex];
-
-			if (!tile.enabled)
-				m_layers[materialIndex].tiles.insert(tileIndex);
-			else if (materialIndex != tile.layerIndex)
-			{
-				m_layers[materialIndex].tiles.erase(tileIndex);
-				m_layers[tile.layerIndex].tiles.insert(tileIndex);
-
-				invalidatedLayers |= 1U << tile.layerIndex;
-			}
-
-			tile.enabled = true;
-			tile.color = color;
-			tile.textureCoords = coords;
-			tile.layerIndex = materialIndex;
+			SetTileEnabled(tilesPos->y * m_mapSize.x + tilesPos->x, coords, color, materialIndex);
 			tilesPos++;
 		}
 
 		if (tileCount > 0)
-			InvalidateInstanceData(invalidatedLayers);
+			InvalidateInstanceData(0xFFFFFFFF);
 	}
 
 	/*!
@@ -320,7 +293,7 @@ namespace Nz
 	*/
 	inline void TileMap::EnableTiles(const Vector2ui* tilesPos, std::size_t tileCount, const Rectui& rect, const Color& color, std::size_t materialIndex)
 	{
-		NazaraAssert(materialIndex < m_layers.size(), "Material out of bounds");
+		NazaraAssert(materialIndex < GetMaterialCount(), "Material out of bounds");
 
 		const MaterialRef& material = GetMaterial(materialIndex);
 		NazaraAssert(material->HasDiffuseMap(), "Material has no diffuse map");
@@ -404,18 +377,87 @@ namespace Nz
 	{
 		InstancedRenderable::operator=(tileMap);
 
-		m_layers = tileMap.m_layers;
+		m_chunks = tileMap.m_chunks;
+		m_chunkCount = tileMap.m_chunkCount;
+		m_isometricModeEnabled = tileMap.m_isometricModeEnabled;
 		m_mapSize = tileMap.m_mapSize;
 		m_tiles = tileMap.m_tiles;
 		m_tileSize = tileMap.m_tileSize;
 
 		// We do not copy final vertices because it's highly probable that our parameters are modified and they must be regenerated
 		InvalidateBoundingVolume();
-		InvalidateInstanceData(0xFFFFFFFF);
+		InvalidateChunks();
 
 		return *this;
 	}
 
+	/*!
+	* \brief Gets the chunk a tile belongs to
+	* \return Chunk of the tile
+	*
+	* \param tileIndex Index of the tile
+	*/
+	inline TileMap::Chunk& TileMap::GetChunk(std::size_t tileIndex)
+	{
+		std::size_t x = (tileIndex % m_mapSize.x) / NAZARA_GRAPHICS_TILEMAP_CHUNK_SIZE;
+		std::size_t y = (tileIndex / m_mapSize.x) / NAZARA_GRAPHICS_TILEMAP_CHUNK_SIZE;
+
+		return m_chunks[y * m_chunkCount.x + x];
+	}
+
+	/*!
+	* \brief Invalidates the vertices of every chunk, for every instance
+	*/
+	inline void TileMap::InvalidateChunks()
+	{
+		m_revision++;
+
+		InvalidateInstanceData(0xFFFFFFFF);
+	}
+
+	/*!
+	* \brief Disables a tile and invalidates its chunk
+	*
+	* \param tileIndex Index of the tile
+	*/
+	inline void TileMap::SetTileDisabled(std::size_t tileIndex)
+	{
+		Tile& tile = m_tiles[tileIndex];
+		if (tile.enabled)
+		{
+			Chunk& chunk = GetChunk(tileIndex);
+			chunk.layerTileCounts[tile.layerIndex]--;
+			chunk.revision++;
+
+			tile.enabled = false;
+		}
+	}
+
+	/*!
+	* \brief Enables and sets up a tile and invalidates its chunk
+	*
+	* \param tileIndex Index of the tile
+	* \param coords Normalized coordinates ([0..1]) of the tile in the material textures
+	* \param color The multiplicative color applied to the tile
+	* \param materialIndex The material which will be used for rendering this tile
+	*/
+	inline void TileMap::SetTileEnabled(std::size_t tileIndex, const Rectf& coords, const Color& color, std::size_t materialIndex)
+	{
+		Chunk& chunk = GetChunk(tileIndex);
+		chunk.revision++;
+
+		Tile& tile = m_tiles[tileIndex];
+		if (tile.enabled)
+			chunk.layerTileCounts[tile.layerIndex]--;
+
+		chunk.layerTileCounts[materialIndex]++;
+
+		tile.enabled = true;
+		tile.color = color;
+		tile.textureCoords = coords;
+		tile.layerIndex = materialIndex;
+	}
+
 	/*!
 	* \brief Creates a new TileMap from the arguments
 	* \return A reference to the newly created TileMap
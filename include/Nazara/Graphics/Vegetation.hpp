@@ -0,0 +1,119 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_VEGETATION_HPP
+#define NAZARA_VEGETATION_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Graphics/Config.hpp>
+#include <Nazara/Graphics/Drawable.hpp>
+#include <Nazara/Graphics/InstancedRenderable.hpp>
+#include <Nazara/Graphics/Material.hpp>
+#include <Nazara/Math/Box.hpp>
+#include <Nazara/Math/Matrix4.hpp>
+#include <Nazara/Math/Vector2.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <Nazara/Renderer/Renderer.hpp>
+#include <Nazara/Renderer/Shader.hpp>
+#include <Nazara/Utility/Buffer.hpp>
+#include <Nazara/Utility/StaticMesh.hpp>
+#include <Nazara/Utility/VertexBuffer.hpp>
+#include <Nazara/Utility/VertexDeclaration.hpp>
+#include <vector>
+
+namespace Nz
+{
+	class Image;
+	class Vegetation;
+
+	using VegetationConstRef = ObjectRef<const Vegetation>;
+	using VegetationRef = ObjectRef<Vegetation>;
+
+	class NAZARA_GRAPHICS_API Vegetation : public InstancedRenderable, public Drawable
+	{
+		friend class Graphics;
+
+		public:
+			Vegetation(StaticMeshRef mesh, MaterialRef material = Material::GetDefault(), float cellSize = 16.f);
+			Vegetation(const Vegetation&) = delete;
+			Vegetation(Vegetation&&) = delete;
+			~Vegetation() = default;
+
+			void AddInstance(const Vector3f& position, float scale = 1.f, float rotation = 0.f);
+			void AddToRenderQueue(AbstractRenderQueue* renderQueue, const InstanceData& instanceData, const Recti& scissorRect) const override;
+
+			void Clear();
+
+			void Draw() const override;
+
+			inline float GetCellSize() const;
+			inline std::size_t GetInstanceCount() const;
+			inline const StaticMeshRef& GetMesh() const;
+			inline const Vector2f& GetWindDirection() const;
+			inline float GetWindFrequency() const;
+			inline float GetWindStrength() const;
+
+			std::size_t Scatter(const StaticMesh& surface, float density, const Image* densityMap = nullptr, UInt32 seed = 0, float minScale = 1.f, float maxScale = 1.f);
+
+			inline void SetMaterial(MaterialRef material);
+			inline void SetWind(const Vector2f& direction, float strength, float frequency = 1.f);
+
+			inline void Update(float elapsedTime);
+
+			Vegetation& operator=(const Vegetation&) = delete;
+			Vegetation& operator=(Vegetation&&) = delete;
+
+			template<typename... Args> static VegetationRef New(Args&&... args);
+
+		private:
+			void MakeBoundingVolume() const override;
+			void UpdateBuffers() const;
+			void UpdateCells() const;
+
+			static bool Initialize();
+			static void Uninitialize();
+
+			struct Cell
+			{
+				Boxf aabb;             //< Instances without wind
+				UInt32 firstInstance;
+				UInt32 instanceCount;
+				float maxScale;
+			};
+
+			struct Instance
+			{
+				Vector3f position;
+				float scale;
+				Vector2f sinCos; //< Rotation around the up axis
+			};
+
+			mutable std::vector<Instance> m_instances; //< Sorted by cell
+			mutable std::vector<Cell> m_cells;
+			mutable std::vector<Renderer::DrawIndexedIndirectCommand> m_commands;
+			mutable std::vector<VertexBufferRef> m_cellInstanceBuffers; //< Used when multi draw indirect isn't supported
+			mutable Buffer m_commandBuffer;
+			mutable VertexBuffer m_instanceBuffer;
+			mutable Matrix4f m_transformMatrix;
+			StaticMeshRef m_mesh;
+			Vector2f m_windDirection;
+			float m_cellSize;
+			float m_meshHeight;
+			float m_meshRadius;
+			float m_time;
+			float m_windFrequency;
+			float m_windStrength;
+			mutable bool m_buffersInvalidated;
+			mutable bool m_cellsInvalidated;
+
+			static ShaderRef s_shader;
+			static VertexDeclarationRef s_instanceDeclaration;
+	};
+}
+
+#include <Nazara/Graphics/Vegetation.inl>
+
+#endif // NAZARA_VEGETATION_HPP
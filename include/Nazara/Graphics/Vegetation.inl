@@ -0,0 +1,123 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Error.hpp>
+#include <memory>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the size of the cells the instances are grouped (and culled) by
+	* \return Cell size, in units along the X and Z axes
+	*/
+	inline float Vegetation::GetCellSize() const
+	{
+		return m_cellSize;
+	}
+
+	/*!
+	* \brief Gets the number of instances
+	* \return Instance count
+	*/
+	inline std::size_t Vegetation::GetInstanceCount() const
+	{
+		return m_instances.size();
+	}
+
+	/*!
+	* \brief Gets the mesh drawn for every instance
+	* \return Mesh
+	*/
+	inline const StaticMeshRef& Vegetation::GetMesh() const
+	{
+		return m_mesh;
+	}
+
+	/*!
+	* \brief Gets the direction the wind bends the instances to
+	* \return Normalized direction on the XZ plane
+	*/
+	inline const Vector2f& Vegetation::GetWindDirection() const
+	{
+		return m_windDirection;
+	}
+
+	/*!
+	* \brief Gets the speed at which the instances sway in the wind
+	* \return Frequency, in radians per second
+	*/
+	inline float Vegetation::GetWindFrequency() const
+	{
+		return m_windFrequency;
+	}
+
+	/*!
+	* \brief Gets the displacement of the top of the instances by the wind
+	* \return Strength, in units for an instance of scale one
+	*/
+	inline float Vegetation::GetWindStrength() const
+	{
+		return m_windStrength;
+	}
+
+	/*!
+	* \brief Sets the material used to draw the instances
+	*
+	* Its render states, diffuse color, diffuse map and alpha threshold are used.
+	*
+	* \param material Material
+	*/
+	inline void Vegetation::SetMaterial(MaterialRef material)
+	{
+		NazaraAssert(material, "Invalid material");
+
+		InstancedRenderable::SetMaterial(0, std::move(material));
+	}
+
+	/*!
+	* \brief Sets the wind bending the instances
+	*
+	* The top of the mesh is moved the most, its bottom staying in place, every instance swaying with its own phase.
+	*
+	* \param direction Direction on the XZ plane, a null direction stopping the wind
+	* \param strength Displacement of the top of the instances, in units for an instance of scale one
+	* \param frequency Speed of the swaying, in radians per second
+	*/
+	inline void Vegetation::SetWind(const Vector2f& direction, float strength, float frequency)
+	{
+		m_windDirection = (direction != Vector2f::Zero()) ? Vector2f::Normalize(direction) : Vector2f::Zero();
+		m_windFrequency = frequency;
+		m_windStrength = strength;
+
+		InvalidateBoundingVolume();
+	}
+
+	/*!
+	* \brief Advances the wind animation
+	*
+	* \param elapsedTime Time elapsed since the last update, in seconds
+	*/
+	inline void Vegetation::Update(float elapsedTime)
+	{
+		m_time += elapsedTime;
+	}
+
+	/*!
+	* \brief Creates a new vegetation from the arguments
+	* \return A reference to the newly created vegetation
+	*
+	* \param args Arguments for the vegetation
+	*/
+	template<typename... Args>
+	VegetationRef Vegetation::New(Args&&... args)
+	{
+		std::unique_ptr<Vegetation> object(new Vegetation(std::forward<Args>(args)...));
+		object->SetPersistent(false);
+
+		return object.release();
+	}
+}
+
+#include <Nazara/Graphics/DebugOff.hpp>
@@ -35,6 +35,7 @@
 #include <Nazara/Lua/LuaClass.hpp>
 #include <Nazara/Lua/LuaCoroutine.hpp>
 #include <Nazara/Lua/LuaInstance.hpp>
+#include <Nazara/Lua/LuaScheduler.hpp>
 #include <Nazara/Lua/LuaState.hpp>
 
 #endif // NAZARA_GLOBAL_LUA_HPP
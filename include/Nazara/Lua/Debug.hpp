@@ -4,5 +4,7 @@
 
 #include <Nazara/Lua/Config.hpp>
 #if NAZARA_LUA_MANAGE_MEMORY
+	#undef NAZARA_MEMORY_TAG
+	#define NAZARA_MEMORY_TAG Nz::MemoryTag_Lua
 	#include <Nazara/Core/Debug/NewRedefinition.hpp>
 #endif
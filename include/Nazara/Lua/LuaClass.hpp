@@ -76,17 +76,31 @@ namespace Nz
 			void SetupGetter(LuaState& state, LuaCFunction proxy, int classInfoRef);
 			void SetupGlobalTable(LuaState& state, int classInfoRef);
 			void SetupMetatable(LuaState& state, int classInfoRef);
-			void SetupMethod(LuaState& state, LuaCFunction proxy, const String& name, std::size_t methodIndex, int classInfoRef);
+			void SetupMethod(LuaState& state, LuaCFunction proxy, const String& name, const void* data, int classInfoRef, const void* metatable = nullptr);
 			void SetupSetter(LuaState& state, LuaCFunction proxy, int classInfoRef);
 
+			// A bound function is called through its own C function, generated for its type, which gets the data from an upvalue
+			struct Method
+			{
+				LuaCFunction proxy;
+				std::shared_ptr<const void> data;
+			};
+
+			template<typename Handler, typename F>
+			struct MethodBinding
+			{
+				Handler handler;
+				F func;
+			};
+
 			using ParentFunc = std::function<void(LuaState& state, T* instance)>;
 			using InstanceGetter = std::function<T*(LuaState& state)>;
 
 			struct ClassInfo
 			{
-				std::vector<ClassFunc> methods;
+				std::vector<Method> methods;
 				std::vector<ParentFunc> parentGetters;
-				std::vector<StaticFunc> staticMethods;
+				std::vector<Method> staticMethods;
 				std::unordered_map<String, InstanceGetter> instanceGetters;
 				ClassIndexFunc getter;
 				ClassIndexFunc setter;
@@ -98,10 +112,13 @@ namespace Nz
 				int globalTableRef = -1;
 			};
 
+			template<typename Binding> static int BoundMethodProxy(lua_State* internalState);
+			template<typename Binding> static int BoundStaticMethodProxy(lua_State* internalState);
 			static int ConstructorProxy(lua_State* internalState);
 			static int FinalizerProxy(lua_State* internalState);
 			static int InfoDestructor(lua_State* internalState);
 			static void Get(const std::shared_ptr<ClassInfo>& info, LuaState& state, T* instance);
+			static T* GetMethodInstance(LuaState& state);
 			static int GetterProxy(lua_State* internalState);
 			static int MethodProxy(lua_State* internalState);
 			static int SetterProxy(lua_State* internalState);
@@ -110,8 +127,8 @@ namespace Nz
 			static int StaticSetterProxy(lua_State* internalState);
 			static int ToStringProxy(lua_State* internalState);
 
-			std::map<String, ClassFunc> m_methods;
-			std::map<String, StaticFunc> m_staticMethods;
+			std::map<String, Method> m_methods;
+			std::map<String, Method> m_staticMethods;
 			std::shared_ptr<ClassInfo> m_info;
 	};
 }
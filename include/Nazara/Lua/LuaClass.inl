@@ -118,63 +118,47 @@ namespace Nz
 	template<class T>
 	void LuaClass<T>::BindMethod(const String& name, ClassFunc method)
 	{
-		m_methods[name] = method;
+		m_methods[name] = Method{&MethodProxy, std::make_shared<ClassFunc>(std::move(method))};
 	}
 
 	template<class T>
 	template<typename R, typename P, typename... Args, typename... DefArgs>
 	std::enable_if_t<std::is_base_of<P, T>::value> LuaClass<T>::BindMethod(const String& name, R(P::*func)(Args...), DefArgs&&... defArgs)
 	{
-		typename LuaImplMethodProxy<Args...>::template Impl<DefArgs...> handler(std::forward<DefArgs>(defArgs)...);
+		using Handler = typename LuaImplMethodProxy<Args...>::template Impl<DefArgs...>;
+		using Binding = MethodBinding<Handler, R(P::*)(Args...)>;
 
-		BindMethod(name, [func, handler] (LuaState& state, T& object, std::size_t /*argumentCount*/) -> int
-		{
-			handler.ProcessArguments(state);
-
-			return handler.Invoke(state, object, func);
-		});
+		m_methods[name] = Method{&BoundMethodProxy<Binding>, std::make_shared<Binding>(Binding{Handler(std::forward<DefArgs>(defArgs)...), func})};
 	}
 
 	template<class T>
 	template<typename R, typename P, typename... Args, typename... DefArgs>
 	std::enable_if_t<std::is_base_of<P, T>::value> LuaClass<T>::BindMethod(const String& name, R(P::*func)(Args...) const, DefArgs&&... defArgs)
 	{
-		typename LuaImplMethodProxy<Args...>::template Impl<DefArgs...> handler(std::forward<DefArgs>(defArgs)...);
-
-		BindMethod(name, [func, handler] (LuaState& state, T& object, std::size_t /*argumentCount*/) -> int
-		{
-			handler.ProcessArguments(state);
+		using Handler = typename LuaImplMethodProxy<Args...>::template Impl<DefArgs...>;
+		using Binding = MethodBinding<Handler, R(P::*)(Args...) const>;
 
-			return handler.Invoke(state, object, func);
-		});
+		m_methods[name] = Method{&BoundMethodProxy<Binding>, std::make_shared<Binding>(Binding{Handler(std::forward<DefArgs>(defArgs)...), func})};
 	}
 
 	template<class T>
 	template<typename R, typename P, typename... Args, typename... DefArgs>
 	std::enable_if_t<std::is_base_of<P, typename PointedType<T>::type>::value> LuaClass<T>::BindMethod(const String& name, R(P::*func)(Args...), DefArgs&&... defArgs)
 	{
-		typename LuaImplMethodProxy<Args...>::template Impl<DefArgs...> handler(std::forward<DefArgs>(defArgs)...);
-
-		BindMethod(name, [func, handler] (LuaState& state, T& object, std::size_t /*argumentCount*/) -> int
-		{
-			handler.ProcessArguments(state);
+		using Handler = typename LuaImplMethodProxy<Args...>::template Impl<DefArgs...>;
+		using Binding = MethodBinding<Handler, R(P::*)(Args...)>;
 
-			return handler.Invoke(state, object, func);
-		});
+		m_methods[name] = Method{&BoundMethodProxy<Binding>, std::make_shared<Binding>(Binding{Handler(std::forward<DefArgs>(defArgs)...), func})};
 	}
 
 	template<class T>
 	template<typename R, typename P, typename... Args, typename... DefArgs>
 	std::enable_if_t<std::is_base_of<P, typename PointedType<T>::type>::value> LuaClass<T>::BindMethod(const String& name, R(P::*func)(Args...) const, DefArgs&&... defArgs)
 	{
-		typename LuaImplMethodProxy<Args...>::template Impl<DefArgs...> handler(std::forward<DefArgs>(defArgs)...);
-
-		BindMethod(name, [func, handler] (LuaState& state, T& object, std::size_t /*argumentCount*/) -> int
-		{
-			handler.ProcessArguments(state);
+		using Handler = typename LuaImplMethodProxy<Args...>::template Impl<DefArgs...>;
+		using Binding = MethodBinding<Handler, R(P::*)(Args...) const>;
 
-			return handler.Invoke(state, object, func);
-		});
+		m_methods[name] = Method{&BoundMethodProxy<Binding>, std::make_shared<Binding>(Binding{Handler(std::forward<DefArgs>(defArgs)...), func})};
 	}
 
 	template<class T>
@@ -192,21 +176,17 @@ namespace Nz
 	template<class T>
 	void LuaClass<T>::BindStaticMethod(const String& name, StaticFunc method)
 	{
-		m_staticMethods[name] = method;
+		m_staticMethods[name] = Method{&StaticMethodProxy, std::make_shared<StaticFunc>(std::move(method))};
 	}
 
 	template<class T>
 	template<typename R, typename... Args, typename... DefArgs>
 	void LuaClass<T>::BindStaticMethod(const String& name, R(*func)(Args...), DefArgs&&... defArgs)
 	{
-		typename LuaImplFunctionProxy<Args...>::template Impl<DefArgs...> handler(std::forward<DefArgs>(defArgs)...);
+		using Handler = typename LuaImplFunctionProxy<Args...>::template Impl<DefArgs...>;
+		using Binding = MethodBinding<Handler, R(*)(Args...)>;
 
-		BindStaticMethod(name, [func, handler] (LuaState& state) -> int
-		{
-			handler.ProcessArguments(state);
-
-			return handler.Invoke(state, func);
-		});
+		m_staticMethods[name] = Method{&BoundStaticMethodProxy<Binding>, std::make_shared<Binding>(Binding{Handler(std::forward<DefArgs>(defArgs)...), func})};
 	}
 
 	template<class T>
@@ -313,13 +293,12 @@ namespace Nz
 		if (m_info->staticSetter)
 			SetupSetter(state, StaticSetterProxy, classInfoRef);
 
-		m_info->staticMethods.reserve(m_staticMethods.size());
+		m_info->staticMethods.reserve(m_info->staticMethods.size() + m_staticMethods.size());
 		for (auto& pair : m_staticMethods)
 		{
-			std::size_t methodIndex = m_info->staticMethods.size();
-			m_info->staticMethods.push_back(pair.second);
+			m_info->staticMethods.push_back(pair.second); //< Keeps the data alive as long as the class info
 
-			SetupMethod(state, StaticMethodProxy, pair.first, methodIndex, classInfoRef);
+			SetupMethod(state, pair.second.proxy, pair.first, pair.second.data.get(), classInfoRef);
 		}
 
 		state.SetMetatable(-2); // setmetatable(Class, ClassMeta), pops ClassMeta
@@ -355,24 +334,27 @@ namespace Nz
 			if (m_methods.find("__tostring") == m_methods.end())
 				SetupDefaultToString(state, classInfoRef);
 
-			m_info->methods.reserve(m_methods.size());
+			// Methods called on an instance of this class (and not of a child class) compare its metatable to this one, which is faster than looking up its name
+			const void* metatable = state.ToPointer(-1);
+
+			m_info->methods.reserve(m_info->methods.size() + m_methods.size());
 			for (auto& pair : m_methods)
 			{
-				std::size_t methodIndex = m_info->methods.size();
-				m_info->methods.push_back(pair.second);
+				m_info->methods.push_back(pair.second); //< Keeps the data alive as long as the class info
 
-				SetupMethod(state, MethodProxy, pair.first, methodIndex, classInfoRef);
+				SetupMethod(state, pair.second.proxy, pair.first, pair.second.data.get(), classInfoRef, metatable);
 			}
 		}
 		state.Pop(); //< Pops the metatable, it won't be collected before it's referenced by the Lua registry.
 	}
 
 	template<class T>
-	void LuaClass<T>::SetupMethod(LuaState& state, LuaCFunction proxy, const String& name, std::size_t methodIndex, int classInfoRef)
+	void LuaClass<T>::SetupMethod(LuaState& state, LuaCFunction proxy, const String& name, const void* data, int classInfoRef, const void* metatable)
 	{
 			state.PushReference(classInfoRef);
-			state.PushInteger(methodIndex);
-		state.PushCFunction(proxy, 2);
+			state.PushLightUserdata(const_cast<void*>(data));
+			state.PushLightUserdata(const_cast<void*>(metatable));
+		state.PushCFunction(proxy, 3);
 
 		state.SetField(name); // Method name
 	}
@@ -387,6 +369,34 @@ namespace Nz
 	}
 
 
+	template<class T>
+	template<typename Binding>
+	int LuaClass<T>::BoundMethodProxy(lua_State* internalState)
+	{
+		LuaState state = LuaInstance::GetState(internalState);
+
+		T* instance = GetMethodInstance(state);
+		if (!instance)
+			return 0; // Never executed, GetMethodInstance raised an error
+
+		const Binding& binding = *static_cast<const Binding*>(state.ToUserdata(state.GetIndexOfUpValue(2)));
+		binding.handler.ProcessArguments(state);
+
+		return binding.handler.Invoke(state, *instance, binding.func);
+	}
+
+	template<class T>
+	template<typename Binding>
+	int LuaClass<T>::BoundStaticMethodProxy(lua_State* internalState)
+	{
+		LuaState state = LuaInstance::GetState(internalState);
+
+		const Binding& binding = *static_cast<const Binding*>(state.ToUserdata(state.GetIndexOfUpValue(2)));
+		binding.handler.ProcessArguments(state);
+
+		return binding.handler.Invoke(state, binding.func);
+	}
+
 	template<class T>
 	int LuaClass<T>::ConstructorProxy(lua_State* internalState)
 	{
@@ -484,36 +494,54 @@ namespace Nz
 	}
 
 	template<class T>
-	int LuaClass<T>::MethodProxy(lua_State* internalState)
+	T* LuaClass<T>::GetMethodInstance(LuaState& state)
 	{
-		LuaState state = LuaInstance::GetState(internalState);
-
-		std::shared_ptr<ClassInfo>& info = *static_cast<std::shared_ptr<ClassInfo>*>(state.ToUserdata(state.GetIndexOfUpValue(1)));
-
 		T* instance = nullptr;
 		if (state.GetMetatable(1))
 		{
-			LuaType type = state.GetField("__name");
-			if (type == LuaType_String)
+			if (state.ToPointer(-1) == state.ToUserdata(state.GetIndexOfUpValue(3)))
 			{
-				String name = state.ToString(-1);
-				auto it = info->instanceGetters.find(name);
-				if (it != info->instanceGetters.end())
-					instance = it->second(state);
+				// The object is an instance of this class
+				instance = static_cast<T*>(state.ToUserdata(1));
+				state.Pop();
+			}
+			else
+			{
+				// It may be an instance of a child class, which knows how to convert itself
+				std::shared_ptr<ClassInfo>& info = *static_cast<std::shared_ptr<ClassInfo>*>(state.ToUserdata(state.GetIndexOfUpValue(1)));
+
+				LuaType type = state.GetField("__name");
+				if (type == LuaType_String)
+				{
+					std::size_t length;
+					const char* str = state.ToString(-1, &length);
+
+					auto it = info->instanceGetters.find(String(str, length));
+					if (it != info->instanceGetters.end())
+						instance = it->second(state);
+				}
+				state.Pop(2);
 			}
-			state.Pop(2);
 		}
 
 		if (!instance)
-		{
 			state.Error("Method cannot be called without an object");
-			return 0;
-		}
+
+		return instance;
+	}
+
+	template<class T>
+	int LuaClass<T>::MethodProxy(lua_State* internalState)
+	{
+		LuaState state = LuaInstance::GetState(internalState);
+
+		T* instance = GetMethodInstance(state);
+		if (!instance)
+			return 0; // Never executed, GetMethodInstance raised an error
 
 		std::size_t argCount = state.GetStackTop() - 1U;
 
-		unsigned int index = static_cast<unsigned int>(state.ToInteger(state.GetIndexOfUpValue(2)));
-		const ClassFunc& method = info->methods[index];
+		const ClassFunc& method = *static_cast<const ClassFunc*>(state.ToUserdata(state.GetIndexOfUpValue(2)));
 		return method(state, *instance, argCount);
 	}
 
@@ -562,10 +590,7 @@ namespace Nz
 	{
 		LuaState state = LuaInstance::GetState(internalState);
 
-		std::shared_ptr<ClassInfo>& info = *static_cast<std::shared_ptr<ClassInfo>*>(state.ToUserdata(state.GetIndexOfUpValue(1)));
-		unsigned int index = static_cast<unsigned int>(state.ToInteger(state.GetIndexOfUpValue(2)));
-		const StaticFunc& method = info->staticMethods[index];
-
+		const StaticFunc& method = *static_cast<const StaticFunc*>(state.ToUserdata(state.GetIndexOfUpValue(2)));
 		return method(state);
 	}
 
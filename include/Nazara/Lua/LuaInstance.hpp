@@ -12,6 +12,7 @@
 #include <Nazara/Lua/Enums.hpp>
 #include <Nazara/Lua/LuaState.hpp>
 #include <cstddef>
+#include <memory>
 
 namespace Nz
 {
@@ -21,31 +22,56 @@ namespace Nz
 		friend class LuaState;
 
 		public:
+			struct MemoryStatistics;
+
 			LuaInstance();
 			LuaInstance(const LuaInstance&) = delete;
 			LuaInstance(LuaInstance&& instance);
 			~LuaInstance();
 
+			void CollectGarbage();
+
+			void EnableAutomaticGarbageCollection(bool enable);
+
 			inline std::size_t GetMemoryLimit() const;
+			MemoryStatistics GetMemoryStatistics() const;
 			inline std::size_t GetMemoryUsage() const;
 			inline UInt32 GetTimeLimit() const;
 
+			bool IsAutomaticGarbageCollectionEnabled() const;
+
 			void LoadLibraries(LuaLibFlags libFlags = LuaLib_All);
 
+			void SetGarbageCollectorParameters(int pause, int stepMultiplier);
 			inline void SetMemoryLimit(std::size_t memoryLimit);
 			inline void SetTimeLimit(UInt32 limit);
 
+			bool StepGarbageCollection(UInt32 microseconds);
+
 			LuaInstance& operator=(const LuaInstance&) = delete;
 			LuaInstance& operator=(LuaInstance&& instance);
 
+			struct MemoryStatistics
+			{
+				std::size_t allocatedBlockCount;  //< Blocks currently allocated by Lua, pooled or not
+				std::size_t memoryUsage;          //< Bytes requested by Lua, as GetMemoryUsage
+				std::size_t peakMemoryUsage;      //< Highest memory usage since the creation of the instance
+				std::size_t pooledBlockCount;     //< Blocks currently allocated from the small object pool
+				std::size_t poolCapacity;         //< Bytes reserved by the small object pool
+			};
+
 		private:
+			struct SmallObjectPool;
+
 			inline void SetMemoryUsage(std::size_t memoryUsage);
 
 			static void* MemoryAllocator(void *ud, void *ptr, std::size_t osize, std::size_t nsize);
 			static void TimeLimiter(lua_State* internalState, lua_Debug* debug);
 
+			std::unique_ptr<SmallObjectPool> m_pool;
 			std::size_t m_memoryLimit;
 			std::size_t m_memoryUsage;
+			std::size_t m_peakMemoryUsage;
 			UInt32 m_timeLimit;
 			Clock m_clock;
 			unsigned int m_level;
@@ -34,6 +34,8 @@ namespace Nz
 	inline void LuaInstance::SetMemoryUsage(std::size_t memoryUsage)
 	{
 		m_memoryUsage = memoryUsage;
+		if (m_memoryUsage > m_peakMemoryUsage)
+			m_peakMemoryUsage = m_memoryUsage;
 	}
 }
 
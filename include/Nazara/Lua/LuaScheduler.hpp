@@ -0,0 +1,100 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Lua scripting module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_LUASCHEDULER_HPP
+#define NAZARA_LUASCHEDULER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Signal.hpp>
+#include <Nazara/Core/String.hpp>
+#include <Nazara/Lua/LuaInstance.hpp>
+#include <memory>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_LUA_API LuaScheduler
+	{
+		public:
+			using ScriptId = UInt64;
+
+			LuaScheduler(unsigned int instanceCount = 1);
+			LuaScheduler(const LuaScheduler&) = delete;
+			LuaScheduler(LuaScheduler&&) = delete;
+			~LuaScheduler();
+
+			inline LuaInstance& GetInstance(unsigned int instanceIndex);
+			inline unsigned int GetInstanceCount() const;
+			UInt32 GetInstructionBudget(ScriptId script) const;
+			inline std::size_t GetRunningScriptCount() const;
+			UInt32 GetTimeBudget(ScriptId script) const;
+
+			bool IsRunning(ScriptId script) const;
+
+			void Kill(ScriptId script);
+
+			void SetInstructionBudget(ScriptId script, UInt32 instructionCount);
+			void SetTimeBudget(ScriptId script, UInt32 microseconds);
+
+			ScriptId Spawn(const String& functionName);
+			ScriptId Spawn(const String& functionName, unsigned int instanceIndex);
+
+			void Update();
+
+			LuaScheduler& operator=(const LuaScheduler&) = delete;
+			LuaScheduler& operator=(LuaScheduler&&) = delete;
+
+			// Signals:
+			NazaraSignal(OnScriptError, LuaScheduler* /*scheduler*/, ScriptId /*script*/, const String& /*error*/);
+			NazaraSignal(OnScriptFinished, LuaScheduler* /*scheduler*/, ScriptId /*script*/);
+
+		private:
+			struct Script
+			{
+				String error;
+				UInt64 sliceStartTime;
+				UInt32 executedInstructions;
+				UInt32 generation = 0;
+				UInt32 hookPeriod;
+				UInt32 instructionBudget;
+				UInt32 timeBudget;
+				lua_State* thread;
+				int threadRef;
+				unsigned int instanceIndex;
+				bool running = false;
+			};
+
+			struct PooledThread
+			{
+				lua_State* thread;
+				int ref;
+			};
+
+			struct Worker
+			{
+				LuaInstance instance;
+				std::vector<PooledThread> freeThreads;
+				std::vector<UInt32> endedScripts;
+				std::vector<UInt32> runningScripts;
+			};
+
+			Script* GetScript(ScriptId script);
+			const Script* GetScript(ScriptId script) const;
+			void ReleaseThread(Worker& worker, Script& script);
+			void UpdateWorker(Worker& worker);
+
+			static void BudgetHook(lua_State* thread, lua_Debug* debug);
+
+			std::size_t m_runningScriptCount;
+			std::vector<std::unique_ptr<Worker>> m_workers;
+			std::vector<Script> m_scripts;
+			std::vector<UInt32> m_freeScripts;
+	};
+}
+
+#include <Nazara/Lua/LuaScheduler.inl>
+
+#endif // NAZARA_LUASCHEDULER_HPP
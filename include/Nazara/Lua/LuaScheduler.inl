@@ -0,0 +1,44 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Lua scripting module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Lua/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets one of the instances running the scripts
+	* \return Instance, in which the functions spawned on it must be defined
+	*
+	* \param instanceIndex Index of the instance
+	*
+	* \remark The instance must not be used while Update is running
+	*/
+	inline LuaInstance& LuaScheduler::GetInstance(unsigned int instanceIndex)
+	{
+		NazaraAssert(instanceIndex < m_workers.size(), "Instance index out of range");
+
+		return m_workers[instanceIndex]->instance;
+	}
+
+	/*!
+	* \brief Gets the number of instances running the scripts
+	* \return Number of instances, each one being updated by a single thread at once
+	*/
+	inline unsigned int LuaScheduler::GetInstanceCount() const
+	{
+		return static_cast<unsigned int>(m_workers.size());
+	}
+
+	/*!
+	* \brief Gets the number of scripts which have not ended yet
+	* \return Number of running scripts, of every instance
+	*/
+	inline std::size_t LuaScheduler::GetRunningScriptCount() const
+	{
+		return m_runningScriptCount;
+	}
+}
+
+#include <Nazara/Lua/DebugOff.hpp>
@@ -9,6 +9,11 @@
 #include <cstdlib>
 #include <cstring>
 #include <type_traits>
+
+#if defined(NAZARA_SIMD_SSE2)
+#include <emmintrin.h>
+#endif
+
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
@@ -29,6 +34,41 @@ namespace Nz
 				 0,  1, 28,  2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17,  4, 8,
 				31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18,  6, 11,  5, 10, 9
 			};
+
+			static const unsigned int MultiplyDeBruijnBitPosition64[64] =
+			{
+				 0,  1, 48,  2, 57, 49, 28,  3, 61, 58, 50, 42, 38, 29, 17,  4,
+				62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12,  5,
+				63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11,
+				46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19,  9, 13,  8,  7,  6
+			};
+		}
+
+		template<typename T>
+		typename std::enable_if<sizeof(T) <= sizeof(UInt32), std::size_t>::type CountBits(T value)
+		{
+			// https://graphics.stanford.edu/~seander/bithacks.html#CountBitsSetParallel
+			UInt32 v = static_cast<UInt32>(static_cast<std::make_unsigned_t<T>>(value));
+			v = v - ((v >> 1) & 0x55555555U);
+			v = (v & 0x33333333U) + ((v >> 2) & 0x33333333U);
+			v = (v + (v >> 4)) & 0x0F0F0F0FU;
+
+			return static_cast<std::size_t>((v * 0x01010101U) >> 24);
+		}
+
+		template<typename T>
+		// The parentheses are needed for GCC
+		typename std::enable_if<(sizeof(T) > sizeof(UInt32)), std::size_t>::type CountBits(T value)
+		{
+			static_assert(sizeof(T) == sizeof(UInt64), "Assertion failed");
+
+			// https://graphics.stanford.edu/~seander/bithacks.html#CountBitsSetParallel
+			UInt64 v = static_cast<UInt64>(value);
+			v = v - ((v >> 1) & 0x5555555555555555ULL);
+			v = (v & 0x3333333333333333ULL) + ((v >> 2) & 0x3333333333333333ULL);
+			v = (v + (v >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+
+			return static_cast<std::size_t>((v * 0x0101010101010101ULL) >> 56);
 		}
 
 		template<typename T>
@@ -75,9 +115,16 @@ namespace Nz
 			return MultiplyDeBruijnBitPosition2[static_cast<UInt32>(number * 0x077CB531U) >> 27];
 		}
 
+		template<typename T>
+		typename std::enable_if<sizeof(T) == sizeof(UInt64), unsigned int>::type IntegralLog2Pot(T number)
+		{
+			// Same as the 32 bits version, without splitting the number (which is often used to find bits in 64 bits blocks)
+			return MultiplyDeBruijnBitPosition64[static_cast<UInt64>(number * 0x03F79D71B4CB0A89ULL) >> 58];
+		}
+
 		template<typename T>
 		// The parentheses are needed for GCC
-		typename std::enable_if<(sizeof(T) > sizeof(UInt32)), unsigned int>::type IntegralLog2Pot(T number)
+		typename std::enable_if<(sizeof(T) > sizeof(UInt64)), unsigned int>::type IntegralLog2Pot(T number)
 		{
 			static_assert(sizeof(T) % sizeof(UInt32) == 0, "Assertion failed");
 
@@ -121,6 +168,20 @@ namespace Nz
 			using UnsignedT = std::make_unsigned_t<T>;
 			return static_cast<UnsignedT>(a) - static_cast<UnsignedT>(b) <= static_cast<UnsignedT>(maxDifference);
 		}
+
+		// Cody-Waite reduction (pi/2 split in three parts) and minimax polynomials on [-pi/4, pi/4] (from Cephes)
+		constexpr float SinCosTwoOverPi = 0.636619772367581343f;
+		constexpr float SinCosPiOver2A = 1.5703125f;
+		constexpr float SinCosPiOver2B = 4.837512969970703125e-4f;
+		constexpr float SinCosPiOver2C = 7.54978995489188216e-8f;
+
+		constexpr float SinCoefficient1 = -1.6666654611e-1f;
+		constexpr float SinCoefficient2 = 8.3321608736e-3f;
+		constexpr float SinCoefficient3 = -1.9515295891e-4f;
+
+		constexpr float CosCoefficient1 = 4.166664568298827e-2f;
+		constexpr float CosCoefficient2 = -1.388731625493765e-3f;
+		constexpr float CosCoefficient3 = 2.443315711809948e-5f;
 	}
 
 	/*!
@@ -173,15 +234,7 @@ namespace Nz
 	//TODO: Mark as constexpr when supported by all major compilers
 	/*constexpr*/ inline std::size_t CountBits(T value)
 	{
-		// https://graphics.stanford.edu/~seander/bithacks.html#CountBitsSetKernighan
-		std::size_t count = 0;
-		while (value)
-		{
-			value &= value - 1;
-			count++;
-		}
-
-		return count;
+		return Detail::CountBits<T>(value);
 	}
 
 	/*!
@@ -198,6 +251,109 @@ namespace Nz
 		return degrees * T(M_PI/180.0);
 	}
 
+	/*!
+	* \ingroup math
+	* \brief Computes an approximation of both the sine and the cosine of an angle
+	*
+	* \param radians Angle in radians
+	* \param sine Output sine of the angle
+	* \param cosine Output cosine of the angle
+	*
+	* \remark The absolute error stays around 1e-7 for angles up to a few thousand radians, accuracy decreases beyond
+	*/
+
+	inline void FastSinCos(float radians, float* sine, float* cosine)
+	{
+		NazaraAssert(sine, "Invalid sine pointer");
+		NazaraAssert(cosine, "Invalid cosine pointer");
+
+		// Reduces the angle to [-pi/4, pi/4] and keeps the quadrant
+		float q = radians * Detail::SinCosTwoOverPi;
+		int quadrant = static_cast<int>((q >= 0.f) ? q + 0.5f : q - 0.5f);
+		q = static_cast<float>(quadrant);
+
+		float r = ((radians - q * Detail::SinCosPiOver2A) - q * Detail::SinCosPiOver2B) - q * Detail::SinCosPiOver2C;
+		float r2 = r * r;
+
+		float s = r + r * r2 * (Detail::SinCoefficient1 + r2 * (Detail::SinCoefficient2 + r2 * Detail::SinCoefficient3));
+		float c = 1.f - 0.5f * r2 + r2 * r2 * (Detail::CosCoefficient1 + r2 * (Detail::CosCoefficient2 + r2 * Detail::CosCoefficient3));
+
+		if (quadrant & 1)
+			std::swap(s, c);
+
+		*sine = (quadrant & 2) ? -s : s;
+		*cosine = ((quadrant + 1) & 2) ? -c : c;
+	}
+
+	/*!
+	* \ingroup math
+	* \brief Computes an approximation of both the sine and the cosine of multiple angles
+	*
+	* \param radians Angles in radians
+	* \param count Number of angles
+	* \param sines Output sines of the angles, must be able to hold count floats
+	* \param cosines Output cosines of the angles, must be able to hold count floats
+	*
+	* \remark Angles are processed four at a time when SSE2 is enabled, using the same approximation than the single angle version
+	*/
+
+	inline void FastSinCos(const float* radians, std::size_t count, float* sines, float* cosines)
+	{
+		NazaraAssert(count == 0 || (radians && sines && cosines), "Invalid pointers");
+
+		std::size_t i = 0;
+
+		#if defined(NAZARA_SIMD_SSE2)
+		const __m128 twoOverPi = _mm_set1_ps(Detail::SinCosTwoOverPi);
+		const __m128 piOver2A = _mm_set1_ps(Detail::SinCosPiOver2A);
+		const __m128 piOver2B = _mm_set1_ps(Detail::SinCosPiOver2B);
+		const __m128 piOver2C = _mm_set1_ps(Detail::SinCosPiOver2C);
+		const __m128 half = _mm_set1_ps(0.5f);
+		const __m128 one = _mm_set1_ps(1.f);
+		const __m128 signMask = _mm_set1_ps(-0.f);
+		const __m128i oneInt = _mm_set1_epi32(1);
+		const __m128i twoInt = _mm_set1_epi32(2);
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 x = _mm_loadu_ps(&radians[i]);
+
+			// Same rounding (half away from zero) than the scalar version
+			__m128 q = _mm_mul_ps(x, twoOverPi);
+			q = _mm_add_ps(q, _mm_or_ps(half, _mm_and_ps(q, signMask)));
+			__m128i quadrant = _mm_cvttps_epi32(q);
+			q = _mm_cvtepi32_ps(quadrant);
+
+			__m128 r = _mm_sub_ps(x, _mm_mul_ps(q, piOver2A));
+			r = _mm_sub_ps(r, _mm_mul_ps(q, piOver2B));
+			r = _mm_sub_ps(r, _mm_mul_ps(q, piOver2C));
+			__m128 r2 = _mm_mul_ps(r, r);
+
+			__m128 s = _mm_add_ps(_mm_set1_ps(Detail::SinCoefficient2), _mm_mul_ps(r2, _mm_set1_ps(Detail::SinCoefficient3)));
+			s = _mm_add_ps(_mm_set1_ps(Detail::SinCoefficient1), _mm_mul_ps(r2, s));
+			s = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, r2), s));
+
+			__m128 c = _mm_add_ps(_mm_set1_ps(Detail::CosCoefficient2), _mm_mul_ps(r2, _mm_set1_ps(Detail::CosCoefficient3)));
+			c = _mm_add_ps(_mm_set1_ps(Detail::CosCoefficient1), _mm_mul_ps(r2, c));
+			c = _mm_add_ps(_mm_sub_ps(one, _mm_mul_ps(half, r2)), _mm_mul_ps(_mm_mul_ps(r2, r2), c));
+
+			// Odd quadrants swap sine and cosine, bit 1 of the quadrant gives the sign
+			__m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, oneInt), oneInt));
+			__m128 sinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, twoInt), 30));
+			__m128 cosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, oneInt), twoInt), 30));
+
+			__m128 sine = _mm_or_ps(_mm_and_ps(swap, c), _mm_andnot_ps(swap, s));
+			__m128 cosine = _mm_or_ps(_mm_and_ps(swap, s), _mm_andnot_ps(swap, c));
+
+			_mm_storeu_ps(&sines[i], _mm_xor_ps(sine, sinSign));
+			_mm_storeu_ps(&cosines[i], _mm_xor_ps(cosine, cosSign));
+		}
+		#endif
+
+		for (; i < count; ++i)
+			FastSinCos(radians[i], &sines[i], &cosines[i]);
+	}
+
 	/*!
 	* \ingroup math
 	* \brief Gets the unit from degree and convert it according to NAZARA_MATH_ANGLE_RADIAN
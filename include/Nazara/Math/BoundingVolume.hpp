@@ -63,6 +63,7 @@ namespace Nz
 			static BoundingVolume Infinite();
 			static BoundingVolume Lerp(const BoundingVolume& from, const BoundingVolume& to, T interpolation);
 			static BoundingVolume Null();
+			static void Update(const Box<T>* localBoxes, const Matrix4<T>* transformMatrices, std::size_t count, BoundingVolume* volumes);
 
 			Extend extend;
 			Box<T> aabb;
@@ -593,6 +593,90 @@ namespace Nz
 		return volume;
 	}
 
+	/*!
+	* \brief Computes the bounding volumes of multiple local boxes, each transformed by its own matrix
+	*
+	* \param localBoxes Local boxes of the volumes
+	* \param transformMatrices Matrices to apply to the local boxes
+	* \param count Number of volumes to compute
+	* \param volumes Output finite bounding volumes, must be able to hold count volumes
+	*
+	* \remark The float version processes the corners of a box with SIMD instructions when enabled, oriented boxes are the same than with Update while aabb lengths may differ by rounding
+	*
+	* \see Update
+	*/
+
+	template<typename T>
+	void BoundingVolume<T>::Update(const Box<T>* localBoxes, const Matrix4<T>* transformMatrices, std::size_t count, BoundingVolume* volumes)
+	{
+		NazaraAssert(count == 0 || (localBoxes && transformMatrices && volumes), "Invalid pointers");
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			BoundingVolume& volume = volumes[i];
+			volume.extend = Extend_Finite;
+			volume.obb.localBox = localBoxes[i];
+			volume.Update(transformMatrices[i]);
+		}
+	}
+
+	#if defined(NAZARA_SIMD_SSE2) || defined(NAZARA_SIMD_NEON)
+	template<>
+	inline void BoundingVolume<float>::Update(const Box<float>* localBoxes, const Matrix4<float>* transformMatrices, std::size_t count, BoundingVolume* volumes)
+	{
+		NazaraAssert(count == 0 || (localBoxes && transformMatrices && volumes), "Invalid pointers");
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			const Box<float>& localBox = localBoxes[i];
+			BoundingVolume& volume = volumes[i];
+			volume.extend = Extend_Finite;
+			volume.obb.localBox = localBox;
+
+			Detail::Matrix4Row rows[4];
+			Detail::Matrix4LoadRows(&transformMatrices[i].m11, rows);
+
+			// Corners are transformed as Matrix4::Transform does, in BoxCorner order
+			float minX = localBox.x;
+			float minY = localBox.y;
+			float minZ = localBox.z;
+			float maxX = localBox.x + localBox.width;
+			float maxY = localBox.y + localBox.height;
+			float maxZ = localBox.z + localBox.depth;
+
+			Detail::Matrix4Row corners[BoxCorner_Max + 1];
+			corners[BoxCorner_FarLeftBottom]   = Detail::Matrix4RowAdd(Detail::Matrix4Combine(minX, minY, minZ, rows), rows[3]);
+			corners[BoxCorner_FarLeftTop]      = Detail::Matrix4RowAdd(Detail::Matrix4Combine(minX, maxY, minZ, rows), rows[3]);
+			corners[BoxCorner_FarRightBottom]  = Detail::Matrix4RowAdd(Detail::Matrix4Combine(maxX, minY, minZ, rows), rows[3]);
+			corners[BoxCorner_FarRightTop]     = Detail::Matrix4RowAdd(Detail::Matrix4Combine(maxX, maxY, minZ, rows), rows[3]);
+			corners[BoxCorner_NearLeftBottom]  = Detail::Matrix4RowAdd(Detail::Matrix4Combine(minX, minY, maxZ, rows), rows[3]);
+			corners[BoxCorner_NearLeftTop]     = Detail::Matrix4RowAdd(Detail::Matrix4Combine(minX, maxY, maxZ, rows), rows[3]);
+			corners[BoxCorner_NearRightBottom] = Detail::Matrix4RowAdd(Detail::Matrix4Combine(maxX, minY, maxZ, rows), rows[3]);
+			corners[BoxCorner_NearRightTop]    = Detail::Matrix4RowAdd(Detail::Matrix4Combine(maxX, maxY, maxZ, rows), rows[3]);
+
+			Detail::Matrix4Row minimum = corners[0];
+			Detail::Matrix4Row maximum = corners[0];
+
+			float corner[4];
+			for (unsigned int j = 0; j <= BoxCorner_Max; ++j)
+			{
+				minimum = Detail::Matrix4RowMin(minimum, corners[j]);
+				maximum = Detail::Matrix4RowMax(maximum, corners[j]);
+
+				Detail::Matrix4RowStore(corner, corners[j]);
+				volume.obb(j).Set(corner[0], corner[1], corner[2]);
+			}
+
+			float minimumValues[4];
+			float maximumValues[4];
+			Detail::Matrix4RowStore(minimumValues, minimum);
+			Detail::Matrix4RowStore(maximumValues, maximum);
+
+			volume.aabb.Set(minimumValues[0], minimumValues[1], minimumValues[2], maximumValues[0] - minimumValues[0], maximumValues[1] - minimumValues[1], maximumValues[2] - minimumValues[2]);
+		}
+	}
+	#endif
+
 	/*!
 	* \brief Serializes a BoundingVolume
 	* \return true if successfully serialized
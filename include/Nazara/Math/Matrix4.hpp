@@ -95,6 +95,8 @@ namespace Nz
 			Vector2<T> Transform(const Vector2<T>& vector, T z = 0.0, T w = 1.0) const;
 			Vector3<T> Transform(const Vector3<T>& vector, T w = 1.0) const;
 			Vector4<T> Transform(const Vector4<T>& vector) const;
+			void Transform(const Vector3<T>* vectors, std::size_t count, Vector3<T>* results, T w = 1.0) const;
+			void Transform(const Vector4<T>* vectors, std::size_t count, Vector4<T>* results) const;
 
 			Matrix4& Transpose();
 
@@ -119,7 +121,9 @@ namespace Nz
 			bool operator!=(const Matrix4& mat) const;
 
 			static Matrix4 Concatenate(const Matrix4& left, const Matrix4& right);
+			static void Concatenate(const Matrix4* left, const Matrix4* right, std::size_t count, Matrix4* results);
 			static Matrix4 ConcatenateAffine(const Matrix4& left, const Matrix4& right);
+			static void ConcatenateAffine(const Matrix4* left, const Matrix4* right, std::size_t count, Matrix4* results);
 			static Matrix4 Identity();
 			static Matrix4 LookAt(const Vector3<T>& eye, const Vector3<T>& target, const Vector3<T>& up = Vector3<T>::Up());
 			static Matrix4 Ortho(T left, T right, T top, T bottom, T zNear = -1.0, T zFar = 1.0);
@@ -15,6 +15,13 @@
 #include <cstring>
 #include <limits>
 #include <stdexcept>
+
+#if defined(NAZARA_SIMD_SSE2)
+#include <emmintrin.h>
+#elif defined(NAZARA_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
 #include <Nazara/Core/Debug.hpp>
 
 #define F(a) static_cast<T>(a)
@@ -1284,6 +1291,45 @@ namespace Nz
 		                  m14 * vector.x + m24 * vector.y + m34 * vector.z + m44 * vector.w);
 	}
 
+	/*!
+	* \brief Transforms an array of Vector3 and one component by the matrix
+	*
+	* \param vectors Vectors to transform
+	* \param count Number of vectors to transform
+	* \param results Output transformed vectors, must be able to hold count vectors (may be the same array as vectors)
+	* \param w W Component of the imaginary Vector4
+	*
+	* \remark The matrix rows are only loaded once for the whole array when a SIMD path is available for T
+	*/
+
+	template<typename T>
+	void Matrix4<T>::Transform(const Vector3<T>* vectors, std::size_t count, Vector3<T>* results, T w) const
+	{
+		NazaraAssert(count == 0 || (vectors && results), "Invalid pointers");
+
+		for (std::size_t i = 0; i < count; ++i)
+			results[i] = Transform(vectors[i], w);
+	}
+
+	/*!
+	* \brief Transforms an array of Vector4 by the matrix
+	*
+	* \param vectors Vectors to transform
+	* \param count Number of vectors to transform
+	* \param results Output transformed vectors, must be able to hold count vectors (may be the same array as vectors)
+	*
+	* \remark The matrix rows are only loaded once for the whole array when a SIMD path is available for T
+	*/
+
+	template<typename T>
+	void Matrix4<T>::Transform(const Vector4<T>* vectors, std::size_t count, Vector4<T>* results) const
+	{
+		NazaraAssert(count == 0 || (vectors && results), "Invalid pointers");
+
+		for (std::size_t i = 0; i < count; ++i)
+			results[i] = Transform(vectors[i]);
+	}
+
 	/*!
 	* \brief Transposes the matrix
 	* \return A reference to this matrix transposed
@@ -1528,6 +1574,29 @@ namespace Nz
 		return matrix;
 	}
 
+	/*!
+	* \brief Concatenates arrays of matrices two by two
+	*
+	* \param left Left-hand side matrices
+	* \param right Right-hand side matrices
+	* \param count Number of matrices in each array
+	* \param results Output matrices, results[i] receives left[i] * right[i] (may be the same array as left)
+	*
+	* \see Concatenate
+	*/
+
+	template<typename T>
+	void Matrix4<T>::Concatenate(const Matrix4* left, const Matrix4* right, std::size_t count, Matrix4* results)
+	{
+		NazaraAssert(count == 0 || (left && right && results), "Invalid pointers");
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			Matrix4 matrix(left[i]);
+			results[i] = matrix.Concatenate(right[i]);
+		}
+	}
+
 	/*!
 	* \brief Shorthand for the concatenation of two affine matrices
 	* \return A Matrix4 which is the product of two
@@ -1547,6 +1616,29 @@ namespace Nz
 		return matrix;
 	}
 
+	/*!
+	* \brief Concatenates arrays of affine matrices two by two
+	*
+	* \param left Left-hand side matrices
+	* \param right Right-hand side matrices
+	* \param count Number of matrices in each array
+	* \param results Output matrices, results[i] receives left[i] * right[i] (may be the same array as left)
+	*
+	* \see ConcatenateAffine
+	*/
+
+	template<typename T>
+	void Matrix4<T>::ConcatenateAffine(const Matrix4* left, const Matrix4* right, std::size_t count, Matrix4* results)
+	{
+		NazaraAssert(count == 0 || (left && right && results), "Invalid pointers");
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			Matrix4 matrix(left[i]);
+			results[i] = matrix.ConcatenateAffine(right[i]);
+		}
+	}
+
 	/*!
 	* \brief Shorthand for the identity matrix
 	* \return A Matrix4 which is the identity matrix
@@ -1797,6 +1889,179 @@ namespace Nz
 
 		return true;
 	}
+
+	#if defined(NAZARA_SIMD_SSE2) || defined(NAZARA_SIMD_NEON)
+	namespace Detail
+	{
+		// Four floats helpers: products and sums are kept separate (no fused multiply-add) and evaluated
+		// in the same order as the scalar code, so that the float specializations below give the same results
+		#if defined(NAZARA_SIMD_SSE2)
+		using Matrix4Row = __m128;
+
+		inline Matrix4Row Matrix4RowAdd(Matrix4Row a, Matrix4Row b) { return _mm_add_ps(a, b); }
+		inline Matrix4Row Matrix4RowLoad(const float* values) { return _mm_loadu_ps(values); }
+		inline Matrix4Row Matrix4RowMax(Matrix4Row a, Matrix4Row b) { return _mm_max_ps(a, b); }
+		inline Matrix4Row Matrix4RowMin(Matrix4Row a, Matrix4Row b) { return _mm_min_ps(a, b); }
+		inline Matrix4Row Matrix4RowMul(Matrix4Row a, Matrix4Row b) { return _mm_mul_ps(a, b); }
+		inline Matrix4Row Matrix4RowSplat(float value) { return _mm_set1_ps(value); }
+		inline void Matrix4RowStore(float* values, Matrix4Row row) { _mm_storeu_ps(values, row); }
+		#else
+		using Matrix4Row = float32x4_t;
+
+		inline Matrix4Row Matrix4RowAdd(Matrix4Row a, Matrix4Row b) { return vaddq_f32(a, b); }
+		inline Matrix4Row Matrix4RowLoad(const float* values) { return vld1q_f32(values); }
+		inline Matrix4Row Matrix4RowMax(Matrix4Row a, Matrix4Row b) { return vmaxq_f32(a, b); }
+		inline Matrix4Row Matrix4RowMin(Matrix4Row a, Matrix4Row b) { return vminq_f32(a, b); }
+		inline Matrix4Row Matrix4RowMul(Matrix4Row a, Matrix4Row b) { return vmulq_f32(a, b); }
+		inline Matrix4Row Matrix4RowSplat(float value) { return vdupq_n_f32(value); }
+		inline void Matrix4RowStore(float* values, Matrix4Row row) { vst1q_f32(values, row); }
+		#endif
+
+		// x*rows[0] + y*rows[1] + z*rows[2] (+ w*rows[3]), which is also how a row of a product is built
+		inline Matrix4Row Matrix4Combine(float x, float y, float z, const Matrix4Row* rows)
+		{
+			Matrix4Row result = Matrix4RowMul(Matrix4RowSplat(x), rows[0]);
+			result = Matrix4RowAdd(result, Matrix4RowMul(Matrix4RowSplat(y), rows[1]));
+			return Matrix4RowAdd(result, Matrix4RowMul(Matrix4RowSplat(z), rows[2]));
+		}
+
+		inline Matrix4Row Matrix4Combine(float x, float y, float z, float w, const Matrix4Row* rows)
+		{
+			return Matrix4RowAdd(Matrix4Combine(x, y, z, rows), Matrix4RowMul(Matrix4RowSplat(w), rows[3]));
+		}
+
+		inline void Matrix4LoadRows(const float* values, Matrix4Row* rows)
+		{
+			for (unsigned int i = 0; i < 4; ++i)
+				rows[i] = Matrix4RowLoad(&values[i*4]);
+		}
+	}
+
+	template<>
+	inline Matrix4<float>& Matrix4<float>::Concatenate(const Matrix4& matrix)
+	{
+		#if NAZARA_MATH_MATRIX4_CHECK_AFFINE
+		if (IsAffine() && matrix.IsAffine())
+			return ConcatenateAffine(matrix);
+		#endif
+
+		// Right-hand side rows are loaded first, as matrix may be *this
+		Detail::Matrix4Row rows[4];
+		Detail::Matrix4LoadRows(&matrix.m11, rows);
+
+		float* values = &m11;
+		for (unsigned int i = 0; i < 4; ++i)
+		{
+			float* row = &values[i*4];
+			Detail::Matrix4RowStore(row, Detail::Matrix4Combine(row[0], row[1], row[2], row[3], rows));
+		}
+
+		return *this;
+	}
+
+	template<>
+	inline Matrix4<float>& Matrix4<float>::ConcatenateAffine(const Matrix4& matrix)
+	{
+		#ifdef NAZARA_DEBUG
+		if (!IsAffine())
+		{
+			NazaraWarning("First matrix not affine");
+			return Concatenate(matrix);
+		}
+
+		if (!matrix.IsAffine())
+		{
+			NazaraWarning("Second matrix not affine");
+			return Concatenate(matrix);
+		}
+		#endif
+
+		Detail::Matrix4Row rows[4];
+		Detail::Matrix4LoadRows(&matrix.m11, rows);
+
+		float* values = &m11;
+		for (unsigned int i = 0; i < 3; ++i)
+		{
+			float* row = &values[i*4];
+			Detail::Matrix4RowStore(row, Detail::Matrix4Combine(row[0], row[1], row[2], rows));
+		}
+
+		Detail::Matrix4RowStore(&m41, Detail::Matrix4RowAdd(Detail::Matrix4Combine(m41, m42, m43, rows), rows[3]));
+
+		// Last column is exactly (0, 0, 0, 1), as with the scalar version
+		m14 = 0.f;
+		m24 = 0.f;
+		m34 = 0.f;
+		m44 = 1.f;
+
+		return *this;
+	}
+
+	template<>
+	inline Vector3<float> Matrix4<float>::Transform(const Vector3<float>& vector, float w) const
+	{
+		Detail::Matrix4Row rows[4];
+		Detail::Matrix4LoadRows(&m11, rows);
+
+		float result[4];
+		Detail::Matrix4RowStore(result, Detail::Matrix4Combine(vector.x, vector.y, vector.z, w, rows));
+
+		return Vector3<float>(result[0], result[1], result[2]);
+	}
+
+	template<>
+	inline Vector4<float> Matrix4<float>::Transform(const Vector4<float>& vector) const
+	{
+		Detail::Matrix4Row rows[4];
+		Detail::Matrix4LoadRows(&m11, rows);
+
+		float result[4];
+		Detail::Matrix4RowStore(result, Detail::Matrix4Combine(vector.x, vector.y, vector.z, vector.w, rows));
+
+		return Vector4<float>(result[0], result[1], result[2], result[3]);
+	}
+
+	template<>
+	inline void Matrix4<float>::Transform(const Vector3<float>* vectors, std::size_t count, Vector3<float>* results, float w) const
+	{
+		NazaraAssert(count == 0 || (vectors && results), "Invalid pointers");
+
+		Detail::Matrix4Row rows[4];
+		Detail::Matrix4LoadRows(&m11, rows);
+
+		// Translation part is the same for every vector
+		rows[3] = Detail::Matrix4RowMul(Detail::Matrix4RowSplat(w), rows[3]);
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			const Vector3<float>& vector = vectors[i];
+
+			float result[4];
+			Detail::Matrix4RowStore(result, Detail::Matrix4RowAdd(Detail::Matrix4Combine(vector.x, vector.y, vector.z, rows), rows[3]));
+
+			results[i].Set(result[0], result[1], result[2]);
+		}
+	}
+
+	template<>
+	inline void Matrix4<float>::Transform(const Vector4<float>* vectors, std::size_t count, Vector4<float>* results) const
+	{
+		NazaraAssert(count == 0 || (vectors && results), "Invalid pointers");
+
+		Detail::Matrix4Row rows[4];
+		Detail::Matrix4LoadRows(&m11, rows);
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			const Vector4<float>& vector = vectors[i];
+
+			float result[4];
+			Detail::Matrix4RowStore(result, Detail::Matrix4Combine(vector.x, vector.y, vector.z, vector.w, rows));
+
+			results[i].Set(result[0], result[1], result[2], result[3]);
+		}
+	}
+	#endif
 }
 
 /*!
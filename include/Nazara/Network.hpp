@@ -34,16 +34,25 @@
 #include <Nazara/Network/Config.hpp>
 #include <Nazara/Network/ENetCompressor.hpp>
 #include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/ENetLz4Compressor.hpp>
 #include <Nazara/Network/ENetPacket.hpp>
 #include <Nazara/Network/ENetPeer.hpp>
 #include <Nazara/Network/ENetProtocol.hpp>
+#include <Nazara/Network/ENetShardedHost.hpp>
 #include <Nazara/Network/Enums.hpp>
+#include <Nazara/Network/HostnameResolver.hpp>
 #include <Nazara/Network/IpAddress.hpp>
 #include <Nazara/Network/NetBuffer.hpp>
+#include <Nazara/Network/NetDatagram.hpp>
 #include <Nazara/Network/NetPacket.hpp>
 #include <Nazara/Network/Network.hpp>
 #include <Nazara/Network/RUdpConnection.hpp>
 #include <Nazara/Network/RUdpMessage.hpp>
+#include <Nazara/Network/Snapshot.hpp>
+#include <Nazara/Network/SnapshotDecoder.hpp>
+#include <Nazara/Network/SnapshotEncoder.hpp>
+#include <Nazara/Network/SnapshotSchema.hpp>
+#include <Nazara/Network/SocketCompletionQueue.hpp>
 #include <Nazara/Network/SocketHandle.hpp>
 #include <Nazara/Network/SocketPoller.hpp>
 #include <Nazara/Network/TcpClient.hpp>
@@ -4,5 +4,7 @@
 
 #include <Nazara/Network/Config.hpp>
 #if NAZARA_NETWORK_MANAGE_MEMORY
+	#undef NAZARA_MEMORY_TAG
+	#define NAZARA_MEMORY_TAG Nz::MemoryTag_Network
 	#include <Nazara/Core/Debug/NewRedefinition.hpp>
 #endif
@@ -20,15 +20,21 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/Bitset.hpp>
 #include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/ConcurrentMemoryPool.hpp>
 #include <Nazara/Core/MemoryPool.hpp>
 #include <Nazara/Network/ENetCompressor.hpp>
 #include <Nazara/Network/ENetPeer.hpp>
 #include <Nazara/Network/ENetProtocol.hpp>
+#include <Nazara/Network/HostnameResolver.hpp>
 #include <Nazara/Network/IpAddress.hpp>
 #include <Nazara/Network/NetBuffer.hpp>
+#include <Nazara/Network/NetDatagram.hpp>
 #include <Nazara/Network/NetPacket.hpp>
 #include <Nazara/Network/SocketPoller.hpp>
 #include <Nazara/Network/UdpSocket.hpp>
+#include <array>
+#include <functional>
+#include <memory>
 #include <random>
 
 namespace Nz
@@ -36,20 +42,27 @@ namespace Nz
 	class NAZARA_NETWORK_API ENetHost
 	{
 		friend ENetPeer;
+		friend class ENetShardedHost;
 		friend class Network;
 
 		public:
+			using ConnectCallback = std::function<void(ENetPeer* peer, ResolveError error)>;
+
 			inline ENetHost();
 			ENetHost(const ENetHost&) = delete;
 			ENetHost(ENetHost&&) = default;
 			inline ~ENetHost();
 
+			inline ENetPacketRef AllocatePacket(ENetPacketFlags flags, NetPacket&& data);
+
 			void Broadcast(UInt8 channelId, ENetPacketFlags flags, NetPacket&& packet);
+			void Broadcast(UInt8 channelId, const ENetPacketRef& packet);
 
 			bool CheckEvents(ENetEvent* event);
 
 			ENetPeer* Connect(const IpAddress& remoteAddress, std::size_t channelCount = 0, UInt32 data = 0);
 			ENetPeer* Connect(const String& hostName, NetProtocol protocol = NetProtocol_Any, const String& service = "http", ResolveError* error = nullptr, std::size_t channelCount = 0, UInt32 data = 0);
+			void ConnectAsync(const String& hostName, ConnectCallback callback, NetProtocol protocol = NetProtocol_Any, const String& service = "http", std::size_t channelCount = 0, UInt32 data = 0);
 
 			inline bool Create(NetProtocol protocol, UInt16 port, std::size_t peerCount, std::size_t channelCount = 0);
 			bool Create(const IpAddress& listenAddress, std::size_t peerCount, std::size_t channelCount = 0);
@@ -72,11 +85,13 @@ namespace Nz
 
 		private:
 			ENetPacketRef AllocatePacket(ENetPacketFlags flags);
-			inline ENetPacketRef AllocatePacket(ENetPacketFlags flags, NetPacket&& data);
 
 			bool InitSocket(const IpAddress& address);
 
 			void AddToDispatchQueue(ENetPeer* peer);
+			void ConnectResolvedHosts();
+			bool FlushQueuedDatagrams();
+			void QueueDatagram(const IpAddress& to, const NetBuffer* buffers, std::size_t bufferCount);
 			void RemoveFromDispatchQueue(ENetPeer* peer);
 
 			bool DispatchIncomingCommands(ENetEvent* event);
@@ -99,9 +114,27 @@ namespace Nz
 			inline void UpdateServiceTime();
 
 			static std::size_t GetCommandSize(UInt8 commandNumber);
+			static IpAddress SelectAddress(const std::vector<HostnameInfo>& results);
 			static bool Initialize();
 			static void Uninitialize();
 
+			struct DatagramBatch
+			{
+				std::array<NetBuffer, ENetConstants::ENetHost_DatagramBatchSize> buffers;
+				std::array<NetDatagram, ENetConstants::ENetHost_DatagramBatchSize> datagrams;
+				std::size_t count = 0;
+				std::size_t index = 0;
+				std::unique_ptr<UInt8[]> data; //< ENetProtocol_MaximumMTU bytes per datagram
+			};
+
+			struct PendingConnection
+			{
+				std::shared_future<HostnameResolution> resolution;
+				std::size_t channelCount;
+				ConnectCallback callback;
+				UInt32 data;
+			};
+
 			struct PendingIncomingPacket
 			{
 				IpAddress from;
@@ -120,6 +153,8 @@ namespace Nz
 			std::array<NetBuffer, ENetConstants::ENetProtocol_MaximumPacketCommands * 2 + 1> m_buffers;
 			std::array<UInt8, ENetConstants::ENetProtocol_MaximumMTU> m_packetData[2];
 			std::bernoulli_distribution m_packetLossProbability;
+			DatagramBatch m_queuedDatagrams;
+			DatagramBatch m_receivedDatagrams;
 			std::size_t m_bandwidthLimitedPeers;
 			std::size_t m_bufferCount;
 			std::size_t m_channelLimit;
@@ -131,8 +166,10 @@ namespace Nz
 			std::size_t m_peerCount;
 			std::size_t m_receivedDataLength;
 			std::uniform_int_distribution<UInt16> m_packetDelayDistribution;
+			std::unique_ptr<ConcurrentMemoryPool> m_commandPool; //< Command queue nodes of every peer, must outlive m_peers
 			std::unique_ptr<ENetCompressor> m_compressor;
 			std::vector<ENetPeer> m_peers;
+			std::vector<PendingConnection> m_pendingConnections;
 			std::vector<PendingIncomingPacket> m_pendingIncomingPackets;
 			std::vector<PendingOutgoingPacket> m_pendingOutgoingPackets;
 			UInt8* m_receivedData;
@@ -157,11 +194,16 @@ namespace Nz
 			bool m_allowsIncomingConnections;
 			bool m_continueSending;
 			bool m_isUsingDualStack;
+			bool m_isUsingPortReuse;
 			bool m_isSimulationEnabled;
 			bool m_recalculateBandwidthLimits;
 
 			static std::mt19937 s_randomGenerator;
 			static std::mt19937_64 s_randomGenerator64;
+			static UInt32 s_connectedPeersMetric;
+			static UInt32 s_receivedBytesMetric;
+			static UInt32 s_retransmittedCommandsMetric;
+			static UInt32 s_sentBytesMetric;
 	};
 }
 
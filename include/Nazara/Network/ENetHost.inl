@@ -2,6 +2,8 @@
 // This file is part of the "Nazara Engine - Network module"
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
+#include <algorithm>
+#include <cstddef>
 #include <utility>
 #include <Nazara/Network/Debug.hpp>
 
@@ -10,8 +12,14 @@ namespace Nz
 	inline ENetHost::ENetHost() :
 	m_packetPool(sizeof(ENetPacket)),
 	m_isUsingDualStack(false),
+	m_isUsingPortReuse(false),
 	m_isSimulationEnabled(false)
 	{
+		// A block holds one node of the peer command lists, the two links of a list node come before the command
+		constexpr std::size_t nodeSize = std::max(sizeof(ENetPeer::IncomingCommmand), sizeof(ENetPeer::OutgoingCommand)) + 2 * sizeof(void*);
+		constexpr std::size_t alignment = alignof(std::max_align_t);
+
+		m_commandPool = std::make_unique<ConcurrentMemoryPool>((nodeSize + alignment - 1) / alignment * alignment);
 	}
 
 	inline ENetHost::~ENetHost()
@@ -19,6 +27,25 @@ namespace Nz
 		Destroy();
 	}
 
+	/*!
+	* \brief Allocates a packet which can be sent to any number of peers of this host
+	* \return Reference to the packet
+	*
+	* \param flags Flags of the packet
+	* \param data Content of the packet
+	*
+	* The packet is reference counted: sending it with ENetPeer::Send to many peers queues the same data for all of them, without copying it.
+	*
+	* \remark The packet must not be modified after being sent, and must only be sent through peers of this host
+	*/
+	inline ENetPacketRef ENetHost::AllocatePacket(ENetPacketFlags flags, NetPacket&& data)
+	{
+		ENetPacketRef ref = AllocatePacket(flags);
+		ref->data = std::move(data);
+
+		return ref;
+	}
+
 	inline bool ENetHost::Create(NetProtocol protocol, UInt16 port, std::size_t peerCount, std::size_t channelCount)
 	{
 		NazaraAssert(protocol != NetProtocol_Unknown, "Invalid protocol");
@@ -50,6 +77,7 @@ namespace Nz
 	{
 		m_poller.Clear();
 		m_peers.clear();
+		m_pendingConnections.clear();
 		m_socket.Close();
 	}
 
@@ -68,14 +96,6 @@ namespace Nz
 		m_compressor = std::move(compressor);
 	}
 
-	inline ENetPacketRef ENetHost::AllocatePacket(ENetPacketFlags flags, NetPacket&& data)
-	{
-		ENetPacketRef ref = AllocatePacket(flags);
-		ref->data = std::move(data);
-
-		return ref;
-	}
-
 	inline void ENetHost::UpdateServiceTime()
 	{
 		// Compute service time as microseconds for extra precision
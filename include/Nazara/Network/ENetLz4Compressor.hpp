@@ -0,0 +1,45 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_ENETLZ4COMPRESSOR_HPP
+#define NAZARA_ENETLZ4COMPRESSOR_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/Lz4.hpp>
+#include <Nazara/Network/ENetCompressor.hpp>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_NETWORK_API ENetLz4Compressor : public ENetCompressor
+	{
+		public:
+			ENetLz4Compressor();
+			~ENetLz4Compressor() = default;
+
+			std::size_t Compress(const ENetPeer* peer, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize) override;
+			std::size_t Decompress(const ENetPeer* peer, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize) override;
+
+			inline const ByteArray& GetDictionary() const;
+
+			void SetDictionary(const void* dictionary, std::size_t dictionarySize);
+
+			static ByteArray TrainDictionary(const std::vector<ByteArray>& samples, std::size_t maxDictionarySize = 4096);
+
+			static constexpr std::size_t MaxDictionarySize = Lz4::MaxDictionarySize;
+
+		private:
+			ByteArray m_dictionary;
+			Lz4::HashTable m_dictionaryHashTable; //< Positions of the dictionary, copied before each compression
+			Lz4::HashTable m_hashTable;
+			std::vector<UInt8> m_buffer; //< Dictionary followed by the data to compress
+	};
+}
+
+#include <Nazara/Network/ENetLz4Compressor.inl>
+
+#endif // NAZARA_ENETLZ4COMPRESSOR_HPP
@@ -0,0 +1,19 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the dictionary used by the compressor
+	* \return Dictionary, empty if none was set
+	*/
+	inline const ByteArray& ENetLz4Compressor::GetDictionary() const
+	{
+		return m_dictionary;
+	}
+}
+
+#include <Nazara/Network/DebugOff.hpp>
@@ -19,6 +19,7 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/Bitset.hpp>
+#include <Nazara/Core/PoolAllocator.hpp>
 #include <Nazara/Network/ENetPacket.hpp>
 #include <Nazara/Network/ENetProtocol.hpp>
 #include <Nazara/Network/IpAddress.hpp>
@@ -37,7 +38,9 @@ namespace Nz
 		friend struct PacketRef;
 
 		public:
-			inline ENetPeer(ENetHost* host, UInt16 peerId);
+			struct CompressionStats;
+
+			ENetPeer(ENetHost* host, UInt16 peerId);
 			ENetPeer(const ENetPeer&) = delete;
 			ENetPeer(ENetPeer&&) = default;
 			~ENetPeer() = default;
@@ -47,6 +50,7 @@ namespace Nz
 			void DisconnectNow(UInt32 data);
 
 			inline const IpAddress& GetAddress() const;
+			inline const CompressionStats& GetCompressionStats() const;
 			inline UInt32 GetMtu() const;
 			inline UInt32 GetPacketThrottleAcceleration() const;
 			inline UInt32 GetPacketThrottleDeceleration() const;
@@ -75,6 +79,19 @@ namespace Nz
 			ENetPeer& operator=(const ENetPeer&) = delete;
 			ENetPeer& operator=(ENetPeer&&) = default;
 
+			struct CompressionStats
+			{
+				UInt64 compressedDatagramCount = 0;    //< Datagrams sent compressed
+				UInt64 compressionTime = 0;            //< Time spent compressing, in microseconds
+				UInt64 decompressedDatagramCount = 0;  //< Compressed datagrams received
+				UInt64 decompressionTime = 0;          //< Time spent decompressing, in microseconds
+				UInt64 incomingCompressedSize = 0;     //< Bytes received before decompression (headers excluded)
+				UInt64 incomingDecompressedSize = 0;   //< Bytes received after decompression (headers excluded)
+				UInt64 outgoingCompressedSize = 0;     //< Bytes sent after compression, raw size when compression didn't help (headers excluded)
+				UInt64 outgoingRawSize = 0;            //< Bytes given to the compressor (headers excluded)
+				UInt64 uncompressedDatagramCount = 0;  //< Datagrams the compressor couldn't make smaller
+			};
+
 		private:
 			void InitIncoming(std::size_t channelCount, const IpAddress& address, ENetProtocolConnect& incomingCommand);
 			void InitOutgoing(std::size_t channelCount, const IpAddress& address, UInt32 connectId, UInt32 windowSize);
@@ -83,6 +100,10 @@ namespace Nz
 			struct IncomingCommmand;
 			struct OutgoingCommand;
 
+			// Nodes come from the host command pool, queuing a command does not reach the general allocator
+			using IncomingCommandList = std::list<IncomingCommmand, PoolAllocator<IncomingCommmand>>;
+			using OutgoingCommandList = std::list<OutgoingCommand, PoolAllocator<OutgoingCommand>>;
+
 			inline void ChangeState(ENetPeerState state);
 
 			bool CheckTimeouts(ENetEvent* event);
@@ -129,7 +150,9 @@ namespace Nz
 
 			struct Channel
 			{
-				Channel()
+				Channel(ConcurrentMemoryPool& commandPool) :
+				incomingReliableCommands(PoolAllocator<IncomingCommmand>(commandPool)),
+				incomingUnreliableCommands(PoolAllocator<IncomingCommmand>(commandPool))
 				{
 					incomingReliableSequenceNumber = 0;
 					incomingUnreliableSequenceNumber = 0;
@@ -140,8 +163,8 @@ namespace Nz
 				}
 
 				std::array<UInt16, ENetPeer_ReliableWindows> reliableWindows;
-				std::list<IncomingCommmand>                  incomingReliableCommands;
-				std::list<IncomingCommmand>                  incomingUnreliableCommands;
+				IncomingCommandList                          incomingReliableCommands;
+				IncomingCommandList                          incomingUnreliableCommands;
 				UInt16                                       incomingReliableSequenceNumber;
 				UInt16                                       incomingUnreliableSequenceNumber;
 				UInt16                                       outgoingReliableSequenceNumber;
@@ -176,14 +199,15 @@ namespace Nz
 			static constexpr std::size_t unsequencedWindow = ENetPeer_ReliableWindowSize / 32;
 
 			ENetHost*                             m_host;
+			CompressionStats                      m_compressionStats;
 			IpAddress                             m_address; /**< Internet address of the peer */
 			std::array<UInt32, unsequencedWindow> m_unsequencedWindow;
 			std::bernoulli_distribution           m_packetLossProbability;
-			std::list<IncomingCommmand>           m_dispatchedCommands;
-			std::list<OutgoingCommand>            m_outgoingReliableCommands;
-			std::list<OutgoingCommand>            m_outgoingUnreliableCommands;
-			std::list<OutgoingCommand>            m_sentReliableCommands;
-			std::list<OutgoingCommand>            m_sentUnreliableCommands;
+			IncomingCommandList                   m_dispatchedCommands;
+			OutgoingCommandList                   m_outgoingReliableCommands;
+			OutgoingCommandList                   m_outgoingUnreliableCommands;
+			OutgoingCommandList                   m_sentReliableCommands;
+			OutgoingCommandList                   m_sentUnreliableCommands;
 			std::size_t                           m_totalWaitingData;
 			std::uniform_int_distribution<UInt16> m_packetDelayDistribution;
 			std::vector<Acknowledgement>          m_acknowledgements;
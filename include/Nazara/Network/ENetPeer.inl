@@ -6,20 +6,14 @@
 
 namespace Nz
 {
-	inline ENetPeer::ENetPeer(ENetHost* host, UInt16 peerId) :
-	m_host(host),
-	m_state(ENetPeerState::Disconnected),
-	m_incomingSessionID(0xFF),
-	m_outgoingSessionID(0xFF),
-	m_incomingPeerID(peerId),
-	m_isSimulationEnabled(false)
+	inline const IpAddress& ENetPeer::GetAddress() const
 	{
-		Reset();
+		return m_address;
 	}
 
-	inline const IpAddress& ENetPeer::GetAddress() const
+	inline const ENetPeer::CompressionStats& ENetPeer::GetCompressionStats() const
 	{
-		return m_address;
+		return m_compressionStats;
 	}
 
 	inline UInt32 ENetPeer::GetMtu() const
@@ -0,0 +1,96 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_ENETSHARDEDHOST_HPP
+#define NAZARA_ENETSHARDEDHOST_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/Thread.hpp>
+#include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/IpAddress.hpp>
+#include <Nazara/Network/NetPacket.hpp>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_NETWORK_API ENetShardedHost
+	{
+		public:
+			struct Event;
+
+			inline ENetShardedHost();
+			ENetShardedHost(const ENetShardedHost&) = delete;
+			ENetShardedHost(ENetShardedHost&&) = delete;
+			inline ~ENetShardedHost();
+
+			bool Create(const IpAddress& listenAddress, std::size_t shardCount, std::size_t peerCountPerShard, std::size_t channelCount = 0);
+			void Destroy();
+
+			void Disconnect(std::size_t shardIndex, UInt16 peerId, UInt32 data);
+
+			inline std::size_t GetShardCount() const;
+
+			bool PollEvent(Event* event);
+
+			void Send(std::size_t shardIndex, UInt16 peerId, UInt8 channelId, ENetPacketFlags flags, NetPacket&& packet);
+
+			ENetShardedHost& operator=(const ENetShardedHost&) = delete;
+			ENetShardedHost& operator=(ENetShardedHost&&) = delete;
+
+			struct Event
+			{
+				ENetEventType type;
+				IpAddress peerAddress;
+				NetPacket packet;
+				std::size_t shardIndex;
+				UInt8 channelId;
+				UInt16 peerId;
+				UInt32 data;
+			};
+
+		private:
+			enum class CommandType
+			{
+				Disconnect,
+				Send
+			};
+
+			struct Command
+			{
+				CommandType type;
+				ENetPacketFlags flags;
+				NetPacket packet;
+				UInt8 channelId;
+				UInt16 peerId;
+				UInt32 data;
+			};
+
+			struct Shard
+			{
+				ENetHost host;
+				Mutex commandMutex;
+				Thread thread;
+				std::vector<Command> commands;
+			};
+
+			void PushCommand(std::size_t shardIndex, Command&& command);
+			void RunShard(std::size_t shardIndex);
+
+			std::atomic_bool m_isRunning;
+			std::size_t m_polledEventIndex;
+			std::vector<Event> m_events;
+			std::vector<Event> m_polledEvents;
+			std::vector<std::unique_ptr<Shard>> m_shards;
+			Mutex m_eventMutex;
+	};
+}
+
+#include <Nazara/Network/ENetShardedHost.inl>
+
+#endif // NAZARA_ENETSHARDEDHOST_HPP
@@ -0,0 +1,37 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/ENetShardedHost.hpp>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Constructs an ENetShardedHost object, Create must be called before using it
+	*/
+	inline ENetShardedHost::ENetShardedHost() :
+	m_isRunning(false),
+	m_polledEventIndex(0)
+	{
+	}
+
+	/*!
+	* \brief Stops the shards threads and destroys their host
+	*/
+	inline ENetShardedHost::~ENetShardedHost()
+	{
+		Destroy();
+	}
+
+	/*!
+	* \brief Gets the number of shards (each one running on its own thread)
+	* \return Shard count
+	*/
+	inline std::size_t ENetShardedHost::GetShardCount() const
+	{
+		return m_shards.size();
+	}
+}
+
+#include <Nazara/Network/DebugOff.hpp>
@@ -69,6 +69,15 @@ namespace Nz
 		ResolveError_Max = ResolveError_Unknown
 	};
 
+	enum SnapshotFieldType
+	{
+		SnapshotFieldType_Bits,    //< Raw value written on a fixed number of bits (booleans, enumerations, ...)
+		SnapshotFieldType_Float,   //< Floating point value quantized on a fixed number of bits in a known range
+		SnapshotFieldType_Integer, //< Signed integer written as a variable-length difference from the baseline
+
+		SnapshotFieldType_Max = SnapshotFieldType_Integer
+	};
+
 	enum SocketError
 	{
 		SocketError_NoError,
@@ -78,6 +87,7 @@ namespace Nz
 		SocketError_ConnectionRefused,   //< The connection attempt was refused
 		SocketError_DatagramSize,        //< The datagram size is over the system limit
 		SocketError_Internal,            //< The error is coming from the engine
+		SocketError_Interrupted,         //< The operation was cancelled before completing
 		SocketError_Packet,              //< The packet encoding/decoding failed, probably because of corrupted data
 		SocketError_NetworkError,        //< The network system has failed (maybe network is down)
 		SocketError_NotInitialized,      //< Nazara network has not been initialized
@@ -107,6 +117,14 @@ namespace Nz
 
 	using SocketPollEventFlags = Flags<SocketPollEvent>;
 
+	enum SocketPollMode
+	{
+		SocketPollMode_EdgeTriggered,  //< A socket is reported once each time it becomes ready, until it is drained it won't be reported again
+		SocketPollMode_LevelTriggered, //< A socket is reported by every wait as long as it is ready
+
+		SocketPollMode_Max = SocketPollMode_LevelTriggered
+	};
+
 	enum SocketState
 	{
 		SocketState_Bound,        //< The socket is currently bound
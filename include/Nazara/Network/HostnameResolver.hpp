@@ -0,0 +1,51 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_HOSTNAMERESOLVER_HPP
+#define NAZARA_HOSTNAMERESOLVER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/String.hpp>
+#include <Nazara/Network/Config.hpp>
+#include <Nazara/Network/Enums.hpp>
+#include <Nazara/Network/IpAddress.hpp>
+#include <future>
+#include <vector>
+
+namespace Nz
+{
+	struct HostnameResolution
+	{
+		std::vector<HostnameInfo> results;
+		ResolveError error = ResolveError_NoError;
+	};
+
+	class NAZARA_NETWORK_API HostnameResolver
+	{
+		friend class Network;
+
+		public:
+			HostnameResolver() = delete;
+			~HostnameResolver() = delete;
+
+			static void ClearCache();
+
+			static UInt32 GetCacheDuration();
+
+			static std::shared_future<HostnameResolution> Resolve(NetProtocol protocol, const String& hostname, const String& service = "http");
+
+			static void SetCacheDuration(UInt32 duration);
+
+			static constexpr unsigned int ThreadCount = 2;
+
+		private:
+			static bool Initialize();
+			static void Uninitialize();
+			static void WorkerThread();
+	};
+}
+
+#endif // NAZARA_HOSTNAMERESOLVER_HPP
@@ -12,11 +12,13 @@
 #include <Nazara/Network/Config.hpp>
 #include <Nazara/Network/Enums.hpp>
 #include <array>
+#include <future>
 #include <iosfwd>
 
 namespace Nz
 {
 	struct HostnameInfo;
+	struct HostnameResolution;
 
 	class NAZARA_NETWORK_API IpAddress
 	{
@@ -57,6 +59,7 @@ namespace Nz
 
 			static String ResolveAddress(const IpAddress& address, String* service = nullptr, ResolveError* error = nullptr);
 			static std::vector<HostnameInfo> ResolveHostname(NetProtocol procol, const String& hostname, const String& protocol = "http", ResolveError* error = nullptr);
+			static std::shared_future<HostnameResolution> ResolveHostnameAsync(NetProtocol protocol, const String& hostname, const String& service = "http");
 
 			inline friend std::ostream& operator<<(std::ostream& out, const IpAddress& address);
 
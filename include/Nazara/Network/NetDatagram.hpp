@@ -0,0 +1,25 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETDATAGRAM_HPP
+#define NAZARA_NETDATAGRAM_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Network/IpAddress.hpp>
+#include <Nazara/Network/NetBuffer.hpp>
+
+namespace Nz
+{
+	struct NetDatagram
+	{
+		IpAddress address; //< Sender when receiving, recipient when sending
+		NetBuffer* buffers; //< Storage when receiving, data when sending
+		std::size_t bufferCount;
+		std::size_t dataLength; //< Received or sent byte count, filled by the socket
+	};
+}
+
+#endif // NAZARA_NETDATAGRAM_HPP
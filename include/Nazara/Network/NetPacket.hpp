@@ -10,7 +10,6 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/ByteStream.hpp>
 #include <Nazara/Core/MemoryStream.hpp>
-#include <Nazara/Core/Mutex.hpp>
 #include <Nazara/Network/Config.hpp>
 
 namespace Nz
@@ -20,6 +19,8 @@ namespace Nz
 		friend class Network;
 
 		public:
+			struct BufferPoolStats;
+
 			inline NetPacket();
 			inline NetPacket(UInt16 netCode, std::size_t minCapacity = 0);
 			inline NetPacket(UInt16 netCode, const void* ptr, std::size_t size);
@@ -48,9 +49,18 @@ namespace Nz
 
 			static bool DecodeHeader(const void* data, UInt16* packetSize, UInt16* netCode);
 			static bool EncodeHeader(void* data, UInt16 packetSize, UInt16 netCode);
+			static BufferPoolStats GetBufferPoolStats();
 
 			static constexpr std::size_t HeaderSize = sizeof(UInt16) + sizeof(UInt16); //< PacketSize + NetCode
 
+			struct BufferPoolStats
+			{
+				UInt64 heldBufferCount; //< Buffers kept by the pool (including threads caches)
+				UInt64 heldBytes;       //< Capacity of these buffers
+				UInt64 hitCount;        //< Packets which got a recycled buffer
+				UInt64 missCount;       //< Packets which had to allocate a buffer
+			};
+
 		private:
 			void OnEmptyStream() override;
 
@@ -64,8 +74,6 @@ namespace Nz
 			MemoryStream m_memoryStream;
 			UInt16 m_netCode;
 
-			static std::unique_ptr<Mutex> s_availableBuffersMutex;
-			static std::vector<std::pair<std::size_t, std::unique_ptr<ByteArray>>> s_availableBuffers;
 	};
 }
 
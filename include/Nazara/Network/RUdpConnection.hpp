@@ -11,6 +11,8 @@
 #include <Nazara/Core/Bitset.hpp>
 #include <Nazara/Core/Clock.hpp>
 #include <Nazara/Network/IpAddress.hpp>
+#include <Nazara/Network/NetBuffer.hpp>
+#include <Nazara/Network/NetDatagram.hpp>
 #include <Nazara/Network/NetPacket.hpp>
 #include <Nazara/Network/RUdpMessage.hpp>
 #include <Nazara/Network/UdpSocket.hpp>
@@ -27,6 +29,8 @@ namespace Nz
 		friend class Network;
 
 		public:
+			struct PeerStats;
+
 			using SequenceIndex = UInt16;
 
 			RUdpConnection();
@@ -43,6 +47,7 @@ namespace Nz
 			inline IpAddress GetBoundAddress() const;
 			inline UInt16 GetBoundPort() const;
 			inline SocketError GetLastError() const;
+			bool GetPeerStats(const IpAddress& peerIp, PeerStats* stats) const;
 
 			inline bool Listen(NetProtocol protocol, UInt16 port = 64266);
 			bool Listen(const IpAddress& address);
@@ -64,6 +69,20 @@ namespace Nz
 			static constexpr std::size_t MessageHeader = sizeof(UInt16) + 2 * sizeof(SequenceIndex) + sizeof(UInt32); //< Protocol ID (begin) + Sequence ID + Remote Sequence ID + Ack bitfield
 			static constexpr std::size_t MessageFooter = sizeof(UInt16); //< Protocol ID (end)
 
+			static constexpr std::size_t CongestionSegmentSize = 1200; //< Reference datagram size of the congestion window computations
+			static constexpr UInt32 TargetQueuingDelay = 25'000; //< Queuing delay (in microseconds) the congestion window converges to
+
+			struct PeerStats
+			{
+				std::size_t bytesInFlight;         //< Bytes sent but not yet acknowledged nor lost
+				std::size_t congestionWindow;      //< Bytes which may be in flight before non-immediate packets are held back
+				UInt32 minRoundTripTime;           //< Lowest round trip time measured (in microseconds), the base delay of the path
+				UInt32 roundTripTime;              //< Smoothed round trip time (in microseconds)
+				UInt32 roundTripTimeVariance;      //< Round trip time variation (in microseconds)
+				UInt64 lostPackets;                //< Packets which weren't acknowledged in time
+				UInt64 sentPackets;                //< Packets sent, including retransmissions
+			};
+
 			// Signals:
 			NazaraSignal(OnConnectedToPeer,  RUdpConnection* /*connection*/);
 			NazaraSignal(OnPeerAcknowledged, RUdpConnection* /*connection*/, const IpAddress& /*adress*/);
@@ -83,16 +102,20 @@ namespace Nz
 				PeerState_WillAck      //< Connected, received one or more packets and has no packets to send, waiting before sending an empty ack packet
 			};
 
+			bool CanSendPacket(PeerData& peer, PacketPriority priority, std::size_t size) const;
 			void DisconnectPeer(std::size_t peerIndex);
 			void EnqueuePacket(PeerData& peer, PacketPriority priority, PacketReliability reliability, const NetPacket& packet);
 			void EnqueuePacketInternal(PeerData& peer, PacketPriority priority, PacketReliability reliability, NetPacket&& data);
+			void FlushQueuedDatagrams();
 			bool InitSocket(NetProtocol protocol);
 			void ProcessAcks(PeerData& peer, SequenceIndex lastAck, UInt32 ackBits);
 			PeerData& RegisterPeer(const IpAddress& address, PeerState state);
 			void OnClientRequestingConnection(const IpAddress& address, SequenceIndex sequenceId, UInt64 token);
+			void OnPacketAcked(PeerData& peer, const PendingAckPacket& packet);
 			void OnPacketLost(PeerData& peer, PendingAckPacket&& packet);
 			void OnPacketReceived(const IpAddress& peerIp, NetPacket&& packet);
 			void SendPacket(PeerData& peer, PendingPacket&& packet);
+			void UpdatePacingCredit(PeerData& peer);
 
 			static inline unsigned int ComputeSequenceDifference(SequenceIndex sequence, SequenceIndex sequence2);
 			static inline bool HasPendingPackets(PeerData& peer);
@@ -131,9 +154,19 @@ namespace Nz
 				IpAddress address;
 				SequenceIndex localSequence;
 				SequenceIndex remoteSequence;
+				double pacingCredit; //< Bytes which may be sent before the pacing rate is exceeded
+				std::size_t bytesInFlight;
+				std::size_t congestionWindow;
+				std::size_t slowStartThreshold;
+				UInt32 minRoundTripTime;
 				UInt32 roundTripTime;
+				UInt32 roundTripTimeVariance;
+				UInt64 lastCongestionTime;
+				UInt64 lastPacingTime;
 				UInt64 lastPacketTime;
 				UInt64 lastPingTime;
+				UInt64 lostPackets;
+				UInt64 sentPackets;
 				UInt64 stateData1;
 			};
 
@@ -141,6 +174,8 @@ namespace Nz
 			std::queue<RUdpMessage> m_receivedMessages;
 			std::size_t m_peerIterator;
 			std::unordered_map<IpAddress, std::size_t> m_peerByIP;
+			std::vector<NetBuffer> m_queuedBuffers;
+			std::vector<NetDatagram> m_queuedDatagrams;
 			std::vector<PeerData> m_peers;
 			Bitset<UInt64> m_activeClients;
 			Clock m_clock;
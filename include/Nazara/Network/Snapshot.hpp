@@ -0,0 +1,64 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_SNAPSHOT_HPP
+#define NAZARA_SNAPSHOT_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Network/Config.hpp>
+#include <Nazara/Network/SnapshotSchema.hpp>
+#include <limits>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_NETWORK_API Snapshot
+	{
+		public:
+			inline Snapshot(const SnapshotSchema& schema);
+			Snapshot(const Snapshot&) = default;
+			Snapshot(Snapshot&&) noexcept = default;
+			~Snapshot() = default;
+
+			std::size_t AddEntity(UInt32 entityId);
+
+			inline void Clear();
+
+			std::size_t FindEntity(UInt32 entityId) const;
+
+			inline std::size_t GetEntityCount() const;
+			inline UInt32 GetEntityId(std::size_t entityIndex) const;
+			inline const Int64* GetEntityValues(std::size_t entityIndex) const;
+			inline Int64* GetEntityValues(std::size_t entityIndex);
+			float GetFloat(UInt32 entityId, std::size_t fieldIndex) const;
+			inline const SnapshotSchema& GetSchema() const;
+			Int64 GetValue(UInt32 entityId, std::size_t fieldIndex) const;
+
+			inline bool HasEntity(UInt32 entityId) const;
+
+			bool RemoveEntity(UInt32 entityId);
+
+			void SetFloat(UInt32 entityId, std::size_t fieldIndex, float value);
+			void SetValue(UInt32 entityId, std::size_t fieldIndex, Int64 value);
+
+			bool operator==(const Snapshot& snapshot) const;
+			inline bool operator!=(const Snapshot& snapshot) const;
+
+			Snapshot& operator=(const Snapshot&) = default;
+			Snapshot& operator=(Snapshot&&) noexcept = default;
+
+			static constexpr std::size_t InvalidIndex = std::numeric_limits<std::size_t>::max();
+
+		private:
+			const SnapshotSchema* m_schema;
+			std::vector<Int64> m_values; //< GetFieldCount() values per entity
+			std::vector<UInt32> m_entityIds; //< Sorted
+	};
+}
+
+#include <Nazara/Network/Snapshot.inl>
+
+#endif // NAZARA_SNAPSHOT_HPP
@@ -0,0 +1,110 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Error.hpp>
+#include <algorithm>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Constructs an empty snapshot
+	*
+	* \param schema Schema describing the fields of every entity, which must outlive the snapshot
+	*/
+	inline Snapshot::Snapshot(const SnapshotSchema& schema) :
+	m_schema(&schema)
+	{
+	}
+
+	/*!
+	* \brief Removes every entity from the snapshot
+	*/
+	inline void Snapshot::Clear()
+	{
+		m_entityIds.clear();
+		m_values.clear();
+	}
+
+	/*!
+	* \brief Gets the number of entities of the snapshot
+	* \return Entity count
+	*/
+	inline std::size_t Snapshot::GetEntityCount() const
+	{
+		return m_entityIds.size();
+	}
+
+	/*!
+	* \brief Gets the identifier of an entity
+	* \return Entity identifier
+	*
+	* \param entityIndex Index of the entity, entities are sorted by identifier
+	*/
+	inline UInt32 Snapshot::GetEntityId(std::size_t entityIndex) const
+	{
+		NazaraAssert(entityIndex < m_entityIds.size(), "Entity index out of range");
+
+		return m_entityIds[entityIndex];
+	}
+
+	/*!
+	* \brief Gets the values of an entity
+	* \return Pointer to the GetFieldCount() values of the entity, invalidated when an entity is added or removed
+	*
+	* \param entityIndex Index of the entity, entities are sorted by identifier
+	*/
+	inline const Int64* Snapshot::GetEntityValues(std::size_t entityIndex) const
+	{
+		NazaraAssert(entityIndex < m_entityIds.size(), "Entity index out of range");
+
+		return &m_values[entityIndex * m_schema->GetFieldCount()];
+	}
+
+	/*!
+	* \brief Gets the values of an entity
+	* \return Pointer to the GetFieldCount() values of the entity, invalidated when an entity is added or removed
+	*
+	* \param entityIndex Index of the entity, entities are sorted by identifier
+	*/
+	inline Int64* Snapshot::GetEntityValues(std::size_t entityIndex)
+	{
+		NazaraAssert(entityIndex < m_entityIds.size(), "Entity index out of range");
+
+		return &m_values[entityIndex * m_schema->GetFieldCount()];
+	}
+
+	/*!
+	* \brief Gets the schema of the snapshot
+	* \return Snapshot schema
+	*/
+	inline const SnapshotSchema& Snapshot::GetSchema() const
+	{
+		return *m_schema;
+	}
+
+	/*!
+	* \brief Checks whether the snapshot holds an entity
+	* \return true if the entity is part of the snapshot
+	*
+	* \param entityId Identifier of the entity
+	*/
+	inline bool Snapshot::HasEntity(UInt32 entityId) const
+	{
+		return std::binary_search(m_entityIds.begin(), m_entityIds.end(), entityId);
+	}
+
+	/*!
+	* \brief Checks whether two snapshots hold different entities or values
+	* \return true if they're different
+	*
+	* \param snapshot Other snapshot
+	*/
+	inline bool Snapshot::operator!=(const Snapshot& snapshot) const
+	{
+		return !operator==(snapshot);
+	}
+}
+
+#include <Nazara/Network/DebugOff.hpp>
@@ -0,0 +1,51 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_SNAPSHOTDECODER_HPP
+#define NAZARA_SNAPSHOTDECODER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Network/Config.hpp>
+#include <Nazara/Network/Snapshot.hpp>
+#include <vector>
+
+namespace Nz
+{
+	class ByteStream;
+
+	class NAZARA_NETWORK_API SnapshotDecoder
+	{
+		public:
+			SnapshotDecoder(const SnapshotSchema& schema, std::size_t historySize = 32);
+			SnapshotDecoder(const SnapshotDecoder&) = delete;
+			SnapshotDecoder(SnapshotDecoder&&) noexcept = default;
+			~SnapshotDecoder() = default;
+
+			bool Decode(ByteStream& stream, Snapshot* snapshot, UInt32* sequence = nullptr);
+
+			inline UInt32 GetLastSequence() const;
+
+			void Reset();
+
+			SnapshotDecoder& operator=(const SnapshotDecoder&) = delete;
+			SnapshotDecoder& operator=(SnapshotDecoder&&) noexcept = default;
+
+		private:
+			struct HistoryEntry
+			{
+				Snapshot snapshot;
+				UInt32 sequence;
+			};
+
+			std::vector<HistoryEntry> m_history;
+			Snapshot m_emptySnapshot;
+			UInt32 m_lastSequence;
+	};
+}
+
+#include <Nazara/Network/SnapshotDecoder.inl>
+
+#endif // NAZARA_SNAPSHOTDECODER_HPP
@@ -0,0 +1,23 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the most recent snapshot decoded
+	* \return Sequence number of the snapshot, zero if none was decoded
+	*
+	* This is the sequence number the remote encoder should be told about, so it can use this snapshot as a baseline.
+	*
+	* \see SnapshotEncoder::Acknowledge
+	*/
+	inline UInt32 SnapshotDecoder::GetLastSequence() const
+	{
+		return m_lastSequence;
+	}
+}
+
+#include <Nazara/Network/DebugOff.hpp>
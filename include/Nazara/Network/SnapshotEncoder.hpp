@@ -0,0 +1,58 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_SNAPSHOTENCODER_HPP
+#define NAZARA_SNAPSHOTENCODER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Network/Config.hpp>
+#include <Nazara/Network/Snapshot.hpp>
+#include <vector>
+
+namespace Nz
+{
+	class ByteStream;
+
+	class NAZARA_NETWORK_API SnapshotEncoder
+	{
+		public:
+			SnapshotEncoder(const SnapshotSchema& schema, std::size_t historySize = 32);
+			SnapshotEncoder(const SnapshotEncoder&) = delete;
+			SnapshotEncoder(SnapshotEncoder&&) noexcept = default;
+			~SnapshotEncoder() = default;
+
+			void Acknowledge(UInt32 sequence);
+
+			bool Encode(const Snapshot& snapshot, ByteStream& stream, UInt32* sequence = nullptr);
+
+			inline UInt32 GetAcknowledgedSequence() const;
+			UInt32 GetBaselineSequence() const;
+			inline UInt32 GetNextSequence() const;
+
+			void Reset();
+
+			SnapshotEncoder& operator=(const SnapshotEncoder&) = delete;
+			SnapshotEncoder& operator=(SnapshotEncoder&&) noexcept = default;
+
+		private:
+			struct HistoryEntry
+			{
+				Snapshot snapshot;
+				UInt32 sequence;
+			};
+
+			std::vector<HistoryEntry> m_history;
+			std::vector<std::size_t> m_changedEntities;
+			std::vector<UInt32> m_removedEntities;
+			Snapshot m_emptySnapshot;
+			UInt32 m_acknowledgedSequence;
+			UInt32 m_nextSequence;
+	};
+}
+
+#include <Nazara/Network/SnapshotEncoder.inl>
+
+#endif // NAZARA_SNAPSHOTENCODER_HPP
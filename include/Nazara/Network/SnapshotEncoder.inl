@@ -0,0 +1,28 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the most recent snapshot acknowledged by the remote decoder
+	* \return Sequence number of the snapshot, zero if none was acknowledged
+	*/
+	inline UInt32 SnapshotEncoder::GetAcknowledgedSequence() const
+	{
+		return m_acknowledgedSequence;
+	}
+
+	/*!
+	* \brief Gets the sequence number the next encoded snapshot will get
+	* \return Sequence number
+	*/
+	inline UInt32 SnapshotEncoder::GetNextSequence() const
+	{
+		return m_nextSequence;
+	}
+}
+
+#include <Nazara/Network/DebugOff.hpp>
@@ -0,0 +1,64 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_SNAPSHOTSCHEMA_HPP
+#define NAZARA_SNAPSHOTSCHEMA_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Network/Config.hpp>
+#include <Nazara/Network/Enums.hpp>
+#include <vector>
+
+namespace Nz
+{
+	class ByteStream;
+
+	class NAZARA_NETWORK_API SnapshotSchema
+	{
+		public:
+			struct Field;
+
+			SnapshotSchema() = default;
+			SnapshotSchema(const SnapshotSchema&) = default;
+			SnapshotSchema(SnapshotSchema&&) noexcept = default;
+			~SnapshotSchema() = default;
+
+			std::size_t AddBits(UInt8 bitCount);
+			std::size_t AddFloat(float minValue, float maxValue, UInt8 bitCount);
+			std::size_t AddInteger();
+
+			float DequantizeFloat(std::size_t fieldIndex, Int64 value) const;
+
+			inline const Field& GetField(std::size_t fieldIndex) const;
+			inline std::size_t GetFieldCount() const;
+
+			Int64 QuantizeFloat(std::size_t fieldIndex, float value) const;
+
+			bool ReadField(ByteStream& stream, std::size_t fieldIndex, Int64 baseline, Int64* value) const;
+			bool WriteField(ByteStream& stream, std::size_t fieldIndex, Int64 baseline, Int64 value) const;
+
+			SnapshotSchema& operator=(const SnapshotSchema&) = default;
+			SnapshotSchema& operator=(SnapshotSchema&&) noexcept = default;
+
+			static bool ReadVarInt(ByteStream& stream, UInt64* value);
+			static bool WriteVarInt(ByteStream& stream, UInt64 value);
+
+			struct Field
+			{
+				SnapshotFieldType type;
+				UInt8 bitCount;
+				float minValue;
+				float maxValue;
+			};
+
+		private:
+			std::vector<Field> m_fields;
+	};
+}
+
+#include <Nazara/Network/SnapshotSchema.inl>
+
+#endif // NAZARA_SNAPSHOTSCHEMA_HPP
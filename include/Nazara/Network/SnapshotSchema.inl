@@ -0,0 +1,33 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the description of a field
+	* \return Field description
+	*
+	* \param fieldIndex Index of the field, as returned when it was added
+	*/
+	inline const SnapshotSchema::Field& SnapshotSchema::GetField(std::size_t fieldIndex) const
+	{
+		NazaraAssert(fieldIndex < m_fields.size(), "Field index out of range");
+
+		return m_fields[fieldIndex];
+	}
+
+	/*!
+	* \brief Gets the number of fields every entity of a snapshot holds
+	* \return Field count
+	*/
+	inline std::size_t SnapshotSchema::GetFieldCount() const
+	{
+		return m_fields.size();
+	}
+}
+
+#include <Nazara/Network/DebugOff.hpp>
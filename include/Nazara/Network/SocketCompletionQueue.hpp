@@ -0,0 +1,54 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_SOCKETCOMPLETIONQUEUE_HPP
+#define NAZARA_SOCKETCOMPLETIONQUEUE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/MovablePtr.hpp>
+#include <Nazara/Network/AbstractSocket.hpp>
+#include <Nazara/Network/IpAddress.hpp>
+#include <Nazara/Network/SocketHandle.hpp>
+#include <functional>
+
+namespace Nz
+{
+	class SocketCompletionQueueImpl;
+
+	class NAZARA_NETWORK_API SocketCompletionQueue
+	{
+		friend class TcpClient;
+		friend class TcpServer;
+
+		public:
+			using Callback = std::function<void(SocketError error, std::size_t byteTransferred)>;
+
+			SocketCompletionQueue(std::size_t queueSize = 256);
+			SocketCompletionQueue(SocketCompletionQueue&&) noexcept = default;
+			~SocketCompletionQueue();
+
+			void CancelOperations(AbstractSocket& socket);
+
+			std::size_t GetPendingOperationCount() const;
+
+			bool IsValid() const;
+
+			std::size_t Wait(int msTimeout);
+
+			SocketCompletionQueue& operator=(SocketCompletionQueue&&) noexcept = default;
+
+		private:
+			using AcceptCallback = std::function<void(SocketError error, SocketHandle handle, const IpAddress& address)>;
+
+			bool Accept(SocketHandle listenHandle, NetProtocol protocol, AcceptCallback callback, SocketError* error);
+			bool Receive(SocketHandle handle, void* buffer, std::size_t size, Callback callback, SocketError* error);
+			bool Send(SocketHandle handle, const void* buffer, std::size_t size, Callback callback, SocketError* error);
+
+			MovablePtr<SocketCompletionQueueImpl> m_impl;
+	};
+}
+
+#endif // NAZARA_SOCKETCOMPLETIONQUEUE_HPP
@@ -10,6 +10,7 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/MovablePtr.hpp>
 #include <Nazara/Network/AbstractSocket.hpp>
+#include <vector>
 
 namespace Nz
 {
@@ -18,23 +19,34 @@ namespace Nz
 	class NAZARA_NETWORK_API SocketPoller
 	{
 		public:
+			struct Event;
+
 			SocketPoller();
 			SocketPoller(SocketPoller&&) noexcept = default;
 			~SocketPoller();
 
 			void Clear();
 
+			const std::vector<Event>& GetReadyEvents() const;
+
 			bool IsReadyToRead(const AbstractSocket& socket) const;
 			bool IsReadyToWrite(const AbstractSocket& socket) const;
 			bool IsRegistered(const AbstractSocket& socket) const;
 
-			bool RegisterSocket(AbstractSocket& socket, SocketPollEventFlags eventFlags);
+			bool RegisterSocket(AbstractSocket& socket, SocketPollEventFlags eventFlags, void* userdata = nullptr, SocketPollMode mode = SocketPollMode_LevelTriggered);
 			void UnregisterSocket(AbstractSocket& socket);
 
 			bool Wait(int msTimeout);
 
 			SocketPoller& operator=(SocketPoller&&) noexcept = default;
 
+			struct Event
+			{
+				AbstractSocket* socket;
+				SocketPollEventFlags events;
+				void* userdata;
+			};
+
 		private:
 			MovablePtr<SocketPollerImpl> m_impl;
 	};
@@ -12,6 +12,7 @@
 #include <Nazara/Core/Stream.hpp>
 #include <Nazara/Network/AbstractSocket.hpp>
 #include <Nazara/Network/IpAddress.hpp>
+#include <Nazara/Network/SocketCompletionQueue.hpp>
 
 namespace Nz
 {
@@ -27,6 +28,9 @@ namespace Nz
 			TcpClient(TcpClient&& tcpClient) = default;
 			~TcpClient() = default;
 
+			bool AsyncReceive(SocketCompletionQueue& queue, void* buffer, std::size_t size, SocketCompletionQueue::Callback callback);
+			bool AsyncSend(SocketCompletionQueue& queue, const void* buffer, std::size_t size, SocketCompletionQueue::Callback callback);
+
 			SocketState Connect(const IpAddress& remoteAddress);
 			SocketState Connect(const String& hostName, NetProtocol protocol = NetProtocol_Any, const String& service = "http", ResolveError* error = nullptr);
 			inline void Disconnect();
@@ -59,25 +63,23 @@ namespace Nz
 			inline TcpClient& operator=(TcpClient&& tcpClient) = default;
 
 		private:
+			bool FillReceiveBuffer(std::size_t minSize);
 			void FlushStream() override;
 
+			void OnAsyncCompletion(SocketError error);
+
 			void OnClose() override;
 			void OnOpened() override;
 
 			std::size_t ReadBlock(void* buffer, std::size_t size) override;
+			bool ReceiveFromSocket(void* buffer, std::size_t size, std::size_t* received);
 			void Reset(SocketHandle handle, const IpAddress& peerAddress);
 			std::size_t WriteBlock(const void* buffer, std::size_t size) override;
 
-			struct PendingPacket
-			{
-				std::size_t received = 0;
-				ByteArray data;
-				UInt16 netcode;
-				bool headerReceived = false;
-			};
-
+			ByteArray m_receiveBuffer;
 			IpAddress m_peerAddress;
-			PendingPacket m_pendingPacket;
+			std::size_t m_receiveBufferBegin;
+			std::size_t m_receiveBufferEnd;
 			UInt64 m_keepAliveInterval;
 			UInt64 m_keepAliveTime;
 			bool m_isKeepAliveEnabled;
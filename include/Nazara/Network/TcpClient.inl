@@ -13,6 +13,8 @@ namespace Nz
 	inline TcpClient::TcpClient() :
 	AbstractSocket(SocketType_TCP),
 	Stream(StreamOption_Sequential),
+	m_receiveBufferBegin(0),
+	m_receiveBufferEnd(0),
 	m_keepAliveInterval(1000),   //TODO: Query OS default value
 	m_keepAliveTime(7'200'000),  //TODO: Query OS default value
 	m_isKeepAliveEnabled(false), //TODO: Query OS default value
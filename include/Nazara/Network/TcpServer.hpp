@@ -10,6 +10,8 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Network/AbstractSocket.hpp>
 #include <Nazara/Network/IpAddress.hpp>
+#include <Nazara/Network/SocketCompletionQueue.hpp>
+#include <functional>
 
 namespace Nz
 {
@@ -18,12 +20,16 @@ namespace Nz
 	class NAZARA_NETWORK_API TcpServer : public AbstractSocket
 	{
 		public:
+			using AcceptCallback = std::function<void(SocketError error)>;
+
 			inline TcpServer();
 			inline TcpServer(TcpServer&& tcpServer);
 			~TcpServer() = default;
 
 			bool AcceptClient(TcpClient* newClient);
 
+			bool AsyncAccept(SocketCompletionQueue& queue, TcpClient* newClient, AcceptCallback callback);
+
 			inline IpAddress GetBoundAddress() const;
 			inline UInt16 GetBoundPort() const;
 
@@ -14,6 +14,7 @@
 namespace Nz
 {
 	struct NetBuffer;
+	struct NetDatagram;
 	class NetPacket;
 
 	class NAZARA_NETWORK_API UdpSocket : public AbstractSocket
@@ -30,6 +31,7 @@ namespace Nz
 			inline bool Create(NetProtocol protocol);
 
 			void EnableBroadcasting(bool broadcasting);
+			bool EnablePortReuse(bool reusePort);
 
 			inline IpAddress GetBoundAddress() const;
 			inline UInt16 GetBoundPort() const;
@@ -39,10 +41,12 @@ namespace Nz
 			std::size_t QueryMaxDatagramSize();
 
 			bool Receive(void* buffer, std::size_t size, IpAddress* from, std::size_t* received);
+			bool ReceiveDatagrams(NetDatagram* datagrams, std::size_t datagramCount, std::size_t* received);
 			bool ReceiveMultiple(NetBuffer* buffers, std::size_t bufferCount, IpAddress* from, std::size_t* received);
 			bool ReceivePacket(NetPacket* packet, IpAddress* from);
 
 			bool Send(const IpAddress& to, const void* buffer, std::size_t size, std::size_t* sent);
+			bool SendDatagrams(NetDatagram* datagrams, std::size_t datagramCount, std::size_t* sent);
 			bool SendMultiple(const IpAddress& to, const NetBuffer* buffers, std::size_t bufferCount, std::size_t* sent);
 			bool SendPacket(const IpAddress& to, const NetPacket& packet);
 
@@ -29,6 +29,7 @@
 #ifndef NAZARA_GLOBAL_NOISE_HPP
 #define NAZARA_GLOBAL_NOISE_HPP
 
+#include <Nazara/Noise/ChunkGenerator.hpp>
 #include <Nazara/Noise/Config.hpp>
 #include <Nazara/Noise/Enums.hpp>
 #include <Nazara/Noise/FBM.hpp>
@@ -0,0 +1,98 @@
+// Copyright (C) 2017 Jrme Leclercq
+// This file is part of the "Nazara Engine - Noise module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_CHUNKGENERATOR_HPP
+#define NAZARA_CHUNKGENERATOR_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/Signal.hpp>
+#include <Nazara/Core/TaskGroup.hpp>
+#include <Nazara/Math/Vector2.hpp>
+#include <Nazara/Noise/Config.hpp>
+#include <Nazara/Utility/Mesh.hpp>
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Nz
+{
+	class MixerBase;
+	class NoiseBase;
+
+	class NAZARA_NOISE_API ChunkGenerator
+	{
+		public:
+			struct Chunk;
+			using RowFunction = std::function<void(float* values, unsigned int count, float x, float y, float stepX)>;
+
+			ChunkGenerator(const NoiseBase& source, float scale, unsigned int chunkSize = 32, float cellSize = 1.f, float heightScale = 1.f, std::size_t cacheSize = 256);
+			ChunkGenerator(const MixerBase& source, float scale, unsigned int chunkSize = 32, float cellSize = 1.f, float heightScale = 1.f, std::size_t cacheSize = 256);
+			ChunkGenerator(RowFunction rowFunction, unsigned int chunkSize = 32, float cellSize = 1.f, float heightScale = 1.f, std::size_t cacheSize = 256);
+			ChunkGenerator(const ChunkGenerator&) = delete;
+			ChunkGenerator(ChunkGenerator&&) = delete;
+			~ChunkGenerator();
+
+			void Clear();
+
+			inline std::size_t GetCachedChunkCount() const;
+			inline std::size_t GetCacheSize() const;
+			inline float GetCellSize() const;
+			const Chunk* GetChunk(const Vector2i& coords);
+			inline unsigned int GetChunkSize() const;
+			inline float GetHeightScale() const;
+			inline std::size_t GetPendingChunkCount() const;
+
+			inline bool IsCached(const Vector2i& coords) const;
+			inline bool IsPending(const Vector2i& coords) const;
+
+			void Request(const Vector2i& coords);
+
+			void SetCacheSize(std::size_t cacheSize);
+
+			void Update();
+
+			void Wait();
+
+			ChunkGenerator& operator=(const ChunkGenerator&) = delete;
+			ChunkGenerator& operator=(ChunkGenerator&&) = delete;
+
+			struct Chunk
+			{
+				MeshRef mesh;              //< Static mesh of the chunk, with positions relative to its corner
+				Vector2i coords;
+				std::vector<float> heights; //< (chunkSize + 1) heights, row by row (along the X axis, then the Z axis)
+			};
+
+			// Signals:
+			NazaraSignal(OnChunkEvicted, ChunkGenerator* /*generator*/, const Chunk& /*chunk*/);
+			NazaraSignal(OnChunkGenerated, ChunkGenerator* /*generator*/, const Chunk& /*chunk*/);
+
+		private:
+			using ChunkList = std::list<Chunk>;
+
+			void EvictChunks();
+			Chunk GenerateChunk(const Vector2i& coords) const;
+
+			std::size_t m_cacheSize;
+			std::unordered_map<Vector2i, ChunkList::iterator> m_cachedChunkByCoords;
+			std::unordered_set<Vector2i> m_pendingChunks;
+			std::vector<Chunk> m_generatedChunks; //< Protected by m_generatedChunksMutex
+			ChunkList m_cachedChunks;             //< From the most recently used to the least recently used
+			Mutex m_generatedChunksMutex;
+			RowFunction m_rowFunction;
+			TaskGroup m_tasks;
+			float m_cellSize;
+			float m_heightScale;
+			unsigned int m_chunkSize;
+	};
+}
+
+#include <Nazara/Noise/ChunkGenerator.inl>
+
+#endif // NAZARA_CHUNKGENERATOR_HPP
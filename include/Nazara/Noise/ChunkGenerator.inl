@@ -0,0 +1,95 @@
+// Copyright (C) 2017 Jrme Leclercq
+// This file is part of the "Nazara Engine - Noise module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Noise/ChunkGenerator.hpp>
+#include <Nazara/Noise/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the number of chunks kept in the cache
+	* \return Number of cached chunks
+	*/
+
+	inline std::size_t ChunkGenerator::GetCachedChunkCount() const
+	{
+		return m_cachedChunks.size();
+	}
+
+	/*!
+	* \brief Gets the maximum number of chunks kept in the cache
+	* \return Size of the cache
+	*/
+
+	inline std::size_t ChunkGenerator::GetCacheSize() const
+	{
+		return m_cacheSize;
+	}
+
+	/*!
+	* \brief Gets the distance between two samples of a chunk
+	* \return Size of a cell
+	*/
+
+	inline float ChunkGenerator::GetCellSize() const
+	{
+		return m_cellSize;
+	}
+
+	/*!
+	* \brief Gets the number of cells along each side of a chunk
+	* \return Number of cells per side
+	*/
+
+	inline unsigned int ChunkGenerator::GetChunkSize() const
+	{
+		return m_chunkSize;
+	}
+
+	/*!
+	* \brief Gets the factor applied to the values of the noise to get the heights
+	* \return Height scale
+	*/
+
+	inline float ChunkGenerator::GetHeightScale() const
+	{
+		return m_heightScale;
+	}
+
+	/*!
+	* \brief Gets the number of requested chunks not yet handed by Update
+	* \return Number of pending chunks
+	*/
+
+	inline std::size_t ChunkGenerator::GetPendingChunkCount() const
+	{
+		return m_pendingChunks.size();
+	}
+
+	/*!
+	* \brief Checks whether a chunk is in the cache
+	* \return true If the chunk is cached
+	*
+	* \param coords Coordinates of the chunk
+	*/
+
+	inline bool ChunkGenerator::IsCached(const Vector2i& coords) const
+	{
+		return m_cachedChunkByCoords.find(coords) != m_cachedChunkByCoords.end();
+	}
+
+	/*!
+	* \brief Checks whether a chunk was requested and is still being generated
+	* \return true If the chunk is pending
+	*
+	* \param coords Coordinates of the chunk
+	*/
+
+	inline bool ChunkGenerator::IsPending(const Vector2i& coords) const
+	{
+		return m_pendingChunks.find(coords) != m_pendingChunks.end();
+	}
+}
+
+#include <Nazara/Noise/DebugOff.hpp>
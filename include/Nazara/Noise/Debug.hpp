@@ -4,5 +4,7 @@
 
 #include <Nazara/Noise/Config.hpp>
 #if NAZARA_NOISE_MANAGE_MEMORY
+	#undef NAZARA_MEMORY_TAG
+	#define NAZARA_MEMORY_TAG Nz::MemoryTag_Noise
 	#include <Nazara/Core/Debug/NewRedefinition.hpp>
 #endif
@@ -17,6 +17,9 @@ namespace Nz
 			FBM(const FBM&) = delete;
 			~FBM() = default;
 
+			void FillRow(float* values, unsigned int count, float x, float y, float stepX, float scale) const override;
+			void FillRow(float* values, unsigned int count, float x, float y, float z, float stepX, float scale) const override;
+
 			float Get(float x, float y, float scale) const override;
 			float Get(float x, float y, float z, float scale) const override;
 			float Get(float x, float y, float z, float w, float scale) const override;
@@ -21,6 +21,11 @@ namespace Nz
 			NoiseBase(unsigned int seed = 0);
 			virtual ~NoiseBase() = default;
 
+			void Fill(float* values, unsigned int width, unsigned int height, const Vector2f& origin, const Vector2f& step, float scale) const;
+			void Fill(float* values, unsigned int width, unsigned int height, unsigned int depth, const Vector3f& origin, const Vector3f& step, float scale) const;
+			virtual void FillRow(float* values, unsigned int count, float x, float y, float stepX, float scale) const;
+			virtual void FillRow(float* values, unsigned int count, float x, float y, float z, float stepX, float scale) const;
+
 			virtual float Get(float x, float y, float scale) const = 0;
 			virtual float Get(float x, float y, float z, float scale) const = 0;
 			virtual float Get(float x, float y, float z, float w, float scale) const = 0;
@@ -4,5 +4,7 @@
 
 #include <Nazara/Physics2D/Config.hpp>
 #if NAZARA_PHYSICS2D_MANAGE_MEMORY
+	#undef NAZARA_MEMORY_TAG
+	#define NAZARA_MEMORY_TAG Nz::MemoryTag_Physics2D
 	#include <Nazara/Core/Debug/NewRedefinition.hpp>
 #endif
@@ -20,6 +20,14 @@ namespace Nz
 
 		ColliderType2D_Max = ColliderType2D_Segment
 	};
+
+	enum ContactEventType2D
+	{
+		ContactEventType2D_End,
+		ContactEventType2D_Start,
+
+		ContactEventType2D_Max = ContactEventType2D_Start
+	};
 }
 
 #endif // NAZARA_ENUMS_PHYSICS2D_HPP
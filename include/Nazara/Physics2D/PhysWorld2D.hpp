@@ -12,16 +12,21 @@
 #include <Nazara/Core/Signal.hpp>
 #include <Nazara/Math/Vector2.hpp>
 #include <Nazara/Physics2D/Config.hpp>
+#include <Nazara/Physics2D/Enums.hpp>
 #include <Nazara/Physics2D/RigidBody2D.hpp>
 #include <functional>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
+struct cpArbiter;
 struct cpCollisionHandler;
 struct cpSpace;
 
 namespace Nz
 {
+	class ByteArray;
+
 	class NAZARA_PHYSICS2D_API PhysWorld2D
 	{
 		friend RigidBody2D;
@@ -40,41 +45,67 @@ namespace Nz
 
 		public:
 			struct Callback;
+			struct ContactEvent;
+			struct CreationParams;
 			struct DebugDrawOptions;
 			struct NearestQueryResult;
+			struct Raycast;
 			struct RaycastHit;
 
 			PhysWorld2D();
+			explicit PhysWorld2D(const CreationParams& params);
 			PhysWorld2D(const PhysWorld2D&) = delete;
 			PhysWorld2D(PhysWorld2D&&) = delete; ///TODO
 			~PhysWorld2D();
 
+			void ClearContactEvents();
+
 			void DebugDraw(const DebugDrawOptions& options, bool drawShapes = true, bool drawConstraints = true, bool drawCollisions = true);
 
+			float GetCollisionBias() const;
+			float GetCollisionSlop() const;
+			std::size_t GetContactEventCapacity() const;
+			const std::vector<ContactEvent>& GetContactEvents() const;
 			float GetDamping() const;
+			std::size_t GetDroppedContactEventCount() const;
 			Vector2f GetGravity() const;
 			cpSpace* GetHandle() const;
 			std::size_t GetIterationCount() const;
 			std::size_t GetMaxStepCount() const;
 			float GetStepSize() const;
+			std::size_t GetThreadCount() const;
+
+			bool IsUsingParallelSolver() const;
 
 			bool NearestBodyQuery(const Vector2f& from, float maxDistance, Nz::UInt32 collisionGroup, Nz::UInt32 categoryMask, Nz::UInt32 collisionMask, RigidBody2D** nearestBody = nullptr);
 			bool NearestBodyQuery(const Vector2f& from, float maxDistance, Nz::UInt32 collisionGroup, Nz::UInt32 categoryMask, Nz::UInt32 collisionMask, NearestQueryResult* result);
 
 			bool RaycastQuery(const Nz::Vector2f& from, const Nz::Vector2f& to, float radius, Nz::UInt32 collisionGroup, Nz::UInt32 categoryMask, Nz::UInt32 collisionMask, std::vector<RaycastHit>* hitInfos);
 			bool RaycastQueryFirst(const Nz::Vector2f& from, const Nz::Vector2f& to, float radius, Nz::UInt32 collisionGroup, Nz::UInt32 categoryMask, Nz::UInt32 collisionMask, RaycastHit* hitInfo = nullptr);
+			std::size_t RaycastQueryFirst(const Raycast* raycasts, std::size_t raycastCount, Nz::UInt32 collisionGroup, Nz::UInt32 categoryMask, Nz::UInt32 collisionMask, RaycastHit* hitInfos);
 
 			void RegionQuery(const Nz::Rectf& boundingBox, Nz::UInt32 collisionGroup, Nz::UInt32 categoryMask, Nz::UInt32 collisionMask, std::vector<Nz::RigidBody2D*>* bodies);
+			void RegionQuery(const Nz::Rectf* boundingBoxes, std::size_t boxCount, Nz::UInt32 collisionGroup, Nz::UInt32 categoryMask, Nz::UInt32 collisionMask, Nz::RigidBody2D** bodies, std::size_t maxBodyPerBox, std::size_t* bodyCounts);
 
 			void RegisterCallbacks(unsigned int collisionId, const Callback& callbacks);
 			void RegisterCallbacks(unsigned int collisionIdA, unsigned int collisionIdB, const Callback& callbacks);
+			void RegisterContactEvents(unsigned int collisionId);
+			void RegisterContactEvents(unsigned int collisionIdA, unsigned int collisionIdB);
+
+			bool RestoreState(const ByteArray& state);
 
+			void SaveState(ByteArray* state) const;
+
+			void SetCollisionBias(float collisionBias);
+			void SetCollisionSlop(float collisionSlop);
+			void SetContactEventCapacity(std::size_t capacity);
 			void SetDamping(float dampingValue);
 			void SetGravity(const Vector2f& gravity);
 			void SetIterationCount(std::size_t iterationCount);
 			void SetMaxStepCount(std::size_t maxStepCount);
 			void SetStepSize(float stepSize);
 
+			void Simulate(std::size_t stepCount);
 			void Step(float timestep);
 
 			void UseSpatialHash(float cellSize, std::size_t entityCount);
@@ -91,6 +122,21 @@ namespace Nz
 				void* userdata;
 			};
 
+			struct ContactEvent
+			{
+				ContactEventType2D type;
+				Nz::RigidBody2D* firstBody;
+				Nz::RigidBody2D* secondBody;
+				Nz::Vector2f contactPoint; //< First contact point, start events only
+				Nz::Vector2f normal; //< From the first body to the second one, start events only
+			};
+
+			struct CreationParams
+			{
+				bool parallelSolver = false; //< Uses Chipmunk's multithreaded solver (cpHastySpace)
+				std::size_t threadCount = 0; //< Solver threads of a parallel solver, zero uses the worker count of the TaskScheduler
+			};
+
 			struct DebugDrawOptions
 			{
 				Color constraintColor;
@@ -115,6 +161,13 @@ namespace Nz
 				float distance;
 			};
 
+			struct Raycast
+			{
+				Nz::Vector2f from;
+				Nz::Vector2f to;
+				float radius;
+			};
+
 			struct RaycastHit
 			{
 				Nz::RigidBody2D* nearestBody;
@@ -128,14 +181,19 @@ namespace Nz
 
 		private:
 			void InitCallbacks(cpCollisionHandler* handler, const Callback& callbacks);
+			void InitContactEvents(cpCollisionHandler* handler);
 
 			using PostStep = std::function<void(Nz::RigidBody2D* body)>;
 
 			void OnRigidBodyMoved(RigidBody2D* oldPointer, RigidBody2D* newPointer);
 			void OnRigidBodyRelease(RigidBody2D* rigidBody);
 
+			void PushContactEvent(cpArbiter* arbiter, ContactEventType2D type);
+
 			void RegisterPostStep(RigidBody2D* rigidBody, PostStep&& func);
 
+			void RunStep();
+
 			struct PostStepContainer
 			{
 				NazaraSlot(RigidBody2D, OnRigidBody2DMove, onMovedSlot);
@@ -146,12 +204,16 @@ namespace Nz
 
 			static_assert(std::is_nothrow_move_constructible<PostStepContainer>::value, "PostStepContainer should be noexcept MoveConstructible");
 
+			std::size_t m_droppedContactEventCount;
 			std::size_t m_maxStepCount;
 			std::unordered_map<cpCollisionHandler*, std::unique_ptr<Callback>> m_callbacks;
+			std::vector<ContactEvent> m_contactEvents;
 			std::unordered_map<RigidBody2D*, PostStepContainer> m_rigidPostSteps;
 			cpSpace* m_handle;
 			float m_stepSize;
 			float m_timestepAccumulator;
+			bool m_isUsingParallelSolver;
+			bool m_isUsingSpatialHash;
 	};
 }
 
@@ -23,6 +23,8 @@ namespace Nz
 
 	class NAZARA_PHYSICS2D_API RigidBody2D
 	{
+		friend PhysWorld2D;
+
 		public:
 			RigidBody2D(PhysWorld2D* world, float mass);
 			RigidBody2D(PhysWorld2D* world, float mass, Collider2DRef geom);
@@ -52,11 +54,15 @@ namespace Nz
 			Vector2f GetVelocity() const;
 			PhysWorld2D* GetWorld() const;
 
+			bool HasTransformChanged() const;
+
 			bool IsKinematic() const;
 			bool IsSimulationEnabled() const;
 			bool IsSleeping() const;
 			bool IsStatic() const;
 
+			void ResetTransformChanged();
+
 			void SetAngularVelocity(float angularVelocity);
 			void SetGeom(Collider2DRef geom, bool recomputeMoment = true);
 			void SetMass(float mass, bool recomputeMoment = true);
@@ -92,6 +98,7 @@ namespace Nz
 			bool m_isRegistered;
 			bool m_isSimulationEnabled;
 			bool m_isStatic;
+			bool m_transformChanged;
 			float m_gravityFactor;
 			float m_mass;
 	};
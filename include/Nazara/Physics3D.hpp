@@ -30,6 +30,7 @@
 #define NAZARA_GLOBAL_PHYSICS3D_HPP
 
 #include <Nazara/Physics3D/Collider3D.hpp>
+#include <Nazara/Physics3D/Collider3DCache.hpp>
 #include <Nazara/Physics3D/Config.hpp>
 #include <Nazara/Physics3D/Enums.hpp>
 #include <Nazara/Physics3D/Physics3D.hpp>
@@ -8,6 +8,7 @@
 #define NAZARA_COLLIDER3D_HPP
 
 #include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/ByteArray.hpp>
 #include <Nazara/Core/ObjectLibrary.hpp>
 #include <Nazara/Core/ObjectRef.hpp>
 #include <Nazara/Core/RefCounted.hpp>
@@ -185,9 +186,14 @@ namespace Nz
 		public:
 			ConvexCollider3D(SparsePtr<const Vector3f> vertices, unsigned int vertexCount, float tolerance = 0.002f, const Matrix4f& transformMatrix = Matrix4f::Identity());
 			ConvexCollider3D(SparsePtr<const Vector3f> vertices, unsigned int vertexCount, float tolerance, const Vector3f& translation, const Quaternionf& rotation = Quaternionf::Identity());
+			explicit ConvexCollider3D(const ByteArray& cookedHull);
+
+			ByteArray Cook() const;
 
 			ColliderType3D GetType() const override;
 
+			bool IsCooked() const;
+
 			template<typename... Args> static ConvexCollider3DRef New(Args&&... args);
 
 		private:
@@ -195,6 +201,7 @@ namespace Nz
 
 			std::vector<Vector3f> m_vertices;
 			Matrix4f m_matrix;
+			bool m_isCooked;
 			float m_tolerance;
 	};
 
@@ -0,0 +1,47 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Physics 3D module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_COLLIDER3DCACHE_HPP
+#define NAZARA_COLLIDER3DCACHE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Physics3D/Collider3D.hpp>
+#include <string>
+#include <unordered_map>
+
+namespace Nz
+{
+	class NAZARA_PHYSICS3D_API Collider3DCache
+	{
+		public:
+			Collider3DCache() = default;
+			Collider3DCache(const Collider3DCache&) = delete;
+			Collider3DCache(Collider3DCache&&) = default;
+			~Collider3DCache() = default;
+
+			void Clear();
+
+			BoxCollider3DRef GetBox(const Vector3f& lengths, const Matrix4f& transformMatrix = Matrix4f::Identity());
+			CapsuleCollider3DRef GetCapsule(float length, float radius, const Matrix4f& transformMatrix = Matrix4f::Identity());
+			std::size_t GetColliderCount() const;
+			ConeCollider3DRef GetCone(float length, float radius, const Matrix4f& transformMatrix = Matrix4f::Identity());
+			ConvexCollider3DRef GetConvexHull(SparsePtr<const Vector3f> vertices, unsigned int vertexCount, float tolerance = 0.002f, const Matrix4f& transformMatrix = Matrix4f::Identity());
+			CylinderCollider3DRef GetCylinder(float length, float radius, const Matrix4f& transformMatrix = Matrix4f::Identity());
+			SphereCollider3DRef GetSphere(float radius, const Vector3f& translation = Vector3f::Zero());
+
+			std::size_t Purge();
+
+			Collider3DCache& operator=(const Collider3DCache&) = delete;
+			Collider3DCache& operator=(Collider3DCache&&) = default;
+
+		private:
+			template<typename T, typename F> ObjectRef<T> GetCollider(const std::string& key, F&& factory);
+
+			std::unordered_map<std::string, Collider3DRef> m_colliders;
+	};
+}
+
+#endif // NAZARA_COLLIDER3DCACHE_HPP
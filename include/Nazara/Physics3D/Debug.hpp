@@ -4,5 +4,7 @@
 
 #include <Nazara/Physics3D/Config.hpp>
 #if NAZARA_PHYSICS3D_MANAGE_MEMORY
+	#undef NAZARA_MEMORY_TAG
+	#define NAZARA_MEMORY_TAG Nz::MemoryTag_Physics3D
 	#include <Nazara/Core/Debug/NewRedefinition.hpp>
 #endif
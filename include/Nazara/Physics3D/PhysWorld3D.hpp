@@ -11,6 +11,8 @@
 #include <Nazara/Core/MovablePtr.hpp>
 #include <Nazara/Core/String.hpp>
 #include <Nazara/Math/Box.hpp>
+#include <Nazara/Math/Matrix4.hpp>
+#include <Nazara/Math/Quaternion.hpp>
 #include <Nazara/Math/Vector3.hpp>
 #include <Nazara/Physics3D/Config.hpp>
 #include <unordered_map>
@@ -22,6 +24,7 @@ class NewtonWorld;
 
 namespace Nz
 {
+	class Collider3D;
 	class RigidBody3D;
 
 	class NAZARA_PHYSICS3D_API PhysWorld3D
@@ -31,11 +34,15 @@ namespace Nz
 			using AABBOverlapCallback = std::function<bool(const RigidBody3D& firstBody, const RigidBody3D& secondBody)>;
 			using CollisionCallback = std::function<bool(const RigidBody3D& firstBody, const RigidBody3D& secondBody)>;
 
+			struct RaycastHit;
+
 			PhysWorld3D();
 			PhysWorld3D(const PhysWorld3D&) = delete;
 			PhysWorld3D(PhysWorld3D&&) = default;
 			~PhysWorld3D();
 
+			std::size_t ConvexCastQueryFirst(const Collider3D& collider, const Matrix4f* startMatrices, const Vector3f* endPositions, std::size_t castCount, RaycastHit* hitInfos);
+
 			int CreateMaterial(String name = String());
 
 			void ForEachBodyInAABB(const Boxf& box, const BodyIterator& iterator);
@@ -45,11 +52,16 @@ namespace Nz
 			int GetMaterial(const String& name);
 			std::size_t GetMaxStepCount() const;
 			float GetStepSize() const;
+			std::size_t GetThreadCount() const;
+
+			std::size_t RaycastQueryFirst(const Vector3f* startPositions, const Vector3f* endPositions, std::size_t rayCount, RaycastHit* hitInfos);
+			void ReadBodyTransforms(const RigidBody3D* const* bodies, std::size_t bodyCount, Vector3f* positions, Quaternionf* rotations) const;
 
 			void SetGravity(const Vector3f& gravity);
 			void SetMaxStepCount(std::size_t maxStepCount);
 			void SetSolverModel(unsigned int model);
 			void SetStepSize(float stepSize);
+			void SetThreadCount(std::size_t threadCount);
 
 			void SetMaterialCollisionCallback(int firstMaterial, int secondMaterial, AABBOverlapCallback aabbOverlapCallback, CollisionCallback collisionCallback);
 			void SetMaterialDefaultCollidable(int firstMaterial, int secondMaterial, bool collidable);
@@ -63,6 +75,14 @@ namespace Nz
 			PhysWorld3D& operator=(const PhysWorld3D&) = delete;
 			PhysWorld3D& operator=(PhysWorld3D&&) = default;
 
+			struct RaycastHit
+			{
+				RigidBody3D* body;
+				Vector3f hitNormal;
+				Vector3f hitPosition;
+				float fraction;
+			};
+
 		private:
 			struct Callback
 			{
@@ -54,11 +54,15 @@ namespace Nz
 			void* GetUserdata() const;
 			PhysWorld3D* GetWorld() const;
 
+			bool HasTransformChanged() const;
+
 			bool IsAutoSleepEnabled() const;
 			bool IsMoveable() const;
 			bool IsSimulationEnabled() const;
 			bool IsSleeping() const;
 
+			void ResetTransformChanged();
+
 			void SetAngularDamping(const Vector3f& angularDamping);
 			void SetAngularVelocity(const Vector3f& angularVelocity);
 			void SetGeom(Collider3DRef geom);
@@ -90,6 +94,7 @@ namespace Nz
 			void* m_userdata;
 			float m_gravityFactor;
 			float m_mass;
+			bool m_transformChanged;
 	};
 }
 
@@ -4,5 +4,7 @@
 
 #include <Nazara/Platform/Config.hpp>
 #if NAZARA_PLATFORM_MANAGE_MEMORY
+	#undef NAZARA_MEMORY_TAG
+	#define NAZARA_MEMORY_TAG Nz::MemoryTag_Platform
 	#include <Nazara/Core/Debug/NewRedefinition.hpp>
 #endif
@@ -13,6 +13,7 @@
 #include <Nazara/Core/ConditionVariable.hpp>
 #include <Nazara/Core/MovablePtr.hpp>
 #include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/SpscQueue.hpp>
 #include <Nazara/Core/String.hpp>
 #include <Nazara/Math/Vector2.hpp>
 #include <Nazara/Platform/Config.hpp>
@@ -51,6 +52,7 @@ namespace Nz
 			void Destroy();
 
 			inline void EnableCloseOnQuit(bool closeOnQuit);
+			inline void EnableEventCoalescing(bool coalesce);
 
 			NAZARA_DEPRECATED("Event pooling/waiting is deprecated, please use the EventHandler system")
 			inline void EnableEventPolling(bool enable);
@@ -69,6 +71,7 @@ namespace Nz
 
 			bool HasFocus() const;
 
+			inline bool IsEventCoalescingEnabled() const;
 			bool IsMinimized() const;
 			inline bool IsOpen(bool checkClosed = true);
 			inline bool IsOpen() const;
@@ -111,26 +114,34 @@ namespace Nz
 			MovablePtr<WindowImpl> m_impl;
 
 		private:
+			void DispatchAsyncEvents();
+			void FlushEvents();
 			void IgnoreNextMouseEvent(int mouseX, int mouseY) const;
 			inline void HandleEvent(const WindowEvent& event);
-			inline void PushEvent(const WindowEvent& event);
+			void PushEvent(const WindowEvent& event);
+			bool PushPendingEvents();
+			void QueueEvent(const WindowEvent& event);
 
 			static bool Initialize();
 			static void Uninitialize();
 
 			std::queue<WindowEvent> m_events;
 			std::vector<WindowEvent> m_pendingEvents;
+			SpscQueue<WindowEvent> m_asyncEvents;
 			ConditionVariable m_eventCondition;
 			CursorController m_cursorController;
 			CursorRef m_cursor;
 			EventHandler m_eventHandler;
 			IconRef m_icon;
+			WindowEvent m_coalescedEvent;
 			Mutex m_eventMutex;
 			Mutex m_eventConditionMutex;
 			bool m_asyncWindow;
 			bool m_closed;
 			bool m_closeOnQuit;
+			bool m_coalesceEvents;
 			bool m_eventPolling;
+			bool m_hasCoalescedEvent;
 			bool m_ownsWindow;
 			bool m_waitForEvent;
 	};
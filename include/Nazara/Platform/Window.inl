@@ -36,6 +36,12 @@ namespace Nz
 		m_closeOnQuit = closeOnQuit;
 	}
 
+	inline void Window::EnableEventCoalescing(bool coalesce)
+	{
+		// Should be called before the creation of a threaded window, as its thread reads it
+		m_coalesceEvents = coalesce;
+	}
+
 	inline void Window::EnableEventPolling(bool enable)
 	{
 		m_eventPolling = enable;
@@ -61,6 +67,11 @@ namespace Nz
 		return m_eventHandler;
 	}
 
+	inline bool Window::IsEventCoalescingEnabled() const
+	{
+		return m_coalesceEvents;
+	}
+
 	inline bool Window::IsOpen(bool checkClosed)
 	{
 		if (!m_impl)
@@ -103,27 +114,6 @@ namespace Nz
 		if (event.type == WindowEventType_Quit && m_closeOnQuit)
 			Close();
 	}
-
-	inline void Window::PushEvent(const WindowEvent& event)
-	{
-		if (!m_asyncWindow)
-			HandleEvent(event);
-		else
-		{
-			{
-				LockGuard eventLock(m_eventMutex);
-
-				m_pendingEvents.push_back(event);
-			}
-
-			if (m_waitForEvent)
-			{
-				m_eventConditionMutex.Lock();
-				m_eventCondition.Signal();
-				m_eventConditionMutex.Unlock();
-			}
-		}
-	}
 }
 
 #include <Nazara/Platform/DebugOff.hpp>
@@ -140,6 +140,21 @@
 	#define NAZARA_PLATFORM_x64
 #endif
 
+// SIMD instruction sets enabled at compile time (NAZARA_NO_SIMD forces scalar code paths)
+#if !defined(NAZARA_NO_SIMD)
+	#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		#define NAZARA_SIMD_SSE2
+	#endif
+
+	#if defined(__AVX__)
+		#define NAZARA_SIMD_AVX
+	#endif
+
+	#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+		#define NAZARA_SIMD_NEON
+	#endif
+#endif
+
 // A bunch of useful macros
 #define NazaraPrefix(a, prefix) prefix ## a
 #define NazaraPrefixMacro(a, prefix) NazaraPrefix(a, prefix)
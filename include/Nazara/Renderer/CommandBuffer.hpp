@@ -0,0 +1,180 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Renderer module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_COMMANDBUFFER_HPP
+#define NAZARA_COMMANDBUFFER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Color.hpp>
+#include <Nazara/Math/Matrix4.hpp>
+#include <Nazara/Math/Rect.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <Nazara/Math/Vector4.hpp>
+#include <Nazara/Renderer/Config.hpp>
+#include <Nazara/Renderer/Enums.hpp>
+#include <Nazara/Renderer/Renderer.hpp>
+#include <Nazara/Renderer/RenderStates.hpp>
+#include <Nazara/Renderer/TextureSampler.hpp>
+#include <Nazara/Utility/Enums.hpp>
+#include <vector>
+
+namespace Nz
+{
+	class Buffer;
+	class IndexBuffer;
+	class Shader;
+	class Texture;
+	class VertexBuffer;
+
+	class NAZARA_RENDERER_API CommandBuffer
+	{
+		friend Renderer;
+
+		public:
+			CommandBuffer() = default;
+			CommandBuffer(const CommandBuffer&) = default;
+			CommandBuffer(CommandBuffer&&) = default;
+			~CommandBuffer() = default;
+
+			void BindPipeline(const Shader* shader, const RenderStates& states);
+
+			void Clear();
+
+			void Draw(PrimitiveMode mode, unsigned int firstVertex, unsigned int vertexCount);
+			void DrawIndexed(PrimitiveMode mode, unsigned int firstIndex, unsigned int indexCount);
+			void DrawIndexedIndirect(PrimitiveMode mode, const Renderer::DrawIndexedIndirectCommand* commands, std::size_t commandCount, const Matrix4f* instanceMatrices, std::size_t instanceCount);
+			void DrawIndexedInstanced(const Matrix4f* instanceMatrices, std::size_t instanceCount, PrimitiveMode mode, unsigned int firstIndex, unsigned int indexCount);
+			void DrawInstanced(const Matrix4f* instanceMatrices, std::size_t instanceCount, PrimitiveMode mode, unsigned int firstVertex, unsigned int vertexCount);
+
+			inline std::size_t GetCommandCount() const;
+
+			inline bool IsEmpty() const;
+
+			void SendColor(const Shader* shader, int location, const Color& color);
+			void SendFloat(const Shader* shader, int location, float value);
+			void SendMatrixArray(const Shader* shader, int location, const Matrix4f* matrices, unsigned int count);
+			void SendVector(const Shader* shader, int location, const Vector3f& vector);
+			void SendVector(const Shader* shader, int location, const Vector4f& vector);
+
+			void SetIndexBuffer(const IndexBuffer* indexBuffer);
+			void SetMatrix(MatrixType type, const Matrix4f& matrix);
+			void SetScissorRect(const Recti& rect);
+			void SetTexture(unsigned int unit, const Texture* texture, const TextureSampler& sampler);
+			void SetUniformBuffer(unsigned int bindingIndex, const Buffer* buffer, UInt32 offset = 0, UInt32 size = 0);
+			void SetVertexBuffer(const VertexBuffer* vertexBuffer);
+
+			CommandBuffer& operator=(const CommandBuffer&) = default;
+			CommandBuffer& operator=(CommandBuffer&&) = default;
+
+		private:
+			enum CommandType
+			{
+				CommandType_BindPipeline,
+				CommandType_Draw,
+				CommandType_DrawIndexed,
+				CommandType_DrawIndexedIndirect,
+				CommandType_SendColor,
+				CommandType_SendFloat,
+				CommandType_SendMatrixArray,
+				CommandType_SendVector3,
+				CommandType_SendVector4,
+				CommandType_SetIndexBuffer,
+				CommandType_SetMatrix,
+				CommandType_SetScissorRect,
+				CommandType_SetTexture,
+				CommandType_SetUniformBuffer,
+				CommandType_SetVertexBuffer
+			};
+
+			// Commands only hold plain data, larger parameters being stored aside and referenced by index
+			struct Command
+			{
+				CommandType type;
+
+				union
+				{
+					struct
+					{
+						const Shader* shader;
+						std::size_t statesIndex;
+					} pipeline;
+
+					struct
+					{
+						PrimitiveMode mode;
+						unsigned int first;
+						unsigned int count;
+						std::size_t firstInstance; //< Index of the first instance matrix
+						std::size_t instanceCount; //< Zero for non-instanced draws
+					} draw;
+
+					struct
+					{
+						PrimitiveMode mode;
+						std::size_t firstCommand;
+						std::size_t commandCount;
+						std::size_t firstInstance; //< Index of the first instance matrix, base instances of the commands being relative to it
+					} indirect;
+
+					struct
+					{
+						const Shader* shader;
+						int location;
+						float values[4];
+					} uniform;
+
+					struct
+					{
+						const Shader* shader;
+						const Matrix4f* matrices;
+						int location;
+						unsigned int count;
+					} uniformMatrices;
+
+					struct
+					{
+						const void* object;
+					} buffer;
+
+					struct
+					{
+						MatrixType type;
+						std::size_t matrixIndex;
+					} matrix;
+
+					struct
+					{
+						int x, y, width, height;
+					} scissorRect;
+
+					struct
+					{
+						const Texture* texture;
+						std::size_t samplerIndex;
+						unsigned int unit;
+					} texture;
+
+					struct
+					{
+						const Buffer* buffer;
+						unsigned int bindingIndex;
+						UInt32 offset;
+						UInt32 size;
+					} uniformBuffer;
+				};
+			};
+
+			std::vector<Command> m_commands;
+			std::vector<Renderer::DrawIndexedIndirectCommand> m_indirectCommands;
+			std::vector<Matrix4f> m_matrices;
+			std::vector<RenderStates> m_renderStates;
+			std::vector<TextureSampler> m_samplers;
+	};
+}
+
+#include <Nazara/Renderer/CommandBuffer.inl>
+
+#endif // NAZARA_COMMANDBUFFER_HPP
@@ -0,0 +1,28 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Renderer module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Renderer/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the number of commands recorded
+	* \return Command count
+	*/
+	inline std::size_t CommandBuffer::GetCommandCount() const
+	{
+		return m_commands.size();
+	}
+
+	/*!
+	* \brief Checks whether no command was recorded
+	* \return true If the buffer is empty
+	*/
+	inline bool CommandBuffer::IsEmpty() const
+	{
+		return m_commands.empty();
+	}
+}
+
+#include <Nazara/Renderer/DebugOff.hpp>
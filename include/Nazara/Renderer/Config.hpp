@@ -32,6 +32,12 @@
 // La taille du buffer d'Instancing (définit le nombre maximum d'instances en un rendu)
 #define NAZARA_RENDERER_INSTANCE_BUFFER_SIZE 1 * 1024 * 1024
 
+// La taille du buffer de commandes de rendu indirect (définit le nombre maximum de commandes en un rendu)
+#define NAZARA_RENDERER_INDIRECT_BUFFER_SIZE 64 * 1024
+
+// La taille du ring de transfert des textures (TextureUploadQueue), découpé en trois segments qui bornent la taille d'un envoi
+#define NAZARA_RENDERER_UPLOAD_BUFFER_SIZE 12 * 1024 * 1024
+
 // Utilise un manager de mémoire pour gérer les allocations dynamiques (détecte les leaks au prix d'allocations/libérations dynamiques plus lentes)
 #define NAZARA_RENDERER_MANAGE_MEMORY 0
 
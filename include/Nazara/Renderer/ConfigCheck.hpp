@@ -18,7 +18,9 @@
 	#define NAZARA_RENDERER_MANAGE_MEMORY 0
 #endif
 
+NazaraCheckTypeAndVal(NAZARA_RENDERER_INDIRECT_BUFFER_SIZE, integral, >, 0, " shall be a strictly positive integer");
 NazaraCheckTypeAndVal(NAZARA_RENDERER_INSTANCE_BUFFER_SIZE, integral, >, 0, " shall be a strictly positive integer");
+NazaraCheckTypeAndVal(NAZARA_RENDERER_UPLOAD_BUFFER_SIZE, integral, >, 0, " shall be a strictly positive integer");
 
 #undef NazaraCheckTypeAndVal
 
@@ -42,7 +42,7 @@ namespace Nz
 
 			void Destroy();
 
-			void EnableVerticalSync(bool enabled);
+			void EnableVerticalSync(bool enabled, bool adaptive = false);
 
 			const ContextParameters& GetParameters() const;
 
@@ -4,5 +4,7 @@
 
 #include <Nazara/Renderer/Config.hpp>
 #if NAZARA_RENDERER_MANAGE_MEMORY
+	#undef NAZARA_MEMORY_TAG
+	#define NAZARA_MEMORY_TAG Nz::MemoryTag_Renderer
 	#include <Nazara/Core/Debug/NewRedefinition.hpp>
 #endif
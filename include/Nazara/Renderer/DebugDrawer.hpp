@@ -23,6 +23,8 @@ namespace Nz
 	class NAZARA_RENDERER_API DebugDrawer
 	{
 		public:
+			static void Clear();
+
 			static void Draw(const BoundingVolumef& volume);
 			static void Draw(const Boxf& box);
 			static void Draw(const Boxi& box);
@@ -41,11 +43,15 @@ namespace Nz
 
 			static void EnableDepthBuffer(bool depthBuffer);
 
+			static void Flush();
+
 			static float GetLineWidth();
 			static float GetPointSize();
 			static Color GetPrimaryColor();
 			static Color GetSecondaryColor();
 
+			static bool HasPendingPrimitives();
+
 			static bool Initialize();
 			static bool IsDepthBufferEnabled();
 
@@ -75,10 +75,12 @@ namespace Nz
 	enum RendererCap
 	{
 		RendererCap_AnisotropicFilter,
+		RendererCap_BindlessTextures,
 		RendererCap_FP64,
 		RendererCap_Instancing,
+		RendererCap_MultiDrawIndirect,
 
-		RendererCap_Max = RendererCap_Instancing
+		RendererCap_Max = RendererCap_MultiDrawIndirect
 	};
 
 	enum RendererBufferFlags
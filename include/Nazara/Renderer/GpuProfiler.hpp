@@ -0,0 +1,97 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Renderer module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_GPUPROFILER_HPP
+#define NAZARA_GPUPROFILER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Renderer/Config.hpp>
+#include <Nazara/Renderer/GpuQuery.hpp>
+#include <memory>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_RENDERER_API GpuProfiler
+	{
+		public:
+			class Scope;
+			struct SectionResult;
+
+			GpuProfiler(unsigned int frameLatency = 3);
+			GpuProfiler(const GpuProfiler&) = delete;
+			GpuProfiler(GpuProfiler&&) = delete;
+			~GpuProfiler();
+
+			void BeginFrame();
+			void BeginSection(const char* name);
+
+			bool EndFrame();
+			void EndSection();
+
+			inline const std::vector<SectionResult>& GetResults() const;
+
+			GpuProfiler& operator=(const GpuProfiler&) = delete;
+			GpuProfiler& operator=(GpuProfiler&&) = delete;
+
+			static inline GpuProfiler* GetActive();
+
+			struct SectionResult
+			{
+				const char* name;
+				UInt64 duration; //< Nanoseconds
+				unsigned int depth;
+			};
+
+			class Scope
+			{
+				public:
+					inline Scope(const char* name);
+					Scope(const Scope&) = delete;
+					Scope(Scope&&) = delete;
+					inline ~Scope();
+
+					Scope& operator=(const Scope&) = delete;
+					Scope& operator=(Scope&&) = delete;
+
+				private:
+					GpuProfiler* m_profiler;
+			};
+
+		private:
+			struct Frame;
+
+			GpuQuery* AllocateQuery(Frame& frame);
+			bool ResolveFrames();
+
+			struct Section
+			{
+				const char* name;
+				GpuQuery* begin;
+				GpuQuery* end;
+				unsigned int depth;
+			};
+
+			struct Frame
+			{
+				std::vector<Section> sections;
+				std::vector<std::unique_ptr<GpuQuery>> queries;
+				std::size_t usedQueries = 0;
+				bool pending = false;
+			};
+
+			std::vector<Frame> m_frames;
+			std::vector<SectionResult> m_results;
+			std::vector<std::size_t> m_openSections;
+			std::size_t m_currentFrame;
+
+			static GpuProfiler* s_activeProfiler;
+	};
+}
+
+#include <Nazara/Renderer/GpuProfiler.inl>
+
+#endif // NAZARA_GPUPROFILER_HPP
@@ -0,0 +1,51 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Renderer module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Renderer/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the sections of the latest frame whose results are available
+	* \return Sections, in the order they were begun
+	*
+	* \remark Results lag a few frames behind, as they are only read once the GPU is done with the frame
+	*/
+	inline const std::vector<GpuProfiler::SectionResult>& GpuProfiler::GetResults() const
+	{
+		return m_results;
+	}
+
+	/*!
+	* \brief Gets the profiler of the frame being rendered
+	* \return Profiler between its BeginFrame and EndFrame calls, nullptr if no frame is being profiled
+	*/
+	inline GpuProfiler* GpuProfiler::GetActive()
+	{
+		return s_activeProfiler;
+	}
+
+	/*!
+	* \brief Begins a section of the active profiler, if there is one
+	*
+	* \param name Name of the section, it must outlive the profiler (a string literal for example)
+	*/
+	inline GpuProfiler::Scope::Scope(const char* name) :
+	m_profiler(GpuProfiler::GetActive())
+	{
+		if (m_profiler)
+			m_profiler->BeginSection(name);
+	}
+
+	/*!
+	* \brief Ends the section begun by the constructor
+	*/
+	inline GpuProfiler::Scope::~Scope()
+	{
+		if (m_profiler)
+			m_profiler->EndSection();
+	}
+}
+
+#include <Nazara/Renderer/DebugOff.hpp>
@@ -24,10 +24,12 @@ namespace Nz
 			void Begin(GpuQueryMode mode);
 			void End();
 
-			unsigned int GetResult() const;
+			UInt64 GetResult() const;
 
 			bool IsResultAvailable() const;
 
+			void WriteTimestamp();
+
 			// Fonctions OpenGL
 			unsigned int GetOpenGLID() const;
 
@@ -14,6 +14,7 @@
 #include <Nazara/Math/Rect.hpp>
 #include <Nazara/Renderer/Config.hpp>
 #include <Nazara/Renderer/Enums.hpp>
+#include <Nazara/Renderer/RenderStatistics.hpp>
 #include <Nazara/Utility/Enums.hpp>
 
 // Inclusion des headers OpenGL
@@ -29,14 +30,35 @@ namespace GLX
 	#include <GL3/glxext.h>
 #endif
 
+// GL_KHR_parallel_shader_compile is more recent than the bundled headers
+// (the typedef is repeated as the system headers may have declared it in the GLX namespace only)
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+typedef void (APIENTRYP PFNGLMAXSHADERCOMPILERTHREADSKHRPROC) (GLuint count);
+
+// Same for GL_ARB_bindless_texture
+#ifndef GL_ARB_bindless_texture
+typedef GLuint64 (APIENTRYP PFNGLGETTEXTURESAMPLERHANDLEARBPROC) (GLuint texture, GLuint sampler);
+typedef void (APIENTRYP PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC) (GLuint64 handle);
+typedef void (APIENTRYP PFNGLMAKETEXTUREHANDLERESIDENTARBPROC) (GLuint64 handle);
+#endif
+
 namespace Nz
 {
 	enum OpenGLExtension
 	{
 		OpenGLExtension_AnisotropicFilter,
+		OpenGLExtension_BindlessTexture,
+		OpenGLExtension_BufferStorage,
+		OpenGLExtension_CopyImage,
 		OpenGLExtension_DebugOutput,
 		OpenGLExtension_FP64,
 		OpenGLExtension_GetProgramBinary,
+		OpenGLExtension_MultiDrawIndirect,
+		OpenGLExtension_ParallelShaderCompile,
 		OpenGLExtension_SeparateShaderObjects,
 		OpenGLExtension_SeamlessCubeMap,
 		OpenGLExtension_Shader_ImageLoadStore,
@@ -84,6 +106,8 @@ namespace Nz
 			static void BindTexture(ImageType type, GLuint id);
 			static void BindTexture(unsigned int textureUnit, ImageType type, GLuint id);
 			static void BindTextureUnit(unsigned int textureUnit);
+			static void BindUniformBuffer(GLuint bindingIndex, GLuint id, UInt32 offset, UInt32 size);
+			static void BindVertexArray(GLuint id);
 			static void BindViewport(const Recti& viewport);
 
 			static void DeleteBuffer(BufferType type, GLuint id);
@@ -100,11 +124,13 @@ namespace Nz
 			static GLuint GetCurrentTexture();
 			static GLuint GetCurrentTexture(unsigned int textureUnit);
 			static unsigned int GetCurrentTextureUnit();
+			static GLuint GetCurrentVertexArray();
 			static Recti GetCurrentViewport();
 
 			static OpenGLFunc GetEntry(const String& entryPoint);
 			static unsigned int GetGLSLVersion();
 			static String GetRendererName();
+			static const RenderStatistics& GetStatistics();
 			static String GetVendorName();
 			static unsigned int GetVersion();
 
@@ -114,6 +140,10 @@ namespace Nz
 			static bool IsSupported(OpenGLExtension extension);
 			static bool IsSupported(const String& string);
 
+			static void RecordDrawCall();
+			static void RecordUpload(UInt64 size);
+			static void ResetStatistics();
+
 			static void SetBuffer(BufferType type, GLuint id);
 			static void SetProgram(GLuint id);
 			static void SetScissorBox(const Recti& scissorBox);
@@ -121,6 +151,7 @@ namespace Nz
 			static void SetTexture(GLuint id);
 			static void SetTexture(unsigned int textureUnit, GLuint id);
 			static void SetTextureUnit(unsigned int textureUnit);
+			static void SetVertexArray(GLuint id);
 			static void SetViewport(const Recti& viewport);
 
 			static bool TranslateFormat(PixelFormatType pixelFormat, Format* format, FormatType target);
@@ -159,8 +190,11 @@ NAZARA_RENDERER_API extern PFNGLACTIVETEXTUREPROC            glActiveTexture;
 NAZARA_RENDERER_API extern PFNGLATTACHSHADERPROC             glAttachShader;
 NAZARA_RENDERER_API extern PFNGLBEGINCONDITIONALRENDERPROC   glBeginConditionalRender;
 NAZARA_RENDERER_API extern PFNGLBEGINQUERYPROC               glBeginQuery;
+NAZARA_RENDERER_API extern PFNGLBEGINTRANSFORMFEEDBACKPROC   glBeginTransformFeedback;
 NAZARA_RENDERER_API extern PFNGLBINDATTRIBLOCATIONPROC       glBindAttribLocation;
 NAZARA_RENDERER_API extern PFNGLBINDBUFFERPROC               glBindBuffer;
+NAZARA_RENDERER_API extern PFNGLBINDBUFFERBASEPROC           glBindBufferBase;
+NAZARA_RENDERER_API extern PFNGLBINDBUFFERRANGEPROC          glBindBufferRange;
 NAZARA_RENDERER_API extern PFNGLBINDFRAMEBUFFERPROC          glBindFramebuffer;
 NAZARA_RENDERER_API extern PFNGLBINDFRAGDATALOCATIONPROC     glBindFragDataLocation;
 NAZARA_RENDERER_API extern PFNGLBINDRENDERBUFFERPROC         glBindRenderbuffer;
@@ -171,11 +205,13 @@ NAZARA_RENDERER_API extern PFNGLBLENDFUNCPROC                glBlendFunc;
 NAZARA_RENDERER_API extern PFNGLBLENDFUNCSEPARATEPROC        glBlendFuncSeparate;
 NAZARA_RENDERER_API extern PFNGLBLITFRAMEBUFFERPROC          glBlitFramebuffer;
 NAZARA_RENDERER_API extern PFNGLBUFFERDATAPROC               glBufferData;
+NAZARA_RENDERER_API extern PFNGLBUFFERSTORAGEPROC            glBufferStorage;
 NAZARA_RENDERER_API extern PFNGLBUFFERSUBDATAPROC            glBufferSubData;
 NAZARA_RENDERER_API extern PFNGLCLEARPROC                    glClear;
 NAZARA_RENDERER_API extern PFNGLCLEARCOLORPROC               glClearColor;
 NAZARA_RENDERER_API extern PFNGLCLEARDEPTHPROC               glClearDepth;
 NAZARA_RENDERER_API extern PFNGLCLEARSTENCILPROC             glClearStencil;
+NAZARA_RENDERER_API extern PFNGLCLIENTWAITSYNCPROC           glClientWaitSync;
 NAZARA_RENDERER_API extern PFNGLCREATEPROGRAMPROC            glCreateProgram;
 NAZARA_RENDERER_API extern PFNGLCREATESHADERPROC             glCreateShader;
 NAZARA_RENDERER_API extern PFNGLCHECKFRAMEBUFFERSTATUSPROC   glCheckFramebufferStatus;
@@ -185,6 +221,7 @@ NAZARA_RENDERER_API extern PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC  glCompressedTexSubI
 NAZARA_RENDERER_API extern PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC  glCompressedTexSubImage3D;
 NAZARA_RENDERER_API extern PFNGLCULLFACEPROC                 glCullFace;
 NAZARA_RENDERER_API extern PFNGLCOMPILESHADERPROC            glCompileShader;
+NAZARA_RENDERER_API extern PFNGLCOPYIMAGESUBDATAPROC         glCopyImageSubData;
 NAZARA_RENDERER_API extern PFNGLCOPYTEXSUBIMAGE2DPROC        glCopyTexSubImage2D;
 NAZARA_RENDERER_API extern PFNGLDEBUGMESSAGECALLBACKPROC     glDebugMessageCallback;
 NAZARA_RENDERER_API extern PFNGLDEBUGMESSAGECONTROLPROC      glDebugMessageControl;
@@ -195,6 +232,7 @@ NAZARA_RENDERER_API extern PFNGLDELETEPROGRAMPROC            glDeleteProgram;
 NAZARA_RENDERER_API extern PFNGLDELETEQUERIESPROC            glDeleteQueries;
 NAZARA_RENDERER_API extern PFNGLDELETERENDERBUFFERSPROC      glDeleteRenderbuffers;
 NAZARA_RENDERER_API extern PFNGLDELETESAMPLERSPROC           glDeleteSamplers;
+NAZARA_RENDERER_API extern PFNGLDELETESYNCPROC               glDeleteSync;
 NAZARA_RENDERER_API extern PFNGLDELETESHADERPROC             glDeleteShader;
 NAZARA_RENDERER_API extern PFNGLDELETETEXTURESPROC           glDeleteTextures;
 NAZARA_RENDERER_API extern PFNGLDELETEVERTEXARRAYSPROC       glDeleteVertexArrays;
@@ -207,12 +245,16 @@ NAZARA_RENDERER_API extern PFNGLDRAWARRAYSINSTANCEDPROC      glDrawArraysInstanc
 NAZARA_RENDERER_API extern PFNGLDRAWBUFFERPROC               glDrawBuffer;
 NAZARA_RENDERER_API extern PFNGLDRAWBUFFERSPROC              glDrawBuffers;
 NAZARA_RENDERER_API extern PFNGLDRAWELEMENTSPROC             glDrawElements;
+NAZARA_RENDERER_API extern PFNGLDRAWELEMENTSBASEVERTEXPROC   glDrawElementsBaseVertex;
 NAZARA_RENDERER_API extern PFNGLDRAWELEMENTSINSTANCEDPROC    glDrawElementsInstanced;
+NAZARA_RENDERER_API extern PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glDrawElementsInstancedBaseVertex;
 NAZARA_RENDERER_API extern PFNGLDRAWTEXTURENVPROC            glDrawTexture;
 NAZARA_RENDERER_API extern PFNGLENABLEPROC                   glEnable;
 NAZARA_RENDERER_API extern PFNGLENABLEVERTEXATTRIBARRAYPROC  glEnableVertexAttribArray;
 NAZARA_RENDERER_API extern PFNGLENDCONDITIONALRENDERPROC     glEndConditionalRender;
 NAZARA_RENDERER_API extern PFNGLENDQUERYPROC                 glEndQuery;
+NAZARA_RENDERER_API extern PFNGLENDTRANSFORMFEEDBACKPROC     glEndTransformFeedback;
+NAZARA_RENDERER_API extern PFNGLFENCESYNCPROC                glFenceSync;
 NAZARA_RENDERER_API extern PFNGLFLUSHPROC                    glFlush;
 NAZARA_RENDERER_API extern PFNGLFRAMEBUFFERRENDERBUFFERPROC  glFramebufferRenderbuffer;
 NAZARA_RENDERER_API extern PFNGLFRAMEBUFFERTEXTUREPROC       glFramebufferTexture;
@@ -240,6 +282,7 @@ NAZARA_RENDERER_API extern PFNGLGETPROGRAMIVPROC             glGetProgramiv;
 NAZARA_RENDERER_API extern PFNGLGETPROGRAMINFOLOGPROC        glGetProgramInfoLog;
 NAZARA_RENDERER_API extern PFNGLGETQUERYIVPROC               glGetQueryiv;
 NAZARA_RENDERER_API extern PFNGLGETQUERYOBJECTIVPROC         glGetQueryObjectiv;
+NAZARA_RENDERER_API extern PFNGLGETQUERYOBJECTUI64VPROC      glGetQueryObjectui64v;
 NAZARA_RENDERER_API extern PFNGLGETQUERYOBJECTUIVPROC        glGetQueryObjectuiv;
 NAZARA_RENDERER_API extern PFNGLGETSHADERINFOLOGPROC         glGetShaderInfoLog;
 NAZARA_RENDERER_API extern PFNGLGETSHADERIVPROC              glGetShaderiv;
@@ -251,6 +294,8 @@ NAZARA_RENDERER_API extern PFNGLGETTEXLEVELPARAMETERFVPROC   glGetTexLevelParame
 NAZARA_RENDERER_API extern PFNGLGETTEXLEVELPARAMETERIVPROC   glGetTexLevelParameteriv;
 NAZARA_RENDERER_API extern PFNGLGETTEXPARAMETERFVPROC        glGetTexParameterfv;
 NAZARA_RENDERER_API extern PFNGLGETTEXPARAMETERIVPROC        glGetTexParameteriv;
+NAZARA_RENDERER_API extern PFNGLGETTEXTURESAMPLERHANDLEARBPROC glGetTextureSamplerHandleARB;
+NAZARA_RENDERER_API extern PFNGLGETUNIFORMBLOCKINDEXPROC     glGetUniformBlockIndex;
 NAZARA_RENDERER_API extern PFNGLGETUNIFORMFVPROC             glGetUniformfv;
 NAZARA_RENDERER_API extern PFNGLGETUNIFORMIVPROC             glGetUniformiv;
 NAZARA_RENDERER_API extern PFNGLGETUNIFORMLOCATIONPROC       glGetUniformLocation;
@@ -258,8 +303,12 @@ NAZARA_RENDERER_API extern PFNGLINVALIDATEBUFFERDATAPROC     glInvalidateBufferD
 NAZARA_RENDERER_API extern PFNGLISENABLEDPROC                glIsEnabled;
 NAZARA_RENDERER_API extern PFNGLLINEWIDTHPROC                glLineWidth;
 NAZARA_RENDERER_API extern PFNGLLINKPROGRAMPROC              glLinkProgram;
+NAZARA_RENDERER_API extern PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC glMakeTextureHandleNonResidentARB;
+NAZARA_RENDERER_API extern PFNGLMAKETEXTUREHANDLERESIDENTARBPROC glMakeTextureHandleResidentARB;
 NAZARA_RENDERER_API extern PFNGLMAPBUFFERPROC                glMapBuffer;
 NAZARA_RENDERER_API extern PFNGLMAPBUFFERRANGEPROC           glMapBufferRange;
+NAZARA_RENDERER_API extern PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glMaxShaderCompilerThreadsKHR;
+NAZARA_RENDERER_API extern PFNGLMULTIDRAWELEMENTSINDIRECTPROC glMultiDrawElementsIndirect;
 NAZARA_RENDERER_API extern PFNGLPIXELSTOREIPROC              glPixelStorei;
 NAZARA_RENDERER_API extern PFNGLPOINTSIZEPROC                glPointSize;
 NAZARA_RENDERER_API extern PFNGLPOLYGONMODEPROC              glPolygonMode;
@@ -282,6 +331,7 @@ NAZARA_RENDERER_API extern PFNGLPROGRAMUNIFORM4FVPROC        glProgramUniform4fv
 NAZARA_RENDERER_API extern PFNGLPROGRAMUNIFORM4IVPROC        glProgramUniform4iv;
 NAZARA_RENDERER_API extern PFNGLPROGRAMUNIFORMMATRIX4DVPROC  glProgramUniformMatrix4dv;
 NAZARA_RENDERER_API extern PFNGLPROGRAMUNIFORMMATRIX4FVPROC  glProgramUniformMatrix4fv;
+NAZARA_RENDERER_API extern PFNGLQUERYCOUNTERPROC             glQueryCounter;
 NAZARA_RENDERER_API extern PFNGLREADPIXELSPROC               glReadPixels;
 NAZARA_RENDERER_API extern PFNGLRENDERBUFFERSTORAGEPROC      glRenderbufferStorage;
 NAZARA_RENDERER_API extern PFNGLSAMPLERPARAMETERFPROC        glSamplerParameterf;
@@ -303,6 +353,7 @@ NAZARA_RENDERER_API extern PFNGLTEXSTORAGE3DPROC             glTexStorage3D;
 NAZARA_RENDERER_API extern PFNGLTEXSUBIMAGE1DPROC            glTexSubImage1D;
 NAZARA_RENDERER_API extern PFNGLTEXSUBIMAGE2DPROC            glTexSubImage2D;
 NAZARA_RENDERER_API extern PFNGLTEXSUBIMAGE3DPROC            glTexSubImage3D;
+NAZARA_RENDERER_API extern PFNGLTRANSFORMFEEDBACKVARYINGSPROC glTransformFeedbackVaryings;
 NAZARA_RENDERER_API extern PFNGLUNIFORM1DPROC                glUniform1d;
 NAZARA_RENDERER_API extern PFNGLUNIFORM1FPROC                glUniform1f;
 NAZARA_RENDERER_API extern PFNGLUNIFORM1IPROC                glUniform1i;
@@ -319,6 +370,7 @@ NAZARA_RENDERER_API extern PFNGLUNIFORM4DVPROC               glUniform4dv;
 NAZARA_RENDERER_API extern PFNGLUNIFORM4FVPROC               glUniform4fv;
 NAZARA_RENDERER_API extern PFNGLUNIFORM4IVPROC               glUniform4iv;
 NAZARA_RENDERER_API extern PFNGLUNIFORMMATRIX4DVPROC         glUniformMatrix4dv;
+NAZARA_RENDERER_API extern PFNGLUNIFORMBLOCKBINDINGPROC      glUniformBlockBinding;
 NAZARA_RENDERER_API extern PFNGLUNIFORMMATRIX4FVPROC         glUniformMatrix4fv;
 NAZARA_RENDERER_API extern PFNGLUNMAPBUFFERPROC              glUnmapBuffer;
 NAZARA_RENDERER_API extern PFNGLUSEPROGRAMPROC               glUseProgram;
@@ -0,0 +1,28 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Renderer module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_RENDERSTATISTICS_HPP
+#define NAZARA_RENDERSTATISTICS_HPP
+
+#include <Nazara/Prerequisites.hpp>
+
+namespace Nz
+{
+	struct RenderStatistics
+	{
+		UInt64 uploadedBytes = 0;             //< Bytes written to buffers and textures
+		unsigned int bufferBindings = 0;      //< glBindBuffer and glBindBufferRange calls
+		unsigned int drawCalls = 0;
+		unsigned int programBindings = 0;
+		unsigned int redundantBindings = 0;   //< Bindings and states filtered because they were already current
+		unsigned int renderStateChanges = 0;  //< Blending, depth, stencil, culling, scissor and viewport calls
+		unsigned int samplerBindings = 0;
+		unsigned int textureBindings = 0;     //< glBindTexture calls (glActiveTexture calls are not counted)
+		unsigned int vertexArrayBindings = 0;
+	};
+}
+
+#endif // NAZARA_RENDERSTATISTICS_HPP
@@ -0,0 +1,69 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Renderer module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_RENDERTARGETPOOL_HPP
+#define NAZARA_RENDERTARGETPOOL_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Renderer/Config.hpp>
+#include <Nazara/Renderer/RenderBuffer.hpp>
+#include <Nazara/Renderer/Texture.hpp>
+#include <Nazara/Utility/Enums.hpp>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_RENDERER_API RenderTargetPool
+	{
+		public:
+			RenderTargetPool(unsigned int maxUnusedFrames = 2);
+			RenderTargetPool(const RenderTargetPool&) = delete;
+			RenderTargetPool(RenderTargetPool&&) = delete;
+			~RenderTargetPool() = default;
+
+			RenderBufferRef AcquireBuffer(PixelFormatType format, unsigned int width, unsigned int height);
+			TextureRef AcquireTexture(PixelFormatType format, unsigned int width, unsigned int height);
+
+			void Clear();
+
+			void EndFrame();
+
+			std::size_t GetAcquiredCount() const;
+			UInt64 GetMemoryUsage() const;
+			unsigned int GetMaxUnusedFrames() const;
+			std::size_t GetResourceCount() const;
+
+			void Release(const RenderBuffer* buffer);
+			void Release(const Texture* texture);
+
+			void SetMaxUnusedFrames(unsigned int maxUnusedFrames);
+
+			RenderTargetPool& operator=(const RenderTargetPool&) = delete;
+			RenderTargetPool& operator=(RenderTargetPool&&) = delete;
+
+		private:
+			template<typename T> struct Entry
+			{
+				ObjectRef<T> resource;
+				PixelFormatType format;
+				UInt64 lastUsedFrame;
+				unsigned int height;
+				unsigned int width;
+				bool acquired;
+			};
+
+			template<typename T> Entry<T>* FindFreeEntry(std::vector<Entry<T>>& entries, PixelFormatType format, unsigned int width, unsigned int height);
+			template<typename T> void ReleaseEntry(std::vector<Entry<T>>& entries, const T* resource);
+			template<typename T> void TrimEntries(std::vector<Entry<T>>& entries);
+
+			std::vector<Entry<RenderBuffer>> m_buffers;
+			std::vector<Entry<Texture>> m_textures;
+			UInt64 m_currentFrame;
+			unsigned int m_maxUnusedFrames;
+	};
+}
+
+#endif // NAZARA_RENDERTARGETPOOL_HPP
@@ -0,0 +1,53 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Renderer module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_RENDERTHREAD_HPP
+#define NAZARA_RENDERTHREAD_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/ConditionVariable.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/Thread.hpp>
+#include <Nazara/Renderer/Config.hpp>
+#include <deque>
+#include <functional>
+
+namespace Nz
+{
+	class NAZARA_RENDERER_API RenderThread
+	{
+		public:
+			using FrameFunction = std::function<void()>;
+
+			RenderThread(unsigned int pipelineDepth = 1);
+			RenderThread(const RenderThread&) = delete;
+			RenderThread(RenderThread&&) = delete;
+			~RenderThread();
+
+			unsigned int GetPendingFrameCount() const;
+			unsigned int GetPipelineDepth() const;
+
+			void Submit(FrameFunction frame);
+			void Synchronize();
+
+			RenderThread& operator=(const RenderThread&) = delete;
+			RenderThread& operator=(RenderThread&&) = delete;
+
+		private:
+			void ThreadMain();
+
+			std::deque<FrameFunction> m_frames;
+			ConditionVariable m_frameDone;
+			ConditionVariable m_frameQueued;
+			mutable Mutex m_mutex;
+			Thread m_thread;
+			unsigned int m_pendingFrameCount; //< Queued frames and the one being rendered
+			unsigned int m_pipelineDepth;
+			bool m_running;
+	};
+}
+
+#endif // NAZARA_RENDERTHREAD_HPP
@@ -11,12 +11,14 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/FramePacer.hpp>
 #include <Nazara/Math/Rect.hpp>
 #include <Nazara/Math/Vector3.hpp>
 #include <Nazara/Renderer/Config.hpp>
 #include <Nazara/Renderer/ContextParameters.hpp>
 #include <Nazara/Renderer/RenderTarget.hpp>
 #include <Nazara/Platform/Window.hpp>
+#include <deque>
 #include <vector>
 
 namespace Nz
@@ -42,14 +44,21 @@ namespace Nz
 
 			void Display();
 
-			void EnableVerticalSync(bool enabled);
+			void EnableVerticalSync(bool enabled, bool adaptive = false);
 
+			const FramePacer::Statistics& GetFrameStatistics() const;
+			unsigned int GetFramerateLimit() const;
 			RenderTargetParameters GetParameters() const override;
+			std::size_t GetQueuedCopyCount() const;
 			Vector2ui GetSize() const override;
 
 			bool IsRenderable() const override;
 			bool IsValid() const;
 
+			bool QueueCopy(const Rectui& rect) const;
+
+			bool RetrieveCopy(AbstractImage* image, const Vector3ui& dstPos = Vector3ui(0U), bool wait = false) const;
+
 			void SetFramerateLimit(unsigned int limit);
 
 			// Fonctions OpenGL
@@ -67,11 +76,27 @@ namespace Nz
 			void OnWindowResized() override;
 
 		private:
+			void ReleaseCopies();
+
+			struct CopyBuffer
+			{
+				unsigned int id;
+				UInt32 size;
+			};
+
+			struct QueuedCopy
+			{
+				CopyBuffer buffer;
+				Rectui rect;
+				void* fence; //< GLsync signaled once the pixels are in the buffer
+			};
+
+			mutable std::deque<QueuedCopy> m_queuedCopies;
+			mutable std::vector<CopyBuffer> m_copyBuffers;
 			mutable std::vector<UInt8> m_buffer;
-			Clock m_clock;
 			ContextParameters m_parameters;
+			FramePacer m_framePacer;
 			mutable Context* m_context = nullptr;
-			unsigned int m_framerateLimit = 0;
 	};
 }
 
@@ -16,12 +16,15 @@
 
 namespace Nz
 {
+	class Buffer;
 	class Color;
+	class CommandBuffer;
 	class Context;
 	class GpuQuery;
 	class IndexBuffer;
 	class RenderTarget;
 	struct RenderStates;
+	struct RenderStatistics;
 	class Shader;
 	class Texture;
 	class TextureSampler;
@@ -36,26 +39,43 @@ namespace Nz
 			using DrawCall = void (*)(PrimitiveMode, unsigned int, unsigned int);
 			using DrawCallInstanced = void (*)(unsigned int, PrimitiveMode, unsigned int, unsigned int);
 
+			// Layout expected by DrawIndexedPrimitivesIndirect, the first index and base vertex being relative to the start of the bound buffers
+			struct DrawIndexedIndirectCommand
+			{
+				UInt32 indexCount;
+				UInt32 instanceCount;
+				UInt32 firstIndex;
+				Int32 baseVertex;
+				UInt32 baseInstance;
+			};
+
 			Renderer() = delete;
 			~Renderer() = delete;
 
 			static void BeginCondition(const GpuQuery& query, GpuQueryCondition condition);
 
+			static void CapturePrimitives(PrimitiveMode mode, unsigned int firstVertex, unsigned int vertexCount, const Buffer* buffer, UInt32 offset = 0);
 			static void Clear(UInt32 flags = RendererBuffer_Color | RendererBuffer_Depth);
 
 			static void DrawFullscreenQuad();
 			static void DrawIndexedPrimitives(PrimitiveMode mode, unsigned int firstIndex, unsigned int indexCount);
+			static void DrawIndexedPrimitives(PrimitiveMode mode, unsigned int firstIndex, unsigned int indexCount, unsigned int baseVertex);
+			static void DrawIndexedPrimitivesIndirect(PrimitiveMode mode, const Buffer* commandBuffer, UInt32 offset, unsigned int drawCount);
 			static void DrawIndexedPrimitivesInstanced(unsigned int instanceCount, PrimitiveMode mode, unsigned int firstIndex, unsigned int indexCount);
 			static void DrawPrimitives(PrimitiveMode mode, unsigned int firstVertex, unsigned int vertexCount);
 			static void DrawPrimitivesInstanced(unsigned int instanceCount, PrimitiveMode mode, unsigned int firstVertex, unsigned int vertexCount);
 
 			static void Enable(RendererParameter parameter, bool enable);
+			static void EnableDrawSubmission(bool drawSubmission);
 
 			static void EndCondition();
 
+			static void Execute(const CommandBuffer& commandBuffer);
+
 			static void Flush();
 
 			static RendererComparison GetDepthFunc();
+			static Buffer* GetIndirectBuffer();
 			static VertexBuffer* GetInstanceBuffer();
 			static float GetLineWidth();
 			static Matrix4f GetMatrix(MatrixType type);
@@ -69,7 +89,9 @@ namespace Nz
 			static const RenderStates& GetRenderStates();
 			static Recti GetScissorRect();
 			static const Shader* GetShader();
+			static const RenderStatistics& GetStatistics();
 			static const RenderTarget* GetTarget();
+			static const VertexBuffer* GetVertexBuffer();
 			static Recti GetViewport();
 
 			static bool HasCapability(RendererCap capability);
@@ -77,9 +99,12 @@ namespace Nz
 			static bool Initialize();
 
 			static bool IsComponentTypeSupported(ComponentType type);
+			static bool IsDrawSubmissionEnabled();
 			static bool IsEnabled(RendererParameter parameter);
 			static bool IsInitialized();
 
+			static void ResetStatistics();
+
 			static void SetBlendFunc(BlendFunc srcBlend, BlendFunc dstBlend);
 			static void SetClearColor(const Color& color);
 			static void SetClearColor(UInt8 r, UInt8 g, UInt8 b, UInt8 a = 255);
@@ -89,6 +114,7 @@ namespace Nz
 			static void SetFaceCulling(FaceSide faceSide);
 			static void SetFaceFilling(FaceFilling fillingMode);
 			static void SetIndexBuffer(const IndexBuffer* indexBuffer);
+			static void SetInstanceBuffer(const VertexBuffer* instanceBuffer);
 			static void SetLineWidth(float size);
 			static void SetMatrix(MatrixType type, const Matrix4f& matrix);
 			static void SetPointSize(float size);
@@ -104,6 +130,7 @@ namespace Nz
 			static bool SetTarget(const RenderTarget* target);
 			static void SetTexture(unsigned int unit, const Texture* texture);
 			static void SetTextureSampler(unsigned int textureUnit, const TextureSampler& sampler);
+			static void SetUniformBuffer(unsigned int bindingIndex, const Buffer* buffer, UInt32 offset = 0, UInt32 size = 0);
 			static void SetVertexBuffer(const VertexBuffer* vertexBuffer);
 			static void SetViewport(const Recti& viewport);
 
@@ -113,11 +140,10 @@ namespace Nz
 			static void EnableInstancing(bool instancing);
 			static bool EnsureStateUpdate();
 			static bool GenerateDebugShader();
+			static void OnBufferDestroy(const Buffer* buffer);
 			static void OnContextRelease(const Context* context);
-			static void OnIndexBufferRelease(const IndexBuffer* indexBuffer);
 			static void OnShaderReleased(const Shader* shader);
 			static void OnTextureReleased(const Texture* texture);
-			static void OnVertexBufferRelease(const VertexBuffer* vertexBuffer);
 			static void OnVertexDeclarationRelease(const VertexDeclaration* vertexDeclaration);
 			static void UpdateMatrix(MatrixType type);
 
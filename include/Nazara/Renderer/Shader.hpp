@@ -9,6 +9,7 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/Name.hpp>
 #include <Nazara/Core/ObjectLibrary.hpp>
 #include <Nazara/Core/ObjectRef.hpp>
 #include <Nazara/Core/RefCounted.hpp>
@@ -20,6 +21,7 @@
 #include <Nazara/Math/Vector4.hpp>
 #include <Nazara/Renderer/Config.hpp>
 #include <Nazara/Renderer/Enums.hpp>
+#include <unordered_map>
 
 namespace Nz
 {
@@ -55,16 +57,19 @@ namespace Nz
 			ByteArray GetBinary() const;
 			String GetLog() const;
 			String GetSourceCode(ShaderStageType stage) const;
-			int GetUniformLocation(const String& name) const;
+			int GetUniformBlockIndex(const String& name) const;
+			int GetUniformLocation(const Name& name) const;
 			int GetUniformLocation(ShaderUniform shaderUniform) const;
 
 			bool HasStage(ShaderStageType stage) const;
 
 			bool IsBinaryRetrievable() const;
 			bool IsLinked() const;
+			bool IsLinking() const;
 			bool IsValid() const;
 
 			bool Link();
+			bool LinkAsync();
 
 			bool LoadFromBinary(const void* buffer, unsigned int size);
 			bool LoadFromBinary(const ByteArray& byteArray);
@@ -79,6 +84,7 @@ namespace Nz
 			void SendIntegerArray(int location, const int* values, unsigned int count) const;
 			void SendMatrix(int location, const Matrix4d& matrix) const;
 			void SendMatrix(int location, const Matrix4f& matrix) const;
+			void SendMatrixArray(int location, const Matrix4f* matrices, unsigned int count) const;
 			void SendVector(int location, const Vector2d& vector) const;
 			void SendVector(int location, const Vector2f& vector) const;
 			void SendVector(int location, const Vector2i& vector) const;
@@ -98,6 +104,9 @@ namespace Nz
 			void SendVectorArray(int location, const Vector4f* vectors, unsigned int count) const;
 			void SendVectorArray(int location, const Vector4i* vectors, unsigned int count) const;
 
+			void SetTransformFeedbackVaryings(const char* const* varyings, unsigned int varyingCount);
+			void SetUniformBlockBinding(int blockIndex, unsigned int bindingIndex) const;
+
 			bool Validate() const;
 
 			// Fonctions OpenGL
@@ -122,7 +131,9 @@ namespace Nz
 
 			std::vector<unsigned int> m_attachedShaders[ShaderStageType_Max+1];
 			bool m_linked;
+			bool m_linkPending;
 			int m_uniformLocations[ShaderUniform_Max+1];
+			mutable std::unordered_map<UInt64, int> m_namedUniformLocations;
 			unsigned int m_program;
 
 			static ShaderLibrary::LibraryMap s_library;
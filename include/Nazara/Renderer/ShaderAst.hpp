@@ -37,6 +37,7 @@ namespace Nz
 
 		enum class BuiltinEntry
 		{
+			FragmentDepth,  // gl_FragDepth
 			VertexPosition, // gl_Position
 		};
 
@@ -48,6 +49,8 @@ namespace Nz
 			Float3,  // vec3
 			Float4,  // vec4
 			Mat4x4,  // mat4
+			Sampler2D,   // sampler2D
+			SamplerCube, // samplerCube
 
 			Void     // void
 		};
@@ -271,6 +274,19 @@ namespace Nz
 				} values;
 		};
 
+		class NAZARA_RENDERER_API Sample : public Expression
+		{
+			public:
+				inline Sample(ExpressionPtr samplerPtr, ExpressionPtr coordinatesPtr);
+
+				ExpressionType GetExpressionType() const override;
+				void Register(ShaderWriter& visitor) override;
+				void Visit(ShaderWriter& visitor) override;
+
+				ExpressionPtr sampler;
+				ExpressionPtr coordinates;
+		};
+
 		class NAZARA_RENDERER_API SwizzleOp : public Expression
 		{
 			public:
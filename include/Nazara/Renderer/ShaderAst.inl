@@ -204,6 +204,38 @@ namespace Nz
 			values.vec4 = value;
 		}
 
+		inline Sample::Sample(ExpressionPtr samplerPtr, ExpressionPtr coordinatesPtr) :
+		sampler(std::move(samplerPtr)),
+		coordinates(std::move(coordinatesPtr))
+		{
+			ExpressionType coordinatesType = coordinates->GetExpressionType();
+
+			switch (sampler->GetExpressionType())
+			{
+				case ExpressionType::Sampler2D:
+				{
+					if (coordinatesType != ExpressionType::Float2)
+						//TODO: AstParseError
+						throw std::runtime_error("2D samplers must be sampled with two-component coordinates");
+
+					break;
+				}
+
+				case ExpressionType::SamplerCube:
+				{
+					if (coordinatesType != ExpressionType::Float3)
+						//TODO: AstParseError
+						throw std::runtime_error("Cube samplers must be sampled with three-component coordinates");
+
+					break;
+				}
+
+				default:
+					//TODO: AstParseError
+					throw std::runtime_error("Only samplers can be sampled");
+			}
+		}
+
 		inline SwizzleOp::SwizzleOp(ExpressionPtr expressionPtr, std::initializer_list<SwizzleComponent> swizzleComponents) :
 		componentCount(swizzleComponents.size()),
 		expression(expressionPtr)
@@ -0,0 +1,50 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Renderer module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_SHADERASTOPTIMIZER_HPP
+#define NAZARA_SHADERASTOPTIMIZER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Renderer/Config.hpp>
+#include <Nazara/Renderer/ShaderAst.hpp>
+#include <array>
+
+namespace Nz
+{
+	class ShaderWriter;
+
+	class NAZARA_RENDERER_API ShaderAstOptimizer
+	{
+		public:
+			ShaderAstOptimizer();
+			ShaderAstOptimizer(const ShaderAstOptimizer&) = delete;
+			ShaderAstOptimizer(ShaderAstOptimizer&&) = delete;
+			~ShaderAstOptimizer() = default;
+
+			ShaderAst::ExpressionPtr Optimize(const ShaderAst::ExpressionPtr& expression);
+			ShaderAst::StatementPtr Optimize(const ShaderAst::StatementPtr& statement, const ShaderWriter& writer);
+
+			ShaderAstOptimizer& operator=(const ShaderAstOptimizer&) = delete;
+			ShaderAstOptimizer& operator=(ShaderAstOptimizer&&) = delete;
+
+		private:
+			using FloatValues = std::array<float, 4>;
+
+			ShaderAst::ExpressionPtr OptimizeBinaryOp(const std::shared_ptr<ShaderAst::BinaryOp>& node);
+			ShaderAst::ExpressionPtr OptimizeCast(const std::shared_ptr<ShaderAst::Cast>& node);
+			ShaderAst::ExpressionPtr OptimizeSwizzleOp(const std::shared_ptr<ShaderAst::SwizzleOp>& node);
+			ShaderAst::StatementPtr OptimizeBranch(const std::shared_ptr<ShaderAst::Branch>& node);
+			ShaderAst::StatementPtr OptimizeStatement(const ShaderAst::StatementPtr& statement);
+
+			static ShaderAst::ExpressionPtr BuildConstant(ShaderAst::ExpressionType type, const FloatValues& values);
+			static unsigned int GetFloatValues(const ShaderAst::Constant& constant, FloatValues* values);
+			static bool IsConstantValue(const ShaderAst::ExpressionPtr& expression, float value);
+
+			const ShaderWriter* m_writer;
+	};
+}
+
+#endif // NAZARA_SHADERASTOPTIMIZER_HPP
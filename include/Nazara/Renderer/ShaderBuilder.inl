@@ -32,6 +32,10 @@ namespace Nz { namespace ShaderBuilder
 
 		switch (builtin)
 		{
+			case ShaderAst::BuiltinEntry::FragmentDepth:
+				exprType = ShaderAst::ExpressionType::Float1;
+				break;
+
 			case ShaderAst::BuiltinEntry::VertexPosition:
 				exprType = ShaderAst::ExpressionType::Float4;
 				break;
@@ -24,6 +24,7 @@ namespace Nz
 			~ShaderStage();
 
 			bool Compile();
+			bool CompileAsync();
 
 			bool Create(ShaderStageType stage);
 			void Destroy();
@@ -31,6 +32,7 @@ namespace Nz
 			String GetLog() const;
 			String GetSource() const;
 
+			bool IsCompilationPending() const;
 			bool IsCompiled() const;
 			bool IsValid() const;
 
@@ -48,6 +50,7 @@ namespace Nz
 
 		private:
 			ShaderStageType m_stage;
+			bool m_compilationPending;
 			bool m_compiled;
 			unsigned int m_id;
 	};
@@ -41,6 +41,7 @@ namespace Nz
 			virtual void Write(const ShaderAst::ExpressionStatement& node) = 0;
 			virtual void Write(const ShaderAst::NamedVariable& node) = 0;
 			virtual void Write(const ShaderAst::NodePtr& node) = 0;
+			virtual void Write(const ShaderAst::Sample& node) = 0;
 			virtual void Write(const ShaderAst::StatementBlock& node) = 0;
 			virtual void Write(const ShaderAst::SwizzleOp& node) = 0;
 
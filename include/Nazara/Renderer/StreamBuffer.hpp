@@ -0,0 +1,55 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Renderer module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_STREAMBUFFER_HPP
+#define NAZARA_STREAMBUFFER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Renderer/Config.hpp>
+#include <Nazara/Utility/Buffer.hpp>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_RENDERER_API StreamBuffer
+	{
+		public:
+			StreamBuffer(BufferType type);
+			StreamBuffer(BufferType type, UInt32 size, unsigned int segmentCount = 3);
+			StreamBuffer(const StreamBuffer&) = delete;
+			StreamBuffer(StreamBuffer&&) = delete;
+			~StreamBuffer();
+
+			bool Create(UInt32 size, unsigned int segmentCount = 3);
+			void Destroy();
+
+			inline Buffer* GetBuffer();
+			inline const Buffer* GetBuffer() const;
+			inline unsigned int GetSegmentCount() const;
+			inline UInt32 GetSegmentSize() const;
+
+			inline bool IsValid() const;
+
+			void* Map(UInt32 size, UInt32 alignment, UInt32* offset);
+			void Unmap();
+
+			StreamBuffer& operator=(const StreamBuffer&) = delete;
+			StreamBuffer& operator=(StreamBuffer&&) = delete;
+
+		private:
+			void NextSegment();
+
+			std::vector<void*> m_fences; //< GLsync of each segment, set from the moment the GPU may read it
+			Buffer m_buffer;
+			UInt32 m_cursor;
+			UInt32 m_segmentSize;
+			unsigned int m_currentSegment;
+	};
+}
+
+#include <Nazara/Renderer/StreamBuffer.inl>
+
+#endif // NAZARA_STREAMBUFFER_HPP
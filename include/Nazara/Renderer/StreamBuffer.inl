@@ -0,0 +1,55 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Renderer module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Renderer/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the buffer holding the streamed data
+	* \return Underlying buffer, offsets returned by Map are relative to its beginning
+	*/
+	inline Buffer* StreamBuffer::GetBuffer()
+	{
+		return &m_buffer;
+	}
+
+	/*!
+	* \brief Gets the buffer holding the streamed data
+	* \return Underlying buffer, offsets returned by Map are relative to its beginning
+	*/
+	inline const Buffer* StreamBuffer::GetBuffer() const
+	{
+		return &m_buffer;
+	}
+
+	/*!
+	* \brief Gets the number of segments the buffer is split into
+	* \return Number of segments
+	*/
+	inline unsigned int StreamBuffer::GetSegmentCount() const
+	{
+		return static_cast<unsigned int>(m_fences.size());
+	}
+
+	/*!
+	* \brief Gets the size of a segment
+	* \return Size of a segment, in bytes, which is the maximum size of a single mapping
+	*/
+	inline UInt32 StreamBuffer::GetSegmentSize() const
+	{
+		return m_segmentSize;
+	}
+
+	/*!
+	* \brief Checks whether the buffer is valid
+	* \return true if the buffer was created
+	*/
+	inline bool StreamBuffer::IsValid() const
+	{
+		return m_buffer.IsValid();
+	}
+}
+
+#include <Nazara/Renderer/DebugOff.hpp>
@@ -17,10 +17,12 @@
 #include <Nazara/Utility/AbstractImage.hpp>
 #include <Nazara/Utility/CubemapParams.hpp>
 #include <Nazara/Utility/Image.hpp>
+#include <functional>
 
 namespace Nz
 {
 	class Texture;
+	class TextureSampler;
 
 	using TextureConstRef = ObjectRef<const Texture>;
 	using TextureLibrary = ObjectLibrary<Texture>;
@@ -34,6 +36,7 @@ namespace Nz
 		friend TextureLibrary;
 		friend TextureManager;
 		friend class Renderer;
+		friend class TextureUploadQueue;
 
 		public:
 			Texture() = default;
@@ -43,6 +46,7 @@ namespace Nz
 			Texture(Texture&&) = delete;
 			~Texture();
 
+			bool Copy(const Texture* source, const Boxui& srcBox, const Vector3ui& dstPos = Vector3ui(0, 0, 0), UInt8 level = 0);
 			bool Create(ImageType type, PixelFormatType format, unsigned int width, unsigned int height, unsigned int depth = 1, UInt8 levelCount = 1);
 			void Destroy();
 
@@ -105,6 +109,7 @@ namespace Nz
 			bool Update(const UInt8* pixels, const Rectui& rect, unsigned int z = 0, unsigned int srcWidth = 0, unsigned int srcHeight = 0, UInt8 level = 0) override;
 
 			// Fonctions OpenGL
+			UInt64 GetBindlessHandle(const TextureSampler& sampler) const;
 			unsigned int GetOpenGLID() const;
 
 			Texture& operator=(const Texture&) = delete;
@@ -113,7 +118,9 @@ namespace Nz
 			static bool IsFormatSupported(PixelFormatType format);
 			static bool IsMipmappingSupported();
 			static bool IsTypeSupported(ImageType type);
+			static ResourceFuture<Texture> LoadAsync(const String& filePath, const ImageParams& params = ImageParams(), bool generateMipmaps = true);
 			template<typename... Args> static TextureRef New(Args&&... args);
+			static ResourceFuture<Texture> ReloadAsync(const TextureRef& texture, const String& filePath, const ImageParams& params = ImageParams(), bool generateMipmaps = true);
 
 			// Signals:
 			NazaraSignal(OnTextureDestroy, const Texture* /*texture*/);
@@ -121,8 +128,10 @@ namespace Nz
 
 		private:
 			bool CreateTexture(bool proxy);
+			bool UploadPixels(const void* pixels, const Boxui& box, unsigned int srcWidth, unsigned int srcHeight, UInt8 level);
 
 			static bool Initialize();
+			static void StartUpload(Texture& texture, const ImageRef& image, bool generateMipmaps, std::function<void(bool succeeded)> completion);
 			static void Uninitialize();
 
 			TextureImpl* m_impl = nullptr;
@@ -18,6 +18,7 @@ namespace Nz
 	class NAZARA_RENDERER_API TextureSampler
 	{
 		friend class Renderer;
+		friend class Texture;
 
 		public:
 			TextureSampler();
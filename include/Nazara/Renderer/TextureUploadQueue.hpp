@@ -0,0 +1,55 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Renderer module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_TEXTUREUPLOADQUEUE_HPP
+#define NAZARA_TEXTUREUPLOADQUEUE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Renderer/Config.hpp>
+#include <Nazara/Renderer/Texture.hpp>
+#include <Nazara/Utility/Image.hpp>
+#include <functional>
+
+namespace Nz
+{
+	class NAZARA_RENDERER_API TextureUploadQueue
+	{
+		friend class Renderer;
+
+		public:
+			using UploadCallback = std::function<void(Texture* texture, bool succeeded)>;
+
+			TextureUploadQueue() = delete;
+			~TextureUploadQueue() = delete;
+
+			static void Clear();
+
+			static void Enqueue(TextureRef texture, ImageConstRef image, UploadCallback callback = UploadCallback());
+
+			static void Flush(const Texture* texture = nullptr);
+
+			static UInt64 GetFrameBudget();
+			static std::size_t GetPendingCount();
+
+			static bool HasPendingUploads(const Texture* texture);
+
+			static std::size_t Process();
+
+			static void SetFrameBudget(UInt64 budget);
+
+		private:
+			struct State;
+			struct Upload;
+
+			static State& GetState();
+			static bool Initialize();
+			static void IssueChunks(Upload& upload, UInt64 budget, UInt64* uploadedBytes);
+			static std::size_t PollFences(const Texture* texture, bool wait);
+			static void Uninitialize();
+	};
+}
+
+#endif // NAZARA_TEXTUREUPLOADQUEUE_HPP
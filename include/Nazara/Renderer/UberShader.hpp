@@ -36,6 +36,7 @@ namespace Nz
 			virtual ~UberShader();
 
 			virtual UberShaderInstance* Get(const ParameterList& parameters) const = 0;
+			virtual UberShaderInstance* TryGet(const ParameterList& parameters) const;
 
 			UberShader& operator=(const UberShader&) = delete;
 			UberShader& operator=(UberShader&&) = delete;
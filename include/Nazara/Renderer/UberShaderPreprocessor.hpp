@@ -9,11 +9,13 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Renderer/Enums.hpp>
+#include <Nazara/Core/Name.hpp>
 #include <Nazara/Core/ObjectRef.hpp>
 #include <Nazara/Renderer/ShaderStage.hpp>
 #include <Nazara/Renderer/UberShader.hpp>
 #include <Nazara/Renderer/UberShaderInstancePreprocessor.hpp>
 #include <unordered_map>
+#include <vector>
 
 namespace Nz
 {
@@ -30,12 +32,15 @@ namespace Nz
 			~UberShaderPreprocessor();
 
 			UberShaderInstance* Get(const ParameterList& parameters) const override;
+			UberShaderInstance* TryGet(const ParameterList& parameters) const override;
 
 			void SetShader(ShaderStageType stage, const String& source, const String& shaderFlags, const String& requiredFlags = String());
 			bool SetShaderFromFile(ShaderStageType stage, const String& filePath, const String& shaderFlags, const String& requiredFlags = String());
 
+			static const String& GetCacheDirectory();
 			static bool IsSupported();
 			template<typename... Args> static UberShaderPreprocessorRef New(Args&&... args);
+			static void SetCacheDirectory(const String& directoryPath);
 
 			// Signals:
 			NazaraSignal(OnUberShaderPreprocessorRelease, const UberShaderPreprocessor* /*uberShaderPreprocessor*/);
@@ -44,15 +49,33 @@ namespace Nz
 			struct CachedShader
 			{
 				mutable std::unordered_map<UInt32, ShaderStage> cache;
-				std::unordered_map<String, UInt32> flags;
+				std::unordered_map<Name, UInt32> flags;
 				UInt32 requiredFlags;
 				String source;
 				bool present = false;
 			};
 
+			struct PendingInstance
+			{
+				ShaderRef shader;
+				String cacheFilePath;
+				std::vector<ShaderStage*> stages; //< Stages compiled for this instance, empty if the program comes from the cache
+			};
+
+			UberShaderInstance* FinishInstance(UInt32 flags) const;
+			UberShaderInstance* GetInstance(const ParameterList& parameters, bool wait) const;
+			PendingInstance StartInstance(const ParameterList& parameters, UInt32 flags) const;
+
+			static String BuildStageCode(const CachedShader& shaderStage, UInt32 stageFlags);
+			static bool LoadCachedBinary(Shader* shader, const String& filePath);
+			static void SaveCachedBinary(const Shader* shader, const String& filePath);
+
 			mutable std::unordered_map<UInt32, UberShaderInstancePreprocessor> m_cache;
-			std::unordered_map<String, UInt32> m_flags;
+			mutable std::unordered_map<UInt32, PendingInstance> m_pendingInstances;
+			std::unordered_map<Name, UInt32> m_flags;
 			CachedShader m_shaders[ShaderStageType_Max+1];
+
+			static String s_cacheDirectory;
 	};
 }
 
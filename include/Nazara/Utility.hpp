@@ -36,7 +36,9 @@
 #include <Nazara/Utility/Algorithm.hpp>
 #include <Nazara/Utility/Animation.hpp>
 #include <Nazara/Utility/Buffer.hpp>
+#include <Nazara/Utility/BufferAllocator.hpp>
 #include <Nazara/Utility/BufferMapper.hpp>
+#include <Nazara/Utility/ComponentAccessor.hpp>
 #include <Nazara/Utility/Config.hpp>
 #include <Nazara/Utility/CubemapParams.hpp>
 #include <Nazara/Utility/Enums.hpp>
@@ -45,6 +47,7 @@
 #include <Nazara/Utility/FontGlyph.hpp>
 #include <Nazara/Utility/GuillotineImageAtlas.hpp>
 #include <Nazara/Utility/Image.hpp>
+#include <Nazara/Utility/ImageView.hpp>
 #include <Nazara/Utility/IndexBuffer.hpp>
 #include <Nazara/Utility/IndexIterator.hpp>
 #include <Nazara/Utility/IndexMapper.hpp>
@@ -30,6 +30,7 @@ namespace Nz
 			virtual std::size_t GetLayerCount() const = 0;
 			virtual UInt32 GetStorage() const = 0;
 			virtual bool Insert(const Image& image, Rectui* rect, bool* flipped, unsigned int* layerIndex) = 0;
+			virtual bool Insert(const Image* images, Rectui* rects, bool* flipped, unsigned int* layerIndices, unsigned int count);
 
 			// Signals:
 			NazaraSignal(OnAtlasCleared, const AbstractAtlas* /*atlas*/);
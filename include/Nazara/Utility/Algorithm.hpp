@@ -11,27 +11,50 @@
 #include <Nazara/Core/Color.hpp>
 #include <Nazara/Core/SparsePtr.hpp>
 #include <Nazara/Math/Box.hpp>
+#include <Nazara/Math/Frustum.hpp>
 #include <Nazara/Math/Matrix4.hpp>
 #include <Nazara/Math/Quaternion.hpp>
+#include <Nazara/Math/Sphere.hpp>
 #include <Nazara/Math/Vector2.hpp>
 #include <Nazara/Math/Vector3.hpp>
 #include <Nazara/Math/Vector4.hpp>
 #include <Nazara/Utility/IndexIterator.hpp>
+#include <vector>
 
 namespace Nz
 {
+	class IndexBuffer;
 	class Joint;
+	class VertexBuffer;
+	class VertexDeclaration;
+	struct MeshParams;
 	struct VertexStruct_XYZ_Normal_UV_Tangent;
 	struct VertexStruct_XYZ_Normal_UV_Tangent_Skinning;
 
 	using MeshVertex = VertexStruct_XYZ_Normal_UV_Tangent;
 	using SkeletalMeshVertex = VertexStruct_XYZ_Normal_UV_Tangent_Skinning;
 
+	struct Meshlet
+	{
+		Spheref boundingSphere;
+		Vector3f coneAxis;
+		float coneCutoff; ///< Sine of the half angle of the normal cone, one if the triangles face too many directions to be back-face culled together
+		UInt32 firstIndex;
+		UInt32 indexCount;
+	};
+
+	struct SkinningDualQuaternion
+	{
+		Quaternionf real;
+		Quaternionf dual;
+	};
+
 	struct SkinningData
 	{
 		const Joint* joints;
 		const SkeletalMeshVertex* inputVertex;
 		MeshVertex* outputVertex;
+		const SkinningDualQuaternion* dualQuaternions = nullptr; ///< Only required by the dual quaternion skinning, see ComputeSkinningDualQuaternions
 	};
 
 	struct VertexPointers
@@ -42,6 +65,8 @@ namespace Nz
 		SparsePtr<Vector2f> uvPtr;
 	};
 
+	NAZARA_UTILITY_API void BuildMeshlets(IndexIterator indices, unsigned int indexCount, SparsePtr<const Vector3f> positionPtr, std::vector<Meshlet>* meshlets, unsigned int maxTriangles = 128, unsigned int maxVertices = 64);
+
 	NAZARA_UTILITY_API Boxf ComputeAABB(SparsePtr<const Vector3f> positionPtr, unsigned int vertexCount);
 	NAZARA_UTILITY_API void ComputeBoxIndexVertexCount(const Vector3ui& subdivision, unsigned int* indexCount, unsigned int* vertexCount);
 	NAZARA_UTILITY_API unsigned int ComputeCacheMissCount(IndexIterator indices, unsigned int indexCount);
@@ -49,8 +74,14 @@ namespace Nz
 	NAZARA_UTILITY_API void ComputeCubicSphereIndexVertexCount(unsigned int subdivision, unsigned int* indexCount, unsigned int* vertexCount);
 	NAZARA_UTILITY_API void ComputeIcoSphereIndexVertexCount(unsigned int recursionLevel, unsigned int* indexCount, unsigned int* vertexCount);
 	NAZARA_UTILITY_API void ComputePlaneIndexVertexCount(const Vector2ui& subdivision, unsigned int* indexCount, unsigned int* vertexCount);
+	NAZARA_UTILITY_API void ComputeSkinningDualQuaternions(const Joint* joints, unsigned int jointCount, SkinningDualQuaternion* dualQuaternions);
 	NAZARA_UTILITY_API void ComputeUvSphereIndexVertexCount(unsigned int sliceCount, unsigned int stackCount, unsigned int* indexCount, unsigned int* vertexCount);
 
+	NAZARA_UTILITY_API void ConvertVertices(VertexBuffer* vertexBuffer, const VertexDeclaration* declaration);
+	NAZARA_UTILITY_API std::size_t CullMeshlets(const Meshlet* meshlets, std::size_t meshletCount, const Matrix4f& worldMatrix, const Frustumf& frustum, const Vector3f& eyePosition, bool backFaceCulling, UInt32* visibleMeshlets);
+	NAZARA_UTILITY_API Vector4f DecodeComponent(const void* data, ComponentType type);
+	NAZARA_UTILITY_API void EncodeComponent(void* data, ComponentType type, const Vector4f& value);
+
 	NAZARA_UTILITY_API void GenerateBox(const Vector3f& lengths, const Vector3ui& subdivision, const Matrix4f& matrix, const Rectf& textureCoords, VertexPointers vertexPointers, IndexIterator indices, Boxf* aabb = nullptr, unsigned int indexOffset = 0);
 	NAZARA_UTILITY_API void GenerateCone(float length, float radius, unsigned int subdivision, const Matrix4f& matrix, const Rectf& textureCoords, VertexPointers vertexPointers, IndexIterator indices, Boxf* aabb = nullptr, unsigned int indexOffset = 0);
 	NAZARA_UTILITY_API void GenerateCubicSphere(float size, unsigned int subdivision, const Matrix4f& matrix, const Rectf& textureCoords, VertexPointers vertexPointers, IndexIterator indices, Boxf* aabb = nullptr, unsigned int indexOffset = 0);
@@ -59,13 +90,26 @@ namespace Nz
 	NAZARA_UTILITY_API void GenerateUvSphere(float size, unsigned int sliceCount, unsigned int stackCount, const Matrix4f& matrix, const Rectf& textureCoords, VertexPointers vertexPointers, IndexIterator indices, Boxf* aabb = nullptr, unsigned int indexOffset = 0);
 
 	NAZARA_UTILITY_API void OptimizeIndices(IndexIterator indices, unsigned int indexCount);
+	NAZARA_UTILITY_API void OptimizeMesh(VertexBuffer* vertexBuffer, IndexBuffer* indexBuffer, const MeshParams& params);
+	NAZARA_UTILITY_API void OptimizeOverdraw(IndexIterator indices, unsigned int indexCount, SparsePtr<const Vector3f> positionPtr, float threshold = 1.05f);
+	NAZARA_UTILITY_API unsigned int OptimizeVertexFetch(void* vertices, unsigned int vertexStride, unsigned int vertexCount, IndexIterator indices, unsigned int indexCount);
 
+	NAZARA_UTILITY_API UInt16 PackHalf(float value);
+	NAZARA_UTILITY_API UInt32 PackNormal(const Vector4f& value);
+	NAZARA_UTILITY_API UInt16 PackUShortNorm(float value);
+	NAZARA_UTILITY_API float UnpackHalf(UInt16 value);
+	NAZARA_UTILITY_API Vector4f UnpackNormal(UInt32 value);
+	NAZARA_UTILITY_API float UnpackUShortNorm(UInt16 value);
+
+	NAZARA_UTILITY_API void SkinDualQuaternionPositionNormalTangent(const SkinningData& data, unsigned int startVertex, unsigned int vertexCount);
 	NAZARA_UTILITY_API void SkinPosition(const SkinningData& data, unsigned int startVertex, unsigned int vertexCount);
 	NAZARA_UTILITY_API void SkinPositionNormal(const SkinningData& data, unsigned int startVertex, unsigned int vertexCount);
 	NAZARA_UTILITY_API void SkinPositionNormalTangent(const SkinningData& data, unsigned int startVertex, unsigned int vertexCount);
 
 	NAZARA_UTILITY_API void TransformVertices(VertexPointers vertexPointers, unsigned int vertexCount, const Matrix4f& matrix);
 
+	NAZARA_UTILITY_API unsigned int WeldVertices(void* vertices, unsigned int vertexStride, unsigned int vertexCount, IndexIterator indices, unsigned int indexCount);
+
 	template<typename T> constexpr ComponentType ComponentTypeId();
 	template<typename T> constexpr ComponentType GetComponentTypeOf();
 }
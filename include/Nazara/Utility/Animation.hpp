@@ -59,7 +59,11 @@ namespace Nz
 
 			bool AddSequence(const Sequence& sequence);
 			void AnimateSkeleton(Skeleton* targetSkeleton, UInt32 frameA, UInt32 frameB, float interpolation) const;
+			void AnimateSkeleton(Skeleton* targetSkeleton, UInt32 frameA, UInt32 frameB, float interpolation, const UInt32* joints, std::size_t jointCount) const;
 
+			void BlendPose(UInt32 frameA, UInt32 frameB, float interpolation, float weight, SequenceJoint* pose) const;
+
+			bool Compress(float positionTolerance = 0.001f, float rotationTolerance = 0.1f);
 			bool CreateSkeletal(UInt32 frameCount, UInt32 jointCount);
 			void Destroy();
 
@@ -67,6 +71,7 @@ namespace Nz
 
 			UInt32 GetFrameCount() const;
 			UInt32 GetJointCount() const;
+			std::size_t GetMemoryUsage() const;
 			Sequence* GetSequence(const String& sequenceName);
 			Sequence* GetSequence(UInt32 index);
 			const Sequence* GetSequence(const String& sequenceName) const;
@@ -80,6 +85,7 @@ namespace Nz
 			bool HasSequence(const String& sequenceName) const;
 			bool HasSequence(UInt32 index = 0) const;
 
+			bool IsCompressed() const;
 			bool IsLoopPointInterpolationEnabled() const;
 			bool IsValid() const;
 
@@ -90,6 +96,8 @@ namespace Nz
 			void RemoveSequence(const String& sequenceName);
 			void RemoveSequence(UInt32 index);
 
+			void SamplePose(UInt32 frameA, UInt32 frameB, float interpolation, SequenceJoint* pose) const;
+
 			template<typename... Args> static AnimationRef New(Args&&... args);
 
 			// Signals:
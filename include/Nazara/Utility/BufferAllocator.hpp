@@ -0,0 +1,85 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_BUFFERALLOCATOR_HPP
+#define NAZARA_BUFFERALLOCATOR_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Utility/Buffer.hpp>
+#include <Nazara/Utility/Enums.hpp>
+#include <Nazara/Utility/IndexBuffer.hpp>
+#include <Nazara/Utility/VertexBuffer.hpp>
+#include <array>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_UTILITY_API BufferAllocator
+	{
+		public:
+			BufferAllocator(DataStorage storage = DataStorage_Hardware, BufferUsageFlags usage = 0, UInt32 blockSize = 4 * 1024 * 1024);
+			BufferAllocator(const BufferAllocator&) = delete;
+			BufferAllocator(BufferAllocator&&) = delete;
+			~BufferAllocator() = default;
+
+			IndexBufferRef AllocateIndexBuffer(bool largeIndices, UInt32 length);
+			VertexBufferRef AllocateVertexBuffer(VertexDeclarationConstRef vertexDeclaration, UInt32 length);
+
+			inline std::size_t GetBlockCount(BufferType type) const;
+			inline UInt32 GetBlockSize() const;
+			inline DataStorage GetStorage() const;
+			UInt32 GetUsedSize(BufferType type) const;
+
+			bool Relocate(IndexBuffer* indexBuffer);
+			bool Relocate(VertexBuffer* vertexBuffer);
+
+			BufferAllocator& operator=(const BufferAllocator&) = delete;
+			BufferAllocator& operator=(BufferAllocator&&) = delete;
+
+		private:
+			struct Allocation
+			{
+				UInt32 block;
+				UInt32 offset;
+				UInt32 size;
+			};
+
+			struct Block
+			{
+				BufferRef buffer;
+				std::map<UInt32, UInt32> freeRanges; //< Offset => size, merged with their neighbours when freed
+				UInt32 usedSize;
+			};
+
+			struct IndexAllocation : Allocation
+			{
+				NazaraSlot(IndexBuffer, OnIndexBufferRelease, onReleaseSlot);
+			};
+
+			struct VertexAllocation : Allocation
+			{
+				NazaraSlot(VertexBuffer, OnVertexBufferRelease, onReleaseSlot);
+			};
+
+			bool Allocate(BufferType type, UInt32 size, UInt32 alignment, Allocation* allocation);
+			void Free(BufferType type, const Allocation& allocation);
+			void OnIndexBufferRelease(const IndexBuffer* indexBuffer);
+			void OnVertexBufferRelease(const VertexBuffer* vertexBuffer);
+
+			std::array<std::vector<Block>, BufferType_Max + 1> m_blocks;
+			std::unordered_map<const IndexBuffer*, IndexAllocation> m_indexAllocations;
+			std::unordered_map<const VertexBuffer*, VertexAllocation> m_vertexAllocations;
+			BufferUsageFlags m_usage;
+			DataStorage m_storage;
+			UInt32 m_blockSize;
+	};
+}
+
+#include <Nazara/Utility/BufferAllocator.inl>
+
+#endif // NAZARA_BUFFERALLOCATOR_HPP
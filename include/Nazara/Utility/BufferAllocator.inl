@@ -0,0 +1,28 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/BufferAllocator.hpp>
+#include <Nazara/Utility/Debug.hpp>
+
+namespace Nz
+{
+	inline std::size_t BufferAllocator::GetBlockCount(BufferType type) const
+	{
+		NazaraAssert(type <= BufferType_Max, "Buffer type out of enum");
+
+		return m_blocks[type].size();
+	}
+
+	inline UInt32 BufferAllocator::GetBlockSize() const
+	{
+		return m_blockSize;
+	}
+
+	inline DataStorage BufferAllocator::GetStorage() const
+	{
+		return m_storage;
+	}
+}
+
+#include <Nazara/Utility/DebugOff.hpp>
@@ -0,0 +1,84 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_COMPONENTACCESSOR_HPP
+#define NAZARA_COMPONENTACCESSOR_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Math/Vector2.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <Nazara/Math/Vector4.hpp>
+#include <Nazara/Utility/Enums.hpp>
+#include <cstddef>
+#include <type_traits>
+
+namespace Nz
+{
+	template<typename T>
+	class ComponentAccessor
+	{
+		static_assert(std::is_same<T, float>::value || std::is_same<T, Vector2f>::value || std::is_same<T, Vector3f>::value || std::is_same<T, Vector4f>::value, "Only float vectors can be decoded");
+
+		public:
+			class Reference;
+
+			ComponentAccessor();
+			ComponentAccessor(void* ptr, std::size_t stride, ComponentType type);
+			ComponentAccessor(const ComponentAccessor&) = default;
+			~ComponentAccessor() = default;
+
+			T Get(std::size_t index) const;
+			void* GetPtr() const;
+			std::size_t GetStride() const;
+			ComponentType GetType() const;
+
+			void Set(std::size_t index, const T& value) const;
+
+			explicit operator bool() const;
+			Reference operator[](std::size_t index) const;
+
+			ComponentAccessor& operator=(const ComponentAccessor&) = default;
+
+		private:
+			static T FromVector(const Vector4f& value, float*);
+			static T FromVector(const Vector4f& value, Vector2f*);
+			static T FromVector(const Vector4f& value, Vector3f*);
+			static T FromVector(const Vector4f& value, Vector4f*);
+			static Vector4f ToVector(float value);
+			static Vector4f ToVector(const Vector2f& value);
+			static Vector4f ToVector(const Vector3f& value);
+			static Vector4f ToVector(const Vector4f& value);
+
+			UInt8* m_ptr;
+			std::size_t m_stride;
+			ComponentType m_type;
+	};
+
+	template<typename T>
+	class ComponentAccessor<T>::Reference
+	{
+		friend ComponentAccessor;
+
+		public:
+			Reference(const Reference&) = default;
+			~Reference() = default;
+
+			operator T() const;
+
+			Reference& operator=(const T& value);
+			Reference& operator=(const Reference& reference);
+
+		private:
+			Reference(const ComponentAccessor& accessor, std::size_t index);
+
+			ComponentAccessor m_accessor;
+			std::size_t m_index;
+	};
+}
+
+#include <Nazara/Utility/ComponentAccessor.inl>
+
+#endif // NAZARA_COMPONENTACCESSOR_HPP
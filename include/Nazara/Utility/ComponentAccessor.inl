@@ -0,0 +1,170 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/ComponentAccessor.hpp>
+#include <Nazara/Utility/Algorithm.hpp>
+#include <Nazara/Utility/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utility
+	* \class Nz::ComponentAccessor
+	* \brief Utility class that reads and writes a vertex component of any type as floats, decoding compact types (half, packed normals, ...)
+	*
+	* Unlike SparsePtr, which requires the exact type of the component, this converts every access through DecodeComponent and EncodeComponent.
+	*/
+
+	template<typename T>
+	ComponentAccessor<T>::ComponentAccessor() :
+	m_ptr(nullptr),
+	m_stride(0),
+	m_type(ComponentType_Float1)
+	{
+	}
+
+	template<typename T>
+	ComponentAccessor<T>::ComponentAccessor(void* ptr, std::size_t stride, ComponentType type) :
+	m_ptr(static_cast<UInt8*>(ptr)),
+	m_stride(stride),
+	m_type(type)
+	{
+	}
+
+	/*!
+	* \brief Decodes the component of a vertex
+	* \return Decoded component
+	*
+	* \param index Index of the vertex
+	*/
+	template<typename T>
+	T ComponentAccessor<T>::Get(std::size_t index) const
+	{
+		NazaraAssert(m_ptr, "Invalid accessor");
+
+		return FromVector(DecodeComponent(m_ptr + index * m_stride, m_type), static_cast<T*>(nullptr));
+	}
+
+	template<typename T>
+	void* ComponentAccessor<T>::GetPtr() const
+	{
+		return m_ptr;
+	}
+
+	template<typename T>
+	std::size_t ComponentAccessor<T>::GetStride() const
+	{
+		return m_stride;
+	}
+
+	template<typename T>
+	ComponentType ComponentAccessor<T>::GetType() const
+	{
+		return m_type;
+	}
+
+	/*!
+	* \brief Encodes the component of a vertex
+	*
+	* \param index Index of the vertex
+	* \param value New value of the component, which may lose precision
+	*/
+	template<typename T>
+	void ComponentAccessor<T>::Set(std::size_t index, const T& value) const
+	{
+		NazaraAssert(m_ptr, "Invalid accessor");
+
+		EncodeComponent(m_ptr + index * m_stride, m_type, ToVector(value));
+	}
+
+	template<typename T>
+	ComponentAccessor<T>::operator bool() const
+	{
+		return m_ptr != nullptr;
+	}
+
+	template<typename T>
+	typename ComponentAccessor<T>::Reference ComponentAccessor<T>::operator[](std::size_t index) const
+	{
+		return Reference(*this, index);
+	}
+
+	template<typename T>
+	T ComponentAccessor<T>::FromVector(const Vector4f& value, float*)
+	{
+		return value.x;
+	}
+
+	template<typename T>
+	T ComponentAccessor<T>::FromVector(const Vector4f& value, Vector2f*)
+	{
+		return Vector2f(value.x, value.y);
+	}
+
+	template<typename T>
+	T ComponentAccessor<T>::FromVector(const Vector4f& value, Vector3f*)
+	{
+		return Vector3f(value.x, value.y, value.z);
+	}
+
+	template<typename T>
+	T ComponentAccessor<T>::FromVector(const Vector4f& value, Vector4f*)
+	{
+		return value;
+	}
+
+	template<typename T>
+	Vector4f ComponentAccessor<T>::ToVector(float value)
+	{
+		return Vector4f(value, 0.f, 0.f, 1.f);
+	}
+
+	template<typename T>
+	Vector4f ComponentAccessor<T>::ToVector(const Vector2f& value)
+	{
+		return Vector4f(value.x, value.y, 0.f, 1.f);
+	}
+
+	template<typename T>
+	Vector4f ComponentAccessor<T>::ToVector(const Vector3f& value)
+	{
+		// Packed normals keep a w component of zero
+		return Vector4f(value.x, value.y, value.z, 0.f);
+	}
+
+	template<typename T>
+	Vector4f ComponentAccessor<T>::ToVector(const Vector4f& value)
+	{
+		return value;
+	}
+
+	template<typename T>
+	ComponentAccessor<T>::Reference::Reference(const ComponentAccessor& accessor, std::size_t index) :
+	m_accessor(accessor),
+	m_index(index)
+	{
+	}
+
+	template<typename T>
+	ComponentAccessor<T>::Reference::operator T() const
+	{
+		return m_accessor.Get(m_index);
+	}
+
+	template<typename T>
+	typename ComponentAccessor<T>::Reference& ComponentAccessor<T>::Reference::operator=(const T& value)
+	{
+		m_accessor.Set(m_index, value);
+		return *this;
+	}
+
+	template<typename T>
+	typename ComponentAccessor<T>::Reference& ComponentAccessor<T>::Reference::operator=(const Reference& reference)
+	{
+		m_accessor.Set(m_index, reference.m_accessor.Get(reference.m_index));
+		return *this;
+	}
+}
+
+#include <Nazara/Utility/DebugOff.hpp>
@@ -4,5 +4,7 @@
 
 #include <Nazara/Utility/Config.hpp>
 #if NAZARA_UTILITY_MANAGE_MEMORY
+	#undef NAZARA_MEMORY_TAG
+	#define NAZARA_MEMORY_TAG Nz::MemoryTag_Utility
 	#include <Nazara/Core/Debug/NewRedefinition.hpp>
 #endif
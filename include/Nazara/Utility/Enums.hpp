@@ -19,6 +19,15 @@ namespace Nz
 		AnimationType_Max = AnimationType_Static
 	};
 
+	enum AtlasPacking
+	{
+		AtlasPacking_Guillotine, //< Reuses freed areas, insertion slows down as free areas get fragmented
+		AtlasPacking_Shelf,      //< Fastest, for rectangles of similar heights
+		AtlasPacking_Skyline,    //< Fast and dense, freed areas are only reused after a clear
+
+		AtlasPacking_Max = AtlasPacking_Skyline
+	};
+
 	enum BlendFunc
 	{
 		BlendFunc_DestAlpha,
@@ -49,16 +58,21 @@ namespace Nz
 	{
 		BufferType_Index,
 		BufferType_Vertex,
+		BufferType_Uniform,
+		BufferType_DrawIndirect,
+		BufferType_PixelUnpack,
 
-		BufferType_Max = BufferType_Vertex
+		BufferType_Max = BufferType_PixelUnpack
 	};
 
 	enum BufferUsage
 	{
 		BufferUsage_Dynamic,
 		BufferUsage_FastRead,
+		BufferUsage_PersistentMapping,
+		BufferUsage_Transient,
 
-		BufferUsage_Max = BufferUsage_FastRead
+		BufferUsage_Max = BufferUsage_Transient
 	};
 
 	template<>
@@ -86,7 +100,13 @@ namespace Nz
 		ComponentType_Int4,
 		ComponentType_Quaternion,
 
-		ComponentType_Max = ComponentType_Quaternion
+		// Compact types, decoded by the vertex fetch (appended to keep the values stored in the NMesh files)
+		ComponentType_Half2,        // 2*half
+		ComponentType_Half4,        // 4*half
+		ComponentType_PackedNormal, // 3*snorm10 (xyz) + snorm2 (w), 32 bits
+		ComponentType_UShortNorm2,  // 2*unorm16
+
+		ComponentType_Max = ComponentType_UShortNorm2
 	};
 
 	enum CubemapFace
@@ -141,6 +161,14 @@ namespace Nz
 		ImageType_Max = ImageType_Cubemap
 	};
 
+	enum MipmapFilter
+	{
+		MipmapFilter_Box,    // Average of 2x2(x2) pixels, fast
+		MipmapFilter_Kaiser, // Kaiser-windowed sinc, sharper
+
+		MipmapFilter_Max = MipmapFilter_Kaiser
+	};
+
 	enum NodeType
 	{
 		NodeType_Default,  // Node
@@ -383,6 +411,7 @@ namespace Nz
 		VertexLayout_XYZ_Normal,
 		VertexLayout_XYZ_Normal_UV,
 		VertexLayout_XYZ_Normal_UV_Tangent,
+		VertexLayout_XYZ_Normal_UV_Tangent_Packed,
 		VertexLayout_XYZ_Normal_UV_Tangent_Skinning,
 		VertexLayout_XYZ_UV,
 
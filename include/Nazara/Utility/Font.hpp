@@ -17,6 +17,7 @@
 #include <Nazara/Core/ResourceParameters.hpp>
 #include <Nazara/Utility/AbstractAtlas.hpp>
 #include <memory>
+#include <string>
 #include <unordered_map>
 
 namespace Nz
@@ -63,11 +64,14 @@ namespace Nz
 			const std::shared_ptr<AbstractAtlas>& GetAtlas() const;
 			std::size_t GetCachedGlyphCount(unsigned int characterSize, UInt32 style) const;
 			std::size_t GetCachedGlyphCount() const;
+			unsigned int GetDistanceFieldSize() const;
+			unsigned int GetDistanceFieldSpread() const;
 			String GetFamilyName() const;
 			int GetKerning(unsigned int characterSize, char32_t first, char32_t second) const;
 			const Glyph& GetGlyph(unsigned int characterSize, UInt32 style, char32_t character) const;
 			unsigned int GetGlyphBorder() const;
 			unsigned int GetMinimumStepSize() const;
+			std::size_t GetPendingGlyphCount() const;
 			const SizeInfo& GetSizeInfo(unsigned int characterSize) const;
 			String GetStyleName() const;
 
@@ -75,13 +79,18 @@ namespace Nz
 
 			bool Precache(unsigned int characterSize, UInt32 style, char32_t character) const;
 			bool Precache(unsigned int characterSize, UInt32 style, const String& characterSet) const;
+			bool PrecacheAsync(unsigned int characterSize, UInt32 style, const String& characterSet) const;
 
 			// Open
 			bool OpenFromFile(const String& filePath, const FontParams& params = FontParams());
 			bool OpenFromMemory(const void* data, std::size_t size, const FontParams& params = FontParams());
 			bool OpenFromStream(Stream& stream, const FontParams& params = FontParams());
 
+			const Glyph& RequestGlyph(unsigned int characterSize, UInt32 style, char32_t character) const;
+
 			void SetAtlas(const std::shared_ptr<AbstractAtlas>& atlas);
+			void SetDistanceFieldSize(unsigned int referenceSize);
+			void SetDistanceFieldSpread(unsigned int spread);
 			void SetGlyphBorder(unsigned int borderSize);
 			void SetMinimumStepSize(unsigned int minimumStepSize);
 
@@ -106,6 +115,7 @@ namespace Nz
 				bool requireFauxBold;
 				bool requireFauxItalic;
 				bool flipped;
+				bool pending;
 				bool valid;
 				int advance;
 				unsigned int layerIndex;
@@ -124,6 +134,7 @@ namespace Nz
 			NazaraSignal(OnFontAtlasLayerChanged, const Font* /*font*/, AbstractImage* /*oldLayer*/, AbstractImage* /*newLayer*/);
 			NazaraSignal(OnFontDestroy, const Font* /*font*/);
 			NazaraSignal(OnFontGlyphCacheCleared, const Font* /*font*/);
+			NazaraSignal(OnFontGlyphsRasterized, const Font* /*font*/);
 			NazaraSignal(OnFontKerningCacheCleared, const Font* /*font*/);
 			NazaraSignal(OnFontRelease, const Font* /*font*/);
 			NazaraSignal(OnFontSizeInfoCacheCleared, const Font* /*font*/);
@@ -131,11 +142,18 @@ namespace Nz
 		private:
 			using GlyphMap = std::unordered_map<char32_t, Glyph>;
 
+			struct AsyncState;
+			struct GlyphBatch;
+
 			UInt64 ComputeKey(unsigned int characterSize, UInt32 style) const;
+			void FinishGlyphBatch(GlyphBatch& batch) const;
+			bool InsertGlyph(Glyph& glyph, const FontGlyph& fontGlyph) const;
+			void InvalidatePendingGlyphs() const;
 			void OnAtlasCleared(const AbstractAtlas* atlas);
 			void OnAtlasLayerChange(const AbstractAtlas* atlas, AbstractImage* oldLayer, AbstractImage* newLayer);
 			void OnAtlasRelease(const AbstractAtlas* atlas);
 			const Glyph& PrecacheGlyph(GlyphMap& glyphMap, unsigned int characterSize, UInt32 style, char32_t character) const;
+			void QueueGlyphs(unsigned int characterSize, UInt32 style, const std::u32string& characters) const;
 
 			static bool Initialize();
 			static void Uninitialize();
@@ -145,10 +163,13 @@ namespace Nz
 			NazaraSlot(AbstractAtlas, OnAtlasRelease, m_atlasReleaseSlot);
 
 			std::shared_ptr<AbstractAtlas> m_atlas;
+			std::shared_ptr<AsyncState> m_asyncState;
 			std::unique_ptr<FontData> m_data;
 			mutable std::unordered_map<UInt64, std::unordered_map<UInt64, int>> m_kerningCache;
 			mutable std::unordered_map<UInt64, GlyphMap> m_glyphes;
 			mutable std::unordered_map<UInt64, SizeInfo> m_sizeInfoCache;
+			unsigned int m_distanceFieldSize;
+			unsigned int m_distanceFieldSpread;
 			unsigned int m_glyphBorder;
 			unsigned int m_minimumStepSize;
 
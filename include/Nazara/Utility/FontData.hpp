@@ -13,6 +13,7 @@
 
 namespace Nz
 {
+	class Image;
 	struct FontGlyph;
 
 	class NAZARA_UTILITY_API FontData
@@ -21,6 +22,9 @@ namespace Nz
 			FontData() = default;
 			virtual ~FontData();
 
+			virtual FontData* Clone() const;
+
+			virtual bool ExtractDistanceField(unsigned int characterSize, char32_t character, UInt32 style, unsigned int spread, FontGlyph* dst);
 			virtual bool ExtractGlyph(unsigned int characterSize, char32_t character, UInt32 style, FontGlyph* dst) = 0;
 
 			virtual String GetFamilyName() const = 0;
@@ -36,6 +40,9 @@ namespace Nz
 			virtual float QueryUnderlineThickness(unsigned int characterSize) const = 0;
 
 			virtual bool SupportsStyle(UInt32 style) const = 0;
+
+		protected:
+			static void ComputeDistanceField(const Image& coverage, unsigned int spread, unsigned int downscale, Image* distanceField);
 	};
 }
 
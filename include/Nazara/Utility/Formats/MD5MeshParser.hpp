@@ -9,6 +9,7 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/String.hpp>
+#include <Nazara/Core/TextScanner.hpp>
 #include <Nazara/Math/Quaternion.hpp>
 #include <Nazara/Math/Vector2.hpp>
 #include <Nazara/Math/Vector3.hpp>
@@ -53,7 +54,7 @@ namespace Nz
 			};
 
 			MD5MeshParser(Stream& stream);
-			~MD5MeshParser();
+			~MD5MeshParser() = default;
 
 			Ternary Check();
 
@@ -75,10 +76,8 @@ namespace Nz
 			std::vector<Joint> m_joints;
 			std::vector<Mesh> m_meshes;
 			Stream& m_stream;
-			StreamOptionFlags m_streamFlags;
-			String m_currentLine;
+			TextScanner m_scanner;
 			bool m_keepLastLine;
-			unsigned int m_lineCount;
 			unsigned int m_meshIndex;
 	};
 }
@@ -10,6 +10,7 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/Color.hpp>
 #include <Nazara/Core/String.hpp>
+#include <Nazara/Core/TextScanner.hpp>
 #include <Nazara/Utility/Config.hpp>
 #include <unordered_map>
 
@@ -57,7 +58,6 @@ namespace Nz
 			};
 
 		private:
-			bool Advance(bool required = true);
 			template<typename T> void Emit(const T& text) const;
 			inline void EmitLine() const;
 			template<typename T> void EmitLine(const T& line) const;
@@ -68,10 +68,8 @@ namespace Nz
 
 			std::unordered_map<String, Material> m_materials;
 			mutable Stream* m_currentStream;
-			String m_currentLine;
+			TextScanner* m_currentScanner;
 			mutable StringStream m_outputStream;
-			bool m_keepLastLine;
-			unsigned int m_lineCount;
 	};
 }
 
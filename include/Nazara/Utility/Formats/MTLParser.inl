@@ -53,7 +53,7 @@ namespace Nz
 
 	inline void MTLParser::Error(const String& message)
 	{
-		NazaraError(message + " at line #" + String::Number(m_lineCount));
+		NazaraError(message + " at line #" + String::Number(m_currentScanner->GetLineNumber()));
 	}
 
 	inline void MTLParser::Flush() const
@@ -64,12 +64,12 @@ namespace Nz
 
 	inline void MTLParser::Warning(const String& message)
 	{
-		NazaraWarning(message + " at line #" + String::Number(m_lineCount));
+		NazaraWarning(message + " at line #" + String::Number(m_currentScanner->GetLineNumber()));
 	}
 
 	inline void MTLParser::UnrecognizedLine(bool error)
 	{
-		String message = "Unrecognized \"" + m_currentLine + '"';
+		String message = "Unrecognized \"" + m_currentScanner->GetLine() + '"';
 
 		if (error)
 			Error(message);
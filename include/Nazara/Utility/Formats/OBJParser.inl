@@ -151,41 +151,11 @@ namespace Nz
 		Emit('\n');
 	}
 
-	inline void OBJParser::Error(const String& message)
-	{
-		NazaraError(message + " at line #" + String::Number(m_lineCount));
-	}
-
 	inline void OBJParser::Flush() const
 	{
 		m_currentStream->Write(m_outputStream);
 		m_outputStream.Clear();
 	}
-
-	inline void OBJParser::Warning(const String& message)
-	{
-		NazaraWarning(message + " at line #" + String::Number(m_lineCount));
-	}
-
-	inline bool OBJParser::UnrecognizedLine(bool error)
-	{
-		String message = "Unrecognized \"" + m_currentLine + '"';
-
-		if (error)
-			Error(message);
-		else
-			Warning(message);
-
-		m_errorCount++;
-
-		if (m_errorCount > 10 && (m_errorCount * 100 / m_lineCount) > 50)
-		{
-			NazaraError("Aborting parsing because of error percentage");
-			return false; //< Abort parsing if error percentage is too high
-		}
-
-		return true;
-	}
 }
 
 #include <Nazara/Utility/DebugOff.hpp>
@@ -9,6 +9,8 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/GuillotineBinPack.hpp>
+#include <Nazara/Core/ShelfBinPack.hpp>
+#include <Nazara/Core/SkylineBinPack.hpp>
 #include <Nazara/Utility/AbstractAtlas.hpp>
 #include <Nazara/Utility/AbstractImage.hpp>
 #include <Nazara/Utility/Image.hpp>
@@ -27,14 +29,17 @@ namespace Nz
 
 			void Free(SparsePtr<const Rectui> rects, SparsePtr<unsigned int> layers, unsigned int count) override;
 
-			GuillotineBinPack::FreeRectChoiceHeuristic GetRectChoiceHeuristic() const;
-			GuillotineBinPack::GuillotineSplitHeuristic GetRectSplitHeuristic() const;
 			AbstractImage* GetLayer(unsigned int layerIndex) const override;
 			std::size_t GetLayerCount() const override;
+			AtlasPacking GetPacking() const;
+			GuillotineBinPack::FreeRectChoiceHeuristic GetRectChoiceHeuristic() const;
+			GuillotineBinPack::GuillotineSplitHeuristic GetRectSplitHeuristic() const;
 			UInt32 GetStorage() const override;
 
+			using AbstractAtlas::Insert;
 			bool Insert(const Image& image, Rectui* rect, bool* flipped, unsigned int* layerIndex) override;
 
+			void SetPacking(AtlasPacking packing);
 			void SetRectChoiceHeuristic(GuillotineBinPack::FreeRectChoiceHeuristic heuristic);
 			void SetRectSplitHeuristic(GuillotineBinPack::GuillotineSplitHeuristic heuristic);
 
@@ -56,13 +61,21 @@ namespace Nz
 				std::vector<QueuedGlyph> queuedGlyphs;
 				std::unique_ptr<AbstractImage> image;
 				GuillotineBinPack binPack;
+				ShelfBinPack shelfPack;
+				SkylineBinPack skylinePack;
 				unsigned int freedRectangles = 0;
 			};
 
 		private:
+			void ExpandLayer(Layer& layer, const Vector2ui& size) const;
+			void FreeInLayer(Layer& layer, const Rectui& rect) const;
+			Vector2ui GetLayerSize(const Layer& layer) const;
+			bool InsertInLayer(Layer& layer, Rectui* rect, bool* flipped) const;
 			void ProcessGlyphQueue(Layer& layer) const;
+			void ResetLayer(Layer& layer, const Vector2ui& size) const;
 
 			mutable std::vector<Layer> m_layers;
+			AtlasPacking m_packing;
 			GuillotineBinPack::FreeRectChoiceHeuristic m_rectChoiceHeuristic;
 			GuillotineBinPack::GuillotineSplitHeuristic m_rectSplitHeuristic;
 	};
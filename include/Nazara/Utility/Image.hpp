@@ -18,6 +18,8 @@
 #include <Nazara/Core/Signal.hpp>
 #include <Nazara/Utility/AbstractImage.hpp>
 #include <Nazara/Utility/CubemapParams.hpp>
+#include <Nazara/Utility/ImageView.hpp>
+#include <array>
 #include <atomic>
 
 ///TODO: Filtres
@@ -75,7 +77,11 @@ namespace Nz
 			bool FlipHorizontally();
 			bool FlipVertically();
 
+			bool GenerateMipmaps(MipmapFilter filter = MipmapFilter_Box, bool sRGB = false);
+
 			const UInt8* GetConstPixels(unsigned int x = 0, unsigned int y = 0, unsigned int z = 0, UInt8 level = 0) const;
+			ImageView<const UInt8> GetConstView(UInt8 level = 0) const;
+			ImageView<const UInt8> GetConstView(const Boxui& box, UInt8 level = 0) const;
 			unsigned int GetDepth(UInt8 level = 0) const override;
 			PixelFormatType GetFormat() const override;
 			unsigned int GetHeight(UInt8 level = 0) const override;
@@ -87,6 +93,8 @@ namespace Nz
 			UInt8* GetPixels(unsigned int x = 0, unsigned int y = 0, unsigned int z = 0, UInt8 level = 0);
 			Vector3ui GetSize(UInt8 level = 0) const override;
 			ImageType GetType() const override;
+			ImageView<UInt8> GetView(UInt8 level = 0);
+			ImageView<UInt8> GetView(const Boxui& box, UInt8 level = 0);
 			unsigned int GetWidth(UInt8 level = 0) const override;
 
 			bool HasAlpha() const;
@@ -100,12 +108,14 @@ namespace Nz
 
 			// LoadArray
 			bool LoadArrayFromFile(const String& filePath, const ImageParams& imageParams = ImageParams(), const Vector2ui& atlasSize = Vector2ui(2, 2));
+			bool LoadArrayFromFiles(const String* filePaths, std::size_t fileCount, const ImageParams& imageParams = ImageParams());
 			bool LoadArrayFromImage(const Image& image, const Vector2ui& atlasSize = Vector2ui(2, 2));
 			bool LoadArrayFromMemory(const void* data, std::size_t size, const ImageParams& imageParams = ImageParams(), const Vector2ui& atlasSize = Vector2ui(2, 2));
 			bool LoadArrayFromStream(Stream& stream, const ImageParams& imageParams = ImageParams(), const Vector2ui& atlasSize = Vector2ui(2, 2));
 
 			// LoadCubemap
 			bool LoadCubemapFromFile(const String& filePath, const ImageParams& imageParams = ImageParams(), const CubemapParams& cubemapParams = CubemapParams());
+			bool LoadCubemapFromFiles(const std::array<String, CubemapFace_Max + 1>& filePaths, const ImageParams& imageParams = ImageParams());
 			bool LoadCubemapFromImage(const Image& image, const CubemapParams& params = CubemapParams());
 			bool LoadCubemapFromMemory(const void* data, std::size_t size, const ImageParams& imageParams = ImageParams(), const CubemapParams& cubemapParams = CubemapParams());
 			bool LoadCubemapFromStream(Stream& stream, const ImageParams& imageParams = ImageParams(), const CubemapParams& cubemapParams = CubemapParams());
@@ -133,7 +143,9 @@ namespace Nz
 			static void Copy(UInt8* destination, const UInt8* source, PixelFormatType format, unsigned int width, unsigned int height, unsigned int depth = 1, unsigned int dstWidth = 0, unsigned int dstHeight = 0, unsigned int srcWidth = 0, unsigned int srcHeight = 0);
 			static UInt8 GetMaxLevel(unsigned int width, unsigned int height, unsigned int depth = 1);
 			static UInt8 GetMaxLevel(ImageType type, unsigned int width, unsigned int height, unsigned int depth = 1);
+			static ResourceFuture<Image> LoadAsync(const String& filePath, const ImageParams& params = ImageParams());
 			template<typename... Args> static ImageRef New(Args&&... args);
+			static ResourceFuture<Image> ReloadAsync(const ImageRef& image, const String& filePath, const ImageParams& params = ImageParams());
 
 			struct SharedImage
 			{
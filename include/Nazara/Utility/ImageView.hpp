@@ -0,0 +1,61 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_IMAGEVIEW_HPP
+#define NAZARA_IMAGEVIEW_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Color.hpp>
+#include <Nazara/Math/Box.hpp>
+#include <Nazara/Utility/Enums.hpp>
+#include <cstddef>
+
+namespace Nz
+{
+	template<typename T>
+	class ImageView
+	{
+		static_assert(sizeof(T) == 1, "ImageView only accepts UInt8 and const UInt8");
+
+		public:
+			ImageView();
+			ImageView(T* pixels, PixelFormatType format, unsigned int width, unsigned int height, unsigned int depth = 1, std::size_t rowPitch = 0, std::size_t slicePitch = 0);
+			template<typename U> ImageView(const ImageView<U>& view);
+			ImageView(const ImageView& view) = default;
+			~ImageView() = default;
+
+			bool Copy(const ImageView<const UInt8>& source) const;
+
+			bool Fill(const Color& color) const;
+
+			unsigned int GetDepth() const;
+			PixelFormatType GetFormat() const;
+			unsigned int GetHeight() const;
+			T* GetPixels(unsigned int x = 0, unsigned int y = 0, unsigned int z = 0) const;
+			std::size_t GetRowPitch() const;
+			std::size_t GetSlicePitch() const;
+			ImageView GetSubView(const Boxui& box) const;
+			unsigned int GetWidth() const;
+
+			bool IsValid() const;
+
+			ImageView& operator=(const ImageView& view) = default;
+
+		private:
+			T* m_pixels;
+			PixelFormatType m_format;
+			std::size_t m_bytesPerPixel;
+			std::size_t m_rowPitch;
+			std::size_t m_slicePitch;
+			unsigned int m_depth;
+			unsigned int m_height;
+			unsigned int m_width;
+	};
+}
+
+#include <Nazara/Utility/ImageView.inl>
+
+#endif // NAZARA_IMAGEVIEW_HPP
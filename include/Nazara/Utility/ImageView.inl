@@ -0,0 +1,267 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Utility/Config.hpp>
+#include <Nazara/Utility/PixelFormat.hpp>
+#include <algorithm>
+#include <cstring>
+#include <Nazara/Utility/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utility
+	* \class Nz::ImageView
+	* \brief Utility class that represents a box of pixels, without owning them
+	*
+	* Views allow to read or write a region of an image (or of any pixel buffer) without going through the copy-on-write checks of Image for each access.
+	* ImageView<const UInt8> is a read-only view, a writable view can be converted to it.
+	*
+	* \remark Compressed formats are not supported
+	* \remark A view is invalidated as soon as the memory it points to is freed or reallocated
+	*/
+
+	/*!
+	* \brief Constructs an invalid ImageView object
+	*/
+	template<typename T>
+	ImageView<T>::ImageView() :
+	m_pixels(nullptr),
+	m_format(PixelFormatType_Undefined),
+	m_bytesPerPixel(0),
+	m_rowPitch(0),
+	m_slicePitch(0),
+	m_depth(0),
+	m_height(0),
+	m_width(0)
+	{
+	}
+
+	/*!
+	* \brief Constructs an ImageView object over a pixel buffer
+	*
+	* \param pixels Pointer to the first pixel of the view
+	* \param format Pixel format of the buffer, must not be compressed
+	* \param width Width of the view
+	* \param height Height of the view
+	* \param depth Depth of the view
+	* \param rowPitch Size of a row of the buffer in bytes, 0 for tightly packed rows
+	* \param slicePitch Size of a slice of the buffer in bytes, 0 for tightly packed slices
+	*/
+	template<typename T>
+	ImageView<T>::ImageView(T* pixels, PixelFormatType format, unsigned int width, unsigned int height, unsigned int depth, std::size_t rowPitch, std::size_t slicePitch) :
+	m_pixels(pixels),
+	m_format(format),
+	m_bytesPerPixel(PixelFormat::GetBytesPerPixel(format)),
+	m_depth(depth),
+	m_height(height),
+	m_width(width)
+	{
+		NazaraAssert(!PixelFormat::IsCompressed(format), "Compressed formats are not supported");
+
+		m_rowPitch = (rowPitch != 0) ? rowPitch : m_width * m_bytesPerPixel;
+		m_slicePitch = (slicePitch != 0) ? slicePitch : m_rowPitch * m_height;
+	}
+
+	/*!
+	* \brief Constructs an ImageView object from another type of ImageView
+	*
+	* \param view View to copy, only a writable view can be converted to a read-only one
+	*/
+	template<typename T>
+	template<typename U>
+	ImageView<T>::ImageView(const ImageView<U>& view) :
+	ImageView(view.GetPixels(), view.GetFormat(), view.GetWidth(), view.GetHeight(), view.GetDepth(), view.GetRowPitch(), view.GetSlicePitch())
+	{
+	}
+
+	/*!
+	* \brief Copies the pixels of another view into the top-left corner of this one
+	* \return true if successful
+	*
+	* \param source View to copy from, its format must match and it must not be larger than this view
+	*/
+	template<typename T>
+	bool ImageView<T>::Copy(const ImageView<const UInt8>& source) const
+	{
+		#if NAZARA_UTILITY_SAFE
+		if (!IsValid() || !source.IsValid())
+		{
+			NazaraError("Views must be valid");
+			return false;
+		}
+
+		if (source.GetFormat() != m_format)
+		{
+			NazaraError("Source view format does not match destination view format");
+			return false;
+		}
+
+		if (source.GetWidth() > m_width || source.GetHeight() > m_height || source.GetDepth() > m_depth)
+		{
+			NazaraError("Source view is larger than destination view");
+			return false;
+		}
+		#endif
+
+		std::size_t lineSize = source.GetWidth() * m_bytesPerPixel;
+		for (unsigned int z = 0; z < source.GetDepth(); ++z)
+		{
+			for (unsigned int y = 0; y < source.GetHeight(); ++y)
+				std::memcpy(GetPixels(0, y, z), source.GetPixels(0, y, z), lineSize);
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Fills every pixel of the view with a color
+	* \return true if successful
+	*
+	* \param color Color to convert to the format of the view
+	*/
+	template<typename T>
+	bool ImageView<T>::Fill(const Color& color) const
+	{
+		#if NAZARA_UTILITY_SAFE
+		if (!IsValid())
+		{
+			NazaraError("View must be valid");
+			return false;
+		}
+		#endif
+
+		if (m_width == 0 || m_height == 0 || m_depth == 0)
+			return true;
+
+		// The color is converted once, the first row is then filled and replicated
+		UInt8* firstRow = GetPixels();
+		if (!PixelFormat::Convert(PixelFormatType_RGBA8, m_format, &color.r, firstRow))
+		{
+			NazaraError("Failed to convert RGBA8 to " + PixelFormat::GetName(m_format));
+			return false;
+		}
+
+		for (unsigned int x = 1; x < m_width; ++x)
+			std::memcpy(&firstRow[x * m_bytesPerPixel], firstRow, m_bytesPerPixel);
+
+		std::size_t lineSize = m_width * m_bytesPerPixel;
+		for (unsigned int z = 0; z < m_depth; ++z)
+		{
+			for (unsigned int y = (z == 0) ? 1 : 0; y < m_height; ++y)
+				std::memcpy(GetPixels(0, y, z), firstRow, lineSize);
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Gets the depth of the view
+	* \return Number of slices
+	*/
+	template<typename T>
+	unsigned int ImageView<T>::GetDepth() const
+	{
+		return m_depth;
+	}
+
+	/*!
+	* \brief Gets the format of the pixels
+	* \return Pixel format
+	*/
+	template<typename T>
+	PixelFormatType ImageView<T>::GetFormat() const
+	{
+		return m_format;
+	}
+
+	/*!
+	* \brief Gets the height of the view
+	* \return Number of rows
+	*/
+	template<typename T>
+	unsigned int ImageView<T>::GetHeight() const
+	{
+		return m_height;
+	}
+
+	/*!
+	* \brief Gets a pointer to a pixel of the view
+	* \return Pointer to the pixel
+	*
+	* \param x X coordinate of the pixel, relative to the view
+	* \param y Y coordinate of the pixel, relative to the view
+	* \param z Z coordinate of the pixel, relative to the view
+	*/
+	template<typename T>
+	T* ImageView<T>::GetPixels(unsigned int x, unsigned int y, unsigned int z) const
+	{
+		NazaraAssert(x <= m_width && y <= m_height && z <= m_depth, "Pixel out of view");
+
+		return &m_pixels[z * m_slicePitch + y * m_rowPitch + x * m_bytesPerPixel];
+	}
+
+	/*!
+	* \brief Gets the distance between two rows
+	* \return Size of a row of the underlying buffer, in bytes
+	*/
+	template<typename T>
+	std::size_t ImageView<T>::GetRowPitch() const
+	{
+		return m_rowPitch;
+	}
+
+	/*!
+	* \brief Gets the distance between two slices
+	* \return Size of a slice of the underlying buffer, in bytes
+	*/
+	template<typename T>
+	std::size_t ImageView<T>::GetSlicePitch() const
+	{
+		return m_slicePitch;
+	}
+
+	/*!
+	* \brief Gets a view over a part of this view
+	* \return View sharing the pixels of this one, or an invalid view if the box is out of bounds
+	*
+	* \param box Box of the pixels, relative to this view
+	*/
+	template<typename T>
+	ImageView<T> ImageView<T>::GetSubView(const Boxui& box) const
+	{
+		#if NAZARA_UTILITY_SAFE
+		if (box.x + box.width > m_width || box.y + box.height > m_height || box.z + box.depth > m_depth)
+		{
+			NazaraError("Box dimensions are out of bounds");
+			return ImageView();
+		}
+		#endif
+
+		return ImageView(GetPixels(box.x, box.y, box.z), m_format, box.width, box.height, box.depth, m_rowPitch, m_slicePitch);
+	}
+
+	/*!
+	* \brief Gets the width of the view
+	* \return Number of pixels per row
+	*/
+	template<typename T>
+	unsigned int ImageView<T>::GetWidth() const
+	{
+		return m_width;
+	}
+
+	/*!
+	* \brief Checks whether the view points to pixels
+	* \return true if it does
+	*/
+	template<typename T>
+	bool ImageView<T>::IsValid() const
+	{
+		return m_pixels != nullptr;
+	}
+}
+
+#include <Nazara/Utility/DebugOff.hpp>
@@ -18,6 +18,8 @@ namespace Nz
 
 	class NAZARA_UTILITY_API Joint : public Node
 	{
+		friend Skeleton;
+
 		public:
 			Joint(Skeleton* skeleton);
 			Joint(const Joint& joint);
@@ -36,6 +38,7 @@ namespace Nz
 
 		private:
 			void InvalidateNode() override;
+			void SetPose(const Vector3f& position, const Quaternionf& rotation, const Vector3f& scale);
 			void UpdateSkinningMatrix() const;
 
 			Matrix4f m_inverseBindMatrix;
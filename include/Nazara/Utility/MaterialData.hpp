@@ -28,6 +28,7 @@ namespace Nz
 		static constexpr const char* DepthFunc                = "MatDepthfunc";
 		static constexpr const char* DepthSorting             = "MatDepthSorting";
 		static constexpr const char* DepthWrite               = "MatDepthWrite";
+		static constexpr const char* DistanceField            = "MatDistanceField";
 		static constexpr const char* DiffuseAnisotropyLevel   = "MatDiffuseAnisotropyLevel";
 		static constexpr const char* DiffuseColor             = "MatDiffuseColor";
 		static constexpr const char* DiffuseFilter            = "MatDiffuseFilter";
@@ -43,6 +44,7 @@ namespace Nz
 		static constexpr const char* LineWidth                = "MatLineWidth";
 		static constexpr const char* Name                     = "MatName";
 		static constexpr const char* NormalTexturePath        = "MatNormalTexturePath";
+		static constexpr const char* OrderIndependentTransparency = "MatOrderIndependentTransparency";
 		static constexpr const char* PointSize                = "MatPointSize";
 		static constexpr const char* ScissorTest              = "MatScissorTest";
 		static constexpr const char* Shininess                = "MatShininess";
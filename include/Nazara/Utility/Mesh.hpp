@@ -25,10 +25,13 @@
 
 namespace Nz
 {
+	class BufferAllocator;
+
 	struct NAZARA_UTILITY_API MeshParams : ResourceParameters
 	{
 		MeshParams();
 
+		BufferAllocator* bufferAllocator = nullptr; ///< If not null, the buffers of the static meshes are relocated in the blocks of this allocator (allowing the renderer to draw them without rebinding buffers)
 		BufferUsageFlags indexBufferFlags = 0;      ///< Buffer usage flags used to build the index buffers
 		BufferUsageFlags vertexBufferFlags = 0;     ///< Buffer usage flags used to build the vertex buffers
 		Matrix4f matrix = Matrix4f::Identity();     ///< A matrix which will transform every vertex position
@@ -42,6 +45,9 @@ namespace Nz
 		#else
 		bool optimizeIndexBuffers = false;          ///< Since this optimization take a lot of time, especially in debug mode, don't enable it by default in debug.
 		#endif
+		bool optimizeOverdraw = false;              ///< Reorder the triangles after the index buffer optimization so that the outer ones are drawn first, reducing overdraw at the cost of a few cache misses.
+		bool optimizeVertexFetch = false;           ///< Reorder the vertices in the order they are used by the index buffer (and remove unused ones), improving the memory locality of the vertex fetches.
+		bool weldVertices = false;                  ///< Merge the binary identical vertices, reducing the vertex count.
 
 		/* The declaration must have a Vector3f position component enabled
 		 * If the declaration has a Vector2f UV component enabled, UV are generated
@@ -50,6 +56,12 @@ namespace Nz
 		 */
 		VertexDeclaration* vertexDeclaration = VertexDeclaration::Get(VertexLayout_XYZ_Normal_UV_Tangent);
 
+		/* If not null, the vertices of the static meshes are converted to this declaration once loaded (and optimized)
+		 * This allows to store them with compact types (see VertexLayout_XYZ_Normal_UV_Tangent_Packed), reducing the vertex fetch bandwidth
+		 * The declaration must keep a Vector3f position component, skeletal meshes are not converted
+		 */
+		VertexDeclaration* compressedVertexDeclaration = nullptr;
+
 		bool IsValid() const;
 	};
 
@@ -141,6 +153,7 @@ namespace Nz
 
 			void Transform(const Matrix4f& matrix);
 
+			static ResourceFuture<Mesh> LoadAsync(const String& filePath, const MeshParams& params = MeshParams());
 			template<typename... Args> static MeshRef New(Args&&... args);
 
 			// Signals:
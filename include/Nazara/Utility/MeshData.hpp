@@ -13,12 +13,15 @@ namespace Nz
 {
 	class IndexBuffer;
 	class VertexBuffer;
+	struct Meshlet;
 
 	struct MeshData
 	{
 		PrimitiveMode primitiveMode;
 		const IndexBuffer* indexBuffer;
 		const VertexBuffer* vertexBuffer;
+		const Meshlet* meshlets = nullptr; ///< Culled separately when drawn, see StaticMesh::GenerateMeshlets
+		std::size_t meshletCount = 0;
 	};
 }
 
@@ -265,6 +265,13 @@ namespace Nz
 		if (srcFormat == dstFormat)
 			return true;
 
+		// Compressed formats are decompressed to and compressed from RGBA8 (see Compress and Decompress)
+		if (IsCompressed(srcFormat))
+			return IsConversionSupported(PixelFormatType_RGBA8, dstFormat);
+
+		if (IsCompressed(dstFormat))
+			return IsConversionSupported(srcFormat, PixelFormatType_RGBA8);
+
 		return s_convertFunctions[srcFormat][dstFormat] != nullptr;
 	}
 
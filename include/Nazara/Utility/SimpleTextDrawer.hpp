@@ -28,6 +28,8 @@ namespace Nz
 
 			void Clear();
 
+			void EnableAsyncGlyphs(bool enable = true);
+
 			const Recti& GetBounds() const override;
 			unsigned int GetCharacterSize() const;
 			const Color& GetColor() const;
@@ -41,6 +43,8 @@ namespace Nz
 			UInt32 GetStyle() const;
 			const String& GetText() const;
 
+			bool IsAsyncGlyphsEnabled() const;
+
 			void SetCharacterSize(unsigned int characterSize);
 			void SetColor(const Color& color);
 			void SetFont(Font* font);
@@ -57,7 +61,8 @@ namespace Nz
 			void ClearGlyphs() const;
 			void ConnectFontSlots();
 			void DisconnectFontSlots();
-			void GenerateGlyphs(const String& text) const;
+			void EraseGlyphs(std::size_t lineIndex) const;
+			void GenerateGlyphs(std::size_t textPosition) const;
 			void OnFontAtlasLayerChanged(const Font* font, AbstractImage* oldLayer, AbstractImage* newLayer);
 			void OnFontInvalidated(const Font* font);
 			void OnFontRelease(const Font* object);
@@ -67,10 +72,12 @@ namespace Nz
 			NazaraSlot(Font, OnFontAtlasChanged, m_atlasChangedSlot);
 			NazaraSlot(Font, OnFontAtlasLayerChanged, m_atlasLayerChangedSlot);
 			NazaraSlot(Font, OnFontGlyphCacheCleared, m_glyphCacheClearedSlot);
+			NazaraSlot(Font, OnFontGlyphsRasterized, m_glyphsRasterizedSlot);
 			NazaraSlot(Font, OnFontRelease, m_fontReleaseSlot);
 
 			mutable std::vector<Glyph> m_glyphs;
 			mutable std::vector<Line> m_lines;
+			mutable std::vector<std::size_t> m_lineTextPositions; //< Byte position in m_text of the first character of each line
 			Color m_color;
 			FontRef m_font;
 			mutable Rectf m_workingBounds;
@@ -79,6 +86,7 @@ namespace Nz
 			mutable UInt32 m_previousCharacter;
 			UInt32 m_style;
 			mutable Vector2ui m_drawPos;
+			bool m_asyncGlyphs;
 			mutable bool m_colorUpdated;
 			mutable bool m_glyphUpdated;
 			unsigned int m_characterSize;
@@ -19,6 +19,7 @@ namespace Nz
 {
 	class Joint;
 	class Skeleton;
+	struct SequenceJoint;
 
 	using SkeletonConstRef = ObjectRef<const Skeleton>;
 	using SkeletonLibrary = ObjectLibrary<Skeleton>;
@@ -55,6 +56,9 @@ namespace Nz
 
 			bool IsValid() const;
 
+			void SetPose(const SequenceJoint* pose);
+			void SetPose(const SequenceJoint* pose, const UInt32* indices, UInt32 indiceCount);
+
 			Skeleton& operator=(const Skeleton& skeleton);
 
 			template<typename... Args> static SkeletonRef New(Args&&... args);
@@ -9,7 +9,6 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Utility/AbstractBuffer.hpp>
-#include <vector>
 
 namespace Nz
 {
@@ -25,15 +24,26 @@ namespace Nz
 
 			bool Initialize(UInt32 size, BufferUsageFlags usage) override;
 
+			inline const UInt8* GetData() const;
 			DataStorage GetStorage() const override;
 
 			void* Map(BufferAccess access, UInt32 offset = 0, UInt32 size = 0) override;
 			bool Unmap() override;
 
+			static void ReleasePooledMemory();
+
+			static constexpr std::size_t Alignment = 64;
+
 		private:
-			std::vector<UInt8> m_buffer;
+			void Release();
+
+			BufferUsageFlags m_usage;
+			UInt8* m_buffer;
+			UInt32 m_capacity;
 			bool m_mapped;
 	};
 }
 
+#include <Nazara/Utility/SoftwareBuffer.inl>
+
 #endif // NAZARA_SOFTWAREBUFFER_HPP
@@ -0,0 +1,15 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/Debug.hpp>
+
+namespace Nz
+{
+	inline const UInt8* SoftwareBuffer::GetData() const
+	{
+		return m_buffer;
+	}
+}
+
+#include <Nazara/Utility/DebugOff.hpp>
@@ -9,7 +9,9 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/Signal.hpp>
+#include <Nazara/Utility/Algorithm.hpp>
 #include <Nazara/Utility/SubMesh.hpp>
+#include <vector>
 
 namespace Nz
 {
@@ -30,10 +32,12 @@ namespace Nz
 			void Destroy();
 
 			bool GenerateAABB();
+			bool GenerateMeshlets(unsigned int maxTriangles = 128, unsigned int maxVertices = 64);
 
 			const Boxf& GetAABB() const override;
 			AnimationType GetAnimationType() const final override;
 			const IndexBuffer* GetIndexBuffer() const override;
+			const std::vector<Meshlet>& GetMeshlets() const;
 			VertexBuffer* GetVertexBuffer();
 			const VertexBuffer* GetVertexBuffer() const;
 			unsigned int GetVertexCount() const override;
@@ -52,6 +56,7 @@ namespace Nz
 
 		private:
 			Boxf m_aabb;
+			std::vector<Meshlet> m_meshlets;
 			IndexBufferConstRef m_indexBuffer = nullptr;
 			VertexBufferRef m_vertexBuffer = nullptr;
 	};
@@ -10,6 +10,7 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/SparsePtr.hpp>
 #include <Nazara/Utility/BufferMapper.hpp>
+#include <Nazara/Utility/ComponentAccessor.hpp>
 #include <Nazara/Utility/Enums.hpp>
 #include <Nazara/Utility/VertexBuffer.hpp>
 
@@ -26,6 +27,7 @@ namespace Nz
 			VertexMapper(const VertexBuffer* vertexBuffer, BufferAccess access = BufferAccess_ReadOnly);
 			~VertexMapper();
 
+			template<typename T> ComponentAccessor<T> GetComponentAccessor(VertexComponent component);
 			template<typename T> SparsePtr<T> GetComponentPtr(VertexComponent component);
 			inline const VertexBuffer* GetVertexBuffer() const;
 			inline UInt32 GetVertexCount() const;
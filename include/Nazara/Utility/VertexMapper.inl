@@ -9,6 +9,23 @@
 
 namespace Nz
 {
+	template<typename T>
+	ComponentAccessor<T> VertexMapper::GetComponentAccessor(VertexComponent component)
+	{
+		// Contrairement à GetComponentPtr, le type n'a pas besoin de correspondre (les types compacts sont décodés)
+		const VertexDeclaration* declaration = m_mapper.GetBuffer()->GetVertexDeclaration();
+
+		bool enabled;
+		ComponentType type;
+		std::size_t offset;
+		declaration->GetComponent(component, &enabled, &type, &offset);
+
+		if (enabled)
+			return ComponentAccessor<T>(static_cast<UInt8*>(m_mapper.GetPointer()) + offset, declaration->GetStride(), type);
+		else
+			return ComponentAccessor<T>();
+	}
+
 	template <typename T>
 	SparsePtr<T> VertexMapper::GetComponentPtr(VertexComponent component)
 	{
@@ -67,6 +67,13 @@ namespace Nz
 		Vector3f tangent;
 	};
 
+	struct VertexStruct_XYZ_Normal_UV_Tangent_Packed : VertexStruct_XYZ
+	{
+		UInt32 normal;      // See PackNormal
+		Vector2<UInt16> uv; // See PackHalf
+		UInt32 tangent;     // See PackNormal
+	};
+
 	struct VertexStruct_XYZ_UV : VertexStruct_XYZ
 	{
 		Vector2f uv;
@@ -6,6 +6,7 @@
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/ErrorFlags.hpp>
 #include <Nazara/Core/File.hpp>
+#include <Nazara/Core/MappedFile.hpp>
 #include <Nazara/Core/String.hpp>
 #include <Nazara/Utility/Mesh.hpp>
 #include <assimp/cfileio.h>
@@ -75,7 +76,7 @@ aiFile* StreamOpener(aiFileIO* fileIO, const char* filePath, const char* openMod
 	if (!isOriginalStream && strstr(filePath, StreamPath) != 0)
 		return nullptr;
 
-	aiUserData stream;
+	aiUserData stream = nullptr;
 	if (isOriginalStream)
 		stream = reinterpret_cast<aiUserData>(fileIOUserdata->originalStream);
 	else
@@ -112,11 +113,24 @@ aiFile* StreamOpener(aiFileIO* fileIO, const char* filePath, const char* openMod
 		if (!std::strchr(openMode, 'b'))
 			openModeEnum |= OpenMode_Text;
 
-		std::unique_ptr<File> file = std::make_unique<File>();
-		if (!file->Open(filePath, openModeEnum))
-			return nullptr;
+		// Files only read in binary mode (external buffers, textures, ...) are mapped in memory rather than read by chunks
+		if (openModeEnum == OpenMode_ReadOnly)
+		{
+			ErrorFlags mappingErrFlags(ErrorFlag_Discard | ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
+
+			std::unique_ptr<MappedFile> mappedFile = std::make_unique<MappedFile>();
+			if (mappedFile->Open(filePath) && mappedFile->GetSize() > 0)
+				stream = reinterpret_cast<char*>(static_cast<Stream*>(mappedFile.release()));
+		}
 
-		stream = reinterpret_cast<char*>(file.release());
+		if (!stream)
+		{
+			std::unique_ptr<File> file = std::make_unique<File>();
+			if (!file->Open(filePath, openModeEnum))
+				return nullptr;
+
+			stream = reinterpret_cast<char*>(static_cast<Stream*>(file.release()));
+		}
 	}
 
 	std::unique_ptr<aiFile> file = std::make_unique<aiFile>();
@@ -137,7 +151,7 @@ void StreamCloser(aiFileIO* fileIO, aiFile* file)
 	Stream* fileUserdata = reinterpret_cast<Stream*>(file->UserData);
 
 	if (fileUserdata != fileIOUserdata->originalStream)
-		delete reinterpret_cast<File*>(file->UserData);
+		delete fileUserdata;
 
 	delete file;
 }
@@ -25,8 +25,10 @@ SOFTWARE.
 #include <CustomStream.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/String.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Utility/Algorithm.hpp>
+#include <Nazara/Utility/BufferAllocator.hpp>
 #include <Nazara/Utility/Mesh.hpp>
-#include <Nazara/Utility/IndexIterator.hpp>
 #include <Nazara/Utility/IndexMapper.hpp>
 #include <Nazara/Utility/Joint.hpp>
 #include <Nazara/Utility/MaterialData.hpp>
@@ -39,10 +41,166 @@ SOFTWARE.
 #include <assimp/mesh.h>
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
+#include <memory>
 #include <set>
+#include <unordered_map>
+#include <vector>
 
 using namespace Nz;
 
+struct MeshConversion
+{
+	aiMesh* mesh;
+	IndexBufferRef indexBuffer;
+	VertexBufferRef vertexBuffer;
+	std::unique_ptr<IndexMapper> indexMapper;
+	std::unique_ptr<VertexMapper> vertexMapper;
+	bool generateTangents = false;
+};
+
+ParameterList ConvertMaterial(const aiMaterial* aiMat, const String& directory)
+{
+	ParameterList matData;
+
+	auto ConvertColor = [&] (const char* aiKey, unsigned int aiType, unsigned int aiIndex, const char* colorKey)
+	{
+		aiColor4D color;
+		if (aiGetMaterialColor(aiMat, aiKey, aiType, aiIndex, &color) == aiReturn_SUCCESS)
+		{
+			matData.SetParameter(colorKey, Color(static_cast<UInt8>(color.r * 255), static_cast<UInt8>(color.g * 255), static_cast<UInt8>(color.b * 255), static_cast<UInt8>(color.a * 255)));
+		}
+	};
+
+	auto ConvertTexture = [&] (aiTextureType aiType, const char* textureKey, const char* wrapKey = nullptr)
+	{
+		aiString path;
+		aiTextureMapMode mapMode[3];
+		if (aiGetMaterialTexture(aiMat, aiType, 0, &path, nullptr, nullptr, nullptr, nullptr, &mapMode[0], nullptr) == aiReturn_SUCCESS)
+		{
+			matData.SetParameter(textureKey, directory + String(path.data, path.length));
+
+			if (wrapKey)
+			{
+				SamplerWrap wrap = SamplerWrap_Default;
+				switch (mapMode[0])
+				{
+					case aiTextureMapMode_Clamp:
+					case aiTextureMapMode_Decal:
+						wrap = SamplerWrap_Clamp;
+						break;
+
+					case aiTextureMapMode_Mirror:
+						wrap = SamplerWrap_MirroredRepeat;
+						break;
+
+					case aiTextureMapMode_Wrap:
+						wrap = SamplerWrap_Repeat;
+						break;
+
+					default:
+						NazaraWarning("Assimp texture map mode 0x" + String::Number(mapMode[0], 16) + " not handled");
+						break;
+				}
+
+				matData.SetParameter(wrapKey, static_cast<long long>(wrap));
+			}
+		}
+	};
+
+	ConvertColor(AI_MATKEY_COLOR_AMBIENT, MaterialData::AmbientColor);
+	ConvertColor(AI_MATKEY_COLOR_DIFFUSE, MaterialData::DiffuseColor);
+	ConvertColor(AI_MATKEY_COLOR_SPECULAR, MaterialData::SpecularColor);
+
+	ConvertTexture(aiTextureType_DIFFUSE, MaterialData::DiffuseTexturePath, MaterialData::DiffuseWrap);
+	ConvertTexture(aiTextureType_EMISSIVE, MaterialData::EmissiveTexturePath);
+	ConvertTexture(aiTextureType_HEIGHT, MaterialData::HeightTexturePath);
+	ConvertTexture(aiTextureType_NORMALS, MaterialData::NormalTexturePath);
+	ConvertTexture(aiTextureType_OPACITY, MaterialData::AlphaTexturePath);
+	ConvertTexture(aiTextureType_SPECULAR, MaterialData::SpecularTexturePath, MaterialData::SpecularWrap);
+
+	aiString name;
+	if (aiGetMaterialString(aiMat, AI_MATKEY_NAME, &name) == aiReturn_SUCCESS)
+		matData.SetParameter(MaterialData::Name, String(name.data, name.length));
+
+	int iValue;
+	if (aiGetMaterialInteger(aiMat, AI_MATKEY_TWOSIDED, &iValue) == aiReturn_SUCCESS)
+		matData.SetParameter(MaterialData::FaceCulling, !iValue);
+
+	return matData;
+}
+
+// Only writes to memory mapped beforehand, which makes it safe to call from any thread
+void ConvertMesh(MeshConversion& conversion, const MeshParams& parameters, const Matrix4f& normalTangentMatrix)
+{
+	const aiMesh* iMesh = conversion.mesh;
+	unsigned int vertexCount = iMesh->mNumVertices;
+
+	// Index buffer
+	IndexMapper& indexMapper = *conversion.indexMapper;
+
+	std::size_t index = 0;
+	for (unsigned int j = 0; j < iMesh->mNumFaces; ++j)
+	{
+		const aiFace& face = iMesh->mFaces[j];
+		if (face.mNumIndices != 3)
+			NazaraWarning("Assimp plugin: This face is not a triangle!");
+
+		indexMapper.Set(index++, face.mIndices[0]);
+		indexMapper.Set(index++, face.mIndices[1]);
+		indexMapper.Set(index++, face.mIndices[2]);
+	}
+
+	// Vertex buffer
+	VertexMapper& vertexMapper = *conversion.vertexMapper;
+
+	auto posPtr = vertexMapper.GetComponentPtr<Vector3f>(VertexComponent_Position);
+	for (unsigned int j = 0; j < vertexCount; ++j)
+	{
+		aiVector3D position = iMesh->mVertices[j];
+		*posPtr++ = parameters.matrix * Vector3f(position.x, position.y, position.z);
+	}
+
+	if (auto normalPtr = vertexMapper.GetComponentPtr<Vector3f>(VertexComponent_Normal))
+	{
+		for (unsigned int j = 0; j < vertexCount; ++j)
+		{
+			aiVector3D normal = iMesh->mNormals[j];
+			*normalPtr++ = normalTangentMatrix.Transform({normal.x, normal.y, normal.z}, 0.f);
+		}
+	}
+
+	if (auto tangentPtr = vertexMapper.GetComponentPtr<Vector3f>(VertexComponent_Tangent))
+	{
+		if (iMesh->HasTangentsAndBitangents())
+		{
+			for (unsigned int j = 0; j < vertexCount; ++j)
+			{
+				aiVector3D tangent = iMesh->mTangents[j];
+				*tangentPtr++ = normalTangentMatrix.Transform({tangent.x, tangent.y, tangent.z}, 0.f);
+			}
+		}
+		else
+			conversion.generateTangents = true;
+	}
+
+	if (auto uvPtr = vertexMapper.GetComponentPtr<Vector2f>(VertexComponent_TexCoord))
+	{
+		if (iMesh->HasTextureCoords(0))
+		{
+			for (unsigned int j = 0; j < vertexCount; ++j)
+			{
+				aiVector3D uv = iMesh->mTextureCoords[0][j];
+				*uvPtr++ = parameters.texCoordOffset + Vector2f(uv.x, uv.y) * parameters.texCoordScale;
+			}
+		}
+		else
+		{
+			for (unsigned int j = 0; j < vertexCount; ++j)
+				*uvPtr++ = Vector2f::Zero();
+		}
+	}
+}
+
 void ProcessJoints(aiNode* node, Skeleton* skeleton, const std::set<Nz::String>& joints)
 {
 	Nz::String jointName(node->mName.data, node->mName.length);
@@ -186,192 +344,100 @@ bool Load(Mesh* mesh, Stream& stream, const MeshParams& parameters)
 	{
 		mesh->CreateStatic();
 
-		// aiMaterial index in scene => Material index and data in Mesh
-		std::unordered_map<unsigned int, std::pair<UInt32, ParameterList>> materials;
-
-		for (unsigned int i = 0; i < scene->mNumMeshes; ++i)
-		{
-			aiMesh* iMesh = scene->mMeshes[i];
-			if (!iMesh->HasBones()) // Don't process skeletal meshs
-			{
-				unsigned int indexCount = iMesh->mNumFaces * 3;
-				unsigned int vertexCount = iMesh->mNumVertices;
-
-				// Index buffer
-				bool largeIndices = (vertexCount > std::numeric_limits<UInt16>::max());
+		// Assimp already welds the vertices and improves the cache locality of the indices
+		MeshParams optimizationParams(parameters);
+		optimizationParams.optimizeIndexBuffers = false;
+		optimizationParams.weldVertices = false;
 
-				IndexBufferRef indexBuffer = IndexBuffer::New(largeIndices, indexCount, parameters.storage, parameters.indexBufferFlags);
+		// Make sure the normal/tangent matrix won't rescale our vectors
+		Nz::Matrix4f normalTangentMatrix = parameters.matrix;
+		if (normalTangentMatrix.HasScale())
+			normalTangentMatrix.ApplyScale(1.f / normalTangentMatrix.GetScale());
 
-				IndexMapper indexMapper(indexBuffer, BufferAccess_DiscardAndWrite);
-				IndexIterator index = indexMapper.begin();
+		// aiMaterial index in scene => Material index in Mesh
+		std::unordered_map<unsigned int, UInt32> materialIndices;
+		std::vector<unsigned int> usedMaterials;
 
-				for (unsigned int j = 0; j < iMesh->mNumFaces; ++j)
-				{
-					aiFace& face = iMesh->mFaces[j];
-					if (face.mNumIndices != 3)
-						NazaraWarning("Assimp plugin: This face is not a triangle!");
+		// Buffers are created and mapped from the loading thread, as hardware buffers can't be mapped without the context of the renderer
+		std::vector<MeshConversion> conversions;
+		conversions.reserve(scene->mNumMeshes);
 
-					*index++ = face.mIndices[0];
-					*index++ = face.mIndices[1];
-					*index++ = face.mIndices[2];
-				}
-				indexMapper.Unmap();
+		for (unsigned int i = 0; i < scene->mNumMeshes; ++i)
+		{
+			aiMesh* iMesh = scene->mMeshes[i];
+			if (iMesh->HasBones()) // Don't process skeletal meshs
+				continue;
 
-				// Vertex buffer
+			unsigned int indexCount = iMesh->mNumFaces * 3;
+			unsigned int vertexCount = iMesh->mNumVertices;
 
-				// Make sure the normal/tangent matrix won't rescale our vectors
-				Nz::Matrix4f normalTangentMatrix = parameters.matrix;
-				if (normalTangentMatrix.HasScale())
-					normalTangentMatrix.ApplyScale(1.f / normalTangentMatrix.GetScale());
+			bool largeIndices = (vertexCount > std::numeric_limits<UInt16>::max());
 
-				VertexBufferRef vertexBuffer = VertexBuffer::New(parameters.vertexDeclaration, vertexCount, parameters.storage, parameters.vertexBufferFlags);
+			conversions.emplace_back();
+			MeshConversion& conversion = conversions.back();
+			conversion.mesh = iMesh;
+			conversion.indexBuffer = IndexBuffer::New(largeIndices, indexCount, parameters.storage, parameters.indexBufferFlags);
+			conversion.vertexBuffer = VertexBuffer::New(parameters.vertexDeclaration, vertexCount, parameters.storage, parameters.vertexBufferFlags);
+			conversion.indexMapper = std::make_unique<IndexMapper>(conversion.indexBuffer, BufferAccess_DiscardAndWrite);
+			conversion.vertexMapper = std::make_unique<VertexMapper>(conversion.vertexBuffer, BufferAccess_DiscardAndWrite);
 
-				VertexMapper vertexMapper(vertexBuffer, BufferAccess_DiscardAndWrite);
+			if (materialIndices.emplace(iMesh->mMaterialIndex, UInt32(usedMaterials.size())).second)
+				usedMaterials.push_back(iMesh->mMaterialIndex);
+		}
 
-				auto posPtr = vertexMapper.GetComponentPtr<Vector3f>(VertexComponent_Position);
-				for (unsigned int j = 0; j < vertexCount; ++j)
-				{
-					aiVector3D position = iMesh->mVertices[j];
-					*posPtr++ = parameters.matrix * Vector3f(position.x, position.y, position.z);
-				}
+		// Vertices and indices are written straight into the mapped buffers, one aiMesh per task
+		TaskScheduler::ParallelFor(0, conversions.size(), 1, [&] (std::size_t first, std::size_t last)
+		{
+			for (std::size_t i = first; i < last; ++i)
+				ConvertMesh(conversions[i], parameters, normalTangentMatrix);
+		});
 
-				if (auto normalPtr = vertexMapper.GetComponentPtr<Vector3f>(VertexComponent_Normal))
-				{
-					for (unsigned int j = 0; j < vertexCount; ++j)
-					{
-						aiVector3D normal = iMesh->mNormals[j];
-						*normalPtr++ = normalTangentMatrix.Transform({normal.x, normal.y, normal.z}, 0.f);
-					}
-				}
+		String directory = stream.GetDirectory();
 
-				bool generateTangents = false;
-				if (auto tangentPtr = vertexMapper.GetComponentPtr<Vector3f>(VertexComponent_Tangent))
-				{
-					if (iMesh->HasTangentsAndBitangents())
-					{
-						for (unsigned int j = 0; j < vertexCount; ++j)
-						{
-							aiVector3D tangent = iMesh->mTangents[j];
-							*tangentPtr++ = normalTangentMatrix.Transform({tangent.x, tangent.y, tangent.z}, 0.f);
-						}
-					}
-					else
-						generateTangents = true;
-				}
+		std::vector<ParameterList> materials(usedMaterials.size());
+		TaskScheduler::ParallelFor(0, usedMaterials.size(), 1, [&] (std::size_t first, std::size_t last)
+		{
+			for (std::size_t i = first; i < last; ++i)
+				materials[i] = ConvertMaterial(scene->mMaterials[usedMaterials[i]], directory);
+		});
 
-				if (auto uvPtr = vertexMapper.GetComponentPtr<Vector2f>(VertexComponent_TexCoord))
-				{
-					if (iMesh->HasTextureCoords(0))
-					{
-						for (unsigned int j = 0; j < vertexCount; ++j)
-						{
-							aiVector3D uv = iMesh->mTextureCoords[0][j];
-							*uvPtr++ = parameters.texCoordOffset + Vector2f(uv.x, uv.y) * parameters.texCoordScale;
-						}
-					}
-					else
-					{
-						for (unsigned int j = 0; j < vertexCount; ++j)
-							*uvPtr++ = Vector2f::Zero();
-					}
-				}
+		for (MeshConversion& conversion : conversions)
+		{
+			conversion.indexMapper.reset();
+			conversion.vertexMapper.reset();
 
-				vertexMapper.Unmap();
+			const IndexBufferRef& indexBuffer = conversion.indexBuffer;
+			const VertexBufferRef& vertexBuffer = conversion.vertexBuffer;
 
-				// Submesh
-				StaticMeshRef subMesh = StaticMesh::New(mesh);
-				subMesh->Create(vertexBuffer);
+			// Submesh
+			StaticMeshRef subMesh = StaticMesh::New(mesh);
+			subMesh->Create(vertexBuffer);
 
-				subMesh->SetIndexBuffer(indexBuffer);
-				subMesh->GenerateAABB();
-				subMesh->SetMaterialIndex(iMesh->mMaterialIndex);
+			subMesh->SetIndexBuffer(indexBuffer);
+			subMesh->GenerateAABB();
+			subMesh->SetMaterialIndex(materialIndices[conversion.mesh->mMaterialIndex]);
 
-				if (generateTangents)
-					subMesh->GenerateTangents();
+			if (conversion.generateTangents)
+				subMesh->GenerateTangents();
 
-				auto matIt = materials.find(iMesh->mMaterialIndex);
-				if (matIt == materials.end())
-				{
-					ParameterList matData;
-					aiMaterial* aiMat = scene->mMaterials[iMesh->mMaterialIndex];
-
-					auto ConvertColor = [&] (const char* aiKey, unsigned int aiType, unsigned int aiIndex, const char* colorKey)
-					{
-						aiColor4D color;
-						if (aiGetMaterialColor(aiMat, aiKey, aiType, aiIndex, &color) == aiReturn_SUCCESS)
-						{
-							matData.SetParameter(colorKey, Color(static_cast<UInt8>(color.r * 255), static_cast<UInt8>(color.g * 255), static_cast<UInt8>(color.b * 255), static_cast<UInt8>(color.a * 255)));
-						}
-					};
-
-					auto ConvertTexture = [&] (aiTextureType aiType, const char* textureKey, const char* wrapKey = nullptr)
-					{
-						aiString path;
-						aiTextureMapMode mapMode[3];
-						if (aiGetMaterialTexture(aiMat, aiType, 0, &path, nullptr, nullptr, nullptr, nullptr, &mapMode[0], nullptr) == aiReturn_SUCCESS)
-						{
-							matData.SetParameter(textureKey, stream.GetDirectory() + String(path.data, path.length));
-
-							if (wrapKey)
-							{
-								SamplerWrap wrap = SamplerWrap_Default;
-								switch (mapMode[0])
-								{
-									case aiTextureMapMode_Clamp:
-									case aiTextureMapMode_Decal:
-										wrap = SamplerWrap_Clamp;
-										break;
-
-									case aiTextureMapMode_Mirror:
-										wrap = SamplerWrap_MirroredRepeat;
-										break;
-
-									case aiTextureMapMode_Wrap:
-										wrap = SamplerWrap_Repeat;
-										break;
-
-									default:
-										NazaraWarning("Assimp texture map mode 0x" + String::Number(mapMode[0], 16) + " not handled");
-										break;
-								}
-
-								matData.SetParameter(wrapKey, static_cast<long long>(wrap));
-							}
-						}
-					};
-
-					ConvertColor(AI_MATKEY_COLOR_AMBIENT, MaterialData::AmbientColor);
-					ConvertColor(AI_MATKEY_COLOR_DIFFUSE, MaterialData::DiffuseColor);
-					ConvertColor(AI_MATKEY_COLOR_SPECULAR, MaterialData::SpecularColor);
-
-					ConvertTexture(aiTextureType_DIFFUSE, MaterialData::DiffuseTexturePath, MaterialData::DiffuseWrap);
-					ConvertTexture(aiTextureType_EMISSIVE, MaterialData::EmissiveTexturePath);
-					ConvertTexture(aiTextureType_HEIGHT, MaterialData::HeightTexturePath);
-					ConvertTexture(aiTextureType_NORMALS, MaterialData::NormalTexturePath);
-					ConvertTexture(aiTextureType_OPACITY, MaterialData::AlphaTexturePath);
-					ConvertTexture(aiTextureType_SPECULAR, MaterialData::SpecularTexturePath, MaterialData::SpecularWrap);
-
-					aiString name;
-					if (aiGetMaterialString(aiMat, AI_MATKEY_NAME, &name) == aiReturn_SUCCESS)
-						matData.SetParameter(MaterialData::Name, String(name.data, name.length));
-
-					int iValue;
-					if (aiGetMaterialInteger(aiMat, AI_MATKEY_TWOSIDED, &iValue) == aiReturn_SUCCESS)
-						matData.SetParameter(MaterialData::FaceCulling, !iValue);
-
-					matIt = materials.insert(std::make_pair(iMesh->mMaterialIndex, std::make_pair(UInt32(materials.size()), std::move(matData)))).first;
-				}
+			OptimizeMesh(vertexBuffer, indexBuffer, optimizationParams);
 
-				subMesh->SetMaterialIndex(matIt->first);
+			if (parameters.compressedVertexDeclaration)
+				ConvertVertices(vertexBuffer, parameters.compressedVertexDeclaration);
 
-				mesh->AddSubMesh(subMesh);
+			if (parameters.bufferAllocator)
+			{
+				parameters.bufferAllocator->Relocate(indexBuffer);
+				parameters.bufferAllocator->Relocate(vertexBuffer);
 			}
 
-			mesh->SetMaterialCount(std::max<UInt32>(UInt32(materials.size()), 1));
-			for (const auto& pair : materials)
-				mesh->SetMaterialData(pair.second.first, pair.second.second);
+			mesh->AddSubMesh(subMesh);
 		}
 
+		mesh->SetMaterialCount(std::max<UInt32>(UInt32(materials.size()), 1));
+		for (std::size_t i = 0; i < materials.size(); ++i)
+			mesh->SetMaterialData(UInt32(i), materials[i]);
+
 		if (parameters.center)
 			mesh->Recenter();
 	}
@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Audio/Audio.hpp>
+#include <Nazara/Audio/AudioStreamer.hpp>
 #include <Nazara/Audio/Config.hpp>
 #include <Nazara/Audio/Enums.hpp>
 #include <Nazara/Audio/OpenAL.hpp>
@@ -12,6 +13,7 @@
 #include <Nazara/Core/Core.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Audio/Debug.hpp>
 
 namespace Nz
@@ -158,6 +160,8 @@ namespace Nz
 			return true; // Already initialized
 		}
 
+		Profiler::Scope profilerScope("Audio::Initialize");
+
 		// Initialisation of dependencies
 		if (!Core::Initialize())
 		{
@@ -390,6 +394,7 @@ namespace Nz
 		// Loaders
 		Loaders::Unregister_sndfile();
 
+		AudioStreamer::Uninitialize();
 		SoundBuffer::Uninitialize();
 		OpenAL::Uninitialize();
 
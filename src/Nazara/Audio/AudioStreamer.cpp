@@ -0,0 +1,248 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Audio module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Audio/AudioStreamer.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <algorithm>
+#include <Nazara/Audio/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		bool FillAndQueueBuffer(StreamedSource* streamedSource, ALuint buffer)
+		{
+			SoundStream* stream = streamedSource->stream.get();
+
+			std::size_t sampleCount = streamedSource->chunkSamples.size();
+			std::size_t sampleRead = 0;
+
+			// Fill the buffer by reading from the stream
+			for (;;)
+			{
+				sampleRead += stream->Read(&streamedSource->chunkSamples[sampleRead], sampleCount - sampleRead);
+				if (sampleRead < sampleCount && streamedSource->loop)
+				{
+					// In case we read less than expected, assume we reached the end of the stream and seek back to the beginning
+					stream->Seek(0);
+					continue;
+				}
+
+				// Either we read the size we wanted, either we're not looping
+				break;
+			}
+
+			// Update the buffer (send it to OpenAL) and queue it if we got any data
+			if (sampleRead > 0)
+			{
+				alBufferData(buffer, OpenAL::AudioFormat[stream->GetFormat()], &streamedSource->chunkSamples[0], static_cast<ALsizei>(sampleRead*sizeof(Int16)), static_cast<ALsizei>(stream->GetSampleRate()));
+				alSourceQueueBuffers(streamedSource->source, 1, &buffer);
+			}
+
+			return sampleRead != sampleCount; // End of stream (Does not happen when looping)
+		}
+
+		void ReleaseStream(StreamedSource* streamedSource)
+		{
+			// Stop playing of the sound (in the case where it has not been already done)
+			alSourceStop(streamedSource->source);
+
+			// We delete buffers from the stream
+			ALint queuedBufferCount;
+			alGetSourcei(streamedSource->source, AL_BUFFERS_QUEUED, &queuedBufferCount);
+
+			ALuint buffer;
+			for (ALint i = 0; i < queuedBufferCount; ++i)
+				alSourceUnqueueBuffers(streamedSource->source, 1, &buffer);
+
+			alDeleteBuffers(static_cast<ALsizei>(streamedSource->buffers.size()), streamedSource->buffers.data());
+			streamedSource->buffers.clear();
+
+			streamedSource->streaming = false;
+		}
+
+		bool UpdateStream(StreamedSource* streamedSource)
+		{
+			if (!streamedSource->started)
+			{
+				for (ALuint buffer : streamedSource->buffers)
+				{
+					if (FillAndQueueBuffer(streamedSource, buffer))
+					{
+						streamedSource->endOfStream = true;
+						break; // We have reached the end of the stream, there is no use to add new buffers
+					}
+				}
+
+				alSourcePlay(streamedSource->source);
+				streamedSource->started = true;
+				return true;
+			}
+
+			// We treat read buffers
+			ALint processedCount = 0;
+			alGetSourcei(streamedSource->source, AL_BUFFERS_PROCESSED, &processedCount);
+			while (processedCount-- > 0)
+			{
+				ALuint buffer;
+				alSourceUnqueueBuffers(streamedSource->source, 1, &buffer);
+
+				ALint bits, size;
+				alGetBufferi(buffer, AL_BITS, &bits);
+				alGetBufferi(buffer, AL_SIZE, &size);
+
+				if (bits != 0)
+					streamedSource->processedSamples += (8 * size) / bits;
+
+				if (!streamedSource->endOfStream && FillAndQueueBuffer(streamedSource, buffer))
+					streamedSource->endOfStream = true;
+			}
+
+			ALint state;
+			alGetSourcei(streamedSource->source, AL_SOURCE_STATE, &state);
+			if (state == AL_STOPPED)
+			{
+				// The reading has stopped, we have reached the end of the stream
+				if (streamedSource->endOfStream)
+					return false;
+
+				// Otherwise the source ran dry before being refilled (under heavy load), it resumes from the buffers just queued
+				alSourcePlay(streamedSource->source);
+			}
+
+			return true;
+		}
+	}
+
+	/*!
+	* \ingroup audio
+	* \class Nz::AudioStreamer
+	* \brief Audio class streaming every playing source decoded on the fly (musics and compressed sounds) from a single thread
+	*/
+
+	/*!
+	* \brief Gets the mutex locked by the streaming thread while it queues buffers
+	* \return Streaming mutex
+	*/
+
+	Mutex& AudioStreamer::GetMutex()
+	{
+		return s_mutex;
+	}
+
+	/*!
+	* \brief Starts streaming to a source
+	*
+	* \param streamedSource Stream and buffering settings, which must stay alive until the streaming stops
+	* \param source OpenAL source the stream is queued to
+	*/
+
+	void AudioStreamer::Start(StreamedSource* streamedSource, unsigned int source)
+	{
+		NazaraAssert(streamedSource && streamedSource->stream, "Invalid stream");
+		NazaraAssert(!streamedSource->streaming, "Stream is already streaming");
+
+		SoundStream* stream = streamedSource->stream.get();
+		std::size_t channelCount = stream->GetFormat();
+		std::size_t chunkSampleCount = std::max<std::size_t>(static_cast<std::size_t>(UInt64(channelCount) * stream->GetSampleRate() * streamedSource->bufferDuration / 1000ULL), channelCount);
+
+		streamedSource->buffers.resize(streamedSource->bufferCount);
+		streamedSource->chunkSamples.resize(chunkSampleCount);
+		streamedSource->endOfStream = false;
+		streamedSource->source = source;
+		streamedSource->started = false;
+		streamedSource->streaming = true;
+
+		alGenBuffers(static_cast<ALsizei>(streamedSource->bufferCount), streamedSource->buffers.data());
+
+		// The buffers are filled by the streaming thread, started with the first stream
+		LockGuard lock(s_mutex);
+		s_streamedSources.push_back(streamedSource);
+
+		if (!s_thread.IsJoinable())
+		{
+			s_enabled = true;
+			s_thread = Thread(&AudioStreamer::StreamingThread);
+			s_thread.SetName("AudioStreamingThread");
+		}
+		else
+			s_condition.Signal();
+	}
+
+	/*!
+	* \brief Stops streaming, releasing the buffers of the stream
+	*
+	* \param streamedSource Stream to stop, ignored if it isn't streaming anymore
+	*/
+
+	void AudioStreamer::Stop(StreamedSource* streamedSource)
+	{
+		LockGuard lock(s_mutex);
+
+		// The stream may have already been released by the streaming thread, at its end
+		auto it = std::find(s_streamedSources.begin(), s_streamedSources.end(), streamedSource);
+		if (it == s_streamedSources.end())
+			return;
+
+		s_streamedSources.erase(it);
+		ReleaseStream(streamedSource);
+	}
+
+	/*!
+	* \brief Stops every stream and the streaming thread
+	*/
+
+	void AudioStreamer::Uninitialize()
+	{
+		{
+			LockGuard lock(s_mutex);
+
+			for (StreamedSource* streamedSource : s_streamedSources)
+				ReleaseStream(streamedSource);
+
+			s_streamedSources.clear();
+			s_enabled = false;
+			s_condition.Signal();
+		}
+
+		if (s_thread.IsJoinable())
+			s_thread.Join();
+	}
+
+	void AudioStreamer::StreamingThread()
+	{
+		LockGuard lock(s_mutex);
+
+		while (s_enabled)
+		{
+			UInt32 period = 50;
+			for (auto it = s_streamedSources.begin(); it != s_streamedSources.end();)
+			{
+				StreamedSource* streamedSource = *it;
+				if (!UpdateStream(streamedSource))
+				{
+					ReleaseStream(streamedSource);
+					it = s_streamedSources.erase(it);
+					continue;
+				}
+
+				// Streams decoded by short buffers need to be serviced more often
+				period = std::min<UInt32>(period, std::max<UInt32>(streamedSource->bufferDuration / 4, 5));
+				++it;
+			}
+
+			// We go back to sleep, the mutex being unlocked meanwhile so streams can be started and stopped
+			if (s_streamedSources.empty())
+				s_condition.Wait(&s_mutex);
+			else
+				s_condition.Wait(&s_mutex, period);
+		}
+	}
+
+	ConditionVariable AudioStreamer::s_condition;
+	Mutex AudioStreamer::s_mutex;
+	Thread AudioStreamer::s_thread;
+	std::vector<StreamedSource*> AudioStreamer::s_streamedSources;
+	bool AudioStreamer::s_enabled = false;
+}
@@ -0,0 +1,62 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Audio module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_AUDIOSTREAMER_HPP
+#define NAZARA_AUDIOSTREAMER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Audio/Config.hpp>
+#include <Nazara/Audio/OpenAL.hpp>
+#include <Nazara/Audio/SoundStream.hpp>
+#include <Nazara/Core/ConditionVariable.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/Thread.hpp>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace Nz
+{
+	struct StreamedSource
+	{
+		std::atomic_bool streaming{false};
+		std::unique_ptr<SoundStream> stream;
+		std::vector<ALuint> buffers;
+		std::vector<Int16> chunkSamples;
+		UInt64 processedSamples = 0; //< Samples played before the buffers currently queued
+		UInt32 bufferDuration = 1000;
+		unsigned int bufferCount = NAZARA_AUDIO_STREAMED_BUFFER_COUNT;
+		unsigned int source;
+		bool endOfStream;
+		bool loop = false;
+		bool started;
+	};
+
+	class AudioStreamer
+	{
+		public:
+			AudioStreamer() = delete;
+			~AudioStreamer() = delete;
+
+			static Mutex& GetMutex();
+
+			static void Start(StreamedSource* streamedSource, unsigned int source);
+			static void Stop(StreamedSource* streamedSource);
+
+			static void Uninitialize();
+
+		private:
+			static void StreamingThread();
+
+			static ConditionVariable s_condition;
+			static Mutex s_mutex;
+			static Thread s_thread;
+			static std::vector<StreamedSource*> s_streamedSources;
+			static bool s_enabled;
+	};
+}
+
+#endif // NAZARA_AUDIOSTREAMER_HPP
@@ -10,12 +10,12 @@
 
 void* operator new(std::size_t size)
 {
-	return Nz::MemoryManager::Allocate(size, false);
+	return Nz::MemoryManager::Allocate(size, false, nullptr, 0, Nz::MemoryTag_Audio);
 }
 
 void* operator new[](std::size_t size)
 {
-	return Nz::MemoryManager::Allocate(size, true);
+	return Nz::MemoryManager::Allocate(size, true, nullptr, 0, Nz::MemoryTag_Audio);
 }
 
 void operator delete(void* pointer) noexcept
@@ -12,7 +12,9 @@
 #include <Nazara/Core/CallOnExit.hpp>
 #include <Nazara/Core/Endianness.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/ErrorFlags.hpp>
 #include <Nazara/Core/File.hpp>
+#include <Nazara/Core/MappedFile.hpp>
 #include <Nazara/Core/MemoryView.hpp>
 #include <Nazara/Core/Stream.hpp>
 #include <memory>
@@ -111,6 +113,18 @@ namespace Nz
 				{
 					// Nous devons gérer nous-même le flux car il doit rester ouvert après le passage du loader
 					// (les flux automatiquement ouverts par le ResourceLoader étant fermés après celui-ci)
+					// Le fichier est projeté en mémoire si possible, le streaming ne faisant alors plus d'appel au système pour lire
+					{
+						ErrorFlags errFlags(ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
+
+						std::unique_ptr<MappedFile> mappedFile(new MappedFile);
+						if (mappedFile->Open(filePath) && mappedFile->GetSize() > 0)
+						{
+							m_ownedStream = std::move(mappedFile);
+							return Open(*m_ownedStream, forceMono);
+						}
+					}
+
 					std::unique_ptr<File> file(new File);
 					if (!file->Open(filePath, OpenMode_ReadOnly))
 					{
@@ -353,6 +367,44 @@ namespace Nz
 			if (info.format & SF_FORMAT_VORBIS)
 				sf_command(file, SFC_SET_SCALE_FLOAT_INT_READ, nullptr, SF_TRUE);
 
+			// The file is kept as it is, and decoded by a sound stream of its own each time it's played
+			if (parameters.storage == SoundBufferStorage_Encoded)
+			{
+				std::vector<UInt8> encodedData(static_cast<std::size_t>(stream.GetSize()));
+				stream.SetCursorPos(0);
+				if (stream.Read(encodedData.data(), encodedData.size()) != encodedData.size())
+				{
+					NazaraError("Failed to read encoded data");
+					return false;
+				}
+
+				UInt64 frameCount = static_cast<UInt64>(info.frames);
+				UInt64 sampleCount = frameCount * info.channels;
+				if (parameters.forceMono && format != AudioFormat_Mono)
+				{
+					format = AudioFormat_Mono;
+					sampleCount = frameCount;
+				}
+
+				bool forceMono = parameters.forceMono;
+				auto decoder = [forceMono] (const void* data, std::size_t size) -> SoundStream*
+				{
+					std::unique_ptr<sndfileStream> soundStream(new sndfileStream);
+					if (!soundStream->Open(data, size, forceMono))
+						return nullptr;
+
+					return soundStream.release();
+				};
+
+				if (!soundBuffer->CreateEncoded(format, sampleCount, info.samplerate, std::move(encodedData), decoder))
+				{
+					NazaraError("Failed to create sound buffer");
+					return false;
+				}
+
+				return true;
+			}
+
 			unsigned int sampleCount = static_cast<unsigned int>(info.frames * info.channels);
 			std::unique_ptr<Int16[]> samples(new Int16[sampleCount]);
 
@@ -372,7 +424,7 @@ namespace Nz
 				sampleCount = static_cast<unsigned int>(info.frames);
 			}
 
-			if (!soundBuffer->Create(format, sampleCount, info.samplerate, samples.get()))
+			if (!soundBuffer->Create(format, sampleCount, info.samplerate, samples.get(), parameters.storage))
 			{
 				NazaraError("Failed to create sound buffer");
 				return false;
@@ -3,12 +3,13 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Audio/Music.hpp>
+#include <Nazara/Audio/AudioStreamer.hpp>
 #include <Nazara/Audio/OpenAL.hpp>
 #include <Nazara/Audio/SoundStream.hpp>
-#include <Nazara/Core/Mutex.hpp>
-#include <Nazara/Core/Thread.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/VirtualFile.hpp>
+#include <Nazara/Core/VirtualFileSystem.hpp>
 #include <memory>
-#include <vector>
 #include <Nazara/Audio/Debug.hpp>
 
 namespace Nz
@@ -18,6 +19,9 @@ namespace Nz
 	* \class Nz::Music
 	* \brief Audio class that represents a music
 	*
+	* Musics are streamed: they are decoded ahead of their playing, by buffers queued to their source.
+	* Every playing music is serviced by a single streaming thread, shared with the others.
+	*
 	* \remark Module Audio needs to be initialized to use this class
 	*/
 
@@ -33,15 +37,8 @@ namespace Nz
 
 	struct MusicImpl
 	{
-		ALenum audioFormat;
-		std::unique_ptr<SoundStream> stream;
-		std::vector<Int16> chunkSamples;
-		Mutex bufferLock;
-		Thread thread;
-		UInt64 processedSamples;
-		bool loop = false;
-		bool streaming = false;
-		unsigned int sampleRate;
+		std::unique_ptr<Stream> ownedStream; //< Archive entry the stream reads from, if any
+		StreamedSource streamedSource;
 	};
 
 	/*!
@@ -68,13 +65,8 @@ namespace Nz
 
 		Destroy();
 
-		AudioFormat format = soundStream->GetFormat();
-
 		m_impl = new MusicImpl;
-		m_impl->sampleRate = soundStream->GetSampleRate();
-		m_impl->audioFormat = OpenAL::AudioFormat[format];
-		m_impl->chunkSamples.resize(format * m_impl->sampleRate); // One second of samples
-		m_impl->stream.reset(soundStream);
+		m_impl->streamedSource.stream.reset(soundStream);
 
 		SetPlayingOffset(0);
 
@@ -90,7 +82,7 @@ namespace Nz
 	{
 		if (m_impl)
 		{
-			StopThread();
+			AudioStreamer::Stop(&m_impl->streamedSource);
 
 			delete m_impl;
 			m_impl = nullptr;
@@ -108,7 +100,7 @@ namespace Nz
 	{
 		NazaraAssert(m_impl, "Music not created");
 
-		m_impl->loop = loop;
+		m_impl->streamedSource.loop = loop;
 	}
 
 	/*!
@@ -121,7 +113,7 @@ namespace Nz
 	{
 		NazaraAssert(m_impl, "Music not created");
 
-		return m_impl->stream->GetDuration();
+		return m_impl->streamedSource.stream->GetDuration();
 	}
 
 	/*!
@@ -134,7 +126,7 @@ namespace Nz
 	{
 		NazaraAssert(m_impl, "Music not created");
 
-		return m_impl->stream->GetFormat();
+		return m_impl->streamedSource.stream->GetFormat();
 	}
 
 	/*!
@@ -147,13 +139,14 @@ namespace Nz
 	{
 		NazaraAssert(m_impl, "Music not created");
 
-		// Prevent music thread from enqueing new buffers while we're getting the count
-		Nz::LockGuard lock(m_impl->bufferLock);
+		// Prevent the streaming thread from enqueing new buffers while we're getting the count
+		LockGuard lock(AudioStreamer::GetMutex());
 
 		ALint samples = 0;
 		alGetSourcei(m_source, AL_SAMPLE_OFFSET, &samples);
 
-		return static_cast<UInt32>((1000ULL * (samples + (m_impl->processedSamples / m_impl->stream->GetFormat()))) / m_impl->sampleRate);
+		const StreamedSource& streamedSource = m_impl->streamedSource;
+		return static_cast<UInt32>((1000ULL * (samples + (streamedSource.processedSamples / streamedSource.stream->GetFormat()))) / streamedSource.stream->GetSampleRate());
 	}
 
 	/*!
@@ -166,7 +159,7 @@ namespace Nz
 	{
 		NazaraAssert(m_impl, "Music not created");
 
-		return m_impl->stream->GetSampleCount();
+		return m_impl->streamedSource.stream->GetSampleCount();
 	}
 
 	/*!
@@ -179,7 +172,7 @@ namespace Nz
 	{
 		NazaraAssert(m_impl, "Music not created");
 
-		return m_impl->sampleRate;
+		return m_impl->streamedSource.stream->GetSampleRate();
 	}
 
 	/*!
@@ -195,12 +188,38 @@ namespace Nz
 		SoundStatus status = GetInternalStatus();
 
 		// To compensate any delays (or the timelaps between Play() and the thread startup)
-		if (m_impl->streaming && status == SoundStatus_Stopped)
+		if (m_impl->streamedSource.streaming && status == SoundStatus_Stopped)
 			status = SoundStatus_Playing;
 
 		return status;
 	}
 
+	/*!
+	* \brief Gets the number of buffers the music is decoded in ahead of its playing
+	* \return Number of buffers
+	*
+	* \remark Music must be valid when calling this function
+	*/
+	unsigned int Music::GetStreamBufferCount() const
+	{
+		NazaraAssert(m_impl, "Music not created");
+
+		return m_impl->streamedSource.bufferCount;
+	}
+
+	/*!
+	* \brief Gets the duration of each buffer the music is decoded in
+	* \return Duration of a buffer in milliseconds
+	*
+	* \remark Music must be valid when calling this function
+	*/
+	UInt32 Music::GetStreamBufferDuration() const
+	{
+		NazaraAssert(m_impl, "Music not created");
+
+		return m_impl->streamedSource.bufferDuration;
+	}
+
 	/*!
 	* \brief Checks whether the music is looping
 	* \return true if it is the case
@@ -211,7 +230,7 @@ namespace Nz
 	{
 		NazaraAssert(m_impl, "Music not created");
 
-		return m_impl->loop;
+		return m_impl->streamedSource.loop;
 	}
 
 	/*!
@@ -223,6 +242,25 @@ namespace Nz
 	*/
 	bool Music::OpenFromFile(const String& filePath, const MusicParams& params)
 	{
+		// Entries of mounted archives are opened here since the music keeps reading from them after the loading
+		if (VirtualFileSystem::Exists(filePath))
+		{
+			std::unique_ptr<VirtualFile> file(new VirtualFile);
+			if (!VirtualFileSystem::Open(filePath, file.get()))
+			{
+				NazaraError("Failed to open \"" + filePath + "\" from its archive");
+				return false;
+			}
+
+			if (!MusicLoader::LoadFromStream(this, *file, params))
+				return false;
+
+			m_impl->ownedStream = std::move(file);
+			SetFilePath(filePath);
+
+			return true;
+		}
+
 		return MusicLoader::LoadFromFile(this, filePath, params);
 	}
 
@@ -282,7 +320,7 @@ namespace Nz
 		NazaraAssert(m_impl, "Music not created");
 
 		// Maybe we are already playing
-		if (m_impl->streaming)
+		if (m_impl->streamedSource.streaming)
 		{
 			switch (GetStatus())
 			{
@@ -300,9 +338,8 @@ namespace Nz
 		}
 		else
 		{
-			// Starting streaming's thread
-			m_impl->streaming = true;
-			m_impl->thread = Thread(&Music::MusicThread, this);
+			// The buffers are filled by the streaming thread, shared with every other music
+			AudioStreamer::Start(&m_impl->streamedSource, m_source);
 		}
 	}
 
@@ -319,134 +356,51 @@ namespace Nz
 	{
 		NazaraAssert(m_impl, "Music not created");
 
-		bool isPlaying = m_impl->streaming;
+		bool isPlaying = m_impl->streamedSource.streaming;
 
 		if (isPlaying)
 			Stop();
 
-		m_impl->stream->Seek(offset);
-		m_impl->processedSamples = UInt64(offset) * m_impl->sampleRate * m_impl->stream->GetFormat() / 1000ULL;
+		SoundStream* stream = m_impl->streamedSource.stream.get();
+		stream->Seek(offset);
+		m_impl->streamedSource.processedSamples = UInt64(offset) * stream->GetSampleRate() * stream->GetFormat() / 1000ULL;
 
 		if (isPlaying)
 			Play();
 	}
 
 	/*!
-	* \brief Stops the music
+	* \brief Sets how far ahead of its playing the music is decoded
+	*
+	* A longer decoding ahead resists to a busier system (reading from a slow drive for example) but uses more memory.
+	*
+	* \param bufferCount Number of buffers the music is decoded in, at least two
+	* \param bufferDuration Duration of each buffer in milliseconds
 	*
 	* \remark Music must be valid when calling this function
+	* \remark A playing music takes this buffering the next time it is played
 	*/
-	void Music::Stop()
+	void Music::SetStreamBuffering(unsigned int bufferCount, UInt32 bufferDuration)
 	{
 		NazaraAssert(m_impl, "Music not created");
+		NazaraAssert(bufferCount >= 2, "At least two buffers are needed for streaming");
+		NazaraAssert(bufferDuration > 0, "Invalid buffer duration");
 
-		StopThread();
-		SetPlayingOffset(0);
+		m_impl->streamedSource.bufferCount = bufferCount;
+		m_impl->streamedSource.bufferDuration = bufferDuration;
 	}
 
-	bool Music::FillAndQueueBuffer(unsigned int buffer)
-	{
-		std::size_t sampleCount = m_impl->chunkSamples.size();
-		std::size_t sampleRead = 0;
-
-		// Fill the buffer by reading from the stream
-		for (;;)
-		{
-			sampleRead += m_impl->stream->Read(&m_impl->chunkSamples[sampleRead], sampleCount - sampleRead);
-			if (sampleRead < sampleCount && m_impl->loop)
-			{
-				// In case we read less than expected, assume we reached the end of the stream and seek back to the beginning
-				m_impl->stream->Seek(0);
-				continue;
-			}
-
-			// Either we read the size we wanted, either we're not looping
-			break;
-		}
-
-		// Update the buffer (send it to OpenAL) and queue it if we got any data
-		if (sampleRead > 0)
-		{
-			alBufferData(buffer, m_impl->audioFormat, &m_impl->chunkSamples[0], static_cast<ALsizei>(sampleRead*sizeof(Int16)), static_cast<ALsizei>(m_impl->sampleRate));
-			alSourceQueueBuffers(m_source, 1, &buffer);
-		}
-
-		return sampleRead != sampleCount; // End of stream (Does not happen when looping)
-	}
-
-	void Music::MusicThread()
+	/*!
+	* \brief Stops the music
+	*
+	* \remark Music must be valid when calling this function
+	*/
+	void Music::Stop()
 	{
-		// Allocation of streaming buffers
-		ALuint buffers[NAZARA_AUDIO_STREAMED_BUFFER_COUNT];
-		alGenBuffers(NAZARA_AUDIO_STREAMED_BUFFER_COUNT, buffers);
-
-		for (unsigned int i = 0; i < NAZARA_AUDIO_STREAMED_BUFFER_COUNT; ++i)
-		{
-			if (FillAndQueueBuffer(buffers[i]))
-				break; // We have reached the end of the stream, there is no use to add new buffers
-		}
-
-		alSourcePlay(m_source);
-
-		// Reading loop (Filling new buffers as playing)
-		while (m_impl->streaming)
-		{
-			// The reading has stopped, we have reached the end of the stream
-			SoundStatus status = GetInternalStatus();
-			if (status == SoundStatus_Stopped)
-			{
-				m_impl->streaming = false;
-				break;
-			}
-
-			Nz::LockGuard lock(m_impl->bufferLock);
-
-			// We treat read buffers
-			ALint processedCount = 0;
-			alGetSourcei(m_source, AL_BUFFERS_PROCESSED, &processedCount);
-			while (processedCount--)
-			{
-				ALuint buffer;
-				alSourceUnqueueBuffers(m_source, 1, &buffer);
-
-				ALint bits, size;
-				alGetBufferi(buffer, AL_BITS, &bits);
-				alGetBufferi(buffer, AL_SIZE, &size);
-
-				if (bits != 0)
-					m_impl->processedSamples += (8 * size) / bits;
-
-				if (FillAndQueueBuffer(buffer))
-					break;
-			}
-
-			lock.Unlock();
-
-			// We go back to sleep
-			Thread::Sleep(50);
-		}
-
-		// Stop playing of the sound (in the case where it has not been already done)
-		alSourceStop(m_source);
-
-		// We delete buffers from the stream
-		ALint queuedBufferCount;
-		alGetSourcei(m_source, AL_BUFFERS_QUEUED, &queuedBufferCount);
-
-		ALuint buffer;
-		for (ALint i = 0; i < queuedBufferCount; ++i)
-			alSourceUnqueueBuffers(m_source, 1, &buffer);
-
-		alDeleteBuffers(NAZARA_AUDIO_STREAMED_BUFFER_COUNT, buffers);
-	}
+		NazaraAssert(m_impl, "Music not created");
 
-	void Music::StopThread()
-	{
-		if (m_impl->streaming)
-		{
-			m_impl->streaming = false;
-			m_impl->thread.Join();
-		}
+		AudioStreamer::Stop(&m_impl->streamedSource);
+		SetPlayingOffset(0);
 	}
 
 	MusicLoader::LoaderList Music::s_loaders;
@@ -3,13 +3,22 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Audio/Sound.hpp>
+#include <Nazara/Audio/AudioStreamer.hpp>
 #include <Nazara/Audio/Config.hpp>
 #include <Nazara/Audio/OpenAL.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/LockGuard.hpp>
 #include <Nazara/Audio/Debug.hpp>
 
 namespace Nz
 {
+	namespace
+	{
+		// Compressed buffers are decoded a bit ahead of their playing, in a ring much smaller than the whole sound
+		constexpr unsigned int StreamedBufferCount = 3;
+		constexpr UInt32 StreamedBufferDuration = 100;
+	}
+
 	/*!
 	* \ingroup audio
 	* \class Nz::Sound
@@ -48,6 +57,8 @@ namespace Nz
 	Sound::~Sound()
 	{
 		Stop();
+
+		delete m_streamedSource;
 	}
 
 	/*!
@@ -59,7 +70,10 @@ namespace Nz
 	{
 		NazaraAssert(m_source != InvalidSource, "Invalid sound emitter");
 
-		alSourcei(m_source, AL_LOOPING, loop);
+		if (m_streamedSource)
+			m_streamedSource->loop = loop;
+		else
+			alSourcei(m_source, AL_LOOPING, loop);
 	}
 
 	/*!
@@ -92,6 +106,17 @@ namespace Nz
 	{
 		NazaraAssert(m_source != InvalidSource, "Invalid sound emitter");
 
+		if (m_streamedSource)
+		{
+			// Prevent the streaming thread from enqueing new buffers while we're getting the count
+			LockGuard lock(AudioStreamer::GetMutex());
+
+			ALint samples = 0;
+			alGetSourcei(m_source, AL_SAMPLE_OFFSET, &samples);
+
+			return static_cast<UInt32>((1000ULL * (samples + (m_streamedSource->processedSamples / m_buffer->GetFormat()))) / m_buffer->GetSampleRate());
+		}
+
 		ALint samples = 0;
 		alGetSourcei(m_source, AL_SAMPLE_OFFSET, &samples);
 
@@ -104,7 +129,13 @@ namespace Nz
 	*/
 	SoundStatus Sound::GetStatus() const
 	{
-		return GetInternalStatus();
+		SoundStatus status = GetInternalStatus();
+
+		// To compensate the delay between Play() and the filling of the first buffers by the streaming thread
+		if (m_streamedSource && m_streamedSource->streaming && status == SoundStatus_Stopped)
+			status = SoundStatus_Playing;
+
+		return status;
 	}
 
 	/*!
@@ -115,6 +146,9 @@ namespace Nz
 	{
 		NazaraAssert(m_source != InvalidSource, "Invalid sound emitter");
 
+		if (m_streamedSource)
+			return m_streamedSource->loop;
+
 		ALint loop;
 		alGetSourcei(m_source, AL_LOOPING, &loop);
 
@@ -227,7 +261,50 @@ namespace Nz
 		NazaraAssert(m_source != InvalidSource, "Invalid sound emitter");
 		NazaraAssert(IsPlayable(), "Music is not playable");
 
-		alSourcePlay(m_source);
+		if (!m_streamedSource)
+		{
+			alSourcePlay(m_source);
+			return;
+		}
+
+		// Maybe we are already playing
+		if (m_streamedSource->streaming)
+		{
+			switch (GetStatus())
+			{
+				case SoundStatus_Playing:
+					SetPlayingOffset(0);
+					break;
+
+				case SoundStatus_Paused:
+					alSourcePlay(m_source);
+					break;
+
+				default:
+					break; // We shouldn't be stopped
+			}
+
+			return;
+		}
+
+		if (!m_streamedSource->stream)
+		{
+			m_streamedSource->stream = m_buffer->OpenStream();
+			if (!m_streamedSource->stream)
+			{
+				NazaraError("Failed to open sound buffer stream");
+				return;
+			}
+		}
+
+		// A sound which played until its end starts again from the beginning
+		if (m_streamedSource->processedSamples >= m_buffer->GetSampleCount())
+			m_streamedSource->processedSamples = 0;
+
+		UInt64 processedFrames = m_streamedSource->processedSamples / m_buffer->GetFormat();
+		m_streamedSource->stream->Seek(1000ULL * processedFrames / m_buffer->GetSampleRate());
+
+		AudioStreamer::Start(m_streamedSource, m_source);
 	}
 
 	/*!
@@ -247,8 +324,36 @@ namespace Nz
 
 		Stop();
 
+		bool loop = IsLooping();
+
 		m_buffer = buffer;
 
+		// Buffers not stored as PCM have no OpenAL buffer and are decoded while playing instead
+		if (m_buffer && m_buffer->GetStorage() != SoundBufferStorage_PCM)
+		{
+			if (!m_streamedSource)
+			{
+				m_streamedSource = new StreamedSource;
+				m_streamedSource->bufferCount = StreamedBufferCount;
+				m_streamedSource->bufferDuration = StreamedBufferDuration;
+			}
+
+			m_streamedSource->loop = loop;
+			m_streamedSource->stream.reset();
+
+			alSourcei(m_source, AL_BUFFER, AL_NONE);
+			alSourcei(m_source, AL_LOOPING, AL_FALSE);
+			return;
+		}
+
+		if (m_streamedSource)
+		{
+			delete m_streamedSource;
+			m_streamedSource = nullptr;
+
+			alSourcei(m_source, AL_LOOPING, loop);
+		}
+
 		if (m_buffer)
 			alSourcei(m_source, AL_BUFFER, m_buffer->GetOpenALBuffer());
 		else
@@ -264,6 +369,21 @@ namespace Nz
 	{
 		NazaraAssert(m_source != InvalidSource, "Invalid sound emitter");
 
+		if (m_streamedSource)
+		{
+			bool isPlaying = m_streamedSource->streaming;
+			if (isPlaying)
+				AudioStreamer::Stop(m_streamedSource);
+
+			// Play seeks the stream back to this offset
+			m_streamedSource->processedSamples = UInt64(offset) * m_buffer->GetSampleRate() / 1000ULL * m_buffer->GetFormat();
+
+			if (isPlaying)
+				Play();
+
+			return;
+		}
+
 		alSourcei(m_source, AL_SAMPLE_OFFSET, static_cast<ALint>(offset/1000.f * m_buffer->GetSampleRate()));
 	}
 
@@ -274,7 +394,12 @@ namespace Nz
 	*/
 	void Sound::Stop()
 	{
-		if (m_source != InvalidSource)
+		if (m_streamedSource)
+		{
+			AudioStreamer::Stop(m_streamedSource);
+			m_streamedSource->processedSamples = 0;
+		}
+		else if (m_source != InvalidSource)
 			alSourceStop(m_source);
 	}
 }
@@ -6,9 +6,13 @@
 #include <Nazara/Audio/Audio.hpp>
 #include <Nazara/Audio/Config.hpp>
 #include <Nazara/Audio/OpenAL.hpp>
+#include <Nazara/Audio/SoundStream.hpp>
 #include <Nazara/Core/CallOnExit.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Math/Algorithm.hpp>
+#include <algorithm>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <stdexcept>
 #include <Nazara/Audio/Debug.hpp>
@@ -17,6 +21,300 @@
 
 namespace Nz
 {
+	namespace
+	{
+		// IMA ADPCM, by blocks of frames decodable independently (for seeking), each channel starting by its predictor state
+		constexpr std::size_t AdpcmBlockFrameCount = 1024;
+		constexpr std::size_t AdpcmChannelBlockSize = 4 + AdpcmBlockFrameCount / 2;
+
+		const int s_adpcmIndexTable[16] = {
+			-1, -1, -1, -1, 2, 4, 6, 8,
+			-1, -1, -1, -1, 2, 4, 6, 8
+		};
+
+		const int s_adpcmStepTable[89] = {
+			7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+			130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060,
+			1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484,
+			7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+		};
+
+		struct AdpcmChannelState
+		{
+			int predictor = 0;
+			int stepIndex = 0;
+		};
+
+		int DecodeAdpcmNibble(AdpcmChannelState& state, UInt8 nibble)
+		{
+			int step = s_adpcmStepTable[state.stepIndex];
+
+			int delta = step >> 3;
+			if (nibble & 4)
+				delta += step;
+
+			if (nibble & 2)
+				delta += step >> 1;
+
+			if (nibble & 1)
+				delta += step >> 2;
+
+			state.predictor = Clamp(state.predictor + ((nibble & 8) ? -delta : delta), -32768, 32767);
+			state.stepIndex = Clamp(state.stepIndex + s_adpcmIndexTable[nibble], 0, 88);
+
+			return state.predictor;
+		}
+
+		UInt8 EncodeAdpcmNibble(AdpcmChannelState& state, int sample)
+		{
+			int step = s_adpcmStepTable[state.stepIndex];
+			int diff = sample - state.predictor;
+
+			UInt8 nibble = 0;
+			if (diff < 0)
+			{
+				nibble = 8;
+				diff = -diff;
+			}
+
+			// Same quantization as the decoder, so the encoder predicts exactly what will be decoded
+			for (UInt8 bit = 4; bit > 0; bit >>= 1)
+			{
+				if (diff >= step)
+				{
+					nibble |= bit;
+					diff -= step;
+				}
+
+				step >>= 1;
+			}
+
+			DecodeAdpcmNibble(state, nibble);
+
+			return nibble;
+		}
+
+		void DecodeAdpcmBlock(const UInt8* block, unsigned int channelCount, std::size_t frameCount, Int16* samples)
+		{
+			for (unsigned int channel = 0; channel < channelCount; ++channel)
+			{
+				const UInt8* channelBlock = &block[channel * AdpcmChannelBlockSize];
+
+				AdpcmChannelState state;
+				state.predictor = static_cast<Int16>(channelBlock[0] | (channelBlock[1] << 8));
+				state.stepIndex = channelBlock[2];
+
+				const UInt8* nibbles = &channelBlock[4];
+				for (std::size_t frame = 0; frame < frameCount; ++frame)
+				{
+					UInt8 nibble = (frame & 1) ? (nibbles[frame / 2] >> 4) : (nibbles[frame / 2] & 0x0F);
+					samples[frame * channelCount + channel] = static_cast<Int16>(DecodeAdpcmNibble(state, nibble));
+				}
+			}
+		}
+
+		void EncodeAdpcm(const Int16* samples, UInt64 frameCount, unsigned int channelCount, std::vector<UInt8>& data)
+		{
+			std::size_t blockSize = channelCount * AdpcmChannelBlockSize;
+			std::size_t blockCount = static_cast<std::size_t>((frameCount + AdpcmBlockFrameCount - 1) / AdpcmBlockFrameCount);
+			data.assign(blockCount * blockSize, 0);
+
+			std::vector<AdpcmChannelState> states(channelCount);
+			for (std::size_t blockIndex = 0; blockIndex < blockCount; ++blockIndex)
+			{
+				UInt64 firstFrame = UInt64(blockIndex) * AdpcmBlockFrameCount;
+				std::size_t blockFrameCount = static_cast<std::size_t>(std::min<UInt64>(AdpcmBlockFrameCount, frameCount - firstFrame));
+
+				for (unsigned int channel = 0; channel < channelCount; ++channel)
+				{
+					AdpcmChannelState& state = states[channel];
+
+					UInt8* channelBlock = &data[blockIndex * blockSize + channel * AdpcmChannelBlockSize];
+					channelBlock[0] = static_cast<UInt8>(state.predictor & 0xFF);
+					channelBlock[1] = static_cast<UInt8>((state.predictor >> 8) & 0xFF);
+					channelBlock[2] = static_cast<UInt8>(state.stepIndex);
+
+					UInt8* nibbles = &channelBlock[4];
+					for (std::size_t frame = 0; frame < blockFrameCount; ++frame)
+					{
+						UInt8 nibble = EncodeAdpcmNibble(state, samples[(firstFrame + frame) * channelCount + channel]);
+						nibbles[frame / 2] |= (frame & 1) ? (nibble << 4) : nibble;
+					}
+				}
+			}
+		}
+
+		class AdpcmStream : public SoundStream
+		{
+			public:
+				AdpcmStream(const SoundBuffer* buffer, const UInt8* data) :
+				m_buffer(buffer),
+				m_data(data),
+				m_cachedBlock(std::numeric_limits<std::size_t>::max()),
+				m_frame(0)
+				{
+					m_blockSamples.resize(AdpcmBlockFrameCount * buffer->GetFormat());
+				}
+
+				UInt32 GetDuration() const override
+				{
+					return m_buffer->GetDuration();
+				}
+
+				AudioFormat GetFormat() const override
+				{
+					return m_buffer->GetFormat();
+				}
+
+				UInt64 GetSampleCount() const override
+				{
+					return m_buffer->GetSampleCount();
+				}
+
+				UInt32 GetSampleRate() const override
+				{
+					return m_buffer->GetSampleRate();
+				}
+
+				UInt64 Read(void* buffer, UInt64 sampleCount) override
+				{
+					unsigned int channelCount = m_buffer->GetFormat();
+					UInt64 frameCount = m_buffer->GetSampleCount() / channelCount;
+
+					Int16* samples = static_cast<Int16*>(buffer);
+					UInt64 remainingFrames = sampleCount / channelCount;
+					UInt64 readFrames = 0;
+					while (remainingFrames > 0 && m_frame < frameCount)
+					{
+						std::size_t blockIndex = static_cast<std::size_t>(m_frame / AdpcmBlockFrameCount);
+						if (blockIndex != m_cachedBlock)
+						{
+							std::size_t blockFrameCount = static_cast<std::size_t>(std::min<UInt64>(AdpcmBlockFrameCount, frameCount - UInt64(blockIndex) * AdpcmBlockFrameCount));
+							DecodeAdpcmBlock(&m_data[blockIndex * channelCount * AdpcmChannelBlockSize], channelCount, blockFrameCount, m_blockSamples.data());
+
+							m_cachedBlock = blockIndex;
+						}
+
+						std::size_t blockFrame = static_cast<std::size_t>(m_frame % AdpcmBlockFrameCount);
+						UInt64 copiedFrames = std::min<UInt64>({remainingFrames, AdpcmBlockFrameCount - blockFrame, frameCount - m_frame});
+						std::memcpy(&samples[readFrames * channelCount], &m_blockSamples[blockFrame * channelCount], static_cast<std::size_t>(copiedFrames * channelCount * sizeof(Int16)));
+
+						m_frame += copiedFrames;
+						readFrames += copiedFrames;
+						remainingFrames -= copiedFrames;
+					}
+
+					return readFrames * channelCount;
+				}
+
+				void Seek(UInt64 offset) override
+				{
+					UInt64 frameCount = m_buffer->GetSampleCount() / m_buffer->GetFormat();
+					m_frame = std::min(offset * m_buffer->GetSampleRate() / 1000, frameCount);
+				}
+
+			private:
+				std::vector<Int16> m_blockSamples;
+				SoundBufferConstRef m_buffer;
+				const UInt8* m_data;
+				std::size_t m_cachedBlock;
+				UInt64 m_frame;
+		};
+
+		class EncodedStream : public SoundStream
+		{
+			public:
+				EncodedStream(const SoundBuffer* buffer, SoundStream* decoder) :
+				m_decoder(decoder),
+				m_buffer(buffer)
+				{
+				}
+
+				UInt32 GetDuration() const override
+				{
+					return m_decoder->GetDuration();
+				}
+
+				AudioFormat GetFormat() const override
+				{
+					return m_decoder->GetFormat();
+				}
+
+				UInt64 GetSampleCount() const override
+				{
+					return m_decoder->GetSampleCount();
+				}
+
+				UInt32 GetSampleRate() const override
+				{
+					return m_decoder->GetSampleRate();
+				}
+
+				UInt64 Read(void* buffer, UInt64 sampleCount) override
+				{
+					return m_decoder->Read(buffer, sampleCount);
+				}
+
+				void Seek(UInt64 offset) override
+				{
+					m_decoder->Seek(offset);
+				}
+
+			private:
+				std::unique_ptr<SoundStream> m_decoder; //< Reads from the data of the buffer, which is kept alive by the reference below
+				SoundBufferConstRef m_buffer;
+		};
+
+		class PcmStream : public SoundStream
+		{
+			public:
+				PcmStream(const SoundBuffer* buffer) :
+				m_buffer(buffer),
+				m_sample(0)
+				{
+				}
+
+				UInt32 GetDuration() const override
+				{
+					return m_buffer->GetDuration();
+				}
+
+				AudioFormat GetFormat() const override
+				{
+					return m_buffer->GetFormat();
+				}
+
+				UInt64 GetSampleCount() const override
+				{
+					return m_buffer->GetSampleCount();
+				}
+
+				UInt32 GetSampleRate() const override
+				{
+					return m_buffer->GetSampleRate();
+				}
+
+				UInt64 Read(void* buffer, UInt64 sampleCount) override
+				{
+					UInt64 readSamples = std::min(sampleCount, m_buffer->GetSampleCount() - m_sample);
+					std::memcpy(buffer, &m_buffer->GetSamples()[m_sample], static_cast<std::size_t>(readSamples * sizeof(Int16)));
+					m_sample += readSamples;
+
+					return readSamples;
+				}
+
+				void Seek(UInt64 offset) override
+				{
+					UInt64 frame = offset * m_buffer->GetSampleRate() / 1000;
+					m_sample = std::min(frame * m_buffer->GetFormat(), m_buffer->GetSampleCount());
+				}
+
+			private:
+				SoundBufferConstRef m_buffer;
+				UInt64 m_sample;
+		};
+	}
+
 	/*!
 	* \ingroup audio
 	* \class Nz::SoundBuffer
@@ -37,10 +335,13 @@ namespace Nz
 
 	struct SoundBufferImpl
 	{
-		ALuint buffer;
+		ALuint buffer = AL_NONE;
 		AudioFormat format;
+		SoundBuffer::StreamDecoder decoder;
+		SoundBufferStorage storage;
 		UInt32 duration;
 		std::unique_ptr<Int16[]> samples;
+		std::vector<UInt8> compressedData; //< ADPCM blocks or encoded file, for buffers decoded while playing
 		UInt64 sampleCount;
 		UInt32 sampleRate;
 	};
@@ -52,15 +353,16 @@ namespace Nz
 	* \param sampleCount Number of samples
 	* \param sampleRate Rate of samples
 	* \param samples Samples raw data
+	* \param storage How the samples are kept in memory, either SoundBufferStorage_PCM or SoundBufferStorage_ADPCM
 	*
 	* \remark Produces a NazaraError if creation went wrong with NAZARA_AUDIO_SAFE defined
 	* \remark Produces a std::runtime_error if creation went wrong with NAZARA_AUDIO_SAFE defined
 	*
 	* \see Create
 	*/
-	SoundBuffer::SoundBuffer(AudioFormat format, UInt64 sampleCount, UInt32 sampleRate, const Int16* samples)
+	SoundBuffer::SoundBuffer(AudioFormat format, UInt64 sampleCount, UInt32 sampleRate, const Int16* samples, SoundBufferStorage storage)
 	{
-		Create(format, sampleCount, sampleRate, samples);
+		Create(format, sampleCount, sampleRate, samples, storage);
 
 		#ifdef NAZARA_DEBUG
 		if (!m_impl)
@@ -91,11 +393,13 @@ namespace Nz
 	* \param sampleCount Number of samples
 	* \param sampleRate Rate of samples
 	* \param samples Samples raw data
+	* \param storage How the samples are kept in memory, either SoundBufferStorage_PCM or SoundBufferStorage_ADPCM
 	*
 	* \remark Produces a NazaraError if creation went wrong with NAZARA_AUDIO_SAFE defined,
 	* this could happen if parameters are invalid or creation of OpenAL buffers failed
+	* \remark An ADPCM buffer takes four times less memory than a PCM one (and has no OpenAL buffer), at the cost of some quality and of its decoding while playing
 	*/
-	bool SoundBuffer::Create(AudioFormat format, UInt64 sampleCount, UInt32 sampleRate, const Int16* samples)
+	bool SoundBuffer::Create(AudioFormat format, UInt64 sampleCount, UInt32 sampleRate, const Int16* samples, SoundBufferStorage storage)
 	{
 		Destroy();
 
@@ -123,8 +427,28 @@ namespace Nz
 			NazaraError("Invalid sample source");
 			return false;
 		}
+
+		if (storage != SoundBufferStorage_ADPCM && storage != SoundBufferStorage_PCM)
+		{
+			NazaraError("Samples can only be stored as PCM or ADPCM, encoded buffers are created by CreateEncoded");
+			return false;
+		}
 		#endif
 
+		if (storage == SoundBufferStorage_ADPCM)
+		{
+			m_impl = new SoundBufferImpl;
+			m_impl->duration = static_cast<UInt32>((1000ULL*sampleCount / (format * sampleRate)));
+			m_impl->format = format;
+			m_impl->sampleCount = sampleCount;
+			m_impl->sampleRate = sampleRate;
+			m_impl->storage = SoundBufferStorage_ADPCM;
+
+			EncodeAdpcm(samples, sampleCount / format, format, m_impl->compressedData);
+
+			return true;
+		}
+
 		// We empty the error stack
 		while (alGetError() != AL_NO_ERROR);
 
@@ -152,6 +476,7 @@ namespace Nz
 		m_impl->format = format;
 		m_impl->sampleCount = sampleCount;
 		m_impl->sampleRate = sampleRate;
+		m_impl->storage = SoundBufferStorage_PCM;
 		m_impl->samples.reset(new Int16[sampleCount]);
 		std::memcpy(&m_impl->samples[0], samples, sampleCount*sizeof(Int16));
 
@@ -160,6 +485,61 @@ namespace Nz
 		return true;
 	}
 
+	/*!
+	* \brief Creates the SoundBuffer object from encoded data, decoded each time the buffer is played
+	* \return true if creation is successful
+	*
+	* \param format Format of the decoded audio
+	* \param sampleCount Number of decoded samples
+	* \param sampleRate Rate of samples
+	* \param encodedData Encoded file (Ogg Vorbis, Opus, ...), kept by the buffer
+	* \param decoder Function opening a sound stream reading from the encoded data
+	*
+	* \remark Produces a NazaraError if creation went wrong with NAZARA_AUDIO_SAFE defined
+	* \remark Long sounds take much less memory this way, their decoding being spread on their playing by the audio streaming thread
+	*/
+	bool SoundBuffer::CreateEncoded(AudioFormat format, UInt64 sampleCount, UInt32 sampleRate, std::vector<UInt8> encodedData, StreamDecoder decoder)
+	{
+		Destroy();
+
+		#if NAZARA_AUDIO_SAFE
+		if (!IsFormatSupported(format))
+		{
+			NazaraError("Audio format is not supported");
+			return false;
+		}
+
+		if (sampleCount == 0)
+		{
+			NazaraError("Sample rate must be different from zero");
+			return false;
+		}
+
+		if (sampleRate == 0)
+		{
+			NazaraError("Sample rate must be different from zero");
+			return false;
+		}
+
+		if (encodedData.empty() || !decoder)
+		{
+			NazaraError("Invalid encoded data");
+			return false;
+		}
+		#endif
+
+		m_impl = new SoundBufferImpl;
+		m_impl->compressedData = std::move(encodedData);
+		m_impl->decoder = std::move(decoder);
+		m_impl->duration = static_cast<UInt32>((1000ULL*sampleCount / (format * sampleRate)));
+		m_impl->format = format;
+		m_impl->sampleCount = sampleCount;
+		m_impl->sampleRate = sampleRate;
+		m_impl->storage = SoundBufferStorage_Encoded;
+
+		return true;
+	}
+
 	/*!
 	* \brief Destroys the current sound buffer and frees resources
 	*/
@@ -170,6 +550,9 @@ namespace Nz
 		{
 			OnSoundBufferDestroy(this);
 
+			if (m_impl->buffer != AL_NONE)
+				alDeleteBuffers(1, &m_impl->buffer);
+
 			delete m_impl;
 			m_impl = nullptr;
 		}
@@ -202,9 +585,25 @@ namespace Nz
 		return m_impl->format;
 	}
 
+	/*!
+	* \brief Gets the memory taken by the samples of the sound buffer
+	* \return Size in bytes, counting the copy of PCM samples held by OpenAL
+	*
+	* \remark Produces a NazaraError if there is no sound buffer with NAZARA_AUDIO_SAFE defined
+	*/
+	std::size_t SoundBuffer::GetMemoryUsage() const
+	{
+		NazaraAssert(m_impl, "Sound buffer not created");
+
+		if (m_impl->storage == SoundBufferStorage_PCM)
+			return static_cast<std::size_t>(2 * m_impl->sampleCount * sizeof(Int16));
+		else
+			return m_impl->compressedData.size();
+	}
+
 	/*!
 	* \brief Gets the internal raw samples
-	* \return Pointer to raw data
+	* \return Pointer to raw data, nullptr if the samples are not stored as PCM
 	*
 	* \remark Produces a NazaraError if there is no sound buffer with NAZARA_AUDIO_SAFE defined
 	*/
@@ -241,6 +640,19 @@ namespace Nz
 		return m_impl->sampleRate;
 	}
 
+	/*!
+	* \brief Gets how the samples of the sound buffer are stored
+	* \return Samples storage
+	*
+	* \remark Produces a NazaraError if there is no sound buffer with NAZARA_AUDIO_SAFE defined
+	*/
+	SoundBufferStorage SoundBuffer::GetStorage() const
+	{
+		NazaraAssert(m_impl, "Sound buffer not created");
+
+		return m_impl->storage;
+	}
+
 	/*!
 	* \brief Checks whether the sound buffer is valid
 	* \return true if it is the case
@@ -288,6 +700,41 @@ namespace Nz
 		return SoundBufferLoader::LoadFromStream(this, stream, params);
 	}
 
+	/*!
+	* \brief Opens a stream decoding the samples of the sound buffer
+	* \return Sound stream, keeping a reference to the sound buffer, or nullptr if the decoder failed
+	*
+	* \remark Produces a NazaraError if there is no sound buffer with NAZARA_AUDIO_SAFE defined
+	*/
+	std::unique_ptr<SoundStream> SoundBuffer::OpenStream() const
+	{
+		NazaraAssert(m_impl, "Sound buffer not created");
+
+		switch (m_impl->storage)
+		{
+			case SoundBufferStorage_ADPCM:
+				return std::make_unique<AdpcmStream>(this, m_impl->compressedData.data());
+
+			case SoundBufferStorage_Encoded:
+			{
+				SoundStream* decoder = m_impl->decoder(m_impl->compressedData.data(), m_impl->compressedData.size());
+				if (!decoder)
+				{
+					NazaraError("Failed to decode sound buffer");
+					return nullptr;
+				}
+
+				return std::make_unique<EncodedStream>(this, decoder);
+			}
+
+			case SoundBufferStorage_PCM:
+				return std::make_unique<PcmStream>(this);
+		}
+
+		NazaraInternalError("Unhandled storage 0x" + String::Number(m_impl->storage, 16));
+		return nullptr;
+	}
+
 	/*!
 	* \brief Checks whether the format is supported by the engine
 	* \return true if it is the case
@@ -301,7 +748,7 @@ namespace Nz
 
 	/*!
 	* \brief Gets the internal OpenAL buffer
-	* \return The index of the OpenAL buffer
+	* \return The index of the OpenAL buffer, AL_NONE if the samples are not stored as PCM
 	*
 	* \remark Produces a NazaraError if there is no sound buffer with NAZARA_AUDIO_SAFE defined
 	*/
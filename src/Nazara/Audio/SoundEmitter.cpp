@@ -310,6 +310,39 @@ namespace Nz
 		return *this;
 	}
 
+	/*!
+	* \brief Sets the position and the velocity of many emitters at once
+	*
+	* \param updates Emitters along with their new position and velocity
+	* \param updateCount Number of updates
+	* \param suspendContext Should the context be suspended during the updates, so that they are applied together
+	*
+	* \remark Suspending the context is only a hint, some implementations keep processing it
+	*/
+	void SoundEmitter::UpdateSpatialization(const SpatialUpdate* updates, std::size_t updateCount, bool suspendContext)
+	{
+		NazaraAssert(updates || updateCount == 0, "Invalid updates");
+
+		if (updateCount == 0)
+			return;
+
+		ALCcontext* context = (suspendContext) ? alcGetCurrentContext() : nullptr;
+		if (context)
+			alcSuspendContext(context);
+
+		for (std::size_t i = 0; i < updateCount; ++i)
+		{
+			const SpatialUpdate& update = updates[i];
+			NazaraAssert(update.emitter && update.emitter->m_source != InvalidSource, "Invalid sound emitter");
+
+			alSourcefv(update.emitter->m_source, AL_POSITION, update.position);
+			alSourcefv(update.emitter->m_source, AL_VELOCITY, update.velocity);
+		}
+
+		if (context)
+			alcProcessContext(context);
+	}
+
 	/*!
 	* \brief Gets the status of the sound emitter
 	* \return Enumeration of type SoundStatus (Playing, Stopped, ...)
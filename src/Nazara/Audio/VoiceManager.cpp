@@ -0,0 +1,636 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Audio module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Audio/VoiceManager.hpp>
+#include <Nazara/Audio/Audio.hpp>
+#include <Nazara/Audio/OpenAL.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Math/Algorithm.hpp>
+#include <algorithm>
+#include <cmath>
+
+#if defined(NAZARA_SIMD_SSE2)
+	#include <emmintrin.h>
+#endif
+
+#include <Nazara/Audio/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		constexpr std::size_t MixBufferCount = 4;
+		constexpr std::size_t MixChunkSize = 1024; //< Per buffer, around 23ms at the rate of the mix
+		constexpr UInt32 MixSampleRate = 44100;
+		constexpr unsigned int InvalidSource = std::numeric_limits<unsigned int>::max();
+
+		void AccumulateSamples(const float* samples, std::size_t sampleCount, float gain, float* mix)
+		{
+			std::size_t i = 0;
+
+			#if defined(NAZARA_SIMD_SSE2)
+			__m128 gains = _mm_set1_ps(gain);
+			for (; i + 4 <= sampleCount; i += 4)
+				_mm_storeu_ps(&mix[i], _mm_add_ps(_mm_loadu_ps(&mix[i]), _mm_mul_ps(_mm_loadu_ps(&samples[i]), gains)));
+			#endif
+
+			for (; i < sampleCount; ++i)
+				mix[i] += samples[i] * gain;
+		}
+
+		void ConvertSamples(const float* mix, std::size_t sampleCount, Int16* samples)
+		{
+			std::size_t i = 0;
+
+			#if defined(NAZARA_SIMD_SSE2)
+			__m128 minimum = _mm_set1_ps(-1.f);
+			__m128 maximum = _mm_set1_ps(1.f);
+			__m128 scale = _mm_set1_ps(32767.f);
+			for (; i + 8 <= sampleCount; i += 8)
+			{
+				__m128 low = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(&mix[i]), minimum), maximum);
+				__m128 high = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(&mix[i + 4]), minimum), maximum);
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&samples[i]), _mm_packs_epi32(_mm_cvtps_epi32(_mm_mul_ps(low, scale)), _mm_cvtps_epi32(_mm_mul_ps(high, scale))));
+			}
+			#endif
+
+			for (; i < sampleCount; ++i)
+				samples[i] = static_cast<Int16>(Clamp(mix[i], -1.f, 1.f) * 32767.f);
+		}
+
+		double GetBufferDuration(const SoundBuffer* buffer)
+		{
+			UInt64 frameCount = buffer->GetSampleCount() / static_cast<unsigned int>(buffer->GetFormat());
+			return static_cast<double>(frameCount) / buffer->GetSampleRate();
+		}
+	}
+
+	/*!
+	* \ingroup audio
+	* \class Nz::VoiceManager
+	* \brief Audio class that plays many short sounds over a limited number of OpenAL sources
+	*
+	* Sounds played through the manager are voices, they don't own a source and keep playing (their time advances) even while they aren't heard.
+	* Each update ranks the audible voices by priority then by how loud they are heard by the listener, the first ones taking the sources of the manager.
+	* A voice losing its rank gives its source back to the more important one (voice stealing), voices too far from the listener are culled.
+	*
+	* Optionally, the voices ranked just after the ones playing on a source are mixed together in software into a single streaming source.
+	* The mix isn't spatialized, the distance to the listener only lowering the volume of a voice.
+	*
+	* \remark Module Audio needs to be initialized to use this class
+	* \remark OpenAL attenuates the voices playing on a source with its default distance model, the manager ranks them with the same model
+	*/
+
+	/*!
+	* \brief Constructs a VoiceManager object
+	*
+	* \param sourceCount Number of OpenAL sources used to play voices
+	* \param mixingCapacity Maximum number of voices mixed in software, zero disables the software mixing
+	*/
+
+	VoiceManager::VoiceManager(unsigned int sourceCount, unsigned int mixingCapacity) :
+	m_maxDistance(std::numeric_limits<float>::infinity()),
+	m_activeVoiceCount(0),
+	m_mixedVoiceCount(0),
+	m_mixingCapacity(mixingCapacity),
+	m_mixSource(InvalidSource),
+	m_sourceVoiceCount(0)
+	{
+		m_sources.resize(sourceCount);
+		m_sourceVoices.resize(sourceCount, InvalidIndex);
+		if (sourceCount > 0)
+			alGenSources(static_cast<ALsizei>(sourceCount), m_sources.data());
+
+		if (m_mixingCapacity > 0)
+		{
+			m_mixAccumulator.resize(MixChunkSize);
+			m_mixSamples.resize(MixChunkSize);
+			m_mixScratch.resize(MixChunkSize);
+
+			// The mix is already attenuated, it plays at the position of the listener
+			alGenSources(1, &m_mixSource);
+			alSourcei(m_mixSource, AL_SOURCE_RELATIVE, AL_TRUE);
+			alSource3f(m_mixSource, AL_POSITION, 0.f, 0.f, 0.f);
+
+			// Buffers are queued with silence, the updates mixing the voices in them as they are processed
+			m_mixBuffers.resize(MixBufferCount);
+			alGenBuffers(static_cast<ALsizei>(MixBufferCount), m_mixBuffers.data());
+			for (unsigned int buffer : m_mixBuffers)
+			{
+				MixChunk();
+
+				alBufferData(buffer, OpenAL::AudioFormat[AudioFormat_Mono], m_mixSamples.data(), static_cast<ALsizei>(MixChunkSize * sizeof(Int16)), static_cast<ALsizei>(MixSampleRate));
+				alSourceQueueBuffers(m_mixSource, 1, &buffer);
+			}
+		}
+	}
+
+	/*!
+	* \brief Destructs the object, stopping every voice
+	*/
+
+	VoiceManager::~VoiceManager()
+	{
+		StopAll();
+
+		if (!m_sources.empty())
+			alDeleteSources(static_cast<ALsizei>(m_sources.size()), m_sources.data());
+
+		if (m_mixSource != InvalidSource)
+		{
+			alSourceStop(m_mixSource);
+			alSourcei(m_mixSource, AL_BUFFER, AL_NONE); // Unqueues every buffer
+
+			alDeleteSources(1, &m_mixSource);
+			alDeleteBuffers(static_cast<ALsizei>(m_mixBuffers.size()), m_mixBuffers.data());
+		}
+	}
+
+	/*!
+	* \brief Gets the distance from the listener beyond which voices are culled
+	* \return Maximum distance, infinite by default
+	*/
+
+	float VoiceManager::GetMaxDistance() const
+	{
+		return m_maxDistance;
+	}
+
+	/*!
+	* \brief Gets the number of voices mixed in software by the last update
+	* \return Number of mixed voices
+	*/
+
+	unsigned int VoiceManager::GetMixedVoiceCount() const
+	{
+		return m_mixedVoiceCount;
+	}
+
+	/*!
+	* \brief Gets the maximum number of voices mixed in software
+	* \return Mixing capacity, zero if the software mixing is disabled
+	*/
+
+	unsigned int VoiceManager::GetMixingCapacity() const
+	{
+		return m_mixingCapacity;
+	}
+
+	/*!
+	* \brief Gets the number of OpenAL sources used to play voices
+	* \return Number of sources
+	*/
+
+	unsigned int VoiceManager::GetSourceCount() const
+	{
+		return static_cast<unsigned int>(m_sources.size());
+	}
+
+	/*!
+	* \brief Gets the number of voices playing on an OpenAL source
+	* \return Number of voices having a source
+	*/
+
+	unsigned int VoiceManager::GetSourceVoiceCount() const
+	{
+		return m_sourceVoiceCount;
+	}
+
+	/*!
+	* \brief Gets the number of voices which aren't heard, because they are culled or out of the sources and mixing capacity
+	* \return Number of virtual voices
+	*/
+
+	unsigned int VoiceManager::GetVirtualVoiceCount() const
+	{
+		return m_activeVoiceCount - m_sourceVoiceCount - m_mixedVoiceCount;
+	}
+
+	/*!
+	* \brief Gets the number of playing voices, whether they are heard or not
+	* \return Number of voices
+	*/
+
+	unsigned int VoiceManager::GetVoiceCount() const
+	{
+		return m_activeVoiceCount;
+	}
+
+	/*!
+	* \brief Checks whether a voice is still playing
+	* \return true If the voice didn't end nor was stopped
+	*
+	* \param voiceId Identifier returned by Play
+	*/
+
+	bool VoiceManager::IsVoicePlaying(VoiceId voiceId) const
+	{
+		return GetVoice(voiceId) != nullptr;
+	}
+
+	/*!
+	* \brief Plays a sound buffer as a voice
+	* \return Identifier of the voice, which stays invalid once the voice ended
+	*
+	* \param buffer Sound buffer to play, mono to be spatialized
+	* \param position Position of the voice
+	* \param priority Priority of the voice, voices of a higher priority being heard before the ones of a lower priority
+	* \param volume Volume of the voice, between 0 and 100
+	* \param loop Should the voice loop until it is stopped
+	*
+	* \remark The voice is only heard after the next update, which ranks it
+	*/
+
+	VoiceManager::VoiceId VoiceManager::Play(const SoundBuffer* buffer, const Vector3f& position, int priority, float volume, bool loop)
+	{
+		NazaraAssert(buffer && buffer->IsValid(), "Invalid sound buffer");
+		NazaraAssert(buffer->GetStorage() == SoundBufferStorage_PCM, "Voices can only play buffers stored as PCM");
+
+		std::size_t voiceIndex;
+		if (!m_freeVoices.empty())
+		{
+			voiceIndex = m_freeVoices.back();
+			m_freeVoices.pop_back();
+		}
+		else
+		{
+			voiceIndex = m_voices.size();
+			m_voices.emplace_back();
+		}
+
+		Voice& voice = m_voices[voiceIndex];
+		voice.active = true;
+		voice.audibility = 0.f;
+		voice.buffer = buffer;
+		voice.loop = loop;
+		voice.playingTime = 0.0;
+		voice.position = position;
+		voice.priority = priority;
+		voice.source = InvalidIndex;
+		voice.state = VoiceState_Virtual;
+		voice.volume = volume;
+
+		m_activeVoiceCount++;
+
+		return (static_cast<VoiceId>(voice.generation) << 32) | voiceIndex;
+	}
+
+	/*!
+	* \brief Sets the distance from the listener beyond which voices are culled
+	*
+	* \param maxDistance Maximum distance
+	*/
+
+	void VoiceManager::SetMaxDistance(float maxDistance)
+	{
+		m_maxDistance = maxDistance;
+	}
+
+	/*!
+	* \brief Moves a voice
+	*
+	* \param voiceId Identifier returned by Play, ignored if the voice ended
+	* \param position Position of the voice
+	*/
+
+	void VoiceManager::SetVoicePosition(VoiceId voiceId, const Vector3f& position)
+	{
+		if (Voice* voice = GetVoice(voiceId))
+			voice->position = position;
+	}
+
+	/*!
+	* \brief Sets the volume of a voice
+	*
+	* \param voiceId Identifier returned by Play, ignored if the voice ended
+	* \param volume Volume of the voice, between 0 and 100
+	*/
+
+	void VoiceManager::SetVoiceVolume(VoiceId voiceId, float volume)
+	{
+		if (Voice* voice = GetVoice(voiceId))
+			voice->volume = volume;
+	}
+
+	/*!
+	* \brief Stops every voice
+	*/
+
+	void VoiceManager::StopAll()
+	{
+		for (std::size_t i = 0; i < m_voices.size(); ++i)
+		{
+			if (m_voices[i].active)
+				ReleaseVoice(i);
+		}
+	}
+
+	/*!
+	* \brief Stops a voice
+	*
+	* \param voiceId Identifier returned by Play, ignored if the voice ended
+	*/
+
+	void VoiceManager::StopVoice(VoiceId voiceId)
+	{
+		if (GetVoice(voiceId))
+			ReleaseVoice(static_cast<std::size_t>(voiceId & 0xFFFFFFFF));
+	}
+
+	/*!
+	* \brief Ranks the voices, giving the sources and the mix to the most important ones
+	*
+	* \param elapsedTime Time elapsed since the last update, in seconds
+	*
+	* \remark The listener is the OpenAL one, set through the Audio class
+	*/
+
+	void VoiceManager::Update(float elapsedTime)
+	{
+		Vector3f listenerPosition = Audio::GetListenerPosition();
+
+		m_rankedVoices.clear();
+		for (std::size_t i = 0; i < m_voices.size(); ++i)
+		{
+			Voice& voice = m_voices[i];
+			if (!voice.active)
+				continue;
+
+			if (voice.state == VoiceState_Source)
+			{
+				ALuint source = m_sources[voice.source];
+
+				ALint state;
+				alGetSourcei(source, AL_SOURCE_STATE, &state);
+				if (state == AL_STOPPED)
+				{
+					ReleaseVoice(i);
+					continue;
+				}
+
+				ALfloat offset;
+				alGetSourcef(source, AL_SEC_OFFSET, &offset);
+				voice.playingTime = offset;
+			}
+			else if (voice.state == VoiceState_Virtual)
+				voice.playingTime += elapsedTime;
+			// Mixed voices advance as their samples are mixed
+
+			double duration = GetBufferDuration(voice.buffer);
+			if (voice.playingTime >= duration)
+			{
+				if (!voice.loop)
+				{
+					ReleaseVoice(i);
+					continue;
+				}
+
+				voice.playingTime = std::fmod(voice.playingTime, duration);
+			}
+
+			// Same attenuation as the default distance model of OpenAL (inverse distance clamped, with a reference distance and a rolloff factor of one)
+			float distance = listenerPosition.Distance(voice.position);
+			voice.audibility = (distance <= m_maxDistance) ? voice.volume * 0.01f / std::max(distance, 1.f) : 0.f;
+
+			if (voice.audibility > 0.f)
+				m_rankedVoices.push_back(i);
+			else
+				SetVoiceState(voice, i, VoiceState_Virtual);
+		}
+
+		std::sort(m_rankedVoices.begin(), m_rankedVoices.end(), [this](std::size_t first, std::size_t second)
+		{
+			const Voice& firstVoice = m_voices[first];
+			const Voice& secondVoice = m_voices[second];
+			if (firstVoice.priority != secondVoice.priority)
+				return firstVoice.priority > secondVoice.priority;
+
+			if (firstVoice.audibility != secondVoice.audibility)
+				return firstVoice.audibility > secondVoice.audibility;
+
+			return first < second;
+		});
+
+		// Voices losing their rank give their source back before the others take them
+		std::size_t sourceCount = m_sources.size();
+		for (std::size_t rank = sourceCount; rank < m_rankedVoices.size(); ++rank)
+		{
+			std::size_t voiceIndex = m_rankedVoices[rank];
+			SetVoiceState(m_voices[voiceIndex], voiceIndex, (rank < sourceCount + m_mixingCapacity) ? VoiceState_Mixed : VoiceState_Virtual);
+		}
+
+		std::size_t sourceVoiceCount = std::min(sourceCount, m_rankedVoices.size());
+		for (std::size_t rank = 0; rank < sourceVoiceCount; ++rank)
+		{
+			std::size_t voiceIndex = m_rankedVoices[rank];
+			Voice& voice = m_voices[voiceIndex];
+			if (voice.state == VoiceState_Source)
+			{
+				ALuint source = m_sources[voice.source];
+				alSourcefv(source, AL_POSITION, voice.position);
+				alSourcef(source, AL_GAIN, voice.volume * 0.01f);
+			}
+			else
+				SetVoiceState(voice, voiceIndex, VoiceState_Source);
+		}
+
+		if (m_mixSource != InvalidSource)
+			UpdateMixing();
+	}
+
+	VoiceManager::Voice* VoiceManager::GetVoice(VoiceId voiceId)
+	{
+		return const_cast<Voice*>(static_cast<const VoiceManager*>(this)->GetVoice(voiceId));
+	}
+
+	const VoiceManager::Voice* VoiceManager::GetVoice(VoiceId voiceId) const
+	{
+		std::size_t voiceIndex = static_cast<std::size_t>(voiceId & 0xFFFFFFFF);
+		if (voiceIndex >= m_voices.size())
+			return nullptr;
+
+		const Voice& voice = m_voices[voiceIndex];
+		if (!voice.active || voice.generation != static_cast<UInt32>(voiceId >> 32))
+			return nullptr;
+
+		return &voice;
+	}
+
+	/*!
+	* \brief Mixes the next chunk of the mixed voices
+	*/
+
+	void VoiceManager::MixChunk()
+	{
+		std::fill(m_mixAccumulator.begin(), m_mixAccumulator.end(), 0.f);
+
+		for (Voice& voice : m_voices)
+		{
+			if (!voice.active || voice.state != VoiceState_Mixed)
+				continue;
+
+			const SoundBuffer* buffer = voice.buffer;
+			const Int16* samples = buffer->GetSamples();
+			unsigned int channelCount = static_cast<unsigned int>(buffer->GetFormat());
+			UInt64 frameCount = buffer->GetSampleCount() / channelCount;
+			double sampleRate = buffer->GetSampleRate();
+
+			// Nearest neighbour resampling to the rate of the mix, channels being averaged
+			double frame = voice.playingTime * sampleRate;
+			double frameStep = sampleRate / MixSampleRate;
+			float sampleFactor = 1.f / (channelCount * 32768.f);
+
+			std::size_t mixedFrames = 0;
+			for (; mixedFrames < MixChunkSize; ++mixedFrames, frame += frameStep)
+			{
+				UInt64 frameIndex = static_cast<UInt64>(frame);
+				if (frameIndex >= frameCount)
+				{
+					if (!voice.loop)
+						break;
+
+					frameIndex %= frameCount;
+				}
+
+				const Int16* frameSamples = &samples[frameIndex * channelCount];
+
+				int sum = 0;
+				for (unsigned int channel = 0; channel < channelCount; ++channel)
+					sum += frameSamples[channel];
+
+				m_mixScratch[mixedFrames] = sum * sampleFactor;
+			}
+
+			AccumulateSamples(m_mixScratch.data(), mixedFrames, voice.audibility, m_mixAccumulator.data());
+
+			voice.playingTime += static_cast<double>(MixChunkSize) / MixSampleRate;
+		}
+
+		ConvertSamples(m_mixAccumulator.data(), MixChunkSize, m_mixSamples.data());
+	}
+
+	/*!
+	* \brief Stops the source of a voice, making it available to another voice
+	*
+	* \param voice Voice playing on a source
+	*/
+
+	void VoiceManager::ReleaseSource(Voice& voice)
+	{
+		ALuint source = m_sources[voice.source];
+		alSourceStop(source);
+		alSourcei(source, AL_BUFFER, AL_NONE);
+
+		m_sourceVoices[voice.source] = InvalidIndex;
+		m_sourceVoiceCount--;
+
+		voice.source = InvalidIndex;
+	}
+
+	/*!
+	* \brief Ends a voice
+	*
+	* \param voiceIndex Index of the voice
+	*/
+
+	void VoiceManager::ReleaseVoice(std::size_t voiceIndex)
+	{
+		Voice& voice = m_voices[voiceIndex];
+		SetVoiceState(voice, voiceIndex, VoiceState_Virtual);
+
+		voice.active = false;
+		voice.buffer.Reset();
+		voice.generation++; // Identifiers of the ended voice become invalid
+
+		m_activeVoiceCount--;
+		m_freeVoices.push_back(voiceIndex);
+	}
+
+	/*!
+	* \brief Changes the way a voice is played
+	*
+	* \param voice Voice to change
+	* \param voiceIndex Index of the voice
+	* \param state New state, a voice which can't get a source becoming virtual
+	*/
+
+	void VoiceManager::SetVoiceState(Voice& voice, std::size_t voiceIndex, VoiceState state)
+	{
+		if (voice.state == state)
+			return;
+
+		if (voice.state == VoiceState_Source)
+			ReleaseSource(voice);
+		else if (voice.state == VoiceState_Mixed)
+			m_mixedVoiceCount--;
+
+		voice.state = state;
+
+		if (state == VoiceState_Source)
+		{
+			if (!StartSource(voice, voiceIndex))
+				voice.state = VoiceState_Virtual;
+		}
+		else if (state == VoiceState_Mixed)
+			m_mixedVoiceCount++;
+	}
+
+	/*!
+	* \brief Plays a voice on a free source, from its playing time
+	* \return true If a source was free
+	*
+	* \param voice Voice to play
+	* \param voiceIndex Index of the voice
+	*/
+
+	bool VoiceManager::StartSource(Voice& voice, std::size_t voiceIndex)
+	{
+		auto it = std::find(m_sourceVoices.begin(), m_sourceVoices.end(), InvalidIndex);
+		if (it == m_sourceVoices.end())
+			return false;
+
+		*it = voiceIndex;
+		m_sourceVoiceCount++;
+
+		voice.source = static_cast<std::size_t>(it - m_sourceVoices.begin());
+
+		ALuint source = m_sources[voice.source];
+		alSourcei(source, AL_BUFFER, voice.buffer->GetOpenALBuffer());
+		alSourcei(source, AL_LOOPING, voice.loop);
+		alSourcef(source, AL_GAIN, voice.volume * 0.01f);
+		alSourcefv(source, AL_POSITION, voice.position);
+		alSourcef(source, AL_SEC_OFFSET, static_cast<ALfloat>(voice.playingTime));
+		alSourcePlay(source);
+
+		return true;
+	}
+
+	/*!
+	* \brief Mixes the voices in the processed buffers of the mix source and queues them back
+	*/
+
+	void VoiceManager::UpdateMixing()
+	{
+		ALint processedCount = 0;
+		alGetSourcei(m_mixSource, AL_BUFFERS_PROCESSED, &processedCount);
+
+		while (processedCount-- > 0)
+		{
+			ALuint buffer;
+			alSourceUnqueueBuffers(m_mixSource, 1, &buffer);
+
+			MixChunk();
+
+			alBufferData(buffer, OpenAL::AudioFormat[AudioFormat_Mono], m_mixSamples.data(), static_cast<ALsizei>(MixChunkSize * sizeof(Int16)), static_cast<ALsizei>(MixSampleRate));
+			alSourceQueueBuffers(m_mixSource, 1, &buffer);
+		}
+
+		// Starts the stream, or restarts it when the updates were too slow to keep it fed
+		ALint state;
+		alGetSourcei(m_mixSource, AL_SOURCE_STATE, &state);
+		if (state != AL_PLAYING)
+			alSourcePlay(m_mixSource);
+	}
+}
@@ -5,6 +5,7 @@
 #include <Nazara/Core/AbstractHash.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/Hash/CRC32.hpp>
+#include <Nazara/Core/Hash/CRC32C.hpp>
 #include <Nazara/Core/Hash/CRC64.hpp>
 #include <Nazara/Core/Hash/Fletcher16.hpp>
 #include <Nazara/Core/Hash/MD5.hpp>
@@ -14,6 +15,7 @@
 #include <Nazara/Core/Hash/SHA384.hpp>
 #include <Nazara/Core/Hash/SHA512.hpp>
 #include <Nazara/Core/Hash/Whirlpool.hpp>
+#include <Nazara/Core/Hash/XXH3.hpp>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
@@ -49,6 +51,9 @@ namespace Nz
 			case HashType_CRC32:
 				return std::make_unique<HashCRC32>();
 
+			case HashType_CRC32C:
+				return std::make_unique<HashCRC32C>();
+
 			case HashType_CRC64:
 				return std::make_unique<HashCRC64>();
 
@@ -72,6 +77,9 @@ namespace Nz
 
 			case HashType_Whirlpool:
 				return std::make_unique<HashWhirlpool>();
+
+			case HashType_XXH3:
+				return std::make_unique<HashXXH3>();
 		}
 
 		NazaraInternalError("Hash type not handled (0x" + String::Number(type, 16) + ')');
@@ -30,6 +30,16 @@ namespace Nz
 
 	AbstractLogger::~AbstractLogger() = default;
 
+	/*!
+	* \brief Makes sure everything written until now reached its destination
+	*
+	* \remark Does nothing by default, for loggers writing directly
+	*/
+
+	void AbstractLogger::Flush()
+	{
+	}
+
 	/*!
 	* \brief Writes the error in StringStream
 	*
@@ -0,0 +1,45 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/AbstractMetricsExporter.hpp>
+#include <cmath>
+#include <limits>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::AbstractMetricsExporter
+	* \brief Core class that represents the behaviour of the classes turning metrics into text, for a monitoring system
+	*
+	* \remark This class is abstract
+	*/
+
+	AbstractMetricsExporter::~AbstractMetricsExporter() = default;
+
+	/*!
+	* \fn Nz::AbstractMetricsExporter::Export(const std::vector<Metrics::Sample>& samples)
+	* \brief Turns samples into text
+	* \return Text to send to the monitoring system
+	*
+	* \param samples Samples collected by Metrics::Collect
+	*/
+
+	/*!
+	* \brief Formats the value of a metric
+	* \return Value as text, integral values being written without exponent
+	*
+	* \param value Value to format
+	*/
+
+	String AbstractMetricsExporter::FormatValue(double value)
+	{
+		// Counters easily go beyond the digits of String::Number(double), which would write them with an exponent
+		if (std::trunc(value) == value && std::abs(value) < static_cast<double>(std::numeric_limits<Int64>::max()))
+			return String::Number(static_cast<long long>(value));
+
+		return String::Number(value);
+	}
+}
@@ -0,0 +1,233 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Archive.hpp>
+#include <Nazara/Core/ByteStream.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/Lz4.hpp>
+#include <algorithm>
+#include <cstring>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::Archive
+	* \brief Core class that represents a read-only packed archive of files
+	*
+	* An archive is a single file holding many entries, identified by their relative path (using '/' as separator).
+	* It starts with a header followed by entry data, each entry being aligned, and ends with an index sorted by path hash and the paths themselves.
+	*
+	* The archive is mapped in memory, looking up an entry doesn't touch the file system and uncompressed entries are accessible without any copy.
+	* Entries may be compressed using LZ4, in which case ReadEntry decompresses them.
+	*
+	* Archives are made with ArchiveBuilder and usually mounted through VirtualFileSystem.
+	*/
+
+	/*!
+	* \brief Constructs an Archive object and opens an archive file
+	*
+	* \param filePath Path to the archive
+	*
+	* \see Open
+	*/
+	Archive::Archive(const String& filePath)
+	{
+		Open(filePath);
+	}
+
+	/*!
+	* \brief Closes the archive
+	*
+	* \remark Pointers to entry data must not be used afterwards
+	*/
+	void Archive::Close()
+	{
+		m_entries.clear();
+		m_file.Close();
+		m_paths = nullptr;
+	}
+
+	/*!
+	* \brief Finds an entry by its path
+	* \return Pointer to the entry or nullptr if the archive doesn't have it
+	*
+	* \param entryPath Path of the entry, relative to the archive root and using '/' as separator
+	*/
+	const Archive::Entry* Archive::FindEntry(const String& entryPath) const
+	{
+		UInt64 hash = HashPath(entryPath.GetConstBuffer(), entryPath.GetSize());
+
+		auto it = std::lower_bound(m_entries.begin(), m_entries.end(), hash, [](const Entry& entry, UInt64 value) { return entry.hash < value; });
+		for (; it != m_entries.end() && it->hash == hash; ++it)
+		{
+			// Different paths may share the same hash
+			if (it->pathSize == entryPath.GetSize() && std::memcmp(m_paths + it->pathOffset, entryPath.GetConstBuffer(), it->pathSize) == 0)
+				return &*it;
+		}
+
+		return nullptr;
+	}
+
+	/*!
+	* \brief Gets the path of an entry
+	* \return Path of the entry, relative to the archive root
+	*
+	* \param entry Entry of this archive
+	*/
+	String Archive::GetEntryPath(const Entry& entry) const
+	{
+		return String(m_paths + entry.pathOffset, entry.pathSize);
+	}
+
+	/*!
+	* \brief Opens an archive file
+	* \return true if the archive was opened
+	*
+	* \param filePath Path to the archive
+	*
+	* \remark Produces a NazaraError if the file couldn't be mapped or isn't a valid archive
+	*/
+	bool Archive::Open(const String& filePath)
+	{
+		Close();
+
+		if (!m_file.Open(filePath))
+		{
+			NazaraError("Failed to open archive \"" + filePath + '"');
+			return false;
+		}
+
+		if (!ReadIndex())
+		{
+			NazaraError("\"" + filePath + "\" is not a valid archive");
+			Close();
+			return false;
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Reads the content of an entry, decompressing it if needed
+	* \return true if the entry was read
+	*
+	* \param entry Entry of this archive
+	* \param data Byte array receiving the content, resized to entry.size
+	*
+	* \remark Produces a NazaraError if the entry is corrupted
+	*/
+	bool Archive::ReadEntry(const Entry& entry, ByteArray* data) const
+	{
+		NazaraAssert(data, "Invalid data");
+
+		data->Resize(static_cast<std::size_t>(entry.size));
+		return ReadEntry(entry, data->GetBuffer());
+	}
+
+	/*!
+	* \brief Reads the content of an entry, decompressing it if needed
+	* \return true if the entry was read
+	*
+	* \param entry Entry of this archive
+	* \param buffer Buffer receiving the content, must be at least entry.size bytes long
+	*
+	* \remark Produces a NazaraError if the entry is corrupted
+	*/
+	bool Archive::ReadEntry(const Entry& entry, void* buffer) const
+	{
+		NazaraAssert(IsOpen(), "Archive is not open");
+		NazaraAssert(buffer || entry.size == 0, "Invalid buffer");
+
+		const UInt8* storedData = GetEntryData(entry);
+		std::size_t size = static_cast<std::size_t>(entry.size);
+
+		if (entry.flags & EntryFlag_Compressed)
+		{
+			if (Lz4::Decompress(storedData, static_cast<std::size_t>(entry.storedSize), static_cast<UInt8*>(buffer), size) != size)
+			{
+				NazaraError("Failed to decompress entry \"" + GetEntryPath(entry) + '"');
+				return false;
+			}
+		}
+		else if (size > 0)
+			std::memcpy(buffer, storedData, size);
+
+		return true;
+	}
+
+	/*!
+	* \brief Hashes the path of an entry
+	* \return 64-bit FNV-1a hash of the path
+	*
+	* \param entryPath Path of the entry, relative to the archive root
+	* \param pathSize Length of the path
+	*/
+	UInt64 Archive::HashPath(const char* entryPath, std::size_t pathSize)
+	{
+		UInt64 hash = 14695981039346656037ULL;
+		for (std::size_t i = 0; i < pathSize; ++i)
+		{
+			hash ^= static_cast<UInt8>(entryPath[i]);
+			hash *= 1099511628211ULL;
+		}
+
+		return hash;
+	}
+
+	bool Archive::ReadIndex()
+	{
+		UInt64 fileSize = m_file.GetSize();
+		if (fileSize < HeaderSize)
+			return false;
+
+		ByteStream header(m_file.GetData(), HeaderSize);
+		header.SetDataEndianness(Endianness_LittleEndian);
+
+		UInt32 magic;
+		UInt32 version;
+		UInt32 entryCount;
+		UInt32 alignment;
+		UInt64 indexOffset;
+		UInt64 pathsOffset;
+		header >> magic >> version >> entryCount >> alignment >> indexOffset >> pathsOffset;
+
+		if (magic != Magic || version != Version)
+			return false;
+
+		if (indexOffset > fileSize || (fileSize - indexOffset) / IndexEntrySize < entryCount || pathsOffset < indexOffset + UInt64(entryCount) * IndexEntrySize || pathsOffset > fileSize)
+			return false;
+
+		m_paths = reinterpret_cast<const char*>(m_file.GetData() + pathsOffset);
+		UInt64 pathsSize = fileSize - pathsOffset;
+
+		ByteStream index(m_file.GetData() + indexOffset, UInt64(entryCount) * IndexEntrySize);
+		index.SetDataEndianness(Endianness_LittleEndian);
+
+		m_entries.resize(entryCount);
+		for (Entry& entry : m_entries)
+		{
+			UInt32 reserved;
+			index >> entry.hash >> entry.offset >> entry.size >> entry.storedSize >> entry.flags >> entry.pathOffset >> entry.pathSize >> reserved;
+
+			if (entry.offset > indexOffset || entry.storedSize > indexOffset - entry.offset)
+				return false;
+
+			if (entry.pathOffset > pathsSize || entry.pathSize > pathsSize - entry.pathOffset)
+				return false;
+
+			if (!(entry.flags & EntryFlag_Compressed) && entry.storedSize != entry.size)
+				return false;
+		}
+
+		return std::is_sorted(m_entries.begin(), m_entries.end(), [](const Entry& lhs, const Entry& rhs) { return lhs.hash < rhs.hash; });
+	}
+
+	constexpr UInt32 Archive::EntryFlag_Compressed;
+	constexpr UInt32 Archive::HeaderSize;
+	constexpr UInt32 Archive::IndexEntrySize;
+	constexpr UInt32 Archive::Magic;
+	constexpr UInt32 Archive::Version;
+}
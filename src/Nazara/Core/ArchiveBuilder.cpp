@@ -0,0 +1,208 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/ArchiveBuilder.hpp>
+#include <Nazara/Core/Archive.hpp>
+#include <Nazara/Core/ByteStream.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/Lz4.hpp>
+#include <algorithm>
+#include <numeric>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::ArchiveBuilder
+	* \brief Core class building archive files, to be read with Archive
+	*
+	* \see Archive
+	*/
+
+	/*!
+	* \brief Adds an entry to the archive
+	*
+	* \param entryPath Path of the entry, relative to the archive root using '/' as separator
+	* \param data Content of the entry
+	* \param size Size of the content
+	* \param compress Should the entry be compressed, entries are only compressed if it makes them smaller
+	*
+	* \remark Data is copied (or compressed) immediately
+	*/
+	void ArchiveBuilder::AddEntry(const String& entryPath, const void* data, std::size_t size, bool compress)
+	{
+		NazaraAssert(data || size == 0, "Invalid data");
+
+		PendingEntry entry;
+		entry.isCompressed = false;
+		entry.path = entryPath;
+		entry.path.Replace('\\', '/');
+		entry.size = size;
+
+		if (compress && size > 0)
+		{
+			entry.data.Resize(Lz4::GetMaxCompressedSize(size));
+
+			std::size_t compressedSize = Lz4::Compress(data, size, entry.data.GetBuffer(), entry.data.GetSize());
+			if (compressedSize > 0 && compressedSize < size)
+			{
+				entry.data.Resize(compressedSize);
+				entry.isCompressed = true;
+			}
+		}
+
+		if (!entry.isCompressed)
+			entry.data = ByteArray(data, size);
+
+		m_entries.emplace_back(std::move(entry));
+	}
+
+	/*!
+	* \brief Adds the content of a file to the archive
+	* \return true if the file could be read
+	*
+	* \param entryPath Path of the entry, relative to the archive root using '/' as separator
+	* \param filePath Path of the file to read
+	* \param compress Should the entry be compressed, entries are only compressed if it makes them smaller
+	*
+	* \remark Produces a NazaraError if the file couldn't be read
+	*/
+	bool ArchiveBuilder::AddFile(const String& entryPath, const String& filePath, bool compress)
+	{
+		File file(filePath, OpenMode_ReadOnly);
+		if (!file.IsOpen())
+		{
+			NazaraError("Failed to open \"" + filePath + '"');
+			return false;
+		}
+
+		ByteArray content(static_cast<std::size_t>(file.GetSize()), 0);
+		if (file.Read(content.GetBuffer(), content.GetSize()) != content.GetSize())
+		{
+			NazaraError("Failed to read \"" + filePath + '"');
+			return false;
+		}
+
+		AddEntry(entryPath, content.GetConstBuffer(), content.GetSize(), compress);
+		return true;
+	}
+
+	/*!
+	* \brief Writes the archive
+	* \return true if the archive was written
+	*
+	* \param filePath Path of the archive file
+	* \param alignment Alignment of entry data in the archive, must be a power of two
+	*
+	* \remark Produces a NazaraError if two entries share the same path or if the file couldn't be written
+	*/
+	bool ArchiveBuilder::Save(const String& filePath, UInt32 alignment) const
+	{
+		NazaraAssert(alignment > 0 && (alignment & (alignment - 1)) == 0, "Alignment must be a power of two");
+
+		// The index is sorted by hash, lookups are then a binary search
+		std::vector<UInt64> hashes(m_entries.size());
+		std::vector<std::size_t> order(m_entries.size());
+		for (std::size_t i = 0; i < m_entries.size(); ++i)
+			hashes[i] = Archive::HashPath(m_entries[i].path.GetConstBuffer(), m_entries[i].path.GetSize());
+
+		std::iota(order.begin(), order.end(), 0);
+		std::sort(order.begin(), order.end(), [&](std::size_t lhs, std::size_t rhs)
+		{
+			if (hashes[lhs] != hashes[rhs])
+				return hashes[lhs] < hashes[rhs];
+
+			return m_entries[lhs].path < m_entries[rhs].path;
+		});
+
+		for (std::size_t i = 1; i < order.size(); ++i)
+		{
+			if (m_entries[order[i - 1]].path == m_entries[order[i]].path)
+			{
+				NazaraError("Entry \"" + m_entries[order[i]].path + "\" was added twice");
+				return false;
+			}
+		}
+
+		File file(filePath, OpenMode_WriteOnly | OpenMode_Truncate);
+		if (!file.IsOpen())
+		{
+			NazaraError("Failed to open \"" + filePath + '"');
+			return false;
+		}
+
+		ByteArray padding(alignment, 0);
+		auto AlignFile = [&]() -> bool
+		{
+			std::size_t paddingSize = static_cast<std::size_t>((alignment - file.GetCursorPos() % alignment) % alignment);
+			return file.Write(padding.GetConstBuffer(), paddingSize) == paddingSize;
+		};
+
+		// Header is rewritten once offsets are known
+		file.SetCursorPos(Archive::HeaderSize);
+
+		std::vector<UInt64> offsets(m_entries.size());
+		for (std::size_t i : order)
+		{
+			const PendingEntry& entry = m_entries[i];
+
+			if (!AlignFile())
+			{
+				NazaraError("Failed to write \"" + filePath + '"');
+				return false;
+			}
+
+			offsets[i] = file.GetCursorPos();
+			if (!file.Write(entry.data))
+			{
+				NazaraError("Failed to write \"" + filePath + '"');
+				return false;
+			}
+		}
+
+		AlignFile();
+
+		UInt64 indexOffset = file.GetCursorPos();
+		UInt64 pathsOffset = indexOffset + UInt64(m_entries.size()) * Archive::IndexEntrySize;
+
+		ByteArray indexData;
+		indexData.Reserve(static_cast<std::size_t>(pathsOffset - indexOffset));
+
+		ByteStream index(&indexData);
+		index.SetDataEndianness(Endianness_LittleEndian);
+
+		UInt32 pathOffset = 0;
+		for (std::size_t i : order)
+		{
+			const PendingEntry& entry = m_entries[i];
+
+			UInt64 storedSize = entry.data.GetSize();
+			UInt32 flags = (entry.isCompressed) ? Archive::EntryFlag_Compressed : 0;
+			UInt32 pathSize = static_cast<UInt32>(entry.path.GetSize());
+			UInt32 reserved = 0;
+
+			index << hashes[i] << offsets[i] << entry.size << storedSize << flags << pathOffset << pathSize << reserved;
+
+			pathOffset += pathSize;
+		}
+
+		for (std::size_t i : order)
+			index.Write(m_entries[i].path.GetConstBuffer(), m_entries[i].path.GetSize());
+
+		ByteArray headerData;
+		ByteStream header(&headerData);
+		header.SetDataEndianness(Endianness_LittleEndian);
+		header << Archive::Magic << Archive::Version << static_cast<UInt32>(m_entries.size()) << alignment << indexOffset << pathsOffset;
+
+		if (!file.Write(indexData) || !file.SetCursorPos(0) || !file.Write(headerData))
+		{
+			NazaraError("Failed to write \"" + filePath + '"');
+			return false;
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,331 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/AsyncLogger.hpp>
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/FileLogger.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+#include <vector>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		struct LoggerRegistry
+		{
+			Mutex mutex;
+			std::terminate_handler previousTerminateHandler = nullptr;
+			std::vector<AsyncLogger*> loggers;
+			bool handlersInstalled = false;
+		};
+
+		LoggerRegistry& GetRegistry()
+		{
+			static LoggerRegistry registry;
+			return registry;
+		}
+
+		thread_local AsyncLogger* s_writerLogger = nullptr;
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::AsyncLogger
+	* \brief Core class that hands the log messages to another logger from a background thread
+	*
+	* Writing a message only formats it and queues it (without locking), the writer thread passes queued messages to the wrapped logger in batches, flushing it once per batch.
+	* Assertion failures and internal errors are flushed before returning, and the messages still queued are flushed when the program exits or terminates.
+	*
+	* \remark Messages being written from the writer thread, the wrapped logger doesn't have to be thread-safe
+	*/
+
+	/*!
+	* \brief Constructs an AsyncLogger object
+	*
+	* \param logger Logger the messages are handed to, which gets owned by this one, nullptr for a FileLogger
+	* \param flushPeriod Maximum duration (in milliseconds) messages are kept in the queue
+	*
+	* \see Log::SetLogger
+	*/
+
+	AsyncLogger::AsyncLogger(AbstractLogger* logger, UInt32 flushPeriod) :
+	m_head(&m_stub),
+	m_running(true),
+	m_logger((logger) ? logger : new FileLogger),
+	m_tail(&m_stub),
+	m_semaphore(0),
+	m_flushPeriod(flushPeriod)
+	{
+		m_stub.next = nullptr;
+
+		m_thread = Thread(&AsyncLogger::WriterThread, this);
+		m_thread.SetName("AsyncLoggerThread");
+
+		// Messages logged before a crash are the most valuable, unwritten ones are flushed on exit and termination
+		LoggerRegistry& registry = GetRegistry();
+
+		LockGuard lock(registry.mutex);
+		registry.loggers.push_back(this);
+
+		if (!registry.handlersInstalled)
+		{
+			std::atexit(&AsyncLogger::FlushAll);
+			registry.previousTerminateHandler = std::set_terminate(&AsyncLogger::OnTerminate);
+			registry.handlersInstalled = true;
+		}
+	}
+
+	/*!
+	* \brief Destructs the object, writing the queued messages before stopping the writer thread
+	*/
+
+	AsyncLogger::~AsyncLogger()
+	{
+		{
+			LoggerRegistry& registry = GetRegistry();
+
+			LockGuard lock(registry.mutex);
+			registry.loggers.erase(std::find(registry.loggers.begin(), registry.loggers.end(), this));
+		}
+
+		m_running = false;
+		m_semaphore.Post();
+		m_thread.Join();
+	}
+
+	/*!
+	* \brief Enables the replication to the stdout of the wrapped logger
+	*
+	* \param enable If true, enables the replication
+	*/
+
+	void AsyncLogger::EnableStdReplication(bool enable)
+	{
+		m_logger->EnableStdReplication(enable);
+	}
+
+	/*!
+	* \brief Waits until every message written until now has been handed to the wrapped logger, and flushed
+	*/
+
+	void AsyncLogger::Flush()
+	{
+		FlushRecords(0);
+	}
+
+	/*!
+	* \brief Gets the wrapped logger
+	* \return Logger the messages are handed to, which must not be used while the writer thread is running
+	*/
+
+	AbstractLogger* AsyncLogger::GetLogger() const
+	{
+		return m_logger.get();
+	}
+
+	/*!
+	* \brief Checks whether or not the replication to the stdout of the wrapped logger is enabled
+	* \return true If replication is enabled
+	*/
+
+	bool AsyncLogger::IsStdReplicationEnabled() const
+	{
+		return m_logger->IsStdReplicationEnabled();
+	}
+
+	/*!
+	* \brief Queues a string to be logged
+	*
+	* \param string String to log
+	*
+	* \see WriteError
+	*/
+
+	void AsyncLogger::Write(const String& string)
+	{
+		Record* record = new Record;
+		record->message = string;
+		record->error = false;
+
+		PushRecord(record);
+	}
+
+	/*!
+	* \brief Queues an error to be logged
+	*
+	* \param type The error type
+	* \param error The error text
+	* \param line The line the error occurred
+	* \param file The file the error occurred
+	* \param function The function the error occurred
+	*
+	* \remark Assertion failures and internal errors are flushed before returning, as they are likely to be followed by a crash
+	*
+	* \see Write
+	*/
+
+	void AsyncLogger::WriteError(ErrorType type, const String& error, unsigned int line, const char* file, const char* function)
+	{
+		Record* record = new Record;
+		record->error = true;
+		record->file = file;
+		record->function = function;
+		record->line = line;
+		record->message = error;
+		record->type = type;
+
+		PushRecord(record);
+
+		if (type == ErrorType_AssertFailed || type == ErrorType_Internal)
+			FlushRecords(0);
+	}
+
+	bool AsyncLogger::FlushRecords(UInt32 timeout)
+	{
+		// The writer thread itself may log (when the wrapped logger fails), it can't wait for itself
+		if (s_writerLogger == this)
+		{
+			WriteRecords();
+			return true;
+		}
+
+		std::shared_ptr<std::atomic_bool> flushed = std::make_shared<std::atomic_bool>(false);
+
+		Record* record = new Record;
+		record->flushed = flushed;
+
+		PushRecord(record);
+		m_semaphore.Post();
+
+		UInt64 startTime = GetElapsedMilliseconds();
+		while (!flushed->load(std::memory_order_acquire))
+		{
+			// The flag is shared with the record, which can outlive a wait giving up
+			if (timeout > 0 && GetElapsedMilliseconds() - startTime >= timeout)
+				return false;
+
+			Thread::Sleep(1);
+		}
+
+		return true;
+	}
+
+	AsyncLogger::Record* AsyncLogger::PopRecord()
+	{
+		// Intrusive multiple producers single consumer queue (Dmitry Vyukov), only called from the writer thread
+		// http://www.1024cores.net/home/lock-free-algorithms/queues/intrusive-mpsc-node-based-queue
+		Record* tail = m_tail;
+		Record* next = tail->next.load(std::memory_order_acquire);
+
+		if (tail == &m_stub)
+		{
+			if (!next)
+				return nullptr;
+
+			m_tail = next;
+			tail = next;
+			next = next->next.load(std::memory_order_acquire);
+		}
+
+		if (next)
+		{
+			m_tail = next;
+			return tail;
+		}
+
+		// The last record can't be popped without another one after it, the stub is pushed for this
+		if (tail != m_head.load(std::memory_order_acquire))
+			return nullptr; // A producer is pushing a record, it will be popped next time
+
+		PushRecord(&m_stub);
+
+		next = tail->next.load(std::memory_order_acquire);
+		if (next)
+		{
+			m_tail = next;
+			return tail;
+		}
+
+		return nullptr;
+	}
+
+	void AsyncLogger::PushRecord(Record* record)
+	{
+		record->next.store(nullptr, std::memory_order_relaxed);
+
+		Record* previous = m_head.exchange(record, std::memory_order_acq_rel);
+		previous->next.store(record, std::memory_order_release);
+	}
+
+	void AsyncLogger::WriteRecords()
+	{
+		bool written = false;
+		while (Record* record = PopRecord())
+		{
+			if (record->flushed)
+			{
+				if (written)
+				{
+					m_logger->Flush();
+					written = false;
+				}
+
+				record->flushed->store(true, std::memory_order_release);
+			}
+			else
+			{
+				if (record->error)
+					m_logger->WriteError(record->type, record->message, record->line, record->file, record->function);
+				else
+					m_logger->Write(record->message);
+
+				written = true;
+			}
+
+			delete record;
+		}
+
+		if (written)
+			m_logger->Flush();
+	}
+
+	void AsyncLogger::WriterThread()
+	{
+		s_writerLogger = this;
+
+		while (m_running)
+		{
+			// Records are piled up until the end of the period, unless a flush is requested
+			m_semaphore.Wait(m_flushPeriod);
+			WriteRecords();
+		}
+
+		WriteRecords();
+	}
+
+	void AsyncLogger::FlushAll()
+	{
+		LoggerRegistry& registry = GetRegistry();
+
+		LockGuard lock(registry.mutex);
+		for (AsyncLogger* logger : registry.loggers)
+			logger->FlushRecords(1000);
+	}
+
+	void AsyncLogger::OnTerminate()
+	{
+		FlushAll();
+
+		std::terminate_handler previousHandler = GetRegistry().previousTerminateHandler;
+		if (previousHandler)
+			previousHandler();
+
+		std::abort();
+	}
+}
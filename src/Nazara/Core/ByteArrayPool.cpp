@@ -0,0 +1,162 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/ByteArrayPool.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Math/Algorithm.hpp>
+#include <algorithm>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::ByteArrayPool
+	* \brief Core class that keeps released byte arrays to give their storage to the next ones needing it
+	*
+	* Buffers are sorted by size classes (powers of two), a buffer is only given for requests it can hold without reallocating.
+	*
+	* \remark This class is thread-safe
+	*
+	* \see MemoryStream::SetBufferPool
+	*/
+
+	/*!
+	* \brief Constructs a ByteArrayPool object
+	*
+	* \param maxHeldBytes Sum of the capacities of the buffers the pool can hold, released buffers above it are freed
+	*/
+
+	ByteArrayPool::ByteArrayPool(std::size_t maxHeldBytes) :
+	m_heldBufferCount(0),
+	m_heldBytes(0),
+	m_maxHeldBytes(maxHeldBytes)
+	{
+	}
+
+	/*!
+	* \brief Gets an empty byte array able to hold at least some bytes
+	* \return Byte array taken from the pool if one was big enough, a newly allocated one otherwise
+	*
+	* \param minCapacity Capacity the byte array must have
+	*/
+
+	ByteArray ByteArrayPool::Acquire(std::size_t minCapacity)
+	{
+		std::size_t capacity = std::max(minCapacity, MinCapacity);
+		unsigned int sizeClass = IntegralLog2(capacity - 1) + 1;
+		NazaraAssert(sizeClass < m_buffers.size(), "Capacity is too big");
+
+		{
+			LockGuard lock(m_mutex);
+
+			std::vector<ByteArray>& buffers = m_buffers[sizeClass];
+			if (!buffers.empty())
+			{
+				ByteArray byteArray = std::move(buffers.back());
+				buffers.pop_back();
+
+				m_heldBufferCount--;
+				m_heldBytes -= byteArray.GetCapacity();
+
+				return byteArray;
+			}
+		}
+
+		ByteArray byteArray;
+		byteArray.Reserve(std::size_t(1) << sizeClass);
+
+		return byteArray;
+	}
+
+	/*!
+	* \brief Frees every buffer held by the pool
+	*/
+
+	void ByteArrayPool::Clear()
+	{
+		LockGuard lock(m_mutex);
+
+		for (std::vector<ByteArray>& buffers : m_buffers)
+			buffers.clear();
+
+		m_heldBufferCount = 0;
+		m_heldBytes = 0;
+	}
+
+	/*!
+	* \brief Gets the number of buffers held by the pool
+	* \return Number of buffers
+	*/
+
+	std::size_t ByteArrayPool::GetHeldBufferCount() const
+	{
+		LockGuard lock(m_mutex);
+		return m_heldBufferCount;
+	}
+
+	/*!
+	* \brief Gets the memory held by the pool
+	* \return Sum of the capacities of the held buffers, in bytes
+	*/
+
+	std::size_t ByteArrayPool::GetHeldBytes() const
+	{
+		LockGuard lock(m_mutex);
+		return m_heldBytes;
+	}
+
+	/*!
+	* \brief Gets the memory the pool keeps at most
+	* \return Sum of the capacities of the buffers the pool can hold, in bytes
+	*/
+
+	std::size_t ByteArrayPool::GetMaxHeldBytes() const
+	{
+		LockGuard lock(m_mutex);
+		return m_maxHeldBytes;
+	}
+
+	/*!
+	* \brief Gives the storage of a byte array back to the pool
+	*
+	* \param byteArray Byte array to take the storage from, it is left empty
+	*
+	* \remark The storage is freed if it is smaller than MinCapacity or if the pool is full
+	*/
+
+	void ByteArrayPool::Release(ByteArray&& byteArray)
+	{
+		ByteArray storage(std::move(byteArray));
+		byteArray.Clear();
+
+		std::size_t capacity = storage.GetCapacity();
+		if (capacity < MinCapacity)
+			return;
+
+		storage.Clear(true);
+
+		LockGuard lock(m_mutex);
+		if (m_heldBytes + capacity > m_maxHeldBytes)
+			return;
+
+		m_buffers[IntegralLog2(capacity)].push_back(std::move(storage));
+		m_heldBufferCount++;
+		m_heldBytes += capacity;
+	}
+
+	/*!
+	* \brief Sets the memory the pool keeps at most
+	*
+	* \param maxHeldBytes Sum of the capacities of the buffers the pool can hold
+	*
+	* \remark Buffers already held are kept even if they go beyond the new limit, use Clear to free them
+	*/
+
+	void ByteArrayPool::SetMaxHeldBytes(std::size_t maxHeldBytes)
+	{
+		LockGuard lock(m_mutex);
+		m_maxHeldBytes = maxHeldBytes;
+	}
+}
@@ -59,6 +59,52 @@ namespace Nz
 		SetStream(ptr, size);
 	}
 
+	/*!
+	* \brief Reads bits from the stream
+	* \return true if the bits were read
+	*
+	* Bits are read in the same order as booleans are, starting by the lowest bit of the current byte.
+	* This allows values to be packed on the exact number of bits they need.
+	*
+	* \param value Pointer to the value which will hold the bits, the first bit read being the lowest one
+	* \param bitCount Number of bits to read, between 0 and 64
+	*
+	* \see WriteBits
+	*/
+
+	bool ByteStream::ReadBits(UInt64* value, UInt8 bitCount)
+	{
+		NazaraAssert(value, "Invalid value");
+		NazaraAssert(bitCount <= 64, "Bit count must be between 0 and 64");
+
+		if (!m_context.stream)
+			OnEmptyStream();
+
+		UInt64 result = 0;
+		UInt8 readBits = 0;
+		while (readBits < bitCount)
+		{
+			if (m_context.currentBitPos == 8)
+			{
+				if (m_context.stream->Read(&m_context.currentByte, 1) != 1)
+					return false;
+
+				m_context.currentBitPos = 0;
+			}
+
+			// Take as many bits as possible from the current byte
+			UInt8 bitsToRead = std::min<UInt8>(8 - m_context.currentBitPos, bitCount - readBits);
+			UInt64 bits = (m_context.currentByte >> m_context.currentBitPos) & ((1U << bitsToRead) - 1);
+
+			result |= bits << readBits;
+			readBits += bitsToRead;
+			m_context.currentBitPos += bitsToRead;
+		}
+
+		*value = result;
+		return true;
+	}
+
 	/*!
 	* \brief Sets this with a byte array
 	*
@@ -111,6 +157,51 @@ namespace Nz
 		m_ownedStream = std::move(stream);
 	}
 
+	/*!
+	* \brief Writes bits to the stream
+	* \return true if the bits were written
+	*
+	* Bits are written in the same order as booleans are, starting by the lowest bit of the current byte.
+	* The last byte is only written once full or when the bits get flushed.
+	*
+	* \param value Value holding the bits to write, starting with the lowest one
+	* \param bitCount Number of bits to write, between 0 and 64
+	*
+	* \see FlushBits
+	* \see ReadBits
+	*/
+
+	bool ByteStream::WriteBits(UInt64 value, UInt8 bitCount)
+	{
+		NazaraAssert(bitCount <= 64, "Bit count must be between 0 and 64");
+
+		if (!m_context.stream)
+			OnEmptyStream();
+
+		UInt8 writtenBits = 0;
+		while (writtenBits < bitCount)
+		{
+			if (m_context.currentBitPos == 8)
+			{
+				m_context.currentBitPos = 0;
+				m_context.currentByte = 0;
+			}
+
+			// Fill the current byte as much as possible
+			UInt8 bitsToWrite = std::min<UInt8>(8 - m_context.currentBitPos, bitCount - writtenBits);
+			UInt8 bits = static_cast<UInt8>((value >> writtenBits) & ((1U << bitsToWrite) - 1));
+
+			m_context.currentByte |= bits << m_context.currentBitPos;
+			writtenBits += bitsToWrite;
+			m_context.currentBitPos += bitsToWrite;
+
+			if (m_context.currentBitPos == 8 && m_context.stream->Write(&m_context.currentByte, 1) != 1)
+				return false;
+		}
+
+		return true;
+	}
+
 	/*!
 	* \brief Signal function (meant to be virtual)
 	*
@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Timestamp.hpp>
 
 #if defined(NAZARA_PLATFORM_WINDOWS)
 	#include <Nazara/Core/Win32/ClockImpl.hpp>
@@ -24,17 +25,40 @@ namespace Nz
 {
 	namespace Detail
 	{
+		UInt64 s_timestampOrigin;
+		UInt64 s_timestampOriginMicroseconds;
+
 		UInt64 GetMicrosecondsLowPrecision()
 		{
 			return ClockImplGetElapsedMilliseconds()*1000ULL;
 		}
 
+		UInt64 GetMicrosecondsFromTimestamp()
+		{
+			return s_timestampOriginMicroseconds + Timestamp::ToMicroseconds(Timestamp::Now() - s_timestampOrigin);
+		}
+
 		UInt64 GetElapsedMicrosecondsFirstRun()
 		{
-			if (ClockImplInitializeHighPrecision())
-				GetElapsedMicroseconds = ClockImplGetElapsedMicroseconds;
-			else
-				GetElapsedMicroseconds = GetMicrosecondsLowPrecision;
+			static ClockFunction function = []() -> ClockFunction
+			{
+				bool highPrecision = ClockImplInitializeHighPrecision();
+
+				// Reading the time-stamp counter is much cheaper than a system call, keep the same origin as the system clock though
+				if (Timestamp::IsTscBased())
+				{
+					s_timestampOriginMicroseconds = (highPrecision) ? ClockImplGetElapsedMicroseconds() : GetMicrosecondsLowPrecision();
+					s_timestampOrigin = Timestamp::Now();
+
+					return GetMicrosecondsFromTimestamp;
+				}
+				else if (highPrecision)
+					return ClockImplGetElapsedMicroseconds;
+				else
+					return GetMicrosecondsLowPrecision;
+			}();
+
+			GetElapsedMicroseconds = function;
 
 			return GetElapsedMicroseconds();
 		}
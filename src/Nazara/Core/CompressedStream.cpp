@@ -0,0 +1,635 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/CompressedStream.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/ByteStream.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/Lz4.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <algorithm>
+#include <cstring>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::CompressedStream
+	* \brief Core class that represents a stream compressing the data it writes to another stream, or decompressing the data it reads from it
+	*
+	* Data is split into blocks compressed independently with LZ4, a batch of blocks being compressed in parallel by the task scheduler.
+	* Every block is preceded by its size, so the data can be read from a sequential stream, and the block sizes are repeated
+	* at the end of the data once the stream is closed, so reading from a seekable stream gets random access right away.
+	*
+	* Layout (little-endian):
+	* - Header: magic, version, block size (UInt32 each)
+	* - Blocks: size, stored size (UInt32 each) followed by the stored data, which isn't compressed if the stored size equals the size
+	* - End marker: a block whose size is zero
+	* - Seek table: size and stored size of every block
+	* - Footer: block count, magic (UInt32 each)
+	*
+	* \remark Random access requires the compressed data to end its stream, data which wasn't closed properly is read by going through the block headers
+	*/
+
+	/*!
+	* \brief Destructs the object and closes the compressed stream
+	*
+	* \see Close
+	*/
+	CompressedStream::~CompressedStream()
+	{
+		Close();
+	}
+
+	/*!
+	* \brief Closes the compressed stream
+	*
+	* When writing, the pending data is compressed and written, followed by the end marker and the seek table.
+	*
+	* \remark The underlying stream is left open
+	*/
+	void CompressedStream::Close()
+	{
+		if (!m_stream)
+			return;
+
+		if (IsWritable())
+		{
+			if (CompressBlocks(m_blockData.size()))
+			{
+				ByteArray trailerData;
+				trailerData.Reserve((m_blocks.size() + 1) * BlockHeaderSize + FooterSize);
+
+				ByteStream trailer(&trailerData);
+				trailer.SetDataEndianness(Endianness_LittleEndian);
+
+				trailer << UInt32(0) << UInt32(0); //< End marker
+
+				for (const BlockInfo& block : m_blocks)
+					trailer << block.size << block.storedSize;
+
+				trailer << static_cast<UInt32>(m_blocks.size()) << Magic;
+
+				if (!m_stream->Write(trailerData))
+					NazaraError("Failed to write compressed stream seek table");
+
+				m_stream->Flush();
+			}
+			else
+				NazaraError("Failed to write compressed stream pending blocks");
+		}
+
+		m_blocks.clear();
+		m_blockData.clear();
+		m_compressedBlocks.clear();
+		m_storedData.clear();
+		m_stream = nullptr;
+		m_cursorPos = 0;
+		m_size = 0;
+		m_streamOffset = 0;
+		m_streamSize = 0;
+		m_loadedBlock = 0;
+		m_lastBlockFound = false;
+
+		m_openMode = OpenMode_NotOpen;
+		m_streamOptions = StreamOption_None;
+	}
+
+	/*!
+	* \brief Checks whether the stream reached the end of the data
+	* \return true if cursor is at the end of the data
+	*
+	* \remark When reading from a sequential stream, the end is only known once a read reached it
+	*/
+	bool CompressedStream::EndOfStream() const
+	{
+		if (IsWritable())
+			return true;
+
+		return m_lastBlockFound && m_cursorPos >= m_size;
+	}
+
+	/*!
+	* \brief Gets the position of the cursor in the uncompressed data
+	* \return Position of the cursor
+	*/
+	UInt64 CompressedStream::GetCursorPos() const
+	{
+		return m_cursorPos;
+	}
+
+	/*!
+	* \brief Gets the size of the uncompressed data
+	* \return Size written so far, or size of the data read
+	*
+	* \remark When reading from a sequential stream, only the size of the blocks found so far is known
+	*/
+	UInt64 CompressedStream::GetSize() const
+	{
+		return m_size;
+	}
+
+	/*!
+	* \brief Opens the compressed stream
+	* \return true if the stream could be opened (and its header read or written)
+	*
+	* The compressed data begins at the current position of the stream.
+	*
+	* \param stream Stream holding the compressed data, which must outlive the compressed stream
+	* \param openMode Either OpenMode_ReadOnly or OpenMode_WriteOnly
+	* \param blockSize Size of the blocks compressed independently when writing, bigger blocks compress better but make random access slower
+	*
+	* \remark Produces a NazaraError if the header couldn't be read or written
+	*/
+	bool CompressedStream::Open(Stream* stream, OpenModeFlags openMode, std::size_t blockSize)
+	{
+		NazaraAssert(stream, "Invalid stream");
+
+		Close();
+
+		bool reading = (openMode & OpenMode_ReadOnly) != 0;
+		bool writing = (openMode & OpenMode_WriteOnly) != 0;
+		if (reading == writing)
+		{
+			NazaraError("Compressed streams are opened either for reading or for writing");
+			return false;
+		}
+
+		m_streamOffset = stream->GetCursorPos();
+
+		if (writing)
+		{
+			NazaraAssert(stream->IsWritable(), "Stream is not writable");
+
+			if (blockSize == 0 || blockSize > 0x7FFFFFFF)
+			{
+				NazaraError("Invalid block size");
+				return false;
+			}
+
+			ByteArray headerData;
+			ByteStream header(&headerData);
+			header.SetDataEndianness(Endianness_LittleEndian);
+			header << Magic << Version << static_cast<UInt32>(blockSize);
+
+			if (!stream->Write(headerData))
+			{
+				NazaraError("Failed to write compressed stream header");
+				return false;
+			}
+
+			// A batch gives a block to every worker
+			m_compressedBlocks.resize(std::max(TaskScheduler::GetWorkerCount(), 1U));
+
+			m_blockSize = blockSize;
+			m_openMode = OpenMode_WriteOnly;
+			m_stream = stream;
+			m_streamOptions = StreamOption_Sequential;
+			m_streamSize = HeaderSize;
+
+			return true;
+		}
+
+		NazaraAssert(stream->IsReadable(), "Stream is not readable");
+
+		UInt8 headerData[HeaderSize];
+		if (stream->Read(headerData, HeaderSize) != HeaderSize)
+		{
+			NazaraError("Failed to read compressed stream header");
+			return false;
+		}
+
+		UInt32 magic;
+		UInt32 version;
+		UInt32 storedBlockSize;
+
+		ByteStream header(headerData, HeaderSize);
+		header.SetDataEndianness(Endianness_LittleEndian);
+		header >> magic >> version >> storedBlockSize;
+
+		if (magic != Magic)
+		{
+			NazaraError("Not a compressed stream");
+			return false;
+		}
+
+		if (version > Version)
+		{
+			NazaraError("Unsupported compressed stream version " + String::Number(version));
+			return false;
+		}
+
+		if (storedBlockSize == 0)
+		{
+			NazaraError("Invalid block size");
+			return false;
+		}
+
+		m_blockSize = storedBlockSize;
+		m_openMode = OpenMode_ReadOnly;
+		m_stream = stream;
+		m_streamSize = HeaderSize;
+
+		if (stream->IsSequential())
+			m_streamOptions = StreamOption_Sequential;
+		else if (!ReadSeekTable() && !DiscoverBlocks())
+		{
+			NazaraError("Failed to read compressed stream blocks");
+			Close();
+
+			return false;
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Moves the cursor in the uncompressed data
+	* \return true if the cursor could be moved
+	*
+	* Only the block holding the new position is decompressed, once read.
+	*
+	* \param offset New position of the cursor
+	*
+	* \remark Produces a NazaraError if the stream is written, or read from a sequential stream, and the position isn't in the current block
+	*/
+	bool CompressedStream::SetCursorPos(UInt64 offset)
+	{
+		NazaraAssert(m_stream, "Compressed stream is not open");
+
+		if (offset == m_cursorPos)
+			return true;
+
+		if (IsSequential())
+		{
+			// Going back in the current block doesn't require to read the stream again
+			bool inLoadedBlock = IsReadable() && m_loadedBlock < m_blocks.size() && m_blockData.size() == m_blocks[m_loadedBlock].size &&
+			                     offset >= m_blocks[m_loadedBlock].position && offset <= m_blocks[m_loadedBlock].position + m_blocks[m_loadedBlock].size;
+
+			if (!inLoadedBlock)
+			{
+				NazaraError("Compressed stream can't seek out of its current block");
+				return false;
+			}
+		}
+		else if (offset > m_size)
+			return false;
+
+		m_cursorPos = offset;
+		return true;
+	}
+
+	/*!
+	* \brief Compresses and writes the first bytes of the pending data
+	* \return true if the blocks could be written
+	*
+	* \param byteCount Bytes to compress, split in blocks
+	*/
+	bool CompressedStream::CompressBlocks(std::size_t byteCount)
+	{
+		if (byteCount == 0)
+			return true;
+
+		std::size_t blockCount = (byteCount + m_blockSize - 1) / m_blockSize;
+		if (blockCount > m_compressedBlocks.size())
+			m_compressedBlocks.resize(blockCount);
+
+		TaskScheduler::ParallelFor(0, blockCount, 1, [&](std::size_t begin, std::size_t end)
+		{
+			for (std::size_t i = begin; i < end; ++i)
+			{
+				std::size_t blockOffset = i * m_blockSize;
+				std::size_t size = std::min(m_blockSize, byteCount - blockOffset);
+
+				// Blocks are only kept compressed if it makes them smaller, an empty block is stored as is
+				std::vector<UInt8>& compressedBlock = m_compressedBlocks[i];
+				compressedBlock.resize(size);
+				compressedBlock.resize(Lz4::Compress(m_blockData.data() + blockOffset, size, compressedBlock.data(), size - 1));
+			}
+		});
+
+		for (std::size_t i = 0; i < blockCount; ++i)
+		{
+			std::size_t blockOffset = i * m_blockSize;
+			std::size_t size = std::min(m_blockSize, byteCount - blockOffset);
+
+			const std::vector<UInt8>& compressedBlock = m_compressedBlocks[i];
+			bool compressed = !compressedBlock.empty();
+
+			BlockInfo block;
+			block.dataOffset = m_streamSize + BlockHeaderSize;
+			block.position = (m_blocks.empty()) ? 0 : m_blocks.back().position + m_blocks.back().size;
+			block.size = static_cast<UInt32>(size);
+			block.storedSize = static_cast<UInt32>((compressed) ? compressedBlock.size() : size);
+
+			UInt8 blockHeaderData[BlockHeaderSize];
+			ByteStream blockHeader(blockHeaderData, BlockHeaderSize);
+			blockHeader.SetDataEndianness(Endianness_LittleEndian);
+			blockHeader << block.size << block.storedSize;
+
+			const UInt8* storedData = (compressed) ? compressedBlock.data() : m_blockData.data() + blockOffset;
+			if (m_stream->Write(blockHeaderData, BlockHeaderSize) != BlockHeaderSize || m_stream->Write(storedData, block.storedSize) != block.storedSize)
+			{
+				NazaraError("Failed to write compressed block");
+				return false;
+			}
+
+			m_blocks.push_back(block);
+			m_streamSize = block.dataOffset + block.storedSize;
+		}
+
+		m_blockData.erase(m_blockData.begin(), m_blockData.begin() + byteCount);
+		return true;
+	}
+
+	/*!
+	* \brief Finds the blocks of a seekable stream by going through their headers
+	* \return true if the blocks could be read up to the end of the data
+	*/
+	bool CompressedStream::DiscoverBlocks()
+	{
+		m_blocks.clear();
+		m_lastBlockFound = false;
+		m_size = 0;
+		m_streamSize = HeaderSize;
+
+		while (!m_lastBlockFound)
+		{
+			if (!m_stream->SetCursorPos(m_streamOffset + m_streamSize) || !ReadNextBlockHeader())
+				return false;
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Finds the block holding a position of the uncompressed data
+	* \return Index of the block, or the block count if the position is past the end of the data
+	*
+	* \param position Position in the uncompressed data
+	*/
+	std::size_t CompressedStream::FindBlock(UInt64 position) const
+	{
+		auto it = std::upper_bound(m_blocks.begin(), m_blocks.end(), position, [](UInt64 value, const BlockInfo& block)
+		{
+			return value < block.position + block.size;
+		});
+
+		return static_cast<std::size_t>(it - m_blocks.begin());
+	}
+
+	/*!
+	* \brief Compresses and writes the pending data, then flushes the underlying stream
+	*
+	* \remark The pending data is written as a smaller block, flushing too often makes the compression worse
+	*/
+	void CompressedStream::FlushStream()
+	{
+		if (!CompressBlocks(m_blockData.size()))
+			return;
+
+		m_stream->Flush();
+	}
+
+	/*!
+	* \brief Reads and decompresses a block
+	* \return true if the block could be read
+	*
+	* \param blockIndex Index of the block
+	*/
+	bool CompressedStream::LoadBlock(std::size_t blockIndex)
+	{
+		const BlockInfo& block = m_blocks[blockIndex];
+
+		// Blocks of a sequential stream are loaded right after their header was read
+		if (!IsSequential() && !m_stream->SetCursorPos(m_streamOffset + block.dataOffset))
+		{
+			NazaraError("Failed to reach compressed block");
+			return false;
+		}
+
+		m_storedData.resize(block.storedSize);
+		if (m_stream->Read(m_storedData.data(), block.storedSize) != block.storedSize)
+		{
+			NazaraError("Compressed block is truncated");
+			return false;
+		}
+
+		if (block.storedSize == block.size)
+			m_blockData.swap(m_storedData);
+		else
+		{
+			m_blockData.resize(block.size);
+			if (Lz4::Decompress(m_storedData.data(), block.storedSize, m_blockData.data(), block.size) != block.size)
+			{
+				NazaraError("Compressed block is corrupted");
+				m_blockData.clear();
+
+				return false;
+			}
+		}
+
+		m_loadedBlock = blockIndex;
+		return true;
+	}
+
+	/*!
+	* \brief Reads the header of the block at the current position of the underlying stream
+	* \return true if a block or the end of the data was found
+	*/
+	bool CompressedStream::ReadNextBlockHeader()
+	{
+		UInt8 blockHeaderData[BlockHeaderSize];
+		std::size_t readSize = m_stream->Read(blockHeaderData, BlockHeaderSize);
+		if (readSize == 0)
+		{
+			// Data whose stream wasn't closed has no end marker
+			m_lastBlockFound = true;
+			return true;
+		}
+
+		if (readSize != BlockHeaderSize)
+		{
+			NazaraError("Compressed block header is truncated");
+			return false;
+		}
+
+		BlockInfo block;
+
+		ByteStream blockHeader(blockHeaderData, BlockHeaderSize);
+		blockHeader.SetDataEndianness(Endianness_LittleEndian);
+		blockHeader >> block.size >> block.storedSize;
+
+		if (block.size == 0)
+		{
+			m_lastBlockFound = true;
+			return true;
+		}
+
+		if (block.size > m_blockSize || block.storedSize > block.size)
+		{
+			NazaraError("Compressed block header is corrupted");
+			return false;
+		}
+
+		block.dataOffset = m_streamSize + BlockHeaderSize;
+		block.position = m_size;
+
+		m_blocks.push_back(block);
+		m_size += block.size;
+		m_streamSize = block.dataOffset + block.storedSize;
+
+		return true;
+	}
+
+	/*!
+	* \brief Reads and decompresses blocks of data
+	* \return Number of bytes read
+	*
+	* \param buffer Preallocated buffer to contain the data, nullptr to skip the data
+	* \param size Size of the read and thus of the buffer
+	*/
+	std::size_t CompressedStream::ReadBlock(void* buffer, std::size_t size)
+	{
+		NazaraAssert(m_stream, "Compressed stream is not open");
+
+		UInt8* ptr = static_cast<UInt8*>(buffer);
+
+		std::size_t readSize = 0;
+		while (readSize < size)
+		{
+			bool loaded = (m_loadedBlock < m_blocks.size() && m_blockData.size() == m_blocks[m_loadedBlock].size);
+			if (!loaded || m_cursorPos < m_blocks[m_loadedBlock].position || m_cursorPos >= m_blocks[m_loadedBlock].position + m_blocks[m_loadedBlock].size)
+			{
+				std::size_t blockIndex = FindBlock(m_cursorPos);
+				if (blockIndex == m_blocks.size())
+				{
+					// Blocks of a sequential stream are found while reading it
+					if (m_lastBlockFound || !ReadNextBlockHeader() || m_lastBlockFound)
+						break;
+
+					blockIndex = m_blocks.size() - 1;
+				}
+
+				if (!LoadBlock(blockIndex))
+					break;
+			}
+
+			const BlockInfo& block = m_blocks[m_loadedBlock];
+
+			std::size_t blockOffset = static_cast<std::size_t>(m_cursorPos - block.position);
+			std::size_t copySize = std::min<std::size_t>(size - readSize, block.size - blockOffset);
+			if (ptr)
+				std::memcpy(ptr + readSize, m_blockData.data() + blockOffset, copySize);
+
+			m_cursorPos += copySize;
+			readSize += copySize;
+		}
+
+		return readSize;
+	}
+
+	/*!
+	* \brief Reads the block sizes from the seek table of a seekable stream
+	* \return true if the seek table was found and is consistent with the data
+	*/
+	bool CompressedStream::ReadSeekTable()
+	{
+		UInt64 streamEnd = m_stream->GetSize();
+		UInt64 minimumSize = m_streamOffset + HeaderSize + BlockHeaderSize + FooterSize;
+		if (streamEnd < minimumSize)
+			return false;
+
+		UInt8 footerData[FooterSize];
+		if (!m_stream->SetCursorPos(streamEnd - FooterSize) || m_stream->Read(footerData, FooterSize) != FooterSize)
+			return false;
+
+		UInt32 blockCount;
+		UInt32 magic;
+
+		ByteStream footer(footerData, FooterSize);
+		footer.SetDataEndianness(Endianness_LittleEndian);
+		footer >> blockCount >> magic;
+
+		UInt64 tableSize = UInt64(blockCount) * BlockHeaderSize;
+		if (magic != Magic || tableSize > streamEnd - minimumSize)
+			return false;
+
+		UInt64 tableOffset = streamEnd - FooterSize - tableSize;
+
+		std::vector<UInt8> tableData(static_cast<std::size_t>(tableSize));
+		if (!m_stream->SetCursorPos(tableOffset) || m_stream->Read(tableData.data(), tableData.size()) != tableData.size())
+			return false;
+
+		ByteStream table(tableData.data(), tableSize);
+		table.SetDataEndianness(Endianness_LittleEndian);
+
+		std::vector<BlockInfo> blocks(blockCount);
+
+		UInt64 dataOffset = HeaderSize;
+		UInt64 position = 0;
+		for (BlockInfo& block : blocks)
+		{
+			table >> block.size >> block.storedSize;
+			if (block.size == 0 || block.size > m_blockSize || block.storedSize > block.size)
+				return false;
+
+			block.dataOffset = dataOffset + BlockHeaderSize;
+			block.position = position;
+
+			dataOffset = block.dataOffset + block.storedSize;
+			position += block.size;
+		}
+
+		// The end marker must be right before the seek table
+		if (m_streamOffset + dataOffset + BlockHeaderSize != tableOffset)
+			return false;
+
+		m_blocks = std::move(blocks);
+		m_lastBlockFound = true;
+		m_size = position;
+		m_streamSize = dataOffset + BlockHeaderSize + tableSize + FooterSize;
+
+		return true;
+	}
+
+	/*!
+	* \brief Adds data to the pending blocks, compressing them once a batch is full
+	* \return Number of bytes written
+	*
+	* \param buffer Pointer to the data
+	* \param size Size of the data
+	*/
+	std::size_t CompressedStream::WriteBlock(const void* buffer, std::size_t size)
+	{
+		NazaraAssert(m_stream, "Compressed stream is not open");
+
+		const UInt8* ptr = static_cast<const UInt8*>(buffer);
+		std::size_t batchSize = m_blockSize * m_compressedBlocks.size();
+
+		std::size_t writtenSize = 0;
+		while (writtenSize < size)
+		{
+			std::size_t copySize = std::min(size - writtenSize, batchSize - m_blockData.size());
+			m_blockData.insert(m_blockData.end(), ptr + writtenSize, ptr + writtenSize + copySize);
+
+			writtenSize += copySize;
+			m_cursorPos += copySize;
+			m_size += copySize;
+
+			if (m_blockData.size() == batchSize && !CompressBlocks(batchSize))
+				break;
+		}
+
+		return writtenSize;
+	}
+
+	constexpr std::size_t CompressedStream::BlockHeaderSize;
+	constexpr std::size_t CompressedStream::DefaultBlockSize;
+	constexpr std::size_t CompressedStream::FooterSize;
+	constexpr std::size_t CompressedStream::HeaderSize;
+	constexpr UInt32 CompressedStream::Magic;
+	constexpr UInt32 CompressedStream::Version;
+}
@@ -0,0 +1,307 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/ConcurrentMemoryPool.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		static_assert(sizeof(std::atomic<UInt32>) == sizeof(UInt32), "Free block links must fit in the blocks");
+
+		// Every running thread gets a small index, given back when it exits so the indices stay compact
+		Mutex s_threadSlotMutex;
+		std::vector<unsigned int> s_freeThreadSlots;
+		unsigned int s_nextThreadSlot = 0;
+
+		struct ThreadSlot
+		{
+			ThreadSlot()
+			{
+				LockGuard lock(s_threadSlotMutex);
+
+				if (!s_freeThreadSlots.empty())
+				{
+					index = s_freeThreadSlots.back();
+					s_freeThreadSlots.pop_back();
+				}
+				else
+					index = s_nextThreadSlot++;
+			}
+
+			~ThreadSlot()
+			{
+				LockGuard lock(s_threadSlotMutex);
+				s_freeThreadSlots.push_back(index);
+			}
+
+			unsigned int index;
+		};
+
+		unsigned int GetThreadSlot()
+		{
+			thread_local ThreadSlot slot;
+			return slot.index;
+		}
+
+		UInt64 MakeHead(UInt64 previousHead, UInt32 index)
+		{
+			// Every change of the top of the free list bumps the tag, so a stale compare-exchange always fails (ABA problem)
+			return (((previousHead >> 32) + 1) << 32) | index;
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::ConcurrentMemoryPool
+	* \brief Core class that represents a memory pool which can be used from multiple threads at once
+	*
+	* Unlike MemoryPool, blocks may be allocated and freed concurrently, and from different threads.
+	* Each thread keeps a small magazine of free blocks which is refilled from (and flushed to) a lock-free free list shared by all threads,
+	* so that most allocations and releases do not touch any shared state.
+	* The pool grows by chunks twice as big as the previous one, only this (rare) growth takes a lock.
+	*
+	* \remark Blocks are only given back to the system when the pool is destroyed
+	* \remark At most cachedThreadCount threads get a magazine, other threads directly use the shared free list
+	*/
+
+	/*!
+	* \brief Constructs a ConcurrentMemoryPool object
+	*
+	* \param blockSize Size of blocks that will be allocated (rounded up to four bytes)
+	* \param chunkSize Number of blocks of the first chunk, next chunks double in size
+	* \param magazineSize Number of free blocks a thread keeps for itself
+	* \param cachedThreadCount Number of threads which can get a magazine
+	*/
+
+	ConcurrentMemoryPool::ConcurrentMemoryPool(std::size_t blockSize, std::size_t chunkSize, std::size_t magazineSize, std::size_t cachedThreadCount) :
+	m_head(InvalidBlock),
+	m_blockCount(0),
+	m_chunkCount(0),
+	m_blockSize((std::max<std::size_t>(blockSize, 1) + sizeof(UInt32) - 1) / sizeof(UInt32) * sizeof(UInt32)),
+	m_cachedThreadCount(cachedThreadCount),
+	m_chunkSize(std::max<std::size_t>(chunkSize, 1)),
+	m_magazineSize(std::max<std::size_t>(magazineSize, 2))
+	{
+		for (std::atomic<UInt8*>& chunk : m_chunks)
+			chunk.store(nullptr, std::memory_order_relaxed);
+
+		m_caches.reset(new ThreadCache[m_cachedThreadCount]);
+		m_cachedBlocks.reset(new UInt32[m_cachedThreadCount * m_magazineSize]);
+
+		for (std::size_t i = 0; i < m_cachedThreadCount; ++i)
+		{
+			m_caches[i].blocks = &m_cachedBlocks[i * m_magazineSize];
+			m_caches[i].count = 0;
+		}
+
+		Grow();
+	}
+
+	/*!
+	* \brief Destructs the pool and releases all its chunks
+	*
+	* \remark Every block of the pool must have been freed by then, objects are not destroyed
+	*/
+
+	ConcurrentMemoryPool::~ConcurrentMemoryPool()
+	{
+		unsigned int chunkCount = m_chunkCount.load(std::memory_order_acquire);
+		for (unsigned int i = 0; i < chunkCount; ++i)
+			delete[] m_chunks[i].load(std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Allocates enough memory for the size and returns a pointer to it
+	* \return A pointer to memory allocated
+	*
+	* \param size Size to allocate
+	*
+	* \remark If the size is greather than the block size of the pool, new operator is called
+	* \remark This function is thread-safe
+	*/
+
+	void* ConcurrentMemoryPool::Allocate(std::size_t size)
+	{
+		if (size <= m_blockSize)
+		{
+			unsigned int threadSlot = GetThreadSlot();
+			if (threadSlot < m_cachedThreadCount)
+			{
+				ThreadCache& cache = m_caches[threadSlot];
+				if (cache.count == 0)
+				{
+					// Refill half the magazine, so the next frees do not have to flush it right away
+					UInt32 block = AcquireBlock();
+					if (block != InvalidBlock)
+					{
+						cache.blocks[cache.count++] = block;
+
+						std::size_t refillCount = m_magazineSize / 2;
+						while (cache.count < refillCount && (block = Pop()) != InvalidBlock)
+							cache.blocks[cache.count++] = block;
+					}
+				}
+
+				if (cache.count > 0)
+					return GetBlock(cache.blocks[--cache.count]);
+			}
+			else
+			{
+				UInt32 block = AcquireBlock();
+				if (block != InvalidBlock)
+					return GetBlock(block);
+			}
+		}
+
+		return OperatorNew(size);
+	}
+
+	/*!
+	* \brief Frees the memory represented by the pointer
+	*
+	* The block is kept by the calling thread if its magazine is not full, else half of the magazine is given back to the shared free list.
+	* If the pointer does not belong to the pool, operator delete is called
+	*
+	* \remark Throws a std::runtime_error if pointer does not point to an element of the pool with NAZARA_CORE_SAFE defined
+	* \remark If ptr is null, nothing is done
+	* \remark This function is thread-safe, the block does not have to be freed by the thread which allocated it
+	*/
+
+	void ConcurrentMemoryPool::Free(void* ptr)
+	{
+		if (!ptr)
+			return;
+
+		UInt32 block = GetBlockIndex(ptr);
+		if (block == InvalidBlock)
+		{
+			OperatorDelete(ptr);
+			return;
+		}
+
+		unsigned int threadSlot = GetThreadSlot();
+		if (threadSlot < m_cachedThreadCount)
+		{
+			ThreadCache& cache = m_caches[threadSlot];
+			if (cache.count == m_magazineSize)
+			{
+				std::size_t keptCount = m_magazineSize / 2;
+				for (std::size_t i = keptCount; i < m_magazineSize - 1; ++i)
+					GetBlockLink(cache.blocks[i]).store(cache.blocks[i + 1], std::memory_order_relaxed);
+
+				Push(cache.blocks[keptCount], cache.blocks[m_magazineSize - 1]);
+				cache.count = keptCount;
+			}
+
+			cache.blocks[cache.count++] = block;
+		}
+		else
+			Push(block, block);
+	}
+
+	UInt32 ConcurrentMemoryPool::AcquireBlock()
+	{
+		for (;;)
+		{
+			UInt32 block = Pop();
+			if (block != InvalidBlock)
+				return block;
+
+			if (!Grow())
+				return InvalidBlock;
+		}
+	}
+
+	UInt32 ConcurrentMemoryPool::GetBlockIndex(const void* ptr) const
+	{
+		const UInt8* blockPtr = static_cast<const UInt8*>(ptr);
+
+		unsigned int chunkCount = m_chunkCount.load(std::memory_order_acquire);
+		for (unsigned int i = 0; i < chunkCount; ++i)
+		{
+			const UInt8* chunk = m_chunks[i].load(std::memory_order_relaxed);
+			std::size_t chunkBlockCount = m_chunkSize << i;
+
+			if (blockPtr >= chunk && blockPtr < chunk + chunkBlockCount * m_blockSize)
+			{
+				std::size_t offset = blockPtr - chunk;
+
+				#if NAZARA_CORE_SAFE
+				if (offset % m_blockSize != 0)
+					throw std::runtime_error("Invalid pointer (does not point to an element of the pool)");
+				#endif
+
+				return static_cast<UInt32>(m_chunkSize * ((std::size_t(1) << i) - 1) + offset / m_blockSize);
+			}
+		}
+
+		return InvalidBlock;
+	}
+
+	bool ConcurrentMemoryPool::Grow()
+	{
+		LockGuard lock(m_growMutex);
+
+		// Another thread may have grown the pool or freed blocks while we were waiting
+		if (static_cast<UInt32>(m_head.load(std::memory_order_acquire)) != InvalidBlock)
+			return true;
+
+		unsigned int chunkIndex = m_chunkCount.load(std::memory_order_relaxed);
+		if (chunkIndex >= MaxChunkCount)
+			return false;
+
+		UInt64 firstBlock = UInt64(m_chunkSize) * ((UInt64(1) << chunkIndex) - 1);
+		UInt64 blockCount = UInt64(m_chunkSize) << chunkIndex;
+		if (firstBlock + blockCount >= InvalidBlock)
+			return false;
+
+		UInt8* chunk = new UInt8[blockCount * m_blockSize];
+		for (UInt64 i = 0; i < blockCount - 1; ++i)
+			PlacementNew(reinterpret_cast<std::atomic<UInt32>*>(&chunk[i * m_blockSize]), static_cast<UInt32>(firstBlock + i + 1));
+
+		PlacementNew(reinterpret_cast<std::atomic<UInt32>*>(&chunk[(blockCount - 1) * m_blockSize]), UInt32(InvalidBlock));
+
+		m_chunks[chunkIndex].store(chunk, std::memory_order_relaxed);
+		m_chunkCount.store(chunkIndex + 1, std::memory_order_release);
+		m_blockCount.fetch_add(static_cast<std::size_t>(blockCount), std::memory_order_relaxed);
+
+		Push(static_cast<UInt32>(firstBlock), static_cast<UInt32>(firstBlock + blockCount - 1));
+
+		return true;
+	}
+
+	UInt32 ConcurrentMemoryPool::Pop()
+	{
+		UInt64 head = m_head.load(std::memory_order_acquire);
+		for (;;)
+		{
+			UInt32 block = static_cast<UInt32>(head);
+			if (block == InvalidBlock)
+				return InvalidBlock;
+
+			// The block may have been popped (and written to) by another thread meanwhile, the tag makes the exchange fail in that case
+			UInt32 next = GetBlockLink(block).load(std::memory_order_relaxed);
+			if (m_head.compare_exchange_weak(head, MakeHead(head, next), std::memory_order_acquire, std::memory_order_acquire))
+				return block;
+		}
+	}
+
+	void ConcurrentMemoryPool::Push(UInt32 first, UInt32 last)
+	{
+		UInt64 head = m_head.load(std::memory_order_relaxed);
+		do
+		{
+			GetBlockLink(last).store(static_cast<UInt32>(head), std::memory_order_relaxed);
+		}
+		while (!m_head.compare_exchange_weak(head, MakeHead(head, first), std::memory_order_release, std::memory_order_relaxed));
+	}
+}
@@ -4,10 +4,15 @@
 
 #include <Nazara/Core/Core.hpp>
 #include <Nazara/Core/Config.hpp>
+#include <Nazara/Core/FileIOQueue.hpp>
 #include <Nazara/Core/HardwareInfo.hpp>
 #include <Nazara/Core/Log.hpp>
 #include <Nazara/Core/PluginManager.hpp>
+#include <Nazara/Core/Profiler.hpp>
+#include <Nazara/Core/ResourceWatcher.hpp>
+#include <Nazara/Core/SimdDispatcher.hpp>
 #include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Core/VirtualFileSystem.hpp>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
@@ -33,9 +38,12 @@ namespace Nz
 			return true; // Already initialized
 		}
 
+		Profiler::Scope profilerScope("Core::Initialize");
+
 		s_moduleReferenceCounter++;
 
 		Log::Initialize();
+		SimdDispatcher::Initialize();
 
 		NazaraNotice("Initialized: Core");
 		return true;
@@ -71,10 +79,14 @@ namespace Nz
 		// Free of module
 		s_moduleReferenceCounter = 0;
 
+		FileIOQueue::Uninitialize();
 		HardwareInfo::Uninitialize();
 		Log::Uninitialize();
 		PluginManager::Uninitialize();
+		ResourceWatcher::Uninitialize();
+		SimdDispatcher::Uninitialize();
 		TaskScheduler::Uninitialize();
+		VirtualFileSystem::Uninitialize();
 
 		NazaraNotice("Uninitialized: Core");
 	}
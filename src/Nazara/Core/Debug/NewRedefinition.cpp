@@ -11,24 +11,28 @@
 #define NAZARA_DEBUG_NEWREDEFINITION_DISABLE_REDEFINITION
 #include <Nazara/Core/Debug/NewRedefinition.hpp>
 
-void* operator new(std::size_t size, const char* file, unsigned int line)
+void* operator new(std::size_t size, const char* file, unsigned int line, Nz::MemoryTag tag)
 {
-	return Nz::MemoryManager::Allocate(size, false, file, line);
+	return Nz::MemoryManager::Allocate(size, false, file, line, tag);
 }
 
-void* operator new[](std::size_t size, const char* file, unsigned int line)
+void* operator new[](std::size_t size, const char* file, unsigned int line, Nz::MemoryTag tag)
 {
-	return Nz::MemoryManager::Allocate(size, true, file, line);
+	return Nz::MemoryManager::Allocate(size, true, file, line, tag);
 }
 
-void operator delete(void* ptr, const char* file, unsigned int line) noexcept
+void operator delete(void* ptr, const char* file, unsigned int line, Nz::MemoryTag tag) noexcept
 {
+	NazaraUnused(tag);
+
 	Nz::MemoryManager::NextFree(file, line);
 	Nz::MemoryManager::Free(ptr, false);
 }
 
-void operator delete[](void* ptr, const char* file, unsigned int line) noexcept
+void operator delete[](void* ptr, const char* file, unsigned int line, Nz::MemoryTag tag) noexcept
 {
+	NazaraUnused(tag);
+
 	Nz::MemoryManager::NextFree(file, line);
 	Nz::MemoryManager::Free(ptr, true);
 }
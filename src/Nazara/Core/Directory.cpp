@@ -4,11 +4,15 @@
 
 #include <Nazara/Core/Directory.hpp>
 #include <Nazara/Core/Config.hpp>
+#include <Nazara/Core/DirectoryCache.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/File.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
 #include <cstddef>
 #include <cstring>
+#include <iterator>
 #include <string>
+#include <unordered_set>
 
 #if defined(NAZARA_PLATFORM_WINDOWS)
 	#include <Nazara/Core/Win32/DirectoryImpl.hpp>
@@ -514,6 +518,138 @@ namespace Nz
 		return DirectoryImpl::Remove(File::NormalizePath(dirPath));
 	}
 
+	/*!
+	* \brief Lists the entries of a directory, with their size and write time
+	* \return true if the directory could be read
+	*
+	* Directories are read by large batches (getdents64 on Linux, large fetches on Windows), which also give most of the metadata.
+	* When scanning recursively, every directory of a level is read in parallel by the task scheduler, spreading subtrees over its workers.
+	* Directories whose modification time didn't change since they were cached are not read again.
+	*
+	* \param dirPath Path of the directory
+	* \param entries Vector the entries are appended to, in no particular order
+	* \param recursive Should subdirectories be scanned too (symbolic links to directories are not followed)
+	* \param cache Optional cache, used for unchanged directories and updated with the ones read
+	*
+	* \remark Subdirectories which can't be read produce a NazaraError, but don't make the scan fail
+	* \remark As it uses the task scheduler, this should not be called from inside a task
+	*
+	* \see DirectoryCache
+	*/
+
+	bool Directory::Scan(const String& dirPath, std::vector<DirectoryEntry>* entries, bool recursive, DirectoryCache* cache)
+	{
+		NazaraAssert(entries, "Invalid entry vector");
+
+		if (dirPath.IsEmpty())
+			return false;
+
+		String rootPath = File::NormalizePath(dirPath);
+		if (rootPath.GetSize() > 1 && rootPath.EndsWith(NAZARA_DIRECTORY_SEPARATOR))
+			rootPath = rootPath.SubString(0, -2);
+
+		struct ScanResult
+		{
+			std::vector<DirectoryEntry> entries;
+			UInt64 stamp;
+			bool cached;
+			bool succeeded;
+		};
+
+		std::unordered_set<String> scannedDirectories;
+		std::vector<ScanResult> results;
+		std::vector<String> directories = {rootPath};
+		std::vector<String> subdirectories;
+
+		bool isRoot = true;
+		while (!directories.empty())
+		{
+			results.clear();
+			results.resize(directories.size());
+
+			TaskScheduler::ParallelFor(0, directories.size(), 1, [&](std::size_t begin, std::size_t end)
+			{
+				for (std::size_t i = begin; i < end; ++i)
+				{
+					const String& path = directories[i];
+					ScanResult& result = results[i];
+
+					if (cache)
+					{
+						auto it = cache->m_directories.find(path);
+						if (it != cache->m_directories.end() && DirectoryImpl::GetModificationStamp(path, &result.stamp) && result.stamp == it->second.stamp)
+						{
+							result.entries = it->second.entries;
+							result.cached = true;
+							result.succeeded = true;
+							continue;
+						}
+					}
+
+					result.cached = false;
+					result.succeeded = DirectoryImpl::List(path, &result.entries, &result.stamp);
+				}
+			});
+
+			if (isRoot && !results.front().succeeded)
+				return false;
+
+			isRoot = false;
+
+			subdirectories.clear();
+			for (std::size_t i = 0; i < directories.size(); ++i)
+			{
+				ScanResult& result = results[i];
+				if (!result.succeeded)
+					continue;
+
+				if (recursive)
+				{
+					for (const DirectoryEntry& entry : result.entries)
+					{
+						if (entry.isDirectory && !entry.isLink)
+							subdirectories.push_back(entry.path);
+					}
+				}
+
+				if (cache)
+				{
+					if (!result.cached)
+					{
+						DirectoryCache::CachedDirectory& cachedDirectory = cache->m_directories[directories[i]];
+						cachedDirectory.entries = result.entries;
+						cachedDirectory.stamp = result.stamp;
+					}
+
+					scannedDirectories.insert(directories[i]);
+				}
+
+				entries->insert(entries->end(), std::make_move_iterator(result.entries.begin()), std::make_move_iterator(result.entries.end()));
+			}
+
+			if (!recursive)
+				break;
+
+			std::swap(directories, subdirectories);
+		}
+
+		// Once a whole tree has been scanned, directories of this tree which weren't found anymore are removed from the cache
+		if (cache && recursive)
+		{
+			String prefix = rootPath + NAZARA_DIRECTORY_SEPARATOR;
+			for (auto it = cache->m_directories.begin(); it != cache->m_directories.end();)
+			{
+				const String& path = it->first;
+				if ((path == rootPath || path.StartsWith(prefix)) && scannedDirectories.find(path) == scannedDirectories.end())
+					it = cache->m_directories.erase(it);
+				else
+					++it;
+			}
+		}
+
+		return true;
+	}
+
 	/*!
 	* \brief Sets the current directory
 	* \return true if directory path exists
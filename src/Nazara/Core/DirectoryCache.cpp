@@ -0,0 +1,210 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/DirectoryCache.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/File.hpp>
+#include <cstring>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		enum EntryFlag : UInt8
+		{
+			EntryFlag_Directory = 0x1,
+			EntryFlag_Link      = 0x2
+		};
+
+		template<typename T>
+		void WriteValue(ByteArray& data, T value)
+		{
+			data.Append(&value, sizeof(T));
+		}
+
+		void WriteString(ByteArray& data, const String& string)
+		{
+			WriteValue(data, static_cast<UInt32>(string.GetSize()));
+			data.Append(string.GetConstBuffer(), string.GetSize());
+		}
+
+		class Reader
+		{
+			public:
+				Reader(const ByteArray& data) :
+				m_ptr(data.GetConstBuffer()),
+				m_end(data.GetConstBuffer() + data.GetSize())
+				{
+				}
+
+				template<typename T>
+				bool Read(T* value)
+				{
+					if (static_cast<std::size_t>(m_end - m_ptr) < sizeof(T))
+						return false;
+
+					std::memcpy(value, m_ptr, sizeof(T));
+					m_ptr += sizeof(T);
+					return true;
+				}
+
+				bool Read(String* string)
+				{
+					UInt32 size;
+					if (!Read(&size) || static_cast<std::size_t>(m_end - m_ptr) < size)
+						return false;
+
+					string->Set(reinterpret_cast<const char*>(m_ptr), size);
+					m_ptr += size;
+					return true;
+				}
+
+				std::size_t GetRemainingSize() const
+				{
+					return static_cast<std::size_t>(m_end - m_ptr);
+				}
+
+			private:
+				const UInt8* m_ptr;
+				const UInt8* m_end;
+		};
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::DirectoryCache
+	* \brief Core class that keeps the entries of scanned directories, listing them again only when their modification time changes
+	*
+	* A directory modification time changes when entries are added, removed or renamed, checking it takes a single stat per directory.
+	* The cache can be saved to a file, to speed up the scan of large content trees from one run to the next.
+	*
+	* \remark Files modified in place don't change the modification time of their directory, their size and write time may be outdated
+	* \remark Cache files use the endianness of the machine, and are simply rejected on a mismatch
+	*
+	* \see Directory::Scan
+	*/
+
+	/*!
+	* \brief Loads a cache saved with SaveToFile, replacing the cached directories
+	* \return true if the file was loaded, false if it couldn't be read or is invalid (the cache is then empty)
+	*
+	* \param filePath Path to the cache file
+	*/
+
+	bool DirectoryCache::LoadFromFile(const String& filePath)
+	{
+		m_directories.clear();
+
+		File file(filePath);
+		if (!file.Open(OpenMode_ReadOnly))
+			return false;
+
+		ByteArray data(static_cast<std::size_t>(file.GetSize()), 0);
+		if (file.Read(data.GetBuffer(), data.GetSize()) != data.GetSize())
+		{
+			NazaraError("Failed to read \"" + filePath + '"');
+			return false;
+		}
+
+		Reader reader(data);
+
+		UInt32 magic;
+		UInt32 version;
+		UInt32 directoryCount;
+		if (!reader.Read(&magic) || magic != Magic || !reader.Read(&version) || version != Version || !reader.Read(&directoryCount))
+		{
+			NazaraWarning("\"" + filePath + "\" is not a valid directory cache");
+			return false;
+		}
+
+		for (UInt32 i = 0; i < directoryCount; ++i)
+		{
+			String path;
+			UInt32 entryCount;
+			UInt64 stamp;
+			if (!reader.Read(&path) || !reader.Read(&stamp) || !reader.Read(&entryCount) || entryCount > reader.GetRemainingSize())
+			{
+				NazaraWarning("\"" + filePath + "\" is corrupted");
+				m_directories.clear();
+				return false;
+			}
+
+			CachedDirectory& directory = m_directories[path];
+			directory.stamp = stamp;
+			directory.entries.resize(entryCount);
+
+			for (DirectoryEntry& entry : directory.entries)
+			{
+				String name;
+				Int64 lastWriteTime;
+				UInt8 flags;
+				if (!reader.Read(&name) || !reader.Read(&entry.size) || !reader.Read(&lastWriteTime) || !reader.Read(&flags))
+				{
+					NazaraWarning("\"" + filePath + "\" is corrupted");
+					m_directories.clear();
+					return false;
+				}
+
+				entry.path = path + NAZARA_DIRECTORY_SEPARATOR + name;
+				entry.isDirectory = (flags & EntryFlag_Directory) != 0;
+				entry.isLink = (flags & EntryFlag_Link) != 0;
+				entry.lastWriteTime = static_cast<time_t>(lastWriteTime);
+			}
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Saves the cached directories to a file
+	* \return true if the file was written
+	*
+	* \param filePath Path to the cache file
+	*/
+
+	bool DirectoryCache::SaveToFile(const String& filePath) const
+	{
+		ByteArray data;
+		WriteValue(data, Magic);
+		WriteValue(data, Version);
+		WriteValue(data, static_cast<UInt32>(m_directories.size()));
+
+		for (const auto& pair : m_directories)
+		{
+			const String& path = pair.first;
+			const CachedDirectory& directory = pair.second;
+
+			WriteString(data, path);
+			WriteValue(data, directory.stamp);
+			WriteValue(data, static_cast<UInt32>(directory.entries.size()));
+
+			// Entries only store their name, their path being the one of the directory
+			for (const DirectoryEntry& entry : directory.entries)
+			{
+				UInt8 flags = 0;
+				if (entry.isDirectory)
+					flags |= EntryFlag_Directory;
+
+				if (entry.isLink)
+					flags |= EntryFlag_Link;
+
+				WriteString(data, entry.path.SubString(path.GetSize() + 1));
+				WriteValue(data, entry.size);
+				WriteValue(data, static_cast<Int64>(entry.lastWriteTime));
+				WriteValue(data, flags);
+			}
+		}
+
+		File file(filePath);
+		if (!file.Open(OpenMode_WriteOnly | OpenMode_Truncate) || !file.Write(data))
+		{
+			NazaraError("Failed to write \"" + filePath + '"');
+			return false;
+		}
+
+		return true;
+	}
+}
@@ -110,6 +110,27 @@ namespace Nz
 		#endif
 	}
 
+	/*!
+	* \brief Checks whether an error would be discarded
+	* \return true if the error would neither be logged, kept as the last error nor thrown
+	*
+	* Error macros check this before building their message, discarded errors cost nothing but this call.
+	*
+	* \param type ErrorType of the error
+	*
+	* \remark Silenced errors (ErrorFlag_Silent) are still kept as the last error, only ErrorFlag_Discard skips them
+	* \remark Assertion failures are never discarded, nor errors which would throw an exception
+	*/
+
+	bool Error::IsDiscarded(ErrorType type)
+	{
+		if (type == ErrorType_AssertFailed || (s_flags & ErrorFlag_Discard) == 0)
+			return false;
+
+		bool throwException = (type != ErrorType_Warning && (s_flags & ErrorFlag_ThrowException) != 0 && (s_flags & ErrorFlag_ThrowExceptionDisabled) == 0);
+		return !throwException;
+	}
+
 	/*!
 	* \brief Sets the flags
 	*
@@ -133,6 +154,9 @@ namespace Nz
 
 	void Error::Trigger(ErrorType type, const String& error)
 	{
+		if (IsDiscarded(type))
+			return;
+
 		if (type == ErrorType_AssertFailed || (s_flags & ErrorFlag_Silent) == 0 || (s_flags & ErrorFlag_SilentDisabled) != 0)
 			Log::WriteError(type, error);
 
@@ -166,6 +190,9 @@ namespace Nz
 
 	void Error::Trigger(ErrorType type, const String& error, unsigned int line, const char* file, const char* function)
 	{
+		if (IsDiscarded(type))
+			return;
+
 		file = Nz::Directory::GetCurrentFileRelativeToEngine(file);
 
 		if (type == ErrorType_AssertFailed || (s_flags & ErrorFlag_Silent) == 0 || (s_flags & ErrorFlag_SilentDisabled) != 0)
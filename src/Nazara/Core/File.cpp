@@ -102,6 +102,8 @@ namespace Nz
 
 		if (m_impl)
 		{
+			FileIOQueue::Wait(m_impl);
+
 			m_impl->Close();
 			delete m_impl;
 			m_impl = nullptr;
@@ -227,6 +229,24 @@ namespace Nz
 		return m_filePath.SubStringFrom(NAZARA_DIRECTORY_SEPARATOR, -1, true);
 	}
 
+	/*!
+	* \brief Gets the alignment asynchronous operations on an unbuffered file require
+	* \return Alignment of the offsets, sizes and buffer addresses, in bytes
+	*
+	* \remark The file must be open
+	*
+	* \see OpenMode_Unbuffered
+	*/
+
+	std::size_t File::GetIOAlignment() const
+	{
+		NazaraLock(m_mutex)
+
+		NazaraAssert(IsOpen(), "File is not open");
+
+		return m_impl->GetIOAlignment();
+	}
+
 	/*!
 	* \brief Gets the last time the file was accessed
 	* \return Information about the last access time
@@ -347,6 +367,41 @@ namespace Nz
 		return Open(openMode);
 	}
 
+	/*!
+	* \brief Reads blocks of the file from a background thread
+	* \return Future of the result, holding the number of bytes read (less than size at the end of the file)
+	*
+	* \param offset Position in the file to read from
+	* \param buffer Buffer receiving the data, which must stay valid until the operation completes
+	* \param size Size to read
+	* \param priority Priority of the request, higher ones are processed first
+	*
+	* \remark The cursor position is not affected by this call, and the data is not buffered through the stream
+	* \remark If the file is unbuffered, offset, size and buffer address must be aligned to GetIOAlignment()
+	* \remark The file must be open in read mode
+	*
+	* \see FileIOQueue
+	*/
+
+	std::future<FileIOResult> File::ReadAsync(UInt64 offset, void* buffer, std::size_t size, IOPriority priority)
+	{
+		NazaraLock(m_mutex)
+
+		NazaraAssert(IsOpen(), "File is not open");
+		NazaraAssert(IsReadable(), "File is not readable");
+		NazaraAssert(buffer || size == 0, "Invalid buffer");
+
+		if (!m_impl->EnableAsync())
+		{
+			std::promise<FileIOResult> failure;
+			failure.set_value(FileIOResult());
+
+			return failure.get_future();
+		}
+
+		return FileIOQueue::Enqueue(m_impl, FileIOQueue::Operation::Read, offset, buffer, size, priority);
+	}
+
 	/*!
 	* \brief Renames the file with a new name
 	* \return true if rename is successful
@@ -458,6 +513,55 @@ namespace Nz
 		return m_impl->SetSize(size);
 	}
 
+	/*!
+	* \brief Waits for the asynchronous operations on this file to complete
+	*
+	* \remark Closing the file waits for them as well
+	*/
+
+	void File::WaitForAsync()
+	{
+		NazaraLock(m_mutex)
+
+		if (m_impl)
+			FileIOQueue::Wait(m_impl);
+	}
+
+	/*!
+	* \brief Writes blocks to the file from a background thread
+	* \return Future of the result, holding the number of bytes written
+	*
+	* \param offset Position in the file to write to
+	* \param buffer Data to write, which must stay valid until the operation completes
+	* \param size Size to write
+	* \param priority Priority of the request, higher ones are processed first
+	*
+	* \remark The cursor position is not affected by this call, and the data is not buffered through the stream
+	* \remark If the file is unbuffered, offset, size and buffer address must be aligned to GetIOAlignment()
+	* \remark The file must be open in write mode
+	*
+	* \see FileIOQueue
+	*/
+
+	std::future<FileIOResult> File::WriteAsync(UInt64 offset, const void* buffer, std::size_t size, IOPriority priority)
+	{
+		NazaraLock(m_mutex)
+
+		NazaraAssert(IsOpen(), "File is not open");
+		NazaraAssert(IsWritable(), "File is not writable");
+		NazaraAssert(buffer || size == 0, "Invalid buffer");
+
+		if (!m_impl->EnableAsync())
+		{
+			std::promise<FileIOResult> failure;
+			failure.set_value(FileIOResult());
+
+			return failure.get_future();
+		}
+
+		return FileIOQueue::Enqueue(m_impl, FileIOQueue::Operation::Write, offset, const_cast<void*>(buffer), size, priority);
+	}
+
 	/*!
 	* \brief Sets the file path
 	* \return A reference to this
@@ -556,6 +660,29 @@ namespace Nz
 		return stream;
 	}
 
+	/*!
+	* \brief Gets the canonical path of the file, the same for every path leading to it
+	* \return Canonical path of the file
+	*
+	* Unlike AbsolutePath, the file system is queried to resolve the links (and the case of the path on Windows),
+	* a file which doesn't exist keeps its absolute path.
+	*
+	* \param filePath Path of the file
+	*/
+
+	String File::CanonicalPath(const String& filePath)
+	{
+		String path = AbsolutePath(filePath);
+		if (path.IsEmpty())
+			return path;
+
+		// Repeated separators are ignored by the file system, network paths keeping their two leading ones
+		static String doubleSeparator = String(NAZARA_DIRECTORY_SEPARATOR) + NAZARA_DIRECTORY_SEPARATOR;
+		while (path.Replace(doubleSeparator, String(NAZARA_DIRECTORY_SEPARATOR), 1) > 0);
+
+		return FileImpl::CanonicalPath(path);
+	}
+
 	/*!
 	* \brief Copies the first file to a new file path
 	* \return true if copy is successful
@@ -0,0 +1,244 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/FileIOQueue.hpp>
+#include <Nazara/Core/ConditionVariable.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/Thread.hpp>
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <iterator>
+#include <unordered_map>
+#include <vector>
+
+#if defined(NAZARA_PLATFORM_WINDOWS)
+	#include <Nazara/Core/Win32/FileImpl.hpp>
+#elif defined(NAZARA_PLATFORM_POSIX)
+	#include <Nazara/Core/Posix/FileImpl.hpp>
+#else
+	#error OS not handled
+#endif
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	struct FileIOQueue::Request
+	{
+		FileImpl* file;
+		Operation operation;
+		UInt64 offset;
+		std::promise<FileIOResult> promise;
+		std::size_t size;
+		void* buffer;
+	};
+
+	struct FileIOQueue::State
+	{
+		ConditionVariable completionCondition;
+		ConditionVariable requestCondition;
+		Mutex mutex;
+		std::array<std::deque<Request>, IOPriority_Max + 1> requests;
+		std::size_t pendingCount = 0;
+		std::unordered_map<FileImpl*, std::size_t> pendingByFile;
+		std::vector<Thread> threads;
+		bool running = false;
+	};
+
+	/*!
+	* \ingroup core
+	* \class Nz::FileIOQueue
+	* \brief Core class that performs the asynchronous file operations from background threads
+	*
+	* Operations are positional, they never move the cursor of the file, and are processed by priority.
+	* Each thread takes a batch of requests of the same priority and performs it in file and offset order, keeping the accesses sequential.
+	*
+	* \remark Threads are started on the first request and stopped with the core module
+	*
+	* \see File::ReadAsync
+	* \see File::WriteAsync
+	*/
+
+	/*!
+	* \brief Gets the number of requests not completed yet
+	* \return Number of queued or in flight requests
+	*/
+
+	std::size_t FileIOQueue::GetPendingCount()
+	{
+		State& state = GetState();
+
+		LockGuard lock(state.mutex);
+		return state.pendingCount;
+	}
+
+	/*!
+	* \brief Waits for every request to complete
+	*/
+
+	void FileIOQueue::WaitForAll()
+	{
+		State& state = GetState();
+
+		LockGuard lock(state.mutex);
+		while (state.pendingCount > 0)
+			state.completionCondition.Wait(&state.mutex);
+	}
+
+	std::future<FileIOResult> FileIOQueue::Enqueue(FileImpl* file, Operation operation, UInt64 offset, void* buffer, std::size_t size, IOPriority priority)
+	{
+		NazaraAssert(priority <= IOPriority_Max, "I/O priority out of enum");
+
+		State& state = GetState();
+
+		Request request;
+		request.buffer = buffer;
+		request.file = file;
+		request.offset = offset;
+		request.operation = operation;
+		request.size = size;
+
+		std::future<FileIOResult> future = request.promise.get_future();
+
+		LockGuard lock(state.mutex);
+		if (!state.running)
+		{
+			state.running = true;
+
+			for (unsigned int i = 0; i < ThreadCount; ++i)
+			{
+				state.threads.emplace_back(&FileIOQueue::WorkerThread);
+				state.threads.back().SetName("FileIOThread");
+			}
+		}
+
+		state.requests[priority].push_back(std::move(request));
+		state.pendingByFile[file]++;
+		state.pendingCount++;
+		state.requestCondition.Signal();
+
+		return future;
+	}
+
+	FileIOQueue::State& FileIOQueue::GetState()
+	{
+		static State state;
+		return state;
+	}
+
+	/*!
+	* \brief Initializes the FileIOQueue class
+	* \return true
+	*/
+
+	bool FileIOQueue::Initialize()
+	{
+		return true;
+	}
+
+	/*!
+	* \brief Uninitializes the FileIOQueue class, stopping the I/O threads
+	*
+	* \remark Waits for every request to complete, as they write into buffers owned by the caller
+	*/
+
+	void FileIOQueue::Uninitialize()
+	{
+		WaitForAll();
+
+		State& state = GetState();
+
+		std::vector<Thread> threads;
+		{
+			LockGuard lock(state.mutex);
+			state.running = false;
+			state.requestCondition.SignalAll();
+
+			threads = std::move(state.threads);
+			state.threads.clear();
+		}
+
+		for (Thread& thread : threads)
+			thread.Join();
+	}
+
+	void FileIOQueue::Wait(FileImpl* file)
+	{
+		State& state = GetState();
+
+		LockGuard lock(state.mutex);
+		while (state.pendingByFile.find(file) != state.pendingByFile.end())
+			state.completionCondition.Wait(&state.mutex);
+	}
+
+	void FileIOQueue::WorkerThread()
+	{
+		State& state = GetState();
+
+		std::vector<Request> batch;
+		batch.reserve(MaxBatchSize);
+
+		for (;;)
+		{
+			{
+				LockGuard lock(state.mutex);
+
+				auto queueIt = state.requests.rend();
+				for (;;)
+				{
+					queueIt = std::find_if(state.requests.rbegin(), state.requests.rend(), [] (const std::deque<Request>& queue) { return !queue.empty(); });
+					if (!state.running || queueIt != state.requests.rend())
+						break;
+
+					state.requestCondition.Wait(&state.mutex);
+				}
+
+				if (!state.running)
+					return;
+
+				std::deque<Request>& queue = *queueIt;
+
+				std::size_t batchSize = std::min(queue.size(), MaxBatchSize);
+				std::move(queue.begin(), queue.begin() + batchSize, std::back_inserter(batch));
+				queue.erase(queue.begin(), queue.begin() + batchSize);
+			}
+
+			std::sort(batch.begin(), batch.end(), [] (const Request& lhs, const Request& rhs)
+			{
+				if (lhs.file != rhs.file)
+					return lhs.file < rhs.file;
+
+				return lhs.offset < rhs.offset;
+			});
+
+			for (Request& request : batch)
+			{
+				FileIOResult result;
+				if (request.operation == Operation::Read)
+					result.succeeded = request.file->ReadAt(request.offset, request.buffer, request.size, &result.byteCount);
+				else
+					result.succeeded = request.file->WriteAt(request.offset, request.buffer, request.size, &result.byteCount);
+
+				request.promise.set_value(result);
+			}
+
+			{
+				LockGuard lock(state.mutex);
+				for (const Request& request : batch)
+				{
+					auto it = state.pendingByFile.find(request.file);
+					if (--it->second == 0)
+						state.pendingByFile.erase(it);
+				}
+
+				state.pendingCount -= batch.size();
+				state.completionCondition.SignalAll();
+			}
+
+			batch.clear();
+		}
+	}
+}
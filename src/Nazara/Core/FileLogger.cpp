@@ -60,6 +60,16 @@ namespace Nz
 		m_stdReplicationEnabled = enable;
 	}
 
+	/*!
+	* \brief Flushes the output file
+	*/
+
+	void FileLogger::Flush()
+	{
+		if (m_outputFile.IsOpen())
+			m_outputFile.Flush();
+	}
+
 	/*!
 	* \brief Checks whether or not the replication to the stdout is enabled
 	* \return true If replication is enabled
@@ -0,0 +1,139 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/FileWatcher.hpp>
+#include <Nazara/Core/Directory.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/File.hpp>
+#include <algorithm>
+#include <memory>
+
+#if defined(NAZARA_PLATFORM_WINDOWS)
+	#include <Nazara/Core/Win32/FileWatcherImpl.hpp>
+#elif defined(NAZARA_PLATFORM_POSIX)
+	#include <Nazara/Core/Posix/FileWatcherImpl.hpp>
+#else
+	#error OS not handled
+#endif
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::FileWatcher
+	* \brief Core class that reports the files written in some directories
+	*
+	* Changes are queued by the OS (inotify on Linux, ReadDirectoryChangesW on Windows) and retrieved without blocking by Poll, from the thread of your choice.
+	*
+	* \remark Only files being written, created or moved into a watched directory are reported, not removed ones
+	*/
+
+	/*!
+	* \brief Constructs a FileWatcher object watching no directory
+	*/
+	FileWatcher::FileWatcher() = default;
+
+	/*!
+	* \brief Destructs the object and stops watching every directory
+	*/
+	FileWatcher::~FileWatcher()
+	{
+		delete m_impl;
+	}
+
+	/*!
+	* \brief Checks whether a directory is watched
+	* \return true if the directory was passed to Watch
+	*
+	* \param directoryPath Path to the directory
+	*/
+	bool FileWatcher::IsWatching(const String& directoryPath) const
+	{
+		return std::find(m_directories.begin(), m_directories.end(), File::AbsolutePath(directoryPath)) != m_directories.end();
+	}
+
+	/*!
+	* \brief Retrieves the files changed since the last call
+	* \return Number of files added to the list
+	*
+	* \param changedFiles List to which the absolute paths of the changed files are appended, each file is reported once per call
+	*/
+	std::size_t FileWatcher::Poll(std::vector<String>* changedFiles)
+	{
+		NazaraAssert(changedFiles, "Invalid file list");
+
+		if (!m_impl)
+			return 0;
+
+		std::size_t firstFile = changedFiles->size();
+		m_impl->Poll(changedFiles);
+
+		// Editors often write a file in several steps
+		for (std::size_t i = firstFile; i < changedFiles->size();)
+		{
+			if (std::find(changedFiles->begin() + firstFile, changedFiles->begin() + i, (*changedFiles)[i]) != changedFiles->begin() + i)
+				changedFiles->erase(changedFiles->begin() + i);
+			else
+				++i;
+		}
+
+		return changedFiles->size() - firstFile;
+	}
+
+	/*!
+	* \brief Stops watching a directory
+	*
+	* \param directoryPath Path to the directory, as passed to Watch
+	*/
+	void FileWatcher::Unwatch(const String& directoryPath)
+	{
+		String absolutePath = File::AbsolutePath(directoryPath);
+
+		auto it = std::find(m_directories.begin(), m_directories.end(), absolutePath);
+		if (it == m_directories.end())
+			return;
+
+		m_impl->Unwatch(absolutePath);
+		m_directories.erase(it);
+	}
+
+	/*!
+	* \brief Starts watching a directory
+	* \return true if successful
+	*
+	* \param directoryPath Path to the directory
+	* \param recursive Should the files of its subdirectories (including the ones created later) be reported as well
+	*
+	* \remark Produces a NazaraError if the directory does not exist or cannot be watched
+	*/
+	bool FileWatcher::Watch(const String& directoryPath, bool recursive)
+	{
+		String absolutePath = File::AbsolutePath(directoryPath);
+		if (IsWatching(absolutePath))
+			return true;
+
+		if (!Directory::Exists(absolutePath))
+		{
+			NazaraError("Directory \"" + absolutePath + "\" does not exist");
+			return false;
+		}
+
+		if (!m_impl)
+		{
+			std::unique_ptr<FileWatcherImpl> impl(new FileWatcherImpl);
+			if (!impl->IsValid())
+				return false;
+
+			m_impl = impl.release();
+		}
+
+		if (!m_impl->Watch(absolutePath, recursive))
+			return false;
+
+		m_directories.push_back(std::move(absolutePath));
+		return true;
+	}
+}
@@ -0,0 +1,83 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/FrameArena.hpp>
+#include <Nazara/Core/MemoryHelper.hpp>
+#include <algorithm>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::FrameArena
+	* \brief Core class that hands out bump-allocated memory, released all at once
+	*
+	* Allocations only move a pointer forward in the current memory block and are never freed individually,
+	* instead Reset makes the whole memory available again (typically at the end of a frame).
+	* When a frame needed more than one block, Reset replaces them with a single block big enough for all of them,
+	* so that a steady workload stops allocating after its first frames.
+	*
+	* \remark Memory returned by the arena is invalidated by Reset and by the destruction of the arena
+	*/
+
+	/*!
+	* \brief Constructs a FrameArena object
+	*
+	* \param blockSize Minimal size of the memory blocks, the first block is only allocated on first use
+	* \param largePages Should the blocks be allocated in large pages (see LargePageMemory), for arenas growing to megabytes
+	*/
+
+	FrameArena::FrameArena(std::size_t blockSize, bool largePages) :
+	m_allocatedSize(0),
+	m_blockSize(std::max<std::size_t>(blockSize, 1)),
+	m_capacity(0),
+	m_offset(0),
+	m_largePages(largePages)
+	{
+	}
+
+	/*!
+	* \brief Makes all the memory of the arena available again
+	*
+	* \remark Every pointer given by the arena before this call becomes invalid
+	*/
+
+	void FrameArena::Reset()
+	{
+		if (m_blocks.size() > 1)
+		{
+			// Merge blocks into one so the next frames can be served without allocating
+			m_blocks.clear();
+
+			m_blocks.emplace_back(CreateBlock(m_capacity));
+		}
+
+		m_allocatedSize = 0;
+		m_offset = 0;
+	}
+
+	void* FrameArena::AllocateFromNewBlock(std::size_t size, std::size_t alignment)
+	{
+		// Blocks grow with the arena to keep their number low during the first frames
+		m_blocks.emplace_back(CreateBlock(std::max(std::max(m_blockSize, m_capacity), size + alignment - 1)));
+		m_capacity += m_blocks.back().size;
+		m_offset = 0;
+
+		return Allocate(size, alignment);
+	}
+
+	FrameArena::Block FrameArena::CreateBlock(std::size_t size) const
+	{
+		Block block;
+		block.size = size;
+
+		if (m_largePages)
+			block.memory = std::unique_ptr<UInt8[], LargePageDeleter>(static_cast<UInt8*>(LargePageMemory::Allocate(size)), LargePageDeleter{size});
+		else
+			block.memory = std::unique_ptr<UInt8[], LargePageDeleter>(static_cast<UInt8*>(OperatorNew(size)));
+
+		return block;
+	}
+}
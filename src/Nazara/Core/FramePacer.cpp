@@ -0,0 +1,126 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/FramePacer.hpp>
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Thread.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::FramePacer
+	* \brief Core class that limits the framerate and measures the regularity of the frames
+	*
+	* Wait should be called once per frame, it sleeps until the deadline of the frame (if the framerate is limited) and updates the statistics.
+	* Deadlines follow each other at the limited rate instead of being counted from the end of the previous wait, which keeps the frame times even.
+	*
+	* Sleeping is only as precise as the system scheduler, so the pacer sleeps until the sleep margin before the deadline and yields afterwards.
+	* A frame ending after its deadline is late, the deadlines it missed entirely are counted as dropped frames.
+	*/
+
+	/*!
+	* \brief Constructs a FramePacer object
+	*
+	* \param framerateLimit Maximum number of frames per second, zero to not limit the frames
+	*/
+	FramePacer::FramePacer(unsigned int framerateLimit) :
+	m_lastFrameTime(0),
+	m_nextDeadline(0),
+	m_sleepMargin(2000)
+	{
+		SetFramerateLimit(framerateLimit);
+	}
+
+	/*!
+	* \brief Resets the statistics of the frames
+	*/
+	void FramePacer::ResetStatistics()
+	{
+		m_statistics = Statistics();
+	}
+
+	/*!
+	* \brief Restarts the timing, the next call to Wait only starts it again
+	*
+	* \remark This should be called after a pause, so it isn't counted as a frame
+	*/
+	void FramePacer::Restart()
+	{
+		m_lastFrameTime = 0;
+		m_nextDeadline = 0;
+	}
+
+	/*!
+	* \brief Sets the maximum number of frames per second
+	*
+	* \param framerateLimit Maximum number of frames per second, zero to not limit the frames
+	*/
+	void FramePacer::SetFramerateLimit(unsigned int framerateLimit)
+	{
+		m_framerateLimit = framerateLimit;
+		m_frameDuration = (framerateLimit > 0) ? 1'000'000 / framerateLimit : 0;
+		m_nextDeadline = 0; //< Restarts the deadlines from the next frame
+	}
+
+	/*!
+	* \brief Waits for the end of the current frame
+	* \return Duration of the frame in microseconds, including the wait
+	*
+	* \remark The first call only starts the timing, and returns zero
+	*/
+	UInt64 FramePacer::Wait()
+	{
+		UInt64 now = GetElapsedMicroseconds();
+
+		if (m_frameDuration > 0)
+		{
+			if (m_nextDeadline == 0)
+				m_nextDeadline = now + m_frameDuration;
+			else if (now > m_nextDeadline)
+			{
+				// The frame missed its deadline, the next one is counted from now
+				UInt64 lateness = now - m_nextDeadline;
+
+				m_statistics.lateFrameCount++;
+				m_statistics.droppedFrameCount += lateness / m_frameDuration;
+
+				m_nextDeadline = now + m_frameDuration - lateness % m_frameDuration;
+			}
+			else
+			{
+				if (m_nextDeadline - now > m_sleepMargin)
+					Thread::Sleep(static_cast<UInt32>((m_nextDeadline - now - m_sleepMargin) / 1000));
+
+				while ((now = GetElapsedMicroseconds()) < m_nextDeadline)
+					Thread::Sleep(0);
+
+				m_nextDeadline += m_frameDuration;
+			}
+		}
+
+		if (m_lastFrameTime == 0)
+		{
+			m_lastFrameTime = now;
+			return 0;
+		}
+
+		UInt64 frameTime = now - m_lastFrameTime;
+		m_lastFrameTime = now;
+
+		if (m_statistics.frameCount == 0 || frameTime < m_statistics.minFrameTime)
+			m_statistics.minFrameTime = frameTime;
+
+		if (frameTime > m_statistics.maxFrameTime)
+			m_statistics.maxFrameTime = frameTime;
+
+		m_statistics.frameCount++;
+		m_statistics.lastFrameTime = frameTime;
+		m_statistics.totalFrameTime += frameTime;
+		m_statistics.averageFrameTime = m_statistics.totalFrameTime / m_statistics.frameCount;
+
+		return frameTime;
+	}
+}
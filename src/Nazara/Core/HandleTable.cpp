@@ -0,0 +1,111 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/HandleTable.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <vector>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		struct SlotAllocator
+		{
+			Mutex mutex;
+			std::vector<UInt32> freeSlots;
+			UInt32 slotCount = 1; //< The first slot is kept for invalid handles
+		};
+
+		SlotAllocator& GetAllocator()
+		{
+			// Never destroyed, handled objects may be destroyed after it when the program exits
+			static SlotAllocator* allocator = new SlotAllocator;
+			return *allocator;
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::HandleTable
+	* \brief Core class storing the objects handles point to, by index and generation
+	*
+	* An object gets a slot when its first handle is created, and releasing the slot increments its generation, invalidating every handle to it at once.
+	* Slots are stored by chunks which are never moved nor freed, a handle can be checked at any time, even once its object is destroyed.
+	*
+	* \remark Allocating and releasing slots is thread-safe, using an object from another thread while it is destroyed is not
+	*
+	* \see ObjectHandle
+	*/
+
+	/*!
+	* \brief Allocates a slot for an object
+	* \return Index of the slot
+	*
+	* \param object Object the slot points to
+	*/
+	UInt32 HandleTable::Allocate(void* object)
+	{
+		SlotAllocator& allocator = GetAllocator();
+
+		LockGuard lock(allocator.mutex);
+
+		UInt32 index;
+		if (!allocator.freeSlots.empty())
+		{
+			index = allocator.freeSlots.back();
+			allocator.freeSlots.pop_back();
+		}
+		else
+		{
+			index = allocator.slotCount;
+			if (index >> ChunkShift >= ChunkCount)
+			{
+				NazaraError("Too many handled objects");
+				return InvalidIndex;
+			}
+
+			// The chunk is allocated before its first index is handed out, other threads can't see it missing
+			if (!s_chunks[index >> ChunkShift])
+				s_chunks[index >> ChunkShift] = new Slot[ChunkSize]();
+
+			allocator.slotCount++;
+		}
+
+		s_chunks[index >> ChunkShift][index & (ChunkSize - 1)].object = object;
+
+		return index;
+	}
+
+	/*!
+	* \brief Releases a slot, invalidating every handle to its object
+	*
+	* \param index Index of an allocated slot
+	*
+	* \remark The index may be given to another object, its handles having another generation
+	*/
+	void HandleTable::Release(UInt32 index)
+	{
+		NazaraAssert(index != InvalidIndex && s_chunks[index >> ChunkShift], "Invalid slot index");
+
+		Slot& slot = s_chunks[index >> ChunkShift][index & (ChunkSize - 1)];
+		slot.generation++;
+		slot.object = nullptr;
+
+		SlotAllocator& allocator = GetAllocator();
+
+		LockGuard lock(allocator.mutex);
+		allocator.freeSlots.push_back(index);
+	}
+
+	constexpr UInt32 HandleTable::ChunkCount;
+	constexpr UInt32 HandleTable::ChunkShift;
+	constexpr UInt32 HandleTable::ChunkSize;
+	constexpr UInt32 HandleTable::InvalidIndex;
+
+	// Invalid handles have the first slot and a null generation, it never becomes valid
+	HandleTable::Slot HandleTable::s_firstChunk[ChunkSize] = { { nullptr, 1 } };
+	HandleTable::Slot* HandleTable::s_chunks[ChunkCount] = { s_firstChunk };
+}
@@ -6,6 +6,8 @@
 #include <Nazara/Core/Error.hpp>
 #include <algorithm>
 #include <cstring>
+#include <map>
+#include <utility>
 
 #if defined(NAZARA_PLATFORM_WINDOWS)
 	#include <Nazara/Core/Win32/HardwareInfoImpl.hpp>
@@ -74,6 +76,68 @@ namespace Nz
 			{"XenVMMXenVMM", ProcessorVendor_XenHVM}
 		};
 
+		struct ProcessorTopology
+		{
+			std::vector<LogicalProcessor> processors;
+			UInt64 cacheSizes[3] = {0, 0, 0};
+			unsigned int coreCount;
+			unsigned int nodeCount;
+		};
+
+		ProcessorTopology BuildTopology()
+		{
+			ProcessorTopology topology;
+			if (!HardwareInfoImpl::GetProcessorTopology(&topology.processors, topology.cacheSizes) || topology.processors.empty())
+			{
+				// Without topology information, each logical processor is considered to be a core of its own
+				topology.processors.resize(HardwareInfo::GetProcessorCount());
+				for (unsigned int i = 0; i < topology.processors.size(); ++i)
+					topology.processors[i] = LogicalProcessor{i, 0, 0, 0};
+			}
+
+			// Identifiers given by the system may be sparse (and core ones only unique inside a package), we make them contiguous
+			std::map<std::pair<unsigned int, unsigned int>, unsigned int> coreIds;
+			std::map<unsigned int, unsigned int> nodeIds;
+			std::map<unsigned int, unsigned int> packageIds;
+			for (const LogicalProcessor& processor : topology.processors)
+			{
+				coreIds.emplace(std::make_pair(processor.packageId, processor.coreId), 0);
+				nodeIds.emplace(processor.nodeId, 0);
+				packageIds.emplace(processor.packageId, 0);
+			}
+
+			auto MakeContiguous = [](auto& ids)
+			{
+				unsigned int nextId = 0;
+				for (auto& pair : ids)
+					pair.second = nextId++;
+			};
+
+			MakeContiguous(coreIds);
+			MakeContiguous(nodeIds);
+			MakeContiguous(packageIds);
+
+			std::vector<unsigned int> siblingCounts(coreIds.size(), 0);
+			for (LogicalProcessor& processor : topology.processors)
+			{
+				processor.coreId = coreIds[std::make_pair(processor.packageId, processor.coreId)];
+				processor.nodeId = nodeIds[processor.nodeId];
+				processor.packageId = packageIds[processor.packageId];
+				processor.smtIndex = siblingCounts[processor.coreId]++;
+			}
+
+			topology.coreCount = static_cast<unsigned int>(coreIds.size());
+			topology.nodeCount = static_cast<unsigned int>(nodeIds.size());
+
+			return topology;
+		}
+
+		const ProcessorTopology& GetTopology()
+		{
+			static ProcessorTopology topology = BuildTopology();
+			return topology;
+		}
+
 		ProcessorVendor s_vendorEnum = ProcessorVendor_Unknown;
 		bool s_capabilities[ProcessorCap_Max+1] = {false};
 		bool s_initialized = false;
@@ -100,6 +164,63 @@ namespace Nz
 		return HardwareInfoImpl::Cpuid(functionId, subFunctionId, result);
 	}
 
+	/*!
+	* \brief Gets the size of a level of data cache
+	* \return Size in bytes of one cache of this level, zero if unknown
+	*
+	* \param level Level of the cache, from 1 to 3
+	*
+	* \remark Caches may be shared by several cores, L3 usually being shared by a whole package
+	* \remark Doesn't need the initialization of HardwareInfo
+	*/
+
+	UInt64 HardwareInfo::GetCacheSize(UInt8 level)
+	{
+		NazaraAssert(level >= 1 && level <= 3, "Cache level out of range");
+
+		return GetTopology().cacheSizes[level - 1];
+	}
+
+	/*!
+	* \brief Gets the logical processors of the machine, indexed like the processors of the system (e.g. for affinities)
+	* \return Logical processors, describing the core, NUMA node and package they belong to
+	*
+	* \remark Identifiers are contiguous, starting from zero
+	* \remark If the system doesn't describe its topology, each logical processor is reported as a core of its own, in a single node
+	* \remark Doesn't need the initialization of HardwareInfo
+	*
+	* \see Thread::SetAffinity
+	*/
+
+	const std::vector<LogicalProcessor>& HardwareInfo::GetLogicalProcessors()
+	{
+		return GetTopology().processors;
+	}
+
+	/*!
+	* \brief Gets the number of NUMA nodes
+	* \return Number of nodes, one on machines with uniform memory access
+	*
+	* \remark Doesn't need the initialization of HardwareInfo
+	*/
+
+	unsigned int HardwareInfo::GetNumaNodeCount()
+	{
+		return GetTopology().nodeCount;
+	}
+
+	/*!
+	* \brief Gets the number of physical cores
+	* \return Number of cores, which is lower than the processor count when simultaneous multithreading is enabled
+	*
+	* \remark Doesn't need the initialization of HardwareInfo
+	*/
+
+	unsigned int HardwareInfo::GetPhysicalCoreCount()
+	{
+		return GetTopology().coreCount;
+	}
+
 	/*!
 	* \brief Gets the brand of the processor
 	* \return String of the brand
@@ -236,12 +357,19 @@ namespace Nz
 			}
 		}
 
-		if (eax >= 1)
+		// AVX registers can only be used if the OS saves them on context switches (XCR0 register, read with xgetbv if OSXSAVE is set)
+		UInt64 enabledStates = 0;
+
+		UInt32 maxSupportedFunction = eax;
+		if (maxSupportedFunction >= 1)
 		{
 			// Retrieval of certain capacities of the processor (ECX et EDX, function 1)
 			HardwareInfoImpl::Cpuid(1, 0, registers);
 
-			s_capabilities[ProcessorCap_AVX]   = (ecx & (1U << 28)) != 0;
+			if ((ecx & (1U << 27)) != 0)
+				enabledStates = HardwareInfoImpl::Xgetbv(0);
+
+			s_capabilities[ProcessorCap_AVX]   = (ecx & (1U << 28)) != 0 && (enabledStates & 0x06) == 0x06; // SSE and AVX states
 			s_capabilities[ProcessorCap_FMA3]  = (ecx & (1U << 12)) != 0;
 			s_capabilities[ProcessorCap_MMX]   = (edx & (1U << 23)) != 0;
 			s_capabilities[ProcessorCap_SSE]   = (edx & (1U << 25)) != 0;
@@ -252,6 +380,16 @@ namespace Nz
 			s_capabilities[ProcessorCap_SSE42] = (ecx & (1U << 20)) != 0;
 		}
 
+		if (maxSupportedFunction >= 7)
+		{
+			// Retrieval of the structured extended features (EBX, function 7)
+			HardwareInfoImpl::Cpuid(7, 0, registers);
+
+			s_capabilities[ProcessorCap_AVX2]   = (ebx & (1U <<  5)) != 0 && s_capabilities[ProcessorCap_AVX];
+			s_capabilities[ProcessorCap_AVX512] = (ebx & 0xC0030000) == 0xC0030000 && (enabledStates & 0xE6) == 0xE6; // F, DQ, BW and VL, with opmask and ZMM states
+			s_capabilities[ProcessorCap_SHA]    = (ebx & (1U << 29)) != 0;
+		}
+
 		// Retrieval of biggest extended function handled (EAX, function 0x80000000)
 		HardwareInfoImpl::Cpuid(0x80000000, 0, registers);
 
@@ -306,6 +444,66 @@ namespace Nz
 		return s_initialized;
 	}
 
+	/*!
+	* \brief Checks whether kernels compiled for an instruction set can run on the processor
+	* \return true If every instruction set required by the target is supported
+	*
+	* \param target Target to check
+	*
+	* \remark NEON is only supported if enabled at compile time, as ARM processors can't be queried from user space
+	* \remark Produces a NazaraError if the class could not be initialized on x86 processors
+	*
+	* \see SimdDispatcher
+	*/
+
+	bool HardwareInfo::IsSimdTargetSupported(SimdTarget target)
+	{
+		switch (target)
+		{
+			case SimdTarget_Scalar:
+				return true;
+
+			case SimdTarget_NEON:
+				#if defined(NAZARA_SIMD_NEON)
+				return true;
+				#else
+				return false;
+				#endif
+
+			case SimdTarget_SSE2:
+			case SimdTarget_SSE41:
+			case SimdTarget_AVX2:
+			case SimdTarget_AVX512:
+			{
+				#if defined(NAZARA_SIMD_SSE2)
+				if (!Initialize())
+				{
+					NazaraError("Failed to initialize HardwareInfo");
+					return false;
+				}
+
+				// Targets include the instruction sets of the previous ones
+				bool supported = s_capabilities[ProcessorCap_SSE2];
+				if (target >= SimdTarget_SSE41)
+					supported = supported && s_capabilities[ProcessorCap_SSSE3] && s_capabilities[ProcessorCap_SSE41];
+
+				if (target >= SimdTarget_AVX2)
+					supported = supported && s_capabilities[ProcessorCap_AVX2] && s_capabilities[ProcessorCap_FMA3];
+
+				if (target >= SimdTarget_AVX512)
+					supported = supported && s_capabilities[ProcessorCap_AVX512];
+
+				return supported;
+				#else
+				return false;
+				#endif
+			}
+		}
+
+		NazaraError("SIMD target out of enum (0x" + String::Number(target, 16) + ')');
+		return false;
+	}
+
 	/*!
 	* \brief Unitializes the class HardwareInfo
 	*/
@@ -39,7 +39,13 @@
 
 #include <Nazara/Core/Hash/SHA/Internal.hpp>
 #include <Nazara/Core/Endianness.hpp>
+#include <Nazara/Core/HardwareInfo.hpp>
 #include <cstring>
+
+#if defined(NAZARA_SIMD_SSE2)
+	#include <immintrin.h>
+#endif
+
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
@@ -130,6 +136,7 @@ namespace Nz
 	void SHA256_Internal_Init(SHA_CTX*, const UInt32*);
 	void SHA256_Internal_Last(SHA_CTX*);
 	void SHA256_Internal_Transform(SHA_CTX*, const UInt32*);
+	void SHA256_Internal_TransformSoftware(SHA_CTX*, const UInt32*);
 
 	/* SHA-384 and SHA-512: */
 	void SHA512_Internal_Init(SHA_CTX*, const UInt64*);
@@ -267,6 +274,146 @@ namespace Nz
 	};
 
 
+	/*** SHA EXTENSIONS (SHA-NI): *****************************************/
+	#if defined(NAZARA_SIMD_SSE2)
+	// The SHA extensions are not part of the x64 baseline, these transforms are compiled for them and only used if the processor supports them
+	#if defined(NAZARA_COMPILER_MSVC)
+		#define NAZARA_SHA_NI
+	#else
+		#define NAZARA_SHA_NI __attribute__((target("sha,sse4.1")))
+	#endif
+
+	namespace
+	{
+		template<int Function>
+		NAZARA_SHA_NI void SHA1_Internal_RoundsNI(unsigned int group, __m128i& abcd, __m128i& e0, __m128i& e1, __m128i* words)
+		{
+			// Four rounds, the message schedule being computed three groups in advance
+			const __m128i& current = words[group % 4];
+
+			if (group == 0)
+			{
+				e0 = _mm_add_epi32(e0, current);
+				e1 = abcd;
+				abcd = _mm_sha1rnds4_epu32(abcd, e0, Function);
+			}
+			else if (group % 2 == 1)
+			{
+				e1 = _mm_sha1nexte_epu32(e1, current);
+				e0 = abcd;
+				abcd = _mm_sha1rnds4_epu32(abcd, e1, Function);
+			}
+			else
+			{
+				e0 = _mm_sha1nexte_epu32(e0, current);
+				e1 = abcd;
+				abcd = _mm_sha1rnds4_epu32(abcd, e0, Function);
+			}
+
+			if (group >= 3 && group <= 18)
+				words[(group + 1) % 4] = _mm_sha1msg2_epu32(words[(group + 1) % 4], current);
+
+			if (group >= 1 && group <= 16)
+				words[(group + 3) % 4] = _mm_sha1msg1_epu32(words[(group + 3) % 4], current);
+
+			if (group >= 2 && group <= 17)
+				words[(group + 2) % 4] = _mm_xor_si128(words[(group + 2) % 4], current);
+		}
+
+		NAZARA_SHA_NI void SHA1_Internal_TransformNI(SHA_CTX* context, const UInt32* data)
+		{
+			// The words are loaded as big endian, the first one in the highest lane
+			const __m128i byteSwap = _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+
+			__m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(context->s1.state)), 0x1B);
+			__m128i e0 = _mm_set_epi32(static_cast<int>(context->s1.state[4]), 0, 0, 0);
+			__m128i e1;
+
+			__m128i abcdSave = abcd;
+			__m128i e0Save = e0;
+
+			__m128i words[4];
+			for (unsigned int i = 0; i < 4; ++i)
+				words[i] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data) + i), byteSwap);
+
+			// Twenty groups of four rounds, each logical function (the immediate operand) being used by five of them
+			for (unsigned int i = 0; i < 5; ++i)
+				SHA1_Internal_RoundsNI<0>(i, abcd, e0, e1, words);
+
+			for (unsigned int i = 5; i < 10; ++i)
+				SHA1_Internal_RoundsNI<1>(i, abcd, e0, e1, words);
+
+			for (unsigned int i = 10; i < 15; ++i)
+				SHA1_Internal_RoundsNI<2>(i, abcd, e0, e1, words);
+
+			for (unsigned int i = 15; i < 20; ++i)
+				SHA1_Internal_RoundsNI<3>(i, abcd, e0, e1, words);
+
+			e0 = _mm_sha1nexte_epu32(e0, e0Save);
+			abcd = _mm_add_epi32(abcd, abcdSave);
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(context->s1.state), _mm_shuffle_epi32(abcd, 0x1B));
+			context->s1.state[4] = static_cast<UInt32>(_mm_extract_epi32(e0, 3));
+		}
+
+		NAZARA_SHA_NI void SHA256_Internal_TransformNI(SHA_CTX* context, const UInt32* data)
+		{
+			// Each word is loaded as big endian
+			const __m128i byteSwap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+			// The state is rearranged as ABEF and CDGH for the round instructions
+			__m128i tmp = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&context->s256.state[0])), 0xB1);
+			__m128i state1 = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&context->s256.state[4])), 0x1B);
+			__m128i state0 = _mm_alignr_epi8(tmp, state1, 8);
+			state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+
+			__m128i abefSave = state0;
+			__m128i cdghSave = state1;
+
+			__m128i words[4];
+			for (unsigned int i = 0; i < 4; ++i)
+				words[i] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data) + i), byteSwap);
+
+			// Sixteen groups of four rounds, the message schedule being computed three groups in advance
+			for (unsigned int i = 0; i < 16; ++i)
+			{
+				const __m128i& current = words[i % 4];
+
+				__m128i message = _mm_add_epi32(current, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&K256[i * 4])));
+				state1 = _mm_sha256rnds2_epu32(state1, state0, message);
+				state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(message, 0x0E));
+
+				if (i >= 3 && i <= 14)
+				{
+					__m128i& next = words[(i + 1) % 4];
+					next = _mm_sha256msg2_epu32(_mm_add_epi32(next, _mm_alignr_epi8(current, words[(i + 3) % 4], 4)), current);
+				}
+
+				if (i >= 1 && i <= 12)
+					words[(i + 3) % 4] = _mm_sha256msg1_epu32(words[(i + 3) % 4], current);
+			}
+
+			state0 = _mm_add_epi32(state0, abefSave);
+			state1 = _mm_add_epi32(state1, cdghSave);
+
+			tmp = _mm_shuffle_epi32(state0, 0x1B);
+			state1 = _mm_shuffle_epi32(state1, 0xB1);
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&context->s256.state[0]), _mm_blend_epi16(tmp, state1, 0xF0));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&context->s256.state[4]), _mm_alignr_epi8(state1, tmp, 8));
+		}
+
+		bool HasSHAExtensions()
+		{
+			static bool supported = HardwareInfo::Initialize() && HardwareInfo::HasCapability(ProcessorCap_SHA) && HardwareInfo::HasCapability(ProcessorCap_SSE41);
+			return supported;
+		}
+	}
+
+	#undef NAZARA_SHA_NI
+	#endif // NAZARA_SIMD_SSE2
+
+
 	/*** SHA-1: ***********************************************************/
 	void SHA1_Init(SHA_CTX* context)
 	{
@@ -321,7 +468,7 @@ namespace Nz
 
 	namespace
 	{
-		void SHA1_Internal_Transform(SHA_CTX* context, const UInt32* data)
+		void SHA1_Internal_TransformSoftware(SHA_CTX* context, const UInt32* data)
 		{
 			UInt32 a, b, c, d, e;
 			UInt32 T1, *W1;
@@ -435,6 +582,19 @@ namespace Nz
 			context->s1.state[3] += d;
 			context->s1.state[4] += e;
 		}
+
+		void SHA1_Internal_Transform(SHA_CTX* context, const UInt32* data)
+		{
+			#if defined(NAZARA_SIMD_SSE2)
+			if (HasSHAExtensions())
+			{
+				SHA1_Internal_TransformNI(context, data);
+				return;
+			}
+			#endif
+
+			SHA1_Internal_TransformSoftware(context, data);
+		}
 	}
 
 	void SHA1_Update(SHA_CTX* context, const UInt8* data, std::size_t len)
@@ -589,7 +749,7 @@ namespace Nz
 		(h) = T1 + Sigma0_256(a) + Maj((a), (b), (c)); \
 		j++
 
-	void SHA256_Internal_Transform(SHA_CTX* context, const UInt32* data)
+	void SHA256_Internal_TransformSoftware(SHA_CTX* context, const UInt32* data)
 	{
 		UInt32 a, b, c, d, e, f, g, h;
 		UInt32 T1, *W256;
@@ -649,6 +809,19 @@ namespace Nz
 		context->s256.state[7] += h;
 	}
 
+	void SHA256_Internal_Transform(SHA_CTX* context, const UInt32* data)
+	{
+		#if defined(NAZARA_SIMD_SSE2)
+		if (HasSHAExtensions())
+		{
+			SHA256_Internal_TransformNI(context, data);
+			return;
+		}
+		#endif
+
+		SHA256_Internal_TransformSoftware(context, data);
+	}
+
 	void SHA256_Update(SHA_CTX* context, const UInt8 *data, std::size_t len)
 	{
 		if (len == 0)
@@ -0,0 +1,441 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Hash/XXH3.hpp>
+#include <Nazara/Core/Endianness.hpp>
+#include <algorithm>
+#include <cstring>
+
+#if defined(NAZARA_SIMD_SSE2)
+	#include <emmintrin.h>
+#endif
+
+#if defined(NAZARA_COMPILER_MSVC) && defined(NAZARA_PLATFORM_x64)
+	#include <intrin.h>
+#endif
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		// xxHash3 (64 bits, default secret and seed), by Yann Collet
+		// https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+		constexpr UInt32 Prime32_1 = 0x9E3779B1U;
+		constexpr UInt32 Prime32_2 = 0x85EBCA77U;
+		constexpr UInt32 Prime32_3 = 0xC2B2AE3DU;
+		constexpr UInt64 Prime64_1 = 0x9E3779B185EBCA87ULL;
+		constexpr UInt64 Prime64_2 = 0xC2B2AE3D27D4EB4FULL;
+		constexpr UInt64 Prime64_3 = 0x165667B19E3779F9ULL;
+		constexpr UInt64 Prime64_4 = 0x85EBCA77C2B2AE63ULL;
+		constexpr UInt64 Prime64_5 = 0x27D4EB2F165667C5ULL;
+		constexpr UInt64 PrimeMx1 = 0x165667919E3779F9ULL;
+		constexpr UInt64 PrimeMx2 = 0x9FB21C651E98DF25ULL;
+
+		constexpr std::size_t MidSizeMax = 240;
+		constexpr std::size_t SecretConsumeRate = 8;
+		constexpr std::size_t SecretSize = 192;
+		constexpr std::size_t SecretSizeMin = 136;
+		constexpr std::size_t StripeLength = 64;
+		constexpr std::size_t SecretLimit = SecretSize - StripeLength;
+		constexpr std::size_t StripesPerBlock = SecretLimit / SecretConsumeRate;
+
+		alignas(64) const UInt8 s_secret[SecretSize] = {
+			0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+			0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+			0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+			0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+			0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+			0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+			0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+			0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+			0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+			0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+			0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+			0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e
+		};
+
+		inline UInt32 Read32(const UInt8* data)
+		{
+			UInt32 value;
+			std::memcpy(&value, data, sizeof(UInt32));
+
+			#ifdef NAZARA_BIG_ENDIAN
+			SwapBytes(&value, sizeof(UInt32));
+			#endif
+
+			return value;
+		}
+
+		inline UInt64 Read64(const UInt8* data)
+		{
+			UInt64 value;
+			std::memcpy(&value, data, sizeof(UInt64));
+
+			#ifdef NAZARA_BIG_ENDIAN
+			SwapBytes(&value, sizeof(UInt64));
+			#endif
+
+			return value;
+		}
+
+		inline UInt64 RotateLeft(UInt64 value, unsigned int shift)
+		{
+			return (value << shift) | (value >> (64 - shift));
+		}
+
+		inline UInt64 Swap64(UInt64 value)
+		{
+			SwapBytes(&value, sizeof(UInt64));
+			return value;
+		}
+
+		inline UInt64 MultiplyFold(UInt64 lhs, UInt64 rhs)
+		{
+			// Low and high parts of the 128 bits product, xored together
+			#if defined(__SIZEOF_INT128__)
+			unsigned __int128 product = static_cast<unsigned __int128>(lhs) * rhs;
+			return static_cast<UInt64>(product) ^ static_cast<UInt64>(product >> 64);
+			#elif defined(NAZARA_COMPILER_MSVC) && defined(NAZARA_PLATFORM_x64)
+			UInt64 high;
+			UInt64 low = _umul128(lhs, rhs, &high);
+			return low ^ high;
+			#else
+			UInt64 loLo = (lhs & 0xFFFFFFFF) * (rhs & 0xFFFFFFFF);
+			UInt64 hiLo = (lhs >> 32) * (rhs & 0xFFFFFFFF);
+			UInt64 loHi = (lhs & 0xFFFFFFFF) * (rhs >> 32);
+			UInt64 hiHi = (lhs >> 32) * (rhs >> 32);
+
+			UInt64 cross = (loLo >> 32) + (hiLo & 0xFFFFFFFF) + loHi;
+			UInt64 high = (hiLo >> 32) + (cross >> 32) + hiHi;
+			UInt64 low = (cross << 32) | (loLo & 0xFFFFFFFF);
+			return low ^ high;
+			#endif
+		}
+
+		inline UInt64 Avalanche(UInt64 hash)
+		{
+			hash ^= hash >> 37;
+			hash *= PrimeMx1;
+			hash ^= hash >> 32;
+
+			return hash;
+		}
+
+		inline UInt64 AvalancheXXH64(UInt64 hash)
+		{
+			hash ^= hash >> 33;
+			hash *= Prime64_2;
+			hash ^= hash >> 29;
+			hash *= Prime64_3;
+			hash ^= hash >> 32;
+
+			return hash;
+		}
+
+		inline UInt64 Mix16(const UInt8* input, const UInt8* secret)
+		{
+			return MultiplyFold(Read64(input) ^ Read64(secret), Read64(input + 8) ^ Read64(secret + 8));
+		}
+
+		UInt64 HashShort(const UInt8* input, std::size_t len)
+		{
+			const UInt8* secret = s_secret;
+
+			if (len == 0)
+				return AvalancheXXH64(Read64(secret + 56) ^ Read64(secret + 64));
+
+			if (len <= 3)
+			{
+				UInt32 combined = (UInt32(input[0]) << 16) | (UInt32(input[len >> 1]) << 24) | UInt32(input[len - 1]) | (UInt32(len) << 8);
+				UInt64 bitflip = Read32(secret) ^ Read32(secret + 4);
+
+				return AvalancheXXH64(combined ^ bitflip);
+			}
+
+			if (len <= 8)
+			{
+				UInt64 bitflip = Read64(secret + 8) ^ Read64(secret + 16);
+				UInt64 value = (Read32(input + len - 4) + (UInt64(Read32(input)) << 32)) ^ bitflip;
+
+				value ^= RotateLeft(value, 49) ^ RotateLeft(value, 24);
+				value *= PrimeMx2;
+				value ^= (value >> 35) + len;
+				value *= PrimeMx2;
+
+				return value ^ (value >> 28);
+			}
+
+			if (len <= 16)
+			{
+				UInt64 low = Read64(input) ^ (Read64(secret + 24) ^ Read64(secret + 32));
+				UInt64 high = Read64(input + len - 8) ^ (Read64(secret + 40) ^ Read64(secret + 48));
+
+				return Avalanche(len + Swap64(low) + high + MultiplyFold(low, high));
+			}
+
+			UInt64 acc = len * Prime64_1;
+			if (len <= 128)
+			{
+				// Pairs of 16 bytes are taken from both ends of the input
+				if (len > 32)
+				{
+					if (len > 64)
+					{
+						if (len > 96)
+						{
+							acc += Mix16(input + 48, secret + 96);
+							acc += Mix16(input + len - 64, secret + 112);
+						}
+
+						acc += Mix16(input + 32, secret + 64);
+						acc += Mix16(input + len - 48, secret + 80);
+					}
+
+					acc += Mix16(input + 16, secret + 32);
+					acc += Mix16(input + len - 32, secret + 48);
+				}
+
+				acc += Mix16(input, secret);
+				acc += Mix16(input + len - 16, secret + 16);
+
+				return Avalanche(acc);
+			}
+
+			NazaraAssert(len <= MidSizeMax, "Input is too long");
+
+			unsigned int roundCount = static_cast<unsigned int>(len / 16);
+			for (unsigned int i = 0; i < 8; ++i)
+				acc += Mix16(input + 16 * i, secret + 16 * i);
+
+			acc = Avalanche(acc);
+
+			UInt64 accEnd = Mix16(input + len - 16, secret + SecretSizeMin - 17);
+			for (unsigned int i = 8; i < roundCount; ++i)
+				accEnd += Mix16(input + 16 * i, secret + 16 * (i - 8) + 3);
+
+			return Avalanche(acc + accEnd);
+		}
+
+		#if defined(NAZARA_SIMD_SSE2)
+		inline void Accumulate512(UInt64* accumulators, const UInt8* input, const UInt8* secret)
+		{
+			__m128i* acc = reinterpret_cast<__m128i*>(accumulators);
+
+			for (unsigned int i = 0; i < StripeLength / sizeof(__m128i); ++i)
+			{
+				__m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input) + i);
+				__m128i dataKey = _mm_xor_si128(data, _mm_loadu_si128(reinterpret_cast<const __m128i*>(secret) + i));
+
+				// Low 32 bits of each lane multiplied by its high 32 bits, adjacent lanes of the input being added to each other
+				__m128i product = _mm_mul_epu32(dataKey, _mm_shuffle_epi32(dataKey, _MM_SHUFFLE(0, 3, 0, 1)));
+				__m128i sum = _mm_add_epi64(acc[i], _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2)));
+				acc[i] = _mm_add_epi64(product, sum);
+			}
+		}
+
+		inline void Scramble(UInt64* accumulators, const UInt8* secret)
+		{
+			__m128i* acc = reinterpret_cast<__m128i*>(accumulators);
+			const __m128i prime = _mm_set1_epi32(static_cast<int>(Prime32_1));
+
+			for (unsigned int i = 0; i < StripeLength / sizeof(__m128i); ++i)
+			{
+				__m128i value = _mm_xor_si128(acc[i], _mm_srli_epi64(acc[i], 47));
+				__m128i dataKey = _mm_xor_si128(value, _mm_loadu_si128(reinterpret_cast<const __m128i*>(secret) + i));
+
+				// 64 bits multiplication by a 32 bits prime, from two 32x32 bits products
+				__m128i productLow = _mm_mul_epu32(dataKey, prime);
+				__m128i productHigh = _mm_mul_epu32(_mm_shuffle_epi32(dataKey, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+				acc[i] = _mm_add_epi64(productLow, _mm_slli_epi64(productHigh, 32));
+			}
+		}
+		#else
+		inline void Accumulate512(UInt64* accumulators, const UInt8* input, const UInt8* secret)
+		{
+			for (unsigned int i = 0; i < 8; ++i)
+			{
+				UInt64 data = Read64(input + 8 * i);
+				UInt64 dataKey = data ^ Read64(secret + 8 * i);
+
+				accumulators[i ^ 1] += data;
+				accumulators[i] += (dataKey & 0xFFFFFFFF) * (dataKey >> 32);
+			}
+		}
+
+		inline void Scramble(UInt64* accumulators, const UInt8* secret)
+		{
+			for (unsigned int i = 0; i < 8; ++i)
+			{
+				UInt64 value = accumulators[i];
+				value ^= value >> 47;
+				value ^= Read64(secret + 8 * i);
+				value *= Prime32_1;
+
+				accumulators[i] = value;
+			}
+		}
+		#endif
+
+		const UInt8* ConsumeStripes(UInt64* accumulators, std::size_t* stripesSoFar, const UInt8* input, std::size_t stripeCount)
+		{
+			// Each stripe uses the secret from a different offset, the accumulators being scrambled at the end of each block
+			const UInt8* secret = s_secret + *stripesSoFar * SecretConsumeRate;
+
+			while (stripeCount > 0)
+			{
+				std::size_t blockStripes = std::min(stripeCount, StripesPerBlock - *stripesSoFar);
+				for (std::size_t i = 0; i < blockStripes; ++i)
+					Accumulate512(accumulators, input + i * StripeLength, secret + i * SecretConsumeRate);
+
+				input += blockStripes * StripeLength;
+				stripeCount -= blockStripes;
+				*stripesSoFar += blockStripes;
+
+				if (*stripesSoFar == StripesPerBlock)
+				{
+					Scramble(accumulators, s_secret + SecretLimit);
+					*stripesSoFar = 0;
+				}
+
+				secret = s_secret + *stripesSoFar * SecretConsumeRate;
+			}
+
+			return input;
+		}
+
+		UInt64 MergeAccumulators(const UInt64* accumulators, UInt64 start)
+		{
+			const UInt8* secret = s_secret + 11;
+
+			UInt64 result = start;
+			for (unsigned int i = 0; i < 4; ++i)
+				result += MultiplyFold(accumulators[2 * i] ^ Read64(secret + 16 * i), accumulators[2 * i + 1] ^ Read64(secret + 16 * i + 8));
+
+			return Avalanche(result);
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::HashXXH3
+	* \brief Core class computing the 64 bits xxHash3, a fast non-cryptographic hash
+	*
+	* Much faster than the cryptographic hashes (and the CRC tables), it is suitable for checksums and hash tables but not for security purposes
+	*/
+
+	HashXXH3::HashXXH3()
+	{
+		Begin();
+	}
+
+	HashXXH3::~HashXXH3() = default;
+
+	void HashXXH3::Append(const UInt8* data, std::size_t len)
+	{
+		const UInt8* end = data + len;
+		m_totalLength += len;
+
+		// Inputs are buffered until they're longer than the buffer, short inputs are hashed differently
+		if (len <= BufferSize - m_bufferedSize)
+		{
+			std::memcpy(&m_buffer[m_bufferedSize], data, len);
+			m_bufferedSize += len;
+			return;
+		}
+
+		if (m_bufferedSize > 0)
+		{
+			std::size_t loadSize = BufferSize - m_bufferedSize;
+			std::memcpy(&m_buffer[m_bufferedSize], data, loadSize);
+			data += loadSize;
+
+			ConsumeStripes(m_accumulators, &m_stripeCount, m_buffer, BufferSize / StripeLength);
+			m_bufferedSize = 0;
+		}
+
+		// The last stripe is always kept in the buffer, it is processed differently by End
+		if (static_cast<std::size_t>(end - data) > BufferSize)
+		{
+			std::size_t stripeCount = static_cast<std::size_t>(end - 1 - data) / StripeLength;
+			data = ConsumeStripes(m_accumulators, &m_stripeCount, data, stripeCount);
+
+			// The previous stripe may be needed if less than a stripe remains
+			std::memcpy(&m_buffer[BufferSize - StripeLength], data - StripeLength, StripeLength);
+		}
+
+		m_bufferedSize = static_cast<std::size_t>(end - data);
+		std::memcpy(m_buffer, data, m_bufferedSize);
+	}
+
+	void HashXXH3::Begin()
+	{
+		m_accumulators[0] = Prime32_3;
+		m_accumulators[1] = Prime64_1;
+		m_accumulators[2] = Prime64_2;
+		m_accumulators[3] = Prime64_3;
+		m_accumulators[4] = Prime64_4;
+		m_accumulators[5] = Prime32_2;
+		m_accumulators[6] = Prime64_5;
+		m_accumulators[7] = Prime32_1;
+
+		m_bufferedSize = 0;
+		m_stripeCount = 0;
+		m_totalLength = 0;
+	}
+
+	ByteArray HashXXH3::End()
+	{
+		UInt64 hash;
+		if (m_totalLength > MidSizeMax)
+		{
+			alignas(16) UInt64 accumulators[8];
+			std::memcpy(accumulators, m_accumulators, sizeof(accumulators));
+
+			const UInt8* lastStripe;
+			UInt8 lastStripeBuffer[StripeLength];
+			if (m_bufferedSize >= StripeLength)
+			{
+				std::size_t stripesSoFar = m_stripeCount;
+				ConsumeStripes(accumulators, &stripesSoFar, m_buffer, (m_bufferedSize - 1) / StripeLength);
+
+				lastStripe = &m_buffer[m_bufferedSize - StripeLength];
+			}
+			else
+			{
+				// The last stripe begins with the end of the previous one
+				std::size_t catchupSize = StripeLength - m_bufferedSize;
+				std::memcpy(lastStripeBuffer, &m_buffer[BufferSize - catchupSize], catchupSize);
+				std::memcpy(&lastStripeBuffer[catchupSize], m_buffer, m_bufferedSize);
+
+				lastStripe = lastStripeBuffer;
+			}
+
+			Accumulate512(accumulators, lastStripe, s_secret + SecretLimit - 7);
+
+			hash = MergeAccumulators(accumulators, m_totalLength * Prime64_1);
+		}
+		else
+			hash = HashShort(m_buffer, static_cast<std::size_t>(m_totalLength));
+
+		#ifdef NAZARA_LITTLE_ENDIAN
+		SwapBytes(&hash, sizeof(UInt64));
+		#endif
+
+		return ByteArray(reinterpret_cast<UInt8*>(&hash), 8);
+	}
+
+	std::size_t HashXXH3::GetDigestLength() const
+	{
+		return 8;
+	}
+
+	const char* HashXXH3::GetHashName() const
+	{
+		return "XXH3";
+	}
+
+	constexpr std::size_t HashXXH3::BufferSize;
+}
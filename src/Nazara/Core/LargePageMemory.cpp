@@ -0,0 +1,115 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/LargePageMemory.hpp>
+#include <Nazara/Core/MemoryHelper.hpp>
+#include <limits>
+#include <new>
+
+#if defined(NAZARA_PLATFORM_WINDOWS)
+	#include <Nazara/Core/Win32/LargePageMemoryImpl.hpp>
+#elif defined(NAZARA_PLATFORM_POSIX)
+	#include <Nazara/Core/Posix/LargePageMemoryImpl.hpp>
+#else
+	#error OS not handled
+#endif
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::LargePageMemory
+	* \brief Core class that allocates big long-lived memory blocks backed by large pages (also called huge pages)
+	*
+	* Large pages (usually 2 MiB instead of 4 KiB) let one TLB entry cover much more memory, which reduces the TLB misses of code going through big arrays.
+	* On Linux, explicit huge pages (MAP_HUGETLB) are tried first, then an aligned mapping advised to use transparent huge pages (MADV_HUGEPAGE).
+	* On Windows, MEM_LARGE_PAGES is tried (requiring the "Lock pages in memory" privilege) before a regular VirtualAlloc.
+	*
+	* Sizes are rounded up to a multiple of the large page size, smaller allocations than GetMinimumSize() aren't worth it and come from OperatorNew.
+	*
+	* \remark Memory is never moved to regular pages, failing to get large pages only falls back to regular pages
+	*/
+
+	/*!
+	* \brief Allocates memory, backed by large pages when possible
+	* \return Pointer to the memory, aligned on the large page size when backed by them
+	*
+	* \param size Size to allocate
+	* \param largePages Optional pointer receiving whether large pages were obtained (or, for transparent huge pages, successfully requested)
+	*
+	* \remark Throws a std::bad_alloc if no memory could be allocated
+	*/
+
+	void* LargePageMemory::Allocate(std::size_t size, bool* largePages)
+	{
+		if (largePages)
+			*largePages = false;
+
+		if (size == 0 || size < GetMinimumSize())
+			return OperatorNew(size);
+
+		std::size_t pageSize = GetLargePageSize();
+		std::size_t roundedSize = (size + pageSize - 1) / pageSize * pageSize;
+
+		bool gotLargePages;
+		void* ptr = LargePageMemoryImpl::Allocate(roundedSize, &gotLargePages);
+		if (!ptr)
+			throw std::bad_alloc();
+
+		if (largePages)
+			*largePages = gotLargePages;
+
+		return ptr;
+	}
+
+	/*!
+	* \brief Releases memory previously returned by Allocate
+	*
+	* \param ptr Pointer to the memory
+	* \param size Size given to Allocate, zero for memory allocated with OperatorNew
+	*
+	* \remark If ptr is null, nothing is done
+	*/
+
+	void LargePageMemory::Free(void* ptr, std::size_t size)
+	{
+		if (!ptr)
+			return;
+
+		if (size == 0 || size < GetMinimumSize())
+		{
+			OperatorDelete(ptr);
+			return;
+		}
+
+		std::size_t pageSize = GetLargePageSize();
+		LargePageMemoryImpl::Free(ptr, (size + pageSize - 1) / pageSize * pageSize);
+	}
+
+	/*!
+	* \brief Gets the size of a large page on this system
+	* \return Large page size in bytes, or zero if the system doesn't support them
+	*/
+
+	std::size_t LargePageMemory::GetLargePageSize()
+	{
+		static std::size_t largePageSize = LargePageMemoryImpl::GetLargePageSize();
+		return largePageSize;
+	}
+
+	/*!
+	* \brief Gets the size from which an allocation is backed by large pages
+	* \return Minimum size in bytes (half a large page, as allocations are rounded up to whole pages)
+	*
+	* \remark Without large page support, no size is big enough and every allocation comes from OperatorNew
+	*/
+
+	std::size_t LargePageMemory::GetMinimumSize()
+	{
+		std::size_t pageSize = GetLargePageSize();
+		return (pageSize > 0) ? pageSize / 2 : std::numeric_limits<std::size_t>::max();
+	}
+}
@@ -55,7 +55,9 @@ namespace Nz
 	/*!
 	* \brief Sets the logger
 	*
-	* \param logger AbstractLogger to log
+	* \param logger AbstractLogger to log, which gets owned by the log
+	*
+	* \remark An AsyncLogger wrapping the logger keeps file writes away from the threads logging
 	*/
 
 	void Log::SetLogger(AbstractLogger* logger)
@@ -0,0 +1,312 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Lz4.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <algorithm>
+#include <cstring>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		// LZ4 block format constants
+		constexpr std::size_t LastLiterals = 5;  //< The last five bytes are always literals
+		constexpr std::size_t MatchLimit = 12;   //< The last match must start at least twelve bytes before the end
+		constexpr std::size_t MaxOffset = 65535;
+		constexpr std::size_t MinMatch = 4;
+
+		UInt32 Read32(const UInt8* ptr)
+		{
+			UInt32 value;
+			std::memcpy(&value, ptr, sizeof(UInt32));
+
+			return value;
+		}
+
+		UInt32 Hash(UInt32 sequence)
+		{
+			return (sequence * 2654435761U) >> (32 - Lz4::HashLog);
+		}
+
+		bool WriteLength(UInt8*& output, const UInt8* outputEnd, std::size_t length)
+		{
+			// Lengths over 15 are continued by bytes until one is lower than 255
+			for (; length >= 255; length -= 255)
+			{
+				if (output >= outputEnd)
+					return false;
+
+				*output++ = 255;
+			}
+
+			if (output >= outputEnd)
+				return false;
+
+			*output++ = static_cast<UInt8>(length);
+			return true;
+		}
+
+		bool ReadLength(const UInt8*& input, const UInt8* inputEnd, std::size_t* length)
+		{
+			UInt8 byte;
+			do
+			{
+				if (input >= inputEnd)
+					return false;
+
+				byte = *input++;
+				*length += byte;
+			}
+			while (byte == 255);
+
+			return true;
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::Lz4
+	* \brief Core class compressing data using the LZ4 block format
+	*
+	* LZ4 favors speed over compression ratio, decompression especially is very fast.
+	* Compressed blocks don't store the size of the original data, it has to be known when decompressing.
+	*/
+
+	/*!
+	* \brief Compresses data
+	* \return Size of the compressed data or 0 if it doesn't fit in output
+	*
+	* \param input Data to compress
+	* \param inputSize Size of the data
+	* \param output Buffer receiving compressed data
+	* \param maxOutputSize Size of output, GetMaxCompressedSize(inputSize) is always enough
+	*/
+	std::size_t Lz4::Compress(const void* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		HashTable hashTable;
+		hashTable.fill(0);
+
+		return Compress(static_cast<const UInt8*>(input), 0, inputSize, hashTable, output, maxOutputSize);
+	}
+
+	/*!
+	* \brief Compresses data following a prefix matches can refer to
+	* \return Size of the compressed data or 0 if it doesn't fit in output
+	*
+	* \param buffer Prefix immediately followed by data to compress
+	* \param prefixSize Size of the prefix, is usually a dictionary
+	* \param size Size of the data to compress, following the prefix
+	* \param hashTable Hash table which must be filled with IndexPrefix (or by zeros without prefix), used as working memory
+	* \param output Buffer receiving compressed data
+	* \param maxOutputSize Size of output
+	*
+	* \remark Compressed data needs the same prefix, as dictionary, to be decompressed
+	*/
+	std::size_t Lz4::Compress(const UInt8* buffer, std::size_t prefixSize, std::size_t size, HashTable& hashTable, UInt8* output, std::size_t maxOutputSize)
+	{
+		NazaraAssert(buffer || prefixSize + size == 0, "Invalid buffer");
+		NazaraAssert(output || maxOutputSize == 0, "Invalid output");
+
+		std::size_t end = prefixSize + size;
+		std::size_t matchEnd = (end > LastLiterals) ? end - LastLiterals : 0;
+
+		UInt8* out = output;
+		UInt8* outEnd = output + maxOutputSize;
+
+		auto WriteSequence = [&](std::size_t literalStart, std::size_t literalLength, std::size_t offset, std::size_t matchLength) -> bool
+		{
+			if (out >= outEnd)
+				return false;
+
+			UInt8* token = out++;
+			*token = static_cast<UInt8>(std::min<std::size_t>(literalLength, 15) << 4);
+
+			if (literalLength >= 15 && !WriteLength(out, outEnd, literalLength - 15))
+				return false;
+
+			if (static_cast<std::size_t>(outEnd - out) < literalLength)
+				return false;
+
+			if (literalLength > 0)
+				std::memcpy(out, &buffer[literalStart], literalLength);
+
+			out += literalLength;
+
+			// The last sequence only holds literals
+			if (matchLength == 0)
+				return true;
+
+			if (outEnd - out < 2)
+				return false;
+
+			*out++ = static_cast<UInt8>(offset & 0xFF);
+			*out++ = static_cast<UInt8>(offset >> 8);
+
+			matchLength -= MinMatch;
+			*token |= static_cast<UInt8>(std::min<std::size_t>(matchLength, 15));
+
+			if (matchLength >= 15 && !WriteLength(out, outEnd, matchLength - 15))
+				return false;
+
+			return true;
+		};
+
+		// Positions are stored plus one, zero meaning no entry
+		std::size_t anchor = prefixSize;
+		std::size_t pos = prefixSize;
+		while (pos + MatchLimit <= end)
+		{
+			UInt32 sequence = Read32(&buffer[pos]);
+			UInt32& entry = hashTable[Hash(sequence)];
+
+			std::size_t candidate = entry;
+			entry = static_cast<UInt32>(pos + 1);
+
+			if (candidate == 0 || pos - (candidate - 1) > MaxOffset || Read32(&buffer[candidate - 1]) != sequence)
+			{
+				pos++;
+				continue;
+			}
+
+			std::size_t match = candidate - 1;
+
+			// Extend the match backward over pending literals, then forward
+			while (pos > anchor && match > 0 && buffer[pos - 1] == buffer[match - 1])
+			{
+				pos--;
+				match--;
+			}
+
+			std::size_t length = MinMatch;
+			while (pos + length < matchEnd && buffer[match + length] == buffer[pos + length])
+				length++;
+
+			if (!WriteSequence(anchor, pos - anchor, pos - match, length))
+				return 0;
+
+			pos += length;
+			anchor = pos;
+
+			// Help the next matches by indexing the end of this one
+			if (pos + MatchLimit <= end)
+				hashTable[Hash(Read32(&buffer[pos - 2]))] = static_cast<UInt32>(pos - 2 + 1);
+		}
+
+		if (!WriteSequence(anchor, end - anchor, 0, 0))
+			return 0;
+
+		return out - output;
+	}
+
+	/*!
+	* \brief Decompresses data
+	* \return Size of the decompressed data or 0 if data is corrupted or doesn't fit in output
+	*
+	* \param input Compressed data
+	* \param inputSize Size of the compressed data
+	* \param output Buffer receiving decompressed data
+	* \param maxOutputSize Size of output
+	* \param dictionary Prefix data was compressed with, if any
+	* \param dictionarySize Size of the dictionary
+	*/
+	std::size_t Lz4::Decompress(const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize, const UInt8* dictionary, std::size_t dictionarySize)
+	{
+		NazaraAssert(input || inputSize == 0, "Invalid input");
+		NazaraAssert(dictionary || dictionarySize == 0, "Invalid dictionary");
+
+		const UInt8* in = input;
+		const UInt8* inEnd = input + inputSize;
+		UInt8* out = output;
+		UInt8* outEnd = output + maxOutputSize;
+
+		while (in < inEnd)
+		{
+			UInt8 token = *in++;
+
+			std::size_t literalLength = token >> 4;
+			if (literalLength == 15 && !ReadLength(in, inEnd, &literalLength))
+				return 0;
+
+			if (static_cast<std::size_t>(inEnd - in) < literalLength || static_cast<std::size_t>(outEnd - out) < literalLength)
+				return 0;
+
+			if (literalLength > 0)
+				std::memcpy(out, in, literalLength);
+
+			in += literalLength;
+			out += literalLength;
+
+			// The last sequence has no match
+			if (in == inEnd)
+				break;
+
+			if (inEnd - in < 2)
+				return 0;
+
+			std::size_t offset = in[0] | (in[1] << 8);
+			in += 2;
+
+			std::size_t matchLength = token & 0xF;
+			if (matchLength == 15 && !ReadLength(in, inEnd, &matchLength))
+				return 0;
+
+			matchLength += MinMatch;
+
+			std::size_t produced = out - output;
+			if (offset == 0 || offset > produced + dictionarySize || static_cast<std::size_t>(outEnd - out) < matchLength)
+				return 0;
+
+			// Copy the part of the match lying in the dictionary first
+			if (offset > produced)
+			{
+				std::size_t dictionaryOffset = offset - produced;
+				std::size_t dictionaryLength = std::min(dictionaryOffset, matchLength);
+
+				std::memcpy(out, dictionary + dictionarySize - dictionaryOffset, dictionaryLength);
+				out += dictionaryLength;
+				matchLength -= dictionaryLength;
+			}
+
+			// Matches may overlap their own output, copy byte by byte
+			const UInt8* match = out - offset;
+			for (std::size_t i = 0; i < matchLength; ++i)
+				out[i] = match[i];
+
+			out += matchLength;
+		}
+
+		return out - output;
+	}
+
+	/*!
+	* \brief Gets the size of the largest compressed data for a size
+	* \return Size of the compressed data when nothing can be compressed
+	*
+	* \param inputSize Size of the data to compress
+	*/
+	std::size_t Lz4::GetMaxCompressedSize(std::size_t inputSize)
+	{
+		return inputSize + inputSize / 255 + 16;
+	}
+
+	/*!
+	* \brief Fills a hash table with the positions of a prefix
+	*
+	* \param prefix Data matches will be able to refer to, only its last MaxDictionarySize bytes are reachable
+	* \param prefixSize Size of the prefix
+	* \param hashTable Hash table to fill
+	*
+	* \see Compress
+	*/
+	void Lz4::IndexPrefix(const UInt8* prefix, std::size_t prefixSize, HashTable& hashTable)
+	{
+		NazaraAssert(prefix || prefixSize == 0, "Invalid prefix");
+
+		hashTable.fill(0);
+		for (std::size_t i = 0; i + MinMatch <= prefixSize; ++i)
+			hashTable[Hash(Read32(&prefix[i]))] = static_cast<UInt32>(i + 1);
+	}
+}
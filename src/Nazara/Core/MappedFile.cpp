@@ -0,0 +1,211 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/MappedFile.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/File.hpp>
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+#if defined(NAZARA_PLATFORM_WINDOWS)
+	#include <Nazara/Core/Win32/MappedFileImpl.hpp>
+#elif defined(NAZARA_PLATFORM_POSIX)
+	#include <Nazara/Core/Posix/MappedFileImpl.hpp>
+#else
+	#error OS not handled
+#endif
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::MappedFile
+	* \brief Core class that represents a read-only file mapped in memory
+	*
+	* The content of the file is accessible directly (see GetData and GetView) without being copied, pages are read by the OS when first accessed.
+	* MappedFile is also a stream, for code reading files through streams.
+	*
+	* \remark The file must not be modified while mapped
+	*/
+
+	/*!
+	* \brief Constructs a MappedFile object with no file
+	*/
+	MappedFile::MappedFile() :
+	Stream(StreamOption_None, OpenMode_ReadOnly),
+	m_data(nullptr),
+	m_pos(0),
+	m_size(0)
+	{
+	}
+
+	/*!
+	* \brief Constructs a MappedFile object and maps a file
+	*
+	* \param filePath Path to the file
+	*
+	* \see Open
+	*/
+	MappedFile::MappedFile(const String& filePath) :
+	MappedFile()
+	{
+		Open(filePath);
+	}
+
+	/*!
+	* \brief Destructs the object and unmaps the file
+	*/
+	MappedFile::~MappedFile()
+	{
+		Close();
+	}
+
+	/*!
+	* \brief Unmaps the file
+	*
+	* \remark Pointers and views to the content of the file must not be used afterwards
+	*/
+	void MappedFile::Close()
+	{
+		if (m_impl)
+		{
+			m_impl->Close();
+			delete m_impl;
+			m_impl = nullptr;
+		}
+
+		m_data = nullptr;
+		m_pos = 0;
+		m_size = 0;
+	}
+
+	/*!
+	* \brief Checks whether the stream reached the end of the file
+	* \return true if cursor is at the end of the file
+	*/
+	bool MappedFile::EndOfStream() const
+	{
+		return m_pos >= m_size;
+	}
+
+	/*!
+	* \brief Gets the position of the cursor in the file
+	* \return Position of the cursor
+	*/
+	UInt64 MappedFile::GetCursorPos() const
+	{
+		return m_pos;
+	}
+
+	/*!
+	* \brief Gets the directory of the file
+	* \return Directory of the file
+	*/
+	String MappedFile::GetDirectory() const
+	{
+		return File::GetDirectory(m_filePath);
+	}
+
+	/*!
+	* \brief Gets a pointer to the mapped content
+	* \return Pointer to the beginning of the mapped content
+	*/
+	const void* MappedFile::GetMappedPointer() const
+	{
+		return m_data;
+	}
+
+	/*!
+	* \brief Gets the path of the file
+	* \return Path of the file
+	*/
+	String MappedFile::GetPath() const
+	{
+		return m_filePath;
+	}
+
+	/*!
+	* \brief Gets the size of the file
+	* \return Size of the file in bytes
+	*/
+	UInt64 MappedFile::GetSize() const
+	{
+		return m_size;
+	}
+
+	/*!
+	* \brief Gets a read-only stream over the content of the file
+	* \return View of the mapped memory, which must not be used after the file is closed
+	*/
+	MemoryView MappedFile::GetView() const
+	{
+		return MemoryView(static_cast<const void*>(m_data), m_size);
+	}
+
+	/*!
+	* \brief Maps a file in memory
+	* \return true if the file was mapped
+	*
+	* \param filePath Path to the file
+	*
+	* \remark Produces a NazaraError if the file couldn't be mapped
+	*/
+	bool MappedFile::Open(const String& filePath)
+	{
+		Close();
+
+		m_filePath = File::NormalizePath(filePath);
+
+		std::unique_ptr<MappedFileImpl> impl(new MappedFileImpl);
+		if (!impl->Open(m_filePath))
+		{
+			NazaraError("Failed to map file \"" + m_filePath + '"');
+			return false;
+		}
+
+		m_data = impl->GetData();
+		m_size = impl->GetSize();
+		m_impl = impl.release();
+
+		return true;
+	}
+
+	/*!
+	* \brief Sets the position of the cursor
+	* \return true
+	*
+	* \param offset Offset from the beginning of the file, clamped to the size of the file
+	*/
+	bool MappedFile::SetCursorPos(UInt64 offset)
+	{
+		m_pos = std::min(offset, m_size);
+
+		return true;
+	}
+
+	void MappedFile::FlushStream()
+	{
+		// Nothing to do
+	}
+
+	std::size_t MappedFile::ReadBlock(void* buffer, std::size_t size)
+	{
+		std::size_t readSize = static_cast<std::size_t>(std::min<UInt64>(size, m_size - m_pos));
+
+		if (buffer && readSize > 0)
+			std::memcpy(buffer, m_data + m_pos, readSize);
+
+		m_pos += readSize;
+		return readSize;
+	}
+
+	std::size_t MappedFile::WriteBlock(const void* /*buffer*/, std::size_t /*size*/)
+	{
+		NazaraInternalError("Mapped files are read-only");
+		return 0;
+	}
+}
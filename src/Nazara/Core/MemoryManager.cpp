@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Core/MemoryManager.hpp>
+#include <atomic>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -23,6 +24,7 @@ namespace Nz
 	{
 		constexpr unsigned int s_allocatedId = 0xDEADB33FUL;
 		constexpr unsigned int s_freedId = 0x4B1DUL;
+		constexpr unsigned int s_shardCount = 16;
 
 		struct Block
 		{
@@ -31,45 +33,142 @@ namespace Nz
 			Block* prev;
 			Block* next;
 			bool array;
+			UInt8 shard;
+			UInt8 tag;
 			unsigned int line;
 			unsigned int magic;
 		};
 
+		#if defined(NAZARA_PLATFORM_WINDOWS)
+		using PlatformMutex = CRITICAL_SECTION;
+		#elif defined(NAZARA_PLATFORM_POSIX)
+		using PlatformMutex = pthread_mutex_t;
+		#else
+		#error Lack of implementation: Mutex
+		#endif
+
+		// Blocks are spread over several lists (one per thread, modulo the count), threads rarely wait for each other this way
+		struct alignas(64) Shard
+		{
+			PlatformMutex mutex;
+			Block list;
+		};
+
+		// Updated without locking anything, on their own cache line not to slow down the other tags
+		struct alignas(64) TagCounters
+		{
+			std::atomic<std::size_t> allocatedSize;
+			std::atomic<std::size_t> budget;
+			std::atomic<std::size_t> peakSize;
+			std::atomic<unsigned int> allocatedBlockCount;
+			std::atomic<unsigned int> allocationCount;
+		};
+
+		const char* s_tagNames[] =
+		{
+			"Audio",     // MemoryTag_Audio
+			"Core",      // MemoryTag_Core
+			"Graphics",  // MemoryTag_Graphics
+			"Lua",       // MemoryTag_Lua
+			"Network",   // MemoryTag_Network
+			"Noise",     // MemoryTag_Noise
+			"Other",     // MemoryTag_Other
+			"Physics2D", // MemoryTag_Physics2D
+			"Physics3D", // MemoryTag_Physics3D
+			"Platform",  // MemoryTag_Platform
+			"Renderer",  // MemoryTag_Renderer
+			"Utility"    // MemoryTag_Utility
+		};
+
+		static_assert(sizeof(s_tagNames)/sizeof(const char*) == MemoryTag_Max+1, "Memory tag name array is incomplete");
+
 		bool s_allocationFilling = true;
 		bool s_allocationLogging = false;
-		bool s_initialized = false;
+		std::atomic_bool s_initialized(false);
 		const char* s_logFileName = "NazaraMemory.log";
 		thread_local const char* s_nextFreeFile = "(Internal error)";
 		thread_local unsigned int s_nextFreeLine = 0;
+		thread_local unsigned int s_threadShard = s_shardCount;
+
+		Shard s_shards[s_shardCount];
+		TagCounters s_tagCounters[MemoryTag_Max+1];
+		TagCounters s_totalCounters;
+		std::atomic<unsigned int> s_nextShard(0);
+		PlatformMutex s_logMutex;
 
-		Block s_list =
+		void InitializeMutex(PlatformMutex& mutex)
 		{
-			0,
-			nullptr,
-			&s_list,
-			&s_list,
-			false,
-			0,
-			0
-		};
+			#if defined(NAZARA_PLATFORM_WINDOWS)
+			InitializeCriticalSection(&mutex);
+			#elif defined(NAZARA_PLATFORM_POSIX)
+			pthread_mutex_init(&mutex, nullptr);
+			#endif
+		}
 
-		unsigned int s_allocationCount = 0;
-		unsigned int s_allocatedBlock = 0;
-		std::size_t s_allocatedSize = 0;
+		void LockMutex(PlatformMutex& mutex)
+		{
+			#if defined(NAZARA_PLATFORM_WINDOWS)
+			EnterCriticalSection(&mutex);
+			#elif defined(NAZARA_PLATFORM_POSIX)
+			pthread_mutex_lock(&mutex);
+			#endif
+		}
 
-		#if defined(NAZARA_PLATFORM_WINDOWS)
-		CRITICAL_SECTION s_mutex;
-		#elif defined(NAZARA_PLATFORM_POSIX)
-		pthread_mutex_t s_mutex = PTHREAD_MUTEX_INITIALIZER;
-		#else
-		#error Lack of implementation: Mutex
-		#endif
+		void UninitializeMutex(PlatformMutex& mutex)
+		{
+			#if defined(NAZARA_PLATFORM_WINDOWS)
+			DeleteCriticalSection(&mutex);
+			#elif defined(NAZARA_PLATFORM_POSIX)
+			pthread_mutex_destroy(&mutex);
+			#endif
+		}
+
+		void UnlockMutex(PlatformMutex& mutex)
+		{
+			#if defined(NAZARA_PLATFORM_WINDOWS)
+			LeaveCriticalSection(&mutex);
+			#elif defined(NAZARA_PLATFORM_POSIX)
+			pthread_mutex_unlock(&mutex);
+			#endif
+		}
+
+		// Returns the previous allocated size
+		std::size_t AddAllocation(TagCounters& counters, std::size_t size)
+		{
+			std::size_t previousSize = counters.allocatedSize.fetch_add(size, std::memory_order_relaxed);
+			counters.allocatedBlockCount.fetch_add(1, std::memory_order_relaxed);
+			counters.allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+			std::size_t newSize = previousSize + size;
+			std::size_t peakSize = counters.peakSize.load(std::memory_order_relaxed);
+			while (peakSize < newSize && !counters.peakSize.compare_exchange_weak(peakSize, newSize, std::memory_order_relaxed));
+
+			return previousSize;
+		}
+
+		void RemoveAllocation(TagCounters& counters, std::size_t size)
+		{
+			counters.allocatedSize.fetch_sub(size, std::memory_order_relaxed);
+			counters.allocatedBlockCount.fetch_sub(1, std::memory_order_relaxed);
+		}
+
+		Shard& GetThreadShard(UInt8* index)
+		{
+			if (s_threadShard == s_shardCount)
+				s_threadShard = s_nextShard.fetch_add(1, std::memory_order_relaxed) % s_shardCount;
+
+			*index = static_cast<UInt8>(s_threadShard);
+			return s_shards[s_threadShard];
+		}
 	}
 	
 	/*!
 	* \ingroup core
 	* \class Nz::MemoryManager
 	* \brief Core class that represents a manager for the memory
+	*
+	* Allocations are tagged with the module they were made by, which have their own statistics and an optional budget.
+	* Blocks are kept in several lists, each one having its own lock, and the statistics are atomic: threads allocating at the same time rarely wait for each other.
 	*/
 
 	/*!
@@ -97,18 +196,19 @@ namespace Nz
 	* \param multi Array or not
 	* \param file File of the allocation
 	* \param line Line of the allocation in the file
+	* \param tag Module the allocation is accounted to
+	*
+	* \remark A warning is logged each time the allocated size of the tag goes over its budget
 	*/
 
-	void* MemoryManager::Allocate(std::size_t size, bool multi, const char* file, unsigned int line)
+	void* MemoryManager::Allocate(std::size_t size, bool multi, const char* file, unsigned int line, MemoryTag tag)
 	{
-		if (!s_initialized)
-			Initialize();
-
-		#if defined(NAZARA_PLATFORM_WINDOWS)
-		EnterCriticalSection(&s_mutex);
-		#elif defined(NAZARA_PLATFORM_POSIX)
-		pthread_mutex_lock(&s_mutex);
-		#endif
+		if (!s_initialized.load(std::memory_order_acquire))
+		{
+			// The first allocations may be done by several threads at once, the initialization of a local static is thread-safe
+			static bool initialized = (Initialize(), true);
+			NazaraUnused(initialized);
+		}
 
 		Block* ptr = static_cast<Block*>(std::malloc(size+sizeof(Block)));
 		if (!ptr)
@@ -116,6 +216,8 @@ namespace Nz
 			char timeStr[23];
 			TimeInfo(timeStr);
 
+			LockMutex(s_logMutex);
+
 			FILE* log = std::fopen(s_logFileName, "a");
 
 			if (file)
@@ -125,6 +227,8 @@ namespace Nz
 
 			std::fclose(log);
 
+			UnlockMutex(s_logMutex);
+
 			throw std::bad_alloc();
 		}
 
@@ -133,15 +237,22 @@ namespace Nz
 		ptr->line = line;
 		ptr->size = size;
 		ptr->magic = s_allocatedId;
+		ptr->tag = static_cast<UInt8>(tag);
+
+		Shard& shard = GetThreadShard(&ptr->shard);
+
+		LockMutex(shard.mutex);
+
+		ptr->prev = shard.list.prev;
+		ptr->next = &shard.list;
+		shard.list.prev->next = ptr;
+		shard.list.prev = ptr;
 
-		ptr->prev = s_list.prev;
-		ptr->next = &s_list;
-		s_list.prev->next = ptr;
-		s_list.prev = ptr;
+		UnlockMutex(shard.mutex);
 
-		s_allocatedBlock++;
-		s_allocatedSize += size;
-		s_allocationCount++;
+		TagCounters& tagCounters = s_tagCounters[tag];
+		std::size_t previousSize = AddAllocation(tagCounters, size);
+		AddAllocation(s_totalCounters, size);
 
 		if (s_allocationFilling)
 		{
@@ -149,26 +260,33 @@ namespace Nz
 			std::memset(data, 0xFF, size);
 		}
 
-		if (s_allocationLogging)
+		std::size_t budget = tagCounters.budget.load(std::memory_order_relaxed);
+		bool overBudget = (budget > 0 && previousSize <= budget && previousSize + size > budget);
+
+		if (overBudget || s_allocationLogging)
 		{
 			char timeStr[23];
 			TimeInfo(timeStr);
 
+			LockMutex(s_logMutex);
+
 			FILE* log = std::fopen(s_logFileName, "a");
 
-			if (file)
-				std::fprintf(log, "%s Allocated %zu bytes at %s:%u\n", timeStr, size, file, line);
-			else
-				std::fprintf(log, "%s Allocated %zu bytes at unknown position\n", timeStr, size);
+			if (overBudget)
+				std::fprintf(log, "%s Warning: %s memory went over its budget of %zu bytes (%zu bytes allocated)\n", timeStr, s_tagNames[tag], budget, previousSize + size);
+
+			if (s_allocationLogging)
+			{
+				if (file)
+					std::fprintf(log, "%s Allocated %zu bytes at %s:%u\n", timeStr, size, file, line);
+				else
+					std::fprintf(log, "%s Allocated %zu bytes at unknown position\n", timeStr, size);
+			}
 
 			std::fclose(log);
-		}
 
-		#if defined(NAZARA_PLATFORM_WINDOWS)
-		LeaveCriticalSection(&s_mutex);
-		#elif defined(NAZARA_PLATFORM_POSIX)
-		pthread_mutex_unlock(&s_mutex);
-		#endif
+			UnlockMutex(s_logMutex);
+		}
 
 		return reinterpret_cast<UInt8*>(ptr) + sizeof(Block);
 	}
@@ -210,51 +328,47 @@ namespace Nz
 			return;
 
 		Block* ptr = reinterpret_cast<Block*>(static_cast<UInt8*>(pointer) - sizeof(Block));
-		if (ptr->magic != s_allocatedId)
+		if (ptr->magic != s_allocatedId || ptr->array != multi)
 		{
 			char timeStr[23];
 			TimeInfo(timeStr);
 
+			LockMutex(s_logMutex);
+
 			FILE* log = std::fopen(s_logFileName, "a");
 
-			const char* error = (ptr->magic == s_freedId) ? "double-delete" : "possible delete of dangling pointer";
+			const char* error;
+			if (ptr->magic != s_allocatedId)
+				error = (ptr->magic == s_freedId) ? "double-delete" : "possible delete of dangling pointer";
+			else
+				error = (multi) ? "delete[] after new" : "delete after new[]";
+
 			if (s_nextFreeFile)
 				std::fprintf(log, "%s Warning: %s at %s:%u\n", timeStr, error, s_nextFreeFile, s_nextFreeLine);
 			else
 				std::fprintf(log, "%s Warning: %s at unknown position\n", timeStr, error);
 
 			std::fclose(log);
-			return;
-		}
 
-		#if defined(NAZARA_PLATFORM_WINDOWS)
-		EnterCriticalSection(&s_mutex);
-		#elif defined(NAZARA_PLATFORM_POSIX)
-		pthread_mutex_lock(&s_mutex);
-		#endif
+			UnlockMutex(s_logMutex);
 
-		if (ptr->array != multi)
-		{
-			char timeStr[23];
-			TimeInfo(timeStr);
+			if (ptr->magic != s_allocatedId)
+				return;
+		}
 
-			FILE* log = std::fopen(s_logFileName, "a");
+		// The block may have been allocated by another thread, and thus be in another list
+		Shard& shard = s_shards[ptr->shard];
 
-			const char* error = (multi) ? "delete[] after new" : "delete after new[]";
-			if (s_nextFreeFile)
-				std::fprintf(log, "%s Warning: %s at %s:%u\n", timeStr, error, s_nextFreeFile, s_nextFreeLine);
-			else
-				std::fprintf(log, "%s Warning: %s at unknown position\n", timeStr, error);
-
-			std::fclose(log);
-		}
+		LockMutex(shard.mutex);
 
 		ptr->magic = s_freedId;
 		ptr->prev->next = ptr->next;
 		ptr->next->prev = ptr->prev;
 
-		s_allocatedBlock--;
-		s_allocatedSize -= ptr->size;
+		UnlockMutex(shard.mutex);
+
+		RemoveAllocation(s_tagCounters[ptr->tag], ptr->size);
+		RemoveAllocation(s_totalCounters, ptr->size);
 
 		if (s_allocationFilling)
 		{
@@ -266,12 +380,6 @@ namespace Nz
 
 		s_nextFreeFile = nullptr;
 		s_nextFreeLine = 0;
-
-		#if defined(NAZARA_PLATFORM_WINDOWS)
-		LeaveCriticalSection(&s_mutex);
-		#elif defined(NAZARA_PLATFORM_POSIX)
-		pthread_mutex_unlock(&s_mutex);
-		#endif
 	}
 
 	/*!
@@ -281,7 +389,7 @@ namespace Nz
 
 	unsigned int MemoryManager::GetAllocatedBlockCount()
 	{
-		return s_allocatedBlock;
+		return s_totalCounters.allocatedBlockCount.load(std::memory_order_relaxed);
 	}
 
 	/*!
@@ -291,7 +399,7 @@ namespace Nz
 
 	std::size_t MemoryManager::GetAllocatedSize()
 	{
-		return s_allocatedSize;
+		return s_totalCounters.allocatedSize.load(std::memory_order_relaxed);
 	}
 
 	/*!
@@ -301,7 +409,54 @@ namespace Nz
 
 	unsigned int MemoryManager::GetAllocationCount()
 	{
-		return s_allocationCount;
+		return s_totalCounters.allocationCount.load(std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Gets the budget of a tag
+	* \return Size the allocations of the tag should not exceed, zero if there is no budget
+	*
+	* \param tag Memory tag
+	*
+	* \see SetBudget
+	*/
+
+	std::size_t MemoryManager::GetBudget(MemoryTag tag)
+	{
+		return s_tagCounters[tag].budget.load(std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Gets the highest allocated size, all tags included
+	* \return Highest size allocated at a time since the start (or the last ResetPeakSizes)
+	*/
+
+	std::size_t MemoryManager::GetPeakSize()
+	{
+		return s_totalCounters.peakSize.load(std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Gets the statistics of the allocations of a tag
+	* \return Statistics of the tag, at the time of the call
+	*
+	* \param tag Memory tag
+	*
+	* \remark Counters are read independently, they may not be consistent with each other while other threads allocate
+	*/
+
+	MemoryManager::TagStatistics MemoryManager::GetTagStatistics(MemoryTag tag)
+	{
+		const TagCounters& counters = s_tagCounters[tag];
+
+		TagStatistics statistics;
+		statistics.allocatedBlockCount = counters.allocatedBlockCount.load(std::memory_order_relaxed);
+		statistics.allocatedSize = counters.allocatedSize.load(std::memory_order_relaxed);
+		statistics.allocationCount = counters.allocationCount.load(std::memory_order_relaxed);
+		statistics.budget = counters.budget.load(std::memory_order_relaxed);
+		statistics.peakSize = counters.peakSize.load(std::memory_order_relaxed);
+
+		return statistics;
 	}
 
 	/*!
@@ -337,6 +492,32 @@ namespace Nz
 		s_nextFreeLine = line;
 	}
 
+	/*!
+	* \brief Resets the peak sizes of every tag to their currently allocated size
+	*/
+
+	void MemoryManager::ResetPeakSizes()
+	{
+		for (TagCounters& counters : s_tagCounters)
+			counters.peakSize.store(counters.allocatedSize.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+		s_totalCounters.peakSize.store(s_totalCounters.allocatedSize.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Sets the budget of a tag
+	*
+	* \param tag Memory tag
+	* \param budget Size the allocations of the tag should not exceed, zero to remove the budget
+	*
+	* \remark Going over the budget doesn't make allocations fail, a warning is logged each time it happens
+	*/
+
+	void MemoryManager::SetBudget(MemoryTag tag, std::size_t budget)
+	{
+		s_tagCounters[tag].budget.store(budget, std::memory_order_relaxed);
+	}
+
 	/*!
 	* \brief Initializes the MemoryManager
 	*/
@@ -357,12 +538,17 @@ namespace Nz
 			static MemoryManager manager;
 		}
 
-		#ifdef NAZARA_PLATFORM_WINDOWS
-		InitializeCriticalSection(&s_mutex);
-		//#elif defined(NAZARA_PLATFORM_POSIX) is already done in the namespace
-		#endif
+		InitializeMutex(s_logMutex);
 
-		s_initialized = true;
+		for (Shard& shard : s_shards)
+		{
+			InitializeMutex(shard.mutex);
+
+			shard.list.prev = &shard.list;
+			shard.list.next = &shard.list;
+		}
+
+		s_initialized.store(true, std::memory_order_release);
 	}
 
 	/*!
@@ -383,11 +569,10 @@ namespace Nz
 
 	void MemoryManager::Uninitialize()
 	{
-		#ifdef NAZARA_PLATFORM_WINDOWS
-		DeleteCriticalSection(&s_mutex);
-		#elif defined(NAZARA_PLATFORM_POSIX)
-		pthread_mutex_destroy(&s_mutex);
-		#endif
+		UninitializeMutex(s_logMutex);
+
+		for (Shard& shard : s_shards)
+			UninitializeMutex(shard.mutex);
 
 		FILE* log = std::fopen(s_logFileName, "a");
 
@@ -396,11 +581,12 @@ namespace Nz
 
 		std::fprintf(log, "%s Application finished, checking leaks...\n", timeStr);
 
-		if (s_allocatedBlock == 0)
+		unsigned int allocatedBlockCount = s_totalCounters.allocatedBlockCount.load(std::memory_order_relaxed);
+		if (allocatedBlockCount == 0)
 		{
 			std::fprintf(log, "%s ==============================\n", timeStr);
 			std::fprintf(log, "%s        No leak detected       \n", timeStr);
-			std::fprintf(log, "%s ==============================", timeStr);
+			std::fprintf(log, "%s ==============================\n", timeStr);
 		}
 		else
 		{
@@ -409,23 +595,38 @@ namespace Nz
 			std::fprintf(log, "%s ==============================\n\n", timeStr);
 			std::fputs("Leak list:\n", log);
 
-			Block* ptr = s_list.next;
-			while (ptr != &s_list)
+			for (Shard& shard : s_shards)
 			{
-				if (ptr->file)
-					std::fprintf(log, "-0x%s -> %zu bytes allocated at %s:%u\n", reinterpret_cast<UInt8*>(ptr) + sizeof(Block), ptr->size, ptr->file, ptr->line);
-				else
-					std::fprintf(log, "-0x%s -> %zu bytes allocated at unknown position\n", reinterpret_cast<UInt8*>(ptr) + sizeof(Block), ptr->size);
+				Block* ptr = shard.list.next;
+				while (ptr != &shard.list)
+				{
+					if (ptr->file)
+						std::fprintf(log, "-%p -> %zu bytes (%s) allocated at %s:%u\n", reinterpret_cast<UInt8*>(ptr) + sizeof(Block), ptr->size, s_tagNames[ptr->tag], ptr->file, ptr->line);
+					else
+						std::fprintf(log, "-%p -> %zu bytes (%s) allocated at unknown position\n", reinterpret_cast<UInt8*>(ptr) + sizeof(Block), ptr->size, s_tagNames[ptr->tag]);
+
+					void* pointer = ptr;
+					ptr = ptr->next;
+
+					std::free(pointer);
+				}
+			}
 
-				void* pointer = ptr;
-				ptr = ptr->next;
+			std::fprintf(log, "\n%u blocks leaked (%zu bytes)\n", allocatedBlockCount, s_totalCounters.allocatedSize.load(std::memory_order_relaxed));
+		}
 
-				std::free(pointer);
-			}
+		std::fputs("\nPeak sizes:\n", log);
+		for (unsigned int i = 0; i <= MemoryTag_Max; ++i)
+		{
+			const TagCounters& counters = s_tagCounters[i];
 
-			std::fprintf(log, "\n%u blocks leaked (%zu bytes)", s_allocatedBlock, s_allocatedSize);
+			unsigned int allocationCount = counters.allocationCount.load(std::memory_order_relaxed);
+			if (allocationCount > 0)
+				std::fprintf(log, "-%s -> %zu bytes (%u allocations)\n", s_tagNames[i], counters.peakSize.load(std::memory_order_relaxed), allocationCount);
 		}
 
+		std::fprintf(log, "Total -> %zu bytes", s_totalCounters.peakSize.load(std::memory_order_relaxed));
+
 		std::fclose(log);
 	}
 }
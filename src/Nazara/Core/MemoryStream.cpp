@@ -4,6 +4,8 @@
 
 #include <Nazara/Core/MemoryStream.hpp>
 #include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/ByteArrayPool.hpp>
+#include <Nazara/Core/Error.hpp>
 #include <algorithm>
 #include <cstring>
 #include <Nazara/Core/Debug.hpp>
@@ -14,6 +16,9 @@ namespace Nz
 	* \ingroup core
 	* \class Nz::MemoryStream
 	* \brief Core class that represents a stream of memory
+	*
+	* Writing past the capacity of the buffer makes it grow following the growth policy (doubling its capacity by default),
+	* taking the new storage from a ByteArrayPool if one is set.
 	*/
 
 	/*!
@@ -56,6 +61,22 @@ namespace Nz
 		return m_buffer->GetSize();
 	}
 
+	/*!
+	* \brief Ensures the buffer can hold some bytes without growing
+	*
+	* \param size Capacity the buffer must have
+	*
+	* \remark Doesn't change the size of the stream
+	*/
+
+	void MemoryStream::Reserve(UInt64 size)
+	{
+		NazaraAssert(m_buffer, "Invalid buffer");
+
+		if (size > m_buffer->GetCapacity())
+			Reallocate(static_cast<std::size_t>(size));
+	}
+
 	/*!
 	* \brief Sets the buffer for the memory stream
 	*
@@ -96,6 +117,40 @@ namespace Nz
 		// Nothing to flush
 	}
 
+	/*!
+	* \brief Grows the buffer following the growth policy
+	*
+	* \param minCapacity Capacity the buffer must have
+	*/
+
+	void MemoryStream::Grow(std::size_t minCapacity)
+	{
+		std::size_t capacity = m_buffer->GetCapacity();
+
+		std::size_t newCapacity;
+		switch (m_growthPolicy)
+		{
+			case GrowthPolicy_Exact:
+				newCapacity = minCapacity;
+				break;
+
+			case GrowthPolicy_Geometric:
+				newCapacity = std::max(minCapacity, capacity * 2);
+				break;
+
+			case GrowthPolicy_Linear:
+				newCapacity = (minCapacity + m_growthIncrement - 1) / m_growthIncrement * m_growthIncrement;
+				break;
+
+			default:
+				NazaraInternalError("Growth policy not handled (0x" + String::Number(m_growthPolicy, 16) + ')');
+				newCapacity = minCapacity;
+				break;
+		}
+
+		Reallocate(newCapacity);
+	}
+
 	/*!
 	* \brief Reads blocks
 	* \return Number of blocks read
@@ -118,6 +173,26 @@ namespace Nz
 		return readSize;
 	}
 
+	/*!
+	* \brief Changes the capacity of the buffer, keeping its content
+	*
+	* \param capacity Capacity the buffer must have
+	*/
+
+	void MemoryStream::Reallocate(std::size_t capacity)
+	{
+		if (m_bufferPool)
+		{
+			ByteArray newBuffer = m_bufferPool->Acquire(capacity);
+			newBuffer.Append(m_buffer->GetConstBuffer(), m_buffer->GetSize());
+
+			m_buffer->Swap(newBuffer);
+			m_bufferPool->Release(std::move(newBuffer));
+		}
+		else
+			m_buffer->Reserve(capacity);
+	}
+
 	/*!
 	* \brief Writes blocks
 	* \return Number of blocks written
@@ -132,13 +207,22 @@ namespace Nz
 	{
 		if (size > 0)
 		{
-			std::size_t endPos = static_cast<std::size_t>(m_pos + size);
-			if (endPos > m_buffer->GetSize())
-				m_buffer->Resize(endPos);
-
 			NazaraAssert(buffer, "Invalid buffer");
 
-			std::memcpy(m_buffer->GetBuffer() + m_pos, buffer, size);
+			std::size_t endPos = static_cast<std::size_t>(m_pos + size);
+			if (endPos > m_buffer->GetCapacity())
+				Grow(endPos);
+
+			std::size_t bufferSize = m_buffer->GetSize();
+			if (m_pos == bufferSize)
+				m_buffer->Append(buffer, size); // Avoids clearing the new bytes before copying
+			else
+			{
+				if (endPos > bufferSize)
+					m_buffer->Resize(endPos);
+
+				std::memcpy(m_buffer->GetBuffer() + m_pos, buffer, size);
+			}
 
 			m_pos = endPos;
 		}
@@ -69,6 +69,16 @@ namespace Nz
 		return m_pos;
 	}
 
+	/*!
+	* \brief Gets a pointer to the raw memory
+	* \return Pointer to the beginning of the raw memory
+	*/
+
+	const void* MemoryView::GetMappedPointer() const
+	{
+		return m_ptr;
+	}
+
 	/*!
 	* \brief Gets the size of the raw memory
 	* \return Size of the memory
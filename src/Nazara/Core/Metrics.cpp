@@ -0,0 +1,290 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Metrics.hpp>
+#include <Nazara/Core/AbstractMetricsExporter.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		struct MetricInfo
+		{
+			Metrics::Sampler sampler;
+			MetricType type;
+			String description;
+			String labels;
+			String name;
+			bool isRegistered = false;
+		};
+
+		struct ThreadShard
+		{
+			// Atomics (only accessed with relaxed operations) allow the shard to be read while its thread writes it
+			std::atomic<Int64> values[NAZARA_CORE_METRIC_COUNT];
+			std::atomic_bool inUse;
+		};
+
+		struct MetricsRegistry
+		{
+			Mutex mutex;
+			MetricInfo metrics[NAZARA_CORE_METRIC_COUNT];
+			std::atomic<double> setValues[NAZARA_CORE_METRIC_COUNT];
+			std::vector<std::unique_ptr<ThreadShard>> shards;
+		};
+
+		MetricsRegistry& GetRegistry()
+		{
+			// Leaked on purpose, threads may still update metrics during the static destruction
+			static MetricsRegistry* registry = new MetricsRegistry;
+			return *registry;
+		}
+
+		// Gives its shard back when its thread ends, the values it holds keep being counted and the next thread needing a shard carries on with them
+		struct ThreadShardOwner
+		{
+			~ThreadShardOwner()
+			{
+				if (shard)
+					shard->inUse.store(false, std::memory_order_release);
+			}
+
+			ThreadShard* shard = nullptr;
+		};
+
+		thread_local ThreadShardOwner s_threadShardOwner;
+
+		ThreadShard* GetThreadShard()
+		{
+			ThreadShardOwner& owner = s_threadShardOwner;
+			if (owner.shard)
+				return owner.shard;
+
+			MetricsRegistry& registry = GetRegistry();
+
+			LockGuard lock(registry.mutex);
+			for (const auto& shard : registry.shards)
+			{
+				if (!shard->inUse.load(std::memory_order_acquire))
+				{
+					shard->inUse.store(true, std::memory_order_relaxed);
+
+					owner.shard = shard.get();
+					return owner.shard;
+				}
+			}
+
+			std::unique_ptr<ThreadShard> shard(new ThreadShard);
+			for (std::atomic<Int64>& value : shard->values)
+				value.store(0, std::memory_order_relaxed);
+
+			shard->inUse = true;
+
+			owner.shard = shard.get();
+			registry.shards.emplace_back(std::move(shard));
+
+			return owner.shard;
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::Metrics
+	* \brief Core class keeping counters and gauges describing the state of the application, to be scraped by a monitoring system
+	*
+	* Every thread adds to its own copy of the metrics (a shard) without locking anything, shards being only summed up when metrics are collected.
+	* Metrics are collected by Collect and turned into text by an exporter (like PrometheusMetricsExporter or StatsDMetricsExporter), sending this text (over HTTP or UDP) is up to the application.
+	*
+	* The value of a metric is the sum of the value given by Set (or by its sampler) and of everything given to Add, counters should only be increased.
+	* Gauges whose value is already known somewhere (a queue size for example) should rather be registered with a sampler, which is only called on collection.
+	*
+	* \remark At most NAZARA_CORE_METRIC_COUNT metrics can be registered at once
+	*/
+
+	/*!
+	* \brief Adds a value to a metric
+	*
+	* \param metricId Identifier of the metric, as returned by Register
+	* \param value Value to add, may only be negative for gauges
+	*
+	* \remark This is safe to call from any thread, without locking
+	* \remark Invalid identifiers (like InvalidId) are ignored
+	*/
+
+	void Metrics::Add(UInt32 metricId, Int64 value)
+	{
+		if (metricId >= NAZARA_CORE_METRIC_COUNT)
+			return;
+
+		// Only this thread writes its shard, no read-modify-write operation is needed
+		std::atomic<Int64>& shardValue = GetThreadShard()->values[metricId];
+		shardValue.store(shardValue.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Collects the current value of every registered metric
+	* \return Samples sorted by name
+	*
+	* \remark Samplers are called from this thread, with the registry locked (they must not register or unregister metrics)
+	*/
+
+	std::vector<Metrics::Sample> Metrics::Collect()
+	{
+		MetricsRegistry& registry = GetRegistry();
+
+		std::vector<Sample> samples;
+
+		LockGuard lock(registry.mutex);
+		for (UInt32 metricId = 0; metricId < NAZARA_CORE_METRIC_COUNT; ++metricId)
+		{
+			const MetricInfo& metric = registry.metrics[metricId];
+			if (!metric.isRegistered)
+				continue;
+
+			Int64 addedValue = 0;
+			for (const auto& shard : registry.shards)
+				addedValue += shard->values[metricId].load(std::memory_order_relaxed);
+
+			Sample sample;
+			sample.type = metric.type;
+			sample.description = metric.description;
+			sample.labels = metric.labels;
+			sample.name = metric.name;
+			sample.value = ((metric.sampler) ? metric.sampler() : registry.setValues[metricId].load(std::memory_order_relaxed)) + addedValue;
+
+			samples.emplace_back(std::move(sample));
+		}
+
+		std::stable_sort(samples.begin(), samples.end(), [] (const Sample& lhs, const Sample& rhs) { return lhs.name < rhs.name; });
+
+		return samples;
+	}
+
+	/*!
+	* \brief Collects every metric and exports them
+	* \return Text produced by the exporter
+	*
+	* \param exporter Exporter to use
+	*/
+
+	String Metrics::Export(AbstractMetricsExporter& exporter)
+	{
+		return exporter.Export(Collect());
+	}
+
+	/*!
+	* \brief Registers a metric
+	* \return Identifier of the metric, or InvalidId if too many metrics are registered
+	*
+	* \param type Type of the metric
+	* \param name Name of the metric (like "nazara_world_entities")
+	* \param description Description of the metric
+	* \param labels Labels distinguishing metrics sharing a name, in the Prometheus syntax (like "system=\"Physics\"")
+	*
+	* \remark Produces a NazaraError if too many metrics are registered
+	*/
+
+	UInt32 Metrics::Register(MetricType type, const String& name, const String& description, const String& labels)
+	{
+		return Register(type, name, description, Sampler(), labels);
+	}
+
+	/*!
+	* \brief Registers a metric whose base value is given by a function
+	* \return Identifier of the metric, or InvalidId if too many metrics are registered
+	*
+	* \param type Type of the metric
+	* \param name Name of the metric (like "nazara_world_entities")
+	* \param description Description of the metric
+	* \param sampler Function returning the value of the metric, called on each collection
+	* \param labels Labels distinguishing metrics sharing a name, in the Prometheus syntax (like "system=\"Physics\"")
+	*
+	* \remark Produces a NazaraError if too many metrics are registered
+	*/
+
+	UInt32 Metrics::Register(MetricType type, const String& name, const String& description, Sampler sampler, const String& labels)
+	{
+		NazaraAssert(type <= MetricType_Max, "Metric type out of enum");
+
+		MetricsRegistry& registry = GetRegistry();
+
+		LockGuard lock(registry.mutex);
+		for (UInt32 metricId = 0; metricId < NAZARA_CORE_METRIC_COUNT; ++metricId)
+		{
+			MetricInfo& metric = registry.metrics[metricId];
+			if (metric.isRegistered)
+				continue;
+
+			// Values added to the previous metric using this identifier are forgotten
+			for (const auto& shard : registry.shards)
+				shard->values[metricId].store(0, std::memory_order_relaxed);
+
+			registry.setValues[metricId].store(0.0, std::memory_order_relaxed);
+
+			metric.sampler = std::move(sampler);
+			metric.type = type;
+			metric.description = description;
+			metric.labels = labels;
+			metric.name = name;
+			metric.isRegistered = true;
+
+			return metricId;
+		}
+
+		NazaraError("Failed to register metric " + name + ": too many metrics are registered (" + String::Number(NAZARA_CORE_METRIC_COUNT) + ')');
+		return InvalidId;
+	}
+
+	/*!
+	* \brief Sets the base value of a metric
+	*
+	* \param metricId Identifier of the metric, as returned by Register
+	* \param value New base value
+	*
+	* \remark This is safe to call from any thread, without locking
+	* \remark Invalid identifiers (like InvalidId) are ignored
+	* \remark This has no effect on metrics having a sampler
+	*/
+
+	void Metrics::Set(UInt32 metricId, double value)
+	{
+		if (metricId >= NAZARA_CORE_METRIC_COUNT)
+			return;
+
+		GetRegistry().setValues[metricId].store(value, std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Unregisters a metric
+	*
+	* \param metricId Identifier of the metric, as returned by Register
+	*
+	* \remark Once this returns, the sampler of the metric is not called anymore
+	* \remark The identifier may be given to the next registered metric, it should not be used anymore
+	*/
+
+	void Metrics::Unregister(UInt32 metricId)
+	{
+		if (metricId >= NAZARA_CORE_METRIC_COUNT)
+			return;
+
+		MetricsRegistry& registry = GetRegistry();
+
+		LockGuard lock(registry.mutex);
+
+		MetricInfo& metric = registry.metrics[metricId];
+		metric.sampler = Sampler();
+		metric.isRegistered = false;
+	}
+
+	constexpr UInt32 Metrics::InvalidId;
+}
@@ -3,7 +3,9 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/Clock.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <atomic>
 
 #if defined(NAZARA_PLATFORM_WINDOWS)
 	#include <Nazara/Core/Win32/MutexImpl.hpp>
@@ -17,12 +19,19 @@
 
 namespace Nz
 {
+	namespace
+	{
+		std::atomic<UInt64> s_contentionCount(0);
+		std::atomic<UInt64> s_waitTime(0);
+	}
+
 	/*!
 	* \ingroup core
 	* \class Nz::Mutex
 	* \brief Core class that represents a binary semaphore, a mutex
 	*
 	* \remark The mutex is recursive, it means that a thread who owns the mutex can call the same function which needs the same mutex
+	* \remark A contended mutex is spun on for a short while before the thread waits for it, see NAZARA_CORE_POSIX_MUTEX_SPINLOCKS and NAZARA_CORE_WINDOWS_CS_SPINLOCKS
 	*/
 
 	/*!
@@ -52,7 +61,16 @@ namespace Nz
 	void Mutex::Lock()
 	{
 		NazaraAssert(m_impl, "Cannot lock a moved mutex");
+
+		// Only contended locks are counted, keeping the uncontended path free of shared writes
+		if (m_impl->TryLock())
+			return;
+
+		UInt64 startTime = GetElapsedMicroseconds();
 		m_impl->Lock();
+
+		s_contentionCount.fetch_add(1, std::memory_order_relaxed);
+		s_waitTime.fetch_add(GetElapsedMicroseconds() - startTime, std::memory_order_relaxed);
 	}
 
 	/*!
@@ -77,4 +95,28 @@ namespace Nz
 		NazaraAssert(m_impl, "Cannot unlock a moved mutex");
 		m_impl->Unlock();
 	}
+
+	/*!
+	* \brief Gets the contention of every mutex, for profiling
+	* \return Number of locks which had to wait, and the time spent waiting, since the start of the program or the last call to ResetContentionStats
+	*/
+
+	LockContentionStats Mutex::GetContentionStats()
+	{
+		LockContentionStats stats;
+		stats.contentionCount = s_contentionCount.load(std::memory_order_relaxed);
+		stats.waitTime = s_waitTime.load(std::memory_order_relaxed);
+
+		return stats;
+	}
+
+	/*!
+	* \brief Resets the counters returned by GetContentionStats
+	*/
+
+	void Mutex::ResetContentionStats()
+	{
+		s_contentionCount.store(0, std::memory_order_relaxed);
+		s_waitTime.store(0, std::memory_order_relaxed);
+	}
 }
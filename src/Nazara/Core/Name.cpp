@@ -0,0 +1,57 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Name.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <unordered_map>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		struct NameRegistry
+		{
+			Mutex mutex;
+			std::unordered_map<UInt64, String> strings;
+		};
+
+		NameRegistry& GetRegistry()
+		{
+			static NameRegistry registry;
+			return registry;
+		}
+	}
+
+	/*!
+	* \brief Gets a name whose characters are kept until the program exits
+	* \return Name which can be stored, whatever the lifetime of the string it comes from
+	*
+	* \param name Name to intern, only read during the call
+	*
+	* \remark Thread-safe, interning the same characters twice gives back the same pointer
+	* \remark Already interned names are looked up by their hash, without copying their characters
+	*/
+	Name Name::Intern(const Name& name)
+	{
+		NameRegistry& registry = GetRegistry();
+
+		LockGuard lock(registry.mutex);
+
+		auto it = registry.strings.find(name.m_hash);
+		if (it == registry.strings.end())
+			it = registry.strings.emplace(name.m_hash, String(name.m_string)).first;
+		#ifdef NAZARA_DEBUG
+		else if (it->second != name.m_string)
+			NazaraWarning("Names \"" + it->second + "\" and \"" + String(name.m_string) + "\" share the same hash");
+		#endif
+
+		return Name(it->second.GetConstBuffer(), name.m_hash);
+	}
+
+	constexpr UInt64 Name::HashOffset;
+	constexpr UInt64 Name::HashPrime;
+}
@@ -0,0 +1,47 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/NonAtomicRefCounted.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Destructs the object
+	*
+	* \remark Produces a NazaraWarning if still referenced with NAZARA_CORE_SAFE defined
+	*/
+
+	NonAtomicRefCounted::~NonAtomicRefCounted()
+	{
+		#if NAZARA_CORE_SAFE
+		if (m_referenceCount > 0)
+			NazaraWarning("Resource destroyed while still referenced " + String::Number(m_referenceCount) + " time(s)");
+		#endif
+	}
+
+	/*!
+	* \brief Sets the persistence of the object
+	* \return true if object is deleted because no more referenced
+	*
+	* \param persistent Sets the persistence of the object
+	* \param checkReferenceCount Checks if the object should be destroyed if true
+	*/
+
+	bool NonAtomicRefCounted::SetPersistent(bool persistent, bool checkReferenceCount)
+	{
+		m_persistent = persistent;
+
+		if (checkReferenceCount && !persistent && m_referenceCount == 0)
+		{
+			delete this;
+
+			return true;
+		}
+		else
+			return false;
+	}
+}
@@ -15,16 +15,39 @@ namespace Nz
 	* \ingroup core
 	* \class Nz::ParameterList
 	* \brief Core class that represents a list of parameters
+	*
+	* Parameters are kept in a flat array sorted by the hash of their name, the first ones being stored inside the list itself.
+	* Names are interned, which makes building, copying and querying small lists (like the ones describing a shader) free of string allocations.
 	*/
 
+	/*!
+	* \brief Constructs an empty ParameterList object
+	*/
+	ParameterList::ParameterList() :
+	m_parameters(reinterpret_cast<Parameter*>(m_inlineParameters)),
+	m_capacity(InlineCapacity),
+	m_parameterCount(0)
+	{
+	}
+
 	/*!
 	* \brief Constructs a ParameterList object by copy
 	*/
-	ParameterList::ParameterList(const ParameterList& list)
+	ParameterList::ParameterList(const ParameterList& list) :
+	ParameterList()
 	{
 		operator=(list);
 	}
 
+	/*!
+	* \brief Constructs a ParameterList object by move
+	*/
+	ParameterList::ParameterList(ParameterList&& list) :
+	ParameterList()
+	{
+		MoveParameters(list);
+	}
+
 	/*!
 	* \brief Destructs the object and clears
 	*/
@@ -38,10 +61,10 @@ namespace Nz
 	*/
 	void ParameterList::Clear()
 	{
-		for (auto it = m_parameters.begin(); it != m_parameters.end(); ++it)
-			DestroyValue(it->second);
+		for (std::size_t i = 0; i < m_parameterCount; ++i)
+			DestroyValue(m_parameters[i]);
 
-		m_parameters.clear();
+		m_parameterCount = 0;
 	}
 
 	/*!
@@ -57,33 +80,33 @@ namespace Nz
 	          Integer: 0 is interpreted as false, any other value is interpreted as true
 	          String:  Conversion obeys the rule as described by String::ToBool
 	*/
-	bool ParameterList::GetBooleanParameter(const String& name, bool* value) const
+	bool ParameterList::GetBooleanParameter(const Name& name, bool* value) const
 	{
 		NazaraAssert(value, "Invalid pointer");
 
-		ErrorFlags flags(ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
+		ErrorFlags flags(ErrorFlag_Discard | ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
 
-		auto it = m_parameters.find(name);
-		if (it == m_parameters.end())
+		const Parameter* parameter = FindParameter(name);
+		if (!parameter)
 		{
-			NazaraError("Parameter \"" + name + "\" is not present");
+			NazaraError("Parameter \"" + String(name.GetString()) + "\" is not present");
 			return false;
 		}
 
-		switch (it->second.type)
+		switch (parameter->type)
 		{
 			case ParameterType_Boolean:
-				*value = it->second.value.boolVal;
+				*value = parameter->value.boolVal;
 				return true;
 
 			case ParameterType_Integer:
-				*value = (it->second.value.intVal != 0);
+				*value = (parameter->value.intVal != 0);
 				return true;
 
 			case ParameterType_String:
 			{
 				bool converted;
-				if (it->second.value.stringVal.ToBool(&converted, String::CaseInsensitive))
+				if (parameter->value.stringVal.ToBool(&converted, String::CaseInsensitive))
 				{
 					*value = converted;
 					return true;
@@ -115,23 +138,23 @@ namespace Nz
 	* \remark In case of failure, the variable pointed by value keep its value
 	* \remark If the parameter is not a color, the function fails
 	*/
-	bool ParameterList::GetColorParameter(const String& name, Color* value) const
+	bool ParameterList::GetColorParameter(const Name& name, Color* value) const
 	{
 		NazaraAssert(value, "Invalid pointer");
 
-		ErrorFlags flags(ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
+		ErrorFlags flags(ErrorFlag_Discard | ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
 
-		auto it = m_parameters.find(name);
-		if (it == m_parameters.end())
+		const Parameter* parameter = FindParameter(name);
+		if (!parameter)
 		{
-			NazaraError("Parameter \"" + name + "\" is not present");
+			NazaraError("Parameter \"" + String(name.GetString()) + "\" is not present");
 			return false;
 		}
 
-		switch (it->second.type)
+		switch (parameter->type)
 		{
 			case ParameterType_Color:
-				*value = it->second.value.colorVal;
+				*value = parameter->value.colorVal;
 				return true;
 
 			case ParameterType_Boolean:
@@ -161,33 +184,33 @@ namespace Nz
 	          Integer: The integer value is converted to its double representation
 	          String:  Conversion obeys the rule as described by String::ToDouble
 	*/
-	bool ParameterList::GetDoubleParameter(const String& name, double* value) const
+	bool ParameterList::GetDoubleParameter(const Name& name, double* value) const
 	{
 		NazaraAssert(value, "Invalid pointer");
 
-		ErrorFlags flags(ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
+		ErrorFlags flags(ErrorFlag_Discard | ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
 
-		auto it = m_parameters.find(name);
-		if (it == m_parameters.end())
+		const Parameter* parameter = FindParameter(name);
+		if (!parameter)
 		{
-			NazaraError("Parameter \"" + name + "\" is not present");
+			NazaraError("Parameter \"" + String(name.GetString()) + "\" is not present");
 			return false;
 		}
 
-		switch (it->second.type)
+		switch (parameter->type)
 		{
 			case ParameterType_Double:
-				*value = it->second.value.doubleVal;
+				*value = parameter->value.doubleVal;
 				return true;
 
 			case ParameterType_Integer:
-				*value = static_cast<double>(it->second.value.intVal);
+				*value = static_cast<double>(parameter->value.intVal);
 				return true;
 
 			case ParameterType_String:
 				{
 					double converted;
-					if (it->second.value.stringVal.ToDouble(&converted))
+					if (parameter->value.stringVal.ToDouble(&converted))
 					{
 						*value = converted;
 						return true;
@@ -222,37 +245,37 @@ namespace Nz
 	          Double:  The floating-point value is truncated and converted to a integer
 	          String:  Conversion obeys the rule as described by String::ToInteger
 	*/
-	bool ParameterList::GetIntegerParameter(const String& name, long long* value) const
+	bool ParameterList::GetIntegerParameter(const Name& name, long long* value) const
 	{
 		NazaraAssert(value, "Invalid pointer");
 
-		ErrorFlags flags(ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
+		ErrorFlags flags(ErrorFlag_Discard | ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
 
-		auto it = m_parameters.find(name);
-		if (it == m_parameters.end())
+		const Parameter* parameter = FindParameter(name);
+		if (!parameter)
 		{
-			NazaraError("Parameter \"" + name + "\" is not present");
+			NazaraError("Parameter \"" + String(name.GetString()) + "\" is not present");
 			return false;
 		}
 
-		switch (it->second.type)
+		switch (parameter->type)
 		{
 			case ParameterType_Boolean:
-				*value = (it->second.value.boolVal) ? 1 : 0;
+				*value = (parameter->value.boolVal) ? 1 : 0;
 				return true;
 
 			case ParameterType_Double:
-				*value = static_cast<long long>(it->second.value.doubleVal);
+				*value = static_cast<long long>(parameter->value.doubleVal);
 				return true;
 
 			case ParameterType_Integer:
-				*value = it->second.value.intVal;
+				*value = parameter->value.intVal;
 				return true;
 
 			case ParameterType_String:
 				{
 					long long converted;
-					if (it->second.value.stringVal.ToInteger(&converted))
+					if (parameter->value.stringVal.ToInteger(&converted))
 					{
 						*value = converted;
 						return true;
@@ -280,15 +303,15 @@ namespace Nz
 	*
 	* \remark type must be a valid pointer to a ParameterType variable
 	*/
-	bool ParameterList::GetParameterType(const String& name, ParameterType* type) const
+	bool ParameterList::GetParameterType(const Name& name, ParameterType* type) const
 	{
 		NazaraAssert(type, "Invalid pointer");
 
-		auto it = m_parameters.find(name);
-		if (it == m_parameters.end())
+		const Parameter* parameter = FindParameter(name);
+		if (!parameter)
 			return false;
 
-		*type = it->second.type;
+		*type = parameter->type;
 
 		return true;
 	}
@@ -305,27 +328,27 @@ namespace Nz
 	* \remark If the parameter is not a pointer, a conversion will be performed, compatibles types are:
 	          Userdata: The pointer part of the userdata is returned
 	*/
-	bool ParameterList::GetPointerParameter(const String& name, void** value) const
+	bool ParameterList::GetPointerParameter(const Name& name, void** value) const
 	{
 		NazaraAssert(value, "Invalid pointer");
 
-		ErrorFlags flags(ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
+		ErrorFlags flags(ErrorFlag_Discard | ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
 
-		auto it = m_parameters.find(name);
-		if (it == m_parameters.end())
+		const Parameter* parameter = FindParameter(name);
+		if (!parameter)
 		{
-			NazaraError("Parameter \"" + name + "\" is not present");
+			NazaraError("Parameter \"" + String(name.GetString()) + "\" is not present");
 			return false;
 		}
 
-		switch (it->second.type)
+		switch (parameter->type)
 		{
 			case ParameterType_Pointer:
-				*value = it->second.value.ptrVal;
+				*value = parameter->value.ptrVal;
 				return true;
 
 			case ParameterType_Userdata:
-				*value = it->second.value.userdataVal->ptr;
+				*value = parameter->value.userdataVal->ptr;
 				return true;
 
 			case ParameterType_Boolean:
@@ -359,47 +382,47 @@ namespace Nz
 	          Pointer:  Conversion obeys the rules of String::Pointer
 	          Userdata: Conversion obeys the rules of String::Pointer
 	*/
-	bool ParameterList::GetStringParameter(const String& name, String* value) const
+	bool ParameterList::GetStringParameter(const Name& name, String* value) const
 	{
 		NazaraAssert(value, "Invalid pointer");
 
-		ErrorFlags flags(ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
+		ErrorFlags flags(ErrorFlag_Discard | ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
 
-		auto it = m_parameters.find(name);
-		if (it == m_parameters.end())
+		const Parameter* parameter = FindParameter(name);
+		if (!parameter)
 		{
-			NazaraError("Parameter \"" + name + "\" is not present");
+			NazaraError("Parameter \"" + String(name.GetString()) + "\" is not present");
 			return false;
 		}
 
-		switch (it->second.type)
+		switch (parameter->type)
 		{
 			case ParameterType_Boolean:
-				*value = String::Boolean(it->second.value.boolVal);
+				*value = String::Boolean(parameter->value.boolVal);
 				return true;
 
 			case ParameterType_Color:
-				*value = it->second.value.colorVal.ToString();
+				*value = parameter->value.colorVal.ToString();
 				return true;
 
 			case ParameterType_Double:
-				*value = String::Number(it->second.value.doubleVal);
+				*value = String::Number(parameter->value.doubleVal);
 				return true;
 
 			case ParameterType_Integer:
-				*value = String::Number(it->second.value.intVal);
+				*value = String::Number(parameter->value.intVal);
 				return true;
 
 			case ParameterType_String:
-				*value = it->second.value.stringVal;
+				*value = parameter->value.stringVal;
 				return true;
 
 			case ParameterType_Pointer:
-				*value = String::Pointer(it->second.value.ptrVal);
+				*value = String::Pointer(parameter->value.ptrVal);
 				return true;
 
 			case ParameterType_Userdata:
-				*value = String::Pointer(it->second.value.userdataVal->ptr);
+				*value = String::Pointer(parameter->value.userdataVal->ptr);
 				return true;
 
 			case ParameterType_None:
@@ -424,22 +447,22 @@ namespace Nz
 	*
 	* \see GetPointerParameter
 	*/
-	bool ParameterList::GetUserdataParameter(const String& name, void** value) const
+	bool ParameterList::GetUserdataParameter(const Name& name, void** value) const
 	{
 		NazaraAssert(value, "Invalid pointer");
 
-		ErrorFlags flags(ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
+		ErrorFlags flags(ErrorFlag_Discard | ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
 
-		auto it = m_parameters.find(name);
-		if (it == m_parameters.end())
+		const Parameter* parameter = FindParameter(name);
+		if (!parameter)
 		{
-			NazaraError("Parameter \"" + name + "\" is not present");
+			NazaraError("Parameter \"" + String(name.GetString()) + "\" is not present");
 			return false;
 		}
 
-		if (it->second.type == ParameterType_Userdata)
+		if (parameter->type == ParameterType_Userdata)
 		{
-			*value = it->second.value.userdataVal->ptr;
+			*value = parameter->value.userdataVal->ptr;
 			return true;
 		}
 		else
@@ -449,15 +472,24 @@ namespace Nz
 		}
 	}
 
+	/*!
+	* \brief Gets the number of parameters
+	* \return Parameter count
+	*/
+	std::size_t ParameterList::GetParameterCount() const
+	{
+		return m_parameterCount;
+	}
+
 	/*!
 	* \brief Checks whether the parameter list contains a parameter named `name`
 	* \return true if found
 	*
 	* \param name Name of the parameter
 	*/
-	bool ParameterList::HasParameter(const String& name) const
+	bool ParameterList::HasParameter(const Name& name) const
 	{
-		return m_parameters.find(name) != m_parameters.end();
+		return FindParameter(name) != nullptr;
 	}
 
 	/*!
@@ -468,14 +500,37 @@ namespace Nz
 	*
 	* \param name Name of the parameter
 	*/
-	void ParameterList::RemoveParameter(const String& name)
+	void ParameterList::RemoveParameter(const Name& name)
 	{
-		auto it = m_parameters.find(name);
-		if (it != m_parameters.end())
+		std::size_t index = LowerBound(name.GetHash());
+		if (index < m_parameterCount && m_parameters[index].name == name)
+			EraseParameter(index);
+	}
+
+	/*!
+	* \brief Reserves room for parameters
+	*
+	* Lists holding more than a few parameters move them on the heap, reserving room beforehand avoids doing it several times
+	*
+	* \param parameterCount Number of parameters the list should be able to hold without growing
+	*/
+	void ParameterList::Reserve(std::size_t parameterCount)
+	{
+		if (parameterCount <= m_capacity)
+			return;
+
+		std::unique_ptr<ParameterStorage[]> storage(new ParameterStorage[parameterCount]);
+		Parameter* parameters = reinterpret_cast<Parameter*>(storage.get());
+
+		for (std::size_t i = 0; i < m_parameterCount; ++i)
 		{
-			DestroyValue(it->second);
-			m_parameters.erase(it);
+			PlacementNew(&parameters[i]);
+			MoveValue(parameters[i], m_parameters[i]);
 		}
+
+		m_heapParameters = std::move(storage);
+		m_parameters = parameters;
+		m_capacity = parameterCount;
 	}
 
 	/*!
@@ -485,7 +540,7 @@ namespace Nz
 	*
 	* \param name Name of the parameter
 	*/
-	void ParameterList::SetParameter(const String& name)
+	void ParameterList::SetParameter(const Name& name)
 	{
 		Parameter& parameter = CreateValue(name);
 		parameter.type = ParameterType_None;
@@ -499,7 +554,7 @@ namespace Nz
 	* \param name Name of the parameter
 	* \param value The color value
 	*/
-	void ParameterList::SetParameter(const String& name, const Color& value)
+	void ParameterList::SetParameter(const Name& name, const Color& value)
 	{
 		Parameter& parameter = CreateValue(name);
 		parameter.type = ParameterType_Color;
@@ -515,7 +570,7 @@ namespace Nz
 	* \param name Name of the parameter
 	* \param value The string value
 	*/
-	void ParameterList::SetParameter(const String& name, const String& value)
+	void ParameterList::SetParameter(const Name& name, const String& value)
 	{
 		Parameter& parameter = CreateValue(name);
 		parameter.type = ParameterType_String;
@@ -531,7 +586,7 @@ namespace Nz
 	* \param name Name of the parameter
 	* \param value The string value
 	*/
-	void ParameterList::SetParameter(const String& name, const char* value)
+	void ParameterList::SetParameter(const Name& name, const char* value)
 	{
 		Parameter& parameter = CreateValue(name);
 		parameter.type = ParameterType_String;
@@ -547,7 +602,7 @@ namespace Nz
 	* \param name Name of the parameter
 	* \param value The boolean value
 	*/
-	void ParameterList::SetParameter(const String& name, bool value)
+	void ParameterList::SetParameter(const Name& name, bool value)
 	{
 		Parameter& parameter = CreateValue(name);
 		parameter.type = ParameterType_Boolean;
@@ -562,7 +617,7 @@ namespace Nz
 	* \param name Name of the parameter
 	* \param value The double value
 	*/
-	void ParameterList::SetParameter(const String& name, double value)
+	void ParameterList::SetParameter(const Name& name, double value)
 	{
 		Parameter& parameter = CreateValue(name);
 		parameter.type = ParameterType_Double;
@@ -577,7 +632,7 @@ namespace Nz
 	* \param name Name of the parameter
 	* \param value The integer value
 	*/
-	void ParameterList::SetParameter(const String& name, long long value)
+	void ParameterList::SetParameter(const Name& name, long long value)
 	{
 		Parameter& parameter = CreateValue(name);
 		parameter.type = ParameterType_Integer;
@@ -595,7 +650,7 @@ namespace Nz
 	* \remark This sets a raw pointer, this class takes no responsibility toward it,
 	          if you wish to destroy the pointed variable along with the parameter list, you should set a userdata
 	*/
-	void ParameterList::SetParameter(const String& name, void* value)
+	void ParameterList::SetParameter(const Name& name, void* value)
 	{
 		Parameter& parameter = CreateValue(name);
 		parameter.type = ParameterType_Pointer;
@@ -611,39 +666,41 @@ namespace Nz
 		StringStream ss;
 
 		ss << "ParameterList(";
-		for (auto it = m_parameters.cbegin(); it != m_parameters.cend();)
+		for (std::size_t i = 0; i < m_parameterCount; ++i)
 		{
-			ss << it->first << ": ";
-			switch (it->second.type)
+			const Parameter& parameter = m_parameters[i];
+
+			if (i > 0)
+				ss << ", ";
+
+			ss << parameter.name.GetString() << ": ";
+			switch (parameter.type)
 			{
 				case ParameterType_Boolean:
-					ss << "Boolean(" << String::Boolean(it->second.value.boolVal) << ")";
+					ss << "Boolean(" << String::Boolean(parameter.value.boolVal) << ")";
 					break;
 				case ParameterType_Color:
-					ss << "Color(" << it->second.value.colorVal.ToString() << ")";
+					ss << "Color(" << parameter.value.colorVal.ToString() << ")";
 					break;
 				case ParameterType_Double:
-					ss << "Double(" << it->second.value.doubleVal << ")";
+					ss << "Double(" << parameter.value.doubleVal << ")";
 					break;
 				case ParameterType_Integer:
-					ss << "Integer(" << it->second.value.intVal << ")";
+					ss << "Integer(" << parameter.value.intVal << ")";
 					break;
 				case ParameterType_String:
-					ss << "String(" << it->second.value.stringVal << ")";
+					ss << "String(" << parameter.value.stringVal << ")";
 					break;
 				case ParameterType_Pointer:
-					ss << "Pointer(" << String::Pointer(it->second.value.ptrVal) << ")";
+					ss << "Pointer(" << String::Pointer(parameter.value.ptrVal) << ")";
 					break;
 				case ParameterType_Userdata:
-					ss << "Userdata(" << String::Pointer(it->second.value.userdataVal->ptr) << ")";
+					ss << "Userdata(" << String::Pointer(parameter.value.userdataVal->ptr) << ")";
 					break;
 				case ParameterType_None:
 					ss << "None";
 					break;
 			}
-
-			if (++it != m_parameters.cend())
-				ss << ", ";
 		}
 		ss << ")";
 
@@ -662,7 +719,7 @@ namespace Nz
 	* \remark The destructor is called once when all copies of the userdata are destroyed, which means
 	          you can safely copy the parameter list around.
 	*/
-	void ParameterList::SetParameter(const String& name, void* value, Destructor destructor)
+	void ParameterList::SetParameter(const Name& name, void* value, Destructor destructor)
 	{
 		Parameter& parameter = CreateValue(name);
 		parameter.type = ParameterType_Userdata;
@@ -677,38 +734,36 @@ namespace Nz
 	*/
 	ParameterList& ParameterList::operator=(const ParameterList& list)
 	{
+		if (this == &list)
+			return *this;
+
 		Clear();
+		Reserve(list.m_parameterCount);
 
-		for (auto it = list.m_parameters.begin(); it != list.m_parameters.end(); ++it)
+		// Both lists share the same order
+		for (std::size_t i = 0; i < list.m_parameterCount; ++i)
 		{
-			Parameter& parameter = m_parameters[it->first];
-
-			switch (it->second.type)
-			{
-				case ParameterType_Boolean:
-				case ParameterType_Color:
-				case ParameterType_Double:
-				case ParameterType_Integer:
-				case ParameterType_Pointer:
-					std::memcpy(&parameter, &it->second, sizeof(Parameter));
-					break;
-
-				case ParameterType_String:
-					parameter.type = ParameterType_String;
+			PlacementNew(&m_parameters[i]);
+			CopyValue(m_parameters[i], list.m_parameters[i]);
+		}
 
-					PlacementNew(&parameter.value.stringVal, it->second.value.stringVal);
-					break;
+		m_parameterCount = list.m_parameterCount;
 
-				case ParameterType_Userdata:
-					parameter.type = ParameterType_Userdata;
-					parameter.value.userdataVal = it->second.value.userdataVal;
-					++(parameter.value.userdataVal->counter);
-					break;
+		return *this;
+	}
 
-				case ParameterType_None:
-					parameter.type = ParameterType_None;
-					break;
-			}
+	/*!
+	* \brief Moves the content of the other parameter list to this
+	* \return A reference to this
+	*
+	* \param list List to move, left empty
+	*/
+	ParameterList& ParameterList::operator=(ParameterList&& list)
+	{
+		if (this != &list)
+		{
+			Clear();
+			MoveParameters(list);
 		}
 
 		return *this;
@@ -721,13 +776,31 @@ namespace Nz
 	*
 	* \remark The previous value if any gets destroyed
 	*/
-	ParameterList::Parameter& ParameterList::CreateValue(const String& name)
+	ParameterList::Parameter& ParameterList::CreateValue(const Name& name)
 	{
-		std::pair<ParameterMap::iterator, bool> pair = m_parameters.insert(std::make_pair(name, Parameter()));
-		Parameter& parameter = pair.first->second;
+		std::size_t index = LowerBound(name.GetHash());
+		if (index < m_parameterCount && m_parameters[index].name == name)
+		{
+			Parameter& parameter = m_parameters[index];
+			NazaraAssert(std::strcmp(parameter.name.GetString(), name.GetString()) == 0, "Parameters \"" + String(parameter.name.GetString()) + "\" and \"" + String(name.GetString()) + "\" share the same hash");
 
-		if (!pair.second)
 			DestroyValue(parameter);
+			return parameter;
+		}
+
+		if (m_parameterCount == m_capacity)
+			Reserve(m_capacity * 2);
+
+		// Make room for the parameter, keeping the array sorted
+		PlacementNew(&m_parameters[m_parameterCount]);
+		for (std::size_t i = m_parameterCount; i > index; --i)
+			MoveValue(m_parameters[i], m_parameters[i - 1]);
+
+		m_parameterCount++;
+
+		Parameter& parameter = m_parameters[index];
+		parameter.name = Name::Intern(name);
+		parameter.type = ParameterType_None;
 
 		return parameter;
 	}
@@ -765,6 +838,168 @@ namespace Nz
 				break;
 		}
 	}
+
+	/*!
+	* \brief Destroys a parameter and closes the gap it leaves
+	*
+	* \param index Index of the parameter
+	*/
+	void ParameterList::EraseParameter(std::size_t index)
+	{
+		DestroyValue(m_parameters[index]);
+
+		for (std::size_t i = index + 1; i < m_parameterCount; ++i)
+			MoveValue(m_parameters[i - 1], m_parameters[i]);
+
+		m_parameterCount--;
+	}
+
+	/*!
+	* \brief Looks for a parameter
+	* \return Pointer to the parameter or nullptr if the list doesn't hold it
+	*
+	* \param name Name of the parameter
+	*/
+	ParameterList::Parameter* ParameterList::FindParameter(const Name& name) const
+	{
+		std::size_t index = LowerBound(name.GetHash());
+		if (index < m_parameterCount && m_parameters[index].name == name)
+			return &m_parameters[index];
+
+		return nullptr;
+	}
+
+	/*!
+	* \brief Gets the index of the first parameter whose hash isn't lower than a hash
+	* \return Index where a parameter with this hash is or should be inserted
+	*
+	* \param hash Hash of the name
+	*/
+	std::size_t ParameterList::LowerBound(UInt64 hash) const
+	{
+		std::size_t first = 0;
+		std::size_t count = m_parameterCount;
+		while (count > 0)
+		{
+			std::size_t step = count / 2;
+			if (m_parameters[first + step].name.GetHash() < hash)
+			{
+				first += step + 1;
+				count -= step + 1;
+			}
+			else
+				count = step;
+		}
+
+		return first;
+	}
+
+	/*!
+	* \brief Takes the parameters of another list
+	*
+	* \param list List to take the parameters from, left empty
+	*
+	* \remark This list must be empty
+	*/
+	void ParameterList::MoveParameters(ParameterList& list)
+	{
+		NazaraAssert(m_parameterCount == 0, "List must be empty");
+
+		if (list.m_heapParameters)
+		{
+			// Heap storage is stolen as a whole
+			m_heapParameters = std::move(list.m_heapParameters);
+			m_parameters = list.m_parameters;
+			m_capacity = list.m_capacity;
+			m_parameterCount = list.m_parameterCount;
+
+			list.m_parameters = reinterpret_cast<Parameter*>(list.m_inlineParameters);
+			list.m_capacity = InlineCapacity;
+		}
+		else
+		{
+			for (std::size_t i = 0; i < list.m_parameterCount; ++i)
+			{
+				PlacementNew(&m_parameters[i]);
+				MoveValue(m_parameters[i], list.m_parameters[i]);
+			}
+
+			m_parameterCount = list.m_parameterCount;
+		}
+
+		list.m_parameterCount = 0;
+	}
+
+	/*!
+	* \brief Copies a parameter into another one
+	*
+	* \param dst Parameter without value, receiving the copy
+	* \param src Parameter to copy
+	*/
+	void ParameterList::CopyValue(Parameter& dst, const Parameter& src)
+	{
+		dst.name = src.name;
+		dst.type = src.type;
+
+		switch (src.type)
+		{
+			case ParameterType_Boolean:
+			case ParameterType_Color:
+			case ParameterType_Double:
+			case ParameterType_Integer:
+			case ParameterType_Pointer:
+				std::memcpy(&dst.value, &src.value, sizeof(Parameter::Value));
+				break;
+
+			case ParameterType_String:
+				PlacementNew(&dst.value.stringVal, src.value.stringVal);
+				break;
+
+			case ParameterType_Userdata:
+				dst.value.userdataVal = src.value.userdataVal;
+				++(dst.value.userdataVal->counter);
+				break;
+
+			case ParameterType_None:
+				break;
+		}
+	}
+
+	/*!
+	* \brief Moves a parameter into another one
+	*
+	* \param dst Parameter without value, receiving the parameter
+	* \param src Parameter to move, left without value
+	*/
+	void ParameterList::MoveValue(Parameter& dst, Parameter& src)
+	{
+		dst.name = src.name;
+		dst.type = src.type;
+
+		switch (src.type)
+		{
+			case ParameterType_Boolean:
+			case ParameterType_Color:
+			case ParameterType_Double:
+			case ParameterType_Integer:
+			case ParameterType_Pointer:
+			case ParameterType_Userdata:
+				std::memcpy(&dst.value, &src.value, sizeof(Parameter::Value));
+				break;
+
+			case ParameterType_String:
+				PlacementNew(&dst.value.stringVal, std::move(src.value.stringVal));
+				src.value.stringVal.~String();
+				break;
+
+			case ParameterType_None:
+				break;
+		}
+
+		src.type = ParameterType_None;
+	}
+
+	constexpr std::size_t ParameterList::InlineCapacity;
 }
 
 /*!
@@ -3,19 +3,40 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Core/Posix/DirectoryImpl.hpp>
+#include <Nazara/Core/CallOnExit.hpp>
 #include <Nazara/Core/Directory.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/MemoryHelper.hpp>
 #include <Nazara/Core/String.hpp>
 #include <cstring>
 #include <errno.h>
+#include <fcntl.h>
 #include <sys/param.h>
 #include <sys/stat.h>
+#include <sys/syscall.h>
 #include <unistd.h>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
 {
+	namespace
+	{
+		// Layout of the records returned by the getdents64 syscall, which glibc doesn't always declare
+		struct LinuxDirent64
+		{
+			UInt64 d_ino;
+			Int64 d_off;
+			unsigned short d_reclen;
+			unsigned char d_type;
+			char d_name[1];
+		};
+
+		UInt64 GetStamp(const struct stat64& stats)
+		{
+			return static_cast<UInt64>(stats.st_mtim.tv_sec) * 1000000000ULL + static_cast<UInt64>(stats.st_mtim.tv_nsec);
+		}
+	}
+
 	DirectoryImpl::DirectoryImpl(const Directory* parent) :
 	m_parent(parent)
 	{
@@ -53,9 +74,15 @@ namespace Nz
 
 	bool DirectoryImpl::IsResultDirectory() const
 	{
-		//TODO: Fix d_type handling (field can be missing or be a symbolic link, both cases which must be handled by calling stat)
+		if (m_result->d_type != DT_UNKNOWN && m_result->d_type != DT_LNK)
+			return m_result->d_type == DT_DIR;
+
+		// Some file systems don't fill the type, and symbolic links have to be followed
+		struct stat64 results;
+		if (fstatat64(dirfd(m_handle), m_result->d_name, &results, 0) != 0)
+			return false;
 
-		return m_result->d_type == DT_DIR;
+		return S_ISDIR(results.st_mode);
 	}
 
 	bool DirectoryImpl::NextResult()
@@ -111,6 +138,94 @@ namespace Nz
 		return currentPath;
 	}
 
+	bool DirectoryImpl::GetModificationStamp(const String& dirPath, UInt64* stamp)
+	{
+		struct stat64 stats;
+		if (stat64(dirPath.GetConstBuffer(), &stats) != 0)
+			return false;
+
+		*stamp = GetStamp(stats);
+		return true;
+	}
+
+	bool DirectoryImpl::List(const String& dirPath, std::vector<DirectoryEntry>* entries, UInt64* stamp)
+	{
+		int fd = open(dirPath.GetConstBuffer(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+		if (fd == -1)
+		{
+			NazaraError("Unable to open directory: " + Error::GetLastSystemError());
+			return false;
+		}
+
+		CallOnExit closeOnExit([fd]() { close(fd); });
+
+		// The stamp is read first, a change happening while we are listing will be noticed by the next scan
+		struct stat64 stats;
+		if (fstat64(fd, &stats) != 0)
+		{
+			NazaraError("Unable to get directory information: " + Error::GetLastSystemError());
+			return false;
+		}
+
+		*stamp = GetStamp(stats);
+
+		// Entries are read by large batches, instead of one by one as readdir does
+		alignas(LinuxDirent64) char buffer[32 * 1024];
+		for (;;)
+		{
+			long readBytes = syscall(SYS_getdents64, fd, buffer, sizeof(buffer));
+			if (readBytes == 0)
+				break;
+
+			if (readBytes < 0)
+			{
+				NazaraError("Unable to read directory entries: " + Error::GetLastSystemError());
+				return false;
+			}
+
+			for (long offset = 0; offset < readBytes;)
+			{
+				const LinuxDirent64* record = reinterpret_cast<const LinuxDirent64*>(&buffer[offset]);
+				offset += record->d_reclen;
+
+				const char* name = record->d_name;
+				if (name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0')))
+					continue;
+
+				// Size and write time require a stat anyway, which also resolves the type when the file system doesn't give it
+				if (fstatat64(fd, name, &stats, 0) != 0)
+				{
+					if (record->d_type != DT_LNK)
+						continue; // Removed since we read the directory
+
+					// Dangling link, reported as a file of its own
+					if (fstatat64(fd, name, &stats, AT_SYMLINK_NOFOLLOW) != 0)
+						continue;
+				}
+
+				DirectoryEntry entry;
+				entry.path.Reserve(dirPath.GetSize() + 1 + std::strlen(name));
+				entry.path += dirPath;
+				entry.path += NAZARA_DIRECTORY_SEPARATOR;
+				entry.path += name;
+				entry.isDirectory = S_ISDIR(stats.st_mode);
+				entry.isLink = (record->d_type == DT_LNK);
+				entry.lastWriteTime = stats.st_mtime;
+				entry.size = (entry.isDirectory) ? 0 : static_cast<UInt64>(stats.st_size);
+
+				if (record->d_type == DT_UNKNOWN)
+				{
+					struct stat64 linkStats;
+					entry.isLink = (fstatat64(fd, name, &linkStats, AT_SYMLINK_NOFOLLOW) == 0 && S_ISLNK(linkStats.st_mode));
+				}
+
+				entries->emplace_back(std::move(entry));
+			}
+		}
+
+		return true;
+	}
+
 	bool DirectoryImpl::Remove(const String& dirPath)
 	{
 		bool success = rmdir(dirPath.GetConstBuffer()) != -1;
@@ -4,6 +4,9 @@
 
 #include <Nazara/Core/Posix/FileImpl.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
 #include <fcntl.h>
 #include <sys/stat.h>
 #include <unistd.h>
@@ -25,6 +28,12 @@ namespace Nz
 			close(m_fileDescriptor);
 	}
 
+	bool FileImpl::EnableAsync()
+	{
+		// pread/pwrite don't use the file offset, the descriptor can be shared with the I/O threads
+		return true;
+	}
+
 	bool FileImpl::EndOfFile() const
 	{
 		if (!m_endOfFileUpdated)
@@ -52,6 +61,16 @@ namespace Nz
 		return static_cast<UInt64>(position);
 	}
 
+	std::size_t FileImpl::GetIOAlignment() const
+	{
+		// The preferred block size is a multiple of the logical block size direct I/O requires
+		struct stat64 fileStats;
+		if (fstat64(m_fileDescriptor, &fileStats) == -1 || fileStats.st_blksize <= 0)
+			return 4096;
+
+		return std::max<std::size_t>(fileStats.st_blksize, 512);
+	}
+
 	bool FileImpl::Open(const String& filePath, OpenModeFlags mode)
 	{
 		int flags;
@@ -75,7 +94,22 @@ namespace Nz
 		if (mode & OpenMode_Truncate)
 			flags |= O_TRUNC;
 
+		#ifdef O_DIRECT
+		if (mode & OpenMode_Unbuffered)
+			flags |= O_DIRECT;
+		#endif
+
 		m_fileDescriptor = open64(filePath.GetConstBuffer(), flags, permissions);
+
+		#ifdef O_DIRECT
+		// Some filesystems (as tmpfs) don't allow direct I/O, use the system cache with them
+		if (m_fileDescriptor == -1 && errno == EINVAL && (flags & O_DIRECT))
+			m_fileDescriptor = open64(filePath.GetConstBuffer(), flags & ~O_DIRECT, permissions);
+		#elif defined(F_NOCACHE)
+		if (m_fileDescriptor != -1 && (mode & OpenMode_Unbuffered))
+			fcntl(m_fileDescriptor, F_NOCACHE, 1);
+		#endif
+
 		if (m_fileDescriptor == -1)
 		{
 			NazaraError("Failed to open \"" + filePath + "\" : " + Error::GetLastSystemError());
@@ -138,6 +172,33 @@ namespace Nz
 			return 0;
 	}
 
+	bool FileImpl::ReadAt(UInt64 offset, void* buffer, std::size_t size, std::size_t* read)
+	{
+		UInt8* ptr = static_cast<UInt8*>(buffer);
+
+		std::size_t totalRead = 0;
+		while (totalRead < size)
+		{
+			ssize_t bytes = pread64(m_fileDescriptor, ptr + totalRead, size - totalRead, static_cast<off64_t>(offset + totalRead));
+			if (bytes == -1)
+			{
+				if (errno == EINTR)
+					continue;
+
+				*read = totalRead;
+				return false;
+			}
+
+			if (bytes == 0)
+				break; // End of file
+
+			totalRead += static_cast<std::size_t>(bytes);
+		}
+
+		*read = totalRead;
+		return true;
+	}
+
 	bool FileImpl::SetCursorPos(CursorPosition pos, Int64 offset)
 	{
 		int moveMethod;
@@ -178,6 +239,43 @@ namespace Nz
 		return written;
 	}
 
+	bool FileImpl::WriteAt(UInt64 offset, const void* buffer, std::size_t size, std::size_t* written)
+	{
+		const UInt8* ptr = static_cast<const UInt8*>(buffer);
+
+		std::size_t totalWritten = 0;
+		while (totalWritten < size)
+		{
+			ssize_t bytes = pwrite64(m_fileDescriptor, ptr + totalWritten, size - totalWritten, static_cast<off64_t>(offset + totalWritten));
+			if (bytes == -1)
+			{
+				if (errno == EINTR)
+					continue;
+
+				*written = totalWritten;
+				return false;
+			}
+
+			totalWritten += static_cast<std::size_t>(bytes);
+		}
+
+		*written = totalWritten;
+		return true;
+	}
+
+	String FileImpl::CanonicalPath(const String& filePath)
+	{
+		// Resolves the symbolic links, the path is kept as is if the file doesn't exist
+		char* resolvedPath = realpath(filePath.GetConstBuffer(), nullptr);
+		if (!resolvedPath)
+			return filePath;
+
+		String path(resolvedPath);
+		std::free(resolvedPath);
+
+		return path;
+	}
+
 	bool FileImpl::Copy(const String& sourcePath, const String& targetPath)
 	{
 		int fd1 = open64(sourcePath.GetConstBuffer(), O_RDONLY);
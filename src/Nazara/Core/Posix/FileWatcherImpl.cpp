@@ -0,0 +1,157 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Posix/FileWatcherImpl.hpp>
+#include <Nazara/Core/Directory.hpp>
+#include <Nazara/Core/Error.hpp>
+
+#ifdef NAZARA_PLATFORM_LINUX
+	#include <sys/inotify.h>
+	#include <unistd.h>
+	#include <cerrno>
+#endif
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	#ifdef NAZARA_PLATFORM_LINUX
+	namespace
+	{
+		constexpr UInt32 fileEvents = IN_CLOSE_WRITE | IN_MOVED_TO;
+	}
+
+	FileWatcherImpl::FileWatcherImpl()
+	{
+		m_handle = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		if (m_handle == -1)
+			NazaraError("Failed to create inotify instance: " + Error::GetLastSystemError());
+	}
+
+	FileWatcherImpl::~FileWatcherImpl()
+	{
+		if (m_handle != -1)
+			close(m_handle);
+	}
+
+	bool FileWatcherImpl::IsValid() const
+	{
+		return m_handle != -1;
+	}
+
+	void FileWatcherImpl::Poll(std::vector<String>* changedFiles)
+	{
+		alignas(inotify_event) char buffer[4096];
+		for (;;)
+		{
+			ssize_t length = read(m_handle, buffer, sizeof(buffer));
+			if (length <= 0)
+			{
+				if (length == -1 && errno != EAGAIN)
+					NazaraError("Failed to read inotify events: " + Error::GetLastSystemError());
+
+				break;
+			}
+
+			for (char* ptr = buffer; ptr < buffer + length;)
+			{
+				const inotify_event* event = reinterpret_cast<const inotify_event*>(ptr);
+				ptr += sizeof(inotify_event) + event->len;
+
+				auto it = m_watches.find(event->wd);
+				if (it == m_watches.end())
+					continue;
+
+				if (event->mask & IN_IGNORED)
+				{
+					// The directory was removed
+					m_watches.erase(it);
+					continue;
+				}
+
+				if (event->len == 0)
+					continue;
+
+				String path = it->second.path + NAZARA_DIRECTORY_SEPARATOR + event->name;
+				if (event->mask & IN_ISDIR)
+				{
+					// New subdirectories of recursive watches are watched as well
+					if (it->second.recursive && (event->mask & (IN_CREATE | IN_MOVED_TO)))
+						Watch(path, true);
+				}
+				else if (event->mask & fileEvents)
+					changedFiles->push_back(std::move(path));
+			}
+		}
+	}
+
+	void FileWatcherImpl::Unwatch(const String& directoryPath)
+	{
+		String subdirectoryPrefix = directoryPath + NAZARA_DIRECTORY_SEPARATOR;
+		for (auto it = m_watches.begin(); it != m_watches.end();)
+		{
+			if (it->second.path == directoryPath || it->second.path.StartsWith(subdirectoryPrefix))
+			{
+				inotify_rm_watch(m_handle, it->first);
+				it = m_watches.erase(it);
+			}
+			else
+				++it;
+		}
+	}
+
+	bool FileWatcherImpl::Watch(const String& directoryPath, bool recursive)
+	{
+		int watch = inotify_add_watch(m_handle, directoryPath.GetConstBuffer(), fileEvents | ((recursive) ? IN_CREATE : 0));
+		if (watch == -1)
+		{
+			NazaraError("Failed to watch directory \"" + directoryPath + "\": " + Error::GetLastSystemError());
+			return false;
+		}
+
+		m_watches[watch] = WatchedDirectory{directoryPath, recursive};
+
+		if (recursive)
+		{
+			Directory directory(directoryPath);
+			if (directory.Open())
+			{
+				while (directory.NextResult())
+				{
+					if (directory.IsResultDirectory())
+						Watch(directory.GetResultPath(), true);
+				}
+			}
+		}
+
+		return true;
+	}
+	#else
+	FileWatcherImpl::FileWatcherImpl() :
+	m_handle(-1)
+	{
+		NazaraError("File watching is not supported on this platform");
+	}
+
+	FileWatcherImpl::~FileWatcherImpl() = default;
+
+	bool FileWatcherImpl::IsValid() const
+	{
+		return false;
+	}
+
+	void FileWatcherImpl::Poll(std::vector<String>* /*changedFiles*/)
+	{
+	}
+
+	void FileWatcherImpl::Unwatch(const String& /*directoryPath*/)
+	{
+	}
+
+	bool FileWatcherImpl::Watch(const String& /*directoryPath*/, bool /*recursive*/)
+	{
+		return false;
+	}
+	#endif
+}
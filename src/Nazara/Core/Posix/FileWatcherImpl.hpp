@@ -0,0 +1,48 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_FILEWATCHERIMPL_HPP
+#define NAZARA_FILEWATCHERIMPL_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/String.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace Nz
+{
+	class FileWatcherImpl
+	{
+		public:
+			FileWatcherImpl();
+			FileWatcherImpl(const FileWatcherImpl&) = delete;
+			FileWatcherImpl(FileWatcherImpl&&) = delete;
+			~FileWatcherImpl();
+
+			bool IsValid() const;
+
+			void Poll(std::vector<String>* changedFiles);
+
+			void Unwatch(const String& directoryPath);
+
+			bool Watch(const String& directoryPath, bool recursive);
+
+			FileWatcherImpl& operator=(const FileWatcherImpl&) = delete;
+			FileWatcherImpl& operator=(FileWatcherImpl&&) = delete;
+
+		private:
+			struct WatchedDirectory
+			{
+				String path;
+				bool recursive;
+			};
+
+			std::unordered_map<int, WatchedDirectory> m_watches;
+			int m_handle;
+	};
+}
+
+#endif // NAZARA_FILEWATCHERIMPL_HPP
@@ -3,11 +3,71 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Core/Posix/HardwareInfoImpl.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
 #include <unistd.h>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
 {
+	namespace
+	{
+		bool ReadSysValue(const char* path, char* buffer, std::size_t bufferSize)
+		{
+			std::FILE* file = std::fopen(path, "r");
+			if (!file)
+				return false;
+
+			bool succeeded = (std::fgets(buffer, static_cast<int>(bufferSize), file) != nullptr);
+			std::fclose(file);
+
+			if (succeeded)
+				buffer[std::strcspn(buffer, "\n")] = '\0';
+
+			return succeeded;
+		}
+
+		bool ReadSysUInt(const char* path, unsigned int* value)
+		{
+			char buffer[32];
+			if (!ReadSysValue(path, buffer, sizeof(buffer)))
+				return false;
+
+			*value = static_cast<unsigned int>(std::strtoul(buffer, nullptr, 10));
+			return true;
+		}
+
+		template<typename F>
+		void ParseCpuList(const char* list, F&& callback)
+		{
+			// Lists look like "0-3,8-11"
+			const char* ptr = list;
+			while (*ptr)
+			{
+				char* end;
+				unsigned long first = std::strtoul(ptr, &end, 10);
+				if (end == ptr)
+					break;
+
+				unsigned long last = first;
+				if (*end == '-')
+				{
+					ptr = end + 1;
+					last = std::strtoul(ptr, &end, 10);
+				}
+
+				for (unsigned long cpu = first; cpu <= last; ++cpu)
+					callback(static_cast<unsigned int>(cpu));
+
+				ptr = (*end == ',') ? end + 1 : end;
+				if (end == ptr && *ptr != '\0')
+					break;
+			}
+		}
+	}
+
 	void HardwareInfoImpl::Cpuid(UInt32 functionId, UInt32 subFunctionId, UInt32 registers[4])
 	{
 	#if defined(NAZARA_COMPILER_CLANG) || defined(NAZARA_COMPILER_GCC) || defined(NAZARA_COMPILER_INTEL)
@@ -38,6 +98,94 @@ namespace Nz
 		return sysconf(_SC_NPROCESSORS_CONF);
 	}
 
+	bool HardwareInfoImpl::GetProcessorTopology(std::vector<LogicalProcessor>* processors, UInt64 cacheSizes[3])
+	{
+	#if defined(NAZARA_PLATFORM_LINUX)
+		char path[128];
+
+		// Core identifiers are only unique inside a package, HardwareInfo combines them with the package identifier
+		unsigned int processorCount = GetProcessorCount();
+		processors->resize(processorCount);
+		for (unsigned int i = 0; i < processorCount; ++i)
+		{
+			LogicalProcessor& processor = (*processors)[i];
+			processor.nodeId = 0;
+			processor.smtIndex = 0;
+
+			std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/topology/core_id", i);
+			if (!ReadSysUInt(path, &processor.coreId))
+				return false;
+
+			std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/topology/physical_package_id", i);
+			if (!ReadSysUInt(path, &processor.packageId))
+				processor.packageId = 0;
+		}
+
+		// NUMA nodes list their processors, machines without NUMA support don't have this directory
+		if (DIR* nodeDir = opendir("/sys/devices/system/node"))
+		{
+			while (dirent* entry = readdir(nodeDir))
+			{
+				unsigned int nodeId;
+				if (std::sscanf(entry->d_name, "node%u", &nodeId) != 1)
+					continue;
+
+				char cpuList[1024];
+				std::snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/cpulist", nodeId);
+				if (!ReadSysValue(path, cpuList, sizeof(cpuList)))
+					continue;
+
+				ParseCpuList(cpuList, [&](unsigned int cpu)
+				{
+					if (cpu < processorCount)
+						(*processors)[cpu].nodeId = nodeId;
+				});
+			}
+
+			closedir(nodeDir);
+		}
+
+		// Caches of the first processor, which are the same for the others on most machines
+		for (unsigned int i = 0; i < 3; ++i)
+			cacheSizes[i] = 0;
+
+		for (unsigned int index = 0;; ++index)
+		{
+			unsigned int level;
+			std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu0/cache/index%u/level", index);
+			if (!ReadSysUInt(path, &level))
+				break;
+
+			char type[32];
+			std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu0/cache/index%u/type", index);
+			if (level < 1 || level > 3 || !ReadSysValue(path, type, sizeof(type)) || std::strcmp(type, "Instruction") == 0)
+				continue;
+
+			char size[32];
+			std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu0/cache/index%u/size", index);
+			if (!ReadSysValue(path, size, sizeof(size)))
+				continue;
+
+			// Sizes look like "32K" or "8M"
+			char* unit;
+			UInt64 cacheSize = std::strtoull(size, &unit, 10);
+			if (*unit == 'K')
+				cacheSize *= 1024;
+			else if (*unit == 'M')
+				cacheSize *= 1024 * 1024;
+
+			cacheSizes[level - 1] = cacheSize;
+		}
+
+		return true;
+	#else
+		NazaraUnused(processors);
+		NazaraUnused(cacheSizes);
+
+		return false;
+	#endif
+	}
+
 	UInt64 HardwareInfoImpl::GetTotalMemory()
 	{
 		UInt64 pages = sysconf(_SC_PHYS_PAGES);
@@ -75,4 +223,17 @@ namespace Nz
 		#endif
 	#endif
 	}
+
+	UInt64 HardwareInfoImpl::Xgetbv(UInt32 index)
+	{
+	#if defined(NAZARA_COMPILER_CLANG) || defined(NAZARA_COMPILER_GCC) || defined(NAZARA_COMPILER_INTEL)
+		UInt32 eax, edx;
+		asm volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(index));
+
+		return (static_cast<UInt64>(edx) << 32) | eax;
+	#else
+		NazaraInternalError("Xgetbv has been called although it is not supported");
+		return 0;
+	#endif
+	}
 }
@@ -0,0 +1,84 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Posix/LargePageMemoryImpl.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <sys/mman.h>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	void* LargePageMemoryImpl::Allocate(std::size_t size, bool* largePages)
+	{
+		#ifdef MAP_HUGETLB
+		// Explicit huge pages only exist if the administrator reserved some (vm.nr_hugepages)
+		void* hugePages = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+		if (hugePages != MAP_FAILED)
+		{
+			*largePages = true;
+			return hugePages;
+		}
+		#endif
+
+		// Transparent huge pages need a range aligned on the huge page size, so we map more and trim the excess
+		std::size_t pageSize = GetLargePageSize();
+		void* mapping = mmap(nullptr, size + pageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (mapping == MAP_FAILED)
+			return nullptr;
+
+		std::uintptr_t mappingBegin = reinterpret_cast<std::uintptr_t>(mapping);
+		std::uintptr_t alignedBegin = (mappingBegin + pageSize - 1) & ~std::uintptr_t(pageSize - 1);
+
+		if (alignedBegin > mappingBegin)
+			munmap(mapping, alignedBegin - mappingBegin);
+
+		std::uintptr_t mappingEnd = mappingBegin + size + pageSize;
+		if (mappingEnd > alignedBegin + size)
+			munmap(reinterpret_cast<void*>(alignedBegin + size), mappingEnd - (alignedBegin + size));
+
+		void* ptr = reinterpret_cast<void*>(alignedBegin);
+
+		#ifdef MADV_HUGEPAGE
+		*largePages = (madvise(ptr, size, MADV_HUGEPAGE) == 0);
+		#else
+		*largePages = false;
+		#endif
+
+		return ptr;
+	}
+
+	void LargePageMemoryImpl::Free(void* ptr, std::size_t size)
+	{
+		munmap(ptr, size);
+	}
+
+	std::size_t LargePageMemoryImpl::GetLargePageSize()
+	{
+		std::size_t largePageSize = 0;
+
+		// Default huge page size, as "Hugepagesize:    2048 kB"
+		if (std::FILE* file = std::fopen("/proc/meminfo", "r"))
+		{
+			char line[256];
+			while (std::fgets(line, sizeof(line), file))
+			{
+				unsigned long long sizeKiB;
+				if (std::sscanf(line, "Hugepagesize: %llu kB", &sizeKiB) == 1)
+				{
+					largePageSize = static_cast<std::size_t>(sizeKiB * 1024);
+					break;
+				}
+			}
+
+			std::fclose(file);
+		}
+
+		// The page size must be a power of two for the alignment
+		if ((largePageSize & (largePageSize - 1)) != 0)
+			largePageSize = 0;
+
+		return largePageSize;
+	}
+}
@@ -0,0 +1,80 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Posix/MappedFileImpl.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/String.hpp>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	MappedFileImpl::MappedFileImpl() :
+	m_data(nullptr),
+	m_size(0)
+	{
+	}
+
+	void MappedFileImpl::Close()
+	{
+		if (m_data)
+		{
+			munmap(m_data, m_size);
+			m_data = nullptr;
+		}
+
+		m_size = 0;
+	}
+
+	const UInt8* MappedFileImpl::GetData() const
+	{
+		return static_cast<const UInt8*>(m_data);
+	}
+
+	UInt64 MappedFileImpl::GetSize() const
+	{
+		return m_size;
+	}
+
+	bool MappedFileImpl::Open(const String& filePath)
+	{
+		int fileDescriptor = open64(filePath.GetConstBuffer(), O_RDONLY);
+		if (fileDescriptor == -1)
+		{
+			NazaraError("Failed to open \"" + filePath + "\": " + Error::GetLastSystemError());
+			return false;
+		}
+
+		struct stat64 fileInfo;
+		if (fstat64(fileDescriptor, &fileInfo) == -1)
+		{
+			NazaraError("Failed to get size of \"" + filePath + "\": " + Error::GetLastSystemError());
+			close(fileDescriptor);
+			return false;
+		}
+
+		m_size = static_cast<std::size_t>(fileInfo.st_size);
+
+		// Empty files can't be mapped, there is nothing to read anyway
+		if (m_size > 0)
+		{
+			void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+			if (data == MAP_FAILED)
+			{
+				NazaraError("Failed to map \"" + filePath + "\": " + Error::GetLastSystemError());
+				close(fileDescriptor);
+				return false;
+			}
+
+			m_data = data;
+		}
+
+		// The mapping keeps its own reference to the file
+		close(fileDescriptor);
+		return true;
+	}
+}
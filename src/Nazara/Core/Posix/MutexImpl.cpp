@@ -3,6 +3,8 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Core/Posix/MutexImpl.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <sched.h>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
@@ -23,6 +25,21 @@ namespace Nz
 
 	void MutexImpl::Lock()
 	{
+		#if NAZARA_CORE_POSIX_MUTEX_SPINLOCKS > 0
+		// Critical sections are usually short, spinning a bit avoids putting the thread to sleep (like Windows critical sections do)
+		for (unsigned int i = 0; i < NAZARA_CORE_POSIX_MUTEX_SPINLOCKS; ++i)
+		{
+			if (pthread_mutex_trylock(&m_handle) == 0)
+				return;
+
+			#if defined(__i386__) || defined(__x86_64__)
+			__builtin_ia32_pause();
+			#else
+			sched_yield();
+			#endif
+		}
+		#endif
+
 		pthread_mutex_lock(&m_handle);
 	}
 
@@ -0,0 +1,49 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Posix/ReadWriteLockImpl.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	ReadWriteLockImpl::ReadWriteLockImpl()
+	{
+		pthread_rwlock_init(&m_handle, nullptr);
+	}
+
+	ReadWriteLockImpl::~ReadWriteLockImpl()
+	{
+		pthread_rwlock_destroy(&m_handle);
+	}
+
+	void ReadWriteLockImpl::LockRead()
+	{
+		pthread_rwlock_rdlock(&m_handle);
+	}
+
+	void ReadWriteLockImpl::LockWrite()
+	{
+		pthread_rwlock_wrlock(&m_handle);
+	}
+
+	bool ReadWriteLockImpl::TryLockRead()
+	{
+		return pthread_rwlock_tryrdlock(&m_handle) == 0;
+	}
+
+	bool ReadWriteLockImpl::TryLockWrite()
+	{
+		return pthread_rwlock_trywrlock(&m_handle) == 0;
+	}
+
+	void ReadWriteLockImpl::UnlockRead()
+	{
+		pthread_rwlock_unlock(&m_handle);
+	}
+
+	void ReadWriteLockImpl::UnlockWrite()
+	{
+		pthread_rwlock_unlock(&m_handle);
+	}
+}
@@ -0,0 +1,32 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_READWRITELOCKIMPL_HPP
+#define NAZARA_READWRITELOCKIMPL_HPP
+
+#include <pthread.h>
+
+namespace Nz
+{
+	class ReadWriteLockImpl
+	{
+		public:
+			ReadWriteLockImpl();
+			~ReadWriteLockImpl();
+
+			void LockRead();
+			void LockWrite();
+			bool TryLockRead();
+			bool TryLockWrite();
+			void UnlockRead();
+			void UnlockWrite();
+
+		private:
+			pthread_rwlock_t m_handle;
+	};
+}
+
+#endif // NAZARA_READWRITELOCKIMPL_HPP
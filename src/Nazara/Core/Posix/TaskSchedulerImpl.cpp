@@ -3,12 +3,19 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Core/Posix/TaskSchedulerImpl.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/Functor.hpp>
+#include <Nazara/Core/Profiler.hpp>
+#include <Nazara/Core/String.hpp>
+#include <Nazara/Core/TaskGroup.hpp>
+#include <Nazara/Core/Thread.hpp>
+#include <cstdint>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
 {
-	bool TaskSchedulerImpl::Initialize(unsigned int workerCount)
+	bool TaskSchedulerImpl::Initialize(std::size_t workerCount, const WorkerPlacement* placements)
 	{
 		if (IsInitialized())
 			return true; // Déjà initialisé
@@ -22,47 +29,80 @@ namespace Nz
 		#endif
 
 		s_workerCount = workerCount;
-		s_isDone = false;
-		s_isWaiting = false;
+		s_nextWorker = 0;
+		s_queuedTaskCount = 0;
+		s_remainingTaskCount = 0;
 		s_shouldFinish = false;
 
 		s_threads.reset(new pthread_t[workerCount]);
+		s_workers.reset(new Worker[workerCount]);
 
-		// On initialise les conditions variables, mutex et barrière.
-		pthread_cond_init(&s_cvEmpty, nullptr);
-		pthread_cond_init(&s_cvNotEmpty, nullptr);
-		pthread_mutex_init(&s_mutexQueue, nullptr);
-		pthread_barrier_init(&s_barrier, nullptr, workerCount + 1);
+		// On initialise les conditions variables et mutex, globaux et de chaque worker
+		pthread_cond_init(&s_cvDone, nullptr);
+		pthread_cond_init(&s_cvWork, nullptr);
+		pthread_mutex_init(&s_mutexState, nullptr);
 
-		for (unsigned int i = 0; i < s_workerCount; ++i)
+		for (std::size_t i = 0; i < s_workerCount; ++i)
 		{
-			// Le thread va se lancer, attendre que tous se créent et attendre d'être réveillé.
-			pthread_create(&s_threads[i], nullptr, WorkerProc, nullptr);
+			Worker& worker = s_workers[i];
+			worker.pinned = (placements != nullptr);
+			worker.processor = (placements) ? placements[i].processor : 0;
+			worker.workCount = 0;
+			pthread_mutex_init(&worker.queueMutex, nullptr);
 		}
 
-		pthread_barrier_wait(&s_barrier); // On attend que les enfants soient bien créés.
+		BuildStealOrders(placements);
+
+		// Les workers s'endorment d'eux-mêmes tant qu'aucune tâche n'est disponible
+		for (std::size_t i = 0; i < s_workerCount; ++i)
+			pthread_create(&s_threads[i], nullptr, WorkerProc, reinterpret_cast<void*>(static_cast<std::uintptr_t>(i)));
 
 		return true;
 	}
 
+	std::size_t TaskSchedulerImpl::GetQueuedTaskCount()
+	{
+		return s_queuedTaskCount.load(std::memory_order_relaxed);
+	}
+
 	bool TaskSchedulerImpl::IsInitialized()
 	{
 		return s_workerCount > 0;
 	}
 
-	void TaskSchedulerImpl::Run(Functor** tasks, unsigned int count)
+	void TaskSchedulerImpl::Run(Task* tasks, std::size_t count)
 	{
-		// On s'assure que des tâches ne sont pas déjà en cours
-		Wait();
+		if (count == 0)
+			return;
 
-		pthread_mutex_lock(&s_mutexQueue);
-		s_isDone = false;
+		// Les compteurs sont incrémentés avant que les tâches ne soient visibles, un worker ne peut donc pas les faire passer sous zéro
+		s_queuedTaskCount += count;
+		s_remainingTaskCount += count;
 
-		while (count--)
-			s_tasks.push(*tasks++);
+		// On répartit les tâches entre chaque worker, le reste de la division étant distribué à tour de rôle
+		std::size_t baseCount = count / s_workerCount;
+		std::size_t extraCount = count % s_workerCount;
+		for (std::size_t i = 0; i < s_workerCount; ++i)
+		{
+			std::size_t taskCount = (i < extraCount) ? baseCount + 1 : baseCount;
+			if (taskCount == 0)
+				break;
+
+			Worker& worker = s_workers[(s_nextWorker + i) % s_workerCount];
+
+			pthread_mutex_lock(&worker.queueMutex);
+			worker.queue.insert(worker.queue.end(), tasks, tasks + taskCount);
+			worker.workCount = worker.queue.size();
+			pthread_mutex_unlock(&worker.queueMutex);
+
+			tasks += taskCount;
+		}
+		s_nextWorker = (s_nextWorker + extraCount) % s_workerCount;
 
-		pthread_cond_signal(&s_cvNotEmpty);
-		pthread_mutex_unlock(&s_mutexQueue);
+		// Et on réveille les workers endormis
+		pthread_mutex_lock(&s_mutexState);
+		pthread_cond_broadcast(&s_cvWork);
+		pthread_mutex_unlock(&s_mutexState);
 	}
 
 	void TaskSchedulerImpl::Uninitialize()
@@ -75,25 +115,41 @@ namespace Nz
 		}
 		#endif
 
+		// On vide la queue de chaque worker pour s'assurer qu'ils s'arrêtent
+		for (std::size_t i = 0; i < s_workerCount; ++i)
+		{
+			Worker& worker = s_workers[i];
+
+			pthread_mutex_lock(&worker.queueMutex);
+			for (const Task& task : worker.queue)
+				delete task.functor;
+
+			worker.queue.clear();
+			worker.workCount = 0;
+			pthread_mutex_unlock(&worker.queueMutex);
+		}
+
 		// On réveille les threads pour qu'ils sortent de la boucle et terminent.
-		pthread_mutex_lock(&s_mutexQueue);
-		// On commence par vider la queue et demander qu'ils s'arrêtent.
-		std::queue<Functor*> emptyQueue;
-		std::swap(s_tasks, emptyQueue);
+		pthread_mutex_lock(&s_mutexState);
 		s_shouldFinish = true;
-		pthread_cond_broadcast(&s_cvNotEmpty);
-		pthread_mutex_unlock(&s_mutexQueue);
+		pthread_cond_broadcast(&s_cvWork);
+		pthread_mutex_unlock(&s_mutexState);
 
 		// On attend que chaque thread se termine
-		for (unsigned int i = 0; i < s_workerCount; ++i)
+		for (std::size_t i = 0; i < s_workerCount; ++i)
 			pthread_join(s_threads[i], nullptr);
 
 		// Et on libère les ressources
-		pthread_barrier_destroy(&s_barrier);
-		pthread_cond_destroy(&s_cvEmpty);
-		pthread_cond_destroy(&s_cvNotEmpty);
-		pthread_mutex_destroy(&s_mutexQueue);
+		for (std::size_t i = 0; i < s_workerCount; ++i)
+			pthread_mutex_destroy(&s_workers[i].queueMutex);
 
+		pthread_cond_destroy(&s_cvDone);
+		pthread_cond_destroy(&s_cvWork);
+		pthread_mutex_destroy(&s_mutexState);
+
+		s_helperStealOrder.clear();
+		s_threads.reset();
+		s_workers.reset();
 		s_workerCount = 0;
 	}
 
@@ -107,88 +163,205 @@ namespace Nz
 		}
 		#endif
 
-		Wait();
+		// Plutôt que d'attendre sans rien faire, on aide les workers
+		Task task;
+		while (StealTask(s_workerCount, &task))
+			ExecuteTask(task);
+
+		pthread_mutex_lock(&s_mutexState);
+		while (s_remainingTaskCount > 0)
+			pthread_cond_wait(&s_cvDone, &s_mutexState);
+		pthread_mutex_unlock(&s_mutexState);
 	}
 
-	Functor* TaskSchedulerImpl::PopQueue()
+	void TaskSchedulerImpl::WaitForTasks(TaskGroup& group)
 	{
-		Functor* task = nullptr;
+		#ifdef NAZARA_CORE_SAFE
+		if (s_workerCount == 0)
+		{
+			NazaraError("Task scheduler is not initialized");
+			return;
+		}
+		#endif
+
+		Task task;
+		while (!group.IsDone() && StealTask(s_workerCount, &task))
+			ExecuteTask(task);
 
-		pthread_mutex_lock(&s_mutexQueue);
+		pthread_mutex_lock(&s_mutexState);
+		while (!group.IsDone())
+			pthread_cond_wait(&s_cvDone, &s_mutexState);
+		pthread_mutex_unlock(&s_mutexState);
+	}
 
-		if (!s_tasks.empty())
+	void TaskSchedulerImpl::BuildStealOrders(const WorkerPlacement* placements)
+	{
+		// Chaque worker vole d'abord les workers de son nœud NUMA, puis les autres
+		for (std::size_t i = 0; i < s_workerCount; ++i)
 		{
-			task = s_tasks.front();
-			s_tasks.pop();
-		}
+			Worker& worker = s_workers[i];
+			worker.stealOrder.clear();
+			worker.stealOrder.reserve(s_workerCount - 1);
 
-		pthread_mutex_unlock(&s_mutexQueue);
+			for (std::size_t j = 0; j < s_workerCount; ++j)
+			{
+				if (j != i && (!placements || placements[j].node == placements[i].node))
+					worker.stealOrder.push_back(j);
+			}
 
-		return task;
+			if (placements)
+			{
+				for (std::size_t j = 0; j < s_workerCount; ++j)
+				{
+					if (placements[j].node != placements[i].node)
+						worker.stealOrder.push_back(j);
+				}
+			}
+		}
+
+		// Les threads attendant des tâches peuvent voler n'importe quel worker
+		s_helperStealOrder.resize(s_workerCount);
+		for (std::size_t i = 0; i < s_workerCount; ++i)
+			s_helperStealOrder[i] = i;
 	}
 
-	void TaskSchedulerImpl::Wait()
+	void TaskSchedulerImpl::ExecuteTask(const Task& task)
 	{
-		if (s_isDone)
-			return;
+		// On exécute la tâche avant de la supprimer
+		{
+			Profiler::Scope profilerScope("TaskScheduler task");
+			task.functor->Run();
+		}
+		delete task.functor;
 
-		pthread_mutex_lock(&s_mutexQueue);
-		s_isWaiting = true;
-		pthread_cond_broadcast(&s_cvNotEmpty);
-		pthread_cond_wait(&s_cvEmpty, &s_mutexQueue);
-		pthread_mutex_unlock(&s_mutexQueue);
+		// Le groupe ne doit plus être utilisé une fois son compteur à zéro, son propriétaire peut le détruire à tout moment
+		bool notify = false;
+		if (task.group && --task.group->m_pendingTaskCount == 0)
+			notify = true;
 
-		s_isDone = true;
+		if (--s_remainingTaskCount == 0)
+			notify = true;
+
+		if (notify)
+		{
+			pthread_mutex_lock(&s_mutexState);
+			pthread_cond_broadcast(&s_cvDone);
+			pthread_mutex_unlock(&s_mutexState);
+		}
 	}
 
-	void* TaskSchedulerImpl::WorkerProc(void* /*userdata*/)
+	bool TaskSchedulerImpl::PopTask(std::size_t workerID, Task* task)
 	{
-		// On s'assure que tous les threads soient correctement lancés.
-		pthread_barrier_wait(&s_barrier);
+		Worker& worker = s_workers[workerID];
+		if (worker.workCount == 0) // Permet d'éviter de verrouiller inutilement
+			return false;
 
-		// On quitte s'il doit terminer.
-		while (!s_shouldFinish)
+		bool popped = false;
+
+		pthread_mutex_lock(&worker.queueMutex);
+		if (!worker.queue.empty()) // Nécessaire car le workCount peut être tombé à zéro juste avant le verrouillage
 		{
-			Functor* task = PopQueue();
+			*task = worker.queue.front();
+			worker.queue.pop_front();
+			worker.workCount = worker.queue.size();
+			popped = true;
+		}
+		pthread_mutex_unlock(&worker.queueMutex);
 
-			if (task)
-			{
-				// On exécute la tâche avant de la supprimer
-				task->Run();
-				delete task;
-			}
-			else
+		if (popped)
+			s_queuedTaskCount--;
+
+		return popped;
+	}
+
+	bool TaskSchedulerImpl::StealTask(std::size_t workerID, Task* task)
+	{
+		const std::vector<std::size_t>& stealOrder = (workerID < s_workerCount) ? s_workers[workerID].stealOrder : s_helperStealOrder;
+
+		bool shouldRetry;
+		do
+		{
+			shouldRetry = false;
+			for (std::size_t i : stealOrder)
 			{
-				pthread_mutex_lock(&s_mutexQueue);
-				if (s_tasks.empty())
-					s_isDone = true;
+				Worker& worker = s_workers[i];
+				if (worker.workCount == 0)
+					continue;
+
+				// Si le worker utilise sa queue en ce moment, on passe au suivant pour revenir plus tard
+				if (pthread_mutex_trylock(&worker.queueMutex) != 0)
+				{
+					shouldRetry = true;
+					continue;
+				}
 
-				while (!(!s_tasks.empty() || s_isWaiting || s_shouldFinish))
-					pthread_cond_wait(&s_cvNotEmpty, &s_mutexQueue);
+				bool stolen = false;
+				if (!worker.queue.empty())
+				{
+					// On vole par l'arrière, le propriétaire dépilant par l'avant
+					*task = worker.queue.back();
+					worker.queue.pop_back();
+					worker.workCount = worker.queue.size();
+					stolen = true;
+				}
+				pthread_mutex_unlock(&worker.queueMutex);
 
-				if (s_tasks.empty() && s_isWaiting)
+				if (stolen)
 				{
-					// On prévient le thread qui attend que les tâches soient effectuées.
-					s_isWaiting = false;
-					pthread_cond_signal(&s_cvEmpty);
+					s_queuedTaskCount--;
+					return true;
 				}
+			}
+		}
+		while (shouldRetry);
+
+		return false;
+	}
+
+	void* TaskSchedulerImpl::WorkerProc(void* userdata)
+	{
+		std::size_t workerID = static_cast<std::size_t>(reinterpret_cast<std::uintptr_t>(userdata));
+
+		Profiler::SetThreadName("TaskWorker #" + String::Number(workerID));
 
-				pthread_mutex_unlock(&s_mutexQueue);
+		Worker& self = s_workers[workerID];
+		if (self.pinned)
+		{
+			Bitset<> affinity(self.processor + 1, false);
+			affinity.Set(self.processor, true);
+
+			Thread::SetCurrentThreadAffinity(affinity);
+		}
+
+		// On quitte s'il doit terminer.
+		while (!s_shouldFinish)
+		{
+			Task task;
+			if (PopTask(workerID, &task) || StealTask(workerID, &task))
+				ExecuteTask(task);
+			else
+			{
+				// Plus aucune tâche en attente, on s'endort jusqu'au prochain Run
+				pthread_mutex_lock(&s_mutexState);
+				while (s_queuedTaskCount == 0 && !s_shouldFinish)
+					pthread_cond_wait(&s_cvWork, &s_mutexState);
+				pthread_mutex_unlock(&s_mutexState);
 			}
 		}
 
 		return nullptr;
 	}
 
-	std::queue<Functor*> TaskSchedulerImpl::s_tasks;
 	std::unique_ptr<pthread_t[]> TaskSchedulerImpl::s_threads;
-	std::atomic<bool> TaskSchedulerImpl::s_isDone;
-	std::atomic<bool> TaskSchedulerImpl::s_isWaiting;
+	std::unique_ptr<TaskSchedulerImpl::Worker[]> TaskSchedulerImpl::s_workers;
+	std::vector<std::size_t> TaskSchedulerImpl::s_helperStealOrder;
+	std::atomic_size_t TaskSchedulerImpl::s_queuedTaskCount;
+	std::atomic_size_t TaskSchedulerImpl::s_remainingTaskCount;
 	std::atomic<bool> TaskSchedulerImpl::s_shouldFinish;
-	unsigned int TaskSchedulerImpl::s_workerCount;
+	std::size_t TaskSchedulerImpl::s_nextWorker;
+	std::size_t TaskSchedulerImpl::s_workerCount;
 
-	pthread_mutex_t TaskSchedulerImpl::s_mutexQueue;
-	pthread_cond_t TaskSchedulerImpl::s_cvEmpty;
-	pthread_cond_t TaskSchedulerImpl::s_cvNotEmpty;
-	pthread_barrier_t TaskSchedulerImpl::s_barrier;
+	pthread_mutex_t TaskSchedulerImpl::s_mutexState;
+	pthread_cond_t TaskSchedulerImpl::s_cvDone;
+	pthread_cond_t TaskSchedulerImpl::s_cvWork;
 }
@@ -8,43 +8,63 @@
 #define NAZARA_TASKSCHEDULERIMPL_HPP
 
 #include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
 #include <atomic>
+#include <deque>
 #include <memory>
+#include <vector>
 #include <pthread.h>
-#include <queue>
 
 namespace Nz
 {
-	struct Functor;
+	class TaskGroup;
 
 	class TaskSchedulerImpl
 	{
 		public:
+			using Task = TaskScheduler::Task;
+			using WorkerPlacement = TaskScheduler::WorkerPlacement;
+
 			TaskSchedulerImpl() = delete;
 			~TaskSchedulerImpl() = delete;
 
-			static bool Initialize(unsigned int workerCount);
+			static std::size_t GetQueuedTaskCount();
+			static bool Initialize(std::size_t workerCount, const WorkerPlacement* placements);
 			static bool IsInitialized();
-			static void Run(Functor** tasks, unsigned int count);
+			static void Run(Task* tasks, std::size_t count);
 			static void Uninitialize();
 			static void WaitForTasks();
+			static void WaitForTasks(TaskGroup& group);
 
 		private:
-			static Functor* PopQueue();
-			static void Wait();
+			static void BuildStealOrders(const WorkerPlacement* placements);
+			static void ExecuteTask(const Task& task);
+			static bool PopTask(std::size_t workerID, Task* task);
+			static bool StealTask(std::size_t workerID, Task* task);
 			static void* WorkerProc(void* userdata);
 
-			static std::queue<Functor*> s_tasks;
+			struct Worker
+			{
+				std::atomic_size_t workCount;
+				std::deque<Task> queue;
+				std::vector<std::size_t> stealOrder;
+				pthread_mutex_t queueMutex;
+				unsigned int processor;
+				bool pinned;
+			};
+
 			static std::unique_ptr<pthread_t[]> s_threads;
-			static std::atomic<bool> s_isDone;
-			static std::atomic<bool> s_isWaiting;
+			static std::unique_ptr<Worker[]> s_workers;
+			static std::vector<std::size_t> s_helperStealOrder;
+			static std::atomic_size_t s_queuedTaskCount;
+			static std::atomic_size_t s_remainingTaskCount;
 			static std::atomic<bool> s_shouldFinish;
-			static unsigned int s_workerCount;
+			static std::size_t s_nextWorker;
+			static std::size_t s_workerCount;
 
-			static pthread_mutex_t s_mutexQueue;
-			static pthread_cond_t s_cvEmpty;
-			static pthread_cond_t s_cvNotEmpty;
-			static pthread_barrier_t s_barrier;
+			static pthread_mutex_t s_mutexState;
+			static pthread_cond_t s_cvDone;
+			static pthread_cond_t s_cvWork;
 	};
 }
 
@@ -30,6 +30,11 @@ namespace Nz
 		pthread_join(m_handle, nullptr);
 	}
 
+	bool ThreadImpl::SetAffinity(const Bitset<>& processors)
+	{
+		return SetAffinity(m_handle, processors);
+	}
+
 	void ThreadImpl::SetName(const Nz::String& name)
 	{
 #ifdef __GNUC__
@@ -39,6 +44,16 @@ namespace Nz
 #endif
 	}
 
+	bool ThreadImpl::SetPriority(ThreadPriority priority)
+	{
+		return SetPriority(m_handle, priority);
+	}
+
+	bool ThreadImpl::SetCurrentAffinity(const Bitset<>& processors)
+	{
+		return SetAffinity(pthread_self(), processors);
+	}
+
 	void ThreadImpl::SetCurrentName(const Nz::String& name)
 	{
 #ifdef __GNUC__
@@ -48,6 +63,11 @@ namespace Nz
 #endif
 	}
 
+	bool ThreadImpl::SetCurrentPriority(ThreadPriority priority)
+	{
+		return SetPriority(pthread_self(), priority);
+	}
+
 	void ThreadImpl::Sleep(UInt32 time)
 	{
 		if (time == 0)
@@ -67,6 +87,77 @@ namespace Nz
 		}
 	}
 
+	bool ThreadImpl::SetAffinity(pthread_t handle, const Bitset<>& processors)
+	{
+#if defined(NAZARA_PLATFORM_LINUX)
+		cpu_set_t cpuSet;
+		CPU_ZERO(&cpuSet);
+
+		for (std::size_t processor = processors.FindFirst(); processor != Bitset<>::npos && processor < CPU_SETSIZE; processor = processors.FindNext(processor))
+			CPU_SET(processor, &cpuSet);
+
+		int error = pthread_setaffinity_np(handle, sizeof(cpuSet), &cpuSet);
+		if (error != 0)
+		{
+			NazaraError("Failed to set thread affinity: " + Error::GetLastSystemError(error));
+			return false;
+		}
+
+		return true;
+#else
+		NazaraUnused(handle);
+		NazaraUnused(processors);
+
+		NazaraWarning("Setting thread affinity is not supported on this platform");
+		return false;
+#endif
+	}
+
+	bool ThreadImpl::SetPriority(pthread_t handle, ThreadPriority priority)
+	{
+		// Linux only applies priorities to real-time policies, lower priorities are given by the idle and batch policies
+		int policy = SCHED_OTHER;
+		sched_param param;
+		param.sched_priority = 0;
+
+		switch (priority)
+		{
+			case ThreadPriority_Lowest:
+#ifdef SCHED_IDLE
+				policy = SCHED_IDLE;
+#endif
+				break;
+
+			case ThreadPriority_Low:
+#ifdef SCHED_BATCH
+				policy = SCHED_BATCH;
+#endif
+				break;
+
+			case ThreadPriority_Normal:
+				break;
+
+			case ThreadPriority_High:
+				policy = SCHED_RR;
+				param.sched_priority = sched_get_priority_min(SCHED_RR);
+				break;
+
+			case ThreadPriority_Highest:
+				policy = SCHED_RR;
+				param.sched_priority = (sched_get_priority_min(SCHED_RR) + sched_get_priority_max(SCHED_RR)) / 2;
+				break;
+		}
+
+		int error = pthread_setschedparam(handle, policy, &param);
+		if (error != 0)
+		{
+			NazaraError("Failed to set thread priority: " + Error::GetLastSystemError(error));
+			return false;
+		}
+
+		return true;
+	}
+
 	void* ThreadImpl::ThreadProc(void* userdata)
 	{
 		Functor* func = static_cast<Functor*>(userdata);
@@ -8,6 +8,8 @@
 #define NAZARA_THREADIMPL_HPP
 
 #include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Bitset.hpp>
+#include <Nazara/Core/Enums.hpp>
 
 #if defined(__GNUC__) && !defined(_GNU_SOURCE)
 #define _GNU_SOURCE
@@ -27,12 +29,18 @@ namespace Nz
 
 			void Detach();
 			void Join();
+			bool SetAffinity(const Bitset<>& processors);
 			void SetName(const Nz::String& name);
+			bool SetPriority(ThreadPriority priority);
 
+			static bool SetCurrentAffinity(const Bitset<>& processors);
 			static void SetCurrentName(const Nz::String& name);
+			static bool SetCurrentPriority(ThreadPriority priority);
 			static void Sleep(UInt32 time);
 
 		private:
+			static bool SetAffinity(pthread_t handle, const Bitset<>& processors);
+			static bool SetPriority(pthread_t handle, ThreadPriority priority);
 			static void* ThreadProc(void* userdata);
 
 			pthread_t m_handle;
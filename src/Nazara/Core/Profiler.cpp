@@ -0,0 +1,317 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Profiler.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/String.hpp>
+#include <Nazara/Core/StringStream.hpp>
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		struct Event
+		{
+			// Atomics (only accessed with relaxed operations) allow the buffer to be read while its thread writes it
+			std::atomic<const char*> name;
+			std::atomic<UInt64> startTime;
+			std::atomic<UInt64> endTime;
+		};
+
+		struct RecordedEvent
+		{
+			const char* name;
+			UInt64 startTime;
+			UInt64 endTime;
+		};
+
+		struct ThreadBuffer
+		{
+			std::unique_ptr<Event[]> events;
+			std::atomic<UInt64> claimedEvents;   //< Events whose slot is being or has been written
+			std::atomic<UInt64> writtenEvents;   //< Events completely written
+			std::atomic_bool inUse;
+			String threadName;                   //< Protected by the registry mutex
+			unsigned int threadId;
+		};
+
+		struct ProfilerRegistry
+		{
+			Mutex mutex;
+			std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+			UInt64 startTime = 0;
+		};
+
+		ProfilerRegistry& GetRegistry()
+		{
+			// Leaked on purpose, threads may still record scopes during the static destruction
+			static ProfilerRegistry* registry = new ProfilerRegistry;
+			return *registry;
+		}
+
+		// Gives its buffer back when its thread ends, the next thread needing one reuses it (and its thread id)
+		struct ThreadBufferOwner
+		{
+			~ThreadBufferOwner()
+			{
+				if (buffer)
+					buffer->inUse.store(false, std::memory_order_release);
+			}
+
+			String pendingName; //< Name set before the buffer was needed
+			ThreadBuffer* buffer = nullptr;
+		};
+
+		thread_local ThreadBufferOwner s_threadBufferOwner;
+
+		ThreadBuffer* GetThreadBuffer()
+		{
+			ThreadBufferOwner& owner = s_threadBufferOwner;
+			if (owner.buffer)
+				return owner.buffer;
+
+			ProfilerRegistry& registry = GetRegistry();
+
+			LockGuard lock(registry.mutex);
+			for (const auto& buffer : registry.buffers)
+			{
+				if (!buffer->inUse.load(std::memory_order_acquire))
+				{
+					buffer->inUse.store(true, std::memory_order_relaxed);
+					buffer->threadName = std::move(owner.pendingName);
+
+					owner.buffer = buffer.get();
+					return owner.buffer;
+				}
+			}
+
+			std::unique_ptr<ThreadBuffer> buffer(new ThreadBuffer);
+			buffer->events.reset(new Event[NAZARA_CORE_PROFILER_EVENT_COUNT]);
+			buffer->claimedEvents = 0;
+			buffer->writtenEvents = 0;
+			buffer->inUse = true;
+			buffer->threadName = std::move(owner.pendingName);
+			buffer->threadId = static_cast<unsigned int>(registry.buffers.size() + 1);
+
+			owner.buffer = buffer.get();
+			registry.buffers.emplace_back(std::move(buffer));
+
+			return owner.buffer;
+		}
+
+		void WriteJsonString(StringStream& stream, const char* string)
+		{
+			stream << '"';
+			for (; *string; ++string)
+			{
+				char character = *string;
+				if (character == '"' || character == '\\')
+					stream << '\\' << character;
+				else if (static_cast<unsigned char>(character) < 0x20)
+					stream << ' ';
+				else
+					stream << character;
+			}
+			stream << '"';
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::Profiler
+	* \brief Core class that records the duration of named scopes of every thread, to be viewed as a timeline
+	*
+	* Scopes are usually opened with Profiler::Scope, which only checks a flag while the profiler is disabled.
+	* Every thread has its own ring buffer, keeping the last NAZARA_CORE_PROFILER_EVENT_COUNT scopes, in which it writes without locking anything.
+	* Scopes are exported in the Chrome trace event format, which can be opened with chrome://tracing or Perfetto, nested scopes being shown as a hierarchy.
+	*
+	* \remark Recording a scope takes a few dozens of nanoseconds, scopes should not be used in loops over many elements
+	*/
+
+	/*!
+	* \brief Clears the scopes recorded until now
+	*
+	* \remark Scopes begun before this call are not exported anymore, even if they end after it
+	*/
+
+	void Profiler::Clear()
+	{
+		ProfilerRegistry& registry = GetRegistry();
+
+		// Only moving the read position of a buffer would race with its thread, the export skips the older scopes instead
+		LockGuard lock(registry.mutex);
+		registry.startTime = GetElapsedMicroseconds();
+	}
+
+	/*!
+	* \brief Enables or disables the recording of the scopes
+	*
+	* \param enable Should the scopes be recorded
+	*
+	* \remark Scopes begun while the profiler was disabled are not recorded
+	*/
+
+	void Profiler::Enable(bool enable)
+	{
+		if (enable)
+		{
+			ProfilerRegistry& registry = GetRegistry();
+
+			LockGuard lock(registry.mutex);
+			if (registry.startTime == 0)
+				registry.startTime = GetElapsedMicroseconds();
+		}
+
+		s_enabled.store(enable, std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Exports the recorded scopes to a file, in the Chrome trace event format
+	* \return true If the file was written
+	*
+	* \param filePath Path of the file (usually a .json), replaced if it exists
+	*/
+
+	bool Profiler::ExportChromeTrace(const String& filePath)
+	{
+		File file(filePath);
+		if (!file.Open(OpenMode_WriteOnly | OpenMode_Truncate))
+		{
+			NazaraError("Failed to open \"" + filePath + '"');
+			return false;
+		}
+
+		return ExportChromeTrace(file);
+	}
+
+	/*!
+	* \brief Exports the recorded scopes to a stream, in the Chrome trace event format
+	* \return true If the stream was written
+	*
+	* \param stream Stream to write the JSON document to
+	*
+	* \remark This can be called while other threads record scopes, the ones overwritten during the export are skipped
+	*/
+
+	bool Profiler::ExportChromeTrace(Stream& stream)
+	{
+		ProfilerRegistry& registry = GetRegistry();
+
+		StringStream trace;
+		trace << "{\"traceEvents\":[";
+
+		bool first = true;
+		auto BeginEvent = [&]()
+		{
+			if (!first)
+				trace << ",\n";
+			else
+				trace << '\n';
+
+			first = false;
+		};
+
+		std::vector<RecordedEvent> events;
+
+		LockGuard lock(registry.mutex);
+		for (const auto& buffer : registry.buffers)
+		{
+			// Copy the events written until now, then check which ones were overwritten meanwhile (like a sequence lock)
+			UInt64 writtenEvents = buffer->writtenEvents.load(std::memory_order_acquire);
+			UInt64 firstEvent = (writtenEvents > NAZARA_CORE_PROFILER_EVENT_COUNT) ? writtenEvents - NAZARA_CORE_PROFILER_EVENT_COUNT : 0;
+
+			events.clear();
+			for (UInt64 i = firstEvent; i < writtenEvents; ++i)
+			{
+				const Event& event = buffer->events[i % NAZARA_CORE_PROFILER_EVENT_COUNT];
+
+				RecordedEvent recordedEvent;
+				recordedEvent.name = event.name.load(std::memory_order_relaxed);
+				recordedEvent.startTime = event.startTime.load(std::memory_order_relaxed);
+				recordedEvent.endTime = event.endTime.load(std::memory_order_relaxed);
+
+				events.push_back(recordedEvent);
+			}
+
+			std::atomic_thread_fence(std::memory_order_acquire);
+
+			UInt64 claimedEvents = buffer->claimedEvents.load(std::memory_order_relaxed);
+			UInt64 validEvent = (claimedEvents > NAZARA_CORE_PROFILER_EVENT_COUNT) ? claimedEvents - NAZARA_CORE_PROFILER_EVENT_COUNT : 0;
+
+			if (!buffer->threadName.IsEmpty())
+			{
+				BeginEvent();
+				trace << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadId << ",\"args\":{\"name\":";
+				WriteJsonString(trace, buffer->threadName.GetConstBuffer());
+				trace << "}}";
+			}
+
+			for (UInt64 i = std::max(firstEvent, validEvent); i < writtenEvents; ++i)
+			{
+				const RecordedEvent& event = events[i - firstEvent];
+
+				// Scopes begun before the profiler started (or was cleared) are skipped
+				if (event.startTime < registry.startTime)
+					continue;
+
+				BeginEvent();
+				trace << "{\"name\":";
+				WriteJsonString(trace, event.name);
+				trace << ",\"ph\":\"X\",\"ts\":" << (event.startTime - registry.startTime) << ",\"dur\":" << (event.endTime - event.startTime) << ",\"pid\":1,\"tid\":" << buffer->threadId << '}';
+			}
+		}
+
+		trace << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+		return stream.Write(trace.ToString());
+	}
+
+	/*!
+	* \brief Sets the name of the calling thread in the exported timeline
+	*
+	* \param name Name of the thread
+	*
+	* \remark Thread::SetCurrentThreadName calls this
+	* \remark This doesn't allocate the buffer of the thread, which is only done when it records its first scope
+	*/
+
+	void Profiler::SetThreadName(const String& name)
+	{
+		ThreadBufferOwner& owner = s_threadBufferOwner;
+		if (!owner.buffer)
+		{
+			owner.pendingName = name;
+			return;
+		}
+
+		LockGuard lock(GetRegistry().mutex);
+		owner.buffer->threadName = name;
+	}
+
+	void Profiler::RecordEvent(const char* name, UInt64 startTime, UInt64 endTime)
+	{
+		ThreadBuffer* buffer = GetThreadBuffer();
+
+		// Only this thread writes the buffer, the export detects the events overwritten while it reads them
+		UInt64 index = buffer->writtenEvents.load(std::memory_order_relaxed);
+		buffer->claimedEvents.store(index + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		Event& event = buffer->events[index % NAZARA_CORE_PROFILER_EVENT_COUNT];
+		event.name.store(name, std::memory_order_relaxed);
+		event.startTime.store(startTime, std::memory_order_relaxed);
+		event.endTime.store(endTime, std::memory_order_relaxed);
+
+		buffer->writtenEvents.store(index + 1, std::memory_order_release);
+	}
+
+	std::atomic_bool Profiler::s_enabled(false);
+}
@@ -0,0 +1,63 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/PrometheusMetricsExporter.hpp>
+#include <Nazara/Core/StringStream.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		const char* typeNames[] = {
+			"counter", // MetricType_Counter
+			"gauge"    // MetricType_Gauge
+		};
+
+		static_assert(sizeof(typeNames) / sizeof(const char*) == MetricType_Max + 1, "Metric type array is incomplete");
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::PrometheusMetricsExporter
+	* \brief Core class exporting metrics in the Prometheus text format, to be served on a scraped HTTP endpoint
+	*/
+
+	/*!
+	* \brief Turns samples into the Prometheus text format
+	* \return Text to serve with the "text/plain; version=0.0.4" content type
+	*
+	* \param samples Samples collected by Metrics::Collect
+	*/
+
+	String PrometheusMetricsExporter::Export(const std::vector<Metrics::Sample>& samples)
+	{
+		StringStream stream;
+
+		const String* previousName = nullptr;
+		for (const Metrics::Sample& sample : samples)
+		{
+			// Metrics sharing a name (but not their labels) are described once
+			if (!previousName || *previousName != sample.name)
+			{
+				String description = sample.description;
+				description.Replace("\\", "\\\\");
+				description.Replace("\n", "\\n");
+
+				stream << "# HELP " << sample.name << ' ' << description << '\n';
+				stream << "# TYPE " << sample.name << ' ' << typeNames[sample.type] << '\n';
+
+				previousName = &sample.name;
+			}
+
+			stream << sample.name;
+			if (!sample.labels.IsEmpty())
+				stream << '{' << sample.labels << '}';
+
+			stream << ' ' << FormatValue(sample.value) << '\n';
+		}
+
+		return stream;
+	}
+}
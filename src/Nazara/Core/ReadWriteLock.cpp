@@ -0,0 +1,161 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/ReadWriteLock.hpp>
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <atomic>
+
+#if defined(NAZARA_PLATFORM_WINDOWS)
+	#include <Nazara/Core/Win32/ReadWriteLockImpl.hpp>
+#elif defined(NAZARA_PLATFORM_POSIX)
+	#include <Nazara/Core/Posix/ReadWriteLockImpl.hpp>
+#else
+	#error Lack of implementation: ReadWriteLock
+#endif
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		std::atomic<UInt64> s_contentionCount(0);
+		std::atomic<UInt64> s_waitTime(0);
+
+		void RecordContention(UInt64 startTime)
+		{
+			s_contentionCount.fetch_add(1, std::memory_order_relaxed);
+			s_waitTime.fetch_add(GetElapsedMicroseconds() - startTime, std::memory_order_relaxed);
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::ReadWriteLock
+	* \brief Core class that represents a lock which can be held by many readers at once, or by a single writer
+	*
+	* This is meant for read-mostly data like caches, where lookups shouldn't wait for each other.
+	*
+	* \remark The lock is not recursive, a thread must not lock it again (even for reading) while holding it
+	*
+	* \see ReadLockGuard, WriteLockGuard
+	*/
+
+	/*!
+	* \brief Constructs a ReadWriteLock object by default
+	*/
+
+	ReadWriteLock::ReadWriteLock()
+	{
+		m_impl = new ReadWriteLockImpl;
+	}
+
+	/*!
+	* \brief Destructs the object
+	*/
+
+	ReadWriteLock::~ReadWriteLock()
+	{
+		delete m_impl;
+	}
+
+	/*!
+	* \brief Locks for reading, waiting for the writer holding the lock if any
+	*/
+
+	void ReadWriteLock::LockRead()
+	{
+		NazaraAssert(m_impl, "Cannot lock a moved lock");
+
+		if (m_impl->TryLockRead())
+			return;
+
+		UInt64 startTime = GetElapsedMicroseconds();
+		m_impl->LockRead();
+		RecordContention(startTime);
+	}
+
+	/*!
+	* \brief Locks for writing, waiting for the readers or the writer holding the lock if any
+	*/
+
+	void ReadWriteLock::LockWrite()
+	{
+		NazaraAssert(m_impl, "Cannot lock a moved lock");
+
+		if (m_impl->TryLockWrite())
+			return;
+
+		UInt64 startTime = GetElapsedMicroseconds();
+		m_impl->LockWrite();
+		RecordContention(startTime);
+	}
+
+	/*!
+	* \brief Tries to lock for reading
+	* \return true if the lock was acquired successfully
+	*/
+
+	bool ReadWriteLock::TryLockRead()
+	{
+		NazaraAssert(m_impl, "Cannot lock a moved lock");
+		return m_impl->TryLockRead();
+	}
+
+	/*!
+	* \brief Tries to lock for writing
+	* \return true if the lock was acquired successfully
+	*/
+
+	bool ReadWriteLock::TryLockWrite()
+	{
+		NazaraAssert(m_impl, "Cannot lock a moved lock");
+		return m_impl->TryLockWrite();
+	}
+
+	/*!
+	* \brief Unlocks a lock held for reading
+	*/
+
+	void ReadWriteLock::UnlockRead()
+	{
+		NazaraAssert(m_impl, "Cannot unlock a moved lock");
+		m_impl->UnlockRead();
+	}
+
+	/*!
+	* \brief Unlocks a lock held for writing
+	*/
+
+	void ReadWriteLock::UnlockWrite()
+	{
+		NazaraAssert(m_impl, "Cannot unlock a moved lock");
+		m_impl->UnlockWrite();
+	}
+
+	/*!
+	* \brief Gets the contention of every read-write lock, for profiling
+	* \return Number of locks which had to wait, and the time spent waiting, since the start of the program or the last call to ResetContentionStats
+	*/
+
+	LockContentionStats ReadWriteLock::GetContentionStats()
+	{
+		LockContentionStats stats;
+		stats.contentionCount = s_contentionCount.load(std::memory_order_relaxed);
+		stats.waitTime = s_waitTime.load(std::memory_order_relaxed);
+
+		return stats;
+	}
+
+	/*!
+	* \brief Resets the counters returned by GetContentionStats
+	*/
+
+	void ReadWriteLock::ResetContentionStats()
+	{
+		s_contentionCount.store(0, std::memory_order_relaxed);
+		s_waitTime.store(0, std::memory_order_relaxed);
+	}
+}
@@ -0,0 +1,91 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/ResourceFinalizationQueue.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <deque>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		Mutex s_mutex;
+		std::deque<ResourceFinalizationQueue::Finalization> s_finalizations;
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::ResourceFinalizationQueue
+	* \brief Core class holding the last steps of asynchronous loads, which have to run on the thread owning the resources
+	*
+	* Decoding a resource can be done on any thread but uploading it to the GPU must be done by the render thread, which calls Process regularly (once per frame for example).
+	*
+	* \see ResourceFuture
+	*/
+
+	/*!
+	* \brief Drops every pending finalization
+	*
+	* Resources waiting for them will stay in the ResourceLoadState_Finalizing state, unless ResourceFuture::Wait is called
+	*/
+	void ResourceFinalizationQueue::Clear()
+	{
+		LockGuard lock(s_mutex);
+		s_finalizations.clear();
+	}
+
+	/*!
+	* \brief Queues a finalization for the next Process call
+	*
+	* \param finalization Function to call
+	*
+	* \remark This can be called from any thread
+	*/
+	void ResourceFinalizationQueue::Enqueue(Finalization finalization)
+	{
+		LockGuard lock(s_mutex);
+		s_finalizations.emplace_back(std::move(finalization));
+	}
+
+	/*!
+	* \brief Gets the number of finalizations waiting for Process
+	* \return Number of pending finalizations
+	*/
+	std::size_t ResourceFinalizationQueue::GetPendingCount()
+	{
+		LockGuard lock(s_mutex);
+		return s_finalizations.size();
+	}
+
+	/*!
+	* \brief Runs pending finalizations on the calling thread, in the order they were queued
+	* \return Number of finalizations run
+	*
+	* \param maxCount Maximum number of finalizations to run, allowing to spread uploads over several frames
+	*/
+	std::size_t ResourceFinalizationQueue::Process(std::size_t maxCount)
+	{
+		std::size_t count = 0;
+		while (count < maxCount)
+		{
+			Finalization finalization;
+			{
+				LockGuard lock(s_mutex);
+				if (s_finalizations.empty())
+					break;
+
+				finalization = std::move(s_finalizations.front());
+				s_finalizations.pop_front();
+			}
+
+			// Finalizations may queue other ones, the lock must not be held while running them
+			finalization();
+			count++;
+		}
+
+		return count;
+	}
+}
@@ -0,0 +1,218 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/ResourceWatcher.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/Log.hpp>
+#include <algorithm>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::ResourceWatcher
+	* \brief Core class that reloads the resources of resource managers when their files change
+	*
+	* Each ResourceManager registers a reloader, Update then polls the watched directories and asks the managers to reload the changed files.
+	* Files depending on a changed file (see AddDependency) are reloaded after it, so are their own dependents.
+	*
+	* \remark Must be used from the thread using the resource managers, reloads are then started in the background by the managers when the resource type allows it
+	* \remark Dependencies can be recorded from any thread, as loaders may run in the background
+	*/
+
+	/*!
+	* \brief Records that a resource must be reloaded when another file changes
+	*
+	* \param resourcePath Path to the file of the dependent resource
+	* \param dependencyPath Path to the file it depends on
+	*/
+	void ResourceWatcher::AddDependency(const String& resourcePath, const String& dependencyPath)
+	{
+		String absoluteResourcePath = File::AbsolutePath(resourcePath);
+		String absoluteDependencyPath = File::AbsolutePath(dependencyPath);
+		if (absoluteResourcePath.IsEmpty() || absoluteDependencyPath.IsEmpty() || absoluteResourcePath == absoluteDependencyPath)
+			return;
+
+		LockGuard lock(s_dependencyMutex);
+		s_dependents[absoluteDependencyPath].insert(std::move(absoluteResourcePath));
+	}
+
+	/*!
+	* \brief Forgets the dependencies of a resource
+	*
+	* Loaders should call this before recording the dependencies of a file they load, as they may have changed since the last load.
+	*
+	* \param resourcePath Path to the file of the dependent resource
+	*/
+	void ResourceWatcher::ClearDependencies(const String& resourcePath)
+	{
+		String absolutePath = File::AbsolutePath(resourcePath);
+
+		LockGuard lock(s_dependencyMutex);
+		for (auto it = s_dependents.begin(); it != s_dependents.end();)
+		{
+			it->second.erase(absolutePath);
+			if (it->second.empty())
+				it = s_dependents.erase(it);
+			else
+				++it;
+		}
+	}
+
+	/*!
+	* \brief Checks whether a directory is watched
+	* \return true if it is
+	*
+	* \param directoryPath Path to the directory
+	*/
+	bool ResourceWatcher::IsWatching(const String& directoryPath)
+	{
+		return s_fileWatcher && s_fileWatcher->IsWatching(directoryPath);
+	}
+
+	/*!
+	* \brief Registers a function reloading the resources loaded from a file
+	*
+	* \param reloader Function returning true if it had a resource loaded from the file (and started reloading it)
+	*/
+	void ResourceWatcher::RegisterReloader(Reloader reloader)
+	{
+		NazaraAssert(reloader, "Invalid reloader");
+
+		if (std::find(s_reloaders.begin(), s_reloaders.end(), reloader) == s_reloaders.end())
+			s_reloaders.push_back(reloader);
+	}
+
+	/*!
+	* \brief Reloads the resources loaded from a file and the ones depending on it
+	* \return Number of resources reloaded
+	*
+	* \param filePath Path to the file
+	*/
+	std::size_t ResourceWatcher::Reload(const String& filePath)
+	{
+		return ReloadFiles(std::vector<String>(1, filePath));
+	}
+
+	/*!
+	* \brief Unregisters a reloader
+	*
+	* \param reloader Function registered with RegisterReloader
+	*/
+	void ResourceWatcher::UnregisterReloader(Reloader reloader)
+	{
+		auto it = std::find(s_reloaders.begin(), s_reloaders.end(), reloader);
+		if (it != s_reloaders.end())
+			s_reloaders.erase(it);
+	}
+
+	/*!
+	* \brief Stops watching a directory
+	*
+	* \param directoryPath Path to the directory
+	*/
+	void ResourceWatcher::Unwatch(const String& directoryPath)
+	{
+		if (s_fileWatcher)
+			s_fileWatcher->Unwatch(directoryPath);
+	}
+
+	/*!
+	* \brief Reloads the resources whose files changed since the last call
+	* \return Number of resources reloaded
+	*
+	* \remark This does not block, it is meant to be called every frame
+	*/
+	std::size_t ResourceWatcher::Update()
+	{
+		if (!s_fileWatcher)
+			return 0;
+
+		std::vector<String> changedFiles;
+		if (s_fileWatcher->Poll(&changedFiles) == 0)
+			return 0;
+
+		return ReloadFiles(changedFiles);
+	}
+
+	/*!
+	* \brief Starts watching a directory for changes
+	* \return true if successful
+	*
+	* \param directoryPath Path to the directory
+	* \param recursive Should its subdirectories be watched as well
+	*
+	* \see FileWatcher::Watch
+	*/
+	bool ResourceWatcher::Watch(const String& directoryPath, bool recursive)
+	{
+		if (!s_fileWatcher)
+			s_fileWatcher.reset(new FileWatcher);
+
+		return s_fileWatcher->Watch(directoryPath, recursive);
+	}
+
+	/*!
+	* \brief Reloads a list of files, then their dependents (each file being reloaded at most once)
+	* \return Number of resources reloaded
+	*
+	* \param filePaths Paths to the changed files
+	*/
+	std::size_t ResourceWatcher::ReloadFiles(const std::vector<String>& filePaths)
+	{
+		std::vector<String> queue;
+		queue.reserve(filePaths.size());
+		for (const String& filePath : filePaths)
+			queue.push_back(File::AbsolutePath(filePath));
+
+		std::unordered_set<String> visited(queue.begin(), queue.end());
+
+		std::size_t reloadCount = 0;
+		for (std::size_t i = 0; i < queue.size(); ++i)
+		{
+			// Copied, reloaders may add dependencies while reloading
+			String filePath = queue[i];
+
+			for (Reloader reloader : s_reloaders)
+			{
+				if (reloader(filePath))
+				{
+					NazaraDebug("Reloading resource from file " + filePath);
+					reloadCount++;
+				}
+			}
+
+			LockGuard lock(s_dependencyMutex);
+			auto it = s_dependents.find(filePath);
+			if (it != s_dependents.end())
+			{
+				for (const String& dependent : it->second)
+				{
+					if (visited.insert(dependent).second)
+						queue.push_back(dependent);
+				}
+			}
+		}
+
+		return reloadCount;
+	}
+
+	/*!
+	* \brief Stops watching every directory and forgets every dependency
+	*/
+	void ResourceWatcher::Uninitialize()
+	{
+		LockGuard lock(s_dependencyMutex);
+		s_dependents.clear();
+		s_fileWatcher.reset();
+	}
+
+	std::unique_ptr<FileWatcher> ResourceWatcher::s_fileWatcher;
+	std::unordered_map<String, std::unordered_set<String>> ResourceWatcher::s_dependents;
+	std::vector<ResourceWatcher::Reloader> ResourceWatcher::s_reloaders;
+	Mutex ResourceWatcher::s_dependencyMutex;
+}
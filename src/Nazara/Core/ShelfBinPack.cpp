@@ -0,0 +1,404 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/ShelfBinPack.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <algorithm>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::ShelfBinPack
+	* \brief Core class packing rectangles on horizontal shelves
+	*
+	* Rectangles are put side by side on shelves as high as the first rectangle put on them, which suits sets of rectangles of similar heights like the glyphs of a font.
+	* Shelves having room left are indexed by height, a rectangle goes to the shortest shelf fitting it in logarithmic time, whatever the number of shelves.
+	*/
+
+	namespace
+	{
+		// A rectangle may only waste a quarter of its height to go on an existing shelf before a new one is opened
+		unsigned int GetMaxShelfHeight(unsigned int height)
+		{
+			return height + height / 4;
+		}
+	}
+
+	/*!
+	* \brief Constructs a ShelfBinPack object by default
+	*/
+
+	ShelfBinPack::ShelfBinPack()
+	{
+		Reset();
+	}
+
+	/*!
+	* \brief Constructs a ShelfBinPack object with width and height
+	*
+	* \param width Width
+	* \param height Height
+	*/
+
+	ShelfBinPack::ShelfBinPack(unsigned int width, unsigned int height)
+	{
+		Reset(width, height);
+	}
+
+	/*!
+	* \brief Constructs a ShelfBinPack object with area
+	*
+	* \param size Vector2 representing the area (width, height)
+	*/
+
+	ShelfBinPack::ShelfBinPack(const Vector2ui& size)
+	{
+		Reset(size);
+	}
+
+	/*!
+	* \brief Clears the content
+	*/
+
+	void ShelfBinPack::Clear()
+	{
+		m_openShelves.clear();
+		m_shelves.clear();
+
+		m_nextShelfY = 0;
+		m_usedArea = 0;
+	}
+
+	/*!
+	* \brief Expands the content
+	*
+	* \param newWidth New width for the expansion
+	* \param newHeight New height for the expansion
+	*
+	* \see Expand
+	*/
+
+	void ShelfBinPack::Expand(unsigned int newWidth, unsigned newHeight)
+	{
+		m_height = std::max(newHeight, m_height);
+
+		if (newWidth > m_width)
+		{
+			m_width = newWidth;
+
+			// Every shelf now has some room at its end
+			for (std::size_t i = 0; i < m_shelves.size(); ++i)
+			{
+				if (!m_shelves[i].isIndexed && HasRoom(m_shelves[i]))
+					IndexShelf(i);
+			}
+		}
+	}
+
+	/*!
+	* \brief Expands the content
+	*
+	* \param newSize New area for the expansion
+	*
+	* \see Expand
+	*/
+
+	void ShelfBinPack::Expand(const Vector2ui& newSize)
+	{
+		Expand(newSize.x, newSize.y);
+	}
+
+	/*!
+	* \brief Frees the rectangle
+	*
+	* \param rect Area to free
+	*
+	* \remark This method should only be called with rectangles computed by the method Insert
+	* \remark Only the last rectangle of a shelf gives its room back, a shelf is reused as a whole once all of its rectangles are freed
+	*/
+
+	void ShelfBinPack::FreeRectangle(const Rectui& rect)
+	{
+		auto it = std::lower_bound(m_shelves.begin(), m_shelves.end(), rect.y, [] (const Shelf& shelf, unsigned int y) { return shelf.y < y; });
+		NazaraAssert(it != m_shelves.end() && it->y == rect.y, "Rectangle doesn't belong to a shelf");
+
+		Shelf& shelf = *it;
+		if (--shelf.rectCount == 0)
+			shelf.usedWidth = 0;
+		else if (rect.x + rect.width == shelf.usedWidth)
+			shelf.usedWidth = rect.x;
+
+		if (!shelf.isIndexed && HasRoom(shelf))
+			IndexShelf(it - m_shelves.begin());
+
+		m_usedArea -= rect.width * rect.height;
+	}
+
+	/*!
+	* \brief Gets the height
+	* \return Height of the area
+	*/
+
+	unsigned int ShelfBinPack::GetHeight() const
+	{
+		return m_height;
+	}
+
+	/*!
+	* \brief Gets percentage of occupation
+	* \return Percentage of the already occupied area
+	*/
+
+	float ShelfBinPack::GetOccupancy() const
+	{
+		return static_cast<float>(m_usedArea)/(m_width*m_height);
+	}
+
+	/*!
+	* \brief Gets the number of shelves
+	* \return Shelf count
+	*/
+
+	std::size_t ShelfBinPack::GetShelfCount() const
+	{
+		return m_shelves.size();
+	}
+
+	/*!
+	* \brief Gets the size of the area
+	* \return Size of the area
+	*/
+
+	Vector2ui ShelfBinPack::GetSize() const
+	{
+		return Vector2ui(m_width, m_height);
+	}
+
+	/*!
+	* \brief Gets the width
+	* \return Width of the area
+	*/
+
+	unsigned int ShelfBinPack::GetWidth() const
+	{
+		return m_width;
+	}
+
+	/*!
+	* \brief Inserts rectangles in the area
+	* \return true if each rectangle could be inserted
+	*
+	* \param rects List of rectangles
+	* \param count Count of rectangles
+	*/
+
+	bool ShelfBinPack::Insert(Rectui* rects, unsigned int count)
+	{
+		return Insert(rects, nullptr, count);
+	}
+
+	/*!
+	* \brief Inserts rectangles in the area
+	* \return true if each rectangle could be inserted
+	*
+	* \param rects List of rectangles
+	* \param inserted List of inserted rectangles
+	* \param count Count of rectangles
+	*
+	* \remark Rectangles are packed from the tallest to the shortest, which opens less shelves than their submission order
+	* \remark Rectangles which don't fit are skipped, the others are still inserted
+	*/
+
+	bool ShelfBinPack::Insert(Rectui* rects, bool* inserted, unsigned int count)
+	{
+		std::vector<unsigned int> order(count);
+		for (unsigned int i = 0; i < count; ++i)
+			order[i] = i;
+
+		if (count > 1)
+			std::stable_sort(order.begin(), order.end(), [rects] (unsigned int lhs, unsigned int rhs) { return rects[lhs].height > rects[rhs].height; });
+
+		bool everyRectInserted = true;
+		for (unsigned int index : order)
+		{
+			Rectui& rect = rects[index];
+
+			std::size_t shelfIndex;
+			bool found = FindShelf(rect.width, rect.height, &shelfIndex);
+
+			if (inserted)
+				inserted[index] = found;
+
+			if (!found)
+			{
+				everyRectInserted = false;
+				continue;
+			}
+
+			Shelf& shelf = m_shelves[shelfIndex];
+			rect.x = shelf.usedWidth;
+			rect.y = shelf.y;
+
+			shelf.rectCount++;
+			shelf.usedWidth += rect.width;
+
+			if (!HasRoom(shelf))
+				UnindexShelf(shelfIndex);
+
+			m_usedArea += rect.width * rect.height;
+		}
+
+		return everyRectInserted;
+	}
+
+	/*!
+	* \brief Resets the area
+	*/
+
+	void ShelfBinPack::Reset()
+	{
+		m_height = 0;
+		m_width = 0;
+
+		Clear();
+	}
+
+	/*!
+	* \brief Resets the area
+	*
+	* \param width Width
+	* \param height Height
+	*/
+
+	void ShelfBinPack::Reset(unsigned int width, unsigned int height)
+	{
+		m_height = height;
+		m_width = width;
+
+		Clear();
+	}
+
+	/*!
+	* \brief Resets the area
+	*
+	* \param size Size of the area
+	*/
+
+	void ShelfBinPack::Reset(const Vector2ui& size)
+	{
+		Reset(size.x, size.y);
+	}
+
+	/*!
+	* \brief Finds a shelf for a rectangle, opening a new one if needed
+	* \return true if a shelf was found
+	*
+	* \param width Width of the rectangle
+	* \param height Height of the rectangle
+	* \param shelfIndex Output index of the shelf
+	*/
+
+	bool ShelfBinPack::FindShelf(unsigned int width, unsigned int height, std::size_t* shelfIndex)
+	{
+		if (width > m_width)
+			return false;
+
+		// Shortest shelf tall enough without wasting too much space
+		unsigned int maxHeight = GetMaxShelfHeight(height);
+		auto it = m_openShelves.lower_bound(height);
+		for (; it != m_openShelves.end() && it->first <= maxHeight; ++it)
+		{
+			if (m_shelves[it->second].usedWidth + width <= m_width)
+			{
+				*shelfIndex = it->second;
+				return true;
+			}
+		}
+
+		if (m_nextShelfY + height <= m_height)
+		{
+			Shelf shelf;
+			shelf.height = height;
+			shelf.isIndexed = false;
+			shelf.rectCount = 0;
+			shelf.usedWidth = 0;
+			shelf.y = m_nextShelfY;
+
+			m_nextShelfY += height;
+
+			*shelfIndex = m_shelves.size();
+			m_shelves.push_back(shelf);
+			IndexShelf(*shelfIndex);
+
+			return true;
+		}
+
+		// No room for a new shelf, any shelf tall enough will do
+		for (; it != m_openShelves.end(); ++it)
+		{
+			if (m_shelves[it->second].usedWidth + width <= m_width)
+			{
+				*shelfIndex = it->second;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	/*!
+	* \brief Checks whether a shelf is worth looking at for insertion
+	* \return true if the shelf still has some room
+	*
+	* \param shelf Shelf to check
+	*
+	* \remark Shelves with less room than a quarter of their height are considered full, which keeps the index small
+	*/
+
+	bool ShelfBinPack::HasRoom(const Shelf& shelf) const
+	{
+		return m_width - shelf.usedWidth > shelf.height / 4;
+	}
+
+	/*!
+	* \brief Makes a shelf available for insertion
+	*
+	* \param shelfIndex Index of the shelf
+	*/
+
+	void ShelfBinPack::IndexShelf(std::size_t shelfIndex)
+	{
+		Shelf& shelf = m_shelves[shelfIndex];
+		NazaraAssert(!shelf.isIndexed, "Shelf is already indexed");
+
+		m_openShelves.emplace(shelf.height, shelfIndex);
+		shelf.isIndexed = true;
+	}
+
+	/*!
+	* \brief Removes a full shelf from the ones available for insertion
+	*
+	* \param shelfIndex Index of the shelf
+	*/
+
+	void ShelfBinPack::UnindexShelf(std::size_t shelfIndex)
+	{
+		Shelf& shelf = m_shelves[shelfIndex];
+		NazaraAssert(shelf.isIndexed, "Shelf is not indexed");
+
+		auto range = m_openShelves.equal_range(shelf.height);
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			if (it->second == shelfIndex)
+			{
+				m_openShelves.erase(it);
+				break;
+			}
+		}
+
+		shelf.isIndexed = false;
+	}
+}
@@ -0,0 +1,175 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/SimdDispatcher.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/HardwareInfo.hpp>
+#include <algorithm>
+#include <vector>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		struct DispatcherState
+		{
+			std::vector<SimdKernelBase*> kernels;
+			SimdTarget limit = SimdTarget_Max;
+			SimdTarget target = SimdTarget_Scalar;
+			bool initialized = false;
+		};
+
+		DispatcherState& GetState()
+		{
+			// Kernels are usually static objects, the state has to be constructed before the first one registers
+			static DispatcherState state;
+			return state;
+		}
+
+		SimdTarget ComputeTarget(SimdTarget limit)
+		{
+			for (int i = limit; i > SimdTarget_Scalar; --i)
+			{
+				SimdTarget target = static_cast<SimdTarget>(i);
+				if (HardwareInfo::IsSimdTargetSupported(target))
+					return target;
+			}
+
+			return SimdTarget_Scalar;
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::SimdDispatcher
+	* \brief Core class that selects the implementation of SIMD kernels from the instruction sets supported by the processor
+	*
+	* The engine is compiled for a baseline instruction set (SSE2 on x86), kernels for newer ones live in their own translation units,
+	* compiled for their target with the NAZARA_SIMD_TARGET_* attributes, and are registered to a SimdKernel which calls the best one.
+	*
+	* \remark The target is selected when the Core module is initialized, kernels use their scalar implementation until then
+	*
+	* \see SimdKernel
+	*/
+
+	/*!
+	* \brief Gets the target kernels are selected for
+	* \return Best target supported by the processor up to the limit, scalar if the Core module is not initialized
+	*/
+
+	SimdTarget SimdDispatcher::GetTarget()
+	{
+		return GetState().target;
+	}
+
+	/*!
+	* \brief Gets the best target kernels are allowed to use
+	* \return Target limit, SimdTarget_Max by default
+	*/
+
+	SimdTarget SimdDispatcher::GetTargetLimit()
+	{
+		return GetState().limit;
+	}
+
+	/*!
+	* \brief Checks whether the target has been selected
+	* \return true If the Core module is initialized
+	*/
+
+	bool SimdDispatcher::IsInitialized()
+	{
+		return GetState().initialized;
+	}
+
+	/*!
+	* \brief Limits the targets kernels are allowed to use
+	*
+	* \param limit Best target allowed, SimdTarget_Scalar disabling SIMD kernels
+	*
+	* \remark Every kernel selects its implementation again, which must not happen while they are used by other threads
+	* \remark Mostly useful to compare implementations, or to work around a faulty kernel
+	*/
+
+	void SimdDispatcher::SetTargetLimit(SimdTarget limit)
+	{
+		NazaraAssert(limit <= SimdTarget_Max, "SIMD target out of enum");
+
+		DispatcherState& state = GetState();
+		state.limit = limit;
+
+		if (state.initialized)
+		{
+			state.target = ComputeTarget(limit);
+			ResolveKernels();
+		}
+	}
+
+	/*!
+	* \brief Initializes the SimdDispatcher class, selecting the implementation of every kernel
+	* \return true
+	*/
+
+	bool SimdDispatcher::Initialize()
+	{
+		DispatcherState& state = GetState();
+		if (state.initialized)
+			return true;
+
+		state.initialized = true;
+		state.target = ComputeTarget(state.limit);
+
+		ResolveKernels();
+
+		return true;
+	}
+
+	void SimdDispatcher::Register(SimdKernelBase* kernel)
+	{
+		GetState().kernels.push_back(kernel);
+	}
+
+	void SimdDispatcher::ResolveKernels()
+	{
+		DispatcherState& state = GetState();
+		for (SimdKernelBase* kernel : state.kernels)
+			kernel->Resolve(state.target);
+	}
+
+	/*!
+	* \brief Uninitializes the SimdDispatcher class, kernels falling back to their scalar implementation
+	*/
+
+	void SimdDispatcher::Uninitialize()
+	{
+		DispatcherState& state = GetState();
+		if (!state.initialized)
+			return;
+
+		state.initialized = false;
+		state.target = SimdTarget_Scalar;
+
+		ResolveKernels();
+	}
+
+	void SimdDispatcher::Unregister(SimdKernelBase* kernel)
+	{
+		DispatcherState& state = GetState();
+
+		auto it = std::find(state.kernels.begin(), state.kernels.end(), kernel);
+		if (it != state.kernels.end())
+			state.kernels.erase(it);
+	}
+
+	SimdKernelBase::SimdKernelBase()
+	{
+		SimdDispatcher::Register(this);
+	}
+
+	SimdKernelBase::~SimdKernelBase()
+	{
+		SimdDispatcher::Unregister(this);
+	}
+}
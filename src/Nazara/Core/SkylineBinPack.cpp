@@ -0,0 +1,446 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/SkylineBinPack.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <algorithm>
+#include <limits>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::SkylineBinPack
+	* \brief Core class packing rectangles under a skyline
+	*
+	* Only the upper contour of the packed rectangles (the skyline) is kept, as a list of horizontal segments.
+	* Each rectangle is put where its top is the lowest, the number of segments being bounded by the number of rectangles lying on the skyline and not by the number of free areas, which makes insertion cost stay low as the bin fills up.
+	*
+	* Unlike GuillotineBinPack, the space below the skyline can't be reused once freed, which suits caches (like glyph atlases) which are cleared as a whole.
+	*/
+
+	/*!
+	* \brief Constructs a SkylineBinPack object by default
+	*/
+
+	SkylineBinPack::SkylineBinPack()
+	{
+		Reset();
+	}
+
+	/*!
+	* \brief Constructs a SkylineBinPack object with width and height
+	*
+	* \param width Width
+	* \param height Height
+	*/
+
+	SkylineBinPack::SkylineBinPack(unsigned int width, unsigned int height)
+	{
+		Reset(width, height);
+	}
+
+	/*!
+	* \brief Constructs a SkylineBinPack object with area
+	*
+	* \param size Vector2 representing the area (width, height)
+	*/
+
+	SkylineBinPack::SkylineBinPack(const Vector2ui& size)
+	{
+		Reset(size);
+	}
+
+	/*!
+	* \brief Clears the content
+	*/
+
+	void SkylineBinPack::Clear()
+	{
+		m_skyline.clear();
+		if (m_width > 0)
+			m_skyline.push_back({0, 0, m_width});
+
+		m_usedArea = 0;
+	}
+
+	/*!
+	* \brief Expands the content
+	*
+	* \param newWidth New width for the expansion
+	* \param newHeight New height for the expansion
+	*
+	* \see Expand
+	*/
+
+	void SkylineBinPack::Expand(unsigned int newWidth, unsigned newHeight)
+	{
+		if (newWidth > m_width)
+		{
+			// The new columns are empty
+			if (!m_skyline.empty() && m_skyline.back().y == 0)
+				m_skyline.back().width += newWidth - m_width;
+			else
+				m_skyline.push_back({m_width, 0, newWidth - m_width});
+
+			m_width = newWidth;
+		}
+
+		m_height = std::max(newHeight, m_height);
+	}
+
+	/*!
+	* \brief Expands the content
+	*
+	* \param newSize New area for the expansion
+	*
+	* \see Expand
+	*/
+
+	void SkylineBinPack::Expand(const Vector2ui& newSize)
+	{
+		Expand(newSize.x, newSize.y);
+	}
+
+	/*!
+	* \brief Frees the rectangle
+	*
+	* \param rect Area to free
+	*
+	* \remark The area is only counted as free, it can't be reused before the next Clear
+	*/
+
+	void SkylineBinPack::FreeRectangle(const Rectui& rect)
+	{
+		m_usedArea -= rect.width * rect.height;
+	}
+
+	/*!
+	* \brief Gets the height
+	* \return Height of the area
+	*/
+
+	unsigned int SkylineBinPack::GetHeight() const
+	{
+		return m_height;
+	}
+
+	/*!
+	* \brief Gets percentage of occupation
+	* \return Percentage of the already occupied area
+	*/
+
+	float SkylineBinPack::GetOccupancy() const
+	{
+		return static_cast<float>(m_usedArea)/(m_width*m_height);
+	}
+
+	/*!
+	* \brief Gets the size of the area
+	* \return Size of the area
+	*/
+
+	Vector2ui SkylineBinPack::GetSize() const
+	{
+		return Vector2ui(m_width, m_height);
+	}
+
+	/*!
+	* \brief Gets the number of segments of the skyline
+	* \return Segment count, which is what an insertion goes through
+	*/
+
+	std::size_t SkylineBinPack::GetSegmentCount() const
+	{
+		return m_skyline.size();
+	}
+
+	/*!
+	* \brief Gets the width
+	* \return Width of the area
+	*/
+
+	unsigned int SkylineBinPack::GetWidth() const
+	{
+		return m_width;
+	}
+
+	/*!
+	* \brief Inserts rectangles in the area
+	* \return true if each rectangle could be inserted
+	*
+	* \param rects List of rectangles
+	* \param count Count of rectangles
+	*/
+
+	bool SkylineBinPack::Insert(Rectui* rects, unsigned int count)
+	{
+		return Insert(rects, nullptr, nullptr, count);
+	}
+
+	/*!
+	* \brief Inserts rectangles in the area
+	* \return true if each rectangle could be inserted
+	*
+	* \param rects List of rectangles
+	* \param flipped List of flipped rectangles, rectangles are never flipped if null
+	* \param count Count of rectangles
+	*/
+
+	bool SkylineBinPack::Insert(Rectui* rects, bool* flipped, unsigned int count)
+	{
+		return Insert(rects, flipped, nullptr, count);
+	}
+
+	/*!
+	* \brief Inserts rectangles in the area
+	* \return true if each rectangle could be inserted
+	*
+	* \param rects List of rectangles
+	* \param flipped List of flipped rectangles, rectangles are never flipped if null
+	* \param inserted List of inserted rectangles
+	* \param count Count of rectangles
+	*
+	* \remark Rectangles are packed from the tallest to the shortest, which wastes less space than their submission order
+	* \remark Rectangles which don't fit are skipped, the others are still inserted
+	*/
+
+	bool SkylineBinPack::Insert(Rectui* rects, bool* flipped, bool* inserted, unsigned int count)
+	{
+		std::vector<unsigned int> order(count);
+		for (unsigned int i = 0; i < count; ++i)
+			order[i] = i;
+
+		if (count > 1)
+		{
+			std::stable_sort(order.begin(), order.end(), [rects] (unsigned int lhs, unsigned int rhs)
+			{
+				return std::max(rects[lhs].width, rects[lhs].height) > std::max(rects[rhs].width, rects[rhs].height);
+			});
+		}
+
+		bool everyRectInserted = true;
+		for (unsigned int index : order)
+		{
+			Rectui& rect = rects[index];
+
+			std::size_t bestSegment;
+			unsigned int bestY;
+			unsigned int bestWaste;
+			bool bestFlipped = false;
+			bool found = FindPosition(rect.width, rect.height, &bestSegment, &bestY, &bestWaste);
+
+			if (flipped && rect.width != rect.height)
+			{
+				std::size_t segment;
+				unsigned int y;
+				unsigned int waste;
+				if (FindPosition(rect.height, rect.width, &segment, &y, &waste))
+				{
+					if (!found || y + rect.width < bestY + rect.height || (y + rect.width == bestY + rect.height && waste < bestWaste))
+					{
+						bestFlipped = true;
+						bestSegment = segment;
+						bestWaste = waste;
+						bestY = y;
+						found = true;
+					}
+				}
+			}
+
+			if (inserted)
+				inserted[index] = found;
+
+			if (!found)
+			{
+				everyRectInserted = false;
+				continue;
+			}
+
+			if (bestFlipped)
+				std::swap(rect.width, rect.height);
+
+			if (flipped)
+				flipped[index] = bestFlipped;
+
+			rect.x = m_skyline[bestSegment].x;
+			rect.y = bestY;
+
+			Place(bestSegment, rect.width, bestY + rect.height);
+
+			m_usedArea += rect.width * rect.height;
+		}
+
+		return everyRectInserted;
+	}
+
+	/*!
+	* \brief Resets the area
+	*/
+
+	void SkylineBinPack::Reset()
+	{
+		m_height = 0;
+		m_width = 0;
+
+		Clear();
+	}
+
+	/*!
+	* \brief Resets the area
+	*
+	* \param width Width
+	* \param height Height
+	*/
+
+	void SkylineBinPack::Reset(unsigned int width, unsigned int height)
+	{
+		m_height = height;
+		m_width = width;
+
+		Clear();
+	}
+
+	/*!
+	* \brief Resets the area
+	*
+	* \param size Size of the area
+	*/
+
+	void SkylineBinPack::Reset(const Vector2ui& size)
+	{
+		Reset(size.x, size.y);
+	}
+
+	/*!
+	* \brief Finds the position where a rectangle top is the lowest
+	* \return true if the rectangle fits somewhere
+	*
+	* \param width Width of the rectangle
+	* \param height Height of the rectangle
+	* \param segmentIndex Output index of the segment the rectangle starts at
+	* \param y Output vertical position of the rectangle
+	* \param waste Output area lost below the rectangle
+	*/
+
+	bool SkylineBinPack::FindPosition(unsigned int width, unsigned int height, std::size_t* segmentIndex, unsigned int* y, unsigned int* waste) const
+	{
+		unsigned int bestTop = std::numeric_limits<unsigned int>::max();
+		unsigned int bestWaste = std::numeric_limits<unsigned int>::max();
+		bool found = false;
+
+		for (std::size_t i = 0; i < m_skyline.size(); ++i)
+		{
+			// Segments are sorted by position, none of the next ones can fit if this one can't
+			if (m_skyline[i].x + width > m_width)
+				break;
+
+			unsigned int rectY;
+			unsigned int rectWaste;
+			if (!FitsAt(i, width, height, &rectY, &rectWaste))
+				continue;
+
+			unsigned int top = rectY + height;
+			if (top < bestTop || (top == bestTop && rectWaste < bestWaste))
+			{
+				bestTop = top;
+				bestWaste = rectWaste;
+				found = true;
+
+				*segmentIndex = i;
+				*waste = rectWaste;
+				*y = rectY;
+			}
+		}
+
+		return found;
+	}
+
+	/*!
+	* \brief Checks whether a rectangle fits at the start of a segment
+	* \return true if it fits
+	*
+	* \param segmentIndex Index of the segment the rectangle starts at
+	* \param width Width of the rectangle
+	* \param height Height of the rectangle
+	* \param y Output vertical position of the rectangle
+	* \param waste Output area lost below the rectangle
+	*/
+
+	bool SkylineBinPack::FitsAt(std::size_t segmentIndex, unsigned int width, unsigned int height, unsigned int* y, unsigned int* waste) const
+	{
+		// The rectangle lies on the highest segment it spans
+		unsigned int rectY = 0;
+		unsigned int remainingWidth = width;
+		std::size_t i = segmentIndex;
+		while (remainingWidth > 0)
+		{
+			NazaraAssert(i < m_skyline.size(), "Skyline doesn't cover the whole width");
+
+			rectY = std::max(rectY, m_skyline[i].y);
+			if (rectY + height > m_height)
+				return false;
+
+			remainingWidth -= std::min(remainingWidth, m_skyline[i].width);
+			++i;
+		}
+
+		unsigned int rectWaste = 0;
+		remainingWidth = width;
+		for (std::size_t j = segmentIndex; remainingWidth > 0; ++j)
+		{
+			unsigned int spannedWidth = std::min(remainingWidth, m_skyline[j].width);
+			rectWaste += (rectY - m_skyline[j].y) * spannedWidth;
+			remainingWidth -= spannedWidth;
+		}
+
+		*waste = rectWaste;
+		*y = rectY;
+		return true;
+	}
+
+	/*!
+	* \brief Raises the skyline where a rectangle was placed
+	*
+	* \param segmentIndex Index of the segment the rectangle starts at
+	* \param width Width of the rectangle
+	* \param top Vertical position of the top of the rectangle
+	*/
+
+	void SkylineBinPack::Place(std::size_t segmentIndex, unsigned int width, unsigned int top)
+	{
+		unsigned int x = m_skyline[segmentIndex].x;
+		m_skyline.insert(m_skyline.begin() + segmentIndex, {x, top, width});
+
+		// Shrink or remove the segments covered by the new one
+		unsigned int end = x + width;
+		std::size_t i = segmentIndex + 1;
+		while (i < m_skyline.size() && m_skyline[i].x < end)
+		{
+			Segment& segment = m_skyline[i];
+			unsigned int overlap = end - segment.x;
+			if (segment.width <= overlap)
+				m_skyline.erase(m_skyline.begin() + i);
+			else
+			{
+				segment.x += overlap;
+				segment.width -= overlap;
+				break;
+			}
+		}
+
+		// Merge neighbours at the same height, keeping the skyline short
+		std::size_t first = (segmentIndex > 0) ? segmentIndex - 1 : 0;
+		std::size_t last = std::min(segmentIndex + 1, m_skyline.size() - 1);
+		for (std::size_t j = last; j > first; --j)
+		{
+			if (m_skyline[j - 1].y == m_skyline[j].y)
+			{
+				m_skyline[j - 1].width += m_skyline[j].width;
+				m_skyline.erase(m_skyline.begin() + j);
+			}
+		}
+	}
+}
@@ -0,0 +1,81 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/StatsDMetricsExporter.hpp>
+#include <Nazara/Core/StringStream.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::StatsDMetricsExporter
+	* \brief Core class exporting metrics as StatsD lines, to be sent over UDP to a StatsD daemon
+	*
+	* StatsD counters being increments, counters are exported as their increase since the previous export (unchanged counters being skipped).
+	* Labels are turned into DogStatsD tags ("system=\"Physics\"" becoming "|#system:Physics"), which most daemons understand.
+	*/
+
+	/*!
+	* \brief Constructs a StatsDMetricsExporter object with a prefix
+	*
+	* \param prefix Prefix of the name of every metric (like "server1."), none by default
+	*/
+
+	StatsDMetricsExporter::StatsDMetricsExporter(String prefix) :
+	m_prefix(std::move(prefix))
+	{
+	}
+
+	/*!
+	* \brief Turns samples into StatsD lines
+	* \return One line for each changed counter and each gauge
+	*
+	* \param samples Samples collected by Metrics::Collect
+	*/
+
+	String StatsDMetricsExporter::Export(const std::vector<Metrics::Sample>& samples)
+	{
+		StringStream stream;
+
+		for (const Metrics::Sample& sample : samples)
+		{
+			double value = sample.value;
+			if (sample.type == MetricType_Counter)
+			{
+				double& exportedValue = m_exportedCounters[sample.name + sample.labels];
+				value -= exportedValue;
+				exportedValue = sample.value;
+
+				if (value == 0.0)
+					continue;
+			}
+
+			stream << m_prefix << sample.name << ':' << FormatValue(value) << ((sample.type == MetricType_Counter) ? "|c" : "|g");
+
+			if (!sample.labels.IsEmpty())
+			{
+				String tags = sample.labels;
+				tags.Replace("=\"", ":");
+				tags.Replace("\"", "");
+
+				stream << "|#" << tags;
+			}
+
+			stream << '\n';
+		}
+
+		return stream;
+	}
+
+	/*!
+	* \brief Gets the prefix of the name of every metric
+	* \return Prefix
+	*/
+
+	const String& StatsDMetricsExporter::GetPrefix() const
+	{
+		return m_prefix;
+	}
+}
@@ -33,6 +33,18 @@ namespace Nz
 		return String();
 	}
 
+	/*!
+	* \brief Gets a pointer to the whole content of the stream, if it lives in memory
+	* \return Pointer to the beginning of the stream content, or nullptr if the stream content is not directly accessible (meant to be virtual)
+	*
+	* \remark The content is GetSize() bytes long and does not depend on the cursor position
+	*/
+
+	const void* Stream::GetMappedPointer() const
+	{
+		return nullptr;
+	}
+
 	/*!
 	* \brief Gets the path of the stream
 	* \return Empty string (meant to be virtual)
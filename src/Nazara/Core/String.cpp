@@ -91,10 +91,7 @@ namespace Nz
 	* \brief Constructs a String object by default
 	*/
 
-	String::String() :
-	m_sharedString(GetEmptyString())
-	{
-	}
+	String::String() = default;
 
 	/*!
 	* \brief Constructs a String object with a character
@@ -106,11 +103,9 @@ namespace Nz
 	{
 		if (character != '\0')
 		{
-			m_sharedString = std::make_shared<SharedString>(1);
-			m_sharedString->string[0] = character;
+			AllocateString(1);
+			m_string[0] = character;
 		}
-		else
-			m_sharedString = GetEmptyString();
 	}
 
 	/*!
@@ -124,13 +119,11 @@ namespace Nz
 	{
 		if (rep > 0)
 		{
-			m_sharedString = std::make_shared<SharedString>(rep);
+			AllocateString(rep);
 
 			if (character != '\0')
-				std::memset(m_sharedString->string.get(), character, rep);
+				std::memset(m_string, character, rep);
 		}
-		else
-			m_sharedString = GetEmptyString();
 	}
 
 	/*!
@@ -159,13 +152,11 @@ namespace Nz
 
 		if (totalSize > 0)
 		{
-			m_sharedString = std::make_shared<SharedString>(totalSize);
+			AllocateString(totalSize);
 
 			for (std::size_t i = 0; i < rep; ++i)
-				std::memcpy(&m_sharedString->string[i*length], string, length);
+				std::memcpy(&m_string[i*length], string, length);
 		}
-		else
-			m_sharedString = GetEmptyString();
 	}
 
 	/*!
@@ -202,11 +193,9 @@ namespace Nz
 	{
 		if (length > 0)
 		{
-			m_sharedString = std::make_shared<SharedString>(length);
-			std::memcpy(m_sharedString->string.get(), string, length);
+			AllocateString(length);
+			std::memcpy(m_string, string, length);
 		}
-		else
-			m_sharedString = GetEmptyString();
 	}
 
 	/*!
@@ -220,6 +209,19 @@ namespace Nz
 	{
 	}
 
+	/*!
+	* \brief Constructs a String object which is a copy of another
+	*
+	* \param string String to copy
+	*
+	* \remark Long strings are not copied but shared, until one of the strings is modified
+	*/
+
+	String::String(const String& string)
+	{
+		Set(string);
+	}
+
 	/*!
 	* \brief Appends the character to the string
 	* \return A reference to this
@@ -231,7 +233,7 @@ namespace Nz
 
 	String& String::Append(char character)
 	{
-		return Insert(m_sharedString->size, character);
+		return Insert(m_size, character);
 	}
 
 	/*!
@@ -245,7 +247,7 @@ namespace Nz
 
 	String& String::Append(const char* string)
 	{
-		return Insert(m_sharedString->size, string);
+		return Insert(m_size, string);
 	}
 
 	/*!
@@ -260,7 +262,7 @@ namespace Nz
 
 	String& String::Append(const char* string, std::size_t length)
 	{
-		return Insert(m_sharedString->size, string, length);
+		return Insert(m_size, string, length);
 	}
 
 	/*!
@@ -274,7 +276,7 @@ namespace Nz
 
 	String& String::Append(const String& string)
 	{
-		return Insert(m_sharedString->size, string);
+		return Insert(m_size, string);
 	}
 
 	/*!
@@ -288,7 +290,8 @@ namespace Nz
 		if (keepBuffer)
 		{
 			EnsureOwnership(true);
-			m_sharedString->size = 0;
+			m_size = 0;
+			m_string[0] = '\0';
 		}
 		else
 			ReleaseString();
@@ -353,17 +356,17 @@ namespace Nz
 
 	unsigned int String::Count(char character, std::intmax_t start, UInt32 flags) const
 	{
-		if (character == '\0' || m_sharedString->size == 0)
+		if (character == '\0' || m_size == 0)
 			return 0;
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return 0;
 
-		char* str = &m_sharedString->string[pos];
+		char* str = &m_string[pos];
 		unsigned int count = 0;
 		if (flags & CaseInsensitive)
 		{
@@ -399,17 +402,17 @@ namespace Nz
 
 	unsigned int String::Count(const char* string, std::intmax_t start, UInt32 flags) const
 	{
-		if (!string || !string[0] || m_sharedString->size == 0)
+		if (!string || !string[0] || m_size == 0)
 			return 0;
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return 0;
 
-		char* str = &m_sharedString->string[pos];
+		char* str = &m_string[pos];
 		unsigned int count = 0;
 		if (flags & CaseInsensitive)
 		{
@@ -519,17 +522,17 @@ namespace Nz
 
 	unsigned int String::CountAny(const char* string, std::intmax_t start, UInt32 flags) const
 	{
-		if (!string || !string[0] || m_sharedString->size == 0)
+		if (!string || !string[0] || m_size == 0)
 			return 0;
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return 0;
 
-		char* str = &m_sharedString->string[pos];
+		char* str = &m_string[pos];
 		unsigned int count = 0;
 		if (flags & HandleUtf8)
 		{
@@ -631,13 +634,13 @@ namespace Nz
 
 	bool String::EndsWith(char character, UInt32 flags) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return 0;
 
 		if (flags & CaseInsensitive)
-			return Detail::ToLower(m_sharedString->string[m_sharedString->size-1]) == Detail::ToLower(character);
+			return Detail::ToLower(m_string[m_size-1]) == Detail::ToLower(character);
 		else
-			return m_sharedString->string[m_sharedString->size-1] == character; // character == '\0' will always be false
+			return m_string[m_size-1] == character; // character == '\0' will always be false
 	}
 
 	/*!
@@ -668,18 +671,18 @@ namespace Nz
 
 	bool String::EndsWith(const char* string, std::size_t length, UInt32 flags) const
 	{
-		if (!string || !string[0] || m_sharedString->size == 0 || length > m_sharedString->size)
+		if (!string || !string[0] || m_size == 0 || length > m_size)
 			return false;
 
 		if (flags & CaseInsensitive)
 		{
 			if (flags & HandleUtf8)
-				return Detail::Unicodecasecmp(&m_sharedString->string[m_sharedString->size - length], string) == 0;
+				return Detail::Unicodecasecmp(&m_string[m_size - length], string) == 0;
 			else
-				return Detail::Strcasecmp(&m_sharedString->string[m_sharedString->size - length], string) == 0;
+				return Detail::Strcasecmp(&m_string[m_size - length], string) == 0;
 		}
 		else
-			return std::strcmp(&m_sharedString->string[m_sharedString->size - length], string) == 0;
+			return std::strcmp(&m_string[m_size - length], string) == 0;
 	}
 
 	/*!
@@ -694,7 +697,7 @@ namespace Nz
 
 	bool String::EndsWith(const String& string, UInt32 flags) const
 	{
-		return EndsWith(string.GetConstBuffer(), string.m_sharedString->size, flags);
+		return EndsWith(string.GetConstBuffer(), string.m_size, flags);
 	}
 
 	/*!
@@ -708,24 +711,24 @@ namespace Nz
 
 	std::size_t String::Find(char character, std::intmax_t start, UInt32 flags) const
 	{
-		if (character == '\0' || m_sharedString->size == 0)
+		if (character == '\0' || m_size == 0)
 			return npos;
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return npos;
 
 		if (flags & CaseInsensitive)
 		{
 			char ch = Detail::ToLower(character);
-			const char* str = m_sharedString->string.get();
+			const char* str = m_string;
 			do
 			{
 				if (Detail::ToLower(*str) == ch)
-					return str - m_sharedString->string.get();
+					return str - m_string;
 			}
 			while (*++str);
 
@@ -733,9 +736,9 @@ namespace Nz
 		}
 		else
 		{
-			char* ch = std::strchr(&m_sharedString->string[pos], character);
+			char* ch = std::strchr(&m_string[pos], character);
 			if (ch)
-				return ch - m_sharedString->string.get();
+				return ch - m_string;
 			else
 				return npos;
 		}
@@ -752,17 +755,17 @@ namespace Nz
 
 	std::size_t String::Find(const char* string, std::intmax_t start, UInt32 flags) const
 	{
-		if (!string || !string[0] || m_sharedString->size == 0)
+		if (!string || !string[0] || m_size == 0)
 			return npos;
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return npos;
 
-		char* str = &m_sharedString->string[pos];
+		char* str = &m_string[pos];
 		if (flags & CaseInsensitive)
 		{
 			if (flags & HandleUtf8)
@@ -785,7 +788,7 @@ namespace Nz
 						for (;;)
 						{
 							if (*it2 == '\0')
-								return ptrPos - m_sharedString->string.get();
+								return ptrPos - m_string;
 
 							if (*it == '\0')
 								return npos;
@@ -814,7 +817,7 @@ namespace Nz
 						for (;;)
 						{
 							if (*ptr == '\0')
-								return ptrPos - m_sharedString->string.get();
+								return ptrPos - m_string;
 
 							if (*str == '\0')
 								return npos;
@@ -832,9 +835,9 @@ namespace Nz
 		}
 		else
 		{
-			char* ch = std::strstr(&m_sharedString->string[pos], string);
+			char* ch = std::strstr(&m_string[pos], string);
 			if (ch)
-				return ch - m_sharedString->string.get();
+				return ch - m_string;
 		}
 
 		return npos;
@@ -865,17 +868,17 @@ namespace Nz
 
 	std::size_t String::FindAny(const char* string, std::intmax_t start, UInt32 flags) const
 	{
-		if (m_sharedString->size == 0 || !string || !string[0])
+		if (m_size == 0 || !string || !string[0])
 			return npos;
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return npos;
 
-		char* str = &m_sharedString->string[pos];
+		char* str = &m_string[pos];
 		if (flags & HandleUtf8)
 		{
 			while (utf8::internal::is_trail(*str))
@@ -892,7 +895,7 @@ namespace Nz
 					do
 					{
 						if (character == Unicode::GetLowercase(*it2))
-							return it.base() - m_sharedString->string.get();
+							return it.base() - m_string;
 					}
 					while (*++it2);
 				}
@@ -906,7 +909,7 @@ namespace Nz
 					do
 					{
 						if (*it == *it2)
-							return it.base() - m_sharedString->string.get();
+							return it.base() - m_string;
 					}
 					while (*++it2);
 				}
@@ -924,7 +927,7 @@ namespace Nz
 					do
 					{
 						if (character == Detail::ToLower(*c))
-							return str - m_sharedString->string.get();
+							return str - m_string;
 					}
 					while (*++c);
 				}
@@ -934,7 +937,7 @@ namespace Nz
 			{
 				str = std::strpbrk(str, string);
 				if (str)
-					return str - m_sharedString->string.get();
+					return str - m_string;
 			}
 		}
 
@@ -966,17 +969,17 @@ namespace Nz
 
 	std::size_t String::FindLast(char character, std::intmax_t start, UInt32 flags) const
 	{
-		if (character == '\0' || m_sharedString->size == 0)
+		if (character == '\0' || m_size == 0)
 			return npos;
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return npos;
 
-		char* ptr = &m_sharedString->string[m_sharedString->size-1];
+		char* ptr = &m_string[m_size-1];
 
 		if (flags & CaseInsensitive)
 		{
@@ -984,18 +987,18 @@ namespace Nz
 			do
 			{
 				if (Detail::ToLower(*ptr) == character)
-					return ptr - m_sharedString->string.get();
+					return ptr - m_string;
 			}
-			while (ptr-- != m_sharedString->string.get());
+			while (ptr-- != m_string);
 		}
 		else
 		{
 			do
 			{
 				if (*ptr == character)
-					return ptr - m_sharedString->string.get();
+					return ptr - m_string;
 			}
-			while (ptr-- != m_sharedString->string.get());
+			while (ptr-- != m_string);
 		}
 
 		return npos;
@@ -1012,18 +1015,18 @@ namespace Nz
 
 	std::size_t String::FindLast(const char* string, std::intmax_t start, UInt32 flags) const
 	{
-		if (!string || !string[0] || m_sharedString->size == 0)
+		if (!string || !string[0] || m_size == 0)
 			return npos;
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return npos;
 
 		///Algo 1.FindLast#3 (Size of the pattern unknown)
-		const char* ptr = &m_sharedString->string[pos];
+		const char* ptr = &m_string[pos];
 		if (flags & CaseInsensitive)
 		{
 			if (flags & HandleUtf8)
@@ -1045,9 +1048,9 @@ namespace Nz
 						for (;;)
 						{
 							if (*it2 == '\0')
-								return it.base() - m_sharedString->string.get();
+								return it.base() - m_string;
 
-							if (tIt.base() > &m_sharedString->string[pos])
+							if (tIt.base() > &m_string[pos])
 								break;
 
 							if (Unicode::GetLowercase(*tIt) != Unicode::GetLowercase(*it2))
@@ -1058,7 +1061,7 @@ namespace Nz
 						}
 					}
 				}
-				while (it--.base() != m_sharedString->string.get());
+				while (it--.base() != m_string);
 			}
 			else
 			{
@@ -1072,9 +1075,9 @@ namespace Nz
 						for (;;)
 						{
 							if (*p == '\0')
-								return ptr - m_sharedString->string.get();
+								return ptr - m_string;
 
-							if (tPtr > &m_sharedString->string[pos])
+							if (tPtr > &m_string[pos])
 								break;
 
 							if (Detail::ToLower(*tPtr) != Detail::ToLower(*p))
@@ -1085,7 +1088,7 @@ namespace Nz
 						}
 					}
 				}
-				while (ptr-- != m_sharedString->string.get());
+				while (ptr-- != m_string);
 			}
 		}
 		else
@@ -1099,9 +1102,9 @@ namespace Nz
 					for (;;)
 					{
 						if (*p == '\0')
-							return ptr - m_sharedString->string.get();
+							return ptr - m_string;
 
-						if (tPtr > &m_sharedString->string[pos])
+						if (tPtr > &m_string[pos])
 							break;
 
 						if (*tPtr != *p)
@@ -1112,7 +1115,7 @@ namespace Nz
 					}
 				}
 			}
-			while (ptr-- != m_sharedString->string.get());
+			while (ptr-- != m_string);
 		}
 
 		return npos;
@@ -1129,18 +1132,18 @@ namespace Nz
 
 	std::size_t String::FindLast(const String& string, std::intmax_t start, UInt32 flags) const
 	{
-		if (string.m_sharedString->size == 0 || string.m_sharedString->size > m_sharedString->size)
+		if (string.m_size == 0 || string.m_size > m_size)
 			return npos;
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size || string.m_sharedString->size > m_sharedString->size)
+		if (pos >= m_size || string.m_size > m_size)
 			return npos;
 
-		const char* ptr = &m_sharedString->string[pos];
-		const char* limit = &m_sharedString->string[string.m_sharedString->size-1];
+		const char* ptr = &m_string[pos];
+		const char* limit = &m_string[string.m_size-1];
 
 		if (flags & CaseInsensitive)
 		{
@@ -1164,9 +1167,9 @@ namespace Nz
 						for (;;)
 						{
 							if (*it2 == '\0')
-								return it.base() - m_sharedString->string.get();
+								return it.base() - m_string;
 
-							if (tIt.base() > &m_sharedString->string[pos])
+							if (tIt.base() > &m_string[pos])
 								break;
 
 							if (Unicode::GetLowercase(*tIt) != Unicode::GetLowercase(*it2))
@@ -1182,21 +1185,21 @@ namespace Nz
 			else
 			{
 				///Algo 1.FindLast#4 (Size of the pattern unknown)
-				char c = Detail::ToLower(string.m_sharedString->string[string.m_sharedString->size-1]);
+				char c = Detail::ToLower(string.m_string[string.m_size-1]);
 				for (;;)
 				{
 					if (Detail::ToLower(*ptr) == c)
 					{
-						const char* p = &string.m_sharedString->string[string.m_sharedString->size-1];
-						for (; p >= &string.m_sharedString->string[0]; --p, --ptr)
+						const char* p = &string.m_string[string.m_size-1];
+						for (; p >= &string.m_string[0]; --p, --ptr)
 						{
 							if (Detail::ToLower(*ptr) != Detail::ToLower(*p))
 								break;
 
-							if (p == &string.m_sharedString->string[0])
-								return ptr-m_sharedString->string.get();
+							if (p == &string.m_string[0])
+								return ptr-m_string;
 
-							if (ptr == m_sharedString->string.get())
+							if (ptr == m_string)
 								return npos;
 						}
 					}
@@ -1210,18 +1213,18 @@ namespace Nz
 			///Algo 1.FindLast#4 (Size of the pattern known)
 			for (;;)
 			{
-				if (*ptr == string.m_sharedString->string[string.m_sharedString->size-1])
+				if (*ptr == string.m_string[string.m_size-1])
 				{
-					const char* p = &string.m_sharedString->string[string.m_sharedString->size-1];
-					for (; p >= &string.m_sharedString->string[0]; --p, --ptr)
+					const char* p = &string.m_string[string.m_size-1];
+					for (; p >= &string.m_string[0]; --p, --ptr)
 					{
 						if (*ptr != *p)
 							break;
 
-						if (p == &string.m_sharedString->string[0])
-							return ptr-m_sharedString->string.get();
+						if (p == &string.m_string[0])
+							return ptr-m_string;
 
-						if (ptr == m_sharedString->string.get())
+						if (ptr == m_string)
 							return npos;
 					}
 				}
@@ -1244,17 +1247,17 @@ namespace Nz
 
 	std::size_t String::FindLastAny(const char* string, std::intmax_t start, UInt32 flags) const
 	{
-		if (!string || !string[0] || m_sharedString->size == 0)
+		if (!string || !string[0] || m_size == 0)
 			return npos;
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return npos;
 
-		char* str = &m_sharedString->string[pos];
+		char* str = &m_string[pos];
 		if (flags & HandleUtf8)
 		{
 			while (utf8::internal::is_trail(*str))
@@ -1271,11 +1274,11 @@ namespace Nz
 					do
 					{
 						if (character == Unicode::GetLowercase(*it2))
-							return it.base() - m_sharedString->string.get();
+							return it.base() - m_string;
 					}
 					while (*++it2);
 				}
-				while (it--.base() != m_sharedString->string.get());
+				while (it--.base() != m_string);
 			}
 			else
 			{
@@ -1285,11 +1288,11 @@ namespace Nz
 					do
 					{
 						if (*it == *it2)
-							return it.base() - m_sharedString->string.get();
+							return it.base() - m_string;
 					}
 					while (*++it2);
 				}
-				while (it--.base() != m_sharedString->string.get());
+				while (it--.base() != m_string);
 			}
 		}
 		else
@@ -1303,11 +1306,11 @@ namespace Nz
 					do
 					{
 						if (character == Detail::ToLower(*c))
-							return str - m_sharedString->string.get();
+							return str - m_string;
 					}
 					while (*++c);
 				}
-				while (str-- != m_sharedString->string.get());
+				while (str-- != m_string);
 			}
 			else
 			{
@@ -1317,11 +1320,11 @@ namespace Nz
 					do
 					{
 						if (*str == *c)
-							return str - m_sharedString->string.get();
+							return str - m_string;
 					}
 					while (*++c);
 				}
-				while (str-- != m_sharedString->string.get());
+				while (str-- != m_string);
 			}
 		}
 
@@ -1353,18 +1356,18 @@ namespace Nz
 
 	std::size_t String::FindLastWord(const char* string, std::intmax_t start, UInt32 flags) const
 	{
-		if (!string || !string[0] || m_sharedString->size == 0)
+		if (!string || !string[0] || m_size == 0)
 			return npos;
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return npos;
 
 		///Algo 2.FindLastWord#1 (Size of the pattern unknown)
-		const char* ptr = &m_sharedString->string[pos];
+		const char* ptr = &m_string[pos];
 
 		if (flags & HandleUtf8)
 		{
@@ -1381,7 +1384,7 @@ namespace Nz
 				{
 					if (Unicode::GetLowercase(*it) == c)
 					{
-						if (it.base() != m_sharedString->string.get())
+						if (it.base() != m_string)
 						{
 							--it;
 							if (!Detail::IsSpace(*it++))
@@ -1397,12 +1400,12 @@ namespace Nz
 							if (*p == '\0')
 							{
 								if (*tIt == '\0' || Detail::IsSpace(*tIt))
-									return it.base() - m_sharedString->string.get();
+									return it.base() - m_string;
 								else
 									break;
 							}
 
-							if (tIt.base() > &m_sharedString->string[pos])
+							if (tIt.base() > &m_string[pos])
 								break;
 
 							if (Unicode::GetLowercase(*tIt) != Unicode::GetLowercase(*p))
@@ -1413,7 +1416,7 @@ namespace Nz
 						}
 					}
 				}
-				while (it--.base() != m_sharedString->string.get());
+				while (it--.base() != m_string);
 			}
 			else
 			{
@@ -1423,7 +1426,7 @@ namespace Nz
 				{
 					if (*it == c)
 					{
-						if (it.base() != m_sharedString->string.get())
+						if (it.base() != m_string)
 						{
 							--it;
 							if (!Detail::IsSpace(*it++))
@@ -1439,12 +1442,12 @@ namespace Nz
 							if (*p == '\0')
 							{
 								if (*tIt == '\0' || Detail::IsSpace(*tIt))
-									return it.base() - m_sharedString->string.get();
+									return it.base() - m_string;
 								else
 									break;
 							}
 
-							if (tIt.base() > &m_sharedString->string[pos])
+							if (tIt.base() > &m_string[pos])
 								break;
 
 							if (*tIt != *p)
@@ -1455,7 +1458,7 @@ namespace Nz
 						}
 					}
 				}
-				while (it--.base() != m_sharedString->string.get());
+				while (it--.base() != m_string);
 			}
 		}
 		else
@@ -1467,7 +1470,7 @@ namespace Nz
 				{
 					if (Detail::ToLower(*ptr) == c)
 					{
-						if (ptr != m_sharedString->string.get())
+						if (ptr != m_string)
 						{
 							--ptr;
 							if (!Detail::IsSpace(*ptr++))
@@ -1481,12 +1484,12 @@ namespace Nz
 							if (*p == '\0')
 							{
 								if (*tPtr == '\0' || Detail::IsSpace(*tPtr))
-									return ptr-m_sharedString->string.get();
+									return ptr-m_string;
 								else
 									break;
 							}
 
-							if (tPtr > &m_sharedString->string[pos])
+							if (tPtr > &m_string[pos])
 								break;
 
 							if (Detail::ToLower(*tPtr) != Detail::ToLower(*p))
@@ -1497,7 +1500,7 @@ namespace Nz
 						}
 					}
 				}
-				while (ptr-- != m_sharedString->string.get());
+				while (ptr-- != m_string);
 			}
 			else
 			{
@@ -1505,7 +1508,7 @@ namespace Nz
 				{
 					if (*ptr == string[0])
 					{
-						if (ptr != m_sharedString->string.get())
+						if (ptr != m_string)
 						{
 							--ptr;
 							if (!Detail::IsSpace(*ptr++))
@@ -1519,12 +1522,12 @@ namespace Nz
 							if (*p == '\0')
 							{
 								if (*tPtr == '\0' || Detail::IsSpace(*tPtr))
-									return ptr-m_sharedString->string.get();
+									return ptr-m_string;
 								else
 									break;
 							}
 
-							if (tPtr > &m_sharedString->string[pos])
+							if (tPtr > &m_string[pos])
 								break;
 
 							if (*tPtr != *p)
@@ -1535,7 +1538,7 @@ namespace Nz
 						}
 					}
 				}
-				while (ptr-- != m_sharedString->string.get());
+				while (ptr-- != m_string);
 			}
 		}
 
@@ -1553,18 +1556,18 @@ namespace Nz
 
 	std::size_t String::FindLastWord(const String& string, std::intmax_t start, UInt32 flags) const
 	{
-		if (string.m_sharedString->size == 0 || string.m_sharedString->size > m_sharedString->size)
+		if (string.m_size == 0 || string.m_size > m_size)
 			return npos;
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return npos;
 
-		const char* ptr = &m_sharedString->string[pos];
-		const char* limit = &m_sharedString->string[string.m_sharedString->size-1];
+		const char* ptr = &m_string[pos];
+		const char* limit = &m_string[string.m_size-1];
 
 		if (flags & HandleUtf8)
 		{
@@ -1581,7 +1584,7 @@ namespace Nz
 				{
 					if (Unicode::GetLowercase(*it) == c)
 					{
-						if (it.base() != m_sharedString->string.get())
+						if (it.base() != m_string)
 						{
 							--it;
 							if (!Detail::IsSpace(*it++))
@@ -1597,12 +1600,12 @@ namespace Nz
 							if (*p == '\0')
 							{
 								if (*tIt == '\0' || Detail::IsSpace(*tIt))
-									return it.base() - m_sharedString->string.get();
+									return it.base() - m_string;
 								else
 									break;
 							}
 
-							if (tIt.base() > &m_sharedString->string[pos])
+							if (tIt.base() > &m_string[pos])
 								break;
 
 							if (Unicode::GetLowercase(*tIt) != Unicode::GetLowercase(*p))
@@ -1613,7 +1616,7 @@ namespace Nz
 						}
 					}
 				}
-				while (it--.base() != m_sharedString->string.get());
+				while (it--.base() != m_string);
 			}
 			else
 			{
@@ -1623,7 +1626,7 @@ namespace Nz
 				{
 					if (*it == c)
 					{
-						if (it.base() != m_sharedString->string.get())
+						if (it.base() != m_string)
 						{
 							--it;
 							if (!Detail::IsSpace(*it++))
@@ -1639,12 +1642,12 @@ namespace Nz
 							if (*p == '\0')
 							{
 								if (*tIt == '\0' || Detail::IsSpace(*tIt))
-									return it.base() - m_sharedString->string.get();
+									return it.base() - m_string;
 								else
 									break;
 							}
 
-							if (tIt.base() > &m_sharedString->string[pos])
+							if (tIt.base() > &m_string[pos])
 								break;
 
 							if (*tIt != *p)
@@ -1655,7 +1658,7 @@ namespace Nz
 						}
 					}
 				}
-				while (it--.base() != m_sharedString->string.get());
+				while (it--.base() != m_string);
 			}
 		}
 		else
@@ -1663,7 +1666,7 @@ namespace Nz
 			///Algo 2.FindLastWord#2 (Size of the pattern known)
 			if (flags & CaseInsensitive)
 			{
-				char c = Detail::ToLower(string.m_sharedString->string[string.m_sharedString->size-1]);
+				char c = Detail::ToLower(string.m_string[string.m_size-1]);
 				do
 				{
 					if (Detail::ToLower(*ptr) == c)
@@ -1672,21 +1675,21 @@ namespace Nz
 						if (nextC != '\0' && (Detail::IsSpace(nextC)) == 0)
 							continue;
 
-						const char* p = &string.m_sharedString->string[string.m_sharedString->size-1];
-						for (; p >= &string.m_sharedString->string[0]; --p, --ptr)
+						const char* p = &string.m_string[string.m_size-1];
+						for (; p >= &string.m_string[0]; --p, --ptr)
 						{
 							if (Detail::ToLower(*ptr) != Detail::ToLower(*p))
 								break;
 
-							if (p == &string.m_sharedString->string[0])
+							if (p == &string.m_string[0])
 							{
-								if (ptr == m_sharedString->string.get() || Detail::IsSpace(*(ptr-1)))
-									return ptr-m_sharedString->string.get();
+								if (ptr == m_string || Detail::IsSpace(*(ptr-1)))
+									return ptr-m_string;
 								else
 									break;
 							}
 
-							if (ptr == m_sharedString->string.get())
+							if (ptr == m_string)
 								return npos;
 						}
 					}
@@ -1697,27 +1700,27 @@ namespace Nz
 			{
 				do
 				{
-					if (*ptr == string.m_sharedString->string[string.m_sharedString->size-1])
+					if (*ptr == string.m_string[string.m_size-1])
 					{
 						char nextC = *(ptr + 1);
 						if (nextC != '\0' && !Detail::IsSpace(nextC))
 							continue;
 
-						const char* p = &string.m_sharedString->string[string.m_sharedString->size-1];
-						for (; p >= &string.m_sharedString->string[0]; --p, --ptr)
+						const char* p = &string.m_string[string.m_size-1];
+						for (; p >= &string.m_string[0]; --p, --ptr)
 						{
 							if (*ptr != *p)
 								break;
 
-							if (p == &string.m_sharedString->string[0])
+							if (p == &string.m_string[0])
 							{
-								if (ptr == m_sharedString->string.get() || Detail::IsSpace(*(ptr - 1)))
-									return ptr-m_sharedString->string.get();
+								if (ptr == m_string || Detail::IsSpace(*(ptr - 1)))
+									return ptr-m_string;
 								else
 									break;
 							}
 
-							if (ptr == m_sharedString->string.get())
+							if (ptr == m_string)
 								return npos;
 						}
 					}
@@ -1740,18 +1743,18 @@ namespace Nz
 
 	std::size_t String::FindWord(const char* string, std::intmax_t start, UInt32 flags) const
 	{
-		if (!string || !string[0] || m_sharedString->size == 0)
+		if (!string || !string[0] || m_size == 0)
 			return npos;
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return npos;
 
 		///Algo 3.FindWord#3 (Size of the pattern unknown)
-		const char* ptr = m_sharedString->string.get();
+		const char* ptr = m_string;
 		if (flags & HandleUtf8)
 		{
 			if (utf8::internal::is_trail(*ptr))
@@ -1768,7 +1771,7 @@ namespace Nz
 				{
 					if (*it == c)
 					{
-						if (it.base() != m_sharedString->string.get())
+						if (it.base() != m_string)
 						{
 							--it;
 							if (!Detail::IsSpace(*it++))
@@ -1784,7 +1787,7 @@ namespace Nz
 							if (*p == '\0')
 							{
 								if (*tIt == '\0' || Detail::IsSpace(*it++))
-									return it.base() - m_sharedString->string.get();
+									return it.base() - m_string;
 								else
 									break;
 							}
@@ -1808,7 +1811,7 @@ namespace Nz
 				{
 					if (*it == c)
 					{
-						if (it.base() != m_sharedString->string.get())
+						if (it.base() != m_string)
 						{
 							--it;
 							if (!Detail::IsSpace(*it++))
@@ -1824,7 +1827,7 @@ namespace Nz
 							if (*p == '\0')
 							{
 								if (*tIt == '\0' || Detail::IsSpace(*it++))
-									return it.base() - m_sharedString->string.get();
+									return it.base() - m_string;
 								else
 									break;
 							}
@@ -1849,7 +1852,7 @@ namespace Nz
 				{
 					if (Detail::ToLower(*ptr) == c)
 					{
-						if (ptr != m_sharedString->string.get() && !Detail::IsSpace(*(ptr - 1)))
+						if (ptr != m_string && !Detail::IsSpace(*(ptr - 1)))
 							continue;
 
 						const char* p = &string[1];
@@ -1859,7 +1862,7 @@ namespace Nz
 							if (*p == '\0')
 							{
 								if (*tPtr == '\0' || Detail::IsSpace(*tPtr))
-									return ptr - m_sharedString->string.get();
+									return ptr - m_string;
 								else
 									break;
 							}
@@ -1880,7 +1883,7 @@ namespace Nz
 				{
 					if (*ptr == string[0])
 					{
-						if (ptr != m_sharedString->string.get() && !Detail::IsSpace(*(ptr-1)))
+						if (ptr != m_string && !Detail::IsSpace(*(ptr-1)))
 							continue;
 
 						const char* p = &string[1];
@@ -1890,7 +1893,7 @@ namespace Nz
 							if (*p == '\0')
 							{
 								if (*tPtr == '\0' || Detail::IsSpace(*tPtr))
-									return ptr - m_sharedString->string.get();
+									return ptr - m_string;
 								else
 									break;
 							}
@@ -1921,17 +1924,17 @@ namespace Nz
 
 	std::size_t String::FindWord(const String& string, std::intmax_t start, UInt32 flags) const
 	{
-		if (string.m_sharedString->size == 0 || string.m_sharedString->size > m_sharedString->size)
+		if (string.m_size == 0 || string.m_size > m_size)
 			return npos;
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return npos;
 
-		char* ptr = m_sharedString->string.get();
+		char* ptr = m_string;
 		if (flags & HandleUtf8)
 		{
 			///Algo 3.FindWord#3 (Iterator too slow for #2)
@@ -1949,7 +1952,7 @@ namespace Nz
 				{
 					if (*it == c)
 					{
-						if (it.base() != m_sharedString->string.get())
+						if (it.base() != m_string)
 						{
 							--it;
 							if (!Detail::IsSpace(*it++))
@@ -1965,7 +1968,7 @@ namespace Nz
 							if (*p == '\0')
 							{
 								if (*tIt == '\0' || Detail::IsSpace(*it++))
-									return it.base() - m_sharedString->string.get();
+									return it.base() - m_string;
 								else
 									break;
 							}
@@ -1989,7 +1992,7 @@ namespace Nz
 				{
 					if (*it == c)
 					{
-						if (it.base() != m_sharedString->string.get())
+						if (it.base() != m_string)
 						{
 							--it;
 							if (!Detail::IsSpace(*it++))
@@ -2005,7 +2008,7 @@ namespace Nz
 							if (*p == '\0')
 							{
 								if (*tIt == '\0' || Detail::IsSpace(*it++))
-									return it.base() - m_sharedString->string.get();
+									return it.base() - m_string;
 								else
 									break;
 							}
@@ -2026,22 +2029,22 @@ namespace Nz
 			///Algo 3.FindWord#2 (Size of the pattern known)
 			if (flags & CaseInsensitive)
 			{
-				char c = Detail::ToLower(string.m_sharedString->string[0]);
+				char c = Detail::ToLower(string.m_string[0]);
 				do
 				{
 					if (Detail::ToLower(*ptr) == c)
 					{
-						if (ptr != m_sharedString->string.get() && !Detail::IsSpace(*(ptr-1)))
+						if (ptr != m_string && !Detail::IsSpace(*(ptr-1)))
 							continue;
 
-						const char* p = &string.m_sharedString->string[1];
+						const char* p = &string.m_string[1];
 						const char* tPtr = ptr+1;
 						for (;;)
 						{
 							if (*p == '\0')
 							{
 								if (*tPtr == '\0' || Detail::IsSpace(*tPtr))
-									return ptr - m_sharedString->string.get();
+									return ptr - m_string;
 								else
 									break;
 							}
@@ -2061,8 +2064,8 @@ namespace Nz
 				while ((ptr = std::strstr(ptr, string.GetConstBuffer())) != nullptr)
 				{
 					// If the word is really alone
-					if ((ptr == m_sharedString->string.get() || Detail::IsSpace(*(ptr-1))) && (*(ptr+m_sharedString->size) == '\0' || Detail::IsSpace(*(ptr+m_sharedString->size))))
-						return ptr - m_sharedString->string.get();
+					if ((ptr == m_string || Detail::IsSpace(*(ptr-1))) && (*(ptr+m_size) == '\0' || Detail::IsSpace(*(ptr+m_size))))
+						return ptr - m_string;
 
 					ptr++;
 				}
@@ -2081,7 +2084,7 @@ namespace Nz
 	{
 		EnsureOwnership();
 
-		return m_sharedString->string.get();
+		return m_string;
 	}
 
 	/*!
@@ -2091,7 +2094,7 @@ namespace Nz
 
 	std::size_t String::GetCapacity() const
 	{
-		return m_sharedString->capacity;
+		return (IsLocal()) ? LocalCapacity : m_sharedString->capacity;
 	}
 
 	/*!
@@ -2106,14 +2109,14 @@ namespace Nz
 	*/
 	std::size_t String::GetCharacterPosition(std::size_t characterIndex) const
 	{
-		const char* ptr = m_sharedString->string.get();
-		const char* end = &m_sharedString->string[m_sharedString->size];
+		const char* ptr = m_string;
+		const char* end = &m_string[m_size];
 
 		try
 		{
 			utf8::advance(ptr, characterIndex, end);
 
-			return ptr - m_sharedString->string.get();
+			return ptr - m_string;
 		}
 		catch (utf8::not_enough_room& /*e*/)
 		{
@@ -2138,7 +2141,7 @@ namespace Nz
 
 	const char* String::GetConstBuffer() const
 	{
-		return m_sharedString->string.get();
+		return m_string;
 	}
 
 	/*!
@@ -2148,7 +2151,7 @@ namespace Nz
 
 	std::size_t String::GetLength() const
 	{
-		return utf8::distance(m_sharedString->string.get(), &m_sharedString->string[m_sharedString->size]);
+		return utf8::distance(m_string, &m_string[m_size]);
 	}
 
 	/*!
@@ -2158,7 +2161,7 @@ namespace Nz
 
 	std::size_t String::GetSize() const
 	{
-		return m_sharedString->size;
+		return m_size;
 	}
 
 	/*!
@@ -2168,7 +2171,7 @@ namespace Nz
 
 	std::string String::GetUtf8String() const
 	{
-		return std::string(m_sharedString->string.get(), m_sharedString->size);
+		return std::string(m_string, m_size);
 	}
 
 	/*!
@@ -2178,11 +2181,11 @@ namespace Nz
 
 	std::u16string String::GetUtf16String() const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return std::u16string();
 
 		std::u16string str;
-		str.reserve(m_sharedString->size);
+		str.reserve(m_size);
 
 		utf8::utf8to16(begin(), end(), std::back_inserter(str));
 
@@ -2196,11 +2199,11 @@ namespace Nz
 
 	std::u32string String::GetUtf32String() const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return std::u32string();
 
 		std::u32string str;
-		str.reserve(m_sharedString->size);
+		str.reserve(m_size);
 
 		utf8::utf8to32(begin(), end(), std::back_inserter(str));
 
@@ -2215,17 +2218,17 @@ namespace Nz
 	std::wstring String::GetWideString() const
 	{
 		static_assert(sizeof(wchar_t) == 2 || sizeof(wchar_t) == 4, "wchar_t size is not supported");
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return std::wstring();
 
 		std::wstring str;
-		str.reserve(m_sharedString->size);
+		str.reserve(m_size);
 
 		if (sizeof(wchar_t) == 4) // I want a static_if :(
 			utf8::utf8to32(begin(), end(), std::back_inserter(str));
 		else
 		{
-			utf8::unchecked::iterator<const char*> it(m_sharedString->string.get());
+			utf8::unchecked::iterator<const char*> it(m_string);
 			do
 			{
 				char32_t cp = *it;
@@ -2255,7 +2258,7 @@ namespace Nz
 			return String();
 
 		std::intmax_t endPos = -1;
-		const char* ptr = &m_sharedString->string[startPos];
+		const char* ptr = &m_string[startPos];
 		if (flags & HandleUtf8)
 		{
 			utf8::unchecked::iterator<const char*> it(ptr);
@@ -2263,7 +2266,7 @@ namespace Nz
 			{
 				if (Detail::IsSpace(*it))
 				{
-					endPos = static_cast<std::intmax_t>(it.base() - m_sharedString->string.get() - 1);
+					endPos = static_cast<std::intmax_t>(it.base() - m_string - 1);
 					break;
 				}
 			}
@@ -2275,7 +2278,7 @@ namespace Nz
 			{
 				if (Detail::IsSpace(*ptr))
 				{
-					endPos = static_cast<std::intmax_t>(ptr - m_sharedString->string.get() - 1);
+					endPos = static_cast<std::intmax_t>(ptr - m_string - 1);
 					break;
 				}
 			}
@@ -2295,13 +2298,13 @@ namespace Nz
 
 	std::size_t String::GetWordPosition(unsigned int index, UInt32 flags) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return npos;
 
 		unsigned int currentWord = 0;
 		bool inWord = false;
 
-		const char* ptr = m_sharedString->string.get();
+		const char* ptr = m_string;
 		if (flags & HandleUtf8)
 		{
 			utf8::unchecked::iterator<const char*> it(ptr);
@@ -2315,7 +2318,7 @@ namespace Nz
 					{
 						inWord = true;
 						if (++currentWord > index)
-							return it.base() - m_sharedString->string.get();
+							return it.base() - m_string;
 					}
 				}
 			}
@@ -2333,7 +2336,7 @@ namespace Nz
 					{
 						inWord = true;
 						if (++currentWord > index)
-							return ptr - m_sharedString->string.get();
+							return ptr - m_string;
 					}
 				}
 			}
@@ -2384,40 +2387,42 @@ namespace Nz
 			return *this;
 
 		if (pos < 0)
-			pos = std::max<std::size_t>(m_sharedString->size + pos, 0);
+			pos = std::max<std::size_t>(m_size + pos, 0);
 
-		std::size_t start = std::min<std::size_t>(pos, m_sharedString->size);
+		std::size_t start = std::min<std::size_t>(pos, m_size);
 
 		// If buffer is already big enough
-		if (m_sharedString->capacity >= m_sharedString->size + length)
+		if (GetCapacity() >= m_size + length)
 		{
 			EnsureOwnership();
 
-			std::memmove(&m_sharedString->string[start+length], &m_sharedString->string[start], m_sharedString->size - start);
-			std::memcpy(&m_sharedString->string[start], string, length);
+			std::memmove(&m_string[start+length], &m_string[start], m_size - start);
+			std::memcpy(&m_string[start], string, length);
 
-			m_sharedString->size += length;
-			m_sharedString->string[m_sharedString->size] = '\0';
+			m_size += length;
+			m_string[m_size] = '\0';
 		}
 		else
 		{
-			auto newString = std::make_shared<SharedString>(m_sharedString->size + length);
+			// Grows by more than needed, so that appending many times doesn't reallocate each time
+			String newString;
+			newString.AllocateString(m_size + length, Detail::GetNewSize(m_size + length));
 
-			char* ptr = newString->string.get();
+			char* ptr = newString.m_string;
 
 			if (start > 0)
 			{
-				std::memcpy(ptr, m_sharedString->string.get(), start*sizeof(char));
+				std::memcpy(ptr, m_string, start*sizeof(char));
 				ptr += start;
 			}
 
 			std::memcpy(ptr, string, length*sizeof(char));
 			ptr += length;
 
-			if (m_sharedString->size > start)
-				std::memcpy(ptr, &m_sharedString->string[start], m_sharedString->size - start);
+			if (m_size > start)
+				std::memcpy(ptr, &m_string[start], m_size - start);
 
-			m_sharedString = std::move(newString);
+			Swap(newString);
 		}
 
 		return *this;
@@ -2433,7 +2438,7 @@ namespace Nz
 
 	String& String::Insert(std::intmax_t pos, const String& string)
 	{
-		return Insert(pos, string.GetConstBuffer(), string.m_sharedString->size);
+		return Insert(pos, string.GetConstBuffer(), string.m_size);
 	}
 
 	/*!
@@ -2443,7 +2448,7 @@ namespace Nz
 
 	bool String::IsEmpty() const
 	{
-		return m_sharedString->size == 0;
+		return m_size == 0;
 	}
 
 	/*!
@@ -2453,7 +2458,7 @@ namespace Nz
 
 	bool String::IsNull() const
 	{
-		return m_sharedString.get() == GetEmptyString().get();
+		return m_size == 0 && IsLocal();
 	}
 
 	/*!
@@ -2476,14 +2481,14 @@ namespace Nz
 		}
 		#endif
 
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return false;
 
 		String check = Simplified();
-		if (check.m_sharedString->size == 0)
+		if (check.m_size == 0)
 			return false;
 
-		char* ptr = (check.m_sharedString->string[0] == '-') ? &check.m_sharedString->string[1] : check.m_sharedString->string.get();
+		char* ptr = (check.m_string[0] == '-') ? &check.m_string[1] : check.m_string;
 
 		if (base > 10)
 		{
@@ -2537,12 +2542,12 @@ namespace Nz
 
 	bool String::Match(const char* pattern) const
 	{
-		if (m_sharedString->size == 0 || !pattern)
+		if (m_size == 0 || !pattern)
 			return false;
 
 		// Par Jack Handy - akkhandy@hotmail.com
 		// From : http://www.codeproject.com/Articles/1088/Wildcard-string-compare-globbing
-		const char* str = m_sharedString->string.get();
+		const char* str = m_string;
 		while (*str && *pattern != '*')
 		{
 			if (*pattern != *str && *pattern != '?')
@@ -2591,7 +2596,7 @@ namespace Nz
 
 	bool String::Match(const String& pattern) const
 	{
-		return Match(pattern.m_sharedString->string.get());
+		return Match(pattern.m_string);
 	}
 
 	/*!
@@ -2670,14 +2675,14 @@ namespace Nz
 			return Replace(String(oldCharacter), String(), start);
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return npos;
 
 		unsigned int count = 0;
-		char* ptr = &m_sharedString->string[pos];
+		char* ptr = &m_string[pos];
 		bool found = false;
 		if (flags & CaseInsensitive)
 		{
@@ -2689,11 +2694,11 @@ namespace Nz
 				{
 					if (!found)
 					{
-						std::ptrdiff_t offset = ptr - m_sharedString->string.get();
+						std::ptrdiff_t offset = ptr - m_string;
 
 						EnsureOwnership();
 
-						ptr = &m_sharedString->string[offset];
+						ptr = &m_string[offset];
 						found = true;
 					}
 
@@ -2709,11 +2714,11 @@ namespace Nz
 			{
 				if (!found)
 				{
-					std::ptrdiff_t offset = ptr-m_sharedString->string.get();
+					std::ptrdiff_t offset = ptr-m_string;
 
 					EnsureOwnership();
 
-					ptr = &m_sharedString->string[offset];
+					ptr = &m_string[offset];
 					found = true;
 				}
 
@@ -2758,10 +2763,10 @@ namespace Nz
 			return 0;
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return 0;
 
 		unsigned int count = 0;
@@ -2778,7 +2783,7 @@ namespace Nz
 					found = true;
 				}
 
-				std::memcpy(&m_sharedString->string[pos], replaceString, oldLength);
+				std::memcpy(&m_string[pos], replaceString, oldLength);
 				pos += oldLength;
 
 				++count;
@@ -2786,19 +2791,20 @@ namespace Nz
 		}
 		else ///TODO: Replacement algorithm without changing the buffer (if replaceLength < oldLength)
 		{
-			std::size_t newSize = m_sharedString->size + Count(oldString)*(replaceLength - oldLength);
-			if (newSize == m_sharedString->size) // Then it's the fact that Count(oldString) == 0
+			std::size_t newSize = m_size + Count(oldString)*(replaceLength - oldLength);
+			if (newSize == m_size) // Then it's the fact that Count(oldString) == 0
 				return 0;
 
-			auto newString = std::make_shared<SharedString>(newSize);
+			String newString;
+			newString.AllocateString(newSize);
 
 			///Algo 4.Replace#2
-			char* ptr = newString->string.get();
-			const char* p = m_sharedString->string.get();
+			char* ptr = newString.m_string;
+			const char* p = m_string;
 
 			while ((pos = Find(oldString, pos, flags)) != npos)
 			{
-				const char* r = &m_sharedString->string[pos];
+				const char* r = &m_string[pos];
 
 				std::memcpy(ptr, p, r-p);
 				ptr += r-p;
@@ -2812,7 +2818,7 @@ namespace Nz
 
 			std::strcpy(ptr, p);
 
-			m_sharedString = std::move(newString);
+			Swap(newString);
 		}
 
 		return count;
@@ -2830,7 +2836,7 @@ namespace Nz
 
 	unsigned int String::Replace(const String& oldString, const String& replaceString, std::intmax_t start, UInt32 flags)
 	{
-		return Replace(oldString.GetConstBuffer(), oldString.m_sharedString->size, replaceString.GetConstBuffer(), replaceString.m_sharedString->size, start, flags);
+		return Replace(oldString.GetConstBuffer(), oldString.m_size, replaceString.GetConstBuffer(), replaceString.m_size, start, flags);
 	}
 
 	/*!
@@ -2855,14 +2861,14 @@ namespace Nz
 			return ReplaceAny(String(oldCharacters), String(), start);*/
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return npos;
 
 		unsigned int count = 0;
-		char* ptr = &m_sharedString->string[pos];
+		char* ptr = &m_string[pos];
 		if (flags & CaseInsensitive)
 		{
 			do
@@ -2876,11 +2882,11 @@ namespace Nz
 					{
 						if (!found)
 						{
-							std::ptrdiff_t offset = ptr - m_sharedString->string.get();
+							std::ptrdiff_t offset = ptr - m_string;
 
 							EnsureOwnership();
 
-							ptr = &m_sharedString->string[offset];
+							ptr = &m_string[offset];
 							found = true;
 						}
 
@@ -2900,11 +2906,11 @@ namespace Nz
 			{
 				if (!found)
 				{
-					std::ptrdiff_t offset = ptr - m_sharedString->string.get();
+					std::ptrdiff_t offset = ptr - m_string;
 
 					EnsureOwnership();
 
-					ptr = &m_sharedString->string[offset];
+					ptr = &m_string[offset];
 					found = true;
 				}
 
@@ -2920,7 +2926,7 @@ namespace Nz
 		{
 			if (start < 0)
 			{
-				start = m_sharedString->size+start;
+				start = m_size+start;
 				if (start < 0)
 					start = 0;
 			}
@@ -2929,7 +2935,7 @@ namespace Nz
 			unsigned int oSize = (oldCharacters) ? std::strlen(oldCharacters) : 0;
 			unsigned int rSize = (replaceString) ? std::strlen(replaceString) : 0;
 
-			if (pos >= m_sharedString->size || m_sharedString->size == 0 || oSize == 0)
+			if (pos >= m_size || m_size == 0 || oSize == 0)
 				return 0;
 
 			unsigned int count = 0;
@@ -2938,13 +2944,13 @@ namespace Nz
 			{
 				EnsureOwnership();
 
-				f or (; pos < m_sharedString->size; ++pos)
+				f or (; pos < m_size; ++pos)
 				{
 					for (unsigned int i = 0; i < oSize; ++i)
 					{
-						if (m_sharedString->string[pos] == oldCharacters[i])
+						if (m_string[pos] == oldCharacters[i])
 						{
-							m_sharedString->string[pos] = replaceString[0];
+							m_string[pos] = replaceString[0];
 							++count;
 
 							break;
@@ -2957,21 +2963,21 @@ namespace Nz
 				unsigned int newSize;
 				{
 					unsigned int count = CountAny(oldCharacters);
-					newSize = m_sharedString->size - count + count*rSize;
+					newSize = m_size - count + count*rSize;
 				}
 				char* newString = new char[newSize+1];
 
 				unsigned int j = 0;
-				for (unsigned int i = 0; i < m_sharedString->size; ++i)
+				for (unsigned int i = 0; i < m_size; ++i)
 				{
 					if (i < pos) // Avant la position où on est censé commencer à remplacer, on ne fait que recopier
-						newString[j++] = m_sharedString->string[i];
+						newString[j++] = m_string[i];
 					else
 					{
 						bool found = false;
 						for (unsigned int l = 0; l < oSize; ++l)
 						{
-							if (m_sharedString->string[i] == oldCharacters[l])
+							if (m_string[i] == oldCharacters[l])
 							{
 								for (unsigned int k = 0; k < rSize; ++k)
 									newString[j++] = replaceString[k];
@@ -2983,15 +2989,15 @@ namespace Nz
 						}
 
 						if (!found)
-							newString[j++] = m_sharedString->string[i];
+							newString[j++] = m_string[i];
 					}
 				}
 				newString[newSize] = '\0';
 
 				ReleaseString();
 
-				m_sharedString->size = newSize;
-				m_sharedString->string = newString;
+				m_size = newSize;
+				m_string = newString;
 			}
 
 			return count;
@@ -3001,30 +3007,30 @@ namespace Nz
 		{
 			if (start < 0)
 			{
-				start = m_sharedString->size+start;
+				start = m_size+start;
 				if (start < 0)
 					start = 0;
 			}
 
 			unsigned int pos = static_cast<unsigned int>(start);
 
-			if (pos >= m_sharedString->size || m_sharedString->size == 0 || oldCharacters.m_sharedString->size == 0)
+			if (pos >= m_size || m_size == 0 || oldCharacters.m_size == 0)
 				return 0;
 
 			unsigned int count = 0;
 
-			if (replaceString.m_sharedString->size == 1) // On utilise un algorithme optimisé
+			if (replaceString.m_size == 1) // On utilise un algorithme optimisé
 			{
 				EnsureOwnership();
 
 				char character = replaceString[0];
-				for (; pos < m_sharedString->size; ++pos)
+				for (; pos < m_size; ++pos)
 				{
-					for (unsigned int i = 0; i < oldCharacters.m_sharedString->size; ++i)
+					for (unsigned int i = 0; i < oldCharacters.m_size; ++i)
 					{
-						if (m_sharedString->string[pos] == oldCharacters[i])
+						if (m_string[pos] == oldCharacters[i])
 						{
-							m_sharedString->string[pos] = character;
+							m_string[pos] = character;
 							++count;
 							break;
 						}
@@ -3036,23 +3042,23 @@ namespace Nz
 				unsigned int newSize;
 				{
 					unsigned int count = CountAny(oldCharacters);
-					newSize = m_sharedString->size - count + count*replaceString.m_sharedString->size;
+					newSize = m_size - count + count*replaceString.m_size;
 				}
 				char* newString = new char[newSize+1];
 
 				unsigned int j = 0;
-				for (unsigned int i = 0; i < m_sharedString->size; ++i)
+				for (unsigned int i = 0; i < m_size; ++i)
 				{
 					if (i < pos) // Avant la position où on est censé commencer à remplacer, on ne fait que recopier
-						newString[j++] = m_sharedString->string[i];
+						newString[j++] = m_string[i];
 					else
 					{
 						bool found = false;
-						for (unsigned int l = 0; l < oldCharacters.m_sharedString->size; ++l)
+						for (unsigned int l = 0; l < oldCharacters.m_size; ++l)
 						{
-							if (m_sharedString->string[i] == oldCharacters[l])
+							if (m_string[i] == oldCharacters[l])
 							{
-								for (unsigned int k = 0; k < replaceString.m_sharedString->size; ++k)
+								for (unsigned int k = 0; k < replaceString.m_size; ++k)
 									newString[j++] = replaceString[k];
 
 								++count;
@@ -3062,15 +3068,15 @@ namespace Nz
 						}
 
 						if (!found)
-							newString[j++] = m_sharedString->string[i];
+							newString[j++] = m_string[i];
 					}
 				}
 				newString[newSize] = '\0';
 
 				ReleaseString();
 
-				m_sharedString->size = newSize;
-				m_sharedString->string = newString;
+				m_size = newSize;
+				m_string = newString;
 			}
 
 			return count;
@@ -3087,16 +3093,16 @@ namespace Nz
 
 	void String::Reserve(std::size_t bufferSize)
 	{
-		if (m_sharedString->capacity > bufferSize)
+		if (GetCapacity() > bufferSize)
 			return;
 
-		auto newString = std::make_shared<SharedString>(bufferSize);
-		newString->size = m_sharedString->size;
+		String newString;
+		newString.AllocateString(m_size, bufferSize);
 
-		if (m_sharedString->size > 0)
-			std::memcpy(newString->string.get(), m_sharedString->string.get(), m_sharedString->size);
+		if (m_size > 0)
+			std::memcpy(newString.m_string, m_string, m_size);
 
-		m_sharedString = std::move(newString);
+		Swap(newString);
 	}
 
 	/*!
@@ -3116,34 +3122,35 @@ namespace Nz
 		}
 
 		if (size < 0)
-			size = std::max<std::intmax_t>(m_sharedString->size + size, 0);
+			size = std::max<std::intmax_t>(m_size + size, 0);
 
 		std::size_t newSize = static_cast<std::size_t>(size);
 
-		if (flags & HandleUtf8 && newSize < m_sharedString->size)
+		if (flags & HandleUtf8 && newSize < m_size)
 		{
-			std::size_t characterToRemove = m_sharedString->size - newSize;
+			std::size_t characterToRemove = m_size - newSize;
 
-			char* ptr = &m_sharedString->string[m_sharedString->size];
+			char* ptr = &m_string[m_size];
 			for (std::size_t i = 0; i < characterToRemove; ++i)
-				utf8::prior(ptr, m_sharedString->string.get());
+				utf8::prior(ptr, m_string);
 
-			newSize = ptr - m_sharedString->string.get();
+			newSize = ptr - m_string;
 		}
 
-		if (m_sharedString->capacity >= newSize)
+		if (GetCapacity() >= newSize)
 		{
 			EnsureOwnership();
 
-			m_sharedString->size = newSize;
-			m_sharedString->string[newSize] = '\0'; // Adds the EoS character
+			m_size = newSize;
+			m_string[newSize] = '\0'; // Adds the EoS character
 		}
 		else // Then we want to make the string bigger
 		{
-			auto newString = std::make_shared<SharedString>(newSize);
-			std::memcpy(newString->string.get(), m_sharedString->string.get(), m_sharedString->size);
+			String newString;
+			newString.AllocateString(newSize);
+			std::memcpy(newString.m_string, m_string, m_size);
 
-			m_sharedString = std::move(newString);
+			Swap(newString);
 		}
 
 		return *this;
@@ -3160,33 +3167,34 @@ namespace Nz
 	String String::Resized(std::intmax_t size, UInt32 flags) const
 	{
 		if (size < 0)
-			size = m_sharedString->size + size;
+			size = m_size + size;
 
 		if (size <= 0)
 			return String();
 
 		std::size_t newSize = static_cast<std::size_t>(size);
-		if (newSize == m_sharedString->size)
+		if (newSize == m_size)
 			return *this;
 
-		if (flags & HandleUtf8 && newSize < m_sharedString->size)
+		if (flags & HandleUtf8 && newSize < m_size)
 		{
-			std::size_t characterToRemove = m_sharedString->size - newSize;
+			std::size_t characterToRemove = m_size - newSize;
 
-			char* ptr = &m_sharedString->string[m_sharedString->size - 1];
+			char* ptr = &m_string[m_size - 1];
 			for (std::size_t i = 0; i < characterToRemove; ++i)
-				utf8::prior(ptr, m_sharedString->string.get());
+				utf8::prior(ptr, m_string);
 
-			newSize = ptr - m_sharedString->string.get();
+			newSize = ptr - m_string;
 		}
 
-		auto sharedStr = std::make_shared<SharedString>(newSize);
-		if (newSize > m_sharedString->size)
-			std::memcpy(sharedStr->string.get(), m_sharedString->string.get(), m_sharedString->size);
+		String sharedStr;
+		sharedStr.AllocateString(newSize);
+		if (newSize > m_size)
+			std::memcpy(sharedStr.m_string, m_string, m_size);
 		else
-			std::memcpy(sharedStr->string.get(), m_sharedString->string.get(), newSize);
+			std::memcpy(sharedStr.m_string, m_string, newSize);
 
-		return String(std::move(sharedStr));
+		return sharedStr;
 	}
 
 	/*!
@@ -3196,13 +3204,15 @@ namespace Nz
 
 	String& String::Reverse()
 	{
-		if (m_sharedString->size != 0)
+		if (m_size != 0)
 		{
+			EnsureOwnership();
+
 			std::size_t i = 0;
-			std::size_t j = m_sharedString->size-1;
+			std::size_t j = m_size-1;
 
 			while (i < j)
-				std::swap(m_sharedString->string[i++], m_sharedString->string[j--]);
+				std::swap(m_string[i++], m_string[j--]);
 		}
 
 		return *this;
@@ -3215,19 +3225,20 @@ namespace Nz
 
 	String String::Reversed() const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return String();
 
-		auto sharedStr = std::make_shared<SharedString>(m_sharedString->size);
+		String sharedStr;
+		sharedStr.AllocateString(m_size);
 
-		char* ptr = &sharedStr->string[m_sharedString->size - 1];
-		char* p = m_sharedString->string.get();
+		char* ptr = &sharedStr.m_string[m_size - 1];
+		char* p = m_string;
 
 		do
 			*ptr-- = *p;
 		while (*(++p));
 
-		return String(std::move(sharedStr));
+		return sharedStr;
 	}
 
 	/*!
@@ -3241,17 +3252,17 @@ namespace Nz
 	{
 		if (character != '\0')
 		{
-			if (m_sharedString->capacity >= 1)
+			if (GetCapacity() >= 1)
 			{
 				EnsureOwnership(true);
 
-				m_sharedString->size = 1;
-				m_sharedString->string[1] = '\0';
+				m_size = 1;
+				m_string[1] = '\0';
 			}
 			else
-				m_sharedString = std::make_shared<SharedString>(1);
+				AllocateString(1);
 
-			m_sharedString->string[0] = character;
+			m_string[0] = character;
 		}
 		else
 			ReleaseString();
@@ -3272,18 +3283,18 @@ namespace Nz
 	{
 		if (rep > 0)
 		{
-			if (m_sharedString->capacity >= rep)
+			if (GetCapacity() >= rep)
 			{
 				EnsureOwnership(true);
 
-				m_sharedString->size = rep;
-				m_sharedString->string[rep] = '\0';
+				m_size = rep;
+				m_string[rep] = '\0';
 			}
 			else
-				m_sharedString = std::make_shared<SharedString>(rep);
+				AllocateString(rep);
 
 			if (character != '\0')
-				std::memset(m_sharedString->string.get(), character, rep);
+				std::memset(m_string, character, rep);
 		}
 		else
 			ReleaseString();
@@ -3319,18 +3330,18 @@ namespace Nz
 
 		if (totalSize > 0)
 		{
-			if (m_sharedString->capacity >= totalSize)
+			if (GetCapacity() >= totalSize)
 			{
 				EnsureOwnership(true);
 
-				m_sharedString->size = totalSize;
-				m_sharedString->string[totalSize] = '\0';
+				m_size = totalSize;
+				m_string[totalSize] = '\0';
 			}
 			else
-				m_sharedString = std::make_shared<SharedString>(totalSize);
+				AllocateString(totalSize);
 
 			for (std::size_t i = 0; i < rep; ++i)
-				std::memcpy(&m_sharedString->string[i*length], string, length);
+				std::memcpy(&m_string[i*length], string, length);
 		}
 		else
 			ReleaseString();
@@ -3348,7 +3359,7 @@ namespace Nz
 
 	String& String::Set(std::size_t rep, const String& string)
 	{
-		return Set(rep, string.GetConstBuffer(), string.m_sharedString->size);
+		return Set(rep, string.GetConstBuffer(), string.m_size);
 	}
 
 	/*!
@@ -3375,17 +3386,17 @@ namespace Nz
 	{
 		if (length > 0)
 		{
-			if (m_sharedString->capacity >= length)
+			if (GetCapacity() >= length)
 			{
 				EnsureOwnership(true);
 
-				m_sharedString->size = length;
-				m_sharedString->string[length] = '\0';
+				m_size = length;
+				m_string[length] = '\0';
 			}
 			else
-				m_sharedString = std::make_shared<SharedString>(length);
+				AllocateString(length);
 
-			std::memcpy(m_sharedString->string.get(), string, length);
+			std::memcpy(m_string, string, length);
 		}
 		else
 			ReleaseString();
@@ -3414,7 +3425,22 @@ namespace Nz
 
 	String& String::Set(const String& string)
 	{
-		m_sharedString = string.m_sharedString;
+		if (this == &string)
+			return *this;
+
+		ReleaseString();
+
+		m_size = string.m_size;
+
+		if (string.IsLocal())
+			std::memcpy(m_localString, string.m_localString, sizeof(m_localString));
+		else
+		{
+			m_sharedString = string.m_sharedString;
+			m_sharedString->refCount++;
+
+			m_string = string.m_string;
+		}
 
 		return *this;
 	}
@@ -3428,7 +3454,11 @@ namespace Nz
 
 	String& String::Set(String&& string) noexcept
 	{
-		std::swap(m_sharedString, string.m_sharedString);
+		if (this != &string)
+		{
+			ReleaseString();
+			MoveString(string);
+		}
 
 		return *this;
 	}
@@ -3442,14 +3472,15 @@ namespace Nz
 
 	String String::Simplified(UInt32 flags) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return String();
 
-		auto newString = std::make_shared<SharedString>(m_sharedString->size);
-		char* str = newString->string.get();
+		String newString;
+		newString.AllocateString(m_size);
+		char* str = newString.m_string;
 		char* p = str;
 
-		const char* ptr = m_sharedString->string.get();
+		const char* ptr = m_string;
 		bool inword = false;
 		if (flags & HandleUtf8)
 		{
@@ -3474,7 +3505,7 @@ namespace Nz
 		}
 		else
 		{
-			const char* limit = &m_sharedString->string[m_sharedString->size];
+			const char* limit = &m_string[m_size];
 			do
 			{
 				if (Detail::IsSpace(*ptr))
@@ -3498,9 +3529,9 @@ namespace Nz
 			p--;
 
 		*p = '\0';
-		newString->size = p - str;
+		newString.m_size = p - str;
 
-		return String(std::move(newString));
+		return newString;
 	}
 
 	/*!
@@ -3527,7 +3558,7 @@ namespace Nz
 
 	unsigned int String::Split(std::vector<String>& result, char separation, std::intmax_t start, UInt32 flags) const
 	{
-		if (separation == '\0' || m_sharedString->size == 0)
+		if (separation == '\0' || m_size == 0)
 			return 0;
 
 		std::size_t lastSep = Find(separation, start, flags);
@@ -3551,7 +3582,7 @@ namespace Nz
 			lastSep = sep;
 		}
 
-		if (lastSep != m_sharedString->size-1)
+		if (lastSep != m_size-1)
 			result.push_back(SubString(lastSep+1));
 
 		return result.size();
@@ -3585,17 +3616,17 @@ namespace Nz
 
 	unsigned int String::Split(std::vector<String>& result, const char* separation, std::size_t length, std::intmax_t start, UInt32 flags) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return 0;
 		else if (length == 0)
 		{
-			result.reserve(m_sharedString->size);
-			for (std::size_t i = 0; i < m_sharedString->size; ++i)
-				result.push_back(String(m_sharedString->string[i]));
+			result.reserve(m_size);
+			for (std::size_t i = 0; i < m_size; ++i)
+				result.push_back(String(m_string[i]));
 
-			return m_sharedString->size;
+			return m_size;
 		}
-		else if (length > m_sharedString->size)
+		else if (length > m_size)
 		{
 			result.push_back(*this);
 			return 1;
@@ -3620,7 +3651,7 @@ namespace Nz
 			lastSep = sep;
 		}
 
-		if (lastSep != m_sharedString->size - length)
+		if (lastSep != m_size - length)
 			result.push_back(SubString(lastSep + length));
 
 		return result.size()-oldSize;
@@ -3638,7 +3669,7 @@ namespace Nz
 
 	unsigned int String::Split(std::vector<String>& result, const String& separation, std::intmax_t start, UInt32 flags) const
 	{
-		return Split(result, separation.m_sharedString->string.get(), separation.m_sharedString->size, start, flags);
+		return Split(result, separation.m_string, separation.m_size, start, flags);
 	}
 
 	/*!
@@ -3653,7 +3684,7 @@ namespace Nz
 
 	unsigned int String::SplitAny(std::vector<String>& result, const char* separations, std::intmax_t start, UInt32 flags) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return 0;
 
 		std::size_t oldSize = result.size();
@@ -3676,7 +3707,7 @@ namespace Nz
 			lastSep = sep;
 		}
 
-		if (lastSep != m_sharedString->size-1)
+		if (lastSep != m_size-1)
 			result.push_back(SubString(lastSep+1));
 
 		return result.size()-oldSize;
@@ -3694,7 +3725,7 @@ namespace Nz
 
 	unsigned int String::SplitAny(std::vector<String>& result, const String& separations, std::intmax_t start, UInt32 flags) const
 	{
-		return SplitAny(result, separations.m_sharedString->string.get(), start, flags);
+		return SplitAny(result, separations.m_string, start, flags);
 	}
 
 	/*!
@@ -3709,13 +3740,13 @@ namespace Nz
 
 	bool String::StartsWith(char character, UInt32 flags) const
 	{
-		if (character == '\0' || m_sharedString->size == 0)
+		if (character == '\0' || m_size == 0)
 			return false;
 
 		if (flags & CaseInsensitive)
-			return Detail::ToLower(m_sharedString->string[0]) == Detail::ToLower(character);
+			return Detail::ToLower(m_string[0]) == Detail::ToLower(character);
 		else
-			return m_sharedString->string[0] == character;
+			return m_string[0] == character;
 	}
 
 	/*!
@@ -3730,14 +3761,14 @@ namespace Nz
 
 	bool String::StartsWith(const char* string, UInt32 flags) const
 	{
-		if (!string || !string[0] || m_sharedString->size == 0)
+		if (!string || !string[0] || m_size == 0)
 			return false;
 
 		if (flags & CaseInsensitive)
 		{
 			if (flags & HandleUtf8)
 			{
-				utf8::unchecked::iterator<const char*> it(m_sharedString->string.get());
+				utf8::unchecked::iterator<const char*> it(m_string);
 				utf8::unchecked::iterator<const char*> it2(string);
 				do
 				{
@@ -3753,7 +3784,7 @@ namespace Nz
 			}
 			else
 			{
-				char* ptr = m_sharedString->string.get();
+				char* ptr = m_string;
 				const char* s = string;
 				do
 				{
@@ -3770,7 +3801,7 @@ namespace Nz
 		}
 		else
 		{
-			char* ptr = m_sharedString->string.get();
+			char* ptr = m_string;
 			const char* s = string;
 			do
 			{
@@ -3800,17 +3831,17 @@ namespace Nz
 
 	bool String::StartsWith(const String& string, UInt32 flags) const
 	{
-		if (string.m_sharedString->size == 0)
+		if (string.m_size == 0)
 			return false;
 
-		if (m_sharedString->size < string.m_sharedString->size)
+		if (m_size < string.m_size)
 			return false;
 
 		if (flags & CaseInsensitive)
 		{
 			if (flags & HandleUtf8)
 			{
-				utf8::unchecked::iterator<const char*> it(m_sharedString->string.get());
+				utf8::unchecked::iterator<const char*> it(m_string);
 				utf8::unchecked::iterator<const char*> it2(string.GetConstBuffer());
 				do
 				{
@@ -3826,7 +3857,7 @@ namespace Nz
 			}
 			else
 			{
-				char* ptr = m_sharedString->string.get();
+				char* ptr = m_string;
 				const char* s = string.GetConstBuffer();
 				do
 				{
@@ -3842,7 +3873,7 @@ namespace Nz
 			}
 		}
 		else
-			return std::memcmp(m_sharedString->string.get(), string.GetConstBuffer(), string.m_sharedString->size) == 0;
+			return std::memcmp(m_string, string.GetConstBuffer(), string.m_size) == 0;
 
 		return false;
 	}
@@ -3858,27 +3889,28 @@ namespace Nz
 	String String::SubString(std::intmax_t startPos, std::intmax_t endPos) const
 	{
 		if (startPos < 0)
-			startPos = std::max<std::size_t>(m_sharedString->size + startPos, 0);
+			startPos = std::max<std::size_t>(m_size + startPos, 0);
 
 		std::size_t start = static_cast<std::size_t>(startPos);
 
 		if (endPos < 0)
 		{
-			endPos = m_sharedString->size+endPos;
+			endPos = m_size+endPos;
 			if (endPos < 0)
 				return String();
 		}
 
-		std::size_t minEnd = std::min(static_cast<std::size_t>(endPos), m_sharedString->size - 1);
-		if (start > minEnd || start >= m_sharedString->size)
+		std::size_t minEnd = std::min(static_cast<std::size_t>(endPos), m_size - 1);
+		if (start > minEnd || start >= m_size)
 			return String();
 
 		std::size_t size = minEnd - start + 1;
 
-		auto str = std::make_shared<SharedString>(size);
-		std::memcpy(str->string.get(), &m_sharedString->string[start], size);
+		String str;
+		str.AllocateString(size);
+		std::memcpy(str.m_string, &m_string[start], size);
 
-		return String(std::move(str));
+		return str;
 	}
 
 	/*!
@@ -3968,7 +4000,7 @@ namespace Nz
 
 	String String::SubStringFrom(const String& string, std::intmax_t startPos, bool fromLast, bool include, UInt32 flags) const
 	{
-		return SubStringFrom(string.GetConstBuffer(), string.m_sharedString->size, startPos, fromLast, include, flags);
+		return SubStringFrom(string.GetConstBuffer(), string.m_size, startPos, fromLast, include, flags);
 	}
 
 	/*!
@@ -4058,7 +4090,7 @@ namespace Nz
 
 	String String::SubStringTo(const String& string, std::intmax_t startPos, bool toLast, bool include, UInt32 flags) const
 	{
-		return SubStringTo(string.GetConstBuffer(), string.m_sharedString->size, startPos, toLast, include, flags);
+		return SubStringTo(string.GetConstBuffer(), string.m_size, startPos, toLast, include, flags);
 	}
 
 	/*!
@@ -4069,7 +4101,13 @@ namespace Nz
 
 	void String::Swap(String& str)
 	{
-		std::swap(m_sharedString, str.m_sharedString);
+		if (this == &str)
+			return;
+
+		// Local strings point to their own buffer, which can't just be exchanged
+		String temp(std::move(str));
+		str.MoveString(*this);
+		MoveString(temp);
 	}
 
 	/*!
@@ -4082,7 +4120,7 @@ namespace Nz
 
 	bool String::ToBool(bool* value, UInt32 flags) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return false;
 
 		String word = GetWord(0);
@@ -4128,11 +4166,11 @@ namespace Nz
 
 	bool String::ToDouble(double* value) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return false;
 
 		if (value)
-			*value = std::atof(m_sharedString->string.get());
+			*value = std::atof(m_string);
 
 		return true;
 	}
@@ -4167,14 +4205,14 @@ namespace Nz
 
 	String String::ToLower(UInt32 flags) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return *this;
 
 		if (flags & HandleUtf8)
 		{
 			String lower;
-			lower.Reserve(m_sharedString->size);
-			utf8::unchecked::iterator<const char*> it(m_sharedString->string.get());
+			lower.Reserve(m_size);
+			utf8::unchecked::iterator<const char*> it(m_string);
 			do
 				utf8::append(Unicode::GetLowercase(*it), std::back_inserter(lower));
 			while (*++it);
@@ -4183,17 +4221,18 @@ namespace Nz
 		}
 		else
 		{
-			auto str = std::make_shared<SharedString>(m_sharedString->size);
+			String str;
+			str.AllocateString(m_size);
 
-			char* ptr = m_sharedString->string.get();
-			char* s = str->string.get();
+			char* ptr = m_string;
+			char* s = str.m_string;
 			do
 				*s++ = Detail::ToLower(*ptr);
 			while (*++ptr);
 
 			*s = '\0';
 
-			return String(std::move(str));
+			return str;
 		}
 	}
 
@@ -4203,7 +4242,7 @@ namespace Nz
 	*/
 	std::string String::ToStdString() const
 	{
-		return std::string(m_sharedString->string.get(), m_sharedString->size);
+		return std::string(m_string, m_size);
 	}
 
 	/*!
@@ -4214,14 +4253,14 @@ namespace Nz
 	*/
 	String String::ToUpper(UInt32 flags) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return *this;
 
 		if (flags & HandleUtf8)
 		{
 			String upper;
-			upper.Reserve(m_sharedString->size);
-			utf8::unchecked::iterator<const char*> it(m_sharedString->string.get());
+			upper.Reserve(m_size);
+			utf8::unchecked::iterator<const char*> it(m_string);
 			do
 				utf8::append(Unicode::GetUppercase(*it), std::back_inserter(upper));
 			while (*++it);
@@ -4230,17 +4269,18 @@ namespace Nz
 		}
 		else
 		{
-			auto str = std::make_shared<SharedString>(m_sharedString->size);
+			String str;
+			str.AllocateString(m_size);
 
-			char* ptr = m_sharedString->string.get();
-			char* s = str->string.get();
+			char* ptr = m_string;
+			char* s = str.m_string;
 			do
 				*s++ = Detail::ToUpper(*ptr);
 			while (*++ptr);
 
 			*s = '\0';
 
-			return String(std::move(str));
+			return str;
 		}
 	}
 
@@ -4278,7 +4318,7 @@ namespace Nz
 
 	String String::Trimmed(UInt32 flags) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return *this;
 
 		std::size_t startPos;
@@ -4287,7 +4327,7 @@ namespace Nz
 		{
 			if ((flags & TrimOnlyRight) == 0)
 			{
-				utf8::unchecked::iterator<const char*> it(m_sharedString->string.get());
+				utf8::unchecked::iterator<const char*> it(m_string);
 				do
 				{
 					if (!Detail::IsSpace(*it))
@@ -4295,44 +4335,44 @@ namespace Nz
 				}
 				while (*++it);
 
-				startPos = it.base() - m_sharedString->string.get();
+				startPos = it.base() - m_string;
 			}
 			else
 				startPos = 0;
 
 			if ((flags & TrimOnlyLeft) == 0)
 			{
-				utf8::unchecked::iterator<const char*> it(&m_sharedString->string[m_sharedString->size]);
-				while ((it--).base() != m_sharedString->string.get())
+				utf8::unchecked::iterator<const char*> it(&m_string[m_size]);
+				while ((it--).base() != m_string)
 				{
 					if (!Detail::IsSpace(*it))
 						break;
 				}
 
-				endPos = it.base() - m_sharedString->string.get();
+				endPos = it.base() - m_string;
 			}
 			else
-				endPos = m_sharedString->size-1;
+				endPos = m_size-1;
 		}
 		else
 		{
 			startPos = 0;
 			if ((flags & TrimOnlyRight) == 0)
 			{
-				for (; startPos < m_sharedString->size; ++startPos)
+				for (; startPos < m_size; ++startPos)
 				{
-					char c = m_sharedString->string[startPos];
+					char c = m_string[startPos];
 					if (!Detail::IsSpace(c))
 						break;
 				}
 			}
 
-			endPos = m_sharedString->size-1;
+			endPos = m_size-1;
 			if ((flags & TrimOnlyLeft) == 0)
 			{
 				for (; endPos > 0; --endPos)
 				{
-					char c = m_sharedString->string[endPos];
+					char c = m_string[endPos];
 					if (!Detail::IsSpace(c))
 						break;
 				}
@@ -4352,19 +4392,19 @@ namespace Nz
 
 	String String::Trimmed(char character, UInt32 flags) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return *this;
 
 		std::size_t startPos = 0;
-		std::size_t endPos = m_sharedString->size-1;
+		std::size_t endPos = m_size-1;
 		if (flags & CaseInsensitive)
 		{
 			char ch = Detail::ToLower(character);
 			if ((flags & TrimOnlyRight) == 0)
 			{
-				for (; startPos < m_sharedString->size; ++startPos)
+				for (; startPos < m_size; ++startPos)
 				{
-					if (Detail::ToLower(m_sharedString->string[startPos]) != ch)
+					if (Detail::ToLower(m_string[startPos]) != ch)
 						break;
 				}
 			}
@@ -4373,7 +4413,7 @@ namespace Nz
 			{
 				for (; endPos > 0; --endPos)
 				{
-					if (Detail::ToLower(m_sharedString->string[endPos]) != ch)
+					if (Detail::ToLower(m_string[endPos]) != ch)
 						break;
 				}
 			}
@@ -4382,9 +4422,9 @@ namespace Nz
 		{
 			if ((flags & TrimOnlyRight) == 0)
 			{
-				for (; startPos < m_sharedString->size; ++startPos)
+				for (; startPos < m_size; ++startPos)
 				{
-					if (m_sharedString->string[startPos] != character)
+					if (m_string[startPos] != character)
 						break;
 				}
 			}
@@ -4393,7 +4433,7 @@ namespace Nz
 			{
 				for (; endPos > 0; --endPos)
 				{
-					if (m_sharedString->string[endPos] != character)
+					if (m_string[endPos] != character)
 						break;
 				}
 			}
@@ -4409,7 +4449,7 @@ namespace Nz
 
 	char* String::begin()
 	{
-		return m_sharedString->string.get();
+		return m_string;
 	}
 
 	/*!
@@ -4419,7 +4459,7 @@ namespace Nz
 
 	const char* String::begin() const
 	{
-		return m_sharedString->string.get();
+		return m_string;
 	}
 
 	/*!
@@ -4429,7 +4469,7 @@ namespace Nz
 
 	char* String::end()
 	{
-		return &m_sharedString->string[m_sharedString->size];
+		return &m_string[m_size];
 	}
 
 	/*!
@@ -4439,7 +4479,7 @@ namespace Nz
 
 	const char* String::end() const
 	{
-		return &m_sharedString->string[m_sharedString->size];
+		return &m_string[m_size];
 	}
 
 	/*!
@@ -4470,22 +4510,22 @@ namespace Nz
 	/*
 	char* String::rbegin()
 	{
-		return &m_sharedString->string[m_sharedString->size-1];
+		return &m_string[m_size-1];
 	}
 
 	const char* String::rbegin() const
 	{
-		return &m_sharedString->string[m_sharedString->size-1];
+		return &m_string[m_size-1];
 	}
 
 	char* String::rend()
 	{
-		return &m_sharedString->string[-1];
+		return &m_string[-1];
 	}
 
 	const char* String::rend() const
 	{
-		return &m_sharedString->string[-1];
+		return &m_string[-1];
 	}
 	*/
 
@@ -4502,10 +4542,10 @@ namespace Nz
 	{
 		EnsureOwnership();
 
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			Resize(pos+1);
 
-		return m_sharedString->string[pos];
+		return m_string[pos];
 	}
 
 	/*!
@@ -4520,14 +4560,14 @@ namespace Nz
 	char String::operator[](std::size_t pos) const
 	{
 		#if NAZARA_CORE_SAFE
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 		{
-			NazaraError("Index out of range (" + Number(pos) + " >= " + Number(m_sharedString->size) + ')');
+			NazaraError("Index out of range (" + Number(pos) + " >= " + Number(m_size) + ')');
 			return 0;
 		}
 		#endif
 
-		return m_sharedString->string[pos];
+		return m_string[pos];
 	}
 
 	/*!
@@ -4602,11 +4642,12 @@ namespace Nz
 		if (character == '\0')
 			return *this;
 
-		auto str = std::make_shared<SharedString>(m_sharedString->size + 1);
-		std::memcpy(str->string.get(), GetConstBuffer(), m_sharedString->size);
-		str->string[m_sharedString->size] = character;
+		String str;
+		str.AllocateString(m_size + 1);
+		std::memcpy(str.m_string, GetConstBuffer(), m_size);
+		str.m_string[m_size] = character;
 
-		return String(std::move(str));
+		return str;
 	}
 
 	/*!
@@ -4621,18 +4662,19 @@ namespace Nz
 		if (!string || !string[0])
 			return *this;
 
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return string;
 
 		std::size_t length = std::strlen(string);
 		if (length == 0)
 			return *this;
 
-		auto str = std::make_shared<SharedString>(m_sharedString->size + length);
-		std::memcpy(str->string.get(), GetConstBuffer(), m_sharedString->size);
-		std::memcpy(&str->string[m_sharedString->size], string, length+1);
+		String str;
+		str.AllocateString(m_size + length);
+		std::memcpy(str.m_string, GetConstBuffer(), m_size);
+		std::memcpy(&str.m_string[m_size], string, length+1);
 
-		return String(std::move(str));
+		return str;
 	}
 
 	/*!
@@ -4647,14 +4689,15 @@ namespace Nz
 		if (string.empty())
 			return *this;
 
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return string;
 
-		auto str = std::make_shared<SharedString>(m_sharedString->size + string.size());
-		std::memcpy(str->string.get(), GetConstBuffer(), m_sharedString->size);
-		std::memcpy(&str->string[m_sharedString->size], string.c_str(), string.size()+1);
+		String str;
+		str.AllocateString(m_size + string.size());
+		std::memcpy(str.m_string, GetConstBuffer(), m_size);
+		std::memcpy(&str.m_string[m_size], string.c_str(), string.size()+1);
 
-		return String(std::move(str));
+		return str;
 	}
 
 	/*!
@@ -4666,17 +4709,18 @@ namespace Nz
 
 	String String::operator+(const String& string) const
 	{
-		if (string.m_sharedString->size == 0)
+		if (string.m_size == 0)
 			return *this;
 
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return string;
 
-		auto str = std::make_shared<SharedString>(m_sharedString->size + string.m_sharedString->size);
-		std::memcpy(str->string.get(), GetConstBuffer(), m_sharedString->size);
-		std::memcpy(&str->string[m_sharedString->size], string.GetConstBuffer(), string.m_sharedString->size);
+		String str;
+		str.AllocateString(m_size + string.m_size);
+		std::memcpy(str.m_string, GetConstBuffer(), m_size);
+		std::memcpy(&str.m_string[m_size], string.GetConstBuffer(), string.m_size);
 
-		return String(std::move(str));
+		return str;
 	}
 
 	/*!
@@ -4688,7 +4732,7 @@ namespace Nz
 
 	String& String::operator+=(char character)
 	{
-		return Insert(m_sharedString->size, character);
+		return Insert(m_size, character);
 	}
 
 	/*!
@@ -4700,7 +4744,7 @@ namespace Nz
 
 	String& String::operator+=(const char* string)
 	{
-		return Insert(m_sharedString->size, string);
+		return Insert(m_size, string);
 	}
 
 	/*!
@@ -4712,7 +4756,7 @@ namespace Nz
 
 	String& String::operator+=(const std::string& string)
 	{
-		return Insert(m_sharedString->size, string.c_str(), string.size());
+		return Insert(m_size, string.c_str(), string.size());
 	}
 
 	/*!
@@ -4724,7 +4768,7 @@ namespace Nz
 
 	String& String::operator+=(const String& string)
 	{
-		return Insert(m_sharedString->size, string);
+		return Insert(m_size, string);
 	}
 
 	/*!
@@ -4736,13 +4780,13 @@ namespace Nz
 
 	bool String::operator==(char character) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return character == '\0';
 
-		if (m_sharedString->size > 1)
+		if (m_size > 1)
 			return false;
 
-		return m_sharedString->string[0] == character;
+		return m_string[0] == character;
 	}
 
 	/*!
@@ -4754,7 +4798,7 @@ namespace Nz
 
 	bool String::operator==(const char* string) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return !string || !string[0];
 
 		if (!string || !string[0])
@@ -4772,10 +4816,10 @@ namespace Nz
 
 	bool String::operator==(const std::string& string) const
 	{
-		if (m_sharedString->size == 0 || string.empty())
-			return m_sharedString->size == string.size();
+		if (m_size == 0 || string.empty())
+			return m_size == string.size();
 
-		if (m_sharedString->size != string.size())
+		if (m_size != string.size())
 			return false;
 
 		return std::strcmp(GetConstBuffer(), string.c_str()) == 0;
@@ -4790,16 +4834,16 @@ namespace Nz
 
 	bool String::operator!=(char character) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return character != '\0';
 
-		if (character == '\0' || m_sharedString->size != 1)
+		if (character == '\0' || m_size != 1)
 			return true;
 
-		if (m_sharedString->size != 1)
+		if (m_size != 1)
 			return true;
 
-		return m_sharedString->string[0] != character;
+		return m_string[0] != character;
 	}
 
 	/*!
@@ -4811,7 +4855,7 @@ namespace Nz
 
 	bool String::operator!=(const char* string) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return string && string[0];
 
 		if (!string || !string[0])
@@ -4829,10 +4873,10 @@ namespace Nz
 
 	bool String::operator!=(const std::string& string) const
 	{
-		if (m_sharedString->size == 0 || string.empty())
-			return m_sharedString->size == string.size();
+		if (m_size == 0 || string.empty())
+			return m_size == string.size();
 
-		if (m_sharedString->size != string.size())
+		if (m_size != string.size())
 			return false;
 
 		return std::strcmp(GetConstBuffer(), string.c_str()) != 0;
@@ -4850,10 +4894,10 @@ namespace Nz
 		if (character == '\0')
 			return false;
 
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return true;
 
-		return m_sharedString->string[0] < character;
+		return m_string[0] < character;
 	}
 
 	/*!
@@ -4868,7 +4912,7 @@ namespace Nz
 		if (!string || !string[0])
 			return false;
 
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return true;
 
 		return std::strcmp(GetConstBuffer(), string) < 0;
@@ -4886,7 +4930,7 @@ namespace Nz
 		if (string.empty())
 			return false;
 
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return true;
 
 		return std::strcmp(GetConstBuffer(), string.c_str()) < 0;
@@ -4901,13 +4945,13 @@ namespace Nz
 
 	bool String::operator<=(char character) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return true;
 
 		if (character == '\0')
 			return false;
 
-		return m_sharedString->string[0] < character || (m_sharedString->string[0] == character && m_sharedString->size == 1);
+		return m_string[0] < character || (m_string[0] == character && m_size == 1);
 	}
 
 	/*!
@@ -4919,7 +4963,7 @@ namespace Nz
 
 	bool String::operator<=(const char* string) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return true;
 
 		if (!string || !string[0])
@@ -4937,7 +4981,7 @@ namespace Nz
 
 	bool String::operator<=(const std::string& string) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return true;
 
 		if (string.empty())
@@ -4955,13 +4999,13 @@ namespace Nz
 
 	bool String::operator>(char character) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return false;
 
 		if (character == '\0')
 			return true;
 
-		return m_sharedString->string[0] > character;
+		return m_string[0] > character;
 	}
 
 	/*!
@@ -4973,7 +5017,7 @@ namespace Nz
 
 	bool String::operator>(const char* string) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return false;
 
 		if (!string || !string[0])
@@ -4991,7 +5035,7 @@ namespace Nz
 
 	bool String::operator>(const std::string& string) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return false;
 
 		if (string.empty())
@@ -5012,10 +5056,10 @@ namespace Nz
 		if (character == '\0')
 			return true;
 
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return false;
 
-		return m_sharedString->string[0] > character || (m_sharedString->string[0] == character && m_sharedString->size == 1);
+		return m_string[0] > character || (m_string[0] == character && m_size == 1);
 	}
 
 	/*!
@@ -5030,7 +5074,7 @@ namespace Nz
 		if (!string || !string[0])
 			return true;
 
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return false;
 
 		return std::strcmp(GetConstBuffer(), string) >= 0;
@@ -5048,7 +5092,7 @@ namespace Nz
 		if (string.empty())
 			return true;
 
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return false;
 
 		return std::strcmp(GetConstBuffer(), string.c_str()) >= 0;
@@ -5065,10 +5109,11 @@ namespace Nz
 	{
 		std::size_t size = (boolean) ? 4 : 5;
 
-		auto str = std::make_shared<SharedString>(size);
-		std::memcpy(str->string.get(), (boolean) ? "true" : "false", size);
+		String str;
+		str.AllocateString(size);
+		std::memcpy(str.m_string, (boolean) ? "true" : "false", size);
 
-		return String(std::move(str));
+		return str;
 	}
 
 	/*!
@@ -5081,10 +5126,10 @@ namespace Nz
 
 	int String::Compare(const String& first, const String& second)
 	{
-		if (first.m_sharedString->size == 0)
-			return (second.m_sharedString->size == 0) ? 0 : -1;
+		if (first.m_size == 0)
+			return (second.m_size == 0) ? 0 : -1;
 
-		if (second.m_sharedString->size == 0)
+		if (second.m_size == 0)
 			return 1;
 
 		return std::strcmp(first.GetConstBuffer(), second.GetConstBuffer());
@@ -5105,10 +5150,11 @@ namespace Nz
 
 		std::size_t length = std::vsnprintf(nullptr, 0, format, args);
 
-		auto str = std::make_shared<SharedString>(length);
-		std::vsnprintf(str->string.get(), length + 1, format, args2);
+		String str;
+		str.AllocateString(length);
+		std::vsnprintf(str.m_string, length + 1, format, args2);
 
-		return String(std::move(str));
+		return str;
 	}
 
 	/*!
@@ -5300,10 +5346,11 @@ namespace Nz
 	{
 		const std::size_t capacity = sizeof(void*)*2 + 2;
 
-		auto str = std::make_shared<SharedString>(capacity);
-		str->size = std::sprintf(str->string.get(), "0x%p", ptr);
+		String str;
+		str.AllocateString(capacity);
+		str.m_size = std::sprintf(str.m_string, "0x%p", ptr);
 
-		return String(std::move(str));
+		return str;
 	}
 
 	/*!
@@ -5328,10 +5375,11 @@ namespace Nz
 		else
 			count = 4;
 
-		auto str = std::make_shared<SharedString>(count);
-		utf8::append(character, str->string.get());
+		String str;
+		str.AllocateString(count);
+		utf8::append(character, str.m_string);
 
-		return String(std::move(str));
+		return str;
 	}
 
 	/*!
@@ -5366,14 +5414,15 @@ namespace Nz
 
 		count *= 2; // We ensure to have enough place
 
-		auto str = std::make_shared<SharedString>(count);
+		String str;
+		str.AllocateString(count);
 
-		char* r = utf8::utf16to8(u16String, ptr, str->string.get());
+		char* r = utf8::utf16to8(u16String, ptr, str.m_string);
 		*r = '\0';
 
-		str->size = r - str->string.get();
+		str.m_size = r - str.m_string;
 
-		return String(std::move(str));
+		return str;
 	}
 
 	/*!
@@ -5404,10 +5453,11 @@ namespace Nz
 		}
 		while (*++ptr);
 
-		auto str = std::make_shared<SharedString>(count);
-		utf8::utf32to8(u32String, ptr, str->string.get());
+		String str;
+		str.AllocateString(count);
+		utf8::utf32to8(u32String, ptr, str.m_string);
 
-		return String(std::move(str));
+		return str;
 	}
 
 	/*!
@@ -5438,10 +5488,11 @@ namespace Nz
 		}
 		while (*++ptr);
 
-		auto str = std::make_shared<SharedString>(count);
-		utf8::utf32to8(wString, ptr, str->string.get());
+		String str;
+		str.AllocateString(count);
+		utf8::utf32to8(wString, ptr, str.m_string);
 
-		return String(std::move(str));
+		return str;
 	}
 
 	/*!
@@ -5489,7 +5540,7 @@ namespace Nz
 		if (str.IsEmpty())
 			return os;
 
-		return operator<<(os, str.m_sharedString->string.get());
+		return operator<<(os, str.m_string);
 	}
 
 	/*!
@@ -5508,11 +5559,12 @@ namespace Nz
 		if (string.IsEmpty())
 			return String(character);
 
-		auto str = std::make_shared<String::SharedString>(string.m_sharedString->size + 1);
-		str->string[0] = character;
-		std::memcpy(&str->string[1], string.GetConstBuffer(), string.m_sharedString->size);
+		String str;
+		str.AllocateString(string.m_size + 1);
+		str.m_string[0] = character;
+		std::memcpy(&str.m_string[1], string.GetConstBuffer(), string.m_size);
 
-		return String(std::move(str));
+		return str;
 	}
 
 	/*!
@@ -5532,13 +5584,14 @@ namespace Nz
 			return string;
 
 		std::size_t size = std::strlen(string);
-		std::size_t totalSize = size + nstring.m_sharedString->size;
+		std::size_t totalSize = size + nstring.m_size;
 
-		auto str = std::make_shared<String::SharedString>(totalSize);
-		std::memcpy(str->string.get(), string, size);
-		std::memcpy(&str->string[size], nstring.GetConstBuffer(), nstring.m_sharedString->size+1);
+		String str;
+		str.AllocateString(totalSize);
+		std::memcpy(str.m_string, string, size);
+		std::memcpy(&str.m_string[size], nstring.GetConstBuffer(), nstring.m_size+1);
 
-		return String(std::move(str));
+		return str;
 	}
 
 	/*!
@@ -5554,16 +5607,17 @@ namespace Nz
 		if (string.empty())
 			return nstring;
 
-		if (nstring.m_sharedString->size == 0)
+		if (nstring.m_size == 0)
 			return string;
 
-		std::size_t totalSize = string.size() + nstring.m_sharedString->size;
+		std::size_t totalSize = string.size() + nstring.m_size;
 
-		auto str = std::make_shared<String::SharedString>(totalSize);
-		std::memcpy(str->string.get(), string.c_str(), string.size());
-		std::memcpy(&str->string[string.size()], nstring.GetConstBuffer(), nstring.m_sharedString->size+1);
+		String str;
+		str.AllocateString(totalSize);
+		std::memcpy(str.m_string, string.c_str(), string.size());
+		std::memcpy(&str.m_string[string.size()], nstring.GetConstBuffer(), nstring.m_size+1);
 
-		return String(std::move(str));
+		return str;
 	}
 
 	/*!
@@ -5576,13 +5630,13 @@ namespace Nz
 
 	bool operator==(const String& first, const String& second)
 	{
-		if (first.m_sharedString->size == 0 || second.m_sharedString->size == 0)
-			return first.m_sharedString->size == second.m_sharedString->size;
+		if (first.m_size == 0 || second.m_size == 0)
+			return first.m_size == second.m_size;
 
-		if (first.m_sharedString->size != second.m_sharedString->size)
+		if (first.m_size != second.m_size)
 			return false;
 
-		if (first.m_sharedString == second.m_sharedString)
+		if (first.m_string == second.m_string)
 			return true;
 
 		return std::strcmp(first.GetConstBuffer(), second.GetConstBuffer()) == 0;
@@ -5611,10 +5665,10 @@ namespace Nz
 
 	bool operator<(const String& first, const String& second)
 	{
-		if (second.m_sharedString->size == 0)
+		if (second.m_size == 0)
 			return false;
 
-		if (first.m_sharedString->size == 0)
+		if (first.m_size == 0)
 			return true;
 
 		return std::strcmp(first.GetConstBuffer(), second.GetConstBuffer()) < 0;
@@ -5893,6 +5947,33 @@ namespace Nz
 		return !operator<(string, nstring);
 	}
 
+	/*!
+	* \brief Allocates the characters of a string, releasing its previous ones
+	*
+	* \param size Number of characters in the string, whose content is left uninitialized
+	* \param capacity Number of characters the string can hold without reallocating
+	*
+	* \remark Short strings are stored in the string itself, without any allocation
+	*/
+
+	void String::AllocateString(std::size_t size, std::size_t capacity)
+	{
+		ReleaseString();
+
+		capacity = std::max(size, capacity);
+		if (capacity > LocalCapacity)
+		{
+			m_sharedString = static_cast<SharedString*>(::operator new(sizeof(SharedString) + capacity + 1));
+			m_sharedString->capacity = capacity;
+			m_sharedString->refCount = 1;
+
+			m_string = reinterpret_cast<char*>(m_sharedString + 1);
+		}
+
+		m_size = size;
+		m_string[size] = '\0';
+	}
+
 	/*!
 	* \brief Ensures the ownership of the string
 	*
@@ -5901,28 +5982,33 @@ namespace Nz
 
 	void String::EnsureOwnership(bool discardContent)
 	{
-		if (!m_sharedString)
+		if (IsLocal() || m_sharedString->refCount == 1)
 			return;
 
-		if (!m_sharedString.unique())
-		{
-			auto newSharedString = std::make_shared<SharedString>(GetSize(), GetCapacity());
-			if (!discardContent && newSharedString->size > 0)
-				std::memcpy(newSharedString->string.get(), GetConstBuffer(), GetSize()+1);
+		String newString;
+		newString.AllocateString(m_size, GetCapacity());
+		if (!discardContent && m_size > 0)
+			std::memcpy(newString.m_string, m_string, m_size);
 
-			m_sharedString = std::move(newSharedString);
-		}
+		Swap(newString);
 	}
 
 	/*!
-	* \brief Gets the empty string
-	* \return A reference to the empty string
+	* \brief Releases the characters of the string, leaving it empty
 	*/
 
-	const std::shared_ptr<String::SharedString>& String::GetEmptyString()
+	void String::ReleaseString()
 	{
-		static auto emptyString = std::make_shared<SharedString>();
-		return emptyString;
+		if (!IsLocal())
+		{
+			if (--m_sharedString->refCount == 0)
+				::operator delete(m_sharedString);
+
+			m_string = m_localString;
+		}
+
+		m_localString[0] = '\0';
+		m_size = 0;
 	}
 
 	/*!
@@ -5957,6 +6043,7 @@ namespace Nz
 		return context.stream->Read(string->GetBuffer(), size) == size;
 	}
 
+	constexpr std::size_t String::LocalCapacity;
 	const std::size_t String::npos(std::numeric_limits<std::size_t>::max());
 }
 
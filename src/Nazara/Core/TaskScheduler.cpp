@@ -5,6 +5,9 @@
 #include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/HardwareInfo.hpp>
+#include <Nazara/Core/Metrics.hpp>
+#include <Nazara/Core/TaskGroup.hpp>
+#include <algorithm>
 
 #if defined(NAZARA_PLATFORM_WINDOWS)
 	#include <Nazara/Core/Win32/TaskSchedulerImpl.hpp>
@@ -20,8 +23,10 @@ namespace Nz
 {
 	namespace
 	{
-		std::vector<Functor*> s_pendingWorks;
+		std::vector<TaskSchedulerImpl::Task> s_pendingWorks;
+		UInt32 s_queuedTasksMetric = Metrics::InvalidId;
 		unsigned int s_workerCount = 0;
+		bool s_workerPinning = false;
 	}
 
 	/*!
@@ -30,8 +35,51 @@ namespace Nz
 	* \brief Core class that represents a pool of threads
 	*
 	* \remark Initialized should be called first
+	*
+	* Each worker owns its own queue, idle workers steal tasks from the others and threads waiting for tasks help executing them
+	*
+	* When worker pinning is enabled, each worker is bound to a logical processor, physical cores being used before their SMT siblings,
+	* and idle workers steal from the workers of their own NUMA node first
 	*/
 
+	/*!
+	* \brief Enables or disables the pinning of workers to logical processors
+	*
+	* \param enable Should workers be pinned
+	*
+	* \remark Produce a NazaraError if the class is initialized and NAZARA_CORE_SAFE is defined
+	* \remark Disabled by default, as pinned workers compete badly with other processes
+	*/
+
+	void TaskScheduler::EnableWorkerPinning(bool enable)
+	{
+		#ifdef NAZARA_CORE_SAFE
+		if (TaskSchedulerImpl::IsInitialized())
+		{
+			NazaraError("Worker pinning cannot be changed while initialized");
+			return;
+		}
+		#endif
+
+		s_workerPinning = enable;
+	}
+
+	/*!
+	* \brief Gets the number of tasks waiting for a worker
+	* \return Number of tasks handed to the workers by Run and not started yet
+	*
+	* \remark This can be called from any thread, the count may be slightly out of date as workers keep running
+	* \remark Tasks added since the last call to Run are not counted
+	*/
+
+	std::size_t TaskScheduler::GetQueuedTaskCount()
+	{
+		if (!TaskSchedulerImpl::IsInitialized())
+			return 0;
+
+		return TaskSchedulerImpl::GetQueuedTaskCount();
+	}
+
 	/*!
 	* \brief Gets the number of threads
 	* \return Number of threads, if none, the number of simulatenous threads on the processor is returned
@@ -49,7 +97,33 @@ namespace Nz
 
 	bool TaskScheduler::Initialize()
 	{
-		return TaskSchedulerImpl::Initialize(GetWorkerCount());
+		if (TaskSchedulerImpl::IsInitialized())
+			return true;
+
+		unsigned int workerCount = GetWorkerCount();
+		bool initialized;
+		if (s_workerPinning)
+		{
+			std::vector<WorkerPlacement> placements = ComputeWorkerPlacement(workerCount);
+			initialized = TaskSchedulerImpl::Initialize(workerCount, placements.data());
+		}
+		else
+			initialized = TaskSchedulerImpl::Initialize(workerCount, nullptr);
+
+		if (initialized)
+			s_queuedTasksMetric = Metrics::Register(MetricType_Gauge, "nazara_taskscheduler_queued_tasks", "Tasks waiting for a worker", [] () { return static_cast<double>(GetQueuedTaskCount()); });
+
+		return initialized;
+	}
+
+	/*!
+	* \brief Checks whether workers are pinned to logical processors
+	* \return true If worker pinning is enabled
+	*/
+
+	bool TaskScheduler::IsWorkerPinningEnabled()
+	{
+		return s_workerPinning;
 	}
 
 	/*!
@@ -101,7 +175,12 @@ namespace Nz
 	void TaskScheduler::Uninitialize()
 	{
 		if (TaskSchedulerImpl::IsInitialized())
+		{
+			Metrics::Unregister(s_queuedTasksMetric);
+			s_queuedTasksMetric = Metrics::InvalidId;
+
 			TaskSchedulerImpl::Uninitialize();
+		}
 	}
 
 	/*!
@@ -121,16 +200,41 @@ namespace Nz
 		TaskSchedulerImpl::WaitForTasks();
 	}
 
+	/*!
+	* \brief Waits for the tasks of a group to be done
+	*
+	* Pending works are run first, since the group could be waiting on them, and the calling thread helps executing queued tasks while waiting
+	*
+	* \param group Group to wait for
+	*
+	* \remark Produce a NazaraError if the class is not initialized
+	*/
+
+	void TaskScheduler::WaitForTasks(TaskGroup& group)
+	{
+		if (!Initialize())
+		{
+			NazaraError("Failed to initialize Task Scheduler");
+			return;
+		}
+
+		if (!s_pendingWorks.empty())
+			Run();
+
+		TaskSchedulerImpl::WaitForTasks(group);
+	}
+
 	/*!
 	* \brief Adds a task on the pending list
 	*
 	* \param taskFunctor Functor represeting a task to be done
+	* \param group Optional group the task belongs to
 	*
 	* \remark Produce a NazaraError if the class is not initialized
 	* \remark A task containing a call on this class is undefined behaviour
 	*/
 
-	void TaskScheduler::AddTaskFunctor(Functor* taskFunctor)
+	void TaskScheduler::AddTaskFunctor(Functor* taskFunctor, TaskGroup* group)
 	{
 		if (!Initialize())
 		{
@@ -138,6 +242,79 @@ namespace Nz
 			return;
 		}
 
-		s_pendingWorks.push_back(taskFunctor);
+		if (group)
+			group->m_pendingTaskCount++;
+
+		s_pendingWorks.push_back({taskFunctor, group});
+	}
+
+	/*!
+	* \brief Computes the chunk size used to split a range
+	* \return grainSize if non-zero, or a size giving a few chunks to each worker
+	*
+	* \param count Number of elements of the range
+	* \param grainSize Requested chunk size, zero for an automatic one
+	*/
+
+	std::size_t TaskScheduler::ComputeGrainSize(std::size_t count, std::size_t grainSize)
+	{
+		if (grainSize > 0)
+			return grainSize;
+
+		// Multiple chunks per worker allows workers finishing early to help the others
+		constexpr std::size_t ChunkPerWorker = 4;
+
+		std::size_t chunkCount = GetWorkerCount() * ChunkPerWorker;
+		return std::max<std::size_t>((count + chunkCount - 1) / chunkCount, 1);
+	}
+
+	/*!
+	* \brief Computes the logical processor and NUMA node of each worker
+	* \return Placement of each worker, workers of the same node being contiguous
+	*
+	* \param workerCount Number of workers to place
+	*
+	* \remark Processors are used once each before being shared by multiple workers
+	*/
+
+	std::vector<TaskScheduler::WorkerPlacement> TaskScheduler::ComputeWorkerPlacement(unsigned int workerCount)
+	{
+		const std::vector<LogicalProcessor>& logicalProcessors = HardwareInfo::GetLogicalProcessors();
+
+		// Every physical core gets a worker before any SMT sibling does, spreading them across the nodes
+		std::vector<unsigned int> processors(logicalProcessors.size());
+		for (unsigned int i = 0; i < processors.size(); ++i)
+			processors[i] = i;
+
+		std::stable_sort(processors.begin(), processors.end(), [&](unsigned int lhs, unsigned int rhs)
+		{
+			const LogicalProcessor& first = logicalProcessors[lhs];
+			const LogicalProcessor& second = logicalProcessors[rhs];
+
+			if (first.smtIndex != second.smtIndex)
+				return first.smtIndex < second.smtIndex;
+
+			if (first.coreId != second.coreId)
+				return first.coreId < second.coreId;
+
+			return first.nodeId < second.nodeId;
+		});
+
+		std::vector<WorkerPlacement> placements(workerCount);
+		for (unsigned int i = 0; i < workerCount; ++i)
+		{
+			unsigned int processor = processors[i % processors.size()];
+
+			placements[i].node = logicalProcessors[processor].nodeId;
+			placements[i].processor = processor;
+		}
+
+		// Tasks are handed to workers in contiguous ranges, grouping workers by node keeps neighbouring tasks on the same node
+		std::stable_sort(placements.begin(), placements.end(), [](const WorkerPlacement& lhs, const WorkerPlacement& rhs)
+		{
+			return lhs.node < rhs.node;
+		});
+
+		return placements;
 	}
 }
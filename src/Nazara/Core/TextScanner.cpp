@@ -0,0 +1,285 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/TextScanner.hpp>
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/Stream.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		inline bool IsDigit(char character)
+		{
+			return character >= '0' && character <= '9';
+		}
+
+		const char* FindCommentMarker(const char* begin, const char* end, const char* marker, std::size_t markerSize)
+		{
+			while (static_cast<std::size_t>(end - begin) >= markerSize)
+			{
+				const char* ptr = static_cast<const char*>(std::memchr(begin, marker[0], end - begin));
+				if (!ptr || static_cast<std::size_t>(end - ptr) < markerSize)
+					break;
+
+				if (std::memcmp(ptr, marker, markerSize) == 0)
+					return ptr;
+
+				begin = ptr + 1;
+			}
+
+			return end;
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::TextScanner
+	* \brief Core class that reads a text in memory line by line and word by word, without copying it
+	*
+	* Lines are separated by '\n' ("\r\n" is handled as well), blank lines are skipped and everything after a comment marker is ignored.
+	* Numbers are parsed in place, without going through a String or the C locale.
+	*
+	* \remark The text must outlive the scanner
+	*/
+
+	/*!
+	* \brief Constructs a TextScanner object over the content of a stream
+	*
+	* The stream is read from its cursor to its end, in place if it lives in memory (see Stream::GetMappedPointer) or into a buffer owned by the scanner otherwise.
+	*
+	* \param stream Stream to read, its cursor is moved past the text
+	* \param sizeLimit Maximum size of the text to read
+	*
+	* \remark A mapped stream must outlive the scanner
+	*/
+	TextScanner::TextScanner(Stream& stream, UInt64 sizeLimit) :
+	TextScanner()
+	{
+		UInt64 cursorPos = stream.GetCursorPos();
+		UInt64 streamSize = stream.GetSize();
+		std::size_t size = static_cast<std::size_t>(std::min((streamSize > cursorPos) ? streamSize - cursorPos : 0, sizeLimit));
+
+		const char* text;
+		if (const void* mappedPointer = stream.GetMappedPointer())
+		{
+			text = static_cast<const char*>(mappedPointer) + cursorPos;
+			stream.SetCursorPos(cursorPos + size);
+		}
+		else
+		{
+			m_buffer.resize(size);
+			size = (size > 0) ? stream.Read(m_buffer.data(), size) : 0;
+			text = m_buffer.data();
+		}
+
+		m_begin = text;
+		m_cursor = text;
+		m_end = text + size;
+		m_lineBegin = text;
+		m_lineEnd = text;
+		m_nextLine = text;
+	}
+
+	/*!
+	* \brief Moves to the next line which is not blank
+	* \return true if a line was found, false if the end of the text was reached
+	*/
+	bool TextScanner::NextLine()
+	{
+		while (m_nextLine < m_end)
+		{
+			const char* lineBegin = m_nextLine;
+			const char* lineEnd = static_cast<const char*>(std::memchr(lineBegin, '\n', m_end - lineBegin));
+			if (lineEnd)
+				m_nextLine = lineEnd + 1;
+			else
+			{
+				lineEnd = m_end;
+				m_nextLine = m_end;
+			}
+
+			m_lineNumber++;
+
+			if (m_commentMarkerSize > 0)
+				lineEnd = FindCommentMarker(lineBegin, lineEnd, m_commentMarker, m_commentMarkerSize);
+
+			while (lineBegin < lineEnd && IsBlank(*lineBegin))
+				lineBegin++;
+
+			while (lineEnd > lineBegin && IsBlank(lineEnd[-1]))
+				lineEnd--;
+
+			if (lineBegin != lineEnd)
+			{
+				m_cursor = lineBegin;
+				m_lineBegin = lineBegin;
+				m_lineEnd = lineEnd;
+				return true;
+			}
+		}
+
+		m_cursor = m_end;
+		m_lineBegin = m_end;
+		m_lineEnd = m_end;
+		return false;
+	}
+
+	/*!
+	* \brief Parses a floating-point number
+	* \return Pointer to the character following the number, or nullptr if no number was found
+	*
+	* \param begin Pointer to the first character of the number
+	* \param end Pointer past the last character which can be read
+	* \param value Pointer to the number to fill
+	*
+	* \remark Accepts the decimal notation of strtof ("-1", "1.5", ".5", "2.", "1e-3"), independently of the locale
+	* \remark Digits past the nineteenth significant one are ignored, which can only affect the last bit of a double
+	*/
+	const char* TextScanner::ParseFloat(const char* begin, const char* end, float* value)
+	{
+		static constexpr double powersOfTen[] = {
+			1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+			1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+		};
+		static constexpr int maxExactPower = static_cast<int>(CountOf(powersOfTen)) - 1;
+		static constexpr UInt64 mantissaLimit = 1000000000000000000ULL; //< Any more digit could overflow
+
+		const char* ptr = begin;
+
+		bool negative = false;
+		if (ptr < end && (*ptr == '-' || *ptr == '+'))
+			negative = (*ptr++ == '-');
+
+		UInt64 mantissa = 0;
+		int exponent = 0;
+		bool hasDigits = false;
+
+		for (; ptr < end && IsDigit(*ptr); ++ptr)
+		{
+			hasDigits = true;
+			if (mantissa < mantissaLimit)
+				mantissa = mantissa * 10 + (*ptr - '0');
+			else
+				exponent++;
+		}
+
+		if (ptr < end && *ptr == '.')
+		{
+			for (++ptr; ptr < end && IsDigit(*ptr); ++ptr)
+			{
+				hasDigits = true;
+				if (mantissa < mantissaLimit)
+				{
+					mantissa = mantissa * 10 + (*ptr - '0');
+					exponent--;
+				}
+			}
+		}
+
+		if (!hasDigits)
+			return nullptr;
+
+		if (ptr < end && (*ptr == 'e' || *ptr == 'E'))
+		{
+			// The exponent is only part of the number if it has digits
+			const char* exponentPtr = ptr + 1;
+
+			bool negativeExponent = false;
+			if (exponentPtr < end && (*exponentPtr == '-' || *exponentPtr == '+'))
+				negativeExponent = (*exponentPtr++ == '-');
+
+			if (exponentPtr < end && IsDigit(*exponentPtr))
+			{
+				int explicitExponent = 0;
+				for (; exponentPtr < end && IsDigit(*exponentPtr); ++exponentPtr)
+				{
+					if (explicitExponent < 10000)
+						explicitExponent = explicitExponent * 10 + (*exponentPtr - '0');
+				}
+
+				exponent += (negativeExponent) ? -explicitExponent : explicitExponent;
+				ptr = exponentPtr;
+			}
+		}
+
+		double result = static_cast<double>(mantissa);
+		if (mantissa != 0)
+		{
+			if (exponent >= 0 && exponent <= maxExactPower)
+				result *= powersOfTen[exponent];
+			else if (exponent < 0 && exponent >= -maxExactPower)
+				result /= powersOfTen[-exponent];
+			else
+				result *= std::pow(10.0, exponent);
+		}
+
+		*value = static_cast<float>((negative) ? -result : result);
+		return ptr;
+	}
+
+	/*!
+	* \brief Parses a signed integer
+	* \return Pointer to the character following the number, or nullptr if no number was found
+	*
+	* \param begin Pointer to the first character of the number
+	* \param end Pointer past the last character which can be read
+	* \param value Pointer to the number to fill
+	*
+	* \remark Numbers out of the range of Int32 are clamped
+	*/
+	const char* TextScanner::ParseInteger(const char* begin, const char* end, Int32* value)
+	{
+		const char* ptr = begin;
+
+		bool negative = false;
+		if (ptr < end && (*ptr == '-' || *ptr == '+'))
+			negative = (*ptr++ == '-');
+
+		UInt32 absolute;
+		ptr = ParseInteger(ptr, end, &absolute);
+		if (!ptr)
+			return nullptr;
+
+		if (negative)
+			*value = (absolute > UInt32(std::numeric_limits<Int32>::max()) + 1) ? std::numeric_limits<Int32>::min() : static_cast<Int32>(-static_cast<Int64>(absolute));
+		else
+			*value = (absolute > UInt32(std::numeric_limits<Int32>::max())) ? std::numeric_limits<Int32>::max() : static_cast<Int32>(absolute);
+
+		return ptr;
+	}
+
+	/*!
+	* \brief Parses an unsigned integer
+	* \return Pointer to the character following the number, or nullptr if no number was found
+	*
+	* \param begin Pointer to the first character of the number
+	* \param end Pointer past the last character which can be read
+	* \param value Pointer to the number to fill
+	*
+	* \remark Numbers out of the range of UInt32 are clamped
+	*/
+	const char* TextScanner::ParseInteger(const char* begin, const char* end, UInt32* value)
+	{
+		const char* ptr = begin;
+
+		UInt64 result = 0;
+		for (; ptr < end && IsDigit(*ptr); ++ptr)
+		{
+			if (result <= std::numeric_limits<UInt32>::max())
+				result = result * 10 + (*ptr - '0');
+		}
+
+		if (ptr == begin)
+			return nullptr;
+
+		*value = static_cast<UInt32>(std::min<UInt64>(result, std::numeric_limits<UInt32>::max()));
+		return ptr;
+	}
+}
@@ -7,6 +7,7 @@
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/HardwareInfo.hpp>
 #include <Nazara/Core/MovablePtr.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <ostream>
 
 #if defined(NAZARA_PLATFORM_WINDOWS)
@@ -105,6 +106,24 @@ namespace Nz
 		m_impl = nullptr;
 	}
 
+	/*!
+	* \brief Restricts the logical processors the thread may run on
+	* \return true if the system accepted the affinity
+	*
+	* \param processors Bit of each logical processor (indexed like HardwareInfo::GetLogicalProcessors) the thread may run on
+	*
+	* \remark On Windows, only the 64 first processors can be used
+	*
+	* \see SetCurrentThreadAffinity
+	*/
+	bool Thread::SetAffinity(const Bitset<>& processors)
+	{
+		NazaraAssert(m_impl, "Invalid thread");
+		NazaraAssert(processors.TestAny(), "Thread must be allowed to run on at least one processor");
+
+		return m_impl->SetAffinity(processors);
+	}
+
 	/*!
 	* \brief Changes the debugging name associated to a thread
 	*
@@ -124,6 +143,23 @@ namespace Nz
 		m_impl->SetName(name);
 	}
 
+	/*!
+	* \brief Changes the scheduling priority of the thread
+	* \return true if the system accepted the priority
+	*
+	* \param priority New priority
+	*
+	* \remark On POSIX systems, priorities above normal require the real-time scheduling policy, which is usually reserved to privileged users
+	*
+	* \see SetCurrentThreadPriority
+	*/
+	bool Thread::SetPriority(ThreadPriority priority)
+	{
+		NazaraAssert(m_impl, "Invalid thread");
+
+		return m_impl->SetPriority(priority);
+	}
+
 	/*!
 	* \brief Gets the number of simulatenous threads that can run on the same cpu
 	* \return The number of simulatenous threads
@@ -134,6 +170,21 @@ namespace Nz
 	}
 
 
+	/*!
+	* \brief Restricts the logical processors the calling thread may run on
+	* \return true if the system accepted the affinity
+	*
+	* \param processors Bit of each logical processor (indexed like HardwareInfo::GetLogicalProcessors) the thread may run on
+	*
+	* \see SetAffinity
+	*/
+	bool Thread::SetCurrentThreadAffinity(const Bitset<>& processors)
+	{
+		NazaraAssert(processors.TestAny(), "Thread must be allowed to run on at least one processor");
+
+		return ThreadImpl::SetCurrentAffinity(processors);
+	}
+
 	/*!
 	* \brief Changes the debugging name associated to the calling thread
 	*
@@ -142,6 +193,7 @@ namespace Nz
 	* \param name The new name associated with this thread
 	*
 	* \remark Due to system limitations, thread name cannot exceed 15 characters (excluding null-terminator)
+	* \remark The name is also used by the Profiler timeline
 	*
 	* \see SetName
 	*/
@@ -150,6 +202,20 @@ namespace Nz
 		NazaraAssert(name.GetSize() < 16, "Thread name is too long");
 
 		ThreadImpl::SetCurrentName(name);
+		Profiler::SetThreadName(name);
+	}
+
+	/*!
+	* \brief Changes the scheduling priority of the calling thread
+	* \return true if the system accepted the priority
+	*
+	* \param priority New priority
+	*
+	* \see SetPriority
+	*/
+	bool Thread::SetCurrentThreadPriority(ThreadPriority priority)
+	{
+		return ThreadImpl::SetCurrentPriority(priority);
 	}
 
 	/*!
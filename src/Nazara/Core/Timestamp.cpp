@@ -0,0 +1,161 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Timestamp.hpp>
+#include <Nazara/Core/HardwareInfo.hpp>
+#include <Nazara/Core/Thread.hpp>
+
+#if defined(NAZARA_PLATFORM_WINDOWS)
+	#include <Nazara/Core/Win32/ClockImpl.hpp>
+#elif defined(NAZARA_PLATFORM_POSIX)
+	#include <Nazara/Core/Posix/ClockImpl.hpp>
+#else
+	#error OS not handled
+#endif
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+	#define NAZARA_TIMESTAMP_TSC
+
+	#if defined(NAZARA_COMPILER_MSVC)
+		#include <intrin.h>
+	#else
+		#include <x86intrin.h>
+	#endif
+#endif
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		constexpr UInt32 CalibrationDuration = 10; //< Milliseconds
+
+		UInt64 GetMicrosecondsLowPrecision()
+		{
+			return ClockImplGetElapsedMilliseconds() * 1000ULL;
+		}
+
+		#ifdef NAZARA_TIMESTAMP_TSC
+		UInt64 ReadTsc()
+		{
+			return __rdtsc();
+		}
+
+		bool HasInvariantTsc()
+		{
+			if (!HardwareInfo::IsCpuidSupported())
+				return false;
+
+			UInt32 registers[4];
+			HardwareInfo::Cpuid(0x80000000, 0, registers);
+			if (registers[0] < 0x80000007)
+				return false;
+
+			// Advanced power management information, the counter is invariant across P-, C- and T-states if EDX bit 8 is set
+			HardwareInfo::Cpuid(0x80000007, 0, registers);
+			return (registers[3] & (1U << 8)) != 0;
+		}
+
+		UInt64 QueryTscFrequency(bool highPrecisionClock)
+		{
+			// Recent Intel processors report the counter frequency relatively to their crystal clock
+			UInt32 registers[4];
+			HardwareInfo::Cpuid(0, 0, registers);
+			if (registers[0] >= 0x15)
+			{
+				HardwareInfo::Cpuid(0x15, 0, registers);
+				if (registers[0] != 0 && registers[1] != 0 && registers[2] != 0)
+					return static_cast<UInt64>(registers[2]) * registers[1] / registers[0];
+			}
+
+			// Otherwise measure it against the system clock
+			if (!highPrecisionClock)
+				return 0;
+
+			UInt64 startMicroseconds = ClockImplGetElapsedMicroseconds();
+			UInt64 startTicks = ReadTsc();
+
+			Thread::Sleep(CalibrationDuration);
+
+			UInt64 elapsedMicroseconds = ClockImplGetElapsedMicroseconds() - startMicroseconds;
+			UInt64 elapsedTicks = ReadTsc() - startTicks;
+			if (elapsedMicroseconds == 0)
+				return 0;
+
+			return elapsedTicks * 1'000'000ULL / elapsedMicroseconds;
+		}
+		#endif
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::Timestamp
+	* \brief Core class giving access to a low-overhead timestamp source
+	*
+	* The processor time-stamp counter is used when it is invariant (ticking at a constant rate whatever the power state of the cores, and synchronized between them),
+	* otherwise the timestamps fall back to the system high-precision clock.
+	*/
+
+	/*!
+	* \brief Checks whether timestamps are read from the processor time-stamp counter
+	* \return true If it is the case, false if they come from the system clock
+	*/
+	bool Timestamp::IsTscBased()
+	{
+		#ifdef NAZARA_TIMESTAMP_TSC
+		GetFrequency();
+
+		return s_now.load(std::memory_order_relaxed) == &ReadTsc;
+		#else
+		return false;
+		#endif
+	}
+
+	/*!
+	* \brief Selects the timestamp source
+	* \return Frequency of the selected source
+	*
+	* \remark Measuring the time-stamp counter frequency (when the processor doesn't report it) takes a few milliseconds, this only happens once
+	*/
+	UInt64 Timestamp::Initialize()
+	{
+		static UInt64 frequency = []() -> UInt64
+		{
+			bool highPrecisionClock = ClockImplInitializeHighPrecision();
+
+			ClockFunction now = (highPrecisionClock) ? &ClockImplGetElapsedMicroseconds : &GetMicrosecondsLowPrecision;
+			UInt64 nowFrequency = 1'000'000ULL;
+
+			#ifdef NAZARA_TIMESTAMP_TSC
+			if (HasInvariantTsc())
+			{
+				UInt64 tscFrequency = QueryTscFrequency(highPrecisionClock);
+				if (tscFrequency != 0)
+				{
+					now = &ReadTsc;
+					nowFrequency = tscFrequency;
+				}
+			}
+			#endif
+
+			s_now.store(now, std::memory_order_relaxed);
+			s_frequency.store(nowFrequency, std::memory_order_relaxed);
+
+			return nowFrequency;
+		}();
+
+		return frequency;
+	}
+
+	UInt64 Timestamp::NowFirstRun()
+	{
+		Initialize();
+
+		return s_now.load(std::memory_order_relaxed)();
+	}
+
+	std::atomic<ClockFunction> Timestamp::s_now(&Timestamp::NowFirstRun);
+	std::atomic<UInt64> Timestamp::s_frequency(0);
+}
@@ -0,0 +1,135 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/VirtualFile.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/File.hpp>
+#include <algorithm>
+#include <cstring>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::VirtualFile
+	* \brief Core class that represents a read-only file of a mounted archive
+	*
+	* Virtual files are opened by VirtualFileSystem::Open, they keep the path they were opened with so stream loaders may find neighbouring files.
+	*
+	* \see VirtualFileSystem
+	*/
+
+	/*!
+	* \brief Constructs a VirtualFile object with no file
+	*/
+	VirtualFile::VirtualFile() :
+	Stream(StreamOption_None, OpenMode_ReadOnly),
+	m_data(nullptr),
+	m_pos(0),
+	m_size(0)
+	{
+	}
+
+	/*!
+	* \brief Closes the file
+	*/
+	void VirtualFile::Close()
+	{
+		m_buffer.Clear();
+		m_filePath.Clear();
+		m_data = nullptr;
+		m_pos = 0;
+		m_size = 0;
+	}
+
+	/*!
+	* \brief Checks whether the stream reached the end of the file
+	* \return true if cursor is at the end of the file
+	*/
+	bool VirtualFile::EndOfStream() const
+	{
+		return m_pos >= m_size;
+	}
+
+	/*!
+	* \brief Gets the position of the cursor in the file
+	* \return Position of the cursor
+	*/
+	UInt64 VirtualFile::GetCursorPos() const
+	{
+		return m_pos;
+	}
+
+	/*!
+	* \brief Gets the directory of the file
+	* \return Directory of the file
+	*/
+	String VirtualFile::GetDirectory() const
+	{
+		return File::GetDirectory(m_filePath);
+	}
+
+	/*!
+	* \brief Gets a pointer to the file content
+	* \return Pointer to the beginning of the file content
+	*/
+	const void* VirtualFile::GetMappedPointer() const
+	{
+		return m_data;
+	}
+
+	/*!
+	* \brief Gets the path of the file
+	* \return Path of the file
+	*/
+	String VirtualFile::GetPath() const
+	{
+		return m_filePath;
+	}
+
+	/*!
+	* \brief Gets the size of the file
+	* \return Size of the file in bytes
+	*/
+	UInt64 VirtualFile::GetSize() const
+	{
+		return m_size;
+	}
+
+	/*!
+	* \brief Sets the position of the cursor
+	* \return true
+	*
+	* \param offset Offset from the beginning of the file, clamped to the size of the file
+	*/
+	bool VirtualFile::SetCursorPos(UInt64 offset)
+	{
+		m_pos = std::min(offset, m_size);
+
+		return true;
+	}
+
+	void VirtualFile::FlushStream()
+	{
+		// Nothing to do
+	}
+
+	std::size_t VirtualFile::ReadBlock(void* buffer, std::size_t size)
+	{
+		std::size_t readSize = static_cast<std::size_t>(std::min<UInt64>(size, m_size - m_pos));
+
+		if (buffer && readSize > 0)
+			std::memcpy(buffer, m_data + m_pos, readSize);
+
+		m_pos += readSize;
+		return readSize;
+	}
+
+	std::size_t VirtualFile::WriteBlock(const void* /*buffer*/, std::size_t /*size*/)
+	{
+		NazaraInternalError("Virtual files are read-only");
+		return 0;
+	}
+}
@@ -0,0 +1,171 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/VirtualFileSystem.hpp>
+#include <Nazara/Core/Directory.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/VirtualFile.hpp>
+#include <algorithm>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::VirtualFileSystem
+	* \brief Core class mounting archives as directories
+	*
+	* Once an archive is mounted on a directory, its entries are seen as files of this directory by ResourceLoader::LoadFromFile, without any access to the file system.
+	* Archives mounted last take precedence, files which are not in any archive are loaded from the file system.
+	*
+	* \remark This class is thread-safe
+	*/
+
+	/*!
+	* \brief Checks whether a file belongs to a mounted archive
+	* \return true if a mounted archive has the file
+	*
+	* \param filePath Path of the file
+	*/
+	bool VirtualFileSystem::Exists(const String& filePath)
+	{
+		LockGuard lock(s_mutex);
+
+		const Archive* archive;
+		return FindEntry(filePath, &archive) != nullptr;
+	}
+
+	/*!
+	* \brief Mounts an archive
+	* \return true if the archive was mounted
+	*
+	* \param archivePath Path to the archive
+	* \param mountPoint Directory the archive root is mounted onto, current directory by default
+	*
+	* \remark Produces a NazaraError if the archive couldn't be opened
+	*/
+	bool VirtualFileSystem::Mount(const String& archivePath, const String& mountPoint)
+	{
+		std::unique_ptr<Archive> archive(new Archive);
+		if (!archive->Open(archivePath))
+		{
+			NazaraError("Failed to mount \"" + archivePath + '"');
+			return false;
+		}
+
+		String directory = File::AbsolutePath((mountPoint.IsEmpty()) ? Directory::GetCurrent() : mountPoint);
+		if (!directory.EndsWith(NAZARA_DIRECTORY_SEPARATOR))
+			directory += NAZARA_DIRECTORY_SEPARATOR;
+
+		LockGuard lock(s_mutex);
+
+		MountPoint mount;
+		mount.archive = std::move(archive);
+		mount.archivePath = File::AbsolutePath(archivePath);
+		mount.directory = std::move(directory);
+
+		s_mountPoints.emplace_back(std::move(mount));
+		return true;
+	}
+
+	/*!
+	* \brief Opens a file from a mounted archive
+	* \return true if the file was found (and decompressed if needed)
+	*
+	* \param filePath Path of the file
+	* \param file Virtual file to open, uncompressed files point directly to the mapped archive
+	*
+	* \remark The file must not be used after its archive is unmounted
+	* \remark Produces a NazaraError if the entry is corrupted
+	*/
+	bool VirtualFileSystem::Open(const String& filePath, VirtualFile* file)
+	{
+		NazaraAssert(file, "Invalid file");
+
+		file->Close();
+
+		LockGuard lock(s_mutex);
+
+		const Archive* archive;
+		const Archive::Entry* entry = FindEntry(filePath, &archive);
+		if (!entry)
+			return false;
+
+		if (entry->flags & Archive::EntryFlag_Compressed)
+		{
+			if (!archive->ReadEntry(*entry, &file->m_buffer))
+				return false;
+
+			file->m_data = file->m_buffer.GetConstBuffer();
+		}
+		else
+			file->m_data = archive->GetEntryData(*entry);
+
+		file->m_filePath = File::AbsolutePath(filePath);
+		file->m_size = entry->size;
+
+		return true;
+	}
+
+	/*!
+	* \brief Unmounts all archives
+	*/
+	void VirtualFileSystem::Uninitialize()
+	{
+		LockGuard lock(s_mutex);
+
+		s_mountPoints.clear();
+	}
+
+	/*!
+	* \brief Unmounts an archive
+	* \return true if the archive was mounted
+	*
+	* \param archivePath Path to the archive, as given to Mount
+	*/
+	bool VirtualFileSystem::Unmount(const String& archivePath)
+	{
+		String path = File::AbsolutePath(archivePath);
+
+		LockGuard lock(s_mutex);
+
+		auto it = std::find_if(s_mountPoints.rbegin(), s_mountPoints.rend(), [&](const MountPoint& mount) { return mount.archivePath == path; });
+		if (it == s_mountPoints.rend())
+			return false;
+
+		s_mountPoints.erase(std::next(it).base());
+		return true;
+	}
+
+	const Archive::Entry* VirtualFileSystem::FindEntry(const String& filePath, const Archive** archive)
+	{
+		if (s_mountPoints.empty())
+			return nullptr;
+
+		String path = File::AbsolutePath(filePath);
+
+		for (auto it = s_mountPoints.rbegin(); it != s_mountPoints.rend(); ++it)
+		{
+			if (!path.StartsWith(it->directory))
+				continue;
+
+			// Entries always use '/' as separator
+			String entryPath = path.SubString(it->directory.GetSize());
+			entryPath.Replace(NAZARA_DIRECTORY_SEPARATOR, '/');
+
+			if (const Archive::Entry* entry = it->archive->FindEntry(entryPath))
+			{
+				*archive = it->archive.get();
+				return entry;
+			}
+		}
+
+		return nullptr;
+	}
+
+	std::vector<VirtualFileSystem::MountPoint> VirtualFileSystem::s_mountPoints;
+	Mutex VirtualFileSystem::s_mutex;
+}
@@ -3,7 +3,9 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Core/Win32/DirectoryImpl.hpp>
+#include <Nazara/Core/CallOnExit.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/Win32/Time.hpp>
 #include <memory>
 #include <Nazara/Core/Debug.hpp>
 
@@ -112,6 +114,72 @@ namespace Nz
 		return currentPath;
 	}
 
+	bool DirectoryImpl::GetModificationStamp(const String& dirPath, UInt64* stamp)
+	{
+		WIN32_FILE_ATTRIBUTE_DATA attributes;
+		if (!GetFileAttributesExW(dirPath.GetWideString().data(), GetFileExInfoStandard, &attributes))
+			return false;
+
+		ULARGE_INTEGER writeTime;
+		writeTime.HighPart = attributes.ftLastWriteTime.dwHighDateTime;
+		writeTime.LowPart = attributes.ftLastWriteTime.dwLowDateTime;
+
+		*stamp = writeTime.QuadPart;
+		return true;
+	}
+
+	bool DirectoryImpl::List(const String& dirPath, std::vector<DirectoryEntry>* entries, UInt64* stamp)
+	{
+		// The stamp is read first, a change happening while we are listing will be noticed by the next scan
+		if (!GetModificationStamp(dirPath, stamp))
+		{
+			NazaraError("Unable to get directory information: " + Error::GetLastSystemError());
+			return false;
+		}
+
+		String searchPath = dirPath + "\\*";
+
+		// Basic information skips the short names, and large fetches read entries by bigger batches
+		WIN32_FIND_DATAW result;
+		HANDLE handle = FindFirstFileExW(searchPath.GetWideString().data(), FindExInfoBasic, &result, FindExSearchNameMatch, nullptr, FIND_FIRST_EX_LARGE_FETCH);
+		if (handle == INVALID_HANDLE_VALUE)
+		{
+			NazaraError("Unable to open directory: " + Error::GetLastSystemError());
+			return false;
+		}
+
+		CallOnExit closeOnExit([handle]() { FindClose(handle); });
+
+		do
+		{
+			const wchar_t* name = result.cFileName;
+			if (name[0] == L'.' && (name[1] == L'\0' || (name[1] == L'.' && name[2] == L'\0')))
+				continue;
+
+			LARGE_INTEGER size;
+			size.HighPart = result.nFileSizeHigh;
+			size.LowPart = result.nFileSizeLow;
+
+			DirectoryEntry entry;
+			entry.path = dirPath + NAZARA_DIRECTORY_SEPARATOR + String::Unicode(name);
+			entry.isDirectory = (result.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+			entry.isLink = (result.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) != 0;
+			entry.lastWriteTime = FileTimeToTime(&result.ftLastWriteTime);
+			entry.size = (entry.isDirectory) ? 0 : static_cast<UInt64>(size.QuadPart);
+
+			entries->emplace_back(std::move(entry));
+		}
+		while (FindNextFileW(handle, &result));
+
+		if (GetLastError() != ERROR_NO_MORE_FILES)
+		{
+			NazaraError("Unable to get next result: " + Error::GetLastSystemError());
+			return false;
+		}
+
+		return true;
+	}
+
 	bool DirectoryImpl::Remove(const String& dirPath)
 	{
 		bool success = RemoveDirectoryW(dirPath.GetWideString().data()) != 0;
@@ -8,6 +8,8 @@
 #define NAZARA_DIRECTORYIMPL_HPP
 
 #include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Directory.hpp>
+#include <vector>
 #include <windows.h>
 
 namespace Nz
@@ -40,6 +42,8 @@ namespace Nz
 			static bool Create(const String& dirPath);
 			static bool Exists(const String& dirPath);
 			static String GetCurrent();
+			static bool GetModificationStamp(const String& dirPath, UInt64* stamp);
+			static bool List(const String& dirPath, std::vector<DirectoryEntry>* entries, UInt64* stamp);
 			static bool Remove(const String& dirPath);
 
 		private:
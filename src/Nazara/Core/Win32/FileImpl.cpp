@@ -6,12 +6,15 @@
 #include <Nazara/Core/CallOnExit.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/Win32/Time.hpp>
+#include <algorithm>
+#include <cwchar>
 #include <memory>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
 {
 	FileImpl::FileImpl(const File* parent) :
+	m_asyncHandle(INVALID_HANDLE_VALUE),
 	m_endOfFile(false),
 	m_endOfFileUpdated(true)
 	{
@@ -20,9 +23,32 @@ namespace Nz
 
 	void FileImpl::Close()
 	{
+		if (m_asyncHandle != INVALID_HANDLE_VALUE)
+			CloseHandle(m_asyncHandle);
+
 		CloseHandle(m_handle);
 	}
 
+	bool FileImpl::EnableAsync()
+	{
+		if (m_asyncHandle != INVALID_HANDLE_VALUE)
+			return true;
+
+		// Overlapped operations on a synchronous handle would move its file pointer, the I/O threads use their own handle
+		DWORD flags = FILE_FLAG_OVERLAPPED;
+		if (m_unbuffered)
+			flags |= FILE_FLAG_NO_BUFFERING;
+
+		m_asyncHandle = ReOpenFile(m_handle, m_access, m_shareMode, flags);
+		if (m_asyncHandle == INVALID_HANDLE_VALUE)
+		{
+			NazaraError("Failed to reopen file for asynchronous operations: " + Error::GetLastSystemError());
+			return false;
+		}
+
+		return true;
+	}
+
 	bool FileImpl::EndOfFile() const
 	{
 		if (!m_endOfFileUpdated)
@@ -55,6 +81,12 @@ namespace Nz
 		return position.QuadPart;
 	}
 
+	std::size_t FileImpl::GetIOAlignment() const
+	{
+		// Sector size of every disk the system supports (512 or 4096 bytes)
+		return 4096;
+	}
+
 	bool FileImpl::Open(const String& filePath, OpenModeFlags mode)
 	{
 		DWORD access = 0;
@@ -87,8 +119,19 @@ namespace Nz
 		if ((mode & OpenMode_Lock) == 0)
 			shareMode |= FILE_SHARE_WRITE;
 
-		m_handle = CreateFileW(filePath.GetWideString().data(), access, shareMode, nullptr, openMode, 0, nullptr);
-		return m_handle != INVALID_HANDLE_VALUE;
+		DWORD flags = 0;
+		if (mode & OpenMode_Unbuffered)
+			flags |= FILE_FLAG_NO_BUFFERING;
+
+		m_handle = CreateFileW(filePath.GetWideString().data(), access, shareMode, nullptr, openMode, flags, nullptr);
+		if (m_handle == INVALID_HANDLE_VALUE)
+			return false;
+
+		m_access = access;
+		m_shareMode = shareMode;
+		m_unbuffered = (mode & OpenMode_Unbuffered) != 0;
+
+		return true;
 	}
 
 	std::size_t FileImpl::Read(void* buffer, std::size_t size)
@@ -129,6 +172,64 @@ namespace Nz
 			return 0;
 	}
 
+	bool FileImpl::ReadAt(UInt64 offset, void* buffer, std::size_t size, std::size_t* read)
+	{
+		NazaraAssert(m_asyncHandle != INVALID_HANDLE_VALUE, "Asynchronous operations are not enabled");
+
+		OVERLAPPED overlapped = {};
+		overlapped.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+		if (!overlapped.hEvent)
+		{
+			*read = 0;
+			return false;
+		}
+
+		CallOnExit closeEvent([&overlapped] ()
+		{
+			CloseHandle(overlapped.hEvent);
+		});
+
+		UInt8* ptr = static_cast<UInt8*>(buffer);
+
+		std::size_t totalRead = 0;
+		while (totalRead < size)
+		{
+			UInt64 position = offset + totalRead;
+			overlapped.Offset = static_cast<DWORD>(position);
+			overlapped.OffsetHigh = static_cast<DWORD>(position >> 32);
+
+			// Stays a multiple of the sector size for unbuffered files
+			DWORD chunkSize = static_cast<DWORD>(std::min<std::size_t>(size - totalRead, 0x40000000));
+
+			DWORD bytes = 0;
+			if (!ReadFile(m_asyncHandle, ptr + totalRead, chunkSize, nullptr, &overlapped) && GetLastError() != ERROR_IO_PENDING)
+			{
+				if (GetLastError() == ERROR_HANDLE_EOF)
+					break;
+
+				*read = totalRead;
+				return false;
+			}
+
+			if (!GetOverlappedResult(m_asyncHandle, &overlapped, &bytes, TRUE))
+			{
+				if (GetLastError() == ERROR_HANDLE_EOF)
+					break;
+
+				*read = totalRead;
+				return false;
+			}
+
+			if (bytes == 0)
+				break; // End of file
+
+			totalRead += bytes;
+		}
+
+		*read = totalRead;
+		return true;
+	}
+
 	bool FileImpl::SetCursorPos(CursorPosition pos, Int64 offset)
 	{
 		DWORD moveMethod;
@@ -198,6 +299,74 @@ namespace Nz
 		return written;
 	}
 
+	bool FileImpl::WriteAt(UInt64 offset, const void* buffer, std::size_t size, std::size_t* written)
+	{
+		NazaraAssert(m_asyncHandle != INVALID_HANDLE_VALUE, "Asynchronous operations are not enabled");
+
+		OVERLAPPED overlapped = {};
+		overlapped.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+		if (!overlapped.hEvent)
+		{
+			*written = 0;
+			return false;
+		}
+
+		CallOnExit closeEvent([&overlapped] ()
+		{
+			CloseHandle(overlapped.hEvent);
+		});
+
+		const UInt8* ptr = static_cast<const UInt8*>(buffer);
+
+		std::size_t totalWritten = 0;
+		while (totalWritten < size)
+		{
+			UInt64 position = offset + totalWritten;
+			overlapped.Offset = static_cast<DWORD>(position);
+			overlapped.OffsetHigh = static_cast<DWORD>(position >> 32);
+
+			DWORD chunkSize = static_cast<DWORD>(std::min<std::size_t>(size - totalWritten, 0x40000000));
+
+			DWORD bytes = 0;
+			if ((!WriteFile(m_asyncHandle, ptr + totalWritten, chunkSize, nullptr, &overlapped) && GetLastError() != ERROR_IO_PENDING) ||
+			    !GetOverlappedResult(m_asyncHandle, &overlapped, &bytes, TRUE) || bytes == 0)
+			{
+				*written = totalWritten;
+				return false;
+			}
+
+			totalWritten += bytes;
+		}
+
+		*written = totalWritten;
+		return true;
+	}
+
+	String FileImpl::CanonicalPath(const String& filePath)
+	{
+		// Resolves the links and the case of the path, which is kept as is if the file doesn't exist
+		HANDLE handle = CreateFileW(filePath.GetWideString().data(), 0, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS, nullptr);
+		if (handle == INVALID_HANDLE_VALUE)
+			return filePath;
+
+		CallOnExit closeHandle([handle]() { CloseHandle(handle); });
+
+		DWORD length = GetFinalPathNameByHandleW(handle, nullptr, 0, FILE_NAME_NORMALIZED);
+		if (length == 0)
+			return filePath;
+
+		std::unique_ptr<wchar_t[]> path(new wchar_t[length]);
+		if (GetFinalPathNameByHandleW(handle, path.get(), length, FILE_NAME_NORMALIZED) == 0)
+			return filePath;
+
+		// Removes the \\?\ prefix of extended paths
+		const wchar_t* resolvedPath = path.get();
+		if (std::wcsncmp(resolvedPath, L"\\\\?\\", 4) == 0)
+			resolvedPath += 4;
+
+		return String::Unicode(resolvedPath);
+	}
+
 	bool FileImpl::Copy(const String& sourcePath, const String& targetPath)
 	{
 		if (CopyFileW(sourcePath.GetWideString().data(), targetPath.GetWideString().data(), false))
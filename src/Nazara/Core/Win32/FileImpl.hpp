@@ -26,18 +26,23 @@ namespace Nz
 			~FileImpl() = default;
 
 			void Close();
+			bool EnableAsync();
 			bool EndOfFile() const;
 			void Flush();
 			UInt64 GetCursorPos() const;
+			std::size_t GetIOAlignment() const;
 			bool Open(const String& filePath, OpenModeFlags mode);
 			std::size_t Read(void* buffer, std::size_t size);
+			bool ReadAt(UInt64 offset, void* buffer, std::size_t size, std::size_t* read);
 			bool SetCursorPos(CursorPosition pos, Int64 offset);
 			bool SetSize(UInt64 size);
 			std::size_t Write(const void* buffer, std::size_t size);
+			bool WriteAt(UInt64 offset, const void* buffer, std::size_t size, std::size_t* written);
 
 			FileImpl& operator=(const FileImpl&) = delete;
 			FileImpl& operator=(FileImpl&&) = delete; ///TODO
 
+			static String CanonicalPath(const String& filePath);
 			static bool Copy(const String& sourcePath, const String& targetPath);
 			static bool Delete(const String& filePath);
 			static bool Exists(const String& filePath);
@@ -48,7 +53,11 @@ namespace Nz
 			static bool Rename(const String& sourcePath, const String& targetPath);
 
 		private:
+			HANDLE m_asyncHandle;
 			HANDLE m_handle;
+			DWORD m_access;
+			DWORD m_shareMode;
+			bool m_unbuffered;
 			mutable bool m_endOfFile;
 			mutable bool m_endOfFileUpdated;
 	};
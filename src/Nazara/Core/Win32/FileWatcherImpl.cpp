@@ -0,0 +1,126 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Win32/FileWatcherImpl.hpp>
+#include <Nazara/Core/Directory.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <cstring>
+#include <string>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	FileWatcherImpl::~FileWatcherImpl()
+	{
+		for (auto& directory : m_directories)
+			Close(*directory);
+	}
+
+	bool FileWatcherImpl::IsValid() const
+	{
+		return true;
+	}
+
+	void FileWatcherImpl::Poll(std::vector<String>* changedFiles)
+	{
+		for (auto& directoryPtr : m_directories)
+		{
+			WatchedDirectory& directory = *directoryPtr;
+
+			DWORD length;
+			if (!GetOverlappedResult(directory.handle, &directory.overlapped, &length, FALSE))
+			{
+				if (GetLastError() != ERROR_IO_INCOMPLETE)
+				{
+					NazaraError("Failed to read changes of directory \"" + directory.path + "\": " + Error::GetLastSystemError());
+					StartRead(directory);
+				}
+
+				continue;
+			}
+
+			// A length of zero means the buffer overflowed, changes are lost
+			const UInt8* ptr = reinterpret_cast<const UInt8*>(directory.buffer);
+			while (length > 0)
+			{
+				const FILE_NOTIFY_INFORMATION* info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(ptr);
+				if (info->Action == FILE_ACTION_ADDED || info->Action == FILE_ACTION_MODIFIED || info->Action == FILE_ACTION_RENAMED_NEW_NAME)
+				{
+					std::wstring fileName(info->FileName, info->FileNameLength / sizeof(WCHAR));
+					String path = directory.path + NAZARA_DIRECTORY_SEPARATOR + String::Unicode(fileName.c_str());
+
+					// Directories are reported as modified when their content changes
+					if (!Directory::Exists(path))
+						changedFiles->push_back(std::move(path));
+				}
+
+				if (info->NextEntryOffset == 0)
+					break;
+
+				ptr += info->NextEntryOffset;
+			}
+
+			StartRead(directory);
+		}
+	}
+
+	void FileWatcherImpl::Unwatch(const String& directoryPath)
+	{
+		for (auto it = m_directories.begin(); it != m_directories.end(); ++it)
+		{
+			if ((*it)->path == directoryPath)
+			{
+				Close(**it);
+				m_directories.erase(it);
+				break;
+			}
+		}
+	}
+
+	bool FileWatcherImpl::Watch(const String& directoryPath, bool recursive)
+	{
+		std::unique_ptr<WatchedDirectory> directory(new WatchedDirectory);
+		directory->handle = CreateFileW(directoryPath.GetWideString().data(), FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+		if (directory->handle == INVALID_HANDLE_VALUE)
+		{
+			NazaraError("Failed to open directory \"" + directoryPath + "\": " + Error::GetLastSystemError());
+			return false;
+		}
+
+		directory->path = directoryPath;
+		directory->recursive = recursive;
+
+		if (!StartRead(*directory))
+		{
+			CloseHandle(directory->handle);
+			return false;
+		}
+
+		m_directories.push_back(std::move(directory));
+		return true;
+	}
+
+	void FileWatcherImpl::Close(WatchedDirectory& directory)
+	{
+		// The read must be over before its buffer is freed
+		DWORD length;
+		if (CancelIoEx(directory.handle, &directory.overlapped) || GetLastError() != ERROR_NOT_FOUND)
+			GetOverlappedResult(directory.handle, &directory.overlapped, &length, TRUE);
+
+		CloseHandle(directory.handle);
+	}
+
+	bool FileWatcherImpl::StartRead(WatchedDirectory& directory)
+	{
+		std::memset(&directory.overlapped, 0, sizeof(OVERLAPPED));
+
+		if (!ReadDirectoryChangesW(directory.handle, directory.buffer, sizeof(directory.buffer), directory.recursive, FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE, nullptr, &directory.overlapped, nullptr))
+		{
+			NazaraError("Failed to watch directory \"" + directory.path + "\": " + Error::GetLastSystemError());
+			return false;
+		}
+
+		return true;
+	}
+}
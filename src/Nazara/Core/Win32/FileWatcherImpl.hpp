@@ -0,0 +1,54 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_FILEWATCHERIMPL_HPP
+#define NAZARA_FILEWATCHERIMPL_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/String.hpp>
+#include <memory>
+#include <vector>
+#include <windows.h>
+
+namespace Nz
+{
+	class FileWatcherImpl
+	{
+		public:
+			FileWatcherImpl() = default;
+			FileWatcherImpl(const FileWatcherImpl&) = delete;
+			FileWatcherImpl(FileWatcherImpl&&) = delete;
+			~FileWatcherImpl();
+
+			bool IsValid() const;
+
+			void Poll(std::vector<String>* changedFiles);
+
+			void Unwatch(const String& directoryPath);
+
+			bool Watch(const String& directoryPath, bool recursive);
+
+			FileWatcherImpl& operator=(const FileWatcherImpl&) = delete;
+			FileWatcherImpl& operator=(FileWatcherImpl&&) = delete;
+
+		private:
+			struct WatchedDirectory
+			{
+				OVERLAPPED overlapped;
+				DWORD buffer[4096]; //< FILE_NOTIFY_INFORMATION must be DWORD-aligned
+				String path;
+				HANDLE handle;
+				bool recursive;
+			};
+
+			static void Close(WatchedDirectory& directory);
+			static bool StartRead(WatchedDirectory& directory);
+
+			std::vector<std::unique_ptr<WatchedDirectory>> m_directories; //< Addresses must not change while reads are pending
+	};
+}
+
+#endif // NAZARA_FILEWATCHERIMPL_HPP
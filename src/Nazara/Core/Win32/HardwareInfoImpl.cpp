@@ -4,6 +4,8 @@
 
 #include <Nazara/Core/Win32/HardwareInfoImpl.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <algorithm>
+#include <memory>
 #include <windows.h>
 
 #ifdef NAZARA_COMPILER_MSVC
@@ -52,6 +54,69 @@ namespace Nz
 		return infos.dwNumberOfProcessors;
 	}
 
+	bool HardwareInfoImpl::GetProcessorTopology(std::vector<LogicalProcessor>* processors, UInt64 cacheSizes[3])
+	{
+		DWORD size = 0;
+		GetLogicalProcessorInformation(nullptr, &size);
+		if (GetLastError() != ERROR_INSUFFICIENT_BUFFER)
+			return false;
+
+		std::size_t infoCount = size / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION);
+		std::unique_ptr<SYSTEM_LOGICAL_PROCESSOR_INFORMATION[]> infos(new SYSTEM_LOGICAL_PROCESSOR_INFORMATION[infoCount]);
+		if (!GetLogicalProcessorInformation(infos.get(), &size))
+			return false;
+
+		// Only the processors of the current processor group are described (up to 64)
+		unsigned int processorCount = std::min(GetProcessorCount(), static_cast<unsigned int>(sizeof(ULONG_PTR) * 8));
+		processors->assign(processorCount, LogicalProcessor{0, 0, 0, 0});
+
+		for (unsigned int i = 0; i < 3; ++i)
+			cacheSizes[i] = 0;
+
+		unsigned int coreId = 0;
+		unsigned int packageId = 0;
+		for (std::size_t i = 0; i < infoCount; ++i)
+		{
+			const SYSTEM_LOGICAL_PROCESSOR_INFORMATION& info = infos[i];
+
+			auto ForEachProcessor = [&](auto&& callback)
+			{
+				for (unsigned int processor = 0; processor < processorCount; ++processor)
+				{
+					if (info.ProcessorMask & (ULONG_PTR(1) << processor))
+						callback((*processors)[processor]);
+				}
+			};
+
+			switch (info.Relationship)
+			{
+				case RelationCache:
+					if (info.Cache.Level >= 1 && info.Cache.Level <= 3 && info.Cache.Type != CacheInstruction)
+						cacheSizes[info.Cache.Level - 1] = info.Cache.Size;
+					break;
+
+				case RelationNumaNode:
+					ForEachProcessor([&](LogicalProcessor& processor) { processor.nodeId = info.NumaNode.NodeNumber; });
+					break;
+
+				case RelationProcessorCore:
+					ForEachProcessor([&](LogicalProcessor& processor) { processor.coreId = coreId; });
+					coreId++;
+					break;
+
+				case RelationProcessorPackage:
+					ForEachProcessor([&](LogicalProcessor& processor) { processor.packageId = packageId; });
+					packageId++;
+					break;
+
+				default:
+					break;
+			}
+		}
+
+		return true;
+	}
+
 	UInt64 HardwareInfoImpl::GetTotalMemory()
 	{
 		MEMORYSTATUSEX memStatus;
@@ -109,4 +174,19 @@ namespace Nz
 		#endif
 	#endif
 	}
+
+	UInt64 HardwareInfoImpl::Xgetbv(UInt32 index)
+	{
+	#if defined(NAZARA_COMPILER_MSVC)
+		return _xgetbv(index);
+	#elif defined(NAZARA_COMPILER_CLANG) || defined(NAZARA_COMPILER_GCC) || defined(NAZARA_COMPILER_INTEL)
+		UInt32 eax, edx;
+		asm volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(index));
+
+		return (static_cast<UInt64>(edx) << 32) | eax;
+	#else
+		NazaraInternalError("Xgetbv has been called although it is not supported");
+		return 0;
+	#endif
+	}
 }
@@ -8,6 +8,8 @@
 #define NAZARA_HARDWAREINFOIMPL_WINDOWS_HPP
 
 #include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/HardwareInfo.hpp>
+#include <vector>
 
 namespace Nz
 {
@@ -16,8 +18,10 @@ namespace Nz
 		public:
 			static void Cpuid(UInt32 functionId, UInt32 subFunctionId, UInt32 registers[4]);
 			static unsigned int GetProcessorCount();
+			static bool GetProcessorTopology(std::vector<LogicalProcessor>* processors, UInt64 cacheSizes[3]);
 			static UInt64 GetTotalMemory();
 			static bool IsCpuidSupported();
+			static UInt64 Xgetbv(UInt32 index);
 	};
 }
 
@@ -0,0 +1,62 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Win32/LargePageMemoryImpl.hpp>
+#include <windows.h>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		// Large pages require the "Lock pages in memory" privilege to be granted to the user, and enabled in the process token
+		bool EnableLockMemoryPrivilege()
+		{
+			HANDLE token;
+			if (!OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token))
+				return false;
+
+			TOKEN_PRIVILEGES privileges;
+			privileges.PrivilegeCount = 1;
+			privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+
+			bool enabled = false;
+			if (LookupPrivilegeValueW(nullptr, SE_LOCK_MEMORY_NAME, &privileges.Privileges[0].Luid))
+			{
+				// AdjustTokenPrivileges succeeds even if the privilege isn't granted, GetLastError tells us
+				if (AdjustTokenPrivileges(token, FALSE, &privileges, 0, nullptr, nullptr))
+					enabled = (GetLastError() == ERROR_SUCCESS);
+			}
+
+			CloseHandle(token);
+			return enabled;
+		}
+	}
+
+	void* LargePageMemoryImpl::Allocate(std::size_t size, bool* largePages)
+	{
+		static bool privilegeEnabled = EnableLockMemoryPrivilege();
+		if (privilegeEnabled)
+		{
+			if (void* ptr = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE))
+			{
+				*largePages = true;
+				return ptr;
+			}
+		}
+
+		*largePages = false;
+		return VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+	}
+
+	void LargePageMemoryImpl::Free(void* ptr, std::size_t /*size*/)
+	{
+		VirtualFree(ptr, 0, MEM_RELEASE);
+	}
+
+	std::size_t LargePageMemoryImpl::GetLargePageSize()
+	{
+		return static_cast<std::size_t>(GetLargePageMinimum());
+	}
+}
@@ -0,0 +1,24 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_LARGEPAGEMEMORYIMPL_WIN32_HPP
+#define NAZARA_LARGEPAGEMEMORYIMPL_WIN32_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <cstddef>
+
+namespace Nz
+{
+	class LargePageMemoryImpl
+	{
+		public:
+			static void* Allocate(std::size_t size, bool* largePages);
+			static void Free(void* ptr, std::size_t size);
+			static std::size_t GetLargePageSize();
+	};
+}
+
+#endif // NAZARA_LARGEPAGEMEMORYIMPL_WIN32_HPP
@@ -0,0 +1,90 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Win32/MappedFileImpl.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/String.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	MappedFileImpl::MappedFileImpl() :
+	m_mapping(nullptr),
+	m_size(0),
+	m_data(nullptr)
+	{
+	}
+
+	void MappedFileImpl::Close()
+	{
+		if (m_data)
+		{
+			UnmapViewOfFile(m_data);
+			m_data = nullptr;
+		}
+
+		if (m_mapping)
+		{
+			CloseHandle(m_mapping);
+			m_mapping = nullptr;
+		}
+
+		m_size = 0;
+	}
+
+	const UInt8* MappedFileImpl::GetData() const
+	{
+		return static_cast<const UInt8*>(m_data);
+	}
+
+	UInt64 MappedFileImpl::GetSize() const
+	{
+		return m_size;
+	}
+
+	bool MappedFileImpl::Open(const String& filePath)
+	{
+		HANDLE file = CreateFileW(filePath.GetWideString().data(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			NazaraError("Failed to open \"" + filePath + "\": " + Error::GetLastSystemError());
+			return false;
+		}
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(file, &fileSize))
+		{
+			NazaraError("Failed to get size of \"" + filePath + "\": " + Error::GetLastSystemError());
+			CloseHandle(file);
+			return false;
+		}
+
+		m_size = fileSize.QuadPart;
+
+		// Empty files can't be mapped, there is nothing to read anyway
+		if (m_size > 0)
+		{
+			m_mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (!m_mapping)
+			{
+				NazaraError("Failed to create mapping of \"" + filePath + "\": " + Error::GetLastSystemError());
+				CloseHandle(file);
+				return false;
+			}
+
+			m_data = MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+			if (!m_data)
+			{
+				NazaraError("Failed to map \"" + filePath + "\": " + Error::GetLastSystemError());
+				Close();
+				CloseHandle(file);
+				return false;
+			}
+		}
+
+		// The mapping keeps its own reference to the file
+		CloseHandle(file);
+		return true;
+	}
+}
@@ -0,0 +1,42 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_MAPPEDFILEIMPL_HPP
+#define NAZARA_MAPPEDFILEIMPL_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <windows.h>
+
+namespace Nz
+{
+	class String;
+
+	class MappedFileImpl
+	{
+		public:
+			MappedFileImpl();
+			MappedFileImpl(const MappedFileImpl&) = delete;
+			MappedFileImpl(MappedFileImpl&&) = delete;
+			~MappedFileImpl() = default;
+
+			void Close();
+
+			const UInt8* GetData() const;
+			UInt64 GetSize() const;
+
+			bool Open(const String& filePath);
+
+			MappedFileImpl& operator=(const MappedFileImpl&) = delete;
+			MappedFileImpl& operator=(MappedFileImpl&&) = delete;
+
+		private:
+			HANDLE m_mapping;
+			UInt64 m_size;
+			void* m_data;
+	};
+}
+
+#endif // NAZARA_MAPPEDFILEIMPL_HPP
@@ -0,0 +1,81 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Win32/ReadWriteLockImpl.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	ReadWriteLockImpl::ReadWriteLockImpl()
+	{
+		#if NAZARA_CORE_WINDOWS_NT6
+		InitializeSRWLock(&m_lock);
+		#elif NAZARA_CORE_WINDOWS_CS_SPINLOCKS > 0
+		InitializeCriticalSectionAndSpinCount(&m_criticalSection, NAZARA_CORE_WINDOWS_CS_SPINLOCKS);
+		#else
+		InitializeCriticalSection(&m_criticalSection);
+		#endif
+	}
+
+	#if !NAZARA_CORE_WINDOWS_NT6
+	ReadWriteLockImpl::~ReadWriteLockImpl()
+	{
+		DeleteCriticalSection(&m_criticalSection);
+	}
+	#endif
+
+	void ReadWriteLockImpl::LockRead()
+	{
+		#if NAZARA_CORE_WINDOWS_NT6
+		AcquireSRWLockShared(&m_lock);
+		#else
+		EnterCriticalSection(&m_criticalSection);
+		#endif
+	}
+
+	void ReadWriteLockImpl::LockWrite()
+	{
+		#if NAZARA_CORE_WINDOWS_NT6
+		AcquireSRWLockExclusive(&m_lock);
+		#else
+		EnterCriticalSection(&m_criticalSection);
+		#endif
+	}
+
+	bool ReadWriteLockImpl::TryLockRead()
+	{
+		#if NAZARA_CORE_WINDOWS_NT6
+		return TryAcquireSRWLockShared(&m_lock) != 0;
+		#else
+		return TryEnterCriticalSection(&m_criticalSection) != 0;
+		#endif
+	}
+
+	bool ReadWriteLockImpl::TryLockWrite()
+	{
+		#if NAZARA_CORE_WINDOWS_NT6
+		return TryAcquireSRWLockExclusive(&m_lock) != 0;
+		#else
+		return TryEnterCriticalSection(&m_criticalSection) != 0;
+		#endif
+	}
+
+	void ReadWriteLockImpl::UnlockRead()
+	{
+		#if NAZARA_CORE_WINDOWS_NT6
+		ReleaseSRWLockShared(&m_lock);
+		#else
+		LeaveCriticalSection(&m_criticalSection);
+		#endif
+	}
+
+	void ReadWriteLockImpl::UnlockWrite()
+	{
+		#if NAZARA_CORE_WINDOWS_NT6
+		ReleaseSRWLockExclusive(&m_lock);
+		#else
+		LeaveCriticalSection(&m_criticalSection);
+		#endif
+	}
+}
@@ -0,0 +1,42 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_READWRITELOCKIMPL_HPP
+#define NAZARA_READWRITELOCKIMPL_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <windows.h>
+
+namespace Nz
+{
+	class ReadWriteLockImpl
+	{
+		public:
+			ReadWriteLockImpl();
+			#if NAZARA_CORE_WINDOWS_NT6
+			~ReadWriteLockImpl() = default;
+			#else
+			~ReadWriteLockImpl();
+			#endif
+
+			void LockRead();
+			void LockWrite();
+			bool TryLockRead();
+			bool TryLockWrite();
+			void UnlockRead();
+			void UnlockWrite();
+
+		private:
+			#if NAZARA_CORE_WINDOWS_NT6
+			SRWLOCK m_lock;
+			#else
+			CRITICAL_SECTION m_criticalSection; //< Readers are exclusive too without slim reader/writer locks
+			#endif
+	};
+}
+
+#endif // NAZARA_READWRITELOCKIMPL_HPP
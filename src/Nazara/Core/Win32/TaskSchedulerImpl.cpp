@@ -5,13 +5,17 @@
 #include <Nazara/Core/Win32/TaskSchedulerImpl.hpp>
 #include <Nazara/Core/Config.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/Profiler.hpp>
+#include <Nazara/Core/String.hpp>
+#include <Nazara/Core/TaskGroup.hpp>
+#include <Nazara/Core/Thread.hpp>
 #include <cstdlib> // std::ldiv
 #include <process.h>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
 {
-	bool TaskSchedulerImpl::Initialize(std::size_t workerCount)
+	bool TaskSchedulerImpl::Initialize(std::size_t workerCount, const WorkerPlacement* placements)
 	{
 		if (IsInitialized())
 			return true; // Déjà initialisé
@@ -29,6 +33,15 @@ namespace Nz
 		s_workers.reset(new Worker[workerCount]);
 		s_workerThreads.reset(new HANDLE[workerCount]);
 
+		for (std::size_t i = 0; i < workerCount; ++i)
+		{
+			Worker& worker = s_workers[i];
+			worker.pinned = (placements != nullptr);
+			worker.processor = (placements) ? placements[i].processor : 0;
+		}
+
+		BuildStealOrders(placements);
+
 		// L'identifiant de chaque worker doit rester en vie jusqu'à ce que chaque thread soit correctement lancé
 		std::unique_ptr<std::size_t[]> workerIDs(new std::size_t[workerCount]);
 
@@ -54,12 +67,21 @@ namespace Nz
 		return true;
 	}
 
+	std::size_t TaskSchedulerImpl::GetQueuedTaskCount()
+	{
+		std::size_t count = 0;
+		for (DWORD i = 0; i < s_workerCount; ++i)
+			count += s_workers[i].workCount.load(std::memory_order_relaxed);
+
+		return count;
+	}
+
 	bool TaskSchedulerImpl::IsInitialized()
 	{
 		return s_workerCount > 0;
 	}
 
-	void TaskSchedulerImpl::Run(Functor** tasks, std::size_t count)
+	void TaskSchedulerImpl::Run(Task* tasks, std::size_t count)
 	{
 		// On s'assure que des tâches ne sont pas déjà en cours
 		WaitForMultipleObjects(s_workerCount, &s_doneEvents[0], true, INFINITE);
@@ -104,7 +126,7 @@ namespace Nz
 
 			EnterCriticalSection(&worker.queueMutex);
 
-			std::queue<Functor*> emptyQueue;
+			std::queue<Task> emptyQueue;
 			std::swap(worker.queue, emptyQueue); // Et on vide la queue (merci std::swap)
 
 			LeaveCriticalSection(&worker.queueMutex);
@@ -126,6 +148,7 @@ namespace Nz
 			DeleteCriticalSection(&worker.queueMutex);
 		}
 
+		s_helperStealOrder.clear();
 		s_doneEvents.reset();
 		s_workers.reset();
 		s_workerThreads.reset();
@@ -145,24 +168,87 @@ namespace Nz
 		WaitForMultipleObjects(s_workerCount, &s_doneEvents[0], true, INFINITE);
 	}
 
-	Functor* TaskSchedulerImpl::StealTask(std::size_t workerID)
+	void TaskSchedulerImpl::WaitForTasks(TaskGroup& group)
+	{
+		#ifdef NAZARA_CORE_SAFE
+		if (s_workerCount == 0)
+		{
+			NazaraError("Task scheduler is not initialized");
+			return;
+		}
+		#endif
+
+		// On aide les workers tant que le groupe n'est pas terminé, puis on laisse la main aux tâches en cours d'exécution
+		Task task;
+		while (!group.IsDone())
+		{
+			if (StealTask(s_workerCount, &task))
+				ExecuteTask(task);
+			else
+				SwitchToThread();
+		}
+	}
+
+	void TaskSchedulerImpl::BuildStealOrders(const WorkerPlacement* placements)
+	{
+		// Chaque worker vole d'abord les workers de son nœud NUMA, puis les autres
+		for (std::size_t i = 0; i < s_workerCount; ++i)
+		{
+			Worker& worker = s_workers[i];
+			worker.stealOrder.clear();
+			worker.stealOrder.reserve(s_workerCount - 1);
+
+			for (std::size_t j = 0; j < s_workerCount; ++j)
+			{
+				if (j != i && (!placements || placements[j].node == placements[i].node))
+					worker.stealOrder.push_back(j);
+			}
+
+			if (placements)
+			{
+				for (std::size_t j = 0; j < s_workerCount; ++j)
+				{
+					if (placements[j].node != placements[i].node)
+						worker.stealOrder.push_back(j);
+				}
+			}
+		}
+
+		// Les threads attendant des tâches peuvent voler n'importe quel worker
+		s_helperStealOrder.resize(s_workerCount);
+		for (std::size_t i = 0; i < s_workerCount; ++i)
+			s_helperStealOrder[i] = i;
+	}
+
+	void TaskSchedulerImpl::ExecuteTask(const Task& task)
+	{
+		// On exécute la tâche avant de la supprimer
+		{
+			Profiler::Scope profilerScope("TaskScheduler task");
+			task.functor->Run();
+		}
+		delete task.functor;
+
+		if (task.group)
+			task.group->m_pendingTaskCount--;
+	}
+
+	bool TaskSchedulerImpl::StealTask(std::size_t workerID, Task* task)
 	{
+		const std::vector<std::size_t>& stealOrder = (workerID < s_workerCount) ? s_workers[workerID].stealOrder : s_helperStealOrder;
+
 		bool shouldRetry;
 		do
 		{
 			shouldRetry = false;
-			for (std::size_t i = 0; i < s_workerCount; ++i)
+			for (std::size_t i : stealOrder)
 			{
-				// On ne vole pas la famille, ni soi-même.
-				if (i == workerID)
-					continue;
-
 				Worker& worker = s_workers[i];
 
 				// Ce worker a-t-il encore des tâches dans sa file d'attente ?
 				if (worker.workCount > 0)
 				{
-					Functor* task = nullptr;
+					bool stolen = false;
 
 					// Est-ce qu'il utilise la queue maintenant ?
 					if (TryEnterCriticalSection(&worker.queueMutex))
@@ -171,9 +257,10 @@ namespace Nz
 						if (!worker.queue.empty()) // On vérifie que la queue n'est pas vide (peut avoir changé avant le verrouillage)
 						{
 							// Et hop, on vole la tâche
-							task = worker.queue.front();
+							*task = worker.queue.front();
 							worker.queue.pop();
 							worker.workCount = worker.queue.size();
+							stolen = true;
 						}
 
 						LeaveCriticalSection(&worker.queueMutex);
@@ -182,15 +269,15 @@ namespace Nz
 						shouldRetry = true; // Il est encore possible d'avoir un job
 
 					// Avons-nous notre tâche ?
-					if (task)
-						return task; // Parfait, sortons de là !
+					if (stolen)
+						return true; // Parfait, sortons de là !
 				}
 			}
 		}
 		while (shouldRetry);
 
 		// Bon à priori plus aucun worker n'a de tâche
-		return nullptr;
+		return false;
 	}
 
 	unsigned int __stdcall TaskSchedulerImpl::WorkerProc(void* userdata)
@@ -198,12 +285,23 @@ namespace Nz
 		unsigned int workerID = *static_cast<unsigned int*>(userdata);
 		SetEvent(s_doneEvents[workerID]);
 
+		Profiler::SetThreadName("TaskWorker #" + String::Number(workerID));
+
 		Worker& worker = s_workers[workerID];
+		if (worker.pinned)
+		{
+			Bitset<> affinity(worker.processor + 1, false);
+			affinity.Set(worker.processor, true);
+
+			Thread::SetCurrentThreadAffinity(affinity);
+		}
+
 		WaitForSingleObject(worker.wakeEvent, INFINITE);
 
 		while (worker.running)
 		{
-			Functor* task = nullptr;
+			Task task;
+			bool hasTask = false;
 
 			if (worker.workCount > 0) // Permet d'éviter d'entrer inutilement dans une section critique
 			{
@@ -213,20 +311,17 @@ namespace Nz
 					task = worker.queue.front();
 					worker.queue.pop();
 					worker.workCount = worker.queue.size();
+					hasTask = true;
 				}
 				LeaveCriticalSection(&worker.queueMutex);
 			}
 
 			// Que faire quand vous n'avez plus de travail ?
-			if (!task)
-				task = StealTask(workerID); // Voler le travail des autres !
+			if (!hasTask)
+				hasTask = StealTask(workerID, &task); // Voler le travail des autres !
 
-			if (task)
-			{
-				// On exécute la tâche avant de la supprimer
-				task->Run();
-				delete task;
-			}
+			if (hasTask)
+				ExecuteTask(task);
 			else
 			{
 				SetEvent(s_doneEvents[workerID]);
@@ -243,6 +338,7 @@ namespace Nz
 
 	std::unique_ptr<HANDLE[]> TaskSchedulerImpl::s_doneEvents; // Doivent être contigus
 	std::unique_ptr<TaskSchedulerImpl::Worker[]> TaskSchedulerImpl::s_workers;
+	std::vector<std::size_t> TaskSchedulerImpl::s_helperStealOrder;
 	std::unique_ptr<HANDLE[]> TaskSchedulerImpl::s_workerThreads; // Doivent être contigus
 	DWORD TaskSchedulerImpl::s_workerCount;
 }
@@ -9,40 +9,55 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/Functor.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
 #include <atomic>
 #include <memory>
+#include <vector>
 #include <queue>
 #include <windows.h>
 
 namespace Nz
 {
+	class TaskGroup;
+
 	class TaskSchedulerImpl
 	{
 		public:
+			using Task = TaskScheduler::Task;
+			using WorkerPlacement = TaskScheduler::WorkerPlacement;
+
 			TaskSchedulerImpl() = delete;
 			~TaskSchedulerImpl() = delete;
 
-			static bool Initialize(std::size_t workerCount);
+			static std::size_t GetQueuedTaskCount();
+			static bool Initialize(std::size_t workerCount, const WorkerPlacement* placements);
 			static bool IsInitialized();
-			static void Run(Functor** tasks, std::size_t count);
+			static void Run(Task* tasks, std::size_t count);
 			static void Uninitialize();
 			static void WaitForTasks();
+			static void WaitForTasks(TaskGroup& group);
 
 		private:
-			static Functor* StealTask(std::size_t workerID);
+			static void BuildStealOrders(const WorkerPlacement* placements);
+			static void ExecuteTask(const Task& task);
+			static bool StealTask(std::size_t workerID, Task* task);
 			static unsigned int __stdcall WorkerProc(void* userdata);
 
 			struct Worker
 			{
 				std::atomic_size_t workCount;
-				std::queue<Functor*> queue;
+				std::queue<Task> queue;
+				std::vector<std::size_t> stealOrder;
 				CRITICAL_SECTION queueMutex;
 				HANDLE wakeEvent;
+				unsigned int processor;
+				bool pinned;
 				volatile bool running;
 			};
 
 			static std::unique_ptr<HANDLE[]> s_doneEvents; // Doivent être contigus
 			static std::unique_ptr<Worker[]> s_workers;
+			static std::vector<std::size_t> s_helperStealOrder;
 			static std::unique_ptr<HANDLE[]> s_workerThreads; // Doivent être contigus
 			static DWORD s_workerCount;
 };
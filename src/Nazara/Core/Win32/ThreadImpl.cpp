@@ -48,21 +48,92 @@ namespace Nz
 		CloseHandle(m_handle);
 	}
 
+	bool ThreadImpl::SetAffinity(const Bitset<>& processors)
+	{
+		return SetAffinity(m_handle, processors);
+	}
+
 	void ThreadImpl::SetName(const Nz::String& name)
 	{
 		SetThreadName(m_threadId, name.GetConstBuffer());
 	}
 
+	bool ThreadImpl::SetPriority(ThreadPriority priority)
+	{
+		return SetPriority(m_handle, priority);
+	}
+
+	bool ThreadImpl::SetCurrentAffinity(const Bitset<>& processors)
+	{
+		return SetAffinity(::GetCurrentThread(), processors);
+	}
+
 	void ThreadImpl::SetCurrentName(const Nz::String& name)
 	{
 		SetThreadName(::GetCurrentThreadId(), name.GetConstBuffer());
 	}
 
+	bool ThreadImpl::SetCurrentPriority(ThreadPriority priority)
+	{
+		return SetPriority(::GetCurrentThread(), priority);
+	}
+
 	void ThreadImpl::Sleep(UInt32 time)
 	{
 		::Sleep(time);
 	}
 
+	bool ThreadImpl::SetAffinity(HANDLE handle, const Bitset<>& processors)
+	{
+		// Affinity masks are limited to the processors of the current group
+		DWORD_PTR mask = 0;
+		for (std::size_t processor = processors.FindFirst(); processor != Bitset<>::npos && processor < sizeof(DWORD_PTR) * 8; processor = processors.FindNext(processor))
+			mask |= DWORD_PTR(1) << processor;
+
+		if (SetThreadAffinityMask(handle, mask) == 0)
+		{
+			NazaraError("Failed to set thread affinity: " + Error::GetLastSystemError());
+			return false;
+		}
+
+		return true;
+	}
+
+	bool ThreadImpl::SetPriority(HANDLE handle, ThreadPriority priority)
+	{
+		int threadPriority = THREAD_PRIORITY_NORMAL;
+		switch (priority)
+		{
+			case ThreadPriority_Lowest:
+				threadPriority = THREAD_PRIORITY_LOWEST;
+				break;
+
+			case ThreadPriority_Low:
+				threadPriority = THREAD_PRIORITY_BELOW_NORMAL;
+				break;
+
+			case ThreadPriority_Normal:
+				threadPriority = THREAD_PRIORITY_NORMAL;
+				break;
+
+			case ThreadPriority_High:
+				threadPriority = THREAD_PRIORITY_ABOVE_NORMAL;
+				break;
+
+			case ThreadPriority_Highest:
+				threadPriority = THREAD_PRIORITY_HIGHEST;
+				break;
+		}
+
+		if (!SetThreadPriority(handle, threadPriority))
+		{
+			NazaraError("Failed to set thread priority: " + Error::GetLastSystemError());
+			return false;
+		}
+
+		return true;
+	}
+
 	void ThreadImpl::SetThreadName(DWORD threadId, const char* threadName)
 	{
 		#ifdef NAZARA_COMPILER_MSVC
@@ -10,6 +10,8 @@
 #define NAZARA_THREADIMPL_HPP
 
 #include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Bitset.hpp>
+#include <Nazara/Core/Enums.hpp>
 #include <Nazara/Core/String.hpp>
 #include <windows.h>
 
@@ -24,12 +26,18 @@ namespace Nz
 
 			void Detach();
 			void Join();
+			bool SetAffinity(const Bitset<>& processors);
 			void SetName(const Nz::String& name);
+			bool SetPriority(ThreadPriority priority);
 
+			static bool SetCurrentAffinity(const Bitset<>& processors);
 			static void SetCurrentName(const Nz::String& name);
+			static bool SetCurrentPriority(ThreadPriority priority);
 			static void Sleep(UInt32 time);
 
 		private:
+			static bool SetAffinity(HANDLE handle, const Bitset<>& processors);
+			static bool SetPriority(HANDLE handle, ThreadPriority priority);
 			static void SetThreadName(DWORD threadId, const char* threadName);
 			static unsigned int __stdcall ThreadProc(void* userdata);
 
@@ -39,6 +39,19 @@ namespace Nz
 		pointLights.push_back(light);
 	}
 
+	/*!
+	* \brief Adds a reflection probe to the rendering queue
+	*
+	* Reflective objects use the closest probe they are in instead of the global reflection texture of the scene
+	*
+	* \param probe Reflection probe
+	*/
+
+	void AbstractRenderQueue::AddReflectionProbe(const ReflectionProbe& probe)
+	{
+		reflectionProbes.push_back(probe);
+	}
+
 	/*!
 	* \brief Adds a spot light to the rendering queue
 	*
@@ -60,8 +73,20 @@ namespace Nz
 	{
 		NazaraUnused(fully);
 
+		AbstractRenderQueue::ClearLights();
+	}
+
+	/*!
+	* \brief Clears the lights and the reflection probes of the rendering queue, keeping everything else
+	*
+	* This allows lights to be queued again every frame without having to rebuild the rest of the queue
+	*/
+
+	void AbstractRenderQueue::ClearLights()
+	{
 		directionalLights.clear();
 		pointLights.clear();
+		reflectionProbes.clear();
 		spotLights.clear();
 	}
 }
@@ -8,8 +8,6 @@
 #include <limits>
 #include <Nazara/Graphics/Debug.hpp>
 
-///TODO: Replace sinus/cosinus by a lookup table (which will lead to a speed up about 10x)
-
 namespace Nz
 {
 	/*!
@@ -44,7 +42,7 @@ namespace Nz
 		if (!colorPtr)
 			colorPtr.Reset(&Color::White, 0); // Same
 
-		if (material->IsDepthSortingEnabled())
+		if (IsDepthSorted(material))
 		{
 			for (std::size_t i = 0; i < billboardCount; ++i)
 			{
@@ -76,7 +74,7 @@ namespace Nz
 				data++;
 			}
 
-			billboards.Insert({
+			GetBillboardQueue(material).Insert({
 				renderOrder,
 				material,
 				scissorRect,
@@ -114,7 +112,7 @@ namespace Nz
 		if (!alphaPtr)
 			alphaPtr.Reset(&defaultAlpha, 0); // Same
 
-		if (material->IsDepthSortingEnabled())
+		if (IsDepthSorted(material))
 		{
 			for (std::size_t i = 0; i < billboardCount; ++i)
 			{
@@ -146,7 +144,7 @@ namespace Nz
 				data++;
 			}
 
-			billboards.Insert({
+			GetBillboardQueue(material).Insert({
 				renderOrder,
 				material,
 				scissorRect,
@@ -182,7 +180,9 @@ namespace Nz
 		if (!colorPtr)
 			colorPtr.Reset(&Color::White, 0); // Same
 
-		if (material->IsDepthSortingEnabled())
+		const Vector2f* sinCos = ComputeSinCos(anglePtr, billboardCount);
+
+		if (IsDepthSorted(material))
 		{
 			for (std::size_t i = 0; i < billboardCount; ++i)
 			{
@@ -194,7 +194,7 @@ namespace Nz
 						*colorPtr++,
 						*positionPtr++,
 						*sizePtr++,
-						ComputeSinCos(*anglePtr++)
+						*sinCos++
 					}
 				});
 			}
@@ -209,12 +209,12 @@ namespace Nz
 			{
 				data->center = *positionPtr++;
 				data->color  = *colorPtr++;
-				data->sinCos = ComputeSinCos(*anglePtr++);
+				data->sinCos = *sinCos++;
 				data->size   = *sizePtr++;
 				data++;
 			}
 
-			billboards.Insert({
+			GetBillboardQueue(material).Insert({
 				renderOrder,
 				material,
 				scissorRect,
@@ -252,7 +252,9 @@ namespace Nz
 		if (!alphaPtr)
 			alphaPtr.Reset(&defaultAlpha, 0); // Same
 		
-		if (material->IsDepthSortingEnabled())
+		const Vector2f* sinCos = ComputeSinCos(anglePtr, billboardCount);
+
+		if (IsDepthSorted(material))
 		{
 			for (std::size_t i = 0; i < billboardCount; ++i)
 			{
@@ -264,7 +266,7 @@ namespace Nz
 						ComputeColor(*alphaPtr++),
 						*positionPtr++,
 						*sizePtr++,
-						ComputeSinCos(*anglePtr++)
+						*sinCos++
 					}
 				});
 			}
@@ -279,12 +281,12 @@ namespace Nz
 			{
 				data->center = *positionPtr++;
 				data->color  = ComputeColor(*alphaPtr++);
-				data->sinCos = ComputeSinCos(*anglePtr++);
+				data->sinCos = *sinCos++;
 				data->size   = *sizePtr++;
 				data++;
 			}
 
-			billboards.Insert({
+			GetBillboardQueue(material).Insert({
 				renderOrder,
 				material,
 				scissorRect,
@@ -320,7 +322,7 @@ namespace Nz
 		if (!colorPtr)
 			colorPtr.Reset(&Color::White, 0); // Same
 		
-		if (material->IsDepthSortingEnabled())
+		if (IsDepthSorted(material))
 		{
 			for (std::size_t i = 0; i < billboardCount; ++i)
 			{
@@ -352,7 +354,7 @@ namespace Nz
 				data++;
 			}
 
-			billboards.Insert({
+			GetBillboardQueue(material).Insert({
 				renderOrder,
 				material,
 				scissorRect,
@@ -390,7 +392,7 @@ namespace Nz
 		if (!alphaPtr)
 			alphaPtr.Reset(&defaultAlpha, 0); // Same
 		
-		if (material->IsDepthSortingEnabled())
+		if (IsDepthSorted(material))
 		{
 			for (std::size_t i = 0; i < billboardCount; ++i)
 			{
@@ -422,7 +424,7 @@ namespace Nz
 				data++;
 			}
 
-			billboards.Insert({
+			GetBillboardQueue(material).Insert({
 				renderOrder,
 				material,
 				scissorRect,
@@ -458,7 +460,9 @@ namespace Nz
 		if (!colorPtr)
 			colorPtr.Reset(&Color::White, 0); // Same
 		
-		if (material->IsDepthSortingEnabled())
+		const Vector2f* sinCos = ComputeSinCos(anglePtr, billboardCount);
+
+		if (IsDepthSorted(material))
 		{
 			for (std::size_t i = 0; i < billboardCount; ++i)
 			{
@@ -470,7 +474,7 @@ namespace Nz
 						*colorPtr++,
 						*positionPtr++,
 						ComputeSize(*sizePtr++),
-						ComputeSinCos(*anglePtr++)
+						*sinCos++
 					}
 				});
 			}
@@ -485,12 +489,12 @@ namespace Nz
 			{
 				data->center = *positionPtr++;
 				data->color  = *colorPtr++;
-				data->sinCos = ComputeSinCos(*anglePtr++);
+				data->sinCos = *sinCos++;
 				data->size   = ComputeSize(*sizePtr++);
 				data++;
 			}
 
-			billboards.Insert({
+			GetBillboardQueue(material).Insert({
 				renderOrder,
 				material,
 				scissorRect,
@@ -528,7 +532,9 @@ namespace Nz
 		if (!alphaPtr)
 			alphaPtr.Reset(&defaultAlpha, 0); // Same
 		
-		if (material->IsDepthSortingEnabled())
+		const Vector2f* sinCos = ComputeSinCos(anglePtr, billboardCount);
+
+		if (IsDepthSorted(material))
 		{
 			for (std::size_t i = 0; i < billboardCount; ++i)
 			{
@@ -540,7 +546,7 @@ namespace Nz
 						ComputeColor(*alphaPtr++),
 						*positionPtr++,
 						ComputeSize(*sizePtr++),
-						ComputeSinCos(*anglePtr++)
+						*sinCos++
 					}
 				});
 			}
@@ -555,12 +561,12 @@ namespace Nz
 			{
 				data->center = *positionPtr++;
 				data->color  = ComputeColor(*alphaPtr++);
-				data->sinCos = ComputeSinCos(*anglePtr++);
+				data->sinCos = *sinCos++;
 				data->size   = ComputeSize(*sizePtr++);
 				data++;
 			}
 
-			billboards.Insert({
+			GetBillboardQueue(material).Insert({
 				renderOrder,
 				material,
 				scissorRect,
@@ -602,14 +608,34 @@ namespace Nz
 	* \remark Produces a NazaraAssert if material is invalid
 	*/
 	void BasicRenderQueue::AddMesh(int renderOrder, const Material* material, const MeshData& meshData, const Boxf& meshAABB, const Matrix4f& transformMatrix, const Recti& scissorRect)
+	{
+		BasicRenderQueue::AddSkinnedMesh(renderOrder, material, meshData, meshAABB, transformMatrix, nullptr, 0, scissorRect);
+	}
+
+	/*!
+	* \brief Adds a mesh skinned by the vertex shader to the queue
+	*
+	* \param renderOrder Order of rendering
+	* \param material Material of the mesh
+	* \param meshData Data of the mesh, its vertex buffer being in bind pose
+	* \param meshAABB Box of the mesh
+	* \param transformMatrix Matrix of the mesh
+	* \param jointMatrices Skinning matrices of the skeleton joints, must stay valid until the queue is cleared
+	* \param jointCount Number of joint matrices
+	*
+	* \remark Produces a NazaraAssert if material is invalid
+	* \remark Produces a NazaraAssert if jointCount is greater than NAZARA_GRAPHICS_MAX_SKINNING_JOINTS
+	*/
+	void BasicRenderQueue::AddSkinnedMesh(int renderOrder, const Material* material, const MeshData& meshData, const Boxf& meshAABB, const Matrix4f& transformMatrix, const Matrix4f* jointMatrices, std::size_t jointCount, const Recti& scissorRect)
 	{
 		NazaraAssert(material, "Invalid material");
+		NazaraAssert(jointCount <= NAZARA_GRAPHICS_MAX_SKINNING_JOINTS, "Too many joints");
 
 		RegisterLayer(renderOrder);
 
 		Spheref obbSphere(transformMatrix.GetTranslation() + meshAABB.GetCenter(), meshAABB.GetSquaredRadius());
 
-		if (material->IsDepthSortingEnabled())
+		if (IsDepthSorted(material))
 		{
 			depthSortedModels.Insert({
 				renderOrder,
@@ -617,18 +643,22 @@ namespace Nz
 				material,
 				transformMatrix,
 				scissorRect,
-				obbSphere
+				obbSphere,
+				jointMatrices,
+				jointCount
 			});
 		}
 		else
 		{
-			models.Insert({
+			GetModelQueue(material).Insert({
 				renderOrder,
 				meshData,
 				material,
 				transformMatrix,
 				scissorRect,
-				obbSphere
+				obbSphere,
+				jointMatrices,
+				jointCount
 			});
 		}
 	}
@@ -641,35 +671,41 @@ namespace Nz
 	* \param vertices Buffer of data for the sprites
 	* \param spriteCount Number of sprites
 	* \param overlay Texture of the sprites
+	* \param overlayLayer Layer of the overlay the sprites use, if it's a texture array
+	* \param instances Optional instance records of the same sprites, allowing them to be expanded by the vertex shader
 	*
 	* \remark Produces a NazaraAssert if material is invalid
 	*/
-	void BasicRenderQueue::AddSprites(int renderOrder, const Material* material, const VertexStruct_XYZ_Color_UV* vertices, std::size_t spriteCount, const Recti& scissorRect, const Texture* overlay /*= nullptr*/)
+	void BasicRenderQueue::AddSprites(int renderOrder, const Material* material, const VertexStruct_XYZ_Color_UV* vertices, std::size_t spriteCount, const Recti& scissorRect, const Texture* overlay /*= nullptr*/, unsigned int overlayLayer /*= 0*/, const SpriteInstance* instances /*= nullptr*/)
 	{
 		NazaraAssert(material, "Invalid material");
 
 		RegisterLayer(renderOrder);
 
-		if (material->IsDepthSortingEnabled())
+		if (IsDepthSorted(material))
 		{
 			depthSortedSprites.Insert({
 				renderOrder,
 				spriteCount,
 				material,
 				overlay,
+				overlayLayer,
 				vertices,
-				scissorRect
-				});
+				scissorRect,
+				instances
+			});
 		}
 		else
 		{
-			basicSprites.Insert({
+			GetSpriteQueue(material).Insert({
 				renderOrder,
 				spriteCount,
 				material,
 				overlay,
+				overlayLayer,
 				vertices,
-				scissorRect
+				scissorRect,
+				instances
 			});
 		}
 	}
@@ -690,16 +726,24 @@ namespace Nz
 		depthSortedModels.Clear();
 		depthSortedSprites.Clear();
 		models.Clear();
+		orderIndependentBillboards.Clear();
+		orderIndependentModels.Clear();
+		orderIndependentSprites.Clear();
 
-		m_pipelineCache.clear();
-		m_materialCache.clear();
-		m_overlayCache.clear();
-		m_shaderCache.clear();
-		m_textureCache.clear();
-		m_vertexBufferCache.clear();
+		m_pipelineCache.Clear();
+		m_materialCache.Clear();
+		m_overlayCache.Clear();
+		m_shaderCache.Clear();
+		m_textureCache.Clear();
+		m_vertexBufferCache.Clear();
 
 		m_billboards.clear();
+		m_materialSortIndices.clear();
 		m_renderLayers.clear();
+		m_scissorRects.clear();
+
+		// Sort caches have been emptied, their memory can be reused by the next frame
+		m_arena.Reset();
 	}
 
 	/*!
@@ -710,20 +754,24 @@ namespace Nz
 
 	void BasicRenderQueue::Sort(const AbstractViewer* viewer)
 	{
-		m_layerCache.clear();
+		m_layerCache.Clear();
 		for (int layer : m_renderLayers)
-			m_layerCache.emplace(layer, m_layerCache.size());
+			m_layerCache.GetIndex(layer);
 
-		auto GetOrInsert = [](auto& container, auto&& value)
+		Planef nearPlane = viewer->GetFrustum().GetPlane(FrustumPlane_Near);
+		Vector3f viewerPos = viewer->GetEyePosition();
+		bool orthogonal = (viewer->GetProjectionType() == ProjectionType_Orthogonal);
+		float invZFar = 1.f / viewer->GetZFar();
+
+		// Depth quantized on 16 bits, so opaque items sharing the same states are drawn front to back
+		auto GetDepthIndex = [&](const Vector3f& position) -> UInt64
 		{
-			auto it = container.find(value);
-			if (it == container.end())
-				it = container.emplace(value, container.size()).first;
+			float depth = (orthogonal) ? nearPlane.Distance(position) : viewerPos.Distance(position);
 
-			return it->second;
+			return static_cast<UInt64>(Clamp(depth * invZFar, 0.f, 1.f) * 0xFFFF);
 		};
 
-		basicSprites.Sort([&](const SpriteChain& vertices)
+		auto spriteSortFunc = [&](const SpriteChain& vertices)
 		{
 			// RQ index:
 			// - Layer (4bits)
@@ -733,16 +781,18 @@ namespace Nz
 			// - Textures (8bits)
 			// - Overlay (8bits)
 			// - Scissor (4bits)
-			// - Depth? (16bits)
+			// - Depth (16bits)
+
+			const MaterialSortIndices& materialIndices = GetMaterialSortIndices(vertices.material);
 
-			UInt64 layerIndex = m_layerCache[vertices.layerIndex];
-			UInt64 pipelineIndex = GetOrInsert(m_pipelineCache, vertices.material->GetPipeline());
-			UInt64 materialIndex = GetOrInsert(m_materialCache, vertices.material);
-			UInt64 shaderIndex = GetOrInsert(m_shaderCache, vertices.material->GetShader());
-			UInt64 textureIndex = GetOrInsert(m_textureCache, vertices.material->GetDiffuseMap());
-			UInt64 overlayIndex = GetOrInsert(m_overlayCache, vertices.overlay);
-			UInt64 scissorIndex = 0; //< TODO
-			UInt64 depthIndex = 0; //< TODO
+			UInt64 layerIndex = m_layerCache.GetIndex(vertices.layerIndex);
+			UInt64 pipelineIndex = materialIndices.pipeline;
+			UInt64 materialIndex = materialIndices.material;
+			UInt64 shaderIndex = materialIndices.shader;
+			UInt64 textureIndex = materialIndices.texture;
+			UInt64 overlayIndex = m_overlayCache.GetIndex(vertices.overlay);
+			UInt64 scissorIndex = GetScissorSortIndex(vertices.scissorRect);
+			UInt64 depthIndex = GetDepthIndex(vertices.vertices[0].position);
 
 			UInt64 index = (layerIndex    & 0x0F)   << 60 |
 			               (pipelineIndex & 0xFF)   << 52 |
@@ -754,9 +804,12 @@ namespace Nz
 			               (depthIndex    & 0xFFFF) <<  0;
 
 			return index;
-		});
-		
-		billboards.Sort([&](const BillboardChain& billboard)
+		};
+
+		basicSprites.Sort(spriteSortFunc);
+		orderIndependentSprites.Sort(spriteSortFunc); //< Accumulated without regard to order, only states matter
+
+		auto billboardSortFunc = [&](const BillboardChain& billboard)
 		{
 			// RQ index:
 			// - Layer (4bits)
@@ -766,16 +819,18 @@ namespace Nz
 			// - Textures (8bits)
 			// - ??? (8bits)
 			// - Scissor (4bits)
-			// - Depth? (16bits)
+			// - Depth (16bits)
 
-			UInt64 layerIndex = m_layerCache[billboard.layerIndex];
-			UInt64 pipelineIndex = GetOrInsert(m_pipelineCache, billboard.material->GetPipeline());
-			UInt64 materialIndex = GetOrInsert(m_materialCache, billboard.material);
-			UInt64 shaderIndex = GetOrInsert(m_shaderCache, billboard.material->GetShader());
-			UInt64 textureIndex = GetOrInsert(m_textureCache, billboard.material->GetDiffuseMap());
+			const MaterialSortIndices& materialIndices = GetMaterialSortIndices(billboard.material);
+
+			UInt64 layerIndex = m_layerCache.GetIndex(billboard.layerIndex);
+			UInt64 pipelineIndex = materialIndices.pipeline;
+			UInt64 materialIndex = materialIndices.material;
+			UInt64 shaderIndex = materialIndices.shader;
+			UInt64 textureIndex = materialIndices.texture;
 			UInt64 unknownIndex = 0; //< ???
-			UInt64 scissorIndex = 0; //< TODO
-			UInt64 depthIndex = 0; //< TODO?
+			UInt64 scissorIndex = GetScissorSortIndex(billboard.scissorRect);
+			UInt64 depthIndex = GetDepthIndex(m_billboards[billboard.billboardIndex].center);
 
 			UInt64 index = (layerIndex    & 0x0F)   << 60 |
 			               (pipelineIndex & 0xFF)   << 52 |
@@ -787,14 +842,17 @@ namespace Nz
 			               (depthIndex    & 0xFFFF) <<  0;
 
 			return index;
-		});
+		};
+
+		billboards.Sort(billboardSortFunc);
+		orderIndependentBillboards.Sort(billboardSortFunc);
 
 		customDrawables.Sort([&](const CustomDrawable& drawable)
 		{
 			// RQ index:
 			// - Layer (4bits)
 
-			UInt64 layerIndex = m_layerCache[drawable.layerIndex];
+			UInt64 layerIndex = m_layerCache.GetIndex(drawable.layerIndex);
 
 			UInt64 index = (layerIndex & 0x0F) << 60;
 
@@ -802,7 +860,7 @@ namespace Nz
 
 		});
 
-		models.Sort([&](const Model& renderData)
+		auto modelSortFunc = [&](const Model& renderData)
 		{
 			// RQ index:
 			// - Layer (4bits)
@@ -812,16 +870,18 @@ namespace Nz
 			// - Textures (8bits)
 			// - Buffers (8bits)
 			// - Scissor (4bits)
-			// - Depth? (16bits)
+			// - Depth (16bits)
+
+			const MaterialSortIndices& materialIndices = GetMaterialSortIndices(renderData.material);
 
-			UInt64 layerIndex = m_layerCache[renderData.layerIndex];
-			UInt64 pipelineIndex = GetOrInsert(m_pipelineCache, renderData.material->GetPipeline());
-			UInt64 materialIndex = GetOrInsert(m_materialCache, renderData.material);
-			UInt64 shaderIndex = GetOrInsert(m_shaderCache, renderData.material->GetShader());
-			UInt64 textureIndex = GetOrInsert(m_textureCache, renderData.material->GetDiffuseMap());
-			UInt64 bufferIndex = GetOrInsert(m_vertexBufferCache, renderData.meshData.vertexBuffer);
-			UInt64 scissorIndex = 0; //< TODO
-			UInt64 depthIndex = 0; //< TODO
+			UInt64 layerIndex = m_layerCache.GetIndex(renderData.layerIndex);
+			UInt64 pipelineIndex = materialIndices.pipeline;
+			UInt64 materialIndex = materialIndices.material;
+			UInt64 shaderIndex = materialIndices.shader;
+			UInt64 textureIndex = materialIndices.texture;
+			UInt64 bufferIndex = m_vertexBufferCache.GetIndex(renderData.meshData.vertexBuffer);
+			UInt64 scissorIndex = GetScissorSortIndex(renderData.scissorRect);
+			UInt64 depthIndex = GetDepthIndex(renderData.obbSphere.GetPosition());
 
 			UInt64 index = (layerIndex    & 0x0F)   << 60 |
 			               (pipelineIndex & 0xFF)   << 52 |
@@ -833,7 +893,10 @@ namespace Nz
 			               (depthIndex    & 0xFFFF) <<  0;
 
 			return index;
-		});
+		};
+
+		models.Sort(modelSortFunc);
+		orderIndependentModels.Sort(modelSortFunc);
 
 		static_assert(std::numeric_limits<float>::is_iec559, "The following sorting functions relies on IEEE 754 floatings-points");
 
@@ -843,8 +906,6 @@ namespace Nz
 	#error The following code relies on native-endian IEEE-754 representation, which your platform does not guarantee
 #endif
 
-		Planef nearPlane = viewer->GetFrustum().GetPlane(FrustumPlane_Near);
-
 		depthSortedBillboards.Sort([&](const Billboard& billboard)
 		{
 			// RQ index:
@@ -856,7 +917,7 @@ namespace Nz
 			// a negative distance may happen with billboard behind the camera which we don't care about since they'll be rendered)
 			float depth = nearPlane.Distance(billboard.data.center);
 
-			UInt64 layerIndex = m_layerCache[billboard.layerIndex];
+			UInt64 layerIndex = m_layerCache.GetIndex(billboard.layerIndex);
 			UInt64 depthIndex = ~reinterpret_cast<UInt32&>(depth);
 
 			UInt64 index = (layerIndex & 0x0F) << 60 |
@@ -865,7 +926,7 @@ namespace Nz
 			return index;
 		});
 
-		if (viewer->GetProjectionType() == ProjectionType_Orthogonal)
+		if (orthogonal)
 		{
 			depthSortedModels.Sort([&](const Model& model)
 			{
@@ -876,7 +937,7 @@ namespace Nz
 
 				float depth = nearPlane.Distance(model.obbSphere.GetPosition());
 
-				UInt64 layerIndex = m_layerCache[model.layerIndex];
+				UInt64 layerIndex = m_layerCache.GetIndex(model.layerIndex);
 				UInt64 depthIndex = ~reinterpret_cast<UInt32&>(depth);
 
 				UInt64 index = (layerIndex & 0x0F) << 60 |
@@ -894,7 +955,7 @@ namespace Nz
 
 				float depth = nearPlane.Distance(spriteChain.vertices[0].position);
 
-				UInt64 layerIndex = m_layerCache[spriteChain.layerIndex];
+				UInt64 layerIndex = m_layerCache.GetIndex(spriteChain.layerIndex);
 				UInt64 depthIndex = ~reinterpret_cast<UInt32&>(depth);
 
 				UInt64 index = (layerIndex & 0x0F) << 60 |
@@ -905,8 +966,6 @@ namespace Nz
 		}
 		else
 		{
-			Vector3f viewerPos = viewer->GetEyePosition();
-			
 			depthSortedModels.Sort([&](const Model& model)
 			{
 				// RQ index:
@@ -916,7 +975,7 @@ namespace Nz
 
 				float depth = viewerPos.SquaredDistance(model.obbSphere.GetPosition());
 
-				UInt64 layerIndex = m_layerCache[model.layerIndex];
+				UInt64 layerIndex = m_layerCache.GetIndex(model.layerIndex);
 				UInt64 depthIndex = ~reinterpret_cast<UInt32&>(depth);
 
 				UInt64 index = (layerIndex & 0x0F) << 60 |
@@ -934,7 +993,7 @@ namespace Nz
 
 				float depth = viewerPos.SquaredDistance(sprites.vertices[0].position);
 
-				UInt64 layerIndex = m_layerCache[sprites.layerIndex];
+				UInt64 layerIndex = m_layerCache.GetIndex(sprites.layerIndex);
 				UInt64 depthIndex = ~reinterpret_cast<UInt32&>(depth);
 
 				UInt64 index = (layerIndex & 0x0F) << 60 |
@@ -3,7 +3,9 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Graphics/DeferredBloomPass.hpp>
+#include <Nazara/Graphics/DeferredRenderTechnique.hpp>
 #include <Nazara/Renderer/Renderer.hpp>
+#include <algorithm>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
@@ -34,9 +36,6 @@ namespace Nz
 		m_bloomStates.depthBuffer = false;
 		m_gaussianBlurShader = ShaderLibrary::Get("DeferredGaussianBlur");
 		m_gaussianBlurShaderFilterLocation = m_gaussianBlurShader->GetUniformLocation("Filter");
-
-		for (unsigned int i = 0; i < 2; ++i)
-			m_bloomTextures[i] = Texture::New();
 	}
 
 	DeferredBloomPass::~DeferredBloomPass() = default;
@@ -83,7 +82,7 @@ namespace Nz
 
 	/*!
 	* \brief Gets the ith texture
-	* \return Texture computed
+	* \return Texture computed during the last draw, nullptr if the pass was not drawn yet
 	*
 	* \param i Index of the texture
 	*
@@ -116,6 +115,18 @@ namespace Nz
 	{
 		NazaraUnused(sceneData);
 
+		Vector2ui bloomSize(std::max(m_dimensions.x / 8, 1U), std::max(m_dimensions.y / 8, 1U));
+		const DeferredRenderTechnique::TransientTarget* bloomTarget = m_deferredTechnique->AcquireTransientTarget(PixelFormatType_RGBA8, bloomSize, 2);
+		if (!bloomTarget)
+		{
+			NazaraError("Failed to acquire bloom target");
+			return false;
+		}
+
+		const RenderTexture& bloomRTT = bloomTarget->renderTexture;
+		m_bloomTextures[0] = bloomTarget->textures[0];
+		m_bloomTextures[1] = bloomTarget->textures[1];
+
 		Renderer::SetRenderStates(m_bloomStates);
 		Renderer::SetTextureSampler(0, m_bilinearSampler);
 		Renderer::SetTextureSampler(1, m_bilinearSampler);
@@ -137,21 +148,21 @@ namespace Nz
 		Renderer::SetTexture(0, m_workTextures[secondWorkTexture]);
 		Renderer::DrawFullscreenQuad();
 
-		Renderer::SetTarget(&m_bloomRTT);
-		Renderer::SetViewport(Recti(0, 0, m_dimensions.x / 8, m_dimensions.y / 8));
+		Renderer::SetTarget(&bloomRTT);
+		Renderer::SetViewport(Recti(0, 0, bloomSize.x, bloomSize.y));
 
 		Renderer::SetShader(m_gaussianBlurShader);
 
 		for (unsigned int i = 0; i < m_blurPassCount; ++i)
 		{
-			m_bloomRTT.SetColorTarget(0); // bloomTextureA
+			bloomRTT.SetColorTarget(0); // bloomTextureA
 
 			m_gaussianBlurShader->SendVector(m_gaussianBlurShaderFilterLocation, Vector2f(1.f, 0.f));
 
 			Renderer::SetTexture(0, (i == 0) ? m_workTextures[firstWorkTexture] : static_cast<const Texture*>(m_bloomTextures[1]));
 			Renderer::DrawFullscreenQuad();
 
-			m_bloomRTT.SetColorTarget(1); // bloomTextureB
+			bloomRTT.SetColorTarget(1); // bloomTextureB
 
 			m_gaussianBlurShader->SendVector(m_gaussianBlurShaderFilterLocation, Vector2f(0.f, 1.f));
 
@@ -171,34 +182,6 @@ namespace Nz
 		return true;
 	}
 
-	/*!
-	* \brief Resizes the texture sizes
-	* \return true If successful
-	*
-	* \param dimensions Dimensions for the compute texture
-	*/
-
-	bool DeferredBloomPass::Resize(const Vector2ui& dimensions)
-	{
-		DeferredRenderPass::Resize(dimensions);
-
-		m_bloomRTT.Create(true);
-		for (unsigned int i = 0; i < 2; ++i)
-		{
-			m_bloomTextures[i]->Create(ImageType_2D, PixelFormatType_RGBA8, dimensions.x / 8, dimensions.y / 8);
-			m_bloomRTT.AttachTexture(AttachmentPoint_Color, i, m_bloomTextures[i]);
-		}
-		m_bloomRTT.Unlock();
-
-		if (!m_bloomRTT.IsComplete())
-		{
-			NazaraError("Incomplete RTT");
-			return false;
-		}
-
-		return true;
-	}
-
 	/*!
 	* \brief Sets the number of pass for blur
 	*
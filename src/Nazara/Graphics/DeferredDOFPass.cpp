@@ -3,8 +3,9 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Graphics/DeferredDOFPass.hpp>
+#include <Nazara/Graphics/DeferredRenderTechnique.hpp>
 #include <Nazara/Renderer/Renderer.hpp>
-#include <Nazara/Renderer/RenderTexture.hpp>
+#include <algorithm>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
@@ -114,9 +115,6 @@ namespace Nz
 		m_gaussianBlurShader = ShaderLibrary::Get("DeferredGaussianBlur");
 		m_gaussianBlurShaderFilterLocation = m_gaussianBlurShader->GetUniformLocation("Filter");
 
-		for (unsigned int i = 0; i < 2; ++i)
-			m_dofTextures[i] = Texture::New();
-
 		m_bilinearSampler.SetAnisotropyLevel(1);
 		m_bilinearSampler.SetFilterMode(SamplerFilter_Bilinear);
 		m_bilinearSampler.SetWrapMode(SamplerWrap_Clamp);
@@ -130,6 +128,16 @@ namespace Nz
 
 	DeferredDOFPass::~DeferredDOFPass() = default;
 
+	/*!
+	* \brief Gets the resources read by the pass
+	* \return The scene color and the G-Buffer
+	*/
+
+	DeferredResourceFlags DeferredDOFPass::GetInputs() const
+	{
+		return DeferredResource_GBuffer | DeferredResource_Scene;
+	}
+
 	/*!
 	* \brief Processes the work on the data while working with textures
 	* \return true
@@ -143,26 +151,38 @@ namespace Nz
 	{
 		NazaraUnused(sceneData);
 
+		Vector2ui dofSize(std::max(m_dimensions.x / 4, 1U), std::max(m_dimensions.y / 4, 1U));
+		const DeferredRenderTechnique::TransientTarget* dofTarget = m_deferredTechnique->AcquireTransientTarget(PixelFormatType_RGBA8, dofSize, 2);
+		if (!dofTarget)
+		{
+			NazaraError("Failed to acquire depth of field target");
+			return false;
+		}
+
+		const RenderTexture& dofRTT = dofTarget->renderTexture;
+		m_dofTextures[0] = dofTarget->textures[0];
+		m_dofTextures[1] = dofTarget->textures[1];
+
 		Renderer::SetTextureSampler(0, m_pointSampler);
 		Renderer::SetTextureSampler(1, m_bilinearSampler);
 		Renderer::SetTextureSampler(2, m_pointSampler);
 
-		Renderer::SetTarget(&m_dofRTT);
-		Renderer::SetViewport(Recti(0, 0, m_dimensions.x/4, m_dimensions.y/4));
+		Renderer::SetTarget(&dofRTT);
+		Renderer::SetViewport(Recti(0, 0, dofSize.x, dofSize.y));
 
 		Renderer::SetShader(m_gaussianBlurShader);
 
 		const unsigned int dofBlurPass = 2;
 		for (unsigned int i = 0; i < dofBlurPass; ++i)
 		{
-			m_dofRTT.SetColorTarget(0); // dofTextureA
+			dofRTT.SetColorTarget(0); // dofTextureA
 
 			m_gaussianBlurShader->SendVector(m_gaussianBlurShaderFilterLocation, Vector2f(1.f, 0.f));
 
 			Renderer::SetTexture(0, (i == 0) ? m_workTextures[secondWorkTexture] : static_cast<const Texture*>(m_dofTextures[1]));
 			Renderer::DrawFullscreenQuad();
 
-			m_dofRTT.SetColorTarget(1); // dofTextureB
+			dofRTT.SetColorTarget(1); // dofTextureB
 
 			m_gaussianBlurShader->SendVector(m_gaussianBlurShaderFilterLocation, Vector2f(0.f, 1.f));
 
@@ -182,32 +202,4 @@ namespace Nz
 
 		return true;
 	}
-
-	/*!
-	* \brief Resizes the texture sizes
-	* \return true If successful
-	*
-	* \param dimensions Dimensions for the compute texture
-	*/
-
-	bool DeferredDOFPass::Resize(const Vector2ui& dimensions)
-	{
-		DeferredRenderPass::Resize(dimensions);
-
-		m_dofRTT.Create(true);
-		for (unsigned int i = 0; i < 2; ++i)
-		{
-			m_dofTextures[i]->Create(ImageType_2D, PixelFormatType_RGBA8, dimensions.x/4, dimensions.y/4);
-			m_dofRTT.AttachTexture(AttachmentPoint_Color, i, m_dofTextures[i]);
-		}
-		m_dofRTT.Unlock();
-
-		if (!m_dofRTT.IsComplete())
-		{
-			NazaraError("Incomplete RTT");
-			return false;
-		}
-
-		return true;
-	}
 }
@@ -6,6 +6,8 @@
 #include <Nazara/Core/ParameterList.hpp>
 #include <Nazara/Graphics/AbstractViewer.hpp>
 #include <Nazara/Graphics/SceneData.hpp>
+#include <Nazara/Math/Algorithm.hpp>
+#include <Nazara/Renderer/RenderTarget.hpp>
 #include <Nazara/Renderer/Renderer.hpp>
 #include <Nazara/Renderer/Shader.hpp>
 #include <Nazara/Renderer/UberShaderInstance.hpp>
@@ -17,14 +19,21 @@ namespace Nz
 	* \ingroup graphics
 	* \class Nz::DeferredFinalPass
 	* \brief Graphics class that represents the final pass in deferred rendering
+	*
+	* When the scene was drawn at a lower resolution than the viewport of the viewer (see DeferredRenderTechnique::SetResolutionScale), it is upscaled with bilinear filtering and sharpened
 	*/
 
 	/*!
 	* \brief Constructs a DeferredFinalPass object by default
 	*/
 
-	DeferredFinalPass::DeferredFinalPass()
+	DeferredFinalPass::DeferredFinalPass() :
+	m_sharpness(0.5f)
 	{
+		m_bilinearSampler.SetAnisotropyLevel(1);
+		m_bilinearSampler.SetFilterMode(SamplerFilter_Bilinear);
+		m_bilinearSampler.SetWrapMode(SamplerWrap_Clamp);
+
 		m_pointSampler.SetAnisotropyLevel(1);
 		m_pointSampler.SetFilterMode(SamplerFilter_Nearest);
 		m_pointSampler.SetWrapMode(SamplerWrap_Clamp);
@@ -43,10 +52,38 @@ namespace Nz
 		const Shader* shader = m_uberShaderInstance->GetShader();
 		m_materialDiffuseUniform = shader->GetUniformLocation("MaterialDiffuse");
 		m_materialDiffuseMapUniform = shader->GetUniformLocation("MaterialDiffuseMap");
+
+		// Optional, the scene is stretched without it
+		m_upscaleShader = ShaderLibrary::Get("DeferredUpscale");
+		if (m_upscaleShader)
+		{
+			m_upscaleSharpnessUniform = m_upscaleShader->GetUniformLocation("Sharpness");
+			m_upscaleViewportRectUniform = m_upscaleShader->GetUniformLocation("ViewportRect");
+		}
 	}
 
 	DeferredFinalPass::~DeferredFinalPass() = default;
 
+	/*!
+	* \brief Gets the resources written by the pass
+	* \return The render target of the viewer
+	*/
+
+	DeferredResourceFlags DeferredFinalPass::GetOutputs() const
+	{
+		return DeferredResource_Target;
+	}
+
+	/*!
+	* \brief Gets the strength of the sharpening applied when upscaling
+	* \return Sharpness, from zero (bilinear filtering only) to one
+	*/
+
+	float DeferredFinalPass::GetSharpness() const
+	{
+		return m_sharpness;
+	}
+
 	/*!
 	* \brief Processes the work on the data while working with textures
 	* \return true
@@ -66,16 +103,44 @@ namespace Nz
 
 		Renderer::SetRenderStates(m_states);
 		Renderer::SetTexture(0, m_workTextures[secondWorkTexture]);
-		Renderer::SetTextureSampler(0, m_pointSampler);
 
-		m_uberShaderInstance->Activate();
+		const Recti& viewport = sceneData.viewer->GetViewport();
+		if (m_upscaleShader && (m_dimensions.x != static_cast<unsigned int>(viewport.width) || m_dimensions.y != static_cast<unsigned int>(viewport.height)))
+		{
+			// OpenGL window coordinates start from the bottom of the target
+			int targetHeight = static_cast<int>(sceneData.viewer->GetTarget()->GetSize().y);
+			Vector4f viewportRect(float(viewport.x), float(targetHeight - viewport.height - viewport.y), 1.f / viewport.width, 1.f / viewport.height);
 
-		const Shader* shader = m_uberShaderInstance->GetShader();
-		shader->SendColor(m_materialDiffuseUniform, Color::White);
-		shader->SendInteger(m_materialDiffuseMapUniform, 0);
+			Renderer::SetShader(m_upscaleShader);
+			Renderer::SetTextureSampler(0, m_bilinearSampler);
+
+			m_upscaleShader->SendFloat(m_upscaleSharpnessUniform, m_sharpness);
+			m_upscaleShader->SendVector(m_upscaleViewportRectUniform, viewportRect);
+		}
+		else
+		{
+			Renderer::SetTextureSampler(0, m_pointSampler);
+
+			m_uberShaderInstance->Activate();
+
+			const Shader* shader = m_uberShaderInstance->GetShader();
+			shader->SendColor(m_materialDiffuseUniform, Color::White);
+			shader->SendInteger(m_materialDiffuseMapUniform, 0);
+		}
 
 		Renderer::DrawFullscreenQuad();
 
 		return false;
 	}
+
+	/*!
+	* \brief Sets the strength of the sharpening applied when upscaling
+	*
+	* \param sharpness Sharpness, from zero (bilinear filtering only) to one
+	*/
+
+	void DeferredFinalPass::SetSharpness(float sharpness)
+	{
+		m_sharpness = Clamp(sharpness, 0.f, 1.f);
+	}
 }
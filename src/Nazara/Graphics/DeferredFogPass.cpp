@@ -146,6 +146,16 @@ namespace Nz
 
 	DeferredFogPass::~DeferredFogPass() = default;
 
+	/*!
+	* \brief Gets the resources read by the pass
+	* \return The scene color and the depth held by the G-Buffer
+	*/
+
+	DeferredResourceFlags DeferredFogPass::GetInputs() const
+	{
+		return DeferredResource_GBuffer | DeferredResource_Scene;
+	}
+
 	/*!
 	* \brief Processes the work on the data while working with textures
 	* \return true
@@ -23,6 +23,16 @@ namespace Nz
 	DeferredForwardPass::DeferredForwardPass() = default;
 	DeferredForwardPass::~DeferredForwardPass() = default;
 
+	/*!
+	* \brief Gets the resources read by the pass
+	* \return The depth buffer and the scene color, forward-rendered objects being drawn over it
+	*/
+
+	DeferredResourceFlags DeferredForwardPass::GetInputs() const
+	{
+		return DeferredResource_DepthStencil | DeferredResource_Scene;
+	}
+
 	/*!
 	* \brief Initializes the deferred forward pass which needs the forward technique
 	*
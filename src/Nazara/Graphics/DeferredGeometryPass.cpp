@@ -6,6 +6,7 @@
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/ErrorFlags.hpp>
 #include <Nazara/Core/OffsetOf.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Graphics/AbstractViewer.hpp>
 #include <Nazara/Graphics/DeferredRenderTechnique.hpp>
 #include <Nazara/Graphics/DeferredProxyRenderQueue.hpp>
@@ -13,6 +14,9 @@
 #include <Nazara/Graphics/SceneData.hpp>
 #include <Nazara/Renderer/Renderer.hpp>
 #include <Nazara/Renderer/RenderTexture.hpp>
+#include <Nazara/Utility/Algorithm.hpp>
+#include <Nazara/Utility/BufferMapper.hpp>
+#include <Nazara/Utility/VertexDeclaration.hpp>
 #include <Nazara/Utility/VertexStruct.hpp>
 #include <Nazara/Graphics/Debug.hpp>
 
@@ -29,6 +33,23 @@ namespace Nz
 			Vector2f uv;
 		};
 
+		bool IsIndirectCompatible(const MeshData& first, const MeshData& second)
+		{
+			if (!second.indexBuffer || first.primitiveMode != second.primitiveMode)
+				return false;
+
+			const IndexBuffer* firstIndices = first.indexBuffer;
+			const IndexBuffer* secondIndices = second.indexBuffer;
+			if (firstIndices->GetBuffer() != secondIndices->GetBuffer() || firstIndices->HasLargeIndices() != secondIndices->HasLargeIndices())
+				return false;
+
+			// The vertex array object is shared as long as the vertices have the same declaration and alignment in the same buffer
+			const VertexBuffer* firstVertices = first.vertexBuffer;
+			const VertexBuffer* secondVertices = second.vertexBuffer;
+			return firstVertices->GetBuffer() == secondVertices->GetBuffer() && firstVertices->GetVertexDeclaration() == secondVertices->GetVertexDeclaration() &&
+			       firstVertices->GetStartOffset() % firstVertices->GetStride() == secondVertices->GetStartOffset() % secondVertices->GetStride();
+		}
+
 		UInt32 s_maxQuads = std::numeric_limits<UInt16>::max() / 6;
 		UInt32 s_vertexBufferSize = 4 * 1024 * 1024; // 4 MiB
 	}
@@ -50,10 +71,10 @@ namespace Nz
 
 		m_whiteTexture = Nz::TextureLibrary::Get("White2D");
 
-		m_vertexBuffer.Create(s_vertexBufferSize, DataStorage_Hardware, BufferUsage_Dynamic);
+		m_vertexBuffer.Create(s_vertexBufferSize);
 
-		m_billboardPointBuffer.Reset(&s_billboardVertexDeclaration, &m_vertexBuffer);
-		m_spriteBuffer.Reset(VertexDeclaration::Get(VertexLayout_XYZ_Color_UV), &m_vertexBuffer);
+		m_billboardPointBuffer.Reset(&s_billboardVertexDeclaration, m_vertexBuffer.GetBuffer());
+		m_spriteBuffer.Reset(VertexDeclaration::Get(VertexLayout_XYZ_Color_UV), m_vertexBuffer.GetBuffer());
 
 		m_clearShader = ShaderLibrary::Get("DeferredGBufferClear");
 		m_clearStates.depthBuffer = true;
@@ -66,6 +87,26 @@ namespace Nz
 
 	DeferredGeometryPass::~DeferredGeometryPass() = default;
 
+	/*!
+	* \brief Gets the resources read by the pass
+	* \return Nothing, the G-Buffer being cleared
+	*/
+
+	DeferredResourceFlags DeferredGeometryPass::GetInputs() const
+	{
+		return DeferredResourceFlags();
+	}
+
+	/*!
+	* \brief Gets the resources written by the pass
+	* \return The depth buffer and the G-Buffer
+	*/
+
+	DeferredResourceFlags DeferredGeometryPass::GetOutputs() const
+	{
+		return DeferredResource_DepthStencil | DeferredResource_GBuffer;
+	}
+
 	/*!
 	* \brief Processes the work on the data while working with textures
 	* \return false
@@ -384,83 +425,10 @@ namespace Nz
 
 	void DeferredGeometryPass::DrawModels(const SceneData& sceneData, const BasicRenderQueue& renderQueue, const Nz::RenderQueue<Nz::BasicRenderQueue::Model>& models) const
 	{
-		const RenderTarget* renderTarget = sceneData.viewer->GetTarget();
-		Recti fullscreenScissorRect = Recti(Vector2i(renderTarget->GetSize()));
-
-		const Material* lastMaterial = nullptr;
-		const MaterialPipeline* lastPipeline = nullptr;
-		const Shader* lastShader = nullptr;
-		const ShaderUniforms* shaderUniforms = nullptr;
-		Recti lastScissorRect = Recti(-1, -1);
-
-		const MaterialPipeline::Instance* pipelineInstance = nullptr;
-
-		///TODO: Reimplement instancing
-
-		for (const BasicRenderQueue::Model& model : models)
-		{
-			const MaterialPipeline* pipeline = model.material->GetPipeline();
-			if (lastPipeline != pipeline)
-			{
-				pipelineInstance = &model.material->GetPipeline()->Apply(ShaderFlags_Deferred);
-
-				const Shader* shader = pipelineInstance->uberInstance->GetShader();
-				if (shader != lastShader)
-				{
-					// Index of uniforms in the shader
-					shaderUniforms = GetShaderUniforms(shader);
-
-					// Ambient color of the scene
-					shader->SendColor(shaderUniforms->sceneAmbient, sceneData.ambientColor);
-					// Position of the camera
-					shader->SendVector(shaderUniforms->eyePosition, sceneData.viewer->GetEyePosition());
-
-					lastShader = shader;
-				}
-
-				lastPipeline = pipeline;
-			}
-
-			if (lastMaterial != model.material)
-			{
-				model.material->Apply(*pipelineInstance);
-				lastMaterial = model.material;
-			}
-
-			if (model.material->IsScissorTestEnabled())
-			{
-				const Nz::Recti& scissorRect = (model.scissorRect.width > 0) ? model.scissorRect : fullscreenScissorRect;
-				if (scissorRect != lastScissorRect)
-				{
-					Renderer::SetScissorRect(scissorRect);
-					lastScissorRect = scissorRect;
-				}
-			}
-
-			// Handle draw call before rendering loop
-			Renderer::DrawCall drawFunc;
-			Renderer::DrawCallInstanced instancedDrawFunc;
-			unsigned int indexCount;
-
-			if (model.meshData.indexBuffer)
-			{
-				drawFunc = Renderer::DrawIndexedPrimitives;
-				instancedDrawFunc = Renderer::DrawIndexedPrimitivesInstanced;
-				indexCount = model.meshData.indexBuffer->GetIndexCount();
-			}
-			else
-			{
-				drawFunc = Renderer::DrawPrimitives;
-				instancedDrawFunc = Renderer::DrawPrimitivesInstanced;
-				indexCount = model.meshData.vertexBuffer->GetVertexCount();
-			}
-
-			Renderer::SetIndexBuffer(model.meshData.indexBuffer);
-			Renderer::SetVertexBuffer(model.meshData.vertexBuffer);
-
-			Renderer::SetMatrix(MatrixType_World, model.matrix);
-			drawFunc(model.meshData.primitiveMode, 0, indexCount);
-		}
+		// Models are recorded in parallel, then executed in order
+		std::size_t commandBufferCount = RecordModels(sceneData, models);
+		for (std::size_t i = 0; i < commandBufferCount; ++i)
+			Renderer::Execute(m_commandBuffers[i]);
 	}
 
 	void DeferredGeometryPass::DrawSprites(const SceneData& sceneData, const BasicRenderQueue& renderQueue, const RenderQueue<BasicRenderQueue::SpriteChain>& spriteList) const
@@ -473,7 +441,8 @@ namespace Nz
 		Renderer::SetVertexBuffer(&m_spriteBuffer);
 
 		const unsigned int overlayTextureUnit = Material::GetTextureUnit(TextureMap_Overlay);
-		const std::size_t maxSpriteCount = std::min<std::size_t>(s_maxQuads, m_spriteBuffer.GetVertexCount() / 4);
+		// One sprite less than a segment can hold, leaving room for the alignment of the vertices
+		const std::size_t maxSpriteCount = std::min<std::size_t>(s_maxQuads, m_vertexBuffer.GetSegmentSize() / (4 * sizeof(VertexStruct_XYZ_Color_UV)) - 1);
 
 		m_spriteChains.clear();
 
@@ -487,22 +456,32 @@ namespace Nz
 
 				do
 				{
-					// We open the buffer in writing mode
-					BufferMapper<VertexBuffer> vertexMapper(m_spriteBuffer, BufferAccess_DiscardAndWrite);
-					VertexStruct_XYZ_Color_UV* vertices = static_cast<VertexStruct_XYZ_Color_UV*>(vertexMapper.GetPointer());
-
+					// Count the sprites of this batch first, only the space they need is taken from the stream buffer
 					std::size_t spriteCount = 0;
+					for (std::size_t i = spriteChain, offset = spriteChainOffset; i < spriteChainCount && spriteCount < maxSpriteCount; ++i, offset = 0)
+						spriteCount += std::min(maxSpriteCount - spriteCount, m_spriteChains[i].second - offset);
+
+					// The vertices don't overwrite those of previous draw calls, so the buffer doesn't need to be orphaned
+					UInt32 bufferOffset;
+					VertexStruct_XYZ_Color_UV* vertices = static_cast<VertexStruct_XYZ_Color_UV*>(m_vertexBuffer.Map(static_cast<UInt32>(4 * spriteCount * sizeof(VertexStruct_XYZ_Color_UV)), sizeof(VertexStruct_XYZ_Color_UV), &bufferOffset));
+					if (!vertices)
+					{
+						NazaraError("Failed to map sprite vertices");
+						break;
+					}
+
+					std::size_t copiedCount = 0;
 
 					do
 					{
 						const VertexStruct_XYZ_Color_UV* currentChain = m_spriteChains[spriteChain].first;
 						std::size_t currentChainSpriteCount = m_spriteChains[spriteChain].second;
-						std::size_t count = std::min(maxSpriteCount - spriteCount, currentChainSpriteCount - spriteChainOffset);
+						std::size_t count = std::min(spriteCount - copiedCount, currentChainSpriteCount - spriteChainOffset);
 
 						std::memcpy(vertices, currentChain + spriteChainOffset * 4, 4 * count * sizeof(VertexStruct_XYZ_Color_UV));
 						vertices += count * 4;
 
-						spriteCount += count;
+						copiedCount += count;
 						spriteChainOffset += count;
 
 						// Have we treated the entire chain ?
@@ -512,11 +491,11 @@ namespace Nz
 							spriteChainOffset = 0;
 						}
 					}
-					while (spriteCount < maxSpriteCount && spriteChain < spriteChainCount);
+					while (copiedCount < spriteCount);
 
-					vertexMapper.Unmap();
+					m_vertexBuffer.Unmap();
 
-					Renderer::DrawIndexedPrimitives(PrimitiveMode_TriangleList, 0, spriteCount * 6);
+					Renderer::DrawIndexedPrimitives(PrimitiveMode_TriangleList, 0, static_cast<unsigned int>(spriteCount * 6), bufferOffset / sizeof(VertexStruct_XYZ_Color_UV));
 				}
 				while (spriteChain < spriteChainCount);
 			}
@@ -606,6 +585,7 @@ namespace Nz
 
 			uniforms.eyePosition = shader->GetUniformLocation("EyePosition");
 			uniforms.sceneAmbient = shader->GetUniformLocation("SceneAmbient");
+			uniforms.skinningMatrices = shader->GetUniformLocation("SkinningMatrices");
 			uniforms.textureOverlay = shader->GetUniformLocation("TextureOverlay");
 
 			it = m_shaderUniforms.emplace(shader, std::move(uniforms)).first;
@@ -625,6 +605,290 @@ namespace Nz
 		m_shaderUniforms.erase(shader);
 	}
 
+	/*!
+	* \brief Records the draws of models into command buffers, in parallel
+	* \return Number of command buffers to execute, in order, from m_commandBuffers
+	*
+	* The models are first split into batches and their pipelines, shader uniforms and materials are prepared by this thread.
+	* Groups of batches are then recorded by the TaskScheduler workers, each group into its own command buffer, meshlets being culled by the workers.
+	*
+	* \param sceneData Data of the scene
+	* \param models Queue of the models to draw
+	*/
+
+	std::size_t DeferredGeometryPass::RecordModels(const SceneData& sceneData, const RenderQueue<BasicRenderQueue::Model>& models) const
+	{
+		constexpr std::size_t BatchesPerCommandBuffer = 64;
+
+		m_batchModels.clear();
+		m_modelBatches.clear();
+
+		for (const BasicRenderQueue::Model& model : models)
+			m_batchModels.push_back(&model);
+
+		bool instancingSupported = Renderer::HasCapability(RendererCap_Instancing);
+		bool multiDrawIndirectSupported = Renderer::HasCapability(RendererCap_MultiDrawIndirect);
+
+		const Material* lastMaterial = nullptr;
+		const Shader* lastShader = nullptr;
+
+		std::size_t modelIndex = 0;
+		while (modelIndex < m_batchModels.size())
+		{
+			const BasicRenderQueue::Model& model = *m_batchModels[modelIndex];
+
+			// Models are sorted by material and buffers, following models sharing the same mesh and material are drawn as one batch
+			std::size_t batchEnd = modelIndex + 1;
+			while (batchEnd < m_batchModels.size())
+			{
+				const BasicRenderQueue::Model& batchModel = *m_batchModels[batchEnd];
+				if (batchModel.material != model.material || batchModel.meshData.indexBuffer != model.meshData.indexBuffer ||
+				    batchModel.meshData.vertexBuffer != model.meshData.vertexBuffer || batchModel.meshData.primitiveMode != model.meshData.primitiveMode ||
+				    batchModel.scissorRect != model.scissorRect || batchModel.jointMatrices != model.jointMatrices)
+					break;
+
+				++batchEnd;
+			}
+
+			ModelBatch batch;
+			batch.firstModel = modelIndex;
+			batch.indirect = false;
+
+			// Following meshes sharing the material and the buffers of this one (see BufferAllocator) can be submitted in the same indirect draw call
+			if (multiDrawIndirectSupported && !model.jointMatrices && model.meshData.indexBuffer)
+			{
+				std::size_t indirectEnd = batchEnd;
+				while (indirectEnd < m_batchModels.size())
+				{
+					const BasicRenderQueue::Model& indirectModel = *m_batchModels[indirectEnd];
+					if (indirectModel.material != model.material || indirectModel.scissorRect != model.scissorRect ||
+					    indirectModel.jointMatrices || !IsIndirectCompatible(model.meshData, indirectModel.meshData))
+						break;
+
+					++indirectEnd;
+				}
+
+				// A mesh split in meshlets is drawn indirectly even alone, only its visible meshlets being submitted
+				batch.indirect = (indirectEnd != batchEnd || model.meshData.meshletCount > 0);
+				if (batch.indirect)
+					batchEnd = indirectEnd;
+			}
+
+			batch.modelCount = batchEnd - modelIndex;
+
+			// Skinned models each have their own joint matrices and cannot be instanced
+			batch.instancing = batch.indirect || (!model.jointMatrices && instancingSupported && batch.modelCount >= NAZARA_GRAPHICS_INSTANCING_MIN_INSTANCES_COUNT);
+
+			UInt32 shaderFlags = (batch.instancing) ? ShaderFlags_Deferred | ShaderFlags_Instancing : ShaderFlags_Deferred;
+			if (model.jointMatrices)
+				shaderFlags |= ShaderFlags_Skinning;
+
+			// Getting the instance may compile its shader, and the uniforms shared by the whole frame are sent right away
+			batch.pipelineInstance = &model.material->GetPipeline()->GetInstance(shaderFlags);
+
+			const Shader* shader = batch.pipelineInstance->uberInstance->GetShader();
+			batch.shaderUniforms = GetShaderUniforms(shader);
+			if (shader != lastShader)
+			{
+				// Ambient color of the scene
+				shader->SendColor(batch.shaderUniforms->sceneAmbient, sceneData.ambientColor);
+				// Position of the camera
+				shader->SendVector(batch.shaderUniforms->eyePosition, sceneData.viewer->GetEyePosition());
+				lastShader = shader;
+			}
+
+			if (model.material != lastMaterial)
+			{
+				model.material->Prepare(*batch.pipelineInstance);
+				lastMaterial = model.material;
+			}
+
+			m_modelBatches.push_back(batch);
+			modelIndex = batchEnd;
+		}
+
+		std::size_t commandBufferCount = (m_modelBatches.size() + BatchesPerCommandBuffer - 1) / BatchesPerCommandBuffer;
+		if (m_commandBuffers.size() < commandBufferCount)
+			m_commandBuffers.resize(commandBufferCount);
+
+		const RenderTarget* renderTarget = sceneData.viewer->GetTarget();
+		Recti fullscreenScissorRect = Recti(Vector2i(renderTarget->GetSize()));
+
+		// The viewer isn't accessed by the workers, its frustum may be lazily updated
+		Frustumf frustum = sceneData.viewer->GetFrustum();
+		Vector3f eyePosition = sceneData.viewer->GetEyePosition();
+		bool perspective = (sceneData.viewer->GetProjectionType() == ProjectionType_Perspective);
+
+		// Every indirect command has to fit in the instance buffer on execution
+		UInt32 maxInstancePerCommand = static_cast<UInt32>(Renderer::GetInstanceBuffer()->GetVertexCount());
+
+		TaskScheduler::ParallelFor(0, commandBufferCount, 1, [&] (std::size_t begin, std::size_t end)
+		{
+			std::vector<Renderer::DrawIndexedIndirectCommand> indirectCommands;
+			std::vector<Matrix4f> instanceMatrices;
+			std::vector<UInt32> visibleMeshlets;
+
+			for (std::size_t bufferIndex = begin; bufferIndex < end; ++bufferIndex)
+			{
+				CommandBuffer& commandBuffer = m_commandBuffers[bufferIndex];
+				commandBuffer.Clear();
+
+				// Each command buffer starts from an unknown state
+				const MaterialPipeline::Instance* lastInstance = nullptr;
+				const Material* lastBufferMaterial = nullptr;
+				Recti lastScissorRect = Recti(-1, -1);
+
+				std::size_t firstBatch = bufferIndex * BatchesPerCommandBuffer;
+				std::size_t lastBatch = std::min(firstBatch + BatchesPerCommandBuffer, m_modelBatches.size());
+				for (std::size_t batchIndex = firstBatch; batchIndex < lastBatch; ++batchIndex)
+				{
+					const ModelBatch& batch = m_modelBatches[batchIndex];
+					const BasicRenderQueue::Model& model = *m_batchModels[batch.firstModel];
+					const Shader* shader = batch.pipelineInstance->uberInstance->GetShader();
+
+					if (batch.pipelineInstance != lastInstance)
+					{
+						commandBuffer.BindPipeline(shader, model.material->GetPipeline()->GetInfo());
+						lastInstance = batch.pipelineInstance;
+
+						// Material parameters have to be sent to the new shader
+						lastBufferMaterial = nullptr;
+					}
+
+					if (lastBufferMaterial != model.material)
+					{
+						model.material->Record(commandBuffer, *batch.pipelineInstance);
+						lastBufferMaterial = model.material;
+					}
+
+					if (model.material->IsScissorTestEnabled())
+					{
+						const Nz::Recti& scissorRect = (model.scissorRect.width > 0) ? model.scissorRect : fullscreenScissorRect;
+						if (scissorRect != lastScissorRect)
+						{
+							commandBuffer.SetScissorRect(scissorRect);
+							lastScissorRect = scissorRect;
+						}
+					}
+
+					if (model.jointMatrices)
+						commandBuffer.SendMatrixArray(shader, batch.shaderUniforms->skinningMatrices, model.jointMatrices, static_cast<unsigned int>(model.jointCount));
+
+					bool indexed = (model.meshData.indexBuffer != nullptr);
+					unsigned int indexCount = (indexed) ? model.meshData.indexBuffer->GetIndexCount() : model.meshData.vertexBuffer->GetVertexCount();
+
+					commandBuffer.SetIndexBuffer(model.meshData.indexBuffer);
+					commandBuffer.SetVertexBuffer(model.meshData.vertexBuffer);
+
+					if (batch.indirect)
+					{
+						indirectCommands.clear();
+						instanceMatrices.clear();
+
+						// Back faces are culled per meshlet from the eye position, which is meaningless for an orthographic projection
+						bool backFaceCulling = model.material->IsFaceCullingEnabled() && model.material->GetFaceCulling() == FaceSide_Back && perspective;
+
+						// One command per mesh (or range of visible meshlets), each one drawing its instances
+						const MeshData* lastMeshData = nullptr;
+						for (std::size_t i = 0; i < batch.modelCount; ++i)
+						{
+							const BasicRenderQueue::Model& indirectModel = *m_batchModels[batch.firstModel + i];
+							const MeshData& meshData = indirectModel.meshData;
+							Int32 baseVertex = static_cast<Int32>(meshData.vertexBuffer->GetStartOffset() / meshData.vertexBuffer->GetStride());
+							UInt32 firstIndex = meshData.indexBuffer->GetStartOffset() / meshData.indexBuffer->GetStride();
+
+							if (meshData.meshletCount > 0)
+							{
+								lastMeshData = nullptr;
+
+								visibleMeshlets.resize(meshData.meshletCount);
+								std::size_t visibleMeshletCount = CullMeshlets(meshData.meshlets, meshData.meshletCount, indirectModel.matrix, frustum, eyePosition, backFaceCulling, visibleMeshlets.data());
+								if (visibleMeshletCount == 0)
+									continue;
+
+								UInt32 instance = static_cast<UInt32>(instanceMatrices.size());
+								instanceMatrices.push_back(indirectModel.matrix);
+
+								// Meshlets following each other in the index buffer are drawn by the same command
+								std::size_t firstCommand = indirectCommands.size();
+								for (std::size_t j = 0; j < visibleMeshletCount; ++j)
+								{
+									const Meshlet& meshlet = meshData.meshlets[visibleMeshlets[j]];
+									if (indirectCommands.size() > firstCommand)
+									{
+										Renderer::DrawIndexedIndirectCommand& lastCommand = indirectCommands.back();
+										if (lastCommand.firstIndex + lastCommand.indexCount == firstIndex + meshlet.firstIndex)
+										{
+											lastCommand.indexCount += meshlet.indexCount;
+											continue;
+										}
+									}
+
+									Renderer::DrawIndexedIndirectCommand command;
+									command.baseInstance = instance;
+									command.baseVertex = baseVertex;
+									command.firstIndex = firstIndex + meshlet.firstIndex;
+									command.indexCount = meshlet.indexCount;
+									command.instanceCount = 1;
+
+									indirectCommands.push_back(command);
+								}
+
+								continue;
+							}
+
+							// Models of the same mesh add instances to the command of the previous one
+							if (lastMeshData && lastMeshData->indexBuffer == meshData.indexBuffer && lastMeshData->vertexBuffer == meshData.vertexBuffer && indirectCommands.back().instanceCount < maxInstancePerCommand)
+								indirectCommands.back().instanceCount++;
+							else
+							{
+								Renderer::DrawIndexedIndirectCommand command;
+								command.baseInstance = static_cast<UInt32>(instanceMatrices.size());
+								command.baseVertex = baseVertex;
+								command.firstIndex = firstIndex;
+								command.indexCount = meshData.indexBuffer->GetIndexCount();
+								command.instanceCount = 1;
+
+								indirectCommands.push_back(command);
+								lastMeshData = &meshData;
+							}
+
+							instanceMatrices.push_back(indirectModel.matrix);
+						}
+
+						if (!indirectCommands.empty())
+							commandBuffer.DrawIndexedIndirect(model.meshData.primitiveMode, indirectCommands.data(), indirectCommands.size(), instanceMatrices.data(), instanceMatrices.size());
+					}
+					else if (batch.instancing)
+					{
+						instanceMatrices.clear();
+						for (std::size_t i = 0; i < batch.modelCount; ++i)
+							instanceMatrices.push_back(m_batchModels[batch.firstModel + i]->matrix);
+
+						if (indexed)
+							commandBuffer.DrawIndexedInstanced(instanceMatrices.data(), instanceMatrices.size(), model.meshData.primitiveMode, 0, indexCount);
+						else
+							commandBuffer.DrawInstanced(instanceMatrices.data(), instanceMatrices.size(), model.meshData.primitiveMode, 0, indexCount);
+					}
+					else
+					{
+						for (std::size_t i = 0; i < batch.modelCount; ++i)
+						{
+							commandBuffer.SetMatrix(MatrixType_World, m_batchModels[batch.firstModel + i]->matrix);
+
+							if (indexed)
+								commandBuffer.DrawIndexed(model.meshData.primitiveMode, 0, indexCount);
+							else
+								commandBuffer.Draw(model.meshData.primitiveMode, 0, indexCount);
+						}
+					}
+				}
+			}
+		});
+
+		return commandBufferCount;
+	}
+
 	bool DeferredGeometryPass::Initialize()
 	{
 		try
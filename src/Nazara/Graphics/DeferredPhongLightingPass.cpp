@@ -7,17 +7,32 @@
 #include <Nazara/Graphics/AbstractViewer.hpp>
 #include <Nazara/Graphics/DeferredProxyRenderQueue.hpp>
 #include <Nazara/Graphics/SceneData.hpp>
+#include <Nazara/Math/Algorithm.hpp>
 #include <Nazara/Renderer/Renderer.hpp>
 #include <Nazara/Renderer/RenderTexture.hpp>
 #include <Nazara/Utility/StaticMesh.hpp>
+#include <limits>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
 {
+	namespace
+	{
+		const unsigned int s_lightTileSize = 16; // In pixels
+
+		inline Vector4f ColorToVector(const Color& color)
+		{
+			return Vector4f(color.r / 255.f, color.g / 255.f, color.b / 255.f, color.a / 255.f);
+		}
+	}
+
 	/*!
 	* \ingroup graphics
 	* \class Nz::DeferredPhongLightingPass
 	* \brief Graphics class that represents the pass for phong lighting in deferred rendering
+	*
+	* By default, each point and spot light is drawn as a mesh, after being marked in the stencil buffer.
+	* With tiled lighting, the lights are binned into tiles of the screen and a single fullscreen pass shades every pixel with the lights of its tile.
 	*/
 
 	/*!
@@ -25,7 +40,9 @@ namespace Nz
 	*/
 
 	DeferredPhongLightingPass::DeferredPhongLightingPass() :
-	m_lightMeshesDrawing(false)
+	m_lightBuffer(BufferType_Uniform),
+	m_lightMeshesDrawing(false),
+	m_tiledLighting(false)
 	{
 		m_directionalLightShader = ShaderLibrary::Get("DeferredDirectionnalLight");
 		m_directionalLightShaderEyePositionLocation = m_directionalLightShader->GetUniformLocation("EyePosition");
@@ -52,6 +69,17 @@ namespace Nz
 		m_pointSpotLightUniforms.locations.parameters2 = m_pointSpotLightShader->GetUniformLocation("LightParameters2");
 		m_pointSpotLightUniforms.locations.parameters3 = m_pointSpotLightShader->GetUniformLocation("LightParameters3");
 
+		// Optional shader, tiled lighting falls back to light meshes without it
+		if (ShaderLibrary::Has("DeferredTiledLight"))
+		{
+			m_tiledLightShader = ShaderLibrary::Get("DeferredTiledLight");
+			m_tiledLightShaderEyePositionLocation = m_tiledLightShader->GetUniformLocation("EyePosition");
+			m_tiledLightShaderSceneAmbientLocation = m_tiledLightShader->GetUniformLocation("SceneAmbient");
+
+			m_lightBuffer.Create(NAZARA_GRAPHICS_MAX_LIGHTS_PER_SCENE * UInt32(sizeof(LightBlockData)), DataStorage_Hardware, BufferUsage_Dynamic);
+			m_lightBlockData.reserve(NAZARA_GRAPHICS_MAX_LIGHTS_PER_SCENE);
+		}
+
 		m_pointSampler.SetAnisotropyLevel(1);
 		m_pointSampler.SetFilterMode(SamplerFilter_Nearest);
 		m_pointSampler.SetWrapMode(SamplerWrap_Clamp);
@@ -78,6 +106,39 @@ namespace Nz
 		m_lightMeshesDrawing = enable;
 	}
 
+	/*!
+	* \brief Enables tiled lighting
+	*
+	* \param enable Should point and spot lights be shaded in a single fullscreen pass, using the lights of each tile of the screen
+	*
+	* \remark Light meshes are still drawn when the tiled light shader failed to compile
+	*/
+
+	void DeferredPhongLightingPass::EnableTiledLighting(bool enable)
+	{
+		m_tiledLighting = enable;
+	}
+
+	/*!
+	* \brief Gets the resources read by the pass
+	* \return The depth buffer and the G-Buffer
+	*/
+
+	DeferredResourceFlags DeferredPhongLightingPass::GetInputs() const
+	{
+		return DeferredResource_DepthStencil | DeferredResource_GBuffer;
+	}
+
+	/*!
+	* \brief Gets the resources written by the pass
+	* \return The lit scene color
+	*/
+
+	DeferredResourceFlags DeferredPhongLightingPass::GetOutputs() const
+	{
+		return DeferredResource_Scene;
+	}
+
 	/*!
 	* \brief Checks whether the drawing of meshes with light is enabled
 	* \return true If it is the case
@@ -88,6 +149,16 @@ namespace Nz
 		return m_lightMeshesDrawing;
 	}
 
+	/*!
+	* \brief Checks whether tiled lighting is enabled
+	* \return true If it is the case
+	*/
+
+	bool DeferredPhongLightingPass::IsTiledLightingEnabled() const
+	{
+		return m_tiledLighting;
+	}
+
 	/*!
 	* \brief Processes the work on the data while working with textures
 	* \return true
@@ -147,7 +218,12 @@ namespace Nz
 		}
 
 		// Point lights/Spot lights
-		if (!m_renderQueue->pointLights.empty() || !m_renderQueue->spotLights.empty())
+		if (m_tiledLighting && m_tiledLightShader)
+		{
+			if (!m_renderQueue->pointLights.empty() || !m_renderQueue->spotLights.empty())
+				DrawTiledLights(sceneData, lightStates);
+		}
+		else if (!m_renderQueue->pointLights.empty() || !m_renderQueue->spotLights.empty())
 		{
 			// http://www.altdevblogaday.com/2011/08/08/stencil-buffer-optimisation-for-deferred-lights/
 			lightStates.cullingSide = FaceSide_Front;
@@ -324,4 +400,145 @@ namespace Nz
 
 		return true;
 	}
+
+	/*!
+	* \brief Shades the point and spot lights in a single fullscreen pass
+	*
+	* \param sceneData Data for the scene
+	* \param lightStates Render states of the light passes
+	*
+	* Lights are sent through a uniform block, up to NAZARA_GRAPHICS_MAX_LIGHTS_PER_SCENE lights.
+	* Each tile of the screen holds a mask of the lights whose bounding sphere overlaps it, fragments only compute the lights of their tile.
+	*/
+
+	void DeferredPhongLightingPass::DrawTiledLights(const SceneData& sceneData, const RenderStates& lightStates) const
+	{
+		static_assert(NAZARA_GRAPHICS_MAX_LIGHTS_PER_SCENE <= 128, "Tiles hold a mask of 128 lights");
+
+		Vector2ui tileCount((m_dimensions.x + s_lightTileSize - 1) / s_lightTileSize, (m_dimensions.y + s_lightTileSize - 1) / s_lightTileSize);
+		if (!m_lightTileTexture || m_lightTileTexture->GetWidth() != tileCount.x || m_lightTileTexture->GetHeight() != tileCount.y)
+		{
+			m_lightTileTexture = Texture::New();
+			if (!m_lightTileTexture->Create(ImageType_2D, PixelFormatType_RGBA32UI, tileCount.x, tileCount.y))
+			{
+				NazaraError("Failed to create light tile texture");
+				m_lightTileTexture.Reset();
+				return;
+			}
+		}
+
+		auto PushLight = [&](LightType type, const Color& color, float ambientFactor, float diffuseFactor) -> LightBlockData*
+		{
+			if (m_lightBlockData.size() >= NAZARA_GRAPHICS_MAX_LIGHTS_PER_SCENE)
+				return nullptr;
+
+			m_lightBlockData.emplace_back();
+
+			LightBlockData& lightData = m_lightBlockData.back();
+			lightData.color = ColorToVector(color);
+			lightData.parameters1 = Vector4f::Zero();
+			lightData.parameters2 = Vector4f::Zero();
+			lightData.factors.Set(ambientFactor, diffuseFactor);
+			lightData.parameters3 = Vector2f::Zero();
+			lightData.type = type;
+			lightData.shadowMapping = 0;
+			lightData.padding[0] = 0;
+			lightData.padding[1] = 0;
+
+			return &lightData;
+		};
+
+		Matrix4f viewProjMatrix = Renderer::GetMatrix(MatrixType_ViewProj);
+
+		m_lightBlockData.clear();
+		m_lightTiles.assign(tileCount.x * tileCount.y * 4, 0);
+
+		// Marks the tiles covered by the screen bounds of the box around the sphere
+		auto AddSphereLight = [&](unsigned int lightIndex, const Vector3f& position, float radius)
+		{
+			Vector2ui first(0, 0);
+			Vector2ui last(tileCount.x - 1, tileCount.y - 1);
+
+			Vector2f projectedMin(std::numeric_limits<float>::infinity());
+			Vector2f projectedMax(-std::numeric_limits<float>::infinity());
+			bool bounded = true;
+			for (unsigned int corner = 0; corner < 8; ++corner)
+			{
+				Vector3f offset((corner & 1) ? radius : -radius, (corner & 2) ? radius : -radius, (corner & 4) ? radius : -radius);
+				Vector4f clipPosition = viewProjMatrix.Transform(Vector4f(position + offset, 1.f));
+				if (clipPosition.w <= 0.f)
+				{
+					// The box reaches behind the eye and may cover the whole screen
+					bounded = false;
+					break;
+				}
+
+				Vector2f projected(clipPosition.x / clipPosition.w, clipPosition.y / clipPosition.w);
+				projectedMin.Minimize(projected);
+				projectedMax.Maximize(projected);
+			}
+
+			if (bounded)
+			{
+				if (projectedMax.x < -1.f || projectedMin.x > 1.f || projectedMax.y < -1.f || projectedMin.y > 1.f)
+					return;
+
+				auto ProjectedToTile = [](float coord, unsigned int count)
+				{
+					return static_cast<unsigned int>(Clamp((coord * 0.5f + 0.5f) * count, 0.f, float(count - 1)));
+				};
+
+				first.Set(ProjectedToTile(projectedMin.x, tileCount.x), ProjectedToTile(projectedMin.y, tileCount.y));
+				last.Set(ProjectedToTile(projectedMax.x, tileCount.x), ProjectedToTile(projectedMax.y, tileCount.y));
+			}
+
+			UInt32 lightBit = 1U << (lightIndex % 32);
+			unsigned int word = lightIndex / 32;
+
+			for (unsigned int y = first.y; y <= last.y; ++y)
+			{
+				for (unsigned int x = first.x; x <= last.x; ++x)
+					m_lightTiles[(y * tileCount.x + x) * 4 + word] |= lightBit;
+			}
+		};
+
+		for (const auto& light : m_renderQueue->pointLights)
+		{
+			unsigned int lightIndex = static_cast<unsigned int>(m_lightBlockData.size());
+			if (LightBlockData* lightData = PushLight(LightType_Point, light.color, light.ambientFactor, light.diffuseFactor))
+			{
+				lightData->parameters1 = Vector4f(light.position, light.attenuation);
+				lightData->parameters2 = Vector4f(0.f, 0.f, 0.f, light.invRadius);
+
+				AddSphereLight(lightIndex, light.position, light.radius);
+			}
+		}
+
+		for (const auto& light : m_renderQueue->spotLights)
+		{
+			unsigned int lightIndex = static_cast<unsigned int>(m_lightBlockData.size());
+			if (LightBlockData* lightData = PushLight(LightType_Spot, light.color, light.ambientFactor, light.diffuseFactor))
+			{
+				lightData->parameters1 = Vector4f(light.position, light.attenuation);
+				lightData->parameters2 = Vector4f(light.direction, light.invRadius);
+				lightData->parameters3.Set(light.innerAngleCosine, light.outerAngleCosine);
+
+				AddSphereLight(lightIndex, light.position, light.radius);
+			}
+		}
+
+		m_lightBuffer.Fill(m_lightBlockData.data(), 0, static_cast<UInt32>(m_lightBlockData.size() * sizeof(LightBlockData)));
+		m_lightTileTexture->Update(reinterpret_cast<const UInt8*>(m_lightTiles.data()));
+
+		Renderer::SetRenderStates(lightStates);
+		Renderer::SetShader(m_tiledLightShader);
+		Renderer::SetTexture(4, m_lightTileTexture);
+		Renderer::SetTextureSampler(4, m_pointSampler);
+		Renderer::SetUniformBuffer(UniformBlock_Lights, &m_lightBuffer);
+
+		m_tiledLightShader->SendColor(m_tiledLightShaderSceneAmbientLocation, sceneData.ambientColor);
+		m_tiledLightShader->SendVector(m_tiledLightShaderEyePositionLocation, sceneData.viewer->GetEyePosition());
+
+		Renderer::DrawFullscreenQuad();
+	}
 }
@@ -31,7 +31,7 @@ namespace Nz
 	{
 		NazaraAssert(material, "Invalid material");
 
-		if (!material->IsBlendingEnabled())
+		if (!material->IsBlendingEnabled() && !material->IsOrderIndependentTransparencyEnabled())
 			m_deferredRenderQueue->AddBillboards(renderOrder, material, billboardCount, scissorRect, positionPtr, sizePtr, sinCosPtr, colorPtr);
 		else
 			m_forwardRenderQueue->AddBillboards(renderOrder, material, billboardCount, scissorRect, positionPtr, sizePtr, sinCosPtr, colorPtr);
@@ -53,7 +53,7 @@ namespace Nz
 	{
 		NazaraAssert(material, "Invalid material");
 
-		if (!material->IsBlendingEnabled())
+		if (!material->IsBlendingEnabled() && !material->IsOrderIndependentTransparencyEnabled())
 			m_deferredRenderQueue->AddBillboards(renderOrder, material, billboardCount, scissorRect, positionPtr, sizePtr, sinCosPtr, alphaPtr);
 		else
 			m_forwardRenderQueue->AddBillboards(renderOrder, material, billboardCount, scissorRect, positionPtr, sizePtr, sinCosPtr, alphaPtr);
@@ -75,7 +75,7 @@ namespace Nz
 	{
 		NazaraAssert(material, "Invalid material");
 
-		if (!material->IsBlendingEnabled())
+		if (!material->IsBlendingEnabled() && !material->IsOrderIndependentTransparencyEnabled())
 			m_deferredRenderQueue->AddBillboards(renderOrder, material, billboardCount, scissorRect, positionPtr, sizePtr, anglePtr, colorPtr);
 		else
 			m_forwardRenderQueue->AddBillboards(renderOrder, material, billboardCount, scissorRect, positionPtr, sizePtr, anglePtr, colorPtr);
@@ -97,7 +97,7 @@ namespace Nz
 	{
 		NazaraAssert(material, "Invalid material");
 
-		if (!material->IsBlendingEnabled())
+		if (!material->IsBlendingEnabled() && !material->IsOrderIndependentTransparencyEnabled())
 			m_deferredRenderQueue->AddBillboards(renderOrder, material, billboardCount, scissorRect, positionPtr, sizePtr, anglePtr, alphaPtr);
 		else
 			m_forwardRenderQueue->AddBillboards(renderOrder, material, billboardCount, scissorRect, positionPtr, sizePtr, anglePtr, alphaPtr);
@@ -119,7 +119,7 @@ namespace Nz
 	{
 		NazaraAssert(material, "Invalid material");
 
-		if (!material->IsBlendingEnabled())
+		if (!material->IsBlendingEnabled() && !material->IsOrderIndependentTransparencyEnabled())
 			m_deferredRenderQueue->AddBillboards(renderOrder, material, billboardCount, scissorRect, positionPtr, sizePtr, sinCosPtr, colorPtr);
 		else
 			m_forwardRenderQueue->AddBillboards(renderOrder, material, billboardCount, scissorRect, positionPtr, sizePtr, sinCosPtr, colorPtr);
@@ -141,7 +141,7 @@ namespace Nz
 	{
 		NazaraAssert(material, "Invalid material");
 
-		if (!material->IsBlendingEnabled())
+		if (!material->IsBlendingEnabled() && !material->IsOrderIndependentTransparencyEnabled())
 			m_deferredRenderQueue->AddBillboards(renderOrder, material, billboardCount, scissorRect, positionPtr, sizePtr, sinCosPtr, alphaPtr);
 		else
 			m_forwardRenderQueue->AddBillboards(renderOrder, material, billboardCount, scissorRect, positionPtr, sizePtr, sinCosPtr, alphaPtr);
@@ -163,7 +163,7 @@ namespace Nz
 	{
 		NazaraAssert(material, "Invalid material");
 
-		if (!material->IsBlendingEnabled())
+		if (!material->IsBlendingEnabled() && !material->IsOrderIndependentTransparencyEnabled())
 			m_deferredRenderQueue->AddBillboards(renderOrder, material, billboardCount, scissorRect, positionPtr, sizePtr, anglePtr, colorPtr);
 		else
 			m_forwardRenderQueue->AddBillboards(renderOrder, material, billboardCount, scissorRect, positionPtr, sizePtr, anglePtr, colorPtr);
@@ -185,7 +185,7 @@ namespace Nz
 	{
 		NazaraAssert(material, "Invalid material");
 
-		if (!material->IsBlendingEnabled())
+		if (!material->IsBlendingEnabled() && !material->IsOrderIndependentTransparencyEnabled())
 			m_deferredRenderQueue->AddBillboards(renderOrder, material, billboardCount, scissorRect, positionPtr, sizePtr, anglePtr, alphaPtr);
 		else
 			m_forwardRenderQueue->AddBillboards(renderOrder, material, billboardCount, scissorRect, positionPtr, sizePtr, anglePtr, alphaPtr);
@@ -219,12 +219,49 @@ namespace Nz
 	{
 		NazaraAssert(material, "Invalid material");
 
-		if (!material->IsBlendingEnabled())
+		if (!material->IsBlendingEnabled() && !material->IsOrderIndependentTransparencyEnabled())
 			m_deferredRenderQueue->AddMesh(renderOrder, material, meshData, meshAABB, transformMatrix, scissorRect);
 		else
 			m_forwardRenderQueue->AddMesh(renderOrder, material, meshData, meshAABB, transformMatrix, scissorRect);
 	}
 
+	/*!
+	* \brief Adds a reflection probe to the queue
+	*
+	* The probe is also given to the forward queue, which draws the reflective objects
+	*
+	* \param probe Reflection probe
+	*/
+
+	void DeferredProxyRenderQueue::AddReflectionProbe(const ReflectionProbe& probe)
+	{
+		AbstractRenderQueue::AddReflectionProbe(probe);
+
+		m_forwardRenderQueue->AddReflectionProbe(probe);
+	}
+
+	/*!
+	* \brief Adds a mesh skinned by the vertex shader to the queue
+	*
+	* \param renderOrder Order of rendering
+	* \param material Material of the mesh
+	* \param meshData Data of the mesh
+	* \param meshAABB Box of the mesh
+	* \param transformMatrix Matrix of the mesh
+	* \param jointMatrices Skinning matrices of the skeleton joints
+	* \param jointCount Number of joint matrices
+	*/
+
+	void DeferredProxyRenderQueue::AddSkinnedMesh(int renderOrder, const Material* material, const MeshData& meshData, const Boxf& meshAABB, const Matrix4f& transformMatrix, const Matrix4f* jointMatrices, std::size_t jointCount, const Recti& scissorRect)
+	{
+		NazaraAssert(material, "Invalid material");
+
+		if (!material->IsBlendingEnabled() && !material->IsOrderIndependentTransparencyEnabled())
+			m_deferredRenderQueue->AddSkinnedMesh(renderOrder, material, meshData, meshAABB, transformMatrix, jointMatrices, jointCount, scissorRect);
+		else
+			m_forwardRenderQueue->AddSkinnedMesh(renderOrder, material, meshData, meshAABB, transformMatrix, jointMatrices, jointCount, scissorRect);
+	}
+
 	/*!
 	* \brief Adds sprites to the queue
 	*
@@ -233,16 +270,18 @@ namespace Nz
 	* \param vertices Buffer of data for the sprites
 	* \param spriteCount Number of sprites
 	* \param overlay Texture of the sprites
+	* \param overlayLayer Layer of the overlay the sprites use, if it's a texture array
+	* \param instances Optional instance records of the same sprites, allowing them to be expanded by the vertex shader
 	*/
 
-	void DeferredProxyRenderQueue::AddSprites(int renderOrder, const Material* material, const VertexStruct_XYZ_Color_UV* vertices, std::size_t spriteCount, const Recti& scissorRect, const Texture* overlay)
+	void DeferredProxyRenderQueue::AddSprites(int renderOrder, const Material* material, const VertexStruct_XYZ_Color_UV* vertices, std::size_t spriteCount, const Recti& scissorRect, const Texture* overlay, unsigned int overlayLayer, const SpriteInstance* instances)
 	{
 		NazaraAssert(material, "Invalid material");
 
-		if (!material->IsBlendingEnabled())
-			m_deferredRenderQueue->AddSprites(renderOrder, material, vertices, spriteCount, scissorRect, overlay);
+		if (!material->IsBlendingEnabled() && !material->IsOrderIndependentTransparencyEnabled())
+			m_deferredRenderQueue->AddSprites(renderOrder, material, vertices, spriteCount, scissorRect, overlay, overlayLayer, instances);
 		else
-			m_forwardRenderQueue->AddSprites(renderOrder, material, vertices, spriteCount, scissorRect, overlay);
+			m_forwardRenderQueue->AddSprites(renderOrder, material, vertices, spriteCount, scissorRect, overlay, overlayLayer, instances);
 	}
 
 	/*!
@@ -258,4 +297,16 @@ namespace Nz
 		m_deferredRenderQueue->Clear(fully);
 		m_forwardRenderQueue->Clear(fully);
 	}
+
+	/*!
+	* \brief Clears the lights of the queue and of its underlying queues
+	*/
+
+	void DeferredProxyRenderQueue::ClearLights()
+	{
+		AbstractRenderQueue::ClearLights();
+
+		m_deferredRenderQueue->ClearLights();
+		m_forwardRenderQueue->ClearLights();
+	}
 }
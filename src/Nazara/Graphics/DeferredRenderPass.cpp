@@ -38,6 +38,32 @@ namespace Nz
 		m_enabled = enable;
 	}
 
+	/*!
+	* \brief Gets the resources read by the pass
+	* \return Resources whose content the pass needs
+	*
+	* By default, a pass is a post-process reading the scene color
+	*/
+
+	DeferredResourceFlags DeferredRenderPass::GetInputs() const
+	{
+		return DeferredResource_Scene;
+	}
+
+	/*!
+	* \brief Gets the resources written by the pass
+	* \return Resources whose content the pass produces
+	*
+	* The technique culls a pass if none of its outputs is read by a following pass or is the render target of the viewer
+	*
+	* By default, a pass is a post-process writing the scene color
+	*/
+
+	DeferredResourceFlags DeferredRenderPass::GetOutputs() const
+	{
+		return DeferredResource_Scene;
+	}
+
 	/*!
 	* \brief Initializes the deferred forward pass which needs the deferred technique
 	*
@@ -8,6 +8,7 @@
 
 #include <Nazara/Graphics/DeferredRenderTechnique.hpp>
 #include <Nazara/Core/ErrorFlags.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Graphics/AbstractViewer.hpp>
 #include <Nazara/Graphics/DeferredBloomPass.hpp>
 #include <Nazara/Graphics/DeferredDOFPass.hpp>
@@ -18,11 +19,15 @@
 #include <Nazara/Graphics/DeferredGeometryPass.hpp>
 #include <Nazara/Graphics/DeferredPhongLightingPass.hpp>
 #include <Nazara/Graphics/SceneData.hpp>
+#include <Nazara/Math/Algorithm.hpp>
 #include <Nazara/Renderer/Config.hpp>
+#include <Nazara/Renderer/GpuProfiler.hpp>
 #include <Nazara/Renderer/OpenGL.hpp>
 #include <Nazara/Renderer/Renderer.hpp>
 #include <Nazara/Renderer/Shader.hpp>
 #include <Nazara/Renderer/ShaderStage.hpp>
+#include <algorithm>
+#include <cmath>
 #include <memory>
 #include <Nazara/Graphics/Debug.hpp>
 
@@ -58,6 +63,14 @@ namespace Nz
 			#include <Nazara/Graphics/Resources/DeferredShading/Shaders/PointSpotLight.frag.h>
 		};
 
+		const UInt8 r_fragmentSource_TiledLight[] = {
+			#include <Nazara/Graphics/Resources/DeferredShading/Shaders/TiledLight.frag.h>
+		};
+
+		const UInt8 r_fragmentSource_Upscale[] = {
+			#include <Nazara/Graphics/Resources/DeferredShading/Shaders/Upscale.frag.h>
+		};
+
 		unsigned int RenderPassPriority[] =
 		{
 			6,    // RenderPassType_AA
@@ -73,6 +86,24 @@ namespace Nz
 
 		static_assert(sizeof(RenderPassPriority) / sizeof(unsigned int) == RenderPassType_Max + 1, "Render pass priority array is incomplete");
 
+		const char* RenderPassName[] =
+		{
+			"DeferredAAPass",              // RenderPassType_AA
+			"DeferredBloomPass",           // RenderPassType_Bloom
+			"DeferredDOFPass",             // RenderPassType_DOF
+			"DeferredFinalPass",           // RenderPassType_Final
+			"DeferredFogPass",             // RenderPassType_Fog
+			"DeferredForwardPass",         // RenderPassType_Forward
+			"DeferredLightingPass",        // RenderPassType_Lighting
+			"DeferredLightScatteringPass", // RenderPassType_LightScattering
+			"DeferredGeometryPass",        // RenderPassType_Geometry
+			"DeferredSSAOPass"             // RenderPassType_SSAO
+		};
+
+		static_assert(sizeof(RenderPassName) / sizeof(const char*) == RenderPassType_Max + 1, "Render pass name array is incomplete");
+
+		bool s_initialized = false;
+
 		/*!
 		* \brief Registers the deferred shader
 		* \return Reference to the newly created shader
@@ -112,24 +143,111 @@ namespace Nz
 			ShaderLibrary::Register(name, shader);
 			return shader;
 		}
+
+		// Viewer seen by the passes when the scene is drawn at a lower resolution: the viewport and the target are the ones of the work textures
+		// The final pass still applies the view of the actual viewer, to draw the upscaled scene in its target
+		class ScaledViewer : public AbstractViewer
+		{
+			public:
+				ScaledViewer(const AbstractViewer* viewer, const RenderTarget* workTarget, const Vector2ui& size) :
+				m_viewport(0, 0, size.x, size.y),
+				m_viewer(viewer),
+				m_workTarget(workTarget)
+				{
+				}
+
+				void ApplyView() const override
+				{
+					m_viewer->ApplyView();
+				}
+
+				float GetAspectRatio() const override
+				{
+					return m_viewer->GetAspectRatio();
+				}
+
+				Vector3f GetEyePosition() const override
+				{
+					return m_viewer->GetEyePosition();
+				}
+
+				Vector3f GetForward() const override
+				{
+					return m_viewer->GetForward();
+				}
+
+				const Frustumf& GetFrustum() const override
+				{
+					return m_viewer->GetFrustum();
+				}
+
+				const Matrix4f& GetProjectionMatrix() const override
+				{
+					return m_viewer->GetProjectionMatrix();
+				}
+
+				ProjectionType GetProjectionType() const override
+				{
+					return m_viewer->GetProjectionType();
+				}
+
+				const RenderTarget* GetTarget() const override
+				{
+					return m_workTarget;
+				}
+
+				const Matrix4f& GetViewMatrix() const override
+				{
+					return m_viewer->GetViewMatrix();
+				}
+
+				const Recti& GetViewport() const override
+				{
+					return m_viewport;
+				}
+
+				float GetZFar() const override
+				{
+					return m_viewer->GetZFar();
+				}
+
+				float GetZNear() const override
+				{
+					return m_viewer->GetZNear();
+				}
+
+			private:
+				Recti m_viewport;
+				const AbstractViewer* m_viewer;
+				const RenderTarget* m_workTarget;
+		};
 	}
 
 	/*!
 	* \ingroup graphics
 	* \class Nz::DeferredRenderTechnique
 	* \brief Graphics class that represents the technique used in deferred rendering
+	*
+	* The scene may be drawn at a lower resolution than the viewport of the viewer, then upscaled by the final pass, see SetResolutionScale
 	*/
 
 	/*!
 	* \brief Constructs a DeferredRenderTechnique object by default
 	*
-	* \remark Produces a NazaraError if one pass could not be created
+	* \remark Produces a NazaraError if the deferred shaders or one pass could not be created
 	*/
 
 	DeferredRenderTechnique::DeferredRenderTechnique() :
 	m_renderQueue(&m_deferredRenderQueue, static_cast<BasicRenderQueue*>(m_forwardTechnique.GetRenderQueue())),
-	m_GBufferSize(0U)
+	m_GBufferSize(0U),
+	m_resolutionScale(1.f)
 	{
+		if (!Initialize())
+		{
+			ErrorFlags errFlags(ErrorFlag_ThrowException);
+			NazaraError("Failed to initialize deferred shaders");
+		}
+
 		m_depthStencilTexture = Texture::New();
 
 		for (unsigned int i = 0; i < 2; ++i)
@@ -221,6 +339,96 @@ namespace Nz
 
 	DeferredRenderTechnique::~DeferredRenderTechnique() = default;
 
+	/*!
+	* \brief Acquires a transient render target for the current frame
+	* \return Transient target, or nullptr if it could not be created
+	*
+	* Passes asking for the same format, size and color target count during a frame share the same target.
+	* The textures of a transient target are borrowed from the target pool of the technique for the frame, hence only the passes actually drawn use video memory
+	* for their intermediate textures, and textures left unused (after a resize for example) are destroyed after a few frames.
+	*
+	* \param format Pixel format of the color textures
+	* \param size Size of the color textures
+	* \param colorTargetCount Number of color textures attached to the render texture
+	*
+	* \remark The content of a transient target is only valid during the Process call of the pass which acquired it
+	* \remark Produces a NazaraError if the render texture could not be completed
+	*
+	* \see GetTargetPool
+	*/
+
+	const DeferredRenderTechnique::TransientTarget* DeferredRenderTechnique::AcquireTransientTarget(PixelFormatType format, const Vector2ui& size, unsigned int colorTargetCount) const
+	{
+		NazaraAssert(size.x > 0 && size.y > 0, "Invalid size");
+		NazaraAssert(colorTargetCount > 0, "Transient target must have at least one color target");
+
+		TransientTarget* reusableTarget = nullptr;
+		for (auto& targetPtr : m_transientTargets)
+		{
+			TransientTarget& target = *targetPtr;
+			if (target.textures.size() != colorTargetCount)
+				continue;
+
+			if (target.acquired)
+			{
+				// Passes are processed one after another and don't keep the content of their transient targets, they can alias the same one
+				if (target.format == format && target.size == size)
+					return &target;
+			}
+			else if (!reusableTarget || (target.format == format && target.size == size))
+				reusableTarget = &target;
+		}
+
+		if (!reusableTarget)
+		{
+			std::unique_ptr<TransientTarget> newTarget = std::make_unique<TransientTarget>();
+			if (!newTarget->renderTexture.Create())
+			{
+				NazaraError("Failed to create transient render texture");
+				return nullptr;
+			}
+
+			newTarget->acquired = false;
+			newTarget->textures.resize(colorTargetCount);
+
+			m_transientTargets.emplace_back(std::move(newTarget));
+			reusableTarget = m_transientTargets.back().get();
+		}
+
+		reusableTarget->format = format;
+		reusableTarget->size = size;
+
+		// The render texture is kept, its textures only have to be attached again when the pool gives different ones
+		reusableTarget->renderTexture.Lock();
+		for (unsigned int i = 0; i < colorTargetCount; ++i)
+		{
+			TextureRef texture = m_targetPool.AcquireTexture(format, size.x, size.y);
+			if (!texture)
+			{
+				reusableTarget->renderTexture.Unlock();
+
+				NazaraError("Failed to acquire transient texture");
+				return nullptr;
+			}
+
+			if (reusableTarget->textures[i] != texture)
+			{
+				reusableTarget->textures[i] = std::move(texture);
+				reusableTarget->renderTexture.AttachTexture(AttachmentPoint_Color, static_cast<UInt8>(i), reusableTarget->textures[i]);
+			}
+		}
+		reusableTarget->renderTexture.Unlock();
+
+		if (!reusableTarget->renderTexture.IsComplete())
+		{
+			NazaraError("Incomplete transient RTT");
+			return nullptr;
+		}
+
+		reusableTarget->acquired = true;
+		return reusableTarget;
+	}
+
 	/*!
 	* \brief Clears the data
 	*
@@ -247,7 +455,15 @@ namespace Nz
 		NazaraAssert(sceneData.viewer, "Invalid viewer");
 		Recti viewerViewport = sceneData.viewer->GetViewport();
 
+		// Orthographic viewers (usually drawing 2D and interfaces) stay at native resolution
 		Vector2ui viewportDimensions(viewerViewport.width, viewerViewport.height);
+		bool scaled = (m_resolutionScale < 1.f && sceneData.viewer->GetProjectionType() == ProjectionType_Perspective);
+		if (scaled)
+		{
+			viewportDimensions.x = std::max(static_cast<unsigned int>(std::lround(viewportDimensions.x * m_resolutionScale)), 1U);
+			viewportDimensions.y = std::max(static_cast<unsigned int>(std::lround(viewportDimensions.y * m_resolutionScale)), 1U);
+		}
+
 		if (viewportDimensions != m_GBufferSize)
 		{
 			if (!Resize(viewportDimensions))
@@ -257,21 +473,49 @@ namespace Nz
 			}
 		}
 
-		unsigned int sceneTexture = 0;
-		unsigned int workTexture = 1;
+		// Passes are scheduled backward from the viewer target, a pass none of whose outputs is read by a following pass is culled
+		m_passSchedule.clear();
 		for (auto& passIt : m_passes)
 		{
 			for (auto& passIt2 : passIt.second)
 			{
 				const DeferredRenderPass* pass = passIt2.second.get();
 				if (pass->IsEnabled())
-				{
-					if (pass->Process(sceneData, workTexture, sceneTexture))
-						std::swap(workTexture, sceneTexture);
-				}
+					m_passSchedule.emplace_back(passIt.first, pass);
 			}
 		}
 
+		DeferredResourceFlags consumedResources = DeferredResource_Target;
+		for (auto it = m_passSchedule.rbegin(); it != m_passSchedule.rend(); ++it)
+		{
+			DeferredResourceFlags outputs = it->second->GetOutputs();
+			if (consumedResources & outputs)
+				consumedResources = (consumedResources & ~outputs) | it->second->GetInputs();
+			else
+				it->second = nullptr;
+		}
+
+		ScaledViewer scaledViewer(sceneData.viewer, &m_workRTT, viewportDimensions);
+
+		SceneData passSceneData(sceneData);
+		if (scaled)
+			passSceneData.viewer = &scaledViewer;
+
+		unsigned int sceneTexture = 0;
+		unsigned int workTexture = 1;
+		for (const auto& scheduledPass : m_passSchedule)
+		{
+			if (!scheduledPass.second)
+				continue;
+
+			GpuProfiler::Scope profilerScope(RenderPassName[scheduledPass.first]);
+
+			if (scheduledPass.second->Process(passSceneData, workTexture, sceneTexture))
+				std::swap(workTexture, sceneTexture);
+		}
+
+		ReleaseTransientTargets();
+
 		return true;
 	}
 
@@ -377,6 +621,28 @@ namespace Nz
 		return &m_renderQueue;
 	}
 
+	/*!
+	* \brief Gets the scale of the resolution the scene is drawn at
+	* \return Ratio between the size of the G-buffer and the size of the viewport of the viewer
+	*/
+
+	float DeferredRenderTechnique::GetResolutionScale() const
+	{
+		return m_resolutionScale;
+	}
+
+	/*!
+	* \brief Gets the pool lending their textures to the transient targets
+	* \return Reference to the target pool
+	*
+	* \remark Passes may borrow their own textures from it, as long as they release them before the end of their Process call
+	*/
+
+	RenderTargetPool& DeferredRenderTechnique::GetTargetPool() const
+	{
+		return m_targetPool;
+	}
+
 	/*!
 	* \brief Gets the type of the current technique
 	* \return Type of the render technique
@@ -521,6 +787,22 @@ namespace Nz
 			m_passes[relativeTo].erase(position);
 	}
 
+	/*!
+	* \brief Sets the scale of the resolution the scene is drawn at
+	*
+	* Below one, the G-buffer and the work textures of perspective viewers are smaller than their viewport and the final pass upscales the scene (see DeferredFinalPass::SetSharpness).
+	* This is meant to be driven by a DynamicResolutionController, keeping the GPU time of the frames within a budget.
+	*
+	* \param scale Ratio between the size of the G-buffer and the size of the viewport, clamped between 0.25 and 1
+	*
+	* \remark Changing the scale reallocates the G-buffer on the next draw, the scale should be changed by steps rather than continuously
+	*/
+
+	void DeferredRenderTechnique::SetResolutionScale(float scale)
+	{
+		m_resolutionScale = Clamp(scale, 0.25f, 1.f);
+	}
+
 	/*!
 	* \brief Checks whether the technique is supported
 	* \return true if it is the case
@@ -532,6 +814,21 @@ namespace Nz
 		return Renderer::GetMaxColorAttachments() >= 4 && Renderer::GetMaxRenderTargets() >= 4;
 	}
 
+	/*!
+	* \brief Releases the transient targets no pass acquired during the frame, and gives the textures of the others back to the target pool
+	*/
+
+	void DeferredRenderTechnique::ReleaseTransientTargets() const
+	{
+		auto it = std::remove_if(m_transientTargets.begin(), m_transientTargets.end(), [] (const std::unique_ptr<TransientTarget>& target) { return !target->acquired; });
+		m_transientTargets.erase(it, m_transientTargets.end());
+
+		for (auto& targetPtr : m_transientTargets)
+			targetPtr->acquired = false;
+
+		m_targetPool.EndFrame();
+	}
+
 	/*!
 	* \brief Resizes the texture sizes used for the render technique
 	* \return true If successful
@@ -566,11 +863,18 @@ namespace Nz
 	* \brief Initializes the deferred render technique
 	* \return true If successful
 	*
+	* Called when the first deferred technique is constructed, as compiling the deferred shaders takes a noticeable time.
+	*
 	* \remark Produces a NazaraError if one shader creation failed
 	*/
 
 	bool DeferredRenderTechnique::Initialize()
 	{
+		if (s_initialized)
+			return true;
+
+		Profiler::Scope profilerScope("DeferredRenderTechnique::Initialize");
+
 		const char vertexSource_Basic[] =
 		"#version 140\n"
 
@@ -701,12 +1005,37 @@ namespace Nz
 			NazaraWarning("Failed to register gaussian blur shader, certain features will not work: " + error);
 		}
 
+
+		shader = RegisterDeferredShader("DeferredTiledLight", r_fragmentSource_TiledLight, sizeof(r_fragmentSource_TiledLight), ppVertexStage, &error);
+		if (shader)
+		{
+			shader->SendInteger(shader->GetUniformLocation("GBuffer0"), 0);
+			shader->SendInteger(shader->GetUniformLocation("GBuffer1"), 1);
+			shader->SendInteger(shader->GetUniformLocation("GBuffer2"), 2);
+			shader->SendInteger(shader->GetUniformLocation("DepthBuffer"), 3);
+			shader->SendInteger(shader->GetUniformLocation("LightTiles"), 4);
+			shader->SetUniformBlockBinding(shader->GetUniformBlockIndex("LightBlock"), UniformBlock_Lights);
+		}
+		else
+		{
+			NazaraWarning("Failed to register tiled light shader, certain features will not work: " + error);
+		}
+
+		shader = RegisterDeferredShader("DeferredUpscale", r_fragmentSource_Upscale, sizeof(r_fragmentSource_Upscale), ppVertexStage, &error);
+		if (shader)
+			shader->SendInteger(shader->GetUniformLocation("ColorTexture"), 0);
+		else
+		{
+			NazaraWarning("Failed to register upscale shader, certain features will not work: " + error);
+		}
+
 		if (!DeferredGeometryPass::Initialize())
 		{
 			NazaraError("Failed to initialize geometry pass");
 			return false;
 		}
 
+		s_initialized = true;
 		return true;
 	}
 
@@ -725,6 +1054,10 @@ namespace Nz
 		ShaderLibrary::Unregister("DeferredBloomFinal");
 		ShaderLibrary::Unregister("DeferredFXAA");
 		ShaderLibrary::Unregister("DeferredGaussianBlur");
+		ShaderLibrary::Unregister("DeferredTiledLight");
+		ShaderLibrary::Unregister("DeferredUpscale");
+
+		s_initialized = false;
 	}
 
 	/*!
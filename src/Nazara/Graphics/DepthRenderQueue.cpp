@@ -312,6 +312,36 @@ namespace Nz
 		BasicRenderQueue::AddMesh(0, material, meshData, meshAABB, transformMatrix, scissorRect);
 	}
 
+	/*!
+	* \brief Adds a mesh skinned by the vertex shader to the queue
+	*
+	* \param renderOrder Order of rendering
+	* \param material Material of the mesh
+	* \param meshData Data of the mesh
+	* \param meshAABB Box of the mesh
+	* \param transformMatrix Matrix of the mesh
+	* \param jointMatrices Skinning matrices of the skeleton joints
+	* \param jointCount Number of joint matrices
+	*
+	* \remark Produces a NazaraAssert if material is invalid
+	*/
+
+	void DepthRenderQueue::AddSkinnedMesh(int renderOrder, const Material* material, const MeshData& meshData, const Boxf& meshAABB, const Matrix4f& transformMatrix, const Matrix4f* jointMatrices, std::size_t jointCount, const Recti& scissorRect)
+	{
+		NazaraAssert(material, "Invalid material");
+		NazaraUnused(renderOrder);
+
+		if (!IsMaterialSuitable(material))
+			return;
+
+		if (material->HasDepthMaterial())
+			material = material->GetDepthMaterial();
+		else
+			material = m_baseMaterial;
+
+		BasicRenderQueue::AddSkinnedMesh(0, material, meshData, meshAABB, transformMatrix, jointMatrices, jointCount, scissorRect);
+	}
+
 	/*!
 	* \brief Adds a point light to the queue
 	*
@@ -348,11 +378,13 @@ namespace Nz
 	* \param vertices Buffer of data for the sprites
 	* \param spriteCount Number of sprites
 	* \param overlay Texture of the sprites
+	* \param overlayLayer Layer of the overlay the sprites use, if it's a texture array
+	* \param instances Optional instance records of the same sprites, allowing them to be expanded by the vertex shader
 	*
 	* \remark Produces a NazaraAssert if material is invalid
 	*/
 
-	void DepthRenderQueue::AddSprites(int renderOrder, const Material* material, const VertexStruct_XYZ_Color_UV* vertices, std::size_t spriteCount, const Recti& scissorRect, const Texture* overlay /*= nullptr*/)
+	void DepthRenderQueue::AddSprites(int renderOrder, const Material* material, const VertexStruct_XYZ_Color_UV* vertices, std::size_t spriteCount, const Recti& scissorRect, const Texture* overlay /*= nullptr*/, unsigned int overlayLayer /*= 0*/, const SpriteInstance* instances /*= nullptr*/)
 	{
 		NazaraAssert(material, "Invalid material");
 		NazaraUnused(renderOrder);
@@ -366,7 +398,7 @@ namespace Nz
 		else
 			material = m_baseMaterial;
 
-		BasicRenderQueue::AddSprites(0, material, vertices, spriteCount, scissorRect, overlay);
+		BasicRenderQueue::AddSprites(0, material, vertices, spriteCount, scissorRect, overlay, overlayLayer, instances);
 	}
 }
 
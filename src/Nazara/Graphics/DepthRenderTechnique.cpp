@@ -13,7 +13,9 @@
 #include <Nazara/Renderer/Config.hpp>
 #include <Nazara/Renderer/Renderer.hpp>
 #include <Nazara/Renderer/RenderTarget.hpp>
+#include <Nazara/Utility/Algorithm.hpp>
 #include <Nazara/Utility/BufferMapper.hpp>
+#include <Nazara/Utility/VertexDeclaration.hpp>
 #include <Nazara/Utility/VertexStruct.hpp>
 #include <limits>
 #include <Nazara/Graphics/Debug.hpp>
@@ -31,6 +33,23 @@ namespace Nz
 			Vector2f uv;
 		};
 
+		bool IsIndirectCompatible(const MeshData& first, const MeshData& second)
+		{
+			if (!second.indexBuffer || first.primitiveMode != second.primitiveMode)
+				return false;
+
+			const IndexBuffer* firstIndices = first.indexBuffer;
+			const IndexBuffer* secondIndices = second.indexBuffer;
+			if (firstIndices->GetBuffer() != secondIndices->GetBuffer() || firstIndices->HasLargeIndices() != secondIndices->HasLargeIndices())
+				return false;
+
+			// The vertex array object is shared as long as the vertices have the same declaration and alignment in the same buffer
+			const VertexBuffer* firstVertices = first.vertexBuffer;
+			const VertexBuffer* secondVertices = second.vertexBuffer;
+			return firstVertices->GetBuffer() == secondVertices->GetBuffer() && firstVertices->GetVertexDeclaration() == secondVertices->GetVertexDeclaration() &&
+			       firstVertices->GetStartOffset() % firstVertices->GetStride() == secondVertices->GetStartOffset() % secondVertices->GetStride();
+		}
+
 		unsigned int s_maxQuads = std::numeric_limits<UInt16>::max() / 6;
 		unsigned int s_vertexBufferSize = 4 * 1024 * 1024; // 4 MiB
 	}
@@ -52,10 +71,10 @@ namespace Nz
 
 		m_whiteTexture = Nz::TextureLibrary::Get("White2D");
 
-		m_vertexBuffer.Create(s_vertexBufferSize, DataStorage_Hardware, BufferUsage_Dynamic);
+		m_vertexBuffer.Create(s_vertexBufferSize);
 
-		m_billboardPointBuffer.Reset(&s_billboardVertexDeclaration, &m_vertexBuffer);
-		m_spriteBuffer.Reset(VertexDeclaration::Get(VertexLayout_XYZ_Color_UV), &m_vertexBuffer);
+		m_billboardPointBuffer.Reset(&s_billboardVertexDeclaration, m_vertexBuffer.GetBuffer());
+		m_spriteBuffer.Reset(VertexDeclaration::Get(VertexLayout_XYZ_Color_UV), m_vertexBuffer.GetBuffer());
 	}
 
 	/*!
@@ -408,21 +427,57 @@ namespace Nz
 		Recti fullscreenScissorRect = Recti(Vector2i(renderTarget->GetSize()));
 
 		const Material* lastMaterial = nullptr;
-		const MaterialPipeline* lastPipeline = nullptr;
 		const Shader* lastShader = nullptr;
 		const ShaderUniforms* shaderUniforms = nullptr;
 		Recti lastScissorRect = Recti(-1, -1);
 
 		const MaterialPipeline::Instance* pipelineInstance = nullptr;
 
-		///TODO: Reimplement instancing
+		bool instancingSupported = Renderer::HasCapability(RendererCap_Instancing);
+		bool multiDrawIndirectSupported = Renderer::HasCapability(RendererCap_MultiDrawIndirect);
+		Buffer* indirectBuffer = Renderer::GetIndirectBuffer();
+		VertexBuffer* instanceBuffer = Renderer::GetInstanceBuffer();
 
-		for (const BasicRenderQueue::Model& model : models)
+		auto modelIt = models.begin();
+		while (modelIt != models.end())
 		{
+			const BasicRenderQueue::Model& model = *modelIt;
+
+			// Models are sorted by material and buffers, following models sharing the same mesh and material are drawn as one batch
+			auto batchEnd = modelIt;
+			std::size_t batchSize = 0;
+			do
+			{
+				++batchEnd;
+				++batchSize;
+			}
+			while (batchEnd != models.end() && (*batchEnd).material == model.material && (*batchEnd).meshData.indexBuffer == model.meshData.indexBuffer &&
+			       (*batchEnd).meshData.vertexBuffer == model.meshData.vertexBuffer && (*batchEnd).meshData.primitiveMode == model.meshData.primitiveMode &&
+			       (*batchEnd).scissorRect == model.scissorRect && (*batchEnd).jointMatrices == model.jointMatrices);
+
+			// Following meshes sharing the material and the buffers of this one (see BufferAllocator) can be submitted in the same indirect draw call
+			auto indirectEnd = batchEnd;
+			bool indirect = false;
+			if (multiDrawIndirectSupported && !model.jointMatrices && model.meshData.indexBuffer)
+			{
+				while (indirectEnd != models.end() && (*indirectEnd).material == model.material && (*indirectEnd).scissorRect == model.scissorRect &&
+				       !(*indirectEnd).jointMatrices && IsIndirectCompatible(model.meshData, (*indirectEnd).meshData))
+					++indirectEnd;
+
+				// A mesh split in meshlets is drawn indirectly even alone, only its visible meshlets being submitted
+				indirect = (indirectEnd != batchEnd || model.meshData.meshletCount > 0);
+			}
+
+			// Skinned models each have their own joint matrices and cannot be instanced
+			bool instancing = indirect || (!model.jointMatrices && instancingSupported && batchSize >= NAZARA_GRAPHICS_INSTANCING_MIN_INSTANCES_COUNT);
+			UInt32 shaderFlags = (instancing) ? ShaderFlags_Deferred | ShaderFlags_Instancing : ShaderFlags_Deferred;
+			if (model.jointMatrices)
+				shaderFlags |= ShaderFlags_Skinning;
+
 			const MaterialPipeline* pipeline = model.material->GetPipeline();
-			if (lastPipeline != pipeline)
+			if (pipelineInstance != &pipeline->GetInstance(shaderFlags))
 			{
-				pipelineInstance = &model.material->GetPipeline()->Apply(ShaderFlags_Deferred);
+				pipelineInstance = &pipeline->Apply(shaderFlags);
 
 				const Shader* shader = pipelineInstance->uberInstance->GetShader();
 				if (shader != lastShader)
@@ -432,11 +487,11 @@ namespace Nz
 
 					// Ambient color of the scene
 					shader->SendColor(shaderUniforms->sceneAmbient, sceneData.ambientColor);
-
 					lastShader = shader;
 				}
 
-				lastPipeline = pipeline;
+				// Material parameters have to be sent to the new shader
+				lastMaterial = nullptr;
 			}
 
 			if (lastMaterial != model.material)
@@ -455,6 +510,9 @@ namespace Nz
 				}
 			}
 
+			if (model.jointMatrices)
+				lastShader->SendMatrixArray(shaderUniforms->skinningMatrices, model.jointMatrices, static_cast<unsigned int>(model.jointCount));
+
 			// Handle draw call before rendering loop
 			Renderer::DrawCall drawFunc;
 			Renderer::DrawCallInstanced instancedDrawFunc;
@@ -476,8 +534,136 @@ namespace Nz
 			Renderer::SetIndexBuffer(model.meshData.indexBuffer);
 			Renderer::SetVertexBuffer(model.meshData.vertexBuffer);
 
-			Renderer::SetMatrix(MatrixType_World, model.matrix);
-			drawFunc(model.meshData.primitiveMode, 0, indexCount);
+			if (indirect)
+			{
+				instanceBuffer->SetVertexDeclaration(VertexDeclaration::Get(VertexLayout_Matrix4));
+
+				std::size_t maxCommandPerDraw = indirectBuffer->GetSize() / sizeof(Renderer::DrawIndexedIndirectCommand);
+				std::size_t maxInstancePerDraw = instanceBuffer->GetVertexCount();
+
+				// Back faces are culled per meshlet from the eye position, which is meaningless for an orthographic projection
+				bool backFaceCulling = model.material->IsFaceCullingEnabled() && model.material->GetFaceCulling() == FaceSide_Back && sceneData.viewer->GetProjectionType() == ProjectionType_Perspective;
+				const Frustumf& frustum = sceneData.viewer->GetFrustum();
+				Vector3f eyePosition = sceneData.viewer->GetEyePosition();
+
+				// The visible meshlets of a model may not fit in a single draw call, the remaining ones are submitted by the next one
+				bool meshletsCulled = false;
+				std::size_t visibleMeshletCount = 0;
+				std::size_t visibleMeshletOffset = 0;
+
+				while (modelIt != indirectEnd)
+				{
+					// Stream one command per mesh (or range of visible meshlets), each one drawing its instances from the instance buffer
+					unsigned int commandCount = 0;
+					unsigned int instanceCount = 0;
+					{
+						BufferMapper<Buffer> indirectBufferMapper(indirectBuffer, BufferAccess_DiscardAndWrite);
+						BufferMapper<VertexBuffer> instanceBufferMapper(instanceBuffer, BufferAccess_DiscardAndWrite);
+						Renderer::DrawIndexedIndirectCommand* commands = static_cast<Renderer::DrawIndexedIndirectCommand*>(indirectBufferMapper.GetPointer());
+						Matrix4f* instanceMatrices = static_cast<Matrix4f*>(instanceBufferMapper.GetPointer());
+
+						while (modelIt != indirectEnd && commandCount < maxCommandPerDraw && instanceCount < maxInstancePerDraw)
+						{
+							const MeshData& meshData = (*modelIt).meshData;
+							Int32 baseVertex = static_cast<Int32>(meshData.vertexBuffer->GetStartOffset() / meshData.vertexBuffer->GetStride());
+							UInt32 firstIndex = meshData.indexBuffer->GetStartOffset() / meshData.indexBuffer->GetStride();
+
+							if (meshData.meshletCount > 0)
+							{
+								if (!meshletsCulled)
+								{
+									m_visibleMeshlets.resize(meshData.meshletCount);
+									visibleMeshletCount = CullMeshlets(meshData.meshlets, meshData.meshletCount, (*modelIt).matrix, frustum, eyePosition, backFaceCulling, m_visibleMeshlets.data());
+									visibleMeshletOffset = 0;
+									meshletsCulled = true;
+								}
+
+								if (visibleMeshletOffset < visibleMeshletCount)
+								{
+									UInt32 instance = instanceCount++;
+									instanceMatrices[instance] = (*modelIt).matrix;
+
+									// Meshlets following each other in the index buffer are drawn by the same command
+									unsigned int firstCommand = commandCount;
+									for (; visibleMeshletOffset < visibleMeshletCount; ++visibleMeshletOffset)
+									{
+										const Meshlet& meshlet = meshData.meshlets[m_visibleMeshlets[visibleMeshletOffset]];
+										if (commandCount > firstCommand)
+										{
+											Renderer::DrawIndexedIndirectCommand& lastCommand = commands[commandCount - 1];
+											if (lastCommand.firstIndex + lastCommand.indexCount == firstIndex + meshlet.firstIndex)
+											{
+												lastCommand.indexCount += meshlet.indexCount;
+												continue;
+											}
+										}
+
+										if (commandCount >= maxCommandPerDraw)
+											break;
+
+										Renderer::DrawIndexedIndirectCommand& command = commands[commandCount++];
+										command.baseInstance = instance;
+										command.baseVertex = baseVertex;
+										command.firstIndex = firstIndex + meshlet.firstIndex;
+										command.indexCount = meshlet.indexCount;
+										command.instanceCount = 1;
+									}
+								}
+
+								if (visibleMeshletOffset == visibleMeshletCount)
+								{
+									meshletsCulled = false;
+									++modelIt;
+								}
+
+								continue;
+							}
+
+							Renderer::DrawIndexedIndirectCommand& command = commands[commandCount++];
+							command.baseInstance = instanceCount;
+							command.baseVertex = baseVertex;
+							command.firstIndex = firstIndex;
+							command.indexCount = meshData.indexBuffer->GetIndexCount();
+
+							for (; modelIt != indirectEnd && instanceCount < maxInstancePerDraw && (*modelIt).meshData.indexBuffer == meshData.indexBuffer && (*modelIt).meshData.vertexBuffer == meshData.vertexBuffer && (*modelIt).meshData.meshletCount == 0; ++modelIt)
+								instanceMatrices[instanceCount++] = (*modelIt).matrix;
+
+							command.instanceCount = instanceCount - command.baseInstance;
+						}
+					}
+
+					if (commandCount > 0)
+						Renderer::DrawIndexedPrimitivesIndirect(model.meshData.primitiveMode, indirectBuffer, 0, commandCount);
+				}
+			}
+			else if (instancing)
+			{
+				instanceBuffer->SetVertexDeclaration(VertexDeclaration::Get(VertexLayout_Matrix4));
+
+				std::size_t maxInstancePerDraw = instanceBuffer->GetVertexCount();
+				while (modelIt != batchEnd)
+				{
+					// Stream the instance matrices
+					unsigned int instanceCount = 0;
+					{
+						BufferMapper<VertexBuffer> instanceBufferMapper(instanceBuffer, BufferAccess_DiscardAndWrite);
+						Matrix4f* instanceMatrices = static_cast<Matrix4f*>(instanceBufferMapper.GetPointer());
+
+						for (; modelIt != batchEnd && instanceCount < maxInstancePerDraw; ++modelIt)
+							instanceMatrices[instanceCount++] = (*modelIt).matrix;
+					}
+
+					instancedDrawFunc(instanceCount, model.meshData.primitiveMode, 0, indexCount);
+				}
+			}
+			else
+			{
+				for (; modelIt != batchEnd; ++modelIt)
+				{
+					Renderer::SetMatrix(MatrixType_World, (*modelIt).matrix);
+					drawFunc(model.meshData.primitiveMode, 0, indexCount);
+				}
+			}
 		}
 	}
 
@@ -491,7 +677,8 @@ namespace Nz
 		Renderer::SetVertexBuffer(&m_spriteBuffer);
 
 		const unsigned int overlayTextureUnit = Material::GetTextureUnit(TextureMap_Overlay);
-		const std::size_t maxSpriteCount = std::min<std::size_t>(s_maxQuads, m_spriteBuffer.GetVertexCount() / 4);
+		// One sprite less than a segment can hold, leaving room for the alignment of the vertices
+		const std::size_t maxSpriteCount = std::min<std::size_t>(s_maxQuads, m_vertexBuffer.GetSegmentSize() / (4 * sizeof(VertexStruct_XYZ_Color_UV)) - 1);
 
 		m_spriteChains.clear();
 
@@ -505,22 +692,32 @@ namespace Nz
 
 				do
 				{
-					// We open the buffer in writing mode
-					BufferMapper<VertexBuffer> vertexMapper(m_spriteBuffer, BufferAccess_DiscardAndWrite);
-					VertexStruct_XYZ_Color_UV* vertices = static_cast<VertexStruct_XYZ_Color_UV*>(vertexMapper.GetPointer());
-
+					// Count the sprites of this batch first, only the space they need is taken from the stream buffer
 					std::size_t spriteCount = 0;
+					for (std::size_t i = spriteChain, offset = spriteChainOffset; i < spriteChainCount && spriteCount < maxSpriteCount; ++i, offset = 0)
+						spriteCount += std::min(maxSpriteCount - spriteCount, m_spriteChains[i].second - offset);
+
+					// The vertices don't overwrite those of previous draw calls, so the buffer doesn't need to be orphaned
+					UInt32 bufferOffset;
+					VertexStruct_XYZ_Color_UV* vertices = static_cast<VertexStruct_XYZ_Color_UV*>(m_vertexBuffer.Map(static_cast<UInt32>(4 * spriteCount * sizeof(VertexStruct_XYZ_Color_UV)), sizeof(VertexStruct_XYZ_Color_UV), &bufferOffset));
+					if (!vertices)
+					{
+						NazaraError("Failed to map sprite vertices");
+						break;
+					}
+
+					std::size_t copiedCount = 0;
 
 					do
 					{
 						const VertexStruct_XYZ_Color_UV* currentChain = m_spriteChains[spriteChain].first;
 						std::size_t currentChainSpriteCount = m_spriteChains[spriteChain].second;
-						std::size_t count = std::min(maxSpriteCount - spriteCount, currentChainSpriteCount - spriteChainOffset);
+						std::size_t count = std::min(spriteCount - copiedCount, currentChainSpriteCount - spriteChainOffset);
 
 						std::memcpy(vertices, currentChain + spriteChainOffset * 4, 4 * count * sizeof(VertexStruct_XYZ_Color_UV));
 						vertices += count * 4;
 
-						spriteCount += count;
+						copiedCount += count;
 						spriteChainOffset += count;
 
 						// Have we treated the entire chain ?
@@ -530,11 +727,11 @@ namespace Nz
 							spriteChainOffset = 0;
 						}
 					}
-					while (spriteCount < maxSpriteCount && spriteChain < spriteChainCount);
+					while (copiedCount < spriteCount);
 
-					vertexMapper.Unmap();
+					m_vertexBuffer.Unmap();
 
-					Renderer::DrawIndexedPrimitives(PrimitiveMode_TriangleList, 0, spriteCount * 6);
+					Renderer::DrawIndexedPrimitives(PrimitiveMode_TriangleList, 0, static_cast<unsigned int>(spriteCount * 6), bufferOffset / sizeof(VertexStruct_XYZ_Color_UV));
 				}
 				while (spriteChain < spriteChainCount);
 			}
@@ -627,8 +824,9 @@ namespace Nz
 			uniforms.shaderReleaseSlot.Connect(shader->OnShaderRelease, this, &DepthRenderTechnique::OnShaderInvalidated);
 			uniforms.shaderUniformInvalidatedSlot.Connect(shader->OnShaderUniformInvalidated, this, &DepthRenderTechnique::OnShaderInvalidated);
 
-			uniforms.sceneAmbient   = shader->GetUniformLocation("SceneAmbient");
-			uniforms.textureOverlay = shader->GetUniformLocation("TextureOverlay");
+			uniforms.sceneAmbient     = shader->GetUniformLocation("SceneAmbient");
+			uniforms.skinningMatrices = shader->GetUniformLocation("SkinningMatrices");
+			uniforms.textureOverlay   = shader->GetUniformLocation("TextureOverlay");
 
 			it = m_shaderUniforms.emplace(shader, std::move(uniforms)).first;
 		}
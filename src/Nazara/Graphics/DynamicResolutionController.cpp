@@ -0,0 +1,132 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Graphics/DynamicResolutionController.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Math/Algorithm.hpp>
+#include <algorithm>
+#include <cmath>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		constexpr double Headroom = 0.9;           //< Fraction of the budget aimed at, so small variations don't go over it
+		constexpr double SmoothingFactor = 0.2;    //< Weight of the last frame in the average GPU time
+		constexpr unsigned int IncreaseDelay = 30; //< Frames spent well under the budget before increasing the scale
+		constexpr unsigned int SettleFrames = 4;   //< Frames ignored after a change, the timings of the frames already submitted being delayed
+	}
+
+	/*!
+	* \ingroup graphics
+	* \class Nz::DynamicResolutionController
+	* \brief Graphics class choosing the resolution scale of the scene to keep the GPU time of the frames within a budget
+	*
+	* The GPU time of the frames (as measured by a GpuProfiler) is averaged and compared to the budget, the cost of a frame being assumed proportional to its pixel count.
+	* Going over the budget lowers the scale right away, while the scale is only raised after a while under the budget to avoid oscillating.
+	* The scale changes by steps of ScaleStep, as every change reallocates the targets of the scene (see DeferredRenderTechnique::SetResolutionScale).
+	*/
+
+	/*!
+	* \brief Constructs a DynamicResolutionController object
+	*
+	* \param gpuBudget GPU time the frames should fit in, in nanoseconds
+	* \param minScale Lowest scale the controller may choose
+	* \param maxScale Highest scale the controller may choose, which is the starting scale
+	*/
+	DynamicResolutionController::DynamicResolutionController(UInt64 gpuBudget, float minScale, float maxScale) :
+	m_budget(gpuBudget)
+	{
+		SetScaleRange(minScale, maxScale);
+	}
+
+	/*!
+	* \brief Resets the scale to its maximum and forgets the previous timings
+	*/
+	void DynamicResolutionController::Reset()
+	{
+		m_averageTime = 0.0;
+		m_scale = m_maxScale;
+		m_ignoredFrames = 0;
+		m_underBudgetFrames = 0;
+	}
+
+	/*!
+	* \brief Sets the range of scales the controller may choose from
+	*
+	* \param minScale Lowest scale
+	* \param maxScale Highest scale
+	*
+	* \remark This resets the controller
+	*/
+	void DynamicResolutionController::SetScaleRange(float minScale, float maxScale)
+	{
+		NazaraAssert(minScale > 0.f && minScale <= maxScale, "Invalid scale range");
+
+		m_minScale = minScale;
+		m_maxScale = maxScale;
+
+		Reset();
+	}
+
+	/*!
+	* \brief Updates the scale according to the GPU time of a frame
+	* \return true if the scale changed
+	*
+	* \param gpuTime GPU time of the last frame whose timings are known, in nanoseconds
+	*/
+	bool DynamicResolutionController::Update(UInt64 gpuTime)
+	{
+		if (m_ignoredFrames > 0)
+		{
+			m_ignoredFrames--;
+			return false;
+		}
+
+		if (m_averageTime <= 0.0)
+			m_averageTime = static_cast<double>(gpuTime);
+		else
+			m_averageTime += (static_cast<double>(gpuTime) - m_averageTime) * SmoothingFactor;
+
+		if (m_budget == 0 || m_averageTime <= 0.0)
+			return false;
+
+		double load = m_averageTime / m_budget;
+
+		double targetScale = m_scale;
+		if (load > 1.0)
+		{
+			m_underBudgetFrames = 0;
+
+			// The pixel count, and thus the cost, goes with the square of the scale
+			targetScale = m_scale * std::sqrt(Headroom / load);
+		}
+		else if (load < Headroom * Headroom && m_scale < m_maxScale)
+		{
+			if (++m_underBudgetFrames < IncreaseDelay)
+				return false;
+
+			m_underBudgetFrames = 0;
+			targetScale = m_scale * std::sqrt(Headroom / load);
+		}
+		else
+			m_underBudgetFrames = 0;
+
+		// Rounded down: the budget is met when lowering the scale, and not overshot when raising it
+		float newScale = static_cast<float>(std::floor(targetScale / ScaleStep + 0.001) * ScaleStep);
+
+		newScale = Clamp(newScale, m_minScale, m_maxScale);
+		if (std::abs(newScale - m_scale) < ScaleStep * 0.5f)
+			return false;
+
+		m_scale = newScale;
+
+		// The timings of the next frames were measured with the previous scale
+		m_averageTime = 0.0;
+		m_ignoredFrames = SettleFrames;
+
+		return true;
+	}
+}
@@ -5,17 +5,22 @@
 #include <Nazara/Graphics/ForwardRenderTechnique.hpp>
 #include <Nazara/Core/ErrorFlags.hpp>
 #include <Nazara/Core/OffsetOf.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Graphics/AbstractBackground.hpp>
 #include <Nazara/Graphics/AbstractViewer.hpp>
 #include <Nazara/Graphics/Drawable.hpp>
 #include <Nazara/Graphics/Light.hpp>
 #include <Nazara/Graphics/Material.hpp>
 #include <Nazara/Graphics/SceneData.hpp>
+#include <Nazara/Math/Algorithm.hpp>
 #include <Nazara/Renderer/Config.hpp>
+#include <Nazara/Renderer/GpuProfiler.hpp>
 #include <Nazara/Renderer/Renderer.hpp>
 #include <Nazara/Renderer/RenderTarget.hpp>
 #include <Nazara/Utility/BufferMapper.hpp>
+#include <Nazara/Utility/VertexDeclaration.hpp>
 #include <Nazara/Utility/VertexStruct.hpp>
+#include <cmath>
 #include <limits>
 #include <Nazara/Graphics/Debug.hpp>
 
@@ -23,6 +28,10 @@ namespace Nz
 {
 	namespace
 	{
+		const UInt8 r_fragmentSource_OITComposite[] = {
+			#include <Nazara/Graphics/Resources/Shaders/OrderIndependentTransparency/composite.frag.h>
+		};
+
 		struct BillboardPoint
 		{
 			Color color;
@@ -32,14 +41,32 @@ namespace Nz
 			Vector2f uv;
 		};
 
+		// Sprite vertex used with texture array overlays, the layer being sent as the Userdata0 component
+		struct LayeredSpriteVertex : VertexStruct_XYZ_Color_UV
+		{
+			float overlayLayer;
+		};
+
+		Vector3ui s_lightClusterCount(16, 9, 24);
 		UInt32 s_maxQuads = std::numeric_limits<UInt16>::max() / 6;
 		UInt32 s_vertexBufferSize = 4 * 1024 * 1024; // 4 MiB
+
+		inline Vector4f ColorToVector(const Color& color)
+		{
+			return Vector4f(color.r / 255.f, color.g / 255.f, color.b / 255.f, color.a / 255.f);
+		}
 	}
 
 	/*!
 	* \ingroup graphics
 	* \class Nz::ForwardRenderTechnique
 	* \brief Graphics class that represents the technique used in forward rendering
+	*
+	* By default, models are drawn once per group of NAZARA_GRAPHICS_MAX_LIGHT_PER_PASS lights reaching them.
+	* With clustered lighting, the lights are binned once per frame into a grid dividing the view frustum, and each model is drawn in a single pass using the lights of the clusters its fragments are in.
+	*
+	* Objects whose material uses order-independent transparency are not sorted: once the opaque objects are drawn, they are summed in floating-point targets
+	* sharing the depth of the target, with weights decreasing with their depth, and the weighted average is composited over the target.
 	*/
 
 	/*!
@@ -48,17 +75,25 @@ namespace Nz
 
 	ForwardRenderTechnique::ForwardRenderTechnique() :
 	m_vertexBuffer(BufferType_Vertex),
-	m_maxLightPassPerObject(3)
+	m_lightBuffer(BufferType_Uniform),
+	m_oitTargetSize(0U),
+	m_maxLightPassPerObject(3),
+	m_clusteredLighting(false)
 	{
+		static_assert(sizeof(LightBlockData) == 80, "LightBlockData must match the std140 layout of the Light struct");
+
 		ErrorFlags flags(ErrorFlag_ThrowException, true);
 
 		m_whiteCubemap = Nz::TextureLibrary::Get("WhiteCubemap");
 		m_whiteTexture = Nz::TextureLibrary::Get("White2D");
 
-		m_vertexBuffer.Create(s_vertexBufferSize, DataStorage_Hardware, BufferUsage_Dynamic);
+		m_vertexBuffer.Create(s_vertexBufferSize);
+		m_lightBuffer.Create(NAZARA_GRAPHICS_MAX_LIGHTS_PER_SCENE * UInt32(sizeof(LightBlockData)), DataStorage_Hardware, BufferUsage_Dynamic);
+		m_lightBlockData.reserve(NAZARA_GRAPHICS_MAX_LIGHTS_PER_SCENE);
 
-		m_billboardPointBuffer.Reset(&s_billboardVertexDeclaration, &m_vertexBuffer);
-		m_spriteBuffer.Reset(VertexDeclaration::Get(VertexLayout_XYZ_Color_UV), &m_vertexBuffer);
+		m_billboardPointBuffer.Reset(&s_billboardVertexDeclaration, m_vertexBuffer.GetBuffer());
+		m_layeredSpriteBuffer.Reset(&s_layeredSpriteVertexDeclaration, m_vertexBuffer.GetBuffer());
+		m_spriteBuffer.Reset(VertexDeclaration::Get(VertexLayout_XYZ_Color_UV), m_vertexBuffer.GetBuffer());
 	}
 
 	/*!
@@ -95,8 +130,15 @@ namespace Nz
 	{
 		NazaraAssert(sceneData.viewer, "Invalid viewer");
 
+		GpuProfiler::Scope profilerScope("ForwardRenderTechnique");
+
 		m_renderQueue.Sort(sceneData.viewer);
 
+		UploadLights();
+
+		if (m_clusteredLighting)
+			UpdateLightClusters(sceneData);
+
 		if (!m_renderQueue.models.empty())
 			DrawModels(sceneData, m_renderQueue, m_renderQueue.models);
 
@@ -106,6 +148,9 @@ namespace Nz
 		if (!m_renderQueue.billboards.empty())
 			DrawBillboards(sceneData, m_renderQueue, m_renderQueue.billboards);
 
+		if (!m_renderQueue.orderIndependentModels.empty() || !m_renderQueue.orderIndependentSprites.empty() || !m_renderQueue.orderIndependentBillboards.empty())
+			DrawOrderIndependentTransparency(sceneData);
+
 		if (!m_renderQueue.depthSortedModels.empty())
 			DrawModels(sceneData, m_renderQueue, m_renderQueue.depthSortedModels);
 
@@ -121,6 +166,19 @@ namespace Nz
 		return true;
 	}
 
+	/*!
+	* \brief Enables or disables clustered lighting
+	*
+	* \param clusteredLighting Should the models be lit in a single pass by the lights of their clusters
+	*
+	* \remark Shadows are not rendered with clustered lighting, which ignores the shadow maps of the lights
+	*/
+
+	void ForwardRenderTechnique::EnableClusteredLighting(bool clusteredLighting)
+	{
+		m_clusteredLighting = clusteredLighting;
+	}
+
 	/*!
 	* \brief Gets the maximum number of lights available per pass per object
 	* \return Maximum number of light simultaneously per object
@@ -151,6 +209,16 @@ namespace Nz
 		return RenderTechniqueType_BasicForward;
 	}
 
+	/*!
+	* \brief Checks whether clustered lighting is enabled
+	* \return true If it is the case
+	*/
+
+	bool ForwardRenderTechnique::IsClusteredLightingEnabled() const
+	{
+		return m_clusteredLighting;
+	}
+
 	/*!
 	* \brief Sets the maximum number of lights available per pass per object
 	*
@@ -218,11 +286,56 @@ namespace Nz
 			s_billboardInstanceDeclaration.EnableComponent(VertexComponent_InstanceData1, ComponentType_Float4, NazaraOffsetOf(BasicRenderQueue::BillboardData, size)); // Englobe sincos
 			s_billboardInstanceDeclaration.EnableComponent(VertexComponent_InstanceData2, ComponentType_Color,  NazaraOffsetOf(BasicRenderQueue::BillboardData, color));
 
+			// Declaration used when rendering sprites whose overlay is a texture array, a batch may then span every layer of the array
+			s_layeredSpriteVertexDeclaration.EnableComponent(VertexComponent_Color,     ComponentType_Color,  NazaraOffsetOf(LayeredSpriteVertex, color));
+			s_layeredSpriteVertexDeclaration.EnableComponent(VertexComponent_Position,  ComponentType_Float3, NazaraOffsetOf(LayeredSpriteVertex, position));
+			s_layeredSpriteVertexDeclaration.EnableComponent(VertexComponent_TexCoord,  ComponentType_Float2, NazaraOffsetOf(LayeredSpriteVertex, uv));
+			s_layeredSpriteVertexDeclaration.EnableComponent(VertexComponent_Userdata0, ComponentType_Float1, NazaraOffsetOf(LayeredSpriteVertex, overlayLayer));
+
+			// Declaration used when rendering sprites with instancing, the quad is expanded from a single record by the vertex shader
+			s_spriteInstanceDeclaration.EnableComponent(VertexComponent_InstanceData0, ComponentType_Float3, NazaraOffsetOf(AbstractRenderQueue::SpriteInstance, origin));
+			s_spriteInstanceDeclaration.EnableComponent(VertexComponent_InstanceData1, ComponentType_Float3, NazaraOffsetOf(AbstractRenderQueue::SpriteInstance, right));
+			s_spriteInstanceDeclaration.EnableComponent(VertexComponent_InstanceData2, ComponentType_Float3, NazaraOffsetOf(AbstractRenderQueue::SpriteInstance, down));
+			s_spriteInstanceDeclaration.EnableComponent(VertexComponent_InstanceData3, ComponentType_Float4, NazaraOffsetOf(AbstractRenderQueue::SpriteInstance, textureCoords));
+			s_spriteInstanceDeclaration.EnableComponent(VertexComponent_InstanceData4, ComponentType_Color,  NazaraOffsetOf(AbstractRenderQueue::SpriteInstance, color));
+
+			// Clusters are read with texelFetch, integer textures can't be filtered
+			s_lightClusterSampler.SetFilterMode(SamplerFilter_Nearest);
+			s_lightClusterSampler.SetWrapMode(SamplerWrap_Clamp);
+
 			s_reflectionSampler.SetFilterMode(SamplerFilter_Bilinear);
 			s_reflectionSampler.SetWrapMode(SamplerWrap_Clamp);
 
 			s_shadowSampler.SetFilterMode(SamplerFilter_Bilinear);
 			s_shadowSampler.SetWrapMode(SamplerWrap_Clamp);
+
+			// Composition of the order-independent transparency, drawn over a fullscreen quad
+			const char vertexSource_PostProcess[] =
+			"#version 140\n"
+
+			"in vec3 VertexPosition;\n"
+
+			"void main()\n"
+			"{\n"
+				"gl_Position = vec4(VertexPosition, 1.0);"
+			"}\n";
+
+			ShaderRef compositeShader = Shader::New();
+			compositeShader->Create();
+			compositeShader->AttachStageFromSource(ShaderStageType_Vertex, vertexSource_PostProcess, sizeof(vertexSource_PostProcess));
+			compositeShader->AttachStageFromSource(ShaderStageType_Fragment, reinterpret_cast<const char*>(r_fragmentSource_OITComposite), sizeof(r_fragmentSource_OITComposite));
+			compositeShader->Link();
+
+			compositeShader->SendInteger(compositeShader->GetUniformLocation("AccumulationTexture"), 0);
+			compositeShader->SendInteger(compositeShader->GetUniformLocation("RevealageTexture"), 1);
+
+			s_oitCompositeShader = std::move(compositeShader);
+
+			// Target color = average color * (1 - revealage) + target color * revealage
+			s_oitCompositeStates.blending = true;
+			s_oitCompositeStates.depthBuffer = false;
+			s_oitCompositeStates.dstBlend = BlendFunc_SrcAlpha;
+			s_oitCompositeStates.srcBlend = BlendFunc_InvSrcAlpha;
 		}
 		catch (const std::exception& e)
 		{
@@ -239,6 +352,7 @@ namespace Nz
 
 	void ForwardRenderTechnique::Uninitialize()
 	{
+		s_oitCompositeShader.Reset();
 		s_quadIndexBuffer.Reset();
 		s_quadVertexBuffer.Reset();
 	}
@@ -288,6 +402,33 @@ namespace Nz
 		});
 	}
 
+	/*!
+	* \brief Chooses the reflection probe of one object
+	* \return Cubemap of the closest probe reaching the center of the object, defaultCubemap if there is none
+	*
+	* \param object Sphere symbolizing the object
+	* \param defaultCubemap Cubemap reflected by the objects out of every probe
+	*/
+
+	const Texture* ForwardRenderTechnique::ChooseReflectionProbe(const Spheref& object, const Texture* defaultCubemap) const
+	{
+		const Texture* cubemap = defaultCubemap;
+
+		Vector3f center = object.GetPosition();
+		float bestDistance = std::numeric_limits<float>::infinity();
+		for (const AbstractRenderQueue::ReflectionProbe& probe : m_renderQueue.reflectionProbes)
+		{
+			float squaredDistance = center.SquaredDistance(probe.position);
+			if (squaredDistance <= probe.radius * probe.radius && squaredDistance < bestDistance)
+			{
+				bestDistance = squaredDistance;
+				cubemap = probe.cubemap;
+			}
+		}
+
+		return cubemap;
+	}
+
 	void ForwardRenderTechnique::DrawBillboards(const SceneData& sceneData, const BasicRenderQueue& renderQueue, const RenderQueue<BasicRenderQueue::Billboard>& billboards) const
 	{
 		VertexBuffer* instanceBuffer = Renderer::GetInstanceBuffer();
@@ -490,21 +631,60 @@ namespace Nz
 		Recti fullscreenScissorRect = Recti(Vector2i(renderTarget->GetSize()));
 
 		const Material* lastMaterial = nullptr;
-		const MaterialPipeline* lastPipeline = nullptr;
 		const Shader* lastShader = nullptr;
 		const ShaderUniforms* shaderUniforms = nullptr;
 		Recti lastScissorRect = Recti(-1, -1);
 
 		const MaterialPipeline::Instance* pipelineInstance = nullptr;
 
-		///TODO: Reimplement instancing
+		bool instancingSupported = Renderer::HasCapability(RendererCap_Instancing);
+		VertexBuffer* instanceBuffer = Renderer::GetInstanceBuffer();
 
-		for (const BasicRenderQueue::Model& model : models)
+		if (m_clusteredLighting)
 		{
+			unsigned int textureUnit = Material::GetTextureUnit(TextureMap_LightClusters);
+
+			Renderer::SetTexture(textureUnit, m_lightClusterTexture);
+			Renderer::SetTextureSampler(textureUnit, s_lightClusterSampler);
+
+			// Without light passes, the draws of the models are recorded in parallel then executed in order
+			std::size_t commandBufferCount = RecordModels(sceneData, models);
+			for (std::size_t i = 0; i < commandBufferCount; ++i)
+				Renderer::Execute(m_commandBuffers[i]);
+
+			return;
+		}
+
+		auto modelIt = models.begin();
+		while (modelIt != models.end())
+		{
+			const BasicRenderQueue::Model& model = *modelIt;
+
+			// Models are sorted by material and buffers, following models sharing the same mesh and material are drawn as one batch
+			auto batchEnd = modelIt;
+			std::size_t batchSize = 0;
+			do
+			{
+				++batchEnd;
+				++batchSize;
+			}
+			while (batchEnd != models.end() && (*batchEnd).material == model.material && (*batchEnd).meshData.indexBuffer == model.meshData.indexBuffer &&
+			       (*batchEnd).meshData.vertexBuffer == model.meshData.vertexBuffer && (*batchEnd).meshData.primitiveMode == model.meshData.primitiveMode &&
+			       (*batchEnd).scissorRect == model.scissorRect && (*batchEnd).jointMatrices == model.jointMatrices);
+
+			// Skinned models each have their own joint matrices and cannot be instanced
+			bool instancing = !model.jointMatrices && instancingSupported && batchSize >= NAZARA_GRAPHICS_INSTANCING_MIN_INSTANCES_COUNT;
+			UInt32 shaderFlags = (instancing) ? ShaderFlags_Instancing : ShaderFlags_None;
+			if (model.jointMatrices)
+				shaderFlags |= ShaderFlags_Skinning;
+
+			if (m_clusteredLighting)
+				shaderFlags |= ShaderFlags_ClusteredLighting;
+
 			const MaterialPipeline* pipeline = model.material->GetPipeline();
-			if (lastPipeline != pipeline)
+			if (pipelineInstance != &pipeline->GetInstance(shaderFlags))
 			{
-				pipelineInstance = &model.material->GetPipeline()->Apply();
+				pipelineInstance = &pipeline->Apply(shaderFlags);
 
 				const Shader* shader = pipelineInstance->uberInstance->GetShader();
 				if (shader != lastShader)
@@ -517,10 +697,18 @@ namespace Nz
 					// Position of the camera
 					shader->SendVector(shaderUniforms->eyePosition, sceneData.viewer->GetEyePosition());
 
+					// Mapping of the fragments to the light clusters of this frame
+					if (shaderUniforms->lightClusterParameters != -1)
+					{
+						shader->SendVector(shaderUniforms->lightClusterOffset, m_lightClusterOffset);
+						shader->SendVector(shaderUniforms->lightClusterParameters, m_lightClusterParameters);
+					}
+
 					lastShader = shader;
 				}
 
-				lastPipeline = pipeline;
+				// Material parameters have to be sent to the new shader
+				lastMaterial = nullptr;
 			}
 
 			if (lastMaterial != model.material)
@@ -539,13 +727,19 @@ namespace Nz
 				}
 			}
 
-			if (shaderUniforms->reflectionMap != -1)
+			// Reflective models reflect the closest probe they are in, chosen once for the batch if it's instanced
+			unsigned int reflectionUnit = Material::GetTextureUnit(TextureMap_ReflectionCube);
+			auto BindReflection = [&](const Spheref& sphere)
 			{
-				unsigned int textureUnit = Material::GetTextureUnit(TextureMap_ReflectionCube);
+				if (shaderUniforms->reflectionMap == -1)
+					return;
 
-				Renderer::SetTexture(textureUnit, sceneData.globalReflectionTexture);
-				Renderer::SetTextureSampler(textureUnit, s_reflectionSampler);
-			}
+				Renderer::SetTexture(reflectionUnit, ChooseReflectionProbe(sphere, sceneData.globalReflectionTexture));
+				Renderer::SetTextureSampler(reflectionUnit, s_reflectionSampler);
+			};
+
+			if (model.jointMatrices)
+				lastShader->SendMatrixArray(shaderUniforms->skinningMatrices, model.jointMatrices, static_cast<unsigned int>(model.jointCount));
 
 			// Handle draw call before rendering loop
 			Renderer::DrawCall drawFunc;
@@ -568,13 +762,19 @@ namespace Nz
 			Renderer::SetIndexBuffer(model.meshData.indexBuffer);
 			Renderer::SetVertexBuffer(model.meshData.vertexBuffer);
 
-			if (shaderUniforms->hasLightUniforms)
+			// Draws once per group of lights able to reach the model(s) inside the sphere
+			auto DrawLit = [&](const Spheref& sphere, auto&& draw)
 			{
-				ChooseLights(model.obbSphere);
+				// Clustered shaders find their lights by themselves, in a single pass
+				if (!shaderUniforms->hasLightUniforms || shaderUniforms->lightClusterParameters != -1)
+				{
+					draw();
+					return;
+				}
 
-				std::size_t lightCount = m_lights.size();
+				ChooseLights(sphere);
 
-				Nz::Renderer::SetMatrix(Nz::MatrixType_World, model.matrix);
+				std::size_t lightCount = m_lights.size();
 				std::size_t lightIndex = 0;
 				RendererComparison oldDepthFunc = Renderer::GetDepthFunc(); // In the case where we have to change it
 
@@ -599,20 +799,128 @@ namespace Nz
 						SendLightUniforms(lastShader, shaderUniforms->lightUniforms, i, lightIndex++, shaderUniforms->lightOffset*i);
 
 					// And we draw
-					drawFunc(model.meshData.primitiveMode, 0, indexCount);
+					draw();
 				}
 
 				Renderer::Enable(RendererParameter_Blend, false);
 				Renderer::SetDepthFunc(oldDepthFunc);
+			};
+
+			if (instancing)
+			{
+				instanceBuffer->SetVertexDeclaration(VertexDeclaration::Get(VertexLayout_Matrix4));
+
+				// Lights are chosen once for the whole batch, every light able to reach one of the instances is rendered
+				Spheref batchSphere;
+				if ((shaderUniforms->hasLightUniforms && shaderUniforms->lightClusterParameters == -1) || shaderUniforms->reflectionMap != -1)
+				{
+					Boxf batchBox(model.obbSphere.GetPosition() - Vector3f(model.obbSphere.radius), model.obbSphere.GetPosition() + Vector3f(model.obbSphere.radius));
+					for (auto it = modelIt; it != batchEnd; ++it)
+					{
+						const Spheref& instanceSphere = (*it).obbSphere;
+						batchBox.ExtendTo(Boxf(instanceSphere.GetPosition() - Vector3f(instanceSphere.radius), instanceSphere.GetPosition() + Vector3f(instanceSphere.radius)));
+					}
+
+					batchSphere = batchBox.GetBoundingSphere();
+				}
+
+				BindReflection(batchSphere);
+
+				std::size_t maxInstancePerDraw = instanceBuffer->GetVertexCount();
+				while (modelIt != batchEnd)
+				{
+					// Stream the instance matrices
+					unsigned int instanceCount = 0;
+					{
+						BufferMapper<VertexBuffer> instanceBufferMapper(instanceBuffer, BufferAccess_DiscardAndWrite);
+						Matrix4f* instanceMatrices = static_cast<Matrix4f*>(instanceBufferMapper.GetPointer());
+
+						for (; modelIt != batchEnd && instanceCount < maxInstancePerDraw; ++modelIt)
+							instanceMatrices[instanceCount++] = (*modelIt).matrix;
+					}
+
+					DrawLit(batchSphere, [&]()
+					{
+						instancedDrawFunc(instanceCount, model.meshData.primitiveMode, 0, indexCount);
+					});
+				}
 			}
 			else
 			{
-				Renderer::SetMatrix(MatrixType_World, model.matrix);
-				drawFunc(model.meshData.primitiveMode, 0, indexCount);
+				for (; modelIt != batchEnd; ++modelIt)
+				{
+					const BasicRenderQueue::Model& batchModel = *modelIt;
+
+					Renderer::SetMatrix(MatrixType_World, batchModel.matrix);
+					BindReflection(batchModel.obbSphere);
+					DrawLit(batchModel.obbSphere, [&]()
+					{
+						drawFunc(batchModel.meshData.primitiveMode, 0, indexCount);
+					});
+				}
 			}
 		}
 	}
 
+	/*!
+	* \brief Draws the objects using order-independent transparency, then composites them over the target
+	*
+	* \param sceneData Data of the scene
+	*
+	* \remark The depth buffer of the target is copied, its format must be Depth24Stencil8 (which is the default one of windows)
+	*/
+
+	void ForwardRenderTechnique::DrawOrderIndependentTransparency(const SceneData& sceneData) const
+	{
+		const RenderTarget* renderTarget = sceneData.viewer->GetTarget();
+		Vector2ui targetSize = renderTarget->GetSize();
+
+		if (m_oitTargetSize != targetSize)
+		{
+			ErrorFlags errFlags(ErrorFlag_ThrowException, true);
+
+			// Colors and weights are summed, the revealage being stored as the sum of -log(1 - alpha) so both targets can use additive blending
+			m_oitAccumulationTexture = Texture::New(ImageType_2D, PixelFormatType_RGBA16F, targetSize.x, targetSize.y);
+			m_oitRevealageTexture = Texture::New(ImageType_2D, PixelFormatType_R16F, targetSize.x, targetSize.y);
+
+			m_oitTarget.Create(true);
+			m_oitTarget.AttachTexture(AttachmentPoint_Color, 0, m_oitAccumulationTexture);
+			m_oitTarget.AttachTexture(AttachmentPoint_Color, 1, m_oitRevealageTexture);
+			m_oitTarget.AttachBuffer(AttachmentPoint_DepthStencil, 0, PixelFormatType_Depth24Stencil8, targetSize.x, targetSize.y);
+			m_oitTarget.Unlock();
+
+			m_oitTarget.SetColorTargets({0, 1});
+
+			m_oitTargetSize = targetSize;
+		}
+
+		// Transparent surfaces must be hidden by the opaque ones, without writing the depth
+		Rectui fullscreenRect(0, 0, targetSize.x, targetSize.y);
+		RenderTexture::BlitFromActiveTarget(fullscreenRect, &m_oitTarget, fullscreenRect, RendererBuffer_Depth);
+
+		Renderer::SetTarget(&m_oitTarget);
+		Renderer::SetScissorRect(Recti(Vector2i(targetSize)));
+		Renderer::SetClearColor(0, 0, 0, 0);
+		Renderer::Clear(RendererBuffer_Color);
+
+		if (!m_renderQueue.orderIndependentModels.empty())
+			DrawModels(sceneData, m_renderQueue, m_renderQueue.orderIndependentModels);
+
+		if (!m_renderQueue.orderIndependentSprites.empty())
+			DrawSprites(sceneData, m_renderQueue, m_renderQueue.orderIndependentSprites);
+
+		if (!m_renderQueue.orderIndependentBillboards.empty())
+			DrawBillboards(sceneData, m_renderQueue, m_renderQueue.orderIndependentBillboards);
+
+		Renderer::SetTarget(renderTarget);
+
+		Renderer::SetRenderStates(s_oitCompositeStates);
+		Renderer::SetShader(s_oitCompositeShader);
+		Renderer::SetTexture(0, m_oitAccumulationTexture);
+		Renderer::SetTexture(1, m_oitRevealageTexture);
+		Renderer::DrawFullscreenQuad();
+	}
+
 	void ForwardRenderTechnique::DrawSprites(const SceneData& sceneData, const BasicRenderQueue& renderQueue, const RenderQueue<BasicRenderQueue::SpriteChain>& spriteList) const
 	{
 		const RenderTarget* renderTarget = sceneData.viewer->GetTarget();
@@ -620,53 +928,125 @@ namespace Nz
 
 		Renderer::SetIndexBuffer(&s_quadIndexBuffer);
 		Renderer::SetMatrix(MatrixType_World, Matrix4f::Identity());
-		Renderer::SetVertexBuffer(&m_spriteBuffer);
 
 		const unsigned int overlayTextureUnit = Material::GetTextureUnit(TextureMap_Overlay);
-		const std::size_t maxSpriteCount = std::min<std::size_t>(s_maxQuads, m_spriteBuffer.GetVertexCount() / 4);
+		const bool instancingSupported = Renderer::HasCapability(RendererCap_Instancing);
+
+		bool instancedSprites = false;
+		bool layeredOverlay = false;
 
 		m_spriteChains.clear();
 
 		auto Commit = [&]()
 		{
 			std::size_t spriteChainCount = m_spriteChains.size();
-			if (spriteChainCount > 0)
+			if (spriteChainCount > 0 && instancedSprites)
+			{
+				// One record per sprite instead of four vertices, the quad is expanded by the vertex shader
+				VertexBuffer* instanceBuffer = Renderer::GetInstanceBuffer();
+				instanceBuffer->SetVertexDeclaration(&s_spriteInstanceDeclaration);
+
+				Renderer::SetVertexBuffer(&s_quadVertexBuffer);
+
+				BufferMapper<VertexBuffer> instanceBufferMapper;
+				std::size_t maxSpritePerDraw = instanceBuffer->GetVertexCount();
+				std::size_t spriteCount = 0;
+
+				for (const SpriteChainView& chain : m_spriteChains)
+				{
+					std::size_t chainOffset = 0;
+					while (chainOffset < chain.spriteCount)
+					{
+						if (!instanceBufferMapper.GetBuffer())
+							instanceBufferMapper.Map(instanceBuffer, BufferAccess_DiscardAndWrite);
+
+						std::size_t count = std::min(maxSpritePerDraw - spriteCount, chain.spriteCount - chainOffset);
+						std::memcpy(static_cast<UInt8*>(instanceBufferMapper.GetPointer()) + spriteCount * sizeof(AbstractRenderQueue::SpriteInstance), chain.instances + chainOffset, count * sizeof(AbstractRenderQueue::SpriteInstance));
+
+						chainOffset += count;
+						spriteCount += count;
+
+						if (spriteCount >= maxSpritePerDraw)
+						{
+							instanceBufferMapper.Unmap();
+							Renderer::DrawPrimitivesInstanced(static_cast<unsigned int>(spriteCount), PrimitiveMode_TriangleStrip, 0, 4);
+
+							spriteCount = 0;
+						}
+					}
+				}
+
+				if (spriteCount > 0)
+				{
+					instanceBufferMapper.Unmap();
+					Renderer::DrawPrimitivesInstanced(static_cast<unsigned int>(spriteCount), PrimitiveMode_TriangleStrip, 0, 4);
+				}
+			}
+			else if (spriteChainCount > 0)
 			{
+				// Texture array overlays need the layer of every vertex, which isn't part of the vertices of the queue
+				const std::size_t vertexSize = (layeredOverlay) ? sizeof(LayeredSpriteVertex) : sizeof(VertexStruct_XYZ_Color_UV);
+				Renderer::SetVertexBuffer((layeredOverlay) ? &m_layeredSpriteBuffer : &m_spriteBuffer);
+
+				// One sprite less than a segment can hold, leaving room for the alignment of the vertices
+				const std::size_t maxSpriteCount = std::min<std::size_t>(s_maxQuads, m_vertexBuffer.GetSegmentSize() / (4 * vertexSize) - 1);
+
 				std::size_t spriteChain = 0; // Which chain of sprites are we treating
 				std::size_t spriteChainOffset = 0; // Where was the last offset where we stopped in the last chain
 
 				do
 				{
-					// We open the buffer in writing mode
-					BufferMapper<VertexBuffer> vertexMapper(m_spriteBuffer, BufferAccess_DiscardAndWrite);
-					VertexStruct_XYZ_Color_UV* vertices = static_cast<VertexStruct_XYZ_Color_UV*>(vertexMapper.GetPointer());
-
+					// Count the sprites of this batch first, only the space they need is taken from the stream buffer
 					std::size_t spriteCount = 0;
+					for (std::size_t i = spriteChain, offset = spriteChainOffset; i < spriteChainCount && spriteCount < maxSpriteCount; ++i, offset = 0)
+						spriteCount += std::min(maxSpriteCount - spriteCount, m_spriteChains[i].spriteCount - offset);
+
+					// The vertices don't overwrite those of previous draw calls, so the buffer doesn't need to be orphaned
+					UInt32 bufferOffset;
+					UInt8* vertices = static_cast<UInt8*>(m_vertexBuffer.Map(static_cast<UInt32>(4 * spriteCount * vertexSize), static_cast<UInt32>(vertexSize), &bufferOffset));
+					if (!vertices)
+					{
+						NazaraError("Failed to map sprite vertices");
+						break;
+					}
+
+					std::size_t copiedCount = 0;
 
 					do
 					{
-						const VertexStruct_XYZ_Color_UV* currentChain = m_spriteChains[spriteChain].first;
-						std::size_t currentChainSpriteCount = m_spriteChains[spriteChain].second;
-						std::size_t count = std::min(maxSpriteCount - spriteCount, currentChainSpriteCount - spriteChainOffset);
+						const SpriteChainView& currentChain = m_spriteChains[spriteChain];
+						std::size_t count = std::min(spriteCount - copiedCount, currentChain.spriteCount - spriteChainOffset);
 
-						std::memcpy(vertices, currentChain + spriteChainOffset * 4, 4 * count * sizeof(VertexStruct_XYZ_Color_UV));
-						vertices += count * 4;
+						const VertexStruct_XYZ_Color_UV* chainVertices = currentChain.vertices + spriteChainOffset * 4;
+						if (layeredOverlay)
+						{
+							LayeredSpriteVertex* layeredVertices = reinterpret_cast<LayeredSpriteVertex*>(vertices);
+							for (std::size_t i = 0; i < count * 4; ++i)
+							{
+								static_cast<VertexStruct_XYZ_Color_UV&>(layeredVertices[i]) = chainVertices[i];
+								layeredVertices[i].overlayLayer = static_cast<float>(currentChain.overlayLayer);
+							}
+						}
+						else
+							std::memcpy(vertices, chainVertices, 4 * count * sizeof(VertexStruct_XYZ_Color_UV));
 
-						spriteCount += count;
+						vertices += count * 4 * vertexSize;
+
+						copiedCount += count;
 						spriteChainOffset += count;
 
 						// Have we treated the entire chain ?
-						if (spriteChainOffset == currentChainSpriteCount)
+						if (spriteChainOffset == currentChain.spriteCount)
 						{
 							spriteChain++;
 							spriteChainOffset = 0;
 						}
 					}
-					while (spriteCount < maxSpriteCount && spriteChain < spriteChainCount);
+					while (copiedCount < spriteCount);
 
-					vertexMapper.Unmap();
+					m_vertexBuffer.Unmap();
 
-					Renderer::DrawIndexedPrimitives(PrimitiveMode_TriangleList, 0, spriteCount * 6);
+					Renderer::DrawIndexedPrimitives(PrimitiveMode_TriangleList, 0, static_cast<unsigned int>(spriteCount * 6), static_cast<unsigned int>(bufferOffset / vertexSize));
 				}
 				while (spriteChain < spriteChainCount);
 			}
@@ -686,15 +1066,31 @@ namespace Nz
 		for (const BasicRenderQueue::SpriteChain& basicSprites : spriteList)
 		{
 			const Nz::Recti& scissorRect = (basicSprites.scissorRect.width > 0) ? basicSprites.scissorRect : fullscreenScissorRect;
+			const Nz::Texture* overlayTexture = (basicSprites.overlay) ? basicSprites.overlay.Get() : m_whiteTexture.Get();
 
-			if (basicSprites.material != lastMaterial || basicSprites.overlay != lastOverlay || (basicSprites.material->IsScissorTestEnabled() && scissorRect != lastScissorRect))
+			// Texture array overlays need a layer per vertex, such sprites are always drawn from their vertices
+			bool overlayIsArray = (overlayTexture->GetType() == ImageType_2D_Array);
+			bool instanced = (instancingSupported && basicSprites.instances && !overlayIsArray);
+
+			// Chains using different layers of the same texture array are drawn together
+			if (basicSprites.material != lastMaterial || overlayTexture != lastOverlay || instanced != instancedSprites || (basicSprites.material->IsScissorTestEnabled() && scissorRect != lastScissorRect))
 			{
 				Commit();
 
 				const MaterialPipeline* pipeline = basicSprites.material->GetPipeline();
-				if (lastPipeline != pipeline)
+				bool pipelineChanged = (lastPipeline != pipeline || layeredOverlay != overlayIsArray || instancedSprites != instanced);
+				if (pipelineChanged)
 				{
-					pipelineInstance = &basicSprites.material->GetPipeline()->Apply(ShaderFlags_TextureOverlay | ShaderFlags_VertexColor);
+					UInt32 flags = ShaderFlags_TextureOverlay;
+					if (instanced)
+						flags |= ShaderFlags_Sprite;
+					else
+						flags |= ShaderFlags_VertexColor;
+
+					if (overlayIsArray)
+						flags |= ShaderFlags_TextureOverlayArray;
+
+					pipelineInstance = &pipeline->Apply(flags);
 
 					const Shader* shader = pipelineInstance->uberInstance->GetShader();
 					if (shader != lastShader)
@@ -713,10 +1109,12 @@ namespace Nz
 						lastShader = shader;
 					}
 
+					instancedSprites = instanced;
 					lastPipeline = pipeline;
+					layeredOverlay = overlayIsArray;
 				}
 
-				if (lastMaterial != basicSprites.material)
+				if (lastMaterial != basicSprites.material || pipelineChanged)
 				{
 					basicSprites.material->Apply(*pipelineInstance);
 
@@ -725,7 +1123,6 @@ namespace Nz
 					lastMaterial = basicSprites.material;
 				}
 
-				const Nz::Texture* overlayTexture = (basicSprites.overlay) ? basicSprites.overlay.Get() : m_whiteTexture.Get();
 				if (overlayTexture != lastOverlay)
 				{
 					Renderer::SetTexture(overlayTextureUnit, overlayTexture);
@@ -739,7 +1136,7 @@ namespace Nz
 				}
 			}
 
-			m_spriteChains.emplace_back(basicSprites.vertices, basicSprites.spriteCount);
+			m_spriteChains.push_back({basicSprites.instances, basicSprites.vertices, basicSprites.spriteCount, basicSprites.overlayLayer});
 		}
 
 		Commit();
@@ -755,14 +1152,31 @@ namespace Nz
 			uniforms.shaderUniformInvalidatedSlot.Connect(shader->OnShaderUniformInvalidated, this, &ForwardRenderTechnique::OnShaderInvalidated);
 
 			uniforms.eyePosition = shader->GetUniformLocation("EyePosition");
+			uniforms.lightClusterOffset = shader->GetUniformLocation("LightClusterOffset");
+			uniforms.lightClusterParameters = shader->GetUniformLocation("LightClusterParameters");
 			uniforms.reflectionMap = shader->GetUniformLocation("ReflectionMap");
 			uniforms.sceneAmbient = shader->GetUniformLocation("SceneAmbient");
+			uniforms.skinningMatrices = shader->GetUniformLocation("SkinningMatrices");
 			uniforms.textureOverlay = shader->GetUniformLocation("TextureOverlay");
 
+			int lightBlockIndex = shader->GetUniformBlockIndex("LightBlock");
 			int type0Location = shader->GetUniformLocation("Lights[0].type");
 			int type1Location = shader->GetUniformLocation("Lights[1].type");
 
-			if (type0Location > 0 && type1Location > 0)
+			if (lightBlockIndex != -1)
+			{
+				// Lights are uploaded once per frame, passes only have to send the index of their lights
+				shader->SetUniformBlockBinding(lightBlockIndex, UniformBlock_Lights);
+
+				uniforms.hasLightUniforms = true;
+				uniforms.lightOffset = 0;
+				uniforms.lightUniforms.ubo = true;
+				uniforms.lightUniforms.blockLocations.blockIndex = lightBlockIndex;
+				uniforms.lightUniforms.blockLocations.lightIndices = shader->GetUniformLocation("LightIndices[0]");
+				uniforms.lightUniforms.blockLocations.lightViewProjMatrix = shader->GetUniformLocation("LightViewProjMatrix[0]");
+				uniforms.lightUniforms.blockLocations.shadowCascades = shader->GetUniformLocation("LightShadowCascades[0]");
+			}
+			else if (type0Location > 0 && type1Location > 0)
 			{
 				uniforms.hasLightUniforms = true;
 				uniforms.lightOffset = type1Location - type0Location;
@@ -774,6 +1188,7 @@ namespace Nz
 				uniforms.lightUniforms.locations.parameters1 = shader->GetUniformLocation("Lights[0].parameters1");
 				uniforms.lightUniforms.locations.parameters2 = shader->GetUniformLocation("Lights[0].parameters2");
 				uniforms.lightUniforms.locations.parameters3 = shader->GetUniformLocation("Lights[0].parameters3");
+				uniforms.lightUniforms.locations.shadowCascades = shader->GetUniformLocation("LightShadowCascades[0]");
 				uniforms.lightUniforms.locations.shadowMapping = shader->GetUniformLocation("Lights[0].shadowMapping");
 			}
 			else
@@ -805,8 +1220,277 @@ namespace Nz
 	* \param uniformOffset Offset for the uniform
 	* \param availableTextureUnit Unit texture available
 	*/
+	/*!
+	* \brief Records the draws of models into command buffers, in parallel
+	* \return Number of command buffers to execute, in order, from m_commandBuffers
+	*
+	* The models are first split into batches (like DrawModels does) and their pipelines, shader uniforms and materials are prepared by this thread.
+	* Groups of batches are then recorded by the TaskScheduler workers, each group into its own command buffer.
+	*
+	* \param sceneData Data of the scene
+	* \param models Queue of the models to draw
+	*
+	* \remark Models are drawn in a single pass, which requires clustered lighting
+	*/
+
+	std::size_t ForwardRenderTechnique::RecordModels(const SceneData& sceneData, const RenderQueue<BasicRenderQueue::Model>& models) const
+	{
+		constexpr std::size_t BatchesPerCommandBuffer = 64;
+
+		m_batchModels.clear();
+		m_modelBatches.clear();
+
+		for (const BasicRenderQueue::Model& model : models)
+			m_batchModels.push_back(&model);
+
+		bool instancingSupported = Renderer::HasCapability(RendererCap_Instancing);
+
+		const Material* lastMaterial = nullptr;
+		const Shader* lastShader = nullptr;
+
+		std::size_t modelIndex = 0;
+		while (modelIndex < m_batchModels.size())
+		{
+			const BasicRenderQueue::Model& model = *m_batchModels[modelIndex];
+
+			// Same batching rules as DrawModels
+			std::size_t batchEnd = modelIndex + 1;
+			while (batchEnd < m_batchModels.size())
+			{
+				const BasicRenderQueue::Model& batchModel = *m_batchModels[batchEnd];
+				if (batchModel.material != model.material || batchModel.meshData.indexBuffer != model.meshData.indexBuffer ||
+				    batchModel.meshData.vertexBuffer != model.meshData.vertexBuffer || batchModel.meshData.primitiveMode != model.meshData.primitiveMode ||
+				    batchModel.scissorRect != model.scissorRect || batchModel.jointMatrices != model.jointMatrices)
+					break;
+
+				++batchEnd;
+			}
+
+			ModelBatch batch;
+			batch.firstModel = modelIndex;
+			batch.modelCount = batchEnd - modelIndex;
+			batch.instancing = !model.jointMatrices && instancingSupported && batch.modelCount >= NAZARA_GRAPHICS_INSTANCING_MIN_INSTANCES_COUNT;
+
+			UInt32 shaderFlags = ShaderFlags_ClusteredLighting;
+			if (batch.instancing)
+				shaderFlags |= ShaderFlags_Instancing;
+
+			if (model.jointMatrices)
+				shaderFlags |= ShaderFlags_Skinning;
+
+			// Getting the instance may compile its shader, and the uniforms shared by the whole frame are sent right away
+			batch.pipelineInstance = &model.material->GetPipeline()->GetInstance(shaderFlags);
+
+			const Shader* shader = batch.pipelineInstance->uberInstance->GetShader();
+			batch.shaderUniforms = GetShaderUniforms(shader);
+			if (shader != lastShader)
+			{
+				shader->SendColor(batch.shaderUniforms->sceneAmbient, sceneData.ambientColor);
+				shader->SendVector(batch.shaderUniforms->eyePosition, sceneData.viewer->GetEyePosition());
+
+				if (batch.shaderUniforms->lightClusterParameters != -1)
+				{
+					shader->SendVector(batch.shaderUniforms->lightClusterOffset, m_lightClusterOffset);
+					shader->SendVector(batch.shaderUniforms->lightClusterParameters, m_lightClusterParameters);
+				}
+
+				lastShader = shader;
+			}
+
+			if (model.material != lastMaterial)
+			{
+				model.material->Prepare(*batch.pipelineInstance);
+				lastMaterial = model.material;
+			}
+
+			m_modelBatches.push_back(batch);
+			modelIndex = batchEnd;
+		}
+
+		std::size_t commandBufferCount = (m_modelBatches.size() + BatchesPerCommandBuffer - 1) / BatchesPerCommandBuffer;
+		if (m_commandBuffers.size() < commandBufferCount)
+			m_commandBuffers.resize(commandBufferCount);
+
+		const RenderTarget* renderTarget = sceneData.viewer->GetTarget();
+		Recti fullscreenScissorRect = Recti(Vector2i(renderTarget->GetSize()));
+
+		TaskScheduler::ParallelFor(0, commandBufferCount, 1, [&] (std::size_t begin, std::size_t end)
+		{
+			std::vector<Matrix4f> instanceMatrices;
+
+			for (std::size_t bufferIndex = begin; bufferIndex < end; ++bufferIndex)
+			{
+				CommandBuffer& commandBuffer = m_commandBuffers[bufferIndex];
+				commandBuffer.Clear();
+
+				// Each command buffer starts from an unknown state
+				const MaterialPipeline::Instance* lastInstance = nullptr;
+				const Material* lastBufferMaterial = nullptr;
+				Recti lastScissorRect = Recti(-1, -1);
+
+				std::size_t firstBatch = bufferIndex * BatchesPerCommandBuffer;
+				std::size_t lastBatch = std::min(firstBatch + BatchesPerCommandBuffer, m_modelBatches.size());
+				for (std::size_t batchIndex = firstBatch; batchIndex < lastBatch; ++batchIndex)
+				{
+					const ModelBatch& batch = m_modelBatches[batchIndex];
+					const BasicRenderQueue::Model& model = *m_batchModels[batch.firstModel];
+					const Shader* shader = batch.pipelineInstance->uberInstance->GetShader();
+
+					if (batch.pipelineInstance != lastInstance)
+					{
+						commandBuffer.BindPipeline(shader, model.material->GetPipeline()->GetInfo());
+						lastInstance = batch.pipelineInstance;
+
+						// Material parameters have to be sent to the new shader
+						lastBufferMaterial = nullptr;
+					}
+
+					if (lastBufferMaterial != model.material)
+					{
+						model.material->Record(commandBuffer, *batch.pipelineInstance);
+						lastBufferMaterial = model.material;
+					}
+
+					if (model.material->IsScissorTestEnabled())
+					{
+						const Nz::Recti& scissorRect = (model.scissorRect.width > 0) ? model.scissorRect : fullscreenScissorRect;
+						if (scissorRect != lastScissorRect)
+						{
+							commandBuffer.SetScissorRect(scissorRect);
+							lastScissorRect = scissorRect;
+						}
+					}
+
+					// Reflective models reflect the closest probe they are in, chosen once for the batch if it's instanced
+					bool reflective = (batch.shaderUniforms->reflectionMap != -1);
+					unsigned int reflectionUnit = Material::GetTextureUnit(TextureMap_ReflectionCube);
+
+					if (model.jointMatrices)
+						commandBuffer.SendMatrixArray(shader, batch.shaderUniforms->skinningMatrices, model.jointMatrices, static_cast<unsigned int>(model.jointCount));
+
+					bool indexed = (model.meshData.indexBuffer != nullptr);
+					unsigned int indexCount = (indexed) ? model.meshData.indexBuffer->GetIndexCount() : model.meshData.vertexBuffer->GetVertexCount();
+
+					commandBuffer.SetIndexBuffer(model.meshData.indexBuffer);
+					commandBuffer.SetVertexBuffer(model.meshData.vertexBuffer);
+
+					if (batch.instancing)
+					{
+						instanceMatrices.clear();
+						for (std::size_t i = 0; i < batch.modelCount; ++i)
+							instanceMatrices.push_back(m_batchModels[batch.firstModel + i]->matrix);
+
+						if (reflective)
+						{
+							Boxf batchBox(model.obbSphere.GetPosition() - Vector3f(model.obbSphere.radius), model.obbSphere.GetPosition() + Vector3f(model.obbSphere.radius));
+							for (std::size_t i = 1; i < batch.modelCount; ++i)
+							{
+								const Spheref& instanceSphere = m_batchModels[batch.firstModel + i]->obbSphere;
+								batchBox.ExtendTo(Boxf(instanceSphere.GetPosition() - Vector3f(instanceSphere.radius), instanceSphere.GetPosition() + Vector3f(instanceSphere.radius)));
+							}
+
+							commandBuffer.SetTexture(reflectionUnit, ChooseReflectionProbe(batchBox.GetBoundingSphere(), sceneData.globalReflectionTexture), s_reflectionSampler);
+						}
+
+						if (indexed)
+							commandBuffer.DrawIndexedInstanced(instanceMatrices.data(), instanceMatrices.size(), model.meshData.primitiveMode, 0, indexCount);
+						else
+							commandBuffer.DrawInstanced(instanceMatrices.data(), instanceMatrices.size(), model.meshData.primitiveMode, 0, indexCount);
+					}
+					else
+					{
+						for (std::size_t i = 0; i < batch.modelCount; ++i)
+						{
+							const BasicRenderQueue::Model& batchModel = *m_batchModels[batch.firstModel + i];
+
+							commandBuffer.SetMatrix(MatrixType_World, batchModel.matrix);
+							if (reflective)
+								commandBuffer.SetTexture(reflectionUnit, ChooseReflectionProbe(batchModel.obbSphere, sceneData.globalReflectionTexture), s_reflectionSampler);
+
+
+							if (indexed)
+								commandBuffer.DrawIndexed(model.meshData.primitiveMode, 0, indexCount);
+							else
+								commandBuffer.Draw(model.meshData.primitiveMode, 0, indexCount);
+						}
+					}
+				}
+			}
+		});
+
+		return commandBufferCount;
+	}
+
 	void ForwardRenderTechnique::SendLightUniforms(const Shader* shader, const LightUniforms& uniforms, unsigned int index, unsigned int lightIndex, unsigned int uniformOffset) const
 	{
+		if (uniforms.ubo)
+		{
+			// Light parameters are already in the light block (see UploadLights), only shadow maps are bound by slot
+			int blockLightIndex = -1;
+			if (lightIndex < m_lights.size())
+			{
+				const LightIndex& lightInfo = m_lights[lightIndex];
+
+				unsigned int globalIndex = m_lightBlockOffsets[lightInfo.type] + lightInfo.index;
+				if (globalIndex < m_lightBlockOffsets[lightInfo.type + 1]) //< Lights past NAZARA_GRAPHICS_MAX_LIGHTS_PER_SCENE are ignored
+				{
+					blockLightIndex = static_cast<int>(globalIndex);
+
+					auto BindShadowMap2D = [&](const Texture* shadowMap, const Matrix4f& transformMatrix)
+					{
+						if (!shadowMap)
+							return;
+
+						unsigned int textureUnit2D = Material::GetTextureUnit(static_cast<TextureMap>(TextureMap_Shadow2D_1 + index));
+
+						Renderer::SetTexture(textureUnit2D, shadowMap);
+						Renderer::SetTextureSampler(textureUnit2D, s_shadowSampler);
+
+						if (uniforms.blockLocations.lightViewProjMatrix != -1)
+							shader->SendMatrix(uniforms.blockLocations.lightViewProjMatrix + index, transformMatrix);
+					};
+
+					switch (lightInfo.type)
+					{
+						case LightType_Directional:
+						{
+							const auto& light = m_renderQueue.directionalLights[lightInfo.index];
+							BindShadowMap2D(light.shadowMap, light.transformMatrix);
+
+							if (light.shadowMap && uniforms.blockLocations.shadowCascades != -1)
+								shader->SendVectorArray(uniforms.blockLocations.shadowCascades + index * NAZARA_GRAPHICS_MAX_SHADOW_CASCADES, light.shadowCascades, NAZARA_GRAPHICS_MAX_SHADOW_CASCADES);
+							break;
+						}
+
+						case LightType_Point:
+						{
+							const auto& light = m_renderQueue.pointLights[lightInfo.index];
+							if (light.shadowMap)
+							{
+								unsigned int textureUnitCube = Material::GetTextureUnit(static_cast<TextureMap>(TextureMap_ShadowCube_1 + index));
+
+								Renderer::SetTexture(textureUnitCube, light.shadowMap);
+								Renderer::SetTextureSampler(textureUnitCube, s_shadowSampler);
+							}
+							break;
+						}
+
+						case LightType_Spot:
+						{
+							const auto& light = m_renderQueue.spotLights[lightInfo.index];
+							BindShadowMap2D(light.shadowMap, light.transformMatrix);
+							break;
+						}
+					}
+				}
+			}
+
+			if (uniforms.blockLocations.lightIndices != -1)
+				shader->SendInteger(uniforms.blockLocations.lightIndices + index, blockLightIndex);
+
+			return;
+		}
+
 		if (lightIndex < m_lights.size())
 		{
 			const LightIndex& lightInfo = m_lights[lightIndex];
@@ -835,6 +1519,9 @@ namespace Nz
 
 						if (uniforms.locations.lightViewProjMatrix != -1)
 							shader->SendMatrix(uniforms.locations.lightViewProjMatrix + index, light.transformMatrix);
+
+						if (uniforms.locations.shadowCascades != -1)
+							shader->SendVectorArray(uniforms.locations.shadowCascades + index * NAZARA_GRAPHICS_MAX_SHADOW_CASCADES, light.shadowCascades, NAZARA_GRAPHICS_MAX_SHADOW_CASCADES);
 					}
 					break;
 				}
@@ -895,10 +1582,211 @@ namespace Nz
 		}
 	}
 
+	/*!
+	* \brief Bins the lights of the light block into the clusters of the viewer and uploads them
+	*
+	* \param sceneData Data of the scene
+	*
+	* The view frustum is divided into a grid of clusters, exponentially along the depth, each cluster holding a mask of the lights reaching it.
+	* Directional lights reach every cluster, point and spot lights the clusters overlapped by their bounding sphere.
+	*
+	* \remark UploadLights must have been called beforehand, clusters refer to the lights by their index in the light block
+	*/
+	void ForwardRenderTechnique::UpdateLightClusters(const SceneData& sceneData) const
+	{
+		static_assert(NAZARA_GRAPHICS_MAX_LIGHTS_PER_SCENE <= 128, "Clusters hold a mask of 128 lights");
+
+		if (!m_lightClusterTexture)
+		{
+			m_lightClusterTexture = Texture::New();
+			if (!m_lightClusterTexture->Create(ImageType_3D, PixelFormatType_RGBA32UI, s_lightClusterCount.x, s_lightClusterCount.y, s_lightClusterCount.z))
+			{
+				NazaraError("Failed to create light cluster texture");
+				m_lightClusterTexture.Reset();
+				return;
+			}
+		}
+
+		const AbstractViewer* viewer = sceneData.viewer;
+		const Matrix4f& projectionMatrix = viewer->GetProjectionMatrix();
+		const Matrix4f& viewMatrix = viewer->GetViewMatrix();
+		const Recti& viewport = viewer->GetViewport();
+
+		// Slices are distributed logarithmically between the near and the far plane, which mustn't be zero
+		float zNear = std::max(viewer->GetZNear(), 0.01f);
+		float zFar = std::max(viewer->GetZFar(), zNear * 2.f);
+		float depthScale = s_lightClusterCount.z / std::log(zFar / zNear);
+		float depthBias = -std::log(zNear) * depthScale;
+
+		// OpenGL window coordinates start from the bottom of the target
+		m_lightClusterOffset.Set(float(viewport.x), float(int(viewer->GetTarget()->GetSize().y) - viewport.height - viewport.y));
+		m_lightClusterParameters.Set(float(s_lightClusterCount.x) / viewport.width, float(s_lightClusterCount.y) / viewport.height, depthScale, depthBias);
+
+		m_lightClusters.assign(s_lightClusterCount.x * s_lightClusterCount.y * s_lightClusterCount.z * 4, 0);
+
+		auto AddLight = [&](unsigned int lightIndex, const Vector3ui& first, const Vector3ui& last)
+		{
+			UInt32 lightBit = 1U << (lightIndex % 32);
+			unsigned int word = lightIndex / 32;
+
+			for (unsigned int z = first.z; z <= last.z; ++z)
+			{
+				for (unsigned int y = first.y; y <= last.y; ++y)
+				{
+					for (unsigned int x = first.x; x <= last.x; ++x)
+						m_lightClusters[((z * s_lightClusterCount.y + y) * s_lightClusterCount.x + x) * 4 + word] |= lightBit;
+				}
+			}
+		};
+
+		auto DepthToSlice = [&](float depth)
+		{
+			return static_cast<unsigned int>(Clamp(std::log(std::max(depth, zNear)) * depthScale + depthBias, 0.f, float(s_lightClusterCount.z - 1)));
+		};
+
+		auto ProjectedToCluster = [](float coord, unsigned int clusterCount)
+		{
+			return static_cast<unsigned int>(Clamp((coord * 0.5f + 0.5f) * clusterCount, 0.f, float(clusterCount - 1)));
+		};
+
+		auto AddSphereLight = [&](unsigned int lightIndex, const Vector3f& position, float radius)
+		{
+			Vector3f viewPosition = viewMatrix.Transform(position);
+			float minDepth = -viewPosition.z - radius;
+			float maxDepth = -viewPosition.z + radius;
+			if (maxDepth < zNear || minDepth > zFar)
+				return;
+
+			Vector3ui first(0, 0, DepthToSlice(minDepth));
+			Vector3ui last(s_lightClusterCount.x - 1, s_lightClusterCount.y - 1, DepthToSlice(maxDepth));
+
+			// Screen bounds of the box around the sphere, a box reaching behind the eye may cover the whole screen
+			Vector2f projectedMin(std::numeric_limits<float>::infinity());
+			Vector2f projectedMax(-std::numeric_limits<float>::infinity());
+			bool bounded = true;
+			for (unsigned int corner = 0; corner < 8; ++corner)
+			{
+				Vector3f offset((corner & 1) ? radius : -radius, (corner & 2) ? radius : -radius, (corner & 4) ? radius : -radius);
+				Vector4f clipPosition = projectionMatrix.Transform(Vector4f(viewPosition + offset, 1.f));
+				if (clipPosition.w <= 0.f)
+				{
+					bounded = false;
+					break;
+				}
+
+				Vector2f projected(clipPosition.x / clipPosition.w, clipPosition.y / clipPosition.w);
+				projectedMin.Minimize(projected);
+				projectedMax.Maximize(projected);
+			}
+
+			if (bounded)
+			{
+				if (projectedMax.x < -1.f || projectedMin.x > 1.f || projectedMax.y < -1.f || projectedMin.y > 1.f)
+					return;
+
+				first.x = ProjectedToCluster(projectedMin.x, s_lightClusterCount.x);
+				first.y = ProjectedToCluster(projectedMin.y, s_lightClusterCount.y);
+				last.x = ProjectedToCluster(projectedMax.x, s_lightClusterCount.x);
+				last.y = ProjectedToCluster(projectedMax.y, s_lightClusterCount.y);
+			}
+
+			AddLight(lightIndex, first, last);
+		};
+
+		for (unsigned int i = m_lightBlockOffsets[LightType_Directional]; i < m_lightBlockOffsets[LightType_Point]; ++i)
+			AddLight(i, Vector3ui::Zero(), s_lightClusterCount - Vector3ui(1));
+
+		// Lights past NAZARA_GRAPHICS_MAX_LIGHTS_PER_SCENE are not in the light block
+		for (unsigned int i = m_lightBlockOffsets[LightType_Point]; i < m_lightBlockOffsets[LightType_Spot]; ++i)
+		{
+			const auto& light = m_renderQueue.pointLights[i - m_lightBlockOffsets[LightType_Point]];
+			AddSphereLight(i, light.position, light.radius);
+		}
+
+		for (unsigned int i = m_lightBlockOffsets[LightType_Spot]; i < m_lightBlockOffsets[LightType_Max + 1]; ++i)
+		{
+			const auto& light = m_renderQueue.spotLights[i - m_lightBlockOffsets[LightType_Spot]];
+			AddSphereLight(i, light.position, light.radius);
+		}
+
+		m_lightClusterTexture->Update(reinterpret_cast<const UInt8*>(m_lightClusters.data()));
+	}
+
+	/*!
+	* \brief Uploads the lights of the render queue to the light uniform block and binds it
+	*
+	* Lights are stored by type (directional, point then spot lights), up to NAZARA_GRAPHICS_MAX_LIGHTS_PER_SCENE lights
+	*/
+	void ForwardRenderTechnique::UploadLights() const
+	{
+		m_lightBlockData.clear();
+
+		auto PushLight = [&](LightType type, const Color& color, float ambientFactor, float diffuseFactor, const Texture* shadowMap) -> LightBlockData*
+		{
+			if (m_lightBlockData.size() >= NAZARA_GRAPHICS_MAX_LIGHTS_PER_SCENE)
+				return nullptr;
+
+			m_lightBlockData.emplace_back();
+
+			LightBlockData& lightData = m_lightBlockData.back();
+			lightData.color = ColorToVector(color);
+			lightData.parameters1 = Vector4f::Zero();
+			lightData.parameters2 = Vector4f::Zero();
+			lightData.factors.Set(ambientFactor, diffuseFactor);
+			lightData.parameters3 = Vector2f::Zero();
+			lightData.type = type;
+			lightData.shadowMapping = (shadowMap) ? 1 : 0;
+			lightData.padding[0] = 0;
+			lightData.padding[1] = 0;
+
+			return &lightData;
+		};
+
+		m_lightBlockOffsets[LightType_Directional] = 0;
+		for (const auto& light : m_renderQueue.directionalLights)
+		{
+			if (LightBlockData* lightData = PushLight(LightType_Directional, light.color, light.ambientFactor, light.diffuseFactor, light.shadowMap))
+				lightData->parameters1 = Vector4f(light.direction);
+		}
+
+		m_lightBlockOffsets[LightType_Point] = static_cast<unsigned int>(m_lightBlockData.size());
+		for (const auto& light : m_renderQueue.pointLights)
+		{
+			if (LightBlockData* lightData = PushLight(LightType_Point, light.color, light.ambientFactor, light.diffuseFactor, light.shadowMap))
+			{
+				lightData->parameters1 = Vector4f(light.position, light.attenuation);
+				lightData->parameters2 = Vector4f(0.f, 0.f, 0.f, light.invRadius);
+			}
+		}
+
+		m_lightBlockOffsets[LightType_Spot] = static_cast<unsigned int>(m_lightBlockData.size());
+		for (const auto& light : m_renderQueue.spotLights)
+		{
+			if (LightBlockData* lightData = PushLight(LightType_Spot, light.color, light.ambientFactor, light.diffuseFactor, light.shadowMap))
+			{
+				lightData->parameters1 = Vector4f(light.position, light.attenuation);
+				lightData->parameters2 = Vector4f(light.direction, light.invRadius);
+				lightData->parameters3.Set(light.innerAngleCosine, light.outerAngleCosine);
+			}
+		}
+
+		m_lightBlockOffsets[LightType_Max + 1] = static_cast<unsigned int>(m_lightBlockData.size());
+
+		if (!m_lightBlockData.empty())
+			m_lightBuffer.Fill(m_lightBlockData.data(), 0, static_cast<UInt32>(m_lightBlockData.size() * sizeof(LightBlockData)));
+
+		Renderer::SetUniformBuffer(UniformBlock_Lights, &m_lightBuffer);
+	}
+
 	IndexBuffer ForwardRenderTechnique::s_quadIndexBuffer;
+	RenderStates ForwardRenderTechnique::s_oitCompositeStates;
+	ShaderRef ForwardRenderTechnique::s_oitCompositeShader;
+	TextureSampler ForwardRenderTechnique::s_lightClusterSampler;
 	TextureSampler ForwardRenderTechnique::s_reflectionSampler;
 	TextureSampler ForwardRenderTechnique::s_shadowSampler;
 	VertexBuffer ForwardRenderTechnique::s_quadVertexBuffer;
 	VertexDeclaration ForwardRenderTechnique::s_billboardInstanceDeclaration;
 	VertexDeclaration ForwardRenderTechnique::s_billboardVertexDeclaration;
+	VertexDeclaration ForwardRenderTechnique::s_layeredSpriteVertexDeclaration;
+	VertexDeclaration ForwardRenderTechnique::s_spriteInstanceDeclaration;
 }
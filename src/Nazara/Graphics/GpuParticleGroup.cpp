@@ -0,0 +1,370 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Graphics/GpuParticleGroup.hpp>
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/ErrorFlags.hpp>
+#include <Nazara/Core/OffsetOf.hpp>
+#include <Nazara/Graphics/AbstractRenderQueue.hpp>
+#include <Nazara/Graphics/ParticleDeclaration.hpp>
+#include <Nazara/Graphics/ParticleGroup.hpp>
+#include <Nazara/Graphics/ParticleMapper.hpp>
+#include <Nazara/Renderer/Renderer.hpp>
+#include <Nazara/Renderer/RenderStates.hpp>
+#include <Nazara/Renderer/Texture.hpp>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		const UInt8 r_renderFragmentShader[] = {
+			#include <Nazara/Graphics/Resources/Shaders/GpuParticles/render.frag.h>
+		};
+
+		const UInt8 r_renderGeometryShader[] = {
+			#include <Nazara/Graphics/Resources/Shaders/GpuParticles/render.geom.h>
+		};
+
+		const UInt8 r_renderVertexShader[] = {
+			#include <Nazara/Graphics/Resources/Shaders/GpuParticles/render.vert.h>
+		};
+
+		const UInt8 r_updateVertexShader[] = {
+			#include <Nazara/Graphics/Resources/Shaders/GpuParticles/update.vert.h>
+		};
+
+		bool HasComponent(const ParticleDeclaration& declaration, ParticleComponent component, ComponentType expectedType)
+		{
+			bool enabled;
+			ComponentType type;
+			std::size_t offset;
+			declaration.GetComponent(component, &enabled, &type, &offset);
+
+			return enabled && type == expectedType;
+		}
+	}
+
+	/*!
+	* \ingroup graphics
+	* \class Nz::GpuParticleGroup
+	* \brief Graphics class that represents a group of particles simulated and drawn by the GPU
+	*
+	* The state of the particles lives in two vertex buffers, the simulation reading one and writing the other through transform feedback.
+	* Particles are never read back by the CPU, which only uploads the new ones, so a group can hold far more particles than a ParticleGroup.
+	*
+	* Instead of ParticleController objects, the common controllers are uniforms applied to every particle:
+	* an acceleration changing their velocity, an angular velocity, and a color and size interpolated from their birth to their death.
+	*
+	* The group is a ring of particles, a new particle taking the place of the oldest one once the group is full.
+	*
+	* \remark Particles are drawn as billboards facing the camera, in world space, with the render states and diffuse map of the material
+	*/
+
+	/*!
+	* \brief Constructs a GpuParticleGroup object
+	*
+	* \param maxParticleCount Maximum number of particles alive at the same time
+	* \param material Material used to draw the particles
+	*
+	* \remark Produces a NazaraError and throws an exception if the shaders or the buffers could not be created
+	*/
+
+	GpuParticleGroup::GpuParticleGroup(unsigned int maxParticleCount, MaterialRef material) :
+	m_maxParticleCount(maxParticleCount),
+	m_currentBuffer(0),
+	m_spawnCursor(0),
+	m_usedParticleCount(0),
+	m_finalColor(Color::White),
+	m_acceleration(Vector3f::Zero()),
+	m_angularVelocity(0.f),
+	m_finalSizeFactor(1.f),
+	m_pendingTime(0.f)
+	{
+		NazaraAssert(maxParticleCount > 0, "Max particle count must be over zero");
+
+		SetMaterial(std::move(material));
+
+		ErrorFlags flags(ErrorFlag_ThrowException, true);
+
+		if (!Initialize())
+			NazaraError("Failed to create GPU particle shaders");
+
+		// Dead particles (without remaining life) are not drawn
+		std::vector<Particle> deadParticles(maxParticleCount);
+		std::memset(deadParticles.data(), 0, maxParticleCount * sizeof(Particle));
+
+		for (VertexBuffer& buffer : m_stateBuffers)
+		{
+			buffer.Reset(s_particleDeclaration, maxParticleCount, DataStorage_Hardware, BufferUsage_Dynamic);
+			buffer.Fill(deadParticles.data(), 0, maxParticleCount);
+		}
+	}
+
+	/*!
+	* \brief Adds the particles to the rendering queue
+	*
+	* \param renderQueue Queue to be added
+	* \param transformMatrix Transformation matrix, unused as particles are in world space
+	*/
+
+	void GpuParticleGroup::AddToRenderQueue(AbstractRenderQueue* renderQueue, const Matrix4f& /*transformMatrix*/) const
+	{
+		NazaraAssert(renderQueue, "Invalid render queue");
+
+		renderQueue->AddDrawable(0, this);
+	}
+
+	/*!
+	* \brief Simulates the time elapsed since the last draw and draws the particles
+	*
+	* \remark Render states, shader, buffers and textures of the Renderer are changed
+	*/
+
+	void GpuParticleGroup::Draw() const
+	{
+		Renderer::SetIndexBuffer(nullptr);
+
+		Simulate();
+
+		if (m_usedParticleCount == 0)
+			return;
+
+		RenderStates states = m_material->GetPipelineInfo();
+		states.faceCulling = false;
+
+		Renderer::SetRenderStates(states);
+		Renderer::SetShader(s_renderShader);
+		Renderer::SetTexture(0, (m_material->HasDiffuseMap()) ? m_material->GetDiffuseMap().Get() : TextureLibrary::Get("White2D").Get());
+		Renderer::SetTextureSampler(0, m_material->GetDiffuseSampler());
+		Renderer::SetVertexBuffer(&m_stateBuffers[m_currentBuffer]);
+
+		s_renderShader->SendColor(s_renderShader->GetUniformLocation("FinalColor"), m_finalColor);
+		s_renderShader->SendFloat(s_renderShader->GetUniformLocation("FinalSizeFactor"), m_finalSizeFactor);
+		s_renderShader->SendColor(s_renderShader->GetUniformLocation("MaterialDiffuse"), m_material->GetDiffuseColor());
+
+		Renderer::DrawPrimitives(PrimitiveMode_PointList, 0, static_cast<unsigned int>(m_usedParticleCount));
+	}
+
+	/*!
+	* \brief Adds particles to the group
+	*
+	* Particles are only uploaded to the GPU the next time the group is drawn.
+	*
+	* \param mapper Mapper to the particles, built from the declaration
+	* \param declaration Declaration of the particles, which must have a ComponentType_Float3 position
+	* \param particleCount Number of particles to add
+	*
+	* \remark Optional components are a ComponentType_Color color, a ComponentType_Float1 life (in seconds) and rotation (in degrees), a ComponentType_Float2 size and a ComponentType_Float3 velocity
+	* \remark Particles without life never die, particles without color are white and particles without size have a size of one
+	* \remark Produces a NazaraError if the declaration has no position
+	*/
+
+	void GpuParticleGroup::Spawn(const ParticleMapper& mapper, const ParticleDeclaration& declaration, std::size_t particleCount)
+	{
+		if (!HasComponent(declaration, ParticleComponent_Position, ComponentType_Float3))
+		{
+			NazaraError("Particle declaration must have a Float3 position");
+			return;
+		}
+
+		SparsePtr<const Vector3f> positionPtr = mapper.GetComponentPtr<Vector3f>(ParticleComponent_Position);
+
+		SparsePtr<const Color> colorPtr;
+		if (HasComponent(declaration, ParticleComponent_Color, ComponentType_Color))
+			colorPtr = mapper.GetComponentPtr<Color>(ParticleComponent_Color);
+
+		SparsePtr<const float> lifePtr;
+		if (HasComponent(declaration, ParticleComponent_Life, ComponentType_Float1))
+			lifePtr = mapper.GetComponentPtr<float>(ParticleComponent_Life);
+
+		SparsePtr<const float> rotationPtr;
+		if (HasComponent(declaration, ParticleComponent_Rotation, ComponentType_Float1))
+			rotationPtr = mapper.GetComponentPtr<float>(ParticleComponent_Rotation);
+
+		SparsePtr<const Vector2f> sizePtr;
+		if (HasComponent(declaration, ParticleComponent_Size, ComponentType_Float2))
+			sizePtr = mapper.GetComponentPtr<Vector2f>(ParticleComponent_Size);
+
+		SparsePtr<const Vector3f> velocityPtr;
+		if (HasComponent(declaration, ParticleComponent_Velocity, ComponentType_Float3))
+			velocityPtr = mapper.GetComponentPtr<Vector3f>(ParticleComponent_Velocity);
+
+		// Only the last particles would survive the ring
+		std::size_t firstParticle = (particleCount > m_maxParticleCount) ? particleCount - m_maxParticleCount : 0;
+		for (std::size_t i = firstParticle; i < particleCount; ++i)
+		{
+			Color color = (colorPtr) ? colorPtr[i] : Color::White;
+
+			Particle particle;
+			particle.color.Set(color.r / 255.f, color.g / 255.f, color.b / 255.f, color.a / 255.f);
+			particle.life = (lifePtr) ? lifePtr[i] : std::numeric_limits<float>::max();
+			particle.lifetime = particle.life;
+			particle.position = positionPtr[i];
+			particle.rotation = (rotationPtr) ? rotationPtr[i] : 0.f;
+			particle.size = (sizePtr) ? sizePtr[i] : Vector2f::Unit();
+			particle.velocity = (velocityPtr) ? velocityPtr[i] : Vector3f::Zero();
+
+			m_spawnedParticles.push_back(particle);
+		}
+
+		if (m_spawnedParticles.size() > m_maxParticleCount)
+			m_spawnedParticles.erase(m_spawnedParticles.begin(), m_spawnedParticles.end() - m_maxParticleCount);
+	}
+
+	/*!
+	* \brief Moves the particles of a group to this one
+	*
+	* This allows the emitters and generators of a ParticleGroup to create the particles simulated by the GPU.
+	*
+	* \param group Group whose particles are moved, it is emptied
+	*/
+
+	void GpuParticleGroup::Spawn(ParticleGroup& group)
+	{
+		std::size_t particleCount = group.GetParticleCount();
+		if (particleCount == 0)
+			return;
+
+		Spawn(group.GetParticleMapper(), *group.GetDeclaration(), particleCount);
+		group.KillParticles();
+	}
+
+	/*!
+	* \brief Makes the bounding volume of this group
+	*
+	* Particles positions are only known by the GPU, the group is never culled
+	*/
+
+	void GpuParticleGroup::MakeBoundingVolume() const
+	{
+		m_boundingVolume.MakeInfinite();
+	}
+
+	/*!
+	* \brief Uploads the spawned particles and simulates the pending time
+	*/
+
+	void GpuParticleGroup::Simulate() const
+	{
+		VertexBuffer& currentBuffer = m_stateBuffers[m_currentBuffer];
+
+		if (!m_spawnedParticles.empty())
+		{
+			// The ring may wrap, in which case the particles are written in two parts
+			std::size_t spawnCount = m_spawnedParticles.size();
+			std::size_t firstPart = std::min(spawnCount, m_maxParticleCount - m_spawnCursor);
+
+			currentBuffer.Fill(m_spawnedParticles.data(), static_cast<UInt32>(m_spawnCursor), static_cast<UInt32>(firstPart));
+			if (firstPart < spawnCount)
+			{
+				currentBuffer.Fill(m_spawnedParticles.data() + firstPart, 0, static_cast<UInt32>(spawnCount - firstPart));
+				m_usedParticleCount = m_maxParticleCount;
+			}
+			else
+				m_usedParticleCount = std::max(m_usedParticleCount, m_spawnCursor + firstPart);
+
+			m_spawnCursor = (m_spawnCursor + spawnCount) % m_maxParticleCount;
+			m_spawnedParticles.clear();
+		}
+
+		if (m_pendingTime <= 0.f || m_usedParticleCount == 0)
+			return;
+
+		std::size_t nextBuffer = (m_currentBuffer + 1) % m_stateBuffers.size();
+
+		Renderer::SetShader(s_updateShader);
+		Renderer::SetVertexBuffer(&currentBuffer);
+
+		s_updateShader->SendVector(s_updateShader->GetUniformLocation("Acceleration"), m_acceleration);
+		s_updateShader->SendFloat(s_updateShader->GetUniformLocation("AngularVelocity"), m_angularVelocity);
+		s_updateShader->SendFloat(s_updateShader->GetUniformLocation("ElapsedTime"), m_pendingTime);
+
+		Renderer::CapturePrimitives(PrimitiveMode_PointList, 0, static_cast<unsigned int>(m_usedParticleCount), m_stateBuffers[nextBuffer].GetBuffer());
+
+		m_currentBuffer = nextBuffer;
+		m_pendingTime = 0.f;
+	}
+
+	/*!
+	* \brief Initializes the GPU particle groups
+	* \return true If successful
+	*
+	* The shaders are created when the first group is constructed, which keeps their compilation out of the startup of the module.
+	*
+	* \remark Produces a NazaraError if the shaders could not be created
+	*/
+
+	bool GpuParticleGroup::Initialize()
+	{
+		if (s_renderShader)
+			return true;
+
+		try
+		{
+			ErrorFlags flags(ErrorFlag_ThrowException, true);
+
+			// Must match the Particle structure and the outputs of the update shader
+			VertexDeclarationRef declaration = VertexDeclaration::New();
+			declaration->EnableComponent(VertexComponent_Color,     ComponentType_Float4, NazaraOffsetOf(Particle, color));
+			declaration->EnableComponent(VertexComponent_Position,  ComponentType_Float3, NazaraOffsetOf(Particle, position));
+			declaration->EnableComponent(VertexComponent_Userdata0, ComponentType_Float1, NazaraOffsetOf(Particle, life));
+			declaration->EnableComponent(VertexComponent_Userdata1, ComponentType_Float3, NazaraOffsetOf(Particle, velocity));
+			declaration->EnableComponent(VertexComponent_Userdata2, ComponentType_Float1, NazaraOffsetOf(Particle, lifetime));
+			declaration->EnableComponent(VertexComponent_TexCoord,  ComponentType_Float2, NazaraOffsetOf(Particle, size));
+			declaration->EnableComponent(VertexComponent_Userdata3, ComponentType_Float1, NazaraOffsetOf(Particle, rotation));
+
+			NazaraAssert(declaration->GetStride() == sizeof(Particle), "Invalid stride for GPU particle declaration");
+
+			// Simulation, the new state is captured without being rasterized
+			const char* varyings[] = { "tfColor", "tfPosition", "tfLife", "tfVelocity", "tfLifetime", "tfSize", "tfRotation" };
+
+			ShaderRef updateShader = Shader::New();
+			updateShader->Create();
+			updateShader->AttachStageFromSource(ShaderStageType_Vertex, reinterpret_cast<const char*>(r_updateVertexShader), sizeof(r_updateVertexShader));
+			updateShader->SetTransformFeedbackVaryings(varyings, static_cast<unsigned int>(CountOf(varyings)));
+			updateShader->Link();
+
+			// Rendering, each particle is expanded into a billboard by the geometry shader
+			ShaderRef renderShader = Shader::New();
+			renderShader->Create();
+			renderShader->AttachStageFromSource(ShaderStageType_Vertex, reinterpret_cast<const char*>(r_renderVertexShader), sizeof(r_renderVertexShader));
+			renderShader->AttachStageFromSource(ShaderStageType_Geometry, reinterpret_cast<const char*>(r_renderGeometryShader), sizeof(r_renderGeometryShader));
+			renderShader->AttachStageFromSource(ShaderStageType_Fragment, reinterpret_cast<const char*>(r_renderFragmentShader), sizeof(r_renderFragmentShader));
+			renderShader->Link();
+
+			renderShader->SendInteger(renderShader->GetUniformLocation("MaterialDiffuseMap"), 0);
+
+			// Exception-free zone
+			s_particleDeclaration = std::move(declaration);
+			s_renderShader = std::move(renderShader);
+			s_updateShader = std::move(updateShader);
+		}
+		catch (const std::exception& e)
+		{
+			NazaraError("Failed to initialise: " + String(e.what()));
+			return false;
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Uninitializes the GPU particle groups
+	*/
+
+	void GpuParticleGroup::Uninitialize()
+	{
+		s_particleDeclaration.Reset();
+		s_renderShader.Reset();
+		s_updateShader.Reset();
+	}
+
+	ShaderRef GpuParticleGroup::s_renderShader;
+	ShaderRef GpuParticleGroup::s_updateShader;
+	VertexDeclarationRef GpuParticleGroup::s_particleDeclaration;
+}
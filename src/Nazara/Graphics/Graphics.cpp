@@ -6,12 +6,15 @@
 #include <Nazara/Core/CallOnExit.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Graphics/Config.hpp>
 #include <Nazara/Graphics/DeferredRenderTechnique.hpp>
 #include <Nazara/Graphics/DepthRenderTechnique.hpp>
 #include <Nazara/Graphics/ForwardRenderTechnique.hpp>
+#include <Nazara/Graphics/GpuParticleGroup.hpp>
 #include <Nazara/Graphics/GuillotineTextureAtlas.hpp>
 #include <Nazara/Graphics/Material.hpp>
+#include <Nazara/Graphics/OcclusionCuller.hpp>
 #include <Nazara/Graphics/ParticleController.hpp>
 #include <Nazara/Graphics/ParticleDeclaration.hpp>
 #include <Nazara/Graphics/ParticleGenerator.hpp>
@@ -21,6 +24,7 @@
 #include <Nazara/Graphics/SkyboxBackground.hpp>
 #include <Nazara/Graphics/Sprite.hpp>
 #include <Nazara/Graphics/TileMap.hpp>
+#include <Nazara/Graphics/Vegetation.hpp>
 #include <Nazara/Graphics/Formats/MeshLoader.hpp>
 #include <Nazara/Graphics/Formats/TextureLoader.hpp>
 #include <Nazara/Renderer/Renderer.hpp>
@@ -51,6 +55,8 @@ namespace Nz
 			return true; // Already initialized
 		}
 
+		Profiler::Scope profilerScope("Graphics::Initialize");
+
 		// Initialisation of dependances
 		if (!Renderer::Initialize())
 		{
@@ -76,7 +82,7 @@ namespace Nz
 			return false;
 		}
 
-		// Renderables
+		// Renderables (GPU particle groups and skybox backgrounds create their shaders when the first one is constructed)
 		if (!ParticleController::Initialize())
 		{
 			NazaraError("Failed to initialize particle controllers");
@@ -107,12 +113,6 @@ namespace Nz
 			return false;
 		}
 
-		if (!SkyboxBackground::Initialize())
-		{
-			NazaraError("Failed to initialize skybox backgrounds");
-			return false;
-		}
-
 		if (!Sprite::Initialize())
 		{
 			NazaraError("Failed to initialize sprites");
@@ -125,6 +125,12 @@ namespace Nz
 			return false;
 		}
 
+		if (!OcclusionCuller::Initialize())
+		{
+			NazaraError("Failed to initialize occlusion culling");
+			return false;
+		}
+
 		// Generic loaders
 		Loaders::RegisterMesh();
 		Loaders::RegisterTexture();
@@ -144,15 +150,9 @@ namespace Nz
 
 		RenderTechniques::Register(RenderTechniques::ToString(RenderTechniqueType_BasicForward), 0, []() -> AbstractRenderTechnique* { return new ForwardRenderTechnique; });
 
+		// Deferred shaders are only compiled when the first deferred technique is constructed
 		if (DeferredRenderTechnique::IsSupported())
-		{
-			if (DeferredRenderTechnique::Initialize())
-				RenderTechniques::Register(RenderTechniques::ToString(RenderTechniqueType_DeferredShading), 20, []() -> AbstractRenderTechnique* { return new DeferredRenderTechnique; });
-			else
-			{
-				NazaraWarning("Failed to initialize Deferred Rendering");
-			}
-		}
+			RenderTechniques::Register(RenderTechniques::ToString(RenderTechniqueType_DeferredShading), 20, []() -> AbstractRenderTechnique* { return new DeferredRenderTechnique; });
 
 		Font::SetDefaultAtlas(std::make_shared<GuillotineTextureAtlas>());
 
@@ -245,9 +245,12 @@ namespace Nz
 		ParticleGenerator::Uninitialize();
 		ParticleDeclaration::Uninitialize();
 		ParticleController::Uninitialize();
+		GpuParticleGroup::Uninitialize();
 		SkyboxBackground::Uninitialize();
 		Sprite::Uninitialize();
 		TileMap::Uninitialize();
+		Vegetation::Uninitialize();
+		OcclusionCuller::Uninitialize();
 
 		// Render techniques
 		DeferredRenderTechnique::Uninitialize();
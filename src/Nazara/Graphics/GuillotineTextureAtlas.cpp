@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Graphics/GuillotineTextureAtlas.hpp>
+#include <Nazara/Core/Error.hpp>
 #include <Nazara/Renderer/Texture.hpp>
 #include <Nazara/Graphics/Debug.hpp>
 
@@ -12,8 +13,48 @@ namespace Nz
 	* \ingroup graphics
 	* \class Nz::GuillotineTextureAtlas
 	* \brief Graphics class that represents an atlas texture for guillotine
+	*
+	* By default, each layer of the atlas is a texture of its own, growing as glyphs are inserted.
+	* An atlas can instead put its layers in a single texture array, each layer then being an ArrayLayer of a fixed size.
+	* Sprites using different layers of the same array can be drawn in a single batch by the forward render technique.
+	*/
+
+	/*!
+	* \brief Constructs a GuillotineTextureAtlas object
+	*
+	* \param arrayLayerSize Width and height of the layers of the texture array, zero to use a texture per layer
+	*
+	* \remark Texture arrays are only supported by the forward render technique, the depth and deferred techniques expect 2D textures
+	*/
+
+	GuillotineTextureAtlas::GuillotineTextureAtlas(unsigned int arrayLayerSize) :
+	m_arrayLayerCount(0),
+	m_arrayLayerSize(arrayLayerSize)
+	{
+	}
+
+	/*!
+	* \brief Clears the atlas, releasing its textures
+	*/
+
+	void GuillotineTextureAtlas::Clear()
+	{
+		GuillotineImageAtlas::Clear();
+
+		m_arrayLayerCount = 0;
+		m_arrayTexture.Reset();
+	}
+
+	/*!
+	* \brief Gets the size of the layers of the texture array
+	* \return Width and height of a layer, zero if the atlas doesn't use a texture array
 	*/
 
+	unsigned int GuillotineTextureAtlas::GetArrayLayerSize() const
+	{
+		return m_arrayLayerSize;
+	}
+
 	/*!
 	* \brief Gets the underlying data storage
 	* \return Value of the enumeration of the underlying data storage
@@ -24,6 +65,52 @@ namespace Nz
 		return DataStorage_Hardware;
 	}
 
+	/*!
+	* \brief Checks whether the layers of the atlas are put in a texture array
+	* \return true If it is the case
+	*/
+
+	bool GuillotineTextureAtlas::IsUsingTextureArray() const
+	{
+		return m_arrayLayerSize != 0;
+	}
+
+	/*!
+	* \brief Adds a layer to the texture array
+	* \return The new layer
+	*
+	* \remark Produces a NazaraError if the array could not be reallocated
+	*/
+
+	AbstractImage* GuillotineTextureAtlas::AllocateArrayLayer() const
+	{
+		unsigned int layerIndex = m_arrayLayerCount;
+
+		// The size of a texture array can't change, a new one is created with one more layer
+		TextureRef newTexture = Texture::New();
+		if (!newTexture->Create(ImageType_2D_Array, PixelFormatType_A8, m_arrayLayerSize, m_arrayLayerSize, layerIndex + 1))
+			return nullptr;
+
+		// Copy of old data, without going through the system memory
+		if (m_arrayTexture && !newTexture->Copy(m_arrayTexture, Boxui(0, 0, 0, m_arrayLayerSize, m_arrayLayerSize, layerIndex)))
+		{
+			NazaraError("Failed to copy old texture");
+			return nullptr;
+		}
+
+		m_arrayTexture = std::move(newTexture);
+		m_arrayLayerCount++;
+
+		// Layers keep their object, but their texture changed and has to be queued again
+		for (unsigned int i = 0; i < layerIndex; ++i)
+		{
+			AbstractImage* layer = GetLayer(i);
+			OnAtlasLayerChange(this, layer, layer);
+		}
+
+		return new ArrayLayer(this, layerIndex);
+	}
+
 	/*!
 	* \brief Resizes the image
 	* \return Updated texture
@@ -36,6 +123,15 @@ namespace Nz
 
 	AbstractImage* GuillotineTextureAtlas::ResizeImage(AbstractImage* oldImage, const Vector2ui& size) const
 	{
+		if (m_arrayLayerSize != 0)
+		{
+			// Layers of the array are allocated at their final size, the atlas only grows by adding layers
+			if (size.x > m_arrayLayerSize || size.y > m_arrayLayerSize)
+				return nullptr;
+
+			return (oldImage) ? oldImage : AllocateArrayLayer();
+		}
+
 		std::unique_ptr<Texture> newTexture(new Texture);
 		if (newTexture->Create(ImageType_2D, PixelFormatType_A8, size.x, size.y, 1))
 		{
@@ -43,18 +139,10 @@ namespace Nz
 			{
 				Texture* oldTexture = static_cast<Texture*>(oldImage);
 
-				// Copy of old data
-				///TODO: Copy from texture to texture
-				Image image;
-				if (!oldTexture->Download(&image))
-				{
-					NazaraError("Failed to download old texture");
-					return nullptr;
-				}
-
-				if (!newTexture->Update(image, Rectui(0, 0, image.GetWidth(), image.GetHeight())))
+				// Copy of old data, without going through the system memory
+				if (!newTexture->Copy(oldTexture, Boxui(0, 0, 0, oldTexture->GetWidth(), oldTexture->GetHeight(), 1)))
 				{
-					NazaraError("Failed to update texture");
+					NazaraError("Failed to copy old texture");
 					return nullptr;
 				}
 			}
@@ -67,4 +155,117 @@ namespace Nz
 			return nullptr;
 		}
 	}
+
+	/*!
+	* \class Nz::GuillotineTextureAtlas::ArrayLayer
+	* \brief Image representing one layer of the texture array of an atlas
+	*
+	* Its type is ImageType_2D_Array, which allows the users of an atlas to tell it from a texture, its size being the one of a single layer.
+	*/
+
+	/*!
+	* \brief Constructs an ArrayLayer object
+	*
+	* \param atlas Atlas owning the texture array
+	* \param layerIndex Index of the layer in the texture array
+	*/
+
+	GuillotineTextureAtlas::ArrayLayer::ArrayLayer(const GuillotineTextureAtlas* atlas, unsigned int layerIndex) :
+	m_atlas(atlas),
+	m_layerIndex(layerIndex)
+	{
+	}
+
+	unsigned int GuillotineTextureAtlas::ArrayLayer::GetDepth(UInt8 /*level*/) const
+	{
+		return 1;
+	}
+
+	PixelFormatType GuillotineTextureAtlas::ArrayLayer::GetFormat() const
+	{
+		return GetTexture()->GetFormat();
+	}
+
+	unsigned int GuillotineTextureAtlas::ArrayLayer::GetHeight(UInt8 level) const
+	{
+		return GetTexture()->GetHeight(level);
+	}
+
+	/*!
+	* \brief Gets the index of the layer in the texture array
+	* \return Layer index
+	*/
+
+	unsigned int GuillotineTextureAtlas::ArrayLayer::GetLayerIndex() const
+	{
+		return m_layerIndex;
+	}
+
+	UInt8 GuillotineTextureAtlas::ArrayLayer::GetLevelCount() const
+	{
+		return GetTexture()->GetLevelCount();
+	}
+
+	UInt8 GuillotineTextureAtlas::ArrayLayer::GetMaxLevel() const
+	{
+		return GetTexture()->GetMaxLevel();
+	}
+
+	std::size_t GuillotineTextureAtlas::ArrayLayer::GetMemoryUsage() const
+	{
+		Texture* texture = GetTexture();
+		return texture->GetMemoryUsage() / texture->GetDepth();
+	}
+
+	std::size_t GuillotineTextureAtlas::ArrayLayer::GetMemoryUsage(UInt8 level) const
+	{
+		Texture* texture = GetTexture();
+		return texture->GetMemoryUsage(level) / texture->GetDepth(level);
+	}
+
+	Vector3ui GuillotineTextureAtlas::ArrayLayer::GetSize(UInt8 level) const
+	{
+		Texture* texture = GetTexture();
+		return Vector3ui(texture->GetWidth(level), texture->GetHeight(level), 1);
+	}
+
+	/*!
+	* \brief Gets the texture array holding the layer
+	* \return Texture array, which changes when a layer is added to the atlas
+	*/
+
+	Texture* GuillotineTextureAtlas::ArrayLayer::GetTexture() const
+	{
+		return m_atlas->m_arrayTexture;
+	}
+
+	ImageType GuillotineTextureAtlas::ArrayLayer::GetType() const
+	{
+		return ImageType_2D_Array;
+	}
+
+	unsigned int GuillotineTextureAtlas::ArrayLayer::GetWidth(UInt8 level) const
+	{
+		return GetTexture()->GetWidth(level);
+	}
+
+	bool GuillotineTextureAtlas::ArrayLayer::Update(const UInt8* pixels, unsigned int srcWidth, unsigned int srcHeight, UInt8 level)
+	{
+		Texture* texture = GetTexture();
+		return texture->Update(pixels, Boxui(0, 0, m_layerIndex, texture->GetWidth(level), texture->GetHeight(level), 1), srcWidth, srcHeight, level);
+	}
+
+	bool GuillotineTextureAtlas::ArrayLayer::Update(const UInt8* pixels, const Boxui& box, unsigned int srcWidth, unsigned int srcHeight, UInt8 level)
+	{
+		NazaraAssert(box.z == 0 && box.depth == 1, "Box must fit in a single layer");
+
+		return GetTexture()->Update(pixels, Boxui(box.x, box.y, m_layerIndex, box.width, box.height, 1), srcWidth, srcHeight, level);
+	}
+
+	bool GuillotineTextureAtlas::ArrayLayer::Update(const UInt8* pixels, const Rectui& rect, unsigned int z, unsigned int srcWidth, unsigned int srcHeight, UInt8 level)
+	{
+		NazaraAssert(z == 0, "Z must be zero for a single layer");
+
+		return GetTexture()->Update(pixels, rect, m_layerIndex, srcWidth, srcHeight, level);
+	}
 }
@@ -0,0 +1,347 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Graphics/Impostor.hpp>
+#include <Nazara/Core/CallOnExit.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Graphics/AbstractRenderQueue.hpp>
+#include <Nazara/Graphics/AbstractViewer.hpp>
+#include <Nazara/Graphics/ForwardRenderTechnique.hpp>
+#include <Nazara/Graphics/Model.hpp>
+#include <Nazara/Graphics/SceneData.hpp>
+#include <Nazara/Math/Frustum.hpp>
+#include <Nazara/Renderer/Renderer.hpp>
+#include <Nazara/Renderer/RenderTexture.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		// Orthographic viewer of a frame, looking at the model from a direction of the octahedron
+		class BakeViewer : public AbstractViewer
+		{
+			public:
+				BakeViewer(const RenderTarget* target, const Vector3f& eyePosition, const Vector3f& center, const Vector3f& up, float radius, unsigned int frameSize) :
+				m_viewport(0, 0, frameSize, frameSize),
+				m_eyePosition(eyePosition),
+				m_target(target),
+				m_zFar(radius * 3.f),
+				m_zNear(radius)
+				{
+					m_projectionMatrix = Matrix4f::Ortho(-radius, radius, radius, -radius, m_zNear, m_zFar);
+					m_viewMatrix = Matrix4f::LookAt(eyePosition, center, up);
+					m_frustum.Extract(m_viewMatrix, m_projectionMatrix);
+					m_forward = Vector3f::Normalize(center - eyePosition);
+				}
+
+				void ApplyView() const override
+				{
+					Renderer::SetTarget(m_target);
+					Renderer::SetViewport(m_viewport);
+					Renderer::SetMatrix(MatrixType_Projection, m_projectionMatrix);
+					Renderer::SetMatrix(MatrixType_View, m_viewMatrix);
+				}
+
+				float GetAspectRatio() const override
+				{
+					return 1.f;
+				}
+
+				Vector3f GetEyePosition() const override
+				{
+					return m_eyePosition;
+				}
+
+				Vector3f GetForward() const override
+				{
+					return m_forward;
+				}
+
+				const Frustumf& GetFrustum() const override
+				{
+					return m_frustum;
+				}
+
+				const Matrix4f& GetProjectionMatrix() const override
+				{
+					return m_projectionMatrix;
+				}
+
+				ProjectionType GetProjectionType() const override
+				{
+					return ProjectionType_Orthogonal;
+				}
+
+				const RenderTarget* GetTarget() const override
+				{
+					return m_target;
+				}
+
+				const Matrix4f& GetViewMatrix() const override
+				{
+					return m_viewMatrix;
+				}
+
+				const Recti& GetViewport() const override
+				{
+					return m_viewport;
+				}
+
+				float GetZFar() const override
+				{
+					return m_zFar;
+				}
+
+				float GetZNear() const override
+				{
+					return m_zNear;
+				}
+
+			private:
+				Frustumf m_frustum;
+				Matrix4f m_projectionMatrix;
+				Matrix4f m_viewMatrix;
+				Recti m_viewport;
+				Vector3f m_eyePosition;
+				Vector3f m_forward;
+				const RenderTarget* m_target;
+				float m_zFar;
+				float m_zNear;
+		};
+
+		float Sign(float value)
+		{
+			return (value >= 0.f) ? 1.f : -1.f;
+		}
+	}
+
+	/*!
+	* \ingroup graphics
+	* \class Nz::Impostor
+	* \brief Graphics class that represents a model seen from afar, as a billboard picking the picture of the model the closest to the view direction
+	*
+	* The pictures (frames) are taken from directions spread over the whole sphere by an octahedral mapping, before being drawn unlit
+	*
+	* \see Model::SetImpostor
+	*/
+
+	/*!
+	* \brief Adds a frame of the impostor to a render queue
+	*
+	* \param renderQueue Queue to be added
+	* \param frame Index of the frame, which should come from GetFrame
+	* \param transformMatrix Transform matrix of the model
+	* \param renderOrder Specify the render queue layer to be used
+	* \param scissorRect The Scissor rect to uses for rendering
+	*
+	* \remark Produces a NazaraAssert if frame is out of range
+	*/
+	void Impostor::AddToRenderQueue(AbstractRenderQueue* renderQueue, std::size_t frame, const Matrix4f& transformMatrix, int renderOrder, const Recti& scissorRect) const
+	{
+		NazaraAssert(renderQueue, "Invalid render queue");
+		NazaraAssert(frame < m_frameMaterials.size(), "Frame out of range");
+
+		Vector3f scale = transformMatrix.GetScale();
+
+		Vector3f position = transformMatrix.Transform(m_center);
+		Vector2f size(m_radius * 2.f * std::max({scale.x, scale.y, scale.z}));
+		renderQueue->AddBillboards(renderOrder, m_frameMaterials[frame], 1, scissorRect, &position, &size);
+	}
+
+	/*!
+	* \brief Bakes the frames of a model, drawing it offscreen from every direction of the grid
+	* \return true If successful
+	*
+	* \param model Model to bake, using the mesh of its first level of detail and its current skin
+	* \param gridSize Number of frames per side of the octahedron grid, the impostor having its square of frames
+	* \param frameSize Width and height of the texture of each frame
+	*
+	* \remark The renderer must be initialized, and its target and viewport are restored once the frames are drawn
+	* \remark Produces a NazaraError if the model has no mesh or if a frame couldn't be drawn
+	*/
+	bool Impostor::Bake(const Model& model, unsigned int gridSize, unsigned int frameSize)
+	{
+		NazaraAssert(gridSize > 0, "Invalid grid size");
+		NazaraAssert(frameSize > 0, "Invalid frame size");
+
+		Mesh* mesh = model.GetMesh();
+		if (!mesh)
+		{
+			NazaraError("Model has no mesh");
+			return false;
+		}
+
+		const Boxf& aabb = mesh->GetAABB();
+		Vector3f center = aabb.GetCenter();
+		float radius = aabb.GetRadius();
+		if (radius <= 0.f)
+		{
+			NazaraError("Model mesh is empty");
+			return false;
+		}
+
+		RenderTexture renderTexture;
+		if (!renderTexture.Create(true))
+		{
+			NazaraError("Failed to create render texture");
+			return false;
+		}
+
+		if (!renderTexture.AttachBuffer(AttachmentPoint_Depth, 0, PixelFormatType_Depth24, frameSize, frameSize))
+		{
+			NazaraError("Failed to attach depth buffer");
+			return false;
+		}
+
+		renderTexture.Unlock();
+
+		const RenderTarget* previousTarget = Renderer::GetTarget();
+		Recti previousViewport = Renderer::GetViewport();
+		Matrix4f previousProjectionMatrix = Renderer::GetMatrix(MatrixType_Projection);
+		Matrix4f previousViewMatrix = Renderer::GetMatrix(MatrixType_View);
+
+		CallOnExit restoreRenderer([&]()
+		{
+			Renderer::SetTarget(previousTarget);
+			Renderer::SetViewport(previousViewport);
+			Renderer::SetMatrix(MatrixType_Projection, previousProjectionMatrix);
+			Renderer::SetMatrix(MatrixType_View, previousViewMatrix);
+		});
+
+		// Frames are drawn unlit, the ambient color bringing out the diffuse color of the materials
+		ForwardRenderTechnique technique;
+		model.AddToRenderQueue(technique.GetRenderQueue(), Matrix4f::Identity());
+
+		std::vector<MaterialRef> frameMaterials;
+		frameMaterials.reserve(gridSize * gridSize);
+
+		for (unsigned int y = 0; y < gridSize; ++y)
+		{
+			for (unsigned int x = 0; x < gridSize; ++x)
+			{
+				Vector2f coords((x + 0.5f) / gridSize * 2.f - 1.f, (y + 0.5f) / gridSize * 2.f - 1.f);
+				Vector3f direction = DecodeOctahedron(coords);
+
+				// Billboards keep the up axis of the viewer, which follows the up axis of the world but from above and below
+				Vector3f up = (std::abs(direction.y) > 0.99f) ? Vector3f::Forward() : Vector3f::Up();
+
+				TextureRef texture = Texture::New();
+				if (!texture->Create(ImageType_2D, PixelFormatType_RGBA8, frameSize, frameSize))
+				{
+					NazaraError("Failed to create frame texture");
+					return false;
+				}
+
+				if (!renderTexture.AttachTexture(AttachmentPoint_Color, 0, texture))
+				{
+					NazaraError("Failed to attach frame texture");
+					return false;
+				}
+
+				if (!renderTexture.IsComplete())
+				{
+					NazaraError("Incomplete render texture");
+					return false;
+				}
+
+				BakeViewer viewer(&renderTexture, center + direction * (radius * 2.f), center, up, radius, frameSize);
+				viewer.ApplyView();
+
+				Renderer::SetClearColor(0, 0, 0, 0);
+				Renderer::Clear(RendererBuffer_Color | RendererBuffer_Depth);
+
+				SceneData sceneData;
+				sceneData.ambientColor = Color::White;
+				sceneData.background = nullptr;
+				sceneData.globalReflectionTexture = nullptr;
+				sceneData.viewer = &viewer;
+
+				if (!technique.Draw(sceneData))
+				{
+					NazaraError("Failed to draw frame");
+					return false;
+				}
+
+				MaterialRef material = Material::New();
+				material->EnableAlphaTest(true);
+				material->SetAlphaThreshold(0.5f);
+				material->SetDiffuseMap(std::move(texture));
+
+				frameMaterials.emplace_back(std::move(material));
+			}
+		}
+
+		m_center = center;
+		m_frameMaterials = std::move(frameMaterials);
+		m_gridSize = gridSize;
+		m_radius = radius;
+
+		return true;
+	}
+
+	/*!
+	* \brief Gets the frame taken the closest to a view direction
+	* \return Index of the frame
+	*
+	* \param direction Direction from the center of the impostor to the eye, in the space of the model
+	*
+	* \remark Produces a NazaraAssert if the impostor isn't baked
+	*/
+	std::size_t Impostor::GetFrame(const Vector3f& direction) const
+	{
+		NazaraAssert(IsValid(), "Invalid impostor");
+
+		Vector2f coords = EncodeOctahedron(direction);
+
+		unsigned int x = std::min(static_cast<unsigned int>(std::max((coords.x + 1.f) * 0.5f * m_gridSize, 0.f)), m_gridSize - 1);
+		unsigned int y = std::min(static_cast<unsigned int>(std::max((coords.y + 1.f) * 0.5f * m_gridSize, 0.f)), m_gridSize - 1);
+
+		return y * m_gridSize + x;
+	}
+
+	/*!
+	* \brief Gets the direction of a point of the octahedral mapping
+	* \return Unit direction
+	*
+	* \param coords Coordinates of the point, between -1 and 1, the upper hemisphere being mapped to the inner diamond
+	*
+	* \see EncodeOctahedron
+	*/
+	Vector3f Impostor::DecodeOctahedron(const Vector2f& coords)
+	{
+		Vector3f direction(coords.x, 1.f - std::abs(coords.x) - std::abs(coords.y), coords.y);
+		if (direction.y < 0.f)
+		{
+			direction.x = (1.f - std::abs(coords.y)) * Sign(coords.x);
+			direction.z = (1.f - std::abs(coords.x)) * Sign(coords.y);
+		}
+
+		return Vector3f::Normalize(direction);
+	}
+
+	/*!
+	* \brief Maps a direction to the octahedron
+	* \return Coordinates between -1 and 1, the center being the up direction
+	*
+	* \param direction Direction to map, which doesn't have to be normalized
+	*
+	* \see DecodeOctahedron
+	*/
+	Vector2f Impostor::EncodeOctahedron(const Vector3f& direction)
+	{
+		float sum = std::abs(direction.x) + std::abs(direction.y) + std::abs(direction.z);
+		if (sum < std::numeric_limits<float>::epsilon())
+			return Vector2f::Zero();
+
+		Vector3f projected = direction / sum;
+		if (projected.y >= 0.f)
+			return Vector2f(projected.x, projected.z);
+
+		return Vector2f((1.f - std::abs(projected.z)) * Sign(projected.x), (1.f - std::abs(projected.x)) * Sign(projected.z));
+	}
+}
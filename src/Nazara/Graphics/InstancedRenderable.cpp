@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Graphics/InstancedRenderable.hpp>
+#include <Nazara/Graphics/ResidencyManager.hpp>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
@@ -67,6 +68,24 @@ namespace Nz
 		instanceData->flags |= flags;
 	}
 
+	/*!
+	* \brief Requests the streamed resources an instance is drawn with for this frame
+	*
+	* By default, the materials of the current skin are requested
+	*
+	* \param residencyManager Manager streaming the resources
+	* \param instanceData Data of the instance, its level of detail being selected
+	* \param screenSize Height of the instance on screen, in pixels
+	*/
+
+	void InstancedRenderable::RequestResidency(ResidencyManager& residencyManager, const InstanceData& instanceData, float screenSize) const
+	{
+		NazaraUnused(instanceData);
+
+		for (std::size_t i = 0; i < GetMaterialCount(); ++i)
+			residencyManager.Request(GetMaterial(GetSkin(), i), screenSize);
+	}
+
 	/*!
 	* \brief Updates the bounding volume
 	*
@@ -97,5 +116,26 @@ namespace Nz
 		NazaraUnused(instanceData);
 	}
 
+	/*!
+	* \brief Selects the level of detail of an instance
+	* \return true If the level of detail of the instance changed, which requires it to be queued again
+	*
+	* \param instanceData Pointer to data of instances
+	* \param projectedSize Height of the instance on screen, relative to the height of the viewport
+	* \param eyePosition Position of the viewer, in world space
+	*
+	* \remark Produces a NazaraAssert if instanceData is invalid
+	*/
+
+	bool InstancedRenderable::UpdateLevelOfDetail(InstanceData* instanceData, float projectedSize, const Vector3f& eyePosition) const
+	{
+		NazaraAssert(instanceData, "Invalid instance data");
+		NazaraUnused(instanceData);
+		NazaraUnused(projectedSize);
+		NazaraUnused(eyePosition);
+
+		return false;
+	}
+
 	InstancedRenderableLibrary::LibraryMap InstancedRenderable::s_library;
 }
@@ -10,7 +10,6 @@
 #include <Nazara/Math/Sphere.hpp>
 #include <Nazara/Graphics/Debug.hpp>
 
-///TODO: Use of UBOs
 ///TODO: Scale ?
 
 namespace Nz
@@ -28,6 +27,7 @@ namespace Nz
 	*/
 
 	Light::Light(LightType type) :
+	m_shadowCascadeCount(0),
 	m_type(type),
 	m_shadowMapFormat(PixelFormatType_Depth16),
 	m_shadowMapSize(512, 512),
@@ -69,7 +69,20 @@ namespace Nz
 				light.diffuseFactor = m_diffuseFactor;
 				light.direction = transformMatrix.Transform(Vector3f::Forward(), 0.f);
 				light.shadowMap = m_shadowMap.Get();
-				light.transformMatrix = Matrix4f::ViewMatrix(transformMatrix.GetRotation() * Vector3f::Forward() * 100.f, transformMatrix.GetRotation()) * Matrix4f::Ortho(0.f, 100.f, 100.f, 0.f, 1.f, 100.f) * biasMatrix;
+
+				if (m_shadowCascadeCount > 0)
+				{
+					light.transformMatrix = m_shadowViewProjMatrix * biasMatrix;
+					std::copy(m_shadowCascades.begin(), m_shadowCascades.begin() + m_shadowCascadeCount, light.shadowCascades);
+					std::fill(light.shadowCascades + m_shadowCascadeCount, light.shadowCascades + NAZARA_GRAPHICS_MAX_SHADOW_CASCADES, Vector4f::Zero());
+				}
+				else
+				{
+					// A single cascade covering the whole shadow map
+					light.transformMatrix = Matrix4f::ViewMatrix(transformMatrix.GetRotation() * Vector3f::Forward() * 100.f, transformMatrix.GetRotation()) * Matrix4f::Ortho(0.f, 100.f, 100.f, 0.f, 1.f, 100.f) * biasMatrix;
+					std::fill(light.shadowCascades, light.shadowCascades + NAZARA_GRAPHICS_MAX_SHADOW_CASCADES, Vector4f::Zero());
+					light.shadowCascades[0].Set(1.f, 0.f, 0.f, 1.f);
+				}
 
 				renderQueue->AddDirectionalLight(light);
 				break;
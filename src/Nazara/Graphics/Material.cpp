@@ -4,12 +4,76 @@
 
 #include <Nazara/Graphics/Material.hpp>
 #include <Nazara/Core/ErrorFlags.hpp>
+#include <Nazara/Math/Vector4.hpp>
+#include <Nazara/Renderer/CommandBuffer.hpp>
 #include <Nazara/Renderer/Renderer.hpp>
 #include <Nazara/Utility/MaterialData.hpp>
+#include <array>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
 {
+	namespace
+	{
+		// Alpha, diffuse, emissive, height, normal and specular maps
+		constexpr std::size_t BindlessMapCount = 6;
+
+		// std140 layout of the MaterialBlock uniform block
+		struct MaterialBlockData
+		{
+			Vector4f ambient;
+			Vector4f diffuse;
+			Vector4f specular;
+			float alphaThreshold;
+			float shininess;
+			float padding[2];
+			std::array<UInt64, BindlessMapCount> handles; //< Only declared by shaders using bindless textures, as uvec2
+		};
+
+		static_assert(sizeof(MaterialBlockData) == 16 * sizeof(float) + BindlessMapCount * sizeof(UInt64), "MaterialBlockData must match the std140 layout of the block");
+
+		inline UInt64 GetBindlessHandle(const Texture* texture, const TextureSampler& sampler)
+		{
+			if (!texture || !texture->IsValid())
+				return 0;
+
+			// Bindless textures are never bound, mipmaps have to be generated before sampling
+			texture->EnsureMipmapsUpdate();
+
+			return texture->GetBindlessHandle(sampler);
+		}
+
+		inline Vector4f ColorToVector(const Color& color)
+		{
+			return Vector4f(color.r / 255.f, color.g / 255.f, color.b / 255.f, color.a / 255.f);
+		}
+
+		// Binds the material directly to the renderer, like a command buffer executed right away
+		struct ImmediateBinder
+		{
+			void SendColor(const Shader* shader, int location, const Color& color)
+			{
+				shader->SendColor(location, color);
+			}
+
+			void SendFloat(const Shader* shader, int location, float value)
+			{
+				shader->SendFloat(location, value);
+			}
+
+			void SetTexture(unsigned int unit, const Texture* texture, const TextureSampler& sampler)
+			{
+				Renderer::SetTexture(unit, texture);
+				Renderer::SetTextureSampler(unit, sampler);
+			}
+
+			void SetUniformBuffer(unsigned int bindingIndex, const Buffer* buffer)
+			{
+				Renderer::SetUniformBuffer(bindingIndex, buffer);
+			}
+		};
+	}
+
 	/*!
 	* \ingroup graphics
 	* \class Nz::Material
@@ -32,75 +96,13 @@ namespace Nz
 	* \brief Applies shader to the material
 	*
 	* \param instance Pipeline instance to update
-	* \param textureUnit Unit for the texture GL_TEXTURE"i"
-	* \param lastUsedUnit Optional argument to get the last texture unit
 	*/
 	void Material::Apply(const MaterialPipeline::Instance& instance) const
 	{
-		const Shader* shader = instance.renderPipeline.GetInfo().shader;
-
-		if (instance.uniforms[MaterialUniform_AlphaThreshold] != -1)
-			shader->SendFloat(instance.uniforms[MaterialUniform_AlphaThreshold], m_alphaThreshold);
-
-		if (instance.uniforms[MaterialUniform_Ambient] != -1)
-			shader->SendColor(instance.uniforms[MaterialUniform_Ambient], m_ambientColor);
-
-		if (instance.uniforms[MaterialUniform_Diffuse] != -1)
-			shader->SendColor(instance.uniforms[MaterialUniform_Diffuse], m_diffuseColor);
+		Prepare(instance);
 
-		if (instance.uniforms[MaterialUniform_Shininess] != -1)
-			shader->SendFloat(instance.uniforms[MaterialUniform_Shininess], m_shininess);
-
-		if (instance.uniforms[MaterialUniform_Specular] != -1)
-			shader->SendColor(instance.uniforms[MaterialUniform_Specular], m_specularColor);
-
-		if (m_alphaMap && instance.uniforms[MaterialUniform_AlphaMap] != -1)
-		{
-			unsigned int textureUnit = s_textureUnits[TextureMap_Alpha];
-
-			Renderer::SetTexture(textureUnit, m_alphaMap);
-			Renderer::SetTextureSampler(textureUnit, m_diffuseSampler);
-		}
-
-		if (m_diffuseMap && instance.uniforms[MaterialUniform_DiffuseMap] != -1)
-		{
-			unsigned int textureUnit = s_textureUnits[TextureMap_Diffuse];
-
-			Renderer::SetTexture(textureUnit, m_diffuseMap);
-			Renderer::SetTextureSampler(textureUnit, m_diffuseSampler);
-		}
-
-		if (m_emissiveMap && instance.uniforms[MaterialUniform_EmissiveMap] != -1)
-		{
-			unsigned int textureUnit = s_textureUnits[TextureMap_Emissive];
-
-			Renderer::SetTexture(textureUnit, m_emissiveMap);
-			Renderer::SetTextureSampler(textureUnit, m_diffuseSampler);
-		}
-
-		if (m_heightMap && instance.uniforms[MaterialUniform_HeightMap] != -1)
-		{
-			unsigned int textureUnit = s_textureUnits[TextureMap_Height];
-
-			Renderer::SetTexture(textureUnit, m_heightMap);
-			Renderer::SetTextureSampler(textureUnit, m_diffuseSampler);
-		}
-
-		if (m_normalMap && instance.uniforms[MaterialUniform_NormalMap] != -1)
-		{
-			unsigned int textureUnit = s_textureUnits[TextureMap_Normal];
-
-			Renderer::SetTexture(textureUnit, m_normalMap);
-			Renderer::SetTextureSampler(textureUnit, m_diffuseSampler);
-		}
-
-		if (m_specularMap && instance.uniforms[MaterialUniform_SpecularMap] != -1)
-		{
-			unsigned int textureUnit = s_textureUnits[TextureMap_Specular];
-
-			Renderer::SetTexture(textureUnit, m_specularMap);
-			Renderer::SetTextureSampler(textureUnit, m_specularSampler);
-		}
+		ImmediateBinder binder;
+		Bind(instance, binder);
 	}
 
 	/*!
@@ -140,6 +142,9 @@ namespace Nz
 		if (matData.GetColorParameter(MaterialData::DiffuseColor, &color))
 			SetDiffuseColor(color);
 
+		if (matData.GetBooleanParameter(MaterialData::DistanceField, &isEnabled))
+			EnableDistanceField(isEnabled);
+
 		if (matData.GetIntegerParameter(MaterialData::DstBlend, &iValue))
 			SetDstBlend(static_cast<BlendFunc>(iValue));
 
@@ -149,6 +154,9 @@ namespace Nz
 		if (matData.GetDoubleParameter(MaterialData::LineWidth, &dValue))
 			SetLineWidth(float(dValue));
 
+		if (matData.GetBooleanParameter(MaterialData::OrderIndependentTransparency, &isEnabled))
+			EnableOrderIndependentTransparency(isEnabled);
+
 		if (matData.GetDoubleParameter(MaterialData::PointSize, &dValue))
 			SetPointSize(float(dValue));
 
@@ -264,6 +272,80 @@ namespace Nz
 		SetShader(matParams.shaderName);
 	}
 
+	/*!
+	* \brief Uploads the parameters of the material for a pipeline instance, if they changed
+	*
+	* \param instance Pipeline instance the material is about to be recorded with
+	*
+	* \remark This must be called by the render thread, before recording the material in a command buffer
+	*
+	* \see Record
+	*/
+	void Material::Prepare(const MaterialPipeline::Instance& instance) const
+	{
+		if (instance.materialBlock == -1)
+			return;
+
+		// The block is only uploaded when a parameter changed, binding it is all it takes to switch materials
+		if (!m_uniformBuffer)
+		{
+			m_uniformBuffer = Buffer::New(BufferType_Uniform, UInt32(sizeof(MaterialBlockData)), DataStorage_Hardware, BufferUsage_Dynamic);
+			m_uniformBufferUpdated = false;
+		}
+
+		// Textures are sampled through their handles, which change with the textures and their samplers
+		if (instance.bindless)
+		{
+			std::array<UInt64, BindlessMapCount> handles = {
+				{
+					GetBindlessHandle(m_alphaMap,    m_diffuseSampler),
+					GetBindlessHandle(m_diffuseMap,  m_diffuseSampler),
+					GetBindlessHandle(m_emissiveMap, m_diffuseSampler),
+					GetBindlessHandle(m_heightMap,   m_diffuseSampler),
+					GetBindlessHandle(m_normalMap,   m_diffuseSampler),
+					GetBindlessHandle(m_specularMap, m_specularSampler)
+				}
+			};
+
+			if (handles != m_bindlessHandles)
+			{
+				m_bindlessHandles = handles;
+				m_uniformBufferUpdated = false;
+			}
+		}
+
+		if (!m_uniformBufferUpdated)
+		{
+			MaterialBlockData blockData;
+			blockData.ambient = ColorToVector(m_ambientColor);
+			blockData.diffuse = ColorToVector(m_diffuseColor);
+			blockData.specular = ColorToVector(m_specularColor);
+			blockData.alphaThreshold = m_alphaThreshold;
+			blockData.shininess = m_shininess;
+			blockData.padding[0] = 0.f;
+			blockData.padding[1] = 0.f;
+			blockData.handles = m_bindlessHandles;
+
+			m_uniformBuffer->Fill(&blockData, 0, UInt32(sizeof(MaterialBlockData)));
+			m_uniformBufferUpdated = true;
+		}
+	}
+
+	/*!
+	* \brief Records the parameters and textures of the material in a command buffer
+	*
+	* \param commandBuffer Command buffer to record into
+	* \param instance Pipeline instance the material is drawn with, which must have been prepared
+	*
+	* \remark This doesn't touch the renderer, several threads may record materials at the same time once they're prepared
+	*
+	* \see Prepare
+	*/
+	void Material::Record(CommandBuffer& commandBuffer, const MaterialPipeline::Instance& instance) const
+	{
+		Bind(instance, commandBuffer);
+	}
+
 	/*!
 	* \brief Builds a ParameterList with material data
 	*
@@ -280,9 +362,11 @@ namespace Nz
 		matData->SetParameter(MaterialData::DepthFunc, static_cast<long long>(GetDepthFunc()));
 		matData->SetParameter(MaterialData::DepthSorting, IsDepthSortingEnabled());
 		matData->SetParameter(MaterialData::DiffuseColor, GetDiffuseColor());
+		matData->SetParameter(MaterialData::DistanceField, IsDistanceFieldEnabled());
 		matData->SetParameter(MaterialData::DstBlend, static_cast<long long>(GetDstBlend()));
 		matData->SetParameter(MaterialData::FaceFilling, static_cast<long long>(GetFaceFilling()));
 		matData->SetParameter(MaterialData::LineWidth, GetLineWidth());
+		matData->SetParameter(MaterialData::OrderIndependentTransparency, IsOrderIndependentTransparencyEnabled());
 		matData->SetParameter(MaterialData::PointSize, GetPointSize());
 		matData->SetParameter(MaterialData::Shininess, GetShininess());
 		matData->SetParameter(MaterialData::SpecularColor, GetSpecularColor());
@@ -396,12 +480,69 @@ namespace Nz
 		m_pipelineInfo.depthBuffer = true;
 		m_pipelineInfo.faceCulling = true;
 		m_reflectionSize = 256;
+		m_uniformBufferUpdated = false;
+
+		m_bindlessHandles.fill(0);
 
 		SetShader("Basic");
 
 		InvalidatePipeline();
 	}
 
+	/*!
+	* \brief Binds the parameters and textures of the material, either to the renderer or to a command buffer
+	*
+	* \param instance Pipeline instance the material is drawn with
+	* \param target Object receiving the bindings
+	*/
+	template<typename T>
+	void Material::Bind(const MaterialPipeline::Instance& instance, T& target) const
+	{
+		const Shader* shader = instance.renderPipeline.GetInfo().shader;
+
+		if (instance.materialBlock != -1)
+			target.SetUniformBuffer(UniformBlock_Material, m_uniformBuffer);
+		else
+		{
+			if (instance.uniforms[MaterialUniform_AlphaThreshold] != -1)
+				target.SendFloat(shader, instance.uniforms[MaterialUniform_AlphaThreshold], m_alphaThreshold);
+
+			if (instance.uniforms[MaterialUniform_Ambient] != -1)
+				target.SendColor(shader, instance.uniforms[MaterialUniform_Ambient], m_ambientColor);
+
+			if (instance.uniforms[MaterialUniform_Diffuse] != -1)
+				target.SendColor(shader, instance.uniforms[MaterialUniform_Diffuse], m_diffuseColor);
+
+			if (instance.uniforms[MaterialUniform_Shininess] != -1)
+				target.SendFloat(shader, instance.uniforms[MaterialUniform_Shininess], m_shininess);
+
+			if (instance.uniforms[MaterialUniform_Specular] != -1)
+				target.SendColor(shader, instance.uniforms[MaterialUniform_Specular], m_specularColor);
+		}
+
+		// Bindless shaders read the handles of the textures from the material block
+		if (instance.bindless)
+			return;
+
+		if (m_alphaMap && instance.uniforms[MaterialUniform_AlphaMap] != -1)
+			target.SetTexture(s_textureUnits[TextureMap_Alpha], m_alphaMap, m_diffuseSampler);
+
+		if (m_diffuseMap && instance.uniforms[MaterialUniform_DiffuseMap] != -1)
+			target.SetTexture(s_textureUnits[TextureMap_Diffuse], m_diffuseMap, m_diffuseSampler);
+
+		if (m_emissiveMap && instance.uniforms[MaterialUniform_EmissiveMap] != -1)
+			target.SetTexture(s_textureUnits[TextureMap_Emissive], m_emissiveMap, m_diffuseSampler);
+
+		if (m_heightMap && instance.uniforms[MaterialUniform_HeightMap] != -1)
+			target.SetTexture(s_textureUnits[TextureMap_Height], m_heightMap, m_diffuseSampler);
+
+		if (m_normalMap && instance.uniforms[MaterialUniform_NormalMap] != -1)
+			target.SetTexture(s_textureUnits[TextureMap_Normal], m_normalMap, m_diffuseSampler);
+
+		if (m_specularMap && instance.uniforms[MaterialUniform_SpecularMap] != -1)
+			target.SetTexture(s_textureUnits[TextureMap_Specular], m_specularMap, m_specularSampler);
+	}
+
 	/*!
 	* \brief Copies the other material
 	*
@@ -429,6 +570,9 @@ namespace Nz
 		m_normalMap     = material.m_normalMap;
 		m_specularMap   = material.m_specularMap;
 
+		// The uniform buffer is never shared, it only has to be filled again with the new parameters
+		m_uniformBufferUpdated = false;
+
 		InvalidatePipeline();
 	}
 
@@ -473,6 +617,7 @@ namespace Nz
 		s_textureUnits[TextureMap_ShadowCube_2]   = textureUnit++;
 		s_textureUnits[TextureMap_Shadow2D_3]     = textureUnit++;
 		s_textureUnits[TextureMap_ShadowCube_3]   = textureUnit++;
+		s_textureUnits[TextureMap_LightClusters]  = textureUnit++;
 
 		return true;
 	}
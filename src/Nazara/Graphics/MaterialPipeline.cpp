@@ -5,7 +5,10 @@
 #include <Nazara/Graphics/MaterialPipeline.hpp>
 #include <Nazara/Core/File.hpp>
 #include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/ReadLockGuard.hpp>
+#include <Nazara/Core/WriteLockGuard.hpp>
 #include <Nazara/Graphics/Material.hpp>
+#include <Nazara/Renderer/Renderer.hpp>
 #include <Nazara/Renderer/UberShaderPreprocessor.hpp>
 #include <Nazara/Graphics/Debug.hpp>
 
@@ -58,15 +61,64 @@ namespace Nz
 	* \brief Graphics class used to contains all rendering states that are not allowed to change individually on rendering devices
 	*/
 
+	/*!
+	* \brief Enables the asynchronous compilation of the shaders of the pipelines
+	*
+	* When enabled, a pipeline instance whose shader is not built yet starts its compilation in the background (if the driver supports KHR_parallel_shader_compile)
+	* and renders with the simplest permutation of the uber shader, keeping only the shader flags, until it is ready.
+	* This avoids hitches when new content appears, at the cost of a few frames rendered without textures.
+	*
+	* \param enable Should the compilation be asynchronous
+	*
+	* \remark Disabled by default
+	*/
+	void MaterialPipeline::EnableAsynchronousCompilation(bool enable)
+	{
+		s_asynchronousCompilation = enable;
+	}
+
+	/*!
+	* \brief Gets the number of pipeline instances generated so far
+	* \return Counters of generated instances, since the initialization or the last call to ResetGenerationStats
+	*
+	* A non-zero runtimeCount after loading a level means some permutations were missing from its PrecompileAll call.
+	*/
+	MaterialPipeline::GenerationStats MaterialPipeline::GetGenerationStats()
+	{
+		GenerationStats stats;
+		{
+			ReadLockGuard lock(s_pipelineCacheLock);
+			stats.pipelineCount = s_pipelineCache.size();
+		}
+
+		stats.precompiledCount = s_precompiledCount;
+		stats.runtimeCount = s_runtimeCount;
+
+		return stats;
+	}
+
 	/*!
 	* \brief Returns a reference to a MaterialPipeline built with MaterialPipelineInfo
 	*
 	* This function is using a cache, calling it multiples times with the same MaterialPipelineInfo will returns references to a single MaterialPipeline
 	*
 	* \param pipelineInfo Pipeline informations used to build/retrieve a MaterialPipeline object
+	*
+	* \remark The cache can be used by multiple threads, lookups of cached pipelines don't wait for each other
 	*/
 	MaterialPipelineRef MaterialPipeline::GetPipeline(const MaterialPipelineInfo& pipelineInfo)
 	{
+		{
+			ReadLockGuard lock(s_pipelineCacheLock);
+
+			auto it = s_pipelineCache.find(pipelineInfo);
+			if (it != s_pipelineCache.end())
+				return it->second;
+		}
+
+		WriteLockGuard lock(s_pipelineCacheLock);
+
+		// Another thread may have created the pipeline since the lookup
 		auto it = s_pipelineCache.find(pipelineInfo);
 		if (it == s_pipelineCache.end())
 			it = s_pipelineCache.insert(it, PipelineCache::value_type(pipelineInfo, New(pipelineInfo)));
@@ -74,17 +126,73 @@ namespace Nz
 		return it->second;
 	}
 
-	void MaterialPipeline::GenerateRenderPipeline(UInt32 flags) const
+	/*!
+	* \brief Checks whether the shaders of the pipelines are compiled asynchronously
+	* \return true If asynchronous compilation is enabled
+	*
+	* \see EnableAsynchronousCompilation
+	*/
+	bool MaterialPipeline::IsAsynchronousCompilationEnabled()
+	{
+		return s_asynchronousCompilation;
+	}
+
+	/*!
+	* \brief Generates the pipeline instance of shader flags ahead of its first use
+	*
+	* The shader is compiled synchronously (even with asynchronous compilation), so the instance never uses a fallback afterward.
+	*
+	* \param flags Shader flags
+	*/
+	void MaterialPipeline::Precompile(UInt32 flags) const
+	{
+		const Instance& instance = m_instances[flags];
+		if (!instance.uberInstance || instance.pending)
+			GenerateRenderPipeline(flags, true);
+	}
+
+	/*!
+	* \brief Generates the pipeline instances of every cached pipeline for shader flags
+	*
+	* This is meant to be called while loading a level, once its materials are created, to build all the permutations its rendering will need.
+	*
+	* \param flags Shader flags of the permutations to build (for example ShaderFlags_Deferred and ShaderFlags_Deferred | ShaderFlags_Instancing)
+	*
+	* \see Precompile
+	*/
+	void MaterialPipeline::PrecompileAll(const std::vector<UInt32>& flags)
+	{
+		ReadLockGuard lock(s_pipelineCacheLock);
+		for (const auto& pair : s_pipelineCache)
+		{
+			for (UInt32 flag : flags)
+				pair.second->Precompile(flag);
+		}
+	}
+
+	/*!
+	* \brief Resets the counters returned by GetGenerationStats
+	*/
+	void MaterialPipeline::ResetGenerationStats()
+	{
+		s_precompiledCount = 0;
+		s_runtimeCount = 0;
+	}
+
+	void MaterialPipeline::GenerateRenderPipeline(UInt32 flags, bool precompile) const
 	{
 		NazaraAssert(m_pipelineInfo.uberShader, "Material pipeline has no uber shader");
 
 		ParameterList list;
 		list.SetParameter("ALPHA_MAPPING",      m_pipelineInfo.hasAlphaMap);
 		list.SetParameter("ALPHA_TEST",         m_pipelineInfo.alphaTest);
+		list.SetParameter("BINDLESS_TEXTURES",  Renderer::HasCapability(RendererCap_BindlessTextures));
 		list.SetParameter("COMPUTE_TBNMATRIX",  m_pipelineInfo.hasNormalMap || m_pipelineInfo.hasHeightMap);
 		list.SetParameter("DIFFUSE_MAPPING",    m_pipelineInfo.hasDiffuseMap);
+		list.SetParameter("DISTANCE_FIELD",     m_pipelineInfo.distanceField);
 		list.SetParameter("EMISSIVE_MAPPING",   m_pipelineInfo.hasEmissiveMap);
 		list.SetParameter("NORMAL_MAPPING",     m_pipelineInfo.hasNormalMap);
+		list.SetParameter("ORDER_INDEPENDENT_TRANSPARENCY", m_pipelineInfo.orderIndependentTransparency);
 		list.SetParameter("PARALLAX_MAPPING",   m_pipelineInfo.hasHeightMap);
 		list.SetParameter("REFLECTION_MAPPING", m_pipelineInfo.reflectionMapping);
 		list.SetParameter("SHADOW_MAPPING",     m_pipelineInfo.shadowReceive);
@@ -94,18 +202,62 @@ namespace Nz
 		                                        m_pipelineInfo.reflectionMapping || flags & ShaderFlags_TextureOverlay);
 		list.SetParameter("TRANSFORM",          true);
 
-		list.SetParameter("FLAG_BILLBOARD",      static_cast<bool>((flags & ShaderFlags_Billboard) != 0));
-		list.SetParameter("FLAG_DEFERRED",       static_cast<bool>((flags & ShaderFlags_Deferred) != 0));
-		list.SetParameter("FLAG_INSTANCING",     static_cast<bool>((flags & ShaderFlags_Instancing) != 0));
-		list.SetParameter("FLAG_TEXTUREOVERLAY", static_cast<bool>((flags & ShaderFlags_TextureOverlay) != 0));
-		list.SetParameter("FLAG_VERTEXCOLOR",    static_cast<bool>((flags & ShaderFlags_VertexColor) != 0));
+		list.SetParameter("FLAG_BILLBOARD",            static_cast<bool>((flags & ShaderFlags_Billboard) != 0));
+		list.SetParameter("FLAG_CLUSTEREDLIGHTING",    static_cast<bool>((flags & ShaderFlags_ClusteredLighting) != 0));
+		list.SetParameter("FLAG_DEFERRED",             static_cast<bool>((flags & ShaderFlags_Deferred) != 0));
+		list.SetParameter("FLAG_INSTANCING",           static_cast<bool>((flags & ShaderFlags_Instancing) != 0));
+		list.SetParameter("FLAG_SKINNING",             static_cast<bool>((flags & ShaderFlags_Skinning) != 0));
+		list.SetParameter("FLAG_SPRITE",               static_cast<bool>((flags & ShaderFlags_Sprite) != 0));
+		list.SetParameter("FLAG_TEXTUREOVERLAY",       static_cast<bool>((flags & ShaderFlags_TextureOverlay) != 0));
+		list.SetParameter("FLAG_TEXTUREOVERLAY_ARRAY", static_cast<bool>((flags & ShaderFlags_TextureOverlayArray) != 0));
+		list.SetParameter("FLAG_VERTEXCOLOR",          static_cast<bool>((flags & ShaderFlags_VertexColor) != 0));
 
 		Instance& instance = m_instances[flags];
-		instance.uberInstance = m_pipelineInfo.uberShader->Get(list);
+
+		// Retries of pending instances aren't counted, only their first generation is
+		if (precompile)
+			s_precompiledCount++;
+		else if (!instance.uberInstance)
+			s_runtimeCount++;
+
+		UberShaderInstance* uberInstance = (s_asynchronousCompilation && !precompile) ? m_pipelineInfo.uberShader->TryGet(list) : m_pipelineInfo.uberShader->Get(list);
+		if (!uberInstance)
+		{
+			// Still being compiled, the fallback is kept until then
+			if (instance.pending)
+				return;
+
+			// Only the shader flags are kept, as they change the vertex inputs and the render targets
+			ParameterList fallbackList;
+			fallbackList.SetParameter("FLAG_BILLBOARD",      static_cast<bool>((flags & ShaderFlags_Billboard) != 0));
+			fallbackList.SetParameter("FLAG_DEFERRED",       static_cast<bool>((flags & ShaderFlags_Deferred) != 0));
+			fallbackList.SetParameter("FLAG_INSTANCING",     static_cast<bool>((flags & ShaderFlags_Instancing) != 0));
+			fallbackList.SetParameter("FLAG_SKINNING",       static_cast<bool>((flags & ShaderFlags_Skinning) != 0));
+			fallbackList.SetParameter("FLAG_SPRITE",         static_cast<bool>((flags & ShaderFlags_Sprite) != 0));
+			fallbackList.SetParameter("FLAG_VERTEXCOLOR",    static_cast<bool>((flags & ShaderFlags_VertexColor) != 0));
+			fallbackList.SetParameter("ORDER_INDEPENDENT_TRANSPARENCY", m_pipelineInfo.orderIndependentTransparency);
+			fallbackList.SetParameter("TRANSFORM",           true);
+
+			uberInstance = m_pipelineInfo.uberShader->Get(fallbackList);
+			instance.pending = true;
+		}
+		else
+			instance.pending = false;
+
+		instance.uberInstance = uberInstance;
 
 		RenderPipelineInfo renderPipelineInfo;
 		static_cast<RenderStates&>(renderPipelineInfo).operator=(m_pipelineInfo); // Not my proudest line
 
+		// Transparent surfaces are summed in the accumulation targets of the forward technique, whatever the blending of the material
+		if (m_pipelineInfo.orderIndependentTransparency)
+		{
+			renderPipelineInfo.blending = true;
+			renderPipelineInfo.depthWrite = false;
+			renderPipelineInfo.dstBlend = BlendFunc_One;
+			renderPipelineInfo.srcBlend = BlendFunc_One;
+		}
+
 		renderPipelineInfo.shader = instance.uberInstance->GetShader();
 
 		instance.renderPipeline.Create(renderPipelineInfo);
@@ -126,6 +278,16 @@ namespace Nz
 
 		#undef CacheUniform
 
+		// Color and scalar parameters of the material are read from a uniform block when the shader declares one
+		instance.materialBlock = renderPipelineInfo.shader->GetUniformBlockIndex("MaterialBlock");
+		renderPipelineInfo.shader->SetUniformBlockBinding(instance.materialBlock, UniformBlock_Material);
+
+		// Shaders reading the handles of the maps from the block don't declare their samplers, custom shaders may still do so
+		instance.bindless = Renderer::HasCapability(RendererCap_BindlessTextures) && instance.materialBlock != -1 &&
+		                    instance.uniforms[MaterialUniform_AlphaMap] == -1  && instance.uniforms[MaterialUniform_DiffuseMap] == -1 &&
+		                    instance.uniforms[MaterialUniform_EmissiveMap] == -1 && instance.uniforms[MaterialUniform_HeightMap] == -1 &&
+		                    instance.uniforms[MaterialUniform_NormalMap] == -1 && instance.uniforms[MaterialUniform_SpecularMap] == -1;
+
 		// Send texture units (those never changes)
 		renderPipelineInfo.shader->SendInteger(instance.uniforms[MaterialUniform_AlphaMap],    Material::GetTextureUnit(TextureMap_Alpha));
 		renderPipelineInfo.shader->SendInteger(instance.uniforms[MaterialUniform_DiffuseMap],  Material::GetTextureUnit(TextureMap_Diffuse));
@@ -144,6 +306,8 @@ namespace Nz
 		renderPipelineInfo.shader->SendInteger(renderPipelineInfo.shader->GetUniformLocation("PointLightShadowMap[0]"), Material::GetTextureUnit(TextureMap_ShadowCube_1));
 		renderPipelineInfo.shader->SendInteger(renderPipelineInfo.shader->GetUniformLocation("PointLightShadowMap[1]"), Material::GetTextureUnit(TextureMap_ShadowCube_2));
 		renderPipelineInfo.shader->SendInteger(renderPipelineInfo.shader->GetUniformLocation("PointLightShadowMap[2]"), Material::GetTextureUnit(TextureMap_ShadowCube_3));
+
+		renderPipelineInfo.shader->SendInteger(renderPipelineInfo.shader->GetUniformLocation("LightClusters"), Material::GetTextureUnit(TextureMap_LightClusters));
 	}
 
 	bool MaterialPipeline::Initialize()
@@ -160,8 +324,8 @@ namespace Nz
 			OverrideShader("Shaders/Basic/core.vert", &vertexShader);
 			#endif
 
-			uberShader->SetShader(ShaderStageType_Fragment, fragmentShader, "FLAG_TEXTUREOVERLAY ALPHA_MAPPING ALPHA_TEST AUTO_TEXCOORDS DIFFUSE_MAPPING TEXTURE_MAPPING");
-			uberShader->SetShader(ShaderStageType_Vertex, vertexShader, "FLAG_BILLBOARD FLAG_INSTANCING FLAG_VERTEXCOLOR TEXTURE_MAPPING TRANSFORM UNIFORM_VERTEX_DEPTH");
+			uberShader->SetShader(ShaderStageType_Fragment, fragmentShader, "FLAG_TEXTUREOVERLAY FLAG_TEXTUREOVERLAY_ARRAY ALPHA_MAPPING ALPHA_TEST AUTO_TEXCOORDS BINDLESS_TEXTURES DIFFUSE_MAPPING DISTANCE_FIELD ORDER_INDEPENDENT_TRANSPARENCY TEXTURE_MAPPING");
+			uberShader->SetShader(ShaderStageType_Vertex, vertexShader, "FLAG_BILLBOARD FLAG_INSTANCING FLAG_SKINNING FLAG_SPRITE FLAG_TEXTUREOVERLAY_ARRAY FLAG_VERTEXCOLOR TEXTURE_MAPPING TRANSFORM UNIFORM_VERTEX_DEPTH");
 
 			UberShaderLibrary::Register("Basic", uberShader);
 		}
@@ -178,8 +342,8 @@ namespace Nz
 			OverrideShader("Shaders/PhongLighting/core.vert", &vertexShader);
 			#endif
 
-			uberShader->SetShader(ShaderStageType_Fragment, fragmentShader, "FLAG_DEFERRED FLAG_TEXTUREOVERLAY ALPHA_MAPPING ALPHA_TEST AUTO_TEXCOORDS DIFFUSE_MAPPING EMISSIVE_MAPPING NORMAL_MAPPING PARALLAX_MAPPING REFLECTION_MAPPING SHADOW_MAPPING SPECULAR_MAPPING");
-			uberShader->SetShader(ShaderStageType_Vertex, vertexShader, "FLAG_BILLBOARD FLAG_DEFERRED FLAG_INSTANCING FLAG_VERTEXCOLOR COMPUTE_TBNMATRIX PARALLAX_MAPPING SHADOW_MAPPING TEXTURE_MAPPING TRANSFORM UNIFORM_VERTEX_DEPTH");
+			uberShader->SetShader(ShaderStageType_Fragment, fragmentShader, "FLAG_CLUSTEREDLIGHTING FLAG_DEFERRED FLAG_TEXTUREOVERLAY FLAG_TEXTUREOVERLAY_ARRAY ALPHA_MAPPING ALPHA_TEST AUTO_TEXCOORDS BINDLESS_TEXTURES DIFFUSE_MAPPING EMISSIVE_MAPPING NORMAL_MAPPING ORDER_INDEPENDENT_TRANSPARENCY PARALLAX_MAPPING REFLECTION_MAPPING SHADOW_MAPPING SPECULAR_MAPPING");
+			uberShader->SetShader(ShaderStageType_Vertex, vertexShader, "FLAG_BILLBOARD FLAG_DEFERRED FLAG_INSTANCING FLAG_SKINNING FLAG_SPRITE FLAG_TEXTUREOVERLAY_ARRAY FLAG_VERTEXCOLOR COMPUTE_TBNMATRIX PARALLAX_MAPPING SHADOW_MAPPING TEXTURE_MAPPING TRANSFORM UNIFORM_VERTEX_DEPTH");
 
 			UberShaderLibrary::Register("PhongLighting", uberShader);
 		}
@@ -206,6 +370,13 @@ namespace Nz
 
 		MaterialPipelineLibrary::Register("Translucent2D", GetPipeline(pipelineInfo));
 
+		// Translucent distance field 2D - Same as translucent 2D, with overlays being the signed distance fields of distance field fonts
+		pipelineInfo.distanceField = true;
+
+		MaterialPipelineLibrary::Register("TranslucentDistanceField2D", GetPipeline(pipelineInfo));
+
+		pipelineInfo.distanceField = false;
+
 		// Translucent 3D - Alpha blending with depth buffer and no depth write/face culling
 		pipelineInfo.blending = true;
 		pipelineInfo.depthBuffer = true;
@@ -223,7 +394,12 @@ namespace Nz
 
 	void MaterialPipeline::Uninitialize()
 	{
-		s_pipelineCache.clear();
+		{
+			WriteLockGuard lock(s_pipelineCacheLock);
+			s_pipelineCache.clear();
+		}
+
+		ResetGenerationStats();
 		UberShaderLibrary::Unregister("PhongLighting");
 		UberShaderLibrary::Unregister("Basic");
 		MaterialPipelineLibrary::Uninitialize();
@@ -231,4 +407,8 @@ namespace Nz
 
 	MaterialPipelineLibrary::LibraryMap MaterialPipeline::s_library;
 	MaterialPipeline::PipelineCache MaterialPipeline::s_pipelineCache;
+	ReadWriteLock MaterialPipeline::s_pipelineCacheLock;
+	bool MaterialPipeline::s_asynchronousCompilation = false;
+	UInt64 MaterialPipeline::s_precompiledCount = 0;
+	UInt64 MaterialPipeline::s_runtimeCount = 0;
 }
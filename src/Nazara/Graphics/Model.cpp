@@ -5,17 +5,30 @@
 #include <Nazara/Graphics/Model.hpp>
 #include <Nazara/Graphics/AbstractRenderQueue.hpp>
 #include <Nazara/Graphics/Config.hpp>
+#include <Nazara/Graphics/ResidencyManager.hpp>
 #include <Nazara/Utility/MeshData.hpp>
 #include <Nazara/Utility/StaticMesh.hpp>
+#include <algorithm>
+#include <limits>
 #include <memory>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
 {
+	namespace
+	{
+		// Going back to a more detailed level requires to be a bit bigger than its limit, to avoid switching every frame around it
+		constexpr float LevelOfDetailHysteresis = 1.1f;
+	}
+
 	/*!
 	* \ingroup graphics
 	* \class Nz::Model
 	* \brief Graphics class that represents a model
+	*
+	* A model may have levels of detail, simpler meshes replacing its mesh once it gets small on screen, and an impostor replacing it even further.
+	* The level of each instance is selected by UpdateLevelOfDetail, from the size it's projected to.
+	* Levels past the last mesh level are the frames of the impostor, picked from the direction the instance is seen from.
 	*/
 
 	/*!
@@ -45,23 +58,67 @@ namespace Nz
 	*/
 	Model::~Model() = default;
 
+	/*!
+	* \brief Adds a level of detail to the model
+	* \return true If successful
+	*
+	* \param mesh Mesh drawn instead of the mesh of the model, it must use the same materials and have the same animation type (and skeleton) as it, nullptr to stop drawing the model
+	* \param projectedSize Height on screen, relative to the height of the viewport, below which this level is used
+	*
+	* \remark Levels are kept sorted by decreasing size, whichever the order they are added in
+	* \remark Produces a NazaraError if the model has no mesh or if the mesh doesn't match it
+	*/
+
+	bool Model::AddLevelOfDetail(Mesh* mesh, float projectedSize)
+	{
+		if (!m_mesh)
+		{
+			NazaraError("Model has no mesh");
+			return false;
+		}
+
+		if (mesh && !CheckLevelOfDetail(mesh))
+			return false;
+
+		LevelOfDetail levelOfDetail;
+		levelOfDetail.mesh = mesh;
+		levelOfDetail.projectedSize = projectedSize;
+
+		auto it = std::upper_bound(m_levelsOfDetail.begin(), m_levelsOfDetail.end(), projectedSize, [](float size, const LevelOfDetail& level) { return size > level.projectedSize; });
+		m_levelsOfDetail.insert(it, std::move(levelOfDetail));
+
+		return true;
+	}
+
 	/*!
 	* \brief Adds this model to the render queue
 	*
 	* \param renderQueue Queue to be added
-	* \param instanceData Data used for this instance
+	* \param instanceData Data used for this instance, selecting its level of detail
 	*/
 
 	void Model::AddToRenderQueue(AbstractRenderQueue* renderQueue, const InstanceData& instanceData, const Recti& scissorRect) const
 	{
-		unsigned int submeshCount = m_mesh->GetSubMeshCount();
+		if (m_impostor && instanceData.levelOfDetail > m_levelsOfDetail.size())
+		{
+			m_impostor->AddToRenderQueue(renderQueue, instanceData.levelOfDetail - m_levelsOfDetail.size() - 1, instanceData.transformMatrix, instanceData.renderOrder, scissorRect);
+			return;
+		}
+
+		const Mesh* levelMesh = GetLevelOfDetailMesh(std::min(instanceData.levelOfDetail, m_levelsOfDetail.size()));
+		if (!levelMesh)
+			return;
+
+		unsigned int submeshCount = levelMesh->GetSubMeshCount();
 		for (unsigned int i = 0; i < submeshCount; ++i)
 		{
-			const StaticMesh* mesh = static_cast<const StaticMesh*>(m_mesh->GetSubMesh(i));
+			const StaticMesh* mesh = static_cast<const StaticMesh*>(levelMesh->GetSubMesh(i));
 			const MaterialRef& material = GetMaterial(mesh->GetMaterialIndex());
 
 			MeshData meshData;
 			meshData.indexBuffer = mesh->GetIndexBuffer();
+			meshData.meshletCount = mesh->GetMeshlets().size();
+			meshData.meshlets = mesh->GetMeshlets().data();
 			meshData.primitiveMode = mesh->GetPrimitiveMode();
 			meshData.vertexBuffer = mesh->GetVertexBuffer();
 
@@ -69,6 +126,48 @@ namespace Nz
 		}
 	}
 
+	/*!
+	* \brief Removes the levels of detail and the impostor of the model, which is then always drawn with its mesh
+	*/
+
+	void Model::ClearLevelsOfDetail()
+	{
+		m_impostor.Reset();
+		m_levelsOfDetail.clear();
+	}
+
+	/*!
+	* \brief Gets the mesh of a level of detail
+	* \return Mesh of the level, which may be null if the model isn't drawn at this level
+	*
+	* \param level Index of the level, zero being the mesh of the model
+	*
+	* \remark Produces a NazaraAssert if level is out of range
+	*/
+
+	Mesh* Model::GetLevelOfDetailMesh(std::size_t level) const
+	{
+		NazaraAssert(level < GetLevelOfDetailCount(), "Level out of range");
+
+		return (level == 0) ? m_mesh : m_levelsOfDetail[level - 1].mesh;
+	}
+
+	/*!
+	* \brief Gets the size below which a level of detail is used
+	* \return Height on screen, relative to the height of the viewport, infinity for the mesh of the model
+	*
+	* \param level Index of the level, zero being the mesh of the model
+	*
+	* \remark Produces a NazaraAssert if level is out of range
+	*/
+
+	float Model::GetLevelOfDetailSize(std::size_t level) const
+	{
+		NazaraAssert(level < GetLevelOfDetailCount(), "Level out of range");
+
+		return (level == 0) ? std::numeric_limits<float>::infinity() : m_levelsOfDetail[level - 1].projectedSize;
+	}
+
 	/*!
 	* \brief Gets the material of the named submesh
 	* \return Pointer to the current material
@@ -182,6 +281,25 @@ namespace Nz
 		return ModelLoader::LoadFromStream(this, stream, params);
 	}
 
+	/*!
+	* \brief Requests the materials and the mesh of the level of detail of an instance for this frame
+	*
+	* \param residencyManager Manager streaming the resources
+	* \param instanceData Data of the instance
+	* \param screenSize Height of the instance on screen, in pixels
+	*
+	* \remark Nothing is requested while the instance is drawn as an impostor
+	*/
+
+	void Model::RequestResidency(ResidencyManager& residencyManager, const InstanceData& instanceData, float screenSize) const
+	{
+		if (instanceData.levelOfDetail >= GetLevelOfDetailCount())
+			return;
+
+		InstancedRenderable::RequestResidency(residencyManager, instanceData, screenSize);
+		residencyManager.Request(this, instanceData.levelOfDetail, screenSize);
+	}
+
 	/*!
 	* \brief Sets the material of the named submesh
 	* \return true If successful
@@ -206,6 +324,85 @@ namespace Nz
 		return true;
 	}
 
+	/*!
+	* \brief Sets the impostor drawn instead of the model once it gets small on screen
+	* \return true If successful
+	*
+	* \param impostor Impostor baked from this model (see Impostor::Bake), nullptr to remove it
+	* \param projectedSize Height on screen, relative to the height of the viewport, below which the impostor is used
+	*
+	* \remark Levels of detail not drawing the model still apply below the impostor size
+	* \remark Produces a NazaraError if the model has no mesh, if its mesh is animated or if the impostor isn't baked
+	*/
+	bool Model::SetImpostor(ImpostorRef impostor, float projectedSize)
+	{
+		if (impostor)
+		{
+			if (!m_mesh)
+			{
+				NazaraError("Model has no mesh");
+				return false;
+			}
+
+			if (m_mesh->IsAnimable())
+			{
+				NazaraError("Animated models cannot be drawn as impostors");
+				return false;
+			}
+
+			if (!impostor->IsValid())
+			{
+				NazaraError("Impostor is not baked");
+				return false;
+			}
+		}
+
+		m_impostor = std::move(impostor);
+		m_impostorSize = projectedSize;
+
+		return true;
+	}
+
+	/*!
+	* \brief Replaces the mesh of a level of detail, keeping its size and the materials of the model
+	* \return true If successful
+	*
+	* \param level Index of the level, zero being the mesh of the model
+	* \param mesh Mesh drawn at this level, which must match the model like in AddLevelOfDetail, nullptr to stop drawing the model (except for level zero)
+	*
+	* \remark Unlike SetMesh, replacing the mesh of the model keeps its levels of detail and impostor
+	* \remark Produces a NazaraAssert if level is out of range
+	* \remark Produces a NazaraError if the mesh doesn't match the model
+	*
+	* \see ResidencyManager::StreamLevelOfDetail
+	*/
+
+	bool Model::SetLevelOfDetailMesh(std::size_t level, Mesh* mesh)
+	{
+		NazaraAssert(level < GetLevelOfDetailCount(), "Level out of range");
+
+		if (level == 0 && !mesh)
+		{
+			NazaraError("The mesh of the model cannot be null");
+			return false;
+		}
+
+		if (mesh && !CheckLevelOfDetail(mesh))
+			return false;
+
+		if (level == 0)
+		{
+			m_mesh = mesh;
+			InvalidateBoundingVolume();
+		}
+		else
+			m_levelsOfDetail[level - 1].mesh = mesh;
+
+		InvalidateInstanceData(0);
+
+		return true;
+	}
+
 	/*!
 	* \brief Sets the material by index of the named submesh
 	* \return true If successful
@@ -236,6 +433,7 @@ namespace Nz
 	*
 	* \param pointer to the mesh
 	*
+	* \remark The levels of detail of the previous mesh are removed
 	* \remark Produces a NazaraError with NAZARA_GRAPHICS_SAFE defined if mesh is invalid
 	*/
 
@@ -249,7 +447,9 @@ namespace Nz
 		}
 		#endif
 
+		m_impostor.Reset();
 		m_mesh = mesh;
+		m_levelsOfDetail.clear();
 
 		if (m_mesh)
 			ResetMaterials(mesh->GetMaterialCount());
@@ -259,6 +459,102 @@ namespace Nz
 		InvalidateBoundingVolume();
 	}
 
+	/*!
+	* \brief Selects the level of detail of an instance
+	* \return true If the level of detail of the instance changed
+	*
+	* \param instanceData Data of the instance
+	* \param projectedSize Height of the instance on screen, relative to the height of the viewport
+	* \param eyePosition Position of the viewer, in world space, selecting the frame of the impostor
+	*/
+
+	bool Model::UpdateLevelOfDetail(InstanceData* instanceData, float projectedSize, const Vector3f& eyePosition) const
+	{
+		NazaraAssert(instanceData, "Invalid instance data");
+
+		std::size_t level = 0;
+		for (std::size_t i = 0; i < m_levelsOfDetail.size(); ++i)
+		{
+			float limit = m_levelsOfDetail[i].projectedSize;
+			if (instanceData->levelOfDetail > i)
+				limit *= LevelOfDetailHysteresis;
+
+			if (projectedSize >= limit)
+				break;
+
+			level = i + 1;
+		}
+
+		// Smaller than its impostor size, a model still drawn is replaced by the frame of its impostor seen from the eye
+		if (m_impostor && GetLevelOfDetailMesh(level))
+		{
+			float limit = m_impostorSize;
+			if (instanceData->levelOfDetail > m_levelsOfDetail.size())
+				limit *= LevelOfDetailHysteresis;
+
+			if (projectedSize < limit)
+			{
+				Matrix4f inverseMatrix;
+				if (!instanceData->transformMatrix.GetInverseAffine(&inverseMatrix))
+					inverseMatrix.MakeIdentity();
+
+				level = m_levelsOfDetail.size() + 1 + m_impostor->GetFrame(inverseMatrix.Transform(eyePosition) - m_impostor->GetCenter());
+			}
+		}
+
+		if (instanceData->levelOfDetail == level)
+			return false;
+
+		instanceData->levelOfDetail = level;
+		return true;
+	}
+
+	/*!
+	* \brief Checks whether a mesh can be drawn as a level of detail of the model
+	* \return true If the mesh matches the model
+	*
+	* \param mesh Mesh to check
+	*
+	* \remark Produces a NazaraError if the model has no mesh or if the mesh doesn't match it
+	*/
+
+	bool Model::CheckLevelOfDetail(const Mesh* mesh) const
+	{
+		NazaraAssert(mesh, "Invalid mesh");
+
+		if (!m_mesh)
+		{
+			NazaraError("Model has no mesh");
+			return false;
+		}
+
+		if (!mesh->IsValid())
+		{
+			NazaraError("Invalid mesh");
+			return false;
+		}
+
+		if (mesh->GetAnimationType() != m_mesh->GetAnimationType())
+		{
+			NazaraError("Level of detail animation type must match mesh animation type");
+			return false;
+		}
+
+		if (mesh->GetAnimationType() == AnimationType_Skeletal && mesh->GetJointCount() != m_mesh->GetJointCount())
+		{
+			NazaraError("Level of detail joint count must match mesh joint count");
+			return false;
+		}
+
+		if (mesh->GetMaterialCount() > GetMaterialCount())
+		{
+			NazaraError("Level of detail uses more materials than the model");
+			return false;
+		}
+
+		return true;
+	}
+
 	/*
 	* \brief Makes the bounding volume of this billboard
 	*/
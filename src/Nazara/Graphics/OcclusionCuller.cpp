@@ -0,0 +1,229 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Graphics/OcclusionCuller.hpp>
+#include <Nazara/Core/ErrorFlags.hpp>
+#include <Nazara/Graphics/AbstractViewer.hpp>
+#include <Nazara/Renderer/Renderer.hpp>
+#include <Nazara/Renderer/RenderStates.hpp>
+#include <Nazara/Renderer/Shader.hpp>
+#include <Nazara/Utility/IndexBuffer.hpp>
+#include <Nazara/Utility/VertexBuffer.hpp>
+#include <Nazara/Utility/VertexDeclaration.hpp>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		static IndexBufferRef s_indexBuffer;
+		static RenderStates s_renderStates;
+		static ShaderRef s_shader;
+		static VertexBufferRef s_vertexBuffer;
+	}
+
+	/*!
+	* \ingroup graphics
+	* \class Nz::OcclusionCuller
+	* \brief Graphics class that skips objects hidden behind others, using the occlusion queries of the previous frame
+	*
+	* Once the scene is drawn, the bounding box of every object which passed frustum culling is drawn against the depth buffer, inside an occlusion query.
+	* The next frame, objects whose query found no sample are not queued, results still being computed by the GPU are not waited for.
+	* An object appearing from behind an occluder is therefore drawn one or two frames late.
+	*
+	* \remark The depth buffer of the current target must hold the depth of the scene when calling Process, which isn't the case of the deferred render technique
+	*/
+
+	/*!
+	* \brief Constructs an OcclusionCuller object
+	*/
+
+	OcclusionCuller::OcclusionCuller() :
+	m_frameIndex(1)
+	{
+	}
+
+	/*!
+	* \brief Forgets every object and its query
+	*/
+
+	void OcclusionCuller::Clear()
+	{
+		m_entries.clear();
+		m_tests.clear();
+	}
+
+	/*!
+	* \brief Forgets an object and releases its query
+	*
+	* \param object Object to forget, its address may be reused by another object afterwards
+	*/
+
+	void OcclusionCuller::Forget(const void* object)
+	{
+		m_entries.erase(object);
+	}
+
+	/*!
+	* \brief Reads the results of the previous tests and draws the tests queued since the last call
+	* \return true if the visibility of an object changed, which requires its render queue to be rebuilt
+	*
+	* \param viewer Viewer the tests are made for, it must be the one whose matrices are active
+	*
+	* \remark Render states, shader, buffers and world matrix of the Renderer are changed
+	*/
+
+	bool OcclusionCuller::Process(const AbstractViewer& viewer)
+	{
+		bool visibilityChanged = false;
+
+		for (auto& pair : m_entries)
+		{
+			Entry& entry = pair.second;
+			if (entry.pending && entry.query->IsResultAvailable())
+			{
+				bool visible = (entry.query->GetResult() != 0);
+				if (entry.visible != visible)
+				{
+					entry.visible = visible;
+					visibilityChanged = true;
+				}
+
+				entry.pending = false;
+			}
+		}
+
+		if (!m_tests.empty())
+		{
+			Renderer::SetIndexBuffer(s_indexBuffer);
+			Renderer::SetRenderStates(s_renderStates);
+			Renderer::SetShader(s_shader);
+			Renderer::SetVertexBuffer(s_vertexBuffer);
+
+			GpuQueryMode queryMode = (GpuQuery::IsModeSupported(GpuQueryMode_AnySamplesPassedConservative)) ? GpuQueryMode_AnySamplesPassedConservative : GpuQueryMode_AnySamplesPassed;
+
+			// A box containing the eye would be clipped by the near plane and could be found hidden
+			Vector3f eyePosition = viewer.GetEyePosition();
+			float nearMargin = viewer.GetZNear() * 2.f;
+
+			for (const Test& test : m_tests)
+			{
+				Entry& entry = m_entries[test.object];
+				entry.lastTestFrame = m_frameIndex;
+
+				// The previous result of this object is still being computed
+				if (entry.pending)
+					continue;
+
+				Boxf safeBox(test.aabb.x - nearMargin, test.aabb.y - nearMargin, test.aabb.z - nearMargin, test.aabb.width + nearMargin * 2.f, test.aabb.height + nearMargin * 2.f, test.aabb.depth + nearMargin * 2.f);
+				if (safeBox.Contains(eyePosition))
+				{
+					if (!entry.visible)
+					{
+						entry.visible = true;
+						visibilityChanged = true;
+					}
+
+					continue;
+				}
+
+				if (!entry.query)
+					entry.query = std::make_unique<GpuQuery>();
+
+				Renderer::SetMatrix(MatrixType_World, Matrix4f::Transform(test.aabb.GetPosition(), Quaternionf::Identity(), test.aabb.GetLengths()));
+
+				entry.query->Begin(queryMode);
+				Renderer::DrawIndexedPrimitives(PrimitiveMode_TriangleList, 0, 36);
+				entry.query->End();
+
+				entry.pending = true;
+			}
+
+			m_tests.clear();
+		}
+
+		m_frameIndex++;
+
+		return visibilityChanged;
+	}
+
+	/*!
+	* \brief Initializes the occlusion culler
+	* \return true If successful
+	*
+	* \remark Produces a NazaraError if one of the resources could not be created
+	*/
+
+	bool OcclusionCuller::Initialize()
+	{
+		const UInt16 indices[6 * 6] =
+		{
+			0, 1, 2, 0, 2, 3,
+			3, 2, 6, 3, 6, 7,
+			7, 6, 5, 7, 5, 4,
+			4, 5, 1, 4, 1, 0,
+			0, 3, 7, 0, 7, 4,
+			1, 6, 2, 1, 5, 6
+		};
+
+		// Unit box, scaled and moved to the bounding box of each object
+		const float vertices[8 * 3] =
+		{
+			0.f, 1.f, 1.f,
+			0.f, 0.f, 1.f,
+			1.f, 0.f, 1.f,
+			1.f, 1.f, 1.f,
+			0.f, 1.f, 0.f,
+			0.f, 0.f, 0.f,
+			1.f, 0.f, 0.f,
+			1.f, 1.f, 0.f,
+		};
+
+		try
+		{
+			ErrorFlags flags(ErrorFlag_ThrowException, true);
+
+			// Index buffer
+			IndexBufferRef indexBuffer = IndexBuffer::New(false, 36, DataStorage_Hardware, 0);
+			indexBuffer->Fill(indices, 0, 36);
+
+			// Vertex buffer
+			VertexBufferRef vertexBuffer = VertexBuffer::New(VertexDeclaration::Get(VertexLayout_XYZ), 8, DataStorage_Hardware, 0);
+			vertexBuffer->Fill(vertices, 0, 8);
+
+			// Shader, only the depth test matters
+			ShaderRef shader = ShaderLibrary::Get("DebugSimple");
+
+			// Renderstates, boxes are tested against the depth buffer without changing any pixel
+			s_renderStates.colorWrite = false;
+			s_renderStates.depthBuffer = true;
+			s_renderStates.depthFunc = RendererComparison_LessOrEqual;
+			s_renderStates.depthWrite = false;
+			s_renderStates.faceCulling = false;
+
+			// Exception-free zone
+			s_indexBuffer = std::move(indexBuffer);
+			s_shader = std::move(shader);
+			s_vertexBuffer = std::move(vertexBuffer);
+		}
+		catch (const std::exception& e)
+		{
+			NazaraError("Failed to initialise: " + String(e.what()));
+			return false;
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Uninitializes the occlusion culler
+	*/
+
+	void OcclusionCuller::Uninitialize()
+	{
+		s_indexBuffer.Reset();
+		s_shader.Reset();
+		s_vertexBuffer.Reset();
+	}
+}
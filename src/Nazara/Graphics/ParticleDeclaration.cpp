@@ -254,6 +254,13 @@ namespace Nz
 			case ComponentType_Int4:
 			case ComponentType_Quaternion:
 				return true;
+
+			// Particles are processed by the CPU through SparsePtr
+			case ComponentType_Half2:
+			case ComponentType_Half4:
+			case ComponentType_PackedNormal:
+			case ComponentType_UShortNorm2:
+				return false;
 		}
 
 		NazaraError("Component type not handled (0x" + String::Number(type, 16) + ')');
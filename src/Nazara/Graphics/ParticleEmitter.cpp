@@ -78,8 +78,9 @@ namespace Nz
 					return;
 
 				// And we emit our particles
-				void* particles = system.GenerateParticles(particleCount);
-				ParticleMapper mapper(particles, system.GetDeclaration());
+				std::size_t firstParticle = system.GetParticleCount();
+				system.GenerateParticles(particleCount);
+				ParticleMapper mapper = system.GetParticleMapper(firstParticle);
 
 				SetupParticles(mapper, particleCount);
 
@@ -11,6 +11,8 @@ namespace Nz
 	* \ingroup graphics
 	* \class Nz::ParticleFunctionController
 	* \brief Helper class used to provide a function as a particle controller without going in the process of making a new class
+	*
+	* \remark Standard behaviors (movement, gravity, drag, ...) are faster with a ParticleBehaviorController, which applies them in a single inlined loop
 	*/
 
 	/*!
@@ -6,7 +6,17 @@
 #include <Nazara/Core/CallOnExit.hpp>
 #include <Nazara/Core/ErrorFlags.hpp>
 #include <Nazara/Core/StringStream.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Graphics/ParticleMapper.hpp>
+#include <Nazara/Utility/Utility.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(NAZARA_SIMD_SSE2)
+	#include <emmintrin.h>
+#endif
+
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
@@ -22,10 +32,11 @@ namespace Nz
 	*
 	* \param maxParticleCount Maximum number of particles to generate
 	* \param layout Enumeration for the layout of data information for the particles
+	* \param storage Layout of the particles in memory
 	*/
 
-	ParticleGroup::ParticleGroup(unsigned int maxParticleCount, ParticleLayout layout) :
-	ParticleGroup(maxParticleCount, ParticleDeclaration::Get(layout))
+	ParticleGroup::ParticleGroup(unsigned int maxParticleCount, ParticleLayout layout, ParticleStorage storage) :
+	ParticleGroup(maxParticleCount, ParticleDeclaration::Get(layout), storage)
 	{
 	}
 
@@ -34,12 +45,17 @@ namespace Nz
 	*
 	* \param maxParticleCount Maximum number of particles to generate
 	* \param declaration Data information for the particles
+	* \param storage Layout of the particles in memory, a separated storage makes each component contiguous which is better suited for controllers processing many particles
 	*/
 
-	ParticleGroup::ParticleGroup(unsigned int maxParticleCount, ParticleDeclarationConstRef declaration) :
+	ParticleGroup::ParticleGroup(unsigned int maxParticleCount, ParticleDeclarationConstRef declaration, ParticleStorage storage) :
 	m_maxParticleCount(maxParticleCount),
 	m_particleCount(0),
 	m_declaration(std::move(declaration)),
+	m_storage(storage),
+	m_particleBoundsValid(false),
+	m_parallelProcessing(false),
+	m_parallelUpdate(false),
 	m_processing(false)
 	{
 		// In case of error, the constructor can only throw an exception
@@ -48,6 +64,9 @@ namespace Nz
 		m_particleSize = m_declaration->GetStride(); // The size of each particle
 
 		ResizeBuffer();
+		UpdateComponentArrays();
+
+		InvalidateBoundingVolume();
 	}
 
 	/*!
@@ -61,10 +80,15 @@ namespace Nz
 	m_maxParticleCount(system.m_maxParticleCount),
 	m_particleCount(system.m_particleCount),
 	m_particleSize(system.m_particleSize),
+	m_componentArrays(system.m_componentArrays),
 	m_controllers(system.m_controllers),
 	m_generators(system.m_generators),
 	m_declaration(system.m_declaration),
 	m_renderer(system.m_renderer),
+	m_storage(system.m_storage),
+	m_particleBoundsValid(false),
+	m_parallelProcessing(false),
+	m_parallelUpdate(system.m_parallelUpdate),
 	m_processing(false)
 	{
 		ErrorFlags flags(ErrorFlag_ThrowException, true);
@@ -72,7 +96,9 @@ namespace Nz
 		ResizeBuffer();
 
 		// We only copy alive particles
-		std::memcpy(m_buffer.data(), system.m_buffer.data(), system.m_particleCount*m_particleSize);
+		CopyParticles(system.m_buffer.data(), system.m_particleCount);
+
+		InvalidateBoundingVolume();
 	}
 
 	ParticleGroup::~ParticleGroup()
@@ -147,7 +173,7 @@ namespace Nz
 
 		if (m_particleCount > 0)
 		{
-			ParticleMapper mapper(m_buffer.data(), m_declaration);
+			ParticleMapper mapper = GetParticleMapper();
 			m_renderer->Render(*this, mapper, 0, m_particleCount - 1, renderQueue);
 		}
 	}
@@ -202,6 +228,8 @@ namespace Nz
 	/*!
 	* \brief Creates multiple particles
 	* \return Pointer to the first particle memory buffer
+	*
+	* \remark With a separated storage, the returned pointer is the beginning of the buffer, use GetParticleMapper to access the particles
 	*/
 
 	void* ParticleGroup::CreateParticles(unsigned int count)
@@ -215,7 +243,30 @@ namespace Nz
 		std::size_t particlesIndex = m_particleCount;
 		m_particleCount += count;
 
-		return &m_buffer[particlesIndex * m_particleSize];
+		// The new particles are not set up yet, their bounds will be computed when needed
+		m_particleBoundsValid = false;
+		InvalidateBoundingVolume();
+
+		if (m_storage == ParticleStorage_Separated)
+			return m_buffer.data();
+		else
+			return &m_buffer[particlesIndex * m_particleSize];
+	}
+
+	/*!
+	* \brief Enables the parallel application of the controllers
+	*
+	* When enabled, particles are split in chunks processed by the TaskScheduler, each chunk applying every controller to its particles and compacting its dead particles.
+	*
+	* \param parallelUpdate Should the controllers be applied in parallel
+	*
+	* \remark Controllers must support being called concurrently on distinct ranges, and may only kill particles of the range they were given
+	* \remark The relative order of the particles is kept during the compaction, while a sequential update moves the last particles in place of the dead ones
+	*/
+
+	void ParticleGroup::EnableParallelUpdate(bool parallelUpdate)
+	{
+		m_parallelUpdate = parallelUpdate;
 	}
 
 	/*!
@@ -235,11 +286,13 @@ namespace Nz
 
 	void* ParticleGroup::GenerateParticles(unsigned int count)
 	{
+		std::size_t firstParticle = m_particleCount;
+
 		void* ptr = CreateParticles(count);
 		if (!ptr)
 			return nullptr;
 
-		ParticleMapper mapper(ptr, m_declaration);
+		ParticleMapper mapper = GetParticleMapper(firstParticle);
 		for (ParticleGenerator* generator : m_generators)
 			generator->Generate(*this, mapper, 0, count - 1);
 
@@ -303,9 +356,19 @@ namespace Nz
 			return;
 		}
 
+		if (m_parallelProcessing)
+		{
+			// Each chunk owns its range of particles, flagging them is safe and the chunk will compact them itself
+			m_dyingFlags[index] = 1;
+			return;
+		}
+
 		// We move the last alive particle to the place of this one
-		if (--m_particleCount > 0)
-			std::memcpy(&m_buffer[index * m_particleSize], &m_buffer[m_particleCount * m_particleSize], m_particleSize);
+		if (--m_particleCount > 0 && index != m_particleCount)
+			MoveParticles(m_particleCount, index, 1);
+
+		m_particleBoundsValid = false;
+		InvalidateBoundingVolume();
 	}
 
 	/*!
@@ -315,6 +378,9 @@ namespace Nz
 	void ParticleGroup::KillParticles()
 	{
 		m_particleCount = 0;
+
+		m_particleBoundsValid = false;
+		InvalidateBoundingVolume();
 	}
 
 	/*!
@@ -375,6 +441,8 @@ namespace Nz
 	/*!
 	* \brief Updates the system
 	*
+	* The bounds of the particles are computed along the controllers, while they are still in the cache
+	*
 	* \param elapsedTime Delta time between the previous frame
 	*/
 
@@ -387,10 +455,22 @@ namespace Nz
 		// Update
 		if (m_particleCount > 0)
 		{
-			///TODO: Update using threads
-			ParticleMapper mapper(m_buffer.data(), m_declaration);
-			ApplyControllers(mapper, m_particleCount, elapsedTime);
+			if (m_parallelUpdate && !m_controllers.empty())
+				ApplyControllersParallel(elapsedTime);
+			else
+			{
+				ParticleMapper mapper = GetParticleMapper();
+				ApplyControllers(mapper, m_particleCount, elapsedTime);
+
+				if (m_particleCount > 0)
+				{
+					m_particleBounds = ComputeBounds(0, m_particleCount);
+					m_particleBoundsValid = true;
+				}
+			}
 		}
+
+		InvalidateBoundingVolume();
 	}
 
 	/*!
@@ -420,32 +500,265 @@ namespace Nz
 		m_controllers = system.m_controllers;
 		m_declaration = system.m_declaration;
 		m_generators = system.m_generators;
+		m_componentArrays = system.m_componentArrays;
 		m_maxParticleCount = system.m_maxParticleCount;
+		m_parallelUpdate = system.m_parallelUpdate;
 		m_particleCount = system.m_particleCount;
 		m_particleSize = system.m_particleSize;
 		m_renderer = system.m_renderer;
+		m_storage = system.m_storage;
 
 		// The copy can not (or should not) happen during the update, there is no use to copy
 		m_dyingParticles.clear();
+		m_parallelProcessing = false;
 		m_processing = false;
 
 		m_buffer.clear(); // To avoid a copy due to resize() which will be pointless
 		ResizeBuffer();
 
 		// We only copy alive particles
-		std::memcpy(m_buffer.data(), system.m_buffer.data(), system.m_particleCount * m_particleSize);
+		CopyParticles(system.m_buffer.data(), system.m_particleCount);
+
+		m_particleBoundsValid = false;
+		InvalidateBoundingVolume();
 
 		return *this;
 	}
 
 	/*!
-	* \brief Makes the bounding volume of this text
+	* \brief Applies the controllers over chunks of particles, in parallel
+	*
+	* Every chunk applies all the controllers to its particles then moves its alive particles to its beginning,
+	* the alive parts of each chunk are then gathered together.
+	*
+	* \param elapsedTime Delta time between the previous frame
+	*/
+
+	void ParticleGroup::ApplyControllersParallel(float elapsedTime)
+	{
+		// Below this count of particles per chunk, the scheduling cost is bigger than the update
+		constexpr std::size_t MinGrainSize = 256;
+
+		std::size_t particleCount = m_particleCount;
+		std::size_t grainSize = std::max(particleCount / (TaskScheduler::GetWorkerCount() * 4), MinGrainSize);
+		std::size_t chunkCount = (particleCount + grainSize - 1) / grainSize;
+
+		m_chunkAliveCounts.resize(chunkCount);
+		m_chunkBounds.resize(chunkCount);
+		m_dyingFlags.resize(particleCount);
+
+		m_parallelProcessing = true;
+		m_processing = true;
+
+		// To avoid a lock in case of exception
+		CallOnExit onExit([this]()
+		{
+			m_parallelProcessing = false;
+			m_processing = false;
+		});
+
+		TaskScheduler::ParallelFor(0, particleCount, grainSize, [&](std::size_t first, std::size_t last)
+		{
+			std::fill(m_dyingFlags.begin() + first, m_dyingFlags.begin() + last, UInt8(0));
+
+			ParticleMapper mapper = GetParticleMapper();
+			for (ParticleController* controller : m_controllers)
+				controller->Apply(*this, mapper, static_cast<unsigned int>(first), static_cast<unsigned int>(last - 1), elapsedTime);
+
+			// Compact the chunk, keeping the order of its alive particles
+			std::size_t aliveIndex = first;
+			for (std::size_t i = first; i < last; ++i)
+			{
+				if (m_dyingFlags[i])
+					continue;
+
+				if (aliveIndex != i)
+					MoveParticles(i, aliveIndex, 1);
+
+				aliveIndex++;
+			}
+
+			std::size_t chunkIndex = first / grainSize;
+			m_chunkAliveCounts[chunkIndex] = aliveIndex - first;
+			m_chunkBounds[chunkIndex] = ComputeBounds(first, aliveIndex - first);
+		});
+
+		onExit.CallAndReset();
+
+		// Gather the alive particles of every chunk after the ones of the first chunk, and merge their bounds
+		std::size_t aliveCount = m_chunkAliveCounts[0];
+		ParticleBounds bounds = m_chunkBounds[0];
+		for (std::size_t i = 1; i < chunkCount; ++i)
+		{
+			std::size_t chunkAliveCount = m_chunkAliveCounts[i];
+			if (chunkAliveCount > 0 && aliveCount != i * grainSize)
+				MoveParticles(i * grainSize, aliveCount, chunkAliveCount);
+
+			const ParticleBounds& chunkBounds = m_chunkBounds[i];
+			bounds.max.Maximize(chunkBounds.max);
+			bounds.min.Minimize(chunkBounds.min);
+			bounds.maxSquaredSize = std::max(bounds.maxSquaredSize, chunkBounds.maxSquaredSize);
+
+			aliveCount += chunkAliveCount;
+		}
+
+		m_particleCount = aliveCount;
+		m_particleBounds = bounds;
+		m_particleBoundsValid = true;
+	}
+
+	/*!
+	* \brief Computes the bounds of a range of particles
+	* \return Bounds of the positions and biggest size, empty (min over max) if there is no particle or no position
+	*
+	* \param firstParticle Index of the first particle
+	* \param particleCount Number of particles
+	*/
+
+	ParticleGroup::ParticleBounds ParticleGroup::ComputeBounds(std::size_t firstParticle, std::size_t particleCount) const
+	{
+		constexpr float infinity = std::numeric_limits<float>::infinity();
+
+		ParticleBounds bounds;
+		bounds.max.Set(-infinity);
+		bounds.min.Set(infinity);
+		bounds.maxSquaredSize = 0.f;
+
+		bool enabled;
+		ComponentType type;
+		std::size_t offset;
+		m_declaration->GetComponent(ParticleComponent_Position, &enabled, &type, &offset);
+		if (!enabled || type != ComponentType_Float3 || particleCount == 0)
+			return bounds;
+
+		const ParticleMapper mapper = GetParticleMapper(firstParticle);
+		SparsePtr<const Vector3f> positionPtr = mapper.GetComponentPtr<Vector3f>(ParticleComponent_Position);
+
+		#if defined(NAZARA_SIMD_SSE2)
+		__m128 maxPosition = _mm_set1_ps(-infinity);
+		__m128 minPosition = _mm_set1_ps(infinity);
+		for (std::size_t i = 0; i < particleCount; ++i)
+		{
+			const Vector3f& position = positionPtr[i];
+			__m128 value = _mm_setr_ps(position.x, position.y, position.z, 0.f);
+
+			maxPosition = _mm_max_ps(maxPosition, value);
+			minPosition = _mm_min_ps(minPosition, value);
+		}
+
+		alignas(16) float values[4];
+		_mm_store_ps(values, maxPosition);
+		bounds.max.Set(values[0], values[1], values[2]);
+
+		_mm_store_ps(values, minPosition);
+		bounds.min.Set(values[0], values[1], values[2]);
+		#else
+		for (std::size_t i = 0; i < particleCount; ++i)
+		{
+			const Vector3f& position = positionPtr[i];
+			bounds.max.Maximize(position);
+			bounds.min.Minimize(position);
+		}
+		#endif
+
+		// A billboard may turn around its position, its diagonal is what matters
+		m_declaration->GetComponent(ParticleComponent_Size, &enabled, &type, &offset);
+		if (enabled && type == ComponentType_Float2)
+		{
+			SparsePtr<const Vector2f> sizePtr = mapper.GetComponentPtr<Vector2f>(ParticleComponent_Size);
+			for (std::size_t i = 0; i < particleCount; ++i)
+				bounds.maxSquaredSize = std::max(bounds.maxSquaredSize, sizePtr[i].GetSquaredLength());
+		}
+
+		return bounds;
+	}
+
+	/*!
+	* \brief Copies the particles of another buffer sharing the same declaration, storage and maximum particle count
+	*
+	* \param buffer Buffer to copy the particles from
+	* \param particleCount Number of particles to copy
+	*/
+
+	void ParticleGroup::CopyParticles(const UInt8* buffer, std::size_t particleCount)
+	{
+		if (particleCount == 0)
+			return;
+
+		if (m_storage == ParticleStorage_Separated)
+		{
+			for (const ComponentArray& componentArray : m_componentArrays)
+			{
+				std::size_t arrayOffset = componentArray.offset * m_maxParticleCount;
+				std::memcpy(&m_buffer[arrayOffset], &buffer[arrayOffset], particleCount * componentArray.size);
+			}
+		}
+		else
+			std::memcpy(m_buffer.data(), buffer, particleCount * m_particleSize);
+	}
+
+	/*!
+	* \brief Makes the bounding volume of the particles
+	*
+	* The bounds computed by the last update are used, unless particles were created or killed since then
+	*
+	* \remark Without a Float3 position, the volume is infinite
+	* \remark The size of the particles is taken into account, but not the extent of the models drawn by a ParticleLayout_Model group
 	*/
 
 	void ParticleGroup::MakeBoundingVolume() const
 	{
-		///TODO: Compute the AABB (taking into account the size of particles)
-		m_boundingVolume.MakeInfinite();
+		bool enabled;
+		ComponentType type;
+		std::size_t offset;
+		m_declaration->GetComponent(ParticleComponent_Position, &enabled, &type, &offset);
+		if (!enabled || type != ComponentType_Float3)
+		{
+			m_boundingVolume.MakeInfinite();
+			return;
+		}
+
+		if (m_particleCount == 0)
+		{
+			m_boundingVolume.MakeNull();
+			return;
+		}
+
+		if (!m_particleBoundsValid)
+		{
+			m_particleBounds = ComputeBounds(0, m_particleCount);
+			m_particleBoundsValid = true;
+		}
+
+		float margin = std::sqrt(m_particleBounds.maxSquaredSize) * 0.5f;
+		Vector3f min = m_particleBounds.min - Vector3f(margin);
+		Vector3f max = m_particleBounds.max + Vector3f(margin);
+
+		// Particles are in world space, the local box is the final one
+		m_boundingVolume.Set(Boxf(min, max));
+		m_boundingVolume.Update(Vector3f::Zero());
+	}
+
+	/*!
+	* \brief Moves particles to another place of the buffer
+	*
+	* \param srcIndex Index of the first particle to move
+	* \param dstIndex Index where the particles will be moved
+	* \param count Number of particles to move, source and destination ranges may overlap
+	*/
+
+	void ParticleGroup::MoveParticles(std::size_t srcIndex, std::size_t dstIndex, std::size_t count)
+	{
+		if (m_storage == ParticleStorage_Separated)
+		{
+			for (const ComponentArray& componentArray : m_componentArrays)
+			{
+				UInt8* componentPtr = &m_buffer[componentArray.offset * m_maxParticleCount];
+				std::memmove(componentPtr + dstIndex * componentArray.size, componentPtr + srcIndex * componentArray.size, count * componentArray.size);
+			}
+		}
+		else
+			std::memmove(&m_buffer[dstIndex * m_particleSize], &m_buffer[srcIndex * m_particleSize], count * m_particleSize);
 	}
 
 	void ParticleGroup::OnEmitterMove(ParticleEmitter* oldEmitter, ParticleEmitter* newEmitter)
@@ -489,4 +802,23 @@ namespace Nz
 			NazaraError(stream.ToString());
 		}
 	}
+
+	/*!
+	* \brief Updates the list of enabled components, used to move particles of a separated storage
+	*/
+
+	void ParticleGroup::UpdateComponentArrays()
+	{
+		m_componentArrays.clear();
+		for (unsigned int i = 0; i <= ParticleComponent_Max; ++i)
+		{
+			bool enabled;
+			ComponentType type;
+			std::size_t offset;
+			m_declaration->GetComponent(static_cast<ParticleComponent>(i), &enabled, &type, &offset);
+
+			if (enabled)
+				m_componentArrays.push_back({offset, Utility::ComponentStride[type]});
+		}
+	}
 }
@@ -21,9 +21,33 @@ namespace Nz
 	*/
 
 	ParticleMapper::ParticleMapper(void* buffer, const ParticleDeclaration* declaration) :
+	ParticleMapper(buffer, declaration, ParticleStorage_Interleaved, 0, 0)
+	{
+	}
+
+	/*!
+	* \brief Constructs a ParticleMapper object with a buffer of the whole particle group
+	*
+	* \param buffer Raw buffer of the particle group
+	* \param declaration Declaration of the particle
+	* \param storage Layout of the particle buffer
+	* \param maxParticleCount Number of particles the buffer can hold, required to locate components arrays of a separated storage
+	* \param firstParticle Index of the particle which will be accessed through index zero of the mapper
+	*/
+
+	ParticleMapper::ParticleMapper(void* buffer, const ParticleDeclaration* declaration, ParticleStorage storage, std::size_t maxParticleCount, std::size_t firstParticle) :
 	m_declaration(declaration),
+	m_storage(storage),
+	m_firstParticle(firstParticle),
+	m_maxParticleCount(maxParticleCount),
 	m_ptr(static_cast<UInt8*>(buffer))
 	{
+		if (m_storage == ParticleStorage_Interleaved)
+		{
+			// Interleaved particles only need the pointer to the first one
+			m_ptr += m_firstParticle * m_declaration->GetStride();
+			m_firstParticle = 0;
+		}
 	}
 
 	ParticleMapper::~ParticleMapper() = default;
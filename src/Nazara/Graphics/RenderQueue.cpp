@@ -4,15 +4,62 @@
 
 #include <Nazara/Graphics/RenderQueue.hpp>
 #include <Nazara/Core/TaskScheduler.hpp>
+#include <algorithm>
+#include <array>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
 {
 	void RenderQueueInternal::Sort()
 	{
-		std::sort(m_orderedRenderQueue.begin(), m_orderedRenderQueue.end(), [](const RenderDataPair& lhs, const RenderDataPair& rhs)
+		// Small queues aren't worth the histogram computations
+		std::size_t count = m_orderedRenderQueue.size();
+		if (count < 64)
 		{
-			return lhs.first < rhs.first;
-		});
+			std::stable_sort(m_orderedRenderQueue.begin(), m_orderedRenderQueue.end(), [](const RenderDataPair& lhs, const RenderDataPair& rhs)
+			{
+				return lhs.first < rhs.first;
+			});
+
+			return;
+		}
+
+		// Least significant digit radix sort of the keys, one byte per pass (linear and stable)
+		constexpr unsigned int PassCount = sizeof(Index);
+
+		std::array<std::array<std::size_t, 256>, PassCount> histograms;
+		for (auto& histogram : histograms)
+			histogram.fill(0);
+
+		for (const RenderDataPair& pair : m_orderedRenderQueue)
+		{
+			for (unsigned int pass = 0; pass < PassCount; ++pass)
+				histograms[pass][(pair.first >> (pass * 8)) & 0xFF]++;
+		}
+
+		m_sortBuffer.resize(count);
+
+		for (unsigned int pass = 0; pass < PassCount; ++pass)
+		{
+			unsigned int shift = pass * 8;
+			auto& histogram = histograms[pass];
+
+			// Every key shares this byte, there's nothing to do
+			if (histogram[(m_orderedRenderQueue[0].first >> shift) & 0xFF] == count)
+				continue;
+
+			std::size_t offset = 0;
+			for (std::size_t& bucket : histogram)
+			{
+				std::size_t bucketSize = bucket;
+				bucket = offset;
+				offset += bucketSize;
+			}
+
+			for (const RenderDataPair& pair : m_orderedRenderQueue)
+				m_sortBuffer[histogram[(pair.first >> shift) & 0xFF]++] = pair;
+
+			std::swap(m_orderedRenderQueue, m_sortBuffer);
+		}
 	}
 }
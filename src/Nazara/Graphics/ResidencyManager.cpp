@@ -0,0 +1,634 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Graphics/ResidencyManager.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Graphics/Material.hpp>
+#include <Nazara/Utility/IndexBuffer.hpp>
+#include <Nazara/Utility/PixelFormat.hpp>
+#include <Nazara/Utility/SkeletalMesh.hpp>
+#include <Nazara/Utility/StaticMesh.hpp>
+#include <Nazara/Utility/VertexBuffer.hpp>
+#include <algorithm>
+#include <cmath>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		// Textures are never evicted below the first level fitting in this size
+		constexpr unsigned int BaseTextureSize = 64;
+
+		UInt64 ComputeMemoryUsage(const Image& image, UInt8 firstLevel)
+		{
+			UInt64 memoryUsage = 0;
+			for (UInt8 level = firstLevel; level < image.GetLevelCount(); ++level)
+				memoryUsage += image.GetMemoryUsage(level);
+
+			return memoryUsage;
+		}
+
+		UInt64 ComputeMemoryUsage(const Mesh& mesh)
+		{
+			UInt64 memoryUsage = 0;
+			for (unsigned int i = 0; i < mesh.GetSubMeshCount(); ++i)
+			{
+				const SubMesh* subMesh = mesh.GetSubMesh(i);
+
+				const VertexBuffer* vertexBuffer = nullptr;
+				switch (subMesh->GetAnimationType())
+				{
+					case AnimationType_Skeletal:
+						vertexBuffer = static_cast<const SkeletalMesh*>(subMesh)->GetVertexBuffer();
+						break;
+
+					case AnimationType_Static:
+						vertexBuffer = static_cast<const StaticMesh*>(subMesh)->GetVertexBuffer();
+						break;
+				}
+
+				if (vertexBuffer)
+					memoryUsage += UInt64(vertexBuffer->GetVertexCount()) * vertexBuffer->GetStride();
+
+				if (const IndexBuffer* indexBuffer = subMesh->GetIndexBuffer())
+					memoryUsage += UInt64(indexBuffer->GetIndexCount()) * indexBuffer->GetStride();
+			}
+
+			return memoryUsage;
+		}
+
+		// Least wanted first: not requested for the longest time, then requested with the smallest size
+		template<typename T>
+		bool IsLessWanted(const T& first, const T& second)
+		{
+			if (first.lastRequestFrame != second.lastRequestFrame)
+				return first.lastRequestFrame < second.lastRequestFrame;
+
+			return first.demand < second.demand;
+		}
+
+		// Evicts the least wanted resources while the cost doesn't fit in the budget, keeping the ones wanted at least as much as the candidate
+		template<typename T, typename F>
+		bool MakeRoom(const std::vector<T*>& evictables, std::size_t* cursor, const T& candidate, UInt64 cost, UInt64 budget, const UInt64& memoryUsage, F&& evict)
+		{
+			while (memoryUsage + cost > budget && *cursor < evictables.size())
+			{
+				T* entry = evictables[*cursor];
+				if (!IsLessWanted(*entry, candidate))
+					break;
+
+				++*cursor;
+				if (entry != &candidate)
+					evict(*entry);
+			}
+
+			return memoryUsage + cost <= budget;
+		}
+	}
+
+	/*!
+	* \ingroup graphics
+	* \class Nz::ResidencyManager
+	* \brief Graphics class streaming the levels of textures and meshes into video memory as they're needed on screen, within memory budgets
+	*
+	* Textures are loaded with only their lowest levels (up to 64x64) resident, the higher levels being uploaded from the image kept in memory once the texture is requested at a size needing them.
+	* Streamed levels of detail of models are loaded asynchronously when requested, the level drawing the mesh it had when registered in the meantime.
+	*
+	* When a budget is exceeded, the resources which weren't requested for the longest time (then requested with the smallest size) drop back to their lowest level instead of being released.
+	* Update must be called once per frame by the render thread, after the requests of the frame and after ResourceFinalizationQueue::Process.
+	*
+	* \remark The manager keeps a reference to the streamed textures and models until it's cleared
+	*/
+
+	/*!
+	* \brief Constructs a ResidencyManager object with memory budgets
+	*
+	* \param textureBudget Memory the streamed textures may use, in bytes
+	* \param meshBudget Memory the streamed meshes may use, in bytes
+	*/
+
+	ResidencyManager::ResidencyManager(UInt64 textureBudget, UInt64 meshBudget) :
+	m_frameIndex(1),
+	m_meshBudget(meshBudget),
+	m_meshMemoryUsage(0),
+	m_textureBudget(textureBudget),
+	m_textureMemoryUsage(0),
+	m_uploadBudget(8 * 1024 * 1024)
+	{
+	}
+
+	/*!
+	* \brief Stops streaming every texture and level of detail
+	*
+	* Textures and models keep their current content, loads in progress are ignored.
+	*/
+
+	void ResidencyManager::Clear()
+	{
+		m_meshes.clear();
+		m_meshMemoryUsage = 0;
+		m_textures.clear();
+		m_textureMemoryUsage = 0;
+	}
+
+	/*!
+	* \brief Gets the level of the source image the texture starts at
+	* \return Index of the level of the image uploaded as the first level of the texture
+	*
+	* \param texture Streamed texture
+	*
+	* \remark Produces a NazaraAssert if the texture isn't streamed by this manager
+	*/
+
+	UInt8 ResidencyManager::GetResidentLevel(const Texture* texture) const
+	{
+		auto it = m_textures.find(texture);
+		NazaraAssert(it != m_textures.end(), "Texture is not streamed by this manager");
+
+		return it->second.residentLevel;
+	}
+
+	/*!
+	* \brief Checks whether a streamed level of detail has its own mesh loaded
+	* \return true If the level draws the mesh streamed for it, false if it still draws its fallback mesh
+	*
+	* \param model Model of the level
+	* \param level Index of the level
+	*/
+
+	bool ResidencyManager::IsResident(const Model* model, std::size_t level) const
+	{
+		auto it = m_meshes.find(model);
+		if (it == m_meshes.end())
+			return false;
+
+		for (const MeshEntry& entry : it->second)
+		{
+			if (entry.level == level)
+				return entry.mesh.IsValid();
+		}
+
+		return false;
+	}
+
+	/*!
+	* \brief Checks whether a streamed texture has been loaded
+	* \return true If the texture has its lowest levels resident, false if it's still the placeholder
+	*
+	* \param texture Texture to check
+	*/
+
+	bool ResidencyManager::IsResident(const Texture* texture) const
+	{
+		auto it = m_textures.find(texture);
+		if (it == m_textures.end())
+			return false;
+
+		return it->second.image.IsValid();
+	}
+
+	/*!
+	* \brief Requests the textures of a material for this frame
+	*
+	* \param material Material whose streamed textures are drawn
+	* \param screenSize Height of the surface on screen, in pixels
+	*/
+
+	void ResidencyManager::Request(const Material* material, float screenSize)
+	{
+		if (!material)
+			return;
+
+		for (const TextureRef* texture : {&material->GetAlphaMap(), &material->GetDiffuseMap(), &material->GetEmissiveMap(), &material->GetHeightMap(), &material->GetNormalMap(), &material->GetSpecularMap()})
+		{
+			if (*texture)
+				Request(*texture, screenSize);
+		}
+	}
+
+	/*!
+	* \brief Requests a level of detail of a model for this frame
+	*
+	* \param model Model drawn
+	* \param level Level of detail selected for the model
+	* \param screenSize Height of the model on screen, in pixels
+	*
+	* \remark Levels which are not streamed by this manager are ignored
+	*/
+
+	void ResidencyManager::Request(const Model* model, std::size_t level, float screenSize)
+	{
+		auto it = m_meshes.find(model);
+		if (it == m_meshes.end())
+			return;
+
+		for (MeshEntry& entry : it->second)
+		{
+			if (entry.level != level)
+				continue;
+
+			if (entry.lastRequestFrame != m_frameIndex)
+			{
+				entry.demand = screenSize;
+				entry.lastRequestFrame = m_frameIndex;
+			}
+			else
+				entry.demand = std::max(entry.demand, screenSize);
+
+			break;
+		}
+	}
+
+	/*!
+	* \brief Requests a texture for this frame
+	*
+	* \param texture Texture drawn
+	* \param screenSize Height of the surface mapped by the texture on screen, in pixels
+	*
+	* \remark Textures which are not streamed by this manager are ignored
+	*/
+
+	void ResidencyManager::Request(const Texture* texture, float screenSize)
+	{
+		auto it = m_textures.find(texture);
+		if (it == m_textures.end())
+			return;
+
+		TextureEntry& entry = it->second;
+		if (entry.lastRequestFrame != m_frameIndex)
+		{
+			entry.demand = screenSize;
+			entry.lastRequestFrame = m_frameIndex;
+		}
+		else
+			entry.demand = std::max(entry.demand, screenSize);
+	}
+
+	/*!
+	* \brief Streams the mesh of a level of detail of a model from a file
+	* \return true If successful
+	*
+	* The mesh the level currently draws is kept as its fallback: it's drawn until the streamed mesh is loaded and once it's evicted.
+	*
+	* \param model Model owning the level
+	* \param level Index of the level, zero being the mesh of the model
+	* \param filePath Path to the mesh of the level, which must match the model like any level of detail
+	* \param params Parameters of the mesh
+	*
+	* \remark Produces a NazaraError if the level doesn't exist, has no mesh or is already streamed
+	*/
+
+	bool ResidencyManager::StreamLevelOfDetail(Model* model, std::size_t level, const String& filePath, const MeshParams& params)
+	{
+		NazaraAssert(model, "Invalid model");
+
+		if (level >= model->GetLevelOfDetailCount())
+		{
+			NazaraError("Level out of range (" + String::Number(level) + " >= " + String::Number(model->GetLevelOfDetailCount()) + ')');
+			return false;
+		}
+
+		Mesh* fallbackMesh = model->GetLevelOfDetailMesh(level);
+		if (!fallbackMesh)
+		{
+			NazaraError("Level has no mesh to fall back to");
+			return false;
+		}
+
+		std::vector<MeshEntry>& entries = m_meshes[model];
+		for (const MeshEntry& entry : entries)
+		{
+			if (entry.level == level)
+			{
+				NazaraError("Level is already streamed");
+				return false;
+			}
+		}
+
+		MeshEntry entry;
+		entry.fallbackMesh = fallbackMesh;
+		entry.filePath = filePath;
+		entry.level = level;
+		entry.model = model;
+		entry.params = params;
+
+		entries.emplace_back(std::move(entry));
+		return true;
+	}
+
+	/*!
+	* \brief Streams a texture from a file
+	* \return Texture, a white placeholder until the file is loaded
+	*
+	* The image is decoded (and its mipmaps generated) by the TaskScheduler workers, its lowest levels being uploaded by the next update following it.
+	*
+	* \param filePath Path to the image
+	* \param params Parameters of the image
+	*/
+
+	TextureRef ResidencyManager::StreamTexture(const String& filePath, const ImageParams& params)
+	{
+		TextureRef texture = Texture::New();
+
+		const UInt8 white[4] = {255, 255, 255, 255};
+		if (!texture->Create(ImageType_2D, PixelFormatType_RGBA8, 1, 1) || !texture->Update(white))
+		{
+			NazaraError("Failed to create placeholder texture");
+			return nullptr;
+		}
+
+		TextureEntry& entry = m_textures[texture];
+		entry.texture = texture;
+		entry.future = ResourceFuture<Image>::Start(Image::New(), [filePath, params] (Image& image)
+		{
+			if (!image.LoadFromFile(filePath, params))
+				return false;
+
+			if (image.GetLevelCount() == 1 && !PixelFormat::IsCompressed(image.GetFormat()))
+				image.GenerateMipmaps();
+
+			return true;
+		});
+
+		return texture;
+	}
+
+	/*!
+	* \brief Streams a texture from an image
+	* \return Texture with the lowest levels of the image resident, nullptr if it failed
+	*
+	* \param image Source of the texture, kept by the manager, having its mipmaps generated if it has none
+	*/
+
+	TextureRef ResidencyManager::StreamTexture(ImageRef image)
+	{
+		NazaraAssert(image && image->IsValid(), "Invalid image");
+
+		if (image->GetLevelCount() == 1 && !PixelFormat::IsCompressed(image->GetFormat()))
+			image->GenerateMipmaps();
+
+		TextureEntry entry;
+		entry.texture = Texture::New();
+		if (!LoadImage(entry, std::move(image)))
+			return nullptr;
+
+		TextureRef texture = entry.texture;
+		m_textures.emplace(texture, std::move(entry));
+
+		return texture;
+	}
+
+	/*!
+	* \brief Makes the streamed textures and meshes resident according to the requests of the frame
+	*
+	* Textures requested at a size needing higher levels get them uploaded, the most wanted first, within the upload budget.
+	* Requested levels of detail start loading, loaded ones replace their fallback mesh.
+	* Room is made in the budgets by dropping the least wanted resources to their lowest level.
+	*
+	* \remark This must be called by the render thread, once per frame
+	*/
+
+	void ResidencyManager::Update()
+	{
+		UpdateTextures();
+		UpdateMeshes();
+
+		m_frameIndex++;
+	}
+
+	void ResidencyManager::Evict(MeshEntry& entry)
+	{
+		if (!entry.mesh)
+			return;
+
+		if (entry.level < entry.model->GetLevelOfDetailCount())
+			entry.model->SetLevelOfDetailMesh(entry.level, entry.fallbackMesh);
+
+		entry.mesh.Reset();
+		m_meshMemoryUsage -= entry.memoryUsage;
+	}
+
+	bool ResidencyManager::LoadImage(TextureEntry& entry, ImageRef image)
+	{
+		entry.image = std::move(image);
+
+		// Only 2D textures are streamed, other types having every level resident
+		const Image& source = *entry.image;
+		UInt8 baseLevel = 0;
+		if (source.GetType() == ImageType_2D)
+		{
+			while (baseLevel + 1 < source.GetLevelCount() && std::max(source.GetWidth(baseLevel), source.GetHeight(baseLevel)) > BaseTextureSize)
+				baseLevel++;
+		}
+
+		entry.baseLevel = baseLevel;
+		if (!SetResidentLevel(entry, baseLevel))
+		{
+			entry.failed = true;
+			entry.image.Reset();
+			return false;
+		}
+
+		m_textureMemoryUsage += ComputeMemoryUsage(source, baseLevel);
+		return true;
+	}
+
+	bool ResidencyManager::SetResidentLevel(TextureEntry& entry, UInt8 level)
+	{
+		const Image& image = *entry.image;
+		Texture* texture = entry.texture;
+
+		// The texture object is kept (and so the materials using it), only its storage is created again with fewer or more levels
+		UInt8 levelCount = image.GetLevelCount();
+		if (!texture->Create(image.GetType(), image.GetFormat(), image.GetWidth(level), image.GetHeight(level), image.GetDepth(level), levelCount - level))
+		{
+			NazaraError("Failed to create texture");
+			return false;
+		}
+
+		for (UInt8 i = level; i < levelCount; ++i)
+		{
+			if (!texture->Update(image.GetConstPixels(0, 0, 0, i), 0, 0, i - level))
+			{
+				NazaraError("Failed to upload level #" + String::Number(i));
+				return false;
+			}
+		}
+
+		entry.residentLevel = level;
+		return true;
+	}
+
+	void ResidencyManager::UpdateMeshes()
+	{
+		m_meshCandidates.clear();
+		m_meshEvictables.clear();
+
+		for (auto& pair : m_meshes)
+		{
+			for (MeshEntry& entry : pair.second)
+			{
+				if (entry.failed)
+					continue;
+
+				if (entry.future.IsValid())
+				{
+					if (!entry.future.IsReady())
+						continue;
+
+					MeshRef mesh = entry.future.Get();
+					entry.future = ResourceFuture<Mesh>();
+
+					m_meshMemoryUsage -= entry.memoryUsage;
+					if (!mesh || entry.level >= entry.model->GetLevelOfDetailCount() || !entry.model->SetLevelOfDetailMesh(entry.level, mesh))
+					{
+						NazaraWarning("Failed to stream level #" + String::Number(entry.level) + " from " + entry.filePath);
+
+						entry.failed = true;
+						entry.memoryUsage = 0;
+						continue;
+					}
+
+					entry.memoryUsage = ComputeMemoryUsage(*mesh);
+					entry.mesh = std::move(mesh);
+					m_meshMemoryUsage += entry.memoryUsage;
+				}
+
+				if (entry.mesh)
+					m_meshEvictables.push_back(&entry);
+				else if (entry.lastRequestFrame == m_frameIndex)
+					m_meshCandidates.push_back(&entry);
+			}
+		}
+
+		std::sort(m_meshEvictables.begin(), m_meshEvictables.end(), [] (const MeshEntry* first, const MeshEntry* second) { return IsLessWanted(*first, *second); });
+		std::sort(m_meshCandidates.begin(), m_meshCandidates.end(), [] (const MeshEntry* first, const MeshEntry* second) { return IsLessWanted(*second, *first); });
+
+		auto evict = [this] (MeshEntry& entry) { Evict(entry); };
+
+		// Loaded meshes may exceed the estimation their load reserved
+		std::size_t cursor = 0;
+		while (m_meshMemoryUsage > m_meshBudget && cursor < m_meshEvictables.size())
+			Evict(*m_meshEvictables[cursor++]);
+
+		// The memory of a mesh is only known once loaded, the size of its previous load being reserved until then
+		for (MeshEntry* entry : m_meshCandidates)
+		{
+			if (!MakeRoom(m_meshEvictables, &cursor, *entry, entry->memoryUsage, m_meshBudget, m_meshMemoryUsage, evict))
+				continue;
+
+			m_meshMemoryUsage += entry->memoryUsage;
+			entry->future = Mesh::LoadAsync(entry->filePath, entry->params);
+		}
+	}
+
+	void ResidencyManager::UpdateTextures()
+	{
+		m_textureCandidates.clear();
+		m_textureEvictables.clear();
+
+		for (auto& pair : m_textures)
+		{
+			TextureEntry& entry = pair.second;
+			if (entry.failed)
+				continue;
+
+			if (entry.future.IsValid())
+			{
+				if (!entry.future.IsReady())
+					continue;
+
+				ImageRef image = entry.future.Get();
+				entry.future = ResourceFuture<Image>();
+
+				if (!image)
+				{
+					NazaraWarning("Failed to load streamed texture");
+
+					entry.failed = true;
+					continue;
+				}
+
+				if (!LoadImage(entry, std::move(image)))
+					continue;
+			}
+
+			if (entry.residentLevel < entry.baseLevel)
+				m_textureEvictables.push_back(&entry);
+
+			if (entry.lastRequestFrame == m_frameIndex && entry.residentLevel > 0)
+			{
+				// The first level whose size is at least the size it's drawn at
+				float size = static_cast<float>(std::max(entry.image->GetWidth(), entry.image->GetHeight()));
+				float level = std::floor(std::log2(size / std::max(entry.demand, 1.f)));
+
+				if (level < entry.residentLevel)
+					m_textureCandidates.push_back(&entry);
+			}
+		}
+
+		std::sort(m_textureEvictables.begin(), m_textureEvictables.end(), [] (const TextureEntry* first, const TextureEntry* second) { return IsLessWanted(*first, *second); });
+		std::sort(m_textureCandidates.begin(), m_textureCandidates.end(), [] (const TextureEntry* first, const TextureEntry* second) { return IsLessWanted(*second, *first); });
+
+		auto evict = [this] (TextureEntry& entry)
+		{
+			if (entry.residentLevel >= entry.baseLevel)
+				return;
+
+			UInt64 memoryUsage = ComputeMemoryUsage(*entry.image, entry.residentLevel);
+			if (SetResidentLevel(entry, entry.baseLevel))
+			{
+				m_textureMemoryUsage -= memoryUsage;
+				m_textureMemoryUsage += ComputeMemoryUsage(*entry.image, entry.baseLevel);
+			}
+		};
+
+		std::size_t cursor = 0;
+		UInt64 uploadedSize = 0;
+		for (TextureEntry* entry : m_textureCandidates)
+		{
+			const Image& image = *entry->image;
+
+			float size = static_cast<float>(std::max(image.GetWidth(), image.GetHeight()));
+			UInt8 level = static_cast<UInt8>(std::max(std::floor(std::log2(size / std::max(entry->demand, 1.f))), 0.f));
+
+			// Evicted by a more wanted texture during this update
+			if (level >= entry->residentLevel)
+				continue;
+
+			UInt64 currentUsage = ComputeMemoryUsage(image, entry->residentLevel);
+
+			// Without enough room, the texture gets as many higher levels as the budget allows
+			for (; level < entry->residentLevel; ++level)
+			{
+				UInt64 cost = ComputeMemoryUsage(image, level) - currentUsage;
+				if (MakeRoom(m_textureEvictables, &cursor, *entry, cost, m_textureBudget, m_textureMemoryUsage, evict))
+					break;
+			}
+
+			if (level >= entry->residentLevel)
+				continue;
+
+			UInt64 uploadSize = ComputeMemoryUsage(image, level);
+			if (uploadedSize > 0 && uploadedSize + uploadSize > m_uploadBudget)
+				break;
+
+			if (!SetResidentLevel(*entry, level))
+			{
+				// The storage was created again, the texture is left with its lowest levels
+				if (SetResidentLevel(*entry, entry->baseLevel))
+				{
+					m_textureMemoryUsage -= currentUsage;
+					m_textureMemoryUsage += ComputeMemoryUsage(image, entry->baseLevel);
+				}
+
+				continue;
+			}
+
+			m_textureMemoryUsage += uploadSize - currentUsage;
+			uploadedSize += uploadSize;
+		}
+	}
+}
@@ -0,0 +1,140 @@
+#version 140
+
+#define LIGHT_DIRECTIONAL 0
+#define LIGHT_POINT 1
+#define LIGHT_SPOT 2
+
+#define LIGHT_COUNT 128 // NAZARA_GRAPHICS_MAX_LIGHTS_PER_SCENE
+
+out vec4 RenderTarget0;
+
+struct Light
+{
+	vec4 color;
+	vec4 parameters1;
+	vec4 parameters2;
+	vec2 factors;
+	vec2 parameters3;
+
+	int type;
+	bool shadowMapping;
+};
+
+layout(std140) uniform LightBlock
+{
+	Light Lights[LIGHT_COUNT];
+};
+
+uniform vec3 EyePosition;
+
+uniform sampler2D GBuffer0;
+uniform sampler2D GBuffer1;
+uniform sampler2D GBuffer2;
+uniform sampler2D DepthBuffer;
+uniform usampler2D LightTiles; // Masque des lumières touchant chaque tuile de l'écran
+
+uniform mat4 InvViewProjMatrix;
+uniform vec2 InvTargetSize;
+uniform vec4 SceneAmbient;
+
+#define kPI 3.1415926536
+
+vec3 DecodeNormal(in vec4 encodedNormal)
+{
+	//return encodedNormal.xyz*2.0 - 1.0;
+	float a = encodedNormal.x * kPI;
+	vec2 scth = vec2(sin(a), cos(a));
+
+	vec2 scphi = vec2(sqrt(1.0 - encodedNormal.y*encodedNormal.y), encodedNormal.y);
+	return vec3(scth.y*scphi.x, scth.x*scphi.x, scphi.y);
+}
+
+void main()
+{
+	vec2 texCoord = gl_FragCoord.xy * InvTargetSize;
+	float depth = textureLod(DepthBuffer, texCoord, 0.0).r;
+
+	// Rien n'a été dessiné ici
+	if (depth >= 1.0)
+		discard;
+
+	ivec2 tileCount = textureSize(LightTiles, 0);
+	ivec2 tile = clamp(ivec2(texCoord * vec2(tileCount)), ivec2(0), tileCount - ivec2(1));
+	uvec4 tileLights = texelFetch(LightTiles, tile, 0);
+
+	if (tileLights == uvec4(0u))
+		discard;
+
+	vec4 gVec0 = textureLod(GBuffer0, texCoord, 0.0);
+	vec4 gVec1 = textureLod(GBuffer1, texCoord, 0.0);
+	vec4 gVec2 = textureLod(GBuffer2, texCoord, 0.0);
+
+	vec3 diffuseColor = gVec0.xyz;
+	vec3 normal = DecodeNormal(gVec1);
+	float specularMultiplier = gVec0.w;
+	float shininess = (gVec2.w == 0.0) ? 0.0 : exp2(gVec2.w*10.5);
+
+	vec3 viewSpace = vec3(texCoord*2.0 - 1.0, depth*2.0 - 1.0);
+
+	vec4 worldPos = InvViewProjMatrix * vec4(viewSpace, 1.0);
+	worldPos.xyz /= worldPos.w;
+
+	vec3 eyeVec = normalize(EyePosition - worldPos.xyz);
+
+	vec3 lightAmbient = vec3(0.0);
+	vec3 lightDiffuse = vec3(0.0);
+	vec3 lightSpecular = vec3(0.0);
+
+	for (int i = 0; i < LIGHT_COUNT; ++i)
+	{
+		uint lightBits = tileLights[i >> 5] >> uint(i & 31);
+		if (lightBits == 0u)
+		{
+			i |= 31; // Plus aucune lumière dans ce mot
+			continue;
+		}
+
+		if ((lightBits & 1u) == 0u)
+			continue;
+
+		Light light = Lights[i];
+
+		vec3 lightDir = light.parameters1.xyz - worldPos.xyz;
+		float lightDirLength = length(lightDir);
+		lightDir /= lightDirLength;
+
+		float att = max(light.parameters1.w - light.parameters2.w*lightDirLength, 0.0);
+		if (att <= 0.0)
+			continue;
+
+		// Ambient
+		lightAmbient += att * light.color.rgb * light.factors.x * (vec3(1.0) + SceneAmbient.rgb);
+
+		if (light.type == LIGHT_SPOT)
+		{
+			// Modification de l'atténuation pour gérer le spot
+			float curAngle = dot(light.parameters2.xyz, -lightDir);
+			float outerAngle = light.parameters3.y;
+			float innerMinusOuterAngle = light.parameters3.x - outerAngle;
+			att *= max((curAngle - outerAngle) / innerMinusOuterAngle, 0.0);
+		}
+
+		// Diffuse
+		float lambert = max(dot(normal, lightDir), 0.0);
+
+		lightDiffuse += att * lambert * light.color.rgb * light.factors.y;
+
+		// Specular
+		if (shininess > 0.0)
+		{
+			vec3 reflection = reflect(-lightDir, normal);
+			float specularFactor = max(dot(reflection, eyeVec), 0.0);
+			specularFactor = pow(specularFactor, shininess);
+
+			lightSpecular += att * specularFactor * light.color.rgb * specularMultiplier;
+		}
+	}
+
+	vec3 fragmentColor = diffuseColor * (lightAmbient + lightDiffuse + lightSpecular);
+	RenderTarget0 = vec4(fragmentColor, 1.0);
+}
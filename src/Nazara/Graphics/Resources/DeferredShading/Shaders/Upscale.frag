@@ -0,0 +1,28 @@
+#version 140
+
+out vec4 RenderTarget0;
+
+uniform sampler2D ColorTexture;
+uniform float Sharpness;
+uniform vec4 ViewportRect; // Window position and inverse size of the viewport
+
+void main()
+{
+	vec2 texCoord = (gl_FragCoord.xy - ViewportRect.xy) * ViewportRect.zw;
+	vec2 texelSize = 1.0 / vec2(textureSize(ColorTexture, 0));
+
+	// Bilinear filtering does the upscaling, the neighbours bring back some of the detail it blurs
+	vec4 center = textureLod(ColorTexture, texCoord, 0.0);
+	vec3 north = textureLod(ColorTexture, texCoord + vec2(0.0, texelSize.y), 0.0).rgb;
+	vec3 south = textureLod(ColorTexture, texCoord - vec2(0.0, texelSize.y), 0.0).rgb;
+	vec3 east = textureLod(ColorTexture, texCoord + vec2(texelSize.x, 0.0), 0.0).rgb;
+	vec3 west = textureLod(ColorTexture, texCoord - vec2(texelSize.x, 0.0), 0.0).rgb;
+
+	vec3 minColor = min(center.rgb, min(min(north, south), min(east, west)));
+	vec3 maxColor = max(center.rgb, max(max(north, south), max(east, west)));
+
+	// Unsharp mask, kept within the local range so edges don't ring
+	vec3 sharpened = center.rgb + (4.0 * center.rgb - north - south - east - west) * (0.25 * Sharpness);
+
+	RenderTarget0 = vec4(clamp(sharpened, minColor, maxColor), center.a);
+}
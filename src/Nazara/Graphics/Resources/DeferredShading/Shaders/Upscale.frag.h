@@ -0,0 +1 @@
+35,118,101,114,115,105,111,110,32,49,52,48,10,10,111,117,116,32,118,101,99,52,32,82,101,110,100,101,114,84,97,114,103,101,116,48,59,10,10,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,32,67,111,108,111,114,84,101,120,116,117,114,101,59,10,117,110,105,102,111,114,109,32,102,108,111,97,116,32,83,104,97,114,112,110,101,115,115,59,10,117,110,105,102,111,114,109,32,118,101,99,52,32,86,105,101,119,112,111,114,116,82,101,99,116,59,32,47,47,32,87,105,110,100,111,119,32,112,111,115,105,116,105,111,110,32,97,110,100,32,105,110,118,101,114,115,101,32,115,105,122,101,32,111,102,32,116,104,101,32,118,105,101,119,112,111,114,116,10,10,118,111,105,100,32,109,97,105,110,40,41,10,123,10,9,118,101,99,50,32,116,101,120,67,111,111,114,100,32,61,32,40,103,108,95,70,114,97,103,67,111,111,114,100,46,120,121,32,45,32,86,105,101,119,112,111,114,116,82,101,99,116,46,120,121,41,32,42,32,86,105,101,119,112,111,114,116,82,101,99,116,46,122,119,59,10,9,118,101,99,50,32,116,101,120,101,108,83,105,122,101,32,61,32,49,46,48,32,47,32,118,101,99,50,40,116,101,120,116,117,114,101,83,105,122,101,40,67,111,108,111,114,84,101,120,116,117,114,101,44,32,48,41,41,59,10,10,9,47,47,32,66,105,108,105,110,101,97,114,32,102,105,108,116,101,114,105,110,103,32,100,111,101,115,32,116,104,101,32,117,112,115,99,97,108,105,110,103,44,32,116,104,101,32,110,101,105,103,104,98,111,117,114,115,32,98,114,105,110,103,32,98,97,99,107,32,115,111,109,101,32,111,102,32,116,104,101,32,100,101,116,97,105,108,32,105,116,32,98,108,117,114,115,10,9,118,101,99,52,32,99,101,110,116,101,114,32,61,32,116,101,120,116,117,114,101,76,111,100,40,67,111,108,111,114,84,101,120,116,117,114,101,44,32,116,101,120,67,111,111,114,100,44,32,48,46,48,41,59,10,9,118,101,99,51,32,110,111,114,116,104,32,61,32,116,101,120,116,117,114,101,76,111,100,40,67,111,108,111,114,84,101,120,116,117,114,101,44,32,116,101,120,67,111,111,114,100,32,43,32,118,101,99,50,40,48,46,48,44,32,116,101,120,101,108,83,105,122,101,46,121,41,44,32,48,46,48,41,46,114,103,98,59,10,9,118,101,99,51,32,115,111,117,116,104,32,61,32,116,101,120,116,117,114,101,76,111,100,40,67,111,108,111,114,84,101,120,116,117,114,101,44,32,116,101,120,67,111,111,114,100,32,45,32,118,101,99,50,40,48,46,48,44,32,116,101,120,101,108,83,105,122,101,46,121,41,44,32,48,46,48,41,46,114,103,98,59,10,9,118,101,99,51,32,101,97,115,116,32,61,32,116,101,120,116,117,114,101,76,111,100,40,67,111,108,111,114,84,101,120,116,117,114,101,44,32,116,101,120,67,111,111,114,100,32,43,32,118,101,99,50,40,116,101,120,101,108,83,105,122,101,46,120,44,32,48,46,48,41,44,32,48,46,48,41,46,114,103,98,59,10,9,118,101,99,51,32,119,101,115,116,32,61,32,116,101,120,116,117,114,101,76,111,100,40,67,111,108,111,114,84,101,120,116,117,114,101,44,32,116,101,120,67,111,111,114,100,32,45,32,118,101,99,50,40,116,101,120,101,108,83,105,122,101,46,120,44,32,48,46,48,41,44,32,48,46,48,41,46,114,103,98,59,10,10,9,118,101,99,51,32,109,105,110,67,111,108,111,114,32,61,32,109,105,110,40,99,101,110,116,101,114,46,114,103,98,44,32,109,105,110,40,109,105,110,40,110,111,114,116,104,44,32,115,111,117,116,104,41,44,32,109,105,110,40,101,97,115,116,44,32,119,101,115,116,41,41,41,59,10,9,118,101,99,51,32,109,97,120,67,111,108,111,114,32,61,32,109,97,120,40,99,101,110,116,101,114,46,114,103,98,44,32,109,97,120,40,109,97,120,40,110,111,114,116,104,44,32,115,111,117,116,104,41,44,32,109,97,120,40,101,97,115,116,44,32,119,101,115,116,41,41,41,59,10,10,9,47,47,32,85,110,115,104,97,114,112,32,109,97,115,107,44,32,107,101,112,116,32,119,105,116,104,105,110,32,116,104,101,32,108,111,99,97,108,32,114,97,110,103,101,32,115,111,32,101,100,103,101,115,32,100,111,110,39,116,32,114,105,110,103,10,9,118,101,99,51,32,115,104,97,114,112,101,110,101,100,32,61,32,99,101,110,116,101,114,46,114,103,98,32,43,32,40,52,46,48,32,42,32,99,101,110,116,101,114,46,114,103,98,32,45,32,110,111,114,116,104,32,45,32,115,111,117,116,104,32,45,32,101,97,115,116,32,45,32,119,101,115,116,41,32,42,32,40,48,46,50,53,32,42,32,83,104,97,114,112,110,101,115,115,41,59,10,10,9,82,101,110,100,101,114,84,97,114,103,101,116,48,32,61,32,118,101,99,52,40,99,108,97,109,112,40,115,104,97,114,112,101,110,101,100,44,32,109,105,110,67,111,108,111,114,44,32,109,97,120,67,111,108,111,114,41,44,32,99,101,110,116,101,114,46,97,41,59,10,125,10,
\ No newline at end of file
@@ -1,23 +1,70 @@
+#if BINDLESS_TEXTURES
+#extension GL_ARB_bindless_texture : require
+#endif
+
 #if EARLY_FRAGMENT_TESTS && !ALPHA_TEST
 layout(early_fragment_tests) in;
 #endif
 
 /********************Entrant********************/
 in vec4 vColor;
+#if FLAG_TEXTUREOVERLAY_ARRAY
+in float vOverlayLayer;
+#endif
 in vec2 vTexCoord;
 
 /********************Sortant********************/
 out vec4 RenderTarget0;
+#if ORDER_INDEPENDENT_TRANSPARENCY
+out vec4 RenderTarget1;
+#endif
 
 /********************Uniformes********************/
 uniform vec2 InvTargetSize;
+#if BINDLESS_TEXTURES
+// Les textures sont échantillonnées depuis leurs handles, envoyés avec le reste du matériau
+layout(std140) uniform MaterialBlock
+{
+	vec4 MaterialAmbient;
+	vec4 MaterialDiffuse;
+	vec4 MaterialSpecular;
+	float MaterialAlphaThreshold;
+	float MaterialShininess;
+	vec2 MaterialPadding;
+	uvec2 MaterialAlphaHandle;
+	uvec2 MaterialDiffuseHandle;
+	uvec2 MaterialEmissiveHandle;
+	uvec2 MaterialHeightHandle;
+	uvec2 MaterialNormalHandle;
+	uvec2 MaterialSpecularHandle;
+};
+
+#define MaterialAlphaMap sampler2D(MaterialAlphaHandle)
+#define MaterialDiffuseMap sampler2D(MaterialDiffuseHandle)
+#else
 uniform sampler2D MaterialAlphaMap;
 uniform float MaterialAlphaThreshold;
 uniform vec4 MaterialDiffuse;
 uniform sampler2D MaterialDiffuseMap;
+#endif
+#if FLAG_TEXTUREOVERLAY_ARRAY
+uniform sampler2DArray TextureOverlay;
+#else
 uniform sampler2D TextureOverlay;
+#endif
 
 /********************Fonctions********************/
+#if ORDER_INDEPENDENT_TRANSPARENCY
+void WriteTransparentFragment(vec4 color)
+{
+	// Transparence indépendante de l'ordre (weighted blended) : les surfaces sont additionnées sans tri, les plus proches pesant davantage
+	float weight = color.a * clamp(3000.0 * pow(1.0 - gl_FragCoord.z, 3.0), 0.01, 3000.0);
+
+	RenderTarget0 = vec4(color.rgb * color.a, color.a) * weight;
+	RenderTarget1 = vec4(-log(1.0 - min(color.a, 0.999))); // La transmittance est un produit, son logarithme une somme
+}
+#endif
+
 void main()
 {
 	vec4 fragmentColor = MaterialDiffuse * vColor;
@@ -36,8 +83,21 @@ void main()
 	fragmentColor.a *= texture(MaterialAlphaMap, texCoord).r;
 #endif
 
-#if FLAG_TEXTUREOVERLAY
-	fragmentColor *= texture(TextureOverlay, texCoord);
+#if FLAG_TEXTUREOVERLAY || FLAG_TEXTUREOVERLAY_ARRAY
+	#if FLAG_TEXTUREOVERLAY_ARRAY
+	vec4 overlayColor = texture(TextureOverlay, vec3(texCoord, vOverlayLayer));
+	#else
+	vec4 overlayColor = texture(TextureOverlay, texCoord);
+	#endif
+
+	#if DISTANCE_FIELD
+	// La superposition contient la distance signée au contour (à 0.5), lissée sur la taille d'un pixel à l'écran
+	float distance = overlayColor.a;
+	float smoothing = 0.7 * fwidth(distance);
+	overlayColor.a = smoothstep(0.5 - smoothing, 0.5 + smoothing, distance);
+	#endif
+
+	fragmentColor *= overlayColor;
 #endif
 
 #if ALPHA_TEST
@@ -45,5 +105,9 @@ void main()
 		discard;
 #endif
 
+#if ORDER_INDEPENDENT_TRANSPARENCY
+	WriteTransparentFragment(fragmentColor);
+#else
 	RenderTarget0 = fragmentColor;
+#endif
 }
\ No newline at end of file
@@ -1 +1 @@
-35,105,102,32,69,65,82,76,89,95,70,82,65,71,77,69,78,84,95,84,69,83,84,83,32,38,38,32,33,65,76,80,72,65,95,84,69,83,84,10,108,97,121,111,117,116,40,101,97,114,108,121,95,102,114,97,103,109,101,110,116,95,116,101,115,116,115,41,32,105,110,59,10,35,101,110,100,105,102,10,10,47,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,69,110,116,114,97,110,116,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,47,10,105,110,32,118,101,99,52,32,118,67,111,108,111,114,59,10,105,110,32,118,101,99,50,32,118,84,101,120,67,111,111,114,100,59,10,10,47,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,83,111,114,116,97,110,116,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,47,10,111,117,116,32,118,101,99,52,32,82,101,110,100,101,114,84,97,114,103,101,116,48,59,10,10,47,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,85,110,105,102,111,114,109,101,115,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,47,10,117,110,105,102,111,114,109,32,118,101,99,50,32,73,110,118,84,97,114,103,101,116,83,105,122,101,59,10,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,32,77,97,116,101,114,105,97,108,65,108,112,104,97,77,97,112,59,10,117,110,105,102,111,114,109,32,102,108,111,97,116,32,77,97,116,101,114,105,97,108,65,108,112,104,97,84,104,114,101,115,104,111,108,100,59,10,117,110,105,102,111,114,109,32,118,101,99,52,32,77,97,116,101,114,105,97,108,68,105,102,102,117,115,101,59,10,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,32,77,97,116,101,114,105,97,108,68,105,102,102,117,115,101,77,97,112,59,10,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,32,84,101,120,116,117,114,101,79,118,101,114,108,97,121,59,10,10,47,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,70,111,110,99,116,105,111,110,115,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,47,10,118,111,105,100,32,109,97,105,110,40,41,10,123,10,9,118,101,99,52,32,102,114,97,103,109,101,110,116,67,111,108,111,114,32,61,32,77,97,116,101,114,105,97,108,68,105,102,102,117,115,101,32,42,32,118,67,111,108,111,114,59,10,10,35,105,102,32,65,85,84,79,95,84,69,88,67,79,79,82,68,83,10,9,118,101,99,50,32,116,101,120,67,111,111,114,100,32,61,32,103,108,95,70,114,97,103,67,111,111,114,100,46,120,121,32,42,32,73,110,118,84,97,114,103,101,116,83,105,122,101,59,10,35,101,108,105,102,32,84,69,88,84,85,82,69,95,77,65,80,80,73,78,71,10,9,118,101,99,50,32,116,101,120,67,111,111,114,100,32,61,32,118,84,101,120,67,111,111,114,100,59,10,35,101,110,100,105,102,10,10,35,105,102,32,68,73,70,70,85,83,69,95,77,65,80,80,73,78,71,10,9,102,114,97,103,109,101,110,116,67,111,108,111,114,32,42,61,32,116,101,120,116,117,114,101,40,77,97,116,101,114,105,97,108,68,105,102,102,117,115,101,77,97,112,44,32,116,101,120,67,111,111,114,100,41,59,10,35,101,110,100,105,102,10,10,35,105,102,32,65,76,80,72,65,95,77,65,80,80,73,78,71,10,9,102,114,97,103,109,101,110,116,67,111,108,111,114,46,97,32,42,61,32,116,101,120,116,117,114,101,40,77,97,116,101,114,105,97,108,65,108,112,104,97,77,97,112,44,32,116,101,120,67,111,111,114,100,41,46,114,59,10,35,101,110,100,105,102,10,10,35,105,102,32,70,76,65,71,95,84,69,88,84,85,82,69,79,86,69,82,76,65,89,10,9,102,114,97,103,109,101,110,116,67,111,108,111,114,32,42,61,32,116,101,120,116,117,114,101,40,84,101,120,116,117,114,101,79,118,101,114,108,97,121,44,32,116,101,120,67,111,111,114,100,41,59,10,35,101,110,100,105,102,10,10,35,105,102,32,65,76,80,72,65,95,84,69,83,84,10,9,105,102,32,40,102,114,97,103,109,101,110,116,67,111,108,111,114,46,97,32,60,32,77,97,116,101,114,105,97,108,65,108,112,104,97,84,104,114,101,115,104,111,108,100,41,10,9,9,100,105,115,99,97,114,100,59,10,35,101,110,100,105,102,10,10,9,82,101,110,100,101,114,84,97,114,103,101,116,48,32,61,32,102,114,97,103,109,101,110,116,67,111,108,111,114,59,10,125,
\ No newline at end of file
+35,105,102,32,66,73,78,68,76,69,83,83,95,84,69,88,84,85,82,69,83,10,35,101,120,116,101,110,115,105,111,110,32,71,76,95,65,82,66,95,98,105,110,100,108,101,115,115,95,116,101,120,116,117,114,101,32,58,32,114,101,113,117,105,114,101,10,35,101,110,100,105,102,10,10,35,105,102,32,69,65,82,76,89,95,70,82,65,71,77,69,78,84,95,84,69,83,84,83,32,38,38,32,33,65,76,80,72,65,95,84,69,83,84,10,108,97,121,111,117,116,40,101,97,114,108,121,95,102,114,97,103,109,101,110,116,95,116,101,115,116,115,41,32,105,110,59,10,35,101,110,100,105,102,10,10,47,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,69,110,116,114,97,110,116,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,47,10,105,110,32,118,101,99,52,32,118,67,111,108,111,114,59,10,35,105,102,32,70,76,65,71,95,84,69,88,84,85,82,69,79,86,69,82,76,65,89,95,65,82,82,65,89,10,105,110,32,102,108,111,97,116,32,118,79,118,101,114,108,97,121,76,97,121,101,114,59,10,35,101,110,100,105,102,10,105,110,32,118,101,99,50,32,118,84,101,120,67,111,111,114,100,59,10,10,47,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,83,111,114,116,97,110,116,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,47,10,111,117,116,32,118,101,99,52,32,82,101,110,100,101,114,84,97,114,103,101,116,48,59,10,35,105,102,32,79,82,68,69,82,95,73,78,68,69,80,69,78,68,69,78,84,95,84,82,65,78,83,80,65,82,69,78,67,89,10,111,117,116,32,118,101,99,52,32,82,101,110,100,101,114,84,97,114,103,101,116,49,59,10,35,101,110,100,105,102,10,10,47,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,85,110,105,102,111,114,109,101,115,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,47,10,117,110,105,102,111,114,109,32,118,101,99,50,32,73,110,118,84,97,114,103,101,116,83,105,122,101,59,10,35,105,102,32,66,73,78,68,76,69,83,83,95,84,69,88,84,85,82,69,83,10,47,47,32,76,101,115,32,116,101,120,116,117,114,101,115,32,115,111,110,116,32,195,169,99,104,97,110,116,105,108,108,111,110,110,195,169,101,115,32,100,101,112,117,105,115,32,108,101,117,114,115,32,104,97,110,100,108,101,115,44,32,101,110,118,111,121,195,169,115,32,97,118,101,99,32,108,101,32,114,101,115,116,101,32,100,117,32,109,97,116,195,169,114,105,97,117,10,108,97,121,111,117,116,40,115,116,100,49,52,48,41,32,117,110,105,102,111,114,109,32,77,97,116,101,114,105,97,108,66,108,111,99,107,10,123,10,9,118,101,99,52,32,77,97,116,101,114,105,97,108,65,109,98,105,101,110,116,59,10,9,118,101,99,52,32,77,97,116,101,114,105,97,108,68,105,102,102,117,115,101,59,10,9,118,101,99,52,32,77,97,116,101,114,105,97,108,83,112,101,99,117,108,97,114,59,10,9,102,108,111,97,116,32,77,97,116,101,114,105,97,108,65,108,112,104,97,84,104,114,101,115,104,111,108,100,59,10,9,102,108,111,97,116,32,77,97,116,101,114,105,97,108,83,104,105,110,105,110,101,115,115,59,10,9,118,101,99,50,32,77,97,116,101,114,105,97,108,80,97,100,100,105,110,103,59,10,9,117,118,101,99,50,32,77,97,116,101,114,105,97,108,65,108,112,104,97,72,97,110,100,108,101,59,10,9,117,118,101,99,50,32,77,97,116,101,114,105,97,108,68,105,102,102,117,115,101,72,97,110,100,108,101,59,10,9,117,118,101,99,50,32,77,97,116,101,114,105,97,108,69,109,105,115,115,105,118,101,72,97,110,100,108,101,59,10,9,117,118,101,99,50,32,77,97,116,101,114,105,97,108,72,101,105,103,104,116,72,97,110,100,108,101,59,10,9,117,118,101,99,50,32,77,97,116,101,114,105,97,108,78,111,114,109,97,108,72,97,110,100,108,101,59,10,9,117,118,101,99,50,32,77,97,116,101,114,105,97,108,83,112,101,99,117,108,97,114,72,97,110,100,108,101,59,10,125,59,10,10,35,100,101,102,105,110,101,32,77,97,116,101,114,105,97,108,65,108,112,104,97,77,97,112,32,115,97,109,112,108,101,114,50,68,40,77,97,116,101,114,105,97,108,65,108,112,104,97,72,97,110,100,108,101,41,10,35,100,101,102,105,110,101,32,77,97,116,101,114,105,97,108,68,105,102,102,117,115,101,77,97,112,32,115,97,109,112,108,101,114,50,68,40,77,97,116,101,114,105,97,108,68,105,102,102,117,115,101,72,97,110,100,108,101,41,10,35,101,108,115,101,10,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,32,77,97,116,101,114,105,97,108,65,108,112,104,97,77,97,112,59,10,117,110,105,102,111,114,109,32,102,108,111,97,116,32,77,97,116,101,114,105,97,108,65,108,112,104,97,84,104,114,101,115,104,111,108,100,59,10,117,110,105,102,111,114,109,32,118,101,99,52,32,77,97,116,101,114,105,97,108,68,105,102,102,117,115,101,59,10,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,32,77,97,116,101,114,105,97,108,68,105,102,102,117,115,101,77,97,112,59,10,35,101,110,100,105,102,10,35,105,102,32,70,76,65,71,95,84,69,88,84,85,82,69,79,86,69,82,76,65,89,95,65,82,82,65,89,10,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,65,114,114,97,121,32,84,101,120,116,117,114,101,79,118,101,114,108,97,121,59,10,35,101,108,115,101,10,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,32,84,101,120,116,117,114,101,79,118,101,114,108,97,121,59,10,35,101,110,100,105,102,10,10,47,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,70,111,110,99,116,105,111,110,115,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,47,10,35,105,102,32,79,82,68,69,82,95,73,78,68,69,80,69,78,68,69,78,84,95,84,82,65,78,83,80,65,82,69,78,67,89,10,118,111,105,100,32,87,114,105,116,101,84,114,97,110,115,112,97,114,101,110,116,70,114,97,103,109,101,110,116,40,118,101,99,52,32,99,111,108,111,114,41,10,123,10,9,47,47,32,84,114,97,110,115,112,97,114,101,110,99,101,32,105,110,100,195,169,112,101,110,100,97,110,116,101,32,100,101,32,108,39,111,114,100,114,101,32,40,119,101,105,103,104,116,101,100,32,98,108,101,110,100,101,100,41,32,58,32,108,101,115,32,115,117,114,102,97,99,101,115,32,115,111,110,116,32,97,100,100,105,116,105,111,110,110,195,169,101,115,32,115,97,110,115,32,116,114,105,44,32,108,101,115,32,112,108,117,115,32,112,114,111,99,104,101,115,32,112,101,115,97,110,116,32,100,97,118,97,110,116,97,103,101,10,9,102,108,111,97,116,32,119,101,105,103,104,116,32,61,32,99,111,108,111,114,46,97,32,42,32,99,108,97,109,112,40,51,48,48,48,46,48,32,42,32,112,111,119,40,49,46,48,32,45,32,103,108,95,70,114,97,103,67,111,111,114,100,46,122,44,32,51,46,48,41,44,32,48,46,48,49,44,32,51,48,48,48,46,48,41,59,10,10,9,82,101,110,100,101,114,84,97,114,103,101,116,48,32,61,32,118,101,99,52,40,99,111,108,111,114,46,114,103,98,32,42,32,99,111,108,111,114,46,97,44,32,99,111,108,111,114,46,97,41,32,42,32,119,101,105,103,104,116,59,10,9,82,101,110,100,101,114,84,97,114,103,101,116,49,32,61,32,118,101,99,52,40,45,108,111,103,40,49,46,48,32,45,32,109,105,110,40,99,111,108,111,114,46,97,44,32,48,46,57,57,57,41,41,41,59,32,47,47,32,76,97,32,116,114,97,110,115,109,105,116,116,97,110,99,101,32,101,115,116,32,117,110,32,112,114,111,100,117,105,116,44,32,115,111,110,32,108,111,103,97,114,105,116,104,109,101,32,117,110,101,32,115,111,109,109,101,10,125,10,35,101,110,100,105,102,10,10,118,111,105,100,32,109,97,105,110,40,41,10,123,10,9,118,101,99,52,32,102,114,97,103,109,101,110,116,67,111,108,111,114,32,61,32,77,97,116,101,114,105,97,108,68,105,102,102,117,115,101,32,42,32,118,67,111,108,111,114,59,10,10,35,105,102,32,65,85,84,79,95,84,69,88,67,79,79,82,68,83,10,9,118,101,99,50,32,116,101,120,67,111,111,114,100,32,61,32,103,108,95,70,114,97,103,67,111,111,114,100,46,120,121,32,42,32,73,110,118,84,97,114,103,101,116,83,105,122,101,59,10,35,101,108,105,102,32,84,69,88,84,85,82,69,95,77,65,80,80,73,78,71,10,9,118,101,99,50,32,116,101,120,67,111,111,114,100,32,61,32,118,84,101,120,67,111,111,114,100,59,10,35,101,110,100,105,102,10,10,35,105,102,32,68,73,70,70,85,83,69,95,77,65,80,80,73,78,71,10,9,102,114,97,103,109,101,110,116,67,111,108,111,114,32,42,61,32,116,101,120,116,117,114,101,40,77,97,116,101,114,105,97,108,68,105,102,102,117,115,101,77,97,112,44,32,116,101,120,67,111,111,114,100,41,59,10,35,101,110,100,105,102,10,10,35,105,102,32,65,76,80,72,65,95,77,65,80,80,73,78,71,10,9,102,114,97,103,109,101,110,116,67,111,108,111,114,46,97,32,42,61,32,116,101,120,116,117,114,101,40,77,97,116,101,114,105,97,108,65,108,112,104,97,77,97,112,44,32,116,101,120,67,111,111,114,100,41,46,114,59,10,35,101,110,100,105,102,10,10,35,105,102,32,70,76,65,71,95,84,69,88,84,85,82,69,79,86,69,82,76,65,89,32,124,124,32,70,76,65,71,95,84,69,88,84,85,82,69,79,86,69,82,76,65,89,95,65,82,82,65,89,10,9,35,105,102,32,70,76,65,71,95,84,69,88,84,85,82,69,79,86,69,82,76,65,89,95,65,82,82,65,89,10,9,118,101,99,52,32,111,118,101,114,108,97,121,67,111,108,111,114,32,61,32,116,101,120,116,117,114,101,40,84,101,120,116,117,114,101,79,118,101,114,108,97,121,44,32,118,101,99,51,40,116,101,120,67,111,111,114,100,44,32,118,79,118,101,114,108,97,121,76,97,121,101,114,41,41,59,10,9,35,101,108,115,101,10,9,118,101,99,52,32,111,118,101,114,108,97,121,67,111,108,111,114,32,61,32,116,101,120,116,117,114,101,40,84,101,120,116,117,114,101,79,118,101,114,108,97,121,44,32,116,101,120,67,111,111,114,100,41,59,10,9,35,101,110,100,105,102,10,10,9,35,105,102,32,68,73,83,84,65,78,67,69,95,70,73,69,76,68,10,9,47,47,32,76,97,32,115,117,112,101,114,112,111,115,105,116,105,111,110,32,99,111,110,116,105,101,110,116,32,108,97,32,100,105,115,116,97,110,99,101,32,115,105,103,110,195,169,101,32,97,117,32,99,111,110,116,111,117,114,32,40,195,160,32,48,46,53,41,44,32,108,105,115,115,195,169,101,32,115,117,114,32,108,97,32,116,97,105,108,108,101,32,100,39,117,110,32,112,105,120,101,108,32,195,160,32,108,39,195,169,99,114,97,110,10,9,102,108,111,97,116,32,100,105,115,116,97,110,99,101,32,61,32,111,118,101,114,108,97,121,67,111,108,111,114,46,97,59,10,9,102,108,111,97,116,32,115,109,111,111,116,104,105,110,103,32,61,32,48,46,55,32,42,32,102,119,105,100,116,104,40,100,105,115,116,97,110,99,101,41,59,10,9,111,118,101,114,108,97,121,67,111,108,111,114,46,97,32,61,32,115,109,111,111,116,104,115,116,101,112,40,48,46,53,32,45,32,115,109,111,111,116,104,105,110,103,44,32,48,46,53,32,43,32,115,109,111,111,116,104,105,110,103,44,32,100,105,115,116,97,110,99,101,41,59,10,9,35,101,110,100,105,102,10,10,9,102,114,97,103,109,101,110,116,67,111,108,111,114,32,42,61,32,111,118,101,114,108,97,121,67,111,108,111,114,59,10,35,101,110,100,105,102,10,10,35,105,102,32,65,76,80,72,65,95,84,69,83,84,10,9,105,102,32,40,102,114,97,103,109,101,110,116,67,111,108,111,114,46,97,32,60,32,77,97,116,101,114,105,97,108,65,108,112,104,97,84,104,114,101,115,104,111,108,100,41,10,9,9,100,105,115,99,97,114,100,59,10,35,101,110,100,105,102,10,10,35,105,102,32,79,82,68,69,82,95,73,78,68,69,80,69,78,68,69,78,84,95,84,82,65,78,83,80,65,82,69,78,67,89,10,9,87,114,105,116,101,84,114,97,110,115,112,97,114,101,110,116,70,114,97,103,109,101,110,116,40,102,114,97,103,109,101,110,116,67,111,108,111,114,41,59,10,35,101,108,115,101,10,9,82,101,110,100,101,114,84,97,114,103,101,116,48,32,61,32,102,114,97,103,109,101,110,116,67,111,108,111,114,59,10,35,101,110,100,105,102,10,125,
\ No newline at end of file
@@ -1,5 +1,11 @@
 /********************Entrant********************/
-#if FLAG_BILLBOARD
+#if FLAG_SPRITE
+in vec3 InstanceData0; // left top corner
+in vec3 InstanceData1; // right edge
+in vec3 InstanceData2; // down edge
+in vec4 InstanceData3; // texture coords rect
+in vec4 InstanceData4; // color
+#elif FLAG_BILLBOARD
 in vec3 InstanceData0; // center
 in vec4 InstanceData1; // size | sin cos
 in vec4 InstanceData2; // color
@@ -11,13 +17,22 @@ in vec4 VertexColor;
 in vec3 VertexPosition;
 in vec2 VertexTexCoord;
 in vec4 VertexUserdata0;
+#if FLAG_SKINNING
+in ivec4 VertexUserdata1; // joint indices (VertexUserdata0 holds the weights)
+#endif
 
 /********************Sortant********************/
 out vec4 vColor;
+#if FLAG_TEXTUREOVERLAY_ARRAY
+out float vOverlayLayer;
+#endif
 out vec2 vTexCoord;
 
 /********************Uniformes********************/
 uniform float VertexDepth;
+#if FLAG_SKINNING
+uniform mat4 SkinningMatrices[64]; // NAZARA_GRAPHICS_MAX_SKINNING_JOINTS
+#endif
 uniform mat4 ViewMatrix;
 uniform mat4 ViewProjMatrix;
 uniform mat4 WorldViewProjMatrix;
@@ -25,6 +40,16 @@ uniform mat4 WorldViewProjMatrix;
 /********************Fonctions********************/
 void main()
 {
+#if FLAG_SKINNING
+	mat4 skinningMatrix = SkinningMatrices[VertexUserdata1.x] * VertexUserdata0.x +
+	                      SkinningMatrices[VertexUserdata1.y] * VertexUserdata0.y +
+	                      SkinningMatrices[VertexUserdata1.z] * VertexUserdata0.z +
+	                      SkinningMatrices[VertexUserdata1.w] * VertexUserdata0.w;
+	vec3 position = vec3(skinningMatrix * vec4(VertexPosition, 1.0));
+#else
+	vec3 position = VertexPosition;
+#endif
+
 #if FLAG_VERTEXCOLOR
 	vec4 color = VertexColor;
 #else
@@ -33,7 +58,15 @@ void main()
 
 	vec2 texCoords;
 
-#if FLAG_BILLBOARD
+#if FLAG_SPRITE
+	// The quad corners are given by the vertices (-0.5, -0.5) to (0.5, 0.5), the y axis going up
+	vec2 spriteCorner = vec2(position.x + 0.5, 0.5 - position.y);
+	vec3 vertexPos = InstanceData0 + InstanceData1*spriteCorner.x + InstanceData2*spriteCorner.y;
+
+	gl_Position = ViewProjMatrix * vec4(vertexPos, 1.0);
+	color = InstanceData4;
+	texCoords = InstanceData3.xy + InstanceData3.zw*spriteCorner;
+#elif FLAG_BILLBOARD
 	#if FLAG_INSTANCING
 	vec3 billboardCenter = InstanceData0;
 	vec2 billboardSize = InstanceData1.xy;
@@ -41,8 +74,8 @@ void main()
 	vec4 billboardColor = InstanceData2;
 
 	vec2 rotatedPosition;
-	rotatedPosition.x = VertexPosition.x*billboardSinCos.y - VertexPosition.y*billboardSinCos.x;
-	rotatedPosition.y = VertexPosition.y*billboardSinCos.y + VertexPosition.x*billboardSinCos.x;
+	rotatedPosition.x = position.x*billboardSinCos.y - position.y*billboardSinCos.x;
+	rotatedPosition.y = position.y*billboardSinCos.y + position.x*billboardSinCos.x;
 	rotatedPosition *= billboardSize;
 
 	vec3 cameraRight = vec3(ViewMatrix[0][0], ViewMatrix[1][0], ViewMatrix[2][0]);
@@ -51,7 +84,7 @@ void main()
 
 	gl_Position = ViewProjMatrix * vec4(vertexPos, 1.0);
 	color = billboardColor;
-	texCoords = VertexPosition.xy + 0.5;
+	texCoords = position.xy + 0.5;
 	#else
 	vec2 billboardCorner = VertexTexCoord - 0.5;
 	vec2 billboardSize = VertexUserdata0.xy;
@@ -64,7 +97,7 @@ void main()
 
 	vec3 cameraRight = vec3(ViewMatrix[0][0], ViewMatrix[1][0], ViewMatrix[2][0]);
 	vec3 cameraUp = vec3(ViewMatrix[0][1], ViewMatrix[1][1], ViewMatrix[2][1]);
-	vec3 vertexPos = VertexPosition + cameraRight*rotatedPosition.x + cameraUp*rotatedPosition.y;
+	vec3 vertexPos = position + cameraRight*rotatedPosition.x + cameraUp*rotatedPosition.y;
 
 	gl_Position = ViewProjMatrix * vec4(vertexPos, 1.0);
 	texCoords = VertexTexCoord;
@@ -73,22 +106,22 @@ void main()
 #else
 	#if FLAG_INSTANCING
 		#if TRANSFORM
-	gl_Position = ViewProjMatrix * InstanceData0 * vec4(VertexPosition, 1.0);
+	gl_Position = ViewProjMatrix * InstanceData0 * vec4(position, 1.0);
 		#else
 			#if UNIFORM_VERTEX_DEPTH
-	gl_Position = InstanceData0 * vec4(VertexPosition.xy, VertexDepth, 1.0);
+	gl_Position = InstanceData0 * vec4(position.xy, VertexDepth, 1.0);
 			#else
-	gl_Position = InstanceData0 * vec4(VertexPosition, 1.0);
+	gl_Position = InstanceData0 * vec4(position, 1.0);
 			#endif
 		#endif
 	#else
 		#if TRANSFORM
-	gl_Position = WorldViewProjMatrix * vec4(VertexPosition, 1.0);
+	gl_Position = WorldViewProjMatrix * vec4(position, 1.0);
 		#else
 			#if UNIFORM_VERTEX_DEPTH
-	gl_Position = vec4(VertexPosition.xy, VertexDepth, 1.0);
+	gl_Position = vec4(position.xy, VertexDepth, 1.0);
 			#else
-	gl_Position = vec4(VertexPosition, 1.0);
+	gl_Position = vec4(position, 1.0);
 			#endif
 		#endif
 	#endif
@@ -97,6 +130,9 @@ void main()
 #endif
 
 	vColor = color;
+#if FLAG_TEXTUREOVERLAY_ARRAY
+	vOverlayLayer = VertexUserdata0.x;
+#endif
 #if TEXTURE_MAPPING
 	vTexCoord = vec2(texCoords);
 #endif
@@ -0,0 +1,18 @@
+#version 150
+
+/********************Entrant********************/
+in vec4 gColor;
+in vec2 gTexCoord;
+
+/********************Sortant********************/
+out vec4 RenderTarget0;
+
+/********************Uniformes********************/
+uniform vec4 MaterialDiffuse;
+uniform sampler2D MaterialDiffuseMap;
+
+/********************Fonctions********************/
+void main()
+{
+	RenderTarget0 = MaterialDiffuse * gColor * texture(MaterialDiffuseMap, gTexCoord);
+}
@@ -0,0 +1 @@
+35,118,101,114,115,105,111,110,32,49,53,48,10,10,108,97,121,111,117,116,40,112,111,105,110,116,115,41,32,105,110,59,10,108,97,121,111,117,116,40,116,114,105,97,110,103,108,101,95,115,116,114,105,112,44,32,109,97,120,95,118,101,114,116,105,99,101,115,32,61,32,52,41,32,111,117,116,59,10,10,47,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,69,110,116,114,97,110,116,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,47,10,105,110,32,118,101,99,52,32,118,67,111,108,111,114,91,93,59,10,105,110,32,102,108,111,97,116,32,118,76,105,102,101,91,93,59,10,105,110,32,102,108,111,97,116,32,118,82,111,116,97,116,105,111,110,91,93,59,10,105,110,32,118,101,99,50,32,118,83,105,122,101,91,93,59,10,10,47,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,83,111,114,116,97,110,116,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,47,10,111,117,116,32,118,101,99,52,32,103,67,111,108,111,114,59,10,111,117,116,32,118,101,99,50,32,103,84,101,120,67,111,111,114,100,59,10,10,47,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,85,110,105,102,111,114,109,101,115,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,47,10,117,110,105,102,111,114,109,32,109,97,116,52,32,80,114,111,106,77,97,116,114,105,120,59,10,10,47,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,70,111,110,99,116,105,111,110,115,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,47,10,118,111,105,100,32,109,97,105,110,40,41,10,123,10,9,47,47,32,76,101,115,32,112,108,97,99,101,115,32,100,101,115,32,112,97,114,116,105,99,117,108,101,115,32,109,111,114,116,101,115,32,114,101,115,116,101,110,116,32,100,97,110,115,32,108,101,32,116,97,109,112,111,110,44,32,101,108,108,101,115,32,110,101,32,112,114,111,100,117,105,115,101,110,116,32,114,105,101,110,10,9,105,102,32,40,118,76,105,102,101,91,48,93,32,60,61,32,48,46,48,41,10,9,9,114,101,116,117,114,110,59,10,10,9,118,101,99,50,32,115,105,110,67,111,115,32,61,32,118,101,99,50,40,115,105,110,40,118,82,111,116,97,116,105,111,110,91,48,93,41,44,32,99,111,115,40,118,82,111,116,97,116,105,111,110,91,48,93,41,41,59,10,10,9,99,111,110,115,116,32,118,101,99,50,32,99,111,114,110,101,114,115,91,52,93,32,61,32,118,101,99,50,91,93,40,118,101,99,50,40,45,48,46,53,44,32,45,48,46,53,41,44,32,118,101,99,50,40,48,46,53,44,32,45,48,46,53,41,44,32,118,101,99,50,40,45,48,46,53,44,32,48,46,53,41,44,32,118,101,99,50,40,48,46,53,44,32,48,46,53,41,41,59,10,9,102,111,114,32,40,105,110,116,32,105,32,61,32,48,59,32,105,32,60,32,52,59,32,43,43,105,41,10,9,123,10,9,9,118,101,99,50,32,99,111,114,110,101,114,32,61,32,99,111,114,110,101,114,115,91,105,93,32,42,32,118,83,105,122,101,91,48,93,59,10,9,9,118,101,99,50,32,111,102,102,115,101,116,32,61,32,118,101,99,50,40,99,111,114,110,101,114,46,120,42,115,105,110,67,111,115,46,121,32,45,32,99,111,114,110,101,114,46,121,42,115,105,110,67,111,115,46,120,44,32,99,111,114,110,101,114,46,120,42,115,105,110,67,111,115,46,120,32,43,32,99,111,114,110,101,114,46,121,42,115,105,110,67,111,115,46,121,41,59,10,10,9,9,103,67,111,108,111,114,32,61,32,118,67,111,108,111,114,91,48,93,59,10,9,9,103,84,101,120,67,111,111,114,100,32,61,32,118,101,99,50,40,99,111,114,110,101,114,115,91,105,93,46,120,32,43,32,48,46,53,44,32,48,46,53,32,45,32,99,111,114,110,101,114,115,91,105,93,46,121,41,59,10,9,9,103,108,95,80,111,115,105,116,105,111,110,32,61,32,80,114,111,106,77,97,116,114,105,120,32,42,32,40,103,108,95,105,110,91,48,93,46,103,108,95,80,111,115,105,116,105,111,110,32,43,32,118,101,99,52,40,111,102,102,115,101,116,44,32,48,46,48,44,32,48,46,48,41,41,59,10,9,9,69,109,105,116,86,101,114,116,101,120,40,41,59,10,9,125,10,10,9,69,110,100,80,114,105,109,105,116,105,118,101,40,41,59,10,125,10,
\ No newline at end of file
@@ -0,0 +1,35 @@
+#version 150
+
+/********************Entrant********************/
+in vec4 VertexColor;
+in vec3 VertexPosition;
+in vec2 VertexTexCoord;   // Taille
+in float VertexUserdata0; // Vie restante
+in float VertexUserdata2; // Durée de vie à la naissance
+in float VertexUserdata3; // Rotation (en degrés)
+
+/********************Sortant********************/
+out vec4 vColor;
+out float vLife;
+out float vRotation;
+out vec2 vSize;
+
+/********************Uniformes********************/
+uniform vec4 FinalColor;
+uniform float FinalSizeFactor;
+uniform mat4 ViewMatrix;
+
+/********************Fonctions********************/
+void main()
+{
+	// Part de la vie écoulée, de 0 à la naissance à 1 à la mort
+	float age = 1.0 - VertexUserdata0 / max(VertexUserdata2, 0.0001);
+
+	vColor = VertexColor * mix(vec4(1.0), FinalColor, age);
+	vLife = VertexUserdata0;
+	vRotation = radians(VertexUserdata3);
+	vSize = VertexTexCoord * mix(1.0, FinalSizeFactor, age);
+
+	// Le quad est construit face à la caméra, dans l'espace de la vue
+	gl_Position = ViewMatrix * vec4(VertexPosition, 1.0);
+}
@@ -0,0 +1 @@
+35,118,101,114,115,105,111,110,32,49,53,48,10,10,47,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,69,110,116,114,97,110,116,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,47,10,105,110,32,118,101,99,52,32,86,101,114,116,101,120,67,111,108,111,114,59,10,105,110,32,118,101,99,51,32,86,101,114,116,101,120,80,111,115,105,116,105,111,110,59,10,105,110,32,118,101,99,50,32,86,101,114,116,101,120,84,101,120,67,111,111,114,100,59,32,32,32,47,47,32,84,97,105,108,108,101,10,105,110,32,102,108,111,97,116,32,86,101,114,116,101,120,85,115,101,114,100,97,116,97,48,59,32,47,47,32,86,105,101,32,114,101,115,116,97,110,116,101,10,105,110,32,102,108,111,97,116,32,86,101,114,116,101,120,85,115,101,114,100,97,116,97,50,59,32,47,47,32,68,117,114,195,169,101,32,100,101,32,118,105,101,32,195,160,32,108,97,32,110,97,105,115,115,97,110,99,101,10,105,110,32,102,108,111,97,116,32,86,101,114,116,101,120,85,115,101,114,100,97,116,97,51,59,32,47,47,32,82,111,116,97,116,105,111,110,32,40,101,110,32,100,101,103,114,195,169,115,41,10,10,47,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,83,111,114,116,97,110,116,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,47,10,111,117,116,32,118,101,99,52,32,118,67,111,108,111,114,59,10,111,117,116,32,102,108,111,97,116,32,118,76,105,102,101,59,10,111,117,116,32,102,108,111,97,116,32,118,82,111,116,97,116,105,111,110,59,10,111,117,116,32,118,101,99,50,32,118,83,105,122,101,59,10,10,47,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,85,110,105,102,111,114,109,101,115,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,47,10,117,110,105,102,111,114,109,32,118,101,99,52,32,70,105,110,97,108,67,111,108,111,114,59,10,117,110,105,102,111,114,109,32,102,108,111,97,116,32,70,105,110,97,108,83,105,122,101,70,97,99,116,111,114,59,10,117,110,105,102,111,114,109,32,109,97,116,52,32,86,105,101,119,77,97,116,114,105,120,59,10,10,47,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,70,111,110,99,116,105,111,110,115,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,47,10,118,111,105,100,32,109,97,105,110,40,41,10,123,10,9,47,47,32,80,97,114,116,32,100,101,32,108,97,32,118,105,101,32,195,169,99,111,117,108,195,169,101,44,32,100,101,32,48,32,195,160,32,108,97,32,110,97,105,115,115,97,110,99,101,32,195,160,32,49,32,195,160,32,108,97,32,109,111,114,116,10,9,102,108,111,97,116,32,97,103,101,32,61,32,49,46,48,32,45,32,86,101,114,116,101,120,85,115,101,114,100,97,116,97,48,32,47,32,109,97,120,40,86,101,114,116,101,120,85,115,101,114,100,97,116,97,50,44,32,48,46,48,48,48,49,41,59,10,10,9,118,67,111,108,111,114,32,61,32,86,101,114,116,101,120,67,111,108,111,114,32,42,32,109,105,120,40,118,101,99,52,40,49,46,48,41,44,32,70,105,110,97,108,67,111,108,111,114,44,32,97,103,101,41,59,10,9,118,76,105,102,101,32,61,32,86,101,114,116,101,120,85,115,101,114,100,97,116,97,48,59,10,9,118,82,111,116,97,116,105,111,110,32,61,32,114,97,100,105,97,110,115,40,86,101,114,116,101,120,85,115,101,114,100,97,116,97,51,41,59,10,9,118,83,105,122,101,32,61,32,86,101,114,116,101,120,84,101,120,67,111,111,114,100,32,42,32,109,105,120,40,49,46,48,44,32,70,105,110,97,108,83,105,122,101,70,97,99,116,111,114,44,32,97,103,101,41,59,10,10,9,47,47,32,76,101,32,113,117,97,100,32,101,115,116,32,99,111,110,115,116,114,117,105,116,32,102,97,99,101,32,195,160,32,108,97,32,99,97,109,195,169,114,97,44,32,100,97,110,115,32,108,39,101,115,112,97,99,101,32,100,101,32,108,97,32,118,117,101,10,9,103,108,95,80,111,115,105,116,105,111,110,32,61,32,86,105,101,119,77,97,116,114,105,120,32,42,32,118,101,99,52,40,86,101,114,116,101,120,80,111,115,105,116,105,111,110,44,32,49,46,48,41,59,10,125,10,
\ No newline at end of file
@@ -0,0 +1,39 @@
+#version 140
+
+/********************Entrant********************/
+in vec4 VertexColor;
+in vec3 VertexPosition;
+in vec2 VertexTexCoord;   // Taille
+in float VertexUserdata0; // Vie restante
+in vec3 VertexUserdata1;  // Vitesse
+in float VertexUserdata2; // Durée de vie à la naissance
+in float VertexUserdata3; // Rotation (en degrés)
+
+/********************Sortant********************/
+// Dans l'ordre du tampon, les sorties y étant écrites les unes à la suite des autres
+out vec4 tfColor;
+out vec3 tfPosition;
+out float tfLife;
+out vec3 tfVelocity;
+out float tfLifetime;
+out vec2 tfSize;
+out float tfRotation;
+
+/********************Uniformes********************/
+uniform vec3 Acceleration;
+uniform float AngularVelocity;
+uniform float ElapsedTime;
+
+/********************Fonctions********************/
+void main()
+{
+	vec3 velocity = VertexUserdata1 + Acceleration * ElapsedTime;
+
+	tfColor = VertexColor;
+	tfPosition = VertexPosition + velocity * ElapsedTime;
+	tfLife = max(VertexUserdata0 - ElapsedTime, 0.0); // Une particule morte garde sa place jusqu'à ce qu'une nouvelle la reprenne
+	tfVelocity = velocity;
+	tfLifetime = VertexUserdata2;
+	tfSize = VertexTexCoord;
+	tfRotation = VertexUserdata3 + AngularVelocity * ElapsedTime;
+}
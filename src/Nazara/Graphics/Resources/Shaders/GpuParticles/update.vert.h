@@ -0,0 +1 @@
+35,118,101,114,115,105,111,110,32,49,52,48,10,10,47,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,69,110,116,114,97,110,116,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,47,10,105,110,32,118,101,99,52,32,86,101,114,116,101,120,67,111,108,111,114,59,10,105,110,32,118,101,99,51,32,86,101,114,116,101,120,80,111,115,105,116,105,111,110,59,10,105,110,32,118,101,99,50,32,86,101,114,116,101,120,84,101,120,67,111,111,114,100,59,32,32,32,47,47,32,84,97,105,108,108,101,10,105,110,32,102,108,111,97,116,32,86,101,114,116,101,120,85,115,101,114,100,97,116,97,48,59,32,47,47,32,86,105,101,32,114,101,115,116,97,110,116,101,10,105,110,32,118,101,99,51,32,86,101,114,116,101,120,85,115,101,114,100,97,116,97,49,59,32,32,47,47,32,86,105,116,101,115,115,101,10,105,110,32,102,108,111,97,116,32,86,101,114,116,101,120,85,115,101,114,100,97,116,97,50,59,32,47,47,32,68,117,114,195,169,101,32,100,101,32,118,105,101,32,195,160,32,108,97,32,110,97,105,115,115,97,110,99,101,10,105,110,32,102,108,111,97,116,32,86,101,114,116,101,120,85,115,101,114,100,97,116,97,51,59,32,47,47,32,82,111,116,97,116,105,111,110,32,40,101,110,32,100,101,103,114,195,169,115,41,10,10,47,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,83,111,114,116,97,110,116,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,47,10,47,47,32,68,97,110,115,32,108,39,111,114,100,114,101,32,100,117,32,116,97,109,112,111,110,44,32,108,101,115,32,115,111,114,116,105,101,115,32,121,32,195,169,116,97,110,116,32,195,169,99,114,105,116,101,115,32,108,101,115,32,117,110,101,115,32,195,160,32,108,97,32,115,117,105,116,101,32,100,101,115,32,97,117,116,114,101,115,10,111,117,116,32,118,101,99,52,32,116,102,67,111,108,111,114,59,10,111,117,116,32,118,101,99,51,32,116,102,80,111,115,105,116,105,111,110,59,10,111,117,116,32,102,108,111,97,116,32,116,102,76,105,102,101,59,10,111,117,116,32,118,101,99,51,32,116,102,86,101,108,111,99,105,116,121,59,10,111,117,116,32,102,108,111,97,116,32,116,102,76,105,102,101,116,105,109,101,59,10,111,117,116,32,118,101,99,50,32,116,102,83,105,122,101,59,10,111,117,116,32,102,108,111,97,116,32,116,102,82,111,116,97,116,105,111,110,59,10,10,47,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,85,110,105,102,111,114,109,101,115,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,47,10,117,110,105,102,111,114,109,32,118,101,99,51,32,65,99,99,101,108,101,114,97,116,105,111,110,59,10,117,110,105,102,111,114,109,32,102,108,111,97,116,32,65,110,103,117,108,97,114,86,101,108,111,99,105,116,121,59,10,117,110,105,102,111,114,109,32,102,108,111,97,116,32,69,108,97,112,115,101,100,84,105,109,101,59,10,10,47,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,70,111,110,99,116,105,111,110,115,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,47,10,118,111,105,100,32,109,97,105,110,40,41,10,123,10,9,118,101,99,51,32,118,101,108,111,99,105,116,121,32,61,32,86,101,114,116,101,120,85,115,101,114,100,97,116,97,49,32,43,32,65,99,99,101,108,101,114,97,116,105,111,110,32,42,32,69,108,97,112,115,101,100,84,105,109,101,59,10,10,9,116,102,67,111,108,111,114,32,61,32,86,101,114,116,101,120,67,111,108,111,114,59,10,9,116,102,80,111,115,105,116,105,111,110,32,61,32,86,101,114,116,101,120,80,111,115,105,116,105,111,110,32,43,32,118,101,108,111,99,105,116,121,32,42,32,69,108,97,112,115,101,100,84,105,109,101,59,10,9,116,102,76,105,102,101,32,61,32,109,97,120,40,86,101,114,116,101,120,85,115,101,114,100,97,116,97,48,32,45,32,69,108,97,112,115,101,100,84,105,109,101,44,32,48,46,48,41,59,32,47,47,32,85,110,101,32,112,97,114,116,105,99,117,108,101,32,109,111,114,116,101,32,103,97,114,100,101,32,115,97,32,112,108,97,99,101,32,106,117,115,113,117,39,195,160,32,99,101,32,113,117,39,117,110,101,32,110,111,117,118,101,108,108,101,32,108,97,32,114,101,112,114,101,110,110,101,10,9,116,102,86,101,108,111,99,105,116,121,32,61,32,118,101,108,111,99,105,116,121,59,10,9,116,102,76,105,102,101,116,105,109,101,32,61,32,86,101,114,116,101,120,85,115,101,114,100,97,116,97,50,59,10,9,116,102,83,105,122,101,32,61,32,86,101,114,116,101,120,84,101,120,67,111,111,114,100,59,10,9,116,102,82,111,116,97,116,105,111,110,32,61,32,86,101,114,116,101,120,85,115,101,114,100,97,116,97,51,32,43,32,65,110,103,117,108,97,114,86,101,108,111,99,105,116,121,32,42,32,69,108,97,112,115,101,100,84,105,109,101,59,10,125,10,
\ No newline at end of file
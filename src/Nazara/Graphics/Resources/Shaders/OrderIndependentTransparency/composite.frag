@@ -0,0 +1,27 @@
+#version 140
+
+/********************Sortant********************/
+out vec4 RenderTarget0;
+
+/********************Uniformes********************/
+uniform sampler2D AccumulationTexture;
+uniform sampler2D RevealageTexture;
+
+/********************Fonctions********************/
+void main()
+{
+	ivec2 texCoord = ivec2(gl_FragCoord.xy);
+
+	// Somme des -log(1 - alpha) des surfaces transparentes recouvrant le pixel
+	float opticalDepth = texelFetch(RevealageTexture, texCoord, 0).r;
+	if (opticalDepth <= 0.0)
+		discard;
+
+	vec4 accumulation = texelFetch(AccumulationTexture, texCoord, 0);
+
+	// Moyenne pondérée des couleurs, la part de la scène restant visible est l'exponentielle de la somme
+	vec3 color = accumulation.rgb / max(accumulation.a, 0.00001);
+	float revealage = exp(-opticalDepth);
+
+	RenderTarget0 = vec4(color, revealage);
+}
@@ -0,0 +1 @@
+35,118,101,114,115,105,111,110,32,49,52,48,10,10,47,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,83,111,114,116,97,110,116,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,47,10,111,117,116,32,118,101,99,52,32,82,101,110,100,101,114,84,97,114,103,101,116,48,59,10,10,47,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,85,110,105,102,111,114,109,101,115,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,47,10,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,32,65,99,99,117,109,117,108,97,116,105,111,110,84,101,120,116,117,114,101,59,10,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,32,82,101,118,101,97,108,97,103,101,84,101,120,116,117,114,101,59,10,10,47,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,70,111,110,99,116,105,111,110,115,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,47,10,118,111,105,100,32,109,97,105,110,40,41,10,123,10,9,105,118,101,99,50,32,116,101,120,67,111,111,114,100,32,61,32,105,118,101,99,50,40,103,108,95,70,114,97,103,67,111,111,114,100,46,120,121,41,59,10,10,9,47,47,32,83,111,109,109,101,32,100,101,115,32,45,108,111,103,40,49,32,45,32,97,108,112,104,97,41,32,100,101,115,32,115,117,114,102,97,99,101,115,32,116,114,97,110,115,112,97,114,101,110,116,101,115,32,114,101,99,111,117,118,114,97,110,116,32,108,101,32,112,105,120,101,108,10,9,102,108,111,97,116,32,111,112,116,105,99,97,108,68,101,112,116,104,32,61,32,116,101,120,101,108,70,101,116,99,104,40,82,101,118,101,97,108,97,103,101,84,101,120,116,117,114,101,44,32,116,101,120,67,111,111,114,100,44,32,48,41,46,114,59,10,9,105,102,32,40,111,112,116,105,99,97,108,68,101,112,116,104,32,60,61,32,48,46,48,41,10,9,9,100,105,115,99,97,114,100,59,10,10,9,118,101,99,52,32,97,99,99,117,109,117,108,97,116,105,111,110,32,61,32,116,101,120,101,108,70,101,116,99,104,40,65,99,99,117,109,117,108,97,116,105,111,110,84,101,120,116,117,114,101,44,32,116,101,120,67,111,111,114,100,44,32,48,41,59,10,10,9,47,47,32,77,111,121,101,110,110,101,32,112,111,110,100,195,169,114,195,169,101,32,100,101,115,32,99,111,117,108,101,117,114,115,44,32,108,97,32,112,97,114,116,32,100,101,32,108,97,32,115,99,195,168,110,101,32,114,101,115,116,97,110,116,32,118,105,115,105,98,108,101,32,101,115,116,32,108,39,101,120,112,111,110,101,110,116,105,101,108,108,101,32,100,101,32,108,97,32,115,111,109,109,101,10,9,118,101,99,51,32,99,111,108,111,114,32,61,32,97,99,99,117,109,117,108,97,116,105,111,110,46,114,103,98,32,47,32,109,97,120,40,97,99,99,117,109,117,108,97,116,105,111,110,46,97,44,32,48,46,48,48,48,48,49,41,59,10,9,102,108,111,97,116,32,114,101,118,101,97,108,97,103,101,32,61,32,101,120,112,40,45,111,112,116,105,99,97,108,68,101,112,116,104,41,59,10,10,9,82,101,110,100,101,114,84,97,114,103,101,116,48,32,61,32,118,101,99,52,40,99,111,108,111,114,44,32,114,101,118,101,97,108,97,103,101,41,59,10,125,10,
\ No newline at end of file
@@ -1,3 +1,7 @@
+#if BINDLESS_TEXTURES
+#extension GL_ARB_bindless_texture : require
+#endif
+
 #if EARLY_FRAGMENT_TESTS && !ALPHA_TEST
 layout(early_fragment_tests) in;
 #endif
@@ -9,6 +13,16 @@ layout(early_fragment_tests) in;
 #endif
 // HACK
 
+#if FLAG_CLUSTEREDLIGHTING
+	// Les shadow maps sont envoyées par passe, ce que le rendu par clusters n'a pas
+	#undef SHADOW_MAPPING
+	#define SHADOW_MAPPING 0
+
+	#define LIGHT_COUNT 128 // NAZARA_GRAPHICS_MAX_LIGHTS_PER_SCENE
+#else
+	#define LIGHT_COUNT 3
+#endif
+
 #define LIGHT_DIRECTIONAL 0
 #define LIGHT_POINT 1
 #define LIGHT_SPOT 2
@@ -18,6 +32,9 @@ in vec4 vColor;
 in vec4 vLightSpacePos[3];
 in mat3 vLightToWorld;
 in vec3 vNormal;
+#if FLAG_TEXTUREOVERLAY_ARRAY
+in float vOverlayLayer;
+#endif
 in vec2 vTexCoord;
 in vec3 vViewDir;
 in vec3 vWorldPos;
@@ -30,33 +47,70 @@ out vec4 RenderTarget2;
 /********************Uniformes********************/
 struct Light
 {
-	int type;
 	vec4 color;
-	vec2 factors;
-
 	vec4 parameters1;
 	vec4 parameters2;
+	vec2 factors;
 	vec2 parameters3;
+
+	int type;
 	bool shadowMapping;
 };
 
 // Lumières
-uniform Light Lights[3];
+layout(std140) uniform LightBlock
+{
+	Light Lights[128]; // NAZARA_GRAPHICS_MAX_LIGHTS_PER_SCENE
+};
+
+uniform int LightIndices[3];
+
+#if FLAG_CLUSTEREDLIGHTING
+uniform usampler3D LightClusters; // Masque des lumières touchant chaque cluster
+uniform vec4 LightClusterParameters; // xy: clusters par pixel, z: échelle de log(profondeur), w: biais
+uniform vec2 LightClusterOffset;
+uniform mat4 ViewMatrix;
+#endif
+
 uniform samplerCube PointLightShadowMap[3];
 uniform sampler2D DirectionalSpotLightShadowMap[3];
+uniform vec4 LightShadowCascades[3*4]; // NAZARA_GRAPHICS_MAX_SHADOW_CASCADES par lumière, x: échelle, yz: décalage, w: taille dans la shadow map
 
 // Matériau
+layout(std140) uniform MaterialBlock
+{
+	vec4 MaterialAmbient;
+	vec4 MaterialDiffuse;
+	vec4 MaterialSpecular;
+	float MaterialAlphaThreshold;
+	float MaterialShininess;
+#if BINDLESS_TEXTURES
+	vec2 MaterialPadding;
+	uvec2 MaterialAlphaHandle;
+	uvec2 MaterialDiffuseHandle;
+	uvec2 MaterialEmissiveHandle;
+	uvec2 MaterialHeightHandle;
+	uvec2 MaterialNormalHandle;
+	uvec2 MaterialSpecularHandle;
+#endif
+};
+
+#if BINDLESS_TEXTURES
+// Les textures sont échantillonnées depuis leurs handles
+#define MaterialAlphaMap sampler2D(MaterialAlphaHandle)
+#define MaterialDiffuseMap sampler2D(MaterialDiffuseHandle)
+#define MaterialEmissiveMap sampler2D(MaterialEmissiveHandle)
+#define MaterialHeightMap sampler2D(MaterialHeightHandle)
+#define MaterialNormalMap sampler2D(MaterialNormalHandle)
+#define MaterialSpecularMap sampler2D(MaterialSpecularHandle)
+#else
 uniform sampler2D MaterialAlphaMap;
-uniform float MaterialAlphaThreshold;
-uniform vec4 MaterialAmbient;
-uniform vec4 MaterialDiffuse;
 uniform sampler2D MaterialDiffuseMap;
 uniform sampler2D MaterialEmissiveMap;
 uniform sampler2D MaterialHeightMap;
 uniform sampler2D MaterialNormalMap;
-uniform float MaterialShininess;
-uniform vec4 MaterialSpecular;
 uniform sampler2D MaterialSpecularMap;
+#endif
 
 // Autres
 uniform float ParallaxBias = -0.03;
@@ -66,7 +120,11 @@ uniform vec3 EyePosition;
 uniform samplerCube ReflectionMap;
 uniform vec4 SceneAmbient;
 
+#if FLAG_TEXTUREOVERLAY_ARRAY
+uniform sampler2DArray TextureOverlay;
+#else
 uniform sampler2D TextureOverlay;
+#endif
 
 /********************Fonctions********************/
 
@@ -87,11 +145,50 @@ float VectorToDepthValue(vec3 vec, float zNear, float zFar)
 	return (normZ + 1.0) * 0.5;
 }
 
+#if ORDER_INDEPENDENT_TRANSPARENCY
+void WriteTransparentFragment(vec4 color)
+{
+	// Transparence indépendante de l'ordre (weighted blended) : les surfaces sont additionnées sans tri, les plus proches pesant davantage
+	float weight = color.a * clamp(3000.0 * pow(1.0 - gl_FragCoord.z, 3.0), 0.01, 3000.0);
+
+	RenderTarget0 = vec4(color.rgb * color.a, color.a) * weight;
+	RenderTarget1 = vec4(-log(1.0 - min(color.a, 0.999))); // La transmittance est un produit, son logarithme une somme
+}
+#endif
+
+#if FLAG_CLUSTEREDLIGHTING
+uvec4 FetchClusterLights()
+{
+	ivec3 clusterCount = textureSize(LightClusters, 0);
+	float viewDepth = -(ViewMatrix * vec4(vWorldPos, 1.0)).z;
+
+	ivec3 cluster;
+	cluster.xy = ivec2((gl_FragCoord.xy - LightClusterOffset) * LightClusterParameters.xy);
+	cluster.z = int(log(max(viewDepth, 0.0001)) * LightClusterParameters.z + LightClusterParameters.w);
+	cluster = clamp(cluster, ivec3(0), clusterCount - ivec3(1));
+
+	return texelFetch(LightClusters, cluster, 0);
+}
+#endif
+
 #if SHADOW_MAPPING
 float CalculateDirectionalShadowFactor(int lightIndex)
 {
 	vec4 lightSpacePos = vLightSpacePos[lightIndex];
-	return (texture(DirectionalSpotLightShadowMap[lightIndex], lightSpacePos.xy).x >= (lightSpacePos.z - 0.0005)) ? 1.0 : 0.0;
+
+	// Les cascades partagent l'espace de la plus large, la plus fine contenant le fragment est utilisée
+	for (int i = 0; i < 4; ++i)
+	{
+		vec4 cascade = LightShadowCascades[lightIndex*4 + i];
+		vec2 cascadePos = lightSpacePos.xy * cascade.x + cascade.yz;
+		if (cascade.w > 0.0 && all(greaterThanEqual(cascadePos, vec2(0.0))) && all(lessThanEqual(cascadePos, vec2(1.0))))
+		{
+			vec2 shadowMapPos = (cascadePos + vec2(i & 1, i >> 1)) * cascade.w;
+			return (texture(DirectionalSpotLightShadowMap[lightIndex], shadowMapPos).x >= (lightSpacePos.z - 0.0005)) ? 1.0 : 0.0;
+		}
+	}
+
+	return 1.0;
 }
 
 float CalculatePointShadowFactor(int lightIndex, vec3 lightToWorld, float zNear, float zFar)
@@ -137,7 +234,9 @@ void main()
 	diffuseColor *= texture(MaterialDiffuseMap, texCoord);
 #endif
 
-#if FLAG_TEXTUREOVERLAY
+#if FLAG_TEXTUREOVERLAY_ARRAY
+	diffuseColor *= texture(TextureOverlay, vec3(texCoord, vOverlayLayer));
+#elif FLAG_TEXTUREOVERLAY
 	diffuseColor *= texture(TextureOverlay, texCoord);
 #endif
 
@@ -191,21 +290,45 @@ void main()
 	vec3 normal = normalize(vNormal);
 	#endif
 
+	#if FLAG_CLUSTEREDLIGHTING
+	uvec4 clusterLights = FetchClusterLights();
+	#endif
+
 	if (MaterialShininess > 0.0)
 	{
 		vec3 eyeVec = normalize(EyePosition - vWorldPos);
 
-		for (int i = 0; i < 3; ++i)
+		for (int i = 0; i < LIGHT_COUNT; ++i)
 		{
-			vec4 lightColor = Lights[i].color;
-			float lightAmbientFactor = Lights[i].factors.x;
-			float lightDiffuseFactor = Lights[i].factors.y;
+			#if FLAG_CLUSTEREDLIGHTING
+			uint lightBits = clusterLights[i >> 5] >> uint(i & 31);
+			if (lightBits == 0u)
+			{
+				i |= 31; // Plus aucune lumière dans ce mot
+				continue;
+			}
+
+			if ((lightBits & 1u) == 0u)
+				continue;
+
+			int lightIndex = i;
+			#else
+			int lightIndex = LightIndices[i];
+			if (lightIndex < 0)
+				continue;
+			#endif
 
-			switch (Lights[i].type)
+			Light light = Lights[lightIndex];
+
+			vec4 lightColor = light.color;
+			float lightAmbientFactor = light.factors.x;
+			float lightDiffuseFactor = light.factors.y;
+
+			switch (light.type)
 			{
 				case LIGHT_DIRECTIONAL:
 				{
-					vec3 lightDir = -Lights[i].parameters1.xyz;
+					vec3 lightDir = -light.parameters1.xyz;
 
 					// Ambient
 					lightAmbient += lightColor.rgb * lightAmbientFactor * (MaterialAmbient.rgb + SceneAmbient.rgb);
@@ -213,7 +336,7 @@ void main()
 					float att = 1.0;
 
 					#if SHADOW_MAPPING
-					if (Lights[i].shadowMapping)
+					if (light.shadowMapping)
 					{
 						float shadowFactor = CalculateDirectionalShadowFactor(i);
 						if (shadowFactor == 0.0)
@@ -239,9 +362,9 @@ void main()
 
 				case LIGHT_POINT:
 				{
-					vec3 lightPos = Lights[i].parameters1.xyz;
-					float lightAttenuation = Lights[i].parameters1.w;
-					float lightInvRadius = Lights[i].parameters2.w;
+					vec3 lightPos = light.parameters1.xyz;
+					float lightAttenuation = light.parameters1.w;
+					float lightInvRadius = light.parameters2.w;
 					
 					vec3 worldToLight = lightPos - vWorldPos;
 					float lightDirLength = length(worldToLight);
@@ -253,7 +376,7 @@ void main()
 					lightAmbient += att * lightColor.rgb * lightAmbientFactor * (MaterialAmbient.rgb + SceneAmbient.rgb);
 
 					#if SHADOW_MAPPING
-					if (Lights[i].shadowMapping)
+					if (light.shadowMapping)
 					{
 						float shadowFactor = CalculatePointShadowFactor(i, vWorldPos - lightPos, 0.1, 50.0);
 						if (shadowFactor == 0.0)
@@ -279,12 +402,12 @@ void main()
 
 				case LIGHT_SPOT:
 				{
-					vec3 lightPos = Lights[i].parameters1.xyz;
-					vec3 lightDir = Lights[i].parameters2.xyz;
-					float lightAttenuation = Lights[i].parameters1.w;
-					float lightInvRadius = Lights[i].parameters2.w;
-					float lightInnerAngle = Lights[i].parameters3.x;
-					float lightOuterAngle = Lights[i].parameters3.y;
+					vec3 lightPos = light.parameters1.xyz;
+					vec3 lightDir = light.parameters2.xyz;
+					float lightAttenuation = light.parameters1.w;
+					float lightInvRadius = light.parameters2.w;
+					float lightInnerAngle = light.parameters3.x;
+					float lightOuterAngle = light.parameters3.y;
 
 					vec3 worldToLight = lightPos - vWorldPos;
 					float lightDistance = length(worldToLight);
@@ -296,7 +419,7 @@ void main()
 					lightAmbient += att * lightColor.rgb * lightAmbientFactor * (MaterialAmbient.rgb + SceneAmbient.rgb);
 
 					#if SHADOW_MAPPING
-					if (Lights[i].shadowMapping)
+					if (light.shadowMapping)
 					{
 						float shadowFactor = CalculateSpotShadowFactor(i);
 						if (shadowFactor == 0.0)
@@ -332,17 +455,37 @@ void main()
 	}
 	else
 	{
-		for (int i = 0; i < 3; ++i)
+		for (int i = 0; i < LIGHT_COUNT; ++i)
 		{
-			vec4 lightColor = Lights[i].color;
-			float lightAmbientFactor = Lights[i].factors.x;
-			float lightDiffuseFactor = Lights[i].factors.y;
+			#if FLAG_CLUSTEREDLIGHTING
+			uint lightBits = clusterLights[i >> 5] >> uint(i & 31);
+			if (lightBits == 0u)
+			{
+				i |= 31; // Plus aucune lumière dans ce mot
+				continue;
+			}
 
-			switch (Lights[i].type)
+			if ((lightBits & 1u) == 0u)
+				continue;
+
+			int lightIndex = i;
+			#else
+			int lightIndex = LightIndices[i];
+			if (lightIndex < 0)
+				continue;
+			#endif
+
+			Light light = Lights[lightIndex];
+
+			vec4 lightColor = light.color;
+			float lightAmbientFactor = light.factors.x;
+			float lightDiffuseFactor = light.factors.y;
+
+			switch (light.type)
 			{
 				case LIGHT_DIRECTIONAL:
 				{
-					vec3 lightDir = -Lights[i].parameters1.xyz;
+					vec3 lightDir = -light.parameters1.xyz;
 
 					// Ambient
 					lightAmbient += lightColor.rgb * lightAmbientFactor * (MaterialAmbient.rgb + SceneAmbient.rgb);
@@ -350,7 +493,7 @@ void main()
 					float att = 1.0;
 
 					#if SHADOW_MAPPING
-					if (Lights[i].shadowMapping)
+					if (light.shadowMapping)
 					{
 						float shadowFactor = CalculateDirectionalShadowFactor(i);
 						if (shadowFactor == 0.0)
@@ -369,9 +512,9 @@ void main()
 
 				case LIGHT_POINT:
 				{
-					vec3 lightPos = Lights[i].parameters1.xyz;
-					float lightAttenuation = Lights[i].parameters1.w;
-					float lightInvRadius = Lights[i].parameters2.w;
+					vec3 lightPos = light.parameters1.xyz;
+					float lightAttenuation = light.parameters1.w;
+					float lightInvRadius = light.parameters2.w;
 					
 					vec3 worldToLight = lightPos - vWorldPos;
 					float lightDirLength = length(worldToLight);
@@ -383,7 +526,7 @@ void main()
 					lightAmbient += att * lightColor.rgb * lightAmbientFactor * (MaterialAmbient.rgb + SceneAmbient.rgb);
 
 					#if SHADOW_MAPPING
-					if (Lights[i].shadowMapping)
+					if (light.shadowMapping)
 					{
 						float shadowFactor = CalculatePointShadowFactor(i, vWorldPos - lightPos, 0.1, 50.0);
 						if (shadowFactor == 0.0)
@@ -402,12 +545,12 @@ void main()
 
 				case LIGHT_SPOT:
 				{
-					vec3 lightPos = Lights[i].parameters1.xyz;
-					vec3 lightDir = Lights[i].parameters2.xyz;
-					float lightAttenuation = Lights[i].parameters1.w;
-					float lightInvRadius = Lights[i].parameters2.w;
-					float lightInnerAngle = Lights[i].parameters3.x;
-					float lightOuterAngle = Lights[i].parameters3.y;
+					vec3 lightPos = light.parameters1.xyz;
+					vec3 lightDir = light.parameters2.xyz;
+					float lightAttenuation = light.parameters1.w;
+					float lightInvRadius = light.parameters2.w;
+					float lightInnerAngle = light.parameters3.x;
+					float lightOuterAngle = light.parameters3.y;
 
 					vec3 worldToLight = lightPos - vWorldPos;
 					float lightDistance = length(worldToLight);
@@ -419,7 +562,7 @@ void main()
 					lightAmbient += att * lightColor.rgb * lightAmbientFactor * (MaterialAmbient.rgb + SceneAmbient.rgb);
 
 					#if SHADOW_MAPPING
-					if (Lights[i].shadowMapping)
+					if (light.shadowMapping)
 					{
 						float shadowFactor = CalculateSpotShadowFactor(i);
 						if (shadowFactor == 0.0)
@@ -466,10 +609,14 @@ void main()
 	float lightIntensity = dot(lightColor, vec3(0.3, 0.59, 0.11));
 
 	vec3 emissionColor = MaterialDiffuse.rgb * texture(MaterialEmissiveMap, texCoord).rgb;
-	RenderTarget0 = vec4(mix(fragmentColor.rgb, emissionColor, clamp(1.0 - 3.0*lightIntensity, 0.0, 1.0)), fragmentColor.a);
+	fragmentColor = vec4(mix(fragmentColor.rgb, emissionColor, clamp(1.0 - 3.0*lightIntensity, 0.0, 1.0)), fragmentColor.a);
+	#endif // EMISSIVE_MAPPING
+
+	#if ORDER_INDEPENDENT_TRANSPARENCY
+	WriteTransparentFragment(fragmentColor);
 	#else
 	RenderTarget0 = fragmentColor;
-	#endif // EMISSIVE_MAPPING
+	#endif
 #endif // FLAG_DEFERRED
 }
 
@@ -0,0 +1,24 @@
+#version 150
+
+/********************Entrant********************/
+in float vHeight;
+in vec2 vTexCoord;
+
+/********************Sortant********************/
+out vec4 RenderTarget0;
+
+/********************Uniformes********************/
+uniform float MaterialAlphaThreshold;
+uniform vec4 MaterialDiffuse;
+uniform sampler2D MaterialDiffuseMap;
+
+/********************Fonctions********************/
+void main()
+{
+	vec4 color = MaterialDiffuse * texture(MaterialDiffuseMap, vTexCoord);
+	if (color.a < MaterialAlphaThreshold)
+		discard;
+
+	// Le bas du feuillage est assombri, à défaut d'occlusion ambiante
+	RenderTarget0 = vec4(color.rgb * mix(0.6, 1.0, vHeight), color.a);
+}
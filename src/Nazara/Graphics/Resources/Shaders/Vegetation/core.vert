@@ -0,0 +1,39 @@
+#version 150
+
+/********************Entrant********************/
+in vec4 InstanceData0; // Position | échelle
+in vec2 InstanceData1; // Rotation autour de l'axe Y (sinus, cosinus)
+
+in vec3 VertexPosition;
+in vec2 VertexTexCoord;
+
+/********************Sortant********************/
+out float vHeight;
+out vec2 vTexCoord;
+
+/********************Uniformes********************/
+uniform float MeshHeight;
+uniform float Time;
+uniform vec2 WindDirection;
+uniform float WindFrequency;
+uniform float WindStrength;
+uniform mat4 WorldViewProjMatrix;
+
+/********************Fonctions********************/
+void main()
+{
+	vec2 sinCos = InstanceData1;
+	vec3 position = VertexPosition * InstanceData0.w;
+	position.xz = vec2(position.x * sinCos.y - position.z * sinCos.x, position.x * sinCos.x + position.z * sinCos.y);
+
+	// Le vent courbe le haut du modèle, chaque instance étant déphasée selon sa position
+	float height = clamp(VertexPosition.y / MeshHeight, 0.0, 1.0);
+	float phase = dot(InstanceData0.xz, vec2(0.37, 0.71));
+	float sway = 0.6 + 0.4 * sin(Time * WindFrequency + phase);
+	position.xz += WindDirection * (WindStrength * InstanceData0.w * height * height * sway);
+
+	vHeight = height;
+	vTexCoord = VertexTexCoord;
+
+	gl_Position = WorldViewProjMatrix * vec4(InstanceData0.xyz + position, 1.0);
+}
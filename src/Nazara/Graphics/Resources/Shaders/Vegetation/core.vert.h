@@ -0,0 +1 @@
+35,118,101,114,115,105,111,110,32,49,53,48,10,10,47,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,69,110,116,114,97,110,116,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,47,10,105,110,32,118,101,99,52,32,73,110,115,116,97,110,99,101,68,97,116,97,48,59,32,47,47,32,80,111,115,105,116,105,111,110,32,124,32,195,169,99,104,101,108,108,101,10,105,110,32,118,101,99,50,32,73,110,115,116,97,110,99,101,68,97,116,97,49,59,32,47,47,32,82,111,116,97,116,105,111,110,32,97,117,116,111,117,114,32,100,101,32,108,39,97,120,101,32,89,32,40,115,105,110,117,115,44,32,99,111,115,105,110,117,115,41,10,10,105,110,32,118,101,99,51,32,86,101,114,116,101,120,80,111,115,105,116,105,111,110,59,10,105,110,32,118,101,99,50,32,86,101,114,116,101,120,84,101,120,67,111,111,114,100,59,10,10,47,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,83,111,114,116,97,110,116,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,47,10,111,117,116,32,102,108,111,97,116,32,118,72,101,105,103,104,116,59,10,111,117,116,32,118,101,99,50,32,118,84,101,120,67,111,111,114,100,59,10,10,47,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,85,110,105,102,111,114,109,101,115,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,47,10,117,110,105,102,111,114,109,32,102,108,111,97,116,32,77,101,115,104,72,101,105,103,104,116,59,10,117,110,105,102,111,114,109,32,102,108,111,97,116,32,84,105,109,101,59,10,117,110,105,102,111,114,109,32,118,101,99,50,32,87,105,110,100,68,105,114,101,99,116,105,111,110,59,10,117,110,105,102,111,114,109,32,102,108,111,97,116,32,87,105,110,100,70,114,101,113,117,101,110,99,121,59,10,117,110,105,102,111,114,109,32,102,108,111,97,116,32,87,105,110,100,83,116,114,101,110,103,116,104,59,10,117,110,105,102,111,114,109,32,109,97,116,52,32,87,111,114,108,100,86,105,101,119,80,114,111,106,77,97,116,114,105,120,59,10,10,47,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,70,111,110,99,116,105,111,110,115,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,47,10,118,111,105,100,32,109,97,105,110,40,41,10,123,10,9,118,101,99,50,32,115,105,110,67,111,115,32,61,32,73,110,115,116,97,110,99,101,68,97,116,97,49,59,10,9,118,101,99,51,32,112,111,115,105,116,105,111,110,32,61,32,86,101,114,116,101,120,80,111,115,105,116,105,111,110,32,42,32,73,110,115,116,97,110,99,101,68,97,116,97,48,46,119,59,10,9,112,111,115,105,116,105,111,110,46,120,122,32,61,32,118,101,99,50,40,112,111,115,105,116,105,111,110,46,120,32,42,32,115,105,110,67,111,115,46,121,32,45,32,112,111,115,105,116,105,111,110,46,122,32,42,32,115,105,110,67,111,115,46,120,44,32,112,111,115,105,116,105,111,110,46,120,32,42,32,115,105,110,67,111,115,46,120,32,43,32,112,111,115,105,116,105,111,110,46,122,32,42,32,115,105,110,67,111,115,46,121,41,59,10,10,9,47,47,32,76,101,32,118,101,110,116,32,99,111,117,114,98,101,32,108,101,32,104,97,117,116,32,100,117,32,109,111,100,195,168,108,101,44,32,99,104,97,113,117,101,32,105,110,115,116,97,110,99,101,32,195,169,116,97,110,116,32,100,195,169,112,104,97,115,195,169,101,32,115,101,108,111,110,32,115,97,32,112,111,115,105,116,105,111,110,10,9,102,108,111,97,116,32,104,101,105,103,104,116,32,61,32,99,108,97,109,112,40,86,101,114,116,101,120,80,111,115,105,116,105,111,110,46,121,32,47,32,77,101,115,104,72,101,105,103,104,116,44,32,48,46,48,44,32,49,46,48,41,59,10,9,102,108,111,97,116,32,112,104,97,115,101,32,61,32,100,111,116,40,73,110,115,116,97,110,99,101,68,97,116,97,48,46,120,122,44,32,118,101,99,50,40,48,46,51,55,44,32,48,46,55,49,41,41,59,10,9,102,108,111,97,116,32,115,119,97,121,32,61,32,48,46,54,32,43,32,48,46,52,32,42,32,115,105,110,40,84,105,109,101,32,42,32,87,105,110,100,70,114,101,113,117,101,110,99,121,32,43,32,112,104,97,115,101,41,59,10,9,112,111,115,105,116,105,111,110,46,120,122,32,43,61,32,87,105,110,100,68,105,114,101,99,116,105,111,110,32,42,32,40,87,105,110,100,83,116,114,101,110,103,116,104,32,42,32,73,110,115,116,97,110,99,101,68,97,116,97,48,46,119,32,42,32,104,101,105,103,104,116,32,42,32,104,101,105,103,104,116,32,42,32,115,119,97,121,41,59,10,10,9,118,72,101,105,103,104,116,32,61,32,104,101,105,103,104,116,59,10,9,118,84,101,120,67,111,111,114,100,32,61,32,86,101,114,116,101,120,84,101,120,67,111,111,114,100,59,10,10,9,103,108,95,80,111,115,105,116,105,111,110,32,61,32,87,111,114,108,100,86,105,101,119,80,114,111,106,77,97,116,114,105,120,32,42,32,118,101,99,52,40,73,110,115,116,97,110,99,101,68,97,116,97,48,46,120,121,122,32,43,32,112,111,115,105,116,105,111,110,44,32,49,46,48,41,59,10,125,10,
\ No newline at end of file
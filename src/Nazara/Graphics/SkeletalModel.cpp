@@ -3,13 +3,17 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Graphics/SkeletalModel.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Graphics/AbstractRenderQueue.hpp>
 #include <Nazara/Graphics/Config.hpp>
 #include <Nazara/Graphics/SkinningManager.hpp>
+#include <Nazara/Utility/Joint.hpp>
 #include <Nazara/Utility/MeshData.hpp>
 #include <Nazara/Utility/Sequence.hpp>
 #include <Nazara/Utility/SkeletalMesh.hpp>
+#include <algorithm>
 #include <memory>
+#include <tuple>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
@@ -18,6 +22,9 @@ namespace Nz
 	* \ingroup graphics
 	* \class Nz::SkeletalModel
 	* \brief Graphics class that represents a model with a skeleton
+	*
+	* Besides the levels of detail of its mesh, which must be skinned by the same skeleton, each level may reduce the animation of the model.
+	* A far away model may update its pose less often and only animate its joints close to the root, leaving the others (like fingers) in their last pose.
 	*/
 
 	/*!
@@ -42,7 +49,9 @@ namespace Nz
 
 	SkeletalModel::SkeletalModel() :
 	m_currentSequence(nullptr),
-	m_animationEnabled(true)
+	m_levelOfDetail(0),
+	m_animationEnabled(true),
+	m_timeSincePose(0.f)
 	{
 	}
 
@@ -50,32 +59,51 @@ namespace Nz
 	* \brief Adds the skeletal mesh to the rendering queue
 	*
 	* \param renderQueue Queue to be added
-	* \param instanceData Data for the instance
+	* \param instanceData Data for the instance, selecting its level of detail
 	*/
 
 	void SkeletalModel::AddToRenderQueue(AbstractRenderQueue* renderQueue, const InstanceData& instanceData, const Recti& scissorRect) const
 	{
-		if (!m_mesh)
+		const Mesh* levelMesh = (m_mesh) ? GetLevelOfDetailMesh(std::min(instanceData.levelOfDetail, m_levelsOfDetail.size())) : nullptr;
+		if (!levelMesh)
 			return;
 
-		unsigned int submeshCount = m_mesh->GetSubMeshCount();
+		// Skinning by the vertex shader keeps the bind pose buffer and only sends the joint matrices
+		std::size_t jointCount = m_skeleton.GetJointCount();
+		const Matrix4f* jointMatrices = nullptr;
+		if (SkinningManager::IsGPUSkinningEnabled() && jointCount <= NAZARA_GRAPHICS_MAX_SKINNING_JOINTS)
+			jointMatrices = SkinningManager::GetJointMatrices(&m_skeleton);
+
+		unsigned int submeshCount = levelMesh->GetSubMeshCount();
 		for (unsigned int i = 0; i < submeshCount; ++i)
 		{
-			const SkeletalMesh* mesh = static_cast<const SkeletalMesh*>(m_mesh->GetSubMesh(i));
+			const SkeletalMesh* mesh = static_cast<const SkeletalMesh*>(levelMesh->GetSubMesh(i));
 			const Material* material = GetMaterial(mesh->GetMaterialIndex());
 
 			MeshData meshData;
 			meshData.indexBuffer = mesh->GetIndexBuffer();
 			meshData.primitiveMode = mesh->GetPrimitiveMode();
-			meshData.vertexBuffer = SkinningManager::GetBuffer(mesh, &m_skeleton);
 
-			renderQueue->AddMesh(instanceData.renderOrder, material, meshData, m_skeleton.GetAABB(), instanceData.transformMatrix, scissorRect);
+			if (jointMatrices)
+			{
+				meshData.vertexBuffer = mesh->GetVertexBuffer();
+
+				renderQueue->AddSkinnedMesh(instanceData.renderOrder, material, meshData, m_skeleton.GetAABB(), instanceData.transformMatrix, jointMatrices, jointCount, scissorRect);
+			}
+			else
+			{
+				meshData.vertexBuffer = SkinningManager::GetBuffer(mesh, &m_skeleton);
+
+				renderQueue->AddMesh(instanceData.renderOrder, material, meshData, m_skeleton.GetAABB(), instanceData.transformMatrix, scissorRect);
+			}
 		}
 	}
 
 	/*!
 	* \brief Updates the animation of the mesh
 	*
+	* The animation always advances, but the skeleton pose is only updated as often as the animation level of detail allows
+	*
 	* \param elapsedTime Delta time between two frames
 	*
 	* \remark Produces a NazaraError with NAZARA_GRAPHICS_SAFE defined if there is no animation
@@ -91,33 +119,14 @@ namespace Nz
 		}
 		#endif
 
-		m_interpolation += m_currentSequence->frameRate * elapsedTime;
-		while (m_interpolation > 1.f)
-		{
-			m_interpolation -= 1.f;
-
-			unsigned lastFrame = m_currentSequence->firstFrame + m_currentSequence->frameCount - 1;
-			if (m_nextFrame + 1 > lastFrame)
-			{
-				if (m_animation->IsLoopPointInterpolationEnabled())
-				{
-					m_currentFrame = m_nextFrame;
-					m_nextFrame = m_currentSequence->firstFrame;
-				}
-				else
-				{
-					m_currentFrame = m_currentSequence->firstFrame;
-					m_nextFrame = m_currentFrame + 1;
-				}
-			}
-			else
-			{
-				m_currentFrame = m_nextFrame;
-				m_nextFrame++;
-			}
-		}
+		if (!AdvanceFrames(elapsedTime))
+			return;
 
-		m_animation->AnimateSkeleton(&m_skeleton, m_currentFrame, m_nextFrame, m_interpolation);
+		const std::vector<UInt32>* joints = GetAnimatedJoints();
+		if (joints)
+			m_animation->AnimateSkeleton(&m_skeleton, m_currentFrame, m_nextFrame, m_interpolation, joints->data(), joints->size());
+		else
+			m_animation->AnimateSkeleton(&m_skeleton, m_currentFrame, m_nextFrame, m_interpolation);
 
 		InvalidateBoundingVolume();
 	}
@@ -314,6 +323,28 @@ namespace Nz
 		return true;
 	}
 
+	/*!
+	* \brief Reduces the animation of the model at a level of detail
+	*
+	* \param level Index of the level of detail, zero being the mesh of the model
+	* \param updateRate Maximum number of poses per second, zero to update the pose every time the animation advances
+	* \param maxJointDepth Depth of the deepest animated joint, a root joint having a depth of zero
+	*
+	* \remark Levels without settings are animated like the first one, skinning is reduced as well since unchanged joints don't need to be skinned again
+	*/
+
+	void SkeletalModel::SetAnimationLevelOfDetail(std::size_t level, float updateRate, unsigned int maxJointDepth)
+	{
+		if (level >= m_animationLevels.size())
+			m_animationLevels.resize(level + 1);
+
+		AnimationLevelOfDetail& animationLevel = m_animationLevels[level];
+		animationLevel.maxJointDepth = maxJointDepth;
+		animationLevel.updateInterval = (updateRate > 0.f) ? 1.f / updateRate : 0.f;
+
+		UpdateAnimationJoints();
+	}
+
 	/*!
 	* \brief Sets the mesh for the model
 	*
@@ -343,6 +374,7 @@ namespace Nz
 			}
 
 			m_skeleton = *m_mesh->GetSkeleton(); // Copy of skeleton template
+			UpdateAnimationJoints();
 		}
 	}
 
@@ -414,6 +446,199 @@ namespace Nz
 		m_nextFrame = m_currentSequence->firstFrame;
 	}
 
+	/*!
+	* \brief Selects the level of detail of an instance, which also selects the animation level of detail of the model
+	* \return true If the level of detail of the instance changed
+	*
+	* \param instanceData Data of the instance
+	* \param projectedSize Height of the instance on screen, relative to the height of the viewport
+	*
+	* \remark A model attached to multiple entities is animated with the level of the last instance updated
+	*/
+
+	bool SkeletalModel::UpdateLevelOfDetail(InstanceData* instanceData, float projectedSize, const Vector3f& eyePosition) const
+	{
+		bool levelChanged = Model::UpdateLevelOfDetail(instanceData, projectedSize, eyePosition);
+		m_levelOfDetail = instanceData->levelOfDetail;
+
+		return levelChanged;
+	}
+
+	/*!
+	* \brief Updates the animation of many models at once
+	*
+	* Models playing the same animation at the same point (like a crowd started together) share a single evaluation of the pose.
+	* The poses and the skinning matrices of the skeletons are then computed in parallel, ahead of the skinning.
+	*
+	* \param models Models to animate, each one appearing only once
+	* \param modelCount Number of models
+	* \param elapsedTime Delta time between two frames
+	*
+	* \remark Models whose animation is disabled or missing are skipped
+	*
+	* \see AdvanceAnimation
+	*/
+
+	void SkeletalModel::AdvanceAnimations(SkeletalModel* const* models, std::size_t modelCount, float elapsedTime)
+	{
+		NazaraAssert(models || modelCount == 0, "Invalid models");
+
+		// Advancing the frames is cheap, only the models needing a new pose are kept
+		std::vector<SkeletalModel*> posedModels;
+		posedModels.reserve(modelCount);
+		for (std::size_t i = 0; i < modelCount; ++i)
+		{
+			SkeletalModel* model = models[i];
+			if (!model->m_animationEnabled || !model->m_animation)
+				continue;
+
+			if (model->AdvanceFrames(elapsedTime))
+				posedModels.push_back(model);
+		}
+
+		if (posedModels.empty())
+			return;
+
+		// Sorting puts the models sharing a pose next to each other
+		auto poseKey = [](const SkeletalModel* model)
+		{
+			return std::make_tuple(model->m_animation.Get(), model->m_currentFrame, model->m_nextFrame, model->m_interpolation);
+		};
+
+		std::sort(posedModels.begin(), posedModels.end(), [&poseKey](const SkeletalModel* first, const SkeletalModel* second)
+		{
+			return poseKey(first) < poseKey(second);
+		});
+
+		struct SharedPose
+		{
+			const SkeletalModel* model; //< First model using the pose
+			std::size_t firstJoint;
+		};
+
+		std::vector<SharedPose> sharedPoses;
+		std::vector<std::size_t> modelPoses(posedModels.size());
+		std::size_t jointCount = 0;
+		for (std::size_t i = 0; i < posedModels.size(); ++i)
+		{
+			if (i == 0 || poseKey(posedModels[i - 1]) != poseKey(posedModels[i]))
+			{
+				sharedPoses.push_back({posedModels[i], jointCount});
+				jointCount += posedModels[i]->m_animation->GetJointCount();
+			}
+
+			modelPoses[i] = sharedPoses.size() - 1;
+		}
+
+		std::vector<SequenceJoint> poses(jointCount);
+		TaskScheduler::ParallelFor(0, sharedPoses.size(), 1, [&](std::size_t first, std::size_t last)
+		{
+			for (std::size_t i = first; i < last; ++i)
+			{
+				const SkeletalModel* model = sharedPoses[i].model;
+				model->m_animation->SamplePose(model->m_currentFrame, model->m_nextFrame, model->m_interpolation, &poses[sharedPoses[i].firstJoint]);
+			}
+		});
+
+		// Writing a pose invalidates the skeleton, whose signal isn't thread-safe
+		for (std::size_t i = 0; i < posedModels.size(); ++i)
+			posedModels[i]->ApplyPose(&poses[sharedPoses[modelPoses[i]].firstJoint]);
+
+		// Each skeleton being independent, their derived transformations are updated in parallel instead of by the skinning
+		TaskScheduler::ParallelFor(0, posedModels.size(), 0, [&](std::size_t first, std::size_t last)
+		{
+			for (std::size_t i = first; i < last; ++i)
+			{
+				const Skeleton& skeleton = posedModels[i]->m_skeleton;
+
+				const Joint* joints = skeleton.GetJoints();
+				UInt32 skeletonJointCount = skeleton.GetJointCount();
+				for (UInt32 j = 0; j < skeletonJointCount; ++j)
+					joints[j].EnsureSkinningMatrixUpdate();
+
+				skeleton.GetAABB();
+			}
+		});
+	}
+
+	/*!
+	* \brief Advances the frames of the animation
+	* \return true If the pose of the skeleton has to be updated, as often as the animation level of detail allows
+	*
+	* \param elapsedTime Delta time between two frames
+	*/
+
+	bool SkeletalModel::AdvanceFrames(float elapsedTime)
+	{
+		m_interpolation += m_currentSequence->frameRate * elapsedTime;
+		while (m_interpolation > 1.f)
+		{
+			m_interpolation -= 1.f;
+
+			unsigned lastFrame = m_currentSequence->firstFrame + m_currentSequence->frameCount - 1;
+			if (m_nextFrame + 1 > lastFrame)
+			{
+				if (m_animation->IsLoopPointInterpolationEnabled())
+				{
+					m_currentFrame = m_nextFrame;
+					m_nextFrame = m_currentSequence->firstFrame;
+				}
+				else
+				{
+					m_currentFrame = m_currentSequence->firstFrame;
+					m_nextFrame = m_currentFrame + 1;
+				}
+			}
+			else
+			{
+				m_currentFrame = m_nextFrame;
+				m_nextFrame++;
+			}
+		}
+
+		m_timeSincePose += elapsedTime;
+
+		if (m_levelOfDetail < m_animationLevels.size() && m_timeSincePose < m_animationLevels[m_levelOfDetail].updateInterval)
+			return false;
+
+		m_timeSincePose = 0.f;
+		return true;
+	}
+
+	/*!
+	* \brief Writes a pose in the animated joints of the skeleton
+	*
+	* \param pose Pose of every joint of the skeleton
+	*/
+
+	void SkeletalModel::ApplyPose(const SequenceJoint* pose)
+	{
+		const std::vector<UInt32>* joints = GetAnimatedJoints();
+		if (joints)
+			m_skeleton.SetPose(pose, joints->data(), static_cast<UInt32>(joints->size()));
+		else
+			m_skeleton.SetPose(pose);
+
+		InvalidateBoundingVolume();
+	}
+
+	/*!
+	* \brief Gets the joints animated by the current animation level of detail
+	* \return Indices of the animated joints, nullptr if every joint is animated
+	*/
+
+	const std::vector<UInt32>* SkeletalModel::GetAnimatedJoints() const
+	{
+		if (m_levelOfDetail < m_animationLevels.size())
+		{
+			const AnimationLevelOfDetail& animationLevel = m_animationLevels[m_levelOfDetail];
+			if (animationLevel.maxJointDepth != std::numeric_limits<unsigned int>::max())
+				return &animationLevel.joints;
+		}
+
+		return nullptr;
+	}
+
 	/*
 	* \brief Makes the bounding volume of this text
 	*/
@@ -434,5 +659,30 @@ namespace Nz
 			AdvanceAnimation(m_scene->GetUpdateTime());*/
 	}
 
+	/*!
+	* \brief Lists the joints animated by each animation level of detail, from their depth in the skeleton
+	*/
+
+	void SkeletalModel::UpdateAnimationJoints()
+	{
+		std::size_t jointCount = m_skeleton.GetJointCount();
+		for (AnimationLevelOfDetail& animationLevel : m_animationLevels)
+		{
+			animationLevel.joints.clear();
+			if (animationLevel.maxJointDepth == std::numeric_limits<unsigned int>::max())
+				continue;
+
+			for (std::size_t i = 0; i < jointCount; ++i)
+			{
+				unsigned int depth = 0;
+				for (const Node* parent = m_skeleton.GetJoint(static_cast<UInt32>(i))->GetParent(); parent; parent = parent->GetParent())
+					depth++;
+
+				if (depth <= animationLevel.maxJointDepth)
+					animationLevel.joints.push_back(static_cast<UInt32>(i));
+			}
+		}
+	}
+
 	SkeletalModelLoader::LoaderList SkeletalModel::s_loaders;
 }
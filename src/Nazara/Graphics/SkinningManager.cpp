@@ -33,7 +33,9 @@ namespace Nz
 			NazaraSlot(Skeleton, OnSkeletonDestroy, skeletonDestroySlot);
 			NazaraSlot(Skeleton, OnSkeletonJointsInvalidated, skeletonJointsInvalidatedSlot);
 
+			std::vector<Matrix4f> jointMatrices;
 			MeshMap meshMap;
+			bool jointMatricesUpdated;
 		};
 
 		struct QueueData
@@ -46,6 +48,43 @@ namespace Nz
 		using SkeletonMap = std::unordered_map<const Skeleton*, MeshData>;
 		SkeletonMap s_cache;
 		std::vector<QueueData> s_skinningQueue;
+		std::vector<SkinningDualQuaternion> s_dualQuaternions; //< Joint dual quaternions of the skeleton being skinned
+
+		/*!
+		* \brief Skins some vertices of the mesh
+		*
+		* \param skinningData Data of the skinning
+		* \param startVertex First vertex to skin
+		* \param vertexCount Number of vertices to skin
+		* \param dualQuaternion Should the dual quaternion skinning be used
+		*/
+
+		void SkinVertices(const SkinningData& skinningData, unsigned int startVertex, unsigned int vertexCount, bool dualQuaternion)
+		{
+			if (dualQuaternion)
+				SkinDualQuaternionPositionNormalTangent(skinningData, startVertex, vertexCount);
+			else
+				SkinPositionNormalTangent(skinningData, startVertex, vertexCount);
+		}
+
+		/*!
+		* \brief Prepares the joint dual quaternions of a skeleton, if they are required
+		*
+		* \param skinningData Data of the skinning, receiving the dual quaternions
+		* \param skeleton Skeleton to consider for getting data
+		* \param dualQuaternion Should the dual quaternion skinning be used
+		*/
+
+		void PrepareDualQuaternions(SkinningData& skinningData, const Skeleton* skeleton, bool dualQuaternion)
+		{
+			if (!dualQuaternion)
+				return;
+
+			s_dualQuaternions.resize(skeleton->GetJointCount());
+			ComputeSkinningDualQuaternions(skeleton->GetJoints(), skeleton->GetJointCount(), s_dualQuaternions.data());
+
+			skinningData.dualQuaternions = s_dualQuaternions.data();
+		}
 
 		/*!
 		* \brief Skins the mesh for a single thread context
@@ -53,9 +92,10 @@ namespace Nz
 		* \param mesh Skeletal mesh to get vertex buffer from
 		* \param skeleton Skeleton to consider for getting data
 		* \param buffer Vertex buffer symbolizing the transition
+		* \param dualQuaternion Should the dual quaternion skinning be used
 		*/
 
-		void Skin_MonoCPU(const SkeletalMesh* mesh, const Skeleton* skeleton, VertexBuffer* buffer)
+		void Skin_MonoCPU(const SkeletalMesh* mesh, const Skeleton* skeleton, VertexBuffer* buffer, bool dualQuaternion)
 		{
 			BufferMapper<VertexBuffer> inputMapper(mesh->GetVertexBuffer(), BufferAccess_ReadOnly);
 			BufferMapper<VertexBuffer> outputMapper(buffer, BufferAccess_DiscardAndWrite);
@@ -64,8 +104,9 @@ namespace Nz
 			skinningData.inputVertex = static_cast<SkeletalMeshVertex*>(inputMapper.GetPointer());
 			skinningData.outputVertex = static_cast<MeshVertex*>(outputMapper.GetPointer());
 			skinningData.joints = skeleton->GetJoints();
+			PrepareDualQuaternions(skinningData, skeleton, dualQuaternion);
 
-			SkinPositionNormalTangent(skinningData, 0, mesh->GetVertexCount());
+			SkinVertices(skinningData, 0, mesh->GetVertexCount(), dualQuaternion);
 		}
 
 		/*!
@@ -74,9 +115,10 @@ namespace Nz
 		* \param mesh Skeletal mesh to get vertex buffer from
 		* \param skeleton Skeleton to consider for getting data
 		* \param buffer Vertex buffer symbolizing the transition
+		* \param dualQuaternion Should the dual quaternion skinning be used
 		*/
 
-		void Skin_MultiCPU(const SkeletalMesh* mesh, const Skeleton* skeleton, VertexBuffer* buffer)
+		void Skin_MultiCPU(const SkeletalMesh* mesh, const Skeleton* skeleton, VertexBuffer* buffer, bool dualQuaternion)
 		{
 			BufferMapper<VertexBuffer> inputMapper(mesh->GetVertexBuffer(), BufferAccess_ReadOnly);
 			BufferMapper<VertexBuffer> outputMapper(buffer, BufferAccess_DiscardAndWrite);
@@ -92,14 +134,12 @@ namespace Nz
 			for (unsigned int i = 0; i < jointCount; ++i)
 				skinningData.joints[i].EnsureSkinningMatrixUpdate();
 
-			unsigned int workerCount = TaskScheduler::GetWorkerCount();
-
-			std::ldiv_t div = std::ldiv(mesh->GetVertexCount(), workerCount);
-			for (unsigned int i = 0; i < workerCount; ++i)
-				TaskScheduler::AddTask(SkinPositionNormalTangent, skinningData, i*div.quot, (i == workerCount-1) ? div.quot + div.rem : div.quot);
+			PrepareDualQuaternions(skinningData, skeleton, dualQuaternion);
 
-			TaskScheduler::Run();
-			TaskScheduler::WaitForTasks();
+			TaskScheduler::ParallelFor(0, mesh->GetVertexCount(), 0, [&skinningData, dualQuaternion](std::size_t first, std::size_t last)
+			{
+				SkinVertices(skinningData, static_cast<unsigned int>(first), static_cast<unsigned int>(last - first), dualQuaternion);
+			});
 		}
 	}
 
@@ -109,6 +149,36 @@ namespace Nz
 	* \brief Graphics class that represents the management of skinning
 	*/
 
+	/*!
+	* \brief Enables the dual quaternion skinning of the CPU path
+	*
+	* Dual quaternion skinning blends the rotations of the joints instead of their matrices, which preserves the volume of the mesh around twisted joints (no candy-wrapper effect) but ignores the scale of the joints
+	*
+	* \param dualQuaternionSkinning Should skeletal models be skinned with dual quaternions
+	*
+	* \remark This doesn't affect the GPU skinning, which always blends the joint matrices
+	*/
+
+	void SkinningManager::EnableDualQuaternionSkinning(bool dualQuaternionSkinning)
+	{
+		s_dualQuaternionSkinning = dualQuaternionSkinning;
+	}
+
+	/*!
+	* \brief Enables the vertex shader skinning path
+	*
+	* When enabled, skeletal models keep their bind-pose vertex buffer and send the joint matrices of their skeleton to the vertex shader instead of being skinned on the CPU
+	*
+	* \param gpuSkinning Should skeletal models be skinned by the GPU
+	*
+	* \remark Skeletons having more than NAZARA_GRAPHICS_MAX_SKINNING_JOINTS joints are still skinned on the CPU
+	*/
+
+	void SkinningManager::EnableGPUSkinning(bool gpuSkinning)
+	{
+		s_gpuSkinning = gpuSkinning;
+	}
+
 	/*!
 	* \brief Gets the vertex buffer from a skeletal mesh with its skeleton
 	* \return A pointer to the vertex buffer newly created
@@ -142,6 +212,7 @@ namespace Nz
 		if (it == s_cache.end())
 		{
 			MeshData meshData;
+			meshData.jointMatricesUpdated = false;
 			meshData.skeletonDestroySlot.Connect(skeleton->OnSkeletonDestroy, OnSkeletonRelease);
 			meshData.skeletonJointsInvalidatedSlot.Connect(skeleton->OnSkeletonJointsInvalidated, OnSkeletonInvalidated);
 
@@ -182,6 +253,73 @@ namespace Nz
 		return buffer;
 	}
 
+	/*!
+	* \brief Gets the skinning matrices of a skeleton joints
+	* \return A pointer to skeleton->GetJointCount() matrices, valid until the next invalidation of the skeleton
+	*
+	* \param skeleton Skeleton to get the joint matrices from
+	*
+	* \remark Matrices are only recomputed when the skeleton joints were invalidated since the last call
+	* \remark Produces a NazaraError with NAZARA_GRAPHICS_SAFE defined if skeleton is invalid
+	*/
+
+	const Matrix4f* SkinningManager::GetJointMatrices(const Skeleton* skeleton)
+	{
+		#if NAZARA_GRAPHICS_SAFE
+		if (!skeleton)
+		{
+			NazaraError("Invalid skeleton");
+			return nullptr;
+		}
+		#endif
+
+		SkeletonMap::iterator it = s_cache.find(skeleton);
+		if (it == s_cache.end())
+		{
+			MeshData meshData;
+			meshData.jointMatricesUpdated = false;
+			meshData.skeletonDestroySlot.Connect(skeleton->OnSkeletonDestroy, OnSkeletonRelease);
+			meshData.skeletonJointsInvalidatedSlot.Connect(skeleton->OnSkeletonJointsInvalidated, OnSkeletonInvalidated);
+
+			it = s_cache.insert(std::make_pair(skeleton, std::move(meshData))).first;
+		}
+
+		MeshData& meshData = it->second;
+		if (!meshData.jointMatricesUpdated)
+		{
+			const Joint* joints = skeleton->GetJoints();
+			std::size_t jointCount = skeleton->GetJointCount();
+
+			meshData.jointMatrices.resize(jointCount);
+			for (std::size_t i = 0; i < jointCount; ++i)
+				meshData.jointMatrices[i] = joints[i].GetSkinningMatrix();
+
+			meshData.jointMatricesUpdated = true;
+		}
+
+		return meshData.jointMatrices.data();
+	}
+
+	/*!
+	* \brief Checks whether the CPU path skins with dual quaternions
+	* \return true If skeletal models are skinned with dual quaternions
+	*/
+
+	bool SkinningManager::IsDualQuaternionSkinningEnabled()
+	{
+		return s_dualQuaternionSkinning;
+	}
+
+	/*!
+	* \brief Checks whether the vertex shader skinning path is enabled
+	* \return true If skeletal models are skinned by the GPU
+	*/
+
+	bool SkinningManager::IsGPUSkinningEnabled()
+	{
+		return s_gpuSkinning;
+	}
+
 	/*!
 	* \brief Skins the skeletal mesh
 	*/
@@ -189,7 +327,7 @@ namespace Nz
 	void SkinningManager::Skin()
 	{
 		for (QueueData& data : s_skinningQueue)
-			s_skinFunc(data.mesh, data.skeleton, data.buffer);
+			s_skinFunc(data.mesh, data.skeleton, data.buffer, s_dualQuaternionSkinning);
 
 		s_skinningQueue.clear();
 	}
@@ -201,7 +339,9 @@ namespace Nz
 
 	bool SkinningManager::Initialize()
 	{
-		///TODO: GPU Skinning
+		// GPU skinning requires the materials to use a skinning-aware shader, it has to be explicitly enabled
+		s_gpuSkinning = false;
+
 		if (TaskScheduler::Initialize())
 			s_skinFunc = Skin_MultiCPU;
 		else
@@ -233,7 +373,10 @@ namespace Nz
 
 	void SkinningManager::OnSkeletonInvalidated(const Skeleton* skeleton)
 	{
-		for (auto& pair : s_cache.at(skeleton).meshMap)
+		MeshData& meshData = s_cache.at(skeleton);
+		meshData.jointMatricesUpdated = false;
+
+		for (auto& pair : meshData.meshMap)
 			pair.second.updated = false;
 	}
 
@@ -255,8 +398,11 @@ namespace Nz
 	void SkinningManager::Uninitialize()
 	{
 		s_cache.clear();
+		s_dualQuaternions.clear();
 		s_skinningQueue.clear();
 	}
 
 	SkinningManager::SkinFunction SkinningManager::s_skinFunc = nullptr;
+	bool SkinningManager::s_dualQuaternionSkinning = false;
+	bool SkinningManager::s_gpuSkinning = false;
 }
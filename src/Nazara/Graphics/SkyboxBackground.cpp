@@ -5,10 +5,12 @@
 #include <Nazara/Graphics/SkyboxBackground.hpp>
 #include <Nazara/Core/ErrorFlags.hpp>
 #include <Nazara/Graphics/AbstractViewer.hpp>
+#include <Nazara/Renderer/GlslWriter.hpp>
 #include <Nazara/Renderer/Renderer.hpp>
 #include <Nazara/Renderer/RenderStates.hpp>
 #include <Nazara/Renderer/RenderTarget.hpp>
 #include <Nazara/Renderer/Shader.hpp>
+#include <Nazara/Renderer/ShaderBuilder.hpp>
 #include <Nazara/Utility/IndexBuffer.hpp>
 #include <Nazara/Utility/VertexBuffer.hpp>
 #include <Nazara/Utility/VertexDeclaration.hpp>
@@ -34,12 +36,20 @@ namespace Nz
 	* \brief Constructs a SkyboxBackground object with a cubemap texture
 	*
 	* \param cubemapTexture Cubemap texture
+	*
+	* \remark Produces a NazaraError and throws an exception if the skybox resources could not be created
 	*/
 
 	SkyboxBackground::SkyboxBackground(TextureRef cubemapTexture) :
 	m_movementOffset(Vector3f::Zero()),
 	m_movementScale(0.f)
 	{
+		if (!Initialize())
+		{
+			ErrorFlags flags(ErrorFlag_ThrowException, true);
+			NazaraError("Failed to create skybox resources");
+		}
+
 		m_sampler.SetWrapMode(SamplerWrap_Clamp); // We don't want to see any beam
 
 		SetTexture(std::move(cubemapTexture));
@@ -106,11 +116,16 @@ namespace Nz
 	* \brief Initializes the skybox
 	* \return true If successful
 	*
+	* Called when the first skybox is constructed, the shader and the cube buffers are shared by every skybox.
+	*
 	* \remark Produces a NazaraError if initialization failed
 	*/
 
 	bool SkyboxBackground::Initialize()
 	{
+		if (s_shader)
+			return true;
+
 		const UInt16 indices[6 * 6] =
 		{
 			0, 1, 2, 0, 2, 3,
@@ -133,39 +148,6 @@ namespace Nz
 			 1.0,  1.0, -1.0,
 		};
 
-		///TODO: Replace by ShaderNode (probably after Vulkan)
-		const char* fragmentShaderSource =
-		"#version 140\n"
-
-		"in vec3 vTexCoord;\n"
-
-		"out vec4 RenderTarget0;\n"
-
-		"uniform samplerCube Skybox;\n"
-		"uniform float VertexDepth;\n"
-
-		"void main()\n"
-		"{\n"
-		"	RenderTarget0 = texture(Skybox, vTexCoord);\n"
-		"	gl_FragDepth = VertexDepth;\n"
-		"}\n";
-
-		const char* vertexShaderSource =
-		"#version 140\n"
-
-		"in vec3 VertexPosition;\n"
-
-		"out vec3 vTexCoord;\n"
-
-		"uniform mat4 WorldViewProjMatrix;\n"
-
-		"void main()\n"
-		"{\n"
-		"    vec4 WVPVertex = WorldViewProjMatrix * vec4(VertexPosition, 1.0);\n"
-		"    gl_Position = WVPVertex.xyww;\n"
-		"    vTexCoord = VertexPosition;\n"
-		"}\n";
-
 		try
 		{
 			ErrorFlags flags(ErrorFlag_ThrowException, true);
@@ -179,6 +161,38 @@ namespace Nz
 			vertexBuffer->Fill(vertices, 0, 8);
 
 			// Shader
+			GlslWriter writer;
+			writer.SetGlslVersion(140);
+
+			String fragmentShaderSource;
+			String vertexShaderSource;
+			{
+				using namespace ShaderBuilder;
+				using ShaderAst::BuiltinEntry;
+				using ShaderAst::ExpressionType;
+				using ShaderAst::SwizzleComponent;
+
+				auto texCoord = Input("vTexCoord", ExpressionType::Float3);
+				auto rt0 = Output("RenderTarget0", ExpressionType::Float4);
+				auto skybox = Uniform("Skybox", ExpressionType::SamplerCube);
+				auto vertexDepth = Uniform("VertexDepth", ExpressionType::Float1);
+
+				fragmentShaderSource = writer.Generate(Block(ExprStatement(Assign(rt0, Sample(skybox, texCoord))),
+				                                             ExprStatement(Assign(Builtin(BuiltinEntry::FragmentDepth), vertexDepth))));
+
+				auto vertexPosition = Input("VertexPosition", ExpressionType::Float3);
+				auto texCoordOut = Output("vTexCoord", ExpressionType::Float3);
+				auto wvpMatrix = Uniform("WorldViewProjMatrix", ExpressionType::Mat4x4);
+				auto wvpVertex = Variable("WVPVertex", ExpressionType::Float4);
+
+				// Projected depth is forced to the far plane
+				auto farPosition = std::make_shared<ShaderAst::SwizzleOp>(wvpVertex, std::initializer_list<SwizzleComponent>{SwizzleComponent::First, SwizzleComponent::Second, SwizzleComponent::Fourth, SwizzleComponent::Fourth});
+
+				vertexShaderSource = writer.Generate(Block(ExprStatement(Assign(wvpVertex, Multiply(wvpMatrix, Cast<ExpressionType::Float4>(vertexPosition, Constant(1.f))))),
+				                                           ExprStatement(Assign(Builtin(BuiltinEntry::VertexPosition), farPosition)),
+				                                           ExprStatement(Assign(texCoordOut, vertexPosition))));
+			}
+
 			ShaderRef shader = Shader::New();
 			shader->Create();
 			shader->AttachStageFromSource(ShaderStageType_Fragment, fragmentShaderSource);
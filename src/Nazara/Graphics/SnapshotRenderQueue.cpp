@@ -0,0 +1,359 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Graphics/SnapshotRenderQueue.hpp>
+#include <Nazara/Utility/Algorithm.hpp>
+#include <Nazara/Utility/MeshData.hpp>
+#include <Nazara/Utility/VertexStruct.hpp>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup graphics
+	* \class Nz::SnapshotRenderQueue
+	* \brief Graphics class filling another queue with copies of what it receives, so it can be drawn while the scene keeps changing
+	*
+	* Render queues keep pointers to the sprite vertices, the joint matrices and the meshlets they receive, which belong to the renderables and change with them.
+	* This queue copies them into an arena of its own before forwarding them, and keeps a reference to the materials, textures and buffers used,
+	* so the underlying queue can be drawn by another thread (see RenderThread) while the renderables are updated for the next frame.
+	* Billboards and lights are already copied by the queues, and forwarded as is.
+	*
+	* \remark Drawables are forwarded as pointers, they must stay valid until the queue is drawn
+	* \remark The arena is reset when the queue is cleared, which must only happen once the underlying queue has been drawn
+	*/
+
+	/*!
+	* \brief Adds multiple billboards to the queue
+	*
+	* \param renderOrder Order of rendering
+	* \param material Material of the billboards
+	* \param billboardCount Number of billboards
+	* \param scissorRect Scissor rect of the billboards
+	* \param positionPtr Position of the billboards
+	* \param sizePtr Sizes of the billboards
+	* \param sinCosPtr Rotation of the billboards if null, Vector2f(0.f, 1.f) is used
+	* \param colorPtr Color of the billboards if null, Color::White is used
+	*/
+
+	void SnapshotRenderQueue::AddBillboards(int renderOrder, const Material* material, std::size_t billboardCount, const Recti& scissorRect, SparsePtr<const Vector3f> positionPtr, SparsePtr<const Vector2f> sizePtr, SparsePtr<const Vector2f> sinCosPtr, SparsePtr<const Color> colorPtr)
+	{
+		KeepAlive(material);
+
+		m_renderQueue->AddBillboards(renderOrder, material, billboardCount, scissorRect, positionPtr, sizePtr, sinCosPtr, colorPtr);
+	}
+
+	/*!
+	* \brief Adds multiple billboards to the queue
+	*
+	* \param renderOrder Order of rendering
+	* \param material Material of the billboards
+	* \param billboardCount Number of billboards
+	* \param scissorRect Scissor rect of the billboards
+	* \param positionPtr Position of the billboards
+	* \param sizePtr Sizes of the billboards
+	* \param sinCosPtr Rotation of the billboards if null, Vector2f(0.f, 1.f) is used
+	* \param alphaPtr Alpha parameters of the billboards if null, 1.f is used
+	*/
+
+	void SnapshotRenderQueue::AddBillboards(int renderOrder, const Material* material, std::size_t billboardCount, const Recti& scissorRect, SparsePtr<const Vector3f> positionPtr, SparsePtr<const Vector2f> sizePtr, SparsePtr<const Vector2f> sinCosPtr, SparsePtr<const float> alphaPtr)
+	{
+		KeepAlive(material);
+
+		m_renderQueue->AddBillboards(renderOrder, material, billboardCount, scissorRect, positionPtr, sizePtr, sinCosPtr, alphaPtr);
+	}
+
+	/*!
+	* \brief Adds multiple billboards to the queue
+	*
+	* \param renderOrder Order of rendering
+	* \param material Material of the billboards
+	* \param billboardCount Number of billboards
+	* \param scissorRect Scissor rect of the billboards
+	* \param positionPtr Position of the billboards
+	* \param sizePtr Sizes of the billboards
+	* \param anglePtr Rotation of the billboards if null, 0.f is used
+	* \param colorPtr Color of the billboards if null, Color::White is used
+	*/
+
+	void SnapshotRenderQueue::AddBillboards(int renderOrder, const Material* material, std::size_t billboardCount, const Recti& scissorRect, SparsePtr<const Vector3f> positionPtr, SparsePtr<const Vector2f> sizePtr, SparsePtr<const float> anglePtr, SparsePtr<const Color> colorPtr)
+	{
+		KeepAlive(material);
+
+		m_renderQueue->AddBillboards(renderOrder, material, billboardCount, scissorRect, positionPtr, sizePtr, anglePtr, colorPtr);
+	}
+
+	/*!
+	* \brief Adds multiple billboards to the queue
+	*
+	* \param renderOrder Order of rendering
+	* \param material Material of the billboards
+	* \param billboardCount Number of billboards
+	* \param scissorRect Scissor rect of the billboards
+	* \param positionPtr Position of the billboards
+	* \param sizePtr Sizes of the billboards
+	* \param anglePtr Rotation of the billboards if null, 0.f is used
+	* \param alphaPtr Alpha parameters of the billboards if null, 1.f is used
+	*/
+
+	void SnapshotRenderQueue::AddBillboards(int renderOrder, const Material* material, std::size_t billboardCount, const Recti& scissorRect, SparsePtr<const Vector3f> positionPtr, SparsePtr<const Vector2f> sizePtr, SparsePtr<const float> anglePtr, SparsePtr<const float> alphaPtr)
+	{
+		KeepAlive(material);
+
+		m_renderQueue->AddBillboards(renderOrder, material, billboardCount, scissorRect, positionPtr, sizePtr, anglePtr, alphaPtr);
+	}
+
+	/*!
+	* \brief Adds multiple billboards to the queue
+	*
+	* \param renderOrder Order of rendering
+	* \param material Material of the billboards
+	* \param billboardCount Number of billboards
+	* \param scissorRect Scissor rect of the billboards
+	* \param positionPtr Position of the billboards
+	* \param sizePtr Sizes of the billboards (square)
+	* \param sinCosPtr Rotation of the billboards if null, Vector2f(0.f, 1.f) is used
+	* \param colorPtr Color of the billboards if null, Color::White is used
+	*/
+
+	void SnapshotRenderQueue::AddBillboards(int renderOrder, const Material* material, std::size_t billboardCount, const Recti& scissorRect, SparsePtr<const Vector3f> positionPtr, SparsePtr<const float> sizePtr, SparsePtr<const Vector2f> sinCosPtr, SparsePtr<const Color> colorPtr)
+	{
+		KeepAlive(material);
+
+		m_renderQueue->AddBillboards(renderOrder, material, billboardCount, scissorRect, positionPtr, sizePtr, sinCosPtr, colorPtr);
+	}
+
+	/*!
+	* \brief Adds multiple billboards to the queue
+	*
+	* \param renderOrder Order of rendering
+	* \param material Material of the billboards
+	* \param billboardCount Number of billboards
+	* \param scissorRect Scissor rect of the billboards
+	* \param positionPtr Position of the billboards
+	* \param sizePtr Sizes of the billboards (square)
+	* \param sinCosPtr Rotation of the billboards if null, Vector2f(0.f, 1.f) is used
+	* \param alphaPtr Alpha parameters of the billboards if null, 1.f is used
+	*/
+
+	void SnapshotRenderQueue::AddBillboards(int renderOrder, const Material* material, std::size_t billboardCount, const Recti& scissorRect, SparsePtr<const Vector3f> positionPtr, SparsePtr<const float> sizePtr, SparsePtr<const Vector2f> sinCosPtr, SparsePtr<const float> alphaPtr)
+	{
+		KeepAlive(material);
+
+		m_renderQueue->AddBillboards(renderOrder, material, billboardCount, scissorRect, positionPtr, sizePtr, sinCosPtr, alphaPtr);
+	}
+
+	/*!
+	* \brief Adds multiple billboards to the queue
+	*
+	* \param renderOrder Order of rendering
+	* \param material Material of the billboards
+	* \param billboardCount Number of billboards
+	* \param scissorRect Scissor rect of the billboards
+	* \param positionPtr Position of the billboards
+	* \param sizePtr Sizes of the billboards (square)
+	* \param anglePtr Rotation of the billboards if null, 0.f is used
+	* \param colorPtr Color of the billboards if null, Color::White is used
+	*/
+
+	void SnapshotRenderQueue::AddBillboards(int renderOrder, const Material* material, std::size_t billboardCount, const Recti& scissorRect, SparsePtr<const Vector3f> positionPtr, SparsePtr<const float> sizePtr, SparsePtr<const float> anglePtr, SparsePtr<const Color> colorPtr)
+	{
+		KeepAlive(material);
+
+		m_renderQueue->AddBillboards(renderOrder, material, billboardCount, scissorRect, positionPtr, sizePtr, anglePtr, colorPtr);
+	}
+
+	/*!
+	* \brief Adds multiple billboards to the queue
+	*
+	* \param renderOrder Order of rendering
+	* \param material Material of the billboards
+	* \param billboardCount Number of billboards
+	* \param scissorRect Scissor rect of the billboards
+	* \param positionPtr Position of the billboards
+	* \param sizePtr Sizes of the billboards (square)
+	* \param anglePtr Rotation of the billboards if null, 0.f is used
+	* \param alphaPtr Alpha parameters of the billboards if null, 1.f is used
+	*/
+
+	void SnapshotRenderQueue::AddBillboards(int renderOrder, const Material* material, std::size_t billboardCount, const Recti& scissorRect, SparsePtr<const Vector3f> positionPtr, SparsePtr<const float> sizePtr, SparsePtr<const float> anglePtr, SparsePtr<const float> alphaPtr)
+	{
+		KeepAlive(material);
+
+		m_renderQueue->AddBillboards(renderOrder, material, billboardCount, scissorRect, positionPtr, sizePtr, anglePtr, alphaPtr);
+	}
+
+	/*!
+	* \brief Adds a directional light to the underlying queue
+	*
+	* \param light Directional light
+	*/
+
+	void SnapshotRenderQueue::AddDirectionalLight(const DirectionalLight& light)
+	{
+		m_renderQueue->AddDirectionalLight(light);
+	}
+
+	/*!
+	* \brief Adds a drawable to the queue
+	*
+	* \param renderOrder Order of rendering
+	* \param drawable Drawable user defined, which must stay valid until the queue is drawn
+	*/
+
+	void SnapshotRenderQueue::AddDrawable(int renderOrder, const Drawable* drawable)
+	{
+		m_renderQueue->AddDrawable(renderOrder, drawable);
+	}
+
+	/*!
+	* \brief Adds mesh to the queue
+	*
+	* \param renderOrder Order of rendering
+	* \param material Material of the mesh
+	* \param meshData Data of the mesh
+	* \param meshAABB Box of the mesh
+	* \param transformMatrix Matrix of the mesh
+	* \param scissorRect Scissor rect of the mesh
+	*/
+
+	void SnapshotRenderQueue::AddMesh(int renderOrder, const Material* material, const MeshData& meshData, const Boxf& meshAABB, const Matrix4f& transformMatrix, const Recti& scissorRect)
+	{
+		KeepAlive(material);
+
+		m_renderQueue->AddMesh(renderOrder, material, KeepAlive(meshData), meshAABB, transformMatrix, scissorRect);
+	}
+
+	/*!
+	* \brief Adds a point light to the underlying queue
+	*
+	* \param light Point light
+	*/
+
+	void SnapshotRenderQueue::AddPointLight(const PointLight& light)
+	{
+		m_renderQueue->AddPointLight(light);
+	}
+
+	/*!
+	* \brief Adds a reflection probe to the underlying queue
+	*
+	* \param probe Reflection probe, whose cubemap is kept alive until the queue is cleared
+	*/
+
+	void SnapshotRenderQueue::AddReflectionProbe(const ReflectionProbe& probe)
+	{
+		m_textures.emplace_back(probe.cubemap);
+
+		m_renderQueue->AddReflectionProbe(probe);
+	}
+
+	/*!
+	* \brief Adds a mesh skinned by the vertex shader to the queue
+	*
+	* \param renderOrder Order of rendering
+	* \param material Material of the mesh
+	* \param meshData Data of the mesh
+	* \param meshAABB Box of the mesh
+	* \param transformMatrix Matrix of the mesh
+	* \param jointMatrices Skinning matrices of the skeleton joints, copied
+	* \param jointCount Number of joint matrices
+	* \param scissorRect Scissor rect of the mesh
+	*/
+
+	void SnapshotRenderQueue::AddSkinnedMesh(int renderOrder, const Material* material, const MeshData& meshData, const Boxf& meshAABB, const Matrix4f& transformMatrix, const Matrix4f* jointMatrices, std::size_t jointCount, const Recti& scissorRect)
+	{
+		KeepAlive(material);
+
+		m_renderQueue->AddSkinnedMesh(renderOrder, material, KeepAlive(meshData), meshAABB, transformMatrix, Copy(jointMatrices, jointCount), jointCount, scissorRect);
+	}
+
+	/*!
+	* \brief Adds a spot light to the underlying queue
+	*
+	* \param light Spot light
+	*/
+
+	void SnapshotRenderQueue::AddSpotLight(const SpotLight& light)
+	{
+		m_renderQueue->AddSpotLight(light);
+	}
+
+	/*!
+	* \brief Adds sprites to the queue
+	*
+	* \param renderOrder Order of rendering
+	* \param material Material of the sprites
+	* \param vertices Buffer of data for the sprites, copied
+	* \param spriteCount Number of sprites
+	* \param scissorRect Scissor rect of the sprites
+	* \param overlay Texture of the sprites
+	* \param overlayLayer Layer of the overlay the sprites use, if it's a texture array
+	* \param instances Optional instance records of the same sprites, copied
+	*/
+
+	void SnapshotRenderQueue::AddSprites(int renderOrder, const Material* material, const VertexStruct_XYZ_Color_UV* vertices, std::size_t spriteCount, const Recti& scissorRect, const Texture* overlay, unsigned int overlayLayer, const SpriteInstance* instances)
+	{
+		KeepAlive(material);
+
+		if (overlay)
+			m_textures.emplace_back(overlay);
+
+		m_renderQueue->AddSprites(renderOrder, material, Copy(vertices, spriteCount * 4), spriteCount, scissorRect, overlay, overlayLayer, Copy(instances, spriteCount));
+	}
+
+	/*!
+	* \brief Clears the queue and the underlying one, releasing the copies
+	*
+	* \param fully Should everything be cleared or we can keep layers
+	*/
+
+	void SnapshotRenderQueue::Clear(bool fully)
+	{
+		AbstractRenderQueue::Clear(fully);
+
+		m_renderQueue->Clear(fully);
+
+		m_arena.Reset();
+		m_indexBuffers.clear();
+		m_materials.clear();
+		m_textures.clear();
+		m_vertexBuffers.clear();
+	}
+
+	/*!
+	* \brief Clears the lights of the underlying queue
+	*/
+
+	void SnapshotRenderQueue::ClearLights()
+	{
+		AbstractRenderQueue::ClearLights();
+
+		m_renderQueue->ClearLights();
+	}
+
+	void SnapshotRenderQueue::KeepAlive(const Material* material)
+	{
+		NazaraAssert(material, "Invalid material");
+
+		// Consecutive renderables often share their material
+		if (m_materials.empty() || m_materials.back().Get() != material)
+			m_materials.emplace_back(material);
+	}
+
+	MeshData SnapshotRenderQueue::KeepAlive(const MeshData& meshData)
+	{
+		if (meshData.indexBuffer && (m_indexBuffers.empty() || m_indexBuffers.back().Get() != meshData.indexBuffer))
+			m_indexBuffers.emplace_back(meshData.indexBuffer);
+
+		if (m_vertexBuffers.empty() || m_vertexBuffers.back().Get() != meshData.vertexBuffer)
+			m_vertexBuffers.emplace_back(meshData.vertexBuffer);
+
+		// Meshlets belong to the mesh rather than to its buffers
+		MeshData copy(meshData);
+		copy.meshlets = Copy(meshData.meshlets, meshData.meshletCount);
+
+		return copy;
+	}
+}
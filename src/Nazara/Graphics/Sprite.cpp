@@ -5,6 +5,7 @@
 #include <Nazara/Graphics/Sprite.hpp>
 #include <Nazara/Graphics/AbstractRenderQueue.hpp>
 #include <Nazara/Utility/VertexStruct.hpp>
+#include <algorithm>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
@@ -25,7 +26,13 @@ namespace Nz
 	void Sprite::AddToRenderQueue(AbstractRenderQueue* renderQueue, const InstanceData& instanceData, const Recti& scissorRect) const
 	{
 		const VertexStruct_XYZ_Color_UV* vertices = reinterpret_cast<const VertexStruct_XYZ_Color_UV*>(instanceData.data.data());
-		renderQueue->AddSprites(instanceData.renderOrder, GetMaterial(), vertices, 1, scissorRect);
+
+		// The instance record follows the vertices, unless the corners have different colors
+		const AbstractRenderQueue::SpriteInstance* instance = nullptr;
+		if (instanceData.data.size() > 4 * sizeof(VertexStruct_XYZ_Color_UV))
+			instance = reinterpret_cast<const AbstractRenderQueue::SpriteInstance*>(&vertices[4]);
+
+		renderQueue->AddSprites(instanceData.renderOrder, GetMaterial(), vertices, 1, scissorRect, nullptr, 0, instance);
 	}
 
 	/*!
@@ -186,6 +193,20 @@ namespace Nz
 		*colorPtr++ = m_color * m_cornerColor[RectCorner_RightBottom];
 		*posPtr++ = instanceData->transformMatrix.Transform(m_size.x*Vector3f::Right() + m_size.y*Vector3f::Down() - origin);
 		*texCoordPtr++ = m_textureCoords.GetCorner(RectCorner_RightBottom);
+
+		// A single color per sprite allows the renderer to expand it from a smaller record
+		if (std::all_of(m_cornerColor.begin() + 1, m_cornerColor.end(), [&](const Color& color) { return color == m_cornerColor[0]; }))
+		{
+			instanceData->data.resize(4 * sizeof(VertexStruct_XYZ_Color_UV) + sizeof(AbstractRenderQueue::SpriteInstance));
+			vertices = reinterpret_cast<VertexStruct_XYZ_Color_UV*>(instanceData->data.data());
+
+			AbstractRenderQueue::SpriteInstance* instance = reinterpret_cast<AbstractRenderQueue::SpriteInstance*>(&vertices[4]);
+			instance->color = vertices[0].color;
+			instance->down = vertices[2].position - vertices[0].position;
+			instance->origin = vertices[0].position;
+			instance->right = vertices[1].position - vertices[0].position;
+			instance->textureCoords = m_textureCoords;
+		}
 	}
 
 	/*!
@@ -6,8 +6,10 @@
 #include <Nazara/Core/CallOnExit.hpp>
 #include <Nazara/Core/SparsePtr.hpp>
 #include <Nazara/Graphics/AbstractRenderQueue.hpp>
+#include <Nazara/Graphics/GuillotineTextureAtlas.hpp>
 #include <Nazara/Utility/AbstractTextDrawer.hpp>
 #include <Nazara/Utility/Font.hpp>
+#include <algorithm>
 #include <memory>
 #include <Nazara/Graphics/Debug.hpp>
 
@@ -28,28 +30,35 @@ namespace Nz
 
 	void TextSprite::AddToRenderQueue(AbstractRenderQueue* renderQueue, const InstanceData& instanceData, const Recti& scissorRect) const
 	{
-		for (auto& pair : m_renderInfos)
+		const VertexStruct_XYZ_Color_UV* vertices = reinterpret_cast<const VertexStruct_XYZ_Color_UV*>(instanceData.data.data());
+
+		for (const RenderIndices& indices : m_renderInfos)
 		{
-			Texture* overlay = pair.first;
-			RenderIndices& indices = pair.second;
+			AbstractImage* layer = indices.layer;
 
-			if (indices.count > 0)
+			// Layers of a texture array are queued with the array itself, which allows them to be drawn together
+			if (layer->GetType() == ImageType_2D_Array)
 			{
-				const VertexStruct_XYZ_Color_UV* vertices = reinterpret_cast<const VertexStruct_XYZ_Color_UV*>(instanceData.data.data());
-				renderQueue->AddSprites(instanceData.renderOrder, GetMaterial(), &vertices[indices.first * 4], indices.count, scissorRect, overlay);
+				const GuillotineTextureAtlas::ArrayLayer* arrayLayer = static_cast<const GuillotineTextureAtlas::ArrayLayer*>(layer);
+				renderQueue->AddSprites(instanceData.renderOrder, GetMaterial(), &vertices[indices.first * 4], indices.count, scissorRect, arrayLayer->GetTexture(), arrayLayer->GetLayerIndex());
 			}
+			else
+				renderQueue->AddSprites(instanceData.renderOrder, GetMaterial(), &vertices[indices.first * 4], indices.count, scissorRect, static_cast<Texture*>(layer));
 		}
 	}
 
 	/*!
 	* \brief Updates the text
 	*
+	* The sprites of the glyphs before firstGlyph are kept, which makes updates after text was appended to the drawer cheap.
+	*
 	* \param drawer Drawer used to compose the text
+	* \param firstGlyph Index of the first glyph which changed since the last update from the same drawer, zero to update every glyph
 	*
 	* \remark Produces a NazaraAssert if atlas does not use a hardware storage
 	*/
 
-	void TextSprite::Update(const AbstractTextDrawer& drawer)
+	void TextSprite::Update(const AbstractTextDrawer& drawer, std::size_t firstGlyph)
 	{
 		CallOnExit clearOnFail([this]()
 		{
@@ -93,70 +102,38 @@ namespace Nz
 		}
 
 		std::size_t glyphCount = drawer.GetGlyphCount();
-		m_localVertices.resize(glyphCount * 4);
 
-		// Reset glyph count for every texture to zero
-		for (auto& pair : m_renderInfos)
-			pair.second.count = 0;
+		// Glyphs before the first one changed keep their sprites
+		firstGlyph = std::min(firstGlyph, std::min(glyphCount, m_glyphSprites.size()));
 
-		// Count glyph count for each texture
-		Texture* lastTexture = nullptr;
-		unsigned int* count = nullptr;
-		for (std::size_t i = 0; i < glyphCount; ++i)
-		{
-			const AbstractTextDrawer::Glyph& glyph = drawer.GetGlyph(i);
-			if (!glyph.atlas)
-				continue;
-
-			Texture* texture = static_cast<Texture*>(glyph.atlas);
-			if (lastTexture != texture)
-			{
-				auto it = m_renderInfos.find(texture);
-				if (it == m_renderInfos.end())
-					it = m_renderInfos.insert(std::make_pair(texture, RenderIndices{0U, 0U})).first;
-
-				count = &it->second.count;
-				lastTexture = texture;
-			}
+		unsigned int spriteCount = (firstGlyph < m_glyphSprites.size()) ? m_glyphSprites[firstGlyph] : static_cast<unsigned int>(m_localVertices.size() / 4);
+		m_glyphSprites.resize(firstGlyph);
+		m_localVertices.resize(spriteCount * 4);
 
-			(*count)++;
-		}
+		while (!m_renderInfos.empty() && m_renderInfos.back().first >= spriteCount)
+			m_renderInfos.pop_back();
 
-		// Attributes indices and reinitialize glyph count to zero to use it as a counter in the next loop
-		// This is because the 1st glyph can use texture A, the 2nd glyph can use texture B and the 3th glyph C can use texture A again
-		// so we need a counter to know where to write informations
-		// also remove unused render infos
-		unsigned int index = 0;
-		auto infoIt = m_renderInfos.begin();
-		while (infoIt != m_renderInfos.end())
+		if (!m_renderInfos.empty())
 		{
-			RenderIndices& indices = infoIt->second;
-			if (indices.count == 0)
-				m_renderInfos.erase(infoIt++); //< No glyph uses this texture, remove from indices
-			else
-			{
-				indices.first = index;
-
-				index += indices.count;
-				indices.count = 0;
-				++infoIt;
-			}
+			RenderIndices& lastIndices = m_renderInfos.back();
+			lastIndices.count = std::min(lastIndices.count, spriteCount - lastIndices.first);
 		}
 
-		lastTexture = nullptr;
-		RenderIndices* indices = nullptr;
-		for (unsigned int i = 0; i < glyphCount; ++i)
+		m_glyphSprites.reserve(glyphCount);
+		m_localVertices.reserve(glyphCount * 4);
+
+		for (std::size_t i = firstGlyph; i < glyphCount; ++i)
 		{
+			m_glyphSprites.push_back(spriteCount);
+
 			const AbstractTextDrawer::Glyph& glyph = drawer.GetGlyph(i);
 			if (!glyph.atlas)
 				continue;
 
-			Texture* texture = static_cast<Texture*>(glyph.atlas);
-			if (lastTexture != texture)
-			{
-				indices = &m_renderInfos[texture]; //< We changed texture, adjust the pointer
-				lastTexture = texture;
-			}
+			// Sprites are kept in the order of the glyphs, consecutive glyphs using the same layer are queued together
+			AbstractImage* texture = glyph.atlas;
+			if (m_renderInfos.empty() || m_renderInfos.back().layer != texture)
+				m_renderInfos.push_back(RenderIndices{texture, spriteCount, 0U});
 
 			// First, compute the uv coordinates from our atlas rect
 			Vector2ui size(texture->GetSize());
@@ -176,14 +153,16 @@ namespace Nz
 			// Set the position, color and UV of our vertices
 			for (unsigned int j = 0; j < 4; ++j)
 			{
-				// Remember that indices->count is a counter here, not a count value
-				m_localVertices[indices->count * 4 + j].color = glyph.color;
-				m_localVertices[indices->count * 4 + j].position.Set(glyph.corners[j]);
-				m_localVertices[indices->count * 4 + j].uv.Set(uvRect.GetCorner((glyph.flipped) ? flippedCorners[j] : normalCorners[j]));
+				VertexStruct_XY_Color_UV vertex;
+				vertex.color = glyph.color;
+				vertex.position.Set(glyph.corners[j]);
+				vertex.uv.Set(uvRect.GetCorner((glyph.flipped) ? flippedCorners[j] : normalCorners[j]));
+
+				m_localVertices.push_back(vertex);
 			}
 
-			// Increment the counter, go to next glyph
-			indices->count++;
+			m_renderInfos.back().count++;
+			spriteCount++;
 		}
 
 		m_localBounds = drawer.GetBounds();
@@ -247,34 +226,50 @@ namespace Nz
 		}
 		#endif
 
+		// The layers of a texture array keep their object and size, only the array they're queued with changed
+		if (oldLayer == newLayer)
+		{
+			for (const RenderIndices& indices : m_renderInfos)
+			{
+				if (indices.layer == oldLayer)
+				{
+					InvalidateInstanceData(0);
+					break;
+				}
+			}
+
+			return;
+		}
+
 		// The texture of an atlas have just been recreated (size change)
 		// we have to adjust the coordinates of the texture and the rendering texture
-		Texture* oldTexture = static_cast<Texture*>(oldLayer);
-		Texture* newTexture = static_cast<Texture*>(newLayer);
 
 		// It is possible that we don't use the texture (the atlas warning us for each of its layers)
-		auto it = m_renderInfos.find(oldTexture);
-		if (it != m_renderInfos.end())
-		{
-			// We indeed use this texture, we have to update its coordinates
-			RenderIndices indices = std::move(it->second);
+		bool layerUsed = false;
+
+		Vector2ui oldSize(oldLayer->GetSize());
+		Vector2ui newSize(newLayer->GetSize());
+		Vector2f scale = Vector2f(oldSize) / Vector2f(newSize); // ratio of the old one to the new one
 
-			Vector2ui oldSize(oldTexture->GetSize());
-			Vector2ui newSize(newTexture->GetSize());
-			Vector2f scale = Vector2f(oldSize) / Vector2f(newSize); // ratio of the old one to the new one
+		for (RenderIndices& indices : m_renderInfos)
+		{
+			if (indices.layer != oldLayer)
+				continue;
 
-			// Now we will iterate through each coordinates of the concerned texture to multiply them by the ratio
-			SparsePtr<Vector2f> texCoordPtr(&m_localVertices[indices.first].uv, sizeof(VertexStruct_XYZ_Color_UV));
+			// We indeed use this texture, we have to update its coordinates
 			for (unsigned int i = 0; i < indices.count; ++i)
 			{
 				for (unsigned int j = 0; j < 4; ++j)
-					m_localVertices[i*4 + j].uv *= scale;
+					m_localVertices[(indices.first + i) * 4 + j].uv *= scale;
 			}
 
-			// We get rid off the old texture and we set the new one at the place (same for indices)
-			m_renderInfos.erase(it);
-			m_renderInfos.insert(std::make_pair(newTexture, std::move(indices)));
+			indices.layer = newLayer;
+			layerUsed = true;
 		}
+
+		// The old texture is about to be released, it must not stay in the render queues
+		if (layerUsed)
+			InvalidateInstanceData(0);
 	}
 
 	/*!
@@ -294,30 +289,14 @@ namespace Nz
 
 		// We will not initialize the final vertices (those send to the RenderQueue)
 		// With the help of the coordinates axis, the matrix and our color attribute
-		for (auto& pair : m_renderInfos)
+		for (const VertexStruct_XY_Color_UV& localVertex : m_localVertices)
 		{
-			RenderIndices& indices = pair.second;
-			if (indices.count == 0)
-				continue; //< Ignore empty render indices
-
-			SparsePtr<Color> color = colorPtr + indices.first * 4;
-			SparsePtr<Vector3f> pos = posPtr + indices.first * 4;
-			SparsePtr<Vector2f> uv = texCoordPtr + indices.first * 4;
-			VertexStruct_XY_Color_UV* localVertex = &m_localVertices[indices.first * 4];
-			for (unsigned int i = 0; i < indices.count; ++i)
-			{
-				for (unsigned int j = 0; j < 4; ++j)
-				{
-					Vector3f localPos = localVertex->position.x*Vector3f::Right() + localVertex->position.y*Vector3f::Down();
-					localPos *= m_scale;
-
-					*pos++ = instanceData->transformMatrix.Transform(localPos);
-					*color++ = m_color * localVertex->color;
-					*uv++ = localVertex->uv;
+			Vector3f localPos = localVertex.position.x*Vector3f::Right() + localVertex.position.y*Vector3f::Down();
+			localPos *= m_scale;
 
-					localVertex++;
-				}
-			}
+			*posPtr++ = instanceData->transformMatrix.Transform(localPos);
+			*colorPtr++ = m_color * localVertex.color;
+			*texCoordPtr++ = localVertex.uv;
 		}
 	}
 
@@ -6,6 +6,7 @@
 #include <Nazara/Graphics/AbstractRenderQueue.hpp>
 #include <Nazara/Math/Rect.hpp>
 #include <Nazara/Utility/VertexStruct.hpp>
+#include <cstring>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
@@ -15,6 +16,8 @@ namespace Nz
 	* \class Nz::TileMap
 	* \brief Graphics class that represent several tiles of the same size assembled into a grid
 	*  This class is far more efficient than using a sprite for every tile
+	*
+	* The tiles are split into chunks of NAZARA_GRAPHICS_TILEMAP_CHUNK_SIZE² tiles, a change of tile only regenerating the vertices of its chunk.
 	*/
 
 	/*!
@@ -25,15 +28,22 @@ namespace Nz
 	*/
 	void TileMap::AddToRenderQueue(AbstractRenderQueue* renderQueue, const InstanceData& instanceData, const Recti& scissorRect) const
 	{
-		const VertexStruct_XYZ_Color_UV* vertices = reinterpret_cast<const VertexStruct_XYZ_Color_UV*>(instanceData.data.data());
+		const UInt8* data = instanceData.data.data() + sizeof(InstanceHeader) + m_chunks.size() * sizeof(UInt32);
+		const VertexStruct_XYZ_Color_UV* vertices = reinterpret_cast<const VertexStruct_XYZ_Color_UV*>(data);
 
-		std::size_t matCount = 0;
-		std::size_t spriteCount = 0;
-		for (const Layer& layer : m_layers)
+		// Chains of the same material are merged by the render technique, whatever the number of chunks
+		for (const Chunk& chunk : m_chunks)
 		{
-			renderQueue->AddSprites(instanceData.renderOrder, GetMaterial(matCount++), &vertices[spriteCount], layer.tiles.size(), scissorRect);
-
-			spriteCount += layer.tiles.size();
+			std::size_t tileOffset = chunk.firstTile;
+			for (std::size_t layerIndex = 0; layerIndex < chunk.layerTileCounts.size(); ++layerIndex)
+			{
+				std::size_t tileCount = chunk.layerTileCounts[layerIndex];
+				if (tileCount > 0)
+				{
+					renderQueue->AddSprites(instanceData.renderOrder, GetMaterial(layerIndex), &vertices[4 * tileOffset], tileCount, scissorRect);
+					tileOffset += tileCount;
+				}
+			}
 		}
 	}
 
@@ -43,29 +53,35 @@ namespace Nz
 		m_boundingVolume.Set(Vector3f(0.f), size.x*Vector3f::Right() + size.y*Vector3f::Down());
 	}
 
-	void TileMap::UpdateData(InstanceData* instanceData) const
+	/*!
+	* \brief Generates the vertices of the tiles of a chunk, sorted by layer
+	*
+	* \param chunk Chunk to update
+	* \param transformMatrix Matrix of the instance
+	* \param vertices Vertices of the chunk, four per tile it can hold
+	*/
+	void TileMap::UpdateChunk(const Chunk& chunk, const Matrix4f& transformMatrix, VertexStruct_XYZ_Color_UV* vertices) const
 	{
-		std::size_t spriteCount = 0;
-		for (const Layer& layer : m_layers)
-			spriteCount += layer.tiles.size();
+		// The tile corners only differ by the tile edges, which are transformed once for every tile
+		Vector3f rightEdge = transformMatrix.Transform(m_tileSize.x * Vector3f::Right(), 0.f);
+		Vector3f downEdge = transformMatrix.Transform(m_tileSize.y * Vector3f::Down(), 0.f);
 
-		instanceData->data.resize(4 * spriteCount * sizeof(VertexStruct_XYZ_Color_UV));
-		VertexStruct_XYZ_Color_UV* vertices = reinterpret_cast<VertexStruct_XYZ_Color_UV*>(instanceData->data.data());
+		std::vector<std::size_t> layerOffsets(chunk.layerTileCounts.size());
 
-		spriteCount = 0;
-		for (const Layer& layer : m_layers)
+		std::size_t tileOffset = 0;
+		for (std::size_t layerIndex = 0; layerIndex < chunk.layerTileCounts.size(); ++layerIndex)
 		{
-			SparsePtr<Color> colorPtr(&vertices[spriteCount].color, sizeof(VertexStruct_XYZ_Color_UV));
-			SparsePtr<Vector3f> posPtr(&vertices[spriteCount].position, sizeof(VertexStruct_XYZ_Color_UV));
-			SparsePtr<Vector2f> texCoordPtr(&vertices[spriteCount].uv, sizeof(VertexStruct_XYZ_Color_UV));
+			layerOffsets[layerIndex] = tileOffset;
+			tileOffset += chunk.layerTileCounts[layerIndex];
+		}
 
-			for (std::size_t tileIndex : layer.tiles)
+		for (unsigned int y = chunk.tiles.y; y < chunk.tiles.y + chunk.tiles.height; ++y)
+		{
+			for (unsigned int x = chunk.tiles.x; x < chunk.tiles.x + chunk.tiles.width; ++x)
 			{
-				const Tile& tile = m_tiles[tileIndex];
-				NazaraAssert(tile.enabled, "Tile specified for rendering is not enabled");
-
-				std::size_t x = tileIndex % m_mapSize.x;
-				std::size_t y = tileIndex / m_mapSize.x;
+				const Tile& tile = m_tiles[y * m_mapSize.x + x];
+				if (!tile.enabled)
+					continue;
 
 				Vector3f tileLeftCorner;
 				if (m_isometricModeEnabled)
@@ -73,23 +89,67 @@ namespace Nz
 				else
 					tileLeftCorner.Set(x * m_tileSize.x, y * -m_tileSize.y, 0.f);
 
-				*colorPtr++ = tile.color;
-				*posPtr++ = instanceData->transformMatrix.Transform(tileLeftCorner);
-				*texCoordPtr++ = tile.textureCoords.GetCorner(RectCorner_LeftTop);
+				Vector3f leftTop = transformMatrix.Transform(tileLeftCorner);
+
+				VertexStruct_XYZ_Color_UV* tileVertices = &vertices[4 * layerOffsets[tile.layerIndex]++];
+
+				tileVertices[0].color = tile.color;
+				tileVertices[0].position = leftTop;
+				tileVertices[0].uv = tile.textureCoords.GetCorner(RectCorner_LeftTop);
+
+				tileVertices[1].color = tile.color;
+				tileVertices[1].position = leftTop + rightEdge;
+				tileVertices[1].uv = tile.textureCoords.GetCorner(RectCorner_RightTop);
+
+				tileVertices[2].color = tile.color;
+				tileVertices[2].position = leftTop + downEdge;
+				tileVertices[2].uv = tile.textureCoords.GetCorner(RectCorner_LeftBottom);
+
+				tileVertices[3].color = tile.color;
+				tileVertices[3].position = leftTop + rightEdge + downEdge;
+				tileVertices[3].uv = tile.textureCoords.GetCorner(RectCorner_RightBottom);
+			}
+		}
+	}
+
+	/*!
+	* \brief Updates the vertices of the instance
+	*
+	* Only the chunks modified since the last update are regenerated, unless the instance moved or every chunk was invalidated
+	*
+	* \param instanceData Data of the instance, holding the revision of every chunk followed by their vertices
+	*/
+	void TileMap::UpdateData(InstanceData* instanceData) const
+	{
+		std::size_t tileCount = m_tiles.size();
+		std::size_t dataSize = sizeof(InstanceHeader) + m_chunks.size() * sizeof(UInt32) + 4 * tileCount * sizeof(VertexStruct_XYZ_Color_UV);
+
+		bool fullUpdate = true;
+		if (instanceData->data.size() == dataSize)
+		{
+			const InstanceHeader* header = reinterpret_cast<const InstanceHeader*>(instanceData->data.data());
+			fullUpdate = (header->revision != m_revision || std::memcmp(&header->transformMatrix, &instanceData->transformMatrix, sizeof(Matrix4f)) != 0);
+		}
+		else
+			instanceData->data.resize(dataSize);
+
+		UInt8* data = instanceData->data.data();
 
-				*colorPtr++ = tile.color;
-				*posPtr++ = instanceData->transformMatrix.Transform(tileLeftCorner + m_tileSize.x * Vector3f::Right());
-				*texCoordPtr++ = tile.textureCoords.GetCorner(RectCorner_RightTop);
+		InstanceHeader* header = reinterpret_cast<InstanceHeader*>(data);
+		header->revision = m_revision;
+		header->transformMatrix = instanceData->transformMatrix;
 
-				*colorPtr++ = tile.color;
-				*posPtr++ = instanceData->transformMatrix.Transform(tileLeftCorner + m_tileSize.y * Vector3f::Down());
-				*texCoordPtr++ = tile.textureCoords.GetCorner(RectCorner_LeftBottom);
+		UInt32* chunkRevisions = reinterpret_cast<UInt32*>(data + sizeof(InstanceHeader));
+		VertexStruct_XYZ_Color_UV* vertices = reinterpret_cast<VertexStruct_XYZ_Color_UV*>(data + sizeof(InstanceHeader) + m_chunks.size() * sizeof(UInt32));
 
-				*colorPtr++ = tile.color;
-				*posPtr++ = instanceData->transformMatrix.Transform(tileLeftCorner + m_tileSize.x * Vector3f::Right() + m_tileSize.y * Vector3f::Down());
-				*texCoordPtr++ = tile.textureCoords.GetCorner(RectCorner_RightBottom);
+		for (std::size_t i = 0; i < m_chunks.size(); ++i)
+		{
+			const Chunk& chunk = m_chunks[i];
+			if (fullUpdate || chunkRevisions[i] != chunk.revision)
+			{
+				UpdateChunk(chunk, instanceData->transformMatrix, &vertices[4 * chunk.firstTile]);
+				chunkRevisions[i] = chunk.revision;
 			}
-			spriteCount += layer.tiles.size();
 		}
 	}
 
@@ -0,0 +1,556 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Graphics/Vegetation.hpp>
+#include <Nazara/Core/ErrorFlags.hpp>
+#include <Nazara/Core/OffsetOf.hpp>
+#include <Nazara/Graphics/AbstractRenderQueue.hpp>
+#include <Nazara/Math/Algorithm.hpp>
+#include <Nazara/Math/Frustum.hpp>
+#include <Nazara/Renderer/RenderStates.hpp>
+#include <Nazara/Renderer/Texture.hpp>
+#include <Nazara/Utility/Image.hpp>
+#include <Nazara/Utility/IndexBuffer.hpp>
+#include <Nazara/Utility/TriangleIterator.hpp>
+#include <Nazara/Utility/VertexMapper.hpp>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <utility>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		const UInt8 r_fragmentShader[] = {
+			#include <Nazara/Graphics/Resources/Shaders/Vegetation/core.frag.h>
+		};
+
+		const UInt8 r_vertexShader[] = {
+			#include <Nazara/Graphics/Resources/Shaders/Vegetation/core.vert.h>
+		};
+
+		float SampleDensity(const Image& densityMap, const Vector2f& uv)
+		{
+			unsigned int width = densityMap.GetWidth();
+			unsigned int height = densityMap.GetHeight();
+
+			unsigned int x = std::min(static_cast<unsigned int>(Clamp(uv.x, 0.f, 1.f) * width), width - 1);
+			unsigned int y = std::min(static_cast<unsigned int>(Clamp(uv.y, 0.f, 1.f) * height), height - 1);
+
+			return densityMap.GetPixelColor(x, y).r / 255.f;
+		}
+	}
+
+	/*!
+	* \ingroup graphics
+	* \class Nz::Vegetation
+	* \brief Graphics class that represents dense vegetation (grass, bushes, ...), drawing a mesh many times at a low cost
+	*
+	* Instances are only a position, a scale and a rotation around the up axis, stored once for all in a GPU buffer.
+	* They are grouped by square cells on the XZ plane, each one being a range of the buffer, cells being culled by the CPU.
+	* The visible cells are drawn by a single multi draw indirect call (or an instanced draw call per cell when it's not supported),
+	* and the vertex shader bends the instances in the wind.
+	*
+	* \remark Instances are in the local space of the vegetation, which is drawn with the transformation of the last entity it was queued for, it's meant to be attached to a single entity
+	* \remark Instances are drawn without lighting, with the render states, diffuse color, diffuse map and alpha threshold of the material
+	*/
+
+	/*!
+	* \brief Constructs a Vegetation object
+	*
+	* \param mesh Indexed mesh drawn for every instance, its up axis being Y, with a position and texture coordinates
+	* \param material Material used to draw the instances
+	* \param cellSize Size of the cells the instances are grouped (and culled) by
+	*
+	* \remark Produces a NazaraError and throws an exception if the mesh is invalid or the shader could not be created
+	*/
+
+	Vegetation::Vegetation(StaticMeshRef mesh, MaterialRef material, float cellSize) :
+	m_commandBuffer(BufferType_DrawIndirect),
+	m_transformMatrix(Matrix4f::Identity()),
+	m_mesh(std::move(mesh)),
+	m_windDirection(Vector2f::UnitX()),
+	m_cellSize(cellSize),
+	m_time(0.f),
+	m_windFrequency(1.f),
+	m_windStrength(0.f),
+	m_buffersInvalidated(false),
+	m_cellsInvalidated(false)
+	{
+		NazaraAssert(m_mesh, "Invalid mesh");
+		NazaraAssert(cellSize > 0.f, "Cell size must be over zero");
+
+		ResetMaterials(1);
+		SetMaterial(std::move(material));
+
+		ErrorFlags flags(ErrorFlag_ThrowException, true);
+
+		if (!m_mesh->IsValid() || !m_mesh->GetIndexBuffer())
+			NazaraError("Vegetation mesh must be valid and indexed");
+
+		if (!Initialize())
+			NazaraError("Failed to create vegetation shader");
+
+		// The wind bends the mesh from its base to its top, and rotations keep it within its horizontal radius
+		const Boxf& aabb = m_mesh->GetAABB();
+		float maxX = std::max(std::abs(aabb.x), std::abs(aabb.x + aabb.width));
+		float maxZ = std::max(std::abs(aabb.z), std::abs(aabb.z + aabb.depth));
+
+		m_meshHeight = std::max(aabb.y + aabb.height, 0.0001f);
+		m_meshRadius = std::sqrt(maxX * maxX + maxZ * maxZ);
+	}
+
+	/*!
+	* \brief Adds an instance
+	*
+	* \param position Position of the base of the instance
+	* \param scale Scale of the mesh
+	* \param rotation Rotation around the up axis, in degrees
+	*/
+
+	void Vegetation::AddInstance(const Vector3f& position, float scale, float rotation)
+	{
+		float angle = DegreeToRadian(rotation);
+
+		Instance instance;
+		instance.position = position;
+		instance.scale = scale;
+		instance.sinCos.Set(std::sin(angle), std::cos(angle));
+
+		m_instances.push_back(instance);
+
+		m_buffersInvalidated = true;
+		m_cellsInvalidated = true;
+		InvalidateBoundingVolume();
+	}
+
+	/*!
+	* \brief Adds the vegetation to the rendering queue
+	*
+	* \param renderQueue Queue to be added
+	* \param instanceData Data for the instance
+	* \param scissorRect Scissor rect, unused
+	*/
+
+	void Vegetation::AddToRenderQueue(AbstractRenderQueue* renderQueue, const InstanceData& instanceData, const Recti& /*scissorRect*/) const
+	{
+		NazaraAssert(renderQueue, "Invalid render queue");
+
+		m_transformMatrix = instanceData.transformMatrix;
+
+		renderQueue->AddDrawable(instanceData.renderOrder, this);
+	}
+
+	/*!
+	* \brief Removes every instance
+	*/
+
+	void Vegetation::Clear()
+	{
+		m_instances.clear();
+
+		m_buffersInvalidated = true;
+		m_cellsInvalidated = true;
+		InvalidateBoundingVolume();
+	}
+
+	/*!
+	* \brief Draws the instances of the cells visible from the current view
+	*
+	* \remark Render states, shader, buffers and textures of the Renderer are changed, the instance buffer of the Renderer being restored
+	*/
+
+	void Vegetation::Draw() const
+	{
+		if (m_instances.empty() || !Renderer::HasCapability(RendererCap_Instancing))
+			return;
+
+		UpdateBuffers();
+
+		const MaterialRef& material = GetMaterial();
+		const IndexBuffer* indexBuffer = m_mesh->GetIndexBuffer();
+		const VertexBuffer* vertexBuffer = m_mesh->GetVertexBuffer();
+		PrimitiveMode primitiveMode = m_mesh->GetPrimitiveMode();
+
+		Renderer::SetMatrix(MatrixType_World, m_transformMatrix);
+		Renderer::SetRenderStates(material->GetPipelineInfo());
+		Renderer::SetShader(s_shader);
+		Renderer::SetIndexBuffer(indexBuffer);
+		Renderer::SetVertexBuffer(vertexBuffer);
+		Renderer::SetTexture(0, (material->HasDiffuseMap()) ? material->GetDiffuseMap().Get() : TextureLibrary::Get("White2D").Get());
+		Renderer::SetTextureSampler(0, material->GetDiffuseSampler());
+
+		s_shader->SendFloat(s_shader->GetUniformLocation("MaterialAlphaThreshold"), (material->IsAlphaTestEnabled()) ? material->GetAlphaThreshold() : 0.f);
+		s_shader->SendColor(s_shader->GetUniformLocation("MaterialDiffuse"), material->GetDiffuseColor());
+		s_shader->SendFloat(s_shader->GetUniformLocation("MeshHeight"), m_meshHeight);
+		s_shader->SendFloat(s_shader->GetUniformLocation("Time"), m_time);
+		s_shader->SendVector(s_shader->GetUniformLocation("WindDirection"), m_windDirection);
+		s_shader->SendFloat(s_shader->GetUniformLocation("WindFrequency"), m_windFrequency);
+		s_shader->SendFloat(s_shader->GetUniformLocation("WindStrength"), m_windStrength);
+
+		// The frustum is brought to the local space of the vegetation, where the cells are
+		Frustumf frustum;
+		frustum.Extract(Renderer::GetMatrix(MatrixType_WorldViewProj));
+
+		auto IsVisible = [&](const Cell& cell)
+		{
+			float windMargin = std::abs(m_windStrength) * cell.maxScale;
+
+			Boxf aabb = cell.aabb;
+			aabb.x -= windMargin;
+			aabb.z -= windMargin;
+			aabb.width += 2.f * windMargin;
+			aabb.depth += 2.f * windMargin;
+
+			return frustum.Contains(aabb);
+		};
+
+		if (Renderer::HasCapability(RendererCap_MultiDrawIndirect))
+		{
+			Int32 baseVertex = static_cast<Int32>(vertexBuffer->GetStartOffset() / vertexBuffer->GetStride());
+			UInt32 firstIndex = indexBuffer->GetStartOffset() / indexBuffer->GetStride();
+			UInt32 indexCount = indexBuffer->GetIndexCount();
+
+			// One command per range of visible cells following each other in the instance buffer
+			m_commands.clear();
+			for (const Cell& cell : m_cells)
+			{
+				if (!IsVisible(cell))
+					continue;
+
+				if (!m_commands.empty())
+				{
+					Renderer::DrawIndexedIndirectCommand& lastCommand = m_commands.back();
+					if (lastCommand.baseInstance + lastCommand.instanceCount == cell.firstInstance)
+					{
+						lastCommand.instanceCount += cell.instanceCount;
+						continue;
+					}
+				}
+
+				Renderer::DrawIndexedIndirectCommand command;
+				command.baseInstance = cell.firstInstance;
+				command.baseVertex = baseVertex;
+				command.firstIndex = firstIndex;
+				command.indexCount = indexCount;
+				command.instanceCount = cell.instanceCount;
+
+				m_commands.push_back(command);
+			}
+
+			if (!m_commands.empty())
+			{
+				UInt32 commandSize = static_cast<UInt32>(m_commands.size() * sizeof(Renderer::DrawIndexedIndirectCommand));
+				if (!m_commandBuffer.IsValid() || m_commandBuffer.GetSize() < commandSize)
+				{
+					// Every cell may be visible, so that the buffer is only created once
+					UInt32 maxCommandSize = static_cast<UInt32>(m_cells.size() * sizeof(Renderer::DrawIndexedIndirectCommand));
+					if (!m_commandBuffer.Create(maxCommandSize, DataStorage_Hardware, BufferUsage_Dynamic))
+					{
+						NazaraError("Failed to create command buffer");
+						return;
+					}
+				}
+
+				m_commandBuffer.Fill(m_commands.data(), 0, commandSize);
+
+				Renderer::SetInstanceBuffer(&m_instanceBuffer);
+				Renderer::DrawIndexedPrimitivesIndirect(primitiveMode, &m_commandBuffer, 0, static_cast<unsigned int>(m_commands.size()));
+			}
+		}
+		else
+		{
+			UInt32 indexCount = indexBuffer->GetIndexCount();
+			for (std::size_t i = 0; i < m_cells.size(); ++i)
+			{
+				if (!IsVisible(m_cells[i]))
+					continue;
+
+				Renderer::SetInstanceBuffer(m_cellInstanceBuffers[i]);
+				Renderer::DrawIndexedPrimitivesInstanced(m_cells[i].instanceCount, primitiveMode, 0, indexCount);
+			}
+		}
+
+		Renderer::SetInstanceBuffer(nullptr);
+	}
+
+	/*!
+	* \brief Scatters instances over the triangles of a mesh
+	* \return Number of instances added
+	*
+	* Instances are randomly spread with a uniform density, which may be modulated by a density map mapped by the texture coordinates of the mesh.
+	* The same parameters always give the same instances.
+	*
+	* \param surface Mesh (terrain, ground, ...) whose triangles are covered, in the local space of the vegetation
+	* \param density Number of instances per square unit
+	* \param densityMap Optional map whose red channel scales the density, from zero (no instance) to one
+	* \param seed Seed of the random placement
+	* \param minScale Minimum scale of the instances
+	* \param maxScale Maximum scale of the instances
+	*
+	* \remark Produces a NazaraError if the surface has no Float3 position, or no Float2 texture coordinates while a density map is used
+	*/
+
+	std::size_t Vegetation::Scatter(const StaticMesh& surface, float density, const Image* densityMap, UInt32 seed, float minScale, float maxScale)
+	{
+		NazaraAssert(density >= 0.f, "Density must be positive");
+		NazaraAssert(minScale <= maxScale, "Minimum scale must not be over maximum scale");
+
+		if (!surface.IsValid())
+		{
+			NazaraError("Invalid surface");
+			return 0;
+		}
+
+		PrimitiveMode primitiveMode = surface.GetPrimitiveMode();
+		if (primitiveMode != PrimitiveMode_TriangleFan && primitiveMode != PrimitiveMode_TriangleList && primitiveMode != PrimitiveMode_TriangleStrip)
+		{
+			NazaraError("Surface must be made of triangles");
+			return 0;
+		}
+
+		if (densityMap && !densityMap->IsValid())
+		{
+			NazaraError("Invalid density map");
+			return 0;
+		}
+
+		VertexMapper vertexMapper(&surface);
+
+		SparsePtr<Vector3f> positionPtr = vertexMapper.GetComponentPtr<Vector3f>(VertexComponent_Position);
+		if (!positionPtr)
+		{
+			NazaraError("Surface must have a Float3 position");
+			return 0;
+		}
+
+		SparsePtr<Vector2f> texCoordPtr = vertexMapper.GetComponentPtr<Vector2f>(VertexComponent_TexCoord);
+		if (densityMap && !texCoordPtr)
+		{
+			NazaraError("Surface must have Float2 texture coordinates to use a density map");
+			return 0;
+		}
+
+		std::mt19937 randomEngine(seed);
+		std::uniform_real_distribution<float> unitDistribution(0.f, 1.f);
+
+		std::size_t previousCount = m_instances.size();
+
+		TriangleIterator triangle(&surface);
+		do
+		{
+			Vector3f a = positionPtr[triangle[0]];
+			Vector3f b = positionPtr[triangle[1]];
+			Vector3f c = positionPtr[triangle[2]];
+
+			// The fractional part of the expected count is randomly rounded, so that small triangles still get instances
+			float area = 0.5f * Vector3f::CrossProduct(b - a, c - a).GetLength();
+			unsigned int instanceCount = static_cast<unsigned int>(area * density + unitDistribution(randomEngine));
+
+			for (unsigned int i = 0; i < instanceCount; ++i)
+			{
+				// Uniform point in the triangle, folding the points of the other half of the parallelogram
+				float u = unitDistribution(randomEngine);
+				float v = unitDistribution(randomEngine);
+				if (u + v > 1.f)
+				{
+					u = 1.f - u;
+					v = 1.f - v;
+				}
+
+				float scale = Lerp(minScale, maxScale, unitDistribution(randomEngine));
+				float rotation = 360.f * unitDistribution(randomEngine);
+
+				if (densityMap)
+				{
+					Vector2f uv = texCoordPtr[triangle[0]] + (texCoordPtr[triangle[1]] - texCoordPtr[triangle[0]]) * u + (texCoordPtr[triangle[2]] - texCoordPtr[triangle[0]]) * v;
+					if (unitDistribution(randomEngine) >= SampleDensity(*densityMap, uv))
+						continue;
+				}
+
+				AddInstance(a + (b - a) * u + (c - a) * v, scale, rotation);
+			}
+		}
+		while (triangle.Advance());
+
+		return m_instances.size() - previousCount;
+	}
+
+	/*!
+	* \brief Makes the bounding volume of this vegetation, from its cells and the wind
+	*/
+
+	void Vegetation::MakeBoundingVolume() const
+	{
+		UpdateCells();
+
+		if (m_cells.empty())
+		{
+			m_boundingVolume.MakeNull();
+			return;
+		}
+
+		float windMargin = 0.f;
+		Boxf aabb = m_cells.front().aabb;
+		for (const Cell& cell : m_cells)
+		{
+			aabb.ExtendTo(cell.aabb);
+			windMargin = std::max(windMargin, std::abs(m_windStrength) * cell.maxScale);
+		}
+
+		aabb.x -= windMargin;
+		aabb.z -= windMargin;
+		aabb.width += 2.f * windMargin;
+		aabb.depth += 2.f * windMargin;
+
+		m_boundingVolume.Set(aabb);
+	}
+
+	/*!
+	* \brief Uploads the instances to the GPU, if they changed
+	*/
+
+	void Vegetation::UpdateBuffers() const
+	{
+		UpdateCells();
+
+		if (!m_buffersInvalidated)
+			return;
+
+		m_cellInstanceBuffers.clear();
+
+		UInt32 instanceCount = static_cast<UInt32>(m_instances.size());
+		m_instanceBuffer.Reset(s_instanceDeclaration, instanceCount, DataStorage_Hardware, 0);
+		m_instanceBuffer.Fill(m_instances.data(), 0, instanceCount);
+
+		// Without multi draw indirect, there's no base instance, each cell has a vertex buffer starting at its first instance
+		if (!Renderer::HasCapability(RendererCap_MultiDrawIndirect))
+		{
+			m_cellInstanceBuffers.reserve(m_cells.size());
+			for (const Cell& cell : m_cells)
+				m_cellInstanceBuffers.emplace_back(VertexBuffer::New(s_instanceDeclaration, m_instanceBuffer.GetBuffer(), cell.firstInstance * UInt32(sizeof(Instance)), cell.instanceCount * UInt32(sizeof(Instance))));
+		}
+
+		m_buffersInvalidated = false;
+	}
+
+	/*!
+	* \brief Sorts the instances by cell and computes the bounding box of the cells, if the instances changed
+	*/
+
+	void Vegetation::UpdateCells() const
+	{
+		if (!m_cellsInvalidated)
+			return;
+
+		m_cells.clear();
+
+		// Cells are identified by their integer coordinates on the XZ plane, cells with the same X following each other
+		std::vector<std::pair<UInt64, UInt32>> cellInstances(m_instances.size());
+		for (std::size_t i = 0; i < m_instances.size(); ++i)
+		{
+			const Vector3f& position = m_instances[i].position;
+			Int32 cellX = static_cast<Int32>(std::floor(position.x / m_cellSize));
+			Int32 cellZ = static_cast<Int32>(std::floor(position.z / m_cellSize));
+
+			cellInstances[i].first = (static_cast<UInt64>(static_cast<UInt32>(cellX)) << 32) | static_cast<UInt32>(cellZ);
+			cellInstances[i].second = static_cast<UInt32>(i);
+		}
+
+		std::sort(cellInstances.begin(), cellInstances.end());
+
+		std::vector<Instance> sortedInstances(m_instances.size());
+		const Boxf& meshAABB = m_mesh->GetAABB();
+		for (std::size_t i = 0; i < cellInstances.size(); ++i)
+		{
+			const Instance& instance = m_instances[cellInstances[i].second];
+			sortedInstances[i] = instance;
+
+			float radius = m_meshRadius * instance.scale;
+			Boxf instanceAABB(instance.position.x - radius, instance.position.y + meshAABB.y * instance.scale, instance.position.z - radius,
+			                  2.f * radius, meshAABB.height * instance.scale, 2.f * radius);
+
+			if (i == 0 || cellInstances[i].first != cellInstances[i - 1].first)
+			{
+				Cell cell;
+				cell.aabb = instanceAABB;
+				cell.firstInstance = static_cast<UInt32>(i);
+				cell.instanceCount = 0;
+				cell.maxScale = 0.f;
+
+				m_cells.push_back(cell);
+			}
+
+			Cell& cell = m_cells.back();
+			cell.aabb.ExtendTo(instanceAABB);
+			cell.instanceCount++;
+			cell.maxScale = std::max(cell.maxScale, std::abs(instance.scale));
+		}
+
+		// Instances are only drawn in the order of the cells, which isn't part of the interface
+		m_instances = std::move(sortedInstances);
+		m_cellsInvalidated = false;
+	}
+
+	/*!
+	* \brief Initializes the vegetations
+	* \return true If successful
+	*
+	* The shader is created when the first vegetation is constructed, which keeps its compilation out of the startup of the module.
+	*
+	* \remark Produces a NazaraError if the shader could not be created
+	*/
+
+	bool Vegetation::Initialize()
+	{
+		if (s_shader)
+			return true;
+
+		try
+		{
+			ErrorFlags flags(ErrorFlag_ThrowException, true);
+
+			// Must match the Instance structure
+			VertexDeclarationRef declaration = VertexDeclaration::New();
+			declaration->EnableComponent(VertexComponent_InstanceData0, ComponentType_Float4, NazaraOffsetOf(Instance, position));
+			declaration->EnableComponent(VertexComponent_InstanceData1, ComponentType_Float2, NazaraOffsetOf(Instance, sinCos));
+
+			NazaraAssert(declaration->GetStride() == sizeof(Instance), "Invalid stride for vegetation instance declaration");
+
+			ShaderRef shader = Shader::New();
+			shader->Create();
+			shader->AttachStageFromSource(ShaderStageType_Vertex, reinterpret_cast<const char*>(r_vertexShader), sizeof(r_vertexShader));
+			shader->AttachStageFromSource(ShaderStageType_Fragment, reinterpret_cast<const char*>(r_fragmentShader), sizeof(r_fragmentShader));
+			shader->Link();
+
+			shader->SendInteger(shader->GetUniformLocation("MaterialDiffuseMap"), 0);
+
+			// Exception-free zone
+			s_instanceDeclaration = std::move(declaration);
+			s_shader = std::move(shader);
+		}
+		catch (const std::exception& e)
+		{
+			NazaraError("Failed to initialise: " + String(e.what()));
+			return false;
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Uninitializes the vegetations
+	*/
+
+	void Vegetation::Uninitialize()
+	{
+		s_instanceDeclaration.Reset();
+		s_shader.Reset();
+	}
+
+	ShaderRef Vegetation::s_shader;
+	VertexDeclarationRef Vegetation::s_instanceDeclaration;
+}
@@ -6,6 +6,7 @@
 #include <Nazara/Core/Core.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Lua/Config.hpp>
 #include <Nazara/Lua/Debug.hpp>
 
@@ -19,6 +20,8 @@ namespace Nz
 			return true; // Déjà initialisé
 		}
 
+		Profiler::Scope profilerScope("Lua::Initialize");
+
 		// Initialisation des dépendances
 		if (!Core::Initialize())
 		{
@@ -8,16 +8,31 @@
 #include <Lua/lualib.h>
 #include <Nazara/Core/Clock.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstdlib>
+#include <cstring>
+#include <new>
 #include <stdexcept>
+#include <vector>
 #include <Nazara/Lua/Debug.hpp>
 
 namespace Nz
 {
 	namespace
 	{
+		// Most of the blocks allocated by Lua (strings, tables, closures, upvalues, etc.) are small and short-lived
+		constexpr std::size_t s_poolGranularity = 16;
+		constexpr std::size_t s_poolMaxSize = 256;
+		constexpr std::size_t s_poolClassCount = s_poolMaxSize / s_poolGranularity;
+		constexpr std::size_t s_poolChunkSize = 64 * 1024;
+
+		inline std::size_t GetPoolClass(std::size_t size)
+		{
+			return (size - 1) / s_poolGranularity;
+		}
+
 		int AtPanic(lua_State* internalState)
 		{
 			String lastError(lua_tostring(internalState, -1));
@@ -26,10 +41,74 @@ namespace Nz
 		}
 	}
 
+	// A lua_State being used by a single thread at once, the pool doesn't have to lock anything
+	struct LuaInstance::SmallObjectPool
+	{
+		struct FreeBlock
+		{
+			FreeBlock* next;
+		};
+
+		void* Allocate(std::size_t size)
+		{
+			std::size_t poolClass = GetPoolClass(size);
+
+			FreeBlock*& freeList = freeLists[poolClass];
+			if (freeList)
+			{
+				FreeBlock* block = freeList;
+				freeList = block->next;
+
+				pooledBlockCount++;
+				return block;
+			}
+
+			std::size_t blockSize = (poolClass + 1) * s_poolGranularity;
+			if (chunkRemaining < blockSize)
+			{
+				// The end of the previous chunk is lost, at most s_poolMaxSize - s_poolGranularity bytes
+				UInt8* chunk = new (std::nothrow) UInt8[s_poolChunkSize];
+				if (!chunk)
+					return nullptr;
+
+				chunks.emplace_back(chunk);
+				chunkCursor = chunk;
+				chunkRemaining = s_poolChunkSize;
+			}
+
+			void* block = chunkCursor;
+			chunkCursor += blockSize;
+			chunkRemaining -= blockSize;
+
+			pooledBlockCount++;
+			return block;
+		}
+
+		void Free(void* ptr, std::size_t size)
+		{
+			FreeBlock* block = static_cast<FreeBlock*>(ptr);
+
+			FreeBlock*& freeList = freeLists[GetPoolClass(size)];
+			block->next = freeList;
+			freeList = block;
+
+			pooledBlockCount--;
+		}
+
+		std::array<FreeBlock*, s_poolClassCount> freeLists = {};
+		std::vector<std::unique_ptr<UInt8[]>> chunks;
+		std::size_t allocatedBlockCount = 0;
+		std::size_t chunkRemaining = 0;
+		std::size_t pooledBlockCount = 0;
+		UInt8* chunkCursor = nullptr;
+	};
+
 	LuaInstance::LuaInstance() :
 	LuaState(nullptr),
+	m_pool(std::make_unique<SmallObjectPool>()),
 	m_memoryLimit(0),
 	m_memoryUsage(0),
+	m_peakMemoryUsage(0),
 	m_timeLimit(1000),
 	m_level(0)
 	{
@@ -39,10 +118,17 @@ namespace Nz
 	}
 
 	LuaInstance::LuaInstance(LuaInstance&& instance) :
-	LuaState(std::move(instance))
+	LuaState(std::move(instance)),
+	m_memoryLimit(0),
+	m_memoryUsage(0),
+	m_peakMemoryUsage(0),
+	m_timeLimit(1000),
+	m_level(0)
 	{
+		std::swap(m_pool, instance.m_pool);
 		std::swap(m_memoryLimit, instance.m_memoryLimit);
 		std::swap(m_memoryUsage, instance.m_memoryUsage);
+		std::swap(m_peakMemoryUsage, instance.m_peakMemoryUsage);
 		std::swap(m_timeLimit, instance.m_timeLimit);
 		std::swap(m_clock, instance.m_clock);
 		std::swap(m_level, instance.m_level);
@@ -60,6 +146,53 @@ namespace Nz
 			lua_close(m_state);
 	}
 
+	/*!
+	* \brief Runs a full garbage collection cycle
+	*
+	* \remark This may take several milliseconds with a large heap, StepGarbageCollection can spread the work over several frames
+	*/
+	void LuaInstance::CollectGarbage()
+	{
+		lua_gc(m_state, LUA_GCCOLLECT, 0);
+	}
+
+	/*!
+	* \brief Enables or disables the automatic garbage collection
+	*
+	* \param enable Should Lua collect garbage by itself while allocating memory
+	*
+	* \remark With the automatic collection disabled, memory is only reclaimed by CollectGarbage and StepGarbageCollection
+	*/
+	void LuaInstance::EnableAutomaticGarbageCollection(bool enable)
+	{
+		lua_gc(m_state, (enable) ? LUA_GCRESTART : LUA_GCSTOP, 0);
+	}
+
+	/*!
+	* \brief Gets the statistics of the memory used by this instance
+	* \return Memory statistics, the sizes being the ones requested by Lua
+	*/
+	LuaInstance::MemoryStatistics LuaInstance::GetMemoryStatistics() const
+	{
+		MemoryStatistics statistics;
+		statistics.allocatedBlockCount = m_pool->allocatedBlockCount;
+		statistics.memoryUsage = m_memoryUsage;
+		statistics.peakMemoryUsage = m_peakMemoryUsage;
+		statistics.pooledBlockCount = m_pool->pooledBlockCount;
+		statistics.poolCapacity = m_pool->chunks.size() * s_poolChunkSize;
+
+		return statistics;
+	}
+
+	/*!
+	* \brief Checks whether the automatic garbage collection is enabled
+	* \return true If Lua collects garbage by itself while allocating memory
+	*/
+	bool LuaInstance::IsAutomaticGarbageCollectionEnabled() const
+	{
+		return lua_gc(m_state, LUA_GCISRUNNING, 0) != 0;
+	}
+
 	void LuaInstance::LoadLibraries(LuaLibFlags libFlags)
 	{
 		// From luaL_openlibs
@@ -102,12 +235,47 @@ namespace Nz
 		}
 	}
 
+	/*!
+	* \brief Sets the parameters of the incremental garbage collector
+	*
+	* \param pause How much memory (in percents of the memory in use after a collection) has to be allocated before starting a new cycle, 200 by default
+	* \param stepMultiplier Amount of work done (relatively to the memory allocated) by each automatic step, 200 by default
+	*/
+	void LuaInstance::SetGarbageCollectorParameters(int pause, int stepMultiplier)
+	{
+		lua_gc(m_state, LUA_GCSETPAUSE, pause);
+		lua_gc(m_state, LUA_GCSETSTEPMUL, stepMultiplier);
+	}
+
+	/*!
+	* \brief Does incremental garbage collection work for a limited time
+	* \return true If a collection cycle was completed
+	*
+	* \param microseconds Time budget, a step may go slightly over it
+	*
+	* \remark This is meant to be called once per frame (during idle time), usually with the automatic collection disabled
+	*/
+	bool LuaInstance::StepGarbageCollection(UInt32 microseconds)
+	{
+		UInt64 startTime = GetElapsedMicroseconds();
+		do
+		{
+			if (lua_gc(m_state, LUA_GCSTEP, 0) != 0)
+				return true;
+		}
+		while (GetElapsedMicroseconds() - startTime < microseconds);
+
+		return false;
+	}
+
 	LuaInstance& LuaInstance::operator=(LuaInstance&& instance)
 	{
 		LuaState::operator=(std::move(instance));
 
+		std::swap(m_pool, instance.m_pool);
 		std::swap(m_memoryLimit, instance.m_memoryLimit);
 		std::swap(m_memoryUsage, instance.m_memoryUsage);
+		std::swap(m_peakMemoryUsage, instance.m_peakMemoryUsage);
 		std::swap(m_timeLimit, instance.m_timeLimit);
 		std::swap(m_clock, instance.m_clock);
 		std::swap(m_level, instance.m_level);
@@ -124,33 +292,71 @@ namespace Nz
 	void* LuaInstance::MemoryAllocator(void* ud, void* ptr, std::size_t osize, std::size_t nsize)
 	{
 		LuaInstance* instance = static_cast<LuaInstance*>(ud);
+		SmallObjectPool& pool = *instance->m_pool;
 		std::size_t memoryLimit = instance->GetMemoryLimit();
 		std::size_t memoryUsage = instance->GetMemoryUsage();
 
+		// When ptr is null, osize is the type of the object being allocated
+		std::size_t oldSize = (ptr) ? osize : 0;
+
+		auto ReleaseBlock = [&pool] (void* block, std::size_t size)
+		{
+			if (size <= s_poolMaxSize)
+				pool.Free(block, size);
+			else
+				std::free(block);
+
+			pool.allocatedBlockCount--;
+		};
+
 		if (nsize == 0)
 		{
-			assert(memoryUsage >= osize);
+			if (ptr)
+			{
+				assert(memoryUsage >= oldSize);
 
-			instance->SetMemoryUsage(memoryUsage - osize);
-			std::free(ptr);
+				instance->SetMemoryUsage(memoryUsage - oldSize);
+				ReleaseBlock(ptr, oldSize);
+			}
 
 			return nullptr;
 		}
 		else
 		{
-			std::size_t usage = memoryUsage + nsize;
-			if (ptr)
-				usage -= osize;
-
+			std::size_t usage = memoryUsage + nsize - oldSize;
 			if (memoryLimit != 0 && usage > memoryLimit)
 			{
 				NazaraError("Lua memory usage is over memory limit (" + String::Number(usage) + " > " + String::Number(memoryLimit) + ')');
 				return nullptr;
 			}
 
+			// Lua always gives the size of the block being reallocated or freed, the pool doesn't need any header
+			void* newPtr;
+			if (ptr && oldSize <= s_poolMaxSize && nsize <= s_poolMaxSize && GetPoolClass(oldSize) == GetPoolClass(nsize))
+				newPtr = ptr;
+			else if (ptr && oldSize > s_poolMaxSize && nsize > s_poolMaxSize)
+				newPtr = std::realloc(ptr, nsize);
+			else
+			{
+				newPtr = (nsize <= s_poolMaxSize) ? pool.Allocate(nsize) : std::malloc(nsize);
+				if (!newPtr)
+					return nullptr;
+
+				pool.allocatedBlockCount++;
+
+				if (ptr)
+				{
+					std::memcpy(newPtr, ptr, std::min(oldSize, nsize));
+					ReleaseBlock(ptr, oldSize);
+				}
+			}
+
+			if (!newPtr)
+				return nullptr;
+
 			instance->SetMemoryUsage(usage);
 
-			return std::realloc(ptr, nsize);
+			return newPtr;
 		}
 	}
 
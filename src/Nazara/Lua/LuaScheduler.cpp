@@ -0,0 +1,377 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Lua scripting module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Lua/LuaScheduler.hpp>
+#include <Lua/lauxlib.h>
+#include <Lua/lua.h>
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <algorithm>
+#include <Nazara/Lua/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		// The hook is called this often while a script only has a time budget
+		constexpr UInt32 s_timeBudgetHookPeriod = 1000;
+
+		static_assert(LUA_EXTRASPACE >= sizeof(void*), "The script of a thread is stored in its extra space");
+	}
+
+	/*!
+	* \ingroup lua
+	* \class Nz::LuaScheduler
+	* \brief Lua class that runs many scripts (coroutines) over one or more Lua instances, each script running a little at every update
+	*
+	* Every update resumes each running script once, until it yields, ends or exhausts its budget (it is then resumed at the next update).
+	* Instances are independent from each other and are updated in parallel, with the TaskScheduler.
+	* The threads of the scripts which ended normally are kept by their instance, to be reused for the next scripts.
+	*
+	* \remark Scripts may only yield (or have their budget enforced) when no C function calling Lua is in their call stack
+	*/
+
+	/*!
+	* \brief Constructs a LuaScheduler object
+	*
+	* \param instanceCount Number of Lua instances, which can be updated at the same time, one or more
+	*/
+	LuaScheduler::LuaScheduler(unsigned int instanceCount) :
+	m_runningScriptCount(0)
+	{
+		NazaraAssert(instanceCount > 0, "Instance count must be over zero");
+
+		m_workers.reserve(instanceCount);
+		for (unsigned int i = 0; i < instanceCount; ++i)
+			m_workers.emplace_back(new Worker);
+	}
+
+	/*!
+	* \brief Destructs the object, and the scripts which are still running with their instance
+	*/
+	LuaScheduler::~LuaScheduler() = default;
+
+	/*!
+	* \brief Gets the instruction budget of a script
+	* \return Number of instructions the script can execute per update, zero if there is no limit
+	*
+	* \param script Identifier of the script
+	*/
+	UInt32 LuaScheduler::GetInstructionBudget(ScriptId script) const
+	{
+		const Script* scriptData = GetScript(script);
+		NazaraAssert(scriptData, "Invalid script");
+
+		return scriptData->instructionBudget;
+	}
+
+	/*!
+	* \brief Gets the time budget of a script
+	* \return Duration (in microseconds) the script can run per update, zero if there is no limit
+	*
+	* \param script Identifier of the script
+	*/
+	UInt32 LuaScheduler::GetTimeBudget(ScriptId script) const
+	{
+		const Script* scriptData = GetScript(script);
+		NazaraAssert(scriptData, "Invalid script");
+
+		return scriptData->timeBudget;
+	}
+
+	/*!
+	* \brief Checks whether a script is still running
+	* \return true If the script has not ended, failed or been killed
+	*
+	* \param script Identifier of the script
+	*/
+	bool LuaScheduler::IsRunning(ScriptId script) const
+	{
+		return GetScript(script) != nullptr;
+	}
+
+	/*!
+	* \brief Stops a script, which won't be resumed anymore
+	*
+	* \param script Identifier of the script, which may have ended already
+	*
+	* \remark This must not be called while Update is running
+	*/
+	void LuaScheduler::Kill(ScriptId script)
+	{
+		Script* scriptData = GetScript(script);
+		if (!scriptData)
+			return;
+
+		Worker& worker = *m_workers[scriptData->instanceIndex];
+
+		UInt32 scriptIndex = static_cast<UInt32>(script & 0xFFFFFFFF);
+		worker.runningScripts.erase(std::find(worker.runningScripts.begin(), worker.runningScripts.end(), scriptIndex));
+
+		ReleaseThread(worker, *scriptData);
+
+		scriptData->running = false;
+		m_freeScripts.push_back(scriptIndex);
+		m_runningScriptCount--;
+	}
+
+	/*!
+	* \brief Sets the instruction budget of a script
+	*
+	* \param script Identifier of the script
+	* \param instructionCount Number of instructions the script can execute per update, before being suspended until the next one, zero for no limit
+	*/
+	void LuaScheduler::SetInstructionBudget(ScriptId script, UInt32 instructionCount)
+	{
+		Script* scriptData = GetScript(script);
+		NazaraAssert(scriptData, "Invalid script");
+
+		scriptData->instructionBudget = instructionCount;
+	}
+
+	/*!
+	* \brief Sets the time budget of a script
+	*
+	* \param script Identifier of the script
+	* \param microseconds Duration the script can run per update, before being suspended until the next one, zero for no limit
+	*
+	* \remark The time is checked every thousand instructions (or less if the instruction budget is lower)
+	*/
+	void LuaScheduler::SetTimeBudget(ScriptId script, UInt32 microseconds)
+	{
+		Script* scriptData = GetScript(script);
+		NazaraAssert(scriptData, "Invalid script");
+
+		scriptData->timeBudget = microseconds;
+	}
+
+	/*!
+	* \brief Spawns a script on the instance running the fewest scripts
+	* \return Identifier of the script, zero if it couldn't be spawned
+	*
+	* \param functionName Name of the global function the script runs
+	*
+	* \see Spawn
+	*/
+	LuaScheduler::ScriptId LuaScheduler::Spawn(const String& functionName)
+	{
+		auto it = std::min_element(m_workers.begin(), m_workers.end(), [] (const std::unique_ptr<Worker>& first, const std::unique_ptr<Worker>& second)
+		{
+			return first->runningScripts.size() < second->runningScripts.size();
+		});
+
+		return Spawn(functionName, static_cast<unsigned int>(it - m_workers.begin()));
+	}
+
+	/*!
+	* \brief Spawns a script, which begins at the next update
+	* \return Identifier of the script, zero if it couldn't be spawned
+	*
+	* \param functionName Name of the global function the script runs
+	* \param instanceIndex Index of the instance running the script
+	*
+	* \remark This must not be called while Update is running
+	* \remark Produces a NazaraError if the global is not a function
+	*/
+	LuaScheduler::ScriptId LuaScheduler::Spawn(const String& functionName, unsigned int instanceIndex)
+	{
+		NazaraAssert(instanceIndex < m_workers.size(), "Instance index out of range");
+
+		Worker& worker = *m_workers[instanceIndex];
+
+		PooledThread thread;
+		if (!worker.freeThreads.empty())
+		{
+			thread = worker.freeThreads.back();
+			worker.freeThreads.pop_back();
+		}
+		else
+		{
+			lua_State* mainState = worker.instance.GetInternalState();
+
+			thread.thread = lua_newthread(mainState);
+			thread.ref = luaL_ref(mainState, LUA_REGISTRYINDEX);
+		}
+
+		if (lua_getglobal(thread.thread, functionName.GetConstBuffer()) != LUA_TFUNCTION)
+		{
+			lua_settop(thread.thread, 0);
+			worker.freeThreads.push_back(thread);
+
+			NazaraError("Global \"" + functionName + "\" is not a function");
+			return 0;
+		}
+
+		UInt32 scriptIndex;
+		if (!m_freeScripts.empty())
+		{
+			scriptIndex = m_freeScripts.back();
+			m_freeScripts.pop_back();
+		}
+		else
+		{
+			scriptIndex = static_cast<UInt32>(m_scripts.size());
+			m_scripts.emplace_back();
+		}
+
+		Script& script = m_scripts[scriptIndex];
+		script.error.Clear();
+		script.generation++;
+		script.instanceIndex = instanceIndex;
+		script.instructionBudget = 0;
+		script.running = true;
+		script.thread = thread.thread;
+		script.threadRef = thread.ref;
+		script.timeBudget = 0;
+
+		worker.runningScripts.push_back(scriptIndex);
+		m_runningScriptCount++;
+
+		return (static_cast<ScriptId>(script.generation) << 32) | scriptIndex;
+	}
+
+	/*!
+	* \brief Resumes every running script once, the instances being updated in parallel
+	*
+	* OnScriptFinished and OnScriptError are signaled from the calling thread, once every instance has been updated.
+	*
+	* \remark Scripts must not call the methods of the scheduler
+	*/
+	void LuaScheduler::Update()
+	{
+		if (m_workers.size() > 1)
+		{
+			TaskScheduler::ParallelFor(0, m_workers.size(), 1, [this] (std::size_t first, std::size_t last)
+			{
+				for (std::size_t i = first; i < last; ++i)
+					UpdateWorker(*m_workers[i]);
+			});
+		}
+		else
+			UpdateWorker(*m_workers.front());
+
+		for (const auto& worker : m_workers)
+		{
+			for (UInt32 scriptIndex : worker->endedScripts)
+			{
+				Script& script = m_scripts[scriptIndex];
+				ScriptId scriptId = (static_cast<ScriptId>(script.generation) << 32) | scriptIndex;
+
+				m_freeScripts.push_back(scriptIndex);
+				m_runningScriptCount--;
+
+				if (script.error.IsEmpty())
+					OnScriptFinished(this, scriptId);
+				else
+					OnScriptError(this, scriptId, script.error);
+			}
+
+			worker->endedScripts.clear();
+		}
+	}
+
+	LuaScheduler::Script* LuaScheduler::GetScript(ScriptId script)
+	{
+		return const_cast<Script*>(static_cast<const LuaScheduler*>(this)->GetScript(script));
+	}
+
+	const LuaScheduler::Script* LuaScheduler::GetScript(ScriptId script) const
+	{
+		UInt32 scriptIndex = static_cast<UInt32>(script & 0xFFFFFFFF);
+		UInt32 generation = static_cast<UInt32>(script >> 32);
+		if (scriptIndex >= m_scripts.size())
+			return nullptr;
+
+		const Script& scriptData = m_scripts[scriptIndex];
+		if (!scriptData.running || scriptData.generation != generation)
+			return nullptr;
+
+		return &scriptData;
+	}
+
+	void LuaScheduler::ReleaseThread(Worker& worker, Script& script)
+	{
+		// A thread can only be reused if its function returned (Lua 5.3 can't reset a suspended or failed thread)
+		if (lua_status(script.thread) == LUA_OK)
+		{
+			lua_settop(script.thread, 0);
+			worker.freeThreads.push_back({script.thread, script.threadRef});
+		}
+		else
+			luaL_unref(worker.instance.GetInternalState(), LUA_REGISTRYINDEX, script.threadRef);
+
+		script.thread = nullptr;
+		script.threadRef = LUA_NOREF;
+	}
+
+	void LuaScheduler::UpdateWorker(Worker& worker)
+	{
+		for (UInt32 scriptIndex : worker.runningScripts)
+		{
+			Script& script = m_scripts[scriptIndex];
+
+			// Each thread has its own hook, which doesn't slow down the scripts without a budget
+			*static_cast<Script**>(lua_getextraspace(script.thread)) = &script;
+			if (script.instructionBudget > 0 || script.timeBudget > 0)
+			{
+				script.executedInstructions = 0;
+				if (script.timeBudget > 0)
+					script.hookPeriod = (script.instructionBudget > 0) ? std::min(script.instructionBudget, s_timeBudgetHookPeriod) : s_timeBudgetHookPeriod;
+				else
+					script.hookPeriod = script.instructionBudget;
+
+				script.sliceStartTime = GetElapsedMicroseconds();
+
+				lua_sethook(script.thread, BudgetHook, LUA_MASKCOUNT, static_cast<int>(script.hookPeriod));
+			}
+			else
+				lua_sethook(script.thread, nullptr, 0, 0);
+
+			int status = lua_resume(script.thread, nullptr, 0);
+			if (status == LUA_YIELD)
+			{
+				lua_settop(script.thread, 0); //< Values given to coroutine.yield are ignored
+				continue;
+			}
+
+			if (status != LUA_OK)
+			{
+				std::size_t length;
+				const char* error = lua_tolstring(script.thread, -1, &length);
+
+				script.error = (error && length > 0) ? String(error, length) : String("Unknown error");
+			}
+
+			ReleaseThread(worker, script);
+
+			script.running = false;
+			worker.endedScripts.push_back(scriptIndex);
+		}
+
+		if (!worker.endedScripts.empty())
+		{
+			worker.runningScripts.erase(std::remove_if(worker.runningScripts.begin(), worker.runningScripts.end(), [this] (UInt32 scriptIndex)
+			{
+				return !m_scripts[scriptIndex].running;
+			}), worker.runningScripts.end());
+		}
+	}
+
+	void LuaScheduler::BudgetHook(lua_State* thread, lua_Debug* debug)
+	{
+		NazaraUnused(debug);
+
+		Script* script = *static_cast<Script**>(lua_getextraspace(thread));
+		script->executedInstructions += script->hookPeriod;
+
+		bool exhausted = (script->instructionBudget > 0 && script->executedInstructions >= script->instructionBudget);
+		if (!exhausted && script->timeBudget > 0)
+			exhausted = (GetElapsedMicroseconds() - script->sliceStartTime >= script->timeBudget);
+
+		// The script is suspended until the next update, unless it can't yield (a C function calling Lua is in its call stack)
+		if (exhausted && lua_isyieldable(thread))
+			lua_yield(thread, 0);
+	}
+}
@@ -149,6 +149,9 @@ namespace Nz
 			case Nz::SocketError_Internal:
 				return "An internal error occurred";
 
+			case Nz::SocketError_Interrupted:
+				return "The operation was cancelled";
+
 			case Nz::SocketError_Packet:
 				return "Packet encoding or decoding failed";
 
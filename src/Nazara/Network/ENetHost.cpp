@@ -13,10 +13,15 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Metrics.hpp>
 #include <Nazara/Core/OffsetOf.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Network/Algorithm.hpp>
 #include <Nazara/Network/ENetPeer.hpp>
 #include <Nazara/Network/NetPacket.hpp>
+#include <algorithm>
+#include <iterator>
 #include <Nazara/Network/Debug.hpp>
 
 namespace Nz
@@ -44,14 +49,17 @@ namespace Nz
 
 	void ENetHost::Broadcast(UInt8 channelId, ENetPacketFlags flags, NetPacket&& packet)
 	{
-		ENetPacketRef enetPacket = AllocatePacket(flags, std::move(packet));
+		Broadcast(channelId, AllocatePacket(flags, std::move(packet)));
+	}
 
+	void ENetHost::Broadcast(UInt8 channelId, const ENetPacketRef& packet)
+	{
 		for (ENetPeer& peer : m_peers)
 		{
 			if (peer.GetState() != ENetPeerState::Connected)
 				continue;
 
-			peer.Send(channelId, enetPacket);
+			peer.Send(channelId, packet);
 		}
 	}
 
@@ -121,16 +129,7 @@ namespace Nz
 		if (results.empty())
 			return nullptr;
 
-		IpAddress hostnameAddress;
-		for (const HostnameInfo& result : results)
-		{
-			if (!result.address)
-				continue;
-
-			hostnameAddress = result.address;
-			break; //< Take first valid address
-		}
-
+		IpAddress hostnameAddress = SelectAddress(results);
 		if (!hostnameAddress.IsValid())
 		{
 			if (error)
@@ -142,6 +141,18 @@ namespace Nz
 		return Connect(hostnameAddress, channelCount, data);
 	}
 
+	void ENetHost::ConnectAsync(const String& hostName, ConnectCallback callback, NetProtocol protocol, const String& service, std::size_t channelCount, UInt32 data)
+	{
+		// The connection is issued by the thread servicing the host once the resolution completes, hosts aren't thread-safe
+		PendingConnection connection;
+		connection.callback = std::move(callback);
+		connection.channelCount = channelCount;
+		connection.data = data;
+		connection.resolution = IpAddress::ResolveHostnameAsync(protocol, hostName, service);
+
+		m_pendingConnections.emplace_back(std::move(connection));
+	}
+
 	bool ENetHost::Create(const IpAddress& listenAddress, std::size_t peerCount, std::size_t channelCount)
 	{
 		return Create(listenAddress, peerCount, channelCount, 0, 0);
@@ -178,6 +189,16 @@ namespace Nz
 		m_receivedData = nullptr;
 		m_receivedDataLength = 0;
 
+		// Datagrams are received and sent by batches, to make less system calls
+		for (DatagramBatch* batch : { &m_queuedDatagrams, &m_receivedDatagrams })
+		{
+			if (!batch->data)
+				batch->data.reset(new UInt8[ENetConstants::ENetHost_DatagramBatchSize * ENetConstants::ENetProtocol_MaximumMTU]);
+
+			batch->count = 0;
+			batch->index = 0;
+		}
+
 		m_totalSentData = 0;
 		m_totalSentPackets = 0;
 		m_totalReceivedData = 0;
@@ -205,6 +226,11 @@ namespace Nz
 
 	int ENetHost::Service(ENetEvent* event, UInt32 timeout)
 	{
+		Profiler::Scope profilerScope("ENetHost::Service");
+
+		if (!m_pendingConnections.empty())
+			ConnectResolvedHosts();
+
 		if (event)
 		{
 			event->type = ENetEventType::None;
@@ -328,6 +354,12 @@ namespace Nz
 		m_socket.SetReceiveBufferSize(ENetConstants::ENetHost_ReceiveBufferSize);
 		m_socket.SetSendBufferSize(ENetConstants::ENetHost_SendBufferSize);
 
+		if (m_isUsingPortReuse && !m_socket.EnablePortReuse(true))
+		{
+			NazaraError("Failed to enable port reuse");
+			return false;
+		}
+
 		if (address.IsValid() && !address.IsLoopback())
 		{
 			if (m_socket.Bind(address) != SocketState_Bound)
@@ -347,6 +379,98 @@ namespace Nz
 		m_dispatchQueue.UnboundedSet(peer->GetPeerId());
 	}
 
+	void ENetHost::ConnectResolvedHosts()
+	{
+		// Callbacks may start new connections, ready ones are moved out before being processed
+		auto readyEnd = std::partition(m_pendingConnections.begin(), m_pendingConnections.end(), [](const PendingConnection& connection)
+		{
+			return connection.resolution.wait_for(std::chrono::seconds(0)) != std::future_status::ready;
+		});
+
+		if (readyEnd == m_pendingConnections.end())
+			return;
+
+		std::vector<PendingConnection> readyConnections(std::make_move_iterator(readyEnd), std::make_move_iterator(m_pendingConnections.end()));
+		m_pendingConnections.erase(readyEnd, m_pendingConnections.end());
+
+		for (PendingConnection& connection : readyConnections)
+		{
+			const HostnameResolution& resolution = connection.resolution.get();
+
+			ENetPeer* peer = nullptr;
+			ResolveError error = resolution.error;
+			if (error == ResolveError_NoError)
+			{
+				IpAddress hostnameAddress = SelectAddress(resolution.results);
+				if (hostnameAddress.IsValid())
+					peer = Connect(hostnameAddress, connection.channelCount, connection.data);
+				else
+					error = ResolveError_NotFound;
+			}
+
+			if (connection.callback)
+				connection.callback(peer, error);
+		}
+	}
+
+	bool ENetHost::FlushQueuedDatagrams()
+	{
+		std::size_t datagramIndex = 0;
+		while (datagramIndex < m_queuedDatagrams.count)
+		{
+			std::size_t sentCount;
+			if (!m_socket.SendDatagrams(&m_queuedDatagrams.datagrams[datagramIndex], m_queuedDatagrams.count - datagramIndex, &sentCount))
+			{
+				m_queuedDatagrams.count = 0;
+				return false;
+			}
+
+			// The socket would block, drop the remaining datagrams as a single send would have
+			if (sentCount == 0)
+				break;
+
+			UInt32 sentBytes = 0;
+			for (std::size_t i = 0; i < sentCount; ++i)
+				sentBytes += m_queuedDatagrams.datagrams[datagramIndex + i].dataLength;
+
+			m_totalSentData += sentBytes;
+			Metrics::Add(s_sentBytesMetric, sentBytes);
+
+			datagramIndex += sentCount;
+		}
+
+		m_queuedDatagrams.count = 0;
+		return true;
+	}
+
+	void ENetHost::QueueDatagram(const IpAddress& to, const NetBuffer* buffers, std::size_t bufferCount)
+	{
+		NazaraAssert(m_queuedDatagrams.count < m_queuedDatagrams.datagrams.size(), "Datagram batch is full");
+
+		std::size_t datagramIndex = m_queuedDatagrams.count++;
+
+		// The buffers are reused for the next peer, so the datagram has to be copied
+		UInt8* datagramData = &m_queuedDatagrams.data[datagramIndex * ENetConstants::ENetProtocol_MaximumMTU];
+		std::size_t datagramSize = 0;
+		for (std::size_t i = 0; i < bufferCount; ++i)
+		{
+			NazaraAssert(datagramSize + buffers[i].dataLength <= ENetConstants::ENetProtocol_MaximumMTU, "Datagram exceeds maximum MTU");
+
+			std::memcpy(&datagramData[datagramSize], buffers[i].data, buffers[i].dataLength);
+			datagramSize += buffers[i].dataLength;
+		}
+
+		NetBuffer& buffer = m_queuedDatagrams.buffers[datagramIndex];
+		buffer.data = datagramData;
+		buffer.dataLength = datagramSize;
+
+		NetDatagram& datagram = m_queuedDatagrams.datagrams[datagramIndex];
+		datagram.address = to;
+		datagram.buffers = &buffer;
+		datagram.bufferCount = 1;
+		datagram.dataLength = 0;
+	}
+
 	void ENetHost::RemoveFromDispatchQueue(ENetPeer* peer)
 	{
 		m_dispatchQueue.UnboundedReset(peer->GetPeerId());
@@ -526,10 +650,20 @@ namespace Nz
 			if (!m_compressor)
 				return false;
 
+			UInt64 decompressionStart = GetElapsedMicroseconds();
 			std::size_t newSize = m_compressor->Decompress(peer, m_receivedData + headerSize, m_receivedDataLength - headerSize, m_packetData[1].data() + headerSize, m_packetData[1].size() - headerSize);
 			if (newSize == 0 || newSize > m_packetData[1].size() - headerSize)
 				return false;
 
+			if (peer)
+			{
+				ENetPeer::CompressionStats& stats = peer->m_compressionStats;
+				stats.decompressedDatagramCount++;
+				stats.decompressionTime += GetElapsedMicroseconds() - decompressionStart;
+				stats.incomingCompressedSize += m_receivedDataLength - headerSize;
+				stats.incomingDecompressedSize += newSize;
+			}
+
 			std::memcpy(m_packetData[1].data(), header, headerSize);
 			m_receivedData = m_packetData[1].data();
 			m_receivedDataLength = headerSize + newSize;
@@ -714,13 +848,42 @@ namespace Nz
 				}
 			}
 
+			UInt8* receivedData = m_packetData[0].data();
+
 			if (shouldReceive)
 			{
-				if (!m_socket.Receive(m_packetData[0].data(), m_packetData[0].size(), &m_receivedAddress, &receivedLength))
-					return -1; //< Error
+				// Drain as many datagrams as possible from the socket at once, an event may make us return before handling all of them
+				if (m_receivedDatagrams.index == m_receivedDatagrams.count)
+				{
+					for (std::size_t j = 0; j < m_receivedDatagrams.datagrams.size(); ++j)
+					{
+						NetBuffer& buffer = m_receivedDatagrams.buffers[j];
+						buffer.data = &m_receivedDatagrams.data[j * ENetConstants::ENetProtocol_MaximumMTU];
+						buffer.dataLength = ENetConstants::ENetProtocol_MaximumMTU;
+
+						NetDatagram& datagram = m_receivedDatagrams.datagrams[j];
+						datagram.buffers = &buffer;
+						datagram.bufferCount = 1;
+					}
+
+					m_receivedDatagrams.index = 0;
+					if (!m_socket.ReceiveDatagrams(m_receivedDatagrams.datagrams.data(), m_receivedDatagrams.datagrams.size(), &m_receivedDatagrams.count))
+					{
+						m_receivedDatagrams.count = 0;
+						return -1; //< Error
+					}
+
+					if (m_receivedDatagrams.count == 0)
+						return 0;
+				}
+
+				const NetDatagram& datagram = m_receivedDatagrams.datagrams[m_receivedDatagrams.index++];
+				m_receivedAddress = datagram.address;
+				receivedData = static_cast<UInt8*>(datagram.buffers->data);
+				receivedLength = datagram.dataLength;
 
 				if (receivedLength == 0)
-					return 0;
+					continue;
 
 				if (m_isSimulationEnabled)
 				{
@@ -733,7 +896,7 @@ namespace Nz
 						PendingIncomingPacket pendingPacket;
 						pendingPacket.deliveryTime = m_serviceTime + delay;
 						pendingPacket.from = m_receivedAddress;
-						pendingPacket.data.Reset(0, m_packetData[0].data(), receivedLength);
+						pendingPacket.data.Reset(0, receivedData, receivedLength);
 
 						auto it = std::upper_bound(m_pendingIncomingPackets.begin(), m_pendingIncomingPackets.end(), pendingPacket, [] (const PendingIncomingPacket& first, const PendingIncomingPacket& second)
 						{
@@ -746,12 +909,14 @@ namespace Nz
 				}
 			}
 
-			m_receivedData = m_packetData[0].data();
+			m_receivedData = receivedData;
 			m_receivedDataLength = receivedLength;
 
 			m_totalReceivedData += receivedLength;
 			m_totalReceivedPackets++;
 
+			Metrics::Add(s_receivedBytesMetric, receivedLength);
+
 			// Intercept
 
 			if (HandleIncomingCommands(event))
@@ -982,7 +1147,7 @@ namespace Nz
 				if (checkForTimeouts && !currentPeer->m_sentReliableCommands.empty() && ENetTimeGreaterEqual(m_serviceTime, currentPeer->m_nextTimeout) && currentPeer->CheckTimeouts(event))
 				{
 					if (event && event->type != ENetEventType::None)
-						return 1;
+						return (FlushQueuedDatagrams()) ? 1 : -1;
 					else
 						continue;
 				}
@@ -1043,9 +1208,27 @@ namespace Nz
 				std::size_t compressedSize = 0;
 				if (m_compressor)
 				{
-					compressedSize = m_compressor->Compress(currentPeer, &m_buffers[1], m_bufferCount - 1, m_packetSize - sizeof(ENetProtocolHeader), m_packetData[1].data(), m_packetData[1].size());
+					std::size_t rawSize = m_packetSize - sizeof(ENetProtocolHeader);
+
+					UInt64 compressionStart = GetElapsedMicroseconds();
+					compressedSize = m_compressor->Compress(currentPeer, &m_buffers[1], m_bufferCount - 1, rawSize, m_packetData[1].data(), m_packetData[1].size());
+
+					ENetPeer::CompressionStats& stats = currentPeer->m_compressionStats;
+					stats.compressionTime += GetElapsedMicroseconds() - compressionStart;
+					stats.outgoingRawSize += rawSize;
+
 					if (compressedSize > 0)
+					{
 						m_headerFlags |= ENetProtocolHeaderFlag_Compressed;
+
+						stats.compressedDatagramCount++;
+						stats.outgoingCompressedSize += compressedSize;
+					}
+					else
+					{
+						stats.uncompressedDatagramCount++;
+						stats.outgoingCompressedSize += rawSize;
+					}
 				}
 
 				if (currentPeer->m_outgoingPeerID < ENetConstants::ENetProtocol_MaximumPeerId)
@@ -1100,12 +1283,11 @@ namespace Nz
 
 				if (sendNow)
 				{
-					std::size_t sentLength = 0;
-
-					if (!m_socket.SendMultiple(currentPeer->GetAddress(), m_buffers.data(), m_bufferCount, &sentLength))
+					// Datagrams for every peer are sent together
+					if (m_queuedDatagrams.count == m_queuedDatagrams.datagrams.size() && !FlushQueuedDatagrams())
 						return -1;
 
-					m_totalSentData += sentLength;
+					QueueDatagram(currentPeer->GetAddress(), m_buffers.data(), m_bufferCount);
 				}
 
 				currentPeer->RemoveSentUnreliableCommands();
@@ -1113,6 +1295,9 @@ namespace Nz
 			}
 		}
 
+		if (!FlushQueuedDatagrams())
+			return -1;
+
 		if (!m_pendingOutgoingPackets.empty())
 		{
 			auto it = m_pendingOutgoingPackets.begin();
@@ -1354,19 +1539,48 @@ namespace Nz
 		return s_commandSizes[commandNumber & ENetProtocolCommand_Mask];
 	}
 
+	IpAddress ENetHost::SelectAddress(const std::vector<HostnameInfo>& results)
+	{
+		for (const HostnameInfo& result : results)
+		{
+			if (result.address)
+				return result.address; //< Take first valid address
+		}
+
+		return IpAddress::Invalid;
+	}
+
 	bool ENetHost::Initialize()
 	{
 		std::random_device device;
 		s_randomGenerator.seed(device());
 		s_randomGenerator64.seed(device());
 
+		s_connectedPeersMetric = Metrics::Register(MetricType_Gauge, "nazara_enet_connected_peers", "Peers connected to an ENet host");
+		s_receivedBytesMetric = Metrics::Register(MetricType_Counter, "nazara_enet_received_bytes_total", "Bytes received by ENet hosts");
+		s_retransmittedCommandsMetric = Metrics::Register(MetricType_Counter, "nazara_enet_retransmitted_commands_total", "Reliable commands sent again by ENet hosts after a timeout");
+		s_sentBytesMetric = Metrics::Register(MetricType_Counter, "nazara_enet_sent_bytes_total", "Bytes sent by ENet hosts");
+
 		return true;
 	}
 
 	void ENetHost::Uninitialize()
 	{
+		Metrics::Unregister(s_connectedPeersMetric);
+		Metrics::Unregister(s_receivedBytesMetric);
+		Metrics::Unregister(s_retransmittedCommandsMetric);
+		Metrics::Unregister(s_sentBytesMetric);
+
+		s_connectedPeersMetric = Metrics::InvalidId;
+		s_receivedBytesMetric = Metrics::InvalidId;
+		s_retransmittedCommandsMetric = Metrics::InvalidId;
+		s_sentBytesMetric = Metrics::InvalidId;
 	}
 
 	std::mt19937 ENetHost::s_randomGenerator;
 	std::mt19937_64 ENetHost::s_randomGenerator64;
+	UInt32 ENetHost::s_connectedPeersMetric = Metrics::InvalidId;
+	UInt32 ENetHost::s_receivedBytesMetric = Metrics::InvalidId;
+	UInt32 ENetHost::s_retransmittedCommandsMetric = Metrics::InvalidId;
+	UInt32 ENetHost::s_sentBytesMetric = Metrics::InvalidId;
 }
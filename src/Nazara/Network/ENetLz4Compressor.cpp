@@ -0,0 +1,211 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/ENetLz4Compressor.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Network/NetBuffer.hpp>
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+#include <unordered_set>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		constexpr std::size_t TrainingGramSize = 8;
+		constexpr std::size_t TrainingMaxSegmentSize = 256;
+
+		UInt64 Read64(const UInt8* ptr)
+		{
+			UInt64 value;
+			std::memcpy(&value, ptr, sizeof(UInt64));
+
+			return value;
+		}
+	}
+
+	/*!
+	* \ingroup network
+	* \class Nz::ENetLz4Compressor
+	* \brief Network class compressing ENet datagrams using the LZ4 block format
+	*
+	* LZ4 is very fast but small datagrams have few repetitions within themselves.
+	* Setting a dictionary (the same on both ends) allows matches to refer to it, usually the dictionary is trained on typical datagrams using TrainDictionary.
+	*
+	* Datagrams which can't be made smaller are sent uncompressed.
+	*
+	* \see ENetHost::SetCompressor
+	*/
+
+	/*!
+	* \brief Constructs an ENetLz4Compressor object without any dictionary
+	*/
+	ENetLz4Compressor::ENetLz4Compressor()
+	{
+		m_dictionaryHashTable.fill(0);
+	}
+
+	std::size_t ENetLz4Compressor::Compress(const ENetPeer* /*peer*/, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		// Too small to contain a match
+		if (totalInputSize < 13)
+			return 0;
+
+		// The buffer starts with the dictionary (see SetDictionary), data goes right after so matches may go back into it
+		std::size_t dictionarySize = m_dictionary.GetSize();
+		m_buffer.resize(dictionarySize + totalInputSize);
+
+		UInt8* data = m_buffer.data() + dictionarySize;
+		for (std::size_t i = 0; i < bufferCount; ++i)
+		{
+			std::memcpy(data, buffers[i].data, buffers[i].dataLength);
+			data += buffers[i].dataLength;
+		}
+
+		m_hashTable = m_dictionaryHashTable;
+
+		// Compressed output must be smaller than raw data to be useful
+		return Lz4::Compress(m_buffer.data(), dictionarySize, totalInputSize, m_hashTable, output, std::min(maxOutputSize, totalInputSize - 1));
+	}
+
+	std::size_t ENetLz4Compressor::Decompress(const ENetPeer* /*peer*/, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		return Lz4::Decompress(input, inputSize, output, maxOutputSize, m_dictionary.GetConstBuffer(), m_dictionary.GetSize());
+	}
+
+	/*!
+	* \brief Sets the dictionary matches may refer to
+	*
+	* Both ends must use the same dictionary, datagrams compressed with a dictionary can't be decompressed without it.
+	*
+	* \param dictionary Pointer to the dictionary data
+	* \param dictionarySize Size of the dictionary, only the last MaxDictionarySize bytes are used
+	*
+	* \see TrainDictionary
+	*/
+	void ENetLz4Compressor::SetDictionary(const void* dictionary, std::size_t dictionarySize)
+	{
+		NazaraAssert(dictionary || dictionarySize == 0, "Invalid dictionary");
+
+		// Matches can't reach further, only keep the end of the dictionary
+		const UInt8* dictionaryBytes = static_cast<const UInt8*>(dictionary);
+		if (dictionarySize > MaxDictionarySize)
+		{
+			dictionaryBytes += dictionarySize - MaxDictionarySize;
+			dictionarySize = MaxDictionarySize;
+		}
+
+		m_dictionary = ByteArray(dictionaryBytes, dictionarySize);
+		m_buffer.assign(dictionaryBytes, dictionaryBytes + dictionarySize);
+
+		Lz4::IndexPrefix(dictionaryBytes, dictionarySize, m_dictionaryHashTable);
+	}
+
+	/*!
+	* \brief Builds a dictionary from typical datagrams
+	* \return Dictionary to give to SetDictionary on both ends
+	*
+	* The dictionary is made of the byte sequences shared by most samples, the more often a sequence appears the sooner it is picked.
+	*
+	* \param samples Typical datagrams content, the more the better
+	* \param maxDictionarySize Maximum size of the dictionary
+	*/
+	ByteArray ENetLz4Compressor::TrainDictionary(const std::vector<ByteArray>& samples, std::size_t maxDictionarySize)
+	{
+		maxDictionarySize = std::min(maxDictionarySize, MaxDictionarySize);
+
+		// Count how many samples each group of eight bytes appears in
+		struct GramInfo
+		{
+			std::size_t lastSample;
+			UInt32 sampleCount;
+		};
+
+		std::unordered_map<UInt64, GramInfo> grams;
+		for (std::size_t sampleIndex = 0; sampleIndex < samples.size(); ++sampleIndex)
+		{
+			const ByteArray& sample = samples[sampleIndex];
+			for (std::size_t i = 0; i + TrainingGramSize <= sample.GetSize(); ++i)
+			{
+				auto it = grams.emplace(Read64(&sample[i]), GramInfo{ sampleIndex, 0 }).first;
+				if (it->second.sampleCount == 0 || it->second.lastSample != sampleIndex)
+				{
+					it->second.lastSample = sampleIndex;
+					it->second.sampleCount++;
+				}
+			}
+		}
+
+		auto GetSampleCount = [&](UInt64 gram) -> UInt32
+		{
+			auto it = grams.find(gram);
+			return (it != grams.end()) ? it->second.sampleCount : 0;
+		};
+
+		// Segments are runs of shared groups, scored by how often their groups appear
+		struct Segment
+		{
+			const UInt8* data;
+			std::size_t size;
+			UInt64 score;
+		};
+
+		std::vector<Segment> segments;
+		for (const ByteArray& sample : samples)
+		{
+			std::size_t i = 0;
+			while (i + TrainingGramSize <= sample.GetSize())
+			{
+				if (GetSampleCount(Read64(&sample[i])) < 2)
+				{
+					i++;
+					continue;
+				}
+
+				std::size_t start = i;
+				UInt64 score = 0;
+				while (i + TrainingGramSize <= sample.GetSize() && i - start + TrainingGramSize < TrainingMaxSegmentSize)
+				{
+					UInt32 sampleCount = GetSampleCount(Read64(&sample[i]));
+					if (sampleCount < 2)
+						break;
+
+					score += sampleCount;
+					i++;
+				}
+
+				segments.push_back({ &sample[start], i - start + TrainingGramSize - 1, score });
+			}
+		}
+
+		std::stable_sort(segments.begin(), segments.end(), [](const Segment& lhs, const Segment& rhs) { return lhs.score > rhs.score; });
+
+		// Pick the best segments, skipping those already covered by the dictionary
+		ByteArray dictionary;
+		std::unordered_set<UInt64> dictionaryGrams;
+		for (const Segment& segment : segments)
+		{
+			if (dictionary.GetSize() + segment.size > maxDictionarySize)
+				continue;
+
+			// Matches only need one copy of a sequence, skip segments mostly brought by others
+			std::size_t gramCount = segment.size - TrainingGramSize + 1;
+			std::size_t coveredCount = 0;
+			for (std::size_t i = 0; i < gramCount; ++i)
+				coveredCount += dictionaryGrams.count(Read64(&segment.data[i]));
+
+			if (coveredCount * 2 >= gramCount)
+				continue;
+
+			for (std::size_t i = 0; i + TrainingGramSize <= segment.size; ++i)
+				dictionaryGrams.insert(Read64(&segment.data[i]));
+
+			dictionary.Append(segment.data, segment.size);
+		}
+
+		return dictionary;
+	}
+}
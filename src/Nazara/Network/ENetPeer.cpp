@@ -13,6 +13,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Network/ENetPeer.hpp>
+#include <Nazara/Core/Metrics.hpp>
 #include <Nazara/Network/Algorithm.hpp>
 #include <Nazara/Network/ENetHost.hpp>
 #include <Nazara/Network/NetPacket.hpp>
@@ -20,6 +21,22 @@
 
 namespace Nz
 {
+	ENetPeer::ENetPeer(ENetHost* host, UInt16 peerId) :
+	m_host(host),
+	m_dispatchedCommands(PoolAllocator<IncomingCommmand>(*host->m_commandPool)),
+	m_outgoingReliableCommands(PoolAllocator<OutgoingCommand>(*host->m_commandPool)),
+	m_outgoingUnreliableCommands(PoolAllocator<OutgoingCommand>(*host->m_commandPool)),
+	m_sentReliableCommands(PoolAllocator<OutgoingCommand>(*host->m_commandPool)),
+	m_sentUnreliableCommands(PoolAllocator<OutgoingCommand>(*host->m_commandPool)),
+	m_state(ENetPeerState::Disconnected),
+	m_incomingSessionID(0xFF),
+	m_outgoingSessionID(0xFF),
+	m_incomingPeerID(peerId),
+	m_isSimulationEnabled(false)
+	{
+		Reset();
+	}
+
 	void ENetPeer::Disconnect(UInt32 data)
 	{
 		if (m_state == ENetPeerState::Disconnecting ||
@@ -166,6 +183,7 @@ namespace Nz
 		m_totalPacketLost = 0;
 		m_totalPacketSent = 0;
 		m_totalWaitingData = 0;
+		m_compressionStats = CompressionStats();
 
 		m_unsequencedWindow.fill(0);
 
@@ -313,6 +331,8 @@ namespace Nz
 			++m_packetsLost;
 			++m_totalPacketLost;
 
+			Metrics::Add(ENetHost::s_retransmittedCommandsMetric);
+
 			// http://lists.cubik.org/pipermail/enet-discuss/2014-May/002308.html
 			command.roundTripTimeout = m_roundTripTime + 4 * m_roundTripTimeVariance;
 			command.roundTripTimeoutLimit = m_timeoutLimit * command.roundTripTimeout;
@@ -371,9 +391,9 @@ namespace Nz
 
 	void ENetPeer::DispatchIncomingUnreliableCommands(Channel& channel)
 	{
-		std::list<IncomingCommmand>::iterator currentCommand;
-		std::list<IncomingCommmand>::iterator droppedCommand;
-		std::list<IncomingCommmand>::iterator startCommand;
+		IncomingCommandList::iterator currentCommand;
+		IncomingCommandList::iterator droppedCommand;
+		IncomingCommandList::iterator startCommand;
 
 		for (droppedCommand = startCommand = currentCommand = channel.incomingUnreliableCommands.begin();
 		     currentCommand != channel.incomingUnreliableCommands.end();
@@ -876,7 +896,7 @@ namespace Nz
 		RemoveSentReliableCommand(1, 0xFF);
 
 		if (channelCount < m_channels.size())
-			m_channels.resize(channelCount);
+			m_channels.erase(m_channels.begin() + channelCount, m_channels.end());
 
 		m_outgoingPeerID = NetToHost(command->verifyConnect.outgoingPeerID);
 		m_incomingSessionID = command->verifyConnect.incomingSessionID;
@@ -897,7 +917,7 @@ namespace Nz
 
 	void ENetPeer::InitIncoming(std::size_t channelCount, const IpAddress& address, ENetProtocolConnect& incomingCommand)
 	{
-		m_channels.resize(channelCount);
+		m_channels.resize(channelCount, Channel(*m_host->m_commandPool));
 		m_address = address;
 
 		m_connectID = incomingCommand.connectID;
@@ -938,7 +958,7 @@ namespace Nz
 
 	void ENetPeer::InitOutgoing(std::size_t channelCount, const IpAddress& address, UInt32 connectId, UInt32 windowSize)
 	{
-		m_channels.resize(channelCount);
+		m_channels.resize(channelCount, Channel(*m_host->m_commandPool));
 
 		m_address = address;
 		m_connectID = connectId;
@@ -954,6 +974,8 @@ namespace Nz
 				++m_host->m_bandwidthLimitedPeers;
 
 			++m_host->m_connectedPeers;
+
+			Metrics::Add(ENetHost::s_connectedPeersMetric);
 		}
 	}
 
@@ -965,12 +987,14 @@ namespace Nz
 				--m_host->m_bandwidthLimitedPeers;
 
 			--m_host->m_connectedPeers;
+
+			Metrics::Add(ENetHost::s_connectedPeersMetric, -1);
 		}
 	}
 
 	ENetProtocolCommand ENetPeer::RemoveSentReliableCommand(UInt16 reliableSequenceNumber, UInt8 channelId)
 	{
-		std::list<OutgoingCommand>* commandList = nullptr;
+		OutgoingCommandList* commandList = nullptr;
 
 		bool found = false;
 		auto currentCommand = m_sentReliableCommands.begin();
@@ -1120,8 +1144,8 @@ namespace Nz
 				return discardCommand();
 		}
 
-		std::list<IncomingCommmand>* commandList = nullptr;
-		std::list<IncomingCommmand>::reverse_iterator currentCommand;
+		IncomingCommandList* commandList = nullptr;
+		IncomingCommandList::reverse_iterator currentCommand;
 
 		switch (command.header.command & ENetProtocolCommand_Mask)
 		{
@@ -0,0 +1,268 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/ENetShardedHost.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Network/ENetPeer.hpp>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		// Maximum time a shard waits for incoming datagrams before handling the commands of the game thread
+		constexpr UInt32 s_shardServiceTimeout = 1;
+
+		// Maximum number of events a shard handles before looking at its commands again
+		constexpr unsigned int s_shardMaxEventsPerUpdate = 256;
+	}
+
+	/*!
+	* \ingroup network
+	* \class Nz::ENetShardedHost
+	* \brief Network class that represents a server splitting its peers between multiple ENetHost, each one running on its own thread
+	*
+	* Every shard owns a socket bound to the same port (using SO_REUSEPORT), the system balances the incoming datagrams between them
+	* according to the address of the sender, so a client always talks to the same shard.
+	* Peers are identified by their shard index and their peer id in this shard.
+	*
+	* Shards threads convert their events and push them into a single queue, which is read with PollEvent.
+	* Sending a packet or disconnecting a peer from another thread queues a command which is executed by the thread of the shard.
+	*
+	* \remark Using more than one shard requires a system balancing datagrams between sockets sharing a port (Linux)
+	* \remark Network simulation is not supported as it relies on a random generator shared by every host
+	*/
+
+	/*!
+	* \brief Creates the shards and starts their threads
+	* \return true If every shard could be created
+	*
+	* \param listenAddress Address to listen to, shared by every shard
+	* \param shardCount Number of shards (and threads) to create
+	* \param peerCountPerShard Maximum number of peers of a single shard
+	* \param channelCount Number of channels per peer
+	*/
+	bool ENetShardedHost::Create(const IpAddress& listenAddress, std::size_t shardCount, std::size_t peerCountPerShard, std::size_t channelCount)
+	{
+		NazaraAssert(listenAddress.IsValid(), "Invalid listening address");
+		NazaraAssert(shardCount > 0, "Invalid shard count");
+
+		Destroy();
+
+		#ifndef NAZARA_PLATFORM_LINUX
+		if (shardCount > 1)
+		{
+			NazaraError("Multiple shards require the system to balance datagrams between sockets sharing a port, which is only supported on Linux");
+			return false;
+		}
+		#endif
+
+		m_shards.reserve(shardCount);
+		for (std::size_t i = 0; i < shardCount; ++i)
+		{
+			std::unique_ptr<Shard> shard = std::make_unique<Shard>();
+			shard->host.m_isUsingPortReuse = (shardCount > 1);
+
+			if (!shard->host.Create(listenAddress, peerCountPerShard, channelCount))
+			{
+				NazaraError("Failed to create shard #" + String::Number(i));
+				Destroy();
+
+				return false;
+			}
+
+			m_shards.emplace_back(std::move(shard));
+		}
+
+		m_isRunning = true;
+		for (std::size_t i = 0; i < shardCount; ++i)
+		{
+			m_shards[i]->thread = Thread([this, i]() { RunShard(i); });
+			m_shards[i]->thread.SetName("ENet shard #" + String::Number(i));
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Stops the shards threads and destroys their host
+	*
+	* \remark Events which were not polled are lost
+	*/
+	void ENetShardedHost::Destroy()
+	{
+		m_isRunning = false;
+
+		for (std::unique_ptr<Shard>& shard : m_shards)
+		{
+			if (shard->thread.IsJoinable())
+				shard->thread.Join();
+		}
+
+		m_shards.clear();
+
+		m_events.clear();
+		m_polledEvents.clear();
+		m_polledEventIndex = 0;
+	}
+
+	/*!
+	* \brief Requests a disconnection of a peer
+	*
+	* \param shardIndex Shard of the peer
+	* \param peerId Id of the peer in its shard
+	* \param data Data sent along the disconnection
+	*
+	* \remark This function is thread-safe, the disconnection happens asynchronously
+	*/
+	void ENetShardedHost::Disconnect(std::size_t shardIndex, UInt16 peerId, UInt32 data)
+	{
+		Command command;
+		command.type = CommandType::Disconnect;
+		command.data = data;
+		command.peerId = peerId;
+
+		PushCommand(shardIndex, std::move(command));
+	}
+
+	/*!
+	* \brief Gets the next event pushed by any shard
+	* \return true If an event was retrieved
+	*
+	* \param event Event to fill
+	*
+	* \remark This should only be called by one thread at once
+	*/
+	bool ENetShardedHost::PollEvent(Event* event)
+	{
+		NazaraAssert(event, "Invalid event");
+
+		if (m_polledEventIndex == m_polledEvents.size())
+		{
+			m_polledEvents.clear();
+			m_polledEventIndex = 0;
+
+			// Take every event at once, shards only have to wait for the lock once per poll batch
+			LockGuard lock(m_eventMutex);
+			std::swap(m_events, m_polledEvents);
+		}
+
+		if (m_polledEventIndex == m_polledEvents.size())
+			return false;
+
+		*event = std::move(m_polledEvents[m_polledEventIndex++]);
+		return true;
+	}
+
+	/*!
+	* \brief Sends a packet to a peer
+	*
+	* \param shardIndex Shard of the peer
+	* \param peerId Id of the peer in its shard
+	* \param channelId Channel to send the packet on
+	* \param flags Flags of the packet
+	* \param packet Packet to send
+	*
+	* \remark This function is thread-safe, the packet is sent asynchronously and silently dropped if the peer is not connected anymore
+	*/
+	void ENetShardedHost::Send(std::size_t shardIndex, UInt16 peerId, UInt8 channelId, ENetPacketFlags flags, NetPacket&& packet)
+	{
+		Command command;
+		command.type = CommandType::Send;
+		command.channelId = channelId;
+		command.flags = flags;
+		command.packet = std::move(packet);
+		command.peerId = peerId;
+
+		PushCommand(shardIndex, std::move(command));
+	}
+
+	void ENetShardedHost::PushCommand(std::size_t shardIndex, Command&& command)
+	{
+		NazaraAssert(shardIndex < m_shards.size(), "Invalid shard index");
+
+		Shard& shard = *m_shards[shardIndex];
+
+		LockGuard lock(shard.commandMutex);
+		shard.commands.emplace_back(std::move(command));
+	}
+
+	void ENetShardedHost::RunShard(std::size_t shardIndex)
+	{
+		Shard& shard = *m_shards[shardIndex];
+		ENetHost& host = shard.host;
+
+		std::vector<Command> commands;
+		std::vector<Event> events;
+
+		while (m_isRunning)
+		{
+			{
+				LockGuard lock(shard.commandMutex);
+				std::swap(shard.commands, commands);
+			}
+
+			for (Command& command : commands)
+			{
+				if (command.peerId >= host.m_peerCount)
+					continue;
+
+				ENetPeer& peer = host.m_peers[command.peerId];
+				if (!peer.IsConnected())
+					continue;
+
+				switch (command.type)
+				{
+					case CommandType::Disconnect:
+						peer.Disconnect(command.data);
+						break;
+
+					case CommandType::Send:
+						peer.Send(command.channelId, command.flags, std::move(command.packet));
+						break;
+				}
+			}
+			commands.clear();
+
+			ENetEvent event;
+			int result = host.Service(&event, s_shardServiceTimeout);
+			for (unsigned int i = 0; result > 0 && i < s_shardMaxEventsPerUpdate; ++i)
+			{
+				events.emplace_back();
+				Event& shardEvent = events.back();
+				shardEvent.type = event.type;
+				shardEvent.channelId = event.channelId;
+				shardEvent.data = event.data;
+				shardEvent.peerAddress = event.peer->GetAddress();
+				shardEvent.peerId = event.peer->GetPeerId();
+				shardEvent.shardIndex = shardIndex;
+
+				// Packets belong to the memory pool of the host, which is not thread-safe: only their content is given to the game thread
+				if (event.packet)
+				{
+					NetPacket& packet = event.packet->data;
+					if (event.packet->referenceCount == 1)
+						shardEvent.packet = std::move(packet);
+					else
+						shardEvent.packet.Reset(packet.GetNetCode(), packet.GetConstData() + NetPacket::HeaderSize, packet.GetDataSize());
+
+					event.packet.Reset();
+				}
+
+				result = host.Service(&event, 0);
+			}
+
+			if (!events.empty())
+			{
+				LockGuard lock(m_eventMutex);
+				for (Event& shardEvent : events)
+					m_events.emplace_back(std::move(shardEvent));
+			}
+			events.clear();
+		}
+
+		host.Destroy();
+	}
+}
@@ -0,0 +1,266 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/HostnameResolver.hpp>
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/ConditionVariable.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/Thread.hpp>
+#include <queue>
+#include <unordered_map>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		struct CacheEntry
+		{
+			std::shared_future<HostnameResolution> resolution;
+			UInt64 expirationTime;
+			bool pending;
+		};
+
+		struct Request
+		{
+			NetProtocol protocol;
+			String hostname;
+			String key;
+			String service;
+			std::promise<HostnameResolution> promise;
+		};
+
+		struct ResolverState
+		{
+			ConditionVariable condition;
+			Mutex mutex;
+			std::queue<Request> requests;
+			std::unordered_map<String, CacheEntry> cache;
+			std::vector<Thread> threads;
+			UInt32 cacheDuration = 60 * 1000;
+			bool running = false;
+		};
+
+		ResolverState& GetState()
+		{
+			static ResolverState state;
+			return state;
+		}
+
+		String BuildKey(NetProtocol protocol, const String& hostname, const String& service)
+		{
+			return String::Number(static_cast<int>(protocol)) + ':' + service + '@' + hostname;
+		}
+	}
+
+	/*!
+	* \ingroup network
+	* \class Nz::HostnameResolver
+	* \brief Network class that resolves hostnames from background threads, caching the results
+	*
+	* Resolutions of the same hostname and service are shared while in flight, and successful ones are cached for the cache duration.
+	* Failed resolutions are never cached, so temporary failures can be retried right away.
+	*
+	* \remark The system resolver doesn't expose the time to live of the records, the cache duration is used for every entry instead
+	* \remark Resolver threads are started on the first resolution and stopped with the network module
+	*/
+
+	/*!
+	* \brief Clears the cached resolutions
+	*
+	* \remark Resolutions still in flight are kept, and their result is cached when they complete
+	*/
+
+	void HostnameResolver::ClearCache()
+	{
+		ResolverState& state = GetState();
+
+		LockGuard lock(state.mutex);
+		for (auto it = state.cache.begin(); it != state.cache.end();)
+		{
+			if (!it->second.pending)
+				it = state.cache.erase(it);
+			else
+				++it;
+		}
+	}
+
+	/*!
+	* \brief Gets the duration successful resolutions are cached for
+	* \return Duration in milliseconds
+	*/
+
+	UInt32 HostnameResolver::GetCacheDuration()
+	{
+		ResolverState& state = GetState();
+
+		LockGuard lock(state.mutex);
+		return state.cacheDuration;
+	}
+
+	/*!
+	* \brief Resolves a hostname asynchronously
+	* \return Future of the resolution, ready right away if it was cached
+	*
+	* \param protocol Net protocol to use
+	* \param hostname Hostname to resolve
+	* \param service Specify the service used (http, ...)
+	*
+	* \remark Produces a NazaraAssert if net protocol is set to unknown
+	*
+	* \see IpAddress::ResolveHostname
+	*/
+
+	std::shared_future<HostnameResolution> HostnameResolver::Resolve(NetProtocol protocol, const String& hostname, const String& service)
+	{
+		NazaraAssert(protocol != NetProtocol_Unknown, "Invalid protocol");
+
+		ResolverState& state = GetState();
+		String key = BuildKey(protocol, hostname, service);
+
+		LockGuard lock(state.mutex);
+
+		auto it = state.cache.find(key);
+		if (it != state.cache.end())
+		{
+			if (it->second.pending || GetElapsedMilliseconds() < it->second.expirationTime)
+				return it->second.resolution;
+
+			state.cache.erase(it);
+		}
+
+		if (!state.running)
+		{
+			state.running = true;
+
+			for (unsigned int i = 0; i < ThreadCount; ++i)
+			{
+				state.threads.emplace_back(&HostnameResolver::WorkerThread);
+				state.threads.back().SetName("HostnameResolverThread");
+			}
+		}
+
+		Request request;
+		request.hostname = hostname;
+		request.key = key;
+		request.protocol = protocol;
+		request.service = service;
+
+		CacheEntry& entry = state.cache[key];
+		entry.expirationTime = 0;
+		entry.pending = true;
+		entry.resolution = request.promise.get_future().share();
+
+		state.requests.push(std::move(request));
+		state.condition.Signal();
+
+		return entry.resolution;
+	}
+
+	/*!
+	* \brief Sets the duration successful resolutions are cached for
+	*
+	* \param duration Duration in milliseconds, zero disables caching
+	*
+	* \remark Already cached resolutions keep their expiration time
+	*/
+
+	void HostnameResolver::SetCacheDuration(UInt32 duration)
+	{
+		ResolverState& state = GetState();
+
+		LockGuard lock(state.mutex);
+		state.cacheDuration = duration;
+	}
+
+	/*!
+	* \brief Initializes the HostnameResolver class
+	* \return true
+	*/
+
+	bool HostnameResolver::Initialize()
+	{
+		return true;
+	}
+
+	/*!
+	* \brief Uninitializes the HostnameResolver class, stopping the resolver threads
+	*
+	* \remark Waits for the resolutions being processed, queued ones fail with ResolveError_NotInitialized
+	*/
+
+	void HostnameResolver::Uninitialize()
+	{
+		ResolverState& state = GetState();
+
+		std::vector<Thread> threads;
+		{
+			LockGuard lock(state.mutex);
+			state.running = false;
+			state.condition.SignalAll();
+
+			threads = std::move(state.threads);
+			state.threads.clear();
+		}
+
+		for (Thread& thread : threads)
+			thread.Join();
+
+		LockGuard lock(state.mutex);
+		while (!state.requests.empty())
+		{
+			HostnameResolution resolution;
+			resolution.error = ResolveError_NotInitialized;
+
+			state.requests.front().promise.set_value(std::move(resolution));
+			state.requests.pop();
+		}
+
+		state.cache.clear();
+	}
+
+	void HostnameResolver::WorkerThread()
+	{
+		ResolverState& state = GetState();
+
+		for (;;)
+		{
+			Request request;
+			{
+				LockGuard lock(state.mutex);
+				while (state.running && state.requests.empty())
+					state.condition.Wait(&state.mutex);
+
+				if (!state.running)
+					return;
+
+				request = std::move(state.requests.front());
+				state.requests.pop();
+			}
+
+			HostnameResolution resolution;
+			resolution.results = IpAddress::ResolveHostname(request.protocol, request.hostname, request.service, &resolution.error);
+
+			{
+				LockGuard lock(state.mutex);
+
+				auto it = state.cache.find(request.key);
+				if (it != state.cache.end())
+				{
+					if (resolution.error == ResolveError_NoError && state.cacheDuration > 0)
+					{
+						it->second.expirationTime = GetElapsedMilliseconds() + state.cacheDuration;
+						it->second.pending = false;
+					}
+					else
+						state.cache.erase(it);
+				}
+			}
+
+			request.promise.set_value(std::move(resolution));
+		}
+	}
+}
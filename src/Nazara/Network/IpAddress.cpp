@@ -6,6 +6,7 @@
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/StringStream.hpp>
 #include <Nazara/Network/Algorithm.hpp>
+#include <Nazara/Network/HostnameResolver.hpp>
 #include <algorithm>
 #include <limits>
 
@@ -219,6 +220,24 @@ namespace Nz
 		return IpAddressImpl::ResolveHostname(protocol, hostname, service, error);
 	}
 
+	/*!
+	* \brief Resolves the address based on the hostname without blocking
+	* \return Future of the resolution, ready right away if it was cached
+	*
+	* \param protocol Net protocol to use
+	* \param hostname Hostname to resolve
+	* \param service Specify the service used (http, ...)
+	*
+	* \remark Produces a NazaraAssert if net protocol is set to unknown
+	*
+	* \see HostnameResolver
+	*/
+
+	std::shared_future<HostnameResolution> IpAddress::ResolveHostnameAsync(NetProtocol protocol, const String& hostname, const String& service)
+	{
+		return HostnameResolver::Resolve(protocol, hostname, service);
+	}
+
 	IpAddress IpAddress::AnyIpV4(0, 0, 0, 0);
 	IpAddress IpAddress::AnyIpV6(0, 0, 0, 0, 0, 0, 0, 0, 0);
 	IpAddress IpAddress::BroadcastIpV4(255, 255, 255, 255);
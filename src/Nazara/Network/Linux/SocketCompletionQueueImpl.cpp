@@ -0,0 +1,533 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/Linux/SocketCompletionQueueImpl.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Network/Posix/SocketImpl.hpp>
+#include <algorithm>
+#include <csignal>
+#include <cstring>
+#include <ctime>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		// Submissions which are not bound to an operation (cancellations, timeouts), their completion is ignored
+		constexpr UInt64 s_internalUserData = 0;
+
+		int IoUringEnter(int handle, unsigned int toSubmit, unsigned int minComplete, unsigned int flags, const void* arg, std::size_t argSize)
+		{
+			return static_cast<int>(syscall(__NR_io_uring_enter, handle, toSubmit, minComplete, flags, arg, argSize));
+		}
+
+		int IoUringSetup(unsigned int entries, io_uring_params* params)
+		{
+			return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+		}
+
+		SocketError TranslateResult(int result)
+		{
+			if (result == -ECANCELED)
+				return SocketError_Interrupted;
+
+			return SocketImpl::TranslateErrnoToResolveError(-result);
+		}
+	}
+
+	SocketCompletionQueueImpl::SocketCompletionQueueImpl(std::size_t queueSize) :
+	m_operationPool(sizeof(Operation)),
+	m_submissions(static_cast<io_uring_sqe*>(MAP_FAILED)),
+	m_submissionTail(0),
+	m_completionRing(MAP_FAILED),
+	m_submissionRing(MAP_FAILED),
+	m_handle(-1)
+	{
+		unsigned int entryCount = static_cast<unsigned int>(std::max<std::size_t>(queueSize, 1));
+
+		// Completions are only reaped in Wait, there's no need to interrupt the thread (and its other blocking calls) to run them
+		io_uring_params params;
+		std::memset(&params, 0, sizeof(params));
+		#ifdef IORING_SETUP_COOP_TASKRUN
+		params.flags = IORING_SETUP_COOP_TASKRUN;
+		#endif
+
+		int handle = IoUringSetup(entryCount, &params);
+		if (handle < 0 && errno == EINVAL && params.flags != 0)
+		{
+			// Kernels older than 5.19 don't know about this flag
+			std::memset(&params, 0, sizeof(params));
+			handle = IoUringSetup(entryCount, &params);
+		}
+
+		if (handle < 0)
+		{
+			NazaraError("Failed to create io_uring instance: " + Error::GetLastSystemError());
+			return;
+		}
+
+		m_features = params.features;
+		m_submissionEntries = params.sq_entries;
+
+		m_submissionRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+		m_completionRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+		// Recent kernels map both rings at once
+		if (m_features & IORING_FEAT_SINGLE_MMAP)
+			m_submissionRingSize = m_completionRingSize = std::max(m_submissionRingSize, m_completionRingSize);
+
+		m_submissionRing = mmap(nullptr, m_submissionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, handle, IORING_OFF_SQ_RING);
+		if (m_submissionRing == MAP_FAILED)
+		{
+			NazaraError("Failed to map io_uring submission ring: " + Error::GetLastSystemError());
+			close(handle);
+			return;
+		}
+
+		if (m_features & IORING_FEAT_SINGLE_MMAP)
+			m_completionRing = m_submissionRing;
+		else
+		{
+			m_completionRing = mmap(nullptr, m_completionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, handle, IORING_OFF_CQ_RING);
+			if (m_completionRing == MAP_FAILED)
+			{
+				NazaraError("Failed to map io_uring completion ring: " + Error::GetLastSystemError());
+				munmap(m_submissionRing, m_submissionRingSize);
+				close(handle);
+				return;
+			}
+		}
+
+		m_submissions = static_cast<io_uring_sqe*>(mmap(nullptr, params.sq_entries * sizeof(io_uring_sqe), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, handle, IORING_OFF_SQES));
+		if (m_submissions == MAP_FAILED)
+		{
+			NazaraError("Failed to map io_uring submissions: " + Error::GetLastSystemError());
+			if (m_completionRing != m_submissionRing)
+				munmap(m_completionRing, m_completionRingSize);
+
+			munmap(m_submissionRing, m_submissionRingSize);
+			close(handle);
+			return;
+		}
+
+		UInt8* submissionRing = static_cast<UInt8*>(m_submissionRing);
+		m_submissionArray = reinterpret_cast<unsigned int*>(submissionRing + params.sq_off.array);
+		m_submissionHead = reinterpret_cast<unsigned int*>(submissionRing + params.sq_off.head);
+		m_submissionMask = reinterpret_cast<unsigned int*>(submissionRing + params.sq_off.ring_mask);
+		m_submissionTailPtr = reinterpret_cast<unsigned int*>(submissionRing + params.sq_off.tail);
+
+		UInt8* completionRing = static_cast<UInt8*>(m_completionRing);
+		m_completions = reinterpret_cast<io_uring_cqe*>(completionRing + params.cq_off.cqes);
+		m_completionHead = reinterpret_cast<unsigned int*>(completionRing + params.cq_off.head);
+		m_completionMask = reinterpret_cast<unsigned int*>(completionRing + params.cq_off.ring_mask);
+		m_completionTail = reinterpret_cast<unsigned int*>(completionRing + params.cq_off.tail);
+
+		m_submissionTail = *m_submissionTailPtr;
+		m_handle = handle;
+	}
+
+	SocketCompletionQueueImpl::~SocketCompletionQueueImpl()
+	{
+		if (m_handle < 0)
+			return;
+
+		// The kernel may still write into operations (and user buffers) until they are cancelled, wait for them
+		for (auto& pair : m_operations)
+			CancelOperation(pair.second);
+
+		for (unsigned int attempt = 0; !m_operations.empty() && attempt < 10; ++attempt)
+		{
+			if (!Enter(1, 100, nullptr))
+				break;
+
+			unsigned int head = *m_completionHead;
+			unsigned int tail = __atomic_load_n(m_completionTail, __ATOMIC_ACQUIRE);
+			for (; head != tail; ++head)
+			{
+				const io_uring_cqe& completion = m_completions[head & *m_completionMask];
+				UInt64 userData = completion.user_data;
+				int result = completion.res;
+
+				__atomic_store_n(m_completionHead, head + 1, __ATOMIC_RELEASE);
+
+				if (userData != s_internalUserData)
+				{
+					// Do not resubmit anything, every completion finishes its operation
+					Operation* operation = reinterpret_cast<Operation*>(userData);
+					operation->isPolling = false;
+					operation->size = operation->transferred;
+
+					ProcessCompletion(userData, (result == -EAGAIN) ? -ECANCELED : result, false);
+				}
+			}
+		}
+
+		for (auto& pair : m_operations)
+			m_operationPool.Delete(pair.second);
+
+		m_operations.clear();
+
+		munmap(m_submissions, m_submissionEntries * sizeof(io_uring_sqe));
+		if (m_completionRing != m_submissionRing)
+			munmap(m_completionRing, m_completionRingSize);
+
+		munmap(m_submissionRing, m_submissionRingSize);
+		close(m_handle);
+	}
+
+	bool SocketCompletionQueueImpl::Accept(SocketHandle listenHandle, NetProtocol /*protocol*/, AcceptCallback callback, SocketError* error)
+	{
+		Operation* operation = AllocateOperation(OperationType::Accept, listenHandle);
+		operation->acceptCallback = std::move(callback);
+
+		if (!QueueOperation(operation, error))
+		{
+			FreeOperation(operation);
+			return false;
+		}
+
+		return true;
+	}
+
+	void SocketCompletionQueueImpl::CancelOperations(SocketHandle handle)
+	{
+		auto range = m_operations.equal_range(handle);
+		for (auto it = range.first; it != range.second; ++it)
+			CancelOperation(it->second);
+	}
+
+	bool SocketCompletionQueueImpl::Receive(SocketHandle handle, void* buffer, std::size_t size, Callback callback, SocketError* error)
+	{
+		Operation* operation = AllocateOperation(OperationType::Receive, handle);
+		operation->buffer = static_cast<UInt8*>(buffer);
+		operation->callback = std::move(callback);
+		operation->size = size;
+
+		if (!QueueOperation(operation, error))
+		{
+			FreeOperation(operation);
+			return false;
+		}
+
+		return true;
+	}
+
+	bool SocketCompletionQueueImpl::Send(SocketHandle handle, const void* buffer, std::size_t size, Callback callback, SocketError* error)
+	{
+		Operation* operation = AllocateOperation(OperationType::Send, handle);
+		operation->buffer = static_cast<UInt8*>(const_cast<void*>(buffer)); //< Only read by the kernel
+		operation->callback = std::move(callback);
+		operation->size = size;
+
+		if (!QueueOperation(operation, error))
+		{
+			FreeOperation(operation);
+			return false;
+		}
+
+		return true;
+	}
+
+	int SocketCompletionQueueImpl::Wait(int msTimeout, SocketError* error)
+	{
+		if (!Enter((msTimeout != 0) ? 1 : 0, msTimeout, error))
+			return -1;
+
+		int completedOperations = 0;
+
+		unsigned int head = *m_completionHead;
+		unsigned int tail = __atomic_load_n(m_completionTail, __ATOMIC_ACQUIRE);
+		for (; head != tail; ++head)
+		{
+			const io_uring_cqe& completion = m_completions[head & *m_completionMask];
+			UInt64 userData = completion.user_data;
+			int result = completion.res;
+
+			// Give the entry back before calling the callback, which may start new operations
+			__atomic_store_n(m_completionHead, head + 1, __ATOMIC_RELEASE);
+
+			if (userData != s_internalUserData && ProcessCompletion(userData, result, true))
+				completedOperations++;
+		}
+
+		if (error)
+			*error = SocketError_NoError;
+
+		return completedOperations;
+	}
+
+	io_uring_sqe* SocketCompletionQueueImpl::AcquireSubmission(SocketError* error)
+	{
+		unsigned int head = __atomic_load_n(m_submissionHead, __ATOMIC_ACQUIRE);
+		if (m_submissionTail - head >= m_submissionEntries)
+		{
+			// Submission queue is full, hand it to the kernel right now
+			if (!Enter(0, 0, error))
+				return nullptr;
+
+			head = __atomic_load_n(m_submissionHead, __ATOMIC_ACQUIRE);
+			if (m_submissionTail - head >= m_submissionEntries)
+			{
+				if (error)
+					*error = SocketError_ResourceError;
+
+				return nullptr;
+			}
+		}
+
+		unsigned int index = m_submissionTail & *m_submissionMask;
+		m_submissionArray[index] = index;
+		m_submissionTail++;
+
+		io_uring_sqe* submission = &m_submissions[index];
+		std::memset(submission, 0, sizeof(io_uring_sqe));
+
+		return submission;
+	}
+
+	bool SocketCompletionQueueImpl::CancelOperation(Operation* operation)
+	{
+		io_uring_sqe* submission = AcquireSubmission(nullptr);
+		if (!submission)
+		{
+			NazaraWarning("Failed to cancel socket operation: submission queue is full");
+			return false;
+		}
+
+		submission->opcode = IORING_OP_ASYNC_CANCEL;
+		submission->fd = -1;
+		submission->addr = reinterpret_cast<UInt64>(operation);
+		submission->user_data = s_internalUserData;
+
+		return true;
+	}
+
+	auto SocketCompletionQueueImpl::AllocateOperation(OperationType type, SocketHandle handle) -> Operation*
+	{
+		Operation* operation = m_operationPool.New<Operation>();
+		operation->addressLength = static_cast<socklen_t>(operation->address.size());
+		operation->buffer = nullptr;
+		operation->handle = handle;
+		operation->size = 0;
+		operation->type = type;
+
+		m_operations.emplace(handle, operation);
+
+		return operation;
+	}
+
+	bool SocketCompletionQueueImpl::Enter(unsigned int minComplete, int msTimeout, SocketError* error)
+	{
+		unsigned int toSubmit = m_submissionTail - *m_submissionHead;
+		__atomic_store_n(m_submissionTailPtr, m_submissionTail, __ATOMIC_RELEASE);
+
+		unsigned int flags = (minComplete > 0) ? IORING_ENTER_GETEVENTS : 0;
+
+		int result;
+		if (minComplete > 0 && msTimeout > 0)
+		{
+			__kernel_timespec timeout;
+			timeout.tv_sec = msTimeout / 1000;
+			timeout.tv_nsec = (msTimeout % 1000) * 1000000;
+
+			#ifdef IORING_FEAT_EXT_ARG
+			if (m_features & IORING_FEAT_EXT_ARG)
+			{
+				io_uring_getevents_arg arg;
+				std::memset(&arg, 0, sizeof(arg));
+				arg.sigmask_sz = _NSIG / 8;
+				arg.ts = reinterpret_cast<UInt64>(&timeout);
+
+				result = IoUringEnter(m_handle, toSubmit, minComplete, flags | IORING_ENTER_EXT_ARG, &arg, sizeof(arg));
+			}
+			else
+			#endif
+			{
+				// Older kernels: a timeout submission completes after the delay, waking us up
+				unsigned int head = __atomic_load_n(m_submissionHead, __ATOMIC_ACQUIRE);
+				if (m_submissionTail - head < m_submissionEntries)
+				{
+					io_uring_sqe* submission = AcquireSubmission(nullptr);
+					submission->opcode = IORING_OP_TIMEOUT;
+					submission->fd = -1;
+					submission->addr = reinterpret_cast<UInt64>(&timeout);
+					submission->len = 1;
+					submission->user_data = s_internalUserData;
+
+					toSubmit++;
+					__atomic_store_n(m_submissionTailPtr, m_submissionTail, __ATOMIC_RELEASE);
+				}
+
+				result = IoUringEnter(m_handle, toSubmit, minComplete, flags, nullptr, 0);
+			}
+		}
+		else
+			result = IoUringEnter(m_handle, toSubmit, minComplete, flags, nullptr, 0);
+
+		if (result < 0)
+		{
+			int errorCode = errno;
+			if (errorCode != ETIME && errorCode != EINTR && errorCode != EBUSY)
+			{
+				if (error)
+					*error = SocketImpl::TranslateErrnoToResolveError(errorCode);
+
+				return false;
+			}
+		}
+
+		if (error)
+			*error = SocketError_NoError;
+
+		return true;
+	}
+
+	void SocketCompletionQueueImpl::FreeOperation(Operation* operation)
+	{
+		auto range = m_operations.equal_range(operation->handle);
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			if (it->second == operation)
+			{
+				m_operations.erase(it);
+				break;
+			}
+		}
+
+		m_operationPool.Delete(operation);
+	}
+
+	bool SocketCompletionQueueImpl::ProcessCompletion(UInt64 userData, int result, bool invokeCallback)
+	{
+		Operation* operation = reinterpret_cast<Operation*>(userData);
+
+		bool resubmit = false;
+		if (operation->isPolling)
+		{
+			// The socket became ready, try the operation again
+			operation->isPolling = false;
+			resubmit = (result >= 0);
+		}
+		else if (result == -EAGAIN)
+		{
+			// Non-blocking sockets may report that the operation would block, wait for them to become ready
+			operation->isPolling = true;
+			resubmit = true;
+		}
+		else if (operation->type == OperationType::Send && result > 0 && operation->transferred + result < operation->size)
+		{
+			// Stream sockets may not send everything at once, send the remaining data
+			operation->transferred += result;
+			resubmit = true;
+		}
+
+		if (resubmit)
+		{
+			if (QueueOperation(operation, nullptr))
+				return false;
+
+			result = -ENOBUFS;
+		}
+
+		SocketError error = SocketError_NoError;
+		std::size_t byteTransferred = operation->transferred;
+		SocketHandle acceptedHandle = SocketImpl::InvalidHandle;
+		IpAddress acceptedAddress;
+
+		if (result < 0)
+			error = TranslateResult(result);
+		else
+		{
+			switch (operation->type)
+			{
+				case OperationType::Accept:
+					acceptedAddress = IpAddressImpl::FromSockAddr(reinterpret_cast<const sockaddr*>(operation->address.data()));
+					acceptedHandle = result;
+					break;
+
+				case OperationType::Receive:
+					if (result == 0)
+						error = SocketError_ConnectionClosed;
+					break;
+
+				case OperationType::Send:
+					break;
+			}
+
+			byteTransferred += result;
+		}
+
+		OperationType type = operation->type;
+		AcceptCallback acceptCallback = std::move(operation->acceptCallback);
+		Callback callback = std::move(operation->callback);
+
+		FreeOperation(operation);
+
+		if (!invokeCallback)
+		{
+			if (acceptedHandle != SocketImpl::InvalidHandle)
+				SocketImpl::Close(acceptedHandle);
+
+			return true;
+		}
+
+		if (type == OperationType::Accept)
+		{
+			if (acceptCallback)
+				acceptCallback(error, acceptedHandle, acceptedAddress);
+		}
+		else if (callback)
+			callback(error, byteTransferred);
+
+		return true;
+	}
+
+	bool SocketCompletionQueueImpl::QueueOperation(Operation* operation, SocketError* error)
+	{
+		io_uring_sqe* submission = AcquireSubmission(error);
+		if (!submission)
+			return false;
+
+		submission->fd = operation->handle;
+		submission->user_data = reinterpret_cast<UInt64>(operation);
+
+		if (operation->isPolling)
+		{
+			submission->opcode = IORING_OP_POLL_ADD;
+			submission->poll32_events = (operation->type == OperationType::Send) ? POLLOUT : POLLIN;
+			return true;
+		}
+
+		switch (operation->type)
+		{
+			case OperationType::Accept:
+				operation->addressLength = static_cast<socklen_t>(operation->address.size());
+
+				submission->opcode = IORING_OP_ACCEPT;
+				submission->addr = reinterpret_cast<UInt64>(operation->address.data());
+				submission->addr2 = reinterpret_cast<UInt64>(&operation->addressLength);
+				break;
+
+			case OperationType::Receive:
+				submission->opcode = IORING_OP_RECV;
+				submission->addr = reinterpret_cast<UInt64>(operation->buffer);
+				submission->len = static_cast<UInt32>(operation->size);
+				break;
+
+			case OperationType::Send:
+				submission->opcode = IORING_OP_SEND;
+				submission->addr = reinterpret_cast<UInt64>(operation->buffer + operation->transferred);
+				submission->len = static_cast<UInt32>(operation->size - operation->transferred);
+				submission->msg_flags = MSG_NOSIGNAL;
+				break;
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,95 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_SOCKETCOMPLETIONQUEUEIMPL_HPP
+#define NAZARA_SOCKETCOMPLETIONQUEUEIMPL_HPP
+
+#include <Nazara/Core/MemoryPool.hpp>
+#include <Nazara/Network/SocketCompletionQueue.hpp>
+#include <Nazara/Network/Posix/IpAddressImpl.hpp>
+#include <unordered_map>
+#include <linux/io_uring.h>
+
+namespace Nz
+{
+	class SocketCompletionQueueImpl
+	{
+		public:
+			using AcceptCallback = std::function<void(SocketError error, SocketHandle handle, const IpAddress& address)>;
+			using Callback = SocketCompletionQueue::Callback;
+
+			SocketCompletionQueueImpl(std::size_t queueSize);
+			~SocketCompletionQueueImpl();
+
+			bool Accept(SocketHandle listenHandle, NetProtocol protocol, AcceptCallback callback, SocketError* error);
+
+			void CancelOperations(SocketHandle handle);
+
+			inline std::size_t GetPendingOperationCount() const;
+
+			inline bool IsValid() const;
+
+			bool Receive(SocketHandle handle, void* buffer, std::size_t size, Callback callback, SocketError* error);
+
+			bool Send(SocketHandle handle, const void* buffer, std::size_t size, Callback callback, SocketError* error);
+
+			int Wait(int msTimeout, SocketError* error);
+
+		private:
+			enum class OperationType
+			{
+				Accept,
+				Receive,
+				Send
+			};
+
+			struct Operation
+			{
+				AcceptCallback acceptCallback;
+				Callback callback;
+				IpAddressImpl::SockAddrBuffer address;
+				OperationType type;
+				SocketHandle handle;
+				UInt8* buffer;
+				socklen_t addressLength;
+				std::size_t size;
+				std::size_t transferred = 0;
+				bool isPolling = false; //< Waiting for the socket to become ready, because the operation would have blocked
+			};
+
+			io_uring_sqe* AcquireSubmission(SocketError* error);
+			Operation* AllocateOperation(OperationType type, SocketHandle handle);
+			bool CancelOperation(Operation* operation);
+			bool Enter(unsigned int minComplete, int msTimeout, SocketError* error);
+			void FreeOperation(Operation* operation);
+			bool ProcessCompletion(UInt64 userData, int result, bool invokeCallback);
+			bool QueueOperation(Operation* operation, SocketError* error);
+
+			MemoryPool m_operationPool;
+			std::unordered_multimap<SocketHandle, Operation*> m_operations;
+			io_uring_cqe* m_completions;
+			io_uring_sqe* m_submissions;
+			std::size_t m_completionRingSize;
+			std::size_t m_submissionRingSize;
+			unsigned int m_submissionTail; //< Local tail, published to the kernel on Enter
+			unsigned int* m_completionHead;
+			unsigned int* m_completionMask;
+			unsigned int* m_completionTail;
+			unsigned int* m_submissionArray;
+			unsigned int* m_submissionHead;
+			unsigned int* m_submissionMask;
+			unsigned int* m_submissionTailPtr;
+			void* m_completionRing;
+			void* m_submissionRing;
+			unsigned int m_features;
+			unsigned int m_submissionEntries;
+			int m_handle;
+	};
+}
+
+#include <Nazara/Network/Linux/SocketCompletionQueueImpl.inl>
+
+#endif // NAZARA_SOCKETCOMPLETIONQUEUEIMPL_HPP
@@ -0,0 +1,20 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	inline std::size_t SocketCompletionQueueImpl::GetPendingOperationCount() const
+	{
+		return m_operations.size();
+	}
+
+	inline bool SocketCompletionQueueImpl::IsValid() const
+	{
+		return m_handle >= 0;
+	}
+}
+
+#include <Nazara/Network/DebugOff.hpp>
@@ -5,13 +5,15 @@
 #include <Nazara/Network/Linux/SocketPollerImpl.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Network/Posix/SocketImpl.hpp>
+#include <algorithm>
 #include <cstring>
 #include <unistd.h>
 #include <Nazara/Network/Debug.hpp>
 
 namespace Nz
 {
-	SocketPollerImpl::SocketPollerImpl()
+	SocketPollerImpl::SocketPollerImpl() :
+	m_generation(0)
 	{
 		m_handle = epoll_create1(0);
 	}
@@ -23,19 +25,37 @@ namespace Nz
 
 	void SocketPollerImpl::Clear()
 	{
-		m_readyToReadSockets.clear();
-		m_readyToWriteSockets.clear();
+		// Events point to our entries, sockets must leave the epoll set before those get destroyed
+		for (const auto& pair : m_sockets)
+			epoll_ctl(m_handle, EPOLL_CTL_DEL, pair.first, nullptr);
+
+		m_readyEvents.clear();
 		m_sockets.clear();
 	}
 
+	const std::vector<SocketPoller::Event>& SocketPollerImpl::GetReadyEvents() const
+	{
+		return m_readyEvents;
+	}
+
 	bool SocketPollerImpl::IsReadyToRead(SocketHandle socket) const
 	{
-		return m_readyToReadSockets.count(socket) != 0;
+		auto it = m_sockets.find(socket);
+		if (it == m_sockets.end())
+			return false;
+
+		const Entry& entry = it->second;
+		return entry.readyGeneration == m_generation && (entry.readyEvents & SocketPollEvent_Read);
 	}
 
 	bool SocketPollerImpl::IsReadyToWrite(SocketHandle socket) const
 	{
-		return m_readyToWriteSockets.count(socket) != 0;
+		auto it = m_sockets.find(socket);
+		if (it == m_sockets.end())
+			return false;
+
+		const Entry& entry = it->second;
+		return entry.readyGeneration == m_generation && (entry.readyEvents & SocketPollEvent_Write);
 	}
 
 	bool SocketPollerImpl::IsRegistered(SocketHandle socket) const
@@ -43,14 +63,19 @@ namespace Nz
 		return m_sockets.count(socket) != 0;
 	}
 
-	bool SocketPollerImpl::RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags)
+	bool SocketPollerImpl::RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags, SocketPollMode mode, AbstractSocket* owner, void* userdata)
 	{
 		NazaraAssert(!IsRegistered(socket), "Socket is already registered");
 
+		Entry& socketEntry = m_sockets[socket];
+		socketEntry.owner = owner;
+		socketEntry.readyGeneration = 0;
+		socketEntry.userdata = userdata;
+
 		epoll_event entry;
 		std::memset(&entry, 0, sizeof(epoll_event));
 
-		entry.data.fd = socket;
+		entry.data.ptr = &socketEntry;
 
 		if (eventFlags & SocketPollEvent_Read)
 			entry.events |= EPOLLIN;
@@ -58,14 +83,16 @@ namespace Nz
 		if (eventFlags & SocketPollEvent_Write)
 			entry.events |= EPOLLOUT;
 
+		if (mode == SocketPollMode_EdgeTriggered)
+			entry.events |= EPOLLET;
+
 		if (epoll_ctl(m_handle, EPOLL_CTL_ADD, socket, &entry) != 0)
 		{
 			NazaraError("Failed to add socket to epoll structure (errno " + String::Number(errno) + ": " + Error::GetLastSystemError() + ')');
+			m_sockets.erase(socket);
 			return false;
 		}
 
-		m_sockets.insert(socket);
-
 		return true;
 	}
 
@@ -73,23 +100,36 @@ namespace Nz
 	{
 		NazaraAssert(IsRegistered(socket), "Socket is not registered");
 
-		m_readyToReadSockets.erase(socket);
-		m_readyToWriteSockets.erase(socket);
-		m_sockets.erase(socket);
+		auto it = m_sockets.find(socket);
+		AbstractSocket* owner = it->second.owner;
+		m_sockets.erase(it);
 
 		if (epoll_ctl(m_handle, EPOLL_CTL_DEL, socket, nullptr) != 0)
 			NazaraWarning("An error occured while removing socket from epoll structure (errno " + String::Number(errno) + ": " + Error::GetLastSystemError() + ')');
+
+		// Don't report this socket anymore
+		m_readyEvents.erase(std::remove_if(m_readyEvents.begin(), m_readyEvents.end(), [&](const SocketPoller::Event& event) { return event.socket == owner; }), m_readyEvents.end());
 	}
 
 	int SocketPollerImpl::Wait(int msTimeout, SocketError* error)
 	{
 		int activeSockets;
 
-		// Reset status of sockets
-		m_events.resize(m_sockets.size());
-		std::memset(m_events.data(), 0, m_events.size() * sizeof(epoll_event));
+		// Invalidates ready states of the previous wait without touching every entry
+		m_generation++;
+		m_readyEvents.clear();
+
+		// Only grows when more sockets are registered
+		if (m_events.size() < m_sockets.size())
+			m_events.resize(m_sockets.size());
+
+		// Retry when interrupted by a signal or by kernel task work (as io_uring does when a ring is closed)
+		do
+		{
+			activeSockets = epoll_wait(m_handle, m_events.data(), static_cast<int>(m_events.size()), static_cast<int>(msTimeout));
+		}
+		while (activeSockets == -1 && errno == EINTR);
 
-		activeSockets = epoll_wait(m_handle, m_events.data(), static_cast<int>(m_events.size()), static_cast<int>(msTimeout));
 		if (activeSockets == -1)
 		{
 			if (error)
@@ -98,24 +138,31 @@ namespace Nz
 			return 0;
 		}
 
-		m_readyToReadSockets.clear();
-		m_readyToWriteSockets.clear();
 		if (activeSockets > 0)
 		{
 			int socketCount = activeSockets;
 			for (int i = 0; i < socketCount; ++i)
 			{
+				Entry* entry = static_cast<Entry*>(m_events[i].data.ptr);
+
 				if (m_events[i].events & (EPOLLIN | EPOLLOUT | EPOLLHUP | EPOLLERR))
 				{
+					SocketPollEventFlags readyEvents;
+
 					if (m_events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR))
-						m_readyToReadSockets.insert(m_events[i].data.fd);
+						readyEvents |= SocketPollEvent_Read;
 
 					if (m_events[i].events & (EPOLLOUT | EPOLLERR))
-						m_readyToWriteSockets.insert(m_events[i].data.fd);
+						readyEvents |= SocketPollEvent_Write;
+
+					entry->readyEvents = readyEvents;
+					entry->readyGeneration = m_generation;
+
+					m_readyEvents.push_back({ entry->owner, readyEvents, entry->userdata });
 				}
 				else
 				{
-					NazaraWarning("Descriptor " + String::Number(m_events[i].data.fd) + " was returned by epoll without EPOLLIN nor EPOLLOUT flags (events: 0x" + String::Number(m_events[i].events, 16) + ')');
+					NazaraWarning("Descriptor " + String::Number(entry->owner->GetNativeHandle()) + " was returned by epoll without EPOLLIN nor EPOLLOUT flags (events: 0x" + String::Number(m_events[i].events, 16) + ')');
 					activeSockets--;
 				}
 			}
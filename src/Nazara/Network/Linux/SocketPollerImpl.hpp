@@ -9,7 +9,8 @@
 
 #include <Nazara/Network/IpAddress.hpp>
 #include <Nazara/Network/SocketHandle.hpp>
-#include <unordered_set>
+#include <Nazara/Network/SocketPoller.hpp>
+#include <unordered_map>
 #include <vector>
 #include <sys/epoll.h>
 
@@ -23,20 +24,31 @@ namespace Nz
 
 			void Clear();
 
+			const std::vector<SocketPoller::Event>& GetReadyEvents() const;
+
 			bool IsReadyToRead(SocketHandle socket) const;
 			bool IsReadyToWrite(SocketHandle socket) const;
 			bool IsRegistered(SocketHandle socket) const;
 
-			bool RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags);
+			bool RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags, SocketPollMode mode, AbstractSocket* owner, void* userdata);
 			void UnregisterSocket(SocketHandle socket);
 
 			int Wait(int msTimeout, SocketError* error);
 
 		private:
-			std::unordered_set<SocketHandle> m_readyToReadSockets;
-			std::unordered_set<SocketHandle> m_readyToWriteSockets;
-			std::unordered_set<SocketHandle> m_sockets;
+			struct Entry
+			{
+				AbstractSocket* owner;
+				SocketPollEventFlags readyEvents;
+				UInt64 readyGeneration;
+				void* userdata;
+			};
+
+			// Entries are stored by node, epoll events keep a pointer to them
+			std::unordered_map<SocketHandle, Entry> m_sockets;
+			std::vector<SocketPoller::Event> m_readyEvents;
 			std::vector<epoll_event> m_events;
+			UInt64 m_generation;
 			int m_handle;
 	};
 }
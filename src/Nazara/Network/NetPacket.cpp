@@ -3,12 +3,200 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Network/NetPacket.hpp>
-#include <Nazara/Core/LockGuard.hpp>
 #include <Nazara/Core/MemoryView.hpp>
+#include <Nazara/Core/Metrics.hpp>
+#include <Nazara/Math/Algorithm.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <Nazara/Network/Debug.hpp>
 
 namespace Nz
 {
+	namespace
+	{
+		// Buffers are recycled by size classes (powers of two), from 64 bytes to 64 KB
+		constexpr unsigned int s_minSizeClass = 6;
+		constexpr unsigned int s_maxSizeClass = 16;
+		constexpr std::size_t s_sizeClassCount = s_maxSizeClass - s_minSizeClass + 1;
+
+		constexpr std::size_t s_globalPoolBytesPerClass = 4 * 1024 * 1024; //< Memory the global pool keeps at most for each size class
+		constexpr std::size_t s_threadCacheSize = 8; //< Buffers of each size class a thread keeps for itself
+		constexpr UInt32 s_invalidNode = 0xFFFFFFFF;
+
+		// Lock-free stacks of node indices, every change of the top bumps a tag stored in the high bits of the head to avoid the ABA problem
+		UInt32 PopNode(std::atomic<UInt64>& head, const std::atomic<UInt32>* links)
+		{
+			UInt64 top = head.load(std::memory_order_acquire);
+			for (;;)
+			{
+				UInt32 node = static_cast<UInt32>(top);
+				if (node == s_invalidNode)
+					return s_invalidNode;
+
+				UInt32 next = links[node].load(std::memory_order_relaxed);
+				if (head.compare_exchange_weak(top, (((top >> 32) + 1) << 32) | next, std::memory_order_acquire, std::memory_order_acquire))
+					return node;
+			}
+		}
+
+		void PushNode(std::atomic<UInt64>& head, std::atomic<UInt32>* links, UInt32 node)
+		{
+			UInt64 top = head.load(std::memory_order_relaxed);
+			do
+			{
+				links[node].store(static_cast<UInt32>(top), std::memory_order_relaxed);
+			}
+			while (!head.compare_exchange_weak(top, (((top >> 32) + 1) << 32) | node, std::memory_order_release, std::memory_order_relaxed));
+		}
+
+		// Global pool of a size class, nodes move between the free stack and the stack of nodes holding a buffer
+		struct SizeClassPool
+		{
+			std::atomic<UInt64> bufferHead;
+			std::atomic<UInt64> freeHead;
+			std::unique_ptr<std::atomic<UInt32>[]> links;
+			std::unique_ptr<ByteArray*[]> buffers;
+		};
+
+		std::array<SizeClassPool, s_sizeClassCount> s_globalPools;
+		std::atomic_bool s_globalPoolsInitialized(false);
+
+		std::atomic<UInt64> s_hitCount(0);
+		std::atomic<UInt64> s_missCount(0);
+		std::atomic<UInt64> s_heldBufferCount(0);
+		std::atomic<UInt64> s_heldBytes(0);
+
+		std::array<UInt32, 4> s_poolMetrics;
+
+		void DeleteBuffer(ByteArray* buffer)
+		{
+			s_heldBufferCount.fetch_sub(1, std::memory_order_relaxed);
+			s_heldBytes.fetch_sub(buffer->GetCapacity(), std::memory_order_relaxed);
+
+			delete buffer;
+		}
+
+		ByteArray* PopGlobalBuffer(std::size_t classIndex)
+		{
+			if (!s_globalPoolsInitialized.load(std::memory_order_acquire))
+				return nullptr;
+
+			SizeClassPool& pool = s_globalPools[classIndex];
+
+			UInt32 node = PopNode(pool.bufferHead, pool.links.get());
+			if (node == s_invalidNode)
+				return nullptr;
+
+			ByteArray* buffer = pool.buffers[node];
+			PushNode(pool.freeHead, pool.links.get(), node);
+
+			return buffer;
+		}
+
+		void PushGlobalBuffer(std::size_t classIndex, ByteArray* buffer)
+		{
+			if (s_globalPoolsInitialized.load(std::memory_order_acquire))
+			{
+				SizeClassPool& pool = s_globalPools[classIndex];
+
+				UInt32 node = PopNode(pool.freeHead, pool.links.get());
+				if (node != s_invalidNode)
+				{
+					pool.buffers[node] = buffer;
+					PushNode(pool.bufferHead, pool.links.get(), node);
+					return;
+				}
+			}
+
+			// Global pool is full (or destroyed)
+			DeleteBuffer(buffer);
+		}
+
+		struct ThreadCache
+		{
+			~ThreadCache()
+			{
+				Flush();
+			}
+
+			void Flush()
+			{
+				for (std::size_t i = 0; i < s_sizeClassCount; ++i)
+				{
+					while (counts[i] > 0)
+						PushGlobalBuffer(i, buffers[i][--counts[i]]);
+				}
+			}
+
+			std::array<std::array<ByteArray*, s_threadCacheSize>, s_sizeClassCount> buffers;
+			std::array<std::size_t, s_sizeClassCount> counts = {};
+		};
+
+		ThreadCache& GetThreadCache()
+		{
+			thread_local ThreadCache cache;
+			return cache;
+		}
+
+		std::unique_ptr<ByteArray> AcquireBuffer(std::size_t minCapacity)
+		{
+			// Smallest size class able to hold the buffer
+			unsigned int sizeClass = (minCapacity > (std::size_t(1) << s_minSizeClass)) ? IntegralLog2(minCapacity - 1) + 1 : s_minSizeClass;
+			if (sizeClass > s_maxSizeClass)
+			{
+				s_missCount.fetch_add(1, std::memory_order_relaxed);
+				return std::make_unique<ByteArray>();
+			}
+
+			std::size_t classIndex = sizeClass - s_minSizeClass;
+
+			ThreadCache& cache = GetThreadCache();
+
+			ByteArray* buffer;
+			if (cache.counts[classIndex] > 0)
+				buffer = cache.buffers[classIndex][--cache.counts[classIndex]];
+			else
+				buffer = PopGlobalBuffer(classIndex);
+
+			if (!buffer)
+			{
+				s_missCount.fetch_add(1, std::memory_order_relaxed);
+
+				// Reserve the whole size class, so this buffer can be recycled for any packet of this class
+				std::unique_ptr<ByteArray> newBuffer = std::make_unique<ByteArray>();
+				newBuffer->Reserve(std::size_t(1) << sizeClass);
+
+				return newBuffer;
+			}
+
+			s_hitCount.fetch_add(1, std::memory_order_relaxed);
+			s_heldBufferCount.fetch_sub(1, std::memory_order_relaxed);
+			s_heldBytes.fetch_sub(buffer->GetCapacity(), std::memory_order_relaxed);
+
+			return std::unique_ptr<ByteArray>(buffer);
+		}
+
+		void ReleaseBuffer(std::unique_ptr<ByteArray> buffer)
+		{
+			// Largest size class the buffer can hold, too small or too big buffers are not worth keeping
+			std::size_t capacity = buffer->GetCapacity();
+			if (capacity < (std::size_t(1) << s_minSizeClass) || capacity >= (std::size_t(1) << (s_maxSizeClass + 1)))
+				return;
+
+			std::size_t classIndex = IntegralLog2(capacity) - s_minSizeClass;
+
+			s_heldBufferCount.fetch_add(1, std::memory_order_relaxed);
+			s_heldBytes.fetch_add(capacity, std::memory_order_relaxed);
+
+			ThreadCache& cache = GetThreadCache();
+			if (cache.counts[classIndex] < s_threadCacheSize)
+				cache.buffers[classIndex][cache.counts[classIndex]++] = buffer.release();
+			else
+				PushGlobalBuffer(classIndex, buffer.release());
+		}
+	}
+
 	/*!
 	* \ingroup network
 	* \class Nz::NetPacket
@@ -102,6 +290,24 @@ namespace Nz
 		Reset(0);
 	}
 
+	/*!
+	* \brief Gets statistics about the pool recycling the packets buffers
+	* \return Statistics of every thread
+	*
+	* \remark Buffers are first looked for in a small cache of the calling thread, then in a lock-free pool shared by every thread, both count as hits
+	*/
+
+	NetPacket::BufferPoolStats NetPacket::GetBufferPoolStats()
+	{
+		BufferPoolStats stats;
+		stats.heldBufferCount = s_heldBufferCount.load(std::memory_order_relaxed);
+		stats.heldBytes = s_heldBytes.load(std::memory_order_relaxed);
+		stats.hitCount = s_hitCount.load(std::memory_order_relaxed);
+		stats.missCount = s_missCount.load(std::memory_order_relaxed);
+
+		return stats;
+	}
+
 	/*!
 	* \brief Frees the stream
 	*/
@@ -111,10 +317,7 @@ namespace Nz
 		if (!m_buffer)
 			return;
 
-		std::size_t size = m_buffer->GetSize();
-
-		Nz::LockGuard lock(*s_availableBuffersMutex);
-		s_availableBuffers.emplace_back(std::make_pair(size, std::move(m_buffer)));
+		ReleaseBuffer(std::move(m_buffer));
 	}
 
 	/*!
@@ -131,21 +334,9 @@ namespace Nz
 	{
 		NazaraAssert(minCapacity >= cursorPos, "Cannot init stream with a smaller capacity than wanted cursor pos");
 
-		{
-			Nz::LockGuard lock(*s_availableBuffersMutex);
-
-			FreeStream(); //< In case it wasn't released yet
-
-			if (!s_availableBuffers.empty())
-			{
-				m_buffer = std::move(s_availableBuffers.back().second);
-				s_availableBuffers.pop_back();
-			}
-		}
-
-		if (!m_buffer)
-			m_buffer = std::make_unique<ByteArray>();
+		FreeStream(); //< In case it wasn't released yet
 
+		m_buffer = AcquireBuffer(minCapacity);
 		m_buffer->Resize(minCapacity);
 
 		m_memoryStream.SetBuffer(m_buffer.get(), openMode);
@@ -160,20 +351,54 @@ namespace Nz
 
 	bool NetPacket::Initialize()
 	{
-		s_availableBuffersMutex = std::make_unique<Mutex>();
+		for (std::size_t i = 0; i < s_sizeClassCount; ++i)
+		{
+			std::size_t bufferCount = Clamp<std::size_t>(s_globalPoolBytesPerClass >> (s_minSizeClass + i), 16, 1024);
+
+			SizeClassPool& pool = s_globalPools[i];
+			pool.buffers.reset(new ByteArray*[bufferCount]);
+			pool.links.reset(new std::atomic<UInt32>[bufferCount]);
+
+			for (std::size_t j = 0; j < bufferCount; ++j)
+				pool.links[j].store((j + 1 < bufferCount) ? static_cast<UInt32>(j + 1) : s_invalidNode, std::memory_order_relaxed);
+
+			pool.bufferHead.store(s_invalidNode, std::memory_order_relaxed);
+			pool.freeHead.store(0, std::memory_order_relaxed);
+		}
+
+		s_globalPoolsInitialized.store(true, std::memory_order_release);
+
+		s_poolMetrics[0] = Metrics::Register(MetricType_Gauge, "nazara_netpacket_pool_buffers", "Packet buffers kept for reuse", [] () { return static_cast<double>(s_heldBufferCount.load(std::memory_order_relaxed)); });
+		s_poolMetrics[1] = Metrics::Register(MetricType_Gauge, "nazara_netpacket_pool_bytes", "Capacity of the packet buffers kept for reuse", [] () { return static_cast<double>(s_heldBytes.load(std::memory_order_relaxed)); });
+		s_poolMetrics[2] = Metrics::Register(MetricType_Counter, "nazara_netpacket_pool_hits_total", "Packets which got a recycled buffer", [] () { return static_cast<double>(s_hitCount.load(std::memory_order_relaxed)); });
+		s_poolMetrics[3] = Metrics::Register(MetricType_Counter, "nazara_netpacket_pool_misses_total", "Packets which had to allocate a buffer", [] () { return static_cast<double>(s_missCount.load(std::memory_order_relaxed)); });
+
 		return true;
 	}
 
 	/*!
 	* \brief Uninitializes the NetPacket class
+	*
+	* \remark Other threads must not use packets anymore, their remaining cached buffers are freed when they exit
 	*/
 
 	void NetPacket::Uninitialize()
 	{
-		s_availableBuffers.clear();
-		s_availableBuffersMutex.reset();
-	}
+		for (UInt32 metricId : s_poolMetrics)
+			Metrics::Unregister(metricId);
 
-	std::unique_ptr<Mutex> NetPacket::s_availableBuffersMutex;
-	std::vector<std::pair<std::size_t, std::unique_ptr<ByteArray>>> NetPacket::s_availableBuffers;
+		GetThreadCache().Flush();
+
+		s_globalPoolsInitialized.store(false, std::memory_order_release);
+
+		for (SizeClassPool& pool : s_globalPools)
+		{
+			UInt32 node;
+			while ((node = PopNode(pool.bufferHead, pool.links.get())) != s_invalidNode)
+				DeleteBuffer(pool.buffers[node]);
+
+			pool.buffers.reset();
+			pool.links.reset();
+		}
+	}
 }
@@ -7,7 +7,10 @@
 #include <Nazara/Core/Core.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Network/Config.hpp>
+#include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/HostnameResolver.hpp>
 #include <Nazara/Network/NetPacket.hpp>
 #include <Nazara/Network/RUdpConnection.hpp>
 
@@ -45,6 +48,8 @@ namespace Nz
 			return true; // Already initialized
 		}
 
+		Profiler::Scope profilerScope("Network::Initialize");
+
 		// Initialize module dependencies
 		if (!Core::Initialize())
 		{
@@ -69,12 +74,24 @@ namespace Nz
 			return false;
 		}
 
+		if (!ENetHost::Initialize())
+		{
+			NazaraError("Failed to initialize ENet hosts");
+			return false;
+		}
+
 		if (!RUdpConnection::Initialize())
 		{
 			NazaraError("Failed to initialize RUdp");
 			return false;
 		}
 
+		if (!HostnameResolver::Initialize())
+		{
+			NazaraError("Failed to initialize hostname resolver");
+			return false;
+		}
+
 		onExit.Reset();
 
 		NazaraNotice("Initialized: Network module");
@@ -111,7 +128,9 @@ namespace Nz
 		s_moduleReferenceCounter = 0;
 
 		// Uninitialize module here
+		HostnameResolver::Uninitialize();
 		RUdpConnection::Uninitialize();
+		ENetHost::Uninitialize();
 		NetPacket::Uninitialize();
 		SocketImpl::Uninitialize();
 
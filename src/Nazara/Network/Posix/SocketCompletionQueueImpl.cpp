@@ -0,0 +1,194 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/Posix/SocketCompletionQueueImpl.hpp>
+#include <poll.h>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	SocketCompletionQueueImpl::SocketCompletionQueueImpl(std::size_t queueSize)
+	{
+		m_operations.reserve(queueSize);
+	}
+
+	bool SocketCompletionQueueImpl::Accept(SocketHandle listenHandle, NetProtocol /*protocol*/, AcceptCallback callback, SocketError* error)
+	{
+		std::unique_ptr<Operation> operation = std::make_unique<Operation>();
+		operation->acceptCallback = std::move(callback);
+		operation->handle = listenHandle;
+		operation->type = OperationType::Accept;
+
+		m_operations.emplace_back(std::move(operation));
+
+		if (error)
+			*error = SocketError_NoError;
+
+		return true;
+	}
+
+	void SocketCompletionQueueImpl::CancelOperations(SocketHandle handle)
+	{
+		for (std::unique_ptr<Operation>& operation : m_operations)
+		{
+			if (operation->handle == handle)
+				operation->isCancelled = true;
+		}
+	}
+
+	std::size_t SocketCompletionQueueImpl::GetPendingOperationCount() const
+	{
+		return m_operations.size();
+	}
+
+	bool SocketCompletionQueueImpl::IsValid() const
+	{
+		return true;
+	}
+
+	bool SocketCompletionQueueImpl::Receive(SocketHandle handle, void* buffer, std::size_t size, Callback callback, SocketError* error)
+	{
+		std::unique_ptr<Operation> operation = std::make_unique<Operation>();
+		operation->buffer = static_cast<const UInt8*>(buffer);
+		operation->callback = std::move(callback);
+		operation->handle = handle;
+		operation->size = size;
+		operation->type = OperationType::Receive;
+
+		m_operations.emplace_back(std::move(operation));
+
+		if (error)
+			*error = SocketError_NoError;
+
+		return true;
+	}
+
+	bool SocketCompletionQueueImpl::Send(SocketHandle handle, const void* buffer, std::size_t size, Callback callback, SocketError* error)
+	{
+		std::unique_ptr<Operation> operation = std::make_unique<Operation>();
+		operation->buffer = static_cast<const UInt8*>(buffer);
+		operation->callback = std::move(callback);
+		operation->handle = handle;
+		operation->size = size;
+		operation->type = OperationType::Send;
+
+		m_operations.emplace_back(std::move(operation));
+
+		if (error)
+			*error = SocketError_NoError;
+
+		return true;
+	}
+
+	int SocketCompletionQueueImpl::Wait(int msTimeout, SocketError* error)
+	{
+		if (error)
+			*error = SocketError_NoError;
+
+		bool hasCancelledOperations = false;
+
+		m_pollSockets.clear();
+		for (std::unique_ptr<Operation>& operation : m_operations)
+		{
+			PollSocket pollSocket;
+			pollSocket.fd = operation->handle;
+			pollSocket.events = (operation->type == OperationType::Send) ? POLLOUT : POLLIN;
+			pollSocket.revents = 0;
+
+			m_pollSockets.push_back(pollSocket);
+
+			if (operation->isCancelled)
+				hasCancelledOperations = true;
+		}
+
+		if (!m_pollSockets.empty())
+		{
+			// Cancelled operations complete right away
+			SocketError pollError = SocketError_NoError;
+			SocketImpl::Poll(m_pollSockets.data(), m_pollSockets.size(), (hasCancelledOperations) ? 0 : msTimeout, &pollError);
+			if (pollError != SocketError_NoError)
+			{
+				if (error)
+					*error = pollError;
+
+				return -1;
+			}
+		}
+
+		// Callbacks may start new operations, take ready operations out of the list first
+		std::vector<std::unique_ptr<Operation>> readyOperations;
+
+		std::size_t pendingCount = 0;
+		for (std::size_t i = 0; i < m_pollSockets.size(); ++i)
+		{
+			std::unique_ptr<Operation>& operation = m_operations[i];
+			if (operation->isCancelled || m_pollSockets[i].revents != 0)
+				readyOperations.emplace_back(std::move(operation));
+			else
+				m_operations[pendingCount++] = std::move(operation);
+		}
+		m_operations.erase(m_operations.begin() + pendingCount, m_operations.end());
+
+		int completedCount = 0;
+		for (std::unique_ptr<Operation>& operation : readyOperations)
+		{
+			SocketError operationError = SocketError_Interrupted;
+			SocketHandle acceptedHandle = SocketImpl::InvalidHandle;
+			IpAddress acceptedAddress;
+
+			if (!operation->isCancelled && !RunOperation(*operation, &operationError, &acceptedHandle, &acceptedAddress))
+			{
+				// Spurious readiness or partial send, wait again
+				m_operations.emplace_back(std::move(operation));
+				continue;
+			}
+
+			if (operation->type == OperationType::Accept)
+			{
+				if (operation->acceptCallback)
+					operation->acceptCallback(operationError, acceptedHandle, acceptedAddress);
+			}
+			else if (operation->callback)
+				operation->callback(operationError, operation->transferred);
+
+			completedCount++;
+		}
+
+		return completedCount;
+	}
+
+	bool SocketCompletionQueueImpl::RunOperation(Operation& operation, SocketError* error, SocketHandle* acceptedHandle, IpAddress* acceptedAddress)
+	{
+		switch (operation.type)
+		{
+			case OperationType::Accept:
+			{
+				*acceptedHandle = SocketImpl::Accept(operation.handle, acceptedAddress, error);
+				return *acceptedHandle != SocketImpl::InvalidHandle || *error != SocketError_Internal; //< Would block
+			}
+
+			case OperationType::Receive:
+			{
+				int read;
+				if (!SocketImpl::Receive(operation.handle, const_cast<UInt8*>(operation.buffer), static_cast<int>(operation.size), &read, error))
+					return true;
+
+				operation.transferred = read;
+				return read > 0;
+			}
+
+			case OperationType::Send:
+			{
+				int sent;
+				if (!SocketImpl::Send(operation.handle, operation.buffer + operation.transferred, static_cast<int>(operation.size - operation.transferred), &sent, error))
+					return true;
+
+				operation.transferred += sent;
+				return operation.transferred >= operation.size;
+			}
+		}
+
+		return true;
+	}
+}
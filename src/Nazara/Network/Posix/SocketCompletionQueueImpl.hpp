@@ -0,0 +1,68 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_SOCKETCOMPLETIONQUEUEIMPL_HPP
+#define NAZARA_SOCKETCOMPLETIONQUEUEIMPL_HPP
+
+#include <Nazara/Network/SocketCompletionQueue.hpp>
+#include <Nazara/Network/Posix/SocketImpl.hpp>
+#include <memory>
+#include <vector>
+
+namespace Nz
+{
+	// Emulates completions by waiting for sockets to become ready and running the operation right after
+	class SocketCompletionQueueImpl
+	{
+		public:
+			using AcceptCallback = std::function<void(SocketError error, SocketHandle handle, const IpAddress& address)>;
+			using Callback = SocketCompletionQueue::Callback;
+
+			SocketCompletionQueueImpl(std::size_t queueSize);
+			~SocketCompletionQueueImpl() = default;
+
+			bool Accept(SocketHandle listenHandle, NetProtocol protocol, AcceptCallback callback, SocketError* error);
+
+			void CancelOperations(SocketHandle handle);
+
+			std::size_t GetPendingOperationCount() const;
+
+			bool IsValid() const;
+
+			bool Receive(SocketHandle handle, void* buffer, std::size_t size, Callback callback, SocketError* error);
+
+			bool Send(SocketHandle handle, const void* buffer, std::size_t size, Callback callback, SocketError* error);
+
+			int Wait(int msTimeout, SocketError* error);
+
+		private:
+			enum class OperationType
+			{
+				Accept,
+				Receive,
+				Send
+			};
+
+			struct Operation
+			{
+				AcceptCallback acceptCallback;
+				Callback callback;
+				OperationType type;
+				SocketHandle handle;
+				const UInt8* buffer = nullptr;
+				std::size_t size = 0;
+				std::size_t transferred = 0;
+				bool isCancelled = false;
+			};
+
+			bool RunOperation(Operation& operation, SocketError* error, SocketHandle* acceptedHandle, IpAddress* acceptedAddress);
+
+			std::vector<std::unique_ptr<Operation>> m_operations;
+			std::vector<PollSocket> m_pollSockets;
+	};
+}
+
+#endif // NAZARA_SOCKETCOMPLETIONQUEUEIMPL_HPP
@@ -6,6 +6,7 @@
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/MemoryHelper.hpp>
 #include <Nazara/Network/NetBuffer.hpp>
+#include <Nazara/Network/NetDatagram.hpp>
 #include <Nazara/Network/Posix/IpAddressImpl.hpp>
 #include <netinet/tcp.h>
 #include <sys/ioctl.h>
@@ -509,6 +510,121 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::ReceiveDatagrams(SocketHandle handle, NetDatagram* datagrams, std::size_t datagramCount, std::size_t* received, SocketError* error)
+	{
+		NazaraAssert(handle != InvalidHandle, "Invalid handle");
+		NazaraAssert(datagrams && datagramCount > 0, "Invalid datagrams");
+
+		#ifdef NAZARA_PLATFORM_LINUX
+		std::size_t bufferCount = 0;
+		for (std::size_t i = 0; i < datagramCount; ++i)
+			bufferCount += datagrams[i].bufferCount;
+
+		StackArray<iovec> sysBuffers = NazaraStackAllocation(iovec, bufferCount);
+		StackArray<mmsghdr> messages = NazaraStackAllocation(mmsghdr, datagramCount);
+		StackArray<IpAddressImpl::SockAddrBuffer> nameBuffers = NazaraStackAllocation(IpAddressImpl::SockAddrBuffer, datagramCount);
+
+		iovec* sysBuffer = sysBuffers.data();
+		for (std::size_t i = 0; i < datagramCount; ++i)
+		{
+			const NetDatagram& datagram = datagrams[i];
+			for (std::size_t j = 0; j < datagram.bufferCount; ++j)
+			{
+				sysBuffer[j].iov_base = datagram.buffers[j].data;
+				sysBuffer[j].iov_len = datagram.buffers[j].dataLength;
+			}
+
+			std::fill(nameBuffers[i].begin(), nameBuffers[i].end(), 0);
+
+			mmsghdr& message = messages[i];
+			std::memset(&message, 0, sizeof(message));
+			message.msg_hdr.msg_iov = sysBuffer;
+			message.msg_hdr.msg_iovlen = datagram.bufferCount;
+			message.msg_hdr.msg_name = nameBuffers[i].data();
+			message.msg_hdr.msg_namelen = static_cast<socklen_t>(nameBuffers[i].size());
+
+			sysBuffer += datagram.bufferCount;
+		}
+
+		// Only waits for the first datagram (if the socket is blocking), then takes every datagram already there
+		int messageCount = recvmmsg(handle, messages.data(), static_cast<unsigned int>(datagramCount), MSG_WAITFORONE, nullptr);
+		if (messageCount == -1)
+		{
+			int errorCode = GetLastErrorCode();
+			if (errorCode == EAGAIN)
+				errorCode = EWOULDBLOCK;
+
+			if (errorCode != EWOULDBLOCK)
+			{
+				if (error)
+					*error = TranslateErrnoToResolveError(errorCode);
+
+				return false; //< Error
+			}
+
+			// If we have no data and are not blocking, return true with no datagram
+			messageCount = 0;
+		}
+
+		for (int i = 0; i < messageCount; ++i)
+		{
+			datagrams[i].address = IpAddressImpl::FromSockAddr(reinterpret_cast<const sockaddr*>(nameBuffers[i].data()));
+			datagrams[i].dataLength = messages[i].msg_len;
+		}
+
+		if (received)
+			*received = static_cast<std::size_t>(messageCount);
+
+		if (error)
+			*error = SocketError_NoError;
+
+		return true;
+		#else
+		std::size_t datagramIndex = 0;
+		for (; datagramIndex < datagramCount; ++datagramIndex)
+		{
+			// Only the first reception may block
+			if (datagramIndex > 0 && QueryAvailableBytes(handle) == 0)
+				break;
+
+			NetDatagram& datagram = datagrams[datagramIndex];
+
+			int byteRead;
+			SocketError receiveError;
+			if (!ReceiveMultiple(handle, datagram.buffers, datagram.bufferCount, &datagram.address, &byteRead, &receiveError))
+			{
+				if (receiveError != SocketError_ConnectionClosed)
+				{
+					// Report errors on the next call if we already got something
+					if (datagramIndex > 0)
+						break;
+
+					if (error)
+						*error = receiveError;
+
+					return false;
+				}
+
+				// Empty datagram
+				datagram.address = IpAddress::Invalid;
+				byteRead = 0;
+			}
+			else if (byteRead == 0 && !datagram.address.IsValid())
+				break; //< Nothing left to receive
+
+			datagram.dataLength = static_cast<std::size_t>(byteRead);
+		}
+
+		if (received)
+			*received = datagramIndex;
+
+		if (error)
+			*error = SocketError_NoError;
+
+		return true;
+		#endif
+	}
+
 	bool SocketImpl::ReceiveFrom(SocketHandle handle, void* buffer, int length, IpAddress* from, int* read, SocketError* error)
 	{
 		NazaraAssert(handle != InvalidHandle, "Invalid handle");
@@ -693,6 +809,104 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::SendDatagrams(SocketHandle handle, NetDatagram* datagrams, std::size_t datagramCount, std::size_t* sent, SocketError* error)
+	{
+		NazaraAssert(handle != InvalidHandle, "Invalid handle");
+		NazaraAssert(datagrams && datagramCount > 0, "Invalid datagrams");
+
+		#ifdef NAZARA_PLATFORM_LINUX
+		std::size_t bufferCount = 0;
+		for (std::size_t i = 0; i < datagramCount; ++i)
+			bufferCount += datagrams[i].bufferCount;
+
+		StackArray<iovec> sysBuffers = NazaraStackAllocation(iovec, bufferCount);
+		StackArray<mmsghdr> messages = NazaraStackAllocation(mmsghdr, datagramCount);
+		StackArray<IpAddressImpl::SockAddrBuffer> nameBuffers = NazaraStackAllocation(IpAddressImpl::SockAddrBuffer, datagramCount);
+
+		iovec* sysBuffer = sysBuffers.data();
+		for (std::size_t i = 0; i < datagramCount; ++i)
+		{
+			const NetDatagram& datagram = datagrams[i];
+			for (std::size_t j = 0; j < datagram.bufferCount; ++j)
+			{
+				sysBuffer[j].iov_base = datagram.buffers[j].data;
+				sysBuffer[j].iov_len = datagram.buffers[j].dataLength;
+			}
+
+			mmsghdr& message = messages[i];
+			std::memset(&message, 0, sizeof(message));
+			message.msg_hdr.msg_iov = sysBuffer;
+			message.msg_hdr.msg_iovlen = datagram.bufferCount;
+			message.msg_hdr.msg_name = nameBuffers[i].data();
+			message.msg_hdr.msg_namelen = IpAddressImpl::ToSockAddr(datagram.address, nameBuffers[i].data());
+
+			sysBuffer += datagram.bufferCount;
+		}
+
+		int messageCount = sendmmsg(handle, messages.data(), static_cast<unsigned int>(datagramCount), MSG_NOSIGNAL);
+		if (messageCount == SOCKET_ERROR)
+		{
+			int errorCode = GetLastErrorCode();
+			if (errorCode == EAGAIN)
+				errorCode = EWOULDBLOCK;
+
+			if (errorCode != EWOULDBLOCK)
+			{
+				if (error)
+					*error = TranslateErrnoToResolveError(errorCode);
+
+				return false; //< Error
+			}
+
+			messageCount = 0;
+		}
+
+		for (int i = 0; i < messageCount; ++i)
+			datagrams[i].dataLength = messages[i].msg_len;
+
+		if (sent)
+			*sent = static_cast<std::size_t>(messageCount);
+
+		if (error)
+			*error = SocketError_NoError;
+
+		return true;
+		#else
+		std::size_t datagramIndex = 0;
+		for (; datagramIndex < datagramCount; ++datagramIndex)
+		{
+			NetDatagram& datagram = datagrams[datagramIndex];
+
+			int byteSent;
+			SocketError sendError;
+			if (!SendMultiple(handle, datagram.buffers, datagram.bufferCount, datagram.address, &byteSent, &sendError))
+			{
+				// Report errors on the next call if we already sent something
+				if (datagramIndex > 0)
+					break;
+
+				if (error)
+					*error = sendError;
+
+				return false;
+			}
+
+			if (byteSent == 0)
+				break; //< Would block
+
+			datagram.dataLength = static_cast<std::size_t>(byteSent);
+		}
+
+		if (sent)
+			*sent = datagramIndex;
+
+		if (error)
+			*error = SocketError_NoError;
+
+		return true;
+		#endif
+	}
+
 	bool SocketImpl::SendMultiple(SocketHandle handle, const NetBuffer* buffers, std::size_t bufferCount, const IpAddress& to, int* sent, SocketError* error)
 	{
 		NazaraAssert(handle != InvalidHandle, "Invalid handle");
@@ -919,6 +1133,34 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::SetReusePort(SocketHandle handle, bool reusePort, SocketError* error)
+	{
+		NazaraAssert(handle != InvalidHandle, "Invalid handle");
+
+		#ifdef SO_REUSEPORT
+		int option = reusePort;
+		if (setsockopt(handle, SOL_SOCKET, SO_REUSEPORT, reinterpret_cast<const char*>(&option), sizeof(option)) == SOCKET_ERROR)
+		{
+			if (error)
+				*error = TranslateErrnoToResolveError(GetLastErrorCode());
+
+			return false; //< Error
+		}
+
+		if (error)
+			*error = SocketError_NoError;
+
+		return true;
+		#else
+		NazaraUnused(reusePort);
+
+		if (error)
+			*error = SocketError_NotSupported;
+
+		return false;
+		#endif
+	}
+
 	bool SocketImpl::SetSendBufferSize(SocketHandle handle, std::size_t size, SocketError* error)
 	{
 		NazaraAssert(handle != InvalidHandle, "Invalid handle");
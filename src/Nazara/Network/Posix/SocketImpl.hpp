@@ -16,6 +16,7 @@
 namespace Nz
 {
 	struct NetBuffer;
+	struct NetDatagram;
 
 	struct PollSocket
 	{
@@ -63,10 +64,12 @@ namespace Nz
 			static int Poll(PollSocket* fdarray, std::size_t nfds, int timeout, SocketError* error);
 
 			static bool Receive(SocketHandle handle, void* buffer, int length, int* read, SocketError* error);
+			static bool ReceiveDatagrams(SocketHandle handle, NetDatagram* datagrams, std::size_t datagramCount, std::size_t* received, SocketError* error);
 			static bool ReceiveFrom(SocketHandle handle, void* buffer, int length, IpAddress* from, int* read, SocketError* error);
 			static bool ReceiveMultiple(SocketHandle handle, NetBuffer* buffers, std::size_t bufferCount, IpAddress* from, int* read, SocketError* error);
 
 			static bool Send(SocketHandle handle, const void* buffer, int length, int* sent, SocketError* error);
+			static bool SendDatagrams(SocketHandle handle, NetDatagram* datagrams, std::size_t datagramCount, std::size_t* sent, SocketError* error);
 			static bool SendMultiple(SocketHandle handle, const NetBuffer* buffers, std::size_t bufferCount, const IpAddress& to, int* sent, SocketError* error);
 			static bool SendTo(SocketHandle handle, const void* buffer, int length, const IpAddress& to, int* sent, SocketError* error);
 
@@ -76,6 +79,7 @@ namespace Nz
 			static bool SetKeepAlive(SocketHandle handle, bool enabled, UInt64 msTime, UInt64 msInterval, SocketError* error = nullptr);
 			static bool SetNoDelay(SocketHandle handle, bool nodelay, SocketError* error = nullptr);
 			static bool SetReceiveBufferSize(SocketHandle handle, std::size_t size, SocketError* error = nullptr);
+			static bool SetReusePort(SocketHandle handle, bool reusePort, SocketError* error = nullptr);
 			static bool SetSendBufferSize(SocketHandle handle, std::size_t size, SocketError* error = nullptr);
 
 			static SocketError TranslateErrnoToResolveError(int error);
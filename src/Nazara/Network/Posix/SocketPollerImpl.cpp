@@ -3,27 +3,38 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Network/Posix/SocketPollerImpl.hpp>
+#include <algorithm>
 #include <poll.h>
 #include <Nazara/Network/Debug.hpp>
 
 namespace Nz
 {
+	SocketPollerImpl::SocketPollerImpl() :
+	m_generation(0)
+	{
+	}
+
 	void SocketPollerImpl::Clear()
 	{
-		m_readyToReadSockets.clear();
-		m_readyToWriteSockets.clear();
 		m_allSockets.clear();
+		m_entries.clear();
+		m_readyEvents.clear();
 		m_sockets.clear();
 	}
 
+	const std::vector<SocketPoller::Event>& SocketPollerImpl::GetReadyEvents() const
+	{
+		return m_readyEvents;
+	}
+
 	bool SocketPollerImpl::IsReadyToRead(SocketHandle socket) const
 	{
-		return m_readyToReadSockets.count(socket) != 0;
+		return IsReady(socket, SocketPollEvent_Read);
 	}
 
 	bool SocketPollerImpl::IsReadyToWrite(SocketHandle socket) const
 	{
-		return m_readyToWriteSockets.count(socket) != 0;
+		return IsReady(socket, SocketPollEvent_Write);
 	}
 
 	bool SocketPollerImpl::IsRegistered(SocketHandle socket) const
@@ -31,10 +42,11 @@ namespace Nz
 		return m_allSockets.count(socket) != 0;
 	}
 
-	bool SocketPollerImpl::RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags)
+	bool SocketPollerImpl::RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags, SocketPollMode /*mode*/, AbstractSocket* owner, void* userdata)
 	{
 		NazaraAssert(!IsRegistered(socket), "Socket is already registered");
 
+		// poll has no edge-triggered mode, sockets are reported as long as they're ready
 		PollSocket entry = {
 			socket,
 			0,
@@ -48,6 +60,7 @@ namespace Nz
 			entry.events |= POLLWRNORM;
 
 		m_allSockets[socket] = m_sockets.size();
+		m_entries.push_back({ owner, 0, 0, userdata });
 		m_sockets.emplace_back(entry);
 
 		return true;
@@ -57,58 +70,72 @@ namespace Nz
 	{
 		NazaraAssert(IsRegistered(socket), "Socket is not registered");
 
+		std::size_t entry = m_allSockets[socket];
+		AbstractSocket* owner = m_entries[entry].owner;
+
 		if (m_sockets.size() > 1U)
 		{
 			// Instead of using vector::erase, let's move the last element to the now unoccupied position
-			std::size_t entry = m_allSockets[socket];
-
 			// Get the last element and update it's position
 			const PollSocket& lastElement = m_sockets.back();
 			m_allSockets[lastElement.fd] = entry;
 
 			// Now move it properly (lastElement is invalid after the following line) and pop it
+			m_entries[entry] = std::move(m_entries.back());
 			m_sockets[entry] = std::move(m_sockets.back());
 		}
+		m_entries.pop_back();
 		m_sockets.pop_back();
 
 		m_allSockets.erase(socket);
-		m_readyToReadSockets.erase(socket);
-		m_readyToWriteSockets.erase(socket);
+
+		// Don't report this socket anymore
+		m_readyEvents.erase(std::remove_if(m_readyEvents.begin(), m_readyEvents.end(), [&](const SocketPoller::Event& event) { return event.socket == owner; }), m_readyEvents.end());
 	}
 
 	int SocketPollerImpl::Wait(int msTimeout, SocketError* error)
 	{
 		int activeSockets;
 
-		// Reset status of sockets
+		// Invalidates ready states of the previous wait without touching every entry
+		m_generation++;
+		m_readyEvents.clear();
+
 		activeSockets = SocketImpl::Poll(m_sockets.data(), m_sockets.size(), static_cast<int>(msTimeout), error);
 
-		m_readyToReadSockets.clear();
-		m_readyToWriteSockets.clear();
 		if (activeSockets > 0U)
 		{
 			int socketRemaining = activeSockets;
-			for (PollSocket& entry : m_sockets)
+			for (std::size_t i = 0; i < m_sockets.size(); ++i)
 			{
-				if (!entry.revents)
+				PollSocket& socket = m_sockets[i];
+				if (!socket.revents)
 					continue;
 
-				if (entry.revents & (POLLRDNORM | POLLWRNORM | POLLHUP | POLLERR))
+				if (socket.revents & (POLLRDNORM | POLLWRNORM | POLLHUP | POLLERR))
 				{
-					if (entry.revents & (POLLRDNORM | POLLHUP | POLLERR))
-						m_readyToReadSockets.insert(entry.fd);
+					SocketPollEventFlags readyEvents;
+
+					if (socket.revents & (POLLRDNORM | POLLHUP | POLLERR))
+						readyEvents |= SocketPollEvent_Read;
+
+					if (socket.revents & (POLLWRNORM | POLLERR))
+						readyEvents |= SocketPollEvent_Write;
+
+					Entry& entry = m_entries[i];
+					entry.readyEvents = readyEvents;
+					entry.readyGeneration = m_generation;
 
-					if (entry.revents & (POLLWRNORM | POLLERR))
-						m_readyToWriteSockets.insert(entry.fd);
+					m_readyEvents.push_back({ entry.owner, readyEvents, entry.userdata });
 
-					entry.revents = 0;
+					socket.revents = 0;
 
 					if (--socketRemaining == 0)
 						break;
 				}
 				else
 				{
-					NazaraWarning("Socket " + String::Number(entry.fd) + " was returned by WSAPoll without POLLRDNORM nor POLLWRNORM events (events: 0x" + String::Number(entry.revents, 16) + ')');
+					NazaraWarning("Socket " + String::Number(socket.fd) + " was returned by poll without POLLRDNORM nor POLLWRNORM events (events: 0x" + String::Number(socket.revents, 16) + ')');
 					activeSockets--;
 				}
 			}
@@ -116,4 +143,14 @@ namespace Nz
 
 		return activeSockets;
 	}
+
+	bool SocketPollerImpl::IsReady(SocketHandle socket, SocketPollEvent event) const
+	{
+		auto it = m_allSockets.find(socket);
+		if (it == m_allSockets.end())
+			return false;
+
+		const Entry& entry = m_entries[it->second];
+		return entry.readyGeneration == m_generation && (entry.readyEvents & event);
+	}
 }
@@ -8,9 +8,9 @@
 #define NAZARA_SOCKETPOLLERIMPL_HPP
 
 #include <Nazara/Network/SocketHandle.hpp>
+#include <Nazara/Network/SocketPoller.hpp>
 #include <Nazara/Network/Posix/SocketImpl.hpp>
 #include <unordered_map>
-#include <unordered_set>
 #include <vector>
 
 namespace Nz
@@ -18,24 +18,38 @@ namespace Nz
 	class SocketPollerImpl
 	{
 		public:
-			SocketPollerImpl() = default;
+			SocketPollerImpl();
 			~SocketPollerImpl() = default;
 
 			void Clear();
 
-			bool IsReady(SocketHandle socket) const;
+			const std::vector<SocketPoller::Event>& GetReadyEvents() const;
+
+			bool IsReadyToRead(SocketHandle socket) const;
+			bool IsReadyToWrite(SocketHandle socket) const;
 			bool IsRegistered(SocketHandle socket) const;
 
-			bool RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags);
+			bool RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags, SocketPollMode mode, AbstractSocket* owner, void* userdata);
 			void UnregisterSocket(SocketHandle socket);
 
 			int Wait(int msTimeout, SocketError* error);
 
 		private:
-			std::unordered_set<SocketHandle> m_readyToReadSockets;
-			std::unordered_set<SocketHandle> m_readyToWriteSockets;
+			struct Entry
+			{
+				AbstractSocket* owner;
+				SocketPollEventFlags readyEvents;
+				UInt64 readyGeneration;
+				void* userdata;
+			};
+
+			bool IsReady(SocketHandle socket, SocketPollEvent event) const;
+
 			std::unordered_map<SocketHandle, std::size_t> m_allSockets;
+			std::vector<Entry> m_entries; //< Same indices as m_sockets
 			std::vector<PollSocket> m_sockets;
+			std::vector<SocketPoller::Event> m_readyEvents;
+			UInt64 m_generation;
 	};
 }
 
@@ -6,6 +6,9 @@
 #include <Nazara/Core/CallOnExit.hpp>
 #include <Nazara/Core/Log.hpp>
 #include <Nazara/Network/NetPacket.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <Nazara/Network/Debug.hpp>
 
 namespace Nz
@@ -14,6 +17,12 @@ namespace Nz
 	* \ingroup network
 	* \class Nz::RUdpConnection
 	* \brief Network class that represents a reliable UDP connection
+	*
+	* Sending is congestion controlled per peer with a delay-based window (in the spirit of LEDBAT): the window grows while the round trip time stays close to its lowest measure, and shrinks when it rises by more than the target queuing delay or when packets are lost.
+	* Packets are paced over the round trip time rather than sent as bursts, and the datagrams of an update are sent as a batch.
+	*
+	* \remark Immediate priority packets (connection handshakes, acknowledgements and pings) are never held back
+	* \remark Pacing works at the granularity of Update calls, which should be made several times per round trip time
 	*/
 
 	/*!
@@ -95,6 +104,39 @@ namespace Nz
 		return Connect(hostnameAddress);
 	}
 
+	/*!
+	* \brief Gets the congestion control statistics of a peer
+	* \return true If peer exists
+	*
+	* \param peerIp IpAddress of the peer
+	* \param stats Structure to fill with the statistics
+	*
+	* \remark Round trip times are 0 until the first acknowledgement of the peer is received
+	* \remark Produces a NazaraAssert if stats is invalid
+	*/
+
+	bool RUdpConnection::GetPeerStats(const IpAddress& peerIp, PeerStats* stats) const
+	{
+		NazaraAssert(stats, "Invalid stats");
+
+		auto it = m_peerByIP.find(peerIp);
+		if (it == m_peerByIP.end())
+			return false;
+
+		const PeerData& peer = m_peers[it->second];
+		bool hasRoundTrip = (peer.minRoundTripTime != std::numeric_limits<UInt32>::max());
+
+		stats->bytesInFlight = peer.bytesInFlight;
+		stats->congestionWindow = peer.congestionWindow;
+		stats->lostPackets = peer.lostPackets;
+		stats->minRoundTripTime = (hasRoundTrip) ? peer.minRoundTripTime : 0;
+		stats->roundTripTime = (hasRoundTrip) ? peer.roundTripTime : 0;
+		stats->roundTripTimeVariance = (hasRoundTrip) ? peer.roundTripTimeVariance : 0;
+		stats->sentPackets = peer.sentPackets;
+
+		return true;
+	}
+
 	/*!
 	* \brief Listens to a socket
 	* \return true If successfully bound
@@ -185,29 +227,47 @@ namespace Nz
 				if (m_currentTime - peer.lastPingTime > m_pingInterval)
 				{
 					NetPacket pingPacket(NetCode_Ping);
-					EnqueuePacket(peer, PacketPriority_Low, PacketReliability_Unreliable, pingPacket);
+					EnqueuePacket(peer, PacketPriority_Immediate, PacketReliability_Unreliable, pingPacket);
 				}
 			}
 
 			if (peer.state == PeerState_WillAck && m_currentTime - peer.stateData1 > m_forceAckSendTime)
 			{
 				NetPacket acknowledgePacket(NetCode_Acknowledge);
-				EnqueuePacket(peer, PacketPriority_Low, PacketReliability_Reliable, acknowledgePacket);
+				EnqueuePacket(peer, PacketPriority_Immediate, PacketReliability_Reliable, acknowledgePacket);
 			}
 
-			for (unsigned int priority = PacketPriority_Highest; priority <= PacketPriority_Lowest; ++priority)
+			UpdatePacingCredit(peer);
+
+			// Packets held back by congestion control keep their order, lower priorities wait behind them
+			bool congested = false;
+			for (unsigned int priority = PacketPriority_Highest; priority <= PacketPriority_Lowest && !congested; ++priority)
 			{
 				std::vector<PendingPacket>& pendingPackets = peer.pendingPackets[priority];
+
+				std::size_t sentCount = 0;
 				for (PendingPacket& packetData : pendingPackets)
+				{
+					if (!CanSendPacket(peer, static_cast<PacketPriority>(priority), packetData.data.GetSize()))
+					{
+						congested = true;
+						break;
+					}
+
 					SendPacket(peer, std::move(packetData));
+					sentCount++;
+				}
 
-				pendingPackets.clear();
+				pendingPackets.erase(pendingPackets.begin(), pendingPackets.begin() + sentCount);
 			}
 
+			// Acknowledgements may be delayed by the remote, which is part of the measured round trip time
+			UInt64 retransmissionTimeout = std::max<UInt64>(2 * peer.roundTripTime, peer.roundTripTime + 4 * peer.roundTripTimeVariance) + m_forceAckSendTime;
+
 			auto it = peer.pendingAckQueue.begin();
 			while (it != peer.pendingAckQueue.end())
 			{
-				if (m_currentTime - it->timeSent > 2 * peer.roundTripTime)
+				if (m_currentTime - it->timeSent > retransmissionTimeout)
 				{
 					OnPacketLost(peer, std::move(*it));
 					it = peer.pendingAckQueue.erase(it);
@@ -217,6 +277,33 @@ namespace Nz
 			}
 		}
 		//m_activeClients.Reset();
+
+		FlushQueuedDatagrams();
+	}
+
+	/*!
+	* \brief Checks whether congestion control allows a packet to be sent to a peer
+	* \return true If the packet can be sent
+	*
+	* \param peer Data relative to the peer
+	* \param priority Priority of the packet
+	* \param size Size of the datagram
+	*/
+
+	bool RUdpConnection::CanSendPacket(PeerData& peer, PacketPriority priority, std::size_t size) const
+	{
+		if (priority == PacketPriority_Immediate)
+			return true;
+
+		if (peer.pacingCredit <= 0.0)
+			return false;
+
+		// Acknowledgements only cover the last 33 sequences, packets sent beyond that would be considered lost
+		if (peer.pendingAckQueue.size() > 32)
+			return false;
+
+		// A packet bigger than the window can still be sent alone
+		return peer.bytesInFlight == 0 || peer.bytesInFlight + size <= peer.congestionWindow;
 	}
 
 	/*!
@@ -308,6 +395,37 @@ namespace Nz
 		m_activeClients.UnboundedSet(peer.index);
 	}
 
+	/*!
+	* \brief Sends the datagrams queued by the update as a batch
+	*/
+
+	void RUdpConnection::FlushQueuedDatagrams()
+	{
+		// Buffers are only linked now, as queuing reallocates them
+		for (std::size_t i = 0; i < m_queuedDatagrams.size(); ++i)
+			m_queuedDatagrams[i].buffers = &m_queuedBuffers[i];
+
+		std::size_t datagramIndex = 0;
+		while (datagramIndex < m_queuedDatagrams.size())
+		{
+			std::size_t sentCount;
+			if (!m_socket.SendDatagrams(&m_queuedDatagrams[datagramIndex], m_queuedDatagrams.size() - datagramIndex, &sentCount))
+			{
+				m_lastError = m_socket.GetLastError();
+				break;
+			}
+
+			// The socket would block, the remaining datagrams are dropped and will be detected as lost
+			if (sentCount == 0)
+				break;
+
+			datagramIndex += sentCount;
+		}
+
+		m_queuedBuffers.clear();
+		m_queuedDatagrams.clear();
+	}
+
 	/*!
 	* \brief Inits the internal socket
 	* \return true If successful
@@ -354,6 +472,7 @@ namespace Nz
 
 			if (acked)
 			{
+				OnPacketAcked(peer, *it);
 				it = peer.pendingAckQueue.erase(it);
 			}
 			else
@@ -376,9 +495,19 @@ namespace Nz
 		data.localSequence = 0;
 		data.remoteSequence = 0;
 		data.index = m_peers.size();
+		data.bytesInFlight = 0;
+		data.congestionWindow = 10 * CongestionSegmentSize;
+		data.slowStartThreshold = std::numeric_limits<std::size_t>::max();
+		data.lastCongestionTime = 0;
+		data.lastPacingTime = m_currentTime;
 		data.lastPacketTime = m_currentTime;
 		data.lastPingTime = m_currentTime;
+		data.lostPackets = 0;
+		data.minRoundTripTime = std::numeric_limits<UInt32>::max();
+		data.pacingCredit = data.congestionWindow / 2.0;
 		data.roundTripTime = 1'000'000; ///< Okay that's quite a lot
+		data.roundTripTimeVariance = 0;
+		data.sentPackets = 0;
 		data.state = state;
 
 		m_activeClients.UnboundedSet(data.index);
@@ -412,6 +541,53 @@ namespace Nz
 		EnqueuePacket(client, PacketPriority_Immediate, PacketReliability_Reliable, connectionAcceptedPacket);
 	}
 
+	/*!
+	* \brief Operation to do when a packet is acknowledged, updating the round trip time and the congestion window
+	*
+	* \param peer Data relative to the peer
+	* \param packet Acknowledged packet
+	*/
+
+	void RUdpConnection::OnPacketAcked(PeerData& peer, const PendingAckPacket& packet)
+	{
+		std::size_t packetSize = packet.data.GetSize();
+		peer.bytesInFlight -= std::min(peer.bytesInFlight, packetSize);
+
+		UInt32 sample = static_cast<UInt32>(m_currentTime - packet.timeSent);
+		if (peer.minRoundTripTime == std::numeric_limits<UInt32>::max())
+		{
+			peer.roundTripTime = sample;
+			peer.roundTripTimeVariance = sample / 2;
+		}
+		else
+		{
+			UInt32 deviation = (sample > peer.roundTripTime) ? sample - peer.roundTripTime : peer.roundTripTime - sample;
+			peer.roundTripTimeVariance = (3 * peer.roundTripTimeVariance + deviation) / 4;
+			peer.roundTripTime = (7 * static_cast<UInt64>(peer.roundTripTime) + sample) / 8;
+		}
+
+		peer.minRoundTripTime = std::min(peer.minRoundTripTime, sample);
+
+		UInt32 queuingDelay = sample - peer.minRoundTripTime;
+		if (peer.congestionWindow < peer.slowStartThreshold)
+		{
+			// Slow start ends as soon as the queue starts building up
+			if (queuingDelay > TargetQueuingDelay / 2)
+				peer.slowStartThreshold = peer.congestionWindow;
+			else
+				peer.congestionWindow += packetSize;
+		}
+		else
+		{
+			// Grows by up to a segment per round trip time, and shrinks as fast when the queuing delay exceeds the target
+			double offTarget = (static_cast<double>(TargetQueuingDelay) - queuingDelay) / TargetQueuingDelay;
+			double windowDelta = std::max(offTarget, -1.0) * packetSize * CongestionSegmentSize / peer.congestionWindow;
+
+			double congestionWindow = std::max(static_cast<double>(peer.congestionWindow) + windowDelta, 2.0 * CongestionSegmentSize);
+			peer.congestionWindow = static_cast<std::size_t>(congestionWindow);
+		}
+	}
+
 	/*!
 	* \brief Operation to do when a packet is lost
 	*
@@ -423,6 +599,17 @@ namespace Nz
 	{
 		//NazaraNotice(m_socket.GetBoundAddress().ToString() + ": Lost packet " + String::Number(packet.sequenceId));
 
+		peer.bytesInFlight -= std::min(peer.bytesInFlight, packet.data.GetSize());
+		peer.lostPackets++;
+
+		// Losses of the same window are a single congestion event
+		if (m_currentTime - peer.lastCongestionTime > peer.roundTripTime)
+		{
+			peer.congestionWindow = std::max(peer.congestionWindow / 2, 2 * CongestionSegmentSize);
+			peer.slowStartThreshold = peer.congestionWindow;
+			peer.lastCongestionTime = m_currentTime;
+		}
+
 		if (IsReliable(packet.reliability))
 			EnqueuePacketInternal(peer, packet.priority, packet.reliability, std::move(packet.data));
 	}
@@ -543,7 +730,7 @@ namespace Nz
 					NazaraNotice(m_socket.GetBoundAddress().ToString() + ": Received NetCode_Ping from " + peerIp.ToString());
 
 					NetPacket pongPacket(NetCode_Pong);
-					EnqueuePacket(peer, PacketPriority_Low, PacketReliability_Unreliable, pongPacket);
+					EnqueuePacket(peer, PacketPriority_Immediate, PacketReliability_Unreliable, pongPacket);
 					break;
 				}
 
@@ -603,7 +790,24 @@ namespace Nz
 		packet.data << remoteSequence;
 		packet.data << previousAcks;
 
-		m_socket.SendPacket(peer.address, packet.data);
+		std::size_t size;
+		const void* datagramData = packet.data.OnSend(&size);
+
+		NetBuffer buffer;
+		buffer.data = const_cast<void*>(datagramData);
+		buffer.dataLength = size;
+		m_queuedBuffers.push_back(buffer);
+
+		NetDatagram datagram;
+		datagram.address = peer.address;
+		datagram.buffers = nullptr;
+		datagram.bufferCount = 1;
+		datagram.dataLength = 0;
+		m_queuedDatagrams.push_back(datagram);
+
+		peer.bytesInFlight += size;
+		peer.pacingCredit -= static_cast<double>(size);
+		peer.sentPackets++;
 
 		PendingAckPacket pendingAckPacket;
 		pendingAckPacket.data = std::move(packet.data);
@@ -615,6 +819,25 @@ namespace Nz
 		peer.pendingAckQueue.emplace_back(std::move(pendingAckPacket));
 	}
 
+	/*!
+	* \brief Gives a peer the credit of the time elapsed since its last update, at a rate of a congestion window per round trip time
+	*
+	* \param peer Data relative to the peer
+	*/
+
+	void RUdpConnection::UpdatePacingCredit(PeerData& peer)
+	{
+		UInt64 elapsedTime = m_currentTime - peer.lastPacingTime;
+		peer.lastPacingTime = m_currentTime;
+
+		// Sending slightly faster than the window lets the window, not the pacing, limit the rate
+		double pacingRate = 1.25 * peer.congestionWindow / std::max(peer.roundTripTime, 1U);
+
+		// Credit isn't accumulated while idle, which would allow a burst of a whole window
+		double maxCredit = std::max(peer.congestionWindow / 2.0, 2.0 * CongestionSegmentSize);
+		peer.pacingCredit = std::min(peer.pacingCredit + pacingRate * elapsedTime, maxCredit);
+	}
+
 	/*!
 	* \brief Initializes the RUdpConnection class
 	* \return true
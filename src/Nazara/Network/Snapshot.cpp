@@ -0,0 +1,146 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/Snapshot.hpp>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup network
+	* \class Nz::Snapshot
+	* \brief Network class holding the replicated state of entities at a point in time
+	*
+	* Entities are identified by an integer and hold one value per field of the schema.
+	* Snapshots are meant to be sent through a SnapshotEncoder, which only writes what changed since a baseline.
+	*
+	* \see SnapshotEncoder
+	* \see SnapshotSchema
+	*/
+
+	/*!
+	* \brief Adds an entity to the snapshot, with all its values set to zero
+	* \return Index of the entity
+	*
+	* \param entityId Identifier of the entity
+	*
+	* \remark If the entity is already part of the snapshot, its values are left untouched
+	*/
+	std::size_t Snapshot::AddEntity(UInt32 entityId)
+	{
+		std::size_t fieldCount = m_schema->GetFieldCount();
+
+		auto it = std::lower_bound(m_entityIds.begin(), m_entityIds.end(), entityId);
+		std::size_t entityIndex = std::distance(m_entityIds.begin(), it);
+		if (it != m_entityIds.end() && *it == entityId)
+			return entityIndex;
+
+		m_entityIds.insert(it, entityId);
+		m_values.insert(m_values.begin() + entityIndex * fieldCount, fieldCount, 0);
+
+		return entityIndex;
+	}
+
+	/*!
+	* \brief Finds the index of an entity
+	* \return Index of the entity or InvalidIndex if the entity is not part of the snapshot
+	*
+	* \param entityId Identifier of the entity
+	*/
+	std::size_t Snapshot::FindEntity(UInt32 entityId) const
+	{
+		auto it = std::lower_bound(m_entityIds.begin(), m_entityIds.end(), entityId);
+		if (it == m_entityIds.end() || *it != entityId)
+			return InvalidIndex;
+
+		return std::distance(m_entityIds.begin(), it);
+	}
+
+	/*!
+	* \brief Gets a floating point value of an entity
+	* \return Dequantized value, or the field minimum value if the entity is not part of the snapshot
+	*
+	* \param entityId Identifier of the entity
+	* \param fieldIndex Index of a floating point field
+	*/
+	float Snapshot::GetFloat(UInt32 entityId, std::size_t fieldIndex) const
+	{
+		return m_schema->DequantizeFloat(fieldIndex, GetValue(entityId, fieldIndex));
+	}
+
+	/*!
+	* \brief Gets a raw value of an entity
+	* \return Value of the field (quantized for floating point fields), or zero if the entity is not part of the snapshot
+	*
+	* \param entityId Identifier of the entity
+	* \param fieldIndex Index of the field
+	*/
+	Int64 Snapshot::GetValue(UInt32 entityId, std::size_t fieldIndex) const
+	{
+		NazaraAssert(fieldIndex < m_schema->GetFieldCount(), "Field index out of range");
+
+		std::size_t entityIndex = FindEntity(entityId);
+		if (entityIndex == InvalidIndex)
+			return 0;
+
+		return GetEntityValues(entityIndex)[fieldIndex];
+	}
+
+	/*!
+	* \brief Removes an entity from the snapshot
+	* \return true if the entity was part of the snapshot
+	*
+	* \param entityId Identifier of the entity
+	*/
+	bool Snapshot::RemoveEntity(UInt32 entityId)
+	{
+		std::size_t entityIndex = FindEntity(entityId);
+		if (entityIndex == InvalidIndex)
+			return false;
+
+		std::size_t fieldCount = m_schema->GetFieldCount();
+
+		m_entityIds.erase(m_entityIds.begin() + entityIndex);
+		m_values.erase(m_values.begin() + entityIndex * fieldCount, m_values.begin() + (entityIndex + 1) * fieldCount);
+
+		return true;
+	}
+
+	/*!
+	* \brief Sets a floating point value of an entity, adding it if required
+	*
+	* \param entityId Identifier of the entity
+	* \param fieldIndex Index of a floating point field
+	* \param value Value to quantize and store
+	*/
+	void Snapshot::SetFloat(UInt32 entityId, std::size_t fieldIndex, float value)
+	{
+		SetValue(entityId, fieldIndex, m_schema->QuantizeFloat(fieldIndex, value));
+	}
+
+	/*!
+	* \brief Sets a raw value of an entity, adding it if required
+	*
+	* \param entityId Identifier of the entity
+	* \param fieldIndex Index of the field
+	* \param value Value to store (quantized for floating point fields)
+	*/
+	void Snapshot::SetValue(UInt32 entityId, std::size_t fieldIndex, Int64 value)
+	{
+		NazaraAssert(fieldIndex < m_schema->GetFieldCount(), "Field index out of range");
+
+		GetEntityValues(AddEntity(entityId))[fieldIndex] = value;
+	}
+
+	/*!
+	* \brief Checks whether two snapshots hold the same entities with the same values
+	* \return true if they're equal
+	*
+	* \param snapshot Other snapshot
+	*/
+	bool Snapshot::operator==(const Snapshot& snapshot) const
+	{
+		return m_entityIds == snapshot.m_entityIds && m_values == snapshot.m_values;
+	}
+}
@@ -0,0 +1,152 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/SnapshotDecoder.hpp>
+#include <Nazara/Core/ByteStream.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup network
+	* \class Nz::SnapshotDecoder
+	* \brief Network class reading snapshots written by a SnapshotEncoder
+	*
+	* Decoded snapshots are kept for a while, as the encoder may use any of them as a baseline once acknowledged.
+	* Snapshots may be decoded out of order or be lost, as long as their baseline is still known.
+	*
+	* \see SnapshotEncoder
+	*/
+
+	/*!
+	* \brief Constructs a SnapshotDecoder object
+	*
+	* \param schema Schema of the snapshots to decode, which must outlive the decoder
+	* \param historySize Number of decoded snapshots kept as potential baselines, should match the encoder one
+	*/
+	SnapshotDecoder::SnapshotDecoder(const SnapshotSchema& schema, std::size_t historySize) :
+	m_history(historySize, HistoryEntry{ Snapshot(schema), 0 }),
+	m_emptySnapshot(schema),
+	m_lastSequence(0)
+	{
+		NazaraAssert(historySize > 0, "History size must be over zero");
+	}
+
+	/*!
+	* \brief Decodes a snapshot
+	* \return true if the snapshot was decoded, false if the data is corrupted or if its baseline is unknown
+	*
+	* \param stream Stream to read from
+	* \param snapshot Pointer to the snapshot which will hold the result, must share the schema of the decoder
+	* \param sequence Optional pointer to an integer which will hold the sequence number of the snapshot
+	*/
+	bool SnapshotDecoder::Decode(ByteStream& stream, Snapshot* snapshot, UInt32* sequence)
+	{
+		NazaraAssert(snapshot, "Invalid snapshot");
+
+		const SnapshotSchema& schema = m_emptySnapshot.GetSchema();
+		NazaraAssert(snapshot->GetSchema().GetFieldCount() == schema.GetFieldCount(), "Snapshot schema doesn't match decoder schema");
+
+		UInt64 snapshotSequence;
+		UInt64 baselineOffset;
+		if (!stream.ReadBits(&snapshotSequence, 32) || !SnapshotSchema::ReadVarInt(stream, &baselineOffset))
+			return false;
+
+		if (snapshotSequence == 0 || baselineOffset > snapshotSequence)
+			return false;
+
+		if (baselineOffset != 0)
+		{
+			UInt32 baselineSequence = static_cast<UInt32>(snapshotSequence - baselineOffset);
+
+			const HistoryEntry& baselineEntry = m_history[baselineSequence % m_history.size()];
+			if (baselineEntry.sequence != baselineSequence)
+			{
+				NazaraWarning("Snapshot #" + String::Number(snapshotSequence) + " baseline (#" + String::Number(baselineSequence) + ") is unknown");
+				return false;
+			}
+
+			*snapshot = baselineEntry.snapshot;
+		}
+		else
+			snapshot->Clear();
+
+		UInt64 removedCount;
+		if (!SnapshotSchema::ReadVarInt(stream, &removedCount))
+			return false;
+
+		UInt64 entityId = 0;
+		for (UInt64 i = 0; i < removedCount; ++i)
+		{
+			UInt64 idDelta;
+			if (!SnapshotSchema::ReadVarInt(stream, &idDelta))
+				return false;
+
+			entityId += idDelta;
+			snapshot->RemoveEntity(static_cast<UInt32>(entityId));
+		}
+
+		UInt64 changedCount;
+		if (!SnapshotSchema::ReadVarInt(stream, &changedCount))
+			return false;
+
+		std::size_t fieldCount = schema.GetFieldCount();
+
+		entityId = 0;
+		for (UInt64 i = 0; i < changedCount; ++i)
+		{
+			UInt64 idDelta;
+			if (!SnapshotSchema::ReadVarInt(stream, &idDelta))
+				return false;
+
+			entityId += idDelta;
+
+			// The snapshot starts as a copy of the baseline, new entities start zeroed
+			Int64* values = snapshot->GetEntityValues(snapshot->AddEntity(static_cast<UInt32>(entityId)));
+			for (std::size_t fieldIndex = 0; fieldIndex < fieldCount; ++fieldIndex)
+			{
+				UInt64 hasChanged;
+				if (!stream.ReadBits(&hasChanged, 1))
+					return false;
+
+				if (hasChanged && !schema.ReadField(stream, fieldIndex, values[fieldIndex], &values[fieldIndex]))
+					return false;
+			}
+		}
+
+		UInt32 decodedSequence = static_cast<UInt32>(snapshotSequence);
+
+		HistoryEntry& entry = m_history[decodedSequence % m_history.size()];
+		if (entry.sequence < decodedSequence)
+		{
+			entry.snapshot = *snapshot;
+			entry.sequence = decodedSequence;
+		}
+
+		if (decodedSequence > m_lastSequence)
+			m_lastSequence = decodedSequence;
+
+		if (sequence)
+			*sequence = decodedSequence;
+
+		return true;
+	}
+
+	/*!
+	* \brief Forgets every snapshot
+	*
+	* This should be called along with SnapshotEncoder::Reset on the remote side (for example on reconnection).
+	*/
+	void SnapshotDecoder::Reset()
+	{
+		for (HistoryEntry& entry : m_history)
+		{
+			entry.snapshot.Clear();
+			entry.sequence = 0;
+		}
+
+		m_lastSequence = 0;
+	}
+}
@@ -0,0 +1,200 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/SnapshotEncoder.hpp>
+#include <Nazara/Core/ByteStream.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup network
+	* \class Nz::SnapshotEncoder
+	* \brief Network class writing snapshots as differences from the last snapshot acknowledged by the remote decoder
+	*
+	* Every encoded snapshot gets a sequence number, and is kept for a while so it can be used as a baseline.
+	* Once the remote SnapshotDecoder tells (through any channel, usually the packets it sends back) which snapshot it received,
+	* calling Acknowledge makes the next snapshots only carry entities which were added, removed or changed since that one.
+	*
+	* Snapshots can be sent unreliably: a lost snapshot is never used as a baseline since it is never acknowledged.
+	* Until a snapshot is acknowledged (or when the acknowledged one is too old), snapshots are written in full.
+	*
+	* \see SnapshotDecoder
+	*/
+
+	/*!
+	* \brief Constructs a SnapshotEncoder object
+	*
+	* \param schema Schema of the snapshots to encode, which must outlive the encoder
+	* \param historySize Number of sent snapshots kept as potential baselines, should match the decoder one
+	*/
+	SnapshotEncoder::SnapshotEncoder(const SnapshotSchema& schema, std::size_t historySize) :
+	m_history(historySize, HistoryEntry{ Snapshot(schema), 0 }),
+	m_emptySnapshot(schema),
+	m_acknowledgedSequence(0),
+	m_nextSequence(1)
+	{
+		NazaraAssert(historySize > 0, "History size must be over zero");
+	}
+
+	/*!
+	* \brief Tells the encoder the remote decoder received a snapshot
+	*
+	* Acknowledging an older snapshot than the current acknowledged one does nothing.
+	*
+	* \param sequence Sequence number of the received snapshot
+	*/
+	void SnapshotEncoder::Acknowledge(UInt32 sequence)
+	{
+		if (sequence > m_acknowledgedSequence && sequence < m_nextSequence)
+			m_acknowledgedSequence = sequence;
+	}
+
+	/*!
+	* \brief Encodes a snapshot against the current baseline
+	* \return true if the snapshot was written
+	*
+	* The snapshot is written on a bit level and the stream bits are flushed at the end.
+	*
+	* \param snapshot Snapshot to encode, must share the schema of the encoder
+	* \param stream Stream to write to
+	* \param sequence Optional pointer to an integer which will hold the sequence number of the snapshot
+	*
+	* \see GetBaselineSequence
+	*/
+	bool SnapshotEncoder::Encode(const Snapshot& snapshot, ByteStream& stream, UInt32* sequence)
+	{
+		const SnapshotSchema& schema = m_emptySnapshot.GetSchema();
+		NazaraAssert(snapshot.GetSchema().GetFieldCount() == schema.GetFieldCount(), "Snapshot schema doesn't match encoder schema");
+
+		UInt32 baselineSequence = GetBaselineSequence();
+		const Snapshot& baseline = (baselineSequence != 0) ? m_history[baselineSequence % m_history.size()].snapshot : m_emptySnapshot;
+
+		std::size_t fieldCount = schema.GetFieldCount();
+
+		// Both entity lists are sorted, find added/changed and removed entities in one pass
+		m_changedEntities.clear();
+		m_removedEntities.clear();
+
+		std::size_t baselineIndex = 0;
+		for (std::size_t entityIndex = 0; entityIndex < snapshot.GetEntityCount(); ++entityIndex)
+		{
+			UInt32 entityId = snapshot.GetEntityId(entityIndex);
+			for (; baselineIndex < baseline.GetEntityCount() && baseline.GetEntityId(baselineIndex) < entityId; ++baselineIndex)
+				m_removedEntities.push_back(baseline.GetEntityId(baselineIndex));
+
+			if (baselineIndex < baseline.GetEntityCount() && baseline.GetEntityId(baselineIndex) == entityId)
+			{
+				if (!std::equal(snapshot.GetEntityValues(entityIndex), snapshot.GetEntityValues(entityIndex) + fieldCount, baseline.GetEntityValues(baselineIndex)))
+					m_changedEntities.push_back(entityIndex);
+
+				baselineIndex++;
+			}
+			else
+				m_changedEntities.push_back(entityIndex);
+		}
+
+		for (; baselineIndex < baseline.GetEntityCount(); ++baselineIndex)
+			m_removedEntities.push_back(baseline.GetEntityId(baselineIndex));
+
+		UInt32 snapshotSequence = m_nextSequence;
+
+		if (!stream.WriteBits(snapshotSequence, 32))
+			return false;
+
+		if (!SnapshotSchema::WriteVarInt(stream, (baselineSequence != 0) ? snapshotSequence - baselineSequence : 0))
+			return false;
+
+		// Identifiers are sorted, only write the difference with the previous one
+		if (!SnapshotSchema::WriteVarInt(stream, m_removedEntities.size()))
+			return false;
+
+		UInt32 previousId = 0;
+		for (UInt32 entityId : m_removedEntities)
+		{
+			if (!SnapshotSchema::WriteVarInt(stream, entityId - previousId))
+				return false;
+
+			previousId = entityId;
+		}
+
+		if (!SnapshotSchema::WriteVarInt(stream, m_changedEntities.size()))
+			return false;
+
+		previousId = 0;
+		for (std::size_t entityIndex : m_changedEntities)
+		{
+			UInt32 entityId = snapshot.GetEntityId(entityIndex);
+			if (!SnapshotSchema::WriteVarInt(stream, entityId - previousId))
+				return false;
+
+			previousId = entityId;
+
+			// New entities are written against zeroed values
+			std::size_t baselineEntityIndex = baseline.FindEntity(entityId);
+			const Int64* baselineValues = (baselineEntityIndex != Snapshot::InvalidIndex) ? baseline.GetEntityValues(baselineEntityIndex) : nullptr;
+			const Int64* values = snapshot.GetEntityValues(entityIndex);
+
+			for (std::size_t fieldIndex = 0; fieldIndex < fieldCount; ++fieldIndex)
+			{
+				Int64 baselineValue = (baselineValues) ? baselineValues[fieldIndex] : 0;
+				bool hasChanged = values[fieldIndex] != baselineValue;
+
+				if (!stream.WriteBits(hasChanged, 1))
+					return false;
+
+				if (hasChanged && !schema.WriteField(stream, fieldIndex, baselineValue, values[fieldIndex]))
+					return false;
+			}
+		}
+
+		if (!stream.FlushBits())
+			return false;
+
+		HistoryEntry& entry = m_history[snapshotSequence % m_history.size()];
+		entry.snapshot = snapshot;
+		entry.sequence = snapshotSequence;
+
+		m_nextSequence++;
+
+		if (sequence)
+			*sequence = snapshotSequence;
+
+		return true;
+	}
+
+	/*!
+	* \brief Gets the sequence number of the snapshot the next one will be encoded against
+	* \return Sequence number of the baseline, zero if the next snapshot will be written in full
+	*/
+	UInt32 SnapshotEncoder::GetBaselineSequence() const
+	{
+		if (m_acknowledgedSequence == 0)
+			return 0;
+
+		// The acknowledged snapshot may have been overwritten by newer ones
+		if (m_history[m_acknowledgedSequence % m_history.size()].sequence != m_acknowledgedSequence)
+			return 0;
+
+		return m_acknowledgedSequence;
+	}
+
+	/*!
+	* \brief Forgets every snapshot, the next one will be written in full
+	*
+	* This should be called when the remote decoder is reset (for example on reconnection).
+	*/
+	void SnapshotEncoder::Reset()
+	{
+		for (HistoryEntry& entry : m_history)
+		{
+			entry.snapshot.Clear();
+			entry.sequence = 0;
+		}
+
+		m_acknowledgedSequence = 0;
+		m_nextSequence = 1;
+	}
+}
@@ -0,0 +1,290 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/SnapshotSchema.hpp>
+#include <Nazara/Core/ByteStream.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Math/Algorithm.hpp>
+#include <cmath>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		constexpr UInt8 VarIntGroupBits = 4; //< Three bits of value and a continuation bit, most deltas fit in one or two groups
+
+		std::size_t GetVarIntBitCount(UInt64 value)
+		{
+			std::size_t groupCount = 1;
+			while (value >>= (VarIntGroupBits - 1))
+				groupCount++;
+
+			return groupCount * VarIntGroupBits;
+		}
+
+		Int64 ZigZagDecode(UInt64 value)
+		{
+			return static_cast<Int64>(value >> 1) ^ -static_cast<Int64>(value & 1);
+		}
+
+		UInt64 ZigZagEncode(Int64 value)
+		{
+			return (static_cast<UInt64>(value) << 1) ^ static_cast<UInt64>(value >> 63);
+		}
+	}
+
+	/*!
+	* \ingroup network
+	* \class Nz::SnapshotSchema
+	* \brief Network class describing the fields of the entities replicated by snapshots
+	*
+	* Every entity of a snapshot holds one value per field of its schema, stored as an integer.
+	* Floating point fields are quantized so the encoder and the decoder work on the exact same values.
+	*
+	* \see Snapshot
+	* \see SnapshotDecoder
+	* \see SnapshotEncoder
+	*/
+
+	/*!
+	* \brief Adds a field holding a raw value
+	* \return Index of the field
+	*
+	* Such fields are written as is when they change, they suit booleans, enumerations or flags.
+	*
+	* \param bitCount Number of bits of the value, between 1 and 64
+	*/
+	std::size_t SnapshotSchema::AddBits(UInt8 bitCount)
+	{
+		NazaraAssert(bitCount >= 1 && bitCount <= 64, "Bit count must be between 1 and 64");
+
+		m_fields.push_back({ SnapshotFieldType_Bits, bitCount, 0.f, 0.f });
+		return m_fields.size() - 1;
+	}
+
+	/*!
+	* \brief Adds a floating point field quantized on a fixed number of bits
+	* \return Index of the field
+	*
+	* Values out of the range are clamped, precision is (maxValue - minValue) / (2^bitCount - 1).
+	*
+	* When a value changes, the shortest of its difference with the baseline and its quantized value is written.
+	*
+	* \param minValue Minimum value this field can hold
+	* \param maxValue Maximum value this field can hold
+	* \param bitCount Number of bits of the quantized value, between 1 and 32
+	*/
+	std::size_t SnapshotSchema::AddFloat(float minValue, float maxValue, UInt8 bitCount)
+	{
+		NazaraAssert(bitCount >= 1 && bitCount <= 32, "Bit count must be between 1 and 32");
+		NazaraAssert(minValue < maxValue, "Minimum value must be lower than maximum value");
+
+		m_fields.push_back({ SnapshotFieldType_Float, bitCount, minValue, maxValue });
+		return m_fields.size() - 1;
+	}
+
+	/*!
+	* \brief Adds a signed integer field
+	* \return Index of the field
+	*
+	* Such fields are written as a variable-length difference from the baseline, small changes take a few bits.
+	*/
+	std::size_t SnapshotSchema::AddInteger()
+	{
+		m_fields.push_back({ SnapshotFieldType_Integer, 64, 0.f, 0.f });
+		return m_fields.size() - 1;
+	}
+
+	/*!
+	* \brief Converts a quantized value back to a floating point value
+	* \return Floating point value
+	*
+	* \param fieldIndex Index of a floating point field
+	* \param value Quantized value
+	*
+	* \see QuantizeFloat
+	*/
+	float SnapshotSchema::DequantizeFloat(std::size_t fieldIndex, Int64 value) const
+	{
+		const Field& field = GetField(fieldIndex);
+		NazaraAssert(field.type == SnapshotFieldType_Float, "Field is not a floating point field");
+
+		UInt64 maxQuantized = (UInt64(1) << field.bitCount) - 1;
+		return field.minValue + (field.maxValue - field.minValue) * static_cast<float>(static_cast<double>(value) / maxQuantized);
+	}
+
+	/*!
+	* \brief Quantizes a floating point value
+	* \return Quantized value, between 0 and 2^bitCount - 1
+	*
+	* \param fieldIndex Index of a floating point field
+	* \param value Value to quantize, clamped to the range of the field
+	*
+	* \see DequantizeFloat
+	*/
+	Int64 SnapshotSchema::QuantizeFloat(std::size_t fieldIndex, float value) const
+	{
+		const Field& field = GetField(fieldIndex);
+		NazaraAssert(field.type == SnapshotFieldType_Float, "Field is not a floating point field");
+
+		UInt64 maxQuantized = (UInt64(1) << field.bitCount) - 1;
+		double ratio = (Clamp(value, field.minValue, field.maxValue) - field.minValue) / double(field.maxValue - field.minValue);
+
+		return static_cast<Int64>(std::llround(ratio * maxQuantized));
+	}
+
+	/*!
+	* \brief Reads a field value written by WriteField
+	* \return true if the value was read
+	*
+	* \param stream Stream to read from
+	* \param fieldIndex Index of the field
+	* \param baseline Value of the field in the baseline the value was written against
+	* \param value Pointer to the value to fill
+	*/
+	bool SnapshotSchema::ReadField(ByteStream& stream, std::size_t fieldIndex, Int64 baseline, Int64* value) const
+	{
+		NazaraAssert(value, "Invalid value");
+
+		const Field& field = GetField(fieldIndex);
+
+		UInt64 bits;
+		switch (field.type)
+		{
+			case SnapshotFieldType_Bits:
+			{
+				if (!stream.ReadBits(&bits, field.bitCount))
+					return false;
+
+				*value = static_cast<Int64>(bits);
+				return true;
+			}
+
+			case SnapshotFieldType_Float:
+			{
+				UInt64 isRaw;
+				if (!stream.ReadBits(&isRaw, 1))
+					return false;
+
+				if (isRaw)
+				{
+					if (!stream.ReadBits(&bits, field.bitCount))
+						return false;
+
+					*value = static_cast<Int64>(bits);
+					return true;
+				}
+
+				break;
+			}
+
+			case SnapshotFieldType_Integer:
+				break;
+		}
+
+		if (!ReadVarInt(stream, &bits))
+			return false;
+
+		*value = static_cast<Int64>(static_cast<UInt64>(baseline) + static_cast<UInt64>(ZigZagDecode(bits)));
+		return true;
+	}
+
+	/*!
+	* \brief Writes a field value against a baseline value
+	* \return true if the value was written
+	*
+	* \param stream Stream to write to
+	* \param fieldIndex Index of the field
+	* \param baseline Value of the field in the baseline (zero for new entities)
+	* \param value Value to write
+	*/
+	bool SnapshotSchema::WriteField(ByteStream& stream, std::size_t fieldIndex, Int64 baseline, Int64 value) const
+	{
+		const Field& field = GetField(fieldIndex);
+
+		// Differences are computed with unsigned arithmetic, wrapping around is fine as long as both sides do it
+		UInt64 delta = ZigZagEncode(static_cast<Int64>(static_cast<UInt64>(value) - static_cast<UInt64>(baseline)));
+
+		switch (field.type)
+		{
+			case SnapshotFieldType_Bits:
+				return stream.WriteBits(static_cast<UInt64>(value), field.bitCount);
+
+			case SnapshotFieldType_Float:
+			{
+				bool isRaw = GetVarIntBitCount(delta) > field.bitCount;
+				if (!stream.WriteBits(isRaw, 1))
+					return false;
+
+				if (isRaw)
+					return stream.WriteBits(static_cast<UInt64>(value), field.bitCount);
+
+				break;
+			}
+
+			case SnapshotFieldType_Integer:
+				break;
+		}
+
+		return WriteVarInt(stream, delta);
+	}
+
+	/*!
+	* \brief Reads an unsigned integer written by WriteVarInt
+	* \return true if the integer was read
+	*
+	* \param stream Stream to read from
+	* \param value Pointer to the integer to fill
+	*/
+	bool SnapshotSchema::ReadVarInt(ByteStream& stream, UInt64* value)
+	{
+		NazaraAssert(value, "Invalid value");
+
+		UInt64 result = 0;
+		for (unsigned int shift = 0; shift < 64; shift += VarIntGroupBits - 1)
+		{
+			UInt64 group;
+			if (!stream.ReadBits(&group, VarIntGroupBits))
+				return false;
+
+			result |= (group >> 1) << shift;
+			if ((group & 1) == 0)
+			{
+				*value = result;
+				return true;
+			}
+		}
+
+		// Too many groups, corrupted data
+		return false;
+	}
+
+	/*!
+	* \brief Writes an unsigned integer on a variable number of bits
+	* \return true if the integer was written
+	*
+	* The value is split in groups of three bits, each one followed by a bit telling if another group follows.
+	*
+	* \param stream Stream to write to
+	* \param value Integer to write
+	*/
+	bool SnapshotSchema::WriteVarInt(ByteStream& stream, UInt64 value)
+	{
+		do
+		{
+			UInt64 group = (value & ((1U << (VarIntGroupBits - 1)) - 1)) << 1;
+			value >>= VarIntGroupBits - 1;
+
+			if (value != 0)
+				group |= 1;
+
+			if (!stream.WriteBits(group, VarIntGroupBits))
+				return false;
+		}
+		while (value != 0);
+
+		return true;
+	}
+}
@@ -0,0 +1,143 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/SocketCompletionQueue.hpp>
+#include <Nazara/Core/Error.hpp>
+
+#if defined(NAZARA_PLATFORM_WINDOWS)
+#include <Nazara/Network/Win32/SocketCompletionQueueImpl.hpp>
+#elif defined(NAZARA_PLATFORM_LINUX)
+#include <Nazara/Network/Linux/SocketCompletionQueueImpl.hpp>
+#elif defined(NAZARA_PLATFORM_POSIX)
+#include <Nazara/Network/Posix/SocketCompletionQueueImpl.hpp>
+#else
+#error Missing implementation: SocketCompletionQueue
+#endif
+
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup network
+	* \class Nz::SocketCompletionQueue
+	* \brief Network class allowing an application to run socket operations asynchronously and to be notified of their completion
+	*
+	* Unlike SocketPoller which tells which sockets are ready, operations are started with TcpClient::AsyncReceive, TcpClient::AsyncSend or TcpServer::AsyncAccept
+	* and carried by the system, Wait then calls the callback of every completed operation.
+	* An idle socket only costs its pending operation, which makes this suitable for servers keeping a lot of mostly idle connections.
+	*
+	* It relies on io_uring on Linux and I/O completion ports on Windows, other systems emulate it using poll.
+	*
+	* \remark Buffers given to an operation must stay valid until its callback is called (or the queue is destroyed)
+	* \remark Pending operations of a socket must be completed or cancelled (see CancelOperations) before the socket is closed
+	* \remark This class is not thread-safe, callbacks are called by the thread calling Wait
+	*/
+
+	/*!
+	* \brief Constructs a SocketCompletionQueue object
+	*
+	* \param queueSize Number of operations which can be started between two Wait calls without requiring an extra system call
+	*
+	* \remark Produces a NazaraError if the system does not support completion queues (for example when io_uring is disabled), see IsValid
+	*/
+	SocketCompletionQueue::SocketCompletionQueue(std::size_t queueSize) :
+	m_impl(new SocketCompletionQueueImpl(queueSize))
+	{
+		if (!m_impl->IsValid())
+			NazaraError("Failed to create socket completion queue");
+	}
+
+	/*!
+	* \brief Destructs the SocketCompletionQueue
+	*
+	* \remark Pending operations are cancelled, their callbacks are not called
+	*/
+	SocketCompletionQueue::~SocketCompletionQueue()
+	{
+		delete m_impl;
+	}
+
+	/*!
+	* \brief Cancels every pending operation of a socket
+	*
+	* Callbacks of cancelled operations are called by a following Wait with the SocketError_Interrupted error,
+	* operations which completed meanwhile report their result as usual.
+	*
+	* \param socket Socket whose operations should be cancelled
+	*/
+	void SocketCompletionQueue::CancelOperations(AbstractSocket& socket)
+	{
+		NazaraAssert(IsValid(), "Invalid completion queue");
+
+		m_impl->CancelOperations(socket.GetNativeHandle());
+	}
+
+	/*!
+	* \brief Gets the number of started operations whose callback was not called yet
+	* \return Pending operation count
+	*/
+	std::size_t SocketCompletionQueue::GetPendingOperationCount() const
+	{
+		NazaraAssert(IsValid(), "Invalid completion queue");
+
+		return m_impl->GetPendingOperationCount();
+	}
+
+	/*!
+	* \brief Checks whether the completion queue could be created
+	* \return true If operations can be started
+	*/
+	bool SocketCompletionQueue::IsValid() const
+	{
+		return m_impl && m_impl->IsValid();
+	}
+
+	/*!
+	* \brief Waits until at least one operation completes and calls the callbacks of completed operations
+	* \return Number of callbacks called
+	*
+	* Operations started since the previous Wait are handed to the system at once.
+	*
+	* \param msTimeout Maximum time to wait in milliseconds, 0 will returns immediately and -1 will block indefinitely
+	*
+	* \remark Callbacks may start new operations, but must not call Wait
+	*/
+	std::size_t SocketCompletionQueue::Wait(int msTimeout)
+	{
+		NazaraAssert(IsValid(), "Invalid completion queue");
+
+		SocketError error;
+
+		int completedOperations = m_impl->Wait(msTimeout, &error);
+		if (error != SocketError_NoError)
+		{
+			NazaraError("SocketCompletionQueue encountered an error (code: 0x" + String::Number(error, 16) + ')');
+			return 0;
+		}
+
+		return static_cast<std::size_t>(completedOperations);
+	}
+
+	bool SocketCompletionQueue::Accept(SocketHandle listenHandle, NetProtocol protocol, AcceptCallback callback, SocketError* error)
+	{
+		NazaraAssert(IsValid(), "Invalid completion queue");
+
+		return m_impl->Accept(listenHandle, protocol, std::move(callback), error);
+	}
+
+	bool SocketCompletionQueue::Receive(SocketHandle handle, void* buffer, std::size_t size, Callback callback, SocketError* error)
+	{
+		NazaraAssert(IsValid(), "Invalid completion queue");
+
+		return m_impl->Receive(handle, buffer, size, std::move(callback), error);
+	}
+
+	bool SocketCompletionQueue::Send(SocketHandle handle, const void* buffer, std::size_t size, Callback callback, SocketError* error)
+	{
+		NazaraAssert(IsValid(), "Invalid completion queue");
+
+		return m_impl->Send(handle, buffer, size, std::move(callback), error);
+	}
+}
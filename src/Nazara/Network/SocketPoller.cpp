@@ -54,6 +54,24 @@ namespace Nz
 		m_impl->Clear();
 	}
 
+	/*!
+	* \brief Gets the sockets which were found ready by the last Wait operation
+	*
+	* Every ready socket appears once, with the events it is ready for and the userdata given when it was registered.
+	* This allows an application to dispatch events without querying every socket it registered.
+	*
+	* \return Sockets found ready by the last Wait call, which stays valid until the next call to Wait, Clear or UnregisterSocket
+	*
+	* \remark Unregistering a socket removes it from this array, without changing the order of the other events
+	*
+	* \see RegisterSocket
+	* \see Wait
+	*/
+	const std::vector<SocketPoller::Event>& SocketPoller::GetReadyEvents() const
+	{
+		return m_impl->GetReadyEvents();
+	}
+
 	/*!
 	* \brief Checks if a specific socket is ready to read data
 	*
@@ -125,22 +143,29 @@ namespace Nz
 	*
 	* It is possible for this function to fail if too many sockets are registered in the SocketPoller, the maximum number of socket handled limit is OS-dependent.
 	*
+	* In edge-triggered mode, a socket is only reported when its state changes (for example when new data arrives),
+	* the application has to read (or write) until the operation would block before it gets reported again.
+	*
 	* \remark It is an error to register a socket twice in the same SocketPoller.
 	* \remark The socket should not be freed while it is registered in the SocketPooler.
+	* \remark Edge-triggered mode is only supported on Linux (epoll), other platforms fall back to level-triggered mode.
 	*
 	* \param socket Reference to the socket to register
 	* \param eventFlags Socket events to watch
+	* \param userdata Pointer given back by GetReadyEvents when this socket is ready
+	* \param mode Whether the socket should be reported as long as it is ready (level-triggered) or once each time it becomes ready (edge-triggered)
 	*
 	* \return True if the socket is registered, false otherwise
 	*
+	* \see GetReadyEvents
 	* \see IsRegistered
 	* \see UnregisterSocket
 	*/
-	bool SocketPoller::RegisterSocket(AbstractSocket& socket, SocketPollEventFlags eventFlags)
+	bool SocketPoller::RegisterSocket(AbstractSocket& socket, SocketPollEventFlags eventFlags, void* userdata, SocketPollMode mode)
 	{
 		NazaraAssert(!IsRegistered(socket), "This socket is already registered in this SocketPoller");
 
-		return m_impl->RegisterSocket(socket.GetNativeHandle(), eventFlags);
+		return m_impl->RegisterSocket(socket.GetNativeHandle(), eventFlags, mode, &socket, userdata);
 	}
 
 	/*!
@@ -168,7 +193,10 @@ namespace Nz
 	* \brief Wait until any registered socket switches to a ready state.
 	*
 	* Waits a specific/undetermined amount of time until at least one socket part of the SocketPoller becomes ready.
-	* To query the ready state of the registered socket, use the IsReadyToRead or IsReadyToWrite functions.
+	* To query the ready state of the registered socket, use the IsReadyToRead or IsReadyToWrite functions,
+	* or go through the ready sockets with GetReadyEvents.
+	*
+	* Waiting doesn't allocate memory once the poller has seen as many ready sockets as it will get.
 	*
 	* \param msTimeout Maximum time to wait in milliseconds, 0 will returns immediately and -1 will block indefinitely
 	*
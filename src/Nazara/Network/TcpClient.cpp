@@ -5,8 +5,12 @@
 #include <Nazara/Network/TcpClient.hpp>
 #include <Nazara/Core/CallOnExit.hpp>
 #include <Nazara/Core/Error.hpp>
-#include <limits>
+#include <Nazara/Network/NetBuffer.hpp>
 #include <Nazara/Network/NetPacket.hpp>
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
 
 #if defined(NAZARA_PLATFORM_WINDOWS)
 #include <Nazara/Network/Win32/SocketImpl.hpp>
@@ -20,12 +24,78 @@
 
 namespace Nz
 {
+	namespace
+	{
+		// Size of the reads made by ReceivePacket, the buffer grows if a single packet is bigger
+		constexpr std::size_t s_receiveBufferSize = 16 * 1024;
+	}
+
 	/*!
 	* \ingroup network
 	* \class Nz::TcpClient
 	* \brief Network class that represents a client in a TCP connection
+	*
+	* ReceivePacket reads as much data as available at once into an internal buffer, which can hold multiple packets.
+	* Receive and the stream interface read from this buffer before reading from the socket.
 	*/
 
+	/*!
+	* \brief Receives data asynchronously
+	* \return true If the operation was started
+	*
+	* \param queue Completion queue which will call the callback
+	* \param buffer Raw memory to write, it must stay valid until the callback is called
+	* \param size Size of the buffer
+	* \param callback Function called with the number of bytes received once some data arrived (or the operation failed)
+	*
+	* \remark The client must not be moved or destroyed while the operation is pending
+	* \remark Data already read by ReceivePacket is not returned by this function
+	* \remark Produces a NazaraAssert if socket is invalid
+	* \remark Produces a NazaraAssert if buffer and its size is invalid
+	*/
+
+	bool TcpClient::AsyncReceive(SocketCompletionQueue& queue, void* buffer, std::size_t size, SocketCompletionQueue::Callback callback)
+	{
+		NazaraAssert(m_handle != SocketImpl::InvalidHandle, "Invalid handle");
+		NazaraAssert(buffer && size > 0, "Invalid buffer");
+
+		return queue.Receive(m_handle, buffer, size, [this, callback = std::move(callback)](SocketError error, std::size_t received)
+		{
+			OnAsyncCompletion(error);
+
+			if (callback)
+				callback(error, received);
+		}, &m_lastError);
+	}
+
+	/*!
+	* \brief Sends data asynchronously
+	* \return true If the operation was started
+	*
+	* \param queue Completion queue which will call the callback
+	* \param buffer Raw memory to send, it must stay valid until the callback is called
+	* \param size Size of the buffer
+	* \param callback Function called once the whole buffer was sent (or the operation failed)
+	*
+	* \remark The client must not be moved or destroyed while the operation is pending
+	* \remark Produces a NazaraAssert if socket is invalid
+	* \remark Produces a NazaraAssert if buffer and its size is invalid
+	*/
+
+	bool TcpClient::AsyncSend(SocketCompletionQueue& queue, const void* buffer, std::size_t size, SocketCompletionQueue::Callback callback)
+	{
+		NazaraAssert(m_handle != SocketImpl::InvalidHandle, "Invalid handle");
+		NazaraAssert(buffer && size > 0, "Invalid buffer");
+
+		return queue.Send(m_handle, buffer, size, [this, callback = std::move(callback)](SocketError error, std::size_t sent)
+		{
+			OnAsyncCompletion(error);
+
+			if (callback)
+				callback(error, sent);
+		}, &m_lastError);
+	}
+
 	/*!
 	* \brief Connects to the IpAddress
 	* \return State of the socket
@@ -147,7 +217,7 @@ namespace Nz
 
 	bool TcpClient::EndOfStream() const
 	{
-		return QueryAvailableBytes() == 0;
+		return m_receiveBufferBegin == m_receiveBufferEnd && QueryAvailableBytes() == 0;
 	}
 
 	/*!
@@ -170,7 +240,7 @@ namespace Nz
 
 	UInt64 TcpClient::GetSize() const
 	{
-		return QueryAvailableBytes();
+		return (m_receiveBufferEnd - m_receiveBufferBegin) + QueryAvailableBytes();
 	}
 
 	/*!
@@ -181,6 +251,7 @@ namespace Nz
 	* \param size Size of the buffer
 	* \param received Optional argument to get the number of bytes received
 	*
+	* \remark Data already read by ReceivePacket is returned first, without reading from the socket
 	* \remark Produces a NazaraAssert if socket is invalid
 	* \remark Produces a NazaraAssert if buffer and its size is invalid
 	*/
@@ -190,28 +261,20 @@ namespace Nz
 		NazaraAssert(m_handle != SocketImpl::InvalidHandle, "Invalid handle");
 		NazaraAssert(buffer && size > 0, "Invalid buffer");
 
-		int read;
-		if (!SocketImpl::Receive(m_handle, buffer, static_cast<int>(size), &read, &m_lastError))
+		std::size_t bufferedSize = m_receiveBufferEnd - m_receiveBufferBegin;
+		if (bufferedSize > 0)
 		{
-			switch (m_lastError)
-			{
-				case SocketError_ConnectionClosed:
-				case SocketError_ConnectionRefused:
-					UpdateState(SocketState_NotConnected);
-					break;
+			std::size_t readSize = std::min(size, bufferedSize);
+			std::memcpy(buffer, &m_receiveBuffer[m_receiveBufferBegin], readSize);
+			m_receiveBufferBegin += readSize;
 
-				default:
-					break;
-			}
+			if (received)
+				*received = readSize;
 
-			return false;
+			return true;
 		}
 
-		if (received)
-			*received = read;
-
-		UpdateState(SocketState_Connected);
-		return true;
+		return ReceiveFromSocket(buffer, size, received);
 	}
 
 	/*!
@@ -227,75 +290,32 @@ namespace Nz
 
 	bool TcpClient::ReceivePacket(NetPacket* packet)
 	{
-		//TODO: Every packet requires at least two Receive call, using an internal buffer of a fixed size would prevent this
 		NazaraAssert(packet, "Invalid packet");
 
-		if (!m_pendingPacket.headerReceived)
-		{
-			m_pendingPacket.data.Resize(NetPacket::HeaderSize);
-
-			std::size_t received;
-			if (!Receive(&m_pendingPacket.data[m_pendingPacket.received], NetPacket::HeaderSize - m_pendingPacket.received, &received))
-				return false;
-
-			m_pendingPacket.received += received;
-
-			//TODO: Should never happen in production !
-			NazaraAssert(m_pendingPacket.received <= NetPacket::HeaderSize, "Received more data than header size");
-			if (m_pendingPacket.received >= NetPacket::HeaderSize)
-			{
-				UInt16 size;
-				if (!NetPacket::DecodeHeader(m_pendingPacket.data.GetConstBuffer(), &size, &m_pendingPacket.netcode))
-				{
-					m_lastError = SocketError_Packet;
-					NazaraWarning("Invalid header data");
-					return false;
-				}
-
-				m_pendingPacket.data.Resize(size - NetPacket::HeaderSize);
-				m_pendingPacket.headerReceived = true;
-				m_pendingPacket.received = 0;
-			}
-		}
+		if (!FillReceiveBuffer(NetPacket::HeaderSize))
+			return false;
 
-		// We may have just received the header now
-		if (m_pendingPacket.headerReceived)
+		UInt16 netCode;
+		UInt16 packetSize;
+		if (!NetPacket::DecodeHeader(&m_receiveBuffer[m_receiveBufferBegin], &packetSize, &netCode) || packetSize < NetPacket::HeaderSize)
 		{
-			UInt16 packetSize = static_cast<UInt16>(m_pendingPacket.data.GetSize()); //< Total packet size
-			if (packetSize == 0)
-			{
-				// Special case: our packet carry no data
-				packet->Reset(m_pendingPacket.netcode);
-
-				// And reset every state
-				m_pendingPacket.data.Clear();
-				m_pendingPacket.headerReceived = false;
-				m_pendingPacket.received = 0;
-				return true;
-			}
-
-			std::size_t received;
-			if (!Receive(&m_pendingPacket.data[m_pendingPacket.received], packetSize - m_pendingPacket.received, &received))
-				return false;
-
-			m_pendingPacket.received += received;
+			m_lastError = SocketError_Packet;
+			NazaraWarning("Invalid header data");
+			return false;
+		}
 
-			//TODO: Should never happen in production !
-			NazaraAssert(m_pendingPacket.received <= packetSize, "Received more data than packet size");
-			if (m_pendingPacket.received >= packetSize)
-			{
-				// Okay we received the whole packet, copy it
-				packet->Reset(m_pendingPacket.netcode, m_pendingPacket.data.GetConstBuffer(), m_pendingPacket.data.GetSize());
+		// The header stays in the buffer until the whole packet is received
+		if (!FillReceiveBuffer(packetSize))
+			return false;
 
-				// And reset every state
-				m_pendingPacket.data.Clear();
-				m_pendingPacket.headerReceived = false;
-				m_pendingPacket.received = 0;
-				return true;
-			}
-		}
+		std::size_t dataSize = packetSize - NetPacket::HeaderSize;
+		if (dataSize > 0)
+			packet->Reset(netCode, &m_receiveBuffer[m_receiveBufferBegin + NetPacket::HeaderSize], dataSize);
+		else
+			packet->Reset(netCode); //< Special case: our packet carry no data
 
-		return false;
+		m_receiveBufferBegin += packetSize;
+		return true;
 	}
 
 	/*!
@@ -398,21 +418,51 @@ namespace Nz
 	*
 	* \param packet Packet to send
 	*
+	* The header is encoded on the stack and sent along the payload as separate buffers, the packet itself is never written to.
+	* The same packet can thus be sent to many clients (even from multiple threads) without being copied.
+	*
 	* \remark Produces a NazaraError if packet could not be prepared for sending
 	*/
 
 	bool TcpClient::SendPacket(const NetPacket& packet)
 	{
-		std::size_t size = 0;
-		const UInt8* ptr = static_cast<const UInt8*>(packet.OnSend(&size));
-		if (!ptr)
+		NazaraAssert(packet.GetNetCode() != NetCode_Invalid, "Invalid NetCode");
+
+		std::size_t packetSize = NetPacket::HeaderSize + packet.GetDataSize();
+
+		std::array<UInt8, NetPacket::HeaderSize> header;
+		if (!NetPacket::EncodeHeader(header.data(), static_cast<UInt16>(packetSize), packet.GetNetCode()))
 		{
 			m_lastError = SocketError_Packet;
 			NazaraError("Failed to prepare packet");
 			return false;
 		}
 
-		return Send(ptr, size, nullptr);
+		const UInt8* payload = packet.GetConstData() + NetPacket::HeaderSize;
+
+		std::array<NetBuffer, 2> buffers;
+		buffers[0].data = header.data();
+		buffers[0].dataLength = header.size();
+		buffers[1].data = const_cast<UInt8*>(payload); //< NetBuffer is also used to receive, sending does not write to it
+		buffers[1].dataLength = packet.GetDataSize();
+
+		std::size_t sent;
+		if (!SendMultiple(buffers.data(), (buffers[1].dataLength > 0) ? 2 : 1, &sent))
+			return false;
+
+		// Send what could not be sent at once
+		if (sent < NetPacket::HeaderSize)
+		{
+			if (!Send(header.data() + sent, NetPacket::HeaderSize - sent, nullptr))
+				return false;
+
+			sent = NetPacket::HeaderSize;
+		}
+
+		if (sent < packetSize)
+			return Send(payload + (sent - NetPacket::HeaderSize), packetSize - sent, nullptr);
+
+		return true;
 	}
 
 	/*!
@@ -483,6 +533,40 @@ namespace Nz
 		return false;
 	}
 
+	/*!
+	* \brief Makes sure the internal buffer holds enough data
+	* \return true If at least minSize bytes are available in the buffer
+	*
+	* \param minSize Number of bytes required
+	*
+	* \remark A single read is made, as big as the free space of the buffer
+	*/
+
+	bool TcpClient::FillReceiveBuffer(std::size_t minSize)
+	{
+		std::size_t bufferedSize = m_receiveBufferEnd - m_receiveBufferBegin;
+		if (bufferedSize >= minSize)
+			return true;
+
+		// Move the remaining data to the beginning of the buffer, so a packet is always contiguous
+		if (m_receiveBufferBegin > 0)
+		{
+			std::memmove(m_receiveBuffer.GetBuffer(), &m_receiveBuffer[m_receiveBufferBegin], bufferedSize);
+			m_receiveBufferBegin = 0;
+			m_receiveBufferEnd = bufferedSize;
+		}
+
+		if (m_receiveBuffer.GetSize() < minSize)
+			m_receiveBuffer.Resize(std::max(minSize, s_receiveBufferSize));
+
+		std::size_t received;
+		if (!ReceiveFromSocket(&m_receiveBuffer[m_receiveBufferEnd], m_receiveBuffer.GetSize() - m_receiveBufferEnd, &received))
+			return false;
+
+		m_receiveBufferEnd += received;
+		return m_receiveBufferEnd >= minSize;
+	}
+
 	/*!
 	* \brief Flushes the stream
 	*/
@@ -491,6 +575,32 @@ namespace Nz
 	{
 	}
 
+	/*!
+	* \brief Updates the state of the socket according to the result of an asynchronous operation
+	*
+	* \param error Error reported by the operation
+	*/
+
+	void TcpClient::OnAsyncCompletion(SocketError error)
+	{
+		m_lastError = error;
+
+		switch (error)
+		{
+			case SocketError_NoError:
+				UpdateState(SocketState_Connected);
+				break;
+
+			case SocketError_ConnectionClosed:
+			case SocketError_ConnectionRefused:
+				UpdateState(SocketState_NotConnected);
+				break;
+
+			default:
+				break;
+		}
+	}
+
 	/*!
 	* \brief Operation to do when closing socket
 	*/
@@ -501,6 +611,8 @@ namespace Nz
 
 		m_openMode = OpenMode_NotOpen;
 		m_peerAddress = IpAddress::Invalid;
+		m_receiveBufferBegin = 0;
+		m_receiveBufferEnd = 0;
 	}
 
 	/*!
@@ -523,6 +635,8 @@ namespace Nz
 
 		m_peerAddress = IpAddress::Invalid;
 		m_openMode = OpenMode_ReadWrite;
+		m_receiveBufferBegin = 0;
+		m_receiveBufferEnd = 0;
 	}
 
 	/*!
@@ -556,6 +670,41 @@ namespace Nz
 		return received;
 	}
 
+	/*!
+	* \brief Receives data directly from the socket
+	* \return true If data received
+	*
+	* \param buffer Raw memory to write
+	* \param size Size of the buffer
+	* \param received Optional argument to get the number of bytes received
+	*/
+
+	bool TcpClient::ReceiveFromSocket(void* buffer, std::size_t size, std::size_t* received)
+	{
+		int read;
+		if (!SocketImpl::Receive(m_handle, buffer, static_cast<int>(size), &read, &m_lastError))
+		{
+			switch (m_lastError)
+			{
+				case SocketError_ConnectionClosed:
+				case SocketError_ConnectionRefused:
+					UpdateState(SocketState_NotConnected);
+					break;
+
+				default:
+					break;
+			}
+
+			return false;
+		}
+
+		if (received)
+			*received = read;
+
+		UpdateState(SocketState_Connected);
+		return true;
+	}
+
 	/*!
 	* \brief Resets the connection with a new socket and a peer address
 	*
@@ -49,6 +49,34 @@ namespace Nz
 			return false;
 	}
 
+	/*!
+	* \brief Accepts a client asynchronously
+	* \return true If the operation was started
+	*
+	* \param queue Completion queue which will call the callback
+	* \param newClient Client which will hold the connection, it must stay alive until the callback is called
+	* \param callback Function called once a client was accepted (or the operation failed)
+	*
+	* \remark Produces a NazaraAssert if socket is invalid
+	* \remark Produces a NazaraAssert if newClient is invalid
+	*/
+
+	bool TcpServer::AsyncAccept(SocketCompletionQueue& queue, TcpClient* newClient, AcceptCallback callback)
+	{
+		NazaraAssert(m_handle != SocketImpl::InvalidHandle, "Server isn't listening");
+		NazaraAssert(newClient, "Invalid client socket");
+
+		return queue.Accept(m_handle, m_protocol, [this, newClient, callback = std::move(callback)](SocketError error, SocketHandle handle, const IpAddress& clientAddress)
+		{
+			m_lastError = error;
+			if (error == SocketError_NoError)
+				newClient->Reset(handle, clientAddress);
+
+			if (callback)
+				callback(error);
+		}, &m_lastError);
+	}
+
 	/*!
 	* \brief Listens to a socket
 	* \return State of the socket
@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Network/UdpSocket.hpp>
+#include <Nazara/Network/NetDatagram.hpp>
 #include <Nazara/Network/NetPacket.hpp>
 
 #if defined(NAZARA_PLATFORM_WINDOWS)
@@ -65,6 +66,24 @@ namespace Nz
 		}
 	}
 
+	/*!
+	* \brief Allows multiple sockets to be bound to the same port
+	* \return true If the option could be set
+	*
+	* \param reusePort Should the port be shared
+	*
+	* \remark This must be called before binding the socket, every socket sharing the port has to enable it
+	* \remark On Linux, the system balances the incoming datagrams between these sockets according to the sender address
+	* \remark Produces a NazaraAssert if socket is invalid
+	*/
+
+	bool UdpSocket::EnablePortReuse(bool reusePort)
+	{
+		NazaraAssert(m_handle != SocketImpl::InvalidHandle, "Invalid handle");
+
+		return SocketImpl::SetReusePort(m_handle, reusePort, &m_lastError);
+	}
+
 	/*!
 	* \brief Gets the maximum datagram size allowed
 	* \return Number of bytes
@@ -118,6 +137,25 @@ namespace Nz
 		return true;
 	}
 
+	/*!
+	* \brief Receives as many datagrams as possible, from any peer
+	* \return true If no error occurred
+	*
+	* \param datagrams A pointer to an array of datagrams, whose buffers describe where the data of each datagram will be written
+	* \param datagramCount Number of datagrams available
+	* \param received Optional argument to get the number of datagrams received, their address and dataLength are filled
+	*
+	* \remark On Linux this only takes one system call (recvmmsg), other platforms receive the datagrams one by one
+	* \remark This only waits for the first datagram if the socket is blocking
+	*/
+	bool UdpSocket::ReceiveDatagrams(NetDatagram* datagrams, std::size_t datagramCount, std::size_t* received)
+	{
+		NazaraAssert(m_handle != SocketImpl::InvalidHandle, "Socket hasn't been created");
+		NazaraAssert(datagrams && datagramCount > 0, "Invalid datagrams");
+
+		return SocketImpl::ReceiveDatagrams(m_handle, datagrams, datagramCount, received, &m_lastError);
+	}
+
 	/*!
 	* \brief Receive multiple datagram from one peer
 	* \return true If data were sent
@@ -232,6 +270,31 @@ namespace Nz
 		return true;
 	}
 
+	/*!
+	* \brief Sends multiple datagrams, each one to its own peer
+	* \return true If no error occurred
+	*
+	* \param datagrams A pointer to an array of datagrams, each one with its destination (must match socket protocol) and buffers
+	* \param datagramCount Number of datagrams to send
+	* \param sent Optional argument to get the number of datagrams sent, their dataLength is filled
+	*
+	* \remark On Linux this only takes one system call (sendmmsg), other platforms send the datagrams one by one
+	* \remark Less datagrams than datagramCount may be sent if the socket would block
+	*/
+	bool UdpSocket::SendDatagrams(NetDatagram* datagrams, std::size_t datagramCount, std::size_t* sent)
+	{
+		NazaraAssert(m_handle != SocketImpl::InvalidHandle, "Socket hasn't been created");
+		NazaraAssert(datagrams && datagramCount > 0, "Invalid datagrams");
+
+		for (std::size_t i = 0; i < datagramCount; ++i)
+		{
+			NazaraAssert(datagrams[i].address.IsValid(), "Invalid ip address");
+			NazaraAssert(datagrams[i].address.GetProtocol() == m_protocol, "IP Address has a different protocol than the socket");
+		}
+
+		return SocketImpl::SendDatagrams(m_handle, datagrams, datagramCount, sent, &m_lastError);
+	}
+
 	/*!
 	* \brief Sends multiple buffers as one datagram
 	* \return true If data were sent
@@ -0,0 +1,423 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/Win32/SocketCompletionQueueImpl.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Network/Win32/IpAddressImpl.hpp>
+#include <algorithm>
+#include <cstring>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		template<typename F>
+		bool LoadExtension(SocketHandle handle, GUID guid, F* function)
+		{
+			DWORD byteReturned;
+			return WSAIoctl(handle, SIO_GET_EXTENSION_FUNCTION_POINTER, &guid, sizeof(guid), function, sizeof(F), &byteReturned, nullptr, nullptr) != SOCKET_ERROR;
+		}
+
+		SocketError TranslateCompletionError(int error)
+		{
+			switch (error)
+			{
+				case ERROR_OPERATION_ABORTED:
+				case WSA_OPERATION_ABORTED:
+					return SocketError_Interrupted;
+
+				default:
+					return SocketImpl::TranslateWSAErrorToSocketError(error);
+			}
+		}
+	}
+
+	SocketCompletionQueueImpl::SocketCompletionQueueImpl(std::size_t queueSize) :
+	m_operationPool(sizeof(Operation)),
+	m_acceptEx(nullptr),
+	m_getAcceptExSockaddrs(nullptr)
+	{
+		m_entries.resize(std::max<std::size_t>(queueSize, 1));
+
+		m_handle = CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 1);
+		if (!m_handle)
+			NazaraError("Failed to create I/O completion port: " + Error::GetLastSystemError());
+	}
+
+	SocketCompletionQueueImpl::~SocketCompletionQueueImpl()
+	{
+		if (!m_handle)
+			return;
+
+		// The system may still write into operations (and user buffers) until they are cancelled, wait for them
+		for (auto& pair : m_operations)
+			CancelOperations(pair.first);
+
+		for (unsigned int attempt = 0; !m_operations.empty() && attempt < 10; ++attempt)
+		{
+			DWORD transferred;
+			ULONG_PTR key;
+			OVERLAPPED* overlapped;
+			GetQueuedCompletionStatus(m_handle, &transferred, &key, &overlapped, 100);
+			if (overlapped)
+				ProcessCompletion(reinterpret_cast<Operation*>(overlapped), false);
+		}
+
+		for (auto& pair : m_operations)
+			m_operationPool.Delete(pair.second);
+
+		m_operations.clear();
+
+		CloseHandle(m_handle);
+	}
+
+	bool SocketCompletionQueueImpl::Accept(SocketHandle listenHandle, NetProtocol protocol, AcceptCallback callback, SocketError* error)
+	{
+		if (!m_acceptEx)
+		{
+			GUID acceptExGuid = WSAID_ACCEPTEX;
+			GUID getAcceptExSockaddrsGuid = WSAID_GETACCEPTEXSOCKADDRS;
+			if (!LoadExtension(listenHandle, acceptExGuid, &m_acceptEx) || !LoadExtension(listenHandle, getAcceptExSockaddrsGuid, &m_getAcceptExSockaddrs))
+			{
+				m_acceptEx = nullptr;
+				if (error)
+					*error = SocketImpl::TranslateWSAErrorToSocketError(WSAGetLastError());
+
+				return false;
+			}
+		}
+
+		if (!AssociateSocket(listenHandle, error))
+			return false;
+
+		Operation* operation = AllocateOperation(OperationType::Accept, listenHandle);
+		operation->acceptCallback = std::move(callback);
+		operation->protocol = protocol;
+
+		if (!StartOperation(operation, error))
+		{
+			FreeOperation(operation);
+			return false;
+		}
+
+		return true;
+	}
+
+	void SocketCompletionQueueImpl::CancelOperations(SocketHandle handle)
+	{
+		if (m_operations.count(handle) == 0)
+			return;
+
+		#if NAZARA_CORE_WINDOWS_NT6
+		CancelIoEx(reinterpret_cast<HANDLE>(handle), nullptr);
+		#else
+		CancelIo(reinterpret_cast<HANDLE>(handle)); //< Only cancels operations started by the calling thread
+		#endif
+	}
+
+	std::size_t SocketCompletionQueueImpl::GetPendingOperationCount() const
+	{
+		return m_operations.size();
+	}
+
+	bool SocketCompletionQueueImpl::IsValid() const
+	{
+		return m_handle != nullptr;
+	}
+
+	bool SocketCompletionQueueImpl::Receive(SocketHandle handle, void* buffer, std::size_t size, Callback callback, SocketError* error)
+	{
+		if (!AssociateSocket(handle, error))
+			return false;
+
+		Operation* operation = AllocateOperation(OperationType::Receive, handle);
+		operation->buffer = static_cast<UInt8*>(buffer);
+		operation->callback = std::move(callback);
+		operation->size = size;
+
+		if (!StartOperation(operation, error))
+		{
+			FreeOperation(operation);
+			return false;
+		}
+
+		return true;
+	}
+
+	bool SocketCompletionQueueImpl::Send(SocketHandle handle, const void* buffer, std::size_t size, Callback callback, SocketError* error)
+	{
+		if (!AssociateSocket(handle, error))
+			return false;
+
+		Operation* operation = AllocateOperation(OperationType::Send, handle);
+		operation->buffer = static_cast<UInt8*>(const_cast<void*>(buffer)); //< Only read by the system
+		operation->callback = std::move(callback);
+		operation->size = size;
+
+		if (!StartOperation(operation, error))
+		{
+			FreeOperation(operation);
+			return false;
+		}
+
+		return true;
+	}
+
+	int SocketCompletionQueueImpl::Wait(int msTimeout, SocketError* error)
+	{
+		DWORD timeout = (msTimeout >= 0) ? static_cast<DWORD>(msTimeout) : INFINITE;
+
+		if (error)
+			*error = SocketError_NoError;
+
+		int completedOperations = 0;
+
+		#if NAZARA_CORE_WINDOWS_NT6
+		ULONG entryCount;
+		if (!GetQueuedCompletionStatusEx(m_handle, m_entries.data(), static_cast<ULONG>(m_entries.size()), &entryCount, timeout, FALSE))
+		{
+			DWORD errorCode = GetLastError();
+			if (errorCode == WAIT_TIMEOUT)
+				return 0;
+
+			if (error)
+				*error = SocketImpl::TranslateWSAErrorToSocketError(errorCode);
+
+			return -1;
+		}
+
+		for (ULONG i = 0; i < entryCount; ++i)
+		{
+			if (ProcessCompletion(reinterpret_cast<Operation*>(m_entries[i].lpOverlapped), true))
+				completedOperations++;
+		}
+		#else
+		DWORD transferred;
+		ULONG_PTR key;
+		OVERLAPPED* overlapped;
+		while (GetQueuedCompletionStatus(m_handle, &transferred, &key, &overlapped, timeout) || overlapped)
+		{
+			if (ProcessCompletion(reinterpret_cast<Operation*>(overlapped), true))
+				completedOperations++;
+
+			timeout = 0;
+		}
+		#endif
+
+		return completedOperations;
+	}
+
+	auto SocketCompletionQueueImpl::AllocateOperation(OperationType type, SocketHandle handle) -> Operation*
+	{
+		Operation* operation = m_operationPool.New<Operation>();
+		operation->acceptedHandle = SocketImpl::InvalidHandle;
+		operation->buffer = nullptr;
+		operation->handle = handle;
+		operation->protocol = NetProtocol_Unknown;
+		operation->size = 0;
+		operation->transferred = 0;
+		operation->type = type;
+
+		m_operations.emplace(handle, operation);
+
+		return operation;
+	}
+
+	bool SocketCompletionQueueImpl::AssociateSocket(SocketHandle handle, SocketError* error)
+	{
+		// A socket can only be associated once, which is reported as an invalid parameter
+		if (!CreateIoCompletionPort(reinterpret_cast<HANDLE>(handle), m_handle, 0, 0) && GetLastError() != ERROR_INVALID_PARAMETER)
+		{
+			if (error)
+				*error = SocketImpl::TranslateWSAErrorToSocketError(GetLastError());
+
+			return false;
+		}
+
+		return true;
+	}
+
+	void SocketCompletionQueueImpl::FreeOperation(Operation* operation)
+	{
+		auto range = m_operations.equal_range(operation->handle);
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			if (it->second == operation)
+			{
+				m_operations.erase(it);
+				break;
+			}
+		}
+
+		if (operation->acceptedHandle != SocketImpl::InvalidHandle)
+			SocketImpl::Close(operation->acceptedHandle);
+
+		m_operationPool.Delete(operation);
+	}
+
+	bool SocketCompletionQueueImpl::ProcessCompletion(Operation* operation, bool invokeCallback)
+	{
+		DWORD transferred;
+		DWORD flags;
+
+		SocketError error = SocketError_NoError;
+		if (!WSAGetOverlappedResult(operation->handle, &operation->overlapped, &transferred, FALSE, &flags))
+			error = TranslateCompletionError(WSAGetLastError());
+
+		if (invokeCallback && error == SocketError_NoError && operation->type == OperationType::Send && transferred > 0 && operation->transferred + transferred < operation->size)
+		{
+			// Send the remaining data
+			operation->transferred += transferred;
+			if (StartOperation(operation, &error))
+				return false;
+		}
+		else
+			operation->transferred += transferred;
+
+		IpAddress acceptedAddress;
+		SocketHandle acceptedHandle = SocketImpl::InvalidHandle;
+
+		if (error == SocketError_NoError)
+		{
+			switch (operation->type)
+			{
+				case OperationType::Accept:
+				{
+					// Give the accepted socket the properties of the listening one, so it can be used like any other socket
+					if (setsockopt(operation->acceptedHandle, SOL_SOCKET, SO_UPDATE_ACCEPT_CONTEXT, reinterpret_cast<const char*>(&operation->handle), sizeof(SocketHandle)) == SOCKET_ERROR)
+					{
+						error = SocketImpl::TranslateWSAErrorToSocketError(WSAGetLastError());
+						break;
+					}
+
+					sockaddr* localAddress;
+					sockaddr* remoteAddress;
+					int localAddressLength;
+					int remoteAddressLength;
+					m_getAcceptExSockaddrs(operation->addresses.data(), 0, AcceptAddressLength, AcceptAddressLength, &localAddress, &localAddressLength, &remoteAddress, &remoteAddressLength);
+
+					acceptedAddress = IpAddressImpl::FromSockAddr(remoteAddress);
+					acceptedHandle = operation->acceptedHandle;
+					operation->acceptedHandle = SocketImpl::InvalidHandle; //< Now belongs to the callback
+					break;
+				}
+
+				case OperationType::Receive:
+					if (transferred == 0)
+						error = SocketError_ConnectionClosed;
+					break;
+
+				case OperationType::Send:
+					break;
+			}
+		}
+
+		if (!invokeCallback)
+		{
+			if (acceptedHandle != SocketImpl::InvalidHandle)
+				SocketImpl::Close(acceptedHandle);
+
+			FreeOperation(operation);
+			return true;
+		}
+
+		OperationType type = operation->type;
+		std::size_t byteTransferred = operation->transferred;
+		AcceptCallback acceptCallback = std::move(operation->acceptCallback);
+		Callback callback = std::move(operation->callback);
+
+		FreeOperation(operation);
+
+		if (type == OperationType::Accept)
+		{
+			if (acceptCallback)
+				acceptCallback(error, acceptedHandle, acceptedAddress);
+			else if (acceptedHandle != SocketImpl::InvalidHandle)
+				SocketImpl::Close(acceptedHandle);
+		}
+		else if (callback)
+			callback(error, byteTransferred);
+
+		return true;
+	}
+
+	bool SocketCompletionQueueImpl::StartOperation(Operation* operation, SocketError* error)
+	{
+		std::memset(&operation->overlapped, 0, sizeof(OVERLAPPED));
+
+		switch (operation->type)
+		{
+			case OperationType::Accept:
+			{
+				operation->acceptedHandle = SocketImpl::Create(operation->protocol, SocketType_TCP, error);
+				if (operation->acceptedHandle == SocketImpl::InvalidHandle)
+					return false;
+
+				DWORD byteReceived;
+				if (!m_acceptEx(operation->handle, operation->acceptedHandle, operation->addresses.data(), 0, AcceptAddressLength, AcceptAddressLength, &byteReceived, &operation->overlapped))
+				{
+					int errorCode = WSAGetLastError();
+					if (errorCode != ERROR_IO_PENDING)
+					{
+						SocketImpl::Close(operation->acceptedHandle);
+						operation->acceptedHandle = SocketImpl::InvalidHandle;
+
+						if (error)
+							*error = SocketImpl::TranslateWSAErrorToSocketError(errorCode);
+
+						return false;
+					}
+				}
+				break;
+			}
+
+			case OperationType::Receive:
+			{
+				WSABUF buffer;
+				buffer.buf = reinterpret_cast<CHAR*>(operation->buffer);
+				buffer.len = static_cast<ULONG>(operation->size);
+
+				DWORD flags = 0;
+				if (WSARecv(operation->handle, &buffer, 1, nullptr, &flags, &operation->overlapped, nullptr) == SOCKET_ERROR)
+				{
+					int errorCode = WSAGetLastError();
+					if (errorCode != WSA_IO_PENDING)
+					{
+						if (error)
+							*error = SocketImpl::TranslateWSAErrorToSocketError(errorCode);
+
+						return false;
+					}
+				}
+				break;
+			}
+
+			case OperationType::Send:
+			{
+				WSABUF buffer;
+				buffer.buf = reinterpret_cast<CHAR*>(operation->buffer + operation->transferred);
+				buffer.len = static_cast<ULONG>(operation->size - operation->transferred);
+
+				if (WSASend(operation->handle, &buffer, 1, nullptr, 0, &operation->overlapped, nullptr) == SOCKET_ERROR)
+				{
+					int errorCode = WSAGetLastError();
+					if (errorCode != WSA_IO_PENDING)
+					{
+						if (error)
+							*error = SocketImpl::TranslateWSAErrorToSocketError(errorCode);
+
+						return false;
+					}
+				}
+				break;
+			}
+		}
+
+		if (error)
+			*error = SocketError_NoError;
+
+		return true;
+	}
+}
@@ -0,0 +1,84 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_SOCKETCOMPLETIONQUEUEIMPL_HPP
+#define NAZARA_SOCKETCOMPLETIONQUEUEIMPL_HPP
+
+#include <Nazara/Core/MemoryPool.hpp>
+#include <Nazara/Network/SocketCompletionQueue.hpp>
+#include <Nazara/Network/Win32/SocketImpl.hpp>
+#include <array>
+#include <unordered_map>
+#include <vector>
+#include <mswsock.h>
+#include <ws2ipdef.h>
+
+namespace Nz
+{
+	class SocketCompletionQueueImpl
+	{
+		public:
+			using AcceptCallback = std::function<void(SocketError error, SocketHandle handle, const IpAddress& address)>;
+			using Callback = SocketCompletionQueue::Callback;
+
+			SocketCompletionQueueImpl(std::size_t queueSize);
+			~SocketCompletionQueueImpl();
+
+			bool Accept(SocketHandle listenHandle, NetProtocol protocol, AcceptCallback callback, SocketError* error);
+
+			void CancelOperations(SocketHandle handle);
+
+			std::size_t GetPendingOperationCount() const;
+
+			bool IsValid() const;
+
+			bool Receive(SocketHandle handle, void* buffer, std::size_t size, Callback callback, SocketError* error);
+
+			bool Send(SocketHandle handle, const void* buffer, std::size_t size, Callback callback, SocketError* error);
+
+			int Wait(int msTimeout, SocketError* error);
+
+		private:
+			enum class OperationType
+			{
+				Accept,
+				Receive,
+				Send
+			};
+
+			static constexpr DWORD AcceptAddressLength = sizeof(sockaddr_in6) + 16; //< AcceptEx requires 16 bytes more than the largest address
+
+			struct Operation
+			{
+				OVERLAPPED overlapped; //< Must be the first member, completions only give its address back
+				AcceptCallback acceptCallback;
+				Callback callback;
+				std::array<UInt8, 2 * AcceptAddressLength> addresses;
+				NetProtocol protocol;
+				OperationType type;
+				SocketHandle acceptedHandle;
+				SocketHandle handle;
+				UInt8* buffer;
+				std::size_t size;
+				std::size_t transferred;
+			};
+
+			Operation* AllocateOperation(OperationType type, SocketHandle handle);
+			bool AssociateSocket(SocketHandle handle, SocketError* error);
+			void FreeOperation(Operation* operation);
+			bool ProcessCompletion(Operation* operation, bool invokeCallback);
+			bool StartOperation(Operation* operation, SocketError* error);
+
+			MemoryPool m_operationPool;
+			std::unordered_multimap<SocketHandle, Operation*> m_operations;
+			std::vector<OVERLAPPED_ENTRY> m_entries;
+			LPFN_ACCEPTEX m_acceptEx;
+			LPFN_GETACCEPTEXSOCKADDRS m_getAcceptExSockaddrs;
+			HANDLE m_handle;
+	};
+}
+
+#endif // NAZARA_SOCKETCOMPLETIONQUEUEIMPL_HPP
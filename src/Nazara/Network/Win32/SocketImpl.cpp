@@ -6,6 +6,7 @@
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/Log.hpp>
 #include <Nazara/Core/MemoryHelper.hpp>
+#include <Nazara/Network/NetDatagram.hpp>
 #include <Nazara/Network/Win32/IpAddressImpl.hpp>
 
 // Some compilers (older versions of MinGW) lack Mstcpip.h which defines some structs/defines
@@ -544,6 +545,56 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::ReceiveDatagrams(SocketHandle handle, NetDatagram* datagrams, std::size_t datagramCount, std::size_t* received, SocketError* error)
+	{
+		NazaraAssert(handle != InvalidHandle, "Invalid handle");
+		NazaraAssert(datagrams && datagramCount > 0, "Invalid datagrams");
+
+		// Winsock has no batched reception, receive datagrams one by one until there is none left
+		std::size_t datagramIndex = 0;
+		for (; datagramIndex < datagramCount; ++datagramIndex)
+		{
+			// Only the first reception may block
+			if (datagramIndex > 0 && QueryAvailableBytes(handle) == 0)
+				break;
+
+			NetDatagram& datagram = datagrams[datagramIndex];
+
+			int byteRead;
+			SocketError receiveError;
+			if (!ReceiveMultiple(handle, datagram.buffers, datagram.bufferCount, &datagram.address, &byteRead, &receiveError))
+			{
+				if (receiveError != SocketError_ConnectionClosed)
+				{
+					// Report errors on the next call if we already got something
+					if (datagramIndex > 0)
+						break;
+
+					if (error)
+						*error = receiveError;
+
+					return false;
+				}
+
+				// Empty datagram
+				datagram.address = IpAddress::Invalid;
+				byteRead = 0;
+			}
+			else if (byteRead == 0 && !datagram.address.IsValid())
+				break; //< Nothing left to receive
+
+			datagram.dataLength = static_cast<std::size_t>(byteRead);
+		}
+
+		if (received)
+			*received = datagramIndex;
+
+		if (error)
+			*error = SocketError_NoError;
+
+		return true;
+	}
+
 	bool SocketImpl::ReceiveFrom(SocketHandle handle, void* buffer, int length, IpAddress* from, int* read, SocketError* error)
 	{
 		NazaraAssert(handle != InvalidHandle, "Invalid handle");
@@ -704,6 +755,46 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::SendDatagrams(SocketHandle handle, NetDatagram* datagrams, std::size_t datagramCount, std::size_t* sent, SocketError* error)
+	{
+		NazaraAssert(handle != InvalidHandle, "Invalid handle");
+		NazaraAssert(datagrams && datagramCount > 0, "Invalid datagrams");
+
+		// Winsock has no batched sending, send datagrams one by one
+		std::size_t datagramIndex = 0;
+		for (; datagramIndex < datagramCount; ++datagramIndex)
+		{
+			NetDatagram& datagram = datagrams[datagramIndex];
+
+			int byteSent;
+			SocketError sendError;
+			if (!SendMultiple(handle, datagram.buffers, datagram.bufferCount, datagram.address, &byteSent, &sendError))
+			{
+				// Report errors on the next call if we already sent something
+				if (datagramIndex > 0)
+					break;
+
+				if (error)
+					*error = sendError;
+
+				return false;
+			}
+
+			if (byteSent == 0)
+				break; //< Would block
+
+			datagram.dataLength = static_cast<std::size_t>(byteSent);
+		}
+
+		if (sent)
+			*sent = datagramIndex;
+
+		if (error)
+			*error = SocketError_NoError;
+
+		return true;
+	}
+
 	bool SocketImpl::SendMultiple(SocketHandle handle, const NetBuffer* buffers, std::size_t bufferCount, const IpAddress& to, int* sent, SocketError* error)
 	{
 		NazaraAssert(handle != InvalidHandle, "Invalid handle");
@@ -915,6 +1006,18 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::SetReusePort(SocketHandle handle, bool reusePort, SocketError* error)
+	{
+		NazaraAssert(handle != InvalidHandle, "Invalid handle");
+		NazaraUnused(reusePort);
+
+		// SO_REUSEADDR has different semantics on Windows (it allows to steal a port), there is no equivalent to SO_REUSEPORT
+		if (error)
+			*error = SocketError_NotSupported;
+
+		return false;
+	}
+
 	bool SocketImpl::SetSendBufferSize(SocketHandle handle, std::size_t size, SocketError* error)
 	{
 		NazaraAssert(handle != InvalidHandle, "Invalid handle");
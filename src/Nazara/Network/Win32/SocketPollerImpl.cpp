@@ -3,11 +3,13 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Network/Win32/SocketPollerImpl.hpp>
+#include <algorithm>
 #include <Nazara/Network/Debug.hpp>
 
 namespace Nz
 {
-	SocketPollerImpl::SocketPollerImpl()
+	SocketPollerImpl::SocketPollerImpl() :
+	m_generation(0)
 	{
 		#if !NAZARA_NETWORK_POLL_SUPPORT
 		FD_ZERO(&m_readSockets);
@@ -19,12 +21,14 @@ namespace Nz
 
 	void SocketPollerImpl::Clear()
 	{
+		m_readyEvents.clear();
+
 		#if NAZARA_NETWORK_POLL_SUPPORT
 		m_allSockets.clear();
-		m_readyToReadSockets.clear();
-		m_readyToWriteSockets.clear();
+		m_entries.clear();
 		m_sockets.clear();
 		#else
+		m_entries.clear();
 		FD_ZERO(&m_readSockets);
 		FD_ZERO(&m_readyToReadSockets);
 		FD_ZERO(&m_readyToWriteSockets);
@@ -32,22 +36,19 @@ namespace Nz
 		#endif
 	}
 
+	const std::vector<SocketPoller::Event>& SocketPollerImpl::GetReadyEvents() const
+	{
+		return m_readyEvents;
+	}
+
 	bool SocketPollerImpl::IsReadyToRead(SocketHandle socket) const
 	{
-		#if NAZARA_NETWORK_POLL_SUPPORT
-		return m_readyToReadSockets.count(socket) != 0;
-		#else
-		return FD_ISSET(socket, const_cast<fd_set*>(&m_readyToReadSockets)) != 0; //< FD_ISSET is not const-correct
-		#endif
+		return IsReady(socket, SocketPollEvent_Read);
 	}
 
 	bool SocketPollerImpl::IsReadyToWrite(SocketHandle socket) const
 	{
-		#if NAZARA_NETWORK_POLL_SUPPORT
-		return m_readyToWriteSockets.count(socket) != 0;
-		#else
-		return FD_ISSET(socket, const_cast<fd_set*>(&m_readyToWriteSockets)) != 0; //< FD_ISSET is not const-correct
-		#endif
+		return IsReady(socket, SocketPollEvent_Write);
 	}
 
 	bool SocketPollerImpl::IsRegistered(SocketHandle socket) const
@@ -55,16 +56,15 @@ namespace Nz
 		#if NAZARA_NETWORK_POLL_SUPPORT
 		return m_allSockets.count(socket) != 0;
 		#else
-		// FD_ISSET is not const-correct
-		return FD_ISSET(socket, const_cast<fd_set*>(&m_readSockets)) != 0 || 
-		       FD_ISSET(socket, const_cast<fd_set*>(&m_writeSockets)) != 0;
+		return m_entries.count(socket) != 0;
 		#endif
 	}
 
-	bool SocketPollerImpl::RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags)
+	bool SocketPollerImpl::RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags, SocketPollMode /*mode*/, AbstractSocket* owner, void* userdata)
 	{
 		NazaraAssert(!IsRegistered(socket), "Socket is already registered");
 
+		// Neither WSAPoll nor select have an edge-triggered mode, sockets are reported as long as they're ready
 		#if NAZARA_NETWORK_POLL_SUPPORT
 		PollSocket entry = {
 			socket,
@@ -79,6 +79,7 @@ namespace Nz
 			entry.events |= POLLWRNORM;
 
 		m_allSockets[socket] = m_sockets.size();
+		m_entries.push_back({ owner, 0, 0, userdata });
 		m_sockets.emplace_back(entry);
 		#else
 		for (std::size_t i = 0; i < 2; ++i)
@@ -95,6 +96,8 @@ namespace Nz
 
 			FD_SET(socket, &targetSet);
 		}
+
+		m_entries[socket] = { owner, 0, 0, userdata };
 		#endif
 
 		return true;
@@ -104,65 +107,86 @@ namespace Nz
 	{
 		NazaraAssert(IsRegistered(socket), "Socket is not registered");
 
+		AbstractSocket* owner;
+
 		#if NAZARA_NETWORK_POLL_SUPPORT
+		std::size_t entry = m_allSockets[socket];
+		owner = m_entries[entry].owner;
+
 		if (m_sockets.size() > 1U)
 		{
 			// Instead of using vector::erase, let's move the last element to the now unoccupied position
-			std::size_t entry = m_allSockets[socket];
-
 			// Get the last element and update it's position
 			const PollSocket& lastElement = m_sockets.back();
 			m_allSockets[lastElement.fd] = entry;
 
 			// Now move it properly (lastElement is invalid after the following line) and pop it
+			m_entries[entry] = std::move(m_entries.back());
 			m_sockets[entry] = std::move(m_sockets.back());
 		}
+		m_entries.pop_back();
 		m_sockets.pop_back();
 
 		m_allSockets.erase(socket);
-		m_readyToReadSockets.erase(socket);
-		m_readyToWriteSockets.erase(socket);
 		#else
+		auto it = m_entries.find(socket);
+		owner = it->second.owner;
+		m_entries.erase(it);
+
 		FD_CLR(socket, &m_readSockets);
 		FD_CLR(socket, &m_readyToReadSockets);
 		FD_CLR(socket, &m_readyToWriteSockets);
 		FD_CLR(socket, &m_writeSockets);
 		#endif
+
+		// Don't report this socket anymore
+		m_readyEvents.erase(std::remove_if(m_readyEvents.begin(), m_readyEvents.end(), [&](const SocketPoller::Event& event) { return event.socket == owner; }), m_readyEvents.end());
 	}
 
 	int SocketPollerImpl::Wait(int msTimeout, SocketError* error)
 	{
 		int activeSockets;
 
+		// Invalidates ready states of the previous wait without touching every entry
+		m_generation++;
+		m_readyEvents.clear();
+
 		#if NAZARA_NETWORK_POLL_SUPPORT
 		activeSockets = SocketImpl::Poll(m_sockets.data(), m_sockets.size(), static_cast<int>(msTimeout), error);
 
-		m_readyToReadSockets.clear();
-		m_readyToWriteSockets.clear();
 		if (activeSockets > 0U)
 		{
 			int socketRemaining = activeSockets;
-			for (PollSocket& entry : m_sockets)
+			for (std::size_t i = 0; i < m_sockets.size(); ++i)
 			{
-				if (!entry.revents)
+				PollSocket& socket = m_sockets[i];
+				if (!socket.revents)
 					continue;
 
-				if (entry.revents & (POLLRDNORM | POLLWRNORM | POLLHUP | POLLERR))
+				if (socket.revents & (POLLRDNORM | POLLWRNORM | POLLHUP | POLLERR))
 				{
-					if (entry.revents & (POLLRDNORM | POLLHUP | POLLERR))
-						m_readyToReadSockets.insert(entry.fd);
+					SocketPollEventFlags readyEvents;
 
-					if (entry.revents & (POLLWRNORM | POLLERR))
-						m_readyToWriteSockets.insert(entry.fd);
+					if (socket.revents & (POLLRDNORM | POLLHUP | POLLERR))
+						readyEvents |= SocketPollEvent_Read;
 
-					entry.revents = 0;
+					if (socket.revents & (POLLWRNORM | POLLERR))
+						readyEvents |= SocketPollEvent_Write;
+
+					Entry& entry = m_entries[i];
+					entry.readyEvents = readyEvents;
+					entry.readyGeneration = m_generation;
+
+					m_readyEvents.push_back({ entry.owner, readyEvents, entry.userdata });
+
+					socket.revents = 0;
 
 					if (--socketRemaining == 0)
 						break;
 				}
 				else
 				{
-					NazaraWarning("Socket " + String::Number(entry.fd) + " was returned by WSAPoll without POLLRDNORM nor POLLWRNORM events (events: 0x" + String::Number(entry.revents, 16) + ')');
+					NazaraWarning("Socket " + String::Number(socket.fd) + " was returned by WSAPoll without POLLRDNORM nor POLLWRNORM events (events: 0x" + String::Number(socket.revents, 16) + ')');
 					activeSockets--;
 				}
 			}
@@ -180,7 +204,7 @@ namespace Nz
 		if (m_writeSockets.fd_count > 0)
 		{
 			m_readyToWriteSockets = m_writeSockets;
-			readSet = &m_readyToWriteSockets;
+			writeSet = &m_readyToWriteSockets;
 		}
 
 		timeval tv;
@@ -196,10 +220,63 @@ namespace Nz
 			return 0;
 		}
 
+		// select only leaves ready sockets in the sets, a socket ready for both operations is reported once
+		for (std::size_t i = 0; i < 2; ++i)
+		{
+			fd_set* readySet = (i == 0) ? readSet : writeSet;
+			if (!readySet)
+				continue;
+
+			SocketPollEvent event = (i == 0) ? SocketPollEvent_Read : SocketPollEvent_Write;
+			for (u_int j = 0; j < readySet->fd_count; ++j)
+			{
+				Entry& entry = m_entries[readySet->fd_array[j]];
+				if (entry.readyGeneration != m_generation)
+				{
+					entry.readyEvents = event;
+					entry.readyGeneration = m_generation;
+
+					m_readyEvents.push_back({ entry.owner, event, entry.userdata });
+				}
+				else
+				{
+					entry.readyEvents |= event;
+
+					for (SocketPoller::Event& readyEvent : m_readyEvents)
+					{
+						if (readyEvent.socket == entry.owner)
+						{
+							readyEvent.events |= event;
+							break;
+						}
+					}
+				}
+			}
+		}
+
 		if (error)
 			*error = SocketError_NoError;
 		#endif
 
 		return activeSockets;
 	}
+
+	bool SocketPollerImpl::IsReady(SocketHandle socket, SocketPollEvent event) const
+	{
+		#if NAZARA_NETWORK_POLL_SUPPORT
+		auto it = m_allSockets.find(socket);
+		if (it == m_allSockets.end())
+			return false;
+
+		const Entry& entry = m_entries[it->second];
+		#else
+		auto it = m_entries.find(socket);
+		if (it == m_entries.end())
+			return false;
+
+		const Entry& entry = it->second;
+		#endif
+
+		return entry.readyGeneration == m_generation && (entry.readyEvents & event);
+	}
 }
@@ -9,9 +9,9 @@
 
 #include <Nazara/Network/IpAddress.hpp>
 #include <Nazara/Network/SocketHandle.hpp>
+#include <Nazara/Network/SocketPoller.hpp>
 #include <Nazara/Network/Win32/SocketImpl.hpp>
 #include <unordered_map>
-#include <unordered_set>
 #include <vector>
 #include <winsock2.h>
 
@@ -25,22 +25,37 @@ namespace Nz
 
 			void Clear();
 
+			const std::vector<SocketPoller::Event>& GetReadyEvents() const;
+
 			bool IsReadyToRead(SocketHandle socket) const;
 			bool IsReadyToWrite(SocketHandle socket) const;
 			bool IsRegistered(SocketHandle socket) const;
 
-			bool RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags);
+			bool RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags, SocketPollMode mode, AbstractSocket* owner, void* userdata);
 			void UnregisterSocket(SocketHandle socket);
 
 			int Wait(int msTimeout, SocketError* error);
 
 		private:
+			struct Entry
+			{
+				AbstractSocket* owner;
+				SocketPollEventFlags readyEvents;
+				UInt64 readyGeneration;
+				void* userdata;
+			};
+
+			bool IsReady(SocketHandle socket, SocketPollEvent event) const;
+
+			std::vector<SocketPoller::Event> m_readyEvents;
+			UInt64 m_generation;
+
 			#if NAZARA_NETWORK_POLL_SUPPORT
-			std::unordered_set<SocketHandle> m_readyToReadSockets;
-			std::unordered_set<SocketHandle> m_readyToWriteSockets;
 			std::unordered_map<SocketHandle, std::size_t> m_allSockets;
+			std::vector<Entry> m_entries; //< Same indices as m_sockets
 			std::vector<PollSocket> m_sockets;
 			#else
+			std::unordered_map<SocketHandle, Entry> m_entries;
 			fd_set m_readSockets;
 			fd_set m_readyToReadSockets;
 			fd_set m_readyToWriteSockets;
@@ -0,0 +1,335 @@
+// Copyright (C) 2017 Jrme Leclercq
+// This file is part of the "Nazara Engine - Noise module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Noise/ChunkGenerator.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Noise/MixerBase.hpp>
+#include <Nazara/Noise/NoiseBase.hpp>
+#include <Nazara/Utility/IndexBuffer.hpp>
+#include <Nazara/Utility/IndexMapper.hpp>
+#include <Nazara/Utility/StaticMesh.hpp>
+#include <Nazara/Utility/VertexBuffer.hpp>
+#include <Nazara/Utility/VertexDeclaration.hpp>
+#include <Nazara/Utility/VertexMapper.hpp>
+#include <algorithm>
+#include <limits>
+#include <Nazara/Noise/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup noise
+	* \class Nz::ChunkGenerator
+	* \brief Noise class generating heightmap terrain chunks in the background, keeping the most recently used ones in a cache
+	*
+	* Chunks are requested by coordinates and generated by the TaskScheduler workers, which samples the noise row by row and builds the mesh of the chunk.
+	* Update hands the generated chunks over on the calling thread (through OnChunkGenerated) and evicts the least recently used chunks once the cache is full.
+	*
+	* A chunk of chunkSize cells per side has (chunkSize + 1) vertices, sharing their border with the neighbouring chunks.
+	* The chunk (x, y) starts at the world position (x * chunkSize * cellSize, y * chunkSize * cellSize) on the XZ plane, its heights going along the Y axis.
+	*
+	* \remark Meshes are built in software storage, since workers don't have a rendering context
+	* \remark The noise must not be modified while chunks are being generated
+	* \remark Request, Update and the other methods must be called from the same thread
+	*/
+
+	/*!
+	* \brief Constructs a ChunkGenerator object sampling a noise
+	*
+	* \param source Noise giving the heights, which must outlive the generator
+	* \param scale Scale applied to the coordinates before sampling the noise
+	* \param chunkSize Number of cells along each side of a chunk
+	* \param cellSize Distance between two samples
+	* \param heightScale Factor applied to the values of the noise
+	* \param cacheSize Maximum number of chunks kept in the cache
+	*/
+
+	ChunkGenerator::ChunkGenerator(const NoiseBase& source, float scale, unsigned int chunkSize, float cellSize, float heightScale, std::size_t cacheSize) :
+	ChunkGenerator([&source, scale](float* values, unsigned int count, float x, float y, float stepX) { source.FillRow(values, count, x, y, stepX, scale); }, chunkSize, cellSize, heightScale, cacheSize)
+	{
+	}
+
+	/*!
+	* \brief Constructs a ChunkGenerator object sampling a fractal noise
+	*
+	* \param source Fractal noise giving the heights, which must outlive the generator
+	* \param scale Scale applied to the coordinates before sampling the noise
+	* \param chunkSize Number of cells along each side of a chunk
+	* \param cellSize Distance between two samples
+	* \param heightScale Factor applied to the values of the noise
+	* \param cacheSize Maximum number of chunks kept in the cache
+	*/
+
+	ChunkGenerator::ChunkGenerator(const MixerBase& source, float scale, unsigned int chunkSize, float cellSize, float heightScale, std::size_t cacheSize) :
+	ChunkGenerator([&source, scale](float* values, unsigned int count, float x, float y, float stepX) { source.FillRow(values, count, x, y, stepX, scale); }, chunkSize, cellSize, heightScale, cacheSize)
+	{
+	}
+
+	/*!
+	* \brief Constructs a ChunkGenerator object with a custom height function
+	*
+	* \param rowFunction Function filling count heights at (x + i * stepX, y), called concurrently by multiple workers
+	* \param chunkSize Number of cells along each side of a chunk
+	* \param cellSize Distance between two samples
+	* \param heightScale Factor applied to the values of the function
+	* \param cacheSize Maximum number of chunks kept in the cache
+	*
+	* \remark Produces a NazaraAssert if chunkSize is zero
+	*/
+
+	ChunkGenerator::ChunkGenerator(RowFunction rowFunction, unsigned int chunkSize, float cellSize, float heightScale, std::size_t cacheSize) :
+	m_cacheSize(cacheSize),
+	m_rowFunction(std::move(rowFunction)),
+	m_cellSize(cellSize),
+	m_heightScale(heightScale),
+	m_chunkSize(chunkSize)
+	{
+		NazaraAssert(chunkSize > 0, "Chunk size must be over zero");
+	}
+
+	/*!
+	* \brief Destructs the object, waiting for the chunks being generated
+	*/
+
+	ChunkGenerator::~ChunkGenerator()
+	{
+		// Chunks stay pending until Update, there can only be running tasks if some are
+		if (!m_pendingChunks.empty())
+			TaskScheduler::WaitForTasks(m_tasks);
+	}
+
+	/*!
+	* \brief Drops every chunk, waiting for the ones being generated
+	*
+	* \remark OnChunkEvicted is signaled for each cached chunk, the pending ones are discarded
+	*/
+
+	void ChunkGenerator::Clear()
+	{
+		if (!m_pendingChunks.empty())
+		{
+			TaskScheduler::WaitForTasks(m_tasks);
+			m_pendingChunks.clear();
+
+			LockGuard lock(m_generatedChunksMutex);
+			m_generatedChunks.clear();
+		}
+
+		for (const Chunk& chunk : m_cachedChunks)
+			OnChunkEvicted(this, chunk);
+
+		m_cachedChunkByCoords.clear();
+		m_cachedChunks.clear();
+	}
+
+	/*!
+	* \brief Gets a generated chunk, marking it as the most recently used
+	* \return The chunk, or nullptr if it isn't cached
+	*
+	* \param coords Coordinates of the chunk
+	*
+	* \remark The chunk stays valid until it is evicted
+	*/
+
+	const ChunkGenerator::Chunk* ChunkGenerator::GetChunk(const Vector2i& coords)
+	{
+		auto it = m_cachedChunkByCoords.find(coords);
+		if (it == m_cachedChunkByCoords.end())
+			return nullptr;
+
+		m_cachedChunks.splice(m_cachedChunks.begin(), m_cachedChunks, it->second);
+		return &*it->second;
+	}
+
+	/*!
+	* \brief Requests a chunk to be generated
+	*
+	* \param coords Coordinates of the chunk
+	*
+	* \remark Does nothing if the chunk is already pending, a cached chunk is marked as the most recently used
+	*/
+
+	void ChunkGenerator::Request(const Vector2i& coords)
+	{
+		if (GetChunk(coords) || IsPending(coords))
+			return;
+
+		m_pendingChunks.insert(coords);
+
+		TaskScheduler::AddTask(m_tasks, [this, coords]()
+		{
+			Chunk chunk = GenerateChunk(coords);
+
+			LockGuard lock(m_generatedChunksMutex);
+			m_generatedChunks.emplace_back(std::move(chunk));
+		});
+		TaskScheduler::Run();
+	}
+
+	/*!
+	* \brief Sets the maximum number of chunks kept in the cache
+	*
+	* \param cacheSize Size of the cache
+	*
+	* \remark The least recently used chunks are evicted right away if there are too many of them
+	*/
+
+	void ChunkGenerator::SetCacheSize(std::size_t cacheSize)
+	{
+		m_cacheSize = cacheSize;
+
+		EvictChunks();
+	}
+
+	/*!
+	* \brief Hands the generated chunks over
+	*
+	* Signals OnChunkGenerated for each chunk generated since the last call, then evicts the least recently used chunks over the cache size
+	*/
+
+	void ChunkGenerator::Update()
+	{
+		std::vector<Chunk> generatedChunks;
+		{
+			LockGuard lock(m_generatedChunksMutex);
+			std::swap(generatedChunks, m_generatedChunks);
+		}
+
+		for (Chunk& chunk : generatedChunks)
+		{
+			m_pendingChunks.erase(chunk.coords);
+
+			m_cachedChunks.emplace_front(std::move(chunk));
+			m_cachedChunkByCoords[m_cachedChunks.front().coords] = m_cachedChunks.begin();
+
+			OnChunkGenerated(this, m_cachedChunks.front());
+		}
+
+		EvictChunks();
+	}
+
+	/*!
+	* \brief Waits for every requested chunk to be generated
+	*
+	* \remark The chunks are only handed over by the next Update
+	*/
+
+	void ChunkGenerator::Wait()
+	{
+		if (!m_pendingChunks.empty())
+			TaskScheduler::WaitForTasks(m_tasks);
+	}
+
+	void ChunkGenerator::EvictChunks()
+	{
+		while (m_cachedChunks.size() > m_cacheSize)
+		{
+			const Chunk& chunk = m_cachedChunks.back();
+			OnChunkEvicted(this, chunk);
+
+			m_cachedChunkByCoords.erase(chunk.coords);
+			m_cachedChunks.pop_back();
+		}
+	}
+
+	ChunkGenerator::Chunk ChunkGenerator::GenerateChunk(const Vector2i& coords) const
+	{
+		// One more sample on each side gives the normals of the border vertices, matching the neighbouring chunks
+		unsigned int sampleCount = m_chunkSize + 3;
+		int firstSampleX = coords.x * static_cast<int>(m_chunkSize) - 1;
+		int firstSampleY = coords.y * static_cast<int>(m_chunkSize) - 1;
+
+		std::vector<float> samples(sampleCount * sampleCount);
+		for (unsigned int row = 0; row < sampleCount; ++row)
+		{
+			float* rowSamples = &samples[row * sampleCount];
+			m_rowFunction(rowSamples, sampleCount, firstSampleX * m_cellSize, (firstSampleY + static_cast<int>(row)) * m_cellSize, m_cellSize);
+
+			for (unsigned int i = 0; i < sampleCount; ++i)
+				rowSamples[i] *= m_heightScale;
+		}
+
+		auto Height = [&](int x, int y)
+		{
+			return samples[(y + 1) * sampleCount + x + 1];
+		};
+
+		unsigned int vertexPerSide = m_chunkSize + 1;
+		unsigned int vertexCount = vertexPerSide * vertexPerSide;
+		unsigned int indexCount = m_chunkSize * m_chunkSize * 6;
+
+		Chunk chunk;
+		chunk.coords = coords;
+		chunk.heights.resize(vertexCount);
+
+		IndexBufferRef indexBuffer = IndexBuffer::New(vertexCount > std::numeric_limits<UInt16>::max(), indexCount, DataStorage_Software, 0);
+		VertexBufferRef vertexBuffer = VertexBuffer::New(VertexDeclaration::Get(VertexLayout_XYZ_Normal_UV), vertexCount, DataStorage_Software, 0);
+
+		float maxHeight = -std::numeric_limits<float>::infinity();
+		float minHeight = std::numeric_limits<float>::infinity();
+		{
+			VertexMapper vertexMapper(vertexBuffer, BufferAccess_WriteOnly);
+			SparsePtr<Vector3f> normalPtr = vertexMapper.GetComponentPtr<Vector3f>(VertexComponent_Normal);
+			SparsePtr<Vector3f> positionPtr = vertexMapper.GetComponentPtr<Vector3f>(VertexComponent_Position);
+			SparsePtr<Vector2f> uvPtr = vertexMapper.GetComponentPtr<Vector2f>(VertexComponent_TexCoord);
+
+			for (int y = 0; y < static_cast<int>(vertexPerSide); ++y)
+			{
+				for (int x = 0; x < static_cast<int>(vertexPerSide); ++x)
+				{
+					float height = Height(x, y);
+					chunk.heights[y * vertexPerSide + x] = height;
+
+					maxHeight = std::max(maxHeight, height);
+					minHeight = std::min(minHeight, height);
+
+					*normalPtr++ = Vector3f(Height(x - 1, y) - Height(x + 1, y), 2.f * m_cellSize, Height(x, y - 1) - Height(x, y + 1)).GetNormal();
+					*positionPtr++ = Vector3f(x * m_cellSize, height, y * m_cellSize);
+					*uvPtr++ = Vector2f(float(x) / m_chunkSize, float(y) / m_chunkSize);
+				}
+			}
+		}
+
+		{
+			IndexMapper indexMapper(indexBuffer, BufferAccess_WriteOnly);
+
+			std::size_t index = 0;
+			for (unsigned int y = 0; y < m_chunkSize; ++y)
+			{
+				for (unsigned int x = 0; x < m_chunkSize; ++x)
+				{
+					UInt32 a = y * vertexPerSide + x;
+					UInt32 b = a + 1;
+					UInt32 c = a + vertexPerSide;
+					UInt32 d = c + 1;
+
+					// Counter-clockwise when seen from above
+					indexMapper.Set(index++, a);
+					indexMapper.Set(index++, c);
+					indexMapper.Set(index++, b);
+
+					indexMapper.Set(index++, b);
+					indexMapper.Set(index++, c);
+					indexMapper.Set(index++, d);
+				}
+			}
+		}
+
+		float chunkLength = m_chunkSize * m_cellSize;
+
+		chunk.mesh = Mesh::New();
+		chunk.mesh->CreateStatic();
+
+		StaticMeshRef subMesh = StaticMesh::New(chunk.mesh);
+		subMesh->Create(vertexBuffer);
+		subMesh->SetAABB(Boxf(0.f, minHeight, 0.f, chunkLength, maxHeight - minHeight, chunkLength));
+		subMesh->SetIndexBuffer(indexBuffer);
+
+		chunk.mesh->AddSubMesh(subMesh);
+
+		return chunk;
+	}
+}
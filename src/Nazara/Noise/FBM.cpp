@@ -3,6 +3,8 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Noise/FBM.hpp>
+#include <algorithm>
+#include <vector>
 #include <Nazara/Noise/Debug.hpp>
 
 namespace Nz
@@ -11,6 +13,67 @@ namespace Nz
 	{
 	}
 
+	void FBM::FillRow(float* values, unsigned int count, float x, float y, float stepX, float scale) const
+	{
+		// Octaves are computed row by row, allowing the source to batch its samples
+		std::vector<float> octaveValues(count);
+		std::fill(values, values + count, 0.f);
+
+		for(int i = 0; i < m_octaves; ++i)
+		{
+			m_source.FillRow(octaveValues.data(), count, x, y, stepX, scale);
+
+			float exponent = m_exponent_array.at(i);
+			for (unsigned int j = 0; j < count; ++j)
+				values[j] += octaveValues[j] * exponent;
+
+			scale *= m_lacunarity;
+		}
+
+		float remainder = m_octaves - static_cast<int>(m_octaves);
+		if(std::fabs(remainder) > 0.01f)
+		{
+			m_source.FillRow(octaveValues.data(), count, x, y, stepX, scale);
+
+			float exponent = m_exponent_array.at(static_cast<int>(m_octaves-1));
+			for (unsigned int j = 0; j < count; ++j)
+				values[j] += remainder * octaveValues[j] * exponent;
+		}
+
+		for (unsigned int j = 0; j < count; ++j)
+			values[j] /= m_sum;
+	}
+
+	void FBM::FillRow(float* values, unsigned int count, float x, float y, float z, float stepX, float scale) const
+	{
+		std::vector<float> octaveValues(count);
+		std::fill(values, values + count, 0.f);
+
+		for(int i = 0; i < m_octaves; ++i)
+		{
+			m_source.FillRow(octaveValues.data(), count, x, y, z, stepX, scale);
+
+			float exponent = m_exponent_array.at(i);
+			for (unsigned int j = 0; j < count; ++j)
+				values[j] += octaveValues[j] * exponent;
+
+			scale *= m_lacunarity;
+		}
+
+		float remainder = m_octaves - static_cast<int>(m_octaves);
+		if(std::fabs(remainder) > 0.01f)
+		{
+			m_source.FillRow(octaveValues.data(), count, x, y, z, stepX, scale);
+
+			float exponent = m_exponent_array.at(static_cast<int>(m_octaves-1));
+			for (unsigned int j = 0; j < count; ++j)
+				values[j] += remainder * octaveValues[j] * exponent;
+		}
+
+		for (unsigned int j = 0; j < count; ++j)
+			values[j] /= m_sum;
+	}
+
 	///TODO: Handle with variadic templates
 	float FBM::Get(float x, float y, float scale) const
 	{
@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Noise/MixerBase.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
 #include <cmath>
 #include <Nazara/Noise/Debug.hpp>
 
@@ -16,6 +17,97 @@ namespace Nz
 		Recompute();
 	}
 
+	/*!
+	* \brief Fills a grid of samples of the noise, row by row
+	*
+	* \param values Array of width * height values, filled in row-major order
+	* \param width Number of samples per row
+	* \param height Number of rows
+	* \param origin Coordinates of the first sample
+	* \param step Distance between two consecutive samples
+	* \param scale Scale applied to the coordinates
+	*
+	* \remark values[y * width + x] equals Get(origin.x + x * step.x, origin.y + y * step.y, scale)
+	* \remark Rows are split between the workers of the TaskScheduler
+	*/
+
+	void MixerBase::Fill(float* values, unsigned int width, unsigned int height, const Vector2f& origin, const Vector2f& step, float scale) const
+	{
+		TaskScheduler::ParallelFor(0, height, 0, [&](std::size_t first, std::size_t last)
+		{
+			for (std::size_t row = first; row < last; ++row)
+				FillRow(&values[row * width], width, origin.x, origin.y + row * step.y, step.x, scale);
+		});
+	}
+
+	/*!
+	* \brief Fills a grid of samples of the noise, row by row
+	*
+	* \param values Array of width * height * depth values, filled in row-major order (then slice by slice)
+	* \param width Number of samples per row
+	* \param height Number of rows per slice
+	* \param depth Number of slices
+	* \param origin Coordinates of the first sample
+	* \param step Distance between two consecutive samples
+	* \param scale Scale applied to the coordinates
+	*
+	* \remark values[(z * height + y) * width + x] equals Get(origin.x + x * step.x, origin.y + y * step.y, origin.z + z * step.z, scale)
+	* \remark Rows are split between the workers of the TaskScheduler
+	*/
+
+	void MixerBase::Fill(float* values, unsigned int width, unsigned int height, unsigned int depth, const Vector3f& origin, const Vector3f& step, float scale) const
+	{
+		TaskScheduler::ParallelFor(0, std::size_t(height) * depth, 0, [&](std::size_t first, std::size_t last)
+		{
+			for (std::size_t row = first; row < last; ++row)
+			{
+				std::size_t y = row % height;
+				std::size_t z = row / height;
+
+				FillRow(&values[row * width], width, origin.x, origin.y + y * step.y, origin.z + z * step.z, step.x, scale);
+			}
+		});
+	}
+
+	/*!
+	* \brief Fills a row of samples of the noise
+	*
+	* \param values Array of count values
+	* \param count Number of samples
+	* \param x X coordinate of the first sample
+	* \param y Y coordinate of the samples
+	* \param stepX Distance between two consecutive samples
+	* \param scale Scale applied to the coordinates
+	*
+	* \remark values[i] equals Get(x + i * stepX, y, scale), implementations may compute multiple samples at once
+	*/
+
+	void MixerBase::FillRow(float* values, unsigned int count, float x, float y, float stepX, float scale) const
+	{
+		for (unsigned int i = 0; i < count; ++i)
+			values[i] = Get(x + i * stepX, y, scale);
+	}
+
+	/*!
+	* \brief Fills a row of samples of the noise
+	*
+	* \param values Array of count values
+	* \param count Number of samples
+	* \param x X coordinate of the first sample
+	* \param y Y coordinate of the samples
+	* \param z Z coordinate of the samples
+	* \param stepX Distance between two consecutive samples
+	* \param scale Scale applied to the coordinates
+	*
+	* \remark values[i] equals Get(x + i * stepX, y, z, scale), implementations may compute multiple samples at once
+	*/
+
+	void MixerBase::FillRow(float* values, unsigned int count, float x, float y, float z, float stepX, float scale) const
+	{
+		for (unsigned int i = 0; i < count; ++i)
+			values[i] = Get(x + i * stepX, y, z, scale);
+	}
+
 	float MixerBase::GetHurstParameter() const
 	{
 		return m_hurst;
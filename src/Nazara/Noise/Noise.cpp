@@ -3,10 +3,11 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Noise/Noise.hpp>
-#include <Nazara/Core/Core.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Noise/Config.hpp>
+#include <Nazara/Utility/Utility.hpp>
 #include <Nazara/Noise/Debug.hpp>
 
 namespace Nz
@@ -19,10 +20,12 @@ namespace Nz
 			return true; // Déjà initialisé
 		}
 
+		Profiler::Scope profilerScope("Noise::Initialize");
+
 		// Initialisation des dépendances
-		if (!Core::Initialize())
+		if (!Utility::Initialize())
 		{
-			NazaraError("Failed to initialize core module");
+			NazaraError("Failed to initialize utility module");
 			Uninitialize();
 
 			return false;
@@ -58,7 +61,7 @@ namespace Nz
 		NazaraNotice("Uninitialized: Noise module");
 
 		// Libération des dépendances
-		Core::Uninitialize();
+		Utility::Uninitialize();
 	}
 
 	unsigned int Noise::s_moduleReferenceCounter = 0;
@@ -4,6 +4,7 @@
 
 #include <Nazara/Noise/Perlin.hpp>
 #include <Nazara/Noise/NoiseTools.hpp>
+#include <Nazara/Noise/SimdTools.hpp>
 #include <Nazara/Noise/Debug.hpp>
 
 namespace Nz
@@ -15,6 +16,130 @@ namespace Nz
 		Shuffle();
 	}
 
+	void Perlin::FillRow(float* values, unsigned int count, float x, float y, float stepX, float scale) const
+	{
+		unsigned int i = 0;
+
+		#if defined(NAZARA_SIMD_SSE2)
+		// Samples of a row share their Y coordinate, only the X part of the cells is computed per sample
+		float yc = y * scale;
+		int y0 = fastfloor(yc);
+		int jj = y0 & 255;
+
+		std::size_t row0 = m_permutations[jj];
+		std::size_t row1 = m_permutations[jj + 1];
+
+		__m128 tempy0 = _mm_set1_ps(yc - y0);
+		__m128 tempy1 = _mm_set1_ps(yc - (y0 + 1));
+		__m128 Cy = Fade4(tempy0);
+
+		alignas(16) int ii[4];
+		auto GradientDot = [&](std::size_t offset, __m128 tempx, __m128 tempy)
+		{
+			const Vector2f& g0 = s_gradients2[m_permutations[ii[0] + offset] & 7];
+			const Vector2f& g1 = s_gradients2[m_permutations[ii[1] + offset] & 7];
+			const Vector2f& g2 = s_gradients2[m_permutations[ii[2] + offset] & 7];
+			const Vector2f& g3 = s_gradients2[m_permutations[ii[3] + offset] & 7];
+
+			__m128 gx = _mm_setr_ps(g0.x, g1.x, g2.x, g3.x);
+			__m128 gy = _mm_setr_ps(g0.y, g1.y, g2.y, g3.y);
+
+			return _mm_add_ps(_mm_mul_ps(gx, tempx), _mm_mul_ps(gy, tempy));
+		};
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 xc = _mm_mul_ps(SampleCoords4(x, i, stepX), _mm_set1_ps(scale));
+			__m128i x0 = FastFloor4(xc);
+			_mm_store_si128(reinterpret_cast<__m128i*>(ii), _mm_and_si128(x0, _mm_set1_epi32(255)));
+
+			__m128 tempx0 = _mm_sub_ps(xc, _mm_cvtepi32_ps(x0));
+			__m128 tempx1 = _mm_sub_ps(xc, _mm_cvtepi32_ps(_mm_add_epi32(x0, _mm_set1_epi32(1))));
+			__m128 Cx = Fade4(tempx0);
+
+			__m128 s = GradientDot(row0,     tempx0, tempy0);
+			__m128 t = GradientDot(row0 + 1, tempx1, tempy0);
+			__m128 u = GradientDot(row1,     tempx0, tempy1);
+			__m128 v = GradientDot(row1 + 1, tempx1, tempy1);
+
+			_mm_storeu_ps(&values[i], Lerp4(Lerp4(s, t, Cx), Lerp4(u, v, Cx), Cy));
+		}
+		#endif
+
+		for (; i < count; ++i)
+			values[i] = Perlin::Get(x + i * stepX, y, scale);
+	}
+
+	void Perlin::FillRow(float* values, unsigned int count, float x, float y, float z, float stepX, float scale) const
+	{
+		unsigned int i = 0;
+
+		#if defined(NAZARA_SIMD_SSE2)
+		// Samples of a row share their Y and Z coordinates, only the X part of the cells is computed per sample
+		float yc = y * scale;
+		float zc = z * scale;
+		int y0 = fastfloor(yc);
+		int z0 = fastfloor(zc);
+		int jj = y0 & 255;
+		int kk = z0 & 255;
+
+		std::size_t row00 = m_permutations[jj +     m_permutations[kk]];
+		std::size_t row10 = m_permutations[jj + 1 + m_permutations[kk]];
+		std::size_t row01 = m_permutations[jj +     m_permutations[kk + 1]];
+		std::size_t row11 = m_permutations[jj + 1 + m_permutations[kk + 1]];
+
+		__m128 tempy0 = _mm_set1_ps(yc - y0);
+		__m128 tempy1 = _mm_set1_ps(yc - (y0 + 1));
+		__m128 tempz0 = _mm_set1_ps(zc - z0);
+		__m128 tempz1 = _mm_set1_ps(zc - (z0 + 1));
+		__m128 Cy = Fade4(tempy0);
+		__m128 Cz = Fade4(tempz0);
+
+		alignas(16) int ii[4];
+		auto GradientDot = [&](std::size_t offset, __m128 tempx, __m128 tempy, __m128 tempz)
+		{
+			const Vector3f& g0 = s_gradients3[m_permutations[ii[0] + offset] & 15];
+			const Vector3f& g1 = s_gradients3[m_permutations[ii[1] + offset] & 15];
+			const Vector3f& g2 = s_gradients3[m_permutations[ii[2] + offset] & 15];
+			const Vector3f& g3 = s_gradients3[m_permutations[ii[3] + offset] & 15];
+
+			__m128 gx = _mm_setr_ps(g0.x, g1.x, g2.x, g3.x);
+			__m128 gy = _mm_setr_ps(g0.y, g1.y, g2.y, g3.y);
+			__m128 gz = _mm_setr_ps(g0.z, g1.z, g2.z, g3.z);
+
+			return _mm_add_ps(_mm_add_ps(_mm_mul_ps(gx, tempx), _mm_mul_ps(gy, tempy)), _mm_mul_ps(gz, tempz));
+		};
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 xc = _mm_mul_ps(SampleCoords4(x, i, stepX), _mm_set1_ps(scale));
+			__m128i x0 = FastFloor4(xc);
+			_mm_store_si128(reinterpret_cast<__m128i*>(ii), _mm_and_si128(x0, _mm_set1_epi32(255)));
+
+			__m128 tempx0 = _mm_sub_ps(xc, _mm_cvtepi32_ps(x0));
+			__m128 tempx1 = _mm_sub_ps(xc, _mm_cvtepi32_ps(_mm_add_epi32(x0, _mm_set1_epi32(1))));
+			__m128 Cx = Fade4(tempx0);
+
+			__m128 s0 = GradientDot(row00,     tempx0, tempy0, tempz0);
+			__m128 t0 = GradientDot(row00 + 1, tempx1, tempy0, tempz0);
+			__m128 u0 = GradientDot(row10,     tempx0, tempy1, tempz0);
+			__m128 v0 = GradientDot(row10 + 1, tempx1, tempy1, tempz0);
+			__m128 s1 = GradientDot(row01,     tempx0, tempy0, tempz1);
+			__m128 t1 = GradientDot(row01 + 1, tempx1, tempy0, tempz1);
+			__m128 u1 = GradientDot(row11,     tempx0, tempy1, tempz1);
+			__m128 v1 = GradientDot(row11 + 1, tempx1, tempy1, tempz1);
+
+			__m128 Li5 = Lerp4(Lerp4(s0, t0, Cx), Lerp4(u0, v0, Cx), Cy);
+			__m128 Li6 = Lerp4(Lerp4(s1, t1, Cx), Lerp4(u1, v1, Cx), Cy);
+
+			_mm_storeu_ps(&values[i], Lerp4(Li5, Li6, Cz));
+		}
+		#endif
+
+		for (; i < count; ++i)
+			values[i] = Perlin::Get(x + i * stepX, y, z, scale);
+	}
+
 	float Perlin::Get(float x, float y, float scale) const
 	{
 		float xc, yc;
@@ -0,0 +1,50 @@
+// Copyright (C) 2017 Rmi Bges
+// This file is part of the "Nazara Engine - Noise module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NOISE_SIMDTOOLS_HPP
+#define NAZARA_NOISE_SIMDTOOLS_HPP
+
+#include <Nazara/Prerequisites.hpp>
+
+#if defined(NAZARA_SIMD_SSE2)
+#include <emmintrin.h>
+
+namespace Nz
+{
+	// Four-lane versions of the scalar operations of the noises, giving the same results
+
+	inline __m128i FastFloor4(__m128 n)
+	{
+		__m128i positive = _mm_castps_si128(_mm_cmpge_ps(n, _mm_setzero_ps()));
+		__m128i truncated = _mm_cvttps_epi32(n);
+		__m128i lowered = _mm_cvttps_epi32(_mm_sub_ps(n, _mm_set1_ps(1.f)));
+
+		return _mm_or_si128(_mm_and_si128(positive, truncated), _mm_andnot_si128(positive, lowered));
+	}
+
+	// t * t * t * (t * (t * 6 - 15) + 10)
+	inline __m128 Fade4(__m128 t)
+	{
+		__m128 cube = _mm_mul_ps(_mm_mul_ps(t, t), t);
+		return _mm_mul_ps(cube, _mm_add_ps(_mm_mul_ps(t, _mm_sub_ps(_mm_mul_ps(t, _mm_set1_ps(6.f)), _mm_set1_ps(15.f))), _mm_set1_ps(10.f)));
+	}
+
+	// a + t * (b - a)
+	inline __m128 Lerp4(__m128 a, __m128 b, __m128 t)
+	{
+		return _mm_add_ps(a, _mm_mul_ps(t, _mm_sub_ps(b, a)));
+	}
+
+	// Coordinates x + i * step of four consecutive samples, starting at the index first
+	inline __m128 SampleCoords4(float x, unsigned int first, float step)
+	{
+		__m128 indices = _mm_setr_ps(float(first), float(first + 1), float(first + 2), float(first + 3));
+		return _mm_add_ps(_mm_set1_ps(x), _mm_mul_ps(indices, _mm_set1_ps(step)));
+	}
+}
+#endif
+
+#endif // NAZARA_NOISE_SIMDTOOLS_HPP
@@ -4,6 +4,7 @@
 
 #include <Nazara/Noise/Simplex.hpp>
 #include <Nazara/Noise/NoiseTools.hpp>
+#include <Nazara/Noise/SimdTools.hpp>
 #include <Nazara/Noise/Debug.hpp>
 
 namespace Nz
@@ -24,6 +25,83 @@ namespace Nz
 		Shuffle();
 	}
 
+	void Simplex::FillRow(float* values, unsigned int count, float x, float y, float stepX, float scale) const
+	{
+		unsigned int i = 0;
+
+		#if defined(NAZARA_SIMD_SSE2)
+		// The simplex of every sample depends on both coordinates, each lane goes through the whole scalar computation
+		__m128 yc = _mm_set1_ps(y * scale);
+		__m128 unskewCoeff = _mm_set1_ps(s_UnskewCoeff2D);
+		__m128i one = _mm_set1_epi32(1);
+
+		alignas(16) int offsetX[4];
+		alignas(16) int offsetY[4];
+		alignas(16) int off1X[4];
+		alignas(16) int off1Y[4];
+		auto Contribution = [&](const std::size_t (&gi)[4], __m128 dx, __m128 dy)
+		{
+			__m128 gx = _mm_setr_ps(s_gradients2[gi[0]].x, s_gradients2[gi[1]].x, s_gradients2[gi[2]].x, s_gradients2[gi[3]].x);
+			__m128 gy = _mm_setr_ps(s_gradients2[gi[0]].y, s_gradients2[gi[1]].y, s_gradients2[gi[2]].y, s_gradients2[gi[3]].y);
+
+			__m128 c = _mm_sub_ps(_mm_sub_ps(_mm_set1_ps(0.5f), _mm_mul_ps(dx, dx)), _mm_mul_ps(dy, dy));
+			__m128 c4 = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(c, c), c), c);
+			__m128 n = _mm_mul_ps(c4, _mm_add_ps(_mm_mul_ps(gx, dx), _mm_mul_ps(gy, dy)));
+
+			return _mm_and_ps(_mm_cmpgt_ps(c, _mm_setzero_ps()), n);
+		};
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 xc = _mm_mul_ps(SampleCoords4(x, i, stepX), _mm_set1_ps(scale));
+
+			__m128 sum = _mm_mul_ps(_mm_add_ps(xc, yc), _mm_set1_ps(s_SkewCoeff2D));
+			__m128i skewedCubeOriginX = FastFloor4(_mm_add_ps(xc, sum));
+			__m128i skewedCubeOriginY = FastFloor4(_mm_add_ps(yc, sum));
+
+			sum = _mm_mul_ps(_mm_cvtepi32_ps(_mm_add_epi32(skewedCubeOriginX, skewedCubeOriginY)), unskewCoeff);
+			__m128 distX = _mm_sub_ps(xc, _mm_sub_ps(_mm_cvtepi32_ps(skewedCubeOriginX), sum));
+			__m128 distY = _mm_sub_ps(yc, _mm_sub_ps(_mm_cvtepi32_ps(skewedCubeOriginY), sum));
+
+			__m128i xFirst = _mm_castps_si128(_mm_cmpgt_ps(distX, distY));
+			__m128i off1x = _mm_and_si128(xFirst, one);
+			__m128i off1y = _mm_andnot_si128(xFirst, one);
+			_mm_store_si128(reinterpret_cast<__m128i*>(off1X), off1x);
+			_mm_store_si128(reinterpret_cast<__m128i*>(off1Y), off1y);
+			_mm_store_si128(reinterpret_cast<__m128i*>(offsetX), _mm_and_si128(skewedCubeOriginX, _mm_set1_epi32(255)));
+			_mm_store_si128(reinterpret_cast<__m128i*>(offsetY), _mm_and_si128(skewedCubeOriginY, _mm_set1_epi32(255)));
+
+			__m128 signMask = _mm_set1_ps(-0.f);
+			__m128 d0x = _mm_xor_ps(distX, signMask);
+			__m128 d0y = _mm_xor_ps(distY, signMask);
+			__m128 d1x = _mm_sub_ps(_mm_add_ps(d0x, _mm_cvtepi32_ps(off1x)), unskewCoeff);
+			__m128 d1y = _mm_sub_ps(_mm_add_ps(d0y, _mm_cvtepi32_ps(off1y)), unskewCoeff);
+			__m128 d2x = _mm_add_ps(d0x, _mm_set1_ps(1.f - 2.f * s_UnskewCoeff2D));
+			__m128 d2y = _mm_add_ps(d0y, _mm_set1_ps(1.f - 2.f * s_UnskewCoeff2D));
+
+			std::size_t gi0[4], gi1[4], gi2[4];
+			for (unsigned int lane = 0; lane < 4; ++lane)
+			{
+				gi0[lane] = m_permutations[offsetX[lane] + m_permutations[offsetY[lane]]] & 7;
+				gi1[lane] = m_permutations[offsetX[lane] + off1X[lane] + m_permutations[offsetY[lane] + off1Y[lane]]] & 7;
+				gi2[lane] = m_permutations[offsetX[lane] + 1 + m_permutations[offsetY[lane] + 1]] & 7;
+			}
+
+			__m128 n = _mm_add_ps(_mm_add_ps(Contribution(gi0, d0x, d0y), Contribution(gi1, d1x, d1y)), Contribution(gi2, d2x, d2y));
+			_mm_storeu_ps(&values[i], _mm_mul_ps(n, _mm_set1_ps(70.f)));
+		}
+		#endif
+
+		for (; i < count; ++i)
+			values[i] = Simplex::Get(x + i * stepX, y, scale);
+	}
+
+	void Simplex::FillRow(float* values, unsigned int count, float x, float y, float z, float stepX, float scale) const
+	{
+		for (unsigned int i = 0; i < count; ++i)
+			values[i] = Simplex::Get(x + i * stepX, y, z, scale);
+	}
+
 	float Simplex::Get(float x, float y, float scale) const
 	{
 		float xc = x * scale;
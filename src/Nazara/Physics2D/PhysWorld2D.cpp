@@ -3,14 +3,69 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Physics2D/PhysWorld2D.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/MemoryHelper.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
 #include <chipmunk/chipmunk.h>
+
+// Chipmunk only declares its public functions with C linkage
+extern "C"
+{
+	#include <chipmunk/chipmunk_private.h>
+	#include <chipmunk/cpHastySpace.h>
+}
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <Nazara/Physics2D/Debug.hpp>
 
 namespace Nz
 {
 	namespace
 	{
+		// States are raw copies, they are meant to be restored by the process which saved them
+		struct BodyState
+		{
+			cpBody* body;
+			cpVect force;
+			cpVect position;
+			cpVect velocity;
+			cpFloat angle;
+			cpFloat angularVelocity;
+			cpFloat torque;
+		};
+
+		struct alignas(cpFloat) StateHeader
+		{
+			UInt32 bodyCount;
+			UInt32 arbiterCount;
+			float timestepAccumulator;
+		};
+
+		struct ArbiterState
+		{
+			struct Contact
+			{
+				cpHashValue hash;
+				cpFloat normalImpulse;
+				cpFloat tangentImpulse;
+			};
+
+			const cpShape* shapeA;
+			const cpShape* shapeB;
+			Contact contacts[CP_MAX_CONTACTS_PER_ARBITER];
+			cpTimestamp ticks;
+			int contactCount;
+			cpArbiterState arbiterState;
+		};
+
+		bool operator<(const ArbiterState& lhs, const ArbiterState& rhs)
+		{
+			return std::less<const cpShape*>()(lhs.shapeA, rhs.shapeA) || (lhs.shapeA == rhs.shapeA && std::less<const cpShape*>()(lhs.shapeB, rhs.shapeB));
+		}
+
 		Color CpDebugColorToColor(cpSpaceDebugColor c)
 		{
 			return Color{ static_cast<Nz::UInt8>(c.r * 255.f), static_cast<Nz::UInt8>(c.g * 255.f), static_cast<Nz::UInt8>(c.b * 255.f), static_cast<Nz::UInt8>(c.a * 255.f) };
@@ -80,17 +135,44 @@ namespace Nz
 	}
 
 	PhysWorld2D::PhysWorld2D() :
+	PhysWorld2D(CreationParams())
+	{
+	}
+
+	PhysWorld2D::PhysWorld2D(const CreationParams& params) :
+	m_droppedContactEventCount(0),
 	m_maxStepCount(50),
 	m_stepSize(0.005f),
-	m_timestepAccumulator(0.f)
+	m_timestepAccumulator(0.f),
+	m_isUsingParallelSolver(params.parallelSolver),
+	m_isUsingSpatialHash(false)
 	{
-		m_handle = cpSpaceNew();
+		if (m_isUsingParallelSolver)
+		{
+			// Chipmunk caps the thread count itself (two threads at the moment)
+			std::size_t threadCount = (params.threadCount > 0) ? params.threadCount : TaskScheduler::GetWorkerCount();
+
+			m_handle = cpHastySpaceNew();
+			cpHastySpaceSetThreads(m_handle, static_cast<unsigned long>(threadCount));
+		}
+		else
+			m_handle = cpSpaceNew();
+
 		cpSpaceSetUserData(m_handle, this);
 	}
 
 	PhysWorld2D::~PhysWorld2D()
 	{
-		cpSpaceFree(m_handle);
+		if (m_isUsingParallelSolver)
+			cpHastySpaceFree(m_handle);
+		else
+			cpSpaceFree(m_handle);
+	}
+
+	void PhysWorld2D::ClearContactEvents()
+	{
+		m_contactEvents.clear();
+		m_droppedContactEventCount = 0;
 	}
 
 	void PhysWorld2D::DebugDraw(const DebugDrawOptions& options, bool drawShapes, bool drawConstraints, bool drawCollisions)
@@ -129,11 +211,36 @@ namespace Nz
 		cpSpaceDebugDraw(m_handle, &drawOptions);
 	}
 
+	float PhysWorld2D::GetCollisionBias() const
+	{
+		return float(cpSpaceGetCollisionBias(m_handle));
+	}
+
+	float PhysWorld2D::GetCollisionSlop() const
+	{
+		return float(cpSpaceGetCollisionSlop(m_handle));
+	}
+
+	std::size_t PhysWorld2D::GetContactEventCapacity() const
+	{
+		return m_contactEvents.capacity();
+	}
+
+	const std::vector<PhysWorld2D::ContactEvent>& PhysWorld2D::GetContactEvents() const
+	{
+		return m_contactEvents;
+	}
+
 	float PhysWorld2D::GetDamping() const
 	{
 		return float(cpSpaceGetDamping(m_handle));
 	}
 
+	std::size_t PhysWorld2D::GetDroppedContactEventCount() const
+	{
+		return m_droppedContactEventCount;
+	}
+
 	Vector2f PhysWorld2D::GetGravity() const
 	{
 		cpVect gravity = cpSpaceGetGravity(m_handle);
@@ -160,6 +267,16 @@ namespace Nz
 		return m_stepSize;
 	}
 
+	std::size_t PhysWorld2D::GetThreadCount() const
+	{
+		return (m_isUsingParallelSolver) ? cpHastySpaceGetThreads(m_handle) : 1;
+	}
+
+	bool PhysWorld2D::IsUsingParallelSolver() const
+	{
+		return m_isUsingParallelSolver;
+	}
+
 	bool PhysWorld2D::NearestBodyQuery(const Vector2f & from, float maxDistance, Nz::UInt32 collisionGroup, Nz::UInt32 categoryMask, Nz::UInt32 collisionMask, RigidBody2D** nearestBody)
 	{
 		cpShapeFilter filter = cpShapeFilterNew(collisionGroup, categoryMask, collisionMask);
@@ -258,6 +375,50 @@ namespace Nz
 		}
 	}
 
+	std::size_t PhysWorld2D::RaycastQueryFirst(const Raycast* raycasts, std::size_t raycastCount, Nz::UInt32 collisionGroup, Nz::UInt32 categoryMask, Nz::UInt32 collisionMask, RaycastHit* hitInfos)
+	{
+		cpShapeFilter filter = cpShapeFilterNew(collisionGroup, categoryMask, collisionMask);
+
+		std::atomic_size_t hitCount(0);
+		auto processRaycasts = [&](std::size_t firstRaycast, std::size_t lastRaycast)
+		{
+			std::size_t chunkHitCount = 0;
+			for (std::size_t i = firstRaycast; i < lastRaycast; ++i)
+			{
+				const Raycast& raycast = raycasts[i];
+				RaycastHit& hitInfo = hitInfos[i];
+
+				cpSegmentQueryInfo queryInfo;
+				if (cpSpaceSegmentQueryFirst(m_handle, { raycast.from.x, raycast.from.y }, { raycast.to.x, raycast.to.y }, raycast.radius, filter, &queryInfo))
+				{
+					hitInfo.fraction = float(queryInfo.alpha);
+					hitInfo.hitNormal.Set(Nz::Vector2<cpFloat>(queryInfo.normal.x, queryInfo.normal.y));
+					hitInfo.hitPos.Set(Nz::Vector2<cpFloat>(queryInfo.point.x, queryInfo.point.y));
+					hitInfo.nearestBody = static_cast<Nz::RigidBody2D*>(cpShapeGetUserData(queryInfo.shape));
+
+					chunkHitCount++;
+				}
+				else
+				{
+					hitInfo.fraction = 1.f;
+					hitInfo.hitNormal = Nz::Vector2f::Zero();
+					hitInfo.hitPos = raycast.to;
+					hitInfo.nearestBody = nullptr;
+				}
+			}
+
+			hitCount += chunkHitCount;
+		};
+
+		// Querying a bounding box tree doesn't modify it, unlike the spatial hash which stamps its cells
+		if (m_isUsingSpatialHash)
+			processRaycasts(0, raycastCount);
+		else
+			TaskScheduler::ParallelFor(0, raycastCount, 0, processRaycasts);
+
+		return hitCount;
+	}
+
 	void PhysWorld2D::RegionQuery(const Nz::Rectf& boundingBox, Nz::UInt32 collisionGroup, Nz::UInt32 categoryMask, Nz::UInt32 collisionMask, std::vector<Nz::RigidBody2D*>* bodies)
 	{
 		using ResultType = decltype(bodies);
@@ -272,6 +433,57 @@ namespace Nz
 		cpSpaceBBQuery(m_handle, cpBBNew(boundingBox.x, boundingBox.y, boundingBox.x + boundingBox.width, boundingBox.y + boundingBox.height), filter, callback, bodies);
 	}
 
+	void PhysWorld2D::RegionQuery(const Nz::Rectf* boundingBoxes, std::size_t boxCount, Nz::UInt32 collisionGroup, Nz::UInt32 categoryMask, Nz::UInt32 collisionMask, Nz::RigidBody2D** bodies, std::size_t maxBodyPerBox, std::size_t* bodyCounts)
+	{
+		struct QueryContext
+		{
+			cpBB bb;
+			cpShapeFilter filter;
+			Nz::RigidBody2D** bodies;
+			std::size_t bodyCount;
+			std::size_t maxBodyCount;
+		};
+
+		auto callback = [](void* data, void* object, cpCollisionID id, void* /*userdata*/) -> cpCollisionID
+		{
+			QueryContext* context = static_cast<QueryContext*>(data);
+			cpShape* shape = static_cast<cpShape*>(object);
+
+			if (context->bodyCount < context->maxBodyCount && !cpShapeFilterReject(shape->filter, context->filter) && cpBBIntersects(context->bb, shape->bb))
+				context->bodies[context->bodyCount++] = static_cast<Nz::RigidBody2D*>(cpShapeGetUserData(shape));
+
+			return id;
+		};
+
+		cpShapeFilter filter = cpShapeFilterNew(collisionGroup, categoryMask, collisionMask);
+
+		auto processBoxes = [&](std::size_t firstBox, std::size_t lastBox)
+		{
+			for (std::size_t i = firstBox; i < lastBox; ++i)
+			{
+				const Nz::Rectf& boundingBox = boundingBoxes[i];
+
+				QueryContext context;
+				context.bb = cpBBNew(boundingBox.x, boundingBox.y, boundingBox.x + boundingBox.width, boundingBox.y + boundingBox.height);
+				context.filter = filter;
+				context.bodies = &bodies[i * maxBodyPerBox];
+				context.bodyCount = 0;
+				context.maxBodyCount = maxBodyPerBox;
+
+				// The spatial indices are queried directly, as cpSpaceBBQuery locks the space which can't be done from several threads
+				cpSpatialIndexQuery(m_handle->dynamicShapes, &context, context.bb, callback, nullptr);
+				cpSpatialIndexQuery(m_handle->staticShapes, &context, context.bb, callback, nullptr);
+
+				bodyCounts[i] = context.bodyCount;
+			}
+		};
+
+		if (m_isUsingSpatialHash)
+			processBoxes(0, boxCount);
+		else
+			TaskScheduler::ParallelFor(0, boxCount, 0, processBoxes);
+	}
+
 	void PhysWorld2D::RegisterCallbacks(unsigned int collisionId, const Callback& callbacks)
 	{
 		InitCallbacks(cpSpaceAddWildcardHandler(m_handle, collisionId), callbacks);
@@ -282,6 +494,199 @@ namespace Nz
 		InitCallbacks(cpSpaceAddCollisionHandler(m_handle, collisionIdA, collisionIdB), callbacks);
 	}
 
+	void PhysWorld2D::RegisterContactEvents(unsigned int collisionId)
+	{
+		InitContactEvents(cpSpaceAddWildcardHandler(m_handle, collisionId));
+	}
+
+	void PhysWorld2D::RegisterContactEvents(unsigned int collisionIdA, unsigned int collisionIdB)
+	{
+		InitContactEvents(cpSpaceAddCollisionHandler(m_handle, collisionIdA, collisionIdB));
+	}
+
+	bool PhysWorld2D::RestoreState(const ByteArray& state)
+	{
+		NazaraAssert(!cpSpaceIsLocked(m_handle), "State cannot be restored while the world is being stepped");
+
+		if (state.GetSize() < sizeof(StateHeader))
+		{
+			NazaraError("Invalid state");
+			return false;
+		}
+
+		StateHeader header;
+		std::memcpy(&header, state.GetConstBuffer(), sizeof(StateHeader));
+
+		if (state.GetSize() != sizeof(StateHeader) + header.bodyCount * sizeof(BodyState) + header.arbiterCount * sizeof(ArbiterState))
+		{
+			NazaraError("Invalid state");
+			return false;
+		}
+
+		const BodyState* bodyStates = reinterpret_cast<const BodyState*>(state.GetConstBuffer() + sizeof(StateHeader));
+		const ArbiterState* arbiterStates = reinterpret_cast<const ArbiterState*>(bodyStates + header.bodyCount);
+
+		for (UInt32 i = 0; i < header.bodyCount; ++i)
+		{
+			const BodyState& bodyState = bodyStates[i];
+
+			// Chipmunk values are restored as is, going through RigidBody2D would round them to floats
+			cpBodySetPosition(bodyState.body, bodyState.position);
+			cpBodySetAngle(bodyState.body, bodyState.angle);
+			cpBodySetVelocity(bodyState.body, bodyState.velocity);
+			cpBodySetAngularVelocity(bodyState.body, bodyState.angularVelocity);
+			cpBodySetForce(bodyState.body, bodyState.force);
+			cpBodySetTorque(bodyState.body, bodyState.torque);
+
+			cpSpaceReindexShapesForBody(m_handle, bodyState.body);
+
+			static_cast<RigidBody2D*>(cpBodyGetUserData(bodyState.body))->m_transformChanged = true;
+		}
+
+		// Cached impulses are used by the solver to warm start the next step, they are part of the state of the world
+		struct Restorer
+		{
+			const ArbiterState* begin;
+			const ArbiterState* end;
+			cpSpace* space;
+		};
+
+		Restorer restorer = { arbiterStates, arbiterStates + header.arbiterCount, m_handle };
+
+		cpHashSetEach(m_handle->cachedArbiters, [](void* element, void* data)
+		{
+			cpArbiter* arbiter = static_cast<cpArbiter*>(element);
+			Restorer* arbiterRestorer = static_cast<Restorer*>(data);
+
+			ArbiterState key;
+			key.shapeA = arbiter->a;
+			key.shapeB = arbiter->b;
+
+			const ArbiterState* arbiterState = std::lower_bound(arbiterRestorer->begin, arbiterRestorer->end, key);
+			if (arbiterState != arbiterRestorer->end && arbiterState->shapeA == key.shapeA && arbiterState->shapeB == key.shapeB)
+			{
+				// The contacts of an arbiter live in the contact buffers of the space, their count can only shrink
+				arbiter->count = std::min(arbiter->count, arbiterState->contactCount);
+				for (int i = 0; i < arbiter->count; ++i)
+				{
+					arbiter->contacts[i].hash = arbiterState->contacts[i].hash;
+					arbiter->contacts[i].jnAcc = arbiterState->contacts[i].normalImpulse;
+					arbiter->contacts[i].jtAcc = arbiterState->contacts[i].tangentImpulse;
+				}
+
+				arbiter->stamp = arbiterRestorer->space->stamp - arbiterState->ticks;
+				arbiter->state = arbiterState->arbiterState;
+			}
+			else
+			{
+				// Those shapes weren't touching when the state was saved, their next contact has to be a new one
+				arbiter->count = 0;
+				arbiter->state = CP_ARBITER_STATE_CACHED;
+			}
+		}, &restorer);
+
+		m_timestepAccumulator = header.timestepAccumulator;
+
+		return true;
+	}
+
+	void PhysWorld2D::SaveState(ByteArray* state) const
+	{
+		NazaraAssert(state, "Invalid state");
+
+		struct Saver
+		{
+			ByteArray* state;
+			cpSpace* space;
+			UInt32 arbiterCount;
+			UInt32 bodyCount;
+		};
+
+		Saver saver = { state, m_handle, 0, 0 };
+
+		state->Resize(sizeof(StateHeader));
+
+		cpSpaceEachBody(m_handle, [](cpBody* body, void* data)
+		{
+			// The static body of the space doesn't belong to any RigidBody2D and never moves
+			if (!cpBodyGetUserData(body))
+				return;
+
+			BodyState bodyState;
+			bodyState.body = body;
+			bodyState.force = cpBodyGetForce(body);
+			bodyState.position = cpBodyGetPosition(body);
+			bodyState.velocity = cpBodyGetVelocity(body);
+			bodyState.angle = cpBodyGetAngle(body);
+			bodyState.angularVelocity = cpBodyGetAngularVelocity(body);
+			bodyState.torque = cpBodyGetTorque(body);
+
+			Saver* bodySaver = static_cast<Saver*>(data);
+			bodySaver->state->Append(&bodyState, sizeof(BodyState));
+			bodySaver->bodyCount++;
+		}, &saver);
+
+		std::size_t arbiterOffset = state->GetSize();
+
+		cpHashSetEach(m_handle->cachedArbiters, [](void* element, void* data)
+		{
+			cpArbiter* arbiter = static_cast<cpArbiter*>(element);
+			Saver* arbiterSaver = static_cast<Saver*>(data);
+
+			ArbiterState arbiterState;
+			std::memset(&arbiterState, 0, sizeof(ArbiterState));
+			arbiterState.shapeA = arbiter->a;
+			arbiterState.shapeB = arbiter->b;
+			arbiterState.contactCount = arbiter->count;
+			arbiterState.arbiterState = arbiter->state;
+			arbiterState.ticks = arbiterSaver->space->stamp - arbiter->stamp;
+
+			for (int i = 0; i < arbiter->count; ++i)
+			{
+				arbiterState.contacts[i].hash = arbiter->contacts[i].hash;
+				arbiterState.contacts[i].normalImpulse = arbiter->contacts[i].jnAcc;
+				arbiterState.contacts[i].tangentImpulse = arbiter->contacts[i].jtAcc;
+			}
+
+			arbiterSaver->state->Append(&arbiterState, sizeof(ArbiterState));
+			arbiterSaver->arbiterCount++;
+		}, &saver);
+
+		// Sorted by shape pair so restoring can look arbiters up without allocating
+		ArbiterState* arbiterStates = reinterpret_cast<ArbiterState*>(state->GetBuffer() + arbiterOffset);
+		std::sort(arbiterStates, arbiterStates + saver.arbiterCount);
+
+		StateHeader header;
+		header.bodyCount = saver.bodyCount;
+		header.arbiterCount = saver.arbiterCount;
+		header.timestepAccumulator = m_timestepAccumulator;
+
+		std::memcpy(state->GetBuffer(), &header, sizeof(StateHeader));
+	}
+
+	void PhysWorld2D::SetCollisionBias(float collisionBias)
+	{
+		// Fraction of the overlap left uncorrected after one second
+		cpSpaceSetCollisionBias(m_handle, cpFloat(collisionBias));
+	}
+
+	void PhysWorld2D::SetCollisionSlop(float collisionSlop)
+	{
+		// Overlap allowed between shapes, a bigger slop reduces jittering of resting bodies
+		cpSpaceSetCollisionSlop(m_handle, cpFloat(collisionSlop));
+	}
+
+	void PhysWorld2D::SetContactEventCapacity(std::size_t capacity)
+	{
+		NazaraAssert(m_contactEvents.empty(), "Contact events must be cleared before changing the capacity");
+
+		// The buffer never grows past its capacity, so no allocation happens while the world is stepped
+		std::vector<ContactEvent> contactEvents;
+		contactEvents.reserve(capacity);
+
+		m_contactEvents = std::move(contactEvents);
+	}
+
 	void PhysWorld2D::SetDamping(float dampingValue)
 	{
 		cpSpaceSetDamping(m_handle, dampingValue);
@@ -307,6 +712,13 @@ namespace Nz
 		m_stepSize = stepSize;
 	}
 
+	void PhysWorld2D::Simulate(std::size_t stepCount)
+	{
+		// Unlike Step, the number of steps doesn't depend on the elapsed time, which makes resimulating frames reproducible
+		for (std::size_t i = 0; i < stepCount; ++i)
+			RunStep();
+	}
+
 	void PhysWorld2D::Step(float timestep)
 	{
 		m_timestepAccumulator += timestep;
@@ -314,21 +726,7 @@ namespace Nz
 		std::size_t stepCount = 0;
 		while (m_timestepAccumulator >= m_stepSize && stepCount < m_maxStepCount)
 		{
-			OnPhysWorld2DPreStep(this);
-
-			cpSpaceStep(m_handle, m_stepSize);
-
-			OnPhysWorld2DPostStep(this);
-			if (!m_rigidPostSteps.empty())
-			{
-				for (const auto& pair : m_rigidPostSteps)
-				{
-					for (const auto& step : pair.second.funcs)
-						step(pair.first);
-				}
-
-				m_rigidPostSteps.clear();
-			}
+			RunStep();
 
 			m_timestepAccumulator -= m_stepSize;
 			stepCount++;
@@ -338,6 +736,8 @@ namespace Nz
 	void PhysWorld2D::UseSpatialHash(float cellSize, std::size_t entityCount)
 	{
 		cpSpaceUseSpatialHash(m_handle, cpFloat(cellSize), int(entityCount));
+
+		m_isUsingSpatialHash = true;
 	}
 
 	void PhysWorld2D::InitCallbacks(cpCollisionHandler* handler, const Callback& callbacks)
@@ -435,6 +835,29 @@ namespace Nz
 		}
 	}
 
+	void PhysWorld2D::InitContactEvents(cpCollisionHandler* handler)
+	{
+		// Events replace the start and end callbacks of the handler, the pre-solve and post-solve ones are left untouched
+		handler->beginFunc = [](cpArbiter* arb, cpSpace* space, void* /*data*/) -> cpBool
+		{
+			PhysWorld2D* world = static_cast<PhysWorld2D*>(cpSpaceGetUserData(space));
+			world->PushContactEvent(arb, ContactEventType2D_Start);
+
+			cpBool retA = cpArbiterCallWildcardBeginA(arb, space);
+			cpBool retB = cpArbiterCallWildcardBeginB(arb, space);
+			return retA && retB;
+		};
+
+		handler->separateFunc = [](cpArbiter* arb, cpSpace* space, void* /*data*/)
+		{
+			PhysWorld2D* world = static_cast<PhysWorld2D*>(cpSpaceGetUserData(space));
+			world->PushContactEvent(arb, ContactEventType2D_End);
+
+			cpArbiterCallWildcardSeparateA(arb, space);
+			cpArbiterCallWildcardSeparateB(arb, space);
+		};
+	}
+
 	void PhysWorld2D::OnRigidBodyMoved(RigidBody2D* oldPointer, RigidBody2D* newPointer)
 	{
 		auto it = m_rigidPostSteps.find(oldPointer);
@@ -450,6 +873,40 @@ namespace Nz
 		m_rigidPostSteps.erase(rigidBody);
 	}
 
+	void PhysWorld2D::PushContactEvent(cpArbiter* arbiter, ContactEventType2D type)
+	{
+		if (m_contactEvents.size() == m_contactEvents.capacity())
+		{
+			m_droppedContactEventCount++;
+			return;
+		}
+
+		cpBody* firstBody;
+		cpBody* secondBody;
+		cpArbiterGetBodies(arbiter, &firstBody, &secondBody);
+
+		m_contactEvents.emplace_back();
+
+		ContactEvent& contactEvent = m_contactEvents.back();
+		contactEvent.type = type;
+		contactEvent.firstBody = static_cast<RigidBody2D*>(cpBodyGetUserData(firstBody));
+		contactEvent.secondBody = static_cast<RigidBody2D*>(cpBodyGetUserData(secondBody));
+
+		if (type == ContactEventType2D_Start && cpArbiterGetCount(arbiter) > 0)
+		{
+			cpVect point = cpArbiterGetPointA(arbiter, 0);
+			cpVect normal = cpArbiterGetNormal(arbiter);
+
+			contactEvent.contactPoint.Set(Nz::Vector2<cpFloat>(point.x, point.y));
+			contactEvent.normal.Set(Nz::Vector2<cpFloat>(normal.x, normal.y));
+		}
+		else
+		{
+			contactEvent.contactPoint = Nz::Vector2f::Zero();
+			contactEvent.normal = Nz::Vector2f::Zero();
+		}
+	}
+
 	void PhysWorld2D::RegisterPostStep(RigidBody2D* rigidBody, PostStep&& func)
 	{
 		// If space isn't locked, no need to wait
@@ -471,4 +928,26 @@ namespace Nz
 
 		it->second.funcs.emplace_back(std::move(func));
 	}
+
+	void PhysWorld2D::RunStep()
+	{
+		OnPhysWorld2DPreStep(this);
+
+		if (m_isUsingParallelSolver)
+			cpHastySpaceStep(m_handle, m_stepSize);
+		else
+			cpSpaceStep(m_handle, m_stepSize);
+
+		OnPhysWorld2DPostStep(this);
+		if (!m_rigidPostSteps.empty())
+		{
+			for (const auto& pair : m_rigidPostSteps)
+			{
+				for (const auto& step : pair.second.funcs)
+					step(pair.first);
+			}
+
+			m_rigidPostSteps.clear();
+		}
+	}
 }
@@ -5,6 +5,7 @@
 #include <Nazara/Physics2D/Physics2D.hpp>
 #include <Nazara/Core/Core.hpp>
 #include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Physics2D/Debug.hpp>
 
 namespace Nz
@@ -17,6 +18,8 @@ namespace Nz
 			return true; // Déjà initialisé
 		}
 
+		Profiler::Scope profilerScope("Physics2D::Initialize");
+
 		// Initialisation des dépendances
 		if (!Core::Initialize())
 		{
@@ -23,6 +23,7 @@ namespace Nz
 	m_isRegistered(false),
 	m_isSimulationEnabled(true),
 	m_isStatic(false),
+	m_transformChanged(true),
 	m_gravityFactor(1.f),
 	m_mass(mass)
 	{
@@ -39,6 +40,7 @@ namespace Nz
 	m_isRegistered(false),
 	m_isSimulationEnabled(true),
 	m_isStatic(object.m_isStatic),
+	m_transformChanged(true),
 	m_gravityFactor(object.m_gravityFactor),
 	m_mass(object.GetMass())
 	{
@@ -65,6 +67,7 @@ namespace Nz
 	m_isRegistered(object.m_isRegistered),
 	m_isSimulationEnabled(object.m_isSimulationEnabled),
 	m_isStatic(object.m_isStatic),
+	m_transformChanged(object.m_transformChanged),
 	m_gravityFactor(object.m_gravityFactor),
 	m_mass(object.m_mass)
 	{
@@ -231,6 +234,11 @@ namespace Nz
 		return m_world;
 	}
 
+	bool RigidBody2D::HasTransformChanged() const
+	{
+		return m_transformChanged;
+	}
+
 	bool RigidBody2D::IsKinematic() const
 	{
 		return m_mass <= 0.f;
@@ -251,6 +259,11 @@ namespace Nz
 		return m_isStatic;
 	}
 
+	void RigidBody2D::ResetTransformChanged()
+	{
+		m_transformChanged = false;
+	}
+
 	void RigidBody2D::SetAngularVelocity(float angularVelocity)
 	{
 		cpBodySetAngularVelocity(m_handle, ToRadians(angularVelocity));
@@ -347,6 +360,8 @@ namespace Nz
 	void RigidBody2D::SetPosition(const Vector2f& position)
 	{
 		cpBodySetPosition(m_handle, cpv(position.x, position.y));
+		m_transformChanged = true;
+
 		if (m_isStatic)
 		{
 			m_world->RegisterPostStep(this, [](Nz::RigidBody2D* body)
@@ -359,6 +374,8 @@ namespace Nz
 	void RigidBody2D::SetRotation(float rotation)
 	{
 		cpBodySetAngle(m_handle, ToRadians(rotation));
+		m_transformChanged = true;
+
 		if (m_isStatic)
 		{
 			m_world->RegisterPostStep(this, [](Nz::RigidBody2D* body)
@@ -412,6 +429,7 @@ namespace Nz
 		m_isRegistered        = object.m_isRegistered;
 		m_isSimulationEnabled = object.m_isSimulationEnabled;
 		m_isStatic            = object.m_isStatic;
+		m_transformChanged    = object.m_transformChanged;
 		m_geom                = std::move(object.m_geom);
 		m_gravityFactor       = object.m_gravityFactor;
 		m_mass                = object.m_mass;
@@ -445,6 +463,14 @@ namespace Nz
 
 		cpBodySetUserData(handle, this);
 
+		// Chipmunk only integrates the position of bodies which are awake, sleeping bodies are never flagged
+		cpBodySetPositionUpdateFunc(handle, [](cpBody* body, cpFloat dt)
+		{
+			cpBodyUpdatePosition(body, dt);
+
+			static_cast<RigidBody2D*>(cpBodyGetUserData(body))->m_transformChanged = true;
+		});
+
 		return handle;
 	}
 
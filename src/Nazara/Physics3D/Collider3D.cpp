@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Physics3D/Collider3D.hpp>
+#include <Nazara/Core/ByteStream.hpp>
 #include <Nazara/Core/PrimitiveList.hpp>
 #include <Nazara/Physics3D/PhysWorld3D.hpp>
 #include <Newton/Newton.h>
@@ -336,6 +337,7 @@ namespace Nz
 
 	ConvexCollider3D::ConvexCollider3D(SparsePtr<const Vector3f> vertices, unsigned int vertexCount, float tolerance, const Matrix4f& transformMatrix) :
 	m_matrix(transformMatrix),
+	m_isCooked(false),
 	m_tolerance(tolerance)
 	{
 		m_vertices.resize(vertexCount);
@@ -353,11 +355,85 @@ namespace Nz
 	{
 	}
 
+	// Cooked hulls only hold the vertices kept by Newton, the hull is then built from a handful of points instead of the whole mesh
+	ConvexCollider3D::ConvexCollider3D(const ByteArray& cookedHull) :
+	m_matrix(Matrix4f::Identity()),
+	m_isCooked(true),
+	m_tolerance(0.f)
+	{
+		constexpr std::size_t headerSize = sizeof(UInt32) + sizeof(Matrix4f);
+		if (cookedHull.GetSize() < headerSize)
+		{
+			NazaraError("Invalid cooked hull");
+			return;
+		}
+
+		ByteStream stream(cookedHull.GetConstBuffer(), cookedHull.GetSize());
+
+		UInt32 vertexCount;
+		stream >> vertexCount >> m_matrix;
+
+		if (vertexCount == 0 || vertexCount > (cookedHull.GetSize() - headerSize) / sizeof(Vector3f))
+		{
+			NazaraError("Invalid cooked hull");
+			return;
+		}
+
+		m_vertices.resize(vertexCount);
+		for (Vector3f& vertex : m_vertices)
+			stream >> vertex;
+	}
+
+	ByteArray ConvexCollider3D::Cook() const
+	{
+		auto WriteHull = [this] (NewtonCollision* collision)
+		{
+			NewtonCollisionInfoRecord info;
+			NewtonCollisionGetInfo(collision, &info);
+
+			const NewtonConvexHullParam& hull = info.m_convexHull;
+
+			ByteArray cookedHull;
+			{
+				ByteStream stream(&cookedHull);
+				stream << static_cast<UInt32>(hull.m_vertexCount) << m_matrix;
+
+				const UInt8* vertexPtr = reinterpret_cast<const UInt8*>(hull.m_vertex);
+				for (int i = 0; i < hull.m_vertexCount; ++i)
+				{
+					const float* vertex = reinterpret_cast<const float*>(vertexPtr + i * hull.m_vertexStrideInBytes);
+					stream << Vector3f(vertex[0], vertex[1], vertex[2]);
+				}
+			}
+
+			return cookedHull;
+		};
+
+		// Check for existing collision handles, and create a temporary one if none is available
+		if (m_handles.empty())
+		{
+			PhysWorld3D world;
+
+			NewtonCollision* collision = CreateHandle(&world);
+			ByteArray cookedHull = WriteHull(collision);
+			NewtonDestroyCollision(collision);
+
+			return cookedHull;
+		}
+		else
+			return WriteHull(m_handles.begin()->second);
+	}
+
 	ColliderType3D ConvexCollider3D::GetType() const
 	{
 		return ColliderType3D_ConvexHull;
 	}
 
+	bool ConvexCollider3D::IsCooked() const
+	{
+		return m_isCooked;
+	}
+
 	NewtonCollision* ConvexCollider3D::CreateHandle(PhysWorld3D* world) const
 	{
 		return NewtonCreateConvexHull(world->GetHandle(), static_cast<int>(m_vertices.size()), reinterpret_cast<const float*>(m_vertices.data()), sizeof(Vector3f), m_tolerance, 0, m_matrix);
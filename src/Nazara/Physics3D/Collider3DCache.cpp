@@ -0,0 +1,207 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Physics 3D module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Physics3D/Collider3DCache.hpp>
+#include <Nazara/Core/AbstractHash.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Physics3D/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		// Keys are the raw bytes of the parameters, prefixed by the collider type
+		template<typename T>
+		void AppendKey(std::string& key, const T& value)
+		{
+			key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+		}
+
+		std::string BuildKey(ColliderType3D type, const Matrix4f& transformMatrix)
+		{
+			std::string key;
+			AppendKey(key, type);
+			AppendKey(key, transformMatrix);
+
+			return key;
+		}
+	}
+
+	/*!
+	* \ingroup physics3d
+	* \class Nz::Collider3DCache
+	* \brief Physics3D class sharing colliders built from the same parameters
+	*
+	* A collider creates its Newton collision once per world, which is then used by every body of the world referencing this collider.
+	* Asking this cache for colliders instead of creating new ones for every crate or rock makes identical shapes share a single collider, and thus a single Newton collision.
+	* Convex hulls are identified by a hash of their vertices, so their hull is only computed once.
+	*
+	* \remark Colliders returned by the cache are shared, they must not be modified
+	*/
+
+	/*!
+	* \brief Releases every collider of the cache
+	*
+	* \remark Colliders still referenced elsewhere stay alive
+	*/
+	void Collider3DCache::Clear()
+	{
+		m_colliders.clear();
+	}
+
+	/*!
+	* \brief Gets a box collider
+	* \return Shared collider matching the parameters
+	*
+	* \param lengths Lengths of the box
+	* \param transformMatrix Offset of the box
+	*/
+	BoxCollider3DRef Collider3DCache::GetBox(const Vector3f& lengths, const Matrix4f& transformMatrix)
+	{
+		std::string key = BuildKey(ColliderType3D_Box, transformMatrix);
+		AppendKey(key, lengths);
+
+		return GetCollider<BoxCollider3D>(key, [&] () { return BoxCollider3D::New(lengths, transformMatrix); });
+	}
+
+	/*!
+	* \brief Gets a capsule collider
+	* \return Shared collider matching the parameters
+	*
+	* \param length Length of the capsule
+	* \param radius Radius of the capsule
+	* \param transformMatrix Offset of the capsule
+	*/
+	CapsuleCollider3DRef Collider3DCache::GetCapsule(float length, float radius, const Matrix4f& transformMatrix)
+	{
+		std::string key = BuildKey(ColliderType3D_Capsule, transformMatrix);
+		AppendKey(key, length);
+		AppendKey(key, radius);
+
+		return GetCollider<CapsuleCollider3D>(key, [&] () { return CapsuleCollider3D::New(length, radius, transformMatrix); });
+	}
+
+	/*!
+	* \brief Gets the number of colliders held by the cache
+	* \return Collider count
+	*/
+	std::size_t Collider3DCache::GetColliderCount() const
+	{
+		return m_colliders.size();
+	}
+
+	/*!
+	* \brief Gets a cone collider
+	* \return Shared collider matching the parameters
+	*
+	* \param length Length of the cone
+	* \param radius Radius of the cone
+	* \param transformMatrix Offset of the cone
+	*/
+	ConeCollider3DRef Collider3DCache::GetCone(float length, float radius, const Matrix4f& transformMatrix)
+	{
+		std::string key = BuildKey(ColliderType3D_Cone, transformMatrix);
+		AppendKey(key, length);
+		AppendKey(key, radius);
+
+		return GetCollider<ConeCollider3D>(key, [&] () { return ConeCollider3D::New(length, radius, transformMatrix); });
+	}
+
+	/*!
+	* \brief Gets a convex hull collider
+	* \return Shared collider matching the parameters
+	*
+	* \param vertices Vertices the hull is computed from
+	* \param vertexCount Number of vertices
+	* \param tolerance Tolerance of the hull computation
+	* \param transformMatrix Offset of the hull
+	*
+	* \remark Vertices are identified by their XXH3 hash
+	*/
+	ConvexCollider3DRef Collider3DCache::GetConvexHull(SparsePtr<const Vector3f> vertices, unsigned int vertexCount, float tolerance, const Matrix4f& transformMatrix)
+	{
+		std::unique_ptr<AbstractHash> hash = AbstractHash::Get(HashType_XXH3);
+		hash->Begin();
+		if (vertices.GetStride() == sizeof(Vector3f))
+			hash->Append(static_cast<const UInt8*>(vertices.GetPtr()), vertexCount * sizeof(Vector3f));
+		else
+		{
+			for (unsigned int i = 0; i < vertexCount; ++i)
+				hash->Append(reinterpret_cast<const UInt8*>(&vertices[i]), sizeof(Vector3f));
+		}
+		ByteArray digest = hash->End();
+
+		std::string key = BuildKey(ColliderType3D_ConvexHull, transformMatrix);
+		AppendKey(key, tolerance);
+		AppendKey(key, vertexCount);
+		key.append(reinterpret_cast<const char*>(digest.GetConstBuffer()), digest.GetSize());
+
+		return GetCollider<ConvexCollider3D>(key, [&] () { return ConvexCollider3D::New(vertices, vertexCount, tolerance, transformMatrix); });
+	}
+
+	/*!
+	* \brief Gets a cylinder collider
+	* \return Shared collider matching the parameters
+	*
+	* \param length Length of the cylinder
+	* \param radius Radius of the cylinder
+	* \param transformMatrix Offset of the cylinder
+	*/
+	CylinderCollider3DRef Collider3DCache::GetCylinder(float length, float radius, const Matrix4f& transformMatrix)
+	{
+		std::string key = BuildKey(ColliderType3D_Cylinder, transformMatrix);
+		AppendKey(key, length);
+		AppendKey(key, radius);
+
+		return GetCollider<CylinderCollider3D>(key, [&] () { return CylinderCollider3D::New(length, radius, transformMatrix); });
+	}
+
+	/*!
+	* \brief Gets a sphere collider
+	* \return Shared collider matching the parameters
+	*
+	* \param radius Radius of the sphere
+	* \param translation Offset of the sphere
+	*/
+	SphereCollider3DRef Collider3DCache::GetSphere(float radius, const Vector3f& translation)
+	{
+		std::string key;
+		AppendKey(key, ColliderType3D_Sphere);
+		AppendKey(key, translation);
+		AppendKey(key, radius);
+
+		return GetCollider<SphereCollider3D>(key, [&] () { return SphereCollider3D::New(radius, translation); });
+	}
+
+	/*!
+	* \brief Releases the colliders which are only referenced by the cache
+	* \return Number of released colliders
+	*/
+	std::size_t Collider3DCache::Purge()
+	{
+		std::size_t purgedCount = 0;
+		for (auto it = m_colliders.begin(); it != m_colliders.end();)
+		{
+			if (it->second->GetReferenceCount() == 1)
+			{
+				it = m_colliders.erase(it);
+				purgedCount++;
+			}
+			else
+				++it;
+		}
+
+		return purgedCount;
+	}
+
+	template<typename T, typename F>
+	ObjectRef<T> Collider3DCache::GetCollider(const std::string& key, F&& factory)
+	{
+		auto it = m_colliders.find(key);
+		if (it == m_colliders.end())
+			it = m_colliders.emplace(key, factory()).first;
+
+		return static_cast<T*>(it->second.Get());
+	}
+}
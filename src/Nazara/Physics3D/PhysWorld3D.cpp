@@ -4,12 +4,44 @@
 
 #include <Nazara/Physics3D/PhysWorld3D.hpp>
 #include <Nazara/Core/MemoryHelper.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Physics3D/Collider3D.hpp>
+#include <Nazara/Physics3D/RigidBody3D.hpp>
 #include <Newton/Newton.h>
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <Nazara/Physics3D/Debug.hpp>
 
 namespace Nz
 {
+	namespace
+	{
+		template<typename F>
+		std::size_t ParallelQuery(std::size_t threadCount, std::size_t queryCount, F&& function)
+		{
+			// Newton keeps scratch memory per thread, there must not be more chunks than Newton threads so each chunk can use its own index
+			std::size_t grainSize = std::max<std::size_t>((queryCount + threadCount - 1) / threadCount, 1);
+
+			std::atomic_size_t hitCount(0);
+			TaskScheduler::ParallelFor(0, queryCount, grainSize, [&](std::size_t firstQuery, std::size_t lastQuery)
+			{
+				int threadIndex = static_cast<int>(firstQuery / grainSize);
+
+				std::size_t chunkHitCount = 0;
+				for (std::size_t i = firstQuery; i < lastQuery; ++i)
+				{
+					if (function(i, threadIndex))
+						chunkHitCount++;
+				}
+
+				hitCount += chunkHitCount;
+			});
+
+			return hitCount;
+		}
+	}
+
 	PhysWorld3D::PhysWorld3D() :
 	m_gravity(Vector3f::Zero()),
 	m_maxStepCount(50),
@@ -27,6 +59,38 @@ namespace Nz
 		NewtonDestroy(m_world);
 	}
 
+	std::size_t PhysWorld3D::ConvexCastQueryFirst(const Collider3D& collider, const Matrix4f* startMatrices, const Vector3f* endPositions, std::size_t castCount, RaycastHit* hitInfos)
+	{
+		// Retrieving the handle may create the collision of this world, which must be done before the workers use it
+		NewtonCollision* collision = collider.GetHandle(this);
+
+		return ParallelQuery(GetThreadCount(), castCount, [&](std::size_t i, int threadIndex)
+		{
+			RaycastHit& hitInfo = hitInfos[i];
+
+			NewtonWorldConvexCastReturnInfo contact;
+			float hitParam;
+			if (NewtonWorldConvexCast(m_world, startMatrices[i], endPositions[i], collision, &hitParam, nullptr, nullptr, &contact, 1, threadIndex) > 0)
+			{
+				hitInfo.body = static_cast<RigidBody3D*>(NewtonBodyGetUserData(contact.m_hitBody));
+				hitInfo.fraction = hitParam;
+				hitInfo.hitNormal.Set(contact.m_normal);
+				hitInfo.hitPosition.Set(contact.m_point);
+
+				return true;
+			}
+			else
+			{
+				hitInfo.body = nullptr;
+				hitInfo.fraction = 1.f;
+				hitInfo.hitNormal = Vector3f::Zero();
+				hitInfo.hitPosition = endPositions[i];
+
+				return false;
+			}
+		});
+	}
+
 	int PhysWorld3D::CreateMaterial(String name)
 	{
 		NazaraAssert(m_materialIds.find(name) == m_materialIds.end(), "Material \"" + name + "\" already exists");
@@ -76,6 +140,59 @@ namespace Nz
 		return m_stepSize;
 	}
 
+	std::size_t PhysWorld3D::GetThreadCount() const
+	{
+		return NewtonGetThreadsCount(m_world);
+	}
+
+	std::size_t PhysWorld3D::RaycastQueryFirst(const Vector3f* startPositions, const Vector3f* endPositions, std::size_t rayCount, RaycastHit* hitInfos)
+	{
+		auto filterCallback = [](const NewtonBody* const body, const NewtonCollision* const /*shapeHit*/, const float* const hitContact, const float* const hitNormal, dLong /*collisionID*/, void* const userData, float intersectParam) -> float
+		{
+			RaycastHit* hitInfo = static_cast<RaycastHit*>(userData);
+			if (intersectParam < hitInfo->fraction)
+			{
+				hitInfo->body = static_cast<RigidBody3D*>(NewtonBodyGetUserData(body));
+				hitInfo->fraction = intersectParam;
+				hitInfo->hitNormal.Set(hitNormal);
+				hitInfo->hitPosition.Set(hitContact);
+			}
+
+			// Shortens the ray, Newton then skips the bodies behind this one
+			return intersectParam;
+		};
+
+		return ParallelQuery(GetThreadCount(), rayCount, [&](std::size_t i, int threadIndex)
+		{
+			RaycastHit& hitInfo = hitInfos[i];
+			hitInfo.body = nullptr;
+			hitInfo.fraction = 1.f;
+			hitInfo.hitNormal = Vector3f::Zero();
+			hitInfo.hitPosition = endPositions[i];
+
+			NewtonWorldRayCast(m_world, startPositions[i], endPositions[i], filterCallback, &hitInfo, nullptr, threadIndex);
+
+			return hitInfo.body != nullptr;
+		});
+	}
+
+	void PhysWorld3D::ReadBodyTransforms(const RigidBody3D* const* bodies, std::size_t bodyCount, Vector3f* positions, Quaternionf* rotations) const
+	{
+		// Extracting the rotation of a body from its matrix is the costly part, bodies are processed by chunks on the TaskScheduler workers
+		TaskScheduler::ParallelFor(0, bodyCount, 0, [&](std::size_t firstBody, std::size_t lastBody)
+		{
+			for (std::size_t i = firstBody; i < lastBody; ++i)
+			{
+				if (!bodies[i])
+					continue;
+
+				const Matrix4f& matrix = bodies[i]->GetMatrix();
+				positions[i] = matrix.GetTranslation();
+				rotations[i] = matrix.GetRotation();
+			}
+		});
+	}
+
 	void PhysWorld3D::SetGravity(const Vector3f& gravity)
 	{
 		m_gravity = gravity;
@@ -96,6 +213,16 @@ namespace Nz
 		m_stepSize = stepSize;
 	}
 
+	void PhysWorld3D::SetThreadCount(std::size_t threadCount)
+	{
+		// Zero matches the TaskScheduler, whose workers are idle while the world is stepped
+		if (threadCount == 0)
+			threadCount = TaskScheduler::GetWorkerCount();
+
+		threadCount = std::min<std::size_t>(threadCount, NewtonGetMaxThreadsCount(m_world));
+		NewtonSetThreadsCount(m_world, static_cast<int>(std::max<std::size_t>(threadCount, 1)));
+	}
+
 	void PhysWorld3D::SetMaterialCollisionCallback(int firstMaterial, int secondMaterial, AABBOverlapCallback aabbOverlapCallback, CollisionCallback collisionCallback)
 	{
 		static_assert(sizeof(UInt64) >= 2 * sizeof(int), "Oops");
@@ -161,7 +288,13 @@ namespace Nz
 		assert(callbackData);
 		assert(callbackData->aabbOverlapCallback);
 
-		return callbackData->aabbOverlapCallback(*bodyA, *bodyB);
+		// Newton may run this from any of its threads, user callbacks are serialized so they don't have to be thread-safe
+		NewtonWorld* world = NewtonBodyGetWorld(body0);
+		NewtonWorldCriticalSectionLock(world, threadIndex);
+		int result = callbackData->aabbOverlapCallback(*bodyA, *bodyB);
+		NewtonWorldCriticalSectionUnlock(world);
+
+		return result;
 	}
 
 	void PhysWorld3D::ProcessContact(const NewtonJoint* const contactJoint, float timestep, int threadIndex)
@@ -181,6 +314,9 @@ namespace Nz
 			contacts[contactIndex++] = contact;
 		}
 
+		NewtonWorld* world = NewtonBodyGetWorld(NewtonJointGetBody0(contactJoint));
+		NewtonWorldCriticalSectionLock(world, threadIndex);
+
 		for (ContactJoint contact : contacts)
 		{
 			NewtonMaterial* material = NewtonContactGetMaterial(contact);
@@ -191,5 +327,7 @@ namespace Nz
 			if (!callbackData->collisionCallback(*bodyA, *bodyB))
 				NewtonContactJointRemoveContact(contactJoint, contact);
 		}
+
+		NewtonWorldCriticalSectionUnlock(world);
 	}
 }
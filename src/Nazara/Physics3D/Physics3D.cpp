@@ -6,6 +6,7 @@
 #include <Nazara/Core/Core.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Physics3D/Config.hpp>
 #include <Nazara/Physics3D/Collider3D.hpp>
 #include <Newton/Newton.h>
@@ -26,6 +27,8 @@ namespace Nz
 			return true; // Déjà initialisé
 		}
 
+		Profiler::Scope profilerScope("Physics3D::Initialize");
+
 		// Initialisation des dépendances
 		if (!Core::Initialize())
 		{
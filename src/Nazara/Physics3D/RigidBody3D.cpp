@@ -23,7 +23,8 @@ namespace Nz
 	m_torqueAccumulator(Vector3f::Zero()),
 	m_world(world),
 	m_gravityFactor(1.f),
-	m_mass(0.f)
+	m_mass(0.f),
+	m_transformChanged(true)
 	{
 		NazaraAssert(m_world, "Invalid world");
 
@@ -42,7 +43,8 @@ namespace Nz
 	m_torqueAccumulator(Vector3f::Zero()),
 	m_world(object.m_world),
 	m_gravityFactor(object.m_gravityFactor),
-	m_mass(0.f)
+	m_mass(0.f),
+	m_transformChanged(true)
 	{
 		NazaraAssert(m_world, "Invalid world");
 		NazaraAssert(m_geom, "Invalid geometry");
@@ -69,7 +71,8 @@ namespace Nz
 	m_body(object.m_body),
 	m_world(object.m_world),
 	m_gravityFactor(object.m_gravityFactor),
-	m_mass(object.m_mass)
+	m_mass(object.m_mass),
+	m_transformChanged(object.m_transformChanged)
 	{
 		object.m_body = nullptr;
 	}
@@ -246,6 +249,11 @@ namespace Nz
 		return m_world;
 	}
 
+	bool RigidBody3D::HasTransformChanged() const
+	{
+		return m_transformChanged;
+	}
+
 	bool RigidBody3D::IsAutoSleepEnabled() const
 	{
 		return NewtonBodyGetAutoSleep(m_body) != 0;
@@ -266,6 +274,11 @@ namespace Nz
 		return NewtonBodyGetSleepState(m_body) != 0;
 	}
 
+	void RigidBody3D::ResetTransformChanged()
+	{
+		m_transformChanged = false;
+	}
+
 	void RigidBody3D::SetAngularDamping(const Vector3f& angularDamping)
 	{
 		NewtonBodySetAngularDamping(m_body, angularDamping);
@@ -359,6 +372,8 @@ namespace Nz
 	{
 		m_matrix.SetTranslation(position);
 
+		m_transformChanged = true;
+
 		UpdateBody();
 	}
 
@@ -366,6 +381,8 @@ namespace Nz
 	{
 		m_matrix.SetRotation(rotation);
 
+		m_transformChanged = true;
+
 		UpdateBody();
 	}
 
@@ -413,6 +430,7 @@ namespace Nz
 		m_mass               = object.m_mass;
 		m_matrix             = std::move(object.m_matrix);
 		m_torqueAccumulator  = std::move(object.m_torqueAccumulator);
+		m_transformChanged   = object.m_transformChanged;
 		m_world              = object.m_world;
 
 		object.m_body = nullptr;
@@ -443,7 +461,9 @@ namespace Nz
 	{
 		NazaraUnused(threadIndex);
 
+		// Newton only calls this for bodies which are awake, sleeping bodies are never flagged
 		RigidBody3D* me = static_cast<RigidBody3D*>(NewtonBodyGetUserData(body));
 		me->m_matrix.Set(matrix);
+		me->m_transformChanged = true;
 	}
 }
@@ -4,6 +4,7 @@
 
 #include <Nazara/Platform/Platform.hpp>
 #include <Nazara/Core/CallOnExit.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Platform/Config.hpp>
 #include <Nazara/Platform/Cursor.hpp>
 #include <Nazara/Platform/Window.hpp>
@@ -34,6 +35,8 @@ namespace Nz
 			return true; // Already initialized
 		}
 
+		Profiler::Scope profilerScope("Platform::Initialize");
+
 		// Initialize module dependencies
 		if (!Utility::Initialize())
 		{
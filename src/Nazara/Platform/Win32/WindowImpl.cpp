@@ -1154,7 +1154,10 @@ namespace Nz
 			return;
 
 		while (window->m_threadActive)
+		{
 			window->ProcessEvents(true);
+			window->m_parent->FlushEvents();
+		}
 
 		DestroyWindow(winHandle);
 	}
@@ -24,13 +24,19 @@ namespace Nz
 	namespace
 	{
 		Window* fullscreenWindow = nullptr;
+
+		// Number of events a threaded window can queue before they go through the overflow list of its thread
+		constexpr std::size_t s_asyncEventQueueSize = 1024;
 	}
 
 	Window::Window() :
 	m_impl(nullptr),
+	m_asyncEvents(s_asyncEventQueueSize),
 	m_asyncWindow(false),
 	m_closeOnQuit(true),
+	m_coalesceEvents(false),
 	m_eventPolling(false),
+	m_hasCoalescedEvent(false),
 	m_waitForEvent(false)
 	{
 		m_cursorController.OnCursorUpdated.Connect([this](const CursorController*, const CursorRef& cursor)
@@ -159,6 +165,13 @@ namespace Nz
 			delete m_impl;
 			m_impl = nullptr;
 
+			// Events of the destroyed window must not be handled by the next one
+			WindowEvent event;
+			while (m_asyncEvents.Pop(&event));
+
+			m_hasCoalescedEvent = false;
+			m_pendingEvents.clear();
+
 			if (fullscreenWindow == this)
 				fullscreenWindow = nullptr;
 		}
@@ -305,7 +318,12 @@ namespace Nz
 		#endif
 
 		if (!m_asyncWindow)
+		{
 			m_impl->ProcessEvents(false);
+			FlushEvents();
+		}
+		else
+			DispatchAsyncEvents();
 
 		if (!m_events.empty())
 		{
@@ -326,16 +344,12 @@ namespace Nz
 		NazaraUnused(block);
 
 		if (!m_asyncWindow)
-			m_impl->ProcessEvents(block);
-		else
 		{
-			LockGuard eventLock(m_eventMutex);
-
-			for (const WindowEvent& event : m_pendingEvents)
-				HandleEvent(event);
-
-			m_pendingEvents.clear();
+			m_impl->ProcessEvents(block);
+			FlushEvents();
 		}
+		else
+			DispatchAsyncEvents();
 	}
 
 	void Window::SetCursor(CursorRef cursor)
@@ -544,7 +558,10 @@ namespace Nz
 		if (!m_asyncWindow)
 		{
 			while (m_events.empty())
+			{
 				m_impl->ProcessEvents(true);
+				FlushEvents();
+			}
 
 			if (event)
 				*event = m_events.front();
@@ -557,6 +574,7 @@ namespace Nz
 		{
 			LockGuard lock(m_eventMutex);
 
+			DispatchAsyncEvents();
 			if (m_events.empty())
 			{
 				m_waitForEvent = true;
@@ -566,6 +584,8 @@ namespace Nz
 				m_eventMutex.Lock();
 				m_eventConditionMutex.Unlock();
 				m_waitForEvent = false;
+
+				DispatchAsyncEvents();
 			}
 
 			if (!m_events.empty())
@@ -595,6 +615,27 @@ namespace Nz
 	{
 	}
 
+	void Window::DispatchAsyncEvents()
+	{
+		// Called from the consumer thread, the queue is written by the window thread without locking
+		WindowEvent event;
+		while (m_asyncEvents.Pop(&event))
+			HandleEvent(event);
+	}
+
+	void Window::FlushEvents()
+	{
+		// Called by the thread producing the events, once the pending system events are processed
+		if (m_hasCoalescedEvent)
+		{
+			m_hasCoalescedEvent = false;
+			QueueEvent(m_coalescedEvent);
+		}
+
+		if (m_asyncWindow)
+			PushPendingEvents();
+	}
+
 	void Window::IgnoreNextMouseEvent(int mouseX, int mouseY) const
 	{
 		#if NAZARA_PLATFORM_SAFE
@@ -608,6 +649,85 @@ namespace Nz
 		m_impl->IgnoreNextMouseEvent(mouseX, mouseY);
 	}
 
+	void Window::PushEvent(const WindowEvent& event)
+	{
+		if (m_coalesceEvents)
+		{
+			if (m_hasCoalescedEvent)
+			{
+				if (event.type == m_coalescedEvent.type)
+				{
+					if (event.type == WindowEventType_MouseMoved)
+					{
+						// Merged moves keep the last position and the whole delta
+						m_coalescedEvent.mouseMove.deltaX += event.mouseMove.deltaX;
+						m_coalescedEvent.mouseMove.deltaY += event.mouseMove.deltaY;
+						m_coalescedEvent.mouseMove.x = event.mouseMove.x;
+						m_coalescedEvent.mouseMove.y = event.mouseMove.y;
+					}
+					else
+						m_coalescedEvent = event;
+
+					return;
+				}
+
+				// Events keep their order
+				m_hasCoalescedEvent = false;
+				QueueEvent(m_coalescedEvent);
+			}
+
+			switch (event.type)
+			{
+				case WindowEventType_MouseMoved:
+				case WindowEventType_Moved:
+				case WindowEventType_Resized:
+					m_coalescedEvent = event;
+					m_hasCoalescedEvent = true;
+					return;
+
+				default:
+					break;
+			}
+		}
+
+		QueueEvent(event);
+	}
+
+	bool Window::PushPendingEvents()
+	{
+		// Events which didn't fit in the queue are pushed in order, once the consumer made room
+		std::size_t pushedCount = 0;
+		for (const WindowEvent& event : m_pendingEvents)
+		{
+			if (!m_asyncEvents.Push(event))
+				break;
+
+			pushedCount++;
+		}
+
+		m_pendingEvents.erase(m_pendingEvents.begin(), m_pendingEvents.begin() + pushedCount);
+
+		return m_pendingEvents.empty();
+	}
+
+	void Window::QueueEvent(const WindowEvent& event)
+	{
+		if (!m_asyncWindow)
+			HandleEvent(event);
+		else
+		{
+			if (!PushPendingEvents() || !m_asyncEvents.Push(event))
+				m_pendingEvents.push_back(event);
+
+			if (m_waitForEvent)
+			{
+				m_eventConditionMutex.Lock();
+				m_eventCondition.Signal();
+				m_eventConditionMutex.Unlock();
+			}
+		}
+	}
+
 	bool Window::Initialize()
 	{
 		return WindowImpl::Initialize();
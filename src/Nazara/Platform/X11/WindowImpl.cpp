@@ -1581,7 +1581,12 @@ namespace Nz
 			return;
 
 		while (window->m_threadActive)
+		{
+			// Wait for an event, then process the ones received meanwhile so they can be coalesced
 			window->ProcessEvents(true);
+			window->ProcessEvents(false);
+			window->m_parent->FlushEvents();
+		}
 
 		window->Destroy();
 	}
@@ -0,0 +1,405 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Renderer module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Renderer/CommandBuffer.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Renderer/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup renderer
+	* \class Nz::CommandBuffer
+	* \brief Renderer class recording rendering commands, to be executed later by Renderer::Execute
+	*
+	* Recording doesn't call the graphics API nor touch the state of the renderer, so command buffers may be recorded in parallel by several threads (one buffer per thread), then executed in order by the thread owning the context.
+	* Objects referenced by the commands (shaders, buffers, textures and matrix arrays) must stay alive until the buffer is executed.
+	*
+	* \see Renderer::Execute
+	*/
+
+	/*!
+	* \brief Records the activation of a shader and render states
+	*
+	* \param shader Shader drawing the following commands
+	* \param states Render states, copied into the buffer
+	*/
+
+	void CommandBuffer::BindPipeline(const Shader* shader, const RenderStates& states)
+	{
+		NazaraAssert(shader, "Invalid shader");
+
+		Command command;
+		command.type = CommandType_BindPipeline;
+		command.pipeline.shader = shader;
+		command.pipeline.statesIndex = m_renderStates.size();
+
+		m_commands.push_back(command);
+		m_renderStates.push_back(states);
+	}
+
+	/*!
+	* \brief Removes every recorded command, keeping the memory for the next recording
+	*/
+
+	void CommandBuffer::Clear()
+	{
+		m_commands.clear();
+		m_indirectCommands.clear();
+		m_matrices.clear();
+		m_renderStates.clear();
+		m_samplers.clear();
+	}
+
+	/*!
+	* \brief Records a draw of the current vertex buffer
+	*
+	* \param mode Primitive mode
+	* \param firstVertex Index of the first vertex
+	* \param vertexCount Number of vertices
+	*/
+
+	void CommandBuffer::Draw(PrimitiveMode mode, unsigned int firstVertex, unsigned int vertexCount)
+	{
+		Command command;
+		command.type = CommandType_Draw;
+		command.draw.mode = mode;
+		command.draw.first = firstVertex;
+		command.draw.count = vertexCount;
+		command.draw.firstInstance = 0;
+		command.draw.instanceCount = 0;
+
+		m_commands.push_back(command);
+	}
+
+	/*!
+	* \brief Records a draw of the current index buffer
+	*
+	* \param mode Primitive mode
+	* \param firstIndex Index of the first index
+	* \param indexCount Number of indices
+	*/
+
+	void CommandBuffer::DrawIndexed(PrimitiveMode mode, unsigned int firstIndex, unsigned int indexCount)
+	{
+		Command command;
+		command.type = CommandType_DrawIndexed;
+		command.draw.mode = mode;
+		command.draw.first = firstIndex;
+		command.draw.count = indexCount;
+		command.draw.firstInstance = 0;
+		command.draw.instanceCount = 0;
+
+		m_commands.push_back(command);
+	}
+
+	/*!
+	* \brief Records indirect draws of the current index buffer
+	*
+	* \param mode Primitive mode
+	* \param commands Draw commands, copied into the buffer and streamed into the indirect buffer of the renderer on execution
+	* \param commandCount Number of draw commands
+	* \param instanceMatrices World matrices of the instances, copied into the buffer and streamed into the instance buffer of the renderer on execution
+	* \param instanceCount Number of instances
+	*
+	* \remark Base instances of the commands index instanceMatrices and must not decrease from one command to the next
+	* \remark More commands or instances than the renderer buffers hold are drawn in several draw calls, as long as every command fits in the instance buffer
+	*/
+
+	void CommandBuffer::DrawIndexedIndirect(PrimitiveMode mode, const Renderer::DrawIndexedIndirectCommand* commands, std::size_t commandCount, const Matrix4f* instanceMatrices, std::size_t instanceCount)
+	{
+		NazaraAssert(commands && commandCount > 0, "Invalid commands");
+		NazaraAssert(instanceMatrices && instanceCount > 0, "Invalid instances");
+
+		Command command;
+		command.type = CommandType_DrawIndexedIndirect;
+		command.indirect.mode = mode;
+		command.indirect.firstCommand = m_indirectCommands.size();
+		command.indirect.commandCount = commandCount;
+		command.indirect.firstInstance = m_matrices.size();
+
+		m_commands.push_back(command);
+		m_indirectCommands.insert(m_indirectCommands.end(), commands, commands + commandCount);
+		m_matrices.insert(m_matrices.end(), instanceMatrices, instanceMatrices + instanceCount);
+	}
+
+	/*!
+	* \brief Records an instanced draw of the current index buffer
+	*
+	* \param instanceMatrices World matrices of the instances, copied into the buffer and streamed into the instance buffer of the renderer on execution
+	* \param instanceCount Number of instances
+	* \param mode Primitive mode
+	* \param firstIndex Index of the first index
+	* \param indexCount Number of indices
+	*
+	* \remark More instances than the instance buffer holds are drawn in several draw calls
+	*/
+
+	void CommandBuffer::DrawIndexedInstanced(const Matrix4f* instanceMatrices, std::size_t instanceCount, PrimitiveMode mode, unsigned int firstIndex, unsigned int indexCount)
+	{
+		NazaraAssert(instanceMatrices && instanceCount > 0, "Invalid instances");
+
+		Command command;
+		command.type = CommandType_DrawIndexed;
+		command.draw.mode = mode;
+		command.draw.first = firstIndex;
+		command.draw.count = indexCount;
+		command.draw.firstInstance = m_matrices.size();
+		command.draw.instanceCount = instanceCount;
+
+		m_commands.push_back(command);
+		m_matrices.insert(m_matrices.end(), instanceMatrices, instanceMatrices + instanceCount);
+	}
+
+	/*!
+	* \brief Records an instanced draw of the current vertex buffer
+	*
+	* \param instanceMatrices World matrices of the instances, copied into the buffer and streamed into the instance buffer of the renderer on execution
+	* \param instanceCount Number of instances
+	* \param mode Primitive mode
+	* \param firstVertex Index of the first vertex
+	* \param vertexCount Number of vertices
+	*
+	* \remark More instances than the instance buffer holds are drawn in several draw calls
+	*/
+
+	void CommandBuffer::DrawInstanced(const Matrix4f* instanceMatrices, std::size_t instanceCount, PrimitiveMode mode, unsigned int firstVertex, unsigned int vertexCount)
+	{
+		NazaraAssert(instanceMatrices && instanceCount > 0, "Invalid instances");
+
+		Command command;
+		command.type = CommandType_Draw;
+		command.draw.mode = mode;
+		command.draw.first = firstVertex;
+		command.draw.count = vertexCount;
+		command.draw.firstInstance = m_matrices.size();
+		command.draw.instanceCount = instanceCount;
+
+		m_commands.push_back(command);
+		m_matrices.insert(m_matrices.end(), instanceMatrices, instanceMatrices + instanceCount);
+	}
+
+	/*!
+	* \brief Records the value of a color uniform
+	*
+	* \param shader Shader owning the uniform
+	* \param location Location of the uniform
+	* \param color Value of the uniform
+	*/
+
+	void CommandBuffer::SendColor(const Shader* shader, int location, const Color& color)
+	{
+		NazaraAssert(shader, "Invalid shader");
+
+		Command command;
+		command.type = CommandType_SendColor;
+		command.uniform.shader = shader;
+		command.uniform.location = location;
+		command.uniform.values[0] = color.r;
+		command.uniform.values[1] = color.g;
+		command.uniform.values[2] = color.b;
+		command.uniform.values[3] = color.a;
+
+		m_commands.push_back(command);
+	}
+
+	/*!
+	* \brief Records the value of a float uniform
+	*
+	* \param shader Shader owning the uniform
+	* \param location Location of the uniform
+	* \param value Value of the uniform
+	*/
+
+	void CommandBuffer::SendFloat(const Shader* shader, int location, float value)
+	{
+		NazaraAssert(shader, "Invalid shader");
+
+		Command command;
+		command.type = CommandType_SendFloat;
+		command.uniform.shader = shader;
+		command.uniform.location = location;
+		command.uniform.values[0] = value;
+
+		m_commands.push_back(command);
+	}
+
+	/*!
+	* \brief Records the value of a matrix array uniform
+	*
+	* \param shader Shader owning the uniform
+	* \param location Location of the uniform
+	* \param matrices Matrices of the array, which are not copied and must stay alive until the buffer is executed
+	* \param count Number of matrices
+	*/
+
+	void CommandBuffer::SendMatrixArray(const Shader* shader, int location, const Matrix4f* matrices, unsigned int count)
+	{
+		NazaraAssert(shader, "Invalid shader");
+		NazaraAssert(matrices, "Invalid matrices");
+
+		Command command;
+		command.type = CommandType_SendMatrixArray;
+		command.uniformMatrices.shader = shader;
+		command.uniformMatrices.location = location;
+		command.uniformMatrices.matrices = matrices;
+		command.uniformMatrices.count = count;
+
+		m_commands.push_back(command);
+	}
+
+	/*!
+	* \brief Records the value of a three-component vector uniform
+	*
+	* \param shader Shader owning the uniform
+	* \param location Location of the uniform
+	* \param vector Value of the uniform
+	*/
+
+	void CommandBuffer::SendVector(const Shader* shader, int location, const Vector3f& vector)
+	{
+		NazaraAssert(shader, "Invalid shader");
+
+		Command command;
+		command.type = CommandType_SendVector3;
+		command.uniform.shader = shader;
+		command.uniform.location = location;
+		command.uniform.values[0] = vector.x;
+		command.uniform.values[1] = vector.y;
+		command.uniform.values[2] = vector.z;
+
+		m_commands.push_back(command);
+	}
+
+	/*!
+	* \brief Records the value of a four-component vector uniform
+	*
+	* \param shader Shader owning the uniform
+	* \param location Location of the uniform
+	* \param vector Value of the uniform
+	*/
+
+	void CommandBuffer::SendVector(const Shader* shader, int location, const Vector4f& vector)
+	{
+		NazaraAssert(shader, "Invalid shader");
+
+		Command command;
+		command.type = CommandType_SendVector4;
+		command.uniform.shader = shader;
+		command.uniform.location = location;
+		command.uniform.values[0] = vector.x;
+		command.uniform.values[1] = vector.y;
+		command.uniform.values[2] = vector.z;
+		command.uniform.values[3] = vector.w;
+
+		m_commands.push_back(command);
+	}
+
+	/*!
+	* \brief Records the index buffer used by the following draws
+	*
+	* \param indexBuffer Index buffer, nullptr to draw without indices
+	*/
+
+	void CommandBuffer::SetIndexBuffer(const IndexBuffer* indexBuffer)
+	{
+		Command command;
+		command.type = CommandType_SetIndexBuffer;
+		command.buffer.object = indexBuffer;
+
+		m_commands.push_back(command);
+	}
+
+	/*!
+	* \brief Records a matrix of the renderer
+	*
+	* \param type Type of the matrix
+	* \param matrix Matrix, copied into the buffer
+	*/
+
+	void CommandBuffer::SetMatrix(MatrixType type, const Matrix4f& matrix)
+	{
+		Command command;
+		command.type = CommandType_SetMatrix;
+		command.matrix.type = type;
+		command.matrix.matrixIndex = m_matrices.size();
+
+		m_commands.push_back(command);
+		m_matrices.push_back(matrix);
+	}
+
+	/*!
+	* \brief Records the scissor rectangle used by the following draws
+	*
+	* \param rect Scissor rectangle
+	*/
+
+	void CommandBuffer::SetScissorRect(const Recti& rect)
+	{
+		Command command;
+		command.type = CommandType_SetScissorRect;
+		command.scissorRect.x = rect.x;
+		command.scissorRect.y = rect.y;
+		command.scissorRect.width = rect.width;
+		command.scissorRect.height = rect.height;
+
+		m_commands.push_back(command);
+	}
+
+	/*!
+	* \brief Records the texture and sampler bound to a texture unit
+	*
+	* \param unit Texture unit
+	* \param texture Texture, nullptr to unbind the unit
+	* \param sampler Sampler, copied into the buffer
+	*/
+
+	void CommandBuffer::SetTexture(unsigned int unit, const Texture* texture, const TextureSampler& sampler)
+	{
+		Command command;
+		command.type = CommandType_SetTexture;
+		command.texture.samplerIndex = m_samplers.size();
+		command.texture.texture = texture;
+		command.texture.unit = unit;
+
+		m_commands.push_back(command);
+		m_samplers.push_back(sampler);
+	}
+
+	/*!
+	* \brief Records the uniform buffer bound to a binding point
+	*
+	* \param bindingIndex Binding index of the uniform block
+	* \param buffer Buffer to bind
+	* \param offset Offset of the bound range, in bytes
+	* \param size Size of the bound range in bytes, zero for the whole buffer
+	*/
+
+	void CommandBuffer::SetUniformBuffer(unsigned int bindingIndex, const Buffer* buffer, UInt32 offset, UInt32 size)
+	{
+		Command command;
+		command.type = CommandType_SetUniformBuffer;
+		command.uniformBuffer.bindingIndex = bindingIndex;
+		command.uniformBuffer.buffer = buffer;
+		command.uniformBuffer.offset = offset;
+		command.uniformBuffer.size = size;
+
+		m_commands.push_back(command);
+	}
+
+	/*!
+	* \brief Records the vertex buffer used by the following draws
+	*
+	* \param vertexBuffer Vertex buffer
+	*/
+
+	void CommandBuffer::SetVertexBuffer(const VertexBuffer* vertexBuffer)
+	{
+		Command command;
+		command.type = CommandType_SetVertexBuffer;
+		command.buffer.object = vertexBuffer;
+
+		m_commands.push_back(command);
+	}
+}
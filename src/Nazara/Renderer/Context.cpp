@@ -198,7 +198,7 @@ namespace Nz
 		}
 	}
 
-	void Context::EnableVerticalSync(bool enabled)
+	void Context::EnableVerticalSync(bool enabled, bool adaptive)
 	{
 		#ifdef NAZARA_RENDERER_SAFE
 		if (!m_impl)
@@ -208,7 +208,7 @@ namespace Nz
 		}
 		#endif
 
-		m_impl->EnableVerticalSync(enabled);
+		m_impl->EnableVerticalSync(enabled, adaptive);
 	}
 
 	const ContextParameters& Context::GetParameters() const
@@ -3,7 +3,11 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Renderer/DebugDrawer.hpp>
+#include <Nazara/Core/CallOnExit.hpp>
 #include <Nazara/Core/ErrorFlags.hpp>
+#include <Nazara/Core/OffsetOf.hpp>
+#include <Nazara/Math/Algorithm.hpp>
+#include <Nazara/Math/Vector4.hpp>
 #include <Nazara/Renderer/Renderer.hpp>
 #include <Nazara/Renderer/RenderStates.hpp>
 #include <Nazara/Renderer/Shader.hpp>
@@ -15,42 +19,162 @@
 #include <Nazara/Utility/VertexBuffer.hpp>
 #include <Nazara/Utility/VertexDeclaration.hpp>
 #include <Nazara/Utility/VertexStruct.hpp>
+#include <array>
+#include <cstring>
+#include <vector>
 #include <Nazara/Renderer/Debug.hpp>
 
-///TODO: Améliorer
-
 namespace Nz
 {
 	namespace
 	{
-		static Shader* s_shader = nullptr;
-		static Color s_primaryColor;
-		static Color s_secondaryColor;
-		static RenderStates s_renderStates;
-		static VertexBuffer s_vertexBuffer;
-		static bool s_initialized = false;
-		static int s_colorLocation = -1;
-	}
+		// Positions are transformed to clip space when recorded, so primitives drawn with different cameras still share their batch
+		struct DebugVertex
+		{
+			Vector4f position;
+			Color color;
+		};
 
-	void DebugDrawer::Draw(const BoundingVolumef& volume)
-	{
-		if (!Initialize())
+		enum BatchType
 		{
-			NazaraError("Failed to initialize Debug Drawer");
-			return;
+			BatchType_Lines,
+			BatchType_LinesNoDepth,
+			BatchType_Points,
+			BatchType_PointsNoDepth,
+
+			BatchType_Max = BatchType_PointsNoDepth
+		};
+
+		// Edges of a box, frustum or oriented box
+		constexpr std::array<std::pair<BoxCorner, BoxCorner>, 12> s_boxEdges = {
+			{
+				{BoxCorner_NearLeftBottom,  BoxCorner_NearRightBottom},
+				{BoxCorner_NearLeftBottom,  BoxCorner_NearLeftTop},
+				{BoxCorner_NearLeftBottom,  BoxCorner_FarLeftBottom},
+				{BoxCorner_FarRightTop,     BoxCorner_FarLeftTop},
+				{BoxCorner_FarRightTop,     BoxCorner_FarRightBottom},
+				{BoxCorner_FarRightTop,     BoxCorner_NearRightTop},
+				{BoxCorner_FarLeftBottom,   BoxCorner_FarRightBottom},
+				{BoxCorner_FarLeftBottom,   BoxCorner_FarLeftTop},
+				{BoxCorner_NearLeftTop,     BoxCorner_NearRightTop},
+				{BoxCorner_NearLeftTop,     BoxCorner_FarLeftTop},
+				{BoxCorner_NearRightBottom, BoxCorner_NearRightTop},
+				{BoxCorner_NearRightBottom, BoxCorner_FarRightBottom}
+			}
+		};
+
+		std::array<std::vector<DebugVertex>, BatchType_Max + 1> s_batches;
+		Matrix4f s_transformMatrix;
+		VertexBuffer s_vertexBuffer;
+		VertexDeclarationRef s_vertexDeclaration;
+		Shader* s_shader = nullptr;
+		Color s_primaryColor;
+		Color s_secondaryColor;
+		RenderStates s_renderStates;
+		bool s_initialized = false;
+		bool s_flushing = false;
+
+		DebugVertex* AllocateVertices(BatchType type, std::size_t vertexCount)
+		{
+			if (!s_renderStates.depthBuffer)
+				type = static_cast<BatchType>(type + 1);
+
+			std::vector<DebugVertex>& batch = s_batches[type];
+
+			std::size_t offset = batch.size();
+			batch.resize(offset + vertexCount);
+
+			return &batch[offset];
 		}
 
-		if (!volume.IsFinite())
-			return;
+		// Fetches the matrix transforming recorded positions, to call once per primitive
+		bool BeginPrimitive()
+		{
+			if (!DebugDrawer::Initialize())
+			{
+				NazaraError("Failed to initialize Debug Drawer");
+				return false;
+			}
 
-		Color oldPrimaryColor = s_primaryColor;
+			s_transformMatrix = Renderer::GetMatrix(MatrixType_WorldViewProj);
+			return true;
+		}
 
-		Draw(volume.aabb);
+		inline void SetVertex(DebugVertex* vertex, const Vector3f& position, const Color& color)
+		{
+			vertex->position = s_transformMatrix.Transform(Vector4f(position, 1.f));
+			vertex->color = color;
+		}
 
-		s_primaryColor = s_secondaryColor;
-		Draw(volume.obb);
+		template<typename T>
+		void AddBox(const T& box, const Color& color)
+		{
+			std::array<Vector3f, BoxCorner_Max + 1> corners;
+			for (unsigned int i = 0; i <= BoxCorner_Max; ++i)
+				corners[i] = box.GetCorner(static_cast<BoxCorner>(i));
 
-		s_primaryColor = oldPrimaryColor;
+			DebugVertex* vertex = AllocateVertices(BatchType_Lines, s_boxEdges.size() * 2);
+			for (const auto& edge : s_boxEdges)
+			{
+				SetVertex(vertex++, corners[edge.first], color);
+				SetVertex(vertex++, corners[edge.second], color);
+			}
+		}
+
+		template<typename F>
+		void AddMeshLines(const StaticMesh* subMesh, F getEnd)
+		{
+			unsigned int vertexCount = subMesh->GetVertexCount();
+			if (vertexCount == 0)
+				return;
+
+			BufferMapper<VertexBuffer> inputMapper(subMesh->GetVertexBuffer(), BufferAccess_ReadOnly);
+			const MeshVertex* inputVertex = static_cast<const MeshVertex*>(inputMapper.GetPointer());
+
+			DebugVertex* vertex = AllocateVertices(BatchType_Lines, vertexCount * 2);
+			for (unsigned int i = 0; i < vertexCount; ++i)
+			{
+				SetVertex(vertex++, inputVertex->position, s_primaryColor);
+				SetVertex(vertex++, getEnd(*inputVertex), s_primaryColor);
+
+				inputVertex++;
+			}
+		}
+	}
+
+	/*!
+	* \ingroup renderer
+	* \class Nz::DebugDrawer
+	* \brief Renderer class that records debug primitives and draws them in batches
+	*
+	* Primitives are transformed by the current matrices when recorded, and accumulate in a batch per primitive type and depth mode.
+	* Batches are streamed into a single vertex buffer and drawn when flushed, which happens:
+	* - When Flush is called
+	* - Before the render target or the viewport changes
+	* - Before a render window displays its content, if it is the current target
+	* - Before the line width or the point size changes
+	*/
+
+	/*!
+	* \brief Clears the recorded primitives without drawing them
+	*/
+
+	void DebugDrawer::Clear()
+	{
+		for (auto& batch : s_batches)
+			batch.clear();
+	}
+
+	void DebugDrawer::Draw(const BoundingVolumef& volume)
+	{
+		if (!volume.IsFinite())
+			return;
+
+		if (!BeginPrimitive())
+			return;
+
+		AddBox(volume.aabb, s_primaryColor);
+		AddBox(volume.obb, s_secondaryColor);
 	}
 
 	void DebugDrawer::Draw(const Boxi& box)
@@ -60,88 +184,10 @@ namespace Nz
 
 	void DebugDrawer::Draw(const Boxf& box)
 	{
-		if (!Initialize())
-		{
-			NazaraError("Failed to initialize Debug Drawer");
+		if (!BeginPrimitive())
 			return;
-		}
 
-		BufferMapper<VertexBuffer> mapper(s_vertexBuffer, BufferAccess_DiscardAndWrite, 0, 24);
-		VertexStruct_XYZ* vertex = static_cast<VertexStruct_XYZ*>(mapper.GetPointer());
-
-		Vector3f max, min;
-		max = box.GetMaximum();
-		min = box.GetMinimum();
-
-		vertex->position.Set(min.x, min.y, min.z);
-		vertex++;
-		vertex->position.Set(max.x, min.y, min.z);
-		vertex++;
-
-		vertex->position.Set(min.x, min.y, min.z);
-		vertex++;
-		vertex->position.Set(min.x, max.y, min.z);
-		vertex++;
-
-		vertex->position.Set(min.x, min.y, min.z);
-		vertex++;
-		vertex->position.Set(min.x, min.y, max.z);
-		vertex++;
-
-		vertex->position.Set(max.x, max.y, max.z);
-		vertex++;
-		vertex->position.Set(min.x, max.y, max.z);
-		vertex++;
-
-		vertex->position.Set(max.x, max.y, max.z);
-		vertex++;
-		vertex->position.Set(max.x, min.y, max.z);
-		vertex++;
-
-		vertex->position.Set(max.x, max.y, max.z);
-		vertex++;
-		vertex->position.Set(max.x, max.y, min.z);
-		vertex++;
-
-		vertex->position.Set(min.x, min.y, max.z);
-		vertex++;
-		vertex->position.Set(max.x, min.y, max.z);
-		vertex++;
-
-		vertex->position.Set(min.x, min.y, max.z);
-		vertex++;
-		vertex->position.Set(min.x, max.y, max.z);
-		vertex++;
-
-		vertex->position.Set(min.x, max.y, min.z);
-		vertex++;
-		vertex->position.Set(max.x, max.y, min.z);
-		vertex++;
-
-		vertex->position.Set(min.x, max.y, min.z);
-		vertex++;
-		vertex->position.Set(min.x, max.y, max.z);
-		vertex++;
-
-		vertex->position.Set(max.x, min.y, min.z);
-		vertex++;
-		vertex->position.Set(max.x, max.y, min.z);
-		vertex++;
-
-		vertex->position.Set(max.x, min.y, min.z);
-		vertex++;
-		vertex->position.Set(max.x, min.y, max.z);
-		vertex++;
-
-		mapper.Unmap();
-
-		Renderer::SetRenderStates(s_renderStates);
-		Renderer::SetShader(s_shader);
-		Renderer::SetVertexBuffer(&s_vertexBuffer);
-
-		s_shader->SendColor(s_colorLocation, s_primaryColor);
-
-		Renderer::DrawPrimitives(PrimitiveMode_LineList, 0, 24);
+		AddBox(box, s_primaryColor);
 	}
 
 	void DebugDrawer::Draw(const Boxui& box)
@@ -151,217 +197,52 @@ namespace Nz
 
 	void DebugDrawer::Draw(const Frustumf& frustum)
 	{
-		if (!Initialize())
-		{
-			NazaraError("Failed to initialize Debug Drawer");
+		if (!BeginPrimitive())
 			return;
-		}
 
-		BufferMapper<VertexBuffer> mapper(s_vertexBuffer, BufferAccess_DiscardAndWrite, 0, 24);
-		VertexStruct_XYZ* vertex = static_cast<VertexStruct_XYZ*>(mapper.GetPointer());
-
-		vertex->position.Set(frustum.GetCorner(BoxCorner_NearLeftBottom));
-		vertex++;
-		vertex->position.Set(frustum.GetCorner(BoxCorner_NearRightBottom));
-		vertex++;
-
-		vertex->position.Set(frustum.GetCorner(BoxCorner_NearLeftBottom));
-		vertex++;
-		vertex->position.Set(frustum.GetCorner(BoxCorner_NearLeftTop));
-		vertex++;
-
-		vertex->position.Set(frustum.GetCorner(BoxCorner_NearLeftBottom));
-		vertex++;
-		vertex->position.Set(frustum.GetCorner(BoxCorner_FarLeftBottom));
-		vertex++;
-
-		vertex->position.Set(frustum.GetCorner(BoxCorner_FarRightTop));
-		vertex++;
-		vertex->position.Set(frustum.GetCorner(BoxCorner_FarLeftTop));
-		vertex++;
-
-		vertex->position.Set(frustum.GetCorner(BoxCorner_FarRightTop));
-		vertex++;
-		vertex->position.Set(frustum.GetCorner(BoxCorner_FarRightBottom));
-		vertex++;
-
-		vertex->position.Set(frustum.GetCorner(BoxCorner_FarRightTop));
-		vertex++;
-		vertex->position.Set(frustum.GetCorner(BoxCorner_NearRightTop));
-		vertex++;
-
-		vertex->position.Set(frustum.GetCorner(BoxCorner_FarLeftBottom));
-		vertex++;
-		vertex->position.Set(frustum.GetCorner(BoxCorner_FarRightBottom));
-		vertex++;
-
-		vertex->position.Set(frustum.GetCorner(BoxCorner_FarLeftBottom));
-		vertex++;
-		vertex->position.Set(frustum.GetCorner(BoxCorner_FarLeftTop));
-		vertex++;
-
-		vertex->position.Set(frustum.GetCorner(BoxCorner_NearLeftTop));
-		vertex++;
-		vertex->position.Set(frustum.GetCorner(BoxCorner_NearRightTop));
-		vertex++;
-
-		vertex->position.Set(frustum.GetCorner(BoxCorner_NearLeftTop));
-		vertex++;
-		vertex->position.Set(frustum.GetCorner(BoxCorner_FarLeftTop));
-		vertex++;
-
-		vertex->position.Set(frustum.GetCorner(BoxCorner_NearRightBottom));
-		vertex++;
-		vertex->position.Set(frustum.GetCorner(BoxCorner_NearRightTop));
-		vertex++;
-
-		vertex->position.Set(frustum.GetCorner(BoxCorner_NearRightBottom));
-		vertex++;
-		vertex->position.Set(frustum.GetCorner(BoxCorner_FarRightBottom));
-		vertex++;
-
-		mapper.Unmap();
-
-		Renderer::SetRenderStates(s_renderStates);
-		Renderer::SetShader(s_shader);
-		Renderer::SetVertexBuffer(&s_vertexBuffer);
-
-		s_shader->SendColor(s_colorLocation, s_primaryColor);
-
-		Renderer::DrawPrimitives(PrimitiveMode_LineList, 0, 24);
+		AddBox(frustum, s_primaryColor);
 	}
 
 	void DebugDrawer::Draw(const OrientedBoxf& orientedBox)
 	{
-		if (!Initialize())
-		{
-			NazaraError("Failed to initialize Debug Drawer");
+		if (!BeginPrimitive())
 			return;
-		}
 
-		BufferMapper<VertexBuffer> mapper(s_vertexBuffer, BufferAccess_DiscardAndWrite, 0, 24);
-		VertexStruct_XYZ* vertex = static_cast<VertexStruct_XYZ*>(mapper.GetPointer());
-
-		vertex->position.Set(orientedBox.GetCorner(BoxCorner_NearLeftBottom));
-		vertex++;
-		vertex->position.Set(orientedBox.GetCorner(BoxCorner_NearRightBottom));
-		vertex++;
-
-		vertex->position.Set(orientedBox.GetCorner(BoxCorner_NearLeftBottom));
-		vertex++;
-		vertex->position.Set(orientedBox.GetCorner(BoxCorner_NearLeftTop));
-		vertex++;
-
-		vertex->position.Set(orientedBox.GetCorner(BoxCorner_NearLeftBottom));
-		vertex++;
-		vertex->position.Set(orientedBox.GetCorner(BoxCorner_FarLeftBottom));
-		vertex++;
-
-		vertex->position.Set(orientedBox.GetCorner(BoxCorner_FarRightTop));
-		vertex++;
-		vertex->position.Set(orientedBox.GetCorner(BoxCorner_FarLeftTop));
-		vertex++;
-
-		vertex->position.Set(orientedBox.GetCorner(BoxCorner_FarRightTop));
-		vertex++;
-		vertex->position.Set(orientedBox.GetCorner(BoxCorner_FarRightBottom));
-		vertex++;
-
-		vertex->position.Set(orientedBox.GetCorner(BoxCorner_FarRightTop));
-		vertex++;
-		vertex->position.Set(orientedBox.GetCorner(BoxCorner_NearRightTop));
-		vertex++;
-
-		vertex->position.Set(orientedBox.GetCorner(BoxCorner_FarLeftBottom));
-		vertex++;
-		vertex->position.Set(orientedBox.GetCorner(BoxCorner_FarRightBottom));
-		vertex++;
-
-		vertex->position.Set(orientedBox.GetCorner(BoxCorner_FarLeftBottom));
-		vertex++;
-		vertex->position.Set(orientedBox.GetCorner(BoxCorner_FarLeftTop));
-		vertex++;
-
-		vertex->position.Set(orientedBox.GetCorner(BoxCorner_NearLeftTop));
-		vertex++;
-		vertex->position.Set(orientedBox.GetCorner(BoxCorner_NearRightTop));
-		vertex++;
-
-		vertex->position.Set(orientedBox.GetCorner(BoxCorner_NearLeftTop));
-		vertex++;
-		vertex->position.Set(orientedBox.GetCorner(BoxCorner_FarLeftTop));
-		vertex++;
-
-		vertex->position.Set(orientedBox.GetCorner(BoxCorner_NearRightBottom));
-		vertex++;
-		vertex->position.Set(orientedBox.GetCorner(BoxCorner_NearRightTop));
-		vertex++;
-
-		vertex->position.Set(orientedBox.GetCorner(BoxCorner_NearRightBottom));
-		vertex++;
-		vertex->position.Set(orientedBox.GetCorner(BoxCorner_FarRightBottom));
-		vertex++;
-
-		mapper.Unmap();
-
-		Renderer::SetRenderStates(s_renderStates);
-		Renderer::SetShader(s_shader);
-		Renderer::SetVertexBuffer(&s_vertexBuffer);
-
-		s_shader->SendColor(s_colorLocation, s_primaryColor);
-
-		Renderer::DrawPrimitives(PrimitiveMode_LineList, 0, 24);
+		AddBox(orientedBox, s_primaryColor);
 	}
 
 	void DebugDrawer::Draw(const Skeleton* skeleton)
 	{
-		if (!Initialize())
-		{
-			NazaraError("Failed to initialize Debug Drawer");
+		if (!BeginPrimitive())
 			return;
-		}
 
-		unsigned int jointCount = skeleton->GetJointCount();
-		if (s_vertexBuffer.GetVertexCount() < jointCount*2)
+		std::size_t jointCount = skeleton->GetJointCount();
+
+		std::size_t boneCount = 0;
+		for (std::size_t i = 0; i < jointCount; ++i)
 		{
-			NazaraError("Debug buffer not large enougth to draw object");
-			return;
+			if (skeleton->GetJoint(i)->GetParent())
+				boneCount++;
 		}
 
-		BufferMapper<VertexBuffer> mapper(s_vertexBuffer, BufferAccess_DiscardAndWrite, 0, jointCount*2);
-		VertexStruct_XYZ* vertex = static_cast<VertexStruct_XYZ*>(mapper.GetPointer());
+		if (boneCount == 0)
+			return;
 
-		unsigned int vertexCount = 0;
-		for (unsigned int i = 0; i < jointCount; ++i)
+		DebugVertex* lineVertex = AllocateVertices(BatchType_Lines, boneCount * 2);
+		DebugVertex* pointVertex = AllocateVertices(BatchType_Points, boneCount * 2);
+		for (std::size_t i = 0; i < jointCount; ++i)
 		{
 			const Node* joint = skeleton->GetJoint(i);
 			const Node* parent = joint->GetParent();
 			if (parent)
 			{
-				vertex->position = joint->GetPosition();
-				vertex++;
-
-				vertex->position = parent->GetPosition();
-				vertex++;
+				SetVertex(lineVertex++, joint->GetPosition(), s_primaryColor);
+				SetVertex(lineVertex++, parent->GetPosition(), s_primaryColor);
 
-				vertexCount += 2;
+				SetVertex(pointVertex++, joint->GetPosition(), s_secondaryColor);
+				SetVertex(pointVertex++, parent->GetPosition(), s_secondaryColor);
 			}
 		}
-
-		mapper.Unmap();
-
-		if (vertexCount > 0)
-		{
-			Renderer::SetRenderStates(s_renderStates);
-			Renderer::SetShader(s_shader);
-			Renderer::SetVertexBuffer(&s_vertexBuffer);
-
-			s_shader->SendColor(s_colorLocation, s_primaryColor);
-			Renderer::DrawPrimitives(PrimitiveMode_LineList, 0, vertexCount);
-
-			s_shader->SendColor(s_colorLocation, s_secondaryColor);
-			Renderer::DrawPrimitives(PrimitiveMode_PointList, 0, vertexCount);
-		}
 	}
 
 	void DebugDrawer::Draw(const Vector3f& position, float size)
@@ -390,67 +271,25 @@ namespace Nz
 
 	void DebugDrawer::DrawBinormals(const StaticMesh* subMesh)
 	{
-		if (!Initialize())
-		{
-			NazaraError("Failed to initialize Debug Drawer");
+		if (!BeginPrimitive())
 			return;
-		}
 
-		unsigned int normalCount = subMesh->GetVertexCount();
-		unsigned int vertexCount = normalCount*2;
-		if (s_vertexBuffer.GetVertexCount() < vertexCount)
+		AddMeshLines(subMesh, [] (const MeshVertex& vertex)
 		{
-			NazaraError("Debug buffer not large enougth to draw object");
-			return;
-		}
-
-		BufferMapper<VertexBuffer> inputMapper(subMesh->GetVertexBuffer(), BufferAccess_ReadOnly);
-		BufferMapper<VertexBuffer> outputMapper(s_vertexBuffer, BufferAccess_DiscardAndWrite, 0, vertexCount);
-
-		MeshVertex* inputVertex = static_cast<MeshVertex*>(inputMapper.GetPointer());
-		VertexStruct_XYZ* outputVertex = static_cast<VertexStruct_XYZ*>(outputMapper.GetPointer());
-
-		for (unsigned int i = 0; i < normalCount; ++i)
-		{
-			outputVertex->position = inputVertex->position;
-			outputVertex++;
-
-			outputVertex->position = inputVertex->position + Vector3f::CrossProduct(inputVertex->normal, inputVertex->tangent)*0.01f;
-			outputVertex++;
-
-			inputVertex++;
-		}
-
-		inputMapper.Unmap();
-		outputMapper.Unmap();
-
-		if (vertexCount > 0)
-		{
-			Renderer::SetRenderStates(s_renderStates);
-			Renderer::SetShader(s_shader);
-			Renderer::SetVertexBuffer(&s_vertexBuffer);
-
-			s_shader->SendColor(s_colorLocation, s_primaryColor);
-			Renderer::DrawPrimitives(PrimitiveMode_LineList, 0, vertexCount);
-		}
+			return vertex.position + Vector3f::CrossProduct(vertex.normal, vertex.tangent)*0.01f;
+		});
 	}
 
 	void DebugDrawer::DrawCone(const Vector3f& origin, const Quaternionf& rotation, float angle, float length)
 	{
-		if (!Initialize())
-		{
-			NazaraError("Failed to initialize Debug Drawer");
+		if (!BeginPrimitive())
 			return;
-		}
 
 		Matrix4f transformMatrix;
 		transformMatrix.MakeIdentity();
 		transformMatrix.SetRotation(rotation);
 		transformMatrix.SetTranslation(origin);
 
-		BufferMapper<VertexBuffer> mapper(s_vertexBuffer, BufferAccess_DiscardAndWrite, 0, 16);
-		VertexStruct_XYZ* vertex = static_cast<VertexStruct_XYZ*>(mapper.GetPointer());
-
 		// On calcule le reste des points
 		Vector3f base(Vector3f::Forward()*length);
 
@@ -460,199 +299,152 @@ namespace Nz
 		Vector3f lExtend = Vector3f::Left()*radius;
 		Vector3f uExtend = Vector3f::Up()*radius;
 
-		vertex->position.Set(transformMatrix * Vector3f::Zero());
-		vertex++;
-		vertex->position.Set(transformMatrix * (base + lExtend + uExtend));
-		vertex++;
-
-		vertex->position.Set(transformMatrix * (base + lExtend + uExtend));
-		vertex++;
-		vertex->position.Set(transformMatrix * (base + lExtend - uExtend));
-		vertex++;
-
-		vertex->position.Set(transformMatrix * Vector3f::Zero());
-		vertex++;
-		vertex->position.Set(transformMatrix * (base + lExtend - uExtend));
-		vertex++;
-
-		vertex->position.Set(transformMatrix * (base + lExtend - uExtend));
-		vertex++;
-		vertex->position.Set(transformMatrix * (base - lExtend - uExtend));
-		vertex++;
-
-		vertex->position.Set(transformMatrix * Vector3f::Zero());
-		vertex++;
-		vertex->position.Set(transformMatrix * (base - lExtend + uExtend));
-		vertex++;
-
-		vertex->position.Set(transformMatrix * (base - lExtend + uExtend));
-		vertex++;
-		vertex->position.Set(transformMatrix * (base - lExtend - uExtend));
-		vertex++;
-
-		vertex->position.Set(transformMatrix * Vector3f::Zero());
-		vertex++;
-		vertex->position.Set(transformMatrix * (base - lExtend - uExtend));
-		vertex++;
-
-		vertex->position.Set(transformMatrix * (base - lExtend + uExtend));
-		vertex++;
-		vertex->position.Set(transformMatrix * (base + lExtend + uExtend));
-		vertex++;
-
-		mapper.Unmap();
-
-		Renderer::SetRenderStates(s_renderStates);
-		Renderer::SetShader(s_shader);
-		Renderer::SetVertexBuffer(&s_vertexBuffer);
+		Vector3f apex = transformMatrix * Vector3f::Zero();
+		Vector3f baseCorners[4] = {
+			transformMatrix * (base + lExtend + uExtend),
+			transformMatrix * (base + lExtend - uExtend),
+			transformMatrix * (base - lExtend - uExtend),
+			transformMatrix * (base - lExtend + uExtend)
+		};
 
-		s_shader->SendColor(s_colorLocation, s_primaryColor);
+		DebugVertex* vertex = AllocateVertices(BatchType_Lines, 16);
+		for (unsigned int i = 0; i < 4; ++i)
+		{
+			SetVertex(vertex++, apex, s_primaryColor);
+			SetVertex(vertex++, baseCorners[i], s_primaryColor);
 
-		Renderer::DrawPrimitives(PrimitiveMode_LineList, 0, 16);
+			SetVertex(vertex++, baseCorners[i], s_primaryColor);
+			SetVertex(vertex++, baseCorners[(i + 1) % 4], s_primaryColor);
+		}
 	}
 
 	void DebugDrawer::DrawLine(const Vector3f& p1, const Vector3f& p2)
 	{
-		if (!s_initialized && !Initialize())
-		{
-			NazaraError("Failed to initialize Debug Drawer");
+		if (!BeginPrimitive())
 			return;
-		}
 
-		VertexStruct_XYZ buffer[2];
-		buffer[0].position = p1;
-		buffer[1].position = p2;
-
-		s_vertexBuffer.Fill(&buffer[0], 0, 2);
-
-		Renderer::SetRenderStates(s_renderStates);
-		Renderer::SetShader(s_shader);
-		Renderer::SetVertexBuffer(&s_vertexBuffer);
-
-		s_shader->SendColor(s_colorLocation, s_primaryColor);
-		Renderer::DrawPrimitives(PrimitiveMode_LineList, 0, 2);
+		DebugVertex* vertex = AllocateVertices(BatchType_Lines, 2);
+		SetVertex(vertex++, p1, s_primaryColor);
+		SetVertex(vertex++, p2, s_primaryColor);
 	}
 
 	void DebugDrawer::DrawPoints(const Vector3f* ptr, unsigned int pointCount)
 	{
-		static_assert(sizeof(VertexStruct_XYZ) == sizeof(Vector3f), "VertexStruct_XYZ is no longer equal to Vector3f, please rewrite this");
-
-		if (!s_initialized && !Initialize())
-		{
-			NazaraError("Failed to initialize Debug Drawer");
+		if (pointCount == 0 || !BeginPrimitive())
 			return;
-		}
 
-		if (pointCount > 0)
-		{
-			s_vertexBuffer.Fill(ptr, 0, pointCount);
-
-			Renderer::SetRenderStates(s_renderStates);
-			Renderer::SetShader(s_shader);
-			Renderer::SetVertexBuffer(&s_vertexBuffer);
-
-			s_shader->SendColor(s_colorLocation, s_primaryColor);
-			Renderer::DrawPrimitives(PrimitiveMode_PointList, 0, pointCount);
-		}
+		DebugVertex* vertex = AllocateVertices(BatchType_Points, pointCount);
+		for (unsigned int i = 0; i < pointCount; ++i)
+			SetVertex(vertex++, ptr[i], s_primaryColor);
 	}
 
 	void DebugDrawer::DrawNormals(const StaticMesh* subMesh)
 	{
-		if (!s_initialized && !Initialize())
-		{
-			NazaraError("Failed to initialize Debug Drawer");
+		if (!BeginPrimitive())
 			return;
-		}
 
-		unsigned int normalCount = subMesh->GetVertexCount();
-		unsigned int vertexCount = normalCount*2;
-		if (s_vertexBuffer.GetVertexCount() < vertexCount)
+		AddMeshLines(subMesh, [] (const MeshVertex& vertex)
 		{
-			NazaraError("Debug buffer not large enougth to draw object");
-			return;
-		}
-
-		BufferMapper<VertexBuffer> inputMapper(subMesh->GetVertexBuffer(), BufferAccess_ReadOnly);
-		BufferMapper<VertexBuffer> outputMapper(s_vertexBuffer, BufferAccess_DiscardAndWrite, 0, vertexCount);
+			return vertex.position + vertex.normal*0.01f;
+		});
+	}
 
-		MeshVertex* inputVertex = static_cast<MeshVertex*>(inputMapper.GetPointer());
-		VertexStruct_XYZ* outputVertex = static_cast<VertexStruct_XYZ*>(outputMapper.GetPointer());
+	void DebugDrawer::DrawTangents(const StaticMesh* subMesh)
+	{
+		if (!BeginPrimitive())
+			return;
 
-		for (unsigned int i = 0; i < normalCount; ++i)
+		AddMeshLines(subMesh, [] (const MeshVertex& vertex)
 		{
-			outputVertex->position = inputVertex->position;
-			outputVertex++;
+			return vertex.position + vertex.tangent*0.01f;
+		});
+	}
 
-			outputVertex->position = inputVertex->position + inputVertex->normal*0.01f;
-			outputVertex++;
+	void DebugDrawer::EnableDepthBuffer(bool depthBuffer)
+	{
+		s_renderStates.depthBuffer = depthBuffer;
+	}
 
-			inputVertex++;
-		}
+	/*!
+	* \brief Draws the recorded primitives on the current render target
+	*
+	* Every batch is written into the streamed vertex buffer at once, then drawn with one call per primitive type and depth mode.
+	*
+	* \remark The render states, shader and vertex buffer of the renderer are restored afterwards
+	*/
 
-		inputMapper.Unmap();
-		outputMapper.Unmap();
+	void DebugDrawer::Flush()
+	{
+		if (s_flushing || !HasPendingPrimitives())
+			return;
 
-		if (vertexCount > 0)
+		s_flushing = true;
+		CallOnExit resetFlushing([] ()
 		{
-			Renderer::SetRenderStates(s_renderStates);
-			Renderer::SetShader(s_shader);
-			Renderer::SetVertexBuffer(&s_vertexBuffer);
+			s_flushing = false;
+		});
 
-			s_shader->SendColor(s_colorLocation, s_primaryColor);
-			Renderer::DrawPrimitives(PrimitiveMode_LineList, 0, vertexCount);
-		}
-	}
+		std::size_t vertexCount = 0;
+		for (const auto& batch : s_batches)
+			vertexCount += batch.size();
 
-	void DebugDrawer::DrawTangents(const StaticMesh* subMesh)
-	{
-		if (!s_initialized && !Initialize())
-		{
-			NazaraError("Failed to initialize Debug Drawer");
-			return;
-		}
-
-		unsigned int tangentCount = subMesh->GetVertexCount();
-		unsigned int vertexCount = tangentCount*2;
 		if (s_vertexBuffer.GetVertexCount() < vertexCount)
 		{
-			NazaraError("Debug buffer not large enougth to draw object");
-			return;
+			try
+			{
+				ErrorFlags flags(ErrorFlag_ThrowException, true);
+				s_vertexBuffer.Reset(s_vertexDeclaration, static_cast<UInt32>(GetNearestPowerOfTwo(vertexCount)), DataStorage_Hardware, BufferUsage_Dynamic);
+			}
+			catch (const std::exception& e)
+			{
+				NazaraError("Failed to grow debug buffer: " + String(e.what()));
+				Clear();
+				return;
+			}
 		}
 
-		BufferMapper<VertexBuffer> inputMapper(subMesh->GetVertexBuffer(), BufferAccess_ReadOnly);
-		BufferMapper<VertexBuffer> outputMapper(s_vertexBuffer, BufferAccess_DiscardAndWrite, 0, vertexCount);
-
-		MeshVertex* inputVertex = static_cast<MeshVertex*>(inputMapper.GetPointer());
-		VertexStruct_XYZ* outputVertex = static_cast<VertexStruct_XYZ*>(outputMapper.GetPointer());
-
-		for (unsigned int i = 0; i < tangentCount; ++i)
+		std::array<std::size_t, BatchType_Max + 1> firstVertices;
 		{
-			outputVertex->position = inputVertex->position;
-			outputVertex++;
+			BufferMapper<VertexBuffer> mapper(s_vertexBuffer, BufferAccess_DiscardAndWrite, 0, static_cast<UInt32>(vertexCount));
+			UInt8* ptr = static_cast<UInt8*>(mapper.GetPointer());
 
-			outputVertex->position = inputVertex->position + inputVertex->tangent*0.01f;
-			outputVertex++;
+			std::size_t firstVertex = 0;
+			for (unsigned int i = 0; i <= BatchType_Max; ++i)
+			{
+				const std::vector<DebugVertex>& batch = s_batches[i];
+				std::memcpy(ptr + firstVertex * sizeof(DebugVertex), batch.data(), batch.size() * sizeof(DebugVertex));
 
-			inputVertex++;
+				firstVertices[i] = firstVertex;
+				firstVertex += batch.size();
+			}
 		}
 
-		inputMapper.Unmap();
-		outputMapper.Unmap();
+		RenderStates previousStates = Renderer::GetRenderStates();
+		const Shader* previousShader = Renderer::GetShader();
+		const VertexBuffer* previousVertexBuffer = Renderer::GetVertexBuffer();
+
+		Renderer::SetShader(s_shader);
+		Renderer::SetVertexBuffer(&s_vertexBuffer);
 
-		if (vertexCount > 0)
+		RenderStates states(s_renderStates);
+		for (unsigned int i = 0; i <= BatchType_Max; ++i)
 		{
-			Renderer::SetRenderStates(s_renderStates);
-			Renderer::SetShader(s_shader);
-			Renderer::SetVertexBuffer(&s_vertexBuffer);
+			std::vector<DebugVertex>& batch = s_batches[i];
+			if (batch.empty())
+				continue;
+
+			states.depthBuffer = (i == BatchType_Lines || i == BatchType_Points);
+			Renderer::SetRenderStates(states);
+
+			PrimitiveMode mode = (i == BatchType_Lines || i == BatchType_LinesNoDepth) ? PrimitiveMode_LineList : PrimitiveMode_PointList;
+			Renderer::DrawPrimitives(mode, static_cast<unsigned int>(firstVertices[i]), static_cast<unsigned int>(batch.size()));
 
-			s_shader->SendColor(s_colorLocation, s_primaryColor);
-			Renderer::DrawPrimitives(PrimitiveMode_LineList, 0, vertexCount);
+			batch.clear();
 		}
-	}
 
-	void DebugDrawer::EnableDepthBuffer(bool depthBuffer)
-	{
-		s_renderStates.depthBuffer = depthBuffer;
+		Renderer::SetRenderStates(previousStates);
+		Renderer::SetShader(previousShader);
+		Renderer::SetVertexBuffer(previousVertexBuffer);
 	}
 
 	float DebugDrawer::GetLineWidth()
@@ -675,19 +467,40 @@ namespace Nz
 		return s_secondaryColor;
 	}
 
+	/*!
+	* \brief Checks whether primitives are waiting to be drawn
+	* \return true if a batch isn't empty
+	*/
+
+	bool DebugDrawer::HasPendingPrimitives()
+	{
+		for (const auto& batch : s_batches)
+		{
+			if (!batch.empty())
+				return true;
+		}
+
+		return false;
+	}
+
 	bool DebugDrawer::Initialize()
 	{
 		if (!s_initialized)
 		{
 			// s_shader
-			s_shader = ShaderLibrary::Get("DebugSimple");
-			s_colorLocation = s_shader->GetUniformLocation("Color");
+			s_shader = ShaderLibrary::Get("DebugColored");
 
 			// s_vertexBuffer
 			try
 			{
 				ErrorFlags flags(ErrorFlag_ThrowException, true);
-				s_vertexBuffer.Reset(VertexDeclaration::Get(VertexLayout_XYZ), 65365, DataStorage_Hardware, BufferUsage_Dynamic);
+
+				s_vertexDeclaration = VertexDeclaration::New();
+				s_vertexDeclaration->EnableComponent(VertexComponent_Color,    ComponentType_Color,  NazaraOffsetOf(DebugVertex, color));
+				s_vertexDeclaration->EnableComponent(VertexComponent_Position, ComponentType_Float4, NazaraOffsetOf(DebugVertex, position));
+				s_vertexDeclaration->SetStride(sizeof(DebugVertex));
+
+				s_vertexBuffer.Reset(s_vertexDeclaration, 65536, DataStorage_Hardware, BufferUsage_Dynamic);
 			}
 			catch (const std::exception& e)
 			{
@@ -714,11 +527,19 @@ namespace Nz
 
 	void DebugDrawer::SetLineWidth(float width)
 	{
+		if (NumberEquals(s_renderStates.lineWidth, width))
+			return;
+
+		Flush();
 		s_renderStates.lineWidth = width;
 	}
 
 	void DebugDrawer::SetPointSize(float size)
 	{
+		if (NumberEquals(s_renderStates.pointSize, size))
+			return;
+
+		Flush();
 		s_renderStates.pointSize = size;
 	}
 
@@ -734,8 +555,14 @@ namespace Nz
 
 	void DebugDrawer::Uninitialize()
 	{
+		Clear();
+
+		for (auto& batch : s_batches)
+			batch.shrink_to_fit();
+
 		s_shader = nullptr;
 		s_vertexBuffer.Reset();
+		s_vertexDeclaration.Reset();
 		s_initialized = false;
 	}
 }
@@ -8,6 +8,7 @@
 #include <Nazara/Core/CallOnExit.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Renderer/Context.hpp>
+#include <cstring>
 #include <Nazara/Renderer/Debug.hpp>
 
 using namespace GLX;
@@ -275,10 +276,21 @@ namespace Nz
 		}
 	}
 
-	void ContextImpl::EnableVerticalSync(bool enabled)
+	void ContextImpl::EnableVerticalSync(bool enabled, bool adaptive)
 	{
 		if (glXSwapIntervalEXT)
-			glXSwapIntervalEXT(m_display, glXGetCurrentDrawable(), enabled ? 1 : 0);
+		{
+			// A negative interval lets late frames tear instead of waiting for the next vertical blank (only the EXT entry point supports it)
+			int interval = (enabled) ? 1 : 0;
+			if (enabled && adaptive)
+			{
+				const char* extensions = glXQueryExtensionsString(m_display, XDefaultScreen(m_display));
+				if (extensions && std::strstr(extensions, "GLX_EXT_swap_control_tear"))
+					interval = -1;
+			}
+
+			glXSwapIntervalEXT(m_display, glXGetCurrentDrawable(), interval);
+		}
 		else if (NzglXSwapIntervalMESA)
 			NzglXSwapIntervalMESA(enabled ? 1 : 0);
 		else if (glXSwapIntervalSGI)
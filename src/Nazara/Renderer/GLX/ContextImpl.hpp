@@ -25,7 +25,7 @@ namespace Nz
 
 			void Destroy();
 
-			void EnableVerticalSync(bool enabled);
+			void EnableVerticalSync(bool enabled, bool adaptive);
 
 			void SwapBuffers();
 
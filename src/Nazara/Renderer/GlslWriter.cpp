@@ -4,6 +4,7 @@
 
 #include <Nazara/Renderer/GlslWriter.hpp>
 #include <Nazara/Core/CallOnExit.hpp>
+#include <Nazara/Renderer/ShaderAstOptimizer.hpp>
 #include <Nazara/Renderer/Debug.hpp>
 
 namespace Nz
@@ -24,8 +25,12 @@ namespace Nz
 			m_currentState = nullptr;
 		});
 
+		// Specialize the AST for the enabled conditions first, so disabled code and the variables it uses are not written
+		ShaderAstOptimizer optimizer;
+		ShaderAst::StatementPtr optimizedNode = optimizer.Optimize(node, *this);
+
 		// Register global variables (uniforms, varying, ..)
-		node->Register(*this);
+		optimizedNode->Register(*this);
 
 		// Header
 		Append("#version ");
@@ -39,7 +44,7 @@ namespace Nz
 
 		Function entryPoint;
 		entryPoint.name = "main"; //< GLSL has only one entry point name possible
-		entryPoint.node = node;
+		entryPoint.node = optimizedNode;
 		entryPoint.retType = ShaderAst::ExpressionType::Void;
 
 		AppendFunction(entryPoint);
@@ -264,6 +269,15 @@ namespace Nz
 		Append(node.name);
 	}
 
+	void GlslWriter::Write(const ShaderAst::Sample& node)
+	{
+		Append("texture(");
+		Write(node.sampler);
+		Append(", ");
+		Write(node.coordinates);
+		Append(")");
+	}
+
 	void GlslWriter::Write(const ShaderAst::StatementBlock& node)
 	{
 		bool first = true;
@@ -310,6 +324,10 @@ namespace Nz
 	{
 		switch (builtin)
 		{
+			case ShaderAst::BuiltinEntry::FragmentDepth:
+				Append("gl_FragDepth");
+				break;
+
 			case ShaderAst::BuiltinEntry::VertexPosition:
 				Append("gl_Position");
 				break;
@@ -338,6 +356,12 @@ namespace Nz
 			case ShaderAst::ExpressionType::Mat4x4:
 				Append("mat4");
 				break;
+			case ShaderAst::ExpressionType::Sampler2D:
+				Append("sampler2D");
+				break;
+			case ShaderAst::ExpressionType::SamplerCube:
+				Append("samplerCube");
+				break;
 			case ShaderAst::ExpressionType::Void:
 				Append("void");
 				break;
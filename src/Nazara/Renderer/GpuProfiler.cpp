@@ -0,0 +1,172 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Renderer module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Renderer/GpuProfiler.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Renderer/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup renderer
+	* \class Nz::GpuProfiler
+	* \brief Renderer class that measures the GPU time of named sections of a frame
+	*
+	* Each section is surrounded by two timestamp queries, which allows sections to be nested.
+	* Results are read once the GPU is done with a frame, without ever waiting for it: a ring of frames keeps the queries of the last frames alive,
+	* and a frame whose queries are still not available once its slot is needed again is dropped.
+	*
+	* Sections are usually opened with GpuProfiler::Scope, which does nothing when no frame is being profiled.
+	*/
+
+	/*!
+	* \brief Constructs a GpuProfiler object
+	*
+	* \param frameLatency Number of frames the GPU may be late on the CPU before results are dropped, it must be at least two
+	*/
+	GpuProfiler::GpuProfiler(unsigned int frameLatency) :
+	m_frames(frameLatency),
+	m_currentFrame(0)
+	{
+		NazaraAssert(frameLatency > 1, "Frame latency must be at least two");
+	}
+
+	GpuProfiler::~GpuProfiler()
+	{
+		if (s_activeProfiler == this)
+			s_activeProfiler = nullptr;
+	}
+
+	/*!
+	* \brief Begins a frame, making this profiler the active one
+	*
+	* \remark Only one profiler can be active at a time
+	*/
+	void GpuProfiler::BeginFrame()
+	{
+		NazaraAssert(!s_activeProfiler, "A frame is already being profiled");
+
+		Frame& frame = m_frames[m_currentFrame];
+		if (frame.pending)
+			frame.pending = false; //< The GPU is too far behind, this frame is dropped instead of waiting for it
+
+		frame.sections.clear();
+		frame.usedQueries = 0;
+
+		s_activeProfiler = this;
+	}
+
+	/*!
+	* \brief Begins a section, ended by the next call to EndSection
+	*
+	* \param name Name of the section, it must outlive the profiler (a string literal for example)
+	*
+	* \see Scope
+	*/
+	void GpuProfiler::BeginSection(const char* name)
+	{
+		NazaraAssert(s_activeProfiler == this, "BeginFrame must be called first");
+
+		Frame& frame = m_frames[m_currentFrame];
+
+		Section section;
+		section.begin = AllocateQuery(frame);
+		section.depth = static_cast<unsigned int>(m_openSections.size());
+		section.end = nullptr;
+		section.name = name;
+
+		section.begin->WriteTimestamp();
+
+		m_openSections.push_back(frame.sections.size());
+		frame.sections.push_back(section);
+	}
+
+	/*!
+	* \brief Ends the frame and reads the results of the previous frames the GPU is done with
+	* \return true if the results were updated with a new frame
+	*
+	* \remark Sections still open are ended
+	*/
+	bool GpuProfiler::EndFrame()
+	{
+		NazaraAssert(s_activeProfiler == this, "BeginFrame must be called first");
+
+		if (!m_openSections.empty())
+		{
+			NazaraWarning(String::Number(m_openSections.size()) + " section(s) were not ended");
+
+			while (!m_openSections.empty())
+				EndSection();
+		}
+
+		Frame& frame = m_frames[m_currentFrame];
+		frame.pending = !frame.sections.empty();
+
+		s_activeProfiler = nullptr;
+
+		m_currentFrame = (m_currentFrame + 1) % m_frames.size();
+
+		return ResolveFrames();
+	}
+
+	/*!
+	* \brief Ends the latest section begun
+	*/
+	void GpuProfiler::EndSection()
+	{
+		NazaraAssert(!m_openSections.empty(), "No section to end");
+
+		Frame& frame = m_frames[m_currentFrame];
+
+		Section& section = frame.sections[m_openSections.back()];
+		m_openSections.pop_back();
+
+		section.end = AllocateQuery(frame);
+		section.end->WriteTimestamp();
+	}
+
+	GpuQuery* GpuProfiler::AllocateQuery(Frame& frame)
+	{
+		// Queries are kept from one use of the frame to the next
+		if (frame.usedQueries == frame.queries.size())
+			frame.queries.emplace_back(std::make_unique<GpuQuery>());
+
+		return frame.queries[frame.usedQueries++].get();
+	}
+
+	bool GpuProfiler::ResolveFrames()
+	{
+		bool resolved = false;
+
+		// From the oldest frame to the latest, the current frame being the next to be reused
+		for (std::size_t i = 0; i < m_frames.size(); ++i)
+		{
+			Frame& frame = m_frames[(m_currentFrame + i) % m_frames.size()];
+			if (!frame.pending)
+				continue;
+
+			// Commands are executed in order, once the last timestamp is available every other one is
+			if (!frame.queries[frame.usedQueries - 1]->IsResultAvailable())
+				break;
+
+			m_results.clear();
+			for (const Section& section : frame.sections)
+			{
+				SectionResult result;
+				result.depth = section.depth;
+				result.duration = section.end->GetResult() - section.begin->GetResult();
+				result.name = section.name;
+
+				m_results.push_back(result);
+			}
+
+			frame.pending = false;
+			resolved = true;
+		}
+
+		return resolved;
+	}
+
+	GpuProfiler* GpuProfiler::s_activeProfiler = nullptr;
+}
@@ -75,12 +75,13 @@ namespace Nz
 		glEndQuery(OpenGL::QueryMode[m_mode]);
 	}
 
-	unsigned int GpuQuery::GetResult() const
+	UInt64 GpuQuery::GetResult() const
 	{
 		Context::EnsureContext();
 
-		GLuint result;
-		glGetQueryObjectuiv(m_id, GL_QUERY_RESULT, &result);
+		// Timestamps and elapsed times are in nanoseconds, they don't fit in 32 bits
+		GLuint64 result;
+		glGetQueryObjectui64v(m_id, GL_QUERY_RESULT, &result);
 
 		return result;
 	}
@@ -95,6 +96,20 @@ namespace Nz
 		return available == GL_TRUE;
 	}
 
+	void GpuQuery::WriteTimestamp()
+	{
+		#ifdef NAZARA_DEBUG
+		if (Context::GetCurrent() == nullptr)
+		{
+			NazaraError("No active context");
+			return;
+		}
+		#endif
+
+		// The result is the GPU time (in nanoseconds) at which every previous command was executed
+		glQueryCounter(m_id, GL_TIMESTAMP);
+	}
+
 	unsigned int GpuQuery::GetOpenGLID() const
 	{
 		return m_id;
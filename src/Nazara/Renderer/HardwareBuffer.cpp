@@ -12,10 +12,20 @@
 
 namespace Nz
 {
+	namespace
+	{
+		GLenum GetUsageHint(BufferUsageFlags usage)
+		{
+			// Transient buffers are filled once and drawn during a single frame
+			return (usage & (BufferUsage_Dynamic | BufferUsage_Transient)) ? GL_STREAM_DRAW : GL_STATIC_DRAW;
+		}
+	}
+
 	HardwareBuffer::HardwareBuffer(Buffer* parent, BufferType type) :
 	m_buffer(0),
 	m_type(type),
-	m_parent(parent)
+	m_parent(parent),
+	m_persistentMapping(nullptr)
 	{
 	}
 
@@ -37,45 +47,47 @@ namespace Nz
 		glGenBuffers(1, &m_buffer);
 
 		OpenGL::BindBuffer(m_type, m_buffer);
-		glBufferData(OpenGL::BufferTarget[m_type], size, nullptr, (usage & BufferUsage_Dynamic) ? GL_STREAM_DRAW : GL_STATIC_DRAW);
+
+		if ((usage & BufferUsage_PersistentMapping) && OpenGL::IsSupported(OpenGLExtension_BufferStorage))
+		{
+			// The buffer is mapped once and for all, synchronizing the writes with the GPU is up to the user
+			GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+			glBufferStorage(OpenGL::BufferTarget[m_type], size, nullptr, flags);
+			m_persistentMapping = static_cast<UInt8*>(glMapBufferRange(OpenGL::BufferTarget[m_type], 0, size, flags));
+			if (!m_persistentMapping)
+			{
+				NazaraError("Failed to map buffer persistently (OpenGL error: 0x" + String::Number(glGetError(), 16) + ')');
+				return false;
+			}
+		}
+		else
+			glBufferData(OpenGL::BufferTarget[m_type], size, nullptr, GetUsageHint(usage));
 
 		return true;
 	}
 
 	bool HardwareBuffer::Fill(const void* data, UInt32 offset, UInt32 size)
 	{
-		Context::EnsureContext();
-
-		UInt32 totalSize = m_parent->GetSize();
+		if (m_persistentMapping)
+		{
+			std::memcpy(m_persistentMapping + offset, data, size);
+			OpenGL::RecordUpload(size);
+			return true;
+		}
 
-		//bool forceDiscard = (size == totalSize);
-		bool forceDiscard = true;
+		Context::EnsureContext();
 
 		OpenGL::BindBuffer(m_type, m_buffer);
 
-		// It seems glBuffer(Sub)Data performs faster than glMapBuffer under a specific range
-		// http://www.stevestreeting.com/2007/03/17/glmapbuffer-vs-glbuffersubdata-the-return/
-		if (size < 32*1024)
-		{
-			// http://www.opengl.org/wiki/Buffer_Object_Streaming
-			if (forceDiscard)
-				glBufferData(OpenGL::BufferTarget[m_type], totalSize, nullptr, (m_parent->GetUsage() & BufferUsage_Dynamic) ? GL_STREAM_DRAW : GL_STATIC_DRAW); // Discard
-
-			glBufferSubData(OpenGL::BufferTarget[m_type], offset, size, data);
-		}
+		// The data is handed directly to the driver, without mapping the buffer and copying it there
+		// Only a fill of the whole buffer can orphan its storage (http://www.opengl.org/wiki/Buffer_Object_Streaming), other parts of the buffer have to be kept
+		if (offset == 0 && size == m_parent->GetSize())
+			glBufferData(OpenGL::BufferTarget[m_type], size, data, GetUsageHint(m_parent->GetUsage()));
 		else
-		{
-			void* ptr = Map((forceDiscard) ? BufferAccess_DiscardAndWrite : BufferAccess_WriteOnly, offset, size);
-			if (!ptr)
-			{
-				NazaraError("Failed to map buffer");
-				return false;
-			}
-
-			std::memcpy(ptr, data, size);
+			glBufferSubData(OpenGL::BufferTarget[m_type], offset, size, data);
 
-			Unmap();
-		}
+		OpenGL::RecordUpload(size);
 
 		return true;
 	}
@@ -87,17 +99,40 @@ namespace Nz
 
 	void* HardwareBuffer::Map(BufferAccess access, UInt32 offset, UInt32 size)
 	{
+		// We can't know what will be written, so the whole mapping is counted
+		if (access != BufferAccess_ReadOnly)
+			OpenGL::RecordUpload(size);
+
+		if (m_persistentMapping)
+		{
+			if (access == BufferAccess_ReadOnly || access == BufferAccess_ReadWrite)
+			{
+				NazaraError("Persistently mapped buffers are write-only");
+				return nullptr;
+			}
+
+			return m_persistentMapping + offset;
+		}
+
 		Context::EnsureContext();
 
 		OpenGL::BindBuffer(m_type, m_buffer);
 
 		if (glMapBufferRange)
-			return glMapBufferRange(OpenGL::BufferTarget[m_type], offset, size, OpenGL::BufferLockRange[access]);
+		{
+			GLbitfield flags = OpenGL::BufferLockRange[access];
+
+			// Without buffer storage, persistent mapping falls back to unsynchronized mappings, the user still takes care of the synchronization
+			if ((m_parent->GetUsage() & BufferUsage_PersistentMapping) && access == BufferAccess_WriteOnly)
+				flags |= GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+
+			return glMapBufferRange(OpenGL::BufferTarget[m_type], offset, size, flags);
+		}
 		else
 		{
 			// http://www.opengl.org/wiki/Buffer_Object_Streaming
 			if (access == BufferAccess_DiscardAndWrite)
-				glBufferData(OpenGL::BufferTarget[m_type], m_parent->GetSize(), nullptr, (m_parent->GetUsage() & BufferUsage_Dynamic) ? GL_STREAM_DRAW : GL_STATIC_DRAW); // Discard
+				glBufferData(OpenGL::BufferTarget[m_type], m_parent->GetSize(), nullptr, GetUsageHint(m_parent->GetUsage())); // Discard
 
 			UInt8* ptr = static_cast<UInt8*>(glMapBuffer(OpenGL::BufferTarget[m_type], OpenGL::BufferLock[access]));
 			if (ptr)
@@ -109,6 +144,9 @@ namespace Nz
 
 	bool HardwareBuffer::Unmap()
 	{
+		if (m_persistentMapping)
+			return true;
+
 		Context::EnsureContext();
 
 		OpenGL::BindBuffer(m_type, m_buffer);
@@ -116,7 +154,7 @@ namespace Nz
 		if (glUnmapBuffer(OpenGL::BufferTarget[m_type]) != GL_TRUE)
 		{
 			// An error occured, we have to reset the buffer
-			glBufferData(OpenGL::BufferTarget[m_type], m_parent->GetSize(), nullptr, (m_parent->GetUsage() & BufferUsage_Dynamic) ? GL_STREAM_DRAW : GL_STATIC_DRAW);
+			glBufferData(OpenGL::BufferTarget[m_type], m_parent->GetSize(), nullptr, GetUsageHint(m_parent->GetUsage()));
 
 			NazaraError("Failed to unmap buffer, reinitialising content... (OpenGL error: 0x" + String::Number(glGetError(), 16) + ')');
 			return false;
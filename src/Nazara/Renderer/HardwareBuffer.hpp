@@ -38,6 +38,7 @@ namespace Nz
 			GLuint m_buffer;
 			BufferType m_type;
 			Buffer* m_parent;
+			UInt8* m_persistentMapping;
 	};
 }
 
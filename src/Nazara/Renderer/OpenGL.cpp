@@ -3,15 +3,20 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Renderer/OpenGL.hpp>
+#include <Nazara/Core/Algorithm.hpp>
 #include <Nazara/Core/CallOnExit.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/LockGuard.hpp>
 #include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Renderer/Context.hpp>
 #include <Nazara/Renderer/RenderStates.hpp>
 #include <Nazara/Renderer/RenderTarget.hpp>
 #if defined(NAZARA_PLATFORM_GLX)
 #include <Nazara/Platform/X11/Display.hpp>
 #endif // NAZARA_PLATFORM_GLX
+#include <atomic>
 #include <set>
 #include <sstream>
 #include <stdexcept>
@@ -73,13 +78,22 @@ namespace Nz
 			GarbageResourceType_VertexArray
 		};
 
+		struct UniformBufferBinding
+		{
+			GLuint buffer = 0;
+			UInt32 offset = 0;
+			UInt32 size = 0;
+		};
+
 		struct ContextStates
 		{
 			std::vector<std::pair<GarbageResourceType, GLuint>> garbage; // Les ressources à supprimer dès que possible
 			GLuint buffersBinding[BufferType_Max + 1] = {0};
 			GLuint currentProgram = 0;
+			GLuint currentVertexArray = 0; // Le Renderer garde son VAO actif entre les draw calls
 			GLuint samplers[32] = {0}; // 32 est pour l'instant la plus haute limite (GL_TEXTURE31)
 			GLuint texturesBinding[32] = {0}; // 32 est pour l'instant la plus haute limite (GL_TEXTURE31)
+			UniformBufferBinding uniformBuffers[32]; // Bindings over 32 aren't cached
 			Recti currentScissorBox = Recti(0, 0, 0, 0);
 			Recti currentViewport = Recti(0, 0, 0, 0);
 			RenderStates renderStates; // Toujours synchronisé avec OpenGL
@@ -89,13 +103,22 @@ namespace Nz
 			unsigned int textureUnit = 0;
 		};
 
+		enum ExtensionState : UInt8
+		{
+			ExtensionState_Unsupported,
+			ExtensionState_Supported,
+			ExtensionState_Unloaded //< Supported by the driver, its entry points are loaded on the first query
+		};
+
+		std::atomic<UInt8> s_openGLextensions[OpenGLExtension_Max + 1];
 		std::set<String> s_openGLextensionSet;
 		std::unordered_map<const Context*, ContextStates> s_contexts;
 		thread_local ContextStates* s_contextStates = nullptr;
+		Mutex s_extensionMutex;
+		RenderStatistics s_statistics;
 		String s_rendererName;
 		String s_vendorName;
 		bool s_initialized = false;
-		bool s_openGLextensions[OpenGLExtension_Max + 1] = {false};
 		unsigned int s_glslVersion = 0;
 		unsigned int s_openglVersion = 0;
 
@@ -142,6 +165,78 @@ namespace Nz
 
 			return true;
 		}
+
+		UInt8 DeferredExtensionState(bool available)
+		{
+			return (available) ? ExtensionState_Unloaded : ExtensionState_Unsupported;
+		}
+
+		bool LoadExtensionEntries(OpenGLExtension extension)
+		{
+			try
+			{
+				switch (extension)
+				{
+					case OpenGLExtension_BindlessTexture:
+						glGetTextureSamplerHandleARB = reinterpret_cast<PFNGLGETTEXTURESAMPLERHANDLEARBPROC>(LoadEntry("glGetTextureSamplerHandleARB"));
+						glMakeTextureHandleNonResidentARB = reinterpret_cast<PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC>(LoadEntry("glMakeTextureHandleNonResidentARB"));
+						glMakeTextureHandleResidentARB = reinterpret_cast<PFNGLMAKETEXTUREHANDLERESIDENTARBPROC>(LoadEntry("glMakeTextureHandleResidentARB"));
+						return true;
+
+					case OpenGLExtension_BufferStorage:
+						glBufferStorage = reinterpret_cast<PFNGLBUFFERSTORAGEPROC>(LoadEntry("glBufferStorage"));
+						return true;
+
+					case OpenGLExtension_CopyImage:
+						glCopyImageSubData = reinterpret_cast<PFNGLCOPYIMAGESUBDATAPROC>(LoadEntry("glCopyImageSubData"));
+						return true;
+
+					case OpenGLExtension_DebugOutput:
+						if (s_openglVersion >= 430 || s_openGLextensionSet.count("GL_KHR_debug") != 0)
+						{
+							glDebugMessageCallback = reinterpret_cast<PFNGLDEBUGMESSAGECALLBACKPROC>(LoadEntry("glDebugMessageCallback"));
+							glDebugMessageControl = reinterpret_cast<PFNGLDEBUGMESSAGECONTROLPROC>(LoadEntry("glDebugMessageControl"));
+							glDebugMessageInsert = reinterpret_cast<PFNGLDEBUGMESSAGEINSERTPROC>(LoadEntry("glDebugMessageInsert"));
+							glGetDebugMessageLog = reinterpret_cast<PFNGLGETDEBUGMESSAGELOGPROC>(LoadEntry("glGetDebugMessageLog"));
+						}
+						else
+						{
+							glDebugMessageCallback = reinterpret_cast<PFNGLDEBUGMESSAGECALLBACKARBPROC>(LoadEntry("glDebugMessageCallbackARB"));
+							glDebugMessageControl = reinterpret_cast<PFNGLDEBUGMESSAGECONTROLARBPROC>(LoadEntry("glDebugMessageControlARB"));
+							glDebugMessageInsert = reinterpret_cast<PFNGLDEBUGMESSAGEINSERTARBPROC>(LoadEntry("glDebugMessageInsertARB"));
+							glGetDebugMessageLog = reinterpret_cast<PFNGLGETDEBUGMESSAGELOGARBPROC>(LoadEntry("glGetDebugMessageLogARB"));
+						}
+						return true;
+
+					case OpenGLExtension_GetProgramBinary:
+						glGetProgramBinary = reinterpret_cast<PFNGLGETPROGRAMBINARYPROC>(LoadEntry("glGetProgramBinary"));
+						glProgramBinary = reinterpret_cast<PFNGLPROGRAMBINARYPROC>(LoadEntry("glProgramBinary"));
+						glProgramParameteri = reinterpret_cast<PFNGLPROGRAMPARAMETERIPROC>(LoadEntry("glProgramParameteri"));
+						return true;
+
+					case OpenGLExtension_MultiDrawIndirect:
+						glMultiDrawElementsIndirect = reinterpret_cast<PFNGLMULTIDRAWELEMENTSINDIRECTPROC>(LoadEntry("glMultiDrawElementsIndirect"));
+						return true;
+
+					case OpenGLExtension_TextureStorage:
+						glTexStorage1D = reinterpret_cast<PFNGLTEXSTORAGE1DPROC>(LoadEntry("glTexStorage1D"));
+						glTexStorage2D = reinterpret_cast<PFNGLTEXSTORAGE2DPROC>(LoadEntry("glTexStorage2D"));
+						glTexStorage3D = reinterpret_cast<PFNGLTEXSTORAGE3DPROC>(LoadEntry("glTexStorage3D"));
+						return true;
+
+					default:
+						break;
+				}
+			}
+			catch (const std::exception& e)
+			{
+				NazaraWarning("Failed to load OpenGL extension: " + String(e.what()));
+				return false;
+			}
+
+			NazaraInternalError("Extension #" + String::Number(extension) + " has no entry point to load");
+			return false;
+		}
 	}
 
 	void OpenGL::ApplyStates(const RenderStates& states)
@@ -165,6 +260,7 @@ namespace Nz
 				glBlendFunc(BlendFunc[states.srcBlend], BlendFunc[states.dstBlend]);
 				currentRenderStates.dstBlend = states.dstBlend;
 				currentRenderStates.srcBlend = states.srcBlend;
+				s_statistics.renderStateChanges++;
 			}
 		}
 
@@ -175,6 +271,7 @@ namespace Nz
 			{
 				glDepthFunc(RendererComparison[states.depthFunc]);
 				currentRenderStates.depthFunc = states.depthFunc;
+				s_statistics.renderStateChanges++;
 			}
 
 			// Le DepthWrite n'a aucune importance si le DepthBuffer est désactivé
@@ -182,6 +279,7 @@ namespace Nz
 			{
 				glDepthMask((states.depthWrite) ? GL_TRUE : GL_FALSE);
 				currentRenderStates.depthWrite = states.depthWrite;
+				s_statistics.renderStateChanges++;
 			}
 		}
 
@@ -192,6 +290,7 @@ namespace Nz
 			{
 				glCullFace(FaceSide[states.cullingSide]);
 				currentRenderStates.cullingSide = states.cullingSide;
+				s_statistics.renderStateChanges++;
 			}
 		}
 
@@ -199,6 +298,7 @@ namespace Nz
 		{
 			glPolygonMode(GL_FRONT_AND_BACK, FaceFilling[states.faceFilling]);
 			currentRenderStates.faceFilling = states.faceFilling;
+			s_statistics.renderStateChanges++;
 		}
 
 		// Ici encore, ça ne sert à rien de se soucier des fonctions de stencil sans qu'il soit activé
@@ -212,6 +312,7 @@ namespace Nz
 				currentRenderStates.stencilCompare.back = states.stencilCompare.back;
 				currentRenderStates.stencilReference.back = states.stencilReference.back;
 				currentRenderStates.stencilWriteMask.back = states.stencilWriteMask.back;
+				s_statistics.renderStateChanges++;
 			}
 
 			if (currentRenderStates.stencilDepthFail.back != states.stencilDepthFail.back ||
@@ -222,6 +323,7 @@ namespace Nz
 				currentRenderStates.stencilDepthFail.back = states.stencilDepthFail.back;
 				currentRenderStates.stencilFail.back = states.stencilFail.back;
 				currentRenderStates.stencilPass.back = states.stencilPass.back;
+				s_statistics.renderStateChanges++;
 			}
 
 			if (currentRenderStates.stencilCompare.front != states.stencilCompare.front ||
@@ -232,6 +334,7 @@ namespace Nz
 				currentRenderStates.stencilCompare.front = states.stencilCompare.front;
 				currentRenderStates.stencilReference.front = states.stencilReference.front;
 				currentRenderStates.stencilWriteMask.front = states.stencilWriteMask.front;
+				s_statistics.renderStateChanges++;
 			}
 
 			if (currentRenderStates.stencilDepthFail.front != states.stencilDepthFail.front ||
@@ -242,6 +345,7 @@ namespace Nz
 				currentRenderStates.stencilDepthFail.front = states.stencilDepthFail.front;
 				currentRenderStates.stencilFail.front = states.stencilFail.front;
 				currentRenderStates.stencilPass.front = states.stencilPass.front;
+				s_statistics.renderStateChanges++;
 			}
 		}
 
@@ -249,12 +353,14 @@ namespace Nz
 		{
 			glLineWidth(states.lineWidth);
 			currentRenderStates.lineWidth = states.lineWidth;
+			s_statistics.renderStateChanges++;
 		}
 
 		if (!NumberEquals(currentRenderStates.pointSize, states.pointSize, 0.001f))
 		{
 			glPointSize(states.pointSize);
 			currentRenderStates.pointSize = states.pointSize;
+			s_statistics.renderStateChanges++;
 		}
 
 		// Paramètres de rendu
@@ -266,6 +372,7 @@ namespace Nz
 				glDisable(GL_BLEND);
 
 			currentRenderStates.blending = states.blending;
+			s_statistics.renderStateChanges++;
 		}
 
 		if (currentRenderStates.colorWrite != states.colorWrite)
@@ -274,6 +381,7 @@ namespace Nz
 			glColorMask(param, param, param, param);
 
 			currentRenderStates.colorWrite = states.colorWrite;
+			s_statistics.renderStateChanges++;
 		}
 
 		if (currentRenderStates.depthBuffer != states.depthBuffer)
@@ -284,6 +392,7 @@ namespace Nz
 				glDisable(GL_DEPTH_TEST);
 
 			currentRenderStates.depthBuffer = states.depthBuffer;
+			s_statistics.renderStateChanges++;
 		}
 
 		if (currentRenderStates.faceCulling != states.faceCulling)
@@ -294,6 +403,7 @@ namespace Nz
 				glDisable(GL_CULL_FACE);
 
 			currentRenderStates.faceCulling = states.faceCulling;
+			s_statistics.renderStateChanges++;
 		}
 
 		if (currentRenderStates.scissorTest != states.scissorTest)
@@ -304,6 +414,7 @@ namespace Nz
 				glDisable(GL_SCISSOR_TEST);
 
 			currentRenderStates.scissorTest = states.scissorTest;
+			s_statistics.renderStateChanges++;
 		}
 
 		if (currentRenderStates.stencilTest != states.stencilTest)
@@ -314,6 +425,7 @@ namespace Nz
 				glDisable(GL_STENCIL_TEST);
 
 			currentRenderStates.stencilTest = states.stencilTest;
+			s_statistics.renderStateChanges++;
 		}
 	}
 
@@ -327,11 +439,19 @@ namespace Nz
 		}
 		#endif
 
+		// The index buffer binding is part of the vertex array state, we must not alter the VAO kept active by the Renderer
+		// (Our buffersBinding cache only tracks the bindings of the default vertex array)
+		if (type == BufferType_Index)
+			BindVertexArray(0);
+
 		if (s_contextStates->buffersBinding[type] != id)
 		{
 			glBindBuffer(BufferTarget[type], id);
 			s_contextStates->buffersBinding[type] = id;
+			s_statistics.bufferBindings++;
 		}
+		else
+			s_statistics.redundantBindings++;
 	}
 
 	void OpenGL::BindProgram(GLuint id)
@@ -348,7 +468,10 @@ namespace Nz
 		{
 			glUseProgram(id);
 			s_contextStates->currentProgram = id;
+			s_statistics.programBindings++;
 		}
+		else
+			s_statistics.redundantBindings++;
 	}
 
 	void OpenGL::BindSampler(GLuint unit, GLuint id)
@@ -371,7 +494,10 @@ namespace Nz
 		{
 			glBindSampler(unit, id);
 			s_contextStates->samplers[unit] = id;
+			s_statistics.samplerBindings++;
 		}
+		else
+			s_statistics.redundantBindings++;
 	}
 
 	void OpenGL::BindScissorBox(const Recti& scissorBox)
@@ -404,6 +530,7 @@ namespace Nz
 			{
 				unsigned int height = s_contextStates->currentTarget->GetSize().y;
 				glScissor(scissorBox.x, height - scissorBox.height - scissorBox.y, scissorBox.width, scissorBox.height);
+				s_statistics.renderStateChanges++;
 				s_contextStates->scissorBoxUpdated = true;
 			}
 			else
@@ -427,7 +554,10 @@ namespace Nz
 		{
 			glBindTexture(TextureTarget[type], id);
 			s_contextStates->texturesBinding[s_contextStates->textureUnit] = id;
+			s_statistics.textureBindings++;
 		}
+		else
+			s_statistics.redundantBindings++;
 	}
 
 	void OpenGL::BindTexture(unsigned int textureUnit, ImageType type, GLuint id)
@@ -446,7 +576,10 @@ namespace Nz
 
 			glBindTexture(TextureTarget[type], id);
 			s_contextStates->texturesBinding[textureUnit] = id;
+			s_statistics.textureBindings++;
 		}
+		else
+			s_statistics.redundantBindings++;
 	}
 
 	void OpenGL::BindTextureUnit(unsigned int textureUnit)
@@ -466,6 +599,57 @@ namespace Nz
 		}
 	}
 
+	void OpenGL::BindUniformBuffer(GLuint bindingIndex, GLuint id, UInt32 offset, UInt32 size)
+	{
+		#ifdef NAZARA_DEBUG
+		if (!s_contextStates)
+		{
+			NazaraError("No context activated");
+			return;
+		}
+		#endif
+
+		if (bindingIndex < CountOf(s_contextStates->uniformBuffers))
+		{
+			UniformBufferBinding& binding = s_contextStates->uniformBuffers[bindingIndex];
+			if (binding.buffer == id && binding.offset == offset && binding.size == size)
+			{
+				s_statistics.redundantBindings++;
+				return;
+			}
+
+			binding.buffer = id;
+			binding.offset = offset;
+			binding.size = size;
+		}
+
+		glBindBufferRange(GL_UNIFORM_BUFFER, bindingIndex, id, offset, size);
+		s_statistics.bufferBindings++;
+
+		// glBindBufferRange changes the generic binding point as well
+		s_contextStates->buffersBinding[BufferType_Uniform] = id;
+	}
+
+	void OpenGL::BindVertexArray(GLuint id)
+	{
+		#ifdef NAZARA_DEBUG
+		if (!s_contextStates)
+		{
+			NazaraError("No context activated");
+			return;
+		}
+		#endif
+
+		if (s_contextStates->currentVertexArray != id)
+		{
+			glBindVertexArray(id);
+			s_contextStates->currentVertexArray = id;
+			s_statistics.vertexArrayBindings++;
+		}
+		else
+			s_statistics.redundantBindings++;
+	}
+
 	void OpenGL::BindViewport(const Recti& viewport)
 	{
 		#ifdef NAZARA_DEBUG
@@ -496,6 +680,7 @@ namespace Nz
 			{
 				unsigned int height = s_contextStates->currentTarget->GetSize().y;
 				glViewport(viewport.x, height - viewport.height - viewport.y, viewport.width, viewport.height);
+				s_statistics.renderStateChanges++;
 				s_contextStates->viewportUpdated = true;
 			}
 			else
@@ -518,6 +703,15 @@ namespace Nz
 		glDeleteBuffers(1, &id);
 		if (s_contextStates->buffersBinding[type] == id)
 			s_contextStates->buffersBinding[type] = 0;
+
+		if (type == BufferType_Uniform)
+		{
+			for (UniformBufferBinding& binding : s_contextStates->uniformBuffers)
+			{
+				if (binding.buffer == id)
+					binding = UniformBufferBinding();
+			}
+		}
 	}
 
 	void OpenGL::DeleteFrameBuffer(const Context* context, GLuint id)
@@ -592,7 +786,13 @@ namespace Nz
 	{
 		// Si le contexte est actif, ne nous privons pas
 		if (Context::GetCurrent() == context)
-			glDeleteFramebuffers(1, &id);
+		{
+			glDeleteVertexArrays(1, &id);
+
+			// Deleting the active VAO reverts the binding to the default vertex array
+			if (s_contextStates->currentVertexArray == id)
+				s_contextStates->currentVertexArray = 0;
+		}
 		else
 			s_contexts[context].garbage.emplace_back(GarbageResourceType_VertexArray, id);
 	}
@@ -688,6 +888,19 @@ namespace Nz
 		return s_contextStates->textureUnit;
 	}
 
+	GLuint OpenGL::GetCurrentVertexArray()
+	{
+		#ifdef NAZARA_DEBUG
+		if (!s_contextStates)
+		{
+			NazaraError("No context activated");
+			return 0;
+		}
+		#endif
+
+		return s_contextStates->currentVertexArray;
+	}
+
 	Recti OpenGL::GetCurrentViewport()
 	{
 		#ifdef NAZARA_DEBUG
@@ -716,6 +929,11 @@ namespace Nz
 		return s_rendererName;
 	}
 
+	const RenderStatistics& OpenGL::GetStatistics()
+	{
+		return s_statistics;
+	}
+
 	String OpenGL::GetVendorName()
 	{
 		return s_vendorName;
@@ -731,6 +949,8 @@ namespace Nz
 		if (s_initialized)
 			return true;
 
+		Profiler::Scope profilerScope("OpenGL::Initialize");
+
 		#if defined(NAZARA_PLATFORM_GLX)
 		Initializer<X11> display;
 		if (!display)
@@ -883,8 +1103,11 @@ namespace Nz
 			glAttachShader = reinterpret_cast<PFNGLATTACHSHADERPROC>(LoadEntry("glAttachShader"));
 			glBeginConditionalRender = reinterpret_cast<PFNGLBEGINCONDITIONALRENDERPROC>(LoadEntry("glBeginConditionalRender"));
 			glBeginQuery = reinterpret_cast<PFNGLBEGINQUERYPROC>(LoadEntry("glBeginQuery"));
+			glBeginTransformFeedback = reinterpret_cast<PFNGLBEGINTRANSFORMFEEDBACKPROC>(LoadEntry("glBeginTransformFeedback"));
 			glBindAttribLocation = reinterpret_cast<PFNGLBINDATTRIBLOCATIONPROC>(LoadEntry("glBindAttribLocation"));
 			glBindBuffer = reinterpret_cast<PFNGLBINDBUFFERPROC>(LoadEntry("glBindBuffer"));
+			glBindBufferBase = reinterpret_cast<PFNGLBINDBUFFERBASEPROC>(LoadEntry("glBindBufferBase"));
+			glBindBufferRange = reinterpret_cast<PFNGLBINDBUFFERRANGEPROC>(LoadEntry("glBindBufferRange"));
 			glBindFragDataLocation = reinterpret_cast<PFNGLBINDFRAGDATALOCATIONPROC>(LoadEntry("glBindFragDataLocation"));
 			glBindFramebuffer = reinterpret_cast<PFNGLBINDFRAMEBUFFERPROC>(LoadEntry("glBindFramebuffer"));
 			glBindRenderbuffer = reinterpret_cast<PFNGLBINDRENDERBUFFERPROC>(LoadEntry("glBindRenderbuffer"));
@@ -901,6 +1124,7 @@ namespace Nz
 			glClearDepth = reinterpret_cast<PFNGLCLEARDEPTHPROC>(LoadEntry("glClearDepth"));
 			glClearStencil = reinterpret_cast<PFNGLCLEARSTENCILPROC>(LoadEntry("glClearStencil"));
 			glCheckFramebufferStatus = reinterpret_cast<PFNGLCHECKFRAMEBUFFERSTATUSPROC>(LoadEntry("glCheckFramebufferStatus"));
+			glClientWaitSync = reinterpret_cast<PFNGLCLIENTWAITSYNCPROC>(LoadEntry("glClientWaitSync"));
 			glCreateProgram = reinterpret_cast<PFNGLCREATEPROGRAMPROC>(LoadEntry("glCreateProgram"));
 			glCreateShader = reinterpret_cast<PFNGLCREATESHADERPROC>(LoadEntry("glCreateShader"));
 			glColorMask = reinterpret_cast<PFNGLCOLORMASKPROC>(LoadEntry("glColorMask"));
@@ -916,6 +1140,7 @@ namespace Nz
 			glDeleteProgram = reinterpret_cast<PFNGLDELETEPROGRAMPROC>(LoadEntry("glDeleteProgram"));
 			glDeleteRenderbuffers = reinterpret_cast<PFNGLDELETERENDERBUFFERSPROC>(LoadEntry("glDeleteRenderbuffers"));
 			glDeleteSamplers = reinterpret_cast<PFNGLDELETESAMPLERSPROC>(LoadEntry("glDeleteSamplers"));
+			glDeleteSync = reinterpret_cast<PFNGLDELETESYNCPROC>(LoadEntry("glDeleteSync"));
 			glDeleteShader = reinterpret_cast<PFNGLDELETESHADERPROC>(LoadEntry("glDeleteShader"));
 			glDeleteTextures = reinterpret_cast<PFNGLDELETETEXTURESPROC>(LoadEntry("glDeleteTextures"));
 			glDeleteVertexArrays = reinterpret_cast<PFNGLDELETEVERTEXARRAYSPROC>(LoadEntry("glDeleteVertexArrays"));
@@ -928,11 +1153,15 @@ namespace Nz
 			glDrawBuffer = reinterpret_cast<PFNGLDRAWBUFFERPROC>(LoadEntry("glDrawBuffer"));
 			glDrawBuffers = reinterpret_cast<PFNGLDRAWBUFFERSPROC>(LoadEntry("glDrawBuffers"));
 			glDrawElements = reinterpret_cast<PFNGLDRAWELEMENTSPROC>(LoadEntry("glDrawElements"));
+			glDrawElementsBaseVertex = reinterpret_cast<PFNGLDRAWELEMENTSBASEVERTEXPROC>(LoadEntry("glDrawElementsBaseVertex"));
 			glDrawElementsInstanced = reinterpret_cast<PFNGLDRAWELEMENTSINSTANCEDPROC>(LoadEntry("glDrawElementsInstanced"));
+			glDrawElementsInstancedBaseVertex = reinterpret_cast<PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC>(LoadEntry("glDrawElementsInstancedBaseVertex"));
 			glEnable = reinterpret_cast<PFNGLENABLEPROC>(LoadEntry("glEnable"));
 			glEnableVertexAttribArray = reinterpret_cast<PFNGLENABLEVERTEXATTRIBARRAYPROC>(LoadEntry("glEnableVertexAttribArray"));
 			glEndConditionalRender = reinterpret_cast<PFNGLENDCONDITIONALRENDERPROC>(LoadEntry("glEndConditionalRender"));
 			glEndQuery = reinterpret_cast<PFNGLENDQUERYPROC>(LoadEntry("glEndQuery"));
+			glEndTransformFeedback = reinterpret_cast<PFNGLENDTRANSFORMFEEDBACKPROC>(LoadEntry("glEndTransformFeedback"));
+			glFenceSync = reinterpret_cast<PFNGLFENCESYNCPROC>(LoadEntry("glFenceSync"));
 			glFlush = reinterpret_cast<PFNGLFLUSHPROC>(LoadEntry("glFlush"));
 			glFramebufferRenderbuffer = reinterpret_cast<PFNGLFRAMEBUFFERRENDERBUFFERPROC>(LoadEntry("glFramebufferRenderbuffer"));
 			glFramebufferTexture = reinterpret_cast<PFNGLFRAMEBUFFERTEXTUREPROC>(LoadEntry("glFramebufferTexture"));
@@ -956,6 +1185,7 @@ namespace Nz
 			glGetIntegerv = reinterpret_cast<PFNGLGETINTEGERVPROC>(LoadEntry("glGetIntegerv"));
 			glGetQueryiv = reinterpret_cast<PFNGLGETQUERYIVPROC>(LoadEntry("glGetQueryiv"));
 			glGetQueryObjectiv = reinterpret_cast<PFNGLGETQUERYOBJECTIVPROC>(LoadEntry("glGetQueryObjectiv"));
+			glGetQueryObjectui64v = reinterpret_cast<PFNGLGETQUERYOBJECTUI64VPROC>(LoadEntry("glGetQueryObjectui64v"));
 			glGetQueryObjectuiv = reinterpret_cast<PFNGLGETQUERYOBJECTUIVPROC>(LoadEntry("glGetQueryObjectuiv"));
 			glGetProgramiv = reinterpret_cast<PFNGLGETPROGRAMIVPROC>(LoadEntry("glGetProgramiv"));
 			glGetProgramInfoLog = reinterpret_cast<PFNGLGETPROGRAMINFOLOGPROC>(LoadEntry("glGetProgramInfoLog"));
@@ -968,6 +1198,7 @@ namespace Nz
 			glGetTexLevelParameteriv = reinterpret_cast<PFNGLGETTEXLEVELPARAMETERIVPROC>(LoadEntry("glGetTexLevelParameteriv"));
 			glGetTexParameterfv = reinterpret_cast<PFNGLGETTEXPARAMETERFVPROC>(LoadEntry("glGetTexParameterfv"));
 			glGetTexParameteriv = reinterpret_cast<PFNGLGETTEXPARAMETERIVPROC>(LoadEntry("glGetTexParameteriv"));
+			glGetUniformBlockIndex = reinterpret_cast<PFNGLGETUNIFORMBLOCKINDEXPROC>(LoadEntry("glGetUniformBlockIndex"));
 			glGetUniformfv = reinterpret_cast<PFNGLGETUNIFORMFVPROC>(LoadEntry("glGetUniformfv"));
 			glGetUniformiv = reinterpret_cast<PFNGLGETUNIFORMIVPROC>(LoadEntry("glGetUniformiv"));
 			glGetUniformLocation = reinterpret_cast<PFNGLGETUNIFORMLOCATIONPROC>(LoadEntry("glGetUniformLocation"));
@@ -979,6 +1210,7 @@ namespace Nz
 			glPixelStorei = reinterpret_cast<PFNGLPIXELSTOREIPROC>(LoadEntry("glPixelStorei"));
 			glPointSize = reinterpret_cast<PFNGLPOINTSIZEPROC>(LoadEntry("glPointSize"));
 			glPolygonMode = reinterpret_cast<PFNGLPOLYGONMODEPROC>(LoadEntry("glPolygonMode"));
+			glQueryCounter = reinterpret_cast<PFNGLQUERYCOUNTERPROC>(LoadEntry("glQueryCounter"));
 			glReadPixels = reinterpret_cast<PFNGLREADPIXELSPROC>(LoadEntry("glReadPixels"));
 			glRenderbufferStorage = reinterpret_cast<PFNGLRENDERBUFFERSTORAGEPROC>(LoadEntry("glRenderbufferStorage"));
 			glSamplerParameterf = reinterpret_cast<PFNGLSAMPLERPARAMETERFPROC>(LoadEntry("glSamplerParameterf"));
@@ -996,6 +1228,7 @@ namespace Nz
 			glTexSubImage1D = reinterpret_cast<PFNGLTEXSUBIMAGE1DPROC>(LoadEntry("glTexSubImage1D"));
 			glTexSubImage2D = reinterpret_cast<PFNGLTEXSUBIMAGE2DPROC>(LoadEntry("glTexSubImage2D"));
 			glTexSubImage3D = reinterpret_cast<PFNGLTEXSUBIMAGE3DPROC>(LoadEntry("glTexSubImage3D"));
+			glTransformFeedbackVaryings = reinterpret_cast<PFNGLTRANSFORMFEEDBACKVARYINGSPROC>(LoadEntry("glTransformFeedbackVaryings"));
 			glUniform1f = reinterpret_cast<PFNGLUNIFORM1FPROC>(LoadEntry("glUniform1f"));
 			glUniform1i = reinterpret_cast<PFNGLUNIFORM1IPROC>(LoadEntry("glUniform1i"));
 			glUniform1fv = reinterpret_cast<PFNGLUNIFORM1FVPROC>(LoadEntry("glUniform1fv"));
@@ -1006,6 +1239,7 @@ namespace Nz
 			glUniform3iv = reinterpret_cast<PFNGLUNIFORM3IVPROC>(LoadEntry("glUniform3iv"));
 			glUniform4fv = reinterpret_cast<PFNGLUNIFORM4FVPROC>(LoadEntry("glUniform4fv"));
 			glUniform4iv = reinterpret_cast<PFNGLUNIFORM4IVPROC>(LoadEntry("glUniform4iv"));
+			glUniformBlockBinding = reinterpret_cast<PFNGLUNIFORMBLOCKBINDINGPROC>(LoadEntry("glUniformBlockBinding"));
 			glUniformMatrix4fv = reinterpret_cast<PFNGLUNIFORMMATRIX4FVPROC>(LoadEntry("glUniformMatrix4fv"));
 			glUnmapBuffer = reinterpret_cast<PFNGLUNMAPBUFFERPROC>(LoadEntry("glUnmapBuffer"));
 			glUseProgram = reinterpret_cast<PFNGLUSEPROGRAMPROC>(LoadEntry("glUseProgram"));
@@ -1025,8 +1259,6 @@ namespace Nz
 		/****************************************Extensions****************************************/
 
 		// Fonctions optionnelles
-		glBindFragDataLocation = reinterpret_cast<PFNGLBINDFRAGDATALOCATIONPROC>(LoadEntry("glBindFragDataLocation"));
-
 		glDrawTexture = reinterpret_cast<PFNGLDRAWTEXTURENVPROC>(LoadEntry("glDrawTextureNV", false));
 		glInvalidateBufferData = reinterpret_cast<PFNGLINVALIDATEBUFFERDATAPROC>(LoadEntry("glInvalidateBufferData", false));
 		glVertexAttribLPointer = reinterpret_cast<PFNGLVERTEXATTRIBLPOINTERPROC>(LoadEntry("glVertexAttribLPointer", false));
@@ -1065,42 +1297,17 @@ namespace Nz
 		#endif
 
 		// AnisotropicFilter
-		s_openGLextensions[OpenGLExtension_AnisotropicFilter] = IsSupported("GL_EXT_texture_filter_anisotropic");
-
-		// DebugOutput
-		if (s_openglVersion >= 430 || IsSupported("GL_KHR_debug"))
-		{
-			try
-			{
-				glDebugMessageCallback = reinterpret_cast<PFNGLDEBUGMESSAGECALLBACKPROC>(LoadEntry("glDebugMessageCallback"));
-				glDebugMessageControl = reinterpret_cast<PFNGLDEBUGMESSAGECONTROLPROC>(LoadEntry("glDebugMessageControl"));
-				glDebugMessageInsert = reinterpret_cast<PFNGLDEBUGMESSAGEINSERTPROC>(LoadEntry("glDebugMessageInsert"));
-				glGetDebugMessageLog = reinterpret_cast<PFNGLGETDEBUGMESSAGELOGPROC>(LoadEntry("glGetDebugMessageLog"));
-
-				s_openGLextensions[OpenGLExtension_DebugOutput] = true;
-			}
-			catch (const std::exception& e)
-			{
-				NazaraWarning("Failed to load GL_KHR_debug: " + String(e.what()));
-			}
-		}
-
-		if (!s_openGLextensions[OpenGLExtension_DebugOutput] && IsSupported("GL_ARB_debug_output"))
-		{
-			try
-			{
-				glDebugMessageCallback = reinterpret_cast<PFNGLDEBUGMESSAGECALLBACKARBPROC>(LoadEntry("glDebugMessageCallbackARB"));
-				glDebugMessageControl = reinterpret_cast<PFNGLDEBUGMESSAGECONTROLARBPROC>(LoadEntry("glDebugMessageControlARB"));
-				glDebugMessageInsert = reinterpret_cast<PFNGLDEBUGMESSAGEINSERTARBPROC>(LoadEntry("glDebugMessageInsertARB"));
-				glGetDebugMessageLog = reinterpret_cast<PFNGLGETDEBUGMESSAGELOGARBPROC>(LoadEntry("glGetDebugMessageLogARB"));
-
-				s_openGLextensions[OpenGLExtension_DebugOutput] = true;
-			}
-			catch (const std::exception& e)
-			{
-				NazaraWarning("Failed to load GL_ARB_debug_output: " + String(e.what()));
-			}
-		}
+		s_openGLextensions[OpenGLExtension_AnisotropicFilter] = (IsSupported("GL_EXT_texture_filter_anisotropic")) ? ExtensionState_Supported : ExtensionState_Unsupported;
+
+		// Extensions whose entry points are only loaded when IsSupported is first called for them (see LoadExtensionEntries)
+		s_openGLextensions[OpenGLExtension_BindlessTexture] = DeferredExtensionState(IsSupported("GL_ARB_bindless_texture"));
+		s_openGLextensions[OpenGLExtension_BufferStorage] = DeferredExtensionState(s_openglVersion >= 440 || IsSupported("GL_ARB_buffer_storage"));
+		s_openGLextensions[OpenGLExtension_CopyImage] = DeferredExtensionState(s_openglVersion >= 430 || IsSupported("GL_ARB_copy_image"));
+		s_openGLextensions[OpenGLExtension_DebugOutput] = DeferredExtensionState(s_openglVersion >= 430 || IsSupported("GL_KHR_debug") || IsSupported("GL_ARB_debug_output"));
+		s_openGLextensions[OpenGLExtension_GetProgramBinary] = DeferredExtensionState(s_openglVersion >= 410 || IsSupported("GL_ARB_get_program_binary"));
+		// The base instance of the indirect commands requires ARB_base_instance
+		s_openGLextensions[OpenGLExtension_MultiDrawIndirect] = DeferredExtensionState(s_openglVersion >= 430 || (IsSupported("GL_ARB_multi_draw_indirect") && IsSupported("GL_ARB_base_instance")));
+		s_openGLextensions[OpenGLExtension_TextureStorage] = DeferredExtensionState(s_openglVersion >= 420 || IsSupported("GL_ARB_texture_storage"));
 
 		// FP64
 		if (s_openglVersion >= 400 || IsSupported("GL_ARB_gpu_shader_fp64"))
@@ -1113,7 +1320,7 @@ namespace Nz
 				glUniform3dv = reinterpret_cast<PFNGLUNIFORM3DVPROC>(LoadEntry("glUniform3dv"));
 				glUniform4dv = reinterpret_cast<PFNGLUNIFORM4DVPROC>(LoadEntry("glUniform4dv"));
 
-				s_openGLextensions[OpenGLExtension_FP64] = true;
+				s_openGLextensions[OpenGLExtension_FP64] = ExtensionState_Supported;
 			}
 			catch (const std::exception& e)
 			{
@@ -1121,20 +1328,23 @@ namespace Nz
 			}
 		}
 
-		// GetProgramBinary
-		if (s_openglVersion >= 410 || IsSupported("GL_ARB_get_program_binary"))
+		// ParallelShaderCompile
+		if (IsSupported("GL_KHR_parallel_shader_compile") || IsSupported("GL_ARB_parallel_shader_compile"))
 		{
 			try
 			{
-				glGetProgramBinary = reinterpret_cast<PFNGLGETPROGRAMBINARYPROC>(LoadEntry("glGetProgramBinary"));
-				glProgramBinary = reinterpret_cast<PFNGLPROGRAMBINARYPROC>(LoadEntry("glProgramBinary"));
-				glProgramParameteri = reinterpret_cast<PFNGLPROGRAMPARAMETERIPROC>(LoadEntry("glProgramParameteri"));
+				// Both extensions share their tokens, only the suffix of the function differs
+				const char* entry = (IsSupported("GL_KHR_parallel_shader_compile")) ? "glMaxShaderCompilerThreadsKHR" : "glMaxShaderCompilerThreadsARB";
+				glMaxShaderCompilerThreadsKHR = reinterpret_cast<PFNGLMAXSHADERCOMPILERTHREADSKHRPROC>(LoadEntry(entry));
+
+				// Lets the driver use as many compiler threads as it wants
+				glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
 
-				s_openGLextensions[OpenGLExtension_GetProgramBinary] = true;
+				s_openGLextensions[OpenGLExtension_ParallelShaderCompile] = ExtensionState_Supported;
 			}
 			catch (const std::exception& e)
 			{
-				NazaraWarning("Failed to load ARB_get_program_binary: (" + String(e.what()) + ")");
+				NazaraWarning("Failed to load KHR_parallel_shader_compile: (" + String(e.what()) + ")");
 			}
 		}
 
@@ -1156,7 +1366,7 @@ namespace Nz
 				glProgramUniformMatrix4fv = reinterpret_cast<PFNGLPROGRAMUNIFORMMATRIX4FVPROC>(LoadEntry("glProgramUniformMatrix4fv"));
 
 				// Si ARB_gpu_shader_fp64 est supporté, alors cette extension donne également accès aux fonctions utilisant des double
-				if (s_openGLextensions[OpenGLExtension_FP64])
+				if (s_openGLextensions[OpenGLExtension_FP64] == ExtensionState_Supported)
 				{
 					glProgramUniform1d = reinterpret_cast<PFNGLPROGRAMUNIFORM1DPROC>(LoadEntry("glProgramUniform1d"));
 					glProgramUniform1dv = reinterpret_cast<PFNGLPROGRAMUNIFORM2DVPROC>(LoadEntry("glProgramUniform1dv"));
@@ -1166,7 +1376,7 @@ namespace Nz
 					glProgramUniformMatrix4dv = reinterpret_cast<PFNGLPROGRAMUNIFORMMATRIX4DVPROC>(LoadEntry("glProgramUniformMatrix4dv"));
 				}
 
-				s_openGLextensions[OpenGLExtension_SeparateShaderObjects] = true;
+				s_openGLextensions[OpenGLExtension_SeparateShaderObjects] = ExtensionState_Supported;
 			}
 			catch (const std::exception& e)
 			{
@@ -1175,30 +1385,13 @@ namespace Nz
 		}
 
 		// Seamless Cubemap Filtering
-		s_openGLextensions[OpenGLExtension_SeamlessCubeMap] = (s_openglVersion >= 320 || IsSupported("GL_ARB_seamless_cube_map"));
+		s_openGLextensions[OpenGLExtension_SeamlessCubeMap] = (s_openglVersion >= 320 || IsSupported("GL_ARB_seamless_cube_map")) ? ExtensionState_Supported : ExtensionState_Unsupported;
 
 		// Shader_ImageLoadStore
-		s_openGLextensions[OpenGLExtension_Shader_ImageLoadStore] = (s_openglVersion >= 420 || IsSupported("GL_ARB_shader_image_load_store"));
+		s_openGLextensions[OpenGLExtension_Shader_ImageLoadStore] = (s_openglVersion >= 420 || IsSupported("GL_ARB_shader_image_load_store")) ? ExtensionState_Supported : ExtensionState_Unsupported;
 
 		// TextureCompression_s3tc
-		s_openGLextensions[OpenGLExtension_TextureCompression_s3tc] = IsSupported("GL_EXT_texture_compression_s3tc");
-
-		// TextureStorage
-		if (s_openglVersion >= 420 || IsSupported("GL_ARB_texture_storage"))
-		{
-			try
-			{
-				glTexStorage1D = reinterpret_cast<PFNGLTEXSTORAGE1DPROC>(LoadEntry("glTexStorage1D"));
-				glTexStorage2D = reinterpret_cast<PFNGLTEXSTORAGE2DPROC>(LoadEntry("glTexStorage2D"));
-				glTexStorage3D = reinterpret_cast<PFNGLTEXSTORAGE3DPROC>(LoadEntry("glTexStorage3D"));
-
-				s_openGLextensions[OpenGLExtension_TextureStorage] = true;
-			}
-			catch (const std::exception& e)
-			{
-				NazaraWarning("Failed to load ARB_texture_storage: " + String(e.what()));
-			}
-		}
+		s_openGLextensions[OpenGLExtension_TextureCompression_s3tc] = (IsSupported("GL_EXT_texture_compression_s3tc")) ? ExtensionState_Supported : ExtensionState_Unsupported;
 
 		/******************************Initialisation*****************************/
 
@@ -1226,7 +1419,20 @@ namespace Nz
 
 	bool OpenGL::IsSupported(OpenGLExtension extension)
 	{
-		return s_openGLextensions[extension];
+		UInt8 state = s_openGLextensions[extension].load(std::memory_order_acquire);
+		if (state == ExtensionState_Unloaded)
+		{
+			LockGuard lock(s_extensionMutex);
+
+			state = s_openGLextensions[extension].load(std::memory_order_relaxed);
+			if (state == ExtensionState_Unloaded)
+			{
+				state = (LoadExtensionEntries(extension)) ? ExtensionState_Supported : ExtensionState_Unsupported;
+				s_openGLextensions[extension].store(state, std::memory_order_release);
+			}
+		}
+
+		return state == ExtensionState_Supported;
 	}
 
 	bool OpenGL::IsSupported(const String& string)
@@ -1234,6 +1440,21 @@ namespace Nz
 		return s_openGLextensionSet.find(string) != s_openGLextensionSet.end();
 	}
 
+	void OpenGL::RecordDrawCall()
+	{
+		s_statistics.drawCalls++;
+	}
+
+	void OpenGL::RecordUpload(UInt64 size)
+	{
+		s_statistics.uploadedBytes += size;
+	}
+
+	void OpenGL::ResetStatistics()
+	{
+		s_statistics = RenderStatistics();
+	}
+
 	void OpenGL::SetBuffer(BufferType type, GLuint id)
 	{
 		#ifdef NAZARA_DEBUG
@@ -1292,6 +1513,7 @@ namespace Nz
 
 				unsigned int height = s_contextStates->currentTarget->GetSize().y;
 				glScissor(scissorBox.x, height - scissorBox.height - scissorBox.y, scissorBox.width, scissorBox.height);
+				s_statistics.renderStateChanges++;
 
 				s_contextStates->scissorBoxUpdated = true;
 			}
@@ -1302,6 +1524,7 @@ namespace Nz
 
 				unsigned int height = s_contextStates->currentTarget->GetSize().y;
 				glViewport(viewport.x, height - viewport.height - viewport.y, viewport.width, viewport.height);
+				s_statistics.renderStateChanges++;
 
 				s_contextStates->viewportUpdated = true;
 			}
@@ -1347,6 +1570,19 @@ namespace Nz
 		s_contextStates->textureUnit = textureUnit;
 	}
 
+	void OpenGL::SetVertexArray(GLuint id)
+	{
+		#ifdef NAZARA_DEBUG
+		if (!s_contextStates)
+		{
+			NazaraError("No context activated");
+			return;
+		}
+		#endif
+
+		s_contextStates->currentVertexArray = id;
+	}
+
 	void OpenGL::SetViewport(const Recti& viewport)
 	{
 		#ifdef NAZARA_DEBUG
@@ -1489,13 +1725,13 @@ namespace Nz
 				return true;
 
 			case PixelFormatType_R8I:
-				format->dataFormat = GL_RED;
+				format->dataFormat = GL_RED_INTEGER;
 				format->dataType = GL_BYTE;
 				format->internalFormat = GL_R8I;
 				return true;
 
 			case PixelFormatType_R8UI:
-				format->dataFormat = GL_RED;
+				format->dataFormat = GL_RED_INTEGER;
 				format->dataType = GL_UNSIGNED_BYTE;
 				format->internalFormat = GL_R8UI;
 				return true;
@@ -1513,13 +1749,13 @@ namespace Nz
 				return true;
 
 			case PixelFormatType_R16I:
-				format->dataFormat = GL_RED;
+				format->dataFormat = GL_RED_INTEGER;
 				format->dataType = GL_SHORT;
 				format->internalFormat = GL_R16I;
 				return true;
 
 			case PixelFormatType_R16UI:
-				format->dataFormat = GL_RED;
+				format->dataFormat = GL_RED_INTEGER;
 				format->dataType = GL_UNSIGNED_SHORT;
 				format->internalFormat = GL_R16UI;
 				return true;
@@ -1531,13 +1767,13 @@ namespace Nz
 				return true;
 
 			case PixelFormatType_R32I:
-				format->dataFormat = GL_RED;
+				format->dataFormat = GL_RED_INTEGER;
 				format->dataType = GL_INT;
 				format->internalFormat = GL_R32I;
 				return true;
 
 			case PixelFormatType_R32UI:
-				format->dataFormat = GL_RED;
+				format->dataFormat = GL_RED_INTEGER;
 				format->dataType = GL_UNSIGNED_INT;
 				format->internalFormat = GL_R32UI;
 				return true;
@@ -1549,13 +1785,13 @@ namespace Nz
 				return true;
 
 			case PixelFormatType_RG8I:
-				format->dataFormat = GL_RG;
+				format->dataFormat = GL_RG_INTEGER;
 				format->dataType = GL_BYTE;
 				format->internalFormat = GL_RG8I;
 				return true;
 
 			case PixelFormatType_RG8UI:
-				format->dataFormat = GL_RG;
+				format->dataFormat = GL_RG_INTEGER;
 				format->dataType = GL_UNSIGNED_BYTE;
 				format->internalFormat = GL_RG8UI;
 				return true;
@@ -1573,13 +1809,13 @@ namespace Nz
 				return true;
 
 			case PixelFormatType_RG16I:
-				format->dataFormat = GL_RG;
+				format->dataFormat = GL_RG_INTEGER;
 				format->dataType = GL_SHORT;
 				format->internalFormat = GL_RG16I;
 				return true;
 
 			case PixelFormatType_RG16UI:
-				format->dataFormat = GL_RG;
+				format->dataFormat = GL_RG_INTEGER;
 				format->dataType = GL_UNSIGNED_SHORT;
 				format->internalFormat = GL_RG16UI;
 				return true;
@@ -1591,13 +1827,13 @@ namespace Nz
 				return true;
 
 			case PixelFormatType_RG32I:
-				format->dataFormat = GL_RG;
+				format->dataFormat = GL_RG_INTEGER;
 				format->dataType = GL_INT;
 				format->internalFormat = GL_RG32I;
 				return true;
 
 			case PixelFormatType_RG32UI:
-				format->dataFormat = GL_RG;
+				format->dataFormat = GL_RG_INTEGER;
 				format->dataType = GL_UNSIGNED_INT;
 				format->internalFormat = GL_RG32UI;
 				return true;
@@ -1621,13 +1857,13 @@ namespace Nz
 				return true;
 
 			case PixelFormatType_RGB16I:
-				format->dataFormat = GL_RGB;
+				format->dataFormat = GL_RGB_INTEGER;
 				format->dataType = GL_SHORT;
 				format->internalFormat = GL_RGB16I;
 				return true;
 
 			case PixelFormatType_RGB16UI:
-				format->dataFormat = GL_RGB;
+				format->dataFormat = GL_RGB_INTEGER;
 				format->dataType = GL_UNSIGNED_SHORT;
 				format->internalFormat = GL_RGB16UI;
 				return true;
@@ -1639,13 +1875,13 @@ namespace Nz
 				return true;
 
 			case PixelFormatType_RGB32I:
-				format->dataFormat = GL_RGB;
+				format->dataFormat = GL_RGB_INTEGER;
 				format->dataType = GL_INT;
 				format->internalFormat = GL_RGB32I;
 				return true;
 
 			case PixelFormatType_RGB32UI:
-				format->dataFormat = GL_RGB;
+				format->dataFormat = GL_RGB_INTEGER;
 				format->dataType = GL_UNSIGNED_INT;
 				format->internalFormat = GL_RGB32UI;
 				return true;
@@ -1669,14 +1905,14 @@ namespace Nz
 				return true;
 
 			case PixelFormatType_RGBA16I:
-				format->dataFormat = GL_RGBA;
+				format->dataFormat = GL_RGBA_INTEGER;
 				format->dataType = GL_SHORT;
 				format->internalFormat = GL_RGBA16I;
 				return true;
 
 			case PixelFormatType_RGBA16UI:
-				format->dataFormat = GL_RGBA;
-				format->dataType = GL_INT;
+				format->dataFormat = GL_RGBA_INTEGER;
+				format->dataType = GL_UNSIGNED_SHORT;
 				format->internalFormat = GL_RGBA16UI;
 				return true;
 
@@ -1687,15 +1923,15 @@ namespace Nz
 				return true;
 
 			case PixelFormatType_RGBA32I:
-				format->dataFormat = GL_RGB;
+				format->dataFormat = GL_RGBA_INTEGER;
 				format->dataType = GL_INT;
-				format->internalFormat = GL_RGB32I;
+				format->internalFormat = GL_RGBA32I;
 				return true;
 
 			case PixelFormatType_RGBA32UI:
-				format->dataFormat = GL_RGB;
+				format->dataFormat = GL_RGBA_INTEGER;
 				format->dataType = GL_UNSIGNED_INT;
-				format->internalFormat = GL_RGB32UI;
+				format->internalFormat = GL_RGBA32UI;
 				return true;
 
 			case PixelFormatType_Depth16:
@@ -1802,8 +2038,8 @@ namespace Nz
 
 			Context::Uninitialize();
 
-			for (bool& ext : s_openGLextensions)
-				ext = false;
+			for (std::atomic<UInt8>& ext : s_openGLextensions)
+				ext = ExtensionState_Unsupported;
 
 			s_glslVersion = 0;
 			s_openGLextensionSet.clear();
@@ -1831,6 +2067,9 @@ namespace Nz
 
 					case GarbageResourceType_VertexArray:
 						glDeleteVertexArrays(1, &pair.second);
+
+						if (s_contextStates->currentVertexArray == pair.second)
+							s_contextStates->currentVertexArray = 0;
 						break;
 				}
 			}
@@ -1898,17 +2137,23 @@ namespace Nz
 	{
 		GL_ELEMENT_ARRAY_BUFFER, // BufferType_Index,
 		GL_ARRAY_BUFFER,		 // BufferType_Vertex
+		GL_UNIFORM_BUFFER,		 // BufferType_Uniform
+		GL_DRAW_INDIRECT_BUFFER, // BufferType_DrawIndirect
+		GL_PIXEL_UNPACK_BUFFER	 // BufferType_PixelUnpack
 	};
 
-	static_assert(BufferType_Max + 1 == 2, "Buffer target array is incomplete");
+	static_assert(BufferType_Max + 1 == 5, "Buffer target array is incomplete");
 
 	GLenum OpenGL::BufferTargetBinding[] =
 	{
 		GL_ELEMENT_ARRAY_BUFFER_BINDING, // BufferType_Index,
 		GL_ARRAY_BUFFER_BINDING,		 // BufferType_Vertex
+		GL_UNIFORM_BUFFER_BINDING,		 // BufferType_Uniform
+		GL_DRAW_INDIRECT_BUFFER_BINDING, // BufferType_DrawIndirect
+		GL_PIXEL_UNPACK_BUFFER_BINDING	 // BufferType_PixelUnpack
 	};
 
-	static_assert(BufferType_Max + 1 == 2, "Buffer target binding array is incomplete");
+	static_assert(BufferType_Max + 1 == 5, "Buffer target binding array is incomplete");
 
 	GLenum OpenGL::ComponentType[] =
 	{
@@ -1925,10 +2170,14 @@ namespace Nz
 		GL_INT,           // ComponentType_Int2
 		GL_INT,           // ComponentType_Int3
 		GL_INT,           // ComponentType_Int4
-		GL_FLOAT          // ComponentType_Quaternion
+		GL_FLOAT,                // ComponentType_Quaternion
+		GL_HALF_FLOAT,           // ComponentType_Half2
+		GL_HALF_FLOAT,           // ComponentType_Half4
+		GL_INT_2_10_10_10_REV,   // ComponentType_PackedNormal
+		GL_UNSIGNED_SHORT        // ComponentType_UShortNorm2
 	};
 
-	static_assert(ComponentType_Max + 1 == 14, "Attribute type array is incomplete");
+	static_assert(ComponentType_Max + 1 == 18, "Attribute type array is incomplete");
 
 	GLenum OpenGL::CubemapFace[] =
 	{
@@ -2115,8 +2364,11 @@ PFNGLACTIVETEXTUREPROC            glActiveTexture            = nullptr;
 PFNGLATTACHSHADERPROC             glAttachShader             = nullptr;
 PFNGLBEGINCONDITIONALRENDERPROC   glBeginConditionalRender   = nullptr;
 PFNGLBEGINQUERYPROC               glBeginQuery               = nullptr;
+PFNGLBEGINTRANSFORMFEEDBACKPROC   glBeginTransformFeedback   = nullptr;
 PFNGLBINDATTRIBLOCATIONPROC       glBindAttribLocation       = nullptr;
 PFNGLBINDBUFFERPROC               glBindBuffer               = nullptr;
+PFNGLBINDBUFFERBASEPROC           glBindBufferBase           = nullptr;
+PFNGLBINDBUFFERRANGEPROC          glBindBufferRange          = nullptr;
 PFNGLBINDFRAMEBUFFERPROC          glBindFramebuffer          = nullptr;
 PFNGLBINDFRAGDATALOCATIONPROC     glBindFragDataLocation     = nullptr;
 PFNGLBINDRENDERBUFFERPROC         glBindRenderbuffer         = nullptr;
@@ -2127,11 +2379,13 @@ PFNGLBLENDFUNCPROC                glBlendFunc                = nullptr;
 PFNGLBLENDFUNCSEPARATEPROC        glBlendFuncSeparate        = nullptr;
 PFNGLBLITFRAMEBUFFERPROC          glBlitFramebuffer          = nullptr;
 PFNGLBUFFERDATAPROC               glBufferData               = nullptr;
+PFNGLBUFFERSTORAGEPROC            glBufferStorage            = nullptr;
 PFNGLBUFFERSUBDATAPROC            glBufferSubData            = nullptr;
 PFNGLCLEARPROC                    glClear                    = nullptr;
 PFNGLCLEARCOLORPROC               glClearColor               = nullptr;
 PFNGLCLEARDEPTHPROC               glClearDepth               = nullptr;
 PFNGLCLEARSTENCILPROC             glClearStencil             = nullptr;
+PFNGLCLIENTWAITSYNCPROC           glClientWaitSync           = nullptr;
 PFNGLCREATEPROGRAMPROC            glCreateProgram            = nullptr;
 PFNGLCREATESHADERPROC             glCreateShader             = nullptr;
 PFNGLCHECKFRAMEBUFFERSTATUSPROC   glCheckFramebufferStatus   = nullptr;
@@ -2141,6 +2395,7 @@ PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC  glCompressedTexSubImage2D  = nullptr;
 PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC  glCompressedTexSubImage3D  = nullptr;
 PFNGLCULLFACEPROC                 glCullFace                 = nullptr;
 PFNGLCOMPILESHADERPROC            glCompileShader            = nullptr;
+PFNGLCOPYIMAGESUBDATAPROC         glCopyImageSubData         = nullptr;
 PFNGLCOPYTEXSUBIMAGE2DPROC        glCopyTexSubImage2D        = nullptr;
 PFNGLDEBUGMESSAGECALLBACKPROC     glDebugMessageCallback     = nullptr;
 PFNGLDEBUGMESSAGECONTROLPROC      glDebugMessageControl      = nullptr;
@@ -2151,6 +2406,7 @@ PFNGLDELETEPROGRAMPROC            glDeleteProgram            = nullptr;
 PFNGLDELETEQUERIESPROC            glDeleteQueries            = nullptr;
 PFNGLDELETERENDERBUFFERSPROC      glDeleteRenderbuffers      = nullptr;
 PFNGLDELETESAMPLERSPROC           glDeleteSamplers           = nullptr;
+PFNGLDELETESYNCPROC               glDeleteSync               = nullptr;
 PFNGLDELETESHADERPROC             glDeleteShader             = nullptr;
 PFNGLDELETETEXTURESPROC           glDeleteTextures           = nullptr;
 PFNGLDELETEVERTEXARRAYSPROC       glDeleteVertexArrays       = nullptr;
@@ -2163,12 +2419,16 @@ PFNGLDRAWARRAYSINSTANCEDPROC      glDrawArraysInstanced      = nullptr;
 PFNGLDRAWBUFFERPROC               glDrawBuffer               = nullptr;
 PFNGLDRAWBUFFERSPROC              glDrawBuffers              = nullptr;
 PFNGLDRAWELEMENTSPROC             glDrawElements             = nullptr;
+PFNGLDRAWELEMENTSBASEVERTEXPROC   glDrawElementsBaseVertex   = nullptr;
 PFNGLDRAWELEMENTSINSTANCEDPROC    glDrawElementsInstanced    = nullptr;
+PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glDrawElementsInstancedBaseVertex = nullptr;
 PFNGLDRAWTEXTURENVPROC            glDrawTexture              = nullptr;
 PFNGLENABLEPROC                   glEnable                   = nullptr;
 PFNGLENABLEVERTEXATTRIBARRAYPROC  glEnableVertexAttribArray  = nullptr;
 PFNGLENDCONDITIONALRENDERPROC     glEndConditionalRender     = nullptr;
 PFNGLENDQUERYPROC                 glEndQuery                 = nullptr;
+PFNGLENDTRANSFORMFEEDBACKPROC     glEndTransformFeedback     = nullptr;
+PFNGLFENCESYNCPROC                glFenceSync                = nullptr;
 PFNGLFLUSHPROC                    glFlush                    = nullptr;
 PFNGLFRAMEBUFFERRENDERBUFFERPROC  glFramebufferRenderbuffer  = nullptr;
 PFNGLFRAMEBUFFERTEXTUREPROC       glFramebufferTexture       = nullptr;
@@ -2196,6 +2456,7 @@ PFNGLGETPROGRAMIVPROC             glGetProgramiv             = nullptr;
 PFNGLGETPROGRAMINFOLOGPROC        glGetProgramInfoLog        = nullptr;
 PFNGLGETQUERYIVPROC               glGetQueryiv               = nullptr;
 PFNGLGETQUERYOBJECTIVPROC         glGetQueryObjectiv         = nullptr;
+PFNGLGETQUERYOBJECTUI64VPROC      glGetQueryObjectui64v      = nullptr;
 PFNGLGETQUERYOBJECTUIVPROC        glGetQueryObjectuiv        = nullptr;
 PFNGLGETSHADERINFOLOGPROC         glGetShaderInfoLog         = nullptr;
 PFNGLGETSHADERIVPROC              glGetShaderiv              = nullptr;
@@ -2207,6 +2468,8 @@ PFNGLGETTEXLEVELPARAMETERFVPROC   glGetTexLevelParameterfv   = nullptr;
 PFNGLGETTEXLEVELPARAMETERIVPROC   glGetTexLevelParameteriv   = nullptr;
 PFNGLGETTEXPARAMETERFVPROC        glGetTexParameterfv        = nullptr;
 PFNGLGETTEXPARAMETERIVPROC        glGetTexParameteriv        = nullptr;
+PFNGLGETTEXTURESAMPLERHANDLEARBPROC glGetTextureSamplerHandleARB = nullptr;
+PFNGLGETUNIFORMBLOCKINDEXPROC     glGetUniformBlockIndex     = nullptr;
 PFNGLGETUNIFORMFVPROC             glGetUniformfv             = nullptr;
 PFNGLGETUNIFORMIVPROC             glGetUniformiv             = nullptr;
 PFNGLGETUNIFORMLOCATIONPROC       glGetUniformLocation       = nullptr;
@@ -2214,8 +2477,12 @@ PFNGLINVALIDATEBUFFERDATAPROC     glInvalidateBufferData     = nullptr;
 PFNGLISENABLEDPROC                glIsEnabled                = nullptr;
 PFNGLLINEWIDTHPROC                glLineWidth                = nullptr;
 PFNGLLINKPROGRAMPROC              glLinkProgram              = nullptr;
+PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC glMakeTextureHandleNonResidentARB = nullptr;
+PFNGLMAKETEXTUREHANDLERESIDENTARBPROC glMakeTextureHandleResidentARB = nullptr;
 PFNGLMAPBUFFERPROC                glMapBuffer                = nullptr;
 PFNGLMAPBUFFERRANGEPROC           glMapBufferRange           = nullptr;
+PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glMaxShaderCompilerThreadsKHR = nullptr;
+PFNGLMULTIDRAWELEMENTSINDIRECTPROC glMultiDrawElementsIndirect = nullptr;
 PFNGLPIXELSTOREIPROC              glPixelStorei              = nullptr;
 PFNGLPOINTSIZEPROC                glPointSize                = nullptr;
 PFNGLPOLYGONMODEPROC              glPolygonMode              = nullptr;
@@ -2238,6 +2505,7 @@ PFNGLPROGRAMUNIFORM4FVPROC        glProgramUniform4fv        = nullptr;
 PFNGLPROGRAMUNIFORM4IVPROC        glProgramUniform4iv        = nullptr;
 PFNGLPROGRAMUNIFORMMATRIX4DVPROC  glProgramUniformMatrix4dv  = nullptr;
 PFNGLPROGRAMUNIFORMMATRIX4FVPROC  glProgramUniformMatrix4fv  = nullptr;
+PFNGLQUERYCOUNTERPROC             glQueryCounter             = nullptr;
 PFNGLREADPIXELSPROC               glReadPixels               = nullptr;
 PFNGLRENDERBUFFERSTORAGEPROC      glRenderbufferStorage      = nullptr;
 PFNGLSAMPLERPARAMETERFPROC        glSamplerParameterf        = nullptr;
@@ -2259,6 +2527,7 @@ PFNGLTEXSTORAGE3DPROC             glTexStorage3D             = nullptr;
 PFNGLTEXSUBIMAGE1DPROC            glTexSubImage1D            = nullptr;
 PFNGLTEXSUBIMAGE2DPROC            glTexSubImage2D            = nullptr;
 PFNGLTEXSUBIMAGE3DPROC            glTexSubImage3D            = nullptr;
+PFNGLTRANSFORMFEEDBACKVARYINGSPROC glTransformFeedbackVaryings = nullptr;
 PFNGLUNIFORM1DPROC                glUniform1d                = nullptr;
 PFNGLUNIFORM1FPROC                glUniform1f                = nullptr;
 PFNGLUNIFORM1IPROC                glUniform1i                = nullptr;
@@ -2275,6 +2544,7 @@ PFNGLUNIFORM4DVPROC               glUniform4dv               = nullptr;
 PFNGLUNIFORM4FVPROC               glUniform4fv               = nullptr;
 PFNGLUNIFORM4IVPROC               glUniform4iv               = nullptr;
 PFNGLUNIFORMMATRIX4DVPROC         glUniformMatrix4dv         = nullptr;
+PFNGLUNIFORMBLOCKBINDINGPROC      glUniformBlockBinding      = nullptr;
 PFNGLUNIFORMMATRIX4FVPROC         glUniformMatrix4fv         = nullptr;
 PFNGLUNMAPBUFFERPROC              glUnmapBuffer              = nullptr;
 PFNGLUSEPROGRAMPROC               glUseProgram               = nullptr;
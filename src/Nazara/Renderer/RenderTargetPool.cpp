@@ -0,0 +1,248 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Renderer module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Renderer/RenderTargetPool.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Utility/PixelFormat.hpp>
+#include <algorithm>
+#include <Nazara/Renderer/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup renderer
+	* \class Nz::RenderTargetPool
+	* \brief Renderer class that lends textures and render buffers to the passes rendering a frame
+	*
+	* Resources are matched by format and size: a pass acquires what it needs, renders with it and releases it, so the next pass asking for the same format and size gets the same storage.
+	* Every resource still acquired is released at the end of the frame, and a resource which was not acquired during the last frames is destroyed.
+	* Hence video memory follows the peak of resources needed at the same time, instead of the sum of what every pass would keep for itself.
+	*
+	* \remark The content of a resource is undefined once it has been released
+	*/
+
+	/*!
+	* \brief Constructs a RenderTargetPool object
+	*
+	* \param maxUnusedFrames Number of frames a resource is kept without being acquired before being destroyed
+	*/
+	RenderTargetPool::RenderTargetPool(unsigned int maxUnusedFrames) :
+	m_currentFrame(0),
+	m_maxUnusedFrames(maxUnusedFrames)
+	{
+	}
+
+	/*!
+	* \brief Acquires a render buffer until it is released or the frame ends
+	* \return Render buffer of the requested format and size, or nullptr if it could not be created
+	*
+	* \param format Pixel format of the buffer
+	* \param width Width of the buffer
+	* \param height Height of the buffer
+	*
+	* \remark Produces a NazaraError if the render buffer could not be created
+	*/
+	RenderBufferRef RenderTargetPool::AcquireBuffer(PixelFormatType format, unsigned int width, unsigned int height)
+	{
+		NazaraAssert(width > 0 && height > 0, "Invalid size");
+
+		Entry<RenderBuffer>* entry = FindFreeEntry(m_buffers, format, width, height);
+		if (!entry)
+		{
+			RenderBufferRef buffer = RenderBuffer::New();
+			if (!buffer->Create(format, width, height))
+			{
+				NazaraError("Failed to create render buffer");
+				return nullptr;
+			}
+
+			m_buffers.emplace_back();
+			entry = &m_buffers.back();
+			entry->format = format;
+			entry->height = height;
+			entry->resource = std::move(buffer);
+			entry->width = width;
+		}
+
+		entry->acquired = true;
+		entry->lastUsedFrame = m_currentFrame;
+
+		return entry->resource;
+	}
+
+	/*!
+	* \brief Acquires a 2D texture until it is released or the frame ends
+	* \return Texture of the requested format and size, or nullptr if it could not be created
+	*
+	* \param format Pixel format of the texture
+	* \param width Width of the texture
+	* \param height Height of the texture
+	*
+	* \remark Produces a NazaraError if the texture could not be created
+	*/
+	TextureRef RenderTargetPool::AcquireTexture(PixelFormatType format, unsigned int width, unsigned int height)
+	{
+		NazaraAssert(width > 0 && height > 0, "Invalid size");
+
+		Entry<Texture>* entry = FindFreeEntry(m_textures, format, width, height);
+		if (!entry)
+		{
+			TextureRef texture = Texture::New();
+			if (!texture->Create(ImageType_2D, format, width, height))
+			{
+				NazaraError("Failed to create texture");
+				return nullptr;
+			}
+
+			m_textures.emplace_back();
+			entry = &m_textures.back();
+			entry->format = format;
+			entry->height = height;
+			entry->resource = std::move(texture);
+			entry->width = width;
+		}
+
+		entry->acquired = true;
+		entry->lastUsedFrame = m_currentFrame;
+
+		return entry->resource;
+	}
+
+	/*!
+	* \brief Destroys every resource of the pool
+	*
+	* \remark Acquired resources stay alive as long as they are referenced elsewhere
+	*/
+	void RenderTargetPool::Clear()
+	{
+		m_buffers.clear();
+		m_textures.clear();
+	}
+
+	/*!
+	* \brief Ends the current frame
+	*
+	* Every acquired resource is released, and resources which were not acquired for more than the maximum number of unused frames are destroyed
+	*/
+	void RenderTargetPool::EndFrame()
+	{
+		TrimEntries(m_buffers);
+		TrimEntries(m_textures);
+
+		m_currentFrame++;
+	}
+
+	/*!
+	* \brief Gets the number of resources currently acquired
+	* \return Number of acquired textures and render buffers
+	*/
+	std::size_t RenderTargetPool::GetAcquiredCount() const
+	{
+		auto IsAcquired = [] (const auto& entry) { return entry.acquired; };
+
+		return std::count_if(m_buffers.begin(), m_buffers.end(), IsAcquired) + std::count_if(m_textures.begin(), m_textures.end(), IsAcquired);
+	}
+
+	/*!
+	* \brief Gets the video memory used by the resources of the pool
+	* \return Estimated size of every resource, in bytes
+	*/
+	UInt64 RenderTargetPool::GetMemoryUsage() const
+	{
+		UInt64 memoryUsage = 0;
+		for (const Entry<RenderBuffer>& entry : m_buffers)
+			memoryUsage += UInt64(entry.width) * entry.height * PixelFormat::GetBytesPerPixel(entry.format);
+
+		for (const Entry<Texture>& entry : m_textures)
+			memoryUsage += UInt64(entry.width) * entry.height * PixelFormat::GetBytesPerPixel(entry.format);
+
+		return memoryUsage;
+	}
+
+	/*!
+	* \brief Gets the number of frames a resource is kept without being acquired
+	* \return Maximum number of unused frames
+	*/
+	unsigned int RenderTargetPool::GetMaxUnusedFrames() const
+	{
+		return m_maxUnusedFrames;
+	}
+
+	/*!
+	* \brief Gets the number of resources of the pool
+	* \return Number of textures and render buffers, acquired or not
+	*/
+	std::size_t RenderTargetPool::GetResourceCount() const
+	{
+		return m_buffers.size() + m_textures.size();
+	}
+
+	/*!
+	* \brief Releases a render buffer before the end of the frame, allowing another pass to acquire it
+	*
+	* \param buffer Render buffer acquired from this pool
+	*/
+	void RenderTargetPool::Release(const RenderBuffer* buffer)
+	{
+		ReleaseEntry(m_buffers, buffer);
+	}
+
+	/*!
+	* \brief Releases a texture before the end of the frame, allowing another pass to acquire it
+	*
+	* \param texture Texture acquired from this pool
+	*/
+	void RenderTargetPool::Release(const Texture* texture)
+	{
+		ReleaseEntry(m_textures, texture);
+	}
+
+	/*!
+	* \brief Sets the number of frames a resource is kept without being acquired
+	*
+	* \param maxUnusedFrames Maximum number of unused frames, zero destroys every resource not acquired during the frame
+	*/
+	void RenderTargetPool::SetMaxUnusedFrames(unsigned int maxUnusedFrames)
+	{
+		m_maxUnusedFrames = maxUnusedFrames;
+	}
+
+	template<typename T>
+	auto RenderTargetPool::FindFreeEntry(std::vector<Entry<T>>& entries, PixelFormatType format, unsigned int width, unsigned int height) -> Entry<T>*
+	{
+		for (Entry<T>& entry : entries)
+		{
+			if (!entry.acquired && entry.format == format && entry.width == width && entry.height == height)
+				return &entry;
+		}
+
+		return nullptr;
+	}
+
+	template<typename T>
+	void RenderTargetPool::ReleaseEntry(std::vector<Entry<T>>& entries, const T* resource)
+	{
+		auto it = std::find_if(entries.begin(), entries.end(), [resource] (const Entry<T>& entry) { return entry.resource == resource; });
+		NazaraAssert(it != entries.end(), "Resource was not acquired from this pool");
+		NazaraAssert(it->acquired, "Resource is already released");
+
+		it->acquired = false;
+	}
+
+	template<typename T>
+	void RenderTargetPool::TrimEntries(std::vector<Entry<T>>& entries)
+	{
+		UInt64 currentFrame = m_currentFrame;
+		unsigned int maxUnusedFrames = m_maxUnusedFrames;
+
+		auto it = std::remove_if(entries.begin(), entries.end(), [=] (const Entry<T>& entry)
+		{
+			return !entry.acquired && currentFrame - entry.lastUsedFrame > maxUnusedFrames;
+		});
+		entries.erase(it, entries.end());
+
+		for (Entry<T>& entry : entries)
+			entry.acquired = false;
+	}
+}
@@ -691,6 +691,51 @@ namespace Nz
 		glBindFramebuffer(GL_READ_FRAMEBUFFER, previousReadBuffer);
 	}
 
+	void RenderTexture::BlitFromActiveTarget(Rectui srcRect, RenderTexture* dst, Rectui dstRect, UInt32 buffers, bool bilinearFilter)
+	{
+		NazaraAssert(dst && dst->IsValid(), "Invalid destination render texture");
+
+		#if NAZARA_RENDERER_SAFE
+		Vector2ui dstSize = dst->GetSize();
+		if (dstRect.x+dstRect.width > dstSize.x || dstRect.y+dstRect.height > dstSize.y)
+		{
+			NazaraError("Destination rectangle dimensions are out of bounds");
+			return;
+		}
+
+		if (bilinearFilter && (buffers & RendererBuffer_Depth || buffers & RendererBuffer_Stencil))
+		{
+			NazaraError("Filter cannot be bilinear when blitting depth/stencil buffers");
+			return;
+		}
+		#endif
+
+		GLbitfield mask = 0;
+		if (buffers & RendererBuffer_Color)
+			mask |= GL_COLOR_BUFFER_BIT;
+
+		if (buffers & RendererBuffer_Depth)
+			mask |= GL_DEPTH_BUFFER_BIT;
+
+		if (buffers & RendererBuffer_Stencil)
+			mask |= GL_STENCIL_BUFFER_BIT;
+
+		// The active target may be a window, whose framebuffer has no RenderTexture (depth/stencil formats have to match the destination ones)
+		GLint previousDrawBuffer, previousReadBuffer;
+		glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &previousDrawBuffer);
+		glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &previousReadBuffer);
+
+		glBindFramebuffer(GL_DRAW_FRAMEBUFFER, dst->GetOpenGLID());
+		glBindFramebuffer(GL_READ_FRAMEBUFFER, previousDrawBuffer);
+
+		glBlitFramebuffer(srcRect.x, srcRect.y, srcRect.x + srcRect.width, srcRect.y + srcRect.height,
+						  dstRect.x, dstRect.y, dstRect.x + dstRect.width, dstRect.y + dstRect.height,
+						  mask, (bilinearFilter) ? GL_LINEAR : GL_NEAREST);
+
+		glBindFramebuffer(GL_DRAW_FRAMEBUFFER, previousDrawBuffer);
+		glBindFramebuffer(GL_READ_FRAMEBUFFER, previousReadBuffer);
+	}
+
 	bool RenderTexture::Activate() const
 	{
 		NazaraAssert(m_impl, "Invalid render texture");
@@ -0,0 +1,145 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Renderer module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Renderer/RenderThread.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Renderer/Context.hpp>
+#include <algorithm>
+#include <Nazara/Renderer/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup renderer
+	* \class Nz::RenderThread
+	* \brief Renderer class that runs the rendering of frames on a dedicated thread
+	*
+	* Frames are submitted as functions, run one after another by the thread in submission order, with an OpenGL context of its own (sharing its objects with the other contexts).
+	* This lets the submitting thread prepare the next frame while the previous one is rendered, up to a pipeline depth:
+	* Submit blocks while that many frames are still waiting or being rendered, which bounds the latency and the memory of the frames in flight.
+	*
+	* \remark Everything a frame function reads must stay unchanged until the frame is rendered (see Synchronize), as it is run concurrently with the submitting thread
+	* \remark Render targets drawn by the frames (windows included) must only be activated by this thread
+	*/
+
+	/*!
+	* \brief Constructs a RenderThread object and starts its thread
+	*
+	* \param pipelineDepth Maximum count of submitted frames waiting or being rendered, one lets the submitting thread work one frame ahead
+	*/
+
+	RenderThread::RenderThread(unsigned int pipelineDepth) :
+	m_pendingFrameCount(0),
+	m_pipelineDepth(std::max(pipelineDepth, 1U)),
+	m_running(true)
+	{
+		m_thread = Thread(&RenderThread::ThreadMain, this);
+		m_thread.SetName("RenderThread");
+	}
+
+	/*!
+	* \brief Destructs the object, after rendering every submitted frame
+	*/
+
+	RenderThread::~RenderThread()
+	{
+		{
+			LockGuard lock(m_mutex);
+			m_running = false;
+		}
+
+		m_frameQueued.Signal();
+		m_thread.Join();
+	}
+
+	/*!
+	* \brief Gets the count of submitted frames not rendered yet
+	* \return Frames waiting or being rendered
+	*/
+
+	unsigned int RenderThread::GetPendingFrameCount() const
+	{
+		LockGuard lock(m_mutex);
+		return m_pendingFrameCount;
+	}
+
+	/*!
+	* \brief Gets the maximum count of frames waiting or being rendered
+	* \return Pipeline depth
+	*/
+
+	unsigned int RenderThread::GetPipelineDepth() const
+	{
+		return m_pipelineDepth;
+	}
+
+	/*!
+	* \brief Submits a frame to render
+	*
+	* \param frame Function rendering the frame, called from the render thread
+	*
+	* \remark Blocks while the pipeline is full, until the oldest pending frame is rendered
+	*/
+
+	void RenderThread::Submit(FrameFunction frame)
+	{
+		NazaraAssert(frame, "Invalid frame function");
+
+		LockGuard lock(m_mutex);
+		while (m_pendingFrameCount >= m_pipelineDepth)
+			m_frameDone.Wait(&m_mutex);
+
+		m_frames.emplace_back(std::move(frame));
+		m_pendingFrameCount++;
+
+		m_frameQueued.Signal();
+	}
+
+	/*!
+	* \brief Waits until every submitted frame is rendered
+	*
+	* This has to be done before changing or releasing anything read by pending frames
+	*/
+
+	void RenderThread::Synchronize()
+	{
+		LockGuard lock(m_mutex);
+		while (m_pendingFrameCount > 0)
+			m_frameDone.Wait(&m_mutex);
+	}
+
+	void RenderThread::ThreadMain()
+	{
+		// Objects are shared between contexts, the context of this thread can use everything created by the others
+		if (!Context::EnsureContext())
+			NazaraError("Failed to create render thread context");
+
+		for (;;)
+		{
+			FrameFunction frame;
+			{
+				LockGuard lock(m_mutex);
+				while (m_frames.empty() && m_running)
+					m_frameQueued.Wait(&m_mutex);
+
+				// Pending frames are rendered before stopping
+				if (m_frames.empty())
+					break;
+
+				frame = std::move(m_frames.front());
+				m_frames.pop_front();
+			}
+
+			frame();
+
+			{
+				LockGuard lock(m_mutex);
+				m_pendingFrameCount--;
+			}
+
+			m_frameDone.SignalAll();
+		}
+	}
+}
@@ -3,16 +3,58 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Renderer/RenderWindow.hpp>
+#include <Nazara/Core/CallOnExit.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/ErrorFlags.hpp>
-#include <Nazara/Core/Thread.hpp>
 #include <Nazara/Renderer/Context.hpp>
+#include <Nazara/Renderer/DebugDrawer.hpp>
 #include <Nazara/Renderer/OpenGL.hpp>
 #include <Nazara/Renderer/Renderer.hpp>
+#include <Nazara/Utility/AbstractImage.hpp>
+#include <limits>
 #include <Nazara/Renderer/Debug.hpp>
 
 namespace Nz
 {
+	namespace
+	{
+		bool ActivateContext(const Context* context, const Context** previousContext)
+		{
+			*previousContext = Context::GetCurrent();
+			if (context != *previousContext)
+			{
+				if (!context->SetActive(true))
+				{
+					NazaraError("Failed to activate context");
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		void RestoreContext(const Context* context, const Context* previousContext)
+		{
+			if (context != previousContext)
+			{
+				if (previousContext)
+				{
+					if (!previousContext->SetActive(true))
+						NazaraWarning("Failed to reset old context");
+				}
+				else
+					context->SetActive(false);
+			}
+		}
+
+		void UpdateFlipped(AbstractImage* image, const UInt8* pixels, unsigned int width, unsigned int height, const Vector3ui& dstPos)
+		{
+			// Les pixels sont retournés, nous devons envoyer les pixels par rangée
+			for (unsigned int i = 0; i < height; ++i)
+				image->Update(&pixels[width*4*i], Boxui(dstPos.x, dstPos.y + height - i - 1, dstPos.z, width, 1, 1), width);
+		}
+	}
+
 	RenderWindow::RenderWindow(VideoMode mode, const String& title, WindowStyleFlags style, const ContextParameters& parameters) :
 	RenderTarget(), Window()
 	{
@@ -86,35 +128,18 @@ namespace Nz
 		}
 		#endif
 
-		const Context* currentContext = Context::GetCurrent();
-		if (m_context != currentContext)
-		{
-			if (!m_context->SetActive(true))
-			{
-				NazaraError("Failed to activate context");
-				return false;
-			}
-		}
+		const Context* previousContext;
+		if (!ActivateContext(m_context, &previousContext))
+			return false;
 
 		///TODO: Fast-path pour les images en cas de copie du buffer entier
 
 		m_buffer.resize(rect.width*rect.height*4);
 		glReadPixels(rect.x, windowSize.y - rect.height - rect.y, rect.width, rect.height, GL_RGBA, GL_UNSIGNED_BYTE, m_buffer.data());
 
-		// Les pixels sont retournés, nous devons envoyer les pixels par rangée
-		for (unsigned int i = 0; i < rect.height; ++i)
-			image->Update(&m_buffer[rect.width*4*i], Boxui(dstPos.x, rect.height - i - 1, dstPos.z, rect.width, 1, 1), rect.width);
+		UpdateFlipped(image, m_buffer.data(), rect.width, rect.height, dstPos);
 
-		if (m_context != currentContext)
-		{
-			if (currentContext)
-			{
-				if (!currentContext->SetActive(true))
-					NazaraWarning("Failed to reset old context");
-			}
-			else
-				m_context->SetActive(false);
-		}
+		RestoreContext(m_context, previousContext);
 
 		return true;
 	}
@@ -133,20 +158,22 @@ namespace Nz
 
 	void RenderWindow::Display()
 	{
-		if (m_framerateLimit > 0)
-		{
-			int remainingTime = 1000/static_cast<int>(m_framerateLimit) - static_cast<int>(m_clock.GetMilliseconds());
-			if (remainingTime > 0)
-				Thread::Sleep(remainingTime);
+		if (Renderer::GetTarget() == this)
+			DebugDrawer::Flush();
 
-			m_clock.Restart();
-		}
+		m_framePacer.Wait();
 
 		if (m_context && m_parameters.doubleBuffered)
 			m_context->SwapBuffers();
 	}
 
-	void RenderWindow::EnableVerticalSync(bool enabled)
+	/*!
+	* \brief Enables or disables the vertical synchronization
+	*
+	* \param enabled Should the buffers be swapped on vertical blanks
+	* \param adaptive Should late frames be swapped immediately (tearing) instead of waiting for the next vertical blank, if the driver supports it
+	*/
+	void RenderWindow::EnableVerticalSync(bool enabled, bool adaptive)
 	{
 		if (m_context)
 		{
@@ -156,12 +183,26 @@ namespace Nz
 				return;
 			}
 
-			m_context->EnableVerticalSync(enabled);
+			m_context->EnableVerticalSync(enabled, adaptive);
 		}
 		else
 			NazaraError("No context");
 	}
 
+	/*!
+	* \brief Gets the timing statistics of the frames displayed until now
+	* \return Frame statistics, measured by Display
+	*/
+	const FramePacer::Statistics& RenderWindow::GetFrameStatistics() const
+	{
+		return m_framePacer.GetStatistics();
+	}
+
+	unsigned int RenderWindow::GetFramerateLimit() const
+	{
+		return m_framePacer.GetFramerateLimit();
+	}
+
 	RenderTargetParameters RenderWindow::GetParameters() const
 	{
 		if (m_context)
@@ -176,6 +217,11 @@ namespace Nz
 		}
 	}
 
+	std::size_t RenderWindow::GetQueuedCopyCount() const
+	{
+		return m_queuedCopies.size();
+	}
+
 	Vector2ui RenderWindow::GetSize() const
 	{
 		return Window::GetSize();
@@ -191,9 +237,188 @@ namespace Nz
 		return m_impl != nullptr;
 	}
 
+	/*!
+	* \brief Starts copying a part of the window to a pixel buffer, without waiting for the GPU
+	* \return true If successful
+	*
+	* \param rect Part of the window to copy, the pixels being those of the current frame
+	*
+	* The GPU writes the pixels asynchronously, they are retrieved with RetrieveCopy a frame or two later.
+	* Copies are retrieved in the order they were queued, and their pixel buffers are reused afterwards.
+	*
+	* \see RetrieveCopy
+	*/
+	bool RenderWindow::QueueCopy(const Rectui& rect) const
+	{
+		#if NAZARA_RENDERER_SAFE
+		if (!m_context)
+		{
+			NazaraError("Window has not been created");
+			return false;
+		}
+		#endif
+
+		Vector2ui windowSize = GetSize();
+
+		#if NAZARA_RENDERER_SAFE
+		if (rect.x + rect.width > windowSize.x || rect.y + rect.height > windowSize.y)
+		{
+			NazaraError("Rectangle dimensions are out of window's bounds");
+			return false;
+		}
+		#endif
+
+		const Context* previousContext;
+		if (!ActivateContext(m_context, &previousContext))
+			return false;
+
+		CallOnExit restoreContext([this, previousContext] ()
+		{
+			RestoreContext(m_context, previousContext);
+		});
+
+		UInt32 size = rect.width*rect.height*4;
+
+		CopyBuffer buffer;
+		if (!m_copyBuffers.empty())
+		{
+			buffer = m_copyBuffers.back();
+			m_copyBuffers.pop_back();
+		}
+		else
+		{
+			buffer.id = 0;
+			buffer.size = 0;
+			glGenBuffers(1, &buffer.id);
+		}
+
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer.id);
+
+		if (buffer.size < size)
+		{
+			glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ);
+			buffer.size = size;
+		}
+
+		// Avec un pixel buffer lié, glReadPixels rend la main sans attendre la fin du rendu
+		glReadPixels(rect.x, windowSize.y - rect.height - rect.y, rect.width, rect.height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+		QueuedCopy copy;
+		copy.buffer = buffer;
+		copy.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		copy.rect = rect;
+
+		m_queuedCopies.push_back(copy);
+
+		return true;
+	}
+
+	/*!
+	* \brief Retrieves the oldest copy queued with QueueCopy, if the GPU is done with it
+	* \return true If the copy was written to the image, false if it isn't ready yet or if it failed
+	*
+	* \param image RGBA8 image receiving the pixels
+	* \param dstPos Position of the copy in the image
+	* \param wait Should the GPU be waited for if the copy isn't ready yet
+	*
+	* \remark Produces a NazaraError if no copy was queued
+	*
+	* \see QueueCopy
+	*/
+	bool RenderWindow::RetrieveCopy(AbstractImage* image, const Vector3ui& dstPos, bool wait) const
+	{
+		#if NAZARA_RENDERER_SAFE
+		if (!m_context)
+		{
+			NazaraError("Window has not been created");
+			return false;
+		}
+
+		if (m_queuedCopies.empty())
+		{
+			NazaraError("No copy was queued");
+			return false;
+		}
+
+		if (!image)
+		{
+			NazaraError("Image must be valid");
+			return false;
+		}
+
+		if (image->GetFormat() != PixelFormatType_RGBA8)
+		{
+			NazaraError("Image must be RGBA8-formatted");
+			return false;
+		}
+
+		const Rectui& copyRect = m_queuedCopies.front().rect;
+
+		Vector3ui imageSize = image->GetSize();
+		if (dstPos.x + copyRect.width > imageSize.x || dstPos.y + copyRect.height > imageSize.y || dstPos.z > imageSize.z)
+		{
+			NazaraError("Cube dimensions are out of image's bounds");
+			return false;
+		}
+		#endif
+
+		const Context* previousContext;
+		if (!ActivateContext(m_context, &previousContext))
+			return false;
+
+		CallOnExit restoreContext([this, previousContext] ()
+		{
+			RestoreContext(m_context, previousContext);
+		});
+
+		QueuedCopy& copy = m_queuedCopies.front();
+
+		GLsync fence = static_cast<GLsync>(copy.fence);
+		GLuint64 timeout = (wait) ? std::numeric_limits<GLuint64>::max() : 0;
+		GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+		if (result == GL_TIMEOUT_EXPIRED)
+			return false;
+
+		glDeleteSync(fence);
+
+		// Whatever happens from now on, the copy is over and its buffer can be reused
+		CopyBuffer buffer = copy.buffer;
+		Rectui rect = copy.rect;
+
+		m_copyBuffers.push_back(buffer);
+		m_queuedCopies.pop_front();
+
+		if (result == GL_WAIT_FAILED)
+		{
+			NazaraError("Failed to wait for copy (OpenGL error: 0x" + String::Number(glGetError(), 16) + ')');
+			return false;
+		}
+
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer.id);
+
+		CallOnExit unbindBuffer([] ()
+		{
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		});
+
+		const UInt8* pixels = static_cast<const UInt8*>(glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, rect.width*rect.height*4, GL_MAP_READ_BIT));
+		if (!pixels)
+		{
+			NazaraError("Failed to map pixel buffer (OpenGL error: 0x" + String::Number(glGetError(), 16) + ')');
+			return false;
+		}
+
+		UpdateFlipped(image, pixels, rect.width, rect.height, dstPos);
+
+		glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+
+		return true;
+	}
+
 	void RenderWindow::SetFramerateLimit(unsigned int limit)
 	{
-		m_framerateLimit = limit;
+		m_framePacer.SetFramerateLimit(limit);
 	}
 
 	ContextParameters RenderWindow::GetContextParameters() const
@@ -260,7 +485,7 @@ namespace Nz
 		OnRenderTargetParametersChange(this);
 		OnRenderTargetSizeChange(this);
 
-		m_clock.Restart();
+		m_framePacer.Restart();
 
 		return true;
 	}
@@ -269,6 +494,8 @@ namespace Nz
 	{
 		if (m_context)
 		{
+			ReleaseCopies();
+
 			if (IsActive())
 				Renderer::SetTarget(nullptr);
 
@@ -281,4 +508,27 @@ namespace Nz
 	{
 		OnRenderTargetSizeChange(this);
 	}
+
+	void RenderWindow::ReleaseCopies()
+	{
+		if (m_queuedCopies.empty() && m_copyBuffers.empty())
+			return;
+
+		const Context* previousContext;
+		if (!ActivateContext(m_context, &previousContext))
+			return;
+
+		for (QueuedCopy& copy : m_queuedCopies)
+		{
+			glDeleteSync(static_cast<GLsync>(copy.fence));
+			glDeleteBuffers(1, &copy.buffer.id);
+		}
+		m_queuedCopies.clear();
+
+		for (CopyBuffer& buffer : m_copyBuffers)
+			glDeleteBuffers(1, &buffer.id);
+		m_copyBuffers.clear();
+
+		RestoreContext(m_context, previousContext);
+	}
 }
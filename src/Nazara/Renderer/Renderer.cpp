@@ -9,7 +9,9 @@
 #include <Nazara/Core/ErrorFlags.hpp>
 #include <Nazara/Core/Log.hpp>
 #include <Nazara/Core/MemoryHelper.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Core/Signal.hpp>
+#include <Nazara/Renderer/CommandBuffer.hpp>
 #include <Nazara/Renderer/Config.hpp>
 #include <Nazara/Renderer/Context.hpp>
 #include <Nazara/Renderer/DebugDrawer.hpp>
@@ -20,16 +22,22 @@
 #include <Nazara/Renderer/RenderBuffer.hpp>
 #include <Nazara/Renderer/RenderTarget.hpp>
 #include <Nazara/Renderer/RenderStates.hpp>
+#include <Nazara/Renderer/RenderStatistics.hpp>
 #include <Nazara/Renderer/Shader.hpp>
 #include <Nazara/Renderer/ShaderBuilder.hpp>
 #include <Nazara/Renderer/Texture.hpp>
 #include <Nazara/Renderer/TextureSampler.hpp>
+#include <Nazara/Renderer/TextureUploadQueue.hpp>
 #include <Nazara/Renderer/UberShader.hpp>
+#include <Nazara/Utility/Buffer.hpp>
+#include <Nazara/Utility/BufferMapper.hpp>
 #include <Nazara/Utility/IndexBuffer.hpp>
 #include <Nazara/Utility/Utility.hpp>
 #include <Nazara/Utility/VertexBuffer.hpp>
 #include <Nazara/Utility/VertexDeclaration.hpp>
 #include <Nazara/Platform/Platform.hpp>
+#include <algorithm>
+#include <cstring>
 #include <map>
 #include <memory>
 #include <tuple>
@@ -37,8 +45,6 @@
 #include <vector>
 #include <Nazara/Renderer/Debug.hpp>
 
-///TODO: Manager les VAO (permettre plusieurs draw calls sans rebinder le VAO)
-
 namespace Nz
 {
 	namespace
@@ -79,13 +85,16 @@ namespace Nz
 		{
 			GLuint vao;
 
-			NazaraSlot(IndexBuffer, OnIndexBufferRelease, onIndexBufferReleaseSlot);
-			NazaraSlot(VertexBuffer, OnVertexBufferRelease, onVertexBufferReleaseSlot);
+			NazaraSlot(Buffer, OnBufferDestroy, onIndexBufferDestroySlot);
+			NazaraSlot(Buffer, OnBufferDestroy, onInstanceBufferDestroySlot);
+			NazaraSlot(Buffer, OnBufferDestroy, onVertexBufferDestroySlot);
 			NazaraSlot(VertexDeclaration, OnVertexDeclarationRelease, onInstancingDeclarationReleaseSlot);
 			NazaraSlot(VertexDeclaration, OnVertexDeclarationRelease, onVertexDeclarationReleaseSlot);
 		};
 
-		using VAO_Key = std::tuple<const IndexBuffer*, const VertexBuffer*, const VertexDeclaration*, const VertexDeclaration*>;
+		// VAOs are keyed by the underlying buffers, so that vertex buffers sharing a buffer (see BufferAllocator) share a VAO and are drawn with a base vertex
+		// Instance data has no base vertex, the start offset of the instance buffer is part of the key
+		using VAO_Key = std::tuple<const Buffer*, const Buffer*, UInt32, const VertexDeclaration*, const VertexDeclaration*, const Buffer*, UInt32>;
 		using VAO_Map = std::map<VAO_Key, VAO_Entry>;
 
 		struct Context_Entry
@@ -101,18 +110,23 @@ namespace Nz
 		std::vector<unsigned int> s_dirtyTextureUnits;
 		std::vector<TextureUnit> s_textureUnits;
 		GLuint s_currentVAO = 0;
+		const Context* s_currentVAOContext = nullptr; // VAOs are not shared between contexts
+		Buffer s_indirectBuffer(BufferType_DrawIndirect);
 		VertexBuffer s_instanceBuffer;
+		const VertexBuffer* s_externalInstanceBuffer = nullptr; //< Replaces s_instanceBuffer when set
 		VertexBuffer s_fullscreenQuadBuffer;
 		MatrixUnit s_matrices[MatrixType_Max + 1];
 		RenderStates s_states;
 		Vector2ui s_targetSize;
 		UInt8 s_maxAnisotropyLevel;
+		UInt32 s_baseVertex;
 		UInt32 s_updateFlags;
 		const IndexBuffer* s_indexBuffer;
 		const RenderTarget* s_target;
 		const Shader* s_shader;
 		const VertexBuffer* s_vertexBuffer;
 		bool s_capabilities[RendererCap_Max + 1];
+		bool s_drawSubmission = true;
 		bool s_instancing;
 		unsigned int s_maxColorAttachments;
 		unsigned int s_maxRenderTarget;
@@ -134,6 +148,78 @@ namespace Nz
 		glBeginConditionalRender(query.GetOpenGLID(), OpenGL::QueryCondition[condition]);
 	}
 
+	void Renderer::CapturePrimitives(PrimitiveMode mode, unsigned int firstVertex, unsigned int vertexCount, const Buffer* buffer, UInt32 offset)
+	{
+		NazaraAssert(buffer, "Invalid buffer");
+
+		#ifdef NAZARA_DEBUG
+		if (Context::GetCurrent() == nullptr)
+		{
+			NazaraError("No active context");
+			return;
+		}
+
+		if (mode > PrimitiveMode_Max)
+		{
+			NazaraError("Primitive mode out of enum");
+			return;
+		}
+		#endif
+
+		#if NAZARA_RENDERER_SAFE
+		if (buffer->GetStorage() != DataStorage_Hardware)
+		{
+			NazaraError("Capture buffer storage is not hardware");
+			return;
+		}
+		#endif
+
+		// Transform feedback only knows points, lines and triangles, strips and fans are captured as separate primitives
+		GLenum captureMode;
+		switch (mode)
+		{
+			case PrimitiveMode_LineList:
+			case PrimitiveMode_LineStrip:
+				captureMode = GL_LINES;
+				break;
+
+			case PrimitiveMode_PointList:
+				captureMode = GL_POINTS;
+				break;
+
+			case PrimitiveMode_TriangleFan:
+			case PrimitiveMode_TriangleList:
+			case PrimitiveMode_TriangleStrip:
+			default:
+				captureMode = GL_TRIANGLES;
+				break;
+		}
+
+		EnableInstancing(false);
+
+		// The program can't change while capturing, states have to be updated first
+		if (!EnsureStateUpdate())
+		{
+			NazaraError("Failed to update states: " + Error::GetLastError());
+			return;
+		}
+
+		GLuint bufferId = static_cast<HardwareBuffer*>(buffer->GetImpl())->GetOpenGLID();
+		glBindBufferRange(GL_TRANSFORM_FEEDBACK_BUFFER, 0, bufferId, offset, buffer->GetSize() - offset);
+
+		// Vertex shader outputs are all we want, nothing is rasterized
+		glEnable(GL_RASTERIZER_DISCARD);
+		glBeginTransformFeedback(captureMode);
+
+		glDrawArrays(OpenGL::PrimitiveMode[mode], s_baseVertex + firstVertex, vertexCount);
+		OpenGL::RecordDrawCall();
+
+		glEndTransformFeedback();
+		glDisable(GL_RASTERIZER_DISCARD);
+
+		glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, 0);
+	}
+
 	void Renderer::Clear(UInt32 flags)
 	{
 		#ifdef NAZARA_DEBUG
@@ -186,11 +272,18 @@ namespace Nz
 			return;
 		}
 
-		glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-		glBindVertexArray(0);
+		if (s_drawSubmission)
+			glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+
+		OpenGL::RecordDrawCall();
 	}
 
 	void Renderer::DrawIndexedPrimitives(PrimitiveMode mode, unsigned int firstIndex, unsigned int indexCount)
+	{
+		DrawIndexedPrimitives(mode, firstIndex, indexCount, 0);
+	}
+
+	void Renderer::DrawIndexedPrimitives(PrimitiveMode mode, unsigned int firstIndex, unsigned int indexCount, unsigned int baseVertex)
 	{
 		#ifdef NAZARA_DEBUG
 		if (Context::GetCurrent() == nullptr)
@@ -237,8 +330,86 @@ namespace Nz
 			type = GL_UNSIGNED_SHORT;
 		}
 
-		glDrawElements(OpenGL::PrimitiveMode[mode], indexCount, type, offset);
-		glBindVertexArray(0);
+		// The base vertex allows to draw vertices streamed anywhere in the vertex buffer without reprogramming the VAO
+		baseVertex += s_baseVertex;
+		if (s_drawSubmission)
+		{
+			if (baseVertex > 0)
+				glDrawElementsBaseVertex(OpenGL::PrimitiveMode[mode], indexCount, type, offset, baseVertex);
+			else
+				glDrawElements(OpenGL::PrimitiveMode[mode], indexCount, type, offset);
+		}
+
+		OpenGL::RecordDrawCall();
+	}
+
+	void Renderer::DrawIndexedPrimitivesIndirect(PrimitiveMode mode, const Buffer* commandBuffer, UInt32 offset, unsigned int drawCount)
+	{
+		NazaraAssert(commandBuffer, "Invalid command buffer");
+
+		#ifdef NAZARA_DEBUG
+		if (Context::GetCurrent() == nullptr)
+		{
+			NazaraError("No active context");
+			return;
+		}
+
+		if (mode > PrimitiveMode_Max)
+		{
+			NazaraError("Primitive mode out of enum");
+			return;
+		}
+		#endif
+
+		#if NAZARA_RENDERER_SAFE
+		if (!s_capabilities[RendererCap_MultiDrawIndirect])
+		{
+			NazaraError("Multi draw indirect is not supported");
+			return;
+		}
+
+		if (!s_indexBuffer)
+		{
+			NazaraError("No index buffer");
+			return;
+		}
+
+		if (commandBuffer->GetStorage() != DataStorage_Hardware)
+		{
+			NazaraError("Command buffer storage is not hardware");
+			return;
+		}
+
+		if (offset + drawCount * sizeof(DrawIndexedIndirectCommand) > commandBuffer->GetSize())
+		{
+			NazaraError("Commands exceed command buffer size");
+			return;
+		}
+		#endif
+
+		if (drawCount == 0)
+			return;
+
+		// Commands index the instance buffer through their base instance
+		EnableInstancing(true);
+
+		if (!EnsureStateUpdate())
+		{
+			NazaraError("Failed to update states: " + Error::GetLastError());
+			return;
+		}
+
+		GLenum type = (s_indexBuffer->HasLargeIndices()) ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT;
+
+		OpenGL::BindBuffer(BufferType_DrawIndirect, static_cast<HardwareBuffer*>(commandBuffer->GetImpl())->GetOpenGLID());
+
+		UInt8* commandOffset = nullptr;
+		commandOffset += offset;
+
+		if (s_drawSubmission)
+			glMultiDrawElementsIndirect(OpenGL::PrimitiveMode[mode], type, commandOffset, drawCount, 0);
+
+		OpenGL::RecordDrawCall();
 	}
 
 	void Renderer::DrawIndexedPrimitivesInstanced(unsigned int instanceCount, PrimitiveMode mode, unsigned int firstIndex, unsigned int indexCount)
@@ -270,7 +441,8 @@ namespace Nz
 			return;
 		}
 
-		unsigned int maxInstanceCount = s_instanceBuffer.GetVertexCount();
+		const VertexBuffer* instanceBuffer = (s_externalInstanceBuffer) ? s_externalInstanceBuffer : &s_instanceBuffer;
+		unsigned int maxInstanceCount = instanceBuffer->GetVertexCount();
 		if (instanceCount > maxInstanceCount)
 		{
 			NazaraError("Instance count is over maximum instance count (" + String::Number(instanceCount) + " >= " NazaraStringifyMacro(NAZARA_RENDERER_MAX_INSTANCES) ")");
@@ -301,8 +473,15 @@ namespace Nz
 			type = GL_UNSIGNED_SHORT;
 		}
 
-		glDrawElementsInstanced(OpenGL::PrimitiveMode[mode], indexCount, type, offset, instanceCount);
-		glBindVertexArray(0);
+		if (s_drawSubmission)
+		{
+			if (s_baseVertex > 0)
+				glDrawElementsInstancedBaseVertex(OpenGL::PrimitiveMode[mode], indexCount, type, offset, instanceCount, s_baseVertex);
+			else
+				glDrawElementsInstanced(OpenGL::PrimitiveMode[mode], indexCount, type, offset, instanceCount);
+		}
+
+		OpenGL::RecordDrawCall();
 	}
 
 	void Renderer::DrawPrimitives(PrimitiveMode mode, unsigned int firstVertex, unsigned int vertexCount)
@@ -329,8 +508,10 @@ namespace Nz
 			return;
 		}
 
-		glDrawArrays(OpenGL::PrimitiveMode[mode], firstVertex, vertexCount);
-		glBindVertexArray(0);
+		if (s_drawSubmission)
+			glDrawArrays(OpenGL::PrimitiveMode[mode], s_baseVertex + firstVertex, vertexCount);
+
+		OpenGL::RecordDrawCall();
 	}
 
 	void Renderer::DrawPrimitivesInstanced(unsigned int instanceCount, PrimitiveMode mode, unsigned int firstVertex, unsigned int vertexCount)
@@ -356,7 +537,8 @@ namespace Nz
 			return;
 		}
 
-		unsigned int maxInstanceCount = s_instanceBuffer.GetVertexCount();
+		const VertexBuffer* instanceBuffer = (s_externalInstanceBuffer) ? s_externalInstanceBuffer : &s_instanceBuffer;
+		unsigned int maxInstanceCount = instanceBuffer->GetVertexCount();
 		if (instanceCount > maxInstanceCount)
 		{
 			NazaraError("Instance count is over maximum instance count (" + String::Number(instanceCount) + " >= " NazaraStringifyMacro(NAZARA_RENDERER_MAX_INSTANCES) ")");
@@ -372,8 +554,16 @@ namespace Nz
 			return;
 		}
 
-		glDrawArraysInstanced(OpenGL::PrimitiveMode[mode], firstVertex, vertexCount, instanceCount);
-		glBindVertexArray(0);
+		if (s_drawSubmission)
+			glDrawArraysInstanced(OpenGL::PrimitiveMode[mode], s_baseVertex + firstVertex, vertexCount, instanceCount);
+
+		OpenGL::RecordDrawCall();
+	}
+
+	void Renderer::EnableDrawSubmission(bool drawSubmission)
+	{
+		// Draw calls still update the states and are counted in the statistics, only the GPU is spared from rendering anything
+		s_drawSubmission = drawSubmission;
 	}
 
 	void Renderer::Enable(RendererParameter parameter, bool enable)
@@ -439,6 +629,171 @@ namespace Nz
 		glEndConditionalRender();
 	}
 
+	void Renderer::Execute(const CommandBuffer& commandBuffer)
+	{
+		using Command = CommandBuffer::Command;
+
+		for (const Command& command : commandBuffer.m_commands)
+		{
+			switch (command.type)
+			{
+				case CommandBuffer::CommandType_BindPipeline:
+					SetShader(command.pipeline.shader);
+					SetRenderStates(commandBuffer.m_renderStates[command.pipeline.statesIndex]);
+					break;
+
+				case CommandBuffer::CommandType_Draw:
+				case CommandBuffer::CommandType_DrawIndexed:
+				{
+					bool indexed = (command.type == CommandBuffer::CommandType_DrawIndexed);
+					if (command.draw.instanceCount == 0)
+					{
+						if (indexed)
+							DrawIndexedPrimitives(command.draw.mode, command.draw.first, command.draw.count);
+						else
+							DrawPrimitives(command.draw.mode, command.draw.first, command.draw.count);
+
+						break;
+					}
+
+					// Instance matrices are streamed by batches as large as the instance buffer
+					VertexBuffer* instanceBuffer = GetInstanceBuffer();
+					instanceBuffer->SetVertexDeclaration(VertexDeclaration::Get(VertexLayout_Matrix4));
+
+					const Matrix4f* instanceMatrices = &commandBuffer.m_matrices[command.draw.firstInstance];
+					std::size_t remainingInstances = command.draw.instanceCount;
+					std::size_t maxInstancePerDraw = instanceBuffer->GetVertexCount();
+					while (remainingInstances > 0)
+					{
+						unsigned int instanceCount = static_cast<unsigned int>(std::min(remainingInstances, maxInstancePerDraw));
+						{
+							BufferMapper<VertexBuffer> instanceBufferMapper(instanceBuffer, BufferAccess_DiscardAndWrite);
+							std::memcpy(instanceBufferMapper.GetPointer(), instanceMatrices, instanceCount * sizeof(Matrix4f));
+						}
+
+						if (indexed)
+							DrawIndexedPrimitivesInstanced(instanceCount, command.draw.mode, command.draw.first, command.draw.count);
+						else
+							DrawPrimitivesInstanced(instanceCount, command.draw.mode, command.draw.first, command.draw.count);
+
+						instanceMatrices += instanceCount;
+						remainingInstances -= instanceCount;
+					}
+					break;
+				}
+
+				case CommandBuffer::CommandType_DrawIndexedIndirect:
+				{
+					VertexBuffer* instanceBuffer = GetInstanceBuffer();
+					instanceBuffer->SetVertexDeclaration(VertexDeclaration::Get(VertexLayout_Matrix4));
+
+					const DrawIndexedIndirectCommand* commands = &commandBuffer.m_indirectCommands[command.indirect.firstCommand];
+					const Matrix4f* instanceMatrices = &commandBuffer.m_matrices[command.indirect.firstInstance];
+					std::size_t commandCount = command.indirect.commandCount;
+					std::size_t maxCommandPerDraw = s_indirectBuffer.GetSize() / sizeof(DrawIndexedIndirectCommand);
+					std::size_t maxInstancePerDraw = instanceBuffer->GetVertexCount();
+
+					// Commands are streamed by batches whose instances fit in the instance buffer, their base instance being rebased on the first one
+					std::size_t firstCommand = 0;
+					while (firstCommand < commandCount)
+					{
+						UInt32 firstInstance = commands[firstCommand].baseInstance;
+						UInt32 lastInstance = firstInstance;
+
+						std::size_t lastCommand = firstCommand;
+						for (; lastCommand < commandCount && lastCommand - firstCommand < maxCommandPerDraw; ++lastCommand)
+						{
+							UInt32 instanceEnd = commands[lastCommand].baseInstance + commands[lastCommand].instanceCount;
+							if (instanceEnd - firstInstance > maxInstancePerDraw)
+								break;
+
+							lastInstance = std::max(lastInstance, instanceEnd);
+						}
+
+						if (lastCommand == firstCommand)
+						{
+							NazaraError("Indirect command has more instances than the instance buffer can hold");
+							break;
+						}
+
+						{
+							BufferMapper<Buffer> indirectBufferMapper(&s_indirectBuffer, BufferAccess_DiscardAndWrite);
+							BufferMapper<VertexBuffer> instanceBufferMapper(instanceBuffer, BufferAccess_DiscardAndWrite);
+
+							DrawIndexedIndirectCommand* mappedCommands = static_cast<DrawIndexedIndirectCommand*>(indirectBufferMapper.GetPointer());
+							for (std::size_t i = firstCommand; i < lastCommand; ++i)
+							{
+								*mappedCommands = commands[i];
+								mappedCommands->baseInstance -= firstInstance;
+								++mappedCommands;
+							}
+
+							std::memcpy(instanceBufferMapper.GetPointer(), instanceMatrices + firstInstance, (lastInstance - firstInstance) * sizeof(Matrix4f));
+						}
+
+						DrawIndexedPrimitivesIndirect(command.indirect.mode, &s_indirectBuffer, 0, static_cast<unsigned int>(lastCommand - firstCommand));
+						firstCommand = lastCommand;
+					}
+					break;
+				}
+
+				case CommandBuffer::CommandType_SendColor:
+				{
+					const float* values = command.uniform.values;
+					command.uniform.shader->SendColor(command.uniform.location, Color(UInt8(values[0]), UInt8(values[1]), UInt8(values[2]), UInt8(values[3])));
+					break;
+				}
+
+				case CommandBuffer::CommandType_SendFloat:
+					command.uniform.shader->SendFloat(command.uniform.location, command.uniform.values[0]);
+					break;
+
+				case CommandBuffer::CommandType_SendMatrixArray:
+					command.uniformMatrices.shader->SendMatrixArray(command.uniformMatrices.location, command.uniformMatrices.matrices, command.uniformMatrices.count);
+					break;
+
+				case CommandBuffer::CommandType_SendVector3:
+				{
+					const float* values = command.uniform.values;
+					command.uniform.shader->SendVector(command.uniform.location, Vector3f(values[0], values[1], values[2]));
+					break;
+				}
+
+				case CommandBuffer::CommandType_SendVector4:
+				{
+					const float* values = command.uniform.values;
+					command.uniform.shader->SendVector(command.uniform.location, Vector4f(values[0], values[1], values[2], values[3]));
+					break;
+				}
+
+				case CommandBuffer::CommandType_SetIndexBuffer:
+					SetIndexBuffer(static_cast<const IndexBuffer*>(command.buffer.object));
+					break;
+
+				case CommandBuffer::CommandType_SetMatrix:
+					SetMatrix(command.matrix.type, commandBuffer.m_matrices[command.matrix.matrixIndex]);
+					break;
+
+				case CommandBuffer::CommandType_SetScissorRect:
+					SetScissorRect(Recti(command.scissorRect.x, command.scissorRect.y, command.scissorRect.width, command.scissorRect.height));
+					break;
+
+				case CommandBuffer::CommandType_SetTexture:
+					SetTexture(command.texture.unit, command.texture.texture);
+					SetTextureSampler(command.texture.unit, commandBuffer.m_samplers[command.texture.samplerIndex]);
+					break;
+
+				case CommandBuffer::CommandType_SetUniformBuffer:
+					SetUniformBuffer(command.uniformBuffer.bindingIndex, command.uniformBuffer.buffer, command.uniformBuffer.offset, command.uniformBuffer.size);
+					break;
+
+				case CommandBuffer::CommandType_SetVertexBuffer:
+					SetVertexBuffer(static_cast<const VertexBuffer*>(command.buffer.object));
+					break;
+			}
+		}
+	}
+
 	void Renderer::Flush()
 	{
 		#ifdef NAZARA_DEBUG
@@ -457,6 +812,11 @@ namespace Nz
 		return s_states.depthFunc;
 	}
 
+	Buffer* Renderer::GetIndirectBuffer()
+	{
+		return &s_indirectBuffer;
+	}
+
 	VertexBuffer* Renderer::GetInstanceBuffer()
 	{
 		s_updateFlags |= Update_VAO;
@@ -542,11 +902,21 @@ namespace Nz
 		return s_shader;
 	}
 
+	const RenderStatistics& Renderer::GetStatistics()
+	{
+		return OpenGL::GetStatistics();
+	}
+
 	const RenderTarget* Renderer::GetTarget()
 	{
 		return s_target;
 	}
 
+	const VertexBuffer* Renderer::GetVertexBuffer()
+	{
+		return s_vertexBuffer;
+	}
+
 	Recti Renderer::GetViewport()
 	{
 		return OpenGL::GetCurrentViewport();
@@ -573,6 +943,8 @@ namespace Nz
 			return true; // Déjà initialisé
 		}
 
+		Profiler::Scope profilerScope("Renderer::Initialize");
+
 		// Initialisation des dépendances
 		if (!Platform::Initialize())
 		{
@@ -607,8 +979,10 @@ namespace Nz
 
 		// Récupération des capacités d'OpenGL
 		s_capabilities[RendererCap_AnisotropicFilter] = OpenGL::IsSupported(OpenGLExtension_AnisotropicFilter);
+		s_capabilities[RendererCap_BindlessTextures] = OpenGL::IsSupported(OpenGLExtension_BindlessTexture);
 		s_capabilities[RendererCap_FP64] = OpenGL::IsSupported(OpenGLExtension_FP64);
 		s_capabilities[RendererCap_Instancing] = true; // Supporté par OpenGL 3.3
+		s_capabilities[RendererCap_MultiDrawIndirect] = OpenGL::IsSupported(OpenGLExtension_MultiDrawIndirect);
 
 		Context::EnsureContext();
 
@@ -644,6 +1018,7 @@ namespace Nz
 
 		s_states = RenderStates();
 
+		s_baseVertex = 0;
 		s_indexBuffer = nullptr;
 		s_shader = nullptr;
 		s_target = nullptr;
@@ -684,6 +1059,17 @@ namespace Nz
 			}
 		}
 
+		// Indirect commands draw their instances from the instance buffer
+		s_capabilities[RendererCap_MultiDrawIndirect] &= s_capabilities[RendererCap_Instancing];
+		if (s_capabilities[RendererCap_MultiDrawIndirect])
+		{
+			if (!s_indirectBuffer.Create(NAZARA_RENDERER_INDIRECT_BUFFER_SIZE, DataStorage_Hardware, BufferUsage_Dynamic))
+			{
+				s_capabilities[RendererCap_MultiDrawIndirect] = false;
+				NazaraError("Failed to create indirect buffer");
+			}
+		}
+
 		if (!RenderBuffer::Initialize())
 		{
 			NazaraError("Failed to initialize render buffers");
@@ -702,6 +1088,12 @@ namespace Nz
 			return false;
 		}
 
+		if (!TextureUploadQueue::Initialize())
+		{
+			NazaraError("Failed to initialize texture upload queue");
+			return false;
+		}
+
 		if (!TextureSampler::Initialize())
 		{
 			NazaraError("Failed to initialize texture samplers");
@@ -735,7 +1127,11 @@ namespace Nz
 			case ComponentType_Float2:
 			case ComponentType_Float3:
 			case ComponentType_Float4:
-				return true; // Supportés nativement
+			case ComponentType_Half2:
+			case ComponentType_Half4:
+			case ComponentType_PackedNormal:
+			case ComponentType_UShortNorm2:
+				return true; // Supportés nativement (OpenGL 3.3)
 
 			case ComponentType_Double1:
 			case ComponentType_Double2:
@@ -795,11 +1191,21 @@ namespace Nz
 		return false;
 	}
 
+	bool Renderer::IsDrawSubmissionEnabled()
+	{
+		return s_drawSubmission;
+	}
+
 	bool Renderer::IsInitialized()
 	{
 		return s_moduleReferenceCounter != 0;
 	}
 
+	void Renderer::ResetStatistics()
+	{
+		OpenGL::ResetStatistics();
+	}
+
 	void Renderer::SetBlendFunc(BlendFunc srcBlend, BlendFunc dstBlend)
 	{
 		#ifdef NAZARA_DEBUG
@@ -920,6 +1326,17 @@ namespace Nz
 		}
 	}
 
+	void Renderer::SetInstanceBuffer(const VertexBuffer* instanceBuffer)
+	{
+		// Instance data usually lives in the instance buffer of the renderer, streamed before each draw call,
+		// this allows to draw instances stored once for all (ex: vegetation), nullptr restoring the instance buffer of the renderer
+		if (s_externalInstanceBuffer != instanceBuffer)
+		{
+			s_externalInstanceBuffer = instanceBuffer;
+			s_updateFlags |= Update_VAO;
+		}
+	}
+
 	void Renderer::SetLineWidth(float width)
 	{
 		#if NAZARA_RENDERER_SAFE
@@ -1238,6 +1655,9 @@ namespace Nz
 
 		if (s_target)
 		{
+			// Debug primitives are drawn on the target they were recorded for
+			DebugDrawer::Flush();
+
 			if (!s_target->HasContext())
 				s_target->Desactivate();
 
@@ -1303,16 +1723,53 @@ namespace Nz
 		}
 		#endif
 
-		s_textureUnits[unit].sampler = sampler;
-		s_textureUnits[unit].samplerUpdated = false;
+		TextureUnit& textureUnit = s_textureUnits[unit];
 
-		if (s_textureUnits[unit].texture)
-			s_textureUnits[unit].sampler.UseMipmaps(s_textureUnits[unit].texture->HasMipmaps());
+		// The mipmap setting comes from the texture, so it isn't compared
+		TextureSampler& currentSampler = textureUnit.sampler;
+		if (currentSampler.m_anisotropicLevel == sampler.m_anisotropicLevel &&
+		    currentSampler.m_filterMode == sampler.m_filterMode &&
+		    currentSampler.m_wrapMode == sampler.m_wrapMode)
+			return;
+
+		textureUnit.sampler = sampler;
+		textureUnit.samplerUpdated = false;
+
+		if (textureUnit.texture)
+			textureUnit.sampler.UseMipmaps(textureUnit.texture->HasMipmaps());
 
 		s_dirtyTextureUnits.push_back(unit);
 		s_updateFlags |= Update_Textures;
 	}
 
+	void Renderer::SetUniformBuffer(unsigned int bindingIndex, const Buffer* buffer, UInt32 offset, UInt32 size)
+	{
+		#ifdef NAZARA_DEBUG
+		if (Context::GetCurrent() == nullptr)
+		{
+			NazaraError("No active context");
+			return;
+		}
+		#endif
+
+		#if NAZARA_RENDERER_SAFE
+		if (buffer && buffer->GetStorage() != DataStorage_Hardware)
+		{
+			NazaraError("Uniform buffer storage is not hardware");
+			return;
+		}
+		#endif
+
+		// Uniform buffer bindings don't depend on the shader, they are applied right away
+		if (buffer)
+		{
+			GLuint bufferId = static_cast<HardwareBuffer*>(buffer->GetImpl())->GetOpenGLID();
+			OpenGL::BindUniformBuffer(bindingIndex, bufferId, offset, (size > 0) ? size : buffer->GetSize() - offset);
+		}
+		else
+			OpenGL::BindUniformBuffer(bindingIndex, 0, 0, 0);
+	}
+
 	void Renderer::SetVertexBuffer(const VertexBuffer* vertexBuffer)
 	{
 		if (s_vertexBuffer != vertexBuffer)
@@ -1324,6 +1781,8 @@ namespace Nz
 
 	void Renderer::SetViewport(const Recti& viewport)
 	{
+		DebugDrawer::Flush();
+
 		OpenGL::BindViewport(viewport);
 	}
 
@@ -1341,10 +1800,12 @@ namespace Nz
 		// Libération du module
 		s_moduleReferenceCounter = 0;
 
+		ShaderLibrary::Unregister("DebugColored");
 		ShaderLibrary::Unregister("DebugSimple");
 
 		UberShader::Uninitialize();
 		TextureSampler::Uninitialize();
+		TextureUploadQueue::Uninitialize();
 		Texture::Uninitialize();
 		Shader::Uninitialize();
 		RenderBuffer::Uninitialize();
@@ -1354,6 +1815,8 @@ namespace Nz
 
 		// Libération des buffers
 		s_fullscreenQuadBuffer.Reset();
+		s_indirectBuffer.Destroy();
+		s_externalInstanceBuffer = nullptr;
 		s_instanceBuffer.Reset();
 
 		// Libération des VAOs
@@ -1418,6 +1881,14 @@ namespace Nz
 
 		s_shader->Bind(); // Active le programme si ce n'est pas déjà le cas
 
+		// Our VAO has to be looked up again each time another context is used
+		const Context* context = Context::GetCurrent();
+		if (s_currentVAOContext != context)
+		{
+			s_currentVAOContext = context;
+			s_updateFlags |= Update_VAO;
+		}
+
 		// Si le programme a été changé depuis la dernière fois
 		if (s_updateFlags & Update_Shader)
 		{
@@ -1511,8 +1982,6 @@ namespace Nz
 				}
 
 				// Note: Les VAOs ne sont pas partagés entre les contextes, nous avons donc un tableau de VAOs par contexte
-				const Context* context = Context::GetCurrent();
-
 				auto it = s_vaos.find(context);
 				if (it == s_vaos.end())
 				{
@@ -1525,9 +1994,20 @@ namespace Nz
 				VAO_Map& vaoMap = it->second.vaoMap;
 
 				// Notre clé est composée de ce qui définit un VAO
+				const Buffer* indexBuffer = (s_indexBuffer) ? s_indexBuffer->GetBuffer().Get() : nullptr;
+				const Buffer* vertexBuffer = s_vertexBuffer->GetBuffer();
 				const VertexDeclaration* vertexDeclaration = s_vertexBuffer->GetVertexDeclaration();
-				const VertexDeclaration* instancingDeclaration = (s_instancing) ? s_instanceBuffer.GetVertexDeclaration() : nullptr;
-				VAO_Key key(s_indexBuffer, s_vertexBuffer, vertexDeclaration, instancingDeclaration);
+				const VertexBuffer* instanceBuffer = (s_externalInstanceBuffer) ? s_externalInstanceBuffer : &s_instanceBuffer;
+				const VertexDeclaration* instancingDeclaration = (s_instancing) ? instanceBuffer->GetVertexDeclaration() : nullptr;
+				const Buffer* instancingBuffer = (s_instancing) ? instanceBuffer->GetBuffer().Get() : nullptr;
+				UInt32 instancingOffset = (s_instancing) ? instanceBuffer->GetStartOffset() : 0;
+
+				// The whole vertices of the start offset are drawn through the base vertex, only the remaining bytes are part of the VAO
+				UInt32 vertexStride = static_cast<UInt32>(vertexDeclaration->GetStride());
+				UInt32 vertexOffset = s_vertexBuffer->GetStartOffset() % vertexStride;
+				s_baseVertex = s_vertexBuffer->GetStartOffset() / vertexStride;
+
+				VAO_Key key(indexBuffer, vertexBuffer, vertexOffset, vertexDeclaration, instancingDeclaration, instancingBuffer, instancingOffset);
 
 				// On recherche un VAO existant avec notre configuration
 				auto vaoIt = vaoMap.find(key);
@@ -1535,20 +2015,23 @@ namespace Nz
 				{
 					// On créé notre VAO
 					glGenVertexArrays(1, &s_currentVAO);
-					glBindVertexArray(s_currentVAO);
+					OpenGL::BindVertexArray(s_currentVAO);
 
 					// On l'ajoute à notre liste
 					VAO_Entry entry;
 					entry.vao = s_currentVAO;
 
 					// Connect the slots
-					if (s_indexBuffer)
-						entry.onIndexBufferReleaseSlot.Connect(s_indexBuffer->OnIndexBufferRelease, OnIndexBufferRelease);
+					if (indexBuffer)
+						entry.onIndexBufferDestroySlot.Connect(indexBuffer->OnBufferDestroy, OnBufferDestroy);
+
+					if (instancingBuffer)
+						entry.onInstanceBufferDestroySlot.Connect(instancingBuffer->OnBufferDestroy, OnBufferDestroy);
 
 					if (instancingDeclaration)
 						entry.onInstancingDeclarationReleaseSlot.Connect(instancingDeclaration->OnVertexDeclarationRelease, OnVertexDeclarationRelease);
 
-					entry.onVertexBufferReleaseSlot.Connect(s_vertexBuffer->OnVertexBufferRelease, OnVertexBufferRelease);
+					entry.onVertexBufferDestroySlot.Connect(vertexBuffer->OnBufferDestroy, OnBufferDestroy);
 					entry.onVertexDeclarationReleaseSlot.Connect(vertexDeclaration->OnVertexDeclarationRelease, OnVertexDeclarationRelease);
 
 					vaoIt = vaoMap.insert(std::make_pair(key, std::move(entry))).first;
@@ -1560,13 +2043,13 @@ namespace Nz
 					for (unsigned int i = 0; i < (s_instancing ? 2U : 1U); ++i)
 					{
 						// Selon l'itération nous choisissons un buffer différent
-						const VertexBuffer* vertexBuffer = (i == 0) ? s_vertexBuffer : &s_instanceBuffer;
+						const VertexBuffer* attributeBuffer = (i == 0) ? s_vertexBuffer : instanceBuffer;
 
-						HardwareBuffer* vertexBufferImpl = static_cast<HardwareBuffer*>(vertexBuffer->GetBuffer()->GetImpl());
+						HardwareBuffer* vertexBufferImpl = static_cast<HardwareBuffer*>(attributeBuffer->GetBuffer()->GetImpl());
 						glBindBuffer(OpenGL::BufferTarget[BufferType_Vertex], vertexBufferImpl->GetOpenGLID());
 
-						unsigned int bufferOffset = vertexBuffer->GetStartOffset();
-						vertexDeclaration = vertexBuffer->GetVertexDeclaration();
+						unsigned int bufferOffset = (i == 0) ? vertexOffset : attributeBuffer->GetStartOffset();
+						vertexDeclaration = attributeBuffer->GetVertexDeclaration();
 						unsigned int stride = vertexDeclaration->GetStride();
 
 						// On définit les bornes (une fois de plus selon l'itération)
@@ -1593,6 +2076,8 @@ namespace Nz
 								switch (type)
 								{
 									case ComponentType_Color:
+									case ComponentType_PackedNormal:
+									case ComponentType_UShortNorm2:
 									{
 										glVertexAttribPointer(OpenGL::VertexComponentIndex[j],
 															  Utility::ComponentCount[type],
@@ -1622,6 +2107,8 @@ namespace Nz
 									case ComponentType_Float2:
 									case ComponentType_Float3:
 									case ComponentType_Float4:
+									case ComponentType_Half2:
+									case ComponentType_Half4:
 									{
 										glVertexAttribPointer(OpenGL::VertexComponentIndex[j],
 															  Utility::ComponentCount[type],
@@ -1692,19 +2179,19 @@ namespace Nz
 					else
 						glBindBuffer(OpenGL::BufferTarget[BufferType_Index], 0);
 
-					// On invalide les bindings des buffers (car nous les avons défini manuellement)
-					OpenGL::SetBuffer(BufferType_Index, 0);
+					// On invalide le binding du vertex buffer (car nous l'avons défini manuellement)
+					// The index buffer binding belongs to the VAO, the cached binding of the default vertex array is still valid
 					OpenGL::SetBuffer(BufferType_Vertex, 0);
 
 					if (updateFailed)
 					{
 						// La création de notre VAO a échoué, libérons-le et marquons-le comme problématique
-						glDeleteVertexArrays(1, &vaoIt->second.vao);
+						OpenGL::DeleteVertexArray(context, vaoIt->second.vao);
 						vaoIt->second.vao = 0;
 						s_currentVAO = 0;
 					}
-					else
-						glBindVertexArray(0); // On marque la fin de la construction du VAO en le débindant
+
+					// The VAO stays bound, following draw calls using the same buffers won't have to bind it again
 				}
 				else
 					// Notre VAO existe déjà, il est donc inutile de le reprogrammer
@@ -1727,7 +2214,7 @@ namespace Nz
 			return false;
 		}
 
-		glBindVertexArray(s_currentVAO);
+		OpenGL::BindVertexArray(s_currentVAO);
 
 		// On vérifie que les textures actuellement bindées sont bien nos textures
 		// Ceci à cause du fait qu'il est possible que des opérations sur les textures aient eu lieu
@@ -1848,6 +2335,9 @@ namespace Nz
 		String fragmentShader;
 		String vertexShader;
 
+		String coloredFragmentShader;
+		String coloredVertexShader;
+
 		try
 		{
 			using namespace ShaderBuilder;
@@ -1870,6 +2360,24 @@ namespace Nz
 
 				vertexShader = writer.Generate(ExprStatement(Assign(builtinPos, Multiply(wvpMatrix, Cast<ExpressionType::Float4>(vertexPosition, Constant(1.f))))));
 			}
+
+			// Colored fragment shader
+			{
+				auto rt0 = Output("RenderTarget0", ExpressionType::Float4);
+				auto color = Input("vColor", ExpressionType::Float4);
+
+				coloredFragmentShader = writer.Generate(ExprStatement(Assign(rt0, color)));
+			}
+
+			// Colored vertex shader, positions are already in clip space
+			{
+				auto vertexColor = Input("VertexColor", ExpressionType::Float4);
+				auto vertexPosition = Input("VertexPosition", ExpressionType::Float4);
+				auto color = Output("vColor", ExpressionType::Float4);
+				auto builtinPos = Builtin(BuiltinEntry::VertexPosition);
+
+				coloredVertexShader = writer.Generate(Block(ExprStatement(Assign(builtinPos, vertexPosition)), ExprStatement(Assign(color, vertexColor))));
+			}
 		}
 		catch (const std::exception& e)
 		{
@@ -1877,43 +2385,51 @@ namespace Nz
 			return false;
 		}
 
-
-		ShaderRef debugShader = Shader::New();
-		if (!debugShader->Create())
+		auto BuildShader = [] (const String& fragmentSource, const String& vertexSource) -> ShaderRef
 		{
-			NazaraError("Failed to create debug shader");
-			return false;
-		}
+			ShaderRef shader = Shader::New();
+			if (!shader->Create())
+			{
+				NazaraError("Failed to create debug shader");
+				return nullptr;
+			}
 
-		if (!debugShader->AttachStageFromSource(ShaderStageType_Fragment, fragmentShader))
-		{
-			NazaraError("Failed to attach fragment stage");
-			return false;
-		}
+			if (!shader->AttachStageFromSource(ShaderStageType_Fragment, fragmentSource))
+			{
+				NazaraError("Failed to attach fragment stage");
+				return nullptr;
+			}
 
-		if (!debugShader->AttachStageFromSource(ShaderStageType_Vertex, vertexShader))
-		{
-			NazaraError("Failed to attach vertex stage");
+			if (!shader->AttachStageFromSource(ShaderStageType_Vertex, vertexSource))
+			{
+				NazaraError("Failed to attach vertex stage");
+				return nullptr;
+			}
+
+			if (!shader->Link())
+			{
+				NazaraError("Failed to link shader");
+				return nullptr;
+			}
+
+			return shader;
+		};
+
+		ShaderRef debugShader = BuildShader(fragmentShader, vertexShader);
+		if (!debugShader)
 			return false;
-		}
 
-		if (!debugShader->Link())
-		{
-			NazaraError("Failed to link shader");
+		ShaderRef coloredShader = BuildShader(coloredFragmentShader, coloredVertexShader);
+		if (!coloredShader)
 			return false;
-		}
 
+		ShaderLibrary::Register("DebugColored", coloredShader);
 		ShaderLibrary::Register("DebugSimple", debugShader);
 
 		return true;
 	}
 
-	void Renderer::OnContextRelease(const Context* context)
-	{
-		s_vaos.erase(context);
-	}
-
-	void Renderer::OnIndexBufferRelease(const IndexBuffer* indexBuffer)
+	void Renderer::OnBufferDestroy(const Buffer* buffer)
 	{
 		for (auto& pair : s_vaos)
 		{
@@ -1924,15 +2440,24 @@ namespace Nz
 			while (it != vaos.end())
 			{
 				const VAO_Key& key = it->first;
-				const IndexBuffer* vaoIndexBuffer = std::get<0>(key);
+				const Buffer* vaoIndexBuffer = std::get<0>(key);
+				const Buffer* vaoVertexBuffer = std::get<1>(key);
+				const Buffer* vaoInstanceBuffer = std::get<5>(key);
 
-				if (vaoIndexBuffer == indexBuffer)
+				if (vaoIndexBuffer == buffer || vaoVertexBuffer == buffer || vaoInstanceBuffer == buffer)
 				{
 					// Suppression du VAO:
 					// Comme celui-ci est local à son contexte de création, sa suppression n'est possible que si
 					// son contexte d'origine est actif, sinon il faudra le mettre en file d'attente
 					// Ceci est géré par la méthode OpenGL::DeleteVertexArray
 
+					if (it->second.vao == s_currentVAO)
+					{
+						// The VAO in use is being destroyed, the next draw call has to look up a new one
+						s_currentVAO = 0;
+						s_updateFlags |= Update_VAO;
+					}
+
 					OpenGL::DeleteVertexArray(context, it->second.vao);
 					vaos.erase(it++);
 				}
@@ -1942,6 +2467,14 @@ namespace Nz
 		}
 	}
 
+	void Renderer::OnContextRelease(const Context* context)
+	{
+		if (s_currentVAOContext == context)
+			s_currentVAOContext = nullptr;
+
+		s_vaos.erase(context);
+	}
+
 	void Renderer::OnShaderReleased(const Shader* shader)
 	{
 		if (s_shader == shader)
@@ -1962,35 +2495,6 @@ namespace Nz
 		}
 	}
 
-	void Renderer::OnVertexBufferRelease(const VertexBuffer* vertexBuffer)
-	{
-		for (auto& pair : s_vaos)
-		{
-			const Context* context = pair.first;
-			VAO_Map& vaos = pair.second.vaoMap;
-
-			auto it = vaos.begin();
-			while (it != vaos.end())
-			{
-				const VAO_Key& key = it->first;
-				const VertexBuffer* vaoVertexBuffer = std::get<1>(key);
-
-				if (vaoVertexBuffer == vertexBuffer)
-				{
-					// Suppression du VAO:
-					// Comme celui-ci est local à son contexte de création, sa suppression n'est possible que si
-					// son contexte d'origine est actif, sinon il faudra le mettre en file d'attente
-					// Ceci est géré par la méthode OpenGL::DeleteVertexArray
-
-					OpenGL::DeleteVertexArray(context, it->second.vao);
-					vaos.erase(it++);
-				}
-				else
-					++it;
-			}
-		}
-	}
-
 	void Renderer::OnVertexDeclarationRelease(const VertexDeclaration* vertexDeclaration)
 	{
 		for (auto& pair : s_vaos)
@@ -2002,8 +2506,8 @@ namespace Nz
 			while (it != vaos.end())
 			{
 				const VAO_Key& key = it->first;
-				const VertexDeclaration* vaoVertexDeclaration = std::get<2>(key);
-				const VertexDeclaration* vaoInstancingDeclaration = std::get<3>(key);
+				const VertexDeclaration* vaoVertexDeclaration = std::get<3>(key);
+				const VertexDeclaration* vaoInstancingDeclaration = std::get<4>(key);
 
 				if (vaoVertexDeclaration == vertexDeclaration || vaoInstancingDeclaration == vertexDeclaration)
 				{
@@ -2012,6 +2516,13 @@ namespace Nz
 					// son contexte d'origine est actif, sinon il faudra le mettre en file d'attente
 					// Ceci est géré par la méthode OpenGL::DeleteVertexArray
 
+					if (it->second.vao == s_currentVAO)
+					{
+						// The VAO in use is being destroyed, the next draw call has to look up a new one
+						s_currentVAO = 0;
+						s_updateFlags |= Update_VAO;
+					}
+
 					OpenGL::DeleteVertexArray(context, it->second.vao);
 					vaos.erase(it++);
 				}
@@ -15,6 +15,7 @@ namespace Nz
 {
 	Shader::Shader() :
 	m_linked(false),
+	m_linkPending(false),
 	m_program(0)
 	{
 	}
@@ -41,7 +42,7 @@ namespace Nz
 			return;
 		}
 
-		if (!shaderStage.IsCompiled())
+		if (!shaderStage.IsCompiled() && !shaderStage.IsCompilationPending())
 		{
 			NazaraError("Shader stage must be compiled");
 			return;
@@ -184,6 +185,7 @@ namespace Nz
 
 			Context::EnsureContext();
 			OpenGL::DeleteProgram(m_program);
+			m_linkPending = false;
 			m_program = 0;
 		}
 	}
@@ -199,7 +201,7 @@ namespace Nz
 
 		if (binaryLength > 0)
 		{
-			byteArray.Reserve(sizeof(UInt64) + binaryLength);
+			byteArray.Resize(sizeof(UInt64) + binaryLength);
 
 			UInt8* buffer = byteArray.GetBuffer();
 
@@ -278,11 +280,27 @@ namespace Nz
 		return source;
 	}
 
-	int Shader::GetUniformLocation(const String& name) const
+	int Shader::GetUniformBlockIndex(const String& name) const
 	{
 		Context::EnsureContext();
 
-		return glGetUniformLocation(m_program, name.GetConstBuffer());
+		GLuint blockIndex = glGetUniformBlockIndex(m_program, name.GetConstBuffer());
+		return (blockIndex != GL_INVALID_INDEX) ? static_cast<int>(blockIndex) : -1;
+	}
+
+	int Shader::GetUniformLocation(const Name& name) const
+	{
+		// Les emplacements ne changent qu'à l'édition des liens, on ne demande donc chaque nom qu'une fois au driver
+		auto it = m_namedUniformLocations.find(name.GetHash());
+		if (it != m_namedUniformLocations.end())
+			return it->second;
+
+		Context::EnsureContext();
+
+		int location = glGetUniformLocation(m_program, name.GetString());
+		m_namedUniformLocations.emplace(name.GetHash(), location);
+
+		return location;
 	}
 
 	int Shader::GetUniformLocation(ShaderUniform shaderUniform) const
@@ -310,15 +328,56 @@ namespace Nz
 		return m_program != 0;
 	}
 
+	bool Shader::IsLinking() const
+	{
+		if (!m_linkPending)
+			return false;
+
+		// Sans KHR_parallel_shader_compile, il n'y a aucun moyen de savoir si l'édition des liens est terminée sans l'attendre
+		if (!OpenGL::IsSupported(OpenGLExtension_ParallelShaderCompile))
+			return false;
+
+		Context::EnsureContext();
+
+		GLint completed;
+		glGetProgramiv(m_program, GL_COMPLETION_STATUS_KHR, &completed);
+
+		return completed == GL_FALSE;
+	}
+
 	bool Shader::Link()
 	{
 		Context::EnsureContext();
 
-		glLinkProgram(m_program);
+		// Une édition des liens lancée par LinkAsync n'a plus qu'à être récupérée (ce qui attend la fin de celle-ci)
+		if (!m_linkPending)
+			glLinkProgram(m_program);
+
+		m_linkPending = false;
 
 		return PostLinkage();
 	}
 
+	bool Shader::LinkAsync()
+	{
+		#if NAZARA_RENDERER_SAFE
+		if (!m_program)
+		{
+			NazaraError("Invalid program");
+			return false;
+		}
+		#endif
+
+		Context::EnsureContext();
+
+		glLinkProgram(m_program);
+
+		m_linked = false;
+		m_linkPending = true;
+
+		return true;
+	}
+
 	bool Shader::LoadFromBinary(const void* buffer, unsigned int size)
 	{
 		#if NAZARA_RENDERER_SAFE
@@ -496,6 +555,20 @@ namespace Nz
 		}
 	}
 
+	void Shader::SendMatrixArray(int location, const Matrix4f* matrices, unsigned int count) const
+	{
+		if (location == -1)
+			return;
+
+		if (glProgramUniformMatrix4fv)
+			glProgramUniformMatrix4fv(m_program, location, count, GL_FALSE, reinterpret_cast<const float*>(matrices));
+		else
+		{
+			OpenGL::BindProgram(m_program);
+			glUniformMatrix4fv(location, count, GL_FALSE, reinterpret_cast<const float*>(matrices));
+		}
+	}
+
 	void Shader::SendVector(int location, const Vector2d& vector) const
 	{
 		if (location == -1)
@@ -748,6 +821,27 @@ namespace Nz
 		}
 	}
 
+	void Shader::SetTransformFeedbackVaryings(const char* const* varyings, unsigned int varyingCount)
+	{
+		NazaraAssert(m_program, "Invalid program");
+
+		Context::EnsureContext();
+
+		// Outputs are written interleaved in a single buffer, in this order, the change is only applied by the next link
+		glTransformFeedbackVaryings(m_program, varyingCount, varyings, GL_INTERLEAVED_ATTRIBS);
+	}
+
+	void Shader::SetUniformBlockBinding(int blockIndex, unsigned int bindingIndex) const
+	{
+		if (blockIndex == -1)
+			return;
+
+		Context::EnsureContext();
+
+		// The binding is a state of the program, it is lost when the program is linked again
+		glUniformBlockBinding(m_program, static_cast<GLuint>(blockIndex), bindingIndex);
+	}
+
 	bool Shader::Validate() const
 	{
 		#if NAZARA_RENDERER_SAFE
@@ -789,6 +883,8 @@ namespace Nz
 		glGetProgramiv(m_program, GL_LINK_STATUS, &success);
 
 		m_linked = (success == GL_TRUE);
+		m_namedUniformLocations.clear();
+
 		if (m_linked)
 		{
 			// Pour éviter de se tromper entre le nom et la constante
@@ -95,11 +95,20 @@ namespace Nz { namespace ShaderAst
 		{
 			case ShaderAst::BinaryType::Add:
 			case ShaderAst::BinaryType::Divide:
-			case ShaderAst::BinaryType::Multiply:
 			case ShaderAst::BinaryType::Substract:
 				exprType = left->GetExpressionType();
 				break;
 
+			case ShaderAst::BinaryType::Multiply:
+			{
+				// Transforming a vector by a matrix gives a vector
+				exprType = left->GetExpressionType();
+				if (exprType == ExpressionType::Mat4x4 && right->GetExpressionType() == ExpressionType::Float4)
+					exprType = ExpressionType::Float4;
+
+				break;
+			}
+
 			case ShaderAst::BinaryType::Equality:
 				exprType = ExpressionType::Boolean;
 		}
@@ -178,9 +187,39 @@ namespace Nz { namespace ShaderAst
 	}
 
 
+	ExpressionType Sample::GetExpressionType() const
+	{
+		return ExpressionType::Float4;
+	}
+
+	void Sample::Register(ShaderWriter& visitor)
+	{
+		sampler->Register(visitor);
+		coordinates->Register(visitor);
+	}
+
+	void Sample::Visit(ShaderWriter& visitor)
+	{
+		visitor.Write(*this);
+	}
+
+
 	ExpressionType ShaderAst::SwizzleOp::GetExpressionType() const
 	{
-		return GetComponentType(expression->GetExpressionType());
+		switch (componentCount)
+		{
+			case 2:
+				return ExpressionType::Float2;
+
+			case 3:
+				return ExpressionType::Float3;
+
+			case 4:
+				return ExpressionType::Float4;
+
+			default:
+				return GetComponentType(expression->GetExpressionType());
+		}
 	}
 
 	void SwizzleOp::Register(ShaderWriter& visitor)
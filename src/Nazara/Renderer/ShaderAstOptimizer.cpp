@@ -0,0 +1,479 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Renderer module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Renderer/ShaderAstOptimizer.hpp>
+#include <Nazara/Core/CallOnExit.hpp>
+#include <Nazara/Renderer/ShaderWriter.hpp>
+#include <algorithm>
+#include <Nazara/Renderer/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup renderer
+	* \class Nz::ShaderAstOptimizer
+	* \brief Renderer class that specializes a shader AST before it is written
+	*
+	* Conditional statements are resolved against the conditions of a writer, constant expressions are folded and branches whose condition is known are replaced by the taken statement.
+	* The input AST is never modified: unchanged subtrees are shared with the result, so the same AST can be specialized for every permutation of an uber shader.
+	*/
+
+	/*!
+	* \brief Constructs a ShaderAstOptimizer object
+	*/
+	ShaderAstOptimizer::ShaderAstOptimizer() :
+	m_writer(nullptr)
+	{
+	}
+
+	/*!
+	* \brief Optimizes an expression
+	* \return Expression computing the same value, which is the input expression if nothing could be simplified
+	*
+	* \param expression Expression to optimize
+	*/
+	ShaderAst::ExpressionPtr ShaderAstOptimizer::Optimize(const ShaderAst::ExpressionPtr& expression)
+	{
+		NazaraAssert(expression, "Invalid expression");
+
+		if (auto binaryOp = std::dynamic_pointer_cast<ShaderAst::BinaryOp>(expression))
+			return OptimizeBinaryOp(binaryOp);
+
+		if (auto cast = std::dynamic_pointer_cast<ShaderAst::Cast>(expression))
+			return OptimizeCast(cast);
+
+		if (auto swizzleOp = std::dynamic_pointer_cast<ShaderAst::SwizzleOp>(expression))
+			return OptimizeSwizzleOp(swizzleOp);
+
+		if (auto assignOp = std::dynamic_pointer_cast<ShaderAst::AssignOp>(expression))
+		{
+			ShaderAst::ExpressionPtr right = Optimize(assignOp->right);
+			if (right == assignOp->right)
+				return expression;
+
+			auto optimized = std::make_shared<ShaderAst::AssignOp>(*assignOp);
+			optimized->right = std::move(right);
+
+			return optimized;
+		}
+
+		if (auto sample = std::dynamic_pointer_cast<ShaderAst::Sample>(expression))
+		{
+			ShaderAst::ExpressionPtr coordinates = Optimize(sample->coordinates);
+			if (coordinates == sample->coordinates)
+				return expression;
+
+			auto optimized = std::make_shared<ShaderAst::Sample>(*sample);
+			optimized->coordinates = std::move(coordinates);
+
+			return optimized;
+		}
+
+		// Constants and variables
+		return expression;
+	}
+
+	/*!
+	* \brief Specializes a statement for the conditions of a writer
+	* \return Optimized statement, an empty block if nothing is left
+	*
+	* \param statement Statement to optimize
+	* \param writer Writer whose enabled conditions are used to resolve the conditional statements
+	*/
+	ShaderAst::StatementPtr ShaderAstOptimizer::Optimize(const ShaderAst::StatementPtr& statement, const ShaderWriter& writer)
+	{
+		NazaraAssert(statement, "Invalid statement");
+
+		m_writer = &writer;
+		CallOnExit onExit([this] ()
+		{
+			m_writer = nullptr;
+		});
+
+		ShaderAst::StatementPtr optimized = OptimizeStatement(statement);
+		if (!optimized)
+			optimized = std::make_shared<ShaderAst::StatementBlock>();
+
+		return optimized;
+	}
+
+	ShaderAst::ExpressionPtr ShaderAstOptimizer::OptimizeBinaryOp(const std::shared_ptr<ShaderAst::BinaryOp>& node)
+	{
+		ShaderAst::ExpressionPtr left = Optimize(node->left);
+		ShaderAst::ExpressionPtr right = Optimize(node->right);
+
+		auto leftConstant = std::dynamic_pointer_cast<ShaderAst::Constant>(left);
+		auto rightConstant = std::dynamic_pointer_cast<ShaderAst::Constant>(right);
+		if (leftConstant && rightConstant)
+		{
+			if (node->op == ShaderAst::BinaryType::Equality)
+			{
+				if (leftConstant->exprType == ShaderAst::ExpressionType::Boolean)
+					return std::make_shared<ShaderAst::Constant>(leftConstant->values.bool1 == rightConstant->values.bool1);
+
+				FloatValues leftValues;
+				FloatValues rightValues;
+				unsigned int componentCount = GetFloatValues(*leftConstant, &leftValues);
+				GetFloatValues(*rightConstant, &rightValues);
+
+				return std::make_shared<ShaderAst::Constant>(std::equal(leftValues.begin(), leftValues.begin() + componentCount, rightValues.begin()));
+			}
+
+			FloatValues leftValues;
+			FloatValues rightValues;
+			unsigned int leftCount = GetFloatValues(*leftConstant, &leftValues);
+			unsigned int rightCount = GetFloatValues(*rightConstant, &rightValues);
+
+			// Vectors can be combined with a scalar, matrices are never constant
+			if (leftCount > 0 && (rightCount == leftCount || rightCount == 1))
+			{
+				bool foldable = true;
+				FloatValues result;
+				for (unsigned int i = 0; i < leftCount; ++i)
+				{
+					float rightValue = rightValues[(rightCount == 1) ? 0 : i];
+					switch (node->op)
+					{
+						case ShaderAst::BinaryType::Add:
+							result[i] = leftValues[i] + rightValue;
+							break;
+
+						case ShaderAst::BinaryType::Divide:
+						{
+							// Let the driver handle divisions by zero
+							if (rightValue == 0.f)
+								foldable = false;
+							else
+								result[i] = leftValues[i] / rightValue;
+
+							break;
+						}
+
+						case ShaderAst::BinaryType::Multiply:
+							result[i] = leftValues[i] * rightValue;
+							break;
+
+						case ShaderAst::BinaryType::Substract:
+							result[i] = leftValues[i] - rightValue;
+							break;
+
+						case ShaderAst::BinaryType::Equality: //< Already handled
+							break;
+					}
+				}
+
+				if (foldable)
+					return BuildConstant(left->GetExpressionType(), result);
+			}
+		}
+
+		// Neutral elements
+		switch (node->op)
+		{
+			case ShaderAst::BinaryType::Add:
+			{
+				if (IsConstantValue(left, 0.f))
+					return right;
+
+				if (IsConstantValue(right, 0.f))
+					return left;
+
+				break;
+			}
+
+			case ShaderAst::BinaryType::Divide:
+			{
+				if (IsConstantValue(right, 1.f))
+					return left;
+
+				break;
+			}
+
+			case ShaderAst::BinaryType::Multiply:
+			{
+				if (IsConstantValue(right, 1.f))
+					return left;
+
+				if (IsConstantValue(left, 1.f) && left->GetExpressionType() == right->GetExpressionType())
+					return right;
+
+				break;
+			}
+
+			case ShaderAst::BinaryType::Substract:
+			{
+				if (IsConstantValue(right, 0.f))
+					return left;
+
+				break;
+			}
+
+			case ShaderAst::BinaryType::Equality:
+				break;
+		}
+
+		if (left == node->left && right == node->right)
+			return node;
+
+		auto optimized = std::make_shared<ShaderAst::BinaryOp>(*node);
+		optimized->left = std::move(left);
+		optimized->right = std::move(right);
+
+		return optimized;
+	}
+
+	ShaderAst::StatementPtr ShaderAstOptimizer::OptimizeBranch(const std::shared_ptr<ShaderAst::Branch>& node)
+	{
+		auto optimized = std::make_shared<ShaderAst::Branch>(*node);
+		optimized->condStatements.clear();
+		optimized->elseStatement.reset();
+
+		for (const ShaderAst::Branch::ConditionalStatement& condStatement : node->condStatements)
+		{
+			ShaderAst::ExpressionPtr condition = Optimize(condStatement.condition);
+			ShaderAst::StatementPtr statement = OptimizeStatement(condStatement.statement);
+
+			auto constant = std::dynamic_pointer_cast<ShaderAst::Constant>(condition);
+			if (constant && constant->exprType == ShaderAst::ExpressionType::Boolean)
+			{
+				if (!constant->values.bool1)
+					continue;
+
+				// This statement is always taken, the following ones never are
+				if (optimized->condStatements.empty())
+					return statement;
+
+				optimized->elseStatement = (statement) ? std::move(statement) : std::make_shared<ShaderAst::StatementBlock>();
+				return optimized;
+			}
+
+			if (!statement)
+				statement = std::make_shared<ShaderAst::StatementBlock>();
+
+			optimized->condStatements.push_back({std::move(condition), std::move(statement)});
+		}
+
+		if (node->elseStatement)
+			optimized->elseStatement = OptimizeStatement(node->elseStatement);
+
+		if (optimized->condStatements.empty())
+			return optimized->elseStatement;
+
+		return optimized;
+	}
+
+	ShaderAst::ExpressionPtr ShaderAstOptimizer::OptimizeCast(const std::shared_ptr<ShaderAst::Cast>& node)
+	{
+		bool changed = false;
+		bool constant = true;
+		std::array<ShaderAst::ExpressionPtr, 4> expressions;
+		for (std::size_t i = 0; i < expressions.size(); ++i)
+		{
+			if (!node->expressions[i])
+				break;
+
+			expressions[i] = Optimize(node->expressions[i]);
+			if (expressions[i] != node->expressions[i])
+				changed = true;
+
+			if (!std::dynamic_pointer_cast<ShaderAst::Constant>(expressions[i]))
+				constant = false;
+		}
+
+		// A vector built from constants is a constant
+		unsigned int requiredComponents = ShaderAst::Node::GetComponentCount(node->exprType);
+		if (constant && ShaderAst::Node::GetComponentType(node->exprType) == ShaderAst::ExpressionType::Float1 && node->exprType != ShaderAst::ExpressionType::Float1)
+		{
+			FloatValues values;
+			unsigned int componentCount = 0;
+			for (const ShaderAst::ExpressionPtr& expression : expressions)
+			{
+				if (!expression)
+					break;
+
+				FloatValues exprValues;
+				unsigned int exprCount = GetFloatValues(static_cast<const ShaderAst::Constant&>(*expression), &exprValues);
+				if (exprCount == 0 || componentCount + exprCount > requiredComponents)
+				{
+					componentCount = 0;
+					break;
+				}
+
+				std::copy(exprValues.begin(), exprValues.begin() + exprCount, values.begin() + componentCount);
+				componentCount += exprCount;
+			}
+
+			if (componentCount == requiredComponents)
+				return BuildConstant(node->exprType, values);
+		}
+
+		if (!changed)
+			return node;
+
+		auto optimized = std::make_shared<ShaderAst::Cast>(*node);
+		optimized->expressions = std::move(expressions);
+
+		return optimized;
+	}
+
+	ShaderAst::StatementPtr ShaderAstOptimizer::OptimizeStatement(const ShaderAst::StatementPtr& statement)
+	{
+		if (auto conditionalStatement = std::dynamic_pointer_cast<ShaderAst::ConditionalStatement>(statement))
+		{
+			if (!m_writer->IsConditionEnabled(conditionalStatement->conditionName))
+				return nullptr;
+
+			return OptimizeStatement(conditionalStatement->statement);
+		}
+
+		if (auto block = std::dynamic_pointer_cast<ShaderAst::StatementBlock>(statement))
+		{
+			bool changed = false;
+			std::vector<ShaderAst::StatementPtr> statements;
+			statements.reserve(block->statements.size());
+
+			for (const ShaderAst::StatementPtr& child : block->statements)
+			{
+				ShaderAst::StatementPtr optimized = OptimizeStatement(child);
+				if (optimized != child)
+					changed = true;
+
+				if (!optimized)
+					continue;
+
+				// Nested blocks don't introduce scopes, flatten them
+				if (auto childBlock = std::dynamic_pointer_cast<ShaderAst::StatementBlock>(optimized))
+				{
+					statements.insert(statements.end(), childBlock->statements.begin(), childBlock->statements.end());
+					changed = true;
+				}
+				else
+					statements.emplace_back(std::move(optimized));
+			}
+
+			if (!changed)
+				return statement;
+
+			if (statements.empty())
+				return nullptr;
+
+			if (statements.size() == 1)
+				return statements.front();
+
+			auto optimized = std::make_shared<ShaderAst::StatementBlock>();
+			optimized->statements = std::move(statements);
+
+			return optimized;
+		}
+
+		if (auto branch = std::dynamic_pointer_cast<ShaderAst::Branch>(statement))
+			return OptimizeBranch(branch);
+
+		if (auto exprStatement = std::dynamic_pointer_cast<ShaderAst::ExpressionStatement>(statement))
+		{
+			ShaderAst::ExpressionPtr expression = Optimize(exprStatement->expression);
+			if (expression == exprStatement->expression)
+				return statement;
+
+			return std::make_shared<ShaderAst::ExpressionStatement>(std::move(expression));
+		}
+
+		return statement;
+	}
+
+	ShaderAst::ExpressionPtr ShaderAstOptimizer::OptimizeSwizzleOp(const std::shared_ptr<ShaderAst::SwizzleOp>& node)
+	{
+		ShaderAst::ExpressionPtr expression = Optimize(node->expression);
+
+		if (auto constant = std::dynamic_pointer_cast<ShaderAst::Constant>(expression))
+		{
+			FloatValues values;
+			if (GetFloatValues(*constant, &values) > 0)
+			{
+				FloatValues swizzled;
+				for (std::size_t i = 0; i < node->componentCount; ++i)
+					swizzled[i] = values[static_cast<std::size_t>(node->components[i])];
+
+				return BuildConstant(node->GetExpressionType(), swizzled);
+			}
+		}
+
+		if (expression == node->expression)
+			return node;
+
+		auto optimized = std::make_shared<ShaderAst::SwizzleOp>(*node);
+		optimized->expression = std::move(expression);
+
+		return optimized;
+	}
+
+	ShaderAst::ExpressionPtr ShaderAstOptimizer::BuildConstant(ShaderAst::ExpressionType type, const FloatValues& values)
+	{
+		switch (type)
+		{
+			case ShaderAst::ExpressionType::Float1:
+				return std::make_shared<ShaderAst::Constant>(values[0]);
+
+			case ShaderAst::ExpressionType::Float2:
+				return std::make_shared<ShaderAst::Constant>(Vector2f(values[0], values[1]));
+
+			case ShaderAst::ExpressionType::Float3:
+				return std::make_shared<ShaderAst::Constant>(Vector3f(values[0], values[1], values[2]));
+
+			case ShaderAst::ExpressionType::Float4:
+				return std::make_shared<ShaderAst::Constant>(Vector4f(values[0], values[1], values[2], values[3]));
+
+			default:
+				break;
+		}
+
+		NazaraInternalError("Unhandled constant type");
+		return nullptr;
+	}
+
+	unsigned int ShaderAstOptimizer::GetFloatValues(const ShaderAst::Constant& constant, FloatValues* values)
+	{
+		switch (constant.exprType)
+		{
+			case ShaderAst::ExpressionType::Float1:
+				(*values)[0] = constant.values.vec1;
+				return 1;
+
+			case ShaderAst::ExpressionType::Float2:
+				(*values)[0] = constant.values.vec2.x;
+				(*values)[1] = constant.values.vec2.y;
+				return 2;
+
+			case ShaderAst::ExpressionType::Float3:
+				(*values)[0] = constant.values.vec3.x;
+				(*values)[1] = constant.values.vec3.y;
+				(*values)[2] = constant.values.vec3.z;
+				return 3;
+
+			case ShaderAst::ExpressionType::Float4:
+				(*values)[0] = constant.values.vec4.x;
+				(*values)[1] = constant.values.vec4.y;
+				(*values)[2] = constant.values.vec4.z;
+				(*values)[3] = constant.values.vec4.w;
+				return 4;
+
+			default:
+				return 0;
+		}
+	}
+
+	bool ShaderAstOptimizer::IsConstantValue(const ShaderAst::ExpressionPtr& expression, float value)
+	{
+		auto constant = std::dynamic_pointer_cast<ShaderAst::Constant>(expression);
+		if (!constant)
+			return false;
+
+		FloatValues values;
+		unsigned int componentCount = GetFloatValues(*constant, &values);
+		if (componentCount == 0)
+			return false;
+
+		return std::all_of(values.begin(), values.begin() + componentCount, [value] (float component) { return component == value; });
+	}
+}
@@ -10,6 +10,7 @@
 namespace Nz
 {
 	ShaderStage::ShaderStage() :
+	m_compilationPending(false),
 	m_compiled(false),
 	m_id(0)
 	{
@@ -23,6 +24,7 @@ namespace Nz
 
 	ShaderStage::ShaderStage(ShaderStage&& stage) :
 	m_stage(stage.m_stage),
+	m_compilationPending(stage.m_compilationPending),
 	m_compiled(stage.m_compiled),
 	m_id(stage.m_id)
 	{
@@ -44,7 +46,11 @@ namespace Nz
 		}
 		#endif
 
-		glCompileShader(m_id);
+		// Une compilation lancée par CompileAsync n'a plus qu'à être récupérée (ce qui attend la fin de celle-ci)
+		if (!m_compilationPending)
+			glCompileShader(m_id);
+
+		m_compilationPending = false;
 
 		GLint success;
 		glGetShaderiv(m_id, GL_COMPILE_STATUS, &success);
@@ -59,6 +65,25 @@ namespace Nz
 		}
 	}
 
+	bool ShaderStage::CompileAsync()
+	{
+		#if NAZARA_RENDERER_SAFE
+		if (!m_id)
+		{
+			NazaraError("Shader stage is not initialized");
+			return false;
+		}
+		#endif
+
+		// Avec KHR_parallel_shader_compile, glCompileShader retourne sans attendre tant que le statut n'est pas demandé
+		glCompileShader(m_id);
+
+		m_compilationPending = true;
+		m_compiled = false;
+
+		return true;
+	}
+
 	bool ShaderStage::Create(ShaderStageType stage)
 	{
 		Destroy();
@@ -71,6 +96,7 @@ namespace Nz
 
 	void ShaderStage::Destroy()
 	{
+		m_compilationPending = false;
 		m_compiled = false;
 		if (m_id)
 		{
@@ -127,6 +153,11 @@ namespace Nz
 		return source;
 	}
 
+	bool ShaderStage::IsCompilationPending() const
+	{
+		return m_compilationPending;
+	}
+
 	bool ShaderStage::IsCompiled() const
 	{
 		return m_compiled;
@@ -202,6 +233,7 @@ namespace Nz
 	{
 		Destroy();
 
+		m_compilationPending = shader.m_compilationPending;
 		m_compiled = shader.m_compiled;
 		m_id = shader.m_id;
 		m_stage = shader.m_stage;
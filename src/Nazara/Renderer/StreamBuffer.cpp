@@ -0,0 +1,202 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Renderer module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Renderer/StreamBuffer.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/ErrorFlags.hpp>
+#include <Nazara/Renderer/Context.hpp>
+#include <Nazara/Renderer/OpenGL.hpp>
+#include <Nazara/Renderer/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup renderer
+	* \class Nz::StreamBuffer
+	* \brief Renderer class that streams dynamic data to the GPU through a ring of buffer segments
+	*
+	* The buffer is mapped persistently when GL_ARB_buffer_storage is available and through unsynchronized mappings otherwise.
+	* Mappings are handed out one after the other, so data written for earlier draw calls is never overwritten nor orphaned.
+	* When a segment is full, a fence is inserted after the commands reading it and the next segment is used once the GPU is done with it,
+	* so the CPU only waits if it gets a whole ring ahead of the GPU.
+	*/
+
+	/*!
+	* \brief Constructs a StreamBuffer object of a specific type
+	*
+	* \param type Type of the buffer
+	*/
+	StreamBuffer::StreamBuffer(BufferType type) :
+	m_buffer(type),
+	m_cursor(0),
+	m_segmentSize(0),
+	m_currentSegment(0)
+	{
+	}
+
+	/*!
+	* \brief Constructs a StreamBuffer object of a specific type and size
+	*
+	* \param type Type of the buffer
+	* \param size Total size of the buffer, in bytes
+	* \param segmentCount Number of segments the buffer is split into
+	*
+	* \remark Produces a NazaraError (and throws) if the buffer could not be created
+	*/
+	StreamBuffer::StreamBuffer(BufferType type, UInt32 size, unsigned int segmentCount) :
+	StreamBuffer(type)
+	{
+		ErrorFlags flags(ErrorFlag_ThrowException, true);
+
+		Create(size, segmentCount);
+	}
+
+	StreamBuffer::~StreamBuffer()
+	{
+		Destroy();
+	}
+
+	/*!
+	* \brief Creates the buffer
+	* \return true if successful
+	*
+	* \param size Total size of the buffer, in bytes
+	* \param segmentCount Number of segments the buffer is split into, three allows the CPU to fill a segment while the GPU reads another one and a third one is queued
+	*/
+	bool StreamBuffer::Create(UInt32 size, unsigned int segmentCount)
+	{
+		NazaraAssert(segmentCount > 0, "Stream buffer must have at least one segment");
+
+		Destroy();
+
+		if (!m_buffer.Create(size, DataStorage_Hardware, BufferUsage_Dynamic | BufferUsage_PersistentMapping))
+		{
+			NazaraError("Failed to create stream buffer");
+			return false;
+		}
+
+		m_currentSegment = 0;
+		m_cursor = 0;
+		m_fences.resize(segmentCount, nullptr);
+		m_segmentSize = size / segmentCount;
+
+		return true;
+	}
+
+	/*!
+	* \brief Destroys the buffer
+	*/
+	void StreamBuffer::Destroy()
+	{
+		if (!m_fences.empty())
+		{
+			Context::EnsureContext();
+
+			for (void* fence : m_fences)
+			{
+				if (fence)
+					glDeleteSync(static_cast<GLsync>(fence));
+			}
+
+			m_fences.clear();
+		}
+
+		m_buffer.Destroy();
+	}
+
+	/*!
+	* \brief Maps a part of the buffer no draw call is reading
+	* \return Pointer to the mapped memory, which is write-only, or nullptr if an error occurred
+	*
+	* \param size Size to map, in bytes, it must fit in a segment
+	* \param alignment Alignment of the offset, relative to the beginning of the buffer (for example the stride of the vertices)
+	* \param offset Pointer to fill with the offset of the mapped memory in the buffer
+	*
+	* \remark Unmap must be called before issuing draw calls using the mapped memory
+	*/
+	void* StreamBuffer::Map(UInt32 size, UInt32 alignment, UInt32* offset)
+	{
+		NazaraAssert(IsValid(), "Invalid stream buffer");
+		NazaraAssert(alignment > 0, "Alignment must be over zero");
+		NazaraAssert(offset, "Invalid offset pointer");
+
+		auto AlignCursor = [&]()
+		{
+			return (m_cursor + alignment - 1) / alignment * alignment;
+		};
+
+		UInt32 alignedCursor = AlignCursor();
+		if (alignedCursor + size > (m_currentSegment + 1) * m_segmentSize)
+		{
+			NextSegment();
+
+			alignedCursor = AlignCursor();
+			if (alignedCursor + size > (m_currentSegment + 1) * m_segmentSize)
+			{
+				NazaraError("Mapping size (" + String::Number(size) + ") exceeds segment size (" + String::Number(m_segmentSize) + ')');
+				return nullptr;
+			}
+		}
+
+		void* ptr = m_buffer.Map(BufferAccess_WriteOnly, alignedCursor, size);
+		if (!ptr)
+		{
+			NazaraError("Failed to map stream buffer");
+			return nullptr;
+		}
+
+		m_cursor = alignedCursor + size;
+
+		*offset = alignedCursor;
+		return ptr;
+	}
+
+	/*!
+	* \brief Unmaps the memory returned by the last call to Map
+	*/
+	void StreamBuffer::Unmap()
+	{
+		NazaraAssert(IsValid(), "Invalid stream buffer");
+
+		m_buffer.Unmap();
+	}
+
+	void StreamBuffer::NextSegment()
+	{
+		Context::EnsureContext();
+
+		// Draw calls reading the current segment were all issued, the GPU is done with it once this fence is signaled
+		if (m_fences[m_currentSegment])
+			glDeleteSync(static_cast<GLsync>(m_fences[m_currentSegment]));
+
+		m_fences[m_currentSegment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+		m_currentSegment = (m_currentSegment + 1) % m_fences.size();
+		m_cursor = m_currentSegment * m_segmentSize;
+
+		GLsync nextFence = static_cast<GLsync>(m_fences[m_currentSegment]);
+		if (nextFence)
+		{
+			// Only flush the commands the first time, we don't need to submit the fence again afterwards
+			GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+			for (;;)
+			{
+				GLenum result = glClientWaitSync(nextFence, flags, 1000000); // 1 ms
+				if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED)
+					break;
+
+				if (result == GL_WAIT_FAILED)
+				{
+					NazaraWarning("Failed to wait for stream buffer segment (OpenGL error: 0x" + String::Number(glGetError(), 16) + ')');
+					break;
+				}
+
+				flags = 0;
+			}
+
+			glDeleteSync(nextFence);
+			m_fences[m_currentSegment] = nullptr;
+		}
+	}
+}
@@ -9,7 +9,11 @@
 #include <Nazara/Renderer/Context.hpp>
 #include <Nazara/Renderer/Renderer.hpp>
 #include <Nazara/Renderer/OpenGL.hpp>
+#include <Nazara/Renderer/TextureSampler.hpp>
+#include <Nazara/Renderer/TextureUploadQueue.hpp>
 #include <Nazara/Utility/PixelFormat.hpp>
+#include <algorithm>
+#include <vector>
 #include <Nazara/Renderer/Debug.hpp>
 
 namespace Nz
@@ -20,6 +24,7 @@ namespace Nz
 		ImageType type;
 		PixelFormatType format;
 		UInt8 levelCount;
+		std::vector<std::pair<GLuint, GLuint64>> bindlessHandles; //< By sampler
 		bool mipmapping = false;
 		bool mipmapsUpdated = true;
 		unsigned int depth;
@@ -35,6 +40,57 @@ namespace Nz
 			return std::max(size >> level, 1U);
 		}
 
+		inline bool AttachLayer(GLenum framebuffer, const TextureImpl& impl, unsigned int z, UInt8 level)
+		{
+			switch (impl.type)
+			{
+				case ImageType_2D:
+					glFramebufferTexture2D(framebuffer, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, impl.id, level);
+					return true;
+
+				case ImageType_2D_Array:
+				case ImageType_3D:
+					glFramebufferTextureLayer(framebuffer, GL_COLOR_ATTACHMENT0, impl.id, level, z);
+					return true;
+
+				case ImageType_Cubemap:
+					glFramebufferTexture2D(framebuffer, GL_COLOR_ATTACHMENT0, OpenGL::CubemapFace[z], impl.id, level);
+					return true;
+
+				case ImageType_1D:
+				case ImageType_1D_Array:
+					break;
+			}
+
+			return false;
+		}
+
+		bool ConvertToSupportedFormat(Image* image)
+		{
+			PixelFormatType format = image->GetFormat();
+			if (Texture::IsFormatSupported(format))
+				return true;
+
+			///TODO: Sélectionner le format le plus adapté selon les composantes présentes dans le premier format
+			PixelFormatType newFormat = (PixelFormat::HasAlpha(format)) ? PixelFormatType_BGRA8 : PixelFormatType_BGR8;
+			NazaraWarning("Format " + PixelFormat::GetName(format) + " not supported, trying to convert it to " + PixelFormat::GetName(newFormat) + "...");
+
+			if (!PixelFormat::IsConversionSupported(format, newFormat))
+			{
+				NazaraError("Conversion not supported");
+				return false;
+			}
+
+			if (!image->Convert(newFormat))
+			{
+				NazaraError("Conversion failed");
+				return false;
+			}
+
+			NazaraWarning("Conversion succeed");
+			return true;
+		}
+
 		inline void SetUnpackAlignement(UInt8 bpp)
 		{
 			if (bpp % 8 == 0)
@@ -68,6 +124,111 @@ namespace Nz
 		Renderer::OnTextureReleased(this); ///TODO: Gets rid of this
 	}
 
+	bool Texture::Copy(const Texture* source, const Boxui& srcBox, const Vector3ui& dstPos, UInt8 level)
+	{
+		#if NAZARA_RENDERER_SAFE
+		if (!m_impl)
+		{
+			NazaraError("Texture must be valid");
+			return false;
+		}
+
+		if (!source || !source->IsValid())
+		{
+			NazaraError("Invalid source texture");
+			return false;
+		}
+
+		if (source->m_impl->format != m_impl->format)
+		{
+			NazaraError("Source and destination textures must have the same format");
+			return false;
+		}
+
+		if (!srcBox.IsValid())
+		{
+			NazaraError("Invalid box");
+			return false;
+		}
+
+		if (level >= m_impl->levelCount || level >= source->m_impl->levelCount)
+		{
+			NazaraError("Level out of bounds (" + String::Number(level) + " >= " + String::Number(std::min(m_impl->levelCount, source->m_impl->levelCount)) + ')');
+			return false;
+		}
+
+		unsigned int srcDepth = (source->m_impl->type == ImageType_Cubemap) ? 6 : GetLevelSize(source->m_impl->depth, level);
+		if (srcBox.x + srcBox.width > GetLevelSize(source->m_impl->width, level) || srcBox.y + srcBox.height > GetLevelSize(source->m_impl->height, level) || srcBox.z + srcBox.depth > srcDepth)
+		{
+			NazaraError("Source box is out of bounds");
+			return false;
+		}
+
+		unsigned int dstDepth = (m_impl->type == ImageType_Cubemap) ? 6 : GetLevelSize(m_impl->depth, level);
+		if (dstPos.x + srcBox.width > GetLevelSize(m_impl->width, level) || dstPos.y + srcBox.height > GetLevelSize(m_impl->height, level) || dstPos.z + srcBox.depth > dstDepth)
+		{
+			NazaraError("Destination box is out of bounds");
+			return false;
+		}
+		#endif
+
+		// The pixels never leave the GPU
+		if (OpenGL::IsSupported(OpenGLExtension_CopyImage))
+		{
+			glCopyImageSubData(source->m_impl->id, OpenGL::TextureTarget[source->m_impl->type], level, srcBox.x, srcBox.y, srcBox.z,
+			                   m_impl->id, OpenGL::TextureTarget[m_impl->type], level, dstPos.x, dstPos.y, dstPos.z,
+			                   srcBox.width, srcBox.height, srcBox.depth);
+
+			return true;
+		}
+
+		// Otherwise each layer is blitted from a framebuffer to another, which only works with color formats
+		if (PixelFormat::IsCompressed(m_impl->format) || PixelFormat::GetContent(m_impl->format) != PixelFormatContent_ColorRGBA)
+		{
+			NazaraError("Copying " + PixelFormat::GetName(m_impl->format) + " textures requires ARB_copy_image");
+			return false;
+		}
+
+		GLint previousDrawBuffer, previousReadBuffer;
+		glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &previousDrawBuffer);
+		glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &previousReadBuffer);
+
+		GLuint framebuffers[2];
+		glGenFramebuffers(2, framebuffers);
+
+		CallOnExit restoreFramebuffers([&]()
+		{
+			glBindFramebuffer(GL_DRAW_FRAMEBUFFER, previousDrawBuffer);
+			glBindFramebuffer(GL_READ_FRAMEBUFFER, previousReadBuffer);
+
+			glDeleteFramebuffers(2, framebuffers);
+		});
+
+		glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffers[0]);
+		glBindFramebuffer(GL_DRAW_FRAMEBUFFER, framebuffers[1]);
+
+		for (unsigned int i = 0; i < srcBox.depth; ++i)
+		{
+			if (!AttachLayer(GL_READ_FRAMEBUFFER, *source->m_impl, srcBox.z + i, level) || !AttachLayer(GL_DRAW_FRAMEBUFFER, *m_impl, dstPos.z + i, level))
+			{
+				NazaraError("Copying 1D textures requires ARB_copy_image");
+				return false;
+			}
+
+			if (glCheckFramebufferStatus(GL_READ_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE || glCheckFramebufferStatus(GL_DRAW_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+			{
+				NazaraError("Failed to attach textures to framebuffers");
+				return false;
+			}
+
+			glBlitFramebuffer(srcBox.x, srcBox.y, srcBox.x + srcBox.width, srcBox.y + srcBox.height,
+			                  dstPos.x, dstPos.y, dstPos.x + srcBox.width, dstPos.y + srcBox.height,
+			                  GL_COLOR_BUFFER_BIT, GL_NEAREST);
+		}
+
+		return true;
+	}
+
 	bool Texture::Create(ImageType type, PixelFormatType format, unsigned int width, unsigned int height, unsigned int depth, UInt8 levelCount)
 	{
 		Destroy();
@@ -212,6 +373,11 @@ namespace Nz
 			OnTextureDestroy(this);
 
 			Context::EnsureContext();
+
+			// A texture can't be deleted while one of its handles is resident
+			for (const auto& pair : m_impl->bindlessHandles)
+				glMakeTextureHandleNonResidentARB(pair.second);
+
 			OpenGL::DeleteTexture(m_impl->id);
 
 			delete m_impl;
@@ -513,34 +679,10 @@ namespace Nz
 
 		// Vive le Copy-On-Write
 		Image newImage(image);
+		if (!ConvertToSupportedFormat(&newImage))
+			return false;
 
 		PixelFormatType format = newImage.GetFormat();
-		if (!IsFormatSupported(format))
-		{
-			///TODO: Sélectionner le format le plus adapté selon les composantes présentes dans le premier format
-			PixelFormatType newFormat = (PixelFormat::HasAlpha(format)) ? PixelFormatType_BGRA8 : PixelFormatType_BGR8;
-			NazaraWarning("Format " + PixelFormat::GetName(format) + " not supported, trying to convert it to " + PixelFormat::GetName(newFormat) + "...");
-
-			if (PixelFormat::IsConversionSupported(format, newFormat))
-			{
-				if (newImage.Convert(newFormat))
-				{
-					NazaraWarning("Conversion succeed");
-					format = newFormat;
-				}
-				else
-				{
-					NazaraError("Conversion failed");
-					return false;
-				}
-			}
-			else
-			{
-				NazaraError("Conversion not supported");
-				return false;
-			}
-		}
-
 		ImageType type = newImage.GetType();
 		UInt8 levelCount = newImage.GetLevelCount();
 		if (!Create(type, format, newImage.GetWidth(), newImage.GetHeight(), newImage.GetDepth(), (generateMipmaps) ? 0xFF : levelCount))
@@ -1008,72 +1150,57 @@ namespace Nz
 		}
 		#endif
 
-		OpenGL::Format format;
-		if (!OpenGL::TranslateFormat(m_impl->format, &format, OpenGL::FormatType_Texture))
-		{
-			NazaraError("Failed to get OpenGL format");
-			return false;
-		}
-
-		SetUnpackAlignement(PixelFormat::GetBytesPerPixel(m_impl->format));
-		glPixelStorei(GL_UNPACK_ROW_LENGTH, srcWidth);
-		glPixelStorei(GL_UNPACK_IMAGE_HEIGHT, srcHeight);
+		// The pixels come from the client memory, not from a staging buffer
+		OpenGL::BindBuffer(BufferType_PixelUnpack, 0);
 
-		OpenGL::BindTexture(m_impl->type, m_impl->id);
+		return UploadPixels(pixels, box, srcWidth, srcHeight, level);
+	}
 
-		if (PixelFormat::IsCompressed(m_impl->format))
-		{
-			switch (m_impl->type)
-			{
-				case ImageType_1D:
-					glCompressedTexSubImage1D(GL_TEXTURE_1D, level, box.x, box.width, format.internalFormat, PixelFormat::ComputeSize(m_impl->format, box.width, 1, 1), pixels);
-					break;
+	bool Texture::Update(const UInt8* pixels, const Rectui& rect, unsigned int z, unsigned int srcWidth, unsigned int srcHeight, UInt8 level)
+	{
+		return Update(pixels, Boxui(rect.x, rect.y, z, rect.width, rect.height, 1), srcWidth, srcHeight, level);
+	}
 
-				case ImageType_1D_Array:
-				case ImageType_2D:
-					glCompressedTexSubImage2D(OpenGL::TextureTarget[m_impl->type], level, box.x, box.y, box.width, box.height, format.internalFormat, PixelFormat::ComputeSize(m_impl->format, box.width, box.height, 1), pixels);
-					break;
+	/*!
+	* \brief Gets a bindless handle of the texture, allowing shaders to sample it without binding it to a texture unit
+	* \return Handle of the texture used with the sampler, zero if the texture is not valid or bindless textures are not supported
+	*
+	* Handles are created once per sampler and made resident in the current context, they stay valid until the texture is destroyed.
+	*
+	* \param sampler Sampler the handle samples the texture with
+	*
+	* \remark Once a handle is created, the parameters of the texture (like its mipmap range) can no longer change
+	* \remark Mipmaps invalidated afterwards are not regenerated by the renderer, as the texture isn't bound anymore, call EnsureMipmapsUpdate before using the handle
+	*
+	* \see RendererCap_BindlessTextures
+	*/
+	UInt64 Texture::GetBindlessHandle(const TextureSampler& sampler) const
+	{
+		if (!m_impl || !Renderer::HasCapability(RendererCap_BindlessTextures))
+			return 0;
 
-				case ImageType_2D_Array:
-				case ImageType_3D:
-					glCompressedTexSubImage3D(OpenGL::TextureTarget[m_impl->type], level, box.x, box.y, box.z, box.width, box.height, box.depth, format.internalFormat, PixelFormat::ComputeSize(m_impl->format, box.width, box.height, box.depth), pixels);
-					break;
+		TextureSampler textureSampler(sampler);
+		textureSampler.UseMipmaps(HasMipmaps());
 
-				case ImageType_Cubemap:
-					glCompressedTexSubImage2D(OpenGL::CubemapFace[box.z], level, box.x, box.y, box.width, box.height, format.internalFormat, PixelFormat::ComputeSize(m_impl->format, box.width, box.height, box.depth), pixels);
-					break;
-			}
-		}
-		else
-		{
-			switch (m_impl->type)
-			{
-				case ImageType_1D:
-					glTexSubImage1D(GL_TEXTURE_1D, level, box.x, box.width, format.dataFormat, format.dataType, pixels);
-					break;
+		GLuint samplerId = textureSampler.GetOpenGLID();
 
-				case ImageType_1D_Array:
-				case ImageType_2D:
-					glTexSubImage2D(OpenGL::TextureTarget[m_impl->type], level, box.x, box.y, box.width, box.height, format.dataFormat, format.dataType, pixels);
-					break;
+		auto it = std::find_if(m_impl->bindlessHandles.begin(), m_impl->bindlessHandles.end(), [samplerId] (const std::pair<GLuint, GLuint64>& pair) { return pair.first == samplerId; });
+		if (it != m_impl->bindlessHandles.end())
+			return it->second;
 
-				case ImageType_2D_Array:
-				case ImageType_3D:
-					glTexSubImage3D(OpenGL::TextureTarget[m_impl->type], level, box.x, box.y, box.z, box.width, box.height, box.depth, format.dataFormat, format.dataType, pixels);
-					break;
+		EnsureMipmapsUpdate();
 
-				case ImageType_Cubemap:
-					glTexSubImage2D(OpenGL::CubemapFace[box.z], level, box.x, box.y, box.width, box.height, format.dataFormat, format.dataType, pixels);
-					break;
-			}
+		GLuint64 handle = glGetTextureSamplerHandleARB(m_impl->id, samplerId);
+		if (handle == 0)
+		{
+			NazaraError("Failed to get texture handle");
+			return 0;
 		}
 
-		return true;
-	}
+		glMakeTextureHandleResidentARB(handle);
+		m_impl->bindlessHandles.emplace_back(samplerId, handle);
 
-	bool Texture::Update(const UInt8* pixels, const Rectui& rect, unsigned int z, unsigned int srcWidth, unsigned int srcHeight, UInt8 level)
-	{
-		return Update(pixels, Boxui(rect.x, rect.y, z, rect.width, rect.height, 1), srcWidth, srcHeight, level);
+		return handle;
 	}
 
 	unsigned int Texture::GetOpenGLID() const
@@ -1193,6 +1320,67 @@ namespace Nz
 		return false;
 	}
 
+	/*!
+	* \brief Loads a texture from a file without blocking
+	* \return Future of the texture
+	*
+	* The image is decoded (and converted if its format isn't supported) by the TaskScheduler workers, then uploaded by the TextureUploadQueue once ResourceFinalizationQueue::Process created the texture.
+	* Both must be processed by the render thread, the texture is only given back once its upload completed.
+	*
+	* \param filePath Path to the file
+	* \param params Parameters for the image
+	* \param generateMipmaps Should the mipmaps be generated
+	*/
+	ResourceFuture<Texture> Texture::LoadAsync(const String& filePath, const ImageParams& params, bool generateMipmaps)
+	{
+		ImageRef image = Image::New();
+
+		return ResourceFuture<Texture>::StartDeferred(Texture::New(), [filePath, image, params](Texture& /*texture*/)
+		{
+			return image->LoadFromFile(filePath, params) && ConvertToSupportedFormat(image);
+		},
+		[generateMipmaps, image](Texture& texture, ResourceFuture<Texture>::Completion completion)
+		{
+			StartUpload(texture, image, generateMipmaps, std::move(completion));
+		},
+		[](Texture& texture)
+		{
+			TextureUploadQueue::Flush(&texture);
+		});
+	}
+
+	/*!
+	* \brief Reloads a texture from a file without blocking
+	* \return Future of the texture, ready once its content was replaced
+	*
+	* The image is decoded by the TaskScheduler workers and uploaded into the texture by the TextureUploadQueue, the texture keeps its previous content if decoding fails.
+	* If its type, format and size are unchanged, the texture is updated in place band after band, otherwise it's recreated when the upload starts.
+	*
+	* \param texture Texture to reload
+	* \param filePath Path to the file
+	* \param params Parameters for the image
+	* \param generateMipmaps Should the mipmaps be generated
+	*
+	* \see TextureManager::Reload
+	*/
+	ResourceFuture<Texture> Texture::ReloadAsync(const TextureRef& texture, const String& filePath, const ImageParams& params, bool generateMipmaps)
+	{
+		ImageRef image = Image::New();
+
+		return ResourceFuture<Texture>::StartDeferred(texture, [filePath, image, params](Texture& /*texture*/)
+		{
+			return image->LoadFromFile(filePath, params) && ConvertToSupportedFormat(image);
+		},
+		[generateMipmaps, image](Texture& texture, ResourceFuture<Texture>::Completion completion)
+		{
+			StartUpload(texture, image, generateMipmaps, std::move(completion));
+		},
+		[](Texture& texture)
+		{
+			TextureUploadQueue::Flush(&texture);
+		});
+	}
+
 	bool Texture::CreateTexture(bool proxy)
 	{
 		OpenGL::Format openGLFormat;
@@ -1316,6 +1504,94 @@ namespace Nz
 		return true;
 	}
 
+	void Texture::StartUpload(Texture& texture, const ImageRef& image, bool generateMipmaps, std::function<void(bool succeeded)> completion)
+	{
+		bool compatible = texture.IsValid() && texture.GetType() == image->GetType() && texture.GetFormat() == image->GetFormat() &&
+		                  texture.GetSize() == image->GetSize() && texture.GetLevelCount() >= image->GetLevelCount();
+
+		if (!compatible && !texture.Create(image->GetType(), image->GetFormat(), image->GetWidth(), image->GetHeight(), image->GetDepth(), (generateMipmaps) ? 0xFF : image->GetLevelCount()))
+		{
+			NazaraError("Failed to create texture");
+			completion(false);
+			return;
+		}
+
+		// Keep resource path info
+		texture.SetFilePath(image->GetFilePath());
+
+		TextureUploadQueue::Enqueue(&texture, image, [completion](Texture* /*texture*/, bool succeeded)
+		{
+			completion(succeeded);
+		});
+	}
+
+	bool Texture::UploadPixels(const void* pixels, const Boxui& box, unsigned int srcWidth, unsigned int srcHeight, UInt8 level)
+	{
+		OpenGL::Format format;
+		if (!OpenGL::TranslateFormat(m_impl->format, &format, OpenGL::FormatType_Texture))
+		{
+			NazaraError("Failed to get OpenGL format");
+			return false;
+		}
+
+		SetUnpackAlignement(PixelFormat::GetBytesPerPixel(m_impl->format));
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, srcWidth);
+		glPixelStorei(GL_UNPACK_IMAGE_HEIGHT, srcHeight);
+
+		OpenGL::BindTexture(m_impl->type, m_impl->id);
+
+		if (PixelFormat::IsCompressed(m_impl->format))
+		{
+			switch (m_impl->type)
+			{
+				case ImageType_1D:
+					glCompressedTexSubImage1D(GL_TEXTURE_1D, level, box.x, box.width, format.internalFormat, PixelFormat::ComputeSize(m_impl->format, box.width, 1, 1), pixels);
+					break;
+
+				case ImageType_1D_Array:
+				case ImageType_2D:
+					glCompressedTexSubImage2D(OpenGL::TextureTarget[m_impl->type], level, box.x, box.y, box.width, box.height, format.internalFormat, PixelFormat::ComputeSize(m_impl->format, box.width, box.height, 1), pixels);
+					break;
+
+				case ImageType_2D_Array:
+				case ImageType_3D:
+					glCompressedTexSubImage3D(OpenGL::TextureTarget[m_impl->type], level, box.x, box.y, box.z, box.width, box.height, box.depth, format.internalFormat, PixelFormat::ComputeSize(m_impl->format, box.width, box.height, box.depth), pixels);
+					break;
+
+				case ImageType_Cubemap:
+					glCompressedTexSubImage2D(OpenGL::CubemapFace[box.z], level, box.x, box.y, box.width, box.height, format.internalFormat, PixelFormat::ComputeSize(m_impl->format, box.width, box.height, box.depth), pixels);
+					break;
+			}
+		}
+		else
+		{
+			switch (m_impl->type)
+			{
+				case ImageType_1D:
+					glTexSubImage1D(GL_TEXTURE_1D, level, box.x, box.width, format.dataFormat, format.dataType, pixels);
+					break;
+
+				case ImageType_1D_Array:
+				case ImageType_2D:
+					glTexSubImage2D(OpenGL::TextureTarget[m_impl->type], level, box.x, box.y, box.width, box.height, format.dataFormat, format.dataType, pixels);
+					break;
+
+				case ImageType_2D_Array:
+				case ImageType_3D:
+					glTexSubImage3D(OpenGL::TextureTarget[m_impl->type], level, box.x, box.y, box.z, box.width, box.height, box.depth, format.dataFormat, format.dataType, pixels);
+					break;
+
+				case ImageType_Cubemap:
+					glTexSubImage2D(OpenGL::CubemapFace[box.z], level, box.x, box.y, box.width, box.height, format.dataFormat, format.dataType, pixels);
+					break;
+			}
+		}
+
+		OpenGL::RecordUpload(PixelFormat::ComputeSize(m_impl->format, box.width, box.height, box.depth));
+
+		return true;
+	}
+
 	bool Texture::Initialize()
 	{
 		if (!TextureLibrary::Initialize())
@@ -0,0 +1,424 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Renderer module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Renderer/TextureUploadQueue.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Renderer/Context.hpp>
+#include <Nazara/Renderer/HardwareBuffer.hpp>
+#include <Nazara/Renderer/OpenGL.hpp>
+#include <Nazara/Renderer/StreamBuffer.hpp>
+#include <Nazara/Utility/PixelFormat.hpp>
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <vector>
+#include <Nazara/Renderer/Debug.hpp>
+
+namespace Nz
+{
+	struct TextureUploadQueue::Upload
+	{
+		struct Chunk
+		{
+			Boxui box;
+			UInt8 level;
+		};
+
+		ImageConstRef image;
+		TextureRef texture;
+		UploadCallback callback;
+		std::vector<Chunk> chunks;
+		std::size_t nextChunk = 0;
+		GLsync fence = nullptr;
+		bool cancelled = false;
+
+		// Must be destroyed before the texture reference, which may destroy the texture
+		NazaraSlot(Texture, OnTextureDestroy, onTextureDestroy);
+	};
+
+	namespace
+	{
+		constexpr UInt32 ChunkAlignment = 16; //< Offsets must be aligned on the size of a pixel, which is at most 16 bytes (RGBA32F)
+		constexpr unsigned int RingSegmentCount = 3;
+
+		UInt32 ComputeChunkSize(const Texture& texture, const Boxui& box)
+		{
+			return static_cast<UInt32>(PixelFormat::ComputeSize(texture.GetFormat(), box.width, box.height, box.depth));
+		}
+	}
+
+	struct TextureUploadQueue::State
+	{
+		std::deque<std::unique_ptr<Upload>> pendingUploads;  //< Uploads with chunks left to issue
+		std::vector<std::unique_ptr<Upload>> issuedUploads;  //< Uploads waiting for their fence
+		std::unique_ptr<StreamBuffer> ring;
+		UInt64 frameBudget = NAZARA_RENDERER_UPLOAD_BUFFER_SIZE / RingSegmentCount;
+	};
+
+	/*!
+	* \ingroup renderer
+	* \class Nz::TextureUploadQueue
+	* \brief Renderer class uploading images to textures over several frames, without stalling the render thread
+	*
+	* Images are copied to a persistently mapped ring of pixel unpack buffers, from which the driver copies them to the textures asynchronously.
+	* Process uploads at most the frame budget each time it's called, splitting big images in bands of rows, and calls the callback of an upload once the GPU is done with it (signaled by a fence).
+	*
+	* Textures loaded with Texture::LoadAsync are uploaded through this queue, they are only given back once their upload completed.
+	*
+	* \remark Every method must be called by the render thread
+	* \remark Until its upload completes, the content of a texture is undefined
+	*/
+
+	/*!
+	* \brief Drops every upload which hasn't completed yet
+	*
+	* Callbacks of the dropped uploads are called, as failed
+	*/
+	void TextureUploadQueue::Clear()
+	{
+		State& state = GetState();
+
+		std::vector<std::unique_ptr<Upload>> uploads;
+		for (auto& upload : state.pendingUploads)
+			uploads.emplace_back(std::move(upload));
+
+		for (auto& upload : state.issuedUploads)
+			uploads.emplace_back(std::move(upload));
+
+		state.pendingUploads.clear();
+		state.issuedUploads.clear();
+
+		if (!uploads.empty())
+			Context::EnsureContext();
+
+		for (auto& upload : uploads)
+		{
+			if (upload->fence)
+				glDeleteSync(upload->fence);
+
+			if (upload->callback)
+				upload->callback(upload->texture, false);
+		}
+	}
+
+	/*!
+	* \brief Queues the upload of an image to a texture
+	*
+	* Every level of the image the texture has is uploaded, entirely
+	*
+	* \param texture Texture to update, kept alive until the upload completed
+	* \param image Image to upload, its size and format must match the texture ones and it must not be modified until the upload completed
+	* \param callback Optional function called once the GPU is done with the upload, or if it failed
+	*
+	* \remark Destroying or recreating the texture before the upload completed fails it
+	*/
+	void TextureUploadQueue::Enqueue(TextureRef texture, ImageConstRef image, UploadCallback callback)
+	{
+		NazaraAssert(texture && texture->IsValid(), "Invalid texture");
+		NazaraAssert(image && image->IsValid(), "Invalid image");
+		NazaraAssert(image->GetFormat() == texture->GetFormat(), "Image format does not match texture format");
+		NazaraAssert(image->GetSize() == texture->GetSize(), "Image size does not match texture size");
+
+		std::unique_ptr<Upload> upload(new Upload);
+
+		// Splits the levels in bands of rows fitting in a segment of the ring
+		PixelFormatType format = texture->GetFormat();
+		unsigned int rowGranularity = (PixelFormat::IsCompressed(format)) ? 4 : 1; //< Compressed formats are made of blocks of 4x4 pixels
+		UInt32 segmentSize = NAZARA_RENDERER_UPLOAD_BUFFER_SIZE / RingSegmentCount - ChunkAlignment;
+
+		UInt8 levelCount = std::min(image->GetLevelCount(), texture->GetLevelCount());
+		for (UInt8 level = 0; level < levelCount; ++level)
+		{
+			unsigned int width = image->GetWidth(level);
+			unsigned int height = image->GetHeight(level);
+			unsigned int sliceCount = (image->GetType() == ImageType_Cubemap) ? 6 : image->GetDepth(level);
+
+			UInt32 bandSize = static_cast<UInt32>(PixelFormat::ComputeSize(format, width, rowGranularity, 1));
+			unsigned int rowsPerChunk = std::max(segmentSize / bandSize, 1U) * rowGranularity; //< Bands too big for the ring are uploaded from the image
+
+			for (unsigned int z = 0; z < sliceCount; ++z)
+			{
+				for (unsigned int y = 0; y < height; y += rowsPerChunk)
+				{
+					Upload::Chunk chunk;
+					chunk.box = Boxui(0, y, z, width, std::min(rowsPerChunk, height - y), 1);
+					chunk.level = level;
+
+					upload->chunks.push_back(chunk);
+				}
+			}
+		}
+
+		Upload* uploadPtr = upload.get();
+		upload->onTextureDestroy.Connect(texture->OnTextureDestroy, [uploadPtr](const Texture* /*texture*/)
+		{
+			uploadPtr->cancelled = true;
+		});
+
+		upload->callback = std::move(callback);
+		upload->image = std::move(image);
+		upload->texture = std::move(texture);
+
+		GetState().pendingUploads.emplace_back(std::move(upload));
+	}
+
+	/*!
+	* \brief Completes uploads right away, ignoring the frame budget
+	*
+	* Chunks left are issued and the CPU waits for the GPU to be done with them, before calling the callbacks
+	*
+	* \param texture Texture whose uploads should be completed, nullptr to complete every upload
+	*/
+	void TextureUploadQueue::Flush(const Texture* texture)
+	{
+		State& state = GetState();
+
+		Context::EnsureContext();
+
+		UInt64 uploadedBytes = 0;
+		for (auto& upload : state.pendingUploads)
+		{
+			if (!texture || upload->texture.Get() == texture)
+				IssueChunks(*upload, std::numeric_limits<UInt64>::max(), &uploadedBytes);
+		}
+
+		OpenGL::BindBuffer(BufferType_PixelUnpack, 0);
+
+		// Uploads whose chunks were all issued now have their fence
+		auto it = std::stable_partition(state.pendingUploads.begin(), state.pendingUploads.end(), [](const std::unique_ptr<Upload>& upload) { return upload->fence == nullptr && !upload->cancelled; });
+		std::move(it, state.pendingUploads.end(), std::back_inserter(state.issuedUploads));
+		state.pendingUploads.erase(it, state.pendingUploads.end());
+
+		PollFences(texture, true);
+	}
+
+	/*!
+	* \brief Gets the maximum number of bytes uploaded by each Process call
+	* \return Budget in bytes
+	*/
+	UInt64 TextureUploadQueue::GetFrameBudget()
+	{
+		return GetState().frameBudget;
+	}
+
+	/*!
+	* \brief Gets the number of uploads which didn't complete yet
+	* \return Number of queued and in flight uploads
+	*/
+	std::size_t TextureUploadQueue::GetPendingCount()
+	{
+		State& state = GetState();
+		return state.pendingUploads.size() + state.issuedUploads.size();
+	}
+
+	/*!
+	* \brief Checks whether a texture has uploads which didn't complete yet
+	* \return true If an upload of this texture is queued or in flight
+	*
+	* \param texture Texture to check
+	*/
+	bool TextureUploadQueue::HasPendingUploads(const Texture* texture)
+	{
+		State& state = GetState();
+
+		auto IsTextureUpload = [texture](const std::unique_ptr<Upload>& upload) { return upload->texture.Get() == texture; };
+		return std::any_of(state.pendingUploads.begin(), state.pendingUploads.end(), IsTextureUpload) ||
+		       std::any_of(state.issuedUploads.begin(), state.issuedUploads.end(), IsTextureUpload);
+	}
+
+	/*!
+	* \brief Issues queued uploads within the frame budget and completes the ones the GPU is done with
+	* \return Number of uploads which completed (successfully or not)
+	*
+	* This should be called once per frame, after ResourceFinalizationQueue::Process so textures decoded meanwhile start their upload right away.
+	*
+	* \remark At least one band of rows is uploaded each call, even if it exceeds the budget
+	*/
+	std::size_t TextureUploadQueue::Process()
+	{
+		State& state = GetState();
+
+		if (state.pendingUploads.empty() && state.issuedUploads.empty())
+			return 0;
+
+		Context::EnsureContext();
+
+		std::size_t completedCount = PollFences(nullptr, false);
+
+		UInt64 uploadedBytes = 0;
+		while (!state.pendingUploads.empty())
+		{
+			Upload& upload = *state.pendingUploads.front();
+			IssueChunks(upload, state.frameBudget, &uploadedBytes);
+
+			if (!upload.fence && !upload.cancelled)
+				break; //< Budget exhausted
+
+			state.issuedUploads.emplace_back(std::move(state.pendingUploads.front()));
+			state.pendingUploads.pop_front();
+		}
+
+		OpenGL::BindBuffer(BufferType_PixelUnpack, 0);
+
+		return completedCount;
+	}
+
+	/*!
+	* \brief Sets the maximum number of bytes uploaded by each Process call
+	*
+	* \param budget Budget in bytes, higher values make textures available sooner at the cost of longer frames
+	*/
+	void TextureUploadQueue::SetFrameBudget(UInt64 budget)
+	{
+		NazaraAssert(budget > 0, "Budget must be over zero");
+
+		GetState().frameBudget = budget;
+	}
+
+	auto TextureUploadQueue::GetState() -> State&
+	{
+		static State state;
+		return state;
+	}
+
+	bool TextureUploadQueue::Initialize()
+	{
+		return true;
+	}
+
+	void TextureUploadQueue::IssueChunks(Upload& upload, UInt64 budget, UInt64* uploadedBytes)
+	{
+		State& state = GetState();
+
+		if (upload.cancelled)
+			return;
+
+		Texture* texture = upload.texture;
+		const Image& image = *upload.image;
+
+		while (upload.nextChunk < upload.chunks.size())
+		{
+			const Upload::Chunk& chunk = upload.chunks[upload.nextChunk];
+
+			UInt32 chunkSize = ComputeChunkSize(*texture, chunk.box);
+			if (*uploadedBytes > 0 && *uploadedBytes + chunkSize > budget)
+				return;
+
+			// Offset of the band in the image, which is tightly packed
+			const UInt8* pixels = image.GetConstPixels(0, 0, chunk.box.z, chunk.level) + PixelFormat::ComputeSize(image.GetFormat(), chunk.box.width, chunk.box.y, 1);
+
+			bool succeeded;
+			if (chunkSize <= NAZARA_RENDERER_UPLOAD_BUFFER_SIZE / RingSegmentCount - ChunkAlignment)
+			{
+				if (!state.ring)
+					state.ring.reset(new StreamBuffer(BufferType_PixelUnpack, NAZARA_RENDERER_UPLOAD_BUFFER_SIZE, RingSegmentCount));
+
+				UInt32 offset;
+				void* ptr = state.ring->Map(chunkSize, ChunkAlignment, &offset);
+				if (ptr)
+				{
+					std::memcpy(ptr, pixels, chunkSize);
+					state.ring->Unmap();
+
+					OpenGL::BindBuffer(BufferType_PixelUnpack, static_cast<HardwareBuffer*>(state.ring->GetBuffer()->GetImpl())->GetOpenGLID());
+					succeeded = texture->UploadPixels(reinterpret_cast<const void*>(static_cast<std::uintptr_t>(offset)), chunk.box, 0, 0, chunk.level);
+				}
+				else
+					succeeded = false;
+			}
+			else
+			{
+				// Too big for the ring, the driver copies it from the image
+				OpenGL::BindBuffer(BufferType_PixelUnpack, 0);
+				succeeded = texture->UploadPixels(pixels, chunk.box, 0, 0, chunk.level);
+			}
+
+			if (!succeeded)
+			{
+				NazaraError("Failed to upload texture chunk");
+				upload.cancelled = true;
+				return;
+			}
+
+			*uploadedBytes += chunkSize;
+			upload.nextChunk++;
+		}
+
+		texture->InvalidateMipmaps();
+
+		// Signaled once the GPU copied every chunk to the texture
+		upload.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	}
+
+	std::size_t TextureUploadQueue::PollFences(const Texture* texture, bool wait)
+	{
+		State& state = GetState();
+
+		std::vector<std::unique_ptr<Upload>> completedUploads;
+		for (auto it = state.issuedUploads.begin(); it != state.issuedUploads.end();)
+		{
+			Upload& upload = **it;
+
+			bool completed = true;
+			if (upload.fence && !upload.cancelled)
+			{
+				bool shouldWait = wait && (!texture || upload.texture.Get() == texture);
+
+				// Only flush the commands the first time, we don't need to submit the fence again afterwards
+				GLbitfield flags = (shouldWait) ? GL_SYNC_FLUSH_COMMANDS_BIT : 0;
+				for (;;)
+				{
+					GLenum result = glClientWaitSync(upload.fence, flags, (shouldWait) ? 1000000 : 0); // 1 ms
+					if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED)
+						break;
+
+					if (result == GL_WAIT_FAILED)
+					{
+						NazaraWarning("Failed to wait for texture upload (OpenGL error: 0x" + String::Number(glGetError(), 16) + ')');
+						upload.cancelled = true;
+						break;
+					}
+
+					if (!shouldWait)
+					{
+						completed = false;
+						break;
+					}
+
+					flags = 0;
+				}
+			}
+
+			if (completed)
+			{
+				completedUploads.emplace_back(std::move(*it));
+				it = state.issuedUploads.erase(it);
+			}
+			else
+				++it;
+		}
+
+		// Callbacks may queue other uploads, they're called once the queue is consistent
+		for (auto& upload : completedUploads)
+		{
+			if (upload->fence)
+				glDeleteSync(upload->fence);
+
+			if (upload->callback)
+				upload->callback(upload->texture, !upload->cancelled);
+		}
+
+		return completedUploads.size();
+	}
+
+	void TextureUploadQueue::Uninitialize()
+	{
+		Clear();
+
+		GetState().ring.reset();
+	}
+}
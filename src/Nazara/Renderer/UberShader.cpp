@@ -12,6 +12,12 @@ namespace Nz
 		OnUberShaderRelease(this);
 	}
 
+	UberShaderInstance* UberShader::TryGet(const ParameterList& parameters) const
+	{
+		// Par défaut, l'instance est construite immédiatement
+		return Get(parameters);
+	}
+
 	bool UberShader::Initialize()
 	{
 		if (!UberShaderLibrary::Initialize())
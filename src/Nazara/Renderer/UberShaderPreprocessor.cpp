@@ -3,11 +3,16 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Renderer/UberShaderPreprocessor.hpp>
+#include <Nazara/Core/AbstractHash.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/Directory.hpp>
 #include <Nazara/Core/ErrorFlags.hpp>
 #include <Nazara/Core/File.hpp>
 #include <Nazara/Core/ParameterList.hpp>
 #include <Nazara/Renderer/OpenGL.hpp>
 #include <algorithm>
+#include <cstring>
+#include <memory>
 #include <Nazara/Renderer/Debug.hpp>
 
 namespace Nz
@@ -19,107 +24,13 @@ namespace Nz
 
 	UberShaderInstance* UberShaderPreprocessor::Get(const ParameterList& parameters) const
 	{
-		// Première étape, transformer les paramètres en un flag
-		UInt32 flags = 0;
-		for (auto it = m_flags.begin(); it != m_flags.end(); ++it)
-		{
-			if (parameters.HasParameter(it->first))
-			{
-				bool value;
-				if (parameters.GetBooleanParameter(it->first, &value) && value)
-					flags |= it->second;
-			}
-		}
-
-		// Le shader fait-il partie du cache ?
-		auto shaderIt = m_cache.find(flags);
-
-		// Si non, il nous faut le construire
-		if (shaderIt == m_cache.end())
-		{
-			try
-			{
-				// Une exception sera lancée à la moindre erreur et celle-ci ne sera pas enregistrée dans le log (car traitée dans le bloc catch)
-				ErrorFlags errFlags(ErrorFlag_Silent | ErrorFlag_ThrowException, true);
-
-				ShaderRef shader = Shader::New();
-				shader->Create();
-
-				for (unsigned int i = 0; i <= ShaderStageType_Max; ++i)
-				{
-					const CachedShader& shaderStage = m_shaders[i];
-
-					// Le shader stage est-il activé dans cette version du shader ?
-					if (shaderStage.present && (flags & shaderStage.requiredFlags) == shaderStage.requiredFlags)
-					{
-						UInt32 stageFlags = 0;
-						for (auto it = shaderStage.flags.begin(); it != shaderStage.flags.end(); ++it)
-						{
-							if (parameters.HasParameter(it->first))
-							{
-								bool value;
-								if (parameters.GetBooleanParameter(it->first, &value) && value)
-									stageFlags |= it->second;
-							}
-						}
-
-						auto stageIt = shaderStage.cache.find(stageFlags);
-						if (stageIt == shaderStage.cache.end())
-						{
-							ShaderStage stage;
-							stage.Create(static_cast<ShaderStageType>(i));
-
-							unsigned int glslVersion = OpenGL::GetGLSLVersion();
-
-							StringStream code;
-							code << "#version " << glslVersion << "\n\n";
-
-							code << "#define GLSL_VERSION " << glslVersion << "\n\n";
-
-							code << "#define EARLY_FRAGMENT_TESTS " << ((glslVersion >= 420 || OpenGL::IsSupported(OpenGLExtension_Shader_ImageLoadStore)) ? '1' : '0') << "\n\n";
-
-							for (auto it = shaderStage.flags.begin(); it != shaderStage.flags.end(); ++it)
-								code << "#define " << it->first << ' ' << ((stageFlags & it->second) ? '1' : '0') << '\n';
-
-							code << "\n#line 1\n"; // Pour que les éventuelles erreurs du shader se réfèrent à la bonne ligne
-							code << shaderStage.source;
-
-							stage.SetSource(code);
-
-							try
-							{
-								stage.Compile();
-							}
-							catch (const std::exception&)
-							{
-								ErrorFlags errFlags2(ErrorFlag_ThrowExceptionDisabled);
-
-								NazaraError("Shader code failed to compile (" + stage.GetLog() + ")\n" + code.ToString());
-								throw;
-							}
-
-							stageIt = shaderStage.cache.emplace(flags, std::move(stage)).first;
-						}
-
-						shader->AttachStage(static_cast<ShaderStageType>(i), stageIt->second);
-					}
-				}
-
-				shader->Link();
-
-				// On construit l'instant
-				shaderIt = m_cache.emplace(flags, shader.Get()).first;
-			}
-			catch (const std::exception&)
-			{
-				ErrorFlags errFlags(ErrorFlag_ThrowExceptionDisabled);
-
-				NazaraError("Failed to build UberShader instance: " + Error::GetLastError());
-				throw;
-			}
-		}
+		return GetInstance(parameters, true);
+	}
 
-		return &shaderIt->second;
+	UberShaderInstance* UberShaderPreprocessor::TryGet(const ParameterList& parameters) const
+	{
+		// Sans KHR_parallel_shader_compile, la compilation bloquerait de toute façon au moment de vérifier son statut
+		return GetInstance(parameters, !OpenGL::IsSupported(OpenGLExtension_ParallelShaderCompile));
 	}
 
 	void UberShaderPreprocessor::SetShader(ShaderStageType stage, const String& source, const String& shaderFlags, const String& requiredFlags)
@@ -132,15 +43,18 @@ namespace Nz
 		std::vector<String> flags;
 		shaderFlags.Split(flags, ' ');
 
-		for (String& flag : flags)
+		for (const String& flag : flags)
 		{
-			auto it = m_flags.find(flag);
+			// Les noms des flags sont internés, les paramètres sont ensuite recherchés par leur hash à chaque instance demandée
+			Name flagName = Name::Intern(flag);
+
+			auto it = m_flags.find(flagName);
 			if (it == m_flags.end())
-				m_flags[flag] = 1U << m_flags.size();
+				m_flags[flagName] = 1U << m_flags.size();
 
-			auto it2 = shader.flags.find(flag);
+			auto it2 = shader.flags.find(flagName);
 			if (it2 == shader.flags.end())
-				shader.flags[flag] = 1U << shader.flags.size();
+				shader.flags[flagName] = 1U << shader.flags.size();
 		}
 
 		// On construit les flags requis pour l'activation du shader
@@ -149,15 +63,16 @@ namespace Nz
 		flags.clear();
 		requiredFlags.Split(flags, ' ');
 
-		for (String& flag : flags)
+		for (const String& flag : flags)
 		{
+			Name flagName = Name::Intern(flag);
 			UInt32 flagVal;
 
-			auto it = m_flags.find(flag);
+			auto it = m_flags.find(flagName);
 			if (it == m_flags.end())
 			{
 				flagVal = 1U << m_flags.size();
-				m_flags[flag] = flagVal;
+				m_flags[flagName] = flagVal;
 			}
 			else
 				flagVal = it->second;
@@ -191,8 +106,260 @@ namespace Nz
 		return true;
 	}
 
+	const String& UberShaderPreprocessor::GetCacheDirectory()
+	{
+		return s_cacheDirectory;
+	}
+
 	bool UberShaderPreprocessor::IsSupported()
 	{
 		return true; // Forcément supporté
 	}
+
+	void UberShaderPreprocessor::SetCacheDirectory(const String& directoryPath)
+	{
+		// Un chemin vide désactive le cache des binaires
+		s_cacheDirectory = directoryPath;
+	}
+
+	String UberShaderPreprocessor::BuildStageCode(const CachedShader& shaderStage, UInt32 stageFlags)
+	{
+		unsigned int glslVersion = OpenGL::GetGLSLVersion();
+
+		StringStream code;
+		code << "#version " << glslVersion << "\n\n";
+
+		code << "#define GLSL_VERSION " << glslVersion << "\n\n";
+
+		code << "#define EARLY_FRAGMENT_TESTS " << ((glslVersion >= 420 || OpenGL::IsSupported(OpenGLExtension_Shader_ImageLoadStore)) ? '1' : '0') << "\n\n";
+
+		for (auto it = shaderStage.flags.begin(); it != shaderStage.flags.end(); ++it)
+			code << "#define " << it->first.GetString() << ' ' << ((stageFlags & it->second) ? '1' : '0') << '\n';
+
+		code << "\n#line 1\n"; // Pour que les éventuelles erreurs du shader se réfèrent à la bonne ligne
+		code << shaderStage.source;
+
+		return code.ToString();
+	}
+
+	UberShaderInstance* UberShaderPreprocessor::FinishInstance(UInt32 flags) const
+	{
+		auto pendingIt = m_pendingInstances.find(flags);
+		NazaraAssert(pendingIt != m_pendingInstances.end(), "Instance is not being built");
+
+		// Qu'elle réussisse ou non, la construction est terminée
+		PendingInstance pending = std::move(pendingIt->second);
+		m_pendingInstances.erase(pendingIt);
+
+		for (ShaderStage* stage : pending.stages)
+		{
+			if (stage->IsCompiled())
+				continue;
+
+			try
+			{
+				stage->Compile();
+			}
+			catch (const std::exception&)
+			{
+				ErrorFlags errFlags(ErrorFlag_ThrowExceptionDisabled);
+
+				NazaraError("Shader code failed to compile (" + stage->GetLog() + ")\n" + stage->GetSource());
+				throw;
+			}
+		}
+
+		if (!pending.shader->IsLinked())
+		{
+			pending.shader->Link();
+
+			if (!pending.cacheFilePath.IsEmpty())
+				SaveCachedBinary(pending.shader, pending.cacheFilePath);
+		}
+
+		// On construit l'instant
+		return &m_cache.emplace(flags, pending.shader.Get()).first->second;
+	}
+
+	UberShaderInstance* UberShaderPreprocessor::GetInstance(const ParameterList& parameters, bool wait) const
+	{
+		// Première étape, transformer les paramètres en un flag
+		UInt32 flags = 0;
+		for (auto it = m_flags.begin(); it != m_flags.end(); ++it)
+		{
+			if (parameters.HasParameter(it->first))
+			{
+				bool value;
+				if (parameters.GetBooleanParameter(it->first, &value) && value)
+					flags |= it->second;
+			}
+		}
+
+		// Le shader fait-il partie du cache ?
+		auto shaderIt = m_cache.find(flags);
+		if (shaderIt != m_cache.end())
+			return &shaderIt->second;
+
+		// Si non, il nous faut le construire
+		try
+		{
+			// Une exception sera lancée à la moindre erreur et celle-ci ne sera pas enregistrée dans le log (car traitée dans le bloc catch)
+			ErrorFlags errFlags(ErrorFlag_Silent | ErrorFlag_ThrowException, true);
+
+			auto pendingIt = m_pendingInstances.find(flags);
+			if (pendingIt == m_pendingInstances.end())
+				pendingIt = m_pendingInstances.emplace(flags, StartInstance(parameters, flags)).first;
+
+			// Le driver compile les stages et lie le programme en tâche de fond, on ne l'attend que si l'appelant le demande
+			if (!wait && pendingIt->second.shader->IsLinking())
+				return nullptr;
+
+			return FinishInstance(flags);
+		}
+		catch (const std::exception&)
+		{
+			ErrorFlags errFlags(ErrorFlag_ThrowExceptionDisabled);
+
+			NazaraError("Failed to build UberShader instance: " + Error::GetLastError());
+			throw;
+		}
+	}
+
+	bool UberShaderPreprocessor::LoadCachedBinary(Shader* shader, const String& filePath)
+	{
+		// Un binaire absent ou refusé par le driver (mis à jour entre temps par exemple) n'est pas une erreur, le shader est alors compilé
+		ErrorFlags errFlags(ErrorFlag_ThrowExceptionDisabled);
+
+		if (!File::Exists(filePath))
+			return false;
+
+		File file(filePath);
+		if (!file.Open(OpenMode_ReadOnly))
+			return false;
+
+		ByteArray binary(static_cast<std::size_t>(file.GetSize()), 0);
+		if (binary.IsEmpty() || file.Read(binary.GetBuffer(), binary.GetSize()) != binary.GetSize())
+			return false;
+
+		if (!shader->LoadFromBinary(binary))
+		{
+			// Le programme a pu être laissé dans un état invalide, on repart d'un programme neuf
+			shader->Destroy();
+			return shader->Create();
+		}
+
+		return true;
+	}
+
+	void UberShaderPreprocessor::SaveCachedBinary(const Shader* shader, const String& filePath)
+	{
+		// Le cache n'est qu'une optimisation, ne pas pouvoir l'écrire ne doit pas empêcher l'utilisation du shader
+		ErrorFlags errFlags(ErrorFlag_ThrowExceptionDisabled);
+
+		ByteArray binary = shader->GetBinary();
+		if (binary.IsEmpty())
+			return;
+
+		if (!Directory::Exists(s_cacheDirectory) && !Directory::Create(s_cacheDirectory, true))
+		{
+			NazaraWarning("Failed to create shader cache directory \"" + s_cacheDirectory + '"');
+			return;
+		}
+
+		File file(filePath);
+		if (!file.Open(OpenMode_WriteOnly | OpenMode_Truncate) || file.Write(binary.GetConstBuffer(), binary.GetSize()) != binary.GetSize())
+			NazaraWarning("Failed to write shader binary to \"" + filePath + '"');
+	}
+
+	UberShaderPreprocessor::PendingInstance UberShaderPreprocessor::StartInstance(const ParameterList& parameters, UInt32 flags) const
+	{
+		PendingInstance pending;
+		pending.shader = Shader::New();
+		pending.shader->Create();
+
+		bool stageEnabled[ShaderStageType_Max + 1];
+		UInt32 stageFlags[ShaderStageType_Max + 1];
+		for (unsigned int i = 0; i <= ShaderStageType_Max; ++i)
+		{
+			const CachedShader& shaderStage = m_shaders[i];
+
+			// Le shader stage est-il activé dans cette version du shader ?
+			stageEnabled[i] = shaderStage.present && (flags & shaderStage.requiredFlags) == shaderStage.requiredFlags;
+			stageFlags[i] = 0;
+
+			if (stageEnabled[i])
+			{
+				for (auto it = shaderStage.flags.begin(); it != shaderStage.flags.end(); ++it)
+				{
+					if (parameters.HasParameter(it->first))
+					{
+						bool value;
+						if (parameters.GetBooleanParameter(it->first, &value) && value)
+							stageFlags[i] |= it->second;
+					}
+				}
+			}
+		}
+
+		// Le binaire du programme a-t-il été sauvegardé par une exécution précédente ?
+		if (!s_cacheDirectory.IsEmpty() && pending.shader->IsBinaryRetrievable())
+		{
+			// La clé couvre le code final de chaque stage (et donc les flags) ainsi que le driver, un binaire n'étant valide que pour celui-ci
+			std::unique_ptr<AbstractHash> hash = AbstractHash::Get(HashType_SHA1);
+			hash->Begin();
+
+			for (GLenum driverString : {GL_VENDOR, GL_RENDERER, GL_VERSION})
+			{
+				const char* str = reinterpret_cast<const char*>(glGetString(driverString));
+				if (str)
+					hash->Append(reinterpret_cast<const UInt8*>(str), std::strlen(str) + 1);
+			}
+
+			for (unsigned int i = 0; i <= ShaderStageType_Max; ++i)
+			{
+				if (stageEnabled[i])
+				{
+					String code = BuildStageCode(m_shaders[i], stageFlags[i]);
+
+					UInt8 stageIndex = static_cast<UInt8>(i);
+					hash->Append(&stageIndex, 1);
+					hash->Append(reinterpret_cast<const UInt8*>(code.GetConstBuffer()), code.GetSize());
+				}
+			}
+
+			pending.cacheFilePath = s_cacheDirectory + NAZARA_DIRECTORY_SEPARATOR + hash->End().ToHex() + ".bin";
+
+			if (LoadCachedBinary(pending.shader, pending.cacheFilePath))
+				return pending;
+		}
+
+		for (unsigned int i = 0; i <= ShaderStageType_Max; ++i)
+		{
+			if (!stageEnabled[i])
+				continue;
+
+			const CachedShader& shaderStage = m_shaders[i];
+
+			auto stageIt = shaderStage.cache.find(stageFlags[i]);
+			if (stageIt == shaderStage.cache.end())
+			{
+				ShaderStage stage;
+				stage.Create(static_cast<ShaderStageType>(i));
+				stage.SetSource(BuildStageCode(shaderStage, stageFlags[i]));
+				stage.CompileAsync();
+
+				stageIt = shaderStage.cache.emplace(stageFlags[i], std::move(stage)).first;
+			}
+
+			pending.shader->AttachStage(static_cast<ShaderStageType>(i), stageIt->second);
+			pending.stages.push_back(&stageIt->second);
+		}
+
+		// Les erreurs de compilation et d'édition des liens ne seront connues qu'à la fin de la construction (voir FinishInstance)
+		pending.shader->LinkAsync();
+
+		return pending;
+	}
+
+	String UberShaderPreprocessor::s_cacheDirectory;
 }
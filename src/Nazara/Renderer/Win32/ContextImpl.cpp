@@ -228,10 +228,15 @@ namespace Nz
 		}
 	}
 
-	void ContextImpl::EnableVerticalSync(bool enabled)
+	void ContextImpl::EnableVerticalSync(bool enabled, bool adaptive)
 	{
+		// A negative interval lets late frames tear instead of waiting for the next vertical blank
+		int interval = (enabled) ? 1 : 0;
+		if (enabled && adaptive && OpenGL::IsSupported("WGL_EXT_swap_control_tear"))
+			interval = -1;
+
 		if (wglSwapInterval)
-			wglSwapInterval(enabled ? 1 : 0);
+			wglSwapInterval(interval);
 		else
 			NazaraError("Vertical sync not supported");
 	}
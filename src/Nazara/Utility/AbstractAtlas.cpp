@@ -3,6 +3,9 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Utility/AbstractAtlas.hpp>
+#include <Nazara/Utility/Image.hpp>
+#include <algorithm>
+#include <vector>
 #include <Nazara/Utility/Debug.hpp>
 
 namespace Nz
@@ -11,4 +14,37 @@ namespace Nz
 	{
 		OnAtlasRelease(this);
 	}
+
+	/*!
+	* \brief Inserts multiple images in the atlas
+	* \return true if every image was inserted
+	*
+	* \param images Images to insert
+	* \param rects Rectangles of the images, updated with their position in the atlas
+	* \param flipped Output flags telling whether each image was flipped
+	* \param layerIndices Output layer index of each image
+	* \param count Number of images
+	*
+	* \remark Images are inserted from the tallest to the shortest, which packs them tighter than their submission order
+	* \remark Insertion stops at the first image which couldn't be inserted
+	*/
+	bool AbstractAtlas::Insert(const Image* images, Rectui* rects, bool* flipped, unsigned int* layerIndices, unsigned int count)
+	{
+		std::vector<unsigned int> order(count);
+		for (unsigned int i = 0; i < count; ++i)
+			order[i] = i;
+
+		std::stable_sort(order.begin(), order.end(), [rects] (unsigned int lhs, unsigned int rhs)
+		{
+			return std::max(rects[lhs].width, rects[lhs].height) > std::max(rects[rhs].width, rects[rhs].height);
+		});
+
+		for (unsigned int index : order)
+		{
+			if (!Insert(images[index], &rects[index], &flipped[index], &layerIndices[index]))
+				return false;
+		}
+
+		return true;
+	}
 }
@@ -26,10 +26,29 @@
  */
 
 #include <Nazara/Utility/Algorithm.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Utility/BufferMapper.hpp>
+#include <Nazara/Utility/IndexBuffer.hpp>
 #include <Nazara/Utility/IndexIterator.hpp>
+#include <Nazara/Utility/IndexMapper.hpp>
 #include <Nazara/Utility/Joint.hpp>
+#include <Nazara/Utility/Utility.hpp>
+#include <Nazara/Utility/VertexBuffer.hpp>
+#include <Nazara/Utility/VertexDeclaration.hpp>
 #include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <type_traits>
 #include <unordered_map>
+#include <vector>
+
+#if defined(NAZARA_SIMD_SSE2)
+	#include <emmintrin.h>
+#elif defined(NAZARA_SIMD_NEON)
+	#include <arm_neon.h>
+#endif
+
 #include <Nazara/Utility/Debug.hpp>
 #include <Nazara/Utility/Mesh.hpp>
 #include <Nazara/Utility/SkeletalMesh.hpp>
@@ -630,6 +649,319 @@ namespace Nz
 				float m_valenceBoostScale;
 				float m_valenceBoostPower;
 		};
+
+		// Sum of the joint matrices of a vertex weighted by their influence, applying it once costs less than transforming the vertex by every joint
+		#if defined(NAZARA_SIMD_SSE2)
+		class BlendedSkinningMatrix
+		{
+			public:
+				BlendedSkinningMatrix(const Joint* joints, const SkeletalMeshVertex& vertex)
+				{
+					for (unsigned int i = 0; i < 4; ++i)
+						m_rows[i] = _mm_setzero_ps();
+
+					for (int i = 0; i < vertex.weightCount; ++i)
+					{
+						const float* matrix = joints[vertex.jointIndexes[i]].GetSkinningMatrix();
+						__m128 weight = _mm_set1_ps(vertex.weights[i]);
+
+						for (unsigned int j = 0; j < 4; ++j)
+							m_rows[j] = _mm_add_ps(m_rows[j], _mm_mul_ps(_mm_loadu_ps(&matrix[j * 4]), weight));
+					}
+				}
+
+				Vector3f TransformDirection(const Vector3f& direction) const
+				{
+					return ToVector3(TransformXYZ(direction));
+				}
+
+				Vector3f TransformPosition(const Vector3f& position) const
+				{
+					return ToVector3(_mm_add_ps(TransformXYZ(position), m_rows[3]));
+				}
+
+			private:
+				__m128 TransformXYZ(const Vector3f& vec) const
+				{
+					__m128 result = _mm_mul_ps(m_rows[0], _mm_set1_ps(vec.x));
+					result = _mm_add_ps(result, _mm_mul_ps(m_rows[1], _mm_set1_ps(vec.y)));
+					return _mm_add_ps(result, _mm_mul_ps(m_rows[2], _mm_set1_ps(vec.z)));
+				}
+
+				static Vector3f ToVector3(__m128 vec)
+				{
+					alignas(16) float result[4];
+					_mm_store_ps(result, vec);
+
+					return Vector3f(result[0], result[1], result[2]);
+				}
+
+				__m128 m_rows[4];
+		};
+		#elif defined(NAZARA_SIMD_NEON)
+		class BlendedSkinningMatrix
+		{
+			public:
+				BlendedSkinningMatrix(const Joint* joints, const SkeletalMeshVertex& vertex)
+				{
+					for (unsigned int i = 0; i < 4; ++i)
+						m_rows[i] = vdupq_n_f32(0.f);
+
+					for (int i = 0; i < vertex.weightCount; ++i)
+					{
+						const float* matrix = joints[vertex.jointIndexes[i]].GetSkinningMatrix();
+						float weight = vertex.weights[i];
+
+						for (unsigned int j = 0; j < 4; ++j)
+							m_rows[j] = vmlaq_n_f32(m_rows[j], vld1q_f32(&matrix[j * 4]), weight);
+					}
+				}
+
+				Vector3f TransformDirection(const Vector3f& direction) const
+				{
+					return ToVector3(TransformXYZ(direction));
+				}
+
+				Vector3f TransformPosition(const Vector3f& position) const
+				{
+					return ToVector3(vaddq_f32(TransformXYZ(position), m_rows[3]));
+				}
+
+			private:
+				float32x4_t TransformXYZ(const Vector3f& vec) const
+				{
+					float32x4_t result = vmulq_n_f32(m_rows[0], vec.x);
+					result = vmlaq_n_f32(result, m_rows[1], vec.y);
+					return vmlaq_n_f32(result, m_rows[2], vec.z);
+				}
+
+				static Vector3f ToVector3(float32x4_t vec)
+				{
+					return Vector3f(vgetq_lane_f32(vec, 0), vgetq_lane_f32(vec, 1), vgetq_lane_f32(vec, 2));
+				}
+
+				float32x4_t m_rows[4];
+		};
+		#else
+		class BlendedSkinningMatrix
+		{
+			public:
+				BlendedSkinningMatrix(const Joint* joints, const SkeletalMeshVertex& vertex)
+				{
+					std::fill(std::begin(m_matrix), std::end(m_matrix), 0.f);
+
+					for (int i = 0; i < vertex.weightCount; ++i)
+					{
+						const float* matrix = joints[vertex.jointIndexes[i]].GetSkinningMatrix();
+						float weight = vertex.weights[i];
+
+						for (unsigned int j = 0; j < 16; ++j)
+							m_matrix[j] += matrix[j] * weight;
+					}
+				}
+
+				Vector3f TransformDirection(const Vector3f& direction) const
+				{
+					return Vector3f(m_matrix[0] * direction.x + m_matrix[4] * direction.y + m_matrix[8] * direction.z,
+					                m_matrix[1] * direction.x + m_matrix[5] * direction.y + m_matrix[9] * direction.z,
+					                m_matrix[2] * direction.x + m_matrix[6] * direction.y + m_matrix[10] * direction.z);
+				}
+
+				Vector3f TransformPosition(const Vector3f& position) const
+				{
+					return TransformDirection(position) + Vector3f(m_matrix[12], m_matrix[13], m_matrix[14]);
+				}
+
+			private:
+				float m_matrix[16];
+		};
+		#endif
+
+		// Frustum planes stored as four lanes per component (the sixth plane being repeated in the last two lanes), to test a sphere against four planes at once
+		#if defined(NAZARA_SIMD_SSE2)
+		class LocalFrustum
+		{
+			public:
+				LocalFrustum(const float (&planes)[4][8])
+				{
+					for (unsigned int i = 0; i < 4; ++i)
+					{
+						m_planes[i][0] = _mm_loadu_ps(&planes[i][0]);
+						m_planes[i][1] = _mm_loadu_ps(&planes[i][4]);
+					}
+				}
+
+				bool Contains(const Spheref& sphere) const
+				{
+					__m128 x = _mm_set1_ps(sphere.x);
+					__m128 y = _mm_set1_ps(sphere.y);
+					__m128 z = _mm_set1_ps(sphere.z);
+					__m128 negativeRadius = _mm_set1_ps(-sphere.radius);
+
+					__m128 outside = _mm_setzero_ps();
+					for (unsigned int i = 0; i < 2; ++i)
+					{
+						__m128 distance = _mm_mul_ps(m_planes[0][i], x);
+						distance = _mm_add_ps(distance, _mm_mul_ps(m_planes[1][i], y));
+						distance = _mm_add_ps(distance, _mm_mul_ps(m_planes[2][i], z));
+						distance = _mm_sub_ps(distance, m_planes[3][i]);
+
+						outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, negativeRadius));
+					}
+
+					return _mm_movemask_ps(outside) == 0;
+				}
+
+			private:
+				__m128 m_planes[4][2];
+		};
+		#elif defined(NAZARA_SIMD_NEON)
+		class LocalFrustum
+		{
+			public:
+				LocalFrustum(const float (&planes)[4][8])
+				{
+					for (unsigned int i = 0; i < 4; ++i)
+					{
+						m_planes[i][0] = vld1q_f32(&planes[i][0]);
+						m_planes[i][1] = vld1q_f32(&planes[i][4]);
+					}
+				}
+
+				bool Contains(const Spheref& sphere) const
+				{
+					float32x4_t negativeRadius = vdupq_n_f32(-sphere.radius);
+
+					uint32x4_t outside = vdupq_n_u32(0);
+					for (unsigned int i = 0; i < 2; ++i)
+					{
+						float32x4_t distance = vmulq_n_f32(m_planes[0][i], sphere.x);
+						distance = vmlaq_n_f32(distance, m_planes[1][i], sphere.y);
+						distance = vmlaq_n_f32(distance, m_planes[2][i], sphere.z);
+						distance = vsubq_f32(distance, m_planes[3][i]);
+
+						outside = vorrq_u32(outside, vcltq_f32(distance, negativeRadius));
+					}
+
+					uint32x2_t folded = vorr_u32(vget_low_u32(outside), vget_high_u32(outside));
+					return (vget_lane_u32(folded, 0) | vget_lane_u32(folded, 1)) == 0;
+				}
+
+			private:
+				float32x4_t m_planes[4][2];
+		};
+		#else
+		class LocalFrustum
+		{
+			public:
+				LocalFrustum(const float (&planes)[4][8])
+				{
+					std::memcpy(m_planes, planes, sizeof(m_planes));
+				}
+
+				bool Contains(const Spheref& sphere) const
+				{
+					for (unsigned int i = 0; i <= FrustumPlane_Max; ++i)
+					{
+						float distance = m_planes[0][i] * sphere.x + m_planes[1][i] * sphere.y + m_planes[2][i] * sphere.z - m_planes[3][i];
+						if (distance < -sphere.radius)
+							return false;
+					}
+
+					return true;
+				}
+
+			private:
+				float m_planes[4][8];
+		};
+		#endif
+
+		// Minimum and maximum of a range of positions
+		using PositionBounds = std::pair<Vector3f, Vector3f>;
+
+		PositionBounds ComputePositionBounds(SparsePtr<const Vector3f> positionPtr, std::size_t first, std::size_t last)
+		{
+			PositionBounds bounds;
+
+			#if defined(NAZARA_SIMD_SSE2) || defined(NAZARA_SIMD_NEON)
+			// Every position but the last one of the buffer is followed by at least four bytes, it can be loaded with its fourth lane left unused
+			const Vector3f& lastPosition = positionPtr[last - 1];
+			std::size_t vectorEnd = last - 1;
+
+			#if defined(NAZARA_SIMD_SSE2)
+			__m128 minimum = _mm_set_ps(0.f, lastPosition.z, lastPosition.y, lastPosition.x);
+			__m128 maximum = minimum;
+
+			for (std::size_t i = first; i < vectorEnd; ++i)
+			{
+				__m128 position = _mm_loadu_ps(&positionPtr[i].x);
+				minimum = _mm_min_ps(minimum, position);
+				maximum = _mm_max_ps(maximum, position);
+			}
+
+			alignas(16) float result[4];
+			_mm_store_ps(result, minimum);
+			bounds.first.Set(result[0], result[1], result[2]);
+
+			_mm_store_ps(result, maximum);
+			bounds.second.Set(result[0], result[1], result[2]);
+			#else
+			float lastValues[4] = {lastPosition.x, lastPosition.y, lastPosition.z, 0.f};
+			float32x4_t minimum = vld1q_f32(lastValues);
+			float32x4_t maximum = minimum;
+
+			for (std::size_t i = first; i < vectorEnd; ++i)
+			{
+				float32x4_t position = vld1q_f32(&positionPtr[i].x);
+				minimum = vminq_f32(minimum, position);
+				maximum = vmaxq_f32(maximum, position);
+			}
+
+			float result[4];
+			vst1q_f32(result, minimum);
+			bounds.first.Set(result[0], result[1], result[2]);
+
+			vst1q_f32(result, maximum);
+			bounds.second.Set(result[0], result[1], result[2]);
+			#endif
+			#else
+			bounds.first = positionPtr[first];
+			bounds.second = bounds.first;
+
+			for (std::size_t i = first + 1; i < last; ++i)
+			{
+				const Vector3f& position = positionPtr[i];
+				bounds.first.Minimize(position);
+				bounds.second.Maximize(position);
+			}
+			#endif
+
+			return bounds;
+		}
+
+		template<bool SkinNormal, bool SkinTangent>
+		void SkinVertices(const SkinningData& skinningInfos, unsigned int startVertex, unsigned int vertexCount)
+		{
+			const SkeletalMeshVertex* inputVertex = &skinningInfos.inputVertex[startVertex];
+			MeshVertex* outputVertex = &skinningInfos.outputVertex[startVertex];
+
+			for (unsigned int i = 0; i < vertexCount; ++i)
+			{
+				BlendedSkinningMatrix matrix(skinningInfos.joints, *inputVertex);
+
+				outputVertex->position = matrix.TransformPosition(inputVertex->position);
+				outputVertex->uv = inputVertex->uv;
+
+				if (SkinNormal)
+					outputVertex->normal = Vector3f::Normalize(matrix.TransformDirection(inputVertex->normal));
+
+				if (SkinTangent)
+					outputVertex->tangent = Vector3f::Normalize(matrix.TransformDirection(inputVertex->tangent));
+
+				inputVertex++;
+				outputVertex++;
+			}
+		}
 	}
 
 	/**********************************Compute**********************************/
@@ -637,17 +969,29 @@ namespace Nz
 	Boxf ComputeAABB(SparsePtr<const Vector3f> positionPtr, unsigned int vertexCount)
 	{
 		Boxf aabb;
-		if (vertexCount > 0)
+		if (vertexCount == 0)
 		{
-			aabb.Set(positionPtr->x, positionPtr->y, positionPtr->z, 0.f, 0.f, 0.f);
-			++positionPtr;
-
-			for (unsigned int i = 1; i < vertexCount; ++i)
-				aabb.ExtendTo(*positionPtr++);
-		}
-		else
 			aabb.MakeZero();
+			return aabb;
+		}
+
+		constexpr std::size_t MinGrainSize = 64 * 1024;
+
+		std::size_t grainSize = std::max<std::size_t>(vertexCount / (TaskScheduler::GetWorkerCount() * 4), MinGrainSize);
+		Vector3f infinity(std::numeric_limits<float>::infinity());
 
+		PositionBounds bounds = TaskScheduler::ParallelReduce(0, vertexCount, grainSize, PositionBounds(infinity, -infinity), [&](std::size_t first, std::size_t last)
+		{
+			return ComputePositionBounds(positionPtr, first, last);
+		},
+		[](PositionBounds left, const PositionBounds& right)
+		{
+			left.first.Minimize(right.first);
+			left.second.Maximize(right.second);
+			return left;
+		});
+
+		aabb.Set(bounds.first, bounds.second);
 		return aabb;
 	}
 
@@ -720,6 +1064,27 @@ namespace Nz
 			*vertexCount = horizontalVertexCount*verticalVertexCount;
 	}
 
+	void ComputeSkinningDualQuaternions(const Joint* joints, unsigned int jointCount, SkinningDualQuaternion* dualQuaternions)
+	{
+		for (unsigned int i = 0; i < jointCount; ++i)
+		{
+			const Matrix4f& skinningMatrix = joints[i].GetSkinningMatrix();
+
+			// Dual quaternions can't represent a scale, the rotation is normalized to get rid of an uniform one
+			Quaternionf rotation = skinningMatrix.GetRotation().GetNormal();
+			Vector3f translation = skinningMatrix.GetTranslation();
+
+			SkinningDualQuaternion& dualQuaternion = dualQuaternions[i];
+			dualQuaternion.real = rotation;
+
+			// dual = 0.5 * translation * real
+			dualQuaternion.dual.w = -0.5f * (translation.x * rotation.x + translation.y * rotation.y + translation.z * rotation.z);
+			dualQuaternion.dual.x =  0.5f * (translation.x * rotation.w + translation.y * rotation.z - translation.z * rotation.y);
+			dualQuaternion.dual.y =  0.5f * (translation.y * rotation.w + translation.z * rotation.x - translation.x * rotation.z);
+			dualQuaternion.dual.z =  0.5f * (translation.z * rotation.w + translation.x * rotation.y - translation.y * rotation.x);
+		}
+	}
+
 	void ComputeUvSphereIndexVertexCount(unsigned int sliceCount, unsigned int stackCount, unsigned int* indexCount, unsigned int* vertexCount)
 	{
 		if (indexCount)
@@ -1045,6 +1410,409 @@ namespace Nz
 		}
 	}
 
+	/**********************************Convert**********************************/
+
+	void ConvertVertices(VertexBuffer* vertexBuffer, const VertexDeclaration* declaration)
+	{
+		NazaraAssert(vertexBuffer && vertexBuffer->IsValid(), "Invalid vertex buffer");
+		NazaraAssert(declaration, "Invalid vertex declaration");
+
+		// Components missing from the source declaration are zeroed
+		const VertexDeclaration* sourceDeclaration = vertexBuffer->GetVertexDeclaration();
+		if (sourceDeclaration == declaration)
+			return;
+
+		UInt32 vertexCount = vertexBuffer->GetVertexCount();
+		std::size_t sourceStride = sourceDeclaration->GetStride();
+		std::size_t stride = declaration->GetStride();
+
+		std::vector<UInt8> vertices(vertexCount * stride, 0);
+		{
+			BufferMapper<VertexBuffer> vertexMapper(vertexBuffer, BufferAccess_ReadOnly);
+			const UInt8* sourceVertices = static_cast<const UInt8*>(vertexMapper.GetPointer());
+
+			for (unsigned int i = 0; i <= VertexComponent_Max; ++i)
+			{
+				VertexComponent component = static_cast<VertexComponent>(i);
+
+				bool enabled;
+				ComponentType type;
+				std::size_t offset;
+				declaration->GetComponent(component, &enabled, &type, &offset);
+
+				bool sourceEnabled;
+				ComponentType sourceType;
+				std::size_t sourceOffset;
+				sourceDeclaration->GetComponent(component, &sourceEnabled, &sourceType, &sourceOffset);
+
+				if (!enabled || !sourceEnabled)
+					continue;
+
+				const UInt8* source = sourceVertices + sourceOffset;
+				UInt8* destination = vertices.data() + offset;
+				if (type == sourceType)
+				{
+					std::size_t componentStride = Utility::ComponentStride[type];
+					for (UInt32 j = 0; j < vertexCount; ++j)
+						std::memcpy(&destination[j * stride], &source[j * sourceStride], componentStride);
+				}
+				else
+				{
+					for (UInt32 j = 0; j < vertexCount; ++j)
+						EncodeComponent(&destination[j * stride], type, DecodeComponent(&source[j * sourceStride], sourceType));
+				}
+			}
+		}
+
+		const BufferRef& buffer = vertexBuffer->GetBuffer();
+		DataStorage storage = buffer->GetStorage();
+		BufferUsageFlags usage = buffer->GetUsage();
+
+		vertexBuffer->Reset(declaration, vertexCount, storage, usage);
+		vertexBuffer->Fill(vertices.data(), 0, vertexCount);
+	}
+
+	Vector4f DecodeComponent(const void* data, ComponentType type)
+	{
+		NazaraAssert(data, "Invalid data");
+
+		// Missing coordinates are completed like the vertex fetch does, normalized types are decoded to [0;1] (or [-1;1])
+		const UInt8* ptr = static_cast<const UInt8*>(data);
+		Vector4f value(0.f, 0.f, 0.f, 1.f);
+
+		auto Decode = [&] (auto* components, unsigned int count)
+		{
+			for (unsigned int i = 0; i < count; ++i)
+			{
+				std::remove_pointer_t<decltype(components)> component;
+				std::memcpy(&component, ptr + i * sizeof(component), sizeof(component));
+
+				value[i] = static_cast<float>(component);
+			}
+		};
+
+		switch (type)
+		{
+			case ComponentType_Color:
+				for (unsigned int i = 0; i < 4; ++i)
+					value[i] = ptr[i] / 255.f;
+				break;
+
+			case ComponentType_Double1:
+			case ComponentType_Double2:
+			case ComponentType_Double3:
+			case ComponentType_Double4:
+				Decode(static_cast<double*>(nullptr), Utility::ComponentCount[type]);
+				break;
+
+			case ComponentType_Float1:
+			case ComponentType_Float2:
+			case ComponentType_Float3:
+			case ComponentType_Float4:
+			case ComponentType_Quaternion:
+				Decode(static_cast<float*>(nullptr), Utility::ComponentCount[type]);
+				break;
+
+			case ComponentType_Half2:
+			case ComponentType_Half4:
+				for (unsigned int i = 0; i < Utility::ComponentCount[type]; ++i)
+				{
+					UInt16 component;
+					std::memcpy(&component, ptr + i * sizeof(UInt16), sizeof(UInt16));
+
+					value[i] = UnpackHalf(component);
+				}
+				break;
+
+			case ComponentType_Int1:
+			case ComponentType_Int2:
+			case ComponentType_Int3:
+			case ComponentType_Int4:
+				Decode(static_cast<Int32*>(nullptr), Utility::ComponentCount[type]);
+				break;
+
+			case ComponentType_PackedNormal:
+			{
+				UInt32 component;
+				std::memcpy(&component, ptr, sizeof(UInt32));
+
+				value = UnpackNormal(component);
+				break;
+			}
+
+			case ComponentType_UShortNorm2:
+				for (unsigned int i = 0; i < 2; ++i)
+				{
+					UInt16 component;
+					std::memcpy(&component, ptr + i * sizeof(UInt16), sizeof(UInt16));
+
+					value[i] = UnpackUShortNorm(component);
+				}
+				break;
+		}
+
+		return value;
+	}
+
+	void EncodeComponent(void* data, ComponentType type, const Vector4f& value)
+	{
+		NazaraAssert(data, "Invalid data");
+
+		UInt8* ptr = static_cast<UInt8*>(data);
+
+		auto Encode = [&] (auto* components, unsigned int count)
+		{
+			for (unsigned int i = 0; i < count; ++i)
+			{
+				std::remove_pointer_t<decltype(components)> component = static_cast<std::remove_pointer_t<decltype(components)>>(value[i]);
+				std::memcpy(ptr + i * sizeof(component), &component, sizeof(component));
+			}
+		};
+
+		switch (type)
+		{
+			case ComponentType_Color:
+				for (unsigned int i = 0; i < 4; ++i)
+					ptr[i] = static_cast<UInt8>(Clamp(value[i], 0.f, 1.f) * 255.f + 0.5f);
+				break;
+
+			case ComponentType_Double1:
+			case ComponentType_Double2:
+			case ComponentType_Double3:
+			case ComponentType_Double4:
+				Encode(static_cast<double*>(nullptr), Utility::ComponentCount[type]);
+				break;
+
+			case ComponentType_Float1:
+			case ComponentType_Float2:
+			case ComponentType_Float3:
+			case ComponentType_Float4:
+			case ComponentType_Quaternion:
+				Encode(static_cast<float*>(nullptr), Utility::ComponentCount[type]);
+				break;
+
+			case ComponentType_Half2:
+			case ComponentType_Half4:
+				for (unsigned int i = 0; i < Utility::ComponentCount[type]; ++i)
+				{
+					UInt16 component = PackHalf(value[i]);
+					std::memcpy(ptr + i * sizeof(UInt16), &component, sizeof(UInt16));
+				}
+				break;
+
+			case ComponentType_Int1:
+			case ComponentType_Int2:
+			case ComponentType_Int3:
+			case ComponentType_Int4:
+				Encode(static_cast<Int32*>(nullptr), Utility::ComponentCount[type]);
+				break;
+
+			case ComponentType_PackedNormal:
+			{
+				UInt32 component = PackNormal(value);
+				std::memcpy(ptr, &component, sizeof(UInt32));
+				break;
+			}
+
+			case ComponentType_UShortNorm2:
+				for (unsigned int i = 0; i < 2; ++i)
+				{
+					UInt16 component = PackUShortNorm(value[i]);
+					std::memcpy(ptr + i * sizeof(UInt16), &component, sizeof(UInt16));
+				}
+				break;
+		}
+	}
+
+	/**********************************Meshlet**********************************/
+
+	void BuildMeshlets(IndexIterator indices, unsigned int indexCount, SparsePtr<const Vector3f> positionPtr, std::vector<Meshlet>* meshlets, unsigned int maxTriangles, unsigned int maxVertices)
+	{
+		NazaraAssert(indexCount % 3 == 0, "Index count must be a multiple of three");
+		NazaraAssert(meshlets, "Invalid meshlets");
+		NazaraAssert(maxTriangles > 0, "Invalid triangle count");
+		NazaraAssert(maxVertices >= 3, "Invalid vertex count");
+
+		meshlets->clear();
+		if (indexCount == 0)
+			return;
+
+		UInt32 vertexCount = 0;
+		for (unsigned int i = 0; i < indexCount; ++i)
+			vertexCount = std::max<UInt32>(vertexCount, indices[i] + 1);
+
+		// Identifier (plus one) of the last meshlet using each vertex, sparing a lookup in the vertices of the current meshlet
+		std::vector<UInt32> vertexMeshlets(vertexCount, 0);
+		std::vector<UInt32> meshletVertices;
+		meshletVertices.reserve(maxVertices);
+
+		std::vector<Vector3f> triangleNormals;
+		triangleNormals.reserve(maxTriangles);
+
+		auto AddMeshlet = [&](UInt32 firstIndex, UInt32 lastIndex)
+		{
+			Meshlet meshlet;
+			meshlet.firstIndex = firstIndex;
+			meshlet.indexCount = lastIndex - firstIndex;
+
+			Vector3f minimum = positionPtr[meshletVertices.front()];
+			Vector3f maximum = minimum;
+			for (UInt32 vertex : meshletVertices)
+			{
+				minimum.Minimize(positionPtr[vertex]);
+				maximum.Maximize(positionPtr[vertex]);
+			}
+
+			Vector3f center = (minimum + maximum) * 0.5f;
+
+			float squaredRadius = 0.f;
+			for (UInt32 vertex : meshletVertices)
+				squaredRadius = std::max(squaredRadius, center.SquaredDistance(positionPtr[vertex]));
+
+			meshlet.boundingSphere.Set(center, std::sqrt(squaredRadius));
+
+			// The normal cone encloses the normals of every (non-degenerate) triangle of the meshlet
+			triangleNormals.clear();
+
+			Vector3f axis = Vector3f::Zero();
+			for (UInt32 i = firstIndex; i < lastIndex; i += 3)
+			{
+				const Vector3f& a = positionPtr[indices[i]];
+				Vector3f normal = (positionPtr[indices[i + 1]] - a).CrossProduct(positionPtr[indices[i + 2]] - a);
+
+				float length = normal.GetLength();
+				if (length > std::numeric_limits<float>::epsilon())
+				{
+					normal /= length;
+					axis += normal;
+
+					triangleNormals.push_back(normal);
+				}
+			}
+
+			meshlet.coneAxis = Vector3f::UnitZ();
+			meshlet.coneCutoff = 1.f;
+
+			float axisLength = axis.GetLength();
+			if (axisLength > std::numeric_limits<float>::epsilon())
+			{
+				axis /= axisLength;
+
+				float minDot = 1.f;
+				for (const Vector3f& normal : triangleNormals)
+					minDot = std::min(minDot, normal.DotProduct(axis));
+
+				meshlet.coneAxis = axis;
+
+				// A cone wider than an hemisphere contains triangles facing opposite directions
+				if (minDot > 0.f)
+					meshlet.coneCutoff = std::sqrt(1.f - minDot * minDot);
+			}
+
+			meshlets->push_back(meshlet);
+		};
+
+		// The triangles are grouped following the index order, which OptimizeIndices and OptimizeOverdraw keep spatially coherent
+		UInt32 firstIndex = 0;
+		for (UInt32 i = 0; i < indexCount; i += 3)
+		{
+			UInt32 meshletId = static_cast<UInt32>(meshlets->size() + 1);
+
+			UInt32 newVertexCount = 0;
+			for (UInt32 j = 0; j < 3; ++j)
+			{
+				if (vertexMeshlets[indices[i + j]] != meshletId)
+					newVertexCount++;
+			}
+
+			if ((i - firstIndex) / 3 >= maxTriangles || meshletVertices.size() + newVertexCount > maxVertices)
+			{
+				AddMeshlet(firstIndex, i);
+
+				firstIndex = i;
+				meshletId++;
+				meshletVertices.clear();
+			}
+
+			for (UInt32 j = 0; j < 3; ++j)
+			{
+				UInt32 index = indices[i + j];
+				if (vertexMeshlets[index] != meshletId)
+				{
+					vertexMeshlets[index] = meshletId;
+					meshletVertices.push_back(index);
+				}
+			}
+		}
+
+		AddMeshlet(firstIndex, indexCount);
+	}
+
+	std::size_t CullMeshlets(const Meshlet* meshlets, std::size_t meshletCount, const Matrix4f& worldMatrix, const Frustumf& frustum, const Vector3f& eyePosition, bool backFaceCulling, UInt32* visibleMeshlets)
+	{
+		NazaraAssert(meshlets || meshletCount == 0, "Invalid meshlets");
+		NazaraAssert(visibleMeshlets || meshletCount == 0, "Invalid visible meshlets");
+
+		// The frustum and the eye are brought to the space of the mesh rather than moving every meshlet to the world,
+		// an affine transformation keeping the intersections of the spheres with the planes and the side of the triangles facing the eye
+		Matrix4f inverseMatrix;
+		if (!worldMatrix.GetInverseAffine(&inverseMatrix))
+		{
+			for (std::size_t i = 0; i < meshletCount; ++i)
+				visibleMeshlets[i] = static_cast<UInt32>(i);
+
+			return meshletCount;
+		}
+
+		const Matrix4f& m = worldMatrix;
+
+		float planes[4][8];
+		for (unsigned int i = 0; i < 8; ++i)
+		{
+			const Planef& plane = frustum.GetPlane(static_cast<FrustumPlane>(std::min<unsigned int>(i, FrustumPlane_Max)));
+			const Vector3f& n = plane.normal;
+			float w = -plane.distance;
+
+			Vector3f normal(m.m11 * n.x + m.m12 * n.y + m.m13 * n.z + m.m14 * w,
+			                m.m21 * n.x + m.m22 * n.y + m.m23 * n.z + m.m24 * w,
+			                m.m31 * n.x + m.m32 * n.y + m.m33 * n.z + m.m34 * w);
+
+			float distance = -(m.m41 * n.x + m.m42 * n.y + m.m43 * n.z + m.m44 * w);
+
+			// Normalized planes give distances in the units of the mesh, comparable to the radius of the meshlets
+			float length = normal.GetLength();
+			planes[0][i] = normal.x / length;
+			planes[1][i] = normal.y / length;
+			planes[2][i] = normal.z / length;
+			planes[3][i] = distance / length;
+		}
+
+		LocalFrustum localFrustum(planes);
+		Vector3f localEye = inverseMatrix.Transform(eyePosition);
+
+		// A mirroring transformation reverses the winding of the triangles, their back faces being on the side of their normals
+		float coneSign = (worldMatrix.GetDeterminantAffine() < 0.f) ? -1.f : 1.f;
+
+		std::size_t visibleCount = 0;
+		for (std::size_t i = 0; i < meshletCount; ++i)
+		{
+			const Meshlet& meshlet = meshlets[i];
+			if (!localFrustum.Contains(meshlet.boundingSphere))
+				continue;
+
+			if (backFaceCulling && meshlet.coneCutoff < 1.f)
+			{
+				Vector3f eyeToCenter = meshlet.boundingSphere.GetPosition() - localEye;
+				if (coneSign * eyeToCenter.DotProduct(meshlet.coneAxis) >= meshlet.coneCutoff * eyeToCenter.GetLength() + meshlet.boundingSphere.radius)
+					continue;
+			}
+
+			visibleMeshlets[visibleCount++] = static_cast<UInt32>(i);
+		}
+
+		return visibleCount;
+	}
+
 	/**********************************Optimize*********************************/
 
 	void OptimizeIndices(IndexIterator indices, unsigned int indexCount)
@@ -1054,93 +1822,411 @@ namespace Nz
 			NazaraWarning("Indices optimizer failed");
 	}
 
-	/************************************Skin***********************************/
-
-	void SkinPosition(const SkinningData& skinningInfos, unsigned int startVertex, unsigned int vertexCount)
+	void OptimizeMesh(VertexBuffer* vertexBuffer, IndexBuffer* indexBuffer, const MeshParams& params)
 	{
-		const SkeletalMeshVertex* inputVertex = &skinningInfos.inputVertex[startVertex];
-		MeshVertex* outputVertex = &skinningInfos.outputVertex[startVertex];
+		NazaraAssert(vertexBuffer && vertexBuffer->IsValid(), "Invalid vertex buffer");
+		NazaraAssert(indexBuffer && indexBuffer->IsValid(), "Invalid index buffer");
+
+		bool remapVertices = (params.optimizeVertexFetch || params.weldVertices);
+		if (!remapVertices && !params.optimizeIndexBuffers && !params.optimizeOverdraw)
+			return;
+
+		IndexMapper indexMapper(indexBuffer);
+		unsigned int indexCount = static_cast<unsigned int>(indexMapper.GetIndexCount());
+		if (indexCount == 0)
+			return;
+
+		if (!remapVertices && !params.optimizeOverdraw)
+		{
+			OptimizeIndices(indexMapper.begin(), indexCount);
+			return;
+		}
+
+		// The vertices are processed in system memory, as reading them one by one from a hardware buffer would be slow
+		unsigned int vertexCount = vertexBuffer->GetVertexCount();
+		unsigned int vertexStride = vertexBuffer->GetStride();
+
+		std::vector<UInt8> vertices(vertexCount * vertexStride);
+		{
+			BufferMapper<VertexBuffer> vertexMapper(vertexBuffer, BufferAccess_ReadOnly);
+			std::memcpy(vertices.data(), vertexMapper.GetPointer(), vertices.size());
+		}
+
+		if (params.weldVertices)
+			vertexCount = WeldVertices(vertices.data(), vertexStride, vertexCount, indexMapper.begin(), indexCount);
+
+		if (params.optimizeIndexBuffers)
+			OptimizeIndices(indexMapper.begin(), indexCount);
 
-		unsigned int endVertex = startVertex + vertexCount - 1;
-		for (unsigned int i = startVertex; i <= endVertex; ++i)
+		if (params.optimizeOverdraw)
 		{
-			Vector3f finalPosition(Vector3f::Zero());
+			bool enabled;
+			ComponentType type;
+			std::size_t offset;
+			vertexBuffer->GetVertexDeclaration()->GetComponent(VertexComponent_Position, &enabled, &type, &offset);
+
+			if (enabled && type == ComponentType_Float3)
+				OptimizeOverdraw(indexMapper.begin(), indexCount, SparsePtr<const Vector3f>(&vertices[offset], std::size_t(vertexStride)));
+			else
+				NazaraWarning("Overdraw optimization requires a Vector3f position component");
+		}
+
+		if (params.optimizeVertexFetch)
+			vertexCount = OptimizeVertexFetch(vertices.data(), vertexStride, vertexCount, indexMapper.begin(), indexCount);
 
-			for (int j = 0; j < inputVertex->weightCount; ++j)
+		indexMapper.Unmap();
+
+		if (remapVertices)
+		{
+			// Welded or unreferenced vertices were removed, the vertex buffer is shrunk accordingly
+			if (vertexCount != vertexBuffer->GetVertexCount())
 			{
-				Matrix4f mat(skinningInfos.joints[inputVertex->jointIndexes[j]].GetSkinningMatrix());
-				mat *= inputVertex->weights[j];
+				const BufferRef& buffer = vertexBuffer->GetBuffer();
+				DataStorage storage = buffer->GetStorage();
+				BufferUsageFlags usage = buffer->GetUsage();
 
-				finalPosition += mat.Transform(inputVertex->position);
+				vertexBuffer->Reset(vertexBuffer->GetVertexDeclaration(), vertexCount, storage, usage);
 			}
 
-			outputVertex->position = finalPosition;
-			outputVertex->uv = inputVertex->uv;
-
-			inputVertex++;
-			outputVertex++;
+			vertexBuffer->Fill(vertices.data(), 0, vertexCount);
 		}
 	}
 
-	void SkinPositionNormal(const SkinningData& skinningInfos, unsigned int startVertex, unsigned int vertexCount)
+	void OptimizeOverdraw(IndexIterator indices, unsigned int indexCount, SparsePtr<const Vector3f> positionPtr, float threshold)
 	{
-		const SkeletalMeshVertex* inputVertex = &skinningInfos.inputVertex[startVertex];
-		MeshVertex* outputVertex = &skinningInfos.outputVertex[startVertex];
+		// Based on "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw" (Sander, Nehab and Barczak)
+		// The triangles, which should already be ordered for the vertex cache, are split into clusters which are then sorted
+		// so that the ones facing away from the center of the mesh are drawn first, and will hide the others
+		unsigned int triangleCount = indexCount / 3;
+		if (triangleCount < 2)
+			return;
+
+		std::vector<UInt32> triangles(triangleCount * 3);
+		UInt32 vertexCount = 0;
+		for (unsigned int i = 0; i < triangles.size(); ++i)
+		{
+			triangles[i] = indices[i];
+			vertexCount = std::max(vertexCount, triangles[i] + 1);
+		}
+
+		// Simulates a FIFO post-transform cache, a vertex being in it if it was added less than CacheSize misses ago
+		constexpr UInt32 CacheSize = 16;
+
+		std::vector<UInt32> cacheTimestamps(vertexCount, 0);
+		UInt32 timestamp = CacheSize + 1;
 
-		unsigned int endVertex = startVertex + vertexCount - 1;
-		for (unsigned int i = startVertex; i <= endVertex; ++i)
+		auto ProcessTriangle = [&] (unsigned int triangle) -> unsigned int
 		{
-			Vector3f finalPosition(Vector3f::Zero());
-			Vector3f finalNormal(Vector3f::Zero());
+			unsigned int missCount = 0;
+			for (unsigned int i = 0; i < 3; ++i)
+			{
+				UInt32 vertex = triangles[triangle * 3 + i];
+				if (timestamp - cacheTimestamps[vertex] > CacheSize)
+				{
+					cacheTimestamps[vertex] = timestamp++;
+					missCount++;
+				}
+			}
+
+			return missCount;
+		};
+
+		// Hard boundaries: a triangle whose vertices all miss the cache can begin a cluster without any additional miss
+		std::vector<unsigned int> hardClusters;
+		unsigned int totalMissCount = 0;
+		for (unsigned int i = 0; i < triangleCount; ++i)
+		{
+			unsigned int missCount = ProcessTriangle(i);
+			if (i == 0 || missCount == 3)
+				hardClusters.push_back(i);
+
+			totalMissCount += missCount;
+		}
+
+		// Soft boundaries: a cluster is split once its own ACMR is low enough, trading a few misses for more clusters to sort
+		float maxClusterAcmr = threshold * totalMissCount / triangleCount;
+
+		std::vector<unsigned int> clusters;
+		clusters.reserve(hardClusters.size());
+
+		for (std::size_t i = 0; i < hardClusters.size(); ++i)
+		{
+			unsigned int clusterStart = hardClusters[i];
+			unsigned int clusterEnd = (i + 1 < hardClusters.size()) ? hardClusters[i + 1] : triangleCount;
+
+			clusters.push_back(clusterStart);
+			timestamp += CacheSize + 1; //< Flushes the cache
 
-			for (int j = 0; j < inputVertex->weightCount; ++j)
+			unsigned int clusterMissCount = 0;
+			for (unsigned int j = clusterStart; j < clusterEnd; ++j)
 			{
-				Matrix4f mat(skinningInfos.joints[inputVertex->jointIndexes[j]].GetSkinningMatrix());
-				mat *= inputVertex->weights[j];
+				clusterMissCount += ProcessTriangle(j);
 
-				finalPosition += mat.Transform(inputVertex->position);
-				finalNormal += mat.Transform(inputVertex->normal, 0.f);
+				if (j + 1 < clusterEnd && clusterMissCount <= maxClusterAcmr * (j + 1 - clusterStart))
+				{
+					clusterStart = j + 1;
+					clusterMissCount = 0;
+
+					clusters.push_back(clusterStart);
+					timestamp += CacheSize + 1;
+				}
 			}
+		}
 
-			finalNormal.Normalize();
+		if (clusters.size() < 2)
+			return;
 
-			outputVertex->normal = finalNormal;
-			outputVertex->position = finalPosition;
-			outputVertex->uv = inputVertex->uv;
+		Vector3f meshCentroid = Vector3f::Zero();
+		for (UInt32 vertex : triangles)
+			meshCentroid += positionPtr[vertex];
 
-			inputVertex++;
-			outputVertex++;
+		meshCentroid /= float(triangles.size());
+
+		struct ClusterOrder
+		{
+			float sortKey;
+			unsigned int firstTriangle;
+			unsigned int lastTriangle;
+		};
+
+		std::vector<ClusterOrder> clusterOrders(clusters.size());
+		for (std::size_t i = 0; i < clusters.size(); ++i)
+		{
+			ClusterOrder& order = clusterOrders[i];
+			order.firstTriangle = clusters[i];
+			order.lastTriangle = (i + 1 < clusters.size()) ? clusters[i + 1] : triangleCount;
+
+			// Area-weighted centroid and average normal of the cluster
+			float clusterArea = 0.f;
+			Vector3f clusterCentroid = Vector3f::Zero();
+			Vector3f clusterNormal = Vector3f::Zero();
+			for (unsigned int j = order.firstTriangle; j < order.lastTriangle; ++j)
+			{
+				const Vector3f& pos0 = positionPtr[triangles[j * 3 + 0]];
+				const Vector3f& pos1 = positionPtr[triangles[j * 3 + 1]];
+				const Vector3f& pos2 = positionPtr[triangles[j * 3 + 2]];
+
+				Vector3f normal = (pos1 - pos0).CrossProduct(pos2 - pos0);
+				float area = normal.GetLength();
+
+				clusterArea += area;
+				clusterCentroid += (pos0 + pos1 + pos2) * (area / 3.f);
+				clusterNormal += normal;
+			}
+
+			float normalLength = clusterNormal.GetLength();
+			if (clusterArea > 0.f && normalLength > 0.f)
+				order.sortKey = (clusterCentroid / clusterArea - meshCentroid).DotProduct(clusterNormal / normalLength);
+			else
+				order.sortKey = 0.f;
+		}
+
+		std::stable_sort(clusterOrders.begin(), clusterOrders.end(), [] (const ClusterOrder& lhs, const ClusterOrder& rhs)
+		{
+			return lhs.sortKey > rhs.sortKey;
+		});
+
+		unsigned int index = 0;
+		for (const ClusterOrder& order : clusterOrders)
+		{
+			for (unsigned int i = order.firstTriangle * 3; i < order.lastTriangle * 3; ++i)
+				indices[index++] = triangles[i];
 		}
 	}
 
-	void SkinPositionNormalTangent(const SkinningData& skinningInfos, unsigned int startVertex, unsigned int vertexCount)
+	unsigned int OptimizeVertexFetch(void* vertices, unsigned int vertexStride, unsigned int vertexCount, IndexIterator indices, unsigned int indexCount)
 	{
+		// Vertices are reordered in the order of their first use, making the fetches as linear as possible
+		constexpr unsigned int InvalidVertex = std::numeric_limits<unsigned int>::max();
+
+		std::vector<unsigned int> remap(vertexCount, InvalidVertex);
+		unsigned int usedVertexCount = 0;
+		for (unsigned int i = 0; i < indexCount; ++i)
+		{
+			UInt32 vertex = indices[i];
+			NazaraAssert(vertex < vertexCount, "Index out of range");
+
+			if (remap[vertex] == InvalidVertex)
+				remap[vertex] = usedVertexCount++;
+
+			indices[i] = remap[vertex];
+		}
+
+		UInt8* vertexData = static_cast<UInt8*>(vertices);
+
+		std::vector<UInt8> reorderedVertices(usedVertexCount * vertexStride);
+		for (unsigned int i = 0; i < vertexCount; ++i)
+		{
+			if (remap[i] != InvalidVertex)
+				std::memcpy(&reorderedVertices[remap[i] * vertexStride], &vertexData[i * vertexStride], vertexStride);
+		}
+
+		std::memcpy(vertexData, reorderedVertices.data(), reorderedVertices.size());
+
+		return usedVertexCount;
+	}
+
+	/************************************Pack***********************************/
+
+	UInt16 PackHalf(float value)
+	{
+		UInt32 bits;
+		std::memcpy(&bits, &value, sizeof(float));
+
+		UInt16 sign = static_cast<UInt16>((bits >> 16) & 0x8000);
+		bits &= 0x7FFFFFFF;
+
+		UInt16 half;
+		if (bits >= 0x47800000) // Larger than the largest half, infinite or NaN
+			half = (bits > 0x7F800000) ? 0x7E00 : 0x7C00;
+		else if (bits < 0x38800000) // Denormalized half (or zero)
+		{
+			// Adding 0.5 aligns the mantissa of the denormalized value, the FPU doing the rounding
+			float denormalized;
+			std::memcpy(&denormalized, &bits, sizeof(float));
+			denormalized += 0.5f;
+
+			std::memcpy(&bits, &denormalized, sizeof(float));
+			half = static_cast<UInt16>(bits - 0x3F000000);
+		}
+		else
+		{
+			// Rebias the exponent and round to the nearest even
+			UInt32 mantissaOdd = (bits >> 13) & 1;
+			bits += ((15U - 127U) << 23) + 0xFFF + mantissaOdd;
+
+			half = static_cast<UInt16>(bits >> 13);
+		}
+
+		return sign | half;
+	}
+
+	UInt32 PackNormal(const Vector4f& value)
+	{
+		// Same layout as GL_INT_2_10_10_10_REV, the w component can only be -1, 0 or 1
+		auto Pack = [] (float component, float maxValue, UInt32 mask)
+		{
+			Int32 packed = static_cast<Int32>(std::round(Clamp(component, -1.f, 1.f) * maxValue));
+			return static_cast<UInt32>(packed) & mask;
+		};
+
+		return Pack(value.x, 511.f, 0x3FF) | (Pack(value.y, 511.f, 0x3FF) << 10) | (Pack(value.z, 511.f, 0x3FF) << 20) | (Pack(value.w, 1.f, 0x3) << 30);
+	}
+
+	UInt16 PackUShortNorm(float value)
+	{
+		return static_cast<UInt16>(Clamp(value, 0.f, 1.f) * 65535.f + 0.5f);
+	}
+
+	float UnpackHalf(UInt16 value)
+	{
+		constexpr UInt32 exponentMask = 0x7C00 << 13;
+
+		UInt32 bits = (value & 0x7FFF) << 13;
+		UInt32 exponent = bits & exponentMask;
+		bits += (127U - 15U) << 23;
+
+		if (exponent == exponentMask) // Infinite or NaN
+			bits += (128U - 16U) << 23;
+		else if (exponent == 0) // Denormalized half (or zero), renormalized by the FPU
+		{
+			bits += 1U << 23;
+
+			float denormalized;
+			std::memcpy(&denormalized, &bits, sizeof(float));
+			denormalized -= 6.103515625e-05f; // 2^-14
+
+			std::memcpy(&bits, &denormalized, sizeof(float));
+		}
+
+		bits |= static_cast<UInt32>(value & 0x8000) << 16;
+
+		float result;
+		std::memcpy(&result, &bits, sizeof(float));
+
+		return result;
+	}
+
+	Vector4f UnpackNormal(UInt32 value)
+	{
+		auto Unpack = [] (UInt32 component, unsigned int bitCount, float maxValue)
+		{
+			// Sign extension
+			Int32 signedComponent = static_cast<Int32>(component << (32 - bitCount)) >> (32 - bitCount);
+			return std::max(signedComponent / maxValue, -1.f);
+		};
+
+		return Vector4f(Unpack(value & 0x3FF, 10, 511.f), Unpack((value >> 10) & 0x3FF, 10, 511.f), Unpack((value >> 20) & 0x3FF, 10, 511.f), Unpack(value >> 30, 2, 1.f));
+	}
+
+	float UnpackUShortNorm(UInt16 value)
+	{
+		return value / 65535.f;
+	}
+
+	/************************************Skin***********************************/
+
+	void SkinDualQuaternionPositionNormalTangent(const SkinningData& skinningInfos, unsigned int startVertex, unsigned int vertexCount)
+	{
+		NazaraAssert(skinningInfos.dualQuaternions, "Dual quaternion skinning requires the joint dual quaternions");
+
 		const SkeletalMeshVertex* inputVertex = &skinningInfos.inputVertex[startVertex];
 		MeshVertex* outputVertex = &skinningInfos.outputVertex[startVertex];
 
-		unsigned int endVertex = startVertex + vertexCount - 1;
-		for (unsigned int i = startVertex; i <= endVertex; ++i)
+		for (unsigned int i = 0; i < vertexCount; ++i)
 		{
-			Vector3f finalPosition(Vector3f::Zero());
-			Vector3f finalNormal(Vector3f::Zero());
-			Vector3f finalTangent(Vector3f::Zero());
+			// Blending dual quaternions preserves the volume around the joints, unlike blending matrices (no candy-wrapper effect)
+			Quaternionf real(0.f, 0.f, 0.f, 0.f);
+			Quaternionf dual(0.f, 0.f, 0.f, 0.f);
 
-			for (int j = 0; j < inputVertex->weightCount; ++j)
+			if (inputVertex->weightCount > 0)
 			{
-				Matrix4f mat(skinningInfos.joints[inputVertex->jointIndexes[j]].GetSkinningMatrix());
-				mat *= inputVertex->weights[j];
+				const Quaternionf& pivot = skinningInfos.dualQuaternions[inputVertex->jointIndexes[0]].real;
 
-				finalPosition += mat.Transform(inputVertex->position);
-				finalNormal += mat.Transform(inputVertex->normal, 0.f);
-				finalTangent += mat.Transform(inputVertex->tangent, 0.f);
+				for (int j = 0; j < inputVertex->weightCount; ++j)
+				{
+					const SkinningDualQuaternion& dualQuaternion = skinningInfos.dualQuaternions[inputVertex->jointIndexes[j]];
+
+					// q and -q represent the same rotation, the shortest path is blended
+					float weight = inputVertex->weights[j];
+					if (pivot.DotProduct(dualQuaternion.real) < 0.f)
+						weight = -weight;
+
+					real.w += dualQuaternion.real.w * weight;
+					real.x += dualQuaternion.real.x * weight;
+					real.y += dualQuaternion.real.y * weight;
+					real.z += dualQuaternion.real.z * weight;
+
+					dual.w += dualQuaternion.dual.w * weight;
+					dual.x += dualQuaternion.dual.x * weight;
+					dual.y += dualQuaternion.dual.y * weight;
+					dual.z += dualQuaternion.dual.z * weight;
+				}
 			}
 
-			finalNormal.Normalize();
-			finalTangent.Normalize();
+			float length = std::sqrt(real.SquaredMagnitude());
+			if (length > 0.f)
+			{
+				float invLength = 1.f / length;
+				real *= invLength;
+				dual *= invLength;
+
+				// translation = 2 * dual * conjugate(real)
+				Vector3f realVec(real.x, real.y, real.z);
+				Vector3f dualVec(dual.x, dual.y, dual.z);
+				Vector3f translation = 2.f * (real.w * dualVec - dual.w * realVec + realVec.CrossProduct(dualVec));
+
+				outputVertex->position = real * inputVertex->position + translation;
+				outputVertex->normal = real * inputVertex->normal;
+				outputVertex->tangent = real * inputVertex->tangent;
+			}
+			else
+			{
+				outputVertex->position = Vector3f::Zero();
+				outputVertex->normal = inputVertex->normal;
+				outputVertex->tangent = inputVertex->tangent;
+			}
 
-			outputVertex->normal = finalNormal;
-			outputVertex->position = finalPosition;
-			outputVertex->tangent = finalTangent;
 			outputVertex->uv = inputVertex->uv;
 
 			inputVertex++;
@@ -1148,6 +2234,21 @@ namespace Nz
 		}
 	}
 
+	void SkinPosition(const SkinningData& skinningInfos, unsigned int startVertex, unsigned int vertexCount)
+	{
+		SkinVertices<false, false>(skinningInfos, startVertex, vertexCount);
+	}
+
+	void SkinPositionNormal(const SkinningData& skinningInfos, unsigned int startVertex, unsigned int vertexCount)
+	{
+		SkinVertices<true, false>(skinningInfos, startVertex, vertexCount);
+	}
+
+	void SkinPositionNormalTangent(const SkinningData& skinningInfos, unsigned int startVertex, unsigned int vertexCount)
+	{
+		SkinVertices<true, true>(skinningInfos, startVertex, vertexCount);
+	}
+
 	/*********************************Transform*********************************/
 
 	void TransformVertices(VertexPointers vertexPointers, unsigned int vertexCount, const Matrix4f& matrix)
@@ -1166,4 +2267,69 @@ namespace Nz
 				*vertexPointers.tangentPtr++ = matrix.Transform(*vertexPointers.tangentPtr, 0.f) / scale;
 		}
 	}
+
+	/***********************************Weld************************************/
+
+	unsigned int WeldVertices(void* vertices, unsigned int vertexStride, unsigned int vertexCount, IndexIterator indices, unsigned int indexCount)
+	{
+		// Only binary identical vertices are welded, keeping the first of them
+		UInt8* vertexData = static_cast<UInt8*>(vertices);
+
+		auto VertexHasher = [=] (unsigned int vertex) -> std::size_t
+		{
+			// FNV-1a
+			const UInt8* data = &vertexData[vertex * vertexStride];
+
+			UInt32 hash = 2166136261U;
+			for (unsigned int i = 0; i < vertexStride; ++i)
+			{
+				hash ^= data[i];
+				hash *= 16777619U;
+			}
+
+			return hash;
+		};
+
+		auto VertexComparator = [=] (unsigned int lhs, unsigned int rhs)
+		{
+			return std::memcmp(&vertexData[lhs * vertexStride], &vertexData[rhs * vertexStride], vertexStride) == 0;
+		};
+
+		std::vector<unsigned int> remap(vertexCount);
+		unsigned int uniqueVertexCount = 0;
+		{
+			std::unordered_map<unsigned int, unsigned int, decltype(VertexHasher), decltype(VertexComparator)> uniqueVertices(vertexCount, VertexHasher, VertexComparator);
+			for (unsigned int i = 0; i < vertexCount; ++i)
+			{
+				auto pair = uniqueVertices.emplace(i, uniqueVertexCount);
+				if (pair.second)
+					uniqueVertexCount++;
+
+				remap[i] = pair.first->second;
+			}
+		}
+
+		// Unique vertices are given increasing indices, which are never greater than their current one
+		unsigned int nextVertex = 0;
+		for (unsigned int i = 0; i < vertexCount; ++i)
+		{
+			if (remap[i] == nextVertex)
+			{
+				if (nextVertex != i)
+					std::memcpy(&vertexData[nextVertex * vertexStride], &vertexData[i * vertexStride], vertexStride);
+
+				nextVertex++;
+			}
+		}
+
+		for (unsigned int i = 0; i < indexCount; ++i)
+		{
+			UInt32 vertex = indices[i];
+			NazaraAssert(vertex < vertexCount, "Index out of range");
+
+			indices[i] = remap[vertex];
+		}
+
+		return uniqueVertexCount;
+	}
 }
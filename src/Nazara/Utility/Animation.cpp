@@ -4,10 +4,15 @@
 
 #include <Nazara/Utility/Animation.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/MemoryHelper.hpp>
 #include <Nazara/Utility/Config.hpp>
 #include <Nazara/Utility/Joint.hpp>
 #include <Nazara/Utility/Sequence.hpp>
 #include <Nazara/Utility/Skeleton.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
 #include <vector>
 #include <unordered_map>
 #include <Nazara/Utility/Debug.hpp>
@@ -16,15 +21,171 @@ namespace Nz
 {
 	struct AnimationImpl
 	{
+		// Pistes compressées d'une articulation, chaque canal ne garde que les images clés nécessaires
+		struct Track
+		{
+			std::vector<UInt16> positionFrames;
+			std::vector<UInt16> rotationFrames;
+			std::vector<UInt16> scaleFrames;
+			std::vector<UInt64> rotations;
+			std::vector<Vector3f> positions;
+			std::vector<Vector3f> scales;
+		};
+
 		std::unordered_map<String, UInt32> sequenceMap;
 		std::vector<Sequence> sequences;
 		std::vector<SequenceJoint> sequenceJoints; // Uniquement pour les animations squelettiques
+		std::vector<Track> tracks; // Uniquement pour les animations squelettiques compressées
 		AnimationType type;
 		bool loopPointInterpolation = false;
 		UInt32 frameCount;
 		UInt32 jointCount;  // Uniquement pour les animations squelettiques
 	};
 
+	namespace
+	{
+		// Rotations are stored as their three smallest components over 16 bits and the index of the largest one over two bits
+		UInt64 CompressRotation(const Quaternionf& rotation)
+		{
+			const float components[4] = { rotation.w, rotation.x, rotation.y, rotation.z };
+
+			unsigned int largest = 0;
+			for (unsigned int i = 1; i < 4; ++i)
+			{
+				if (std::abs(components[i]) > std::abs(components[largest]))
+					largest = i;
+			}
+
+			// q and -q are the same rotation, the largest component is made positive so its sign doesn't have to be kept
+			float sign = (components[largest] < 0.f) ? -1.f : 1.f;
+
+			UInt64 packed = largest;
+			unsigned int shift = 2;
+			for (unsigned int i = 0; i < 4; ++i)
+			{
+				if (i == largest)
+					continue;
+
+				// The other components are in [-1/sqrt(2), 1/sqrt(2)]
+				float value = Clamp(components[i] * sign * float(M_SQRT2), -1.f, 1.f);
+				packed |= static_cast<UInt64>(std::lround((value * 0.5f + 0.5f) * 65535.f)) << shift;
+				shift += 16;
+			}
+
+			return packed;
+		}
+
+		Quaternionf DecompressRotation(UInt64 packed)
+		{
+			unsigned int largest = static_cast<unsigned int>(packed & 0x3);
+
+			float components[4];
+			float squaredSum = 0.f;
+			unsigned int shift = 2;
+			for (unsigned int i = 0; i < 4; ++i)
+			{
+				if (i == largest)
+					continue;
+
+				float value = static_cast<float>((packed >> shift) & 0xFFFF) / 65535.f;
+				components[i] = (value * 2.f - 1.f) / float(M_SQRT2);
+				squaredSum += components[i] * components[i];
+				shift += 16;
+			}
+
+			components[largest] = std::sqrt(std::max(1.f - squaredSum, 0.f));
+
+			return Quaternionf(components[0], components[1], components[2], components[3]);
+		}
+
+		// Keeps the frames which can't be rebuilt by interpolating their neighbouring keys
+		template<typename T, typename L, typename E>
+		void ReduceKeys(const std::vector<T>& values, L&& lerp, E&& isClose, std::vector<UInt16>* frames, std::vector<T>* keys)
+		{
+			UInt32 frameCount = static_cast<UInt32>(values.size());
+			UInt32 lastKey = 0;
+
+			frames->push_back(0);
+			keys->push_back(values[0]);
+
+			for (UInt32 candidate = 2; candidate < frameCount; ++candidate)
+			{
+				bool fits = true;
+				for (UInt32 frame = lastKey + 1; frame < candidate; ++frame)
+				{
+					float t = float(frame - lastKey) / float(candidate - lastKey);
+					if (!isClose(lerp(values[lastKey], values[candidate], t), values[frame]))
+					{
+						fits = false;
+						break;
+					}
+				}
+
+				if (!fits)
+				{
+					lastKey = candidate - 1;
+
+					frames->push_back(static_cast<UInt16>(lastKey));
+					keys->push_back(values[lastKey]);
+				}
+			}
+
+			if (frameCount > 1)
+			{
+				frames->push_back(static_cast<UInt16>(frameCount - 1));
+				keys->push_back(values[frameCount - 1]);
+			}
+
+			frames->shrink_to_fit();
+			keys->shrink_to_fit();
+		}
+
+		template<typename T, typename D, typename L>
+		auto SampleKeys(const std::vector<UInt16>& frames, const std::vector<T>& keys, UInt32 frame, D&& decode, L&& lerp) -> typename std::decay<decltype(decode(keys[0]))>::type
+		{
+			auto it = std::upper_bound(frames.begin(), frames.end(), frame);
+			if (it == frames.end())
+				return decode(keys.back());
+
+			// The first key is always the first frame, a frame is therefore always after a key
+			std::size_t nextKey = static_cast<std::size_t>(it - frames.begin());
+			std::size_t previousKey = nextKey - 1;
+
+			float t = float(frame - frames[previousKey]) / float(frames[nextKey] - frames[previousKey]);
+			return lerp(decode(keys[previousKey]), decode(keys[nextKey]), t);
+		}
+
+		SequenceJoint SampleFrame(const AnimationImpl& impl, UInt32 jointIndex, UInt32 frame)
+		{
+			if (impl.tracks.empty())
+				return impl.sequenceJoints[frame * impl.jointCount + jointIndex];
+
+			auto identity = [](const Vector3f& value) -> const Vector3f& { return value; };
+
+			const AnimationImpl::Track& track = impl.tracks[jointIndex];
+
+			SequenceJoint sequenceJoint;
+			sequenceJoint.position = SampleKeys(track.positionFrames, track.positions, frame, identity, &Vector3f::Lerp);
+			sequenceJoint.rotation = SampleKeys(track.rotationFrames, track.rotations, frame, DecompressRotation, &Quaternionf::Slerp);
+			sequenceJoint.scale = SampleKeys(track.scaleFrames, track.scales, frame, identity, &Vector3f::Lerp);
+
+			return sequenceJoint;
+		}
+
+		SequenceJoint SampleJoint(const AnimationImpl& impl, UInt32 jointIndex, UInt32 frameA, UInt32 frameB, float interpolation)
+		{
+			SequenceJoint sequenceJointA = SampleFrame(impl, jointIndex, frameA);
+			SequenceJoint sequenceJointB = SampleFrame(impl, jointIndex, frameB);
+
+			SequenceJoint sequenceJoint;
+			sequenceJoint.position = Vector3f::Lerp(sequenceJointA.position, sequenceJointB.position, interpolation);
+			sequenceJoint.rotation = Quaternionf::Slerp(sequenceJointA.rotation, sequenceJointB.rotation, interpolation);
+			sequenceJoint.scale = Vector3f::Lerp(sequenceJointA.scale, sequenceJointB.scale, interpolation);
+
+			return sequenceJoint;
+		}
+	}
+
 	bool AnimationParams::IsValid() const
 	{
 		if (startFrame > endFrame)
@@ -53,6 +214,12 @@ namespace Nz
 			UInt32 endFrame = sequence.firstFrame + sequence.frameCount - 1;
 			if (endFrame >= m_impl->frameCount)
 			{
+				if (!m_impl->tracks.empty())
+				{
+					NazaraError("Frames cannot be added to a compressed animation");
+					return false;
+				}
+
 				m_impl->frameCount = endFrame+1;
 				m_impl->sequenceJoints.resize(m_impl->frameCount*m_impl->jointCount);
 			}
@@ -86,17 +253,149 @@ namespace Nz
 		NazaraAssert(frameA < m_impl->frameCount, "FrameA is out of range");
 		NazaraAssert(frameB < m_impl->frameCount, "FrameB is out of range");
 
+		StackArray<SequenceJoint> pose = NazaraStackAllocationNoInit(SequenceJoint, m_impl->jointCount);
+		SamplePose(frameA, frameB, interpolation, pose.data());
+
+		targetSkeleton->SetPose(pose.data());
+	}
+
+	/*!
+	* \brief Animates some joints of a skeleton, the others keeping their current pose
+	*
+	* This allows a far away skeleton to only animate its most visible joints
+	*
+	* \param targetSkeleton Skeleton to animate
+	* \param frameA First frame to interpolate
+	* \param frameB Second frame to interpolate
+	* \param interpolation Interpolation factor between the frames, from zero (frameA) to one (frameB)
+	* \param joints Indices of the joints to animate
+	* \param jointCount Number of joints to animate
+	*/
+
+	void Animation::AnimateSkeleton(Skeleton* targetSkeleton, UInt32 frameA, UInt32 frameB, float interpolation, const UInt32* joints, std::size_t jointCount) const
+	{
+		NazaraAssert(m_impl, "Animation not created");
+		NazaraAssert(m_impl->type == AnimationType_Skeletal, "Animation is not skeletal");
+		NazaraAssert(targetSkeleton && targetSkeleton->IsValid(), "Invalid skeleton");
+		NazaraAssert(targetSkeleton->GetJointCount() == m_impl->jointCount, "Skeleton joint does not match animation joint count");
+		NazaraAssert(frameA < m_impl->frameCount, "FrameA is out of range");
+		NazaraAssert(frameB < m_impl->frameCount, "FrameB is out of range");
+		NazaraAssert(joints || jointCount == 0, "Invalid joints");
+
+		// The pose buffer is indexed by joint, only the entries of the animated joints are written and read
+		StackArray<SequenceJoint> pose = NazaraStackAllocationNoInit(SequenceJoint, m_impl->jointCount);
+		for (std::size_t i = 0; i < jointCount; ++i)
+		{
+			UInt32 jointIndex = joints[i];
+			NazaraAssert(jointIndex < m_impl->jointCount, "Joint index out of range");
+
+			pose[jointIndex] = SampleJoint(*m_impl, jointIndex, frameA, frameB, interpolation);
+		}
+
+		targetSkeleton->SetPose(pose.data(), joints, static_cast<UInt32>(jointCount));
+	}
+
+	/*!
+	* \brief Blends the pose of the animation at a given time into a pose
+	*
+	* Blending several animations is done by sampling the first one with SamplePose, then blending the others in with their weight
+	*
+	* \param frameA First frame to interpolate
+	* \param frameB Second frame to interpolate
+	* \param interpolation Interpolation factor between the frames, from zero (frameA) to one (frameB)
+	* \param weight Weight of this animation, from zero (pose is kept) to one (pose is replaced)
+	* \param pose Pose of every joint of the skeleton, blended in place
+	*/
+
+	void Animation::BlendPose(UInt32 frameA, UInt32 frameB, float interpolation, float weight, SequenceJoint* pose) const
+	{
+		NazaraAssert(m_impl, "Animation not created");
+		NazaraAssert(m_impl->type == AnimationType_Skeletal, "Animation is not skeletal");
+		NazaraAssert(frameA < m_impl->frameCount, "FrameA is out of range");
+		NazaraAssert(frameB < m_impl->frameCount, "FrameB is out of range");
+		NazaraAssert(pose, "Invalid pose");
+
+		for (UInt32 i = 0; i < m_impl->jointCount; ++i)
+		{
+			SequenceJoint sequenceJoint = SampleJoint(*m_impl, i, frameA, frameB, interpolation);
+
+			pose[i].position = Vector3f::Lerp(pose[i].position, sequenceJoint.position, weight);
+			pose[i].rotation = Quaternionf::Slerp(pose[i].rotation, sequenceJoint.rotation, weight);
+			pose[i].scale = Vector3f::Lerp(pose[i].scale, sequenceJoint.scale, weight);
+		}
+	}
+
+	/*!
+	* \brief Compresses the frames of a skeletal animation
+	* \return true If the animation was compressed
+	*
+	* Every joint gets a track per channel, which only keeps the frames that can't be rebuilt (within the tolerances) by interpolating the other ones.
+	* Rotations are quantized to 50 bits.
+	*
+	* \param positionTolerance Maximum distance between a position and its rebuilt value
+	* \param rotationTolerance Maximum angle between a rotation and its rebuilt value, also used for scales
+	*
+	* \remark The original frames are released, GetSequenceJoints can't be used anymore
+	* \remark Produces a NazaraError if the animation has more than 65536 frames
+	*/
+
+	bool Animation::Compress(float positionTolerance, float rotationTolerance)
+	{
+		NazaraAssert(m_impl, "Animation not created");
+		NazaraAssert(m_impl->type == AnimationType_Skeletal, "Animation is not skeletal");
+
+		if (!m_impl->tracks.empty())
+			return true;
+
+		if (m_impl->frameCount > std::numeric_limits<UInt16>::max() + 1U)
+		{
+			NazaraError("Animation has too many frames to be compressed");
+			return false;
+		}
+
+		float squaredPositionTolerance = positionTolerance * positionTolerance;
+		float minRotationDot = std::cos(ToRadians(rotationTolerance) * 0.5f);
+		float scaleTolerance = ToRadians(rotationTolerance);
+
+		auto isPositionClose = [=](const Vector3f& lhs, const Vector3f& rhs) { return lhs.SquaredDistance(rhs) <= squaredPositionTolerance; };
+		auto isRotationClose = [=](const Quaternionf& lhs, const Quaternionf& rhs) { return std::abs(lhs.DotProduct(rhs)) >= minRotationDot; };
+		auto isScaleClose = [=](const Vector3f& lhs, const Vector3f& rhs) { return (lhs - rhs).GetSquaredLength() <= scaleTolerance * scaleTolerance; };
+
+		std::vector<AnimationImpl::Track> tracks(m_impl->jointCount);
+
+		std::vector<Vector3f> positions(m_impl->frameCount);
+		std::vector<Quaternionf> rotations(m_impl->frameCount);
+		std::vector<Vector3f> scales(m_impl->frameCount);
+		std::vector<Quaternionf> rotationKeys;
 		for (UInt32 i = 0; i < m_impl->jointCount; ++i)
 		{
-			Joint* joint = targetSkeleton->GetJoint(i);
+			for (UInt32 frame = 0; frame < m_impl->frameCount; ++frame)
+			{
+				const SequenceJoint& sequenceJoint = m_impl->sequenceJoints[frame * m_impl->jointCount + i];
 
-			const SequenceJoint& sequenceJointA = m_impl->sequenceJoints[frameA*m_impl->jointCount + i];
-			const SequenceJoint& sequenceJointB = m_impl->sequenceJoints[frameB*m_impl->jointCount + i];
+				positions[frame] = sequenceJoint.position;
+				scales[frame] = sequenceJoint.scale;
 
-			joint->SetPosition(Vector3f::Lerp(sequenceJointA.position, sequenceJointB.position, interpolation));
-			joint->SetRotation(Quaternionf::Slerp(sequenceJointA.rotation, sequenceJointB.rotation, interpolation));
-			joint->SetScale(Vector3f::Lerp(sequenceJointA.scale, sequenceJointB.scale, interpolation));
+				// Keys are picked from quantized rotations, so the quantization error is part of the tolerance
+				rotations[frame] = DecompressRotation(CompressRotation(sequenceJoint.rotation));
+			}
+
+			AnimationImpl::Track& track = tracks[i];
+			ReduceKeys(positions, &Vector3f::Lerp, isPositionClose, &track.positionFrames, &track.positions);
+			ReduceKeys(scales, &Vector3f::Lerp, isScaleClose, &track.scaleFrames, &track.scales);
+
+			rotationKeys.clear();
+			ReduceKeys(rotations, &Quaternionf::Slerp, isRotationClose, &track.rotationFrames, &rotationKeys);
+
+			track.rotations.resize(rotationKeys.size());
+			std::transform(rotationKeys.begin(), rotationKeys.end(), track.rotations.begin(), CompressRotation);
 		}
+
+		m_impl->tracks = std::move(tracks);
+		m_impl->sequenceJoints.clear();
+		m_impl->sequenceJoints.shrink_to_fit();
+
+		return true;
 	}
 
 	bool Animation::CreateSkeletal(UInt32 frameCount, UInt32 jointCount)
@@ -147,6 +446,26 @@ namespace Nz
 		return m_impl->jointCount;
 	}
 
+	/*!
+	* \brief Gets the memory used by the frames of the animation
+	* \return Memory usage in bytes, of the tracks if the animation is compressed
+	*/
+
+	std::size_t Animation::GetMemoryUsage() const
+	{
+		NazaraAssert(m_impl, "Animation not created");
+
+		std::size_t memoryUsage = m_impl->sequenceJoints.capacity() * sizeof(SequenceJoint);
+		for (const AnimationImpl::Track& track : m_impl->tracks)
+		{
+			memoryUsage += (track.positionFrames.capacity() + track.rotationFrames.capacity() + track.scaleFrames.capacity()) * sizeof(UInt16);
+			memoryUsage += track.rotations.capacity() * sizeof(UInt64);
+			memoryUsage += (track.positions.capacity() + track.scales.capacity()) * sizeof(Vector3f);
+		}
+
+		return memoryUsage;
+	}
+
 	Sequence* Animation::GetSequence(const String& sequenceName)
 	{
 		NazaraAssert(m_impl, "Animation not created");
@@ -216,6 +535,7 @@ namespace Nz
 	{
 		NazaraAssert(m_impl, "Animation not created");
 		NazaraAssert(m_impl->type == AnimationType_Skeletal, "Animation is not skeletal");
+		NazaraAssert(m_impl->tracks.empty(), "Frames of a compressed animation cannot be accessed");
 
 		return &m_impl->sequenceJoints[frameIndex*m_impl->jointCount];
 	}
@@ -224,6 +544,7 @@ namespace Nz
 	{
 		NazaraAssert(m_impl, "Animation not created");
 		NazaraAssert(m_impl->type == AnimationType_Skeletal, "Animation is not skeletal");
+		NazaraAssert(m_impl->tracks.empty(), "Frames of a compressed animation cannot be accessed");
 
 		return &m_impl->sequenceJoints[frameIndex*m_impl->jointCount];
 	}
@@ -249,6 +570,18 @@ namespace Nz
 		return index >= m_impl->sequences.size();
 	}
 
+	/*!
+	* \brief Checks whether the animation was compressed
+	* \return true If it is the case
+	*/
+
+	bool Animation::IsCompressed() const
+	{
+		NazaraAssert(m_impl, "Animation not created");
+
+		return !m_impl->tracks.empty();
+	}
+
 	bool Animation::IsLoopPointInterpolationEnabled() const
 	{
 		NazaraAssert(m_impl, "Animation not created");
@@ -304,6 +637,27 @@ namespace Nz
 		m_impl->sequences.erase(it);
 	}
 
+	/*!
+	* \brief Samples the pose of the animation at a given time
+	*
+	* \param frameA First frame to interpolate
+	* \param frameB Second frame to interpolate
+	* \param interpolation Interpolation factor between the frames, from zero (frameA) to one (frameB)
+	* \param pose Buffer receiving the pose of every joint of the skeleton, which can then be blended with other animations and applied with Skeleton::SetPose
+	*/
+
+	void Animation::SamplePose(UInt32 frameA, UInt32 frameB, float interpolation, SequenceJoint* pose) const
+	{
+		NazaraAssert(m_impl, "Animation not created");
+		NazaraAssert(m_impl->type == AnimationType_Skeletal, "Animation is not skeletal");
+		NazaraAssert(frameA < m_impl->frameCount, "FrameA is out of range");
+		NazaraAssert(frameB < m_impl->frameCount, "FrameB is out of range");
+		NazaraAssert(pose, "Invalid pose");
+
+		for (UInt32 i = 0; i < m_impl->jointCount; ++i)
+			pose[i] = SampleJoint(*m_impl, i, frameA, frameB, interpolation);
+	}
+
 	bool Animation::Initialize()
 	{
 		if (!AnimationLibrary::Initialize())
@@ -118,18 +118,26 @@ namespace Nz
 			return false;
 		}
 
-		void* ptr = m_impl->Map(BufferAccess_ReadOnly, 0, m_size);
-		if (!ptr)
+		// Software memory is handed as is to the new storage, other storages have to be mapped
+		const void* ptr;
+		CallOnExit unmapMyImpl;
+		if (m_impl->GetStorage() == DataStorage_Software)
+			ptr = static_cast<SoftwareBuffer*>(m_impl.get())->GetData();
+		else
 		{
-			NazaraError("Failed to map buffer");
-			return false;
+			ptr = m_impl->Map(BufferAccess_ReadOnly, 0, m_size);
+			if (!ptr)
+			{
+				NazaraError("Failed to map buffer");
+				return false;
+			}
+
+			unmapMyImpl.Reset([this]()
+			{
+				m_impl->Unmap();
+			});
 		}
 
-		CallOnExit unmapMyImpl([this]()
-		{
-			m_impl->Unmap();
-		});
-
 		std::unique_ptr<AbstractBuffer> impl(s_bufferFactories[storage](this, m_type));
 		if (!impl->Initialize(m_size, m_usage))
 		{
@@ -180,6 +188,8 @@ namespace Nz
 
 	void Buffer::Uninitialize()
 	{
+		SoftwareBuffer::ReleasePooledMemory();
+
 		std::fill(s_bufferFactories.begin(), s_bufferFactories.end(), nullptr);
 	}
 
@@ -0,0 +1,260 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/BufferAllocator.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Utility/BufferMapper.hpp>
+#include <Nazara/Utility/VertexDeclaration.hpp>
+#include <algorithm>
+#include <iterator>
+#include <Nazara/Utility/Debug.hpp>
+
+namespace Nz
+{
+	BufferAllocator::BufferAllocator(DataStorage storage, BufferUsageFlags usage, UInt32 blockSize) :
+	m_usage(usage),
+	m_storage(storage),
+	m_blockSize(blockSize)
+	{
+		NazaraAssert(blockSize > 0, "Invalid block size");
+	}
+
+	IndexBufferRef BufferAllocator::AllocateIndexBuffer(bool largeIndices, UInt32 length)
+	{
+		NazaraAssert(length > 0, "Invalid length");
+
+		UInt32 stride = (largeIndices) ? sizeof(UInt32) : sizeof(UInt16);
+
+		IndexAllocation allocation;
+		if (!Allocate(BufferType_Index, length * stride, stride, &allocation))
+			return nullptr;
+
+		IndexBufferRef indexBuffer = IndexBuffer::New(largeIndices, m_blocks[BufferType_Index][allocation.block].buffer, allocation.offset, allocation.size);
+		allocation.onReleaseSlot.Connect(indexBuffer->OnIndexBufferRelease, this, &BufferAllocator::OnIndexBufferRelease);
+
+		m_indexAllocations.emplace(indexBuffer.Get(), std::move(allocation));
+
+		return indexBuffer;
+	}
+
+	VertexBufferRef BufferAllocator::AllocateVertexBuffer(VertexDeclarationConstRef vertexDeclaration, UInt32 length)
+	{
+		NazaraAssert(vertexDeclaration, "Invalid vertex declaration");
+		NazaraAssert(length > 0, "Invalid length");
+
+		// Aligning the vertices to their stride allows the renderer to draw them with a base vertex, sharing the same vertex array object
+		UInt32 stride = static_cast<UInt32>(vertexDeclaration->GetStride());
+
+		VertexAllocation allocation;
+		if (!Allocate(BufferType_Vertex, length * stride, stride, &allocation))
+			return nullptr;
+
+		VertexBufferRef vertexBuffer = VertexBuffer::New(std::move(vertexDeclaration), m_blocks[BufferType_Vertex][allocation.block].buffer, allocation.offset, allocation.size);
+		allocation.onReleaseSlot.Connect(vertexBuffer->OnVertexBufferRelease, this, &BufferAllocator::OnVertexBufferRelease);
+
+		m_vertexAllocations.emplace(vertexBuffer.Get(), std::move(allocation));
+
+		return vertexBuffer;
+	}
+
+	UInt32 BufferAllocator::GetUsedSize(BufferType type) const
+	{
+		NazaraAssert(type <= BufferType_Max, "Buffer type out of enum");
+
+		UInt32 usedSize = 0;
+		for (const Block& block : m_blocks[type])
+			usedSize += block.usedSize;
+
+		return usedSize;
+	}
+
+	bool BufferAllocator::Relocate(IndexBuffer* indexBuffer)
+	{
+		NazaraAssert(indexBuffer && indexBuffer->IsValid(), "Invalid index buffer");
+
+		UInt32 size = indexBuffer->GetEndOffset() - indexBuffer->GetStartOffset();
+
+		IndexAllocation allocation;
+		if (!Allocate(BufferType_Index, size, indexBuffer->GetStride(), &allocation))
+			return false;
+
+		const BufferRef& buffer = m_blocks[BufferType_Index][allocation.block].buffer;
+		{
+			BufferMapper<IndexBuffer> mapper(indexBuffer, BufferAccess_ReadOnly);
+			if (!buffer->Fill(mapper.GetPointer(), allocation.offset, size))
+			{
+				NazaraError("Failed to fill buffer");
+
+				Free(BufferType_Index, allocation);
+				return false;
+			}
+		}
+
+		indexBuffer->Reset(indexBuffer->HasLargeIndices(), buffer, allocation.offset, size);
+
+		// The range previously allocated to this index buffer (if any) is not used anymore
+		auto it = m_indexAllocations.find(indexBuffer);
+		if (it != m_indexAllocations.end())
+		{
+			Free(BufferType_Index, it->second);
+			m_indexAllocations.erase(it);
+		}
+
+		allocation.onReleaseSlot.Connect(indexBuffer->OnIndexBufferRelease, this, &BufferAllocator::OnIndexBufferRelease);
+		m_indexAllocations.emplace(indexBuffer, std::move(allocation));
+
+		return true;
+	}
+
+	bool BufferAllocator::Relocate(VertexBuffer* vertexBuffer)
+	{
+		NazaraAssert(vertexBuffer && vertexBuffer->IsValid(), "Invalid vertex buffer");
+
+		UInt32 size = vertexBuffer->GetVertexCount() * vertexBuffer->GetStride();
+
+		VertexAllocation allocation;
+		if (!Allocate(BufferType_Vertex, size, vertexBuffer->GetStride(), &allocation))
+			return false;
+
+		const BufferRef& buffer = m_blocks[BufferType_Vertex][allocation.block].buffer;
+		{
+			BufferMapper<VertexBuffer> mapper(vertexBuffer, BufferAccess_ReadOnly);
+			if (!buffer->Fill(mapper.GetPointer(), allocation.offset, size))
+			{
+				NazaraError("Failed to fill buffer");
+
+				Free(BufferType_Vertex, allocation);
+				return false;
+			}
+		}
+
+		vertexBuffer->Reset(vertexBuffer->GetVertexDeclaration(), buffer, allocation.offset, size);
+
+		// The range previously allocated to this vertex buffer (if any) is not used anymore
+		auto it = m_vertexAllocations.find(vertexBuffer);
+		if (it != m_vertexAllocations.end())
+		{
+			Free(BufferType_Vertex, it->second);
+			m_vertexAllocations.erase(it);
+		}
+
+		allocation.onReleaseSlot.Connect(vertexBuffer->OnVertexBufferRelease, this, &BufferAllocator::OnVertexBufferRelease);
+		m_vertexAllocations.emplace(vertexBuffer, std::move(allocation));
+
+		return true;
+	}
+
+	bool BufferAllocator::Allocate(BufferType type, UInt32 size, UInt32 alignment, Allocation* allocation)
+	{
+		NazaraAssert(size > 0, "Invalid size");
+		NazaraAssert(alignment > 0, "Invalid alignment");
+
+		std::vector<Block>& blocks = m_blocks[type];
+
+		// First fit, the alignment padding of the range being kept free
+		auto TryAllocate = [&] (UInt32 blockIndex) -> bool
+		{
+			Block& block = blocks[blockIndex];
+			for (auto it = block.freeRanges.begin(); it != block.freeRanges.end(); ++it)
+			{
+				UInt32 rangeOffset = it->first;
+				UInt32 rangeSize = it->second;
+
+				UInt32 offset = ((rangeOffset + alignment - 1) / alignment) * alignment;
+				UInt32 padding = offset - rangeOffset;
+				if (rangeSize < padding + size)
+					continue;
+
+				block.freeRanges.erase(it);
+				if (padding > 0)
+					block.freeRanges.emplace(rangeOffset, padding);
+
+				UInt32 remainingSize = rangeSize - padding - size;
+				if (remainingSize > 0)
+					block.freeRanges.emplace(offset + size, remainingSize);
+
+				block.usedSize += size;
+
+				allocation->block = blockIndex;
+				allocation->offset = offset;
+				allocation->size = size;
+				return true;
+			}
+
+			return false;
+		};
+
+		for (UInt32 i = 0; i < blocks.size(); ++i)
+		{
+			if (TryAllocate(i))
+				return true;
+		}
+
+		// Allocations larger than a block get their own buffer
+		UInt32 blockSize = std::max(m_blockSize, size);
+
+		BufferRef buffer = Buffer::New(type);
+		if (!buffer->Create(blockSize, m_storage, m_usage))
+		{
+			NazaraError("Failed to create buffer block of " + String::Number(blockSize) + " bytes");
+			return false;
+		}
+
+		Block block;
+		block.buffer = std::move(buffer);
+		block.freeRanges.emplace(0, blockSize);
+		block.usedSize = 0;
+
+		blocks.emplace_back(std::move(block));
+
+		return TryAllocate(static_cast<UInt32>(blocks.size() - 1));
+	}
+
+	void BufferAllocator::Free(BufferType type, const Allocation& allocation)
+	{
+		Block& block = m_blocks[type][allocation.block];
+		block.usedSize -= allocation.size;
+
+		UInt32 offset = allocation.offset;
+		UInt32 size = allocation.size;
+
+		// Merge the range with the free ones surrounding it
+		auto next = block.freeRanges.lower_bound(offset);
+		if (next != block.freeRanges.end() && next->first == offset + size)
+		{
+			size += next->second;
+			next = block.freeRanges.erase(next);
+		}
+
+		if (next != block.freeRanges.begin())
+		{
+			auto previous = std::prev(next);
+			if (previous->first + previous->second == offset)
+			{
+				previous->second += size;
+				return;
+			}
+		}
+
+		block.freeRanges.emplace_hint(next, offset, size);
+	}
+
+	void BufferAllocator::OnIndexBufferRelease(const IndexBuffer* indexBuffer)
+	{
+		auto it = m_indexAllocations.find(indexBuffer);
+		NazaraAssert(it != m_indexAllocations.end(), "Index buffer was not allocated by this allocator");
+
+		Free(BufferType_Index, it->second);
+		m_indexAllocations.erase(it);
+	}
+
+	void BufferAllocator::OnVertexBufferRelease(const VertexBuffer* vertexBuffer)
+	{
+		auto it = m_vertexAllocations.find(vertexBuffer);
+		NazaraAssert(it != m_vertexAllocations.end(), "Vertex buffer was not allocated by this allocator");
+
+		Free(BufferType_Vertex, it->second);
+		m_vertexAllocations.erase(it);
+	}
+}
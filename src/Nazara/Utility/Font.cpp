@@ -3,10 +3,17 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Utility/Font.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/ResourceFinalizationQueue.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Utility/Config.hpp>
 #include <Nazara/Utility/FontData.hpp>
 #include <Nazara/Utility/FontGlyph.hpp>
 #include <Nazara/Utility/GuillotineImageAtlas.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
 #include <Nazara/Utility/Debug.hpp>
 
 namespace Nz
@@ -23,10 +30,38 @@ namespace Nz
 		return true; // Rien à tester
 	}
 
+	// Partagé avec les tâches de rastérisation, qui peuvent survivre à la police
+	struct Font::AsyncState
+	{
+		Mutex mutex;
+		std::vector<std::shared_ptr<FontData>> idleFaces; // Protégé par le mutex
+		const Font* font = nullptr;
+		std::size_t pendingGlyphCount = 0;
+		unsigned int cacheGeneration = 0;
+		unsigned int dataGeneration = 0; // Protégé par le mutex
+	};
+
+	struct Font::GlyphBatch
+	{
+		std::u32string characters;
+		std::vector<FontGlyph> glyphs;
+		std::vector<bool> extracted;
+		UInt32 rasterStyle;
+		UInt32 style;
+		unsigned int characterSize;
+		unsigned int distanceFieldSpread;
+		unsigned int rasterSize;
+	};
+
 	Font::Font() :
+	m_asyncState(std::make_shared<AsyncState>()),
+	m_distanceFieldSize(0),
+	m_distanceFieldSpread(8),
 	m_glyphBorder(s_defaultGlyphBorder),
 	m_minimumStepSize(s_defaultMinimumStepSize)
 	{
+		m_asyncState->font = this;
+
 		SetAtlas(s_defaultAtlas);
 	}
 
@@ -36,6 +71,9 @@ namespace Nz
 
 		Destroy();
 		SetAtlas(nullptr); // On libère l'atlas proprement
+
+		// Les glyphes encore en cours de rastérisation seront ignorés
+		m_asyncState->font = nullptr;
 	}
 
 	void Font::ClearGlyphCache()
@@ -49,6 +87,10 @@ namespace Nz
 				// Au moins une autre police utilise cet atlas, on vire nos glyphes un par un
 				for (auto mapIt = m_glyphes.begin(); mapIt != m_glyphes.end(); ++mapIt)
 				{
+					// En mode champ de distance, seuls les glyphes de la taille de référence occupent l'atlas
+					if (m_distanceFieldSize != 0 && (mapIt->first & 0xFFFFFFFF) != ComputeKey(m_distanceFieldSize, TextStyle_Regular))
+						continue;
+
 					GlyphMap& glyphMap = mapIt->second;
 					for (auto glyphIt = glyphMap.begin(); glyphIt != glyphMap.end(); ++glyphIt)
 					{
@@ -59,6 +101,7 @@ namespace Nz
 
 				// Destruction des glyphes mémorisés et notification
 				m_glyphes.clear();
+				InvalidatePendingGlyphs();
 
 				OnFontGlyphCacheCleared(this);
 			}
@@ -102,6 +145,14 @@ namespace Nz
 			OnFontDestroy(this);
 
 			ClearGlyphCache();
+			InvalidatePendingGlyphs();
+
+			// Les copies de la police utilisées par les workers sont libérées dès qu'ils les rendent
+			{
+				LockGuard lock(m_asyncState->mutex);
+				m_asyncState->dataGeneration++;
+				m_asyncState->idleFaces.clear();
+			}
 
 			m_data.reset();
 			m_kerningCache.clear();
@@ -146,6 +197,16 @@ namespace Nz
 		return count;
 	}
 
+	unsigned int Font::GetDistanceFieldSize() const
+	{
+		return m_distanceFieldSize;
+	}
+
+	unsigned int Font::GetDistanceFieldSpread() const
+	{
+		return m_distanceFieldSpread;
+	}
+
 	String Font::GetFamilyName() const
 	{
 		#if NAZARA_UTILITY_SAFE
@@ -203,6 +264,11 @@ namespace Nz
 		return m_minimumStepSize;
 	}
 
+	std::size_t Font::GetPendingGlyphCount() const
+	{
+		return m_asyncState->pendingGlyphCount;
+	}
+
 	const Font::SizeInfo& Font::GetSizeInfo(unsigned int characterSize) const
 	{
 		#if NAZARA_UTILITY_SAFE
@@ -280,6 +346,27 @@ namespace Nz
 		return true;
 	}
 
+	bool Font::PrecacheAsync(unsigned int characterSize, UInt32 style, const String& characterSet) const
+	{
+		#if NAZARA_UTILITY_SAFE
+		if (!IsValid())
+		{
+			NazaraError("Invalid font");
+			return false;
+		}
+		#endif
+
+		std::u32string set = characterSet.GetUtf32String();
+		if (set.empty())
+		{
+			NazaraError("Invalid character set");
+			return false;
+		}
+
+		QueueGlyphs(characterSize, style, set);
+		return true;
+	}
+
 	bool Font::OpenFromFile(const String& filePath, const FontParams& params)
 	{
 		return FontLoader::LoadFromFile(this, filePath, params);
@@ -295,6 +382,22 @@ namespace Nz
 		return FontLoader::LoadFromStream(this, stream, params);
 	}
 
+	const Font::Glyph& Font::RequestGlyph(unsigned int characterSize, UInt32 style, char32_t character) const
+	{
+		// Comme GetGlyph, mais sans attendre la rastérisation: un glyphe en attente (pending) est renvoyé en attendant
+		// qu'un worker ne s'en charge, OnFontGlyphsRasterized étant émis une fois le glyphe inséré dans l'atlas
+		UInt64 key = ComputeKey(characterSize, style);
+		GlyphMap& glyphMap = m_glyphes[key];
+
+		auto it = glyphMap.find(character);
+		if (it != glyphMap.end())
+			return it->second;
+
+		QueueGlyphs(characterSize, style, std::u32string(1, character));
+
+		return glyphMap[character];
+	}
+
 	void Font::SetAtlas(const std::shared_ptr<AbstractAtlas>& atlas)
 	{
 		if (m_atlas != atlas)
@@ -319,6 +422,36 @@ namespace Nz
 		}
 	}
 
+	void Font::SetDistanceFieldSize(unsigned int referenceSize)
+	{
+		// Les glyphes sont alors extraits sous forme de champs de distance signée à cette seule taille,
+		// et servent à toutes les autres (zéro pour revenir à un bitmap par taille)
+		if (m_distanceFieldSize != referenceSize)
+		{
+			ClearGlyphCache();
+			m_distanceFieldSize = referenceSize;
+		}
+	}
+
+	void Font::SetDistanceFieldSpread(unsigned int spread)
+	{
+		if (m_distanceFieldSpread != spread)
+		{
+			#if NAZARA_UTILITY_SAFE
+			if (spread == 0)
+			{
+				NazaraError("Distance field spread cannot be zero");
+				return;
+			}
+			#endif
+
+			if (m_distanceFieldSize != 0)
+				ClearGlyphCache();
+
+			m_distanceFieldSpread = spread;
+		}
+	}
+
 	void Font::SetGlyphBorder(unsigned int borderSize)
 	{
 		if (m_glyphBorder != borderSize)
@@ -418,6 +551,94 @@ namespace Nz
 		return (stylePart << 32) | sizePart;
 	}
 
+	void Font::FinishGlyphBatch(GlyphBatch& batch) const
+	{
+		// Appelé par ResourceFinalizationQueue::Process, le cache n'a pas été vidé depuis la mise en attente des glyphes
+		GlyphMap& rasterMap = m_glyphes[ComputeKey(batch.rasterSize, batch.rasterStyle)];
+		for (std::size_t i = 0; i < batch.characters.size(); ++i)
+		{
+			char32_t character = batch.characters[i];
+
+			// Le glyphe a pu être rastérisé entre-temps par GetGlyph
+			auto it = rasterMap.find(character);
+			if (it == rasterMap.end() || !it->second.pending)
+				continue;
+
+			Glyph& glyph = it->second;
+			glyph.pending = false;
+
+			if (batch.extracted[i])
+				InsertGlyph(glyph, batch.glyphs[i]);
+			else
+				NazaraWarning("Failed to extract glyph \"" + String::Unicode(character) + "\"");
+		}
+
+		// Les glyphes demandés (mis à l'échelle ou au style simulé) découlent de ceux qui viennent d'être rastérisés
+		UInt64 key = ComputeKey(batch.characterSize, batch.style);
+		if (key != ComputeKey(batch.rasterSize, batch.rasterStyle))
+		{
+			GlyphMap& glyphMap = m_glyphes[key];
+			for (char32_t character : batch.characters)
+			{
+				auto it = glyphMap.find(character);
+				if (it != glyphMap.end() && it->second.pending)
+					PrecacheGlyph(glyphMap, batch.characterSize, batch.style, character);
+			}
+		}
+
+		m_asyncState->pendingGlyphCount -= std::min(m_asyncState->pendingGlyphCount, batch.characters.size());
+
+		OnFontGlyphsRasterized(this);
+	}
+
+	bool Font::InsertGlyph(Glyph& glyph, const FontGlyph& fontGlyph) const
+	{
+		if (fontGlyph.image.IsValid())
+		{
+			glyph.atlasRect.width = fontGlyph.image.GetWidth();
+			glyph.atlasRect.height = fontGlyph.image.GetHeight();
+		}
+		else
+		{
+			glyph.atlasRect.width = 0;
+			glyph.atlasRect.height = 0;
+		}
+
+		// Insertion du rectangle dans l'un des atlas
+		if (glyph.atlasRect.width > 0 && glyph.atlasRect.height > 0) // Si l'image contient quelque chose
+		{
+			// Bordure (pour éviter le débordement lors du filtrage)
+			glyph.atlasRect.width += m_glyphBorder*2;
+			glyph.atlasRect.height += m_glyphBorder*2;
+
+			// Insertion du rectangle dans l'atlas virtuel
+			if (!m_atlas->Insert(fontGlyph.image, &glyph.atlasRect, &glyph.flipped, &glyph.layerIndex))
+			{
+				NazaraError("Failed to insert glyph into atlas");
+				return false;
+			}
+
+			// Compensation de la bordure (centrage du glyphe)
+			glyph.atlasRect.x += m_glyphBorder;
+			glyph.atlasRect.y += m_glyphBorder;
+			glyph.atlasRect.width -= m_glyphBorder*2;
+			glyph.atlasRect.height -= m_glyphBorder*2;
+		}
+
+		glyph.aabb = fontGlyph.aabb;
+		glyph.advance = fontGlyph.advance;
+		glyph.valid = true;
+
+		return true;
+	}
+
+	void Font::InvalidatePendingGlyphs() const
+	{
+		// Les glyphes rastérisés avant que le cache ne soit vidé ne doivent pas y être insérés
+		m_asyncState->cacheGeneration++;
+		m_asyncState->pendingGlyphCount = 0;
+	}
+
 	void Font::OnAtlasCleared(const AbstractAtlas* atlas)
 	{
 		NazaraUnused(atlas);
@@ -433,6 +654,7 @@ namespace Nz
 
 		// Notre atlas vient d'être vidé, détruisons le cache de glyphe
 		m_glyphes.clear();
+		InvalidatePendingGlyphs();
 
 		OnFontGlyphCacheCleared(this);
 	}
@@ -475,11 +697,13 @@ namespace Nz
 
 	const Font::Glyph& Font::PrecacheGlyph(GlyphMap& glyphMap, unsigned int characterSize, UInt32 style, char32_t character) const
 	{
+		// Un glyphe en attente d'un worker est rastérisé immédiatement, le worker sera ignoré
 		auto it = glyphMap.find(character);
-		if (it != glyphMap.end()) // Si le glyphe n'est pas déjà chargé
+		if (it != glyphMap.end() && !it->second.pending) // Si le glyphe n'est pas déjà chargé
 			return it->second;
 
 		Glyph& glyph = glyphMap[character]; // Insertion du glyphe
+		glyph.pending = false;
 		glyph.valid = false;
 
 		#if NAZARA_UTILITY_SAFE
@@ -507,49 +731,34 @@ namespace Nz
 			supportedStyle &= ~TextStyle_Italic;
 		}
 
+		// En mode champ de distance, les glyphes de la taille de référence servent à toutes les autres, mis à l'échelle
+		UInt64 referenceKey = ComputeKey(m_distanceFieldSize, style);
+		if (m_distanceFieldSize != 0 && ComputeKey(characterSize, style) != referenceKey)
+		{
+			const Glyph& referenceGlyph = PrecacheGlyph(m_glyphes[referenceKey], m_distanceFieldSize, style, character);
+			if (referenceGlyph.valid)
+			{
+				float scale = static_cast<float>(characterSize) / m_distanceFieldSize;
+
+				glyph = referenceGlyph;
+				glyph.advance = static_cast<int>(std::lround(referenceGlyph.advance * scale));
+				glyph.aabb.x = static_cast<int>(std::lround(referenceGlyph.aabb.x * scale));
+				glyph.aabb.y = static_cast<int>(std::lround(referenceGlyph.aabb.y * scale));
+				glyph.aabb.width = static_cast<int>(std::lround(referenceGlyph.aabb.width * scale));
+				glyph.aabb.height = static_cast<int>(std::lround(referenceGlyph.aabb.height * scale));
+			}
+
+			return glyph;
+		}
+
 		// Est-ce que la police supporte le style demandé ?
 		if (style == supportedStyle)
 		{
 			// On extrait le glyphe depuis la police
 			FontGlyph fontGlyph;
-			if (ExtractGlyph(characterSize, character, style, &fontGlyph))
-			{
-				if (fontGlyph.image.IsValid())
-				{
-					glyph.atlasRect.width = fontGlyph.image.GetWidth();
-					glyph.atlasRect.height = fontGlyph.image.GetHeight();
-				}
-				else
-				{
-					glyph.atlasRect.width = 0;
-					glyph.atlasRect.height = 0;
-				}
-
-				// Insertion du rectangle dans l'un des atlas
-				if (glyph.atlasRect.width > 0 && glyph.atlasRect.height > 0) // Si l'image contient quelque chose
-				{
-					// Bordure (pour éviter le débordement lors du filtrage)
-					glyph.atlasRect.width += m_glyphBorder*2;
-					glyph.atlasRect.height += m_glyphBorder*2;
-
-					// Insertion du rectangle dans l'atlas virtuel
-					if (!m_atlas->Insert(fontGlyph.image, &glyph.atlasRect, &glyph.flipped, &glyph.layerIndex))
-					{
-						NazaraError("Failed to insert glyph into atlas");
-						return glyph;
-					}
-
-					// Compensation de la bordure (centrage du glyphe)
-					glyph.atlasRect.x += m_glyphBorder;
-					glyph.atlasRect.y += m_glyphBorder;
-					glyph.atlasRect.width -= m_glyphBorder*2;
-					glyph.atlasRect.height -= m_glyphBorder*2;
-				}
-
-				glyph.aabb = fontGlyph.aabb;
-				glyph.advance = fontGlyph.advance;
-				glyph.valid = true;
-			}
+			bool extracted = (m_distanceFieldSize != 0) ? m_data->ExtractDistanceField(characterSize, character, style, m_distanceFieldSpread, &fontGlyph) : ExtractGlyph(characterSize, character, style, &fontGlyph);
+			if (extracted)
+				InsertGlyph(glyph, fontGlyph);
 			else
 			{
 				NazaraWarning("Failed to extract glyph \"" + String::Unicode(character) + "\"");
@@ -575,6 +784,158 @@ namespace Nz
 		return glyph;
 	}
 
+	void Font::QueueGlyphs(unsigned int characterSize, UInt32 style, const std::u32string& characters) const
+	{
+		UInt64 key = ComputeKey(characterSize, style);
+		GlyphMap& glyphMap = m_glyphes[key];
+
+		if (!m_data || !m_atlas)
+		{
+			for (char32_t character : characters)
+				PrecacheGlyph(glyphMap, characterSize, style, character);
+
+			return;
+		}
+
+		// Les glyphes sont rastérisés tels que PrecacheGlyph les extrairait (au style supporté, à la taille de référence en mode champ de distance)
+		UInt32 rasterStyle = style;
+		if (style & TextStyle_Bold && !m_data->SupportsStyle(TextStyle_Bold))
+			rasterStyle &= ~TextStyle_Bold;
+
+		if (style & TextStyle_Italic && !m_data->SupportsStyle(TextStyle_Italic))
+			rasterStyle &= ~TextStyle_Italic;
+
+		unsigned int rasterSize = (m_distanceFieldSize != 0) ? m_distanceFieldSize : characterSize;
+		UInt64 rasterKey = ComputeKey(rasterSize, rasterStyle);
+		GlyphMap& rasterMap = m_glyphes[rasterKey];
+
+		std::u32string missingCharacters;
+		for (char32_t character : characters)
+		{
+			if (glyphMap.find(character) != glyphMap.end() || missingCharacters.find(character) != std::u32string::npos)
+				continue;
+
+			// Le glyphe rastérisé est déjà là, il ne reste qu'à le dériver
+			auto it = rasterMap.find(character);
+			if (it != rasterMap.end() && !it->second.pending)
+				PrecacheGlyph(glyphMap, characterSize, style, character);
+			else
+				missingCharacters.push_back(character);
+		}
+
+		if (missingCharacters.empty())
+			return;
+
+		// Chaque worker utilise sa propre copie de la police, une police ne pouvant être utilisée par plusieurs threads à la fois
+		std::size_t maxTaskCount = std::min<std::size_t>(std::max(TaskScheduler::GetWorkerCount(), 1U), missingCharacters.size());
+
+		std::vector<std::shared_ptr<FontData>> faces;
+		unsigned int dataGeneration;
+		{
+			LockGuard lock(m_asyncState->mutex);
+			dataGeneration = m_asyncState->dataGeneration;
+
+			while (faces.size() < maxTaskCount && !m_asyncState->idleFaces.empty())
+			{
+				faces.push_back(std::move(m_asyncState->idleFaces.back()));
+				m_asyncState->idleFaces.pop_back();
+			}
+		}
+
+		while (faces.size() < maxTaskCount)
+		{
+			std::shared_ptr<FontData> face(m_data->Clone());
+			if (!face)
+				break;
+
+			faces.push_back(std::move(face));
+		}
+
+		// Police ne pouvant être rouverte (ouverte depuis un stream): rastérisation immédiate
+		if (faces.empty())
+		{
+			for (char32_t character : missingCharacters)
+				PrecacheGlyph(glyphMap, characterSize, style, character);
+
+			return;
+		}
+
+		Glyph placeholder;
+		placeholder.aabb.MakeZero();
+		placeholder.atlasRect.MakeZero();
+		placeholder.advance = 0;
+		placeholder.flipped = false;
+		placeholder.layerIndex = 0;
+		placeholder.pending = true;
+		placeholder.requireFauxBold = false;
+		placeholder.requireFauxItalic = false;
+		placeholder.valid = false;
+
+		for (char32_t character : missingCharacters)
+		{
+			glyphMap[character] = placeholder;
+			rasterMap.emplace(character, placeholder);
+		}
+
+		m_asyncState->pendingGlyphCount += missingCharacters.size();
+
+		std::shared_ptr<AsyncState> state = m_asyncState;
+		unsigned int cacheGeneration = m_asyncState->cacheGeneration;
+		unsigned int spread = (m_distanceFieldSize != 0) ? m_distanceFieldSpread : 0;
+
+		std::size_t taskCount = faces.size();
+		for (std::size_t i = 0; i < taskCount; ++i)
+		{
+			std::size_t first = missingCharacters.size() * i / taskCount;
+			std::size_t last = missingCharacters.size() * (i + 1) / taskCount;
+
+			std::shared_ptr<GlyphBatch> batch = std::make_shared<GlyphBatch>();
+			batch->characters = missingCharacters.substr(first, last - first);
+			batch->characterSize = characterSize;
+			batch->distanceFieldSpread = spread;
+			batch->rasterSize = rasterSize;
+			batch->rasterStyle = rasterStyle;
+			batch->style = style;
+
+			std::shared_ptr<FontData> face = std::move(faces[i]);
+			TaskScheduler::AddTask([state, face, batch, dataGeneration, cacheGeneration]()
+			{
+				{
+					LockGuard lock(state->mutex);
+					if (state->dataGeneration != dataGeneration)
+						return; // La police a été détruite ou rouverte entre-temps
+				}
+
+				std::size_t count = batch->characters.size();
+				batch->extracted.resize(count);
+				batch->glyphs.resize(count);
+
+				for (std::size_t j = 0; j < count; ++j)
+				{
+					if (batch->distanceFieldSpread != 0)
+						batch->extracted[j] = face->ExtractDistanceField(batch->rasterSize, batch->characters[j], batch->rasterStyle, batch->distanceFieldSpread, &batch->glyphs[j]);
+					else
+						batch->extracted[j] = face->ExtractGlyph(batch->rasterSize, batch->characters[j], batch->rasterStyle, &batch->glyphs[j]);
+				}
+
+				{
+					LockGuard lock(state->mutex);
+					if (state->dataGeneration == dataGeneration)
+						state->idleFaces.push_back(face);
+				}
+
+				// L'atlas n'est modifié que par le thread traitant la file de finalisation
+				ResourceFinalizationQueue::Enqueue([state, batch, cacheGeneration]()
+				{
+					if (state->font && state->cacheGeneration == cacheGeneration)
+						state->font->FinishGlyphBatch(*batch);
+				});
+			});
+		}
+
+		TaskScheduler::Run();
+	}
+
 	bool Font::Initialize()
 	{
 		if (!FontLibrary::Initialize())
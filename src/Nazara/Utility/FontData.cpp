@@ -3,9 +3,198 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Utility/FontData.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Utility/FontGlyph.hpp>
+#include <Nazara/Utility/Image.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
 #include <Nazara/Utility/Debug.hpp>
 
 namespace Nz
 {
+	namespace
+	{
+		constexpr double s_infiniteDistance = 1e20;
+
+		// Squared euclidean distance transform of a row or a column (Felzenszwalb & Huttenlocher), in place
+		void TransformDistances(double* distances, std::size_t count, std::size_t stride, std::vector<double>& values, std::vector<std::size_t>& parabolas, std::vector<double>& boundaries)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+				values[i] = distances[i * stride];
+
+			// Lower envelope of the parabolas rooted at each sample
+			std::size_t k = 0;
+			parabolas[0] = 0;
+			boundaries[0] = -s_infiniteDistance;
+			boundaries[1] = s_infiniteDistance;
+
+			for (std::size_t q = 1; q < count; ++q)
+			{
+				double s;
+				for (;;)
+				{
+					std::size_t r = parabolas[k];
+					s = ((values[q] + q * q) - (values[r] + r * r)) / (2.0 * q - 2.0 * r);
+					if (s > boundaries[k] || k == 0)
+						break;
+
+					k--;
+				}
+
+				k++;
+				parabolas[k] = q;
+				boundaries[k] = s;
+				boundaries[k + 1] = s_infiniteDistance;
+			}
+
+			k = 0;
+			for (std::size_t q = 0; q < count; ++q)
+			{
+				while (boundaries[k + 1] < q)
+					k++;
+
+				std::size_t r = parabolas[k];
+				double offset = double(q) - double(r);
+				distances[q * stride] = offset * offset + values[r];
+			}
+		}
+
+		void TransformDistances(std::vector<double>& distances, std::size_t width, std::size_t height)
+		{
+			std::size_t maxSize = std::max(width, height);
+
+			std::vector<double> values(maxSize);
+			std::vector<std::size_t> parabolas(maxSize);
+			std::vector<double> boundaries(maxSize + 1);
+
+			for (std::size_t x = 0; x < width; ++x)
+				TransformDistances(&distances[x], height, width, values, parabolas, boundaries);
+
+			for (std::size_t y = 0; y < height; ++y)
+				TransformDistances(&distances[y * width], width, 1, values, parabolas, boundaries);
+		}
+	}
+
 	FontData::~FontData() = default;
+
+	/*!
+	* \brief Opens another instance of the same font
+	* \return New font data, to be owned by the caller, or nullptr if the font can't be opened twice
+	*
+	* Fonts rasterize their glyphs in the background with one clone per worker, as a font data is not meant to be used by multiple threads at once.
+	*
+	* \remark The default implementation returns nullptr, glyphs are then rasterized by the thread processing the ResourceFinalizationQueue
+	*/
+	FontData* FontData::Clone() const
+	{
+		return nullptr;
+	}
+
+	/*!
+	* \brief Extracts the signed distance field of a glyph
+	* \return true If successful
+	*
+	* The default implementation computes it from the bitmap extracted by ExtractGlyph, the box of the glyph is enlarged by the spread.
+	*
+	* \param characterSize Size of the extracted glyph
+	* \param character Character to extract
+	* \param style Style of the character
+	* \param spread Distance from the contour, in pixels, at which the field saturates
+	* \param dst Glyph receiving the distance field in its image
+	*/
+
+	bool FontData::ExtractDistanceField(unsigned int characterSize, char32_t character, UInt32 style, unsigned int spread, FontGlyph* dst)
+	{
+		if (!ExtractGlyph(characterSize, character, style, dst))
+			return false;
+
+		if (dst->image.IsValid())
+		{
+			Image coverage = std::move(dst->image);
+			ComputeDistanceField(coverage, spread, 1, &dst->image);
+
+			dst->aabb.x -= spread;
+			dst->aabb.y -= spread;
+			dst->aabb.width = dst->image.GetWidth();
+			dst->aabb.height = dst->image.GetHeight();
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Computes a signed distance field from the coverage of a glyph
+	*
+	* The field is stored in an A8 image, 0.5 lying on the contour and values increasing inside the glyph.
+	* The image is enlarged by the spread on every side, so the field can fade out.
+	*
+	* \param coverage A8 image of the glyph, pixels with a coverage of at least a half are inside it
+	* \param spread Distance from the contour, in pixels of the field, at which the field saturates
+	* \param downscale Factor the coverage image is bigger than the field by, an oversampled coverage gives a more accurate field
+	* \param distanceField Image receiving the distance field
+	*/
+
+	void FontData::ComputeDistanceField(const Image& coverage, unsigned int spread, unsigned int downscale, Image* distanceField)
+	{
+		NazaraAssert(coverage.GetFormat() == PixelFormatType_A8, "Coverage must be an A8 image");
+		NazaraAssert(spread > 0, "Spread must be over zero");
+		NazaraAssert(downscale > 0, "Downscale must be over zero");
+		NazaraAssert(distanceField, "Invalid distance field");
+
+		unsigned int coverageWidth = coverage.GetWidth();
+		unsigned int coverageHeight = coverage.GetHeight();
+
+		unsigned int width = (coverageWidth + downscale - 1) / downscale + 2 * spread;
+		unsigned int height = (coverageHeight + downscale - 1) / downscale + 2 * spread;
+
+		// Squared distances to the nearest pixel inside and outside the glyph, on the grid of the coverage
+		unsigned int padding = spread * downscale;
+		std::size_t gridWidth = width * downscale;
+		std::size_t gridHeight = height * downscale;
+
+		std::vector<double> insideDistances(gridWidth * gridHeight);
+		std::vector<double> outsideDistances(gridWidth * gridHeight);
+
+		const UInt8* pixels = coverage.GetConstPixels();
+		for (std::size_t y = 0; y < gridHeight; ++y)
+		{
+			for (std::size_t x = 0; x < gridWidth; ++x)
+			{
+				bool inside = false;
+				if (x >= padding && y >= padding && x - padding < coverageWidth && y - padding < coverageHeight)
+					inside = (pixels[(y - padding) * coverageWidth + x - padding] >= 128);
+
+				std::size_t index = y * gridWidth + x;
+				insideDistances[index] = (inside) ? 0.0 : s_infiniteDistance;
+				outsideDistances[index] = (inside) ? s_infiniteDistance : 0.0;
+			}
+		}
+
+		TransformDistances(insideDistances, gridWidth, gridHeight);
+		TransformDistances(outsideDistances, gridWidth, gridHeight);
+
+		distanceField->Create(ImageType_2D, PixelFormatType_A8, width, height);
+		UInt8* distancePixels = distanceField->GetPixels();
+
+		double maxDistance = 2.0 * padding;
+		for (unsigned int y = 0; y < height; ++y)
+		{
+			for (unsigned int x = 0; x < width; ++x)
+			{
+				// Each pixel of the field samples the center of its block of the grid
+				std::size_t index = (y * downscale + downscale / 2) * gridWidth + x * downscale + downscale / 2;
+
+				// The contour lies halfway between an inside and an outside pixel
+				double distance;
+				if (insideDistances[index] == 0.0)
+					distance = std::sqrt(outsideDistances[index]) - 0.5;
+				else
+					distance = 0.5 - std::sqrt(insideDistances[index]);
+
+				double value = std::min(std::max(0.5 + distance / maxDistance, 0.0), 1.0);
+				*distancePixels++ = static_cast<UInt8>(value * 255.0 + 0.5);
+			}
+		}
+	}
 }
@@ -8,6 +8,66 @@
 
 namespace Nz
 {
+	bool Serialize(SerializationContext& context, const DDSHeader& header)
+	{
+		if (!Serialize(context, header.size))
+			return false;
+		if (!Serialize(context, header.flags))
+			return false;
+		if (!Serialize(context, header.height))
+			return false;
+		if (!Serialize(context, header.width))
+			return false;
+		if (!Serialize(context, header.pitch))
+			return false;
+		if (!Serialize(context, header.depth))
+			return false;
+		if (!Serialize(context, header.levelCount))
+			return false;
+
+		for (unsigned int i = 0; i < CountOf(header.reserved1); ++i)
+		{
+			if (!Serialize(context, header.reserved1[i]))
+				return false;
+		}
+
+		if (!Serialize(context, header.format))
+			return false;
+
+		for (unsigned int i = 0; i < CountOf(header.ddsCaps); ++i)
+		{
+			if (!Serialize(context, header.ddsCaps[i]))
+				return false;
+		}
+
+		if (!Serialize(context, header.reserved2))
+			return false;
+
+		return true;
+	}
+
+	bool Serialize(SerializationContext& context, const DDSPixelFormat& pixelFormat)
+	{
+		if (!Serialize(context, pixelFormat.size))
+			return false;
+		if (!Serialize(context, pixelFormat.flags))
+			return false;
+		if (!Serialize(context, pixelFormat.fourCC))
+			return false;
+		if (!Serialize(context, pixelFormat.bpp))
+			return false;
+		if (!Serialize(context, pixelFormat.redMask))
+			return false;
+		if (!Serialize(context, pixelFormat.greenMask))
+			return false;
+		if (!Serialize(context, pixelFormat.blueMask))
+			return false;
+		if (!Serialize(context, pixelFormat.alphaMask))
+			return false;
+
+		return true;
+	}
+
 	bool Unserialize(SerializationContext& context, DDSHeader* header)
 	{
 		if (!Unserialize(context, &header->size))
@@ -369,6 +369,9 @@ namespace Nz
 		UInt32 reserved;
 	};
 
+	NAZARA_UTILITY_API bool Serialize(SerializationContext& context, const DDSHeader& header);
+	NAZARA_UTILITY_API bool Serialize(SerializationContext& context, const DDSPixelFormat& pixelFormat);
+
 	NAZARA_UTILITY_API bool Unserialize(SerializationContext& context, DDSHeader* header);
 	NAZARA_UTILITY_API bool Unserialize(SerializationContext& context, DDSHeaderDX10Ext* header);
 	NAZARA_UTILITY_API bool Unserialize(SerializationContext& context, DDSPixelFormat* pixelFormat);
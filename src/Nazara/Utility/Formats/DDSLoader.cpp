@@ -199,7 +199,7 @@ namespace Nz
 							break;
 
 						case D3DFMT_DXT5:
-							*format = PixelFormatType_DXT3;
+							*format = PixelFormatType_DXT5;
 							break;
 
 						case D3DFMT_DX10:
@@ -0,0 +1,173 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/Formats/DDSSaver.hpp>
+#include <Nazara/Core/ByteStream.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Utility/Image.hpp>
+#include <Nazara/Utility/PixelFormat.hpp>
+#include <Nazara/Utility/Formats/DDSConstants.hpp>
+#include <cstring>
+#include <Nazara/Utility/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		bool IsSupported(const String& extension)
+		{
+			return (extension == "dds");
+		}
+
+		bool SaveToStream(const Image& image, const String& format, Stream& stream, const ImageParams& parameters)
+		{
+			NazaraUnused(format);
+			NazaraUnused(parameters);
+
+			if (!image.IsValid())
+			{
+				NazaraError("Invalid image");
+				return false;
+			}
+
+			ImageType type = image.GetType();
+			if (type != ImageType_1D && type != ImageType_2D && type != ImageType_3D && type != ImageType_Cubemap)
+			{
+				NazaraError("Image type 0x" + String::Number(type, 16) + " is not in a supported format");
+				return false;
+			}
+
+			Image tempImage(image); //< We're using COW here to prevent Image copy unless required
+
+			DDSPixelFormat pixelFormat;
+			std::memset(&pixelFormat, 0, sizeof(DDSPixelFormat));
+			pixelFormat.size = 32;
+
+			// Compressed formats are stored as is, other ones as 32 bits RGBA/BGRA (DDS masks are little-endian)
+			switch (tempImage.GetFormat())
+			{
+				case PixelFormatType_DXT1:
+					pixelFormat.flags = DDPF_FOURCC;
+					pixelFormat.fourCC = D3DFMT_DXT1;
+					break;
+
+				case PixelFormatType_DXT3:
+					pixelFormat.flags = DDPF_FOURCC;
+					pixelFormat.fourCC = D3DFMT_DXT3;
+					break;
+
+				case PixelFormatType_DXT5:
+					pixelFormat.flags = DDPF_FOURCC;
+					pixelFormat.fourCC = D3DFMT_DXT5;
+					break;
+
+				case PixelFormatType_BGRA8:
+					pixelFormat.flags = DDPF_RGB | DDPF_ALPHAPIXELS;
+					pixelFormat.bpp = 32;
+					pixelFormat.redMask = 0x00FF0000;
+					pixelFormat.greenMask = 0x0000FF00;
+					pixelFormat.blueMask = 0x000000FF;
+					pixelFormat.alphaMask = 0xFF000000;
+					break;
+
+				default:
+					if (!tempImage.Convert(PixelFormatType_RGBA8))
+					{
+						NazaraError("Failed to convert image to a suitable format");
+						return false;
+					}
+
+					pixelFormat.flags = DDPF_RGB | DDPF_ALPHAPIXELS;
+					pixelFormat.bpp = 32;
+					pixelFormat.redMask = 0x000000FF;
+					pixelFormat.greenMask = 0x0000FF00;
+					pixelFormat.blueMask = 0x00FF0000;
+					pixelFormat.alphaMask = 0xFF000000;
+					break;
+			}
+
+			PixelFormatType pixelFormatType = tempImage.GetFormat();
+			bool compressed = PixelFormat::IsCompressed(pixelFormatType);
+			unsigned int levelCount = tempImage.GetLevelCount();
+
+			DDSHeader header;
+			std::memset(&header, 0, sizeof(DDSHeader));
+			header.size = 124;
+			header.flags = DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT;
+			header.height = tempImage.GetHeight();
+			header.width = tempImage.GetWidth();
+			header.levelCount = levelCount;
+			header.format = pixelFormat;
+			header.ddsCaps[0] = DDSCAPS_TEXTURE;
+
+			if (compressed)
+			{
+				header.flags |= DDSD_LINEARSIZE;
+				header.pitch = static_cast<UInt32>(PixelFormat::ComputeSize(pixelFormatType, header.width, header.height, 1));
+			}
+			else
+			{
+				header.flags |= DDSD_PITCH;
+				header.pitch = header.width * PixelFormat::GetBytesPerPixel(pixelFormatType);
+			}
+
+			if (levelCount > 1)
+			{
+				header.flags |= DDSD_MIPMAPCOUNT;
+				header.ddsCaps[0] |= DDSCAPS_COMPLEX | DDSCAPS_MIPMAP;
+			}
+
+			if (type == ImageType_3D)
+			{
+				header.flags |= DDSD_DEPTH;
+				header.depth = tempImage.GetDepth();
+				header.ddsCaps[0] |= DDSCAPS_COMPLEX;
+				header.ddsCaps[1] = DDSCAPS2_VOLUME;
+			}
+			else if (type == ImageType_Cubemap)
+			{
+				header.ddsCaps[0] |= DDSCAPS_COMPLEX;
+				header.ddsCaps[1] = DDSCAPS2_CUBEMAP | DDSCAPS2_CUBEMAP_ALLFACES;
+			}
+
+			ByteStream byteStream(&stream);
+			byteStream.SetDataEndianness(Endianness_LittleEndian);
+			byteStream << DDS_Magic << header;
+
+			// Volumes are stored level by level, cubemaps face by face (each face with its mipmaps)
+			unsigned int faceCount = (type == ImageType_Cubemap) ? 6 : 1;
+			for (unsigned int face = 0; face < faceCount; ++face)
+			{
+				for (unsigned int level = 0; level < levelCount; ++level)
+				{
+					unsigned int depth = (type == ImageType_Cubemap) ? 1 : tempImage.GetDepth(static_cast<UInt8>(level));
+					std::size_t byteCount = PixelFormat::ComputeSize(pixelFormatType, tempImage.GetWidth(static_cast<UInt8>(level)), tempImage.GetHeight(static_cast<UInt8>(level)), depth);
+
+					// GetConstPixels doesn't handle compressed faces, faces of a level are contiguous anyway
+					const UInt8* pixels = tempImage.GetConstPixels(0, 0, 0, static_cast<UInt8>(level)) + face * byteCount;
+					if (byteStream.Write(pixels, byteCount) != byteCount)
+					{
+						NazaraError("Failed to write level #" + String::Number(level));
+						return false;
+					}
+				}
+			}
+
+			return true;
+		}
+	}
+
+	namespace Loaders
+	{
+		void RegisterDDSSaver()
+		{
+			ImageSaver::RegisterSaver(IsSupported, SaveToStream);
+		}
+
+		void UnregisterDDSSaver()
+		{
+			ImageSaver::UnregisterSaver(IsSupported, SaveToStream);
+		}
+	}
+}
@@ -8,11 +8,14 @@
 #include FT_BITMAP_H
 #include FT_OUTLINE_H
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/LockGuard.hpp>
 #include <Nazara/Core/MemoryView.hpp>
+#include <Nazara/Core/Mutex.hpp>
 #include <Nazara/Core/Stream.hpp>
 #include <Nazara/Utility/Font.hpp>
 #include <Nazara/Utility/FontData.hpp>
 #include <Nazara/Utility/FontGlyph.hpp>
+#include <cmath>
 #include <memory>
 #include <set>
 #include <Nazara/Utility/Debug.hpp>
@@ -26,6 +29,8 @@ namespace Nz
 		FT_Library s_library;
 		std::shared_ptr<FreeTypeLibrary> s_libraryOwner;
 		float s_invScaleFactor = 1.f / (1 << 6); // 1/64
+		Mutex s_faceMutex; // FreeType ne permet pas de créer ou détruire des faces d'une même bibliothèque en parallèle
+		unsigned int s_distanceFieldOversampling = 4;
 
 		extern "C"
 		unsigned long FT_StreamRead(FT_Stream stream, unsigned long offset, unsigned char* buffer, unsigned long count)
@@ -80,6 +85,8 @@ namespace Nz
 				FreeTypeStream() :
 				m_face(nullptr),
 				m_library(s_libraryOwner),
+				m_memorySize(0),
+				m_memoryData(nullptr),
 				m_characterSize(0)
 				{
 				}
@@ -87,15 +94,76 @@ namespace Nz
 				~FreeTypeStream()
 				{
 					if (m_face)
+					{
+						LockGuard lock(s_faceMutex);
 						FT_Done_Face(m_face);
+					}
 				}
 
 				bool Check()
 				{
 					// Test d'ouverture (http://www.freetype.org/freetype2/docs/reference/ft2-base_interface.html#FT_Open_Face)
+					LockGuard lock(s_faceMutex);
 					return FT_Open_Face(s_library, &m_args, -1, nullptr) == 0;
 				}
 
+				FontData* Clone() const override
+				{
+					// Seules les polices dont on connaît la source peuvent être rouvertes, un stream ne pouvant être lu par plusieurs faces à la fois
+					std::unique_ptr<FreeTypeStream> face(new FreeTypeStream);
+					if (!m_filePath.IsEmpty())
+					{
+						if (!face->SetFile(m_filePath))
+							return nullptr;
+					}
+					else if (m_memoryData)
+						face->SetMemory(m_memoryData, m_memorySize);
+					else
+						return nullptr;
+
+					if (!face->Open())
+						return nullptr;
+
+					return face.release();
+				}
+
+				bool ExtractDistanceField(unsigned int characterSize, char32_t character, UInt32 style, unsigned int spread, FontGlyph* dst) override
+				{
+					// Les polices bitmap ne peuvent être rendues à une autre taille que la leur
+					if (!FT_IS_SCALABLE(m_face))
+						return FontData::ExtractDistanceField(characterSize, character, style, spread, dst);
+
+					// Le glyphe est rendu à une résolution plus élevée, la distance au contour n'en est que plus précise
+					unsigned int oversampling = s_distanceFieldOversampling;
+					if (!ExtractGlyph(characterSize * oversampling, character, style, dst))
+						return false;
+
+					float invOversampling = 1.f / oversampling;
+
+					dst->advance = static_cast<int>(std::lround(dst->advance * invOversampling));
+					dst->aabb.x = static_cast<int>(std::lround(dst->aabb.x * invOversampling));
+					dst->aabb.y = static_cast<int>(std::lround(dst->aabb.y * invOversampling));
+
+					if (dst->image.IsValid())
+					{
+						Image coverage = std::move(dst->image);
+						ComputeDistanceField(coverage, spread, oversampling, &dst->image);
+
+						// Le champ de distance déborde du glyphe pour pouvoir s'estomper
+						dst->aabb.x -= spread;
+						dst->aabb.y -= spread;
+						dst->aabb.width = dst->image.GetWidth();
+						dst->aabb.height = dst->image.GetHeight();
+					}
+					else
+					{
+						dst->aabb.width = static_cast<int>(std::lround(dst->aabb.width * invOversampling));
+						dst->aabb.height = static_cast<int>(std::lround(dst->aabb.height * invOversampling));
+					}
+
+					return true;
+				}
+
 				bool ExtractGlyph(unsigned int characterSize, char32_t character, UInt32 style, FontGlyph* dst) override
 				{
 					#ifdef NAZARA_DEBUG
@@ -223,6 +291,7 @@ namespace Nz
 
 				bool Open()
 				{
+					LockGuard lock(s_faceMutex);
 					return FT_Open_Face(s_library, &m_args, 0, &m_face) == 0;
 				}
 
@@ -289,6 +358,7 @@ namespace Nz
 					m_ownedStream = std::move(file);
 
 					SetStream(*m_ownedStream);
+					m_filePath = filePath;
 					return true;
 				}
 
@@ -296,10 +366,16 @@ namespace Nz
 				{
 					m_ownedStream.reset(new MemoryView(data, size));
 					SetStream(*m_ownedStream);
+					m_memoryData = data;
+					m_memorySize = size;
 				}
 
 				void SetStream(Stream& stream)
 				{
+					m_filePath.Clear();
+					m_memoryData = nullptr;
+					m_memorySize = 0;
+
 					m_stream.base = nullptr;
 					m_stream.close = FT_StreamClose;
 					m_stream.descriptor.pointer = &stream;
@@ -333,6 +409,9 @@ namespace Nz
 				FT_StreamRec m_stream;
 				std::shared_ptr<FreeTypeLibrary> m_library;
 				std::unique_ptr<Stream> m_ownedStream;
+				std::size_t m_memorySize;
+				const void* m_memoryData;
+				String m_filePath;
 				mutable unsigned int m_characterSize;
 		};
 
@@ -7,6 +7,8 @@
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/Stream.hpp>
 #include <Nazara/Math/Quaternion.hpp>
+#include <Nazara/Utility/Algorithm.hpp>
+#include <Nazara/Utility/BufferAllocator.hpp>
 #include <Nazara/Utility/MaterialData.hpp>
 #include <Nazara/Utility/Mesh.hpp>
 #include <Nazara/Utility/StaticMesh.hpp>
@@ -139,10 +141,6 @@ namespace Nz
 
 			indexMapper.Unmap();
 
-			// Optimize if requested (improves cache locality)
-			if (parameters.optimizeIndexBuffers)
-				indexBuffer->Optimize();
-
 			// Extracting texture coordinates
 			std::vector<MD2_TexCoord> texCoords(header.num_st);
 
@@ -253,6 +251,18 @@ namespace Nz
 			if (parameters.vertexDeclaration->HasComponentOfType<Vector3f>(VertexComponent_Tangent))
 				subMesh->GenerateTangents();
 
+			// Optimize if requested (improves cache locality)
+			OptimizeMesh(vertexBuffer, indexBuffer, parameters);
+
+			if (parameters.compressedVertexDeclaration)
+				ConvertVertices(vertexBuffer, parameters.compressedVertexDeclaration);
+
+			if (parameters.bufferAllocator)
+			{
+				parameters.bufferAllocator->Relocate(indexBuffer);
+				parameters.bufferAllocator->Relocate(vertexBuffer);
+			}
+
 			mesh->AddSubMesh(subMesh);
 
 			if (parameters.center)
@@ -5,35 +5,37 @@
 #include <Nazara/Utility/Formats/MD5AnimParser.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Utility/Config.hpp>
-#include <cstdio>
 #include <Nazara/Utility/Debug.hpp>
 
 namespace Nz
 {
+	namespace
+	{
+		constexpr UInt64 CheckedSize = 4 * 1024; //< The version is given by the first line
+
+		bool ReadVector(TextScanner& scanner, Vector3f* vector)
+		{
+			return scanner.Expect('(') && scanner.Read(&vector->x) && scanner.Read(&vector->y) && scanner.Read(&vector->z) && scanner.Expect(')');
+		}
+	}
+
 	MD5AnimParser::MD5AnimParser(Stream& stream) :
 	m_stream(stream),
-	m_streamFlags(stream.GetStreamOptions()), //< Saves stream flags
 	m_keepLastLine(false),
 	m_frameIndex(0),
-	m_frameRate(0),
-	m_lineCount(0)
+	m_frameRate(0)
 	{
-		m_stream.EnableTextMode(true);
-	}
-
-	MD5AnimParser::~MD5AnimParser()
-	{
-		// Reset stream flags
-		if ((m_streamFlags & StreamOption_Text) == 0)
-			m_stream.EnableTextMode(false);
 	}
 
 	Ternary MD5AnimParser::Check()
 	{
-		if (Advance(false))
+		TextScanner scanner(m_stream, CheckedSize);
+		scanner.SetCommentMarker("//");
+
+		if (scanner.NextLine())
 		{
-			unsigned int version;
-			if (std::sscanf(&m_currentLine[0], " MD5Version %u", &version) == 1)
+			UInt32 version;
+			if (scanner.ExpectWord("MD5Version") && scanner.Read(&version))
 			{
 				if (version == 10)
 					return Ternary_True;
@@ -75,19 +77,23 @@ namespace Nz
 
 	bool MD5AnimParser::Parse()
 	{
+		// The text is parsed in place when the stream lives in memory (mapped file, archive entry)
+		m_scanner = TextScanner(m_stream);
+		m_scanner.SetCommentMarker("//");
+
 		while (Advance(false))
 		{
-			switch (m_currentLine[0])
+			switch (*m_scanner.GetCursor())
 			{
 				#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
 				case 'M': // MD5Version
-					if (m_currentLine.GetWord(0) != "MD5Version")
+					if (!m_scanner.ExpectWord("MD5Version"))
 						UnrecognizedLine();
 					break;
 				#endif
 
 				case 'b': // baseframe/bounds
-					if (m_currentLine.StartsWith("baseframe {"))
+					if (m_scanner.ExpectWord("baseframe") && m_scanner.Expect('{'))
 					{
 						if (!ParseBaseframe())
 						{
@@ -95,7 +101,7 @@ namespace Nz
 							return false;
 						}
 					}
-					else if (m_currentLine.StartsWith("bounds {"))
+					else if (m_scanner.ExpectWord("bounds") && m_scanner.Expect('{'))
 					{
 						if (!ParseBounds())
 						{
@@ -111,15 +117,15 @@ namespace Nz
 
 				#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
 				case 'c': // commandline
-					if (m_currentLine.GetWord(0) != "commandline")
+					if (!m_scanner.ExpectWord("commandline"))
 						UnrecognizedLine();
 					break;
 				#endif
 
 				case 'f':
 				{
-					unsigned int index;
-					if (std::sscanf(&m_currentLine[0], "frame %u {", &index) == 1)
+					UInt32 index;
+					if (m_scanner.ExpectWord("frame") && m_scanner.Read(&index) && m_scanner.Expect('{'))
 					{
 						if (m_frameIndex != index)
 						{
@@ -135,7 +141,7 @@ namespace Nz
 
 						m_frameIndex++;
 					}
-					else if (std::sscanf(&m_currentLine[0], "frameRate %u", &m_frameRate) != 1)
+					else if (!m_scanner.ExpectWord("frameRate") || !m_scanner.Read(&m_frameRate))
 					{
 						#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
 						UnrecognizedLine();
@@ -145,7 +151,7 @@ namespace Nz
 				}
 
 				case 'h': // hierarchy
-					if (m_currentLine.StartsWith("hierarchy {"))
+					if (m_scanner.ExpectWord("hierarchy") && m_scanner.Expect('{'))
 					{
 						if (!ParseHierarchy())
 						{
@@ -161,8 +167,8 @@ namespace Nz
 
 				case 'n': // num[Frames/Joints]
 				{
-					unsigned int count;
-					if (std::sscanf(&m_currentLine[0], "numAnimatedComponents %u", &count) == 1)
+					UInt32 count;
+					if (m_scanner.ExpectWord("numAnimatedComponents") && m_scanner.Read(&count))
 					{
 						#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
 						if (!m_animatedComponents.empty())
@@ -171,7 +177,7 @@ namespace Nz
 
 						m_animatedComponents.resize(count);
 					}
-					else if (std::sscanf(&m_currentLine[0], "numFrames %u", &count) == 1)
+					else if (m_scanner.ExpectWord("numFrames") && m_scanner.Read(&count))
 					{
 						#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
 						if (!m_frames.empty())
@@ -180,7 +186,7 @@ namespace Nz
 
 						m_frames.resize(count);
 					}
-					else if (std::sscanf(&m_currentLine[0], "numJoints %u", &count) == 1)
+					else if (m_scanner.ExpectWord("numJoints") && m_scanner.Read(&count))
 					{
 						#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
 						if (!m_joints.empty())
@@ -237,36 +243,26 @@ namespace Nz
 	{
 		if (!m_keepLastLine)
 		{
-			do
+			if (!m_scanner.NextLine())
 			{
-				if (m_stream.EndOfStream())
-				{
-					if (required)
-						Error("Incomplete MD5 file");
+				if (required)
+					Error("Incomplete MD5 file");
 
-					return false;
-				}
-
-				m_lineCount++;
-
-				m_currentLine = m_stream.ReadLine();
-				if (m_currentLine.IsEmpty())
-					continue;
-
-				m_currentLine = m_currentLine.SubStringTo("//"); // On ignore les commentaires
-				m_currentLine.Simplify(); // Pour un traitement plus simple
+				return false;
 			}
-			while (m_currentLine.IsEmpty());
 		}
 		else
+		{
+			m_scanner.RestartLine();
 			m_keepLastLine = false;
+		}
 
 		return true;
 	}
 
 	void MD5AnimParser::Error(const String& message)
 	{
-		NazaraError(message + " at line #" + String::Number(m_lineCount));
+		NazaraError(message + " at line #" + String::Number(m_scanner.GetLineNumber()));
 	}
 
 	bool MD5AnimParser::ParseBaseframe()
@@ -283,19 +279,22 @@ namespace Nz
 			if (!Advance())
 				return false;
 
-			// Space is important for the buffer of \n
-			if (std::sscanf(&m_currentLine[0], " ( %f %f %f ) ( %f %f %f )", &m_joints[i].bindPos.x, &m_joints[i].bindPos.y, &m_joints[i].bindPos.z,
-			                                                                 &m_joints[i].bindOrient.x, &m_joints[i].bindOrient.y, &m_joints[i].bindOrient.z) != 6)
+			Vector3f bindOrient;
+			if (!ReadVector(m_scanner, &m_joints[i].bindPos) || !ReadVector(m_scanner, &bindOrient))
 			{
 				UnrecognizedLine(true);
 				return false;
 			}
+
+			m_joints[i].bindOrient.x = bindOrient.x;
+			m_joints[i].bindOrient.y = bindOrient.y;
+			m_joints[i].bindOrient.z = bindOrient.z;
 		}
 
 		if (!Advance())
 			return false;
 
-		if (m_currentLine != '}')
+		if (!m_scanner.Expect('}') || !m_scanner.EndOfLine())
 		{
 			#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
 			Warning("Bounds braces closing not found");
@@ -323,8 +322,7 @@ namespace Nz
 				return false;
 
 			Vector3f min, max;
-			// Space is important for the buffer of \n
-			if (std::sscanf(&m_currentLine[0], " ( %f %f %f ) ( %f %f %f )", &min.x, &min.y, &min.z, &max.x, &max.y, &max.z) != 6)
+			if (!ReadVector(m_scanner, &min) || !ReadVector(m_scanner, &max))
 			{
 				UnrecognizedLine(true);
 				return false;
@@ -336,7 +334,7 @@ namespace Nz
 		if (!Advance())
 			return false;
 
-		if (m_currentLine != '}')
+		if (!m_scanner.Expect('}') || !m_scanner.EndOfLine())
 		{
 			#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
 			Warning("Bounds braces closing not found");
@@ -365,33 +363,23 @@ namespace Nz
 			return false;
 		}
 
-		String line;
-
 		std::size_t count = 0;
 		do
 		{
 			if (!Advance())
 				return false;
 
-			std::size_t index = 0;
-			std::size_t size = m_currentLine.GetSize();
 			do
 			{
-				float f;
-				int read;
-				if (std::sscanf(&m_currentLine[index], "%f%n", &f, &read) != 1)
+				if (count >= animatedComponentsCount || !m_scanner.Read(&m_animatedComponents[count]))
 				{
 					UnrecognizedLine(true);
 					return false;
 				}
 
-				index += read;
-
-				m_animatedComponents[count] = f;
-
 				count++;
 			}
-			while (index < size);
+			while (!m_scanner.EndOfLine());
 		}
 		while (count < animatedComponentsCount);
 
@@ -430,7 +418,7 @@ namespace Nz
 		if (!Advance(false))
 			return true;
 
-		if (m_currentLine != '}')
+		if (!m_scanner.Expect('}') || !m_scanner.EndOfLine())
 		{
 			#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
 			Warning("Hierarchy braces closing not found");
@@ -457,27 +445,26 @@ namespace Nz
 			if (!Advance())
 				return false;
 
-			std::size_t pos = m_currentLine.Find(' ');
-			if (pos == String::npos)
+			StringView name;
+			if (!m_scanner.ReadWord(&name))
 			{
 				UnrecognizedLine(true);
 				return false;
 			}
 
-			if (pos >= 64)
+			if (name.GetSize() >= 64)
 			{
 				NazaraError("Joint name is too long (>= 64 characters)");
 				return false;
 			}
 
-			char name[64];
-			if (std::sscanf(&m_currentLine[0], "%63s %d %u %u", &name[0], &m_joints[i].parent, &m_joints[i].flags, &m_joints[i].index) != 4)
+			if (!m_scanner.Read(&m_joints[i].parent) || !m_scanner.Read(&m_joints[i].flags) || !m_scanner.Read(&m_joints[i].index))
 			{
 				UnrecognizedLine(true);
 				return false;
 			}
 
-			m_joints[i].name = name;
+			m_joints[i].name.Set(name.GetConstBuffer(), name.GetSize());
 			m_joints[i].name.Trim('"');
 
 			Int32 parent = m_joints[i].parent;
@@ -494,7 +481,7 @@ namespace Nz
 		if (!Advance())
 			return false;
 
-		if (m_currentLine != '}')
+		if (!m_scanner.Expect('}') || !m_scanner.EndOfLine())
 		{
 			#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
 			Warning("Hierarchy braces closing not found");
@@ -509,12 +496,12 @@ namespace Nz
 
 	void MD5AnimParser::Warning(const String& message)
 	{
-		NazaraWarning(message + " at line #" + String::Number(m_lineCount));
+		NazaraWarning(message + " at line #" + String::Number(m_scanner.GetLineNumber()));
 	}
 
 	void MD5AnimParser::UnrecognizedLine(bool error)
 	{
-		String message = "Unrecognized \"" + m_currentLine + '"';
+		String message = "Unrecognized \"" + m_scanner.GetLine() + '"';
 
 		if (error)
 			Error(message);
@@ -3,6 +3,8 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Utility/Formats/MD5MeshLoader.hpp>
+#include <Nazara/Utility/Algorithm.hpp>
+#include <Nazara/Utility/BufferAllocator.hpp>
 #include <Nazara/Utility/IndexIterator.hpp>
 #include <Nazara/Utility/IndexMapper.hpp>
 #include <Nazara/Utility/Joint.hpp>
@@ -115,9 +117,6 @@ namespace Nz
 
 					indexMapper.Unmap();
 
-					if (parameters.optimizeIndexBuffers)
-						indexBuffer->Optimize();
-
 					// Vertex buffer
 					struct Weight
 					{
@@ -210,6 +209,8 @@ namespace Nz
 					subMesh->SetMaterialIndex(i);
 					subMesh->SetPrimitiveMode(PrimitiveMode_TriangleList);
 
+					OptimizeMesh(vertexBuffer, indexBuffer, parameters);
+
 					mesh->AddSubMesh(subMesh);
 
 					// Animation
@@ -290,9 +291,6 @@ namespace Nz
 					StaticMeshRef subMesh = StaticMesh::New(mesh);
 					subMesh->Create(vertexBuffer);
 
-					if (parameters.optimizeIndexBuffers)
-						indexBuffer->Optimize();
-
 					subMesh->SetIndexBuffer(indexBuffer);
 					subMesh->GenerateAABB();
 					subMesh->SetMaterialIndex(i);
@@ -305,6 +303,17 @@ namespace Nz
 							subMesh->GenerateNormals();
 					}
 
+					OptimizeMesh(vertexBuffer, indexBuffer, parameters);
+
+					if (parameters.compressedVertexDeclaration)
+						ConvertVertices(vertexBuffer, parameters.compressedVertexDeclaration);
+
+					if (parameters.bufferAllocator)
+					{
+						parameters.bufferAllocator->Relocate(indexBuffer);
+						parameters.bufferAllocator->Relocate(vertexBuffer);
+					}
+
 					mesh->AddSubMesh(subMesh);
 
 					// Material
@@ -5,35 +5,42 @@
 #include <Nazara/Utility/Formats/MD5MeshParser.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Utility/Config.hpp>
-#include <cstdio>
 #include <memory>
 #include <Nazara/Utility/Debug.hpp>
 
 namespace Nz
 {
+	namespace
+	{
+		constexpr UInt64 CheckedSize = 4 * 1024; //< The version is given by the first line
+
+		bool ReadVector(TextScanner& scanner, Vector2f* vector)
+		{
+			return scanner.Expect('(') && scanner.Read(&vector->x) && scanner.Read(&vector->y) && scanner.Expect(')');
+		}
+
+		bool ReadVector(TextScanner& scanner, Vector3f* vector)
+		{
+			return scanner.Expect('(') && scanner.Read(&vector->x) && scanner.Read(&vector->y) && scanner.Read(&vector->z) && scanner.Expect(')');
+		}
+	}
+
 	MD5MeshParser::MD5MeshParser(Stream& stream) :
 	m_stream(stream),
-	m_streamFlags(stream.GetStreamOptions()), //< Saves stream flags
 	m_keepLastLine(false),
-	m_lineCount(0),
 	m_meshIndex(0)
 	{
-		m_stream.EnableTextMode(true);
-	}
-
-	MD5MeshParser::~MD5MeshParser()
-	{
-		// Reset stream flags
-		if ((m_streamFlags & StreamOption_Text) == 0)
-			m_stream.EnableTextMode(false);
 	}
 
 	Ternary MD5MeshParser::Check()
 	{
-		if (Advance(false))
+		TextScanner scanner(m_stream, CheckedSize);
+		scanner.SetCommentMarker("//");
+
+		if (scanner.NextLine())
 		{
-			unsigned int version;
-			if (std::sscanf(&m_currentLine[0], " MD5Version %u", &version) == 1)
+			UInt32 version;
+			if (scanner.ExpectWord("MD5Version") && scanner.Read(&version))
 			{
 				if (version == 10)
 					return Ternary_True;
@@ -65,25 +72,29 @@ namespace Nz
 
 	bool MD5MeshParser::Parse()
 	{
+		// The text is parsed in place when the stream lives in memory (mapped file, archive entry)
+		m_scanner = TextScanner(m_stream);
+		m_scanner.SetCommentMarker("//");
+
 		while (Advance(false))
 		{
-			switch (m_currentLine[0])
+			switch (*m_scanner.GetCursor())
 			{
 				#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
 				case 'M': // MD5Version
-					if (m_currentLine.GetWord(0) != "MD5Version")
+					if (!m_scanner.ExpectWord("MD5Version"))
 						UnrecognizedLine();
 					break;
 
 				case 'c': // commandline
-					if (m_currentLine.GetWord(0) != "commandline")
+					if (!m_scanner.ExpectWord("commandline"))
 						UnrecognizedLine();
 					break;
 				#endif
 
 				case 'j': // joints
 					#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-					if (!m_currentLine.StartsWith("joints {"))
+					if (!m_scanner.ExpectWord("joints") || !m_scanner.Expect('{'))
 					{
 						UnrecognizedLine();
 						break;
@@ -100,7 +111,7 @@ namespace Nz
 				case 'm': // mesh
 				{
 					#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-					if (m_currentLine != "mesh {")
+					if (!m_scanner.ExpectWord("mesh") || !m_scanner.Expect('{') || !m_scanner.EndOfLine())
 					{
 						UnrecognizedLine();
 						break;
@@ -128,8 +139,8 @@ namespace Nz
 
 				case 'n': // num[Frames/Joints]
 				{
-					unsigned int count;
-					if (std::sscanf(&m_currentLine[0], "numJoints %u", &count) == 1)
+					UInt32 count;
+					if (m_scanner.ExpectWord("numJoints") && m_scanner.Read(&count))
 					{
 						#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
 						if (!m_joints.empty())
@@ -138,7 +149,7 @@ namespace Nz
 
 						m_joints.resize(count);
 					}
-					else if (std::sscanf(&m_currentLine[0], "numMeshes %u", &count) == 1)
+					else if (m_scanner.ExpectWord("numMeshes") && m_scanner.Read(&count))
 					{
 						#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
 						if (!m_meshes.empty())
@@ -169,37 +180,26 @@ namespace Nz
 	{
 		if (!m_keepLastLine)
 		{
-			do
+			if (!m_scanner.NextLine())
 			{
-				if (m_stream.EndOfStream())
-				{
-					if (required)
-						Error("Incomplete MD5 file");
-
-					return false;
-				}
+				if (required)
+					Error("Incomplete MD5 file");
 
-				m_lineCount++;
-
-				m_currentLine = m_stream.ReadLine();
-				if (m_currentLine.IsEmpty())
-					continue;
-
-				m_currentLine = m_currentLine.SubStringTo("//"); // On ignore les commentaires
-				m_currentLine.Simplify(); // Pour un traitement plus simple
-				m_currentLine.Trim();
+				return false;
 			}
-			while (m_currentLine.IsEmpty());
 		}
 		else
+		{
+			m_scanner.RestartLine();
 			m_keepLastLine = false;
+		}
 
 		return true;
 	}
 
 	void MD5MeshParser::Error(const String& message)
 	{
-		NazaraError(message + " at line #" + String::Number(m_lineCount));
+		NazaraError(message + " at line #" + String::Number(m_scanner.GetLineNumber()));
 	}
 
 	bool MD5MeshParser::ParseJoints()
@@ -216,29 +216,28 @@ namespace Nz
 			if (!Advance())
 				return false;
 
-			std::size_t pos = m_currentLine.Find(' ');
-			if (pos == String::npos)
+			StringView name;
+			if (!m_scanner.ReadWord(&name))
 			{
 				UnrecognizedLine(true);
 				return false;
 			}
 
-			if (pos >= 64)
+			if (name.GetSize() >= 64)
 			{
 				NazaraError("Joint name is too long (>= 64 characters)");
 				return false;
 			}
 
-			char name[64];
-			if (std::sscanf(&m_currentLine[0], "%63s %d ( %f %f %f ) ( %f %f %f )", &name[0], &m_joints[i].parent,
-																					&m_joints[i].bindPos.x, &m_joints[i].bindPos.y, &m_joints[i].bindPos.z,
-																					&m_joints[i].bindOrient.x, &m_joints[i].bindOrient.y, &m_joints[i].bindOrient.z) != 8)
+			Vector3f bindOrient;
+			if (!m_scanner.Read(&m_joints[i].parent) || !ReadVector(m_scanner, &m_joints[i].bindPos) || !ReadVector(m_scanner, &bindOrient))
 			{
 				UnrecognizedLine(true);
 				return false;
 			}
 
-			m_joints[i].name = name;
+			m_joints[i].bindOrient.Set(0.f, bindOrient.x, bindOrient.y, bindOrient.z);
+			m_joints[i].name.Set(name.GetConstBuffer(), name.GetSize());
 			m_joints[i].name.Trim('"');
 
 			Int32 parent = m_joints[i].parent;
@@ -257,7 +256,7 @@ namespace Nz
 		if (!Advance())
 			return false;
 
-		if (m_currentLine != '}')
+		if (!m_scanner.Expect('}') || !m_scanner.EndOfLine())
 		{
 			#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
 			Warning("Hierarchy braces closing not found");
@@ -275,7 +274,7 @@ namespace Nz
 		bool finished = false;
 		while (!finished && Advance(false))
 		{
-			switch (m_currentLine[0])
+			switch (*m_scanner.GetCursor())
 			{
 				case '}':
 					finished = true;
@@ -283,21 +282,23 @@ namespace Nz
 
 				case 's': // shader
 					#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-					if (!m_currentLine.StartsWith("shader "))
+					if (!m_scanner.ExpectWord("shader"))
 					{
 						UnrecognizedLine();
 						break;
 					}
+					#else
+					m_scanner.ExpectWord("shader");
 					#endif
 
-					m_meshes[m_meshIndex].shader = m_currentLine.SubString(7);
+					m_meshes[m_meshIndex].shader = m_scanner.ReadRemaining();
 					m_meshes[m_meshIndex].shader.Trim('"');
 					break;
 
 				case 'n': // num[tris/verts]
 				{
-					unsigned int count;
-					if (std::sscanf(&m_currentLine[0], "numtris %u", &count) == 1)
+					UInt32 count;
+					if (m_scanner.ExpectWord("numtris") && m_scanner.Read(&count))
 					{
 						m_meshes[m_meshIndex].triangles.resize(count);
 						for (unsigned int i = 0; i < count; ++i)
@@ -306,8 +307,8 @@ namespace Nz
 								return false;
 
 							Triangle& triangle = m_meshes[m_meshIndex].triangles[i];
-							unsigned int index;
-							if (std::sscanf(&m_currentLine[0], "tri %u %u %u %u", &index, &triangle.x, &triangle.y, &triangle.z) != 4)
+							UInt32 index;
+							if (!m_scanner.ExpectWord("tri") || !m_scanner.Read(&index) || !m_scanner.Read(&triangle.x) || !m_scanner.Read(&triangle.y) || !m_scanner.Read(&triangle.z))
 							{
 								UnrecognizedLine(true);
 								return false;
@@ -320,7 +321,7 @@ namespace Nz
 							}
 						}
 					}
-					else if (std::sscanf(&m_currentLine[0], "numverts %u", &count) == 1)
+					else if (m_scanner.ExpectWord("numverts") && m_scanner.Read(&count))
 					{
 						m_meshes[m_meshIndex].vertices.resize(count);
 						for (unsigned int i = 0; i < count; ++i)
@@ -329,8 +330,8 @@ namespace Nz
 								return false;
 
 							Vertex& vertex = m_meshes[m_meshIndex].vertices[i];
-							unsigned int index;
-							if (std::sscanf(&m_currentLine[0], "vert %u ( %f %f ) %u %u", &index, &vertex.uv.x, &vertex.uv.y, &vertex.startWeight, &vertex.weightCount) != 5)
+							UInt32 index;
+							if (!m_scanner.ExpectWord("vert") || !m_scanner.Read(&index) || !ReadVector(m_scanner, &vertex.uv) || !m_scanner.Read(&vertex.startWeight) || !m_scanner.Read(&vertex.weightCount))
 							{
 								UnrecognizedLine(true);
 								return false;
@@ -343,7 +344,7 @@ namespace Nz
 							}
 						}
 					}
-					else if (std::sscanf(&m_currentLine[0], "numweights %u", &count) == 1)
+					else if (m_scanner.ExpectWord("numweights") && m_scanner.Read(&count))
 					{
 						m_meshes[m_meshIndex].weights.resize(count);
 						for (unsigned int i = 0; i < count; ++i)
@@ -352,9 +353,8 @@ namespace Nz
 								return false;
 
 							Weight& weight = m_meshes[m_meshIndex].weights[i];
-							unsigned int index;
-							if (std::sscanf(&m_currentLine[0], "weight %u %u %f ( %f %f %f )", &index, &weight.joint, &weight.bias,
-																							   &weight.pos.x, &weight.pos.y, &weight.pos.z) != 6)
+							UInt32 index;
+							if (!m_scanner.ExpectWord("weight") || !m_scanner.Read(&index) || !m_scanner.Read(&weight.joint) || !m_scanner.Read(&weight.bias) || !ReadVector(m_scanner, &weight.pos))
 							{
 								UnrecognizedLine(true);
 								return false;
@@ -410,12 +410,12 @@ namespace Nz
 
 	void MD5MeshParser::Warning(const String& message)
 	{
-		NazaraWarning(message + " at line #" + String::Number(m_lineCount));
+		NazaraWarning(message + " at line #" + String::Number(m_scanner.GetLineNumber()));
 	}
 
 	void MD5MeshParser::UnrecognizedLine(bool error)
 	{
-		String message = "Unrecognized \"" + m_currentLine + '"';
+		String message = "Unrecognized \"" + m_scanner.GetLine() + '"';
 
 		if (error)
 			Error(message);
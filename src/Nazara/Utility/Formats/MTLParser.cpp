@@ -3,42 +3,43 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Utility/Formats/MTLParser.hpp>
+#include <Nazara/Core/Algorithm.hpp>
 #include <Nazara/Core/CallOnExit.hpp>
 #include <Nazara/Utility/Config.hpp>
-#include <cstdio>
+#include <cctype>
+#include <cstring>
 #include <Nazara/Utility/Debug.hpp>
 
 namespace Nz
 {
 	bool MTLParser::Parse(Stream& stream)
 	{
-		m_currentStream = &stream;
-
-		// Force stream in text mode, reset it at the end
-		Nz::CallOnExit resetTextMode;
-		if ((stream.GetStreamOptions() & StreamOption_Text) == 0)
-		{
-			stream.EnableTextMode(true);
-
-			resetTextMode.Reset([&stream] ()
-			{
-				stream.EnableTextMode(false);
-			});
-		}
+		// The text is parsed in place when the stream lives in memory (mapped file, archive entry)
+		TextScanner scanner(stream);
+		scanner.SetCommentMarker("#");
 
-		m_keepLastLine = false;
-		m_lineCount = 0;
+		m_currentScanner = &scanner;
 		m_materials.clear();
 
 		Material* currentMaterial = nullptr;
 
-		while (Advance(false))
+		while (scanner.NextLine())
 		{
-			String keyword = m_currentLine.GetWord(0).ToLower();
-			if (keyword == "ka")
+			StringView word;
+			scanner.ReadWord(&word);
+
+			// Keywords are case-insensitive, longer words cannot be keywords
+			char keyword[16] = {};
+			if (word.GetSize() < CountOf(keyword))
+			{
+				for (std::size_t i = 0; i < word.GetSize(); ++i)
+					keyword[i] = static_cast<char>(std::tolower(static_cast<unsigned char>(word[i])));
+			}
+
+			if (std::strcmp(keyword, "ka") == 0)
 			{
 				float r, g, b;
-				if (std::sscanf(&m_currentLine[3], "%f %f %f", &r, &g, &b) == 3)
+				if (scanner.Read(&r) && scanner.Read(&g) && scanner.Read(&b))
 				{
 					if (!currentMaterial)
 						currentMaterial = AddMaterial("default");
@@ -50,10 +51,10 @@ namespace Nz
 					UnrecognizedLine();
 				#endif
 			}
-			else if (keyword == "kd")
+			else if (std::strcmp(keyword, "kd") == 0)
 			{
 				float r, g, b;
-				if (std::sscanf(&m_currentLine[3], "%f %f %f", &r, &g, &b) == 3)
+				if (scanner.Read(&r) && scanner.Read(&g) && scanner.Read(&b))
 				{
 					if (!currentMaterial)
 						currentMaterial = AddMaterial("default");
@@ -65,10 +66,10 @@ namespace Nz
 					UnrecognizedLine();
 				#endif
 			}
-			else if (keyword == "ks")
+			else if (std::strcmp(keyword, "ks") == 0)
 			{
 				float r, g, b;
-				if (std::sscanf(&m_currentLine[3], "%f %f %f", &r, &g, &b) == 3)
+				if (scanner.Read(&r) && scanner.Read(&g) && scanner.Read(&b))
 				{
 					if (!currentMaterial)
 						currentMaterial = AddMaterial("default");
@@ -80,10 +81,10 @@ namespace Nz
 					UnrecognizedLine();
 				#endif
 			}
-			else if (keyword == "ni")
+			else if (std::strcmp(keyword, "ni") == 0)
 			{
 				float density;
-				if (std::sscanf(&m_currentLine[3], "%f", &density) == 1)
+				if (scanner.Read(&density))
 				{
 					if (!currentMaterial)
 						currentMaterial = AddMaterial("default");
@@ -95,10 +96,10 @@ namespace Nz
 					UnrecognizedLine();
 				#endif
 			}
-			else if (keyword == "ns")
+			else if (std::strcmp(keyword, "ns") == 0)
 			{
 				float coef;
-				if (std::sscanf(&m_currentLine[3], "%f", &coef) == 1)
+				if (scanner.Read(&coef))
 				{
 					if (!currentMaterial)
 						currentMaterial = AddMaterial("default");
@@ -110,10 +111,10 @@ namespace Nz
 					UnrecognizedLine();
 				#endif
 			}
-			else if (keyword == 'd')
+			else if (std::strcmp(keyword, "d") == 0)
 			{
 				float alpha;
-				if (std::sscanf(&m_currentLine[(keyword[0] == 'd') ? 2 : 3], "%f", &alpha) == 1)
+				if (scanner.Read(&alpha))
 				{
 					if (!currentMaterial)
 						currentMaterial = AddMaterial("default");
@@ -125,10 +126,10 @@ namespace Nz
 					UnrecognizedLine();
 				#endif
 			}
-			else if (keyword == "tr")
+			else if (std::strcmp(keyword, "tr") == 0)
 			{
 				float alpha;
-				if (std::sscanf(&m_currentLine[(keyword[0] == 'd') ? 2 : 3], "%f", &alpha) == 1)
+				if (scanner.Read(&alpha))
 				{
 					if (!currentMaterial)
 						currentMaterial = AddMaterial("default");
@@ -140,10 +141,10 @@ namespace Nz
 					UnrecognizedLine();
 				#endif
 			}
-			else if (keyword == "illum")
+			else if (std::strcmp(keyword, "illum") == 0)
 			{
-				unsigned int model;
-				if (std::sscanf(&m_currentLine[6], "%u", &model) == 1)
+				UInt32 model;
+				if (scanner.Read(&model))
 				{
 					if (!currentMaterial)
 						currentMaterial = AddMaterial("default");
@@ -155,131 +156,121 @@ namespace Nz
 					UnrecognizedLine();
 				#endif
 			}
-			else if (keyword == "map_ka")
+			else if (std::strcmp(keyword, "map_ka") == 0)
 			{
-				std::size_t mapPos = m_currentLine.GetWordPosition(1);
-				if (mapPos != String::npos)
+				String map = scanner.ReadRemaining();
+				if (!map.IsEmpty())
 				{
-					String map = m_currentLine.SubString(mapPos);
 					if (!currentMaterial)
 						currentMaterial = AddMaterial("default");
 
 					currentMaterial->ambientMap = map;
 				}
 			}
-			else if (keyword == "map_kd")
+			else if (std::strcmp(keyword, "map_kd") == 0)
 			{
-				std::size_t mapPos = m_currentLine.GetWordPosition(1);
-				if (mapPos != String::npos)
+				String map = scanner.ReadRemaining();
+				if (!map.IsEmpty())
 				{
-					String map = m_currentLine.SubString(mapPos);
 					if (!currentMaterial)
 						currentMaterial = AddMaterial("default");
 
 					currentMaterial->diffuseMap = map;
 				}
 			}
-			else if (keyword == "map_ks")
+			else if (std::strcmp(keyword, "map_ks") == 0)
 			{
-				std::size_t mapPos = m_currentLine.GetWordPosition(1);
-				if (mapPos != String::npos)
+				String map = scanner.ReadRemaining();
+				if (!map.IsEmpty())
 				{
-					String map = m_currentLine.SubString(mapPos);
 					if (!currentMaterial)
 						currentMaterial = AddMaterial("default");
 
 					currentMaterial->specularMap = map;
 				}
 			}
-			else if (keyword == "map_bump" || keyword == "bump")
+			else if (std::strcmp(keyword, "map_bump") == 0 || std::strcmp(keyword, "bump") == 0)
 			{
-				std::size_t mapPos = m_currentLine.GetWordPosition(1);
-				if (mapPos != String::npos)
+				String map = scanner.ReadRemaining();
+				if (!map.IsEmpty())
 				{
-					String map = m_currentLine.SubString(mapPos);
 					if (!currentMaterial)
 						currentMaterial = AddMaterial("default");
 
 					currentMaterial->bumpMap = map;
 				}
 			}
-			else if (keyword == "map_d")
+			else if (std::strcmp(keyword, "map_d") == 0)
 			{
-				std::size_t mapPos = m_currentLine.GetWordPosition(1);
-				if (mapPos != String::npos)
+				String map = scanner.ReadRemaining();
+				if (!map.IsEmpty())
 				{
-					String map = m_currentLine.SubString(mapPos);
 					if (!currentMaterial)
 						currentMaterial = AddMaterial("default");
 
 					currentMaterial->alphaMap = map;
 				}
 			}
-			else if (keyword == "map_decal" || keyword == "decal")
+			else if (std::strcmp(keyword, "map_decal") == 0 || std::strcmp(keyword, "decal") == 0)
 			{
-				std::size_t mapPos = m_currentLine.GetWordPosition(1);
-				if (mapPos != String::npos)
+				String map = scanner.ReadRemaining();
+				if (!map.IsEmpty())
 				{
-					String map = m_currentLine.SubString(mapPos);
 					if (!currentMaterial)
 						currentMaterial = AddMaterial("default");
 
 					currentMaterial->decalMap = map;
 				}
 			}
-			else if (keyword == "map_disp" || keyword == "disp")
+			else if (std::strcmp(keyword, "map_disp") == 0 || std::strcmp(keyword, "disp") == 0)
 			{
-				std::size_t mapPos = m_currentLine.GetWordPosition(1);
-				if (mapPos != String::npos)
+				String map = scanner.ReadRemaining();
+				if (!map.IsEmpty())
 				{
-					String map = m_currentLine.SubString(mapPos);
 					if (!currentMaterial)
 						currentMaterial = AddMaterial("default");
 
 					currentMaterial->displacementMap = map;
 				}
 			}
-			else if (keyword == "map_refl" || keyword == "refl")
+			else if (std::strcmp(keyword, "map_refl") == 0 || std::strcmp(keyword, "refl") == 0)
 			{
-				std::size_t mapPos = m_currentLine.GetWordPosition(1);
-				if (mapPos != String::npos)
+				String map = scanner.ReadRemaining();
+				if (!map.IsEmpty())
 				{
-					String map = m_currentLine.SubString(mapPos);
 					if (!currentMaterial)
 						currentMaterial = AddMaterial("default");
 
 					currentMaterial->reflectionMap = map;
 				}
 			}
-			else if (keyword == "map_normal" || keyword == "normal")
+			else if (std::strcmp(keyword, "map_normal") == 0 || std::strcmp(keyword, "normal") == 0)
 			{
 				// <!> This is a custom keyword
-				std::size_t mapPos = m_currentLine.GetWordPosition(1);
-				if (mapPos != String::npos)
+				String map = scanner.ReadRemaining();
+				if (!map.IsEmpty())
 				{
-					String map = m_currentLine.SubString(mapPos);
 					if (!currentMaterial)
 						currentMaterial = AddMaterial("default");
 
 					currentMaterial->normalMap = map;
 				}
 			}
-			else if (keyword == "map_emissive" || keyword == "emissive")
+			else if (std::strcmp(keyword, "map_emissive") == 0 || std::strcmp(keyword, "emissive") == 0)
 			{
 				// <!> This is a custom keyword
-				std::size_t mapPos = m_currentLine.GetWordPosition(1);
-				if (mapPos != String::npos)
+				String map = scanner.ReadRemaining();
+				if (!map.IsEmpty())
 				{
-					String map = m_currentLine.SubString(mapPos);
 					if (!currentMaterial)
 						currentMaterial = AddMaterial("default");
 
 					currentMaterial->emissiveMap = map;
 				}
 			}
-			else if (keyword == "newmtl")
+			else if (std::strcmp(keyword, "newmtl") == 0)
 			{
-				String materialName = m_currentLine.SubString(m_currentLine.GetWordPosition(1));
+				String materialName = scanner.ReadRemaining();
 				if (!materialName.IsEmpty())
 					currentMaterial = AddMaterial(materialName);
 				#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
@@ -432,35 +423,4 @@ namespace Nz
 
 		return true;
 	}
-
-	bool MTLParser::Advance(bool required)
-	{
-		if (!m_keepLastLine)
-		{
-			do
-			{
-				if (m_currentStream->EndOfStream())
-				{
-					if (required)
-						Error("Incomplete MTL file");
-
-					return false;
-				}
-
-				m_lineCount++;
-
-				m_currentLine = m_currentStream->ReadLine();
-				if (m_currentLine.IsEmpty())
-					continue;
-
-				m_currentLine = m_currentLine.SubStringTo("#"); // On ignore les commentaires
-				m_currentLine.Simplify(); // Pour un traitement plus simple
-			}
-			while (m_currentLine.IsEmpty());
-		}
-		else
-			m_keepLastLine = false;
-
-		return true;
-	}
 }
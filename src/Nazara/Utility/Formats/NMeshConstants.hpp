@@ -0,0 +1,63 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#ifndef NAZARA_LOADERS_NMESH_CONSTANTS_HPP
+#define NAZARA_LOADERS_NMESH_CONSTANTS_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Math/Box.hpp>
+#include <vector>
+
+namespace Nz
+{
+	/*
+	** Nazara cooked mesh (.nmesh), all values are little-endian
+	**
+	** Header
+	** Materials: parameter count, then name, type and value of each parameter
+	** SubMeshes: descriptors (see NMesh_SubMesh)
+	** Vertex data, aligned: vertices of every submesh, as laid out by their declaration
+	** Index data, aligned: indices of every submesh
+	*/
+
+	constexpr UInt32 NMesh_DataAlignment = 16;
+	constexpr UInt32 NMesh_HeaderSize = 4 * sizeof(UInt32) + 4 * sizeof(UInt64);
+	constexpr UInt32 NMesh_Magic = 0x48534D4E; // "NMSH"
+	constexpr UInt32 NMesh_Version = 1;
+
+	struct NMesh_Header
+	{
+		UInt32 magic;
+		UInt32 version;
+		UInt32 materialCount;
+		UInt32 subMeshCount;
+		UInt64 vertexDataOffset; // From the beginning of the file
+		UInt64 vertexDataSize;
+		UInt64 indexDataOffset;  // From the beginning of the file
+		UInt64 indexDataSize;
+	};
+
+	struct NMesh_Component
+	{
+		UInt32 component;
+		UInt32 type;
+		UInt32 offset;
+	};
+
+	struct NMesh_SubMesh
+	{
+		Boxf aabb;
+		std::vector<NMesh_Component> components;
+		UInt64 indexOffset;  // From the beginning of the index data
+		UInt64 vertexOffset; // From the beginning of the vertex data
+		UInt32 indexCount;   // Zero if the submesh has no index buffer
+		UInt32 materialIndex;
+		UInt32 primitiveMode;
+		UInt32 stride;
+		UInt32 vertexCount;
+		UInt8 largeIndices;
+	};
+}
+
+#endif // NAZARA_LOADERS_NMESH_CONSTANTS_HPP
@@ -0,0 +1,415 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/Formats/NMeshLoader.hpp>
+#include <Nazara/Core/ByteStream.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Utility/Buffer.hpp>
+#include <Nazara/Utility/IndexBuffer.hpp>
+#include <Nazara/Utility/Mesh.hpp>
+#include <Nazara/Utility/StaticMesh.hpp>
+#include <Nazara/Utility/Utility.hpp>
+#include <Nazara/Utility/VertexBuffer.hpp>
+#include <Nazara/Utility/VertexMapper.hpp>
+#include <Nazara/Utility/Formats/NMeshConstants.hpp>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <Nazara/Utility/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		bool IsSupported(const String& extension)
+		{
+			return (extension == "nmesh");
+		}
+
+		Ternary Check(Stream& stream, const MeshParams& parameters)
+		{
+			bool skip;
+			if (parameters.custom.GetBooleanParameter("SkipNativeNMeshLoader", &skip) && skip)
+				return Ternary_False;
+
+			ByteStream byteStream(&stream);
+			byteStream.SetDataEndianness(Endianness_LittleEndian);
+
+			UInt32 magic;
+			byteStream >> magic;
+
+			return (magic == NMesh_Magic) ? Ternary_True : Ternary_False;
+		}
+
+		bool HasLayout(const VertexDeclaration* declaration, const NMesh_SubMesh& subMesh)
+		{
+			if (declaration->GetStride() != subMesh.stride)
+				return false;
+
+			std::size_t enabledCount = 0;
+			for (unsigned int i = 0; i <= VertexComponent_Max; ++i)
+			{
+				if (declaration->HasComponent(static_cast<VertexComponent>(i)))
+					enabledCount++;
+			}
+
+			if (enabledCount != subMesh.components.size())
+				return false;
+
+			for (const NMesh_Component& component : subMesh.components)
+			{
+				bool enabled;
+				ComponentType type;
+				std::size_t offset;
+				declaration->GetComponent(static_cast<VertexComponent>(component.component), &enabled, &type, &offset);
+
+				if (!enabled || type != component.type || offset != component.offset)
+					return false;
+			}
+
+			return true;
+		}
+
+		bool ReadMaterial(ByteStream& stream, ParameterList* material)
+		{
+			UInt32 parameterCount;
+			stream >> parameterCount;
+
+			for (UInt32 i = 0; i < parameterCount; ++i)
+			{
+				String name;
+				UInt8 type;
+				stream >> name >> type;
+
+				switch (type)
+				{
+					case ParameterType_Boolean:
+					{
+						UInt8 value;
+						stream >> value;
+
+						material->SetParameter(name, value != 0);
+						break;
+					}
+
+					case ParameterType_Color:
+					{
+						Color value;
+						stream >> value.r >> value.g >> value.b >> value.a;
+
+						material->SetParameter(name, value);
+						break;
+					}
+
+					case ParameterType_Double:
+					{
+						double value;
+						stream >> value;
+
+						material->SetParameter(name, value);
+						break;
+					}
+
+					case ParameterType_Integer:
+					{
+						Int64 value;
+						stream >> value;
+
+						material->SetParameter(name, static_cast<long long>(value));
+						break;
+					}
+
+					case ParameterType_String:
+					{
+						String value;
+						stream >> value;
+
+						material->SetParameter(name, value);
+						break;
+					}
+
+					default:
+						NazaraError("Invalid material parameter type: " + String::Number(type));
+						return false;
+				}
+			}
+
+			return true;
+		}
+
+		bool ReadSubMesh(ByteStream& stream, const NMesh_Header& header, NMesh_SubMesh* subMesh)
+		{
+			stream >> subMesh->aabb >> subMesh->indexOffset >> subMesh->vertexOffset >> subMesh->indexCount >> subMesh->materialIndex;
+			stream >> subMesh->primitiveMode >> subMesh->stride >> subMesh->vertexCount >> subMesh->largeIndices;
+
+			UInt32 componentCount;
+			stream >> componentCount;
+
+			if (componentCount > VertexComponent_Max + 1)
+				return false;
+
+			subMesh->components.resize(componentCount);
+			for (NMesh_Component& component : subMesh->components)
+			{
+				stream >> component.component >> component.type >> component.offset;
+
+				if (component.component > VertexComponent_Max || component.type > ComponentType_Max || component.offset + Utility::ComponentStride[component.type] > subMesh->stride)
+					return false;
+			}
+
+			if (subMesh->primitiveMode > PrimitiveMode_Max || (header.materialCount > 0 && subMesh->materialIndex >= header.materialCount))
+				return false;
+
+			if (subMesh->vertexOffset > header.vertexDataSize || UInt64(subMesh->vertexCount) * subMesh->stride > header.vertexDataSize - subMesh->vertexOffset)
+				return false;
+
+			UInt64 indexStride = (subMesh->largeIndices) ? sizeof(UInt32) : sizeof(UInt16);
+			if (subMesh->indexOffset > header.indexDataSize || subMesh->indexCount * indexStride > header.indexDataSize - subMesh->indexOffset)
+				return false;
+
+			return true;
+		}
+
+		bool Load(Mesh* mesh, Stream& stream, const MeshParams& parameters)
+		{
+			UInt64 start = stream.GetCursorPos();
+
+			ByteStream byteStream(&stream);
+			byteStream.SetDataEndianness(Endianness_LittleEndian);
+
+			NMesh_Header header;
+			byteStream >> header.magic >> header.version >> header.materialCount >> header.subMeshCount;
+			byteStream >> header.vertexDataOffset >> header.vertexDataSize >> header.indexDataOffset >> header.indexDataSize;
+
+			if (header.magic != NMesh_Magic)
+			{
+				NazaraError("Invalid cooked mesh");
+				return false;
+			}
+
+			if (header.version != NMesh_Version)
+			{
+				NazaraError("Unsupported cooked mesh version: " + String::Number(header.version));
+				return false;
+			}
+
+			if (header.vertexDataSize > std::numeric_limits<UInt32>::max() || header.indexDataSize > std::numeric_limits<UInt32>::max())
+			{
+				NazaraError("Cooked mesh data is too large");
+				return false;
+			}
+
+			std::vector<ParameterList> materials(header.materialCount);
+			for (ParameterList& material : materials)
+			{
+				if (!ReadMaterial(byteStream, &material))
+				{
+					NazaraError("Failed to read cooked mesh materials");
+					return false;
+				}
+			}
+
+			std::vector<NMesh_SubMesh> subMeshes(header.subMeshCount);
+			for (NMesh_SubMesh& subMesh : subMeshes)
+			{
+				if (!ReadSubMesh(byteStream, header, &subMesh))
+				{
+					NazaraError("Invalid cooked submesh");
+					return false;
+				}
+			}
+
+			// Every submesh shares one vertex buffer and one index buffer, which are filled straight from the stream when the layout matches
+			VertexDeclaration* declaration = parameters.vertexDeclaration;
+			UInt32 stride = static_cast<UInt32>(declaration->GetStride());
+
+			bool directCopy = true;
+			UInt64 vertexCount = 0;
+			for (const NMesh_SubMesh& subMesh : subMeshes)
+			{
+				if (!HasLayout(declaration, subMesh))
+					directCopy = false;
+
+				vertexCount += subMesh.vertexCount;
+			}
+
+			UInt64 vertexBufferSize = (directCopy) ? header.vertexDataSize : vertexCount * stride;
+			if (vertexBufferSize == 0 || vertexBufferSize > std::numeric_limits<UInt32>::max())
+			{
+				NazaraError("Invalid cooked mesh vertex count");
+				return false;
+			}
+
+			BufferRef vertexBuffer = Buffer::New(BufferType_Vertex, static_cast<UInt32>(vertexBufferSize), parameters.storage, parameters.vertexBufferFlags);
+
+			UInt8* vertices = static_cast<UInt8*>(vertexBuffer->Map(BufferAccess_DiscardAndWrite));
+			if (!vertices)
+			{
+				NazaraError("Failed to map vertex buffer");
+				return false;
+			}
+
+			std::vector<UInt32> vertexOffsets(subMeshes.size());
+			if (directCopy)
+			{
+				stream.SetCursorPos(start + header.vertexDataOffset);
+				if (stream.Read(vertices, static_cast<std::size_t>(header.vertexDataSize)) != header.vertexDataSize)
+				{
+					NazaraError("Failed to read cooked mesh vertices");
+					vertexBuffer->Unmap();
+					return false;
+				}
+
+				for (std::size_t i = 0; i < subMeshes.size(); ++i)
+					vertexOffsets[i] = static_cast<UInt32>(subMeshes[i].vertexOffset);
+			}
+			else
+			{
+				// Convert to the requested declaration, components missing from the file are zeroed
+				std::memset(vertices, 0, static_cast<std::size_t>(vertexBufferSize));
+
+				std::vector<UInt8> subMeshVertices;
+				UInt32 offset = 0;
+				for (std::size_t i = 0; i < subMeshes.size(); ++i)
+				{
+					const NMesh_SubMesh& subMesh = subMeshes[i];
+					vertexOffsets[i] = offset;
+
+					subMeshVertices.resize(std::size_t(subMesh.vertexCount) * subMesh.stride);
+
+					stream.SetCursorPos(start + header.vertexDataOffset + subMesh.vertexOffset);
+					if (stream.Read(subMeshVertices.data(), subMeshVertices.size()) != subMeshVertices.size())
+					{
+						NazaraError("Failed to read cooked mesh vertices");
+						vertexBuffer->Unmap();
+						return false;
+					}
+
+					for (const NMesh_Component& component : subMesh.components)
+					{
+						bool enabled;
+						ComponentType type;
+						std::size_t targetOffset;
+						declaration->GetComponent(static_cast<VertexComponent>(component.component), &enabled, &type, &targetOffset);
+						if (!enabled || type != component.type)
+							continue;
+
+						std::size_t componentSize = Utility::ComponentStride[type];
+						for (UInt32 j = 0; j < subMesh.vertexCount; ++j)
+							std::memcpy(&vertices[offset + j * stride + targetOffset], &subMeshVertices[j * subMesh.stride + component.offset], componentSize);
+					}
+
+					offset += subMesh.vertexCount * stride;
+				}
+			}
+
+			vertexBuffer->Unmap();
+
+			BufferRef indexBuffer;
+			if (header.indexDataSize > 0)
+			{
+				indexBuffer = Buffer::New(BufferType_Index, static_cast<UInt32>(header.indexDataSize), parameters.storage, parameters.indexBufferFlags);
+
+				void* indices = indexBuffer->Map(BufferAccess_DiscardAndWrite);
+				if (!indices)
+				{
+					NazaraError("Failed to map index buffer");
+					return false;
+				}
+
+				stream.SetCursorPos(start + header.indexDataOffset);
+				std::size_t readSize = stream.Read(indices, static_cast<std::size_t>(header.indexDataSize));
+				indexBuffer->Unmap();
+
+				if (readSize != header.indexDataSize)
+				{
+					NazaraError("Failed to read cooked mesh indices");
+					return false;
+				}
+			}
+
+			mesh->CreateStatic();
+			mesh->SetMaterialCount(std::max<UInt32>(header.materialCount, 1));
+
+			for (UInt32 i = 0; i < header.materialCount; ++i)
+				mesh->SetMaterialData(i, std::move(materials[i]));
+
+			bool transformPositions = (parameters.matrix != Matrix4f::Identity());
+			bool transformTexCoords = (parameters.texCoordOffset != Vector2f::Zero() || parameters.texCoordScale != Vector2f::Unit());
+
+			for (std::size_t i = 0; i < subMeshes.size(); ++i)
+			{
+				const NMesh_SubMesh& subMesh = subMeshes[i];
+
+				VertexBufferRef subMeshVertexBuffer = VertexBuffer::New(declaration, vertexBuffer, vertexOffsets[i], subMesh.vertexCount * stride);
+
+				StaticMeshRef staticMesh = StaticMesh::New(mesh);
+				if (!staticMesh->Create(subMeshVertexBuffer))
+				{
+					NazaraError("Failed to create StaticMesh");
+					return false;
+				}
+
+				if (subMesh.indexCount > 0)
+				{
+					UInt32 indexStride = (subMesh.largeIndices) ? sizeof(UInt32) : sizeof(UInt16);
+					staticMesh->SetIndexBuffer(IndexBuffer::New(subMesh.largeIndices != 0, indexBuffer, static_cast<UInt32>(subMesh.indexOffset), subMesh.indexCount * indexStride));
+				}
+
+				staticMesh->SetAABB(subMesh.aabb);
+
+				// Cooked vertices are usually used as is, parameters altering them force a pass over the vertices
+				if (transformPositions || transformTexCoords)
+				{
+					VertexMapper vertexMapper(staticMesh, BufferAccess_ReadWrite);
+
+					auto posPtr = vertexMapper.GetComponentPtr<Vector3f>(VertexComponent_Position);
+					if (transformPositions && posPtr && subMesh.vertexCount > 0)
+					{
+						posPtr[0] = parameters.matrix.Transform(posPtr[0]);
+
+						Boxf aabb(posPtr[0].x, posPtr[0].y, posPtr[0].z, 0.f, 0.f, 0.f);
+						for (UInt32 j = 1; j < subMesh.vertexCount; ++j)
+						{
+							posPtr[j] = parameters.matrix.Transform(posPtr[j]);
+							aabb.ExtendTo(posPtr[j]);
+						}
+
+						staticMesh->SetAABB(aabb);
+					}
+
+					auto uvPtr = vertexMapper.GetComponentPtr<Vector2f>(VertexComponent_TexCoord);
+					if (transformTexCoords && uvPtr)
+					{
+						for (UInt32 j = 0; j < subMesh.vertexCount; ++j)
+							uvPtr[j] = parameters.texCoordOffset + uvPtr[j] * parameters.texCoordScale;
+					}
+				}
+
+				staticMesh->SetMaterialIndex(subMesh.materialIndex);
+				staticMesh->SetPrimitiveMode(static_cast<PrimitiveMode>(subMesh.primitiveMode));
+
+				mesh->AddSubMesh(staticMesh);
+			}
+
+			if (parameters.center)
+				mesh->Recenter();
+
+			return true;
+		}
+	}
+
+	namespace Loaders
+	{
+		void RegisterNMeshLoader()
+		{
+			MeshLoader::RegisterLoader(IsSupported, Check, Load);
+		}
+
+		void UnregisterNMeshLoader()
+		{
+			MeshLoader::UnregisterLoader(IsSupported, Check, Load);
+		}
+	}
+}
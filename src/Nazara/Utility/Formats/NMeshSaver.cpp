@@ -0,0 +1,277 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/Formats/NMeshSaver.hpp>
+#include <Nazara/Core/ByteStream.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Utility/IndexBuffer.hpp>
+#include <Nazara/Utility/Mesh.hpp>
+#include <Nazara/Utility/StaticMesh.hpp>
+#include <Nazara/Utility/VertexBuffer.hpp>
+#include <Nazara/Utility/Formats/NMeshConstants.hpp>
+#include <Nazara/Utility/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		UInt64 Align(UInt64 offset, UInt64 alignment)
+		{
+			return (offset + alignment - 1) / alignment * alignment;
+		}
+
+		bool IsSupported(const String& extension)
+		{
+			return (extension == "nmesh");
+		}
+
+		void WriteMaterial(ByteStream& stream, const ParameterList& material)
+		{
+			// Only values may be cooked, pointers and userdata are meaningless outside of the process
+			std::vector<String> names;
+			material.ForEach([&](const ParameterList& list, const String& name)
+			{
+				ParameterType type;
+				if (list.GetParameterType(name, &type) && type != ParameterType_None && type != ParameterType_Pointer && type != ParameterType_Userdata)
+					names.push_back(name);
+			});
+
+			stream << static_cast<UInt32>(names.size());
+			for (const String& name : names)
+			{
+				ParameterType type;
+				material.GetParameterType(name, &type);
+
+				stream << name << static_cast<UInt8>(type);
+				switch (type)
+				{
+					case ParameterType_Boolean:
+					{
+						bool value = false;
+						material.GetBooleanParameter(name, &value);
+
+						stream << static_cast<UInt8>(value);
+						break;
+					}
+
+					case ParameterType_Color:
+					{
+						Color value;
+						material.GetColorParameter(name, &value);
+
+						stream << value.r << value.g << value.b << value.a;
+						break;
+					}
+
+					case ParameterType_Double:
+					{
+						double value = 0.0;
+						material.GetDoubleParameter(name, &value);
+
+						stream << value;
+						break;
+					}
+
+					case ParameterType_Integer:
+					{
+						long long value = 0;
+						material.GetIntegerParameter(name, &value);
+
+						stream << static_cast<Int64>(value);
+						break;
+					}
+
+					case ParameterType_String:
+					{
+						String value;
+						material.GetStringParameter(name, &value);
+
+						stream << value;
+						break;
+					}
+
+					case ParameterType_None:
+					case ParameterType_Pointer:
+					case ParameterType_Userdata:
+						break;
+				}
+			}
+		}
+
+		bool SaveToStream(const Mesh& mesh, const String& format, Stream& stream, const MeshParams& parameters)
+		{
+			NazaraUnused(parameters);
+
+			if (!IsSupported(format))
+			{
+				NazaraError("Unsupported format: " + format);
+				return false;
+			}
+
+			if (mesh.IsAnimable())
+			{
+				NazaraError("Only static meshes can be cooked");
+				return false;
+			}
+
+			UInt32 subMeshCount = mesh.GetSubMeshCount();
+			UInt32 materialCount = mesh.GetMaterialCount();
+
+			// Vertices and indices of every submesh are laid out one after another, so they can be loaded in a single buffer
+			std::vector<NMesh_SubMesh> subMeshes(subMeshCount);
+
+			UInt64 vertexDataSize = 0;
+			UInt64 indexDataSize = 0;
+			for (UInt32 i = 0; i < subMeshCount; ++i)
+			{
+				const StaticMesh* staticMesh = static_cast<const StaticMesh*>(mesh.GetSubMesh(i));
+				const VertexBuffer* vertexBuffer = staticMesh->GetVertexBuffer();
+				const IndexBuffer* indexBuffer = staticMesh->GetIndexBuffer();
+				const VertexDeclaration* declaration = vertexBuffer->GetVertexDeclaration();
+
+				NMesh_SubMesh& subMesh = subMeshes[i];
+				subMesh.aabb = staticMesh->GetAABB();
+				subMesh.materialIndex = staticMesh->GetMaterialIndex();
+				subMesh.primitiveMode = staticMesh->GetPrimitiveMode();
+				subMesh.stride = vertexBuffer->GetStride();
+				subMesh.vertexCount = vertexBuffer->GetVertexCount();
+				subMesh.vertexOffset = vertexDataSize;
+
+				for (unsigned int j = 0; j <= VertexComponent_Max; ++j)
+				{
+					bool enabled;
+					ComponentType type;
+					std::size_t offset;
+					declaration->GetComponent(static_cast<VertexComponent>(j), &enabled, &type, &offset);
+
+					if (enabled)
+						subMesh.components.push_back({j, static_cast<UInt32>(type), static_cast<UInt32>(offset)});
+				}
+
+				vertexDataSize += UInt64(subMesh.vertexCount) * subMesh.stride;
+
+				if (indexBuffer)
+				{
+					subMesh.indexCount = indexBuffer->GetIndexCount();
+					subMesh.largeIndices = indexBuffer->HasLargeIndices();
+
+					// Keep large indices aligned
+					indexDataSize = Align(indexDataSize, sizeof(UInt32));
+					subMesh.indexOffset = indexDataSize;
+
+					indexDataSize += UInt64(subMesh.indexCount) * indexBuffer->GetStride();
+				}
+				else
+				{
+					subMesh.indexCount = 0;
+					subMesh.indexOffset = 0;
+					subMesh.largeIndices = 0;
+				}
+			}
+
+			ByteArray description;
+			ByteStream descriptionStream(&description);
+			descriptionStream.SetDataEndianness(Endianness_LittleEndian);
+
+			for (UInt32 i = 0; i < materialCount; ++i)
+				WriteMaterial(descriptionStream, mesh.GetMaterialData(i));
+
+			for (const NMesh_SubMesh& subMesh : subMeshes)
+			{
+				descriptionStream << subMesh.aabb << subMesh.indexOffset << subMesh.vertexOffset << subMesh.indexCount << subMesh.materialIndex;
+				descriptionStream << subMesh.primitiveMode << subMesh.stride << subMesh.vertexCount << subMesh.largeIndices;
+
+				descriptionStream << static_cast<UInt32>(subMesh.components.size());
+				for (const NMesh_Component& component : subMesh.components)
+					descriptionStream << component.component << component.type << component.offset;
+			}
+
+			NMesh_Header header;
+			header.magic = NMesh_Magic;
+			header.version = NMesh_Version;
+			header.materialCount = materialCount;
+			header.subMeshCount = subMeshCount;
+			header.vertexDataOffset = Align(NMesh_HeaderSize + description.GetSize(), NMesh_DataAlignment);
+			header.vertexDataSize = vertexDataSize;
+			header.indexDataOffset = Align(header.vertexDataOffset + vertexDataSize, NMesh_DataAlignment);
+			header.indexDataSize = indexDataSize;
+
+			ByteStream byteStream(&stream);
+			byteStream.SetDataEndianness(Endianness_LittleEndian);
+
+			byteStream << header.magic << header.version << header.materialCount << header.subMeshCount;
+			byteStream << header.vertexDataOffset << header.vertexDataSize << header.indexDataOffset << header.indexDataSize;
+			byteStream.Write(description.GetConstBuffer(), description.GetSize());
+
+			UInt64 written = NMesh_HeaderSize + description.GetSize();
+			auto Pad = [&](UInt64 offset)
+			{
+				static const UInt8 padding[NMesh_DataAlignment] = {};
+				byteStream.Write(padding, static_cast<std::size_t>(offset - written));
+				written = offset;
+			};
+
+			Pad(header.vertexDataOffset);
+			for (UInt32 i = 0; i < subMeshCount; ++i)
+			{
+				const VertexBuffer* vertexBuffer = static_cast<const StaticMesh*>(mesh.GetSubMesh(i))->GetVertexBuffer();
+
+				std::size_t size = static_cast<std::size_t>(subMeshes[i].vertexCount) * subMeshes[i].stride;
+				if (size == 0)
+					continue;
+
+				const void* vertices = vertexBuffer->Map(BufferAccess_ReadOnly);
+				if (!vertices)
+				{
+					NazaraError("Failed to map vertex buffer");
+					return false;
+				}
+
+				byteStream.Write(vertices, size);
+				vertexBuffer->Unmap();
+
+				written += size;
+			}
+
+			Pad(header.indexDataOffset);
+			for (UInt32 i = 0; i < subMeshCount; ++i)
+			{
+				const IndexBuffer* indexBuffer = mesh.GetSubMesh(i)->GetIndexBuffer();
+				if (!indexBuffer || subMeshes[i].indexCount == 0)
+					continue;
+
+				Pad(header.indexDataOffset + subMeshes[i].indexOffset);
+
+				std::size_t size = static_cast<std::size_t>(subMeshes[i].indexCount) * indexBuffer->GetStride();
+
+				const void* indices = indexBuffer->Map(BufferAccess_ReadOnly);
+				if (!indices)
+				{
+					NazaraError("Failed to map index buffer");
+					return false;
+				}
+
+				byteStream.Write(indices, size);
+				indexBuffer->Unmap();
+
+				written += size;
+			}
+
+			return true;
+		}
+	}
+
+	namespace Loaders
+	{
+		void RegisterNMeshSaver()
+		{
+			MeshSaver::RegisterSaver(IsSupported, SaveToStream);
+		}
+
+		void UnregisterNMeshSaver()
+		{
+			MeshSaver::UnregisterSaver(IsSupported, SaveToStream);
+		}
+	}
+}
@@ -4,6 +4,11 @@
 
 #include <Nazara/Utility/Formats/OBJLoader.hpp>
 #include <Nazara/Core/ErrorFlags.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/MappedFile.hpp>
+#include <Nazara/Core/ResourceWatcher.hpp>
+#include <Nazara/Utility/Algorithm.hpp>
+#include <Nazara/Utility/BufferAllocator.hpp>
 #include <Nazara/Utility/IndexMapper.hpp>
 #include <Nazara/Utility/MaterialData.hpp>
 #include <Nazara/Utility/Mesh.hpp>
@@ -16,8 +21,6 @@
 #include <unordered_map>
 #include <Nazara/Utility/Debug.hpp>
 
-///TODO: N'avoir qu'un seul VertexBuffer communs à tous les meshes
-
 namespace Nz
 {
 	namespace
@@ -44,10 +47,10 @@ namespace Nz
 
 		bool ParseMTL(Mesh* mesh, const String& filePath, const String* materials, const OBJParser::Mesh* meshes, UInt32 meshCount)
 		{
-			File file(filePath);
-			if (!file.Open(OpenMode_ReadOnly | OpenMode_Text))
+			MappedFile file;
+			if (!file.Open(filePath))
 			{
-				NazaraError("Failed to open MTL file (" + file.GetPath() + ')');
+				NazaraError("Failed to open MTL file (" + filePath + ')');
 				return false;
 			}
 
@@ -318,9 +321,6 @@ namespace Nz
 					continue;
 				}
 
-				if (parameters.optimizeIndexBuffers)
-					indexBuffer->Optimize();
-
 				subMesh->GenerateAABB();
 				subMesh->SetIndexBuffer(indexBuffer);
 				subMesh->SetMaterialIndex(meshes[i].material);
@@ -334,6 +334,17 @@ namespace Nz
 				else if (normalPtr)
 					subMesh->GenerateNormals();
 
+				OptimizeMesh(vertexBuffer, indexBuffer, parameters);
+
+				if (parameters.compressedVertexDeclaration)
+					ConvertVertices(vertexBuffer, parameters.compressedVertexDeclaration);
+
+				if (parameters.bufferAllocator)
+				{
+					parameters.bufferAllocator->Relocate(indexBuffer);
+					parameters.bufferAllocator->Relocate(vertexBuffer);
+				}
+
 				mesh->AddSubMesh(meshes[i].name + '_' + materials[meshes[i].material], subMesh);
 			}
 			mesh->SetMaterialCount(parser.GetMaterialCount());
@@ -342,9 +353,17 @@ namespace Nz
 				mesh->Recenter();
 
 			// On charge les matériaux si demandé
+			String filePath = stream.GetPath();
+			if (!filePath.IsEmpty())
+				ResourceWatcher::ClearDependencies(filePath);
+
 			String mtlLib = parser.GetMtlLib();
 			if (!mtlLib.IsEmpty())
 			{
+				// Les matériaux font partie du mesh, il doit être rechargé si le fichier MTL change
+				if (!filePath.IsEmpty())
+					ResourceWatcher::AddDependency(filePath, stream.GetDirectory() + mtlLib);
+
 				ErrorFlags flags(ErrorFlag_ThrowExceptionDisabled);
 				ParseMTL(mesh, stream.GetDirectory() + mtlLib, materials, meshes, meshCount);
 			}
@@ -4,422 +4,502 @@
 
 #include <Nazara/Utility/Formats/OBJParser.hpp>
 #include <Nazara/Core/CallOnExit.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Core/TextScanner.hpp>
 #include <Nazara/Utility/Config.hpp>
+#include <algorithm>
 #include <cctype>
+#include <cstring>
 #include <memory>
 #include <unordered_map>
 #include <Nazara/Utility/Debug.hpp>
 
 namespace Nz
 {
-	bool OBJParser::Check(Stream& stream)
+	namespace
 	{
-		m_currentStream = &stream;
-		m_errorCount = 0;
-		m_keepLastLine = false;
-		m_lineCount = 0;
+		constexpr std::size_t CheckedSize = 64 * 1024; //< Only the beginning of a file is needed to check it
+		constexpr std::size_t ParallelChunkSize = 4 * 1024 * 1024; //< Bigger files are split in chunks parsed in parallel
 
-		// Force stream in text mode, reset it at the end
-		Nz::CallOnExit resetTextMode;
-		if ((stream.GetStreamOptions() & StreamOption_Text) == 0)
+		struct ParsedFace
 		{
-			stream.EnableTextMode(true);
+			UInt32 firstVertex;
+			UInt32 vertexCount;
+			UInt32 line;
+			UInt32 normalCount;   //< Normals parsed in the chunk before this face, to resolve negative indices
+			UInt32 positionCount; //< Same for positions
+			UInt32 texCoordCount; //< Same for texture coordinates
+		};
 
-			resetTextMode.Reset([&stream] ()
-			{
-				stream.EnableTextMode(false);
-			});
-		}
+		struct ParsedFaceVertex
+		{
+			Int32 normal;
+			Int32 position;
+			Int32 texCoord;
+		};
 
-		unsigned int failureCount = 0;
-		while (Advance(false))
+		struct ParsedGroupChange
 		{
-			switch (std::tolower(m_currentLine[0]))
-			{
-				case '#': //< Comment
-					failureCount--;
-					break;
-
-				case 'f': //< Face
-				case 'g': //< Group (inside a mesh)
-				case 'o': //< Object (defines a mesh)
-				case 's': //< Smooth
-				{
-					if (m_currentLine.GetSize() > 1 && m_currentLine[1] == ' ')
-						return true;
+			std::size_t faceIndex; //< Index of the first face following the change
+			String name;
+			bool isMaterial;
+		};
 
-					break;
-				}
+		struct ParsedWarning
+		{
+			String message;
+			std::size_t line;
+		};
 
-				case 'm': //< MTLLib
-					if (m_currentLine.GetWord(0).ToLower() == "mtllib")
-						return true;
+		// Everything a chunk of the file defines, in the order it defines it
+		struct ParsedChunk
+		{
+			std::vector<ParsedFace> faces;
+			std::vector<ParsedFaceVertex> vertices;
+			std::vector<ParsedGroupChange> groupChanges;
+			std::vector<ParsedWarning> warnings;
+			std::vector<Vector3f> normals;
+			std::vector<Vector4f> positions;
+			std::vector<Vector3f> texCoords;
+			String mtlLib;
+			std::size_t lineCount = 0;
+			bool aborted = false;
+		};
 
-					break;
+		void ParseChunk(const char* text, std::size_t size, UInt32 reservedVertexCount, ParsedChunk* chunk)
+		{
+			chunk->normals.reserve(reservedVertexCount);
+			chunk->positions.reserve(reservedVertexCount);
+			chunk->texCoords.reserve(reservedVertexCount);
 
-				case 'u': //< Usemtl
-					if (m_currentLine.GetWord(0).ToLower() == "usemtl")
-						return true;
+			TextScanner scanner(text, size);
 
-					break;
+			#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
+			std::size_t errorCount = 0;
+			auto UnrecognizedLine = [&] () -> bool
+			{
+				chunk->warnings.push_back({"Unrecognized \"" + scanner.GetLine() + '"', scanner.GetLineNumber()});
 
-				case 'v': //< Position/Normal/Texcoords
+				errorCount++;
+				if (errorCount > 10 && (errorCount * 100 / scanner.GetLineNumber()) > 50)
 				{
-					String word = m_currentLine.GetWord(0).ToLower();
-					if (word == 'v')
-						return true;
-					else if (word == "vn")
-						return true;
-					else if (word == "vt")
-						return true;
-
-					break;
+					chunk->aborted = true;
+					return false; //< Abort parsing if error percentage is too high
 				}
 
-				default:
-					break;
-			}
+				return true;
+			};
+			#endif
 
-			if (++failureCount > 20U)
-				return false;
-		}
+			while (scanner.NextLine())
+			{
+				switch (std::tolower(static_cast<unsigned char>(*scanner.GetCursor())))
+				{
+					case '#': //< Comment
+						break;
 
-		return false;
-	}
+					case 'f': //< Face
+					{
+						if (!scanner.ExpectWord("f", false))
+						{
+							#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
+							if (!UnrecognizedLine())
+								return;
+							#endif
+							break;
+						}
 
-	bool OBJParser::Parse(Nz::Stream& stream, UInt32 reservedVertexCount)
-	{
-		m_currentStream = &stream;
-		m_errorCount = 0;
-		m_keepLastLine = false;
-		m_lineCount = 0;
+						ParsedFace face;
+						face.firstVertex = static_cast<UInt32>(chunk->vertices.size());
+						face.line = static_cast<UInt32>(scanner.GetLineNumber());
+						face.normalCount = static_cast<UInt32>(chunk->normals.size());
+						face.positionCount = static_cast<UInt32>(chunk->positions.size());
+						face.texCoordCount = static_cast<UInt32>(chunk->texCoords.size());
 
-		// Force stream in text mode, reset it at the end
-		Nz::CallOnExit resetTextMode;
-		if ((stream.GetStreamOptions() & StreamOption_Text) == 0)
-		{
-			stream.EnableTextMode(true);
+						// Each vertex is written as "p", "p/t", "p//n" or "p/t/n"
+						bool error = false;
+						while (!scanner.EndOfLine())
+						{
+							ParsedFaceVertex vertex = {0, 0, 0};
+							if (!scanner.Read(&vertex.position))
+							{
+								error = true;
+								break;
+							}
 
-			resetTextMode.Reset([&stream] ()
-			{
-				stream.EnableTextMode(false);
-			});
-		}
+							if (scanner.Expect('/'))
+							{
+								if (scanner.Expect('/'))
+									error = !scanner.Read(&vertex.normal);
+								else
+									error = !scanner.Read(&vertex.texCoord) || (scanner.Expect('/') && !scanner.Read(&vertex.normal));
 
-		String matName, meshName;
-		matName = meshName = "default";
-		m_meshes.clear();
-		m_mtlLib.Clear();
+								if (error)
+									break;
+							}
 
-		m_normals.clear();
-		m_positions.clear();
-		m_texCoords.clear();
+							chunk->vertices.push_back(vertex);
+						}
 
-		// Reserve some space for incoming vertices
-		m_normals.reserve(reservedVertexCount);
-		m_positions.reserve(reservedVertexCount);
-		m_texCoords.reserve(reservedVertexCount);
+						face.vertexCount = static_cast<UInt32>(chunk->vertices.size() - face.firstVertex);
+						if (error || face.vertexCount < 3)
+						{
+							chunk->vertices.resize(face.firstVertex); //< Remove vertices
 
-		// Sort meshes by material and group
-		using MatPair = std::pair<Mesh, unsigned int>;
-		std::unordered_map<String, std::unordered_map<String, MatPair>> meshesByName;
+							#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
+							if (!UnrecognizedLine())
+								return;
+							#endif
+							break;
+						}
 
-		UInt32 faceReserve = 0;
-		UInt32 vertexReserve = 0;
-		unsigned int matCount = 0;
-		auto GetMaterial = [&] (const String& mesh, const String& mat) -> Mesh*
-		{
-			auto& map = meshesByName[mesh];
-			auto it = map.find(mat);
-			if (it == map.end())
-				it = map.insert(std::make_pair(mat, MatPair(Mesh(), matCount++))).first;
+						chunk->faces.push_back(face);
+						break;
+					}
 
-			Mesh& meshData = it->second.first;
+					case 'm': //< MTLLib
+						if (!scanner.ExpectWord("mtllib", false))
+						{
+							#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
+							if (!UnrecognizedLine())
+								return;
+							#endif
+							break;
+						}
 
-			meshData.faces.reserve(faceReserve);
-			meshData.vertices.reserve(vertexReserve);
-			faceReserve = 0;
-			vertexReserve = 0;
+						chunk->mtlLib = scanner.ReadRemaining();
+						break;
 
-			return &(it->second.first);
-		};
+					case 'g': //< Group (inside a mesh)
+					case 'o': //< Object (defines a mesh)
+					{
+						String objectName;
+						if (scanner.ExpectWord("g", false) || scanner.ExpectWord("o", false))
+							objectName = scanner.ReadRemaining();
 
-		// On prépare le mesh par défaut
-		Mesh* currentMesh = nullptr;
+						if (objectName.IsEmpty())
+						{
+							#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
+							if (!UnrecognizedLine())
+								return;
+							#endif
+							break;
+						}
 
-		while (Advance(false))
-		{
-			switch (std::tolower(m_currentLine[0]))
-			{
-				case '#': //< Comment
-					// Some softwares write comments to gives the number of vertex/faces an importer can expect
-					unsigned int data;
-					if (std::sscanf(m_currentLine.GetConstBuffer(), "# position count: %u", &data) == 1)
-						m_positions.reserve(data);
-					else if (std::sscanf(m_currentLine.GetConstBuffer(), "# normal count: %u", &data) == 1)
-						m_normals.reserve(data);
-					else if (std::sscanf(m_currentLine.GetConstBuffer(), "# texcoords count: %u", &data) == 1)
-						m_texCoords.reserve(data);
-					else if (std::sscanf(m_currentLine.GetConstBuffer(), "# face count: %u", &data) == 1)
-						faceReserve = data;
-					else if (std::sscanf(m_currentLine.GetConstBuffer(), "# vertex count: %u", &data) == 1)
-						vertexReserve = data;
-
-					break;
-
-				case 'f': //< Face
-				{
-					if (m_currentLine.GetSize() < 7) // Since we only treat triangles, this is the minimum length of a face line (f 1 2 3)
-					{
-						#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-						if (!UnrecognizedLine())
-							return false;
-						#endif
+						chunk->groupChanges.push_back({chunk->faces.size(), std::move(objectName), false});
 						break;
 					}
 
-					unsigned int vertexCount = m_currentLine.Count(' ');
-					if (vertexCount < 3)
+					#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
+					case 's': //< Smooth
 					{
-						#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-						if (!UnrecognizedLine())
-							return false;
-						#endif
+						bool valid = false;
+						if (scanner.ExpectWord("s", false))
+						{
+							String param = scanner.ReadRemaining();
+							valid = (param == "all" || param == "on" || param == "off" || param.IsNumber());
+						}
+
+						if (!valid && !UnrecognizedLine())
+							return;
+
 						break;
 					}
+					#endif
 
-					if (!currentMesh)
-						currentMesh = GetMaterial(meshName, matName);
+					case 'u': //< Usemtl
+					{
+						String matName;
+						if (scanner.ExpectWord("usemtl", false))
+							matName = scanner.ReadRemaining();
 
-					Face face;
-					face.firstVertex = static_cast<UInt32>(currentMesh->vertices.size());
-					face.vertexCount = static_cast<UInt32>(vertexCount);
+						if (matName.IsEmpty())
+						{
+							#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
+							if (!UnrecognizedLine())
+								return;
+							#endif
+							break;
+						}
 
-					currentMesh->vertices.resize(face.firstVertex + vertexCount, FaceVertex{0, 0, 0});
+						chunk->groupChanges.push_back({chunk->faces.size(), std::move(matName), true});
+						break;
+					}
 
-					bool error = false;
-					unsigned int pos = 2;
-					for (unsigned int i = 0; i < vertexCount; ++i)
+					case 'v': //< Position/Normal/Texcoords
 					{
-						int offset;
-						int n = 0;
-						int p = 0;
-						int t = 0;
+						StringView word;
+						scanner.ReadWord(&word);
 
-						if (std::sscanf(&m_currentLine[pos], "%d/%d/%d%n", &p, &t, &n, &offset) != 3)
+						bool valid = false;
+						if (word.GetSize() == 1)
 						{
-							if (std::sscanf(&m_currentLine[pos], "%d//%d%n", &p, &n, &offset) != 2)
+							Vector4f vertex(Vector3f::Zero(), 1.f);
+							if (scanner.Read(&vertex.x))
 							{
-								if (std::sscanf(&m_currentLine[pos], "%d/%d%n", &p, &t, &offset) != 2)
-								{
-									if (std::sscanf(&m_currentLine[pos], "%d%n", &p, &offset) != 1)
-									{
-										#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-										if (!UnrecognizedLine())
-											return false;
-										#endif
-										error = true;
-										break;
-									}
-								}
-							}
-						}
+								if (scanner.Read(&vertex.y) && scanner.Read(&vertex.z))
+									scanner.Read(&vertex.w);
 
-						if (p < 0)
-						{
-							p += static_cast<int>(m_positions.size());
-							if (p < 0)
-							{
-								Error("Vertex index out of range (" + String::Number(p) + " < 0");
-								error = true;
-								break;
+								chunk->positions.push_back(vertex);
+								valid = true;
 							}
-
-							++p;
 						}
-
-						if (n < 0)
+						else if (word.Compare("vn", String::CaseInsensitive) == 0)
 						{
-							n += static_cast<int>(m_normals.size());
-							if (n < 0)
+							Vector3f normal(Vector3f::Zero());
+							if (scanner.Read(&normal.x) && scanner.Read(&normal.y) && scanner.Read(&normal.z))
 							{
-								Error("Normal index out of range (" + String::Number(n) + " < 0");
-								error = true;
-								break;
+								chunk->normals.push_back(normal);
+								valid = true;
 							}
-
-							++n;
 						}
-
-						if (t < 0)
+						else if (word.Compare("vt", String::CaseInsensitive) == 0)
 						{
-							t += static_cast<int>(m_texCoords.size());
-							if (t < 0)
+							Vector3f uvw(Vector3f::Zero());
+							if (scanner.Read(&uvw.x) && scanner.Read(&uvw.y))
 							{
-								Error("Texture coordinates index out of range (" + String::Number(t) + " < 0");
-								error = true;
-								break;
-							}
-
-							++t;
-						}
+								scanner.Read(&uvw.z);
 
-						if (static_cast<std::size_t>(p) > m_positions.size())
-						{
-							Error("Vertex index out of range (" + String::Number(p) + " >= " + String::Number(m_positions.size()) + ')');
-							error = true;
-							break;
-						}
-						else if (n != 0 && static_cast<std::size_t>(n) > m_normals.size())
-						{
-							Error("Normal index out of range (" + String::Number(n) + " >= " + String::Number(m_normals.size()) + ')');
-							error = true;
-							break;
-						}
-						else if (t != 0 && static_cast<std::size_t>(t) > m_texCoords.size())
-						{
-							Error("TexCoord index out of range (" + String::Number(t) + " >= " + String::Number(m_texCoords.size()) + ')');
-							error = true;
-							break;
+								chunk->texCoords.push_back(uvw);
+								valid = true;
+							}
 						}
 
-						currentMesh->vertices[face.firstVertex + i].normal = static_cast<UInt32>(n);
-						currentMesh->vertices[face.firstVertex + i].position = static_cast<UInt32>(p);
-						currentMesh->vertices[face.firstVertex + i].texCoord = static_cast<UInt32>(t);
-
-						pos += offset;
-					}
-
-					if (!error)
-						currentMesh->faces.push_back(std::move(face));
-					else
-						currentMesh->vertices.resize(face.firstVertex); //< Remove vertices
-
-					break;
-				}
-
-				case 'm': //< MTLLib
-					#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-					if (m_currentLine.GetWord(0).ToLower() != "mtllib")
-						if (!UnrecognizedLine())
-							return false;
-					#endif
-
-					m_mtlLib = m_currentLine.SubString(m_currentLine.GetWordPosition(1));
-					break;
-
-				case 'g': //< Group (inside a mesh)
-				case 'o': //< Object (defines a mesh)
-				{
-					if (m_currentLine.GetSize() <= 2 || m_currentLine[1] != ' ')
-					{
 						#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-						if (!UnrecognizedLine())
-							return false;
+						if (!valid && !UnrecognizedLine())
+							return;
+						#else
+						NazaraUnused(valid);
 						#endif
+
 						break;
 					}
 
-					String objectName = m_currentLine.SubString(m_currentLine.GetWordPosition(1));
-					if (objectName.IsEmpty())
-					{
+					default:
 						#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
 						if (!UnrecognizedLine())
-							return false;
+							return;
 						#endif
 						break;
-					}
+				}
+			}
 
-					meshName = objectName;
-					currentMesh = nullptr;
-					break;
+			chunk->lineCount = scanner.GetLineNumber();
+		}
+
+		bool ResolveIndex(Int32 index, std::size_t count, bool required, const char* name, std::size_t line, UInt32* resolvedIndex)
+		{
+			// OBJ indices start from one, negative ones are relative to the last element defined
+			if (index < 0)
+			{
+				Int64 absoluteIndex = static_cast<Int64>(count) + index;
+				if (absoluteIndex < 0)
+				{
+					NazaraError(String(name) + " index out of range (" + String::Number(absoluteIndex) + " < 0) at line #" + String::Number(line));
+					return false;
 				}
 
-				#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-				case 's': //< Smooth
-					if (m_currentLine.GetSize() <= 2 || m_currentLine[1] == ' ')
-					{
-						String param = m_currentLine.SubString(2);
-						if (param != "all" && param != "on" && param != "off" && !param.IsNumber())
-						{
-							if (!UnrecognizedLine())
-								return false;
-						}
-					}
-					else if (!UnrecognizedLine())
-						return false;
-					break;
-					#endif
+				*resolvedIndex = static_cast<UInt32>(absoluteIndex + 1);
+				return true;
+			}
 
-				case 'u': //< Usemtl
-					#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-					if (m_currentLine.GetWord(0) != "usemtl" && !UnrecognizedLine())
-						return false;
-					#endif
+			if (index == 0 && required)
+			{
+				NazaraError(String(name) + " index out of range (0 < 1) at line #" + String::Number(line));
+				return false;
+			}
 
-					matName = m_currentLine.SubString(m_currentLine.GetWordPosition(1));
-					currentMesh = nullptr;
-					if (matName.IsEmpty())
-					{
-						#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-						if (!UnrecognizedLine())
-							return false;
-						#endif
-						break;
-					}
-					break;
+			if (static_cast<std::size_t>(index) > count)
+			{
+				NazaraError(String(name) + " index out of range (" + String::Number(index) + " >= " + String::Number(count) + ") at line #" + String::Number(line));
+				return false;
+			}
+
+			*resolvedIndex = static_cast<UInt32>(index);
+			return true;
+		}
+	}
+
+	bool OBJParser::Check(Stream& stream)
+	{
+		TextScanner scanner(stream, CheckedSize);
+
+		unsigned int failureCount = 0;
+		while (scanner.NextLine())
+		{
+			StringView word;
+			scanner.ReadWord(&word);
+
+			if (word.StartsWith("#")) //< Comment
+				continue;
+
+			if (word.Compare("f", String::CaseInsensitive) == 0 ||      //< Face
+			    word.Compare("g", String::CaseInsensitive) == 0 ||      //< Group (inside a mesh)
+			    word.Compare("o", String::CaseInsensitive) == 0 ||      //< Object (defines a mesh)
+			    word.Compare("s", String::CaseInsensitive) == 0 ||      //< Smooth
+			    word.Compare("mtllib", String::CaseInsensitive) == 0 || //< MTLLib
+			    word.Compare("usemtl", String::CaseInsensitive) == 0 || //< Usemtl
+			    word.Compare("v", String::CaseInsensitive) == 0 ||      //< Position
+			    word.Compare("vn", String::CaseInsensitive) == 0 ||     //< Normal
+			    word.Compare("vt", String::CaseInsensitive) == 0)       //< Texcoords
+			{
+				// A keyword alone on its line is not enough
+				if (!scanner.EndOfLine())
+					return true;
+			}
+
+			if (++failureCount > 20U)
+				return false;
+		}
+
+		return false;
+	}
+
+	bool OBJParser::Parse(Nz::Stream& stream, UInt32 reservedVertexCount)
+	{
+		m_meshes.clear();
+		m_mtlLib.Clear();
+
+		m_normals.clear();
+		m_positions.clear();
+		m_texCoords.clear();
+
+		// The text is parsed in place when the stream lives in memory (mapped file, archive entry)
+		TextScanner text(stream);
+
+		// Big files are split at line boundaries into chunks parsed in parallel, the chunks are then merged in order
+		std::size_t chunkCount = std::max<std::size_t>(text.GetSize() / ParallelChunkSize, 1);
+		std::vector<ParsedChunk> chunks(chunkCount);
+		std::vector<std::size_t> chunkOffsets(chunkCount + 1);
+		chunkOffsets[0] = 0;
+		for (std::size_t i = 1; i < chunkCount; ++i)
+		{
+			std::size_t offset = std::max(i * (text.GetSize() / chunkCount), chunkOffsets[i - 1]);
+			const char* lineEnd = static_cast<const char*>(std::memchr(text.GetText() + offset, '\n', text.GetSize() - offset));
+			chunkOffsets[i] = (lineEnd) ? lineEnd - text.GetText() + 1 : text.GetSize();
+		}
+		chunkOffsets[chunkCount] = text.GetSize();
+
+		UInt32 chunkReservedVertexCount = static_cast<UInt32>(reservedVertexCount / chunkCount);
+		TaskScheduler::ParallelFor(0, chunkCount, 1, [&] (std::size_t begin, std::size_t end)
+		{
+			for (std::size_t i = begin; i < end; ++i)
+				ParseChunk(text.GetText() + chunkOffsets[i], chunkOffsets[i + 1] - chunkOffsets[i], chunkReservedVertexCount, &chunks[i]);
+		});
+
+		std::size_t normalCount = 0;
+		std::size_t positionCount = 0;
+		std::size_t texCoordCount = 0;
+		for (const ParsedChunk& chunk : chunks)
+		{
+			normalCount += chunk.normals.size();
+			positionCount += chunk.positions.size();
+			texCoordCount += chunk.texCoords.size();
+		}
+
+		m_normals.reserve(normalCount);
+		m_positions.reserve(positionCount);
+		m_texCoords.reserve(texCoordCount);
+
+		// Sort meshes by material and group
+		using MatPair = std::pair<Mesh, unsigned int>;
+		std::unordered_map<String, std::unordered_map<String, MatPair>> meshesByName;
+
+		unsigned int matCount = 0;
+		auto GetMaterial = [&] (const String& mesh, const String& mat) -> Mesh*
+		{
+			auto& map = meshesByName[mesh];
+			auto it = map.find(mat);
+			if (it == map.end())
+				it = map.insert(std::make_pair(mat, MatPair(Mesh(), matCount++))).first;
+
+			return &(it->second.first);
+		};
+
+		String matName, meshName;
+		matName = meshName = "default";
+		Mesh* currentMesh = nullptr;
+
+		std::size_t lineOffset = 0;
+		for (ParsedChunk& chunk : chunks)
+		{
+			for (const ParsedWarning& warning : chunk.warnings)
+				NazaraWarning(warning.message + " at line #" + String::Number(lineOffset + warning.line));
+
+			if (chunk.aborted)
+			{
+				NazaraError("Aborting parsing because of error percentage");
+				return false;
+			}
+
+			if (!chunk.mtlLib.IsEmpty())
+				m_mtlLib = chunk.mtlLib;
+
+			// Indices of this chunk are relative to the vertices of the previous chunks
+			std::size_t normalOffset = m_normals.size();
+			std::size_t positionOffset = m_positions.size();
+			std::size_t texCoordOffset = m_texCoords.size();
+
+			m_normals.insert(m_normals.end(), chunk.normals.begin(), chunk.normals.end());
+			m_positions.insert(m_positions.end(), chunk.positions.begin(), chunk.positions.end());
+			m_texCoords.insert(m_texCoords.end(), chunk.texCoords.begin(), chunk.texCoords.end());
+
+			auto ApplyGroupChange = [&] (ParsedGroupChange& change)
+			{
+				if (change.isMaterial)
+					matName = std::move(change.name);
+				else
+					meshName = std::move(change.name);
+
+				currentMesh = nullptr;
+			};
+
+			std::size_t groupChangeIndex = 0;
+			for (std::size_t faceIndex = 0; faceIndex < chunk.faces.size(); ++faceIndex)
+			{
+				for (; groupChangeIndex < chunk.groupChanges.size() && chunk.groupChanges[groupChangeIndex].faceIndex <= faceIndex; ++groupChangeIndex)
+					ApplyGroupChange(chunk.groupChanges[groupChangeIndex]);
+
+				const ParsedFace& parsedFace = chunk.faces[faceIndex];
+				std::size_t line = lineOffset + parsedFace.line;
+
+				if (!currentMesh)
+					currentMesh = GetMaterial(meshName, matName);
+
+				Face face;
+				face.firstVertex = static_cast<UInt32>(currentMesh->vertices.size());
+				face.vertexCount = parsedFace.vertexCount;
 
-				case 'v': //< Position/Normal/Texcoords
+				currentMesh->vertices.resize(face.firstVertex + face.vertexCount);
+
+				bool error = false;
+				for (UInt32 i = 0; i < face.vertexCount; ++i)
 				{
-					String word = m_currentLine.GetWord(0).ToLower();
-					if (word == 'v')
-					{
-						Vector4f vertex(Vector3f::Zero(), 1.f);
-						unsigned int paramCount = std::sscanf(&m_currentLine[2], "%f %f %f %f", &vertex.x, &vertex.y, &vertex.z, &vertex.w);
-						if (paramCount >= 1)
-							m_positions.push_back(vertex);
-						#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-						else if (!UnrecognizedLine())
-							return false;
-						#endif
-					}
-					else if (word == "vn")
-					{
-						Vector3f normal(Vector3f::Zero());
-						unsigned int paramCount = std::sscanf(&m_currentLine[3], "%f %f %f", &normal.x, &normal.y, &normal.z);
-						if (paramCount == 3)
-							m_normals.push_back(normal);
-						#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-						else if (!UnrecognizedLine())
-							return false;
-						#endif
-					}
-					else if (word == "vt")
+					const ParsedFaceVertex& parsedVertex = chunk.vertices[parsedFace.firstVertex + i];
+					FaceVertex& vertex = currentMesh->vertices[face.firstVertex + i];
+
+					if (!ResolveIndex(parsedVertex.position, positionOffset + parsedFace.positionCount, true, "Vertex", line, &vertex.position) ||
+					    !ResolveIndex(parsedVertex.normal, normalOffset + parsedFace.normalCount, false, "Normal", line, &vertex.normal) ||
+					    !ResolveIndex(parsedVertex.texCoord, texCoordOffset + parsedFace.texCoordCount, false, "TexCoord", line, &vertex.texCoord))
 					{
-						Vector3f uvw(Vector3f::Zero());
-						unsigned int paramCount = std::sscanf(&m_currentLine[3], "%f %f %f", &uvw.x, &uvw.y, &uvw.z);
-						if (paramCount >= 2)
-							m_texCoords.push_back(uvw);
-						#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-						else if (!UnrecognizedLine())
-							return false;
-						#endif
+						error = true;
+						break;
 					}
-					#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-					else if (!UnrecognizedLine())
-						return false;
-					#endif
-
-					break;
 				}
 
-				default:
-					#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-					if (!UnrecognizedLine())
-						return false;
-					#endif
-					break;
+				if (!error)
+					currentMesh->faces.push_back(face);
+				else
+					currentMesh->vertices.resize(face.firstVertex); //< Remove vertices
 			}
+
+			for (; groupChangeIndex < chunk.groupChanges.size(); ++groupChangeIndex)
+				ApplyGroupChange(chunk.groupChanges[groupChangeIndex]);
+
+			lineOffset += chunk.lineCount;
+
+			// Release memory as soon as possible, big files need a lot of it
+			chunk = ParsedChunk();
 		}
 
 		std::unordered_map<String, unsigned int> materials;
@@ -599,34 +679,4 @@ namespace Nz
 
 		return true;
 	}
-
-	bool OBJParser::Advance(bool required)
-	{
-		if (!m_keepLastLine)
-		{
-			do
-			{
-				if (m_currentStream->EndOfStream())
-				{
-					if (required)
-						Error("Incomplete OBJ file");
-
-					return false;
-				}
-
-				m_lineCount++;
-
-				m_currentLine = m_currentStream->ReadLine();
-				if (m_currentLine.IsEmpty())
-					continue;
-
-				m_currentLine.Simplify(); // Simplify lines (convert multiple blanks into a single space and trims)
-			}
-			while (m_currentLine.IsEmpty());
-		}
-		else
-			m_keepLastLine = false;
-
-		return true;
-	}
 }
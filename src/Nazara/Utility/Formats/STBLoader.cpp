@@ -8,6 +8,7 @@
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/Stream.hpp>
 #include <Nazara/Utility/Image.hpp>
+#include <limits>
 #include <set>
 #include <Nazara/Utility/Debug.hpp>
 
@@ -54,20 +55,40 @@ namespace Nz
 				return Ternary_False;
 		}
 
-		bool Load(Image* image, Stream& stream, const ImageParams& parameters)
+		// Decodes directly to the requested format when stb can, saving a conversion
+		int GetDecodedComponents(PixelFormatType loadFormat, PixelFormatType* format)
 		{
-			// Je charge tout en RGBA8 et je converti ensuite via la méthode Convert
-			// Ceci à cause d'un bug de STB lorsqu'il s'agit de charger certaines images (ex: JPG) en "default"
+			switch (loadFormat)
+			{
+				case PixelFormatType_L8:
+					*format = PixelFormatType_L8;
+					return STBI_grey;
+
+				case PixelFormatType_LA8:
+					*format = PixelFormatType_LA8;
+					return STBI_grey_alpha;
+
+				case PixelFormatType_RGB8:
+					*format = PixelFormatType_RGB8;
+					return STBI_rgb;
+
+				default:
+					// Everything else is loaded as RGBA8 and converted afterwards
+					// Because of a bug of STB when loading some images (ex: JPG) with the "default" component count
+					*format = PixelFormatType_RGBA8;
+					return STBI_rgb_alpha;
+			}
+		}
 
-			int width, height, bpp;
-			UInt8* ptr = stbi_load_from_callbacks(&callbacks, &stream, &width, &height, &bpp, STBI_rgb_alpha);
+		bool CreateImage(Image* image, UInt8* ptr, int width, int height, PixelFormatType format, const ImageParams& parameters)
+		{
 			if (!ptr)
 			{
 				NazaraError("Failed to load image: " + String(stbi_failure_reason()));
 				return false;
 			}
 
-			if (!image->Create(ImageType_2D, PixelFormatType_RGBA8, width, height, 1, (parameters.levelCount > 0) ? parameters.levelCount : 1))
+			if (!image->Create(ImageType_2D, format, width, height, 1, (parameters.levelCount > 0) ? parameters.levelCount : 1))
 			{
 				NazaraError("Failed to create image");
 				stbi_image_free(ptr);
@@ -78,23 +99,49 @@ namespace Nz
 			image->Update(ptr);
 			stbi_image_free(ptr);
 
-			if (parameters.loadFormat != PixelFormatType_Undefined)
+			if (parameters.loadFormat != PixelFormatType_Undefined && parameters.loadFormat != format)
 				image->Convert(parameters.loadFormat);
 
 			return true;
 		}
+
+		bool Load(Image* image, Stream& stream, const ImageParams& parameters)
+		{
+			PixelFormatType format;
+			int components = GetDecodedComponents(parameters.loadFormat, &format);
+
+			int width, height, bpp;
+			UInt8* ptr = stbi_load_from_callbacks(&callbacks, &stream, &width, &height, &bpp, components);
+
+			return CreateImage(image, ptr, width, height, format, parameters);
+		}
+
+		// Used for files as well, which are mapped in memory, sparing the small reads of the callbacks
+		bool LoadMemory(Image* image, const void* data, std::size_t size, const ImageParams& parameters)
+		{
+			if (size > static_cast<std::size_t>(std::numeric_limits<int>::max()))
+				return false;
+
+			PixelFormatType format;
+			int components = GetDecodedComponents(parameters.loadFormat, &format);
+
+			int width, height, bpp;
+			UInt8* ptr = stbi_load_from_memory(static_cast<const stbi_uc*>(data), static_cast<int>(size), &width, &height, &bpp, components);
+
+			return CreateImage(image, ptr, width, height, format, parameters);
+		}
 	}
 
 	namespace Loaders
 	{
 		void RegisterSTBLoader()
 		{
-			ImageLoader::RegisterLoader(IsSupported, Check, Load);
+			ImageLoader::RegisterLoader(IsSupported, Check, Load, nullptr, LoadMemory);
 		}
 
 		void UnregisterSTBLoader()
 		{
-			ImageLoader::UnregisterLoader(IsSupported, Check, Load);
+			ImageLoader::UnregisterLoader(IsSupported, Check, Load, nullptr, LoadMemory);
 		}
 	}
 }
@@ -14,6 +14,7 @@ namespace Nz
 	}
 
 	GuillotineImageAtlas::GuillotineImageAtlas() :
+	m_packing(AtlasPacking_Guillotine),
 	m_rectChoiceHeuristic(GuillotineBinPack::RectBestAreaFit),
 	m_rectSplitHeuristic(GuillotineBinPack::SplitMinimizeArea)
 	{
@@ -39,21 +40,10 @@ namespace Nz
 			}
 			#endif
 
-			m_layers[layers[i]].binPack.FreeRectangle(rects[i]);
-			m_layers[layers[i]].freedRectangles++;
+			FreeInLayer(m_layers[layers[i]], rects[i]);
 		}
 	}
 
-	GuillotineBinPack::FreeRectChoiceHeuristic GuillotineImageAtlas::GetRectChoiceHeuristic() const
-	{
-		return m_rectChoiceHeuristic;
-	}
-
-	GuillotineBinPack::GuillotineSplitHeuristic GuillotineImageAtlas::GetRectSplitHeuristic() const
-	{
-		return m_rectSplitHeuristic;
-	}
-
 	AbstractImage* GuillotineImageAtlas::GetLayer(unsigned int layerIndex) const
 	{
 		#if NAZARA_UTILITY_SAFE
@@ -75,6 +65,25 @@ namespace Nz
 		return m_layers.size();
 	}
 
+	/*!
+	* \brief Gets the algorithm used to pack images in the layers
+	* \return Packing algorithm
+	*/
+	AtlasPacking GuillotineImageAtlas::GetPacking() const
+	{
+		return m_packing;
+	}
+
+	GuillotineBinPack::FreeRectChoiceHeuristic GuillotineImageAtlas::GetRectChoiceHeuristic() const
+	{
+		return m_rectChoiceHeuristic;
+	}
+
+	GuillotineBinPack::GuillotineSplitHeuristic GuillotineImageAtlas::GetRectSplitHeuristic() const
+	{
+		return m_rectSplitHeuristic;
+	}
+
 	UInt32 GuillotineImageAtlas::GetStorage() const
 	{
 		return DataStorage_Software;
@@ -91,14 +100,7 @@ namespace Nz
 		{
 			Layer& layer = m_layers[i];
 
-			// Une fois qu'un certain nombre de rectangles ont étés libérés d'une couche, on fusionne les rectangles libres
-			if (layer.freedRectangles > 10) // Valeur totalement arbitraire
-			{
-				while (layer.binPack.MergeFreeRectangles()); // Tant qu'une fusion est possible
-				layer.freedRectangles = 0; // Et on repart de zéro
-			}
-
-			if (layer.binPack.Insert(rect, flipped, 1, false, m_rectChoiceHeuristic, m_rectSplitHeuristic))
+			if (InsertInLayer(layer, rect, flipped))
 			{
 				// Insertion réussie dans l'une des couches, on place le glyphe en file d'attente
 				layer.queuedGlyphs.resize(layer.queuedGlyphs.size()+1);
@@ -113,14 +115,14 @@ namespace Nz
 			else if (i == m_layers.size() - 1) // Dernière itération ?
 			{
 				// Dernière couche, et le glyphe ne rentre pas, peut-on agrandir la taille de l'image ?
-				Vector2ui newSize = layer.binPack.GetSize()*2;
+				Vector2ui newSize = GetLayerSize(layer)*2;
 				if (newSize == Vector2ui::Zero())
 					newSize.Set(s_atlasStartSize);
 
 				if (ResizeLayer(layer, newSize))
 				{
 					// Oui on peut !
-					layer.binPack.Expand(newSize); // On ajuste l'atlas virtuel
+					ExpandLayer(layer, newSize); // On ajuste l'atlas virtuel
 
 					// Et on relance la boucle sur la nouvelle dernière couche
 					i--;
@@ -138,7 +140,7 @@ namespace Nz
 						return false;
 					}
 
-					newLayer.binPack.Reset(newSize);
+					ResetLayer(newLayer, newSize);
 
 					m_layers.emplace_back(std::move(newLayer)); // Insertion du layer
 
@@ -151,6 +153,24 @@ namespace Nz
 		return false;
 	}
 
+	/*!
+	* \brief Sets the algorithm used to pack images in the layers
+	*
+	* \param packing Packing algorithm
+	*
+	* \remark Changing the algorithm of an atlas holding images clears it
+	* \remark Skyline packing is the fastest choice for glyph caches, which rarely free their glyphs
+	*/
+	void GuillotineImageAtlas::SetPacking(AtlasPacking packing)
+	{
+		if (m_packing == packing)
+			return;
+
+		m_packing = packing;
+		if (!m_layers.empty())
+			Clear();
+	}
+
 	void GuillotineImageAtlas::SetRectChoiceHeuristic(GuillotineBinPack::FreeRectChoiceHeuristic heuristic)
 	{
 		m_rectChoiceHeuristic = heuristic;
@@ -167,7 +187,7 @@ namespace Nz
 		if (oldImage)
 		{
 			Image& image = *static_cast<Image*>(oldImage);
-			newImage->Copy(image, Rectui(size), Vector2ui(0, 0)); // Copie des anciennes données
+			newImage->Copy(image, Rectui(0, 0, image.GetWidth(), image.GetHeight()), Vector2ui(0, 0)); // Copie des anciennes données
 		}
 
 		return newImage.release();
@@ -197,8 +217,95 @@ namespace Nz
 		return true;
 	}
 
+	void GuillotineImageAtlas::ExpandLayer(Layer& layer, const Vector2ui& size) const
+	{
+		switch (m_packing)
+		{
+			case AtlasPacking_Guillotine:
+				layer.binPack.Expand(size);
+				break;
+
+			case AtlasPacking_Shelf:
+				layer.shelfPack.Expand(size);
+				break;
+
+			case AtlasPacking_Skyline:
+				layer.skylinePack.Expand(size);
+				break;
+		}
+	}
+
+	void GuillotineImageAtlas::FreeInLayer(Layer& layer, const Rectui& rect) const
+	{
+		switch (m_packing)
+		{
+			case AtlasPacking_Guillotine:
+				layer.binPack.FreeRectangle(rect);
+				layer.freedRectangles++;
+				break;
+
+			case AtlasPacking_Shelf:
+				layer.shelfPack.FreeRectangle(rect);
+				break;
+
+			case AtlasPacking_Skyline:
+				layer.skylinePack.FreeRectangle(rect);
+				break;
+		}
+	}
+
+	Vector2ui GuillotineImageAtlas::GetLayerSize(const Layer& layer) const
+	{
+		switch (m_packing)
+		{
+			case AtlasPacking_Guillotine:
+				return layer.binPack.GetSize();
+
+			case AtlasPacking_Shelf:
+				return layer.shelfPack.GetSize();
+
+			case AtlasPacking_Skyline:
+				return layer.skylinePack.GetSize();
+		}
+
+		NazaraInternalError("Unhandled atlas packing (0x" + String::Number(m_packing, 16) + ')');
+		return Vector2ui::Zero();
+	}
+
+	bool GuillotineImageAtlas::InsertInLayer(Layer& layer, Rectui* rect, bool* flipped) const
+	{
+		switch (m_packing)
+		{
+			case AtlasPacking_Guillotine:
+				// Une fois qu'un certain nombre de rectangles ont étés libérés d'une couche, on fusionne les rectangles libres
+				if (layer.freedRectangles > 10) // Valeur totalement arbitraire
+				{
+					while (layer.binPack.MergeFreeRectangles()); // Tant qu'une fusion est possible
+					layer.freedRectangles = 0; // Et on repart de zéro
+				}
+
+				return layer.binPack.Insert(rect, flipped, 1, false, m_rectChoiceHeuristic, m_rectSplitHeuristic);
+
+			case AtlasPacking_Shelf:
+				// Les étagères ne tournent jamais les rectangles
+				*flipped = false;
+				return layer.shelfPack.Insert(rect, 1);
+
+			case AtlasPacking_Skyline:
+				return layer.skylinePack.Insert(rect, flipped, 1);
+		}
+
+		NazaraInternalError("Unhandled atlas packing (0x" + String::Number(m_packing, 16) + ')');
+		return false;
+	}
+
 	void GuillotineImageAtlas::ProcessGlyphQueue(Layer& layer) const
 	{
+		// Les images logicielles sont écrites au travers d'une seule vue, sans vérification de propriété par glyphe
+		ImageView<UInt8> layerView;
+		if (GetStorage() == DataStorage_Software)
+			layerView = static_cast<Image*>(layer.image.get())->GetView();
+
 		std::vector<UInt8> pixelBuffer;
 
 		for (QueuedGlyph& glyph : layer.queuedGlyphs)
@@ -220,6 +327,31 @@ namespace Nz
 				paddingY = (glyph.rect.height - glyphHeight)/2;
 			}
 
+			if (layerView.IsValid())
+			{
+				ImageView<UInt8> rectView = layerView.GetSubView(glyph.rect);
+				if (paddingX > 0 || paddingY > 0)
+					rectView.Fill(Color(0, 0, 0, 0)); // On remplit les contours
+
+				ImageView<const UInt8> glyphView = glyph.image.GetConstView();
+				if (glyph.flipped)
+				{
+					// On tourne le glyphe pour qu'il rentre dans le rectangle, directement dans l'atlas
+					ImageView<UInt8> dstView = rectView.GetSubView(Boxui(paddingX, paddingY, 0, glyphHeight, glyphWidth, 1));
+					for (unsigned int x = 0; x < glyphWidth; ++x)
+					{
+						UInt8* dst = dstView.GetPixels(0, x);
+						for (unsigned int y = 0; y < glyphHeight; ++y)
+							*dst++ = *glyphView.GetPixels(glyphWidth - 1 - x, y); // BPP = 1
+					}
+				}
+				else
+					rectView.GetSubView(Boxui(paddingX, paddingY, 0, glyphWidth, glyphHeight, 1)).Copy(glyphView);
+
+				glyph.image.Destroy(); // On libère l'image dès que possible (pour réduire la consommation)
+				continue;
+			}
+
 			if (paddingX > 0 || paddingY > 0)
 			{
 				// On remplit les contours
@@ -264,4 +396,22 @@ namespace Nz
 
 		layer.queuedGlyphs.clear();
 	}
+
+	void GuillotineImageAtlas::ResetLayer(Layer& layer, const Vector2ui& size) const
+	{
+		switch (m_packing)
+		{
+			case AtlasPacking_Guillotine:
+				layer.binPack.Reset(size);
+				break;
+
+			case AtlasPacking_Shelf:
+				layer.shelfPack.Reset(size);
+				break;
+
+			case AtlasPacking_Skyline:
+				layer.skylinePack.Reset(size);
+				break;
+		}
+	}
 }
@@ -5,9 +5,17 @@
 #include <Nazara/Utility/Image.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/ErrorFlags.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Math/Algorithm.hpp>
 #include <Nazara/Utility/Config.hpp>
 #include <Nazara/Utility/PixelFormat.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstring>
 #include <memory>
+#include <vector>
 #include <Nazara/Utility/Debug.hpp>
 
 ///TODO: Rajouter des warnings (Formats compressés avec les méthodes Copy/Update, tests taille dans Copy)
@@ -18,6 +26,183 @@ namespace Nz
 {
 	namespace
 	{
+		constexpr std::size_t conversionGrainSize = 256 * 1024; //< Pixels converted by each task, smaller images are converted by the calling thread
+
+		// Faces are contiguous, a level is converted as a whole and split across the task scheduler if it is big enough
+		bool ConvertPixels(PixelFormatType srcFormat, PixelFormatType dstFormat, const UInt8* src, UInt8* dst, std::size_t pixelCount)
+		{
+			UInt8 srcBpp = PixelFormat::GetBytesPerPixel(srcFormat);
+			UInt8 dstBpp = PixelFormat::GetBytesPerPixel(dstFormat);
+
+			std::atomic_bool failed(false);
+			TaskScheduler::ParallelFor(0, pixelCount, conversionGrainSize, [&](std::size_t first, std::size_t last)
+			{
+				if (!PixelFormat::Convert(srcFormat, dstFormat, &src[first * srcBpp], &src[last * srcBpp], &dst[first * dstBpp]))
+					failed = true;
+			});
+
+			return !failed;
+		}
+
+		struct MipmapTap
+		{
+			int offset; //< Relative to the first source pixel of the destination pixel
+			float weight;
+		};
+
+		std::vector<MipmapTap> ComputeMipmapKernel(MipmapFilter filter)
+		{
+			std::vector<MipmapTap> kernel;
+			switch (filter)
+			{
+				case MipmapFilter_Box:
+					kernel.push_back({0, 0.5f});
+					kernel.push_back({1, 0.5f});
+					break;
+
+				case MipmapFilter_Kaiser:
+				{
+					// Kaiser-windowed sinc (width of three destination pixels, alpha of four), as a 2:1 polyphase filter
+					constexpr float alpha = 4.f;
+					constexpr int width = 3;
+
+					auto besselI0 = [](float x)
+					{
+						float sum = 1.f;
+						float term = 1.f;
+						for (int k = 1; k < 20; ++k)
+						{
+							term *= (x / (2.f * k)) * (x / (2.f * k));
+							sum += term;
+						}
+
+						return sum;
+					};
+
+					float weightSum = 0.f;
+					for (int offset = 1 - 2 * width; offset <= 2 * width; ++offset)
+					{
+						float x = (offset - 0.5f) / 2.f; //< Distance from the destination pixel center, in destination pixels
+						float sinc = (x == 0.f) ? 1.f : std::sin(float(M_PI) * x) / (float(M_PI) * x);
+						float window = besselI0(alpha * std::sqrt(std::max(1.f - (x / width) * (x / width), 0.f))) / besselI0(alpha);
+
+						kernel.push_back({offset, sinc * window});
+						weightSum += sinc * window;
+					}
+
+					for (MipmapTap& tap : kernel)
+						tap.weight /= weightSum;
+
+					break;
+				}
+			}
+
+			return kernel;
+		}
+
+		// Downsamples (or only truncates, for array layers) a [outer][size][inner] buffer along its middle dimension
+		void DownsampleAxis(const std::vector<float>& src, std::vector<float>& dst, std::size_t outerCount, unsigned int srcSize, unsigned int dstSize, std::size_t innerCount, bool filter, const std::vector<MipmapTap>& kernel)
+		{
+			dst.resize(outerCount * dstSize * innerCount);
+
+			std::size_t rowCount = outerCount * dstSize;
+			std::size_t grainSize = std::max<std::size_t>(conversionGrainSize / (innerCount * kernel.size()), 1);
+			TaskScheduler::ParallelFor(0, rowCount, grainSize, [&](std::size_t first, std::size_t last)
+			{
+				for (std::size_t row = first; row < last; ++row)
+				{
+					std::size_t outer = row / dstSize;
+					unsigned int i = static_cast<unsigned int>(row % dstSize);
+
+					const float* srcBase = &src[outer * srcSize * innerCount];
+					float* dstRow = &dst[row * innerCount];
+
+					if (!filter || srcSize == 1)
+					{
+						std::copy(&srcBase[i * innerCount], &srcBase[(i + 1) * innerCount], dstRow);
+						continue;
+					}
+
+					std::fill(dstRow, dstRow + innerCount, 0.f);
+					for (const MipmapTap& tap : kernel)
+					{
+						int index = Clamp(int(2 * i) + tap.offset, 0, int(srcSize) - 1);
+						const float* srcRow = &srcBase[index * innerCount];
+						for (std::size_t k = 0; k < innerCount; ++k)
+							dstRow[k] += tap.weight * srcRow[k];
+					}
+				}
+			});
+		}
+
+		float DecodeSRGB(float value)
+		{
+			return (value <= 0.04045f) ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+		}
+
+		float EncodeSRGB(float value)
+		{
+			return (value <= 0.0031308f) ? value * 12.92f : 1.055f * std::pow(value, 1.f / 2.4f) - 0.055f;
+		}
+
+		// Formats whose channels are all 8 bits unsigned integers or 32 bits floats, mipmaps generation doesn't handle the other ones
+		bool GetMipmapChannels(PixelFormatType format, unsigned int* channelCount, int* alphaChannel, bool* isFloat)
+		{
+			*alphaChannel = -1;
+			*isFloat = false;
+
+			switch (format)
+			{
+				case PixelFormatType_A8:
+					*alphaChannel = 0;
+				case PixelFormatType_L8:
+				case PixelFormatType_R8:
+					*channelCount = 1;
+					return true;
+
+				case PixelFormatType_LA8:
+					*alphaChannel = 1;
+				case PixelFormatType_RG8:
+					*channelCount = 2;
+					return true;
+
+				case PixelFormatType_BGR8:
+				case PixelFormatType_RGB8:
+					*channelCount = 3;
+					return true;
+
+				case PixelFormatType_BGRA8:
+				case PixelFormatType_RGBA8:
+					*alphaChannel = 3;
+					*channelCount = 4;
+					return true;
+
+				case PixelFormatType_R32F:
+					*channelCount = 1;
+					*isFloat = true;
+					return true;
+
+				case PixelFormatType_RG32F:
+					*channelCount = 2;
+					*isFloat = true;
+					return true;
+
+				case PixelFormatType_RGB32F:
+					*channelCount = 3;
+					*isFloat = true;
+					return true;
+
+				case PixelFormatType_RGBA32F:
+					*alphaChannel = 3;
+					*channelCount = 4;
+					*isFloat = true;
+					return true;
+
+				default:
+					return false;
+			}
+		}
+
 		inline unsigned int GetLevelSize(unsigned int size, UInt8 level)
 		{
 			if (size == 0) // Possible dans le cas d'une image invalide
@@ -30,6 +215,82 @@ namespace Nz
 		{
 			return &base[(width*(height*z + y) + x)*bpp];
 		}
+
+		bool CheckViewBox(const Image::SharedImage* image, const Boxui& box, UInt8 level)
+		{
+			if (image == &Image::emptyImage)
+			{
+				NazaraError("Image must be valid");
+				return false;
+			}
+
+			if (PixelFormat::IsCompressed(image->format))
+			{
+				NazaraError("Cannot get a view over a compressed image");
+				return false;
+			}
+
+			if (level >= image->levels.size())
+			{
+				NazaraError("Level out of bounds (" + String::Number(level) + " >= " + String::Number(image->levels.size()) + ')');
+				return false;
+			}
+
+			unsigned int width = GetLevelSize(image->width, level);
+			unsigned int height = GetLevelSize(image->height, level);
+			unsigned int depth = (image->type == ImageType_Cubemap) ? 6 : GetLevelSize(image->depth, level);
+			if (box.x + box.width > width || box.y + box.height > height || box.z + box.depth > depth)
+			{
+				NazaraError("Box dimensions are out of bounds");
+				return false;
+			}
+
+			return true;
+		}
+
+		Boxui GetLevelBox(const Image::SharedImage* image, UInt8 level)
+		{
+			unsigned int depth = (image->type == ImageType_Cubemap) ? 6 : GetLevelSize(image->depth, level);
+			return Boxui(0, 0, 0, GetLevelSize(image->width, level), GetLevelSize(image->height, level), depth);
+		}
+
+		// Decoding is usually what makes loading slow, every file is decoded by its own task
+		bool LoadImages(const String* filePaths, std::size_t fileCount, const ImageParams& params, std::vector<Image>& images)
+		{
+			images.resize(fileCount);
+			TaskScheduler::ParallelFor(0, fileCount, 1, [&](std::size_t first, std::size_t last)
+			{
+				for (std::size_t i = first; i < last; ++i)
+					images[i].LoadFromFile(filePaths[i], params);
+			});
+
+			for (std::size_t i = 0; i < fileCount; ++i)
+			{
+				if (!images[i].IsValid())
+				{
+					NazaraError("Failed to load image \"" + filePaths[i] + '"');
+					return false;
+				}
+
+				if (i > 0 && !images[i].Convert(images[0].GetFormat()))
+				{
+					NazaraError("Failed to convert image \"" + filePaths[i] + "\" to the format of the first one");
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		template<typename T>
+		ImageView<T> MakeView(const Image::SharedImage* image, T* levelPixels, const Boxui& box, UInt8 level)
+		{
+			unsigned int width = GetLevelSize(image->width, level);
+			unsigned int height = GetLevelSize(image->height, level);
+
+			ImageView<T> levelView(levelPixels, image->format, width, height, (image->type == ImageType_Cubemap) ? 6 : GetLevelSize(image->depth, level));
+			return ImageView<T>(levelView.GetPixels(box.x, box.y, box.z), image->format, box.width, box.height, box.depth, levelView.GetRowPitch(), levelView.GetSlicePitch());
+		}
 	}
 
 	bool ImageParams::IsValid() const
@@ -103,26 +364,56 @@ namespace Nz
 		// Les images 3D et cubemaps sont stockés de la même façon
 		unsigned int depth = (m_sharedImage->type == ImageType_Cubemap) ? 6 : m_sharedImage->depth;
 
+		PixelFormatType srcFormat = m_sharedImage->format;
 		for (unsigned int i = 0; i < levels.size(); ++i)
 		{
-			unsigned int pixelsPerFace = width * height;
-			levels[i].reset(new UInt8[pixelsPerFace * depth * PixelFormat::GetBytesPerPixel(newFormat)]);
+			levels[i].reset(new UInt8[PixelFormat::ComputeSize(newFormat, width, height, depth)]);
 
-			UInt8* dst = levels[i].get();
-			UInt8* src = m_sharedImage->levels[i].get();
-			unsigned int srcStride = pixelsPerFace * PixelFormat::GetBytesPerPixel(m_sharedImage->format);
-			unsigned int dstStride = pixelsPerFace * PixelFormat::GetBytesPerPixel(newFormat);
-
-			for (unsigned int d = 0; d < depth; ++d)
+			// Compressed formats go through RGBA8, the other ones are converted directly
+			std::unique_ptr<UInt8[]> decompressed;
+			PixelFormatType levelFormat = srcFormat;
+			const UInt8* src = m_sharedImage->levels[i].get();
+			if (PixelFormat::IsCompressed(levelFormat))
 			{
-				if (!PixelFormat::Convert(m_sharedImage->format, newFormat, src, &src[srcStride], dst))
+				decompressed.reset(new UInt8[PixelFormat::ComputeSize(PixelFormatType_RGBA8, width, height, depth)]);
+				if (!PixelFormat::Decompress(levelFormat, width, height, depth, src, decompressed.get()))
 				{
-					NazaraError("Failed to convert image");
+					NazaraError("Failed to decompress image");
 					return false;
 				}
 
-				src += srcStride;
-				dst += dstStride;
+				levelFormat = PixelFormatType_RGBA8;
+				src = decompressed.get();
+			}
+
+			std::size_t pixelCount = std::size_t(width) * height * depth;
+			if (PixelFormat::IsCompressed(newFormat))
+			{
+				std::unique_ptr<UInt8[]> uncompressed;
+				if (levelFormat != PixelFormatType_RGBA8)
+				{
+					uncompressed.reset(new UInt8[PixelFormat::ComputeSize(PixelFormatType_RGBA8, width, height, depth)]);
+					if (!ConvertPixels(levelFormat, PixelFormatType_RGBA8, src, uncompressed.get(), pixelCount))
+					{
+						NazaraError("Failed to convert image");
+						return false;
+					}
+
+					src = uncompressed.get();
+				}
+
+				if (!PixelFormat::Compress(newFormat, width, height, depth, src, levels[i].get()))
+				{
+					NazaraError("Failed to compress image");
+					return false;
+				}
+			}
+			else if (levelFormat == newFormat)
+				std::memcpy(levels[i].get(), src, PixelFormat::ComputeSize(newFormat, width, height, depth));
+			else if (!ConvertPixels(levelFormat, newFormat, src, levels[i].get(), pixelCount))
+			{
+				NazaraError("Failed to convert image");
+				return false;
 			}
 
 			if (width > 1)
@@ -165,19 +456,42 @@ namespace Nz
 		}
 		#endif
 
-		const UInt8* srcPtr = source.GetConstPixels(srcBox.x, srcBox.y, srcBox.z);
-		#if NAZARA_UTILITY_SAFE
-		if (!srcPtr)
+		if (PixelFormat::IsCompressed(m_sharedImage->format))
+		{
+			const UInt8* srcPtr = source.GetConstPixels(srcBox.x, srcBox.y, srcBox.z);
+			#if NAZARA_UTILITY_SAFE
+			if (!srcPtr)
+			{
+				NazaraError("Failed to access pixels");
+				return;
+			}
+			#endif
+
+			EnsureOwnership();
+
+			UInt8 bpp = PixelFormat::GetBytesPerPixel(m_sharedImage->format);
+			UInt8* dstPtr = GetPixelPtr(m_sharedImage->levels[0].get(), bpp, dstPos.x, dstPos.y, dstPos.z, m_sharedImage->width, m_sharedImage->height);
+
+			Copy(dstPtr, srcPtr, m_sharedImage->format, srcBox.width, srcBox.height, srcBox.depth, m_sharedImage->width, m_sharedImage->height, source.GetWidth(), source.GetHeight());
+			return;
+		}
+
+		// The destination is detached first, the source may share its pixels
+		ImageView<UInt8> dstView = GetView(Boxui(dstPos.x, dstPos.y, dstPos.z, srcBox.width, srcBox.height, srcBox.depth));
+		if (!dstView.IsValid())
 		{
-			NazaraError("Failed to access pixels");
+			NazaraError("Failed to access destination pixels");
 			return;
 		}
-		#endif
 
-		UInt8 bpp = PixelFormat::GetBytesPerPixel(m_sharedImage->format);
-		UInt8* dstPtr = GetPixelPtr(m_sharedImage->levels[0].get(), bpp, dstPos.x, dstPos.y, dstPos.z, m_sharedImage->width, m_sharedImage->height);
+		ImageView<const UInt8> srcView = source.GetConstView(srcBox);
+		if (!srcView.IsValid())
+		{
+			NazaraError("Failed to access source pixels");
+			return;
+		}
 
-		Copy(dstPtr, srcPtr, m_sharedImage->format, srcBox.width, srcBox.height, srcBox.depth, m_sharedImage->width, m_sharedImage->height, source.GetWidth(), source.GetHeight());
+		dstView.Copy(srcView);
 	}
 
 	bool Image::Create(ImageType type, PixelFormatType format, unsigned int width, unsigned int height, unsigned int depth, UInt8 levelCount)
@@ -579,6 +893,113 @@ namespace Nz
 		return true;
 	}
 
+	/*!
+	* \brief Generates every mipmap level of the image from its first level
+	* \return true if successful
+	*
+	* Each level is downsampled from the previous one, kept in floating-point to avoid accumulating rounding errors.
+	* Filters are separable and every pass is split across the TaskScheduler. Faces of cubemaps and layers of arrays are filtered independently.
+	*
+	* \param filter Filter used to downsample the levels
+	* \param sRGB Should the color channels be filtered in linear space (alpha is always linear), only affects 8 bits formats
+	*
+	* \remark Only formats with 8 bits unsigned or 32 bits floating-point channels are supported
+	*/
+	bool Image::GenerateMipmaps(MipmapFilter filter, bool sRGB)
+	{
+		#if NAZARA_UTILITY_SAFE
+		if (m_sharedImage == &emptyImage)
+		{
+			NazaraError("Image must be valid");
+			return false;
+		}
+
+		if (filter > MipmapFilter_Max)
+		{
+			NazaraError("Mipmap filter out of enum");
+			return false;
+		}
+		#endif
+
+		unsigned int channelCount;
+		int alphaChannel;
+		bool isFloat;
+		if (!GetMipmapChannels(m_sharedImage->format, &channelCount, &alphaChannel, &isFloat))
+		{
+			NazaraError("Mipmaps generation does not support " + PixelFormat::GetName(m_sharedImage->format) + " format");
+			return false;
+		}
+
+		SetLevelCount(GetMaxLevel());
+		EnsureOwnership();
+
+		ImageType type = m_sharedImage->type;
+		bool filterY = (type != ImageType_1D && type != ImageType_1D_Array);
+		bool filterZ = (type == ImageType_3D);
+		bool linearize = (sRGB && !isFloat);
+
+		std::array<float, 256> decodeTable;
+		for (unsigned int i = 0; i < decodeTable.size(); ++i)
+			decodeTable[i] = (linearize) ? DecodeSRGB(i / 255.f) : i / 255.f;
+
+		// Level 0 is decoded to floating-point once, each level is then computed from the previous one
+		unsigned int width = m_sharedImage->width;
+		unsigned int height = m_sharedImage->height;
+		unsigned int depth = (type == ImageType_Cubemap) ? 6 : m_sharedImage->depth;
+
+		std::size_t valueCount = std::size_t(width) * height * depth * channelCount;
+		std::vector<float> current(valueCount);
+		if (isFloat)
+			std::memcpy(current.data(), m_sharedImage->levels[0].get(), valueCount * sizeof(float));
+		else
+		{
+			const UInt8* pixels = m_sharedImage->levels[0].get();
+			for (std::size_t i = 0; i < valueCount; ++i)
+				current[i] = (int(i % channelCount) == alphaChannel) ? pixels[i] / 255.f : decodeTable[pixels[i]];
+		}
+
+		std::vector<MipmapTap> kernel = ComputeMipmapKernel(filter);
+		std::vector<float> temp;
+		std::vector<float> next;
+		for (UInt8 level = 1; level < m_sharedImage->levels.size(); ++level)
+		{
+			unsigned int levelWidth = GetLevelSize(m_sharedImage->width, level);
+			unsigned int levelHeight = GetLevelSize(m_sharedImage->height, level);
+			unsigned int levelDepth = (type == ImageType_Cubemap) ? 6 : GetLevelSize(m_sharedImage->depth, level);
+
+			// Layout is [z][y][x][channel], each axis is downsampled separately
+			DownsampleAxis(current, temp, std::size_t(height) * depth, width, levelWidth, channelCount, true, kernel);
+			DownsampleAxis(temp, next, depth, height, levelHeight, std::size_t(levelWidth) * channelCount, filterY, kernel);
+			DownsampleAxis(next, temp, 1, depth, levelDepth, std::size_t(levelWidth) * levelHeight * channelCount, filterZ, kernel);
+			std::swap(current, temp);
+
+			width = levelWidth;
+			height = levelHeight;
+			depth = levelDepth;
+
+			valueCount = current.size();
+			if (isFloat)
+				std::memcpy(m_sharedImage->levels[level].get(), current.data(), valueCount * sizeof(float));
+			else
+			{
+				UInt8* pixels = m_sharedImage->levels[level].get();
+				TaskScheduler::ParallelFor(0, valueCount, conversionGrainSize, [&](std::size_t first, std::size_t last)
+				{
+					for (std::size_t i = first; i < last; ++i)
+					{
+						float value = Clamp(current[i], 0.f, 1.f);
+						if (linearize && int(i % channelCount) != alphaChannel)
+							value = EncodeSRGB(value);
+
+						pixels[i] = static_cast<UInt8>(value * 255.f + 0.5f);
+					}
+				});
+			}
+		}
+
+		return true;
+	}
+
 	const UInt8* Image::GetConstPixels(unsigned int x, unsigned int y, unsigned int z, UInt8 level) const
 	{
 		#if NAZARA_UTILITY_SAFE
@@ -623,6 +1044,39 @@ namespace Nz
 		return GetPixelPtr(m_sharedImage->levels[level].get(), PixelFormat::GetBytesPerPixel(m_sharedImage->format), x, y, z, width, height);
 	}
 
+	/*!
+	* \brief Gets a read-only view over a whole level of the image
+	* \return View over the pixels of the level, or an invalid view if the image is invalid or compressed
+	*
+	* \param level Mipmap level
+	*
+	* \remark The view is invalidated by any modification of the image
+	*/
+	ImageView<const UInt8> Image::GetConstView(UInt8 level) const
+	{
+		if (m_sharedImage == &emptyImage || level >= m_sharedImage->levels.size())
+			return GetConstView(Boxui(0, 0, 0, 0, 0, 0), level); // Reports the error
+
+		return GetConstView(GetLevelBox(m_sharedImage, level), level);
+	}
+
+	/*!
+	* \brief Gets a read-only view over a box of the image
+	* \return View over the pixels of the box, or an invalid view if the image is invalid or compressed
+	*
+	* \param box Box of the pixels, which must fit in the level
+	* \param level Mipmap level
+	*
+	* \remark The view is invalidated by any modification of the image
+	*/
+	ImageView<const UInt8> Image::GetConstView(const Boxui& box, UInt8 level) const
+	{
+		if (!CheckViewBox(m_sharedImage, box, level))
+			return ImageView<const UInt8>();
+
+		return MakeView<const UInt8>(m_sharedImage, m_sharedImage->levels[level].get(), box, level);
+	}
+
 	unsigned int Image::GetDepth(UInt8 level) const
 	{
 		#if NAZARA_UTILITY_SAFE
@@ -810,6 +1264,43 @@ namespace Nz
 		return m_sharedImage->type;
 	}
 
+	/*!
+	* \brief Gets a writable view over a whole level of the image
+	* \return View over the pixels of the level, or an invalid view if the image is invalid or compressed
+	*
+	* The pixels are detached from other images sharing them once, writing through the view then costs no further check.
+	*
+	* \param level Mipmap level
+	*
+	* \remark The view is invalidated by any modification of the image, and copies of the image made while the view is in use will share its pixels
+	*/
+	ImageView<UInt8> Image::GetView(UInt8 level)
+	{
+		if (m_sharedImage == &emptyImage || level >= m_sharedImage->levels.size())
+			return GetView(Boxui(0, 0, 0, 0, 0, 0), level); // Reports the error
+
+		return GetView(GetLevelBox(m_sharedImage, level), level);
+	}
+
+	/*!
+	* \brief Gets a writable view over a box of the image
+	* \return View over the pixels of the box, or an invalid view if the image is invalid or compressed
+	*
+	* \param box Box of the pixels, which must fit in the level
+	* \param level Mipmap level
+	*
+	* \see GetView
+	*/
+	ImageView<UInt8> Image::GetView(const Boxui& box, UInt8 level)
+	{
+		if (!CheckViewBox(m_sharedImage, box, level))
+			return ImageView<UInt8>();
+
+		EnsureOwnership();
+
+		return MakeView<UInt8>(m_sharedImage, m_sharedImage->levels[level].get(), box, level);
+	}
+
 	unsigned int Image::GetWidth(UInt8 level) const
 	{
 		#if NAZARA_UTILITY_SAFE
@@ -893,6 +1384,57 @@ namespace Nz
 		return LoadArrayFromImage(image, atlasSize);
 	}
 
+	/*!
+	* \brief Loads an array image from one file per layer
+	* \return true if loaded successfully
+	*
+	* \param filePaths Path of the file of each layer
+	* \param fileCount Number of files, and thus of layers
+	* \param imageParams Parameters used to load each file
+	*
+	* \remark Files are decoded in parallel using the TaskScheduler
+	* \remark Every file must have the same size, they are converted to the format of the first one
+	*/
+	bool Image::LoadArrayFromFiles(const String* filePaths, std::size_t fileCount, const ImageParams& imageParams)
+	{
+		NazaraAssert(filePaths && fileCount > 0, "Invalid file paths");
+
+		std::vector<Image> images;
+		if (!LoadImages(filePaths, fileCount, imageParams, images))
+			return false;
+
+		const Image& firstImage = images.front();
+
+		ImageType type = firstImage.GetType();
+		if (type != ImageType_1D && type != ImageType_2D)
+		{
+			NazaraError("Image type not handled (0x" + String::Number(type, 16) + ')');
+			return false;
+		}
+
+		unsigned int width = firstImage.GetWidth();
+		unsigned int height = firstImage.GetHeight();
+		for (const Image& image : images)
+		{
+			if (image.GetType() != type || image.GetWidth() != width || image.GetHeight() != height)
+			{
+				NazaraError("All layers must have the same type and size");
+				return false;
+			}
+		}
+
+		unsigned int layerCount = static_cast<unsigned int>(fileCount);
+		if (type == ImageType_2D)
+			Create(ImageType_2D_Array, firstImage.GetFormat(), width, height, layerCount);
+		else
+			Create(ImageType_1D_Array, firstImage.GetFormat(), width, layerCount);
+
+		for (unsigned int layer = 0; layer < layerCount; ++layer)
+			Copy(images[layer], Rectui(0, 0, width, height), Vector3ui(0, 0, layer));
+
+		return true;
+	}
+
 	bool Image::LoadArrayFromImage(const Image& image, const Vector2ui& atlasSize)
 	{
 		#if NAZARA_UTILITY_SAFE
@@ -991,6 +1533,40 @@ namespace Nz
 		return LoadCubemapFromImage(image, cubemapParams);
 	}
 
+	/*!
+	* \brief Loads a cubemap from one file per face
+	* \return true if loaded successfully
+	*
+	* \param filePaths Path of the file of each face, indexed by CubemapFace
+	* \param imageParams Parameters used to load each file
+	*
+	* \remark Files are decoded in parallel using the TaskScheduler
+	* \remark Every face must be a square of the same size, they are converted to the format of the first one
+	*/
+	bool Image::LoadCubemapFromFiles(const std::array<String, CubemapFace_Max + 1>& filePaths, const ImageParams& imageParams)
+	{
+		std::vector<Image> images;
+		if (!LoadImages(filePaths.data(), filePaths.size(), imageParams, images))
+			return false;
+
+		unsigned int faceSize = images.front().GetWidth();
+		for (const Image& image : images)
+		{
+			if (image.GetType() != ImageType_2D || image.GetWidth() != faceSize || image.GetHeight() != faceSize)
+			{
+				NazaraError("All faces must be squares of the same size");
+				return false;
+			}
+		}
+
+		Create(ImageType_Cubemap, images.front().GetFormat(), faceSize, faceSize);
+
+		for (std::size_t face = 0; face < images.size(); ++face)
+			Copy(images[face], Rectui(0, 0, faceSize, faceSize), Vector3ui(0, 0, static_cast<unsigned int>(face)));
+
+		return true;
+	}
+
 	bool Image::LoadCubemapFromImage(const Image& image, const CubemapParams& params)
 	{
 		#if NAZARA_UTILITY_SAFE
@@ -1466,6 +2042,45 @@ namespace Nz
 
 	}
 
+	/*!
+	* \brief Loads an image from a file without blocking, the file is decoded by the TaskScheduler workers
+	* \return Future of the image
+	*
+	* \param filePath Path to the file
+	* \param params Parameters for the image
+	*/
+	ResourceFuture<Image> Image::LoadAsync(const String& filePath, const ImageParams& params)
+	{
+		return ImageLoader::LoadAsync(filePath, params);
+	}
+
+	/*!
+	* \brief Reloads an image from a file without blocking
+	* \return Future of the image, ready once its content was replaced
+	*
+	* The file is loaded in the background into another image, the image is only updated once the loading succeeded (by ResourceFinalizationQueue::Process).
+	*
+	* \param image Image to reload
+	* \param filePath Path to the file
+	* \param params Parameters for the load
+	*
+	* \see ImageManager::Reload
+	*/
+	ResourceFuture<Image> Image::ReloadAsync(const ImageRef& image, const String& filePath, const ImageParams& params)
+	{
+		ImageRef reloadedImage = Image::New();
+
+		return ResourceFuture<Image>::Start(image, [filePath, params, reloadedImage](Image& /*image*/)
+		{
+			return reloadedImage->LoadFromFile(filePath, params);
+		},
+		[reloadedImage](Image& image)
+		{
+			image = *reloadedImage;
+			return true;
+		});
+	}
+
 	void Image::EnsureOwnership()
 	{
 		if (m_sharedImage == &emptyImage)
@@ -73,7 +73,11 @@ namespace Nz
 		NazaraAssert(m_buffer && m_buffer->IsValid(), "Invalid buffer");
 		NazaraAssert(m_startOffset + offset + size <= m_endOffset, "Exceeding virtual buffer size");
 
-		return m_buffer->Map(access, offset, size);
+		// Zero size maps up to the end of this buffer, which may only be a part of the underlying one
+		if (size == 0)
+			size = m_endOffset - m_startOffset - offset;
+
+		return m_buffer->Map(access, m_startOffset + offset, size);
 	}
 
 	void* IndexBuffer::MapRaw(BufferAccess access, UInt32 offset, UInt32 size) const
@@ -81,7 +85,11 @@ namespace Nz
 		NazaraAssert(m_buffer && m_buffer->IsValid(), "Invalid buffer");
 		NazaraAssert(m_startOffset + offset + size <= m_endOffset, "Exceeding virtual buffer size");
 
-		return m_buffer->Map(access, offset, size);
+		// Zero size maps up to the end of this buffer, which may only be a part of the underlying one
+		if (size == 0)
+			size = m_endOffset - m_startOffset - offset;
+
+		return m_buffer->Map(access, m_startOffset + offset, size);
 	}
 
 	void IndexBuffer::Optimize()
@@ -77,6 +77,16 @@ namespace Nz
 		m_skinningMatrixUpdated = false;
 	}
 
+	void Joint::SetPose(const Vector3f& position, const Quaternionf& rotation, const Vector3f& scale)
+	{
+		// Poses come from animations, their rotations are already normalized
+		m_position = position;
+		m_rotation = rotation;
+		m_scale = scale;
+
+		InvalidateNode();
+	}
+
 	void Joint::UpdateSkinningMatrix() const
 	{
 		if (!m_transformMatrixUpdated)
@@ -8,8 +8,10 @@
 #include <Nazara/Core/PrimitiveList.hpp>
 #include <Nazara/Utility/Algorithm.hpp>
 #include <Nazara/Utility/Buffer.hpp>
+#include <Nazara/Utility/BufferAllocator.hpp>
 #include <Nazara/Utility/Config.hpp>
 #include <Nazara/Utility/IndexMapper.hpp>
+#include <Nazara/Utility/SkeletalMesh.hpp>
 #include <Nazara/Utility/Skeleton.hpp>
 #include <Nazara/Utility/StaticMesh.hpp>
 #include <Nazara/Utility/SubMesh.hpp>
@@ -53,6 +55,12 @@ namespace Nz
 			return false;
 		}
 
+		if (compressedVertexDeclaration && !compressedVertexDeclaration->HasComponentOfType<Vector3f>(VertexComponent_Position))
+		{
+			NazaraError("Compressed vertex declaration must contains a Vector3f vertex position");
+			return false;
+		}
+
 		return true;
 	}
 
@@ -273,8 +281,16 @@ namespace Nz
 			return nullptr;
 		}
 
-		if (params.optimizeIndexBuffers)
-			indexBuffer->Optimize();
+		OptimizeMesh(vertexBuffer, indexBuffer, params);
+
+		if (params.compressedVertexDeclaration)
+			ConvertVertices(vertexBuffer, params.compressedVertexDeclaration);
+
+		if (params.bufferAllocator)
+		{
+			params.bufferAllocator->Relocate(indexBuffer);
+			params.bufferAllocator->Relocate(vertexBuffer);
+		}
 
 		subMesh->SetAABB(aabb);
 		subMesh->SetIndexBuffer(indexBuffer);
@@ -689,6 +705,55 @@ namespace Nz
 		InvalidateAABB();
 	}
 
+	/*!
+	* \brief Loads a mesh from a file without blocking
+	* \return Future of the mesh
+	*
+	* The file is parsed by the TaskScheduler workers into software buffers, which are moved to the requested storage by ResourceFinalizationQueue::Process.
+	*
+	* \param filePath Path to the file
+	* \param params Parameters for the mesh
+	*/
+	ResourceFuture<Mesh> Mesh::LoadAsync(const String& filePath, const MeshParams& params)
+	{
+		// Hardware buffers can't be created by workers
+		MeshParams loadParams = params;
+		loadParams.storage = DataStorage_Software;
+
+		if (params.storage == DataStorage_Software)
+			return MeshLoader::LoadAsync(filePath, loadParams);
+
+		DataStorage storage = params.storage;
+		return MeshLoader::LoadAsync(filePath, loadParams, [storage](Mesh& mesh)
+		{
+			for (UInt32 i = 0; i < mesh.GetSubMeshCount(); ++i)
+			{
+				SubMesh* subMesh = mesh.GetSubMesh(i);
+
+				const VertexBuffer* vertexBuffer;
+				if (subMesh->GetAnimationType() == AnimationType_Skeletal)
+					vertexBuffer = static_cast<SkeletalMesh*>(subMesh)->GetVertexBuffer();
+				else
+					vertexBuffer = static_cast<StaticMesh*>(subMesh)->GetVertexBuffer();
+
+				if (!vertexBuffer->GetBuffer()->SetStorage(storage))
+				{
+					NazaraError("Failed to set vertex buffer storage");
+					return false;
+				}
+
+				const IndexBuffer* indexBuffer = subMesh->GetIndexBuffer();
+				if (indexBuffer && !indexBuffer->GetBuffer()->SetStorage(storage))
+				{
+					NazaraError("Failed to set index buffer storage");
+					return false;
+				}
+			}
+
+			return true;
+		});
+	}
+
 	bool Mesh::Initialize()
 	{
 		if (!MeshLibrary::Initialize())
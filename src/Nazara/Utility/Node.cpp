@@ -651,6 +651,12 @@ namespace Nz
 
 	void Node::InvalidateNode()
 	{
+		// A node whose derived data and transform matrix are both outdated has not been read since its last invalidation:
+		// its childs are still invalidated (updating a child updates its parent first) and its listeners got notified already,
+		// successive changes in the same frame therefore only have to walk the hierarchy and trigger signals once
+		if (!m_derivedUpdated && !m_transformMatrixUpdated)
+			return;
+
 		m_derivedUpdated = false;
 		m_transformMatrixUpdated = false;
 
@@ -5,6 +5,22 @@
 #include <Nazara/Utility/PixelFormat.hpp>
 #include <Nazara/Core/Endianness.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/HardwareInfo.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Math/Algorithm.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+#if defined(NAZARA_SIMD_SSE2)
+	#include <emmintrin.h>
+	#include <tmmintrin.h>
+#elif defined(NAZARA_SIMD_NEON)
+	#include <arm_neon.h>
+#endif
+
 #include <Nazara/Utility/Debug.hpp>
 
 namespace Nz
@@ -1261,6 +1277,540 @@ namespace Nz
 			return dst;
 		}
 
+#if defined(NAZARA_SIMD_SSE2)
+		/**********************************SSE2***********************************/
+		// SSE2 is enabled at compile time, every kernel converts as many pixels as it can and leaves the rest to the scalar converter
+
+		template<PixelFormatType from, PixelFormatType to>
+		UInt8* ConvertPixelsSwapRedBlueSSE2(const UInt8* start, const UInt8* end, UInt8* dst)
+		{
+			// RGBA8 <-> BGRA8, the green and alpha channels stay where they are while red and blue switch places in each 32-bits pixel
+			const __m128i greenAlphaMask = _mm_set1_epi32(0xFF00FF00);
+
+			while (end - start >= 16)
+			{
+				__m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(start));
+				__m128i redBlue = _mm_andnot_si128(greenAlphaMask, pixels);
+				__m128i swapped = _mm_or_si128(_mm_slli_epi32(redBlue, 16), _mm_srli_epi32(redBlue, 16));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_or_si128(_mm_and_si128(pixels, greenAlphaMask), swapped));
+
+				start += 16;
+				dst += 16;
+			}
+
+			return ConvertPixels<from, to>(start, end, dst);
+		}
+
+		template<PixelFormatType from, PixelFormatType to>
+		UInt8* ConvertPixelsExpandLuminanceSSE2(const UInt8* start, const UInt8* end, UInt8* dst)
+		{
+			// L8 -> RGBA8/BGRA8, sixteen pixels at once
+			const __m128i opaque = _mm_set1_epi8(static_cast<char>(0xFF));
+
+			while (end - start >= 16)
+			{
+				__m128i luminance = _mm_loadu_si128(reinterpret_cast<const __m128i*>(start));
+
+				__m128i doubledLow = _mm_unpacklo_epi8(luminance, luminance); //< LL LL LL ...
+				__m128i opaqueLow = _mm_unpacklo_epi8(luminance, opaque);     //< LA LA LA ...
+				__m128i doubledHigh = _mm_unpackhi_epi8(luminance, luminance);
+				__m128i opaqueHigh = _mm_unpackhi_epi8(luminance, opaque);
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst +  0), _mm_unpacklo_epi16(doubledLow, opaqueLow)); //< LLLA LLLA ...
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 16), _mm_unpackhi_epi16(doubledLow, opaqueLow));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 32), _mm_unpacklo_epi16(doubledHigh, opaqueHigh));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 48), _mm_unpackhi_epi16(doubledHigh, opaqueHigh));
+
+				start += 16;
+				dst += 64;
+			}
+
+			return ConvertPixels<from, to>(start, end, dst);
+		}
+
+		/**********************************SSSE3**********************************/
+		// SSSE3 is not part of the x64 baseline, these kernels are compiled for it and only registered if the processor supports it
+
+		#if defined(NAZARA_COMPILER_MSVC)
+			#define NAZARA_PIXELFORMAT_SSSE3
+		#else
+			#define NAZARA_PIXELFORMAT_SSSE3 __attribute__((target("ssse3")))
+		#endif
+
+		template<PixelFormatType from, PixelFormatType to, bool swapRedBlue>
+		NAZARA_PIXELFORMAT_SSSE3 UInt8* ConvertPixelsAddAlphaSSSE3(const UInt8* start, const UInt8* end, UInt8* dst)
+		{
+			// RGB8/BGR8 -> RGBA8/BGRA8, sixteen pixels (three registers) at once
+			const __m128i shuffle = (swapRedBlue) ? _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10,  9, -1) :
+			                                        _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1,  9, 10, 11, -1);
+			const __m128i opaque = _mm_set1_epi32(0xFF000000);
+
+			while (end - start >= 48)
+			{
+				__m128i input0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(start +  0));
+				__m128i input1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(start + 16));
+				__m128i input2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(start + 32));
+
+				// Bring each group of 12 bytes (4 pixels) at the beginning of a register
+				__m128i pixels0 = input0;
+				__m128i pixels1 = _mm_alignr_epi8(input1, input0, 12);
+				__m128i pixels2 = _mm_alignr_epi8(input2, input1, 8);
+				__m128i pixels3 = _mm_srli_si128(input2, 4);
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst +  0), _mm_or_si128(_mm_shuffle_epi8(pixels0, shuffle), opaque));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 16), _mm_or_si128(_mm_shuffle_epi8(pixels1, shuffle), opaque));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 32), _mm_or_si128(_mm_shuffle_epi8(pixels2, shuffle), opaque));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 48), _mm_or_si128(_mm_shuffle_epi8(pixels3, shuffle), opaque));
+
+				start += 48;
+				dst += 64;
+			}
+
+			return ConvertPixels<from, to>(start, end, dst);
+		}
+
+		template<PixelFormatType from, PixelFormatType to, bool swapRedBlue>
+		NAZARA_PIXELFORMAT_SSSE3 UInt8* ConvertPixelsRemoveAlphaSSSE3(const UInt8* start, const UInt8* end, UInt8* dst)
+		{
+			// RGBA8/BGRA8 -> RGB8/BGR8, sixteen pixels (four registers) at once
+			const __m128i shuffle = (swapRedBlue) ? _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1) :
+			                                        _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+
+			while (end - start >= 64)
+			{
+				// Each register holds 12 bytes (4 pixels) followed by zeros
+				__m128i pixels0 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(start +  0)), shuffle);
+				__m128i pixels1 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(start + 16)), shuffle);
+				__m128i pixels2 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(start + 32)), shuffle);
+				__m128i pixels3 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(start + 48)), shuffle);
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst +  0), _mm_or_si128(pixels0, _mm_slli_si128(pixels1, 12)));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 16), _mm_or_si128(_mm_srli_si128(pixels1, 4), _mm_slli_si128(pixels2, 8)));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 32), _mm_or_si128(_mm_srli_si128(pixels2, 8), _mm_slli_si128(pixels3, 4)));
+
+				start += 64;
+				dst += 48;
+			}
+
+			return ConvertPixels<from, to>(start, end, dst);
+		}
+
+		#undef NAZARA_PIXELFORMAT_SSSE3
+#elif defined(NAZARA_SIMD_NEON)
+		/**********************************NEON***********************************/
+		// NEON interleaved loads and stores (de)interleave the channels by themselves, sixteen pixels at once
+
+		template<PixelFormatType from, PixelFormatType to>
+		UInt8* ConvertPixelsSwapRedBlueNEON(const UInt8* start, const UInt8* end, UInt8* dst)
+		{
+			while (end - start >= 64)
+			{
+				uint8x16x4_t pixels = vld4q_u8(start);
+				std::swap(pixels.val[0], pixels.val[2]);
+				vst4q_u8(dst, pixels);
+
+				start += 64;
+				dst += 64;
+			}
+
+			return ConvertPixels<from, to>(start, end, dst);
+		}
+
+		template<PixelFormatType from, PixelFormatType to>
+		UInt8* ConvertPixelsExpandLuminanceNEON(const UInt8* start, const UInt8* end, UInt8* dst)
+		{
+			while (end - start >= 16)
+			{
+				uint8x16x4_t pixels;
+				pixels.val[0] = vld1q_u8(start);
+				pixels.val[1] = pixels.val[0];
+				pixels.val[2] = pixels.val[0];
+				pixels.val[3] = vdupq_n_u8(0xFF);
+				vst4q_u8(dst, pixels);
+
+				start += 16;
+				dst += 64;
+			}
+
+			return ConvertPixels<from, to>(start, end, dst);
+		}
+
+		template<PixelFormatType from, PixelFormatType to, bool swapRedBlue>
+		UInt8* ConvertPixelsAddAlphaNEON(const UInt8* start, const UInt8* end, UInt8* dst)
+		{
+			while (end - start >= 48)
+			{
+				uint8x16x3_t input = vld3q_u8(start);
+
+				uint8x16x4_t pixels;
+				pixels.val[0] = input.val[(swapRedBlue) ? 2 : 0];
+				pixels.val[1] = input.val[1];
+				pixels.val[2] = input.val[(swapRedBlue) ? 0 : 2];
+				pixels.val[3] = vdupq_n_u8(0xFF);
+				vst4q_u8(dst, pixels);
+
+				start += 48;
+				dst += 64;
+			}
+
+			return ConvertPixels<from, to>(start, end, dst);
+		}
+
+		template<PixelFormatType from, PixelFormatType to, bool swapRedBlue>
+		UInt8* ConvertPixelsRemoveAlphaNEON(const UInt8* start, const UInt8* end, UInt8* dst)
+		{
+			while (end - start >= 64)
+			{
+				uint8x16x4_t input = vld4q_u8(start);
+
+				uint8x16x3_t pixels;
+				pixels.val[0] = input.val[(swapRedBlue) ? 2 : 0];
+				pixels.val[1] = input.val[1];
+				pixels.val[2] = input.val[(swapRedBlue) ? 0 : 2];
+				vst3q_u8(dst, pixels);
+
+				start += 64;
+				dst += 48;
+			}
+
+			return ConvertPixels<from, to>(start, end, dst);
+		}
+#endif
+
+		/**********************************BCn************************************/
+		// DXT1 (BC1), DXT3 (BC2) and DXT5 (BC3) store every block of 4x4 pixels in 8 or 16 bytes, independently of the others
+
+		constexpr std::size_t blockGrainSize = 1024; //< Blocks (de)compressed by each task
+
+		using BlockPixels = UInt8[16][4]; //< RGBA8 pixels of a block, row by row
+
+		inline UInt16 ReadUInt16(const UInt8* ptr)
+		{
+			return static_cast<UInt16>(ptr[0] | (ptr[1] << 8));
+		}
+
+		inline void WriteUInt16(UInt8* ptr, UInt16 value)
+		{
+			ptr[0] = static_cast<UInt8>(value & 0xFF);
+			ptr[1] = static_cast<UInt8>(value >> 8);
+		}
+
+		inline void Expand565(UInt16 color, UInt8* rgba)
+		{
+			UInt8 r = (color >> 11) & 0x1F;
+			UInt8 g = (color >> 5) & 0x3F;
+			UInt8 b = color & 0x1F;
+
+			rgba[0] = static_cast<UInt8>((r << 3) | (r >> 2));
+			rgba[1] = static_cast<UInt8>((g << 2) | (g >> 4));
+			rgba[2] = static_cast<UInt8>((b << 3) | (b >> 2));
+			rgba[3] = 0xFF;
+		}
+
+		inline UInt16 Pack565(const float* rgb)
+		{
+			auto quantize = [](float value, int maxValue)
+			{
+				return static_cast<int>(Clamp(value, 0.f, 255.f) * maxValue / 255.f + 0.5f);
+			};
+
+			return static_cast<UInt16>((quantize(rgb[0], 31) << 11) | (quantize(rgb[1], 63) << 5) | quantize(rgb[2], 31));
+		}
+
+		// Without transparency (DXT3/DXT5) the four colors mode is always used, whatever the order of the endpoints
+		void ComputeColorPalette(UInt16 color0, UInt16 color1, bool allowTransparency, UInt8 palette[4][4])
+		{
+			Expand565(color0, palette[0]);
+			Expand565(color1, palette[1]);
+
+			if (color0 > color1 || !allowTransparency)
+			{
+				for (unsigned int c = 0; c < 3; ++c)
+				{
+					palette[2][c] = static_cast<UInt8>((2 * palette[0][c] + palette[1][c]) / 3);
+					palette[3][c] = static_cast<UInt8>((palette[0][c] + 2 * palette[1][c]) / 3);
+				}
+
+				palette[2][3] = 0xFF;
+				palette[3][3] = 0xFF;
+			}
+			else
+			{
+				for (unsigned int c = 0; c < 3; ++c)
+				{
+					palette[2][c] = static_cast<UInt8>((palette[0][c] + palette[1][c]) / 2);
+					palette[3][c] = 0;
+				}
+
+				palette[2][3] = 0xFF;
+				palette[3][3] = 0;
+			}
+		}
+
+		void ComputeAlphaPalette(UInt8 alpha0, UInt8 alpha1, UInt8 palette[8])
+		{
+			palette[0] = alpha0;
+			palette[1] = alpha1;
+
+			if (alpha0 > alpha1)
+			{
+				for (unsigned int i = 2; i < 8; ++i)
+					palette[i] = static_cast<UInt8>(((8 - i) * alpha0 + (i - 1) * alpha1) / 7);
+			}
+			else
+			{
+				for (unsigned int i = 2; i < 6; ++i)
+					palette[i] = static_cast<UInt8>(((6 - i) * alpha0 + (i - 1) * alpha1) / 5);
+
+				palette[6] = 0;
+				palette[7] = 0xFF;
+			}
+		}
+
+		void DecodeColorBlock(const UInt8* block, bool allowTransparency, BlockPixels& pixels)
+		{
+			UInt8 palette[4][4];
+			ComputeColorPalette(ReadUInt16(&block[0]), ReadUInt16(&block[2]), allowTransparency, palette);
+
+			UInt32 indices = block[4] | (block[5] << 8) | (block[6] << 16) | (UInt32(block[7]) << 24);
+			for (unsigned int i = 0; i < 16; ++i)
+				std::memcpy(pixels[i], palette[(indices >> (2 * i)) & 0x3], 4);
+		}
+
+		void DecodeExplicitAlphaBlock(const UInt8* block, BlockPixels& pixels)
+		{
+			for (unsigned int i = 0; i < 16; ++i)
+				pixels[i][3] = static_cast<UInt8>(((block[i / 2] >> ((i % 2) * 4)) & 0xF) * 17);
+		}
+
+		void DecodeInterpolatedAlphaBlock(const UInt8* block, BlockPixels& pixels)
+		{
+			UInt8 palette[8];
+			ComputeAlphaPalette(block[0], block[1], palette);
+
+			UInt64 indices = 0;
+			for (unsigned int i = 0; i < 6; ++i)
+				indices |= UInt64(block[2 + i]) << (8 * i);
+
+			for (unsigned int i = 0; i < 16; ++i)
+				pixels[i][3] = palette[(indices >> (3 * i)) & 0x7];
+		}
+
+		void EncodeColorBlock(const BlockPixels& pixels, bool allowTransparency, UInt8* block)
+		{
+			// With DXT1, transparent pixels use the fourth color of the three colors mode and take no part in the choice of the endpoints
+			bool transparent[16];
+			unsigned int opaqueCount = 0;
+			float mean[3] = {0.f, 0.f, 0.f};
+			for (unsigned int i = 0; i < 16; ++i)
+			{
+				transparent[i] = (allowTransparency && pixels[i][3] < 128);
+				if (transparent[i])
+					continue;
+
+				for (unsigned int c = 0; c < 3; ++c)
+					mean[c] += pixels[i][c];
+
+				opaqueCount++;
+			}
+
+			if (opaqueCount == 0)
+			{
+				WriteUInt16(&block[0], 0);
+				WriteUInt16(&block[2], 0);
+				std::memset(&block[4], 0xFF, 4);
+				return;
+			}
+
+			for (float& value : mean)
+				value /= opaqueCount;
+
+			// Colors are fitted on the principal axis of the block (found by power iteration on the covariance matrix)
+			float covariance[6] = {0.f, 0.f, 0.f, 0.f, 0.f, 0.f}; //< rr, rg, rb, gg, gb, bb
+			for (unsigned int i = 0; i < 16; ++i)
+			{
+				if (transparent[i])
+					continue;
+
+				float r = pixels[i][0] - mean[0];
+				float g = pixels[i][1] - mean[1];
+				float b = pixels[i][2] - mean[2];
+
+				covariance[0] += r * r;
+				covariance[1] += r * g;
+				covariance[2] += r * b;
+				covariance[3] += g * g;
+				covariance[4] += g * b;
+				covariance[5] += b * b;
+			}
+
+			float axis[3] = {1.f, 1.f, 1.f};
+			for (unsigned int iteration = 0; iteration < 8; ++iteration)
+			{
+				float r = axis[0] * covariance[0] + axis[1] * covariance[1] + axis[2] * covariance[2];
+				float g = axis[0] * covariance[1] + axis[1] * covariance[3] + axis[2] * covariance[4];
+				float b = axis[0] * covariance[2] + axis[1] * covariance[4] + axis[2] * covariance[5];
+
+				float length = std::max(std::max(std::abs(r), std::abs(g)), std::abs(b));
+				if (length < 1e-6f)
+					break; //< Every pixel has the same color, any axis works
+
+				axis[0] = r / length;
+				axis[1] = g / length;
+				axis[2] = b / length;
+			}
+
+			float axisLength = std::sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+			for (float& value : axis)
+				value /= axisLength;
+
+			float minProjection = std::numeric_limits<float>::max();
+			float maxProjection = std::numeric_limits<float>::lowest();
+			for (unsigned int i = 0; i < 16; ++i)
+			{
+				if (transparent[i])
+					continue;
+
+				float projection = (pixels[i][0] - mean[0]) * axis[0] + (pixels[i][1] - mean[1]) * axis[1] + (pixels[i][2] - mean[2]) * axis[2];
+				minProjection = std::min(minProjection, projection);
+				maxProjection = std::max(maxProjection, projection);
+			}
+
+			// Moving the endpoints slightly inside the range lowers the average error of the interpolated colors
+			float inset = (maxProjection - minProjection) / 16.f;
+			minProjection += inset;
+			maxProjection -= inset;
+
+			float minColor[3];
+			float maxColor[3];
+			for (unsigned int c = 0; c < 3; ++c)
+			{
+				minColor[c] = mean[c] + axis[c] * minProjection;
+				maxColor[c] = mean[c] + axis[c] * maxProjection;
+			}
+
+			UInt16 color0 = Pack565(maxColor);
+			UInt16 color1 = Pack565(minColor);
+
+			// The order of the endpoints selects the mode: four colors if color0 > color1, three colors and transparency otherwise (DXT1 only)
+			bool hasTransparency = (opaqueCount < 16);
+			if (hasTransparency == (color0 > color1))
+				std::swap(color0, color1);
+
+			UInt8 palette[4][4];
+			ComputeColorPalette(color0, color1, allowTransparency, palette);
+
+			unsigned int colorCount = (allowTransparency && color0 <= color1) ? 3 : 4;
+
+			UInt32 indices = 0;
+			for (unsigned int i = 0; i < 16; ++i)
+			{
+				UInt32 index = 3;
+				if (!transparent[i])
+				{
+					int bestDistance = std::numeric_limits<int>::max();
+					for (unsigned int j = 0; j < colorCount; ++j)
+					{
+						int distance = 0;
+						for (unsigned int c = 0; c < 3; ++c)
+						{
+							int difference = pixels[i][c] - palette[j][c];
+							distance += difference * difference;
+						}
+
+						if (distance < bestDistance)
+						{
+							bestDistance = distance;
+							index = j;
+						}
+					}
+				}
+
+				indices |= index << (2 * i);
+			}
+
+			WriteUInt16(&block[0], color0);
+			WriteUInt16(&block[2], color1);
+			for (unsigned int i = 0; i < 4; ++i)
+				block[4 + i] = static_cast<UInt8>(indices >> (8 * i));
+		}
+
+		void EncodeExplicitAlphaBlock(const BlockPixels& pixels, UInt8* block)
+		{
+			std::memset(block, 0, 8);
+			for (unsigned int i = 0; i < 16; ++i)
+				block[i / 2] |= static_cast<UInt8>(((pixels[i][3] * 15 + 127) / 255) << ((i % 2) * 4));
+		}
+
+		void EncodeInterpolatedAlphaBlock(const BlockPixels& pixels, UInt8* block)
+		{
+			UInt8 minAlpha = 0xFF;
+			UInt8 maxAlpha = 0;
+			for (unsigned int i = 0; i < 16; ++i)
+			{
+				minAlpha = std::min(minAlpha, pixels[i][3]);
+				maxAlpha = std::max(maxAlpha, pixels[i][3]);
+			}
+
+			// alpha0 > alpha1 selects the eight alphas mode, if both are equal every index refers to the same alpha anyway
+			UInt8 palette[8];
+			ComputeAlphaPalette(maxAlpha, minAlpha, palette);
+
+			UInt64 indices = 0;
+			for (unsigned int i = 0; i < 16; ++i)
+			{
+				UInt64 index = 0;
+				int bestDistance = std::numeric_limits<int>::max();
+				for (unsigned int j = 0; j < 8; ++j)
+				{
+					int distance = std::abs(pixels[i][3] - palette[j]);
+					if (distance < bestDistance)
+					{
+						bestDistance = distance;
+						index = j;
+					}
+				}
+
+				indices |= index << (3 * i);
+			}
+
+			block[0] = maxAlpha;
+			block[1] = minAlpha;
+			for (unsigned int i = 0; i < 6; ++i)
+				block[2 + i] = static_cast<UInt8>(indices >> (8 * i));
+		}
+
+		template<typename F>
+		void ForEachBlock(unsigned int width, unsigned int height, unsigned int depth, F&& function)
+		{
+			unsigned int blockCountX = (width + 3) / 4;
+			unsigned int blockCountY = (height + 3) / 4;
+			std::size_t blockPerSlice = std::size_t(blockCountX) * blockCountY;
+
+			TaskScheduler::ParallelFor(0, blockPerSlice * depth, blockGrainSize, [&](std::size_t first, std::size_t last)
+			{
+				for (std::size_t blockIndex = first; blockIndex < last; ++blockIndex)
+				{
+					unsigned int z = static_cast<unsigned int>(blockIndex / blockPerSlice);
+					unsigned int y = static_cast<unsigned int>((blockIndex % blockPerSlice) / blockCountX) * 4;
+					unsigned int x = static_cast<unsigned int>(blockIndex % blockCountX) * 4;
+
+					function(blockIndex, x, y, z);
+				}
+			});
+		}
+
+		inline std::size_t GetBlockSize(PixelFormatType format)
+		{
+			return (format == PixelFormatType_DXT1) ? 8 : 16;
+		}
+
+		template<PixelFormatType format1, PixelFormatType format2>
+		void RegisterConverter(PixelFormat::ConvertFunction function)
+		{
+			PixelFormat::SetConvertFunction(format1, format2, std::move(function));
+		}
+
 		template<PixelFormatType format1, PixelFormatType format2>
 		void RegisterConverter()
 		{
@@ -1268,6 +1818,97 @@ namespace Nz
 		}
 	}
 
+	bool PixelFormat::Compress(PixelFormatType dstFormat, unsigned int width, unsigned int height, unsigned int depth, const void* src, void* dst)
+	{
+		if (dstFormat != PixelFormatType_DXT1 && dstFormat != PixelFormatType_DXT3 && dstFormat != PixelFormatType_DXT5)
+		{
+			NazaraError("Compression to " + GetName(dstFormat) + " is not supported");
+			return false;
+		}
+
+		const UInt8* srcPixels = static_cast<const UInt8*>(src);
+		UInt8* dstBlocks = static_cast<UInt8*>(dst);
+		std::size_t blockSize = GetBlockSize(dstFormat);
+
+		ForEachBlock(width, height, depth, [&](std::size_t blockIndex, unsigned int x, unsigned int y, unsigned int z)
+		{
+			// Pixels out of the image (when its size isn't a multiple of four) repeat the last row and column
+			BlockPixels pixels;
+			for (unsigned int j = 0; j < 4; ++j)
+			{
+				unsigned int pixelY = std::min(y + j, height - 1);
+				for (unsigned int i = 0; i < 4; ++i)
+				{
+					unsigned int pixelX = std::min(x + i, width - 1);
+					std::memcpy(pixels[j * 4 + i], &srcPixels[((std::size_t(z) * height + pixelY) * width + pixelX) * 4], 4);
+				}
+			}
+
+			UInt8* block = &dstBlocks[blockIndex * blockSize];
+			switch (dstFormat)
+			{
+				case PixelFormatType_DXT1:
+					EncodeColorBlock(pixels, true, block);
+					break;
+
+				case PixelFormatType_DXT3:
+					EncodeExplicitAlphaBlock(pixels, block);
+					EncodeColorBlock(pixels, false, block + 8);
+					break;
+
+				default:
+					EncodeInterpolatedAlphaBlock(pixels, block);
+					EncodeColorBlock(pixels, false, block + 8);
+					break;
+			}
+		});
+
+		return true;
+	}
+
+	bool PixelFormat::Decompress(PixelFormatType srcFormat, unsigned int width, unsigned int height, unsigned int depth, const void* src, void* dst)
+	{
+		if (srcFormat != PixelFormatType_DXT1 && srcFormat != PixelFormatType_DXT3 && srcFormat != PixelFormatType_DXT5)
+		{
+			NazaraError("Decompression from " + GetName(srcFormat) + " is not supported");
+			return false;
+		}
+
+		const UInt8* srcBlocks = static_cast<const UInt8*>(src);
+		UInt8* dstPixels = static_cast<UInt8*>(dst);
+		std::size_t blockSize = GetBlockSize(srcFormat);
+
+		ForEachBlock(width, height, depth, [&](std::size_t blockIndex, unsigned int x, unsigned int y, unsigned int z)
+		{
+			const UInt8* block = &srcBlocks[blockIndex * blockSize];
+
+			BlockPixels pixels;
+			switch (srcFormat)
+			{
+				case PixelFormatType_DXT1:
+					DecodeColorBlock(block, true, pixels);
+					break;
+
+				case PixelFormatType_DXT3:
+					DecodeColorBlock(block + 8, false, pixels);
+					DecodeExplicitAlphaBlock(block, pixels);
+					break;
+
+				default:
+					DecodeColorBlock(block + 8, false, pixels);
+					DecodeInterpolatedAlphaBlock(block, pixels);
+					break;
+			}
+
+			unsigned int blockWidth = std::min(width - x, 4U);
+			unsigned int blockHeight = std::min(height - y, 4U);
+			for (unsigned int j = 0; j < blockHeight; ++j)
+				std::memcpy(&dstPixels[((std::size_t(z) * height + y + j) * width + x) * 4], pixels[j * 4], blockWidth * 4);
+		});
+
+		return true;
+	}
+
 	bool PixelFormat::Flip(PixelFlipping flipping, PixelFormatType format, unsigned int width, unsigned int height, unsigned int depth, const void* src, void* dst)
 	{
 		#if NAZARA_UTILITY_SAFE
@@ -1488,74 +2129,7 @@ namespace Nz
 		RegisterConverter<PixelFormatType_BGRA8, PixelFormatType_RGBA4>();
 		RegisterConverter<PixelFormatType_BGRA8, PixelFormatType_RGBA8>();
 
-		/**********************************DXT1***********************************/
-		///TODO: Décompresseur DXT1
-	/*
-		RegisterConverter<PixelFormatType_DXT1, PixelFormatType_BGR8>();
-		RegisterConverter<PixelFormatType_DXT1, PixelFormatType_BGRA8>();
-		RegisterConverter<PixelFormatType_DXT1, PixelFormatType_DXT3>();
-		RegisterConverter<PixelFormatType_DXT1, PixelFormatType_DXT5>();
-		RegisterConverter<PixelFormatType_DXT1, PixelFormatType_L8>();
-		RegisterConverter<PixelFormatType_DXT1, PixelFormatType_LA8>();
-		RegisterConverter<PixelFormatType_DXT1, PixelFormatType_RGB16F>();
-		RegisterConverter<PixelFormatType_DXT1, PixelFormatType_RGB16I>();
-		RegisterConverter<PixelFormatType_DXT1, PixelFormatType_RGB32F>();
-		RegisterConverter<PixelFormatType_DXT1, PixelFormatType_RGB32I>();
-		RegisterConverter<PixelFormatType_DXT1, PixelFormatType_RGBA16F>();
-		RegisterConverter<PixelFormatType_DXT1, PixelFormatType_RGBA16I>();
-		RegisterConverter<PixelFormatType_DXT1, PixelFormatType_RGBA32F>();
-		RegisterConverter<PixelFormatType_DXT1, PixelFormatType_RGBA32I>();
-		RegisterConverter<PixelFormatType_DXT1, PixelFormatType_RGB5A1>();
-		RegisterConverter<PixelFormatType_DXT1, PixelFormatType_RGB8>();
-		RegisterConverter<PixelFormatType_DXT1, PixelFormatType_RGBA4>();
-		RegisterConverter<PixelFormatType_DXT1, PixelFormatType_RGBA8>();
-	*/
-
-		/**********************************DXT3***********************************/
-		///TODO: Décompresseur DXT3
-	/*
-		RegisterConverter<PixelFormatType_DXT3, PixelFormatType_BGR8>();
-		RegisterConverter<PixelFormatType_DXT3, PixelFormatType_BGRA8>();
-		RegisterConverter<PixelFormatType_DXT3, PixelFormatType_DXT1>();
-		RegisterConverter<PixelFormatType_DXT3, PixelFormatType_DXT5>();
-		RegisterConverter<PixelFormatType_DXT3, PixelFormatType_L8>();
-		RegisterConverter<PixelFormatType_DXT3, PixelFormatType_LA8>();
-		RegisterConverter<PixelFormatType_DXT3, PixelFormatType_RGB16F>();
-		RegisterConverter<PixelFormatType_DXT3, PixelFormatType_RGB16I>();
-		RegisterConverter<PixelFormatType_DXT3, PixelFormatType_RGB32F>();
-		RegisterConverter<PixelFormatType_DXT3, PixelFormatType_RGB32I>();
-		RegisterConverter<PixelFormatType_DXT3, PixelFormatType_RGBA16F>();
-		RegisterConverter<PixelFormatType_DXT3, PixelFormatType_RGBA16I>();
-		RegisterConverter<PixelFormatType_DXT3, PixelFormatType_RGBA32F>();
-		RegisterConverter<PixelFormatType_DXT3, PixelFormatType_RGBA32I>();
-		RegisterConverter<PixelFormatType_DXT3, PixelFormatType_RGB5A1>();
-		RegisterConverter<PixelFormatType_DXT3, PixelFormatType_RGB8>();
-		RegisterConverter<PixelFormatType_DXT3, PixelFormatType_RGBA4>();
-		RegisterConverter<PixelFormatType_DXT3, PixelFormatType_RGBA8>();
-	*/
-
-		/**********************************DXT5***********************************/
-		///TODO: Décompresseur DXT5
-	/*
-		RegisterConverter<PixelFormatType_DXT5, PixelFormatType_BGR8>();
-		RegisterConverter<PixelFormatType_DXT5, PixelFormatType_BGRA8>();
-		RegisterConverter<PixelFormatType_DXT5, PixelFormatType_DXT1>();
-		RegisterConverter<PixelFormatType_DXT5, PixelFormatType_DXT3>();
-		RegisterConverter<PixelFormatType_DXT5, PixelFormatType_L8>();
-		RegisterConverter<PixelFormatType_DXT5, PixelFormatType_LA8>();
-		RegisterConverter<PixelFormatType_DXT5, PixelFormatType_RGB16F>();
-		RegisterConverter<PixelFormatType_DXT5, PixelFormatType_RGB16I>();
-		RegisterConverter<PixelFormatType_DXT5, PixelFormatType_RGB32F>();
-		RegisterConverter<PixelFormatType_DXT5, PixelFormatType_RGB32I>();
-		RegisterConverter<PixelFormatType_DXT5, PixelFormatType_RGBA16F>();
-		RegisterConverter<PixelFormatType_DXT5, PixelFormatType_RGBA16I>();
-		RegisterConverter<PixelFormatType_DXT5, PixelFormatType_RGBA32F>();
-		RegisterConverter<PixelFormatType_DXT5, PixelFormatType_RGBA32I>();
-		RegisterConverter<PixelFormatType_DXT5, PixelFormatType_RGB5A1>();
-		RegisterConverter<PixelFormatType_DXT5, PixelFormatType_RGB8>();
-		RegisterConverter<PixelFormatType_DXT5, PixelFormatType_RGBA4>();
-		RegisterConverter<PixelFormatType_DXT5, PixelFormatType_RGBA8>();
-	*/
+		// DXT1, DXT3 and DXT5 are (de)compressed from/to RGBA8 by Compress and Decompress, see Image::Convert
 
 		/***********************************L8************************************/
 		RegisterConverter<PixelFormatType_L8, PixelFormatType_BGR8>();
@@ -1663,6 +2237,40 @@ namespace Nz
 		RegisterConverter<PixelFormatType_RGBA8, PixelFormatType_RGB8>();
 		RegisterConverter<PixelFormatType_RGBA8, PixelFormatType_RGBA4>();
 
+		/**********************************SIMD***********************************/
+		// Replace the most common conversions by vectorized kernels, depending on the instruction sets available
+		#if defined(NAZARA_SIMD_SSE2)
+		RegisterConverter<PixelFormatType_BGRA8, PixelFormatType_RGBA8>(&ConvertPixelsSwapRedBlueSSE2<PixelFormatType_BGRA8, PixelFormatType_RGBA8>);
+		RegisterConverter<PixelFormatType_RGBA8, PixelFormatType_BGRA8>(&ConvertPixelsSwapRedBlueSSE2<PixelFormatType_RGBA8, PixelFormatType_BGRA8>);
+		RegisterConverter<PixelFormatType_L8, PixelFormatType_BGRA8>(&ConvertPixelsExpandLuminanceSSE2<PixelFormatType_L8, PixelFormatType_BGRA8>);
+		RegisterConverter<PixelFormatType_L8, PixelFormatType_RGBA8>(&ConvertPixelsExpandLuminanceSSE2<PixelFormatType_L8, PixelFormatType_RGBA8>);
+
+		if (HardwareInfo::Initialize() && HardwareInfo::HasCapability(ProcessorCap_SSSE3))
+		{
+			RegisterConverter<PixelFormatType_BGR8, PixelFormatType_BGRA8>(&ConvertPixelsAddAlphaSSSE3<PixelFormatType_BGR8, PixelFormatType_BGRA8, false>);
+			RegisterConverter<PixelFormatType_BGR8, PixelFormatType_RGBA8>(&ConvertPixelsAddAlphaSSSE3<PixelFormatType_BGR8, PixelFormatType_RGBA8, true>);
+			RegisterConverter<PixelFormatType_RGB8, PixelFormatType_BGRA8>(&ConvertPixelsAddAlphaSSSE3<PixelFormatType_RGB8, PixelFormatType_BGRA8, true>);
+			RegisterConverter<PixelFormatType_RGB8, PixelFormatType_RGBA8>(&ConvertPixelsAddAlphaSSSE3<PixelFormatType_RGB8, PixelFormatType_RGBA8, false>);
+			RegisterConverter<PixelFormatType_BGRA8, PixelFormatType_BGR8>(&ConvertPixelsRemoveAlphaSSSE3<PixelFormatType_BGRA8, PixelFormatType_BGR8, false>);
+			RegisterConverter<PixelFormatType_BGRA8, PixelFormatType_RGB8>(&ConvertPixelsRemoveAlphaSSSE3<PixelFormatType_BGRA8, PixelFormatType_RGB8, true>);
+			RegisterConverter<PixelFormatType_RGBA8, PixelFormatType_BGR8>(&ConvertPixelsRemoveAlphaSSSE3<PixelFormatType_RGBA8, PixelFormatType_BGR8, true>);
+			RegisterConverter<PixelFormatType_RGBA8, PixelFormatType_RGB8>(&ConvertPixelsRemoveAlphaSSSE3<PixelFormatType_RGBA8, PixelFormatType_RGB8, false>);
+		}
+		#elif defined(NAZARA_SIMD_NEON)
+		RegisterConverter<PixelFormatType_BGRA8, PixelFormatType_RGBA8>(&ConvertPixelsSwapRedBlueNEON<PixelFormatType_BGRA8, PixelFormatType_RGBA8>);
+		RegisterConverter<PixelFormatType_RGBA8, PixelFormatType_BGRA8>(&ConvertPixelsSwapRedBlueNEON<PixelFormatType_RGBA8, PixelFormatType_BGRA8>);
+		RegisterConverter<PixelFormatType_L8, PixelFormatType_BGRA8>(&ConvertPixelsExpandLuminanceNEON<PixelFormatType_L8, PixelFormatType_BGRA8>);
+		RegisterConverter<PixelFormatType_L8, PixelFormatType_RGBA8>(&ConvertPixelsExpandLuminanceNEON<PixelFormatType_L8, PixelFormatType_RGBA8>);
+		RegisterConverter<PixelFormatType_BGR8, PixelFormatType_BGRA8>(&ConvertPixelsAddAlphaNEON<PixelFormatType_BGR8, PixelFormatType_BGRA8, false>);
+		RegisterConverter<PixelFormatType_BGR8, PixelFormatType_RGBA8>(&ConvertPixelsAddAlphaNEON<PixelFormatType_BGR8, PixelFormatType_RGBA8, true>);
+		RegisterConverter<PixelFormatType_RGB8, PixelFormatType_BGRA8>(&ConvertPixelsAddAlphaNEON<PixelFormatType_RGB8, PixelFormatType_BGRA8, true>);
+		RegisterConverter<PixelFormatType_RGB8, PixelFormatType_RGBA8>(&ConvertPixelsAddAlphaNEON<PixelFormatType_RGB8, PixelFormatType_RGBA8, false>);
+		RegisterConverter<PixelFormatType_BGRA8, PixelFormatType_BGR8>(&ConvertPixelsRemoveAlphaNEON<PixelFormatType_BGRA8, PixelFormatType_BGR8, false>);
+		RegisterConverter<PixelFormatType_BGRA8, PixelFormatType_RGB8>(&ConvertPixelsRemoveAlphaNEON<PixelFormatType_BGRA8, PixelFormatType_RGB8, true>);
+		RegisterConverter<PixelFormatType_RGBA8, PixelFormatType_BGR8>(&ConvertPixelsRemoveAlphaNEON<PixelFormatType_RGBA8, PixelFormatType_BGR8, true>);
+		RegisterConverter<PixelFormatType_RGBA8, PixelFormatType_RGB8>(&ConvertPixelsRemoveAlphaNEON<PixelFormatType_RGBA8, PixelFormatType_RGB8, false>);
+		#endif
+
 		return true;
 	}
 
@@ -3,7 +3,10 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Utility/SimpleTextDrawer.hpp>
+#include <algorithm>
+#include <iterator>
 #include <memory>
+#include <Utfcpp/utf8.h>
 #include <Nazara/Utility/Debug.hpp>
 
 namespace Nz
@@ -11,6 +14,7 @@ namespace Nz
 	SimpleTextDrawer::SimpleTextDrawer() :
 	m_color(Color::White),
 	m_style(TextStyle_Regular),
+	m_asyncGlyphs(false),
 	m_colorUpdated(true),
 	m_glyphUpdated(true),
 	m_characterSize(24)
@@ -22,6 +26,7 @@ namespace Nz
 	m_color(drawer.m_color),
 	m_text(drawer.m_text),
 	m_style(drawer.m_style),
+	m_asyncGlyphs(drawer.m_asyncGlyphs),
 	m_colorUpdated(false),
 	m_glyphUpdated(false),
 	m_characterSize(drawer.m_characterSize)
@@ -38,9 +43,11 @@ namespace Nz
 
 	void SimpleTextDrawer::AppendText(const String& str)
 	{
+		std::size_t textPosition = m_text.GetSize();
+
 		m_text.Append(str);
 		if (m_glyphUpdated)
-			GenerateGlyphs(str);
+			GenerateGlyphs(textPosition);
 	}
 
 	void SimpleTextDrawer::Clear()
@@ -49,6 +56,24 @@ namespace Nz
 		ClearGlyphs();
 	}
 
+	/*!
+	* \brief Enables the rasterization of missing glyphs in the background
+	*
+	* Glyphs which aren't in the font cache yet are rasterized by the TaskScheduler workers (see Font::RequestGlyph), space is reserved for them until they are.
+	* The layout is generated again once they are inserted in the font atlas, which happens while processing the ResourceFinalizationQueue.
+	*
+	* \param enable Should missing glyphs be rasterized in the background
+	*/
+	void SimpleTextDrawer::EnableAsyncGlyphs(bool enable)
+	{
+		if (m_asyncGlyphs != enable)
+		{
+			m_asyncGlyphs = enable;
+
+			m_glyphUpdated = false;
+		}
+	}
+
 	const Recti& SimpleTextDrawer::GetBounds() const
 	{
 		if (!m_glyphUpdated)
@@ -130,6 +155,11 @@ namespace Nz
 		return m_text;
 	}
 
+	bool SimpleTextDrawer::IsAsyncGlyphsEnabled() const
+	{
+		return m_asyncGlyphs;
+	}
+
 	void SimpleTextDrawer::SetCharacterSize(unsigned int characterSize)
 	{
 		m_characterSize = characterSize;
@@ -166,15 +196,47 @@ namespace Nz
 		m_glyphUpdated = false;
 	}
 
+	/*!
+	* \brief Sets the text to draw
+	*
+	* If the glyphs are up to date, only the lines from the first difference between the new text and the previous one are laid out again,
+	* which makes appending or replacing the end of a long text cheap.
+	*
+	* \param str Text to draw
+	*/
 	void SimpleTextDrawer::SetText(const String& str)
 	{
+		if (!m_glyphUpdated || !m_font)
+		{
+			m_text = str;
+			m_glyphUpdated = false;
+			return;
+		}
+
+		// Look for the first byte differing from the previous text
+		const char* previousText = m_text.GetConstBuffer();
+		const char* newText = str.GetConstBuffer();
+		std::size_t commonSize = std::min(m_text.GetSize(), str.GetSize());
+
+		std::size_t textPosition = 0;
+		while (textPosition < commonSize && previousText[textPosition] == newText[textPosition])
+			textPosition++;
+
+		if (textPosition == m_text.GetSize() && textPosition == str.GetSize())
+			return; //< Same text
+
+		// The lines before the one holding the difference keep their layout
+		std::size_t lineIndex = std::upper_bound(m_lineTextPositions.begin(), m_lineTextPositions.end(), textPosition) - m_lineTextPositions.begin() - 1;
+
 		m_text = str;
 
-		m_glyphUpdated = false;
+		EraseGlyphs(lineIndex);
+		GenerateGlyphs(m_lineTextPositions[lineIndex]);
 	}
 
 	SimpleTextDrawer& SimpleTextDrawer::operator=(const SimpleTextDrawer& drawer)
 	{
+		m_asyncGlyphs = drawer.m_asyncGlyphs;
 		m_characterSize = drawer.m_characterSize;
 		m_color = drawer.m_color;
 		m_style = drawer.m_style;
@@ -191,15 +253,21 @@ namespace Nz
 	{
 		DisconnectFontSlots();
 
+		m_asyncGlyphs = std::move(drawer.m_asyncGlyphs);
 		m_bounds = std::move(drawer.m_bounds);
 		m_colorUpdated = std::move(drawer.m_colorUpdated);
 		m_characterSize = std::move(drawer.m_characterSize);
 		m_color = std::move(drawer.m_color);
+		m_drawPos = std::move(drawer.m_drawPos);
 		m_glyphs = std::move(drawer.m_glyphs);
 		m_glyphUpdated = std::move(drawer.m_glyphUpdated);
 		m_font = std::move(drawer.m_font);
+		m_lines = std::move(drawer.m_lines);
+		m_lineTextPositions = std::move(drawer.m_lineTextPositions);
+		m_previousCharacter = std::move(drawer.m_previousCharacter);
 		m_style = std::move(drawer.m_style);
 		m_text = std::move(drawer.m_text);
+		m_workingBounds = std::move(drawer.m_workingBounds);
 
 		// Update slot pointers (TODO: Improve the way of doing this)
 		ConnectFontSlots();
@@ -236,6 +304,7 @@ namespace Nz
 		m_colorUpdated = true;
 		m_drawPos.Set(0, m_characterSize); //< Our draw "cursor"
 		m_lines.clear();
+		m_lineTextPositions.assign(1, 0);
 		m_glyphs.clear();
 		m_glyphUpdated = true;
 		m_previousCharacter = 0;
@@ -253,6 +322,7 @@ namespace Nz
 		m_atlasLayerChangedSlot.Connect(m_font->OnFontAtlasLayerChanged, this, &SimpleTextDrawer::OnFontAtlasLayerChanged);
 		m_fontReleaseSlot.Connect(m_font->OnFontRelease, this, &SimpleTextDrawer::OnFontRelease);
 		m_glyphCacheClearedSlot.Connect(m_font->OnFontGlyphCacheCleared, this, &SimpleTextDrawer::OnFontInvalidated);
+		m_glyphsRasterizedSlot.Connect(m_font->OnFontGlyphsRasterized, this, &SimpleTextDrawer::OnFontInvalidated);
 	}
 
 	void SimpleTextDrawer::DisconnectFontSlots()
@@ -261,26 +331,57 @@ namespace Nz
 		m_atlasLayerChangedSlot.Disconnect();
 		m_fontReleaseSlot.Disconnect();
 		m_glyphCacheClearedSlot.Disconnect();
+		m_glyphsRasterizedSlot.Disconnect();
 	}
 
-	void SimpleTextDrawer::GenerateGlyphs(const String& text) const
+	void SimpleTextDrawer::EraseGlyphs(std::size_t lineIndex) const
 	{
-		if (text.IsEmpty())
-			return;
+		NazaraAssert(lineIndex < m_lines.size(), "Line index out of range");
 
-		///TODO: Allow iteration on Unicode characters without allocating any buffer
-		std::u32string characters = text.GetUtf32String();
-		if (characters.empty())
-		{
-			NazaraError("Invalid character set");
+		const Font::SizeInfo& sizeInfo = m_font->GetSizeInfo(m_characterSize);
+
+		// Put the layout back in the state it had at the beginning of the line
+		m_glyphs.resize(m_lines[lineIndex].glyphIndex);
+		m_lines.resize(lineIndex + 1);
+		m_lineTextPositions.resize(lineIndex + 1);
+
+		m_lines.back().bounds.Set(0.f, float(sizeInfo.lineHeight * lineIndex), 0.f, float(sizeInfo.lineHeight));
+
+		m_drawPos.Set(0, m_characterSize + static_cast<unsigned int>(sizeInfo.lineHeight * lineIndex));
+		m_previousCharacter = (lineIndex > 0) ? '\n' : 0;
+
+		m_workingBounds.MakeZero();
+		for (std::size_t i = 0; i < lineIndex; ++i)
+			m_workingBounds.ExtendTo(m_lines[i].bounds);
+
+		m_bounds.Set(Rectf(std::floor(m_workingBounds.x), std::floor(m_workingBounds.y), std::ceil(m_workingBounds.width), std::ceil(m_workingBounds.height)));
+	}
+
+	void SimpleTextDrawer::GenerateGlyphs(std::size_t textPosition) const
+	{
+		if (m_text.IsEmpty())
 			return;
-		}
+
+		// Glyphs kept from a previous layout must share the color of the new ones
+		if (!m_colorUpdated)
+			UpdateGlyphColor();
+
+		const char* textBegin = m_text.GetConstBuffer();
+		const char* textEnd = textBegin + m_text.GetSize();
 
 		const Font::SizeInfo& sizeInfo = m_font->GetSizeInfo(m_characterSize);
 
-		m_glyphs.reserve(m_glyphs.size() + characters.size());
-		for (char32_t character : characters)
+		// Missing glyphs are rasterized by the workers as a whole, instead of one task per glyph
+		if (m_asyncGlyphs)
+			m_font->PrecacheAsync(m_characterSize, m_style, String(textBegin + textPosition, textEnd - textBegin - textPosition));
+
+		// Iterate directly on the UTF-8 bytes of the text, without converting it
+		utf8::unchecked::iterator<const char*> it(textBegin + textPosition);
+		utf8::unchecked::iterator<const char*> end(textEnd);
+		for (; it != end; ++it)
 		{
+			char32_t character = *it;
+
 			if (m_previousCharacter != 0)
 				m_drawPos.x += m_font->GetKerning(m_characterSize, m_previousCharacter, character);
 
@@ -304,13 +405,24 @@ namespace Nz
 					break;
 			}
 
-			Glyph glyph;
+			const Font::Glyph* fontGlyphPtr = nullptr;
 			if (!whitespace)
 			{
-				const Font::Glyph& fontGlyph = m_font->GetGlyph(m_characterSize, m_style, character);
-				if (!fontGlyph.valid)
+				fontGlyphPtr = (m_asyncGlyphs) ? &m_font->RequestGlyph(m_characterSize, m_style, character) : &m_font->GetGlyph(m_characterSize, m_style, character);
+				if (fontGlyphPtr->pending)
+				{
+					// Keep some room until the glyph is rasterized, the layout will be generated again then
+					advance = sizeInfo.spaceAdvance;
+					whitespace = true;
+				}
+				else if (!fontGlyphPtr->valid)
 					continue; // Glyph failed to load, just skip it (can't do much)
+			}
 
+			Glyph glyph;
+			if (!whitespace)
+			{
+				const Font::Glyph& fontGlyph = *fontGlyphPtr;
 				advance = fontGlyph.advance;
 
 				glyph.atlas = m_font->GetAtlas()->GetLayer(fontGlyph.layerIndex);
@@ -375,6 +487,7 @@ namespace Nz
 
 					m_workingBounds.ExtendTo(m_lines.back().bounds);
 					m_lines.emplace_back(Line{Rectf(0.f, float(sizeInfo.lineHeight * m_lines.size()), 0.f, float(sizeInfo.lineHeight)), m_glyphs.size() + 1});
+					m_lineTextPositions.push_back(std::next(it).base() - textBegin);
 					break;
 				}
 
@@ -459,6 +572,6 @@ namespace Nz
 		NazaraAssert(m_font && m_font->IsValid(), "Invalid font");
 
 		ClearGlyphs();
-		GenerateGlyphs(m_text);
+		GenerateGlyphs(0);
 	}
 }
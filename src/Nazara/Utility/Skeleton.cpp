@@ -4,6 +4,7 @@
 
 #include <Nazara/Utility/Skeleton.hpp>
 #include <Nazara/Utility/Joint.hpp>
+#include <Nazara/Utility/Sequence.hpp>
 #include <unordered_map>
 #include <Nazara/Utility/Debug.hpp>
 
@@ -338,6 +339,35 @@ namespace Nz
 		return m_impl != nullptr;
 	}
 
+	void Skeleton::SetPose(const SequenceJoint* pose)
+	{
+		NazaraAssert(m_impl, "Skeleton not created");
+		NazaraAssert(pose, "Invalid pose");
+
+		// Joints are written directly, the skeleton is only invalidated once for the whole pose
+		for (std::size_t i = 0; i < m_impl->joints.size(); ++i)
+			m_impl->joints[i].SetPose(pose[i].position, pose[i].rotation, pose[i].scale);
+
+		InvalidateJoints();
+	}
+
+	void Skeleton::SetPose(const SequenceJoint* pose, const UInt32* indices, UInt32 indiceCount)
+	{
+		NazaraAssert(m_impl, "Skeleton not created");
+		NazaraAssert(pose, "Invalid pose");
+		NazaraAssert(indices || indiceCount == 0, "Invalid indices");
+
+		for (UInt32 i = 0; i < indiceCount; ++i)
+		{
+			UInt32 index = indices[i];
+			NazaraAssert(index < m_impl->joints.size(), "Index out of range");
+
+			m_impl->joints[index].SetPose(pose[index].position, pose[index].rotation, pose[index].scale);
+		}
+
+		InvalidateJoints();
+	}
+
 	Skeleton& Skeleton::operator=(const Skeleton& skeleton)
 	{
 		if (this == &skeleton)
@@ -4,18 +4,147 @@
 
 #include <Nazara/Utility/SoftwareBuffer.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/MemoryHelper.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <array>
+#include <cstdint>
 #include <cstring>
 #include <exception>
+#include <vector>
 #include <Nazara/Utility/Debug.hpp>
 
 namespace Nz
 {
-	SoftwareBuffer::SoftwareBuffer(Buffer* /*parent*/, BufferType /*type*/)
+	namespace
+	{
+		// Released memory is kept by power-of-two size classes, from 256 B to 1 MiB, for the next buffers of the same class
+		constexpr unsigned int MinSizeClass = 8;
+		constexpr unsigned int MaxSizeClass = 20;
+		constexpr std::size_t MaxPooledSize = 32 * 1024 * 1024;
+
+		bool s_poolAvailable = false;
+
+		class SoftwareBufferPool
+		{
+			public:
+				SoftwareBufferPool() :
+				m_pooledSize(0)
+				{
+					s_poolAvailable = true;
+				}
+
+				~SoftwareBufferPool()
+				{
+					// Buffers released after this (i.e. by other static objects) free their memory directly
+					s_poolAvailable = false;
+
+					Clear();
+				}
+
+				UInt8* Allocate(UInt32 size, UInt32* capacity)
+				{
+					unsigned int sizeClass = GetSizeClass(size);
+					if (sizeClass <= MaxSizeClass)
+					{
+						*capacity = UInt32(1) << sizeClass;
+
+						LockGuard lock(m_mutex);
+
+						std::vector<UInt8*>& freeBlocks = m_freeBlocks[sizeClass - MinSizeClass];
+						if (!freeBlocks.empty())
+						{
+							UInt8* block = freeBlocks.back();
+							freeBlocks.pop_back();
+
+							m_pooledSize -= *capacity;
+							return block;
+						}
+					}
+					else
+						*capacity = size;
+
+					return AllocateAligned(*capacity);
+				}
+
+				void Clear()
+				{
+					LockGuard lock(m_mutex);
+
+					for (std::vector<UInt8*>& freeBlocks : m_freeBlocks)
+					{
+						for (UInt8* block : freeBlocks)
+							FreeAligned(block);
+
+						freeBlocks.clear();
+					}
+
+					m_pooledSize = 0;
+				}
+
+				void Free(UInt8* block, UInt32 capacity, bool transient)
+				{
+					// Blocks allocated before the pool was constructed are not sized according to their class
+					unsigned int sizeClass = GetSizeClass(capacity);
+					if (sizeClass <= MaxSizeClass && (UInt32(1) << sizeClass) == capacity)
+					{
+						LockGuard lock(m_mutex);
+
+						// Transient buffers are going to be recreated soon, their memory is always kept
+						if (transient || m_pooledSize + capacity <= MaxPooledSize)
+						{
+							m_freeBlocks[sizeClass - MinSizeClass].push_back(block);
+							m_pooledSize += capacity;
+							return;
+						}
+					}
+
+					FreeAligned(block);
+				}
+
+				static UInt8* AllocateAligned(std::size_t size)
+				{
+					// The pointer returned by the allocation is stored right before the aligned memory
+					UInt8* allocation = static_cast<UInt8*>(OperatorNew(size + SoftwareBuffer::Alignment));
+					UInt8* block = reinterpret_cast<UInt8*>((reinterpret_cast<std::uintptr_t>(allocation) + SoftwareBuffer::Alignment) & ~(SoftwareBuffer::Alignment - 1));
+					reinterpret_cast<UInt8**>(block)[-1] = allocation;
+
+					return block;
+				}
+
+				static void FreeAligned(UInt8* block)
+				{
+					OperatorDelete(reinterpret_cast<UInt8**>(block)[-1]);
+				}
+
+			private:
+				static unsigned int GetSizeClass(UInt32 size)
+				{
+					unsigned int sizeClass = MinSizeClass;
+					while (sizeClass <= MaxSizeClass && (UInt32(1) << sizeClass) < size)
+						sizeClass++;
+
+					return sizeClass;
+				}
+
+				std::array<std::vector<UInt8*>, MaxSizeClass - MinSizeClass + 1> m_freeBlocks;
+				Mutex m_mutex;
+				std::size_t m_pooledSize;
+		};
+
+		SoftwareBufferPool s_pool;
+	}
+
+	SoftwareBuffer::SoftwareBuffer(Buffer* /*parent*/, BufferType /*type*/) :
+	m_buffer(nullptr),
+	m_capacity(0),
+	m_mapped(false)
 	{
 	}
 
 	SoftwareBuffer::~SoftwareBuffer()
 	{
+		Release();
 	}
 
 	bool SoftwareBuffer::Fill(const void* data, UInt32 offset, UInt32 size)
@@ -26,12 +155,22 @@ namespace Nz
 		return true;
 	}
 
-	bool SoftwareBuffer::Initialize(UInt32 size, BufferUsageFlags /*usage*/)
+	bool SoftwareBuffer::Initialize(UInt32 size, BufferUsageFlags usage)
 	{
+		Release();
+
+		m_usage = usage;
+
 		// Protect the allocation to prevent a memory exception to escape the function
 		try
 		{
-			m_buffer.resize(size);
+			if (s_poolAvailable)
+				m_buffer = s_pool.Allocate(size, &m_capacity);
+			else
+			{
+				m_buffer = SoftwareBufferPool::AllocateAligned(size);
+				m_capacity = size;
+			}
 		}
 		catch (const std::exception& e)
 		{
@@ -39,6 +178,10 @@ namespace Nz
 			return false;
 		}
 
+		// A transient buffer is expected to be entirely filled before being used, its previous content doesn't matter
+		if ((usage & BufferUsage_Transient) == 0)
+			std::memset(m_buffer, 0, size);
+
 		m_mapped = false;
 
 		return true;
@@ -66,4 +209,23 @@ namespace Nz
 
 		return true;
 	}
+
+	void SoftwareBuffer::ReleasePooledMemory()
+	{
+		if (s_poolAvailable)
+			s_pool.Clear();
+	}
+
+	void SoftwareBuffer::Release()
+	{
+		if (!m_buffer)
+			return;
+
+		if (s_poolAvailable)
+			s_pool.Free(m_buffer, m_capacity, (m_usage & BufferUsage_Transient) != 0);
+		else
+			SoftwareBufferPool::FreeAligned(m_buffer);
+
+		m_buffer = nullptr;
+	}
 }
@@ -5,6 +5,7 @@
 #include <Nazara/Utility/StaticMesh.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Utility/Algorithm.hpp>
+#include <Nazara/Utility/IndexMapper.hpp>
 #include <Nazara/Utility/VertexMapper.hpp>
 #include <Nazara/Utility/Debug.hpp>
 
@@ -36,6 +37,13 @@ namespace Nz
 		m_aabb.x -= offset.x;
 		m_aabb.y -= offset.y;
 		m_aabb.z -= offset.z;
+
+		for (Meshlet& meshlet : m_meshlets)
+		{
+			meshlet.boundingSphere.x -= offset.x;
+			meshlet.boundingSphere.y -= offset.y;
+			meshlet.boundingSphere.z -= offset.z;
+		}
 	}
 
 	bool StaticMesh::Create(VertexBuffer* vertexBuffer)
@@ -61,6 +69,7 @@ namespace Nz
 			OnStaticMeshDestroy(this);
 
 			m_indexBuffer.Reset();
+			m_meshlets.clear();
 			m_vertexBuffer.Reset();
 		}
 	}
@@ -74,6 +83,22 @@ namespace Nz
 		return true;
 	}
 
+	bool StaticMesh::GenerateMeshlets(unsigned int maxTriangles, unsigned int maxVertices)
+	{
+		// Meshlets are drawn as ranges of the index buffer
+		if (!m_indexBuffer || GetPrimitiveMode() != PrimitiveMode_TriangleList)
+		{
+			NazaraError("Meshlets can only be generated from indexed triangle lists");
+			return false;
+		}
+
+		IndexMapper indexMapper(m_indexBuffer, BufferAccess_ReadOnly);
+		VertexMapper vertexMapper(m_vertexBuffer, BufferAccess_ReadOnly);
+		BuildMeshlets(indexMapper.begin(), m_indexBuffer->GetIndexCount(), vertexMapper.GetComponentPtr<const Vector3f>(VertexComponent_Position), &m_meshlets, maxTriangles, maxVertices);
+
+		return true;
+	}
+
 	const Boxf& StaticMesh::GetAABB() const
 	{
 		return m_aabb;
@@ -89,6 +114,11 @@ namespace Nz
 		return m_indexBuffer;
 	}
 
+	const std::vector<Meshlet>& StaticMesh::GetMeshlets() const
+	{
+		return m_meshlets;
+	}
+
 	VertexBuffer* StaticMesh::GetVertexBuffer()
 	{
 		return m_vertexBuffer;
@@ -122,5 +152,6 @@ namespace Nz
 	void StaticMesh::SetIndexBuffer(const IndexBuffer* indexBuffer)
 	{
 		m_indexBuffer = indexBuffer;
-}
+		m_meshlets.clear();
+	}
 }
@@ -5,13 +5,123 @@
 #include <Nazara/Utility/SubMesh.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/String.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Utility/Config.hpp>
-#include <Nazara/Utility/TriangleIterator.hpp>
+#include <Nazara/Utility/IndexMapper.hpp>
 #include <Nazara/Utility/VertexMapper.hpp>
+#include <algorithm>
+#include <array>
+#include <vector>
 #include <Nazara/Utility/Debug.hpp>
 
 namespace Nz
 {
+	namespace
+	{
+		std::size_t s_triangleGrainSize = 16 * 1024;
+
+		std::size_t GetTriangleCount(PrimitiveMode primitiveMode, std::size_t indexCount)
+		{
+			switch (primitiveMode)
+			{
+				case PrimitiveMode_TriangleFan:
+				case PrimitiveMode_TriangleStrip:
+					return (indexCount >= 3) ? indexCount - 2 : 0;
+
+				case PrimitiveMode_TriangleList:
+					return indexCount / 3;
+
+				default:
+					return 0;
+			}
+		}
+
+		void GetTriangleIndices(const IndexMapper& indexMapper, PrimitiveMode primitiveMode, std::size_t triangle, UInt32 indices[3])
+		{
+			switch (primitiveMode)
+			{
+				case PrimitiveMode_TriangleFan:
+					indices[0] = indexMapper.Get(0);
+					indices[1] = indexMapper.Get(triangle + 1);
+					indices[2] = indexMapper.Get(triangle + 2);
+					break;
+
+				case PrimitiveMode_TriangleStrip:
+					// Every other triangle of a strip is reversed, this keeps the winding of the first one
+					indices[0] = indexMapper.Get(triangle + (triangle & 1));
+					indices[1] = indexMapper.Get(triangle + 1 - (triangle & 1));
+					indices[2] = indexMapper.Get(triangle + 2);
+					break;
+
+				default:
+					indices[0] = indexMapper.Get(triangle * 3 + 0);
+					indices[1] = indexMapper.Get(triangle * 3 + 1);
+					indices[2] = indexMapper.Get(triangle * 3 + 2);
+					break;
+			}
+		}
+
+		/*
+		* Sums per-triangle vectors on the vertices of the triangles, then lets finalizeFunc transform the sums before writing them to the outputs
+		* Triangles are split in one range per thread, each one accumulating in its own buffer, which avoids any synchronization
+		* Buffers are only mapped from the calling thread, as hardware buffers can't be mapped without the context of the renderer
+		*/
+		template<std::size_t N, typename T, typename F>
+		void AccumulateTriangles(const IndexMapper& indexMapper, PrimitiveMode primitiveMode, UInt32 vertexCount, const std::array<SparsePtr<Vector3f>, N>& outputs, T&& triangleFunc, F&& finalizeFunc)
+		{
+			std::size_t triangleCount = GetTriangleCount(primitiveMode, indexMapper.GetIndexCount());
+			std::size_t rangeCount = std::min<std::size_t>(TaskScheduler::GetWorkerCount() + 1, (triangleCount + s_triangleGrainSize - 1) / s_triangleGrainSize);
+			rangeCount = std::max<std::size_t>(rangeCount, 1);
+
+			std::vector<std::array<Vector3f, N>> sums(rangeCount * vertexCount);
+			TaskScheduler::ParallelFor(0, rangeCount, 1, [&] (std::size_t firstRange, std::size_t lastRange)
+			{
+				for (std::size_t range = firstRange; range < lastRange; ++range)
+				{
+					std::array<Vector3f, N>* rangeSums = &sums[range * vertexCount];
+					for (UInt32 i = 0; i < vertexCount; ++i)
+						rangeSums[i].fill(Vector3f::Zero());
+
+					std::size_t lastTriangle = (range + 1) * triangleCount / rangeCount;
+					for (std::size_t triangle = range * triangleCount / rangeCount; triangle < lastTriangle; ++triangle)
+					{
+						UInt32 indices[3];
+						GetTriangleIndices(indexMapper, primitiveMode, triangle, indices);
+
+						std::array<Vector3f, N> values;
+						triangleFunc(indices, values);
+
+						for (unsigned int i = 0; i < 3; ++i)
+						{
+							std::array<Vector3f, N>& vertexSums = rangeSums[indices[i]];
+							for (std::size_t j = 0; j < N; ++j)
+								vertexSums[j] += values[j];
+						}
+					}
+				}
+			});
+
+			TaskScheduler::ParallelFor(0, vertexCount, 0, [&] (std::size_t firstVertex, std::size_t lastVertex)
+			{
+				for (std::size_t vertex = firstVertex; vertex < lastVertex; ++vertex)
+				{
+					std::array<Vector3f, N> values = sums[vertex];
+					for (std::size_t range = 1; range < rangeCount; ++range)
+					{
+						const std::array<Vector3f, N>& rangeSums = sums[range * vertexCount + vertex];
+						for (std::size_t j = 0; j < N; ++j)
+							values[j] += rangeSums[j];
+					}
+
+					finalizeFunc(static_cast<UInt32>(vertex), values);
+
+					for (std::size_t j = 0; j < N; ++j)
+						outputs[j][vertex] = values[j];
+				}
+			});
+		}
+	}
+
 	SubMesh::SubMesh(const Mesh* parent) :
 	RefCounted(false), // Un SubMesh n'est pas persistant par défaut
 	m_primitiveMode(PrimitiveMode_TriangleList),
@@ -31,31 +141,22 @@ namespace Nz
 		UInt32 vertexCount = mapper.GetVertexCount();
 
 		SparsePtr<Vector3f> normals = mapper.GetComponentPtr<Vector3f>(VertexComponent_Normal);
-		SparsePtr<Vector3f> positions = mapper.GetComponentPtr<Vector3f>(VertexComponent_Position);
+		SparsePtr<const Vector3f> positions = mapper.GetComponentPtr<const Vector3f>(VertexComponent_Position);
 		if (!normals || !positions)
 			return;
 
-		for (UInt32 i = 0; i < vertexCount; ++i)
-			normals[i].MakeZero();
+		IndexMapper indexMapper(this, BufferAccess_ReadOnly);
 
-		TriangleIterator iterator(this);
-		do
+		std::array<SparsePtr<Vector3f>, 1> outputs = {normals};
+		AccumulateTriangles(indexMapper, m_primitiveMode, vertexCount, outputs, [&] (const UInt32 indices[3], std::array<Vector3f, 1>& values)
 		{
-			Vector3f pos0 = positions[iterator[0]];
-
-			Vector3f dv[2];
-			dv[0] = positions[iterator[1]] - pos0;
-			dv[1] = positions[iterator[2]] - pos0;
-
-			Vector3f normal = dv[0].CrossProduct(dv[1]);
-
-			for (unsigned int i = 0; i < 3; ++i)
-				normals[iterator[i]] += normal;
-		}
-		while (iterator.Advance());
-
-		for (UInt32 i = 0; i < vertexCount; ++i)
-			normals[i].Normalize();
+			Vector3f pos0 = positions[indices[0]];
+			values[0] = Vector3f::CrossProduct(positions[indices[1]] - pos0, positions[indices[2]] - pos0);
+		},
+		[] (UInt32 /*vertex*/, std::array<Vector3f, 1>& values)
+		{
+			values[0].Normalize();
+		});
 	}
 
 	void SubMesh::GenerateNormalsAndTangents()
@@ -64,100 +165,89 @@ namespace Nz
 		UInt32 vertexCount = mapper.GetVertexCount();
 
 		SparsePtr<Vector3f> normals = mapper.GetComponentPtr<Vector3f>(VertexComponent_Normal);
-		SparsePtr<Vector3f> positions = mapper.GetComponentPtr<Vector3f>(VertexComponent_Position);
+		SparsePtr<const Vector3f> positions = mapper.GetComponentPtr<const Vector3f>(VertexComponent_Position);
 		SparsePtr<Vector3f> tangents = mapper.GetComponentPtr<Vector3f>(VertexComponent_Tangent);
-		SparsePtr<Vector2f> texCoords = mapper.GetComponentPtr<Vector2f>(VertexComponent_TexCoord);
+		SparsePtr<const Vector2f> texCoords = mapper.GetComponentPtr<const Vector2f>(VertexComponent_TexCoord);
 		if (!normals || !positions || !tangents || !texCoords)
 			return;
 
-		for (UInt32 i = 0; i < vertexCount; ++i)
-		{
-			normals[i].MakeZero();
-			tangents[i].MakeZero();
-		}
+		IndexMapper indexMapper(this, BufferAccess_ReadOnly);
 
-		TriangleIterator iterator(this);
-		do
+		std::array<SparsePtr<Vector3f>, 2> outputs = {normals, tangents};
+		AccumulateTriangles(indexMapper, m_primitiveMode, vertexCount, outputs, [&] (const UInt32 indices[3], std::array<Vector3f, 2>& values)
 		{
-			Vector3f pos0 = positions[iterator[0]];
+			Vector3f pos0 = positions[indices[0]];
 
 			Vector3f dv[2];
-			dv[0] = positions[iterator[1]] - pos0;
-			dv[1] = positions[iterator[2]] - pos0;
-
-			Vector3f normal = dv[0].CrossProduct(dv[1]);
+			dv[0] = positions[indices[1]] - pos0;
+			dv[1] = positions[indices[2]] - pos0;
 
-			Vector2f uv0 = texCoords[iterator[0]];
+			Vector2f uv0 = texCoords[indices[0]];
 
 			Vector2f duv[2];
-			duv[0] = texCoords[iterator[1]] - uv0;
-			duv[1] = texCoords[iterator[2]] - uv0;
+			duv[0] = texCoords[indices[1]] - uv0;
+			duv[1] = texCoords[indices[2]] - uv0;
 
 			float coef = 1.f / (duv[0].x*duv[1].y - duv[1].x*duv[0].y);
 
-			Vector3f tangent;
-			tangent.x = coef * (dv[0].x*duv[1].y + dv[1].x*(-duv[0].y));
-			tangent.y = coef * (dv[0].y*duv[1].y + dv[1].y*(-duv[0].y));
-			tangent.z = coef * (dv[0].z*duv[1].y + dv[1].z*(-duv[0].y));
-
-			for (unsigned int i = 0; i < 3; ++i)
-			{
-				UInt32 index = iterator[i];
-				normals[index] += normal;
-				tangents[index] += tangent;
-			}
-		}
-		while (iterator.Advance());
+			values[0] = dv[0].CrossProduct(dv[1]);
 
-		for (UInt32 i = 0; i < vertexCount; ++i)
+			values[1].x = coef * (dv[0].x*duv[1].y + dv[1].x*(-duv[0].y));
+			values[1].y = coef * (dv[0].y*duv[1].y + dv[1].y*(-duv[0].y));
+			values[1].z = coef * (dv[0].z*duv[1].y + dv[1].z*(-duv[0].y));
+		},
+		[] (UInt32 /*vertex*/, std::array<Vector3f, 2>& values)
 		{
-			normals[i].Normalize();
-			tangents[i].Normalize();
-		}
+			values[0].Normalize();
+			values[1].Normalize();
+		});
 	}
 
 	void SubMesh::GenerateTangents()
 	{
 		VertexMapper mapper(this);
+		UInt32 vertexCount = mapper.GetVertexCount();
 
-		SparsePtr<Vector3f> normals = mapper.GetComponentPtr<Vector3f>(VertexComponent_Normal);
-		SparsePtr<Vector3f> positions = mapper.GetComponentPtr<Vector3f>(VertexComponent_Position);
+		SparsePtr<const Vector3f> normals = mapper.GetComponentPtr<const Vector3f>(VertexComponent_Normal);
+		SparsePtr<const Vector3f> positions = mapper.GetComponentPtr<const Vector3f>(VertexComponent_Position);
 		SparsePtr<Vector3f> tangents = mapper.GetComponentPtr<Vector3f>(VertexComponent_Tangent);
-		SparsePtr<Vector2f> texCoords = mapper.GetComponentPtr<Vector2f>(VertexComponent_TexCoord);
+		SparsePtr<const Vector2f> texCoords = mapper.GetComponentPtr<const Vector2f>(VertexComponent_TexCoord);
 		if (!normals || !positions || !tangents || !texCoords)
 			return;
 
-		TriangleIterator iterator(this);
-		do
+		IndexMapper indexMapper(this, BufferAccess_ReadOnly);
+
+		// The tangents of the triangles sharing a vertex are averaged, then made orthogonal to its normal
+		std::array<SparsePtr<Vector3f>, 1> outputs = {tangents};
+		AccumulateTriangles(indexMapper, m_primitiveMode, vertexCount, outputs, [&] (const UInt32 indices[3], std::array<Vector3f, 1>& values)
 		{
-			Vector3f pos0 = positions[iterator[0]];
-			Vector2f uv0 = texCoords[iterator[0]];
-			Vector2f uv1 = texCoords[iterator[1]];
-			Vector2f uv2 = texCoords[iterator[2]];
+			Vector3f pos0 = positions[indices[0]];
+			Vector2f uv0 = texCoords[indices[0]];
+			Vector2f uv1 = texCoords[indices[1]];
+			Vector2f uv2 = texCoords[indices[2]];
 
 			Vector3f dv[2];
-			dv[0] = positions[iterator[1]] - pos0;
-			dv[1] = positions[iterator[2]] - pos0;
+			dv[0] = positions[indices[1]] - pos0;
+			dv[1] = positions[indices[2]] - pos0;
 
 			float ds[2];
 			ds[0] = uv1.x - uv0.x;
 			ds[1] = uv2.x - uv0.x;
 
-			Vector3f ppt;
+			Vector3f& ppt = values[0];
 			ppt.x = ds[0]*dv[1].x - dv[0].x*ds[1];
 			ppt.y = ds[0]*dv[1].y - dv[0].y*ds[1];
 			ppt.z = ds[0]*dv[1].z - dv[0].z*ds[1];
 			ppt.Normalize();
+		},
+		[&] (UInt32 vertex, std::array<Vector3f, 1>& values)
+		{
+			Vector3f normal = normals[vertex];
+			float d = values[0].DotProduct(normal);
 
-			for (unsigned int i = 0; i < 3; ++i)
-			{
-				Vector3f normal = normals[iterator[i]];
-				float d = ppt.DotProduct(normal);
-
-				tangents[iterator[i]] = ppt - (d * normal);
-			}
-		}
-		while (iterator.Advance());
+			values[0] -= d * normal;
+			values[0].Normalize();
+		});
 	}
 
 	const Mesh* SubMesh::GetParent() const
@@ -6,6 +6,7 @@
 #include <Nazara/Core/CallOnExit.hpp>
 #include <Nazara/Core/Core.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Utility/Animation.hpp>
 #include <Nazara/Utility/Buffer.hpp>
 #include <Nazara/Utility/Config.hpp>
@@ -16,10 +17,13 @@
 #include <Nazara/Utility/Skeleton.hpp>
 #include <Nazara/Utility/VertexDeclaration.hpp>
 #include <Nazara/Utility/Formats/DDSLoader.hpp>
+#include <Nazara/Utility/Formats/DDSSaver.hpp>
 #include <Nazara/Utility/Formats/FreeTypeLoader.hpp>
 #include <Nazara/Utility/Formats/MD2Loader.hpp>
 #include <Nazara/Utility/Formats/MD5AnimLoader.hpp>
 #include <Nazara/Utility/Formats/MD5MeshLoader.hpp>
+#include <Nazara/Utility/Formats/NMeshLoader.hpp>
+#include <Nazara/Utility/Formats/NMeshSaver.hpp>
 #include <Nazara/Utility/Formats/OBJLoader.hpp>
 #include <Nazara/Utility/Formats/OBJSaver.hpp>
 #include <Nazara/Utility/Formats/PCXLoader.hpp>
@@ -51,6 +55,8 @@ namespace Nz
 			return true; // Already initialized
 		}
 
+		Profiler::Scope profilerScope("Utility::Initialize");
+
 		// Initialisation of dependencies
 		if (!Core::Initialize())
 		{
@@ -120,6 +126,7 @@ namespace Nz
 
 		// Image
 		Loaders::RegisterDDSLoader(); // DDS Loader (DirectX format)
+		Loaders::RegisterDDSSaver();  // DDS Saver (DirectX format)
 		Loaders::RegisterSTBLoader(); // Generic loader (STB)
 		Loaders::RegisterSTBSaver();  // Generic saver (STB)
 
@@ -131,6 +138,10 @@ namespace Nz
 		Loaders::RegisterOBJLoader();
 		Loaders::RegisterOBJSaver();
 
+		// Mesh (cooked)
+		Loaders::RegisterNMeshLoader();
+		Loaders::RegisterNMeshSaver();
+
 		// Mesh
 		Loaders::RegisterMD2(); // Loader de fichiers .md2 (v8)
 		Loaders::RegisterMD5Mesh(); // Loader de fichiers .md5mesh (v10)
@@ -164,10 +175,14 @@ namespace Nz
 		// Libération du module
 		s_moduleReferenceCounter = 0;
 
+		Loaders::UnregisterDDSLoader();
+		Loaders::UnregisterDDSSaver();
 		Loaders::UnregisterFreeType();
 		Loaders::UnregisterMD2();
 		Loaders::UnregisterMD5Anim();
 		Loaders::UnregisterMD5Mesh();
+		Loaders::UnregisterNMeshLoader();
+		Loaders::UnregisterNMeshSaver();
 		Loaders::UnregisterOBJLoader();
 		Loaders::UnregisterOBJSaver();
 		Loaders::UnregisterPCX();
@@ -204,10 +219,14 @@ namespace Nz
 		2, // ComponentType_Int2
 		3, // ComponentType_Int3
 		4, // ComponentType_Int4
-		4  // ComponentType_Quaternion
+		4, // ComponentType_Quaternion
+		2, // ComponentType_Half2
+		4, // ComponentType_Half4
+		4, // ComponentType_PackedNormal
+		2  // ComponentType_UShortNorm2
 	};
 
-	static_assert(ComponentType_Max+1 == 14, "Component count array is incomplete");
+	static_assert(ComponentType_Max+1 == 18, "Component count array is incomplete");
 
 	std::size_t Utility::ComponentStride[ComponentType_Max+1] =
 	{
@@ -224,10 +243,14 @@ namespace Nz
 		2*sizeof(UInt32), // ComponentType_Int2
 		3*sizeof(UInt32), // ComponentType_Int3
 		4*sizeof(UInt32), // ComponentType_Int4
-		4*sizeof(float)     // ComponentType_Quaternion
+		4*sizeof(float),    // ComponentType_Quaternion
+		2*sizeof(UInt16), // ComponentType_Half2
+		4*sizeof(UInt16), // ComponentType_Half4
+		1*sizeof(UInt32), // ComponentType_PackedNormal
+		2*sizeof(UInt16)  // ComponentType_UShortNorm2
 	};
 
-	static_assert(ComponentType_Max+1 == 14, "Component stride array is incomplete");
+	static_assert(ComponentType_Max+1 == 18, "Component stride array is incomplete");
 
 	unsigned int Utility::s_moduleReferenceCounter = 0;
 }
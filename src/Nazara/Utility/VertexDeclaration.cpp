@@ -167,10 +167,14 @@ namespace Nz
 			case ComponentType_Float2:
 			case ComponentType_Float3:
 			case ComponentType_Float4:
+			case ComponentType_Half2:
+			case ComponentType_Half4:
 			case ComponentType_Int1:
 			case ComponentType_Int2:
 			case ComponentType_Int3:
 			case ComponentType_Int4:
+			case ComponentType_PackedNormal:
+			case ComponentType_UShortNorm2:
 				return true;
 
 			case ComponentType_Quaternion:
@@ -261,6 +265,15 @@ namespace Nz
 
 			NazaraAssert(declaration->GetStride() == sizeof(VertexStruct_XYZ_Normal_UV_Tangent), "Invalid stride for declaration VertexLayout_XYZ_Normal_UV_Tangent");
 
+			// VertexLayout_XYZ_Normal_UV_Tangent_Packed : VertexStruct_XYZ_Normal_UV_Tangent_Packed
+			declaration = &s_declarations[VertexLayout_XYZ_Normal_UV_Tangent_Packed];
+			declaration->EnableComponent(VertexComponent_Position, ComponentType_Float3,       NazaraOffsetOf(VertexStruct_XYZ_Normal_UV_Tangent_Packed, position));
+			declaration->EnableComponent(VertexComponent_Normal,   ComponentType_PackedNormal, NazaraOffsetOf(VertexStruct_XYZ_Normal_UV_Tangent_Packed, normal));
+			declaration->EnableComponent(VertexComponent_TexCoord, ComponentType_Half2,        NazaraOffsetOf(VertexStruct_XYZ_Normal_UV_Tangent_Packed, uv));
+			declaration->EnableComponent(VertexComponent_Tangent,  ComponentType_PackedNormal, NazaraOffsetOf(VertexStruct_XYZ_Normal_UV_Tangent_Packed, tangent));
+
+			NazaraAssert(declaration->GetStride() == sizeof(VertexStruct_XYZ_Normal_UV_Tangent_Packed), "Invalid stride for declaration VertexLayout_XYZ_Normal_UV_Tangent_Packed");
+
 			// VertexLayout_XYZ_Normal_UV_Tangent_Skinning : VertexStruct_XYZ_Normal_UV_Tangent_Skinning
 			declaration = &s_declarations[VertexLayout_XYZ_Normal_UV_Tangent_Skinning];
 			declaration->EnableComponent(VertexComponent_Position,  ComponentType_Float3, NazaraOffsetOf(VertexStruct_XYZ_Normal_UV_Tangent_Skinning, position));
@@ -0,0 +1,26 @@
+#include "Benchmark.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+	std::vector<BenchmarkCase>& GetRegisteredCases()
+	{
+		// Function-local so registrars of every translation unit find it constructed
+		static std::vector<BenchmarkCase> cases;
+		return cases;
+	}
+}
+
+BenchmarkRegistrar::BenchmarkRegistrar(const char* name, BenchmarkFunction function)
+{
+	GetRegisteredCases().push_back({ name, function });
+}
+
+std::vector<BenchmarkCase> GetBenchmarkCases()
+{
+	std::vector<BenchmarkCase> cases = GetRegisteredCases();
+	std::sort(cases.begin(), cases.end(), [] (const BenchmarkCase& lhs, const BenchmarkCase& rhs) { return std::strcmp(lhs.name, rhs.name) < 0; });
+
+	return cases;
+}
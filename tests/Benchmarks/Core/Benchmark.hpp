@@ -0,0 +1,76 @@
+#pragma once
+
+#ifndef NAZARA_BENCHMARKS_CORE_BENCHMARK_HPP
+#define NAZARA_BENCHMARKS_CORE_BENCHMARK_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+// Given to every benchmark case, which runs its measured code while KeepRunning returns true
+class BenchmarkState
+{
+	public:
+		using Clock = std::chrono::steady_clock;
+
+		inline BenchmarkState(std::size_t iterationCount);
+
+		inline Nz::UInt64 GetElapsedTime() const;
+		inline std::size_t GetIterationCount() const;
+		inline Nz::UInt64 GetProcessedBytes() const;
+		inline Nz::UInt64 GetProcessedItems() const;
+
+		inline bool KeepRunning();
+
+		// Work done by a single iteration, for throughput to be reported
+		inline void SetBytesPerIteration(Nz::UInt64 bytes);
+		inline void SetItemsPerIteration(Nz::UInt64 items);
+
+	private:
+		Clock::time_point m_endTime;
+		Clock::time_point m_startTime;
+		Nz::UInt64 m_bytesPerIteration;
+		Nz::UInt64 m_itemsPerIteration;
+		std::size_t m_iterationCount;
+		std::size_t m_remainingIterations;
+		bool m_started;
+};
+
+using BenchmarkFunction = void (*)(BenchmarkState& state);
+
+struct BenchmarkCase
+{
+	const char* name;
+	BenchmarkFunction function;
+};
+
+struct BenchmarkRegistrar
+{
+	BenchmarkRegistrar(const char* name, BenchmarkFunction function);
+};
+
+// Registered cases, sorted by name so the list stays the same whatever the link order
+std::vector<BenchmarkCase> GetBenchmarkCases();
+
+// Keeps the compiler from optimizing a value (and the computations leading to it) away
+template<typename T>
+inline void DoNotOptimize(const T& value)
+{
+	#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : : "r,m"(value) : "memory");
+	#else
+	static volatile const void* sink;
+	sink = &value;
+	std::atomic_signal_fence(std::memory_order_seq_cst);
+	#endif
+}
+
+#define NazaraBenchmark(Group, Name) \
+	static void Group##_##Name(BenchmarkState& state); \
+	static BenchmarkRegistrar Group##_##Name##Registrar(#Group "/" #Name, Group##_##Name); \
+	static void Group##_##Name(BenchmarkState& state)
+
+#include "Benchmark.inl"
+
+#endif // NAZARA_BENCHMARKS_CORE_BENCHMARK_HPP
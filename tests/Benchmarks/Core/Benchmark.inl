@@ -0,0 +1,57 @@
+inline BenchmarkState::BenchmarkState(std::size_t iterationCount) :
+m_bytesPerIteration(0),
+m_itemsPerIteration(0),
+m_iterationCount(iterationCount),
+m_remainingIterations(iterationCount),
+m_started(false)
+{
+}
+
+inline Nz::UInt64 BenchmarkState::GetElapsedTime() const
+{
+	return static_cast<Nz::UInt64>(std::chrono::duration_cast<std::chrono::nanoseconds>(m_endTime - m_startTime).count());
+}
+
+inline std::size_t BenchmarkState::GetIterationCount() const
+{
+	return m_iterationCount;
+}
+
+inline Nz::UInt64 BenchmarkState::GetProcessedBytes() const
+{
+	return m_bytesPerIteration * m_iterationCount;
+}
+
+inline Nz::UInt64 BenchmarkState::GetProcessedItems() const
+{
+	return m_itemsPerIteration * m_iterationCount;
+}
+
+inline bool BenchmarkState::KeepRunning()
+{
+	if (m_remainingIterations > 0)
+	{
+		// Whatever the case prepared before its loop is not measured
+		if (!m_started)
+		{
+			m_started = true;
+			m_startTime = Clock::now();
+		}
+
+		--m_remainingIterations;
+		return true;
+	}
+
+	m_endTime = Clock::now();
+	return false;
+}
+
+inline void BenchmarkState::SetBytesPerIteration(Nz::UInt64 bytes)
+{
+	m_bytesPerIteration = bytes;
+}
+
+inline void BenchmarkState::SetItemsPerIteration(Nz::UInt64 items)
+{
+	m_itemsPerIteration = items;
+}
@@ -0,0 +1,194 @@
+#include "Benchmark.hpp"
+#include <Nazara/Core/Bitset.hpp>
+#include <Nazara/Core/MemoryPool.hpp>
+#include <Nazara/Core/NonAtomicRefCounted.hpp>
+#include <Nazara/Core/ObjectRef.hpp>
+#include <Nazara/Core/RefCounted.hpp>
+#include <Nazara/Core/Signal.hpp>
+#include <memory>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t BitCount = 64 * 1024;
+
+	struct AtomicObject : Nz::RefCounted
+	{
+		AtomicObject() :
+		RefCounted(false)
+		{
+		}
+
+		int value = 0;
+	};
+
+	struct NonAtomicObject : Nz::NonAtomicRefCounted
+	{
+		NonAtomicObject() :
+		NonAtomicRefCounted(false)
+		{
+		}
+
+		int value = 0;
+	};
+
+	struct PoolObject
+	{
+		float values[12];
+	};
+
+	Nz::Bitset<> MakeBitset(std::size_t stride)
+	{
+		Nz::Bitset<> bitset(BitCount, false);
+		for (std::size_t i = 0; i < BitCount; i += stride)
+			bitset.Set(i);
+
+		return bitset;
+	}
+
+	template<typename T>
+	void BenchmarkObjectRefCopy(BenchmarkState& state)
+	{
+		Nz::ObjectRef<T> object = new T;
+
+		while (state.KeepRunning())
+		{
+			Nz::ObjectRef<T> copy(object);
+			DoNotOptimize(copy);
+		}
+	}
+}
+
+NazaraBenchmark(Bitset, Count)
+{
+	Nz::Bitset<> bitset = MakeBitset(3);
+
+	state.SetItemsPerIteration(BitCount);
+
+	while (state.KeepRunning())
+		DoNotOptimize(bitset.Count());
+}
+
+NazaraBenchmark(Bitset, FindDense)
+{
+	Nz::Bitset<> bitset = MakeBitset(3);
+
+	state.SetItemsPerIteration(BitCount);
+
+	while (state.KeepRunning())
+	{
+		std::size_t sum = 0;
+		for (std::size_t bit = bitset.FindFirst(); bit != bitset.npos; bit = bitset.FindNext(bit))
+			sum += bit;
+
+		DoNotOptimize(sum);
+	}
+}
+
+NazaraBenchmark(Bitset, FindSparse)
+{
+	Nz::Bitset<> bitset = MakeBitset(1000);
+
+	state.SetItemsPerIteration(BitCount);
+
+	while (state.KeepRunning())
+	{
+		std::size_t sum = 0;
+		for (std::size_t bit = bitset.FindFirst(); bit != bitset.npos; bit = bitset.FindNext(bit))
+			sum += bit;
+
+		DoNotOptimize(sum);
+	}
+}
+
+NazaraBenchmark(Bitset, PerformsAND)
+{
+	Nz::Bitset<> first = MakeBitset(3);
+	Nz::Bitset<> second = MakeBitset(5);
+	Nz::Bitset<> result;
+
+	state.SetItemsPerIteration(BitCount);
+
+	while (state.KeepRunning())
+	{
+		result.PerformsAND(first, second);
+		DoNotOptimize(result);
+	}
+}
+
+NazaraBenchmark(MemoryPool, AllocateFree)
+{
+	Nz::MemoryPool pool(sizeof(PoolObject), 1024);
+	std::vector<PoolObject*> objects(256);
+
+	state.SetItemsPerIteration(objects.size());
+
+	while (state.KeepRunning())
+	{
+		for (PoolObject*& object : objects)
+			object = pool.New<PoolObject>();
+
+		DoNotOptimize(objects);
+
+		for (PoolObject* object : objects)
+			pool.Delete(object);
+	}
+}
+
+NazaraBenchmark(MemoryPool, NewDeleteBaseline)
+{
+	std::vector<PoolObject*> objects(256);
+
+	state.SetItemsPerIteration(objects.size());
+
+	while (state.KeepRunning())
+	{
+		for (PoolObject*& object : objects)
+			object = new PoolObject;
+
+		DoNotOptimize(objects);
+
+		for (PoolObject* object : objects)
+			delete object;
+	}
+}
+
+NazaraBenchmark(ObjectRef, CopyAtomic)
+{
+	BenchmarkObjectRefCopy<AtomicObject>(state);
+}
+
+NazaraBenchmark(ObjectRef, CopyNonAtomic)
+{
+	BenchmarkObjectRefCopy<NonAtomicObject>(state);
+}
+
+NazaraBenchmark(Signal, Dispatch1)
+{
+	Nz::Signal<int> signal;
+
+	int sum = 0;
+	auto connection = signal.Connect([&sum] (int value) { sum += value; });
+
+	while (state.KeepRunning())
+		signal(1);
+
+	DoNotOptimize(sum);
+}
+
+NazaraBenchmark(Signal, Dispatch8)
+{
+	Nz::Signal<int> signal;
+
+	int sum = 0;
+	std::vector<Nz::Signal<int>::Connection> connections;
+	for (unsigned int i = 0; i < 8; ++i)
+		connections.emplace_back(signal.Connect([&sum] (int value) { sum += value; }));
+
+	state.SetItemsPerIteration(connections.size());
+
+	while (state.KeepRunning())
+		signal(1);
+
+	DoNotOptimize(sum);
+}
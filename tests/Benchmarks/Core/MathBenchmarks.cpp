@@ -0,0 +1,171 @@
+#include "Benchmark.hpp"
+#include <Nazara/Math/EulerAngles.hpp>
+#include <Nazara/Math/Matrix4.hpp>
+#include <Nazara/Math/Quaternion.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t BatchSize = 1024;
+
+	Nz::Matrix4f MakeMatrix(std::size_t i)
+	{
+		float value = static_cast<float>(i);
+		return Nz::Matrix4f::Transform(Nz::Vector3f(value, value * 0.5f, -value), Nz::EulerAnglesf(value, value * 2.f, value * 3.f), Nz::Vector3f(1.f + value * 0.01f));
+	}
+
+	Nz::Quaternionf MakeQuaternion(std::size_t i)
+	{
+		float value = static_cast<float>(i);
+		return Nz::EulerAnglesf(value, value * 2.f, value * 3.f);
+	}
+}
+
+NazaraBenchmark(Matrix4, Concatenate)
+{
+	Nz::Matrix4f left = MakeMatrix(1);
+	Nz::Matrix4f right = MakeMatrix(2);
+
+	while (state.KeepRunning())
+	{
+		DoNotOptimize(left);
+		DoNotOptimize(Nz::Matrix4f::Concatenate(left, right));
+	}
+}
+
+NazaraBenchmark(Matrix4, ConcatenateAffine)
+{
+	Nz::Matrix4f left = MakeMatrix(1);
+	Nz::Matrix4f right = MakeMatrix(2);
+
+	while (state.KeepRunning())
+	{
+		DoNotOptimize(left);
+		DoNotOptimize(Nz::Matrix4f::ConcatenateAffine(left, right));
+	}
+}
+
+NazaraBenchmark(Matrix4, ConcatenateBatch)
+{
+	std::vector<Nz::Matrix4f> left(BatchSize);
+	std::vector<Nz::Matrix4f> right(BatchSize);
+	std::vector<Nz::Matrix4f> results(BatchSize);
+	for (std::size_t i = 0; i < BatchSize; ++i)
+	{
+		left[i] = MakeMatrix(i);
+		right[i] = MakeMatrix(i + 1);
+	}
+
+	state.SetItemsPerIteration(BatchSize);
+
+	while (state.KeepRunning())
+	{
+		Nz::Matrix4f::Concatenate(left.data(), right.data(), BatchSize, results.data());
+		DoNotOptimize(results);
+	}
+}
+
+NazaraBenchmark(Matrix4, Inverse)
+{
+	Nz::Matrix4f matrix = MakeMatrix(1);
+	Nz::Matrix4f inverse;
+
+	while (state.KeepRunning())
+	{
+		DoNotOptimize(matrix);
+		DoNotOptimize(matrix.GetInverse(&inverse));
+	}
+}
+
+NazaraBenchmark(Matrix4, InverseAffine)
+{
+	Nz::Matrix4f matrix = MakeMatrix(1);
+	Nz::Matrix4f inverse;
+
+	while (state.KeepRunning())
+	{
+		DoNotOptimize(matrix);
+		DoNotOptimize(matrix.GetInverseAffine(&inverse));
+	}
+}
+
+NazaraBenchmark(Matrix4, TransformBatch)
+{
+	Nz::Matrix4f matrix = MakeMatrix(1);
+	std::vector<Nz::Vector3f> vectors(BatchSize);
+	std::vector<Nz::Vector3f> results(BatchSize);
+	for (std::size_t i = 0; i < BatchSize; ++i)
+		vectors[i] = Nz::Vector3f(static_cast<float>(i));
+
+	state.SetItemsPerIteration(BatchSize);
+
+	while (state.KeepRunning())
+	{
+		matrix.Transform(vectors.data(), BatchSize, results.data());
+		DoNotOptimize(results);
+	}
+}
+
+NazaraBenchmark(Matrix4, TransformVector)
+{
+	Nz::Matrix4f matrix = MakeMatrix(1);
+	Nz::Vector3f vector(1.f, 2.f, 3.f);
+
+	while (state.KeepRunning())
+	{
+		DoNotOptimize(vector);
+		DoNotOptimize(matrix.Transform(vector));
+	}
+}
+
+NazaraBenchmark(Quaternion, Multiply)
+{
+	Nz::Quaternionf left = MakeQuaternion(1);
+	Nz::Quaternionf right = MakeQuaternion(2);
+
+	while (state.KeepRunning())
+	{
+		DoNotOptimize(left);
+		DoNotOptimize(left * right);
+	}
+}
+
+NazaraBenchmark(Quaternion, RotateVector)
+{
+	Nz::Quaternionf rotation = MakeQuaternion(1);
+	Nz::Vector3f vector(1.f, 2.f, 3.f);
+
+	while (state.KeepRunning())
+	{
+		DoNotOptimize(vector);
+		DoNotOptimize(rotation * vector);
+	}
+}
+
+NazaraBenchmark(Quaternion, Slerp)
+{
+	Nz::Quaternionf from = MakeQuaternion(1);
+	Nz::Quaternionf to = MakeQuaternion(2);
+
+	float interpolation = 0.f;
+	while (state.KeepRunning())
+	{
+		DoNotOptimize(Nz::Quaternionf::Slerp(from, to, interpolation));
+
+		interpolation += 0.001f;
+		if (interpolation > 1.f)
+			interpolation = 0.f;
+	}
+}
+
+NazaraBenchmark(Quaternion, ToMatrix)
+{
+	Nz::Quaternionf rotation = MakeQuaternion(1);
+
+	while (state.KeepRunning())
+	{
+		DoNotOptimize(rotation);
+		DoNotOptimize(Nz::Matrix4f::Rotate(rotation));
+	}
+}
@@ -0,0 +1,57 @@
+#include "Benchmark.hpp"
+#include <Nazara/Utility/PixelFormat.hpp>
+#include <vector>
+
+namespace
+{
+	constexpr unsigned int ImageSize = 256;
+
+	void BenchmarkConvert(BenchmarkState& state, Nz::PixelFormatType srcFormat, Nz::PixelFormatType dstFormat)
+	{
+		std::vector<Nz::UInt8> source(Nz::PixelFormat::ComputeSize(srcFormat, ImageSize, ImageSize, 1));
+		std::vector<Nz::UInt8> destination(Nz::PixelFormat::ComputeSize(dstFormat, ImageSize, ImageSize, 1));
+		for (std::size_t i = 0; i < source.size(); ++i)
+			source[i] = static_cast<Nz::UInt8>(i * 13);
+
+		// Float formats are filled with small integers, rather than with garbage
+		if (srcFormat == Nz::PixelFormatType_RGBA32F)
+		{
+			float* values = reinterpret_cast<float*>(source.data());
+			for (std::size_t i = 0; i < source.size() / sizeof(float); ++i)
+				values[i] = static_cast<float>(i % 256) / 255.f;
+		}
+
+		state.SetItemsPerIteration(ImageSize * ImageSize);
+
+		while (state.KeepRunning())
+		{
+			Nz::PixelFormat::Convert(srcFormat, dstFormat, source.data(), source.data() + source.size(), destination.data());
+			DoNotOptimize(destination);
+		}
+	}
+}
+
+NazaraBenchmark(PixelFormat, ConvertBGRA8ToRGBA8)
+{
+	BenchmarkConvert(state, Nz::PixelFormatType_BGRA8, Nz::PixelFormatType_RGBA8);
+}
+
+NazaraBenchmark(PixelFormat, ConvertRGB8ToRGBA8)
+{
+	BenchmarkConvert(state, Nz::PixelFormatType_RGB8, Nz::PixelFormatType_RGBA8);
+}
+
+NazaraBenchmark(PixelFormat, ConvertRGBA8ToL8)
+{
+	BenchmarkConvert(state, Nz::PixelFormatType_RGBA8, Nz::PixelFormatType_L8);
+}
+
+NazaraBenchmark(PixelFormat, ConvertRGBA8ToRGBA32F)
+{
+	BenchmarkConvert(state, Nz::PixelFormatType_RGBA8, Nz::PixelFormatType_RGBA32F);
+}
+
+NazaraBenchmark(PixelFormat, ConvertRGBA32FToRGBA8)
+{
+	BenchmarkConvert(state, Nz::PixelFormatType_RGBA32F, Nz::PixelFormatType_RGBA8);
+}
@@ -0,0 +1,179 @@
+#include "Benchmark.hpp"
+#include <Nazara/Core/AbstractHash.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/ByteStream.hpp>
+#include <Nazara/Core/CompressedStream.hpp>
+#include <Nazara/Core/MemoryStream.hpp>
+#include <Nazara/Core/String.hpp>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t HashedSize = 4096;
+	constexpr std::size_t SerializedRecordCount = 256;
+
+	void BenchmarkHash(BenchmarkState& state, Nz::HashType type)
+	{
+		std::unique_ptr<Nz::AbstractHash> hash = Nz::AbstractHash::Get(type);
+
+		std::vector<Nz::UInt8> data(HashedSize);
+		for (std::size_t i = 0; i < data.size(); ++i)
+			data[i] = static_cast<Nz::UInt8>(i * 31 + 7);
+
+		state.SetBytesPerIteration(data.size());
+
+		while (state.KeepRunning())
+		{
+			hash->Begin();
+			hash->Append(data.data(), data.size());
+			DoNotOptimize(hash->End());
+		}
+	}
+}
+
+NazaraBenchmark(ByteStream, Read)
+{
+	Nz::ByteArray buffer;
+	{
+		Nz::ByteStream stream(&buffer);
+		for (std::size_t i = 0; i < SerializedRecordCount; ++i)
+			stream << static_cast<Nz::UInt32>(i) << static_cast<float>(i) << static_cast<Nz::Int64>(i) << Nz::String("record");
+	}
+
+	state.SetBytesPerIteration(buffer.GetSize());
+
+	while (state.KeepRunning())
+	{
+		Nz::ByteStream stream(&buffer);
+
+		Nz::UInt32 integer;
+		float floatingPoint;
+		Nz::Int64 bigInteger;
+		Nz::String string;
+		for (std::size_t i = 0; i < SerializedRecordCount; ++i)
+			stream >> integer >> floatingPoint >> bigInteger >> string;
+
+		DoNotOptimize(string);
+	}
+}
+
+NazaraBenchmark(ByteStream, Write)
+{
+	Nz::ByteArray buffer;
+	Nz::String string("record");
+
+	while (state.KeepRunning())
+	{
+		buffer.Clear();
+
+		Nz::ByteStream stream(&buffer);
+		for (std::size_t i = 0; i < SerializedRecordCount; ++i)
+			stream << static_cast<Nz::UInt32>(i) << static_cast<float>(i) << static_cast<Nz::Int64>(i) << string;
+
+		DoNotOptimize(buffer);
+	}
+
+	state.SetBytesPerIteration(buffer.GetSize());
+}
+
+NazaraBenchmark(CompressedStream, Read)
+{
+	Nz::ByteArray buffer;
+	std::size_t uncompressedSize;
+	{
+		Nz::MemoryStream memoryStream(&buffer, Nz::OpenMode_WriteOnly);
+		Nz::CompressedStream compressedStream(&memoryStream, Nz::OpenMode_WriteOnly);
+
+		Nz::ByteStream stream(&compressedStream);
+		for (std::size_t i = 0; i < SerializedRecordCount * 64; ++i)
+			stream << static_cast<Nz::UInt32>(i) << static_cast<float>(i) << static_cast<Nz::Int64>(i) << Nz::String("record");
+
+		uncompressedSize = static_cast<std::size_t>(compressedStream.GetSize());
+	}
+
+	std::vector<Nz::UInt8> data(uncompressedSize);
+	state.SetBytesPerIteration(uncompressedSize);
+
+	while (state.KeepRunning())
+	{
+		Nz::MemoryStream memoryStream(&buffer, Nz::OpenMode_ReadOnly);
+		Nz::CompressedStream compressedStream(&memoryStream, Nz::OpenMode_ReadOnly);
+
+		DoNotOptimize(compressedStream.Read(data.data(), data.size()));
+	}
+}
+
+NazaraBenchmark(CompressedStream, Write)
+{
+	Nz::ByteArray records;
+	{
+		Nz::ByteStream stream(&records);
+		for (std::size_t i = 0; i < SerializedRecordCount * 64; ++i)
+			stream << static_cast<Nz::UInt32>(i) << static_cast<float>(i) << static_cast<Nz::Int64>(i) << Nz::String("record");
+	}
+
+	Nz::ByteArray buffer;
+	state.SetBytesPerIteration(records.GetSize());
+
+	while (state.KeepRunning())
+	{
+		buffer.Clear();
+
+		Nz::MemoryStream memoryStream(&buffer, Nz::OpenMode_WriteOnly);
+		Nz::CompressedStream compressedStream(&memoryStream, Nz::OpenMode_WriteOnly);
+		compressedStream.Write(records.GetConstBuffer(), records.GetSize());
+		compressedStream.Close();
+
+		DoNotOptimize(buffer);
+	}
+}
+
+NazaraBenchmark(Hash, CRC32)
+{
+	BenchmarkHash(state, Nz::HashType_CRC32);
+}
+
+NazaraBenchmark(Hash, CRC32C)
+{
+	BenchmarkHash(state, Nz::HashType_CRC32C);
+}
+
+NazaraBenchmark(Hash, CRC64)
+{
+	BenchmarkHash(state, Nz::HashType_CRC64);
+}
+
+NazaraBenchmark(Hash, Fletcher16)
+{
+	BenchmarkHash(state, Nz::HashType_Fletcher16);
+}
+
+NazaraBenchmark(Hash, MD5)
+{
+	BenchmarkHash(state, Nz::HashType_MD5);
+}
+
+NazaraBenchmark(Hash, SHA1)
+{
+	BenchmarkHash(state, Nz::HashType_SHA1);
+}
+
+NazaraBenchmark(Hash, SHA256)
+{
+	BenchmarkHash(state, Nz::HashType_SHA256);
+}
+
+NazaraBenchmark(Hash, SHA512)
+{
+	BenchmarkHash(state, Nz::HashType_SHA512);
+}
+
+NazaraBenchmark(Hash, Whirlpool)
+{
+	BenchmarkHash(state, Nz::HashType_Whirlpool);
+}
+
+NazaraBenchmark(Hash, XXH3)
+{
+	BenchmarkHash(state, Nz::HashType_XXH3);
+}
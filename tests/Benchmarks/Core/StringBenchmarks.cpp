@@ -0,0 +1,117 @@
+#include "Benchmark.hpp"
+#include <Nazara/Core/String.hpp>
+#include <vector>
+
+namespace
+{
+	const char* Sentence = "The quick brown fox jumps over the lazy dog while the engine keeps on counting its frames";
+
+	Nz::String MakeText(std::size_t repetitionCount)
+	{
+		Nz::String text;
+		for (std::size_t i = 0; i < repetitionCount; ++i)
+		{
+			text += Sentence;
+			text += ' ';
+		}
+
+		return text;
+	}
+}
+
+NazaraBenchmark(String, Append)
+{
+	state.SetItemsPerIteration(64);
+
+	while (state.KeepRunning())
+	{
+		Nz::String string;
+		for (unsigned int i = 0; i < 64; ++i)
+			string.Append("word ");
+
+		DoNotOptimize(string);
+	}
+}
+
+NazaraBenchmark(String, Compare)
+{
+	Nz::String first = MakeText(4);
+	Nz::String second = first;
+	second[second.GetSize() - 2] = '!';
+
+	while (state.KeepRunning())
+		DoNotOptimize(Nz::String::Compare(first, second));
+}
+
+NazaraBenchmark(String, Copy)
+{
+	Nz::String source = MakeText(4);
+
+	while (state.KeepRunning())
+	{
+		Nz::String copy(source);
+		DoNotOptimize(copy);
+	}
+}
+
+NazaraBenchmark(String, CopyAndModify)
+{
+	Nz::String source = MakeText(4);
+
+	// Writing to a shared string makes it copy its buffer first
+	while (state.KeepRunning())
+	{
+		Nz::String copy(source);
+		copy[0] = 't';
+		DoNotOptimize(copy);
+	}
+}
+
+NazaraBenchmark(String, Find)
+{
+	Nz::String text = MakeText(64);
+	text += "needle";
+
+	state.SetBytesPerIteration(text.GetSize());
+
+	while (state.KeepRunning())
+		DoNotOptimize(text.Find("needle"));
+}
+
+NazaraBenchmark(String, Number)
+{
+	state.SetItemsPerIteration(2);
+
+	unsigned int value = 123456789;
+	while (state.KeepRunning())
+	{
+		DoNotOptimize(Nz::String::Number(value));
+		DoNotOptimize(Nz::String::Number(static_cast<float>(value) * 0.001f));
+
+		++value;
+	}
+}
+
+NazaraBenchmark(String, Split)
+{
+	Nz::String text = MakeText(16);
+	std::vector<Nz::String> words;
+
+	state.SetBytesPerIteration(text.GetSize());
+
+	while (state.KeepRunning())
+	{
+		words.clear();
+		DoNotOptimize(text.Split(words, ' '));
+	}
+}
+
+NazaraBenchmark(String, ToLower)
+{
+	Nz::String text = MakeText(16).ToUpper();
+
+	state.SetBytesPerIteration(text.GetSize());
+
+	while (state.KeepRunning())
+		DoNotOptimize(text.ToLower());
+}
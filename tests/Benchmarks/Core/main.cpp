@@ -0,0 +1,221 @@
+#include "Benchmark.hpp"
+#include <Nazara/Core/AbstractLogger.hpp>
+#include <Nazara/Core/HardwareInfo.hpp>
+#include <Nazara/Core/Initializer.hpp>
+#include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/String.hpp>
+#include <Nazara/Utility/Utility.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+	struct CaseResult
+	{
+		double bytesPerSecond = 0.0;
+		double itemsPerSecond = 0.0;
+		double nsPerIteration = 0.0;
+		std::size_t iterationCount = 0;
+	};
+
+	void PrintUsage(const char* program)
+	{
+		std::printf("Usage: %s [options]\n", program);
+		std::printf("  --filter <text>      Only runs the cases whose name contains this text\n");
+		std::printf("  --format <text|json> Output format, json being meant for comparing runs (default: text)\n");
+		std::printf("  --list               Lists the cases without running them\n");
+		std::printf("  --min-time <ms>      Minimum duration of a measure, iterations being added until it is reached (default: 200)\n");
+		std::printf("  --repetitions <n>    Measures of every case, the fastest one being kept (default: 3)\n");
+	}
+
+	const char* GetSimdInstructionSets()
+	{
+		return ""
+		#ifdef NAZARA_SIMD_SSE2
+		" SSE2"
+		#endif
+		#ifdef NAZARA_SIMD_AVX
+		" AVX"
+		#endif
+		#ifdef NAZARA_SIMD_NEON
+		" NEON"
+		#endif
+		;
+	}
+
+	// Runs a case with more and more iterations, until it lasts long enough to be measured reliably
+	CaseResult RunCase(const BenchmarkCase& benchmarkCase, Nz::UInt64 minTime)
+	{
+		std::size_t iterationCount = 1;
+		for (;;)
+		{
+			BenchmarkState state(iterationCount);
+			benchmarkCase.function(state);
+
+			Nz::UInt64 elapsedTime = std::max<Nz::UInt64>(state.GetElapsedTime(), 1);
+			if (elapsedTime >= minTime || iterationCount >= 1000000000)
+			{
+				double seconds = elapsedTime / 1000000000.0;
+
+				CaseResult result;
+				result.bytesPerSecond = state.GetProcessedBytes() / seconds;
+				result.itemsPerSecond = state.GetProcessedItems() / seconds;
+				result.iterationCount = iterationCount;
+				result.nsPerIteration = static_cast<double>(elapsedTime) / iterationCount;
+
+				return result;
+			}
+
+			// Aims a bit over the minimum time, without growing more than tenfold from a possibly noisy measure
+			double multiplier = std::min(1.4 * minTime / elapsedTime, 10.0);
+			iterationCount = std::max(static_cast<std::size_t>(iterationCount * multiplier), iterationCount + 1);
+		}
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	const char* filter = nullptr;
+	bool json = false;
+	bool listOnly = false;
+	unsigned int minTimeMs = 200;
+	unsigned int repetitionCount = 3;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const char* option = argv[i];
+		if (std::strcmp(option, "--help") == 0)
+		{
+			PrintUsage(argv[0]);
+			return EXIT_SUCCESS;
+		}
+
+		if (std::strcmp(option, "--list") == 0)
+		{
+			listOnly = true;
+			continue;
+		}
+
+		if (i + 1 >= argc)
+		{
+			PrintUsage(argv[0]);
+			return EXIT_FAILURE;
+		}
+
+		const char* value = argv[++i];
+		bool valid = true;
+		if (std::strcmp(option, "--filter") == 0)
+			filter = value;
+		else if (std::strcmp(option, "--format") == 0)
+		{
+			if (std::strcmp(value, "json") == 0)
+				json = true;
+			else if (std::strcmp(value, "text") == 0)
+				json = false;
+			else
+				valid = false;
+		}
+		else if (std::strcmp(option, "--min-time") == 0)
+		{
+			minTimeMs = static_cast<unsigned int>(std::atoi(value));
+			valid = (minTimeMs > 0);
+		}
+		else if (std::strcmp(option, "--repetitions") == 0)
+		{
+			repetitionCount = static_cast<unsigned int>(std::atoi(value));
+			valid = (repetitionCount > 0);
+		}
+		else
+			valid = false;
+
+		if (!valid)
+		{
+			PrintUsage(argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	std::vector<BenchmarkCase> cases = GetBenchmarkCases();
+	if (filter)
+		cases.erase(std::remove_if(cases.begin(), cases.end(), [filter] (const BenchmarkCase& benchmarkCase) { return std::strstr(benchmarkCase.name, filter) == nullptr; }), cases.end());
+
+	if (listOnly)
+	{
+		for (const BenchmarkCase& benchmarkCase : cases)
+			std::printf("%s\n", benchmarkCase.name);
+
+		return EXIT_SUCCESS;
+	}
+
+	// Keeps the initialization messages out of the standard output, which may be parsed as JSON
+	Nz::Log::Enable(false);
+
+	// Pixel format conversions are registered by the Utility module
+	Nz::Initializer<Nz::Utility> utility;
+	if (!utility)
+	{
+		std::fprintf(stderr, "Failed to initialize Utility module\n");
+		return EXIT_FAILURE;
+	}
+
+	Nz::Log::GetLogger()->EnableStdReplication(false);
+	Nz::Log::Enable(true);
+
+	// The same binary is run on every architecture we ship on, results only make sense along with the processor and the instruction sets
+	Nz::String processor = Nz::HardwareInfo::GetProcessorBrandString();
+	if (json)
+	{
+		std::printf("{\n");
+		std::printf("\t\"engine\": \"%d.%d.%d\",\n", NAZARA_VERSION_MAJOR, NAZARA_VERSION_MINOR, NAZARA_VERSION_PATCH);
+		std::printf("\t\"processor\": \"%s\",\n", processor.Trimmed().GetConstBuffer());
+		std::printf("\t\"simd\": \"%s\",\n", Nz::String(GetSimdInstructionSets()).Trimmed().GetConstBuffer());
+		std::printf("\t\"results\": [");
+	}
+	else
+	{
+		std::printf("%s (SIMD:%s)\n", processor.Trimmed().GetConstBuffer(), GetSimdInstructionSets());
+		std::printf("%-36s %14s %14s %14s\n", "case", "ns/iteration", "iterations", "throughput");
+	}
+
+	bool firstResult = true;
+	for (const BenchmarkCase& benchmarkCase : cases)
+	{
+		// The fastest measure is the one least disturbed by the rest of the system
+		CaseResult bestResult;
+		for (unsigned int repetition = 0; repetition < repetitionCount; ++repetition)
+		{
+			CaseResult result = RunCase(benchmarkCase, minTimeMs * 1000000ULL);
+			if (repetition == 0 || result.nsPerIteration < bestResult.nsPerIteration)
+				bestResult = result;
+		}
+
+		if (json)
+		{
+			std::printf("%s\n\t\t{ \"case\": \"%s\", \"ns_per_iteration\": %.3f, \"iterations\": %zu, \"bytes_per_second\": %.0f, \"items_per_second\": %.0f }",
+			            (firstResult) ? "" : ",", benchmarkCase.name, bestResult.nsPerIteration, bestResult.iterationCount, bestResult.bytesPerSecond, bestResult.itemsPerSecond);
+		}
+		else
+		{
+			char throughput[32] = "";
+			if (bestResult.bytesPerSecond > 0.0)
+				std::snprintf(throughput, sizeof(throughput), "%.1f MB/s", bestResult.bytesPerSecond / (1024.0 * 1024.0));
+			else if (bestResult.itemsPerSecond > 0.0)
+				std::snprintf(throughput, sizeof(throughput), "%.1f M/s", bestResult.itemsPerSecond / 1000000.0);
+
+			std::printf("%-36s %14.2f %14zu %14s\n", benchmarkCase.name, bestResult.nsPerIteration, bestResult.iterationCount, throughput);
+		}
+
+		std::fflush(stdout);
+		firstResult = false;
+	}
+
+	if (json)
+		std::printf("\n\t]\n}\n");
+
+	// Uninitialization messages would follow the results otherwise
+	Nz::Log::Enable(false);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,117 @@
+#include "Benchmark.hpp"
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+	std::atomic<std::size_t> s_allocationCount(0);
+	bool s_firstResult = true;
+}
+
+// Replacing the global allocation functions counts allocations made by the engine libraries as well
+void* operator new(std::size_t size)
+{
+	s_allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+	void* ptr = std::malloc((size > 0) ? size : 1);
+	if (!ptr)
+		throw std::bad_alloc();
+
+	return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+	return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+std::size_t GetAllocationCount()
+{
+	return s_allocationCount.load(std::memory_order_relaxed);
+}
+
+void PrintHeader(OutputFormat format)
+{
+	switch (format)
+	{
+		case OutputFormat::Json:
+			// One object per run, the engine version allowing to compare runs across versions
+			std::printf("{\n\t\"engine\": \"%d.%d.%d\",\n\t\"results\": [", NAZARA_VERSION_MAJOR, NAZARA_VERSION_MINOR, NAZARA_VERSION_PATCH);
+			s_firstResult = true;
+			break;
+
+		case OutputFormat::Text:
+			std::printf("%-20s %9s %12s %12s %12s\n", "benchmark", "entities", "total (ms)", "ns/entity", "allocs/ent");
+			break;
+	}
+}
+
+void PrintResult(OutputFormat format, const char* name, const BenchmarkResult& result)
+{
+	double operationCount = static_cast<double>((result.operationCount > 0) ? result.operationCount : 1);
+	double nsPerEntity = result.elapsedTime / operationCount;
+	double allocationsPerEntity = result.allocationCount / operationCount;
+
+	switch (format)
+	{
+		case OutputFormat::Json:
+			std::printf("%s\n\t\t{ \"benchmark\": \"%s\", \"entities\": %zu, \"operations\": %zu, \"total_ns\": %llu, \"ns_per_entity\": %.3f, \"allocations\": %zu, \"allocations_per_entity\": %.3f }",
+			            (s_firstResult) ? "" : ",", name, result.entityCount, result.operationCount, static_cast<unsigned long long>(result.elapsedTime), nsPerEntity, result.allocationCount, allocationsPerEntity);
+
+			s_firstResult = false;
+			break;
+
+		case OutputFormat::Text:
+			std::printf("%-20s %9zu %12.3f %12.2f %12.3f\n", name, result.entityCount, result.elapsedTime / 1000000.0, nsPerEntity, allocationsPerEntity);
+			break;
+	}
+
+	std::fflush(stdout);
+}
+
+void PrintFooter(OutputFormat format)
+{
+	if (format == OutputFormat::Json)
+		std::printf("\n\t]\n}\n");
+}
+
+BenchmarkRecorder::BenchmarkRecorder(BenchmarkResult& result, std::size_t entityCount, std::size_t operationCount) :
+m_result(result)
+{
+	m_result.entityCount = entityCount;
+	m_result.operationCount = operationCount;
+}
+
+void BenchmarkRecorder::Start()
+{
+	m_allocationStart = GetAllocationCount();
+	m_startTime = Clock::now();
+}
+
+void BenchmarkRecorder::Stop()
+{
+	m_result.elapsedTime = static_cast<Nz::UInt64>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - m_startTime).count());
+	m_result.allocationCount = GetAllocationCount() - m_allocationStart;
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#ifndef NAZARA_BENCHMARKS_ECS_BENCHMARK_HPP
+#define NAZARA_BENCHMARKS_ECS_BENCHMARK_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <chrono>
+#include <string>
+#include <vector>
+
+enum class OutputFormat
+{
+	Json,
+	Text
+};
+
+struct BenchmarkResult
+{
+	std::size_t allocationCount = 0;
+	std::size_t entityCount = 0;
+	std::size_t operationCount = 0;    //< Operations measured (entities times updates for ticks), ns/entity is given per operation
+	Nz::UInt64 elapsedTime = 0;        //< Wall time, in nanoseconds
+};
+
+struct Benchmark
+{
+	const char* name;
+	bool (*run)(std::size_t entityCount, BenchmarkResult* result);
+	std::size_t maxEntityCount;        //< Larger worlds are skipped, as they would take minutes
+};
+
+// Counts every allocation made by the process, see the operator new replacement in Benchmark.cpp
+std::size_t GetAllocationCount();
+
+const std::vector<Benchmark>& GetBenchmarks();
+
+void PrintHeader(OutputFormat format);
+void PrintResult(OutputFormat format, const char* name, const BenchmarkResult& result);
+void PrintFooter(OutputFormat format);
+
+// Measures wall time and allocations between Start and Stop
+class BenchmarkRecorder
+{
+	public:
+		BenchmarkRecorder(BenchmarkResult& result, std::size_t entityCount, std::size_t operationCount);
+
+		void Start();
+		void Stop();
+
+	private:
+		using Clock = std::chrono::steady_clock;
+
+		BenchmarkResult& m_result;
+		Clock::time_point m_startTime;
+		std::size_t m_allocationStart;
+};
+
+#endif // NAZARA_BENCHMARKS_ECS_BENCHMARK_HPP
@@ -0,0 +1,278 @@
+#include "Benchmark.hpp"
+#include <NDK/Components/NodeComponent.hpp>
+#include <NDK/Components/PhysicsComponent3D.hpp>
+#include <NDK/Components/VelocityComponent.hpp>
+#include <NDK/System.hpp>
+#include <NDK/Systems/PhysicsSystem3D.hpp>
+#include <NDK/Systems/VelocitySystem.hpp>
+#include <NDK/World.hpp>
+#include <limits>
+
+namespace
+{
+	constexpr float TickTime = 1.f / 60.f;
+	constexpr std::size_t TickCount = 10;
+
+	// Systems only there for the world to dispatch entities to them, each instantiation being a different system type
+	template<unsigned int N>
+	class FilterSystem : public Ndk::System<FilterSystem<N>>
+	{
+		public:
+			FilterSystem()
+			{
+				this->template Requires<Ndk::NodeComponent>();
+				if (N % 2 == 1)
+					this->template Requires<Ndk::VelocityComponent>();
+			}
+
+			static Ndk::SystemIndex systemIndex;
+
+		private:
+			void OnUpdate(float /*elapsedTime*/) override
+			{
+			}
+	};
+
+	template<unsigned int N> Ndk::SystemIndex FilterSystem<N>::systemIndex;
+
+	template<unsigned int... N>
+	struct FilterSystems
+	{
+		static void Add(Ndk::World& world)
+		{
+			int dummy[] = { 0, (world.AddSystem<FilterSystem<N>>(), 0)... };
+			NazaraUnused(dummy);
+		}
+
+		static void Initialize()
+		{
+			static bool initialized = false;
+			if (!initialized)
+			{
+				int dummy[] = { 0, (Ndk::InitializeSystem<FilterSystem<N>>(), 0)... };
+				NazaraUnused(dummy);
+
+				initialized = true;
+			}
+		}
+	};
+
+	using SixteenFilterSystems = FilterSystems<0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15>;
+
+	Ndk::World::EntityVector CreateMovingEntities(Ndk::World& world, std::size_t entityCount)
+	{
+		Ndk::World::EntityVector entities = world.CreateEntities(static_cast<unsigned int>(entityCount));
+		for (std::size_t i = 0; i < entities.size(); ++i)
+		{
+			entities[i]->AddComponent<Ndk::NodeComponent>().SetPosition(static_cast<float>(i % 1000), static_cast<float>(i / 1000));
+			entities[i]->AddComponent<Ndk::VelocityComponent>(Nz::Vector3f::UnitX());
+		}
+
+		world.Refresh();
+		return entities;
+	}
+
+	bool RunCreateBenchmark(std::size_t entityCount, BenchmarkResult* result)
+	{
+		Ndk::World world(false);
+
+		BenchmarkRecorder recorder(*result, entityCount, entityCount);
+		recorder.Start();
+
+		Ndk::World::EntityVector entities = world.CreateEntities(static_cast<unsigned int>(entityCount));
+		world.Refresh();
+
+		recorder.Stop();
+
+		return entities.size() == entityCount;
+	}
+
+	bool RunKillBenchmark(std::size_t entityCount, BenchmarkResult* result)
+	{
+		Ndk::World world(false);
+		world.AddSystem<Ndk::VelocitySystem>();
+
+		Ndk::World::EntityVector entities = CreateMovingEntities(world, entityCount);
+
+		BenchmarkRecorder recorder(*result, entityCount, entityCount);
+		recorder.Start();
+
+		world.KillEntities(entities);
+		world.Refresh();
+
+		recorder.Stop();
+
+		return world.GetEntities().size() == 0;
+	}
+
+	bool RunCloneBenchmark(std::size_t entityCount, BenchmarkResult* result)
+	{
+		Ndk::World world(false);
+		world.AddSystem<Ndk::VelocitySystem>();
+
+		Ndk::EntityId modelId = CreateMovingEntities(world, 1).front()->GetId();
+
+		BenchmarkRecorder recorder(*result, entityCount, entityCount);
+		recorder.Start();
+
+		for (std::size_t i = 0; i < entityCount; ++i)
+			world.CloneEntity(modelId);
+
+		world.Refresh();
+
+		recorder.Stop();
+
+		return world.GetEntities().size() == entityCount + 1;
+	}
+
+	bool RunAddComponentBenchmark(std::size_t entityCount, BenchmarkResult* result)
+	{
+		Ndk::World world(false);
+		world.AddSystem<Ndk::VelocitySystem>();
+
+		Ndk::World::EntityVector entities = world.CreateEntities(static_cast<unsigned int>(entityCount));
+		for (const Ndk::EntityHandle& entity : entities)
+			entity->AddComponent<Ndk::NodeComponent>();
+
+		world.Refresh();
+
+		BenchmarkRecorder recorder(*result, entityCount, entityCount);
+		recorder.Start();
+
+		for (const Ndk::EntityHandle& entity : entities)
+			entity->AddComponent<Ndk::VelocityComponent>();
+
+		world.Refresh();
+
+		recorder.Stop();
+
+		return world.GetSystem<Ndk::VelocitySystem>().GetEntities().size() == entityCount;
+	}
+
+	bool RunRemoveComponentBenchmark(std::size_t entityCount, BenchmarkResult* result)
+	{
+		Ndk::World world(false);
+		world.AddSystem<Ndk::VelocitySystem>();
+
+		Ndk::World::EntityVector entities = CreateMovingEntities(world, entityCount);
+
+		BenchmarkRecorder recorder(*result, entityCount, entityCount);
+		recorder.Start();
+
+		for (const Ndk::EntityHandle& entity : entities)
+			entity->RemoveComponent<Ndk::VelocityComponent>();
+
+		world.Refresh();
+
+		recorder.Stop();
+
+		return world.GetSystem<Ndk::VelocitySystem>().GetEntities().size() == 0;
+	}
+
+	template<typename Systems>
+	bool RunRefreshBenchmark(std::size_t entityCount, BenchmarkResult* result)
+	{
+		Systems::Initialize();
+
+		Ndk::World world(false);
+		Systems::Add(world);
+
+		Ndk::World::EntityVector entities = CreateMovingEntities(world, entityCount);
+		for (const Ndk::EntityHandle& entity : entities)
+			entity->Invalidate();
+
+		BenchmarkRecorder recorder(*result, entityCount, entityCount);
+		recorder.Start();
+
+		world.Refresh();
+
+		recorder.Stop();
+
+		return world.GetSystem<FilterSystem<0>>().GetEntities().size() == entityCount;
+	}
+
+	bool RunIterationBenchmark(std::size_t entityCount, BenchmarkResult* result)
+	{
+		Ndk::World world(false);
+		CreateMovingEntities(world, entityCount);
+
+		BenchmarkRecorder recorder(*result, entityCount, entityCount * TickCount);
+		recorder.Start();
+
+		float sum = 0.f;
+		for (std::size_t tick = 0; tick < TickCount; ++tick)
+		{
+			for (const Ndk::EntityHandle& entity : world.GetEntities())
+				sum += entity->GetComponent<Ndk::VelocityComponent>().linearVelocity.x;
+		}
+
+		recorder.Stop();
+
+		return sum == static_cast<float>(entityCount * TickCount);
+	}
+
+	bool RunVelocityTickBenchmark(std::size_t entityCount, BenchmarkResult* result)
+	{
+		Ndk::World world(false);
+		world.AddSystem<Ndk::VelocitySystem>().SetMaximumUpdateRate(0.f);
+
+		CreateMovingEntities(world, entityCount);
+
+		BenchmarkRecorder recorder(*result, entityCount, entityCount * TickCount);
+		recorder.Start();
+
+		for (std::size_t tick = 0; tick < TickCount; ++tick)
+			world.Update(TickTime);
+
+		recorder.Stop();
+
+		return true;
+	}
+
+	bool RunPhysicsTickBenchmark(std::size_t entityCount, BenchmarkResult* result)
+	{
+		Ndk::World world(false);
+		world.AddSystem<Ndk::PhysicsSystem3D>().SetMaximumUpdateRate(0.f);
+
+		// Bodies are spread on a grid, without touching each other
+		Ndk::World::EntityVector entities = world.CreateEntities(static_cast<unsigned int>(entityCount));
+		for (std::size_t i = 0; i < entities.size(); ++i)
+		{
+			entities[i]->AddComponent<Ndk::NodeComponent>();
+
+			Ndk::PhysicsComponent3D& physics = entities[i]->AddComponent<Ndk::PhysicsComponent3D>();
+			physics.SetMass(1.f);
+			physics.SetPosition(Nz::Vector3f(static_cast<float>(i % 100) * 2.f, static_cast<float>(i / 10000) * 2.f, static_cast<float>((i / 100) % 100) * 2.f));
+		}
+
+		world.Refresh();
+
+		BenchmarkRecorder recorder(*result, entityCount, entityCount * TickCount);
+		recorder.Start();
+
+		for (std::size_t tick = 0; tick < TickCount; ++tick)
+			world.Update(TickTime);
+
+		recorder.Stop();
+
+		return true;
+	}
+}
+
+const std::vector<Benchmark>& GetBenchmarks()
+{
+	static std::vector<Benchmark> benchmarks = {
+		{ "create",             RunCreateBenchmark,                         std::numeric_limits<std::size_t>::max() },
+		{ "kill",               RunKillBenchmark,                           std::numeric_limits<std::size_t>::max() },
+		{ "clone",              RunCloneBenchmark,                          std::numeric_limits<std::size_t>::max() },
+		{ "add_component",      RunAddComponentBenchmark,                   std::numeric_limits<std::size_t>::max() },
+		{ "remove_component",   RunRemoveComponentBenchmark,                std::numeric_limits<std::size_t>::max() },
+		{ "refresh_1_system",   RunRefreshBenchmark<FilterSystems<0>>,      std::numeric_limits<std::size_t>::max() },
+		{ "refresh_16_systems", RunRefreshBenchmark<SixteenFilterSystems>,  std::numeric_limits<std::size_t>::max() },
+		{ "iterate",            RunIterationBenchmark,                      std::numeric_limits<std::size_t>::max() },
+		{ "velocity_tick",      RunVelocityTickBenchmark,                   std::numeric_limits<std::size_t>::max() },
+		{ "physics3d_tick",     RunPhysicsTickBenchmark,                    10000 } //< Newton crashes with a few tens of thousands of bodies in a world
+	};
+
+	return benchmarks;
+}
@@ -0,0 +1,148 @@
+#include "Benchmark.hpp"
+#include <Nazara/Core/AbstractLogger.hpp>
+#include <Nazara/Core/Initializer.hpp>
+#include <Nazara/Core/Log.hpp>
+#include <NDK/Sdk.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+	void PrintUsage(const char* program)
+	{
+		std::printf("Usage: %s [options]\n", program);
+		std::printf("  --benchmark <name>   Only runs this benchmark\n");
+		std::printf("  --counts <a,b,...>   Entity counts of the worlds (default: 1000,10000,100000,1000000)\n");
+		std::printf("  --format <text|json> Output format, json being meant for regression tracking (default: text)\n");
+		std::printf("  --repetitions <n>    Runs of every benchmark, the fastest one being kept (default: 3)\n");
+	}
+
+	bool ParseCounts(const char* value, std::vector<std::size_t>* counts)
+	{
+		counts->clear();
+
+		while (*value)
+		{
+			char* end;
+			unsigned long long count = std::strtoull(value, &end, 10);
+			if (end == value || count == 0)
+				return false;
+
+			counts->push_back(static_cast<std::size_t>(count));
+
+			value = end;
+			if (*value == ',')
+				++value;
+		}
+
+		return !counts->empty();
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	// Keeps the initialization messages out of the standard output, which may be parsed as JSON
+	Nz::Log::Enable(false);
+
+	Nz::Initializer<Ndk::Sdk> sdk;
+	if (!sdk)
+	{
+		std::fprintf(stderr, "Failed to initialize SDK\n");
+		return EXIT_FAILURE;
+	}
+
+	Nz::Log::GetLogger()->EnableStdReplication(false);
+	Nz::Log::Enable(true);
+
+	std::vector<std::size_t> entityCounts = { 1000, 10000, 100000, 1000000 };
+	const char* onlyBenchmark = nullptr;
+	OutputFormat format = OutputFormat::Text;
+	unsigned int repetitionCount = 3;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const char* option = argv[i];
+		if (std::strcmp(option, "--help") == 0)
+		{
+			PrintUsage(argv[0]);
+			return EXIT_SUCCESS;
+		}
+
+		if (i + 1 >= argc)
+		{
+			PrintUsage(argv[0]);
+			return EXIT_FAILURE;
+		}
+
+		const char* value = argv[++i];
+		bool valid = true;
+		if (std::strcmp(option, "--benchmark") == 0)
+			onlyBenchmark = value;
+		else if (std::strcmp(option, "--counts") == 0)
+			valid = ParseCounts(value, &entityCounts);
+		else if (std::strcmp(option, "--format") == 0)
+		{
+			if (std::strcmp(value, "json") == 0)
+				format = OutputFormat::Json;
+			else if (std::strcmp(value, "text") == 0)
+				format = OutputFormat::Text;
+			else
+				valid = false;
+		}
+		else if (std::strcmp(option, "--repetitions") == 0)
+		{
+			repetitionCount = static_cast<unsigned int>(std::atoi(value));
+			valid = (repetitionCount > 0);
+		}
+		else
+			valid = false;
+
+		if (!valid)
+		{
+			PrintUsage(argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	PrintHeader(format);
+
+	bool succeeded = true;
+	for (const Benchmark& benchmark : GetBenchmarks())
+	{
+		if (onlyBenchmark && std::strcmp(onlyBenchmark, benchmark.name) != 0)
+			continue;
+
+		for (std::size_t entityCount : entityCounts)
+		{
+			if (entityCount > benchmark.maxEntityCount)
+				continue;
+
+			// The fastest run is the one least disturbed by the rest of the system
+			BenchmarkResult bestResult;
+			for (unsigned int repetition = 0; repetition < repetitionCount; ++repetition)
+			{
+				BenchmarkResult result;
+				if (!benchmark.run(entityCount, &result))
+				{
+					std::fprintf(stderr, "%s: unexpected world state with %zu entities\n", benchmark.name, entityCount);
+					succeeded = false;
+					break;
+				}
+
+				if (repetition == 0 || result.elapsedTime < bestResult.elapsedTime)
+					bestResult = result;
+			}
+
+			PrintResult(format, benchmark.name, bestResult);
+		}
+	}
+
+	PrintFooter(format);
+
+	// Uninitialization messages would follow the results otherwise
+	Nz::Log::Enable(false);
+
+	return (succeeded) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,149 @@
+#include "Benchmark.hpp"
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Network/NetPacket.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+	std::atomic<std::size_t> s_allocationCount(0);
+
+	double GetPercentile(std::vector<Nz::UInt64>& sortedValues, double percentile)
+	{
+		if (sortedValues.empty())
+			return 0.0;
+
+		std::size_t index = static_cast<std::size_t>(percentile * (sortedValues.size() - 1) + 0.5);
+		return static_cast<double>(sortedValues[index]);
+	}
+}
+
+// Replacing the global allocation functions counts allocations made by the engine libraries as well
+void* operator new(std::size_t size)
+{
+	s_allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+	void* ptr = std::malloc((size > 0) ? size : 1);
+	if (!ptr)
+		throw std::bad_alloc();
+
+	return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+	return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+std::size_t GetAllocationCount()
+{
+	return s_allocationCount.load(std::memory_order_relaxed);
+}
+
+void BuildPayload(Nz::NetPacket& packet, std::size_t size, Nz::UInt32 sequence)
+{
+	static const Nz::UInt8 padding[256] = {};
+
+	packet << Nz::GetElapsedMicroseconds() << sequence;
+
+	std::size_t headerSize = sizeof(Nz::UInt64) + sizeof(Nz::UInt32);
+	for (std::size_t remaining = (size > headerSize) ? size - headerSize : 0; remaining > 0;)
+	{
+		std::size_t chunkSize = std::min(remaining, sizeof(padding));
+		packet.Write(padding, chunkSize);
+		remaining -= chunkSize;
+	}
+}
+
+Nz::UInt64 ReadSendTime(Nz::NetPacket& packet)
+{
+	Nz::UInt64 sendTime;
+	packet >> sendTime;
+
+	return sendTime;
+}
+
+bool IsReliablePacket(const BenchmarkConfig& config, Nz::UInt32 sequence)
+{
+	return (sequence % 100) < static_cast<Nz::UInt32>(config.reliableRatio * 100.0 + 0.5);
+}
+
+void PrintHeader()
+{
+	std::printf("%-6s %5s %6s %6s %5s %9s %9s %12s %9s %9s %10s %10s\n", "proto", "peers", "size", "reliab", "loss", "sent", "received", "packets/s", "p50 (us)", "p99 (us)", "cpu/packet", "allocs/pkt");
+}
+
+void PrintResult(const std::string& transport, const BenchmarkConfig& config, const BenchmarkResult& result)
+{
+	if (!result.connected)
+	{
+		std::printf("%-6s %5zu %6zu %5.0f%% %4.0f%% connection failed\n", transport.c_str(), config.peerCount, config.packetSize, config.reliableRatio * 100.0, config.packetLoss * 100.0);
+		return;
+	}
+
+	std::vector<Nz::UInt64> latencies = result.latencies;
+	std::sort(latencies.begin(), latencies.end());
+
+	double seconds = result.elapsedTime / 1000000.0;
+	double packetCount = static_cast<double>(std::max<std::size_t>(result.receivedCount, 1));
+
+	std::printf("%-6s %5zu %6zu %5.0f%% %4.0f%% %9zu %9zu %12.0f %9.0f %9.0f %8.2fus %10.2f\n",
+	            transport.c_str(), config.peerCount, config.packetSize, config.reliableRatio * 100.0, config.packetLoss * 100.0,
+	            result.sentCount, result.receivedCount, (seconds > 0.0) ? result.receivedCount / seconds : 0.0,
+	            GetPercentile(latencies, 0.5), GetPercentile(latencies, 0.99),
+	            result.cpuTime / packetCount, result.allocationCount / packetCount);
+}
+
+BenchmarkRecorder::BenchmarkRecorder(BenchmarkResult& result) :
+m_result(result)
+{
+}
+
+void BenchmarkRecorder::RecordReceived(Nz::NetPacket& packet)
+{
+	m_lastReceptionTime = Nz::GetElapsedMicroseconds();
+
+	m_result.latencies.push_back(m_lastReceptionTime - ReadSendTime(packet));
+	m_result.receivedCount++;
+}
+
+void BenchmarkRecorder::Start()
+{
+	m_result.latencies.reserve(1024 * 1024);
+
+	m_allocationStart = GetAllocationCount();
+	m_cpuStart = std::clock();
+	m_startTime = Nz::GetElapsedMicroseconds();
+	m_lastReceptionTime = m_startTime;
+}
+
+void BenchmarkRecorder::Stop()
+{
+	// Waiting for late packets doesn't count as sending time
+	m_result.elapsedTime = m_lastReceptionTime - m_startTime;
+	m_result.cpuTime = static_cast<Nz::UInt64>(std::clock() - m_cpuStart) * 1000000 / CLOCKS_PER_SEC;
+	m_result.allocationCount = GetAllocationCount() - m_allocationStart;
+}
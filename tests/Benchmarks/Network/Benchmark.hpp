@@ -0,0 +1,82 @@
+#pragma once
+
+#ifndef NAZARA_BENCHMARKS_NETWORK_BENCHMARK_HPP
+#define NAZARA_BENCHMARKS_NETWORK_BENCHMARK_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <ctime>
+#include <string>
+#include <vector>
+
+namespace Nz
+{
+	class NetPacket;
+}
+
+struct BenchmarkConfig
+{
+	double packetLoss = 0.0;           //< Simulated loss probability, transports without simulation skip lossy runs
+	double reliableRatio = 0.5;        //< Part of the packets sent reliably, the others are sent unreliably
+	std::size_t packetSize = 64;       //< Payload size, including the timestamp header
+	std::size_t packetsPerTick = 8;    //< Packets sent by every peer each millisecond
+	std::size_t peerCount = 4;
+	Nz::UInt16 maxDelay = 0;           //< Simulated latency range in milliseconds (ENet only)
+	Nz::UInt16 minDelay = 0;
+	Nz::UInt16 port = 24000;
+	Nz::UInt32 duration = 2000;        //< Time spent sending, in milliseconds
+};
+
+struct BenchmarkResult
+{
+	std::size_t allocationCount = 0;
+	std::size_t receivedCount = 0;
+	std::size_t sentCount = 0;
+	std::vector<Nz::UInt64> latencies; //< One-way latencies, in microseconds
+	Nz::UInt64 cpuTime = 0;            //< Process time, in microseconds
+	Nz::UInt64 elapsedTime = 0;        //< Wall time, in microseconds
+	bool connected = false;
+};
+
+// Counts every allocation made by the process, see the operator new replacement in Benchmark.cpp
+std::size_t GetAllocationCount();
+
+// Fills a packet with the send time, a sequence number and padding up to the wanted size
+void BuildPayload(Nz::NetPacket& packet, std::size_t size, Nz::UInt32 sequence);
+Nz::UInt64 ReadSendTime(Nz::NetPacket& packet);
+
+// Spreads reliable packets evenly according to the reliable ratio
+bool IsReliablePacket(const BenchmarkConfig& config, Nz::UInt32 sequence);
+
+void PrintHeader();
+void PrintResult(const std::string& transport, const BenchmarkConfig& config, const BenchmarkResult& result);
+
+// Measures CPU time, wall time and allocations between Start and Stop
+class BenchmarkRecorder
+{
+	public:
+		BenchmarkRecorder(BenchmarkResult& result);
+
+		void RecordReceived(Nz::NetPacket& packet);
+		inline void RecordSent();
+
+		void Start();
+		void Stop();
+
+	private:
+		BenchmarkResult& m_result;
+		std::clock_t m_cpuStart;
+		std::size_t m_allocationStart;
+		Nz::UInt64 m_lastReceptionTime;
+		Nz::UInt64 m_startTime;
+};
+
+inline void BenchmarkRecorder::RecordSent()
+{
+	m_result.sentCount++;
+}
+
+bool RunENetBenchmark(const BenchmarkConfig& config, BenchmarkResult* result);
+bool RunRUdpBenchmark(const BenchmarkConfig& config, BenchmarkResult* result);
+bool RunTcpBenchmark(const BenchmarkConfig& config, BenchmarkResult* result);
+
+#endif // NAZARA_BENCHMARKS_NETWORK_BENCHMARK_HPP
@@ -0,0 +1,107 @@
+#include "Benchmark.hpp"
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/ENetPeer.hpp>
+#include <algorithm>
+#include <memory>
+
+bool RunENetBenchmark(const BenchmarkConfig& config, BenchmarkResult* result)
+{
+	Nz::ENetHost server;
+	if (!server.Create(Nz::NetProtocol_IPv4, config.port, config.peerCount, 1))
+		return false;
+
+	server.SimulateNetwork(config.packetLoss, config.minDelay, config.maxDelay);
+
+	Nz::IpAddress serverAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), config.port);
+
+	std::vector<std::unique_ptr<Nz::ENetHost>> clients;
+	std::vector<Nz::ENetPeer*> serverPeers;
+	for (std::size_t i = 0; i < config.peerCount; ++i)
+	{
+		std::unique_ptr<Nz::ENetHost> client = std::make_unique<Nz::ENetHost>();
+		if (!client->Create(Nz::NetProtocol_IPv4, 0, 1, 1))
+			return false;
+
+		client->SimulateNetwork(config.packetLoss, config.minDelay, config.maxDelay);
+
+		serverPeers.push_back(client->Connect(serverAddress, 1));
+		clients.emplace_back(std::move(client));
+	}
+
+	BenchmarkRecorder recorder(*result);
+
+	// Clients only send, the server may block until something comes in
+	auto ServiceAll = [&](bool record, Nz::UInt32 serverTimeout)
+	{
+		Nz::ENetEvent event;
+		for (auto& client : clients)
+		{
+			while (client->Service(&event, 0) > 0);
+		}
+
+		while (server.Service(&event, serverTimeout) > 0)
+		{
+			if (record && event.type == Nz::ENetEventType::Receive)
+				recorder.RecordReceived(event.packet->data);
+
+			serverTimeout = 0;
+		}
+	};
+
+	auto AreConnected = [&]()
+	{
+		return std::all_of(serverPeers.begin(), serverPeers.end(), [](Nz::ENetPeer* peer) { return peer && peer->IsConnected(); });
+	};
+
+	Nz::UInt64 connectionStart = Nz::GetElapsedMilliseconds();
+	while (!AreConnected() && Nz::GetElapsedMilliseconds() - connectionStart < 2000)
+		ServiceAll(false, 1);
+
+	result->connected = AreConnected();
+	if (!result->connected)
+		return true;
+
+	recorder.Start();
+
+	Nz::UInt32 sequence = 0;
+	Nz::UInt64 sendStart = Nz::GetElapsedMilliseconds();
+	Nz::UInt64 nextTick = sendStart;
+	while (Nz::GetElapsedMilliseconds() - sendStart < config.duration)
+	{
+		if (Nz::GetElapsedMilliseconds() >= nextTick)
+		{
+			for (Nz::ENetPeer* peer : serverPeers)
+			{
+				for (std::size_t i = 0; i < config.packetsPerTick; ++i)
+				{
+					Nz::NetPacket packet(1, config.packetSize);
+					BuildPayload(packet, config.packetSize, sequence);
+
+					peer->Send(0, (IsReliablePacket(config, sequence)) ? Nz::ENetPacketFlag_Reliable : Nz::ENetPacketFlag_Unsequenced, std::move(packet));
+					recorder.RecordSent();
+
+					sequence++;
+				}
+			}
+
+			nextTick++;
+		}
+
+		ServiceAll(true, 1);
+	}
+
+	// Let packets in flight arrive, until nothing comes for a while
+	Nz::UInt64 lastReception = Nz::GetElapsedMilliseconds();
+	while (Nz::GetElapsedMilliseconds() - lastReception < 200U + config.maxDelay)
+	{
+		std::size_t receivedCount = result->receivedCount;
+		ServiceAll(true, 1);
+
+		if (result->receivedCount != receivedCount)
+			lastReception = Nz::GetElapsedMilliseconds();
+	}
+
+	recorder.Stop();
+	return true;
+}
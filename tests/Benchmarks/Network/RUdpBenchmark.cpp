@@ -0,0 +1,110 @@
+#include "Benchmark.hpp"
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Thread.hpp>
+#include <Nazara/Network/RUdpConnection.hpp>
+#include <Nazara/Network/RUdpMessage.hpp>
+#include <memory>
+
+bool RunRUdpBenchmark(const BenchmarkConfig& config, BenchmarkResult* result)
+{
+	Nz::RUdpConnection server;
+	if (!server.Listen(Nz::NetProtocol_IPv4, config.port))
+		return false;
+
+	server.SimulateNetwork(config.packetLoss);
+
+	Nz::IpAddress serverAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), config.port);
+
+	std::size_t connectedCount = 0;
+	std::vector<std::unique_ptr<Nz::RUdpConnection>> clients;
+	for (std::size_t i = 0; i < config.peerCount; ++i)
+	{
+		std::unique_ptr<Nz::RUdpConnection> client = std::make_unique<Nz::RUdpConnection>();
+		if (!client->Listen(Nz::NetProtocol_IPv4, 0))
+			return false;
+
+		client->OnConnectedToPeer.Connect([&](Nz::RUdpConnection* /*connection*/) { connectedCount++; });
+		client->SimulateNetwork(config.packetLoss);
+
+		if (!client->Connect(serverAddress))
+			return false;
+
+		clients.emplace_back(std::move(client));
+	}
+
+	BenchmarkRecorder recorder(*result);
+
+	// RUdpConnection can't wait for incoming data, sleep when idle to keep CPU time meaningful (adds up to a millisecond of latency)
+	auto UpdateAll = [&](bool record)
+	{
+		for (auto& client : clients)
+			client->Update();
+
+		server.Update();
+
+		bool hasReceived = false;
+
+		Nz::RUdpMessage message;
+		while (server.PollMessage(&message))
+		{
+			if (record)
+				recorder.RecordReceived(message.data);
+
+			hasReceived = true;
+		}
+
+		if (!hasReceived)
+			Nz::Thread::Sleep(1);
+	};
+
+	Nz::UInt64 connectionStart = Nz::GetElapsedMilliseconds();
+	while (connectedCount < config.peerCount && Nz::GetElapsedMilliseconds() - connectionStart < 2000)
+		UpdateAll(false);
+
+	result->connected = (connectedCount == config.peerCount);
+	if (!result->connected)
+		return true;
+
+	recorder.Start();
+
+	Nz::UInt32 sequence = 0;
+	Nz::UInt64 sendStart = Nz::GetElapsedMilliseconds();
+	Nz::UInt64 nextTick = sendStart;
+	while (Nz::GetElapsedMilliseconds() - sendStart < config.duration)
+	{
+		if (Nz::GetElapsedMilliseconds() >= nextTick)
+		{
+			for (auto& client : clients)
+			{
+				for (std::size_t i = 0; i < config.packetsPerTick; ++i)
+				{
+					Nz::NetPacket packet(1, config.packetSize);
+					BuildPayload(packet, config.packetSize, sequence);
+
+					Nz::PacketReliability reliability = (IsReliablePacket(config, sequence)) ? Nz::PacketReliability_Reliable : Nz::PacketReliability_Unreliable;
+					if (client->Send(serverAddress, Nz::PacketPriority_Immediate, reliability, packet))
+						recorder.RecordSent();
+
+					sequence++;
+				}
+			}
+
+			nextTick++;
+		}
+
+		UpdateAll(true);
+	}
+
+	Nz::UInt64 lastReception = Nz::GetElapsedMilliseconds();
+	while (Nz::GetElapsedMilliseconds() - lastReception < 200)
+	{
+		std::size_t receivedCount = result->receivedCount;
+		UpdateAll(true);
+
+		if (result->receivedCount != receivedCount)
+			lastReception = Nz::GetElapsedMilliseconds();
+	}
+
+	recorder.Stop();
+	return true;
+}
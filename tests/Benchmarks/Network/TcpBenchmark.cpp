@@ -0,0 +1,110 @@
+#include "Benchmark.hpp"
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Network/NetPacket.hpp>
+#include <Nazara/Network/SocketPoller.hpp>
+#include <Nazara/Network/TcpClient.hpp>
+#include <Nazara/Network/TcpServer.hpp>
+#include <memory>
+
+bool RunTcpBenchmark(const BenchmarkConfig& config, BenchmarkResult* result)
+{
+	Nz::TcpServer server;
+	server.EnableBlocking(false);
+
+	if (server.Listen(Nz::NetProtocol_IPv4, config.port) != Nz::SocketState_Bound)
+		return false;
+
+	Nz::IpAddress serverAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), config.port);
+
+	std::vector<std::unique_ptr<Nz::TcpClient>> clients;
+	for (std::size_t i = 0; i < config.peerCount; ++i)
+	{
+		std::unique_ptr<Nz::TcpClient> client = std::make_unique<Nz::TcpClient>();
+		if (client->Connect(serverAddress) == Nz::SocketState_NotConnected)
+			return false;
+
+		clients.emplace_back(std::move(client));
+	}
+
+	// Accept every client, reading from them without blocking
+	Nz::SocketPoller poller;
+	std::vector<std::unique_ptr<Nz::TcpClient>> serverClients;
+	Nz::UInt64 connectionStart = Nz::GetElapsedMilliseconds();
+	while (serverClients.size() < config.peerCount && Nz::GetElapsedMilliseconds() - connectionStart < 2000)
+	{
+		std::unique_ptr<Nz::TcpClient> serverClient = std::make_unique<Nz::TcpClient>();
+		if (!server.AcceptClient(serverClient.get()))
+			continue;
+
+		serverClient->EnableBlocking(false);
+		poller.RegisterSocket(*serverClient, Nz::SocketPollEvent_Read);
+
+		serverClients.emplace_back(std::move(serverClient));
+	}
+
+	result->connected = (serverClients.size() == config.peerCount);
+	for (auto& client : clients)
+		result->connected = result->connected && client->WaitForConnected(1000);
+
+	if (!result->connected)
+		return true;
+
+	BenchmarkRecorder recorder(*result);
+
+	auto ReceiveAll = [&](int msTimeout)
+	{
+		if (!poller.Wait(msTimeout))
+			return;
+
+		Nz::NetPacket packet;
+		for (auto& serverClient : serverClients)
+		{
+			if (!poller.IsReadyToRead(*serverClient))
+				continue;
+
+			while (serverClient->ReceivePacket(&packet))
+				recorder.RecordReceived(packet);
+		}
+	};
+
+	recorder.Start();
+
+	// TCP has no unreliable mode and no network simulation, every packet is sent reliably
+	Nz::UInt32 sequence = 0;
+	Nz::UInt64 sendStart = Nz::GetElapsedMilliseconds();
+	Nz::UInt64 nextTick = sendStart;
+	while (Nz::GetElapsedMilliseconds() - sendStart < config.duration)
+	{
+		if (Nz::GetElapsedMilliseconds() >= nextTick)
+		{
+			for (auto& client : clients)
+			{
+				for (std::size_t i = 0; i < config.packetsPerTick; ++i)
+				{
+					Nz::NetPacket packet(1, config.packetSize);
+					BuildPayload(packet, config.packetSize, sequence++);
+
+					if (client->SendPacket(packet))
+						recorder.RecordSent();
+				}
+			}
+
+			nextTick++;
+		}
+
+		ReceiveAll(1);
+	}
+
+	Nz::UInt64 lastReception = Nz::GetElapsedMilliseconds();
+	while (Nz::GetElapsedMilliseconds() - lastReception < 200)
+	{
+		std::size_t receivedCount = result->receivedCount;
+		ReceiveAll(1);
+
+		if (result->receivedCount != receivedCount)
+			lastReception = Nz::GetElapsedMilliseconds();
+	}
+
+	recorder.Stop();
+	return true;
+}
@@ -0,0 +1,147 @@
+#include "Benchmark.hpp"
+#include <Nazara/Core/Initializer.hpp>
+#include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/AbstractLogger.hpp>
+#include <Nazara/Network/Network.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+namespace
+{
+	struct Transport
+	{
+		const char* name;
+		std::function<bool(const BenchmarkConfig& config, BenchmarkResult* result)> run;
+		bool supportsNetworkSimulation;
+		bool supportsUnreliable;
+	};
+
+	void PrintUsage(const char* program)
+	{
+		std::printf("Usage: %s [options]\n", program);
+		std::printf("  --delay <ms>       Simulated latency upper bound, ENet only (default: 0)\n");
+		std::printf("  --duration <ms>    Sending time of every run (default: 1000)\n");
+		std::printf("  --loss <ratio>     Packet loss of lossy runs, 0 disables them (default: 0.05)\n");
+		std::printf("  --peers <count>    Clients sending to the server (default: 4)\n");
+		std::printf("  --port <port>      First port used, every run uses the next one (default: 24000)\n");
+		std::printf("  --rate <count>     Packets sent by every client each millisecond (default: 8)\n");
+		std::printf("  --transport <name> Only runs enet, rudp or tcp\n");
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	Nz::Initializer<Nz::Network> network;
+	if (!network)
+	{
+		std::fprintf(stderr, "Failed to initialize Network module\n");
+		return EXIT_FAILURE;
+	}
+
+	Nz::Log::GetLogger()->EnableStdReplication(false);
+
+	BenchmarkConfig baseConfig;
+	baseConfig.duration = 1000;
+
+	double packetLoss = 0.05;
+	const char* onlyTransport = nullptr;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const char* option = argv[i];
+		if (std::strcmp(option, "--help") == 0)
+		{
+			PrintUsage(argv[0]);
+			return EXIT_SUCCESS;
+		}
+
+		if (i + 1 >= argc)
+		{
+			PrintUsage(argv[0]);
+			return EXIT_FAILURE;
+		}
+
+		const char* value = argv[++i];
+		if (std::strcmp(option, "--delay") == 0)
+			baseConfig.maxDelay = static_cast<Nz::UInt16>(std::atoi(value));
+		else if (std::strcmp(option, "--duration") == 0)
+			baseConfig.duration = static_cast<Nz::UInt32>(std::atoi(value));
+		else if (std::strcmp(option, "--loss") == 0)
+			packetLoss = std::atof(value);
+		else if (std::strcmp(option, "--peers") == 0)
+			baseConfig.peerCount = static_cast<std::size_t>(std::atoi(value));
+		else if (std::strcmp(option, "--port") == 0)
+			baseConfig.port = static_cast<Nz::UInt16>(std::atoi(value));
+		else if (std::strcmp(option, "--rate") == 0)
+			baseConfig.packetsPerTick = static_cast<std::size_t>(std::atoi(value));
+		else if (std::strcmp(option, "--transport") == 0)
+			onlyTransport = value;
+		else
+		{
+			PrintUsage(argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	const Transport transports[] = {
+		{ "enet", RunENetBenchmark, true,  true  },
+		{ "rudp", RunRUdpBenchmark, true,  true  },
+		{ "tcp",  RunTcpBenchmark,  false, false }
+	};
+
+	const std::size_t packetSizes[] = { 32, 256, 1024 };
+	const double reliableRatios[] = { 0.0, 0.5, 1.0 };
+
+	std::vector<double> losses = { 0.0 };
+	if (packetLoss > 0.0)
+		losses.push_back(packetLoss);
+
+	PrintHeader();
+
+	bool succeeded = true;
+	Nz::UInt16 port = baseConfig.port;
+	for (const Transport& transport : transports)
+	{
+		if (onlyTransport && std::strcmp(onlyTransport, transport.name) != 0)
+			continue;
+
+		for (double loss : losses)
+		{
+			if (loss > 0.0 && !transport.supportsNetworkSimulation)
+				continue;
+
+			for (double reliableRatio : reliableRatios)
+			{
+				if (reliableRatio < 1.0 && !transport.supportsUnreliable)
+					continue;
+
+				for (std::size_t packetSize : packetSizes)
+				{
+					BenchmarkConfig config = baseConfig;
+					config.packetLoss = loss;
+					config.packetSize = packetSize;
+					config.port = port++;
+					config.reliableRatio = reliableRatio;
+
+					if (!transport.supportsNetworkSimulation)
+						config.maxDelay = 0;
+
+					BenchmarkResult result;
+					if (!transport.run(config, &result))
+					{
+						std::fprintf(stderr, "%s: failed to create sockets on port %u\n", transport.name, config.port);
+						succeeded = false;
+						continue;
+					}
+
+					PrintResult(transport.name, config, result);
+				}
+			}
+		}
+	}
+
+	return (succeeded) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,348 @@
+#include "RenderBenchmark.hpp"
+#include <Nazara/Core/Primitive.hpp>
+#include <Nazara/Graphics/BasicRenderQueue.hpp>
+#include <Nazara/Graphics/Billboard.hpp>
+#include <Nazara/Graphics/Material.hpp>
+#include <Nazara/Graphics/Model.hpp>
+#include <Nazara/Graphics/ParticleFunctionRenderer.hpp>
+#include <Nazara/Graphics/ParticleMapper.hpp>
+#include <Nazara/Graphics/ParticleStruct.hpp>
+#include <Nazara/Graphics/SceneData.hpp>
+#include <Nazara/Graphics/Sprite.hpp>
+#include <Nazara/Renderer/Renderer.hpp>
+#include <Nazara/Renderer/RenderStatistics.hpp>
+#include <Nazara/Utility/Mesh.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	Nz::UInt64 GetElapsedTime(Clock::time_point start, Clock::time_point end)
+	{
+		return static_cast<Nz::UInt64>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+	}
+}
+
+BenchmarkViewer::BenchmarkViewer(unsigned int width, unsigned int height) :
+m_projectionMatrix(Nz::Matrix4f::Perspective(70.f, static_cast<float>(width) / height, GetZNear(), GetZFar())),
+m_viewport(0, 0, width, height)
+{
+	m_valid = m_target.Create(true) &&
+	          m_target.AttachBuffer(Nz::AttachmentPoint_Color, 0, Nz::PixelFormatType_RGBA8, width, height) &&
+	          m_target.AttachBuffer(Nz::AttachmentPoint_DepthStencil, 0, Nz::PixelFormatType_Depth24Stencil8, width, height);
+
+	if (m_valid)
+	{
+		m_target.Unlock();
+		m_target.SetColorTarget(0);
+	}
+
+	SetYaw(0.f);
+}
+
+void BenchmarkViewer::ApplyView() const
+{
+	Nz::Renderer::SetMatrix(Nz::MatrixType_Projection, m_projectionMatrix);
+	Nz::Renderer::SetMatrix(Nz::MatrixType_View, m_viewMatrix);
+	Nz::Renderer::SetTarget(&m_target);
+	Nz::Renderer::SetViewport(m_viewport);
+}
+
+float BenchmarkViewer::GetAspectRatio() const
+{
+	return static_cast<float>(m_viewport.width) / m_viewport.height;
+}
+
+Nz::Vector3f BenchmarkViewer::GetEyePosition() const
+{
+	return Nz::Vector3f::Zero();
+}
+
+Nz::Vector3f BenchmarkViewer::GetForward() const
+{
+	return m_rotation * Nz::Vector3f::Forward();
+}
+
+const Nz::Frustumf& BenchmarkViewer::GetFrustum() const
+{
+	return m_frustum;
+}
+
+const Nz::Matrix4f& BenchmarkViewer::GetProjectionMatrix() const
+{
+	return m_projectionMatrix;
+}
+
+Nz::ProjectionType BenchmarkViewer::GetProjectionType() const
+{
+	return Nz::ProjectionType_Perspective;
+}
+
+const Nz::RenderTarget* BenchmarkViewer::GetTarget() const
+{
+	return &m_target;
+}
+
+const Nz::Matrix4f& BenchmarkViewer::GetViewMatrix() const
+{
+	return m_viewMatrix;
+}
+
+const Nz::Recti& BenchmarkViewer::GetViewport() const
+{
+	return m_viewport;
+}
+
+float BenchmarkViewer::GetZFar() const
+{
+	return 5000.f;
+}
+
+float BenchmarkViewer::GetZNear() const
+{
+	return 1.f;
+}
+
+bool BenchmarkViewer::IsValid() const
+{
+	return m_valid;
+}
+
+void BenchmarkViewer::SetYaw(float yaw)
+{
+	m_rotation = Nz::EulerAnglesf(0.f, yaw, 0.f);
+	m_viewMatrix = Nz::Matrix4f::ViewMatrix(GetEyePosition(), m_rotation);
+	m_frustum.Extract(m_viewMatrix, m_projectionMatrix);
+}
+
+RenderBenchmark::SceneObject::SceneObject(Nz::InstancedRenderableRef instancedRenderable, const Nz::Matrix4f& transformMatrix) :
+renderable(std::move(instancedRenderable)),
+data(transformMatrix)
+{
+	data.renderOrder = 0;
+	data.transformMatrix = transformMatrix;
+	data.volume = renderable->GetBoundingVolume();
+	data.volume.Update(transformMatrix);
+
+	renderable->UpdateData(&data);
+}
+
+RenderBenchmark::RenderBenchmark(const SceneParameters& parameters) :
+m_viewer(1280, 720)
+{
+	m_cullingList.EnableHierarchicalCulling();
+
+	BuildScene(parameters);
+}
+
+FrameResult RenderBenchmark::Run(unsigned int warmupFrameCount, unsigned int frameCount)
+{
+	FrameResult dummy;
+	for (unsigned int i = 0; i < warmupFrameCount; ++i)
+	{
+		m_viewer.SetYaw(360.f * i / warmupFrameCount);
+		RenderFrame(&dummy);
+	}
+
+	FrameResult total;
+	for (unsigned int i = 0; i < frameCount; ++i)
+	{
+		m_viewer.SetYaw(360.f * i / frameCount);
+		RenderFrame(&total);
+	}
+
+	FrameResult average;
+	if (frameCount > 0)
+	{
+		average.cullTime = total.cullTime / frameCount;
+		average.drawTime = total.drawTime / frameCount;
+		average.queueTime = total.queueTime / frameCount;
+		average.sortTime = total.sortTime / frameCount;
+		average.visibleCount = total.visibleCount / frameCount;
+		average.drawCalls = total.drawCalls / frameCount;
+		average.programBindings = total.programBindings / frameCount;
+		average.redundantBindings = total.redundantBindings / frameCount;
+		average.renderStateChanges = total.renderStateChanges / frameCount;
+		average.textureBindings = total.textureBindings / frameCount;
+	}
+
+	return average;
+}
+
+bool RenderBenchmark::IsValid() const
+{
+	return m_viewer.IsValid();
+}
+
+void RenderBenchmark::BuildScene(const SceneParameters& parameters)
+{
+	// Always the same scene, so runs can be compared
+	std::mt19937 randomEngine(42);
+
+	std::size_t objectCount = parameters.modelCount + parameters.spriteCount + parameters.billboardCount;
+	float extent = 4.f * std::cbrt(static_cast<float>(std::max<std::size_t>(objectCount + parameters.particleCount, 1)));
+	std::uniform_real_distribution<float> positionDistribution(-extent, extent);
+
+	auto RandomPosition = [&]()
+	{
+		return Nz::Vector3f(positionDistribution(randomEngine), positionDistribution(randomEngine), positionDistribution(randomEngine));
+	};
+
+	auto RandomColor = [&]()
+	{
+		return Nz::Color(static_cast<Nz::UInt8>(randomEngine()), static_cast<Nz::UInt8>(randomEngine()), static_cast<Nz::UInt8>(randomEngine()));
+	};
+
+	// Models share a mesh and are spread between opaque materials, sprites and billboards use translucent ones (which are depth sorted)
+	std::size_t materialCount = std::max<std::size_t>(parameters.materialCount, 1);
+
+	std::vector<Nz::MaterialRef> opaqueMaterials(materialCount);
+	std::vector<Nz::MaterialRef> translucentMaterials(materialCount);
+	for (std::size_t i = 0; i < materialCount; ++i)
+	{
+		opaqueMaterials[i] = Nz::Material::New();
+		opaqueMaterials[i]->SetDiffuseColor(RandomColor());
+
+		translucentMaterials[i] = Nz::Material::New("Translucent3D");
+		translucentMaterials[i]->SetDiffuseColor(RandomColor());
+	}
+
+	Nz::MeshRef cubeMesh = Nz::Mesh::New();
+	cubeMesh->CreateStatic();
+	cubeMesh->BuildSubMesh(Nz::Primitive::Box(Nz::Vector3f::Unit()));
+	cubeMesh->SetMaterialCount(1);
+
+	m_objects.reserve(objectCount);
+
+	for (std::size_t i = 0; i < parameters.modelCount; ++i)
+	{
+		Nz::ModelRef model = Nz::Model::New();
+		model->SetMesh(cubeMesh);
+		model->SetMaterial(0, opaqueMaterials[i % materialCount]);
+
+		m_objects.emplace_back(std::move(model), Nz::Matrix4f::Translate(RandomPosition()));
+	}
+
+	for (std::size_t i = 0; i < parameters.spriteCount; ++i)
+	{
+		Nz::SpriteRef sprite = Nz::Sprite::New(translucentMaterials[i % materialCount]);
+		sprite->SetSize(1.f, 1.f);
+
+		m_objects.emplace_back(std::move(sprite), Nz::Matrix4f::Translate(RandomPosition()));
+	}
+
+	for (std::size_t i = 0; i < parameters.billboardCount; ++i)
+	{
+		Nz::BillboardRef billboard = Nz::Billboard::New(translucentMaterials[i % materialCount]);
+		billboard->SetSize(1.f, 1.f);
+
+		m_objects.emplace_back(std::move(billboard), Nz::Matrix4f::Translate(RandomPosition()));
+	}
+
+	for (SceneObject& object : m_objects)
+	{
+		object.cullingEntry = m_cullingList.RegisterVolumeTest(&object);
+		object.cullingEntry.UpdateVolume(object.data.volume);
+	}
+
+	m_lights.resize(parameters.lightCount);
+	for (SceneLight& sceneLight : m_lights)
+	{
+		sceneLight.light.SetLightType(Nz::LightType_Point);
+		sceneLight.light.SetColor(RandomColor());
+		sceneLight.light.SetRadius(extent / 4.f);
+		sceneLight.transformMatrix = Nz::Matrix4f::Translate(RandomPosition());
+	}
+
+	// A single group holding every particle, as a particle system would
+	if (parameters.particleCount > 0)
+	{
+		m_particles.reset(new Nz::ParticleGroup(static_cast<unsigned int>(parameters.particleCount), Nz::ParticleLayout_Billboard));
+		m_particles->SetRenderer(Nz::ParticleFunctionRenderer::New([material = translucentMaterials.front()] (const Nz::ParticleGroup& /*group*/, const Nz::ParticleMapper& mapper, unsigned int startId, unsigned int endId, Nz::AbstractRenderQueue* renderQueue)
+		{
+			auto colorPtr = mapper.GetComponentPtr<const Nz::Color>(Nz::ParticleComponent_Color);
+			auto positionPtr = mapper.GetComponentPtr<const Nz::Vector3f>(Nz::ParticleComponent_Position);
+			auto rotationPtr = mapper.GetComponentPtr<const float>(Nz::ParticleComponent_Rotation);
+			auto sizePtr = mapper.GetComponentPtr<const Nz::Vector2f>(Nz::ParticleComponent_Size);
+
+			renderQueue->AddBillboards(0, material, endId - startId + 1, Nz::Recti(-1, -1), positionPtr, sizePtr, rotationPtr, colorPtr);
+		}));
+
+		Nz::ParticleStruct_Billboard* particles = static_cast<Nz::ParticleStruct_Billboard*>(m_particles->CreateParticles(static_cast<unsigned int>(parameters.particleCount)));
+		for (std::size_t i = 0; i < parameters.particleCount; ++i)
+		{
+			particles[i].color = RandomColor();
+			particles[i].life = 1.f;
+			particles[i].normal = Nz::Vector3f::Up();
+			particles[i].position = RandomPosition();
+			particles[i].rotation = 0.f;
+			particles[i].size.Set(0.5f);
+			particles[i].velocity = Nz::Vector3f::Zero();
+		}
+	}
+}
+
+void RenderBenchmark::RenderFrame(FrameResult* result)
+{
+	Nz::BasicRenderQueue* renderQueue = static_cast<Nz::BasicRenderQueue*>(m_technique.GetRenderQueue());
+
+	Clock::time_point cullStart = Clock::now();
+
+	m_cullingList.Cull(m_viewer.GetFrustum());
+
+	Clock::time_point queueStart = Clock::now();
+
+	renderQueue->Clear();
+	renderQueue->ClearLights();
+
+	Nz::Recti fullscreenScissorRect(-1, -1);
+	for (const SceneObject* object : m_cullingList)
+		object->renderable->AddToRenderQueue(renderQueue, object->data, fullscreenScissorRect);
+
+	const Nz::Frustumf& frustum = m_viewer.GetFrustum();
+	for (const SceneLight& sceneLight : m_lights)
+	{
+		if (sceneLight.light.Cull(frustum, sceneLight.transformMatrix))
+			sceneLight.light.AddToRenderQueue(renderQueue, sceneLight.transformMatrix);
+	}
+
+	if (m_particles)
+		m_particles->AddToRenderQueue(renderQueue, Nz::Matrix4f::Identity());
+
+	Clock::time_point sortStart = Clock::now();
+
+	renderQueue->Sort(&m_viewer);
+
+	Clock::time_point drawStart = Clock::now();
+
+	Nz::SceneData sceneData;
+	sceneData.ambientColor = Nz::Color(25, 25, 25);
+	sceneData.background = nullptr;
+	sceneData.globalReflectionTexture = nullptr;
+	sceneData.viewer = &m_viewer;
+
+	Nz::Renderer::ResetStatistics();
+
+	m_viewer.ApplyView();
+	m_technique.Clear(sceneData);
+	m_technique.Draw(sceneData);
+
+	Clock::time_point drawEnd = Clock::now();
+
+	const Nz::RenderStatistics& statistics = Nz::Renderer::GetStatistics();
+
+	result->cullTime += GetElapsedTime(cullStart, queueStart);
+	result->queueTime += GetElapsedTime(queueStart, sortStart);
+	result->sortTime += GetElapsedTime(sortStart, drawStart);
+	result->drawTime += GetElapsedTime(drawStart, drawEnd);
+	result->visibleCount += m_cullingList.size();
+	result->drawCalls += statistics.drawCalls;
+	result->programBindings += statistics.programBindings;
+	result->redundantBindings += statistics.redundantBindings;
+	result->renderStateChanges += statistics.renderStateChanges;
+	result->textureBindings += statistics.textureBindings;
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#ifndef NAZARA_BENCHMARKS_RENDER_RENDERBENCHMARK_HPP
+#define NAZARA_BENCHMARKS_RENDER_RENDERBENCHMARK_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Graphics/AbstractViewer.hpp>
+#include <Nazara/Graphics/CullingList.hpp>
+#include <Nazara/Graphics/ForwardRenderTechnique.hpp>
+#include <Nazara/Graphics/InstancedRenderable.hpp>
+#include <Nazara/Graphics/Light.hpp>
+#include <Nazara/Graphics/ParticleGroup.hpp>
+#include <Nazara/Math/Frustum.hpp>
+#include <Nazara/Math/Matrix4.hpp>
+#include <Nazara/Math/Rect.hpp>
+#include <Nazara/Renderer/RenderTexture.hpp>
+#include <memory>
+#include <vector>
+
+struct SceneParameters
+{
+	std::size_t billboardCount = 1000;
+	std::size_t lightCount = 50;
+	std::size_t materialCount = 32;
+	std::size_t modelCount = 10000;
+	std::size_t particleCount = 10000;
+	std::size_t spriteCount = 1000;
+};
+
+// Average cost of a frame, in nanoseconds, and what the renderer was asked to do
+struct FrameResult
+{
+	Nz::UInt64 cullTime = 0;
+	Nz::UInt64 drawTime = 0;       //< ForwardRenderTechnique::Clear and Draw (the latter sorting the queue again, which is already sorted)
+	Nz::UInt64 queueTime = 0;      //< Filling the render queue from the visible objects, the lights and the particles
+	Nz::UInt64 sortTime = 0;
+	std::size_t visibleCount = 0;
+	unsigned int drawCalls = 0;
+	unsigned int programBindings = 0;
+	unsigned int redundantBindings = 0;
+	unsigned int renderStateChanges = 0;
+	unsigned int textureBindings = 0;
+};
+
+// Perspective camera turning around the center of the scene, rendering into an offscreen target
+class BenchmarkViewer : public Nz::AbstractViewer
+{
+	public:
+		BenchmarkViewer(unsigned int width, unsigned int height);
+		~BenchmarkViewer() = default;
+
+		void ApplyView() const override;
+
+		float GetAspectRatio() const override;
+		Nz::Vector3f GetEyePosition() const override;
+		Nz::Vector3f GetForward() const override;
+		const Nz::Frustumf& GetFrustum() const override;
+		const Nz::Matrix4f& GetProjectionMatrix() const override;
+		Nz::ProjectionType GetProjectionType() const override;
+		const Nz::RenderTarget* GetTarget() const override;
+		const Nz::Matrix4f& GetViewMatrix() const override;
+		const Nz::Recti& GetViewport() const override;
+		float GetZFar() const override;
+		float GetZNear() const override;
+
+		bool IsValid() const;
+
+		void SetYaw(float yaw);
+
+	private:
+		Nz::Frustumf m_frustum;
+		Nz::Matrix4f m_projectionMatrix;
+		Nz::Matrix4f m_viewMatrix;
+		Nz::Quaternionf m_rotation;
+		Nz::Recti m_viewport;
+		Nz::RenderTexture m_target;
+		bool m_valid;
+};
+
+class RenderBenchmark
+{
+	public:
+		RenderBenchmark(const SceneParameters& parameters);
+		~RenderBenchmark() = default;
+
+		// Renders frames with the camera doing a full turn, warmup frames compiling the shaders and filling the caches
+		FrameResult Run(unsigned int warmupFrameCount, unsigned int frameCount);
+
+		bool IsValid() const;
+
+	private:
+		struct SceneObject
+		{
+			SceneObject(Nz::InstancedRenderableRef instancedRenderable, const Nz::Matrix4f& transformMatrix);
+
+			Nz::InstancedRenderableRef renderable;
+			Nz::InstancedRenderable::InstanceData data;
+			Nz::CullingList<SceneObject>::VolumeEntry cullingEntry;
+		};
+
+		struct SceneLight
+		{
+			Nz::Light light;
+			Nz::Matrix4f transformMatrix;
+		};
+
+		void BuildScene(const SceneParameters& parameters);
+		void RenderFrame(FrameResult* result);
+
+		// The culling list has to outlive the entries of the objects
+		Nz::CullingList<SceneObject> m_cullingList;
+		std::unique_ptr<Nz::ParticleGroup> m_particles;
+		std::vector<SceneLight> m_lights;
+		std::vector<SceneObject> m_objects;
+		BenchmarkViewer m_viewer;
+		Nz::ForwardRenderTechnique m_technique;
+};
+
+#endif // NAZARA_BENCHMARKS_RENDER_RENDERBENCHMARK_HPP
@@ -0,0 +1,174 @@
+#include "RenderBenchmark.hpp"
+#include <Nazara/Core/AbstractLogger.hpp>
+#include <Nazara/Core/Initializer.hpp>
+#include <Nazara/Core/Log.hpp>
+#include <Nazara/Graphics/Graphics.hpp>
+#include <Nazara/Renderer/Renderer.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+	void PrintUsage(const char* program)
+	{
+		std::printf("Usage: %s [options]\n", program);
+		std::printf("  --billboards <n>     Billboards of the scene (default: 1000)\n");
+		std::printf("  --format <text|json> Output format, json being meant for regression tracking (default: text)\n");
+		std::printf("  --frames <n>         Measured frames, the camera doing a full turn (default: 300)\n");
+		std::printf("  --lights <n>         Point lights of the scene (default: 50)\n");
+		std::printf("  --materials <n>      Materials the objects are spread between (default: 32)\n");
+		std::printf("  --models <n>         Models (cubes) of the scene (default: 10000)\n");
+		std::printf("  --null-draws         Counts the draw calls without submitting them, so the GPU doesn't limit the measure\n");
+		std::printf("  --particles <n>      Billboard particles of the scene (default: 10000)\n");
+		std::printf("  --sprites <n>        Sprites of the scene (default: 1000)\n");
+		std::printf("  --warmup <n>         Frames rendered before the measure (default: 30)\n");
+	}
+
+	bool ParseCount(const char* value, std::size_t* count)
+	{
+		char* end;
+		unsigned long long parsedValue = std::strtoull(value, &end, 10);
+		if (end == value || *end != '\0')
+			return false;
+
+		*count = static_cast<std::size_t>(parsedValue);
+		return true;
+	}
+
+	void PrintResult(bool json, const SceneParameters& parameters, bool nullDraws, unsigned int frameCount, const FrameResult& result)
+	{
+		if (json)
+		{
+			std::printf("{\n");
+			std::printf("\t\"engine\": \"%d.%d.%d\",\n", NAZARA_VERSION_MAJOR, NAZARA_VERSION_MINOR, NAZARA_VERSION_PATCH);
+			std::printf("\t\"scene\": { \"models\": %zu, \"materials\": %zu, \"lights\": %zu, \"sprites\": %zu, \"billboards\": %zu, \"particles\": %zu },\n",
+			            parameters.modelCount, parameters.materialCount, parameters.lightCount, parameters.spriteCount, parameters.billboardCount, parameters.particleCount);
+			std::printf("\t\"null_draws\": %s,\n", (nullDraws) ? "true" : "false");
+			std::printf("\t\"frames\": %u,\n", frameCount);
+			std::printf("\t\"frame_ns\": { \"cull\": %llu, \"queue\": %llu, \"sort\": %llu, \"draw\": %llu },\n",
+			            static_cast<unsigned long long>(result.cullTime), static_cast<unsigned long long>(result.queueTime), static_cast<unsigned long long>(result.sortTime), static_cast<unsigned long long>(result.drawTime));
+			std::printf("\t\"frame_counts\": { \"visible\": %zu, \"draw_calls\": %u, \"program_bindings\": %u, \"texture_bindings\": %u, \"state_changes\": %u, \"redundant_bindings\": %u }\n",
+			            result.visibleCount, result.drawCalls, result.programBindings, result.textureBindings, result.renderStateChanges, result.redundantBindings);
+			std::printf("}\n");
+		}
+		else
+		{
+			std::printf("%zu models, %zu materials, %zu lights, %zu sprites, %zu billboards, %zu particles (%u frames%s)\n",
+			            parameters.modelCount, parameters.materialCount, parameters.lightCount, parameters.spriteCount, parameters.billboardCount, parameters.particleCount, frameCount, (nullDraws) ? ", null draws" : "");
+
+			std::printf("  %-20s %12s\n", "stage", "us/frame");
+			std::printf("  %-20s %12.2f\n", "cull", result.cullTime / 1000.0);
+			std::printf("  %-20s %12.2f\n", "queue", result.queueTime / 1000.0);
+			std::printf("  %-20s %12.2f\n", "sort", result.sortTime / 1000.0);
+			std::printf("  %-20s %12.2f\n", "draw", result.drawTime / 1000.0);
+
+			std::printf("  %-20s %12s\n", "counter", "per frame");
+			std::printf("  %-20s %12zu\n", "visible", result.visibleCount);
+			std::printf("  %-20s %12u\n", "draw calls", result.drawCalls);
+			std::printf("  %-20s %12u\n", "program bindings", result.programBindings);
+			std::printf("  %-20s %12u\n", "texture bindings", result.textureBindings);
+			std::printf("  %-20s %12u\n", "state changes", result.renderStateChanges);
+			std::printf("  %-20s %12u\n", "redundant bindings", result.redundantBindings);
+		}
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	SceneParameters parameters;
+	bool json = false;
+	bool nullDraws = false;
+	std::size_t frameCount = 300;
+	std::size_t warmupFrameCount = 30;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const char* option = argv[i];
+		if (std::strcmp(option, "--help") == 0)
+		{
+			PrintUsage(argv[0]);
+			return EXIT_SUCCESS;
+		}
+
+		if (std::strcmp(option, "--null-draws") == 0)
+		{
+			nullDraws = true;
+			continue;
+		}
+
+		if (i + 1 >= argc)
+		{
+			PrintUsage(argv[0]);
+			return EXIT_FAILURE;
+		}
+
+		const char* value = argv[++i];
+		bool valid = true;
+		if (std::strcmp(option, "--billboards") == 0)
+			valid = ParseCount(value, &parameters.billboardCount);
+		else if (std::strcmp(option, "--format") == 0)
+		{
+			if (std::strcmp(value, "json") == 0)
+				json = true;
+			else if (std::strcmp(value, "text") == 0)
+				json = false;
+			else
+				valid = false;
+		}
+		else if (std::strcmp(option, "--frames") == 0)
+			valid = ParseCount(value, &frameCount) && frameCount > 0;
+		else if (std::strcmp(option, "--lights") == 0)
+			valid = ParseCount(value, &parameters.lightCount);
+		else if (std::strcmp(option, "--materials") == 0)
+			valid = ParseCount(value, &parameters.materialCount) && parameters.materialCount > 0;
+		else if (std::strcmp(option, "--models") == 0)
+			valid = ParseCount(value, &parameters.modelCount);
+		else if (std::strcmp(option, "--particles") == 0)
+			valid = ParseCount(value, &parameters.particleCount);
+		else if (std::strcmp(option, "--sprites") == 0)
+			valid = ParseCount(value, &parameters.spriteCount);
+		else if (std::strcmp(option, "--warmup") == 0)
+			valid = ParseCount(value, &warmupFrameCount);
+		else
+			valid = false;
+
+		if (!valid)
+		{
+			PrintUsage(argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	// Keeps the initialization messages out of the standard output, which may be parsed as JSON
+	Nz::Log::Enable(false);
+
+	// The renderer still needs an OpenGL context, created without any window
+	Nz::Initializer<Nz::Graphics> graphics;
+	if (!graphics)
+	{
+		std::fprintf(stderr, "Failed to initialize Graphics module\n");
+		return EXIT_FAILURE;
+	}
+
+	Nz::Log::GetLogger()->EnableStdReplication(false);
+	Nz::Log::Enable(true);
+
+	Nz::Renderer::EnableDrawSubmission(!nullDraws);
+
+	RenderBenchmark benchmark(parameters);
+	if (!benchmark.IsValid())
+	{
+		std::fprintf(stderr, "Failed to create render target\n");
+		return EXIT_FAILURE;
+	}
+
+	FrameResult result = benchmark.Run(static_cast<unsigned int>(warmupFrameCount), static_cast<unsigned int>(frameCount));
+
+	PrintResult(json, parameters, nullDraws, static_cast<unsigned int>(frameCount), result);
+
+	// Uninitialization messages would follow the results otherwise
+	Nz::Log::Enable(false);
+
+	return EXIT_SUCCESS;
+}
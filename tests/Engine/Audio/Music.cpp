@@ -44,6 +44,32 @@ SCENARIO("Music", "[AUDIO][MUSIC]")
 
 				Nz::Audio::SetGlobalVolume(100.f);
 			}
+
+			THEN("Two musics decoded by short buffers are streamed together")
+			{
+				Nz::Audio::SetGlobalVolume(0.f);
+
+				Nz::Music otherMusic;
+				REQUIRE(otherMusic.OpenFromFile("resources/Engine/Audio/The_Brabanconne.ogg"));
+
+				music.SetStreamBuffering(8, 100);
+				otherMusic.SetStreamBuffering(8, 100);
+				CHECK(music.GetStreamBufferCount() == 8);
+				CHECK(music.GetStreamBufferDuration() == 100);
+
+				music.Play();
+				otherMusic.Play();
+				Nz::Thread::Sleep(1500);
+				CHECK(music.GetPlayingOffset() >= 1400);
+				CHECK(otherMusic.GetPlayingOffset() >= 1400);
+				CHECK(music.GetStatus() == Nz::SoundStatus_Playing);
+
+				music.Stop();
+				CHECK(music.GetStatus() == Nz::SoundStatus_Stopped);
+				CHECK(otherMusic.GetStatus() == Nz::SoundStatus_Playing);
+
+				Nz::Audio::SetGlobalVolume(100.f);
+			}
 		}
 	}
 }
@@ -1,6 +1,13 @@
 #include <Nazara/Audio/SoundBuffer.hpp>
 #include <Catch/catch.hpp>
 
+#include <Nazara/Audio/SoundStream.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
 SCENARIO("SoundBuffer", "[AUDIO][SOUNDBUFFER]")
 {
 	GIVEN("A sound buffer")
@@ -18,4 +25,51 @@ SCENARIO("SoundBuffer", "[AUDIO][SOUNDBUFFER]")
 			}
 		}
 	}
+
+	GIVEN("Samples stored as ADPCM")
+	{
+		std::vector<Nz::Int16> samples(2 * 22050);
+		for (std::size_t i = 0; i < samples.size(); ++i)
+			samples[i] = static_cast<Nz::Int16>(std::sin((i / 2) * ((i % 2) ? 0.03f : 0.07f)) * 12000.f);
+
+		Nz::SoundBuffer pcmBuffer(Nz::AudioFormat_Stereo, samples.size(), 22050, samples.data());
+		Nz::SoundBuffer adpcmBuffer(Nz::AudioFormat_Stereo, samples.size(), 22050, samples.data(), Nz::SoundBufferStorage_ADPCM);
+
+		THEN("They take much less memory")
+		{
+			CHECK(adpcmBuffer.GetStorage() == Nz::SoundBufferStorage_ADPCM);
+			CHECK(adpcmBuffer.GetDuration() == pcmBuffer.GetDuration());
+			CHECK(adpcmBuffer.GetSamples() == nullptr);
+			CHECK(adpcmBuffer.GetMemoryUsage() * 3 < pcmBuffer.GetMemoryUsage());
+		}
+
+		WHEN("We decode them")
+		{
+			std::unique_ptr<Nz::SoundStream> stream = adpcmBuffer.OpenStream();
+			REQUIRE(stream);
+
+			std::vector<Nz::Int16> decodedSamples(samples.size());
+			REQUIRE(stream->Read(decodedSamples.data(), 1000) == 1000);
+			REQUIRE(stream->Read(&decodedSamples[1000], decodedSamples.size()) == decodedSamples.size() - 1000);
+
+			THEN("They stay close to the original samples, once the codec adapted to them")
+			{
+				int maxError = 0;
+				for (std::size_t i = 512; i < samples.size(); ++i)
+					maxError = std::max(maxError, std::abs(decodedSamples[i] - samples[i]));
+
+				CHECK(maxError < 500);
+			}
+
+			AND_THEN("We can seek in them")
+			{
+				stream->Seek(500);
+
+				Nz::Int16 frame[2];
+				REQUIRE(stream->Read(frame, 2) == 2);
+				CHECK(frame[0] == decodedSamples[2 * 11025]);
+				CHECK(frame[1] == decodedSamples[2 * 11025 + 1]);
+			}
+		}
+	}
 }
@@ -0,0 +1,69 @@
+#include <Nazara/Audio/VoiceManager.hpp>
+#include <Catch/catch.hpp>
+
+#include <Nazara/Audio/Audio.hpp>
+#include <cmath>
+#include <vector>
+
+SCENARIO("VoiceManager", "[AUDIO][VOICEMANAGER]")
+{
+	GIVEN("A voice manager with two sources and a mixing capacity of two voices")
+	{
+		std::vector<Nz::Int16> samples(44100);
+		for (std::size_t i = 0; i < samples.size(); ++i)
+			samples[i] = static_cast<Nz::Int16>(std::sin(i * 0.05f) * 10000.f);
+
+		Nz::SoundBufferRef buffer = Nz::SoundBuffer::New(Nz::AudioFormat_Mono, samples.size(), 44100, samples.data());
+		REQUIRE(buffer->IsValid());
+
+		Nz::Audio::SetGlobalVolume(0.f);
+		Nz::Audio::SetListenerPosition(Nz::Vector3f::Zero());
+
+		Nz::VoiceManager voiceManager(2, 2);
+		voiceManager.SetMaxDistance(50.f);
+
+		WHEN("We play more voices than it can make heard")
+		{
+			Nz::VoiceManager::VoiceId importantVoice = voiceManager.Play(buffer, Nz::Vector3f(10.f, 0.f, 0.f), 1);
+			voiceManager.Play(buffer, Nz::Vector3f(20.f, 0.f, 0.f), 1);
+			for (float distance : {1.f, 2.f, 3.f})
+				voiceManager.Play(buffer, Nz::Vector3f(distance, 0.f, 0.f), 0);
+
+			Nz::VoiceManager::VoiceId culledVoice = voiceManager.Play(buffer, Nz::Vector3f(100.f, 0.f, 0.f), 2);
+			voiceManager.Update(0.f);
+
+			THEN("Voices are split between the sources, the mix and the virtual voices")
+			{
+				CHECK(voiceManager.GetVoiceCount() == 6);
+				CHECK(voiceManager.GetSourceVoiceCount() == 2);
+				CHECK(voiceManager.GetMixedVoiceCount() == 2);
+				CHECK(voiceManager.GetVirtualVoiceCount() == 2);
+			}
+
+			AND_THEN("A stopped voice gives its source to another one")
+			{
+				voiceManager.StopVoice(importantVoice);
+				CHECK_FALSE(voiceManager.IsVoicePlaying(importantVoice));
+
+				voiceManager.Update(0.f);
+				CHECK(voiceManager.GetVoiceCount() == 5);
+				CHECK(voiceManager.GetSourceVoiceCount() == 2);
+				CHECK(voiceManager.GetMixedVoiceCount() == 2);
+				CHECK(voiceManager.GetVirtualVoiceCount() == 1);
+			}
+
+			AND_THEN("Culled voices keep playing until their end")
+			{
+				CHECK(voiceManager.IsVoicePlaying(culledVoice));
+
+				voiceManager.Update(1.5f);
+				CHECK_FALSE(voiceManager.IsVoicePlaying(culledVoice));
+			}
+
+			voiceManager.StopAll();
+			CHECK(voiceManager.GetVoiceCount() == 0);
+		}
+
+		Nz::Audio::SetGlobalVolume(100.f);
+	}
+}
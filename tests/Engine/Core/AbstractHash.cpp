@@ -3,6 +3,7 @@
 
 #include <Nazara/Core/ByteArray.hpp>
 
+#include <algorithm>
 #include <array>
 
 SCENARIO("AbstractHash", "[CORE][ABSTRACTHASH]")
@@ -24,4 +25,35 @@ SCENARIO("AbstractHash", "[CORE][ABSTRACTHASH]")
 			}
 		}
 	}
+
+	GIVEN("A text longer than the blocks of the hashes")
+	{
+		// Long enough to go through the block transforms, which may be hardware accelerated, and the long hash of XXH3
+		Nz::String text;
+		for (unsigned int i = 0; i < 1000; ++i)
+			text += static_cast<char>('a' + i % 26);
+
+		WHEN("We hash it by parts")
+		{
+			auto HashByParts = [&] (Nz::HashType type)
+			{
+				std::unique_ptr<Nz::AbstractHash> hash = Nz::AbstractHash::Get(type);
+				hash->Begin();
+
+				const Nz::UInt8* data = reinterpret_cast<const Nz::UInt8*>(text.GetConstBuffer());
+				for (std::size_t offset = 0; offset < text.GetSize(); offset += 333)
+					hash->Append(data + offset, std::min<std::size_t>(333, text.GetSize() - offset));
+
+				return hash->End().ToHex().ToUpper();
+			};
+
+			THEN("We get the same digest as known implementations")
+			{
+				CHECK(HashByParts(Nz::HashType_CRC32C) == "68C9C0EF");
+				CHECK(HashByParts(Nz::HashType_SHA1) == "0C1E754AD8A0130E18BF2D3B0A57E29AD95E75CD");
+				CHECK(HashByParts(Nz::HashType_SHA256) == "915E53A44C18B19BB06BA5B3F5FCAF1DC4651E8404C63425CFC6174E74659D87");
+				CHECK(HashByParts(Nz::HashType_XXH3) == "E153425558D7DA5D");
+			}
+		}
+	}
 }
@@ -89,4 +89,16 @@ TEST_CASE("ComputeHash", "[CORE][ALGORITHM]")
 		auto result = Nz::ComputeHash(Nz::HashType_Whirlpool, "1234");
 		REQUIRE(result.ToHex().ToUpper() == "2F9959B230A44678DD2DC29F037BA1159F233AA9AB183CE3A0678EAAE002E5AA6F27F47144A1A4365116D3DB1B58EC47896623B92D85CB2F191705DAF11858B8");
 	}
+
+	SECTION("Compute CRC32C of '1234'")
+	{
+		auto result = Nz::ComputeHash(Nz::HashType_CRC32C, "1234");
+		REQUIRE(result.ToHex().ToUpper() == "F63AF4EE");
+	}
+
+	SECTION("Compute XXH3 of '1234'")
+	{
+		auto result = Nz::ComputeHash(Nz::HashType_XXH3, "1234");
+		REQUIRE(result.ToHex().ToUpper() == "87B1E526910FD7E1");
+	}
 }
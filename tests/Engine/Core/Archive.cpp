@@ -0,0 +1,146 @@
+#include <Nazara/Core/Archive.hpp>
+#include <Nazara/Core/ArchiveBuilder.hpp>
+#include <Nazara/Core/Directory.hpp>
+#include <Nazara/Core/ErrorFlags.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/Lz4.hpp>
+#include <Nazara/Core/VirtualFile.hpp>
+#include <Nazara/Core/VirtualFileSystem.hpp>
+#include <Catch/catch.hpp>
+#include <cstring>
+
+SCENARIO("Archive", "[CORE][ARCHIVE]")
+{
+	GIVEN("An archive with compressible and incompressible entries")
+	{
+		Nz::ByteArray text;
+		for (unsigned int i = 0; i < 1000; ++i)
+			text.Append("Repeated text compresses well. ", 31);
+
+		Nz::ByteArray noise(4096, 0);
+		Nz::UInt32 seed = 42;
+		for (Nz::UInt8& byte : noise)
+		{
+			seed = seed * 1664525U + 1013904223U;
+			byte = static_cast<Nz::UInt8>(seed >> 24);
+		}
+
+		Nz::ArchiveBuilder builder;
+		builder.AddEntry("text.txt", text.GetConstBuffer(), text.GetSize());
+		builder.AddEntry("data/noise.bin", noise.GetConstBuffer(), noise.GetSize());
+		builder.AddEntry("data/empty.bin", nullptr, 0);
+		CHECK(builder.GetEntryCount() == 3);
+
+		REQUIRE(builder.Save("Test Archive.nzpk", 64));
+
+		WHEN("We open it")
+		{
+			Nz::Archive archive("Test Archive.nzpk");
+			REQUIRE(archive.IsOpen());
+			CHECK(archive.GetEntryCount() == 3);
+
+			THEN("Entries are found by path")
+			{
+				const Nz::Archive::Entry* textEntry = archive.FindEntry("text.txt");
+				REQUIRE(textEntry);
+				CHECK(archive.GetEntryPath(*textEntry) == "text.txt");
+				CHECK(textEntry->size == text.GetSize());
+				CHECK((textEntry->flags & Nz::Archive::EntryFlag_Compressed) != 0);
+				CHECK(textEntry->storedSize < textEntry->size);
+				CHECK(textEntry->offset % 64 == 0);
+
+				Nz::ByteArray content;
+				REQUIRE(archive.ReadEntry(*textEntry, &content));
+				CHECK(content == text);
+
+				const Nz::Archive::Entry* noiseEntry = archive.FindEntry("data/noise.bin");
+				REQUIRE(noiseEntry);
+				CHECK((noiseEntry->flags & Nz::Archive::EntryFlag_Compressed) == 0);
+				CHECK(noiseEntry->offset % 64 == 0);
+				CHECK(std::memcmp(archive.GetEntryData(*noiseEntry), noise.GetConstBuffer(), noise.GetSize()) == 0);
+
+				const Nz::Archive::Entry* emptyEntry = archive.FindEntry("data/empty.bin");
+				REQUIRE(emptyEntry);
+				CHECK(emptyEntry->size == 0);
+
+				CHECK(!archive.FindEntry("data"));
+				CHECK(!archive.FindEntry("Text.txt"));
+			}
+		}
+
+		WHEN("We mount it")
+		{
+			REQUIRE(Nz::VirtualFileSystem::Mount("Test Archive.nzpk", "VirtualDirectory"));
+
+			THEN("Its entries are seen as files of the mount point")
+			{
+				CHECK(Nz::VirtualFileSystem::Exists("VirtualDirectory/text.txt"));
+				CHECK(Nz::VirtualFileSystem::Exists("VirtualDirectory/other/../data/noise.bin"));
+				CHECK(!Nz::VirtualFileSystem::Exists("text.txt"));
+
+				Nz::VirtualFile file;
+				REQUIRE(Nz::VirtualFileSystem::Open("VirtualDirectory/data/noise.bin", &file));
+				CHECK(file.GetSize() == noise.GetSize());
+				CHECK(file.GetDirectory() == Nz::File::AbsolutePath("VirtualDirectory/data") + NAZARA_DIRECTORY_SEPARATOR);
+
+				Nz::ByteArray content(noise.GetSize(), 0);
+				REQUIRE(file.Read(content.GetBuffer(), content.GetSize()) == noise.GetSize());
+				CHECK(file.EndOfStream());
+				CHECK(content == noise);
+
+				REQUIRE(Nz::VirtualFileSystem::Open("VirtualDirectory/text.txt", &file));
+				CHECK(file.GetSize() == text.GetSize());
+				CHECK(std::memcmp(file.GetData(), text.GetConstBuffer(), text.GetSize()) == 0);
+			}
+
+			CHECK(Nz::VirtualFileSystem::Unmount("Test Archive.nzpk"));
+			CHECK(!Nz::VirtualFileSystem::Exists("VirtualDirectory/text.txt"));
+		}
+
+		Nz::File::Delete("Test Archive.nzpk");
+	}
+
+	GIVEN("A file which isn't an archive")
+	{
+		Nz::Archive archive;
+
+		THEN("It can't be opened")
+		{
+			Nz::ErrorFlags errFlags(Nz::ErrorFlag_Silent);
+			CHECK(!archive.Open("resources/Engine/Core/FileTest.txt"));
+			CHECK(!archive.IsOpen());
+		}
+	}
+}
+
+SCENARIO("Lz4", "[CORE][LZ4]")
+{
+	GIVEN("Some data")
+	{
+		Nz::ByteArray data;
+		for (unsigned int i = 0; i < 4096; ++i)
+			data.PushBack(static_cast<Nz::UInt8>((i % 64 < 32) ? i % 7 : i % 13));
+
+		WHEN("We compress it")
+		{
+			Nz::ByteArray compressed(Nz::Lz4::GetMaxCompressedSize(data.GetSize()), 0);
+			std::size_t compressedSize = Nz::Lz4::Compress(data.GetConstBuffer(), data.GetSize(), compressed.GetBuffer(), compressed.GetSize());
+
+			THEN("It gets smaller and decompresses back")
+			{
+				REQUIRE(compressedSize > 0);
+				CHECK(compressedSize < data.GetSize());
+
+				Nz::ByteArray decompressed(data.GetSize(), 0);
+				CHECK(Nz::Lz4::Decompress(compressed.GetConstBuffer(), compressedSize, decompressed.GetBuffer(), decompressed.GetSize()) == data.GetSize());
+				CHECK(decompressed == data);
+			}
+
+			AND_THEN("Truncated data is rejected")
+			{
+				Nz::ByteArray decompressed(data.GetSize(), 0);
+				CHECK(Nz::Lz4::Decompress(compressed.GetConstBuffer(), compressedSize, decompressed.GetBuffer(), decompressed.GetSize() / 2) == 0);
+			}
+		}
+	}
+}
@@ -0,0 +1,131 @@
+#include <Nazara/Core/AsyncLogger.hpp>
+#include <Catch/catch.hpp>
+
+#include <Nazara/Core/Thread.hpp>
+#include <atomic>
+#include <vector>
+
+namespace
+{
+	class RecordingLogger : public Nz::AbstractLogger
+	{
+		public:
+			RecordingLogger(std::vector<Nz::String>& messages, std::atomic_uint& flushCount) :
+			m_flushCount(flushCount),
+			m_messages(messages)
+			{
+			}
+
+			void EnableStdReplication(bool) override
+			{
+			}
+
+			void Flush() override
+			{
+				m_flushCount++;
+			}
+
+			bool IsStdReplicationEnabled() const override
+			{
+				return false;
+			}
+
+			void Write(const Nz::String& string) override
+			{
+				m_messages.push_back(string);
+			}
+
+		private:
+			std::atomic_uint& m_flushCount;
+			std::vector<Nz::String>& m_messages;
+	};
+}
+
+SCENARIO("AsyncLogger", "[CORE][ASYNCLOGGER]")
+{
+	GIVEN("An asynchronous logger which isn't flushed by its period")
+	{
+		std::atomic_uint flushCount(0);
+		std::vector<Nz::String> messages;
+
+		Nz::AsyncLogger logger(new RecordingLogger(messages, flushCount), 60000);
+
+		WHEN("We write messages from several threads")
+		{
+			const unsigned int threadCount = 4;
+			const unsigned int messageCount = 500;
+
+			std::vector<Nz::Thread> threads;
+			for (unsigned int i = 0; i < threadCount; ++i)
+			{
+				threads.emplace_back([&logger, i, messageCount] ()
+				{
+					for (unsigned int j = 0; j < messageCount; ++j)
+						logger.Write(Nz::String::Number(i) + ':' + Nz::String::Number(j));
+				});
+			}
+
+			for (Nz::Thread& thread : threads)
+				thread.Join();
+
+			logger.Flush();
+
+			THEN("Every message is written once flushed, in the order of each thread")
+			{
+				REQUIRE(messages.size() == threadCount * messageCount);
+				CHECK(flushCount > 0);
+
+				std::vector<long long> lastMessage(threadCount, -1);
+				bool ordered = true;
+				for (const Nz::String& message : messages)
+				{
+					long long thread = 0;
+					long long index = 0;
+					if (!message.SubStringTo(':').ToInteger(&thread) || !message.SubStringFrom(':').ToInteger(&index) || thread >= threadCount)
+					{
+						ordered = false;
+						break;
+					}
+
+					long long& last = lastMessage[static_cast<std::size_t>(thread)];
+					if (index != last + 1)
+						ordered = false;
+
+					last = index;
+				}
+
+				CHECK(ordered);
+			}
+		}
+
+		WHEN("We write an internal error")
+		{
+			logger.Write("Before");
+			logger.WriteError(Nz::ErrorType_Internal, "Something went wrong");
+
+			THEN("It is written before returning, after what was queued")
+			{
+				REQUIRE(messages.size() == 2);
+				CHECK(messages[0] == "Before");
+				CHECK(messages[1].Contains("Something went wrong"));
+			}
+		}
+	}
+
+	GIVEN("An asynchronous logger being destroyed")
+	{
+		std::atomic_uint flushCount(0);
+		std::vector<Nz::String> messages;
+
+		{
+			Nz::AsyncLogger logger(new RecordingLogger(messages, flushCount), 60000);
+			logger.Write("Last words");
+		}
+
+		THEN("It wrote its queued messages")
+		{
+			REQUIRE(messages.size() == 1);
+			CHECK(messages[0] == "Last words");
+		}
+	}
+}
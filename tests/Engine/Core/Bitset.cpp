@@ -3,12 +3,14 @@
 #include <Catch/catch.hpp>
 #include <array>
 #include <string>
+#include <vector>
 #include <iostream>
 
 template<typename Block> void Check(const char* title);
 template<typename Block> void CheckAppend(const char* title);
 template<typename Block> void CheckBitOps(const char* title);
 template<typename Block> void CheckBitOpsMultipleBlocks(const char* title);
+template<typename Block> void CheckBulkOps(const char* title);
 template<typename Block> void CheckConstructor(const char* title);
 template<typename Block> void CheckCopyMoveSwap(const char* title);
 template<typename Block> void CheckRead(const char* title);
@@ -30,6 +32,7 @@ void Check(const char* title)
 
 	CheckBitOps<Block>(title);
 	CheckBitOpsMultipleBlocks<Block>(title);
+	CheckBulkOps<Block>(title);
 
 	CheckAppend<Block>(title);
 	CheckRead<Block>(title);
@@ -181,6 +184,96 @@ void CheckBitOpsMultipleBlocks(const char* title)
 	}
 }
 
+template<typename Block>
+void CheckBulkOps(const char* title)
+{
+	SECTION(title)
+	{
+		GIVEN("Two bitsets spanning many blocks")
+		{
+			// Enough bits to go through the SIMD path and the remaining blocks
+			constexpr std::size_t bitCount = 333;
+
+			Nz::Bitset<Block> first(bitCount, false);
+			Nz::Bitset<Block> second(bitCount - 100, false);
+			for (std::size_t i = 0; i < bitCount; ++i)
+			{
+				if ((i * 7) % 5 < 2)
+					first.Set(i);
+
+				if (i < second.GetSize() && (i * 3) % 4 == 1)
+					second.Set(i);
+			}
+
+			WHEN("We perform bulk operators")
+			{
+				Nz::Bitset<Block> andNotBitset;
+				andNotBitset.PerformsANDNOT(first, second);
+
+				Nz::Bitset<Block> andBitset = first & second;
+				Nz::Bitset<Block> orBitset = first | second;
+				Nz::Bitset<Block> xorBitset = first ^ second;
+
+				THEN("Every bit should match the logical operator")
+				{
+					bool bitsMatch = true;
+					for (std::size_t i = 0; i < bitCount; ++i)
+					{
+						bool a = first.Test(i);
+						bool b = i < second.GetSize() && second.Test(i);
+
+						if (andNotBitset.Test(i) != (a && !b) || andBitset.Test(i) != (a && b) || orBitset.Test(i) != (a || b) || xorBitset.Test(i) != (a != b))
+							bitsMatch = false;
+					}
+
+					CHECK(bitsMatch);
+					CHECK(andNotBitset.GetSize() == bitCount);
+					CHECK(andNotBitset.Count() + andBitset.Count() == first.Count());
+					CHECK(!andNotBitset.Intersects(second));
+				}
+			}
+
+			WHEN("We check subsets")
+			{
+				Nz::Bitset<Block> subset = first & second;
+
+				THEN("Only bitsets whose every enabled bit is in the other one are subsets")
+				{
+					CHECK(subset.IsSubsetOf(first));
+					CHECK(subset.IsSubsetOf(second));
+					CHECK(!first.IsSubsetOf(second));
+					CHECK(Nz::Bitset<Block>().IsSubsetOf(second));
+					CHECK(first.IsSubsetOf(first));
+
+					Nz::Bitset<Block> extended(second);
+					extended.UnboundedSet(bitCount + 50);
+					CHECK(!extended.IsSubsetOf(second));
+					CHECK(second.IsSubsetOf(extended));
+				}
+			}
+
+			WHEN("We visit every enabled bit")
+			{
+				std::vector<std::size_t> visitedBits;
+				first.ForEachSetBit([&](std::size_t bit)
+				{
+					visitedBits.push_back(bit);
+				});
+
+				THEN("They should be the same as the ones found by FindNext")
+				{
+					std::vector<std::size_t> foundBits;
+					for (std::size_t i = first.FindFirst(); i != first.npos; i = first.FindNext(i))
+						foundBits.push_back(i);
+
+					CHECK(visitedBits == foundBits);
+					CHECK(visitedBits.size() == first.Count());
+				}
+			}
+		}
+	}
+}
+
 template<typename Block>
 void CheckConstructor(const char* title)
 {
@@ -0,0 +1,119 @@
+#include <Nazara/Core/ByteArrayPool.hpp>
+#include <Nazara/Core/MemoryStream.hpp>
+#include <Catch/catch.hpp>
+#include <array>
+#include <vector>
+
+SCENARIO("ByteArrayPool", "[CORE][BYTEARRAYPOOL]")
+{
+	GIVEN("A pool")
+	{
+		Nz::ByteArrayPool pool(64 * 1024);
+
+		WHEN("We acquire a byte array")
+		{
+			Nz::ByteArray byteArray = pool.Acquire(1000);
+
+			THEN("It is empty and big enough")
+			{
+				CHECK(byteArray.IsEmpty());
+				CHECK(byteArray.GetCapacity() >= 1000);
+			}
+
+			AND_WHEN("We release it and acquire a smaller one")
+			{
+				byteArray.Append("Nazara", 6);
+				const Nz::UInt8* storage = byteArray.GetConstBuffer();
+
+				pool.Release(std::move(byteArray));
+				CHECK(byteArray.GetCapacity() == 0);
+				CHECK(pool.GetHeldBufferCount() == 1);
+				CHECK(pool.GetHeldBytes() >= 1000);
+
+				Nz::ByteArray reused = pool.Acquire(600);
+
+				THEN("The storage is reused")
+				{
+					CHECK(reused.IsEmpty());
+					CHECK(reused.GetConstBuffer() == storage);
+					CHECK(pool.GetHeldBufferCount() == 0);
+					CHECK(pool.GetHeldBytes() == 0);
+				}
+			}
+		}
+
+		WHEN("We release more than the pool can hold")
+		{
+			std::vector<Nz::ByteArray> byteArrays;
+			for (unsigned int i = 0; i < 4; ++i)
+				byteArrays.push_back(pool.Acquire(32 * 1024));
+
+			for (Nz::ByteArray& byteArray : byteArrays)
+				pool.Release(std::move(byteArray));
+
+			THEN("Buffers above the limit are freed")
+			{
+				CHECK(pool.GetHeldBufferCount() == 2);
+				CHECK(pool.GetHeldBytes() <= pool.GetMaxHeldBytes());
+			}
+		}
+	}
+
+	GIVEN("A memory stream")
+	{
+		Nz::ByteArray byteArray;
+		Nz::MemoryStream stream(&byteArray);
+
+		std::array<Nz::UInt8, 1000> data;
+		for (std::size_t i = 0; i < data.size(); ++i)
+			data[i] = static_cast<Nz::UInt8>(i);
+
+		WHEN("We write with a linear growth policy")
+		{
+			stream.SetGrowthPolicy(Nz::GrowthPolicy_Linear, 4096);
+
+			for (unsigned int i = 0; i < 5; ++i)
+				REQUIRE(stream.Write(data.data(), data.size()) == data.size());
+
+			THEN("The capacity grows by increments")
+			{
+				CHECK(byteArray.GetSize() == 5000);
+				CHECK(byteArray.GetCapacity() == 8192);
+				CHECK(byteArray[4999] == data[999]);
+			}
+		}
+
+		WHEN("We write through a pool")
+		{
+			Nz::ByteArrayPool pool;
+			stream.SetBufferPool(&pool);
+			stream.SetGrowthPolicy(Nz::GrowthPolicy_Exact);
+			stream.Reserve(500);
+
+			for (unsigned int i = 0; i < 3; ++i)
+				REQUIRE(stream.Write(data.data(), data.size()) == data.size());
+
+			THEN("Outgrown buffers are given back to the pool")
+			{
+				CHECK(byteArray.GetSize() == 3000);
+				CHECK(pool.GetHeldBufferCount() > 0);
+
+				for (std::size_t i = 0; i < byteArray.GetSize(); ++i)
+					REQUIRE(byteArray[i] == data[i % data.size()]);
+			}
+
+			AND_WHEN("We overwrite the middle of the stream")
+			{
+				stream.SetCursorPos(1500);
+				REQUIRE(stream.Write(data.data(), 100) == 100);
+
+				THEN("Its size doesn't change")
+				{
+					CHECK(byteArray.GetSize() == 3000);
+					CHECK(byteArray[1500] == data[0]);
+					CHECK(byteArray[1600] == data[600]);
+				}
+			}
+		}
+	}
+}
@@ -70,4 +70,83 @@ SCENARIO("ByteStream", "[CORE][BYTESTREAM]")
 			}
 		}
 	}
-}
\ No newline at end of file
+
+	GIVEN("A bytestream with a byte array")
+	{
+		Nz::ByteArray byteArray;
+		Nz::ByteStream byteStream(&byteArray);
+
+		WHEN("We pack values on a few bits, mixed with booleans")
+		{
+			REQUIRE(byteStream.WriteBits(5, 3));
+			byteStream << true;
+			REQUIRE(byteStream.WriteBits(0x3FF, 10));
+			REQUIRE(byteStream.WriteBits(0x123456789ABCDEF0ULL, 64));
+			byteStream.FlushBits();
+
+			THEN("They only take the bits they need")
+			{
+				CHECK(byteArray.GetSize() == 10); //< 78 bits
+
+				Nz::ByteStream readStream(&byteArray);
+
+				Nz::UInt64 value;
+				REQUIRE(readStream.ReadBits(&value, 3));
+				CHECK(value == 5);
+
+				bool boolean = false;
+				readStream >> boolean;
+				CHECK(boolean);
+
+				REQUIRE(readStream.ReadBits(&value, 10));
+				CHECK(value == 0x3FF);
+
+				REQUIRE(readStream.ReadBits(&value, 64));
+				CHECK(value == 0x123456789ABCDEF0ULL);
+
+				CHECK_FALSE(readStream.ReadBits(&value, 8));
+			}
+		}
+	}
+
+	GIVEN("A bytestream over a fixed region")
+	{
+		std::array<Nz::UInt8, 15> region;
+		Nz::ByteStream byteStream(region.data(), region.size());
+		byteStream.SetDataEndianness(Nz::Endianness_BigEndian);
+
+		WHEN("We write values in one go")
+		{
+			REQUIRE(byteStream.WriteValues(Nz::UInt32(0x01020304), Nz::UInt8(5), Nz::UInt16(0x0607), 1.5));
+
+			THEN("They are laid out as operator<< would")
+			{
+				CHECK(region[0] == 0x01);
+				CHECK(region[3] == 0x04);
+				CHECK(region[4] == 0x05);
+				CHECK(region[5] == 0x06);
+				CHECK(region[6] == 0x07);
+
+				Nz::ByteStream readStream(static_cast<const void*>(region.data()), region.size());
+				readStream.SetDataEndianness(Nz::Endianness_BigEndian);
+
+				Nz::UInt32 a;
+				Nz::UInt8 b;
+				readStream >> a >> b;
+				CHECK(a == 0x01020304);
+				CHECK(b == 5);
+
+				Nz::UInt16 c;
+				double d;
+				REQUIRE(readStream.ReadValues(c, d));
+				CHECK(c == 0x0607);
+				CHECK(d == Approx(1.5));
+			}
+
+			AND_THEN("Values that don't fit are not written")
+			{
+				CHECK_FALSE(byteStream.WriteValues(Nz::UInt64(0)));
+			}
+		}
+	}
+}
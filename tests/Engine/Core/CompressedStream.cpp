@@ -0,0 +1,144 @@
+#include <Nazara/Core/CompressedStream.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/ByteStream.hpp>
+#include <Nazara/Core/MemoryStream.hpp>
+#include <Catch/catch.hpp>
+#include <vector>
+
+SCENARIO("CompressedStream", "[CORE][COMPRESSEDSTREAM]")
+{
+	GIVEN("Records written through a compressed stream with small blocks")
+	{
+		constexpr std::size_t BlockSize = 1024;
+		constexpr Nz::UInt32 RecordCount = 10000;
+
+		Nz::ByteArray compressedData;
+		Nz::MemoryStream memoryStream(&compressedData, Nz::OpenMode_WriteOnly);
+
+		Nz::UInt64 uncompressedSize;
+		{
+			Nz::CompressedStream compressedStream(&memoryStream, Nz::OpenMode_WriteOnly, BlockSize);
+			REQUIRE(compressedStream.IsOpen());
+
+			Nz::ByteStream writer(&compressedStream);
+			for (Nz::UInt32 i = 0; i < RecordCount; ++i)
+				writer << i << static_cast<float>(i % 16);
+
+			uncompressedSize = compressedStream.GetSize();
+		}
+
+		CHECK(uncompressedSize == RecordCount * (sizeof(Nz::UInt32) + sizeof(float)));
+		CHECK(compressedData.GetSize() < uncompressedSize);
+
+		WHEN("We read them back")
+		{
+			Nz::MemoryStream readStream(&compressedData, Nz::OpenMode_ReadOnly);
+			Nz::CompressedStream compressedStream(&readStream, Nz::OpenMode_ReadOnly);
+			REQUIRE(compressedStream.IsOpen());
+
+			THEN("We get the same values")
+			{
+				CHECK(compressedStream.GetBlockSize() == BlockSize);
+				CHECK(compressedStream.GetSize() == uncompressedSize);
+
+				Nz::ByteStream reader(&compressedStream);
+
+				bool identical = true;
+				for (Nz::UInt32 i = 0; i < RecordCount; ++i)
+				{
+					Nz::UInt32 integer;
+					float floatingPoint;
+					reader >> integer >> floatingPoint;
+
+					identical = identical && integer == i && floatingPoint == static_cast<float>(i % 16);
+				}
+
+				CHECK(identical);
+				CHECK(compressedStream.EndOfStream());
+			}
+
+			AND_THEN("We can jump to any record")
+			{
+				for (Nz::UInt32 i : { 9999U, 0U, 4321U, 128U })
+				{
+					REQUIRE(compressedStream.SetCursorPos(i * 8ULL));
+
+					Nz::ByteStream reader(&compressedStream);
+
+					Nz::UInt32 integer;
+					reader >> integer;
+					CHECK(integer == i);
+				}
+			}
+		}
+
+		WHEN("The seek table is missing")
+		{
+			// Data whose compressed stream wasn't closed ends with the last block
+			Nz::ByteArray truncatedData(compressedData.GetConstBuffer(), compressedData.GetSize() - Nz::CompressedStream::FooterSize);
+
+			Nz::MemoryStream readStream(&truncatedData, Nz::OpenMode_ReadOnly);
+			Nz::CompressedStream compressedStream(&readStream, Nz::OpenMode_ReadOnly);
+
+			THEN("The blocks are found from their headers")
+			{
+				REQUIRE(compressedStream.IsOpen());
+				CHECK(compressedStream.GetSize() == uncompressedSize);
+
+				REQUIRE(compressedStream.SetCursorPos(5000 * 8ULL));
+
+				Nz::ByteStream reader(&compressedStream);
+
+				Nz::UInt32 integer;
+				reader >> integer;
+				CHECK(integer == 5000);
+			}
+		}
+	}
+
+	GIVEN("Data which cannot be compressed")
+	{
+		std::vector<Nz::UInt8> data(5000);
+
+		Nz::UInt32 state = 12345;
+		for (Nz::UInt8& byte : data)
+		{
+			state = state * 1664525U + 1013904223U;
+			byte = static_cast<Nz::UInt8>(state >> 24);
+		}
+
+		Nz::ByteArray compressedData;
+		Nz::MemoryStream memoryStream(&compressedData, Nz::OpenMode_WriteOnly);
+		{
+			Nz::CompressedStream compressedStream(&memoryStream, Nz::OpenMode_WriteOnly, 2048);
+			CHECK(compressedStream.Write(data.data(), data.size()) == data.size());
+		}
+
+		THEN("It is stored as is and read back")
+		{
+			CHECK(compressedData.GetSize() <= data.size() + 128);
+
+			Nz::MemoryStream readStream(&compressedData, Nz::OpenMode_ReadOnly);
+			Nz::CompressedStream compressedStream(&readStream, Nz::OpenMode_ReadOnly);
+			REQUIRE(compressedStream.GetBlockCount() == 3);
+
+			std::vector<Nz::UInt8> readData(data.size());
+			CHECK(compressedStream.Read(readData.data(), readData.size()) == data.size());
+			CHECK(readData == data);
+			CHECK(compressedStream.Read(readData.data(), 1) == 0);
+		}
+	}
+
+	GIVEN("Something which isn't a compressed stream")
+	{
+		Nz::ByteArray data("Not compressed at all", 21);
+		Nz::MemoryStream readStream(&data, Nz::OpenMode_ReadOnly);
+
+		THEN("It can't be opened")
+		{
+			Nz::CompressedStream compressedStream;
+			CHECK_FALSE(compressedStream.Open(&readStream, Nz::OpenMode_ReadOnly));
+			CHECK_FALSE(compressedStream.IsOpen());
+		}
+	}
+}
@@ -0,0 +1,163 @@
+#include <Nazara/Core/ConcurrentMemoryPool.hpp>
+#include <Nazara/Core/PoolAllocator.hpp>
+#include <Nazara/Core/TaskGroup.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Catch/catch.hpp>
+
+#include <Nazara/Math/Vector2.hpp>
+#include <atomic>
+#include <list>
+#include <set>
+#include <vector>
+
+SCENARIO("ConcurrentMemoryPool", "[CORE][CONCURRENTMEMORYPOOL]")
+{
+	GIVEN("A ConcurrentMemoryPool of Nz::Vector2<int> with small chunks")
+	{
+		Nz::ConcurrentMemoryPool memoryPool(sizeof(Nz::Vector2<int>), 4, 4);
+
+		WHEN("We construct more vectors than the first chunk can hold")
+		{
+			std::vector<Nz::Vector2<int>*> vectors;
+			for (int i = 0; i < 20; ++i)
+				vectors.push_back(memoryPool.New<Nz::Vector2<int>>(i, -i));
+
+			THEN("Every vector gets its own block and the pool grew")
+			{
+				std::set<Nz::Vector2<int>*> addresses(vectors.begin(), vectors.end());
+				CHECK(addresses.size() == vectors.size());
+				CHECK(memoryPool.GetBlockCount() >= vectors.size());
+
+				for (int i = 0; i < 20; ++i)
+					CHECK(*vectors[i] == Nz::Vector2<int>(i, -i));
+			}
+
+			AND_THEN("Freed blocks are reused")
+			{
+				std::size_t blockCount = memoryPool.GetBlockCount();
+
+				for (Nz::Vector2<int>* vector : vectors)
+					memoryPool.Delete(vector);
+
+				for (int i = 0; i < 20; ++i)
+					vectors[i] = memoryPool.New<Nz::Vector2<int>>(i, i);
+
+				CHECK(memoryPool.GetBlockCount() == blockCount);
+
+				for (Nz::Vector2<int>* vector : vectors)
+					memoryPool.Delete(vector);
+			}
+		}
+
+		WHEN("We allocate more than a block")
+		{
+			void* ptr = memoryPool.Allocate(memoryPool.GetBlockSize() * 4);
+
+			THEN("Memory comes from the heap and can be freed through the pool")
+			{
+				REQUIRE(ptr);
+				memoryPool.Free(ptr);
+			}
+		}
+	}
+
+	GIVEN("A ConcurrentMemoryPool shared by tasks")
+	{
+		Nz::ConcurrentMemoryPool memoryPool(sizeof(Nz::UInt64), 16, 8);
+
+		WHEN("Tasks allocate, check and free blocks concurrently")
+		{
+			std::atomic_uint errorCount(0);
+			Nz::TaskGroup group;
+
+			for (unsigned int task = 0; task < 32; ++task)
+			{
+				Nz::TaskScheduler::AddTask(group, [&memoryPool, &errorCount, task]()
+				{
+					std::vector<Nz::UInt64*> values;
+					for (unsigned int i = 0; i < 200; ++i)
+					{
+						Nz::UInt64* value = memoryPool.New<Nz::UInt64>(Nz::UInt64(task) << 32 | i);
+						values.push_back(value);
+
+						if (i % 3 == 0)
+						{
+							memoryPool.Delete(values.front());
+							values.erase(values.begin());
+						}
+					}
+
+					for (Nz::UInt64* value : values)
+					{
+						if ((*value >> 32) != task)
+							errorCount++;
+
+						memoryPool.Delete(value);
+					}
+				});
+			}
+
+			Nz::TaskScheduler::Run();
+			Nz::TaskScheduler::WaitForTasks(group);
+
+			THEN("No block was given to two owners at once")
+			{
+				CHECK(errorCount == 0);
+			}
+		}
+
+		WHEN("Blocks allocated by a thread are freed by others")
+		{
+			std::vector<Nz::UInt64*> values;
+			for (unsigned int i = 0; i < 256; ++i)
+				values.push_back(memoryPool.New<Nz::UInt64>(i));
+
+			Nz::TaskGroup group;
+			for (unsigned int task = 0; task < 8; ++task)
+			{
+				Nz::TaskScheduler::AddTask(group, [&memoryPool, &values, task]()
+				{
+					for (unsigned int i = task * 32; i < (task + 1) * 32; ++i)
+						memoryPool.Delete(values[i]);
+				});
+			}
+
+			Nz::TaskScheduler::Run();
+			Nz::TaskScheduler::WaitForTasks(group);
+
+			THEN("They can be allocated again")
+			{
+				for (unsigned int i = 0; i < 256; ++i)
+					values[i] = memoryPool.New<Nz::UInt64>(i * 2);
+
+				for (unsigned int i = 0; i < 256; ++i)
+				{
+					CHECK(*values[i] == i * 2);
+					memoryPool.Delete(values[i]);
+				}
+			}
+		}
+	}
+
+	GIVEN("A PoolAllocator")
+	{
+		Nz::ConcurrentMemoryPool memoryPool(64);
+		Nz::PoolAllocator<int> allocator(memoryPool);
+
+		WHEN("We use it in a std::list")
+		{
+			std::list<int, Nz::PoolAllocator<int>> list(allocator);
+			for (int i = 0; i < 100; ++i)
+				list.push_back(i);
+
+			THEN("Nodes come from the pool")
+			{
+				CHECK(list.size() == 100);
+				CHECK(list.front() == 0);
+				CHECK(list.back() == 99);
+				CHECK(list.get_allocator() == allocator);
+				CHECK(&list.get_allocator().GetPool() == &memoryPool);
+			}
+		}
+	}
+}
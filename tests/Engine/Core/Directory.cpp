@@ -1,5 +1,9 @@
 #include <Nazara/Core/Directory.hpp>
+#include <Nazara/Core/DirectoryCache.hpp>
+#include <Nazara/Core/File.hpp>
 #include <Catch/catch.hpp>
+#include <algorithm>
+#include <cstring>
 
 SCENARIO("Directory", "[CORE][DIRECTORY]")
 {
@@ -32,3 +36,100 @@ SCENARIO("Directory", "[CORE][DIRECTORY]")
 	}
 }
 
+
+SCENARIO("Directory scan", "[CORE][DIRECTORY]")
+{
+	GIVEN("A small tree of directories and files")
+	{
+		Nz::String root = Nz::Directory::GetCurrent() + "/Scan Directory";
+		Nz::Directory::Remove(root, true);
+
+		REQUIRE(Nz::Directory::Create(root + "/A/B", true));
+		REQUIRE(Nz::Directory::Create(root + "/C", true));
+
+		auto CreateFile = [](const Nz::String& filePath, const char* content)
+		{
+			Nz::File file(filePath, Nz::OpenMode_WriteOnly | Nz::OpenMode_Truncate);
+			file.Write(content, std::strlen(content));
+		};
+
+		CreateFile(root + "/root.txt", "root");
+		CreateFile(root + "/A/a.txt", "file a");
+		CreateFile(root + "/A/B/b.txt", "file b!");
+
+		auto FindEntry = [](const std::vector<Nz::DirectoryEntry>& entries, const Nz::String& path) -> const Nz::DirectoryEntry*
+		{
+			auto it = std::find_if(entries.begin(), entries.end(), [&](const Nz::DirectoryEntry& entry) { return entry.path == Nz::File::NormalizePath(path); });
+			return (it != entries.end()) ? &*it : nullptr;
+		};
+
+		WHEN("We scan it")
+		{
+			std::vector<Nz::DirectoryEntry> entries;
+			REQUIRE(Nz::Directory::Scan(root, &entries));
+
+			THEN("Every entry is found, with its metadata")
+			{
+				CHECK(entries.size() == 6);
+
+				const Nz::DirectoryEntry* fileB = FindEntry(entries, root + "/A/B/b.txt");
+				REQUIRE(fileB);
+				CHECK(fileB->size == 7);
+				CHECK_FALSE(fileB->isDirectory);
+				CHECK(fileB->lastWriteTime > 0);
+
+				const Nz::DirectoryEntry* directoryA = FindEntry(entries, root + "/A");
+				REQUIRE(directoryA);
+				CHECK(directoryA->isDirectory);
+			}
+
+			AND_WHEN("We only scan its first level")
+			{
+				entries.clear();
+				REQUIRE(Nz::Directory::Scan(root, &entries, false));
+
+				THEN("Subdirectories are not listed")
+				{
+					CHECK(entries.size() == 3);
+				}
+			}
+		}
+
+		WHEN("We scan it through a cache")
+		{
+			Nz::DirectoryCache cache;
+
+			std::vector<Nz::DirectoryEntry> entries;
+			REQUIRE(Nz::Directory::Scan(root, &entries, true, &cache));
+			CHECK(cache.GetDirectoryCount() == 4);
+
+			AND_WHEN("A directory is modified, and the cache is saved and loaded back")
+			{
+				Nz::Directory::Remove(root + "/C", true);
+				CreateFile(root + "/A/new.txt", "new");
+
+				Nz::String cachePath = Nz::Directory::GetCurrent() + "/ScanDirectory.cache";
+
+				Nz::DirectoryCache loadedCache;
+				REQUIRE(cache.SaveToFile(cachePath));
+				REQUIRE(loadedCache.LoadFromFile(cachePath));
+				CHECK(loadedCache.GetDirectoryCount() == 4);
+
+				entries.clear();
+				REQUIRE(Nz::Directory::Scan(root, &entries, true, &loadedCache));
+
+				Nz::File::Delete(cachePath);
+
+				THEN("Changes are found and removed directories leave the cache")
+				{
+					CHECK(entries.size() == 6);
+					CHECK(FindEntry(entries, root + "/A/new.txt"));
+					CHECK_FALSE(FindEntry(entries, root + "/C"));
+					CHECK(loadedCache.GetDirectoryCount() == 3);
+				}
+			}
+		}
+
+		Nz::Directory::Remove(root, true);
+	}
+}
@@ -1,5 +1,7 @@
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/ErrorFlags.hpp>
 #include <Catch/catch.hpp>
+#include <stdexcept>
 
 SCENARIO("Error", "[CORE][ERROR]")
 {
@@ -24,5 +26,55 @@ SCENARIO("Error", "[CORE][ERROR]")
 		}
 	}
 
+	GIVEN("Discarded errors")
+	{
+		Nz::Error::Trigger(Nz::ErrorType_Normal, "Kept");
+
+		bool messageBuilt = false;
+		auto BuildMessage = [&messageBuilt]()
+		{
+			messageBuilt = true;
+			return Nz::String("Discarded");
+		};
+
+		WHEN("An error is triggered while they are discarded")
+		{
+			{
+				Nz::ErrorFlags flags(Nz::ErrorFlag_Discard | Nz::ErrorFlag_Silent, true);
+				NazaraError(BuildMessage());
+			}
+
+			THEN("Its message is never built")
+			{
+				CHECK_FALSE(messageBuilt);
+				CHECK(Nz::Error::GetLastError() == "Kept");
+			}
+		}
+
+		WHEN("The error would throw an exception")
+		{
+			bool thrown = false;
+			{
+				Nz::ErrorFlags flags(Nz::ErrorFlag_Discard | Nz::ErrorFlag_Silent | Nz::ErrorFlag_ThrowException, true);
+
+				try
+				{
+					NazaraError(BuildMessage());
+				}
+				catch (const std::runtime_error&)
+				{
+					thrown = true;
+				}
+			}
+
+			THEN("It isn't discarded")
+			{
+				CHECK(thrown);
+				CHECK(messageBuilt);
+				CHECK(Nz::Error::GetLastError() == "Discarded");
+			}
+		}
+	}
+
 	Nz::Error::SetFlags(oldFlags);
 }
@@ -1,6 +1,13 @@
 #include <Nazara/Core/File.hpp>
 #include <Nazara/Core/Directory.hpp>
 #include <Catch/catch.hpp>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <vector>
 
 SCENARIO("File", "[CORE][FILE]")
 {
@@ -94,5 +101,108 @@ SCENARIO("File", "[CORE][FILE]")
 				REQUIRE(Nz::File::AbsolutePath(containingDoubleDot).EndsWith(containingNoMoreDot));
 			}
 		}
+
+		WHEN("We get the canonical path of a file reached through different paths")
+		{
+			Nz::String canonicalPath = Nz::File::CanonicalPath("resources/Engine/Graphics/Nazara.png");
+
+			THEN("Every path gives the same one")
+			{
+				CHECK(Nz::File::CanonicalPath("resources/Engine/../Engine/Graphics/Nazara.png") == canonicalPath);
+				CHECK(Nz::File::CanonicalPath("resources//Engine/./Graphics//Nazara.png") == canonicalPath);
+				CHECK(Nz::File::CanonicalPath(Nz::File::AbsolutePath("resources/Engine/Graphics/Nazara.png")) == canonicalPath);
+			}
+		}
+	}
+}
+
+SCENARIO("File asynchronous operations", "[CORE][FILE]")
+{
+	GIVEN("A file open in read and write mode")
+	{
+		Nz::File file("Async File.bin", Nz::OpenMode_ReadWrite | Nz::OpenMode_Truncate);
+		REQUIRE(file.IsOpen());
+
+		std::array<std::vector<Nz::UInt8>, 3> blocks;
+		for (std::size_t i = 0; i < blocks.size(); ++i)
+			blocks[i].assign(1000, static_cast<Nz::UInt8>('A' + i));
+
+		WHEN("We write blocks at different offsets and priorities")
+		{
+			std::array<std::future<Nz::FileIOResult>, 3> writes;
+			writes[0] = file.WriteAsync(2000, blocks[2].data(), blocks[2].size(), Nz::IOPriority_Low);
+			writes[1] = file.WriteAsync(0, blocks[0].data(), blocks[0].size(), Nz::IOPriority_High);
+			writes[2] = file.WriteAsync(1000, blocks[1].data(), blocks[1].size());
+
+			for (auto& write : writes)
+			{
+				Nz::FileIOResult result = write.get();
+				CHECK(result.succeeded);
+				CHECK(result.byteCount == 1000);
+			}
+
+			THEN("The cursor didn't move and the content can be read back asynchronously")
+			{
+				CHECK(file.GetCursorPos() == 0);
+				CHECK(file.GetSize() == 3000);
+
+				std::vector<Nz::UInt8> content(4000);
+				Nz::FileIOResult result = file.ReadAsync(0, content.data(), content.size()).get();
+				CHECK(result.succeeded);
+				REQUIRE(result.byteCount == 3000);
+
+				for (std::size_t i = 0; i < blocks.size(); ++i)
+					CHECK(std::equal(blocks[i].begin(), blocks[i].end(), content.begin() + i * 1000));
+			}
+
+			AND_THEN("Closing the file waits for queued operations")
+			{
+				std::vector<Nz::UInt8> content(1000);
+				std::future<Nz::FileIOResult> read = file.ReadAsync(1000, content.data(), content.size(), Nz::IOPriority_Low);
+				file.Close();
+
+				CHECK(read.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+				CHECK(read.get().byteCount == 1000);
+				CHECK(content == blocks[1]);
+			}
+		}
+
+		file.Close();
+		Nz::File::Delete("Async File.bin");
+	}
+
+	GIVEN("An unbuffered file")
+	{
+		Nz::File file("Unbuffered File.bin", Nz::OpenMode_ReadWrite | Nz::OpenMode_Truncate | Nz::OpenMode_Unbuffered);
+		REQUIRE(file.IsOpen());
+
+		std::size_t alignment = file.GetIOAlignment();
+		REQUIRE(alignment > 0);
+
+		WHEN("We write and read aligned blocks")
+		{
+			std::unique_ptr<Nz::UInt8[]> storage(new Nz::UInt8[alignment * 3]);
+			Nz::UInt8* buffer = reinterpret_cast<Nz::UInt8*>((reinterpret_cast<std::uintptr_t>(storage.get()) + alignment - 1) / alignment * alignment);
+
+			for (std::size_t i = 0; i < alignment; ++i)
+				buffer[i] = static_cast<Nz::UInt8>(i * 7);
+
+			Nz::FileIOResult writeResult = file.WriteAsync(alignment, buffer, alignment).get();
+			CHECK(writeResult.succeeded);
+			CHECK(writeResult.byteCount == alignment);
+
+			Nz::UInt8* readBuffer = buffer + alignment;
+			Nz::FileIOResult readResult = file.ReadAsync(alignment, readBuffer, alignment, Nz::IOPriority_High).get();
+
+			THEN("We get the same data back")
+			{
+				CHECK(readResult.succeeded);
+				REQUIRE(readResult.byteCount == alignment);
+				CHECK(std::equal(buffer, buffer + alignment, readBuffer));
+			}
+		}
+
+		file.Close();
+		Nz::File::Delete("Unbuffered File.bin");
 	}
 }
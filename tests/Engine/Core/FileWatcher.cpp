@@ -0,0 +1,85 @@
+#include <Nazara/Core/FileWatcher.hpp>
+#include <Nazara/Core/Directory.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/Thread.hpp>
+#include <Catch/catch.hpp>
+#include <algorithm>
+
+namespace
+{
+	bool WaitForChange(Nz::FileWatcher& watcher, std::vector<Nz::String>* changedFiles)
+	{
+		for (unsigned int i = 0; i < 100; ++i)
+		{
+			if (watcher.Poll(changedFiles) > 0)
+				return true;
+
+			Nz::Thread::Sleep(10);
+		}
+
+		return false;
+	}
+}
+
+SCENARIO("FileWatcher", "[CORE][FILEWATCHER]")
+{
+	GIVEN("A watched directory")
+	{
+		REQUIRE(Nz::Directory::Create("WatchedDirectory/Subdirectory", true));
+
+		Nz::FileWatcher watcher;
+		REQUIRE(watcher.Watch("WatchedDirectory"));
+		CHECK(watcher.IsWatching("WatchedDirectory"));
+
+		std::vector<Nz::String> changedFiles;
+		CHECK(watcher.Poll(&changedFiles) == 0);
+
+		WHEN("We write a file in it, twice")
+		{
+			for (unsigned int i = 0; i < 2; ++i)
+			{
+				Nz::File file("WatchedDirectory/File.txt", Nz::OpenMode_WriteOnly | Nz::OpenMode_Truncate);
+				file.Write("Hello");
+			}
+
+			THEN("It is reported once")
+			{
+				REQUIRE(WaitForChange(watcher, &changedFiles));
+				CHECK(std::count(changedFiles.begin(), changedFiles.end(), Nz::File::AbsolutePath("WatchedDirectory/File.txt")) == 1);
+			}
+		}
+
+		WHEN("We write a file in a subdirectory")
+		{
+			{
+				Nz::File file("WatchedDirectory/Subdirectory/File.txt", Nz::OpenMode_WriteOnly | Nz::OpenMode_Truncate);
+				file.Write("Hello");
+			}
+
+			THEN("It is reported as well")
+			{
+				REQUIRE(WaitForChange(watcher, &changedFiles));
+				CHECK(std::count(changedFiles.begin(), changedFiles.end(), Nz::File::AbsolutePath("WatchedDirectory/Subdirectory/File.txt")) == 1);
+			}
+		}
+
+		WHEN("We stop watching it")
+		{
+			watcher.Unwatch("WatchedDirectory");
+			CHECK_FALSE(watcher.IsWatching("WatchedDirectory"));
+
+			{
+				Nz::File file("WatchedDirectory/File.txt", Nz::OpenMode_WriteOnly | Nz::OpenMode_Truncate);
+				file.Write("Hello");
+			}
+
+			THEN("Nothing is reported")
+			{
+				Nz::Thread::Sleep(50);
+				CHECK(watcher.Poll(&changedFiles) == 0);
+			}
+		}
+
+		REQUIRE(Nz::Directory::Remove("WatchedDirectory", true));
+	}
+}
@@ -0,0 +1,95 @@
+#include <Nazara/Core/ArenaAllocator.hpp>
+#include <Nazara/Core/FrameArena.hpp>
+#include <Catch/catch.hpp>
+
+#include <Nazara/Math/Vector3.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+SCENARIO("FrameArena", "[CORE][FRAMEARENA]")
+{
+	GIVEN("A FrameArena with small blocks")
+	{
+		Nz::FrameArena arena(256);
+
+		CHECK(arena.GetBlockCount() == 0);
+		CHECK(arena.GetCapacity() == 0);
+
+		WHEN("We allocate with different alignments")
+		{
+			void* byte = arena.Allocate(1, 1);
+			void* aligned = arena.Allocate(16, 16);
+			Nz::Vector3f* vector = arena.New<Nz::Vector3f>(1.f, 2.f, 3.f);
+
+			THEN("Pointers respect the alignments and do not overlap")
+			{
+				CHECK(reinterpret_cast<std::uintptr_t>(aligned) % 16 == 0);
+				CHECK(reinterpret_cast<std::uintptr_t>(vector) % alignof(Nz::Vector3f) == 0);
+				CHECK(static_cast<Nz::UInt8*>(aligned) > static_cast<Nz::UInt8*>(byte));
+				CHECK(*vector == Nz::Vector3f(1.f, 2.f, 3.f));
+				CHECK(arena.GetAllocatedSize() == 1 + 16 + sizeof(Nz::Vector3f));
+				CHECK(arena.GetBlockCount() == 1);
+			}
+		}
+
+		WHEN("A frame needs more than one block")
+		{
+			for (int i = 0; i < 100; ++i)
+				arena.New<Nz::Vector3f>(float(i), 0.f, 0.f);
+
+			arena.Allocate(1000);
+
+			REQUIRE(arena.GetBlockCount() > 1);
+			std::size_t capacity = arena.GetCapacity();
+
+			arena.Reset();
+
+			THEN("Reset merges them into one block")
+			{
+				CHECK(arena.GetBlockCount() == 1);
+				CHECK(arena.GetCapacity() == capacity);
+				CHECK(arena.GetAllocatedSize() == 0);
+			}
+
+			AND_THEN("The same frame no longer needs new blocks")
+			{
+				for (int i = 0; i < 100; ++i)
+					arena.New<Nz::Vector3f>(float(i), 0.f, 0.f);
+
+				arena.Allocate(1000);
+
+				CHECK(arena.GetBlockCount() == 1);
+				CHECK(arena.GetCapacity() == capacity);
+			}
+		}
+	}
+
+	GIVEN("An unordered_map using an ArenaAllocator")
+	{
+		Nz::FrameArena arena(1024);
+
+		using Map = std::unordered_map<int, int, std::hash<int>, std::equal_to<int>, Nz::ArenaAllocator<std::pair<const int, int>>>;
+
+		for (int frame = 0; frame < 3; ++frame)
+		{
+			{
+				Nz::ArenaAllocator<std::pair<const int, int>> allocator(arena);
+				Map map(allocator);
+				for (int i = 0; i < 200; ++i)
+					map.emplace(i, i * i);
+
+				CHECK(map.size() == 200);
+				CHECK(map[12] == 144);
+				CHECK(&map.get_allocator().GetArena() == &arena);
+			}
+
+			arena.Reset();
+		}
+
+		THEN("Memory is reused from one frame to the next")
+		{
+			CHECK(arena.GetBlockCount() == 1);
+		}
+	}
+}
@@ -0,0 +1,82 @@
+#include <Nazara/Core/FramePacer.hpp>
+#include <Catch/catch.hpp>
+
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Thread.hpp>
+
+SCENARIO("FramePacer", "[CORE][FRAMEPACER]")
+{
+	GIVEN("A frame pacer limited to 100 frames per second")
+	{
+		Nz::FramePacer framePacer(100);
+		CHECK(framePacer.GetFramerateLimit() == 100);
+
+		WHEN("We wait for some frames")
+		{
+			Nz::Clock clock;
+
+			CHECK(framePacer.Wait() == 0);
+			for (unsigned int i = 0; i < 10; ++i)
+				framePacer.Wait();
+
+			Nz::UInt64 elapsedTime = clock.GetMicroseconds();
+
+			THEN("They last at least the frame duration")
+			{
+				const Nz::FramePacer::Statistics& statistics = framePacer.GetStatistics();
+				CHECK(statistics.frameCount == 10);
+				CHECK(statistics.minFrameTime <= statistics.averageFrameTime);
+				CHECK(statistics.averageFrameTime <= statistics.maxFrameTime);
+				CHECK(statistics.totalFrameTime >= 100'000 - 1'000);
+				CHECK(elapsedTime >= 100'000 - 1'000);
+			}
+		}
+
+		WHEN("A frame takes longer than three frame durations")
+		{
+			framePacer.Wait();
+			framePacer.Wait();
+
+			Nz::Thread::Sleep(35);
+			framePacer.Wait();
+
+			THEN("It is late and frames are dropped")
+			{
+				const Nz::FramePacer::Statistics& statistics = framePacer.GetStatistics();
+				CHECK(statistics.lateFrameCount >= 1);
+				CHECK(statistics.droppedFrameCount >= 2);
+				CHECK(statistics.lastFrameTime >= 35'000);
+			}
+
+			AND_WHEN("We reset the statistics")
+			{
+				framePacer.ResetStatistics();
+
+				THEN("They are cleared")
+				{
+					const Nz::FramePacer::Statistics& statistics = framePacer.GetStatistics();
+					CHECK(statistics.frameCount == 0);
+					CHECK(statistics.droppedFrameCount == 0);
+					CHECK(statistics.lateFrameCount == 0);
+				}
+			}
+		}
+	}
+
+	GIVEN("A frame pacer without limit")
+	{
+		Nz::FramePacer framePacer;
+
+		WHEN("We wait for a frame")
+		{
+			framePacer.Wait();
+			Nz::Thread::Sleep(5);
+
+			THEN("The frame time is only measured")
+			{
+				CHECK(framePacer.Wait() >= 5'000);
+				CHECK(framePacer.GetStatistics().lateFrameCount == 0);
+			}
+		}
+	}
+}
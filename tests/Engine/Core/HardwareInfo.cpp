@@ -0,0 +1,59 @@
+#include <Nazara/Core/HardwareInfo.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Core/Thread.hpp>
+#include <Catch/catch.hpp>
+
+#include <atomic>
+
+SCENARIO("HardwareInfo", "[CORE][HARDWAREINFO]")
+{
+	GIVEN("The processor topology")
+	{
+		const std::vector<Nz::LogicalProcessor>& processors = Nz::HardwareInfo::GetLogicalProcessors();
+
+		THEN("It describes every logical processor")
+		{
+			REQUIRE(processors.size() == Nz::HardwareInfo::GetProcessorCount());
+			CHECK(Nz::HardwareInfo::GetPhysicalCoreCount() >= 1);
+			CHECK(Nz::HardwareInfo::GetPhysicalCoreCount() <= processors.size());
+			CHECK(Nz::HardwareInfo::GetNumaNodeCount() >= 1);
+
+			for (const Nz::LogicalProcessor& processor : processors)
+			{
+				CHECK(processor.coreId < Nz::HardwareInfo::GetPhysicalCoreCount());
+				CHECK(processor.nodeId < Nz::HardwareInfo::GetNumaNodeCount());
+			}
+		}
+
+		WHEN("We allow the current thread to run on every processor")
+		{
+			Nz::Bitset<> affinity(processors.size(), true);
+
+			THEN("It succeeds")
+			{
+				CHECK(Nz::Thread::SetCurrentThreadAffinity(affinity));
+			}
+		}
+
+		WHEN("We run tasks on pinned workers")
+		{
+			Nz::TaskScheduler::Uninitialize();
+			Nz::TaskScheduler::EnableWorkerPinning(true);
+
+			std::atomic_int counter(0);
+			for (int i = 0; i < 100; ++i)
+				Nz::TaskScheduler::AddTask([&counter]() { counter++; });
+
+			Nz::TaskScheduler::Run();
+			Nz::TaskScheduler::WaitForTasks();
+
+			Nz::TaskScheduler::Uninitialize();
+			Nz::TaskScheduler::EnableWorkerPinning(false);
+
+			THEN("Every task has been executed")
+			{
+				CHECK(counter == 100);
+			}
+		}
+	}
+}
@@ -0,0 +1,114 @@
+#include <Nazara/Core/LargePageMemory.hpp>
+#include <Nazara/Core/FrameArena.hpp>
+#include <Nazara/Core/LargePageAllocator.hpp>
+#include <Nazara/Core/MemoryPool.hpp>
+#include <Catch/catch.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+SCENARIO("LargePageMemory", "[CORE][LARGEPAGEMEMORY]")
+{
+	GIVEN("The large page size of the system")
+	{
+		std::size_t largePageSize = Nz::LargePageMemory::GetLargePageSize();
+
+		// Large pages may be missing from the system running the tests, memory must be usable anyway
+		WHEN("We allocate a few large pages")
+		{
+			std::size_t size = (largePageSize > 0) ? largePageSize * 2 + 1 : 4 * 1024 * 1024;
+
+			bool largePages;
+			Nz::UInt8* memory = static_cast<Nz::UInt8*>(Nz::LargePageMemory::Allocate(size, &largePages));
+
+			THEN("The whole memory can be written and read")
+			{
+				REQUIRE(memory);
+				std::memset(memory, 0xAB, size);
+				CHECK(memory[0] == 0xAB);
+				CHECK(memory[size - 1] == 0xAB);
+
+				if (largePages)
+					CHECK(reinterpret_cast<std::uintptr_t>(memory) % largePageSize == 0);
+			}
+
+			Nz::LargePageMemory::Free(memory, size);
+		}
+
+		WHEN("We allocate less than the minimum size")
+		{
+			bool largePages;
+			void* memory = Nz::LargePageMemory::Allocate(64, &largePages);
+
+			THEN("Regular memory is used")
+			{
+				REQUIRE(memory);
+				CHECK(!largePages);
+			}
+
+			Nz::LargePageMemory::Free(memory, 64);
+		}
+	}
+
+	GIVEN("A vector using large pages")
+	{
+		std::vector<int, Nz::LargePageAllocator<int>> values(Nz::LargePageAllocator<int>(true));
+
+		WHEN("It grows past the large page size")
+		{
+			std::size_t count = std::max<std::size_t>(Nz::LargePageMemory::GetLargePageSize(), 4 * 1024 * 1024) / sizeof(int) + 1;
+			values.resize(count);
+			std::iota(values.begin(), values.end(), 0);
+
+			THEN("Its content is kept across reallocations")
+			{
+				values.push_back(-1);
+
+				CHECK(values.get_allocator().IsLargePagesEnabled());
+				CHECK(values[count / 2] == static_cast<int>(count / 2));
+				CHECK(values[count - 1] == static_cast<int>(count - 1));
+				CHECK(values.back() == -1);
+			}
+
+			AND_WHEN("It is moved into a vector using regular memory")
+			{
+				std::vector<int, Nz::LargePageAllocator<int>> regularValues;
+				regularValues = std::move(values);
+
+				THEN("The large page allocator follows the memory")
+				{
+					CHECK(regularValues.get_allocator().IsLargePagesEnabled());
+					CHECK(regularValues.size() == count);
+				}
+			}
+		}
+	}
+
+	GIVEN("A memory pool and a frame arena using large pages")
+	{
+		Nz::MemoryPool pool(64, 64 * 1024, true, true);
+		Nz::FrameArena arena(4 * 1024 * 1024, true);
+
+		WHEN("We allocate from them")
+		{
+			void* block = pool.Allocate(64);
+			void* arenaMemory = arena.Allocate(1024);
+
+			THEN("Memory is usable")
+			{
+				CHECK(pool.IsUsingLargePages());
+				CHECK(arena.IsUsingLargePages());
+
+				std::memset(block, 0, 64);
+				std::memset(arenaMemory, 0, 1024);
+				CHECK(pool.GetFreeBlocks() == 64 * 1024 - 1);
+			}
+
+			pool.Free(block);
+			arena.Reset();
+		}
+	}
+}
@@ -0,0 +1,77 @@
+#include <Nazara/Core/MappedFile.hpp>
+#include <Nazara/Core/ErrorFlags.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Catch/catch.hpp>
+#include <cstring>
+
+SCENARIO("MappedFile", "[CORE][MAPPEDFILE]")
+{
+	GIVEN("A file written on disk")
+	{
+		const char content[] = "Mapped file content";
+		{
+			Nz::File file("Test MappedFile.txt", Nz::OpenMode_WriteOnly | Nz::OpenMode_Truncate);
+			REQUIRE(file.Write(content, sizeof(content)) == sizeof(content));
+		}
+
+		WHEN("We map it")
+		{
+			Nz::MappedFile mappedFile("Test MappedFile.txt");
+			REQUIRE(mappedFile.IsOpen());
+
+			THEN("Its content is directly accessible")
+			{
+				CHECK(mappedFile.GetSize() == sizeof(content));
+				REQUIRE(mappedFile.GetData() != nullptr);
+				CHECK(std::memcmp(mappedFile.GetData(), content, sizeof(content)) == 0);
+				CHECK(mappedFile.GetPath().EndsWith("Test MappedFile.txt"));
+			}
+
+			AND_THEN("We can read it as a stream")
+			{
+				char buffer[sizeof(content)];
+				REQUIRE(mappedFile.Read(buffer, 6) == 6);
+				CHECK(mappedFile.GetCursorPos() == 6);
+				REQUIRE(mappedFile.Read(&buffer[6], sizeof(buffer)) == sizeof(content) - 6);
+				CHECK(mappedFile.EndOfStream());
+				CHECK(std::memcmp(buffer, content, sizeof(content)) == 0);
+
+				CHECK(mappedFile.SetCursorPos(0));
+				CHECK(mappedFile.Read(buffer, 1) == 1);
+				CHECK(buffer[0] == content[0]);
+			}
+
+			AND_THEN("Its view doesn't copy the content")
+			{
+				Nz::MemoryView view = mappedFile.GetView();
+				CHECK(view.GetSize() == sizeof(content));
+
+				char buffer[sizeof(content)];
+				REQUIRE(view.Read(buffer, sizeof(buffer)) == sizeof(content));
+				CHECK(std::memcmp(buffer, content, sizeof(content)) == 0);
+			}
+
+			AND_THEN("Closing it releases the mapping")
+			{
+				mappedFile.Close();
+				CHECK(!mappedFile.IsOpen());
+				CHECK(mappedFile.GetData() == nullptr);
+				CHECK(mappedFile.GetSize() == 0);
+			}
+		}
+
+		Nz::File::Delete("Test MappedFile.txt");
+	}
+
+	GIVEN("A file which doesn't exist")
+	{
+		Nz::MappedFile mappedFile;
+
+		THEN("It can't be mapped")
+		{
+			Nz::ErrorFlags errFlags(Nz::ErrorFlag_Silent);
+			CHECK(!mappedFile.Open("Nonexistent MappedFile.txt"));
+			CHECK(!mappedFile.IsOpen());
+		}
+	}
+}
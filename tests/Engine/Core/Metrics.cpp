@@ -0,0 +1,122 @@
+#include <Nazara/Core/Metrics.hpp>
+#include <Nazara/Core/PrometheusMetricsExporter.hpp>
+#include <Nazara/Core/StatsDMetricsExporter.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Catch/catch.hpp>
+#include <algorithm>
+
+namespace
+{
+	const Nz::Metrics::Sample* FindSample(const std::vector<Nz::Metrics::Sample>& samples, const Nz::String& name, const Nz::String& labels = Nz::String())
+	{
+		auto it = std::find_if(samples.begin(), samples.end(), [&] (const Nz::Metrics::Sample& sample) { return sample.name == name && sample.labels == labels; });
+		return (it != samples.end()) ? &*it : nullptr;
+	}
+}
+
+SCENARIO("Metrics", "[CORE][METRICS]")
+{
+	GIVEN("A counter")
+	{
+		Nz::UInt32 counter = Nz::Metrics::Register(Nz::MetricType_Counter, "test_requests_total", "Requests");
+		REQUIRE(counter != Nz::Metrics::InvalidId);
+
+		WHEN("Many threads increase it")
+		{
+			Nz::TaskScheduler::ParallelFor(0, 1000, 10, [&] (std::size_t begin, std::size_t end)
+			{
+				for (std::size_t i = begin; i < end; ++i)
+					Nz::Metrics::Add(counter, 2);
+			});
+
+			THEN("Collection sums the values of every thread")
+			{
+				std::vector<Nz::Metrics::Sample> samples = Nz::Metrics::Collect();
+
+				const Nz::Metrics::Sample* sample = FindSample(samples, "test_requests_total");
+				REQUIRE(sample);
+				CHECK(sample->type == Nz::MetricType_Counter);
+				CHECK(sample->value == Approx(2000.0));
+			}
+
+			AND_THEN("The Prometheus exporter describes it")
+			{
+				Nz::PrometheusMetricsExporter exporter;
+				Nz::String text = Nz::Metrics::Export(exporter);
+
+				CHECK(text.Find("# HELP test_requests_total Requests\n") != Nz::String::npos);
+				CHECK(text.Find("# TYPE test_requests_total counter\n") != Nz::String::npos);
+				CHECK(text.Find("\ntest_requests_total 2000\n") != Nz::String::npos);
+			}
+
+			AND_THEN("The StatsD exporter sends its increase")
+			{
+				Nz::StatsDMetricsExporter exporter("server.");
+				CHECK(Nz::Metrics::Export(exporter).Find("server.test_requests_total:2000|c\n") != Nz::String::npos);
+
+				Nz::Metrics::Add(counter, 5);
+				Nz::String text = Nz::Metrics::Export(exporter);
+				CHECK(text.Find("server.test_requests_total:5|c\n") != Nz::String::npos);
+
+				CHECK(Nz::Metrics::Export(exporter).Find("test_requests_total") == Nz::String::npos);
+			}
+		}
+
+		Nz::Metrics::Unregister(counter);
+
+		WHEN("It is unregistered")
+		{
+			THEN("It is not collected anymore")
+			{
+				CHECK_FALSE(FindSample(Nz::Metrics::Collect(), "test_requests_total"));
+			}
+		}
+	}
+
+	GIVEN("Gauges sharing a name")
+	{
+		Nz::UInt32 firstGauge = Nz::Metrics::Register(Nz::MetricType_Gauge, "test_queue_size", "Queue size", "queue=\"first\"");
+
+		double secondValue = 3.5;
+		Nz::UInt32 secondGauge = Nz::Metrics::Register(Nz::MetricType_Gauge, "test_queue_size", "Queue size", [&] () { return secondValue; }, "queue=\"second\"");
+
+		WHEN("We set and sample them")
+		{
+			Nz::Metrics::Set(firstGauge, 10.0);
+			Nz::Metrics::Add(firstGauge, -4);
+			secondValue = 7.25;
+
+			std::vector<Nz::Metrics::Sample> samples = Nz::Metrics::Collect();
+
+			THEN("Their values are the set (or sampled) value plus what was added")
+			{
+				const Nz::Metrics::Sample* first = FindSample(samples, "test_queue_size", "queue=\"first\"");
+				const Nz::Metrics::Sample* second = FindSample(samples, "test_queue_size", "queue=\"second\"");
+				REQUIRE(first);
+				REQUIRE(second);
+				CHECK(first->value == Approx(6.0));
+				CHECK(second->value == Approx(7.25));
+			}
+
+			AND_THEN("The Prometheus exporter describes them once")
+			{
+				Nz::String text = Nz::PrometheusMetricsExporter().Export(samples);
+
+				CHECK(text.Count("# TYPE test_queue_size gauge\n") == 1);
+				CHECK(text.Find("test_queue_size{queue=\"first\"} 6\n") != Nz::String::npos);
+				CHECK(text.Find("test_queue_size{queue=\"second\"} 7.25\n") != Nz::String::npos);
+			}
+
+			AND_THEN("The StatsD exporter turns their labels into tags")
+			{
+				Nz::String text = Nz::StatsDMetricsExporter().Export(samples);
+
+				CHECK(text.Find("test_queue_size:6|g|#queue:first\n") != Nz::String::npos);
+				CHECK(text.Find("test_queue_size:7.25|g|#queue:second\n") != Nz::String::npos);
+			}
+		}
+
+		Nz::Metrics::Unregister(firstGauge);
+		Nz::Metrics::Unregister(secondGauge);
+	}
+}
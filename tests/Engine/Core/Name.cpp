@@ -0,0 +1,79 @@
+#include <Nazara/Core/Name.hpp>
+#include <Catch/catch.hpp>
+
+#include <unordered_map>
+
+SCENARIO("Name", "[CORE][NAME]")
+{
+	GIVEN("Names built from literals")
+	{
+		constexpr Nz::Name name("MatDiffuseColor");
+		constexpr Nz::Name other("MatSpecularColor");
+
+		// Computed at compile time
+		static_assert(name.GetHash() == Nz::Name::Hash("MatDiffuseColor"), "Name hash must be usable in constant expressions");
+		static_assert(name != other, "Different names must have different hashes");
+
+		THEN("They hash like FNV-1a")
+		{
+			CHECK(Nz::Name().GetHash() == 14695981039346656037ULL);
+			CHECK(Nz::Name("a").GetHash() == 0xAF63DC4C8601EC8CULL);
+			CHECK(Nz::Name("foobar").GetHash() == 0x85944171F73967E8ULL);
+		}
+
+		WHEN("We compare them to names built from runtime strings")
+		{
+			Nz::String string("MatDiffuse");
+			string += "Color";
+
+			THEN("Same characters give equal names")
+			{
+				CHECK(Nz::Name(string) == name);
+				CHECK(Nz::Name(string) != other);
+				CHECK(Nz::Name(string).GetString() == string);
+			}
+		}
+
+		WHEN("We use them as keys")
+		{
+			std::unordered_map<Nz::Name, int> map;
+			map[name] = 1;
+			map[other] = 2;
+
+			THEN("They are found back by hash")
+			{
+				CHECK(map[Nz::Name("MatDiffuseColor")] == 1);
+				CHECK(map.size() == 2);
+			}
+		}
+	}
+
+	GIVEN("An empty name")
+	{
+		Nz::Name name;
+
+		THEN("It has no characters")
+		{
+			CHECK(name.IsEmpty());
+			CHECK(Nz::Name(nullptr).IsEmpty());
+			CHECK(Nz::Name("") == name);
+			CHECK_FALSE(Nz::Name("a").IsEmpty());
+		}
+	}
+
+	GIVEN("An interned name")
+	{
+		Nz::Name name;
+		{
+			Nz::String temporary("TemporaryName");
+			name = Nz::Name::Intern(temporary);
+		}
+
+		THEN("It outlives the string it comes from")
+		{
+			CHECK(Nz::String(name.GetString()) == "TemporaryName");
+			CHECK(name == Nz::Name("TemporaryName"));
+			CHECK(Nz::Name::Intern("TemporaryName").GetString() == name.GetString());
+		}
+	}
+}
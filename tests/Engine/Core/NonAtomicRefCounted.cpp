@@ -0,0 +1,88 @@
+#include <Nazara/Core/NonAtomicRefCounted.hpp>
+#include <Catch/catch.hpp>
+
+#include <Nazara/Core/BorrowedRef.hpp>
+#include <Nazara/Core/ObjectRef.hpp>
+
+namespace
+{
+	struct Counted : Nz::NonAtomicRefCounted
+	{
+		Counted(bool* destroyedFlag) :
+		NonAtomicRefCounted(false),
+		destroyed(destroyedFlag)
+		{
+		}
+
+		~Counted()
+		{
+			*destroyed = true;
+		}
+
+		bool* destroyed;
+	};
+}
+
+SCENARIO("NonAtomicRefCounted", "[CORE][NONATOMICREFCOUNTED]")
+{
+	GIVEN("A non-persistent object referenced by an ObjectRef")
+	{
+		bool destroyed = false;
+		Nz::ObjectRef<Counted> ref(new Counted(&destroyed));
+		REQUIRE(ref->GetReferenceCount() == 1);
+
+		WHEN("We borrow it")
+		{
+			Nz::BorrowedRef<Counted> borrowed(ref);
+			Nz::BorrowedRef<Counted> copy = borrowed;
+
+			THEN("Its references are not counted")
+			{
+				CHECK(copy == ref.Get());
+				CHECK(copy->GetReferenceCount() == 1);
+				CHECK(std::hash<Nz::BorrowedRef<Counted>>()(copy) == std::hash<Counted*>()(ref.Get()));
+			}
+
+			AND_THEN("Sharing it counts a reference again")
+			{
+				Nz::ObjectRef<Counted> shared = borrowed.Share();
+				CHECK(shared->GetReferenceCount() == 2);
+
+				ref.Reset();
+				CHECK_FALSE(destroyed);
+
+				shared.Reset();
+				CHECK(destroyed);
+			}
+		}
+
+		WHEN("We release its last reference")
+		{
+			Nz::ObjectRef<Counted> otherRef = ref;
+			CHECK(ref->GetReferenceCount() == 2);
+
+			ref.Reset();
+			CHECK_FALSE(destroyed);
+
+			otherRef.Reset();
+
+			THEN("It is destroyed")
+			{
+				CHECK(destroyed);
+			}
+		}
+	}
+
+	GIVEN("A persistent object")
+	{
+		Nz::NonAtomicRefCounted refCounted;
+
+		THEN("It stays alive without references")
+		{
+			refCounted.AddReference();
+			CHECK(refCounted.IsPersistent());
+			CHECK_FALSE(refCounted.RemoveReference());
+			CHECK(refCounted.GetReferenceCount() == 0);
+		}
+	}
+}
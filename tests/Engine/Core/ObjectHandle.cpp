@@ -1,6 +1,8 @@
 #include <Nazara/Core/HandledObject.hpp>
 #include <Nazara/Core/ObjectHandle.hpp>
 #include <Catch/catch.hpp>
+#include <algorithm>
+#include <vector>
 
 struct ObjectHandle_Test : public Nz::HandledObject<ObjectHandle_Test>
 {
@@ -138,3 +140,48 @@ SCENARIO("Handle", "[CORE][HandledObject][ObjectHandle]")
 		}
 	}
 }
+
+SCENARIO("Handle generations", "[CORE][HandledObject][ObjectHandle]")
+{
+	GIVEN("Many handles to one object")
+	{
+		std::vector<Nz::ObjectHandle<ObjectHandle_Test>> handles;
+
+		{
+			ObjectHandle_Test test(1);
+			for (unsigned int i = 0; i < 1000; ++i)
+				handles.push_back(test.CreateHandle());
+
+			CHECK(handles.front().IsValid());
+			CHECK(handles.back().GetObject() == &test);
+		}
+
+		WHEN("The object is destroyed and another one takes its slot")
+		{
+			ObjectHandle_Test other(2);
+			Nz::ObjectHandle<ObjectHandle_Test> otherHandle = other.CreateHandle();
+
+			THEN("Handles to the destroyed object stay invalid")
+			{
+				CHECK(otherHandle.IsValid());
+				CHECK(std::none_of(handles.begin(), handles.end(), [] (const Nz::ObjectHandle<ObjectHandle_Test>& handle) { return handle.IsValid(); }));
+				CHECK(handles.front().GetObject() == nullptr);
+				bool sameHandle = (handles.front() == otherHandle);
+				CHECK_FALSE(sameHandle);
+			}
+		}
+	}
+
+	GIVEN("A default handle")
+	{
+		Nz::ObjectHandle<ObjectHandle_Test> handle;
+
+		THEN("It is invalid")
+		{
+			CHECK_FALSE(handle.IsValid());
+			CHECK(handle.GetObject() == nullptr);
+			bool invalidHandle = (handle == Nz::ObjectHandle<ObjectHandle_Test>::InvalidHandle);
+			CHECK(invalidHandle);
+		}
+	}
+}
@@ -13,6 +13,46 @@ SCENARIO("ParameterList", "[CORE][PARAMETERLIST]")
 	{
 		Nz::ParameterList parameterList;
 
+		WHEN("We add more parameters than it holds inline")
+		{
+			for (long long i = 0; i < 20; ++i)
+				parameterList.SetParameter(Nz::Name::Intern("param" + Nz::String::Number(i)), i);
+
+			parameterList.SetParameter("string", Nz::String("value"));
+			parameterList.RemoveParameter("param7");
+
+			THEN("Every parameter is still found")
+			{
+				CHECK(parameterList.GetParameterCount() == 20);
+				CHECK_FALSE(parameterList.HasParameter("param7"));
+
+				for (long long i = 0; i < 20; ++i)
+				{
+					if (i == 7)
+						continue;
+
+					long long value;
+					REQUIRE(parameterList.GetIntegerParameter(Nz::String("param") + Nz::String::Number(i), &value));
+					CHECK(value == i);
+				}
+			}
+
+			AND_THEN("Copies and moves keep them")
+			{
+				Nz::ParameterList copy(parameterList);
+				Nz::ParameterList moved(std::move(parameterList));
+
+				CHECK(parameterList.GetParameterCount() == 0);
+				CHECK(moved.GetParameterCount() == 20);
+
+				Nz::String value;
+				CHECK(copy.GetStringParameter("string", &value));
+				CHECK(value == "value");
+				CHECK(moved.GetStringParameter("string", &value));
+				CHECK(value == "value");
+			}
+		}
+
 		WHEN("We add Bool 'true' and analogous")
 		{
 			bool boolean = true;
@@ -279,6 +319,38 @@ SCENARIO("ParameterList", "[CORE][PARAMETERLIST]")
 				CHECK(parameterList.HasParameter("toaster"));
 				CHECK(parameterList.HasParameter("str"));
 			}
+
+			AND_THEN("Its elements keep their names")
+			{
+				std::size_t count = 0;
+				copy.ForEach([&count] (const Nz::ParameterList& list, const Nz::String& name)
+				{
+					CHECK(list.HasParameter(name));
+					count++;
+				});
+
+				CHECK(count == 4);
+				CHECK(copy.ToString().Contains("toaster"));
+			}
+		}
+
+		WHEN("We look up a parameter by a runtime string or a precomputed name")
+		{
+			Nz::String name("st");
+			name += 'r';
+
+			constexpr Nz::Name strName("str");
+
+			THEN("They find the same parameter")
+			{
+				Nz::String value;
+				CHECK(parameterList.GetStringParameter(name, &value));
+				CHECK(value == "ing");
+
+				value.Clear();
+				CHECK(parameterList.GetStringParameter(strName, &value));
+				CHECK(value == "ing");
+			}
 		}
 	}
 }
@@ -0,0 +1,103 @@
+#include <Nazara/Core/Profiler.hpp>
+#include <Catch/catch.hpp>
+
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/MemoryStream.hpp>
+#include <Nazara/Core/String.hpp>
+#include <Nazara/Core/Thread.hpp>
+
+namespace
+{
+	Nz::String ExportTrace()
+	{
+		Nz::ByteArray trace;
+		Nz::MemoryStream stream(&trace, Nz::OpenMode_WriteOnly);
+		REQUIRE(Nz::Profiler::ExportChromeTrace(stream));
+
+		return Nz::String(reinterpret_cast<const char*>(trace.GetConstBuffer()), trace.GetSize());
+	}
+}
+
+SCENARIO("Profiler", "[CORE][PROFILER]")
+{
+	GIVEN("A disabled profiler")
+	{
+		Nz::Profiler::Enable(false);
+		Nz::Profiler::Clear();
+
+		WHEN("We open a scope")
+		{
+			{
+				Nz::Profiler::Scope profilerScope("DisabledScope");
+			}
+
+			THEN("It is not recorded")
+			{
+				CHECK(!Nz::Profiler::IsEnabled());
+				CHECK(!ExportTrace().Contains("DisabledScope"));
+			}
+		}
+	}
+
+	GIVEN("An enabled profiler")
+	{
+		Nz::Profiler::Enable();
+		Nz::Profiler::Clear();
+
+		WHEN("We open nested scopes from two threads")
+		{
+			{
+				Nz::Profiler::Scope outerScope("OuterScope");
+				Nz::Profiler::Scope innerScope("Inner \"quoted\" scope");
+			}
+
+			Nz::Thread thread([]()
+			{
+				Nz::Thread::SetCurrentThreadName("ProfiledThread");
+
+				Nz::Profiler::Scope profilerScope("ThreadScope");
+			});
+			thread.Join();
+
+			Nz::String trace = ExportTrace();
+
+			THEN("They are exported in the Chrome trace event format")
+			{
+				CHECK(trace.StartsWith("{\"traceEvents\":["));
+				CHECK(trace.Contains("{\"name\":\"OuterScope\",\"ph\":\"X\",\"ts\":"));
+				CHECK(trace.Contains("{\"name\":\"Inner \\\"quoted\\\" scope\",\"ph\":\"X\",\"ts\":"));
+				CHECK(trace.Contains("{\"name\":\"ThreadScope\",\"ph\":\"X\",\"ts\":"));
+				CHECK(trace.Contains("\"args\":{\"name\":\"ProfiledThread\"}"));
+			}
+
+			AND_WHEN("We clear the profiler")
+			{
+				Nz::Profiler::Clear();
+
+				THEN("The scopes are not exported anymore")
+				{
+					Nz::String clearedTrace = ExportTrace();
+					CHECK(!clearedTrace.Contains("OuterScope"));
+					CHECK(!clearedTrace.Contains("ThreadScope"));
+				}
+			}
+		}
+
+		WHEN("We record more scopes than a buffer can hold")
+		{
+			for (unsigned int i = 0; i < NAZARA_CORE_PROFILER_EVENT_COUNT + 10; ++i)
+			{
+				Nz::Profiler::Scope profilerScope((i < 10) ? "OverwrittenScope" : "KeptScope");
+			}
+
+			THEN("Only the last ones are kept")
+			{
+				Nz::String trace = ExportTrace();
+				CHECK(!trace.Contains("OverwrittenScope"));
+				CHECK(trace.Contains("KeptScope"));
+			}
+		}
+
+		Nz::Profiler::Enable(false);
+	}
+}
@@ -0,0 +1,107 @@
+#include <Nazara/Core/ReadWriteLock.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/ReadLockGuard.hpp>
+#include <Nazara/Core/Thread.hpp>
+#include <Nazara/Core/WriteLockGuard.hpp>
+#include <Catch/catch.hpp>
+#include <vector>
+
+SCENARIO("ReadWriteLock", "[CORE][READWRITELOCK]")
+{
+	GIVEN("A read-write lock")
+	{
+		Nz::ReadWriteLock lock;
+
+		WHEN("It is held for reading")
+		{
+			Nz::ReadLockGuard readLock(lock);
+
+			THEN("Other readers can hold it, but not writers")
+			{
+				CHECK(lock.TryLockRead());
+				lock.UnlockRead();
+
+				CHECK_FALSE(lock.TryLockWrite());
+			}
+		}
+
+		WHEN("It is held for writing")
+		{
+			Nz::WriteLockGuard writeLock(lock);
+
+			THEN("Neither readers nor writers can hold it")
+			{
+				CHECK_FALSE(lock.TryLockRead());
+				CHECK_FALSE(lock.TryLockWrite());
+			}
+		}
+
+		WHEN("Threads write a counter while others read it")
+		{
+			unsigned int counter = 0;
+
+			std::vector<Nz::Thread> threads;
+			for (unsigned int i = 0; i < 4; ++i)
+			{
+				threads.emplace_back([&]()
+				{
+					for (unsigned int j = 0; j < 1000; ++j)
+					{
+						Nz::WriteLockGuard writeLock(lock);
+						counter++;
+					}
+				});
+
+				threads.emplace_back([&]()
+				{
+					for (unsigned int j = 0; j < 1000; ++j)
+					{
+						Nz::ReadLockGuard readLock(lock);
+						volatile unsigned int value = counter;
+						(void) value;
+					}
+				});
+			}
+
+			for (Nz::Thread& thread : threads)
+				thread.Join();
+
+			THEN("No increment was lost")
+			{
+				CHECK(counter == 4000);
+			}
+		}
+	}
+}
+
+SCENARIO("Mutex", "[CORE][MUTEX]")
+{
+	GIVEN("A mutex locked by another thread")
+	{
+		Nz::Mutex mutex;
+		Nz::Mutex::ResetContentionStats();
+
+		mutex.Lock();
+
+		Nz::Thread thread([&]()
+		{
+			Nz::LockGuard lock(mutex);
+		});
+
+		Nz::Thread::Sleep(20);
+		mutex.Unlock();
+		thread.Join();
+
+		WHEN("We get the contention stats")
+		{
+			Nz::LockContentionStats stats = Nz::Mutex::GetContentionStats();
+
+			THEN("The wait was counted")
+			{
+				CHECK(stats.contentionCount >= 1);
+				CHECK(stats.waitTime >= 10'000);
+			}
+		}
+	}
+}
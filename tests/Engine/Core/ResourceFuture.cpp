@@ -0,0 +1,142 @@
+#include <Nazara/Core/ResourceFuture.hpp>
+#include <Nazara/Core/ResourceFinalizationQueue.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Catch/catch.hpp>
+
+namespace
+{
+	struct TestResource : Nz::RefCounted
+	{
+		TestResource() :
+		Nz::RefCounted(false)
+		{
+		}
+
+		int value = 0;
+	};
+
+	void WaitForDecoding(const Nz::ResourceFuture<TestResource>& future)
+	{
+		Nz::TaskScheduler::WaitForTasks();
+		REQUIRE(future.GetState() != Nz::ResourceLoadState_Loading);
+	}
+}
+
+SCENARIO("ResourceFuture", "[CORE][RESOURCEFUTURE]")
+{
+	GIVEN("A resource loaded without finalization")
+	{
+		Nz::ResourceFuture<TestResource> future = Nz::ResourceFuture<TestResource>::Start(new TestResource, [](TestResource& resource)
+		{
+			resource.value = 42;
+			return true;
+		});
+
+		REQUIRE(future.IsValid());
+
+		WHEN("We wait for it")
+		{
+			Nz::ObjectRef<TestResource> resource = future.Wait();
+
+			THEN("It's loaded")
+			{
+				REQUIRE(resource);
+				CHECK(resource->value == 42);
+				CHECK(future.IsReady());
+				CHECK(future.GetState() == Nz::ResourceLoadState_Loaded);
+				CHECK(future.Get() == resource);
+			}
+		}
+	}
+
+	GIVEN("A resource requiring a finalization")
+	{
+		Nz::ResourceFinalizationQueue::Clear();
+
+		Nz::ResourceFuture<TestResource> future = Nz::ResourceFuture<TestResource>::Start(new TestResource, [](TestResource& resource)
+		{
+			resource.value = 1;
+			return true;
+		},
+		[](TestResource& resource)
+		{
+			resource.value *= 10;
+			return true;
+		});
+
+		WaitForDecoding(future);
+
+		WHEN("The decoding is done")
+		{
+			THEN("It waits for the finalization queue")
+			{
+				CHECK(future.GetState() == Nz::ResourceLoadState_Finalizing);
+				CHECK_FALSE(future.IsReady());
+				CHECK_FALSE(future.Get());
+				CHECK(Nz::ResourceFinalizationQueue::GetPendingCount() == 1);
+			}
+		}
+
+		WHEN("We process the finalization queue")
+		{
+			CHECK(Nz::ResourceFinalizationQueue::Process() == 1);
+
+			THEN("It's loaded")
+			{
+				REQUIRE(future.Get());
+				CHECK(future.Get()->value == 10);
+			}
+		}
+
+		WHEN("We wait for it")
+		{
+			Nz::ObjectRef<TestResource> resource = future.Wait();
+
+			THEN("The finalization happens right away, only once")
+			{
+				REQUIRE(resource);
+				CHECK(resource->value == 10);
+
+				CHECK(Nz::ResourceFinalizationQueue::Process() == 1);
+				CHECK(resource->value == 10);
+			}
+		}
+	}
+
+	GIVEN("A resource failing to load")
+	{
+		bool finalized = false;
+		Nz::ResourceFuture<TestResource> future = Nz::ResourceFuture<TestResource>::Start(new TestResource, [](TestResource& /*resource*/)
+		{
+			return false;
+		},
+		[&](TestResource& /*resource*/)
+		{
+			finalized = true;
+			return true;
+		});
+
+		WaitForDecoding(future);
+
+		THEN("It fails without being finalized")
+		{
+			CHECK(future.GetState() == Nz::ResourceLoadState_Failed);
+			CHECK(future.IsReady());
+			CHECK_FALSE(future.Wait());
+			CHECK(Nz::ResourceFinalizationQueue::Process() == 0);
+			CHECK_FALSE(finalized);
+		}
+	}
+
+	GIVEN("A future made from a loaded resource")
+	{
+		Nz::ObjectRef<TestResource> resource = new TestResource;
+		Nz::ResourceFuture<TestResource> future(resource);
+
+		THEN("It's ready right away")
+		{
+			CHECK(future.IsReady());
+			CHECK(future.Get() == resource);
+		}
+	}
+}
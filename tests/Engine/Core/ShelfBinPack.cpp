@@ -0,0 +1,68 @@
+#include <Nazara/Core/ShelfBinPack.hpp>
+#include <Catch/catch.hpp>
+#include <array>
+
+SCENARIO("ShelfBinPack", "[CORE][SHELFBINPACK]")
+{
+	GIVEN("An empty bin of 64x64")
+	{
+		Nz::ShelfBinPack binPack(64, 64);
+
+		WHEN("We insert rectangles of the same height")
+		{
+			std::array<Nz::Rectui, 8> rects;
+			rects.fill(Nz::Rectui(0, 0, 16, 16));
+
+			REQUIRE(binPack.Insert(rects.data(), static_cast<unsigned int>(rects.size())));
+
+			THEN("They are put side by side on shelves")
+			{
+				CHECK(binPack.GetShelfCount() == 2);
+				for (std::size_t i = 0; i < rects.size(); ++i)
+				{
+					CHECK(rects[i].x == (i % 4) * 16);
+					CHECK(rects[i].y == (i / 4) * 16);
+				}
+			}
+
+			AND_THEN("Slightly shorter rectangles go on existing shelves")
+			{
+				binPack.FreeRectangle(rects[7]);
+
+				Nz::Rectui rect(0, 0, 16, 14);
+				REQUIRE(binPack.Insert(&rect, 1));
+				CHECK(rect.x == 48);
+				CHECK(rect.y == 16);
+				CHECK(binPack.GetShelfCount() == 2);
+			}
+
+			AND_THEN("Much shorter rectangles open a new shelf")
+			{
+				Nz::Rectui rect(0, 0, 16, 4);
+				REQUIRE(binPack.Insert(&rect, 1));
+				CHECK(rect.y == 32);
+				CHECK(binPack.GetShelfCount() == 3);
+			}
+		}
+
+		WHEN("We insert more rectangles than the bin can hold")
+		{
+			std::array<Nz::Rectui, 20> rects;
+			rects.fill(Nz::Rectui(0, 0, 16, 16));
+
+			std::array<bool, 20> inserted;
+
+			THEN("Only the ones fitting are inserted")
+			{
+				CHECK_FALSE(binPack.Insert(rects.data(), inserted.data(), static_cast<unsigned int>(rects.size())));
+
+				std::size_t insertedCount = 0;
+				for (bool flag : inserted)
+					insertedCount += (flag) ? 1 : 0;
+
+				CHECK(insertedCount == 16);
+				CHECK(binPack.GetOccupancy() == Approx(1.f));
+			}
+		}
+	}
+}
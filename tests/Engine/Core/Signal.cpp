@@ -1,6 +1,8 @@
 #include <Nazara/Core/Signal.hpp>
 #include <Catch/catch.hpp>
 
+#include <array>
+
 struct Incrementer
 {
 	void increment(int* inc)
@@ -43,6 +45,92 @@ SCENARIO("Signal", "[CORE][SIGNAL]")
 				signal(&inc);
 				REQUIRE(inc == 2);
 			}
+
+			AND_THEN("When we clear it, there is no listener anymore")
+			{
+				signal.Clear();
+				CHECK(!connection.IsConnected());
+
+				int inc = 0;
+				signal(&inc);
+				REQUIRE(inc == 0);
+			}
+		}
+
+		WHEN("We connect a callback too big to be stored in its slot")
+		{
+			std::array<int, 32> values;
+			values.fill(1);
+
+			auto connection = signal.Connect([values] (int* inc) { *inc += values[31]; });
+			auto copy = connection;
+
+			THEN("It gets called as well, and copies of its connection can disconnect it")
+			{
+				int inc = 0;
+				signal(&inc);
+				CHECK(inc == 1);
+
+				copy.Disconnect();
+				CHECK(!connection.IsConnected());
+
+				signal(&inc);
+				CHECK(inc == 1);
+			}
+		}
+
+		WHEN("Slots connect and disconnect slots while the signal is emitted")
+		{
+			Nz::Signal<int*>::Connection selfConnection;
+			Nz::Signal<int*>::Connection lateConnection;
+			Nz::Signal<int*>::Connection removedConnection;
+
+			selfConnection = signal.Connect([&] (int* inc)
+			{
+				*inc += 1;
+
+				selfConnection.Disconnect();
+				removedConnection.Disconnect();
+				lateConnection = signal.Connect([] (int* value) { *value += 100; });
+			});
+			removedConnection = signal.Connect([] (int* inc) { *inc += 10; });
+
+			THEN("Disconnected slots stop being called right away, connected ones from the next emission")
+			{
+				int inc = 0;
+				signal(&inc);
+				CHECK(inc == 1);
+				CHECK(!selfConnection.IsConnected());
+				CHECK(!removedConnection.IsConnected());
+				CHECK(lateConnection.IsConnected());
+
+				inc = 0;
+				signal(&inc);
+				CHECK(inc == 100);
+			}
+		}
+
+		WHEN("The signal is moved or destroyed")
+		{
+			Nz::Signal<int*>::Connection connection;
+			{
+				Nz::Signal<int*> otherSignal;
+				connection = otherSignal.Connect(increment);
+
+				Nz::Signal<int*> movedSignal(std::move(otherSignal));
+				CHECK(connection.IsConnected());
+
+				int inc = 0;
+				movedSignal(&inc);
+				otherSignal(&inc);
+				CHECK(inc == 1);
+			}
+
+			THEN("Its connections know it")
+			{
+				CHECK(!connection.IsConnected());
+				connection.Disconnect();
+			}
 		}
 	}
 }
@@ -0,0 +1,62 @@
+#include <Nazara/Core/SimdDispatcher.hpp>
+#include <Nazara/Core/HardwareInfo.hpp>
+#include <Catch/catch.hpp>
+
+namespace
+{
+	int KernelScalar()
+	{
+		return Nz::SimdTarget_Scalar;
+	}
+
+	int KernelSSE2()
+	{
+		return Nz::SimdTarget_SSE2;
+	}
+
+	int KernelAVX2()
+	{
+		return Nz::SimdTarget_AVX2;
+	}
+}
+
+SCENARIO("SimdDispatcher", "[CORE][SIMDDISPATCHER]")
+{
+	GIVEN("A kernel with SSE2 and AVX2 implementations")
+	{
+		REQUIRE(Nz::SimdDispatcher::IsInitialized());
+
+		Nz::SimdKernel<int(*)()> kernel(&KernelScalar);
+		kernel.Register(Nz::SimdTarget_SSE2, &KernelSSE2);
+		kernel.Register(Nz::SimdTarget_AVX2, &KernelAVX2);
+
+		THEN("The best implementation supported by the processor is selected")
+		{
+			Nz::SimdTarget expected = Nz::SimdTarget_Scalar;
+			if (Nz::HardwareInfo::IsSimdTargetSupported(Nz::SimdTarget_AVX2))
+				expected = Nz::SimdTarget_AVX2;
+			else if (Nz::HardwareInfo::IsSimdTargetSupported(Nz::SimdTarget_SSE2))
+				expected = Nz::SimdTarget_SSE2;
+
+			CHECK(kernel.GetTarget() == expected);
+			CHECK(kernel() == expected);
+			CHECK(Nz::SimdDispatcher::GetTarget() >= expected);
+		}
+
+		WHEN("We limit the targets")
+		{
+			Nz::SimdDispatcher::SetTargetLimit(Nz::SimdTarget_Scalar);
+			int limitedResult = kernel();
+			Nz::SimdTarget limitedTarget = Nz::SimdDispatcher::GetTarget();
+
+			Nz::SimdDispatcher::SetTargetLimit(Nz::SimdTarget_Max);
+
+			THEN("Kernels fall back to their scalar implementation until the limit is lifted")
+			{
+				CHECK(limitedResult == Nz::SimdTarget_Scalar);
+				CHECK(limitedTarget == Nz::SimdTarget_Scalar);
+				CHECK(kernel.Get() == kernel.Get(Nz::SimdTarget_Max));
+			}
+		}
+	}
+}
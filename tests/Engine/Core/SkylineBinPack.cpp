@@ -0,0 +1,88 @@
+#include <Nazara/Core/SkylineBinPack.hpp>
+#include <Catch/catch.hpp>
+#include <array>
+
+SCENARIO("SkylineBinPack", "[CORE][SKYLINEBINPACK]")
+{
+	GIVEN("An empty bin of 64x64")
+	{
+		Nz::SkylineBinPack binPack(64, 64);
+
+		WHEN("We insert sixteen squares filling it exactly")
+		{
+			std::array<Nz::Rectui, 16> rects;
+			rects.fill(Nz::Rectui(0, 0, 16, 16));
+
+			std::array<bool, 16> inserted;
+			REQUIRE(binPack.Insert(rects.data(), nullptr, inserted.data(), static_cast<unsigned int>(rects.size())));
+
+			THEN("They don't overlap and the bin is full")
+			{
+				for (std::size_t i = 0; i < rects.size(); ++i)
+				{
+					CHECK(inserted[i]);
+					CHECK(rects[i].x + rects[i].width <= 64);
+					CHECK(rects[i].y + rects[i].height <= 64);
+
+					for (std::size_t j = i + 1; j < rects.size(); ++j)
+						CHECK_FALSE(rects[i].Intersect(rects[j]));
+				}
+
+				CHECK(binPack.GetOccupancy() == Approx(1.f));
+				CHECK(binPack.GetSegmentCount() == 1);
+			}
+
+			AND_THEN("Nothing else fits until the bin is expanded")
+			{
+				Nz::Rectui rect(0, 0, 8, 8);
+				CHECK_FALSE(binPack.Insert(&rect, 1));
+
+				binPack.Expand(128, 64);
+				REQUIRE(binPack.Insert(&rect, 1));
+				CHECK(rect.x >= 64);
+			}
+		}
+
+		WHEN("We insert a rectangle which only fits flipped")
+		{
+			binPack.Reset(32, 64);
+
+			Nz::Rectui rect(0, 0, 48, 10);
+			bool flipped = false;
+
+			THEN("It is flipped")
+			{
+				REQUIRE(binPack.Insert(&rect, &flipped, 1));
+				CHECK(flipped);
+				CHECK(rect.width == 10);
+				CHECK(rect.height == 48);
+			}
+		}
+
+		WHEN("We insert rectangles of different sizes")
+		{
+			std::array<Nz::Rectui, 6> rects = {
+				Nz::Rectui(0, 0, 10, 30),
+				Nz::Rectui(0, 0, 40, 10),
+				Nz::Rectui(0, 0, 20, 20),
+				Nz::Rectui(0, 0, 5, 5),
+				Nz::Rectui(0, 0, 30, 12),
+				Nz::Rectui(0, 0, 64, 8)
+			};
+
+			REQUIRE(binPack.Insert(rects.data(), static_cast<unsigned int>(rects.size())));
+
+			THEN("They don't overlap")
+			{
+				for (std::size_t i = 0; i < rects.size(); ++i)
+				{
+					CHECK(rects[i].x + rects[i].width <= 64);
+					CHECK(rects[i].y + rects[i].height <= 64);
+
+					for (std::size_t j = i + 1; j < rects.size(); ++j)
+						CHECK_FALSE(rects[i].Intersect(rects[j]));
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,86 @@
+#include <Nazara/Core/SpscQueue.hpp>
+#include <Catch/catch.hpp>
+
+#include <Nazara/Core/Thread.hpp>
+
+SCENARIO("SpscQueue", "[CORE][SPSCQUEUE]")
+{
+	GIVEN("A queue with a capacity which isn't a power of two")
+	{
+		Nz::SpscQueue<int> queue(6);
+
+		THEN("Its capacity is rounded up")
+		{
+			CHECK(queue.GetCapacity() == 8);
+			CHECK(queue.IsEmpty());
+		}
+
+		WHEN("We fill it")
+		{
+			for (int i = 0; i < 8; ++i)
+				CHECK(queue.Push(i));
+
+			THEN("It refuses more values")
+			{
+				CHECK(!queue.Push(8));
+			}
+
+			AND_WHEN("We empty it")
+			{
+				int value = -1;
+				for (int i = 0; i < 8; ++i)
+				{
+					REQUIRE(queue.Pop(&value));
+					CHECK(value == i);
+				}
+
+				THEN("Nothing is left to pop")
+				{
+					CHECK(queue.IsEmpty());
+					CHECK(!queue.Pop(&value));
+					CHECK(queue.Push(8));
+				}
+			}
+		}
+	}
+
+	GIVEN("A small queue shared by two threads")
+	{
+		Nz::SpscQueue<unsigned int> queue(16);
+		constexpr unsigned int valueCount = 100000;
+
+		WHEN("A thread pushes many values while we pop them")
+		{
+			Nz::Thread producer([&]()
+			{
+				for (unsigned int i = 0; i < valueCount; ++i)
+				{
+					while (!queue.Push(i))
+						Nz::Thread::Sleep(0);
+				}
+			});
+
+			bool ordered = true;
+			unsigned int expected = 0;
+			while (expected < valueCount)
+			{
+				unsigned int value;
+				if (queue.Pop(&value))
+				{
+					if (value != expected)
+						ordered = false;
+
+					expected++;
+				}
+			}
+
+			producer.Join();
+
+			THEN("Every value is received in order")
+			{
+				CHECK(ordered);
+				CHECK(queue.IsEmpty());
+			}
+		}
+	}
+}
@@ -142,5 +142,68 @@ SCENARIO("String", "[CORE][STRING]")
 			}
 		}
 	}
-}
 
+	GIVEN("A short and a long string")
+	{
+		Nz::String shortString("short");
+		Nz::String longString("a string too long to be stored inline");
+
+		WHEN("We copy them")
+		{
+			Nz::String shortCopy(shortString);
+			Nz::String longCopy(longString);
+
+			THEN("Only the long one shares its characters")
+			{
+				CHECK(shortCopy.GetConstBuffer() != shortString.GetConstBuffer());
+				CHECK(longCopy.GetConstBuffer() == longString.GetConstBuffer());
+			}
+
+			AND_WHEN("We modify a copy")
+			{
+				shortCopy[0] = 'S';
+				longCopy.Replace('a', 'A');
+
+				THEN("The original strings are left unchanged")
+				{
+					CHECK(shortString == "short");
+					CHECK(shortCopy == "Short");
+					CHECK(longString == "a string too long to be stored inline");
+					CHECK(longCopy == "A string too long to be stored inline");
+					CHECK(longCopy.GetConstBuffer() != longString.GetConstBuffer());
+				}
+			}
+		}
+
+		WHEN("We move them")
+		{
+			const char* longCharacters = longString.GetConstBuffer();
+
+			Nz::String movedShort(std::move(shortString));
+			Nz::String movedLong;
+			movedLong = std::move(longString);
+
+			THEN("The characters follow and the moved strings are left empty")
+			{
+				CHECK(movedShort == "short");
+				CHECK(movedLong.GetConstBuffer() == longCharacters);
+				CHECK(shortString.IsEmpty());
+				CHECK(longString.IsEmpty());
+			}
+		}
+
+		WHEN("We swap them and grow the short one past its inline capacity")
+		{
+			shortString.Swap(longString);
+			for (int i = 0; i < 10; ++i)
+				longString += "-more";
+
+			THEN("Both keep their characters")
+			{
+				CHECK(shortString == "a string too long to be stored inline");
+				CHECK(longString == "short-more-more-more-more-more-more-more-more-more-more");
+				CHECK(longString.GetConstBuffer()[longString.GetSize()] == '\0');
+			}
+		}
+	}
+}
@@ -0,0 +1,48 @@
+#include <Nazara/Core/StringView.hpp>
+#include <Catch/catch.hpp>
+
+#include <functional>
+
+SCENARIO("StringView", "[CORE][STRINGVIEW]")
+{
+	GIVEN("A view of a part of a string")
+	{
+		Nz::String string("  usemtl Material.001  ");
+		Nz::StringView view = Nz::StringView(string).Trimmed();
+
+		THEN("It refers to the characters of the string")
+		{
+			CHECK(view == "usemtl Material.001");
+			CHECK(view.GetConstBuffer() == &string.GetConstBuffer()[2]);
+			CHECK(view.GetSize() == 19);
+		}
+
+		WHEN("We look into it")
+		{
+			THEN("These results are expected")
+			{
+				CHECK(view.StartsWith("USEMTL", Nz::String::CaseInsensitive));
+				CHECK_FALSE(view.StartsWith("USEMTL"));
+				CHECK(view.EndsWith(".001"));
+				CHECK(view.Find(' ') == 6);
+				CHECK(view.Find("Material") == 7);
+				CHECK(view.Find("Material", 8) == Nz::String::npos);
+				CHECK(view.SubString(7) == "Material.001");
+				CHECK(view.SubString(0, 5).ToString() == Nz::String("usemtl"));
+				CHECK(view.SubString(-3) == "001");
+			}
+		}
+
+		WHEN("We compare it")
+		{
+			THEN("It is ordered like the characters it refers to")
+			{
+				CHECK(view.Compare("usemtl Material.002") < 0);
+				CHECK(view.Compare("usemtl") > 0);
+				CHECK(view.Compare("USEMTL MATERIAL.001", Nz::String::CaseInsensitive) == 0);
+				CHECK(Nz::String("usemtl Material.001") == view);
+				CHECK(std::hash<Nz::StringView>()(view) == std::hash<Nz::String>()(view.ToString()));
+			}
+		}
+	}
+}
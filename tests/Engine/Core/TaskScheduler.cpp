@@ -0,0 +1,143 @@
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Core/TaskGroup.hpp>
+#include <Catch/catch.hpp>
+
+#include <atomic>
+#include <vector>
+
+SCENARIO("TaskScheduler", "[CORE][TASKSCHEDULER]")
+{
+	GIVEN("A bunch of tasks incrementing a counter")
+	{
+		std::atomic_int counter(0);
+
+		WHEN("We run them and wait for every task")
+		{
+			for (int i = 0; i < 100; ++i)
+				Nz::TaskScheduler::AddTask([&counter]() { counter++; });
+
+			Nz::TaskScheduler::Run();
+			Nz::TaskScheduler::WaitForTasks();
+
+			THEN("Every task has been executed")
+			{
+				CHECK(counter == 100);
+			}
+		}
+
+		WHEN("We add them to a group and wait for it")
+		{
+			Nz::TaskGroup group;
+			std::vector<int> results(64, 0);
+
+			for (int i = 0; i < 64; ++i)
+				Nz::TaskScheduler::AddTask(group, [&results, &counter, i]() { results[i] = i * 2; counter++; });
+
+			CHECK(group.GetPendingTaskCount() == 64);
+
+			group.Wait();
+
+			THEN("Every task of the group has been executed")
+			{
+				CHECK(group.IsDone());
+				CHECK(counter == 64);
+				for (int i = 0; i < 64; ++i)
+					CHECK(results[i] == i * 2);
+			}
+		}
+
+		WHEN("We wait on two groups separately")
+		{
+			Nz::TaskGroup firstGroup;
+			Nz::TaskGroup secondGroup;
+
+			for (int i = 0; i < 10; ++i)
+			{
+				Nz::TaskScheduler::AddTask(firstGroup, [&counter]() { counter++; });
+				Nz::TaskScheduler::AddTask(secondGroup, [&counter]() { counter += 10; });
+			}
+
+			Nz::TaskScheduler::WaitForTasks(firstGroup);
+			Nz::TaskScheduler::WaitForTasks(secondGroup);
+
+			THEN("Both groups are done")
+			{
+				CHECK(firstGroup.IsDone());
+				CHECK(secondGroup.IsDone());
+				CHECK(counter == 110);
+			}
+		}
+	}
+}
+
+SCENARIO("TaskScheduler parallel algorithms", "[CORE][TASKSCHEDULER]")
+{
+	GIVEN("An array of numbers")
+	{
+		std::vector<int> values(10000);
+		for (std::size_t i = 0; i < values.size(); ++i)
+			values[i] = static_cast<int>(i);
+
+		WHEN("We double them with ParallelFor")
+		{
+			Nz::TaskScheduler::ParallelFor(0, values.size(), 128, [&values](std::size_t first, std::size_t last)
+			{
+				for (std::size_t i = first; i < last; ++i)
+					values[i] *= 2;
+			});
+
+			THEN("Every value has been processed exactly once")
+			{
+				bool allDoubled = true;
+				for (std::size_t i = 0; i < values.size(); ++i)
+					allDoubled = allDoubled && (values[i] == static_cast<int>(i) * 2);
+
+				CHECK(allDoubled);
+			}
+		}
+
+		WHEN("We use a range smaller than the grain size")
+		{
+			std::atomic_int callCount(0);
+			Nz::TaskScheduler::ParallelFor(10, 20, 100, [&callCount](std::size_t first, std::size_t last)
+			{
+				CHECK(first == 10);
+				CHECK(last == 20);
+				callCount++;
+			});
+
+			THEN("The function is called once")
+			{
+				CHECK(callCount == 1);
+			}
+		}
+
+		WHEN("We sum them with ParallelReduce")
+		{
+			long long sum = Nz::TaskScheduler::ParallelReduce(0, values.size(), 0, 0LL, [&values](std::size_t first, std::size_t last)
+			{
+				long long partialSum = 0;
+				for (std::size_t i = first; i < last; ++i)
+					partialSum += values[i];
+
+				return partialSum;
+			},
+			[](long long left, long long right) { return left + right; });
+
+			THEN("The result is the sum of every value")
+			{
+				CHECK(sum == 10000LL * 9999LL / 2);
+			}
+		}
+
+		WHEN("We reduce an empty range")
+		{
+			int result = Nz::TaskScheduler::ParallelReduce(5, 5, 1, 42, [](std::size_t, std::size_t) { return 0; }, [](int left, int right) { return left + right; });
+
+			THEN("The identity is returned")
+			{
+				CHECK(result == 42);
+			}
+		}
+	}
+}
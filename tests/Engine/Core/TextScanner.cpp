@@ -0,0 +1,123 @@
+#include <Nazara/Core/TextScanner.hpp>
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/MemoryView.hpp>
+#include <Catch/catch.hpp>
+#include <cstring>
+
+SCENARIO("TextScanner", "[CORE][TEXTSCANNER]")
+{
+	GIVEN("A text with blank lines, comments and Windows line endings")
+	{
+		const char text[] = "  first line  \r\n\n\t\r\n# only a comment\r\nkeyword 1.5 -2 +3e2 .25 7. 42 # trailing comment\nlast";
+
+		Nz::TextScanner scanner(text, std::strlen(text));
+		scanner.SetCommentMarker("#");
+
+		WHEN("We read it line by line")
+		{
+			REQUIRE(scanner.NextLine());
+			CHECK(scanner.GetLine() == "first line");
+			CHECK(scanner.GetLineNumber() == 1);
+
+			REQUIRE(scanner.NextLine());
+			CHECK(scanner.GetLineNumber() == 5);
+
+			THEN("Words and numbers are read in place")
+			{
+				CHECK(!scanner.ExpectWord("key"));
+				CHECK(!scanner.ExpectWord("KEYWORD"));
+				CHECK(scanner.ExpectWord("KEYWORD", false));
+
+				float value;
+				REQUIRE(scanner.Read(&value));
+				CHECK(value == Approx(1.5f));
+
+				Nz::Int32 integer;
+				REQUIRE(scanner.Read(&integer));
+				CHECK(integer == -2);
+
+				REQUIRE(scanner.Read(&value));
+				CHECK(value == Approx(300.f));
+				REQUIRE(scanner.Read(&value));
+				CHECK(value == Approx(0.25f));
+				REQUIRE(scanner.Read(&value));
+				CHECK(value == Approx(7.f));
+
+				Nz::UInt32 unsignedInteger;
+				REQUIRE(scanner.Read(&unsignedInteger));
+				CHECK(unsignedInteger == 42);
+
+				CHECK(scanner.EndOfLine());
+				CHECK(!scanner.Read(&value));
+			}
+
+			AND_THEN("A line can be read again")
+			{
+				Nz::StringView word;
+				REQUIRE(scanner.ReadWord(&word));
+				CHECK(word == "keyword");
+
+				scanner.RestartLine();
+				CHECK(scanner.ExpectWord("keyword"));
+				CHECK(scanner.ReadRemaining() == "1.5 -2 +3e2 .25 7. 42");
+			}
+
+			AND_THEN("The last line doesn't need a line ending")
+			{
+				REQUIRE(scanner.NextLine());
+				CHECK(scanner.GetLine() == "last");
+				CHECK(scanner.EndOfText());
+				CHECK(!scanner.NextLine());
+			}
+		}
+	}
+
+	GIVEN("Some numbers")
+	{
+		const char* numbers[] = { "0", "-0.5", "3.14159265", "1e-7", "-2.5E+3", "123456789012345678901234", "0.000000000000000000000000000001" };
+		const float values[] = { 0.f, -0.5f, 3.14159265f, 1e-7f, -2500.f, 123456789012345678901234.f, 1e-30f };
+
+		THEN("They are parsed like strtof")
+		{
+			for (std::size_t i = 0; i < Nz::CountOf(numbers); ++i)
+			{
+				float value;
+				const char* end = numbers[i] + std::strlen(numbers[i]);
+				REQUIRE(Nz::TextScanner::ParseFloat(numbers[i], end, &value) == end);
+				CHECK(value == Approx(values[i]));
+			}
+		}
+
+		AND_THEN("Invalid numbers are rejected")
+		{
+			const char invalid[] = "-.e5";
+			float value;
+			CHECK(Nz::TextScanner::ParseFloat(invalid, invalid + 4, &value) == nullptr);
+
+			const char exponentless[] = "2e";
+			CHECK(Nz::TextScanner::ParseFloat(exponentless, exponentless + 2, &value) == exponentless + 1);
+			CHECK(value == Approx(2.f));
+		}
+	}
+
+	GIVEN("A stream")
+	{
+		const char text[] = "skipped\nline one\nline two";
+		Nz::MemoryView stream(text, sizeof(text) - 1);
+		stream.SetCursorPos(8);
+
+		WHEN("We scan it")
+		{
+			Nz::TextScanner scanner(stream);
+
+			THEN("It is read in place from its cursor")
+			{
+				CHECK(scanner.GetText() == &text[8]);
+				CHECK(stream.EndOfStream());
+
+				REQUIRE(scanner.NextLine());
+				CHECK(scanner.GetLine() == "line one");
+			}
+		}
+	}
+}
@@ -0,0 +1,47 @@
+#include <Nazara/Core/Timestamp.hpp>
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Thread.hpp>
+#include <Catch/catch.hpp>
+
+SCENARIO("Timestamp", "[CORE][TIMESTAMP]")
+{
+	GIVEN("The timestamp source")
+	{
+		REQUIRE(Nz::Timestamp::GetFrequency() >= 1'000'000);
+
+		WHEN("We measure a sleep")
+		{
+			Nz::UInt64 startMicroseconds = Nz::GetElapsedMicroseconds();
+			Nz::UInt64 start = Nz::Timestamp::Now();
+			Nz::Thread::Sleep(20);
+			Nz::UInt64 elapsed = Nz::Timestamp::Now() - start;
+			Nz::UInt64 elapsedMicroseconds = Nz::GetElapsedMicroseconds() - startMicroseconds;
+
+			THEN("Both clocks agree")
+			{
+				Nz::UInt64 microseconds = Nz::Timestamp::ToMicroseconds(elapsed);
+				CHECK(microseconds >= 19'000);
+				CHECK(microseconds + 2'000 >= elapsedMicroseconds);
+				CHECK(microseconds <= elapsedMicroseconds + 2'000);
+
+				CHECK(Nz::Timestamp::ToNanoseconds(elapsed) / 1000 == microseconds);
+				CHECK(Nz::Timestamp::ToSeconds(elapsed) == Approx(microseconds / 1'000'000.0).epsilon(0.01));
+			}
+		}
+
+		WHEN("We convert back and forth")
+		{
+			THEN("Durations are preserved, even long ones")
+			{
+				for (Nz::UInt64 microseconds : { 0ULL, 1ULL, 1'500ULL, 3'600'000'000ULL, 10ULL * 24 * 3'600'000'000ULL })
+				{
+					Nz::UInt64 ticks = Nz::Timestamp::FromMicroseconds(microseconds);
+					Nz::UInt64 roundTrip = Nz::Timestamp::ToMicroseconds(ticks);
+
+					CHECK(roundTrip <= microseconds);
+					CHECK(roundTrip + 1 >= microseconds);
+				}
+			}
+		}
+	}
+}
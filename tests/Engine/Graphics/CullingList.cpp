@@ -0,0 +1,183 @@
+#include <Nazara/Graphics/CullingList.hpp>
+#include <Catch/catch.hpp>
+
+#include <algorithm>
+#include <vector>
+
+SCENARIO("CullingList", "[GRAPHICS][CULLINGLIST]")
+{
+	GIVEN("A frustum and a culling list of spheres")
+	{
+		Nz::Frustumf frustum;
+		frustum.Build(Nz::FromDegrees(90.f), 1.f, 1.f, 1000.f, Nz::Vector3f::Zero(), Nz::Vector3f::UnitX());
+
+		constexpr std::size_t SphereCount = 37; // Not a multiple of the batch size
+
+		// Entries must be destroyed before the list
+		Nz::CullingList<int> cullingList;
+
+		std::vector<int> renderables(SphereCount);
+		std::vector<Nz::Spheref> spheres(SphereCount);
+		std::vector<Nz::CullingList<int>::SphereEntry> entries;
+		for (std::size_t i = 0; i < SphereCount; ++i)
+		{
+			// Alternates spheres in front of and behind the camera
+			float distance = (i % 3 == 0) ? -50.f : 10.f + i * 10.f;
+			spheres[i] = Nz::Spheref(Nz::Vector3f::UnitX() * distance, 1.f);
+
+			entries.emplace_back(cullingList.RegisterSphereTest(&renderables[i]));
+			entries.back().UpdateSphere(spheres[i]);
+		}
+
+		WHEN("We cull the list")
+		{
+			cullingList.Cull(frustum);
+
+			THEN("Visible renderables match the frustum test of each sphere")
+			{
+				std::vector<const int*> expected;
+				for (std::size_t i = 0; i < SphereCount; ++i)
+				{
+					if (frustum.Contains(spheres[i]))
+						expected.push_back(&renderables[i]);
+				}
+
+				std::vector<const int*> results(cullingList.begin(), cullingList.end());
+				CHECK(!results.empty());
+				CHECK(results == expected);
+			}
+		}
+
+		WHEN("We unregister some spheres and move another one")
+		{
+			for (std::size_t i = 0; i < 4; ++i)
+				entries.pop_back();
+
+			entries[0].UpdateSphere(Nz::Spheref(Nz::Vector3f::UnitX() * 20.f, 1.f));
+
+			cullingList.Cull(frustum);
+
+			THEN("Results are updated")
+			{
+				std::vector<const int*> results(cullingList.begin(), cullingList.end());
+				CHECK(std::find(results.begin(), results.end(), &renderables[0]) != results.end());
+				CHECK(std::find(results.begin(), results.end(), &renderables[1]) != results.end());
+				CHECK(std::find(results.begin(), results.end(), &renderables[3]) == results.end());
+				for (std::size_t i = SphereCount - 4; i < SphereCount; ++i)
+					CHECK(std::find(results.begin(), results.end(), &renderables[i]) == results.end());
+			}
+		}
+	}
+
+	GIVEN("Two culling lists of spheres and volumes, one of them using hierarchical culling")
+	{
+		Nz::Frustumf frustum;
+		frustum.Build(Nz::FromDegrees(70.f), 1.f, 1.f, 500.f, Nz::Vector3f::Zero(), Nz::Vector3f::UnitX());
+
+		constexpr std::size_t GridSize = 20;
+
+		Nz::CullingList<int> flatList;
+		Nz::CullingList<int> treeList;
+		treeList.EnableHierarchicalCulling();
+
+		std::vector<int> renderables(GridSize * GridSize * 2);
+		std::vector<Nz::CullingList<int>::SphereEntry> flatSpheres;
+		std::vector<Nz::CullingList<int>::SphereEntry> treeSpheres;
+		std::vector<Nz::CullingList<int>::VolumeEntry> flatVolumes;
+		std::vector<Nz::CullingList<int>::VolumeEntry> treeVolumes;
+
+		auto GetSphere = [](std::size_t i, float offset) -> Nz::Spheref
+		{
+			return Nz::Spheref(static_cast<float>(i % GridSize) * 50.f - 500.f + offset, static_cast<float>(i / GridSize) * 50.f - 500.f, offset, 5.f);
+		};
+
+		auto GetVolume = [](std::size_t i, float offset) -> Nz::BoundingVolumef
+		{
+			Nz::BoundingVolumef volume(Nz::Boxf(static_cast<float>(i % GridSize) * 50.f - 490.f, offset, static_cast<float>(i / GridSize) * 50.f - 510.f, 10.f, 10.f, 10.f));
+			volume.Update(Nz::Vector3f::Zero());
+
+			return volume;
+		};
+
+		for (std::size_t i = 0; i < GridSize * GridSize; ++i)
+		{
+			flatSpheres.emplace_back(flatList.RegisterSphereTest(&renderables[i]));
+			flatSpheres.back().UpdateSphere(GetSphere(i, 0.f));
+			treeSpheres.emplace_back(treeList.RegisterSphereTest(&renderables[i]));
+			treeSpheres.back().UpdateSphere(GetSphere(i, 0.f));
+
+			flatVolumes.emplace_back(flatList.RegisterVolumeTest(&renderables[GridSize * GridSize + i]));
+			flatVolumes.back().UpdateVolume(GetVolume(i, 0.f));
+			treeVolumes.emplace_back(treeList.RegisterVolumeTest(&renderables[GridSize * GridSize + i]));
+			treeVolumes.back().UpdateVolume(GetVolume(i, 0.f));
+		}
+
+		auto GetSortedResults = [&frustum](Nz::CullingList<int>& cullingList)
+		{
+			cullingList.Cull(frustum);
+
+			std::vector<const int*> results(cullingList.begin(), cullingList.end());
+			std::sort(results.begin(), results.end());
+
+			return results;
+		};
+
+		WHEN("We cull both lists")
+		{
+			std::vector<const int*> expected = GetSortedResults(flatList);
+
+			THEN("They have the same visible renderables")
+			{
+				CHECK(!expected.empty());
+				CHECK(expected.size() < renderables.size());
+				CHECK(GetSortedResults(treeList) == expected);
+			}
+		}
+
+		WHEN("We move, unregister and invalidate some entries")
+		{
+			for (std::size_t i = 0; i < GridSize * GridSize; i += 3)
+			{
+				float offset = static_cast<float>(i % 7) * 40.f - 120.f;
+				flatSpheres[i].UpdateSphere(GetSphere(i, offset));
+				treeSpheres[i].UpdateSphere(GetSphere(i, offset));
+				flatVolumes[i].UpdateVolume(GetVolume(i, offset));
+				treeVolumes[i].UpdateVolume(GetVolume(i, offset));
+			}
+
+			flatVolumes[1].UpdateVolume(Nz::BoundingVolumef::Infinite());
+			treeVolumes[1].UpdateVolume(Nz::BoundingVolumef::Infinite());
+			flatVolumes[2].UpdateVolume(Nz::BoundingVolumef::Null());
+			treeVolumes[2].UpdateVolume(Nz::BoundingVolumef::Null());
+
+			for (std::size_t i = 0; i < 50; ++i)
+			{
+				flatSpheres.pop_back();
+				treeSpheres.pop_back();
+				flatVolumes.pop_back();
+				treeVolumes.pop_back();
+			}
+
+			treeSpheres[GridSize * 10 + GridSize / 2 + 1].ForceInvalidation(); //< In front of the camera
+
+			std::vector<const int*> expected = GetSortedResults(flatList);
+
+			THEN("Hierarchical culling still matches the frustum tests")
+			{
+				bool forceInvalidation = false;
+				treeList.Cull(frustum, &forceInvalidation);
+				CHECK(forceInvalidation);
+
+				CHECK(std::find(expected.begin(), expected.end(), &renderables[GridSize * GridSize + 1]) != expected.end());
+				CHECK(std::find(expected.begin(), expected.end(), &renderables[GridSize * GridSize + 2]) == expected.end());
+				CHECK(GetSortedResults(treeList) == expected);
+			}
+
+			AND_THEN("Disabling hierarchical culling gives the same results")
+			{
+				treeList.EnableHierarchicalCulling(false);
+				CHECK(GetSortedResults(treeList) == expected);
+			}
+		}
+	}
+}
@@ -0,0 +1,65 @@
+#include <Nazara/Graphics/DynamicResolutionController.hpp>
+#include <Catch/catch.hpp>
+
+namespace
+{
+	// The GPU time of a frame goes with its pixel count
+	Nz::UInt64 FrameTime(Nz::UInt64 fullResolutionTime, float scale)
+	{
+		return static_cast<Nz::UInt64>(fullResolutionTime * scale * scale);
+	}
+}
+
+SCENARIO("DynamicResolutionController", "[GRAPHICS][DYNAMICRESOLUTIONCONTROLLER]")
+{
+	GIVEN("A controller with a budget of 10ms")
+	{
+		Nz::DynamicResolutionController controller(10000000, 0.5f, 1.f);
+		REQUIRE(controller.GetScale() == Approx(1.f));
+
+		WHEN("Frames fit in the budget")
+		{
+			for (unsigned int i = 0; i < 100; ++i)
+				controller.Update(FrameTime(8000000, controller.GetScale()));
+
+			THEN("The resolution is kept")
+			{
+				CHECK(controller.GetScale() == Approx(1.f));
+			}
+		}
+
+		WHEN("Frames take 15ms at full resolution")
+		{
+			for (unsigned int i = 0; i < 100; ++i)
+				controller.Update(FrameTime(15000000, controller.GetScale()));
+
+			THEN("The resolution is lowered until they fit in the budget")
+			{
+				CHECK(controller.GetScale() < 1.f);
+				CHECK(FrameTime(15000000, controller.GetScale()) <= 10000000);
+			}
+
+			AND_WHEN("They get cheaper")
+			{
+				for (unsigned int i = 0; i < 200; ++i)
+					controller.Update(FrameTime(6000000, controller.GetScale()));
+
+				THEN("The full resolution is restored")
+				{
+					CHECK(controller.GetScale() == Approx(1.f));
+				}
+			}
+		}
+
+		WHEN("Frames are far too expensive")
+		{
+			for (unsigned int i = 0; i < 100; ++i)
+				controller.Update(FrameTime(100000000, controller.GetScale()));
+
+			THEN("The resolution doesn't go under the minimum scale")
+			{
+				CHECK(controller.GetScale() == Approx(0.5f));
+			}
+		}
+	}
+}
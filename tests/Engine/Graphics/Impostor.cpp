@@ -0,0 +1,54 @@
+#include <Nazara/Graphics/Impostor.hpp>
+#include <Catch/catch.hpp>
+#include <cmath>
+#include <vector>
+
+SCENARIO("Impostor", "[GRAPHICS][IMPOSTOR]")
+{
+	GIVEN("Directions spread over the sphere")
+	{
+		std::vector<Nz::Vector3f> directions = {
+			Nz::Vector3f::Up(), Nz::Vector3f::Down(), Nz::Vector3f::Left(), Nz::Vector3f::Right(), Nz::Vector3f::Forward(), Nz::Vector3f::Backward(),
+			Nz::Vector3f::Normalize(Nz::Vector3f(1.f, 2.f, 3.f)), Nz::Vector3f::Normalize(Nz::Vector3f(-3.f, -1.f, 2.f)), Nz::Vector3f::Normalize(Nz::Vector3f(0.5f, -4.f, -1.f))
+		};
+
+		WHEN("We map them to the octahedron")
+		{
+			THEN("They are mapped back to themselves")
+			{
+				for (const Nz::Vector3f& direction : directions)
+				{
+					Nz::Vector2f coords = Nz::Impostor::EncodeOctahedron(direction);
+					CHECK(std::abs(coords.x) <= 1.f);
+					CHECK(std::abs(coords.y) <= 1.f);
+
+					Nz::Vector3f decoded = Nz::Impostor::DecodeOctahedron(coords);
+					CHECK(decoded.DotProduct(direction) == Approx(1.f));
+				}
+			}
+
+			THEN("The upper hemisphere is mapped to the inner diamond")
+			{
+				CHECK(Nz::Impostor::EncodeOctahedron(Nz::Vector3f::Up()) == Nz::Vector2f::Zero());
+
+				Nz::Vector2f coords = Nz::Impostor::EncodeOctahedron(directions[6]);
+				CHECK(std::abs(coords.x) + std::abs(coords.y) <= 1.f);
+
+				coords = Nz::Impostor::EncodeOctahedron(directions[7]);
+				CHECK(std::abs(coords.x) + std::abs(coords.y) >= 1.f);
+			}
+		}
+	}
+
+	GIVEN("An impostor which isn't baked")
+	{
+		Nz::ImpostorRef impostor = Nz::Impostor::New();
+
+		THEN("It has no frame")
+		{
+			CHECK(!impostor->IsValid());
+			CHECK(impostor->GetFrameCount() == 0);
+			CHECK(impostor->GetGridSize() == 0);
+		}
+	}
+}
@@ -0,0 +1,44 @@
+#include <Nazara/Graphics/MaterialPipeline.hpp>
+#include <Catch/catch.hpp>
+
+SCENARIO("MaterialPipeline", "[GRAPHICS][MATERIALPIPELINE]")
+{
+	GIVEN("A pipeline from the cache")
+	{
+		Nz::MaterialPipelineInfo pipelineInfo;
+		pipelineInfo.hasDiffuseMap = true;
+		pipelineInfo.uberShader = Nz::UberShaderLibrary::Get("PhongLighting");
+
+		Nz::MaterialPipelineRef pipeline = Nz::MaterialPipeline::GetPipeline(pipelineInfo);
+		REQUIRE(pipeline.IsValid());
+
+		THEN("The same informations give the same pipeline")
+		{
+			CHECK(Nz::MaterialPipeline::GetPipeline(pipelineInfo) == pipeline);
+		}
+
+		WHEN("One of its permutations is precompiled")
+		{
+			Nz::MaterialPipeline::ResetGenerationStats();
+			pipeline->Precompile(Nz::ShaderFlags_Deferred | Nz::ShaderFlags_Instancing);
+
+			THEN("Using it doesn't generate anything")
+			{
+				const Nz::MaterialPipeline::Instance& instance = pipeline->GetInstance(Nz::ShaderFlags_Deferred | Nz::ShaderFlags_Instancing);
+				CHECK(instance.uberInstance);
+				CHECK_FALSE(instance.pending);
+
+				Nz::MaterialPipeline::GenerationStats stats = Nz::MaterialPipeline::GetGenerationStats();
+				CHECK(stats.precompiledCount == 1);
+				CHECK(stats.runtimeCount == 0);
+			}
+
+			AND_THEN("Using another one is counted as a runtime generation")
+			{
+				pipeline->GetInstance(Nz::ShaderFlags_Deferred | Nz::ShaderFlags_Skinning);
+
+				CHECK(Nz::MaterialPipeline::GetGenerationStats().runtimeCount == 1);
+			}
+		}
+	}
+}
@@ -1,4 +1,5 @@
 #include <Nazara/Graphics/Model.hpp>
+#include <Nazara/Core/Primitive.hpp>
 #include <Catch/catch.hpp>
 
 SCENARIO("Model", "[GRAPHICS][MODEL]")
@@ -25,3 +26,60 @@ SCENARIO("Model", "[GRAPHICS][MODEL]")
 		}
 	}
 }
+
+SCENARIO("Model levels of detail", "[GRAPHICS][MODEL]")
+{
+	GIVEN("A model of a box with a simpler level, and a level where it isn't drawn")
+	{
+		Nz::MeshParams params;
+		params.storage = Nz::DataStorage_Software;
+
+		Nz::MeshRef mesh = Nz::Mesh::New();
+		mesh->CreateStatic();
+		mesh->BuildSubMesh(Nz::Primitive::Box(Nz::Vector3f::Unit(), Nz::Vector3ui(4)), params);
+
+		Nz::MeshRef simpleMesh = Nz::Mesh::New();
+		simpleMesh->CreateStatic();
+		simpleMesh->BuildSubMesh(Nz::Primitive::Box(Nz::Vector3f::Unit()), params);
+
+		Nz::ModelRef model = Nz::Model::New();
+		model->SetMesh(mesh);
+		REQUIRE(model->AddLevelOfDetail(nullptr, 0.1f));
+		REQUIRE(model->AddLevelOfDetail(simpleMesh, 0.5f));
+
+		Nz::InstancedRenderable::InstanceData instanceData(Nz::Matrix4f::Identity());
+
+		THEN("Levels are sorted by decreasing size")
+		{
+			REQUIRE(model->GetLevelOfDetailCount() == 3);
+			CHECK(model->GetLevelOfDetailMesh(0) == mesh);
+			CHECK(model->GetLevelOfDetailMesh(1) == simpleMesh);
+			CHECK(model->GetLevelOfDetailMesh(2) == nullptr);
+			CHECK(model->GetLevelOfDetailSize(1) == Approx(0.5f));
+		}
+
+		WHEN("The model gets smaller on screen")
+		{
+			CHECK_FALSE(model->UpdateLevelOfDetail(&instanceData, 1.f));
+			CHECK(instanceData.levelOfDetail == 0);
+
+			CHECK(model->UpdateLevelOfDetail(&instanceData, 0.3f));
+			CHECK(instanceData.levelOfDetail == 1);
+
+			CHECK(model->UpdateLevelOfDetail(&instanceData, 0.05f));
+			CHECK(instanceData.levelOfDetail == 2);
+
+			THEN("Getting bigger just above a limit keeps the level, to avoid switching back and forth")
+			{
+				CHECK(model->UpdateLevelOfDetail(&instanceData, 0.3f));
+				CHECK(instanceData.levelOfDetail == 1);
+
+				CHECK_FALSE(model->UpdateLevelOfDetail(&instanceData, 0.52f));
+				CHECK(instanceData.levelOfDetail == 1);
+
+				CHECK(model->UpdateLevelOfDetail(&instanceData, 0.6f));
+				CHECK(instanceData.levelOfDetail == 0);
+			}
+		}
+	}
+}
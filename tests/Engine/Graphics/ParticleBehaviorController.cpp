@@ -0,0 +1,80 @@
+#include <Nazara/Graphics/ParticleBehaviorController.hpp>
+#include <Catch/catch.hpp>
+
+#include <Nazara/Core/SparsePtr.hpp>
+#include <Nazara/Graphics/ParticleGroup.hpp>
+#include <Nazara/Graphics/ParticleMapper.hpp>
+
+namespace
+{
+	void SetupParticles(Nz::ParticleGroup& particleGroup)
+	{
+		particleGroup.CreateParticles(4);
+
+		Nz::ParticleMapper mapper = particleGroup.GetParticleMapper();
+		Nz::SparsePtr<Nz::Color> colorPtr = mapper.GetComponentPtr<Nz::Color>(Nz::ParticleComponent_Color);
+		Nz::SparsePtr<float> lifePtr = mapper.GetComponentPtr<float>(Nz::ParticleComponent_Life);
+		Nz::SparsePtr<Nz::Vector3f> positionPtr = mapper.GetComponentPtr<Nz::Vector3f>(Nz::ParticleComponent_Position);
+		Nz::SparsePtr<Nz::Vector3f> velocityPtr = mapper.GetComponentPtr<Nz::Vector3f>(Nz::ParticleComponent_Velocity);
+
+		for (unsigned int i = 0; i < 4; ++i)
+		{
+			colorPtr[i] = Nz::Color::White;
+			lifePtr[i] = (i == 0) ? 0.5f : 3.f;
+			positionPtr[i] = Nz::Vector3f(float(i), 0.f, 0.f);
+			velocityPtr[i] = Nz::Vector3f::UnitX();
+		}
+	}
+}
+
+SCENARIO("ParticleBehaviorController", "[GRAPHICS][PARTICLEBEHAVIORCONTROLLER]")
+{
+	for (Nz::ParticleStorage storage : {Nz::ParticleStorage_Interleaved, Nz::ParticleStorage_Separated})
+	{
+		GIVEN("A particle group of billboards with standard behaviors")
+		{
+			auto controller = Nz::MakeParticleController(Nz::ParticleLifetime(), Nz::ParticleGravity(Nz::Vector3f(0.f, -2.f, 0.f)), Nz::ParticleMovement(), Nz::ParticleColorOverLife(Nz::Color::White, Nz::Color::Black, 4.f));
+
+			Nz::ParticleGroup particleGroup(10, Nz::ParticleLayout_Billboard, storage);
+			particleGroup.AddController(controller);
+
+			SetupParticles(particleGroup);
+
+			WHEN("We update the group for one second")
+			{
+				particleGroup.Update(1.f);
+
+				THEN("Particles at the end of their life are killed and the others are updated")
+				{
+					REQUIRE(particleGroup.GetParticleCount() == 3);
+
+					Nz::ParticleMapper mapper = particleGroup.GetParticleMapper();
+					Nz::SparsePtr<Nz::Color> colorPtr = mapper.GetComponentPtr<Nz::Color>(Nz::ParticleComponent_Color);
+					Nz::SparsePtr<float> lifePtr = mapper.GetComponentPtr<float>(Nz::ParticleComponent_Life);
+					Nz::SparsePtr<Nz::Vector3f> velocityPtr = mapper.GetComponentPtr<Nz::Vector3f>(Nz::ParticleComponent_Velocity);
+
+					for (unsigned int i = 0; i < 3; ++i)
+					{
+						CHECK(lifePtr[i] == Approx(2.f));
+						CHECK(velocityPtr[i] == Nz::Vector3f(1.f, -2.f, 0.f));
+						CHECK(colorPtr[i] == Nz::Color(127, 127, 127));
+					}
+				}
+			}
+
+			WHEN("We change a behavior of the controller")
+			{
+				controller->GetBehavior<1>().acceleration = Nz::Vector3f::Zero();
+				particleGroup.Update(1.f);
+
+				THEN("The new parameters are used by the next update")
+				{
+					Nz::ParticleMapper mapper = particleGroup.GetParticleMapper();
+					Nz::SparsePtr<Nz::Vector3f> velocityPtr = mapper.GetComponentPtr<Nz::Vector3f>(Nz::ParticleComponent_Velocity);
+
+					CHECK(velocityPtr[0] == Nz::Vector3f::UnitX());
+				}
+			}
+		}
+	}
+}
@@ -101,3 +101,102 @@ SCENARIO("ParticleGroup", "[GRAPHICS][PARTICLEGROUP]")
 		}
 	}
 }
+
+SCENARIO("ParticleGroup with a separated storage", "[GRAPHICS][PARTICLEGROUP]")
+{
+	GIVEN("A particle group of 5000 billboards stored by component, updated in parallel")
+	{
+		TestParticleController particleController;
+		TestParticleGenerator particleGenerator;
+		Nz::ParticleGroup particleGroup(5000, Nz::ParticleLayout_Billboard, Nz::ParticleStorage_Separated);
+		particleGroup.EnableParallelUpdate(true);
+
+		particleGroup.AddController(&particleController);
+		particleGroup.AddGenerator(&particleGenerator);
+
+		WHEN("We generate particles with different lifetimes")
+		{
+			particleGroup.GenerateParticles(5000);
+
+			Nz::ParticleMapper mapper = particleGroup.GetParticleMapper();
+			Nz::SparsePtr<float> lifePtr = mapper.GetComponentPtr<float>(Nz::ParticleComponent_Life);
+			for (unsigned int i = 0; i < 5000; ++i)
+				lifePtr[i] = (i % 2 == 0) ? 0.5f : 2.f;
+
+			particleGroup.Update(1.f);
+
+			THEN("Only the particles which should survive are kept")
+			{
+				REQUIRE(particleGroup.GetParticleCount() == 2500);
+
+				Nz::SparsePtr<Nz::Vector3f> velocityPtr = mapper.GetComponentPtr<Nz::Vector3f>(Nz::ParticleComponent_Velocity);
+				bool allAlive = true;
+				for (unsigned int i = 0; i < 2500; ++i)
+					allAlive = allAlive && (lifePtr[i] > 0.f) && (velocityPtr[i] == Nz::Vector3f::UnitX());
+
+				CHECK(allAlive);
+			}
+
+			AND_THEN("We update to make them all die")
+			{
+				particleGroup.Update(2.f);
+				REQUIRE(particleGroup.GetParticleCount() == 0);
+			}
+		}
+	}
+}
+
+SCENARIO("ParticleGroup bounding volume", "[GRAPHICS][PARTICLEGROUP]")
+{
+	GIVEN("A particle group of billboards at known positions")
+	{
+		TestParticleController particleController;
+		Nz::ParticleGroup particleGroup(10, Nz::ParticleLayout_Billboard);
+		particleGroup.AddController(&particleController);
+
+		WHEN("There is no particle")
+		{
+			particleGroup.EnsureBoundingVolumeUpdated();
+
+			THEN("Its volume is null, so it can be culled")
+			{
+				REQUIRE(particleGroup.GetBoundingVolume().IsNull());
+			}
+		}
+
+		WHEN("We create two particles and update the group")
+		{
+			particleGroup.CreateParticles(2);
+
+			Nz::ParticleMapper mapper = particleGroup.GetParticleMapper();
+			Nz::SparsePtr<Nz::Vector3f> positionPtr = mapper.GetComponentPtr<Nz::Vector3f>(Nz::ParticleComponent_Position);
+			Nz::SparsePtr<Nz::Vector2f> sizePtr = mapper.GetComponentPtr<Nz::Vector2f>(Nz::ParticleComponent_Size);
+			Nz::SparsePtr<float> lifePtr = mapper.GetComponentPtr<float>(Nz::ParticleComponent_Life);
+
+			positionPtr[0] = Nz::Vector3f(-1.f, 0.f, 2.f);
+			positionPtr[1] = Nz::Vector3f(3.f, 4.f, 5.f);
+			sizePtr[0] = Nz::Vector2f(3.f, 4.f);
+			sizePtr[1] = Nz::Vector2f(1.f, 1.f);
+			lifePtr[0] = 10.f;
+			lifePtr[1] = 10.f;
+
+			particleGroup.Update(1.f);
+			particleGroup.EnsureBoundingVolumeUpdated();
+
+			THEN("Its box holds the positions, extended by half the diagonal of the biggest particle")
+			{
+				const Nz::BoundingVolumef& boundingVolume = particleGroup.GetBoundingVolume();
+				REQUIRE(boundingVolume.IsFinite());
+				CHECK(boundingVolume.aabb == Nz::Boxf(-3.5f, -2.5f, -0.5f, 9.f, 9.f, 8.f));
+			}
+
+			AND_THEN("We kill them all")
+			{
+				particleGroup.KillParticles();
+				particleGroup.EnsureBoundingVolumeUpdated();
+
+				REQUIRE(particleGroup.GetBoundingVolume().IsNull());
+			}
+		}
+	}
+}
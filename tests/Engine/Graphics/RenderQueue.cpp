@@ -0,0 +1,63 @@
+#include <Nazara/Graphics/RenderQueue.hpp>
+#include <Catch/catch.hpp>
+
+#include <random>
+#include <vector>
+
+SCENARIO("RenderQueue", "[GRAPHICS][RENDERQUEUE]")
+{
+	GIVEN("A render queue filled with many items")
+	{
+		struct Item
+		{
+			Nz::UInt64 key;
+			std::size_t insertionIndex;
+		};
+
+		constexpr std::size_t ItemCount = 1000; // Large enough to use the radix sort
+
+		std::mt19937_64 randomEngine(42);
+		Nz::RenderQueue<Item> renderQueue;
+		for (std::size_t i = 0; i < ItemCount; ++i)
+		{
+			// Few distinct keys spread over every byte, so equal keys happen and some bytes are shared
+			Nz::UInt64 key = (randomEngine() % 16) << 60 | (randomEngine() % 4) << 28 | (randomEngine() % 8);
+			renderQueue.Insert({key, i});
+		}
+
+		WHEN("We sort it")
+		{
+			renderQueue.Sort([](const Item& item) { return item.key; });
+
+			THEN("Items are ordered by key, keeping insertion order for equal keys")
+			{
+				REQUIRE(renderQueue.size() == ItemCount);
+
+				std::vector<Item> items(renderQueue.begin(), renderQueue.end());
+
+				bool ordered = true;
+				for (std::size_t i = 1; i < items.size(); ++i)
+				{
+					if (items[i - 1].key > items[i].key || (items[i - 1].key == items[i].key && items[i - 1].insertionIndex > items[i].insertionIndex))
+						ordered = false;
+				}
+
+				CHECK(ordered);
+			}
+		}
+
+		WHEN("We sort it again with other keys")
+		{
+			renderQueue.Sort([](const Item& item) { return item.key; });
+			renderQueue.Sort([](const Item& item) { return ~static_cast<Nz::UInt64>(item.insertionIndex); });
+
+			THEN("The new order is used")
+			{
+				std::vector<Item> items(renderQueue.begin(), renderQueue.end());
+				REQUIRE(items.size() == ItemCount);
+				CHECK(items.front().insertionIndex == ItemCount - 1);
+				CHECK(items.back().insertionIndex == 0);
+			}
+		}
+	}
+}
@@ -0,0 +1,68 @@
+#include <Nazara/Graphics/ResidencyManager.hpp>
+#include <Nazara/Graphics/Material.hpp>
+#include <Catch/catch.hpp>
+
+SCENARIO("ResidencyManager", "[GRAPHICS][RESIDENCYMANAGER]")
+{
+	GIVEN("A manager streaming a 256x256 texture")
+	{
+		Nz::ResidencyManager residencyManager;
+
+		Nz::ImageRef image = Nz::Image::New();
+		REQUIRE(image->Create(Nz::ImageType_2D, Nz::PixelFormatType_RGBA8, 256, 256));
+		image->Fill(Nz::Color::Red);
+
+		Nz::TextureRef texture = residencyManager.StreamTexture(image);
+		REQUIRE(texture.IsValid());
+
+		WHEN("It isn't requested")
+		{
+			residencyManager.Update();
+
+			THEN("Only its lowest levels are resident")
+			{
+				CHECK(residencyManager.IsResident(texture));
+				CHECK(residencyManager.GetResidentLevel(texture) == 2);
+				CHECK(texture->GetWidth() == 64);
+				CHECK(residencyManager.GetTextureMemoryUsage() == texture->GetMemoryUsage());
+			}
+		}
+
+		WHEN("Its material is requested at its full size")
+		{
+			Nz::MaterialRef material = Nz::Material::New();
+			material->SetDiffuseMap(texture);
+
+			residencyManager.Request(material, 256.f);
+			residencyManager.Update();
+
+			THEN("Its higher levels are streamed in")
+			{
+				CHECK(residencyManager.GetResidentLevel(texture) == 0);
+				CHECK(texture->GetWidth() == 256);
+				CHECK(texture->GetLevelCount() == image->GetLevelCount());
+			}
+
+			AND_WHEN("Another texture is requested beyond the budget")
+			{
+				Nz::ImageRef otherImage = Nz::Image::New();
+				REQUIRE(otherImage->Create(Nz::ImageType_2D, Nz::PixelFormatType_RGBA8, 256, 256));
+
+				Nz::TextureRef otherTexture = residencyManager.StreamTexture(otherImage);
+				REQUIRE(otherTexture.IsValid());
+
+				residencyManager.SetTextureBudget(residencyManager.GetTextureMemoryUsage());
+				residencyManager.Request(otherTexture, 256.f);
+				residencyManager.Update();
+
+				THEN("The texture which wasn't requested drops to its lowest level")
+				{
+					CHECK(residencyManager.GetResidentLevel(otherTexture) == 0);
+					CHECK(residencyManager.GetResidentLevel(texture) == 2);
+					CHECK(texture->IsValid());
+					CHECK(residencyManager.GetTextureMemoryUsage() <= residencyManager.GetTextureBudget());
+				}
+			}
+		}
+	}
+}
@@ -1,4 +1,5 @@
 #include <Nazara/Graphics/SkeletalModel.hpp>
+#include <Nazara/Utility/Joint.hpp>
 #include <Catch/catch.hpp>
 
 SCENARIO("SkeletalModel", "[GRAPHICS][SKELETALMODEL]")
@@ -21,6 +22,33 @@ SCENARIO("SkeletalModel", "[GRAPHICS][SKELETALMODEL]")
 				skeletalModel.AdvanceAnimation(0.10f);
 				REQUIRE(skeletalModel.IsAnimationEnabled());
 			}
+
+			AND_THEN("Copies animated together share the pose of a single animated model")
+			{
+				Nz::SkeletalModel reference(skeletalModel);
+				Nz::SkeletalModel firstCopy(skeletalModel);
+				Nz::SkeletalModel secondCopy(skeletalModel);
+
+				Nz::SkeletalModel* models[] = {&firstCopy, &secondCopy};
+				for (unsigned int i = 0; i < 5; ++i)
+				{
+					reference.AdvanceAnimation(0.05f);
+					Nz::SkeletalModel::AdvanceAnimations(models, 2, 0.05f);
+				}
+
+				const Nz::Skeleton* referenceSkeleton = reference.GetSkeleton();
+				for (Nz::SkeletalModel* model : models)
+				{
+					const Nz::Skeleton* skeleton = static_cast<const Nz::SkeletalModel*>(model)->GetSkeleton();
+					for (Nz::UInt32 i = 0; i < referenceSkeleton->GetJointCount(); ++i)
+					{
+						CHECK(skeleton->GetJoint(i)->GetPosition() == referenceSkeleton->GetJoint(i)->GetPosition());
+						CHECK(skeleton->GetJoint(i)->GetRotation() == referenceSkeleton->GetJoint(i)->GetRotation());
+					}
+
+					CHECK(skeleton->GetAABB() == referenceSkeleton->GetAABB());
+				}
+			}
 		}
 	}
 }
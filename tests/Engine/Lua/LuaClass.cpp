@@ -142,6 +142,11 @@ SCENARIO("LuaClass", "[LUA][LUACLASS]")
 			test.BindMethod("GetI", &LuaClass_Test::GetI);
 			test.BindMethod("GetJ", &LuaClass_Test::GetJ);
 			test.BindMethod("GetDefault", &LuaClass_Test::GetDefault, 0);
+			test.BindMethod("GetIPlusArgumentCount", [] (Nz::LuaState& state, LuaClass_Test& instance, std::size_t argumentCount) -> int
+			{
+				state.Push(instance.GetI() + static_cast<int>(argumentCount));
+				return 1;
+			});
 
 			test.BindStaticMethod("StaticMethodWithArguments", [] (Nz::LuaState& state) -> int
 			{
@@ -188,6 +193,15 @@ SCENARIO("LuaClass", "[LUA][LUACLASS]")
 				});
 				luaInstance.SetGlobal("CheckFinalTest");
 
+				luaInstance.PushFunction([=](Nz::LuaState& state) -> int
+				{
+					int argIndex = 1;
+					int result = state.Check<int>(&argIndex);
+					CHECK(result == value + 2);
+					return 1;
+				});
+				luaInstance.SetGlobal("CheckCustomMethod");
+
 				REQUIRE(luaInstance.ExecuteFromFile("resources/Engine/Lua/LuaClass.lua"));
 				REQUIRE(luaInstance.GetGlobal("test_Test") == Nz::LuaType_Function);
 				luaInstance.Call(0);
@@ -212,6 +226,15 @@ SCENARIO("LuaClass", "[LUA][LUACLASS]")
 				});
 				luaInstance.SetGlobal("CheckInheritTest");
 
+				luaInstance.PushFunction([=](Nz::LuaState& state) -> int
+				{
+					int argIndex = 1;
+					int result = state.Check<int>(&argIndex);
+					CHECK(result == 8);
+					return 1;
+				});
+				luaInstance.SetGlobal("CheckInheritedMethod");
+
 				REQUIRE(luaInstance.ExecuteFromFile("resources/Engine/Lua/LuaClass.lua"));
 				REQUIRE(luaInstance.GetGlobal("test_InheritTest") == Nz::LuaType_Function);
 				luaInstance.Call(0);
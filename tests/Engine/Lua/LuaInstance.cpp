@@ -41,6 +41,50 @@ SCENARIO("LuaInstance", "[LUA][LUAINSTANCE]")
 				REQUIRE_THAT(luaInstance.GetLastError().ToStdString(), Catch::Matchers::Contains("time"));
 			}
 		}
+
+		WHEN("We control the garbage collection")
+		{
+			luaInstance.EnableAutomaticGarbageCollection(false);
+			CHECK(!luaInstance.IsAutomaticGarbageCollectionEnabled());
+
+			REQUIRE(luaInstance.Execute(R"(
+				local t = {}
+				for i = 1, 10000 do
+					t[i] = { i, i .. "" }
+				end
+				t = nil
+			)"));
+
+			Nz::LuaInstance::MemoryStatistics statistics = luaInstance.GetMemoryStatistics();
+			CHECK(statistics.memoryUsage == luaInstance.GetMemoryUsage());
+			CHECK(statistics.peakMemoryUsage >= statistics.memoryUsage);
+			CHECK(statistics.pooledBlockCount > 10000);
+			CHECK(statistics.allocatedBlockCount >= statistics.pooledBlockCount);
+			CHECK(statistics.poolCapacity > 0);
+
+			THEN("Stepping it reclaims the garbage, until a cycle is completed")
+			{
+				unsigned int stepCount = 0;
+				while (!luaInstance.StepGarbageCollection(100) && stepCount < 10000)
+					stepCount++;
+
+				CHECK(stepCount < 10000);
+
+				Nz::LuaInstance::MemoryStatistics newStatistics = luaInstance.GetMemoryStatistics();
+				CHECK(newStatistics.memoryUsage < statistics.memoryUsage);
+				CHECK(newStatistics.pooledBlockCount < statistics.pooledBlockCount);
+				CHECK(newStatistics.peakMemoryUsage == statistics.peakMemoryUsage);
+			}
+
+			AND_THEN("A full collection reclaims it too")
+			{
+				luaInstance.CollectGarbage();
+				CHECK(luaInstance.GetMemoryUsage() < statistics.memoryUsage);
+
+				luaInstance.EnableAutomaticGarbageCollection(true);
+				CHECK(luaInstance.IsAutomaticGarbageCollectionEnabled());
+			}
+		}
 	}
 
 	GIVEN("Two instances")
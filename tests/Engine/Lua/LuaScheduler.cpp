@@ -0,0 +1,173 @@
+#include <Nazara/Lua/LuaScheduler.hpp>
+#include <Catch/catch.hpp>
+#include <Nazara/Core/ErrorFlags.hpp>
+
+namespace
+{
+	const char* s_scripts = R"(
+		counter = 0
+
+		function yielding()
+			for i = 1, 3 do
+				counter = counter + 1
+				coroutine.yield()
+			end
+		end
+
+		function busy()
+			local x = 0
+			for i = 1, 100000 do
+				x = x + i
+			end
+
+			busyResult = x
+		end
+
+		function failing()
+			error("failing script")
+		end
+	)";
+}
+
+SCENARIO("LuaScheduler", "[LUA][LUASCHEDULER]")
+{
+	GIVEN("A scheduler with two instances")
+	{
+		Nz::LuaScheduler scheduler(2);
+		REQUIRE(scheduler.GetInstanceCount() == 2);
+
+		for (unsigned int i = 0; i < scheduler.GetInstanceCount(); ++i)
+		{
+			Nz::LuaInstance& instance = scheduler.GetInstance(i);
+			instance.LoadLibraries(Nz::LuaLib_Coroutine);
+			REQUIRE(instance.Execute(s_scripts));
+		}
+
+		unsigned int errorCount = 0;
+		unsigned int finishedCount = 0;
+
+		NazaraSlot(Nz::LuaScheduler, OnScriptError, onError);
+		onError.Connect(scheduler.OnScriptError, [&] (Nz::LuaScheduler*, Nz::LuaScheduler::ScriptId, const Nz::String& error)
+		{
+			CHECK(error.Contains("failing script"));
+			errorCount++;
+		});
+
+		NazaraSlot(Nz::LuaScheduler, OnScriptFinished, onFinished);
+		onFinished.Connect(scheduler.OnScriptFinished, [&] (Nz::LuaScheduler*, Nz::LuaScheduler::ScriptId)
+		{
+			finishedCount++;
+		});
+
+		WHEN("We spawn scripts which yield")
+		{
+			std::vector<Nz::LuaScheduler::ScriptId> scripts;
+			for (unsigned int i = 0; i < 10; ++i)
+				scripts.push_back(scheduler.Spawn("yielding"));
+
+			REQUIRE(scheduler.GetRunningScriptCount() == 10);
+
+			THEN("They are resumed once per update, on both instances")
+			{
+				for (unsigned int i = 0; i < 3; ++i)
+				{
+					scheduler.Update();
+					CHECK(scheduler.GetRunningScriptCount() == 10);
+				}
+
+				for (unsigned int i = 0; i < scheduler.GetInstanceCount(); ++i)
+				{
+					Nz::LuaInstance& instance = scheduler.GetInstance(i);
+					REQUIRE(instance.GetGlobal("counter") == Nz::LuaType_Number);
+					CHECK(instance.ToInteger(-1) == 15);
+					instance.Pop();
+				}
+
+				scheduler.Update();
+				CHECK(scheduler.GetRunningScriptCount() == 0);
+				CHECK(finishedCount == 10);
+				CHECK(!scheduler.IsRunning(scripts.front()));
+			}
+
+			AND_WHEN("We kill one of them")
+			{
+				scheduler.Kill(scripts.front());
+				CHECK(!scheduler.IsRunning(scripts.front()));
+				CHECK(scheduler.IsRunning(scripts.back()));
+
+				for (unsigned int i = 0; i < 4; ++i)
+					scheduler.Update();
+
+				THEN("The others end normally")
+				{
+					CHECK(finishedCount == 9);
+					CHECK(scheduler.GetRunningScriptCount() == 0);
+				}
+			}
+		}
+
+		WHEN("We spawn a script with an instruction budget")
+		{
+			Nz::LuaScheduler::ScriptId script = scheduler.Spawn("busy", 0);
+			scheduler.SetInstructionBudget(script, 10000);
+			CHECK(scheduler.GetInstructionBudget(script) == 10000);
+
+			scheduler.Update();
+
+			THEN("It is suspended once its budget is exhausted, until it ends")
+			{
+				CHECK(scheduler.IsRunning(script));
+
+				unsigned int updateCount = 1;
+				while (scheduler.IsRunning(script) && updateCount < 1000)
+				{
+					scheduler.Update();
+					updateCount++;
+				}
+
+				CHECK(updateCount > 10);
+				CHECK(finishedCount == 1);
+
+				Nz::LuaInstance& instance = scheduler.GetInstance(0);
+				REQUIRE(instance.GetGlobal("busyResult") == Nz::LuaType_Number);
+				CHECK(instance.ToInteger(-1) == 5000050000LL);
+				instance.Pop();
+			}
+		}
+
+		WHEN("A script fails")
+		{
+			Nz::LuaScheduler::ScriptId script = scheduler.Spawn("failing");
+			scheduler.Update();
+
+			THEN("The error is signaled")
+			{
+				CHECK(!scheduler.IsRunning(script));
+				CHECK(errorCount == 1);
+				CHECK(finishedCount == 0);
+			}
+
+			AND_WHEN("We spawn another script after it")
+			{
+				Nz::LuaScheduler::ScriptId newScript = scheduler.Spawn("busy");
+
+				THEN("It gets a different identifier")
+				{
+					CHECK(newScript != script);
+					CHECK(scheduler.IsRunning(newScript));
+					CHECK(!scheduler.IsRunning(script));
+				}
+			}
+		}
+
+		WHEN("We spawn a function which doesn't exist")
+		{
+			THEN("It fails")
+			{
+				Nz::ErrorFlags errFlags(Nz::ErrorFlag_Silent | Nz::ErrorFlag_ThrowExceptionDisabled);
+				CHECK(scheduler.Spawn("unknown") == 0);
+				CHECK(scheduler.GetRunningScriptCount() == 0);
+			}
+		}
+	}
+}
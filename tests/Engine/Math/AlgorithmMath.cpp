@@ -1,6 +1,7 @@
 #include <Nazara/Math/Algorithm.hpp>
 #include <Catch/catch.hpp>
 #include <limits>
+#include <vector>
 
 TEST_CASE("Approach", "[MATH][ALGORITHM]")
 {
@@ -64,6 +65,47 @@ TEST_CASE("DegreeToRadian", "[MATH][ALGORITHM]")
 	}
 }
 
+TEST_CASE("FastSinCos", "[MATH][ALGORITHM]")
+{
+	SECTION("Fast sine and cosine of 4 angles are close to std::sin and std::cos")
+	{
+		for (float angle : { 0.f, float(M_PI) / 6.f, -3.f * float(M_PI) / 4.f, 42.f })
+		{
+			float sine, cosine;
+			Nz::FastSinCos(angle, &sine, &cosine);
+
+			CHECK(sine == Approx(std::sin(angle)).margin(1e-6));
+			CHECK(cosine == Approx(std::cos(angle)).margin(1e-6));
+		}
+	}
+
+	SECTION("Batched fast sine and cosine match the single angle version")
+	{
+		std::vector<float> angles(1003);
+		for (std::size_t i = 0; i < angles.size(); ++i)
+			angles[i] = -200.f + 0.4f * i;
+
+		std::vector<float> sines(angles.size());
+		std::vector<float> cosines(angles.size());
+		Nz::FastSinCos(angles.data(), angles.size(), sines.data(), cosines.data());
+
+		bool accurate = true;
+		for (std::size_t i = 0; i < angles.size(); ++i)
+		{
+			float sine, cosine;
+			Nz::FastSinCos(angles[i], &sine, &cosine);
+
+			if (std::abs(sines[i] - sine) > 1e-6f || std::abs(cosines[i] - cosine) > 1e-6f)
+				accurate = false;
+
+			if (std::abs(sines[i] - std::sin(angles[i])) > 1e-6f || std::abs(cosines[i] - std::cos(angles[i])) > 1e-6f)
+				accurate = false;
+		}
+
+		REQUIRE(accurate);
+	}
+}
+
 TEST_CASE("GetNearestPowerOfTwo", "[MATH][ALGORITHM]")
 {
 	SECTION("Nearest power of two of 0 = 1")
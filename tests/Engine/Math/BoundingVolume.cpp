@@ -1,4 +1,5 @@
 #include <Nazara/Math/BoundingVolume.hpp>
+#include <Nazara/Math/EulerAngles.hpp>
 #include <Catch/catch.hpp>
 
 SCENARIO("BoundingVolume", "[MATH][BOUNDINGVOLUME]")
@@ -162,4 +163,40 @@ SCENARIO("BoundingVolume", "[MATH][BOUNDINGVOLUME]")
 			}
 		}
 	}
+
+	GIVEN("Multiple local boxes with their own transform")
+	{
+		Nz::Boxf localBoxes[] = {
+			Nz::Boxf(-1.f, -1.f, -1.f, 2.f, 2.f, 2.f),
+			Nz::Boxf(0.f, 1.f, 2.f, 3.f, 4.f, 5.f),
+			Nz::Boxf(-2.f, 0.5f, -3.f, 1.f, 1.f, 6.f)
+		};
+
+		Nz::Matrix4f transformMatrices[] = {
+			Nz::Matrix4f::Identity(),
+			Nz::Matrix4f::Transform(Nz::Vector3f(10.f, -5.f, 2.f), Nz::EulerAnglesf(30.f, 45.f, 60.f).ToQuaternion()),
+			Nz::Matrix4f::Transform(Nz::Vector3f(-1.f, 2.f, 3.f), Nz::EulerAnglesf(0.f, 90.f, 0.f).ToQuaternion(), Nz::Vector3f(2.f, 0.5f, 1.f))
+		};
+
+		WHEN("We compute their bounding volumes at once")
+		{
+			Nz::BoundingVolumef volumes[3];
+			Nz::BoundingVolumef::Update(localBoxes, transformMatrices, 3, volumes);
+
+			THEN("They should match bounding volumes computed one by one")
+			{
+				for (unsigned int i = 0; i < 3; ++i)
+				{
+					Nz::BoundingVolumef expected(localBoxes[i]);
+					expected.Update(transformMatrices[i]);
+
+					CHECK(volumes[i].IsFinite());
+					CHECK(volumes[i].obb.localBox == localBoxes[i]);
+					CHECK(volumes[i].aabb == expected.aabb);
+					for (unsigned int j = 0; j <= Nz::BoxCorner_Max; ++j)
+						CHECK(volumes[i].obb(j) == expected.obb(j));
+				}
+			}
+		}
+	}
 }
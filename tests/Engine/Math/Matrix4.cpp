@@ -2,6 +2,7 @@
 #include <Catch/catch.hpp>
 
 #include <array>
+#include <cstring>
 
 SCENARIO("Matrix4", "[MATH][MATRIX4]")
 {
@@ -305,4 +306,120 @@ SCENARIO("Matrix4", "[MATH][MATRIX4]")
 			}
 		}
 	}
+
+	GIVEN("Some arbitrary float matrices")
+	{
+		Nz::Matrix4f left(0.3f, -1.7f, 2.1f, 0.4f,
+		                  5.5f, 0.9f, -0.25f, 1.3f,
+		                  -3.1f, 0.7f, 1.9f, -0.6f,
+		                  2.2f, -4.4f, 0.15f, 1.1f);
+
+		Nz::Matrix4f right(1.05f, 0.2f, -0.33f, 0.8f,
+		                   -2.7f, 3.3f, 0.45f, -1.2f,
+		                   0.6f, -0.9f, 2.8f, 0.05f,
+		                   -1.5f, 0.35f, 4.1f, 0.95f);
+
+		// Scalar reference, written the way the generic implementation computes it
+		auto concatenate = [](const Nz::Matrix4f& a, const Nz::Matrix4f& b)
+		{
+			const float* lhs = a;
+			const float* rhs = b;
+
+			Nz::Matrix4f result;
+			float* values = result;
+			for (unsigned int i = 0; i < 4; ++i)
+			{
+				for (unsigned int j = 0; j < 4; ++j)
+					values[i*4 + j] = lhs[i*4]*rhs[j] + lhs[i*4 + 1]*rhs[4 + j] + lhs[i*4 + 2]*rhs[8 + j] + lhs[i*4 + 3]*rhs[12 + j];
+			}
+
+			return result;
+		};
+
+		// Comparison operators allow an epsilon, results must be exactly the same here
+		auto identical = [](const auto& a, const auto& b)
+		{
+			return std::memcmp(&a, &b, sizeof(a)) == 0;
+		};
+
+		WHEN("We concatenate them")
+		{
+			THEN("We get exactly the scalar product")
+			{
+				CHECK(identical(Nz::Matrix4f::Concatenate(left, right), concatenate(left, right)));
+
+				Nz::Matrix4f squared(left);
+				squared.Concatenate(squared);
+				CHECK(identical(squared, concatenate(left, left)));
+			}
+
+			AND_THEN("Arrays of matrices give the same results")
+			{
+				Nz::Matrix4f lefts[3] = { left, right, Nz::Matrix4f::Identity() };
+				Nz::Matrix4f rights[3] = { right, left, left };
+
+				Nz::Matrix4f::Concatenate(lefts, rights, 3, lefts);
+				CHECK(identical(lefts[0], concatenate(left, right)));
+				CHECK(identical(lefts[1], concatenate(right, left)));
+				CHECK(identical(lefts[2], left));
+			}
+		}
+
+		WHEN("We concatenate affine matrices")
+		{
+			Nz::Matrix4f first = Nz::Matrix4f::Transform(Nz::Vector3f(1.5f, -2.f, 0.25f), Nz::EulerAnglesf(10.f, 20.f, 30.f), Nz::Vector3f(1.f, 2.f, 0.5f));
+			Nz::Matrix4f second = Nz::Matrix4f::Transform(Nz::Vector3f(-0.3f, 7.f, 2.f), Nz::EulerAnglesf(-45.f, 5.f, 60.f));
+
+			THEN("We get exactly the scalar product with an exact last column")
+			{
+				Nz::Matrix4f result = Nz::Matrix4f::ConcatenateAffine(first, second);
+				Nz::Matrix4f expected = concatenate(first, second);
+				for (unsigned int i = 0; i < 4; ++i)
+				{
+					Nz::Vector3f row(result.GetRow(i));
+					Nz::Vector3f expectedRow(expected.GetRow(i));
+					CHECK(identical(row, expectedRow));
+				}
+
+				Nz::Vector4f lastColumn(result.m14, result.m24, result.m34, result.m44);
+				CHECK(identical(lastColumn, Nz::Vector4f(0.f, 0.f, 0.f, 1.f)));
+			}
+		}
+
+		WHEN("We transform vectors")
+		{
+			Nz::Vector4f vectors[5] = { {1.f, 2.f, 3.f, 1.f}, {-0.5f, 0.25f, 8.f, 0.f}, {3.3f, -7.1f, 0.2f, 2.f}, {0.f, 0.f, 0.f, 1.f}, {1e3f, -1e-3f, 42.f, -1.f} };
+
+			THEN("We get exactly the scalar results, one by one or by arrays")
+			{
+				Nz::Vector4f transformed[5];
+				left.Transform(vectors, 5, transformed);
+
+				Nz::Vector3f positions[5];
+				for (unsigned int i = 0; i < 5; ++i)
+					positions[i] = Nz::Vector3f(vectors[i].x, vectors[i].y, vectors[i].z);
+
+				left.Transform(positions, 5, positions, 2.f);
+
+				for (unsigned int i = 0; i < 5; ++i)
+				{
+					const Nz::Vector4f& v = vectors[i];
+					Nz::Vector4f expected(left.m11*v.x + left.m21*v.y + left.m31*v.z + left.m41*v.w,
+					                      left.m12*v.x + left.m22*v.y + left.m32*v.z + left.m42*v.w,
+					                      left.m13*v.x + left.m23*v.y + left.m33*v.z + left.m43*v.w,
+					                      left.m14*v.x + left.m24*v.y + left.m34*v.z + left.m44*v.w);
+
+					CHECK(identical(left.Transform(v), expected));
+					CHECK(identical(transformed[i], expected));
+
+					Nz::Vector3f expectedPosition(left.m11*v.x + left.m21*v.y + left.m31*v.z + left.m41*2.f,
+					                              left.m12*v.x + left.m22*v.y + left.m32*v.z + left.m42*2.f,
+					                              left.m13*v.x + left.m23*v.y + left.m33*v.z + left.m43*2.f);
+
+					CHECK(identical(left.Transform(Nz::Vector3f(v.x, v.y, v.z), 2.f), expectedPosition));
+					CHECK(identical(positions[i], expectedPosition));
+				}
+			}
+		}
+	}
 }
@@ -0,0 +1,200 @@
+#include <Nazara/Network/ENetLz4Compressor.hpp>
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/ENetPeer.hpp>
+#include <Nazara/Network/NetBuffer.hpp>
+#include <Catch/catch.hpp>
+#include <array>
+#include <random>
+
+namespace
+{
+	Nz::ByteArray BuildDatagram(std::mt19937& generator, Nz::UInt32 entityCount)
+	{
+		std::uniform_int_distribution<int> dis(0, 255);
+
+		// Looks like a game state update: fixed layout with a few changing values
+		Nz::ByteArray datagram;
+		for (Nz::UInt32 i = 0; i < entityCount; ++i)
+		{
+			const char header[] = "entity:position:rotation:velocity:";
+			datagram.Append(header, sizeof(header) - 1);
+
+			Nz::UInt8 values[] = { Nz::UInt8(i), Nz::UInt8(dis(generator)), 0, 0, Nz::UInt8(dis(generator)), 0x3F, 0x80, 0 };
+			datagram.Append(values, sizeof(values));
+		}
+
+		return datagram;
+	}
+
+	std::size_t RoundTrip(Nz::ENetLz4Compressor& compressor, const Nz::ByteArray& input, Nz::ByteArray* output)
+	{
+		Nz::NetBuffer buffers[2];
+		buffers[0].data = const_cast<Nz::UInt8*>(input.GetConstBuffer());
+		buffers[0].dataLength = input.GetSize() / 2;
+		buffers[1].data = const_cast<Nz::UInt8*>(input.GetConstBuffer()) + buffers[0].dataLength;
+		buffers[1].dataLength = input.GetSize() - buffers[0].dataLength;
+
+		std::vector<Nz::UInt8> compressed(input.GetSize());
+		std::size_t compressedSize = compressor.Compress(nullptr, buffers, 2, input.GetSize(), compressed.data(), compressed.size());
+		if (compressedSize == 0)
+			return 0;
+
+		output->Resize(input.GetSize() * 2);
+		std::size_t decompressedSize = compressor.Decompress(nullptr, compressed.data(), compressedSize, output->GetBuffer(), output->GetSize());
+		output->Resize(decompressedSize);
+
+		return compressedSize;
+	}
+}
+
+SCENARIO("ENetLz4Compressor", "[NETWORK][ENETLZ4COMPRESSOR]")
+{
+	GIVEN("A compressor and a datagram with repetitions")
+	{
+		std::mt19937 generator(42);
+		Nz::ByteArray datagram = BuildDatagram(generator, 10);
+
+		Nz::ENetLz4Compressor compressor;
+
+		WHEN("We compress and decompress it")
+		{
+			Nz::ByteArray decompressed;
+			std::size_t compressedSize = RoundTrip(compressor, datagram, &decompressed);
+
+			THEN("It is smaller and we get it back")
+			{
+				CHECK(compressedSize > 0);
+				CHECK(compressedSize < datagram.GetSize());
+				CHECK(decompressed == datagram);
+			}
+		}
+
+		WHEN("We compress random data")
+		{
+			std::uniform_int_distribution<int> dis(0, 255);
+
+			Nz::ByteArray noise;
+			for (unsigned int i = 0; i < 512; ++i)
+				noise.PushBack(Nz::UInt8(dis(generator)));
+
+			Nz::ByteArray decompressed;
+
+			THEN("The compressor gives up")
+			{
+				CHECK(RoundTrip(compressor, noise, &decompressed) == 0);
+			}
+		}
+
+		WHEN("We train a dictionary on similar datagrams")
+		{
+			std::vector<Nz::ByteArray> samples;
+			for (unsigned int i = 0; i < 50; ++i)
+				samples.push_back(BuildDatagram(generator, 2));
+
+			Nz::ByteArray dictionary = Nz::ENetLz4Compressor::TrainDictionary(samples, 1024);
+			REQUIRE(!dictionary.IsEmpty());
+			CHECK(dictionary.GetSize() <= 1024);
+
+			Nz::ByteArray smallDatagram = BuildDatagram(generator, 1);
+
+			Nz::ByteArray decompressed;
+			std::size_t withoutDictionary = RoundTrip(compressor, smallDatagram, &decompressed);
+
+			compressor.SetDictionary(dictionary.GetConstBuffer(), dictionary.GetSize());
+			CHECK(compressor.GetDictionary() == dictionary);
+
+			std::size_t withDictionary = RoundTrip(compressor, smallDatagram, &decompressed);
+
+			THEN("Small datagrams compress better")
+			{
+				REQUIRE(withDictionary > 0);
+				CHECK(decompressed == smallDatagram);
+				CHECK((withoutDictionary == 0 || withDictionary < withoutDictionary));
+			}
+
+			AND_THEN("A compressor without the dictionary can't decompress them")
+			{
+				Nz::NetBuffer buffer;
+				buffer.data = smallDatagram.GetBuffer();
+				buffer.dataLength = smallDatagram.GetSize();
+
+				std::vector<Nz::UInt8> compressed(smallDatagram.GetSize());
+				std::size_t compressedSize = compressor.Compress(nullptr, &buffer, 1, buffer.dataLength, compressed.data(), compressed.size());
+				REQUIRE(compressedSize > 0);
+
+				Nz::ENetLz4Compressor otherCompressor;
+				std::array<Nz::UInt8, 1024> output;
+				std::size_t decompressedSize = otherCompressor.Decompress(nullptr, compressed.data(), compressedSize, output.data(), output.size());
+				CHECK(decompressedSize == 0);
+			}
+		}
+	}
+
+	GIVEN("Two ENet hosts using the compressor")
+	{
+		std::random_device rd;
+		std::uniform_int_distribution<Nz::UInt16> dis(1025, 65535);
+
+		Nz::UInt16 port = dis(rd);
+
+		Nz::ENetHost server;
+		REQUIRE(server.Create(Nz::NetProtocol_IPv4, port, 1));
+		server.SetCompressor(std::make_unique<Nz::ENetLz4Compressor>());
+
+		Nz::ENetHost client;
+		REQUIRE(client.Create(Nz::NetProtocol_IPv4, 0, 1));
+		client.SetCompressor(std::make_unique<Nz::ENetLz4Compressor>());
+
+		Nz::ENetPeer* serverPeer = client.Connect(Nz::IpAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), port));
+		REQUIRE(serverPeer);
+
+		WHEN("The client sends a packet with repetitions")
+		{
+			Nz::ENetPeer* clientPeer = nullptr;
+			bool received = false;
+
+			Nz::UInt64 startTime = Nz::GetElapsedMilliseconds();
+			while (!received && Nz::GetElapsedMilliseconds() - startTime < 2000)
+			{
+				Nz::ENetEvent event;
+				if (client.Service(&event, 5) > 0 && event.type == Nz::ENetEventType::OutgoingConnect)
+				{
+					Nz::NetPacket packet(1);
+					for (unsigned int i = 0; i < 50; ++i)
+						packet << Nz::UInt32(1234);
+
+					serverPeer->Send(0, Nz::ENetPacketFlag_Reliable, std::move(packet));
+				}
+
+				if (server.Service(&event, 5) > 0)
+				{
+					if (event.type == Nz::ENetEventType::IncomingConnect)
+						clientPeer = event.peer;
+					else if (event.type == Nz::ENetEventType::Receive)
+					{
+						Nz::UInt32 value;
+						event.packet->data >> value;
+						CHECK(value == 1234);
+
+						received = true;
+					}
+				}
+			}
+
+			THEN("It is received and both peers report compression statistics")
+			{
+				REQUIRE(received);
+				REQUIRE(clientPeer);
+
+				const Nz::ENetPeer::CompressionStats& sendStats = serverPeer->GetCompressionStats();
+				CHECK(sendStats.compressedDatagramCount > 0);
+				CHECK(sendStats.outgoingCompressedSize < sendStats.outgoingRawSize);
+
+				const Nz::ENetPeer::CompressionStats& receiveStats = clientPeer->GetCompressionStats();
+				CHECK(receiveStats.decompressedDatagramCount > 0);
+				CHECK(receiveStats.incomingCompressedSize < receiveStats.incomingDecompressedSize);
+			}
+		}
+	}
+}
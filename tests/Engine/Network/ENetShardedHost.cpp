@@ -0,0 +1,106 @@
+#include <Nazara/Network/ENetShardedHost.hpp>
+#include <Catch/catch.hpp>
+
+#include <Nazara/Core/Clock.hpp>
+#include <random>
+
+SCENARIO("ENetShardedHost", "[NETWORK][ENETSHARDEDHOST]")
+{
+	GIVEN("A sharded server and an ENetHost client")
+	{
+		std::random_device rd;
+		std::uniform_int_distribution<Nz::UInt16> dis(1025, 65535);
+
+		Nz::UInt16 port = dis(rd);
+		Nz::IpAddress listenAddress = Nz::IpAddress::AnyIpV4;
+		listenAddress.SetPort(port);
+
+		Nz::ENetShardedHost server;
+		REQUIRE(server.Create(listenAddress, 2, 4));
+		CHECK(server.GetShardCount() == 2);
+
+		Nz::ENetHost client;
+		REQUIRE(client.Create(Nz::NetProtocol_IPv4, 0, 1));
+
+		Nz::IpAddress serverIP(Nz::IpAddress::LoopbackIpV4.ToIPv4(), port);
+		Nz::ENetPeer* serverPeer = client.Connect(serverIP);
+		REQUIRE(serverPeer);
+
+		// Services the client until the server gets an event of the wanted type
+		auto WaitForServerEvent = [&](Nz::ENetEventType type, Nz::ENetShardedHost::Event* serverEvent)
+		{
+			Nz::UInt64 startTime = Nz::GetElapsedMilliseconds();
+			while (Nz::GetElapsedMilliseconds() - startTime < 2000)
+			{
+				Nz::ENetEvent clientEvent;
+				client.Service(&clientEvent, 10);
+
+				while (server.PollEvent(serverEvent))
+				{
+					if (serverEvent->type == type)
+						return true;
+				}
+			}
+
+			return false;
+		};
+
+		WHEN("The client connects")
+		{
+			Nz::ENetShardedHost::Event connectEvent;
+			REQUIRE(WaitForServerEvent(Nz::ENetEventType::IncomingConnect, &connectEvent));
+
+			THEN("One of the shards accepted it")
+			{
+				CHECK(connectEvent.shardIndex < server.GetShardCount());
+			}
+
+			AND_THEN("The client receives the packets sent to it")
+			{
+				Nz::NetPacket packet(1);
+				packet << Nz::UInt32(1234);
+				server.Send(connectEvent.shardIndex, connectEvent.peerId, 0, Nz::ENetPacketFlag_Reliable, std::move(packet));
+
+				bool received = false;
+				Nz::UInt64 startTime = Nz::GetElapsedMilliseconds();
+				while (!received && Nz::GetElapsedMilliseconds() - startTime < 2000)
+				{
+					Nz::ENetEvent clientEvent;
+					if (client.Service(&clientEvent, 10) > 0 && clientEvent.type == Nz::ENetEventType::Receive)
+					{
+						Nz::UInt32 value;
+						clientEvent.packet->data >> value;
+
+						CHECK(value == 1234);
+						received = true;
+					}
+				}
+
+				CHECK(received);
+			}
+
+			AND_THEN("The server receives the packets of the client")
+			{
+				for (Nz::UInt64 startTime = Nz::GetElapsedMilliseconds(); !serverPeer->IsConnected() && Nz::GetElapsedMilliseconds() - startTime < 2000;)
+				{
+					Nz::ENetEvent clientEvent;
+					client.Service(&clientEvent, 10);
+				}
+				REQUIRE(serverPeer->IsConnected());
+
+				Nz::NetPacket packet(1);
+				packet << Nz::UInt32(5678);
+				serverPeer->Send(0, Nz::ENetPacketFlag_Reliable, std::move(packet));
+
+				Nz::ENetShardedHost::Event receiveEvent;
+				REQUIRE(WaitForServerEvent(Nz::ENetEventType::Receive, &receiveEvent));
+
+				Nz::UInt32 value;
+				receiveEvent.packet >> value;
+
+				CHECK(receiveEvent.shardIndex == connectEvent.shardIndex);
+				CHECK(value == 5678);
+			}
+		}
+	}
+}
@@ -1,4 +1,5 @@
 #include <Nazara/Network/IpAddress.hpp>
+#include <Nazara/Network/HostnameResolver.hpp>
 #include <Catch/catch.hpp>
 
 SCENARIO("IpAddress", "[NETWORK][IPADDRESS]")
@@ -35,6 +36,23 @@ SCENARIO("IpAddress", "[NETWORK][IPADDRESS]")
 			}
 		}
 
+		WHEN("We resolve localhost asynchronously")
+		{
+			std::shared_future<Nz::HostnameResolution> resolution = Nz::IpAddress::ResolveHostnameAsync(Nz::NetProtocol_IPv4, "localhost");
+			REQUIRE(resolution.wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+
+			THEN("It resolves to the loop back, and is cached")
+			{
+				const Nz::HostnameResolution& result = resolution.get();
+				CHECK(result.error == Nz::ResolveError_NoError);
+				REQUIRE_FALSE(result.results.empty());
+				CHECK(result.results.front().address.IsLoopback());
+
+				std::shared_future<Nz::HostnameResolution> cached = Nz::IpAddress::ResolveHostnameAsync(Nz::NetProtocol_IPv4, "localhost");
+				CHECK(cached.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+			}
+		}
+
 		WHEN("We convert IP to hostname")
 		{
 			Nz::IpAddress google(8, 8, 8, 8);
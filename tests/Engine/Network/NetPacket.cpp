@@ -0,0 +1,78 @@
+#include <Nazara/Network/NetPacket.hpp>
+#include <Nazara/Core/TaskGroup.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Catch/catch.hpp>
+
+#include <atomic>
+#include <vector>
+
+SCENARIO("NetPacket", "[NETWORK][NETPACKET]")
+{
+	GIVEN("A packet which was released")
+	{
+		{
+			Nz::NetPacket packet(1, 1000);
+			packet << Nz::UInt32(42);
+		}
+
+		Nz::NetPacket::BufferPoolStats stats = Nz::NetPacket::GetBufferPoolStats();
+		CHECK(stats.heldBufferCount > 0);
+		CHECK(stats.heldBytes >= 1000);
+
+		WHEN("We create a packet of the same size")
+		{
+			Nz::NetPacket packet(2, 1000);
+
+			THEN("Its buffer comes from the pool")
+			{
+				Nz::NetPacket::BufferPoolStats newStats = Nz::NetPacket::GetBufferPoolStats();
+				CHECK(newStats.hitCount == stats.hitCount + 1);
+				CHECK(newStats.missCount == stats.missCount);
+				CHECK(newStats.heldBufferCount == stats.heldBufferCount - 1);
+			}
+		}
+	}
+
+	GIVEN("Packets used by tasks")
+	{
+		WHEN("Tasks create, fill and release packets of various sizes concurrently")
+		{
+			std::atomic_uint errorCount(0);
+			Nz::TaskGroup group;
+
+			for (unsigned int task = 0; task < 16; ++task)
+			{
+				Nz::TaskScheduler::AddTask(group, [&errorCount, task]()
+				{
+					std::vector<Nz::NetPacket> packets;
+					for (unsigned int i = 0; i < 200; ++i)
+					{
+						packets.emplace_back(Nz::UInt16(task), (i % 7) * 300);
+						packets.back() << Nz::UInt32(task << 16 | i);
+
+						if (i % 3 == 0)
+							packets.erase(packets.begin());
+					}
+
+					for (Nz::NetPacket& packet : packets)
+					{
+						Nz::UInt32 value;
+						packet.GetStream()->SetCursorPos(Nz::NetPacket::HeaderSize);
+						packet >> value;
+
+						if ((value >> 16) != task)
+							errorCount++;
+					}
+				});
+			}
+
+			Nz::TaskScheduler::Run();
+			Nz::TaskScheduler::WaitForTasks(group);
+
+			THEN("No buffer was given to two packets at once")
+			{
+				CHECK(errorCount == 0);
+			}
+		}
+	}
+}
@@ -1,4 +1,5 @@
 #include <Nazara/Network/RUdpConnection.hpp>
+#include <Nazara/Core/Thread.hpp>
 #include <Catch/catch.hpp>
 
 #include <Nazara/Math/Vector3.hpp>
@@ -44,4 +45,57 @@ SCENARIO("RUdpConnection", "[NETWORK][RUDPCONNECTION]")
 			}
 		}*/
 	}
+
+	GIVEN("A client connected to a server")
+	{
+		Nz::RUdpConnection server;
+		REQUIRE(server.Listen(Nz::NetProtocol_IPv4, 64270));
+
+		Nz::IpAddress serverIP(Nz::IpAddress::LoopbackIpV4.ToIPv4(), 64270);
+
+		Nz::RUdpConnection client;
+		REQUIRE(client.Listen(Nz::NetProtocol_IPv4, 64271));
+		REQUIRE(client.Connect(serverIP));
+
+		WHEN("The client sends more than its congestion window in one update")
+		{
+			Nz::RUdpConnection::PeerStats stats;
+			REQUIRE(client.GetPeerStats(serverIP, &stats));
+			std::size_t initialWindow = stats.congestionWindow;
+
+			Nz::NetPacket packet(1);
+			packet.Resize(1000);
+			for (unsigned int i = 0; i < 64; ++i)
+				REQUIRE(client.Send(serverIP, Nz::PacketPriority_Medium, Nz::PacketReliability_Reliable, packet));
+
+			client.Update();
+
+			THEN("Packets are held back by the window, and acknowledgements give a round trip time")
+			{
+				REQUIRE(client.GetPeerStats(serverIP, &stats));
+				CHECK(stats.bytesInFlight <= initialWindow);
+				CHECK(stats.sentPackets < 64);
+				CHECK(stats.roundTripTime == 0);
+
+				std::size_t received = 0;
+				for (unsigned int i = 0; i < 200 && received < 64; ++i)
+				{
+					Nz::Thread::Sleep(2);
+					server.Update();
+					client.Update();
+
+					Nz::RUdpMessage message;
+					while (server.PollMessage(&message))
+						received++;
+				}
+
+				CHECK(received >= 64); //< Spurious retransmissions may deliver a message twice
+
+				REQUIRE(client.GetPeerStats(serverIP, &stats));
+				CHECK(stats.roundTripTime > 0);
+				CHECK(stats.minRoundTripTime <= stats.roundTripTime);
+				CHECK(stats.congestionWindow >= 2 * Nz::RUdpConnection::CongestionSegmentSize);
+			}
+		}
+	}
 }
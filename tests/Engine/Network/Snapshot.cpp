@@ -0,0 +1,119 @@
+#include <Nazara/Network/Snapshot.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/ByteStream.hpp>
+#include <Nazara/Network/SnapshotDecoder.hpp>
+#include <Nazara/Network/SnapshotEncoder.hpp>
+#include <Catch/catch.hpp>
+
+SCENARIO("Snapshot", "[NETWORK][SNAPSHOT]")
+{
+	GIVEN("A schema and a world of a hundred entities")
+	{
+		Nz::SnapshotSchema schema;
+		std::size_t positionX = schema.AddFloat(-1000.f, 1000.f, 20);
+		std::size_t positionY = schema.AddFloat(-1000.f, 1000.f, 20);
+		std::size_t health = schema.AddInteger();
+		std::size_t isAlive = schema.AddBits(1);
+
+		Nz::Snapshot world(schema);
+		for (Nz::UInt32 i = 1; i <= 100; ++i)
+		{
+			world.SetFloat(i * 3, positionX, i * 10.f);
+			world.SetFloat(i * 3, positionY, i * -5.f);
+			world.SetValue(i * 3, health, 100);
+			world.SetValue(i * 3, isAlive, 1);
+		}
+
+		CHECK(world.GetEntityCount() == 100);
+		CHECK(world.GetFloat(30, positionX) == Approx(100.f).epsilon(0.001));
+
+		Nz::SnapshotEncoder encoder(schema);
+		Nz::SnapshotDecoder decoder(schema);
+
+		auto Transmit = [&](const Nz::Snapshot& snapshot, Nz::Snapshot* received, std::size_t* size)
+		{
+			Nz::ByteArray data;
+			{
+				Nz::ByteStream stream(&data);
+				REQUIRE(encoder.Encode(snapshot, stream));
+			}
+
+			*size = data.GetSize();
+
+			Nz::ByteStream stream(&data);
+			return decoder.Decode(stream, received);
+		};
+
+		WHEN("We send it without any acknowledgement")
+		{
+			Nz::Snapshot received(schema);
+			std::size_t fullSize;
+			REQUIRE(Transmit(world, &received, &fullSize));
+
+			THEN("It is written in full and decoded exactly")
+			{
+				CHECK(encoder.GetBaselineSequence() == 0);
+				CHECK(decoder.GetLastSequence() == 1);
+				CHECK(received == world);
+			}
+
+			AND_WHEN("The decoder acknowledges it and a few entities change")
+			{
+				encoder.Acknowledge(decoder.GetLastSequence());
+				CHECK(encoder.GetBaselineSequence() == 1);
+
+				world.SetFloat(30, positionX, 101.f);
+				world.SetValue(60, health, 90);
+				world.RemoveEntity(90);
+				world.SetValue(1000, isAlive, 1);
+
+				std::size_t deltaSize;
+				REQUIRE(Transmit(world, &received, &deltaSize));
+
+				THEN("Only the changes are written")
+				{
+					CHECK(received == world);
+					CHECK(deltaSize * 20 < fullSize);
+				}
+
+				AND_WHEN("Another snapshot is lost")
+				{
+					world.SetValue(3, health, 0);
+					world.SetValue(3, isAlive, 0);
+
+					Nz::ByteArray lostData;
+					Nz::ByteStream lostStream(&lostData);
+					REQUIRE(encoder.Encode(world, lostStream));
+
+					world.SetFloat(6, positionY, 12.5f);
+
+					std::size_t size;
+					REQUIRE(Transmit(world, &received, &size));
+
+					THEN("The next one is still decoded against the acknowledged baseline")
+					{
+						CHECK(received == world);
+						CHECK(received.GetValue(3, isAlive) == 0);
+						CHECK(received.GetFloat(6, positionY) == Approx(12.5f).epsilon(0.001));
+					}
+				}
+			}
+		}
+
+		WHEN("The decoder doesn't know the baseline")
+		{
+			Nz::ByteArray data;
+			Nz::ByteStream stream(&data);
+			REQUIRE(encoder.Encode(world, stream));
+			encoder.Acknowledge(1);
+
+			std::size_t size;
+			Nz::Snapshot received(schema);
+
+			THEN("Decoding fails")
+			{
+				CHECK_FALSE(Transmit(world, &received, &size));
+			}
+		}
+	}
+}
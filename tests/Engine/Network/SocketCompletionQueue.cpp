@@ -0,0 +1,141 @@
+#include <Nazara/Network/SocketCompletionQueue.hpp>
+#include <Nazara/Core/Thread.hpp>
+#include <Nazara/Network/TcpClient.hpp>
+#include <Nazara/Network/TcpServer.hpp>
+#include <Catch/catch.hpp>
+#include <array>
+#include <cstring>
+#include <random>
+
+SCENARIO("SocketCompletionQueue", "[NETWORK][SOCKETCOMPLETIONQUEUE]")
+{
+	GIVEN("A TCP server accepting a client asynchronously")
+	{
+		Nz::SocketCompletionQueue queue;
+		REQUIRE(queue.IsValid());
+
+		std::random_device rd;
+		std::uniform_int_distribution<Nz::UInt16> dis(1025, 65535);
+
+		Nz::UInt16 port = dis(rd);
+
+		Nz::TcpServer server;
+		server.EnableBlocking(false);
+
+		REQUIRE(server.Listen(Nz::NetProtocol_IPv4, port) == Nz::SocketState_Bound);
+
+		Nz::TcpClient serverToClient;
+		Nz::SocketError acceptError = Nz::SocketError_Unknown;
+		bool accepted = false;
+		REQUIRE(server.AsyncAccept(queue, &serverToClient, [&](Nz::SocketError error)
+		{
+			acceptError = error;
+			accepted = true;
+		}));
+
+		CHECK(queue.GetPendingOperationCount() == 1);
+
+		Nz::TcpClient client;
+		REQUIRE(client.Connect(Nz::IpAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), port)) == Nz::SocketState_Connecting);
+
+		for (unsigned int i = 0; i < 100 && !accepted; ++i)
+			queue.Wait(10);
+
+		REQUIRE(accepted);
+		CHECK(acceptError == Nz::SocketError_NoError);
+		CHECK(serverToClient.GetState() == Nz::SocketState_Connected);
+		CHECK(queue.GetPendingOperationCount() == 0);
+
+		REQUIRE(client.WaitForConnected(1000));
+
+		WHEN("The client sends data while the server waits for it")
+		{
+			std::array<char, 64> buffer;
+			std::size_t receivedSize = 0;
+			Nz::SocketError receiveError = Nz::SocketError_Unknown;
+			REQUIRE(serverToClient.AsyncReceive(queue, buffer.data(), buffer.size(), [&](Nz::SocketError error, std::size_t received)
+			{
+				receiveError = error;
+				receivedSize = received;
+			}));
+
+			CHECK(queue.Wait(0) == 0);
+
+			const char message[] = "Hello";
+			REQUIRE(client.Send(message, sizeof(message), nullptr));
+
+			for (unsigned int i = 0; i < 100 && receivedSize == 0; ++i)
+				queue.Wait(10);
+
+			THEN("The callback gets it")
+			{
+				CHECK(receiveError == Nz::SocketError_NoError);
+				REQUIRE(receivedSize == sizeof(message));
+				CHECK(std::memcmp(buffer.data(), message, sizeof(message)) == 0);
+			}
+		}
+
+		WHEN("The server sends data asynchronously")
+		{
+			std::vector<Nz::UInt8> data(256 * 1024);
+			for (std::size_t i = 0; i < data.size(); ++i)
+				data[i] = static_cast<Nz::UInt8>(i % 251);
+
+			bool sent = false;
+			std::size_t sentSize = 0;
+			REQUIRE(serverToClient.AsyncSend(queue, data.data(), data.size(), [&](Nz::SocketError error, std::size_t byteSent)
+			{
+				CHECK(error == Nz::SocketError_NoError);
+				sent = true;
+				sentSize = byteSent;
+			}));
+
+			THEN("The client receives all of it")
+			{
+				std::vector<Nz::UInt8> received(data.size());
+				std::size_t receivedSize = 0;
+				for (unsigned int i = 0; i < 1000 && receivedSize < received.size(); ++i)
+				{
+					queue.Wait(0);
+
+					std::size_t read;
+					if (client.Receive(&received[receivedSize], received.size() - receivedSize, &read))
+						receivedSize += read;
+				}
+
+				for (unsigned int i = 0; i < 100 && !sent; ++i)
+					queue.Wait(10);
+
+				CHECK(sent);
+				CHECK(sentSize == data.size());
+				REQUIRE(receivedSize == data.size());
+				CHECK(received == data);
+			}
+		}
+
+		WHEN("We cancel a pending receive")
+		{
+			std::array<char, 64> buffer;
+			Nz::SocketError receiveError = Nz::SocketError_Unknown;
+			bool completed = false;
+			REQUIRE(serverToClient.AsyncReceive(queue, buffer.data(), buffer.size(), [&](Nz::SocketError error, std::size_t /*received*/)
+			{
+				receiveError = error;
+				completed = true;
+			}));
+
+			queue.Wait(0);
+			queue.CancelOperations(serverToClient);
+
+			for (unsigned int i = 0; i < 100 && !completed; ++i)
+				queue.Wait(10);
+
+			THEN("Its callback reports the interruption")
+			{
+				REQUIRE(completed);
+				CHECK(receiveError == Nz::SocketError_Interrupted);
+				CHECK(queue.GetPendingOperationCount() == 0);
+			}
+		}
+	}
+}
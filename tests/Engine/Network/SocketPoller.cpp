@@ -81,4 +81,88 @@ SCENARIO("SocketPoller", "[NETWORK][SOCKETPOLLER]")
 			}
 		}
  	}
+
+	GIVEN("Two connected sockets registered with userdata")
+	{
+		std::random_device rd;
+		std::uniform_int_distribution<Nz::UInt16> dis(1025, 65535);
+
+		Nz::UInt16 port = dis(rd);
+		Nz::TcpServer server;
+		REQUIRE(server.Listen(Nz::NetProtocol_IPv4, port) == Nz::SocketState_Bound);
+
+		Nz::TcpClient clientToServer;
+		REQUIRE(clientToServer.Connect(Nz::IpAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), port)) != Nz::SocketState_NotConnected);
+
+		Nz::TcpClient serverToClient;
+		REQUIRE(server.AcceptClient(&serverToClient));
+		REQUIRE(clientToServer.WaitForConnected(1000));
+
+		int clientTag = 1;
+		int serverTag = 2;
+
+		WHEN("We register them level-triggered and send data to one of them")
+		{
+			Nz::SocketPoller poller;
+			REQUIRE(poller.RegisterSocket(clientToServer, Nz::SocketPollEvent_Read, &clientTag));
+			REQUIRE(poller.RegisterSocket(serverToClient, Nz::SocketPollEvent_Read, &serverTag));
+
+			std::array<char, 5> buffer = {"Data"};
+			REQUIRE(clientToServer.Send(buffer.data(), buffer.size(), nullptr));
+
+			REQUIRE(poller.Wait(1000));
+
+			THEN("Only this socket is reported, with its userdata")
+			{
+				const std::vector<Nz::SocketPoller::Event>& events = poller.GetReadyEvents();
+				REQUIRE(events.size() == 1);
+				CHECK(events[0].socket == &serverToClient);
+				CHECK(events[0].userdata == &serverTag);
+				CHECK(events[0].events == Nz::SocketPollEvent_Read);
+
+				CHECK(poller.IsReadyToRead(serverToClient));
+				CHECK_FALSE(poller.IsReadyToRead(clientToServer));
+			}
+
+			AND_THEN("It keeps being reported until we read its data")
+			{
+				REQUIRE(poller.Wait(0));
+				CHECK(poller.GetReadyEvents().size() == 1);
+
+				CHECK(serverToClient.Read(buffer.data(), buffer.size()) == buffer.size());
+
+				CHECK_FALSE(poller.Wait(0));
+				CHECK(poller.GetReadyEvents().empty());
+			}
+
+			AND_THEN("Unregistering it removes its event")
+			{
+				poller.UnregisterSocket(serverToClient);
+				CHECK(poller.GetReadyEvents().empty());
+			}
+		}
+
+		#ifdef NAZARA_PLATFORM_LINUX
+		WHEN("We register a socket edge-triggered and send data to it")
+		{
+			Nz::SocketPoller poller;
+			REQUIRE(poller.RegisterSocket(serverToClient, Nz::SocketPollEvent_Read, &serverTag, Nz::SocketPollMode_EdgeTriggered));
+
+			std::array<char, 5> buffer = {"Data"};
+			REQUIRE(clientToServer.Send(buffer.data(), buffer.size(), nullptr));
+
+			THEN("It is only reported once, until more data arrives")
+			{
+				REQUIRE(poller.Wait(1000));
+				REQUIRE(poller.GetReadyEvents().size() == 1);
+				CHECK(poller.GetReadyEvents()[0].userdata == &serverTag);
+
+				CHECK_FALSE(poller.Wait(0));
+
+				REQUIRE(clientToServer.Send(buffer.data(), buffer.size(), nullptr));
+				CHECK(poller.Wait(1000));
+			}
+		}
+		#endif
+	}
 }
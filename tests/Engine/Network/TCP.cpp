@@ -52,5 +52,63 @@ SCENARIO("TCP", "[NETWORK][TCP]")
 				CHECK(result == vector123);
 			}
 		}
+
+		WHEN("We send the same packet twice from client")
+		{
+			Nz::NetPacket packet(3);
+			packet << Nz::UInt32(42);
+
+			REQUIRE(client.SendPacket(packet));
+			REQUIRE(client.SendPacket(packet));
+
+			Nz::Thread::Sleep(100);
+
+			THEN("The server gets two identical packets")
+			{
+				for (unsigned int i = 0; i < 2; ++i)
+				{
+					Nz::NetPacket resultPacket;
+					REQUIRE(serverToClient.ReceivePacket(&resultPacket));
+					CHECK(resultPacket.GetNetCode() == 3);
+
+					Nz::UInt32 value;
+					resultPacket >> value;
+					CHECK(value == 42);
+				}
+			}
+		}
+
+		WHEN("We send several packets at once from client")
+		{
+			for (Nz::UInt16 i = 0; i < 10; ++i)
+			{
+				Nz::NetPacket packet(i);
+				for (Nz::UInt32 j = 0; j < i; ++j)
+					packet << j;
+
+				REQUIRE(client.SendPacket(packet));
+			}
+
+			Nz::Thread::Sleep(100);
+
+			THEN("The server gets them all, in order")
+			{
+				for (Nz::UInt16 i = 0; i < 10; ++i)
+				{
+					Nz::NetPacket resultPacket;
+					REQUIRE(serverToClient.ReceivePacket(&resultPacket));
+
+					CHECK(resultPacket.GetNetCode() == i);
+					CHECK(resultPacket.GetDataSize() == i * sizeof(Nz::UInt32));
+
+					for (Nz::UInt32 j = 0; j < i; ++j)
+					{
+						Nz::UInt32 value;
+						resultPacket >> value;
+						CHECK(value == j);
+					}
+				}
+			}
+		}
 	}
 }
@@ -1,7 +1,9 @@
 #include <Nazara/Math/Vector3.hpp>
 #include <Nazara/Network/UdpSocket.hpp>
+#include <Nazara/Network/NetDatagram.hpp>
 #include <Nazara/Network/NetPacket.hpp>
 #include <Catch/catch.hpp>
+#include <array>
 #include <random>
 
 SCENARIO("UdpSocket", "[NETWORK][UDPSOCKET]")
@@ -42,5 +44,52 @@ SCENARIO("UdpSocket", "[NETWORK][UDPSOCKET]")
 				REQUIRE(result == vector123);
 			}
 		}
+
+		WHEN("We send several datagrams at once from client")
+		{
+			std::array<Nz::UInt32, 4> values = { 1, 22, 333, 4444 };
+
+			std::array<Nz::NetBuffer, 4> buffers;
+			std::array<Nz::NetDatagram, 4> datagrams;
+			for (std::size_t i = 0; i < values.size(); ++i)
+			{
+				buffers[i].data = &values[i];
+				buffers[i].dataLength = sizeof(Nz::UInt32);
+
+				datagrams[i].address = serverIP;
+				datagrams[i].buffers = &buffers[i];
+				datagrams[i].bufferCount = 1;
+			}
+
+			std::size_t sent;
+			REQUIRE(client.SendDatagrams(datagrams.data(), datagrams.size(), &sent));
+			REQUIRE(sent == datagrams.size());
+
+			THEN("The server receives them in a single batch")
+			{
+				std::array<Nz::UInt32, 8> results;
+				std::array<Nz::NetBuffer, 8> resultBuffers;
+				std::array<Nz::NetDatagram, 8> resultDatagrams;
+				for (std::size_t i = 0; i < results.size(); ++i)
+				{
+					resultBuffers[i].data = &results[i];
+					resultBuffers[i].dataLength = sizeof(Nz::UInt32);
+
+					resultDatagrams[i].buffers = &resultBuffers[i];
+					resultDatagrams[i].bufferCount = 1;
+				}
+
+				std::size_t received;
+				REQUIRE(server.ReceiveDatagrams(resultDatagrams.data(), resultDatagrams.size(), &received));
+				REQUIRE(received == values.size());
+
+				for (std::size_t i = 0; i < values.size(); ++i)
+				{
+					CHECK(resultDatagrams[i].address.GetPort() == clientIP.GetPort());
+					CHECK(resultDatagrams[i].dataLength == sizeof(Nz::UInt32));
+					CHECK(results[i] == values[i]);
+				}
+			}
+		}
 	}
 }
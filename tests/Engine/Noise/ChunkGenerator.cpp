@@ -0,0 +1,97 @@
+#include <Nazara/Noise/ChunkGenerator.hpp>
+#include <Catch/catch.hpp>
+
+#include <Nazara/Noise/Perlin.hpp>
+#include <Nazara/Utility/StaticMesh.hpp>
+
+SCENARIO("ChunkGenerator", "[NOISE][CHUNKGENERATOR]")
+{
+	GIVEN("A generator of chunks sampling a Perlin noise")
+	{
+		Nz::Perlin perlin(7);
+		Nz::ChunkGenerator generator(perlin, 0.05f, 16, 2.f, 10.f, 3);
+
+		unsigned int evictedCount = 0;
+		unsigned int generatedCount = 0;
+
+		NazaraSlot(Nz::ChunkGenerator, OnChunkEvicted, onEvicted);
+		onEvicted.Connect(generator.OnChunkEvicted, [&] (Nz::ChunkGenerator*, const Nz::ChunkGenerator::Chunk&)
+		{
+			evictedCount++;
+		});
+
+		NazaraSlot(Nz::ChunkGenerator, OnChunkGenerated, onGenerated);
+		onGenerated.Connect(generator.OnChunkGenerated, [&] (Nz::ChunkGenerator*, const Nz::ChunkGenerator::Chunk& chunk)
+		{
+			CHECK(chunk.mesh->GetSubMeshCount() == 1);
+			generatedCount++;
+		});
+
+		WHEN("We request two neighbouring chunks")
+		{
+			generator.Request(Nz::Vector2i(0, 0));
+			generator.Request(Nz::Vector2i(1, 0));
+			generator.Request(Nz::Vector2i(1, 0));
+			CHECK(generator.GetPendingChunkCount() == 2);
+			CHECK(generator.IsPending(Nz::Vector2i(1, 0)));
+
+			generator.Wait();
+			CHECK(generator.GetChunk(Nz::Vector2i(0, 0)) == nullptr);
+
+			generator.Update();
+
+			THEN("They are handed over by the update")
+			{
+				CHECK(generatedCount == 2);
+				CHECK(generator.GetPendingChunkCount() == 0);
+				CHECK(generator.GetCachedChunkCount() == 2);
+
+				const Nz::ChunkGenerator::Chunk* first = generator.GetChunk(Nz::Vector2i(0, 0));
+				const Nz::ChunkGenerator::Chunk* second = generator.GetChunk(Nz::Vector2i(1, 0));
+				REQUIRE(first);
+				REQUIRE(second);
+
+				REQUIRE(first->heights.size() == 17 * 17);
+				CHECK(first->heights[3 * 17 + 5] == Approx(perlin.Get(5 * 2.f, 3 * 2.f, 0.05f) * 10.f).epsilon(0.0001));
+				CHECK(second->heights[3 * 17 + 5] == Approx(perlin.Get((16 + 5) * 2.f, 3 * 2.f, 0.05f) * 10.f).epsilon(0.0001));
+
+				// Chunks share their border
+				for (unsigned int y = 0; y < 17; ++y)
+					CHECK(first->heights[y * 17 + 16] == Approx(second->heights[y * 17]).epsilon(0.0001));
+
+				const Nz::StaticMesh* subMesh = static_cast<const Nz::StaticMesh*>(first->mesh->GetSubMesh(0));
+				CHECK(subMesh->GetVertexCount() == 17 * 17);
+				CHECK(subMesh->GetIndexBuffer()->GetIndexCount() == 16 * 16 * 6);
+				CHECK(subMesh->GetAABB().width == Approx(32.f));
+			}
+
+			AND_WHEN("We request more chunks than the cache can hold")
+			{
+				generator.GetChunk(Nz::Vector2i(0, 0));
+				generator.Request(Nz::Vector2i(2, 0));
+				generator.Request(Nz::Vector2i(3, 0));
+				generator.Wait();
+				generator.Update();
+
+				THEN("The least recently used one is evicted")
+				{
+					CHECK(evictedCount == 1);
+					CHECK(generator.GetCachedChunkCount() == 3);
+					CHECK(generator.IsCached(Nz::Vector2i(0, 0)));
+					CHECK(!generator.IsCached(Nz::Vector2i(1, 0)));
+				}
+
+				AND_WHEN("We clear the generator")
+				{
+					generator.Clear();
+
+					THEN("Every chunk is evicted")
+					{
+						CHECK(evictedCount == 4);
+						CHECK(generator.GetCachedChunkCount() == 0);
+					}
+				}
+			}
+		}
+	}
+}
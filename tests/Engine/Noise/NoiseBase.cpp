@@ -0,0 +1,84 @@
+#include <Nazara/Noise/NoiseBase.hpp>
+#include <Catch/catch.hpp>
+
+#include <Nazara/Noise/FBM.hpp>
+#include <Nazara/Noise/Perlin.hpp>
+#include <Nazara/Noise/Simplex.hpp>
+#include <Nazara/Noise/Worley.hpp>
+#include <vector>
+
+namespace
+{
+	// Width not being a multiple of four checks the samples computed one by one
+	constexpr unsigned int s_width = 37;
+	constexpr unsigned int s_height = 5;
+	constexpr unsigned int s_depth = 3;
+
+	const Nz::Vector3f s_origin(-13.7f, -4.2f, 3.1f);
+	const Nz::Vector3f s_step(0.61f, 1.3f, 0.9f);
+
+	template<typename T>
+	void CheckFill2D(const T& noise, float scale)
+	{
+		std::vector<float> values(s_width * s_height);
+		noise.Fill(values.data(), s_width, s_height, Nz::Vector2f(s_origin), Nz::Vector2f(s_step), scale);
+
+		for (unsigned int y = 0; y < s_height; ++y)
+		{
+			for (unsigned int x = 0; x < s_width; ++x)
+				CHECK(values[y * s_width + x] == Approx(noise.Get(s_origin.x + x * s_step.x, s_origin.y + y * s_step.y, scale)).epsilon(0.0001));
+		}
+	}
+
+	template<typename T>
+	void CheckFill3D(const T& noise, float scale)
+	{
+		std::vector<float> values(s_width * s_height * s_depth);
+		noise.Fill(values.data(), s_width, s_height, s_depth, s_origin, s_step, scale);
+
+		for (unsigned int z = 0; z < s_depth; ++z)
+		{
+			for (unsigned int y = 0; y < s_height; ++y)
+			{
+				for (unsigned int x = 0; x < s_width; ++x)
+					CHECK(values[(z * s_height + y) * s_width + x] == Approx(noise.Get(s_origin.x + x * s_step.x, s_origin.y + y * s_step.y, s_origin.z + z * s_step.z, scale)).epsilon(0.0001));
+			}
+		}
+	}
+}
+
+SCENARIO("NoiseBase", "[NOISE][NOISEBASE]")
+{
+	GIVEN("Noises with a seed")
+	{
+		Nz::Perlin perlin(42);
+		Nz::Simplex simplex(42);
+		Nz::Worley worley(42);
+
+		WHEN("We fill grids of samples")
+		{
+			THEN("They match the samples computed one by one")
+			{
+				CheckFill2D(perlin, 0.37f);
+				CheckFill3D(perlin, 0.37f);
+
+				CheckFill2D(simplex, 0.37f);
+				CheckFill3D(simplex, 0.37f);
+
+				CheckFill2D(worley, 0.37f);
+			}
+		}
+
+		WHEN("We fill grids of fractal noise")
+		{
+			Nz::FBM fbm(perlin);
+			fbm.SetParameters(0.9f, 2.f, 4.f);
+
+			THEN("They match the samples computed one by one")
+			{
+				CheckFill2D(fbm, 0.11f);
+				CheckFill3D(fbm, 0.11f);
+			}
+		}
+	}
+}
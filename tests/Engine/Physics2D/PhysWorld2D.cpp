@@ -1,5 +1,9 @@
 #include <Nazara/Physics2D/PhysWorld2D.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/ErrorFlags.hpp>
 #include <Catch/catch.hpp>
+#include <algorithm>
+#include <array>
 
 Nz::RigidBody2D CreateBody(Nz::PhysWorld2D& world, const Nz::Vector2f& position, bool isMoving = true, const Nz::Vector2f& lengths = Nz::Vector2f::Unit());
 
@@ -98,6 +102,44 @@ SCENARIO("PhysWorld2D", "[PHYSICS2D][PHYSWORLD2D]")
 				CHECK(results[0] == &bodies[0]);
 			}
 		}
+
+		WHEN("We ask for the first collision of several rays at once")
+		{
+			std::array<Nz::PhysWorld2D::Raycast, 3> raycasts;
+			raycasts[0] = { Nz::Vector2f(0.f, -2.f), Nz::Vector2f(0.f, 40.f), 1.f };
+			raycasts[1] = { Nz::Vector2f(10.f, -2.f), Nz::Vector2f(10.f, 40.f), 1.f };
+			raycasts[2] = { Nz::Vector2f(-20.f, -2.f), Nz::Vector2f(-20.f, 40.f), 1.f };
+
+			std::array<Nz::PhysWorld2D::RaycastHit, 3> results;
+			REQUIRE(world.RaycastQueryFirst(raycasts.data(), raycasts.size(), collisionGroup, categoryMask, collisionMask, results.data()) == 2);
+
+			THEN("Each ray should report its own body")
+			{
+				CHECK(results[0].nearestBody == &bodies[0]);
+				CHECK(results[0].fraction == Approx(1.f / 42.f));
+				CHECK(results[1].nearestBody == &bodies[numberOfBodiesPerLign]);
+				CHECK(results[1].hitPos == Nz::Vector2f(10.f, 0.f));
+				CHECK(results[2].nearestBody == nullptr);
+			}
+		}
+
+		WHEN("We ask for several regions at once")
+		{
+			std::array<Nz::Rectf, 2> regions = { Nz::Rectf(-5.f, -5.f, 5.f, 5.f), Nz::Rectf(5.f, -5.f, 10.f, 20.f) };
+			std::array<Nz::RigidBody2D*, 2 * 4> results;
+			std::array<std::size_t, 2> resultCounts;
+			world.RegionQuery(regions.data(), regions.size(), collisionGroup, categoryMask, collisionMask, results.data(), 4, resultCounts.data());
+
+			THEN("Each region should report the bodies it overlaps")
+			{
+				REQUIRE(resultCounts[0] == 1);
+				CHECK(results[0] == &bodies[0]);
+
+				REQUIRE(resultCounts[1] == 2);
+				CHECK(std::find(results.begin() + 4, results.begin() + 6, &bodies[numberOfBodiesPerLign]) != results.begin() + 6);
+				CHECK(std::find(results.begin() + 4, results.begin() + 6, &bodies[numberOfBodiesPerLign + 1]) != results.begin() + 6);
+			}
+		}
 	}
 
 	GIVEN("Three entities, a character, a wall and a trigger zone")
@@ -187,6 +229,143 @@ SCENARIO("PhysWorld2D", "[PHYSICS2D][PHYSWORLD2D]")
 			}
 		}
 	}
+
+	GIVEN("A ball falling on the ground and contact events")
+	{
+		unsigned int BALL_COLLISION_ID = 1;
+		unsigned int GROUND_COLLISION_ID = 2;
+
+		Nz::PhysWorld2D world;
+		world.SetGravity(Nz::Vector2f(0.f, -9.81f));
+		world.SetContactEventCapacity(1);
+		world.RegisterContactEvents(BALL_COLLISION_ID, GROUND_COLLISION_ID);
+
+		Nz::Collider2DRef groundBox = Nz::BoxCollider2D::New(Nz::Rectf(-10.f, -1.f, 20.f, 1.f));
+		groundBox->SetCollisionId(GROUND_COLLISION_ID);
+		Nz::RigidBody2D ground(&world, 0.f, groundBox);
+
+		Nz::Collider2DRef ballCircle = Nz::CircleCollider2D::New(0.5f);
+		ballCircle->SetCollisionId(BALL_COLLISION_ID);
+		Nz::RigidBody2D ball(&world, 1.f, ballCircle);
+		ball.SetPosition(Nz::Vector2f(0.f, 1.f));
+
+		WHEN("The ball hits the ground")
+		{
+			for (int i = 0; i != 1000 && world.GetContactEvents().empty(); ++i)
+				world.Step(world.GetStepSize());
+
+			THEN("A start event should have been appended")
+			{
+				REQUIRE(world.GetContactEvents().size() == 1);
+
+				const Nz::PhysWorld2D::ContactEvent& contactEvent = world.GetContactEvents().front();
+				CHECK(contactEvent.type == Nz::ContactEventType2D_Start);
+				CHECK(((contactEvent.firstBody == &ball && contactEvent.secondBody == &ground) || (contactEvent.firstBody == &ground && contactEvent.secondBody == &ball)));
+				CHECK(contactEvent.contactPoint.y == Approx(0.f).margin(0.1f));
+			}
+
+			AND_THEN("Events past the capacity should be dropped until the buffer is cleared")
+			{
+				ball.SetPosition(Nz::Vector2f(0.f, 2.f));
+				world.Step(world.GetStepSize());
+
+				CHECK(world.GetContactEvents().size() == 1);
+				CHECK(world.GetContactEventCapacity() == 1);
+				CHECK(world.GetDroppedContactEventCount() == 1);
+
+				world.ClearContactEvents();
+				CHECK(world.GetContactEvents().empty());
+				CHECK(world.GetDroppedContactEventCount() == 0);
+
+				for (int i = 0; i != 1000 && world.GetContactEvents().empty(); ++i)
+					world.Step(world.GetStepSize());
+
+				REQUIRE(world.GetContactEvents().size() == 1);
+				CHECK(world.GetContactEvents().front().type == Nz::ContactEventType2D_Start);
+			}
+		}
+	}
+
+	GIVEN("A pile of boxes falling on the ground")
+	{
+		Nz::PhysWorld2D world;
+		world.SetGravity(Nz::Vector2f(0.f, -9.81f));
+
+		Nz::RigidBody2D ground = CreateBody(world, Nz::Vector2f(-50.f, -1.f), false, Nz::Vector2f(100.f, 1.f));
+
+		std::vector<Nz::RigidBody2D> boxes;
+		boxes.reserve(10);
+		for (int i = 0; i != 10; ++i)
+			boxes.push_back(CreateBody(world, Nz::Vector2f(0.1f * i, 1.5f * i)));
+
+		world.Simulate(100);
+
+		WHEN("We save the state of the world and simulate it further")
+		{
+			Nz::ByteArray state;
+			world.SaveState(&state);
+
+			world.Simulate(8);
+
+			std::vector<Nz::Vector2f> positions;
+			std::vector<float> rotations;
+			for (const Nz::RigidBody2D& box : boxes)
+			{
+				positions.push_back(box.GetPosition());
+				rotations.push_back(box.GetRotation());
+			}
+
+			THEN("Restoring the state and resimulating should give the same result")
+			{
+				REQUIRE(world.RestoreState(state));
+				CHECK(boxes[9].GetPosition() != positions[9]);
+
+				world.Simulate(8);
+
+				for (std::size_t i = 0; i < boxes.size(); ++i)
+				{
+					CHECK(boxes[i].GetPosition() == positions[i]);
+					CHECK(boxes[i].GetRotation() == rotations[i]);
+				}
+			}
+
+			AND_THEN("An invalid state should be refused")
+			{
+				Nz::ErrorFlags errFlags(Nz::ErrorFlag_Silent);
+
+				state.Resize(state.GetSize() - 1);
+				CHECK_FALSE(world.RestoreState(state));
+			}
+		}
+	}
+
+	GIVEN("A world using the parallel solver and a box falling on the ground")
+	{
+		Nz::PhysWorld2D::CreationParams params;
+		params.parallelSolver = true;
+		params.threadCount = 2;
+
+		Nz::PhysWorld2D world(params);
+		world.SetGravity(Nz::Vector2f(0.f, -9.81f));
+		world.SetCollisionSlop(0.05f);
+		world.SetIterationCount(5);
+
+		Nz::RigidBody2D ground = CreateBody(world, Nz::Vector2f(-50.f, -1.f), false, Nz::Vector2f(100.f, 1.f));
+		Nz::RigidBody2D box = CreateBody(world, Nz::Vector2f(0.f, 5.f));
+
+		WHEN("We simulate it for a few seconds")
+		{
+			world.Simulate(1000);
+
+			THEN("The box rests on the ground, within the collision slop")
+			{
+				CHECK(world.IsUsingParallelSolver());
+				CHECK(world.GetThreadCount() == 2);
+				CHECK(world.GetCollisionSlop() == Approx(0.05f));
+				CHECK(box.GetPosition().y == Approx(0.f).margin(0.1f));
+			}
+		}
+	}
 }
 
 Nz::RigidBody2D CreateBody(Nz::PhysWorld2D& world, const Nz::Vector2f& position, bool isMoving, const Nz::Vector2f& lengths)
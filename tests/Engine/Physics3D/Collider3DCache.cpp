@@ -0,0 +1,74 @@
+#include <Nazara/Physics3D/Collider3DCache.hpp>
+#include <Nazara/Physics3D/PhysWorld3D.hpp>
+#include <Catch/catch.hpp>
+#include <array>
+
+SCENARIO("Collider3DCache", "[PHYSICS3D][COLLIDER3DCACHE]")
+{
+	GIVEN("A collider cache")
+	{
+		Nz::Collider3DCache cache;
+
+		WHEN("We ask twice for the same box")
+		{
+			Nz::BoxCollider3DRef first = cache.GetBox(Nz::Vector3f(1.f, 2.f, 3.f));
+			Nz::BoxCollider3DRef second = cache.GetBox(Nz::Vector3f(1.f, 2.f, 3.f));
+
+			THEN("The collider is shared")
+			{
+				CHECK(first == second);
+				CHECK(cache.GetColliderCount() == 1);
+			}
+
+			AND_THEN("Different parameters give another collider")
+			{
+				CHECK(cache.GetBox(Nz::Vector3f(1.f, 2.f, 4.f)) != first);
+				CHECK(cache.GetBox(Nz::Vector3f(1.f, 2.f, 3.f), Nz::Matrix4f::Translate(Nz::Vector3f::UnitX())) != first);
+				CHECK(cache.GetSphere(1.f) != cache.GetSphere(2.f));
+				CHECK(cache.GetColliderCount() == 5);
+			}
+
+			AND_THEN("Purging only releases the colliders referenced by the cache alone")
+			{
+				cache.GetSphere(1.f);
+				CHECK(cache.Purge() == 1);
+				CHECK(cache.GetColliderCount() == 1);
+			}
+		}
+
+		WHEN("We ask for convex hulls")
+		{
+			std::array<Nz::Vector3f, 5> vertices = {
+				Nz::Vector3f(0.f, 0.f, 0.f),
+				Nz::Vector3f(1.f, 0.f, 0.f),
+				Nz::Vector3f(0.f, 1.f, 0.f),
+				Nz::Vector3f(0.f, 0.f, 1.f),
+				Nz::Vector3f(0.1f, 0.1f, 0.1f)
+			};
+
+			Nz::ConvexCollider3DRef first = cache.GetConvexHull(vertices.data(), static_cast<unsigned int>(vertices.size()));
+			Nz::ConvexCollider3DRef second = cache.GetConvexHull(vertices.data(), static_cast<unsigned int>(vertices.size()));
+
+			vertices[1].x = 2.f;
+			Nz::ConvexCollider3DRef third = cache.GetConvexHull(vertices.data(), static_cast<unsigned int>(vertices.size()));
+
+			THEN("Hulls are identified by their vertices")
+			{
+				CHECK(first == second);
+				CHECK(first != third);
+			}
+
+			AND_THEN("A cooked hull gives the same collision")
+			{
+				Nz::ByteArray cookedHull = first->Cook();
+				REQUIRE_FALSE(cookedHull.IsEmpty());
+
+				Nz::ConvexCollider3DRef cooked = Nz::ConvexCollider3D::New(cookedHull);
+				CHECK(cooked->IsCooked());
+				CHECK_FALSE(first->IsCooked());
+
+				CHECK(cooked->ComputeVolume() == Approx(first->ComputeVolume()));
+			}
+		}
+	}
+}
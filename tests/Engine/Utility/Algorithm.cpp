@@ -0,0 +1,479 @@
+#include <Nazara/Utility/Algorithm.hpp>
+#include <Nazara/Core/Primitive.hpp>
+#include <Nazara/Utility/IndexBuffer.hpp>
+#include <Nazara/Utility/IndexMapper.hpp>
+#include <Nazara/Utility/Joint.hpp>
+#include <Nazara/Utility/Mesh.hpp>
+#include <Nazara/Utility/Skeleton.hpp>
+#include <Nazara/Utility/StaticMesh.hpp>
+#include <Nazara/Utility/VertexBuffer.hpp>
+#include <Nazara/Utility/VertexDeclaration.hpp>
+#include <Nazara/Utility/VertexMapper.hpp>
+#include <Catch/catch.hpp>
+#include <algorithm>
+#include <array>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+	using Triangle = std::array<Nz::Vector3f, 3>;
+
+	// Vector3::operator< uses an epsilon, which isn't a strict weak ordering
+	bool ComparePositions(const Nz::Vector3f& lhs, const Nz::Vector3f& rhs)
+	{
+		return std::tie(lhs.x, lhs.y, lhs.z) < std::tie(rhs.x, rhs.y, rhs.z);
+	}
+
+	bool IsNear(const Nz::Vector3f& lhs, const Nz::Vector3f& rhs)
+	{
+		return lhs.SquaredDistance(rhs) < 0.0001f;
+	}
+
+	std::vector<Triangle> GetTriangles(const Nz::StaticMesh* subMesh)
+	{
+		Nz::IndexMapper indexMapper(subMesh);
+		Nz::VertexMapper vertexMapper(subMesh, Nz::BufferAccess_ReadOnly);
+		Nz::SparsePtr<const Nz::Vector3f> positionPtr = vertexMapper.GetComponentPtr<const Nz::Vector3f>(Nz::VertexComponent_Position);
+
+		std::vector<Triangle> triangles(indexMapper.GetIndexCount() / 3);
+		for (std::size_t i = 0; i < triangles.size(); ++i)
+		{
+			for (std::size_t j = 0; j < 3; ++j)
+			{
+				Nz::UInt32 index = indexMapper.Get(i * 3 + j);
+				REQUIRE(index < subMesh->GetVertexCount());
+
+				triangles[i][j] = positionPtr[index];
+			}
+
+			// Optimizations may rotate the vertices of a triangle, but never change its winding
+			std::rotate(triangles[i].begin(), std::min_element(triangles[i].begin(), triangles[i].end(), ComparePositions), triangles[i].end());
+		}
+
+		std::sort(triangles.begin(), triangles.end(), [] (const Triangle& lhs, const Triangle& rhs)
+		{
+			return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), ComparePositions);
+		});
+
+		return triangles;
+	}
+}
+
+SCENARIO("Mesh optimization", "[UTILITY][ALGORITHM]")
+{
+	GIVEN("Two quads sharing an edge, with duplicated and unused vertices")
+	{
+		std::vector<Nz::Vector3f> vertices = {
+			{9.f, 9.f, 9.f}, // Unused
+			{0.f, 0.f, 0.f},
+			{1.f, 0.f, 0.f},
+			{1.f, 1.f, 0.f},
+			{0.f, 1.f, 0.f},
+			{1.f, 0.f, 0.f}, // Duplicate of 2
+			{2.f, 0.f, 0.f},
+			{2.f, 1.f, 0.f},
+			{1.f, 1.f, 0.f}  // Duplicate of 3
+		};
+
+		const Nz::UInt32 triangles[] = {1, 2, 3, 1, 3, 4, 5, 6, 7, 5, 7, 8};
+
+		Nz::IndexBufferRef indexBuffer = Nz::IndexBuffer::New(false, 12, Nz::DataStorage_Software, 0);
+		Nz::IndexMapper indexMapper(indexBuffer);
+		for (std::size_t i = 0; i < 12; ++i)
+			indexMapper.Set(i, triangles[i]);
+
+		WHEN("We weld the vertices")
+		{
+			unsigned int vertexCount = Nz::WeldVertices(vertices.data(), sizeof(Nz::Vector3f), Nz::UInt32(vertices.size()), indexMapper.begin(), 12);
+
+			THEN("Duplicates are merged and the indices are remapped")
+			{
+				REQUIRE(vertexCount == 7);
+				for (std::size_t i = 0; i < 12; ++i)
+				{
+					Nz::UInt32 index = indexMapper.Get(i);
+					REQUIRE(index < vertexCount);
+				}
+
+				CHECK(indexMapper.Get(6) == indexMapper.Get(1));
+				CHECK(indexMapper.Get(11) == indexMapper.Get(2));
+				CHECK(vertices[indexMapper.Get(8)] == Nz::Vector3f(2.f, 1.f, 0.f));
+			}
+
+			AND_WHEN("We reorder them for the vertex fetch")
+			{
+				vertexCount = Nz::OptimizeVertexFetch(vertices.data(), sizeof(Nz::Vector3f), vertexCount, indexMapper.begin(), 12);
+
+				THEN("Vertices are sorted by first use and the unused one is removed")
+				{
+					REQUIRE(vertexCount == 6);
+					CHECK(indexMapper.Get(0) == 0);
+					CHECK(indexMapper.Get(1) == 1);
+					CHECK(indexMapper.Get(2) == 2);
+					CHECK(vertices[0] == Nz::Vector3f(0.f, 0.f, 0.f));
+					CHECK(vertices[indexMapper.Get(7)] == Nz::Vector3f(2.f, 0.f, 0.f));
+				}
+			}
+		}
+	}
+
+	GIVEN("A sphere built with every optimization")
+	{
+		Nz::MeshParams params;
+		params.optimizeIndexBuffers = false;
+		params.storage = Nz::DataStorage_Software;
+
+		Nz::MeshRef reference = Nz::Mesh::New();
+		REQUIRE(reference->CreateStatic());
+		reference->BuildSubMesh(Nz::Primitive::UVSphere(1.f, 16, 16), params);
+
+		params.optimizeIndexBuffers = true;
+		params.optimizeOverdraw = true;
+		params.optimizeVertexFetch = true;
+		params.weldVertices = true;
+
+		Nz::MeshRef optimized = Nz::Mesh::New();
+		REQUIRE(optimized->CreateStatic());
+		optimized->BuildSubMesh(Nz::Primitive::UVSphere(1.f, 16, 16), params);
+
+		const Nz::StaticMesh* referenceSubMesh = static_cast<const Nz::StaticMesh*>(reference->GetSubMesh(0));
+		const Nz::StaticMesh* optimizedSubMesh = static_cast<const Nz::StaticMesh*>(optimized->GetSubMesh(0));
+
+		THEN("It holds the same triangles, with its vertices sorted by first use")
+		{
+			CHECK(optimizedSubMesh->GetVertexCount() <= referenceSubMesh->GetVertexCount());
+			CHECK(optimizedSubMesh->GetVertexBuffer()->GetVertexCount() == optimizedSubMesh->GetVertexCount());
+			REQUIRE(optimizedSubMesh->GetTriangleCount() == referenceSubMesh->GetTriangleCount());
+			CHECK(GetTriangles(optimizedSubMesh) == GetTriangles(referenceSubMesh));
+
+			Nz::IndexMapper indexMapper(optimizedSubMesh);
+
+			Nz::UInt32 nextVertex = 0;
+			for (std::size_t i = 0; i < indexMapper.GetIndexCount(); ++i)
+			{
+				Nz::UInt32 index = indexMapper.Get(i);
+				REQUIRE(index <= nextVertex);
+
+				if (index == nextVertex)
+					nextVertex++;
+			}
+
+			CHECK(nextVertex == optimizedSubMesh->GetVertexCount());
+		}
+	}
+}
+
+SCENARIO("Skinning", "[UTILITY][ALGORITHM]")
+{
+	GIVEN("A skeleton with two rigidly transformed joints")
+	{
+		Nz::Skeleton skeleton;
+		REQUIRE(skeleton.Create(2));
+
+		skeleton.GetJoint(0)->SetInverseBindMatrix(Nz::Matrix4f::Identity());
+		skeleton.GetJoint(1)->SetInverseBindMatrix(Nz::Matrix4f::Translate(Nz::Vector3f(0.f, -1.f, 0.f)));
+
+		skeleton.GetJoint(0)->SetPosition(Nz::Vector3f(1.f, 2.f, 3.f));
+		skeleton.GetJoint(0)->SetRotation(Nz::EulerAnglesf(30.f, 45.f, 10.f));
+		skeleton.GetJoint(1)->SetPosition(Nz::Vector3f(-2.f, 0.f, 1.f));
+		skeleton.GetJoint(1)->SetRotation(Nz::EulerAnglesf(0.f, 90.f, 0.f));
+
+		Nz::SkeletalMeshVertex inputVertices[3];
+		for (Nz::SkeletalMeshVertex& vertex : inputVertices)
+		{
+			vertex.position.Set(0.5f, 1.f, -2.f);
+			vertex.normal = Nz::Vector3f::Up();
+			vertex.tangent = Nz::Vector3f::Right();
+			vertex.uv.Set(0.25f, 0.75f);
+			vertex.weights.Set(1.f, 0.f, 0.f, 0.f);
+			vertex.jointIndexes.Set(0, 0, 0, 0);
+			vertex.weightCount = 1;
+		}
+
+		inputVertices[1].jointIndexes.x = 1;
+
+		inputVertices[2].weights.Set(0.25f, 0.75f, 0.f, 0.f);
+		inputVertices[2].jointIndexes.Set(0, 1, 0, 0);
+		inputVertices[2].weightCount = 2;
+
+		Nz::MeshVertex outputVertices[3];
+
+		Nz::SkinningData skinningData;
+		skinningData.inputVertex = inputVertices;
+		skinningData.outputVertex = outputVertices;
+		skinningData.joints = skeleton.GetJoints();
+
+		WHEN("We skin the vertices with the joint matrices")
+		{
+			Nz::SkinPositionNormalTangent(skinningData, 0, 3);
+
+			THEN("They are transformed by the weighted sum of the matrices")
+			{
+				for (unsigned int i = 0; i < 3; ++i)
+				{
+					const Nz::SkeletalMeshVertex& input = inputVertices[i];
+
+					Nz::Vector3f position = Nz::Vector3f::Zero();
+					Nz::Vector3f normal = Nz::Vector3f::Zero();
+					for (int j = 0; j < input.weightCount; ++j)
+					{
+						const Nz::Matrix4f& matrix = skeleton.GetJoint(input.jointIndexes[j])->GetSkinningMatrix();
+						position += matrix.Transform(input.position) * input.weights[j];
+						normal += matrix.Transform(input.normal, 0.f) * input.weights[j];
+					}
+
+					CHECK(IsNear(outputVertices[i].position, position));
+					CHECK(IsNear(outputVertices[i].normal, Nz::Vector3f::Normalize(normal)));
+					CHECK(outputVertices[i].uv == input.uv);
+				}
+			}
+		}
+
+		WHEN("We skin the vertices with dual quaternions")
+		{
+			std::vector<Nz::SkinningDualQuaternion> dualQuaternions(skeleton.GetJointCount());
+			Nz::ComputeSkinningDualQuaternions(skeleton.GetJoints(), skeleton.GetJointCount(), dualQuaternions.data());
+			skinningData.dualQuaternions = dualQuaternions.data();
+
+			Nz::SkinDualQuaternionPositionNormalTangent(skinningData, 0, 3);
+
+			THEN("Vertices influenced by a single joint match the matrix skinning")
+			{
+				for (unsigned int i = 0; i < 2; ++i)
+				{
+					const Nz::SkeletalMeshVertex& input = inputVertices[i];
+					const Nz::Matrix4f& matrix = skeleton.GetJoint(input.jointIndexes[0])->GetSkinningMatrix();
+
+					CHECK(IsNear(outputVertices[i].position, matrix.Transform(input.position)));
+					CHECK(IsNear(outputVertices[i].normal, matrix.Transform(input.normal, 0.f)));
+					CHECK(IsNear(outputVertices[i].tangent, matrix.Transform(input.tangent, 0.f)));
+				}
+			}
+
+			THEN("Blended vertices keep their distance to the joints")
+			{
+				// Dual quaternions blend rigid transformations into a rigid transformation, preserving lengths
+				CHECK(Nz::NumberEquals(outputVertices[2].normal.GetLength(), 1.f, 0.0001f));
+				CHECK(Nz::NumberEquals(outputVertices[2].tangent.GetLength(), 1.f, 0.0001f));
+				CHECK(outputVertices[2].uv == inputVertices[2].uv);
+			}
+		}
+	}
+}
+
+SCENARIO("Compact vertex formats", "[UTILITY][ALGORITHM]")
+{
+	GIVEN("Some floats")
+	{
+		WHEN("We pack them to halves")
+		{
+			THEN("Exactly representable values are kept and the others are rounded")
+			{
+				for (float value : {0.f, -0.f, 1.f, -2.f, 0.5f, 65504.f, 6.103515625e-05f, 5.9604644775390625e-08f})
+					CHECK(Nz::UnpackHalf(Nz::PackHalf(value)) == value);
+
+				CHECK(Nz::PackHalf(1.f) == 0x3C00);
+				CHECK(Nz::PackHalf(-2.f) == 0xC000);
+				CHECK(Nz::PackHalf(1e6f) == 0x7C00);
+				CHECK(Nz::NumberEquals(Nz::UnpackHalf(Nz::PackHalf(3.14159f)), 3.14159f, 0.002f));
+			}
+		}
+
+		WHEN("We pack a normal and a tangent")
+		{
+			Nz::Vector4f normal(Nz::Vector3f::Normalize(Nz::Vector3f(1.f, -2.f, 3.f)), 0.f);
+			Nz::Vector4f tangent(Nz::Vector3f::Left(), -1.f);
+
+			THEN("They are unpacked with a 10 bits precision")
+			{
+				Nz::Vector4f unpackedNormal = Nz::UnpackNormal(Nz::PackNormal(normal));
+				Nz::Vector4f unpackedTangent = Nz::UnpackNormal(Nz::PackNormal(tangent));
+
+				for (unsigned int i = 0; i < 4; ++i)
+				{
+					CHECK(Nz::NumberEquals(unpackedNormal[i], normal[i], 0.002f));
+					CHECK(unpackedTangent[i] == tangent[i]);
+				}
+			}
+		}
+	}
+
+	GIVEN("A plane built with the packed layout")
+	{
+		Nz::MeshParams params;
+		params.storage = Nz::DataStorage_Software;
+
+		Nz::MeshRef reference = Nz::Mesh::New();
+		REQUIRE(reference->CreateStatic());
+		reference->BuildSubMesh(Nz::Primitive::Plane(Nz::Vector2f(2.f, 2.f), Nz::Vector2ui(2)), params);
+
+		params.compressedVertexDeclaration = Nz::VertexDeclaration::Get(Nz::VertexLayout_XYZ_Normal_UV_Tangent_Packed);
+
+		Nz::MeshRef mesh = Nz::Mesh::New();
+		REQUIRE(mesh->CreateStatic());
+		mesh->BuildSubMesh(Nz::Primitive::Plane(Nz::Vector2f(2.f, 2.f), Nz::Vector2ui(2)), params);
+
+		const Nz::StaticMesh* referenceSubMesh = static_cast<const Nz::StaticMesh*>(reference->GetSubMesh(0));
+		const Nz::StaticMesh* subMesh = static_cast<const Nz::StaticMesh*>(mesh->GetSubMesh(0));
+		REQUIRE(subMesh->GetVertexCount() == referenceSubMesh->GetVertexCount());
+
+		Nz::VertexMapper referenceMapper(referenceSubMesh, Nz::BufferAccess_ReadOnly);
+		Nz::SparsePtr<const Nz::Vector3f> referenceNormalPtr = referenceMapper.GetComponentPtr<const Nz::Vector3f>(Nz::VertexComponent_Normal);
+		Nz::SparsePtr<const Nz::Vector2f> referenceUvPtr = referenceMapper.GetComponentPtr<const Nz::Vector2f>(Nz::VertexComponent_TexCoord);
+
+		THEN("Its vertices are smaller and decoded transparently")
+		{
+			CHECK(subMesh->GetVertexBuffer()->GetStride() == sizeof(Nz::VertexStruct_XYZ_Normal_UV_Tangent_Packed));
+			CHECK(sizeof(Nz::VertexStruct_XYZ_Normal_UV_Tangent_Packed) < sizeof(Nz::MeshVertex));
+
+			Nz::VertexMapper vertexMapper(subMesh, Nz::BufferAccess_ReadOnly);
+			CHECK(!vertexMapper.GetComponentPtr<const Nz::Vector3f>(Nz::VertexComponent_Normal));
+
+			Nz::ComponentAccessor<Nz::Vector3f> normalAccessor = vertexMapper.GetComponentAccessor<Nz::Vector3f>(Nz::VertexComponent_Normal);
+			Nz::ComponentAccessor<Nz::Vector2f> uvAccessor = vertexMapper.GetComponentAccessor<Nz::Vector2f>(Nz::VertexComponent_TexCoord);
+			REQUIRE(normalAccessor);
+			REQUIRE(uvAccessor);
+
+			for (unsigned int i = 0; i < vertexMapper.GetVertexCount(); ++i)
+			{
+				CHECK(IsNear(normalAccessor[i], referenceNormalPtr[i]));
+
+				Nz::Vector2f uv = uvAccessor.Get(i);
+				CHECK(Nz::NumberEquals(uv.x, referenceUvPtr[i].x, 0.001f));
+				CHECK(Nz::NumberEquals(uv.y, referenceUvPtr[i].y, 0.001f));
+			}
+		}
+
+		WHEN("We convert it back to floats")
+		{
+			Nz::VertexBuffer* vertexBuffer = const_cast<Nz::VertexBuffer*>(subMesh->GetVertexBuffer());
+			Nz::ConvertVertices(vertexBuffer, Nz::VertexDeclaration::Get(Nz::VertexLayout_XYZ_Normal_UV_Tangent));
+
+			THEN("The SparsePtr access paths work again")
+			{
+				Nz::VertexMapper vertexMapper(subMesh, Nz::BufferAccess_ReadOnly);
+				Nz::SparsePtr<const Nz::Vector3f> normalPtr = vertexMapper.GetComponentPtr<const Nz::Vector3f>(Nz::VertexComponent_Normal);
+				REQUIRE(normalPtr);
+
+				for (unsigned int i = 0; i < vertexMapper.GetVertexCount(); ++i)
+					CHECK(IsNear(normalPtr[i], referenceNormalPtr[i]));
+			}
+		}
+	}
+}
+
+SCENARIO("Meshlets", "[UTILITY][ALGORITHM]")
+{
+	GIVEN("An optimized sphere split in meshlets")
+	{
+		Nz::MeshParams params;
+		params.optimizeOverdraw = true;
+		params.storage = Nz::DataStorage_Software;
+
+		Nz::MeshRef mesh = Nz::Mesh::New();
+		REQUIRE(mesh->CreateStatic());
+		mesh->BuildSubMesh(Nz::Primitive::IcoSphere(1.f, 3), params);
+
+		Nz::StaticMesh* subMesh = static_cast<Nz::StaticMesh*>(mesh->GetSubMesh(0));
+		REQUIRE(subMesh->GenerateMeshlets(64, 64));
+
+		const std::vector<Nz::Meshlet>& meshlets = subMesh->GetMeshlets();
+		REQUIRE(meshlets.size() > 1);
+
+		THEN("They cover the index buffer and bound their triangles")
+		{
+			Nz::IndexMapper indexMapper(subMesh);
+			Nz::VertexMapper vertexMapper(subMesh, Nz::BufferAccess_ReadOnly);
+			Nz::SparsePtr<Nz::Vector3f> positionPtr = vertexMapper.GetComponentPtr<Nz::Vector3f>(Nz::VertexComponent_Position);
+
+			Nz::UInt32 nextIndex = 0;
+			for (const Nz::Meshlet& meshlet : meshlets)
+			{
+				REQUIRE(meshlet.firstIndex == nextIndex);
+				CHECK(meshlet.indexCount % 3 == 0);
+				CHECK(meshlet.indexCount <= 64 * 3);
+				CHECK(meshlet.coneCutoff >= 0.f);
+				CHECK(meshlet.coneCutoff <= 1.f);
+
+				for (Nz::UInt32 i = meshlet.firstIndex; i < meshlet.firstIndex + meshlet.indexCount; ++i)
+					CHECK(meshlet.boundingSphere.GetPosition().Distance(positionPtr[indexMapper.Get(i)]) <= meshlet.boundingSphere.radius + 0.0001f);
+
+				nextIndex += meshlet.indexCount;
+			}
+
+			CHECK(nextIndex == indexMapper.GetIndexCount());
+		}
+
+		WHEN("We cull them from a viewpoint facing the sphere")
+		{
+			Nz::Vector3f eyePosition(0.f, 0.f, 5.f);
+
+			Nz::Frustumf frustum;
+			frustum.Build(90.f, 1.f, 0.1f, 100.f, eyePosition, Nz::Vector3f::Zero());
+
+			std::vector<Nz::UInt32> visibleMeshlets(meshlets.size());
+
+			THEN("Only the meshlets possibly facing the eye are kept")
+			{
+				std::size_t visibleCount = Nz::CullMeshlets(meshlets.data(), meshlets.size(), Nz::Matrix4f::Identity(), frustum, eyePosition, true, visibleMeshlets.data());
+				CHECK(visibleCount > 0);
+				CHECK(visibleCount < meshlets.size());
+
+				// Culling must be conservative: every triangle of a rejected meshlet faces away from the eye
+				Nz::IndexMapper indexMapper(subMesh);
+				Nz::VertexMapper vertexMapper(subMesh, Nz::BufferAccess_ReadOnly);
+				Nz::SparsePtr<Nz::Vector3f> positionPtr = vertexMapper.GetComponentPtr<Nz::Vector3f>(Nz::VertexComponent_Position);
+
+				for (std::size_t i = 0; i < meshlets.size(); ++i)
+				{
+					if (std::find(visibleMeshlets.begin(), visibleMeshlets.begin() + visibleCount, i) != visibleMeshlets.begin() + visibleCount)
+						continue;
+
+					const Nz::Meshlet& meshlet = meshlets[i];
+					for (Nz::UInt32 j = meshlet.firstIndex; j < meshlet.firstIndex + meshlet.indexCount; j += 3)
+					{
+						Nz::Vector3f a = positionPtr[indexMapper.Get(j)];
+						Nz::Vector3f normal = (positionPtr[indexMapper.Get(j + 1)] - a).CrossProduct(positionPtr[indexMapper.Get(j + 2)] - a);
+						CHECK(normal.DotProduct(a - eyePosition) > 0.f);
+					}
+				}
+			}
+
+			THEN("The same meshlets are kept once the sphere and the viewpoint are moved together")
+			{
+				std::size_t visibleCount = Nz::CullMeshlets(meshlets.data(), meshlets.size(), Nz::Matrix4f::Identity(), frustum, eyePosition, true, visibleMeshlets.data());
+
+				Nz::Matrix4f transformMatrix = Nz::Matrix4f::Transform(Nz::Vector3f(10.f, 0.f, 0.f), Nz::Quaternionf::Identity(), Nz::Vector3f(2.f));
+				Nz::Vector3f movedEyePosition = transformMatrix.Transform(eyePosition);
+
+				Nz::Frustumf movedFrustum;
+				movedFrustum.Build(90.f, 1.f, 0.1f, 100.f, movedEyePosition, Nz::Vector3f(10.f, 0.f, 0.f));
+
+				std::vector<Nz::UInt32> movedVisibleMeshlets(meshlets.size());
+				CHECK(Nz::CullMeshlets(meshlets.data(), meshlets.size(), transformMatrix, movedFrustum, movedEyePosition, true, movedVisibleMeshlets.data()) == visibleCount);
+				CHECK(std::equal(visibleMeshlets.begin(), visibleMeshlets.begin() + visibleCount, movedVisibleMeshlets.begin()));
+			}
+
+			THEN("Every meshlet is kept without back-face culling")
+			{
+				CHECK(Nz::CullMeshlets(meshlets.data(), meshlets.size(), Nz::Matrix4f::Identity(), frustum, eyePosition, false, visibleMeshlets.data()) == meshlets.size());
+			}
+		}
+
+		WHEN("We cull them from a viewpoint looking away")
+		{
+			Nz::Vector3f eyePosition(0.f, 0.f, 5.f);
+
+			Nz::Frustumf frustum;
+			frustum.Build(90.f, 1.f, 0.1f, 100.f, eyePosition, Nz::Vector3f(0.f, 0.f, 10.f));
+
+			std::vector<Nz::UInt32> visibleMeshlets(meshlets.size());
+
+			THEN("None of them is visible")
+			{
+				CHECK(Nz::CullMeshlets(meshlets.data(), meshlets.size(), Nz::Matrix4f::Identity(), frustum, eyePosition, false, visibleMeshlets.data()) == 0);
+			}
+		}
+	}
+}
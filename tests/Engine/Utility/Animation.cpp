@@ -0,0 +1,92 @@
+#include <Nazara/Utility/Animation.hpp>
+#include <Nazara/Utility/Joint.hpp>
+#include <Nazara/Utility/Sequence.hpp>
+#include <Nazara/Utility/Skeleton.hpp>
+#include <Catch/catch.hpp>
+#include <array>
+#include <vector>
+
+SCENARIO("Animation", "[UTILITY][ANIMATION]")
+{
+	GIVEN("A skeletal animation moving and rotating its joints at a constant speed")
+	{
+		const Nz::UInt32 frameCount = 100;
+		const Nz::UInt32 jointCount = 3;
+
+		Nz::AnimationRef animation = Nz::Animation::New();
+		REQUIRE(animation->CreateSkeletal(frameCount, jointCount));
+
+		for (Nz::UInt32 frame = 0; frame < frameCount; ++frame)
+		{
+			Nz::SequenceJoint* sequenceJoints = animation->GetSequenceJoints(frame);
+			for (Nz::UInt32 i = 0; i < jointCount; ++i)
+			{
+				sequenceJoints[i].position = Nz::Vector3f(float(i), 0.1f * frame, 0.f);
+				sequenceJoints[i].rotation = Nz::EulerAnglesf(0.f, 1.f * frame, 0.f);
+				sequenceJoints[i].scale = Nz::Vector3f::Unit();
+			}
+		}
+
+		std::array<Nz::SequenceJoint, jointCount> referencePose;
+		animation->SamplePose(41, 42, 0.5f, referencePose.data());
+
+		WHEN("We compress it")
+		{
+			std::size_t memoryUsage = animation->GetMemoryUsage();
+			REQUIRE(animation->Compress());
+
+			THEN("It should use less memory and give the same poses")
+			{
+				CHECK(animation->IsCompressed());
+				CHECK(animation->GetMemoryUsage() * 10 < memoryUsage);
+
+				std::array<Nz::SequenceJoint, jointCount> pose;
+				animation->SamplePose(41, 42, 0.5f, pose.data());
+
+				for (Nz::UInt32 i = 0; i < jointCount; ++i)
+				{
+					CHECK(pose[i].position.Distance(referencePose[i].position) < 0.001f);
+					CHECK(std::abs(pose[i].rotation.DotProduct(referencePose[i].rotation)) > 0.9999f);
+					CHECK(pose[i].scale.Distance(Nz::Vector3f::Unit()) < 0.001f);
+				}
+			}
+		}
+
+		WHEN("We blend two of its poses")
+		{
+			std::array<Nz::SequenceJoint, jointCount> pose;
+			animation->SamplePose(0, 0, 0.f, pose.data());
+			animation->BlendPose(20, 20, 0.f, 0.5f, pose.data());
+
+			THEN("The pose should be halfway between them")
+			{
+				CHECK(pose[0].position.Distance(Nz::Vector3f(0.f, 1.f, 0.f)) < 0.001f);
+				CHECK(std::abs(pose[0].rotation.DotProduct(Nz::EulerAnglesf(0.f, 10.f, 0.f))) > 0.9999f);
+			}
+		}
+
+		WHEN("We animate a skeleton with it")
+		{
+			Nz::Skeleton skeleton;
+			REQUIRE(skeleton.Create(jointCount));
+
+			int invalidationCount = 0;
+			NazaraSlot(Nz::Skeleton, OnSkeletonJointsInvalidated, invalidationSlot);
+			invalidationSlot.Connect(skeleton.OnSkeletonJointsInvalidated, [&](const Nz::Skeleton*) { invalidationCount++; });
+
+			animation->AnimateSkeleton(&skeleton, 41, 42, 0.5f);
+
+			THEN("Its joints should have the pose of the animation, written at once")
+			{
+				CHECK(invalidationCount == 1);
+
+				const Nz::Skeleton& constSkeleton = skeleton;
+				for (Nz::UInt32 i = 0; i < jointCount; ++i)
+				{
+					const Nz::Joint* joint = constSkeleton.GetJoint(i);
+					CHECK(joint->GetPosition(Nz::CoordSys_Local).Distance(referencePose[i].position) < 0.0001f);
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,58 @@
+#include <Nazara/Utility/Buffer.hpp>
+#include <Nazara/Utility/BufferMapper.hpp>
+#include <Nazara/Utility/SoftwareBuffer.hpp>
+#include <Catch/catch.hpp>
+#include <cstdint>
+
+SCENARIO("Buffer", "[UTILITY][BUFFER]")
+{
+	GIVEN("A software buffer")
+	{
+		Nz::Buffer buffer(Nz::BufferType_Vertex, 1000, Nz::DataStorage_Software);
+
+		THEN("Its memory is aligned and cleared")
+		{
+			Nz::BufferMapper<Nz::Buffer> mapper(buffer, Nz::BufferAccess_ReadOnly);
+			const Nz::UInt8* data = static_cast<const Nz::UInt8*>(mapper.GetPointer());
+			CHECK(reinterpret_cast<std::uintptr_t>(data) % Nz::SoftwareBuffer::Alignment == 0);
+
+			bool cleared = true;
+			for (unsigned int i = 0; i < 1000; ++i)
+				cleared &= (data[i] == 0);
+
+			CHECK(cleared);
+		}
+
+		WHEN("We fill it")
+		{
+			Nz::UInt8 values[] = {1, 2, 3, 4};
+			REQUIRE(buffer.Fill(values, 996, 4));
+
+			THEN("Its memory is directly accessible")
+			{
+				const Nz::SoftwareBuffer* impl = static_cast<const Nz::SoftwareBuffer*>(buffer.GetImpl());
+				CHECK(impl->GetData()[996] == 1);
+				CHECK(impl->GetData()[999] == 4);
+			}
+		}
+	}
+
+	GIVEN("A transient software buffer")
+	{
+		const void* memory;
+		{
+			Nz::Buffer buffer(Nz::BufferType_Vertex, 3000, Nz::DataStorage_Software, Nz::BufferUsage_Transient);
+			memory = static_cast<const Nz::SoftwareBuffer*>(buffer.GetImpl())->GetData();
+		}
+
+		WHEN("We create another buffer of the same size class")
+		{
+			Nz::Buffer buffer(Nz::BufferType_Vertex, 4000, Nz::DataStorage_Software, Nz::BufferUsage_Transient);
+
+			THEN("It reuses the memory of the previous one")
+			{
+				CHECK(static_cast<const Nz::SoftwareBuffer*>(buffer.GetImpl())->GetData() == memory);
+			}
+		}
+	}
+}
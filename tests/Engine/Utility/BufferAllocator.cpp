@@ -0,0 +1,115 @@
+#include <Nazara/Utility/BufferAllocator.hpp>
+#include <Nazara/Core/Primitive.hpp>
+#include <Nazara/Utility/IndexMapper.hpp>
+#include <Nazara/Utility/Mesh.hpp>
+#include <Nazara/Utility/StaticMesh.hpp>
+#include <Nazara/Utility/VertexDeclaration.hpp>
+#include <Nazara/Utility/VertexMapper.hpp>
+#include <Catch/catch.hpp>
+#include <cmath>
+
+SCENARIO("BufferAllocator", "[UTILITY][BUFFERALLOCATOR]")
+{
+	GIVEN("An allocator with small blocks")
+	{
+		Nz::BufferAllocator allocator(Nz::DataStorage_Software, 0, 1024);
+		Nz::VertexDeclaration* declaration = Nz::VertexDeclaration::Get(Nz::VertexLayout_XYZ_Normal_UV_Tangent);
+		unsigned int stride = static_cast<unsigned int>(declaration->GetStride());
+
+		WHEN("We allocate vertex buffers")
+		{
+			Nz::VertexBufferRef first = allocator.AllocateVertexBuffer(declaration, 10);
+			Nz::VertexBufferRef second = allocator.AllocateVertexBuffer(declaration, 5);
+			REQUIRE(first);
+			REQUIRE(second);
+
+			THEN("They share a buffer, aligned to their stride")
+			{
+				CHECK(allocator.GetBlockCount(Nz::BufferType_Vertex) == 1);
+				CHECK(first->GetBuffer() == second->GetBuffer());
+				CHECK(first->GetVertexCount() == 10);
+				CHECK(second->GetVertexCount() == 5);
+				CHECK(second->GetStartOffset() % stride == 0);
+				CHECK(second->GetStartOffset() >= first->GetEndOffset());
+				CHECK(allocator.GetUsedSize(Nz::BufferType_Vertex) == 15 * stride);
+			}
+
+			AND_WHEN("We allocate more than a block can hold")
+			{
+				Nz::VertexBufferRef third = allocator.AllocateVertexBuffer(declaration, 20);
+				REQUIRE(third);
+
+				THEN("Another block is created")
+				{
+					CHECK(allocator.GetBlockCount(Nz::BufferType_Vertex) == 2);
+					CHECK(third->GetBuffer() != first->GetBuffer());
+					CHECK(third->GetBuffer()->GetSize() >= 20 * stride);
+				}
+			}
+
+			AND_WHEN("We release them")
+			{
+				first.Reset();
+				second.Reset();
+
+				THEN("Their ranges are merged back and can be reused")
+				{
+					CHECK(allocator.GetUsedSize(Nz::BufferType_Vertex) == 0);
+
+					Nz::VertexBufferRef whole = allocator.AllocateVertexBuffer(declaration, 1024 / stride);
+					REQUIRE(whole);
+					CHECK(allocator.GetBlockCount(Nz::BufferType_Vertex) == 1);
+					CHECK(whole->GetStartOffset() == 0);
+				}
+			}
+		}
+
+		WHEN("We build meshes with the allocator")
+		{
+			Nz::BufferAllocator meshAllocator(Nz::DataStorage_Software);
+
+			Nz::MeshParams params;
+			params.bufferAllocator = &meshAllocator;
+			params.storage = Nz::DataStorage_Software;
+
+			Nz::MeshRef mesh = Nz::Mesh::New();
+			REQUIRE(mesh->CreateStatic());
+			mesh->BuildSubMesh(Nz::Primitive::Box(Nz::Vector3f::Unit()), params);
+			mesh->BuildSubMesh(Nz::Primitive::Box(Nz::Vector3f(2.f)), params);
+
+			const Nz::StaticMesh* firstSubMesh = static_cast<const Nz::StaticMesh*>(mesh->GetSubMesh(0));
+			const Nz::StaticMesh* secondSubMesh = static_cast<const Nz::StaticMesh*>(mesh->GetSubMesh(1));
+
+			THEN("Their buffers are relocated in the shared blocks, keeping their content")
+			{
+				CHECK(firstSubMesh->GetVertexBuffer()->GetBuffer() == secondSubMesh->GetVertexBuffer()->GetBuffer());
+				CHECK(firstSubMesh->GetIndexBuffer()->GetBuffer() == secondSubMesh->GetIndexBuffer()->GetBuffer());
+				CHECK(secondSubMesh->GetVertexBuffer()->GetStartOffset() % stride == 0);
+
+				Nz::VertexMapper vertexMapper(secondSubMesh, Nz::BufferAccess_ReadOnly);
+				Nz::SparsePtr<const Nz::Vector3f> positionPtr = vertexMapper.GetComponentPtr<const Nz::Vector3f>(Nz::VertexComponent_Position);
+				REQUIRE(positionPtr);
+				for (unsigned int i = 0; i < vertexMapper.GetVertexCount(); ++i)
+				{
+					CHECK(std::abs(positionPtr[i].x) == Approx(1.f));
+					CHECK(std::abs(positionPtr[i].y) == Approx(1.f));
+				}
+
+				Nz::IndexMapper indexMapper(secondSubMesh);
+				for (unsigned int i = 0; i < indexMapper.GetIndexCount(); ++i)
+					CHECK(indexMapper.Get(i) < secondSubMesh->GetVertexCount());
+			}
+
+			AND_WHEN("We release the mesh")
+			{
+				mesh.Reset();
+
+				THEN("Its ranges are freed")
+				{
+					CHECK(meshAllocator.GetUsedSize(Nz::BufferType_Index) == 0);
+					CHECK(meshAllocator.GetUsedSize(Nz::BufferType_Vertex) == 0);
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,76 @@
+#include <Nazara/Utility/Font.hpp>
+#include <Nazara/Core/ResourceFinalizationQueue.hpp>
+#include <Nazara/Core/Thread.hpp>
+#include <Nazara/Utility/FontGlyph.hpp>
+#include <Nazara/Utility/Image.hpp>
+#include <Catch/catch.hpp>
+#include <cstdlib>
+
+SCENARIO("Font", "[UTILITY][FONT]")
+{
+	GIVEN("The default font")
+	{
+		const Nz::FontRef& font = Nz::Font::GetDefault();
+		REQUIRE(font.IsValid());
+
+		WHEN("We enable its distance field mode")
+		{
+			font->SetDistanceFieldSize(32);
+			font->SetDistanceFieldSpread(4);
+
+			const Nz::Font::Glyph& referenceGlyph = font->GetGlyph(32, Nz::TextStyle_Regular, 'A');
+			const Nz::Font::Glyph& bigGlyph = font->GetGlyph(64, Nz::TextStyle_Regular, 'A');
+			REQUIRE(referenceGlyph.valid);
+			REQUIRE(bigGlyph.valid);
+
+			THEN("Every size shares the glyph of the reference size")
+			{
+				CHECK(bigGlyph.atlasRect == referenceGlyph.atlasRect);
+				CHECK(bigGlyph.layerIndex == referenceGlyph.layerIndex);
+				CHECK(std::abs(bigGlyph.aabb.width - referenceGlyph.aabb.width * 2) <= 1);
+				CHECK(std::abs(bigGlyph.advance - referenceGlyph.advance * 2) <= 1);
+			}
+
+			AND_THEN("The glyph holds a distance field fading out on its borders")
+			{
+				CHECK(static_cast<unsigned int>(referenceGlyph.aabb.width) == referenceGlyph.atlasRect.width);
+
+				Nz::Image* layer = static_cast<Nz::Image*>(font->GetAtlas()->GetLayer(referenceGlyph.layerIndex));
+				CHECK(layer->GetPixelColor(referenceGlyph.atlasRect.x, referenceGlyph.atlasRect.y).a == 0);
+			}
+
+			font->SetDistanceFieldSize(0);
+		}
+
+		WHEN("We request glyphs to be rasterized in the background")
+		{
+			REQUIRE(font->PrecacheAsync(40, Nz::TextStyle_Regular, "Nazara"));
+
+			const Nz::Font::Glyph& pendingGlyph = font->RequestGlyph(40, Nz::TextStyle_Regular, 'N');
+			CHECK(pendingGlyph.pending);
+			CHECK_FALSE(pendingGlyph.valid);
+			CHECK(font->GetPendingGlyphCount() == 4);
+
+			for (unsigned int i = 0; i < 200 && font->GetPendingGlyphCount() > 0; ++i)
+			{
+				Nz::ResourceFinalizationQueue::Process();
+				Nz::Thread::Sleep(10);
+			}
+
+			THEN("They end up in the atlas like the glyphs rasterized immediately")
+			{
+				REQUIRE(font->GetPendingGlyphCount() == 0);
+
+				const Nz::Font::Glyph& glyph = font->RequestGlyph(40, Nz::TextStyle_Regular, 'N');
+				CHECK_FALSE(glyph.pending);
+				REQUIRE(glyph.valid);
+
+				Nz::FontGlyph fontGlyph;
+				REQUIRE(font->ExtractGlyph(40, 'N', Nz::TextStyle_Regular, &fontGlyph));
+				CHECK(glyph.advance == fontGlyph.advance);
+				CHECK(glyph.aabb == fontGlyph.aabb);
+				CHECK(glyph.atlasRect.width == fontGlyph.image.GetWidth());
+			}
+		}
+	}
+}
@@ -0,0 +1,50 @@
+#include <Nazara/Utility/GuillotineImageAtlas.hpp>
+#include <Catch/catch.hpp>
+#include <array>
+
+SCENARIO("GuillotineImageAtlas", "[UTILITY][GUILLOTINEIMAGEATLAS]")
+{
+	for (Nz::AtlasPacking packing : {Nz::AtlasPacking_Guillotine, Nz::AtlasPacking_Shelf, Nz::AtlasPacking_Skyline})
+	{
+		GIVEN("An atlas packing images with algorithm #" + std::to_string(packing))
+		{
+			Nz::GuillotineImageAtlas atlas;
+			atlas.SetPacking(packing);
+			REQUIRE(atlas.GetPacking() == packing);
+
+			WHEN("We insert a batch of glyph-like images")
+			{
+				std::array<Nz::Image, 32> images;
+				std::array<Nz::Rectui, 32> rects;
+				std::array<bool, 32> flipped;
+				std::array<unsigned int, 32> layers;
+				for (unsigned int i = 0; i < images.size(); ++i)
+				{
+					unsigned int width = 6 + i % 7;
+					unsigned int height = 12 + i % 3;
+
+					images[i].Create(Nz::ImageType_2D, Nz::PixelFormatType_A8, width, height);
+					images[i].Fill(Nz::Color(0, 0, 0, static_cast<Nz::UInt8>(i + 1)));
+					rects[i].Set(0, 0, width, height);
+				}
+
+				REQUIRE(atlas.Insert(images.data(), rects.data(), flipped.data(), layers.data(), static_cast<unsigned int>(images.size())));
+
+				THEN("Each image gets its own area of the atlas")
+				{
+					REQUIRE(atlas.GetLayerCount() == 1);
+					Nz::Image* layer = static_cast<Nz::Image*>(atlas.GetLayer(0));
+
+					for (std::size_t i = 0; i < rects.size(); ++i)
+					{
+						CHECK(layers[i] == 0);
+						CHECK(layer->GetPixelColor(rects[i].x, rects[i].y).a == i + 1);
+
+						for (std::size_t j = i + 1; j < rects.size(); ++j)
+							CHECK_FALSE(rects[i].Intersect(rects[j]));
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,358 @@
+#include <Nazara/Utility/Image.hpp>
+#include <Nazara/Core/ArchiveBuilder.hpp>
+#include <Nazara/Core/Directory.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/ResourceFinalizationQueue.hpp>
+#include <Nazara/Core/ResourceWatcher.hpp>
+#include <Nazara/Core/Thread.hpp>
+#include <Nazara/Core/VirtualFileSystem.hpp>
+#include <Nazara/Utility/PixelFormat.hpp>
+#include <Catch/catch.hpp>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+
+SCENARIO("Image", "[UTILITY][IMAGE]")
+{
+	GIVEN("An image file")
+	{
+		const Nz::String filePath = "resources/Engine/Graphics/Nazara.png";
+
+		WHEN("We load it asynchronously with the manager")
+		{
+			Nz::ImageManager::Unregister(filePath);
+
+			Nz::ResourceFuture<Nz::Image> future = Nz::ImageManager::GetAsync(filePath);
+			REQUIRE(future.IsValid());
+
+			Nz::ImageRef image = future.Wait();
+
+			THEN("We get the decoded image")
+			{
+				REQUIRE(image);
+				CHECK(image->IsValid());
+				CHECK(image->GetWidth() > 0);
+				CHECK(image->GetHeight() > 0);
+			}
+
+			AND_THEN("The manager now holds it")
+			{
+				Nz::ResourceFuture<Nz::Image> secondFuture = Nz::ImageManager::GetAsync(filePath);
+				CHECK(secondFuture.IsReady());
+				CHECK(secondFuture.Get() == image);
+				CHECK(Nz::ImageManager::Get(filePath) == image);
+			}
+		}
+
+		WHEN("We load it from a mounted archive")
+		{
+			Nz::ArchiveBuilder builder;
+			REQUIRE(builder.AddFile("Nazara.png", filePath));
+			REQUIRE(builder.Save("Test Images.nzpk"));
+			REQUIRE(Nz::VirtualFileSystem::Mount("Test Images.nzpk", "VirtualImages"));
+
+			Nz::ImageRef image = Nz::Image::New();
+			bool loaded = image->LoadFromFile("VirtualImages/Nazara.png");
+
+			Nz::VirtualFileSystem::Unmount("Test Images.nzpk");
+			Nz::File::Delete("Test Images.nzpk");
+
+			THEN("It is decoded from the archive")
+			{
+				REQUIRE(loaded);
+				CHECK(image->GetWidth() > 0);
+				CHECK(image->GetHeight() > 0);
+			}
+		}
+
+		WHEN("We load an array from one file per layer")
+		{
+			std::array<Nz::String, 3> filePaths;
+			filePaths.fill(filePath);
+
+			Nz::Image image;
+			REQUIRE(image.LoadArrayFromFiles(filePaths.data(), filePaths.size()));
+
+			THEN("Every file is a layer of the array")
+			{
+				Nz::Image layer;
+				REQUIRE(layer.LoadFromFile(filePath));
+
+				CHECK(image.GetType() == Nz::ImageType_2D_Array);
+				CHECK(image.GetWidth() == layer.GetWidth());
+				CHECK(image.GetHeight() == layer.GetHeight());
+				CHECK(image.GetDepth() == 3);
+
+				std::size_t layerSize = Nz::PixelFormat::ComputeSize(image.GetFormat(), layer.GetWidth(), layer.GetHeight(), 1);
+				CHECK(std::memcmp(image.GetConstPixels(0, 0, 2), layer.GetConstPixels(), layerSize) == 0);
+			}
+		}
+
+		WHEN("We load a cubemap from files which aren't squares")
+		{
+			std::array<Nz::String, Nz::CubemapFace_Max + 1> filePaths;
+			filePaths.fill(filePath);
+
+			Nz::Image image;
+
+			THEN("It fails")
+			{
+				CHECK_FALSE(image.LoadCubemapFromFiles(filePaths));
+			}
+		}
+
+		WHEN("We load a file which doesn't exist")
+		{
+			Nz::ResourceFuture<Nz::Image> future = Nz::Image::LoadAsync("resources/Engine/Graphics/NotAnImage.png");
+
+			THEN("The future fails")
+			{
+				CHECK_FALSE(future.Wait());
+				CHECK(future.GetState() == Nz::ResourceLoadState_Failed);
+			}
+		}
+	}
+
+	GIVEN("A compressed image with mipmaps")
+	{
+		Nz::Image image(Nz::ImageType_2D, Nz::PixelFormatType_RGBA8, 16, 8, 1, 3);
+		for (Nz::UInt8 level = 0; level < image.GetLevelCount(); ++level)
+		{
+			Nz::UInt8* pixels = image.GetPixels(0, 0, 0, level);
+			std::size_t size = Nz::PixelFormat::ComputeSize(Nz::PixelFormatType_RGBA8, image.GetWidth(level), image.GetHeight(level), 1);
+			for (std::size_t i = 0; i < size; ++i)
+				pixels[i] = static_cast<Nz::UInt8>(i * 13 + level * 40);
+		}
+
+		REQUIRE(image.Convert(Nz::PixelFormatType_DXT5));
+
+		WHEN("We save it as DDS and load it back")
+		{
+			REQUIRE(image.SaveToFile("Test Image.dds"));
+
+			Nz::Image loaded;
+			bool loadResult = loaded.LoadFromFile("Test Image.dds");
+			Nz::File::Delete("Test Image.dds");
+
+			THEN("We get the same blocks")
+			{
+				REQUIRE(loadResult);
+				CHECK(loaded.GetFormat() == Nz::PixelFormatType_DXT5);
+				CHECK(loaded.GetWidth() == 16);
+				CHECK(loaded.GetHeight() == 8);
+				REQUIRE(loaded.GetLevelCount() == 3);
+
+				for (Nz::UInt8 level = 0; level < 3; ++level)
+				{
+					std::size_t size = Nz::PixelFormat::ComputeSize(Nz::PixelFormatType_DXT5, image.GetWidth(level), image.GetHeight(level), 1);
+					CHECK(std::memcmp(loaded.GetConstPixels(0, 0, 0, level), image.GetConstPixels(0, 0, 0, level), size) == 0);
+				}
+			}
+		}
+
+		WHEN("We save an uncompressed copy as DDS and load it back")
+		{
+			Nz::Image uncompressed(image);
+			REQUIRE(uncompressed.Convert(Nz::PixelFormatType_BGRA8));
+			REQUIRE(uncompressed.SaveToFile("Test Image.dds"));
+
+			Nz::Image loaded;
+			bool loadResult = loaded.LoadFromFile("Test Image.dds");
+			Nz::File::Delete("Test Image.dds");
+
+			THEN("Its pixel format is recognized")
+			{
+				REQUIRE(loadResult);
+				CHECK(loaded.GetFormat() == Nz::PixelFormatType_BGRA8);
+				CHECK(std::memcmp(loaded.GetConstPixels(), uncompressed.GetConstPixels(), 16 * 8 * 4) == 0);
+			}
+		}
+	}
+
+	GIVEN("An image of a watched directory, loaded by the manager")
+	{
+		REQUIRE(Nz::Directory::Create("HotReload"));
+
+		Nz::Image red(Nz::ImageType_2D, Nz::PixelFormatType_RGBA8, 4, 4);
+		REQUIRE(red.Fill(Nz::Color::Red));
+		REQUIRE(red.SaveToFile("HotReload/Image.png"));
+
+		Nz::ImageRef image = Nz::ImageManager::Get("HotReload/Image.png");
+		REQUIRE(image);
+		CHECK(image->GetPixelColor(0, 0) == Nz::Color::Red);
+
+		REQUIRE(Nz::ResourceWatcher::Watch("HotReload"));
+
+		WHEN("The file is written again")
+		{
+			Nz::Image blue(Nz::ImageType_2D, Nz::PixelFormatType_RGBA8, 4, 4);
+			REQUIRE(blue.Fill(Nz::Color::Blue));
+			REQUIRE(blue.SaveToFile("HotReload/Image.png"));
+
+			std::size_t reloadCount = 0;
+			for (unsigned int i = 0; i < 100 && image->GetPixelColor(0, 0) != Nz::Color::Blue; ++i)
+			{
+				reloadCount += Nz::ResourceWatcher::Update();
+				Nz::ResourceFinalizationQueue::Process();
+				Nz::Thread::Sleep(10);
+			}
+
+			THEN("The image held by the manager is updated in place")
+			{
+				CHECK(reloadCount >= 1);
+				CHECK(image->GetPixelColor(0, 0) == Nz::Color::Blue);
+				CHECK(Nz::ImageManager::Get("HotReload/Image.png") == image);
+			}
+		}
+
+		WHEN("A file it depends on changes")
+		{
+			Nz::ResourceWatcher::AddDependency("HotReload/Image.png", "HotReload/Palette.txt");
+
+			THEN("It is reloaded as well")
+			{
+				CHECK(Nz::ResourceWatcher::Reload("HotReload/Palette.txt") == 1);
+
+				Nz::ResourceWatcher::ClearDependencies("HotReload/Image.png");
+				CHECK(Nz::ResourceWatcher::Reload("HotReload/Palette.txt") == 0);
+			}
+		}
+
+		Nz::ResourceWatcher::Unwatch("HotReload");
+		Nz::ImageManager::Unregister("HotReload/Image.png");
+
+		// Lets the remaining reloads end before removing their file
+		for (unsigned int i = 0; i < 10; ++i)
+		{
+			Nz::ResourceFinalizationQueue::Process();
+			Nz::Thread::Sleep(10);
+		}
+
+		REQUIRE(Nz::Directory::Remove("HotReload", true));
+	}
+
+	GIVEN("Two files with the same image, loaded by the manager with content deduplication")
+	{
+		REQUIRE(Nz::Directory::Create("Deduplication"));
+
+		Nz::Image green(Nz::ImageType_2D, Nz::PixelFormatType_RGBA8, 4, 4);
+		REQUIRE(green.Fill(Nz::Color::Green));
+		REQUIRE(green.SaveToFile("Deduplication/First.png"));
+		REQUIRE(green.SaveToFile("Deduplication/Second.png"));
+
+		Nz::ImageManager::EnableContentDeduplication(true);
+
+		Nz::ImageRef first = Nz::ImageManager::Get("Deduplication/First.png");
+		Nz::ImageRef second = Nz::ImageManager::Get("Deduplication/Second.png");
+
+		THEN("They share the same image")
+		{
+			REQUIRE(first);
+			CHECK(first == second);
+			CHECK(Nz::ImageManager::Get("Deduplication/../Deduplication/First.png") == first);
+			CHECK(Nz::ImageManager::GetMemoryUsage() >= first->GetMemoryUsage());
+		}
+
+		WHEN("One of the files changes")
+		{
+			Nz::Image red(Nz::ImageType_2D, Nz::PixelFormatType_RGBA8, 4, 4);
+			REQUIRE(red.Fill(Nz::Color::Red));
+			REQUIRE(red.SaveToFile("Deduplication/Second.png"));
+			REQUIRE(Nz::ImageManager::Reload("Deduplication/Second.png"));
+
+			THEN("It gets its own image")
+			{
+				Nz::ImageRef reloaded = Nz::ImageManager::Get("Deduplication/Second.png");
+				REQUIRE(reloaded);
+				CHECK(reloaded != first);
+				CHECK(reloaded->GetPixelColor(0, 0) == Nz::Color::Red);
+				CHECK(first->GetPixelColor(0, 0) == Nz::Color::Green);
+			}
+		}
+
+		Nz::ImageManager::EnableContentDeduplication(false);
+		Nz::ImageManager::Unregister("Deduplication/First.png");
+		Nz::ImageManager::Unregister("Deduplication/Second.png");
+
+		REQUIRE(Nz::Directory::Remove("Deduplication", true));
+	}
+
+	GIVEN("A checkerboard image")
+	{
+		Nz::Image image;
+		REQUIRE(image.Create(Nz::ImageType_2D, Nz::PixelFormatType_RGBA8, 16, 4));
+
+		Nz::UInt8* pixels = image.GetPixels();
+		for (unsigned int y = 0; y < 4; ++y)
+		{
+			for (unsigned int x = 0; x < 16; ++x)
+			{
+				Nz::UInt8 value = ((x + y) % 2 == 0) ? 255 : 0;
+				Nz::UInt8* pixel = &pixels[(y * 16 + x) * 4];
+				pixel[0] = value;
+				pixel[1] = value;
+				pixel[2] = value;
+				pixel[3] = value;
+			}
+		}
+
+		WHEN("We generate its mipmaps with a box filter")
+		{
+			REQUIRE(image.GenerateMipmaps(Nz::MipmapFilter_Box));
+
+			THEN("Every level is a flat average")
+			{
+				REQUIRE(image.GetLevelCount() == image.GetMaxLevel());
+				CHECK(image.GetLevelCount() == 4);
+				CHECK(image.GetWidth(3) == 2);
+
+				const Nz::UInt8* level = image.GetConstPixels(0, 0, 0, 2);
+				for (unsigned int i = 0; i < 4 * 1 * 4; ++i)
+					CHECK(std::abs(level[i] - 128) <= 1);
+			}
+		}
+
+		WHEN("We generate its mipmaps in linear space")
+		{
+			REQUIRE(image.GenerateMipmaps(Nz::MipmapFilter_Box, true));
+
+			THEN("Colors are averaged as light while alpha stays linear")
+			{
+				const Nz::UInt8* level = image.GetConstPixels(0, 0, 0, 1);
+				CHECK(std::abs(level[0] - 188) <= 1);
+				CHECK(std::abs(level[3] - 128) <= 1);
+			}
+		}
+	}
+
+	GIVEN("An uniform cubemap")
+	{
+		Nz::Image image;
+		REQUIRE(image.Create(Nz::ImageType_Cubemap, Nz::PixelFormatType_RGBA8, 32, 32));
+
+		const Nz::Color faceColors[6] = { Nz::Color::Red, Nz::Color::Green, Nz::Color::Blue, Nz::Color::Yellow, Nz::Color::Cyan, Nz::Color::Magenta };
+		for (unsigned int face = 0; face < 6; ++face)
+			REQUIRE(image.Fill(faceColors[face], Nz::Rectui(0, 0, 32, 32), face));
+
+		WHEN("We generate its mipmaps with a Kaiser filter")
+		{
+			REQUIRE(image.GenerateMipmaps(Nz::MipmapFilter_Kaiser, true));
+
+			THEN("Faces are filtered independently")
+			{
+				REQUIRE(image.GetLevelCount() == image.GetMaxLevel());
+				for (Nz::UInt8 level = 1; level < image.GetLevelCount(); ++level)
+				{
+					for (unsigned int face = 0; face < 6; ++face)
+					{
+						const Nz::UInt8* pixel = image.GetConstPixels(0, 0, face, level);
+						CHECK(pixel[0] == faceColors[face].r);
+						CHECK(pixel[1] == faceColors[face].g);
+						CHECK(pixel[2] == faceColors[face].b);
+						CHECK(pixel[3] == faceColors[face].a);
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,61 @@
+#include <Nazara/Utility/ImageView.hpp>
+#include <Nazara/Utility/Image.hpp>
+#include <Catch/catch.hpp>
+
+SCENARIO("ImageView", "[UTILITY][IMAGEVIEW]")
+{
+	GIVEN("An image shared between two copies")
+	{
+		Nz::Image image(Nz::ImageType_2D, Nz::PixelFormatType_RGBA8, 8, 8);
+		REQUIRE(image.Fill(Nz::Color::Black));
+
+		Nz::Image copy(image);
+		REQUIRE(copy.GetConstPixels() == image.GetConstPixels());
+
+		WHEN("We fill a part of one of them through a view")
+		{
+			Nz::ImageView<Nz::UInt8> view = copy.GetView(Nz::Boxui(2, 2, 0, 4, 4, 1));
+			REQUIRE(view.IsValid());
+			CHECK(view.GetWidth() == 4);
+			CHECK(view.GetRowPitch() == 8 * 4);
+			REQUIRE(view.Fill(Nz::Color::Red));
+
+			THEN("Only the box of this image is modified")
+			{
+				CHECK(copy.GetConstPixels() != image.GetConstPixels());
+				CHECK(copy.GetPixelColor(2, 2) == Nz::Color::Red);
+				CHECK(copy.GetPixelColor(5, 5) == Nz::Color::Red);
+				CHECK(copy.GetPixelColor(1, 2) == Nz::Color::Black);
+				CHECK(copy.GetPixelColor(6, 5) == Nz::Color::Black);
+				CHECK(image.GetPixelColor(2, 2) == Nz::Color::Black);
+			}
+		}
+
+		WHEN("We copy pixels from one to the other")
+		{
+			Nz::Image red(Nz::ImageType_2D, Nz::PixelFormatType_RGBA8, 2, 2);
+			REQUIRE(red.Fill(Nz::Color::Red));
+
+			copy.Copy(red, Nz::Rectui(0, 0, 2, 2), Nz::Vector3ui(3, 1, 0));
+
+			THEN("The image sharing the pixels is left untouched")
+			{
+				CHECK(copy.GetPixelColor(3, 1) == Nz::Color::Red);
+				CHECK(copy.GetPixelColor(4, 2) == Nz::Color::Red);
+				CHECK(copy.GetPixelColor(5, 2) == Nz::Color::Black);
+				CHECK(image.GetPixelColor(3, 1) == Nz::Color::Black);
+			}
+		}
+	}
+
+	GIVEN("A view over a compressed image")
+	{
+		Nz::Image image(Nz::ImageType_2D, Nz::PixelFormatType_DXT1, 8, 8);
+		Nz::ImageView<const Nz::UInt8> view = image.GetConstView();
+
+		THEN("It is invalid")
+		{
+			CHECK_FALSE(view.IsValid());
+		}
+	}
+}
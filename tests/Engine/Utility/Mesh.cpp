@@ -0,0 +1,185 @@
+#include <Nazara/Utility/Mesh.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/Primitive.hpp>
+#include <Nazara/Utility/IndexBuffer.hpp>
+#include <Nazara/Utility/IndexMapper.hpp>
+#include <Nazara/Utility/MaterialData.hpp>
+#include <Nazara/Utility/StaticMesh.hpp>
+#include <Nazara/Utility/VertexBuffer.hpp>
+#include <Nazara/Utility/VertexMapper.hpp>
+#include <Catch/catch.hpp>
+#include <cmath>
+
+SCENARIO("Mesh", "[UTILITY][MESH]")
+{
+	GIVEN("A static mesh made of two primitives")
+	{
+		Nz::MeshParams params;
+		params.storage = Nz::DataStorage_Software;
+
+		Nz::MeshRef mesh = Nz::Mesh::New();
+		REQUIRE(mesh->CreateStatic());
+		mesh->BuildSubMesh(Nz::Primitive::Box(Nz::Vector3f(1.f, 2.f, 3.f)), params);
+		mesh->BuildSubMesh(Nz::Primitive::IcoSphere(1.f, 2), params);
+		REQUIRE(mesh->GetSubMeshCount() == 2);
+
+		mesh->GetSubMesh(1)->SetMaterialIndex(1);
+		mesh->SetMaterialCount(2);
+
+		Nz::ParameterList materialData;
+		materialData.SetParameter(Nz::MaterialData::DiffuseColor, Nz::Color::Red);
+		materialData.SetParameter(Nz::MaterialData::DiffuseTexturePath, Nz::String("Diffuse.png"));
+		materialData.SetParameter(Nz::MaterialData::Shininess, 12.0);
+		materialData.SetParameter(Nz::MaterialData::Blending, true);
+		mesh->SetMaterialData(1, materialData);
+
+		REQUIRE(mesh->SaveToFile("Test Mesh.nmesh", params));
+
+		WHEN("We load it back from its cooked form")
+		{
+			Nz::MeshRef cookedMesh = Nz::Mesh::New();
+			REQUIRE(cookedMesh->LoadFromFile("Test Mesh.nmesh", params));
+
+			THEN("It holds the same data")
+			{
+				REQUIRE(cookedMesh->GetSubMeshCount() == 2);
+				CHECK(cookedMesh->GetMaterialCount() == 2);
+				CHECK(cookedMesh->GetVertexCount() == mesh->GetVertexCount());
+				CHECK(cookedMesh->GetTriangleCount() == mesh->GetTriangleCount());
+
+				for (Nz::UInt32 i = 0; i < 2; ++i)
+				{
+					const Nz::StaticMesh* original = static_cast<const Nz::StaticMesh*>(mesh->GetSubMesh(i));
+					const Nz::StaticMesh* cooked = static_cast<const Nz::StaticMesh*>(cookedMesh->GetSubMesh(i));
+
+					CHECK(cooked->GetAABB() == original->GetAABB());
+					CHECK(cooked->GetMaterialIndex() == original->GetMaterialIndex());
+					CHECK(cooked->GetPrimitiveMode() == original->GetPrimitiveMode());
+					REQUIRE(cooked->GetVertexCount() == original->GetVertexCount());
+					REQUIRE(cooked->GetIndexBuffer());
+					REQUIRE(cooked->GetIndexBuffer()->GetIndexCount() == original->GetIndexBuffer()->GetIndexCount());
+
+					Nz::IndexMapper originalIndices(original->GetIndexBuffer(), Nz::BufferAccess_ReadOnly);
+					Nz::IndexMapper cookedIndices(cooked->GetIndexBuffer(), Nz::BufferAccess_ReadOnly);
+
+					bool sameIndices = true;
+					for (Nz::UInt32 j = 0; j < original->GetIndexBuffer()->GetIndexCount(); ++j)
+						sameIndices &= (originalIndices.Get(j) == cookedIndices.Get(j));
+
+					CHECK(sameIndices);
+				}
+
+				const Nz::ParameterList& cookedMaterial = cookedMesh->GetMaterialData(1);
+
+				Nz::Color color;
+				CHECK(cookedMaterial.GetColorParameter(Nz::MaterialData::DiffuseColor, &color));
+				CHECK(color == Nz::Color::Red);
+
+				Nz::String texturePath;
+				CHECK(cookedMaterial.GetStringParameter(Nz::MaterialData::DiffuseTexturePath, &texturePath));
+				CHECK(texturePath == "Diffuse.png");
+
+				double shininess;
+				CHECK(cookedMaterial.GetDoubleParameter(Nz::MaterialData::Shininess, &shininess));
+				CHECK(shininess == Approx(12.0));
+
+				bool blending;
+				CHECK(cookedMaterial.GetBooleanParameter(Nz::MaterialData::Blending, &blending));
+				CHECK(blending);
+			}
+
+			AND_THEN("Every submesh shares the same buffers")
+			{
+				const Nz::StaticMesh* first = static_cast<const Nz::StaticMesh*>(cookedMesh->GetSubMesh(0));
+				const Nz::StaticMesh* second = static_cast<const Nz::StaticMesh*>(cookedMesh->GetSubMesh(1));
+
+				CHECK(first->GetVertexBuffer()->GetBuffer() == second->GetVertexBuffer()->GetBuffer());
+				CHECK(first->GetIndexBuffer()->GetBuffer() == second->GetIndexBuffer()->GetBuffer());
+				CHECK(second->GetVertexBuffer()->GetStartOffset() == first->GetVertexBuffer()->GetEndOffset());
+			}
+		}
+
+		WHEN("We load it with another vertex declaration")
+		{
+			Nz::MeshParams positionParams = params;
+			positionParams.vertexDeclaration = Nz::VertexDeclaration::Get(Nz::VertexLayout_XYZ);
+
+			Nz::MeshRef cookedMesh = Nz::Mesh::New();
+			REQUIRE(cookedMesh->LoadFromFile("Test Mesh.nmesh", positionParams));
+
+			THEN("Vertices are converted")
+			{
+				REQUIRE(cookedMesh->GetSubMeshCount() == 2);
+
+				const Nz::StaticMesh* original = static_cast<const Nz::StaticMesh*>(mesh->GetSubMesh(1));
+				const Nz::StaticMesh* cooked = static_cast<const Nz::StaticMesh*>(cookedMesh->GetSubMesh(1));
+				CHECK(cooked->GetVertexBuffer()->GetVertexDeclaration() == positionParams.vertexDeclaration);
+				REQUIRE(cooked->GetVertexCount() == original->GetVertexCount());
+
+				Nz::VertexMapper originalMapper(original, Nz::BufferAccess_ReadOnly);
+				Nz::VertexMapper cookedMapper(cooked, Nz::BufferAccess_ReadOnly);
+
+				auto originalPositions = originalMapper.GetComponentPtr<Nz::Vector3f>(Nz::VertexComponent_Position);
+				auto cookedPositions = cookedMapper.GetComponentPtr<Nz::Vector3f>(Nz::VertexComponent_Position);
+
+				bool samePositions = true;
+				for (Nz::UInt32 i = 0; i < original->GetVertexCount(); ++i)
+					samePositions &= (originalPositions[i] == cookedPositions[i]);
+
+				CHECK(samePositions);
+			}
+		}
+
+		Nz::File::Delete("Test Mesh.nmesh");
+	}
+
+	GIVEN("A sphere made of enough triangles to be processed by multiple threads")
+	{
+		Nz::MeshParams params;
+		params.storage = Nz::DataStorage_Software;
+
+		Nz::MeshRef mesh = Nz::Mesh::New();
+		REQUIRE(mesh->CreateStatic());
+		mesh->BuildSubMesh(Nz::Primitive::IcoSphere(1.f, 6), params);
+
+		Nz::StaticMesh* sphere = static_cast<Nz::StaticMesh*>(mesh->GetSubMesh(0));
+		REQUIRE(sphere->GetTriangleCount() > 64 * 1024);
+
+		WHEN("We compute its bounding box")
+		{
+			sphere->GenerateAABB();
+
+			THEN("It encloses the sphere")
+			{
+				Nz::Boxf aabb = sphere->GetAABB();
+				CHECK(aabb.GetMinimum().SquaredDistance(Nz::Vector3f(-1.f)) < 0.0001f);
+				CHECK(aabb.GetMaximum().SquaredDistance(Nz::Vector3f(1.f)) < 0.0001f);
+			}
+		}
+
+		WHEN("We generate its normals and tangents")
+		{
+			mesh->GenerateNormals();
+			mesh->GenerateTangents();
+
+			THEN("They follow the surface of the sphere")
+			{
+				Nz::VertexMapper mapper(sphere, Nz::BufferAccess_ReadOnly);
+				auto normals = mapper.GetComponentPtr<Nz::Vector3f>(Nz::VertexComponent_Normal);
+				auto positions = mapper.GetComponentPtr<Nz::Vector3f>(Nz::VertexComponent_Position);
+				auto tangents = mapper.GetComponentPtr<Nz::Vector3f>(Nz::VertexComponent_Tangent);
+
+				bool radialNormals = true;
+				bool tangentialTangents = true;
+				for (Nz::UInt32 i = 0; i < sphere->GetVertexCount(); ++i)
+				{
+					radialNormals &= (std::abs(normals[i].DotProduct(Nz::Vector3f::Normalize(positions[i]))) > 0.99f);
+					tangentialTangents &= (std::abs(tangents[i].DotProduct(normals[i])) < 0.01f);
+				}
+
+				CHECK(radialNormals);
+				CHECK(tangentialTangents);
+			}
+		}
+	}
+}
@@ -0,0 +1,40 @@
+#include <Nazara/Utility/Node.hpp>
+#include <Catch/catch.hpp>
+
+SCENARIO("Node", "[UTILITY][NODE]")
+{
+	GIVEN("A parent node with a child")
+	{
+		Nz::Node parent;
+		Nz::Node child;
+		child.SetParent(parent);
+		child.SetPosition(Nz::Vector3f::UnitX());
+
+		unsigned int invalidationCount = 0;
+		child.OnNodeInvalidation.Connect([&](const Nz::Node*) { invalidationCount++; });
+
+		REQUIRE(child.GetPosition(Nz::CoordSys_Global) == Nz::Vector3f::UnitX());
+
+		WHEN("We move the parent multiple times without reading the child")
+		{
+			parent.Move(Nz::Vector3f::UnitY());
+			parent.Move(Nz::Vector3f::UnitY());
+			parent.Move(Nz::Vector3f::UnitY());
+
+			THEN("The child is invalidated only once")
+			{
+				CHECK(invalidationCount == 1);
+				CHECK(child.GetPosition(Nz::CoordSys_Global) == Nz::Vector3f(1.f, 3.f, 0.f));
+			}
+
+			AND_THEN("Reading the child makes it invalidable again")
+			{
+				child.EnsureTransformMatrixUpdate();
+				parent.Move(Nz::Vector3f::UnitZ());
+
+				CHECK(invalidationCount == 2);
+				CHECK(child.GetTransformMatrix().GetTranslation() == Nz::Vector3f(1.f, 3.f, 1.f));
+			}
+		}
+	}
+}
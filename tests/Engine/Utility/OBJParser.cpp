@@ -0,0 +1,141 @@
+#include <Nazara/Utility/Formats/OBJParser.hpp>
+#include <Nazara/Core/ErrorFlags.hpp>
+#include <Nazara/Core/MemoryView.hpp>
+#include <Catch/catch.hpp>
+#include <string>
+
+SCENARIO("OBJParser", "[UTILITY][OBJPARSER]")
+{
+	GIVEN("A small OBJ file")
+	{
+		Nz::String text = "# A comment\r\n"
+		                  "mtllib cube.mtl\r\n"
+		                  "v 0 0 0\r\n"
+		                  "v 1 0 0\r\n"
+		                  "v 1 1 0 2\r\n"
+		                  "vn 0 0 1\r\n"
+		                  "vt 0.5 1\r\n"
+		                  "o Triangle\r\n"
+		                  "usemtl Red\r\n"
+		                  "f 1/1/1 2/1/1 3/1/1\r\n"
+		                  "f -3//1 -2//1 -1//1\r\n";
+
+		Nz::MemoryView stream(text.GetConstBuffer(), text.GetSize());
+
+		WHEN("We parse it")
+		{
+			Nz::OBJParser parser;
+			REQUIRE(parser.Check(stream));
+
+			stream.SetCursorPos(0);
+			REQUIRE(parser.Parse(stream));
+
+			THEN("Everything is read")
+			{
+				CHECK(parser.GetMtlLib() == "cube.mtl");
+
+				REQUIRE(parser.GetPositionCount() == 3);
+				CHECK(parser.GetPositions()[2] == Nz::Vector4f(1.f, 1.f, 0.f, 2.f));
+				REQUIRE(parser.GetNormalCount() == 1);
+				CHECK(parser.GetNormals()[0] == Nz::Vector3f::UnitZ());
+				REQUIRE(parser.GetTexCoordCount() == 1);
+				CHECK(parser.GetTexCoords()[0] == Nz::Vector3f(0.5f, 1.f, 0.f));
+
+				REQUIRE(parser.GetMeshCount() == 1);
+				const Nz::OBJParser::Mesh& mesh = parser.GetMeshes()[0];
+				CHECK(mesh.name == "Triangle");
+				CHECK(parser.GetMaterials()[mesh.material] == "Red");
+
+				REQUIRE(mesh.faces.size() == 2);
+				REQUIRE(mesh.vertices.size() == 6);
+				for (std::size_t i = 0; i < 3; ++i)
+				{
+					CHECK(mesh.vertices[i].position == i + 1);
+					CHECK(mesh.vertices[i].texCoord == 1);
+					CHECK(mesh.vertices[i + 3].position == i + 1);
+					CHECK(mesh.vertices[i + 3].texCoord == 0);
+					CHECK(mesh.vertices[i + 3].normal == 1);
+				}
+			}
+		}
+	}
+
+	GIVEN("A big OBJ file, parsed in multiple chunks")
+	{
+		// Each quad uses relative indices, which have to be resolved across chunks
+		constexpr unsigned int quadCount = 128 * 1024;
+
+		std::string text;
+		text.reserve(quadCount * 128);
+		for (unsigned int i = 0; i < quadCount; ++i)
+		{
+			if (i == quadCount / 2)
+				text += "g second\n";
+
+			std::string x = std::to_string(i);
+			text += "v " + x + " 0 0\n";
+			text += "v " + x + " 1 0\n";
+			text += "v " + x + " 1 1\n";
+			text += "v " + x + " 0 1\n";
+			text += "# quad " + x + ", padding the file to get more than one chunk\n";
+			text += "f -4 -3 -2 -1\n";
+		}
+
+		REQUIRE(text.size() > 8 * 1024 * 1024);
+
+		Nz::MemoryView stream(text.data(), text.size());
+
+		WHEN("We parse it")
+		{
+			Nz::OBJParser parser;
+			REQUIRE(parser.Parse(stream));
+
+			THEN("The result is the same as a sequential parsing")
+			{
+				REQUIRE(parser.GetPositionCount() == 4 * quadCount);
+				CHECK(parser.GetPositions()[4 * quadCount - 1] == Nz::Vector4f(float(quadCount - 1), 0.f, 1.f, 1.f));
+
+				REQUIRE(parser.GetMeshCount() == 2);
+				std::size_t faceCount = 0;
+				for (unsigned int i = 0; i < parser.GetMeshCount(); ++i)
+				{
+					const Nz::OBJParser::Mesh& mesh = parser.GetMeshes()[i];
+					unsigned int firstQuad = (mesh.name == "second") ? quadCount / 2 : 0;
+
+					REQUIRE(mesh.faces.size() == quadCount / 2);
+					for (std::size_t j = 0; j < mesh.faces.size(); ++j)
+					{
+						const Nz::OBJParser::Face& face = mesh.faces[j];
+
+						Nz::UInt32 expectedPosition = static_cast<Nz::UInt32>(4 * (firstQuad + j) + 1);
+						if (face.vertexCount != 4 || mesh.vertices[face.firstVertex].position != expectedPosition)
+							FAIL("Face #" << j << " of " << mesh.name << " starts at " << mesh.vertices[face.firstVertex].position << " instead of " << expectedPosition);
+					}
+
+					faceCount += mesh.faces.size();
+				}
+				CHECK(faceCount == quadCount);
+			}
+		}
+	}
+
+	GIVEN("An OBJ file with an out of range index")
+	{
+		Nz::String text = "v 0 0 0\nv 1 0 0\nv 1 1 0\nf 1 2 3\nf 1 2 4\n";
+		Nz::MemoryView stream(text.GetConstBuffer(), text.GetSize());
+
+		WHEN("We parse it")
+		{
+			Nz::ErrorFlags errFlags(Nz::ErrorFlag_Silent | Nz::ErrorFlag_ThrowExceptionDisabled);
+
+			Nz::OBJParser parser;
+			REQUIRE(parser.Parse(stream));
+
+			THEN("The invalid face is skipped")
+			{
+				REQUIRE(parser.GetMeshCount() == 1);
+				CHECK(parser.GetMeshes()[0].faces.size() == 1);
+			}
+		}
+	}
+}
@@ -0,0 +1,196 @@
+#include <Nazara/Utility/PixelFormat.hpp>
+#include <Nazara/Utility/Image.hpp>
+#include <Catch/catch.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+	// Reads a pixel of an 8-bits per channel format as RGBA
+	std::array<Nz::UInt8, 4> ReadPixel(Nz::PixelFormatType format, const Nz::UInt8* pixel)
+	{
+		switch (format)
+		{
+			case Nz::PixelFormatType_BGR8:  return {{pixel[2], pixel[1], pixel[0], 0xFF}};
+			case Nz::PixelFormatType_BGRA8: return {{pixel[2], pixel[1], pixel[0], pixel[3]}};
+			case Nz::PixelFormatType_L8:    return {{pixel[0], pixel[0], pixel[0], 0xFF}};
+			case Nz::PixelFormatType_RGB8:  return {{pixel[0], pixel[1], pixel[2], 0xFF}};
+			case Nz::PixelFormatType_RGBA8: return {{pixel[0], pixel[1], pixel[2], pixel[3]}};
+			default: break;
+		}
+
+		return {{0, 0, 0, 0}};
+	}
+
+	bool CheckConversion(Nz::PixelFormatType srcFormat, Nz::PixelFormatType dstFormat, std::size_t pixelCount)
+	{
+		Nz::UInt8 srcBpp = Nz::PixelFormat::GetBytesPerPixel(srcFormat);
+		Nz::UInt8 dstBpp = Nz::PixelFormat::GetBytesPerPixel(dstFormat);
+
+		std::vector<Nz::UInt8> src(pixelCount * srcBpp);
+		for (std::size_t i = 0; i < src.size(); ++i)
+			src[i] = static_cast<Nz::UInt8>(i * 7 + i / 5);
+
+		std::vector<Nz::UInt8> dst(pixelCount * dstBpp);
+		if (!Nz::PixelFormat::Convert(srcFormat, dstFormat, src.data(), src.data() + src.size(), dst.data()))
+			return false;
+
+		bool dstHasAlpha = (dstFormat == Nz::PixelFormatType_BGRA8 || dstFormat == Nz::PixelFormatType_RGBA8);
+		for (std::size_t i = 0; i < pixelCount; ++i)
+		{
+			std::array<Nz::UInt8, 4> expected = ReadPixel(srcFormat, &src[i * srcBpp]);
+			std::array<Nz::UInt8, 4> converted = ReadPixel(dstFormat, &dst[i * dstBpp]);
+			if (!dstHasAlpha)
+				expected[3] = 0xFF;
+
+			if (expected != converted)
+				return false;
+		}
+
+		return true;
+	}
+}
+
+SCENARIO("PixelFormat", "[UTILITY][PIXELFORMAT]")
+{
+	GIVEN("The common 8-bits conversions, which have vectorized kernels")
+	{
+		const std::array<std::pair<Nz::PixelFormatType, Nz::PixelFormatType>, 12> conversions = {{
+			{Nz::PixelFormatType_BGR8,  Nz::PixelFormatType_BGRA8},
+			{Nz::PixelFormatType_BGR8,  Nz::PixelFormatType_RGBA8},
+			{Nz::PixelFormatType_BGRA8, Nz::PixelFormatType_BGR8},
+			{Nz::PixelFormatType_BGRA8, Nz::PixelFormatType_RGB8},
+			{Nz::PixelFormatType_BGRA8, Nz::PixelFormatType_RGBA8},
+			{Nz::PixelFormatType_L8,    Nz::PixelFormatType_BGRA8},
+			{Nz::PixelFormatType_L8,    Nz::PixelFormatType_RGBA8},
+			{Nz::PixelFormatType_RGB8,  Nz::PixelFormatType_BGRA8},
+			{Nz::PixelFormatType_RGB8,  Nz::PixelFormatType_RGBA8},
+			{Nz::PixelFormatType_RGBA8, Nz::PixelFormatType_BGR8},
+			{Nz::PixelFormatType_RGBA8, Nz::PixelFormatType_BGRA8},
+			{Nz::PixelFormatType_RGBA8, Nz::PixelFormatType_RGB8}
+		}};
+
+		WHEN("We convert buffers whose size isn't a multiple of the vector width")
+		{
+			THEN("Every pixel matches the per-pixel conversion")
+			{
+				for (const auto& conversion : conversions)
+				{
+					INFO(Nz::PixelFormat::GetName(conversion.first) << " -> " << Nz::PixelFormat::GetName(conversion.second));
+
+					for (std::size_t pixelCount : {1, 5, 16, 17, 63, 1000})
+						CHECK(CheckConversion(conversion.first, conversion.second, pixelCount));
+				}
+			}
+		}
+	}
+
+	GIVEN("A large RGB8 image")
+	{
+		const unsigned int width = 1024;
+		const unsigned int height = 1030;
+
+		Nz::Image image(Nz::ImageType_2D, Nz::PixelFormatType_RGB8, width, height);
+		Nz::UInt8* pixels = image.GetPixels();
+		for (std::size_t i = 0; i < width * height * 3; ++i)
+			pixels[i] = static_cast<Nz::UInt8>(i % 253);
+
+		WHEN("We convert it to BGRA8, across multiple tasks")
+		{
+			REQUIRE(image.Convert(Nz::PixelFormatType_BGRA8));
+
+			THEN("Every pixel is converted")
+			{
+				const Nz::UInt8* converted = image.GetConstPixels();
+
+				std::size_t mismatchCount = 0;
+				for (std::size_t i = 0; i < width * height; ++i)
+				{
+					const Nz::UInt8* pixel = &converted[i * 4];
+					if (pixel[0] != (i * 3 + 2) % 253 || pixel[1] != (i * 3 + 1) % 253 || pixel[2] != (i * 3) % 253 || pixel[3] != 0xFF)
+						mismatchCount++;
+				}
+
+				CHECK(mismatchCount == 0);
+			}
+		}
+	}
+
+	GIVEN("A RGBA8 image whose size isn't a multiple of the block size")
+	{
+		const unsigned int width = 10;
+		const unsigned int height = 7;
+
+		Nz::Image image(Nz::ImageType_2D, Nz::PixelFormatType_RGBA8, width, height);
+		Nz::UInt8* pixels = image.GetPixels();
+		for (unsigned int y = 0; y < height; ++y)
+		{
+			for (unsigned int x = 0; x < width; ++x)
+			{
+				Nz::UInt8* pixel = &pixels[(y * width + x) * 4];
+				// Colors of a block are on a line, which can be closely represented
+				pixel[0] = static_cast<Nz::UInt8>(x * 25);
+				pixel[1] = static_cast<Nz::UInt8>(x * 20 + y * 2);
+				pixel[2] = static_cast<Nz::UInt8>(200 - x * 10);
+				pixel[3] = (x < 4) ? 0 : 255; //< Whole blocks are either transparent or opaque
+			}
+		}
+
+		for (Nz::PixelFormatType format : {Nz::PixelFormatType_DXT1, Nz::PixelFormatType_DXT3, Nz::PixelFormatType_DXT5})
+		{
+			WHEN(("We compress it to " + Nz::PixelFormat::GetName(format) + " and decompress it back").GetConstBuffer())
+			{
+				Nz::Image compressed(image);
+				REQUIRE(compressed.Convert(format));
+				CHECK(compressed.GetFormat() == format);
+				CHECK(compressed.GetWidth() == width);
+				CHECK(compressed.GetHeight() == height);
+
+				Nz::Image decompressed(compressed);
+				REQUIRE(decompressed.Convert(Nz::PixelFormatType_RGBA8));
+
+				THEN("Colors are close to the original ones and transparency is kept")
+				{
+					const Nz::UInt8* original = image.GetConstPixels();
+					const Nz::UInt8* result = decompressed.GetConstPixels();
+
+					int maxColorError = 0;
+					int maxAlphaError = 0;
+					for (unsigned int i = 0; i < width * height; ++i)
+					{
+						// DXT1 transparent pixels lose their color
+						bool transparent = (original[i * 4 + 3] == 0);
+						if (!transparent || format != Nz::PixelFormatType_DXT1)
+						{
+							for (unsigned int c = 0; c < 3; ++c)
+								maxColorError = std::max(maxColorError, std::abs(original[i * 4 + c] - result[i * 4 + c]));
+						}
+
+						maxAlphaError = std::max(maxAlphaError, std::abs(original[i * 4 + 3] - result[i * 4 + 3]));
+					}
+
+					CHECK(maxColorError <= 24);
+					CHECK(maxAlphaError == 0);
+				}
+			}
+		}
+
+		WHEN("We compress a converted copy of it from BGRA8")
+		{
+			Nz::Image bgraImage(image);
+			REQUIRE(bgraImage.Convert(Nz::PixelFormatType_BGRA8));
+			REQUIRE(bgraImage.Convert(Nz::PixelFormatType_DXT5));
+
+			Nz::Image rgbaImage(image);
+			REQUIRE(rgbaImage.Convert(Nz::PixelFormatType_DXT5));
+
+			THEN("We get the same blocks")
+			{
+				std::size_t size = Nz::PixelFormat::ComputeSize(Nz::PixelFormatType_DXT5, width, height, 1);
+				CHECK(std::equal(bgraImage.GetConstPixels(), bgraImage.GetConstPixels() + size, rgbaImage.GetConstPixels()));
+			}
+		}
+	}
+}
@@ -1,7 +1,10 @@
 #include <NDK/System.hpp>
 #include <NDK/Components/NodeComponent.hpp>
 #include <NDK/Components/VelocityComponent.hpp>
+#include <NDK/Systems/VelocitySystem.hpp>
 #include <NDK/World.hpp>
+#include <atomic>
+#include <unordered_map>
 #include <Catch/catch.hpp>
 
 namespace
@@ -26,6 +29,63 @@ namespace
 	};
 
 	Ndk::SystemIndex TestSystem::systemIndex;
+
+	class VelocityReaderSystem : public Ndk::System<VelocityReaderSystem>
+	{
+		public:
+			VelocityReaderSystem() :
+			updateCount(0)
+			{
+				Requires<Ndk::VelocityComponent>();
+				Reads<Ndk::VelocityComponent>();
+			}
+
+			~VelocityReaderSystem() = default;
+
+			std::atomic_uint updateCount;
+
+			static Ndk::SystemIndex systemIndex;
+
+		private:
+			void OnUpdate(float /*elapsedTime*/) override
+			{
+				updateCount++;
+			}
+	};
+
+	Ndk::SystemIndex VelocityReaderSystem::systemIndex;
+
+	class BucketSystem : public Ndk::System<BucketSystem>
+	{
+		public:
+			BucketSystem() :
+			iterationCount(0)
+			{
+				Requires<Ndk::VelocityComponent>();
+				SetMaximumUpdateRate(0);
+			}
+
+			~BucketSystem() = default;
+
+			std::size_t iterationCount;
+			std::unordered_map<Ndk::EntityId, float> elapsedTimes;
+			std::unordered_map<Ndk::EntityId, std::size_t> iterationCounts;
+
+			static Ndk::SystemIndex systemIndex;
+
+		private:
+			void OnUpdate(float elapsedTime) override
+			{
+				ForEachDueEntity(elapsedTime, [&](const Ndk::EntityHandle& entity, float entityElapsedTime)
+				{
+					elapsedTimes[entity->GetId()] += entityElapsedTime;
+					iterationCounts[entity->GetId()]++;
+					iterationCount++;
+				});
+			}
+	};
+
+	Ndk::SystemIndex BucketSystem::systemIndex;
 }
 
 SCENARIO("BaseSystem", "[NDK][BASESYSTEM]")
@@ -62,4 +122,108 @@ SCENARIO("BaseSystem", "[NDK][BASESYSTEM]")
 			}
 		}
 	}
-}
\ No newline at end of file
+
+	GIVEN("Systems declaring their component access")
+	{
+		Ndk::World world(false);
+
+		Ndk::BaseSystem& readerSystem = world.AddSystem<VelocityReaderSystem>();
+		Ndk::BaseSystem& velocitySystem = world.AddSystem<Ndk::VelocitySystem>();
+		TestSystem testSystem;
+
+		THEN("Conflicts only come from writes or undeclared access")
+		{
+			CHECK(readerSystem.HasDeclaredComponentAccess());
+			CHECK(!testSystem.HasDeclaredComponentAccess());
+
+			CHECK(!readerSystem.ConflictsWith(velocitySystem));
+			CHECK(!velocitySystem.ConflictsWith(readerSystem));
+			CHECK(testSystem.ConflictsWith(readerSystem));
+			CHECK(velocitySystem.ConflictsWith(velocitySystem));
+		}
+
+		WHEN("We update them in parallel")
+		{
+			Ndk::EntityHandle entity = world.CreateEntity();
+			Ndk::NodeComponent& node = entity->AddComponent<Ndk::NodeComponent>();
+			entity->AddComponent<Ndk::VelocityComponent>(Nz::Vector3f::UnitX());
+
+			world.EnableParallelUpdate();
+			world.Update(1.f);
+			world.Update(1.f);
+
+			THEN("Every system got updated")
+			{
+				CHECK(static_cast<VelocityReaderSystem&>(readerSystem).updateCount == 2);
+				CHECK(node.GetPosition().SquaredDistance(Nz::Vector3f::UnitX() * 2.f) < 0.01f);
+			}
+		}
+	}
+
+	GIVEN("A system with entities ticked every few updates")
+	{
+		Ndk::World world(false);
+
+		BucketSystem& system = world.AddSystem<BucketSystem>();
+
+		std::vector<Ndk::EntityHandle> distantEntities;
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			Ndk::EntityHandle entity = world.CreateEntity();
+			entity->AddComponent<Ndk::VelocityComponent>();
+			distantEntities.push_back(entity);
+		}
+
+		Ndk::EntityHandle nearEntity = world.CreateEntity();
+		nearEntity->AddComponent<Ndk::VelocityComponent>();
+
+		world.Update(0.f);
+		system.iterationCount = 0;
+		system.iterationCounts.clear();
+
+		for (const Ndk::EntityHandle& entity : distantEntities)
+			system.SetEntityUpdateInterval(entity, 4);
+
+		CHECK(system.GetEntityUpdateInterval(distantEntities[0]) == 4);
+		CHECK(system.GetEntityUpdateInterval(nearEntity) == 1);
+
+		WHEN("We update it")
+		{
+			std::vector<std::size_t> iterationCounts;
+			for (std::size_t i = 0; i < 8; ++i)
+			{
+				std::size_t previousCount = system.iterationCount;
+				world.Update(0.25f);
+				iterationCounts.push_back(system.iterationCount - previousCount);
+			}
+
+			THEN("Distant entities are spread evenly between the updates and get the time elapsed since their last iteration")
+			{
+				for (std::size_t count : iterationCounts)
+					CHECK(count == 2);
+
+				// Each bucket is a quarter of the interval behind the previous one, the time since their last iteration is still pending
+				float distantElapsedTime = 0.f;
+				for (const Ndk::EntityHandle& entity : distantEntities)
+				{
+					CHECK(system.iterationCounts[entity->GetId()] == 2);
+					distantElapsedTime += system.elapsedTimes[entity->GetId()];
+				}
+
+				CHECK(distantElapsedTime == Approx(2.f + 1.75f + 1.5f + 1.25f));
+				CHECK(system.elapsedTimes[nearEntity->GetId()] == Approx(2.f));
+			}
+		}
+
+		WHEN("An entity leaves the system")
+		{
+			distantEntities[0]->RemoveComponent<Ndk::VelocityComponent>();
+			world.Update(0.f);
+
+			THEN("Its interval is forgotten")
+			{
+				CHECK(system.GetEntityUpdateInterval(distantEntities[0]) == 1);
+			}
+		}
+	}
+}
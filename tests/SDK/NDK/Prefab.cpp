@@ -0,0 +1,67 @@
+#include <NDK/Prefab.hpp>
+#include <NDK/World.hpp>
+#include <NDK/Components/NodeComponent.hpp>
+#include <NDK/Components/VelocityComponent.hpp>
+#include <NDK/Systems/VelocitySystem.hpp>
+#include <Catch/catch.hpp>
+
+SCENARIO("Prefab", "[NDK][PREFAB]")
+{
+	GIVEN("A world with the velocity system and a moving prefab")
+	{
+		Ndk::World world(false);
+		Ndk::VelocitySystem& velocitySystem = world.AddSystem<Ndk::VelocitySystem>();
+
+		Ndk::Prefab prefab;
+		prefab.AddComponent<Ndk::NodeComponent>();
+		prefab.AddComponent<Ndk::VelocityComponent>().linearVelocity = Nz::Vector3f::UnitX();
+
+		REQUIRE(prefab.HasComponent<Ndk::NodeComponent>());
+		REQUIRE(prefab.HasComponent<Ndk::VelocityComponent>());
+
+		WHEN("We instantiate it a hundred times")
+		{
+			Ndk::World::EntityVector entities = world.Instantiate(prefab, 100);
+			world.Update(1.f);
+
+			THEN("Every instance has its own components and belongs to the system")
+			{
+				CHECK(velocitySystem.GetEntities().size() == 100);
+
+				for (const Ndk::EntityHandle& entity : entities)
+				{
+					REQUIRE(entity->HasComponent<Ndk::VelocityComponent>());
+					CHECK(&entity->GetComponent<Ndk::VelocityComponent>() != &prefab.GetComponent<Ndk::VelocityComponent>());
+					CHECK(entity->GetComponent<Ndk::NodeComponent>().GetPosition() == Nz::Vector3f::UnitX());
+				}
+			}
+		}
+
+		WHEN("An instance loses a component before the refresh")
+		{
+			Ndk::EntityHandle entity = world.Instantiate(prefab);
+			Ndk::EntityHandle other = world.Instantiate(prefab);
+			entity->RemoveComponent<Ndk::VelocityComponent>();
+
+			world.Refresh();
+
+			THEN("It is filtered on its own")
+			{
+				CHECK_FALSE(velocitySystem.HasEntity(entity));
+				CHECK(velocitySystem.HasEntity(other));
+			}
+		}
+
+		WHEN("We build a prefab from an instance")
+		{
+			const Ndk::EntityHandle& entity = world.Instantiate(prefab);
+			Ndk::Prefab copy = Ndk::Prefab::FromEntity(*entity);
+
+			THEN("It has the same components")
+			{
+				CHECK(copy.GetComponentBits() == prefab.GetComponentBits());
+				CHECK(copy.GetComponent<Ndk::VelocityComponent>().linearVelocity == Nz::Vector3f::UnitX());
+			}
+		}
+	}
+}
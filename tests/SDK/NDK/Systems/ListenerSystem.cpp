@@ -2,6 +2,7 @@
 #include <NDK/World.hpp>
 #include <NDK/Components/ListenerComponent.hpp>
 #include <NDK/Components/NodeComponent.hpp>
+#include <NDK/Components/SoundEmitterComponent.hpp>
 #include <NDK/Components/VelocityComponent.hpp>
 #include <Nazara/Audio/Audio.hpp>
 #include <Catch/catch.hpp>
@@ -40,4 +41,50 @@ SCENARIO("ListenerSystem", "[NDK][LISTENERSYSTEM]")
 			}
 		}
 	}
-}
\ No newline at end of file
+
+	GIVEN("A world with a listener and sound emitters")
+	{
+		Ndk::World world;
+		Ndk::EntityHandle listener = world.CreateEntity();
+		listener->AddComponent<Ndk::ListenerComponent>();
+		listener->AddComponent<Ndk::NodeComponent>();
+
+		Ndk::EntityHandle nearEntity = world.CreateEntity();
+		Ndk::SoundEmitterComponent& nearEmitter = nearEntity->AddComponent<Ndk::SoundEmitterComponent>();
+		Ndk::NodeComponent& nearNode = nearEntity->AddComponent<Ndk::NodeComponent>();
+		nearEmitter.SetAudibleDistance(10.f);
+
+		Ndk::EntityHandle farEntity = world.CreateEntity();
+		Ndk::SoundEmitterComponent& farEmitter = farEntity->AddComponent<Ndk::SoundEmitterComponent>();
+		Ndk::NodeComponent& farNode = farEntity->AddComponent<Ndk::NodeComponent>();
+		farEmitter.SetAudibleDistance(10.f);
+
+		world.Update(1.f);
+
+		WHEN("We move the emitters")
+		{
+			nearNode.SetPosition(Nz::Vector3f::UnitX() * 2.f);
+			farNode.SetPosition(Nz::Vector3f::UnitX() * 20.f);
+			world.Update(1.f);
+
+			THEN("Emitters in range follow their entity")
+			{
+				CHECK_FALSE(nearEmitter.IsCulled());
+				CHECK(nearEmitter.GetPosition() == Nz::Vector3f::UnitX() * 2.f);
+				CHECK(nearEmitter.GetVelocity() == Nz::Vector3f::UnitX() * 2.f);
+			}
+
+			AND_THEN("Emitters out of range are left where they got out of it")
+			{
+				CHECK(farEmitter.IsCulled());
+				CHECK(farEmitter.GetPosition() == Nz::Vector3f::UnitX() * 20.f);
+				CHECK(farEmitter.GetVelocity() == Nz::Vector3f::Zero());
+
+				farNode.SetPosition(Nz::Vector3f::UnitX() * 30.f);
+				world.Update(1.f);
+
+				CHECK(farEmitter.GetPosition() == Nz::Vector3f::UnitX() * 20.f);
+			}
+		}
+	}
+}
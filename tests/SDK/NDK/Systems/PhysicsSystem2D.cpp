@@ -143,6 +143,32 @@ SCENARIO("PhysicsSystem2D", "[NDK][PHYSICSSYSTEM2D]")
 			}
 		}
 	}
+
+	GIVEN("A world and a static entity")
+	{
+		Ndk::World world;
+
+		Ndk::EntityHandle wallEntity = CreateBaseEntity(world, Nz::Vector2f::Zero(), Nz::Rectf(0.f, 0.f, 1.f, 1.f));
+		Ndk::CollisionComponent2D& collisionComponent = wallEntity->GetComponent<Ndk::CollisionComponent2D>();
+		Ndk::NodeComponent& nodeComponent = wallEntity->GetComponent<Ndk::NodeComponent>();
+
+		world.GetSystem<Ndk::PhysicsSystem2D>().SetMaximumUpdateRate(0.f);
+		world.Update(1.f);
+
+		WHEN("We move its node")
+		{
+			nodeComponent.SetPosition(Nz::Vector2f(5.f, 0.f));
+			for (unsigned int i = 0; i < 10; ++i)
+				world.Update(1.f);
+
+			THEN("Its body should have followed")
+			{
+				Nz::Rectf wallAABB = collisionComponent.GetAABB();
+				CHECK(wallAABB.GetPosition().Distance(Nz::Vector2f(5.f, 0.f)) < 0.01f);
+				CHECK(wallAABB.GetLengths() == Nz::Vector2f(1.f, 1.f));
+			}
+		}
+	}
 }
 
 Ndk::EntityHandle CreateBaseEntity(Ndk::World& world, const Nz::Vector2f& position, const Nz::Rectf AABB)
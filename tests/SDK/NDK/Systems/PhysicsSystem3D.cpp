@@ -4,6 +4,7 @@
 #include <NDK/Components/NodeComponent.hpp>
 #include <NDK/Components/PhysicsComponent3D.hpp>
 #include <Catch/catch.hpp>
+#include <array>
 
 SCENARIO("PhysicsSystem3D", "[NDK][PHYSICSSYSTEM3D]")
 {
@@ -31,4 +32,96 @@ SCENARIO("PhysicsSystem3D", "[NDK][PHYSICSSYSTEM3D]")
 			}
 		}
 	}
-}
\ No newline at end of file
+
+	GIVEN("A world whose physics is stepped by several threads")
+	{
+		Ndk::World world;
+		Nz::PhysWorld3D& physWorld = world.GetSystem<Ndk::PhysicsSystem3D>().GetWorld();
+		physWorld.SetGravity(-Nz::Vector3f::UnitY());
+		physWorld.SetThreadCount(2);
+
+		std::vector<Ndk::EntityHandle> entities;
+		for (unsigned int i = 0; i < 10; ++i)
+		{
+			const Ndk::EntityHandle& entity = world.CreateEntity();
+			entity->AddComponent<Ndk::NodeComponent>().SetPosition(Nz::Vector3f(i * 2.f, 0.f, 0.f));
+			entity->AddComponent<Ndk::PhysicsComponent3D>().SetMass(1.f);
+
+			entities.push_back(entity);
+		}
+
+		WHEN("We update the world")
+		{
+			world.Update(1.f);
+
+			THEN("Every body fell and its node was updated with its own transform")
+			{
+				CHECK(physWorld.GetThreadCount() >= 1);
+
+				for (unsigned int i = 0; i < entities.size(); ++i)
+				{
+					Ndk::NodeComponent& node = entities[i]->GetComponent<Ndk::NodeComponent>();
+					Ndk::PhysicsComponent3D& physics = entities[i]->GetComponent<Ndk::PhysicsComponent3D>();
+
+					CHECK(node.GetPosition().y < 0.f);
+					CHECK(node.GetPosition().x == Approx(i * 2.f));
+					CHECK(node.GetPosition().SquaredDistance(physics.GetPosition()) < 0.0001f);
+				}
+			}
+		}
+	}
+
+	GIVEN("A world and two static boxes")
+	{
+		Ndk::World world;
+		Nz::PhysWorld3D& physWorld = world.GetSystem<Ndk::PhysicsSystem3D>().GetWorld();
+		physWorld.SetThreadCount(2);
+
+		for (float x : { 0.f, 5.f })
+		{
+			const Ndk::EntityHandle& entity = world.CreateEntity();
+			entity->AddComponent<Ndk::NodeComponent>().SetPosition(Nz::Vector3f(x, 0.f, 0.f));
+			entity->AddComponent<Ndk::CollisionComponent3D>(Nz::BoxCollider3D::New(Nz::Vector3f::Unit()));
+		}
+
+		world.Update(1.f);
+
+		WHEN("We cast several rays at once")
+		{
+			std::array<Nz::Vector3f, 3> startPositions = { Nz::Vector3f(0.f, 10.f, 0.f), Nz::Vector3f(5.f, 10.f, 0.f), Nz::Vector3f(20.f, 10.f, 0.f) };
+			std::array<Nz::Vector3f, 3> endPositions = { Nz::Vector3f(0.f, -10.f, 0.f), Nz::Vector3f(5.f, -10.f, 0.f), Nz::Vector3f(20.f, -10.f, 0.f) };
+			std::array<Nz::PhysWorld3D::RaycastHit, 3> results;
+
+			REQUIRE(physWorld.RaycastQueryFirst(startPositions.data(), endPositions.data(), startPositions.size(), results.data()) == 2);
+
+			THEN("Each ray should stop on the top of its box")
+			{
+				for (std::size_t i = 0; i < 2; ++i)
+				{
+					CHECK(results[i].body != nullptr);
+					CHECK(results[i].fraction == Approx(0.475f).margin(0.01f));
+					CHECK(results[i].hitPosition.SquaredDistance(Nz::Vector3f(i * 5.f, 0.5f, 0.f)) < 0.01f);
+					CHECK(results[i].hitNormal.SquaredDistance(Nz::Vector3f::UnitY()) < 0.01f);
+				}
+
+				CHECK(results[2].body == nullptr);
+			}
+		}
+
+		WHEN("We cast a sphere on the boxes")
+		{
+			std::array<Nz::Matrix4f, 2> startMatrices = { Nz::Matrix4f::Translate(Nz::Vector3f(5.f, 10.f, 0.f)), Nz::Matrix4f::Translate(Nz::Vector3f(20.f, 10.f, 0.f)) };
+			std::array<Nz::Vector3f, 2> endPositions = { Nz::Vector3f(5.f, -10.f, 0.f), Nz::Vector3f(20.f, -10.f, 0.f) };
+			std::array<Nz::PhysWorld3D::RaycastHit, 2> results;
+
+			REQUIRE(physWorld.ConvexCastQueryFirst(*Nz::SphereCollider3D::New(0.5f), startMatrices.data(), endPositions.data(), startMatrices.size(), results.data()) == 1);
+
+			THEN("It should stop when touching the second box")
+			{
+				CHECK(results[0].body != nullptr);
+				CHECK(results[0].fraction == Approx(0.45f).margin(0.01f));
+				CHECK(results[1].body == nullptr);
+			}
+		}
+	}
+}
@@ -0,0 +1,188 @@
+#include <NDK/Systems/ReplicationSystem.hpp>
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Network/ENetHost.hpp>
+#include <NDK/World.hpp>
+#include <NDK/Components/NodeComponent.hpp>
+#include <NDK/Components/VelocityComponent.hpp>
+#include <Catch/catch.hpp>
+#include <random>
+#include <vector>
+
+SCENARIO("ReplicationSystem", "[NDK][REPLICATIONSYSTEM]")
+{
+	GIVEN("A server world replicated to a client world through ENet")
+	{
+		std::random_device rd;
+		std::uniform_int_distribution<Nz::UInt16> dis(1025, 65535);
+
+		Nz::UInt16 port = dis(rd);
+
+		Nz::ENetHost server;
+		REQUIRE(server.Create(Nz::NetProtocol_IPv4, port, 1));
+
+		Nz::ENetHost client;
+		REQUIRE(client.Create(Nz::NetProtocol_IPv4, 0, 1));
+		REQUIRE(client.Connect(Nz::IpAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), port)));
+
+		Ndk::World serverWorld(false);
+		Ndk::ReplicationSystem& serverReplication = serverWorld.AddSystem<Ndk::ReplicationSystem>();
+
+		Ndk::World clientWorld(false);
+		Ndk::ReplicationSystem& clientReplication = clientWorld.AddSystem<Ndk::ReplicationSystem>();
+
+		Nz::ENetPeer* clientPeer = nullptr;
+		bool connected = false;
+
+		Nz::UInt64 startTime = Nz::GetElapsedMilliseconds();
+		while ((!clientPeer || !connected) && Nz::GetElapsedMilliseconds() - startTime < 2000)
+		{
+			Nz::ENetEvent event;
+			if (server.Service(&event, 5) > 0 && event.type == Nz::ENetEventType::IncomingConnect)
+				clientPeer = event.peer;
+
+			if (client.Service(&event, 5) > 0 && event.type == Nz::ENetEventType::OutgoingConnect)
+				connected = true;
+		}
+
+		REQUIRE(clientPeer);
+		REQUIRE(connected);
+
+		serverReplication.AddClient(clientPeer);
+		CHECK(serverReplication.HasClient(clientPeer));
+
+		std::vector<Ndk::EntityHandle> entities;
+		for (unsigned int i = 0; i < 10; ++i)
+		{
+			const Ndk::EntityHandle& entity = serverWorld.CreateEntity();
+			entity->AddComponent<Ndk::NodeComponent>().SetPosition(Nz::Vector3f(i * 100.f, 0.f, 0.f));
+
+			entities.emplace_back(entity);
+		}
+
+		// Updates the server world and applies the snapshot it sends to the client world
+		auto Replicate = [&]()
+		{
+			serverWorld.Update(1.f);
+
+			Nz::UInt64 replicationStart = Nz::GetElapsedMilliseconds();
+			while (Nz::GetElapsedMilliseconds() - replicationStart < 2000)
+			{
+				Nz::ENetEvent event;
+				server.Service(&event, 1);
+
+				if (client.Service(&event, 5) > 0 && event.type == Nz::ENetEventType::Receive)
+				{
+					bool applied = clientReplication.ApplySnapshot(event.packet->data);
+					clientWorld.Refresh();
+
+					return applied;
+				}
+			}
+
+			return false;
+		};
+
+		auto CountReplicatedEntities = [&]()
+		{
+			std::size_t count = 0;
+			for (const Ndk::EntityHandle& entity : entities)
+			{
+				if (entity && clientReplication.GetReplicatedEntity(entity->GetId()))
+					count++;
+			}
+
+			return count;
+		};
+
+		WHEN("The client sees every entity")
+		{
+			REQUIRE(Replicate());
+
+			THEN("Every entity is created on the client, with its components")
+			{
+				REQUIRE(CountReplicatedEntities() == entities.size());
+
+				const Ndk::EntityHandle& replicated = clientReplication.GetReplicatedEntity(entities[3]->GetId());
+				REQUIRE(replicated->HasComponent<Ndk::NodeComponent>());
+				CHECK(replicated->GetComponent<Ndk::NodeComponent>().GetPosition() == Nz::Vector3f(300.f, 0.f, 0.f));
+			}
+
+			AND_WHEN("Entities change on the server")
+			{
+				Ndk::EntityHandle replicated = clientReplication.GetReplicatedEntity(entities[3]->GetId());
+				Ndk::NodeComponent& replicatedNode = replicated->GetComponent<Ndk::NodeComponent>();
+
+				entities[3]->GetComponent<Ndk::NodeComponent>().SetPosition(Nz::Vector3f(300.f, 5.f, 0.f));
+				entities[4]->AddComponent<Ndk::VelocityComponent>(Nz::Vector3f::UnitZ());
+
+				Ndk::EntityId killedId = entities[5]->GetId();
+				entities[5]->Kill();
+
+				REQUIRE(Replicate());
+
+				THEN("The client updates its existing entities and despawns killed ones")
+				{
+					CHECK(clientReplication.GetReplicatedEntity(entities[3]->GetId()) == replicated);
+					CHECK(&replicated->GetComponent<Ndk::NodeComponent>() == &replicatedNode);
+					CHECK(replicatedNode.GetPosition() == Nz::Vector3f(300.f, 5.f, 0.f));
+
+					const Ndk::EntityHandle& withVelocity = clientReplication.GetReplicatedEntity(entities[4]->GetId());
+					REQUIRE(withVelocity->HasComponent<Ndk::VelocityComponent>());
+					CHECK(withVelocity->GetComponent<Ndk::VelocityComponent>().linearVelocity == Nz::Vector3f::UnitZ());
+
+					CHECK_FALSE(clientReplication.GetReplicatedEntity(killedId));
+				}
+			}
+		}
+
+		WHEN("The client only sees entities around its viewpoint")
+		{
+			serverReplication.SetClientViewpoint(clientPeer, Nz::Vector3f::Zero(), 250.f);
+			REQUIRE(serverWorld.HasSystem<Ndk::SpatialSystem>());
+			serverWorld.GetSystem<Ndk::SpatialSystem>().SetCellSize(50.f);
+
+			REQUIRE(Replicate());
+
+			THEN("Only entities within the radius are replicated")
+			{
+				CHECK(CountReplicatedEntities() == 3);
+				CHECK(clientReplication.GetReplicatedEntity(entities[2]->GetId()));
+				CHECK_FALSE(clientReplication.GetReplicatedEntity(entities[3]->GetId()));
+			}
+
+			AND_WHEN("The viewpoint moves away")
+			{
+				serverReplication.SetClientViewpoint(clientPeer, Nz::Vector3f(900.f, 0.f, 0.f), 150.f);
+				REQUIRE(Replicate());
+
+				THEN("Entities leaving the view are despawned and entering ones are spawned")
+				{
+					CHECK(CountReplicatedEntities() == 2);
+					CHECK_FALSE(clientReplication.GetReplicatedEntity(entities[0]->GetId()));
+					CHECK(clientReplication.GetReplicatedEntity(entities[8]->GetId()));
+					CHECK(clientReplication.GetReplicatedEntity(entities[9]->GetId()));
+				}
+			}
+		}
+
+		WHEN("The client bandwidth is limited")
+		{
+			serverReplication.SetClientViewpoint(clientPeer, Nz::Vector3f::Zero(), 1000.f);
+			serverReplication.SetClientBandwidth(clientPeer, 100);
+			REQUIRE(Replicate());
+
+			THEN("Entities are spread among snapshots, nearest first")
+			{
+				std::size_t firstCount = CountReplicatedEntities();
+				CHECK(firstCount > 0);
+				CHECK(firstCount < entities.size());
+				CHECK(clientReplication.GetReplicatedEntity(entities[0]->GetId()));
+
+				for (std::size_t i = 0; i < entities.size() && CountReplicatedEntities() < entities.size(); ++i)
+					REQUIRE(Replicate());
+
+				CHECK(CountReplicatedEntities() == entities.size());
+			}
+		}
+	}
+}
@@ -0,0 +1,113 @@
+#include <NDK/Systems/SpatialSystem.hpp>
+#include <NDK/World.hpp>
+#include <NDK/Components/NodeComponent.hpp>
+#include <Catch/catch.hpp>
+#include <vector>
+
+SCENARIO("SpatialSystem", "[NDK][SPATIALSYSTEM]")
+{
+	GIVEN("A world with a line of entities")
+	{
+		Ndk::World world(false);
+		Ndk::SpatialSystem& spatialSystem = world.AddSystem<Ndk::SpatialSystem>();
+		spatialSystem.SetCellSize(10.f);
+
+		std::vector<Ndk::EntityHandle> entities;
+		for (unsigned int i = 0; i < 20; ++i)
+		{
+			const Ndk::EntityHandle& entity = world.CreateEntity();
+			entity->AddComponent<Ndk::NodeComponent>().SetPosition(Nz::Vector3f(i * 5.f, 0.f, 0.f));
+
+			entities.emplace_back(entity);
+		}
+
+		world.Update(1.f);
+
+		auto CountInRadius = [&](const Nz::Vector3f& center, float radius)
+		{
+			std::size_t count = 0;
+			spatialSystem.ForEachEntityInRadius(center, radius, [&](const Ndk::EntityHandle& /*entity*/) { count++; });
+
+			return count;
+		};
+
+		WHEN("We query entities around a point")
+		{
+			THEN("Only entities within the radius or the box are found")
+			{
+				CHECK(CountInRadius(Nz::Vector3f::Zero(), 12.f) == 3);
+				CHECK(CountInRadius(Nz::Vector3f(50.f, 0.f, 0.f), 5.f) == 3);
+				CHECK(CountInRadius(Nz::Vector3f(0.f, 100.f, 0.f), 10.f) == 0);
+
+				std::vector<Ndk::EntityId> found;
+				spatialSystem.ForEachEntityInBox(Nz::Boxf(18.f, -1.f, -1.f, 10.f, 2.f, 2.f), [&](const Ndk::EntityHandle& entity) { found.push_back(entity->GetId()); });
+
+				REQUIRE(found.size() == 2);
+				CHECK(std::find(found.begin(), found.end(), entities[4]->GetId()) != found.end());
+				CHECK(std::find(found.begin(), found.end(), entities[5]->GetId()) != found.end());
+			}
+		}
+
+		WHEN("An entity moves")
+		{
+			entities[0]->GetComponent<Ndk::NodeComponent>().SetPosition(Nz::Vector3f(0.f, 100.f, 0.f));
+			world.Update(1.f);
+
+			THEN("It is found at its new position only")
+			{
+				CHECK(CountInRadius(Nz::Vector3f::Zero(), 1.f) == 0);
+				CHECK(CountInRadius(Nz::Vector3f(0.f, 100.f, 0.f), 1.f) == 1);
+			}
+		}
+
+		WHEN("An observer watches part of the line")
+		{
+			std::vector<Ndk::EntityId> entered;
+			std::vector<Ndk::EntityId> left;
+
+			NazaraSlot(Ndk::SpatialSystem, OnEntityEntered, enteredSlot);
+			enteredSlot.Connect(spatialSystem.OnEntityEntered, [&](Ndk::SpatialSystem*, std::size_t, Ndk::Entity* entity) { entered.push_back(entity->GetId()); });
+
+			NazaraSlot(Ndk::SpatialSystem, OnEntityLeft, leftSlot);
+			leftSlot.Connect(spatialSystem.OnEntityLeft, [&](Ndk::SpatialSystem*, std::size_t, Ndk::Entity* entity) { left.push_back(entity->GetId()); });
+
+			std::size_t observerId = spatialSystem.AddObserver(Nz::Vector3f::Zero(), 12.f);
+			world.Update(1.f);
+
+			THEN("Entities within its radius entered its view")
+			{
+				CHECK(entered.size() == 3);
+				CHECK(left.empty());
+				CHECK(spatialSystem.GetObservedEntities(observerId).size() == 3);
+				CHECK(spatialSystem.GetObservedEntities(observerId).Has(entities[2]));
+			}
+
+			AND_WHEN("The observer moves and an entity is killed")
+			{
+				entered.clear();
+
+				spatialSystem.SetObserverPosition(observerId, Nz::Vector3f(20.f, 0.f, 0.f));
+				entities[3]->Kill();
+				world.Update(1.f);
+
+				THEN("Entities leaving its radius left its view, and new ones entered it")
+				{
+					REQUIRE(left.size() == 2);
+					CHECK(std::find(left.begin(), left.end(), entities[0]->GetId()) != left.end());
+					CHECK(entered.size() == 3);
+					CHECK(spatialSystem.GetObservedEntities(observerId).size() == 4);
+				}
+			}
+
+			AND_WHEN("The observer is removed")
+			{
+				spatialSystem.RemoveObserver(observerId);
+
+				THEN("It isn't valid anymore")
+				{
+					CHECK_FALSE(spatialSystem.IsObserverValid(observerId));
+				}
+			}
+		}
+	}
+}
@@ -3,6 +3,7 @@
 #include <NDK/Components/NodeComponent.hpp>
 #include <NDK/Components/VelocityComponent.hpp>
 #include <Catch/catch.hpp>
+#include <vector>
 
 SCENARIO("VelocitySystem", "[NDK][VELOCITYSYSTEM]")
 {
@@ -27,4 +28,40 @@ SCENARIO("VelocitySystem", "[NDK][VELOCITYSYSTEM]")
 			}
 		}
 	}
-}
\ No newline at end of file
+
+	GIVEN("A world with many moving entities")
+	{
+		Ndk::World world;
+
+		std::vector<Ndk::EntityHandle> entities;
+		for (std::size_t i = 0; i < 1000; ++i)
+		{
+			const Ndk::EntityHandle& entity = world.CreateEntity();
+			entity->AddComponent<Ndk::NodeComponent>();
+			entity->AddComponent<Ndk::VelocityComponent>(Nz::Vector3f::UnitY());
+
+			entities.emplace_back(entity);
+		}
+
+		WHEN("We split their iteration among workers")
+		{
+			Ndk::VelocitySystem& velocitySystem = world.GetSystem<Ndk::VelocitySystem>();
+			velocitySystem.EnableParallelIteration();
+			REQUIRE(velocitySystem.IsParallelIterationEnabled());
+
+			world.Update(1.f);
+
+			THEN("Every entity should have moved")
+			{
+				std::size_t movedCount = 0;
+				for (const Ndk::EntityHandle& entity : entities)
+				{
+					if (entity->GetComponent<Ndk::NodeComponent>().GetPosition().SquaredDistance(Nz::Vector3f::UnitY()) < 0.01f)
+						movedCount++;
+				}
+
+				REQUIRE(movedCount == entities.size());
+			}
+		}
+	}
+}
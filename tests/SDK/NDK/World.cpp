@@ -1,6 +1,12 @@
 #include <NDK/World.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/MemoryStream.hpp>
 #include <NDK/Component.hpp>
+#include <NDK/Components/NodeComponent.hpp>
+#include <NDK/Components/VelocityComponent.hpp>
+#include <NDK/Systems/VelocitySystem.hpp>
 #include <Catch/catch.hpp>
+#include <vector>
 
 namespace
 {
@@ -49,6 +55,68 @@ namespace
 	};
 
 	Ndk::SystemIndex UpdateSystem::systemIndex;
+
+	template<bool FixedStep>
+	class CountingSystem : public Ndk::System<CountingSystem<FixedStep>>
+	{
+		public:
+			CountingSystem()
+			{
+				this->EnableFixedStep(FixedStep);
+				this->SetMaximumUpdateRate(0.f);
+			}
+
+			unsigned int updateCount = 0;
+			float lastElapsedTime = 0.f;
+
+			static Ndk::SystemIndex systemIndex;
+
+		private:
+			void OnUpdate(float elapsedTime) override
+			{
+				lastElapsedTime = elapsedTime;
+				updateCount++;
+			}
+	};
+
+	template<bool FixedStep> Ndk::SystemIndex CountingSystem<FixedStep>::systemIndex;
+
+	class BatchSystem : public Ndk::System<BatchSystem>
+	{
+		public:
+			BatchSystem()
+			{
+				Requires<UpdatableComponent>();
+			}
+
+			std::vector<std::size_t> addedBatches;
+			std::vector<std::size_t> removedBatches;
+			std::size_t validationCount = 0;
+
+			static Ndk::SystemIndex systemIndex;
+
+		private:
+			void OnEntitiesAdded(const std::vector<Ndk::Entity*>& entities) override
+			{
+				addedBatches.push_back(entities.size());
+			}
+
+			void OnEntitiesRemoved(const std::vector<Ndk::Entity*>& entities) override
+			{
+				removedBatches.push_back(entities.size());
+			}
+
+			void OnEntityValidation(Ndk::Entity* /*entity*/, bool /*justAdded*/) override
+			{
+				validationCount++;
+			}
+
+			void OnUpdate(float /*elapsedTime*/) override
+			{
+			}
+	};
+
+	Ndk::SystemIndex BatchSystem::systemIndex;
 }
 
 SCENARIO("World", "[NDK][WORLD]")
@@ -99,5 +167,376 @@ SCENARIO("World", "[NDK][WORLD]")
 				REQUIRE(!world.IsEntityValid(entity));
 			}
 		}
+
+		AND_WHEN("We view entities by their components")
+		{
+			Ndk::World::EntityVector entities = world.CreateEntities(4);
+			for (const Ndk::EntityHandle& entity : entities)
+				entity->AddComponent<Ndk::NodeComponent>();
+
+			entities[1]->AddComponent<Ndk::VelocityComponent>();
+
+			auto countViewed = [&]()
+			{
+				std::size_t count = 0;
+				world.View<Ndk::NodeComponent, Ndk::VelocityComponent>().ForEach([&](Ndk::EntityId id, Ndk::NodeComponent& node, Ndk::VelocityComponent& velocity)
+				{
+					REQUIRE(&world.GetEntity(id)->GetComponent<Ndk::NodeComponent>() == &node);
+					REQUIRE(&world.GetEntity(id)->GetComponent<Ndk::VelocityComponent>() == &velocity);
+					count++;
+				});
+
+				return count;
+			};
+
+			THEN("Only entities owning every component are iterated")
+			{
+				REQUIRE(countViewed() == 1);
+			}
+
+			THEN("The view follows component changes")
+			{
+				REQUIRE(countViewed() == 1);
+
+				entities[2]->AddComponent<Ndk::VelocityComponent>();
+				entities[3]->AddComponent<Ndk::VelocityComponent>();
+				REQUIRE(countViewed() == 3);
+
+				entities[1]->RemoveComponent<Ndk::VelocityComponent>();
+				world.KillEntity(entities[2]);
+				world.Refresh();
+				REQUIRE(countViewed() == 1);
+			}
+		}
+	}
+
+	GIVEN("A world and a wave of entities")
+	{
+		Ndk::World world(false);
+
+		Ndk::World::EntityVector wave = world.CreateEntities(100);
+		REQUIRE(wave.size() == 100);
+
+		WHEN("We kill half of them and spawn a bigger wave")
+		{
+			Ndk::World::EntityVector killed(wave.begin(), wave.begin() + 50);
+			world.KillEntities(killed);
+			world.Refresh();
+
+			Ndk::World::EntityVector newWave = world.CreateEntities(200);
+			world.Refresh();
+
+			THEN("Identifiers are reused and every entity is valid")
+			{
+				REQUIRE(newWave.size() == 200);
+
+				std::vector<bool> usedIds(250, false);
+				for (const Ndk::EntityHandle& entity : newWave)
+				{
+					REQUIRE(world.IsEntityValid(entity));
+					REQUIRE(entity->GetId() < usedIds.size());
+					REQUIRE(!usedIds[entity->GetId()]);
+					usedIds[entity->GetId()] = true;
+				}
+
+				for (std::size_t i = 50; i < wave.size(); ++i)
+				{
+					REQUIRE(world.IsEntityValid(wave[i]));
+					REQUIRE(!usedIds[wave[i]->GetId()]);
+				}
+
+				REQUIRE(world.GetEntities().size() == 250);
+			}
+		}
+	}
+
+	GIVEN("A world with moving entities")
+	{
+		Ndk::World world(false);
+
+		Ndk::World::EntityVector entities = world.CreateEntities(10);
+		for (const Ndk::EntityHandle& entity : entities)
+		{
+			entity->AddComponent<Ndk::NodeComponent>();
+			entity->AddComponent<Ndk::VelocityComponent>();
+		}
+		world.Refresh();
+
+		auto countViewed = [&]()
+		{
+			std::size_t count = 0;
+			world.View<Ndk::NodeComponent, Ndk::VelocityComponent>().ForEach([&](Ndk::EntityId, Ndk::NodeComponent&, Ndk::VelocityComponent&)
+			{
+				++count;
+			});
+
+			return count;
+		};
+
+		REQUIRE(countViewed() == 10);
+
+		WHEN("We move its component sets to large pages")
+		{
+			world.EnableLargePageStorage();
+
+			THEN("Views still see every entity, including new ones")
+			{
+				CHECK(world.IsLargePageStorageEnabled());
+				CHECK(countViewed() == 10);
+
+				const Ndk::EntityHandle& entity = world.CreateEntity();
+				entity->AddComponent<Ndk::NodeComponent>();
+				entity->AddComponent<Ndk::VelocityComponent>();
+				world.Refresh();
+
+				CHECK(countViewed() == 11);
+			}
+		}
 	}
-}
\ No newline at end of file
+}
+
+SCENARIO("World batched refresh", "[NDK][WORLD]")
+{
+	GIVEN("A world with a system receiving its entities in batches")
+	{
+		static bool systemInitialized = (Ndk::InitializeSystem<BatchSystem>(), true);
+		NazaraUnused(systemInitialized);
+
+		Ndk::World world(false);
+		BatchSystem& system = world.AddSystem<BatchSystem>();
+
+		WHEN("We spawn entities with two different sets of components")
+		{
+			Ndk::World::EntityVector entities = world.CreateEntities(100);
+			for (std::size_t i = 0; i < 60; ++i)
+				entities[i]->AddComponent<UpdatableComponent>();
+
+			for (std::size_t i = 40; i < 80; ++i)
+				entities[i]->AddComponent<Ndk::NodeComponent>();
+
+			world.Refresh();
+
+			THEN("Matching entities are added in a single batch")
+			{
+				REQUIRE(system.addedBatches.size() == 1);
+				CHECK(system.addedBatches[0] == 60);
+				CHECK(system.validationCount == 60);
+				CHECK(system.GetEntities().size() == 60);
+			}
+
+			AND_WHEN("Some of them lose the component and others are disabled")
+			{
+				for (std::size_t i = 0; i < 30; ++i)
+					entities[i]->RemoveComponent<UpdatableComponent>();
+
+				for (std::size_t i = 30; i < 40; ++i)
+					entities[i]->Disable();
+
+				entities[50]->AddComponent<Ndk::VelocityComponent>();
+
+				world.Refresh();
+
+				THEN("They leave the system in a single batch and the others are validated again")
+				{
+					REQUIRE(system.removedBatches.size() == 1);
+					CHECK(system.removedBatches[0] == 40);
+					CHECK(system.addedBatches.size() == 1);
+					CHECK(system.validationCount == 61);
+					CHECK(system.GetEntities().size() == 20);
+				}
+			}
+		}
+	}
+}
+
+SCENARIO("World profiler", "[NDK][WORLD]")
+{
+	GIVEN("A world with its profiler enabled")
+	{
+		Ndk::World world(false);
+		world.EnableProfiler();
+
+		WHEN("GPU time is reported for a few sections")
+		{
+			world.AddProfilerGpuTime("Geometry", 100);
+			world.AddProfilerGpuTime("Lighting", 50);
+			world.AddProfilerGpuTime("Geometry", 20);
+
+			THEN("Time is accumulated per section")
+			{
+				const auto& gpuTime = world.GetProfilerData().gpuTime;
+				REQUIRE(gpuTime.size() == 2);
+				CHECK(gpuTime[0].first == "Geometry");
+				CHECK(gpuTime[0].second == 120);
+				CHECK(gpuTime[1].first == "Lighting");
+				CHECK(gpuTime[1].second == 50);
+			}
+
+			AND_THEN("Resetting the profiler clears the time but keeps the sections")
+			{
+				world.ResetProfiler();
+
+				const auto& gpuTime = world.GetProfilerData().gpuTime;
+				REQUIRE(gpuTime.size() == 2);
+				CHECK(gpuTime[0].second == 0);
+				CHECK(gpuTime[1].second == 0);
+			}
+		}
+
+		WHEN("The profiler is disabled")
+		{
+			world.DisableProfiler();
+			world.AddProfilerGpuTime("Geometry", 100);
+
+			THEN("Nothing is recorded")
+			{
+				CHECK(world.GetProfilerData().gpuTime.empty());
+			}
+		}
+	}
+
+}
+
+SCENARIO("World snapshot", "[NDK][WORLD]")
+{
+	GIVEN("A world with moving entities and an updatable one")
+	{
+		Ndk::World world(false);
+
+		Ndk::World::EntityVector entities = world.CreateEntities(100);
+		for (std::size_t i = 0; i < entities.size(); ++i)
+		{
+			Ndk::NodeComponent& node = entities[i]->AddComponent<Ndk::NodeComponent>();
+			node.SetPosition(float(i), 0.f, 0.f);
+
+			if (i % 2 == 0)
+				entities[i]->AddComponent<Ndk::VelocityComponent>(Nz::Vector3f::UnitY() * float(i));
+		}
+		entities[3]->Disable();
+
+		// Updatable components have no serializer
+		entities[4]->AddComponent<UpdatableComponent>();
+
+		world.KillEntity(entities[99]);
+
+		WHEN("We save it and load it into another world")
+		{
+			Nz::ByteArray snapshot;
+			{
+				Nz::MemoryStream stream(&snapshot, Nz::OpenMode_WriteOnly);
+
+				Nz::SerializationContext context;
+				context.stream = &stream;
+				REQUIRE(world.SaveSnapshot(context));
+			}
+
+			Nz::MemoryStream stream(&snapshot, Nz::OpenMode_ReadOnly);
+
+			Nz::SerializationContext context;
+			context.stream = &stream;
+
+			Ndk::World otherWorld(false);
+			Ndk::World::EntityVector loaded;
+			REQUIRE(otherWorld.LoadSnapshot(context, &loaded));
+
+			THEN("Alive entities and their serializable components are restored")
+			{
+				REQUIRE(loaded.size() == 99);
+				CHECK(stream.EndOfStream());
+
+				CHECK_FALSE(loaded[3]->IsEnabled());
+				CHECK(loaded[4]->IsEnabled());
+				CHECK_FALSE(loaded[4]->HasComponent<UpdatableComponent>());
+
+				for (std::size_t i = 0; i < loaded.size(); ++i)
+				{
+					REQUIRE(loaded[i]->HasComponent<Ndk::NodeComponent>());
+					CHECK(loaded[i]->GetComponent<Ndk::NodeComponent>().GetPosition() == Nz::Vector3f(float(i), 0.f, 0.f));
+
+					REQUIRE(loaded[i]->HasComponent<Ndk::VelocityComponent>() == (i % 2 == 0));
+					if (i % 2 == 0)
+						CHECK(loaded[i]->GetComponent<Ndk::VelocityComponent>().linearVelocity == Nz::Vector3f::UnitY() * float(i));
+				}
+			}
+		}
+	}
+}
+
+SCENARIO("World fixed update", "[NDK][WORLD]")
+{
+	GIVEN("A world with a fixed update rate of 10 per second")
+	{
+		static bool systemsInitialized = (Ndk::InitializeSystem<CountingSystem<true>>(), Ndk::InitializeSystem<CountingSystem<false>>(), true);
+		NazaraUnused(systemsInitialized);
+
+		Ndk::World world(false);
+		world.SetFixedUpdateRate(10.f);
+
+		auto& fixedSystem = world.AddSystem<CountingSystem<true>>();
+		auto& frameSystem = world.AddSystem<CountingSystem<false>>();
+
+		const Ndk::EntityHandle& entity = world.CreateEntity();
+		Ndk::NodeComponent& node = entity->AddComponent<Ndk::NodeComponent>();
+		node.EnableInterpolation();
+
+		REQUIRE(world.IsFixedUpdateEnabled());
+		CHECK(world.GetFixedUpdateRate() == Approx(10.f));
+
+		WHEN("We update it with a quarter of second")
+		{
+			world.Update(0.25f);
+
+			THEN("Fixed step systems run two steps and the others run once")
+			{
+				CHECK(fixedSystem.updateCount == 2);
+				CHECK(fixedSystem.lastElapsedTime == Approx(0.1f));
+				CHECK(frameSystem.updateCount == 1);
+				CHECK(frameSystem.lastElapsedTime == Approx(0.25f));
+				CHECK(world.GetInterpolationFactor() == Approx(0.5f).epsilon(0.01f));
+			}
+		}
+
+		WHEN("We update it with a long frame")
+		{
+			world.SetMaximumFixedUpdateCount(3);
+			world.Update(10.f);
+
+			THEN("The fixed steps are limited")
+			{
+				CHECK(fixedSystem.updateCount == 3);
+				CHECK(world.GetInterpolationFactor() < 1.f);
+			}
+		}
+
+		WHEN("A node moves during the fixed steps")
+		{
+			world.AddSystem<Ndk::VelocitySystem>();
+			entity->AddComponent<Ndk::VelocityComponent>(Nz::Vector3f(100.f, 0.f, 0.f));
+
+			world.Update(0.1f);
+			world.Update(0.15f);
+
+			THEN("Its interpolated transformation lies between its previous and current positions")
+			{
+				CHECK(node.GetPosition().x == Approx(20.f));
+
+				Nz::Matrix4f interpolated = node.GetInterpolatedTransformMatrix(world.GetInterpolationFactor());
+				CHECK(interpolated.GetTranslation().x == Approx(15.f).epsilon(0.01f));
+				CHECK(node.GetInterpolatedTransformMatrix(1.f).GetTranslation().x == Approx(20.f));
+			}
+		}
+
+		WHEN("We disable the fixed update")
+		{
+			world.SetFixedUpdateRate(0.f);
+			world.Update(0.25f);
+
+			THEN("Every system runs once")
+			{
+				CHECK(!world.IsFixedUpdateEnabled());
+				CHECK(fixedSystem.updateCount == 1);
+				CHECK(frameSystem.updateCount == 1);
+			}
+		}
+	}
+}
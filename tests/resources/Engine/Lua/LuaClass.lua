@@ -9,12 +9,14 @@ function test_Test()
     CheckTest(test)
     CheckStatic(result)
     CheckFinalTest(finalTest)
+    CheckCustomMethod(test:GetIPlusArgumentCount(5, 6))
 end
 
 function test_InheritTest()
     local test = InheritTest()
 
     CheckInheritTest(test)
+    CheckInheritedMethod(test:GetI())
 end
 
 function test_TestHandle()
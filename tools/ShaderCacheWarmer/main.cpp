@@ -0,0 +1,92 @@
+// Fills the shader binary cache of UberShaderPreprocessor ahead of time
+//
+// Binaries only work with the driver which produced them, this tool is meant to be run on the target machine (at installation or first launch)
+// Each line of the list file names an uber shader followed by the flags enabled in the permutation, '#' starts a comment:
+//   PhongLighting DIFFUSE_MAPPING NORMAL_MAPPING SHADOW_MAPPING
+//   PhongLighting DIFFUSE_MAPPING FLAG_INSTANCING
+
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/Initializer.hpp>
+#include <Nazara/Core/ParameterList.hpp>
+#include <Nazara/Core/TextScanner.hpp>
+#include <Nazara/Graphics/Graphics.hpp>
+#include <Nazara/Renderer/Shader.hpp>
+#include <Nazara/Renderer/UberShader.hpp>
+#include <Nazara/Renderer/UberShaderPreprocessor.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+
+int main(int argc, char* argv[])
+{
+	if (argc != 3)
+	{
+		std::printf("Usage: %s <permutation list> <cache directory>\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	Nz::Initializer<Nz::Graphics> graphics;
+	if (!graphics)
+	{
+		std::fprintf(stderr, "Failed to initialize Graphics module\n");
+		return EXIT_FAILURE;
+	}
+
+	if (!Nz::Shader::New()->IsBinaryRetrievable())
+	{
+		std::fprintf(stderr, "Shader binaries are not supported by this driver, there is nothing to cache\n");
+		return EXIT_FAILURE;
+	}
+
+	Nz::File listFile(argv[1]);
+	if (!listFile.Open(Nz::OpenMode_ReadOnly))
+	{
+		std::fprintf(stderr, "Failed to open %s\n", argv[1]);
+		return EXIT_FAILURE;
+	}
+
+	Nz::UberShaderPreprocessor::SetCacheDirectory(argv[2]);
+
+	Nz::TextScanner scanner(listFile);
+	scanner.SetCommentMarker("#");
+
+	unsigned int failureCount = 0;
+	unsigned int permutationCount = 0;
+	while (scanner.NextLine())
+	{
+		const char* word;
+		std::size_t wordSize;
+		scanner.ReadWord(&word, &wordSize);
+
+		Nz::String shaderName(word, wordSize);
+
+		Nz::ParameterList parameters;
+		while (scanner.ReadWord(&word, &wordSize))
+			parameters.SetParameter(Nz::String(word, wordSize), true);
+
+		permutationCount++;
+
+		Nz::UberShaderRef uberShader = Nz::UberShaderLibrary::Query(shaderName);
+		if (!uberShader)
+		{
+			std::fprintf(stderr, "Line %u: unknown uber shader %s\n", static_cast<unsigned int>(scanner.GetLineNumber()), shaderName.GetConstBuffer());
+			failureCount++;
+			continue;
+		}
+
+		try
+		{
+			uberShader->Get(parameters);
+		}
+		catch (const std::exception& e)
+		{
+			std::fprintf(stderr, "Line %u: %s\n", static_cast<unsigned int>(scanner.GetLineNumber()), e.what());
+			failureCount++;
+		}
+	}
+
+	std::printf("%u/%u permutations cached in %s\n", permutationCount - failureCount, permutationCount, argv[2]);
+
+	return (failureCount == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}